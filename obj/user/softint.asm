@@ -0,0 +1,7853 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 07 00 00 00       	call   800038 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	asm volatile("int $14");	// page fault
+  800035:	cd 0e                	int    $0xe
+}
+  800037:	c3                   	ret
+
+00800038 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800038:	55                   	push   %ebp
+  800039:	89 e5                	mov    %esp,%ebp
+  80003b:	56                   	push   %esi
+  80003c:	53                   	push   %ebx
+  80003d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800040:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800043:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800045:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80004a:	29 d0                	sub    %edx,%eax
+  80004c:	89 c2                	mov    %eax,%edx
+  80004e:	c1 ea 0f             	shr    $0xf,%edx
+  800051:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80005e:	c7 04 85 40 53 80 00 	movl   $0x0,0x805340(,%eax,4)
+  800065:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800069:	e8 ef 00 00 00       	call   80015d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800079:	89 e1                	mov    %esp,%ecx
+  80007b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800080:	29 ca                	sub    %ecx,%edx
+  800082:	89 d1                	mov    %edx,%ecx
+  800084:	c1 e9 0f             	shr    $0xf,%ecx
+  800087:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80008d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800092:	0f 42 d1             	cmovb  %ecx,%edx
+  800095:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80009a:	89 04 95 40 53 80 00 	mov    %eax,0x805340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000a1:	85 db                	test   %ebx,%ebx
+  8000a3:	7e 07                	jle    8000ac <libmain+0x74>
+		binaryname = argv[0];
+  8000a5:	8b 06                	mov    (%esi),%eax
+  8000a7:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	56                   	push   %esi
+  8000b0:	53                   	push   %ebx
+  8000b1:	e8 7f ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8000b6:	e8 0a 00 00 00       	call   8000c5 <exit>
+}
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000c1:	5b                   	pop    %ebx
+  8000c2:	5e                   	pop    %esi
+  8000c3:	5d                   	pop    %ebp
+  8000c4:	c3                   	ret
+
+008000c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000cb:	e8 17 07 00 00       	call   8007e7 <close_all>
+	sys_env_destroy(0);
+  8000d0:	83 ec 0c             	sub    $0xc,%esp
+  8000d3:	6a 00                	push   $0x0
+  8000d5:	e8 42 00 00 00       	call   80011c <sys_env_destroy>
+}
+  8000da:	83 c4 10             	add    $0x10,%esp
+  8000dd:	c9                   	leave
+  8000de:	c3                   	ret
+
+008000df <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000df:	55                   	push   %ebp
+  8000e0:	89 e5                	mov    %esp,%ebp
+  8000e2:	57                   	push   %edi
+  8000e3:	56                   	push   %esi
+  8000e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000f0:	89 c3                	mov    %eax,%ebx
+  8000f2:	89 c7                	mov    %eax,%edi
+  8000f4:	89 c6                	mov    %eax,%esi
+  8000f6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000f8:	5b                   	pop    %ebx
+  8000f9:	5e                   	pop    %esi
+  8000fa:	5f                   	pop    %edi
+  8000fb:	5d                   	pop    %ebp
+  8000fc:	c3                   	ret
+
+008000fd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	57                   	push   %edi
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800103:	ba 00 00 00 00       	mov    $0x0,%edx
+  800108:	b8 01 00 00 00       	mov    $0x1,%eax
+  80010d:	89 d1                	mov    %edx,%ecx
+  80010f:	89 d3                	mov    %edx,%ebx
+  800111:	89 d7                	mov    %edx,%edi
+  800113:	89 d6                	mov    %edx,%esi
+  800115:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800117:	5b                   	pop    %ebx
+  800118:	5e                   	pop    %esi
+  800119:	5f                   	pop    %edi
+  80011a:	5d                   	pop    %ebp
+  80011b:	c3                   	ret
+
+0080011c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80011c:	55                   	push   %ebp
+  80011d:	89 e5                	mov    %esp,%ebp
+  80011f:	57                   	push   %edi
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800125:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80012d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800132:	89 cb                	mov    %ecx,%ebx
+  800134:	89 cf                	mov    %ecx,%edi
+  800136:	89 ce                	mov    %ecx,%esi
+  800138:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80013a:	85 c0                	test   %eax,%eax
+  80013c:	7f 08                	jg     800146 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80013e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800141:	5b                   	pop    %ebx
+  800142:	5e                   	pop    %esi
+  800143:	5f                   	pop    %edi
+  800144:	5d                   	pop    %ebp
+  800145:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800146:	83 ec 0c             	sub    $0xc,%esp
+  800149:	50                   	push   %eax
+  80014a:	6a 03                	push   $0x3
+  80014c:	68 8a 3a 80 00       	push   $0x803a8a
+  800151:	6a 23                	push   $0x23
+  800153:	68 a7 3a 80 00       	push   $0x803aa7
+  800158:	e8 79 28 00 00       	call   8029d6 <_panic>
+
+0080015d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	57                   	push   %edi
+  800161:	56                   	push   %esi
+  800162:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800163:	ba 00 00 00 00       	mov    $0x0,%edx
+  800168:	b8 02 00 00 00       	mov    $0x2,%eax
+  80016d:	89 d1                	mov    %edx,%ecx
+  80016f:	89 d3                	mov    %edx,%ebx
+  800171:	89 d7                	mov    %edx,%edi
+  800173:	89 d6                	mov    %edx,%esi
+  800175:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800177:	5b                   	pop    %ebx
+  800178:	5e                   	pop    %esi
+  800179:	5f                   	pop    %edi
+  80017a:	5d                   	pop    %ebp
+  80017b:	c3                   	ret
+
+0080017c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80017c:	55                   	push   %ebp
+  80017d:	89 e5                	mov    %esp,%ebp
+  80017f:	57                   	push   %edi
+  800180:	56                   	push   %esi
+  800181:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800182:	ba 00 00 00 00       	mov    $0x0,%edx
+  800187:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80018c:	89 d1                	mov    %edx,%ecx
+  80018e:	89 d3                	mov    %edx,%ebx
+  800190:	89 d7                	mov    %edx,%edi
+  800192:	89 d6                	mov    %edx,%esi
+  800194:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800196:	5b                   	pop    %ebx
+  800197:	5e                   	pop    %esi
+  800198:	5f                   	pop    %edi
+  800199:	5d                   	pop    %ebp
+  80019a:	c3                   	ret
+
+0080019b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80019b:	55                   	push   %ebp
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	57                   	push   %edi
+  80019f:	56                   	push   %esi
+  8001a0:	53                   	push   %ebx
+  8001a1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001b7:	89 f7                	mov    %esi,%edi
+  8001b9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	7f 08                	jg     8001c7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8001bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c2:	5b                   	pop    %ebx
+  8001c3:	5e                   	pop    %esi
+  8001c4:	5f                   	pop    %edi
+  8001c5:	5d                   	pop    %ebp
+  8001c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8001c7:	83 ec 0c             	sub    $0xc,%esp
+  8001ca:	50                   	push   %eax
+  8001cb:	6a 04                	push   $0x4
+  8001cd:	68 8a 3a 80 00       	push   $0x803a8a
+  8001d2:	6a 23                	push   $0x23
+  8001d4:	68 a7 3a 80 00       	push   $0x803aa7
+  8001d9:	e8 f8 27 00 00       	call   8029d6 <_panic>
+
+008001de <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	57                   	push   %edi
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+  8001e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8001e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ed:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001f5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001f8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8001fb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8001fd:	85 c0                	test   %eax,%eax
+  8001ff:	7f 08                	jg     800209 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800201:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800204:	5b                   	pop    %ebx
+  800205:	5e                   	pop    %esi
+  800206:	5f                   	pop    %edi
+  800207:	5d                   	pop    %ebp
+  800208:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	50                   	push   %eax
+  80020d:	6a 05                	push   $0x5
+  80020f:	68 8a 3a 80 00       	push   $0x803a8a
+  800214:	6a 23                	push   $0x23
+  800216:	68 a7 3a 80 00       	push   $0x803aa7
+  80021b:	e8 b6 27 00 00       	call   8029d6 <_panic>
+
+00800220 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800220:	55                   	push   %ebp
+  800221:	89 e5                	mov    %esp,%ebp
+  800223:	57                   	push   %edi
+  800224:	56                   	push   %esi
+  800225:	53                   	push   %ebx
+  800226:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800229:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80022e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800234:	b8 06 00 00 00       	mov    $0x6,%eax
+  800239:	89 df                	mov    %ebx,%edi
+  80023b:	89 de                	mov    %ebx,%esi
+  80023d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	7f 08                	jg     80024b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800243:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800246:	5b                   	pop    %ebx
+  800247:	5e                   	pop    %esi
+  800248:	5f                   	pop    %edi
+  800249:	5d                   	pop    %ebp
+  80024a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80024b:	83 ec 0c             	sub    $0xc,%esp
+  80024e:	50                   	push   %eax
+  80024f:	6a 06                	push   $0x6
+  800251:	68 8a 3a 80 00       	push   $0x803a8a
+  800256:	6a 23                	push   $0x23
+  800258:	68 a7 3a 80 00       	push   $0x803aa7
+  80025d:	e8 74 27 00 00       	call   8029d6 <_panic>
+
+00800262 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	57                   	push   %edi
+  800266:	56                   	push   %esi
+  800267:	53                   	push   %ebx
+  800268:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80026b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800270:	8b 55 08             	mov    0x8(%ebp),%edx
+  800273:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800276:	b8 08 00 00 00       	mov    $0x8,%eax
+  80027b:	89 df                	mov    %ebx,%edi
+  80027d:	89 de                	mov    %ebx,%esi
+  80027f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800281:	85 c0                	test   %eax,%eax
+  800283:	7f 08                	jg     80028d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800288:	5b                   	pop    %ebx
+  800289:	5e                   	pop    %esi
+  80028a:	5f                   	pop    %edi
+  80028b:	5d                   	pop    %ebp
+  80028c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80028d:	83 ec 0c             	sub    $0xc,%esp
+  800290:	50                   	push   %eax
+  800291:	6a 08                	push   $0x8
+  800293:	68 8a 3a 80 00       	push   $0x803a8a
+  800298:	6a 23                	push   $0x23
+  80029a:	68 a7 3a 80 00       	push   $0x803aa7
+  80029f:	e8 32 27 00 00       	call   8029d6 <_panic>
+
+008002a4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8002bd:	89 df                	mov    %ebx,%edi
+  8002bf:	89 de                	mov    %ebx,%esi
+  8002c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8002c3:	85 c0                	test   %eax,%eax
+  8002c5:	7f 08                	jg     8002cf <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8002c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ca:	5b                   	pop    %ebx
+  8002cb:	5e                   	pop    %esi
+  8002cc:	5f                   	pop    %edi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	50                   	push   %eax
+  8002d3:	6a 09                	push   $0x9
+  8002d5:	68 8a 3a 80 00       	push   $0x803a8a
+  8002da:	6a 23                	push   $0x23
+  8002dc:	68 a7 3a 80 00       	push   $0x803aa7
+  8002e1:	e8 f0 26 00 00       	call   8029d6 <_panic>
+
+008002e6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	57                   	push   %edi
+  8002ea:	56                   	push   %esi
+  8002eb:	53                   	push   %ebx
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8002ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8002ff:	89 df                	mov    %ebx,%edi
+  800301:	89 de                	mov    %ebx,%esi
+  800303:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800305:	85 c0                	test   %eax,%eax
+  800307:	7f 08                	jg     800311 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800311:	83 ec 0c             	sub    $0xc,%esp
+  800314:	50                   	push   %eax
+  800315:	6a 0a                	push   $0xa
+  800317:	68 8a 3a 80 00       	push   $0x803a8a
+  80031c:	6a 23                	push   $0x23
+  80031e:	68 a7 3a 80 00       	push   $0x803aa7
+  800323:	e8 ae 26 00 00       	call   8029d6 <_panic>
+
+00800328 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	57                   	push   %edi
+  80032c:	56                   	push   %esi
+  80032d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80032e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800334:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800339:	be 00 00 00 00       	mov    $0x0,%esi
+  80033e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800341:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800344:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800346:	5b                   	pop    %ebx
+  800347:	5e                   	pop    %esi
+  800348:	5f                   	pop    %edi
+  800349:	5d                   	pop    %ebp
+  80034a:	c3                   	ret
+
+0080034b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	57                   	push   %edi
+  80034f:	56                   	push   %esi
+  800350:	53                   	push   %ebx
+  800351:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800354:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800361:	89 cb                	mov    %ecx,%ebx
+  800363:	89 cf                	mov    %ecx,%edi
+  800365:	89 ce                	mov    %ecx,%esi
+  800367:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	7f 08                	jg     800375 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80036d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800370:	5b                   	pop    %ebx
+  800371:	5e                   	pop    %esi
+  800372:	5f                   	pop    %edi
+  800373:	5d                   	pop    %ebp
+  800374:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800375:	83 ec 0c             	sub    $0xc,%esp
+  800378:	50                   	push   %eax
+  800379:	6a 0d                	push   $0xd
+  80037b:	68 8a 3a 80 00       	push   $0x803a8a
+  800380:	6a 23                	push   $0x23
+  800382:	68 a7 3a 80 00       	push   $0x803aa7
+  800387:	e8 4a 26 00 00       	call   8029d6 <_panic>
+
+0080038c <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	57                   	push   %edi
+  800390:	56                   	push   %esi
+  800391:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800392:	8b 55 08             	mov    0x8(%ebp),%edx
+  800395:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800398:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80039d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8003a0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003a3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8003a6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8003a8:	5b                   	pop    %ebx
+  8003a9:	5e                   	pop    %esi
+  8003aa:	5f                   	pop    %edi
+  8003ab:	5d                   	pop    %ebp
+  8003ac:	c3                   	ret
+
+008003ad <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	56                   	push   %esi
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8003b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8003c6:	89 df                	mov    %ebx,%edi
+  8003c8:	89 de                	mov    %ebx,%esi
+  8003ca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8003cc:	85 c0                	test   %eax,%eax
+  8003ce:	7f 08                	jg     8003d8 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8003d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d3:	5b                   	pop    %ebx
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5f                   	pop    %edi
+  8003d6:	5d                   	pop    %ebp
+  8003d7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8003d8:	83 ec 0c             	sub    $0xc,%esp
+  8003db:	50                   	push   %eax
+  8003dc:	6a 0d                	push   $0xd
+  8003de:	68 8a 3a 80 00       	push   $0x803a8a
+  8003e3:	6a 23                	push   $0x23
+  8003e5:	68 a7 3a 80 00       	push   $0x803aa7
+  8003ea:	e8 e7 25 00 00       	call   8029d6 <_panic>
+
+008003ef <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	57                   	push   %edi
+  8003f3:	56                   	push   %esi
+  8003f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8003f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003fa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8003ff:	89 d1                	mov    %edx,%ecx
+  800401:	89 d3                	mov    %edx,%ebx
+  800403:	89 d7                	mov    %edx,%edi
+  800405:	89 d6                	mov    %edx,%esi
+  800407:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800409:	5b                   	pop    %ebx
+  80040a:	5e                   	pop    %esi
+  80040b:	5f                   	pop    %edi
+  80040c:	5d                   	pop    %ebp
+  80040d:	c3                   	ret
+
+0080040e <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	57                   	push   %edi
+  800412:	56                   	push   %esi
+  800413:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800414:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800419:	8b 55 08             	mov    0x8(%ebp),%edx
+  80041c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80041f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800424:	89 df                	mov    %ebx,%edi
+  800426:	89 de                	mov    %ebx,%esi
+  800428:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80042a:	5b                   	pop    %ebx
+  80042b:	5e                   	pop    %esi
+  80042c:	5f                   	pop    %edi
+  80042d:	5d                   	pop    %ebp
+  80042e:	c3                   	ret
+
+0080042f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80042f:	55                   	push   %ebp
+  800430:	89 e5                	mov    %esp,%ebp
+  800432:	57                   	push   %edi
+  800433:	56                   	push   %esi
+  800434:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800435:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80043a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800442:	89 cb                	mov    %ecx,%ebx
+  800444:	89 cf                	mov    %ecx,%edi
+  800446:	89 ce                	mov    %ecx,%esi
+  800448:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80044a:	5b                   	pop    %ebx
+  80044b:	5e                   	pop    %esi
+  80044c:	5f                   	pop    %edi
+  80044d:	5d                   	pop    %ebp
+  80044e:	c3                   	ret
+
+0080044f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80044f:	55                   	push   %ebp
+  800450:	89 e5                	mov    %esp,%ebp
+  800452:	57                   	push   %edi
+  800453:	56                   	push   %esi
+  800454:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800455:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80045a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80045d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800460:	b8 11 00 00 00       	mov    $0x11,%eax
+  800465:	89 df                	mov    %ebx,%edi
+  800467:	89 de                	mov    %ebx,%esi
+  800469:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80046b:	5b                   	pop    %ebx
+  80046c:	5e                   	pop    %esi
+  80046d:	5f                   	pop    %edi
+  80046e:	5d                   	pop    %ebp
+  80046f:	c3                   	ret
+
+00800470 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800470:	55                   	push   %ebp
+  800471:	89 e5                	mov    %esp,%ebp
+  800473:	57                   	push   %edi
+  800474:	56                   	push   %esi
+  800475:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800476:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80047b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800481:	b8 12 00 00 00       	mov    $0x12,%eax
+  800486:	89 df                	mov    %ebx,%edi
+  800488:	89 de                	mov    %ebx,%esi
+  80048a:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80048c:	5b                   	pop    %ebx
+  80048d:	5e                   	pop    %esi
+  80048e:	5f                   	pop    %edi
+  80048f:	5d                   	pop    %ebp
+  800490:	c3                   	ret
+
+00800491 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  800491:	55                   	push   %ebp
+  800492:	89 e5                	mov    %esp,%ebp
+  800494:	57                   	push   %edi
+  800495:	56                   	push   %esi
+  800496:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800497:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80049c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049f:	b8 13 00 00 00       	mov    $0x13,%eax
+  8004a4:	89 cb                	mov    %ecx,%ebx
+  8004a6:	89 cf                	mov    %ecx,%edi
+  8004a8:	89 ce                	mov    %ecx,%esi
+  8004aa:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8004ac:	5b                   	pop    %ebx
+  8004ad:	5e                   	pop    %esi
+  8004ae:	5f                   	pop    %edi
+  8004af:	5d                   	pop    %ebp
+  8004b0:	c3                   	ret
+
+008004b1 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8004b1:	55                   	push   %ebp
+  8004b2:	89 e5                	mov    %esp,%ebp
+  8004b4:	57                   	push   %edi
+  8004b5:	56                   	push   %esi
+  8004b6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004c2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8004c7:	89 df                	mov    %ebx,%edi
+  8004c9:	89 de                	mov    %ebx,%esi
+  8004cb:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8004cd:	5b                   	pop    %ebx
+  8004ce:	5e                   	pop    %esi
+  8004cf:	5f                   	pop    %edi
+  8004d0:	5d                   	pop    %ebp
+  8004d1:	c3                   	ret
+
+008004d2 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8004d2:	55                   	push   %ebp
+  8004d3:	89 e5                	mov    %esp,%ebp
+  8004d5:	57                   	push   %edi
+  8004d6:	56                   	push   %esi
+  8004d7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8004e5:	89 cb                	mov    %ecx,%ebx
+  8004e7:	89 cf                	mov    %ecx,%edi
+  8004e9:	89 ce                	mov    %ecx,%esi
+  8004eb:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8004ed:	5b                   	pop    %ebx
+  8004ee:	5e                   	pop    %esi
+  8004ef:	5f                   	pop    %edi
+  8004f0:	5d                   	pop    %ebp
+  8004f1:	c3                   	ret
+
+008004f2 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8004f2:	55                   	push   %ebp
+  8004f3:	89 e5                	mov    %esp,%ebp
+  8004f5:	57                   	push   %edi
+  8004f6:	56                   	push   %esi
+  8004f7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8004f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8004fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800500:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800503:	b8 16 00 00 00       	mov    $0x16,%eax
+  800508:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050b:	89 f7                	mov    %esi,%edi
+  80050d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80050f:	5b                   	pop    %ebx
+  800510:	5e                   	pop    %esi
+  800511:	5f                   	pop    %edi
+  800512:	5d                   	pop    %ebp
+  800513:	c3                   	ret
+
+00800514 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800514:	55                   	push   %ebp
+  800515:	89 e5                	mov    %esp,%ebp
+  800517:	57                   	push   %edi
+  800518:	56                   	push   %esi
+  800519:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80051a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80051f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800522:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800525:	b8 17 00 00 00       	mov    $0x17,%eax
+  80052a:	89 df                	mov    %ebx,%edi
+  80052c:	89 de                	mov    %ebx,%esi
+  80052e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800530:	5b                   	pop    %ebx
+  800531:	5e                   	pop    %esi
+  800532:	5f                   	pop    %edi
+  800533:	5d                   	pop    %ebp
+  800534:	c3                   	ret
+
+00800535 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800535:	55                   	push   %ebp
+  800536:	89 e5                	mov    %esp,%ebp
+  800538:	57                   	push   %edi
+  800539:	56                   	push   %esi
+  80053a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80053b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800540:	8b 55 08             	mov    0x8(%ebp),%edx
+  800543:	b8 18 00 00 00       	mov    $0x18,%eax
+  800548:	89 cb                	mov    %ecx,%ebx
+  80054a:	89 cf                	mov    %ecx,%edi
+  80054c:	89 ce                	mov    %ecx,%esi
+  80054e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800550:	5b                   	pop    %ebx
+  800551:	5e                   	pop    %esi
+  800552:	5f                   	pop    %edi
+  800553:	5d                   	pop    %ebp
+  800554:	c3                   	ret
+
+00800555 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800555:	55                   	push   %ebp
+  800556:	89 e5                	mov    %esp,%ebp
+  800558:	57                   	push   %edi
+  800559:	56                   	push   %esi
+  80055a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80055b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80055f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800564:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800567:	b8 19 00 00 00       	mov    $0x19,%eax
+  80056c:	89 df                	mov    %ebx,%edi
+  80056e:	89 de                	mov    %ebx,%esi
+  800570:	cd 30                	int    $0x30
+}
+  800572:	5b                   	pop    %ebx
+  800573:	5e                   	pop    %esi
+  800574:	5f                   	pop    %edi
+  800575:	5d                   	pop    %ebp
+  800576:	c3                   	ret
+
+00800577 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  800577:	55                   	push   %ebp
+  800578:	89 e5                	mov    %esp,%ebp
+  80057a:	57                   	push   %edi
+  80057b:	56                   	push   %esi
+  80057c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80057d:	be 00 00 00 00       	mov    $0x0,%esi
+  800582:	8b 55 08             	mov    0x8(%ebp),%edx
+  800585:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800588:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80058d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800590:	89 f7                	mov    %esi,%edi
+  800592:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  800594:	5b                   	pop    %ebx
+  800595:	5e                   	pop    %esi
+  800596:	5f                   	pop    %edi
+  800597:	5d                   	pop    %ebp
+  800598:	c3                   	ret
+
+00800599 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  800599:	55                   	push   %ebp
+  80059a:	89 e5                	mov    %esp,%ebp
+  80059c:	57                   	push   %edi
+  80059d:	56                   	push   %esi
+  80059e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80059f:	be 00 00 00 00       	mov    $0x0,%esi
+  8005a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005aa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8005af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005b2:	89 f7                	mov    %esi,%edi
+  8005b4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8005b6:	5b                   	pop    %ebx
+  8005b7:	5e                   	pop    %esi
+  8005b8:	5f                   	pop    %edi
+  8005b9:	5d                   	pop    %ebp
+  8005ba:	c3                   	ret
+
+008005bb <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8005bb:	55                   	push   %ebp
+  8005bc:	89 e5                	mov    %esp,%ebp
+  8005be:	57                   	push   %edi
+  8005bf:	56                   	push   %esi
+  8005c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8005d1:	89 df                	mov    %ebx,%edi
+  8005d3:	89 de                	mov    %ebx,%esi
+  8005d5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8005d7:	5b                   	pop    %ebx
+  8005d8:	5e                   	pop    %esi
+  8005d9:	5f                   	pop    %edi
+  8005da:	5d                   	pop    %ebp
+  8005db:	c3                   	ret
+
+008005dc <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8005dc:	55                   	push   %ebp
+  8005dd:	89 e5                	mov    %esp,%ebp
+  8005df:	57                   	push   %edi
+  8005e0:	56                   	push   %esi
+  8005e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8005e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8005e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005ed:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8005f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005f5:	89 f7                	mov    %esi,%edi
+  8005f7:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8005f9:	5b                   	pop    %ebx
+  8005fa:	5e                   	pop    %esi
+  8005fb:	5f                   	pop    %edi
+  8005fc:	5d                   	pop    %ebp
+  8005fd:	c3                   	ret
+
+008005fe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8005fe:	55                   	push   %ebp
+  8005ff:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800601:	8b 45 08             	mov    0x8(%ebp),%eax
+  800604:	05 00 00 00 30       	add    $0x30000000,%eax
+  800609:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80060c:	5d                   	pop    %ebp
+  80060d:	c3                   	ret
+
+0080060e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80060e:	55                   	push   %ebp
+  80060f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800611:	8b 45 08             	mov    0x8(%ebp),%eax
+  800614:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800619:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80061e:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800623:	5d                   	pop    %ebp
+  800624:	c3                   	ret
+
+00800625 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800625:	55                   	push   %ebp
+  800626:	89 e5                	mov    %esp,%ebp
+  800628:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80062d:	89 c2                	mov    %eax,%edx
+  80062f:	c1 ea 16             	shr    $0x16,%edx
+  800632:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800639:	f6 c2 01             	test   $0x1,%dl
+  80063c:	74 29                	je     800667 <fd_alloc+0x42>
+  80063e:	89 c2                	mov    %eax,%edx
+  800640:	c1 ea 0c             	shr    $0xc,%edx
+  800643:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80064a:	f6 c2 01             	test   $0x1,%dl
+  80064d:	74 18                	je     800667 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80064f:	05 00 10 00 00       	add    $0x1000,%eax
+  800654:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800659:	75 d2                	jne    80062d <fd_alloc+0x8>
+  80065b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800660:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800665:	eb 05                	jmp    80066c <fd_alloc+0x47>
+			return 0;
+  800667:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80066c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80066f:	89 02                	mov    %eax,(%edx)
+}
+  800671:	89 c8                	mov    %ecx,%eax
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  800678:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80067b:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800680:	77 30                	ja     8006b2 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800682:	c1 e0 0c             	shl    $0xc,%eax
+  800685:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80068a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800690:	f6 c2 01             	test   $0x1,%dl
+  800693:	74 24                	je     8006b9 <fd_lookup+0x44>
+  800695:	89 c2                	mov    %eax,%edx
+  800697:	c1 ea 0c             	shr    $0xc,%edx
+  80069a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006a1:	f6 c2 01             	test   $0x1,%dl
+  8006a4:	74 1a                	je     8006c0 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8006a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006a9:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8006ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8006b0:	5d                   	pop    %ebp
+  8006b1:	c3                   	ret
+		return -E_INVAL;
+  8006b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006b7:	eb f7                	jmp    8006b0 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8006b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006be:	eb f0                	jmp    8006b0 <fd_lookup+0x3b>
+  8006c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006c5:	eb e9                	jmp    8006b0 <fd_lookup+0x3b>
+
+008006c7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8006c7:	55                   	push   %ebp
+  8006c8:	89 e5                	mov    %esp,%ebp
+  8006ca:	53                   	push   %ebx
+  8006cb:	83 ec 04             	sub    $0x4,%esp
+  8006ce:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8006d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d6:	bb 20 40 80 00       	mov    $0x804020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8006db:	39 13                	cmp    %edx,(%ebx)
+  8006dd:	74 54                	je     800733 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8006df:	83 c0 01             	add    $0x1,%eax
+  8006e2:	8b 1c 85 34 3b 80 00 	mov    0x803b34(,%eax,4),%ebx
+  8006e9:	85 db                	test   %ebx,%ebx
+  8006eb:	75 ee                	jne    8006db <dev_lookup+0x14>
+  8006ed:	89 e1                	mov    %esp,%ecx
+  8006ef:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8006f4:	29 c8                	sub    %ecx,%eax
+  8006f6:	89 c1                	mov    %eax,%ecx
+  8006f8:	c1 e9 0f             	shr    $0xf,%ecx
+  8006fb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800700:	b8 00 00 00 00       	mov    $0x0,%eax
+  800705:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800708:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80070f:	8b 40 48             	mov    0x48(%eax),%eax
+  800712:	83 ec 04             	sub    $0x4,%esp
+  800715:	52                   	push   %edx
+  800716:	50                   	push   %eax
+  800717:	68 b8 3a 80 00       	push   $0x803ab8
+  80071c:	e8 90 23 00 00       	call   802ab1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800721:	83 c4 10             	add    $0x10,%esp
+  800724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800729:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072c:	89 1a                	mov    %ebx,(%edx)
+}
+  80072e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800731:	c9                   	leave
+  800732:	c3                   	ret
+			return 0;
+  800733:	b8 00 00 00 00       	mov    $0x0,%eax
+  800738:	eb ef                	jmp    800729 <dev_lookup+0x62>
+
+0080073a <fd_close>:
+{
+  80073a:	55                   	push   %ebp
+  80073b:	89 e5                	mov    %esp,%ebp
+  80073d:	57                   	push   %edi
+  80073e:	56                   	push   %esi
+  80073f:	53                   	push   %ebx
+  800740:	83 ec 24             	sub    $0x24,%esp
+  800743:	8b 75 08             	mov    0x8(%ebp),%esi
+  800746:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800749:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80074c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80074d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800753:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800756:	50                   	push   %eax
+  800757:	e8 19 ff ff ff       	call   800675 <fd_lookup>
+  80075c:	89 c3                	mov    %eax,%ebx
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	85 c0                	test   %eax,%eax
+  800763:	78 05                	js     80076a <fd_close+0x30>
+	    || fd != fd2)
+  800765:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800768:	74 0f                	je     800779 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80076a:	85 ff                	test   %edi,%edi
+  80076c:	0f 44 df             	cmove  %edi,%ebx
+}
+  80076f:	89 d8                	mov    %ebx,%eax
+  800771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800774:	5b                   	pop    %ebx
+  800775:	5e                   	pop    %esi
+  800776:	5f                   	pop    %edi
+  800777:	5d                   	pop    %ebp
+  800778:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800779:	83 ec 08             	sub    $0x8,%esp
+  80077c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80077f:	50                   	push   %eax
+  800780:	ff 36                	push   (%esi)
+  800782:	e8 40 ff ff ff       	call   8006c7 <dev_lookup>
+  800787:	89 c3                	mov    %eax,%ebx
+  800789:	83 c4 10             	add    $0x10,%esp
+  80078c:	85 c0                	test   %eax,%eax
+  80078e:	78 1a                	js     8007aa <fd_close+0x70>
+		if (dev->dev_close)
+  800790:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800793:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800796:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80079b:	85 c0                	test   %eax,%eax
+  80079d:	74 0b                	je     8007aa <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80079f:	83 ec 0c             	sub    $0xc,%esp
+  8007a2:	56                   	push   %esi
+  8007a3:	ff d0                	call   *%eax
+  8007a5:	89 c3                	mov    %eax,%ebx
+  8007a7:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	56                   	push   %esi
+  8007ae:	6a 00                	push   $0x0
+  8007b0:	e8 6b fa ff ff       	call   800220 <sys_page_unmap>
+	return r;
+  8007b5:	83 c4 10             	add    $0x10,%esp
+  8007b8:	eb b5                	jmp    80076f <fd_close+0x35>
+
+008007ba <close>:
+
+int
+close(int fdnum)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007c3:	50                   	push   %eax
+  8007c4:	ff 75 08             	push   0x8(%ebp)
+  8007c7:	e8 a9 fe ff ff       	call   800675 <fd_lookup>
+  8007cc:	83 c4 10             	add    $0x10,%esp
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	79 02                	jns    8007d5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+		return fd_close(fd, 1);
+  8007d5:	83 ec 08             	sub    $0x8,%esp
+  8007d8:	6a 01                	push   $0x1
+  8007da:	ff 75 f4             	push   -0xc(%ebp)
+  8007dd:	e8 58 ff ff ff       	call   80073a <fd_close>
+  8007e2:	83 c4 10             	add    $0x10,%esp
+  8007e5:	eb ec                	jmp    8007d3 <close+0x19>
+
+008007e7 <close_all>:
+
+void
+close_all(void)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	53                   	push   %ebx
+  8007eb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8007ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8007f3:	83 ec 0c             	sub    $0xc,%esp
+  8007f6:	53                   	push   %ebx
+  8007f7:	e8 be ff ff ff       	call   8007ba <close>
+	for (i = 0; i < MAXFD; i++)
+  8007fc:	83 c3 01             	add    $0x1,%ebx
+  8007ff:	83 c4 10             	add    $0x10,%esp
+  800802:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800808:	75 e9                	jne    8007f3 <close_all+0xc>
+}
+  80080a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080d:	c9                   	leave
+  80080e:	c3                   	ret
+
+0080080f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	57                   	push   %edi
+  800813:	56                   	push   %esi
+  800814:	53                   	push   %ebx
+  800815:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800818:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80081b:	50                   	push   %eax
+  80081c:	ff 75 08             	push   0x8(%ebp)
+  80081f:	e8 51 fe ff ff       	call   800675 <fd_lookup>
+  800824:	89 c3                	mov    %eax,%ebx
+  800826:	83 c4 10             	add    $0x10,%esp
+  800829:	85 c0                	test   %eax,%eax
+  80082b:	78 7f                	js     8008ac <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80082d:	83 ec 0c             	sub    $0xc,%esp
+  800830:	ff 75 0c             	push   0xc(%ebp)
+  800833:	e8 82 ff ff ff       	call   8007ba <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800838:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80083b:	c1 e6 0c             	shl    $0xc,%esi
+  80083e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800844:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800847:	89 3c 24             	mov    %edi,(%esp)
+  80084a:	e8 bf fd ff ff       	call   80060e <fd2data>
+  80084f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800851:	89 34 24             	mov    %esi,(%esp)
+  800854:	e8 b5 fd ff ff       	call   80060e <fd2data>
+  800859:	83 c4 10             	add    $0x10,%esp
+  80085c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80085f:	89 d8                	mov    %ebx,%eax
+  800861:	c1 e8 16             	shr    $0x16,%eax
+  800864:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80086b:	a8 01                	test   $0x1,%al
+  80086d:	74 11                	je     800880 <dup+0x71>
+  80086f:	89 d8                	mov    %ebx,%eax
+  800871:	c1 e8 0c             	shr    $0xc,%eax
+  800874:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80087b:	f6 c2 01             	test   $0x1,%dl
+  80087e:	75 36                	jne    8008b6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800880:	89 f8                	mov    %edi,%eax
+  800882:	c1 e8 0c             	shr    $0xc,%eax
+  800885:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80088c:	83 ec 0c             	sub    $0xc,%esp
+  80088f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800894:	50                   	push   %eax
+  800895:	56                   	push   %esi
+  800896:	6a 00                	push   $0x0
+  800898:	57                   	push   %edi
+  800899:	6a 00                	push   $0x0
+  80089b:	e8 3e f9 ff ff       	call   8001de <sys_page_map>
+  8008a0:	89 c3                	mov    %eax,%ebx
+  8008a2:	83 c4 20             	add    $0x20,%esp
+  8008a5:	85 c0                	test   %eax,%eax
+  8008a7:	78 33                	js     8008dc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8008a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8008ac:	89 d8                	mov    %ebx,%eax
+  8008ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b1:	5b                   	pop    %ebx
+  8008b2:	5e                   	pop    %esi
+  8008b3:	5f                   	pop    %edi
+  8008b4:	5d                   	pop    %ebp
+  8008b5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8008b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8008bd:	83 ec 0c             	sub    $0xc,%esp
+  8008c0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008c5:	50                   	push   %eax
+  8008c6:	ff 75 d4             	push   -0x2c(%ebp)
+  8008c9:	6a 00                	push   $0x0
+  8008cb:	53                   	push   %ebx
+  8008cc:	6a 00                	push   $0x0
+  8008ce:	e8 0b f9 ff ff       	call   8001de <sys_page_map>
+  8008d3:	89 c3                	mov    %eax,%ebx
+  8008d5:	83 c4 20             	add    $0x20,%esp
+  8008d8:	85 c0                	test   %eax,%eax
+  8008da:	79 a4                	jns    800880 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8008dc:	83 ec 08             	sub    $0x8,%esp
+  8008df:	56                   	push   %esi
+  8008e0:	6a 00                	push   $0x0
+  8008e2:	e8 39 f9 ff ff       	call   800220 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8008e7:	83 c4 08             	add    $0x8,%esp
+  8008ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ed:	6a 00                	push   $0x0
+  8008ef:	e8 2c f9 ff ff       	call   800220 <sys_page_unmap>
+	return r;
+  8008f4:	83 c4 10             	add    $0x10,%esp
+  8008f7:	eb b3                	jmp    8008ac <dup+0x9d>
+
+008008f9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	56                   	push   %esi
+  8008fd:	53                   	push   %ebx
+  8008fe:	83 ec 18             	sub    $0x18,%esp
+  800901:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800904:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800907:	50                   	push   %eax
+  800908:	53                   	push   %ebx
+  800909:	e8 67 fd ff ff       	call   800675 <fd_lookup>
+  80090e:	83 c4 10             	add    $0x10,%esp
+  800911:	85 c0                	test   %eax,%eax
+  800913:	78 3c                	js     800951 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800915:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800918:	83 ec 08             	sub    $0x8,%esp
+  80091b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80091e:	50                   	push   %eax
+  80091f:	ff 36                	push   (%esi)
+  800921:	e8 a1 fd ff ff       	call   8006c7 <dev_lookup>
+  800926:	83 c4 10             	add    $0x10,%esp
+  800929:	85 c0                	test   %eax,%eax
+  80092b:	78 24                	js     800951 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80092d:	8b 46 08             	mov    0x8(%esi),%eax
+  800930:	83 e0 03             	and    $0x3,%eax
+  800933:	83 f8 01             	cmp    $0x1,%eax
+  800936:	74 20                	je     800958 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093b:	8b 40 08             	mov    0x8(%eax),%eax
+  80093e:	85 c0                	test   %eax,%eax
+  800940:	74 54                	je     800996 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800942:	83 ec 04             	sub    $0x4,%esp
+  800945:	ff 75 10             	push   0x10(%ebp)
+  800948:	ff 75 0c             	push   0xc(%ebp)
+  80094b:	56                   	push   %esi
+  80094c:	ff d0                	call   *%eax
+  80094e:	83 c4 10             	add    $0x10,%esp
+}
+  800951:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800954:	5b                   	pop    %ebx
+  800955:	5e                   	pop    %esi
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+  800958:	89 e2                	mov    %esp,%edx
+  80095a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80095f:	29 d0                	sub    %edx,%eax
+  800961:	89 c2                	mov    %eax,%edx
+  800963:	c1 ea 0f             	shr    $0xf,%edx
+  800966:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80096b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800970:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800973:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80097a:	8b 40 48             	mov    0x48(%eax),%eax
+  80097d:	83 ec 04             	sub    $0x4,%esp
+  800980:	53                   	push   %ebx
+  800981:	50                   	push   %eax
+  800982:	68 f9 3a 80 00       	push   $0x803af9
+  800987:	e8 25 21 00 00       	call   802ab1 <cprintf>
+		return -E_INVAL;
+  80098c:	83 c4 10             	add    $0x10,%esp
+  80098f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800994:	eb bb                	jmp    800951 <read+0x58>
+		return -E_NOT_SUPP;
+  800996:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80099b:	eb b4                	jmp    800951 <read+0x58>
+
+0080099d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80099d:	55                   	push   %ebp
+  80099e:	89 e5                	mov    %esp,%ebp
+  8009a0:	57                   	push   %edi
+  8009a1:	56                   	push   %esi
+  8009a2:	53                   	push   %ebx
+  8009a3:	83 ec 0c             	sub    $0xc,%esp
+  8009a6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8009a9:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8009ac:	85 f6                	test   %esi,%esi
+  8009ae:	74 30                	je     8009e0 <readn+0x43>
+  8009b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009b5:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8009ba:	83 ec 04             	sub    $0x4,%esp
+  8009bd:	89 f2                	mov    %esi,%edx
+  8009bf:	29 c2                	sub    %eax,%edx
+  8009c1:	52                   	push   %edx
+  8009c2:	01 f8                	add    %edi,%eax
+  8009c4:	50                   	push   %eax
+  8009c5:	ff 75 08             	push   0x8(%ebp)
+  8009c8:	e8 2c ff ff ff       	call   8008f9 <read>
+		if (m < 0)
+  8009cd:	83 c4 10             	add    $0x10,%esp
+  8009d0:	85 c0                	test   %eax,%eax
+  8009d2:	78 15                	js     8009e9 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8009d4:	74 11                	je     8009e7 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8009d6:	01 c3                	add    %eax,%ebx
+  8009d8:	89 d8                	mov    %ebx,%eax
+  8009da:	39 f3                	cmp    %esi,%ebx
+  8009dc:	72 dc                	jb     8009ba <readn+0x1d>
+  8009de:	eb 09                	jmp    8009e9 <readn+0x4c>
+  8009e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e5:	eb 02                	jmp    8009e9 <readn+0x4c>
+  8009e7:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8009e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009ec:	5b                   	pop    %ebx
+  8009ed:	5e                   	pop    %esi
+  8009ee:	5f                   	pop    %edi
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	83 ec 18             	sub    $0x18,%esp
+  8009f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009ff:	50                   	push   %eax
+  800a00:	53                   	push   %ebx
+  800a01:	e8 6f fc ff ff       	call   800675 <fd_lookup>
+  800a06:	83 c4 10             	add    $0x10,%esp
+  800a09:	85 c0                	test   %eax,%eax
+  800a0b:	78 37                	js     800a44 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a0d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a10:	83 ec 08             	sub    $0x8,%esp
+  800a13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a16:	50                   	push   %eax
+  800a17:	ff 36                	push   (%esi)
+  800a19:	e8 a9 fc ff ff       	call   8006c7 <dev_lookup>
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	85 c0                	test   %eax,%eax
+  800a23:	78 1f                	js     800a44 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a25:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a29:	74 20                	je     800a4b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	74 54                	je     800a89 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800a35:	83 ec 04             	sub    $0x4,%esp
+  800a38:	ff 75 10             	push   0x10(%ebp)
+  800a3b:	ff 75 0c             	push   0xc(%ebp)
+  800a3e:	56                   	push   %esi
+  800a3f:	ff d0                	call   *%eax
+  800a41:	83 c4 10             	add    $0x10,%esp
+}
+  800a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a47:	5b                   	pop    %ebx
+  800a48:	5e                   	pop    %esi
+  800a49:	5d                   	pop    %ebp
+  800a4a:	c3                   	ret
+  800a4b:	89 e2                	mov    %esp,%edx
+  800a4d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800a52:	29 d0                	sub    %edx,%eax
+  800a54:	89 c2                	mov    %eax,%edx
+  800a56:	c1 ea 0f             	shr    $0xf,%edx
+  800a59:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a63:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a66:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800a6d:	8b 40 48             	mov    0x48(%eax),%eax
+  800a70:	83 ec 04             	sub    $0x4,%esp
+  800a73:	53                   	push   %ebx
+  800a74:	50                   	push   %eax
+  800a75:	68 15 3b 80 00       	push   $0x803b15
+  800a7a:	e8 32 20 00 00       	call   802ab1 <cprintf>
+		return -E_INVAL;
+  800a7f:	83 c4 10             	add    $0x10,%esp
+  800a82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a87:	eb bb                	jmp    800a44 <write+0x53>
+		return -E_NOT_SUPP;
+  800a89:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a8e:	eb b4                	jmp    800a44 <write+0x53>
+
+00800a90 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800a90:	55                   	push   %ebp
+  800a91:	89 e5                	mov    %esp,%ebp
+  800a93:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800a96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a99:	50                   	push   %eax
+  800a9a:	ff 75 08             	push   0x8(%ebp)
+  800a9d:	e8 d3 fb ff ff       	call   800675 <fd_lookup>
+  800aa2:	83 c4 10             	add    $0x10,%esp
+  800aa5:	85 c0                	test   %eax,%eax
+  800aa7:	78 0e                	js     800ab7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  800aa9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aaf:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab7:	c9                   	leave
+  800ab8:	c3                   	ret
+
+00800ab9 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	53                   	push   %ebx
+  800abd:	83 ec 1c             	sub    $0x1c,%esp
+  800ac0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ac3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ac6:	50                   	push   %eax
+  800ac7:	ff 75 08             	push   0x8(%ebp)
+  800aca:	e8 a6 fb ff ff       	call   800675 <fd_lookup>
+  800acf:	83 c4 10             	add    $0x10,%esp
+  800ad2:	85 c0                	test   %eax,%eax
+  800ad4:	78 33                	js     800b09 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  800ad6:	83 fb 03             	cmp    $0x3,%ebx
+  800ad9:	74 28                	je     800b03 <fcntl+0x4a>
+  800adb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ae0:	83 fb 04             	cmp    $0x4,%ebx
+  800ae3:	75 24                	jne    800b09 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  800ae5:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  800ae8:	8b 41 08             	mov    0x8(%ecx),%eax
+  800aeb:	80 e4 ef             	and    $0xef,%ah
+  800aee:	8b 55 10             	mov    0x10(%ebp),%edx
+  800af1:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  800af7:	09 d0                	or     %edx,%eax
+  800af9:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b01:	eb 06                	jmp    800b09 <fcntl+0x50>
+		return fd->fd_omode;
+  800b03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b06:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  800b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0c:	c9                   	leave
+  800b0d:	c3                   	ret
+
+00800b0e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	56                   	push   %esi
+  800b12:	53                   	push   %ebx
+  800b13:	83 ec 18             	sub    $0x18,%esp
+  800b16:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b19:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b1c:	50                   	push   %eax
+  800b1d:	53                   	push   %ebx
+  800b1e:	e8 52 fb ff ff       	call   800675 <fd_lookup>
+  800b23:	83 c4 10             	add    $0x10,%esp
+  800b26:	85 c0                	test   %eax,%eax
+  800b28:	78 34                	js     800b5e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b2a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b2d:	83 ec 08             	sub    $0x8,%esp
+  800b30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b33:	50                   	push   %eax
+  800b34:	ff 36                	push   (%esi)
+  800b36:	e8 8c fb ff ff       	call   8006c7 <dev_lookup>
+  800b3b:	83 c4 10             	add    $0x10,%esp
+  800b3e:	85 c0                	test   %eax,%eax
+  800b40:	78 1c                	js     800b5e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b42:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b46:	74 1d                	je     800b65 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  800b48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4b:	8b 40 18             	mov    0x18(%eax),%eax
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	74 51                	je     800ba3 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  800b52:	83 ec 08             	sub    $0x8,%esp
+  800b55:	ff 75 0c             	push   0xc(%ebp)
+  800b58:	56                   	push   %esi
+  800b59:	ff d0                	call   *%eax
+  800b5b:	83 c4 10             	add    $0x10,%esp
+}
+  800b5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b61:	5b                   	pop    %ebx
+  800b62:	5e                   	pop    %esi
+  800b63:	5d                   	pop    %ebp
+  800b64:	c3                   	ret
+  800b65:	89 e2                	mov    %esp,%edx
+  800b67:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800b6c:	29 d0                	sub    %edx,%eax
+  800b6e:	89 c2                	mov    %eax,%edx
+  800b70:	c1 ea 0f             	shr    $0xf,%edx
+  800b73:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7d:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  800b80:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  800b87:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b8a:	83 ec 04             	sub    $0x4,%esp
+  800b8d:	53                   	push   %ebx
+  800b8e:	50                   	push   %eax
+  800b8f:	68 d8 3a 80 00       	push   $0x803ad8
+  800b94:	e8 18 1f 00 00       	call   802ab1 <cprintf>
+		return -E_INVAL;
+  800b99:	83 c4 10             	add    $0x10,%esp
+  800b9c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba1:	eb bb                	jmp    800b5e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  800ba3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ba8:	eb b4                	jmp    800b5e <ftruncate+0x50>
+
+00800baa <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	56                   	push   %esi
+  800bae:	53                   	push   %ebx
+  800baf:	83 ec 18             	sub    $0x18,%esp
+  800bb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bb5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bb8:	50                   	push   %eax
+  800bb9:	ff 75 08             	push   0x8(%ebp)
+  800bbc:	e8 b4 fa ff ff       	call   800675 <fd_lookup>
+  800bc1:	83 c4 10             	add    $0x10,%esp
+  800bc4:	85 c0                	test   %eax,%eax
+  800bc6:	78 53                	js     800c1b <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bc8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bcb:	83 ec 08             	sub    $0x8,%esp
+  800bce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd1:	50                   	push   %eax
+  800bd2:	ff 36                	push   (%esi)
+  800bd4:	e8 ee fa ff ff       	call   8006c7 <dev_lookup>
+  800bd9:	83 c4 10             	add    $0x10,%esp
+  800bdc:	85 c0                	test   %eax,%eax
+  800bde:	78 3b                	js     800c1b <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  800be0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800be3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800be7:	74 39                	je     800c22 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  800be9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  800bec:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bf3:	00 00 00 
+	stat->st_isdir = 0;
+  800bf6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bfd:	00 00 00 
+	stat->st_version = 0;
+  800c00:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  800c07:	00 00 00 
+	stat->st_dev = dev;
+  800c0a:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  800c10:	83 ec 08             	sub    $0x8,%esp
+  800c13:	53                   	push   %ebx
+  800c14:	56                   	push   %esi
+  800c15:	ff 50 14             	call   *0x14(%eax)
+  800c18:	83 c4 10             	add    $0x10,%esp
+}
+  800c1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c1e:	5b                   	pop    %ebx
+  800c1f:	5e                   	pop    %esi
+  800c20:	5d                   	pop    %ebp
+  800c21:	c3                   	ret
+		return -E_NOT_SUPP;
+  800c22:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c27:	eb f2                	jmp    800c1b <fstat+0x71>
+
+00800c29 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c29:	55                   	push   %ebp
+  800c2a:	89 e5                	mov    %esp,%ebp
+  800c2c:	56                   	push   %esi
+  800c2d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  800c2e:	83 ec 08             	sub    $0x8,%esp
+  800c31:	6a 00                	push   $0x0
+  800c33:	ff 75 08             	push   0x8(%ebp)
+  800c36:	e8 b7 01 00 00       	call   800df2 <open>
+  800c3b:	89 c3                	mov    %eax,%ebx
+  800c3d:	83 c4 10             	add    $0x10,%esp
+  800c40:	85 c0                	test   %eax,%eax
+  800c42:	78 1b                	js     800c5f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  800c44:	83 ec 08             	sub    $0x8,%esp
+  800c47:	ff 75 0c             	push   0xc(%ebp)
+  800c4a:	50                   	push   %eax
+  800c4b:	e8 5a ff ff ff       	call   800baa <fstat>
+  800c50:	89 c6                	mov    %eax,%esi
+	close(fd);
+  800c52:	89 1c 24             	mov    %ebx,(%esp)
+  800c55:	e8 60 fb ff ff       	call   8007ba <close>
+	return r;
+  800c5a:	83 c4 10             	add    $0x10,%esp
+  800c5d:	89 f3                	mov    %esi,%ebx
+}
+  800c5f:	89 d8                	mov    %ebx,%eax
+  800c61:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c64:	5b                   	pop    %ebx
+  800c65:	5e                   	pop    %esi
+  800c66:	5d                   	pop    %ebp
+  800c67:	c3                   	ret
+
+00800c68 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	56                   	push   %esi
+  800c6c:	53                   	push   %ebx
+  800c6d:	89 c6                	mov    %eax,%esi
+  800c6f:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  800c71:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800c78:	74 27                	je     800ca1 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800c7a:	6a 07                	push   $0x7
+  800c7c:	68 00 60 80 00       	push   $0x806000
+  800c81:	56                   	push   %esi
+  800c82:	ff 35 00 50 80 00    	push   0x805000
+  800c88:	e8 23 2b 00 00       	call   8037b0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  800c8d:	83 c4 0c             	add    $0xc,%esp
+  800c90:	6a 00                	push   $0x0
+  800c92:	53                   	push   %ebx
+  800c93:	6a 00                	push   $0x0
+  800c95:	e8 86 28 00 00       	call   803520 <ipc_recv>
+}
+  800c9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ca1:	83 ec 0c             	sub    $0xc,%esp
+  800ca4:	6a 02                	push   $0x2
+  800ca6:	e8 6e 2b 00 00       	call   803819 <ipc_find_env>
+  800cab:	a3 00 50 80 00       	mov    %eax,0x805000
+  800cb0:	83 c4 10             	add    $0x10,%esp
+  800cb3:	eb c5                	jmp    800c7a <fsipc+0x12>
+
+00800cb5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbe:	8b 40 0c             	mov    0xc(%eax),%eax
+  800cc1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  800cc6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cc9:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  800cce:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd8:	e8 8b ff ff ff       	call   800c68 <fsipc>
+}
+  800cdd:	c9                   	leave
+  800cde:	c3                   	ret
+
+00800cdf <devfile_flush>:
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ceb:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  800cf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cfa:	e8 69 ff ff ff       	call   800c68 <fsipc>
+}
+  800cff:	c9                   	leave
+  800d00:	c3                   	ret
+
+00800d01 <devfile_stat>:
+{
+  800d01:	55                   	push   %ebp
+  800d02:	89 e5                	mov    %esp,%ebp
+  800d04:	53                   	push   %ebx
+  800d05:	83 ec 04             	sub    $0x4,%esp
+  800d08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d11:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800d16:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d20:	e8 43 ff ff ff       	call   800c68 <fsipc>
+  800d25:	85 c0                	test   %eax,%eax
+  800d27:	78 37                	js     800d60 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800d29:	83 ec 08             	sub    $0x8,%esp
+  800d2c:	68 00 60 80 00       	push   $0x806000
+  800d31:	53                   	push   %ebx
+  800d32:	e8 71 24 00 00       	call   8031a8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  800d37:	a1 80 60 80 00       	mov    0x806080,%eax
+  800d3c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800d42:	a1 84 60 80 00       	mov    0x806084,%eax
+  800d47:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  800d4d:	a1 88 60 80 00       	mov    0x806088,%eax
+  800d52:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  800d58:	83 c4 10             	add    $0x10,%esp
+  800d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d63:	c9                   	leave
+  800d64:	c3                   	ret
+
+00800d65 <devfile_write>:
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+  800d6b:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  800d6e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  800d73:	39 d0                	cmp    %edx,%eax
+  800d75:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  800d78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7b:	8b 52 0c             	mov    0xc(%edx),%edx
+  800d7e:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = count;
+  800d84:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  800d89:	50                   	push   %eax
+  800d8a:	ff 75 0c             	push   0xc(%ebp)
+  800d8d:	68 08 60 80 00       	push   $0x806008
+  800d92:	e8 c1 25 00 00       	call   803358 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  800d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9c:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da1:	e8 c2 fe ff ff       	call   800c68 <fsipc>
+}
+  800da6:	c9                   	leave
+  800da7:	c3                   	ret
+
+00800da8 <devfile_read>:
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	53                   	push   %ebx
+  800dac:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800daf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  800dba:	8b 45 10             	mov    0x10(%ebp),%eax
+  800dbd:	a3 04 60 80 00       	mov    %eax,0x806004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  800dc2:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800dc7:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dcc:	e8 97 fe ff ff       	call   800c68 <fsipc>
+  800dd1:	89 c3                	mov    %eax,%ebx
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	78 14                	js     800deb <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  800dd7:	83 ec 04             	sub    $0x4,%esp
+  800dda:	50                   	push   %eax
+  800ddb:	68 00 60 80 00       	push   $0x806000
+  800de0:	ff 75 0c             	push   0xc(%ebp)
+  800de3:	e8 70 25 00 00       	call   803358 <memmove>
+	return r;
+  800de8:	83 c4 10             	add    $0x10,%esp
+}
+  800deb:	89 d8                	mov    %ebx,%eax
+  800ded:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800df0:	c9                   	leave
+  800df1:	c3                   	ret
+
+00800df2 <open>:
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	53                   	push   %ebx
+  800df6:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  800df9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800dfc:	50                   	push   %eax
+  800dfd:	e8 23 f8 ff ff       	call   800625 <fd_alloc>
+  800e02:	89 c3                	mov    %eax,%ebx
+  800e04:	83 c4 10             	add    $0x10,%esp
+  800e07:	85 c0                	test   %eax,%eax
+  800e09:	78 2a                	js     800e35 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+  800e0e:	ff 75 08             	push   0x8(%ebp)
+  800e11:	e8 46 23 00 00       	call   80315c <strlen>
+  800e16:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  800e19:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  800e1e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800e23:	7e 17                	jle    800e3c <open+0x4a>
+	fd_close(fd, 1);
+  800e25:	83 ec 08             	sub    $0x8,%esp
+  800e28:	6a 01                	push   $0x1
+  800e2a:	ff 75 f4             	push   -0xc(%ebp)
+  800e2d:	e8 08 f9 ff ff       	call   80073a <fd_close>
+	return r;
+  800e32:	83 c4 10             	add    $0x10,%esp
+}
+  800e35:	89 d8                	mov    %ebx,%eax
+  800e37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e3a:	c9                   	leave
+  800e3b:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  800e3c:	83 ec 08             	sub    $0x8,%esp
+  800e3f:	ff 75 08             	push   0x8(%ebp)
+  800e42:	68 00 60 80 00       	push   $0x806000
+  800e47:	e8 5c 23 00 00       	call   8031a8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e4f:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  800e54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  800e57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5c:	e8 07 fe ff ff       	call   800c68 <fsipc>
+  800e61:	89 c3                	mov    %eax,%ebx
+  800e63:	83 c4 10             	add    $0x10,%esp
+  800e66:	85 c0                	test   %eax,%eax
+  800e68:	78 bb                	js     800e25 <open+0x33>
+	return fd2num(fd); 	
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+  800e6d:	ff 75 f4             	push   -0xc(%ebp)
+  800e70:	e8 89 f7 ff ff       	call   8005fe <fd2num>
+  800e75:	89 c3                	mov    %eax,%ebx
+  800e77:	83 c4 10             	add    $0x10,%esp
+  800e7a:	eb b9                	jmp    800e35 <open+0x43>
+
+00800e7c <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 1c             	sub    $0x1c,%esp
+  800e83:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800e86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e89:	50                   	push   %eax
+  800e8a:	ff 75 08             	push   0x8(%ebp)
+  800e8d:	e8 e3 f7 ff ff       	call   800675 <fd_lookup>
+  800e92:	83 c4 10             	add    $0x10,%esp
+  800e95:	85 c0                	test   %eax,%eax
+  800e97:	78 5a                	js     800ef3 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  800e99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e9c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  800ea2:	39 10                	cmp    %edx,(%eax)
+  800ea4:	75 66                	jne    800f0c <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  800ea6:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  800ead:	74 49                	je     800ef8 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  800eaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800eb2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800eb5:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.map.req_offset = offset;
+  800eba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ebd:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.map.req_npages = maxpages;
+  800ec2:	89 1d 08 60 80 00    	mov    %ebx,0x806008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800ec8:	6a 07                	push   $0x7
+  800eca:	68 00 60 80 00       	push   $0x806000
+  800ecf:	6a 09                	push   $0x9
+  800ed1:	ff 35 00 50 80 00    	push   0x805000
+  800ed7:	e8 d4 28 00 00       	call   8037b0 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  800edc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800ee3:	6a 00                	push   $0x0
+  800ee5:	53                   	push   %ebx
+  800ee6:	ff 75 10             	push   0x10(%ebp)
+  800ee9:	6a 00                	push   $0x0
+  800eeb:	e8 fd 26 00 00       	call   8035ed <ipc_recv_pages>
+  800ef0:	83 c4 20             	add    $0x20,%esp
+}
+  800ef3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ef6:	c9                   	leave
+  800ef7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+  800efb:	6a 02                	push   $0x2
+  800efd:	e8 17 29 00 00       	call   803819 <ipc_find_env>
+  800f02:	a3 00 50 80 00       	mov    %eax,0x805000
+  800f07:	83 c4 10             	add    $0x10,%esp
+  800f0a:	eb a3                	jmp    800eaf <fmap+0x33>
+		return -E_INVAL;
+  800f0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f11:	eb e0                	jmp    800ef3 <fmap+0x77>
+
+00800f13 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	53                   	push   %ebx
+  800f17:	83 ec 10             	sub    $0x10,%esp
+  800f1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  800f1d:	53                   	push   %ebx
+  800f1e:	e8 39 22 00 00       	call   80315c <strlen>
+  800f23:	83 c4 10             	add    $0x10,%esp
+  800f26:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  800f2b:	7f 25                	jg     800f52 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  800f2d:	83 ec 08             	sub    $0x8,%esp
+  800f30:	53                   	push   %ebx
+  800f31:	68 00 60 80 00       	push   $0x806000
+  800f36:	e8 6d 22 00 00       	call   8031a8 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  800f3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f40:	b8 07 00 00 00       	mov    $0x7,%eax
+  800f45:	e8 1e fd ff ff       	call   800c68 <fsipc>
+  800f4a:	83 c4 10             	add    $0x10,%esp
+}
+  800f4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f50:	c9                   	leave
+  800f51:	c3                   	ret
+		return -E_BAD_PATH;
+  800f52:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  800f57:	eb f4                	jmp    800f4d <remove+0x3a>
+
+00800f59 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  800f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f64:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f69:	e8 fa fc ff ff       	call   800c68 <fsipc>
+}
+  800f6e:	c9                   	leave
+  800f6f:	c3                   	ret
+
+00800f70 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  800f76:	68 48 3b 80 00       	push   $0x803b48
+  800f7b:	ff 75 0c             	push   0xc(%ebp)
+  800f7e:	e8 25 22 00 00       	call   8031a8 <strcpy>
+	return 0;
+}
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f88:	c9                   	leave
+  800f89:	c3                   	ret
+
+00800f8a <devsock_close>:
+{
+  800f8a:	55                   	push   %ebp
+  800f8b:	89 e5                	mov    %esp,%ebp
+  800f8d:	53                   	push   %ebx
+  800f8e:	83 ec 10             	sub    $0x10,%esp
+  800f91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  800f94:	53                   	push   %ebx
+  800f95:	e8 be 28 00 00       	call   803858 <pageref>
+  800f9a:	89 c2                	mov    %eax,%edx
+  800f9c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  800f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  800fa4:	83 fa 01             	cmp    $0x1,%edx
+  800fa7:	74 05                	je     800fae <devsock_close+0x24>
+}
+  800fa9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800fac:	c9                   	leave
+  800fad:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  800fb1:	ff 73 0c             	push   0xc(%ebx)
+  800fb4:	e8 b0 05 00 00       	call   801569 <nsipc_close>
+  800fb9:	83 c4 10             	add    $0x10,%esp
+  800fbc:	eb eb                	jmp    800fa9 <devsock_close+0x1f>
+
+00800fbe <devsock_write>:
+{
+  800fbe:	55                   	push   %ebp
+  800fbf:	89 e5                	mov    %esp,%ebp
+  800fc1:	53                   	push   %ebx
+  800fc2:	83 ec 14             	sub    $0x14,%esp
+  800fc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fcb:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  800fce:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  800fd1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  800fd4:	8b 41 08             	mov    0x8(%ecx),%eax
+  800fd7:	c1 f8 09             	sar    $0x9,%eax
+  800fda:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  800fdd:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  800fe3:	77 13                	ja     800ff8 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  800fe5:	50                   	push   %eax
+  800fe6:	52                   	push   %edx
+  800fe7:	53                   	push   %ebx
+  800fe8:	ff 71 0c             	push   0xc(%ecx)
+  800feb:	e8 5c 06 00 00       	call   80164c <nsipc_send>
+  800ff0:	83 c4 10             	add    $0x10,%esp
+}
+  800ff3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ff6:	c9                   	leave
+  800ff7:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  800ff8:	50                   	push   %eax
+  800ff9:	6a 01                	push   $0x1
+  800ffb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800ffe:	50                   	push   %eax
+  800fff:	ff 71 0c             	push   0xc(%ecx)
+  801002:	e8 a6 06 00 00       	call   8016ad <nsipc_sendmsg>
+  801007:	83 c4 10             	add    $0x10,%esp
+  80100a:	eb e7                	jmp    800ff3 <devsock_write+0x35>
+
+0080100c <devsock_read>:
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	53                   	push   %ebx
+  801010:	83 ec 14             	sub    $0x14,%esp
+  801013:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801016:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801019:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80101c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80101f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801022:	8b 41 08             	mov    0x8(%ecx),%eax
+  801025:	c1 f8 09             	sar    $0x9,%eax
+  801028:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80102b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801031:	77 13                	ja     801046 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801033:	50                   	push   %eax
+  801034:	52                   	push   %edx
+  801035:	53                   	push   %ebx
+  801036:	ff 71 0c             	push   0xc(%ecx)
+  801039:	e8 9c 05 00 00       	call   8015da <nsipc_recv>
+  80103e:	83 c4 10             	add    $0x10,%esp
+}
+  801041:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801044:	c9                   	leave
+  801045:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801046:	50                   	push   %eax
+  801047:	6a 01                	push   $0x1
+  801049:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80104c:	50                   	push   %eax
+  80104d:	ff 71 0c             	push   0xc(%ecx)
+  801050:	e8 02 0a 00 00       	call   801a57 <nsipc_recvmsg>
+  801055:	83 c4 10             	add    $0x10,%esp
+  801058:	eb e7                	jmp    801041 <devsock_read+0x35>
+
+0080105a <fd2sockid>:
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801060:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801063:	52                   	push   %edx
+  801064:	50                   	push   %eax
+  801065:	e8 0b f6 ff ff       	call   800675 <fd_lookup>
+  80106a:	83 c4 10             	add    $0x10,%esp
+  80106d:	85 c0                	test   %eax,%eax
+  80106f:	78 10                	js     801081 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801071:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801074:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  80107a:	39 08                	cmp    %ecx,(%eax)
+  80107c:	75 05                	jne    801083 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80107e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801081:	c9                   	leave
+  801082:	c3                   	ret
+		return -E_NOT_SUPP;
+  801083:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801088:	eb f7                	jmp    801081 <fd2sockid+0x27>
+
+0080108a <sock_flags>:
+{
+  80108a:	55                   	push   %ebp
+  80108b:	89 e5                	mov    %esp,%ebp
+  80108d:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801090:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801093:	52                   	push   %edx
+  801094:	50                   	push   %eax
+  801095:	e8 db f5 ff ff       	call   800675 <fd_lookup>
+  80109a:	83 c4 10             	add    $0x10,%esp
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	78 0e                	js     8010af <sock_flags+0x25>
+  8010a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010a4:	8b 40 08             	mov    0x8(%eax),%eax
+  8010a7:	c1 e8 09             	shr    $0x9,%eax
+  8010aa:	83 e0 08             	and    $0x8,%eax
+}
+  8010ad:	c9                   	leave
+  8010ae:	c3                   	ret
+		return 0;
+  8010af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b4:	eb f7                	jmp    8010ad <sock_flags+0x23>
+
+008010b6 <alloc_sockfd>:
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 1c             	sub    $0x1c,%esp
+  8010be:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8010c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8010c3:	50                   	push   %eax
+  8010c4:	e8 5c f5 ff ff       	call   800625 <fd_alloc>
+  8010c9:	89 c3                	mov    %eax,%ebx
+  8010cb:	83 c4 10             	add    $0x10,%esp
+  8010ce:	85 c0                	test   %eax,%eax
+  8010d0:	78 43                	js     801115 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8010d2:	83 ec 04             	sub    $0x4,%esp
+  8010d5:	68 07 04 00 00       	push   $0x407
+  8010da:	ff 75 f4             	push   -0xc(%ebp)
+  8010dd:	6a 00                	push   $0x0
+  8010df:	e8 b7 f0 ff ff       	call   80019b <sys_page_alloc>
+  8010e4:	89 c3                	mov    %eax,%ebx
+  8010e6:	83 c4 10             	add    $0x10,%esp
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	78 28                	js     801115 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8010ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010f0:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8010f6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8010f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010fb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801102:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801105:	83 ec 0c             	sub    $0xc,%esp
+  801108:	50                   	push   %eax
+  801109:	e8 f0 f4 ff ff       	call   8005fe <fd2num>
+  80110e:	89 c3                	mov    %eax,%ebx
+  801110:	83 c4 10             	add    $0x10,%esp
+  801113:	eb 0c                	jmp    801121 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801115:	83 ec 0c             	sub    $0xc,%esp
+  801118:	56                   	push   %esi
+  801119:	e8 4b 04 00 00       	call   801569 <nsipc_close>
+		return r;
+  80111e:	83 c4 10             	add    $0x10,%esp
+}
+  801121:	89 d8                	mov    %ebx,%eax
+  801123:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801126:	5b                   	pop    %ebx
+  801127:	5e                   	pop    %esi
+  801128:	5d                   	pop    %ebp
+  801129:	c3                   	ret
+
+0080112a <accept>:
+{
+  80112a:	55                   	push   %ebp
+  80112b:	89 e5                	mov    %esp,%ebp
+  80112d:	56                   	push   %esi
+  80112e:	53                   	push   %ebx
+  80112f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801132:	89 f0                	mov    %esi,%eax
+  801134:	e8 21 ff ff ff       	call   80105a <fd2sockid>
+  801139:	89 c3                	mov    %eax,%ebx
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	78 24                	js     801163 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80113f:	89 f0                	mov    %esi,%eax
+  801141:	e8 44 ff ff ff       	call   80108a <sock_flags>
+  801146:	50                   	push   %eax
+  801147:	ff 75 10             	push   0x10(%ebp)
+  80114a:	ff 75 0c             	push   0xc(%ebp)
+  80114d:	53                   	push   %ebx
+  80114e:	e8 6b 03 00 00       	call   8014be <nsipc_accept>
+  801153:	89 c3                	mov    %eax,%ebx
+  801155:	83 c4 10             	add    $0x10,%esp
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	78 07                	js     801163 <accept+0x39>
+	return alloc_sockfd(r);
+  80115c:	e8 55 ff ff ff       	call   8010b6 <alloc_sockfd>
+  801161:	89 c3                	mov    %eax,%ebx
+}
+  801163:	89 d8                	mov    %ebx,%eax
+  801165:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801168:	5b                   	pop    %ebx
+  801169:	5e                   	pop    %esi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <bind>:
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801172:	8b 45 08             	mov    0x8(%ebp),%eax
+  801175:	e8 e0 fe ff ff       	call   80105a <fd2sockid>
+  80117a:	85 c0                	test   %eax,%eax
+  80117c:	78 12                	js     801190 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80117e:	83 ec 04             	sub    $0x4,%esp
+  801181:	ff 75 10             	push   0x10(%ebp)
+  801184:	ff 75 0c             	push   0xc(%ebp)
+  801187:	50                   	push   %eax
+  801188:	e8 85 03 00 00       	call   801512 <nsipc_bind>
+  80118d:	83 c4 10             	add    $0x10,%esp
+}
+  801190:	c9                   	leave
+  801191:	c3                   	ret
+
+00801192 <shutdown>:
+{
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801198:	8b 45 08             	mov    0x8(%ebp),%eax
+  80119b:	e8 ba fe ff ff       	call   80105a <fd2sockid>
+  8011a0:	85 c0                	test   %eax,%eax
+  8011a2:	78 0f                	js     8011b3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8011a4:	83 ec 08             	sub    $0x8,%esp
+  8011a7:	ff 75 0c             	push   0xc(%ebp)
+  8011aa:	50                   	push   %eax
+  8011ab:	e8 97 03 00 00       	call   801547 <nsipc_shutdown>
+  8011b0:	83 c4 10             	add    $0x10,%esp
+}
+  8011b3:	c9                   	leave
+  8011b4:	c3                   	ret
+
+008011b5 <connect>:
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011be:	e8 97 fe ff ff       	call   80105a <fd2sockid>
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	78 12                	js     8011d9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8011c7:	83 ec 04             	sub    $0x4,%esp
+  8011ca:	ff 75 10             	push   0x10(%ebp)
+  8011cd:	ff 75 0c             	push   0xc(%ebp)
+  8011d0:	50                   	push   %eax
+  8011d1:	e8 ad 03 00 00       	call   801583 <nsipc_connect>
+  8011d6:	83 c4 10             	add    $0x10,%esp
+}
+  8011d9:	c9                   	leave
+  8011da:	c3                   	ret
+
+008011db <listen>:
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8011e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e4:	e8 71 fe ff ff       	call   80105a <fd2sockid>
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	78 0f                	js     8011fc <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8011ed:	83 ec 08             	sub    $0x8,%esp
+  8011f0:	ff 75 0c             	push   0xc(%ebp)
+  8011f3:	50                   	push   %eax
+  8011f4:	e8 bf 03 00 00       	call   8015b8 <nsipc_listen>
+  8011f9:	83 c4 10             	add    $0x10,%esp
+}
+  8011fc:	c9                   	leave
+  8011fd:	c3                   	ret
+
+008011fe <sendmsg>:
+{
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+  801201:	57                   	push   %edi
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	83 ec 0c             	sub    $0xc,%esp
+  801207:	8b 75 08             	mov    0x8(%ebp),%esi
+  80120a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80120d:	89 f0                	mov    %esi,%eax
+  80120f:	e8 46 fe ff ff       	call   80105a <fd2sockid>
+  801214:	89 c3                	mov    %eax,%ebx
+  801216:	85 c0                	test   %eax,%eax
+  801218:	78 1c                	js     801236 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80121a:	89 f0                	mov    %esi,%eax
+  80121c:	e8 69 fe ff ff       	call   80108a <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801221:	0b 45 10             	or     0x10(%ebp),%eax
+  801224:	50                   	push   %eax
+  801225:	ff 77 0c             	push   0xc(%edi)
+  801228:	ff 77 08             	push   0x8(%edi)
+  80122b:	53                   	push   %ebx
+  80122c:	e8 7c 04 00 00       	call   8016ad <nsipc_sendmsg>
+  801231:	89 c3                	mov    %eax,%ebx
+  801233:	83 c4 10             	add    $0x10,%esp
+}
+  801236:	89 d8                	mov    %ebx,%eax
+  801238:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80123b:	5b                   	pop    %ebx
+  80123c:	5e                   	pop    %esi
+  80123d:	5f                   	pop    %edi
+  80123e:	5d                   	pop    %ebp
+  80123f:	c3                   	ret
+
+00801240 <recvmsg>:
+{
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80124c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80124f:	89 f8                	mov    %edi,%eax
+  801251:	e8 04 fe ff ff       	call   80105a <fd2sockid>
+  801256:	89 c3                	mov    %eax,%ebx
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	78 2a                	js     801286 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80125c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801263:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80126a:	89 f8                	mov    %edi,%eax
+  80126c:	e8 19 fe ff ff       	call   80108a <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801271:	0b 45 10             	or     0x10(%ebp),%eax
+  801274:	50                   	push   %eax
+  801275:	ff 76 0c             	push   0xc(%esi)
+  801278:	ff 76 08             	push   0x8(%esi)
+  80127b:	53                   	push   %ebx
+  80127c:	e8 d6 07 00 00       	call   801a57 <nsipc_recvmsg>
+  801281:	89 c3                	mov    %eax,%ebx
+  801283:	83 c4 10             	add    $0x10,%esp
+}
+  801286:	89 d8                	mov    %ebx,%eax
+  801288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+
+00801290 <sendfile>:
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	56                   	push   %esi
+  801294:	53                   	push   %ebx
+  801295:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801298:	89 f0                	mov    %esi,%eax
+  80129a:	e8 bb fd ff ff       	call   80105a <fd2sockid>
+  80129f:	89 c3                	mov    %eax,%ebx
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	78 1f                	js     8012c4 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8012a5:	89 f0                	mov    %esi,%eax
+  8012a7:	e8 de fd ff ff       	call   80108a <sock_flags>
+  8012ac:	83 ec 0c             	sub    $0xc,%esp
+  8012af:	50                   	push   %eax
+  8012b0:	ff 75 14             	push   0x14(%ebp)
+  8012b3:	ff 75 10             	push   0x10(%ebp)
+  8012b6:	ff 75 0c             	push   0xc(%ebp)
+  8012b9:	53                   	push   %ebx
+  8012ba:	e8 64 06 00 00       	call   801923 <nsipc_sendfile>
+  8012bf:	89 c3                	mov    %eax,%ebx
+  8012c1:	83 c4 20             	add    $0x20,%esp
+}
+  8012c4:	89 d8                	mov    %ebx,%eax
+  8012c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c9:	5b                   	pop    %ebx
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5d                   	pop    %ebp
+  8012cc:	c3                   	ret
+
+008012cd <evctl>:
+{
+  8012cd:	55                   	push   %ebp
+  8012ce:	89 e5                	mov    %esp,%ebp
+  8012d0:	53                   	push   %ebx
+  8012d1:	83 ec 04             	sub    $0x4,%esp
+  8012d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8012d7:	89 d8                	mov    %ebx,%eax
+  8012d9:	e8 7c fd ff ff       	call   80105a <fd2sockid>
+  8012de:	85 c0                	test   %eax,%eax
+  8012e0:	78 10                	js     8012f2 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8012e2:	83 ec 04             	sub    $0x4,%esp
+  8012e5:	53                   	push   %ebx
+  8012e6:	ff 75 0c             	push   0xc(%ebp)
+  8012e9:	50                   	push   %eax
+  8012ea:	e8 d2 0b 00 00       	call   801ec1 <nsipc_evctl>
+  8012ef:	83 c4 10             	add    $0x10,%esp
+}
+  8012f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f5:	c9                   	leave
+  8012f6:	c3                   	ret
+
+008012f7 <evwait>:
+{
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8012fd:	ff 75 10             	push   0x10(%ebp)
+  801300:	ff 75 0c             	push   0xc(%ebp)
+  801303:	ff 75 08             	push   0x8(%ebp)
+  801306:	e8 e0 0b 00 00       	call   801eeb <nsipc_evwait>
+}
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+
+0080130d <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801313:	ff 75 10             	push   0x10(%ebp)
+  801316:	ff 75 0c             	push   0xc(%ebp)
+  801319:	ff 75 08             	push   0x8(%ebp)
+  80131c:	e8 31 0c 00 00       	call   801f52 <nsipc_socket>
+  801321:	83 c4 10             	add    $0x10,%esp
+  801324:	85 c0                	test   %eax,%eax
+  801326:	78 05                	js     80132d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801328:	e8 89 fd ff ff       	call   8010b6 <alloc_sockfd>
+}
+  80132d:	c9                   	leave
+  80132e:	c3                   	ret
+
+0080132f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	53                   	push   %ebx
+  801333:	83 ec 04             	sub    $0x4,%esp
+  801336:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801338:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  80133f:	74 26                	je     801367 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801341:	6a 07                	push   $0x7
+  801343:	68 00 70 80 00       	push   $0x807000
+  801348:	53                   	push   %ebx
+  801349:	ff 35 24 53 80 00    	push   0x805324
+  80134f:	e8 5c 24 00 00       	call   8037b0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801354:	83 c4 0c             	add    $0xc,%esp
+  801357:	6a 00                	push   $0x0
+  801359:	6a 00                	push   $0x0
+  80135b:	6a 00                	push   $0x0
+  80135d:	e8 be 21 00 00       	call   803520 <ipc_recv>
+}
+  801362:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801367:	83 ec 0c             	sub    $0xc,%esp
+  80136a:	6a 03                	push   $0x3
+  80136c:	e8 a8 24 00 00       	call   803819 <ipc_find_env>
+  801371:	a3 24 53 80 00       	mov    %eax,0x805324
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	eb c6                	jmp    801341 <nsipc+0x12>
+
+0080137b <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	56                   	push   %esi
+  80137f:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801380:	8b 35 30 53 80 00    	mov    0x805330,%esi
+		return 0;
+  801386:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80138b:	85 f6                	test   %esi,%esi
+  80138d:	75 33                	jne    8013c2 <nsbulk_map+0x47>
+  80138f:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801394:	83 ec 04             	sub    $0x4,%esp
+  801397:	6a 07                	push   $0x7
+  801399:	53                   	push   %ebx
+  80139a:	6a 00                	push   $0x0
+  80139c:	e8 fa ed ff ff       	call   80019b <sys_page_alloc>
+  8013a1:	83 c4 10             	add    $0x10,%esp
+  8013a4:	85 c0                	test   %eax,%eax
+  8013a6:	78 1a                	js     8013c2 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8013a8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013ae:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8013b4:	75 de                	jne    801394 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8013b6:	c7 05 30 53 80 00 01 	movl   $0x1,0x805330
+  8013bd:	00 00 00 
+	return 0;
+  8013c0:	89 f0                	mov    %esi,%eax
+}
+  8013c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013c5:	5b                   	pop    %ebx
+  8013c6:	5e                   	pop    %esi
+  8013c7:	5d                   	pop    %ebp
+  8013c8:	c3                   	ret
+
+008013c9 <nsbulk_own>:
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	57                   	push   %edi
+  8013cd:	56                   	push   %esi
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8013d4:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8013d7:	85 d2                	test   %edx,%edx
+  8013d9:	7f 0e                	jg     8013e9 <nsbulk_own+0x20>
+	return 0;
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e0:	eb 47                	jmp    801429 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8013e2:	83 c3 01             	add    $0x1,%ebx
+  8013e5:	39 fb                	cmp    %edi,%ebx
+  8013e7:	7d 3b                	jge    801424 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8013e9:	be 01 00 00 00       	mov    $0x1,%esi
+  8013ee:	89 d9                	mov    %ebx,%ecx
+  8013f0:	d3 e6                	shl    %cl,%esi
+  8013f2:	89 f0                	mov    %esi,%eax
+  8013f4:	23 05 2c 53 80 00    	and    0x80532c,%eax
+  8013fa:	74 e6                	je     8013e2 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8013fc:	83 ec 04             	sub    $0x4,%esp
+  8013ff:	6a 07                	push   $0x7
+  801401:	89 d8                	mov    %ebx,%eax
+  801403:	c1 e0 0c             	shl    $0xc,%eax
+  801406:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80140b:	50                   	push   %eax
+  80140c:	6a 00                	push   $0x0
+  80140e:	e8 88 ed ff ff       	call   80019b <sys_page_alloc>
+  801413:	83 c4 10             	add    $0x10,%esp
+  801416:	85 c0                	test   %eax,%eax
+  801418:	78 0f                	js     801429 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80141a:	f7 d6                	not    %esi
+  80141c:	21 35 2c 53 80 00    	and    %esi,0x80532c
+  801422:	eb be                	jmp    8013e2 <nsbulk_own+0x19>
+	return 0;
+  801424:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142c:	5b                   	pop    %ebx
+  80142d:	5e                   	pop    %esi
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+
+00801431 <nsipc_bulk>:
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	56                   	push   %esi
+  801436:	53                   	push   %ebx
+  801437:	83 ec 1c             	sub    $0x1c,%esp
+  80143a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80143d:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80143f:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801445:	c1 fb 0c             	sar    $0xc,%ebx
+  801448:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80144b:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801452:	74 56                	je     8014aa <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801454:	85 ff                	test   %edi,%edi
+  801456:	7e 24                	jle    80147c <nsipc_bulk+0x4b>
+  801458:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80145e:	74 1c                	je     80147c <nsipc_bulk+0x4b>
+  801460:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801466:	c1 e3 0c             	shl    $0xc,%ebx
+  801469:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80146e:	0f b6 10             	movzbl (%eax),%edx
+  801471:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801473:	05 00 10 00 00       	add    $0x1000,%eax
+  801478:	39 d8                	cmp    %ebx,%eax
+  80147a:	75 f2                	jne    80146e <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	56                   	push   %esi
+  801480:	57                   	push   %edi
+  801481:	68 00 00 00 e0       	push   $0xe0000000
+  801486:	ff 75 e4             	push   -0x1c(%ebp)
+  801489:	ff 35 24 53 80 00    	push   0x805324
+  80148f:	e8 50 23 00 00       	call   8037e4 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801494:	83 c4 1c             	add    $0x1c,%esp
+  801497:	6a 00                	push   $0x0
+  801499:	6a 00                	push   $0x0
+  80149b:	6a 00                	push   $0x0
+  80149d:	e8 7e 20 00 00       	call   803520 <ipc_recv>
+}
+  8014a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a5:	5b                   	pop    %ebx
+  8014a6:	5e                   	pop    %esi
+  8014a7:	5f                   	pop    %edi
+  8014a8:	5d                   	pop    %ebp
+  8014a9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8014aa:	83 ec 0c             	sub    $0xc,%esp
+  8014ad:	6a 03                	push   $0x3
+  8014af:	e8 65 23 00 00       	call   803819 <ipc_find_env>
+  8014b4:	a3 24 53 80 00       	mov    %eax,0x805324
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	eb 96                	jmp    801454 <nsipc_bulk+0x23>
+
+008014be <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	53                   	push   %ebx
+  8014c2:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8014c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c8:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.accept.req_flags = flags;
+  8014cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8014d0:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8014d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014da:	e8 50 fe ff ff       	call   80132f <nsipc>
+  8014df:	89 c3                	mov    %eax,%ebx
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	79 07                	jns    8014ec <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8014e5:	89 d8                	mov    %ebx,%eax
+  8014e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ea:	c9                   	leave
+  8014eb:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8014ec:	83 ec 04             	sub    $0x4,%esp
+  8014ef:	ff 35 10 70 80 00    	push   0x807010
+  8014f5:	68 00 70 80 00       	push   $0x807000
+  8014fa:	ff 75 0c             	push   0xc(%ebp)
+  8014fd:	e8 56 1e 00 00       	call   803358 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801502:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801508:	8b 45 10             	mov    0x10(%ebp),%eax
+  80150b:	89 10                	mov    %edx,(%eax)
+  80150d:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801510:	eb d3                	jmp    8014e5 <nsipc_accept+0x27>
+
+00801512 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	53                   	push   %ebx
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80151c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80151f:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801524:	53                   	push   %ebx
+  801525:	ff 75 0c             	push   0xc(%ebp)
+  801528:	68 04 70 80 00       	push   $0x807004
+  80152d:	e8 26 1e 00 00       	call   803358 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801532:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_BIND);
+  801538:	b8 02 00 00 00       	mov    $0x2,%eax
+  80153d:	e8 ed fd ff ff       	call   80132f <nsipc>
+}
+  801542:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801545:	c9                   	leave
+  801546:	c3                   	ret
+
+00801547 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801547:	55                   	push   %ebp
+  801548:	89 e5                	mov    %esp,%ebp
+  80154a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80154d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801550:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.shutdown.req_how = how;
+  801555:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801558:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_SHUTDOWN);
+  80155d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801562:	e8 c8 fd ff ff       	call   80132f <nsipc>
+}
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+
+00801569 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80156f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801572:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_CLOSE);
+  801577:	b8 04 00 00 00       	mov    $0x4,%eax
+  80157c:	e8 ae fd ff ff       	call   80132f <nsipc>
+}
+  801581:	c9                   	leave
+  801582:	c3                   	ret
+
+00801583 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801583:	55                   	push   %ebp
+  801584:	89 e5                	mov    %esp,%ebp
+  801586:	53                   	push   %ebx
+  801587:	83 ec 08             	sub    $0x8,%esp
+  80158a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80158d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801590:	a3 00 70 80 00       	mov    %eax,0x807000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801595:	53                   	push   %ebx
+  801596:	ff 75 0c             	push   0xc(%ebp)
+  801599:	68 04 70 80 00       	push   $0x807004
+  80159e:	e8 b5 1d 00 00       	call   803358 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8015a3:	89 1d 14 70 80 00    	mov    %ebx,0x807014
+	return nsipc(NSREQ_CONNECT);
+  8015a9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015ae:	e8 7c fd ff ff       	call   80132f <nsipc>
+}
+  8015b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015b6:	c9                   	leave
+  8015b7:	c3                   	ret
+
+008015b8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8015be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c1:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.listen.req_backlog = backlog;
+  8015c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c9:	a3 04 70 80 00       	mov    %eax,0x807004
+	return nsipc(NSREQ_LISTEN);
+  8015ce:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015d3:	e8 57 fd ff ff       	call   80132f <nsipc>
+}
+  8015d8:	c9                   	leave
+  8015d9:	c3                   	ret
+
+008015da <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8015da:	55                   	push   %ebp
+  8015db:	89 e5                	mov    %esp,%ebp
+  8015dd:	56                   	push   %esi
+  8015de:	53                   	push   %ebx
+  8015df:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8015e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015e5:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.recv.req_len = len;
+  8015ea:	89 35 04 70 80 00    	mov    %esi,0x807004
+	nsipcbuf.recv.req_flags = flags;
+  8015f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8015f3:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8015f8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015fd:	e8 2d fd ff ff       	call   80132f <nsipc>
+  801602:	89 c3                	mov    %eax,%ebx
+  801604:	85 c0                	test   %eax,%eax
+  801606:	78 22                	js     80162a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801608:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80160d:	39 c6                	cmp    %eax,%esi
+  80160f:	0f 4e c6             	cmovle %esi,%eax
+  801612:	39 c3                	cmp    %eax,%ebx
+  801614:	7f 1d                	jg     801633 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801616:	83 ec 04             	sub    $0x4,%esp
+  801619:	53                   	push   %ebx
+  80161a:	68 00 70 80 00       	push   $0x807000
+  80161f:	ff 75 0c             	push   0xc(%ebp)
+  801622:	e8 31 1d 00 00       	call   803358 <memmove>
+  801627:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80162a:	89 d8                	mov    %ebx,%eax
+  80162c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162f:	5b                   	pop    %ebx
+  801630:	5e                   	pop    %esi
+  801631:	5d                   	pop    %ebp
+  801632:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801633:	68 54 3b 80 00       	push   $0x803b54
+  801638:	68 69 3b 80 00       	push   $0x803b69
+  80163d:	68 b2 00 00 00       	push   $0xb2
+  801642:	68 7e 3b 80 00       	push   $0x803b7e
+  801647:	e8 8a 13 00 00       	call   8029d6 <_panic>
+
+0080164c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80164c:	55                   	push   %ebp
+  80164d:	89 e5                	mov    %esp,%ebp
+  80164f:	53                   	push   %ebx
+  801650:	83 ec 04             	sub    $0x4,%esp
+  801653:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801656:	8b 45 08             	mov    0x8(%ebp),%eax
+  801659:	a3 00 70 80 00       	mov    %eax,0x807000
+	assert(size < 1600);
+  80165e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801664:	7f 2e                	jg     801694 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801666:	83 ec 04             	sub    $0x4,%esp
+  801669:	53                   	push   %ebx
+  80166a:	ff 75 0c             	push   0xc(%ebp)
+  80166d:	68 0c 70 80 00       	push   $0x80700c
+  801672:	e8 e1 1c 00 00       	call   803358 <memmove>
+	nsipcbuf.send.req_size = size;
+  801677:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	nsipcbuf.send.req_flags = flags;
+  80167d:	8b 45 14             	mov    0x14(%ebp),%eax
+  801680:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SEND);
+  801685:	b8 08 00 00 00       	mov    $0x8,%eax
+  80168a:	e8 a0 fc ff ff       	call   80132f <nsipc>
+}
+  80168f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801692:	c9                   	leave
+  801693:	c3                   	ret
+	assert(size < 1600);
+  801694:	68 8a 3b 80 00       	push   $0x803b8a
+  801699:	68 69 3b 80 00       	push   $0x803b69
+  80169e:	68 bd 00 00 00       	push   $0xbd
+  8016a3:	68 7e 3b 80 00       	push   $0x803b7e
+  8016a8:	e8 29 13 00 00       	call   8029d6 <_panic>
+
+008016ad <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	57                   	push   %edi
+  8016b1:	56                   	push   %esi
+  8016b2:	53                   	push   %ebx
+  8016b3:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8016b6:	e8 c0 fc ff ff       	call   80137b <nsbulk_map>
+  8016bb:	85 c0                	test   %eax,%eax
+  8016bd:	78 55                	js     801714 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8016bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8016c6:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8016cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8016d4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8016d7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8016da:	0f 8d 24 02 00 00    	jge    801904 <nsipc_sendmsg+0x257>
+  8016e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8016e6:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8016e9:	89 d8                	mov    %ebx,%eax
+  8016eb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8016f0:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8016f2:	83 ec 0c             	sub    $0xc,%esp
+  8016f5:	68 20 50 80 00       	push   $0x805020
+  8016fa:	e8 5a 0f 00 00       	call   802659 <pgbatch_init>
+  8016ff:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801702:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801704:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801707:	e9 82 00 00 00       	jmp    80178e <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80170c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80170f:	85 db                	test   %ebx,%ebx
+  801711:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801714:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801717:	5b                   	pop    %ebx
+  801718:	5e                   	pop    %esi
+  801719:	5f                   	pop    %edi
+  80171a:	5d                   	pop    %ebp
+  80171b:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80171c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801721:	29 c8                	sub    %ecx,%eax
+  801723:	39 d0                	cmp    %edx,%eax
+  801725:	0f 46 d0             	cmovbe %eax,%edx
+  801728:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80172a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801730:	85 ff                	test   %edi,%edi
+  801732:	0f 49 c7             	cmovns %edi,%eax
+  801735:	c1 f8 0c             	sar    $0xc,%eax
+  801738:	ba 01 00 00 00       	mov    $0x1,%edx
+  80173d:	e8 87 fc ff ff       	call   8013c9 <nsbulk_own>
+  801742:	85 c0                	test   %eax,%eax
+  801744:	0f 88 17 01 00 00    	js     801861 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80174a:	83 ec 04             	sub    $0x4,%esp
+  80174d:	56                   	push   %esi
+  80174e:	ff 75 e0             	push   -0x20(%ebp)
+  801751:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801754:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801759:	50                   	push   %eax
+  80175a:	e8 f9 1b 00 00       	call   803358 <memmove>
+  80175f:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801762:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801765:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801768:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80176b:	0f 84 fd 00 00 00    	je     80186e <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801771:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801774:	01 f7                	add    %esi,%edi
+  801776:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801779:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80177c:	0f 8d 01 01 00 00    	jge    801883 <nsipc_sendmsg+0x1d6>
+  801782:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801788:	0f 8f f0 00 00 00    	jg     80187e <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80178e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801791:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801794:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  801797:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80179a:	89 c2                	mov    %eax,%edx
+  80179c:	03 13                	add    (%ebx),%edx
+  80179e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8017a1:	8b 73 04             	mov    0x4(%ebx),%esi
+  8017a4:	29 c6                	sub    %eax,%esi
+  8017a6:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8017ab:	29 f9                	sub    %edi,%ecx
+  8017ad:	39 ce                	cmp    %ecx,%esi
+  8017af:	89 ca                	mov    %ecx,%edx
+  8017b1:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8017b4:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8017b7:	89 f9                	mov    %edi,%ecx
+  8017b9:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8017bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017c2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8017c7:	09 c8                	or     %ecx,%eax
+  8017c9:	0f 85 4d ff ff ff    	jne    80171c <nsipc_sendmsg+0x6f>
+  8017cf:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8017d5:	0f 86 41 ff ff ff    	jbe    80171c <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017db:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8017e1:	85 ff                	test   %edi,%edi
+  8017e3:	0f 49 c7             	cmovns %edi,%eax
+  8017e6:	c1 f8 0c             	sar    $0xc,%eax
+  8017e9:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8017eb:	89 d1                	mov    %edx,%ecx
+  8017ed:	c1 e9 0c             	shr    $0xc,%ecx
+  8017f0:	01 c8                	add    %ecx,%eax
+  8017f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8017f5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017f8:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8017fa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8017fd:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801802:	29 c8                	sub    %ecx,%eax
+  801804:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801807:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80180a:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80180c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801811:	89 f9                	mov    %edi,%ecx
+  801813:	d3 e0                	shl    %cl,%eax
+  801815:	09 05 2c 53 80 00    	or     %eax,0x80532c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801820:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801823:	50                   	push   %eax
+  801824:	6a 00                	push   $0x0
+  801826:	56                   	push   %esi
+  801827:	6a 00                	push   $0x0
+  801829:	68 20 50 80 00       	push   $0x805020
+  80182e:	e8 e4 0e 00 00       	call   802717 <pgbatch_map>
+  801833:	83 c4 20             	add    $0x20,%esp
+  801836:	85 c0                	test   %eax,%eax
+  801838:	0f 88 ce fe ff ff    	js     80170c <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80183e:	83 c7 01             	add    $0x1,%edi
+  801841:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801847:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80184a:	39 c7                	cmp    %eax,%edi
+  80184c:	75 be                	jne    80180c <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80184e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801851:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801854:	89 d6                	mov    %edx,%esi
+  801856:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80185c:	e9 01 ff ff ff       	jmp    801762 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801861:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801864:	85 db                	test   %ebx,%ebx
+  801866:	0f 45 c3             	cmovne %ebx,%eax
+  801869:	e9 a6 fe ff ff       	jmp    801714 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80186e:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801872:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801879:	e9 f3 fe ff ff       	jmp    801771 <nsipc_sendmsg+0xc4>
+  80187e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801881:	eb 03                	jmp    801886 <nsipc_sendmsg+0x1d9>
+  801883:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  801886:	83 ec 0c             	sub    $0xc,%esp
+  801889:	68 20 50 80 00       	push   $0x805020
+  80188e:	e8 d4 0d 00 00       	call   802667 <pgbatch_flush>
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 50                	js     8018ea <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80189a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80189d:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8018a2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8018a8:	89 fb                	mov    %edi,%ebx
+  8018aa:	29 f3                	sub    %esi,%ebx
+  8018ac:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8018b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8018b5:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8018ba:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8018bf:	89 fa                	mov    %edi,%edx
+  8018c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018c6:	e8 66 fb ff ff       	call   801431 <nsipc_bulk>
+  8018cb:	85 c0                	test   %eax,%eax
+  8018cd:	78 28                	js     8018f7 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8018cf:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8018d2:	39 c3                	cmp    %eax,%ebx
+  8018d4:	75 0c                	jne    8018e2 <nsipc_sendmsg+0x235>
+  8018d6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8018d9:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8018dc:	0f 8f f2 fd ff ff    	jg     8016d4 <nsipc_sendmsg+0x27>
+		sent += r;
+  8018e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8018e5:	e9 2a fe ff ff       	jmp    801714 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018ea:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018ed:	85 db                	test   %ebx,%ebx
+  8018ef:	0f 45 c3             	cmovne %ebx,%eax
+  8018f2:	e9 1d fe ff ff       	jmp    801714 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8018f7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8018fa:	85 db                	test   %ebx,%ebx
+  8018fc:	0f 45 c3             	cmovne %ebx,%eax
+  8018ff:	e9 10 fe ff ff       	jmp    801714 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801904:	83 ec 0c             	sub    $0xc,%esp
+  801907:	68 20 50 80 00       	push   $0x805020
+  80190c:	e8 48 0d 00 00       	call   802659 <pgbatch_init>
+  801911:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801914:	be 00 00 00 00       	mov    $0x0,%esi
+  801919:	bf 00 00 00 00       	mov    $0x0,%edi
+  80191e:	e9 63 ff ff ff       	jmp    801886 <nsipc_sendmsg+0x1d9>
+
+00801923 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801923:	55                   	push   %ebp
+  801924:	89 e5                	mov    %esp,%ebp
+  801926:	57                   	push   %edi
+  801927:	56                   	push   %esi
+  801928:	53                   	push   %ebx
+  801929:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80192c:	83 3d 28 53 80 00 00 	cmpl   $0x0,0x805328
+  801933:	0f 84 c8 00 00 00    	je     801a01 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801939:	83 3d 24 53 80 00 00 	cmpl   $0x0,0x805324
+  801940:	0f 84 e4 00 00 00    	je     801a2a <nsipc_sendfile+0x107>
+{
+  801946:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80194b:	89 fb                	mov    %edi,%ebx
+  80194d:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801950:	0f 83 f0 00 00 00    	jae    801a46 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801956:	89 fa                	mov    %edi,%edx
+  801958:	03 55 10             	add    0x10(%ebp),%edx
+  80195b:	89 d0                	mov    %edx,%eax
+  80195d:	c1 f8 1f             	sar    $0x1f,%eax
+  801960:	c1 e8 14             	shr    $0x14,%eax
+  801963:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801966:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80196c:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80196e:	6a 10                	push   $0x10
+  801970:	68 00 20 01 e0       	push   $0xe0012000
+  801975:	52                   	push   %edx
+  801976:	ff 75 0c             	push   0xc(%ebp)
+  801979:	e8 fe f4 ff ff       	call   800e7c <fmap>
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	85 c0                	test   %eax,%eax
+  801983:	0f 8e b8 00 00 00    	jle    801a41 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  801989:	39 c6                	cmp    %eax,%esi
+  80198b:	0f 8d b5 00 00 00    	jge    801a46 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  801991:	29 f0                	sub    %esi,%eax
+  801993:	8b 55 14             	mov    0x14(%ebp),%edx
+  801996:	29 da                	sub    %ebx,%edx
+  801998:	39 d0                	cmp    %edx,%eax
+  80199a:	89 d3                	mov    %edx,%ebx
+  80199c:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80199f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a2:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8019a7:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8019ad:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8019b3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8019b6:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019bb:	83 ec 0c             	sub    $0xc,%esp
+  8019be:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8019c0:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8019c7:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8019ca:	83 c0 01             	add    $0x1,%eax
+  8019cd:	50                   	push   %eax
+  8019ce:	68 00 10 01 e0       	push   $0xe0011000
+  8019d3:	6a 11                	push   $0x11
+  8019d5:	ff 35 24 53 80 00    	push   0x805324
+  8019db:	e8 04 1e 00 00       	call   8037e4 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8019e0:	83 c4 1c             	add    $0x1c,%esp
+  8019e3:	6a 00                	push   $0x0
+  8019e5:	6a 00                	push   $0x0
+  8019e7:	6a 00                	push   $0x0
+  8019e9:	e8 32 1b 00 00       	call   803520 <ipc_recv>
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	78 5b                	js     801a50 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8019f5:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8019f7:	39 c3                	cmp    %eax,%ebx
+  8019f9:	0f 8e 4c ff ff ff    	jle    80194b <nsipc_sendfile+0x28>
+  8019ff:	eb 45                	jmp    801a46 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  801a01:	83 ec 04             	sub    $0x4,%esp
+  801a04:	6a 07                	push   $0x7
+  801a06:	68 00 10 01 e0       	push   $0xe0011000
+  801a0b:	6a 00                	push   $0x0
+  801a0d:	e8 89 e7 ff ff       	call   80019b <sys_page_alloc>
+  801a12:	89 c7                	mov    %eax,%edi
+  801a14:	83 c4 10             	add    $0x10,%esp
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 2b                	js     801a46 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  801a1b:	c7 05 28 53 80 00 01 	movl   $0x1,0x805328
+  801a22:	00 00 00 
+  801a25:	e9 0f ff ff ff       	jmp    801939 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801a2a:	83 ec 0c             	sub    $0xc,%esp
+  801a2d:	6a 03                	push   $0x3
+  801a2f:	e8 e5 1d 00 00       	call   803819 <ipc_find_env>
+  801a34:	a3 24 53 80 00       	mov    %eax,0x805324
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	e9 05 ff ff ff       	jmp    801946 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801a41:	85 ff                	test   %edi,%edi
+  801a43:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  801a46:	89 f8                	mov    %edi,%eax
+  801a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4b:	5b                   	pop    %ebx
+  801a4c:	5e                   	pop    %esi
+  801a4d:	5f                   	pop    %edi
+  801a4e:	5d                   	pop    %ebp
+  801a4f:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801a50:	85 ff                	test   %edi,%edi
+  801a52:	0f 44 f8             	cmove  %eax,%edi
+  801a55:	eb ef                	jmp    801a46 <nsipc_sendfile+0x123>
+
+00801a57 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801a57:	55                   	push   %ebp
+  801a58:	89 e5                	mov    %esp,%ebp
+  801a5a:	57                   	push   %edi
+  801a5b:	56                   	push   %esi
+  801a5c:	53                   	push   %ebx
+  801a5d:	83 ec 1c             	sub    $0x1c,%esp
+  801a60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  801a63:	e8 13 f9 ff ff       	call   80137b <nsbulk_map>
+  801a68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a6b:	85 c0                	test   %eax,%eax
+  801a6d:	0f 88 ba 00 00 00    	js     801b2d <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801a77:	0f 8e bb 00 00 00    	jle    801b38 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  801a7d:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a82:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  801a87:	bf 00 00 01 00       	mov    $0x10000,%edi
+  801a8c:	89 f8                	mov    %edi,%eax
+  801a8e:	29 f0                	sub    %esi,%eax
+  801a90:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  801a94:	39 c8                	cmp    %ecx,%eax
+  801a96:	0f 47 c1             	cmova  %ecx,%eax
+  801a99:	01 f0                	add    %esi,%eax
+  801a9b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  801a9d:	83 c2 01             	add    $0x1,%edx
+  801aa0:	39 55 10             	cmp    %edx,0x10(%ebp)
+  801aa3:	7e 07                	jle    801aac <nsipc_recvmsg+0x55>
+  801aa5:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  801aaa:	7e e0                	jle    801a8c <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  801aac:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  801ab2:	c1 fa 0c             	sar    $0xc,%edx
+  801ab5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aba:	e8 0a f9 ff ff       	call   8013c9 <nsbulk_own>
+  801abf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 67                	js     801b2d <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  801ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  801ace:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  801ad4:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ad7:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  801adc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801ae1:	89 f2                	mov    %esi,%edx
+  801ae3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ae8:	e8 44 f9 ff ff       	call   801431 <nsipc_bulk>
+  801aed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	78 39                	js     801b2d <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  801af4:	39 f0                	cmp    %esi,%eax
+  801af6:	7f 4a                	jg     801b42 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  801af8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	7e 2c                	jle    801b2d <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  801b01:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801b04:	29 fe                	sub    %edi,%esi
+  801b06:	8b 43 04             	mov    0x4(%ebx),%eax
+  801b09:	39 c6                	cmp    %eax,%esi
+  801b0b:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  801b0e:	83 ec 04             	sub    $0x4,%esp
+  801b11:	56                   	push   %esi
+  801b12:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  801b18:	50                   	push   %eax
+  801b19:	ff 33                	push   (%ebx)
+  801b1b:	e8 38 18 00 00       	call   803358 <memmove>
+		n += m;
+  801b20:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  801b22:	83 c3 08             	add    $0x8,%ebx
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  801b2b:	7f d4                	jg     801b01 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  801b2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b33:	5b                   	pop    %ebx
+  801b34:	5e                   	pop    %esi
+  801b35:	5f                   	pop    %edi
+  801b36:	5d                   	pop    %ebp
+  801b37:	c3                   	ret
+	int r, i, n, len = 0;
+  801b38:	be 00 00 00 00       	mov    $0x0,%esi
+  801b3d:	e9 6a ff ff ff       	jmp    801aac <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  801b42:	68 60 3b 80 00       	push   $0x803b60
+  801b47:	68 69 3b 80 00       	push   $0x803b69
+  801b4c:	68 3b 01 00 00       	push   $0x13b
+  801b51:	68 7e 3b 80 00       	push   $0x803b7e
+  801b56:	e8 7b 0e 00 00       	call   8029d6 <_panic>
+
+00801b5b <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  801b5b:	55                   	push   %ebp
+  801b5c:	89 e5                	mov    %esp,%ebp
+  801b5e:	57                   	push   %edi
+  801b5f:	56                   	push   %esi
+  801b60:	53                   	push   %ebx
+  801b61:	83 ec 0c             	sub    $0xc,%esp
+  801b64:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801b67:	8b 75 10             	mov    0x10(%ebp),%esi
+  801b6a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  801b6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b70:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.select.req_readset = *readset;
+  801b75:	8b 07                	mov    (%edi),%eax
+  801b77:	a3 04 70 80 00       	mov    %eax,0x807004
+  801b7c:	8b 47 04             	mov    0x4(%edi),%eax
+  801b7f:	a3 08 70 80 00       	mov    %eax,0x807008
+  801b84:	8b 47 08             	mov    0x8(%edi),%eax
+  801b87:	a3 0c 70 80 00       	mov    %eax,0x80700c
+  801b8c:	8b 47 0c             	mov    0xc(%edi),%eax
+  801b8f:	a3 10 70 80 00       	mov    %eax,0x807010
+  801b94:	8b 47 10             	mov    0x10(%edi),%eax
+  801b97:	a3 14 70 80 00       	mov    %eax,0x807014
+  801b9c:	8b 47 14             	mov    0x14(%edi),%eax
+  801b9f:	a3 18 70 80 00       	mov    %eax,0x807018
+  801ba4:	8b 47 18             	mov    0x18(%edi),%eax
+  801ba7:	a3 1c 70 80 00       	mov    %eax,0x80701c
+  801bac:	8b 47 1c             	mov    0x1c(%edi),%eax
+  801baf:	a3 20 70 80 00       	mov    %eax,0x807020
+  801bb4:	8b 47 20             	mov    0x20(%edi),%eax
+  801bb7:	a3 24 70 80 00       	mov    %eax,0x807024
+  801bbc:	8b 47 24             	mov    0x24(%edi),%eax
+  801bbf:	a3 28 70 80 00       	mov    %eax,0x807028
+  801bc4:	8b 47 28             	mov    0x28(%edi),%eax
+  801bc7:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  801bcc:	8b 47 2c             	mov    0x2c(%edi),%eax
+  801bcf:	a3 30 70 80 00       	mov    %eax,0x807030
+  801bd4:	8b 47 30             	mov    0x30(%edi),%eax
+  801bd7:	a3 34 70 80 00       	mov    %eax,0x807034
+  801bdc:	8b 47 34             	mov    0x34(%edi),%eax
+  801bdf:	a3 38 70 80 00       	mov    %eax,0x807038
+  801be4:	8b 47 38             	mov    0x38(%edi),%eax
+  801be7:	a3 3c 70 80 00       	mov    %eax,0x80703c
+  801bec:	8b 47 3c             	mov    0x3c(%edi),%eax
+  801bef:	a3 40 70 80 00       	mov    %eax,0x807040
+	nsipcbuf.select.req_writeset = *writeset;
+  801bf4:	8b 06                	mov    (%esi),%eax
+  801bf6:	a3 44 70 80 00       	mov    %eax,0x807044
+  801bfb:	8b 46 04             	mov    0x4(%esi),%eax
+  801bfe:	a3 48 70 80 00       	mov    %eax,0x807048
+  801c03:	8b 46 08             	mov    0x8(%esi),%eax
+  801c06:	a3 4c 70 80 00       	mov    %eax,0x80704c
+  801c0b:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c0e:	a3 50 70 80 00       	mov    %eax,0x807050
+  801c13:	8b 46 10             	mov    0x10(%esi),%eax
+  801c16:	a3 54 70 80 00       	mov    %eax,0x807054
+  801c1b:	8b 46 14             	mov    0x14(%esi),%eax
+  801c1e:	a3 58 70 80 00       	mov    %eax,0x807058
+  801c23:	8b 46 18             	mov    0x18(%esi),%eax
+  801c26:	a3 5c 70 80 00       	mov    %eax,0x80705c
+  801c2b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  801c2e:	a3 60 70 80 00       	mov    %eax,0x807060
+  801c33:	8b 46 20             	mov    0x20(%esi),%eax
+  801c36:	a3 64 70 80 00       	mov    %eax,0x807064
+  801c3b:	8b 46 24             	mov    0x24(%esi),%eax
+  801c3e:	a3 68 70 80 00       	mov    %eax,0x807068
+  801c43:	8b 46 28             	mov    0x28(%esi),%eax
+  801c46:	a3 6c 70 80 00       	mov    %eax,0x80706c
+  801c4b:	8b 46 2c             	mov    0x2c(%esi),%eax
+  801c4e:	a3 70 70 80 00       	mov    %eax,0x807070
+  801c53:	8b 46 30             	mov    0x30(%esi),%eax
+  801c56:	a3 74 70 80 00       	mov    %eax,0x807074
+  801c5b:	8b 46 34             	mov    0x34(%esi),%eax
+  801c5e:	a3 78 70 80 00       	mov    %eax,0x807078
+  801c63:	8b 46 38             	mov    0x38(%esi),%eax
+  801c66:	a3 7c 70 80 00       	mov    %eax,0x80707c
+  801c6b:	8b 46 3c             	mov    0x3c(%esi),%eax
+  801c6e:	a3 80 70 80 00       	mov    %eax,0x807080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  801c73:	8b 03                	mov    (%ebx),%eax
+  801c75:	a3 84 70 80 00       	mov    %eax,0x807084
+  801c7a:	8b 43 04             	mov    0x4(%ebx),%eax
+  801c7d:	a3 88 70 80 00       	mov    %eax,0x807088
+  801c82:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c85:	a3 8c 70 80 00       	mov    %eax,0x80708c
+  801c8a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c8d:	a3 90 70 80 00       	mov    %eax,0x807090
+  801c92:	8b 43 10             	mov    0x10(%ebx),%eax
+  801c95:	a3 94 70 80 00       	mov    %eax,0x807094
+  801c9a:	8b 43 14             	mov    0x14(%ebx),%eax
+  801c9d:	a3 98 70 80 00       	mov    %eax,0x807098
+  801ca2:	8b 43 18             	mov    0x18(%ebx),%eax
+  801ca5:	a3 9c 70 80 00       	mov    %eax,0x80709c
+  801caa:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801cad:	a3 a0 70 80 00       	mov    %eax,0x8070a0
+  801cb2:	8b 43 20             	mov    0x20(%ebx),%eax
+  801cb5:	a3 a4 70 80 00       	mov    %eax,0x8070a4
+  801cba:	8b 43 24             	mov    0x24(%ebx),%eax
+  801cbd:	a3 a8 70 80 00       	mov    %eax,0x8070a8
+  801cc2:	8b 43 28             	mov    0x28(%ebx),%eax
+  801cc5:	a3 ac 70 80 00       	mov    %eax,0x8070ac
+  801cca:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  801ccd:	a3 b0 70 80 00       	mov    %eax,0x8070b0
+  801cd2:	8b 43 30             	mov    0x30(%ebx),%eax
+  801cd5:	a3 b4 70 80 00       	mov    %eax,0x8070b4
+  801cda:	8b 43 34             	mov    0x34(%ebx),%eax
+  801cdd:	a3 b8 70 80 00       	mov    %eax,0x8070b8
+  801ce2:	8b 43 38             	mov    0x38(%ebx),%eax
+  801ce5:	a3 bc 70 80 00       	mov    %eax,0x8070bc
+  801cea:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  801ced:	a3 c0 70 80 00       	mov    %eax,0x8070c0
+	nsipcbuf.select.req_timeout = msec;
+  801cf2:	8b 45 18             	mov    0x18(%ebp),%eax
+  801cf5:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  801cfa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cff:	e8 2b f6 ff ff       	call   80132f <nsipc>
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	0f 88 ad 01 00 00    	js     801eb9 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  801d0c:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801d12:	89 17                	mov    %edx,(%edi)
+  801d14:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801d1a:	89 57 04             	mov    %edx,0x4(%edi)
+  801d1d:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801d23:	89 57 08             	mov    %edx,0x8(%edi)
+  801d26:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801d2c:	89 57 0c             	mov    %edx,0xc(%edi)
+  801d2f:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801d35:	89 57 10             	mov    %edx,0x10(%edi)
+  801d38:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801d3e:	89 57 14             	mov    %edx,0x14(%edi)
+  801d41:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801d47:	89 57 18             	mov    %edx,0x18(%edi)
+  801d4a:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801d50:	89 57 1c             	mov    %edx,0x1c(%edi)
+  801d53:	8b 15 24 70 80 00    	mov    0x807024,%edx
+  801d59:	89 57 20             	mov    %edx,0x20(%edi)
+  801d5c:	8b 15 28 70 80 00    	mov    0x807028,%edx
+  801d62:	89 57 24             	mov    %edx,0x24(%edi)
+  801d65:	8b 15 2c 70 80 00    	mov    0x80702c,%edx
+  801d6b:	89 57 28             	mov    %edx,0x28(%edi)
+  801d6e:	8b 15 30 70 80 00    	mov    0x807030,%edx
+  801d74:	89 57 2c             	mov    %edx,0x2c(%edi)
+  801d77:	8b 15 34 70 80 00    	mov    0x807034,%edx
+  801d7d:	89 57 30             	mov    %edx,0x30(%edi)
+  801d80:	8b 15 38 70 80 00    	mov    0x807038,%edx
+  801d86:	89 57 34             	mov    %edx,0x34(%edi)
+  801d89:	8b 15 3c 70 80 00    	mov    0x80703c,%edx
+  801d8f:	89 57 38             	mov    %edx,0x38(%edi)
+  801d92:	8b 15 40 70 80 00    	mov    0x807040,%edx
+  801d98:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  801d9b:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  801da1:	89 16                	mov    %edx,(%esi)
+  801da3:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  801da9:	89 56 04             	mov    %edx,0x4(%esi)
+  801dac:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  801db2:	89 56 08             	mov    %edx,0x8(%esi)
+  801db5:	8b 15 50 70 80 00    	mov    0x807050,%edx
+  801dbb:	89 56 0c             	mov    %edx,0xc(%esi)
+  801dbe:	8b 15 54 70 80 00    	mov    0x807054,%edx
+  801dc4:	89 56 10             	mov    %edx,0x10(%esi)
+  801dc7:	8b 15 58 70 80 00    	mov    0x807058,%edx
+  801dcd:	89 56 14             	mov    %edx,0x14(%esi)
+  801dd0:	8b 15 5c 70 80 00    	mov    0x80705c,%edx
+  801dd6:	89 56 18             	mov    %edx,0x18(%esi)
+  801dd9:	8b 15 60 70 80 00    	mov    0x807060,%edx
+  801ddf:	89 56 1c             	mov    %edx,0x1c(%esi)
+  801de2:	8b 15 64 70 80 00    	mov    0x807064,%edx
+  801de8:	89 56 20             	mov    %edx,0x20(%esi)
+  801deb:	8b 15 68 70 80 00    	mov    0x807068,%edx
+  801df1:	89 56 24             	mov    %edx,0x24(%esi)
+  801df4:	8b 15 6c 70 80 00    	mov    0x80706c,%edx
+  801dfa:	89 56 28             	mov    %edx,0x28(%esi)
+  801dfd:	8b 15 70 70 80 00    	mov    0x807070,%edx
+  801e03:	89 56 2c             	mov    %edx,0x2c(%esi)
+  801e06:	8b 15 74 70 80 00    	mov    0x807074,%edx
+  801e0c:	89 56 30             	mov    %edx,0x30(%esi)
+  801e0f:	8b 15 78 70 80 00    	mov    0x807078,%edx
+  801e15:	89 56 34             	mov    %edx,0x34(%esi)
+  801e18:	8b 15 7c 70 80 00    	mov    0x80707c,%edx
+  801e1e:	89 56 38             	mov    %edx,0x38(%esi)
+  801e21:	8b 15 80 70 80 00    	mov    0x807080,%edx
+  801e27:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  801e2a:	8b 15 84 70 80 00    	mov    0x807084,%edx
+  801e30:	89 13                	mov    %edx,(%ebx)
+  801e32:	8b 15 88 70 80 00    	mov    0x807088,%edx
+  801e38:	89 53 04             	mov    %edx,0x4(%ebx)
+  801e3b:	8b 15 8c 70 80 00    	mov    0x80708c,%edx
+  801e41:	89 53 08             	mov    %edx,0x8(%ebx)
+  801e44:	8b 15 90 70 80 00    	mov    0x807090,%edx
+  801e4a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801e4d:	8b 15 94 70 80 00    	mov    0x807094,%edx
+  801e53:	89 53 10             	mov    %edx,0x10(%ebx)
+  801e56:	8b 15 98 70 80 00    	mov    0x807098,%edx
+  801e5c:	89 53 14             	mov    %edx,0x14(%ebx)
+  801e5f:	8b 15 9c 70 80 00    	mov    0x80709c,%edx
+  801e65:	89 53 18             	mov    %edx,0x18(%ebx)
+  801e68:	8b 15 a0 70 80 00    	mov    0x8070a0,%edx
+  801e6e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801e71:	8b 15 a4 70 80 00    	mov    0x8070a4,%edx
+  801e77:	89 53 20             	mov    %edx,0x20(%ebx)
+  801e7a:	8b 15 a8 70 80 00    	mov    0x8070a8,%edx
+  801e80:	89 53 24             	mov    %edx,0x24(%ebx)
+  801e83:	8b 15 ac 70 80 00    	mov    0x8070ac,%edx
+  801e89:	89 53 28             	mov    %edx,0x28(%ebx)
+  801e8c:	8b 15 b0 70 80 00    	mov    0x8070b0,%edx
+  801e92:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  801e95:	8b 15 b4 70 80 00    	mov    0x8070b4,%edx
+  801e9b:	89 53 30             	mov    %edx,0x30(%ebx)
+  801e9e:	8b 15 b8 70 80 00    	mov    0x8070b8,%edx
+  801ea4:	89 53 34             	mov    %edx,0x34(%ebx)
+  801ea7:	8b 15 bc 70 80 00    	mov    0x8070bc,%edx
+  801ead:	89 53 38             	mov    %edx,0x38(%ebx)
+  801eb0:	8b 15 c0 70 80 00    	mov    0x8070c0,%edx
+  801eb6:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  801eb9:	83 c4 0c             	add    $0xc,%esp
+  801ebc:	5b                   	pop    %ebx
+  801ebd:	5e                   	pop    %esi
+  801ebe:	5f                   	pop    %edi
+  801ebf:	5d                   	pop    %ebp
+  801ec0:	c3                   	ret
+
+00801ec1 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  801ec1:	55                   	push   %ebp
+  801ec2:	89 e5                	mov    %esp,%ebp
+  801ec4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  801ec7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eca:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.evctl.req_events = events;
+  801ecf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed2:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.evctl.req_data = data;
+  801ed7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801eda:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_EVCTL);
+  801edf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801ee4:	e8 46 f4 ff ff       	call   80132f <nsipc>
+}
+  801ee9:	c9                   	leave
+  801eea:	c3                   	ret
+
+00801eeb <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	56                   	push   %esi
+  801eef:	53                   	push   %ebx
+  801ef0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  801ef3:	89 35 00 70 80 00    	mov    %esi,0x807000
+	nsipcbuf.evwait.req_timeout = timeout;
+  801ef9:	8b 45 10             	mov    0x10(%ebp),%eax
+  801efc:	a3 04 70 80 00       	mov    %eax,0x807004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  801f01:	b8 10 00 00 00       	mov    $0x10,%eax
+  801f06:	e8 24 f4 ff ff       	call   80132f <nsipc>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	7e 1f                	jle    801f30 <nsipc_evwait+0x45>
+		assert(r <= max);
+  801f11:	39 c6                	cmp    %eax,%esi
+  801f13:	7c 24                	jl     801f39 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  801f15:	83 ec 04             	sub    $0x4,%esp
+  801f18:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  801f1f:	50                   	push   %eax
+  801f20:	68 00 70 80 00       	push   $0x807000
+  801f25:	ff 75 08             	push   0x8(%ebp)
+  801f28:	e8 2b 14 00 00       	call   803358 <memmove>
+  801f2d:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  801f30:	89 d8                	mov    %ebx,%eax
+  801f32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f35:	5b                   	pop    %ebx
+  801f36:	5e                   	pop    %esi
+  801f37:	5d                   	pop    %ebp
+  801f38:	c3                   	ret
+		assert(r <= max);
+  801f39:	68 96 3b 80 00       	push   $0x803b96
+  801f3e:	68 69 3b 80 00       	push   $0x803b69
+  801f43:	68 6a 01 00 00       	push   $0x16a
+  801f48:	68 7e 3b 80 00       	push   $0x803b7e
+  801f4d:	e8 84 0a 00 00       	call   8029d6 <_panic>
+
+00801f52 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  801f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5b:	a3 00 70 80 00       	mov    %eax,0x807000
+	nsipcbuf.socket.req_type = type;
+  801f60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f63:	a3 04 70 80 00       	mov    %eax,0x807004
+	nsipcbuf.socket.req_protocol = protocol;
+  801f68:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f6b:	a3 08 70 80 00       	mov    %eax,0x807008
+	return nsipc(NSREQ_SOCKET);
+  801f70:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f75:	e8 b5 f3 ff ff       	call   80132f <nsipc>
+}
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+
+00801f7c <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  801f7c:	55                   	push   %ebp
+  801f7d:	89 e5                	mov    %esp,%ebp
+  801f7f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  801f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f85:	a3 00 70 80 00       	mov    %eax,0x807000
+	return nsipc(NSREQ_OFFLOAD);
+  801f8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f8f:	e8 9b f3 ff ff       	call   80132f <nsipc>
+}
+  801f94:	c9                   	leave
+  801f95:	c3                   	ret
+
+00801f96 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  801f96:	55                   	push   %ebp
+  801f97:	89 e5                	mov    %esp,%ebp
+  801f99:	53                   	push   %ebx
+  801f9a:	83 ec 04             	sub    $0x4,%esp
+  801f9d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  801fa0:	b8 12 00 00 00       	mov    $0x12,%eax
+  801fa5:	e8 85 f3 ff ff       	call   80132f <nsipc>
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	78 50                	js     801ffe <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  801fae:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  801fb4:	89 13                	mov    %edx,(%ebx)
+  801fb6:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  801fbc:	89 53 04             	mov    %edx,0x4(%ebx)
+  801fbf:	8b 15 08 70 80 00    	mov    0x807008,%edx
+  801fc5:	89 53 08             	mov    %edx,0x8(%ebx)
+  801fc8:	8b 15 0c 70 80 00    	mov    0x80700c,%edx
+  801fce:	89 53 0c             	mov    %edx,0xc(%ebx)
+  801fd1:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  801fd7:	89 53 10             	mov    %edx,0x10(%ebx)
+  801fda:	8b 15 14 70 80 00    	mov    0x807014,%edx
+  801fe0:	89 53 14             	mov    %edx,0x14(%ebx)
+  801fe3:	8b 15 18 70 80 00    	mov    0x807018,%edx
+  801fe9:	89 53 18             	mov    %edx,0x18(%ebx)
+  801fec:	8b 15 1c 70 80 00    	mov    0x80701c,%edx
+  801ff2:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  801ff5:	8b 15 20 70 80 00    	mov    0x807020,%edx
+  801ffb:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  801ffe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+
+00802003 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802009:	6a 03                	push   $0x3
+  80200b:	e8 09 18 00 00       	call   803819 <ipc_find_env>
+  802010:	a3 24 53 80 00       	mov    %eax,0x805324
+	nsipcbuf.shard.req_shard = shard;
+  802015:	8b 45 08             	mov    0x8(%ebp),%eax
+  802018:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80201d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802022:	e8 08 f3 ff ff       	call   80132f <nsipc>
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	78 0a                	js     802038 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80202e:	a3 24 53 80 00       	mov    %eax,0x805324
+	return 0;
+  802033:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802038:	c9                   	leave
+  802039:	c3                   	ret
+
+0080203a <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80203a:	55                   	push   %ebp
+  80203b:	89 e5                	mov    %esp,%ebp
+  80203d:	57                   	push   %edi
+  80203e:	56                   	push   %esi
+  80203f:	53                   	push   %ebx
+  802040:	83 ec 1c             	sub    $0x1c,%esp
+  802043:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802046:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802049:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80204e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802053:	89 e0                	mov    %esp,%eax
+  802055:	89 f2                	mov    %esi,%edx
+  802057:	29 c2                	sub    %eax,%edx
+  802059:	89 d0                	mov    %edx,%eax
+  80205b:	c1 e8 0f             	shr    $0xf,%eax
+  80205e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802064:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802067:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  80206e:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802071:	83 ec 0c             	sub    $0xc,%esp
+  802074:	ff 75 e0             	push   -0x20(%ebp)
+  802077:	e8 dc 17 00 00       	call   803858 <pageref>
+  80207c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80207f:	83 c4 04             	add    $0x4,%esp
+  802082:	ff 75 dc             	push   -0x24(%ebp)
+  802085:	e8 ce 17 00 00       	call   803858 <pageref>
+  80208a:	89 e2                	mov    %esp,%edx
+  80208c:	89 f1                	mov    %esi,%ecx
+  80208e:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802090:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802093:	89 ca                	mov    %ecx,%edx
+  802095:	c1 ea 0f             	shr    $0xf,%edx
+  802098:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80209e:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8020a1:	8b 14 95 40 53 80 00 	mov    0x805340(,%edx,4),%edx
+  8020a8:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8020ab:	39 d7                	cmp    %edx,%edi
+  8020ad:	74 40                	je     8020ef <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8020af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020b2:	75 9f                	jne    802053 <_pipeisclosed+0x19>
+  8020b4:	89 e2                	mov    %esp,%edx
+  8020b6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8020bb:	29 d0                	sub    %edx,%eax
+  8020bd:	89 c2                	mov    %eax,%edx
+  8020bf:	c1 ea 0f             	shr    $0xf,%edx
+  8020c2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8020c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020cc:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8020cf:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8020d6:	8b 40 58             	mov    0x58(%eax),%eax
+  8020d9:	6a 01                	push   $0x1
+  8020db:	50                   	push   %eax
+  8020dc:	57                   	push   %edi
+  8020dd:	68 9f 3b 80 00       	push   $0x803b9f
+  8020e2:	e8 ca 09 00 00       	call   802ab1 <cprintf>
+  8020e7:	83 c4 10             	add    $0x10,%esp
+  8020ea:	e9 5f ff ff ff       	jmp    80204e <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8020ef:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8020f2:	0f 94 c0             	sete   %al
+  8020f5:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8020f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020fb:	5b                   	pop    %ebx
+  8020fc:	5e                   	pop    %esi
+  8020fd:	5f                   	pop    %edi
+  8020fe:	5d                   	pop    %ebp
+  8020ff:	c3                   	ret
+
+00802100 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	53                   	push   %ebx
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80210a:	53                   	push   %ebx
+  80210b:	6a 00                	push   $0x0
+  80210d:	e8 0e e1 ff ff       	call   800220 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802112:	89 1c 24             	mov    %ebx,(%esp)
+  802115:	e8 f4 e4 ff ff       	call   80060e <fd2data>
+  80211a:	83 c4 08             	add    $0x8,%esp
+  80211d:	50                   	push   %eax
+  80211e:	6a 00                	push   $0x0
+  802120:	e8 fb e0 ff ff       	call   800220 <sys_page_unmap>
+}
+  802125:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802128:	c9                   	leave
+  802129:	c3                   	ret
+
+0080212a <devpipe_read>:
+{
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	57                   	push   %edi
+  80212e:	56                   	push   %esi
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802133:	ff 75 08             	push   0x8(%ebp)
+  802136:	e8 d3 e4 ff ff       	call   80060e <fd2data>
+  80213b:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80213d:	8b 70 04             	mov    0x4(%eax),%esi
+  802140:	8b 00                	mov    (%eax),%eax
+  802142:	83 c4 10             	add    $0x10,%esp
+  802145:	39 f0                	cmp    %esi,%eax
+  802147:	75 36                	jne    80217f <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802149:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80214c:	89 da                	mov    %ebx,%edx
+  80214e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802151:	e8 e4 fe ff ff       	call   80203a <_pipeisclosed>
+  802156:	85 c0                	test   %eax,%eax
+  802158:	0f 85 d4 00 00 00    	jne    802232 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80215e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802163:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802167:	83 ec 04             	sub    $0x4,%esp
+  80216a:	6a ff                	push   $0xffffffff
+  80216c:	56                   	push   %esi
+  80216d:	57                   	push   %edi
+  80216e:	e8 26 e4 ff ff       	call   800599 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802173:	8b 73 04             	mov    0x4(%ebx),%esi
+  802176:	8b 03                	mov    (%ebx),%eax
+  802178:	83 c4 10             	add    $0x10,%esp
+  80217b:	39 c6                	cmp    %eax,%esi
+  80217d:	74 cd                	je     80214c <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80217f:	8b 73 04             	mov    0x4(%ebx),%esi
+  802182:	8b 03                	mov    (%ebx),%eax
+  802184:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80218a:	29 c6                	sub    %eax,%esi
+  80218c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802191:	f7 e6                	mul    %esi
+  802193:	c1 ea 0c             	shr    $0xc,%edx
+  802196:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80219c:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80219e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8021a1:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8021a5:	8b 0b                	mov    (%ebx),%ecx
+  8021a7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021ac:	f7 e1                	mul    %ecx
+  8021ae:	c1 ea 0b             	shr    $0xb,%edx
+  8021b1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8021b7:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8021b9:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8021be:	29 cf                	sub    %ecx,%edi
+  8021c0:	39 f7                	cmp    %esi,%edi
+  8021c2:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8021c5:	83 ec 04             	sub    $0x4,%esp
+  8021c8:	57                   	push   %edi
+  8021c9:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8021cd:	50                   	push   %eax
+  8021ce:	ff 75 0c             	push   0xc(%ebp)
+  8021d1:	e8 82 11 00 00       	call   803358 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8021d6:	83 c4 0c             	add    $0xc,%esp
+  8021d9:	89 f0                	mov    %esi,%eax
+  8021db:	29 f8                	sub    %edi,%eax
+  8021dd:	50                   	push   %eax
+  8021de:	8d 43 10             	lea    0x10(%ebx),%eax
+  8021e1:	50                   	push   %eax
+  8021e2:	89 f8                	mov    %edi,%eax
+  8021e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8021e7:	50                   	push   %eax
+  8021e8:	e8 6b 11 00 00       	call   803358 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8021ed:	8b 0b                	mov    (%ebx),%ecx
+  8021ef:	01 f1                	add    %esi,%ecx
+  8021f1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021f6:	f7 e1                	mul    %ecx
+  8021f8:	c1 ea 0c             	shr    $0xc,%edx
+  8021fb:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802201:	29 c1                	sub    %eax,%ecx
+  802203:	89 0b                	mov    %ecx,(%ebx)
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220a:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80220e:	83 c4 10             	add    $0x10,%esp
+  802211:	85 c0                	test   %eax,%eax
+  802213:	75 0a                	jne    80221f <devpipe_read+0xf5>
+	return n;
+  802215:	89 f0                	mov    %esi,%eax
+}
+  802217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80221a:	5b                   	pop    %ebx
+  80221b:	5e                   	pop    %esi
+  80221c:	5f                   	pop    %edi
+  80221d:	5d                   	pop    %ebp
+  80221e:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	68 00 04 00 00       	push   $0x400
+  802227:	53                   	push   %ebx
+  802228:	e8 8e e3 ff ff       	call   8005bb <sys_futex_wake>
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	eb e3                	jmp    802215 <devpipe_read+0xeb>
+			return 0;
+  802232:	b8 00 00 00 00       	mov    $0x0,%eax
+  802237:	eb de                	jmp    802217 <devpipe_read+0xed>
+
+00802239 <devpipe_write>:
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	57                   	push   %edi
+  80223d:	56                   	push   %esi
+  80223e:	53                   	push   %ebx
+  80223f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802242:	ff 75 08             	push   0x8(%ebp)
+  802245:	e8 c4 e3 ff ff       	call   80060e <fd2data>
+  80224a:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802256:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80225b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80225f:	0f 84 43 01 00 00    	je     8023a8 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802265:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802268:	8b 06                	mov    (%esi),%eax
+  80226a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802270:	29 c1                	sub    %eax,%ecx
+  802272:	89 c8                	mov    %ecx,%eax
+  802274:	f7 e7                	mul    %edi
+  802276:	c1 ea 0c             	shr    $0xc,%edx
+  802279:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80227f:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802281:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802287:	75 52                	jne    8022db <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802289:	89 f2                	mov    %esi,%edx
+  80228b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228e:	e8 a7 fd ff ff       	call   80203a <_pipeisclosed>
+  802293:	85 c0                	test   %eax,%eax
+  802295:	0f 85 28 01 00 00    	jne    8023c3 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80229b:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80229d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022a0:	8b 06                	mov    (%esi),%eax
+  8022a2:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022a8:	29 c1                	sub    %eax,%ecx
+  8022aa:	89 c8                	mov    %ecx,%eax
+  8022ac:	f7 e7                	mul    %edi
+  8022ae:	c1 ea 0c             	shr    $0xc,%edx
+  8022b1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022b7:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8022b9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8022bf:	75 a4                	jne    802265 <devpipe_write+0x2c>
+  8022c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c6:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8022ca:	83 ec 04             	sub    $0x4,%esp
+  8022cd:	6a ff                	push   $0xffffffff
+  8022cf:	53                   	push   %ebx
+  8022d0:	56                   	push   %esi
+  8022d1:	e8 c3 e2 ff ff       	call   800599 <sys_futex_wait>
+}
+  8022d6:	83 c4 10             	add    $0x10,%esp
+  8022d9:	eb 8a                	jmp    802265 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8022db:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8022de:	8b 06                	mov    (%esi),%eax
+  8022e0:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8022e6:	29 c1                	sub    %eax,%ecx
+  8022e8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022ed:	f7 e1                	mul    %ecx
+  8022ef:	c1 ea 0c             	shr    $0xc,%edx
+  8022f2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022f8:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8022fa:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8022ff:	89 d8                	mov    %ebx,%eax
+  802301:	29 c8                	sub    %ecx,%eax
+  802303:	8b 55 10             	mov    0x10(%ebp),%edx
+  802306:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802309:	29 ca                	sub    %ecx,%edx
+  80230b:	39 d0                	cmp    %edx,%eax
+  80230d:	0f 46 d0             	cmovbe %eax,%edx
+  802310:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802313:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802316:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80231b:	f7 e1                	mul    %ecx
+  80231d:	c1 ea 0b             	shr    $0xb,%edx
+  802320:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802326:	89 ca                	mov    %ecx,%edx
+  802328:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80232a:	29 d3                	sub    %edx,%ebx
+  80232c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80232f:	39 c3                	cmp    %eax,%ebx
+  802331:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802334:	83 ec 04             	sub    $0x4,%esp
+  802337:	53                   	push   %ebx
+  802338:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80233b:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80233e:	51                   	push   %ecx
+  80233f:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802343:	50                   	push   %eax
+  802344:	e8 0f 10 00 00       	call   803358 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802349:	83 c4 0c             	add    $0xc,%esp
+  80234c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80234f:	29 d8                	sub    %ebx,%eax
+  802351:	50                   	push   %eax
+  802352:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802355:	01 cb                	add    %ecx,%ebx
+  802357:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80235a:	53                   	push   %ebx
+  80235b:	8d 46 10             	lea    0x10(%esi),%eax
+  80235e:	50                   	push   %eax
+  80235f:	e8 f4 0f 00 00       	call   803358 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802364:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802367:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80236a:	01 c1                	add    %eax,%ecx
+  80236c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802371:	f7 e1                	mul    %ecx
+  802373:	c1 ea 0c             	shr    $0xc,%edx
+  802376:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80237c:	89 ca                	mov    %ecx,%edx
+  80237e:	29 c2                	sub    %eax,%edx
+  802380:	89 56 04             	mov    %edx,0x4(%esi)
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+  802388:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80238c:	83 c4 10             	add    $0x10,%esp
+  80238f:	85 c0                	test   %eax,%eax
+  802391:	75 1a                	jne    8023ad <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802393:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802396:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802399:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80239f:	0f 82 c0 fe ff ff    	jb     802265 <devpipe_write+0x2c>
+  8023a5:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8023a8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023ab:	eb 1b                	jmp    8023c8 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8023ad:	83 ec 08             	sub    $0x8,%esp
+  8023b0:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8023b5:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8023b8:	50                   	push   %eax
+  8023b9:	e8 fd e1 ff ff       	call   8005bb <sys_futex_wake>
+  8023be:	83 c4 10             	add    $0x10,%esp
+  8023c1:	eb d0                	jmp    802393 <devpipe_write+0x15a>
+				return 0;
+  8023c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023cb:	5b                   	pop    %ebx
+  8023cc:	5e                   	pop    %esi
+  8023cd:	5f                   	pop    %edi
+  8023ce:	5d                   	pop    %ebp
+  8023cf:	c3                   	ret
+
+008023d0 <devpipe_stat>:
+{
+  8023d0:	55                   	push   %ebp
+  8023d1:	89 e5                	mov    %esp,%ebp
+  8023d3:	56                   	push   %esi
+  8023d4:	53                   	push   %ebx
+  8023d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023d8:	83 ec 0c             	sub    $0xc,%esp
+  8023db:	ff 75 08             	push   0x8(%ebp)
+  8023de:	e8 2b e2 ff ff       	call   80060e <fd2data>
+  8023e3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023e5:	83 c4 08             	add    $0x8,%esp
+  8023e8:	68 b2 3b 80 00       	push   $0x803bb2
+  8023ed:	53                   	push   %ebx
+  8023ee:	e8 b5 0d 00 00       	call   8031a8 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8023f3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8023f6:	8b 06                	mov    (%esi),%eax
+  8023f8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8023fe:	29 c1                	sub    %eax,%ecx
+  802400:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802405:	89 c8                	mov    %ecx,%eax
+  802407:	f7 e2                	mul    %edx
+  802409:	c1 ea 0c             	shr    $0xc,%edx
+  80240c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802412:	29 d1                	sub    %edx,%ecx
+  802414:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80241a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802421:	00 00 00 
+	stat->st_dev = &devpipe;
+  802424:	c7 83 8c 00 00 00 60 	movl   $0x804060,0x8c(%ebx)
+  80242b:	40 80 00 
+}
+  80242e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802433:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802436:	5b                   	pop    %ebx
+  802437:	5e                   	pop    %esi
+  802438:	5d                   	pop    %ebp
+  802439:	c3                   	ret
+
+0080243a <devpipe_poll>:
+{
+  80243a:	55                   	push   %ebp
+  80243b:	89 e5                	mov    %esp,%ebp
+  80243d:	57                   	push   %edi
+  80243e:	56                   	push   %esi
+  80243f:	53                   	push   %ebx
+  802440:	83 ec 18             	sub    $0x18,%esp
+  802443:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802446:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802449:	57                   	push   %edi
+  80244a:	e8 bf e1 ff ff       	call   80060e <fd2data>
+  80244f:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	89 f3                	mov    %esi,%ebx
+  802456:	83 e3 01             	and    $0x1,%ebx
+  802459:	75 27                	jne    802482 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80245b:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  802461:	75 48                	jne    8024ab <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  802463:	89 ca                	mov    %ecx,%edx
+  802465:	89 f8                	mov    %edi,%eax
+  802467:	e8 ce fb ff ff       	call   80203a <_pipeisclosed>
+  80246c:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80246e:	89 d8                	mov    %ebx,%eax
+  802470:	83 c8 10             	or     $0x10,%eax
+  802473:	85 d2                	test   %edx,%edx
+  802475:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802478:	89 d8                	mov    %ebx,%eax
+  80247a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247d:	5b                   	pop    %ebx
+  80247e:	5e                   	pop    %esi
+  80247f:	5f                   	pop    %edi
+  802480:	5d                   	pop    %ebp
+  802481:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802482:	8b 58 04             	mov    0x4(%eax),%ebx
+  802485:	8b 00                	mov    (%eax),%eax
+  802487:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80248d:	29 c3                	sub    %eax,%ebx
+  80248f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802494:	89 d8                	mov    %ebx,%eax
+  802496:	f7 e2                	mul    %edx
+  802498:	c1 ea 0c             	shr    $0xc,%edx
+  80249b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8024a1:	39 d3                	cmp    %edx,%ebx
+  8024a3:	0f 95 c3             	setne  %bl
+  8024a6:	0f b6 db             	movzbl %bl,%ebx
+  8024a9:	eb b0                	jmp    80245b <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8024ab:	8b 71 04             	mov    0x4(%ecx),%esi
+  8024ae:	8b 01                	mov    (%ecx),%eax
+  8024b0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8024b6:	29 c6                	sub    %eax,%esi
+  8024b8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8024bd:	89 f0                	mov    %esi,%eax
+  8024bf:	f7 e2                	mul    %edx
+  8024c1:	c1 ea 0c             	shr    $0xc,%edx
+  8024c4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8024ca:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8024cc:	89 d8                	mov    %ebx,%eax
+  8024ce:	83 c8 04             	or     $0x4,%eax
+  8024d1:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8024d7:	0f 42 d8             	cmovb  %eax,%ebx
+  8024da:	eb 87                	jmp    802463 <devpipe_poll+0x29>
+
+008024dc <pipe>:
+{
+  8024dc:	55                   	push   %ebp
+  8024dd:	89 e5                	mov    %esp,%ebp
+  8024df:	56                   	push   %esi
+  8024e0:	53                   	push   %ebx
+  8024e1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8024e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e7:	50                   	push   %eax
+  8024e8:	e8 38 e1 ff ff       	call   800625 <fd_alloc>
+  8024ed:	89 c3                	mov    %eax,%ebx
+  8024ef:	83 c4 10             	add    $0x10,%esp
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	0f 88 23 01 00 00    	js     80261d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024fa:	83 ec 04             	sub    $0x4,%esp
+  8024fd:	68 07 04 00 00       	push   $0x407
+  802502:	ff 75 f4             	push   -0xc(%ebp)
+  802505:	6a 00                	push   $0x0
+  802507:	e8 8f dc ff ff       	call   80019b <sys_page_alloc>
+  80250c:	89 c3                	mov    %eax,%ebx
+  80250e:	83 c4 10             	add    $0x10,%esp
+  802511:	85 c0                	test   %eax,%eax
+  802513:	0f 88 04 01 00 00    	js     80261d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802519:	83 ec 0c             	sub    $0xc,%esp
+  80251c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80251f:	50                   	push   %eax
+  802520:	e8 00 e1 ff ff       	call   800625 <fd_alloc>
+  802525:	89 c3                	mov    %eax,%ebx
+  802527:	83 c4 10             	add    $0x10,%esp
+  80252a:	85 c0                	test   %eax,%eax
+  80252c:	0f 88 db 00 00 00    	js     80260d <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802532:	83 ec 04             	sub    $0x4,%esp
+  802535:	68 07 04 00 00       	push   $0x407
+  80253a:	ff 75 f0             	push   -0x10(%ebp)
+  80253d:	6a 00                	push   $0x0
+  80253f:	e8 57 dc ff ff       	call   80019b <sys_page_alloc>
+  802544:	89 c3                	mov    %eax,%ebx
+  802546:	83 c4 10             	add    $0x10,%esp
+  802549:	85 c0                	test   %eax,%eax
+  80254b:	0f 88 bc 00 00 00    	js     80260d <pipe+0x131>
+	va = fd2data(fd0);
+  802551:	83 ec 0c             	sub    $0xc,%esp
+  802554:	ff 75 f4             	push   -0xc(%ebp)
+  802557:	e8 b2 e0 ff ff       	call   80060e <fd2data>
+  80255c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80255e:	83 c4 0c             	add    $0xc,%esp
+  802561:	68 07 04 00 00       	push   $0x407
+  802566:	50                   	push   %eax
+  802567:	6a 00                	push   $0x0
+  802569:	e8 2d dc ff ff       	call   80019b <sys_page_alloc>
+  80256e:	89 c3                	mov    %eax,%ebx
+  802570:	83 c4 10             	add    $0x10,%esp
+  802573:	85 c0                	test   %eax,%eax
+  802575:	0f 88 82 00 00 00    	js     8025fd <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80257b:	83 ec 0c             	sub    $0xc,%esp
+  80257e:	ff 75 f0             	push   -0x10(%ebp)
+  802581:	e8 88 e0 ff ff       	call   80060e <fd2data>
+  802586:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80258d:	50                   	push   %eax
+  80258e:	6a 00                	push   $0x0
+  802590:	56                   	push   %esi
+  802591:	6a 00                	push   $0x0
+  802593:	e8 46 dc ff ff       	call   8001de <sys_page_map>
+  802598:	89 c3                	mov    %eax,%ebx
+  80259a:	83 c4 20             	add    $0x20,%esp
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	78 4e                	js     8025ef <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8025a1:	a1 60 40 80 00       	mov    0x804060,%eax
+  8025a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025a9:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8025ab:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ae:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8025b5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8025b8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8025ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8025bd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8025c4:	83 ec 0c             	sub    $0xc,%esp
+  8025c7:	ff 75 f4             	push   -0xc(%ebp)
+  8025ca:	e8 2f e0 ff ff       	call   8005fe <fd2num>
+  8025cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025d2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8025d4:	83 c4 04             	add    $0x4,%esp
+  8025d7:	ff 75 f0             	push   -0x10(%ebp)
+  8025da:	e8 1f e0 ff ff       	call   8005fe <fd2num>
+  8025df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025e2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8025e5:	83 c4 10             	add    $0x10,%esp
+  8025e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025ed:	eb 2e                	jmp    80261d <pipe+0x141>
+	sys_page_unmap(0, va);
+  8025ef:	83 ec 08             	sub    $0x8,%esp
+  8025f2:	56                   	push   %esi
+  8025f3:	6a 00                	push   $0x0
+  8025f5:	e8 26 dc ff ff       	call   800220 <sys_page_unmap>
+  8025fa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8025fd:	83 ec 08             	sub    $0x8,%esp
+  802600:	ff 75 f0             	push   -0x10(%ebp)
+  802603:	6a 00                	push   $0x0
+  802605:	e8 16 dc ff ff       	call   800220 <sys_page_unmap>
+  80260a:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80260d:	83 ec 08             	sub    $0x8,%esp
+  802610:	ff 75 f4             	push   -0xc(%ebp)
+  802613:	6a 00                	push   $0x0
+  802615:	e8 06 dc ff ff       	call   800220 <sys_page_unmap>
+  80261a:	83 c4 10             	add    $0x10,%esp
+}
+  80261d:	89 d8                	mov    %ebx,%eax
+  80261f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802622:	5b                   	pop    %ebx
+  802623:	5e                   	pop    %esi
+  802624:	5d                   	pop    %ebp
+  802625:	c3                   	ret
+
+00802626 <pipeisclosed>:
+{
+  802626:	55                   	push   %ebp
+  802627:	89 e5                	mov    %esp,%ebp
+  802629:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80262c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80262f:	50                   	push   %eax
+  802630:	ff 75 08             	push   0x8(%ebp)
+  802633:	e8 3d e0 ff ff       	call   800675 <fd_lookup>
+  802638:	83 c4 10             	add    $0x10,%esp
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	78 18                	js     802657 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80263f:	83 ec 0c             	sub    $0xc,%esp
+  802642:	ff 75 f4             	push   -0xc(%ebp)
+  802645:	e8 c4 df ff ff       	call   80060e <fd2data>
+  80264a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80264c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80264f:	e8 e6 f9 ff ff       	call   80203a <_pipeisclosed>
+  802654:	83 c4 10             	add    $0x10,%esp
+}
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+
+00802659 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  802659:	55                   	push   %ebp
+  80265a:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80265c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80265f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  802665:	5d                   	pop    %ebp
+  802666:	c3                   	ret
+
+00802667 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  802667:	55                   	push   %ebp
+  802668:	89 e5                	mov    %esp,%ebp
+  80266a:	53                   	push   %ebx
+  80266b:	83 ec 04             	sub    $0x4,%esp
+  80266e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  802671:	8b 03                	mov    (%ebx),%eax
+  802673:	85 c0                	test   %eax,%eax
+  802675:	75 05                	jne    80267c <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  802677:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80267a:	c9                   	leave
+  80267b:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80267c:	83 ec 08             	sub    $0x8,%esp
+  80267f:	50                   	push   %eax
+  802680:	8d 43 04             	lea    0x4(%ebx),%eax
+  802683:	50                   	push   %eax
+  802684:	e8 e7 dd ff ff       	call   800470 <sys_page_batch>
+	pb->pb_n = 0;
+  802689:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80268f:	83 c4 10             	add    $0x10,%esp
+  802692:	eb e3                	jmp    802677 <pgbatch_flush+0x10>
+
+00802694 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  802694:	55                   	push   %ebp
+  802695:	89 e5                	mov    %esp,%ebp
+  802697:	56                   	push   %esi
+  802698:	53                   	push   %ebx
+  802699:	89 c3                	mov    %eax,%ebx
+  80269b:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80269d:	83 38 20             	cmpl   $0x20,(%eax)
+  8026a0:	74 2c                	je     8026ce <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8026a2:	8b 03                	mov    (%ebx),%eax
+  8026a4:	8d 50 01             	lea    0x1(%eax),%edx
+  8026a7:	89 13                	mov    %edx,(%ebx)
+  8026a9:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8026ac:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8026b0:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8026b2:	83 ec 04             	sub    $0x4,%esp
+  8026b5:	6a 18                	push   $0x18
+  8026b7:	6a 00                	push   $0x0
+  8026b9:	50                   	push   %eax
+  8026ba:	e8 64 0c 00 00       	call   803323 <memset>
+	return 0;
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  8026c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ca:	5b                   	pop    %ebx
+  8026cb:	5e                   	pop    %esi
+  8026cc:	5d                   	pop    %ebp
+  8026cd:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	50                   	push   %eax
+  8026d2:	e8 90 ff ff ff       	call   802667 <pgbatch_flush>
+  8026d7:	83 c4 10             	add    $0x10,%esp
+  8026da:	85 c0                	test   %eax,%eax
+  8026dc:	79 c4                	jns    8026a2 <pgbatch_slot+0xe>
+  8026de:	eb e7                	jmp    8026c7 <pgbatch_slot+0x33>
+
+008026e0 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8026e0:	55                   	push   %ebp
+  8026e1:	89 e5                	mov    %esp,%ebp
+  8026e3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8026e6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ec:	e8 a3 ff ff ff       	call   802694 <pgbatch_slot>
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	78 20                	js     802715 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8026f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8026fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802701:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  802704:	8b 55 10             	mov    0x10(%ebp),%edx
+  802707:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80270a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80270d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802710:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802715:	c9                   	leave
+  802716:	c3                   	ret
+
+00802717 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  802717:	55                   	push   %ebp
+  802718:	89 e5                	mov    %esp,%ebp
+  80271a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80271d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802720:	8b 45 08             	mov    0x8(%ebp),%eax
+  802723:	e8 6c ff ff ff       	call   802694 <pgbatch_slot>
+  802728:	85 c0                	test   %eax,%eax
+  80272a:	78 2c                	js     802758 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80272c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80272f:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  802735:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802738:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80273b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80273e:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  802741:	8b 55 14             	mov    0x14(%ebp),%edx
+  802744:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  802747:	8b 55 18             	mov    0x18(%ebp),%edx
+  80274a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80274d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  802750:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  802753:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802758:	c9                   	leave
+  802759:	c3                   	ret
+
+0080275a <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80275a:	55                   	push   %ebp
+  80275b:	89 e5                	mov    %esp,%ebp
+  80275d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802760:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802763:	8b 45 08             	mov    0x8(%ebp),%eax
+  802766:	e8 29 ff ff ff       	call   802694 <pgbatch_slot>
+  80276b:	85 c0                	test   %eax,%eax
+  80276d:	78 1a                	js     802789 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80276f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802772:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  802778:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80277b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80277e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802781:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  802784:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+
+0080278b <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80278b:	55                   	push   %ebp
+  80278c:	89 e5                	mov    %esp,%ebp
+  80278e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  802791:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802794:	8b 45 08             	mov    0x8(%ebp),%eax
+  802797:	e8 f8 fe ff ff       	call   802694 <pgbatch_slot>
+  80279c:	85 c0                	test   %eax,%eax
+  80279e:	78 20                	js     8027c0 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8027a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a3:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8027a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027ac:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8027af:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027b2:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8027b5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027b8:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8027c8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ce:	e8 c1 fe ff ff       	call   802694 <pgbatch_slot>
+  8027d3:	85 c0                	test   %eax,%eax
+  8027d5:	78 26                	js     8027fd <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8027d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027da:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8027e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8027e3:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8027e6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027e9:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8027ec:	8b 55 14             	mov    0x14(%ebp),%edx
+  8027ef:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8027f2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8027f5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8027f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027fd:	c9                   	leave
+  8027fe:	c3                   	ret
+
+008027ff <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8027ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802804:	c3                   	ret
+
+00802805 <devcons_poll>:
+{
+  802805:	55                   	push   %ebp
+  802806:	89 e5                	mov    %esp,%ebp
+  802808:	53                   	push   %ebx
+  802809:	83 ec 04             	sub    $0x4,%esp
+  80280c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80280f:	89 da                	mov    %ebx,%edx
+  802811:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  802814:	83 3d 34 53 80 00 00 	cmpl   $0x0,0x805334
+  80281b:	74 0c                	je     802829 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80281d:	89 d8                	mov    %ebx,%eax
+  80281f:	83 e0 01             	and    $0x1,%eax
+  802822:	09 d0                	or     %edx,%eax
+}
+  802824:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802827:	c9                   	leave
+  802828:	c3                   	ret
+		cons_peek = sys_cgetc();
+  802829:	e8 cf d8 ff ff       	call   8000fd <sys_cgetc>
+  80282e:	a3 34 53 80 00       	mov    %eax,0x805334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  802833:	89 da                	mov    %ebx,%edx
+  802835:	83 e2 04             	and    $0x4,%edx
+  802838:	85 c0                	test   %eax,%eax
+  80283a:	74 e6                	je     802822 <devcons_poll+0x1d>
+  80283c:	eb df                	jmp    80281d <devcons_poll+0x18>
+
+0080283e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80283e:	55                   	push   %ebp
+  80283f:	89 e5                	mov    %esp,%ebp
+  802841:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802844:	68 be 3b 80 00       	push   $0x803bbe
+  802849:	ff 75 0c             	push   0xc(%ebp)
+  80284c:	e8 57 09 00 00       	call   8031a8 <strcpy>
+	return 0;
+}
+  802851:	b8 00 00 00 00       	mov    $0x0,%eax
+  802856:	c9                   	leave
+  802857:	c3                   	ret
+
+00802858 <devcons_write>:
+{
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	57                   	push   %edi
+  80285c:	56                   	push   %esi
+  80285d:	53                   	push   %ebx
+  80285e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  802864:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802867:	85 ff                	test   %edi,%edi
+  802869:	74 51                	je     8028bc <devcons_write+0x64>
+  80286b:	be 00 00 00 00       	mov    $0x0,%esi
+  802870:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  802875:	89 fb                	mov    %edi,%ebx
+  802877:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  802879:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80287e:	39 d3                	cmp    %edx,%ebx
+  802880:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802883:	83 ec 04             	sub    $0x4,%esp
+  802886:	53                   	push   %ebx
+  802887:	03 45 0c             	add    0xc(%ebp),%eax
+  80288a:	50                   	push   %eax
+  80288b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  802891:	50                   	push   %eax
+  802892:	e8 c1 0a 00 00       	call   803358 <memmove>
+		sys_cputs(buf, m);
+  802897:	83 c4 08             	add    $0x8,%esp
+  80289a:	53                   	push   %ebx
+  80289b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8028a1:	50                   	push   %eax
+  8028a2:	e8 38 d8 ff ff       	call   8000df <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8028a7:	01 de                	add    %ebx,%esi
+  8028a9:	89 f0                	mov    %esi,%eax
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	39 fe                	cmp    %edi,%esi
+  8028b0:	72 c3                	jb     802875 <devcons_write+0x1d>
+}
+  8028b2:	89 f0                	mov    %esi,%eax
+  8028b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b7:	5b                   	pop    %ebx
+  8028b8:	5e                   	pop    %esi
+  8028b9:	5f                   	pop    %edi
+  8028ba:	5d                   	pop    %ebp
+  8028bb:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8028bc:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8028c1:	eb ef                	jmp    8028b2 <devcons_write+0x5a>
+
+008028c3 <devcons_read>:
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8028ce:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028d2:	74 36                	je     80290a <devcons_read+0x47>
+	c = cons_peek;
+  8028d4:	a1 34 53 80 00       	mov    0x805334,%eax
+	cons_peek = 0;
+  8028d9:	c7 05 34 53 80 00 00 	movl   $0x0,0x805334
+  8028e0:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	75 10                	jne    8028f7 <devcons_read+0x34>
+  8028e7:	e8 11 d8 ff ff       	call   8000fd <sys_cgetc>
+  8028ec:	85 c0                	test   %eax,%eax
+  8028ee:	75 07                	jne    8028f7 <devcons_read+0x34>
+		sys_yield();
+  8028f0:	e8 87 d8 ff ff       	call   80017c <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8028f5:	eb f0                	jmp    8028e7 <devcons_read+0x24>
+	if (c < 0)
+  8028f7:	85 c0                	test   %eax,%eax
+  8028f9:	78 0f                	js     80290a <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8028fb:	83 f8 04             	cmp    $0x4,%eax
+  8028fe:	74 0c                	je     80290c <devcons_read+0x49>
+	*(char*)vbuf = c;
+  802900:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802903:	88 02                	mov    %al,(%edx)
+	return 1;
+  802905:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+		return 0;
+  80290c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802911:	eb f7                	jmp    80290a <devcons_read+0x47>
+
+00802913 <cputchar>:
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802919:	8b 45 08             	mov    0x8(%ebp),%eax
+  80291c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80291f:	6a 01                	push   $0x1
+  802921:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802924:	50                   	push   %eax
+  802925:	e8 b5 d7 ff ff       	call   8000df <sys_cputs>
+}
+  80292a:	83 c4 10             	add    $0x10,%esp
+  80292d:	c9                   	leave
+  80292e:	c3                   	ret
+
+0080292f <getchar>:
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802935:	6a 01                	push   $0x1
+  802937:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80293a:	50                   	push   %eax
+  80293b:	6a 00                	push   $0x0
+  80293d:	e8 b7 df ff ff       	call   8008f9 <read>
+	if (r < 0)
+  802942:	83 c4 10             	add    $0x10,%esp
+  802945:	85 c0                	test   %eax,%eax
+  802947:	78 06                	js     80294f <getchar+0x20>
+	if (r < 1)
+  802949:	74 06                	je     802951 <getchar+0x22>
+	return c;
+  80294b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80294f:	c9                   	leave
+  802950:	c3                   	ret
+		return -E_EOF;
+  802951:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802956:	eb f7                	jmp    80294f <getchar+0x20>
+
+00802958 <iscons>:
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80295e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802961:	50                   	push   %eax
+  802962:	ff 75 08             	push   0x8(%ebp)
+  802965:	e8 0b dd ff ff       	call   800675 <fd_lookup>
+  80296a:	83 c4 10             	add    $0x10,%esp
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	78 11                	js     802982 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802971:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802974:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  80297a:	39 10                	cmp    %edx,(%eax)
+  80297c:	0f 94 c0             	sete   %al
+  80297f:	0f b6 c0             	movzbl %al,%eax
+}
+  802982:	c9                   	leave
+  802983:	c3                   	ret
+
+00802984 <opencons>:
+{
+  802984:	55                   	push   %ebp
+  802985:	89 e5                	mov    %esp,%ebp
+  802987:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80298a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80298d:	50                   	push   %eax
+  80298e:	e8 92 dc ff ff       	call   800625 <fd_alloc>
+  802993:	83 c4 10             	add    $0x10,%esp
+  802996:	85 c0                	test   %eax,%eax
+  802998:	78 3a                	js     8029d4 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80299a:	83 ec 04             	sub    $0x4,%esp
+  80299d:	68 07 04 00 00       	push   $0x407
+  8029a2:	ff 75 f4             	push   -0xc(%ebp)
+  8029a5:	6a 00                	push   $0x0
+  8029a7:	e8 ef d7 ff ff       	call   80019b <sys_page_alloc>
+  8029ac:	83 c4 10             	add    $0x10,%esp
+  8029af:	85 c0                	test   %eax,%eax
+  8029b1:	78 21                	js     8029d4 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8029b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029b6:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  8029bc:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8029be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8029c8:	83 ec 0c             	sub    $0xc,%esp
+  8029cb:	50                   	push   %eax
+  8029cc:	e8 2d dc ff ff       	call   8005fe <fd2num>
+  8029d1:	83 c4 10             	add    $0x10,%esp
+}
+  8029d4:	c9                   	leave
+  8029d5:	c3                   	ret
+
+008029d6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8029d6:	55                   	push   %ebp
+  8029d7:	89 e5                	mov    %esp,%ebp
+  8029d9:	56                   	push   %esi
+  8029da:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8029db:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8029de:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8029e4:	e8 74 d7 ff ff       	call   80015d <sys_getenvid>
+  8029e9:	83 ec 0c             	sub    $0xc,%esp
+  8029ec:	ff 75 0c             	push   0xc(%ebp)
+  8029ef:	ff 75 08             	push   0x8(%ebp)
+  8029f2:	56                   	push   %esi
+  8029f3:	50                   	push   %eax
+  8029f4:	68 cc 3b 80 00       	push   $0x803bcc
+  8029f9:	e8 b3 00 00 00       	call   802ab1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8029fe:	83 c4 18             	add    $0x18,%esp
+  802a01:	53                   	push   %ebx
+  802a02:	ff 75 10             	push   0x10(%ebp)
+  802a05:	e8 56 00 00 00       	call   802a60 <vcprintf>
+	cprintf("\n");
+  802a0a:	c7 04 24 b0 3b 80 00 	movl   $0x803bb0,(%esp)
+  802a11:	e8 9b 00 00 00       	call   802ab1 <cprintf>
+  802a16:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802a19:	cc                   	int3
+	while (1)
+  802a1a:	eb fd                	jmp    802a19 <_panic+0x43>
+
+00802a1c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	53                   	push   %ebx
+  802a20:	83 ec 04             	sub    $0x4,%esp
+  802a23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  802a26:	8b 13                	mov    (%ebx),%edx
+  802a28:	8d 42 01             	lea    0x1(%edx),%eax
+  802a2b:	89 03                	mov    %eax,(%ebx)
+  802a2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a30:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  802a34:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802a39:	74 09                	je     802a44 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  802a3b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  802a3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a42:	c9                   	leave
+  802a43:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  802a44:	83 ec 08             	sub    $0x8,%esp
+  802a47:	68 ff 00 00 00       	push   $0xff
+  802a4c:	8d 43 08             	lea    0x8(%ebx),%eax
+  802a4f:	50                   	push   %eax
+  802a50:	e8 8a d6 ff ff       	call   8000df <sys_cputs>
+		b->idx = 0;
+  802a55:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802a5b:	83 c4 10             	add    $0x10,%esp
+  802a5e:	eb db                	jmp    802a3b <putch+0x1f>
+
+00802a60 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802a60:	55                   	push   %ebp
+  802a61:	89 e5                	mov    %esp,%ebp
+  802a63:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  802a69:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802a70:	00 00 00 
+	b.cnt = 0;
+  802a73:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802a7a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  802a7d:	ff 75 0c             	push   0xc(%ebp)
+  802a80:	ff 75 08             	push   0x8(%ebp)
+  802a83:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802a89:	50                   	push   %eax
+  802a8a:	68 1c 2a 80 00       	push   $0x802a1c
+  802a8f:	e8 1c 01 00 00       	call   802bb0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  802a94:	83 c4 08             	add    $0x8,%esp
+  802a97:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802a9d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802aa3:	50                   	push   %eax
+  802aa4:	e8 36 d6 ff ff       	call   8000df <sys_cputs>
+
+	return b.cnt;
+}
+  802aa9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802aaf:	c9                   	leave
+  802ab0:	c3                   	ret
+
+00802ab1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  802ab7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  802aba:	50                   	push   %eax
+  802abb:	ff 75 08             	push   0x8(%ebp)
+  802abe:	e8 9d ff ff ff       	call   802a60 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  802ac3:	c9                   	leave
+  802ac4:	c3                   	ret
+
+00802ac5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  802ac5:	55                   	push   %ebp
+  802ac6:	89 e5                	mov    %esp,%ebp
+  802ac8:	57                   	push   %edi
+  802ac9:	56                   	push   %esi
+  802aca:	53                   	push   %ebx
+  802acb:	83 ec 1c             	sub    $0x1c,%esp
+  802ace:	89 c3                	mov    %eax,%ebx
+  802ad0:	89 d6                	mov    %edx,%esi
+  802ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802ad8:	89 d1                	mov    %edx,%ecx
+  802ada:	89 c2                	mov    %eax,%edx
+  802adc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802adf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802ae2:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  802ae5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802ae8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802aef:	39 c2                	cmp    %eax,%edx
+  802af1:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802af4:	73 4b                	jae    802b41 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  802af6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802af9:	8d 78 ff             	lea    -0x1(%eax),%edi
+  802afc:	85 ff                	test   %edi,%edi
+  802afe:	7e 11                	jle    802b11 <printnum+0x4c>
+			putch(padc, putdat);
+  802b00:	83 ec 08             	sub    $0x8,%esp
+  802b03:	56                   	push   %esi
+  802b04:	ff 75 18             	push   0x18(%ebp)
+  802b07:	ff d3                	call   *%ebx
+		while (--width > 0)
+  802b09:	83 c4 10             	add    $0x10,%esp
+  802b0c:	83 ef 01             	sub    $0x1,%edi
+  802b0f:	75 ef                	jne    802b00 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  802b11:	83 ec 08             	sub    $0x8,%esp
+  802b14:	56                   	push   %esi
+  802b15:	83 ec 04             	sub    $0x4,%esp
+  802b18:	ff 75 e4             	push   -0x1c(%ebp)
+  802b1b:	ff 75 e0             	push   -0x20(%ebp)
+  802b1e:	ff 75 dc             	push   -0x24(%ebp)
+  802b21:	ff 75 d8             	push   -0x28(%ebp)
+  802b24:	e8 33 0e 00 00       	call   80395c <__umoddi3>
+  802b29:	83 c4 14             	add    $0x14,%esp
+  802b2c:	0f be 80 ef 3b 80 00 	movsbl 0x803bef(%eax),%eax
+  802b33:	50                   	push   %eax
+  802b34:	ff d3                	call   *%ebx
+}
+  802b36:	83 c4 10             	add    $0x10,%esp
+  802b39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b3c:	5b                   	pop    %ebx
+  802b3d:	5e                   	pop    %esi
+  802b3e:	5f                   	pop    %edi
+  802b3f:	5d                   	pop    %ebp
+  802b40:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  802b41:	83 ec 0c             	sub    $0xc,%esp
+  802b44:	ff 75 18             	push   0x18(%ebp)
+  802b47:	8b 7d 14             	mov    0x14(%ebp),%edi
+  802b4a:	8d 57 ff             	lea    -0x1(%edi),%edx
+  802b4d:	52                   	push   %edx
+  802b4e:	50                   	push   %eax
+  802b4f:	83 ec 08             	sub    $0x8,%esp
+  802b52:	ff 75 e4             	push   -0x1c(%ebp)
+  802b55:	ff 75 e0             	push   -0x20(%ebp)
+  802b58:	ff 75 dc             	push   -0x24(%ebp)
+  802b5b:	ff 75 d8             	push   -0x28(%ebp)
+  802b5e:	e8 33 0d 00 00       	call   803896 <__udivdi3>
+  802b63:	83 c4 18             	add    $0x18,%esp
+  802b66:	52                   	push   %edx
+  802b67:	50                   	push   %eax
+  802b68:	89 f2                	mov    %esi,%edx
+  802b6a:	89 d8                	mov    %ebx,%eax
+  802b6c:	e8 54 ff ff ff       	call   802ac5 <printnum>
+  802b71:	83 c4 20             	add    $0x20,%esp
+  802b74:	eb 9b                	jmp    802b11 <printnum+0x4c>
+
+00802b76 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802b76:	55                   	push   %ebp
+  802b77:	89 e5                	mov    %esp,%ebp
+  802b79:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  802b7c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  802b80:	8b 10                	mov    (%eax),%edx
+  802b82:	3b 50 04             	cmp    0x4(%eax),%edx
+  802b85:	73 0a                	jae    802b91 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  802b87:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802b8a:	89 08                	mov    %ecx,(%eax)
+  802b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8f:	88 02                	mov    %al,(%edx)
+}
+  802b91:	5d                   	pop    %ebp
+  802b92:	c3                   	ret
+
+00802b93 <printfmt>:
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  802b99:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  802b9c:	50                   	push   %eax
+  802b9d:	ff 75 10             	push   0x10(%ebp)
+  802ba0:	ff 75 0c             	push   0xc(%ebp)
+  802ba3:	ff 75 08             	push   0x8(%ebp)
+  802ba6:	e8 05 00 00 00       	call   802bb0 <vprintfmt>
+}
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	c9                   	leave
+  802baf:	c3                   	ret
+
+00802bb0 <vprintfmt>:
+{
+  802bb0:	55                   	push   %ebp
+  802bb1:	89 e5                	mov    %esp,%ebp
+  802bb3:	57                   	push   %edi
+  802bb4:	56                   	push   %esi
+  802bb5:	53                   	push   %ebx
+  802bb6:	83 ec 2c             	sub    $0x2c,%esp
+  802bb9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802bbc:	89 df                	mov    %ebx,%edi
+  802bbe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bc1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bc4:	8d 70 01             	lea    0x1(%eax),%esi
+  802bc7:	0f b6 00             	movzbl (%eax),%eax
+  802bca:	83 f8 25             	cmp    $0x25,%eax
+  802bcd:	74 1e                	je     802bed <vprintfmt+0x3d>
+			if (ch == '\0')
+  802bcf:	85 c0                	test   %eax,%eax
+  802bd1:	0f 84 15 05 00 00    	je     8030ec <vprintfmt+0x53c>
+			putch(ch, putdat);
+  802bd7:	83 ec 08             	sub    $0x8,%esp
+  802bda:	53                   	push   %ebx
+  802bdb:	50                   	push   %eax
+  802bdc:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  802bde:	83 c6 01             	add    $0x1,%esi
+  802be1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	83 f8 25             	cmp    $0x25,%eax
+  802beb:	75 e2                	jne    802bcf <vprintfmt+0x1f>
+		padc = ' ';
+  802bed:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  802bf1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  802bf8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  802bff:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  802c06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c0b:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c0e:	8d 56 01             	lea    0x1(%esi),%edx
+  802c11:	0f b6 0e             	movzbl (%esi),%ecx
+  802c14:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  802c17:	3c 55                	cmp    $0x55,%al
+  802c19:	0f 87 3b 04 00 00    	ja     80305a <vprintfmt+0x4aa>
+  802c1f:	0f b6 c0             	movzbl %al,%eax
+  802c22:	ff 24 85 60 3d 80 00 	jmp    *0x803d60(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  802c29:	89 75 10             	mov    %esi,0x10(%ebp)
+  802c2c:	eb 93                	jmp    802bc1 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c2e:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  802c30:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  802c34:	eb d8                	jmp    802c0e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802c36:	89 d6                	mov    %edx,%esi
+  802c38:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  802c3c:	eb d0                	jmp    802c0e <vprintfmt+0x5e>
+  802c3e:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  802c41:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  802c44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  802c47:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  802c4b:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  802c4e:	83 f9 09             	cmp    $0x9,%ecx
+  802c51:	77 6f                	ja     802cc2 <vprintfmt+0x112>
+  802c53:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  802c56:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  802c59:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  802c5c:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  802c60:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  802c63:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802c66:	83 fe 09             	cmp    $0x9,%esi
+  802c69:	76 eb                	jbe    802c56 <vprintfmt+0xa6>
+  802c6b:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  802c6e:	89 d6                	mov    %edx,%esi
+  802c70:	eb 13                	jmp    802c85 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  802c72:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c75:	8b 00                	mov    (%eax),%eax
+  802c77:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c7d:	8d 40 04             	lea    0x4(%eax),%eax
+  802c80:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802c83:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  802c85:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802c89:	79 83                	jns    802c0e <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  802c8b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c8e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c91:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  802c98:	e9 71 ff ff ff       	jmp    802c0e <vprintfmt+0x5e>
+			if (width < 0)
+  802c9d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ca0:	85 c9                	test   %ecx,%ecx
+  802ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca7:	0f 49 c1             	cmovns %ecx,%eax
+  802caa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cad:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802caf:	e9 5a ff ff ff       	jmp    802c0e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cb4:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  802cb6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  802cbd:	e9 4c ff ff ff       	jmp    802c0e <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  802cc2:	89 d6                	mov    %edx,%esi
+  802cc4:	eb bf                	jmp    802c85 <vprintfmt+0xd5>
+			lflag++;
+  802cc6:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  802cca:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  802ccc:	e9 3d ff ff ff       	jmp    802c0e <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  802cd1:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cd4:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cd7:	8d 70 04             	lea    0x4(%eax),%esi
+  802cda:	83 ec 08             	sub    $0x8,%esp
+  802cdd:	53                   	push   %ebx
+  802cde:	ff 30                	push   (%eax)
+  802ce0:	ff d7                	call   *%edi
+			break;
+  802ce2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  802ce5:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  802ce8:	e9 d4 fe ff ff       	jmp    802bc1 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  802ced:	89 55 10             	mov    %edx,0x10(%ebp)
+  802cf0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802cf3:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  802cf6:	8b 10                	mov    (%eax),%edx
+  802cf8:	89 d0                	mov    %edx,%eax
+  802cfa:	f7 d8                	neg    %eax
+  802cfc:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802cff:	83 f8 12             	cmp    $0x12,%eax
+  802d02:	7f 23                	jg     802d27 <vprintfmt+0x177>
+  802d04:	8b 14 85 c0 3e 80 00 	mov    0x803ec0(,%eax,4),%edx
+  802d0b:	85 d2                	test   %edx,%edx
+  802d0d:	74 18                	je     802d27 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  802d0f:	52                   	push   %edx
+  802d10:	68 7b 3b 80 00       	push   $0x803b7b
+  802d15:	53                   	push   %ebx
+  802d16:	57                   	push   %edi
+  802d17:	e8 77 fe ff ff       	call   802b93 <printfmt>
+  802d1c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d1f:	89 75 14             	mov    %esi,0x14(%ebp)
+  802d22:	e9 9a fe ff ff       	jmp    802bc1 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  802d27:	50                   	push   %eax
+  802d28:	68 07 3c 80 00       	push   $0x803c07
+  802d2d:	53                   	push   %ebx
+  802d2e:	57                   	push   %edi
+  802d2f:	e8 5f fe ff ff       	call   802b93 <printfmt>
+  802d34:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  802d37:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  802d3a:	e9 82 fe ff ff       	jmp    802bc1 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802d3f:	89 55 10             	mov    %edx,0x10(%ebp)
+  802d42:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d45:	83 c0 04             	add    $0x4,%eax
+  802d48:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802d4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d4e:	8b 00                	mov    (%eax),%eax
+  802d50:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d53:	85 c0                	test   %eax,%eax
+  802d55:	0f 84 61 03 00 00    	je     8030bc <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  802d5b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802d5f:	7e 06                	jle    802d67 <vprintfmt+0x1b7>
+  802d61:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  802d65:	75 29                	jne    802d90 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802d67:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d6a:	8d 70 01             	lea    0x1(%eax),%esi
+  802d6d:	0f b6 00             	movzbl (%eax),%eax
+  802d70:	0f be d0             	movsbl %al,%edx
+  802d73:	85 d2                	test   %edx,%edx
+  802d75:	0f 84 bb 00 00 00    	je     802e36 <vprintfmt+0x286>
+  802d7b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802d7e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802d81:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802d84:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802d87:	eb 7a                	jmp    802e03 <vprintfmt+0x253>
+				p = "(null)";
+  802d89:	c7 45 d0 00 3c 80 00 	movl   $0x803c00,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802d90:	83 ec 08             	sub    $0x8,%esp
+  802d93:	ff 75 d4             	push   -0x2c(%ebp)
+  802d96:	ff 75 d0             	push   -0x30(%ebp)
+  802d99:	e8 e0 03 00 00       	call   80317e <strnlen>
+  802d9e:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  802da1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802da4:	83 c4 10             	add    $0x10,%esp
+  802da7:	85 d2                	test   %edx,%edx
+  802da9:	0f 8e d6 02 00 00    	jle    803085 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  802daf:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  802db3:	83 ec 08             	sub    $0x8,%esp
+  802db6:	53                   	push   %ebx
+  802db7:	56                   	push   %esi
+  802db8:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  802dba:	83 c4 10             	add    $0x10,%esp
+  802dbd:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  802dc1:	75 f0                	jne    802db3 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802dc3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802dc6:	8d 70 01             	lea    0x1(%eax),%esi
+  802dc9:	0f b6 00             	movzbl (%eax),%eax
+  802dcc:	0f be d0             	movsbl %al,%edx
+  802dcf:	85 d2                	test   %edx,%edx
+  802dd1:	0f 84 da 02 00 00    	je     8030b1 <vprintfmt+0x501>
+  802dd7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802dda:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  802ddd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  802de0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802de3:	eb 1e                	jmp    802e03 <vprintfmt+0x253>
+					putch(ch, putdat);
+  802de5:	83 ec 08             	sub    $0x8,%esp
+  802de8:	ff 75 0c             	push   0xc(%ebp)
+  802deb:	52                   	push   %edx
+  802dec:	ff 55 08             	call   *0x8(%ebp)
+  802def:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802df2:	83 eb 01             	sub    $0x1,%ebx
+  802df5:	83 c6 01             	add    $0x1,%esi
+  802df8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802dfc:	0f be d0             	movsbl %al,%edx
+  802dff:	85 d2                	test   %edx,%edx
+  802e01:	74 2a                	je     802e2d <vprintfmt+0x27d>
+  802e03:	85 ff                	test   %edi,%edi
+  802e05:	78 05                	js     802e0c <vprintfmt+0x25c>
+  802e07:	83 ef 01             	sub    $0x1,%edi
+  802e0a:	78 59                	js     802e65 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  802e0c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802e10:	74 d3                	je     802de5 <vprintfmt+0x235>
+  802e12:	0f be c0             	movsbl %al,%eax
+  802e15:	83 e8 20             	sub    $0x20,%eax
+  802e18:	83 f8 5e             	cmp    $0x5e,%eax
+  802e1b:	76 c8                	jbe    802de5 <vprintfmt+0x235>
+					putch('?', putdat);
+  802e1d:	83 ec 08             	sub    $0x8,%esp
+  802e20:	ff 75 0c             	push   0xc(%ebp)
+  802e23:	6a 3f                	push   $0x3f
+  802e25:	ff 55 08             	call   *0x8(%ebp)
+  802e28:	83 c4 10             	add    $0x10,%esp
+  802e2b:	eb c5                	jmp    802df2 <vprintfmt+0x242>
+  802e2d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  802e36:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e39:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  802e3d:	7e 1b                	jle    802e5a <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  802e3f:	83 ec 08             	sub    $0x8,%esp
+  802e42:	53                   	push   %ebx
+  802e43:	6a 20                	push   $0x20
+  802e45:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  802e47:	83 c4 10             	add    $0x10,%esp
+  802e4a:	83 ee 01             	sub    $0x1,%esi
+  802e4d:	75 f0                	jne    802e3f <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  802e4f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e52:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e55:	e9 67 fd ff ff       	jmp    802bc1 <vprintfmt+0x11>
+  802e5a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802e5d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e60:	e9 5c fd ff ff       	jmp    802bc1 <vprintfmt+0x11>
+  802e65:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802e68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802e6e:	eb c6                	jmp    802e36 <vprintfmt+0x286>
+	if (lflag >= 2)
+  802e70:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802e73:	89 55 10             	mov    %edx,0x10(%ebp)
+  802e76:	83 f9 01             	cmp    $0x1,%ecx
+  802e79:	7f 1f                	jg     802e9a <vprintfmt+0x2ea>
+	else if (lflag)
+  802e7b:	85 c9                	test   %ecx,%ecx
+  802e7d:	74 67                	je     802ee6 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  802e7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e82:	8b 30                	mov    (%eax),%esi
+  802e84:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802e87:	89 f0                	mov    %esi,%eax
+  802e89:	c1 f8 1f             	sar    $0x1f,%eax
+  802e8c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802e8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e92:	8d 40 04             	lea    0x4(%eax),%eax
+  802e95:	89 45 14             	mov    %eax,0x14(%ebp)
+  802e98:	eb 17                	jmp    802eb1 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  802e9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9d:	8b 50 04             	mov    0x4(%eax),%edx
+  802ea0:	8b 00                	mov    (%eax),%eax
+  802ea2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802ea5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802ea8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eab:	8d 40 08             	lea    0x8(%eax),%eax
+  802eae:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  802eb1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802eb4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  802eb7:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  802ebc:	85 c9                	test   %ecx,%ecx
+  802ebe:	0f 89 12 01 00 00    	jns    802fd6 <vprintfmt+0x426>
+				putch('-', putdat);
+  802ec4:	83 ec 08             	sub    $0x8,%esp
+  802ec7:	53                   	push   %ebx
+  802ec8:	6a 2d                	push   $0x2d
+  802eca:	ff d7                	call   *%edi
+				num = -(long long) num;
+  802ecc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802ecf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ed2:	f7 da                	neg    %edx
+  802ed4:	83 d1 00             	adc    $0x0,%ecx
+  802ed7:	f7 d9                	neg    %ecx
+  802ed9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  802edc:	be 0a 00 00 00       	mov    $0xa,%esi
+  802ee1:	e9 f0 00 00 00       	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  802ee6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ee9:	8b 30                	mov    (%eax),%esi
+  802eeb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802eee:	89 f0                	mov    %esi,%eax
+  802ef0:	c1 f8 1f             	sar    $0x1f,%eax
+  802ef3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802ef6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ef9:	8d 40 04             	lea    0x4(%eax),%eax
+  802efc:	89 45 14             	mov    %eax,0x14(%ebp)
+  802eff:	eb b0                	jmp    802eb1 <vprintfmt+0x301>
+	if (lflag >= 2)
+  802f01:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f04:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f07:	83 f9 01             	cmp    $0x1,%ecx
+  802f0a:	7f 1e                	jg     802f2a <vprintfmt+0x37a>
+	else if (lflag)
+  802f0c:	85 c9                	test   %ecx,%ecx
+  802f0e:	74 32                	je     802f42 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  802f10:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f13:	8b 10                	mov    (%eax),%edx
+  802f15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f1a:	8d 40 04             	lea    0x4(%eax),%eax
+  802f1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f20:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  802f25:	e9 ac 00 00 00       	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f2a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2d:	8b 10                	mov    (%eax),%edx
+  802f2f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f32:	8d 40 08             	lea    0x8(%eax),%eax
+  802f35:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f38:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  802f3d:	e9 94 00 00 00       	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f42:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f45:	8b 10                	mov    (%eax),%edx
+  802f47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f4c:	8d 40 04             	lea    0x4(%eax),%eax
+  802f4f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  802f52:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  802f57:	eb 7d                	jmp    802fd6 <vprintfmt+0x426>
+	if (lflag >= 2)
+  802f59:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802f5c:	89 55 10             	mov    %edx,0x10(%ebp)
+  802f5f:	83 f9 01             	cmp    $0x1,%ecx
+  802f62:	7f 1b                	jg     802f7f <vprintfmt+0x3cf>
+	else if (lflag)
+  802f64:	85 c9                	test   %ecx,%ecx
+  802f66:	74 2c                	je     802f94 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  802f68:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f6b:	8b 10                	mov    (%eax),%edx
+  802f6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f72:	8d 40 04             	lea    0x4(%eax),%eax
+  802f75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f78:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  802f7d:	eb 57                	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  802f7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f82:	8b 10                	mov    (%eax),%edx
+  802f84:	8b 48 04             	mov    0x4(%eax),%ecx
+  802f87:	8d 40 08             	lea    0x8(%eax),%eax
+  802f8a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802f8d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  802f92:	eb 42                	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  802f94:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f97:	8b 10                	mov    (%eax),%edx
+  802f99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f9e:	8d 40 04             	lea    0x4(%eax),%eax
+  802fa1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  802fa4:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  802fa9:	eb 2b                	jmp    802fd6 <vprintfmt+0x426>
+			putch('0', putdat);
+  802fab:	89 55 10             	mov    %edx,0x10(%ebp)
+  802fae:	83 ec 08             	sub    $0x8,%esp
+  802fb1:	53                   	push   %ebx
+  802fb2:	6a 30                	push   $0x30
+  802fb4:	ff d7                	call   *%edi
+			putch('x', putdat);
+  802fb6:	83 c4 08             	add    $0x8,%esp
+  802fb9:	53                   	push   %ebx
+  802fba:	6a 78                	push   $0x78
+  802fbc:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  802fbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc1:	8b 10                	mov    (%eax),%edx
+  802fc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  802fc8:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  802fcb:	8d 40 04             	lea    0x4(%eax),%eax
+  802fce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  802fd1:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  802fd6:	83 ec 0c             	sub    $0xc,%esp
+  802fd9:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  802fdd:	50                   	push   %eax
+  802fde:	ff 75 e4             	push   -0x1c(%ebp)
+  802fe1:	56                   	push   %esi
+  802fe2:	51                   	push   %ecx
+  802fe3:	52                   	push   %edx
+  802fe4:	89 da                	mov    %ebx,%edx
+  802fe6:	89 f8                	mov    %edi,%eax
+  802fe8:	e8 d8 fa ff ff       	call   802ac5 <printnum>
+			break;
+  802fed:	83 c4 20             	add    $0x20,%esp
+  802ff0:	e9 cc fb ff ff       	jmp    802bc1 <vprintfmt+0x11>
+	if (lflag >= 2)
+  802ff5:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  802ff8:	89 55 10             	mov    %edx,0x10(%ebp)
+  802ffb:	83 f9 01             	cmp    $0x1,%ecx
+  802ffe:	7f 1b                	jg     80301b <vprintfmt+0x46b>
+	else if (lflag)
+  803000:	85 c9                	test   %ecx,%ecx
+  803002:	74 2c                	je     803030 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  803004:	8b 45 14             	mov    0x14(%ebp),%eax
+  803007:	8b 10                	mov    (%eax),%edx
+  803009:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80300e:	8d 40 04             	lea    0x4(%eax),%eax
+  803011:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803014:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  803019:	eb bb                	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80301b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80301e:	8b 10                	mov    (%eax),%edx
+  803020:	8b 48 04             	mov    0x4(%eax),%ecx
+  803023:	8d 40 08             	lea    0x8(%eax),%eax
+  803026:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803029:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  80302e:	eb a6                	jmp    802fd6 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  803030:	8b 45 14             	mov    0x14(%ebp),%eax
+  803033:	8b 10                	mov    (%eax),%edx
+  803035:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80303a:	8d 40 04             	lea    0x4(%eax),%eax
+  80303d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  803040:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  803045:	eb 8f                	jmp    802fd6 <vprintfmt+0x426>
+			putch(ch, putdat);
+  803047:	89 55 10             	mov    %edx,0x10(%ebp)
+  80304a:	83 ec 08             	sub    $0x8,%esp
+  80304d:	53                   	push   %ebx
+  80304e:	6a 25                	push   $0x25
+  803050:	ff d7                	call   *%edi
+			break;
+  803052:	83 c4 10             	add    $0x10,%esp
+  803055:	e9 67 fb ff ff       	jmp    802bc1 <vprintfmt+0x11>
+			putch('%', putdat);
+  80305a:	83 ec 08             	sub    $0x8,%esp
+  80305d:	53                   	push   %ebx
+  80305e:	6a 25                	push   $0x25
+  803060:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803062:	83 c4 10             	add    $0x10,%esp
+  803065:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  803069:	0f 84 ba fb ff ff    	je     802c29 <vprintfmt+0x79>
+  80306f:	89 75 10             	mov    %esi,0x10(%ebp)
+  803072:	89 f0                	mov    %esi,%eax
+  803074:	83 e8 01             	sub    $0x1,%eax
+  803077:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80307b:	75 f7                	jne    803074 <vprintfmt+0x4c4>
+  80307d:	89 45 10             	mov    %eax,0x10(%ebp)
+  803080:	e9 3c fb ff ff       	jmp    802bc1 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  803085:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803088:	8d 70 01             	lea    0x1(%eax),%esi
+  80308b:	0f b6 00             	movzbl (%eax),%eax
+  80308e:	0f be d0             	movsbl %al,%edx
+  803091:	85 d2                	test   %edx,%edx
+  803093:	74 11                	je     8030a6 <vprintfmt+0x4f6>
+  803095:	89 7d 08             	mov    %edi,0x8(%ebp)
+  803098:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80309b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80309e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030a1:	e9 5d fd ff ff       	jmp    802e03 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8030a6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030ac:	e9 10 fb ff ff       	jmp    802bc1 <vprintfmt+0x11>
+  8030b1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8030b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8030b7:	e9 05 fb ff ff       	jmp    802bc1 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8030bc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8030c0:	7e 0a                	jle    8030cc <vprintfmt+0x51c>
+  8030c2:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8030c6:	0f 85 bd fc ff ff    	jne    802d89 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8030cc:	ba 28 00 00 00       	mov    $0x28,%edx
+  8030d1:	b8 28 00 00 00       	mov    $0x28,%eax
+  8030d6:	be 01 3c 80 00       	mov    $0x803c01,%esi
+  8030db:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8030de:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8030e1:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8030e4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8030e7:	e9 17 fd ff ff       	jmp    802e03 <vprintfmt+0x253>
+}
+  8030ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030ef:	5b                   	pop    %ebx
+  8030f0:	5e                   	pop    %esi
+  8030f1:	5f                   	pop    %edi
+  8030f2:	5d                   	pop    %ebp
+  8030f3:	c3                   	ret
+
+008030f4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8030f4:	55                   	push   %ebp
+  8030f5:	89 e5                	mov    %esp,%ebp
+  8030f7:	83 ec 18             	sub    $0x18,%esp
+  8030fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  803100:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  803103:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  803107:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80310a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  803111:	85 c0                	test   %eax,%eax
+  803113:	74 26                	je     80313b <vsnprintf+0x47>
+  803115:	85 d2                	test   %edx,%edx
+  803117:	7e 22                	jle    80313b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  803119:	ff 75 14             	push   0x14(%ebp)
+  80311c:	ff 75 10             	push   0x10(%ebp)
+  80311f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  803122:	50                   	push   %eax
+  803123:	68 76 2b 80 00       	push   $0x802b76
+  803128:	e8 83 fa ff ff       	call   802bb0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80312d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803130:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  803133:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803136:	83 c4 10             	add    $0x10,%esp
+}
+  803139:	c9                   	leave
+  80313a:	c3                   	ret
+		return -E_INVAL;
+  80313b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803140:	eb f7                	jmp    803139 <vsnprintf+0x45>
+
+00803142 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  803142:	55                   	push   %ebp
+  803143:	89 e5                	mov    %esp,%ebp
+  803145:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  803148:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80314b:	50                   	push   %eax
+  80314c:	ff 75 10             	push   0x10(%ebp)
+  80314f:	ff 75 0c             	push   0xc(%ebp)
+  803152:	ff 75 08             	push   0x8(%ebp)
+  803155:	e8 9a ff ff ff       	call   8030f4 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80315a:	c9                   	leave
+  80315b:	c3                   	ret
+
+0080315c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80315c:	55                   	push   %ebp
+  80315d:	89 e5                	mov    %esp,%ebp
+  80315f:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  803162:	80 3a 00             	cmpb   $0x0,(%edx)
+  803165:	74 10                	je     803177 <strlen+0x1b>
+  803167:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80316c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80316f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  803173:	75 f7                	jne    80316c <strlen+0x10>
+	return n;
+}
+  803175:	5d                   	pop    %ebp
+  803176:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  803177:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80317c:	eb f7                	jmp    803175 <strlen+0x19>
+
+0080317e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80317e:	55                   	push   %ebp
+  80317f:	89 e5                	mov    %esp,%ebp
+  803181:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803184:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803187:	85 d2                	test   %edx,%edx
+  803189:	74 16                	je     8031a1 <strnlen+0x23>
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803190:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  803194:	74 09                	je     80319f <strnlen+0x21>
+		n++;
+  803196:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  803199:	39 d0                	cmp    %edx,%eax
+  80319b:	75 f3                	jne    803190 <strnlen+0x12>
+		n++;
+  80319d:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80319f:	5d                   	pop    %ebp
+  8031a0:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8031a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a6:	eb f7                	jmp    80319f <strnlen+0x21>
+
+008031a8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8031a8:	55                   	push   %ebp
+  8031a9:	89 e5                	mov    %esp,%ebp
+  8031ab:	53                   	push   %ebx
+  8031ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8031b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8031bb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8031be:	83 c0 01             	add    $0x1,%eax
+  8031c1:	84 d2                	test   %dl,%dl
+  8031c3:	75 f2                	jne    8031b7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8031c5:	89 c8                	mov    %ecx,%eax
+  8031c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+
+008031cc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8031cc:	55                   	push   %ebp
+  8031cd:	89 e5                	mov    %esp,%ebp
+  8031cf:	53                   	push   %ebx
+  8031d0:	83 ec 10             	sub    $0x10,%esp
+  8031d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8031d6:	53                   	push   %ebx
+  8031d7:	e8 80 ff ff ff       	call   80315c <strlen>
+  8031dc:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8031df:	ff 75 0c             	push   0xc(%ebp)
+  8031e2:	01 d8                	add    %ebx,%eax
+  8031e4:	50                   	push   %eax
+  8031e5:	e8 be ff ff ff       	call   8031a8 <strcpy>
+	return dst;
+}
+  8031ea:	89 d8                	mov    %ebx,%eax
+  8031ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ef:	c9                   	leave
+  8031f0:	c3                   	ret
+
+008031f1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8031f1:	55                   	push   %ebp
+  8031f2:	89 e5                	mov    %esp,%ebp
+  8031f4:	56                   	push   %esi
+  8031f5:	53                   	push   %ebx
+  8031f6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8031fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8031ff:	85 db                	test   %ebx,%ebx
+  803201:	74 17                	je     80321a <strncpy+0x29>
+  803203:	01 f3                	add    %esi,%ebx
+  803205:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  803207:	83 c0 01             	add    $0x1,%eax
+  80320a:	0f b6 0a             	movzbl (%edx),%ecx
+  80320d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  803210:	80 f9 01             	cmp    $0x1,%cl
+  803213:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  803216:	39 c3                	cmp    %eax,%ebx
+  803218:	75 ed                	jne    803207 <strncpy+0x16>
+	}
+	return ret;
+}
+  80321a:	89 f0                	mov    %esi,%eax
+  80321c:	5b                   	pop    %ebx
+  80321d:	5e                   	pop    %esi
+  80321e:	5d                   	pop    %ebp
+  80321f:	c3                   	ret
+
+00803220 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+  803223:	56                   	push   %esi
+  803224:	53                   	push   %ebx
+  803225:	8b 75 08             	mov    0x8(%ebp),%esi
+  803228:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80322b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80322e:	89 f0                	mov    %esi,%eax
+  803230:	85 db                	test   %ebx,%ebx
+  803232:	74 1e                	je     803252 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  803234:	83 eb 01             	sub    $0x1,%ebx
+  803237:	74 16                	je     80324f <strlcpy+0x2f>
+  803239:	01 f3                	add    %esi,%ebx
+  80323b:	0f b6 0a             	movzbl (%edx),%ecx
+  80323e:	84 c9                	test   %cl,%cl
+  803240:	74 0d                	je     80324f <strlcpy+0x2f>
+			*dst++ = *src++;
+  803242:	83 c2 01             	add    $0x1,%edx
+  803245:	83 c0 01             	add    $0x1,%eax
+  803248:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80324b:	39 d8                	cmp    %ebx,%eax
+  80324d:	75 ec                	jne    80323b <strlcpy+0x1b>
+		*dst = '\0';
+  80324f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  803252:	29 f0                	sub    %esi,%eax
+}
+  803254:	5b                   	pop    %ebx
+  803255:	5e                   	pop    %esi
+  803256:	5d                   	pop    %ebp
+  803257:	c3                   	ret
+
+00803258 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80325e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  803261:	0f b6 01             	movzbl (%ecx),%eax
+  803264:	84 c0                	test   %al,%al
+  803266:	74 11                	je     803279 <strcmp+0x21>
+  803268:	38 02                	cmp    %al,(%edx)
+  80326a:	75 0d                	jne    803279 <strcmp+0x21>
+		p++, q++;
+  80326c:	83 c1 01             	add    $0x1,%ecx
+  80326f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  803272:	0f b6 01             	movzbl (%ecx),%eax
+  803275:	84 c0                	test   %al,%al
+  803277:	75 ef                	jne    803268 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  803279:	0f b6 c0             	movzbl %al,%eax
+  80327c:	0f b6 12             	movzbl (%edx),%edx
+  80327f:	29 d0                	sub    %edx,%eax
+}
+  803281:	5d                   	pop    %ebp
+  803282:	c3                   	ret
+
+00803283 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  803283:	55                   	push   %ebp
+  803284:	89 e5                	mov    %esp,%ebp
+  803286:	53                   	push   %ebx
+  803287:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80328a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80328d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  803290:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  803295:	85 d2                	test   %edx,%edx
+  803297:	74 2e                	je     8032c7 <strncmp+0x44>
+  803299:	0f b6 01             	movzbl (%ecx),%eax
+  80329c:	84 c0                	test   %al,%al
+  80329e:	74 16                	je     8032b6 <strncmp+0x33>
+  8032a0:	3a 03                	cmp    (%ebx),%al
+  8032a2:	75 12                	jne    8032b6 <strncmp+0x33>
+		n--, p++, q++;
+  8032a4:	83 c1 01             	add    $0x1,%ecx
+  8032a7:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8032aa:	83 ea 01             	sub    $0x1,%edx
+  8032ad:	75 ea                	jne    803299 <strncmp+0x16>
+		return 0;
+  8032af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b4:	eb 11                	jmp    8032c7 <strncmp+0x44>
+  8032b6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8032bb:	85 d2                	test   %edx,%edx
+  8032bd:	74 08                	je     8032c7 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8032bf:	0f b6 01             	movzbl (%ecx),%eax
+  8032c2:	0f b6 13             	movzbl (%ebx),%edx
+  8032c5:	29 d0                	sub    %edx,%eax
+}
+  8032c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032ca:	c9                   	leave
+  8032cb:	c3                   	ret
+
+008032cc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8032cc:	55                   	push   %ebp
+  8032cd:	89 e5                	mov    %esp,%ebp
+  8032cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032d2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8032d6:	0f b6 10             	movzbl (%eax),%edx
+  8032d9:	84 d2                	test   %dl,%dl
+  8032db:	74 15                	je     8032f2 <strchr+0x26>
+		if (*s == c)
+  8032dd:	38 d1                	cmp    %dl,%cl
+  8032df:	74 0f                	je     8032f0 <strchr+0x24>
+	for (; *s; s++)
+  8032e1:	83 c0 01             	add    $0x1,%eax
+  8032e4:	0f b6 10             	movzbl (%eax),%edx
+  8032e7:	84 d2                	test   %dl,%dl
+  8032e9:	75 f2                	jne    8032dd <strchr+0x11>
+			return (char *) s;
+	return 0;
+  8032eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f0:	5d                   	pop    %ebp
+  8032f1:	c3                   	ret
+	return 0;
+  8032f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f7:	eb f7                	jmp    8032f0 <strchr+0x24>
+
+008032f9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8032f9:	55                   	push   %ebp
+  8032fa:	89 e5                	mov    %esp,%ebp
+  8032fc:	53                   	push   %ebx
+  8032fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803300:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  803303:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  803306:	38 d3                	cmp    %dl,%bl
+  803308:	74 14                	je     80331e <strfind+0x25>
+  80330a:	89 d1                	mov    %edx,%ecx
+  80330c:	84 db                	test   %bl,%bl
+  80330e:	74 0e                	je     80331e <strfind+0x25>
+	for (; *s; s++)
+  803310:	83 c0 01             	add    $0x1,%eax
+  803313:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  803316:	38 ca                	cmp    %cl,%dl
+  803318:	74 04                	je     80331e <strfind+0x25>
+  80331a:	84 d2                	test   %dl,%dl
+  80331c:	75 f2                	jne    803310 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80331e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803321:	c9                   	leave
+  803322:	c3                   	ret
+
+00803323 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  803323:	55                   	push   %ebp
+  803324:	89 e5                	mov    %esp,%ebp
+  803326:	57                   	push   %edi
+  803327:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80332a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80332d:	85 c9                	test   %ecx,%ecx
+  80332f:	74 20                	je     803351 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  803331:	89 f8                	mov    %edi,%eax
+  803333:	09 c8                	or     %ecx,%eax
+  803335:	a8 03                	test   $0x3,%al
+  803337:	75 12                	jne    80334b <memset+0x28>
+		c &= 0xFF;
+  803339:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80333d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  803343:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  803346:	fc                   	cld
+  803347:	f3 ab                	rep stos %eax,%es:(%edi)
+  803349:	eb 06                	jmp    803351 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80334b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80334e:	fc                   	cld
+  80334f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  803351:	89 f8                	mov    %edi,%eax
+  803353:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  803356:	c9                   	leave
+  803357:	c3                   	ret
+
+00803358 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  803358:	55                   	push   %ebp
+  803359:	89 e5                	mov    %esp,%ebp
+  80335b:	57                   	push   %edi
+  80335c:	56                   	push   %esi
+  80335d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803360:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803363:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  803366:	39 c6                	cmp    %eax,%esi
+  803368:	73 32                	jae    80339c <memmove+0x44>
+  80336a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80336d:	39 d0                	cmp    %edx,%eax
+  80336f:	73 2b                	jae    80339c <memmove+0x44>
+		s += n;
+		d += n;
+  803371:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  803374:	89 d6                	mov    %edx,%esi
+  803376:	09 fe                	or     %edi,%esi
+  803378:	09 ce                	or     %ecx,%esi
+  80337a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  803380:	75 0e                	jne    803390 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  803382:	83 ef 04             	sub    $0x4,%edi
+  803385:	8d 72 fc             	lea    -0x4(%edx),%esi
+  803388:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  80338b:	fd                   	std
+  80338c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80338e:	eb 09                	jmp    803399 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  803390:	83 ef 01             	sub    $0x1,%edi
+  803393:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  803396:	fd                   	std
+  803397:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  803399:	fc                   	cld
+  80339a:	eb 1a                	jmp    8033b6 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80339c:	89 f2                	mov    %esi,%edx
+  80339e:	09 c2                	or     %eax,%edx
+  8033a0:	09 ca                	or     %ecx,%edx
+  8033a2:	f6 c2 03             	test   $0x3,%dl
+  8033a5:	75 0a                	jne    8033b1 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8033a7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8033aa:	89 c7                	mov    %eax,%edi
+  8033ac:	fc                   	cld
+  8033ad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8033af:	eb 05                	jmp    8033b6 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8033b1:	89 c7                	mov    %eax,%edi
+  8033b3:	fc                   	cld
+  8033b4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8033b6:	5e                   	pop    %esi
+  8033b7:	5f                   	pop    %edi
+  8033b8:	5d                   	pop    %ebp
+  8033b9:	c3                   	ret
+
+008033ba <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8033ba:	55                   	push   %ebp
+  8033bb:	89 e5                	mov    %esp,%ebp
+  8033bd:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8033c0:	ff 75 10             	push   0x10(%ebp)
+  8033c3:	ff 75 0c             	push   0xc(%ebp)
+  8033c6:	ff 75 08             	push   0x8(%ebp)
+  8033c9:	e8 8a ff ff ff       	call   803358 <memmove>
+}
+  8033ce:	c9                   	leave
+  8033cf:	c3                   	ret
+
+008033d0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8033d0:	55                   	push   %ebp
+  8033d1:	89 e5                	mov    %esp,%ebp
+  8033d3:	56                   	push   %esi
+  8033d4:	53                   	push   %ebx
+  8033d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033db:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8033de:	85 f6                	test   %esi,%esi
+  8033e0:	74 29                	je     80340b <memcmp+0x3b>
+  8033e2:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  8033e4:	0f b6 08             	movzbl (%eax),%ecx
+  8033e7:	0f b6 1a             	movzbl (%edx),%ebx
+  8033ea:	38 d9                	cmp    %bl,%cl
+  8033ec:	75 11                	jne    8033ff <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  8033ee:	83 c0 01             	add    $0x1,%eax
+  8033f1:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  8033f4:	39 c6                	cmp    %eax,%esi
+  8033f6:	75 ec                	jne    8033e4 <memcmp+0x14>
+	}
+
+	return 0;
+  8033f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fd:	eb 08                	jmp    803407 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  8033ff:	0f b6 c1             	movzbl %cl,%eax
+  803402:	0f b6 db             	movzbl %bl,%ebx
+  803405:	29 d8                	sub    %ebx,%eax
+}
+  803407:	5b                   	pop    %ebx
+  803408:	5e                   	pop    %esi
+  803409:	5d                   	pop    %ebp
+  80340a:	c3                   	ret
+	return 0;
+  80340b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803410:	eb f5                	jmp    803407 <memcmp+0x37>
+
+00803412 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  803412:	55                   	push   %ebp
+  803413:	89 e5                	mov    %esp,%ebp
+  803415:	8b 45 08             	mov    0x8(%ebp),%eax
+  803418:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80341b:	89 c2                	mov    %eax,%edx
+  80341d:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  803420:	39 d0                	cmp    %edx,%eax
+  803422:	73 0d                	jae    803431 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  803424:	38 08                	cmp    %cl,(%eax)
+  803426:	74 0d                	je     803435 <memfind+0x23>
+	for (; s < ends; s++)
+  803428:	83 c0 01             	add    $0x1,%eax
+  80342b:	39 c2                	cmp    %eax,%edx
+  80342d:	75 f5                	jne    803424 <memfind+0x12>
+  80342f:	eb 06                	jmp    803437 <memfind+0x25>
+  803431:	89 c2                	mov    %eax,%edx
+  803433:	eb 02                	jmp    803437 <memfind+0x25>
+  803435:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  803437:	89 d0                	mov    %edx,%eax
+  803439:	5d                   	pop    %ebp
+  80343a:	c3                   	ret
+
+0080343b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80343b:	55                   	push   %ebp
+  80343c:	89 e5                	mov    %esp,%ebp
+  80343e:	57                   	push   %edi
+  80343f:	56                   	push   %esi
+  803440:	53                   	push   %ebx
+  803441:	8b 55 08             	mov    0x8(%ebp),%edx
+  803444:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  803447:	0f b6 02             	movzbl (%edx),%eax
+  80344a:	3c 20                	cmp    $0x20,%al
+  80344c:	74 04                	je     803452 <strtol+0x17>
+  80344e:	3c 09                	cmp    $0x9,%al
+  803450:	75 0e                	jne    803460 <strtol+0x25>
+		s++;
+  803452:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  803455:	0f b6 02             	movzbl (%edx),%eax
+  803458:	3c 20                	cmp    $0x20,%al
+  80345a:	74 f6                	je     803452 <strtol+0x17>
+  80345c:	3c 09                	cmp    $0x9,%al
+  80345e:	74 f2                	je     803452 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  803460:	3c 2b                	cmp    $0x2b,%al
+  803462:	74 2a                	je     80348e <strtol+0x53>
+	int neg = 0;
+  803464:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  803469:	3c 2d                	cmp    $0x2d,%al
+  80346b:	74 2b                	je     803498 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80346d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  803473:	75 0f                	jne    803484 <strtol+0x49>
+  803475:	80 3a 30             	cmpb   $0x30,(%edx)
+  803478:	74 28                	je     8034a2 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80347a:	85 db                	test   %ebx,%ebx
+  80347c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803481:	0f 44 d8             	cmove  %eax,%ebx
+  803484:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803489:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80348c:	eb 46                	jmp    8034d4 <strtol+0x99>
+		s++;
+  80348e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  803491:	bf 00 00 00 00       	mov    $0x0,%edi
+  803496:	eb d5                	jmp    80346d <strtol+0x32>
+		s++, neg = 1;
+  803498:	83 c2 01             	add    $0x1,%edx
+  80349b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034a0:	eb cb                	jmp    80346d <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8034a2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8034a6:	74 0e                	je     8034b6 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8034a8:	85 db                	test   %ebx,%ebx
+  8034aa:	75 d8                	jne    803484 <strtol+0x49>
+		s++, base = 8;
+  8034ac:	83 c2 01             	add    $0x1,%edx
+  8034af:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8034b4:	eb ce                	jmp    803484 <strtol+0x49>
+		s += 2, base = 16;
+  8034b6:	83 c2 02             	add    $0x2,%edx
+  8034b9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8034be:	eb c4                	jmp    803484 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8034c0:	0f be c0             	movsbl %al,%eax
+  8034c3:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8034c6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034c9:	7d 3a                	jge    803505 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8034cb:	83 c2 01             	add    $0x1,%edx
+  8034ce:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8034d2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8034d4:	0f b6 02             	movzbl (%edx),%eax
+  8034d7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8034da:	89 f3                	mov    %esi,%ebx
+  8034dc:	80 fb 09             	cmp    $0x9,%bl
+  8034df:	76 df                	jbe    8034c0 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8034e1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8034e4:	89 f3                	mov    %esi,%ebx
+  8034e6:	80 fb 19             	cmp    $0x19,%bl
+  8034e9:	77 08                	ja     8034f3 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8034eb:	0f be c0             	movsbl %al,%eax
+  8034ee:	83 e8 57             	sub    $0x57,%eax
+  8034f1:	eb d3                	jmp    8034c6 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8034f3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8034f6:	89 f3                	mov    %esi,%ebx
+  8034f8:	80 fb 19             	cmp    $0x19,%bl
+  8034fb:	77 08                	ja     803505 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8034fd:	0f be c0             	movsbl %al,%eax
+  803500:	83 e8 37             	sub    $0x37,%eax
+  803503:	eb c1                	jmp    8034c6 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  803505:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803509:	74 05                	je     803510 <strtol+0xd5>
+		*endptr = (char *) s;
+  80350b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80350e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  803510:	89 c8                	mov    %ecx,%eax
+  803512:	f7 d8                	neg    %eax
+  803514:	85 ff                	test   %edi,%edi
+  803516:	0f 45 c8             	cmovne %eax,%ecx
+}
+  803519:	89 c8                	mov    %ecx,%eax
+  80351b:	5b                   	pop    %ebx
+  80351c:	5e                   	pop    %esi
+  80351d:	5f                   	pop    %edi
+  80351e:	5d                   	pop    %ebp
+  80351f:	c3                   	ret
+
+00803520 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803520:	55                   	push   %ebp
+  803521:	89 e5                	mov    %esp,%ebp
+  803523:	56                   	push   %esi
+  803524:	53                   	push   %ebx
+  803525:	8b 75 08             	mov    0x8(%ebp),%esi
+  803528:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80352b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80352e:	85 c0                	test   %eax,%eax
+  803530:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803535:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803538:	83 ec 0c             	sub    $0xc,%esp
+  80353b:	50                   	push   %eax
+  80353c:	e8 0a ce ff ff       	call   80034b <sys_ipc_recv>
+  803541:	83 c4 10             	add    $0x10,%esp
+  803544:	85 c0                	test   %eax,%eax
+  803546:	0f 88 8b 00 00 00    	js     8035d7 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80354c:	85 f6                	test   %esi,%esi
+  80354e:	74 2a                	je     80357a <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803550:	89 e2                	mov    %esp,%edx
+  803552:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803557:	29 d0                	sub    %edx,%eax
+  803559:	89 c2                	mov    %eax,%edx
+  80355b:	c1 ea 0f             	shr    $0xf,%edx
+  80355e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803563:	b8 00 00 00 00       	mov    $0x0,%eax
+  803568:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80356b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803572:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803578:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80357a:	85 db                	test   %ebx,%ebx
+  80357c:	74 2a                	je     8035a8 <ipc_recv+0x88>
+  80357e:	89 e2                	mov    %esp,%edx
+  803580:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803585:	29 d0                	sub    %edx,%eax
+  803587:	89 c2                	mov    %eax,%edx
+  803589:	c1 ea 0f             	shr    $0xf,%edx
+  80358c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803591:	b8 00 00 00 00       	mov    $0x0,%eax
+  803596:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803599:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035a0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8035a6:	89 03                	mov    %eax,(%ebx)
+  8035a8:	89 e2                	mov    %esp,%edx
+  8035aa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035af:	29 d0                	sub    %edx,%eax
+  8035b1:	89 c2                	mov    %eax,%edx
+  8035b3:	c1 ea 0f             	shr    $0xf,%edx
+  8035b6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8035bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8035c3:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8035ca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8035d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035d3:	5b                   	pop    %ebx
+  8035d4:	5e                   	pop    %esi
+  8035d5:	5d                   	pop    %ebp
+  8035d6:	c3                   	ret
+		if(from_env_store != NULL)
+  8035d7:	85 f6                	test   %esi,%esi
+  8035d9:	74 06                	je     8035e1 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8035db:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8035e1:	85 db                	test   %ebx,%ebx
+  8035e3:	74 eb                	je     8035d0 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8035e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8035eb:	eb e3                	jmp    8035d0 <ipc_recv+0xb0>
+
+008035ed <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8035ed:	55                   	push   %ebp
+  8035ee:	89 e5                	mov    %esp,%ebp
+  8035f0:	57                   	push   %edi
+  8035f1:	56                   	push   %esi
+  8035f2:	53                   	push   %ebx
+  8035f3:	83 ec 14             	sub    $0x14,%esp
+  8035f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035fc:	8b 75 14             	mov    0x14(%ebp),%esi
+  8035ff:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803602:	85 c0                	test   %eax,%eax
+  803604:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803609:	0f 44 c2             	cmove  %edx,%eax
+  80360c:	ff 75 10             	push   0x10(%ebp)
+  80360f:	50                   	push   %eax
+  803610:	e8 98 cd ff ff       	call   8003ad <sys_ipc_recv_pages>
+  803615:	83 c4 10             	add    $0x10,%esp
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	0f 88 ba 00 00 00    	js     8036da <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  803620:	85 ff                	test   %edi,%edi
+  803622:	74 2a                	je     80364e <ipc_recv_pages+0x61>
+  803624:	89 e2                	mov    %esp,%edx
+  803626:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80362b:	29 d0                	sub    %edx,%eax
+  80362d:	89 c2                	mov    %eax,%edx
+  80362f:	c1 ea 0f             	shr    $0xf,%edx
+  803632:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80363f:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803646:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80364c:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80364e:	85 f6                	test   %esi,%esi
+  803650:	74 2a                	je     80367c <ipc_recv_pages+0x8f>
+  803652:	89 e2                	mov    %esp,%edx
+  803654:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803659:	29 d0                	sub    %edx,%eax
+  80365b:	89 c2                	mov    %eax,%edx
+  80365d:	c1 ea 0f             	shr    $0xf,%edx
+  803660:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80366d:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803674:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80367a:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80367c:	85 db                	test   %ebx,%ebx
+  80367e:	74 2a                	je     8036aa <ipc_recv_pages+0xbd>
+  803680:	89 e2                	mov    %esp,%edx
+  803682:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803687:	29 d0                	sub    %edx,%eax
+  803689:	89 c2                	mov    %eax,%edx
+  80368b:	c1 ea 0f             	shr    $0xf,%edx
+  80368e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803693:	b8 00 00 00 00       	mov    $0x0,%eax
+  803698:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80369b:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036a2:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8036a8:	89 03                	mov    %eax,(%ebx)
+  8036aa:	89 e2                	mov    %esp,%edx
+  8036ac:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036b1:	29 d0                	sub    %edx,%eax
+  8036b3:	89 c2                	mov    %eax,%edx
+  8036b5:	c1 ea 0f             	shr    $0xf,%edx
+  8036b8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8036c5:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  8036cc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8036d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d5:	5b                   	pop    %ebx
+  8036d6:	5e                   	pop    %esi
+  8036d7:	5f                   	pop    %edi
+  8036d8:	5d                   	pop    %ebp
+  8036d9:	c3                   	ret
+		if (from_env_store)
+  8036da:	85 ff                	test   %edi,%edi
+  8036dc:	74 06                	je     8036e4 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8036de:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8036e4:	85 f6                	test   %esi,%esi
+  8036e6:	74 06                	je     8036ee <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8036e8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8036ee:	85 db                	test   %ebx,%ebx
+  8036f0:	74 e0                	je     8036d2 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8036f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036f8:	eb d8                	jmp    8036d2 <ipc_recv_pages+0xe5>
+
+008036fa <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8036fa:	55                   	push   %ebp
+  8036fb:	89 e5                	mov    %esp,%ebp
+  8036fd:	57                   	push   %edi
+  8036fe:	56                   	push   %esi
+  8036ff:	53                   	push   %ebx
+  803700:	83 ec 1c             	sub    $0x1c,%esp
+  803703:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  803706:	8b 75 08             	mov    0x8(%ebp),%esi
+  803709:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80370f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803713:	75 2b                	jne    803740 <ipc_try_send_pages+0x46>
+  803715:	89 e2                	mov    %esp,%edx
+  803717:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80371c:	29 d0                	sub    %edx,%eax
+  80371e:	89 c2                	mov    %eax,%edx
+  803720:	c1 ea 0f             	shr    $0xf,%edx
+  803723:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372d:	0f 42 c2             	cmovb  %edx,%eax
+  803730:	8b 04 85 40 53 80 00 	mov    0x805340(,%eax,4),%eax
+  803737:	8b 70 48             	mov    0x48(%eax),%esi
+  80373a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803740:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803746:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80374b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80374e:	85 ff                	test   %edi,%edi
+  803750:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803755:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803758:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80375e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803764:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80376a:	83 ec 0c             	sub    $0xc,%esp
+  80376d:	ff 75 14             	push   0x14(%ebp)
+  803770:	ff 75 18             	push   0x18(%ebp)
+  803773:	57                   	push   %edi
+  803774:	ff 75 0c             	push   0xc(%ebp)
+  803777:	ff 75 08             	push   0x8(%ebp)
+  80377a:	e8 0d cc ff ff       	call   80038c <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80377f:	83 c4 20             	add    $0x20,%esp
+  803782:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803785:	75 21                	jne    8037a8 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803787:	83 ec 04             	sub    $0x4,%esp
+  80378a:	6a ff                	push   $0xffffffff
+  80378c:	53                   	push   %ebx
+  80378d:	ff 75 e4             	push   -0x1c(%ebp)
+  803790:	e8 04 ce ff ff       	call   800599 <sys_futex_wait>
+  803795:	83 c4 10             	add    $0x10,%esp
+  803798:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80379b:	74 c7                	je     803764 <ipc_try_send_pages+0x6a>
+  80379d:	85 c0                	test   %eax,%eax
+  80379f:	79 c3                	jns    803764 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8037a1:	e8 d6 c9 ff ff       	call   80017c <sys_yield>
+  8037a6:	eb bc                	jmp    803764 <ipc_try_send_pages+0x6a>
+	}
+}
+  8037a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037ab:	5b                   	pop    %ebx
+  8037ac:	5e                   	pop    %esi
+  8037ad:	5f                   	pop    %edi
+  8037ae:	5d                   	pop    %ebp
+  8037af:	c3                   	ret
+
+008037b0 <ipc_send>:
+{
+  8037b0:	55                   	push   %ebp
+  8037b1:	89 e5                	mov    %esp,%ebp
+  8037b3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8037b6:	ff 75 14             	push   0x14(%ebp)
+  8037b9:	6a 01                	push   $0x1
+  8037bb:	ff 75 10             	push   0x10(%ebp)
+  8037be:	ff 75 0c             	push   0xc(%ebp)
+  8037c1:	ff 75 08             	push   0x8(%ebp)
+  8037c4:	e8 31 ff ff ff       	call   8036fa <ipc_try_send_pages>
+  8037c9:	83 c4 20             	add    $0x20,%esp
+  8037cc:	85 c0                	test   %eax,%eax
+  8037ce:	78 02                	js     8037d2 <ipc_send+0x22>
+}
+  8037d0:	c9                   	leave
+  8037d1:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8037d2:	50                   	push   %eax
+  8037d3:	68 2b 3f 80 00       	push   $0x803f2b
+  8037d8:	6a 3f                	push   $0x3f
+  8037da:	68 40 3f 80 00       	push   $0x803f40
+  8037df:	e8 f2 f1 ff ff       	call   8029d6 <_panic>
+
+008037e4 <ipc_send_pages>:
+{
+  8037e4:	55                   	push   %ebp
+  8037e5:	89 e5                	mov    %esp,%ebp
+  8037e7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8037ea:	ff 75 18             	push   0x18(%ebp)
+  8037ed:	ff 75 14             	push   0x14(%ebp)
+  8037f0:	ff 75 10             	push   0x10(%ebp)
+  8037f3:	ff 75 0c             	push   0xc(%ebp)
+  8037f6:	ff 75 08             	push   0x8(%ebp)
+  8037f9:	e8 fc fe ff ff       	call   8036fa <ipc_try_send_pages>
+  8037fe:	83 c4 20             	add    $0x20,%esp
+  803801:	85 c0                	test   %eax,%eax
+  803803:	78 02                	js     803807 <ipc_send_pages+0x23>
+}
+  803805:	c9                   	leave
+  803806:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803807:	50                   	push   %eax
+  803808:	68 4a 3f 80 00       	push   $0x803f4a
+  80380d:	6a 64                	push   $0x64
+  80380f:	68 40 3f 80 00       	push   $0x803f40
+  803814:	e8 bd f1 ff ff       	call   8029d6 <_panic>
+
+00803819 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803819:	55                   	push   %ebp
+  80381a:	89 e5                	mov    %esp,%ebp
+  80381c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80381f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803824:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80382a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803830:	8b 52 50             	mov    0x50(%edx),%edx
+  803833:	39 ca                	cmp    %ecx,%edx
+  803835:	74 11                	je     803848 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803837:	83 c0 01             	add    $0x1,%eax
+  80383a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80383f:	75 e3                	jne    803824 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803841:	b8 00 00 00 00       	mov    $0x0,%eax
+  803846:	eb 0e                	jmp    803856 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803848:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80384e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803853:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803856:	5d                   	pop    %ebp
+  803857:	c3                   	ret
+
+00803858 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803858:	55                   	push   %ebp
+  803859:	89 e5                	mov    %esp,%ebp
+  80385b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80385e:	89 c2                	mov    %eax,%edx
+  803860:	c1 ea 16             	shr    $0x16,%edx
+  803863:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80386a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80386f:	f6 c1 01             	test   $0x1,%cl
+  803872:	74 1e                	je     803892 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803874:	c1 e8 0c             	shr    $0xc,%eax
+  803877:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80387e:	a8 01                	test   $0x1,%al
+  803880:	74 10                	je     803892 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803882:	c1 e8 0c             	shr    $0xc,%eax
+  803885:	c1 e0 04             	shl    $0x4,%eax
+  803888:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80388f:	0f b7 d2             	movzwl %dx,%edx
+}
+  803892:	89 d0                	mov    %edx,%eax
+  803894:	5d                   	pop    %ebp
+  803895:	c3                   	ret
+
+00803896 <__udivdi3>:
+  803896:	57                   	push   %edi
+  803897:	56                   	push   %esi
+  803898:	53                   	push   %ebx
+  803899:	83 ec 20             	sub    $0x20,%esp
+  80389c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8038a0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8038a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8038a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8038ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8038b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8038bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038cb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8038d2:	00 
+  8038d3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8038da:	00 
+  8038db:	eb 08                	jmp    8038e5 <__udivdi3+0x4f>
+  8038dd:	83 e9 01             	sub    $0x1,%ecx
+  8038e0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8038e3:	74 68                	je     80394d <__udivdi3+0xb7>
+  8038e5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8038e9:	01 c0                	add    %eax,%eax
+  8038eb:	89 c6                	mov    %eax,%esi
+  8038ed:	89 d7                	mov    %edx,%edi
+  8038ef:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038f3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038f7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8038fa:	d3 ea                	shr    %cl,%edx
+  8038fc:	f6 c1 20             	test   $0x20,%cl
+  8038ff:	74 04                	je     803905 <__udivdi3+0x6f>
+  803901:	89 d0                	mov    %edx,%eax
+  803903:	31 d2                	xor    %edx,%edx
+  803905:	83 e0 01             	and    $0x1,%eax
+  803908:	89 04 24             	mov    %eax,(%esp)
+  80390b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803912:	00 
+  803913:	8b 04 24             	mov    (%esp),%eax
+  803916:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80391a:	09 f0                	or     %esi,%eax
+  80391c:	09 fa                	or     %edi,%edx
+  80391e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803922:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803926:	39 f0                	cmp    %esi,%eax
+  803928:	89 d3                	mov    %edx,%ebx
+  80392a:	19 fb                	sbb    %edi,%ebx
+  80392c:	72 af                	jb     8038dd <__udivdi3+0x47>
+  80392e:	29 f0                	sub    %esi,%eax
+  803930:	19 fa                	sbb    %edi,%edx
+  803932:	89 cf                	mov    %ecx,%edi
+  803934:	c1 ef 05             	shr    $0x5,%edi
+  803937:	83 e7 01             	and    $0x1,%edi
+  80393a:	89 fe                	mov    %edi,%esi
+  80393c:	83 f6 01             	xor    $0x1,%esi
+  80393f:	d3 e6                	shl    %cl,%esi
+  803941:	d3 e7                	shl    %cl,%edi
+  803943:	09 74 24 18          	or     %esi,0x18(%esp)
+  803947:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80394b:	eb 90                	jmp    8038dd <__udivdi3+0x47>
+  80394d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803951:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803955:	83 c4 20             	add    $0x20,%esp
+  803958:	5b                   	pop    %ebx
+  803959:	5e                   	pop    %esi
+  80395a:	5f                   	pop    %edi
+  80395b:	c3                   	ret
+
+0080395c <__umoddi3>:
+  80395c:	57                   	push   %edi
+  80395d:	56                   	push   %esi
+  80395e:	53                   	push   %ebx
+  80395f:	83 ec 08             	sub    $0x8,%esp
+  803962:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803966:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80396a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80396e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803972:	57                   	push   %edi
+  803973:	56                   	push   %esi
+  803974:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803978:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80397c:	52                   	push   %edx
+  80397d:	50                   	push   %eax
+  80397e:	e8 13 ff ff ff       	call   803896 <__udivdi3>
+  803983:	89 c3                	mov    %eax,%ebx
+  803985:	0f af d6             	imul   %esi,%edx
+  803988:	89 f9                	mov    %edi,%ecx
+  80398a:	0f af cb             	imul   %ebx,%ecx
+  80398d:	01 d1                	add    %edx,%ecx
+  80398f:	89 d8                	mov    %ebx,%eax
+  803991:	f7 e6                	mul    %esi
+  803993:	89 c6                	mov    %eax,%esi
+  803995:	89 d7                	mov    %edx,%edi
+  803997:	01 cf                	add    %ecx,%edi
+  803999:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80399d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8039a1:	29 f0                	sub    %esi,%eax
+  8039a3:	19 fa                	sbb    %edi,%edx
+  8039a5:	83 c4 18             	add    $0x18,%esp
+  8039a8:	5b                   	pop    %ebx
+  8039a9:	5e                   	pop    %esi
+  8039aa:	5f                   	pop    %edi
+  8039ab:	c3                   	ret
+
+008039ac <__divdi3>:
+  8039ac:	53                   	push   %ebx
+  8039ad:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039b5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8039b9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8039bd:	85 d2                	test   %edx,%edx
+  8039bf:	78 12                	js     8039d3 <__divdi3+0x27>
+  8039c1:	85 db                	test   %ebx,%ebx
+  8039c3:	78 2e                	js     8039f3 <__divdi3+0x47>
+  8039c5:	53                   	push   %ebx
+  8039c6:	51                   	push   %ecx
+  8039c7:	52                   	push   %edx
+  8039c8:	50                   	push   %eax
+  8039c9:	e8 c8 fe ff ff       	call   803896 <__udivdi3>
+  8039ce:	83 c4 10             	add    $0x10,%esp
+  8039d1:	eb 1e                	jmp    8039f1 <__divdi3+0x45>
+  8039d3:	f7 d8                	neg    %eax
+  8039d5:	83 d2 00             	adc    $0x0,%edx
+  8039d8:	f7 da                	neg    %edx
+  8039da:	85 db                	test   %ebx,%ebx
+  8039dc:	78 2a                	js     803a08 <__divdi3+0x5c>
+  8039de:	53                   	push   %ebx
+  8039df:	51                   	push   %ecx
+  8039e0:	52                   	push   %edx
+  8039e1:	50                   	push   %eax
+  8039e2:	e8 af fe ff ff       	call   803896 <__udivdi3>
+  8039e7:	83 c4 10             	add    $0x10,%esp
+  8039ea:	f7 d8                	neg    %eax
+  8039ec:	83 d2 00             	adc    $0x0,%edx
+  8039ef:	f7 da                	neg    %edx
+  8039f1:	5b                   	pop    %ebx
+  8039f2:	c3                   	ret
+  8039f3:	f7 d9                	neg    %ecx
+  8039f5:	83 d3 00             	adc    $0x0,%ebx
+  8039f8:	f7 db                	neg    %ebx
+  8039fa:	53                   	push   %ebx
+  8039fb:	51                   	push   %ecx
+  8039fc:	52                   	push   %edx
+  8039fd:	50                   	push   %eax
+  8039fe:	e8 93 fe ff ff       	call   803896 <__udivdi3>
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	eb e2                	jmp    8039ea <__divdi3+0x3e>
+  803a08:	f7 d9                	neg    %ecx
+  803a0a:	83 d3 00             	adc    $0x0,%ebx
+  803a0d:	f7 db                	neg    %ebx
+  803a0f:	53                   	push   %ebx
+  803a10:	51                   	push   %ecx
+  803a11:	52                   	push   %edx
+  803a12:	50                   	push   %eax
+  803a13:	e8 7e fe ff ff       	call   803896 <__udivdi3>
+  803a18:	83 c4 10             	add    $0x10,%esp
+  803a1b:	eb d4                	jmp    8039f1 <__divdi3+0x45>
+
+00803a1d <__moddi3>:
+  803a1d:	57                   	push   %edi
+  803a1e:	56                   	push   %esi
+  803a1f:	53                   	push   %ebx
+  803a20:	83 ec 08             	sub    $0x8,%esp
+  803a23:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a27:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a2b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a2f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a33:	57                   	push   %edi
+  803a34:	56                   	push   %esi
+  803a35:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a39:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a3d:	52                   	push   %edx
+  803a3e:	50                   	push   %eax
+  803a3f:	e8 68 ff ff ff       	call   8039ac <__divdi3>
+  803a44:	89 c3                	mov    %eax,%ebx
+  803a46:	0f af d6             	imul   %esi,%edx
+  803a49:	89 f9                	mov    %edi,%ecx
+  803a4b:	0f af cb             	imul   %ebx,%ecx
+  803a4e:	01 d1                	add    %edx,%ecx
+  803a50:	89 d8                	mov    %ebx,%eax
+  803a52:	f7 e6                	mul    %esi
+  803a54:	89 c6                	mov    %eax,%esi
+  803a56:	89 d7                	mov    %edx,%edi
+  803a58:	01 cf                	add    %ecx,%edi
+  803a5a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a5e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a62:	29 f0                	sub    %esi,%eax
+  803a64:	19 fa                	sbb    %edi,%edx
+  803a66:	83 c4 18             	add    $0x18,%esp
+  803a69:	5b                   	pop    %ebx
+  803a6a:	5e                   	pop    %esi
+  803a6b:	5f                   	pop    %edi
+  803a6c:	c3                   	ret
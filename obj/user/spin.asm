@@ -0,0 +1,9012 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 86 00 00 00       	call   8000b7 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 10             	sub    $0x10,%esp
+	envid_t env;
+
+	cprintf("I am the parent.  Forking the child...\n");
+  80003c:	68 60 44 80 00       	push   $0x804460
+  800041:	e8 ad 01 00 00       	call   8001f3 <cprintf>
+	if ((env = fork()) == 0) {
+  800046:	e8 db 12 00 00       	call   801326 <fork>
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	85 c0                	test   %eax,%eax
+  800050:	75 12                	jne    800064 <umain+0x2f>
+		cprintf("I am the child.  Spinning...\n");
+  800052:	83 ec 0c             	sub    $0xc,%esp
+  800055:	68 d8 44 80 00       	push   $0x8044d8
+  80005a:	e8 94 01 00 00       	call   8001f3 <cprintf>
+  80005f:	83 c4 10             	add    $0x10,%esp
+		while (1)
+  800062:	eb fe                	jmp    800062 <umain+0x2d>
+  800064:	89 c3                	mov    %eax,%ebx
+			/* do nothing */;
+	}
+
+	cprintf("I am the parent.  Running the child...\n");
+  800066:	83 ec 0c             	sub    $0xc,%esp
+  800069:	68 88 44 80 00       	push   $0x804488
+  80006e:	e8 80 01 00 00       	call   8001f3 <cprintf>
+	sys_yield();
+  800073:	e8 87 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  800078:	e8 82 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  80007d:	e8 7d 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  800082:	e8 78 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  800087:	e8 73 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  80008c:	e8 6e 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  800091:	e8 69 0c 00 00       	call   800cff <sys_yield>
+	sys_yield();
+  800096:	e8 64 0c 00 00       	call   800cff <sys_yield>
+
+	cprintf("I am the parent.  Killing the child...\n");
+  80009b:	c7 04 24 b0 44 80 00 	movl   $0x8044b0,(%esp)
+  8000a2:	e8 4c 01 00 00       	call   8001f3 <cprintf>
+	sys_env_destroy(env);
+  8000a7:	89 1c 24             	mov    %ebx,(%esp)
+  8000aa:	e8 f0 0b 00 00       	call   800c9f <sys_env_destroy>
+}
+  8000af:	83 c4 10             	add    $0x10,%esp
+  8000b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	56                   	push   %esi
+  8000bb:	53                   	push   %ebx
+  8000bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000c2:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000c9:	29 d0                	sub    %edx,%eax
+  8000cb:	89 c2                	mov    %eax,%edx
+  8000cd:	c1 ea 0f             	shr    $0xf,%edx
+  8000d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000da:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8000dd:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8000e4:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8000e8:	e8 f3 0b 00 00       	call   800ce0 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8000ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f2:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8000f8:	89 e1                	mov    %esp,%ecx
+  8000fa:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8000ff:	29 ca                	sub    %ecx,%edx
+  800101:	89 d1                	mov    %edx,%ecx
+  800103:	c1 e9 0f             	shr    $0xf,%ecx
+  800106:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80010c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800111:	0f 42 d1             	cmovb  %ecx,%edx
+  800114:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800119:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800120:	85 db                	test   %ebx,%ebx
+  800122:	7e 07                	jle    80012b <libmain+0x74>
+		binaryname = argv[0];
+  800124:	8b 06                	mov    (%esi),%eax
+  800126:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80012b:	83 ec 08             	sub    $0x8,%esp
+  80012e:	56                   	push   %esi
+  80012f:	53                   	push   %ebx
+  800130:	e8 00 ff ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800135:	e8 0a 00 00 00       	call   800144 <exit>
+}
+  80013a:	83 c4 10             	add    $0x10,%esp
+  80013d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800140:	5b                   	pop    %ebx
+  800141:	5e                   	pop    %esi
+  800142:	5d                   	pop    %ebp
+  800143:	c3                   	ret
+
+00800144 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80014a:	e8 97 19 00 00       	call   801ae6 <close_all>
+	sys_env_destroy(0);
+  80014f:	83 ec 0c             	sub    $0xc,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	e8 46 0b 00 00       	call   800c9f <sys_env_destroy>
+}
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	c9                   	leave
+  80015d:	c3                   	ret
+
+0080015e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	53                   	push   %ebx
+  800162:	83 ec 04             	sub    $0x4,%esp
+  800165:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800168:	8b 13                	mov    (%ebx),%edx
+  80016a:	8d 42 01             	lea    0x1(%edx),%eax
+  80016d:	89 03                	mov    %eax,(%ebx)
+  80016f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800172:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800176:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80017b:	74 09                	je     800186 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80017d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800184:	c9                   	leave
+  800185:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800186:	83 ec 08             	sub    $0x8,%esp
+  800189:	68 ff 00 00 00       	push   $0xff
+  80018e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800191:	50                   	push   %eax
+  800192:	e8 cb 0a 00 00       	call   800c62 <sys_cputs>
+		b->idx = 0;
+  800197:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	eb db                	jmp    80017d <putch+0x1f>
+
+008001a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ab:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001b2:	00 00 00 
+	b.cnt = 0;
+  8001b5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001bc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8001bf:	ff 75 0c             	push   0xc(%ebp)
+  8001c2:	ff 75 08             	push   0x8(%ebp)
+  8001c5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001cb:	50                   	push   %eax
+  8001cc:	68 5e 01 80 00       	push   $0x80015e
+  8001d1:	e8 1c 01 00 00       	call   8002f2 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8001d6:	83 c4 08             	add    $0x8,%esp
+  8001d9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001df:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	e8 77 0a 00 00       	call   800c62 <sys_cputs>
+
+	return b.cnt;
+}
+  8001eb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001f3:	55                   	push   %ebp
+  8001f4:	89 e5                	mov    %esp,%ebp
+  8001f6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8001f9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8001fc:	50                   	push   %eax
+  8001fd:	ff 75 08             	push   0x8(%ebp)
+  800200:	e8 9d ff ff ff       	call   8001a2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800205:	c9                   	leave
+  800206:	c3                   	ret
+
+00800207 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	57                   	push   %edi
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	83 ec 1c             	sub    $0x1c,%esp
+  800210:	89 c3                	mov    %eax,%ebx
+  800212:	89 d6                	mov    %edx,%esi
+  800214:	8b 45 08             	mov    0x8(%ebp),%eax
+  800217:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80021a:	89 d1                	mov    %edx,%ecx
+  80021c:	89 c2                	mov    %eax,%edx
+  80021e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800221:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800224:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800227:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80022a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800231:	39 c2                	cmp    %eax,%edx
+  800233:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800236:	73 4b                	jae    800283 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800238:	8b 45 14             	mov    0x14(%ebp),%eax
+  80023b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80023e:	85 ff                	test   %edi,%edi
+  800240:	7e 11                	jle    800253 <printnum+0x4c>
+			putch(padc, putdat);
+  800242:	83 ec 08             	sub    $0x8,%esp
+  800245:	56                   	push   %esi
+  800246:	ff 75 18             	push   0x18(%ebp)
+  800249:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	83 ef 01             	sub    $0x1,%edi
+  800251:	75 ef                	jne    800242 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800253:	83 ec 08             	sub    $0x8,%esp
+  800256:	56                   	push   %esi
+  800257:	83 ec 04             	sub    $0x4,%esp
+  80025a:	ff 75 e4             	push   -0x1c(%ebp)
+  80025d:	ff 75 e0             	push   -0x20(%ebp)
+  800260:	ff 75 dc             	push   -0x24(%ebp)
+  800263:	ff 75 d8             	push   -0x28(%ebp)
+  800266:	e8 d3 40 00 00       	call   80433e <__umoddi3>
+  80026b:	83 c4 14             	add    $0x14,%esp
+  80026e:	0f be 80 00 45 80 00 	movsbl 0x804500(%eax),%eax
+  800275:	50                   	push   %eax
+  800276:	ff d3                	call   *%ebx
+}
+  800278:	83 c4 10             	add    $0x10,%esp
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 18             	push   0x18(%ebp)
+  800289:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80028c:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80028f:	52                   	push   %edx
+  800290:	50                   	push   %eax
+  800291:	83 ec 08             	sub    $0x8,%esp
+  800294:	ff 75 e4             	push   -0x1c(%ebp)
+  800297:	ff 75 e0             	push   -0x20(%ebp)
+  80029a:	ff 75 dc             	push   -0x24(%ebp)
+  80029d:	ff 75 d8             	push   -0x28(%ebp)
+  8002a0:	e8 d3 3f 00 00       	call   804278 <__udivdi3>
+  8002a5:	83 c4 18             	add    $0x18,%esp
+  8002a8:	52                   	push   %edx
+  8002a9:	50                   	push   %eax
+  8002aa:	89 f2                	mov    %esi,%edx
+  8002ac:	89 d8                	mov    %ebx,%eax
+  8002ae:	e8 54 ff ff ff       	call   800207 <printnum>
+  8002b3:	83 c4 20             	add    $0x20,%esp
+  8002b6:	eb 9b                	jmp    800253 <printnum+0x4c>
+
+008002b8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002be:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002c2:	8b 10                	mov    (%eax),%edx
+  8002c4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c7:	73 0a                	jae    8002d3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8002c9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002cc:	89 08                	mov    %ecx,(%eax)
+  8002ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d1:	88 02                	mov    %al,(%edx)
+}
+  8002d3:	5d                   	pop    %ebp
+  8002d4:	c3                   	ret
+
+008002d5 <printfmt>:
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8002db:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8002de:	50                   	push   %eax
+  8002df:	ff 75 10             	push   0x10(%ebp)
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	e8 05 00 00 00       	call   8002f2 <vprintfmt>
+}
+  8002ed:	83 c4 10             	add    $0x10,%esp
+  8002f0:	c9                   	leave
+  8002f1:	c3                   	ret
+
+008002f2 <vprintfmt>:
+{
+  8002f2:	55                   	push   %ebp
+  8002f3:	89 e5                	mov    %esp,%ebp
+  8002f5:	57                   	push   %edi
+  8002f6:	56                   	push   %esi
+  8002f7:	53                   	push   %ebx
+  8002f8:	83 ec 2c             	sub    $0x2c,%esp
+  8002fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002fe:	89 df                	mov    %ebx,%edi
+  800300:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800303:	8b 45 10             	mov    0x10(%ebp),%eax
+  800306:	8d 70 01             	lea    0x1(%eax),%esi
+  800309:	0f b6 00             	movzbl (%eax),%eax
+  80030c:	83 f8 25             	cmp    $0x25,%eax
+  80030f:	74 1e                	je     80032f <vprintfmt+0x3d>
+			if (ch == '\0')
+  800311:	85 c0                	test   %eax,%eax
+  800313:	0f 84 15 05 00 00    	je     80082e <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800319:	83 ec 08             	sub    $0x8,%esp
+  80031c:	53                   	push   %ebx
+  80031d:	50                   	push   %eax
+  80031e:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800320:	83 c6 01             	add    $0x1,%esi
+  800323:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	83 f8 25             	cmp    $0x25,%eax
+  80032d:	75 e2                	jne    800311 <vprintfmt+0x1f>
+		padc = ' ';
+  80032f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800333:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80033a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800341:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800348:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80034d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800350:	8d 56 01             	lea    0x1(%esi),%edx
+  800353:	0f b6 0e             	movzbl (%esi),%ecx
+  800356:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800359:	3c 55                	cmp    $0x55,%al
+  80035b:	0f 87 3b 04 00 00    	ja     80079c <vprintfmt+0x4aa>
+  800361:	0f b6 c0             	movzbl %al,%eax
+  800364:	ff 24 85 80 46 80 00 	jmp    *0x804680(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80036b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80036e:	eb 93                	jmp    800303 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800370:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800372:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800376:	eb d8                	jmp    800350 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800378:	89 d6                	mov    %edx,%esi
+  80037a:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80037e:	eb d0                	jmp    800350 <vprintfmt+0x5e>
+  800380:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800383:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800386:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800389:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80038d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800390:	83 f9 09             	cmp    $0x9,%ecx
+  800393:	77 6f                	ja     800404 <vprintfmt+0x112>
+  800395:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800398:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80039b:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80039e:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003a2:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003a5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003a8:	83 fe 09             	cmp    $0x9,%esi
+  8003ab:	76 eb                	jbe    800398 <vprintfmt+0xa6>
+  8003ad:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003b0:	89 d6                	mov    %edx,%esi
+  8003b2:	eb 13                	jmp    8003c7 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b7:	8b 00                	mov    (%eax),%eax
+  8003b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8003bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003c5:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8003c7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8003cb:	79 83                	jns    800350 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8003cd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003d3:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8003da:	e9 71 ff ff ff       	jmp    800350 <vprintfmt+0x5e>
+			if (width < 0)
+  8003df:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003e2:	85 c9                	test   %ecx,%ecx
+  8003e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e9:	0f 49 c1             	cmovns %ecx,%eax
+  8003ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003ef:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8003f1:	e9 5a ff ff ff       	jmp    800350 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f6:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8003f8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8003ff:	e9 4c ff ff ff       	jmp    800350 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800404:	89 d6                	mov    %edx,%esi
+  800406:	eb bf                	jmp    8003c7 <vprintfmt+0xd5>
+			lflag++;
+  800408:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80040e:	e9 3d ff ff ff       	jmp    800350 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800413:	89 55 10             	mov    %edx,0x10(%ebp)
+  800416:	8b 45 14             	mov    0x14(%ebp),%eax
+  800419:	8d 70 04             	lea    0x4(%eax),%esi
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	53                   	push   %ebx
+  800420:	ff 30                	push   (%eax)
+  800422:	ff d7                	call   *%edi
+			break;
+  800424:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800427:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80042a:	e9 d4 fe ff ff       	jmp    800303 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80042f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800432:	8b 45 14             	mov    0x14(%ebp),%eax
+  800435:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800438:	8b 10                	mov    (%eax),%edx
+  80043a:	89 d0                	mov    %edx,%eax
+  80043c:	f7 d8                	neg    %eax
+  80043e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800441:	83 f8 12             	cmp    $0x12,%eax
+  800444:	7f 23                	jg     800469 <vprintfmt+0x177>
+  800446:	8b 14 85 e0 47 80 00 	mov    0x8047e0(,%eax,4),%edx
+  80044d:	85 d2                	test   %edx,%edx
+  80044f:	74 18                	je     800469 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800451:	52                   	push   %edx
+  800452:	68 33 4a 80 00       	push   $0x804a33
+  800457:	53                   	push   %ebx
+  800458:	57                   	push   %edi
+  800459:	e8 77 fe ff ff       	call   8002d5 <printfmt>
+  80045e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800461:	89 75 14             	mov    %esi,0x14(%ebp)
+  800464:	e9 9a fe ff ff       	jmp    800303 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800469:	50                   	push   %eax
+  80046a:	68 18 45 80 00       	push   $0x804518
+  80046f:	53                   	push   %ebx
+  800470:	57                   	push   %edi
+  800471:	e8 5f fe ff ff       	call   8002d5 <printfmt>
+  800476:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800479:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80047c:	e9 82 fe ff ff       	jmp    800303 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800481:	89 55 10             	mov    %edx,0x10(%ebp)
+  800484:	8b 45 14             	mov    0x14(%ebp),%eax
+  800487:	83 c0 04             	add    $0x4,%eax
+  80048a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80048d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800490:	8b 00                	mov    (%eax),%eax
+  800492:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800495:	85 c0                	test   %eax,%eax
+  800497:	0f 84 61 03 00 00    	je     8007fe <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80049d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004a1:	7e 06                	jle    8004a9 <vprintfmt+0x1b7>
+  8004a3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004a7:	75 29                	jne    8004d2 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004a9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004ac:	8d 70 01             	lea    0x1(%eax),%esi
+  8004af:	0f b6 00             	movzbl (%eax),%eax
+  8004b2:	0f be d0             	movsbl %al,%edx
+  8004b5:	85 d2                	test   %edx,%edx
+  8004b7:	0f 84 bb 00 00 00    	je     800578 <vprintfmt+0x286>
+  8004bd:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8004c0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8004c3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8004c6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8004c9:	eb 7a                	jmp    800545 <vprintfmt+0x253>
+				p = "(null)";
+  8004cb:	c7 45 d0 11 45 80 00 	movl   $0x804511,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004d2:	83 ec 08             	sub    $0x8,%esp
+  8004d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8004d8:	ff 75 d0             	push   -0x30(%ebp)
+  8004db:	e8 e0 03 00 00       	call   8008c0 <strnlen>
+  8004e0:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8004e3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8004e6:	83 c4 10             	add    $0x10,%esp
+  8004e9:	85 d2                	test   %edx,%edx
+  8004eb:	0f 8e d6 02 00 00    	jle    8007c7 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8004f1:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8004f5:	83 ec 08             	sub    $0x8,%esp
+  8004f8:	53                   	push   %ebx
+  8004f9:	56                   	push   %esi
+  8004fa:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004fc:	83 c4 10             	add    $0x10,%esp
+  8004ff:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800503:	75 f0                	jne    8004f5 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800505:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800508:	8d 70 01             	lea    0x1(%eax),%esi
+  80050b:	0f b6 00             	movzbl (%eax),%eax
+  80050e:	0f be d0             	movsbl %al,%edx
+  800511:	85 d2                	test   %edx,%edx
+  800513:	0f 84 da 02 00 00    	je     8007f3 <vprintfmt+0x501>
+  800519:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80051c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80051f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800522:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800525:	eb 1e                	jmp    800545 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800527:	83 ec 08             	sub    $0x8,%esp
+  80052a:	ff 75 0c             	push   0xc(%ebp)
+  80052d:	52                   	push   %edx
+  80052e:	ff 55 08             	call   *0x8(%ebp)
+  800531:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800534:	83 eb 01             	sub    $0x1,%ebx
+  800537:	83 c6 01             	add    $0x1,%esi
+  80053a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80053e:	0f be d0             	movsbl %al,%edx
+  800541:	85 d2                	test   %edx,%edx
+  800543:	74 2a                	je     80056f <vprintfmt+0x27d>
+  800545:	85 ff                	test   %edi,%edi
+  800547:	78 05                	js     80054e <vprintfmt+0x25c>
+  800549:	83 ef 01             	sub    $0x1,%edi
+  80054c:	78 59                	js     8005a7 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80054e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800552:	74 d3                	je     800527 <vprintfmt+0x235>
+  800554:	0f be c0             	movsbl %al,%eax
+  800557:	83 e8 20             	sub    $0x20,%eax
+  80055a:	83 f8 5e             	cmp    $0x5e,%eax
+  80055d:	76 c8                	jbe    800527 <vprintfmt+0x235>
+					putch('?', putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	ff 75 0c             	push   0xc(%ebp)
+  800565:	6a 3f                	push   $0x3f
+  800567:	ff 55 08             	call   *0x8(%ebp)
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	eb c5                	jmp    800534 <vprintfmt+0x242>
+  80056f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800572:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800575:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800578:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80057b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80057f:	7e 1b                	jle    80059c <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800581:	83 ec 08             	sub    $0x8,%esp
+  800584:	53                   	push   %ebx
+  800585:	6a 20                	push   $0x20
+  800587:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800589:	83 c4 10             	add    $0x10,%esp
+  80058c:	83 ee 01             	sub    $0x1,%esi
+  80058f:	75 f0                	jne    800581 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800591:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800594:	89 45 14             	mov    %eax,0x14(%ebp)
+  800597:	e9 67 fd ff ff       	jmp    800303 <vprintfmt+0x11>
+  80059c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a2:	e9 5c fd ff ff       	jmp    800303 <vprintfmt+0x11>
+  8005a7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005b0:	eb c6                	jmp    800578 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005b2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005b5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005b8:	83 f9 01             	cmp    $0x1,%ecx
+  8005bb:	7f 1f                	jg     8005dc <vprintfmt+0x2ea>
+	else if (lflag)
+  8005bd:	85 c9                	test   %ecx,%ecx
+  8005bf:	74 67                	je     800628 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8005c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c4:	8b 30                	mov    (%eax),%esi
+  8005c6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8005c9:	89 f0                	mov    %esi,%eax
+  8005cb:	c1 f8 1f             	sar    $0x1f,%eax
+  8005ce:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8005d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005da:	eb 17                	jmp    8005f3 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8005dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005df:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e2:	8b 00                	mov    (%eax),%eax
+  8005e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8005f0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005f9:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8005fe:	85 c9                	test   %ecx,%ecx
+  800600:	0f 89 12 01 00 00    	jns    800718 <vprintfmt+0x426>
+				putch('-', putdat);
+  800606:	83 ec 08             	sub    $0x8,%esp
+  800609:	53                   	push   %ebx
+  80060a:	6a 2d                	push   $0x2d
+  80060c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80060e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800611:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800614:	f7 da                	neg    %edx
+  800616:	83 d1 00             	adc    $0x0,%ecx
+  800619:	f7 d9                	neg    %ecx
+  80061b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80061e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800623:	e9 f0 00 00 00       	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 30                	mov    (%eax),%esi
+  80062d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800630:	89 f0                	mov    %esi,%eax
+  800632:	c1 f8 1f             	sar    $0x1f,%eax
+  800635:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800638:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063b:	8d 40 04             	lea    0x4(%eax),%eax
+  80063e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800641:	eb b0                	jmp    8005f3 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800643:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800646:	89 55 10             	mov    %edx,0x10(%ebp)
+  800649:	83 f9 01             	cmp    $0x1,%ecx
+  80064c:	7f 1e                	jg     80066c <vprintfmt+0x37a>
+	else if (lflag)
+  80064e:	85 c9                	test   %ecx,%ecx
+  800650:	74 32                	je     800684 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80065c:	8d 40 04             	lea    0x4(%eax),%eax
+  80065f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800662:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800667:	e9 ac 00 00 00       	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	8b 48 04             	mov    0x4(%eax),%ecx
+  800674:	8d 40 08             	lea    0x8(%eax),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80067a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  80067f:	e9 94 00 00 00       	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800694:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800699:	eb 7d                	jmp    800718 <vprintfmt+0x426>
+	if (lflag >= 2)
+  80069b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80069e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006a1:	83 f9 01             	cmp    $0x1,%ecx
+  8006a4:	7f 1b                	jg     8006c1 <vprintfmt+0x3cf>
+	else if (lflag)
+  8006a6:	85 c9                	test   %ecx,%ecx
+  8006a8:	74 2c                	je     8006d6 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	8b 10                	mov    (%eax),%edx
+  8006af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006ba:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8006bf:	eb 57                	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006cf:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8006d4:	eb 42                	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006e6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8006eb:	eb 2b                	jmp    800718 <vprintfmt+0x426>
+			putch('0', putdat);
+  8006ed:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  8006f3:	53                   	push   %ebx
+  8006f4:	6a 30                	push   $0x30
+  8006f6:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8006f8:	83 c4 08             	add    $0x8,%esp
+  8006fb:	53                   	push   %ebx
+  8006fc:	6a 78                	push   $0x78
+  8006fe:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800700:	8b 45 14             	mov    0x14(%ebp),%eax
+  800703:	8b 10                	mov    (%eax),%edx
+  800705:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80070a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80070d:	8d 40 04             	lea    0x4(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800713:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800718:	83 ec 0c             	sub    $0xc,%esp
+  80071b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80071f:	50                   	push   %eax
+  800720:	ff 75 e4             	push   -0x1c(%ebp)
+  800723:	56                   	push   %esi
+  800724:	51                   	push   %ecx
+  800725:	52                   	push   %edx
+  800726:	89 da                	mov    %ebx,%edx
+  800728:	89 f8                	mov    %edi,%eax
+  80072a:	e8 d8 fa ff ff       	call   800207 <printnum>
+			break;
+  80072f:	83 c4 20             	add    $0x20,%esp
+  800732:	e9 cc fb ff ff       	jmp    800303 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800737:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80073a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80073d:	83 f9 01             	cmp    $0x1,%ecx
+  800740:	7f 1b                	jg     80075d <vprintfmt+0x46b>
+	else if (lflag)
+  800742:	85 c9                	test   %ecx,%ecx
+  800744:	74 2c                	je     800772 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800756:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80075b:	eb bb                	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8b 10                	mov    (%eax),%edx
+  800762:	8b 48 04             	mov    0x4(%eax),%ecx
+  800765:	8d 40 08             	lea    0x8(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80076b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800770:	eb a6                	jmp    800718 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800772:	8b 45 14             	mov    0x14(%ebp),%eax
+  800775:	8b 10                	mov    (%eax),%edx
+  800777:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800782:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800787:	eb 8f                	jmp    800718 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800789:	89 55 10             	mov    %edx,0x10(%ebp)
+  80078c:	83 ec 08             	sub    $0x8,%esp
+  80078f:	53                   	push   %ebx
+  800790:	6a 25                	push   $0x25
+  800792:	ff d7                	call   *%edi
+			break;
+  800794:	83 c4 10             	add    $0x10,%esp
+  800797:	e9 67 fb ff ff       	jmp    800303 <vprintfmt+0x11>
+			putch('%', putdat);
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 25                	push   $0x25
+  8007a2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007a4:	83 c4 10             	add    $0x10,%esp
+  8007a7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007ab:	0f 84 ba fb ff ff    	je     80036b <vprintfmt+0x79>
+  8007b1:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007b4:	89 f0                	mov    %esi,%eax
+  8007b6:	83 e8 01             	sub    $0x1,%eax
+  8007b9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007bd:	75 f7                	jne    8007b6 <vprintfmt+0x4c4>
+  8007bf:	89 45 10             	mov    %eax,0x10(%ebp)
+  8007c2:	e9 3c fb ff ff       	jmp    800303 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007ca:	8d 70 01             	lea    0x1(%eax),%esi
+  8007cd:	0f b6 00             	movzbl (%eax),%eax
+  8007d0:	0f be d0             	movsbl %al,%edx
+  8007d3:	85 d2                	test   %edx,%edx
+  8007d5:	74 11                	je     8007e8 <vprintfmt+0x4f6>
+  8007d7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007da:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007dd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007e3:	e9 5d fd ff ff       	jmp    800545 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007e8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ee:	e9 10 fb ff ff       	jmp    800303 <vprintfmt+0x11>
+  8007f3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f9:	e9 05 fb ff ff       	jmp    800303 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8007fe:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800802:	7e 0a                	jle    80080e <vprintfmt+0x51c>
+  800804:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800808:	0f 85 bd fc ff ff    	jne    8004cb <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80080e:	ba 28 00 00 00       	mov    $0x28,%edx
+  800813:	b8 28 00 00 00       	mov    $0x28,%eax
+  800818:	be 12 45 80 00       	mov    $0x804512,%esi
+  80081d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800820:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800823:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800826:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800829:	e9 17 fd ff ff       	jmp    800545 <vprintfmt+0x253>
+}
+  80082e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800831:	5b                   	pop    %ebx
+  800832:	5e                   	pop    %esi
+  800833:	5f                   	pop    %edi
+  800834:	5d                   	pop    %ebp
+  800835:	c3                   	ret
+
+00800836 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	83 ec 18             	sub    $0x18,%esp
+  80083c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800842:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800845:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800849:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80084c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800853:	85 c0                	test   %eax,%eax
+  800855:	74 26                	je     80087d <vsnprintf+0x47>
+  800857:	85 d2                	test   %edx,%edx
+  800859:	7e 22                	jle    80087d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80085b:	ff 75 14             	push   0x14(%ebp)
+  80085e:	ff 75 10             	push   0x10(%ebp)
+  800861:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800864:	50                   	push   %eax
+  800865:	68 b8 02 80 00       	push   $0x8002b8
+  80086a:	e8 83 fa ff ff       	call   8002f2 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80086f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800872:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800878:	83 c4 10             	add    $0x10,%esp
+}
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+		return -E_INVAL;
+  80087d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800882:	eb f7                	jmp    80087b <vsnprintf+0x45>
+
+00800884 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80088a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80088d:	50                   	push   %eax
+  80088e:	ff 75 10             	push   0x10(%ebp)
+  800891:	ff 75 0c             	push   0xc(%ebp)
+  800894:	ff 75 08             	push   0x8(%ebp)
+  800897:	e8 9a ff ff ff       	call   800836 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80089c:	c9                   	leave
+  80089d:	c3                   	ret
+
+0080089e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80089e:	55                   	push   %ebp
+  80089f:	89 e5                	mov    %esp,%ebp
+  8008a1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008a4:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008a7:	74 10                	je     8008b9 <strlen+0x1b>
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008ae:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008b1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008b5:	75 f7                	jne    8008ae <strlen+0x10>
+	return n;
+}
+  8008b7:	5d                   	pop    %ebp
+  8008b8:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8008be:	eb f7                	jmp    8008b7 <strlen+0x19>
+
+008008c0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008c9:	85 d2                	test   %edx,%edx
+  8008cb:	74 16                	je     8008e3 <strnlen+0x23>
+  8008cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008d6:	74 09                	je     8008e1 <strnlen+0x21>
+		n++;
+  8008d8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008db:	39 d0                	cmp    %edx,%eax
+  8008dd:	75 f3                	jne    8008d2 <strnlen+0x12>
+		n++;
+  8008df:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8008e1:	5d                   	pop    %ebp
+  8008e2:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e8:	eb f7                	jmp    8008e1 <strnlen+0x21>
+
+008008ea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008ea:	55                   	push   %ebp
+  8008eb:	89 e5                	mov    %esp,%ebp
+  8008ed:	53                   	push   %ebx
+  8008ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008fd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800900:	83 c0 01             	add    $0x1,%eax
+  800903:	84 d2                	test   %dl,%dl
+  800905:	75 f2                	jne    8008f9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800907:	89 c8                	mov    %ecx,%eax
+  800909:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+0080090e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80090e:	55                   	push   %ebp
+  80090f:	89 e5                	mov    %esp,%ebp
+  800911:	53                   	push   %ebx
+  800912:	83 ec 10             	sub    $0x10,%esp
+  800915:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800918:	53                   	push   %ebx
+  800919:	e8 80 ff ff ff       	call   80089e <strlen>
+  80091e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800921:	ff 75 0c             	push   0xc(%ebp)
+  800924:	01 d8                	add    %ebx,%eax
+  800926:	50                   	push   %eax
+  800927:	e8 be ff ff ff       	call   8008ea <strcpy>
+	return dst;
+}
+  80092c:	89 d8                	mov    %ebx,%eax
+  80092e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800931:	c9                   	leave
+  800932:	c3                   	ret
+
+00800933 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	56                   	push   %esi
+  800937:	53                   	push   %ebx
+  800938:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80093e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800941:	85 db                	test   %ebx,%ebx
+  800943:	74 17                	je     80095c <strncpy+0x29>
+  800945:	01 f3                	add    %esi,%ebx
+  800947:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800949:	83 c0 01             	add    $0x1,%eax
+  80094c:	0f b6 0a             	movzbl (%edx),%ecx
+  80094f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800952:	80 f9 01             	cmp    $0x1,%cl
+  800955:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800958:	39 c3                	cmp    %eax,%ebx
+  80095a:	75 ed                	jne    800949 <strncpy+0x16>
+	}
+	return ret;
+}
+  80095c:	89 f0                	mov    %esi,%eax
+  80095e:	5b                   	pop    %ebx
+  80095f:	5e                   	pop    %esi
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	56                   	push   %esi
+  800966:	53                   	push   %ebx
+  800967:	8b 75 08             	mov    0x8(%ebp),%esi
+  80096a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80096d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800970:	89 f0                	mov    %esi,%eax
+  800972:	85 db                	test   %ebx,%ebx
+  800974:	74 1e                	je     800994 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800976:	83 eb 01             	sub    $0x1,%ebx
+  800979:	74 16                	je     800991 <strlcpy+0x2f>
+  80097b:	01 f3                	add    %esi,%ebx
+  80097d:	0f b6 0a             	movzbl (%edx),%ecx
+  800980:	84 c9                	test   %cl,%cl
+  800982:	74 0d                	je     800991 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800984:	83 c2 01             	add    $0x1,%edx
+  800987:	83 c0 01             	add    $0x1,%eax
+  80098a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80098d:	39 d8                	cmp    %ebx,%eax
+  80098f:	75 ec                	jne    80097d <strlcpy+0x1b>
+		*dst = '\0';
+  800991:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800994:	29 f0                	sub    %esi,%eax
+}
+  800996:	5b                   	pop    %ebx
+  800997:	5e                   	pop    %esi
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+
+0080099a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009a3:	0f b6 01             	movzbl (%ecx),%eax
+  8009a6:	84 c0                	test   %al,%al
+  8009a8:	74 11                	je     8009bb <strcmp+0x21>
+  8009aa:	38 02                	cmp    %al,(%edx)
+  8009ac:	75 0d                	jne    8009bb <strcmp+0x21>
+		p++, q++;
+  8009ae:	83 c1 01             	add    $0x1,%ecx
+  8009b1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b4:	0f b6 01             	movzbl (%ecx),%eax
+  8009b7:	84 c0                	test   %al,%al
+  8009b9:	75 ef                	jne    8009aa <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009bb:	0f b6 c0             	movzbl %al,%eax
+  8009be:	0f b6 12             	movzbl (%edx),%edx
+  8009c1:	29 d0                	sub    %edx,%eax
+}
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	53                   	push   %ebx
+  8009c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009cf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8009d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8009d7:	85 d2                	test   %edx,%edx
+  8009d9:	74 2e                	je     800a09 <strncmp+0x44>
+  8009db:	0f b6 01             	movzbl (%ecx),%eax
+  8009de:	84 c0                	test   %al,%al
+  8009e0:	74 16                	je     8009f8 <strncmp+0x33>
+  8009e2:	3a 03                	cmp    (%ebx),%al
+  8009e4:	75 12                	jne    8009f8 <strncmp+0x33>
+		n--, p++, q++;
+  8009e6:	83 c1 01             	add    $0x1,%ecx
+  8009e9:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8009ec:	83 ea 01             	sub    $0x1,%edx
+  8009ef:	75 ea                	jne    8009db <strncmp+0x16>
+		return 0;
+  8009f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f6:	eb 11                	jmp    800a09 <strncmp+0x44>
+  8009f8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8009fd:	85 d2                	test   %edx,%edx
+  8009ff:	74 08                	je     800a09 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a01:	0f b6 01             	movzbl (%ecx),%eax
+  800a04:	0f b6 13             	movzbl (%ebx),%edx
+  800a07:	29 d0                	sub    %edx,%eax
+}
+  800a09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0c:	c9                   	leave
+  800a0d:	c3                   	ret
+
+00800a0e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a14:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a18:	0f b6 10             	movzbl (%eax),%edx
+  800a1b:	84 d2                	test   %dl,%dl
+  800a1d:	74 15                	je     800a34 <strchr+0x26>
+		if (*s == c)
+  800a1f:	38 d1                	cmp    %dl,%cl
+  800a21:	74 0f                	je     800a32 <strchr+0x24>
+	for (; *s; s++)
+  800a23:	83 c0 01             	add    $0x1,%eax
+  800a26:	0f b6 10             	movzbl (%eax),%edx
+  800a29:	84 d2                	test   %dl,%dl
+  800a2b:	75 f2                	jne    800a1f <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a32:	5d                   	pop    %ebp
+  800a33:	c3                   	ret
+	return 0;
+  800a34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a39:	eb f7                	jmp    800a32 <strchr+0x24>
+
+00800a3b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	53                   	push   %ebx
+  800a3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a45:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a48:	38 d3                	cmp    %dl,%bl
+  800a4a:	74 14                	je     800a60 <strfind+0x25>
+  800a4c:	89 d1                	mov    %edx,%ecx
+  800a4e:	84 db                	test   %bl,%bl
+  800a50:	74 0e                	je     800a60 <strfind+0x25>
+	for (; *s; s++)
+  800a52:	83 c0 01             	add    $0x1,%eax
+  800a55:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a58:	38 ca                	cmp    %cl,%dl
+  800a5a:	74 04                	je     800a60 <strfind+0x25>
+  800a5c:	84 d2                	test   %dl,%dl
+  800a5e:	75 f2                	jne    800a52 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800a60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a63:	c9                   	leave
+  800a64:	c3                   	ret
+
+00800a65 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	57                   	push   %edi
+  800a69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a6f:	85 c9                	test   %ecx,%ecx
+  800a71:	74 20                	je     800a93 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a73:	89 f8                	mov    %edi,%eax
+  800a75:	09 c8                	or     %ecx,%eax
+  800a77:	a8 03                	test   $0x3,%al
+  800a79:	75 12                	jne    800a8d <memset+0x28>
+		c &= 0xFF;
+  800a7b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a85:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a88:	fc                   	cld
+  800a89:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a8b:	eb 06                	jmp    800a93 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a90:	fc                   	cld
+  800a91:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a93:	89 f8                	mov    %edi,%eax
+  800a95:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	57                   	push   %edi
+  800a9e:	56                   	push   %esi
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aa8:	39 c6                	cmp    %eax,%esi
+  800aaa:	73 32                	jae    800ade <memmove+0x44>
+  800aac:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aaf:	39 d0                	cmp    %edx,%eax
+  800ab1:	73 2b                	jae    800ade <memmove+0x44>
+		s += n;
+		d += n;
+  800ab3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab6:	89 d6                	mov    %edx,%esi
+  800ab8:	09 fe                	or     %edi,%esi
+  800aba:	09 ce                	or     %ecx,%esi
+  800abc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac2:	75 0e                	jne    800ad2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac4:	83 ef 04             	sub    $0x4,%edi
+  800ac7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aca:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800acd:	fd                   	std
+  800ace:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad0:	eb 09                	jmp    800adb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad2:	83 ef 01             	sub    $0x1,%edi
+  800ad5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ad8:	fd                   	std
+  800ad9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800adb:	fc                   	cld
+  800adc:	eb 1a                	jmp    800af8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ade:	89 f2                	mov    %esi,%edx
+  800ae0:	09 c2                	or     %eax,%edx
+  800ae2:	09 ca                	or     %ecx,%edx
+  800ae4:	f6 c2 03             	test   $0x3,%dl
+  800ae7:	75 0a                	jne    800af3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aec:	89 c7                	mov    %eax,%edi
+  800aee:	fc                   	cld
+  800aef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af1:	eb 05                	jmp    800af8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800af3:	89 c7                	mov    %eax,%edi
+  800af5:	fc                   	cld
+  800af6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800af8:	5e                   	pop    %esi
+  800af9:	5f                   	pop    %edi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b02:	ff 75 10             	push   0x10(%ebp)
+  800b05:	ff 75 0c             	push   0xc(%ebp)
+  800b08:	ff 75 08             	push   0x8(%ebp)
+  800b0b:	e8 8a ff ff ff       	call   800a9a <memmove>
+}
+  800b10:	c9                   	leave
+  800b11:	c3                   	ret
+
+00800b12 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b1d:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b20:	85 f6                	test   %esi,%esi
+  800b22:	74 29                	je     800b4d <memcmp+0x3b>
+  800b24:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b26:	0f b6 08             	movzbl (%eax),%ecx
+  800b29:	0f b6 1a             	movzbl (%edx),%ebx
+  800b2c:	38 d9                	cmp    %bl,%cl
+  800b2e:	75 11                	jne    800b41 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b30:	83 c0 01             	add    $0x1,%eax
+  800b33:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b36:	39 c6                	cmp    %eax,%esi
+  800b38:	75 ec                	jne    800b26 <memcmp+0x14>
+	}
+
+	return 0;
+  800b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3f:	eb 08                	jmp    800b49 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b41:	0f b6 c1             	movzbl %cl,%eax
+  800b44:	0f b6 db             	movzbl %bl,%ebx
+  800b47:	29 d8                	sub    %ebx,%eax
+}
+  800b49:	5b                   	pop    %ebx
+  800b4a:	5e                   	pop    %esi
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+	return 0;
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b52:	eb f5                	jmp    800b49 <memcmp+0x37>
+
+00800b54 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b62:	39 d0                	cmp    %edx,%eax
+  800b64:	73 0d                	jae    800b73 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b66:	38 08                	cmp    %cl,(%eax)
+  800b68:	74 0d                	je     800b77 <memfind+0x23>
+	for (; s < ends; s++)
+  800b6a:	83 c0 01             	add    $0x1,%eax
+  800b6d:	39 c2                	cmp    %eax,%edx
+  800b6f:	75 f5                	jne    800b66 <memfind+0x12>
+  800b71:	eb 06                	jmp    800b79 <memfind+0x25>
+  800b73:	89 c2                	mov    %eax,%edx
+  800b75:	eb 02                	jmp    800b79 <memfind+0x25>
+  800b77:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800b79:	89 d0                	mov    %edx,%eax
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b89:	0f b6 02             	movzbl (%edx),%eax
+  800b8c:	3c 20                	cmp    $0x20,%al
+  800b8e:	74 04                	je     800b94 <strtol+0x17>
+  800b90:	3c 09                	cmp    $0x9,%al
+  800b92:	75 0e                	jne    800ba2 <strtol+0x25>
+		s++;
+  800b94:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b97:	0f b6 02             	movzbl (%edx),%eax
+  800b9a:	3c 20                	cmp    $0x20,%al
+  800b9c:	74 f6                	je     800b94 <strtol+0x17>
+  800b9e:	3c 09                	cmp    $0x9,%al
+  800ba0:	74 f2                	je     800b94 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ba2:	3c 2b                	cmp    $0x2b,%al
+  800ba4:	74 2a                	je     800bd0 <strtol+0x53>
+	int neg = 0;
+  800ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bab:	3c 2d                	cmp    $0x2d,%al
+  800bad:	74 2b                	je     800bda <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800baf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bb5:	75 0f                	jne    800bc6 <strtol+0x49>
+  800bb7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bba:	74 28                	je     800be4 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800bbc:	85 db                	test   %ebx,%ebx
+  800bbe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bc3:	0f 44 d8             	cmove  %eax,%ebx
+  800bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bcb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bce:	eb 46                	jmp    800c16 <strtol+0x99>
+		s++;
+  800bd0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bd8:	eb d5                	jmp    800baf <strtol+0x32>
+		s++, neg = 1;
+  800bda:	83 c2 01             	add    $0x1,%edx
+  800bdd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800be2:	eb cb                	jmp    800baf <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800be4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800be8:	74 0e                	je     800bf8 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800bea:	85 db                	test   %ebx,%ebx
+  800bec:	75 d8                	jne    800bc6 <strtol+0x49>
+		s++, base = 8;
+  800bee:	83 c2 01             	add    $0x1,%edx
+  800bf1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bf6:	eb ce                	jmp    800bc6 <strtol+0x49>
+		s += 2, base = 16;
+  800bf8:	83 c2 02             	add    $0x2,%edx
+  800bfb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c00:	eb c4                	jmp    800bc6 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c02:	0f be c0             	movsbl %al,%eax
+  800c05:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c08:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c0b:	7d 3a                	jge    800c47 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c0d:	83 c2 01             	add    $0x1,%edx
+  800c10:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c14:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c16:	0f b6 02             	movzbl (%edx),%eax
+  800c19:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c1c:	89 f3                	mov    %esi,%ebx
+  800c1e:	80 fb 09             	cmp    $0x9,%bl
+  800c21:	76 df                	jbe    800c02 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c23:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c26:	89 f3                	mov    %esi,%ebx
+  800c28:	80 fb 19             	cmp    $0x19,%bl
+  800c2b:	77 08                	ja     800c35 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c2d:	0f be c0             	movsbl %al,%eax
+  800c30:	83 e8 57             	sub    $0x57,%eax
+  800c33:	eb d3                	jmp    800c08 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c35:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c38:	89 f3                	mov    %esi,%ebx
+  800c3a:	80 fb 19             	cmp    $0x19,%bl
+  800c3d:	77 08                	ja     800c47 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c3f:	0f be c0             	movsbl %al,%eax
+  800c42:	83 e8 37             	sub    $0x37,%eax
+  800c45:	eb c1                	jmp    800c08 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c47:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c4b:	74 05                	je     800c52 <strtol+0xd5>
+		*endptr = (char *) s;
+  800c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c50:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c52:	89 c8                	mov    %ecx,%eax
+  800c54:	f7 d8                	neg    %eax
+  800c56:	85 ff                	test   %edi,%edi
+  800c58:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c5b:	89 c8                	mov    %ecx,%eax
+  800c5d:	5b                   	pop    %ebx
+  800c5e:	5e                   	pop    %esi
+  800c5f:	5f                   	pop    %edi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+
+00800c62 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	56                   	push   %esi
+  800c67:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c70:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c73:	89 c3                	mov    %eax,%ebx
+  800c75:	89 c7                	mov    %eax,%edi
+  800c77:	89 c6                	mov    %eax,%esi
+  800c79:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c90:	89 d1                	mov    %edx,%ecx
+  800c92:	89 d3                	mov    %edx,%ebx
+  800c94:	89 d7                	mov    %edx,%edi
+  800c96:	89 d6                	mov    %edx,%esi
+  800c98:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c9a:	5b                   	pop    %ebx
+  800c9b:	5e                   	pop    %esi
+  800c9c:	5f                   	pop    %edi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+
+00800c9f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ca8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cb5:	89 cb                	mov    %ecx,%ebx
+  800cb7:	89 cf                	mov    %ecx,%edi
+  800cb9:	89 ce                	mov    %ecx,%esi
+  800cbb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	7f 08                	jg     800cc9 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+  800ccc:	50                   	push   %eax
+  800ccd:	6a 03                	push   $0x3
+  800ccf:	68 4b 48 80 00       	push   $0x80484b
+  800cd4:	6a 23                	push   $0x23
+  800cd6:	68 68 48 80 00       	push   $0x804868
+  800cdb:	e8 78 31 00 00       	call   803e58 <_panic>
+
+00800ce0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ce6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ceb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cf0:	89 d1                	mov    %edx,%ecx
+  800cf2:	89 d3                	mov    %edx,%ebx
+  800cf4:	89 d7                	mov    %edx,%edi
+  800cf6:	89 d6                	mov    %edx,%esi
+  800cf8:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cfa:	5b                   	pop    %ebx
+  800cfb:	5e                   	pop    %esi
+  800cfc:	5f                   	pop    %edi
+  800cfd:	5d                   	pop    %ebp
+  800cfe:	c3                   	ret
+
+00800cff <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	56                   	push   %esi
+  800d04:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d0a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d0f:	89 d1                	mov    %edx,%ecx
+  800d11:	89 d3                	mov    %edx,%ebx
+  800d13:	89 d7                	mov    %edx,%edi
+  800d15:	89 d6                	mov    %edx,%esi
+  800d17:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d19:	5b                   	pop    %ebx
+  800d1a:	5e                   	pop    %esi
+  800d1b:	5f                   	pop    %edi
+  800d1c:	5d                   	pop    %ebp
+  800d1d:	c3                   	ret
+
+00800d1e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d27:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3a:	89 f7                	mov    %esi,%edi
+  800d3c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d3e:	85 c0                	test   %eax,%eax
+  800d40:	7f 08                	jg     800d4a <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4a:	83 ec 0c             	sub    $0xc,%esp
+  800d4d:	50                   	push   %eax
+  800d4e:	6a 04                	push   $0x4
+  800d50:	68 4b 48 80 00       	push   $0x80484b
+  800d55:	6a 23                	push   $0x23
+  800d57:	68 68 48 80 00       	push   $0x804868
+  800d5c:	e8 f7 30 00 00       	call   803e58 <_panic>
+
+00800d61 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d61:	55                   	push   %ebp
+  800d62:	89 e5                	mov    %esp,%ebp
+  800d64:	57                   	push   %edi
+  800d65:	56                   	push   %esi
+  800d66:	53                   	push   %ebx
+  800d67:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d70:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d7b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d7e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 08                	jg     800d8c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 05                	push   $0x5
+  800d92:	68 4b 48 80 00       	push   $0x80484b
+  800d97:	6a 23                	push   $0x23
+  800d99:	68 68 48 80 00       	push   $0x804868
+  800d9e:	e8 b5 30 00 00       	call   803e58 <_panic>
+
+00800da3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dbc:	89 df                	mov    %ebx,%edi
+  800dbe:	89 de                	mov    %ebx,%esi
+  800dc0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 08                	jg     800dce <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dce:	83 ec 0c             	sub    $0xc,%esp
+  800dd1:	50                   	push   %eax
+  800dd2:	6a 06                	push   $0x6
+  800dd4:	68 4b 48 80 00       	push   $0x80484b
+  800dd9:	6a 23                	push   $0x23
+  800ddb:	68 68 48 80 00       	push   $0x804868
+  800de0:	e8 73 30 00 00       	call   803e58 <_panic>
+
+00800de5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dfe:	89 df                	mov    %ebx,%edi
+  800e00:	89 de                	mov    %ebx,%esi
+  800e02:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 08                	jg     800e10 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 08                	push   $0x8
+  800e16:	68 4b 48 80 00       	push   $0x80484b
+  800e1b:	6a 23                	push   $0x23
+  800e1d:	68 68 48 80 00       	push   $0x804868
+  800e22:	e8 31 30 00 00       	call   803e58 <_panic>
+
+00800e27 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	89 de                	mov    %ebx,%esi
+  800e44:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 09                	push   $0x9
+  800e58:	68 4b 48 80 00       	push   $0x80484b
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 68 48 80 00       	push   $0x804868
+  800e64:	e8 ef 2f 00 00       	call   803e58 <_panic>
+
+00800e69 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e82:	89 df                	mov    %ebx,%edi
+  800e84:	89 de                	mov    %ebx,%esi
+  800e86:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e88:	85 c0                	test   %eax,%eax
+  800e8a:	7f 08                	jg     800e94 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e8f:	5b                   	pop    %ebx
+  800e90:	5e                   	pop    %esi
+  800e91:	5f                   	pop    %edi
+  800e92:	5d                   	pop    %ebp
+  800e93:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e94:	83 ec 0c             	sub    $0xc,%esp
+  800e97:	50                   	push   %eax
+  800e98:	6a 0a                	push   $0xa
+  800e9a:	68 4b 48 80 00       	push   $0x80484b
+  800e9f:	6a 23                	push   $0x23
+  800ea1:	68 68 48 80 00       	push   $0x804868
+  800ea6:	e8 ad 2f 00 00       	call   803e58 <_panic>
+
+00800eab <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eab:	55                   	push   %ebp
+  800eac:	89 e5                	mov    %esp,%ebp
+  800eae:	57                   	push   %edi
+  800eaf:	56                   	push   %esi
+  800eb0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ee4:	89 cb                	mov    %ecx,%ebx
+  800ee6:	89 cf                	mov    %ecx,%edi
+  800ee8:	89 ce                	mov    %ecx,%esi
+  800eea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eec:	85 c0                	test   %eax,%eax
+  800eee:	7f 08                	jg     800ef8 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5e                   	pop    %esi
+  800ef5:	5f                   	pop    %edi
+  800ef6:	5d                   	pop    %ebp
+  800ef7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+  800efb:	50                   	push   %eax
+  800efc:	6a 0d                	push   $0xd
+  800efe:	68 4b 48 80 00       	push   $0x80484b
+  800f03:	6a 23                	push   $0x23
+  800f05:	68 68 48 80 00       	push   $0x804868
+  800f0a:	e8 49 2f 00 00       	call   803e58 <_panic>
+
+00800f0f <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f23:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f26:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f29:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	89 de                	mov    %ebx,%esi
+  800f4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4f:	85 c0                	test   %eax,%eax
+  800f51:	7f 08                	jg     800f5b <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	50                   	push   %eax
+  800f5f:	6a 0d                	push   $0xd
+  800f61:	68 4b 48 80 00       	push   $0x80484b
+  800f66:	6a 23                	push   $0x23
+  800f68:	68 68 48 80 00       	push   $0x804868
+  800f6d:	e8 e6 2e 00 00       	call   803e58 <_panic>
+
+00800f72 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f82:	89 d1                	mov    %edx,%ecx
+  800f84:	89 d3                	mov    %edx,%ebx
+  800f86:	89 d7                	mov    %edx,%edi
+  800f88:	89 d6                	mov    %edx,%esi
+  800f8a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+
+00800f91 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800fad:	5b                   	pop    %ebx
+  800fae:	5e                   	pop    %esi
+  800faf:	5f                   	pop    %edi
+  800fb0:	5d                   	pop    %ebp
+  800fb1:	c3                   	ret
+
+00800fb2 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fb8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fc5:	89 cb                	mov    %ecx,%ebx
+  800fc7:	89 cf                	mov    %ecx,%edi
+  800fc9:	89 ce                	mov    %ecx,%esi
+  800fcb:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+
+00800fd2 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fe8:	89 df                	mov    %ebx,%edi
+  800fea:	89 de                	mov    %ebx,%esi
+  800fec:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 12 00 00 00       	mov    $0x12,%eax
+  801009:	89 df                	mov    %ebx,%edi
+  80100b:	89 de                	mov    %ebx,%esi
+  80100d:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+
+00801014 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	b8 13 00 00 00       	mov    $0x13,%eax
+  801027:	89 cb                	mov    %ecx,%ebx
+  801029:	89 cf                	mov    %ecx,%edi
+  80102b:	89 ce                	mov    %ecx,%esi
+  80102d:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80102f:	5b                   	pop    %ebx
+  801030:	5e                   	pop    %esi
+  801031:	5f                   	pop    %edi
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+
+00801034 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801042:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801045:	b8 14 00 00 00       	mov    $0x14,%eax
+  80104a:	89 df                	mov    %ebx,%edi
+  80104c:	89 de                	mov    %ebx,%esi
+  80104e:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	b8 15 00 00 00       	mov    $0x15,%eax
+  801068:	89 cb                	mov    %ecx,%ebx
+  80106a:	89 cf                	mov    %ecx,%edi
+  80106c:	89 ce                	mov    %ecx,%esi
+  80106e:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801070:	5b                   	pop    %ebx
+  801071:	5e                   	pop    %esi
+  801072:	5f                   	pop    %edi
+  801073:	5d                   	pop    %ebp
+  801074:	c3                   	ret
+
+00801075 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	56                   	push   %esi
+  80107a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107b:	be 00 00 00 00       	mov    $0x0,%esi
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	b8 16 00 00 00       	mov    $0x16,%eax
+  80108b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108e:	89 f7                	mov    %esi,%edi
+  801090:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801092:	5b                   	pop    %ebx
+  801093:	5e                   	pop    %esi
+  801094:	5f                   	pop    %edi
+  801095:	5d                   	pop    %ebp
+  801096:	c3                   	ret
+
+00801097 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	89 de                	mov    %ebx,%esi
+  8010b1:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+
+008010b8 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	57                   	push   %edi
+  8010bc:	56                   	push   %esi
+  8010bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8010cb:	89 cb                	mov    %ecx,%ebx
+  8010cd:	89 cf                	mov    %ecx,%edi
+  8010cf:	89 ce                	mov    %ecx,%esi
+  8010d1:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8010de:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ea:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010ef:	89 df                	mov    %ebx,%edi
+  8010f1:	89 de                	mov    %ebx,%esi
+  8010f3:	cd 30                	int    $0x30
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801100:	be 00 00 00 00       	mov    $0x0,%esi
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801113:	89 f7                	mov    %esi,%edi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+
+0080111c <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801122:	be 00 00 00 00       	mov    $0x0,%esi
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801132:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801135:	89 f7                	mov    %esi,%edi
+  801137:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+
+0080113e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	57                   	push   %edi
+  801142:	56                   	push   %esi
+  801143:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801154:	89 df                	mov    %ebx,%edi
+  801156:	89 de                	mov    %ebx,%esi
+  801158:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+
+0080115f <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80115f:	55                   	push   %ebp
+  801160:	89 e5                	mov    %esp,%ebp
+  801162:	57                   	push   %edi
+  801163:	56                   	push   %esi
+  801164:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801165:	be 00 00 00 00       	mov    $0x0,%esi
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801175:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801178:	89 f7                	mov    %esi,%edi
+  80117a:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+
+00801181 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801181:	85 c0                	test   %eax,%eax
+  801183:	74 20                	je     8011a5 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801185:	89 c1                	mov    %eax,%ecx
+  801187:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80118d:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801193:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801199:	8b 52 48             	mov    0x48(%edx),%edx
+  80119c:	39 c2                	cmp    %eax,%edx
+  80119e:	74 06                	je     8011a6 <thread_alive+0x25>
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a5:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8011a6:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8011ac:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8011b2:	85 c0                	test   %eax,%eax
+  8011b4:	0f 95 c0             	setne  %al
+  8011b7:	0f b6 c0             	movzbl %al,%eax
+  8011ba:	c3                   	ret
+
+008011bb <pgfault>:
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	57                   	push   %edi
+  8011bf:	56                   	push   %esi
+  8011c0:	53                   	push   %ebx
+  8011c1:	83 ec 0c             	sub    $0xc,%esp
+  8011c4:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8011c7:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8011c9:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8011cc:	89 f3                	mov    %esi,%ebx
+  8011ce:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8011d1:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8011d8:	74 52                	je     80122c <pgfault+0x71>
+  8011da:	a8 02                	test   $0x2,%al
+  8011dc:	75 14                	jne    8011f2 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8011de:	83 ec 04             	sub    $0x4,%esp
+  8011e1:	68 76 48 80 00       	push   $0x804876
+  8011e6:	6a 2e                	push   $0x2e
+  8011e8:	68 94 48 80 00       	push   $0x804894
+  8011ed:	e8 66 2c 00 00       	call   803e58 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8011f2:	89 d8                	mov    %ebx,%eax
+  8011f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8011f9:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801200:	83 ec 0c             	sub    $0xc,%esp
+  801203:	57                   	push   %edi
+  801204:	e8 03 29 00 00       	call   803b0c <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801209:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801210:	83 e0 03             	and    $0x3,%eax
+  801213:	83 c4 10             	add    $0x10,%esp
+  801216:	83 f8 03             	cmp    $0x3,%eax
+  801219:	75 1a                	jne    801235 <pgfault+0x7a>
+			mutex_unlock(m);
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+  80121e:	57                   	push   %edi
+  80121f:	e8 56 29 00 00       	call   803b7a <mutex_unlock>
+			return;
+  801224:	83 c4 10             	add    $0x10,%esp
+  801227:	e9 9f 00 00 00       	jmp    8012cb <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80122c:	a8 02                	test   $0x2,%al
+  80122e:	74 ae                	je     8011de <pgfault+0x23>
+	struct mutex *m = NULL;
+  801230:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801235:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80123c:	f6 c4 08             	test   $0x8,%ah
+  80123f:	74 9d                	je     8011de <pgfault+0x23>
+  801241:	89 e0                	mov    %esp,%eax
+  801243:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801248:	29 c2                	sub    %eax,%edx
+  80124a:	89 d0                	mov    %edx,%eax
+  80124c:	c1 e8 0f             	shr    $0xf,%eax
+  80124f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125a:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  80125d:	c1 e0 0c             	shl    $0xc,%eax
+  801260:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801265:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801267:	83 ec 04             	sub    $0x4,%esp
+  80126a:	6a 07                	push   $0x7
+  80126c:	53                   	push   %ebx
+  80126d:	6a 00                	push   $0x0
+  80126f:	e8 aa fa ff ff       	call   800d1e <sys_page_alloc>
+  801274:	83 c4 10             	add    $0x10,%esp
+  801277:	85 c0                	test   %eax,%eax
+  801279:	78 58                	js     8012d3 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  80127b:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801281:	83 ec 04             	sub    $0x4,%esp
+  801284:	68 00 10 00 00       	push   $0x1000
+  801289:	56                   	push   %esi
+  80128a:	53                   	push   %ebx
+  80128b:	e8 0a f8 ff ff       	call   800a9a <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801290:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801297:	56                   	push   %esi
+  801298:	6a 00                	push   $0x0
+  80129a:	53                   	push   %ebx
+  80129b:	6a 00                	push   $0x0
+  80129d:	e8 bf fa ff ff       	call   800d61 <sys_page_map>
+  8012a2:	83 c4 20             	add    $0x20,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 3c                	js     8012e5 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8012a9:	83 ec 08             	sub    $0x8,%esp
+  8012ac:	53                   	push   %ebx
+  8012ad:	6a 00                	push   $0x0
+  8012af:	e8 ef fa ff ff       	call   800da3 <sys_page_unmap>
+  8012b4:	83 c4 10             	add    $0x10,%esp
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	78 3c                	js     8012f7 <pgfault+0x13c>
+	if(m)
+  8012bb:	85 ff                	test   %edi,%edi
+  8012bd:	74 0c                	je     8012cb <pgfault+0x110>
+		mutex_unlock(m);
+  8012bf:	83 ec 0c             	sub    $0xc,%esp
+  8012c2:	57                   	push   %edi
+  8012c3:	e8 b2 28 00 00       	call   803b7a <mutex_unlock>
+  8012c8:	83 c4 10             	add    $0x10,%esp
+}
+  8012cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8012d3:	50                   	push   %eax
+  8012d4:	68 9f 48 80 00       	push   $0x80489f
+  8012d9:	6a 3d                	push   $0x3d
+  8012db:	68 94 48 80 00       	push   $0x804894
+  8012e0:	e8 73 2b 00 00       	call   803e58 <_panic>
+		panic("sys_page_map: %e", ret);
+  8012e5:	50                   	push   %eax
+  8012e6:	68 b2 48 80 00       	push   $0x8048b2
+  8012eb:	6a 40                	push   $0x40
+  8012ed:	68 94 48 80 00       	push   $0x804894
+  8012f2:	e8 61 2b 00 00       	call   803e58 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8012f7:	50                   	push   %eax
+  8012f8:	68 c3 48 80 00       	push   $0x8048c3
+  8012fd:	6a 42                	push   $0x42
+  8012ff:	68 94 48 80 00       	push   $0x804894
+  801304:	e8 4f 2b 00 00       	call   803e58 <_panic>
+
+00801309 <thread_main>:
+{
+  801309:	55                   	push   %ebp
+  80130a:	89 e5                	mov    %esp,%ebp
+  80130c:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  80130f:	ff 75 0c             	push   0xc(%ebp)
+  801312:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801315:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80131c:	e8 7e f9 ff ff       	call   800c9f <sys_env_destroy>
+}
+  801321:	83 c4 10             	add    $0x10,%esp
+  801324:	c9                   	leave
+  801325:	c3                   	ret
+
+00801326 <fork>:
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+  80132c:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  80132f:	68 bb 11 80 00       	push   $0x8011bb
+  801334:	e8 65 2b 00 00       	call   803e9e <set_pgfault_handler>
+	if(sforked)
+  801339:	83 c4 10             	add    $0x10,%esp
+  80133c:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801343:	75 33                	jne    801378 <fork+0x52>
+	__asm __volatile("int %2"
+  801345:	b8 07 00 00 00       	mov    $0x7,%eax
+  80134a:	cd 30                	int    $0x30
+  80134c:	89 c7                	mov    %eax,%edi
+  80134e:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801350:	85 c0                	test   %eax,%eax
+  801352:	0f 88 b4 00 00 00    	js     80140c <fork+0xe6>
+	if(envid == 0) {
+  801358:	0f 84 c3 00 00 00    	je     801421 <fork+0xfb>
+	pgbatch_init(&pb);
+  80135e:	83 ec 0c             	sub    $0xc,%esp
+  801361:	68 20 63 80 00       	push   $0x806320
+  801366:	e8 ed 25 00 00       	call   803958 <pgbatch_init>
+  80136b:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80136e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801373:	e9 9c 01 00 00       	jmp    801514 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801378:	83 ec 0c             	sub    $0xc,%esp
+  80137b:	68 c0 66 80 00       	push   $0x8066c0
+  801380:	e8 87 27 00 00       	call   803b0c <mutex_lock>
+  801385:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801388:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80138d:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801392:	eb 08                	jmp    80139c <fork+0x76>
+  801394:	83 c3 01             	add    $0x1,%ebx
+  801397:	83 fb 20             	cmp    $0x20,%ebx
+  80139a:	74 5b                	je     8013f7 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  80139c:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8013a3:	89 f0                	mov    %esi,%eax
+  8013a5:	e8 d7 fd ff ff       	call   801181 <thread_alive>
+  8013aa:	85 c0                	test   %eax,%eax
+  8013ac:	74 e6                	je     801394 <fork+0x6e>
+  8013ae:	89 e0                	mov    %esp,%eax
+  8013b0:	89 fa                	mov    %edi,%edx
+  8013b2:	29 c2                	sub    %eax,%edx
+  8013b4:	89 d0                	mov    %edx,%eax
+  8013b6:	c1 e8 0f             	shr    $0xf,%eax
+  8013b9:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c4:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8013c7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8013ce:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8013d1:	83 ec 08             	sub    $0x8,%esp
+  8013d4:	50                   	push   %eax
+  8013d5:	56                   	push   %esi
+  8013d6:	e8 8e fa ff ff       	call   800e69 <sys_env_set_pgfault_upcall>
+  8013db:	83 c4 10             	add    $0x10,%esp
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	79 b2                	jns    801394 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8013e2:	50                   	push   %eax
+  8013e3:	68 50 49 80 00       	push   $0x804950
+  8013e8:	68 00 01 00 00       	push   $0x100
+  8013ed:	68 94 48 80 00       	push   $0x804894
+  8013f2:	e8 61 2a 00 00       	call   803e58 <_panic>
+	mutex_unlock(&sfork_lock);
+  8013f7:	83 ec 0c             	sub    $0xc,%esp
+  8013fa:	68 c0 66 80 00       	push   $0x8066c0
+  8013ff:	e8 76 27 00 00       	call   803b7a <mutex_unlock>
+}
+  801404:	83 c4 10             	add    $0x10,%esp
+  801407:	e9 39 ff ff ff       	jmp    801345 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80140c:	50                   	push   %eax
+  80140d:	68 d6 48 80 00       	push   $0x8048d6
+  801412:	68 91 00 00 00       	push   $0x91
+  801417:	68 94 48 80 00       	push   $0x804894
+  80141c:	e8 37 2a 00 00       	call   803e58 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801421:	e8 ba f8 ff ff       	call   800ce0 <sys_getenvid>
+  801426:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80142b:	89 e1                	mov    %esp,%ecx
+  80142d:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801432:	29 ca                	sub    %ecx,%edx
+  801434:	89 d1                	mov    %edx,%ecx
+  801436:	c1 e9 0f             	shr    $0xf,%ecx
+  801439:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80143f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801444:	0f 42 d1             	cmovb  %ecx,%edx
+  801447:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80144d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801452:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801459:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  80145e:	85 c0                	test   %eax,%eax
+  801460:	75 07                	jne    801469 <fork+0x143>
+		return 0;
+  801462:	89 c6                	mov    %eax,%esi
+  801464:	e9 6f 02 00 00       	jmp    8016d8 <fork+0x3b2>
+  801469:	89 e2                	mov    %esp,%edx
+  80146b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801470:	29 d0                	sub    %edx,%eax
+  801472:	89 c3                	mov    %eax,%ebx
+  801474:	c1 eb 0f             	shr    $0xf,%ebx
+  801477:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801481:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	68 80 00 00 00       	push   $0x80
+  80148c:	6a 00                	push   $0x0
+  80148e:	68 40 66 80 00       	push   $0x806640
+  801493:	e8 cd f5 ff ff       	call   800a65 <memset>
+	thread_ids[slot] = sys_getenvid();
+  801498:	e8 43 f8 ff ff       	call   800ce0 <sys_getenvid>
+  80149d:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8014a4:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  8014ab:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  8014b0:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8014b7:	e8 42 26 00 00       	call   803afe <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8014bc:	83 c4 0c             	add    $0xc,%esp
+  8014bf:	68 07 04 00 00       	push   $0x407
+  8014c4:	68 00 00 00 e1       	push   $0xe1000000
+  8014c9:	6a 00                	push   $0x0
+  8014cb:	e8 4e f8 ff ff       	call   800d1e <sys_page_alloc>
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	85 c0                	test   %eax,%eax
+  8014d5:	0f 89 fd 01 00 00    	jns    8016d8 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8014db:	50                   	push   %eax
+  8014dc:	68 9f 48 80 00       	push   $0x80489f
+  8014e1:	68 12 01 00 00       	push   $0x112
+  8014e6:	68 94 48 80 00       	push   $0x804894
+  8014eb:	e8 68 29 00 00       	call   803e58 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8014f0:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8014f6:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8014fc:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801502:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801508:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  80150e:	0f 87 4f 01 00 00    	ja     801663 <fork+0x33d>
+		pd = PDX(addr);
+  801514:	89 d8                	mov    %ebx,%eax
+  801516:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801519:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801520:	f6 c2 01             	test   $0x1,%dl
+  801523:	74 cb                	je     8014f0 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801525:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80152a:	0f 85 92 00 00 00    	jne    8015c2 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801530:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801536:	76 10                	jbe    801548 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  801538:	89 d8                	mov    %ebx,%eax
+  80153a:	f7 d8                	neg    %eax
+  80153c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801541:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801546:	74 ba                	je     801502 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  801548:	89 d8                	mov    %ebx,%eax
+  80154a:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80154d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801554:	f6 c2 01             	test   $0x1,%dl
+  801557:	74 a9                	je     801502 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801559:	89 c1                	mov    %eax,%ecx
+  80155b:	c1 e1 0c             	shl    $0xc,%ecx
+  80155e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801561:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801568:	f6 c6 04             	test   $0x4,%dh
+  80156b:	0f 85 8e 00 00 00    	jne    8015ff <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801571:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801578:	f6 c6 08             	test   $0x8,%dh
+  80157b:	75 0f                	jne    80158c <fork+0x266>
+  80157d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801584:	a8 02                	test   $0x2,%al
+  801586:	0f 84 bb 00 00 00    	je     801647 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  80158c:	83 ec 08             	sub    $0x8,%esp
+  80158f:	68 05 08 00 00       	push   $0x805
+  801594:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801597:	50                   	push   %eax
+  801598:	56                   	push   %esi
+  801599:	50                   	push   %eax
+  80159a:	6a 00                	push   $0x0
+  80159c:	68 20 63 80 00       	push   $0x806320
+  8015a1:	e8 70 24 00 00       	call   803a16 <pgbatch_map>
+  8015a6:	83 c4 20             	add    $0x20,%esp
+  8015a9:	85 c0                	test   %eax,%eax
+  8015ab:	79 76                	jns    801623 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8015ad:	50                   	push   %eax
+  8015ae:	68 fa 48 80 00       	push   $0x8048fa
+  8015b3:	68 bc 00 00 00       	push   $0xbc
+  8015b8:	68 94 48 80 00       	push   $0x804894
+  8015bd:	e8 96 28 00 00       	call   803e58 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	68 00 08 00 00       	push   $0x800
+  8015ca:	56                   	push   %esi
+  8015cb:	53                   	push   %ebx
+  8015cc:	6a 00                	push   $0x0
+  8015ce:	68 20 63 80 00       	push   $0x806320
+  8015d3:	e8 e9 24 00 00       	call   803ac1 <pgbatch_sharept>
+  8015d8:	83 c4 20             	add    $0x20,%esp
+  8015db:	85 c0                	test   %eax,%eax
+  8015dd:	78 0b                	js     8015ea <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8015df:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8015e5:	e9 18 ff ff ff       	jmp    801502 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8015ea:	50                   	push   %eax
+  8015eb:	68 e6 48 80 00       	push   $0x8048e6
+  8015f0:	68 b2 00 00 00       	push   $0xb2
+  8015f5:	68 94 48 80 00       	push   $0x804894
+  8015fa:	e8 59 28 00 00       	call   803e58 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8015ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801606:	83 ec 08             	sub    $0x8,%esp
+  801609:	25 07 0e 00 00       	and    $0xe07,%eax
+  80160e:	50                   	push   %eax
+  80160f:	51                   	push   %ecx
+  801610:	56                   	push   %esi
+  801611:	51                   	push   %ecx
+  801612:	6a 00                	push   $0x0
+  801614:	68 20 63 80 00       	push   $0x806320
+  801619:	e8 f8 23 00 00       	call   803a16 <pgbatch_map>
+  80161e:	83 c4 20             	add    $0x20,%esp
+  801621:	eb 17                	jmp    80163a <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801623:	68 05 08 00 00       	push   $0x805
+  801628:	ff 75 e4             	push   -0x1c(%ebp)
+  80162b:	6a 00                	push   $0x0
+  80162d:	68 20 63 80 00       	push   $0x806320
+  801632:	e8 53 24 00 00       	call   803a8a <pgbatch_protect>
+  801637:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	0f 89 c0 fe ff ff    	jns    801502 <fork+0x1dc>
+  801642:	e9 66 ff ff ff       	jmp    8015ad <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	6a 05                	push   $0x5
+  80164c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80164f:	50                   	push   %eax
+  801650:	56                   	push   %esi
+  801651:	50                   	push   %eax
+  801652:	6a 00                	push   $0x0
+  801654:	68 20 63 80 00       	push   $0x806320
+  801659:	e8 b8 23 00 00       	call   803a16 <pgbatch_map>
+  80165e:	83 c4 20             	add    $0x20,%esp
+  801661:	eb d7                	jmp    80163a <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801663:	6a 07                	push   $0x7
+  801665:	68 00 f0 bf ee       	push   $0xeebff000
+  80166a:	57                   	push   %edi
+  80166b:	68 20 63 80 00       	push   $0x806320
+  801670:	e8 6a 23 00 00       	call   8039df <pgbatch_alloc>
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 66                	js     8016e2 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  80167c:	83 ec 0c             	sub    $0xc,%esp
+  80167f:	68 20 63 80 00       	push   $0x806320
+  801684:	e8 dd 22 00 00       	call   803966 <pgbatch_flush>
+  801689:	83 c4 10             	add    $0x10,%esp
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	78 52                	js     8016e2 <fork+0x3bc>
+  801690:	89 e2                	mov    %esp,%edx
+  801692:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801697:	29 d0                	sub    %edx,%eax
+  801699:	89 c2                	mov    %eax,%edx
+  80169b:	c1 ea 0f             	shr    $0xf,%edx
+  80169e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a8:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8016ab:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8016b2:	8b 40 78             	mov    0x78(%eax),%eax
+  8016b5:	83 ec 08             	sub    $0x8,%esp
+  8016b8:	50                   	push   %eax
+  8016b9:	57                   	push   %edi
+  8016ba:	e8 aa f7 ff ff       	call   800e69 <sys_env_set_pgfault_upcall>
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 31                	js     8016f7 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8016c6:	83 ec 08             	sub    $0x8,%esp
+  8016c9:	6a 02                	push   $0x2
+  8016cb:	57                   	push   %edi
+  8016cc:	e8 14 f7 ff ff       	call   800de5 <sys_env_set_status>
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	78 34                	js     80170c <fork+0x3e6>
+}
+  8016d8:	89 f0                	mov    %esi,%eax
+  8016da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016dd:	5b                   	pop    %ebx
+  8016de:	5e                   	pop    %esi
+  8016df:	5f                   	pop    %edi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8016e2:	50                   	push   %eax
+  8016e3:	68 06 49 80 00       	push   $0x804906
+  8016e8:	68 c0 00 00 00       	push   $0xc0
+  8016ed:	68 94 48 80 00       	push   $0x804894
+  8016f2:	e8 61 27 00 00       	call   803e58 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8016f7:	50                   	push   %eax
+  8016f8:	68 1b 49 80 00       	push   $0x80491b
+  8016fd:	68 c2 00 00 00       	push   $0xc2
+  801702:	68 94 48 80 00       	push   $0x804894
+  801707:	e8 4c 27 00 00       	call   803e58 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  80170c:	50                   	push   %eax
+  80170d:	68 36 49 80 00       	push   $0x804936
+  801712:	68 c4 00 00 00       	push   $0xc4
+  801717:	68 94 48 80 00       	push   $0x804894
+  80171c:	e8 37 27 00 00       	call   803e58 <_panic>
+
+00801721 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	57                   	push   %edi
+  801725:	56                   	push   %esi
+  801726:	53                   	push   %ebx
+  801727:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80172a:	68 c0 66 80 00       	push   $0x8066c0
+  80172f:	e8 d8 23 00 00       	call   803b0c <mutex_lock>
+  801734:	89 e2                	mov    %esp,%edx
+  801736:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80173b:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  80173d:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801740:	89 c3                	mov    %eax,%ebx
+  801742:	c1 eb 0f             	shr    $0xf,%ebx
+  801745:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801752:	e8 89 f5 ff ff       	call   800ce0 <sys_getenvid>
+  801757:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  80175e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801763:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  80176a:	e8 12 fa ff ff       	call   801181 <thread_alive>
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	74 24                	je     801797 <sfork+0x76>
+  801773:	83 c3 01             	add    $0x1,%ebx
+  801776:	83 fb 20             	cmp    $0x20,%ebx
+  801779:	75 e8                	jne    801763 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  80177b:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801780:	83 ec 0c             	sub    $0xc,%esp
+  801783:	68 c0 66 80 00       	push   $0x8066c0
+  801788:	e8 ed 23 00 00       	call   803b7a <mutex_unlock>
+	return r;
+}
+  80178d:	89 f0                	mov    %esi,%eax
+  80178f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801792:	5b                   	pop    %ebx
+  801793:	5e                   	pop    %esi
+  801794:	5f                   	pop    %edi
+  801795:	5d                   	pop    %ebp
+  801796:	c3                   	ret
+	if (i == NTHREADS) {
+  801797:	83 fb 20             	cmp    $0x20,%ebx
+  80179a:	0f 84 53 01 00 00    	je     8018f3 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8017a0:	89 d8                	mov    %ebx,%eax
+  8017a2:	c1 e0 0f             	shl    $0xf,%eax
+  8017a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	68 00 60 80 00       	push   $0x806000
+  8017b0:	e8 a3 21 00 00       	call   803958 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  8017b5:	83 c4 10             	add    $0x10,%esp
+  8017b8:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8017bf:	75 1f                	jne    8017e0 <sfork+0xbf>
+  8017c1:	68 07 04 00 00       	push   $0x407
+  8017c6:	68 00 00 00 e1       	push   $0xe1000000
+  8017cb:	6a 00                	push   $0x0
+  8017cd:	68 00 60 80 00       	push   $0x806000
+  8017d2:	e8 08 22 00 00       	call   8039df <pgbatch_alloc>
+  8017d7:	89 c6                	mov    %eax,%esi
+  8017d9:	83 c4 10             	add    $0x10,%esp
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	78 a0                	js     801780 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  8017e0:	6a 07                	push   $0x7
+  8017e2:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  8017e7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017ea:	29 c8                	sub    %ecx,%eax
+  8017ec:	50                   	push   %eax
+  8017ed:	6a 00                	push   $0x0
+  8017ef:	68 00 60 80 00       	push   $0x806000
+  8017f4:	e8 e6 21 00 00       	call   8039df <pgbatch_alloc>
+  8017f9:	89 c6                	mov    %eax,%esi
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	0f 88 7a ff ff ff    	js     801780 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801806:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  80180b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80180e:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801810:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801815:	29 c8                	sub    %ecx,%eax
+  801817:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80181a:	39 c7                	cmp    %eax,%edi
+  80181c:	73 29                	jae    801847 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  80181e:	6a 07                	push   $0x7
+  801820:	57                   	push   %edi
+  801821:	6a 00                	push   $0x0
+  801823:	68 00 60 80 00       	push   $0x806000
+  801828:	e8 b2 21 00 00       	call   8039df <pgbatch_alloc>
+  80182d:	89 c6                	mov    %eax,%esi
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	85 c0                	test   %eax,%eax
+  801834:	0f 88 46 ff ff ff    	js     801780 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80183a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801840:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801843:	39 c7                	cmp    %eax,%edi
+  801845:	72 d7                	jb     80181e <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801847:	83 ec 0c             	sub    $0xc,%esp
+  80184a:	68 00 60 80 00       	push   $0x806000
+  80184f:	e8 12 21 00 00       	call   803966 <pgbatch_flush>
+  801854:	89 c6                	mov    %eax,%esi
+  801856:	83 c4 10             	add    $0x10,%esp
+  801859:	85 c0                	test   %eax,%eax
+  80185b:	0f 88 1f ff ff ff    	js     801780 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801861:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801866:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801869:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  80186b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801871:	8b 55 08             	mov    0x8(%ebp),%edx
+  801874:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801877:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80187a:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  80187d:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801880:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801885:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801887:	52                   	push   %edx
+  801888:	50                   	push   %eax
+  801889:	68 09 13 80 00       	push   $0x801309
+  80188e:	e8 cc f8 ff ff       	call   80115f <sys_exofork_shared>
+  801893:	89 c6                	mov    %eax,%esi
+  801895:	83 c4 10             	add    $0x10,%esp
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	0f 88 e0 fe ff ff    	js     801780 <sfork+0x5f>
+	thread_ids[i] = id;
+  8018a0:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8018a7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018ac:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8018b2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018b7:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  8018be:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  8018c5:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8018c8:	83 ec 08             	sub    $0x8,%esp
+  8018cb:	6a 02                	push   $0x2
+  8018cd:	56                   	push   %esi
+  8018ce:	e8 12 f5 ff ff       	call   800de5 <sys_env_set_status>
+  8018d3:	89 c3                	mov    %eax,%ebx
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	0f 89 a0 fe ff ff    	jns    801780 <sfork+0x5f>
+		sys_env_destroy(id);
+  8018e0:	83 ec 0c             	sub    $0xc,%esp
+  8018e3:	56                   	push   %esi
+  8018e4:	e8 b6 f3 ff ff       	call   800c9f <sys_env_destroy>
+		goto out;
+  8018e9:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8018ec:	89 de                	mov    %ebx,%esi
+		goto out;
+  8018ee:	e9 8d fe ff ff       	jmp    801780 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  8018f3:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  8018f8:	e9 83 fe ff ff       	jmp    801780 <sfork+0x5f>
+
+008018fd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801900:	8b 45 08             	mov    0x8(%ebp),%eax
+  801903:	05 00 00 00 30       	add    $0x30000000,%eax
+  801908:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80190b:	5d                   	pop    %ebp
+  80190c:	c3                   	ret
+
+0080190d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80190d:	55                   	push   %ebp
+  80190e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801910:	8b 45 08             	mov    0x8(%ebp),%eax
+  801913:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801918:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80191d:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801922:	5d                   	pop    %ebp
+  801923:	c3                   	ret
+
+00801924 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80192c:	89 c2                	mov    %eax,%edx
+  80192e:	c1 ea 16             	shr    $0x16,%edx
+  801931:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801938:	f6 c2 01             	test   $0x1,%dl
+  80193b:	74 29                	je     801966 <fd_alloc+0x42>
+  80193d:	89 c2                	mov    %eax,%edx
+  80193f:	c1 ea 0c             	shr    $0xc,%edx
+  801942:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801949:	f6 c2 01             	test   $0x1,%dl
+  80194c:	74 18                	je     801966 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80194e:	05 00 10 00 00       	add    $0x1000,%eax
+  801953:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801958:	75 d2                	jne    80192c <fd_alloc+0x8>
+  80195a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80195f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801964:	eb 05                	jmp    80196b <fd_alloc+0x47>
+			return 0;
+  801966:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80196b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196e:	89 02                	mov    %eax,(%edx)
+}
+  801970:	89 c8                	mov    %ecx,%eax
+  801972:	5d                   	pop    %ebp
+  801973:	c3                   	ret
+
+00801974 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801974:	55                   	push   %ebp
+  801975:	89 e5                	mov    %esp,%ebp
+  801977:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80197a:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80197f:	77 30                	ja     8019b1 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801981:	c1 e0 0c             	shl    $0xc,%eax
+  801984:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801989:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80198f:	f6 c2 01             	test   $0x1,%dl
+  801992:	74 24                	je     8019b8 <fd_lookup+0x44>
+  801994:	89 c2                	mov    %eax,%edx
+  801996:	c1 ea 0c             	shr    $0xc,%edx
+  801999:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019a0:	f6 c2 01             	test   $0x1,%dl
+  8019a3:	74 1a                	je     8019bf <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a8:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019af:	5d                   	pop    %ebp
+  8019b0:	c3                   	ret
+		return -E_INVAL;
+  8019b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b6:	eb f7                	jmp    8019af <fd_lookup+0x3b>
+		return -E_INVAL;
+  8019b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bd:	eb f0                	jmp    8019af <fd_lookup+0x3b>
+  8019bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c4:	eb e9                	jmp    8019af <fd_lookup+0x3b>
+
+008019c6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019c6:	55                   	push   %ebp
+  8019c7:	89 e5                	mov    %esp,%ebp
+  8019c9:	53                   	push   %ebx
+  8019ca:	83 ec 04             	sub    $0x4,%esp
+  8019cd:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d5:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8019da:	39 13                	cmp    %edx,(%ebx)
+  8019dc:	74 54                	je     801a32 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8019de:	83 c0 01             	add    $0x1,%eax
+  8019e1:	8b 1c 85 ec 49 80 00 	mov    0x8049ec(,%eax,4),%ebx
+  8019e8:	85 db                	test   %ebx,%ebx
+  8019ea:	75 ee                	jne    8019da <dev_lookup+0x14>
+  8019ec:	89 e1                	mov    %esp,%ecx
+  8019ee:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019f3:	29 c8                	sub    %ecx,%eax
+  8019f5:	89 c1                	mov    %eax,%ecx
+  8019f7:	c1 e9 0f             	shr    $0xf,%ecx
+  8019fa:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a07:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801a0e:	8b 40 48             	mov    0x48(%eax),%eax
+  801a11:	83 ec 04             	sub    $0x4,%esp
+  801a14:	52                   	push   %edx
+  801a15:	50                   	push   %eax
+  801a16:	68 70 49 80 00       	push   $0x804970
+  801a1b:	e8 d3 e7 ff ff       	call   8001f3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a20:	83 c4 10             	add    $0x10,%esp
+  801a23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a2b:	89 1a                	mov    %ebx,(%edx)
+}
+  801a2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a30:	c9                   	leave
+  801a31:	c3                   	ret
+			return 0;
+  801a32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a37:	eb ef                	jmp    801a28 <dev_lookup+0x62>
+
+00801a39 <fd_close>:
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+  801a3c:	57                   	push   %edi
+  801a3d:	56                   	push   %esi
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 24             	sub    $0x24,%esp
+  801a42:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a45:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a48:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a4b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a4c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a52:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a55:	50                   	push   %eax
+  801a56:	e8 19 ff ff ff       	call   801974 <fd_lookup>
+  801a5b:	89 c3                	mov    %eax,%ebx
+  801a5d:	83 c4 10             	add    $0x10,%esp
+  801a60:	85 c0                	test   %eax,%eax
+  801a62:	78 05                	js     801a69 <fd_close+0x30>
+	    || fd != fd2)
+  801a64:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a67:	74 0f                	je     801a78 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801a69:	85 ff                	test   %edi,%edi
+  801a6b:	0f 44 df             	cmove  %edi,%ebx
+}
+  801a6e:	89 d8                	mov    %ebx,%eax
+  801a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a73:	5b                   	pop    %ebx
+  801a74:	5e                   	pop    %esi
+  801a75:	5f                   	pop    %edi
+  801a76:	5d                   	pop    %ebp
+  801a77:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a78:	83 ec 08             	sub    $0x8,%esp
+  801a7b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a7e:	50                   	push   %eax
+  801a7f:	ff 36                	push   (%esi)
+  801a81:	e8 40 ff ff ff       	call   8019c6 <dev_lookup>
+  801a86:	89 c3                	mov    %eax,%ebx
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1a                	js     801aa9 <fd_close+0x70>
+		if (dev->dev_close)
+  801a8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a92:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a95:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	74 0b                	je     801aa9 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801a9e:	83 ec 0c             	sub    $0xc,%esp
+  801aa1:	56                   	push   %esi
+  801aa2:	ff d0                	call   *%eax
+  801aa4:	89 c3                	mov    %eax,%ebx
+  801aa6:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801aa9:	83 ec 08             	sub    $0x8,%esp
+  801aac:	56                   	push   %esi
+  801aad:	6a 00                	push   $0x0
+  801aaf:	e8 ef f2 ff ff       	call   800da3 <sys_page_unmap>
+	return r;
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	eb b5                	jmp    801a6e <fd_close+0x35>
+
+00801ab9 <close>:
+
+int
+close(int fdnum)
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801abf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ac2:	50                   	push   %eax
+  801ac3:	ff 75 08             	push   0x8(%ebp)
+  801ac6:	e8 a9 fe ff ff       	call   801974 <fd_lookup>
+  801acb:	83 c4 10             	add    $0x10,%esp
+  801ace:	85 c0                	test   %eax,%eax
+  801ad0:	79 02                	jns    801ad4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ad2:	c9                   	leave
+  801ad3:	c3                   	ret
+		return fd_close(fd, 1);
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	6a 01                	push   $0x1
+  801ad9:	ff 75 f4             	push   -0xc(%ebp)
+  801adc:	e8 58 ff ff ff       	call   801a39 <fd_close>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+  801ae4:	eb ec                	jmp    801ad2 <close+0x19>
+
+00801ae6 <close_all>:
+
+void
+close_all(void)
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	53                   	push   %ebx
+  801aea:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801aed:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801af2:	83 ec 0c             	sub    $0xc,%esp
+  801af5:	53                   	push   %ebx
+  801af6:	e8 be ff ff ff       	call   801ab9 <close>
+	for (i = 0; i < MAXFD; i++)
+  801afb:	83 c3 01             	add    $0x1,%ebx
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801b07:	75 e9                	jne    801af2 <close_all+0xc>
+}
+  801b09:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b0c:	c9                   	leave
+  801b0d:	c3                   	ret
+
+00801b0e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b0e:	55                   	push   %ebp
+  801b0f:	89 e5                	mov    %esp,%ebp
+  801b11:	57                   	push   %edi
+  801b12:	56                   	push   %esi
+  801b13:	53                   	push   %ebx
+  801b14:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b17:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	ff 75 08             	push   0x8(%ebp)
+  801b1e:	e8 51 fe ff ff       	call   801974 <fd_lookup>
+  801b23:	89 c3                	mov    %eax,%ebx
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	78 7f                	js     801bab <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b2c:	83 ec 0c             	sub    $0xc,%esp
+  801b2f:	ff 75 0c             	push   0xc(%ebp)
+  801b32:	e8 82 ff ff ff       	call   801ab9 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b37:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b3a:	c1 e6 0c             	shl    $0xc,%esi
+  801b3d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b43:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b46:	89 3c 24             	mov    %edi,(%esp)
+  801b49:	e8 bf fd ff ff       	call   80190d <fd2data>
+  801b4e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b50:	89 34 24             	mov    %esi,(%esp)
+  801b53:	e8 b5 fd ff ff       	call   80190d <fd2data>
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801b5e:	89 d8                	mov    %ebx,%eax
+  801b60:	c1 e8 16             	shr    $0x16,%eax
+  801b63:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b6a:	a8 01                	test   $0x1,%al
+  801b6c:	74 11                	je     801b7f <dup+0x71>
+  801b6e:	89 d8                	mov    %ebx,%eax
+  801b70:	c1 e8 0c             	shr    $0xc,%eax
+  801b73:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b7a:	f6 c2 01             	test   $0x1,%dl
+  801b7d:	75 36                	jne    801bb5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b7f:	89 f8                	mov    %edi,%eax
+  801b81:	c1 e8 0c             	shr    $0xc,%eax
+  801b84:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b8b:	83 ec 0c             	sub    $0xc,%esp
+  801b8e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b93:	50                   	push   %eax
+  801b94:	56                   	push   %esi
+  801b95:	6a 00                	push   $0x0
+  801b97:	57                   	push   %edi
+  801b98:	6a 00                	push   $0x0
+  801b9a:	e8 c2 f1 ff ff       	call   800d61 <sys_page_map>
+  801b9f:	89 c3                	mov    %eax,%ebx
+  801ba1:	83 c4 20             	add    $0x20,%esp
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 33                	js     801bdb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ba8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bab:	89 d8                	mov    %ebx,%eax
+  801bad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb0:	5b                   	pop    %ebx
+  801bb1:	5e                   	pop    %esi
+  801bb2:	5f                   	pop    %edi
+  801bb3:	5d                   	pop    %ebp
+  801bb4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bb5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bbc:	83 ec 0c             	sub    $0xc,%esp
+  801bbf:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bc4:	50                   	push   %eax
+  801bc5:	ff 75 d4             	push   -0x2c(%ebp)
+  801bc8:	6a 00                	push   $0x0
+  801bca:	53                   	push   %ebx
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 8f f1 ff ff       	call   800d61 <sys_page_map>
+  801bd2:	89 c3                	mov    %eax,%ebx
+  801bd4:	83 c4 20             	add    $0x20,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	79 a4                	jns    801b7f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bdb:	83 ec 08             	sub    $0x8,%esp
+  801bde:	56                   	push   %esi
+  801bdf:	6a 00                	push   $0x0
+  801be1:	e8 bd f1 ff ff       	call   800da3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801be6:	83 c4 08             	add    $0x8,%esp
+  801be9:	ff 75 d4             	push   -0x2c(%ebp)
+  801bec:	6a 00                	push   $0x0
+  801bee:	e8 b0 f1 ff ff       	call   800da3 <sys_page_unmap>
+	return r;
+  801bf3:	83 c4 10             	add    $0x10,%esp
+  801bf6:	eb b3                	jmp    801bab <dup+0x9d>
+
+00801bf8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bf8:	55                   	push   %ebp
+  801bf9:	89 e5                	mov    %esp,%ebp
+  801bfb:	56                   	push   %esi
+  801bfc:	53                   	push   %ebx
+  801bfd:	83 ec 18             	sub    $0x18,%esp
+  801c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c03:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c06:	50                   	push   %eax
+  801c07:	53                   	push   %ebx
+  801c08:	e8 67 fd ff ff       	call   801974 <fd_lookup>
+  801c0d:	83 c4 10             	add    $0x10,%esp
+  801c10:	85 c0                	test   %eax,%eax
+  801c12:	78 3c                	js     801c50 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c14:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c17:	83 ec 08             	sub    $0x8,%esp
+  801c1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c1d:	50                   	push   %eax
+  801c1e:	ff 36                	push   (%esi)
+  801c20:	e8 a1 fd ff ff       	call   8019c6 <dev_lookup>
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 24                	js     801c50 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c2c:	8b 46 08             	mov    0x8(%esi),%eax
+  801c2f:	83 e0 03             	and    $0x3,%eax
+  801c32:	83 f8 01             	cmp    $0x1,%eax
+  801c35:	74 20                	je     801c57 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3a:	8b 40 08             	mov    0x8(%eax),%eax
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	74 54                	je     801c95 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c41:	83 ec 04             	sub    $0x4,%esp
+  801c44:	ff 75 10             	push   0x10(%ebp)
+  801c47:	ff 75 0c             	push   0xc(%ebp)
+  801c4a:	56                   	push   %esi
+  801c4b:	ff d0                	call   *%eax
+  801c4d:	83 c4 10             	add    $0x10,%esp
+}
+  801c50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c53:	5b                   	pop    %ebx
+  801c54:	5e                   	pop    %esi
+  801c55:	5d                   	pop    %ebp
+  801c56:	c3                   	ret
+  801c57:	89 e2                	mov    %esp,%edx
+  801c59:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c5e:	29 d0                	sub    %edx,%eax
+  801c60:	89 c2                	mov    %eax,%edx
+  801c62:	c1 ea 0f             	shr    $0xf,%edx
+  801c65:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c72:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801c79:	8b 40 48             	mov    0x48(%eax),%eax
+  801c7c:	83 ec 04             	sub    $0x4,%esp
+  801c7f:	53                   	push   %ebx
+  801c80:	50                   	push   %eax
+  801c81:	68 b1 49 80 00       	push   $0x8049b1
+  801c86:	e8 68 e5 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c93:	eb bb                	jmp    801c50 <read+0x58>
+		return -E_NOT_SUPP;
+  801c95:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c9a:	eb b4                	jmp    801c50 <read+0x58>
+
+00801c9c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c9c:	55                   	push   %ebp
+  801c9d:	89 e5                	mov    %esp,%ebp
+  801c9f:	57                   	push   %edi
+  801ca0:	56                   	push   %esi
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 0c             	sub    $0xc,%esp
+  801ca5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ca8:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801cab:	85 f6                	test   %esi,%esi
+  801cad:	74 30                	je     801cdf <readn+0x43>
+  801caf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	89 f2                	mov    %esi,%edx
+  801cbe:	29 c2                	sub    %eax,%edx
+  801cc0:	52                   	push   %edx
+  801cc1:	01 f8                	add    %edi,%eax
+  801cc3:	50                   	push   %eax
+  801cc4:	ff 75 08             	push   0x8(%ebp)
+  801cc7:	e8 2c ff ff ff       	call   801bf8 <read>
+		if (m < 0)
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	78 15                	js     801ce8 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801cd3:	74 11                	je     801ce6 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801cd5:	01 c3                	add    %eax,%ebx
+  801cd7:	89 d8                	mov    %ebx,%eax
+  801cd9:	39 f3                	cmp    %esi,%ebx
+  801cdb:	72 dc                	jb     801cb9 <readn+0x1d>
+  801cdd:	eb 09                	jmp    801ce8 <readn+0x4c>
+  801cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce4:	eb 02                	jmp    801ce8 <readn+0x4c>
+  801ce6:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ceb:	5b                   	pop    %ebx
+  801cec:	5e                   	pop    %esi
+  801ced:	5f                   	pop    %edi
+  801cee:	5d                   	pop    %ebp
+  801cef:	c3                   	ret
+
+00801cf0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cf0:	55                   	push   %ebp
+  801cf1:	89 e5                	mov    %esp,%ebp
+  801cf3:	56                   	push   %esi
+  801cf4:	53                   	push   %ebx
+  801cf5:	83 ec 18             	sub    $0x18,%esp
+  801cf8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cfb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cfe:	50                   	push   %eax
+  801cff:	53                   	push   %ebx
+  801d00:	e8 6f fc ff ff       	call   801974 <fd_lookup>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 37                	js     801d43 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d0c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d15:	50                   	push   %eax
+  801d16:	ff 36                	push   (%esi)
+  801d18:	e8 a9 fc ff ff       	call   8019c6 <dev_lookup>
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 1f                	js     801d43 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d24:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d28:	74 20                	je     801d4a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d2d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d30:	85 c0                	test   %eax,%eax
+  801d32:	74 54                	je     801d88 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d34:	83 ec 04             	sub    $0x4,%esp
+  801d37:	ff 75 10             	push   0x10(%ebp)
+  801d3a:	ff 75 0c             	push   0xc(%ebp)
+  801d3d:	56                   	push   %esi
+  801d3e:	ff d0                	call   *%eax
+  801d40:	83 c4 10             	add    $0x10,%esp
+}
+  801d43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d46:	5b                   	pop    %ebx
+  801d47:	5e                   	pop    %esi
+  801d48:	5d                   	pop    %ebp
+  801d49:	c3                   	ret
+  801d4a:	89 e2                	mov    %esp,%edx
+  801d4c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d51:	29 d0                	sub    %edx,%eax
+  801d53:	89 c2                	mov    %eax,%edx
+  801d55:	c1 ea 0f             	shr    $0xf,%edx
+  801d58:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d62:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d65:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d6c:	8b 40 48             	mov    0x48(%eax),%eax
+  801d6f:	83 ec 04             	sub    $0x4,%esp
+  801d72:	53                   	push   %ebx
+  801d73:	50                   	push   %eax
+  801d74:	68 cd 49 80 00       	push   $0x8049cd
+  801d79:	e8 75 e4 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801d7e:	83 c4 10             	add    $0x10,%esp
+  801d81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d86:	eb bb                	jmp    801d43 <write+0x53>
+		return -E_NOT_SUPP;
+  801d88:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8d:	eb b4                	jmp    801d43 <write+0x53>
+
+00801d8f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d98:	50                   	push   %eax
+  801d99:	ff 75 08             	push   0x8(%ebp)
+  801d9c:	e8 d3 fb ff ff       	call   801974 <fd_lookup>
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 0e                	js     801db6 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801da8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dae:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db6:	c9                   	leave
+  801db7:	c3                   	ret
+
+00801db8 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801db8:	55                   	push   %ebp
+  801db9:	89 e5                	mov    %esp,%ebp
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 1c             	sub    $0x1c,%esp
+  801dbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dc2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc5:	50                   	push   %eax
+  801dc6:	ff 75 08             	push   0x8(%ebp)
+  801dc9:	e8 a6 fb ff ff       	call   801974 <fd_lookup>
+  801dce:	83 c4 10             	add    $0x10,%esp
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 33                	js     801e08 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801dd5:	83 fb 03             	cmp    $0x3,%ebx
+  801dd8:	74 28                	je     801e02 <fcntl+0x4a>
+  801dda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ddf:	83 fb 04             	cmp    $0x4,%ebx
+  801de2:	75 24                	jne    801e08 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801de4:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801de7:	8b 41 08             	mov    0x8(%ecx),%eax
+  801dea:	80 e4 ef             	and    $0xef,%ah
+  801ded:	8b 55 10             	mov    0x10(%ebp),%edx
+  801df0:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801df6:	09 d0                	or     %edx,%eax
+  801df8:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e00:	eb 06                	jmp    801e08 <fcntl+0x50>
+		return fd->fd_omode;
+  801e02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e05:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801e08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0b:	c9                   	leave
+  801e0c:	c3                   	ret
+
+00801e0d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e0d:	55                   	push   %ebp
+  801e0e:	89 e5                	mov    %esp,%ebp
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 18             	sub    $0x18,%esp
+  801e15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e1b:	50                   	push   %eax
+  801e1c:	53                   	push   %ebx
+  801e1d:	e8 52 fb ff ff       	call   801974 <fd_lookup>
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 34                	js     801e5d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+  801e2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e32:	50                   	push   %eax
+  801e33:	ff 36                	push   (%esi)
+  801e35:	e8 8c fb ff ff       	call   8019c6 <dev_lookup>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 1c                	js     801e5d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e41:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e45:	74 1d                	je     801e64 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e4a:	8b 40 18             	mov    0x18(%eax),%eax
+  801e4d:	85 c0                	test   %eax,%eax
+  801e4f:	74 51                	je     801ea2 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e51:	83 ec 08             	sub    $0x8,%esp
+  801e54:	ff 75 0c             	push   0xc(%ebp)
+  801e57:	56                   	push   %esi
+  801e58:	ff d0                	call   *%eax
+  801e5a:	83 c4 10             	add    $0x10,%esp
+}
+  801e5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e60:	5b                   	pop    %ebx
+  801e61:	5e                   	pop    %esi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+  801e64:	89 e2                	mov    %esp,%edx
+  801e66:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e6b:	29 d0                	sub    %edx,%eax
+  801e6d:	89 c2                	mov    %eax,%edx
+  801e6f:	c1 ea 0f             	shr    $0xf,%edx
+  801e72:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7c:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801e7f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e86:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e89:	83 ec 04             	sub    $0x4,%esp
+  801e8c:	53                   	push   %ebx
+  801e8d:	50                   	push   %eax
+  801e8e:	68 90 49 80 00       	push   $0x804990
+  801e93:	e8 5b e3 ff ff       	call   8001f3 <cprintf>
+		return -E_INVAL;
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea0:	eb bb                	jmp    801e5d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801ea2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ea7:	eb b4                	jmp    801e5d <ftruncate+0x50>
+
+00801ea9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ea9:	55                   	push   %ebp
+  801eaa:	89 e5                	mov    %esp,%ebp
+  801eac:	56                   	push   %esi
+  801ead:	53                   	push   %ebx
+  801eae:	83 ec 18             	sub    $0x18,%esp
+  801eb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801eb4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eb7:	50                   	push   %eax
+  801eb8:	ff 75 08             	push   0x8(%ebp)
+  801ebb:	e8 b4 fa ff ff       	call   801974 <fd_lookup>
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	78 53                	js     801f1a <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ec7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eca:	83 ec 08             	sub    $0x8,%esp
+  801ecd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed0:	50                   	push   %eax
+  801ed1:	ff 36                	push   (%esi)
+  801ed3:	e8 ee fa ff ff       	call   8019c6 <dev_lookup>
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 3b                	js     801f1a <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801edf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ee2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801ee6:	74 39                	je     801f21 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801ee8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801eeb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ef2:	00 00 00 
+	stat->st_isdir = 0;
+  801ef5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801efc:	00 00 00 
+	stat->st_version = 0;
+  801eff:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801f06:	00 00 00 
+	stat->st_dev = dev;
+  801f09:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f0f:	83 ec 08             	sub    $0x8,%esp
+  801f12:	53                   	push   %ebx
+  801f13:	56                   	push   %esi
+  801f14:	ff 50 14             	call   *0x14(%eax)
+  801f17:	83 c4 10             	add    $0x10,%esp
+}
+  801f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f1d:	5b                   	pop    %ebx
+  801f1e:	5e                   	pop    %esi
+  801f1f:	5d                   	pop    %ebp
+  801f20:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f26:	eb f2                	jmp    801f1a <fstat+0x71>
+
+00801f28 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	56                   	push   %esi
+  801f2c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+  801f30:	6a 00                	push   $0x0
+  801f32:	ff 75 08             	push   0x8(%ebp)
+  801f35:	e8 b7 01 00 00       	call   8020f1 <open>
+  801f3a:	89 c3                	mov    %eax,%ebx
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 1b                	js     801f5e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f43:	83 ec 08             	sub    $0x8,%esp
+  801f46:	ff 75 0c             	push   0xc(%ebp)
+  801f49:	50                   	push   %eax
+  801f4a:	e8 5a ff ff ff       	call   801ea9 <fstat>
+  801f4f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801f51:	89 1c 24             	mov    %ebx,(%esp)
+  801f54:	e8 60 fb ff ff       	call   801ab9 <close>
+	return r;
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	89 f3                	mov    %esi,%ebx
+}
+  801f5e:	89 d8                	mov    %ebx,%eax
+  801f60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f63:	5b                   	pop    %ebx
+  801f64:	5e                   	pop    %esi
+  801f65:	5d                   	pop    %ebp
+  801f66:	c3                   	ret
+
+00801f67 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f67:	55                   	push   %ebp
+  801f68:	89 e5                	mov    %esp,%ebp
+  801f6a:	56                   	push   %esi
+  801f6b:	53                   	push   %ebx
+  801f6c:	89 c6                	mov    %eax,%esi
+  801f6e:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801f70:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  801f77:	74 27                	je     801fa0 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801f79:	6a 07                	push   $0x7
+  801f7b:	68 00 70 80 00       	push   $0x807000
+  801f80:	56                   	push   %esi
+  801f81:	ff 35 c4 66 80 00    	push   0x8066c4
+  801f87:	e8 06 22 00 00       	call   804192 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801f8c:	83 c4 0c             	add    $0xc,%esp
+  801f8f:	6a 00                	push   $0x0
+  801f91:	53                   	push   %ebx
+  801f92:	6a 00                	push   $0x0
+  801f94:	e8 69 1f 00 00       	call   803f02 <ipc_recv>
+}
+  801f99:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f9c:	5b                   	pop    %ebx
+  801f9d:	5e                   	pop    %esi
+  801f9e:	5d                   	pop    %ebp
+  801f9f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801fa0:	83 ec 0c             	sub    $0xc,%esp
+  801fa3:	6a 02                	push   $0x2
+  801fa5:	e8 51 22 00 00       	call   8041fb <ipc_find_env>
+  801faa:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  801faf:	83 c4 10             	add    $0x10,%esp
+  801fb2:	eb c5                	jmp    801f79 <fsipc+0x12>
+
+00801fb4 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801fc5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801fd7:	e8 8b ff ff ff       	call   801f67 <fsipc>
+}
+  801fdc:	c9                   	leave
+  801fdd:	c3                   	ret
+
+00801fde <devfile_flush>:
+{
+  801fde:	55                   	push   %ebp
+  801fdf:	89 e5                	mov    %esp,%ebp
+  801fe1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801fe4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fea:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801fef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ff9:	e8 69 ff ff ff       	call   801f67 <fsipc>
+}
+  801ffe:	c9                   	leave
+  801fff:	c3                   	ret
+
+00802000 <devfile_stat>:
+{
+  802000:	55                   	push   %ebp
+  802001:	89 e5                	mov    %esp,%ebp
+  802003:	53                   	push   %ebx
+  802004:	83 ec 04             	sub    $0x4,%esp
+  802007:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80200a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80200d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802010:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802015:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80201f:	e8 43 ff ff ff       	call   801f67 <fsipc>
+  802024:	85 c0                	test   %eax,%eax
+  802026:	78 37                	js     80205f <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802028:	83 ec 08             	sub    $0x8,%esp
+  80202b:	68 00 70 80 00       	push   $0x807000
+  802030:	53                   	push   %ebx
+  802031:	e8 b4 e8 ff ff       	call   8008ea <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802036:	a1 80 70 80 00       	mov    0x807080,%eax
+  80203b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802041:	a1 84 70 80 00       	mov    0x807084,%eax
+  802046:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80204c:	a1 88 70 80 00       	mov    0x807088,%eax
+  802051:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802057:	83 c4 10             	add    $0x10,%esp
+  80205a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802062:	c9                   	leave
+  802063:	c3                   	ret
+
+00802064 <devfile_write>:
+{
+  802064:	55                   	push   %ebp
+  802065:	89 e5                	mov    %esp,%ebp
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80206d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802072:	39 d0                	cmp    %edx,%eax
+  802074:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80207a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80207d:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  802083:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802088:	50                   	push   %eax
+  802089:	ff 75 0c             	push   0xc(%ebp)
+  80208c:	68 08 70 80 00       	push   $0x807008
+  802091:	e8 04 ea ff ff       	call   800a9a <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802096:	ba 00 00 00 00       	mov    $0x0,%edx
+  80209b:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020a0:	e8 c2 fe ff ff       	call   801f67 <fsipc>
+}
+  8020a5:	c9                   	leave
+  8020a6:	c3                   	ret
+
+008020a7 <devfile_read>:
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	53                   	push   %ebx
+  8020ab:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8020b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020bc:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8020c1:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8020c6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020cb:	e8 97 fe ff ff       	call   801f67 <fsipc>
+  8020d0:	89 c3                	mov    %eax,%ebx
+  8020d2:	85 c0                	test   %eax,%eax
+  8020d4:	78 14                	js     8020ea <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8020d6:	83 ec 04             	sub    $0x4,%esp
+  8020d9:	50                   	push   %eax
+  8020da:	68 00 70 80 00       	push   $0x807000
+  8020df:	ff 75 0c             	push   0xc(%ebp)
+  8020e2:	e8 b3 e9 ff ff       	call   800a9a <memmove>
+	return r;
+  8020e7:	83 c4 10             	add    $0x10,%esp
+}
+  8020ea:	89 d8                	mov    %ebx,%eax
+  8020ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ef:	c9                   	leave
+  8020f0:	c3                   	ret
+
+008020f1 <open>:
+{
+  8020f1:	55                   	push   %ebp
+  8020f2:	89 e5                	mov    %esp,%ebp
+  8020f4:	53                   	push   %ebx
+  8020f5:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8020f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020fb:	50                   	push   %eax
+  8020fc:	e8 23 f8 ff ff       	call   801924 <fd_alloc>
+  802101:	89 c3                	mov    %eax,%ebx
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	85 c0                	test   %eax,%eax
+  802108:	78 2a                	js     802134 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80210a:	83 ec 0c             	sub    $0xc,%esp
+  80210d:	ff 75 08             	push   0x8(%ebp)
+  802110:	e8 89 e7 ff ff       	call   80089e <strlen>
+  802115:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802118:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80211d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802122:	7e 17                	jle    80213b <open+0x4a>
+	fd_close(fd, 1);
+  802124:	83 ec 08             	sub    $0x8,%esp
+  802127:	6a 01                	push   $0x1
+  802129:	ff 75 f4             	push   -0xc(%ebp)
+  80212c:	e8 08 f9 ff ff       	call   801a39 <fd_close>
+	return r;
+  802131:	83 c4 10             	add    $0x10,%esp
+}
+  802134:	89 d8                	mov    %ebx,%eax
+  802136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802139:	c9                   	leave
+  80213a:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80213b:	83 ec 08             	sub    $0x8,%esp
+  80213e:	ff 75 08             	push   0x8(%ebp)
+  802141:	68 00 70 80 00       	push   $0x807000
+  802146:	e8 9f e7 ff ff       	call   8008ea <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80214b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214e:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802153:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802156:	b8 01 00 00 00       	mov    $0x1,%eax
+  80215b:	e8 07 fe ff ff       	call   801f67 <fsipc>
+  802160:	89 c3                	mov    %eax,%ebx
+  802162:	83 c4 10             	add    $0x10,%esp
+  802165:	85 c0                	test   %eax,%eax
+  802167:	78 bb                	js     802124 <open+0x33>
+	return fd2num(fd); 	
+  802169:	83 ec 0c             	sub    $0xc,%esp
+  80216c:	ff 75 f4             	push   -0xc(%ebp)
+  80216f:	e8 89 f7 ff ff       	call   8018fd <fd2num>
+  802174:	89 c3                	mov    %eax,%ebx
+  802176:	83 c4 10             	add    $0x10,%esp
+  802179:	eb b9                	jmp    802134 <open+0x43>
+
+0080217b <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	53                   	push   %ebx
+  80217f:	83 ec 1c             	sub    $0x1c,%esp
+  802182:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802185:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802188:	50                   	push   %eax
+  802189:	ff 75 08             	push   0x8(%ebp)
+  80218c:	e8 e3 f7 ff ff       	call   801974 <fd_lookup>
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	85 c0                	test   %eax,%eax
+  802196:	78 5a                	js     8021f2 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802198:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80219b:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8021a1:	39 10                	cmp    %edx,(%eax)
+  8021a3:	75 66                	jne    80220b <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8021a5:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8021ac:	74 49                	je     8021f7 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8021ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021b4:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8021b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021bc:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  8021c1:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8021c7:	6a 07                	push   $0x7
+  8021c9:	68 00 70 80 00       	push   $0x807000
+  8021ce:	6a 09                	push   $0x9
+  8021d0:	ff 35 c4 66 80 00    	push   0x8066c4
+  8021d6:	e8 b7 1f 00 00       	call   804192 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8021db:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8021e2:	6a 00                	push   $0x0
+  8021e4:	53                   	push   %ebx
+  8021e5:	ff 75 10             	push   0x10(%ebp)
+  8021e8:	6a 00                	push   $0x0
+  8021ea:	e8 e0 1d 00 00       	call   803fcf <ipc_recv_pages>
+  8021ef:	83 c4 20             	add    $0x20,%esp
+}
+  8021f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f5:	c9                   	leave
+  8021f6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021f7:	83 ec 0c             	sub    $0xc,%esp
+  8021fa:	6a 02                	push   $0x2
+  8021fc:	e8 fa 1f 00 00       	call   8041fb <ipc_find_env>
+  802201:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	eb a3                	jmp    8021ae <fmap+0x33>
+		return -E_INVAL;
+  80220b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802210:	eb e0                	jmp    8021f2 <fmap+0x77>
+
+00802212 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	53                   	push   %ebx
+  802216:	83 ec 10             	sub    $0x10,%esp
+  802219:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80221c:	53                   	push   %ebx
+  80221d:	e8 7c e6 ff ff       	call   80089e <strlen>
+  802222:	83 c4 10             	add    $0x10,%esp
+  802225:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80222a:	7f 25                	jg     802251 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80222c:	83 ec 08             	sub    $0x8,%esp
+  80222f:	53                   	push   %ebx
+  802230:	68 00 70 80 00       	push   $0x807000
+  802235:	e8 b0 e6 ff ff       	call   8008ea <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80223a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802244:	e8 1e fd ff ff       	call   801f67 <fsipc>
+  802249:	83 c4 10             	add    $0x10,%esp
+}
+  80224c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80224f:	c9                   	leave
+  802250:	c3                   	ret
+		return -E_BAD_PATH;
+  802251:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802256:	eb f4                	jmp    80224c <remove+0x3a>
+
+00802258 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802258:	55                   	push   %ebp
+  802259:	89 e5                	mov    %esp,%ebp
+  80225b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80225e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802263:	b8 08 00 00 00       	mov    $0x8,%eax
+  802268:	e8 fa fc ff ff       	call   801f67 <fsipc>
+}
+  80226d:	c9                   	leave
+  80226e:	c3                   	ret
+
+0080226f <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802275:	68 00 4a 80 00       	push   $0x804a00
+  80227a:	ff 75 0c             	push   0xc(%ebp)
+  80227d:	e8 68 e6 ff ff       	call   8008ea <strcpy>
+	return 0;
+}
+  802282:	b8 00 00 00 00       	mov    $0x0,%eax
+  802287:	c9                   	leave
+  802288:	c3                   	ret
+
+00802289 <devsock_close>:
+{
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	53                   	push   %ebx
+  80228d:	83 ec 10             	sub    $0x10,%esp
+  802290:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802293:	53                   	push   %ebx
+  802294:	e8 a1 1f 00 00       	call   80423a <pageref>
+  802299:	89 c2                	mov    %eax,%edx
+  80229b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80229e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8022a3:	83 fa 01             	cmp    $0x1,%edx
+  8022a6:	74 05                	je     8022ad <devsock_close+0x24>
+}
+  8022a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8022ad:	83 ec 0c             	sub    $0xc,%esp
+  8022b0:	ff 73 0c             	push   0xc(%ebx)
+  8022b3:	e8 b0 05 00 00       	call   802868 <nsipc_close>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	eb eb                	jmp    8022a8 <devsock_close+0x1f>
+
+008022bd <devsock_write>:
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	53                   	push   %ebx
+  8022c1:	83 ec 14             	sub    $0x14,%esp
+  8022c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022ca:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8022cd:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8022d0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8022d3:	8b 41 08             	mov    0x8(%ecx),%eax
+  8022d6:	c1 f8 09             	sar    $0x9,%eax
+  8022d9:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8022dc:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8022e2:	77 13                	ja     8022f7 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8022e4:	50                   	push   %eax
+  8022e5:	52                   	push   %edx
+  8022e6:	53                   	push   %ebx
+  8022e7:	ff 71 0c             	push   0xc(%ecx)
+  8022ea:	e8 5c 06 00 00       	call   80294b <nsipc_send>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+}
+  8022f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022f5:	c9                   	leave
+  8022f6:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8022f7:	50                   	push   %eax
+  8022f8:	6a 01                	push   $0x1
+  8022fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022fd:	50                   	push   %eax
+  8022fe:	ff 71 0c             	push   0xc(%ecx)
+  802301:	e8 a6 06 00 00       	call   8029ac <nsipc_sendmsg>
+  802306:	83 c4 10             	add    $0x10,%esp
+  802309:	eb e7                	jmp    8022f2 <devsock_write+0x35>
+
+0080230b <devsock_read>:
+{
+  80230b:	55                   	push   %ebp
+  80230c:	89 e5                	mov    %esp,%ebp
+  80230e:	53                   	push   %ebx
+  80230f:	83 ec 14             	sub    $0x14,%esp
+  802312:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802315:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802318:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80231b:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80231e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802321:	8b 41 08             	mov    0x8(%ecx),%eax
+  802324:	c1 f8 09             	sar    $0x9,%eax
+  802327:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80232a:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802330:	77 13                	ja     802345 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802332:	50                   	push   %eax
+  802333:	52                   	push   %edx
+  802334:	53                   	push   %ebx
+  802335:	ff 71 0c             	push   0xc(%ecx)
+  802338:	e8 9c 05 00 00       	call   8028d9 <nsipc_recv>
+  80233d:	83 c4 10             	add    $0x10,%esp
+}
+  802340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802343:	c9                   	leave
+  802344:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802345:	50                   	push   %eax
+  802346:	6a 01                	push   $0x1
+  802348:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80234b:	50                   	push   %eax
+  80234c:	ff 71 0c             	push   0xc(%ecx)
+  80234f:	e8 02 0a 00 00       	call   802d56 <nsipc_recvmsg>
+  802354:	83 c4 10             	add    $0x10,%esp
+  802357:	eb e7                	jmp    802340 <devsock_read+0x35>
+
+00802359 <fd2sockid>:
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80235f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802362:	52                   	push   %edx
+  802363:	50                   	push   %eax
+  802364:	e8 0b f6 ff ff       	call   801974 <fd_lookup>
+  802369:	83 c4 10             	add    $0x10,%esp
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	78 10                	js     802380 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802370:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802373:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802379:	39 08                	cmp    %ecx,(%eax)
+  80237b:	75 05                	jne    802382 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80237d:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+		return -E_NOT_SUPP;
+  802382:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802387:	eb f7                	jmp    802380 <fd2sockid+0x27>
+
+00802389 <sock_flags>:
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80238f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802392:	52                   	push   %edx
+  802393:	50                   	push   %eax
+  802394:	e8 db f5 ff ff       	call   801974 <fd_lookup>
+  802399:	83 c4 10             	add    $0x10,%esp
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	78 0e                	js     8023ae <sock_flags+0x25>
+  8023a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a3:	8b 40 08             	mov    0x8(%eax),%eax
+  8023a6:	c1 e8 09             	shr    $0x9,%eax
+  8023a9:	83 e0 08             	and    $0x8,%eax
+}
+  8023ac:	c9                   	leave
+  8023ad:	c3                   	ret
+		return 0;
+  8023ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b3:	eb f7                	jmp    8023ac <sock_flags+0x23>
+
+008023b5 <alloc_sockfd>:
+{
+  8023b5:	55                   	push   %ebp
+  8023b6:	89 e5                	mov    %esp,%ebp
+  8023b8:	56                   	push   %esi
+  8023b9:	53                   	push   %ebx
+  8023ba:	83 ec 1c             	sub    $0x1c,%esp
+  8023bd:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8023bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023c2:	50                   	push   %eax
+  8023c3:	e8 5c f5 ff ff       	call   801924 <fd_alloc>
+  8023c8:	89 c3                	mov    %eax,%ebx
+  8023ca:	83 c4 10             	add    $0x10,%esp
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	78 43                	js     802414 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8023d1:	83 ec 04             	sub    $0x4,%esp
+  8023d4:	68 07 04 00 00       	push   $0x407
+  8023d9:	ff 75 f4             	push   -0xc(%ebp)
+  8023dc:	6a 00                	push   $0x0
+  8023de:	e8 3b e9 ff ff       	call   800d1e <sys_page_alloc>
+  8023e3:	89 c3                	mov    %eax,%ebx
+  8023e5:	83 c4 10             	add    $0x10,%esp
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	78 28                	js     802414 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8023ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ef:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8023f5:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8023f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023fa:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802401:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802404:	83 ec 0c             	sub    $0xc,%esp
+  802407:	50                   	push   %eax
+  802408:	e8 f0 f4 ff ff       	call   8018fd <fd2num>
+  80240d:	89 c3                	mov    %eax,%ebx
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	eb 0c                	jmp    802420 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802414:	83 ec 0c             	sub    $0xc,%esp
+  802417:	56                   	push   %esi
+  802418:	e8 4b 04 00 00       	call   802868 <nsipc_close>
+		return r;
+  80241d:	83 c4 10             	add    $0x10,%esp
+}
+  802420:	89 d8                	mov    %ebx,%eax
+  802422:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802425:	5b                   	pop    %ebx
+  802426:	5e                   	pop    %esi
+  802427:	5d                   	pop    %ebp
+  802428:	c3                   	ret
+
+00802429 <accept>:
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	56                   	push   %esi
+  80242d:	53                   	push   %ebx
+  80242e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802431:	89 f0                	mov    %esi,%eax
+  802433:	e8 21 ff ff ff       	call   802359 <fd2sockid>
+  802438:	89 c3                	mov    %eax,%ebx
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	78 24                	js     802462 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80243e:	89 f0                	mov    %esi,%eax
+  802440:	e8 44 ff ff ff       	call   802389 <sock_flags>
+  802445:	50                   	push   %eax
+  802446:	ff 75 10             	push   0x10(%ebp)
+  802449:	ff 75 0c             	push   0xc(%ebp)
+  80244c:	53                   	push   %ebx
+  80244d:	e8 6b 03 00 00       	call   8027bd <nsipc_accept>
+  802452:	89 c3                	mov    %eax,%ebx
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 07                	js     802462 <accept+0x39>
+	return alloc_sockfd(r);
+  80245b:	e8 55 ff ff ff       	call   8023b5 <alloc_sockfd>
+  802460:	89 c3                	mov    %eax,%ebx
+}
+  802462:	89 d8                	mov    %ebx,%eax
+  802464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802467:	5b                   	pop    %ebx
+  802468:	5e                   	pop    %esi
+  802469:	5d                   	pop    %ebp
+  80246a:	c3                   	ret
+
+0080246b <bind>:
+{
+  80246b:	55                   	push   %ebp
+  80246c:	89 e5                	mov    %esp,%ebp
+  80246e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	e8 e0 fe ff ff       	call   802359 <fd2sockid>
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	78 12                	js     80248f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80247d:	83 ec 04             	sub    $0x4,%esp
+  802480:	ff 75 10             	push   0x10(%ebp)
+  802483:	ff 75 0c             	push   0xc(%ebp)
+  802486:	50                   	push   %eax
+  802487:	e8 85 03 00 00       	call   802811 <nsipc_bind>
+  80248c:	83 c4 10             	add    $0x10,%esp
+}
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+
+00802491 <shutdown>:
+{
+  802491:	55                   	push   %ebp
+  802492:	89 e5                	mov    %esp,%ebp
+  802494:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802497:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249a:	e8 ba fe ff ff       	call   802359 <fd2sockid>
+  80249f:	85 c0                	test   %eax,%eax
+  8024a1:	78 0f                	js     8024b2 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8024a3:	83 ec 08             	sub    $0x8,%esp
+  8024a6:	ff 75 0c             	push   0xc(%ebp)
+  8024a9:	50                   	push   %eax
+  8024aa:	e8 97 03 00 00       	call   802846 <nsipc_shutdown>
+  8024af:	83 c4 10             	add    $0x10,%esp
+}
+  8024b2:	c9                   	leave
+  8024b3:	c3                   	ret
+
+008024b4 <connect>:
+{
+  8024b4:	55                   	push   %ebp
+  8024b5:	89 e5                	mov    %esp,%ebp
+  8024b7:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bd:	e8 97 fe ff ff       	call   802359 <fd2sockid>
+  8024c2:	85 c0                	test   %eax,%eax
+  8024c4:	78 12                	js     8024d8 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8024c6:	83 ec 04             	sub    $0x4,%esp
+  8024c9:	ff 75 10             	push   0x10(%ebp)
+  8024cc:	ff 75 0c             	push   0xc(%ebp)
+  8024cf:	50                   	push   %eax
+  8024d0:	e8 ad 03 00 00       	call   802882 <nsipc_connect>
+  8024d5:	83 c4 10             	add    $0x10,%esp
+}
+  8024d8:	c9                   	leave
+  8024d9:	c3                   	ret
+
+008024da <listen>:
+{
+  8024da:	55                   	push   %ebp
+  8024db:	89 e5                	mov    %esp,%ebp
+  8024dd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8024e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e3:	e8 71 fe ff ff       	call   802359 <fd2sockid>
+  8024e8:	85 c0                	test   %eax,%eax
+  8024ea:	78 0f                	js     8024fb <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8024ec:	83 ec 08             	sub    $0x8,%esp
+  8024ef:	ff 75 0c             	push   0xc(%ebp)
+  8024f2:	50                   	push   %eax
+  8024f3:	e8 bf 03 00 00       	call   8028b7 <nsipc_listen>
+  8024f8:	83 c4 10             	add    $0x10,%esp
+}
+  8024fb:	c9                   	leave
+  8024fc:	c3                   	ret
+
+008024fd <sendmsg>:
+{
+  8024fd:	55                   	push   %ebp
+  8024fe:	89 e5                	mov    %esp,%ebp
+  802500:	57                   	push   %edi
+  802501:	56                   	push   %esi
+  802502:	53                   	push   %ebx
+  802503:	83 ec 0c             	sub    $0xc,%esp
+  802506:	8b 75 08             	mov    0x8(%ebp),%esi
+  802509:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80250c:	89 f0                	mov    %esi,%eax
+  80250e:	e8 46 fe ff ff       	call   802359 <fd2sockid>
+  802513:	89 c3                	mov    %eax,%ebx
+  802515:	85 c0                	test   %eax,%eax
+  802517:	78 1c                	js     802535 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802519:	89 f0                	mov    %esi,%eax
+  80251b:	e8 69 fe ff ff       	call   802389 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802520:	0b 45 10             	or     0x10(%ebp),%eax
+  802523:	50                   	push   %eax
+  802524:	ff 77 0c             	push   0xc(%edi)
+  802527:	ff 77 08             	push   0x8(%edi)
+  80252a:	53                   	push   %ebx
+  80252b:	e8 7c 04 00 00       	call   8029ac <nsipc_sendmsg>
+  802530:	89 c3                	mov    %eax,%ebx
+  802532:	83 c4 10             	add    $0x10,%esp
+}
+  802535:	89 d8                	mov    %ebx,%eax
+  802537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80253a:	5b                   	pop    %ebx
+  80253b:	5e                   	pop    %esi
+  80253c:	5f                   	pop    %edi
+  80253d:	5d                   	pop    %ebp
+  80253e:	c3                   	ret
+
+0080253f <recvmsg>:
+{
+  80253f:	55                   	push   %ebp
+  802540:	89 e5                	mov    %esp,%ebp
+  802542:	57                   	push   %edi
+  802543:	56                   	push   %esi
+  802544:	53                   	push   %ebx
+  802545:	83 ec 0c             	sub    $0xc,%esp
+  802548:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80254b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80254e:	89 f8                	mov    %edi,%eax
+  802550:	e8 04 fe ff ff       	call   802359 <fd2sockid>
+  802555:	89 c3                	mov    %eax,%ebx
+  802557:	85 c0                	test   %eax,%eax
+  802559:	78 2a                	js     802585 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80255b:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802562:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802569:	89 f8                	mov    %edi,%eax
+  80256b:	e8 19 fe ff ff       	call   802389 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802570:	0b 45 10             	or     0x10(%ebp),%eax
+  802573:	50                   	push   %eax
+  802574:	ff 76 0c             	push   0xc(%esi)
+  802577:	ff 76 08             	push   0x8(%esi)
+  80257a:	53                   	push   %ebx
+  80257b:	e8 d6 07 00 00       	call   802d56 <nsipc_recvmsg>
+  802580:	89 c3                	mov    %eax,%ebx
+  802582:	83 c4 10             	add    $0x10,%esp
+}
+  802585:	89 d8                	mov    %ebx,%eax
+  802587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258a:	5b                   	pop    %ebx
+  80258b:	5e                   	pop    %esi
+  80258c:	5f                   	pop    %edi
+  80258d:	5d                   	pop    %ebp
+  80258e:	c3                   	ret
+
+0080258f <sendfile>:
+{
+  80258f:	55                   	push   %ebp
+  802590:	89 e5                	mov    %esp,%ebp
+  802592:	56                   	push   %esi
+  802593:	53                   	push   %ebx
+  802594:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802597:	89 f0                	mov    %esi,%eax
+  802599:	e8 bb fd ff ff       	call   802359 <fd2sockid>
+  80259e:	89 c3                	mov    %eax,%ebx
+  8025a0:	85 c0                	test   %eax,%eax
+  8025a2:	78 1f                	js     8025c3 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8025a4:	89 f0                	mov    %esi,%eax
+  8025a6:	e8 de fd ff ff       	call   802389 <sock_flags>
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	50                   	push   %eax
+  8025af:	ff 75 14             	push   0x14(%ebp)
+  8025b2:	ff 75 10             	push   0x10(%ebp)
+  8025b5:	ff 75 0c             	push   0xc(%ebp)
+  8025b8:	53                   	push   %ebx
+  8025b9:	e8 64 06 00 00       	call   802c22 <nsipc_sendfile>
+  8025be:	89 c3                	mov    %eax,%ebx
+  8025c0:	83 c4 20             	add    $0x20,%esp
+}
+  8025c3:	89 d8                	mov    %ebx,%eax
+  8025c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c8:	5b                   	pop    %ebx
+  8025c9:	5e                   	pop    %esi
+  8025ca:	5d                   	pop    %ebp
+  8025cb:	c3                   	ret
+
+008025cc <evctl>:
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	53                   	push   %ebx
+  8025d0:	83 ec 04             	sub    $0x4,%esp
+  8025d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8025d6:	89 d8                	mov    %ebx,%eax
+  8025d8:	e8 7c fd ff ff       	call   802359 <fd2sockid>
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	78 10                	js     8025f1 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8025e1:	83 ec 04             	sub    $0x4,%esp
+  8025e4:	53                   	push   %ebx
+  8025e5:	ff 75 0c             	push   0xc(%ebp)
+  8025e8:	50                   	push   %eax
+  8025e9:	e8 d2 0b 00 00       	call   8031c0 <nsipc_evctl>
+  8025ee:	83 c4 10             	add    $0x10,%esp
+}
+  8025f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f4:	c9                   	leave
+  8025f5:	c3                   	ret
+
+008025f6 <evwait>:
+{
+  8025f6:	55                   	push   %ebp
+  8025f7:	89 e5                	mov    %esp,%ebp
+  8025f9:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8025fc:	ff 75 10             	push   0x10(%ebp)
+  8025ff:	ff 75 0c             	push   0xc(%ebp)
+  802602:	ff 75 08             	push   0x8(%ebp)
+  802605:	e8 e0 0b 00 00       	call   8031ea <nsipc_evwait>
+}
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+
+0080260c <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80260c:	55                   	push   %ebp
+  80260d:	89 e5                	mov    %esp,%ebp
+  80260f:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802612:	ff 75 10             	push   0x10(%ebp)
+  802615:	ff 75 0c             	push   0xc(%ebp)
+  802618:	ff 75 08             	push   0x8(%ebp)
+  80261b:	e8 31 0c 00 00       	call   803251 <nsipc_socket>
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	78 05                	js     80262c <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802627:	e8 89 fd ff ff       	call   8023b5 <alloc_sockfd>
+}
+  80262c:	c9                   	leave
+  80262d:	c3                   	ret
+
+0080262e <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	53                   	push   %ebx
+  802632:	83 ec 04             	sub    $0x4,%esp
+  802635:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802637:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80263e:	74 26                	je     802666 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802640:	6a 07                	push   $0x7
+  802642:	68 00 80 80 00       	push   $0x808000
+  802647:	53                   	push   %ebx
+  802648:	ff 35 e4 69 80 00    	push   0x8069e4
+  80264e:	e8 3f 1b 00 00       	call   804192 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802653:	83 c4 0c             	add    $0xc,%esp
+  802656:	6a 00                	push   $0x0
+  802658:	6a 00                	push   $0x0
+  80265a:	6a 00                	push   $0x0
+  80265c:	e8 a1 18 00 00       	call   803f02 <ipc_recv>
+}
+  802661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802666:	83 ec 0c             	sub    $0xc,%esp
+  802669:	6a 03                	push   $0x3
+  80266b:	e8 8b 1b 00 00       	call   8041fb <ipc_find_env>
+  802670:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802675:	83 c4 10             	add    $0x10,%esp
+  802678:	eb c6                	jmp    802640 <nsipc+0x12>
+
+0080267a <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80267a:	55                   	push   %ebp
+  80267b:	89 e5                	mov    %esp,%ebp
+  80267d:	56                   	push   %esi
+  80267e:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80267f:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80268a:	85 f6                	test   %esi,%esi
+  80268c:	75 33                	jne    8026c1 <nsbulk_map+0x47>
+  80268e:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802693:	83 ec 04             	sub    $0x4,%esp
+  802696:	6a 07                	push   $0x7
+  802698:	53                   	push   %ebx
+  802699:	6a 00                	push   $0x0
+  80269b:	e8 7e e6 ff ff       	call   800d1e <sys_page_alloc>
+  8026a0:	83 c4 10             	add    $0x10,%esp
+  8026a3:	85 c0                	test   %eax,%eax
+  8026a5:	78 1a                	js     8026c1 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8026a7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026ad:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8026b3:	75 de                	jne    802693 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8026b5:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  8026bc:	00 00 00 
+	return 0;
+  8026bf:	89 f0                	mov    %esi,%eax
+}
+  8026c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c4:	5b                   	pop    %ebx
+  8026c5:	5e                   	pop    %esi
+  8026c6:	5d                   	pop    %ebp
+  8026c7:	c3                   	ret
+
+008026c8 <nsbulk_own>:
+{
+  8026c8:	55                   	push   %ebp
+  8026c9:	89 e5                	mov    %esp,%ebp
+  8026cb:	57                   	push   %edi
+  8026cc:	56                   	push   %esi
+  8026cd:	53                   	push   %ebx
+  8026ce:	83 ec 0c             	sub    $0xc,%esp
+  8026d1:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8026d3:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8026d6:	85 d2                	test   %edx,%edx
+  8026d8:	7f 0e                	jg     8026e8 <nsbulk_own+0x20>
+	return 0;
+  8026da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026df:	eb 47                	jmp    802728 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8026e1:	83 c3 01             	add    $0x1,%ebx
+  8026e4:	39 fb                	cmp    %edi,%ebx
+  8026e6:	7d 3b                	jge    802723 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8026e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ed:	89 d9                	mov    %ebx,%ecx
+  8026ef:	d3 e6                	shl    %cl,%esi
+  8026f1:	89 f0                	mov    %esi,%eax
+  8026f3:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  8026f9:	74 e6                	je     8026e1 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8026fb:	83 ec 04             	sub    $0x4,%esp
+  8026fe:	6a 07                	push   $0x7
+  802700:	89 d8                	mov    %ebx,%eax
+  802702:	c1 e0 0c             	shl    $0xc,%eax
+  802705:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80270a:	50                   	push   %eax
+  80270b:	6a 00                	push   $0x0
+  80270d:	e8 0c e6 ff ff       	call   800d1e <sys_page_alloc>
+  802712:	83 c4 10             	add    $0x10,%esp
+  802715:	85 c0                	test   %eax,%eax
+  802717:	78 0f                	js     802728 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802719:	f7 d6                	not    %esi
+  80271b:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802721:	eb be                	jmp    8026e1 <nsbulk_own+0x19>
+	return 0;
+  802723:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80272b:	5b                   	pop    %ebx
+  80272c:	5e                   	pop    %esi
+  80272d:	5f                   	pop    %edi
+  80272e:	5d                   	pop    %ebp
+  80272f:	c3                   	ret
+
+00802730 <nsipc_bulk>:
+{
+  802730:	55                   	push   %ebp
+  802731:	89 e5                	mov    %esp,%ebp
+  802733:	57                   	push   %edi
+  802734:	56                   	push   %esi
+  802735:	53                   	push   %ebx
+  802736:	83 ec 1c             	sub    $0x1c,%esp
+  802739:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80273c:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80273e:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802744:	c1 fb 0c             	sar    $0xc,%ebx
+  802747:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80274a:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802751:	74 56                	je     8027a9 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802753:	85 ff                	test   %edi,%edi
+  802755:	7e 24                	jle    80277b <nsipc_bulk+0x4b>
+  802757:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80275d:	74 1c                	je     80277b <nsipc_bulk+0x4b>
+  80275f:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802765:	c1 e3 0c             	shl    $0xc,%ebx
+  802768:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80276d:	0f b6 10             	movzbl (%eax),%edx
+  802770:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802772:	05 00 10 00 00       	add    $0x1000,%eax
+  802777:	39 d8                	cmp    %ebx,%eax
+  802779:	75 f2                	jne    80276d <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80277b:	83 ec 0c             	sub    $0xc,%esp
+  80277e:	56                   	push   %esi
+  80277f:	57                   	push   %edi
+  802780:	68 00 00 00 e0       	push   $0xe0000000
+  802785:	ff 75 e4             	push   -0x1c(%ebp)
+  802788:	ff 35 e4 69 80 00    	push   0x8069e4
+  80278e:	e8 33 1a 00 00       	call   8041c6 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802793:	83 c4 1c             	add    $0x1c,%esp
+  802796:	6a 00                	push   $0x0
+  802798:	6a 00                	push   $0x0
+  80279a:	6a 00                	push   $0x0
+  80279c:	e8 61 17 00 00       	call   803f02 <ipc_recv>
+}
+  8027a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a4:	5b                   	pop    %ebx
+  8027a5:	5e                   	pop    %esi
+  8027a6:	5f                   	pop    %edi
+  8027a7:	5d                   	pop    %ebp
+  8027a8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027a9:	83 ec 0c             	sub    $0xc,%esp
+  8027ac:	6a 03                	push   $0x3
+  8027ae:	e8 48 1a 00 00       	call   8041fb <ipc_find_env>
+  8027b3:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8027b8:	83 c4 10             	add    $0x10,%esp
+  8027bb:	eb 96                	jmp    802753 <nsipc_bulk+0x23>
+
+008027bd <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	53                   	push   %ebx
+  8027c1:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8027c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8027cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027cf:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8027d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027d9:	e8 50 fe ff ff       	call   80262e <nsipc>
+  8027de:	89 c3                	mov    %eax,%ebx
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	79 07                	jns    8027eb <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8027e4:	89 d8                	mov    %ebx,%eax
+  8027e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027e9:	c9                   	leave
+  8027ea:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8027eb:	83 ec 04             	sub    $0x4,%esp
+  8027ee:	ff 35 10 80 80 00    	push   0x808010
+  8027f4:	68 00 80 80 00       	push   $0x808000
+  8027f9:	ff 75 0c             	push   0xc(%ebp)
+  8027fc:	e8 99 e2 ff ff       	call   800a9a <memmove>
+		*addrlen = ret->ret_addrlen;
+  802801:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802807:	8b 45 10             	mov    0x10(%ebp),%eax
+  80280a:	89 10                	mov    %edx,(%eax)
+  80280c:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80280f:	eb d3                	jmp    8027e4 <nsipc_accept+0x27>
+
+00802811 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802811:	55                   	push   %ebp
+  802812:	89 e5                	mov    %esp,%ebp
+  802814:	53                   	push   %ebx
+  802815:	83 ec 08             	sub    $0x8,%esp
+  802818:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80281b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281e:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802823:	53                   	push   %ebx
+  802824:	ff 75 0c             	push   0xc(%ebp)
+  802827:	68 04 80 80 00       	push   $0x808004
+  80282c:	e8 69 e2 ff ff       	call   800a9a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802831:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802837:	b8 02 00 00 00       	mov    $0x2,%eax
+  80283c:	e8 ed fd ff ff       	call   80262e <nsipc>
+}
+  802841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802844:	c9                   	leave
+  802845:	c3                   	ret
+
+00802846 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80284c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802854:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802857:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80285c:	b8 03 00 00 00       	mov    $0x3,%eax
+  802861:	e8 c8 fd ff ff       	call   80262e <nsipc>
+}
+  802866:	c9                   	leave
+  802867:	c3                   	ret
+
+00802868 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80286e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802871:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802876:	b8 04 00 00 00       	mov    $0x4,%eax
+  80287b:	e8 ae fd ff ff       	call   80262e <nsipc>
+}
+  802880:	c9                   	leave
+  802881:	c3                   	ret
+
+00802882 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802882:	55                   	push   %ebp
+  802883:	89 e5                	mov    %esp,%ebp
+  802885:	53                   	push   %ebx
+  802886:	83 ec 08             	sub    $0x8,%esp
+  802889:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80288c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288f:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802894:	53                   	push   %ebx
+  802895:	ff 75 0c             	push   0xc(%ebp)
+  802898:	68 04 80 80 00       	push   $0x808004
+  80289d:	e8 f8 e1 ff ff       	call   800a9a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8028a2:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8028a8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8028ad:	e8 7c fd ff ff       	call   80262e <nsipc>
+}
+  8028b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b5:	c9                   	leave
+  8028b6:	c3                   	ret
+
+008028b7 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8028b7:	55                   	push   %ebp
+  8028b8:	89 e5                	mov    %esp,%ebp
+  8028ba:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8028bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8028c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028c8:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8028cd:	b8 06 00 00 00       	mov    $0x6,%eax
+  8028d2:	e8 57 fd ff ff       	call   80262e <nsipc>
+}
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	56                   	push   %esi
+  8028dd:	53                   	push   %ebx
+  8028de:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8028e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8028e9:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8028ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028f2:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8028f7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8028fc:	e8 2d fd ff ff       	call   80262e <nsipc>
+  802901:	89 c3                	mov    %eax,%ebx
+  802903:	85 c0                	test   %eax,%eax
+  802905:	78 22                	js     802929 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802907:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80290c:	39 c6                	cmp    %eax,%esi
+  80290e:	0f 4e c6             	cmovle %esi,%eax
+  802911:	39 c3                	cmp    %eax,%ebx
+  802913:	7f 1d                	jg     802932 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802915:	83 ec 04             	sub    $0x4,%esp
+  802918:	53                   	push   %ebx
+  802919:	68 00 80 80 00       	push   $0x808000
+  80291e:	ff 75 0c             	push   0xc(%ebp)
+  802921:	e8 74 e1 ff ff       	call   800a9a <memmove>
+  802926:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802929:	89 d8                	mov    %ebx,%eax
+  80292b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80292e:	5b                   	pop    %ebx
+  80292f:	5e                   	pop    %esi
+  802930:	5d                   	pop    %ebp
+  802931:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802932:	68 0c 4a 80 00       	push   $0x804a0c
+  802937:	68 21 4a 80 00       	push   $0x804a21
+  80293c:	68 b2 00 00 00       	push   $0xb2
+  802941:	68 36 4a 80 00       	push   $0x804a36
+  802946:	e8 0d 15 00 00       	call   803e58 <_panic>
+
+0080294b <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80294b:	55                   	push   %ebp
+  80294c:	89 e5                	mov    %esp,%ebp
+  80294e:	53                   	push   %ebx
+  80294f:	83 ec 04             	sub    $0x4,%esp
+  802952:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802955:	8b 45 08             	mov    0x8(%ebp),%eax
+  802958:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80295d:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802963:	7f 2e                	jg     802993 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802965:	83 ec 04             	sub    $0x4,%esp
+  802968:	53                   	push   %ebx
+  802969:	ff 75 0c             	push   0xc(%ebp)
+  80296c:	68 0c 80 80 00       	push   $0x80800c
+  802971:	e8 24 e1 ff ff       	call   800a9a <memmove>
+	nsipcbuf.send.req_size = size;
+  802976:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80297c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80297f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802984:	b8 08 00 00 00       	mov    $0x8,%eax
+  802989:	e8 a0 fc ff ff       	call   80262e <nsipc>
+}
+  80298e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+	assert(size < 1600);
+  802993:	68 42 4a 80 00       	push   $0x804a42
+  802998:	68 21 4a 80 00       	push   $0x804a21
+  80299d:	68 bd 00 00 00       	push   $0xbd
+  8029a2:	68 36 4a 80 00       	push   $0x804a36
+  8029a7:	e8 ac 14 00 00       	call   803e58 <_panic>
+
+008029ac <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	57                   	push   %edi
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8029b5:	e8 c0 fc ff ff       	call   80267a <nsbulk_map>
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	78 55                	js     802a13 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8029be:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8029c5:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8029cc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8029d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029d6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8029d9:	0f 8d 24 02 00 00    	jge    802c03 <nsipc_sendmsg+0x257>
+  8029df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029e2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8029e5:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8029e8:	89 d8                	mov    %ebx,%eax
+  8029ea:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8029ef:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8029f1:	83 ec 0c             	sub    $0xc,%esp
+  8029f4:	68 e0 66 80 00       	push   $0x8066e0
+  8029f9:	e8 5a 0f 00 00       	call   803958 <pgbatch_init>
+  8029fe:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a01:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802a03:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802a06:	e9 82 00 00 00       	jmp    802a8d <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802a0b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802a0e:	85 db                	test   %ebx,%ebx
+  802a10:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a16:	5b                   	pop    %ebx
+  802a17:	5e                   	pop    %esi
+  802a18:	5f                   	pop    %edi
+  802a19:	5d                   	pop    %ebp
+  802a1a:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802a1b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a20:	29 c8                	sub    %ecx,%eax
+  802a22:	39 d0                	cmp    %edx,%eax
+  802a24:	0f 46 d0             	cmovbe %eax,%edx
+  802a27:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802a29:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802a2f:	85 ff                	test   %edi,%edi
+  802a31:	0f 49 c7             	cmovns %edi,%eax
+  802a34:	c1 f8 0c             	sar    $0xc,%eax
+  802a37:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a3c:	e8 87 fc ff ff       	call   8026c8 <nsbulk_own>
+  802a41:	85 c0                	test   %eax,%eax
+  802a43:	0f 88 17 01 00 00    	js     802b60 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802a49:	83 ec 04             	sub    $0x4,%esp
+  802a4c:	56                   	push   %esi
+  802a4d:	ff 75 e0             	push   -0x20(%ebp)
+  802a50:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a53:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a58:	50                   	push   %eax
+  802a59:	e8 3c e0 ff ff       	call   800a9a <memmove>
+  802a5e:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802a61:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802a64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a67:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a6a:	0f 84 fd 00 00 00    	je     802b6d <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802a70:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802a73:	01 f7                	add    %esi,%edi
+  802a75:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a78:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a7b:	0f 8d 01 01 00 00    	jge    802b82 <nsipc_sendmsg+0x1d6>
+  802a81:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802a87:	0f 8f f0 00 00 00    	jg     802b7d <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a90:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802a93:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802a96:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a99:	89 c2                	mov    %eax,%edx
+  802a9b:	03 13                	add    (%ebx),%edx
+  802a9d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802aa0:	8b 73 04             	mov    0x4(%ebx),%esi
+  802aa3:	29 c6                	sub    %eax,%esi
+  802aa5:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802aaa:	29 f9                	sub    %edi,%ecx
+  802aac:	39 ce                	cmp    %ecx,%esi
+  802aae:	89 ca                	mov    %ecx,%edx
+  802ab0:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802ab3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802ab6:	89 f9                	mov    %edi,%ecx
+  802ab8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802abe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ac1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ac6:	09 c8                	or     %ecx,%eax
+  802ac8:	0f 85 4d ff ff ff    	jne    802a1b <nsipc_sendmsg+0x6f>
+  802ace:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802ad4:	0f 86 41 ff ff ff    	jbe    802a1b <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ada:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ae0:	85 ff                	test   %edi,%edi
+  802ae2:	0f 49 c7             	cmovns %edi,%eax
+  802ae5:	c1 f8 0c             	sar    $0xc,%eax
+  802ae8:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802aea:	89 d1                	mov    %edx,%ecx
+  802aec:	c1 e9 0c             	shr    $0xc,%ecx
+  802aef:	01 c8                	add    %ecx,%eax
+  802af1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802af4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802af7:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802af9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802afc:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b01:	29 c8                	sub    %ecx,%eax
+  802b03:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802b06:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802b09:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802b0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b10:	89 f9                	mov    %edi,%ecx
+  802b12:	d3 e0                	shl    %cl,%eax
+  802b14:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b1a:	83 ec 08             	sub    $0x8,%esp
+  802b1d:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802b1f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802b22:	50                   	push   %eax
+  802b23:	6a 00                	push   $0x0
+  802b25:	56                   	push   %esi
+  802b26:	6a 00                	push   $0x0
+  802b28:	68 e0 66 80 00       	push   $0x8066e0
+  802b2d:	e8 e4 0e 00 00       	call   803a16 <pgbatch_map>
+  802b32:	83 c4 20             	add    $0x20,%esp
+  802b35:	85 c0                	test   %eax,%eax
+  802b37:	0f 88 ce fe ff ff    	js     802a0b <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802b3d:	83 c7 01             	add    $0x1,%edi
+  802b40:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b46:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b49:	39 c7                	cmp    %eax,%edi
+  802b4b:	75 be                	jne    802b0b <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802b4d:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802b50:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802b53:	89 d6                	mov    %edx,%esi
+  802b55:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802b5b:	e9 01 ff ff ff       	jmp    802a61 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802b60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802b63:	85 db                	test   %ebx,%ebx
+  802b65:	0f 45 c3             	cmovne %ebx,%eax
+  802b68:	e9 a6 fe ff ff       	jmp    802a13 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802b6d:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802b71:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b78:	e9 f3 fe ff ff       	jmp    802a70 <nsipc_sendmsg+0xc4>
+  802b7d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802b80:	eb 03                	jmp    802b85 <nsipc_sendmsg+0x1d9>
+  802b82:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802b85:	83 ec 0c             	sub    $0xc,%esp
+  802b88:	68 e0 66 80 00       	push   $0x8066e0
+  802b8d:	e8 d4 0d 00 00       	call   803966 <pgbatch_flush>
+  802b92:	83 c4 10             	add    $0x10,%esp
+  802b95:	85 c0                	test   %eax,%eax
+  802b97:	78 50                	js     802be9 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802b99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b9c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802ba1:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802ba7:	89 fb                	mov    %edi,%ebx
+  802ba9:	29 f3                	sub    %esi,%ebx
+  802bab:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802bb1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bb4:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802bb9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802bbe:	89 fa                	mov    %edi,%edx
+  802bc0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802bc5:	e8 66 fb ff ff       	call   802730 <nsipc_bulk>
+  802bca:	85 c0                	test   %eax,%eax
+  802bcc:	78 28                	js     802bf6 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802bce:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802bd1:	39 c3                	cmp    %eax,%ebx
+  802bd3:	75 0c                	jne    802be1 <nsipc_sendmsg+0x235>
+  802bd5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802bd8:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802bdb:	0f 8f f2 fd ff ff    	jg     8029d3 <nsipc_sendmsg+0x27>
+		sent += r;
+  802be1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802be4:	e9 2a fe ff ff       	jmp    802a13 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802be9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802bec:	85 db                	test   %ebx,%ebx
+  802bee:	0f 45 c3             	cmovne %ebx,%eax
+  802bf1:	e9 1d fe ff ff       	jmp    802a13 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802bf6:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802bf9:	85 db                	test   %ebx,%ebx
+  802bfb:	0f 45 c3             	cmovne %ebx,%eax
+  802bfe:	e9 10 fe ff ff       	jmp    802a13 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802c03:	83 ec 0c             	sub    $0xc,%esp
+  802c06:	68 e0 66 80 00       	push   $0x8066e0
+  802c0b:	e8 48 0d 00 00       	call   803958 <pgbatch_init>
+  802c10:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c13:	be 00 00 00 00       	mov    $0x0,%esi
+  802c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c1d:	e9 63 ff ff ff       	jmp    802b85 <nsipc_sendmsg+0x1d9>
+
+00802c22 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	57                   	push   %edi
+  802c26:	56                   	push   %esi
+  802c27:	53                   	push   %ebx
+  802c28:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802c2b:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802c32:	0f 84 c8 00 00 00    	je     802d00 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802c38:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802c3f:	0f 84 e4 00 00 00    	je     802d29 <nsipc_sendfile+0x107>
+{
+  802c45:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802c4a:	89 fb                	mov    %edi,%ebx
+  802c4c:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802c4f:	0f 83 f0 00 00 00    	jae    802d45 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802c55:	89 fa                	mov    %edi,%edx
+  802c57:	03 55 10             	add    0x10(%ebp),%edx
+  802c5a:	89 d0                	mov    %edx,%eax
+  802c5c:	c1 f8 1f             	sar    $0x1f,%eax
+  802c5f:	c1 e8 14             	shr    $0x14,%eax
+  802c62:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802c65:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802c6b:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802c6d:	6a 10                	push   $0x10
+  802c6f:	68 00 20 01 e0       	push   $0xe0012000
+  802c74:	52                   	push   %edx
+  802c75:	ff 75 0c             	push   0xc(%ebp)
+  802c78:	e8 fe f4 ff ff       	call   80217b <fmap>
+  802c7d:	83 c4 10             	add    $0x10,%esp
+  802c80:	85 c0                	test   %eax,%eax
+  802c82:	0f 8e b8 00 00 00    	jle    802d40 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802c88:	39 c6                	cmp    %eax,%esi
+  802c8a:	0f 8d b5 00 00 00    	jge    802d45 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802c90:	29 f0                	sub    %esi,%eax
+  802c92:	8b 55 14             	mov    0x14(%ebp),%edx
+  802c95:	29 da                	sub    %ebx,%edx
+  802c97:	39 d0                	cmp    %edx,%eax
+  802c99:	89 d3                	mov    %edx,%ebx
+  802c9b:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca1:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802ca6:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802cac:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802cb2:	8b 45 18             	mov    0x18(%ebp),%eax
+  802cb5:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802cba:	83 ec 0c             	sub    $0xc,%esp
+  802cbd:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802cbf:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802cc6:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802cc9:	83 c0 01             	add    $0x1,%eax
+  802ccc:	50                   	push   %eax
+  802ccd:	68 00 10 01 e0       	push   $0xe0011000
+  802cd2:	6a 11                	push   $0x11
+  802cd4:	ff 35 e4 69 80 00    	push   0x8069e4
+  802cda:	e8 e7 14 00 00       	call   8041c6 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802cdf:	83 c4 1c             	add    $0x1c,%esp
+  802ce2:	6a 00                	push   $0x0
+  802ce4:	6a 00                	push   $0x0
+  802ce6:	6a 00                	push   $0x0
+  802ce8:	e8 15 12 00 00       	call   803f02 <ipc_recv>
+  802ced:	83 c4 10             	add    $0x10,%esp
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	78 5b                	js     802d4f <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802cf4:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802cf6:	39 c3                	cmp    %eax,%ebx
+  802cf8:	0f 8e 4c ff ff ff    	jle    802c4a <nsipc_sendfile+0x28>
+  802cfe:	eb 45                	jmp    802d45 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802d00:	83 ec 04             	sub    $0x4,%esp
+  802d03:	6a 07                	push   $0x7
+  802d05:	68 00 10 01 e0       	push   $0xe0011000
+  802d0a:	6a 00                	push   $0x0
+  802d0c:	e8 0d e0 ff ff       	call   800d1e <sys_page_alloc>
+  802d11:	89 c7                	mov    %eax,%edi
+  802d13:	83 c4 10             	add    $0x10,%esp
+  802d16:	85 c0                	test   %eax,%eax
+  802d18:	78 2b                	js     802d45 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802d1a:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802d21:	00 00 00 
+  802d24:	e9 0f ff ff ff       	jmp    802c38 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d29:	83 ec 0c             	sub    $0xc,%esp
+  802d2c:	6a 03                	push   $0x3
+  802d2e:	e8 c8 14 00 00       	call   8041fb <ipc_find_env>
+  802d33:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802d38:	83 c4 10             	add    $0x10,%esp
+  802d3b:	e9 05 ff ff ff       	jmp    802c45 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802d40:	85 ff                	test   %edi,%edi
+  802d42:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802d45:	89 f8                	mov    %edi,%eax
+  802d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d4a:	5b                   	pop    %ebx
+  802d4b:	5e                   	pop    %esi
+  802d4c:	5f                   	pop    %edi
+  802d4d:	5d                   	pop    %ebp
+  802d4e:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802d4f:	85 ff                	test   %edi,%edi
+  802d51:	0f 44 f8             	cmove  %eax,%edi
+  802d54:	eb ef                	jmp    802d45 <nsipc_sendfile+0x123>
+
+00802d56 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	57                   	push   %edi
+  802d5a:	56                   	push   %esi
+  802d5b:	53                   	push   %ebx
+  802d5c:	83 ec 1c             	sub    $0x1c,%esp
+  802d5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802d62:	e8 13 f9 ff ff       	call   80267a <nsbulk_map>
+  802d67:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	0f 88 ba 00 00 00    	js     802e2c <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802d72:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d76:	0f 8e bb 00 00 00    	jle    802e37 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802d7c:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802d81:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802d86:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802d8b:	89 f8                	mov    %edi,%eax
+  802d8d:	29 f0                	sub    %esi,%eax
+  802d8f:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802d93:	39 c8                	cmp    %ecx,%eax
+  802d95:	0f 47 c1             	cmova  %ecx,%eax
+  802d98:	01 f0                	add    %esi,%eax
+  802d9a:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802d9c:	83 c2 01             	add    $0x1,%edx
+  802d9f:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802da2:	7e 07                	jle    802dab <nsipc_recvmsg+0x55>
+  802da4:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802da9:	7e e0                	jle    802d8b <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802dab:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802db1:	c1 fa 0c             	sar    $0xc,%edx
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db9:	e8 0a f9 ff ff       	call   8026c8 <nsbulk_own>
+  802dbe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802dc1:	85 c0                	test   %eax,%eax
+  802dc3:	78 67                	js     802e2c <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dc8:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802dcd:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802dd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802dd6:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802ddb:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802de0:	89 f2                	mov    %esi,%edx
+  802de2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802de7:	e8 44 f9 ff ff       	call   802730 <nsipc_bulk>
+  802dec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802def:	85 c0                	test   %eax,%eax
+  802df1:	78 39                	js     802e2c <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802df3:	39 f0                	cmp    %esi,%eax
+  802df5:	7f 4a                	jg     802e41 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802df7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfc:	85 c0                	test   %eax,%eax
+  802dfe:	7e 2c                	jle    802e2c <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802e00:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802e03:	29 fe                	sub    %edi,%esi
+  802e05:	8b 43 04             	mov    0x4(%ebx),%eax
+  802e08:	39 c6                	cmp    %eax,%esi
+  802e0a:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802e0d:	83 ec 04             	sub    $0x4,%esp
+  802e10:	56                   	push   %esi
+  802e11:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802e17:	50                   	push   %eax
+  802e18:	ff 33                	push   (%ebx)
+  802e1a:	e8 7b dc ff ff       	call   800a9a <memmove>
+		n += m;
+  802e1f:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802e21:	83 c3 08             	add    $0x8,%ebx
+  802e24:	83 c4 10             	add    $0x10,%esp
+  802e27:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802e2a:	7f d4                	jg     802e00 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802e2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e32:	5b                   	pop    %ebx
+  802e33:	5e                   	pop    %esi
+  802e34:	5f                   	pop    %edi
+  802e35:	5d                   	pop    %ebp
+  802e36:	c3                   	ret
+	int r, i, n, len = 0;
+  802e37:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3c:	e9 6a ff ff ff       	jmp    802dab <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802e41:	68 18 4a 80 00       	push   $0x804a18
+  802e46:	68 21 4a 80 00       	push   $0x804a21
+  802e4b:	68 3b 01 00 00       	push   $0x13b
+  802e50:	68 36 4a 80 00       	push   $0x804a36
+  802e55:	e8 fe 0f 00 00       	call   803e58 <_panic>
+
+00802e5a <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802e5a:	55                   	push   %ebp
+  802e5b:	89 e5                	mov    %esp,%ebp
+  802e5d:	57                   	push   %edi
+  802e5e:	56                   	push   %esi
+  802e5f:	53                   	push   %ebx
+  802e60:	83 ec 0c             	sub    $0xc,%esp
+  802e63:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802e66:	8b 75 10             	mov    0x10(%ebp),%esi
+  802e69:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802e6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802e74:	8b 07                	mov    (%edi),%eax
+  802e76:	a3 04 80 80 00       	mov    %eax,0x808004
+  802e7b:	8b 47 04             	mov    0x4(%edi),%eax
+  802e7e:	a3 08 80 80 00       	mov    %eax,0x808008
+  802e83:	8b 47 08             	mov    0x8(%edi),%eax
+  802e86:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802e8b:	8b 47 0c             	mov    0xc(%edi),%eax
+  802e8e:	a3 10 80 80 00       	mov    %eax,0x808010
+  802e93:	8b 47 10             	mov    0x10(%edi),%eax
+  802e96:	a3 14 80 80 00       	mov    %eax,0x808014
+  802e9b:	8b 47 14             	mov    0x14(%edi),%eax
+  802e9e:	a3 18 80 80 00       	mov    %eax,0x808018
+  802ea3:	8b 47 18             	mov    0x18(%edi),%eax
+  802ea6:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802eab:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802eae:	a3 20 80 80 00       	mov    %eax,0x808020
+  802eb3:	8b 47 20             	mov    0x20(%edi),%eax
+  802eb6:	a3 24 80 80 00       	mov    %eax,0x808024
+  802ebb:	8b 47 24             	mov    0x24(%edi),%eax
+  802ebe:	a3 28 80 80 00       	mov    %eax,0x808028
+  802ec3:	8b 47 28             	mov    0x28(%edi),%eax
+  802ec6:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802ecb:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802ece:	a3 30 80 80 00       	mov    %eax,0x808030
+  802ed3:	8b 47 30             	mov    0x30(%edi),%eax
+  802ed6:	a3 34 80 80 00       	mov    %eax,0x808034
+  802edb:	8b 47 34             	mov    0x34(%edi),%eax
+  802ede:	a3 38 80 80 00       	mov    %eax,0x808038
+  802ee3:	8b 47 38             	mov    0x38(%edi),%eax
+  802ee6:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802eeb:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802eee:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802ef3:	8b 06                	mov    (%esi),%eax
+  802ef5:	a3 44 80 80 00       	mov    %eax,0x808044
+  802efa:	8b 46 04             	mov    0x4(%esi),%eax
+  802efd:	a3 48 80 80 00       	mov    %eax,0x808048
+  802f02:	8b 46 08             	mov    0x8(%esi),%eax
+  802f05:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802f0a:	8b 46 0c             	mov    0xc(%esi),%eax
+  802f0d:	a3 50 80 80 00       	mov    %eax,0x808050
+  802f12:	8b 46 10             	mov    0x10(%esi),%eax
+  802f15:	a3 54 80 80 00       	mov    %eax,0x808054
+  802f1a:	8b 46 14             	mov    0x14(%esi),%eax
+  802f1d:	a3 58 80 80 00       	mov    %eax,0x808058
+  802f22:	8b 46 18             	mov    0x18(%esi),%eax
+  802f25:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802f2a:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802f2d:	a3 60 80 80 00       	mov    %eax,0x808060
+  802f32:	8b 46 20             	mov    0x20(%esi),%eax
+  802f35:	a3 64 80 80 00       	mov    %eax,0x808064
+  802f3a:	8b 46 24             	mov    0x24(%esi),%eax
+  802f3d:	a3 68 80 80 00       	mov    %eax,0x808068
+  802f42:	8b 46 28             	mov    0x28(%esi),%eax
+  802f45:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802f4a:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802f4d:	a3 70 80 80 00       	mov    %eax,0x808070
+  802f52:	8b 46 30             	mov    0x30(%esi),%eax
+  802f55:	a3 74 80 80 00       	mov    %eax,0x808074
+  802f5a:	8b 46 34             	mov    0x34(%esi),%eax
+  802f5d:	a3 78 80 80 00       	mov    %eax,0x808078
+  802f62:	8b 46 38             	mov    0x38(%esi),%eax
+  802f65:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802f6a:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802f6d:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802f72:	8b 03                	mov    (%ebx),%eax
+  802f74:	a3 84 80 80 00       	mov    %eax,0x808084
+  802f79:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f7c:	a3 88 80 80 00       	mov    %eax,0x808088
+  802f81:	8b 43 08             	mov    0x8(%ebx),%eax
+  802f84:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802f89:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802f8c:	a3 90 80 80 00       	mov    %eax,0x808090
+  802f91:	8b 43 10             	mov    0x10(%ebx),%eax
+  802f94:	a3 94 80 80 00       	mov    %eax,0x808094
+  802f99:	8b 43 14             	mov    0x14(%ebx),%eax
+  802f9c:	a3 98 80 80 00       	mov    %eax,0x808098
+  802fa1:	8b 43 18             	mov    0x18(%ebx),%eax
+  802fa4:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802fa9:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802fac:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802fb1:	8b 43 20             	mov    0x20(%ebx),%eax
+  802fb4:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802fb9:	8b 43 24             	mov    0x24(%ebx),%eax
+  802fbc:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802fc1:	8b 43 28             	mov    0x28(%ebx),%eax
+  802fc4:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802fc9:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802fcc:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802fd1:	8b 43 30             	mov    0x30(%ebx),%eax
+  802fd4:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802fd9:	8b 43 34             	mov    0x34(%ebx),%eax
+  802fdc:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802fe1:	8b 43 38             	mov    0x38(%ebx),%eax
+  802fe4:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802fe9:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802fec:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802ff1:	8b 45 18             	mov    0x18(%ebp),%eax
+  802ff4:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802ff9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802ffe:	e8 2b f6 ff ff       	call   80262e <nsipc>
+  803003:	85 c0                	test   %eax,%eax
+  803005:	0f 88 ad 01 00 00    	js     8031b8 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80300b:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803011:	89 17                	mov    %edx,(%edi)
+  803013:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803019:	89 57 04             	mov    %edx,0x4(%edi)
+  80301c:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803022:	89 57 08             	mov    %edx,0x8(%edi)
+  803025:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80302b:	89 57 0c             	mov    %edx,0xc(%edi)
+  80302e:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803034:	89 57 10             	mov    %edx,0x10(%edi)
+  803037:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80303d:	89 57 14             	mov    %edx,0x14(%edi)
+  803040:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803046:	89 57 18             	mov    %edx,0x18(%edi)
+  803049:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80304f:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803052:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  803058:	89 57 20             	mov    %edx,0x20(%edi)
+  80305b:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  803061:	89 57 24             	mov    %edx,0x24(%edi)
+  803064:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  80306a:	89 57 28             	mov    %edx,0x28(%edi)
+  80306d:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  803073:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803076:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  80307c:	89 57 30             	mov    %edx,0x30(%edi)
+  80307f:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  803085:	89 57 34             	mov    %edx,0x34(%edi)
+  803088:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  80308e:	89 57 38             	mov    %edx,0x38(%edi)
+  803091:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803097:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80309a:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8030a0:	89 16                	mov    %edx,(%esi)
+  8030a2:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8030a8:	89 56 04             	mov    %edx,0x4(%esi)
+  8030ab:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8030b1:	89 56 08             	mov    %edx,0x8(%esi)
+  8030b4:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8030ba:	89 56 0c             	mov    %edx,0xc(%esi)
+  8030bd:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8030c3:	89 56 10             	mov    %edx,0x10(%esi)
+  8030c6:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8030cc:	89 56 14             	mov    %edx,0x14(%esi)
+  8030cf:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8030d5:	89 56 18             	mov    %edx,0x18(%esi)
+  8030d8:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8030de:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8030e1:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8030e7:	89 56 20             	mov    %edx,0x20(%esi)
+  8030ea:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8030f0:	89 56 24             	mov    %edx,0x24(%esi)
+  8030f3:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8030f9:	89 56 28             	mov    %edx,0x28(%esi)
+  8030fc:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803102:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803105:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80310b:	89 56 30             	mov    %edx,0x30(%esi)
+  80310e:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803114:	89 56 34             	mov    %edx,0x34(%esi)
+  803117:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80311d:	89 56 38             	mov    %edx,0x38(%esi)
+  803120:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803126:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803129:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80312f:	89 13                	mov    %edx,(%ebx)
+  803131:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803137:	89 53 04             	mov    %edx,0x4(%ebx)
+  80313a:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803140:	89 53 08             	mov    %edx,0x8(%ebx)
+  803143:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803149:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80314c:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803152:	89 53 10             	mov    %edx,0x10(%ebx)
+  803155:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  80315b:	89 53 14             	mov    %edx,0x14(%ebx)
+  80315e:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  803164:	89 53 18             	mov    %edx,0x18(%ebx)
+  803167:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  80316d:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803170:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803176:	89 53 20             	mov    %edx,0x20(%ebx)
+  803179:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  80317f:	89 53 24             	mov    %edx,0x24(%ebx)
+  803182:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803188:	89 53 28             	mov    %edx,0x28(%ebx)
+  80318b:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803191:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803194:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  80319a:	89 53 30             	mov    %edx,0x30(%ebx)
+  80319d:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8031a3:	89 53 34             	mov    %edx,0x34(%ebx)
+  8031a6:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8031ac:	89 53 38             	mov    %edx,0x38(%ebx)
+  8031af:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8031b5:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8031b8:	83 c4 0c             	add    $0xc,%esp
+  8031bb:	5b                   	pop    %ebx
+  8031bc:	5e                   	pop    %esi
+  8031bd:	5f                   	pop    %edi
+  8031be:	5d                   	pop    %ebp
+  8031bf:	c3                   	ret
+
+008031c0 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8031c0:	55                   	push   %ebp
+  8031c1:	89 e5                	mov    %esp,%ebp
+  8031c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8031c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031c9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8031ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031d1:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8031d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031d9:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8031de:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8031e3:	e8 46 f4 ff ff       	call   80262e <nsipc>
+}
+  8031e8:	c9                   	leave
+  8031e9:	c3                   	ret
+
+008031ea <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8031ea:	55                   	push   %ebp
+  8031eb:	89 e5                	mov    %esp,%ebp
+  8031ed:	56                   	push   %esi
+  8031ee:	53                   	push   %ebx
+  8031ef:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8031f2:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8031f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031fb:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803200:	b8 10 00 00 00       	mov    $0x10,%eax
+  803205:	e8 24 f4 ff ff       	call   80262e <nsipc>
+  80320a:	89 c3                	mov    %eax,%ebx
+  80320c:	85 c0                	test   %eax,%eax
+  80320e:	7e 1f                	jle    80322f <nsipc_evwait+0x45>
+		assert(r <= max);
+  803210:	39 c6                	cmp    %eax,%esi
+  803212:	7c 24                	jl     803238 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803214:	83 ec 04             	sub    $0x4,%esp
+  803217:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80321e:	50                   	push   %eax
+  80321f:	68 00 80 80 00       	push   $0x808000
+  803224:	ff 75 08             	push   0x8(%ebp)
+  803227:	e8 6e d8 ff ff       	call   800a9a <memmove>
+  80322c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80322f:	89 d8                	mov    %ebx,%eax
+  803231:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803234:	5b                   	pop    %ebx
+  803235:	5e                   	pop    %esi
+  803236:	5d                   	pop    %ebp
+  803237:	c3                   	ret
+		assert(r <= max);
+  803238:	68 4e 4a 80 00       	push   $0x804a4e
+  80323d:	68 21 4a 80 00       	push   $0x804a21
+  803242:	68 6a 01 00 00       	push   $0x16a
+  803247:	68 36 4a 80 00       	push   $0x804a36
+  80324c:	e8 07 0c 00 00       	call   803e58 <_panic>
+
+00803251 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803251:	55                   	push   %ebp
+  803252:	89 e5                	mov    %esp,%ebp
+  803254:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803257:	8b 45 08             	mov    0x8(%ebp),%eax
+  80325a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80325f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803262:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803267:	8b 45 10             	mov    0x10(%ebp),%eax
+  80326a:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80326f:	b8 09 00 00 00       	mov    $0x9,%eax
+  803274:	e8 b5 f3 ff ff       	call   80262e <nsipc>
+}
+  803279:	c9                   	leave
+  80327a:	c3                   	ret
+
+0080327b <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  80327b:	55                   	push   %ebp
+  80327c:	89 e5                	mov    %esp,%ebp
+  80327e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803281:	8b 45 08             	mov    0x8(%ebp),%eax
+  803284:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803289:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80328e:	e8 9b f3 ff ff       	call   80262e <nsipc>
+}
+  803293:	c9                   	leave
+  803294:	c3                   	ret
+
+00803295 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803295:	55                   	push   %ebp
+  803296:	89 e5                	mov    %esp,%ebp
+  803298:	53                   	push   %ebx
+  803299:	83 ec 04             	sub    $0x4,%esp
+  80329c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80329f:	b8 12 00 00 00       	mov    $0x12,%eax
+  8032a4:	e8 85 f3 ff ff       	call   80262e <nsipc>
+  8032a9:	85 c0                	test   %eax,%eax
+  8032ab:	78 50                	js     8032fd <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8032ad:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8032b3:	89 13                	mov    %edx,(%ebx)
+  8032b5:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8032bb:	89 53 04             	mov    %edx,0x4(%ebx)
+  8032be:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8032c4:	89 53 08             	mov    %edx,0x8(%ebx)
+  8032c7:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8032cd:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8032d0:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8032d6:	89 53 10             	mov    %edx,0x10(%ebx)
+  8032d9:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8032df:	89 53 14             	mov    %edx,0x14(%ebx)
+  8032e2:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8032e8:	89 53 18             	mov    %edx,0x18(%ebx)
+  8032eb:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8032f1:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8032f4:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8032fa:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8032fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803300:	c9                   	leave
+  803301:	c3                   	ret
+
+00803302 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803302:	55                   	push   %ebp
+  803303:	89 e5                	mov    %esp,%ebp
+  803305:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803308:	6a 03                	push   $0x3
+  80330a:	e8 ec 0e 00 00       	call   8041fb <ipc_find_env>
+  80330f:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803314:	8b 45 08             	mov    0x8(%ebp),%eax
+  803317:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80331c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803321:	e8 08 f3 ff ff       	call   80262e <nsipc>
+  803326:	83 c4 10             	add    $0x10,%esp
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	78 0a                	js     803337 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80332d:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803332:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803337:	c9                   	leave
+  803338:	c3                   	ret
+
+00803339 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803339:	55                   	push   %ebp
+  80333a:	89 e5                	mov    %esp,%ebp
+  80333c:	57                   	push   %edi
+  80333d:	56                   	push   %esi
+  80333e:	53                   	push   %ebx
+  80333f:	83 ec 1c             	sub    $0x1c,%esp
+  803342:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803345:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803348:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80334d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803352:	89 e0                	mov    %esp,%eax
+  803354:	89 f2                	mov    %esi,%edx
+  803356:	29 c2                	sub    %eax,%edx
+  803358:	89 d0                	mov    %edx,%eax
+  80335a:	c1 e8 0f             	shr    $0xf,%eax
+  80335d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803363:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803366:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80336d:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803370:	83 ec 0c             	sub    $0xc,%esp
+  803373:	ff 75 e0             	push   -0x20(%ebp)
+  803376:	e8 bf 0e 00 00       	call   80423a <pageref>
+  80337b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80337e:	83 c4 04             	add    $0x4,%esp
+  803381:	ff 75 dc             	push   -0x24(%ebp)
+  803384:	e8 b1 0e 00 00       	call   80423a <pageref>
+  803389:	89 e2                	mov    %esp,%edx
+  80338b:	89 f1                	mov    %esi,%ecx
+  80338d:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  80338f:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803392:	89 ca                	mov    %ecx,%edx
+  803394:	c1 ea 0f             	shr    $0xf,%edx
+  803397:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80339d:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8033a0:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  8033a7:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8033aa:	39 d7                	cmp    %edx,%edi
+  8033ac:	74 40                	je     8033ee <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8033ae:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033b1:	75 9f                	jne    803352 <_pipeisclosed+0x19>
+  8033b3:	89 e2                	mov    %esp,%edx
+  8033b5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8033ba:	29 d0                	sub    %edx,%eax
+  8033bc:	89 c2                	mov    %eax,%edx
+  8033be:	c1 ea 0f             	shr    $0xf,%edx
+  8033c1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cb:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8033ce:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8033d5:	8b 40 58             	mov    0x58(%eax),%eax
+  8033d8:	6a 01                	push   $0x1
+  8033da:	50                   	push   %eax
+  8033db:	57                   	push   %edi
+  8033dc:	68 57 4a 80 00       	push   $0x804a57
+  8033e1:	e8 0d ce ff ff       	call   8001f3 <cprintf>
+  8033e6:	83 c4 10             	add    $0x10,%esp
+  8033e9:	e9 5f ff ff ff       	jmp    80334d <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8033ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8033f1:	0f 94 c0             	sete   %al
+  8033f4:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8033f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fa:	5b                   	pop    %ebx
+  8033fb:	5e                   	pop    %esi
+  8033fc:	5f                   	pop    %edi
+  8033fd:	5d                   	pop    %ebp
+  8033fe:	c3                   	ret
+
+008033ff <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8033ff:	55                   	push   %ebp
+  803400:	89 e5                	mov    %esp,%ebp
+  803402:	53                   	push   %ebx
+  803403:	83 ec 0c             	sub    $0xc,%esp
+  803406:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803409:	53                   	push   %ebx
+  80340a:	6a 00                	push   $0x0
+  80340c:	e8 92 d9 ff ff       	call   800da3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803411:	89 1c 24             	mov    %ebx,(%esp)
+  803414:	e8 f4 e4 ff ff       	call   80190d <fd2data>
+  803419:	83 c4 08             	add    $0x8,%esp
+  80341c:	50                   	push   %eax
+  80341d:	6a 00                	push   $0x0
+  80341f:	e8 7f d9 ff ff       	call   800da3 <sys_page_unmap>
+}
+  803424:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803427:	c9                   	leave
+  803428:	c3                   	ret
+
+00803429 <devpipe_read>:
+{
+  803429:	55                   	push   %ebp
+  80342a:	89 e5                	mov    %esp,%ebp
+  80342c:	57                   	push   %edi
+  80342d:	56                   	push   %esi
+  80342e:	53                   	push   %ebx
+  80342f:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803432:	ff 75 08             	push   0x8(%ebp)
+  803435:	e8 d3 e4 ff ff       	call   80190d <fd2data>
+  80343a:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80343c:	8b 70 04             	mov    0x4(%eax),%esi
+  80343f:	8b 00                	mov    (%eax),%eax
+  803441:	83 c4 10             	add    $0x10,%esp
+  803444:	39 f0                	cmp    %esi,%eax
+  803446:	75 36                	jne    80347e <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803448:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80344b:	89 da                	mov    %ebx,%edx
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803450:	e8 e4 fe ff ff       	call   803339 <_pipeisclosed>
+  803455:	85 c0                	test   %eax,%eax
+  803457:	0f 85 d4 00 00 00    	jne    803531 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80345d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803462:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803466:	83 ec 04             	sub    $0x4,%esp
+  803469:	6a ff                	push   $0xffffffff
+  80346b:	56                   	push   %esi
+  80346c:	57                   	push   %edi
+  80346d:	e8 aa dc ff ff       	call   80111c <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803472:	8b 73 04             	mov    0x4(%ebx),%esi
+  803475:	8b 03                	mov    (%ebx),%eax
+  803477:	83 c4 10             	add    $0x10,%esp
+  80347a:	39 c6                	cmp    %eax,%esi
+  80347c:	74 cd                	je     80344b <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80347e:	8b 73 04             	mov    0x4(%ebx),%esi
+  803481:	8b 03                	mov    (%ebx),%eax
+  803483:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803489:	29 c6                	sub    %eax,%esi
+  80348b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803490:	f7 e6                	mul    %esi
+  803492:	c1 ea 0c             	shr    $0xc,%edx
+  803495:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80349b:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80349d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8034a0:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8034a4:	8b 0b                	mov    (%ebx),%ecx
+  8034a6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034ab:	f7 e1                	mul    %ecx
+  8034ad:	c1 ea 0b             	shr    $0xb,%edx
+  8034b0:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8034b6:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8034b8:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8034bd:	29 cf                	sub    %ecx,%edi
+  8034bf:	39 f7                	cmp    %esi,%edi
+  8034c1:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8034c4:	83 ec 04             	sub    $0x4,%esp
+  8034c7:	57                   	push   %edi
+  8034c8:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8034cc:	50                   	push   %eax
+  8034cd:	ff 75 0c             	push   0xc(%ebp)
+  8034d0:	e8 c5 d5 ff ff       	call   800a9a <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8034d5:	83 c4 0c             	add    $0xc,%esp
+  8034d8:	89 f0                	mov    %esi,%eax
+  8034da:	29 f8                	sub    %edi,%eax
+  8034dc:	50                   	push   %eax
+  8034dd:	8d 43 10             	lea    0x10(%ebx),%eax
+  8034e0:	50                   	push   %eax
+  8034e1:	89 f8                	mov    %edi,%eax
+  8034e3:	03 45 0c             	add    0xc(%ebp),%eax
+  8034e6:	50                   	push   %eax
+  8034e7:	e8 ae d5 ff ff       	call   800a9a <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8034ec:	8b 0b                	mov    (%ebx),%ecx
+  8034ee:	01 f1                	add    %esi,%ecx
+  8034f0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8034f5:	f7 e1                	mul    %ecx
+  8034f7:	c1 ea 0c             	shr    $0xc,%edx
+  8034fa:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803500:	29 c1                	sub    %eax,%ecx
+  803502:	89 0b                	mov    %ecx,(%ebx)
+  803504:	b8 00 00 00 00       	mov    $0x0,%eax
+  803509:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	85 c0                	test   %eax,%eax
+  803512:	75 0a                	jne    80351e <devpipe_read+0xf5>
+	return n;
+  803514:	89 f0                	mov    %esi,%eax
+}
+  803516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803519:	5b                   	pop    %ebx
+  80351a:	5e                   	pop    %esi
+  80351b:	5f                   	pop    %edi
+  80351c:	5d                   	pop    %ebp
+  80351d:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80351e:	83 ec 08             	sub    $0x8,%esp
+  803521:	68 00 04 00 00       	push   $0x400
+  803526:	53                   	push   %ebx
+  803527:	e8 12 dc ff ff       	call   80113e <sys_futex_wake>
+  80352c:	83 c4 10             	add    $0x10,%esp
+  80352f:	eb e3                	jmp    803514 <devpipe_read+0xeb>
+			return 0;
+  803531:	b8 00 00 00 00       	mov    $0x0,%eax
+  803536:	eb de                	jmp    803516 <devpipe_read+0xed>
+
+00803538 <devpipe_write>:
+{
+  803538:	55                   	push   %ebp
+  803539:	89 e5                	mov    %esp,%ebp
+  80353b:	57                   	push   %edi
+  80353c:	56                   	push   %esi
+  80353d:	53                   	push   %ebx
+  80353e:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803541:	ff 75 08             	push   0x8(%ebp)
+  803544:	e8 c4 e3 ff ff       	call   80190d <fd2data>
+  803549:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80354b:	83 c4 10             	add    $0x10,%esp
+  80354e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803555:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80355a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80355e:	0f 84 43 01 00 00    	je     8036a7 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803564:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803567:	8b 06                	mov    (%esi),%eax
+  803569:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80356f:	29 c1                	sub    %eax,%ecx
+  803571:	89 c8                	mov    %ecx,%eax
+  803573:	f7 e7                	mul    %edi
+  803575:	c1 ea 0c             	shr    $0xc,%edx
+  803578:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80357e:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803580:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803586:	75 52                	jne    8035da <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803588:	89 f2                	mov    %esi,%edx
+  80358a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80358d:	e8 a7 fd ff ff       	call   803339 <_pipeisclosed>
+  803592:	85 c0                	test   %eax,%eax
+  803594:	0f 85 28 01 00 00    	jne    8036c2 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80359a:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80359c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80359f:	8b 06                	mov    (%esi),%eax
+  8035a1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035a7:	29 c1                	sub    %eax,%ecx
+  8035a9:	89 c8                	mov    %ecx,%eax
+  8035ab:	f7 e7                	mul    %edi
+  8035ad:	c1 ea 0c             	shr    $0xc,%edx
+  8035b0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035b6:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8035b8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8035be:	75 a4                	jne    803564 <devpipe_write+0x2c>
+  8035c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035c5:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8035c9:	83 ec 04             	sub    $0x4,%esp
+  8035cc:	6a ff                	push   $0xffffffff
+  8035ce:	53                   	push   %ebx
+  8035cf:	56                   	push   %esi
+  8035d0:	e8 47 db ff ff       	call   80111c <sys_futex_wait>
+}
+  8035d5:	83 c4 10             	add    $0x10,%esp
+  8035d8:	eb 8a                	jmp    803564 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035da:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8035dd:	8b 06                	mov    (%esi),%eax
+  8035df:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8035e5:	29 c1                	sub    %eax,%ecx
+  8035e7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8035ec:	f7 e1                	mul    %ecx
+  8035ee:	c1 ea 0c             	shr    $0xc,%edx
+  8035f1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035f7:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8035f9:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8035fe:	89 d8                	mov    %ebx,%eax
+  803600:	29 c8                	sub    %ecx,%eax
+  803602:	8b 55 10             	mov    0x10(%ebp),%edx
+  803605:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803608:	29 ca                	sub    %ecx,%edx
+  80360a:	39 d0                	cmp    %edx,%eax
+  80360c:	0f 46 d0             	cmovbe %eax,%edx
+  80360f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803612:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803615:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80361a:	f7 e1                	mul    %ecx
+  80361c:	c1 ea 0b             	shr    $0xb,%edx
+  80361f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803625:	89 ca                	mov    %ecx,%edx
+  803627:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803629:	29 d3                	sub    %edx,%ebx
+  80362b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80362e:	39 c3                	cmp    %eax,%ebx
+  803630:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803633:	83 ec 04             	sub    $0x4,%esp
+  803636:	53                   	push   %ebx
+  803637:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80363a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80363d:	51                   	push   %ecx
+  80363e:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803642:	50                   	push   %eax
+  803643:	e8 52 d4 ff ff       	call   800a9a <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803648:	83 c4 0c             	add    $0xc,%esp
+  80364b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80364e:	29 d8                	sub    %ebx,%eax
+  803650:	50                   	push   %eax
+  803651:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803654:	01 cb                	add    %ecx,%ebx
+  803656:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803659:	53                   	push   %ebx
+  80365a:	8d 46 10             	lea    0x10(%esi),%eax
+  80365d:	50                   	push   %eax
+  80365e:	e8 37 d4 ff ff       	call   800a9a <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803663:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803666:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803669:	01 c1                	add    %eax,%ecx
+  80366b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803670:	f7 e1                	mul    %ecx
+  803672:	c1 ea 0c             	shr    $0xc,%edx
+  803675:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80367b:	89 ca                	mov    %ecx,%edx
+  80367d:	29 c2                	sub    %eax,%edx
+  80367f:	89 56 04             	mov    %edx,0x4(%esi)
+  803682:	b8 00 00 00 00       	mov    $0x0,%eax
+  803687:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80368b:	83 c4 10             	add    $0x10,%esp
+  80368e:	85 c0                	test   %eax,%eax
+  803690:	75 1a                	jne    8036ac <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803692:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803695:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803698:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80369b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80369e:	0f 82 c0 fe ff ff    	jb     803564 <devpipe_write+0x2c>
+  8036a4:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8036a7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036aa:	eb 1b                	jmp    8036c7 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8036ac:	83 ec 08             	sub    $0x8,%esp
+  8036af:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8036b4:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8036b7:	50                   	push   %eax
+  8036b8:	e8 81 da ff ff       	call   80113e <sys_futex_wake>
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	eb d0                	jmp    803692 <devpipe_write+0x15a>
+				return 0;
+  8036c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ca:	5b                   	pop    %ebx
+  8036cb:	5e                   	pop    %esi
+  8036cc:	5f                   	pop    %edi
+  8036cd:	5d                   	pop    %ebp
+  8036ce:	c3                   	ret
+
+008036cf <devpipe_stat>:
+{
+  8036cf:	55                   	push   %ebp
+  8036d0:	89 e5                	mov    %esp,%ebp
+  8036d2:	56                   	push   %esi
+  8036d3:	53                   	push   %ebx
+  8036d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8036d7:	83 ec 0c             	sub    $0xc,%esp
+  8036da:	ff 75 08             	push   0x8(%ebp)
+  8036dd:	e8 2b e2 ff ff       	call   80190d <fd2data>
+  8036e2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8036e4:	83 c4 08             	add    $0x8,%esp
+  8036e7:	68 6a 4a 80 00       	push   $0x804a6a
+  8036ec:	53                   	push   %ebx
+  8036ed:	e8 f8 d1 ff ff       	call   8008ea <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036f2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8036f5:	8b 06                	mov    (%esi),%eax
+  8036f7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8036fd:	29 c1                	sub    %eax,%ecx
+  8036ff:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803704:	89 c8                	mov    %ecx,%eax
+  803706:	f7 e2                	mul    %edx
+  803708:	c1 ea 0c             	shr    $0xc,%edx
+  80370b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803711:	29 d1                	sub    %edx,%ecx
+  803713:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803719:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803720:	00 00 00 
+	stat->st_dev = &devpipe;
+  803723:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80372a:	50 80 00 
+}
+  80372d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803732:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803735:	5b                   	pop    %ebx
+  803736:	5e                   	pop    %esi
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
+
+00803739 <devpipe_poll>:
+{
+  803739:	55                   	push   %ebp
+  80373a:	89 e5                	mov    %esp,%ebp
+  80373c:	57                   	push   %edi
+  80373d:	56                   	push   %esi
+  80373e:	53                   	push   %ebx
+  80373f:	83 ec 18             	sub    $0x18,%esp
+  803742:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803745:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803748:	57                   	push   %edi
+  803749:	e8 bf e1 ff ff       	call   80190d <fd2data>
+  80374e:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803750:	83 c4 10             	add    $0x10,%esp
+  803753:	89 f3                	mov    %esi,%ebx
+  803755:	83 e3 01             	and    $0x1,%ebx
+  803758:	75 27                	jne    803781 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80375a:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803760:	75 48                	jne    8037aa <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803762:	89 ca                	mov    %ecx,%edx
+  803764:	89 f8                	mov    %edi,%eax
+  803766:	e8 ce fb ff ff       	call   803339 <_pipeisclosed>
+  80376b:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80376d:	89 d8                	mov    %ebx,%eax
+  80376f:	83 c8 10             	or     $0x10,%eax
+  803772:	85 d2                	test   %edx,%edx
+  803774:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803777:	89 d8                	mov    %ebx,%eax
+  803779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80377c:	5b                   	pop    %ebx
+  80377d:	5e                   	pop    %esi
+  80377e:	5f                   	pop    %edi
+  80377f:	5d                   	pop    %ebp
+  803780:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803781:	8b 58 04             	mov    0x4(%eax),%ebx
+  803784:	8b 00                	mov    (%eax),%eax
+  803786:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80378c:	29 c3                	sub    %eax,%ebx
+  80378e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803793:	89 d8                	mov    %ebx,%eax
+  803795:	f7 e2                	mul    %edx
+  803797:	c1 ea 0c             	shr    $0xc,%edx
+  80379a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8037a0:	39 d3                	cmp    %edx,%ebx
+  8037a2:	0f 95 c3             	setne  %bl
+  8037a5:	0f b6 db             	movzbl %bl,%ebx
+  8037a8:	eb b0                	jmp    80375a <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037aa:	8b 71 04             	mov    0x4(%ecx),%esi
+  8037ad:	8b 01                	mov    (%ecx),%eax
+  8037af:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8037b5:	29 c6                	sub    %eax,%esi
+  8037b7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8037bc:	89 f0                	mov    %esi,%eax
+  8037be:	f7 e2                	mul    %edx
+  8037c0:	c1 ea 0c             	shr    $0xc,%edx
+  8037c3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037c9:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8037cb:	89 d8                	mov    %ebx,%eax
+  8037cd:	83 c8 04             	or     $0x4,%eax
+  8037d0:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8037d6:	0f 42 d8             	cmovb  %eax,%ebx
+  8037d9:	eb 87                	jmp    803762 <devpipe_poll+0x29>
+
+008037db <pipe>:
+{
+  8037db:	55                   	push   %ebp
+  8037dc:	89 e5                	mov    %esp,%ebp
+  8037de:	56                   	push   %esi
+  8037df:	53                   	push   %ebx
+  8037e0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8037e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037e6:	50                   	push   %eax
+  8037e7:	e8 38 e1 ff ff       	call   801924 <fd_alloc>
+  8037ec:	89 c3                	mov    %eax,%ebx
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	85 c0                	test   %eax,%eax
+  8037f3:	0f 88 23 01 00 00    	js     80391c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037f9:	83 ec 04             	sub    $0x4,%esp
+  8037fc:	68 07 04 00 00       	push   $0x407
+  803801:	ff 75 f4             	push   -0xc(%ebp)
+  803804:	6a 00                	push   $0x0
+  803806:	e8 13 d5 ff ff       	call   800d1e <sys_page_alloc>
+  80380b:	89 c3                	mov    %eax,%ebx
+  80380d:	83 c4 10             	add    $0x10,%esp
+  803810:	85 c0                	test   %eax,%eax
+  803812:	0f 88 04 01 00 00    	js     80391c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803818:	83 ec 0c             	sub    $0xc,%esp
+  80381b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80381e:	50                   	push   %eax
+  80381f:	e8 00 e1 ff ff       	call   801924 <fd_alloc>
+  803824:	89 c3                	mov    %eax,%ebx
+  803826:	83 c4 10             	add    $0x10,%esp
+  803829:	85 c0                	test   %eax,%eax
+  80382b:	0f 88 db 00 00 00    	js     80390c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803831:	83 ec 04             	sub    $0x4,%esp
+  803834:	68 07 04 00 00       	push   $0x407
+  803839:	ff 75 f0             	push   -0x10(%ebp)
+  80383c:	6a 00                	push   $0x0
+  80383e:	e8 db d4 ff ff       	call   800d1e <sys_page_alloc>
+  803843:	89 c3                	mov    %eax,%ebx
+  803845:	83 c4 10             	add    $0x10,%esp
+  803848:	85 c0                	test   %eax,%eax
+  80384a:	0f 88 bc 00 00 00    	js     80390c <pipe+0x131>
+	va = fd2data(fd0);
+  803850:	83 ec 0c             	sub    $0xc,%esp
+  803853:	ff 75 f4             	push   -0xc(%ebp)
+  803856:	e8 b2 e0 ff ff       	call   80190d <fd2data>
+  80385b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80385d:	83 c4 0c             	add    $0xc,%esp
+  803860:	68 07 04 00 00       	push   $0x407
+  803865:	50                   	push   %eax
+  803866:	6a 00                	push   $0x0
+  803868:	e8 b1 d4 ff ff       	call   800d1e <sys_page_alloc>
+  80386d:	89 c3                	mov    %eax,%ebx
+  80386f:	83 c4 10             	add    $0x10,%esp
+  803872:	85 c0                	test   %eax,%eax
+  803874:	0f 88 82 00 00 00    	js     8038fc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80387a:	83 ec 0c             	sub    $0xc,%esp
+  80387d:	ff 75 f0             	push   -0x10(%ebp)
+  803880:	e8 88 e0 ff ff       	call   80190d <fd2data>
+  803885:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80388c:	50                   	push   %eax
+  80388d:	6a 00                	push   $0x0
+  80388f:	56                   	push   %esi
+  803890:	6a 00                	push   $0x0
+  803892:	e8 ca d4 ff ff       	call   800d61 <sys_page_map>
+  803897:	89 c3                	mov    %eax,%ebx
+  803899:	83 c4 20             	add    $0x20,%esp
+  80389c:	85 c0                	test   %eax,%eax
+  80389e:	78 4e                	js     8038ee <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8038a0:	a1 60 50 80 00       	mov    0x805060,%eax
+  8038a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038a8:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8038aa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8038ad:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8038b4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8038b7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8038b9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038bc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8038c3:	83 ec 0c             	sub    $0xc,%esp
+  8038c6:	ff 75 f4             	push   -0xc(%ebp)
+  8038c9:	e8 2f e0 ff ff       	call   8018fd <fd2num>
+  8038ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038d1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8038d3:	83 c4 04             	add    $0x4,%esp
+  8038d6:	ff 75 f0             	push   -0x10(%ebp)
+  8038d9:	e8 1f e0 ff ff       	call   8018fd <fd2num>
+  8038de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038e1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8038e4:	83 c4 10             	add    $0x10,%esp
+  8038e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038ec:	eb 2e                	jmp    80391c <pipe+0x141>
+	sys_page_unmap(0, va);
+  8038ee:	83 ec 08             	sub    $0x8,%esp
+  8038f1:	56                   	push   %esi
+  8038f2:	6a 00                	push   $0x0
+  8038f4:	e8 aa d4 ff ff       	call   800da3 <sys_page_unmap>
+  8038f9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8038fc:	83 ec 08             	sub    $0x8,%esp
+  8038ff:	ff 75 f0             	push   -0x10(%ebp)
+  803902:	6a 00                	push   $0x0
+  803904:	e8 9a d4 ff ff       	call   800da3 <sys_page_unmap>
+  803909:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80390c:	83 ec 08             	sub    $0x8,%esp
+  80390f:	ff 75 f4             	push   -0xc(%ebp)
+  803912:	6a 00                	push   $0x0
+  803914:	e8 8a d4 ff ff       	call   800da3 <sys_page_unmap>
+  803919:	83 c4 10             	add    $0x10,%esp
+}
+  80391c:	89 d8                	mov    %ebx,%eax
+  80391e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803921:	5b                   	pop    %ebx
+  803922:	5e                   	pop    %esi
+  803923:	5d                   	pop    %ebp
+  803924:	c3                   	ret
+
+00803925 <pipeisclosed>:
+{
+  803925:	55                   	push   %ebp
+  803926:	89 e5                	mov    %esp,%ebp
+  803928:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80392b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80392e:	50                   	push   %eax
+  80392f:	ff 75 08             	push   0x8(%ebp)
+  803932:	e8 3d e0 ff ff       	call   801974 <fd_lookup>
+  803937:	83 c4 10             	add    $0x10,%esp
+  80393a:	85 c0                	test   %eax,%eax
+  80393c:	78 18                	js     803956 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80393e:	83 ec 0c             	sub    $0xc,%esp
+  803941:	ff 75 f4             	push   -0xc(%ebp)
+  803944:	e8 c4 df ff ff       	call   80190d <fd2data>
+  803949:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80394b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80394e:	e8 e6 f9 ff ff       	call   803339 <_pipeisclosed>
+  803953:	83 c4 10             	add    $0x10,%esp
+}
+  803956:	c9                   	leave
+  803957:	c3                   	ret
+
+00803958 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803958:	55                   	push   %ebp
+  803959:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80395b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80395e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803964:	5d                   	pop    %ebp
+  803965:	c3                   	ret
+
+00803966 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803966:	55                   	push   %ebp
+  803967:	89 e5                	mov    %esp,%ebp
+  803969:	53                   	push   %ebx
+  80396a:	83 ec 04             	sub    $0x4,%esp
+  80396d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803970:	8b 03                	mov    (%ebx),%eax
+  803972:	85 c0                	test   %eax,%eax
+  803974:	75 05                	jne    80397b <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803976:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803979:	c9                   	leave
+  80397a:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80397b:	83 ec 08             	sub    $0x8,%esp
+  80397e:	50                   	push   %eax
+  80397f:	8d 43 04             	lea    0x4(%ebx),%eax
+  803982:	50                   	push   %eax
+  803983:	e8 6b d6 ff ff       	call   800ff3 <sys_page_batch>
+	pb->pb_n = 0;
+  803988:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80398e:	83 c4 10             	add    $0x10,%esp
+  803991:	eb e3                	jmp    803976 <pgbatch_flush+0x10>
+
+00803993 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803993:	55                   	push   %ebp
+  803994:	89 e5                	mov    %esp,%ebp
+  803996:	56                   	push   %esi
+  803997:	53                   	push   %ebx
+  803998:	89 c3                	mov    %eax,%ebx
+  80399a:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80399c:	83 38 20             	cmpl   $0x20,(%eax)
+  80399f:	74 2c                	je     8039cd <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8039a1:	8b 03                	mov    (%ebx),%eax
+  8039a3:	8d 50 01             	lea    0x1(%eax),%edx
+  8039a6:	89 13                	mov    %edx,(%ebx)
+  8039a8:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8039ab:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8039af:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8039b1:	83 ec 04             	sub    $0x4,%esp
+  8039b4:	6a 18                	push   $0x18
+  8039b6:	6a 00                	push   $0x0
+  8039b8:	50                   	push   %eax
+  8039b9:	e8 a7 d0 ff ff       	call   800a65 <memset>
+	return 0;
+  8039be:	83 c4 10             	add    $0x10,%esp
+  8039c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039c9:	5b                   	pop    %ebx
+  8039ca:	5e                   	pop    %esi
+  8039cb:	5d                   	pop    %ebp
+  8039cc:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8039cd:	83 ec 0c             	sub    $0xc,%esp
+  8039d0:	50                   	push   %eax
+  8039d1:	e8 90 ff ff ff       	call   803966 <pgbatch_flush>
+  8039d6:	83 c4 10             	add    $0x10,%esp
+  8039d9:	85 c0                	test   %eax,%eax
+  8039db:	79 c4                	jns    8039a1 <pgbatch_slot+0xe>
+  8039dd:	eb e7                	jmp    8039c6 <pgbatch_slot+0x33>
+
+008039df <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8039df:	55                   	push   %ebp
+  8039e0:	89 e5                	mov    %esp,%ebp
+  8039e2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8039e5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8039e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039eb:	e8 a3 ff ff ff       	call   803993 <pgbatch_slot>
+  8039f0:	85 c0                	test   %eax,%eax
+  8039f2:	78 20                	js     803a14 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8039f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039f7:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8039fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a00:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803a03:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a06:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a09:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a0c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a14:	c9                   	leave
+  803a15:	c3                   	ret
+
+00803a16 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803a16:	55                   	push   %ebp
+  803a17:	89 e5                	mov    %esp,%ebp
+  803a19:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a1c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a22:	e8 6c ff ff ff       	call   803993 <pgbatch_slot>
+  803a27:	85 c0                	test   %eax,%eax
+  803a29:	78 2c                	js     803a57 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a2e:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803a34:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a37:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803a3a:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a3d:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803a40:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a43:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803a46:	8b 55 18             	mov    0x18(%ebp),%edx
+  803a49:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803a4c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803a4f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a57:	c9                   	leave
+  803a58:	c3                   	ret
+
+00803a59 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803a59:	55                   	push   %ebp
+  803a5a:	89 e5                	mov    %esp,%ebp
+  803a5c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a5f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a65:	e8 29 ff ff ff       	call   803993 <pgbatch_slot>
+  803a6a:	85 c0                	test   %eax,%eax
+  803a6c:	78 1a                	js     803a88 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803a6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a71:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803a77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a7a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803a7d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a80:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803a83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a88:	c9                   	leave
+  803a89:	c3                   	ret
+
+00803a8a <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803a8a:	55                   	push   %ebp
+  803a8b:	89 e5                	mov    %esp,%ebp
+  803a8d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803a90:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803a93:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a96:	e8 f8 fe ff ff       	call   803993 <pgbatch_slot>
+  803a9b:	85 c0                	test   %eax,%eax
+  803a9d:	78 20                	js     803abf <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803aa2:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803aab:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803aae:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ab1:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ab4:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ab7:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803aba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803abf:	c9                   	leave
+  803ac0:	c3                   	ret
+
+00803ac1 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803ac1:	55                   	push   %ebp
+  803ac2:	89 e5                	mov    %esp,%ebp
+  803ac4:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ac7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  803acd:	e8 c1 fe ff ff       	call   803993 <pgbatch_slot>
+  803ad2:	85 c0                	test   %eax,%eax
+  803ad4:	78 26                	js     803afc <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803ad6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ad9:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803adf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ae2:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803ae5:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ae8:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803aeb:	8b 55 14             	mov    0x14(%ebp),%edx
+  803aee:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803af1:	8b 55 18             	mov    0x18(%ebp),%edx
+  803af4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803af7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803afc:	c9                   	leave
+  803afd:	c3                   	ret
+
+00803afe <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803afe:	55                   	push   %ebp
+  803aff:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803b01:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b04:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b0a:	5d                   	pop    %ebp
+  803b0b:	c3                   	ret
+
+00803b0c <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803b0c:	55                   	push   %ebp
+  803b0d:	89 e5                	mov    %esp,%ebp
+  803b0f:	56                   	push   %esi
+  803b10:	53                   	push   %ebx
+  803b11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803b14:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b19:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b1e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803b22:	85 c0                	test   %eax,%eax
+  803b24:	74 2f                	je     803b55 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803b26:	83 f8 02             	cmp    $0x2,%eax
+  803b29:	74 0c                	je     803b37 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803b2b:	b8 02 00 00 00       	mov    $0x2,%eax
+  803b30:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803b33:	85 c0                	test   %eax,%eax
+  803b35:	74 1e                	je     803b55 <mutex_lock+0x49>
+  803b37:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803b3c:	83 ec 04             	sub    $0x4,%esp
+  803b3f:	6a ff                	push   $0xffffffff
+  803b41:	6a 02                	push   $0x2
+  803b43:	53                   	push   %ebx
+  803b44:	e8 d3 d5 ff ff       	call   80111c <sys_futex_wait>
+  803b49:	89 f0                	mov    %esi,%eax
+  803b4b:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803b4e:	83 c4 10             	add    $0x10,%esp
+  803b51:	85 c0                	test   %eax,%eax
+  803b53:	75 e7                	jne    803b3c <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803b55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b58:	5b                   	pop    %ebx
+  803b59:	5e                   	pop    %esi
+  803b5a:	5d                   	pop    %ebp
+  803b5b:	c3                   	ret
+
+00803b5c <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803b5c:	55                   	push   %ebp
+  803b5d:	89 e5                	mov    %esp,%ebp
+  803b5f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b67:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803b6c:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803b70:	85 c0                	test   %eax,%eax
+  803b72:	0f 94 c0             	sete   %al
+  803b75:	0f b6 c0             	movzbl %al,%eax
+}
+  803b78:	5d                   	pop    %ebp
+  803b79:	c3                   	ret
+
+00803b7a <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803b7a:	55                   	push   %ebp
+  803b7b:	89 e5                	mov    %esp,%ebp
+  803b7d:	83 ec 08             	sub    $0x8,%esp
+  803b80:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b88:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803b8b:	83 f8 02             	cmp    $0x2,%eax
+  803b8e:	74 02                	je     803b92 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803b90:	c9                   	leave
+  803b91:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803b92:	83 ec 08             	sub    $0x8,%esp
+  803b95:	6a 01                	push   $0x1
+  803b97:	52                   	push   %edx
+  803b98:	e8 a1 d5 ff ff       	call   80113e <sys_futex_wake>
+  803b9d:	83 c4 10             	add    $0x10,%esp
+}
+  803ba0:	eb ee                	jmp    803b90 <mutex_unlock+0x16>
+
+00803ba2 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803ba2:	55                   	push   %ebp
+  803ba3:	89 e5                	mov    %esp,%ebp
+  803ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803ba8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803bae:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803bb5:	5d                   	pop    %ebp
+  803bb6:	c3                   	ret
+
+00803bb7 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803bb7:	55                   	push   %ebp
+  803bb8:	89 e5                	mov    %esp,%ebp
+  803bba:	57                   	push   %edi
+  803bbb:	56                   	push   %esi
+  803bbc:	53                   	push   %ebx
+  803bbd:	83 ec 18             	sub    $0x18,%esp
+  803bc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803bc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803bc6:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803bc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bcd:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803bd2:	57                   	push   %edi
+  803bd3:	e8 a2 ff ff ff       	call   803b7a <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803bd8:	83 c4 0c             	add    $0xc,%esp
+  803bdb:	ff 75 10             	push   0x10(%ebp)
+  803bde:	56                   	push   %esi
+  803bdf:	53                   	push   %ebx
+  803be0:	e8 37 d5 ff ff       	call   80111c <sys_futex_wait>
+  803be5:	89 c6                	mov    %eax,%esi
+  803be7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803bec:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803bf1:	89 3c 24             	mov    %edi,(%esp)
+  803bf4:	e8 13 ff ff ff       	call   803b0c <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803bf9:	83 c4 10             	add    $0x10,%esp
+  803bfc:	83 fe ef             	cmp    $0xffffffef,%esi
+  803bff:	74 05                	je     803c06 <cond_timedwait+0x4f>
+  803c01:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803c06:	89 f0                	mov    %esi,%eax
+  803c08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c0b:	5b                   	pop    %ebx
+  803c0c:	5e                   	pop    %esi
+  803c0d:	5f                   	pop    %edi
+  803c0e:	5d                   	pop    %ebp
+  803c0f:	c3                   	ret
+
+00803c10 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803c10:	55                   	push   %ebp
+  803c11:	89 e5                	mov    %esp,%ebp
+  803c13:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803c16:	6a ff                	push   $0xffffffff
+  803c18:	ff 75 0c             	push   0xc(%ebp)
+  803c1b:	ff 75 08             	push   0x8(%ebp)
+  803c1e:	e8 94 ff ff ff       	call   803bb7 <cond_timedwait>
+}
+  803c23:	83 c4 10             	add    $0x10,%esp
+  803c26:	c9                   	leave
+  803c27:	c3                   	ret
+
+00803c28 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803c28:	55                   	push   %ebp
+  803c29:	89 e5                	mov    %esp,%ebp
+  803c2b:	83 ec 08             	sub    $0x8,%esp
+  803c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c31:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c36:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803c3a:	8b 50 04             	mov    0x4(%eax),%edx
+  803c3d:	85 d2                	test   %edx,%edx
+  803c3f:	75 02                	jne    803c43 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803c41:	c9                   	leave
+  803c42:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803c43:	83 ec 08             	sub    $0x8,%esp
+  803c46:	6a 01                	push   $0x1
+  803c48:	50                   	push   %eax
+  803c49:	e8 f0 d4 ff ff       	call   80113e <sys_futex_wake>
+  803c4e:	83 c4 10             	add    $0x10,%esp
+}
+  803c51:	eb ee                	jmp    803c41 <cond_signal+0x19>
+
+00803c53 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803c53:	55                   	push   %ebp
+  803c54:	89 e5                	mov    %esp,%ebp
+  803c56:	83 ec 08             	sub    $0x8,%esp
+  803c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c5c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c61:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803c65:	8b 50 04             	mov    0x4(%eax),%edx
+  803c68:	85 d2                	test   %edx,%edx
+  803c6a:	75 02                	jne    803c6e <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803c6c:	c9                   	leave
+  803c6d:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803c6e:	83 ec 08             	sub    $0x8,%esp
+  803c71:	68 00 04 00 00       	push   $0x400
+  803c76:	50                   	push   %eax
+  803c77:	e8 c2 d4 ff ff       	call   80113e <sys_futex_wake>
+  803c7c:	83 c4 10             	add    $0x10,%esp
+}
+  803c7f:	eb eb                	jmp    803c6c <cond_broadcast+0x19>
+
+00803c81 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803c81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c86:	c3                   	ret
+
+00803c87 <devcons_poll>:
+{
+  803c87:	55                   	push   %ebp
+  803c88:	89 e5                	mov    %esp,%ebp
+  803c8a:	53                   	push   %ebx
+  803c8b:	83 ec 04             	sub    $0x4,%esp
+  803c8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803c91:	89 da                	mov    %ebx,%edx
+  803c93:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803c96:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803c9d:	74 0c                	je     803cab <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803c9f:	89 d8                	mov    %ebx,%eax
+  803ca1:	83 e0 01             	and    $0x1,%eax
+  803ca4:	09 d0                	or     %edx,%eax
+}
+  803ca6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ca9:	c9                   	leave
+  803caa:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803cab:	e8 d0 cf ff ff       	call   800c80 <sys_cgetc>
+  803cb0:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803cb5:	89 da                	mov    %ebx,%edx
+  803cb7:	83 e2 04             	and    $0x4,%edx
+  803cba:	85 c0                	test   %eax,%eax
+  803cbc:	74 e6                	je     803ca4 <devcons_poll+0x1d>
+  803cbe:	eb df                	jmp    803c9f <devcons_poll+0x18>
+
+00803cc0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+  803cc3:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803cc6:	68 76 4a 80 00       	push   $0x804a76
+  803ccb:	ff 75 0c             	push   0xc(%ebp)
+  803cce:	e8 17 cc ff ff       	call   8008ea <strcpy>
+	return 0;
+}
+  803cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd8:	c9                   	leave
+  803cd9:	c3                   	ret
+
+00803cda <devcons_write>:
+{
+  803cda:	55                   	push   %ebp
+  803cdb:	89 e5                	mov    %esp,%ebp
+  803cdd:	57                   	push   %edi
+  803cde:	56                   	push   %esi
+  803cdf:	53                   	push   %ebx
+  803ce0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803ce6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803ce9:	85 ff                	test   %edi,%edi
+  803ceb:	74 51                	je     803d3e <devcons_write+0x64>
+  803ced:	be 00 00 00 00       	mov    $0x0,%esi
+  803cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803cf7:	89 fb                	mov    %edi,%ebx
+  803cf9:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803cfb:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803d00:	39 d3                	cmp    %edx,%ebx
+  803d02:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803d05:	83 ec 04             	sub    $0x4,%esp
+  803d08:	53                   	push   %ebx
+  803d09:	03 45 0c             	add    0xc(%ebp),%eax
+  803d0c:	50                   	push   %eax
+  803d0d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d13:	50                   	push   %eax
+  803d14:	e8 81 cd ff ff       	call   800a9a <memmove>
+		sys_cputs(buf, m);
+  803d19:	83 c4 08             	add    $0x8,%esp
+  803d1c:	53                   	push   %ebx
+  803d1d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d23:	50                   	push   %eax
+  803d24:	e8 39 cf ff ff       	call   800c62 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d29:	01 de                	add    %ebx,%esi
+  803d2b:	89 f0                	mov    %esi,%eax
+  803d2d:	83 c4 10             	add    $0x10,%esp
+  803d30:	39 fe                	cmp    %edi,%esi
+  803d32:	72 c3                	jb     803cf7 <devcons_write+0x1d>
+}
+  803d34:	89 f0                	mov    %esi,%eax
+  803d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d39:	5b                   	pop    %ebx
+  803d3a:	5e                   	pop    %esi
+  803d3b:	5f                   	pop    %edi
+  803d3c:	5d                   	pop    %ebp
+  803d3d:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803d3e:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803d43:	eb ef                	jmp    803d34 <devcons_write+0x5a>
+
+00803d45 <devcons_read>:
+{
+  803d45:	55                   	push   %ebp
+  803d46:	89 e5                	mov    %esp,%ebp
+  803d48:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803d4b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803d50:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d54:	74 36                	je     803d8c <devcons_read+0x47>
+	c = cons_peek;
+  803d56:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  803d5b:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  803d62:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803d65:	85 c0                	test   %eax,%eax
+  803d67:	75 10                	jne    803d79 <devcons_read+0x34>
+  803d69:	e8 12 cf ff ff       	call   800c80 <sys_cgetc>
+  803d6e:	85 c0                	test   %eax,%eax
+  803d70:	75 07                	jne    803d79 <devcons_read+0x34>
+		sys_yield();
+  803d72:	e8 88 cf ff ff       	call   800cff <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803d77:	eb f0                	jmp    803d69 <devcons_read+0x24>
+	if (c < 0)
+  803d79:	85 c0                	test   %eax,%eax
+  803d7b:	78 0f                	js     803d8c <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803d7d:	83 f8 04             	cmp    $0x4,%eax
+  803d80:	74 0c                	je     803d8e <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803d82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d85:	88 02                	mov    %al,(%edx)
+	return 1;
+  803d87:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803d8c:	c9                   	leave
+  803d8d:	c3                   	ret
+		return 0;
+  803d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d93:	eb f7                	jmp    803d8c <devcons_read+0x47>
+
+00803d95 <cputchar>:
+{
+  803d95:	55                   	push   %ebp
+  803d96:	89 e5                	mov    %esp,%ebp
+  803d98:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d9e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803da1:	6a 01                	push   $0x1
+  803da3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803da6:	50                   	push   %eax
+  803da7:	e8 b6 ce ff ff       	call   800c62 <sys_cputs>
+}
+  803dac:	83 c4 10             	add    $0x10,%esp
+  803daf:	c9                   	leave
+  803db0:	c3                   	ret
+
+00803db1 <getchar>:
+{
+  803db1:	55                   	push   %ebp
+  803db2:	89 e5                	mov    %esp,%ebp
+  803db4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803db7:	6a 01                	push   $0x1
+  803db9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803dbc:	50                   	push   %eax
+  803dbd:	6a 00                	push   $0x0
+  803dbf:	e8 34 de ff ff       	call   801bf8 <read>
+	if (r < 0)
+  803dc4:	83 c4 10             	add    $0x10,%esp
+  803dc7:	85 c0                	test   %eax,%eax
+  803dc9:	78 06                	js     803dd1 <getchar+0x20>
+	if (r < 1)
+  803dcb:	74 06                	je     803dd3 <getchar+0x22>
+	return c;
+  803dcd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803dd1:	c9                   	leave
+  803dd2:	c3                   	ret
+		return -E_EOF;
+  803dd3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803dd8:	eb f7                	jmp    803dd1 <getchar+0x20>
+
+00803dda <iscons>:
+{
+  803dda:	55                   	push   %ebp
+  803ddb:	89 e5                	mov    %esp,%ebp
+  803ddd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803de0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803de3:	50                   	push   %eax
+  803de4:	ff 75 08             	push   0x8(%ebp)
+  803de7:	e8 88 db ff ff       	call   801974 <fd_lookup>
+  803dec:	83 c4 10             	add    $0x10,%esp
+  803def:	85 c0                	test   %eax,%eax
+  803df1:	78 11                	js     803e04 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803df6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803dfc:	39 10                	cmp    %edx,(%eax)
+  803dfe:	0f 94 c0             	sete   %al
+  803e01:	0f b6 c0             	movzbl %al,%eax
+}
+  803e04:	c9                   	leave
+  803e05:	c3                   	ret
+
+00803e06 <opencons>:
+{
+  803e06:	55                   	push   %ebp
+  803e07:	89 e5                	mov    %esp,%ebp
+  803e09:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803e0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e0f:	50                   	push   %eax
+  803e10:	e8 0f db ff ff       	call   801924 <fd_alloc>
+  803e15:	83 c4 10             	add    $0x10,%esp
+  803e18:	85 c0                	test   %eax,%eax
+  803e1a:	78 3a                	js     803e56 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803e1c:	83 ec 04             	sub    $0x4,%esp
+  803e1f:	68 07 04 00 00       	push   $0x407
+  803e24:	ff 75 f4             	push   -0xc(%ebp)
+  803e27:	6a 00                	push   $0x0
+  803e29:	e8 f0 ce ff ff       	call   800d1e <sys_page_alloc>
+  803e2e:	83 c4 10             	add    $0x10,%esp
+  803e31:	85 c0                	test   %eax,%eax
+  803e33:	78 21                	js     803e56 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803e35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e38:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803e3e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803e40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e43:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803e4a:	83 ec 0c             	sub    $0xc,%esp
+  803e4d:	50                   	push   %eax
+  803e4e:	e8 aa da ff ff       	call   8018fd <fd2num>
+  803e53:	83 c4 10             	add    $0x10,%esp
+}
+  803e56:	c9                   	leave
+  803e57:	c3                   	ret
+
+00803e58 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803e58:	55                   	push   %ebp
+  803e59:	89 e5                	mov    %esp,%ebp
+  803e5b:	56                   	push   %esi
+  803e5c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803e5d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803e60:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  803e66:	e8 75 ce ff ff       	call   800ce0 <sys_getenvid>
+  803e6b:	83 ec 0c             	sub    $0xc,%esp
+  803e6e:	ff 75 0c             	push   0xc(%ebp)
+  803e71:	ff 75 08             	push   0x8(%ebp)
+  803e74:	56                   	push   %esi
+  803e75:	50                   	push   %eax
+  803e76:	68 84 4a 80 00       	push   $0x804a84
+  803e7b:	e8 73 c3 ff ff       	call   8001f3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803e80:	83 c4 18             	add    $0x18,%esp
+  803e83:	53                   	push   %ebx
+  803e84:	ff 75 10             	push   0x10(%ebp)
+  803e87:	e8 16 c3 ff ff       	call   8001a2 <vcprintf>
+	cprintf("\n");
+  803e8c:	c7 04 24 f4 44 80 00 	movl   $0x8044f4,(%esp)
+  803e93:	e8 5b c3 ff ff       	call   8001f3 <cprintf>
+  803e98:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803e9b:	cc                   	int3
+	while (1)
+  803e9c:	eb fd                	jmp    803e9b <_panic+0x43>
+
+00803e9e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803e9e:	55                   	push   %ebp
+  803e9f:	89 e5                	mov    %esp,%ebp
+  803ea1:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803ea4:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803eab:	74 0a                	je     803eb7 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803ead:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eb0:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803eb5:	c9                   	leave
+  803eb6:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  803eb7:	83 ec 04             	sub    $0x4,%esp
+  803eba:	6a 07                	push   $0x7
+  803ebc:	68 00 f0 bf ee       	push   $0xeebff000
+  803ec1:	6a 00                	push   $0x0
+  803ec3:	e8 56 ce ff ff       	call   800d1e <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803ec8:	83 c4 08             	add    $0x8,%esp
+  803ecb:	68 dc 3e 80 00       	push   $0x803edc
+  803ed0:	6a 00                	push   $0x0
+  803ed2:	e8 92 cf ff ff       	call   800e69 <sys_env_set_pgfault_upcall>
+  803ed7:	83 c4 10             	add    $0x10,%esp
+  803eda:	eb d1                	jmp    803ead <set_pgfault_handler+0xf>
+
+00803edc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803edc:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803edd:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803ee2:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803ee4:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  803ee7:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  803eeb:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  803eee:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  803ef2:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  803ef4:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  803ef8:	83 c4 08             	add    $0x8,%esp
+	popal;
+  803efb:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  803efc:	83 c4 04             	add    $0x4,%esp
+	popf
+  803eff:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  803f00:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  803f01:	c3                   	ret
+
+00803f02 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803f02:	55                   	push   %ebp
+  803f03:	89 e5                	mov    %esp,%ebp
+  803f05:	56                   	push   %esi
+  803f06:	53                   	push   %ebx
+  803f07:	8b 75 08             	mov    0x8(%ebp),%esi
+  803f0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803f10:	85 c0                	test   %eax,%eax
+  803f12:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f17:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803f1a:	83 ec 0c             	sub    $0xc,%esp
+  803f1d:	50                   	push   %eax
+  803f1e:	e8 ab cf ff ff       	call   800ece <sys_ipc_recv>
+  803f23:	83 c4 10             	add    $0x10,%esp
+  803f26:	85 c0                	test   %eax,%eax
+  803f28:	0f 88 8b 00 00 00    	js     803fb9 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803f2e:	85 f6                	test   %esi,%esi
+  803f30:	74 2a                	je     803f5c <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803f32:	89 e2                	mov    %esp,%edx
+  803f34:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f39:	29 d0                	sub    %edx,%eax
+  803f3b:	89 c2                	mov    %eax,%edx
+  803f3d:	c1 ea 0f             	shr    $0xf,%edx
+  803f40:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803f4d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803f54:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803f5a:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803f5c:	85 db                	test   %ebx,%ebx
+  803f5e:	74 2a                	je     803f8a <ipc_recv+0x88>
+  803f60:	89 e2                	mov    %esp,%edx
+  803f62:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f67:	29 d0                	sub    %edx,%eax
+  803f69:	89 c2                	mov    %eax,%edx
+  803f6b:	c1 ea 0f             	shr    $0xf,%edx
+  803f6e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f78:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803f7b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803f82:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803f88:	89 03                	mov    %eax,(%ebx)
+  803f8a:	89 e2                	mov    %esp,%edx
+  803f8c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803f91:	29 d0                	sub    %edx,%eax
+  803f93:	89 c2                	mov    %eax,%edx
+  803f95:	c1 ea 0f             	shr    $0xf,%edx
+  803f98:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fa2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803fa5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803fac:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fb5:	5b                   	pop    %ebx
+  803fb6:	5e                   	pop    %esi
+  803fb7:	5d                   	pop    %ebp
+  803fb8:	c3                   	ret
+		if(from_env_store != NULL)
+  803fb9:	85 f6                	test   %esi,%esi
+  803fbb:	74 06                	je     803fc3 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803fbd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803fc3:	85 db                	test   %ebx,%ebx
+  803fc5:	74 eb                	je     803fb2 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803fc7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803fcd:	eb e3                	jmp    803fb2 <ipc_recv+0xb0>
+
+00803fcf <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803fcf:	55                   	push   %ebp
+  803fd0:	89 e5                	mov    %esp,%ebp
+  803fd2:	57                   	push   %edi
+  803fd3:	56                   	push   %esi
+  803fd4:	53                   	push   %ebx
+  803fd5:	83 ec 14             	sub    $0x14,%esp
+  803fd8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803fdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803fde:	8b 75 14             	mov    0x14(%ebp),%esi
+  803fe1:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  803fe4:	85 c0                	test   %eax,%eax
+  803fe6:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803feb:	0f 44 c2             	cmove  %edx,%eax
+  803fee:	ff 75 10             	push   0x10(%ebp)
+  803ff1:	50                   	push   %eax
+  803ff2:	e8 39 cf ff ff       	call   800f30 <sys_ipc_recv_pages>
+  803ff7:	83 c4 10             	add    $0x10,%esp
+  803ffa:	85 c0                	test   %eax,%eax
+  803ffc:	0f 88 ba 00 00 00    	js     8040bc <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804002:	85 ff                	test   %edi,%edi
+  804004:	74 2a                	je     804030 <ipc_recv_pages+0x61>
+  804006:	89 e2                	mov    %esp,%edx
+  804008:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80400d:	29 d0                	sub    %edx,%eax
+  80400f:	89 c2                	mov    %eax,%edx
+  804011:	c1 ea 0f             	shr    $0xf,%edx
+  804014:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804019:	b8 00 00 00 00       	mov    $0x0,%eax
+  80401e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804021:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804028:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80402e:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804030:	85 f6                	test   %esi,%esi
+  804032:	74 2a                	je     80405e <ipc_recv_pages+0x8f>
+  804034:	89 e2                	mov    %esp,%edx
+  804036:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80403b:	29 d0                	sub    %edx,%eax
+  80403d:	89 c2                	mov    %eax,%edx
+  80403f:	c1 ea 0f             	shr    $0xf,%edx
+  804042:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80404c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80404f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804056:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80405c:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80405e:	85 db                	test   %ebx,%ebx
+  804060:	74 2a                	je     80408c <ipc_recv_pages+0xbd>
+  804062:	89 e2                	mov    %esp,%edx
+  804064:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804069:	29 d0                	sub    %edx,%eax
+  80406b:	89 c2                	mov    %eax,%edx
+  80406d:	c1 ea 0f             	shr    $0xf,%edx
+  804070:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407a:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80407d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804084:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80408a:	89 03                	mov    %eax,(%ebx)
+  80408c:	89 e2                	mov    %esp,%edx
+  80408e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804093:	29 d0                	sub    %edx,%eax
+  804095:	89 c2                	mov    %eax,%edx
+  804097:	c1 ea 0f             	shr    $0xf,%edx
+  80409a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80409f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8040a7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040ae:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8040b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040b7:	5b                   	pop    %ebx
+  8040b8:	5e                   	pop    %esi
+  8040b9:	5f                   	pop    %edi
+  8040ba:	5d                   	pop    %ebp
+  8040bb:	c3                   	ret
+		if (from_env_store)
+  8040bc:	85 ff                	test   %edi,%edi
+  8040be:	74 06                	je     8040c6 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8040c0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8040c6:	85 f6                	test   %esi,%esi
+  8040c8:	74 06                	je     8040d0 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8040ca:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8040d0:	85 db                	test   %ebx,%ebx
+  8040d2:	74 e0                	je     8040b4 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8040d4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8040da:	eb d8                	jmp    8040b4 <ipc_recv_pages+0xe5>
+
+008040dc <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8040dc:	55                   	push   %ebp
+  8040dd:	89 e5                	mov    %esp,%ebp
+  8040df:	57                   	push   %edi
+  8040e0:	56                   	push   %esi
+  8040e1:	53                   	push   %ebx
+  8040e2:	83 ec 1c             	sub    $0x1c,%esp
+  8040e5:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8040e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8040eb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8040f1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8040f5:	75 2b                	jne    804122 <ipc_try_send_pages+0x46>
+  8040f7:	89 e2                	mov    %esp,%edx
+  8040f9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040fe:	29 d0                	sub    %edx,%eax
+  804100:	89 c2                	mov    %eax,%edx
+  804102:	c1 ea 0f             	shr    $0xf,%edx
+  804105:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80410a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410f:	0f 42 c2             	cmovb  %edx,%eax
+  804112:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804119:	8b 70 48             	mov    0x48(%eax),%esi
+  80411c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804122:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804128:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80412d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804130:	85 ff                	test   %edi,%edi
+  804132:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804137:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80413a:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804140:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804146:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80414c:	83 ec 0c             	sub    $0xc,%esp
+  80414f:	ff 75 14             	push   0x14(%ebp)
+  804152:	ff 75 18             	push   0x18(%ebp)
+  804155:	57                   	push   %edi
+  804156:	ff 75 0c             	push   0xc(%ebp)
+  804159:	ff 75 08             	push   0x8(%ebp)
+  80415c:	e8 ae cd ff ff       	call   800f0f <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804161:	83 c4 20             	add    $0x20,%esp
+  804164:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804167:	75 21                	jne    80418a <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804169:	83 ec 04             	sub    $0x4,%esp
+  80416c:	6a ff                	push   $0xffffffff
+  80416e:	53                   	push   %ebx
+  80416f:	ff 75 e4             	push   -0x1c(%ebp)
+  804172:	e8 a5 cf ff ff       	call   80111c <sys_futex_wait>
+  804177:	83 c4 10             	add    $0x10,%esp
+  80417a:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80417d:	74 c7                	je     804146 <ipc_try_send_pages+0x6a>
+  80417f:	85 c0                	test   %eax,%eax
+  804181:	79 c3                	jns    804146 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804183:	e8 77 cb ff ff       	call   800cff <sys_yield>
+  804188:	eb bc                	jmp    804146 <ipc_try_send_pages+0x6a>
+	}
+}
+  80418a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80418d:	5b                   	pop    %ebx
+  80418e:	5e                   	pop    %esi
+  80418f:	5f                   	pop    %edi
+  804190:	5d                   	pop    %ebp
+  804191:	c3                   	ret
+
+00804192 <ipc_send>:
+{
+  804192:	55                   	push   %ebp
+  804193:	89 e5                	mov    %esp,%ebp
+  804195:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804198:	ff 75 14             	push   0x14(%ebp)
+  80419b:	6a 01                	push   $0x1
+  80419d:	ff 75 10             	push   0x10(%ebp)
+  8041a0:	ff 75 0c             	push   0xc(%ebp)
+  8041a3:	ff 75 08             	push   0x8(%ebp)
+  8041a6:	e8 31 ff ff ff       	call   8040dc <ipc_try_send_pages>
+  8041ab:	83 c4 20             	add    $0x20,%esp
+  8041ae:	85 c0                	test   %eax,%eax
+  8041b0:	78 02                	js     8041b4 <ipc_send+0x22>
+}
+  8041b2:	c9                   	leave
+  8041b3:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8041b4:	50                   	push   %eax
+  8041b5:	68 a7 4a 80 00       	push   $0x804aa7
+  8041ba:	6a 3f                	push   $0x3f
+  8041bc:	68 bc 4a 80 00       	push   $0x804abc
+  8041c1:	e8 92 fc ff ff       	call   803e58 <_panic>
+
+008041c6 <ipc_send_pages>:
+{
+  8041c6:	55                   	push   %ebp
+  8041c7:	89 e5                	mov    %esp,%ebp
+  8041c9:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8041cc:	ff 75 18             	push   0x18(%ebp)
+  8041cf:	ff 75 14             	push   0x14(%ebp)
+  8041d2:	ff 75 10             	push   0x10(%ebp)
+  8041d5:	ff 75 0c             	push   0xc(%ebp)
+  8041d8:	ff 75 08             	push   0x8(%ebp)
+  8041db:	e8 fc fe ff ff       	call   8040dc <ipc_try_send_pages>
+  8041e0:	83 c4 20             	add    $0x20,%esp
+  8041e3:	85 c0                	test   %eax,%eax
+  8041e5:	78 02                	js     8041e9 <ipc_send_pages+0x23>
+}
+  8041e7:	c9                   	leave
+  8041e8:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8041e9:	50                   	push   %eax
+  8041ea:	68 c6 4a 80 00       	push   $0x804ac6
+  8041ef:	6a 64                	push   $0x64
+  8041f1:	68 bc 4a 80 00       	push   $0x804abc
+  8041f6:	e8 5d fc ff ff       	call   803e58 <_panic>
+
+008041fb <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8041fb:	55                   	push   %ebp
+  8041fc:	89 e5                	mov    %esp,%ebp
+  8041fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804201:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804206:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80420c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804212:	8b 52 50             	mov    0x50(%edx),%edx
+  804215:	39 ca                	cmp    %ecx,%edx
+  804217:	74 11                	je     80422a <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804219:	83 c0 01             	add    $0x1,%eax
+  80421c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804221:	75 e3                	jne    804206 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804223:	b8 00 00 00 00       	mov    $0x0,%eax
+  804228:	eb 0e                	jmp    804238 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80422a:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804230:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804235:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804238:	5d                   	pop    %ebp
+  804239:	c3                   	ret
+
+0080423a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80423a:	55                   	push   %ebp
+  80423b:	89 e5                	mov    %esp,%ebp
+  80423d:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804240:	89 c2                	mov    %eax,%edx
+  804242:	c1 ea 16             	shr    $0x16,%edx
+  804245:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80424c:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804251:	f6 c1 01             	test   $0x1,%cl
+  804254:	74 1e                	je     804274 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804256:	c1 e8 0c             	shr    $0xc,%eax
+  804259:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804260:	a8 01                	test   $0x1,%al
+  804262:	74 10                	je     804274 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804264:	c1 e8 0c             	shr    $0xc,%eax
+  804267:	c1 e0 04             	shl    $0x4,%eax
+  80426a:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804271:	0f b7 d2             	movzwl %dx,%edx
+}
+  804274:	89 d0                	mov    %edx,%eax
+  804276:	5d                   	pop    %ebp
+  804277:	c3                   	ret
+
+00804278 <__udivdi3>:
+  804278:	57                   	push   %edi
+  804279:	56                   	push   %esi
+  80427a:	53                   	push   %ebx
+  80427b:	83 ec 20             	sub    $0x20,%esp
+  80427e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804282:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804286:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80428a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80428e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804292:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804296:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80429a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80429e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8042a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ad:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8042b4:	00 
+  8042b5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8042bc:	00 
+  8042bd:	eb 08                	jmp    8042c7 <__udivdi3+0x4f>
+  8042bf:	83 e9 01             	sub    $0x1,%ecx
+  8042c2:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8042c5:	74 68                	je     80432f <__udivdi3+0xb7>
+  8042c7:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8042cb:	01 c0                	add    %eax,%eax
+  8042cd:	89 c6                	mov    %eax,%esi
+  8042cf:	89 d7                	mov    %edx,%edi
+  8042d1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8042d5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8042d9:	0f ad d0             	shrd   %cl,%edx,%eax
+  8042dc:	d3 ea                	shr    %cl,%edx
+  8042de:	f6 c1 20             	test   $0x20,%cl
+  8042e1:	74 04                	je     8042e7 <__udivdi3+0x6f>
+  8042e3:	89 d0                	mov    %edx,%eax
+  8042e5:	31 d2                	xor    %edx,%edx
+  8042e7:	83 e0 01             	and    $0x1,%eax
+  8042ea:	89 04 24             	mov    %eax,(%esp)
+  8042ed:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8042f4:	00 
+  8042f5:	8b 04 24             	mov    (%esp),%eax
+  8042f8:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8042fc:	09 f0                	or     %esi,%eax
+  8042fe:	09 fa                	or     %edi,%edx
+  804300:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804304:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804308:	39 f0                	cmp    %esi,%eax
+  80430a:	89 d3                	mov    %edx,%ebx
+  80430c:	19 fb                	sbb    %edi,%ebx
+  80430e:	72 af                	jb     8042bf <__udivdi3+0x47>
+  804310:	29 f0                	sub    %esi,%eax
+  804312:	19 fa                	sbb    %edi,%edx
+  804314:	89 cf                	mov    %ecx,%edi
+  804316:	c1 ef 05             	shr    $0x5,%edi
+  804319:	83 e7 01             	and    $0x1,%edi
+  80431c:	89 fe                	mov    %edi,%esi
+  80431e:	83 f6 01             	xor    $0x1,%esi
+  804321:	d3 e6                	shl    %cl,%esi
+  804323:	d3 e7                	shl    %cl,%edi
+  804325:	09 74 24 18          	or     %esi,0x18(%esp)
+  804329:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80432d:	eb 90                	jmp    8042bf <__udivdi3+0x47>
+  80432f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804333:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804337:	83 c4 20             	add    $0x20,%esp
+  80433a:	5b                   	pop    %ebx
+  80433b:	5e                   	pop    %esi
+  80433c:	5f                   	pop    %edi
+  80433d:	c3                   	ret
+
+0080433e <__umoddi3>:
+  80433e:	57                   	push   %edi
+  80433f:	56                   	push   %esi
+  804340:	53                   	push   %ebx
+  804341:	83 ec 08             	sub    $0x8,%esp
+  804344:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804348:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80434c:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804350:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804354:	57                   	push   %edi
+  804355:	56                   	push   %esi
+  804356:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80435a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80435e:	52                   	push   %edx
+  80435f:	50                   	push   %eax
+  804360:	e8 13 ff ff ff       	call   804278 <__udivdi3>
+  804365:	89 c3                	mov    %eax,%ebx
+  804367:	0f af d6             	imul   %esi,%edx
+  80436a:	89 f9                	mov    %edi,%ecx
+  80436c:	0f af cb             	imul   %ebx,%ecx
+  80436f:	01 d1                	add    %edx,%ecx
+  804371:	89 d8                	mov    %ebx,%eax
+  804373:	f7 e6                	mul    %esi
+  804375:	89 c6                	mov    %eax,%esi
+  804377:	89 d7                	mov    %edx,%edi
+  804379:	01 cf                	add    %ecx,%edi
+  80437b:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80437f:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804383:	29 f0                	sub    %esi,%eax
+  804385:	19 fa                	sbb    %edi,%edx
+  804387:	83 c4 18             	add    $0x18,%esp
+  80438a:	5b                   	pop    %ebx
+  80438b:	5e                   	pop    %esi
+  80438c:	5f                   	pop    %edi
+  80438d:	c3                   	ret
+
+0080438e <__divdi3>:
+  80438e:	53                   	push   %ebx
+  80438f:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804393:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804397:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80439b:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  80439f:	85 d2                	test   %edx,%edx
+  8043a1:	78 12                	js     8043b5 <__divdi3+0x27>
+  8043a3:	85 db                	test   %ebx,%ebx
+  8043a5:	78 2e                	js     8043d5 <__divdi3+0x47>
+  8043a7:	53                   	push   %ebx
+  8043a8:	51                   	push   %ecx
+  8043a9:	52                   	push   %edx
+  8043aa:	50                   	push   %eax
+  8043ab:	e8 c8 fe ff ff       	call   804278 <__udivdi3>
+  8043b0:	83 c4 10             	add    $0x10,%esp
+  8043b3:	eb 1e                	jmp    8043d3 <__divdi3+0x45>
+  8043b5:	f7 d8                	neg    %eax
+  8043b7:	83 d2 00             	adc    $0x0,%edx
+  8043ba:	f7 da                	neg    %edx
+  8043bc:	85 db                	test   %ebx,%ebx
+  8043be:	78 2a                	js     8043ea <__divdi3+0x5c>
+  8043c0:	53                   	push   %ebx
+  8043c1:	51                   	push   %ecx
+  8043c2:	52                   	push   %edx
+  8043c3:	50                   	push   %eax
+  8043c4:	e8 af fe ff ff       	call   804278 <__udivdi3>
+  8043c9:	83 c4 10             	add    $0x10,%esp
+  8043cc:	f7 d8                	neg    %eax
+  8043ce:	83 d2 00             	adc    $0x0,%edx
+  8043d1:	f7 da                	neg    %edx
+  8043d3:	5b                   	pop    %ebx
+  8043d4:	c3                   	ret
+  8043d5:	f7 d9                	neg    %ecx
+  8043d7:	83 d3 00             	adc    $0x0,%ebx
+  8043da:	f7 db                	neg    %ebx
+  8043dc:	53                   	push   %ebx
+  8043dd:	51                   	push   %ecx
+  8043de:	52                   	push   %edx
+  8043df:	50                   	push   %eax
+  8043e0:	e8 93 fe ff ff       	call   804278 <__udivdi3>
+  8043e5:	83 c4 10             	add    $0x10,%esp
+  8043e8:	eb e2                	jmp    8043cc <__divdi3+0x3e>
+  8043ea:	f7 d9                	neg    %ecx
+  8043ec:	83 d3 00             	adc    $0x0,%ebx
+  8043ef:	f7 db                	neg    %ebx
+  8043f1:	53                   	push   %ebx
+  8043f2:	51                   	push   %ecx
+  8043f3:	52                   	push   %edx
+  8043f4:	50                   	push   %eax
+  8043f5:	e8 7e fe ff ff       	call   804278 <__udivdi3>
+  8043fa:	83 c4 10             	add    $0x10,%esp
+  8043fd:	eb d4                	jmp    8043d3 <__divdi3+0x45>
+
+008043ff <__moddi3>:
+  8043ff:	57                   	push   %edi
+  804400:	56                   	push   %esi
+  804401:	53                   	push   %ebx
+  804402:	83 ec 08             	sub    $0x8,%esp
+  804405:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804409:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80440d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804411:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804415:	57                   	push   %edi
+  804416:	56                   	push   %esi
+  804417:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80441b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80441f:	52                   	push   %edx
+  804420:	50                   	push   %eax
+  804421:	e8 68 ff ff ff       	call   80438e <__divdi3>
+  804426:	89 c3                	mov    %eax,%ebx
+  804428:	0f af d6             	imul   %esi,%edx
+  80442b:	89 f9                	mov    %edi,%ecx
+  80442d:	0f af cb             	imul   %ebx,%ecx
+  804430:	01 d1                	add    %edx,%ecx
+  804432:	89 d8                	mov    %ebx,%eax
+  804434:	f7 e6                	mul    %esi
+  804436:	89 c6                	mov    %eax,%esi
+  804438:	89 d7                	mov    %edx,%edi
+  80443a:	01 cf                	add    %ecx,%edi
+  80443c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804440:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804444:	29 f0                	sub    %esi,%eax
+  804446:	19 fa                	sbb    %edi,%edx
+  804448:	83 c4 18             	add    $0x18,%esp
+  80444b:	5b                   	pop    %ebx
+  80444c:	5e                   	pop    %esi
+  80444d:	5f                   	pop    %edi
+  80444e:	c3                   	ret
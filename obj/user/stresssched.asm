@@ -0,0 +1,9072 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 07 01 00 00       	call   800138 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+	int i, j;
+	int seen;
+	envid_t parent = sys_getenvid();
+  80003a:	e8 68 0d 00 00       	call   800da7 <sys_getenvid>
+  80003f:	89 c6                	mov    %eax,%esi
+
+	// Fork several environments
+	for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (fork() == 0)
+  800046:	e8 a2 13 00 00       	call   8013ed <fork>
+  80004b:	85 c0                	test   %eax,%eax
+  80004d:	74 12                	je     800061 <umain+0x2c>
+	for (i = 0; i < 20; i++)
+  80004f:	83 c3 01             	add    $0x1,%ebx
+  800052:	83 fb 14             	cmp    $0x14,%ebx
+  800055:	75 ef                	jne    800046 <umain+0x11>
+			break;
+	if (i == 20) {
+		sys_yield();
+  800057:	e8 6a 0d 00 00       	call   800dc6 <sys_yield>
+		return;
+  80005c:	e9 b9 00 00 00       	jmp    80011a <umain+0xe5>
+	if (i == 20) {
+  800061:	83 fb 14             	cmp    $0x14,%ebx
+  800064:	74 f1                	je     800057 <umain+0x22>
+	}
+
+	// Wait for the parent to finish forking
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800066:	89 f0                	mov    %esi,%eax
+  800068:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006d:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  800073:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800079:	8b 52 54             	mov    0x54(%edx),%edx
+  80007c:	85 d2                	test   %edx,%edx
+  80007e:	74 14                	je     800094 <umain+0x5f>
+  800080:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800086:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+		asm volatile("pause");
+  80008b:	f3 90                	pause
+	while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80008d:	8b 50 54             	mov    0x54(%eax),%edx
+  800090:	85 d2                	test   %edx,%edx
+  800092:	75 f7                	jne    80008b <umain+0x56>
+	for (i = 0; i < 20; i++)
+  800094:	bb 0a 00 00 00       	mov    $0xa,%ebx
+
+	// Check that one environment doesn't run on two CPUs at once
+	for (i = 0; i < 10; i++) {
+		sys_yield();
+  800099:	e8 28 0d 00 00       	call   800dc6 <sys_yield>
+  80009e:	ba 10 27 00 00       	mov    $0x2710,%edx
+		for (j = 0; j < 10000; j++)
+			counter++;
+  8000a3:	a1 f8 69 80 00       	mov    0x8069f8,%eax
+  8000a8:	83 c0 01             	add    $0x1,%eax
+  8000ab:	a3 f8 69 80 00       	mov    %eax,0x8069f8
+		for (j = 0; j < 10000; j++)
+  8000b0:	83 ea 01             	sub    $0x1,%edx
+  8000b3:	75 ee                	jne    8000a3 <umain+0x6e>
+	for (i = 0; i < 10; i++) {
+  8000b5:	83 eb 01             	sub    $0x1,%ebx
+  8000b8:	75 df                	jne    800099 <umain+0x64>
+	}
+
+	if (counter != 10*10000)
+  8000ba:	a1 f8 69 80 00       	mov    0x8069f8,%eax
+  8000bf:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000c4:	75 5b                	jne    800121 <umain+0xec>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000c6:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000c8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000cd:	29 d0                	sub    %edx,%eax
+  8000cf:	89 c2                	mov    %eax,%edx
+  8000d1:	c1 ea 0f             	shr    $0xf,%edx
+  8000d4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000d9:	89 d0                	mov    %edx,%eax
+  8000db:	0f 43 c3             	cmovae %ebx,%eax
+		panic("ran on two CPUs at once (counter is %d)", counter);
+
+	// Check that we see environments running on different CPUs
+	cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000de:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8000e5:	8b 50 68             	mov    0x68(%eax),%edx
+  8000e8:	89 e1                	mov    %esp,%ecx
+  8000ea:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000ef:	29 c8                	sub    %ecx,%eax
+  8000f1:	89 c1                	mov    %eax,%ecx
+  8000f3:	c1 e9 0f             	shr    $0xf,%ecx
+  8000f6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000fb:	0f 42 d9             	cmovb  %ecx,%ebx
+  8000fe:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  800105:	8b 40 48             	mov    0x48(%eax),%eax
+  800108:	83 ec 04             	sub    $0x4,%esp
+  80010b:	52                   	push   %edx
+  80010c:	50                   	push   %eax
+  80010d:	68 1b 45 80 00       	push   $0x80451b
+  800112:	e8 a3 01 00 00       	call   8002ba <cprintf>
+  800117:	83 c4 10             	add    $0x10,%esp
+
+}
+  80011a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011d:	5b                   	pop    %ebx
+  80011e:	5e                   	pop    %esi
+  80011f:	5d                   	pop    %ebp
+  800120:	c3                   	ret
+		panic("ran on two CPUs at once (counter is %d)", counter);
+  800121:	a1 f8 69 80 00       	mov    0x8069f8,%eax
+  800126:	50                   	push   %eax
+  800127:	68 e0 44 80 00       	push   $0x8044e0
+  80012c:	6a 21                	push   $0x21
+  80012e:	68 08 45 80 00       	push   $0x804508
+  800133:	e8 a7 00 00 00       	call   8001df <_panic>
+
+00800138 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800138:	55                   	push   %ebp
+  800139:	89 e5                	mov    %esp,%ebp
+  80013b:	56                   	push   %esi
+  80013c:	53                   	push   %ebx
+  80013d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800140:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800143:	89 e2                	mov    %esp,%edx
+  800145:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80014a:	29 d0                	sub    %edx,%eax
+  80014c:	89 c2                	mov    %eax,%edx
+  80014e:	c1 ea 0f             	shr    $0xf,%edx
+  800151:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80015e:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800165:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800169:	e8 39 0c 00 00       	call   800da7 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80016e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800173:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800179:	89 e1                	mov    %esp,%ecx
+  80017b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800180:	29 ca                	sub    %ecx,%edx
+  800182:	89 d1                	mov    %edx,%ecx
+  800184:	c1 e9 0f             	shr    $0xf,%ecx
+  800187:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80018d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800192:	0f 42 d1             	cmovb  %ecx,%edx
+  800195:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80019a:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001a1:	85 db                	test   %ebx,%ebx
+  8001a3:	7e 07                	jle    8001ac <libmain+0x74>
+		binaryname = argv[0];
+  8001a5:	8b 06                	mov    (%esi),%eax
+  8001a7:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8001ac:	83 ec 08             	sub    $0x8,%esp
+  8001af:	56                   	push   %esi
+  8001b0:	53                   	push   %ebx
+  8001b1:	e8 7f fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8001b6:	e8 0a 00 00 00       	call   8001c5 <exit>
+}
+  8001bb:	83 c4 10             	add    $0x10,%esp
+  8001be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001c1:	5b                   	pop    %ebx
+  8001c2:	5e                   	pop    %esi
+  8001c3:	5d                   	pop    %ebp
+  8001c4:	c3                   	ret
+
+008001c5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001c5:	55                   	push   %ebp
+  8001c6:	89 e5                	mov    %esp,%ebp
+  8001c8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001cb:	e8 dd 19 00 00       	call   801bad <close_all>
+	sys_env_destroy(0);
+  8001d0:	83 ec 0c             	sub    $0xc,%esp
+  8001d3:	6a 00                	push   $0x0
+  8001d5:	e8 8c 0b 00 00       	call   800d66 <sys_env_destroy>
+}
+  8001da:	83 c4 10             	add    $0x10,%esp
+  8001dd:	c9                   	leave
+  8001de:	c3                   	ret
+
+008001df <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001df:	55                   	push   %ebp
+  8001e0:	89 e5                	mov    %esp,%ebp
+  8001e2:	56                   	push   %esi
+  8001e3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001e4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001e7:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001ed:	e8 b5 0b 00 00       	call   800da7 <sys_getenvid>
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	ff 75 0c             	push   0xc(%ebp)
+  8001f8:	ff 75 08             	push   0x8(%ebp)
+  8001fb:	56                   	push   %esi
+  8001fc:	50                   	push   %eax
+  8001fd:	68 44 45 80 00       	push   $0x804544
+  800202:	e8 b3 00 00 00       	call   8002ba <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800207:	83 c4 18             	add    $0x18,%esp
+  80020a:	53                   	push   %ebx
+  80020b:	ff 75 10             	push   0x10(%ebp)
+  80020e:	e8 56 00 00 00       	call   800269 <vcprintf>
+	cprintf("\n");
+  800213:	c7 04 24 37 45 80 00 	movl   $0x804537,(%esp)
+  80021a:	e8 9b 00 00 00       	call   8002ba <cprintf>
+  80021f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800222:	cc                   	int3
+	while (1)
+  800223:	eb fd                	jmp    800222 <_panic+0x43>
+
+00800225 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800225:	55                   	push   %ebp
+  800226:	89 e5                	mov    %esp,%ebp
+  800228:	53                   	push   %ebx
+  800229:	83 ec 04             	sub    $0x4,%esp
+  80022c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80022f:	8b 13                	mov    (%ebx),%edx
+  800231:	8d 42 01             	lea    0x1(%edx),%eax
+  800234:	89 03                	mov    %eax,(%ebx)
+  800236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800239:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80023d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800242:	74 09                	je     80024d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800244:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80024d:	83 ec 08             	sub    $0x8,%esp
+  800250:	68 ff 00 00 00       	push   $0xff
+  800255:	8d 43 08             	lea    0x8(%ebx),%eax
+  800258:	50                   	push   %eax
+  800259:	e8 cb 0a 00 00       	call   800d29 <sys_cputs>
+		b->idx = 0;
+  80025e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800264:	83 c4 10             	add    $0x10,%esp
+  800267:	eb db                	jmp    800244 <putch+0x1f>
+
+00800269 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800272:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800279:	00 00 00 
+	b.cnt = 0;
+  80027c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800283:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800286:	ff 75 0c             	push   0xc(%ebp)
+  800289:	ff 75 08             	push   0x8(%ebp)
+  80028c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800292:	50                   	push   %eax
+  800293:	68 25 02 80 00       	push   $0x800225
+  800298:	e8 1c 01 00 00       	call   8003b9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80029d:	83 c4 08             	add    $0x8,%esp
+  8002a0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002a6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002ac:	50                   	push   %eax
+  8002ad:	e8 77 0a 00 00       	call   800d29 <sys_cputs>
+
+	return b.cnt;
+}
+  8002b2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+008002ba <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002c0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002c3:	50                   	push   %eax
+  8002c4:	ff 75 08             	push   0x8(%ebp)
+  8002c7:	e8 9d ff ff ff       	call   800269 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002cc:	c9                   	leave
+  8002cd:	c3                   	ret
+
+008002ce <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ce:	55                   	push   %ebp
+  8002cf:	89 e5                	mov    %esp,%ebp
+  8002d1:	57                   	push   %edi
+  8002d2:	56                   	push   %esi
+  8002d3:	53                   	push   %ebx
+  8002d4:	83 ec 1c             	sub    $0x1c,%esp
+  8002d7:	89 c3                	mov    %eax,%ebx
+  8002d9:	89 d6                	mov    %edx,%esi
+  8002db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002e1:	89 d1                	mov    %edx,%ecx
+  8002e3:	89 c2                	mov    %eax,%edx
+  8002e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002e8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002eb:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002f1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002f8:	39 c2                	cmp    %eax,%edx
+  8002fa:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002fd:	73 4b                	jae    80034a <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800302:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800305:	85 ff                	test   %edi,%edi
+  800307:	7e 11                	jle    80031a <printnum+0x4c>
+			putch(padc, putdat);
+  800309:	83 ec 08             	sub    $0x8,%esp
+  80030c:	56                   	push   %esi
+  80030d:	ff 75 18             	push   0x18(%ebp)
+  800310:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800312:	83 c4 10             	add    $0x10,%esp
+  800315:	83 ef 01             	sub    $0x1,%edi
+  800318:	75 ef                	jne    800309 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80031a:	83 ec 08             	sub    $0x8,%esp
+  80031d:	56                   	push   %esi
+  80031e:	83 ec 04             	sub    $0x4,%esp
+  800321:	ff 75 e4             	push   -0x1c(%ebp)
+  800324:	ff 75 e0             	push   -0x20(%ebp)
+  800327:	ff 75 dc             	push   -0x24(%ebp)
+  80032a:	ff 75 d8             	push   -0x28(%ebp)
+  80032d:	e8 8d 40 00 00       	call   8043bf <__umoddi3>
+  800332:	83 c4 14             	add    $0x14,%esp
+  800335:	0f be 80 67 45 80 00 	movsbl 0x804567(%eax),%eax
+  80033c:	50                   	push   %eax
+  80033d:	ff d3                	call   *%ebx
+}
+  80033f:	83 c4 10             	add    $0x10,%esp
+  800342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800345:	5b                   	pop    %ebx
+  800346:	5e                   	pop    %esi
+  800347:	5f                   	pop    %edi
+  800348:	5d                   	pop    %ebp
+  800349:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80034a:	83 ec 0c             	sub    $0xc,%esp
+  80034d:	ff 75 18             	push   0x18(%ebp)
+  800350:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800353:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800356:	52                   	push   %edx
+  800357:	50                   	push   %eax
+  800358:	83 ec 08             	sub    $0x8,%esp
+  80035b:	ff 75 e4             	push   -0x1c(%ebp)
+  80035e:	ff 75 e0             	push   -0x20(%ebp)
+  800361:	ff 75 dc             	push   -0x24(%ebp)
+  800364:	ff 75 d8             	push   -0x28(%ebp)
+  800367:	e8 8d 3f 00 00       	call   8042f9 <__udivdi3>
+  80036c:	83 c4 18             	add    $0x18,%esp
+  80036f:	52                   	push   %edx
+  800370:	50                   	push   %eax
+  800371:	89 f2                	mov    %esi,%edx
+  800373:	89 d8                	mov    %ebx,%eax
+  800375:	e8 54 ff ff ff       	call   8002ce <printnum>
+  80037a:	83 c4 20             	add    $0x20,%esp
+  80037d:	eb 9b                	jmp    80031a <printnum+0x4c>
+
+0080037f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800385:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800389:	8b 10                	mov    (%eax),%edx
+  80038b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80038e:	73 0a                	jae    80039a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800390:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800393:	89 08                	mov    %ecx,(%eax)
+  800395:	8b 45 08             	mov    0x8(%ebp),%eax
+  800398:	88 02                	mov    %al,(%edx)
+}
+  80039a:	5d                   	pop    %ebp
+  80039b:	c3                   	ret
+
+0080039c <printfmt>:
+{
+  80039c:	55                   	push   %ebp
+  80039d:	89 e5                	mov    %esp,%ebp
+  80039f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003a2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003a5:	50                   	push   %eax
+  8003a6:	ff 75 10             	push   0x10(%ebp)
+  8003a9:	ff 75 0c             	push   0xc(%ebp)
+  8003ac:	ff 75 08             	push   0x8(%ebp)
+  8003af:	e8 05 00 00 00       	call   8003b9 <vprintfmt>
+}
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	c9                   	leave
+  8003b8:	c3                   	ret
+
+008003b9 <vprintfmt>:
+{
+  8003b9:	55                   	push   %ebp
+  8003ba:	89 e5                	mov    %esp,%ebp
+  8003bc:	57                   	push   %edi
+  8003bd:	56                   	push   %esi
+  8003be:	53                   	push   %ebx
+  8003bf:	83 ec 2c             	sub    $0x2c,%esp
+  8003c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003c5:	89 df                	mov    %ebx,%edi
+  8003c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cd:	8d 70 01             	lea    0x1(%eax),%esi
+  8003d0:	0f b6 00             	movzbl (%eax),%eax
+  8003d3:	83 f8 25             	cmp    $0x25,%eax
+  8003d6:	74 1e                	je     8003f6 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8003d8:	85 c0                	test   %eax,%eax
+  8003da:	0f 84 15 05 00 00    	je     8008f5 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+  8003e3:	53                   	push   %ebx
+  8003e4:	50                   	push   %eax
+  8003e5:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e7:	83 c6 01             	add    $0x1,%esi
+  8003ea:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	83 f8 25             	cmp    $0x25,%eax
+  8003f4:	75 e2                	jne    8003d8 <vprintfmt+0x1f>
+		padc = ' ';
+  8003f6:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800401:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800408:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80040f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800414:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800417:	8d 56 01             	lea    0x1(%esi),%edx
+  80041a:	0f b6 0e             	movzbl (%esi),%ecx
+  80041d:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800420:	3c 55                	cmp    $0x55,%al
+  800422:	0f 87 3b 04 00 00    	ja     800863 <vprintfmt+0x4aa>
+  800428:	0f b6 c0             	movzbl %al,%eax
+  80042b:	ff 24 85 e0 46 80 00 	jmp    *0x8046e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800432:	89 75 10             	mov    %esi,0x10(%ebp)
+  800435:	eb 93                	jmp    8003ca <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800437:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800439:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80043d:	eb d8                	jmp    800417 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043f:	89 d6                	mov    %edx,%esi
+  800441:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800445:	eb d0                	jmp    800417 <vprintfmt+0x5e>
+  800447:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80044a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80044d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800450:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800454:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800457:	83 f9 09             	cmp    $0x9,%ecx
+  80045a:	77 6f                	ja     8004cb <vprintfmt+0x112>
+  80045c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80045f:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800462:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800465:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800469:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80046c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80046f:	83 fe 09             	cmp    $0x9,%esi
+  800472:	76 eb                	jbe    80045f <vprintfmt+0xa6>
+  800474:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800477:	89 d6                	mov    %edx,%esi
+  800479:	eb 13                	jmp    80048e <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80047b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047e:	8b 00                	mov    (%eax),%eax
+  800480:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800483:	8b 45 14             	mov    0x14(%ebp),%eax
+  800486:	8d 40 04             	lea    0x4(%eax),%eax
+  800489:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048c:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80048e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800492:	79 83                	jns    800417 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800494:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800497:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80049a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004a1:	e9 71 ff ff ff       	jmp    800417 <vprintfmt+0x5e>
+			if (width < 0)
+  8004a6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004a9:	85 c9                	test   %ecx,%ecx
+  8004ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b0:	0f 49 c1             	cmovns %ecx,%eax
+  8004b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b6:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004b8:	e9 5a ff ff ff       	jmp    800417 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004bd:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8004bf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c6:	e9 4c ff ff ff       	jmp    800417 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cb:	89 d6                	mov    %edx,%esi
+  8004cd:	eb bf                	jmp    80048e <vprintfmt+0xd5>
+			lflag++;
+  8004cf:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d3:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8004d5:	e9 3d ff ff ff       	jmp    800417 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8004da:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e0:	8d 70 04             	lea    0x4(%eax),%esi
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	53                   	push   %ebx
+  8004e7:	ff 30                	push   (%eax)
+  8004e9:	ff d7                	call   *%edi
+			break;
+  8004eb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ee:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004f1:	e9 d4 fe ff ff       	jmp    8003ca <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004f6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fc:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004ff:	8b 10                	mov    (%eax),%edx
+  800501:	89 d0                	mov    %edx,%eax
+  800503:	f7 d8                	neg    %eax
+  800505:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800508:	83 f8 12             	cmp    $0x12,%eax
+  80050b:	7f 23                	jg     800530 <vprintfmt+0x177>
+  80050d:	8b 14 85 40 48 80 00 	mov    0x804840(,%eax,4),%edx
+  800514:	85 d2                	test   %edx,%edx
+  800516:	74 18                	je     800530 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800518:	52                   	push   %edx
+  800519:	68 93 4a 80 00       	push   $0x804a93
+  80051e:	53                   	push   %ebx
+  80051f:	57                   	push   %edi
+  800520:	e8 77 fe ff ff       	call   80039c <printfmt>
+  800525:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800528:	89 75 14             	mov    %esi,0x14(%ebp)
+  80052b:	e9 9a fe ff ff       	jmp    8003ca <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800530:	50                   	push   %eax
+  800531:	68 7f 45 80 00       	push   $0x80457f
+  800536:	53                   	push   %ebx
+  800537:	57                   	push   %edi
+  800538:	e8 5f fe ff ff       	call   80039c <printfmt>
+  80053d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800540:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800543:	e9 82 fe ff ff       	jmp    8003ca <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800548:	89 55 10             	mov    %edx,0x10(%ebp)
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	83 c0 04             	add    $0x4,%eax
+  800551:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8b 00                	mov    (%eax),%eax
+  800559:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80055c:	85 c0                	test   %eax,%eax
+  80055e:	0f 84 61 03 00 00    	je     8008c5 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800564:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800568:	7e 06                	jle    800570 <vprintfmt+0x1b7>
+  80056a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80056e:	75 29                	jne    800599 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800570:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800573:	8d 70 01             	lea    0x1(%eax),%esi
+  800576:	0f b6 00             	movzbl (%eax),%eax
+  800579:	0f be d0             	movsbl %al,%edx
+  80057c:	85 d2                	test   %edx,%edx
+  80057e:	0f 84 bb 00 00 00    	je     80063f <vprintfmt+0x286>
+  800584:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800587:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80058a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80058d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800590:	eb 7a                	jmp    80060c <vprintfmt+0x253>
+				p = "(null)";
+  800592:	c7 45 d0 78 45 80 00 	movl   $0x804578,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800599:	83 ec 08             	sub    $0x8,%esp
+  80059c:	ff 75 d4             	push   -0x2c(%ebp)
+  80059f:	ff 75 d0             	push   -0x30(%ebp)
+  8005a2:	e8 e0 03 00 00       	call   800987 <strnlen>
+  8005a7:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8005aa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8005ad:	83 c4 10             	add    $0x10,%esp
+  8005b0:	85 d2                	test   %edx,%edx
+  8005b2:	0f 8e d6 02 00 00    	jle    80088e <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8005b8:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8005bc:	83 ec 08             	sub    $0x8,%esp
+  8005bf:	53                   	push   %ebx
+  8005c0:	56                   	push   %esi
+  8005c1:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005c3:	83 c4 10             	add    $0x10,%esp
+  8005c6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8005ca:	75 f0                	jne    8005bc <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cf:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d2:	0f b6 00             	movzbl (%eax),%eax
+  8005d5:	0f be d0             	movsbl %al,%edx
+  8005d8:	85 d2                	test   %edx,%edx
+  8005da:	0f 84 da 02 00 00    	je     8008ba <vprintfmt+0x501>
+  8005e0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005e6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005e9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ec:	eb 1e                	jmp    80060c <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	ff 75 0c             	push   0xc(%ebp)
+  8005f4:	52                   	push   %edx
+  8005f5:	ff 55 08             	call   *0x8(%ebp)
+  8005f8:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005fb:	83 eb 01             	sub    $0x1,%ebx
+  8005fe:	83 c6 01             	add    $0x1,%esi
+  800601:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800605:	0f be d0             	movsbl %al,%edx
+  800608:	85 d2                	test   %edx,%edx
+  80060a:	74 2a                	je     800636 <vprintfmt+0x27d>
+  80060c:	85 ff                	test   %edi,%edi
+  80060e:	78 05                	js     800615 <vprintfmt+0x25c>
+  800610:	83 ef 01             	sub    $0x1,%edi
+  800613:	78 59                	js     80066e <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800615:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800619:	74 d3                	je     8005ee <vprintfmt+0x235>
+  80061b:	0f be c0             	movsbl %al,%eax
+  80061e:	83 e8 20             	sub    $0x20,%eax
+  800621:	83 f8 5e             	cmp    $0x5e,%eax
+  800624:	76 c8                	jbe    8005ee <vprintfmt+0x235>
+					putch('?', putdat);
+  800626:	83 ec 08             	sub    $0x8,%esp
+  800629:	ff 75 0c             	push   0xc(%ebp)
+  80062c:	6a 3f                	push   $0x3f
+  80062e:	ff 55 08             	call   *0x8(%ebp)
+  800631:	83 c4 10             	add    $0x10,%esp
+  800634:	eb c5                	jmp    8005fb <vprintfmt+0x242>
+  800636:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800639:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80063c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80063f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800642:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800646:	7e 1b                	jle    800663 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	6a 20                	push   $0x20
+  80064e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800650:	83 c4 10             	add    $0x10,%esp
+  800653:	83 ee 01             	sub    $0x1,%esi
+  800656:	75 f0                	jne    800648 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800658:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80065b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065e:	e9 67 fd ff ff       	jmp    8003ca <vprintfmt+0x11>
+  800663:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+  800669:	e9 5c fd ff ff       	jmp    8003ca <vprintfmt+0x11>
+  80066e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800671:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800674:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800677:	eb c6                	jmp    80063f <vprintfmt+0x286>
+	if (lflag >= 2)
+  800679:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80067c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067f:	83 f9 01             	cmp    $0x1,%ecx
+  800682:	7f 1f                	jg     8006a3 <vprintfmt+0x2ea>
+	else if (lflag)
+  800684:	85 c9                	test   %ecx,%ecx
+  800686:	74 67                	je     8006ef <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 30                	mov    (%eax),%esi
+  80068d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800690:	89 f0                	mov    %esi,%eax
+  800692:	c1 f8 1f             	sar    $0x1f,%eax
+  800695:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8d 40 04             	lea    0x4(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006a1:	eb 17                	jmp    8006ba <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a9:	8b 00                	mov    (%eax),%eax
+  8006ab:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ae:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006ba:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006bd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006c0:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8006c5:	85 c9                	test   %ecx,%ecx
+  8006c7:	0f 89 12 01 00 00    	jns    8007df <vprintfmt+0x426>
+				putch('-', putdat);
+  8006cd:	83 ec 08             	sub    $0x8,%esp
+  8006d0:	53                   	push   %ebx
+  8006d1:	6a 2d                	push   $0x2d
+  8006d3:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8006d5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006db:	f7 da                	neg    %edx
+  8006dd:	83 d1 00             	adc    $0x0,%ecx
+  8006e0:	f7 d9                	neg    %ecx
+  8006e2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006e5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006ea:	e9 f0 00 00 00       	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 30                	mov    (%eax),%esi
+  8006f4:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006f7:	89 f0                	mov    %esi,%eax
+  8006f9:	c1 f8 1f             	sar    $0x1f,%eax
+  8006fc:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800702:	8d 40 04             	lea    0x4(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+  800708:	eb b0                	jmp    8006ba <vprintfmt+0x301>
+	if (lflag >= 2)
+  80070a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800710:	83 f9 01             	cmp    $0x1,%ecx
+  800713:	7f 1e                	jg     800733 <vprintfmt+0x37a>
+	else if (lflag)
+  800715:	85 c9                	test   %ecx,%ecx
+  800717:	74 32                	je     80074b <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800723:	8d 40 04             	lea    0x4(%eax),%eax
+  800726:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800729:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80072e:	e9 ac 00 00 00       	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800733:	8b 45 14             	mov    0x14(%ebp),%eax
+  800736:	8b 10                	mov    (%eax),%edx
+  800738:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073b:	8d 40 08             	lea    0x8(%eax),%eax
+  80073e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800741:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800746:	e9 94 00 00 00       	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80074b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074e:	8b 10                	mov    (%eax),%edx
+  800750:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800755:	8d 40 04             	lea    0x4(%eax),%eax
+  800758:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80075b:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800760:	eb 7d                	jmp    8007df <vprintfmt+0x426>
+	if (lflag >= 2)
+  800762:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800765:	89 55 10             	mov    %edx,0x10(%ebp)
+  800768:	83 f9 01             	cmp    $0x1,%ecx
+  80076b:	7f 1b                	jg     800788 <vprintfmt+0x3cf>
+	else if (lflag)
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	74 2c                	je     80079d <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077b:	8d 40 04             	lea    0x4(%eax),%eax
+  80077e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800781:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800786:	eb 57                	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800788:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078b:	8b 10                	mov    (%eax),%edx
+  80078d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800790:	8d 40 08             	lea    0x8(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800796:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80079b:	eb 42                	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80079d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a0:	8b 10                	mov    (%eax),%edx
+  8007a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007ad:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8007b2:	eb 2b                	jmp    8007df <vprintfmt+0x426>
+			putch('0', putdat);
+  8007b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007b7:	83 ec 08             	sub    $0x8,%esp
+  8007ba:	53                   	push   %ebx
+  8007bb:	6a 30                	push   $0x30
+  8007bd:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8007bf:	83 c4 08             	add    $0x8,%esp
+  8007c2:	53                   	push   %ebx
+  8007c3:	6a 78                	push   $0x78
+  8007c5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 10                	mov    (%eax),%edx
+  8007cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007d1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007da:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8007df:	83 ec 0c             	sub    $0xc,%esp
+  8007e2:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007e6:	50                   	push   %eax
+  8007e7:	ff 75 e4             	push   -0x1c(%ebp)
+  8007ea:	56                   	push   %esi
+  8007eb:	51                   	push   %ecx
+  8007ec:	52                   	push   %edx
+  8007ed:	89 da                	mov    %ebx,%edx
+  8007ef:	89 f8                	mov    %edi,%eax
+  8007f1:	e8 d8 fa ff ff       	call   8002ce <printnum>
+			break;
+  8007f6:	83 c4 20             	add    $0x20,%esp
+  8007f9:	e9 cc fb ff ff       	jmp    8003ca <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007fe:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800801:	89 55 10             	mov    %edx,0x10(%ebp)
+  800804:	83 f9 01             	cmp    $0x1,%ecx
+  800807:	7f 1b                	jg     800824 <vprintfmt+0x46b>
+	else if (lflag)
+  800809:	85 c9                	test   %ecx,%ecx
+  80080b:	74 2c                	je     800839 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80080d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800810:	8b 10                	mov    (%eax),%edx
+  800812:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800817:	8d 40 04             	lea    0x4(%eax),%eax
+  80081a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800822:	eb bb                	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082c:	8d 40 08             	lea    0x8(%eax),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800832:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800837:	eb a6                	jmp    8007df <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 10                	mov    (%eax),%edx
+  80083e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800843:	8d 40 04             	lea    0x4(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800849:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80084e:	eb 8f                	jmp    8007df <vprintfmt+0x426>
+			putch(ch, putdat);
+  800850:	89 55 10             	mov    %edx,0x10(%ebp)
+  800853:	83 ec 08             	sub    $0x8,%esp
+  800856:	53                   	push   %ebx
+  800857:	6a 25                	push   $0x25
+  800859:	ff d7                	call   *%edi
+			break;
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	e9 67 fb ff ff       	jmp    8003ca <vprintfmt+0x11>
+			putch('%', putdat);
+  800863:	83 ec 08             	sub    $0x8,%esp
+  800866:	53                   	push   %ebx
+  800867:	6a 25                	push   $0x25
+  800869:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80086b:	83 c4 10             	add    $0x10,%esp
+  80086e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800872:	0f 84 ba fb ff ff    	je     800432 <vprintfmt+0x79>
+  800878:	89 75 10             	mov    %esi,0x10(%ebp)
+  80087b:	89 f0                	mov    %esi,%eax
+  80087d:	83 e8 01             	sub    $0x1,%eax
+  800880:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800884:	75 f7                	jne    80087d <vprintfmt+0x4c4>
+  800886:	89 45 10             	mov    %eax,0x10(%ebp)
+  800889:	e9 3c fb ff ff       	jmp    8003ca <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80088e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800891:	8d 70 01             	lea    0x1(%eax),%esi
+  800894:	0f b6 00             	movzbl (%eax),%eax
+  800897:	0f be d0             	movsbl %al,%edx
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 11                	je     8008af <vprintfmt+0x4f6>
+  80089e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008a1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008a4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008a7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008aa:	e9 5d fd ff ff       	jmp    80060c <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008af:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b5:	e9 10 fb ff ff       	jmp    8003ca <vprintfmt+0x11>
+  8008ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c0:	e9 05 fb ff ff       	jmp    8003ca <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8008c5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008c9:	7e 0a                	jle    8008d5 <vprintfmt+0x51c>
+  8008cb:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008cf:	0f 85 bd fc ff ff    	jne    800592 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d5:	ba 28 00 00 00       	mov    $0x28,%edx
+  8008da:	b8 28 00 00 00       	mov    $0x28,%eax
+  8008df:	be 79 45 80 00       	mov    $0x804579,%esi
+  8008e4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008ea:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008f0:	e9 17 fd ff ff       	jmp    80060c <vprintfmt+0x253>
+}
+  8008f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008f8:	5b                   	pop    %ebx
+  8008f9:	5e                   	pop    %esi
+  8008fa:	5f                   	pop    %edi
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+
+008008fd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	83 ec 18             	sub    $0x18,%esp
+  800903:	8b 45 08             	mov    0x8(%ebp),%eax
+  800906:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800909:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80090c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800910:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800913:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80091a:	85 c0                	test   %eax,%eax
+  80091c:	74 26                	je     800944 <vsnprintf+0x47>
+  80091e:	85 d2                	test   %edx,%edx
+  800920:	7e 22                	jle    800944 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800922:	ff 75 14             	push   0x14(%ebp)
+  800925:	ff 75 10             	push   0x10(%ebp)
+  800928:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80092b:	50                   	push   %eax
+  80092c:	68 7f 03 80 00       	push   $0x80037f
+  800931:	e8 83 fa ff ff       	call   8003b9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800936:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800939:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80093c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80093f:	83 c4 10             	add    $0x10,%esp
+}
+  800942:	c9                   	leave
+  800943:	c3                   	ret
+		return -E_INVAL;
+  800944:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800949:	eb f7                	jmp    800942 <vsnprintf+0x45>
+
+0080094b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80094b:	55                   	push   %ebp
+  80094c:	89 e5                	mov    %esp,%ebp
+  80094e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800951:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800954:	50                   	push   %eax
+  800955:	ff 75 10             	push   0x10(%ebp)
+  800958:	ff 75 0c             	push   0xc(%ebp)
+  80095b:	ff 75 08             	push   0x8(%ebp)
+  80095e:	e8 9a ff ff ff       	call   8008fd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800963:	c9                   	leave
+  800964:	c3                   	ret
+
+00800965 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80096b:	80 3a 00             	cmpb   $0x0,(%edx)
+  80096e:	74 10                	je     800980 <strlen+0x1b>
+  800970:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800975:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800978:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80097c:	75 f7                	jne    800975 <strlen+0x10>
+	return n;
+}
+  80097e:	5d                   	pop    %ebp
+  80097f:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800980:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800985:	eb f7                	jmp    80097e <strlen+0x19>
+
+00800987 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80098d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800990:	85 d2                	test   %edx,%edx
+  800992:	74 16                	je     8009aa <strnlen+0x23>
+  800994:	b8 00 00 00 00       	mov    $0x0,%eax
+  800999:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80099d:	74 09                	je     8009a8 <strnlen+0x21>
+		n++;
+  80099f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009a2:	39 d0                	cmp    %edx,%eax
+  8009a4:	75 f3                	jne    800999 <strnlen+0x12>
+		n++;
+  8009a6:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009af:	eb f7                	jmp    8009a8 <strnlen+0x21>
+
+008009b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	53                   	push   %ebx
+  8009b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8009bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	84 d2                	test   %dl,%dl
+  8009cc:	75 f2                	jne    8009c0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8009ce:	89 c8                	mov    %ecx,%eax
+  8009d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009d3:	c9                   	leave
+  8009d4:	c3                   	ret
+
+008009d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8009d5:	55                   	push   %ebp
+  8009d6:	89 e5                	mov    %esp,%ebp
+  8009d8:	53                   	push   %ebx
+  8009d9:	83 ec 10             	sub    $0x10,%esp
+  8009dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8009df:	53                   	push   %ebx
+  8009e0:	e8 80 ff ff ff       	call   800965 <strlen>
+  8009e5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009e8:	ff 75 0c             	push   0xc(%ebp)
+  8009eb:	01 d8                	add    %ebx,%eax
+  8009ed:	50                   	push   %eax
+  8009ee:	e8 be ff ff ff       	call   8009b1 <strcpy>
+	return dst;
+}
+  8009f3:	89 d8                	mov    %ebx,%eax
+  8009f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009f8:	c9                   	leave
+  8009f9:	c3                   	ret
+
+008009fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	56                   	push   %esi
+  8009fe:	53                   	push   %ebx
+  8009ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a08:	85 db                	test   %ebx,%ebx
+  800a0a:	74 17                	je     800a23 <strncpy+0x29>
+  800a0c:	01 f3                	add    %esi,%ebx
+  800a0e:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	0f b6 0a             	movzbl (%edx),%ecx
+  800a16:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a19:	80 f9 01             	cmp    $0x1,%cl
+  800a1c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a1f:	39 c3                	cmp    %eax,%ebx
+  800a21:	75 ed                	jne    800a10 <strncpy+0x16>
+	}
+	return ret;
+}
+  800a23:	89 f0                	mov    %esi,%eax
+  800a25:	5b                   	pop    %ebx
+  800a26:	5e                   	pop    %esi
+  800a27:	5d                   	pop    %ebp
+  800a28:	c3                   	ret
+
+00800a29 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	56                   	push   %esi
+  800a2d:	53                   	push   %ebx
+  800a2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a31:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a37:	89 f0                	mov    %esi,%eax
+  800a39:	85 db                	test   %ebx,%ebx
+  800a3b:	74 1e                	je     800a5b <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a3d:	83 eb 01             	sub    $0x1,%ebx
+  800a40:	74 16                	je     800a58 <strlcpy+0x2f>
+  800a42:	01 f3                	add    %esi,%ebx
+  800a44:	0f b6 0a             	movzbl (%edx),%ecx
+  800a47:	84 c9                	test   %cl,%cl
+  800a49:	74 0d                	je     800a58 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a4b:	83 c2 01             	add    $0x1,%edx
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a54:	39 d8                	cmp    %ebx,%eax
+  800a56:	75 ec                	jne    800a44 <strlcpy+0x1b>
+		*dst = '\0';
+  800a58:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a5b:	29 f0                	sub    %esi,%eax
+}
+  800a5d:	5b                   	pop    %ebx
+  800a5e:	5e                   	pop    %esi
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a6a:	0f b6 01             	movzbl (%ecx),%eax
+  800a6d:	84 c0                	test   %al,%al
+  800a6f:	74 11                	je     800a82 <strcmp+0x21>
+  800a71:	38 02                	cmp    %al,(%edx)
+  800a73:	75 0d                	jne    800a82 <strcmp+0x21>
+		p++, q++;
+  800a75:	83 c1 01             	add    $0x1,%ecx
+  800a78:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a7b:	0f b6 01             	movzbl (%ecx),%eax
+  800a7e:	84 c0                	test   %al,%al
+  800a80:	75 ef                	jne    800a71 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a82:	0f b6 c0             	movzbl %al,%eax
+  800a85:	0f b6 12             	movzbl (%edx),%edx
+  800a88:	29 d0                	sub    %edx,%eax
+}
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	53                   	push   %ebx
+  800a90:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a96:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a99:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a9e:	85 d2                	test   %edx,%edx
+  800aa0:	74 2e                	je     800ad0 <strncmp+0x44>
+  800aa2:	0f b6 01             	movzbl (%ecx),%eax
+  800aa5:	84 c0                	test   %al,%al
+  800aa7:	74 16                	je     800abf <strncmp+0x33>
+  800aa9:	3a 03                	cmp    (%ebx),%al
+  800aab:	75 12                	jne    800abf <strncmp+0x33>
+		n--, p++, q++;
+  800aad:	83 c1 01             	add    $0x1,%ecx
+  800ab0:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ab3:	83 ea 01             	sub    $0x1,%edx
+  800ab6:	75 ea                	jne    800aa2 <strncmp+0x16>
+		return 0;
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abd:	eb 11                	jmp    800ad0 <strncmp+0x44>
+  800abf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ac4:	85 d2                	test   %edx,%edx
+  800ac6:	74 08                	je     800ad0 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac8:	0f b6 01             	movzbl (%ecx),%eax
+  800acb:	0f b6 13             	movzbl (%ebx),%edx
+  800ace:	29 d0                	sub    %edx,%eax
+}
+  800ad0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad3:	c9                   	leave
+  800ad4:	c3                   	ret
+
+00800ad5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800adb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800adf:	0f b6 10             	movzbl (%eax),%edx
+  800ae2:	84 d2                	test   %dl,%dl
+  800ae4:	74 15                	je     800afb <strchr+0x26>
+		if (*s == c)
+  800ae6:	38 d1                	cmp    %dl,%cl
+  800ae8:	74 0f                	je     800af9 <strchr+0x24>
+	for (; *s; s++)
+  800aea:	83 c0 01             	add    $0x1,%eax
+  800aed:	0f b6 10             	movzbl (%eax),%edx
+  800af0:	84 d2                	test   %dl,%dl
+  800af2:	75 f2                	jne    800ae6 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800af4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+	return 0;
+  800afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b00:	eb f7                	jmp    800af9 <strchr+0x24>
+
+00800b02 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	53                   	push   %ebx
+  800b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b09:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b0c:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b0f:	38 d3                	cmp    %dl,%bl
+  800b11:	74 14                	je     800b27 <strfind+0x25>
+  800b13:	89 d1                	mov    %edx,%ecx
+  800b15:	84 db                	test   %bl,%bl
+  800b17:	74 0e                	je     800b27 <strfind+0x25>
+	for (; *s; s++)
+  800b19:	83 c0 01             	add    $0x1,%eax
+  800b1c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b1f:	38 ca                	cmp    %cl,%dl
+  800b21:	74 04                	je     800b27 <strfind+0x25>
+  800b23:	84 d2                	test   %dl,%dl
+  800b25:	75 f2                	jne    800b19 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+
+00800b2c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	57                   	push   %edi
+  800b30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b33:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b36:	85 c9                	test   %ecx,%ecx
+  800b38:	74 20                	je     800b5a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b3a:	89 f8                	mov    %edi,%eax
+  800b3c:	09 c8                	or     %ecx,%eax
+  800b3e:	a8 03                	test   $0x3,%al
+  800b40:	75 12                	jne    800b54 <memset+0x28>
+		c &= 0xFF;
+  800b42:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b46:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b4c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b4f:	fc                   	cld
+  800b50:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b52:	eb 06                	jmp    800b5a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b57:	fc                   	cld
+  800b58:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b5a:	89 f8                	mov    %edi,%eax
+  800b5c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b5f:	c9                   	leave
+  800b60:	c3                   	ret
+
+00800b61 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b61:	55                   	push   %ebp
+  800b62:	89 e5                	mov    %esp,%ebp
+  800b64:	57                   	push   %edi
+  800b65:	56                   	push   %esi
+  800b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b69:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b6c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b6f:	39 c6                	cmp    %eax,%esi
+  800b71:	73 32                	jae    800ba5 <memmove+0x44>
+  800b73:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b76:	39 d0                	cmp    %edx,%eax
+  800b78:	73 2b                	jae    800ba5 <memmove+0x44>
+		s += n;
+		d += n;
+  800b7a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b7d:	89 d6                	mov    %edx,%esi
+  800b7f:	09 fe                	or     %edi,%esi
+  800b81:	09 ce                	or     %ecx,%esi
+  800b83:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b89:	75 0e                	jne    800b99 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b8b:	83 ef 04             	sub    $0x4,%edi
+  800b8e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b91:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b94:	fd                   	std
+  800b95:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b97:	eb 09                	jmp    800ba2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b99:	83 ef 01             	sub    $0x1,%edi
+  800b9c:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b9f:	fd                   	std
+  800ba0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ba2:	fc                   	cld
+  800ba3:	eb 1a                	jmp    800bbf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba5:	89 f2                	mov    %esi,%edx
+  800ba7:	09 c2                	or     %eax,%edx
+  800ba9:	09 ca                	or     %ecx,%edx
+  800bab:	f6 c2 03             	test   $0x3,%dl
+  800bae:	75 0a                	jne    800bba <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bb0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bb3:	89 c7                	mov    %eax,%edi
+  800bb5:	fc                   	cld
+  800bb6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb8:	eb 05                	jmp    800bbf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bba:	89 c7                	mov    %eax,%edi
+  800bbc:	fc                   	cld
+  800bbd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800bc9:	ff 75 10             	push   0x10(%ebp)
+  800bcc:	ff 75 0c             	push   0xc(%ebp)
+  800bcf:	ff 75 08             	push   0x8(%ebp)
+  800bd2:	e8 8a ff ff ff       	call   800b61 <memmove>
+}
+  800bd7:	c9                   	leave
+  800bd8:	c3                   	ret
+
+00800bd9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  800bde:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be4:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800be7:	85 f6                	test   %esi,%esi
+  800be9:	74 29                	je     800c14 <memcmp+0x3b>
+  800beb:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800bed:	0f b6 08             	movzbl (%eax),%ecx
+  800bf0:	0f b6 1a             	movzbl (%edx),%ebx
+  800bf3:	38 d9                	cmp    %bl,%cl
+  800bf5:	75 11                	jne    800c08 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bf7:	83 c0 01             	add    $0x1,%eax
+  800bfa:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bfd:	39 c6                	cmp    %eax,%esi
+  800bff:	75 ec                	jne    800bed <memcmp+0x14>
+	}
+
+	return 0;
+  800c01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c06:	eb 08                	jmp    800c10 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c08:	0f b6 c1             	movzbl %cl,%eax
+  800c0b:	0f b6 db             	movzbl %bl,%ebx
+  800c0e:	29 d8                	sub    %ebx,%eax
+}
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+	return 0;
+  800c14:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c19:	eb f5                	jmp    800c10 <memcmp+0x37>
+
+00800c1b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c24:	89 c2                	mov    %eax,%edx
+  800c26:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c29:	39 d0                	cmp    %edx,%eax
+  800c2b:	73 0d                	jae    800c3a <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c2d:	38 08                	cmp    %cl,(%eax)
+  800c2f:	74 0d                	je     800c3e <memfind+0x23>
+	for (; s < ends; s++)
+  800c31:	83 c0 01             	add    $0x1,%eax
+  800c34:	39 c2                	cmp    %eax,%edx
+  800c36:	75 f5                	jne    800c2d <memfind+0x12>
+  800c38:	eb 06                	jmp    800c40 <memfind+0x25>
+  800c3a:	89 c2                	mov    %eax,%edx
+  800c3c:	eb 02                	jmp    800c40 <memfind+0x25>
+  800c3e:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c40:	89 d0                	mov    %edx,%eax
+  800c42:	5d                   	pop    %ebp
+  800c43:	c3                   	ret
+
+00800c44 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+  800c4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c50:	0f b6 02             	movzbl (%edx),%eax
+  800c53:	3c 20                	cmp    $0x20,%al
+  800c55:	74 04                	je     800c5b <strtol+0x17>
+  800c57:	3c 09                	cmp    $0x9,%al
+  800c59:	75 0e                	jne    800c69 <strtol+0x25>
+		s++;
+  800c5b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c5e:	0f b6 02             	movzbl (%edx),%eax
+  800c61:	3c 20                	cmp    $0x20,%al
+  800c63:	74 f6                	je     800c5b <strtol+0x17>
+  800c65:	3c 09                	cmp    $0x9,%al
+  800c67:	74 f2                	je     800c5b <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c69:	3c 2b                	cmp    $0x2b,%al
+  800c6b:	74 2a                	je     800c97 <strtol+0x53>
+	int neg = 0;
+  800c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c72:	3c 2d                	cmp    $0x2d,%al
+  800c74:	74 2b                	je     800ca1 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c76:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7c:	75 0f                	jne    800c8d <strtol+0x49>
+  800c7e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c81:	74 28                	je     800cab <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c83:	85 db                	test   %ebx,%ebx
+  800c85:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8a:	0f 44 d8             	cmove  %eax,%ebx
+  800c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c92:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c95:	eb 46                	jmp    800cdd <strtol+0x99>
+		s++;
+  800c97:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c9f:	eb d5                	jmp    800c76 <strtol+0x32>
+		s++, neg = 1;
+  800ca1:	83 c2 01             	add    $0x1,%edx
+  800ca4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca9:	eb cb                	jmp    800c76 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cab:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800caf:	74 0e                	je     800cbf <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800cb1:	85 db                	test   %ebx,%ebx
+  800cb3:	75 d8                	jne    800c8d <strtol+0x49>
+		s++, base = 8;
+  800cb5:	83 c2 01             	add    $0x1,%edx
+  800cb8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cbd:	eb ce                	jmp    800c8d <strtol+0x49>
+		s += 2, base = 16;
+  800cbf:	83 c2 02             	add    $0x2,%edx
+  800cc2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc7:	eb c4                	jmp    800c8d <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc9:	0f be c0             	movsbl %al,%eax
+  800ccc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ccf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd2:	7d 3a                	jge    800d0e <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800cd4:	83 c2 01             	add    $0x1,%edx
+  800cd7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cdb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cdd:	0f b6 02             	movzbl (%edx),%eax
+  800ce0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce3:	89 f3                	mov    %esi,%ebx
+  800ce5:	80 fb 09             	cmp    $0x9,%bl
+  800ce8:	76 df                	jbe    800cc9 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800cea:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ced:	89 f3                	mov    %esi,%ebx
+  800cef:	80 fb 19             	cmp    $0x19,%bl
+  800cf2:	77 08                	ja     800cfc <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cf4:	0f be c0             	movsbl %al,%eax
+  800cf7:	83 e8 57             	sub    $0x57,%eax
+  800cfa:	eb d3                	jmp    800ccf <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cfc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cff:	89 f3                	mov    %esi,%ebx
+  800d01:	80 fb 19             	cmp    $0x19,%bl
+  800d04:	77 08                	ja     800d0e <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d06:	0f be c0             	movsbl %al,%eax
+  800d09:	83 e8 37             	sub    $0x37,%eax
+  800d0c:	eb c1                	jmp    800ccf <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d0e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d12:	74 05                	je     800d19 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d14:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d17:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d19:	89 c8                	mov    %ecx,%eax
+  800d1b:	f7 d8                	neg    %eax
+  800d1d:	85 ff                	test   %edi,%edi
+  800d1f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d22:	89 c8                	mov    %ecx,%eax
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3a:	89 c3                	mov    %eax,%ebx
+  800d3c:	89 c7                	mov    %eax,%edi
+  800d3e:	89 c6                	mov    %eax,%esi
+  800d40:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d42:	5b                   	pop    %ebx
+  800d43:	5e                   	pop    %esi
+  800d44:	5f                   	pop    %edi
+  800d45:	5d                   	pop    %ebp
+  800d46:	c3                   	ret
+
+00800d47 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d47:	55                   	push   %ebp
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	57                   	push   %edi
+  800d4b:	56                   	push   %esi
+  800d4c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d52:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d57:	89 d1                	mov    %edx,%ecx
+  800d59:	89 d3                	mov    %edx,%ebx
+  800d5b:	89 d7                	mov    %edx,%edi
+  800d5d:	89 d6                	mov    %edx,%esi
+  800d5f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+
+00800d66 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d66:	55                   	push   %ebp
+  800d67:	89 e5                	mov    %esp,%ebp
+  800d69:	57                   	push   %edi
+  800d6a:	56                   	push   %esi
+  800d6b:	53                   	push   %ebx
+  800d6c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d77:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7c:	89 cb                	mov    %ecx,%ebx
+  800d7e:	89 cf                	mov    %ecx,%edi
+  800d80:	89 ce                	mov    %ecx,%esi
+  800d82:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	7f 08                	jg     800d90 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+  800d93:	50                   	push   %eax
+  800d94:	6a 03                	push   $0x3
+  800d96:	68 ab 48 80 00       	push   $0x8048ab
+  800d9b:	6a 23                	push   $0x23
+  800d9d:	68 c8 48 80 00       	push   $0x8048c8
+  800da2:	e8 38 f4 ff ff       	call   8001df <_panic>
+
+00800da7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dad:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800db7:	89 d1                	mov    %edx,%ecx
+  800db9:	89 d3                	mov    %edx,%ebx
+  800dbb:	89 d7                	mov    %edx,%edi
+  800dbd:	89 d6                	mov    %edx,%esi
+  800dbf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+
+00800dc6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd6:	89 d1                	mov    %edx,%ecx
+  800dd8:	89 d3                	mov    %edx,%ebx
+  800dda:	89 d7                	mov    %edx,%edi
+  800ddc:	89 d6                	mov    %edx,%esi
+  800dde:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de0:	5b                   	pop    %ebx
+  800de1:	5e                   	pop    %esi
+  800de2:	5f                   	pop    %edi
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dee:	be 00 00 00 00       	mov    $0x0,%esi
+  800df3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e01:	89 f7                	mov    %esi,%edi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 04                	push   $0x4
+  800e17:	68 ab 48 80 00       	push   $0x8048ab
+  800e1c:	6a 23                	push   $0x23
+  800e1e:	68 c8 48 80 00       	push   $0x8048c8
+  800e23:	e8 b7 f3 ff ff       	call   8001df <_panic>
+
+00800e28 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e3c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e42:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 05                	push   $0x5
+  800e59:	68 ab 48 80 00       	push   $0x8048ab
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 c8 48 80 00       	push   $0x8048c8
+  800e65:	e8 75 f3 ff ff       	call   8001df <_panic>
+
+00800e6a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	89 de                	mov    %ebx,%esi
+  800e87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 08                	jg     800e95 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 06                	push   $0x6
+  800e9b:	68 ab 48 80 00       	push   $0x8048ab
+  800ea0:	6a 23                	push   $0x23
+  800ea2:	68 c8 48 80 00       	push   $0x8048c8
+  800ea7:	e8 33 f3 ff ff       	call   8001df <_panic>
+
+00800eac <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 08                	jg     800ed7 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 08                	push   $0x8
+  800edd:	68 ab 48 80 00       	push   $0x8048ab
+  800ee2:	6a 23                	push   $0x23
+  800ee4:	68 c8 48 80 00       	push   $0x8048c8
+  800ee9:	e8 f1 f2 ff ff       	call   8001df <_panic>
+
+00800eee <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f07:	89 df                	mov    %ebx,%edi
+  800f09:	89 de                	mov    %ebx,%esi
+  800f0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0d:	85 c0                	test   %eax,%eax
+  800f0f:	7f 08                	jg     800f19 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  800f1c:	50                   	push   %eax
+  800f1d:	6a 09                	push   $0x9
+  800f1f:	68 ab 48 80 00       	push   $0x8048ab
+  800f24:	6a 23                	push   $0x23
+  800f26:	68 c8 48 80 00       	push   $0x8048c8
+  800f2b:	e8 af f2 ff ff       	call   8001df <_panic>
+
+00800f30 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  800f36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	89 de                	mov    %ebx,%esi
+  800f4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4f:	85 c0                	test   %eax,%eax
+  800f51:	7f 08                	jg     800f5b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  800f5e:	50                   	push   %eax
+  800f5f:	6a 0a                	push   $0xa
+  800f61:	68 ab 48 80 00       	push   $0x8048ab
+  800f66:	6a 23                	push   $0x23
+  800f68:	68 c8 48 80 00       	push   $0x8048c8
+  800f6d:	e8 6d f2 ff ff       	call   8001df <_panic>
+
+00800f72 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	57                   	push   %edi
+  800f76:	56                   	push   %esi
+  800f77:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f83:	be 00 00 00 00       	mov    $0x0,%esi
+  800f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+
+00800f95 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f95:	55                   	push   %ebp
+  800f96:	89 e5                	mov    %esp,%ebp
+  800f98:	57                   	push   %edi
+  800f99:	56                   	push   %esi
+  800f9a:	53                   	push   %ebx
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fab:	89 cb                	mov    %ecx,%ebx
+  800fad:	89 cf                	mov    %ecx,%edi
+  800faf:	89 ce                	mov    %ecx,%esi
+  800fb1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb3:	85 c0                	test   %eax,%eax
+  800fb5:	7f 08                	jg     800fbf <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbf:	83 ec 0c             	sub    $0xc,%esp
+  800fc2:	50                   	push   %eax
+  800fc3:	6a 0d                	push   $0xd
+  800fc5:	68 ab 48 80 00       	push   $0x8048ab
+  800fca:	6a 23                	push   $0x23
+  800fcc:	68 c8 48 80 00       	push   $0x8048c8
+  800fd1:	e8 09 f2 ff ff       	call   8001df <_panic>
+
+00800fd6 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fed:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff0:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5f                   	pop    %edi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+
+00800ff7 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	57                   	push   %edi
+  800ffb:	56                   	push   %esi
+  800ffc:	53                   	push   %ebx
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801000:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801005:	8b 55 08             	mov    0x8(%ebp),%edx
+  801008:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801010:	89 df                	mov    %ebx,%edi
+  801012:	89 de                	mov    %ebx,%esi
+  801014:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801016:	85 c0                	test   %eax,%eax
+  801018:	7f 08                	jg     801022 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80101a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101d:	5b                   	pop    %ebx
+  80101e:	5e                   	pop    %esi
+  80101f:	5f                   	pop    %edi
+  801020:	5d                   	pop    %ebp
+  801021:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  801025:	50                   	push   %eax
+  801026:	6a 0d                	push   $0xd
+  801028:	68 ab 48 80 00       	push   $0x8048ab
+  80102d:	6a 23                	push   $0x23
+  80102f:	68 c8 48 80 00       	push   $0x8048c8
+  801034:	e8 a6 f1 ff ff       	call   8001df <_panic>
+
+00801039 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801039:	55                   	push   %ebp
+  80103a:	89 e5                	mov    %esp,%ebp
+  80103c:	57                   	push   %edi
+  80103d:	56                   	push   %esi
+  80103e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801044:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801049:	89 d1                	mov    %edx,%ecx
+  80104b:	89 d3                	mov    %edx,%ebx
+  80104d:	89 d7                	mov    %edx,%edi
+  80104f:	89 d6                	mov    %edx,%esi
+  801051:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	89 de                	mov    %ebx,%esi
+  801072:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801074:	5b                   	pop    %ebx
+  801075:	5e                   	pop    %esi
+  801076:	5f                   	pop    %edi
+  801077:	5d                   	pop    %ebp
+  801078:	c3                   	ret
+
+00801079 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801079:	55                   	push   %ebp
+  80107a:	89 e5                	mov    %esp,%ebp
+  80107c:	57                   	push   %edi
+  80107d:	56                   	push   %esi
+  80107e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	b8 10 00 00 00       	mov    $0x10,%eax
+  80108c:	89 cb                	mov    %ecx,%ebx
+  80108e:	89 cf                	mov    %ecx,%edi
+  801090:	89 ce                	mov    %ecx,%esi
+  801092:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+
+00801099 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 11 00 00 00       	mov    $0x11,%eax
+  8010af:	89 df                	mov    %ebx,%edi
+  8010b1:	89 de                	mov    %ebx,%esi
+  8010b3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+
+008010ba <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cb:	b8 12 00 00 00       	mov    $0x12,%eax
+  8010d0:	89 df                	mov    %ebx,%edi
+  8010d2:	89 de                	mov    %ebx,%esi
+  8010d4:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ee:	89 cb                	mov    %ecx,%ebx
+  8010f0:	89 cf                	mov    %ecx,%edi
+  8010f2:	89 ce                	mov    %ecx,%esi
+  8010f4:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5f                   	pop    %edi
+  8010f9:	5d                   	pop    %ebp
+  8010fa:	c3                   	ret
+
+008010fb <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010fb:	55                   	push   %ebp
+  8010fc:	89 e5                	mov    %esp,%ebp
+  8010fe:	57                   	push   %edi
+  8010ff:	56                   	push   %esi
+  801100:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801111:	89 df                	mov    %ebx,%edi
+  801113:	89 de                	mov    %ebx,%esi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+
+0080111c <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80112f:	89 cb                	mov    %ecx,%ebx
+  801131:	89 cf                	mov    %ecx,%edi
+  801133:	89 ce                	mov    %ecx,%esi
+  801135:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+
+0080113c <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801142:	be 00 00 00 00       	mov    $0x0,%esi
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801152:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801155:	89 f7                	mov    %esi,%edi
+  801157:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5f                   	pop    %edi
+  80115c:	5d                   	pop    %ebp
+  80115d:	c3                   	ret
+
+0080115e <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	57                   	push   %edi
+  801162:	56                   	push   %esi
+  801163:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	89 de                	mov    %ebx,%esi
+  801178:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+
+0080117f <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	57                   	push   %edi
+  801183:	56                   	push   %esi
+  801184:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801185:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801192:	89 cb                	mov    %ecx,%ebx
+  801194:	89 cf                	mov    %ecx,%edi
+  801196:	89 ce                	mov    %ecx,%esi
+  801198:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80119a:	5b                   	pop    %ebx
+  80119b:	5e                   	pop    %esi
+  80119c:	5f                   	pop    %edi
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	57                   	push   %edi
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8011a5:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8011a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011b6:	89 df                	mov    %ebx,%edi
+  8011b8:	89 de                	mov    %ebx,%esi
+  8011ba:	cd 30                	int    $0x30
+}
+  8011bc:	5b                   	pop    %ebx
+  8011bd:	5e                   	pop    %esi
+  8011be:	5f                   	pop    %edi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	c3                   	ret
+
+008011c1 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	57                   	push   %edi
+  8011c5:	56                   	push   %esi
+  8011c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011da:	89 f7                	mov    %esi,%edi
+  8011dc:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+
+008011e3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	57                   	push   %edi
+  8011e7:	56                   	push   %esi
+  8011e8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fc:	89 f7                	mov    %esi,%edi
+  8011fe:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801200:	5b                   	pop    %ebx
+  801201:	5e                   	pop    %esi
+  801202:	5f                   	pop    %edi
+  801203:	5d                   	pop    %ebp
+  801204:	c3                   	ret
+
+00801205 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80120b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801210:	8b 55 08             	mov    0x8(%ebp),%edx
+  801213:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801216:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80121b:	89 df                	mov    %ebx,%edi
+  80121d:	89 de                	mov    %ebx,%esi
+  80121f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801221:	5b                   	pop    %ebx
+  801222:	5e                   	pop    %esi
+  801223:	5f                   	pop    %edi
+  801224:	5d                   	pop    %ebp
+  801225:	c3                   	ret
+
+00801226 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	57                   	push   %edi
+  80122a:	56                   	push   %esi
+  80122b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80122c:	be 00 00 00 00       	mov    $0x0,%esi
+  801231:	8b 55 08             	mov    0x8(%ebp),%edx
+  801234:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801237:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80123c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123f:	89 f7                	mov    %esi,%edi
+  801241:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5f                   	pop    %edi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+
+00801248 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	74 20                	je     80126c <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80124c:	89 c1                	mov    %eax,%ecx
+  80124e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801254:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80125a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801260:	8b 52 48             	mov    0x48(%edx),%edx
+  801263:	39 c2                	cmp    %eax,%edx
+  801265:	74 06                	je     80126d <thread_alive+0x25>
+  801267:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80126c:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80126d:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801273:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801279:	85 c0                	test   %eax,%eax
+  80127b:	0f 95 c0             	setne  %al
+  80127e:	0f b6 c0             	movzbl %al,%eax
+  801281:	c3                   	ret
+
+00801282 <pgfault>:
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 0c             	sub    $0xc,%esp
+  80128b:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80128e:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801290:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801293:	89 f3                	mov    %esi,%ebx
+  801295:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801298:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80129f:	74 52                	je     8012f3 <pgfault+0x71>
+  8012a1:	a8 02                	test   $0x2,%al
+  8012a3:	75 14                	jne    8012b9 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	68 d6 48 80 00       	push   $0x8048d6
+  8012ad:	6a 2e                	push   $0x2e
+  8012af:	68 f4 48 80 00       	push   $0x8048f4
+  8012b4:	e8 26 ef ff ff       	call   8001df <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8012b9:	89 d8                	mov    %ebx,%eax
+  8012bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012c0:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+  8012ca:	57                   	push   %edi
+  8012cb:	e8 03 29 00 00       	call   803bd3 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8012d0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8012d7:	83 e0 03             	and    $0x3,%eax
+  8012da:	83 c4 10             	add    $0x10,%esp
+  8012dd:	83 f8 03             	cmp    $0x3,%eax
+  8012e0:	75 1a                	jne    8012fc <pgfault+0x7a>
+			mutex_unlock(m);
+  8012e2:	83 ec 0c             	sub    $0xc,%esp
+  8012e5:	57                   	push   %edi
+  8012e6:	e8 56 29 00 00       	call   803c41 <mutex_unlock>
+			return;
+  8012eb:	83 c4 10             	add    $0x10,%esp
+  8012ee:	e9 9f 00 00 00       	jmp    801392 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8012f3:	a8 02                	test   $0x2,%al
+  8012f5:	74 ae                	je     8012a5 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8012f7:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8012fc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801303:	f6 c4 08             	test   $0x8,%ah
+  801306:	74 9d                	je     8012a5 <pgfault+0x23>
+  801308:	89 e0                	mov    %esp,%eax
+  80130a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80130f:	29 c2                	sub    %eax,%edx
+  801311:	89 d0                	mov    %edx,%eax
+  801313:	c1 e8 0f             	shr    $0xf,%eax
+  801316:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80131c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801321:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801324:	c1 e0 0c             	shl    $0xc,%eax
+  801327:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80132c:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80132e:	83 ec 04             	sub    $0x4,%esp
+  801331:	6a 07                	push   $0x7
+  801333:	53                   	push   %ebx
+  801334:	6a 00                	push   $0x0
+  801336:	e8 aa fa ff ff       	call   800de5 <sys_page_alloc>
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 58                	js     80139a <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801342:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801348:	83 ec 04             	sub    $0x4,%esp
+  80134b:	68 00 10 00 00       	push   $0x1000
+  801350:	56                   	push   %esi
+  801351:	53                   	push   %ebx
+  801352:	e8 0a f8 ff ff       	call   800b61 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801357:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80135e:	56                   	push   %esi
+  80135f:	6a 00                	push   $0x0
+  801361:	53                   	push   %ebx
+  801362:	6a 00                	push   $0x0
+  801364:	e8 bf fa ff ff       	call   800e28 <sys_page_map>
+  801369:	83 c4 20             	add    $0x20,%esp
+  80136c:	85 c0                	test   %eax,%eax
+  80136e:	78 3c                	js     8013ac <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801370:	83 ec 08             	sub    $0x8,%esp
+  801373:	53                   	push   %ebx
+  801374:	6a 00                	push   $0x0
+  801376:	e8 ef fa ff ff       	call   800e6a <sys_page_unmap>
+  80137b:	83 c4 10             	add    $0x10,%esp
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	78 3c                	js     8013be <pgfault+0x13c>
+	if(m)
+  801382:	85 ff                	test   %edi,%edi
+  801384:	74 0c                	je     801392 <pgfault+0x110>
+		mutex_unlock(m);
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	57                   	push   %edi
+  80138a:	e8 b2 28 00 00       	call   803c41 <mutex_unlock>
+  80138f:	83 c4 10             	add    $0x10,%esp
+}
+  801392:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801395:	5b                   	pop    %ebx
+  801396:	5e                   	pop    %esi
+  801397:	5f                   	pop    %edi
+  801398:	5d                   	pop    %ebp
+  801399:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  80139a:	50                   	push   %eax
+  80139b:	68 ff 48 80 00       	push   $0x8048ff
+  8013a0:	6a 3d                	push   $0x3d
+  8013a2:	68 f4 48 80 00       	push   $0x8048f4
+  8013a7:	e8 33 ee ff ff       	call   8001df <_panic>
+		panic("sys_page_map: %e", ret);
+  8013ac:	50                   	push   %eax
+  8013ad:	68 12 49 80 00       	push   $0x804912
+  8013b2:	6a 40                	push   $0x40
+  8013b4:	68 f4 48 80 00       	push   $0x8048f4
+  8013b9:	e8 21 ee ff ff       	call   8001df <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8013be:	50                   	push   %eax
+  8013bf:	68 23 49 80 00       	push   $0x804923
+  8013c4:	6a 42                	push   $0x42
+  8013c6:	68 f4 48 80 00       	push   $0x8048f4
+  8013cb:	e8 0f ee ff ff       	call   8001df <_panic>
+
+008013d0 <thread_main>:
+{
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  8013d3:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8013d6:	ff 75 0c             	push   0xc(%ebp)
+  8013d9:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8013dc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8013e3:	e8 7e f9 ff ff       	call   800d66 <sys_env_destroy>
+}
+  8013e8:	83 c4 10             	add    $0x10,%esp
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+
+008013ed <fork>:
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	57                   	push   %edi
+  8013f1:	56                   	push   %esi
+  8013f2:	53                   	push   %ebx
+  8013f3:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8013f6:	68 82 12 80 00       	push   $0x801282
+  8013fb:	e8 1f 2b 00 00       	call   803f1f <set_pgfault_handler>
+	if(sforked)
+  801400:	83 c4 10             	add    $0x10,%esp
+  801403:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80140a:	75 33                	jne    80143f <fork+0x52>
+	__asm __volatile("int %2"
+  80140c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801411:	cd 30                	int    $0x30
+  801413:	89 c7                	mov    %eax,%edi
+  801415:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801417:	85 c0                	test   %eax,%eax
+  801419:	0f 88 b4 00 00 00    	js     8014d3 <fork+0xe6>
+	if(envid == 0) {
+  80141f:	0f 84 c3 00 00 00    	je     8014e8 <fork+0xfb>
+	pgbatch_init(&pb);
+  801425:	83 ec 0c             	sub    $0xc,%esp
+  801428:	68 20 63 80 00       	push   $0x806320
+  80142d:	e8 ed 25 00 00       	call   803a1f <pgbatch_init>
+  801432:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801435:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80143a:	e9 9c 01 00 00       	jmp    8015db <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	68 c0 66 80 00       	push   $0x8066c0
+  801447:	e8 87 27 00 00       	call   803bd3 <mutex_lock>
+  80144c:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801454:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801459:	eb 08                	jmp    801463 <fork+0x76>
+  80145b:	83 c3 01             	add    $0x1,%ebx
+  80145e:	83 fb 20             	cmp    $0x20,%ebx
+  801461:	74 5b                	je     8014be <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801463:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  80146a:	89 f0                	mov    %esi,%eax
+  80146c:	e8 d7 fd ff ff       	call   801248 <thread_alive>
+  801471:	85 c0                	test   %eax,%eax
+  801473:	74 e6                	je     80145b <fork+0x6e>
+  801475:	89 e0                	mov    %esp,%eax
+  801477:	89 fa                	mov    %edi,%edx
+  801479:	29 c2                	sub    %eax,%edx
+  80147b:	89 d0                	mov    %edx,%eax
+  80147d:	c1 e8 0f             	shr    $0xf,%eax
+  801480:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801486:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148b:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80148e:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801495:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801498:	83 ec 08             	sub    $0x8,%esp
+  80149b:	50                   	push   %eax
+  80149c:	56                   	push   %esi
+  80149d:	e8 8e fa ff ff       	call   800f30 <sys_env_set_pgfault_upcall>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	79 b2                	jns    80145b <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8014a9:	50                   	push   %eax
+  8014aa:	68 b0 49 80 00       	push   $0x8049b0
+  8014af:	68 00 01 00 00       	push   $0x100
+  8014b4:	68 f4 48 80 00       	push   $0x8048f4
+  8014b9:	e8 21 ed ff ff       	call   8001df <_panic>
+	mutex_unlock(&sfork_lock);
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	68 c0 66 80 00       	push   $0x8066c0
+  8014c6:	e8 76 27 00 00       	call   803c41 <mutex_unlock>
+}
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	e9 39 ff ff ff       	jmp    80140c <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8014d3:	50                   	push   %eax
+  8014d4:	68 36 49 80 00       	push   $0x804936
+  8014d9:	68 91 00 00 00       	push   $0x91
+  8014de:	68 f4 48 80 00       	push   $0x8048f4
+  8014e3:	e8 f7 ec ff ff       	call   8001df <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8014e8:	e8 ba f8 ff ff       	call   800da7 <sys_getenvid>
+  8014ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014f2:	89 e1                	mov    %esp,%ecx
+  8014f4:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014f9:	29 ca                	sub    %ecx,%edx
+  8014fb:	89 d1                	mov    %edx,%ecx
+  8014fd:	c1 e9 0f             	shr    $0xf,%ecx
+  801500:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150b:	0f 42 d1             	cmovb  %ecx,%edx
+  80150e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801514:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801519:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801520:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801525:	85 c0                	test   %eax,%eax
+  801527:	75 07                	jne    801530 <fork+0x143>
+		return 0;
+  801529:	89 c6                	mov    %eax,%esi
+  80152b:	e9 6f 02 00 00       	jmp    80179f <fork+0x3b2>
+  801530:	89 e2                	mov    %esp,%edx
+  801532:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801537:	29 d0                	sub    %edx,%eax
+  801539:	89 c3                	mov    %eax,%ebx
+  80153b:	c1 eb 0f             	shr    $0xf,%ebx
+  80153e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80154b:	83 ec 04             	sub    $0x4,%esp
+  80154e:	68 80 00 00 00       	push   $0x80
+  801553:	6a 00                	push   $0x0
+  801555:	68 40 66 80 00       	push   $0x806640
+  80155a:	e8 cd f5 ff ff       	call   800b2c <memset>
+	thread_ids[slot] = sys_getenvid();
+  80155f:	e8 43 f8 ff ff       	call   800da7 <sys_getenvid>
+  801564:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80156b:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  801572:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801577:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80157e:	e8 42 26 00 00       	call   803bc5 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801583:	83 c4 0c             	add    $0xc,%esp
+  801586:	68 07 04 00 00       	push   $0x407
+  80158b:	68 00 00 00 e1       	push   $0xe1000000
+  801590:	6a 00                	push   $0x0
+  801592:	e8 4e f8 ff ff       	call   800de5 <sys_page_alloc>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	0f 89 fd 01 00 00    	jns    80179f <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8015a2:	50                   	push   %eax
+  8015a3:	68 ff 48 80 00       	push   $0x8048ff
+  8015a8:	68 12 01 00 00       	push   $0x112
+  8015ad:	68 f4 48 80 00       	push   $0x8048f4
+  8015b2:	e8 28 ec ff ff       	call   8001df <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8015b7:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8015bd:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8015c3:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8015c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015cf:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8015d5:	0f 87 4f 01 00 00    	ja     80172a <fork+0x33d>
+		pd = PDX(addr);
+  8015db:	89 d8                	mov    %ebx,%eax
+  8015dd:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8015e0:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015e7:	f6 c2 01             	test   $0x1,%dl
+  8015ea:	74 cb                	je     8015b7 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8015ec:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8015f1:	0f 85 92 00 00 00    	jne    801689 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8015f7:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8015fd:	76 10                	jbe    80160f <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8015ff:	89 d8                	mov    %ebx,%eax
+  801601:	f7 d8                	neg    %eax
+  801603:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801608:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80160d:	74 ba                	je     8015c9 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80160f:	89 d8                	mov    %ebx,%eax
+  801611:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801614:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80161b:	f6 c2 01             	test   $0x1,%dl
+  80161e:	74 a9                	je     8015c9 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801620:	89 c1                	mov    %eax,%ecx
+  801622:	c1 e1 0c             	shl    $0xc,%ecx
+  801625:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801628:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80162f:	f6 c6 04             	test   $0x4,%dh
+  801632:	0f 85 8e 00 00 00    	jne    8016c6 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801638:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80163f:	f6 c6 08             	test   $0x8,%dh
+  801642:	75 0f                	jne    801653 <fork+0x266>
+  801644:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80164b:	a8 02                	test   $0x2,%al
+  80164d:	0f 84 bb 00 00 00    	je     80170e <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801653:	83 ec 08             	sub    $0x8,%esp
+  801656:	68 05 08 00 00       	push   $0x805
+  80165b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80165e:	50                   	push   %eax
+  80165f:	56                   	push   %esi
+  801660:	50                   	push   %eax
+  801661:	6a 00                	push   $0x0
+  801663:	68 20 63 80 00       	push   $0x806320
+  801668:	e8 70 24 00 00       	call   803add <pgbatch_map>
+  80166d:	83 c4 20             	add    $0x20,%esp
+  801670:	85 c0                	test   %eax,%eax
+  801672:	79 76                	jns    8016ea <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801674:	50                   	push   %eax
+  801675:	68 5a 49 80 00       	push   $0x80495a
+  80167a:	68 bc 00 00 00       	push   $0xbc
+  80167f:	68 f4 48 80 00       	push   $0x8048f4
+  801684:	e8 56 eb ff ff       	call   8001df <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	68 00 08 00 00       	push   $0x800
+  801691:	56                   	push   %esi
+  801692:	53                   	push   %ebx
+  801693:	6a 00                	push   $0x0
+  801695:	68 20 63 80 00       	push   $0x806320
+  80169a:	e8 e9 24 00 00       	call   803b88 <pgbatch_sharept>
+  80169f:	83 c4 20             	add    $0x20,%esp
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 0b                	js     8016b1 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8016a6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8016ac:	e9 18 ff ff ff       	jmp    8015c9 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8016b1:	50                   	push   %eax
+  8016b2:	68 46 49 80 00       	push   $0x804946
+  8016b7:	68 b2 00 00 00       	push   $0xb2
+  8016bc:	68 f4 48 80 00       	push   $0x8048f4
+  8016c1:	e8 19 eb ff ff       	call   8001df <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8016c6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016cd:	83 ec 08             	sub    $0x8,%esp
+  8016d0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016d5:	50                   	push   %eax
+  8016d6:	51                   	push   %ecx
+  8016d7:	56                   	push   %esi
+  8016d8:	51                   	push   %ecx
+  8016d9:	6a 00                	push   $0x0
+  8016db:	68 20 63 80 00       	push   $0x806320
+  8016e0:	e8 f8 23 00 00       	call   803add <pgbatch_map>
+  8016e5:	83 c4 20             	add    $0x20,%esp
+  8016e8:	eb 17                	jmp    801701 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8016ea:	68 05 08 00 00       	push   $0x805
+  8016ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8016f2:	6a 00                	push   $0x0
+  8016f4:	68 20 63 80 00       	push   $0x806320
+  8016f9:	e8 53 24 00 00       	call   803b51 <pgbatch_protect>
+  8016fe:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801701:	85 c0                	test   %eax,%eax
+  801703:	0f 89 c0 fe ff ff    	jns    8015c9 <fork+0x1dc>
+  801709:	e9 66 ff ff ff       	jmp    801674 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80170e:	83 ec 08             	sub    $0x8,%esp
+  801711:	6a 05                	push   $0x5
+  801713:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	56                   	push   %esi
+  801718:	50                   	push   %eax
+  801719:	6a 00                	push   $0x0
+  80171b:	68 20 63 80 00       	push   $0x806320
+  801720:	e8 b8 23 00 00       	call   803add <pgbatch_map>
+  801725:	83 c4 20             	add    $0x20,%esp
+  801728:	eb d7                	jmp    801701 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80172a:	6a 07                	push   $0x7
+  80172c:	68 00 f0 bf ee       	push   $0xeebff000
+  801731:	57                   	push   %edi
+  801732:	68 20 63 80 00       	push   $0x806320
+  801737:	e8 6a 23 00 00       	call   803aa6 <pgbatch_alloc>
+  80173c:	83 c4 10             	add    $0x10,%esp
+  80173f:	85 c0                	test   %eax,%eax
+  801741:	78 66                	js     8017a9 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801743:	83 ec 0c             	sub    $0xc,%esp
+  801746:	68 20 63 80 00       	push   $0x806320
+  80174b:	e8 dd 22 00 00       	call   803a2d <pgbatch_flush>
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 52                	js     8017a9 <fork+0x3bc>
+  801757:	89 e2                	mov    %esp,%edx
+  801759:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80175e:	29 d0                	sub    %edx,%eax
+  801760:	89 c2                	mov    %eax,%edx
+  801762:	c1 ea 0f             	shr    $0xf,%edx
+  801765:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80176a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176f:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801772:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801779:	8b 40 78             	mov    0x78(%eax),%eax
+  80177c:	83 ec 08             	sub    $0x8,%esp
+  80177f:	50                   	push   %eax
+  801780:	57                   	push   %edi
+  801781:	e8 aa f7 ff ff       	call   800f30 <sys_env_set_pgfault_upcall>
+  801786:	83 c4 10             	add    $0x10,%esp
+  801789:	85 c0                	test   %eax,%eax
+  80178b:	78 31                	js     8017be <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  80178d:	83 ec 08             	sub    $0x8,%esp
+  801790:	6a 02                	push   $0x2
+  801792:	57                   	push   %edi
+  801793:	e8 14 f7 ff ff       	call   800eac <sys_env_set_status>
+  801798:	83 c4 10             	add    $0x10,%esp
+  80179b:	85 c0                	test   %eax,%eax
+  80179d:	78 34                	js     8017d3 <fork+0x3e6>
+}
+  80179f:	89 f0                	mov    %esi,%eax
+  8017a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a4:	5b                   	pop    %ebx
+  8017a5:	5e                   	pop    %esi
+  8017a6:	5f                   	pop    %edi
+  8017a7:	5d                   	pop    %ebp
+  8017a8:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8017a9:	50                   	push   %eax
+  8017aa:	68 66 49 80 00       	push   $0x804966
+  8017af:	68 c0 00 00 00       	push   $0xc0
+  8017b4:	68 f4 48 80 00       	push   $0x8048f4
+  8017b9:	e8 21 ea ff ff       	call   8001df <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8017be:	50                   	push   %eax
+  8017bf:	68 7b 49 80 00       	push   $0x80497b
+  8017c4:	68 c2 00 00 00       	push   $0xc2
+  8017c9:	68 f4 48 80 00       	push   $0x8048f4
+  8017ce:	e8 0c ea ff ff       	call   8001df <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8017d3:	50                   	push   %eax
+  8017d4:	68 96 49 80 00       	push   $0x804996
+  8017d9:	68 c4 00 00 00       	push   $0xc4
+  8017de:	68 f4 48 80 00       	push   $0x8048f4
+  8017e3:	e8 f7 e9 ff ff       	call   8001df <_panic>
+
+008017e8 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8017e8:	55                   	push   %ebp
+  8017e9:	89 e5                	mov    %esp,%ebp
+  8017eb:	57                   	push   %edi
+  8017ec:	56                   	push   %esi
+  8017ed:	53                   	push   %ebx
+  8017ee:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8017f1:	68 c0 66 80 00       	push   $0x8066c0
+  8017f6:	e8 d8 23 00 00       	call   803bd3 <mutex_lock>
+  8017fb:	89 e2                	mov    %esp,%edx
+  8017fd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801802:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801804:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801807:	89 c3                	mov    %eax,%ebx
+  801809:	c1 eb 0f             	shr    $0xf,%ebx
+  80180c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801811:	b8 00 00 00 00       	mov    $0x0,%eax
+  801816:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801819:	e8 89 f5 ff ff       	call   800da7 <sys_getenvid>
+  80181e:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801825:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80182a:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801831:	e8 12 fa ff ff       	call   801248 <thread_alive>
+  801836:	85 c0                	test   %eax,%eax
+  801838:	74 24                	je     80185e <sfork+0x76>
+  80183a:	83 c3 01             	add    $0x1,%ebx
+  80183d:	83 fb 20             	cmp    $0x20,%ebx
+  801840:	75 e8                	jne    80182a <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801842:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801847:	83 ec 0c             	sub    $0xc,%esp
+  80184a:	68 c0 66 80 00       	push   $0x8066c0
+  80184f:	e8 ed 23 00 00       	call   803c41 <mutex_unlock>
+	return r;
+}
+  801854:	89 f0                	mov    %esi,%eax
+  801856:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801859:	5b                   	pop    %ebx
+  80185a:	5e                   	pop    %esi
+  80185b:	5f                   	pop    %edi
+  80185c:	5d                   	pop    %ebp
+  80185d:	c3                   	ret
+	if (i == NTHREADS) {
+  80185e:	83 fb 20             	cmp    $0x20,%ebx
+  801861:	0f 84 53 01 00 00    	je     8019ba <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801867:	89 d8                	mov    %ebx,%eax
+  801869:	c1 e0 0f             	shl    $0xf,%eax
+  80186c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  80186f:	83 ec 0c             	sub    $0xc,%esp
+  801872:	68 00 60 80 00       	push   $0x806000
+  801877:	e8 a3 21 00 00       	call   803a1f <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801886:	75 1f                	jne    8018a7 <sfork+0xbf>
+  801888:	68 07 04 00 00       	push   $0x407
+  80188d:	68 00 00 00 e1       	push   $0xe1000000
+  801892:	6a 00                	push   $0x0
+  801894:	68 00 60 80 00       	push   $0x806000
+  801899:	e8 08 22 00 00       	call   803aa6 <pgbatch_alloc>
+  80189e:	89 c6                	mov    %eax,%esi
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 a0                	js     801847 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  8018a7:	6a 07                	push   $0x7
+  8018a9:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  8018ae:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018b1:	29 c8                	sub    %ecx,%eax
+  8018b3:	50                   	push   %eax
+  8018b4:	6a 00                	push   $0x0
+  8018b6:	68 00 60 80 00       	push   $0x806000
+  8018bb:	e8 e6 21 00 00       	call   803aa6 <pgbatch_alloc>
+  8018c0:	89 c6                	mov    %eax,%esi
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	85 c0                	test   %eax,%eax
+  8018c7:	0f 88 7a ff ff ff    	js     801847 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  8018cd:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  8018d2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018d5:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8018d7:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8018dc:	29 c8                	sub    %ecx,%eax
+  8018de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8018e1:	39 c7                	cmp    %eax,%edi
+  8018e3:	73 29                	jae    80190e <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  8018e5:	6a 07                	push   $0x7
+  8018e7:	57                   	push   %edi
+  8018e8:	6a 00                	push   $0x0
+  8018ea:	68 00 60 80 00       	push   $0x806000
+  8018ef:	e8 b2 21 00 00       	call   803aa6 <pgbatch_alloc>
+  8018f4:	89 c6                	mov    %eax,%esi
+  8018f6:	83 c4 10             	add    $0x10,%esp
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	0f 88 46 ff ff ff    	js     801847 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801901:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801907:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80190a:	39 c7                	cmp    %eax,%edi
+  80190c:	72 d7                	jb     8018e5 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  80190e:	83 ec 0c             	sub    $0xc,%esp
+  801911:	68 00 60 80 00       	push   $0x806000
+  801916:	e8 12 21 00 00       	call   803a2d <pgbatch_flush>
+  80191b:	89 c6                	mov    %eax,%esi
+  80191d:	83 c4 10             	add    $0x10,%esp
+  801920:	85 c0                	test   %eax,%eax
+  801922:	0f 88 1f ff ff ff    	js     801847 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801928:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  80192d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801930:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801932:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801938:	8b 55 08             	mov    0x8(%ebp),%edx
+  80193b:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  80193e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801941:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801944:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801947:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80194c:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  80194e:	52                   	push   %edx
+  80194f:	50                   	push   %eax
+  801950:	68 d0 13 80 00       	push   $0x8013d0
+  801955:	e8 cc f8 ff ff       	call   801226 <sys_exofork_shared>
+  80195a:	89 c6                	mov    %eax,%esi
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	85 c0                	test   %eax,%eax
+  801961:	0f 88 e0 fe ff ff    	js     801847 <sfork+0x5f>
+	thread_ids[i] = id;
+  801967:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  80196e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801973:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801979:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80197e:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801985:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  80198c:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  80198f:	83 ec 08             	sub    $0x8,%esp
+  801992:	6a 02                	push   $0x2
+  801994:	56                   	push   %esi
+  801995:	e8 12 f5 ff ff       	call   800eac <sys_env_set_status>
+  80199a:	89 c3                	mov    %eax,%ebx
+  80199c:	83 c4 10             	add    $0x10,%esp
+  80199f:	85 c0                	test   %eax,%eax
+  8019a1:	0f 89 a0 fe ff ff    	jns    801847 <sfork+0x5f>
+		sys_env_destroy(id);
+  8019a7:	83 ec 0c             	sub    $0xc,%esp
+  8019aa:	56                   	push   %esi
+  8019ab:	e8 b6 f3 ff ff       	call   800d66 <sys_env_destroy>
+		goto out;
+  8019b0:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8019b3:	89 de                	mov    %ebx,%esi
+		goto out;
+  8019b5:	e9 8d fe ff ff       	jmp    801847 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  8019ba:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  8019bf:	e9 83 fe ff ff       	jmp    801847 <sfork+0x5f>
+
+008019c4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ca:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019cf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019d2:	5d                   	pop    %ebp
+  8019d3:	c3                   	ret
+
+008019d4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019d4:	55                   	push   %ebp
+  8019d5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8019d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019da:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8019df:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8019e4:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8019e9:	5d                   	pop    %ebp
+  8019ea:	c3                   	ret
+
+008019eb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019eb:	55                   	push   %ebp
+  8019ec:	89 e5                	mov    %esp,%ebp
+  8019ee:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019f3:	89 c2                	mov    %eax,%edx
+  8019f5:	c1 ea 16             	shr    $0x16,%edx
+  8019f8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019ff:	f6 c2 01             	test   $0x1,%dl
+  801a02:	74 29                	je     801a2d <fd_alloc+0x42>
+  801a04:	89 c2                	mov    %eax,%edx
+  801a06:	c1 ea 0c             	shr    $0xc,%edx
+  801a09:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a10:	f6 c2 01             	test   $0x1,%dl
+  801a13:	74 18                	je     801a2d <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801a15:	05 00 10 00 00       	add    $0x1000,%eax
+  801a1a:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801a1f:	75 d2                	jne    8019f3 <fd_alloc+0x8>
+  801a21:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a26:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a2b:	eb 05                	jmp    801a32 <fd_alloc+0x47>
+			return 0;
+  801a2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a32:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a35:	89 02                	mov    %eax,(%edx)
+}
+  801a37:	89 c8                	mov    %ecx,%eax
+  801a39:	5d                   	pop    %ebp
+  801a3a:	c3                   	ret
+
+00801a3b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a41:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801a46:	77 30                	ja     801a78 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801a48:	c1 e0 0c             	shl    $0xc,%eax
+  801a4b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801a50:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a56:	f6 c2 01             	test   $0x1,%dl
+  801a59:	74 24                	je     801a7f <fd_lookup+0x44>
+  801a5b:	89 c2                	mov    %eax,%edx
+  801a5d:	c1 ea 0c             	shr    $0xc,%edx
+  801a60:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a67:	f6 c2 01             	test   $0x1,%dl
+  801a6a:	74 1a                	je     801a86 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801a6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a6f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801a71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a76:	5d                   	pop    %ebp
+  801a77:	c3                   	ret
+		return -E_INVAL;
+  801a78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7d:	eb f7                	jmp    801a76 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801a7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a84:	eb f0                	jmp    801a76 <fd_lookup+0x3b>
+  801a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a8b:	eb e9                	jmp    801a76 <fd_lookup+0x3b>
+
+00801a8d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a8d:	55                   	push   %ebp
+  801a8e:	89 e5                	mov    %esp,%ebp
+  801a90:	53                   	push   %ebx
+  801a91:	83 ec 04             	sub    $0x4,%esp
+  801a94:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9c:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801aa1:	39 13                	cmp    %edx,(%ebx)
+  801aa3:	74 54                	je     801af9 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801aa5:	83 c0 01             	add    $0x1,%eax
+  801aa8:	8b 1c 85 4c 4a 80 00 	mov    0x804a4c(,%eax,4),%ebx
+  801aaf:	85 db                	test   %ebx,%ebx
+  801ab1:	75 ee                	jne    801aa1 <dev_lookup+0x14>
+  801ab3:	89 e1                	mov    %esp,%ecx
+  801ab5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801aba:	29 c8                	sub    %ecx,%eax
+  801abc:	89 c1                	mov    %eax,%ecx
+  801abe:	c1 e9 0f             	shr    $0xf,%ecx
+  801ac1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acb:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ace:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ad5:	8b 40 48             	mov    0x48(%eax),%eax
+  801ad8:	83 ec 04             	sub    $0x4,%esp
+  801adb:	52                   	push   %edx
+  801adc:	50                   	push   %eax
+  801add:	68 d0 49 80 00       	push   $0x8049d0
+  801ae2:	e8 d3 e7 ff ff       	call   8002ba <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801aef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801af2:	89 1a                	mov    %ebx,(%edx)
+}
+  801af4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af7:	c9                   	leave
+  801af8:	c3                   	ret
+			return 0;
+  801af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afe:	eb ef                	jmp    801aef <dev_lookup+0x62>
+
+00801b00 <fd_close>:
+{
+  801b00:	55                   	push   %ebp
+  801b01:	89 e5                	mov    %esp,%ebp
+  801b03:	57                   	push   %edi
+  801b04:	56                   	push   %esi
+  801b05:	53                   	push   %ebx
+  801b06:	83 ec 24             	sub    $0x24,%esp
+  801b09:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b0c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b0f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b12:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b13:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b19:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b1c:	50                   	push   %eax
+  801b1d:	e8 19 ff ff ff       	call   801a3b <fd_lookup>
+  801b22:	89 c3                	mov    %eax,%ebx
+  801b24:	83 c4 10             	add    $0x10,%esp
+  801b27:	85 c0                	test   %eax,%eax
+  801b29:	78 05                	js     801b30 <fd_close+0x30>
+	    || fd != fd2)
+  801b2b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b2e:	74 0f                	je     801b3f <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801b30:	85 ff                	test   %edi,%edi
+  801b32:	0f 44 df             	cmove  %edi,%ebx
+}
+  801b35:	89 d8                	mov    %ebx,%eax
+  801b37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b3a:	5b                   	pop    %ebx
+  801b3b:	5e                   	pop    %esi
+  801b3c:	5f                   	pop    %edi
+  801b3d:	5d                   	pop    %ebp
+  801b3e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b3f:	83 ec 08             	sub    $0x8,%esp
+  801b42:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b45:	50                   	push   %eax
+  801b46:	ff 36                	push   (%esi)
+  801b48:	e8 40 ff ff ff       	call   801a8d <dev_lookup>
+  801b4d:	89 c3                	mov    %eax,%ebx
+  801b4f:	83 c4 10             	add    $0x10,%esp
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 1a                	js     801b70 <fd_close+0x70>
+		if (dev->dev_close)
+  801b56:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b59:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801b5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	74 0b                	je     801b70 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801b65:	83 ec 0c             	sub    $0xc,%esp
+  801b68:	56                   	push   %esi
+  801b69:	ff d0                	call   *%eax
+  801b6b:	89 c3                	mov    %eax,%ebx
+  801b6d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801b70:	83 ec 08             	sub    $0x8,%esp
+  801b73:	56                   	push   %esi
+  801b74:	6a 00                	push   $0x0
+  801b76:	e8 ef f2 ff ff       	call   800e6a <sys_page_unmap>
+	return r;
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	eb b5                	jmp    801b35 <fd_close+0x35>
+
+00801b80 <close>:
+
+int
+close(int fdnum)
+{
+  801b80:	55                   	push   %ebp
+  801b81:	89 e5                	mov    %esp,%ebp
+  801b83:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b89:	50                   	push   %eax
+  801b8a:	ff 75 08             	push   0x8(%ebp)
+  801b8d:	e8 a9 fe ff ff       	call   801a3b <fd_lookup>
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	79 02                	jns    801b9b <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801b99:	c9                   	leave
+  801b9a:	c3                   	ret
+		return fd_close(fd, 1);
+  801b9b:	83 ec 08             	sub    $0x8,%esp
+  801b9e:	6a 01                	push   $0x1
+  801ba0:	ff 75 f4             	push   -0xc(%ebp)
+  801ba3:	e8 58 ff ff ff       	call   801b00 <fd_close>
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	eb ec                	jmp    801b99 <close+0x19>
+
+00801bad <close_all>:
+
+void
+close_all(void)
+{
+  801bad:	55                   	push   %ebp
+  801bae:	89 e5                	mov    %esp,%ebp
+  801bb0:	53                   	push   %ebx
+  801bb1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801bb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801bb9:	83 ec 0c             	sub    $0xc,%esp
+  801bbc:	53                   	push   %ebx
+  801bbd:	e8 be ff ff ff       	call   801b80 <close>
+	for (i = 0; i < MAXFD; i++)
+  801bc2:	83 c3 01             	add    $0x1,%ebx
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801bce:	75 e9                	jne    801bb9 <close_all+0xc>
+}
+  801bd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+00801bd5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	57                   	push   %edi
+  801bd9:	56                   	push   %esi
+  801bda:	53                   	push   %ebx
+  801bdb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bde:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801be1:	50                   	push   %eax
+  801be2:	ff 75 08             	push   0x8(%ebp)
+  801be5:	e8 51 fe ff ff       	call   801a3b <fd_lookup>
+  801bea:	89 c3                	mov    %eax,%ebx
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 7f                	js     801c72 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801bf3:	83 ec 0c             	sub    $0xc,%esp
+  801bf6:	ff 75 0c             	push   0xc(%ebp)
+  801bf9:	e8 82 ff ff ff       	call   801b80 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801bfe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c01:	c1 e6 0c             	shl    $0xc,%esi
+  801c04:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c0a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c0d:	89 3c 24             	mov    %edi,(%esp)
+  801c10:	e8 bf fd ff ff       	call   8019d4 <fd2data>
+  801c15:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c17:	89 34 24             	mov    %esi,(%esp)
+  801c1a:	e8 b5 fd ff ff       	call   8019d4 <fd2data>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+  801c22:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801c25:	89 d8                	mov    %ebx,%eax
+  801c27:	c1 e8 16             	shr    $0x16,%eax
+  801c2a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c31:	a8 01                	test   $0x1,%al
+  801c33:	74 11                	je     801c46 <dup+0x71>
+  801c35:	89 d8                	mov    %ebx,%eax
+  801c37:	c1 e8 0c             	shr    $0xc,%eax
+  801c3a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c41:	f6 c2 01             	test   $0x1,%dl
+  801c44:	75 36                	jne    801c7c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c46:	89 f8                	mov    %edi,%eax
+  801c48:	c1 e8 0c             	shr    $0xc,%eax
+  801c4b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c52:	83 ec 0c             	sub    $0xc,%esp
+  801c55:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c5a:	50                   	push   %eax
+  801c5b:	56                   	push   %esi
+  801c5c:	6a 00                	push   $0x0
+  801c5e:	57                   	push   %edi
+  801c5f:	6a 00                	push   $0x0
+  801c61:	e8 c2 f1 ff ff       	call   800e28 <sys_page_map>
+  801c66:	89 c3                	mov    %eax,%ebx
+  801c68:	83 c4 20             	add    $0x20,%esp
+  801c6b:	85 c0                	test   %eax,%eax
+  801c6d:	78 33                	js     801ca2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801c6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801c72:	89 d8                	mov    %ebx,%eax
+  801c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c77:	5b                   	pop    %ebx
+  801c78:	5e                   	pop    %esi
+  801c79:	5f                   	pop    %edi
+  801c7a:	5d                   	pop    %ebp
+  801c7b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801c7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801c83:	83 ec 0c             	sub    $0xc,%esp
+  801c86:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c8b:	50                   	push   %eax
+  801c8c:	ff 75 d4             	push   -0x2c(%ebp)
+  801c8f:	6a 00                	push   $0x0
+  801c91:	53                   	push   %ebx
+  801c92:	6a 00                	push   $0x0
+  801c94:	e8 8f f1 ff ff       	call   800e28 <sys_page_map>
+  801c99:	89 c3                	mov    %eax,%ebx
+  801c9b:	83 c4 20             	add    $0x20,%esp
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	79 a4                	jns    801c46 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ca2:	83 ec 08             	sub    $0x8,%esp
+  801ca5:	56                   	push   %esi
+  801ca6:	6a 00                	push   $0x0
+  801ca8:	e8 bd f1 ff ff       	call   800e6a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801cad:	83 c4 08             	add    $0x8,%esp
+  801cb0:	ff 75 d4             	push   -0x2c(%ebp)
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 b0 f1 ff ff       	call   800e6a <sys_page_unmap>
+	return r;
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	eb b3                	jmp    801c72 <dup+0x9d>
+
+00801cbf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	56                   	push   %esi
+  801cc3:	53                   	push   %ebx
+  801cc4:	83 ec 18             	sub    $0x18,%esp
+  801cc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	53                   	push   %ebx
+  801ccf:	e8 67 fd ff ff       	call   801a3b <fd_lookup>
+  801cd4:	83 c4 10             	add    $0x10,%esp
+  801cd7:	85 c0                	test   %eax,%eax
+  801cd9:	78 3c                	js     801d17 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cdb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cde:	83 ec 08             	sub    $0x8,%esp
+  801ce1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ce4:	50                   	push   %eax
+  801ce5:	ff 36                	push   (%esi)
+  801ce7:	e8 a1 fd ff ff       	call   801a8d <dev_lookup>
+  801cec:	83 c4 10             	add    $0x10,%esp
+  801cef:	85 c0                	test   %eax,%eax
+  801cf1:	78 24                	js     801d17 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801cf3:	8b 46 08             	mov    0x8(%esi),%eax
+  801cf6:	83 e0 03             	and    $0x3,%eax
+  801cf9:	83 f8 01             	cmp    $0x1,%eax
+  801cfc:	74 20                	je     801d1e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801cfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d01:	8b 40 08             	mov    0x8(%eax),%eax
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	74 54                	je     801d5c <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d08:	83 ec 04             	sub    $0x4,%esp
+  801d0b:	ff 75 10             	push   0x10(%ebp)
+  801d0e:	ff 75 0c             	push   0xc(%ebp)
+  801d11:	56                   	push   %esi
+  801d12:	ff d0                	call   *%eax
+  801d14:	83 c4 10             	add    $0x10,%esp
+}
+  801d17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1a:	5b                   	pop    %ebx
+  801d1b:	5e                   	pop    %esi
+  801d1c:	5d                   	pop    %ebp
+  801d1d:	c3                   	ret
+  801d1e:	89 e2                	mov    %esp,%edx
+  801d20:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d25:	29 d0                	sub    %edx,%eax
+  801d27:	89 c2                	mov    %eax,%edx
+  801d29:	c1 ea 0f             	shr    $0xf,%edx
+  801d2c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d36:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d39:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d40:	8b 40 48             	mov    0x48(%eax),%eax
+  801d43:	83 ec 04             	sub    $0x4,%esp
+  801d46:	53                   	push   %ebx
+  801d47:	50                   	push   %eax
+  801d48:	68 11 4a 80 00       	push   $0x804a11
+  801d4d:	e8 68 e5 ff ff       	call   8002ba <cprintf>
+		return -E_INVAL;
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d5a:	eb bb                	jmp    801d17 <read+0x58>
+		return -E_NOT_SUPP;
+  801d5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d61:	eb b4                	jmp    801d17 <read+0x58>
+
+00801d63 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	57                   	push   %edi
+  801d67:	56                   	push   %esi
+  801d68:	53                   	push   %ebx
+  801d69:	83 ec 0c             	sub    $0xc,%esp
+  801d6c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801d6f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801d72:	85 f6                	test   %esi,%esi
+  801d74:	74 30                	je     801da6 <readn+0x43>
+  801d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801d80:	83 ec 04             	sub    $0x4,%esp
+  801d83:	89 f2                	mov    %esi,%edx
+  801d85:	29 c2                	sub    %eax,%edx
+  801d87:	52                   	push   %edx
+  801d88:	01 f8                	add    %edi,%eax
+  801d8a:	50                   	push   %eax
+  801d8b:	ff 75 08             	push   0x8(%ebp)
+  801d8e:	e8 2c ff ff ff       	call   801cbf <read>
+		if (m < 0)
+  801d93:	83 c4 10             	add    $0x10,%esp
+  801d96:	85 c0                	test   %eax,%eax
+  801d98:	78 15                	js     801daf <readn+0x4c>
+			return m;
+		if (m == 0)
+  801d9a:	74 11                	je     801dad <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801d9c:	01 c3                	add    %eax,%ebx
+  801d9e:	89 d8                	mov    %ebx,%eax
+  801da0:	39 f3                	cmp    %esi,%ebx
+  801da2:	72 dc                	jb     801d80 <readn+0x1d>
+  801da4:	eb 09                	jmp    801daf <readn+0x4c>
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	eb 02                	jmp    801daf <readn+0x4c>
+  801dad:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801db2:	5b                   	pop    %ebx
+  801db3:	5e                   	pop    %esi
+  801db4:	5f                   	pop    %edi
+  801db5:	5d                   	pop    %ebp
+  801db6:	c3                   	ret
+
+00801db7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 18             	sub    $0x18,%esp
+  801dbf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dc5:	50                   	push   %eax
+  801dc6:	53                   	push   %ebx
+  801dc7:	e8 6f fc ff ff       	call   801a3b <fd_lookup>
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	85 c0                	test   %eax,%eax
+  801dd1:	78 37                	js     801e0a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dd3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+  801dd9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ddc:	50                   	push   %eax
+  801ddd:	ff 36                	push   (%esi)
+  801ddf:	e8 a9 fc ff ff       	call   801a8d <dev_lookup>
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	85 c0                	test   %eax,%eax
+  801de9:	78 1f                	js     801e0a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801deb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801def:	74 20                	je     801e11 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801df1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801df7:	85 c0                	test   %eax,%eax
+  801df9:	74 54                	je     801e4f <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801dfb:	83 ec 04             	sub    $0x4,%esp
+  801dfe:	ff 75 10             	push   0x10(%ebp)
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	56                   	push   %esi
+  801e05:	ff d0                	call   *%eax
+  801e07:	83 c4 10             	add    $0x10,%esp
+}
+  801e0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e0d:	5b                   	pop    %ebx
+  801e0e:	5e                   	pop    %esi
+  801e0f:	5d                   	pop    %ebp
+  801e10:	c3                   	ret
+  801e11:	89 e2                	mov    %esp,%edx
+  801e13:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e18:	29 d0                	sub    %edx,%eax
+  801e1a:	89 c2                	mov    %eax,%edx
+  801e1c:	c1 ea 0f             	shr    $0xf,%edx
+  801e1f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e29:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e2c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e33:	8b 40 48             	mov    0x48(%eax),%eax
+  801e36:	83 ec 04             	sub    $0x4,%esp
+  801e39:	53                   	push   %ebx
+  801e3a:	50                   	push   %eax
+  801e3b:	68 2d 4a 80 00       	push   $0x804a2d
+  801e40:	e8 75 e4 ff ff       	call   8002ba <cprintf>
+		return -E_INVAL;
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e4d:	eb bb                	jmp    801e0a <write+0x53>
+		return -E_NOT_SUPP;
+  801e4f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e54:	eb b4                	jmp    801e0a <write+0x53>
+
+00801e56 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e5f:	50                   	push   %eax
+  801e60:	ff 75 08             	push   0x8(%ebp)
+  801e63:	e8 d3 fb ff ff       	call   801a3b <fd_lookup>
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 0e                	js     801e7d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e75:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e7d:	c9                   	leave
+  801e7e:	c3                   	ret
+
+00801e7f <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	53                   	push   %ebx
+  801e83:	83 ec 1c             	sub    $0x1c,%esp
+  801e86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	ff 75 08             	push   0x8(%ebp)
+  801e90:	e8 a6 fb ff ff       	call   801a3b <fd_lookup>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 33                	js     801ecf <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801e9c:	83 fb 03             	cmp    $0x3,%ebx
+  801e9f:	74 28                	je     801ec9 <fcntl+0x4a>
+  801ea1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea6:	83 fb 04             	cmp    $0x4,%ebx
+  801ea9:	75 24                	jne    801ecf <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801eab:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801eae:	8b 41 08             	mov    0x8(%ecx),%eax
+  801eb1:	80 e4 ef             	and    $0xef,%ah
+  801eb4:	8b 55 10             	mov    0x10(%ebp),%edx
+  801eb7:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801ebd:	09 d0                	or     %edx,%eax
+  801ebf:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec7:	eb 06                	jmp    801ecf <fcntl+0x50>
+		return fd->fd_omode;
+  801ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ecc:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801ecf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+
+00801ed4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	56                   	push   %esi
+  801ed8:	53                   	push   %ebx
+  801ed9:	83 ec 18             	sub    $0x18,%esp
+  801edc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801edf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ee2:	50                   	push   %eax
+  801ee3:	53                   	push   %ebx
+  801ee4:	e8 52 fb ff ff       	call   801a3b <fd_lookup>
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	78 34                	js     801f24 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ef0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ef3:	83 ec 08             	sub    $0x8,%esp
+  801ef6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef9:	50                   	push   %eax
+  801efa:	ff 36                	push   (%esi)
+  801efc:	e8 8c fb ff ff       	call   801a8d <dev_lookup>
+  801f01:	83 c4 10             	add    $0x10,%esp
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 1c                	js     801f24 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f08:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f0c:	74 1d                	je     801f2b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f11:	8b 40 18             	mov    0x18(%eax),%eax
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	74 51                	je     801f69 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	ff 75 0c             	push   0xc(%ebp)
+  801f1e:	56                   	push   %esi
+  801f1f:	ff d0                	call   *%eax
+  801f21:	83 c4 10             	add    $0x10,%esp
+}
+  801f24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f27:	5b                   	pop    %ebx
+  801f28:	5e                   	pop    %esi
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+  801f2b:	89 e2                	mov    %esp,%edx
+  801f2d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f32:	29 d0                	sub    %edx,%eax
+  801f34:	89 c2                	mov    %eax,%edx
+  801f36:	c1 ea 0f             	shr    $0xf,%edx
+  801f39:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f43:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801f46:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801f4d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f50:	83 ec 04             	sub    $0x4,%esp
+  801f53:	53                   	push   %ebx
+  801f54:	50                   	push   %eax
+  801f55:	68 f0 49 80 00       	push   $0x8049f0
+  801f5a:	e8 5b e3 ff ff       	call   8002ba <cprintf>
+		return -E_INVAL;
+  801f5f:	83 c4 10             	add    $0x10,%esp
+  801f62:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f67:	eb bb                	jmp    801f24 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f69:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f6e:	eb b4                	jmp    801f24 <ftruncate+0x50>
+
+00801f70 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	56                   	push   %esi
+  801f74:	53                   	push   %ebx
+  801f75:	83 ec 18             	sub    $0x18,%esp
+  801f78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f7b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f7e:	50                   	push   %eax
+  801f7f:	ff 75 08             	push   0x8(%ebp)
+  801f82:	e8 b4 fa ff ff       	call   801a3b <fd_lookup>
+  801f87:	83 c4 10             	add    $0x10,%esp
+  801f8a:	85 c0                	test   %eax,%eax
+  801f8c:	78 53                	js     801fe1 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f8e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f91:	83 ec 08             	sub    $0x8,%esp
+  801f94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f97:	50                   	push   %eax
+  801f98:	ff 36                	push   (%esi)
+  801f9a:	e8 ee fa ff ff       	call   801a8d <dev_lookup>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 3b                	js     801fe1 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801fa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fa9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fad:	74 39                	je     801fe8 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801faf:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801fb2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801fb9:	00 00 00 
+	stat->st_isdir = 0;
+  801fbc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fc3:	00 00 00 
+	stat->st_version = 0;
+  801fc6:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801fcd:	00 00 00 
+	stat->st_dev = dev;
+  801fd0:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801fd6:	83 ec 08             	sub    $0x8,%esp
+  801fd9:	53                   	push   %ebx
+  801fda:	56                   	push   %esi
+  801fdb:	ff 50 14             	call   *0x14(%eax)
+  801fde:	83 c4 10             	add    $0x10,%esp
+}
+  801fe1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe4:	5b                   	pop    %ebx
+  801fe5:	5e                   	pop    %esi
+  801fe6:	5d                   	pop    %ebp
+  801fe7:	c3                   	ret
+		return -E_NOT_SUPP;
+  801fe8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fed:	eb f2                	jmp    801fe1 <fstat+0x71>
+
+00801fef <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801fef:	55                   	push   %ebp
+  801ff0:	89 e5                	mov    %esp,%ebp
+  801ff2:	56                   	push   %esi
+  801ff3:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801ff4:	83 ec 08             	sub    $0x8,%esp
+  801ff7:	6a 00                	push   $0x0
+  801ff9:	ff 75 08             	push   0x8(%ebp)
+  801ffc:	e8 b7 01 00 00       	call   8021b8 <open>
+  802001:	89 c3                	mov    %eax,%ebx
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 1b                	js     802025 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80200a:	83 ec 08             	sub    $0x8,%esp
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	50                   	push   %eax
+  802011:	e8 5a ff ff ff       	call   801f70 <fstat>
+  802016:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802018:	89 1c 24             	mov    %ebx,(%esp)
+  80201b:	e8 60 fb ff ff       	call   801b80 <close>
+	return r;
+  802020:	83 c4 10             	add    $0x10,%esp
+  802023:	89 f3                	mov    %esi,%ebx
+}
+  802025:	89 d8                	mov    %ebx,%eax
+  802027:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202a:	5b                   	pop    %ebx
+  80202b:	5e                   	pop    %esi
+  80202c:	5d                   	pop    %ebp
+  80202d:	c3                   	ret
+
+0080202e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	56                   	push   %esi
+  802032:	53                   	push   %ebx
+  802033:	89 c6                	mov    %eax,%esi
+  802035:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802037:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  80203e:	74 27                	je     802067 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802040:	6a 07                	push   $0x7
+  802042:	68 00 70 80 00       	push   $0x807000
+  802047:	56                   	push   %esi
+  802048:	ff 35 c4 66 80 00    	push   0x8066c4
+  80204e:	e8 c0 21 00 00       	call   804213 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802053:	83 c4 0c             	add    $0xc,%esp
+  802056:	6a 00                	push   $0x0
+  802058:	53                   	push   %ebx
+  802059:	6a 00                	push   $0x0
+  80205b:	e8 23 1f 00 00       	call   803f83 <ipc_recv>
+}
+  802060:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802063:	5b                   	pop    %ebx
+  802064:	5e                   	pop    %esi
+  802065:	5d                   	pop    %ebp
+  802066:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802067:	83 ec 0c             	sub    $0xc,%esp
+  80206a:	6a 02                	push   $0x2
+  80206c:	e8 0b 22 00 00       	call   80427c <ipc_find_env>
+  802071:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802076:	83 c4 10             	add    $0x10,%esp
+  802079:	eb c5                	jmp    802040 <fsipc+0x12>
+
+0080207b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80207b:	55                   	push   %ebp
+  80207c:	89 e5                	mov    %esp,%ebp
+  80207e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802081:	8b 45 08             	mov    0x8(%ebp),%eax
+  802084:	8b 40 0c             	mov    0xc(%eax),%eax
+  802087:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80208c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80208f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802094:	ba 00 00 00 00       	mov    $0x0,%edx
+  802099:	b8 02 00 00 00       	mov    $0x2,%eax
+  80209e:	e8 8b ff ff ff       	call   80202e <fsipc>
+}
+  8020a3:	c9                   	leave
+  8020a4:	c3                   	ret
+
+008020a5 <devfile_flush>:
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8020b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020bb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020c0:	e8 69 ff ff ff       	call   80202e <fsipc>
+}
+  8020c5:	c9                   	leave
+  8020c6:	c3                   	ret
+
+008020c7 <devfile_stat>:
+{
+  8020c7:	55                   	push   %ebp
+  8020c8:	89 e5                	mov    %esp,%ebp
+  8020ca:	53                   	push   %ebx
+  8020cb:	83 ec 04             	sub    $0x4,%esp
+  8020ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020e6:	e8 43 ff ff ff       	call   80202e <fsipc>
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 37                	js     802126 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020ef:	83 ec 08             	sub    $0x8,%esp
+  8020f2:	68 00 70 80 00       	push   $0x807000
+  8020f7:	53                   	push   %ebx
+  8020f8:	e8 b4 e8 ff ff       	call   8009b1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020fd:	a1 80 70 80 00       	mov    0x807080,%eax
+  802102:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802108:	a1 84 70 80 00       	mov    0x807084,%eax
+  80210d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802113:	a1 88 70 80 00       	mov    0x807088,%eax
+  802118:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802126:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802129:	c9                   	leave
+  80212a:	c3                   	ret
+
+0080212b <devfile_write>:
+{
+  80212b:	55                   	push   %ebp
+  80212c:	89 e5                	mov    %esp,%ebp
+  80212e:	83 ec 0c             	sub    $0xc,%esp
+  802131:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802134:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802139:	39 d0                	cmp    %edx,%eax
+  80213b:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80213e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802141:	8b 52 0c             	mov    0xc(%edx),%edx
+  802144:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80214a:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80214f:	50                   	push   %eax
+  802150:	ff 75 0c             	push   0xc(%ebp)
+  802153:	68 08 70 80 00       	push   $0x807008
+  802158:	e8 04 ea ff ff       	call   800b61 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80215d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802162:	b8 04 00 00 00       	mov    $0x4,%eax
+  802167:	e8 c2 fe ff ff       	call   80202e <fsipc>
+}
+  80216c:	c9                   	leave
+  80216d:	c3                   	ret
+
+0080216e <devfile_read>:
+{
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	53                   	push   %ebx
+  802172:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802175:	8b 45 08             	mov    0x8(%ebp),%eax
+  802178:	8b 40 0c             	mov    0xc(%eax),%eax
+  80217b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802180:	8b 45 10             	mov    0x10(%ebp),%eax
+  802183:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802188:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80218d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802192:	e8 97 fe ff ff       	call   80202e <fsipc>
+  802197:	89 c3                	mov    %eax,%ebx
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 14                	js     8021b1 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80219d:	83 ec 04             	sub    $0x4,%esp
+  8021a0:	50                   	push   %eax
+  8021a1:	68 00 70 80 00       	push   $0x807000
+  8021a6:	ff 75 0c             	push   0xc(%ebp)
+  8021a9:	e8 b3 e9 ff ff       	call   800b61 <memmove>
+	return r;
+  8021ae:	83 c4 10             	add    $0x10,%esp
+}
+  8021b1:	89 d8                	mov    %ebx,%eax
+  8021b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021b6:	c9                   	leave
+  8021b7:	c3                   	ret
+
+008021b8 <open>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	53                   	push   %ebx
+  8021bc:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8021bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c2:	50                   	push   %eax
+  8021c3:	e8 23 f8 ff ff       	call   8019eb <fd_alloc>
+  8021c8:	89 c3                	mov    %eax,%ebx
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 2a                	js     8021fb <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8021d1:	83 ec 0c             	sub    $0xc,%esp
+  8021d4:	ff 75 08             	push   0x8(%ebp)
+  8021d7:	e8 89 e7 ff ff       	call   800965 <strlen>
+  8021dc:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8021df:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8021e4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8021e9:	7e 17                	jle    802202 <open+0x4a>
+	fd_close(fd, 1);
+  8021eb:	83 ec 08             	sub    $0x8,%esp
+  8021ee:	6a 01                	push   $0x1
+  8021f0:	ff 75 f4             	push   -0xc(%ebp)
+  8021f3:	e8 08 f9 ff ff       	call   801b00 <fd_close>
+	return r;
+  8021f8:	83 c4 10             	add    $0x10,%esp
+}
+  8021fb:	89 d8                	mov    %ebx,%eax
+  8021fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802200:	c9                   	leave
+  802201:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802202:	83 ec 08             	sub    $0x8,%esp
+  802205:	ff 75 08             	push   0x8(%ebp)
+  802208:	68 00 70 80 00       	push   $0x807000
+  80220d:	e8 9f e7 ff ff       	call   8009b1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802212:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802215:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80221a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80221d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802222:	e8 07 fe ff ff       	call   80202e <fsipc>
+  802227:	89 c3                	mov    %eax,%ebx
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	78 bb                	js     8021eb <open+0x33>
+	return fd2num(fd); 	
+  802230:	83 ec 0c             	sub    $0xc,%esp
+  802233:	ff 75 f4             	push   -0xc(%ebp)
+  802236:	e8 89 f7 ff ff       	call   8019c4 <fd2num>
+  80223b:	89 c3                	mov    %eax,%ebx
+  80223d:	83 c4 10             	add    $0x10,%esp
+  802240:	eb b9                	jmp    8021fb <open+0x43>
+
+00802242 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802242:	55                   	push   %ebp
+  802243:	89 e5                	mov    %esp,%ebp
+  802245:	53                   	push   %ebx
+  802246:	83 ec 1c             	sub    $0x1c,%esp
+  802249:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80224c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224f:	50                   	push   %eax
+  802250:	ff 75 08             	push   0x8(%ebp)
+  802253:	e8 e3 f7 ff ff       	call   801a3b <fd_lookup>
+  802258:	83 c4 10             	add    $0x10,%esp
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	78 5a                	js     8022b9 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80225f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802262:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802268:	39 10                	cmp    %edx,(%eax)
+  80226a:	75 66                	jne    8022d2 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80226c:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802273:	74 49                	je     8022be <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802275:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802278:	8b 40 0c             	mov    0xc(%eax),%eax
+  80227b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802280:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802283:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802288:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80228e:	6a 07                	push   $0x7
+  802290:	68 00 70 80 00       	push   $0x807000
+  802295:	6a 09                	push   $0x9
+  802297:	ff 35 c4 66 80 00    	push   0x8066c4
+  80229d:	e8 71 1f 00 00       	call   804213 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8022a2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8022a9:	6a 00                	push   $0x0
+  8022ab:	53                   	push   %ebx
+  8022ac:	ff 75 10             	push   0x10(%ebp)
+  8022af:	6a 00                	push   $0x0
+  8022b1:	e8 9a 1d 00 00       	call   804050 <ipc_recv_pages>
+  8022b6:	83 c4 20             	add    $0x20,%esp
+}
+  8022b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bc:	c9                   	leave
+  8022bd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022be:	83 ec 0c             	sub    $0xc,%esp
+  8022c1:	6a 02                	push   $0x2
+  8022c3:	e8 b4 1f 00 00       	call   80427c <ipc_find_env>
+  8022c8:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	eb a3                	jmp    802275 <fmap+0x33>
+		return -E_INVAL;
+  8022d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022d7:	eb e0                	jmp    8022b9 <fmap+0x77>
+
+008022d9 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	53                   	push   %ebx
+  8022dd:	83 ec 10             	sub    $0x10,%esp
+  8022e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8022e3:	53                   	push   %ebx
+  8022e4:	e8 7c e6 ff ff       	call   800965 <strlen>
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022f1:	7f 25                	jg     802318 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8022f3:	83 ec 08             	sub    $0x8,%esp
+  8022f6:	53                   	push   %ebx
+  8022f7:	68 00 70 80 00       	push   $0x807000
+  8022fc:	e8 b0 e6 ff ff       	call   8009b1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802301:	ba 00 00 00 00       	mov    $0x0,%edx
+  802306:	b8 07 00 00 00       	mov    $0x7,%eax
+  80230b:	e8 1e fd ff ff       	call   80202e <fsipc>
+  802310:	83 c4 10             	add    $0x10,%esp
+}
+  802313:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802316:	c9                   	leave
+  802317:	c3                   	ret
+		return -E_BAD_PATH;
+  802318:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80231d:	eb f4                	jmp    802313 <remove+0x3a>
+
+0080231f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80232f:	e8 fa fc ff ff       	call   80202e <fsipc>
+}
+  802334:	c9                   	leave
+  802335:	c3                   	ret
+
+00802336 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802336:	55                   	push   %ebp
+  802337:	89 e5                	mov    %esp,%ebp
+  802339:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80233c:	68 60 4a 80 00       	push   $0x804a60
+  802341:	ff 75 0c             	push   0xc(%ebp)
+  802344:	e8 68 e6 ff ff       	call   8009b1 <strcpy>
+	return 0;
+}
+  802349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234e:	c9                   	leave
+  80234f:	c3                   	ret
+
+00802350 <devsock_close>:
+{
+  802350:	55                   	push   %ebp
+  802351:	89 e5                	mov    %esp,%ebp
+  802353:	53                   	push   %ebx
+  802354:	83 ec 10             	sub    $0x10,%esp
+  802357:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80235a:	53                   	push   %ebx
+  80235b:	e8 5b 1f 00 00       	call   8042bb <pageref>
+  802360:	89 c2                	mov    %eax,%edx
+  802362:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802365:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80236a:	83 fa 01             	cmp    $0x1,%edx
+  80236d:	74 05                	je     802374 <devsock_close+0x24>
+}
+  80236f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802374:	83 ec 0c             	sub    $0xc,%esp
+  802377:	ff 73 0c             	push   0xc(%ebx)
+  80237a:	e8 b0 05 00 00       	call   80292f <nsipc_close>
+  80237f:	83 c4 10             	add    $0x10,%esp
+  802382:	eb eb                	jmp    80236f <devsock_close+0x1f>
+
+00802384 <devsock_write>:
+{
+  802384:	55                   	push   %ebp
+  802385:	89 e5                	mov    %esp,%ebp
+  802387:	53                   	push   %ebx
+  802388:	83 ec 14             	sub    $0x14,%esp
+  80238b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80238e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802391:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802394:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802397:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80239a:	8b 41 08             	mov    0x8(%ecx),%eax
+  80239d:	c1 f8 09             	sar    $0x9,%eax
+  8023a0:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8023a3:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8023a9:	77 13                	ja     8023be <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8023ab:	50                   	push   %eax
+  8023ac:	52                   	push   %edx
+  8023ad:	53                   	push   %ebx
+  8023ae:	ff 71 0c             	push   0xc(%ecx)
+  8023b1:	e8 5c 06 00 00       	call   802a12 <nsipc_send>
+  8023b6:	83 c4 10             	add    $0x10,%esp
+}
+  8023b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023bc:	c9                   	leave
+  8023bd:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8023be:	50                   	push   %eax
+  8023bf:	6a 01                	push   $0x1
+  8023c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8023c4:	50                   	push   %eax
+  8023c5:	ff 71 0c             	push   0xc(%ecx)
+  8023c8:	e8 a6 06 00 00       	call   802a73 <nsipc_sendmsg>
+  8023cd:	83 c4 10             	add    $0x10,%esp
+  8023d0:	eb e7                	jmp    8023b9 <devsock_write+0x35>
+
+008023d2 <devsock_read>:
+{
+  8023d2:	55                   	push   %ebp
+  8023d3:	89 e5                	mov    %esp,%ebp
+  8023d5:	53                   	push   %ebx
+  8023d6:	83 ec 14             	sub    $0x14,%esp
+  8023d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023df:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8023e2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8023e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8023e8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8023eb:	c1 f8 09             	sar    $0x9,%eax
+  8023ee:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8023f1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8023f7:	77 13                	ja     80240c <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8023f9:	50                   	push   %eax
+  8023fa:	52                   	push   %edx
+  8023fb:	53                   	push   %ebx
+  8023fc:	ff 71 0c             	push   0xc(%ecx)
+  8023ff:	e8 9c 05 00 00       	call   8029a0 <nsipc_recv>
+  802404:	83 c4 10             	add    $0x10,%esp
+}
+  802407:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240a:	c9                   	leave
+  80240b:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80240c:	50                   	push   %eax
+  80240d:	6a 01                	push   $0x1
+  80240f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802412:	50                   	push   %eax
+  802413:	ff 71 0c             	push   0xc(%ecx)
+  802416:	e8 02 0a 00 00       	call   802e1d <nsipc_recvmsg>
+  80241b:	83 c4 10             	add    $0x10,%esp
+  80241e:	eb e7                	jmp    802407 <devsock_read+0x35>
+
+00802420 <fd2sockid>:
+{
+  802420:	55                   	push   %ebp
+  802421:	89 e5                	mov    %esp,%ebp
+  802423:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802426:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802429:	52                   	push   %edx
+  80242a:	50                   	push   %eax
+  80242b:	e8 0b f6 ff ff       	call   801a3b <fd_lookup>
+  802430:	83 c4 10             	add    $0x10,%esp
+  802433:	85 c0                	test   %eax,%eax
+  802435:	78 10                	js     802447 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80243a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802440:	39 08                	cmp    %ecx,(%eax)
+  802442:	75 05                	jne    802449 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802444:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802447:	c9                   	leave
+  802448:	c3                   	ret
+		return -E_NOT_SUPP;
+  802449:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80244e:	eb f7                	jmp    802447 <fd2sockid+0x27>
+
+00802450 <sock_flags>:
+{
+  802450:	55                   	push   %ebp
+  802451:	89 e5                	mov    %esp,%ebp
+  802453:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802456:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802459:	52                   	push   %edx
+  80245a:	50                   	push   %eax
+  80245b:	e8 db f5 ff ff       	call   801a3b <fd_lookup>
+  802460:	83 c4 10             	add    $0x10,%esp
+  802463:	85 c0                	test   %eax,%eax
+  802465:	78 0e                	js     802475 <sock_flags+0x25>
+  802467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80246a:	8b 40 08             	mov    0x8(%eax),%eax
+  80246d:	c1 e8 09             	shr    $0x9,%eax
+  802470:	83 e0 08             	and    $0x8,%eax
+}
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+		return 0;
+  802475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80247a:	eb f7                	jmp    802473 <sock_flags+0x23>
+
+0080247c <alloc_sockfd>:
+{
+  80247c:	55                   	push   %ebp
+  80247d:	89 e5                	mov    %esp,%ebp
+  80247f:	56                   	push   %esi
+  802480:	53                   	push   %ebx
+  802481:	83 ec 1c             	sub    $0x1c,%esp
+  802484:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802486:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802489:	50                   	push   %eax
+  80248a:	e8 5c f5 ff ff       	call   8019eb <fd_alloc>
+  80248f:	89 c3                	mov    %eax,%ebx
+  802491:	83 c4 10             	add    $0x10,%esp
+  802494:	85 c0                	test   %eax,%eax
+  802496:	78 43                	js     8024db <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802498:	83 ec 04             	sub    $0x4,%esp
+  80249b:	68 07 04 00 00       	push   $0x407
+  8024a0:	ff 75 f4             	push   -0xc(%ebp)
+  8024a3:	6a 00                	push   $0x0
+  8024a5:	e8 3b e9 ff ff       	call   800de5 <sys_page_alloc>
+  8024aa:	89 c3                	mov    %eax,%ebx
+  8024ac:	83 c4 10             	add    $0x10,%esp
+  8024af:	85 c0                	test   %eax,%eax
+  8024b1:	78 28                	js     8024db <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8024b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b6:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8024bc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8024be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024c1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8024c8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8024cb:	83 ec 0c             	sub    $0xc,%esp
+  8024ce:	50                   	push   %eax
+  8024cf:	e8 f0 f4 ff ff       	call   8019c4 <fd2num>
+  8024d4:	89 c3                	mov    %eax,%ebx
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	eb 0c                	jmp    8024e7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8024db:	83 ec 0c             	sub    $0xc,%esp
+  8024de:	56                   	push   %esi
+  8024df:	e8 4b 04 00 00       	call   80292f <nsipc_close>
+		return r;
+  8024e4:	83 c4 10             	add    $0x10,%esp
+}
+  8024e7:	89 d8                	mov    %ebx,%eax
+  8024e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ec:	5b                   	pop    %ebx
+  8024ed:	5e                   	pop    %esi
+  8024ee:	5d                   	pop    %ebp
+  8024ef:	c3                   	ret
+
+008024f0 <accept>:
+{
+  8024f0:	55                   	push   %ebp
+  8024f1:	89 e5                	mov    %esp,%ebp
+  8024f3:	56                   	push   %esi
+  8024f4:	53                   	push   %ebx
+  8024f5:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8024f8:	89 f0                	mov    %esi,%eax
+  8024fa:	e8 21 ff ff ff       	call   802420 <fd2sockid>
+  8024ff:	89 c3                	mov    %eax,%ebx
+  802501:	85 c0                	test   %eax,%eax
+  802503:	78 24                	js     802529 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802505:	89 f0                	mov    %esi,%eax
+  802507:	e8 44 ff ff ff       	call   802450 <sock_flags>
+  80250c:	50                   	push   %eax
+  80250d:	ff 75 10             	push   0x10(%ebp)
+  802510:	ff 75 0c             	push   0xc(%ebp)
+  802513:	53                   	push   %ebx
+  802514:	e8 6b 03 00 00       	call   802884 <nsipc_accept>
+  802519:	89 c3                	mov    %eax,%ebx
+  80251b:	83 c4 10             	add    $0x10,%esp
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	78 07                	js     802529 <accept+0x39>
+	return alloc_sockfd(r);
+  802522:	e8 55 ff ff ff       	call   80247c <alloc_sockfd>
+  802527:	89 c3                	mov    %eax,%ebx
+}
+  802529:	89 d8                	mov    %ebx,%eax
+  80252b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80252e:	5b                   	pop    %ebx
+  80252f:	5e                   	pop    %esi
+  802530:	5d                   	pop    %ebp
+  802531:	c3                   	ret
+
+00802532 <bind>:
+{
+  802532:	55                   	push   %ebp
+  802533:	89 e5                	mov    %esp,%ebp
+  802535:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802538:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253b:	e8 e0 fe ff ff       	call   802420 <fd2sockid>
+  802540:	85 c0                	test   %eax,%eax
+  802542:	78 12                	js     802556 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802544:	83 ec 04             	sub    $0x4,%esp
+  802547:	ff 75 10             	push   0x10(%ebp)
+  80254a:	ff 75 0c             	push   0xc(%ebp)
+  80254d:	50                   	push   %eax
+  80254e:	e8 85 03 00 00       	call   8028d8 <nsipc_bind>
+  802553:	83 c4 10             	add    $0x10,%esp
+}
+  802556:	c9                   	leave
+  802557:	c3                   	ret
+
+00802558 <shutdown>:
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80255e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802561:	e8 ba fe ff ff       	call   802420 <fd2sockid>
+  802566:	85 c0                	test   %eax,%eax
+  802568:	78 0f                	js     802579 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80256a:	83 ec 08             	sub    $0x8,%esp
+  80256d:	ff 75 0c             	push   0xc(%ebp)
+  802570:	50                   	push   %eax
+  802571:	e8 97 03 00 00       	call   80290d <nsipc_shutdown>
+  802576:	83 c4 10             	add    $0x10,%esp
+}
+  802579:	c9                   	leave
+  80257a:	c3                   	ret
+
+0080257b <connect>:
+{
+  80257b:	55                   	push   %ebp
+  80257c:	89 e5                	mov    %esp,%ebp
+  80257e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802581:	8b 45 08             	mov    0x8(%ebp),%eax
+  802584:	e8 97 fe ff ff       	call   802420 <fd2sockid>
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	78 12                	js     80259f <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80258d:	83 ec 04             	sub    $0x4,%esp
+  802590:	ff 75 10             	push   0x10(%ebp)
+  802593:	ff 75 0c             	push   0xc(%ebp)
+  802596:	50                   	push   %eax
+  802597:	e8 ad 03 00 00       	call   802949 <nsipc_connect>
+  80259c:	83 c4 10             	add    $0x10,%esp
+}
+  80259f:	c9                   	leave
+  8025a0:	c3                   	ret
+
+008025a1 <listen>:
+{
+  8025a1:	55                   	push   %ebp
+  8025a2:	89 e5                	mov    %esp,%ebp
+  8025a4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025aa:	e8 71 fe ff ff       	call   802420 <fd2sockid>
+  8025af:	85 c0                	test   %eax,%eax
+  8025b1:	78 0f                	js     8025c2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8025b3:	83 ec 08             	sub    $0x8,%esp
+  8025b6:	ff 75 0c             	push   0xc(%ebp)
+  8025b9:	50                   	push   %eax
+  8025ba:	e8 bf 03 00 00       	call   80297e <nsipc_listen>
+  8025bf:	83 c4 10             	add    $0x10,%esp
+}
+  8025c2:	c9                   	leave
+  8025c3:	c3                   	ret
+
+008025c4 <sendmsg>:
+{
+  8025c4:	55                   	push   %ebp
+  8025c5:	89 e5                	mov    %esp,%ebp
+  8025c7:	57                   	push   %edi
+  8025c8:	56                   	push   %esi
+  8025c9:	53                   	push   %ebx
+  8025ca:	83 ec 0c             	sub    $0xc,%esp
+  8025cd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025d0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8025d3:	89 f0                	mov    %esi,%eax
+  8025d5:	e8 46 fe ff ff       	call   802420 <fd2sockid>
+  8025da:	89 c3                	mov    %eax,%ebx
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	78 1c                	js     8025fc <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8025e0:	89 f0                	mov    %esi,%eax
+  8025e2:	e8 69 fe ff ff       	call   802450 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8025e7:	0b 45 10             	or     0x10(%ebp),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	ff 77 0c             	push   0xc(%edi)
+  8025ee:	ff 77 08             	push   0x8(%edi)
+  8025f1:	53                   	push   %ebx
+  8025f2:	e8 7c 04 00 00       	call   802a73 <nsipc_sendmsg>
+  8025f7:	89 c3                	mov    %eax,%ebx
+  8025f9:	83 c4 10             	add    $0x10,%esp
+}
+  8025fc:	89 d8                	mov    %ebx,%eax
+  8025fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802601:	5b                   	pop    %ebx
+  802602:	5e                   	pop    %esi
+  802603:	5f                   	pop    %edi
+  802604:	5d                   	pop    %ebp
+  802605:	c3                   	ret
+
+00802606 <recvmsg>:
+{
+  802606:	55                   	push   %ebp
+  802607:	89 e5                	mov    %esp,%ebp
+  802609:	57                   	push   %edi
+  80260a:	56                   	push   %esi
+  80260b:	53                   	push   %ebx
+  80260c:	83 ec 0c             	sub    $0xc,%esp
+  80260f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802612:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802615:	89 f8                	mov    %edi,%eax
+  802617:	e8 04 fe ff ff       	call   802420 <fd2sockid>
+  80261c:	89 c3                	mov    %eax,%ebx
+  80261e:	85 c0                	test   %eax,%eax
+  802620:	78 2a                	js     80264c <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802622:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802629:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802630:	89 f8                	mov    %edi,%eax
+  802632:	e8 19 fe ff ff       	call   802450 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802637:	0b 45 10             	or     0x10(%ebp),%eax
+  80263a:	50                   	push   %eax
+  80263b:	ff 76 0c             	push   0xc(%esi)
+  80263e:	ff 76 08             	push   0x8(%esi)
+  802641:	53                   	push   %ebx
+  802642:	e8 d6 07 00 00       	call   802e1d <nsipc_recvmsg>
+  802647:	89 c3                	mov    %eax,%ebx
+  802649:	83 c4 10             	add    $0x10,%esp
+}
+  80264c:	89 d8                	mov    %ebx,%eax
+  80264e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802651:	5b                   	pop    %ebx
+  802652:	5e                   	pop    %esi
+  802653:	5f                   	pop    %edi
+  802654:	5d                   	pop    %ebp
+  802655:	c3                   	ret
+
+00802656 <sendfile>:
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	56                   	push   %esi
+  80265a:	53                   	push   %ebx
+  80265b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80265e:	89 f0                	mov    %esi,%eax
+  802660:	e8 bb fd ff ff       	call   802420 <fd2sockid>
+  802665:	89 c3                	mov    %eax,%ebx
+  802667:	85 c0                	test   %eax,%eax
+  802669:	78 1f                	js     80268a <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80266b:	89 f0                	mov    %esi,%eax
+  80266d:	e8 de fd ff ff       	call   802450 <sock_flags>
+  802672:	83 ec 0c             	sub    $0xc,%esp
+  802675:	50                   	push   %eax
+  802676:	ff 75 14             	push   0x14(%ebp)
+  802679:	ff 75 10             	push   0x10(%ebp)
+  80267c:	ff 75 0c             	push   0xc(%ebp)
+  80267f:	53                   	push   %ebx
+  802680:	e8 64 06 00 00       	call   802ce9 <nsipc_sendfile>
+  802685:	89 c3                	mov    %eax,%ebx
+  802687:	83 c4 20             	add    $0x20,%esp
+}
+  80268a:	89 d8                	mov    %ebx,%eax
+  80268c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80268f:	5b                   	pop    %ebx
+  802690:	5e                   	pop    %esi
+  802691:	5d                   	pop    %ebp
+  802692:	c3                   	ret
+
+00802693 <evctl>:
+{
+  802693:	55                   	push   %ebp
+  802694:	89 e5                	mov    %esp,%ebp
+  802696:	53                   	push   %ebx
+  802697:	83 ec 04             	sub    $0x4,%esp
+  80269a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80269d:	89 d8                	mov    %ebx,%eax
+  80269f:	e8 7c fd ff ff       	call   802420 <fd2sockid>
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	78 10                	js     8026b8 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8026a8:	83 ec 04             	sub    $0x4,%esp
+  8026ab:	53                   	push   %ebx
+  8026ac:	ff 75 0c             	push   0xc(%ebp)
+  8026af:	50                   	push   %eax
+  8026b0:	e8 d2 0b 00 00       	call   803287 <nsipc_evctl>
+  8026b5:	83 c4 10             	add    $0x10,%esp
+}
+  8026b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026bb:	c9                   	leave
+  8026bc:	c3                   	ret
+
+008026bd <evwait>:
+{
+  8026bd:	55                   	push   %ebp
+  8026be:	89 e5                	mov    %esp,%ebp
+  8026c0:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8026c3:	ff 75 10             	push   0x10(%ebp)
+  8026c6:	ff 75 0c             	push   0xc(%ebp)
+  8026c9:	ff 75 08             	push   0x8(%ebp)
+  8026cc:	e8 e0 0b 00 00       	call   8032b1 <nsipc_evwait>
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8026d9:	ff 75 10             	push   0x10(%ebp)
+  8026dc:	ff 75 0c             	push   0xc(%ebp)
+  8026df:	ff 75 08             	push   0x8(%ebp)
+  8026e2:	e8 31 0c 00 00       	call   803318 <nsipc_socket>
+  8026e7:	83 c4 10             	add    $0x10,%esp
+  8026ea:	85 c0                	test   %eax,%eax
+  8026ec:	78 05                	js     8026f3 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8026ee:	e8 89 fd ff ff       	call   80247c <alloc_sockfd>
+}
+  8026f3:	c9                   	leave
+  8026f4:	c3                   	ret
+
+008026f5 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8026f5:	55                   	push   %ebp
+  8026f6:	89 e5                	mov    %esp,%ebp
+  8026f8:	53                   	push   %ebx
+  8026f9:	83 ec 04             	sub    $0x4,%esp
+  8026fc:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8026fe:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802705:	74 26                	je     80272d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802707:	6a 07                	push   $0x7
+  802709:	68 00 80 80 00       	push   $0x808000
+  80270e:	53                   	push   %ebx
+  80270f:	ff 35 e4 69 80 00    	push   0x8069e4
+  802715:	e8 f9 1a 00 00       	call   804213 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80271a:	83 c4 0c             	add    $0xc,%esp
+  80271d:	6a 00                	push   $0x0
+  80271f:	6a 00                	push   $0x0
+  802721:	6a 00                	push   $0x0
+  802723:	e8 5b 18 00 00       	call   803f83 <ipc_recv>
+}
+  802728:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80272d:	83 ec 0c             	sub    $0xc,%esp
+  802730:	6a 03                	push   $0x3
+  802732:	e8 45 1b 00 00       	call   80427c <ipc_find_env>
+  802737:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	eb c6                	jmp    802707 <nsipc+0x12>
+
+00802741 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	56                   	push   %esi
+  802745:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802746:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  80274c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802751:	85 f6                	test   %esi,%esi
+  802753:	75 33                	jne    802788 <nsbulk_map+0x47>
+  802755:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80275a:	83 ec 04             	sub    $0x4,%esp
+  80275d:	6a 07                	push   $0x7
+  80275f:	53                   	push   %ebx
+  802760:	6a 00                	push   $0x0
+  802762:	e8 7e e6 ff ff       	call   800de5 <sys_page_alloc>
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	78 1a                	js     802788 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80276e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802774:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80277a:	75 de                	jne    80275a <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80277c:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802783:	00 00 00 
+	return 0;
+  802786:	89 f0                	mov    %esi,%eax
+}
+  802788:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80278b:	5b                   	pop    %ebx
+  80278c:	5e                   	pop    %esi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+
+0080278f <nsbulk_own>:
+{
+  80278f:	55                   	push   %ebp
+  802790:	89 e5                	mov    %esp,%ebp
+  802792:	57                   	push   %edi
+  802793:	56                   	push   %esi
+  802794:	53                   	push   %ebx
+  802795:	83 ec 0c             	sub    $0xc,%esp
+  802798:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80279a:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80279d:	85 d2                	test   %edx,%edx
+  80279f:	7f 0e                	jg     8027af <nsbulk_own+0x20>
+	return 0;
+  8027a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a6:	eb 47                	jmp    8027ef <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8027a8:	83 c3 01             	add    $0x1,%ebx
+  8027ab:	39 fb                	cmp    %edi,%ebx
+  8027ad:	7d 3b                	jge    8027ea <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8027af:	be 01 00 00 00       	mov    $0x1,%esi
+  8027b4:	89 d9                	mov    %ebx,%ecx
+  8027b6:	d3 e6                	shl    %cl,%esi
+  8027b8:	89 f0                	mov    %esi,%eax
+  8027ba:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  8027c0:	74 e6                	je     8027a8 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8027c2:	83 ec 04             	sub    $0x4,%esp
+  8027c5:	6a 07                	push   $0x7
+  8027c7:	89 d8                	mov    %ebx,%eax
+  8027c9:	c1 e0 0c             	shl    $0xc,%eax
+  8027cc:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8027d1:	50                   	push   %eax
+  8027d2:	6a 00                	push   $0x0
+  8027d4:	e8 0c e6 ff ff       	call   800de5 <sys_page_alloc>
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	78 0f                	js     8027ef <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8027e0:	f7 d6                	not    %esi
+  8027e2:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  8027e8:	eb be                	jmp    8027a8 <nsbulk_own+0x19>
+	return 0;
+  8027ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027f2:	5b                   	pop    %ebx
+  8027f3:	5e                   	pop    %esi
+  8027f4:	5f                   	pop    %edi
+  8027f5:	5d                   	pop    %ebp
+  8027f6:	c3                   	ret
+
+008027f7 <nsipc_bulk>:
+{
+  8027f7:	55                   	push   %ebp
+  8027f8:	89 e5                	mov    %esp,%ebp
+  8027fa:	57                   	push   %edi
+  8027fb:	56                   	push   %esi
+  8027fc:	53                   	push   %ebx
+  8027fd:	83 ec 1c             	sub    $0x1c,%esp
+  802800:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802803:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802805:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80280b:	c1 fb 0c             	sar    $0xc,%ebx
+  80280e:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802811:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802818:	74 56                	je     802870 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80281a:	85 ff                	test   %edi,%edi
+  80281c:	7e 24                	jle    802842 <nsipc_bulk+0x4b>
+  80281e:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802824:	74 1c                	je     802842 <nsipc_bulk+0x4b>
+  802826:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80282c:	c1 e3 0c             	shl    $0xc,%ebx
+  80282f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802834:	0f b6 10             	movzbl (%eax),%edx
+  802837:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802839:	05 00 10 00 00       	add    $0x1000,%eax
+  80283e:	39 d8                	cmp    %ebx,%eax
+  802840:	75 f2                	jne    802834 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802842:	83 ec 0c             	sub    $0xc,%esp
+  802845:	56                   	push   %esi
+  802846:	57                   	push   %edi
+  802847:	68 00 00 00 e0       	push   $0xe0000000
+  80284c:	ff 75 e4             	push   -0x1c(%ebp)
+  80284f:	ff 35 e4 69 80 00    	push   0x8069e4
+  802855:	e8 ed 19 00 00       	call   804247 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80285a:	83 c4 1c             	add    $0x1c,%esp
+  80285d:	6a 00                	push   $0x0
+  80285f:	6a 00                	push   $0x0
+  802861:	6a 00                	push   $0x0
+  802863:	e8 1b 17 00 00       	call   803f83 <ipc_recv>
+}
+  802868:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286b:	5b                   	pop    %ebx
+  80286c:	5e                   	pop    %esi
+  80286d:	5f                   	pop    %edi
+  80286e:	5d                   	pop    %ebp
+  80286f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802870:	83 ec 0c             	sub    $0xc,%esp
+  802873:	6a 03                	push   $0x3
+  802875:	e8 02 1a 00 00       	call   80427c <ipc_find_env>
+  80287a:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	eb 96                	jmp    80281a <nsipc_bulk+0x23>
+
+00802884 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	53                   	push   %ebx
+  802888:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80288b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802893:	8b 45 14             	mov    0x14(%ebp),%eax
+  802896:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80289b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028a0:	e8 50 fe ff ff       	call   8026f5 <nsipc>
+  8028a5:	89 c3                	mov    %eax,%ebx
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	79 07                	jns    8028b2 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028ab:	89 d8                	mov    %ebx,%eax
+  8028ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028b0:	c9                   	leave
+  8028b1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028b2:	83 ec 04             	sub    $0x4,%esp
+  8028b5:	ff 35 10 80 80 00    	push   0x808010
+  8028bb:	68 00 80 80 00       	push   $0x808000
+  8028c0:	ff 75 0c             	push   0xc(%ebp)
+  8028c3:	e8 99 e2 ff ff       	call   800b61 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028c8:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8028ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028d1:	89 10                	mov    %edx,(%eax)
+  8028d3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028d6:	eb d3                	jmp    8028ab <nsipc_accept+0x27>
+
+008028d8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	53                   	push   %ebx
+  8028dc:	83 ec 08             	sub    $0x8,%esp
+  8028df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028ea:	53                   	push   %ebx
+  8028eb:	ff 75 0c             	push   0xc(%ebp)
+  8028ee:	68 04 80 80 00       	push   $0x808004
+  8028f3:	e8 69 e2 ff ff       	call   800b61 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028f8:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  802903:	e8 ed fd ff ff       	call   8026f5 <nsipc>
+}
+  802908:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80290b:	c9                   	leave
+  80290c:	c3                   	ret
+
+0080290d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80290d:	55                   	push   %ebp
+  80290e:	89 e5                	mov    %esp,%ebp
+  802910:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802913:	8b 45 08             	mov    0x8(%ebp),%eax
+  802916:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80291b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80291e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802923:	b8 03 00 00 00       	mov    $0x3,%eax
+  802928:	e8 c8 fd ff ff       	call   8026f5 <nsipc>
+}
+  80292d:	c9                   	leave
+  80292e:	c3                   	ret
+
+0080292f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802935:	8b 45 08             	mov    0x8(%ebp),%eax
+  802938:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80293d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802942:	e8 ae fd ff ff       	call   8026f5 <nsipc>
+}
+  802947:	c9                   	leave
+  802948:	c3                   	ret
+
+00802949 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802949:	55                   	push   %ebp
+  80294a:	89 e5                	mov    %esp,%ebp
+  80294c:	53                   	push   %ebx
+  80294d:	83 ec 08             	sub    $0x8,%esp
+  802950:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802953:	8b 45 08             	mov    0x8(%ebp),%eax
+  802956:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80295b:	53                   	push   %ebx
+  80295c:	ff 75 0c             	push   0xc(%ebp)
+  80295f:	68 04 80 80 00       	push   $0x808004
+  802964:	e8 f8 e1 ff ff       	call   800b61 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802969:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80296f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802974:	e8 7c fd ff ff       	call   8026f5 <nsipc>
+}
+  802979:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80297c:	c9                   	leave
+  80297d:	c3                   	ret
+
+0080297e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80297e:	55                   	push   %ebp
+  80297f:	89 e5                	mov    %esp,%ebp
+  802981:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802984:	8b 45 08             	mov    0x8(%ebp),%eax
+  802987:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80298c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80298f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802994:	b8 06 00 00 00       	mov    $0x6,%eax
+  802999:	e8 57 fd ff ff       	call   8026f5 <nsipc>
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+008029a0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	56                   	push   %esi
+  8029a4:	53                   	push   %ebx
+  8029a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8029a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ab:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029b0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8029b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029be:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029c3:	e8 2d fd ff ff       	call   8026f5 <nsipc>
+  8029c8:	89 c3                	mov    %eax,%ebx
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	78 22                	js     8029f0 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029ce:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029d3:	39 c6                	cmp    %eax,%esi
+  8029d5:	0f 4e c6             	cmovle %esi,%eax
+  8029d8:	39 c3                	cmp    %eax,%ebx
+  8029da:	7f 1d                	jg     8029f9 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029dc:	83 ec 04             	sub    $0x4,%esp
+  8029df:	53                   	push   %ebx
+  8029e0:	68 00 80 80 00       	push   $0x808000
+  8029e5:	ff 75 0c             	push   0xc(%ebp)
+  8029e8:	e8 74 e1 ff ff       	call   800b61 <memmove>
+  8029ed:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029f0:	89 d8                	mov    %ebx,%eax
+  8029f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029f5:	5b                   	pop    %ebx
+  8029f6:	5e                   	pop    %esi
+  8029f7:	5d                   	pop    %ebp
+  8029f8:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029f9:	68 6c 4a 80 00       	push   $0x804a6c
+  8029fe:	68 81 4a 80 00       	push   $0x804a81
+  802a03:	68 b2 00 00 00       	push   $0xb2
+  802a08:	68 96 4a 80 00       	push   $0x804a96
+  802a0d:	e8 cd d7 ff ff       	call   8001df <_panic>
+
+00802a12 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	53                   	push   %ebx
+  802a16:	83 ec 04             	sub    $0x4,%esp
+  802a19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a24:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a2a:	7f 2e                	jg     802a5a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a2c:	83 ec 04             	sub    $0x4,%esp
+  802a2f:	53                   	push   %ebx
+  802a30:	ff 75 0c             	push   0xc(%ebp)
+  802a33:	68 0c 80 80 00       	push   $0x80800c
+  802a38:	e8 24 e1 ff ff       	call   800b61 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a3d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a43:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a46:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a4b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a50:	e8 a0 fc ff ff       	call   8026f5 <nsipc>
+}
+  802a55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+	assert(size < 1600);
+  802a5a:	68 a2 4a 80 00       	push   $0x804aa2
+  802a5f:	68 81 4a 80 00       	push   $0x804a81
+  802a64:	68 bd 00 00 00       	push   $0xbd
+  802a69:	68 96 4a 80 00       	push   $0x804a96
+  802a6e:	e8 6c d7 ff ff       	call   8001df <_panic>
+
+00802a73 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	57                   	push   %edi
+  802a77:	56                   	push   %esi
+  802a78:	53                   	push   %ebx
+  802a79:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802a7c:	e8 c0 fc ff ff       	call   802741 <nsbulk_map>
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	78 55                	js     802ada <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802a85:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802a8c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802a93:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802a9a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a9d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802aa0:	0f 8d 24 02 00 00    	jge    802cca <nsipc_sendmsg+0x257>
+  802aa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aa9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802aac:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802aaf:	89 d8                	mov    %ebx,%eax
+  802ab1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802ab6:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802ab8:	83 ec 0c             	sub    $0xc,%esp
+  802abb:	68 e0 66 80 00       	push   $0x8066e0
+  802ac0:	e8 5a 0f 00 00       	call   803a1f <pgbatch_init>
+  802ac5:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ac8:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802aca:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802acd:	e9 82 00 00 00       	jmp    802b54 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802ad2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ad5:	85 db                	test   %ebx,%ebx
+  802ad7:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802ada:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802add:	5b                   	pop    %ebx
+  802ade:	5e                   	pop    %esi
+  802adf:	5f                   	pop    %edi
+  802ae0:	5d                   	pop    %ebp
+  802ae1:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802ae2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802ae7:	29 c8                	sub    %ecx,%eax
+  802ae9:	39 d0                	cmp    %edx,%eax
+  802aeb:	0f 46 d0             	cmovbe %eax,%edx
+  802aee:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802af0:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802af6:	85 ff                	test   %edi,%edi
+  802af8:	0f 49 c7             	cmovns %edi,%eax
+  802afb:	c1 f8 0c             	sar    $0xc,%eax
+  802afe:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b03:	e8 87 fc ff ff       	call   80278f <nsbulk_own>
+  802b08:	85 c0                	test   %eax,%eax
+  802b0a:	0f 88 17 01 00 00    	js     802c27 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802b10:	83 ec 04             	sub    $0x4,%esp
+  802b13:	56                   	push   %esi
+  802b14:	ff 75 e0             	push   -0x20(%ebp)
+  802b17:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b1a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b1f:	50                   	push   %eax
+  802b20:	e8 3c e0 ff ff       	call   800b61 <memmove>
+  802b25:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802b28:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802b2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b2e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802b31:	0f 84 fd 00 00 00    	je     802c34 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802b37:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802b3a:	01 f7                	add    %esi,%edi
+  802b3c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802b3f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802b42:	0f 8d 01 01 00 00    	jge    802c49 <nsipc_sendmsg+0x1d6>
+  802b48:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802b4e:	0f 8f f0 00 00 00    	jg     802c44 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b57:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802b5a:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802b5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b60:	89 c2                	mov    %eax,%edx
+  802b62:	03 13                	add    (%ebx),%edx
+  802b64:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802b67:	8b 73 04             	mov    0x4(%ebx),%esi
+  802b6a:	29 c6                	sub    %eax,%esi
+  802b6c:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802b71:	29 f9                	sub    %edi,%ecx
+  802b73:	39 ce                	cmp    %ecx,%esi
+  802b75:	89 ca                	mov    %ecx,%edx
+  802b77:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802b7a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802b7d:	89 f9                	mov    %edi,%ecx
+  802b7f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802b85:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b88:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b8d:	09 c8                	or     %ecx,%eax
+  802b8f:	0f 85 4d ff ff ff    	jne    802ae2 <nsipc_sendmsg+0x6f>
+  802b95:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802b9b:	0f 86 41 ff ff ff    	jbe    802ae2 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ba1:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ba7:	85 ff                	test   %edi,%edi
+  802ba9:	0f 49 c7             	cmovns %edi,%eax
+  802bac:	c1 f8 0c             	sar    $0xc,%eax
+  802baf:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802bb1:	89 d1                	mov    %edx,%ecx
+  802bb3:	c1 e9 0c             	shr    $0xc,%ecx
+  802bb6:	01 c8                	add    %ecx,%eax
+  802bb8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802bbb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802bbe:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802bc0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802bc3:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802bc8:	29 c8                	sub    %ecx,%eax
+  802bca:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bcd:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802bd0:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802bd2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bd7:	89 f9                	mov    %edi,%ecx
+  802bd9:	d3 e0                	shl    %cl,%eax
+  802bdb:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802be1:	83 ec 08             	sub    $0x8,%esp
+  802be4:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802be6:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802be9:	50                   	push   %eax
+  802bea:	6a 00                	push   $0x0
+  802bec:	56                   	push   %esi
+  802bed:	6a 00                	push   $0x0
+  802bef:	68 e0 66 80 00       	push   $0x8066e0
+  802bf4:	e8 e4 0e 00 00       	call   803add <pgbatch_map>
+  802bf9:	83 c4 20             	add    $0x20,%esp
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	0f 88 ce fe ff ff    	js     802ad2 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802c04:	83 c7 01             	add    $0x1,%edi
+  802c07:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c0d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c10:	39 c7                	cmp    %eax,%edi
+  802c12:	75 be                	jne    802bd2 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802c14:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802c17:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802c1a:	89 d6                	mov    %edx,%esi
+  802c1c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802c22:	e9 01 ff ff ff       	jmp    802b28 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802c27:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802c2a:	85 db                	test   %ebx,%ebx
+  802c2c:	0f 45 c3             	cmovne %ebx,%eax
+  802c2f:	e9 a6 fe ff ff       	jmp    802ada <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802c34:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802c38:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802c3f:	e9 f3 fe ff ff       	jmp    802b37 <nsipc_sendmsg+0xc4>
+  802c44:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802c47:	eb 03                	jmp    802c4c <nsipc_sendmsg+0x1d9>
+  802c49:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802c4c:	83 ec 0c             	sub    $0xc,%esp
+  802c4f:	68 e0 66 80 00       	push   $0x8066e0
+  802c54:	e8 d4 0d 00 00       	call   803a2d <pgbatch_flush>
+  802c59:	83 c4 10             	add    $0x10,%esp
+  802c5c:	85 c0                	test   %eax,%eax
+  802c5e:	78 50                	js     802cb0 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802c60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c63:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802c68:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802c6e:	89 fb                	mov    %edi,%ebx
+  802c70:	29 f3                	sub    %esi,%ebx
+  802c72:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802c78:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c7b:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802c80:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802c85:	89 fa                	mov    %edi,%edx
+  802c87:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802c8c:	e8 66 fb ff ff       	call   8027f7 <nsipc_bulk>
+  802c91:	85 c0                	test   %eax,%eax
+  802c93:	78 28                	js     802cbd <nsipc_sendmsg+0x24a>
+		sent += r;
+  802c95:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802c98:	39 c3                	cmp    %eax,%ebx
+  802c9a:	75 0c                	jne    802ca8 <nsipc_sendmsg+0x235>
+  802c9c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c9f:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802ca2:	0f 8f f2 fd ff ff    	jg     802a9a <nsipc_sendmsg+0x27>
+		sent += r;
+  802ca8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802cab:	e9 2a fe ff ff       	jmp    802ada <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802cb0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802cb3:	85 db                	test   %ebx,%ebx
+  802cb5:	0f 45 c3             	cmovne %ebx,%eax
+  802cb8:	e9 1d fe ff ff       	jmp    802ada <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802cbd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802cc0:	85 db                	test   %ebx,%ebx
+  802cc2:	0f 45 c3             	cmovne %ebx,%eax
+  802cc5:	e9 10 fe ff ff       	jmp    802ada <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802cca:	83 ec 0c             	sub    $0xc,%esp
+  802ccd:	68 e0 66 80 00       	push   $0x8066e0
+  802cd2:	e8 48 0d 00 00       	call   803a1f <pgbatch_init>
+  802cd7:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802cda:	be 00 00 00 00       	mov    $0x0,%esi
+  802cdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce4:	e9 63 ff ff ff       	jmp    802c4c <nsipc_sendmsg+0x1d9>
+
+00802ce9 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802ce9:	55                   	push   %ebp
+  802cea:	89 e5                	mov    %esp,%ebp
+  802cec:	57                   	push   %edi
+  802ced:	56                   	push   %esi
+  802cee:	53                   	push   %ebx
+  802cef:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802cf2:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802cf9:	0f 84 c8 00 00 00    	je     802dc7 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802cff:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802d06:	0f 84 e4 00 00 00    	je     802df0 <nsipc_sendfile+0x107>
+{
+  802d0c:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802d11:	89 fb                	mov    %edi,%ebx
+  802d13:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802d16:	0f 83 f0 00 00 00    	jae    802e0c <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802d1c:	89 fa                	mov    %edi,%edx
+  802d1e:	03 55 10             	add    0x10(%ebp),%edx
+  802d21:	89 d0                	mov    %edx,%eax
+  802d23:	c1 f8 1f             	sar    $0x1f,%eax
+  802d26:	c1 e8 14             	shr    $0x14,%eax
+  802d29:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802d2c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802d32:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802d34:	6a 10                	push   $0x10
+  802d36:	68 00 20 01 e0       	push   $0xe0012000
+  802d3b:	52                   	push   %edx
+  802d3c:	ff 75 0c             	push   0xc(%ebp)
+  802d3f:	e8 fe f4 ff ff       	call   802242 <fmap>
+  802d44:	83 c4 10             	add    $0x10,%esp
+  802d47:	85 c0                	test   %eax,%eax
+  802d49:	0f 8e b8 00 00 00    	jle    802e07 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802d4f:	39 c6                	cmp    %eax,%esi
+  802d51:	0f 8d b5 00 00 00    	jge    802e0c <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802d57:	29 f0                	sub    %esi,%eax
+  802d59:	8b 55 14             	mov    0x14(%ebp),%edx
+  802d5c:	29 da                	sub    %ebx,%edx
+  802d5e:	39 d0                	cmp    %edx,%eax
+  802d60:	89 d3                	mov    %edx,%ebx
+  802d62:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d68:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802d6d:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802d73:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802d79:	8b 45 18             	mov    0x18(%ebp),%eax
+  802d7c:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802d81:	83 ec 0c             	sub    $0xc,%esp
+  802d84:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802d86:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802d8d:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802d90:	83 c0 01             	add    $0x1,%eax
+  802d93:	50                   	push   %eax
+  802d94:	68 00 10 01 e0       	push   $0xe0011000
+  802d99:	6a 11                	push   $0x11
+  802d9b:	ff 35 e4 69 80 00    	push   0x8069e4
+  802da1:	e8 a1 14 00 00       	call   804247 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802da6:	83 c4 1c             	add    $0x1c,%esp
+  802da9:	6a 00                	push   $0x0
+  802dab:	6a 00                	push   $0x0
+  802dad:	6a 00                	push   $0x0
+  802daf:	e8 cf 11 00 00       	call   803f83 <ipc_recv>
+  802db4:	83 c4 10             	add    $0x10,%esp
+  802db7:	85 c0                	test   %eax,%eax
+  802db9:	78 5b                	js     802e16 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802dbb:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802dbd:	39 c3                	cmp    %eax,%ebx
+  802dbf:	0f 8e 4c ff ff ff    	jle    802d11 <nsipc_sendfile+0x28>
+  802dc5:	eb 45                	jmp    802e0c <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	6a 07                	push   $0x7
+  802dcc:	68 00 10 01 e0       	push   $0xe0011000
+  802dd1:	6a 00                	push   $0x0
+  802dd3:	e8 0d e0 ff ff       	call   800de5 <sys_page_alloc>
+  802dd8:	89 c7                	mov    %eax,%edi
+  802dda:	83 c4 10             	add    $0x10,%esp
+  802ddd:	85 c0                	test   %eax,%eax
+  802ddf:	78 2b                	js     802e0c <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802de1:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802de8:	00 00 00 
+  802deb:	e9 0f ff ff ff       	jmp    802cff <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802df0:	83 ec 0c             	sub    $0xc,%esp
+  802df3:	6a 03                	push   $0x3
+  802df5:	e8 82 14 00 00       	call   80427c <ipc_find_env>
+  802dfa:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802dff:	83 c4 10             	add    $0x10,%esp
+  802e02:	e9 05 ff ff ff       	jmp    802d0c <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802e07:	85 ff                	test   %edi,%edi
+  802e09:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802e0c:	89 f8                	mov    %edi,%eax
+  802e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e11:	5b                   	pop    %ebx
+  802e12:	5e                   	pop    %esi
+  802e13:	5f                   	pop    %edi
+  802e14:	5d                   	pop    %ebp
+  802e15:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802e16:	85 ff                	test   %edi,%edi
+  802e18:	0f 44 f8             	cmove  %eax,%edi
+  802e1b:	eb ef                	jmp    802e0c <nsipc_sendfile+0x123>
+
+00802e1d <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802e1d:	55                   	push   %ebp
+  802e1e:	89 e5                	mov    %esp,%ebp
+  802e20:	57                   	push   %edi
+  802e21:	56                   	push   %esi
+  802e22:	53                   	push   %ebx
+  802e23:	83 ec 1c             	sub    $0x1c,%esp
+  802e26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802e29:	e8 13 f9 ff ff       	call   802741 <nsbulk_map>
+  802e2e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e31:	85 c0                	test   %eax,%eax
+  802e33:	0f 88 ba 00 00 00    	js     802ef3 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802e39:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e3d:	0f 8e bb 00 00 00    	jle    802efe <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802e43:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802e48:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802e4d:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802e52:	89 f8                	mov    %edi,%eax
+  802e54:	29 f0                	sub    %esi,%eax
+  802e56:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802e5a:	39 c8                	cmp    %ecx,%eax
+  802e5c:	0f 47 c1             	cmova  %ecx,%eax
+  802e5f:	01 f0                	add    %esi,%eax
+  802e61:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802e63:	83 c2 01             	add    $0x1,%edx
+  802e66:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802e69:	7e 07                	jle    802e72 <nsipc_recvmsg+0x55>
+  802e6b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802e70:	7e e0                	jle    802e52 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802e72:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802e78:	c1 fa 0c             	sar    $0xc,%edx
+  802e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e80:	e8 0a f9 ff ff       	call   80278f <nsbulk_own>
+  802e85:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e88:	85 c0                	test   %eax,%eax
+  802e8a:	78 67                	js     802ef3 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802e8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8f:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802e94:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802e9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9d:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802ea2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802ea7:	89 f2                	mov    %esi,%edx
+  802ea9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802eae:	e8 44 f9 ff ff       	call   8027f7 <nsipc_bulk>
+  802eb3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802eb6:	85 c0                	test   %eax,%eax
+  802eb8:	78 39                	js     802ef3 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802eba:	39 f0                	cmp    %esi,%eax
+  802ebc:	7f 4a                	jg     802f08 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802ebe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	7e 2c                	jle    802ef3 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802ec7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802eca:	29 fe                	sub    %edi,%esi
+  802ecc:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ecf:	39 c6                	cmp    %eax,%esi
+  802ed1:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802ed4:	83 ec 04             	sub    $0x4,%esp
+  802ed7:	56                   	push   %esi
+  802ed8:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802ede:	50                   	push   %eax
+  802edf:	ff 33                	push   (%ebx)
+  802ee1:	e8 7b dc ff ff       	call   800b61 <memmove>
+		n += m;
+  802ee6:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802ee8:	83 c3 08             	add    $0x8,%ebx
+  802eeb:	83 c4 10             	add    $0x10,%esp
+  802eee:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802ef1:	7f d4                	jg     802ec7 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802ef3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef9:	5b                   	pop    %ebx
+  802efa:	5e                   	pop    %esi
+  802efb:	5f                   	pop    %edi
+  802efc:	5d                   	pop    %ebp
+  802efd:	c3                   	ret
+	int r, i, n, len = 0;
+  802efe:	be 00 00 00 00       	mov    $0x0,%esi
+  802f03:	e9 6a ff ff ff       	jmp    802e72 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802f08:	68 78 4a 80 00       	push   $0x804a78
+  802f0d:	68 81 4a 80 00       	push   $0x804a81
+  802f12:	68 3b 01 00 00       	push   $0x13b
+  802f17:	68 96 4a 80 00       	push   $0x804a96
+  802f1c:	e8 be d2 ff ff       	call   8001df <_panic>
+
+00802f21 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802f21:	55                   	push   %ebp
+  802f22:	89 e5                	mov    %esp,%ebp
+  802f24:	57                   	push   %edi
+  802f25:	56                   	push   %esi
+  802f26:	53                   	push   %ebx
+  802f27:	83 ec 0c             	sub    $0xc,%esp
+  802f2a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802f2d:	8b 75 10             	mov    0x10(%ebp),%esi
+  802f30:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802f33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f36:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802f3b:	8b 07                	mov    (%edi),%eax
+  802f3d:	a3 04 80 80 00       	mov    %eax,0x808004
+  802f42:	8b 47 04             	mov    0x4(%edi),%eax
+  802f45:	a3 08 80 80 00       	mov    %eax,0x808008
+  802f4a:	8b 47 08             	mov    0x8(%edi),%eax
+  802f4d:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802f52:	8b 47 0c             	mov    0xc(%edi),%eax
+  802f55:	a3 10 80 80 00       	mov    %eax,0x808010
+  802f5a:	8b 47 10             	mov    0x10(%edi),%eax
+  802f5d:	a3 14 80 80 00       	mov    %eax,0x808014
+  802f62:	8b 47 14             	mov    0x14(%edi),%eax
+  802f65:	a3 18 80 80 00       	mov    %eax,0x808018
+  802f6a:	8b 47 18             	mov    0x18(%edi),%eax
+  802f6d:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802f72:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802f75:	a3 20 80 80 00       	mov    %eax,0x808020
+  802f7a:	8b 47 20             	mov    0x20(%edi),%eax
+  802f7d:	a3 24 80 80 00       	mov    %eax,0x808024
+  802f82:	8b 47 24             	mov    0x24(%edi),%eax
+  802f85:	a3 28 80 80 00       	mov    %eax,0x808028
+  802f8a:	8b 47 28             	mov    0x28(%edi),%eax
+  802f8d:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802f92:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802f95:	a3 30 80 80 00       	mov    %eax,0x808030
+  802f9a:	8b 47 30             	mov    0x30(%edi),%eax
+  802f9d:	a3 34 80 80 00       	mov    %eax,0x808034
+  802fa2:	8b 47 34             	mov    0x34(%edi),%eax
+  802fa5:	a3 38 80 80 00       	mov    %eax,0x808038
+  802faa:	8b 47 38             	mov    0x38(%edi),%eax
+  802fad:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802fb2:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802fb5:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802fba:	8b 06                	mov    (%esi),%eax
+  802fbc:	a3 44 80 80 00       	mov    %eax,0x808044
+  802fc1:	8b 46 04             	mov    0x4(%esi),%eax
+  802fc4:	a3 48 80 80 00       	mov    %eax,0x808048
+  802fc9:	8b 46 08             	mov    0x8(%esi),%eax
+  802fcc:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802fd1:	8b 46 0c             	mov    0xc(%esi),%eax
+  802fd4:	a3 50 80 80 00       	mov    %eax,0x808050
+  802fd9:	8b 46 10             	mov    0x10(%esi),%eax
+  802fdc:	a3 54 80 80 00       	mov    %eax,0x808054
+  802fe1:	8b 46 14             	mov    0x14(%esi),%eax
+  802fe4:	a3 58 80 80 00       	mov    %eax,0x808058
+  802fe9:	8b 46 18             	mov    0x18(%esi),%eax
+  802fec:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802ff1:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802ff4:	a3 60 80 80 00       	mov    %eax,0x808060
+  802ff9:	8b 46 20             	mov    0x20(%esi),%eax
+  802ffc:	a3 64 80 80 00       	mov    %eax,0x808064
+  803001:	8b 46 24             	mov    0x24(%esi),%eax
+  803004:	a3 68 80 80 00       	mov    %eax,0x808068
+  803009:	8b 46 28             	mov    0x28(%esi),%eax
+  80300c:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803011:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803014:	a3 70 80 80 00       	mov    %eax,0x808070
+  803019:	8b 46 30             	mov    0x30(%esi),%eax
+  80301c:	a3 74 80 80 00       	mov    %eax,0x808074
+  803021:	8b 46 34             	mov    0x34(%esi),%eax
+  803024:	a3 78 80 80 00       	mov    %eax,0x808078
+  803029:	8b 46 38             	mov    0x38(%esi),%eax
+  80302c:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803031:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803034:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803039:	8b 03                	mov    (%ebx),%eax
+  80303b:	a3 84 80 80 00       	mov    %eax,0x808084
+  803040:	8b 43 04             	mov    0x4(%ebx),%eax
+  803043:	a3 88 80 80 00       	mov    %eax,0x808088
+  803048:	8b 43 08             	mov    0x8(%ebx),%eax
+  80304b:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803050:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803053:	a3 90 80 80 00       	mov    %eax,0x808090
+  803058:	8b 43 10             	mov    0x10(%ebx),%eax
+  80305b:	a3 94 80 80 00       	mov    %eax,0x808094
+  803060:	8b 43 14             	mov    0x14(%ebx),%eax
+  803063:	a3 98 80 80 00       	mov    %eax,0x808098
+  803068:	8b 43 18             	mov    0x18(%ebx),%eax
+  80306b:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803070:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803073:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803078:	8b 43 20             	mov    0x20(%ebx),%eax
+  80307b:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803080:	8b 43 24             	mov    0x24(%ebx),%eax
+  803083:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803088:	8b 43 28             	mov    0x28(%ebx),%eax
+  80308b:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803090:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803093:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803098:	8b 43 30             	mov    0x30(%ebx),%eax
+  80309b:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8030a0:	8b 43 34             	mov    0x34(%ebx),%eax
+  8030a3:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8030a8:	8b 43 38             	mov    0x38(%ebx),%eax
+  8030ab:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8030b0:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8030b3:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8030b8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8030bb:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8030c0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8030c5:	e8 2b f6 ff ff       	call   8026f5 <nsipc>
+  8030ca:	85 c0                	test   %eax,%eax
+  8030cc:	0f 88 ad 01 00 00    	js     80327f <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8030d2:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8030d8:	89 17                	mov    %edx,(%edi)
+  8030da:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8030e0:	89 57 04             	mov    %edx,0x4(%edi)
+  8030e3:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8030e9:	89 57 08             	mov    %edx,0x8(%edi)
+  8030ec:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8030f2:	89 57 0c             	mov    %edx,0xc(%edi)
+  8030f5:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8030fb:	89 57 10             	mov    %edx,0x10(%edi)
+  8030fe:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803104:	89 57 14             	mov    %edx,0x14(%edi)
+  803107:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80310d:	89 57 18             	mov    %edx,0x18(%edi)
+  803110:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803116:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803119:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80311f:	89 57 20             	mov    %edx,0x20(%edi)
+  803122:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  803128:	89 57 24             	mov    %edx,0x24(%edi)
+  80312b:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803131:	89 57 28             	mov    %edx,0x28(%edi)
+  803134:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80313a:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80313d:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803143:	89 57 30             	mov    %edx,0x30(%edi)
+  803146:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80314c:	89 57 34             	mov    %edx,0x34(%edi)
+  80314f:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803155:	89 57 38             	mov    %edx,0x38(%edi)
+  803158:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80315e:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803161:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  803167:	89 16                	mov    %edx,(%esi)
+  803169:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80316f:	89 56 04             	mov    %edx,0x4(%esi)
+  803172:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803178:	89 56 08             	mov    %edx,0x8(%esi)
+  80317b:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803181:	89 56 0c             	mov    %edx,0xc(%esi)
+  803184:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80318a:	89 56 10             	mov    %edx,0x10(%esi)
+  80318d:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803193:	89 56 14             	mov    %edx,0x14(%esi)
+  803196:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  80319c:	89 56 18             	mov    %edx,0x18(%esi)
+  80319f:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8031a5:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8031a8:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8031ae:	89 56 20             	mov    %edx,0x20(%esi)
+  8031b1:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8031b7:	89 56 24             	mov    %edx,0x24(%esi)
+  8031ba:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8031c0:	89 56 28             	mov    %edx,0x28(%esi)
+  8031c3:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8031c9:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8031cc:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8031d2:	89 56 30             	mov    %edx,0x30(%esi)
+  8031d5:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8031db:	89 56 34             	mov    %edx,0x34(%esi)
+  8031de:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8031e4:	89 56 38             	mov    %edx,0x38(%esi)
+  8031e7:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8031ed:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8031f0:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8031f6:	89 13                	mov    %edx,(%ebx)
+  8031f8:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8031fe:	89 53 04             	mov    %edx,0x4(%ebx)
+  803201:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803207:	89 53 08             	mov    %edx,0x8(%ebx)
+  80320a:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803210:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803213:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803219:	89 53 10             	mov    %edx,0x10(%ebx)
+  80321c:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803222:	89 53 14             	mov    %edx,0x14(%ebx)
+  803225:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  80322b:	89 53 18             	mov    %edx,0x18(%ebx)
+  80322e:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803234:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803237:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  80323d:	89 53 20             	mov    %edx,0x20(%ebx)
+  803240:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803246:	89 53 24             	mov    %edx,0x24(%ebx)
+  803249:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  80324f:	89 53 28             	mov    %edx,0x28(%ebx)
+  803252:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803258:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80325b:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803261:	89 53 30             	mov    %edx,0x30(%ebx)
+  803264:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80326a:	89 53 34             	mov    %edx,0x34(%ebx)
+  80326d:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803273:	89 53 38             	mov    %edx,0x38(%ebx)
+  803276:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  80327c:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80327f:	83 c4 0c             	add    $0xc,%esp
+  803282:	5b                   	pop    %ebx
+  803283:	5e                   	pop    %esi
+  803284:	5f                   	pop    %edi
+  803285:	5d                   	pop    %ebp
+  803286:	c3                   	ret
+
+00803287 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80328d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803290:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803295:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803298:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80329d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032a0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8032a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8032aa:	e8 46 f4 ff ff       	call   8026f5 <nsipc>
+}
+  8032af:	c9                   	leave
+  8032b0:	c3                   	ret
+
+008032b1 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8032b1:	55                   	push   %ebp
+  8032b2:	89 e5                	mov    %esp,%ebp
+  8032b4:	56                   	push   %esi
+  8032b5:	53                   	push   %ebx
+  8032b6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8032b9:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8032bf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8032c2:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8032c7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8032cc:	e8 24 f4 ff ff       	call   8026f5 <nsipc>
+  8032d1:	89 c3                	mov    %eax,%ebx
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	7e 1f                	jle    8032f6 <nsipc_evwait+0x45>
+		assert(r <= max);
+  8032d7:	39 c6                	cmp    %eax,%esi
+  8032d9:	7c 24                	jl     8032ff <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8032db:	83 ec 04             	sub    $0x4,%esp
+  8032de:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8032e5:	50                   	push   %eax
+  8032e6:	68 00 80 80 00       	push   $0x808000
+  8032eb:	ff 75 08             	push   0x8(%ebp)
+  8032ee:	e8 6e d8 ff ff       	call   800b61 <memmove>
+  8032f3:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8032f6:	89 d8                	mov    %ebx,%eax
+  8032f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032fb:	5b                   	pop    %ebx
+  8032fc:	5e                   	pop    %esi
+  8032fd:	5d                   	pop    %ebp
+  8032fe:	c3                   	ret
+		assert(r <= max);
+  8032ff:	68 ae 4a 80 00       	push   $0x804aae
+  803304:	68 81 4a 80 00       	push   $0x804a81
+  803309:	68 6a 01 00 00       	push   $0x16a
+  80330e:	68 96 4a 80 00       	push   $0x804a96
+  803313:	e8 c7 ce ff ff       	call   8001df <_panic>
+
+00803318 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803318:	55                   	push   %ebp
+  803319:	89 e5                	mov    %esp,%ebp
+  80331b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80331e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803321:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803326:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803329:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80332e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803331:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803336:	b8 09 00 00 00       	mov    $0x9,%eax
+  80333b:	e8 b5 f3 ff ff       	call   8026f5 <nsipc>
+}
+  803340:	c9                   	leave
+  803341:	c3                   	ret
+
+00803342 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803342:	55                   	push   %ebp
+  803343:	89 e5                	mov    %esp,%ebp
+  803345:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80334b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803350:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803355:	e8 9b f3 ff ff       	call   8026f5 <nsipc>
+}
+  80335a:	c9                   	leave
+  80335b:	c3                   	ret
+
+0080335c <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80335c:	55                   	push   %ebp
+  80335d:	89 e5                	mov    %esp,%ebp
+  80335f:	53                   	push   %ebx
+  803360:	83 ec 04             	sub    $0x4,%esp
+  803363:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803366:	b8 12 00 00 00       	mov    $0x12,%eax
+  80336b:	e8 85 f3 ff ff       	call   8026f5 <nsipc>
+  803370:	85 c0                	test   %eax,%eax
+  803372:	78 50                	js     8033c4 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803374:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80337a:	89 13                	mov    %edx,(%ebx)
+  80337c:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803382:	89 53 04             	mov    %edx,0x4(%ebx)
+  803385:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80338b:	89 53 08             	mov    %edx,0x8(%ebx)
+  80338e:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803394:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803397:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80339d:	89 53 10             	mov    %edx,0x10(%ebx)
+  8033a0:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8033a6:	89 53 14             	mov    %edx,0x14(%ebx)
+  8033a9:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8033af:	89 53 18             	mov    %edx,0x18(%ebx)
+  8033b2:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8033b8:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8033bb:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8033c1:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8033c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c7:	c9                   	leave
+  8033c8:	c3                   	ret
+
+008033c9 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8033c9:	55                   	push   %ebp
+  8033ca:	89 e5                	mov    %esp,%ebp
+  8033cc:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8033cf:	6a 03                	push   $0x3
+  8033d1:	e8 a6 0e 00 00       	call   80427c <ipc_find_env>
+  8033d6:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  8033db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033de:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8033e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8033e8:	e8 08 f3 ff ff       	call   8026f5 <nsipc>
+  8033ed:	83 c4 10             	add    $0x10,%esp
+  8033f0:	85 c0                	test   %eax,%eax
+  8033f2:	78 0a                	js     8033fe <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8033f4:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  8033f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+
+00803400 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803400:	55                   	push   %ebp
+  803401:	89 e5                	mov    %esp,%ebp
+  803403:	57                   	push   %edi
+  803404:	56                   	push   %esi
+  803405:	53                   	push   %ebx
+  803406:	83 ec 1c             	sub    $0x1c,%esp
+  803409:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80340c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80340f:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803414:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803419:	89 e0                	mov    %esp,%eax
+  80341b:	89 f2                	mov    %esi,%edx
+  80341d:	29 c2                	sub    %eax,%edx
+  80341f:	89 d0                	mov    %edx,%eax
+  803421:	c1 e8 0f             	shr    $0xf,%eax
+  803424:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80342a:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80342d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803434:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803437:	83 ec 0c             	sub    $0xc,%esp
+  80343a:	ff 75 e0             	push   -0x20(%ebp)
+  80343d:	e8 79 0e 00 00       	call   8042bb <pageref>
+  803442:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803445:	83 c4 04             	add    $0x4,%esp
+  803448:	ff 75 dc             	push   -0x24(%ebp)
+  80344b:	e8 6b 0e 00 00       	call   8042bb <pageref>
+  803450:	89 e2                	mov    %esp,%edx
+  803452:	89 f1                	mov    %esi,%ecx
+  803454:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803456:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803459:	89 ca                	mov    %ecx,%edx
+  80345b:	c1 ea 0f             	shr    $0xf,%edx
+  80345e:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803464:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803467:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  80346e:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803471:	39 d7                	cmp    %edx,%edi
+  803473:	74 40                	je     8034b5 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803475:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803478:	75 9f                	jne    803419 <_pipeisclosed+0x19>
+  80347a:	89 e2                	mov    %esp,%edx
+  80347c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803481:	29 d0                	sub    %edx,%eax
+  803483:	89 c2                	mov    %eax,%edx
+  803485:	c1 ea 0f             	shr    $0xf,%edx
+  803488:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80348d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803492:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803495:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80349c:	8b 40 58             	mov    0x58(%eax),%eax
+  80349f:	6a 01                	push   $0x1
+  8034a1:	50                   	push   %eax
+  8034a2:	57                   	push   %edi
+  8034a3:	68 b7 4a 80 00       	push   $0x804ab7
+  8034a8:	e8 0d ce ff ff       	call   8002ba <cprintf>
+  8034ad:	83 c4 10             	add    $0x10,%esp
+  8034b0:	e9 5f ff ff ff       	jmp    803414 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8034b5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8034b8:	0f 94 c0             	sete   %al
+  8034bb:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8034be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034c1:	5b                   	pop    %ebx
+  8034c2:	5e                   	pop    %esi
+  8034c3:	5f                   	pop    %edi
+  8034c4:	5d                   	pop    %ebp
+  8034c5:	c3                   	ret
+
+008034c6 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8034c6:	55                   	push   %ebp
+  8034c7:	89 e5                	mov    %esp,%ebp
+  8034c9:	53                   	push   %ebx
+  8034ca:	83 ec 0c             	sub    $0xc,%esp
+  8034cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8034d0:	53                   	push   %ebx
+  8034d1:	6a 00                	push   $0x0
+  8034d3:	e8 92 d9 ff ff       	call   800e6a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8034d8:	89 1c 24             	mov    %ebx,(%esp)
+  8034db:	e8 f4 e4 ff ff       	call   8019d4 <fd2data>
+  8034e0:	83 c4 08             	add    $0x8,%esp
+  8034e3:	50                   	push   %eax
+  8034e4:	6a 00                	push   $0x0
+  8034e6:	e8 7f d9 ff ff       	call   800e6a <sys_page_unmap>
+}
+  8034eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034ee:	c9                   	leave
+  8034ef:	c3                   	ret
+
+008034f0 <devpipe_read>:
+{
+  8034f0:	55                   	push   %ebp
+  8034f1:	89 e5                	mov    %esp,%ebp
+  8034f3:	57                   	push   %edi
+  8034f4:	56                   	push   %esi
+  8034f5:	53                   	push   %ebx
+  8034f6:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8034f9:	ff 75 08             	push   0x8(%ebp)
+  8034fc:	e8 d3 e4 ff ff       	call   8019d4 <fd2data>
+  803501:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803503:	8b 70 04             	mov    0x4(%eax),%esi
+  803506:	8b 00                	mov    (%eax),%eax
+  803508:	83 c4 10             	add    $0x10,%esp
+  80350b:	39 f0                	cmp    %esi,%eax
+  80350d:	75 36                	jne    803545 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80350f:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803512:	89 da                	mov    %ebx,%edx
+  803514:	8b 45 08             	mov    0x8(%ebp),%eax
+  803517:	e8 e4 fe ff ff       	call   803400 <_pipeisclosed>
+  80351c:	85 c0                	test   %eax,%eax
+  80351e:	0f 85 d4 00 00 00    	jne    8035f8 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803524:	b8 01 00 00 00       	mov    $0x1,%eax
+  803529:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80352d:	83 ec 04             	sub    $0x4,%esp
+  803530:	6a ff                	push   $0xffffffff
+  803532:	56                   	push   %esi
+  803533:	57                   	push   %edi
+  803534:	e8 aa dc ff ff       	call   8011e3 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803539:	8b 73 04             	mov    0x4(%ebx),%esi
+  80353c:	8b 03                	mov    (%ebx),%eax
+  80353e:	83 c4 10             	add    $0x10,%esp
+  803541:	39 c6                	cmp    %eax,%esi
+  803543:	74 cd                	je     803512 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803545:	8b 73 04             	mov    0x4(%ebx),%esi
+  803548:	8b 03                	mov    (%ebx),%eax
+  80354a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803550:	29 c6                	sub    %eax,%esi
+  803552:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803557:	f7 e6                	mul    %esi
+  803559:	c1 ea 0c             	shr    $0xc,%edx
+  80355c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803562:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803564:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803567:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80356b:	8b 0b                	mov    (%ebx),%ecx
+  80356d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803572:	f7 e1                	mul    %ecx
+  803574:	c1 ea 0b             	shr    $0xb,%edx
+  803577:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80357d:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80357f:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803584:	29 cf                	sub    %ecx,%edi
+  803586:	39 f7                	cmp    %esi,%edi
+  803588:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80358b:	83 ec 04             	sub    $0x4,%esp
+  80358e:	57                   	push   %edi
+  80358f:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803593:	50                   	push   %eax
+  803594:	ff 75 0c             	push   0xc(%ebp)
+  803597:	e8 c5 d5 ff ff       	call   800b61 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80359c:	83 c4 0c             	add    $0xc,%esp
+  80359f:	89 f0                	mov    %esi,%eax
+  8035a1:	29 f8                	sub    %edi,%eax
+  8035a3:	50                   	push   %eax
+  8035a4:	8d 43 10             	lea    0x10(%ebx),%eax
+  8035a7:	50                   	push   %eax
+  8035a8:	89 f8                	mov    %edi,%eax
+  8035aa:	03 45 0c             	add    0xc(%ebp),%eax
+  8035ad:	50                   	push   %eax
+  8035ae:	e8 ae d5 ff ff       	call   800b61 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8035b3:	8b 0b                	mov    (%ebx),%ecx
+  8035b5:	01 f1                	add    %esi,%ecx
+  8035b7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8035bc:	f7 e1                	mul    %ecx
+  8035be:	c1 ea 0c             	shr    $0xc,%edx
+  8035c1:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8035c7:	29 c1                	sub    %eax,%ecx
+  8035c9:	89 0b                	mov    %ecx,(%ebx)
+  8035cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d0:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8035d4:	83 c4 10             	add    $0x10,%esp
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	75 0a                	jne    8035e5 <devpipe_read+0xf5>
+	return n;
+  8035db:	89 f0                	mov    %esi,%eax
+}
+  8035dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e0:	5b                   	pop    %ebx
+  8035e1:	5e                   	pop    %esi
+  8035e2:	5f                   	pop    %edi
+  8035e3:	5d                   	pop    %ebp
+  8035e4:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8035e5:	83 ec 08             	sub    $0x8,%esp
+  8035e8:	68 00 04 00 00       	push   $0x400
+  8035ed:	53                   	push   %ebx
+  8035ee:	e8 12 dc ff ff       	call   801205 <sys_futex_wake>
+  8035f3:	83 c4 10             	add    $0x10,%esp
+  8035f6:	eb e3                	jmp    8035db <devpipe_read+0xeb>
+			return 0;
+  8035f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035fd:	eb de                	jmp    8035dd <devpipe_read+0xed>
+
+008035ff <devpipe_write>:
+{
+  8035ff:	55                   	push   %ebp
+  803600:	89 e5                	mov    %esp,%ebp
+  803602:	57                   	push   %edi
+  803603:	56                   	push   %esi
+  803604:	53                   	push   %ebx
+  803605:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803608:	ff 75 08             	push   0x8(%ebp)
+  80360b:	e8 c4 e3 ff ff       	call   8019d4 <fd2data>
+  803610:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803612:	83 c4 10             	add    $0x10,%esp
+  803615:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80361c:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803621:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803625:	0f 84 43 01 00 00    	je     80376e <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80362b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80362e:	8b 06                	mov    (%esi),%eax
+  803630:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803636:	29 c1                	sub    %eax,%ecx
+  803638:	89 c8                	mov    %ecx,%eax
+  80363a:	f7 e7                	mul    %edi
+  80363c:	c1 ea 0c             	shr    $0xc,%edx
+  80363f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803645:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803647:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80364d:	75 52                	jne    8036a1 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80364f:	89 f2                	mov    %esi,%edx
+  803651:	8b 45 08             	mov    0x8(%ebp),%eax
+  803654:	e8 a7 fd ff ff       	call   803400 <_pipeisclosed>
+  803659:	85 c0                	test   %eax,%eax
+  80365b:	0f 85 28 01 00 00    	jne    803789 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803661:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803663:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803666:	8b 06                	mov    (%esi),%eax
+  803668:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80366e:	29 c1                	sub    %eax,%ecx
+  803670:	89 c8                	mov    %ecx,%eax
+  803672:	f7 e7                	mul    %edi
+  803674:	c1 ea 0c             	shr    $0xc,%edx
+  803677:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80367d:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80367f:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803685:	75 a4                	jne    80362b <devpipe_write+0x2c>
+  803687:	b8 01 00 00 00       	mov    $0x1,%eax
+  80368c:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803690:	83 ec 04             	sub    $0x4,%esp
+  803693:	6a ff                	push   $0xffffffff
+  803695:	53                   	push   %ebx
+  803696:	56                   	push   %esi
+  803697:	e8 47 db ff ff       	call   8011e3 <sys_futex_wait>
+}
+  80369c:	83 c4 10             	add    $0x10,%esp
+  80369f:	eb 8a                	jmp    80362b <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036a1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8036a4:	8b 06                	mov    (%esi),%eax
+  8036a6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8036ac:	29 c1                	sub    %eax,%ecx
+  8036ae:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036b3:	f7 e1                	mul    %ecx
+  8036b5:	c1 ea 0c             	shr    $0xc,%edx
+  8036b8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8036be:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8036c0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8036c5:	89 d8                	mov    %ebx,%eax
+  8036c7:	29 c8                	sub    %ecx,%eax
+  8036c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036cc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8036cf:	29 ca                	sub    %ecx,%edx
+  8036d1:	39 d0                	cmp    %edx,%eax
+  8036d3:	0f 46 d0             	cmovbe %eax,%edx
+  8036d6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8036d9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8036dc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036e1:	f7 e1                	mul    %ecx
+  8036e3:	c1 ea 0b             	shr    $0xb,%edx
+  8036e6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8036ec:	89 ca                	mov    %ecx,%edx
+  8036ee:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8036f0:	29 d3                	sub    %edx,%ebx
+  8036f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8036f5:	39 c3                	cmp    %eax,%ebx
+  8036f7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8036fa:	83 ec 04             	sub    $0x4,%esp
+  8036fd:	53                   	push   %ebx
+  8036fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803701:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803704:	51                   	push   %ecx
+  803705:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803709:	50                   	push   %eax
+  80370a:	e8 52 d4 ff ff       	call   800b61 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80370f:	83 c4 0c             	add    $0xc,%esp
+  803712:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803715:	29 d8                	sub    %ebx,%eax
+  803717:	50                   	push   %eax
+  803718:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80371b:	01 cb                	add    %ecx,%ebx
+  80371d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803720:	53                   	push   %ebx
+  803721:	8d 46 10             	lea    0x10(%esi),%eax
+  803724:	50                   	push   %eax
+  803725:	e8 37 d4 ff ff       	call   800b61 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80372a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80372d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803730:	01 c1                	add    %eax,%ecx
+  803732:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803737:	f7 e1                	mul    %ecx
+  803739:	c1 ea 0c             	shr    $0xc,%edx
+  80373c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803742:	89 ca                	mov    %ecx,%edx
+  803744:	29 c2                	sub    %eax,%edx
+  803746:	89 56 04             	mov    %edx,0x4(%esi)
+  803749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374e:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803752:	83 c4 10             	add    $0x10,%esp
+  803755:	85 c0                	test   %eax,%eax
+  803757:	75 1a                	jne    803773 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803759:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80375c:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80375f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803762:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803765:	0f 82 c0 fe ff ff    	jb     80362b <devpipe_write+0x2c>
+  80376b:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80376e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803771:	eb 1b                	jmp    80378e <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803773:	83 ec 08             	sub    $0x8,%esp
+  803776:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80377b:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80377e:	50                   	push   %eax
+  80377f:	e8 81 da ff ff       	call   801205 <sys_futex_wake>
+  803784:	83 c4 10             	add    $0x10,%esp
+  803787:	eb d0                	jmp    803759 <devpipe_write+0x15a>
+				return 0;
+  803789:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80378e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803791:	5b                   	pop    %ebx
+  803792:	5e                   	pop    %esi
+  803793:	5f                   	pop    %edi
+  803794:	5d                   	pop    %ebp
+  803795:	c3                   	ret
+
+00803796 <devpipe_stat>:
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	56                   	push   %esi
+  80379a:	53                   	push   %ebx
+  80379b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80379e:	83 ec 0c             	sub    $0xc,%esp
+  8037a1:	ff 75 08             	push   0x8(%ebp)
+  8037a4:	e8 2b e2 ff ff       	call   8019d4 <fd2data>
+  8037a9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8037ab:	83 c4 08             	add    $0x8,%esp
+  8037ae:	68 ca 4a 80 00       	push   $0x804aca
+  8037b3:	53                   	push   %ebx
+  8037b4:	e8 f8 d1 ff ff       	call   8009b1 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037b9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037bc:	8b 06                	mov    (%esi),%eax
+  8037be:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8037c4:	29 c1                	sub    %eax,%ecx
+  8037c6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8037cb:	89 c8                	mov    %ecx,%eax
+  8037cd:	f7 e2                	mul    %edx
+  8037cf:	c1 ea 0c             	shr    $0xc,%edx
+  8037d2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037d8:	29 d1                	sub    %edx,%ecx
+  8037da:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8037e0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8037e7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8037ea:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8037f1:	50 80 00 
+}
+  8037f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037fc:	5b                   	pop    %ebx
+  8037fd:	5e                   	pop    %esi
+  8037fe:	5d                   	pop    %ebp
+  8037ff:	c3                   	ret
+
+00803800 <devpipe_poll>:
+{
+  803800:	55                   	push   %ebp
+  803801:	89 e5                	mov    %esp,%ebp
+  803803:	57                   	push   %edi
+  803804:	56                   	push   %esi
+  803805:	53                   	push   %ebx
+  803806:	83 ec 18             	sub    $0x18,%esp
+  803809:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80380c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80380f:	57                   	push   %edi
+  803810:	e8 bf e1 ff ff       	call   8019d4 <fd2data>
+  803815:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803817:	83 c4 10             	add    $0x10,%esp
+  80381a:	89 f3                	mov    %esi,%ebx
+  80381c:	83 e3 01             	and    $0x1,%ebx
+  80381f:	75 27                	jne    803848 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803821:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803827:	75 48                	jne    803871 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803829:	89 ca                	mov    %ecx,%edx
+  80382b:	89 f8                	mov    %edi,%eax
+  80382d:	e8 ce fb ff ff       	call   803400 <_pipeisclosed>
+  803832:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803834:	89 d8                	mov    %ebx,%eax
+  803836:	83 c8 10             	or     $0x10,%eax
+  803839:	85 d2                	test   %edx,%edx
+  80383b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80383e:	89 d8                	mov    %ebx,%eax
+  803840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803843:	5b                   	pop    %ebx
+  803844:	5e                   	pop    %esi
+  803845:	5f                   	pop    %edi
+  803846:	5d                   	pop    %ebp
+  803847:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803848:	8b 58 04             	mov    0x4(%eax),%ebx
+  80384b:	8b 00                	mov    (%eax),%eax
+  80384d:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803853:	29 c3                	sub    %eax,%ebx
+  803855:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80385a:	89 d8                	mov    %ebx,%eax
+  80385c:	f7 e2                	mul    %edx
+  80385e:	c1 ea 0c             	shr    $0xc,%edx
+  803861:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803867:	39 d3                	cmp    %edx,%ebx
+  803869:	0f 95 c3             	setne  %bl
+  80386c:	0f b6 db             	movzbl %bl,%ebx
+  80386f:	eb b0                	jmp    803821 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803871:	8b 71 04             	mov    0x4(%ecx),%esi
+  803874:	8b 01                	mov    (%ecx),%eax
+  803876:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80387c:	29 c6                	sub    %eax,%esi
+  80387e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803883:	89 f0                	mov    %esi,%eax
+  803885:	f7 e2                	mul    %edx
+  803887:	c1 ea 0c             	shr    $0xc,%edx
+  80388a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803890:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803892:	89 d8                	mov    %ebx,%eax
+  803894:	83 c8 04             	or     $0x4,%eax
+  803897:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80389d:	0f 42 d8             	cmovb  %eax,%ebx
+  8038a0:	eb 87                	jmp    803829 <devpipe_poll+0x29>
+
+008038a2 <pipe>:
+{
+  8038a2:	55                   	push   %ebp
+  8038a3:	89 e5                	mov    %esp,%ebp
+  8038a5:	56                   	push   %esi
+  8038a6:	53                   	push   %ebx
+  8038a7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8038aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8038ad:	50                   	push   %eax
+  8038ae:	e8 38 e1 ff ff       	call   8019eb <fd_alloc>
+  8038b3:	89 c3                	mov    %eax,%ebx
+  8038b5:	83 c4 10             	add    $0x10,%esp
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	0f 88 23 01 00 00    	js     8039e3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038c0:	83 ec 04             	sub    $0x4,%esp
+  8038c3:	68 07 04 00 00       	push   $0x407
+  8038c8:	ff 75 f4             	push   -0xc(%ebp)
+  8038cb:	6a 00                	push   $0x0
+  8038cd:	e8 13 d5 ff ff       	call   800de5 <sys_page_alloc>
+  8038d2:	89 c3                	mov    %eax,%ebx
+  8038d4:	83 c4 10             	add    $0x10,%esp
+  8038d7:	85 c0                	test   %eax,%eax
+  8038d9:	0f 88 04 01 00 00    	js     8039e3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8038df:	83 ec 0c             	sub    $0xc,%esp
+  8038e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8038e5:	50                   	push   %eax
+  8038e6:	e8 00 e1 ff ff       	call   8019eb <fd_alloc>
+  8038eb:	89 c3                	mov    %eax,%ebx
+  8038ed:	83 c4 10             	add    $0x10,%esp
+  8038f0:	85 c0                	test   %eax,%eax
+  8038f2:	0f 88 db 00 00 00    	js     8039d3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8038f8:	83 ec 04             	sub    $0x4,%esp
+  8038fb:	68 07 04 00 00       	push   $0x407
+  803900:	ff 75 f0             	push   -0x10(%ebp)
+  803903:	6a 00                	push   $0x0
+  803905:	e8 db d4 ff ff       	call   800de5 <sys_page_alloc>
+  80390a:	89 c3                	mov    %eax,%ebx
+  80390c:	83 c4 10             	add    $0x10,%esp
+  80390f:	85 c0                	test   %eax,%eax
+  803911:	0f 88 bc 00 00 00    	js     8039d3 <pipe+0x131>
+	va = fd2data(fd0);
+  803917:	83 ec 0c             	sub    $0xc,%esp
+  80391a:	ff 75 f4             	push   -0xc(%ebp)
+  80391d:	e8 b2 e0 ff ff       	call   8019d4 <fd2data>
+  803922:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803924:	83 c4 0c             	add    $0xc,%esp
+  803927:	68 07 04 00 00       	push   $0x407
+  80392c:	50                   	push   %eax
+  80392d:	6a 00                	push   $0x0
+  80392f:	e8 b1 d4 ff ff       	call   800de5 <sys_page_alloc>
+  803934:	89 c3                	mov    %eax,%ebx
+  803936:	83 c4 10             	add    $0x10,%esp
+  803939:	85 c0                	test   %eax,%eax
+  80393b:	0f 88 82 00 00 00    	js     8039c3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803941:	83 ec 0c             	sub    $0xc,%esp
+  803944:	ff 75 f0             	push   -0x10(%ebp)
+  803947:	e8 88 e0 ff ff       	call   8019d4 <fd2data>
+  80394c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803953:	50                   	push   %eax
+  803954:	6a 00                	push   $0x0
+  803956:	56                   	push   %esi
+  803957:	6a 00                	push   $0x0
+  803959:	e8 ca d4 ff ff       	call   800e28 <sys_page_map>
+  80395e:	89 c3                	mov    %eax,%ebx
+  803960:	83 c4 20             	add    $0x20,%esp
+  803963:	85 c0                	test   %eax,%eax
+  803965:	78 4e                	js     8039b5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803967:	a1 60 50 80 00       	mov    0x805060,%eax
+  80396c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80396f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803971:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803974:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80397b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80397e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803980:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803983:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80398a:	83 ec 0c             	sub    $0xc,%esp
+  80398d:	ff 75 f4             	push   -0xc(%ebp)
+  803990:	e8 2f e0 ff ff       	call   8019c4 <fd2num>
+  803995:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803998:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80399a:	83 c4 04             	add    $0x4,%esp
+  80399d:	ff 75 f0             	push   -0x10(%ebp)
+  8039a0:	e8 1f e0 ff ff       	call   8019c4 <fd2num>
+  8039a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8039a8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8039ab:	83 c4 10             	add    $0x10,%esp
+  8039ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039b3:	eb 2e                	jmp    8039e3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8039b5:	83 ec 08             	sub    $0x8,%esp
+  8039b8:	56                   	push   %esi
+  8039b9:	6a 00                	push   $0x0
+  8039bb:	e8 aa d4 ff ff       	call   800e6a <sys_page_unmap>
+  8039c0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8039c3:	83 ec 08             	sub    $0x8,%esp
+  8039c6:	ff 75 f0             	push   -0x10(%ebp)
+  8039c9:	6a 00                	push   $0x0
+  8039cb:	e8 9a d4 ff ff       	call   800e6a <sys_page_unmap>
+  8039d0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8039d3:	83 ec 08             	sub    $0x8,%esp
+  8039d6:	ff 75 f4             	push   -0xc(%ebp)
+  8039d9:	6a 00                	push   $0x0
+  8039db:	e8 8a d4 ff ff       	call   800e6a <sys_page_unmap>
+  8039e0:	83 c4 10             	add    $0x10,%esp
+}
+  8039e3:	89 d8                	mov    %ebx,%eax
+  8039e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039e8:	5b                   	pop    %ebx
+  8039e9:	5e                   	pop    %esi
+  8039ea:	5d                   	pop    %ebp
+  8039eb:	c3                   	ret
+
+008039ec <pipeisclosed>:
+{
+  8039ec:	55                   	push   %ebp
+  8039ed:	89 e5                	mov    %esp,%ebp
+  8039ef:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039f5:	50                   	push   %eax
+  8039f6:	ff 75 08             	push   0x8(%ebp)
+  8039f9:	e8 3d e0 ff ff       	call   801a3b <fd_lookup>
+  8039fe:	83 c4 10             	add    $0x10,%esp
+  803a01:	85 c0                	test   %eax,%eax
+  803a03:	78 18                	js     803a1d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803a05:	83 ec 0c             	sub    $0xc,%esp
+  803a08:	ff 75 f4             	push   -0xc(%ebp)
+  803a0b:	e8 c4 df ff ff       	call   8019d4 <fd2data>
+  803a10:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a15:	e8 e6 f9 ff ff       	call   803400 <_pipeisclosed>
+  803a1a:	83 c4 10             	add    $0x10,%esp
+}
+  803a1d:	c9                   	leave
+  803a1e:	c3                   	ret
+
+00803a1f <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803a1f:	55                   	push   %ebp
+  803a20:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803a22:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a25:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a2b:	5d                   	pop    %ebp
+  803a2c:	c3                   	ret
+
+00803a2d <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803a2d:	55                   	push   %ebp
+  803a2e:	89 e5                	mov    %esp,%ebp
+  803a30:	53                   	push   %ebx
+  803a31:	83 ec 04             	sub    $0x4,%esp
+  803a34:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803a37:	8b 03                	mov    (%ebx),%eax
+  803a39:	85 c0                	test   %eax,%eax
+  803a3b:	75 05                	jne    803a42 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803a3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a40:	c9                   	leave
+  803a41:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803a42:	83 ec 08             	sub    $0x8,%esp
+  803a45:	50                   	push   %eax
+  803a46:	8d 43 04             	lea    0x4(%ebx),%eax
+  803a49:	50                   	push   %eax
+  803a4a:	e8 6b d6 ff ff       	call   8010ba <sys_page_batch>
+	pb->pb_n = 0;
+  803a4f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803a55:	83 c4 10             	add    $0x10,%esp
+  803a58:	eb e3                	jmp    803a3d <pgbatch_flush+0x10>
+
+00803a5a <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803a5a:	55                   	push   %ebp
+  803a5b:	89 e5                	mov    %esp,%ebp
+  803a5d:	56                   	push   %esi
+  803a5e:	53                   	push   %ebx
+  803a5f:	89 c3                	mov    %eax,%ebx
+  803a61:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803a63:	83 38 20             	cmpl   $0x20,(%eax)
+  803a66:	74 2c                	je     803a94 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803a68:	8b 03                	mov    (%ebx),%eax
+  803a6a:	8d 50 01             	lea    0x1(%eax),%edx
+  803a6d:	89 13                	mov    %edx,(%ebx)
+  803a6f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803a72:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803a76:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803a78:	83 ec 04             	sub    $0x4,%esp
+  803a7b:	6a 18                	push   $0x18
+  803a7d:	6a 00                	push   $0x0
+  803a7f:	50                   	push   %eax
+  803a80:	e8 a7 d0 ff ff       	call   800b2c <memset>
+	return 0;
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a90:	5b                   	pop    %ebx
+  803a91:	5e                   	pop    %esi
+  803a92:	5d                   	pop    %ebp
+  803a93:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803a94:	83 ec 0c             	sub    $0xc,%esp
+  803a97:	50                   	push   %eax
+  803a98:	e8 90 ff ff ff       	call   803a2d <pgbatch_flush>
+  803a9d:	83 c4 10             	add    $0x10,%esp
+  803aa0:	85 c0                	test   %eax,%eax
+  803aa2:	79 c4                	jns    803a68 <pgbatch_slot+0xe>
+  803aa4:	eb e7                	jmp    803a8d <pgbatch_slot+0x33>
+
+00803aa6 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803aa6:	55                   	push   %ebp
+  803aa7:	89 e5                	mov    %esp,%ebp
+  803aa9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803aac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ab2:	e8 a3 ff ff ff       	call   803a5a <pgbatch_slot>
+  803ab7:	85 c0                	test   %eax,%eax
+  803ab9:	78 20                	js     803adb <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803abb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803abe:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803ac4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ac7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803aca:	8b 55 10             	mov    0x10(%ebp),%edx
+  803acd:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ad0:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ad3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803adb:	c9                   	leave
+  803adc:	c3                   	ret
+
+00803add <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803add:	55                   	push   %ebp
+  803ade:	89 e5                	mov    %esp,%ebp
+  803ae0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ae3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ae9:	e8 6c ff ff ff       	call   803a5a <pgbatch_slot>
+  803aee:	85 c0                	test   %eax,%eax
+  803af0:	78 2c                	js     803b1e <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803af2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803af5:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803afb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803afe:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803b01:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b04:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803b07:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b0a:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803b0d:	8b 55 18             	mov    0x18(%ebp),%edx
+  803b10:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803b13:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803b16:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b1e:	c9                   	leave
+  803b1f:	c3                   	ret
+
+00803b20 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803b20:	55                   	push   %ebp
+  803b21:	89 e5                	mov    %esp,%ebp
+  803b23:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b26:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b2c:	e8 29 ff ff ff       	call   803a5a <pgbatch_slot>
+  803b31:	85 c0                	test   %eax,%eax
+  803b33:	78 1a                	js     803b4f <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803b35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b38:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803b3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b41:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803b44:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b47:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b4f:	c9                   	leave
+  803b50:	c3                   	ret
+
+00803b51 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803b51:	55                   	push   %ebp
+  803b52:	89 e5                	mov    %esp,%ebp
+  803b54:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b57:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b5d:	e8 f8 fe ff ff       	call   803a5a <pgbatch_slot>
+  803b62:	85 c0                	test   %eax,%eax
+  803b64:	78 20                	js     803b86 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803b66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b69:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803b6f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b72:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803b75:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b78:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803b7b:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b7e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b86:	c9                   	leave
+  803b87:	c3                   	ret
+
+00803b88 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803b88:	55                   	push   %ebp
+  803b89:	89 e5                	mov    %esp,%ebp
+  803b8b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b8e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b91:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b94:	e8 c1 fe ff ff       	call   803a5a <pgbatch_slot>
+  803b99:	85 c0                	test   %eax,%eax
+  803b9b:	78 26                	js     803bc3 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803b9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ba0:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803ba6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ba9:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803bac:	8b 55 10             	mov    0x10(%ebp),%edx
+  803baf:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803bb2:	8b 55 14             	mov    0x14(%ebp),%edx
+  803bb5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803bb8:	8b 55 18             	mov    0x18(%ebp),%edx
+  803bbb:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bc3:	c9                   	leave
+  803bc4:	c3                   	ret
+
+00803bc5 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803bc5:	55                   	push   %ebp
+  803bc6:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803bc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bcb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803bd1:	5d                   	pop    %ebp
+  803bd2:	c3                   	ret
+
+00803bd3 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803bd3:	55                   	push   %ebp
+  803bd4:	89 e5                	mov    %esp,%ebp
+  803bd6:	56                   	push   %esi
+  803bd7:	53                   	push   %ebx
+  803bd8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803be5:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803be9:	85 c0                	test   %eax,%eax
+  803beb:	74 2f                	je     803c1c <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803bed:	83 f8 02             	cmp    $0x2,%eax
+  803bf0:	74 0c                	je     803bfe <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803bf2:	b8 02 00 00 00       	mov    $0x2,%eax
+  803bf7:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	74 1e                	je     803c1c <mutex_lock+0x49>
+  803bfe:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803c03:	83 ec 04             	sub    $0x4,%esp
+  803c06:	6a ff                	push   $0xffffffff
+  803c08:	6a 02                	push   $0x2
+  803c0a:	53                   	push   %ebx
+  803c0b:	e8 d3 d5 ff ff       	call   8011e3 <sys_futex_wait>
+  803c10:	89 f0                	mov    %esi,%eax
+  803c12:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803c15:	83 c4 10             	add    $0x10,%esp
+  803c18:	85 c0                	test   %eax,%eax
+  803c1a:	75 e7                	jne    803c03 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803c1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c1f:	5b                   	pop    %ebx
+  803c20:	5e                   	pop    %esi
+  803c21:	5d                   	pop    %ebp
+  803c22:	c3                   	ret
+
+00803c23 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803c23:	55                   	push   %ebp
+  803c24:	89 e5                	mov    %esp,%ebp
+  803c26:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c2e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803c33:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803c37:	85 c0                	test   %eax,%eax
+  803c39:	0f 94 c0             	sete   %al
+  803c3c:	0f b6 c0             	movzbl %al,%eax
+}
+  803c3f:	5d                   	pop    %ebp
+  803c40:	c3                   	ret
+
+00803c41 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803c41:	55                   	push   %ebp
+  803c42:	89 e5                	mov    %esp,%ebp
+  803c44:	83 ec 08             	sub    $0x8,%esp
+  803c47:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4f:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803c52:	83 f8 02             	cmp    $0x2,%eax
+  803c55:	74 02                	je     803c59 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803c57:	c9                   	leave
+  803c58:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803c59:	83 ec 08             	sub    $0x8,%esp
+  803c5c:	6a 01                	push   $0x1
+  803c5e:	52                   	push   %edx
+  803c5f:	e8 a1 d5 ff ff       	call   801205 <sys_futex_wake>
+  803c64:	83 c4 10             	add    $0x10,%esp
+}
+  803c67:	eb ee                	jmp    803c57 <mutex_unlock+0x16>
+
+00803c69 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803c69:	55                   	push   %ebp
+  803c6a:	89 e5                	mov    %esp,%ebp
+  803c6c:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803c6f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803c75:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803c7c:	5d                   	pop    %ebp
+  803c7d:	c3                   	ret
+
+00803c7e <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803c7e:	55                   	push   %ebp
+  803c7f:	89 e5                	mov    %esp,%ebp
+  803c81:	57                   	push   %edi
+  803c82:	56                   	push   %esi
+  803c83:	53                   	push   %ebx
+  803c84:	83 ec 18             	sub    $0x18,%esp
+  803c87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803c8a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803c8d:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803c8f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803c94:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803c99:	57                   	push   %edi
+  803c9a:	e8 a2 ff ff ff       	call   803c41 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803c9f:	83 c4 0c             	add    $0xc,%esp
+  803ca2:	ff 75 10             	push   0x10(%ebp)
+  803ca5:	56                   	push   %esi
+  803ca6:	53                   	push   %ebx
+  803ca7:	e8 37 d5 ff ff       	call   8011e3 <sys_futex_wait>
+  803cac:	89 c6                	mov    %eax,%esi
+  803cae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803cb3:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803cb8:	89 3c 24             	mov    %edi,(%esp)
+  803cbb:	e8 13 ff ff ff       	call   803bd3 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803cc0:	83 c4 10             	add    $0x10,%esp
+  803cc3:	83 fe ef             	cmp    $0xffffffef,%esi
+  803cc6:	74 05                	je     803ccd <cond_timedwait+0x4f>
+  803cc8:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803ccd:	89 f0                	mov    %esi,%eax
+  803ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cd2:	5b                   	pop    %ebx
+  803cd3:	5e                   	pop    %esi
+  803cd4:	5f                   	pop    %edi
+  803cd5:	5d                   	pop    %ebp
+  803cd6:	c3                   	ret
+
+00803cd7 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803cd7:	55                   	push   %ebp
+  803cd8:	89 e5                	mov    %esp,%ebp
+  803cda:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803cdd:	6a ff                	push   $0xffffffff
+  803cdf:	ff 75 0c             	push   0xc(%ebp)
+  803ce2:	ff 75 08             	push   0x8(%ebp)
+  803ce5:	e8 94 ff ff ff       	call   803c7e <cond_timedwait>
+}
+  803cea:	83 c4 10             	add    $0x10,%esp
+  803ced:	c9                   	leave
+  803cee:	c3                   	ret
+
+00803cef <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803cef:	55                   	push   %ebp
+  803cf0:	89 e5                	mov    %esp,%ebp
+  803cf2:	83 ec 08             	sub    $0x8,%esp
+  803cf5:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cf8:	ba 01 00 00 00       	mov    $0x1,%edx
+  803cfd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803d01:	8b 50 04             	mov    0x4(%eax),%edx
+  803d04:	85 d2                	test   %edx,%edx
+  803d06:	75 02                	jne    803d0a <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803d08:	c9                   	leave
+  803d09:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803d0a:	83 ec 08             	sub    $0x8,%esp
+  803d0d:	6a 01                	push   $0x1
+  803d0f:	50                   	push   %eax
+  803d10:	e8 f0 d4 ff ff       	call   801205 <sys_futex_wake>
+  803d15:	83 c4 10             	add    $0x10,%esp
+}
+  803d18:	eb ee                	jmp    803d08 <cond_signal+0x19>
+
+00803d1a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803d1a:	55                   	push   %ebp
+  803d1b:	89 e5                	mov    %esp,%ebp
+  803d1d:	83 ec 08             	sub    $0x8,%esp
+  803d20:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d23:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d28:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803d2c:	8b 50 04             	mov    0x4(%eax),%edx
+  803d2f:	85 d2                	test   %edx,%edx
+  803d31:	75 02                	jne    803d35 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803d33:	c9                   	leave
+  803d34:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803d35:	83 ec 08             	sub    $0x8,%esp
+  803d38:	68 00 04 00 00       	push   $0x400
+  803d3d:	50                   	push   %eax
+  803d3e:	e8 c2 d4 ff ff       	call   801205 <sys_futex_wake>
+  803d43:	83 c4 10             	add    $0x10,%esp
+}
+  803d46:	eb eb                	jmp    803d33 <cond_broadcast+0x19>
+
+00803d48 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803d48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4d:	c3                   	ret
+
+00803d4e <devcons_poll>:
+{
+  803d4e:	55                   	push   %ebp
+  803d4f:	89 e5                	mov    %esp,%ebp
+  803d51:	53                   	push   %ebx
+  803d52:	83 ec 04             	sub    $0x4,%esp
+  803d55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d58:	89 da                	mov    %ebx,%edx
+  803d5a:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803d5d:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803d64:	74 0c                	je     803d72 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d66:	89 d8                	mov    %ebx,%eax
+  803d68:	83 e0 01             	and    $0x1,%eax
+  803d6b:	09 d0                	or     %edx,%eax
+}
+  803d6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d70:	c9                   	leave
+  803d71:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803d72:	e8 d0 cf ff ff       	call   800d47 <sys_cgetc>
+  803d77:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803d7c:	89 da                	mov    %ebx,%edx
+  803d7e:	83 e2 04             	and    $0x4,%edx
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	74 e6                	je     803d6b <devcons_poll+0x1d>
+  803d85:	eb df                	jmp    803d66 <devcons_poll+0x18>
+
+00803d87 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803d87:	55                   	push   %ebp
+  803d88:	89 e5                	mov    %esp,%ebp
+  803d8a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803d8d:	68 d6 4a 80 00       	push   $0x804ad6
+  803d92:	ff 75 0c             	push   0xc(%ebp)
+  803d95:	e8 17 cc ff ff       	call   8009b1 <strcpy>
+	return 0;
+}
+  803d9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9f:	c9                   	leave
+  803da0:	c3                   	ret
+
+00803da1 <devcons_write>:
+{
+  803da1:	55                   	push   %ebp
+  803da2:	89 e5                	mov    %esp,%ebp
+  803da4:	57                   	push   %edi
+  803da5:	56                   	push   %esi
+  803da6:	53                   	push   %ebx
+  803da7:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803dad:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803db0:	85 ff                	test   %edi,%edi
+  803db2:	74 51                	je     803e05 <devcons_write+0x64>
+  803db4:	be 00 00 00 00       	mov    $0x0,%esi
+  803db9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803dbe:	89 fb                	mov    %edi,%ebx
+  803dc0:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803dc2:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803dc7:	39 d3                	cmp    %edx,%ebx
+  803dc9:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803dcc:	83 ec 04             	sub    $0x4,%esp
+  803dcf:	53                   	push   %ebx
+  803dd0:	03 45 0c             	add    0xc(%ebp),%eax
+  803dd3:	50                   	push   %eax
+  803dd4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803dda:	50                   	push   %eax
+  803ddb:	e8 81 cd ff ff       	call   800b61 <memmove>
+		sys_cputs(buf, m);
+  803de0:	83 c4 08             	add    $0x8,%esp
+  803de3:	53                   	push   %ebx
+  803de4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803dea:	50                   	push   %eax
+  803deb:	e8 39 cf ff ff       	call   800d29 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803df0:	01 de                	add    %ebx,%esi
+  803df2:	89 f0                	mov    %esi,%eax
+  803df4:	83 c4 10             	add    $0x10,%esp
+  803df7:	39 fe                	cmp    %edi,%esi
+  803df9:	72 c3                	jb     803dbe <devcons_write+0x1d>
+}
+  803dfb:	89 f0                	mov    %esi,%eax
+  803dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e00:	5b                   	pop    %ebx
+  803e01:	5e                   	pop    %esi
+  803e02:	5f                   	pop    %edi
+  803e03:	5d                   	pop    %ebp
+  803e04:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803e05:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803e0a:	eb ef                	jmp    803dfb <devcons_write+0x5a>
+
+00803e0c <devcons_read>:
+{
+  803e0c:	55                   	push   %ebp
+  803e0d:	89 e5                	mov    %esp,%ebp
+  803e0f:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803e12:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803e17:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803e1b:	74 36                	je     803e53 <devcons_read+0x47>
+	c = cons_peek;
+  803e1d:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  803e22:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  803e29:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803e2c:	85 c0                	test   %eax,%eax
+  803e2e:	75 10                	jne    803e40 <devcons_read+0x34>
+  803e30:	e8 12 cf ff ff       	call   800d47 <sys_cgetc>
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	75 07                	jne    803e40 <devcons_read+0x34>
+		sys_yield();
+  803e39:	e8 88 cf ff ff       	call   800dc6 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803e3e:	eb f0                	jmp    803e30 <devcons_read+0x24>
+	if (c < 0)
+  803e40:	85 c0                	test   %eax,%eax
+  803e42:	78 0f                	js     803e53 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803e44:	83 f8 04             	cmp    $0x4,%eax
+  803e47:	74 0c                	je     803e55 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803e49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e4c:	88 02                	mov    %al,(%edx)
+	return 1;
+  803e4e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803e53:	c9                   	leave
+  803e54:	c3                   	ret
+		return 0;
+  803e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5a:	eb f7                	jmp    803e53 <devcons_read+0x47>
+
+00803e5c <cputchar>:
+{
+  803e5c:	55                   	push   %ebp
+  803e5d:	89 e5                	mov    %esp,%ebp
+  803e5f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e65:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803e68:	6a 01                	push   $0x1
+  803e6a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e6d:	50                   	push   %eax
+  803e6e:	e8 b6 ce ff ff       	call   800d29 <sys_cputs>
+}
+  803e73:	83 c4 10             	add    $0x10,%esp
+  803e76:	c9                   	leave
+  803e77:	c3                   	ret
+
+00803e78 <getchar>:
+{
+  803e78:	55                   	push   %ebp
+  803e79:	89 e5                	mov    %esp,%ebp
+  803e7b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803e7e:	6a 01                	push   $0x1
+  803e80:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e83:	50                   	push   %eax
+  803e84:	6a 00                	push   $0x0
+  803e86:	e8 34 de ff ff       	call   801cbf <read>
+	if (r < 0)
+  803e8b:	83 c4 10             	add    $0x10,%esp
+  803e8e:	85 c0                	test   %eax,%eax
+  803e90:	78 06                	js     803e98 <getchar+0x20>
+	if (r < 1)
+  803e92:	74 06                	je     803e9a <getchar+0x22>
+	return c;
+  803e94:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803e98:	c9                   	leave
+  803e99:	c3                   	ret
+		return -E_EOF;
+  803e9a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803e9f:	eb f7                	jmp    803e98 <getchar+0x20>
+
+00803ea1 <iscons>:
+{
+  803ea1:	55                   	push   %ebp
+  803ea2:	89 e5                	mov    %esp,%ebp
+  803ea4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803ea7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803eaa:	50                   	push   %eax
+  803eab:	ff 75 08             	push   0x8(%ebp)
+  803eae:	e8 88 db ff ff       	call   801a3b <fd_lookup>
+  803eb3:	83 c4 10             	add    $0x10,%esp
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	78 11                	js     803ecb <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803eba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ebd:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803ec3:	39 10                	cmp    %edx,(%eax)
+  803ec5:	0f 94 c0             	sete   %al
+  803ec8:	0f b6 c0             	movzbl %al,%eax
+}
+  803ecb:	c9                   	leave
+  803ecc:	c3                   	ret
+
+00803ecd <opencons>:
+{
+  803ecd:	55                   	push   %ebp
+  803ece:	89 e5                	mov    %esp,%ebp
+  803ed0:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803ed3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ed6:	50                   	push   %eax
+  803ed7:	e8 0f db ff ff       	call   8019eb <fd_alloc>
+  803edc:	83 c4 10             	add    $0x10,%esp
+  803edf:	85 c0                	test   %eax,%eax
+  803ee1:	78 3a                	js     803f1d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803ee3:	83 ec 04             	sub    $0x4,%esp
+  803ee6:	68 07 04 00 00       	push   $0x407
+  803eeb:	ff 75 f4             	push   -0xc(%ebp)
+  803eee:	6a 00                	push   $0x0
+  803ef0:	e8 f0 ce ff ff       	call   800de5 <sys_page_alloc>
+  803ef5:	83 c4 10             	add    $0x10,%esp
+  803ef8:	85 c0                	test   %eax,%eax
+  803efa:	78 21                	js     803f1d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803efc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eff:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803f05:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f0a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803f11:	83 ec 0c             	sub    $0xc,%esp
+  803f14:	50                   	push   %eax
+  803f15:	e8 aa da ff ff       	call   8019c4 <fd2num>
+  803f1a:	83 c4 10             	add    $0x10,%esp
+}
+  803f1d:	c9                   	leave
+  803f1e:	c3                   	ret
+
+00803f1f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803f1f:	55                   	push   %ebp
+  803f20:	89 e5                	mov    %esp,%ebp
+  803f22:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803f25:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803f2c:	74 0a                	je     803f38 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f31:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803f36:	c9                   	leave
+  803f37:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  803f38:	83 ec 04             	sub    $0x4,%esp
+  803f3b:	6a 07                	push   $0x7
+  803f3d:	68 00 f0 bf ee       	push   $0xeebff000
+  803f42:	6a 00                	push   $0x0
+  803f44:	e8 9c ce ff ff       	call   800de5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803f49:	83 c4 08             	add    $0x8,%esp
+  803f4c:	68 5d 3f 80 00       	push   $0x803f5d
+  803f51:	6a 00                	push   $0x0
+  803f53:	e8 d8 cf ff ff       	call   800f30 <sys_env_set_pgfault_upcall>
+  803f58:	83 c4 10             	add    $0x10,%esp
+  803f5b:	eb d1                	jmp    803f2e <set_pgfault_handler+0xf>
+
+00803f5d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803f5d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803f5e:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803f63:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803f65:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  803f68:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  803f6c:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  803f6f:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  803f73:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  803f75:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  803f79:	83 c4 08             	add    $0x8,%esp
+	popal;
+  803f7c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  803f7d:	83 c4 04             	add    $0x4,%esp
+	popf
+  803f80:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  803f81:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  803f82:	c3                   	ret
+
+00803f83 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803f83:	55                   	push   %ebp
+  803f84:	89 e5                	mov    %esp,%ebp
+  803f86:	56                   	push   %esi
+  803f87:	53                   	push   %ebx
+  803f88:	8b 75 08             	mov    0x8(%ebp),%esi
+  803f8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  803f91:	85 c0                	test   %eax,%eax
+  803f93:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  803f98:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  803f9b:	83 ec 0c             	sub    $0xc,%esp
+  803f9e:	50                   	push   %eax
+  803f9f:	e8 f1 cf ff ff       	call   800f95 <sys_ipc_recv>
+  803fa4:	83 c4 10             	add    $0x10,%esp
+  803fa7:	85 c0                	test   %eax,%eax
+  803fa9:	0f 88 8b 00 00 00    	js     80403a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  803faf:	85 f6                	test   %esi,%esi
+  803fb1:	74 2a                	je     803fdd <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803fb3:	89 e2                	mov    %esp,%edx
+  803fb5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803fba:	29 d0                	sub    %edx,%eax
+  803fbc:	89 c2                	mov    %eax,%edx
+  803fbe:	c1 ea 0f             	shr    $0xf,%edx
+  803fc1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fcb:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803fce:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803fd5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803fdb:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803fdd:	85 db                	test   %ebx,%ebx
+  803fdf:	74 2a                	je     80400b <ipc_recv+0x88>
+  803fe1:	89 e2                	mov    %esp,%edx
+  803fe3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803fe8:	29 d0                	sub    %edx,%eax
+  803fea:	89 c2                	mov    %eax,%edx
+  803fec:	c1 ea 0f             	shr    $0xf,%edx
+  803fef:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff9:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803ffc:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804003:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804009:	89 03                	mov    %eax,(%ebx)
+  80400b:	89 e2                	mov    %esp,%edx
+  80400d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804012:	29 d0                	sub    %edx,%eax
+  804014:	89 c2                	mov    %eax,%edx
+  804016:	c1 ea 0f             	shr    $0xf,%edx
+  804019:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80401e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804023:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804026:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80402d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804033:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804036:	5b                   	pop    %ebx
+  804037:	5e                   	pop    %esi
+  804038:	5d                   	pop    %ebp
+  804039:	c3                   	ret
+		if(from_env_store != NULL)
+  80403a:	85 f6                	test   %esi,%esi
+  80403c:	74 06                	je     804044 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80403e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804044:	85 db                	test   %ebx,%ebx
+  804046:	74 eb                	je     804033 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804048:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80404e:	eb e3                	jmp    804033 <ipc_recv+0xb0>
+
+00804050 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804050:	55                   	push   %ebp
+  804051:	89 e5                	mov    %esp,%ebp
+  804053:	57                   	push   %edi
+  804054:	56                   	push   %esi
+  804055:	53                   	push   %ebx
+  804056:	83 ec 14             	sub    $0x14,%esp
+  804059:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80405c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80405f:	8b 75 14             	mov    0x14(%ebp),%esi
+  804062:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804065:	85 c0                	test   %eax,%eax
+  804067:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80406c:	0f 44 c2             	cmove  %edx,%eax
+  80406f:	ff 75 10             	push   0x10(%ebp)
+  804072:	50                   	push   %eax
+  804073:	e8 7f cf ff ff       	call   800ff7 <sys_ipc_recv_pages>
+  804078:	83 c4 10             	add    $0x10,%esp
+  80407b:	85 c0                	test   %eax,%eax
+  80407d:	0f 88 ba 00 00 00    	js     80413d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804083:	85 ff                	test   %edi,%edi
+  804085:	74 2a                	je     8040b1 <ipc_recv_pages+0x61>
+  804087:	89 e2                	mov    %esp,%edx
+  804089:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80408e:	29 d0                	sub    %edx,%eax
+  804090:	89 c2                	mov    %eax,%edx
+  804092:	c1 ea 0f             	shr    $0xf,%edx
+  804095:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80409a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409f:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8040a2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040a9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8040af:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8040b1:	85 f6                	test   %esi,%esi
+  8040b3:	74 2a                	je     8040df <ipc_recv_pages+0x8f>
+  8040b5:	89 e2                	mov    %esp,%edx
+  8040b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040bc:	29 d0                	sub    %edx,%eax
+  8040be:	89 c2                	mov    %eax,%edx
+  8040c0:	c1 ea 0f             	shr    $0xf,%edx
+  8040c3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040cd:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8040d0:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040d7:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8040dd:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8040df:	85 db                	test   %ebx,%ebx
+  8040e1:	74 2a                	je     80410d <ipc_recv_pages+0xbd>
+  8040e3:	89 e2                	mov    %esp,%edx
+  8040e5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040ea:	29 d0                	sub    %edx,%eax
+  8040ec:	89 c2                	mov    %eax,%edx
+  8040ee:	c1 ea 0f             	shr    $0xf,%edx
+  8040f1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fb:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  8040fe:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804105:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80410b:	89 03                	mov    %eax,(%ebx)
+  80410d:	89 e2                	mov    %esp,%edx
+  80410f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804114:	29 d0                	sub    %edx,%eax
+  804116:	89 c2                	mov    %eax,%edx
+  804118:	c1 ea 0f             	shr    $0xf,%edx
+  80411b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804120:	b8 00 00 00 00       	mov    $0x0,%eax
+  804125:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804128:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80412f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804135:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804138:	5b                   	pop    %ebx
+  804139:	5e                   	pop    %esi
+  80413a:	5f                   	pop    %edi
+  80413b:	5d                   	pop    %ebp
+  80413c:	c3                   	ret
+		if (from_env_store)
+  80413d:	85 ff                	test   %edi,%edi
+  80413f:	74 06                	je     804147 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804141:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804147:	85 f6                	test   %esi,%esi
+  804149:	74 06                	je     804151 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80414b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804151:	85 db                	test   %ebx,%ebx
+  804153:	74 e0                	je     804135 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804155:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80415b:	eb d8                	jmp    804135 <ipc_recv_pages+0xe5>
+
+0080415d <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80415d:	55                   	push   %ebp
+  80415e:	89 e5                	mov    %esp,%ebp
+  804160:	57                   	push   %edi
+  804161:	56                   	push   %esi
+  804162:	53                   	push   %ebx
+  804163:	83 ec 1c             	sub    $0x1c,%esp
+  804166:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804169:	8b 75 08             	mov    0x8(%ebp),%esi
+  80416c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804172:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804176:	75 2b                	jne    8041a3 <ipc_try_send_pages+0x46>
+  804178:	89 e2                	mov    %esp,%edx
+  80417a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80417f:	29 d0                	sub    %edx,%eax
+  804181:	89 c2                	mov    %eax,%edx
+  804183:	c1 ea 0f             	shr    $0xf,%edx
+  804186:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804190:	0f 42 c2             	cmovb  %edx,%eax
+  804193:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80419a:	8b 70 48             	mov    0x48(%eax),%esi
+  80419d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8041a3:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8041a9:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8041ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8041b1:	85 ff                	test   %edi,%edi
+  8041b3:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8041b8:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8041bb:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8041c1:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8041c7:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8041cd:	83 ec 0c             	sub    $0xc,%esp
+  8041d0:	ff 75 14             	push   0x14(%ebp)
+  8041d3:	ff 75 18             	push   0x18(%ebp)
+  8041d6:	57                   	push   %edi
+  8041d7:	ff 75 0c             	push   0xc(%ebp)
+  8041da:	ff 75 08             	push   0x8(%ebp)
+  8041dd:	e8 f4 cd ff ff       	call   800fd6 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8041e2:	83 c4 20             	add    $0x20,%esp
+  8041e5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8041e8:	75 21                	jne    80420b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8041ea:	83 ec 04             	sub    $0x4,%esp
+  8041ed:	6a ff                	push   $0xffffffff
+  8041ef:	53                   	push   %ebx
+  8041f0:	ff 75 e4             	push   -0x1c(%ebp)
+  8041f3:	e8 eb cf ff ff       	call   8011e3 <sys_futex_wait>
+  8041f8:	83 c4 10             	add    $0x10,%esp
+  8041fb:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8041fe:	74 c7                	je     8041c7 <ipc_try_send_pages+0x6a>
+  804200:	85 c0                	test   %eax,%eax
+  804202:	79 c3                	jns    8041c7 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804204:	e8 bd cb ff ff       	call   800dc6 <sys_yield>
+  804209:	eb bc                	jmp    8041c7 <ipc_try_send_pages+0x6a>
+	}
+}
+  80420b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80420e:	5b                   	pop    %ebx
+  80420f:	5e                   	pop    %esi
+  804210:	5f                   	pop    %edi
+  804211:	5d                   	pop    %ebp
+  804212:	c3                   	ret
+
+00804213 <ipc_send>:
+{
+  804213:	55                   	push   %ebp
+  804214:	89 e5                	mov    %esp,%ebp
+  804216:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804219:	ff 75 14             	push   0x14(%ebp)
+  80421c:	6a 01                	push   $0x1
+  80421e:	ff 75 10             	push   0x10(%ebp)
+  804221:	ff 75 0c             	push   0xc(%ebp)
+  804224:	ff 75 08             	push   0x8(%ebp)
+  804227:	e8 31 ff ff ff       	call   80415d <ipc_try_send_pages>
+  80422c:	83 c4 20             	add    $0x20,%esp
+  80422f:	85 c0                	test   %eax,%eax
+  804231:	78 02                	js     804235 <ipc_send+0x22>
+}
+  804233:	c9                   	leave
+  804234:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804235:	50                   	push   %eax
+  804236:	68 e2 4a 80 00       	push   $0x804ae2
+  80423b:	6a 3f                	push   $0x3f
+  80423d:	68 f7 4a 80 00       	push   $0x804af7
+  804242:	e8 98 bf ff ff       	call   8001df <_panic>
+
+00804247 <ipc_send_pages>:
+{
+  804247:	55                   	push   %ebp
+  804248:	89 e5                	mov    %esp,%ebp
+  80424a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  80424d:	ff 75 18             	push   0x18(%ebp)
+  804250:	ff 75 14             	push   0x14(%ebp)
+  804253:	ff 75 10             	push   0x10(%ebp)
+  804256:	ff 75 0c             	push   0xc(%ebp)
+  804259:	ff 75 08             	push   0x8(%ebp)
+  80425c:	e8 fc fe ff ff       	call   80415d <ipc_try_send_pages>
+  804261:	83 c4 20             	add    $0x20,%esp
+  804264:	85 c0                	test   %eax,%eax
+  804266:	78 02                	js     80426a <ipc_send_pages+0x23>
+}
+  804268:	c9                   	leave
+  804269:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80426a:	50                   	push   %eax
+  80426b:	68 01 4b 80 00       	push   $0x804b01
+  804270:	6a 64                	push   $0x64
+  804272:	68 f7 4a 80 00       	push   $0x804af7
+  804277:	e8 63 bf ff ff       	call   8001df <_panic>
+
+0080427c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80427c:	55                   	push   %ebp
+  80427d:	89 e5                	mov    %esp,%ebp
+  80427f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804282:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804287:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80428d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804293:	8b 52 50             	mov    0x50(%edx),%edx
+  804296:	39 ca                	cmp    %ecx,%edx
+  804298:	74 11                	je     8042ab <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80429a:	83 c0 01             	add    $0x1,%eax
+  80429d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8042a2:	75 e3                	jne    804287 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8042a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a9:	eb 0e                	jmp    8042b9 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8042ab:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8042b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8042b6:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8042b9:	5d                   	pop    %ebp
+  8042ba:	c3                   	ret
+
+008042bb <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8042bb:	55                   	push   %ebp
+  8042bc:	89 e5                	mov    %esp,%ebp
+  8042be:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8042c1:	89 c2                	mov    %eax,%edx
+  8042c3:	c1 ea 16             	shr    $0x16,%edx
+  8042c6:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8042cd:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  8042d2:	f6 c1 01             	test   $0x1,%cl
+  8042d5:	74 1e                	je     8042f5 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  8042d7:	c1 e8 0c             	shr    $0xc,%eax
+  8042da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8042e1:	a8 01                	test   $0x1,%al
+  8042e3:	74 10                	je     8042f5 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8042e5:	c1 e8 0c             	shr    $0xc,%eax
+  8042e8:	c1 e0 04             	shl    $0x4,%eax
+  8042eb:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8042f2:	0f b7 d2             	movzwl %dx,%edx
+}
+  8042f5:	89 d0                	mov    %edx,%eax
+  8042f7:	5d                   	pop    %ebp
+  8042f8:	c3                   	ret
+
+008042f9 <__udivdi3>:
+  8042f9:	57                   	push   %edi
+  8042fa:	56                   	push   %esi
+  8042fb:	53                   	push   %ebx
+  8042fc:	83 ec 20             	sub    $0x20,%esp
+  8042ff:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804303:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804307:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80430b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80430f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804313:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804317:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80431b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80431f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804324:	b8 00 00 00 00       	mov    $0x0,%eax
+  804329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80432e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804335:	00 
+  804336:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80433d:	00 
+  80433e:	eb 08                	jmp    804348 <__udivdi3+0x4f>
+  804340:	83 e9 01             	sub    $0x1,%ecx
+  804343:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804346:	74 68                	je     8043b0 <__udivdi3+0xb7>
+  804348:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80434c:	01 c0                	add    %eax,%eax
+  80434e:	89 c6                	mov    %eax,%esi
+  804350:	89 d7                	mov    %edx,%edi
+  804352:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804356:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80435a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80435d:	d3 ea                	shr    %cl,%edx
+  80435f:	f6 c1 20             	test   $0x20,%cl
+  804362:	74 04                	je     804368 <__udivdi3+0x6f>
+  804364:	89 d0                	mov    %edx,%eax
+  804366:	31 d2                	xor    %edx,%edx
+  804368:	83 e0 01             	and    $0x1,%eax
+  80436b:	89 04 24             	mov    %eax,(%esp)
+  80436e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804375:	00 
+  804376:	8b 04 24             	mov    (%esp),%eax
+  804379:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80437d:	09 f0                	or     %esi,%eax
+  80437f:	09 fa                	or     %edi,%edx
+  804381:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804385:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804389:	39 f0                	cmp    %esi,%eax
+  80438b:	89 d3                	mov    %edx,%ebx
+  80438d:	19 fb                	sbb    %edi,%ebx
+  80438f:	72 af                	jb     804340 <__udivdi3+0x47>
+  804391:	29 f0                	sub    %esi,%eax
+  804393:	19 fa                	sbb    %edi,%edx
+  804395:	89 cf                	mov    %ecx,%edi
+  804397:	c1 ef 05             	shr    $0x5,%edi
+  80439a:	83 e7 01             	and    $0x1,%edi
+  80439d:	89 fe                	mov    %edi,%esi
+  80439f:	83 f6 01             	xor    $0x1,%esi
+  8043a2:	d3 e6                	shl    %cl,%esi
+  8043a4:	d3 e7                	shl    %cl,%edi
+  8043a6:	09 74 24 18          	or     %esi,0x18(%esp)
+  8043aa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8043ae:	eb 90                	jmp    804340 <__udivdi3+0x47>
+  8043b0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8043b4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8043b8:	83 c4 20             	add    $0x20,%esp
+  8043bb:	5b                   	pop    %ebx
+  8043bc:	5e                   	pop    %esi
+  8043bd:	5f                   	pop    %edi
+  8043be:	c3                   	ret
+
+008043bf <__umoddi3>:
+  8043bf:	57                   	push   %edi
+  8043c0:	56                   	push   %esi
+  8043c1:	53                   	push   %ebx
+  8043c2:	83 ec 08             	sub    $0x8,%esp
+  8043c5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8043c9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8043cd:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8043d1:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8043d5:	57                   	push   %edi
+  8043d6:	56                   	push   %esi
+  8043d7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8043db:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8043df:	52                   	push   %edx
+  8043e0:	50                   	push   %eax
+  8043e1:	e8 13 ff ff ff       	call   8042f9 <__udivdi3>
+  8043e6:	89 c3                	mov    %eax,%ebx
+  8043e8:	0f af d6             	imul   %esi,%edx
+  8043eb:	89 f9                	mov    %edi,%ecx
+  8043ed:	0f af cb             	imul   %ebx,%ecx
+  8043f0:	01 d1                	add    %edx,%ecx
+  8043f2:	89 d8                	mov    %ebx,%eax
+  8043f4:	f7 e6                	mul    %esi
+  8043f6:	89 c6                	mov    %eax,%esi
+  8043f8:	89 d7                	mov    %edx,%edi
+  8043fa:	01 cf                	add    %ecx,%edi
+  8043fc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804400:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804404:	29 f0                	sub    %esi,%eax
+  804406:	19 fa                	sbb    %edi,%edx
+  804408:	83 c4 18             	add    $0x18,%esp
+  80440b:	5b                   	pop    %ebx
+  80440c:	5e                   	pop    %esi
+  80440d:	5f                   	pop    %edi
+  80440e:	c3                   	ret
+
+0080440f <__divdi3>:
+  80440f:	53                   	push   %ebx
+  804410:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804414:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804418:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80441c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804420:	85 d2                	test   %edx,%edx
+  804422:	78 12                	js     804436 <__divdi3+0x27>
+  804424:	85 db                	test   %ebx,%ebx
+  804426:	78 2e                	js     804456 <__divdi3+0x47>
+  804428:	53                   	push   %ebx
+  804429:	51                   	push   %ecx
+  80442a:	52                   	push   %edx
+  80442b:	50                   	push   %eax
+  80442c:	e8 c8 fe ff ff       	call   8042f9 <__udivdi3>
+  804431:	83 c4 10             	add    $0x10,%esp
+  804434:	eb 1e                	jmp    804454 <__divdi3+0x45>
+  804436:	f7 d8                	neg    %eax
+  804438:	83 d2 00             	adc    $0x0,%edx
+  80443b:	f7 da                	neg    %edx
+  80443d:	85 db                	test   %ebx,%ebx
+  80443f:	78 2a                	js     80446b <__divdi3+0x5c>
+  804441:	53                   	push   %ebx
+  804442:	51                   	push   %ecx
+  804443:	52                   	push   %edx
+  804444:	50                   	push   %eax
+  804445:	e8 af fe ff ff       	call   8042f9 <__udivdi3>
+  80444a:	83 c4 10             	add    $0x10,%esp
+  80444d:	f7 d8                	neg    %eax
+  80444f:	83 d2 00             	adc    $0x0,%edx
+  804452:	f7 da                	neg    %edx
+  804454:	5b                   	pop    %ebx
+  804455:	c3                   	ret
+  804456:	f7 d9                	neg    %ecx
+  804458:	83 d3 00             	adc    $0x0,%ebx
+  80445b:	f7 db                	neg    %ebx
+  80445d:	53                   	push   %ebx
+  80445e:	51                   	push   %ecx
+  80445f:	52                   	push   %edx
+  804460:	50                   	push   %eax
+  804461:	e8 93 fe ff ff       	call   8042f9 <__udivdi3>
+  804466:	83 c4 10             	add    $0x10,%esp
+  804469:	eb e2                	jmp    80444d <__divdi3+0x3e>
+  80446b:	f7 d9                	neg    %ecx
+  80446d:	83 d3 00             	adc    $0x0,%ebx
+  804470:	f7 db                	neg    %ebx
+  804472:	53                   	push   %ebx
+  804473:	51                   	push   %ecx
+  804474:	52                   	push   %edx
+  804475:	50                   	push   %eax
+  804476:	e8 7e fe ff ff       	call   8042f9 <__udivdi3>
+  80447b:	83 c4 10             	add    $0x10,%esp
+  80447e:	eb d4                	jmp    804454 <__divdi3+0x45>
+
+00804480 <__moddi3>:
+  804480:	57                   	push   %edi
+  804481:	56                   	push   %esi
+  804482:	53                   	push   %ebx
+  804483:	83 ec 08             	sub    $0x8,%esp
+  804486:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80448a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80448e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804492:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804496:	57                   	push   %edi
+  804497:	56                   	push   %esi
+  804498:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80449c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044a0:	52                   	push   %edx
+  8044a1:	50                   	push   %eax
+  8044a2:	e8 68 ff ff ff       	call   80440f <__divdi3>
+  8044a7:	89 c3                	mov    %eax,%ebx
+  8044a9:	0f af d6             	imul   %esi,%edx
+  8044ac:	89 f9                	mov    %edi,%ecx
+  8044ae:	0f af cb             	imul   %ebx,%ecx
+  8044b1:	01 d1                	add    %edx,%ecx
+  8044b3:	89 d8                	mov    %ebx,%eax
+  8044b5:	f7 e6                	mul    %esi
+  8044b7:	89 c6                	mov    %eax,%esi
+  8044b9:	89 d7                	mov    %edx,%edi
+  8044bb:	01 cf                	add    %ecx,%edi
+  8044bd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044c1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044c5:	29 f0                	sub    %esi,%eax
+  8044c7:	19 fa                	sbb    %edi,%edx
+  8044c9:	83 c4 18             	add    $0x18,%esp
+  8044cc:	5b                   	pop    %ebx
+  8044cd:	5e                   	pop    %esi
+  8044ce:	5f                   	pop    %edi
+  8044cf:	c3                   	ret
@@ -0,0 +1,7914 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ad 00 00 00       	call   8000de <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 14             	sub    $0x14,%esp
+	int i;
+
+	cprintf("Making sure bss works right...\n");
+  80003b:	68 20 3b 80 00       	push   $0x803b20
+  800040:	e8 1b 02 00 00       	call   800260 <cprintf>
+  800045:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < ARRAYSIZE; i++)
+  800048:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != 0)
+  80004d:	83 3c 85 40 63 80 00 	cmpl   $0x0,0x806340(,%eax,4)
+  800054:	00 
+  800055:	75 63                	jne    8000ba <umain+0x85>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800057:	83 c0 01             	add    $0x1,%eax
+  80005a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005f:	75 ec                	jne    80004d <umain+0x18>
+			panic("bigarray[%d] isn't cleared!\n", i);
+	for (i = 0; i < ARRAYSIZE; i++)
+  800061:	b8 00 00 00 00       	mov    $0x0,%eax
+		bigarray[i] = i;
+  800066:	89 04 85 40 63 80 00 	mov    %eax,0x806340(,%eax,4)
+	for (i = 0; i < ARRAYSIZE; i++)
+  80006d:	83 c0 01             	add    $0x1,%eax
+  800070:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800075:	75 ef                	jne    800066 <umain+0x31>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800077:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (bigarray[i] != i)
+  80007c:	39 04 85 40 63 80 00 	cmp    %eax,0x806340(,%eax,4)
+  800083:	75 47                	jne    8000cc <umain+0x97>
+	for (i = 0; i < ARRAYSIZE; i++)
+  800085:	83 c0 01             	add    $0x1,%eax
+  800088:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008d:	75 ed                	jne    80007c <umain+0x47>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+
+	cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	68 68 3b 80 00       	push   $0x803b68
+  800097:	e8 c4 01 00 00       	call   800260 <cprintf>
+	bigarray[ARRAYSIZE+1024] = 0;
+  80009c:	c7 05 40 73 c0 00 00 	movl   $0x0,0xc07340
+  8000a3:	00 00 00 
+	panic("SHOULD HAVE TRAPPED!!!");
+  8000a6:	83 c4 0c             	add    $0xc,%esp
+  8000a9:	68 c7 3b 80 00       	push   $0x803bc7
+  8000ae:	6a 1a                	push   $0x1a
+  8000b0:	68 b8 3b 80 00       	push   $0x803bb8
+  8000b5:	e8 cb 00 00 00       	call   800185 <_panic>
+			panic("bigarray[%d] isn't cleared!\n", i);
+  8000ba:	50                   	push   %eax
+  8000bb:	68 9b 3b 80 00       	push   $0x803b9b
+  8000c0:	6a 11                	push   $0x11
+  8000c2:	68 b8 3b 80 00       	push   $0x803bb8
+  8000c7:	e8 b9 00 00 00       	call   800185 <_panic>
+			panic("bigarray[%d] didn't hold its value!\n", i);
+  8000cc:	50                   	push   %eax
+  8000cd:	68 40 3b 80 00       	push   $0x803b40
+  8000d2:	6a 16                	push   $0x16
+  8000d4:	68 b8 3b 80 00       	push   $0x803bb8
+  8000d9:	e8 a7 00 00 00       	call   800185 <_panic>
+
+008000de <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	56                   	push   %esi
+  8000e2:	53                   	push   %ebx
+  8000e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000e9:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000eb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000f0:	29 d0                	sub    %edx,%eax
+  8000f2:	89 c2                	mov    %eax,%edx
+  8000f4:	c1 ea 0f             	shr    $0xf,%edx
+  8000f7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800104:	c7 04 85 40 63 c0 00 	movl   $0x0,0xc06340(,%eax,4)
+  80010b:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80010f:	e8 39 0c 00 00       	call   800d4d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800114:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800119:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80011f:	89 e1                	mov    %esp,%ecx
+  800121:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800126:	29 ca                	sub    %ecx,%edx
+  800128:	89 d1                	mov    %edx,%ecx
+  80012a:	c1 e9 0f             	shr    $0xf,%ecx
+  80012d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800133:	ba 00 00 00 00       	mov    $0x0,%edx
+  800138:	0f 42 d1             	cmovb  %ecx,%edx
+  80013b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800140:	89 04 95 40 63 c0 00 	mov    %eax,0xc06340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800147:	85 db                	test   %ebx,%ebx
+  800149:	7e 07                	jle    800152 <libmain+0x74>
+		binaryname = argv[0];
+  80014b:	8b 06                	mov    (%esi),%eax
+  80014d:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	56                   	push   %esi
+  800156:	53                   	push   %ebx
+  800157:	e8 d9 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  80015c:	e8 0a 00 00 00       	call   80016b <exit>
+}
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800167:	5b                   	pop    %ebx
+  800168:	5e                   	pop    %esi
+  800169:	5d                   	pop    %ebp
+  80016a:	c3                   	ret
+
+0080016b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80016b:	55                   	push   %ebp
+  80016c:	89 e5                	mov    %esp,%ebp
+  80016e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800171:	e8 61 12 00 00       	call   8013d7 <close_all>
+	sys_env_destroy(0);
+  800176:	83 ec 0c             	sub    $0xc,%esp
+  800179:	6a 00                	push   $0x0
+  80017b:	e8 8c 0b 00 00       	call   800d0c <sys_env_destroy>
+}
+  800180:	83 c4 10             	add    $0x10,%esp
+  800183:	c9                   	leave
+  800184:	c3                   	ret
+
+00800185 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800185:	55                   	push   %ebp
+  800186:	89 e5                	mov    %esp,%ebp
+  800188:	56                   	push   %esi
+  800189:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80018a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80018d:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800193:	e8 b5 0b 00 00       	call   800d4d <sys_getenvid>
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	ff 75 0c             	push   0xc(%ebp)
+  80019e:	ff 75 08             	push   0x8(%ebp)
+  8001a1:	56                   	push   %esi
+  8001a2:	50                   	push   %eax
+  8001a3:	68 e8 3b 80 00       	push   $0x803be8
+  8001a8:	e8 b3 00 00 00       	call   800260 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001ad:	83 c4 18             	add    $0x18,%esp
+  8001b0:	53                   	push   %ebx
+  8001b1:	ff 75 10             	push   0x10(%ebp)
+  8001b4:	e8 56 00 00 00       	call   80020f <vcprintf>
+	cprintf("\n");
+  8001b9:	c7 04 24 b6 3b 80 00 	movl   $0x803bb6,(%esp)
+  8001c0:	e8 9b 00 00 00       	call   800260 <cprintf>
+  8001c5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001c8:	cc                   	int3
+	while (1)
+  8001c9:	eb fd                	jmp    8001c8 <_panic+0x43>
+
+008001cb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	53                   	push   %ebx
+  8001cf:	83 ec 04             	sub    $0x4,%esp
+  8001d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001d5:	8b 13                	mov    (%ebx),%edx
+  8001d7:	8d 42 01             	lea    0x1(%edx),%eax
+  8001da:	89 03                	mov    %eax,(%ebx)
+  8001dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001df:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001e3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001e8:	74 09                	je     8001f3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001ea:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001f3:	83 ec 08             	sub    $0x8,%esp
+  8001f6:	68 ff 00 00 00       	push   $0xff
+  8001fb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001fe:	50                   	push   %eax
+  8001ff:	e8 cb 0a 00 00       	call   800ccf <sys_cputs>
+		b->idx = 0;
+  800204:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80020a:	83 c4 10             	add    $0x10,%esp
+  80020d:	eb db                	jmp    8001ea <putch+0x1f>
+
+0080020f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80020f:	55                   	push   %ebp
+  800210:	89 e5                	mov    %esp,%ebp
+  800212:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800218:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80021f:	00 00 00 
+	b.cnt = 0;
+  800222:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800229:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80022c:	ff 75 0c             	push   0xc(%ebp)
+  80022f:	ff 75 08             	push   0x8(%ebp)
+  800232:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800238:	50                   	push   %eax
+  800239:	68 cb 01 80 00       	push   $0x8001cb
+  80023e:	e8 1c 01 00 00       	call   80035f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800243:	83 c4 08             	add    $0x8,%esp
+  800246:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80024c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800252:	50                   	push   %eax
+  800253:	e8 77 0a 00 00       	call   800ccf <sys_cputs>
+
+	return b.cnt;
+}
+  800258:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80025e:	c9                   	leave
+  80025f:	c3                   	ret
+
+00800260 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800260:	55                   	push   %ebp
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800266:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800269:	50                   	push   %eax
+  80026a:	ff 75 08             	push   0x8(%ebp)
+  80026d:	e8 9d ff ff ff       	call   80020f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800272:	c9                   	leave
+  800273:	c3                   	ret
+
+00800274 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	57                   	push   %edi
+  800278:	56                   	push   %esi
+  800279:	53                   	push   %ebx
+  80027a:	83 ec 1c             	sub    $0x1c,%esp
+  80027d:	89 c3                	mov    %eax,%ebx
+  80027f:	89 d6                	mov    %edx,%esi
+  800281:	8b 45 08             	mov    0x8(%ebp),%eax
+  800284:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800287:	89 d1                	mov    %edx,%ecx
+  800289:	89 c2                	mov    %eax,%edx
+  80028b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80028e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800291:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800294:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800297:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80029e:	39 c2                	cmp    %eax,%edx
+  8002a0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002a3:	73 4b                	jae    8002f0 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002a8:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002ab:	85 ff                	test   %edi,%edi
+  8002ad:	7e 11                	jle    8002c0 <printnum+0x4c>
+			putch(padc, putdat);
+  8002af:	83 ec 08             	sub    $0x8,%esp
+  8002b2:	56                   	push   %esi
+  8002b3:	ff 75 18             	push   0x18(%ebp)
+  8002b6:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002b8:	83 c4 10             	add    $0x10,%esp
+  8002bb:	83 ef 01             	sub    $0x1,%edi
+  8002be:	75 ef                	jne    8002af <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	56                   	push   %esi
+  8002c4:	83 ec 04             	sub    $0x4,%esp
+  8002c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ca:	ff 75 e0             	push   -0x20(%ebp)
+  8002cd:	ff 75 dc             	push   -0x24(%ebp)
+  8002d0:	ff 75 d8             	push   -0x28(%ebp)
+  8002d3:	e8 2a 37 00 00       	call   803a02 <__umoddi3>
+  8002d8:	83 c4 14             	add    $0x14,%esp
+  8002db:	0f be 80 0b 3c 80 00 	movsbl 0x803c0b(%eax),%eax
+  8002e2:	50                   	push   %eax
+  8002e3:	ff d3                	call   *%ebx
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002f0:	83 ec 0c             	sub    $0xc,%esp
+  8002f3:	ff 75 18             	push   0x18(%ebp)
+  8002f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002f9:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002fc:	52                   	push   %edx
+  8002fd:	50                   	push   %eax
+  8002fe:	83 ec 08             	sub    $0x8,%esp
+  800301:	ff 75 e4             	push   -0x1c(%ebp)
+  800304:	ff 75 e0             	push   -0x20(%ebp)
+  800307:	ff 75 dc             	push   -0x24(%ebp)
+  80030a:	ff 75 d8             	push   -0x28(%ebp)
+  80030d:	e8 2a 36 00 00       	call   80393c <__udivdi3>
+  800312:	83 c4 18             	add    $0x18,%esp
+  800315:	52                   	push   %edx
+  800316:	50                   	push   %eax
+  800317:	89 f2                	mov    %esi,%edx
+  800319:	89 d8                	mov    %ebx,%eax
+  80031b:	e8 54 ff ff ff       	call   800274 <printnum>
+  800320:	83 c4 20             	add    $0x20,%esp
+  800323:	eb 9b                	jmp    8002c0 <printnum+0x4c>
+
+00800325 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80032b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80032f:	8b 10                	mov    (%eax),%edx
+  800331:	3b 50 04             	cmp    0x4(%eax),%edx
+  800334:	73 0a                	jae    800340 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800336:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800339:	89 08                	mov    %ecx,(%eax)
+  80033b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033e:	88 02                	mov    %al,(%edx)
+}
+  800340:	5d                   	pop    %ebp
+  800341:	c3                   	ret
+
+00800342 <printfmt>:
+{
+  800342:	55                   	push   %ebp
+  800343:	89 e5                	mov    %esp,%ebp
+  800345:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800348:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80034b:	50                   	push   %eax
+  80034c:	ff 75 10             	push   0x10(%ebp)
+  80034f:	ff 75 0c             	push   0xc(%ebp)
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	e8 05 00 00 00       	call   80035f <vprintfmt>
+}
+  80035a:	83 c4 10             	add    $0x10,%esp
+  80035d:	c9                   	leave
+  80035e:	c3                   	ret
+
+0080035f <vprintfmt>:
+{
+  80035f:	55                   	push   %ebp
+  800360:	89 e5                	mov    %esp,%ebp
+  800362:	57                   	push   %edi
+  800363:	56                   	push   %esi
+  800364:	53                   	push   %ebx
+  800365:	83 ec 2c             	sub    $0x2c,%esp
+  800368:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80036b:	89 df                	mov    %ebx,%edi
+  80036d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800370:	8b 45 10             	mov    0x10(%ebp),%eax
+  800373:	8d 70 01             	lea    0x1(%eax),%esi
+  800376:	0f b6 00             	movzbl (%eax),%eax
+  800379:	83 f8 25             	cmp    $0x25,%eax
+  80037c:	74 1e                	je     80039c <vprintfmt+0x3d>
+			if (ch == '\0')
+  80037e:	85 c0                	test   %eax,%eax
+  800380:	0f 84 15 05 00 00    	je     80089b <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800386:	83 ec 08             	sub    $0x8,%esp
+  800389:	53                   	push   %ebx
+  80038a:	50                   	push   %eax
+  80038b:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80038d:	83 c6 01             	add    $0x1,%esi
+  800390:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800394:	83 c4 10             	add    $0x10,%esp
+  800397:	83 f8 25             	cmp    $0x25,%eax
+  80039a:	75 e2                	jne    80037e <vprintfmt+0x1f>
+		padc = ' ';
+  80039c:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003a0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003a7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8003ae:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003ba:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bd:	8d 56 01             	lea    0x1(%esi),%edx
+  8003c0:	0f b6 0e             	movzbl (%esi),%ecx
+  8003c3:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003c6:	3c 55                	cmp    $0x55,%al
+  8003c8:	0f 87 3b 04 00 00    	ja     800809 <vprintfmt+0x4aa>
+  8003ce:	0f b6 c0             	movzbl %al,%eax
+  8003d1:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003d8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003db:	eb 93                	jmp    800370 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003dd:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003df:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003e3:	eb d8                	jmp    8003bd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e5:	89 d6                	mov    %edx,%esi
+  8003e7:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003eb:	eb d0                	jmp    8003bd <vprintfmt+0x5e>
+  8003ed:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003f0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003f3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003f6:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003fd:	83 f9 09             	cmp    $0x9,%ecx
+  800400:	77 6f                	ja     800471 <vprintfmt+0x112>
+  800402:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800405:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800408:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80040b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80040f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800412:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800415:	83 fe 09             	cmp    $0x9,%esi
+  800418:	76 eb                	jbe    800405 <vprintfmt+0xa6>
+  80041a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80041d:	89 d6                	mov    %edx,%esi
+  80041f:	eb 13                	jmp    800434 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8b 00                	mov    (%eax),%eax
+  800426:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800429:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042c:	8d 40 04             	lea    0x4(%eax),%eax
+  80042f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800432:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800434:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800438:	79 83                	jns    8003bd <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80043a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80043d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800440:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800447:	e9 71 ff ff ff       	jmp    8003bd <vprintfmt+0x5e>
+			if (width < 0)
+  80044c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80044f:	85 c9                	test   %ecx,%ecx
+  800451:	b8 00 00 00 00       	mov    $0x0,%eax
+  800456:	0f 49 c1             	cmovns %ecx,%eax
+  800459:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80045c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80045e:	e9 5a ff ff ff       	jmp    8003bd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800463:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800465:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80046c:	e9 4c ff ff ff       	jmp    8003bd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800471:	89 d6                	mov    %edx,%esi
+  800473:	eb bf                	jmp    800434 <vprintfmt+0xd5>
+			lflag++;
+  800475:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800479:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80047b:	e9 3d ff ff ff       	jmp    8003bd <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800480:	89 55 10             	mov    %edx,0x10(%ebp)
+  800483:	8b 45 14             	mov    0x14(%ebp),%eax
+  800486:	8d 70 04             	lea    0x4(%eax),%esi
+  800489:	83 ec 08             	sub    $0x8,%esp
+  80048c:	53                   	push   %ebx
+  80048d:	ff 30                	push   (%eax)
+  80048f:	ff d7                	call   *%edi
+			break;
+  800491:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800494:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800497:	e9 d4 fe ff ff       	jmp    800370 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80049c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004a5:	8b 10                	mov    (%eax),%edx
+  8004a7:	89 d0                	mov    %edx,%eax
+  8004a9:	f7 d8                	neg    %eax
+  8004ab:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ae:	83 f8 12             	cmp    $0x12,%eax
+  8004b1:	7f 23                	jg     8004d6 <vprintfmt+0x177>
+  8004b3:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  8004ba:	85 d2                	test   %edx,%edx
+  8004bc:	74 18                	je     8004d6 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004be:	52                   	push   %edx
+  8004bf:	68 3b 40 80 00       	push   $0x80403b
+  8004c4:	53                   	push   %ebx
+  8004c5:	57                   	push   %edi
+  8004c6:	e8 77 fe ff ff       	call   800342 <printfmt>
+  8004cb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004ce:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004d1:	e9 9a fe ff ff       	jmp    800370 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004d6:	50                   	push   %eax
+  8004d7:	68 23 3c 80 00       	push   $0x803c23
+  8004dc:	53                   	push   %ebx
+  8004dd:	57                   	push   %edi
+  8004de:	e8 5f fe ff ff       	call   800342 <printfmt>
+  8004e3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e6:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004e9:	e9 82 fe ff ff       	jmp    800370 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f4:	83 c0 04             	add    $0x4,%eax
+  8004f7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fd:	8b 00                	mov    (%eax),%eax
+  8004ff:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800502:	85 c0                	test   %eax,%eax
+  800504:	0f 84 61 03 00 00    	je     80086b <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80050a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80050e:	7e 06                	jle    800516 <vprintfmt+0x1b7>
+  800510:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800514:	75 29                	jne    80053f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800516:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800519:	8d 70 01             	lea    0x1(%eax),%esi
+  80051c:	0f b6 00             	movzbl (%eax),%eax
+  80051f:	0f be d0             	movsbl %al,%edx
+  800522:	85 d2                	test   %edx,%edx
+  800524:	0f 84 bb 00 00 00    	je     8005e5 <vprintfmt+0x286>
+  80052a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80052d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800530:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800533:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800536:	eb 7a                	jmp    8005b2 <vprintfmt+0x253>
+				p = "(null)";
+  800538:	c7 45 d0 1c 3c 80 00 	movl   $0x803c1c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	ff 75 d4             	push   -0x2c(%ebp)
+  800545:	ff 75 d0             	push   -0x30(%ebp)
+  800548:	e8 e0 03 00 00       	call   80092d <strnlen>
+  80054d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800550:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800553:	83 c4 10             	add    $0x10,%esp
+  800556:	85 d2                	test   %edx,%edx
+  800558:	0f 8e d6 02 00 00    	jle    800834 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80055e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	53                   	push   %ebx
+  800566:	56                   	push   %esi
+  800567:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800569:	83 c4 10             	add    $0x10,%esp
+  80056c:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800570:	75 f0                	jne    800562 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800572:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800575:	8d 70 01             	lea    0x1(%eax),%esi
+  800578:	0f b6 00             	movzbl (%eax),%eax
+  80057b:	0f be d0             	movsbl %al,%edx
+  80057e:	85 d2                	test   %edx,%edx
+  800580:	0f 84 da 02 00 00    	je     800860 <vprintfmt+0x501>
+  800586:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800589:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80058c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80058f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800592:	eb 1e                	jmp    8005b2 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800594:	83 ec 08             	sub    $0x8,%esp
+  800597:	ff 75 0c             	push   0xc(%ebp)
+  80059a:	52                   	push   %edx
+  80059b:	ff 55 08             	call   *0x8(%ebp)
+  80059e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005a1:	83 eb 01             	sub    $0x1,%ebx
+  8005a4:	83 c6 01             	add    $0x1,%esi
+  8005a7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005ab:	0f be d0             	movsbl %al,%edx
+  8005ae:	85 d2                	test   %edx,%edx
+  8005b0:	74 2a                	je     8005dc <vprintfmt+0x27d>
+  8005b2:	85 ff                	test   %edi,%edi
+  8005b4:	78 05                	js     8005bb <vprintfmt+0x25c>
+  8005b6:	83 ef 01             	sub    $0x1,%edi
+  8005b9:	78 59                	js     800614 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005bb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005bf:	74 d3                	je     800594 <vprintfmt+0x235>
+  8005c1:	0f be c0             	movsbl %al,%eax
+  8005c4:	83 e8 20             	sub    $0x20,%eax
+  8005c7:	83 f8 5e             	cmp    $0x5e,%eax
+  8005ca:	76 c8                	jbe    800594 <vprintfmt+0x235>
+					putch('?', putdat);
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	ff 75 0c             	push   0xc(%ebp)
+  8005d2:	6a 3f                	push   $0x3f
+  8005d4:	ff 55 08             	call   *0x8(%ebp)
+  8005d7:	83 c4 10             	add    $0x10,%esp
+  8005da:	eb c5                	jmp    8005a1 <vprintfmt+0x242>
+  8005dc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005e5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005e8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005ec:	7e 1b                	jle    800609 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005ee:	83 ec 08             	sub    $0x8,%esp
+  8005f1:	53                   	push   %ebx
+  8005f2:	6a 20                	push   $0x20
+  8005f4:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	83 ee 01             	sub    $0x1,%esi
+  8005fc:	75 f0                	jne    8005ee <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+  800604:	e9 67 fd ff ff       	jmp    800370 <vprintfmt+0x11>
+  800609:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060f:	e9 5c fd ff ff       	jmp    800370 <vprintfmt+0x11>
+  800614:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800617:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80061a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80061d:	eb c6                	jmp    8005e5 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80061f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800622:	89 55 10             	mov    %edx,0x10(%ebp)
+  800625:	83 f9 01             	cmp    $0x1,%ecx
+  800628:	7f 1f                	jg     800649 <vprintfmt+0x2ea>
+	else if (lflag)
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	74 67                	je     800695 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 30                	mov    (%eax),%esi
+  800633:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800636:	89 f0                	mov    %esi,%eax
+  800638:	c1 f8 1f             	sar    $0x1f,%eax
+  80063b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8d 40 04             	lea    0x4(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+  800647:	eb 17                	jmp    800660 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8b 50 04             	mov    0x4(%eax),%edx
+  80064f:	8b 00                	mov    (%eax),%eax
+  800651:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800654:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8d 40 08             	lea    0x8(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800660:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800663:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800666:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80066b:	85 c9                	test   %ecx,%ecx
+  80066d:	0f 89 12 01 00 00    	jns    800785 <vprintfmt+0x426>
+				putch('-', putdat);
+  800673:	83 ec 08             	sub    $0x8,%esp
+  800676:	53                   	push   %ebx
+  800677:	6a 2d                	push   $0x2d
+  800679:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80067b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80067e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800681:	f7 da                	neg    %edx
+  800683:	83 d1 00             	adc    $0x0,%ecx
+  800686:	f7 d9                	neg    %ecx
+  800688:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80068b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800690:	e9 f0 00 00 00       	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800695:	8b 45 14             	mov    0x14(%ebp),%eax
+  800698:	8b 30                	mov    (%eax),%esi
+  80069a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80069d:	89 f0                	mov    %esi,%eax
+  80069f:	c1 f8 1f             	sar    $0x1f,%eax
+  8006a2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	eb b0                	jmp    800660 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8006b0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006b3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b6:	83 f9 01             	cmp    $0x1,%ecx
+  8006b9:	7f 1e                	jg     8006d9 <vprintfmt+0x37a>
+	else if (lflag)
+  8006bb:	85 c9                	test   %ecx,%ecx
+  8006bd:	74 32                	je     8006f1 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cf:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006d4:	e9 ac 00 00 00       	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dc:	8b 10                	mov    (%eax),%edx
+  8006de:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e1:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e7:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006ec:	e9 94 00 00 00       	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 10                	mov    (%eax),%edx
+  8006f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800701:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800706:	eb 7d                	jmp    800785 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800708:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80070b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80070e:	83 f9 01             	cmp    $0x1,%ecx
+  800711:	7f 1b                	jg     80072e <vprintfmt+0x3cf>
+	else if (lflag)
+  800713:	85 c9                	test   %ecx,%ecx
+  800715:	74 2c                	je     800743 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800727:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80072c:	eb 57                	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	8b 48 04             	mov    0x4(%eax),%ecx
+  800736:	8d 40 08             	lea    0x8(%eax),%eax
+  800739:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800741:	eb 42                	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	8b 10                	mov    (%eax),%edx
+  800748:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80074d:	8d 40 04             	lea    0x4(%eax),%eax
+  800750:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800753:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800758:	eb 2b                	jmp    800785 <vprintfmt+0x426>
+			putch('0', putdat);
+  80075a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80075d:	83 ec 08             	sub    $0x8,%esp
+  800760:	53                   	push   %ebx
+  800761:	6a 30                	push   $0x30
+  800763:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800765:	83 c4 08             	add    $0x8,%esp
+  800768:	53                   	push   %ebx
+  800769:	6a 78                	push   $0x78
+  80076b:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 10                	mov    (%eax),%edx
+  800772:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800777:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800780:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800785:	83 ec 0c             	sub    $0xc,%esp
+  800788:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80078c:	50                   	push   %eax
+  80078d:	ff 75 e4             	push   -0x1c(%ebp)
+  800790:	56                   	push   %esi
+  800791:	51                   	push   %ecx
+  800792:	52                   	push   %edx
+  800793:	89 da                	mov    %ebx,%edx
+  800795:	89 f8                	mov    %edi,%eax
+  800797:	e8 d8 fa ff ff       	call   800274 <printnum>
+			break;
+  80079c:	83 c4 20             	add    $0x20,%esp
+  80079f:	e9 cc fb ff ff       	jmp    800370 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007a4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007a7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007aa:	83 f9 01             	cmp    $0x1,%ecx
+  8007ad:	7f 1b                	jg     8007ca <vprintfmt+0x46b>
+	else if (lflag)
+  8007af:	85 c9                	test   %ecx,%ecx
+  8007b1:	74 2c                	je     8007df <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c3:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007c8:	eb bb                	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cd:	8b 10                	mov    (%eax),%edx
+  8007cf:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d2:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007dd:	eb a6                	jmp    800785 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8b 10                	mov    (%eax),%edx
+  8007e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ec:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ef:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007f4:	eb 8f                	jmp    800785 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007f6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	53                   	push   %ebx
+  8007fd:	6a 25                	push   $0x25
+  8007ff:	ff d7                	call   *%edi
+			break;
+  800801:	83 c4 10             	add    $0x10,%esp
+  800804:	e9 67 fb ff ff       	jmp    800370 <vprintfmt+0x11>
+			putch('%', putdat);
+  800809:	83 ec 08             	sub    $0x8,%esp
+  80080c:	53                   	push   %ebx
+  80080d:	6a 25                	push   $0x25
+  80080f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800818:	0f 84 ba fb ff ff    	je     8003d8 <vprintfmt+0x79>
+  80081e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800821:	89 f0                	mov    %esi,%eax
+  800823:	83 e8 01             	sub    $0x1,%eax
+  800826:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80082a:	75 f7                	jne    800823 <vprintfmt+0x4c4>
+  80082c:	89 45 10             	mov    %eax,0x10(%ebp)
+  80082f:	e9 3c fb ff ff       	jmp    800370 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800834:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800837:	8d 70 01             	lea    0x1(%eax),%esi
+  80083a:	0f b6 00             	movzbl (%eax),%eax
+  80083d:	0f be d0             	movsbl %al,%edx
+  800840:	85 d2                	test   %edx,%edx
+  800842:	74 11                	je     800855 <vprintfmt+0x4f6>
+  800844:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800847:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80084a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80084d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800850:	e9 5d fd ff ff       	jmp    8005b2 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800855:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800858:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085b:	e9 10 fb ff ff       	jmp    800370 <vprintfmt+0x11>
+  800860:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800863:	89 45 14             	mov    %eax,0x14(%ebp)
+  800866:	e9 05 fb ff ff       	jmp    800370 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  80086b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80086f:	7e 0a                	jle    80087b <vprintfmt+0x51c>
+  800871:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800875:	0f 85 bd fc ff ff    	jne    800538 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80087b:	ba 28 00 00 00       	mov    $0x28,%edx
+  800880:	b8 28 00 00 00       	mov    $0x28,%eax
+  800885:	be 1d 3c 80 00       	mov    $0x803c1d,%esi
+  80088a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80088d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800890:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800893:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800896:	e9 17 fd ff ff       	jmp    8005b2 <vprintfmt+0x253>
+}
+  80089b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80089e:	5b                   	pop    %ebx
+  80089f:	5e                   	pop    %esi
+  8008a0:	5f                   	pop    %edi
+  8008a1:	5d                   	pop    %ebp
+  8008a2:	c3                   	ret
+
+008008a3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	83 ec 18             	sub    $0x18,%esp
+  8008a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008b2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008b6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008c0:	85 c0                	test   %eax,%eax
+  8008c2:	74 26                	je     8008ea <vsnprintf+0x47>
+  8008c4:	85 d2                	test   %edx,%edx
+  8008c6:	7e 22                	jle    8008ea <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008c8:	ff 75 14             	push   0x14(%ebp)
+  8008cb:	ff 75 10             	push   0x10(%ebp)
+  8008ce:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008d1:	50                   	push   %eax
+  8008d2:	68 25 03 80 00       	push   $0x800325
+  8008d7:	e8 83 fa ff ff       	call   80035f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008dc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008df:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008e5:	83 c4 10             	add    $0x10,%esp
+}
+  8008e8:	c9                   	leave
+  8008e9:	c3                   	ret
+		return -E_INVAL;
+  8008ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008ef:	eb f7                	jmp    8008e8 <vsnprintf+0x45>
+
+008008f1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008f7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008fa:	50                   	push   %eax
+  8008fb:	ff 75 10             	push   0x10(%ebp)
+  8008fe:	ff 75 0c             	push   0xc(%ebp)
+  800901:	ff 75 08             	push   0x8(%ebp)
+  800904:	e8 9a ff ff ff       	call   8008a3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+
+0080090b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80090b:	55                   	push   %ebp
+  80090c:	89 e5                	mov    %esp,%ebp
+  80090e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800911:	80 3a 00             	cmpb   $0x0,(%edx)
+  800914:	74 10                	je     800926 <strlen+0x1b>
+  800916:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80091b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80091e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800922:	75 f7                	jne    80091b <strlen+0x10>
+	return n;
+}
+  800924:	5d                   	pop    %ebp
+  800925:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800926:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80092b:	eb f7                	jmp    800924 <strlen+0x19>
+
+0080092d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80092d:	55                   	push   %ebp
+  80092e:	89 e5                	mov    %esp,%ebp
+  800930:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800933:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800936:	85 d2                	test   %edx,%edx
+  800938:	74 16                	je     800950 <strnlen+0x23>
+  80093a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800943:	74 09                	je     80094e <strnlen+0x21>
+		n++;
+  800945:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800948:	39 d0                	cmp    %edx,%eax
+  80094a:	75 f3                	jne    80093f <strnlen+0x12>
+		n++;
+  80094c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800950:	b8 00 00 00 00       	mov    $0x0,%eax
+  800955:	eb f7                	jmp    80094e <strnlen+0x21>
+
+00800957 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800957:	55                   	push   %ebp
+  800958:	89 e5                	mov    %esp,%ebp
+  80095a:	53                   	push   %ebx
+  80095b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80095e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80096a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80096d:	83 c0 01             	add    $0x1,%eax
+  800970:	84 d2                	test   %dl,%dl
+  800972:	75 f2                	jne    800966 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800974:	89 c8                	mov    %ecx,%eax
+  800976:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800979:	c9                   	leave
+  80097a:	c3                   	ret
+
+0080097b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	53                   	push   %ebx
+  80097f:	83 ec 10             	sub    $0x10,%esp
+  800982:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800985:	53                   	push   %ebx
+  800986:	e8 80 ff ff ff       	call   80090b <strlen>
+  80098b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80098e:	ff 75 0c             	push   0xc(%ebp)
+  800991:	01 d8                	add    %ebx,%eax
+  800993:	50                   	push   %eax
+  800994:	e8 be ff ff ff       	call   800957 <strcpy>
+	return dst;
+}
+  800999:	89 d8                	mov    %ebx,%eax
+  80099b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099e:	c9                   	leave
+  80099f:	c3                   	ret
+
+008009a0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	56                   	push   %esi
+  8009a4:	53                   	push   %ebx
+  8009a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009ae:	85 db                	test   %ebx,%ebx
+  8009b0:	74 17                	je     8009c9 <strncpy+0x29>
+  8009b2:	01 f3                	add    %esi,%ebx
+  8009b4:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009b6:	83 c0 01             	add    $0x1,%eax
+  8009b9:	0f b6 0a             	movzbl (%edx),%ecx
+  8009bc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009bf:	80 f9 01             	cmp    $0x1,%cl
+  8009c2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009c5:	39 c3                	cmp    %eax,%ebx
+  8009c7:	75 ed                	jne    8009b6 <strncpy+0x16>
+	}
+	return ret;
+}
+  8009c9:	89 f0                	mov    %esi,%eax
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	56                   	push   %esi
+  8009d3:	53                   	push   %ebx
+  8009d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009dd:	89 f0                	mov    %esi,%eax
+  8009df:	85 db                	test   %ebx,%ebx
+  8009e1:	74 1e                	je     800a01 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009e3:	83 eb 01             	sub    $0x1,%ebx
+  8009e6:	74 16                	je     8009fe <strlcpy+0x2f>
+  8009e8:	01 f3                	add    %esi,%ebx
+  8009ea:	0f b6 0a             	movzbl (%edx),%ecx
+  8009ed:	84 c9                	test   %cl,%cl
+  8009ef:	74 0d                	je     8009fe <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009f1:	83 c2 01             	add    $0x1,%edx
+  8009f4:	83 c0 01             	add    $0x1,%eax
+  8009f7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009fa:	39 d8                	cmp    %ebx,%eax
+  8009fc:	75 ec                	jne    8009ea <strlcpy+0x1b>
+		*dst = '\0';
+  8009fe:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a01:	29 f0                	sub    %esi,%eax
+}
+  800a03:	5b                   	pop    %ebx
+  800a04:	5e                   	pop    %esi
+  800a05:	5d                   	pop    %ebp
+  800a06:	c3                   	ret
+
+00800a07 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a07:	55                   	push   %ebp
+  800a08:	89 e5                	mov    %esp,%ebp
+  800a0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a10:	0f b6 01             	movzbl (%ecx),%eax
+  800a13:	84 c0                	test   %al,%al
+  800a15:	74 11                	je     800a28 <strcmp+0x21>
+  800a17:	38 02                	cmp    %al,(%edx)
+  800a19:	75 0d                	jne    800a28 <strcmp+0x21>
+		p++, q++;
+  800a1b:	83 c1 01             	add    $0x1,%ecx
+  800a1e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a21:	0f b6 01             	movzbl (%ecx),%eax
+  800a24:	84 c0                	test   %al,%al
+  800a26:	75 ef                	jne    800a17 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a28:	0f b6 c0             	movzbl %al,%eax
+  800a2b:	0f b6 12             	movzbl (%edx),%edx
+  800a2e:	29 d0                	sub    %edx,%eax
+}
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	53                   	push   %ebx
+  800a36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a3c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a44:	85 d2                	test   %edx,%edx
+  800a46:	74 2e                	je     800a76 <strncmp+0x44>
+  800a48:	0f b6 01             	movzbl (%ecx),%eax
+  800a4b:	84 c0                	test   %al,%al
+  800a4d:	74 16                	je     800a65 <strncmp+0x33>
+  800a4f:	3a 03                	cmp    (%ebx),%al
+  800a51:	75 12                	jne    800a65 <strncmp+0x33>
+		n--, p++, q++;
+  800a53:	83 c1 01             	add    $0x1,%ecx
+  800a56:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a59:	83 ea 01             	sub    $0x1,%edx
+  800a5c:	75 ea                	jne    800a48 <strncmp+0x16>
+		return 0;
+  800a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a63:	eb 11                	jmp    800a76 <strncmp+0x44>
+  800a65:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a6a:	85 d2                	test   %edx,%edx
+  800a6c:	74 08                	je     800a76 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a6e:	0f b6 01             	movzbl (%ecx),%eax
+  800a71:	0f b6 13             	movzbl (%ebx),%edx
+  800a74:	29 d0                	sub    %edx,%eax
+}
+  800a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a79:	c9                   	leave
+  800a7a:	c3                   	ret
+
+00800a7b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a7b:	55                   	push   %ebp
+  800a7c:	89 e5                	mov    %esp,%ebp
+  800a7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a81:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a85:	0f b6 10             	movzbl (%eax),%edx
+  800a88:	84 d2                	test   %dl,%dl
+  800a8a:	74 15                	je     800aa1 <strchr+0x26>
+		if (*s == c)
+  800a8c:	38 d1                	cmp    %dl,%cl
+  800a8e:	74 0f                	je     800a9f <strchr+0x24>
+	for (; *s; s++)
+  800a90:	83 c0 01             	add    $0x1,%eax
+  800a93:	0f b6 10             	movzbl (%eax),%edx
+  800a96:	84 d2                	test   %dl,%dl
+  800a98:	75 f2                	jne    800a8c <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a9f:	5d                   	pop    %ebp
+  800aa0:	c3                   	ret
+	return 0;
+  800aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa6:	eb f7                	jmp    800a9f <strchr+0x24>
+
+00800aa8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	53                   	push   %ebx
+  800aac:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ab2:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ab5:	38 d3                	cmp    %dl,%bl
+  800ab7:	74 14                	je     800acd <strfind+0x25>
+  800ab9:	89 d1                	mov    %edx,%ecx
+  800abb:	84 db                	test   %bl,%bl
+  800abd:	74 0e                	je     800acd <strfind+0x25>
+	for (; *s; s++)
+  800abf:	83 c0 01             	add    $0x1,%eax
+  800ac2:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800ac5:	38 ca                	cmp    %cl,%dl
+  800ac7:	74 04                	je     800acd <strfind+0x25>
+  800ac9:	84 d2                	test   %dl,%dl
+  800acb:	75 f2                	jne    800abf <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800acd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad0:	c9                   	leave
+  800ad1:	c3                   	ret
+
+00800ad2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ad9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800adc:	85 c9                	test   %ecx,%ecx
+  800ade:	74 20                	je     800b00 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ae0:	89 f8                	mov    %edi,%eax
+  800ae2:	09 c8                	or     %ecx,%eax
+  800ae4:	a8 03                	test   $0x3,%al
+  800ae6:	75 12                	jne    800afa <memset+0x28>
+		c &= 0xFF;
+  800ae8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800aec:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800af2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800af5:	fc                   	cld
+  800af6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800af8:	eb 06                	jmp    800b00 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800afa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800afd:	fc                   	cld
+  800afe:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b00:	89 f8                	mov    %edi,%eax
+  800b02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b05:	c9                   	leave
+  800b06:	c3                   	ret
+
+00800b07 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	57                   	push   %edi
+  800b0b:	56                   	push   %esi
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b15:	39 c6                	cmp    %eax,%esi
+  800b17:	73 32                	jae    800b4b <memmove+0x44>
+  800b19:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b1c:	39 d0                	cmp    %edx,%eax
+  800b1e:	73 2b                	jae    800b4b <memmove+0x44>
+		s += n;
+		d += n;
+  800b20:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b23:	89 d6                	mov    %edx,%esi
+  800b25:	09 fe                	or     %edi,%esi
+  800b27:	09 ce                	or     %ecx,%esi
+  800b29:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b2f:	75 0e                	jne    800b3f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b31:	83 ef 04             	sub    $0x4,%edi
+  800b34:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b37:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b3a:	fd                   	std
+  800b3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b3d:	eb 09                	jmp    800b48 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b3f:	83 ef 01             	sub    $0x1,%edi
+  800b42:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b45:	fd                   	std
+  800b46:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b48:	fc                   	cld
+  800b49:	eb 1a                	jmp    800b65 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b4b:	89 f2                	mov    %esi,%edx
+  800b4d:	09 c2                	or     %eax,%edx
+  800b4f:	09 ca                	or     %ecx,%edx
+  800b51:	f6 c2 03             	test   $0x3,%dl
+  800b54:	75 0a                	jne    800b60 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b56:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b59:	89 c7                	mov    %eax,%edi
+  800b5b:	fc                   	cld
+  800b5c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b5e:	eb 05                	jmp    800b65 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b60:	89 c7                	mov    %eax,%edi
+  800b62:	fc                   	cld
+  800b63:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b65:	5e                   	pop    %esi
+  800b66:	5f                   	pop    %edi
+  800b67:	5d                   	pop    %ebp
+  800b68:	c3                   	ret
+
+00800b69 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b69:	55                   	push   %ebp
+  800b6a:	89 e5                	mov    %esp,%ebp
+  800b6c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b6f:	ff 75 10             	push   0x10(%ebp)
+  800b72:	ff 75 0c             	push   0xc(%ebp)
+  800b75:	ff 75 08             	push   0x8(%ebp)
+  800b78:	e8 8a ff ff ff       	call   800b07 <memmove>
+}
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+00800b7f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	56                   	push   %esi
+  800b83:	53                   	push   %ebx
+  800b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b8a:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b8d:	85 f6                	test   %esi,%esi
+  800b8f:	74 29                	je     800bba <memcmp+0x3b>
+  800b91:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b93:	0f b6 08             	movzbl (%eax),%ecx
+  800b96:	0f b6 1a             	movzbl (%edx),%ebx
+  800b99:	38 d9                	cmp    %bl,%cl
+  800b9b:	75 11                	jne    800bae <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b9d:	83 c0 01             	add    $0x1,%eax
+  800ba0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ba3:	39 c6                	cmp    %eax,%esi
+  800ba5:	75 ec                	jne    800b93 <memcmp+0x14>
+	}
+
+	return 0;
+  800ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bac:	eb 08                	jmp    800bb6 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800bae:	0f b6 c1             	movzbl %cl,%eax
+  800bb1:	0f b6 db             	movzbl %bl,%ebx
+  800bb4:	29 d8                	sub    %ebx,%eax
+}
+  800bb6:	5b                   	pop    %ebx
+  800bb7:	5e                   	pop    %esi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+	return 0;
+  800bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbf:	eb f5                	jmp    800bb6 <memcmp+0x37>
+
+00800bc1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800bca:	89 c2                	mov    %eax,%edx
+  800bcc:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800bcf:	39 d0                	cmp    %edx,%eax
+  800bd1:	73 0d                	jae    800be0 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800bd3:	38 08                	cmp    %cl,(%eax)
+  800bd5:	74 0d                	je     800be4 <memfind+0x23>
+	for (; s < ends; s++)
+  800bd7:	83 c0 01             	add    $0x1,%eax
+  800bda:	39 c2                	cmp    %eax,%edx
+  800bdc:	75 f5                	jne    800bd3 <memfind+0x12>
+  800bde:	eb 06                	jmp    800be6 <memfind+0x25>
+  800be0:	89 c2                	mov    %eax,%edx
+  800be2:	eb 02                	jmp    800be6 <memfind+0x25>
+  800be4:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800be6:	89 d0                	mov    %edx,%eax
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	57                   	push   %edi
+  800bee:	56                   	push   %esi
+  800bef:	53                   	push   %ebx
+  800bf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bf6:	0f b6 02             	movzbl (%edx),%eax
+  800bf9:	3c 20                	cmp    $0x20,%al
+  800bfb:	74 04                	je     800c01 <strtol+0x17>
+  800bfd:	3c 09                	cmp    $0x9,%al
+  800bff:	75 0e                	jne    800c0f <strtol+0x25>
+		s++;
+  800c01:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c04:	0f b6 02             	movzbl (%edx),%eax
+  800c07:	3c 20                	cmp    $0x20,%al
+  800c09:	74 f6                	je     800c01 <strtol+0x17>
+  800c0b:	3c 09                	cmp    $0x9,%al
+  800c0d:	74 f2                	je     800c01 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c0f:	3c 2b                	cmp    $0x2b,%al
+  800c11:	74 2a                	je     800c3d <strtol+0x53>
+	int neg = 0;
+  800c13:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c18:	3c 2d                	cmp    $0x2d,%al
+  800c1a:	74 2b                	je     800c47 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c1c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c22:	75 0f                	jne    800c33 <strtol+0x49>
+  800c24:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c27:	74 28                	je     800c51 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c29:	85 db                	test   %ebx,%ebx
+  800c2b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c30:	0f 44 d8             	cmove  %eax,%ebx
+  800c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c38:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c3b:	eb 46                	jmp    800c83 <strtol+0x99>
+		s++;
+  800c3d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c45:	eb d5                	jmp    800c1c <strtol+0x32>
+		s++, neg = 1;
+  800c47:	83 c2 01             	add    $0x1,%edx
+  800c4a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c4f:	eb cb                	jmp    800c1c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c51:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c55:	74 0e                	je     800c65 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c57:	85 db                	test   %ebx,%ebx
+  800c59:	75 d8                	jne    800c33 <strtol+0x49>
+		s++, base = 8;
+  800c5b:	83 c2 01             	add    $0x1,%edx
+  800c5e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c63:	eb ce                	jmp    800c33 <strtol+0x49>
+		s += 2, base = 16;
+  800c65:	83 c2 02             	add    $0x2,%edx
+  800c68:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c6d:	eb c4                	jmp    800c33 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c6f:	0f be c0             	movsbl %al,%eax
+  800c72:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c75:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c78:	7d 3a                	jge    800cb4 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c7a:	83 c2 01             	add    $0x1,%edx
+  800c7d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c81:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c83:	0f b6 02             	movzbl (%edx),%eax
+  800c86:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c89:	89 f3                	mov    %esi,%ebx
+  800c8b:	80 fb 09             	cmp    $0x9,%bl
+  800c8e:	76 df                	jbe    800c6f <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c90:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c93:	89 f3                	mov    %esi,%ebx
+  800c95:	80 fb 19             	cmp    $0x19,%bl
+  800c98:	77 08                	ja     800ca2 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c9a:	0f be c0             	movsbl %al,%eax
+  800c9d:	83 e8 57             	sub    $0x57,%eax
+  800ca0:	eb d3                	jmp    800c75 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ca2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ca5:	89 f3                	mov    %esi,%ebx
+  800ca7:	80 fb 19             	cmp    $0x19,%bl
+  800caa:	77 08                	ja     800cb4 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800cac:	0f be c0             	movsbl %al,%eax
+  800caf:	83 e8 37             	sub    $0x37,%eax
+  800cb2:	eb c1                	jmp    800c75 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800cb4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cb8:	74 05                	je     800cbf <strtol+0xd5>
+		*endptr = (char *) s;
+  800cba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cbd:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cbf:	89 c8                	mov    %ecx,%eax
+  800cc1:	f7 d8                	neg    %eax
+  800cc3:	85 ff                	test   %edi,%edi
+  800cc5:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800cc8:	89 c8                	mov    %ecx,%eax
+  800cca:	5b                   	pop    %ebx
+  800ccb:	5e                   	pop    %esi
+  800ccc:	5f                   	pop    %edi
+  800ccd:	5d                   	pop    %ebp
+  800cce:	c3                   	ret
+
+00800ccf <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ccf:	55                   	push   %ebp
+  800cd0:	89 e5                	mov    %esp,%ebp
+  800cd2:	57                   	push   %edi
+  800cd3:	56                   	push   %esi
+  800cd4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce0:	89 c3                	mov    %eax,%ebx
+  800ce2:	89 c7                	mov    %eax,%edi
+  800ce4:	89 c6                	mov    %eax,%esi
+  800ce6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ce8:	5b                   	pop    %ebx
+  800ce9:	5e                   	pop    %esi
+  800cea:	5f                   	pop    %edi
+  800ceb:	5d                   	pop    %ebp
+  800cec:	c3                   	ret
+
+00800ced <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cfd:	89 d1                	mov    %edx,%ecx
+  800cff:	89 d3                	mov    %edx,%ebx
+  800d01:	89 d7                	mov    %edx,%edi
+  800d03:	89 d6                	mov    %edx,%esi
+  800d05:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+
+00800d0c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d22:	89 cb                	mov    %ecx,%ebx
+  800d24:	89 cf                	mov    %ecx,%edi
+  800d26:	89 ce                	mov    %ecx,%esi
+  800d28:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d2a:	85 c0                	test   %eax,%eax
+  800d2c:	7f 08                	jg     800d36 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d31:	5b                   	pop    %ebx
+  800d32:	5e                   	pop    %esi
+  800d33:	5f                   	pop    %edi
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d36:	83 ec 0c             	sub    $0xc,%esp
+  800d39:	50                   	push   %eax
+  800d3a:	6a 03                	push   $0x3
+  800d3c:	68 4b 3f 80 00       	push   $0x803f4b
+  800d41:	6a 23                	push   $0x23
+  800d43:	68 68 3f 80 00       	push   $0x803f68
+  800d48:	e8 38 f4 ff ff       	call   800185 <_panic>
+
+00800d4d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d58:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d5d:	89 d1                	mov    %edx,%ecx
+  800d5f:	89 d3                	mov    %edx,%ebx
+  800d61:	89 d7                	mov    %edx,%edi
+  800d63:	89 d6                	mov    %edx,%esi
+  800d65:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+
+00800d6c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d77:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d7c:	89 d1                	mov    %edx,%ecx
+  800d7e:	89 d3                	mov    %edx,%ebx
+  800d80:	89 d7                	mov    %edx,%edi
+  800d82:	89 d6                	mov    %edx,%esi
+  800d84:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+
+00800d8b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d8b:	55                   	push   %ebp
+  800d8c:	89 e5                	mov    %esp,%ebp
+  800d8e:	57                   	push   %edi
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d94:	be 00 00 00 00       	mov    $0x0,%esi
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800da4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da7:	89 f7                	mov    %esi,%edi
+  800da9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dab:	85 c0                	test   %eax,%eax
+  800dad:	7f 08                	jg     800db7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800daf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db2:	5b                   	pop    %ebx
+  800db3:	5e                   	pop    %esi
+  800db4:	5f                   	pop    %edi
+  800db5:	5d                   	pop    %ebp
+  800db6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+  800dba:	50                   	push   %eax
+  800dbb:	6a 04                	push   $0x4
+  800dbd:	68 4b 3f 80 00       	push   $0x803f4b
+  800dc2:	6a 23                	push   $0x23
+  800dc4:	68 68 3f 80 00       	push   $0x803f68
+  800dc9:	e8 b7 f3 ff ff       	call   800185 <_panic>
+
+00800dce <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800de2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800deb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ded:	85 c0                	test   %eax,%eax
+  800def:	7f 08                	jg     800df9 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df4:	5b                   	pop    %ebx
+  800df5:	5e                   	pop    %esi
+  800df6:	5f                   	pop    %edi
+  800df7:	5d                   	pop    %ebp
+  800df8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+  800dfc:	50                   	push   %eax
+  800dfd:	6a 05                	push   $0x5
+  800dff:	68 4b 3f 80 00       	push   $0x803f4b
+  800e04:	6a 23                	push   $0x23
+  800e06:	68 68 3f 80 00       	push   $0x803f68
+  800e0b:	e8 75 f3 ff ff       	call   800185 <_panic>
+
+00800e10 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e24:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e29:	89 df                	mov    %ebx,%edi
+  800e2b:	89 de                	mov    %ebx,%esi
+  800e2d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e2f:	85 c0                	test   %eax,%eax
+  800e31:	7f 08                	jg     800e3b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e36:	5b                   	pop    %ebx
+  800e37:	5e                   	pop    %esi
+  800e38:	5f                   	pop    %edi
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+  800e3e:	50                   	push   %eax
+  800e3f:	6a 06                	push   $0x6
+  800e41:	68 4b 3f 80 00       	push   $0x803f4b
+  800e46:	6a 23                	push   $0x23
+  800e48:	68 68 3f 80 00       	push   $0x803f68
+  800e4d:	e8 33 f3 ff ff       	call   800185 <_panic>
+
+00800e52 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e60:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e66:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e6b:	89 df                	mov    %ebx,%edi
+  800e6d:	89 de                	mov    %ebx,%esi
+  800e6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e71:	85 c0                	test   %eax,%eax
+  800e73:	7f 08                	jg     800e7d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e78:	5b                   	pop    %ebx
+  800e79:	5e                   	pop    %esi
+  800e7a:	5f                   	pop    %edi
+  800e7b:	5d                   	pop    %ebp
+  800e7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  800e80:	50                   	push   %eax
+  800e81:	6a 08                	push   $0x8
+  800e83:	68 4b 3f 80 00       	push   $0x803f4b
+  800e88:	6a 23                	push   $0x23
+  800e8a:	68 68 3f 80 00       	push   $0x803f68
+  800e8f:	e8 f1 f2 ff ff       	call   800185 <_panic>
+
+00800e94 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea8:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ead:	89 df                	mov    %ebx,%edi
+  800eaf:	89 de                	mov    %ebx,%esi
+  800eb1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	7f 08                	jg     800ebf <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800eb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebf:	83 ec 0c             	sub    $0xc,%esp
+  800ec2:	50                   	push   %eax
+  800ec3:	6a 09                	push   $0x9
+  800ec5:	68 4b 3f 80 00       	push   $0x803f4b
+  800eca:	6a 23                	push   $0x23
+  800ecc:	68 68 3f 80 00       	push   $0x803f68
+  800ed1:	e8 af f2 ff ff       	call   800185 <_panic>
+
+00800ed6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800edf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eef:	89 df                	mov    %ebx,%edi
+  800ef1:	89 de                	mov    %ebx,%esi
+  800ef3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef5:	85 c0                	test   %eax,%eax
+  800ef7:	7f 08                	jg     800f01 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ef9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f01:	83 ec 0c             	sub    $0xc,%esp
+  800f04:	50                   	push   %eax
+  800f05:	6a 0a                	push   $0xa
+  800f07:	68 4b 3f 80 00       	push   $0x803f4b
+  800f0c:	6a 23                	push   $0x23
+  800f0e:	68 68 3f 80 00       	push   $0x803f68
+  800f13:	e8 6d f2 ff ff       	call   800185 <_panic>
+
+00800f18 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f29:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f34:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f51:	89 cb                	mov    %ecx,%ebx
+  800f53:	89 cf                	mov    %ecx,%edi
+  800f55:	89 ce                	mov    %ecx,%esi
+  800f57:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f59:	85 c0                	test   %eax,%eax
+  800f5b:	7f 08                	jg     800f65 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f65:	83 ec 0c             	sub    $0xc,%esp
+  800f68:	50                   	push   %eax
+  800f69:	6a 0d                	push   $0xd
+  800f6b:	68 4b 3f 80 00       	push   $0x803f4b
+  800f70:	6a 23                	push   $0x23
+  800f72:	68 68 3f 80 00       	push   $0x803f68
+  800f77:	e8 09 f2 ff ff       	call   800185 <_panic>
+
+00800f7c <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f93:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f96:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+  800fa3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fb6:	89 df                	mov    %ebx,%edi
+  800fb8:	89 de                	mov    %ebx,%esi
+  800fba:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fbc:	85 c0                	test   %eax,%eax
+  800fbe:	7f 08                	jg     800fc8 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800fc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc3:	5b                   	pop    %ebx
+  800fc4:	5e                   	pop    %esi
+  800fc5:	5f                   	pop    %edi
+  800fc6:	5d                   	pop    %ebp
+  800fc7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc8:	83 ec 0c             	sub    $0xc,%esp
+  800fcb:	50                   	push   %eax
+  800fcc:	6a 0d                	push   $0xd
+  800fce:	68 4b 3f 80 00       	push   $0x803f4b
+  800fd3:	6a 23                	push   $0x23
+  800fd5:	68 68 3f 80 00       	push   $0x803f68
+  800fda:	e8 a6 f1 ff ff       	call   800185 <_panic>
+
+00800fdf <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fef:	89 d1                	mov    %edx,%ecx
+  800ff1:	89 d3                	mov    %edx,%ebx
+  800ff3:	89 d7                	mov    %edx,%edi
+  800ff5:	89 d6                	mov    %edx,%esi
+  800ff7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ff9:	5b                   	pop    %ebx
+  800ffa:	5e                   	pop    %esi
+  800ffb:	5f                   	pop    %edi
+  800ffc:	5d                   	pop    %ebp
+  800ffd:	c3                   	ret
+
+00800ffe <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800ffe:	55                   	push   %ebp
+  800fff:	89 e5                	mov    %esp,%ebp
+  801001:	57                   	push   %edi
+  801002:	56                   	push   %esi
+  801003:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801004:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801009:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801014:	89 df                	mov    %ebx,%edi
+  801016:	89 de                	mov    %ebx,%esi
+  801018:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801025:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801032:	89 cb                	mov    %ecx,%ebx
+  801034:	89 cf                	mov    %ecx,%edi
+  801036:	89 ce                	mov    %ecx,%esi
+  801038:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80103a:	5b                   	pop    %ebx
+  80103b:	5e                   	pop    %esi
+  80103c:	5f                   	pop    %edi
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+
+0080103f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+  801042:	57                   	push   %edi
+  801043:	56                   	push   %esi
+  801044:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801045:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801050:	b8 11 00 00 00       	mov    $0x11,%eax
+  801055:	89 df                	mov    %ebx,%edi
+  801057:	89 de                	mov    %ebx,%esi
+  801059:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80105b:	5b                   	pop    %ebx
+  80105c:	5e                   	pop    %esi
+  80105d:	5f                   	pop    %edi
+  80105e:	5d                   	pop    %ebp
+  80105f:	c3                   	ret
+
+00801060 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801066:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	b8 12 00 00 00       	mov    $0x12,%eax
+  801076:	89 df                	mov    %ebx,%edi
+  801078:	89 de                	mov    %ebx,%esi
+  80107a:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+
+00801081 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	57                   	push   %edi
+  801085:	56                   	push   %esi
+  801086:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801087:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801094:	89 cb                	mov    %ecx,%ebx
+  801096:	89 cf                	mov    %ecx,%edi
+  801098:	89 ce                	mov    %ecx,%esi
+  80109a:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+
+008010a1 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010b7:	89 df                	mov    %ebx,%edi
+  8010b9:	89 de                	mov    %ebx,%esi
+  8010bb:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010bd:	5b                   	pop    %ebx
+  8010be:	5e                   	pop    %esi
+  8010bf:	5f                   	pop    %edi
+  8010c0:	5d                   	pop    %ebp
+  8010c1:	c3                   	ret
+
+008010c2 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010c2:	55                   	push   %ebp
+  8010c3:	89 e5                	mov    %esp,%ebp
+  8010c5:	57                   	push   %edi
+  8010c6:	56                   	push   %esi
+  8010c7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010d5:	89 cb                	mov    %ecx,%ebx
+  8010d7:	89 cf                	mov    %ecx,%edi
+  8010d9:	89 ce                	mov    %ecx,%esi
+  8010db:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010dd:	5b                   	pop    %ebx
+  8010de:	5e                   	pop    %esi
+  8010df:	5f                   	pop    %edi
+  8010e0:	5d                   	pop    %ebp
+  8010e1:	c3                   	ret
+
+008010e2 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fb:	89 f7                	mov    %esi,%edi
+  8010fd:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010ff:	5b                   	pop    %ebx
+  801100:	5e                   	pop    %esi
+  801101:	5f                   	pop    %edi
+  801102:	5d                   	pop    %ebp
+  801103:	c3                   	ret
+
+00801104 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801104:	55                   	push   %ebp
+  801105:	89 e5                	mov    %esp,%ebp
+  801107:	57                   	push   %edi
+  801108:	56                   	push   %esi
+  801109:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801115:	b8 17 00 00 00       	mov    $0x17,%eax
+  80111a:	89 df                	mov    %ebx,%edi
+  80111c:	89 de                	mov    %ebx,%esi
+  80111e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5f                   	pop    %edi
+  801123:	5d                   	pop    %ebp
+  801124:	c3                   	ret
+
+00801125 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	b8 18 00 00 00       	mov    $0x18,%eax
+  801138:	89 cb                	mov    %ecx,%ebx
+  80113a:	89 cf                	mov    %ecx,%edi
+  80113c:	89 ce                	mov    %ecx,%esi
+  80113e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80114b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80114f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 19 00 00 00       	mov    $0x19,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	cd 30                	int    $0x30
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116d:	be 00 00 00 00       	mov    $0x0,%esi
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80117d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801180:	89 f7                	mov    %esi,%edi
+  801182:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118f:	be 00 00 00 00       	mov    $0x0,%esi
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80119f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a2:	89 f7                	mov    %esi,%edi
+  8011a4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011a6:	5b                   	pop    %ebx
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5f                   	pop    %edi
+  8011a9:	5d                   	pop    %ebp
+  8011aa:	c3                   	ret
+
+008011ab <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	57                   	push   %edi
+  8011af:	56                   	push   %esi
+  8011b0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011c1:	89 df                	mov    %ebx,%edi
+  8011c3:	89 de                	mov    %ebx,%esi
+  8011c5:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011c7:	5b                   	pop    %ebx
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5f                   	pop    %edi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+
+008011cc <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011cc:	55                   	push   %ebp
+  8011cd:	89 e5                	mov    %esp,%ebp
+  8011cf:	57                   	push   %edi
+  8011d0:	56                   	push   %esi
+  8011d1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e5:	89 f7                	mov    %esi,%edi
+  8011e7:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+
+008011ee <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011ee:	55                   	push   %ebp
+  8011ef:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011f9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011fc:	5d                   	pop    %ebp
+  8011fd:	c3                   	ret
+
+008011fe <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011fe:	55                   	push   %ebp
+  8011ff:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801201:	8b 45 08             	mov    0x8(%ebp),%eax
+  801204:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801209:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80120e:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+
+00801215 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80121d:	89 c2                	mov    %eax,%edx
+  80121f:	c1 ea 16             	shr    $0x16,%edx
+  801222:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801229:	f6 c2 01             	test   $0x1,%dl
+  80122c:	74 29                	je     801257 <fd_alloc+0x42>
+  80122e:	89 c2                	mov    %eax,%edx
+  801230:	c1 ea 0c             	shr    $0xc,%edx
+  801233:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80123a:	f6 c2 01             	test   $0x1,%dl
+  80123d:	74 18                	je     801257 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80123f:	05 00 10 00 00       	add    $0x1000,%eax
+  801244:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801249:	75 d2                	jne    80121d <fd_alloc+0x8>
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801250:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801255:	eb 05                	jmp    80125c <fd_alloc+0x47>
+			return 0;
+  801257:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	89 02                	mov    %eax,(%edx)
+}
+  801261:	89 c8                	mov    %ecx,%eax
+  801263:	5d                   	pop    %ebp
+  801264:	c3                   	ret
+
+00801265 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801265:	55                   	push   %ebp
+  801266:	89 e5                	mov    %esp,%ebp
+  801268:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80126b:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801270:	77 30                	ja     8012a2 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801272:	c1 e0 0c             	shl    $0xc,%eax
+  801275:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80127a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801280:	f6 c2 01             	test   $0x1,%dl
+  801283:	74 24                	je     8012a9 <fd_lookup+0x44>
+  801285:	89 c2                	mov    %eax,%edx
+  801287:	c1 ea 0c             	shr    $0xc,%edx
+  80128a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801291:	f6 c2 01             	test   $0x1,%dl
+  801294:	74 1a                	je     8012b0 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801296:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801299:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80129b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+		return -E_INVAL;
+  8012a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a7:	eb f7                	jmp    8012a0 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8012a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ae:	eb f0                	jmp    8012a0 <fd_lookup+0x3b>
+  8012b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012b5:	eb e9                	jmp    8012a0 <fd_lookup+0x3b>
+
+008012b7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012b7:	55                   	push   %ebp
+  8012b8:	89 e5                	mov    %esp,%ebp
+  8012ba:	53                   	push   %ebx
+  8012bb:	83 ec 04             	sub    $0x4,%esp
+  8012be:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c6:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8012cb:	39 13                	cmp    %edx,(%ebx)
+  8012cd:	74 54                	je     801323 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8012cf:	83 c0 01             	add    $0x1,%eax
+  8012d2:	8b 1c 85 f4 3f 80 00 	mov    0x803ff4(,%eax,4),%ebx
+  8012d9:	85 db                	test   %ebx,%ebx
+  8012db:	75 ee                	jne    8012cb <dev_lookup+0x14>
+  8012dd:	89 e1                	mov    %esp,%ecx
+  8012df:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012e4:	29 c8                	sub    %ecx,%eax
+  8012e6:	89 c1                	mov    %eax,%ecx
+  8012e8:	c1 e9 0f             	shr    $0xf,%ecx
+  8012eb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f5:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012f8:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  8012ff:	8b 40 48             	mov    0x48(%eax),%eax
+  801302:	83 ec 04             	sub    $0x4,%esp
+  801305:	52                   	push   %edx
+  801306:	50                   	push   %eax
+  801307:	68 78 3f 80 00       	push   $0x803f78
+  80130c:	e8 4f ef ff ff       	call   800260 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801311:	83 c4 10             	add    $0x10,%esp
+  801314:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801319:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80131c:	89 1a                	mov    %ebx,(%edx)
+}
+  80131e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801321:	c9                   	leave
+  801322:	c3                   	ret
+			return 0;
+  801323:	b8 00 00 00 00       	mov    $0x0,%eax
+  801328:	eb ef                	jmp    801319 <dev_lookup+0x62>
+
+0080132a <fd_close>:
+{
+  80132a:	55                   	push   %ebp
+  80132b:	89 e5                	mov    %esp,%ebp
+  80132d:	57                   	push   %edi
+  80132e:	56                   	push   %esi
+  80132f:	53                   	push   %ebx
+  801330:	83 ec 24             	sub    $0x24,%esp
+  801333:	8b 75 08             	mov    0x8(%ebp),%esi
+  801336:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801339:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80133c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80133d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801343:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801346:	50                   	push   %eax
+  801347:	e8 19 ff ff ff       	call   801265 <fd_lookup>
+  80134c:	89 c3                	mov    %eax,%ebx
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	78 05                	js     80135a <fd_close+0x30>
+	    || fd != fd2)
+  801355:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801358:	74 0f                	je     801369 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80135a:	85 ff                	test   %edi,%edi
+  80135c:	0f 44 df             	cmove  %edi,%ebx
+}
+  80135f:	89 d8                	mov    %ebx,%eax
+  801361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801369:	83 ec 08             	sub    $0x8,%esp
+  80136c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80136f:	50                   	push   %eax
+  801370:	ff 36                	push   (%esi)
+  801372:	e8 40 ff ff ff       	call   8012b7 <dev_lookup>
+  801377:	89 c3                	mov    %eax,%ebx
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	78 1a                	js     80139a <fd_close+0x70>
+		if (dev->dev_close)
+  801380:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801383:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801386:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80138b:	85 c0                	test   %eax,%eax
+  80138d:	74 0b                	je     80139a <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80138f:	83 ec 0c             	sub    $0xc,%esp
+  801392:	56                   	push   %esi
+  801393:	ff d0                	call   *%eax
+  801395:	89 c3                	mov    %eax,%ebx
+  801397:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80139a:	83 ec 08             	sub    $0x8,%esp
+  80139d:	56                   	push   %esi
+  80139e:	6a 00                	push   $0x0
+  8013a0:	e8 6b fa ff ff       	call   800e10 <sys_page_unmap>
+	return r;
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	eb b5                	jmp    80135f <fd_close+0x35>
+
+008013aa <close>:
+
+int
+close(int fdnum)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	ff 75 08             	push   0x8(%ebp)
+  8013b7:	e8 a9 fe ff ff       	call   801265 <fd_lookup>
+  8013bc:	83 c4 10             	add    $0x10,%esp
+  8013bf:	85 c0                	test   %eax,%eax
+  8013c1:	79 02                	jns    8013c5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+		return fd_close(fd, 1);
+  8013c5:	83 ec 08             	sub    $0x8,%esp
+  8013c8:	6a 01                	push   $0x1
+  8013ca:	ff 75 f4             	push   -0xc(%ebp)
+  8013cd:	e8 58 ff ff ff       	call   80132a <fd_close>
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	eb ec                	jmp    8013c3 <close+0x19>
+
+008013d7 <close_all>:
+
+void
+close_all(void)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	53                   	push   %ebx
+  8013db:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	53                   	push   %ebx
+  8013e7:	e8 be ff ff ff       	call   8013aa <close>
+	for (i = 0; i < MAXFD; i++)
+  8013ec:	83 c3 01             	add    $0x1,%ebx
+  8013ef:	83 c4 10             	add    $0x10,%esp
+  8013f2:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8013f8:	75 e9                	jne    8013e3 <close_all+0xc>
+}
+  8013fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013fd:	c9                   	leave
+  8013fe:	c3                   	ret
+
+008013ff <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013ff:	55                   	push   %ebp
+  801400:	89 e5                	mov    %esp,%ebp
+  801402:	57                   	push   %edi
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+  801405:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801408:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80140b:	50                   	push   %eax
+  80140c:	ff 75 08             	push   0x8(%ebp)
+  80140f:	e8 51 fe ff ff       	call   801265 <fd_lookup>
+  801414:	89 c3                	mov    %eax,%ebx
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	85 c0                	test   %eax,%eax
+  80141b:	78 7f                	js     80149c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	ff 75 0c             	push   0xc(%ebp)
+  801423:	e8 82 ff ff ff       	call   8013aa <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801428:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80142b:	c1 e6 0c             	shl    $0xc,%esi
+  80142e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801434:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801437:	89 3c 24             	mov    %edi,(%esp)
+  80143a:	e8 bf fd ff ff       	call   8011fe <fd2data>
+  80143f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801441:	89 34 24             	mov    %esi,(%esp)
+  801444:	e8 b5 fd ff ff       	call   8011fe <fd2data>
+  801449:	83 c4 10             	add    $0x10,%esp
+  80144c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80144f:	89 d8                	mov    %ebx,%eax
+  801451:	c1 e8 16             	shr    $0x16,%eax
+  801454:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80145b:	a8 01                	test   $0x1,%al
+  80145d:	74 11                	je     801470 <dup+0x71>
+  80145f:	89 d8                	mov    %ebx,%eax
+  801461:	c1 e8 0c             	shr    $0xc,%eax
+  801464:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80146b:	f6 c2 01             	test   $0x1,%dl
+  80146e:	75 36                	jne    8014a6 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801470:	89 f8                	mov    %edi,%eax
+  801472:	c1 e8 0c             	shr    $0xc,%eax
+  801475:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80147c:	83 ec 0c             	sub    $0xc,%esp
+  80147f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801484:	50                   	push   %eax
+  801485:	56                   	push   %esi
+  801486:	6a 00                	push   $0x0
+  801488:	57                   	push   %edi
+  801489:	6a 00                	push   $0x0
+  80148b:	e8 3e f9 ff ff       	call   800dce <sys_page_map>
+  801490:	89 c3                	mov    %eax,%ebx
+  801492:	83 c4 20             	add    $0x20,%esp
+  801495:	85 c0                	test   %eax,%eax
+  801497:	78 33                	js     8014cc <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801499:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80149c:	89 d8                	mov    %ebx,%eax
+  80149e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a1:	5b                   	pop    %ebx
+  8014a2:	5e                   	pop    %esi
+  8014a3:	5f                   	pop    %edi
+  8014a4:	5d                   	pop    %ebp
+  8014a5:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014a6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014ad:	83 ec 0c             	sub    $0xc,%esp
+  8014b0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014b5:	50                   	push   %eax
+  8014b6:	ff 75 d4             	push   -0x2c(%ebp)
+  8014b9:	6a 00                	push   $0x0
+  8014bb:	53                   	push   %ebx
+  8014bc:	6a 00                	push   $0x0
+  8014be:	e8 0b f9 ff ff       	call   800dce <sys_page_map>
+  8014c3:	89 c3                	mov    %eax,%ebx
+  8014c5:	83 c4 20             	add    $0x20,%esp
+  8014c8:	85 c0                	test   %eax,%eax
+  8014ca:	79 a4                	jns    801470 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014cc:	83 ec 08             	sub    $0x8,%esp
+  8014cf:	56                   	push   %esi
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	e8 39 f9 ff ff       	call   800e10 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014d7:	83 c4 08             	add    $0x8,%esp
+  8014da:	ff 75 d4             	push   -0x2c(%ebp)
+  8014dd:	6a 00                	push   $0x0
+  8014df:	e8 2c f9 ff ff       	call   800e10 <sys_page_unmap>
+	return r;
+  8014e4:	83 c4 10             	add    $0x10,%esp
+  8014e7:	eb b3                	jmp    80149c <dup+0x9d>
+
+008014e9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	56                   	push   %esi
+  8014ed:	53                   	push   %ebx
+  8014ee:	83 ec 18             	sub    $0x18,%esp
+  8014f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f7:	50                   	push   %eax
+  8014f8:	53                   	push   %ebx
+  8014f9:	e8 67 fd ff ff       	call   801265 <fd_lookup>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	78 3c                	js     801541 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801505:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801508:	83 ec 08             	sub    $0x8,%esp
+  80150b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150e:	50                   	push   %eax
+  80150f:	ff 36                	push   (%esi)
+  801511:	e8 a1 fd ff ff       	call   8012b7 <dev_lookup>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 24                	js     801541 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80151d:	8b 46 08             	mov    0x8(%esi),%eax
+  801520:	83 e0 03             	and    $0x3,%eax
+  801523:	83 f8 01             	cmp    $0x1,%eax
+  801526:	74 20                	je     801548 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801528:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80152b:	8b 40 08             	mov    0x8(%eax),%eax
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	74 54                	je     801586 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801532:	83 ec 04             	sub    $0x4,%esp
+  801535:	ff 75 10             	push   0x10(%ebp)
+  801538:	ff 75 0c             	push   0xc(%ebp)
+  80153b:	56                   	push   %esi
+  80153c:	ff d0                	call   *%eax
+  80153e:	83 c4 10             	add    $0x10,%esp
+}
+  801541:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801544:	5b                   	pop    %ebx
+  801545:	5e                   	pop    %esi
+  801546:	5d                   	pop    %ebp
+  801547:	c3                   	ret
+  801548:	89 e2                	mov    %esp,%edx
+  80154a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80154f:	29 d0                	sub    %edx,%eax
+  801551:	89 c2                	mov    %eax,%edx
+  801553:	c1 ea 0f             	shr    $0xf,%edx
+  801556:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80155b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801560:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801563:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  80156a:	8b 40 48             	mov    0x48(%eax),%eax
+  80156d:	83 ec 04             	sub    $0x4,%esp
+  801570:	53                   	push   %ebx
+  801571:	50                   	push   %eax
+  801572:	68 b9 3f 80 00       	push   $0x803fb9
+  801577:	e8 e4 ec ff ff       	call   800260 <cprintf>
+		return -E_INVAL;
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801584:	eb bb                	jmp    801541 <read+0x58>
+		return -E_NOT_SUPP;
+  801586:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80158b:	eb b4                	jmp    801541 <read+0x58>
+
+0080158d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80158d:	55                   	push   %ebp
+  80158e:	89 e5                	mov    %esp,%ebp
+  801590:	57                   	push   %edi
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 0c             	sub    $0xc,%esp
+  801596:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801599:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80159c:	85 f6                	test   %esi,%esi
+  80159e:	74 30                	je     8015d0 <readn+0x43>
+  8015a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a5:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	89 f2                	mov    %esi,%edx
+  8015af:	29 c2                	sub    %eax,%edx
+  8015b1:	52                   	push   %edx
+  8015b2:	01 f8                	add    %edi,%eax
+  8015b4:	50                   	push   %eax
+  8015b5:	ff 75 08             	push   0x8(%ebp)
+  8015b8:	e8 2c ff ff ff       	call   8014e9 <read>
+		if (m < 0)
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	78 15                	js     8015d9 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8015c4:	74 11                	je     8015d7 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8015c6:	01 c3                	add    %eax,%ebx
+  8015c8:	89 d8                	mov    %ebx,%eax
+  8015ca:	39 f3                	cmp    %esi,%ebx
+  8015cc:	72 dc                	jb     8015aa <readn+0x1d>
+  8015ce:	eb 09                	jmp    8015d9 <readn+0x4c>
+  8015d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d5:	eb 02                	jmp    8015d9 <readn+0x4c>
+  8015d7:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8015d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015dc:	5b                   	pop    %ebx
+  8015dd:	5e                   	pop    %esi
+  8015de:	5f                   	pop    %edi
+  8015df:	5d                   	pop    %ebp
+  8015e0:	c3                   	ret
+
+008015e1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+  8015e6:	83 ec 18             	sub    $0x18,%esp
+  8015e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ef:	50                   	push   %eax
+  8015f0:	53                   	push   %ebx
+  8015f1:	e8 6f fc ff ff       	call   801265 <fd_lookup>
+  8015f6:	83 c4 10             	add    $0x10,%esp
+  8015f9:	85 c0                	test   %eax,%eax
+  8015fb:	78 37                	js     801634 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801600:	83 ec 08             	sub    $0x8,%esp
+  801603:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801606:	50                   	push   %eax
+  801607:	ff 36                	push   (%esi)
+  801609:	e8 a9 fc ff ff       	call   8012b7 <dev_lookup>
+  80160e:	83 c4 10             	add    $0x10,%esp
+  801611:	85 c0                	test   %eax,%eax
+  801613:	78 1f                	js     801634 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801615:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801619:	74 20                	je     80163b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80161b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80161e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801621:	85 c0                	test   %eax,%eax
+  801623:	74 54                	je     801679 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801625:	83 ec 04             	sub    $0x4,%esp
+  801628:	ff 75 10             	push   0x10(%ebp)
+  80162b:	ff 75 0c             	push   0xc(%ebp)
+  80162e:	56                   	push   %esi
+  80162f:	ff d0                	call   *%eax
+  801631:	83 c4 10             	add    $0x10,%esp
+}
+  801634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801637:	5b                   	pop    %ebx
+  801638:	5e                   	pop    %esi
+  801639:	5d                   	pop    %ebp
+  80163a:	c3                   	ret
+  80163b:	89 e2                	mov    %esp,%edx
+  80163d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801642:	29 d0                	sub    %edx,%eax
+  801644:	89 c2                	mov    %eax,%edx
+  801646:	c1 ea 0f             	shr    $0xf,%edx
+  801649:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80164e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801653:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801656:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  80165d:	8b 40 48             	mov    0x48(%eax),%eax
+  801660:	83 ec 04             	sub    $0x4,%esp
+  801663:	53                   	push   %ebx
+  801664:	50                   	push   %eax
+  801665:	68 d5 3f 80 00       	push   $0x803fd5
+  80166a:	e8 f1 eb ff ff       	call   800260 <cprintf>
+		return -E_INVAL;
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801677:	eb bb                	jmp    801634 <write+0x53>
+		return -E_NOT_SUPP;
+  801679:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80167e:	eb b4                	jmp    801634 <write+0x53>
+
+00801680 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801686:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801689:	50                   	push   %eax
+  80168a:	ff 75 08             	push   0x8(%ebp)
+  80168d:	e8 d3 fb ff ff       	call   801265 <fd_lookup>
+  801692:	83 c4 10             	add    $0x10,%esp
+  801695:	85 c0                	test   %eax,%eax
+  801697:	78 0e                	js     8016a7 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801699:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80169c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a7:	c9                   	leave
+  8016a8:	c3                   	ret
+
+008016a9 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	53                   	push   %ebx
+  8016ad:	83 ec 1c             	sub    $0x1c,%esp
+  8016b0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016b6:	50                   	push   %eax
+  8016b7:	ff 75 08             	push   0x8(%ebp)
+  8016ba:	e8 a6 fb ff ff       	call   801265 <fd_lookup>
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 33                	js     8016f9 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8016c6:	83 fb 03             	cmp    $0x3,%ebx
+  8016c9:	74 28                	je     8016f3 <fcntl+0x4a>
+  8016cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d0:	83 fb 04             	cmp    $0x4,%ebx
+  8016d3:	75 24                	jne    8016f9 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8016d5:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8016d8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8016db:	80 e4 ef             	and    $0xef,%ah
+  8016de:	8b 55 10             	mov    0x10(%ebp),%edx
+  8016e1:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8016e7:	09 d0                	or     %edx,%eax
+  8016e9:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8016ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f1:	eb 06                	jmp    8016f9 <fcntl+0x50>
+		return fd->fd_omode;
+  8016f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016f6:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8016f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016fc:	c9                   	leave
+  8016fd:	c3                   	ret
+
+008016fe <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+  801703:	83 ec 18             	sub    $0x18,%esp
+  801706:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801709:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170c:	50                   	push   %eax
+  80170d:	53                   	push   %ebx
+  80170e:	e8 52 fb ff ff       	call   801265 <fd_lookup>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 34                	js     80174e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171d:	83 ec 08             	sub    $0x8,%esp
+  801720:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801723:	50                   	push   %eax
+  801724:	ff 36                	push   (%esi)
+  801726:	e8 8c fb ff ff       	call   8012b7 <dev_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 1c                	js     80174e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801732:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801736:	74 1d                	je     801755 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80173b:	8b 40 18             	mov    0x18(%eax),%eax
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	74 51                	je     801793 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801742:	83 ec 08             	sub    $0x8,%esp
+  801745:	ff 75 0c             	push   0xc(%ebp)
+  801748:	56                   	push   %esi
+  801749:	ff d0                	call   *%eax
+  80174b:	83 c4 10             	add    $0x10,%esp
+}
+  80174e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+  801755:	89 e2                	mov    %esp,%edx
+  801757:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80175c:	29 d0                	sub    %edx,%eax
+  80175e:	89 c2                	mov    %eax,%edx
+  801760:	c1 ea 0f             	shr    $0xf,%edx
+  801763:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176d:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801770:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  801777:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80177a:	83 ec 04             	sub    $0x4,%esp
+  80177d:	53                   	push   %ebx
+  80177e:	50                   	push   %eax
+  80177f:	68 98 3f 80 00       	push   $0x803f98
+  801784:	e8 d7 ea ff ff       	call   800260 <cprintf>
+		return -E_INVAL;
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801791:	eb bb                	jmp    80174e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801793:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801798:	eb b4                	jmp    80174e <ftruncate+0x50>
+
+0080179a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	56                   	push   %esi
+  80179e:	53                   	push   %ebx
+  80179f:	83 ec 18             	sub    $0x18,%esp
+  8017a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a8:	50                   	push   %eax
+  8017a9:	ff 75 08             	push   0x8(%ebp)
+  8017ac:	e8 b4 fa ff ff       	call   801265 <fd_lookup>
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	85 c0                	test   %eax,%eax
+  8017b6:	78 53                	js     80180b <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017bb:	83 ec 08             	sub    $0x8,%esp
+  8017be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c1:	50                   	push   %eax
+  8017c2:	ff 36                	push   (%esi)
+  8017c4:	e8 ee fa ff ff       	call   8012b7 <dev_lookup>
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 3b                	js     80180b <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8017d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017d7:	74 39                	je     801812 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017d9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017dc:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017e3:	00 00 00 
+	stat->st_isdir = 0;
+  8017e6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017ed:	00 00 00 
+	stat->st_version = 0;
+  8017f0:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8017f7:	00 00 00 
+	stat->st_dev = dev;
+  8017fa:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801800:	83 ec 08             	sub    $0x8,%esp
+  801803:	53                   	push   %ebx
+  801804:	56                   	push   %esi
+  801805:	ff 50 14             	call   *0x14(%eax)
+  801808:	83 c4 10             	add    $0x10,%esp
+}
+  80180b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80180e:	5b                   	pop    %ebx
+  80180f:	5e                   	pop    %esi
+  801810:	5d                   	pop    %ebp
+  801811:	c3                   	ret
+		return -E_NOT_SUPP;
+  801812:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801817:	eb f2                	jmp    80180b <fstat+0x71>
+
+00801819 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	56                   	push   %esi
+  80181d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80181e:	83 ec 08             	sub    $0x8,%esp
+  801821:	6a 00                	push   $0x0
+  801823:	ff 75 08             	push   0x8(%ebp)
+  801826:	e8 b7 01 00 00       	call   8019e2 <open>
+  80182b:	89 c3                	mov    %eax,%ebx
+  80182d:	83 c4 10             	add    $0x10,%esp
+  801830:	85 c0                	test   %eax,%eax
+  801832:	78 1b                	js     80184f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801834:	83 ec 08             	sub    $0x8,%esp
+  801837:	ff 75 0c             	push   0xc(%ebp)
+  80183a:	50                   	push   %eax
+  80183b:	e8 5a ff ff ff       	call   80179a <fstat>
+  801840:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801842:	89 1c 24             	mov    %ebx,(%esp)
+  801845:	e8 60 fb ff ff       	call   8013aa <close>
+	return r;
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	89 f3                	mov    %esi,%ebx
+}
+  80184f:	89 d8                	mov    %ebx,%eax
+  801851:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801854:	5b                   	pop    %ebx
+  801855:	5e                   	pop    %esi
+  801856:	5d                   	pop    %ebp
+  801857:	c3                   	ret
+
+00801858 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	89 c6                	mov    %eax,%esi
+  80185f:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801861:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801868:	74 27                	je     801891 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80186a:	6a 07                	push   $0x7
+  80186c:	68 00 70 c0 00       	push   $0xc07000
+  801871:	56                   	push   %esi
+  801872:	ff 35 00 60 80 00    	push   0x806000
+  801878:	e8 d9 1f 00 00       	call   803856 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80187d:	83 c4 0c             	add    $0xc,%esp
+  801880:	6a 00                	push   $0x0
+  801882:	53                   	push   %ebx
+  801883:	6a 00                	push   $0x0
+  801885:	e8 3c 1d 00 00       	call   8035c6 <ipc_recv>
+}
+  80188a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188d:	5b                   	pop    %ebx
+  80188e:	5e                   	pop    %esi
+  80188f:	5d                   	pop    %ebp
+  801890:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801891:	83 ec 0c             	sub    $0xc,%esp
+  801894:	6a 02                	push   $0x2
+  801896:	e8 24 20 00 00       	call   8038bf <ipc_find_env>
+  80189b:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	eb c5                	jmp    80186a <fsipc+0x12>
+
+008018a5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018a5:	55                   	push   %ebp
+  8018a6:	89 e5                	mov    %esp,%ebp
+  8018a8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b1:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.set_size.req_size = newsize;
+  8018b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018b9:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c3:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018c8:	e8 8b ff ff ff       	call   801858 <fsipc>
+}
+  8018cd:	c9                   	leave
+  8018ce:	c3                   	ret
+
+008018cf <devfile_flush>:
+{
+  8018cf:	55                   	push   %ebp
+  8018d0:	89 e5                	mov    %esp,%ebp
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018db:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018ea:	e8 69 ff ff ff       	call   801858 <fsipc>
+}
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+008018f1 <devfile_stat>:
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	53                   	push   %ebx
+  8018f5:	83 ec 04             	sub    $0x4,%esp
+  8018f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018fe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801901:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801906:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801910:	e8 43 ff ff ff       	call   801858 <fsipc>
+  801915:	85 c0                	test   %eax,%eax
+  801917:	78 37                	js     801950 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801919:	83 ec 08             	sub    $0x8,%esp
+  80191c:	68 00 70 c0 00       	push   $0xc07000
+  801921:	53                   	push   %ebx
+  801922:	e8 30 f0 ff ff       	call   800957 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801927:	a1 80 70 c0 00       	mov    0xc07080,%eax
+  80192c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801932:	a1 84 70 c0 00       	mov    0xc07084,%eax
+  801937:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80193d:	a1 88 70 c0 00       	mov    0xc07088,%eax
+  801942:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801948:	83 c4 10             	add    $0x10,%esp
+  80194b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801950:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <devfile_write>:
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	83 ec 0c             	sub    $0xc,%esp
+  80195b:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80195e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801963:	39 d0                	cmp    %edx,%eax
+  801965:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801968:	8b 55 08             	mov    0x8(%ebp),%edx
+  80196b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80196e:	89 15 00 70 c0 00    	mov    %edx,0xc07000
+	fsipcbuf.write.req_n = count;
+  801974:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801979:	50                   	push   %eax
+  80197a:	ff 75 0c             	push   0xc(%ebp)
+  80197d:	68 08 70 c0 00       	push   $0xc07008
+  801982:	e8 80 f1 ff ff       	call   800b07 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801987:	ba 00 00 00 00       	mov    $0x0,%edx
+  80198c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801991:	e8 c2 fe ff ff       	call   801858 <fsipc>
+}
+  801996:	c9                   	leave
+  801997:	c3                   	ret
+
+00801998 <devfile_read>:
+{
+  801998:	55                   	push   %ebp
+  801999:	89 e5                	mov    %esp,%ebp
+  80199b:	53                   	push   %ebx
+  80199c:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80199f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019a5:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.read.req_n = n;
+  8019aa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019ad:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8019b2:	ba 00 70 c0 00       	mov    $0xc07000,%edx
+  8019b7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019bc:	e8 97 fe ff ff       	call   801858 <fsipc>
+  8019c1:	89 c3                	mov    %eax,%ebx
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	78 14                	js     8019db <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8019c7:	83 ec 04             	sub    $0x4,%esp
+  8019ca:	50                   	push   %eax
+  8019cb:	68 00 70 c0 00       	push   $0xc07000
+  8019d0:	ff 75 0c             	push   0xc(%ebp)
+  8019d3:	e8 2f f1 ff ff       	call   800b07 <memmove>
+	return r;
+  8019d8:	83 c4 10             	add    $0x10,%esp
+}
+  8019db:	89 d8                	mov    %ebx,%eax
+  8019dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+008019e2 <open>:
+{
+  8019e2:	55                   	push   %ebp
+  8019e3:	89 e5                	mov    %esp,%ebp
+  8019e5:	53                   	push   %ebx
+  8019e6:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8019e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ec:	50                   	push   %eax
+  8019ed:	e8 23 f8 ff ff       	call   801215 <fd_alloc>
+  8019f2:	89 c3                	mov    %eax,%ebx
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  8019f7:	85 c0                	test   %eax,%eax
+  8019f9:	78 2a                	js     801a25 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8019fb:	83 ec 0c             	sub    $0xc,%esp
+  8019fe:	ff 75 08             	push   0x8(%ebp)
+  801a01:	e8 05 ef ff ff       	call   80090b <strlen>
+  801a06:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a09:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a0e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a13:	7e 17                	jle    801a2c <open+0x4a>
+	fd_close(fd, 1);
+  801a15:	83 ec 08             	sub    $0x8,%esp
+  801a18:	6a 01                	push   $0x1
+  801a1a:	ff 75 f4             	push   -0xc(%ebp)
+  801a1d:	e8 08 f9 ff ff       	call   80132a <fd_close>
+	return r;
+  801a22:	83 c4 10             	add    $0x10,%esp
+}
+  801a25:	89 d8                	mov    %ebx,%eax
+  801a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a2a:	c9                   	leave
+  801a2b:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+  801a2f:	ff 75 08             	push   0x8(%ebp)
+  801a32:	68 00 70 c0 00       	push   $0xc07000
+  801a37:	e8 1b ef ff ff       	call   800957 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a3f:	a3 00 74 c0 00       	mov    %eax,0xc07400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a44:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a47:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4c:	e8 07 fe ff ff       	call   801858 <fsipc>
+  801a51:	89 c3                	mov    %eax,%ebx
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	78 bb                	js     801a15 <open+0x33>
+	return fd2num(fd); 	
+  801a5a:	83 ec 0c             	sub    $0xc,%esp
+  801a5d:	ff 75 f4             	push   -0xc(%ebp)
+  801a60:	e8 89 f7 ff ff       	call   8011ee <fd2num>
+  801a65:	89 c3                	mov    %eax,%ebx
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	eb b9                	jmp    801a25 <open+0x43>
+
+00801a6c <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	53                   	push   %ebx
+  801a70:	83 ec 1c             	sub    $0x1c,%esp
+  801a73:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a79:	50                   	push   %eax
+  801a7a:	ff 75 08             	push   0x8(%ebp)
+  801a7d:	e8 e3 f7 ff ff       	call   801265 <fd_lookup>
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	78 5a                	js     801ae3 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8c:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801a92:	39 10                	cmp    %edx,(%eax)
+  801a94:	75 66                	jne    801afc <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801a96:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801a9d:	74 49                	je     801ae8 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa5:	a3 00 70 c0 00       	mov    %eax,0xc07000
+	fsipcbuf.map.req_offset = offset;
+  801aaa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aad:	a3 04 70 c0 00       	mov    %eax,0xc07004
+	fsipcbuf.map.req_npages = maxpages;
+  801ab2:	89 1d 08 70 c0 00    	mov    %ebx,0xc07008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ab8:	6a 07                	push   $0x7
+  801aba:	68 00 70 c0 00       	push   $0xc07000
+  801abf:	6a 09                	push   $0x9
+  801ac1:	ff 35 00 60 80 00    	push   0x806000
+  801ac7:	e8 8a 1d 00 00       	call   803856 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801acc:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ad3:	6a 00                	push   $0x0
+  801ad5:	53                   	push   %ebx
+  801ad6:	ff 75 10             	push   0x10(%ebp)
+  801ad9:	6a 00                	push   $0x0
+  801adb:	e8 b3 1b 00 00       	call   803693 <ipc_recv_pages>
+  801ae0:	83 c4 20             	add    $0x20,%esp
+}
+  801ae3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae6:	c9                   	leave
+  801ae7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ae8:	83 ec 0c             	sub    $0xc,%esp
+  801aeb:	6a 02                	push   $0x2
+  801aed:	e8 cd 1d 00 00       	call   8038bf <ipc_find_env>
+  801af2:	a3 00 60 80 00       	mov    %eax,0x806000
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	eb a3                	jmp    801a9f <fmap+0x33>
+		return -E_INVAL;
+  801afc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b01:	eb e0                	jmp    801ae3 <fmap+0x77>
+
+00801b03 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b03:	55                   	push   %ebp
+  801b04:	89 e5                	mov    %esp,%ebp
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 10             	sub    $0x10,%esp
+  801b0a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b0d:	53                   	push   %ebx
+  801b0e:	e8 f8 ed ff ff       	call   80090b <strlen>
+  801b13:	83 c4 10             	add    $0x10,%esp
+  801b16:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b1b:	7f 25                	jg     801b42 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b1d:	83 ec 08             	sub    $0x8,%esp
+  801b20:	53                   	push   %ebx
+  801b21:	68 00 70 c0 00       	push   $0xc07000
+  801b26:	e8 2c ee ff ff       	call   800957 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b30:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b35:	e8 1e fd ff ff       	call   801858 <fsipc>
+  801b3a:	83 c4 10             	add    $0x10,%esp
+}
+  801b3d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b40:	c9                   	leave
+  801b41:	c3                   	ret
+		return -E_BAD_PATH;
+  801b42:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b47:	eb f4                	jmp    801b3d <remove+0x3a>
+
+00801b49 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b54:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b59:	e8 fa fc ff ff       	call   801858 <fsipc>
+}
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+
+00801b60 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b60:	55                   	push   %ebp
+  801b61:	89 e5                	mov    %esp,%ebp
+  801b63:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b66:	68 08 40 80 00       	push   $0x804008
+  801b6b:	ff 75 0c             	push   0xc(%ebp)
+  801b6e:	e8 e4 ed ff ff       	call   800957 <strcpy>
+	return 0;
+}
+  801b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b78:	c9                   	leave
+  801b79:	c3                   	ret
+
+00801b7a <devsock_close>:
+{
+  801b7a:	55                   	push   %ebp
+  801b7b:	89 e5                	mov    %esp,%ebp
+  801b7d:	53                   	push   %ebx
+  801b7e:	83 ec 10             	sub    $0x10,%esp
+  801b81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b84:	53                   	push   %ebx
+  801b85:	e8 74 1d 00 00       	call   8038fe <pageref>
+  801b8a:	89 c2                	mov    %eax,%edx
+  801b8c:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b94:	83 fa 01             	cmp    $0x1,%edx
+  801b97:	74 05                	je     801b9e <devsock_close+0x24>
+}
+  801b99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b9e:	83 ec 0c             	sub    $0xc,%esp
+  801ba1:	ff 73 0c             	push   0xc(%ebx)
+  801ba4:	e8 b0 05 00 00       	call   802159 <nsipc_close>
+  801ba9:	83 c4 10             	add    $0x10,%esp
+  801bac:	eb eb                	jmp    801b99 <devsock_close+0x1f>
+
+00801bae <devsock_write>:
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	53                   	push   %ebx
+  801bb2:	83 ec 14             	sub    $0x14,%esp
+  801bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bb8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bbb:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801bbe:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801bc1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801bc4:	8b 41 08             	mov    0x8(%ecx),%eax
+  801bc7:	c1 f8 09             	sar    $0x9,%eax
+  801bca:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801bcd:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801bd3:	77 13                	ja     801be8 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801bd5:	50                   	push   %eax
+  801bd6:	52                   	push   %edx
+  801bd7:	53                   	push   %ebx
+  801bd8:	ff 71 0c             	push   0xc(%ecx)
+  801bdb:	e8 5c 06 00 00       	call   80223c <nsipc_send>
+  801be0:	83 c4 10             	add    $0x10,%esp
+}
+  801be3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801be6:	c9                   	leave
+  801be7:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801be8:	50                   	push   %eax
+  801be9:	6a 01                	push   $0x1
+  801beb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bee:	50                   	push   %eax
+  801bef:	ff 71 0c             	push   0xc(%ecx)
+  801bf2:	e8 a6 06 00 00       	call   80229d <nsipc_sendmsg>
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	eb e7                	jmp    801be3 <devsock_write+0x35>
+
+00801bfc <devsock_read>:
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+  801bff:	53                   	push   %ebx
+  801c00:	83 ec 14             	sub    $0x14,%esp
+  801c03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c09:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801c0c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c0f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c12:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c15:	c1 f8 09             	sar    $0x9,%eax
+  801c18:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c1b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c21:	77 13                	ja     801c36 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801c23:	50                   	push   %eax
+  801c24:	52                   	push   %edx
+  801c25:	53                   	push   %ebx
+  801c26:	ff 71 0c             	push   0xc(%ecx)
+  801c29:	e8 9c 05 00 00       	call   8021ca <nsipc_recv>
+  801c2e:	83 c4 10             	add    $0x10,%esp
+}
+  801c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c34:	c9                   	leave
+  801c35:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c36:	50                   	push   %eax
+  801c37:	6a 01                	push   $0x1
+  801c39:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c3c:	50                   	push   %eax
+  801c3d:	ff 71 0c             	push   0xc(%ecx)
+  801c40:	e8 02 0a 00 00       	call   802647 <nsipc_recvmsg>
+  801c45:	83 c4 10             	add    $0x10,%esp
+  801c48:	eb e7                	jmp    801c31 <devsock_read+0x35>
+
+00801c4a <fd2sockid>:
+{
+  801c4a:	55                   	push   %ebp
+  801c4b:	89 e5                	mov    %esp,%ebp
+  801c4d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c50:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c53:	52                   	push   %edx
+  801c54:	50                   	push   %eax
+  801c55:	e8 0b f6 ff ff       	call   801265 <fd_lookup>
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 10                	js     801c71 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c64:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801c6a:	39 08                	cmp    %ecx,(%eax)
+  801c6c:	75 05                	jne    801c73 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c6e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c71:	c9                   	leave
+  801c72:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c73:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c78:	eb f7                	jmp    801c71 <fd2sockid+0x27>
+
+00801c7a <sock_flags>:
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801c80:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c83:	52                   	push   %edx
+  801c84:	50                   	push   %eax
+  801c85:	e8 db f5 ff ff       	call   801265 <fd_lookup>
+  801c8a:	83 c4 10             	add    $0x10,%esp
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	78 0e                	js     801c9f <sock_flags+0x25>
+  801c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c94:	8b 40 08             	mov    0x8(%eax),%eax
+  801c97:	c1 e8 09             	shr    $0x9,%eax
+  801c9a:	83 e0 08             	and    $0x8,%eax
+}
+  801c9d:	c9                   	leave
+  801c9e:	c3                   	ret
+		return 0;
+  801c9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ca4:	eb f7                	jmp    801c9d <sock_flags+0x23>
+
+00801ca6 <alloc_sockfd>:
+{
+  801ca6:	55                   	push   %ebp
+  801ca7:	89 e5                	mov    %esp,%ebp
+  801ca9:	56                   	push   %esi
+  801caa:	53                   	push   %ebx
+  801cab:	83 ec 1c             	sub    $0x1c,%esp
+  801cae:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb3:	50                   	push   %eax
+  801cb4:	e8 5c f5 ff ff       	call   801215 <fd_alloc>
+  801cb9:	89 c3                	mov    %eax,%ebx
+  801cbb:	83 c4 10             	add    $0x10,%esp
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 43                	js     801d05 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cc2:	83 ec 04             	sub    $0x4,%esp
+  801cc5:	68 07 04 00 00       	push   $0x407
+  801cca:	ff 75 f4             	push   -0xc(%ebp)
+  801ccd:	6a 00                	push   $0x0
+  801ccf:	e8 b7 f0 ff ff       	call   800d8b <sys_page_alloc>
+  801cd4:	89 c3                	mov    %eax,%ebx
+  801cd6:	83 c4 10             	add    $0x10,%esp
+  801cd9:	85 c0                	test   %eax,%eax
+  801cdb:	78 28                	js     801d05 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ce0:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ce6:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ceb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801cf2:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801cf5:	83 ec 0c             	sub    $0xc,%esp
+  801cf8:	50                   	push   %eax
+  801cf9:	e8 f0 f4 ff ff       	call   8011ee <fd2num>
+  801cfe:	89 c3                	mov    %eax,%ebx
+  801d00:	83 c4 10             	add    $0x10,%esp
+  801d03:	eb 0c                	jmp    801d11 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+  801d08:	56                   	push   %esi
+  801d09:	e8 4b 04 00 00       	call   802159 <nsipc_close>
+		return r;
+  801d0e:	83 c4 10             	add    $0x10,%esp
+}
+  801d11:	89 d8                	mov    %ebx,%eax
+  801d13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d16:	5b                   	pop    %ebx
+  801d17:	5e                   	pop    %esi
+  801d18:	5d                   	pop    %ebp
+  801d19:	c3                   	ret
+
+00801d1a <accept>:
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	56                   	push   %esi
+  801d1e:	53                   	push   %ebx
+  801d1f:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d22:	89 f0                	mov    %esi,%eax
+  801d24:	e8 21 ff ff ff       	call   801c4a <fd2sockid>
+  801d29:	89 c3                	mov    %eax,%ebx
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 24                	js     801d53 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d2f:	89 f0                	mov    %esi,%eax
+  801d31:	e8 44 ff ff ff       	call   801c7a <sock_flags>
+  801d36:	50                   	push   %eax
+  801d37:	ff 75 10             	push   0x10(%ebp)
+  801d3a:	ff 75 0c             	push   0xc(%ebp)
+  801d3d:	53                   	push   %ebx
+  801d3e:	e8 6b 03 00 00       	call   8020ae <nsipc_accept>
+  801d43:	89 c3                	mov    %eax,%ebx
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	78 07                	js     801d53 <accept+0x39>
+	return alloc_sockfd(r);
+  801d4c:	e8 55 ff ff ff       	call   801ca6 <alloc_sockfd>
+  801d51:	89 c3                	mov    %eax,%ebx
+}
+  801d53:	89 d8                	mov    %ebx,%eax
+  801d55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d58:	5b                   	pop    %ebx
+  801d59:	5e                   	pop    %esi
+  801d5a:	5d                   	pop    %ebp
+  801d5b:	c3                   	ret
+
+00801d5c <bind>:
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d65:	e8 e0 fe ff ff       	call   801c4a <fd2sockid>
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 12                	js     801d80 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d6e:	83 ec 04             	sub    $0x4,%esp
+  801d71:	ff 75 10             	push   0x10(%ebp)
+  801d74:	ff 75 0c             	push   0xc(%ebp)
+  801d77:	50                   	push   %eax
+  801d78:	e8 85 03 00 00       	call   802102 <nsipc_bind>
+  801d7d:	83 c4 10             	add    $0x10,%esp
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <shutdown>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8b:	e8 ba fe ff ff       	call   801c4a <fd2sockid>
+  801d90:	85 c0                	test   %eax,%eax
+  801d92:	78 0f                	js     801da3 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d94:	83 ec 08             	sub    $0x8,%esp
+  801d97:	ff 75 0c             	push   0xc(%ebp)
+  801d9a:	50                   	push   %eax
+  801d9b:	e8 97 03 00 00       	call   802137 <nsipc_shutdown>
+  801da0:	83 c4 10             	add    $0x10,%esp
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+
+00801da5 <connect>:
+{
+  801da5:	55                   	push   %ebp
+  801da6:	89 e5                	mov    %esp,%ebp
+  801da8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dab:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dae:	e8 97 fe ff ff       	call   801c4a <fd2sockid>
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 12                	js     801dc9 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801db7:	83 ec 04             	sub    $0x4,%esp
+  801dba:	ff 75 10             	push   0x10(%ebp)
+  801dbd:	ff 75 0c             	push   0xc(%ebp)
+  801dc0:	50                   	push   %eax
+  801dc1:	e8 ad 03 00 00       	call   802173 <nsipc_connect>
+  801dc6:	83 c4 10             	add    $0x10,%esp
+}
+  801dc9:	c9                   	leave
+  801dca:	c3                   	ret
+
+00801dcb <listen>:
+{
+  801dcb:	55                   	push   %ebp
+  801dcc:	89 e5                	mov    %esp,%ebp
+  801dce:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dd4:	e8 71 fe ff ff       	call   801c4a <fd2sockid>
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 0f                	js     801dec <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ddd:	83 ec 08             	sub    $0x8,%esp
+  801de0:	ff 75 0c             	push   0xc(%ebp)
+  801de3:	50                   	push   %eax
+  801de4:	e8 bf 03 00 00       	call   8021a8 <nsipc_listen>
+  801de9:	83 c4 10             	add    $0x10,%esp
+}
+  801dec:	c9                   	leave
+  801ded:	c3                   	ret
+
+00801dee <sendmsg>:
+{
+  801dee:	55                   	push   %ebp
+  801def:	89 e5                	mov    %esp,%ebp
+  801df1:	57                   	push   %edi
+  801df2:	56                   	push   %esi
+  801df3:	53                   	push   %ebx
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+  801df7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dfa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801dfd:	89 f0                	mov    %esi,%eax
+  801dff:	e8 46 fe ff ff       	call   801c4a <fd2sockid>
+  801e04:	89 c3                	mov    %eax,%ebx
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 1c                	js     801e26 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801e0a:	89 f0                	mov    %esi,%eax
+  801e0c:	e8 69 fe ff ff       	call   801c7a <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e11:	0b 45 10             	or     0x10(%ebp),%eax
+  801e14:	50                   	push   %eax
+  801e15:	ff 77 0c             	push   0xc(%edi)
+  801e18:	ff 77 08             	push   0x8(%edi)
+  801e1b:	53                   	push   %ebx
+  801e1c:	e8 7c 04 00 00       	call   80229d <nsipc_sendmsg>
+  801e21:	89 c3                	mov    %eax,%ebx
+  801e23:	83 c4 10             	add    $0x10,%esp
+}
+  801e26:	89 d8                	mov    %ebx,%eax
+  801e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2b:	5b                   	pop    %ebx
+  801e2c:	5e                   	pop    %esi
+  801e2d:	5f                   	pop    %edi
+  801e2e:	5d                   	pop    %ebp
+  801e2f:	c3                   	ret
+
+00801e30 <recvmsg>:
+{
+  801e30:	55                   	push   %ebp
+  801e31:	89 e5                	mov    %esp,%ebp
+  801e33:	57                   	push   %edi
+  801e34:	56                   	push   %esi
+  801e35:	53                   	push   %ebx
+  801e36:	83 ec 0c             	sub    $0xc,%esp
+  801e39:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e3f:	89 f8                	mov    %edi,%eax
+  801e41:	e8 04 fe ff ff       	call   801c4a <fd2sockid>
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	78 2a                	js     801e76 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e4c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e53:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e5a:	89 f8                	mov    %edi,%eax
+  801e5c:	e8 19 fe ff ff       	call   801c7a <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e61:	0b 45 10             	or     0x10(%ebp),%eax
+  801e64:	50                   	push   %eax
+  801e65:	ff 76 0c             	push   0xc(%esi)
+  801e68:	ff 76 08             	push   0x8(%esi)
+  801e6b:	53                   	push   %ebx
+  801e6c:	e8 d6 07 00 00       	call   802647 <nsipc_recvmsg>
+  801e71:	89 c3                	mov    %eax,%ebx
+  801e73:	83 c4 10             	add    $0x10,%esp
+}
+  801e76:	89 d8                	mov    %ebx,%eax
+  801e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7b:	5b                   	pop    %ebx
+  801e7c:	5e                   	pop    %esi
+  801e7d:	5f                   	pop    %edi
+  801e7e:	5d                   	pop    %ebp
+  801e7f:	c3                   	ret
+
+00801e80 <sendfile>:
+{
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e88:	89 f0                	mov    %esi,%eax
+  801e8a:	e8 bb fd ff ff       	call   801c4a <fd2sockid>
+  801e8f:	89 c3                	mov    %eax,%ebx
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 1f                	js     801eb4 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801e95:	89 f0                	mov    %esi,%eax
+  801e97:	e8 de fd ff ff       	call   801c7a <sock_flags>
+  801e9c:	83 ec 0c             	sub    $0xc,%esp
+  801e9f:	50                   	push   %eax
+  801ea0:	ff 75 14             	push   0x14(%ebp)
+  801ea3:	ff 75 10             	push   0x10(%ebp)
+  801ea6:	ff 75 0c             	push   0xc(%ebp)
+  801ea9:	53                   	push   %ebx
+  801eaa:	e8 64 06 00 00       	call   802513 <nsipc_sendfile>
+  801eaf:	89 c3                	mov    %eax,%ebx
+  801eb1:	83 c4 20             	add    $0x20,%esp
+}
+  801eb4:	89 d8                	mov    %ebx,%eax
+  801eb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eb9:	5b                   	pop    %ebx
+  801eba:	5e                   	pop    %esi
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <evctl>:
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 04             	sub    $0x4,%esp
+  801ec4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801ec7:	89 d8                	mov    %ebx,%eax
+  801ec9:	e8 7c fd ff ff       	call   801c4a <fd2sockid>
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 10                	js     801ee2 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801ed2:	83 ec 04             	sub    $0x4,%esp
+  801ed5:	53                   	push   %ebx
+  801ed6:	ff 75 0c             	push   0xc(%ebp)
+  801ed9:	50                   	push   %eax
+  801eda:	e8 d2 0b 00 00       	call   802ab1 <nsipc_evctl>
+  801edf:	83 c4 10             	add    $0x10,%esp
+}
+  801ee2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee5:	c9                   	leave
+  801ee6:	c3                   	ret
+
+00801ee7 <evwait>:
+{
+  801ee7:	55                   	push   %ebp
+  801ee8:	89 e5                	mov    %esp,%ebp
+  801eea:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801eed:	ff 75 10             	push   0x10(%ebp)
+  801ef0:	ff 75 0c             	push   0xc(%ebp)
+  801ef3:	ff 75 08             	push   0x8(%ebp)
+  801ef6:	e8 e0 0b 00 00       	call   802adb <nsipc_evwait>
+}
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+
+00801efd <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f03:	ff 75 10             	push   0x10(%ebp)
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	ff 75 08             	push   0x8(%ebp)
+  801f0c:	e8 31 0c 00 00       	call   802b42 <nsipc_socket>
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	78 05                	js     801f1d <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f18:	e8 89 fd ff ff       	call   801ca6 <alloc_sockfd>
+}
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+00801f1f <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	53                   	push   %ebx
+  801f23:	83 ec 04             	sub    $0x4,%esp
+  801f26:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801f28:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f2f:	74 26                	je     801f57 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f31:	6a 07                	push   $0x7
+  801f33:	68 00 80 c0 00       	push   $0xc08000
+  801f38:	53                   	push   %ebx
+  801f39:	ff 35 24 63 80 00    	push   0x806324
+  801f3f:	e8 12 19 00 00       	call   803856 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f44:	83 c4 0c             	add    $0xc,%esp
+  801f47:	6a 00                	push   $0x0
+  801f49:	6a 00                	push   $0x0
+  801f4b:	6a 00                	push   $0x0
+  801f4d:	e8 74 16 00 00       	call   8035c6 <ipc_recv>
+}
+  801f52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f55:	c9                   	leave
+  801f56:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f57:	83 ec 0c             	sub    $0xc,%esp
+  801f5a:	6a 03                	push   $0x3
+  801f5c:	e8 5e 19 00 00       	call   8038bf <ipc_find_env>
+  801f61:	a3 24 63 80 00       	mov    %eax,0x806324
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	eb c6                	jmp    801f31 <nsipc+0x12>
+
+00801f6b <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801f6b:	55                   	push   %ebp
+  801f6c:	89 e5                	mov    %esp,%ebp
+  801f6e:	56                   	push   %esi
+  801f6f:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801f70:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801f76:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801f7b:	85 f6                	test   %esi,%esi
+  801f7d:	75 33                	jne    801fb2 <nsbulk_map+0x47>
+  801f7f:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801f84:	83 ec 04             	sub    $0x4,%esp
+  801f87:	6a 07                	push   $0x7
+  801f89:	53                   	push   %ebx
+  801f8a:	6a 00                	push   $0x0
+  801f8c:	e8 fa ed ff ff       	call   800d8b <sys_page_alloc>
+  801f91:	83 c4 10             	add    $0x10,%esp
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 1a                	js     801fb2 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801f98:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f9e:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801fa4:	75 de                	jne    801f84 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801fa6:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801fad:	00 00 00 
+	return 0;
+  801fb0:	89 f0                	mov    %esi,%eax
+}
+  801fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fb5:	5b                   	pop    %ebx
+  801fb6:	5e                   	pop    %esi
+  801fb7:	5d                   	pop    %ebp
+  801fb8:	c3                   	ret
+
+00801fb9 <nsbulk_own>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	57                   	push   %edi
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 0c             	sub    $0xc,%esp
+  801fc2:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801fc4:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801fc7:	85 d2                	test   %edx,%edx
+  801fc9:	7f 0e                	jg     801fd9 <nsbulk_own+0x20>
+	return 0;
+  801fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fd0:	eb 47                	jmp    802019 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801fd2:	83 c3 01             	add    $0x1,%ebx
+  801fd5:	39 fb                	cmp    %edi,%ebx
+  801fd7:	7d 3b                	jge    802014 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801fd9:	be 01 00 00 00       	mov    $0x1,%esi
+  801fde:	89 d9                	mov    %ebx,%ecx
+  801fe0:	d3 e6                	shl    %cl,%esi
+  801fe2:	89 f0                	mov    %esi,%eax
+  801fe4:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  801fea:	74 e6                	je     801fd2 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801fec:	83 ec 04             	sub    $0x4,%esp
+  801fef:	6a 07                	push   $0x7
+  801ff1:	89 d8                	mov    %ebx,%eax
+  801ff3:	c1 e0 0c             	shl    $0xc,%eax
+  801ff6:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801ffb:	50                   	push   %eax
+  801ffc:	6a 00                	push   $0x0
+  801ffe:	e8 88 ed ff ff       	call   800d8b <sys_page_alloc>
+  802003:	83 c4 10             	add    $0x10,%esp
+  802006:	85 c0                	test   %eax,%eax
+  802008:	78 0f                	js     802019 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80200a:	f7 d6                	not    %esi
+  80200c:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  802012:	eb be                	jmp    801fd2 <nsbulk_own+0x19>
+	return 0;
+  802014:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80201c:	5b                   	pop    %ebx
+  80201d:	5e                   	pop    %esi
+  80201e:	5f                   	pop    %edi
+  80201f:	5d                   	pop    %ebp
+  802020:	c3                   	ret
+
+00802021 <nsipc_bulk>:
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	57                   	push   %edi
+  802025:	56                   	push   %esi
+  802026:	53                   	push   %ebx
+  802027:	83 ec 1c             	sub    $0x1c,%esp
+  80202a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80202d:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80202f:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802035:	c1 fb 0c             	sar    $0xc,%ebx
+  802038:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80203b:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802042:	74 56                	je     80209a <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802044:	85 ff                	test   %edi,%edi
+  802046:	7e 24                	jle    80206c <nsipc_bulk+0x4b>
+  802048:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80204e:	74 1c                	je     80206c <nsipc_bulk+0x4b>
+  802050:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802056:	c1 e3 0c             	shl    $0xc,%ebx
+  802059:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80205e:	0f b6 10             	movzbl (%eax),%edx
+  802061:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802063:	05 00 10 00 00       	add    $0x1000,%eax
+  802068:	39 d8                	cmp    %ebx,%eax
+  80206a:	75 f2                	jne    80205e <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  80206c:	83 ec 0c             	sub    $0xc,%esp
+  80206f:	56                   	push   %esi
+  802070:	57                   	push   %edi
+  802071:	68 00 00 00 e0       	push   $0xe0000000
+  802076:	ff 75 e4             	push   -0x1c(%ebp)
+  802079:	ff 35 24 63 80 00    	push   0x806324
+  80207f:	e8 06 18 00 00       	call   80388a <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802084:	83 c4 1c             	add    $0x1c,%esp
+  802087:	6a 00                	push   $0x0
+  802089:	6a 00                	push   $0x0
+  80208b:	6a 00                	push   $0x0
+  80208d:	e8 34 15 00 00       	call   8035c6 <ipc_recv>
+}
+  802092:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802095:	5b                   	pop    %ebx
+  802096:	5e                   	pop    %esi
+  802097:	5f                   	pop    %edi
+  802098:	5d                   	pop    %ebp
+  802099:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80209a:	83 ec 0c             	sub    $0xc,%esp
+  80209d:	6a 03                	push   $0x3
+  80209f:	e8 1b 18 00 00       	call   8038bf <ipc_find_env>
+  8020a4:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020a9:	83 c4 10             	add    $0x10,%esp
+  8020ac:	eb 96                	jmp    802044 <nsipc_bulk+0x23>
+
+008020ae <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8020ae:	55                   	push   %ebp
+  8020af:	89 e5                	mov    %esp,%ebp
+  8020b1:	53                   	push   %ebx
+  8020b2:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8020b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b8:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.accept.req_flags = flags;
+  8020bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020c0:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8020c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ca:	e8 50 fe ff ff       	call   801f1f <nsipc>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	85 c0                	test   %eax,%eax
+  8020d3:	79 07                	jns    8020dc <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8020d5:	89 d8                	mov    %ebx,%eax
+  8020d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020da:	c9                   	leave
+  8020db:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8020dc:	83 ec 04             	sub    $0x4,%esp
+  8020df:	ff 35 10 80 c0 00    	push   0xc08010
+  8020e5:	68 00 80 c0 00       	push   $0xc08000
+  8020ea:	ff 75 0c             	push   0xc(%ebp)
+  8020ed:	e8 15 ea ff ff       	call   800b07 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8020f2:	8b 15 10 80 c0 00    	mov    0xc08010,%edx
+  8020f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020fb:	89 10                	mov    %edx,(%eax)
+  8020fd:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802100:	eb d3                	jmp    8020d5 <nsipc_accept+0x27>
+
+00802102 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802102:	55                   	push   %ebp
+  802103:	89 e5                	mov    %esp,%ebp
+  802105:	53                   	push   %ebx
+  802106:	83 ec 08             	sub    $0x8,%esp
+  802109:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80210c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210f:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802114:	53                   	push   %ebx
+  802115:	ff 75 0c             	push   0xc(%ebp)
+  802118:	68 04 80 c0 00       	push   $0xc08004
+  80211d:	e8 e5 e9 ff ff       	call   800b07 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802122:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_BIND);
+  802128:	b8 02 00 00 00       	mov    $0x2,%eax
+  80212d:	e8 ed fd ff ff       	call   801f1f <nsipc>
+}
+  802132:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802135:	c9                   	leave
+  802136:	c3                   	ret
+
+00802137 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802137:	55                   	push   %ebp
+  802138:	89 e5                	mov    %esp,%ebp
+  80213a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80213d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802140:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.shutdown.req_how = how;
+  802145:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802148:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_SHUTDOWN);
+  80214d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802152:	e8 c8 fd ff ff       	call   801f1f <nsipc>
+}
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+00802159 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80215f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802162:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	return nsipc(NSREQ_CLOSE);
+  802167:	b8 04 00 00 00       	mov    $0x4,%eax
+  80216c:	e8 ae fd ff ff       	call   801f1f <nsipc>
+}
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+00802173 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802173:	55                   	push   %ebp
+  802174:	89 e5                	mov    %esp,%ebp
+  802176:	53                   	push   %ebx
+  802177:	83 ec 08             	sub    $0x8,%esp
+  80217a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80217d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802180:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802185:	53                   	push   %ebx
+  802186:	ff 75 0c             	push   0xc(%ebp)
+  802189:	68 04 80 c0 00       	push   $0xc08004
+  80218e:	e8 74 e9 ff ff       	call   800b07 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802193:	89 1d 14 80 c0 00    	mov    %ebx,0xc08014
+	return nsipc(NSREQ_CONNECT);
+  802199:	b8 05 00 00 00       	mov    $0x5,%eax
+  80219e:	e8 7c fd ff ff       	call   801f1f <nsipc>
+}
+  8021a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021a6:	c9                   	leave
+  8021a7:	c3                   	ret
+
+008021a8 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021a8:	55                   	push   %ebp
+  8021a9:	89 e5                	mov    %esp,%ebp
+  8021ab:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8021ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b1:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.listen.req_backlog = backlog;
+  8021b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b9:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	return nsipc(NSREQ_LISTEN);
+  8021be:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021c3:	e8 57 fd ff ff       	call   801f1f <nsipc>
+}
+  8021c8:	c9                   	leave
+  8021c9:	c3                   	ret
+
+008021ca <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8021ca:	55                   	push   %ebp
+  8021cb:	89 e5                	mov    %esp,%ebp
+  8021cd:	56                   	push   %esi
+  8021ce:	53                   	push   %ebx
+  8021cf:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.recv.req_len = len;
+  8021da:	89 35 04 80 c0 00    	mov    %esi,0xc08004
+	nsipcbuf.recv.req_flags = flags;
+  8021e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021e3:	a3 08 80 c0 00       	mov    %eax,0xc08008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8021e8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021ed:	e8 2d fd ff ff       	call   801f1f <nsipc>
+  8021f2:	89 c3                	mov    %eax,%ebx
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 22                	js     80221a <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8021f8:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8021fd:	39 c6                	cmp    %eax,%esi
+  8021ff:	0f 4e c6             	cmovle %esi,%eax
+  802202:	39 c3                	cmp    %eax,%ebx
+  802204:	7f 1d                	jg     802223 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802206:	83 ec 04             	sub    $0x4,%esp
+  802209:	53                   	push   %ebx
+  80220a:	68 00 80 c0 00       	push   $0xc08000
+  80220f:	ff 75 0c             	push   0xc(%ebp)
+  802212:	e8 f0 e8 ff ff       	call   800b07 <memmove>
+  802217:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80221a:	89 d8                	mov    %ebx,%eax
+  80221c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221f:	5b                   	pop    %ebx
+  802220:	5e                   	pop    %esi
+  802221:	5d                   	pop    %ebp
+  802222:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802223:	68 14 40 80 00       	push   $0x804014
+  802228:	68 29 40 80 00       	push   $0x804029
+  80222d:	68 b2 00 00 00       	push   $0xb2
+  802232:	68 3e 40 80 00       	push   $0x80403e
+  802237:	e8 49 df ff ff       	call   800185 <_panic>
+
+0080223c <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	53                   	push   %ebx
+  802240:	83 ec 04             	sub    $0x4,%esp
+  802243:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802246:	8b 45 08             	mov    0x8(%ebp),%eax
+  802249:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	assert(size < 1600);
+  80224e:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802254:	7f 2e                	jg     802284 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802256:	83 ec 04             	sub    $0x4,%esp
+  802259:	53                   	push   %ebx
+  80225a:	ff 75 0c             	push   0xc(%ebp)
+  80225d:	68 0c 80 c0 00       	push   $0xc0800c
+  802262:	e8 a0 e8 ff ff       	call   800b07 <memmove>
+	nsipcbuf.send.req_size = size;
+  802267:	89 1d 04 80 c0 00    	mov    %ebx,0xc08004
+	nsipcbuf.send.req_flags = flags;
+  80226d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802270:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SEND);
+  802275:	b8 08 00 00 00       	mov    $0x8,%eax
+  80227a:	e8 a0 fc ff ff       	call   801f1f <nsipc>
+}
+  80227f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802282:	c9                   	leave
+  802283:	c3                   	ret
+	assert(size < 1600);
+  802284:	68 4a 40 80 00       	push   $0x80404a
+  802289:	68 29 40 80 00       	push   $0x804029
+  80228e:	68 bd 00 00 00       	push   $0xbd
+  802293:	68 3e 40 80 00       	push   $0x80403e
+  802298:	e8 e8 de ff ff       	call   800185 <_panic>
+
+0080229d <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80229d:	55                   	push   %ebp
+  80229e:	89 e5                	mov    %esp,%ebp
+  8022a0:	57                   	push   %edi
+  8022a1:	56                   	push   %esi
+  8022a2:	53                   	push   %ebx
+  8022a3:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8022a6:	e8 c0 fc ff ff       	call   801f6b <nsbulk_map>
+  8022ab:	85 c0                	test   %eax,%eax
+  8022ad:	78 55                	js     802304 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8022af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8022b6:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8022bd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022c4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8022c7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022ca:	0f 8d 24 02 00 00    	jge    8024f4 <nsipc_sendmsg+0x257>
+  8022d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022d3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8022d6:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8022d9:	89 d8                	mov    %ebx,%eax
+  8022db:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022e0:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8022e2:	83 ec 0c             	sub    $0xc,%esp
+  8022e5:	68 20 60 80 00       	push   $0x806020
+  8022ea:	e8 5a 0f 00 00       	call   803249 <pgbatch_init>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022f2:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022f4:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8022f7:	e9 82 00 00 00       	jmp    80237e <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8022fc:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8022ff:	85 db                	test   %ebx,%ebx
+  802301:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802304:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802307:	5b                   	pop    %ebx
+  802308:	5e                   	pop    %esi
+  802309:	5f                   	pop    %edi
+  80230a:	5d                   	pop    %ebp
+  80230b:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80230c:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802311:	29 c8                	sub    %ecx,%eax
+  802313:	39 d0                	cmp    %edx,%eax
+  802315:	0f 46 d0             	cmovbe %eax,%edx
+  802318:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80231a:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802320:	85 ff                	test   %edi,%edi
+  802322:	0f 49 c7             	cmovns %edi,%eax
+  802325:	c1 f8 0c             	sar    $0xc,%eax
+  802328:	ba 01 00 00 00       	mov    $0x1,%edx
+  80232d:	e8 87 fc ff ff       	call   801fb9 <nsbulk_own>
+  802332:	85 c0                	test   %eax,%eax
+  802334:	0f 88 17 01 00 00    	js     802451 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80233a:	83 ec 04             	sub    $0x4,%esp
+  80233d:	56                   	push   %esi
+  80233e:	ff 75 e0             	push   -0x20(%ebp)
+  802341:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802344:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802349:	50                   	push   %eax
+  80234a:	e8 b8 e7 ff ff       	call   800b07 <memmove>
+  80234f:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802352:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802355:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802358:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80235b:	0f 84 fd 00 00 00    	je     80245e <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802361:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802364:	01 f7                	add    %esi,%edi
+  802366:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802369:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80236c:	0f 8d 01 01 00 00    	jge    802473 <nsipc_sendmsg+0x1d6>
+  802372:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802378:	0f 8f f0 00 00 00    	jg     80246e <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80237e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802381:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802384:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802387:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80238a:	89 c2                	mov    %eax,%edx
+  80238c:	03 13                	add    (%ebx),%edx
+  80238e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802391:	8b 73 04             	mov    0x4(%ebx),%esi
+  802394:	29 c6                	sub    %eax,%esi
+  802396:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80239b:	29 f9                	sub    %edi,%ecx
+  80239d:	39 ce                	cmp    %ecx,%esi
+  80239f:	89 ca                	mov    %ecx,%edx
+  8023a1:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8023a4:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8023a7:	89 f9                	mov    %edi,%ecx
+  8023a9:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8023af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023b2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023b7:	09 c8                	or     %ecx,%eax
+  8023b9:	0f 85 4d ff ff ff    	jne    80230c <nsipc_sendmsg+0x6f>
+  8023bf:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8023c5:	0f 86 41 ff ff ff    	jbe    80230c <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023cb:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8023d1:	85 ff                	test   %edi,%edi
+  8023d3:	0f 49 c7             	cmovns %edi,%eax
+  8023d6:	c1 f8 0c             	sar    $0xc,%eax
+  8023d9:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8023db:	89 d1                	mov    %edx,%ecx
+  8023dd:	c1 e9 0c             	shr    $0xc,%ecx
+  8023e0:	01 c8                	add    %ecx,%eax
+  8023e2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023e5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023e8:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8023ea:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023ed:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8023f2:	29 c8                	sub    %ecx,%eax
+  8023f4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8023f7:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8023fa:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802401:	89 f9                	mov    %edi,%ecx
+  802403:	d3 e0                	shl    %cl,%eax
+  802405:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80240b:	83 ec 08             	sub    $0x8,%esp
+  80240e:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802410:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802413:	50                   	push   %eax
+  802414:	6a 00                	push   $0x0
+  802416:	56                   	push   %esi
+  802417:	6a 00                	push   $0x0
+  802419:	68 20 60 80 00       	push   $0x806020
+  80241e:	e8 e4 0e 00 00       	call   803307 <pgbatch_map>
+  802423:	83 c4 20             	add    $0x20,%esp
+  802426:	85 c0                	test   %eax,%eax
+  802428:	0f 88 ce fe ff ff    	js     8022fc <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80242e:	83 c7 01             	add    $0x1,%edi
+  802431:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802437:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80243a:	39 c7                	cmp    %eax,%edi
+  80243c:	75 be                	jne    8023fc <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80243e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802441:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802444:	89 d6                	mov    %edx,%esi
+  802446:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80244c:	e9 01 ff ff ff       	jmp    802352 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802451:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802454:	85 db                	test   %ebx,%ebx
+  802456:	0f 45 c3             	cmovne %ebx,%eax
+  802459:	e9 a6 fe ff ff       	jmp    802304 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80245e:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802462:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802469:	e9 f3 fe ff ff       	jmp    802361 <nsipc_sendmsg+0xc4>
+  80246e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802471:	eb 03                	jmp    802476 <nsipc_sendmsg+0x1d9>
+  802473:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802476:	83 ec 0c             	sub    $0xc,%esp
+  802479:	68 20 60 80 00       	push   $0x806020
+  80247e:	e8 d4 0d 00 00       	call   803257 <pgbatch_flush>
+  802483:	83 c4 10             	add    $0x10,%esp
+  802486:	85 c0                	test   %eax,%eax
+  802488:	78 50                	js     8024da <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80248a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80248d:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802492:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802498:	89 fb                	mov    %edi,%ebx
+  80249a:	29 f3                	sub    %esi,%ebx
+  80249c:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8024a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024a5:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8024aa:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024af:	89 fa                	mov    %edi,%edx
+  8024b1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024b6:	e8 66 fb ff ff       	call   802021 <nsipc_bulk>
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	78 28                	js     8024e7 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8024bf:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8024c2:	39 c3                	cmp    %eax,%ebx
+  8024c4:	75 0c                	jne    8024d2 <nsipc_sendmsg+0x235>
+  8024c6:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024c9:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8024cc:	0f 8f f2 fd ff ff    	jg     8022c4 <nsipc_sendmsg+0x27>
+		sent += r;
+  8024d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024d5:	e9 2a fe ff ff       	jmp    802304 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024da:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024dd:	85 db                	test   %ebx,%ebx
+  8024df:	0f 45 c3             	cmovne %ebx,%eax
+  8024e2:	e9 1d fe ff ff       	jmp    802304 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024e7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024ea:	85 db                	test   %ebx,%ebx
+  8024ec:	0f 45 c3             	cmovne %ebx,%eax
+  8024ef:	e9 10 fe ff ff       	jmp    802304 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8024f4:	83 ec 0c             	sub    $0xc,%esp
+  8024f7:	68 20 60 80 00       	push   $0x806020
+  8024fc:	e8 48 0d 00 00       	call   803249 <pgbatch_init>
+  802501:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802504:	be 00 00 00 00       	mov    $0x0,%esi
+  802509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80250e:	e9 63 ff ff ff       	jmp    802476 <nsipc_sendmsg+0x1d9>
+
+00802513 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802513:	55                   	push   %ebp
+  802514:	89 e5                	mov    %esp,%ebp
+  802516:	57                   	push   %edi
+  802517:	56                   	push   %esi
+  802518:	53                   	push   %ebx
+  802519:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80251c:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802523:	0f 84 c8 00 00 00    	je     8025f1 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802529:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802530:	0f 84 e4 00 00 00    	je     80261a <nsipc_sendfile+0x107>
+{
+  802536:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80253b:	89 fb                	mov    %edi,%ebx
+  80253d:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802540:	0f 83 f0 00 00 00    	jae    802636 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802546:	89 fa                	mov    %edi,%edx
+  802548:	03 55 10             	add    0x10(%ebp),%edx
+  80254b:	89 d0                	mov    %edx,%eax
+  80254d:	c1 f8 1f             	sar    $0x1f,%eax
+  802550:	c1 e8 14             	shr    $0x14,%eax
+  802553:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802556:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  80255c:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80255e:	6a 10                	push   $0x10
+  802560:	68 00 20 01 e0       	push   $0xe0012000
+  802565:	52                   	push   %edx
+  802566:	ff 75 0c             	push   0xc(%ebp)
+  802569:	e8 fe f4 ff ff       	call   801a6c <fmap>
+  80256e:	83 c4 10             	add    $0x10,%esp
+  802571:	85 c0                	test   %eax,%eax
+  802573:	0f 8e b8 00 00 00    	jle    802631 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802579:	39 c6                	cmp    %eax,%esi
+  80257b:	0f 8d b5 00 00 00    	jge    802636 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802581:	29 f0                	sub    %esi,%eax
+  802583:	8b 55 14             	mov    0x14(%ebp),%edx
+  802586:	29 da                	sub    %ebx,%edx
+  802588:	39 d0                	cmp    %edx,%eax
+  80258a:	89 d3                	mov    %edx,%ebx
+  80258c:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80258f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802592:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802597:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80259d:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8025a3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025a6:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025ab:	83 ec 0c             	sub    $0xc,%esp
+  8025ae:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8025b0:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8025b7:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025ba:	83 c0 01             	add    $0x1,%eax
+  8025bd:	50                   	push   %eax
+  8025be:	68 00 10 01 e0       	push   $0xe0011000
+  8025c3:	6a 11                	push   $0x11
+  8025c5:	ff 35 24 63 80 00    	push   0x806324
+  8025cb:	e8 ba 12 00 00       	call   80388a <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8025d0:	83 c4 1c             	add    $0x1c,%esp
+  8025d3:	6a 00                	push   $0x0
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	6a 00                	push   $0x0
+  8025d9:	e8 e8 0f 00 00       	call   8035c6 <ipc_recv>
+  8025de:	83 c4 10             	add    $0x10,%esp
+  8025e1:	85 c0                	test   %eax,%eax
+  8025e3:	78 5b                	js     802640 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8025e5:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8025e7:	39 c3                	cmp    %eax,%ebx
+  8025e9:	0f 8e 4c ff ff ff    	jle    80253b <nsipc_sendfile+0x28>
+  8025ef:	eb 45                	jmp    802636 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8025f1:	83 ec 04             	sub    $0x4,%esp
+  8025f4:	6a 07                	push   $0x7
+  8025f6:	68 00 10 01 e0       	push   $0xe0011000
+  8025fb:	6a 00                	push   $0x0
+  8025fd:	e8 89 e7 ff ff       	call   800d8b <sys_page_alloc>
+  802602:	89 c7                	mov    %eax,%edi
+  802604:	83 c4 10             	add    $0x10,%esp
+  802607:	85 c0                	test   %eax,%eax
+  802609:	78 2b                	js     802636 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80260b:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802612:	00 00 00 
+  802615:	e9 0f ff ff ff       	jmp    802529 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80261a:	83 ec 0c             	sub    $0xc,%esp
+  80261d:	6a 03                	push   $0x3
+  80261f:	e8 9b 12 00 00       	call   8038bf <ipc_find_env>
+  802624:	a3 24 63 80 00       	mov    %eax,0x806324
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	e9 05 ff ff ff       	jmp    802536 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802631:	85 ff                	test   %edi,%edi
+  802633:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802636:	89 f8                	mov    %edi,%eax
+  802638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80263b:	5b                   	pop    %ebx
+  80263c:	5e                   	pop    %esi
+  80263d:	5f                   	pop    %edi
+  80263e:	5d                   	pop    %ebp
+  80263f:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802640:	85 ff                	test   %edi,%edi
+  802642:	0f 44 f8             	cmove  %eax,%edi
+  802645:	eb ef                	jmp    802636 <nsipc_sendfile+0x123>
+
+00802647 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802647:	55                   	push   %ebp
+  802648:	89 e5                	mov    %esp,%ebp
+  80264a:	57                   	push   %edi
+  80264b:	56                   	push   %esi
+  80264c:	53                   	push   %ebx
+  80264d:	83 ec 1c             	sub    $0x1c,%esp
+  802650:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802653:	e8 13 f9 ff ff       	call   801f6b <nsbulk_map>
+  802658:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	0f 88 ba 00 00 00    	js     80271d <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802663:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802667:	0f 8e bb 00 00 00    	jle    802728 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80266d:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802672:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802677:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80267c:	89 f8                	mov    %edi,%eax
+  80267e:	29 f0                	sub    %esi,%eax
+  802680:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802684:	39 c8                	cmp    %ecx,%eax
+  802686:	0f 47 c1             	cmova  %ecx,%eax
+  802689:	01 f0                	add    %esi,%eax
+  80268b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80268d:	83 c2 01             	add    $0x1,%edx
+  802690:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802693:	7e 07                	jle    80269c <nsipc_recvmsg+0x55>
+  802695:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80269a:	7e e0                	jle    80267c <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80269c:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8026a2:	c1 fa 0c             	sar    $0xc,%edx
+  8026a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026aa:	e8 0a f9 ff ff       	call   801fb9 <nsbulk_own>
+  8026af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	78 67                	js     80271d <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8026b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026b9:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8026be:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8026c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026c7:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8026cc:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8026d1:	89 f2                	mov    %esi,%edx
+  8026d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8026d8:	e8 44 f9 ff ff       	call   802021 <nsipc_bulk>
+  8026dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	78 39                	js     80271d <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8026e4:	39 f0                	cmp    %esi,%eax
+  8026e6:	7f 4a                	jg     802732 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8026e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	7e 2c                	jle    80271d <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8026f1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8026f4:	29 fe                	sub    %edi,%esi
+  8026f6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026f9:	39 c6                	cmp    %eax,%esi
+  8026fb:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8026fe:	83 ec 04             	sub    $0x4,%esp
+  802701:	56                   	push   %esi
+  802702:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802708:	50                   	push   %eax
+  802709:	ff 33                	push   (%ebx)
+  80270b:	e8 f7 e3 ff ff       	call   800b07 <memmove>
+		n += m;
+  802710:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802712:	83 c3 08             	add    $0x8,%ebx
+  802715:	83 c4 10             	add    $0x10,%esp
+  802718:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80271b:	7f d4                	jg     8026f1 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80271d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802723:	5b                   	pop    %ebx
+  802724:	5e                   	pop    %esi
+  802725:	5f                   	pop    %edi
+  802726:	5d                   	pop    %ebp
+  802727:	c3                   	ret
+	int r, i, n, len = 0;
+  802728:	be 00 00 00 00       	mov    $0x0,%esi
+  80272d:	e9 6a ff ff ff       	jmp    80269c <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802732:	68 20 40 80 00       	push   $0x804020
+  802737:	68 29 40 80 00       	push   $0x804029
+  80273c:	68 3b 01 00 00       	push   $0x13b
+  802741:	68 3e 40 80 00       	push   $0x80403e
+  802746:	e8 3a da ff ff       	call   800185 <_panic>
+
+0080274b <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80274b:	55                   	push   %ebp
+  80274c:	89 e5                	mov    %esp,%ebp
+  80274e:	57                   	push   %edi
+  80274f:	56                   	push   %esi
+  802750:	53                   	push   %ebx
+  802751:	83 ec 0c             	sub    $0xc,%esp
+  802754:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802757:	8b 75 10             	mov    0x10(%ebp),%esi
+  80275a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80275d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802760:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.select.req_readset = *readset;
+  802765:	8b 07                	mov    (%edi),%eax
+  802767:	a3 04 80 c0 00       	mov    %eax,0xc08004
+  80276c:	8b 47 04             	mov    0x4(%edi),%eax
+  80276f:	a3 08 80 c0 00       	mov    %eax,0xc08008
+  802774:	8b 47 08             	mov    0x8(%edi),%eax
+  802777:	a3 0c 80 c0 00       	mov    %eax,0xc0800c
+  80277c:	8b 47 0c             	mov    0xc(%edi),%eax
+  80277f:	a3 10 80 c0 00       	mov    %eax,0xc08010
+  802784:	8b 47 10             	mov    0x10(%edi),%eax
+  802787:	a3 14 80 c0 00       	mov    %eax,0xc08014
+  80278c:	8b 47 14             	mov    0x14(%edi),%eax
+  80278f:	a3 18 80 c0 00       	mov    %eax,0xc08018
+  802794:	8b 47 18             	mov    0x18(%edi),%eax
+  802797:	a3 1c 80 c0 00       	mov    %eax,0xc0801c
+  80279c:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80279f:	a3 20 80 c0 00       	mov    %eax,0xc08020
+  8027a4:	8b 47 20             	mov    0x20(%edi),%eax
+  8027a7:	a3 24 80 c0 00       	mov    %eax,0xc08024
+  8027ac:	8b 47 24             	mov    0x24(%edi),%eax
+  8027af:	a3 28 80 c0 00       	mov    %eax,0xc08028
+  8027b4:	8b 47 28             	mov    0x28(%edi),%eax
+  8027b7:	a3 2c 80 c0 00       	mov    %eax,0xc0802c
+  8027bc:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8027bf:	a3 30 80 c0 00       	mov    %eax,0xc08030
+  8027c4:	8b 47 30             	mov    0x30(%edi),%eax
+  8027c7:	a3 34 80 c0 00       	mov    %eax,0xc08034
+  8027cc:	8b 47 34             	mov    0x34(%edi),%eax
+  8027cf:	a3 38 80 c0 00       	mov    %eax,0xc08038
+  8027d4:	8b 47 38             	mov    0x38(%edi),%eax
+  8027d7:	a3 3c 80 c0 00       	mov    %eax,0xc0803c
+  8027dc:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8027df:	a3 40 80 c0 00       	mov    %eax,0xc08040
+	nsipcbuf.select.req_writeset = *writeset;
+  8027e4:	8b 06                	mov    (%esi),%eax
+  8027e6:	a3 44 80 c0 00       	mov    %eax,0xc08044
+  8027eb:	8b 46 04             	mov    0x4(%esi),%eax
+  8027ee:	a3 48 80 c0 00       	mov    %eax,0xc08048
+  8027f3:	8b 46 08             	mov    0x8(%esi),%eax
+  8027f6:	a3 4c 80 c0 00       	mov    %eax,0xc0804c
+  8027fb:	8b 46 0c             	mov    0xc(%esi),%eax
+  8027fe:	a3 50 80 c0 00       	mov    %eax,0xc08050
+  802803:	8b 46 10             	mov    0x10(%esi),%eax
+  802806:	a3 54 80 c0 00       	mov    %eax,0xc08054
+  80280b:	8b 46 14             	mov    0x14(%esi),%eax
+  80280e:	a3 58 80 c0 00       	mov    %eax,0xc08058
+  802813:	8b 46 18             	mov    0x18(%esi),%eax
+  802816:	a3 5c 80 c0 00       	mov    %eax,0xc0805c
+  80281b:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80281e:	a3 60 80 c0 00       	mov    %eax,0xc08060
+  802823:	8b 46 20             	mov    0x20(%esi),%eax
+  802826:	a3 64 80 c0 00       	mov    %eax,0xc08064
+  80282b:	8b 46 24             	mov    0x24(%esi),%eax
+  80282e:	a3 68 80 c0 00       	mov    %eax,0xc08068
+  802833:	8b 46 28             	mov    0x28(%esi),%eax
+  802836:	a3 6c 80 c0 00       	mov    %eax,0xc0806c
+  80283b:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80283e:	a3 70 80 c0 00       	mov    %eax,0xc08070
+  802843:	8b 46 30             	mov    0x30(%esi),%eax
+  802846:	a3 74 80 c0 00       	mov    %eax,0xc08074
+  80284b:	8b 46 34             	mov    0x34(%esi),%eax
+  80284e:	a3 78 80 c0 00       	mov    %eax,0xc08078
+  802853:	8b 46 38             	mov    0x38(%esi),%eax
+  802856:	a3 7c 80 c0 00       	mov    %eax,0xc0807c
+  80285b:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80285e:	a3 80 80 c0 00       	mov    %eax,0xc08080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802863:	8b 03                	mov    (%ebx),%eax
+  802865:	a3 84 80 c0 00       	mov    %eax,0xc08084
+  80286a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80286d:	a3 88 80 c0 00       	mov    %eax,0xc08088
+  802872:	8b 43 08             	mov    0x8(%ebx),%eax
+  802875:	a3 8c 80 c0 00       	mov    %eax,0xc0808c
+  80287a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80287d:	a3 90 80 c0 00       	mov    %eax,0xc08090
+  802882:	8b 43 10             	mov    0x10(%ebx),%eax
+  802885:	a3 94 80 c0 00       	mov    %eax,0xc08094
+  80288a:	8b 43 14             	mov    0x14(%ebx),%eax
+  80288d:	a3 98 80 c0 00       	mov    %eax,0xc08098
+  802892:	8b 43 18             	mov    0x18(%ebx),%eax
+  802895:	a3 9c 80 c0 00       	mov    %eax,0xc0809c
+  80289a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80289d:	a3 a0 80 c0 00       	mov    %eax,0xc080a0
+  8028a2:	8b 43 20             	mov    0x20(%ebx),%eax
+  8028a5:	a3 a4 80 c0 00       	mov    %eax,0xc080a4
+  8028aa:	8b 43 24             	mov    0x24(%ebx),%eax
+  8028ad:	a3 a8 80 c0 00       	mov    %eax,0xc080a8
+  8028b2:	8b 43 28             	mov    0x28(%ebx),%eax
+  8028b5:	a3 ac 80 c0 00       	mov    %eax,0xc080ac
+  8028ba:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8028bd:	a3 b0 80 c0 00       	mov    %eax,0xc080b0
+  8028c2:	8b 43 30             	mov    0x30(%ebx),%eax
+  8028c5:	a3 b4 80 c0 00       	mov    %eax,0xc080b4
+  8028ca:	8b 43 34             	mov    0x34(%ebx),%eax
+  8028cd:	a3 b8 80 c0 00       	mov    %eax,0xc080b8
+  8028d2:	8b 43 38             	mov    0x38(%ebx),%eax
+  8028d5:	a3 bc 80 c0 00       	mov    %eax,0xc080bc
+  8028da:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8028dd:	a3 c0 80 c0 00       	mov    %eax,0xc080c0
+	nsipcbuf.select.req_timeout = msec;
+  8028e2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8028e5:	a3 c4 80 c0 00       	mov    %eax,0xc080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8028ea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8028ef:	e8 2b f6 ff ff       	call   801f1f <nsipc>
+  8028f4:	85 c0                	test   %eax,%eax
+  8028f6:	0f 88 ad 01 00 00    	js     802aa9 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8028fc:	8b 15 04 80 c0 00    	mov    0xc08004,%edx
+  802902:	89 17                	mov    %edx,(%edi)
+  802904:	8b 15 08 80 c0 00    	mov    0xc08008,%edx
+  80290a:	89 57 04             	mov    %edx,0x4(%edi)
+  80290d:	8b 15 0c 80 c0 00    	mov    0xc0800c,%edx
+  802913:	89 57 08             	mov    %edx,0x8(%edi)
+  802916:	8b 15 10 80 c0 00    	mov    0xc08010,%edx
+  80291c:	89 57 0c             	mov    %edx,0xc(%edi)
+  80291f:	8b 15 14 80 c0 00    	mov    0xc08014,%edx
+  802925:	89 57 10             	mov    %edx,0x10(%edi)
+  802928:	8b 15 18 80 c0 00    	mov    0xc08018,%edx
+  80292e:	89 57 14             	mov    %edx,0x14(%edi)
+  802931:	8b 15 1c 80 c0 00    	mov    0xc0801c,%edx
+  802937:	89 57 18             	mov    %edx,0x18(%edi)
+  80293a:	8b 15 20 80 c0 00    	mov    0xc08020,%edx
+  802940:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802943:	8b 15 24 80 c0 00    	mov    0xc08024,%edx
+  802949:	89 57 20             	mov    %edx,0x20(%edi)
+  80294c:	8b 15 28 80 c0 00    	mov    0xc08028,%edx
+  802952:	89 57 24             	mov    %edx,0x24(%edi)
+  802955:	8b 15 2c 80 c0 00    	mov    0xc0802c,%edx
+  80295b:	89 57 28             	mov    %edx,0x28(%edi)
+  80295e:	8b 15 30 80 c0 00    	mov    0xc08030,%edx
+  802964:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802967:	8b 15 34 80 c0 00    	mov    0xc08034,%edx
+  80296d:	89 57 30             	mov    %edx,0x30(%edi)
+  802970:	8b 15 38 80 c0 00    	mov    0xc08038,%edx
+  802976:	89 57 34             	mov    %edx,0x34(%edi)
+  802979:	8b 15 3c 80 c0 00    	mov    0xc0803c,%edx
+  80297f:	89 57 38             	mov    %edx,0x38(%edi)
+  802982:	8b 15 40 80 c0 00    	mov    0xc08040,%edx
+  802988:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80298b:	8b 15 44 80 c0 00    	mov    0xc08044,%edx
+  802991:	89 16                	mov    %edx,(%esi)
+  802993:	8b 15 48 80 c0 00    	mov    0xc08048,%edx
+  802999:	89 56 04             	mov    %edx,0x4(%esi)
+  80299c:	8b 15 4c 80 c0 00    	mov    0xc0804c,%edx
+  8029a2:	89 56 08             	mov    %edx,0x8(%esi)
+  8029a5:	8b 15 50 80 c0 00    	mov    0xc08050,%edx
+  8029ab:	89 56 0c             	mov    %edx,0xc(%esi)
+  8029ae:	8b 15 54 80 c0 00    	mov    0xc08054,%edx
+  8029b4:	89 56 10             	mov    %edx,0x10(%esi)
+  8029b7:	8b 15 58 80 c0 00    	mov    0xc08058,%edx
+  8029bd:	89 56 14             	mov    %edx,0x14(%esi)
+  8029c0:	8b 15 5c 80 c0 00    	mov    0xc0805c,%edx
+  8029c6:	89 56 18             	mov    %edx,0x18(%esi)
+  8029c9:	8b 15 60 80 c0 00    	mov    0xc08060,%edx
+  8029cf:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8029d2:	8b 15 64 80 c0 00    	mov    0xc08064,%edx
+  8029d8:	89 56 20             	mov    %edx,0x20(%esi)
+  8029db:	8b 15 68 80 c0 00    	mov    0xc08068,%edx
+  8029e1:	89 56 24             	mov    %edx,0x24(%esi)
+  8029e4:	8b 15 6c 80 c0 00    	mov    0xc0806c,%edx
+  8029ea:	89 56 28             	mov    %edx,0x28(%esi)
+  8029ed:	8b 15 70 80 c0 00    	mov    0xc08070,%edx
+  8029f3:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8029f6:	8b 15 74 80 c0 00    	mov    0xc08074,%edx
+  8029fc:	89 56 30             	mov    %edx,0x30(%esi)
+  8029ff:	8b 15 78 80 c0 00    	mov    0xc08078,%edx
+  802a05:	89 56 34             	mov    %edx,0x34(%esi)
+  802a08:	8b 15 7c 80 c0 00    	mov    0xc0807c,%edx
+  802a0e:	89 56 38             	mov    %edx,0x38(%esi)
+  802a11:	8b 15 80 80 c0 00    	mov    0xc08080,%edx
+  802a17:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802a1a:	8b 15 84 80 c0 00    	mov    0xc08084,%edx
+  802a20:	89 13                	mov    %edx,(%ebx)
+  802a22:	8b 15 88 80 c0 00    	mov    0xc08088,%edx
+  802a28:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a2b:	8b 15 8c 80 c0 00    	mov    0xc0808c,%edx
+  802a31:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a34:	8b 15 90 80 c0 00    	mov    0xc08090,%edx
+  802a3a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a3d:	8b 15 94 80 c0 00    	mov    0xc08094,%edx
+  802a43:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a46:	8b 15 98 80 c0 00    	mov    0xc08098,%edx
+  802a4c:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a4f:	8b 15 9c 80 c0 00    	mov    0xc0809c,%edx
+  802a55:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a58:	8b 15 a0 80 c0 00    	mov    0xc080a0,%edx
+  802a5e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a61:	8b 15 a4 80 c0 00    	mov    0xc080a4,%edx
+  802a67:	89 53 20             	mov    %edx,0x20(%ebx)
+  802a6a:	8b 15 a8 80 c0 00    	mov    0xc080a8,%edx
+  802a70:	89 53 24             	mov    %edx,0x24(%ebx)
+  802a73:	8b 15 ac 80 c0 00    	mov    0xc080ac,%edx
+  802a79:	89 53 28             	mov    %edx,0x28(%ebx)
+  802a7c:	8b 15 b0 80 c0 00    	mov    0xc080b0,%edx
+  802a82:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802a85:	8b 15 b4 80 c0 00    	mov    0xc080b4,%edx
+  802a8b:	89 53 30             	mov    %edx,0x30(%ebx)
+  802a8e:	8b 15 b8 80 c0 00    	mov    0xc080b8,%edx
+  802a94:	89 53 34             	mov    %edx,0x34(%ebx)
+  802a97:	8b 15 bc 80 c0 00    	mov    0xc080bc,%edx
+  802a9d:	89 53 38             	mov    %edx,0x38(%ebx)
+  802aa0:	8b 15 c0 80 c0 00    	mov    0xc080c0,%edx
+  802aa6:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802aa9:	83 c4 0c             	add    $0xc,%esp
+  802aac:	5b                   	pop    %ebx
+  802aad:	5e                   	pop    %esi
+  802aae:	5f                   	pop    %edi
+  802aaf:	5d                   	pop    %ebp
+  802ab0:	c3                   	ret
+
+00802ab1 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802ab1:	55                   	push   %ebp
+  802ab2:	89 e5                	mov    %esp,%ebp
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aba:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.evctl.req_events = events;
+  802abf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ac2:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	nsipcbuf.evctl.req_data = data;
+  802ac7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aca:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_EVCTL);
+  802acf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ad4:	e8 46 f4 ff ff       	call   801f1f <nsipc>
+}
+  802ad9:	c9                   	leave
+  802ada:	c3                   	ret
+
+00802adb <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802adb:	55                   	push   %ebp
+  802adc:	89 e5                	mov    %esp,%ebp
+  802ade:	56                   	push   %esi
+  802adf:	53                   	push   %ebx
+  802ae0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802ae3:	89 35 00 80 c0 00    	mov    %esi,0xc08000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ae9:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aec:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802af1:	b8 10 00 00 00       	mov    $0x10,%eax
+  802af6:	e8 24 f4 ff ff       	call   801f1f <nsipc>
+  802afb:	89 c3                	mov    %eax,%ebx
+  802afd:	85 c0                	test   %eax,%eax
+  802aff:	7e 1f                	jle    802b20 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802b01:	39 c6                	cmp    %eax,%esi
+  802b03:	7c 24                	jl     802b29 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802b05:	83 ec 04             	sub    $0x4,%esp
+  802b08:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802b0f:	50                   	push   %eax
+  802b10:	68 00 80 c0 00       	push   $0xc08000
+  802b15:	ff 75 08             	push   0x8(%ebp)
+  802b18:	e8 ea df ff ff       	call   800b07 <memmove>
+  802b1d:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b20:	89 d8                	mov    %ebx,%eax
+  802b22:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b25:	5b                   	pop    %ebx
+  802b26:	5e                   	pop    %esi
+  802b27:	5d                   	pop    %ebp
+  802b28:	c3                   	ret
+		assert(r <= max);
+  802b29:	68 56 40 80 00       	push   $0x804056
+  802b2e:	68 29 40 80 00       	push   $0x804029
+  802b33:	68 6a 01 00 00       	push   $0x16a
+  802b38:	68 3e 40 80 00       	push   $0x80403e
+  802b3d:	e8 43 d6 ff ff       	call   800185 <_panic>
+
+00802b42 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b48:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4b:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	nsipcbuf.socket.req_type = type;
+  802b50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b53:	a3 04 80 c0 00       	mov    %eax,0xc08004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b58:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b5b:	a3 08 80 c0 00       	mov    %eax,0xc08008
+	return nsipc(NSREQ_SOCKET);
+  802b60:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b65:	e8 b5 f3 ff ff       	call   801f1f <nsipc>
+}
+  802b6a:	c9                   	leave
+  802b6b:	c3                   	ret
+
+00802b6c <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802b6c:	55                   	push   %ebp
+  802b6d:	89 e5                	mov    %esp,%ebp
+  802b6f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b75:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	return nsipc(NSREQ_OFFLOAD);
+  802b7a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b7f:	e8 9b f3 ff ff       	call   801f1f <nsipc>
+}
+  802b84:	c9                   	leave
+  802b85:	c3                   	ret
+
+00802b86 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802b86:	55                   	push   %ebp
+  802b87:	89 e5                	mov    %esp,%ebp
+  802b89:	53                   	push   %ebx
+  802b8a:	83 ec 04             	sub    $0x4,%esp
+  802b8d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802b90:	b8 12 00 00 00       	mov    $0x12,%eax
+  802b95:	e8 85 f3 ff ff       	call   801f1f <nsipc>
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	78 50                	js     802bee <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802b9e:	8b 15 00 80 c0 00    	mov    0xc08000,%edx
+  802ba4:	89 13                	mov    %edx,(%ebx)
+  802ba6:	8b 15 04 80 c0 00    	mov    0xc08004,%edx
+  802bac:	89 53 04             	mov    %edx,0x4(%ebx)
+  802baf:	8b 15 08 80 c0 00    	mov    0xc08008,%edx
+  802bb5:	89 53 08             	mov    %edx,0x8(%ebx)
+  802bb8:	8b 15 0c 80 c0 00    	mov    0xc0800c,%edx
+  802bbe:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802bc1:	8b 15 10 80 c0 00    	mov    0xc08010,%edx
+  802bc7:	89 53 10             	mov    %edx,0x10(%ebx)
+  802bca:	8b 15 14 80 c0 00    	mov    0xc08014,%edx
+  802bd0:	89 53 14             	mov    %edx,0x14(%ebx)
+  802bd3:	8b 15 18 80 c0 00    	mov    0xc08018,%edx
+  802bd9:	89 53 18             	mov    %edx,0x18(%ebx)
+  802bdc:	8b 15 1c 80 c0 00    	mov    0xc0801c,%edx
+  802be2:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802be5:	8b 15 20 80 c0 00    	mov    0xc08020,%edx
+  802beb:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+
+00802bf3 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802bf3:	55                   	push   %ebp
+  802bf4:	89 e5                	mov    %esp,%ebp
+  802bf6:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bf9:	6a 03                	push   $0x3
+  802bfb:	e8 bf 0c 00 00       	call   8038bf <ipc_find_env>
+  802c00:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c08:	a3 00 80 c0 00       	mov    %eax,0xc08000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802c0d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802c12:	e8 08 f3 ff ff       	call   801f1f <nsipc>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	78 0a                	js     802c28 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802c1e:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802c23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c28:	c9                   	leave
+  802c29:	c3                   	ret
+
+00802c2a <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c2a:	55                   	push   %ebp
+  802c2b:	89 e5                	mov    %esp,%ebp
+  802c2d:	57                   	push   %edi
+  802c2e:	56                   	push   %esi
+  802c2f:	53                   	push   %ebx
+  802c30:	83 ec 1c             	sub    $0x1c,%esp
+  802c33:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c36:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c39:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c43:	89 e0                	mov    %esp,%eax
+  802c45:	89 f2                	mov    %esi,%edx
+  802c47:	29 c2                	sub    %eax,%edx
+  802c49:	89 d0                	mov    %edx,%eax
+  802c4b:	c1 e8 0f             	shr    $0xf,%eax
+  802c4e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c54:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c57:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  802c5e:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c61:	83 ec 0c             	sub    $0xc,%esp
+  802c64:	ff 75 e0             	push   -0x20(%ebp)
+  802c67:	e8 92 0c 00 00       	call   8038fe <pageref>
+  802c6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c6f:	83 c4 04             	add    $0x4,%esp
+  802c72:	ff 75 dc             	push   -0x24(%ebp)
+  802c75:	e8 84 0c 00 00       	call   8038fe <pageref>
+  802c7a:	89 e2                	mov    %esp,%edx
+  802c7c:	89 f1                	mov    %esi,%ecx
+  802c7e:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802c80:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802c83:	89 ca                	mov    %ecx,%edx
+  802c85:	c1 ea 0f             	shr    $0xf,%edx
+  802c88:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802c8e:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802c91:	8b 14 95 40 63 c0 00 	mov    0xc06340(,%edx,4),%edx
+  802c98:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802c9b:	39 d7                	cmp    %edx,%edi
+  802c9d:	74 40                	je     802cdf <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802c9f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ca2:	75 9f                	jne    802c43 <_pipeisclosed+0x19>
+  802ca4:	89 e2                	mov    %esp,%edx
+  802ca6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802cab:	29 d0                	sub    %edx,%eax
+  802cad:	89 c2                	mov    %eax,%edx
+  802caf:	c1 ea 0f             	shr    $0xf,%edx
+  802cb2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cbc:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cbf:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  802cc6:	8b 40 58             	mov    0x58(%eax),%eax
+  802cc9:	6a 01                	push   $0x1
+  802ccb:	50                   	push   %eax
+  802ccc:	57                   	push   %edi
+  802ccd:	68 5f 40 80 00       	push   $0x80405f
+  802cd2:	e8 89 d5 ff ff       	call   800260 <cprintf>
+  802cd7:	83 c4 10             	add    $0x10,%esp
+  802cda:	e9 5f ff ff ff       	jmp    802c3e <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802cdf:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ce2:	0f 94 c0             	sete   %al
+  802ce5:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802ce8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ceb:	5b                   	pop    %ebx
+  802cec:	5e                   	pop    %esi
+  802ced:	5f                   	pop    %edi
+  802cee:	5d                   	pop    %ebp
+  802cef:	c3                   	ret
+
+00802cf0 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cf0:	55                   	push   %ebp
+  802cf1:	89 e5                	mov    %esp,%ebp
+  802cf3:	53                   	push   %ebx
+  802cf4:	83 ec 0c             	sub    $0xc,%esp
+  802cf7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cfa:	53                   	push   %ebx
+  802cfb:	6a 00                	push   $0x0
+  802cfd:	e8 0e e1 ff ff       	call   800e10 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d02:	89 1c 24             	mov    %ebx,(%esp)
+  802d05:	e8 f4 e4 ff ff       	call   8011fe <fd2data>
+  802d0a:	83 c4 08             	add    $0x8,%esp
+  802d0d:	50                   	push   %eax
+  802d0e:	6a 00                	push   $0x0
+  802d10:	e8 fb e0 ff ff       	call   800e10 <sys_page_unmap>
+}
+  802d15:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d18:	c9                   	leave
+  802d19:	c3                   	ret
+
+00802d1a <devpipe_read>:
+{
+  802d1a:	55                   	push   %ebp
+  802d1b:	89 e5                	mov    %esp,%ebp
+  802d1d:	57                   	push   %edi
+  802d1e:	56                   	push   %esi
+  802d1f:	53                   	push   %ebx
+  802d20:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d23:	ff 75 08             	push   0x8(%ebp)
+  802d26:	e8 d3 e4 ff ff       	call   8011fe <fd2data>
+  802d2b:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d2d:	8b 70 04             	mov    0x4(%eax),%esi
+  802d30:	8b 00                	mov    (%eax),%eax
+  802d32:	83 c4 10             	add    $0x10,%esp
+  802d35:	39 f0                	cmp    %esi,%eax
+  802d37:	75 36                	jne    802d6f <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d39:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d3c:	89 da                	mov    %ebx,%edx
+  802d3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d41:	e8 e4 fe ff ff       	call   802c2a <_pipeisclosed>
+  802d46:	85 c0                	test   %eax,%eax
+  802d48:	0f 85 d4 00 00 00    	jne    802e22 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d53:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d57:	83 ec 04             	sub    $0x4,%esp
+  802d5a:	6a ff                	push   $0xffffffff
+  802d5c:	56                   	push   %esi
+  802d5d:	57                   	push   %edi
+  802d5e:	e8 26 e4 ff ff       	call   801189 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d63:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d66:	8b 03                	mov    (%ebx),%eax
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	39 c6                	cmp    %eax,%esi
+  802d6d:	74 cd                	je     802d3c <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d6f:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d72:	8b 03                	mov    (%ebx),%eax
+  802d74:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802d7a:	29 c6                	sub    %eax,%esi
+  802d7c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d81:	f7 e6                	mul    %esi
+  802d83:	c1 ea 0c             	shr    $0xc,%edx
+  802d86:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802d8c:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802d8e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d91:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802d95:	8b 0b                	mov    (%ebx),%ecx
+  802d97:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d9c:	f7 e1                	mul    %ecx
+  802d9e:	c1 ea 0b             	shr    $0xb,%edx
+  802da1:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802da7:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802da9:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802dae:	29 cf                	sub    %ecx,%edi
+  802db0:	39 f7                	cmp    %esi,%edi
+  802db2:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802db5:	83 ec 04             	sub    $0x4,%esp
+  802db8:	57                   	push   %edi
+  802db9:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802dbd:	50                   	push   %eax
+  802dbe:	ff 75 0c             	push   0xc(%ebp)
+  802dc1:	e8 41 dd ff ff       	call   800b07 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802dc6:	83 c4 0c             	add    $0xc,%esp
+  802dc9:	89 f0                	mov    %esi,%eax
+  802dcb:	29 f8                	sub    %edi,%eax
+  802dcd:	50                   	push   %eax
+  802dce:	8d 43 10             	lea    0x10(%ebx),%eax
+  802dd1:	50                   	push   %eax
+  802dd2:	89 f8                	mov    %edi,%eax
+  802dd4:	03 45 0c             	add    0xc(%ebp),%eax
+  802dd7:	50                   	push   %eax
+  802dd8:	e8 2a dd ff ff       	call   800b07 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802ddd:	8b 0b                	mov    (%ebx),%ecx
+  802ddf:	01 f1                	add    %esi,%ecx
+  802de1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802de6:	f7 e1                	mul    %ecx
+  802de8:	c1 ea 0c             	shr    $0xc,%edx
+  802deb:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802df1:	29 c1                	sub    %eax,%ecx
+  802df3:	89 0b                	mov    %ecx,(%ebx)
+  802df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfa:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802dfe:	83 c4 10             	add    $0x10,%esp
+  802e01:	85 c0                	test   %eax,%eax
+  802e03:	75 0a                	jne    802e0f <devpipe_read+0xf5>
+	return n;
+  802e05:	89 f0                	mov    %esi,%eax
+}
+  802e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e0a:	5b                   	pop    %ebx
+  802e0b:	5e                   	pop    %esi
+  802e0c:	5f                   	pop    %edi
+  802e0d:	5d                   	pop    %ebp
+  802e0e:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802e0f:	83 ec 08             	sub    $0x8,%esp
+  802e12:	68 00 04 00 00       	push   $0x400
+  802e17:	53                   	push   %ebx
+  802e18:	e8 8e e3 ff ff       	call   8011ab <sys_futex_wake>
+  802e1d:	83 c4 10             	add    $0x10,%esp
+  802e20:	eb e3                	jmp    802e05 <devpipe_read+0xeb>
+			return 0;
+  802e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e27:	eb de                	jmp    802e07 <devpipe_read+0xed>
+
+00802e29 <devpipe_write>:
+{
+  802e29:	55                   	push   %ebp
+  802e2a:	89 e5                	mov    %esp,%ebp
+  802e2c:	57                   	push   %edi
+  802e2d:	56                   	push   %esi
+  802e2e:	53                   	push   %ebx
+  802e2f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e32:	ff 75 08             	push   0x8(%ebp)
+  802e35:	e8 c4 e3 ff ff       	call   8011fe <fd2data>
+  802e3a:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e46:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e4b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e4f:	0f 84 43 01 00 00    	je     802f98 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e55:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e58:	8b 06                	mov    (%esi),%eax
+  802e5a:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e60:	29 c1                	sub    %eax,%ecx
+  802e62:	89 c8                	mov    %ecx,%eax
+  802e64:	f7 e7                	mul    %edi
+  802e66:	c1 ea 0c             	shr    $0xc,%edx
+  802e69:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e6f:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802e71:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e77:	75 52                	jne    802ecb <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802e79:	89 f2                	mov    %esi,%edx
+  802e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e7e:	e8 a7 fd ff ff       	call   802c2a <_pipeisclosed>
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	0f 85 28 01 00 00    	jne    802fb3 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802e8b:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e8d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e90:	8b 06                	mov    (%esi),%eax
+  802e92:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e98:	29 c1                	sub    %eax,%ecx
+  802e9a:	89 c8                	mov    %ecx,%eax
+  802e9c:	f7 e7                	mul    %edi
+  802e9e:	c1 ea 0c             	shr    $0xc,%edx
+  802ea1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ea7:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802ea9:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802eaf:	75 a4                	jne    802e55 <devpipe_write+0x2c>
+  802eb1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802eb6:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802eba:	83 ec 04             	sub    $0x4,%esp
+  802ebd:	6a ff                	push   $0xffffffff
+  802ebf:	53                   	push   %ebx
+  802ec0:	56                   	push   %esi
+  802ec1:	e8 c3 e2 ff ff       	call   801189 <sys_futex_wait>
+}
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	eb 8a                	jmp    802e55 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ecb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ece:	8b 06                	mov    (%esi),%eax
+  802ed0:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ed6:	29 c1                	sub    %eax,%ecx
+  802ed8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802edd:	f7 e1                	mul    %ecx
+  802edf:	c1 ea 0c             	shr    $0xc,%edx
+  802ee2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ee8:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802eea:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802eef:	89 d8                	mov    %ebx,%eax
+  802ef1:	29 c8                	sub    %ecx,%eax
+  802ef3:	8b 55 10             	mov    0x10(%ebp),%edx
+  802ef6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ef9:	29 ca                	sub    %ecx,%edx
+  802efb:	39 d0                	cmp    %edx,%eax
+  802efd:	0f 46 d0             	cmovbe %eax,%edx
+  802f00:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f03:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f06:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f0b:	f7 e1                	mul    %ecx
+  802f0d:	c1 ea 0b             	shr    $0xb,%edx
+  802f10:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f16:	89 ca                	mov    %ecx,%edx
+  802f18:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f1a:	29 d3                	sub    %edx,%ebx
+  802f1c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f1f:	39 c3                	cmp    %eax,%ebx
+  802f21:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802f24:	83 ec 04             	sub    $0x4,%esp
+  802f27:	53                   	push   %ebx
+  802f28:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f2b:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f2e:	51                   	push   %ecx
+  802f2f:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f33:	50                   	push   %eax
+  802f34:	e8 ce db ff ff       	call   800b07 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f39:	83 c4 0c             	add    $0xc,%esp
+  802f3c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f3f:	29 d8                	sub    %ebx,%eax
+  802f41:	50                   	push   %eax
+  802f42:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f45:	01 cb                	add    %ecx,%ebx
+  802f47:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f4a:	53                   	push   %ebx
+  802f4b:	8d 46 10             	lea    0x10(%esi),%eax
+  802f4e:	50                   	push   %eax
+  802f4f:	e8 b3 db ff ff       	call   800b07 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f54:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f57:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f5a:	01 c1                	add    %eax,%ecx
+  802f5c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f61:	f7 e1                	mul    %ecx
+  802f63:	c1 ea 0c             	shr    $0xc,%edx
+  802f66:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f6c:	89 ca                	mov    %ecx,%edx
+  802f6e:	29 c2                	sub    %eax,%edx
+  802f70:	89 56 04             	mov    %edx,0x4(%esi)
+  802f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f78:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802f7c:	83 c4 10             	add    $0x10,%esp
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	75 1a                	jne    802f9d <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802f83:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f86:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802f89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f8c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f8f:	0f 82 c0 fe ff ff    	jb     802e55 <devpipe_write+0x2c>
+  802f95:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802f98:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f9b:	eb 1b                	jmp    802fb8 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802f9d:	83 ec 08             	sub    $0x8,%esp
+  802fa0:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802fa5:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802fa8:	50                   	push   %eax
+  802fa9:	e8 fd e1 ff ff       	call   8011ab <sys_futex_wake>
+  802fae:	83 c4 10             	add    $0x10,%esp
+  802fb1:	eb d0                	jmp    802f83 <devpipe_write+0x15a>
+				return 0;
+  802fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fbb:	5b                   	pop    %ebx
+  802fbc:	5e                   	pop    %esi
+  802fbd:	5f                   	pop    %edi
+  802fbe:	5d                   	pop    %ebp
+  802fbf:	c3                   	ret
+
+00802fc0 <devpipe_stat>:
+{
+  802fc0:	55                   	push   %ebp
+  802fc1:	89 e5                	mov    %esp,%ebp
+  802fc3:	56                   	push   %esi
+  802fc4:	53                   	push   %ebx
+  802fc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fc8:	83 ec 0c             	sub    $0xc,%esp
+  802fcb:	ff 75 08             	push   0x8(%ebp)
+  802fce:	e8 2b e2 ff ff       	call   8011fe <fd2data>
+  802fd3:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fd5:	83 c4 08             	add    $0x8,%esp
+  802fd8:	68 72 40 80 00       	push   $0x804072
+  802fdd:	53                   	push   %ebx
+  802fde:	e8 74 d9 ff ff       	call   800957 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fe3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fe6:	8b 06                	mov    (%esi),%eax
+  802fe8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fee:	29 c1                	sub    %eax,%ecx
+  802ff0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802ff5:	89 c8                	mov    %ecx,%eax
+  802ff7:	f7 e2                	mul    %edx
+  802ff9:	c1 ea 0c             	shr    $0xc,%edx
+  802ffc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803002:	29 d1                	sub    %edx,%ecx
+  803004:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80300a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803011:	00 00 00 
+	stat->st_dev = &devpipe;
+  803014:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80301b:	50 80 00 
+}
+  80301e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803023:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803026:	5b                   	pop    %ebx
+  803027:	5e                   	pop    %esi
+  803028:	5d                   	pop    %ebp
+  803029:	c3                   	ret
+
+0080302a <devpipe_poll>:
+{
+  80302a:	55                   	push   %ebp
+  80302b:	89 e5                	mov    %esp,%ebp
+  80302d:	57                   	push   %edi
+  80302e:	56                   	push   %esi
+  80302f:	53                   	push   %ebx
+  803030:	83 ec 18             	sub    $0x18,%esp
+  803033:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803036:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803039:	57                   	push   %edi
+  80303a:	e8 bf e1 ff ff       	call   8011fe <fd2data>
+  80303f:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803041:	83 c4 10             	add    $0x10,%esp
+  803044:	89 f3                	mov    %esi,%ebx
+  803046:	83 e3 01             	and    $0x1,%ebx
+  803049:	75 27                	jne    803072 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80304b:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803051:	75 48                	jne    80309b <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803053:	89 ca                	mov    %ecx,%edx
+  803055:	89 f8                	mov    %edi,%eax
+  803057:	e8 ce fb ff ff       	call   802c2a <_pipeisclosed>
+  80305c:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80305e:	89 d8                	mov    %ebx,%eax
+  803060:	83 c8 10             	or     $0x10,%eax
+  803063:	85 d2                	test   %edx,%edx
+  803065:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803068:	89 d8                	mov    %ebx,%eax
+  80306a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80306d:	5b                   	pop    %ebx
+  80306e:	5e                   	pop    %esi
+  80306f:	5f                   	pop    %edi
+  803070:	5d                   	pop    %ebp
+  803071:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803072:	8b 58 04             	mov    0x4(%eax),%ebx
+  803075:	8b 00                	mov    (%eax),%eax
+  803077:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80307d:	29 c3                	sub    %eax,%ebx
+  80307f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803084:	89 d8                	mov    %ebx,%eax
+  803086:	f7 e2                	mul    %edx
+  803088:	c1 ea 0c             	shr    $0xc,%edx
+  80308b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803091:	39 d3                	cmp    %edx,%ebx
+  803093:	0f 95 c3             	setne  %bl
+  803096:	0f b6 db             	movzbl %bl,%ebx
+  803099:	eb b0                	jmp    80304b <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80309b:	8b 71 04             	mov    0x4(%ecx),%esi
+  80309e:	8b 01                	mov    (%ecx),%eax
+  8030a0:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8030a6:	29 c6                	sub    %eax,%esi
+  8030a8:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030ad:	89 f0                	mov    %esi,%eax
+  8030af:	f7 e2                	mul    %edx
+  8030b1:	c1 ea 0c             	shr    $0xc,%edx
+  8030b4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030ba:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8030bc:	89 d8                	mov    %ebx,%eax
+  8030be:	83 c8 04             	or     $0x4,%eax
+  8030c1:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8030c7:	0f 42 d8             	cmovb  %eax,%ebx
+  8030ca:	eb 87                	jmp    803053 <devpipe_poll+0x29>
+
+008030cc <pipe>:
+{
+  8030cc:	55                   	push   %ebp
+  8030cd:	89 e5                	mov    %esp,%ebp
+  8030cf:	56                   	push   %esi
+  8030d0:	53                   	push   %ebx
+  8030d1:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030d7:	50                   	push   %eax
+  8030d8:	e8 38 e1 ff ff       	call   801215 <fd_alloc>
+  8030dd:	89 c3                	mov    %eax,%ebx
+  8030df:	83 c4 10             	add    $0x10,%esp
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	0f 88 23 01 00 00    	js     80320d <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030ea:	83 ec 04             	sub    $0x4,%esp
+  8030ed:	68 07 04 00 00       	push   $0x407
+  8030f2:	ff 75 f4             	push   -0xc(%ebp)
+  8030f5:	6a 00                	push   $0x0
+  8030f7:	e8 8f dc ff ff       	call   800d8b <sys_page_alloc>
+  8030fc:	89 c3                	mov    %eax,%ebx
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  803101:	85 c0                	test   %eax,%eax
+  803103:	0f 88 04 01 00 00    	js     80320d <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803109:	83 ec 0c             	sub    $0xc,%esp
+  80310c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80310f:	50                   	push   %eax
+  803110:	e8 00 e1 ff ff       	call   801215 <fd_alloc>
+  803115:	89 c3                	mov    %eax,%ebx
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	0f 88 db 00 00 00    	js     8031fd <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803122:	83 ec 04             	sub    $0x4,%esp
+  803125:	68 07 04 00 00       	push   $0x407
+  80312a:	ff 75 f0             	push   -0x10(%ebp)
+  80312d:	6a 00                	push   $0x0
+  80312f:	e8 57 dc ff ff       	call   800d8b <sys_page_alloc>
+  803134:	89 c3                	mov    %eax,%ebx
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	0f 88 bc 00 00 00    	js     8031fd <pipe+0x131>
+	va = fd2data(fd0);
+  803141:	83 ec 0c             	sub    $0xc,%esp
+  803144:	ff 75 f4             	push   -0xc(%ebp)
+  803147:	e8 b2 e0 ff ff       	call   8011fe <fd2data>
+  80314c:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80314e:	83 c4 0c             	add    $0xc,%esp
+  803151:	68 07 04 00 00       	push   $0x407
+  803156:	50                   	push   %eax
+  803157:	6a 00                	push   $0x0
+  803159:	e8 2d dc ff ff       	call   800d8b <sys_page_alloc>
+  80315e:	89 c3                	mov    %eax,%ebx
+  803160:	83 c4 10             	add    $0x10,%esp
+  803163:	85 c0                	test   %eax,%eax
+  803165:	0f 88 82 00 00 00    	js     8031ed <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80316b:	83 ec 0c             	sub    $0xc,%esp
+  80316e:	ff 75 f0             	push   -0x10(%ebp)
+  803171:	e8 88 e0 ff ff       	call   8011fe <fd2data>
+  803176:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80317d:	50                   	push   %eax
+  80317e:	6a 00                	push   $0x0
+  803180:	56                   	push   %esi
+  803181:	6a 00                	push   $0x0
+  803183:	e8 46 dc ff ff       	call   800dce <sys_page_map>
+  803188:	89 c3                	mov    %eax,%ebx
+  80318a:	83 c4 20             	add    $0x20,%esp
+  80318d:	85 c0                	test   %eax,%eax
+  80318f:	78 4e                	js     8031df <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803191:	a1 60 50 80 00       	mov    0x805060,%eax
+  803196:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803199:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80319b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80319e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031a5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031a8:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031ad:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031b4:	83 ec 0c             	sub    $0xc,%esp
+  8031b7:	ff 75 f4             	push   -0xc(%ebp)
+  8031ba:	e8 2f e0 ff ff       	call   8011ee <fd2num>
+  8031bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031c2:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031c4:	83 c4 04             	add    $0x4,%esp
+  8031c7:	ff 75 f0             	push   -0x10(%ebp)
+  8031ca:	e8 1f e0 ff ff       	call   8011ee <fd2num>
+  8031cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031d2:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031d5:	83 c4 10             	add    $0x10,%esp
+  8031d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031dd:	eb 2e                	jmp    80320d <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031df:	83 ec 08             	sub    $0x8,%esp
+  8031e2:	56                   	push   %esi
+  8031e3:	6a 00                	push   $0x0
+  8031e5:	e8 26 dc ff ff       	call   800e10 <sys_page_unmap>
+  8031ea:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031ed:	83 ec 08             	sub    $0x8,%esp
+  8031f0:	ff 75 f0             	push   -0x10(%ebp)
+  8031f3:	6a 00                	push   $0x0
+  8031f5:	e8 16 dc ff ff       	call   800e10 <sys_page_unmap>
+  8031fa:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031fd:	83 ec 08             	sub    $0x8,%esp
+  803200:	ff 75 f4             	push   -0xc(%ebp)
+  803203:	6a 00                	push   $0x0
+  803205:	e8 06 dc ff ff       	call   800e10 <sys_page_unmap>
+  80320a:	83 c4 10             	add    $0x10,%esp
+}
+  80320d:	89 d8                	mov    %ebx,%eax
+  80320f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803212:	5b                   	pop    %ebx
+  803213:	5e                   	pop    %esi
+  803214:	5d                   	pop    %ebp
+  803215:	c3                   	ret
+
+00803216 <pipeisclosed>:
+{
+  803216:	55                   	push   %ebp
+  803217:	89 e5                	mov    %esp,%ebp
+  803219:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80321c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80321f:	50                   	push   %eax
+  803220:	ff 75 08             	push   0x8(%ebp)
+  803223:	e8 3d e0 ff ff       	call   801265 <fd_lookup>
+  803228:	83 c4 10             	add    $0x10,%esp
+  80322b:	85 c0                	test   %eax,%eax
+  80322d:	78 18                	js     803247 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80322f:	83 ec 0c             	sub    $0xc,%esp
+  803232:	ff 75 f4             	push   -0xc(%ebp)
+  803235:	e8 c4 df ff ff       	call   8011fe <fd2data>
+  80323a:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80323c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80323f:	e8 e6 f9 ff ff       	call   802c2a <_pipeisclosed>
+  803244:	83 c4 10             	add    $0x10,%esp
+}
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+
+00803249 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803249:	55                   	push   %ebp
+  80324a:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80324c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80324f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803255:	5d                   	pop    %ebp
+  803256:	c3                   	ret
+
+00803257 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803257:	55                   	push   %ebp
+  803258:	89 e5                	mov    %esp,%ebp
+  80325a:	53                   	push   %ebx
+  80325b:	83 ec 04             	sub    $0x4,%esp
+  80325e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803261:	8b 03                	mov    (%ebx),%eax
+  803263:	85 c0                	test   %eax,%eax
+  803265:	75 05                	jne    80326c <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80326a:	c9                   	leave
+  80326b:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80326c:	83 ec 08             	sub    $0x8,%esp
+  80326f:	50                   	push   %eax
+  803270:	8d 43 04             	lea    0x4(%ebx),%eax
+  803273:	50                   	push   %eax
+  803274:	e8 e7 dd ff ff       	call   801060 <sys_page_batch>
+	pb->pb_n = 0;
+  803279:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80327f:	83 c4 10             	add    $0x10,%esp
+  803282:	eb e3                	jmp    803267 <pgbatch_flush+0x10>
+
+00803284 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803284:	55                   	push   %ebp
+  803285:	89 e5                	mov    %esp,%ebp
+  803287:	56                   	push   %esi
+  803288:	53                   	push   %ebx
+  803289:	89 c3                	mov    %eax,%ebx
+  80328b:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80328d:	83 38 20             	cmpl   $0x20,(%eax)
+  803290:	74 2c                	je     8032be <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803292:	8b 03                	mov    (%ebx),%eax
+  803294:	8d 50 01             	lea    0x1(%eax),%edx
+  803297:	89 13                	mov    %edx,(%ebx)
+  803299:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80329c:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8032a0:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8032a2:	83 ec 04             	sub    $0x4,%esp
+  8032a5:	6a 18                	push   $0x18
+  8032a7:	6a 00                	push   $0x0
+  8032a9:	50                   	push   %eax
+  8032aa:	e8 23 d8 ff ff       	call   800ad2 <memset>
+	return 0;
+  8032af:	83 c4 10             	add    $0x10,%esp
+  8032b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032ba:	5b                   	pop    %ebx
+  8032bb:	5e                   	pop    %esi
+  8032bc:	5d                   	pop    %ebp
+  8032bd:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032be:	83 ec 0c             	sub    $0xc,%esp
+  8032c1:	50                   	push   %eax
+  8032c2:	e8 90 ff ff ff       	call   803257 <pgbatch_flush>
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	79 c4                	jns    803292 <pgbatch_slot+0xe>
+  8032ce:	eb e7                	jmp    8032b7 <pgbatch_slot+0x33>
+
+008032d0 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032d0:	55                   	push   %ebp
+  8032d1:	89 e5                	mov    %esp,%ebp
+  8032d3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032dc:	e8 a3 ff ff ff       	call   803284 <pgbatch_slot>
+  8032e1:	85 c0                	test   %eax,%eax
+  8032e3:	78 20                	js     803305 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8032e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8032ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032f1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032f4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032f7:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032fa:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032fd:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803300:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803305:	c9                   	leave
+  803306:	c3                   	ret
+
+00803307 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803307:	55                   	push   %ebp
+  803308:	89 e5                	mov    %esp,%ebp
+  80330a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80330d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803310:	8b 45 08             	mov    0x8(%ebp),%eax
+  803313:	e8 6c ff ff ff       	call   803284 <pgbatch_slot>
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	78 2c                	js     803348 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80331c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80331f:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803325:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803328:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80332b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80332e:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803331:	8b 55 14             	mov    0x14(%ebp),%edx
+  803334:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803337:	8b 55 18             	mov    0x18(%ebp),%edx
+  80333a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80333d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803340:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803343:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+0080334a <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80334a:	55                   	push   %ebp
+  80334b:	89 e5                	mov    %esp,%ebp
+  80334d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803350:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803353:	8b 45 08             	mov    0x8(%ebp),%eax
+  803356:	e8 29 ff ff ff       	call   803284 <pgbatch_slot>
+  80335b:	85 c0                	test   %eax,%eax
+  80335d:	78 1a                	js     803379 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80335f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803362:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803368:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80336b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80336e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803371:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803374:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803379:	c9                   	leave
+  80337a:	c3                   	ret
+
+0080337b <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80337b:	55                   	push   %ebp
+  80337c:	89 e5                	mov    %esp,%ebp
+  80337e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803381:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803384:	8b 45 08             	mov    0x8(%ebp),%eax
+  803387:	e8 f8 fe ff ff       	call   803284 <pgbatch_slot>
+  80338c:	85 c0                	test   %eax,%eax
+  80338e:	78 20                	js     8033b0 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803390:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803393:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803399:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80339c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80339f:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033a2:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033a5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033a8:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033b0:	c9                   	leave
+  8033b1:	c3                   	ret
+
+008033b2 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8033b2:	55                   	push   %ebp
+  8033b3:	89 e5                	mov    %esp,%ebp
+  8033b5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033b8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033be:	e8 c1 fe ff ff       	call   803284 <pgbatch_slot>
+  8033c3:	85 c0                	test   %eax,%eax
+  8033c5:	78 26                	js     8033ed <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8033c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ca:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8033d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033d3:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8033d6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033d9:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8033dc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033df:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8033e2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033e5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ed:	c9                   	leave
+  8033ee:	c3                   	ret
+
+008033ef <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f4:	c3                   	ret
+
+008033f5 <devcons_poll>:
+{
+  8033f5:	55                   	push   %ebp
+  8033f6:	89 e5                	mov    %esp,%ebp
+  8033f8:	53                   	push   %ebx
+  8033f9:	83 ec 04             	sub    $0x4,%esp
+  8033fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033ff:	89 da                	mov    %ebx,%edx
+  803401:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803404:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  80340b:	74 0c                	je     803419 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80340d:	89 d8                	mov    %ebx,%eax
+  80340f:	83 e0 01             	and    $0x1,%eax
+  803412:	09 d0                	or     %edx,%eax
+}
+  803414:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803417:	c9                   	leave
+  803418:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803419:	e8 cf d8 ff ff       	call   800ced <sys_cgetc>
+  80341e:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803423:	89 da                	mov    %ebx,%edx
+  803425:	83 e2 04             	and    $0x4,%edx
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	74 e6                	je     803412 <devcons_poll+0x1d>
+  80342c:	eb df                	jmp    80340d <devcons_poll+0x18>
+
+0080342e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80342e:	55                   	push   %ebp
+  80342f:	89 e5                	mov    %esp,%ebp
+  803431:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803434:	68 7e 40 80 00       	push   $0x80407e
+  803439:	ff 75 0c             	push   0xc(%ebp)
+  80343c:	e8 16 d5 ff ff       	call   800957 <strcpy>
+	return 0;
+}
+  803441:	b8 00 00 00 00       	mov    $0x0,%eax
+  803446:	c9                   	leave
+  803447:	c3                   	ret
+
+00803448 <devcons_write>:
+{
+  803448:	55                   	push   %ebp
+  803449:	89 e5                	mov    %esp,%ebp
+  80344b:	57                   	push   %edi
+  80344c:	56                   	push   %esi
+  80344d:	53                   	push   %ebx
+  80344e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803454:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803457:	85 ff                	test   %edi,%edi
+  803459:	74 51                	je     8034ac <devcons_write+0x64>
+  80345b:	be 00 00 00 00       	mov    $0x0,%esi
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803465:	89 fb                	mov    %edi,%ebx
+  803467:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803469:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80346e:	39 d3                	cmp    %edx,%ebx
+  803470:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803473:	83 ec 04             	sub    $0x4,%esp
+  803476:	53                   	push   %ebx
+  803477:	03 45 0c             	add    0xc(%ebp),%eax
+  80347a:	50                   	push   %eax
+  80347b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803481:	50                   	push   %eax
+  803482:	e8 80 d6 ff ff       	call   800b07 <memmove>
+		sys_cputs(buf, m);
+  803487:	83 c4 08             	add    $0x8,%esp
+  80348a:	53                   	push   %ebx
+  80348b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803491:	50                   	push   %eax
+  803492:	e8 38 d8 ff ff       	call   800ccf <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803497:	01 de                	add    %ebx,%esi
+  803499:	89 f0                	mov    %esi,%eax
+  80349b:	83 c4 10             	add    $0x10,%esp
+  80349e:	39 fe                	cmp    %edi,%esi
+  8034a0:	72 c3                	jb     803465 <devcons_write+0x1d>
+}
+  8034a2:	89 f0                	mov    %esi,%eax
+  8034a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a7:	5b                   	pop    %ebx
+  8034a8:	5e                   	pop    %esi
+  8034a9:	5f                   	pop    %edi
+  8034aa:	5d                   	pop    %ebp
+  8034ab:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8034ac:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8034b1:	eb ef                	jmp    8034a2 <devcons_write+0x5a>
+
+008034b3 <devcons_read>:
+{
+  8034b3:	55                   	push   %ebp
+  8034b4:	89 e5                	mov    %esp,%ebp
+  8034b6:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8034b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8034be:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034c2:	74 36                	je     8034fa <devcons_read+0x47>
+	c = cons_peek;
+  8034c4:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8034c9:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8034d0:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034d3:	85 c0                	test   %eax,%eax
+  8034d5:	75 10                	jne    8034e7 <devcons_read+0x34>
+  8034d7:	e8 11 d8 ff ff       	call   800ced <sys_cgetc>
+  8034dc:	85 c0                	test   %eax,%eax
+  8034de:	75 07                	jne    8034e7 <devcons_read+0x34>
+		sys_yield();
+  8034e0:	e8 87 d8 ff ff       	call   800d6c <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034e5:	eb f0                	jmp    8034d7 <devcons_read+0x24>
+	if (c < 0)
+  8034e7:	85 c0                	test   %eax,%eax
+  8034e9:	78 0f                	js     8034fa <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8034eb:	83 f8 04             	cmp    $0x4,%eax
+  8034ee:	74 0c                	je     8034fc <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8034f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034f3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8034f5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034fa:	c9                   	leave
+  8034fb:	c3                   	ret
+		return 0;
+  8034fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803501:	eb f7                	jmp    8034fa <devcons_read+0x47>
+
+00803503 <cputchar>:
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803509:	8b 45 08             	mov    0x8(%ebp),%eax
+  80350c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80350f:	6a 01                	push   $0x1
+  803511:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803514:	50                   	push   %eax
+  803515:	e8 b5 d7 ff ff       	call   800ccf <sys_cputs>
+}
+  80351a:	83 c4 10             	add    $0x10,%esp
+  80351d:	c9                   	leave
+  80351e:	c3                   	ret
+
+0080351f <getchar>:
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803525:	6a 01                	push   $0x1
+  803527:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80352a:	50                   	push   %eax
+  80352b:	6a 00                	push   $0x0
+  80352d:	e8 b7 df ff ff       	call   8014e9 <read>
+	if (r < 0)
+  803532:	83 c4 10             	add    $0x10,%esp
+  803535:	85 c0                	test   %eax,%eax
+  803537:	78 06                	js     80353f <getchar+0x20>
+	if (r < 1)
+  803539:	74 06                	je     803541 <getchar+0x22>
+	return c;
+  80353b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80353f:	c9                   	leave
+  803540:	c3                   	ret
+		return -E_EOF;
+  803541:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803546:	eb f7                	jmp    80353f <getchar+0x20>
+
+00803548 <iscons>:
+{
+  803548:	55                   	push   %ebp
+  803549:	89 e5                	mov    %esp,%ebp
+  80354b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80354e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803551:	50                   	push   %eax
+  803552:	ff 75 08             	push   0x8(%ebp)
+  803555:	e8 0b dd ff ff       	call   801265 <fd_lookup>
+  80355a:	83 c4 10             	add    $0x10,%esp
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	78 11                	js     803572 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803561:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803564:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80356a:	39 10                	cmp    %edx,(%eax)
+  80356c:	0f 94 c0             	sete   %al
+  80356f:	0f b6 c0             	movzbl %al,%eax
+}
+  803572:	c9                   	leave
+  803573:	c3                   	ret
+
+00803574 <opencons>:
+{
+  803574:	55                   	push   %ebp
+  803575:	89 e5                	mov    %esp,%ebp
+  803577:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80357a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80357d:	50                   	push   %eax
+  80357e:	e8 92 dc ff ff       	call   801215 <fd_alloc>
+  803583:	83 c4 10             	add    $0x10,%esp
+  803586:	85 c0                	test   %eax,%eax
+  803588:	78 3a                	js     8035c4 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80358a:	83 ec 04             	sub    $0x4,%esp
+  80358d:	68 07 04 00 00       	push   $0x407
+  803592:	ff 75 f4             	push   -0xc(%ebp)
+  803595:	6a 00                	push   $0x0
+  803597:	e8 ef d7 ff ff       	call   800d8b <sys_page_alloc>
+  80359c:	83 c4 10             	add    $0x10,%esp
+  80359f:	85 c0                	test   %eax,%eax
+  8035a1:	78 21                	js     8035c4 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035ac:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8035ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035b1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8035b8:	83 ec 0c             	sub    $0xc,%esp
+  8035bb:	50                   	push   %eax
+  8035bc:	e8 2d dc ff ff       	call   8011ee <fd2num>
+  8035c1:	83 c4 10             	add    $0x10,%esp
+}
+  8035c4:	c9                   	leave
+  8035c5:	c3                   	ret
+
+008035c6 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	56                   	push   %esi
+  8035ca:	53                   	push   %ebx
+  8035cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035d4:	85 c0                	test   %eax,%eax
+  8035d6:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035db:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035de:	83 ec 0c             	sub    $0xc,%esp
+  8035e1:	50                   	push   %eax
+  8035e2:	e8 54 d9 ff ff       	call   800f3b <sys_ipc_recv>
+  8035e7:	83 c4 10             	add    $0x10,%esp
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	0f 88 8b 00 00 00    	js     80367d <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8035f2:	85 f6                	test   %esi,%esi
+  8035f4:	74 2a                	je     803620 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8035f6:	89 e2                	mov    %esp,%edx
+  8035f8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8035fd:	29 d0                	sub    %edx,%eax
+  8035ff:	89 c2                	mov    %eax,%edx
+  803601:	c1 ea 0f             	shr    $0xf,%edx
+  803604:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803611:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  803618:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80361e:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803620:	85 db                	test   %ebx,%ebx
+  803622:	74 2a                	je     80364e <ipc_recv+0x88>
+  803624:	89 e2                	mov    %esp,%edx
+  803626:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80362b:	29 d0                	sub    %edx,%eax
+  80362d:	89 c2                	mov    %eax,%edx
+  80362f:	c1 ea 0f             	shr    $0xf,%edx
+  803632:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363c:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80363f:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  803646:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80364c:	89 03                	mov    %eax,(%ebx)
+  80364e:	89 e2                	mov    %esp,%edx
+  803650:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803655:	29 d0                	sub    %edx,%eax
+  803657:	89 c2                	mov    %eax,%edx
+  803659:	c1 ea 0f             	shr    $0xf,%edx
+  80365c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803661:	b8 00 00 00 00       	mov    $0x0,%eax
+  803666:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803669:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  803670:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803676:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803679:	5b                   	pop    %ebx
+  80367a:	5e                   	pop    %esi
+  80367b:	5d                   	pop    %ebp
+  80367c:	c3                   	ret
+		if(from_env_store != NULL)
+  80367d:	85 f6                	test   %esi,%esi
+  80367f:	74 06                	je     803687 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803681:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803687:	85 db                	test   %ebx,%ebx
+  803689:	74 eb                	je     803676 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80368b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803691:	eb e3                	jmp    803676 <ipc_recv+0xb0>
+
+00803693 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  803693:	55                   	push   %ebp
+  803694:	89 e5                	mov    %esp,%ebp
+  803696:	57                   	push   %edi
+  803697:	56                   	push   %esi
+  803698:	53                   	push   %ebx
+  803699:	83 ec 14             	sub    $0x14,%esp
+  80369c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80369f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036a2:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036a5:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036a8:	85 c0                	test   %eax,%eax
+  8036aa:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036af:	0f 44 c2             	cmove  %edx,%eax
+  8036b2:	ff 75 10             	push   0x10(%ebp)
+  8036b5:	50                   	push   %eax
+  8036b6:	e8 e2 d8 ff ff       	call   800f9d <sys_ipc_recv_pages>
+  8036bb:	83 c4 10             	add    $0x10,%esp
+  8036be:	85 c0                	test   %eax,%eax
+  8036c0:	0f 88 ba 00 00 00    	js     803780 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036c6:	85 ff                	test   %edi,%edi
+  8036c8:	74 2a                	je     8036f4 <ipc_recv_pages+0x61>
+  8036ca:	89 e2                	mov    %esp,%edx
+  8036cc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036d1:	29 d0                	sub    %edx,%eax
+  8036d3:	89 c2                	mov    %eax,%edx
+  8036d5:	c1 ea 0f             	shr    $0xf,%edx
+  8036d8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e2:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8036e5:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  8036ec:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8036f2:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8036f4:	85 f6                	test   %esi,%esi
+  8036f6:	74 2a                	je     803722 <ipc_recv_pages+0x8f>
+  8036f8:	89 e2                	mov    %esp,%edx
+  8036fa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036ff:	29 d0                	sub    %edx,%eax
+  803701:	89 c2                	mov    %eax,%edx
+  803703:	c1 ea 0f             	shr    $0xf,%edx
+  803706:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80370b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803710:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803713:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  80371a:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803720:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803722:	85 db                	test   %ebx,%ebx
+  803724:	74 2a                	je     803750 <ipc_recv_pages+0xbd>
+  803726:	89 e2                	mov    %esp,%edx
+  803728:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80372d:	29 d0                	sub    %edx,%eax
+  80372f:	89 c2                	mov    %eax,%edx
+  803731:	c1 ea 0f             	shr    $0xf,%edx
+  803734:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373e:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803741:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  803748:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80374e:	89 03                	mov    %eax,(%ebx)
+  803750:	89 e2                	mov    %esp,%edx
+  803752:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803757:	29 d0                	sub    %edx,%eax
+  803759:	89 c2                	mov    %eax,%edx
+  80375b:	c1 ea 0f             	shr    $0xf,%edx
+  80375e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803763:	b8 00 00 00 00       	mov    $0x0,%eax
+  803768:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80376b:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  803772:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803778:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80377b:	5b                   	pop    %ebx
+  80377c:	5e                   	pop    %esi
+  80377d:	5f                   	pop    %edi
+  80377e:	5d                   	pop    %ebp
+  80377f:	c3                   	ret
+		if (from_env_store)
+  803780:	85 ff                	test   %edi,%edi
+  803782:	74 06                	je     80378a <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803784:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  80378a:	85 f6                	test   %esi,%esi
+  80378c:	74 06                	je     803794 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80378e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  803794:	85 db                	test   %ebx,%ebx
+  803796:	74 e0                	je     803778 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  803798:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80379e:	eb d8                	jmp    803778 <ipc_recv_pages+0xe5>
+
+008037a0 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037a0:	55                   	push   %ebp
+  8037a1:	89 e5                	mov    %esp,%ebp
+  8037a3:	57                   	push   %edi
+  8037a4:	56                   	push   %esi
+  8037a5:	53                   	push   %ebx
+  8037a6:	83 ec 1c             	sub    $0x1c,%esp
+  8037a9:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037af:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037b5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037b9:	75 2b                	jne    8037e6 <ipc_try_send_pages+0x46>
+  8037bb:	89 e2                	mov    %esp,%edx
+  8037bd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037c2:	29 d0                	sub    %edx,%eax
+  8037c4:	89 c2                	mov    %eax,%edx
+  8037c6:	c1 ea 0f             	shr    $0xf,%edx
+  8037c9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d3:	0f 42 c2             	cmovb  %edx,%eax
+  8037d6:	8b 04 85 40 63 c0 00 	mov    0xc06340(,%eax,4),%eax
+  8037dd:	8b 70 48             	mov    0x48(%eax),%esi
+  8037e0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037e6:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8037ec:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8037f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037f4:	85 ff                	test   %edi,%edi
+  8037f6:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8037fb:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8037fe:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803804:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80380a:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803810:	83 ec 0c             	sub    $0xc,%esp
+  803813:	ff 75 14             	push   0x14(%ebp)
+  803816:	ff 75 18             	push   0x18(%ebp)
+  803819:	57                   	push   %edi
+  80381a:	ff 75 0c             	push   0xc(%ebp)
+  80381d:	ff 75 08             	push   0x8(%ebp)
+  803820:	e8 57 d7 ff ff       	call   800f7c <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803825:	83 c4 20             	add    $0x20,%esp
+  803828:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80382b:	75 21                	jne    80384e <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80382d:	83 ec 04             	sub    $0x4,%esp
+  803830:	6a ff                	push   $0xffffffff
+  803832:	53                   	push   %ebx
+  803833:	ff 75 e4             	push   -0x1c(%ebp)
+  803836:	e8 4e d9 ff ff       	call   801189 <sys_futex_wait>
+  80383b:	83 c4 10             	add    $0x10,%esp
+  80383e:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803841:	74 c7                	je     80380a <ipc_try_send_pages+0x6a>
+  803843:	85 c0                	test   %eax,%eax
+  803845:	79 c3                	jns    80380a <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803847:	e8 20 d5 ff ff       	call   800d6c <sys_yield>
+  80384c:	eb bc                	jmp    80380a <ipc_try_send_pages+0x6a>
+	}
+}
+  80384e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803851:	5b                   	pop    %ebx
+  803852:	5e                   	pop    %esi
+  803853:	5f                   	pop    %edi
+  803854:	5d                   	pop    %ebp
+  803855:	c3                   	ret
+
+00803856 <ipc_send>:
+{
+  803856:	55                   	push   %ebp
+  803857:	89 e5                	mov    %esp,%ebp
+  803859:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80385c:	ff 75 14             	push   0x14(%ebp)
+  80385f:	6a 01                	push   $0x1
+  803861:	ff 75 10             	push   0x10(%ebp)
+  803864:	ff 75 0c             	push   0xc(%ebp)
+  803867:	ff 75 08             	push   0x8(%ebp)
+  80386a:	e8 31 ff ff ff       	call   8037a0 <ipc_try_send_pages>
+  80386f:	83 c4 20             	add    $0x20,%esp
+  803872:	85 c0                	test   %eax,%eax
+  803874:	78 02                	js     803878 <ipc_send+0x22>
+}
+  803876:	c9                   	leave
+  803877:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803878:	50                   	push   %eax
+  803879:	68 8a 40 80 00       	push   $0x80408a
+  80387e:	6a 3f                	push   $0x3f
+  803880:	68 9f 40 80 00       	push   $0x80409f
+  803885:	e8 fb c8 ff ff       	call   800185 <_panic>
+
+0080388a <ipc_send_pages>:
+{
+  80388a:	55                   	push   %ebp
+  80388b:	89 e5                	mov    %esp,%ebp
+  80388d:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803890:	ff 75 18             	push   0x18(%ebp)
+  803893:	ff 75 14             	push   0x14(%ebp)
+  803896:	ff 75 10             	push   0x10(%ebp)
+  803899:	ff 75 0c             	push   0xc(%ebp)
+  80389c:	ff 75 08             	push   0x8(%ebp)
+  80389f:	e8 fc fe ff ff       	call   8037a0 <ipc_try_send_pages>
+  8038a4:	83 c4 20             	add    $0x20,%esp
+  8038a7:	85 c0                	test   %eax,%eax
+  8038a9:	78 02                	js     8038ad <ipc_send_pages+0x23>
+}
+  8038ab:	c9                   	leave
+  8038ac:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038ad:	50                   	push   %eax
+  8038ae:	68 a9 40 80 00       	push   $0x8040a9
+  8038b3:	6a 64                	push   $0x64
+  8038b5:	68 9f 40 80 00       	push   $0x80409f
+  8038ba:	e8 c6 c8 ff ff       	call   800185 <_panic>
+
+008038bf <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038bf:	55                   	push   %ebp
+  8038c0:	89 e5                	mov    %esp,%ebp
+  8038c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038c5:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038ca:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038d0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038d6:	8b 52 50             	mov    0x50(%edx),%edx
+  8038d9:	39 ca                	cmp    %ecx,%edx
+  8038db:	74 11                	je     8038ee <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038dd:	83 c0 01             	add    $0x1,%eax
+  8038e0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038e5:	75 e3                	jne    8038ca <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ec:	eb 0e                	jmp    8038fc <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8038ee:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8038f4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8038f9:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8038fc:	5d                   	pop    %ebp
+  8038fd:	c3                   	ret
+
+008038fe <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8038fe:	55                   	push   %ebp
+  8038ff:	89 e5                	mov    %esp,%ebp
+  803901:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803904:	89 c2                	mov    %eax,%edx
+  803906:	c1 ea 16             	shr    $0x16,%edx
+  803909:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803910:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803915:	f6 c1 01             	test   $0x1,%cl
+  803918:	74 1e                	je     803938 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80391a:	c1 e8 0c             	shr    $0xc,%eax
+  80391d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803924:	a8 01                	test   $0x1,%al
+  803926:	74 10                	je     803938 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803928:	c1 e8 0c             	shr    $0xc,%eax
+  80392b:	c1 e0 04             	shl    $0x4,%eax
+  80392e:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803935:	0f b7 d2             	movzwl %dx,%edx
+}
+  803938:	89 d0                	mov    %edx,%eax
+  80393a:	5d                   	pop    %ebp
+  80393b:	c3                   	ret
+
+0080393c <__udivdi3>:
+  80393c:	57                   	push   %edi
+  80393d:	56                   	push   %esi
+  80393e:	53                   	push   %ebx
+  80393f:	83 ec 20             	sub    $0x20,%esp
+  803942:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803946:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80394a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80394e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803952:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803956:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80395a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80395e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803962:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803967:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803971:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803978:	00 
+  803979:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803980:	00 
+  803981:	eb 08                	jmp    80398b <__udivdi3+0x4f>
+  803983:	83 e9 01             	sub    $0x1,%ecx
+  803986:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803989:	74 68                	je     8039f3 <__udivdi3+0xb7>
+  80398b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80398f:	01 c0                	add    %eax,%eax
+  803991:	89 c6                	mov    %eax,%esi
+  803993:	89 d7                	mov    %edx,%edi
+  803995:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803999:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80399d:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039a0:	d3 ea                	shr    %cl,%edx
+  8039a2:	f6 c1 20             	test   $0x20,%cl
+  8039a5:	74 04                	je     8039ab <__udivdi3+0x6f>
+  8039a7:	89 d0                	mov    %edx,%eax
+  8039a9:	31 d2                	xor    %edx,%edx
+  8039ab:	83 e0 01             	and    $0x1,%eax
+  8039ae:	89 04 24             	mov    %eax,(%esp)
+  8039b1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039b8:	00 
+  8039b9:	8b 04 24             	mov    (%esp),%eax
+  8039bc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039c0:	09 f0                	or     %esi,%eax
+  8039c2:	09 fa                	or     %edi,%edx
+  8039c4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039c8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039cc:	39 f0                	cmp    %esi,%eax
+  8039ce:	89 d3                	mov    %edx,%ebx
+  8039d0:	19 fb                	sbb    %edi,%ebx
+  8039d2:	72 af                	jb     803983 <__udivdi3+0x47>
+  8039d4:	29 f0                	sub    %esi,%eax
+  8039d6:	19 fa                	sbb    %edi,%edx
+  8039d8:	89 cf                	mov    %ecx,%edi
+  8039da:	c1 ef 05             	shr    $0x5,%edi
+  8039dd:	83 e7 01             	and    $0x1,%edi
+  8039e0:	89 fe                	mov    %edi,%esi
+  8039e2:	83 f6 01             	xor    $0x1,%esi
+  8039e5:	d3 e6                	shl    %cl,%esi
+  8039e7:	d3 e7                	shl    %cl,%edi
+  8039e9:	09 74 24 18          	or     %esi,0x18(%esp)
+  8039ed:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8039f1:	eb 90                	jmp    803983 <__udivdi3+0x47>
+  8039f3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039f7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039fb:	83 c4 20             	add    $0x20,%esp
+  8039fe:	5b                   	pop    %ebx
+  8039ff:	5e                   	pop    %esi
+  803a00:	5f                   	pop    %edi
+  803a01:	c3                   	ret
+
+00803a02 <__umoddi3>:
+  803a02:	57                   	push   %edi
+  803a03:	56                   	push   %esi
+  803a04:	53                   	push   %ebx
+  803a05:	83 ec 08             	sub    $0x8,%esp
+  803a08:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a0c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a10:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a14:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a18:	57                   	push   %edi
+  803a19:	56                   	push   %esi
+  803a1a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a1e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a22:	52                   	push   %edx
+  803a23:	50                   	push   %eax
+  803a24:	e8 13 ff ff ff       	call   80393c <__udivdi3>
+  803a29:	89 c3                	mov    %eax,%ebx
+  803a2b:	0f af d6             	imul   %esi,%edx
+  803a2e:	89 f9                	mov    %edi,%ecx
+  803a30:	0f af cb             	imul   %ebx,%ecx
+  803a33:	01 d1                	add    %edx,%ecx
+  803a35:	89 d8                	mov    %ebx,%eax
+  803a37:	f7 e6                	mul    %esi
+  803a39:	89 c6                	mov    %eax,%esi
+  803a3b:	89 d7                	mov    %edx,%edi
+  803a3d:	01 cf                	add    %ecx,%edi
+  803a3f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a43:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a47:	29 f0                	sub    %esi,%eax
+  803a49:	19 fa                	sbb    %edi,%edx
+  803a4b:	83 c4 18             	add    $0x18,%esp
+  803a4e:	5b                   	pop    %ebx
+  803a4f:	5e                   	pop    %esi
+  803a50:	5f                   	pop    %edi
+  803a51:	c3                   	ret
+
+00803a52 <__divdi3>:
+  803a52:	53                   	push   %ebx
+  803a53:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a57:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a5b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a5f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a63:	85 d2                	test   %edx,%edx
+  803a65:	78 12                	js     803a79 <__divdi3+0x27>
+  803a67:	85 db                	test   %ebx,%ebx
+  803a69:	78 2e                	js     803a99 <__divdi3+0x47>
+  803a6b:	53                   	push   %ebx
+  803a6c:	51                   	push   %ecx
+  803a6d:	52                   	push   %edx
+  803a6e:	50                   	push   %eax
+  803a6f:	e8 c8 fe ff ff       	call   80393c <__udivdi3>
+  803a74:	83 c4 10             	add    $0x10,%esp
+  803a77:	eb 1e                	jmp    803a97 <__divdi3+0x45>
+  803a79:	f7 d8                	neg    %eax
+  803a7b:	83 d2 00             	adc    $0x0,%edx
+  803a7e:	f7 da                	neg    %edx
+  803a80:	85 db                	test   %ebx,%ebx
+  803a82:	78 2a                	js     803aae <__divdi3+0x5c>
+  803a84:	53                   	push   %ebx
+  803a85:	51                   	push   %ecx
+  803a86:	52                   	push   %edx
+  803a87:	50                   	push   %eax
+  803a88:	e8 af fe ff ff       	call   80393c <__udivdi3>
+  803a8d:	83 c4 10             	add    $0x10,%esp
+  803a90:	f7 d8                	neg    %eax
+  803a92:	83 d2 00             	adc    $0x0,%edx
+  803a95:	f7 da                	neg    %edx
+  803a97:	5b                   	pop    %ebx
+  803a98:	c3                   	ret
+  803a99:	f7 d9                	neg    %ecx
+  803a9b:	83 d3 00             	adc    $0x0,%ebx
+  803a9e:	f7 db                	neg    %ebx
+  803aa0:	53                   	push   %ebx
+  803aa1:	51                   	push   %ecx
+  803aa2:	52                   	push   %edx
+  803aa3:	50                   	push   %eax
+  803aa4:	e8 93 fe ff ff       	call   80393c <__udivdi3>
+  803aa9:	83 c4 10             	add    $0x10,%esp
+  803aac:	eb e2                	jmp    803a90 <__divdi3+0x3e>
+  803aae:	f7 d9                	neg    %ecx
+  803ab0:	83 d3 00             	adc    $0x0,%ebx
+  803ab3:	f7 db                	neg    %ebx
+  803ab5:	53                   	push   %ebx
+  803ab6:	51                   	push   %ecx
+  803ab7:	52                   	push   %edx
+  803ab8:	50                   	push   %eax
+  803ab9:	e8 7e fe ff ff       	call   80393c <__udivdi3>
+  803abe:	83 c4 10             	add    $0x10,%esp
+  803ac1:	eb d4                	jmp    803a97 <__divdi3+0x45>
+
+00803ac3 <__moddi3>:
+  803ac3:	57                   	push   %edi
+  803ac4:	56                   	push   %esi
+  803ac5:	53                   	push   %ebx
+  803ac6:	83 ec 08             	sub    $0x8,%esp
+  803ac9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803acd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ad1:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ad5:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ad9:	57                   	push   %edi
+  803ada:	56                   	push   %esi
+  803adb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803adf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ae3:	52                   	push   %edx
+  803ae4:	50                   	push   %eax
+  803ae5:	e8 68 ff ff ff       	call   803a52 <__divdi3>
+  803aea:	89 c3                	mov    %eax,%ebx
+  803aec:	0f af d6             	imul   %esi,%edx
+  803aef:	89 f9                	mov    %edi,%ecx
+  803af1:	0f af cb             	imul   %ebx,%ecx
+  803af4:	01 d1                	add    %edx,%ecx
+  803af6:	89 d8                	mov    %ebx,%eax
+  803af8:	f7 e6                	mul    %esi
+  803afa:	89 c6                	mov    %eax,%esi
+  803afc:	89 d7                	mov    %edx,%edi
+  803afe:	01 cf                	add    %ecx,%edi
+  803b00:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b04:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b08:	29 f0                	sub    %esi,%eax
+  803b0a:	19 fa                	sbb    %edi,%edx
+  803b0c:	83 c4 18             	add    $0x18,%esp
+  803b0f:	5b                   	pop    %ebx
+  803b10:	5e                   	pop    %esi
+  803b11:	5f                   	pop    %edi
+  803b12:	c3                   	ret
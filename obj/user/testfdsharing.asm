@@ -0,0 +1,9320 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 42 03 00 00       	call   800373 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 14             	sub    $0x14,%esp
+	int fd, r, n, n2;
+
+	if ((fd = open("motd", O_RDONLY)) < 0)
+  80003e:	6a 00                	push   $0x0
+  800040:	68 e3 47 80 00       	push   $0x8047e3
+  800045:	e8 a9 23 00 00       	call   8023f3 <open>
+  80004a:	89 c3                	mov    %eax,%ebx
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	0f 88 04 02 00 00    	js     80025b <umain+0x226>
+		panic("open motd: %e", fd);
+	seek(fd, 0);
+  800057:	83 ec 08             	sub    $0x8,%esp
+  80005a:	6a 00                	push   $0x0
+  80005c:	50                   	push   %eax
+  80005d:	e8 2f 20 00 00       	call   802091 <seek>
+	if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800062:	83 c4 0c             	add    $0xc,%esp
+  800065:	68 00 02 00 00       	push   $0x200
+  80006a:	68 00 6c 80 00       	push   $0x806c00
+  80006f:	53                   	push   %ebx
+  800070:	e8 29 1f 00 00       	call   801f9e <readn>
+  800075:	89 c6                	mov    %eax,%esi
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	0f 8e eb 01 00 00    	jle    80026d <umain+0x238>
+		panic("readn: %e", n);
+
+	if ((r = fork()) < 0)
+  800082:	e8 a1 15 00 00       	call   801628 <fork>
+  800087:	89 c7                	mov    %eax,%edi
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	0f 88 ee 01 00 00    	js     80027f <umain+0x24a>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800091:	75 7b                	jne    80010e <umain+0xd9>
+		seek(fd, 0);
+  800093:	83 ec 08             	sub    $0x8,%esp
+  800096:	6a 00                	push   $0x0
+  800098:	53                   	push   %ebx
+  800099:	e8 f3 1f 00 00       	call   802091 <seek>
+		cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009e:	c7 04 24 8c 48 80 00 	movl   $0x80488c,(%esp)
+  8000a5:	e8 4b 04 00 00       	call   8004f5 <cprintf>
+		if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 02 00 00       	push   $0x200
+  8000b2:	68 00 6a 80 00       	push   $0x806a00
+  8000b7:	53                   	push   %ebx
+  8000b8:	e8 e1 1e 00 00       	call   801f9e <readn>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	39 c6                	cmp    %eax,%esi
+  8000c2:	0f 85 c9 01 00 00    	jne    800291 <umain+0x25c>
+			panic("read in parent got %d, read in child got %d", n, n2);
+		if (memcmp(buf, buf2, n) != 0)
+  8000c8:	83 ec 04             	sub    $0x4,%esp
+  8000cb:	56                   	push   %esi
+  8000cc:	68 00 6a 80 00       	push   $0x806a00
+  8000d1:	68 00 6c 80 00       	push   $0x806c00
+  8000d6:	e8 39 0d 00 00       	call   800e14 <memcmp>
+  8000db:	83 c4 10             	add    $0x10,%esp
+  8000de:	85 c0                	test   %eax,%eax
+  8000e0:	0f 85 c1 01 00 00    	jne    8002a7 <umain+0x272>
+			panic("read in parent got different bytes from read in child");
+		cprintf("read in child succeeded\n");
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	68 ad 47 80 00       	push   $0x8047ad
+  8000ee:	e8 02 04 00 00       	call   8004f5 <cprintf>
+		seek(fd, 0);
+  8000f3:	83 c4 08             	add    $0x8,%esp
+  8000f6:	6a 00                	push   $0x0
+  8000f8:	53                   	push   %ebx
+  8000f9:	e8 93 1f 00 00       	call   802091 <seek>
+		close(fd);
+  8000fe:	89 1c 24             	mov    %ebx,(%esp)
+  800101:	e8 b5 1c 00 00       	call   801dbb <close>
+		exit();
+  800106:	e8 f5 02 00 00       	call   800400 <exit>
+  80010b:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  80010e:	83 ec 0c             	sub    $0xc,%esp
+  800111:	57                   	push   %edi
+  800112:	e8 43 3b 00 00       	call   803c5a <wait>
+	if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800117:	83 c4 0c             	add    $0xc,%esp
+  80011a:	68 00 02 00 00       	push   $0x200
+  80011f:	68 00 6a 80 00       	push   $0x806a00
+  800124:	53                   	push   %ebx
+  800125:	e8 74 1e 00 00       	call   801f9e <readn>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	39 c6                	cmp    %eax,%esi
+  80012f:	0f 85 86 01 00 00    	jne    8002bb <umain+0x286>
+		panic("read in parent got %d, then got %d", n, n2);
+	cprintf("read in parent succeeded\n");
+  800135:	83 ec 0c             	sub    $0xc,%esp
+  800138:	68 c6 47 80 00       	push   $0x8047c6
+  80013d:	e8 b3 03 00 00       	call   8004f5 <cprintf>
+	close(fd);
+  800142:	89 1c 24             	mov    %ebx,(%esp)
+  800145:	e8 71 1c 00 00       	call   801dbb <close>
+
+	if ((fd = open("newmotd", O_RDWR)) < 0)
+  80014a:	83 c4 08             	add    $0x8,%esp
+  80014d:	6a 02                	push   $0x2
+  80014f:	68 e0 47 80 00       	push   $0x8047e0
+  800154:	e8 9a 22 00 00       	call   8023f3 <open>
+  800159:	89 c3                	mov    %eax,%ebx
+  80015b:	83 c4 10             	add    $0x10,%esp
+  80015e:	85 c0                	test   %eax,%eax
+  800160:	0f 88 6b 01 00 00    	js     8002d1 <umain+0x29c>
+		panic("open newmotd: %e", fd);
+	seek(fd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	50                   	push   %eax
+  80016c:	e8 20 1f 00 00       	call   802091 <seek>
+	if ((n = write(fd, "hello", 5)) != 5)
+  800171:	83 c4 0c             	add    $0xc,%esp
+  800174:	6a 05                	push   $0x5
+  800176:	68 f9 47 80 00       	push   $0x8047f9
+  80017b:	53                   	push   %ebx
+  80017c:	e8 71 1e 00 00       	call   801ff2 <write>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	83 f8 05             	cmp    $0x5,%eax
+  800187:	0f 85 56 01 00 00    	jne    8002e3 <umain+0x2ae>
+		panic("write: %e", n);
+
+	if ((r = fork()) < 0)
+  80018d:	e8 96 14 00 00       	call   801628 <fork>
+  800192:	89 c6                	mov    %eax,%esi
+  800194:	85 c0                	test   %eax,%eax
+  800196:	0f 88 59 01 00 00    	js     8002f5 <umain+0x2c0>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80019c:	75 50                	jne    8001ee <umain+0x1b9>
+		seek(fd, 0);
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  8001a1:	6a 00                	push   $0x0
+  8001a3:	53                   	push   %ebx
+  8001a4:	e8 e8 1e 00 00       	call   802091 <seek>
+		cprintf("going to write in child\n");
+  8001a9:	c7 04 24 09 48 80 00 	movl   $0x804809,(%esp)
+  8001b0:	e8 40 03 00 00       	call   8004f5 <cprintf>
+		if ((n = write(fd, "world", 5)) != 5)
+  8001b5:	83 c4 0c             	add    $0xc,%esp
+  8001b8:	6a 05                	push   $0x5
+  8001ba:	68 22 48 80 00       	push   $0x804822
+  8001bf:	53                   	push   %ebx
+  8001c0:	e8 2d 1e 00 00       	call   801ff2 <write>
+  8001c5:	83 c4 10             	add    $0x10,%esp
+  8001c8:	83 f8 05             	cmp    $0x5,%eax
+  8001cb:	0f 85 36 01 00 00    	jne    800307 <umain+0x2d2>
+			panic("write in child: %e", n);
+		cprintf("write in child finished\n");
+  8001d1:	83 ec 0c             	sub    $0xc,%esp
+  8001d4:	68 3b 48 80 00       	push   $0x80483b
+  8001d9:	e8 17 03 00 00       	call   8004f5 <cprintf>
+		close(fd);
+  8001de:	89 1c 24             	mov    %ebx,(%esp)
+  8001e1:	e8 d5 1b 00 00       	call   801dbb <close>
+		exit();
+  8001e6:	e8 15 02 00 00       	call   800400 <exit>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+	}
+	wait(r);
+  8001ee:	83 ec 0c             	sub    $0xc,%esp
+  8001f1:	56                   	push   %esi
+  8001f2:	e8 63 3a 00 00       	call   803c5a <wait>
+	seek(fd, 0);
+  8001f7:	83 c4 08             	add    $0x8,%esp
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	53                   	push   %ebx
+  8001fd:	e8 8f 1e 00 00       	call   802091 <seek>
+	if ((n = readn(fd, buf, 5)) != 5)
+  800202:	83 c4 0c             	add    $0xc,%esp
+  800205:	6a 05                	push   $0x5
+  800207:	68 00 6c 80 00       	push   $0x806c00
+  80020c:	53                   	push   %ebx
+  80020d:	e8 8c 1d 00 00       	call   801f9e <readn>
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	83 f8 05             	cmp    $0x5,%eax
+  800218:	0f 85 fb 00 00 00    	jne    800319 <umain+0x2e4>
+		panic("readn: %e", n);
+	buf[5] = 0;
+  80021e:	c6 05 05 6c 80 00 00 	movb   $0x0,0x806c05
+	if (strcmp(buf, "hello") == 0)
+  800225:	83 ec 08             	sub    $0x8,%esp
+  800228:	68 f9 47 80 00       	push   $0x8047f9
+  80022d:	68 00 6c 80 00       	push   $0x806c00
+  800232:	e8 65 0a 00 00       	call   800c9c <strcmp>
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	0f 85 e9 00 00 00    	jne    80032b <umain+0x2f6>
+		cprintf("write to file failed; got old data\n");
+  800242:	83 ec 0c             	sub    $0xc,%esp
+  800245:	68 58 49 80 00       	push   $0x804958
+  80024a:	e8 a6 02 00 00       	call   8004f5 <cprintf>
+  80024f:	83 c4 10             	add    $0x10,%esp
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800252:	cc                   	int3
+		cprintf("write to file succeeded\n");
+	else
+		cprintf("write to file failed; got %s\n", buf);
+
+	breakpoint();
+}
+  800253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800256:	5b                   	pop    %ebx
+  800257:	5e                   	pop    %esi
+  800258:	5f                   	pop    %edi
+  800259:	5d                   	pop    %ebp
+  80025a:	c3                   	ret
+		panic("open motd: %e", fd);
+  80025b:	50                   	push   %eax
+  80025c:	68 80 47 80 00       	push   $0x804780
+  800261:	6a 0c                	push   $0xc
+  800263:	68 8e 47 80 00       	push   $0x80478e
+  800268:	e8 ad 01 00 00       	call   80041a <_panic>
+		panic("readn: %e", n);
+  80026d:	50                   	push   %eax
+  80026e:	68 a3 47 80 00       	push   $0x8047a3
+  800273:	6a 0f                	push   $0xf
+  800275:	68 8e 47 80 00       	push   $0x80478e
+  80027a:	e8 9b 01 00 00       	call   80041a <_panic>
+		panic("fork: %e", r);
+  80027f:	50                   	push   %eax
+  800280:	68 7d 4d 80 00       	push   $0x804d7d
+  800285:	6a 12                	push   $0x12
+  800287:	68 8e 47 80 00       	push   $0x80478e
+  80028c:	e8 89 01 00 00       	call   80041a <_panic>
+			panic("read in parent got %d, read in child got %d", n, n2);
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	50                   	push   %eax
+  800295:	56                   	push   %esi
+  800296:	68 d0 48 80 00       	push   $0x8048d0
+  80029b:	6a 17                	push   $0x17
+  80029d:	68 8e 47 80 00       	push   $0x80478e
+  8002a2:	e8 73 01 00 00       	call   80041a <_panic>
+			panic("read in parent got different bytes from read in child");
+  8002a7:	83 ec 04             	sub    $0x4,%esp
+  8002aa:	68 fc 48 80 00       	push   $0x8048fc
+  8002af:	6a 19                	push   $0x19
+  8002b1:	68 8e 47 80 00       	push   $0x80478e
+  8002b6:	e8 5f 01 00 00       	call   80041a <_panic>
+		panic("read in parent got %d, then got %d", n, n2);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	50                   	push   %eax
+  8002bf:	56                   	push   %esi
+  8002c0:	68 34 49 80 00       	push   $0x804934
+  8002c5:	6a 21                	push   $0x21
+  8002c7:	68 8e 47 80 00       	push   $0x80478e
+  8002cc:	e8 49 01 00 00       	call   80041a <_panic>
+		panic("open newmotd: %e", fd);
+  8002d1:	50                   	push   %eax
+  8002d2:	68 e8 47 80 00       	push   $0x8047e8
+  8002d7:	6a 26                	push   $0x26
+  8002d9:	68 8e 47 80 00       	push   $0x80478e
+  8002de:	e8 37 01 00 00       	call   80041a <_panic>
+		panic("write: %e", n);
+  8002e3:	50                   	push   %eax
+  8002e4:	68 ff 47 80 00       	push   $0x8047ff
+  8002e9:	6a 29                	push   $0x29
+  8002eb:	68 8e 47 80 00       	push   $0x80478e
+  8002f0:	e8 25 01 00 00       	call   80041a <_panic>
+		panic("fork: %e", r);
+  8002f5:	50                   	push   %eax
+  8002f6:	68 7d 4d 80 00       	push   $0x804d7d
+  8002fb:	6a 2c                	push   $0x2c
+  8002fd:	68 8e 47 80 00       	push   $0x80478e
+  800302:	e8 13 01 00 00       	call   80041a <_panic>
+			panic("write in child: %e", n);
+  800307:	50                   	push   %eax
+  800308:	68 28 48 80 00       	push   $0x804828
+  80030d:	6a 31                	push   $0x31
+  80030f:	68 8e 47 80 00       	push   $0x80478e
+  800314:	e8 01 01 00 00       	call   80041a <_panic>
+		panic("readn: %e", n);
+  800319:	50                   	push   %eax
+  80031a:	68 a3 47 80 00       	push   $0x8047a3
+  80031f:	6a 39                	push   $0x39
+  800321:	68 8e 47 80 00       	push   $0x80478e
+  800326:	e8 ef 00 00 00       	call   80041a <_panic>
+	else if (strcmp(buf, "world") == 0)
+  80032b:	83 ec 08             	sub    $0x8,%esp
+  80032e:	68 22 48 80 00       	push   $0x804822
+  800333:	68 00 6c 80 00       	push   $0x806c00
+  800338:	e8 5f 09 00 00       	call   800c9c <strcmp>
+  80033d:	83 c4 10             	add    $0x10,%esp
+  800340:	85 c0                	test   %eax,%eax
+  800342:	75 15                	jne    800359 <umain+0x324>
+		cprintf("write to file succeeded\n");
+  800344:	83 ec 0c             	sub    $0xc,%esp
+  800347:	68 54 48 80 00       	push   $0x804854
+  80034c:	e8 a4 01 00 00       	call   8004f5 <cprintf>
+  800351:	83 c4 10             	add    $0x10,%esp
+  800354:	e9 f9 fe ff ff       	jmp    800252 <umain+0x21d>
+		cprintf("write to file failed; got %s\n", buf);
+  800359:	83 ec 08             	sub    $0x8,%esp
+  80035c:	68 00 6c 80 00       	push   $0x806c00
+  800361:	68 6d 48 80 00       	push   $0x80486d
+  800366:	e8 8a 01 00 00       	call   8004f5 <cprintf>
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	e9 df fe ff ff       	jmp    800252 <umain+0x21d>
+
+00800373 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	56                   	push   %esi
+  800377:	53                   	push   %ebx
+  800378:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80037b:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80037e:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800380:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800385:	29 d0                	sub    %edx,%eax
+  800387:	89 c2                	mov    %eax,%edx
+  800389:	c1 ea 0f             	shr    $0xf,%edx
+  80038c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800391:	b8 00 00 00 00       	mov    $0x0,%eax
+  800396:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800399:	c7 04 85 00 6e 80 00 	movl   $0x0,0x806e00(,%eax,4)
+  8003a0:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8003a4:	e8 39 0c 00 00       	call   800fe2 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8003a9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003ae:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8003b4:	89 e1                	mov    %esp,%ecx
+  8003b6:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8003bb:	29 ca                	sub    %ecx,%edx
+  8003bd:	89 d1                	mov    %edx,%ecx
+  8003bf:	c1 e9 0f             	shr    $0xf,%ecx
+  8003c2:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8003c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003cd:	0f 42 d1             	cmovb  %ecx,%edx
+  8003d0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003d5:	89 04 95 00 6e 80 00 	mov    %eax,0x806e00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003dc:	85 db                	test   %ebx,%ebx
+  8003de:	7e 07                	jle    8003e7 <libmain+0x74>
+		binaryname = argv[0];
+  8003e0:	8b 06                	mov    (%esi),%eax
+  8003e2:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	56                   	push   %esi
+  8003eb:	53                   	push   %ebx
+  8003ec:	e8 44 fc ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8003f1:	e8 0a 00 00 00       	call   800400 <exit>
+}
+  8003f6:	83 c4 10             	add    $0x10,%esp
+  8003f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003fc:	5b                   	pop    %ebx
+  8003fd:	5e                   	pop    %esi
+  8003fe:	5d                   	pop    %ebp
+  8003ff:	c3                   	ret
+
+00800400 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800406:	e8 dd 19 00 00       	call   801de8 <close_all>
+	sys_env_destroy(0);
+  80040b:	83 ec 0c             	sub    $0xc,%esp
+  80040e:	6a 00                	push   $0x0
+  800410:	e8 8c 0b 00 00       	call   800fa1 <sys_env_destroy>
+}
+  800415:	83 c4 10             	add    $0x10,%esp
+  800418:	c9                   	leave
+  800419:	c3                   	ret
+
+0080041a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80041a:	55                   	push   %ebp
+  80041b:	89 e5                	mov    %esp,%ebp
+  80041d:	56                   	push   %esi
+  80041e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80041f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800422:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800428:	e8 b5 0b 00 00       	call   800fe2 <sys_getenvid>
+  80042d:	83 ec 0c             	sub    $0xc,%esp
+  800430:	ff 75 0c             	push   0xc(%ebp)
+  800433:	ff 75 08             	push   0x8(%ebp)
+  800436:	56                   	push   %esi
+  800437:	50                   	push   %eax
+  800438:	68 88 49 80 00       	push   $0x804988
+  80043d:	e8 b3 00 00 00       	call   8004f5 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800442:	83 c4 18             	add    $0x18,%esp
+  800445:	53                   	push   %ebx
+  800446:	ff 75 10             	push   0x10(%ebp)
+  800449:	e8 56 00 00 00       	call   8004a4 <vcprintf>
+	cprintf("\n");
+  80044e:	c7 04 24 c4 47 80 00 	movl   $0x8047c4,(%esp)
+  800455:	e8 9b 00 00 00       	call   8004f5 <cprintf>
+  80045a:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80045d:	cc                   	int3
+	while (1)
+  80045e:	eb fd                	jmp    80045d <_panic+0x43>
+
+00800460 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	53                   	push   %ebx
+  800464:	83 ec 04             	sub    $0x4,%esp
+  800467:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80046a:	8b 13                	mov    (%ebx),%edx
+  80046c:	8d 42 01             	lea    0x1(%edx),%eax
+  80046f:	89 03                	mov    %eax,(%ebx)
+  800471:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800474:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800478:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80047d:	74 09                	je     800488 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80047f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800483:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800486:	c9                   	leave
+  800487:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	68 ff 00 00 00       	push   $0xff
+  800490:	8d 43 08             	lea    0x8(%ebx),%eax
+  800493:	50                   	push   %eax
+  800494:	e8 cb 0a 00 00       	call   800f64 <sys_cputs>
+		b->idx = 0;
+  800499:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80049f:	83 c4 10             	add    $0x10,%esp
+  8004a2:	eb db                	jmp    80047f <putch+0x1f>
+
+008004a4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004a4:	55                   	push   %ebp
+  8004a5:	89 e5                	mov    %esp,%ebp
+  8004a7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8004ad:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004b4:	00 00 00 
+	b.cnt = 0;
+  8004b7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004be:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8004c1:	ff 75 0c             	push   0xc(%ebp)
+  8004c4:	ff 75 08             	push   0x8(%ebp)
+  8004c7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004cd:	50                   	push   %eax
+  8004ce:	68 60 04 80 00       	push   $0x800460
+  8004d3:	e8 1c 01 00 00       	call   8005f4 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004d8:	83 c4 08             	add    $0x8,%esp
+  8004db:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004e1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004e7:	50                   	push   %eax
+  8004e8:	e8 77 0a 00 00       	call   800f64 <sys_cputs>
+
+	return b.cnt;
+}
+  8004ed:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004f3:	c9                   	leave
+  8004f4:	c3                   	ret
+
+008004f5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004f5:	55                   	push   %ebp
+  8004f6:	89 e5                	mov    %esp,%ebp
+  8004f8:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004fb:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004fe:	50                   	push   %eax
+  8004ff:	ff 75 08             	push   0x8(%ebp)
+  800502:	e8 9d ff ff ff       	call   8004a4 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800507:	c9                   	leave
+  800508:	c3                   	ret
+
+00800509 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800509:	55                   	push   %ebp
+  80050a:	89 e5                	mov    %esp,%ebp
+  80050c:	57                   	push   %edi
+  80050d:	56                   	push   %esi
+  80050e:	53                   	push   %ebx
+  80050f:	83 ec 1c             	sub    $0x1c,%esp
+  800512:	89 c3                	mov    %eax,%ebx
+  800514:	89 d6                	mov    %edx,%esi
+  800516:	8b 45 08             	mov    0x8(%ebp),%eax
+  800519:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80051c:	89 d1                	mov    %edx,%ecx
+  80051e:	89 c2                	mov    %eax,%edx
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800526:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800529:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800533:	39 c2                	cmp    %eax,%edx
+  800535:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800538:	73 4b                	jae    800585 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80053a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053d:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800540:	85 ff                	test   %edi,%edi
+  800542:	7e 11                	jle    800555 <printnum+0x4c>
+			putch(padc, putdat);
+  800544:	83 ec 08             	sub    $0x8,%esp
+  800547:	56                   	push   %esi
+  800548:	ff 75 18             	push   0x18(%ebp)
+  80054b:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	83 ef 01             	sub    $0x1,%edi
+  800553:	75 ef                	jne    800544 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	56                   	push   %esi
+  800559:	83 ec 04             	sub    $0x4,%esp
+  80055c:	ff 75 e4             	push   -0x1c(%ebp)
+  80055f:	ff 75 e0             	push   -0x20(%ebp)
+  800562:	ff 75 dc             	push   -0x24(%ebp)
+  800565:	ff 75 d8             	push   -0x28(%ebp)
+  800568:	e8 ef 40 00 00       	call   80465c <__umoddi3>
+  80056d:	83 c4 14             	add    $0x14,%esp
+  800570:	0f be 80 ab 49 80 00 	movsbl 0x8049ab(%eax),%eax
+  800577:	50                   	push   %eax
+  800578:	ff d3                	call   *%ebx
+}
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800580:	5b                   	pop    %ebx
+  800581:	5e                   	pop    %esi
+  800582:	5f                   	pop    %edi
+  800583:	5d                   	pop    %ebp
+  800584:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800585:	83 ec 0c             	sub    $0xc,%esp
+  800588:	ff 75 18             	push   0x18(%ebp)
+  80058b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80058e:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800591:	52                   	push   %edx
+  800592:	50                   	push   %eax
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	ff 75 e4             	push   -0x1c(%ebp)
+  800599:	ff 75 e0             	push   -0x20(%ebp)
+  80059c:	ff 75 dc             	push   -0x24(%ebp)
+  80059f:	ff 75 d8             	push   -0x28(%ebp)
+  8005a2:	e8 ef 3f 00 00       	call   804596 <__udivdi3>
+  8005a7:	83 c4 18             	add    $0x18,%esp
+  8005aa:	52                   	push   %edx
+  8005ab:	50                   	push   %eax
+  8005ac:	89 f2                	mov    %esi,%edx
+  8005ae:	89 d8                	mov    %ebx,%eax
+  8005b0:	e8 54 ff ff ff       	call   800509 <printnum>
+  8005b5:	83 c4 20             	add    $0x20,%esp
+  8005b8:	eb 9b                	jmp    800555 <printnum+0x4c>
+
+008005ba <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005ba:	55                   	push   %ebp
+  8005bb:	89 e5                	mov    %esp,%ebp
+  8005bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8005c0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8005c4:	8b 10                	mov    (%eax),%edx
+  8005c6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c9:	73 0a                	jae    8005d5 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005cb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005ce:	89 08                	mov    %ecx,(%eax)
+  8005d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005d3:	88 02                	mov    %al,(%edx)
+}
+  8005d5:	5d                   	pop    %ebp
+  8005d6:	c3                   	ret
+
+008005d7 <printfmt>:
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005dd:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005e0:	50                   	push   %eax
+  8005e1:	ff 75 10             	push   0x10(%ebp)
+  8005e4:	ff 75 0c             	push   0xc(%ebp)
+  8005e7:	ff 75 08             	push   0x8(%ebp)
+  8005ea:	e8 05 00 00 00       	call   8005f4 <vprintfmt>
+}
+  8005ef:	83 c4 10             	add    $0x10,%esp
+  8005f2:	c9                   	leave
+  8005f3:	c3                   	ret
+
+008005f4 <vprintfmt>:
+{
+  8005f4:	55                   	push   %ebp
+  8005f5:	89 e5                	mov    %esp,%ebp
+  8005f7:	57                   	push   %edi
+  8005f8:	56                   	push   %esi
+  8005f9:	53                   	push   %ebx
+  8005fa:	83 ec 2c             	sub    $0x2c,%esp
+  8005fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800600:	89 df                	mov    %ebx,%edi
+  800602:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800605:	8b 45 10             	mov    0x10(%ebp),%eax
+  800608:	8d 70 01             	lea    0x1(%eax),%esi
+  80060b:	0f b6 00             	movzbl (%eax),%eax
+  80060e:	83 f8 25             	cmp    $0x25,%eax
+  800611:	74 1e                	je     800631 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800613:	85 c0                	test   %eax,%eax
+  800615:	0f 84 15 05 00 00    	je     800b30 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80061b:	83 ec 08             	sub    $0x8,%esp
+  80061e:	53                   	push   %ebx
+  80061f:	50                   	push   %eax
+  800620:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800622:	83 c6 01             	add    $0x1,%esi
+  800625:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800629:	83 c4 10             	add    $0x10,%esp
+  80062c:	83 f8 25             	cmp    $0x25,%eax
+  80062f:	75 e2                	jne    800613 <vprintfmt+0x1f>
+		padc = ' ';
+  800631:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800635:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80063c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800643:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800652:	8d 56 01             	lea    0x1(%esi),%edx
+  800655:	0f b6 0e             	movzbl (%esi),%ecx
+  800658:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80065b:	3c 55                	cmp    $0x55,%al
+  80065d:	0f 87 3b 04 00 00    	ja     800a9e <vprintfmt+0x4aa>
+  800663:	0f b6 c0             	movzbl %al,%eax
+  800666:	ff 24 85 20 4b 80 00 	jmp    *0x804b20(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80066d:	89 75 10             	mov    %esi,0x10(%ebp)
+  800670:	eb 93                	jmp    800605 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800672:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800674:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800678:	eb d8                	jmp    800652 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80067a:	89 d6                	mov    %edx,%esi
+  80067c:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800680:	eb d0                	jmp    800652 <vprintfmt+0x5e>
+  800682:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800685:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800688:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80068b:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80068f:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800692:	83 f9 09             	cmp    $0x9,%ecx
+  800695:	77 6f                	ja     800706 <vprintfmt+0x112>
+  800697:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80069a:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80069d:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8006a0:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8006a4:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8006a7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8006aa:	83 fe 09             	cmp    $0x9,%esi
+  8006ad:	76 eb                	jbe    80069a <vprintfmt+0xa6>
+  8006af:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8006b2:	89 d6                	mov    %edx,%esi
+  8006b4:	eb 13                	jmp    8006c9 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 00                	mov    (%eax),%eax
+  8006bb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8006be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c7:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8006c9:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006cd:	79 83                	jns    800652 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8006cf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d5:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006dc:	e9 71 ff ff ff       	jmp    800652 <vprintfmt+0x5e>
+			if (width < 0)
+  8006e1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006e4:	85 c9                	test   %ecx,%ecx
+  8006e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006eb:	0f 49 c1             	cmovns %ecx,%eax
+  8006ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f1:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006f3:	e9 5a ff ff ff       	jmp    800652 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006f8:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8006fa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800701:	e9 4c ff ff ff       	jmp    800652 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800706:	89 d6                	mov    %edx,%esi
+  800708:	eb bf                	jmp    8006c9 <vprintfmt+0xd5>
+			lflag++;
+  80070a:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80070e:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800710:	e9 3d ff ff ff       	jmp    800652 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800715:	89 55 10             	mov    %edx,0x10(%ebp)
+  800718:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071b:	8d 70 04             	lea    0x4(%eax),%esi
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	ff 30                	push   (%eax)
+  800724:	ff d7                	call   *%edi
+			break;
+  800726:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800729:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80072c:	e9 d4 fe ff ff       	jmp    800605 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800731:	89 55 10             	mov    %edx,0x10(%ebp)
+  800734:	8b 45 14             	mov    0x14(%ebp),%eax
+  800737:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	89 d0                	mov    %edx,%eax
+  80073e:	f7 d8                	neg    %eax
+  800740:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800743:	83 f8 12             	cmp    $0x12,%eax
+  800746:	7f 23                	jg     80076b <vprintfmt+0x177>
+  800748:	8b 14 85 80 4c 80 00 	mov    0x804c80(,%eax,4),%edx
+  80074f:	85 d2                	test   %edx,%edx
+  800751:	74 18                	je     80076b <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800753:	52                   	push   %edx
+  800754:	68 d3 4e 80 00       	push   $0x804ed3
+  800759:	53                   	push   %ebx
+  80075a:	57                   	push   %edi
+  80075b:	e8 77 fe ff ff       	call   8005d7 <printfmt>
+  800760:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800763:	89 75 14             	mov    %esi,0x14(%ebp)
+  800766:	e9 9a fe ff ff       	jmp    800605 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80076b:	50                   	push   %eax
+  80076c:	68 c3 49 80 00       	push   $0x8049c3
+  800771:	53                   	push   %ebx
+  800772:	57                   	push   %edi
+  800773:	e8 5f fe ff ff       	call   8005d7 <printfmt>
+  800778:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80077b:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80077e:	e9 82 fe ff ff       	jmp    800605 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800783:	89 55 10             	mov    %edx,0x10(%ebp)
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	83 c0 04             	add    $0x4,%eax
+  80078c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 00                	mov    (%eax),%eax
+  800794:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800797:	85 c0                	test   %eax,%eax
+  800799:	0f 84 61 03 00 00    	je     800b00 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80079f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007a3:	7e 06                	jle    8007ab <vprintfmt+0x1b7>
+  8007a5:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8007a9:	75 29                	jne    8007d4 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007ae:	8d 70 01             	lea    0x1(%eax),%esi
+  8007b1:	0f b6 00             	movzbl (%eax),%eax
+  8007b4:	0f be d0             	movsbl %al,%edx
+  8007b7:	85 d2                	test   %edx,%edx
+  8007b9:	0f 84 bb 00 00 00    	je     80087a <vprintfmt+0x286>
+  8007bf:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007c2:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007c5:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007c8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007cb:	eb 7a                	jmp    800847 <vprintfmt+0x253>
+				p = "(null)";
+  8007cd:	c7 45 d0 bc 49 80 00 	movl   $0x8049bc,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007d4:	83 ec 08             	sub    $0x8,%esp
+  8007d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8007da:	ff 75 d0             	push   -0x30(%ebp)
+  8007dd:	e8 e0 03 00 00       	call   800bc2 <strnlen>
+  8007e2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007e5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	85 d2                	test   %edx,%edx
+  8007ed:	0f 8e d6 02 00 00    	jle    800ac9 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8007f3:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007f7:	83 ec 08             	sub    $0x8,%esp
+  8007fa:	53                   	push   %ebx
+  8007fb:	56                   	push   %esi
+  8007fc:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007fe:	83 c4 10             	add    $0x10,%esp
+  800801:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800805:	75 f0                	jne    8007f7 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800807:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80080a:	8d 70 01             	lea    0x1(%eax),%esi
+  80080d:	0f b6 00             	movzbl (%eax),%eax
+  800810:	0f be d0             	movsbl %al,%edx
+  800813:	85 d2                	test   %edx,%edx
+  800815:	0f 84 da 02 00 00    	je     800af5 <vprintfmt+0x501>
+  80081b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80081e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800821:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800824:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800827:	eb 1e                	jmp    800847 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800829:	83 ec 08             	sub    $0x8,%esp
+  80082c:	ff 75 0c             	push   0xc(%ebp)
+  80082f:	52                   	push   %edx
+  800830:	ff 55 08             	call   *0x8(%ebp)
+  800833:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800836:	83 eb 01             	sub    $0x1,%ebx
+  800839:	83 c6 01             	add    $0x1,%esi
+  80083c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800840:	0f be d0             	movsbl %al,%edx
+  800843:	85 d2                	test   %edx,%edx
+  800845:	74 2a                	je     800871 <vprintfmt+0x27d>
+  800847:	85 ff                	test   %edi,%edi
+  800849:	78 05                	js     800850 <vprintfmt+0x25c>
+  80084b:	83 ef 01             	sub    $0x1,%edi
+  80084e:	78 59                	js     8008a9 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800850:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800854:	74 d3                	je     800829 <vprintfmt+0x235>
+  800856:	0f be c0             	movsbl %al,%eax
+  800859:	83 e8 20             	sub    $0x20,%eax
+  80085c:	83 f8 5e             	cmp    $0x5e,%eax
+  80085f:	76 c8                	jbe    800829 <vprintfmt+0x235>
+					putch('?', putdat);
+  800861:	83 ec 08             	sub    $0x8,%esp
+  800864:	ff 75 0c             	push   0xc(%ebp)
+  800867:	6a 3f                	push   $0x3f
+  800869:	ff 55 08             	call   *0x8(%ebp)
+  80086c:	83 c4 10             	add    $0x10,%esp
+  80086f:	eb c5                	jmp    800836 <vprintfmt+0x242>
+  800871:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800874:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800877:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80087a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80087d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800881:	7e 1b                	jle    80089e <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800883:	83 ec 08             	sub    $0x8,%esp
+  800886:	53                   	push   %ebx
+  800887:	6a 20                	push   $0x20
+  800889:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80088b:	83 c4 10             	add    $0x10,%esp
+  80088e:	83 ee 01             	sub    $0x1,%esi
+  800891:	75 f0                	jne    800883 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800893:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800896:	89 45 14             	mov    %eax,0x14(%ebp)
+  800899:	e9 67 fd ff ff       	jmp    800605 <vprintfmt+0x11>
+  80089e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008a1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008a4:	e9 5c fd ff ff       	jmp    800605 <vprintfmt+0x11>
+  8008a9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8008ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008b2:	eb c6                	jmp    80087a <vprintfmt+0x286>
+	if (lflag >= 2)
+  8008b4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008b7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ba:	83 f9 01             	cmp    $0x1,%ecx
+  8008bd:	7f 1f                	jg     8008de <vprintfmt+0x2ea>
+	else if (lflag)
+  8008bf:	85 c9                	test   %ecx,%ecx
+  8008c1:	74 67                	je     80092a <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8b 30                	mov    (%eax),%esi
+  8008c8:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008cb:	89 f0                	mov    %esi,%eax
+  8008cd:	c1 f8 1f             	sar    $0x1f,%eax
+  8008d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008dc:	eb 17                	jmp    8008f5 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8008de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e1:	8b 50 04             	mov    0x4(%eax),%edx
+  8008e4:	8b 00                	mov    (%eax),%eax
+  8008e6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008e9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008f5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008f8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008fb:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800900:	85 c9                	test   %ecx,%ecx
+  800902:	0f 89 12 01 00 00    	jns    800a1a <vprintfmt+0x426>
+				putch('-', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 2d                	push   $0x2d
+  80090e:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800910:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800913:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800916:	f7 da                	neg    %edx
+  800918:	83 d1 00             	adc    $0x0,%ecx
+  80091b:	f7 d9                	neg    %ecx
+  80091d:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800920:	be 0a 00 00 00       	mov    $0xa,%esi
+  800925:	e9 f0 00 00 00       	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80092a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092d:	8b 30                	mov    (%eax),%esi
+  80092f:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800932:	89 f0                	mov    %esi,%eax
+  800934:	c1 f8 1f             	sar    $0x1f,%eax
+  800937:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8d 40 04             	lea    0x4(%eax),%eax
+  800940:	89 45 14             	mov    %eax,0x14(%ebp)
+  800943:	eb b0                	jmp    8008f5 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800945:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800948:	89 55 10             	mov    %edx,0x10(%ebp)
+  80094b:	83 f9 01             	cmp    $0x1,%ecx
+  80094e:	7f 1e                	jg     80096e <vprintfmt+0x37a>
+	else if (lflag)
+  800950:	85 c9                	test   %ecx,%ecx
+  800952:	74 32                	je     800986 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800954:	8b 45 14             	mov    0x14(%ebp),%eax
+  800957:	8b 10                	mov    (%eax),%edx
+  800959:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80095e:	8d 40 04             	lea    0x4(%eax),%eax
+  800961:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800964:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800969:	e9 ac 00 00 00       	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80096e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800971:	8b 10                	mov    (%eax),%edx
+  800973:	8b 48 04             	mov    0x4(%eax),%ecx
+  800976:	8d 40 08             	lea    0x8(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80097c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800981:	e9 94 00 00 00       	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800986:	8b 45 14             	mov    0x14(%ebp),%eax
+  800989:	8b 10                	mov    (%eax),%edx
+  80098b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800990:	8d 40 04             	lea    0x4(%eax),%eax
+  800993:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800996:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80099b:	eb 7d                	jmp    800a1a <vprintfmt+0x426>
+	if (lflag >= 2)
+  80099d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009a0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009a3:	83 f9 01             	cmp    $0x1,%ecx
+  8009a6:	7f 1b                	jg     8009c3 <vprintfmt+0x3cf>
+	else if (lflag)
+  8009a8:	85 c9                	test   %ecx,%ecx
+  8009aa:	74 2c                	je     8009d8 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8009ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009af:	8b 10                	mov    (%eax),%edx
+  8009b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009bc:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8009c1:	eb 57                	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c6:	8b 10                	mov    (%eax),%edx
+  8009c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009d1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8009d6:	eb 42                	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009db:	8b 10                	mov    (%eax),%edx
+  8009dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009e8:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8009ed:	eb 2b                	jmp    800a1a <vprintfmt+0x426>
+			putch('0', putdat);
+  8009ef:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009f2:	83 ec 08             	sub    $0x8,%esp
+  8009f5:	53                   	push   %ebx
+  8009f6:	6a 30                	push   $0x30
+  8009f8:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8009fa:	83 c4 08             	add    $0x8,%esp
+  8009fd:	53                   	push   %ebx
+  8009fe:	6a 78                	push   $0x78
+  800a00:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800a02:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a05:	8b 10                	mov    (%eax),%edx
+  800a07:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a0c:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a0f:	8d 40 04             	lea    0x4(%eax),%eax
+  800a12:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a15:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800a1a:	83 ec 0c             	sub    $0xc,%esp
+  800a1d:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800a21:	50                   	push   %eax
+  800a22:	ff 75 e4             	push   -0x1c(%ebp)
+  800a25:	56                   	push   %esi
+  800a26:	51                   	push   %ecx
+  800a27:	52                   	push   %edx
+  800a28:	89 da                	mov    %ebx,%edx
+  800a2a:	89 f8                	mov    %edi,%eax
+  800a2c:	e8 d8 fa ff ff       	call   800509 <printnum>
+			break;
+  800a31:	83 c4 20             	add    $0x20,%esp
+  800a34:	e9 cc fb ff ff       	jmp    800605 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a39:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a3c:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a3f:	83 f9 01             	cmp    $0x1,%ecx
+  800a42:	7f 1b                	jg     800a5f <vprintfmt+0x46b>
+	else if (lflag)
+  800a44:	85 c9                	test   %ecx,%ecx
+  800a46:	74 2c                	je     800a74 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a48:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4b:	8b 10                	mov    (%eax),%edx
+  800a4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a52:	8d 40 04             	lea    0x4(%eax),%eax
+  800a55:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a58:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a5d:	eb bb                	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a62:	8b 10                	mov    (%eax),%edx
+  800a64:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a67:	8d 40 08             	lea    0x8(%eax),%eax
+  800a6a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a6d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a72:	eb a6                	jmp    800a1a <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a74:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a77:	8b 10                	mov    (%eax),%edx
+  800a79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a7e:	8d 40 04             	lea    0x4(%eax),%eax
+  800a81:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a84:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a89:	eb 8f                	jmp    800a1a <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a8b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a8e:	83 ec 08             	sub    $0x8,%esp
+  800a91:	53                   	push   %ebx
+  800a92:	6a 25                	push   $0x25
+  800a94:	ff d7                	call   *%edi
+			break;
+  800a96:	83 c4 10             	add    $0x10,%esp
+  800a99:	e9 67 fb ff ff       	jmp    800605 <vprintfmt+0x11>
+			putch('%', putdat);
+  800a9e:	83 ec 08             	sub    $0x8,%esp
+  800aa1:	53                   	push   %ebx
+  800aa2:	6a 25                	push   $0x25
+  800aa4:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800aa6:	83 c4 10             	add    $0x10,%esp
+  800aa9:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800aad:	0f 84 ba fb ff ff    	je     80066d <vprintfmt+0x79>
+  800ab3:	89 75 10             	mov    %esi,0x10(%ebp)
+  800ab6:	89 f0                	mov    %esi,%eax
+  800ab8:	83 e8 01             	sub    $0x1,%eax
+  800abb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800abf:	75 f7                	jne    800ab8 <vprintfmt+0x4c4>
+  800ac1:	89 45 10             	mov    %eax,0x10(%ebp)
+  800ac4:	e9 3c fb ff ff       	jmp    800605 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ac9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800acc:	8d 70 01             	lea    0x1(%eax),%esi
+  800acf:	0f b6 00             	movzbl (%eax),%eax
+  800ad2:	0f be d0             	movsbl %al,%edx
+  800ad5:	85 d2                	test   %edx,%edx
+  800ad7:	74 11                	je     800aea <vprintfmt+0x4f6>
+  800ad9:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800adc:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800adf:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ae2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ae5:	e9 5d fd ff ff       	jmp    800847 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800aea:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800aed:	89 45 14             	mov    %eax,0x14(%ebp)
+  800af0:	e9 10 fb ff ff       	jmp    800605 <vprintfmt+0x11>
+  800af5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800af8:	89 45 14             	mov    %eax,0x14(%ebp)
+  800afb:	e9 05 fb ff ff       	jmp    800605 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800b00:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b04:	7e 0a                	jle    800b10 <vprintfmt+0x51c>
+  800b06:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800b0a:	0f 85 bd fc ff ff    	jne    8007cd <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b10:	ba 28 00 00 00       	mov    $0x28,%edx
+  800b15:	b8 28 00 00 00       	mov    $0x28,%eax
+  800b1a:	be bd 49 80 00       	mov    $0x8049bd,%esi
+  800b1f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b22:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b25:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b28:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b2b:	e9 17 fd ff ff       	jmp    800847 <vprintfmt+0x253>
+}
+  800b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5f                   	pop    %edi
+  800b36:	5d                   	pop    %ebp
+  800b37:	c3                   	ret
+
+00800b38 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	83 ec 18             	sub    $0x18,%esp
+  800b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b41:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b44:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b47:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b4b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b4e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b55:	85 c0                	test   %eax,%eax
+  800b57:	74 26                	je     800b7f <vsnprintf+0x47>
+  800b59:	85 d2                	test   %edx,%edx
+  800b5b:	7e 22                	jle    800b7f <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b5d:	ff 75 14             	push   0x14(%ebp)
+  800b60:	ff 75 10             	push   0x10(%ebp)
+  800b63:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b66:	50                   	push   %eax
+  800b67:	68 ba 05 80 00       	push   $0x8005ba
+  800b6c:	e8 83 fa ff ff       	call   8005f4 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b74:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b7a:	83 c4 10             	add    $0x10,%esp
+}
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+		return -E_INVAL;
+  800b7f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b84:	eb f7                	jmp    800b7d <vsnprintf+0x45>
+
+00800b86 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b8c:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b8f:	50                   	push   %eax
+  800b90:	ff 75 10             	push   0x10(%ebp)
+  800b93:	ff 75 0c             	push   0xc(%ebp)
+  800b96:	ff 75 08             	push   0x8(%ebp)
+  800b99:	e8 9a ff ff ff       	call   800b38 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b9e:	c9                   	leave
+  800b9f:	c3                   	ret
+
+00800ba0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ba6:	80 3a 00             	cmpb   $0x0,(%edx)
+  800ba9:	74 10                	je     800bbb <strlen+0x1b>
+  800bab:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800bb0:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bb3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bb7:	75 f7                	jne    800bb0 <strlen+0x10>
+	return n;
+}
+  800bb9:	5d                   	pop    %ebp
+  800bba:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800bc0:	eb f7                	jmp    800bb9 <strlen+0x19>
+
+00800bc2 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bc2:	55                   	push   %ebp
+  800bc3:	89 e5                	mov    %esp,%ebp
+  800bc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bcb:	85 d2                	test   %edx,%edx
+  800bcd:	74 16                	je     800be5 <strnlen+0x23>
+  800bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bd8:	74 09                	je     800be3 <strnlen+0x21>
+		n++;
+  800bda:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bdd:	39 d0                	cmp    %edx,%eax
+  800bdf:	75 f3                	jne    800bd4 <strnlen+0x12>
+		n++;
+  800be1:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800be3:	5d                   	pop    %ebp
+  800be4:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	eb f7                	jmp    800be3 <strnlen+0x21>
+
+00800bec <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	53                   	push   %ebx
+  800bf0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bf3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bff:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c02:	83 c0 01             	add    $0x1,%eax
+  800c05:	84 d2                	test   %dl,%dl
+  800c07:	75 f2                	jne    800bfb <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c09:	89 c8                	mov    %ecx,%eax
+  800c0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c0e:	c9                   	leave
+  800c0f:	c3                   	ret
+
+00800c10 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c10:	55                   	push   %ebp
+  800c11:	89 e5                	mov    %esp,%ebp
+  800c13:	53                   	push   %ebx
+  800c14:	83 ec 10             	sub    $0x10,%esp
+  800c17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c1a:	53                   	push   %ebx
+  800c1b:	e8 80 ff ff ff       	call   800ba0 <strlen>
+  800c20:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c23:	ff 75 0c             	push   0xc(%ebp)
+  800c26:	01 d8                	add    %ebx,%eax
+  800c28:	50                   	push   %eax
+  800c29:	e8 be ff ff ff       	call   800bec <strcpy>
+	return dst;
+}
+  800c2e:	89 d8                	mov    %ebx,%eax
+  800c30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c33:	c9                   	leave
+  800c34:	c3                   	ret
+
+00800c35 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c43:	85 db                	test   %ebx,%ebx
+  800c45:	74 17                	je     800c5e <strncpy+0x29>
+  800c47:	01 f3                	add    %esi,%ebx
+  800c49:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c4b:	83 c0 01             	add    $0x1,%eax
+  800c4e:	0f b6 0a             	movzbl (%edx),%ecx
+  800c51:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c54:	80 f9 01             	cmp    $0x1,%cl
+  800c57:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c5a:	39 c3                	cmp    %eax,%ebx
+  800c5c:	75 ed                	jne    800c4b <strncpy+0x16>
+	}
+	return ret;
+}
+  800c5e:	89 f0                	mov    %esi,%eax
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5d                   	pop    %ebp
+  800c63:	c3                   	ret
+
+00800c64 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+  800c69:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c72:	89 f0                	mov    %esi,%eax
+  800c74:	85 db                	test   %ebx,%ebx
+  800c76:	74 1e                	je     800c96 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c78:	83 eb 01             	sub    $0x1,%ebx
+  800c7b:	74 16                	je     800c93 <strlcpy+0x2f>
+  800c7d:	01 f3                	add    %esi,%ebx
+  800c7f:	0f b6 0a             	movzbl (%edx),%ecx
+  800c82:	84 c9                	test   %cl,%cl
+  800c84:	74 0d                	je     800c93 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c86:	83 c2 01             	add    $0x1,%edx
+  800c89:	83 c0 01             	add    $0x1,%eax
+  800c8c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c8f:	39 d8                	cmp    %ebx,%eax
+  800c91:	75 ec                	jne    800c7f <strlcpy+0x1b>
+		*dst = '\0';
+  800c93:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c96:	29 f0                	sub    %esi,%eax
+}
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+
+00800c9c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ca2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ca5:	0f b6 01             	movzbl (%ecx),%eax
+  800ca8:	84 c0                	test   %al,%al
+  800caa:	74 11                	je     800cbd <strcmp+0x21>
+  800cac:	38 02                	cmp    %al,(%edx)
+  800cae:	75 0d                	jne    800cbd <strcmp+0x21>
+		p++, q++;
+  800cb0:	83 c1 01             	add    $0x1,%ecx
+  800cb3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cb6:	0f b6 01             	movzbl (%ecx),%eax
+  800cb9:	84 c0                	test   %al,%al
+  800cbb:	75 ef                	jne    800cac <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cbd:	0f b6 c0             	movzbl %al,%eax
+  800cc0:	0f b6 12             	movzbl (%edx),%edx
+  800cc3:	29 d0                	sub    %edx,%eax
+}
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+
+00800cc7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	53                   	push   %ebx
+  800ccb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800cd1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800cd9:	85 d2                	test   %edx,%edx
+  800cdb:	74 2e                	je     800d0b <strncmp+0x44>
+  800cdd:	0f b6 01             	movzbl (%ecx),%eax
+  800ce0:	84 c0                	test   %al,%al
+  800ce2:	74 16                	je     800cfa <strncmp+0x33>
+  800ce4:	3a 03                	cmp    (%ebx),%al
+  800ce6:	75 12                	jne    800cfa <strncmp+0x33>
+		n--, p++, q++;
+  800ce8:	83 c1 01             	add    $0x1,%ecx
+  800ceb:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800cee:	83 ea 01             	sub    $0x1,%edx
+  800cf1:	75 ea                	jne    800cdd <strncmp+0x16>
+		return 0;
+  800cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf8:	eb 11                	jmp    800d0b <strncmp+0x44>
+  800cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800cff:	85 d2                	test   %edx,%edx
+  800d01:	74 08                	je     800d0b <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d03:	0f b6 01             	movzbl (%ecx),%eax
+  800d06:	0f b6 13             	movzbl (%ebx),%edx
+  800d09:	29 d0                	sub    %edx,%eax
+}
+  800d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d0e:	c9                   	leave
+  800d0f:	c3                   	ret
+
+00800d10 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d1a:	0f b6 10             	movzbl (%eax),%edx
+  800d1d:	84 d2                	test   %dl,%dl
+  800d1f:	74 15                	je     800d36 <strchr+0x26>
+		if (*s == c)
+  800d21:	38 d1                	cmp    %dl,%cl
+  800d23:	74 0f                	je     800d34 <strchr+0x24>
+	for (; *s; s++)
+  800d25:	83 c0 01             	add    $0x1,%eax
+  800d28:	0f b6 10             	movzbl (%eax),%edx
+  800d2b:	84 d2                	test   %dl,%dl
+  800d2d:	75 f2                	jne    800d21 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+	return 0;
+  800d36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3b:	eb f7                	jmp    800d34 <strchr+0x24>
+
+00800d3d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d3d:	55                   	push   %ebp
+  800d3e:	89 e5                	mov    %esp,%ebp
+  800d40:	53                   	push   %ebx
+  800d41:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d44:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d47:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d4a:	38 d3                	cmp    %dl,%bl
+  800d4c:	74 14                	je     800d62 <strfind+0x25>
+  800d4e:	89 d1                	mov    %edx,%ecx
+  800d50:	84 db                	test   %bl,%bl
+  800d52:	74 0e                	je     800d62 <strfind+0x25>
+	for (; *s; s++)
+  800d54:	83 c0 01             	add    $0x1,%eax
+  800d57:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d5a:	38 ca                	cmp    %cl,%dl
+  800d5c:	74 04                	je     800d62 <strfind+0x25>
+  800d5e:	84 d2                	test   %dl,%dl
+  800d60:	75 f2                	jne    800d54 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d62:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d65:	c9                   	leave
+  800d66:	c3                   	ret
+
+00800d67 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	57                   	push   %edi
+  800d6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d6e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d71:	85 c9                	test   %ecx,%ecx
+  800d73:	74 20                	je     800d95 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d75:	89 f8                	mov    %edi,%eax
+  800d77:	09 c8                	or     %ecx,%eax
+  800d79:	a8 03                	test   $0x3,%al
+  800d7b:	75 12                	jne    800d8f <memset+0x28>
+		c &= 0xFF;
+  800d7d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d81:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d87:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d8a:	fc                   	cld
+  800d8b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d8d:	eb 06                	jmp    800d95 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d92:	fc                   	cld
+  800d93:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d95:	89 f8                	mov    %edi,%eax
+  800d97:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d9a:	c9                   	leave
+  800d9b:	c3                   	ret
+
+00800d9c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800da7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800daa:	39 c6                	cmp    %eax,%esi
+  800dac:	73 32                	jae    800de0 <memmove+0x44>
+  800dae:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800db1:	39 d0                	cmp    %edx,%eax
+  800db3:	73 2b                	jae    800de0 <memmove+0x44>
+		s += n;
+		d += n;
+  800db5:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800db8:	89 d6                	mov    %edx,%esi
+  800dba:	09 fe                	or     %edi,%esi
+  800dbc:	09 ce                	or     %ecx,%esi
+  800dbe:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800dc4:	75 0e                	jne    800dd4 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800dc6:	83 ef 04             	sub    $0x4,%edi
+  800dc9:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800dcc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800dcf:	fd                   	std
+  800dd0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dd2:	eb 09                	jmp    800ddd <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dd4:	83 ef 01             	sub    $0x1,%edi
+  800dd7:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800dda:	fd                   	std
+  800ddb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ddd:	fc                   	cld
+  800dde:	eb 1a                	jmp    800dfa <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800de0:	89 f2                	mov    %esi,%edx
+  800de2:	09 c2                	or     %eax,%edx
+  800de4:	09 ca                	or     %ecx,%edx
+  800de6:	f6 c2 03             	test   $0x3,%dl
+  800de9:	75 0a                	jne    800df5 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800deb:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dee:	89 c7                	mov    %eax,%edi
+  800df0:	fc                   	cld
+  800df1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800df3:	eb 05                	jmp    800dfa <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800df5:	89 c7                	mov    %eax,%edi
+  800df7:	fc                   	cld
+  800df8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5f                   	pop    %edi
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+
+00800dfe <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e04:	ff 75 10             	push   0x10(%ebp)
+  800e07:	ff 75 0c             	push   0xc(%ebp)
+  800e0a:	ff 75 08             	push   0x8(%ebp)
+  800e0d:	e8 8a ff ff ff       	call   800d9c <memmove>
+}
+  800e12:	c9                   	leave
+  800e13:	c3                   	ret
+
+00800e14 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e1f:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e22:	85 f6                	test   %esi,%esi
+  800e24:	74 29                	je     800e4f <memcmp+0x3b>
+  800e26:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e28:	0f b6 08             	movzbl (%eax),%ecx
+  800e2b:	0f b6 1a             	movzbl (%edx),%ebx
+  800e2e:	38 d9                	cmp    %bl,%cl
+  800e30:	75 11                	jne    800e43 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e32:	83 c0 01             	add    $0x1,%eax
+  800e35:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e38:	39 c6                	cmp    %eax,%esi
+  800e3a:	75 ec                	jne    800e28 <memcmp+0x14>
+	}
+
+	return 0;
+  800e3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e41:	eb 08                	jmp    800e4b <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e43:	0f b6 c1             	movzbl %cl,%eax
+  800e46:	0f b6 db             	movzbl %bl,%ebx
+  800e49:	29 d8                	sub    %ebx,%eax
+}
+  800e4b:	5b                   	pop    %ebx
+  800e4c:	5e                   	pop    %esi
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+	return 0;
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e54:	eb f5                	jmp    800e4b <memcmp+0x37>
+
+00800e56 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e5f:	89 c2                	mov    %eax,%edx
+  800e61:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e64:	39 d0                	cmp    %edx,%eax
+  800e66:	73 0d                	jae    800e75 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e68:	38 08                	cmp    %cl,(%eax)
+  800e6a:	74 0d                	je     800e79 <memfind+0x23>
+	for (; s < ends; s++)
+  800e6c:	83 c0 01             	add    $0x1,%eax
+  800e6f:	39 c2                	cmp    %eax,%edx
+  800e71:	75 f5                	jne    800e68 <memfind+0x12>
+  800e73:	eb 06                	jmp    800e7b <memfind+0x25>
+  800e75:	89 c2                	mov    %eax,%edx
+  800e77:	eb 02                	jmp    800e7b <memfind+0x25>
+  800e79:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e7b:	89 d0                	mov    %edx,%eax
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+
+00800e7f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  800e85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e8b:	0f b6 02             	movzbl (%edx),%eax
+  800e8e:	3c 20                	cmp    $0x20,%al
+  800e90:	74 04                	je     800e96 <strtol+0x17>
+  800e92:	3c 09                	cmp    $0x9,%al
+  800e94:	75 0e                	jne    800ea4 <strtol+0x25>
+		s++;
+  800e96:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e99:	0f b6 02             	movzbl (%edx),%eax
+  800e9c:	3c 20                	cmp    $0x20,%al
+  800e9e:	74 f6                	je     800e96 <strtol+0x17>
+  800ea0:	3c 09                	cmp    $0x9,%al
+  800ea2:	74 f2                	je     800e96 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ea4:	3c 2b                	cmp    $0x2b,%al
+  800ea6:	74 2a                	je     800ed2 <strtol+0x53>
+	int neg = 0;
+  800ea8:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ead:	3c 2d                	cmp    $0x2d,%al
+  800eaf:	74 2b                	je     800edc <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eb1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800eb7:	75 0f                	jne    800ec8 <strtol+0x49>
+  800eb9:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ebc:	74 28                	je     800ee6 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ebe:	85 db                	test   %ebx,%ebx
+  800ec0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec5:	0f 44 d8             	cmove  %eax,%ebx
+  800ec8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ecd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ed0:	eb 46                	jmp    800f18 <strtol+0x99>
+		s++;
+  800ed2:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ed5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eda:	eb d5                	jmp    800eb1 <strtol+0x32>
+		s++, neg = 1;
+  800edc:	83 c2 01             	add    $0x1,%edx
+  800edf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ee4:	eb cb                	jmp    800eb1 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ee6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800eea:	74 0e                	je     800efa <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800eec:	85 db                	test   %ebx,%ebx
+  800eee:	75 d8                	jne    800ec8 <strtol+0x49>
+		s++, base = 8;
+  800ef0:	83 c2 01             	add    $0x1,%edx
+  800ef3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ef8:	eb ce                	jmp    800ec8 <strtol+0x49>
+		s += 2, base = 16;
+  800efa:	83 c2 02             	add    $0x2,%edx
+  800efd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f02:	eb c4                	jmp    800ec8 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f04:	0f be c0             	movsbl %al,%eax
+  800f07:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f0a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f0d:	7d 3a                	jge    800f49 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800f0f:	83 c2 01             	add    $0x1,%edx
+  800f12:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f16:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f18:	0f b6 02             	movzbl (%edx),%eax
+  800f1b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f1e:	89 f3                	mov    %esi,%ebx
+  800f20:	80 fb 09             	cmp    $0x9,%bl
+  800f23:	76 df                	jbe    800f04 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f25:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f28:	89 f3                	mov    %esi,%ebx
+  800f2a:	80 fb 19             	cmp    $0x19,%bl
+  800f2d:	77 08                	ja     800f37 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f2f:	0f be c0             	movsbl %al,%eax
+  800f32:	83 e8 57             	sub    $0x57,%eax
+  800f35:	eb d3                	jmp    800f0a <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f37:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f3a:	89 f3                	mov    %esi,%ebx
+  800f3c:	80 fb 19             	cmp    $0x19,%bl
+  800f3f:	77 08                	ja     800f49 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f41:	0f be c0             	movsbl %al,%eax
+  800f44:	83 e8 37             	sub    $0x37,%eax
+  800f47:	eb c1                	jmp    800f0a <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f49:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f4d:	74 05                	je     800f54 <strtol+0xd5>
+		*endptr = (char *) s;
+  800f4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f52:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f54:	89 c8                	mov    %ecx,%eax
+  800f56:	f7 d8                	neg    %eax
+  800f58:	85 ff                	test   %edi,%edi
+  800f5a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f5d:	89 c8                	mov    %ecx,%eax
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+
+00800f64 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	89 c3                	mov    %eax,%ebx
+  800f77:	89 c7                	mov    %eax,%edi
+  800f79:	89 c6                	mov    %eax,%esi
+  800f7b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f7d:	5b                   	pop    %ebx
+  800f7e:	5e                   	pop    %esi
+  800f7f:	5f                   	pop    %edi
+  800f80:	5d                   	pop    %ebp
+  800f81:	c3                   	ret
+
+00800f82 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f82:	55                   	push   %ebp
+  800f83:	89 e5                	mov    %esp,%ebp
+  800f85:	57                   	push   %edi
+  800f86:	56                   	push   %esi
+  800f87:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f92:	89 d1                	mov    %edx,%ecx
+  800f94:	89 d3                	mov    %edx,%ebx
+  800f96:	89 d7                	mov    %edx,%edi
+  800f98:	89 d6                	mov    %edx,%esi
+  800f9a:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5f                   	pop    %edi
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+
+00800fa1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800fa1:	55                   	push   %ebp
+  800fa2:	89 e5                	mov    %esp,%ebp
+  800fa4:	57                   	push   %edi
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800faa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fb7:	89 cb                	mov    %ecx,%ebx
+  800fb9:	89 cf                	mov    %ecx,%edi
+  800fbb:	89 ce                	mov    %ecx,%esi
+  800fbd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7f 08                	jg     800fcb <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5e                   	pop    %esi
+  800fc8:	5f                   	pop    %edi
+  800fc9:	5d                   	pop    %ebp
+  800fca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	50                   	push   %eax
+  800fcf:	6a 03                	push   $0x3
+  800fd1:	68 eb 4c 80 00       	push   $0x804ceb
+  800fd6:	6a 23                	push   $0x23
+  800fd8:	68 08 4d 80 00       	push   $0x804d08
+  800fdd:	e8 38 f4 ff ff       	call   80041a <_panic>
+
+00800fe2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	57                   	push   %edi
+  800fe6:	56                   	push   %esi
+  800fe7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fed:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ff2:	89 d1                	mov    %edx,%ecx
+  800ff4:	89 d3                	mov    %edx,%ebx
+  800ff6:	89 d7                	mov    %edx,%edi
+  800ff8:	89 d6                	mov    %edx,%esi
+  800ffa:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ffc:	5b                   	pop    %ebx
+  800ffd:	5e                   	pop    %esi
+  800ffe:	5f                   	pop    %edi
+  800fff:	5d                   	pop    %ebp
+  801000:	c3                   	ret
+
+00801001 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	57                   	push   %edi
+  801005:	56                   	push   %esi
+  801006:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801011:	89 d1                	mov    %edx,%ecx
+  801013:	89 d3                	mov    %edx,%ebx
+  801015:	89 d7                	mov    %edx,%edi
+  801017:	89 d6                	mov    %edx,%esi
+  801019:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80101b:	5b                   	pop    %ebx
+  80101c:	5e                   	pop    %esi
+  80101d:	5f                   	pop    %edi
+  80101e:	5d                   	pop    %ebp
+  80101f:	c3                   	ret
+
+00801020 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801020:	55                   	push   %ebp
+  801021:	89 e5                	mov    %esp,%ebp
+  801023:	57                   	push   %edi
+  801024:	56                   	push   %esi
+  801025:	53                   	push   %ebx
+  801026:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801029:	be 00 00 00 00       	mov    $0x0,%esi
+  80102e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801031:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801034:	b8 04 00 00 00       	mov    $0x4,%eax
+  801039:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103c:	89 f7                	mov    %esi,%edi
+  80103e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801040:	85 c0                	test   %eax,%eax
+  801042:	7f 08                	jg     80104c <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801044:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801047:	5b                   	pop    %ebx
+  801048:	5e                   	pop    %esi
+  801049:	5f                   	pop    %edi
+  80104a:	5d                   	pop    %ebp
+  80104b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80104c:	83 ec 0c             	sub    $0xc,%esp
+  80104f:	50                   	push   %eax
+  801050:	6a 04                	push   $0x4
+  801052:	68 eb 4c 80 00       	push   $0x804ceb
+  801057:	6a 23                	push   $0x23
+  801059:	68 08 4d 80 00       	push   $0x804d08
+  80105e:	e8 b7 f3 ff ff       	call   80041a <_panic>
+
+00801063 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801063:	55                   	push   %ebp
+  801064:	89 e5                	mov    %esp,%ebp
+  801066:	57                   	push   %edi
+  801067:	56                   	push   %esi
+  801068:	53                   	push   %ebx
+  801069:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 05 00 00 00       	mov    $0x5,%eax
+  801077:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80107d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801080:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 08                	jg     80108e <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108e:	83 ec 0c             	sub    $0xc,%esp
+  801091:	50                   	push   %eax
+  801092:	6a 05                	push   $0x5
+  801094:	68 eb 4c 80 00       	push   $0x804ceb
+  801099:	6a 23                	push   $0x23
+  80109b:	68 08 4d 80 00       	push   $0x804d08
+  8010a0:	e8 75 f3 ff ff       	call   80041a <_panic>
+
+008010a5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  8010ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010be:	89 df                	mov    %ebx,%edi
+  8010c0:	89 de                	mov    %ebx,%esi
+  8010c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c4:	85 c0                	test   %eax,%eax
+  8010c6:	7f 08                	jg     8010d0 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8010c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cb:	5b                   	pop    %ebx
+  8010cc:	5e                   	pop    %esi
+  8010cd:	5f                   	pop    %edi
+  8010ce:	5d                   	pop    %ebp
+  8010cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d0:	83 ec 0c             	sub    $0xc,%esp
+  8010d3:	50                   	push   %eax
+  8010d4:	6a 06                	push   $0x6
+  8010d6:	68 eb 4c 80 00       	push   $0x804ceb
+  8010db:	6a 23                	push   $0x23
+  8010dd:	68 08 4d 80 00       	push   $0x804d08
+  8010e2:	e8 33 f3 ff ff       	call   80041a <_panic>
+
+008010e7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+  8010ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801100:	89 df                	mov    %ebx,%edi
+  801102:	89 de                	mov    %ebx,%esi
+  801104:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801106:	85 c0                	test   %eax,%eax
+  801108:	7f 08                	jg     801112 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80110a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801112:	83 ec 0c             	sub    $0xc,%esp
+  801115:	50                   	push   %eax
+  801116:	6a 08                	push   $0x8
+  801118:	68 eb 4c 80 00       	push   $0x804ceb
+  80111d:	6a 23                	push   $0x23
+  80111f:	68 08 4d 80 00       	push   $0x804d08
+  801124:	e8 f1 f2 ff ff       	call   80041a <_panic>
+
+00801129 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801129:	55                   	push   %ebp
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	57                   	push   %edi
+  80112d:	56                   	push   %esi
+  80112e:	53                   	push   %ebx
+  80112f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801132:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801142:	89 df                	mov    %ebx,%edi
+  801144:	89 de                	mov    %ebx,%esi
+  801146:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801148:	85 c0                	test   %eax,%eax
+  80114a:	7f 08                	jg     801154 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80114c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114f:	5b                   	pop    %ebx
+  801150:	5e                   	pop    %esi
+  801151:	5f                   	pop    %edi
+  801152:	5d                   	pop    %ebp
+  801153:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801154:	83 ec 0c             	sub    $0xc,%esp
+  801157:	50                   	push   %eax
+  801158:	6a 09                	push   $0x9
+  80115a:	68 eb 4c 80 00       	push   $0x804ceb
+  80115f:	6a 23                	push   $0x23
+  801161:	68 08 4d 80 00       	push   $0x804d08
+  801166:	e8 af f2 ff ff       	call   80041a <_panic>
+
+0080116b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  801171:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801179:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801184:	89 df                	mov    %ebx,%edi
+  801186:	89 de                	mov    %ebx,%esi
+  801188:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118a:	85 c0                	test   %eax,%eax
+  80118c:	7f 08                	jg     801196 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80118e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801191:	5b                   	pop    %ebx
+  801192:	5e                   	pop    %esi
+  801193:	5f                   	pop    %edi
+  801194:	5d                   	pop    %ebp
+  801195:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801196:	83 ec 0c             	sub    $0xc,%esp
+  801199:	50                   	push   %eax
+  80119a:	6a 0a                	push   $0xa
+  80119c:	68 eb 4c 80 00       	push   $0x804ceb
+  8011a1:	6a 23                	push   $0x23
+  8011a3:	68 08 4d 80 00       	push   $0x804d08
+  8011a8:	e8 6d f2 ff ff       	call   80041a <_panic>
+
+008011ad <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	57                   	push   %edi
+  8011b1:	56                   	push   %esi
+  8011b2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011be:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c9:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+
+008011d0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+  8011d6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e6:	89 cb                	mov    %ecx,%ebx
+  8011e8:	89 cf                	mov    %ecx,%edi
+  8011ea:	89 ce                	mov    %ecx,%esi
+  8011ec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ee:	85 c0                	test   %eax,%eax
+  8011f0:	7f 08                	jg     8011fa <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f5:	5b                   	pop    %ebx
+  8011f6:	5e                   	pop    %esi
+  8011f7:	5f                   	pop    %edi
+  8011f8:	5d                   	pop    %ebp
+  8011f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011fa:	83 ec 0c             	sub    $0xc,%esp
+  8011fd:	50                   	push   %eax
+  8011fe:	6a 0d                	push   $0xd
+  801200:	68 eb 4c 80 00       	push   $0x804ceb
+  801205:	6a 23                	push   $0x23
+  801207:	68 08 4d 80 00       	push   $0x804d08
+  80120c:	e8 09 f2 ff ff       	call   80041a <_panic>
+
+00801211 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801211:	55                   	push   %ebp
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	57                   	push   %edi
+  801215:	56                   	push   %esi
+  801216:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801228:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+
+00801232 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	57                   	push   %edi
+  801236:	56                   	push   %esi
+  801237:	53                   	push   %ebx
+  801238:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801240:	8b 55 08             	mov    0x8(%ebp),%edx
+  801243:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801246:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80124b:	89 df                	mov    %ebx,%edi
+  80124d:	89 de                	mov    %ebx,%esi
+  80124f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801251:	85 c0                	test   %eax,%eax
+  801253:	7f 08                	jg     80125d <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801258:	5b                   	pop    %ebx
+  801259:	5e                   	pop    %esi
+  80125a:	5f                   	pop    %edi
+  80125b:	5d                   	pop    %ebp
+  80125c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125d:	83 ec 0c             	sub    $0xc,%esp
+  801260:	50                   	push   %eax
+  801261:	6a 0d                	push   $0xd
+  801263:	68 eb 4c 80 00       	push   $0x804ceb
+  801268:	6a 23                	push   $0x23
+  80126a:	68 08 4d 80 00       	push   $0x804d08
+  80126f:	e8 a6 f1 ff ff       	call   80041a <_panic>
+
+00801274 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801274:	55                   	push   %ebp
+  801275:	89 e5                	mov    %esp,%ebp
+  801277:	57                   	push   %edi
+  801278:	56                   	push   %esi
+  801279:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80127a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801284:	89 d1                	mov    %edx,%ecx
+  801286:	89 d3                	mov    %edx,%ebx
+  801288:	89 d7                	mov    %edx,%edi
+  80128a:	89 d6                	mov    %edx,%esi
+  80128c:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80128e:	5b                   	pop    %ebx
+  80128f:	5e                   	pop    %esi
+  801290:	5f                   	pop    %edi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+
+00801293 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801293:	55                   	push   %ebp
+  801294:	89 e5                	mov    %esp,%ebp
+  801296:	57                   	push   %edi
+  801297:	56                   	push   %esi
+  801298:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012a9:	89 df                	mov    %ebx,%edi
+  8012ab:	89 de                	mov    %ebx,%esi
+  8012ad:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8012af:	5b                   	pop    %ebx
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5f                   	pop    %edi
+  8012b2:	5d                   	pop    %ebp
+  8012b3:	c3                   	ret
+
+008012b4 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8012b4:	55                   	push   %ebp
+  8012b5:	89 e5                	mov    %esp,%ebp
+  8012b7:	57                   	push   %edi
+  8012b8:	56                   	push   %esi
+  8012b9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c2:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012c7:	89 cb                	mov    %ecx,%ebx
+  8012c9:	89 cf                	mov    %ecx,%edi
+  8012cb:	89 ce                	mov    %ecx,%esi
+  8012cd:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e5:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012ea:	89 df                	mov    %ebx,%edi
+  8012ec:	89 de                	mov    %ebx,%esi
+  8012ee:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801300:	8b 55 08             	mov    0x8(%ebp),%edx
+  801303:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801306:	b8 12 00 00 00       	mov    $0x12,%eax
+  80130b:	89 df                	mov    %ebx,%edi
+  80130d:	89 de                	mov    %ebx,%esi
+  80130f:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801311:	5b                   	pop    %ebx
+  801312:	5e                   	pop    %esi
+  801313:	5f                   	pop    %edi
+  801314:	5d                   	pop    %ebp
+  801315:	c3                   	ret
+
+00801316 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80131c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801321:	8b 55 08             	mov    0x8(%ebp),%edx
+  801324:	b8 13 00 00 00       	mov    $0x13,%eax
+  801329:	89 cb                	mov    %ecx,%ebx
+  80132b:	89 cf                	mov    %ecx,%edi
+  80132d:	89 ce                	mov    %ecx,%esi
+  80132f:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801331:	5b                   	pop    %ebx
+  801332:	5e                   	pop    %esi
+  801333:	5f                   	pop    %edi
+  801334:	5d                   	pop    %ebp
+  801335:	c3                   	ret
+
+00801336 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80133c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801341:	8b 55 08             	mov    0x8(%ebp),%edx
+  801344:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801347:	b8 14 00 00 00       	mov    $0x14,%eax
+  80134c:	89 df                	mov    %ebx,%edi
+  80134e:	89 de                	mov    %ebx,%esi
+  801350:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+
+00801357 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	57                   	push   %edi
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80135d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801362:	8b 55 08             	mov    0x8(%ebp),%edx
+  801365:	b8 15 00 00 00       	mov    $0x15,%eax
+  80136a:	89 cb                	mov    %ecx,%ebx
+  80136c:	89 cf                	mov    %ecx,%edi
+  80136e:	89 ce                	mov    %ecx,%esi
+  801370:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801372:	5b                   	pop    %ebx
+  801373:	5e                   	pop    %esi
+  801374:	5f                   	pop    %edi
+  801375:	5d                   	pop    %ebp
+  801376:	c3                   	ret
+
+00801377 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801377:	55                   	push   %ebp
+  801378:	89 e5                	mov    %esp,%ebp
+  80137a:	57                   	push   %edi
+  80137b:	56                   	push   %esi
+  80137c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80137d:	be 00 00 00 00       	mov    $0x0,%esi
+  801382:	8b 55 08             	mov    0x8(%ebp),%edx
+  801385:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801388:	b8 16 00 00 00       	mov    $0x16,%eax
+  80138d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801390:	89 f7                	mov    %esi,%edi
+  801392:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801394:	5b                   	pop    %ebx
+  801395:	5e                   	pop    %esi
+  801396:	5f                   	pop    %edi
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+
+00801399 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	57                   	push   %edi
+  80139d:	56                   	push   %esi
+  80139e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80139f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013aa:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013af:	89 df                	mov    %ebx,%edi
+  8013b1:	89 de                	mov    %ebx,%esi
+  8013b3:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8013b5:	5b                   	pop    %ebx
+  8013b6:	5e                   	pop    %esi
+  8013b7:	5f                   	pop    %edi
+  8013b8:	5d                   	pop    %ebp
+  8013b9:	c3                   	ret
+
+008013ba <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8013ba:	55                   	push   %ebp
+  8013bb:	89 e5                	mov    %esp,%ebp
+  8013bd:	57                   	push   %edi
+  8013be:	56                   	push   %esi
+  8013bf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013cd:	89 cb                	mov    %ecx,%ebx
+  8013cf:	89 cf                	mov    %ecx,%edi
+  8013d1:	89 ce                	mov    %ecx,%esi
+  8013d3:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8013d5:	5b                   	pop    %ebx
+  8013d6:	5e                   	pop    %esi
+  8013d7:	5f                   	pop    %edi
+  8013d8:	5d                   	pop    %ebp
+  8013d9:	c3                   	ret
+
+008013da <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8013e0:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8013e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ec:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013f1:	89 df                	mov    %ebx,%edi
+  8013f3:	89 de                	mov    %ebx,%esi
+  8013f5:	cd 30                	int    $0x30
+}
+  8013f7:	5b                   	pop    %ebx
+  8013f8:	5e                   	pop    %esi
+  8013f9:	5f                   	pop    %edi
+  8013fa:	5d                   	pop    %ebp
+  8013fb:	c3                   	ret
+
+008013fc <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8013fc:	55                   	push   %ebp
+  8013fd:	89 e5                	mov    %esp,%ebp
+  8013ff:	57                   	push   %edi
+  801400:	56                   	push   %esi
+  801401:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801402:	be 00 00 00 00       	mov    $0x0,%esi
+  801407:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801412:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801415:	89 f7                	mov    %esi,%edi
+  801417:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801419:	5b                   	pop    %ebx
+  80141a:	5e                   	pop    %esi
+  80141b:	5f                   	pop    %edi
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	57                   	push   %edi
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801424:	be 00 00 00 00       	mov    $0x0,%esi
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801434:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801437:	89 f7                	mov    %esi,%edi
+  801439:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80143b:	5b                   	pop    %ebx
+  80143c:	5e                   	pop    %esi
+  80143d:	5f                   	pop    %edi
+  80143e:	5d                   	pop    %ebp
+  80143f:	c3                   	ret
+
+00801440 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	57                   	push   %edi
+  801444:	56                   	push   %esi
+  801445:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801446:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801451:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801456:	89 df                	mov    %ebx,%edi
+  801458:	89 de                	mov    %ebx,%esi
+  80145a:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80145c:	5b                   	pop    %ebx
+  80145d:	5e                   	pop    %esi
+  80145e:	5f                   	pop    %edi
+  80145f:	5d                   	pop    %ebp
+  801460:	c3                   	ret
+
+00801461 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801461:	55                   	push   %ebp
+  801462:	89 e5                	mov    %esp,%ebp
+  801464:	57                   	push   %edi
+  801465:	56                   	push   %esi
+  801466:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801467:	be 00 00 00 00       	mov    $0x0,%esi
+  80146c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801472:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801477:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147a:	89 f7                	mov    %esi,%edi
+  80147c:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80147e:	5b                   	pop    %ebx
+  80147f:	5e                   	pop    %esi
+  801480:	5f                   	pop    %edi
+  801481:	5d                   	pop    %ebp
+  801482:	c3                   	ret
+
+00801483 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801483:	85 c0                	test   %eax,%eax
+  801485:	74 20                	je     8014a7 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801487:	89 c1                	mov    %eax,%ecx
+  801489:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80148f:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801495:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80149b:	8b 52 48             	mov    0x48(%edx),%edx
+  80149e:	39 c2                	cmp    %eax,%edx
+  8014a0:	74 06                	je     8014a8 <thread_alive+0x25>
+  8014a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014a7:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8014a8:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8014ae:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	0f 95 c0             	setne  %al
+  8014b9:	0f b6 c0             	movzbl %al,%eax
+  8014bc:	c3                   	ret
+
+008014bd <pgfault>:
+{
+  8014bd:	55                   	push   %ebp
+  8014be:	89 e5                	mov    %esp,%ebp
+  8014c0:	57                   	push   %edi
+  8014c1:	56                   	push   %esi
+  8014c2:	53                   	push   %ebx
+  8014c3:	83 ec 0c             	sub    $0xc,%esp
+  8014c6:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8014c9:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8014cb:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8014ce:	89 f3                	mov    %esi,%ebx
+  8014d0:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8014d3:	83 3d 80 6e 80 00 00 	cmpl   $0x0,0x806e80
+  8014da:	74 52                	je     80152e <pgfault+0x71>
+  8014dc:	a8 02                	test   $0x2,%al
+  8014de:	75 14                	jne    8014f4 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8014e0:	83 ec 04             	sub    $0x4,%esp
+  8014e3:	68 16 4d 80 00       	push   $0x804d16
+  8014e8:	6a 2e                	push   $0x2e
+  8014ea:	68 34 4d 80 00       	push   $0x804d34
+  8014ef:	e8 26 ef ff ff       	call   80041a <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8014f4:	89 d8                	mov    %ebx,%eax
+  8014f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014fb:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801502:	83 ec 0c             	sub    $0xc,%esp
+  801505:	57                   	push   %edi
+  801506:	e8 65 29 00 00       	call   803e70 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80150b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801512:	83 e0 03             	and    $0x3,%eax
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	83 f8 03             	cmp    $0x3,%eax
+  80151b:	75 1a                	jne    801537 <pgfault+0x7a>
+			mutex_unlock(m);
+  80151d:	83 ec 0c             	sub    $0xc,%esp
+  801520:	57                   	push   %edi
+  801521:	e8 b8 29 00 00       	call   803ede <mutex_unlock>
+			return;
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	e9 9f 00 00 00       	jmp    8015cd <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80152e:	a8 02                	test   $0x2,%al
+  801530:	74 ae                	je     8014e0 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801532:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801537:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80153e:	f6 c4 08             	test   $0x8,%ah
+  801541:	74 9d                	je     8014e0 <pgfault+0x23>
+  801543:	89 e0                	mov    %esp,%eax
+  801545:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80154a:	29 c2                	sub    %eax,%edx
+  80154c:	89 d0                	mov    %edx,%eax
+  80154e:	c1 e8 0f             	shr    $0xf,%eax
+  801551:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801557:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155c:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  80155f:	c1 e0 0c             	shl    $0xc,%eax
+  801562:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801567:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801569:	83 ec 04             	sub    $0x4,%esp
+  80156c:	6a 07                	push   $0x7
+  80156e:	53                   	push   %ebx
+  80156f:	6a 00                	push   $0x0
+  801571:	e8 aa fa ff ff       	call   801020 <sys_page_alloc>
+  801576:	83 c4 10             	add    $0x10,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 58                	js     8015d5 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  80157d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801583:	83 ec 04             	sub    $0x4,%esp
+  801586:	68 00 10 00 00       	push   $0x1000
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+  80158d:	e8 0a f8 ff ff       	call   800d9c <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801592:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801599:	56                   	push   %esi
+  80159a:	6a 00                	push   $0x0
+  80159c:	53                   	push   %ebx
+  80159d:	6a 00                	push   $0x0
+  80159f:	e8 bf fa ff ff       	call   801063 <sys_page_map>
+  8015a4:	83 c4 20             	add    $0x20,%esp
+  8015a7:	85 c0                	test   %eax,%eax
+  8015a9:	78 3c                	js     8015e7 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8015ab:	83 ec 08             	sub    $0x8,%esp
+  8015ae:	53                   	push   %ebx
+  8015af:	6a 00                	push   $0x0
+  8015b1:	e8 ef fa ff ff       	call   8010a5 <sys_page_unmap>
+  8015b6:	83 c4 10             	add    $0x10,%esp
+  8015b9:	85 c0                	test   %eax,%eax
+  8015bb:	78 3c                	js     8015f9 <pgfault+0x13c>
+	if(m)
+  8015bd:	85 ff                	test   %edi,%edi
+  8015bf:	74 0c                	je     8015cd <pgfault+0x110>
+		mutex_unlock(m);
+  8015c1:	83 ec 0c             	sub    $0xc,%esp
+  8015c4:	57                   	push   %edi
+  8015c5:	e8 14 29 00 00       	call   803ede <mutex_unlock>
+  8015ca:	83 c4 10             	add    $0x10,%esp
+}
+  8015cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d0:	5b                   	pop    %ebx
+  8015d1:	5e                   	pop    %esi
+  8015d2:	5f                   	pop    %edi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8015d5:	50                   	push   %eax
+  8015d6:	68 3f 4d 80 00       	push   $0x804d3f
+  8015db:	6a 3d                	push   $0x3d
+  8015dd:	68 34 4d 80 00       	push   $0x804d34
+  8015e2:	e8 33 ee ff ff       	call   80041a <_panic>
+		panic("sys_page_map: %e", ret);
+  8015e7:	50                   	push   %eax
+  8015e8:	68 52 4d 80 00       	push   $0x804d52
+  8015ed:	6a 40                	push   $0x40
+  8015ef:	68 34 4d 80 00       	push   $0x804d34
+  8015f4:	e8 21 ee ff ff       	call   80041a <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8015f9:	50                   	push   %eax
+  8015fa:	68 63 4d 80 00       	push   $0x804d63
+  8015ff:	6a 42                	push   $0x42
+  801601:	68 34 4d 80 00       	push   $0x804d34
+  801606:	e8 0f ee ff ff       	call   80041a <_panic>
+
+0080160b <thread_main>:
+{
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801611:	ff 75 0c             	push   0xc(%ebp)
+  801614:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801617:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80161e:	e8 7e f9 ff ff       	call   800fa1 <sys_env_destroy>
+}
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	c9                   	leave
+  801627:	c3                   	ret
+
+00801628 <fork>:
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	57                   	push   %edi
+  80162c:	56                   	push   %esi
+  80162d:	53                   	push   %ebx
+  80162e:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801631:	68 bd 14 80 00       	push   $0x8014bd
+  801636:	e8 81 2b 00 00       	call   8041bc <set_pgfault_handler>
+	if(sforked)
+  80163b:	83 c4 10             	add    $0x10,%esp
+  80163e:	83 3d 80 6e 80 00 00 	cmpl   $0x0,0x806e80
+  801645:	75 33                	jne    80167a <fork+0x52>
+	__asm __volatile("int %2"
+  801647:	b8 07 00 00 00       	mov    $0x7,%eax
+  80164c:	cd 30                	int    $0x30
+  80164e:	89 c7                	mov    %eax,%edi
+  801650:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801652:	85 c0                	test   %eax,%eax
+  801654:	0f 88 b4 00 00 00    	js     80170e <fork+0xe6>
+	if(envid == 0) {
+  80165a:	0f 84 c3 00 00 00    	je     801723 <fork+0xfb>
+	pgbatch_init(&pb);
+  801660:	83 ec 0c             	sub    $0xc,%esp
+  801663:	68 20 63 80 00       	push   $0x806320
+  801668:	e8 4f 26 00 00       	call   803cbc <pgbatch_init>
+  80166d:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801670:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801675:	e9 9c 01 00 00       	jmp    801816 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  80167d:	68 c0 66 80 00       	push   $0x8066c0
+  801682:	e8 e9 27 00 00       	call   803e70 <mutex_lock>
+  801687:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80168a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80168f:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801694:	eb 08                	jmp    80169e <fork+0x76>
+  801696:	83 c3 01             	add    $0x1,%ebx
+  801699:	83 fb 20             	cmp    $0x20,%ebx
+  80169c:	74 5b                	je     8016f9 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  80169e:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8016a5:	89 f0                	mov    %esi,%eax
+  8016a7:	e8 d7 fd ff ff       	call   801483 <thread_alive>
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	74 e6                	je     801696 <fork+0x6e>
+  8016b0:	89 e0                	mov    %esp,%eax
+  8016b2:	89 fa                	mov    %edi,%edx
+  8016b4:	29 c2                	sub    %eax,%edx
+  8016b6:	89 d0                	mov    %edx,%eax
+  8016b8:	c1 e8 0f             	shr    $0xf,%eax
+  8016bb:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8016c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c6:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8016c9:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8016d0:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8016d3:	83 ec 08             	sub    $0x8,%esp
+  8016d6:	50                   	push   %eax
+  8016d7:	56                   	push   %esi
+  8016d8:	e8 8e fa ff ff       	call   80116b <sys_env_set_pgfault_upcall>
+  8016dd:	83 c4 10             	add    $0x10,%esp
+  8016e0:	85 c0                	test   %eax,%eax
+  8016e2:	79 b2                	jns    801696 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8016e4:	50                   	push   %eax
+  8016e5:	68 f0 4d 80 00       	push   $0x804df0
+  8016ea:	68 00 01 00 00       	push   $0x100
+  8016ef:	68 34 4d 80 00       	push   $0x804d34
+  8016f4:	e8 21 ed ff ff       	call   80041a <_panic>
+	mutex_unlock(&sfork_lock);
+  8016f9:	83 ec 0c             	sub    $0xc,%esp
+  8016fc:	68 c0 66 80 00       	push   $0x8066c0
+  801701:	e8 d8 27 00 00       	call   803ede <mutex_unlock>
+}
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	e9 39 ff ff ff       	jmp    801647 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  80170e:	50                   	push   %eax
+  80170f:	68 76 4d 80 00       	push   $0x804d76
+  801714:	68 91 00 00 00       	push   $0x91
+  801719:	68 34 4d 80 00       	push   $0x804d34
+  80171e:	e8 f7 ec ff ff       	call   80041a <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801723:	e8 ba f8 ff ff       	call   800fe2 <sys_getenvid>
+  801728:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80172d:	89 e1                	mov    %esp,%ecx
+  80172f:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801734:	29 ca                	sub    %ecx,%edx
+  801736:	89 d1                	mov    %edx,%ecx
+  801738:	c1 e9 0f             	shr    $0xf,%ecx
+  80173b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801741:	ba 00 00 00 00       	mov    $0x0,%edx
+  801746:	0f 42 d1             	cmovb  %ecx,%edx
+  801749:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80174f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801754:	89 04 95 00 6e 80 00 	mov    %eax,0x806e00(,%edx,4)
+		if(sforked)
+  80175b:	a1 80 6e 80 00       	mov    0x806e80,%eax
+  801760:	85 c0                	test   %eax,%eax
+  801762:	75 07                	jne    80176b <fork+0x143>
+		return 0;
+  801764:	89 c6                	mov    %eax,%esi
+  801766:	e9 6f 02 00 00       	jmp    8019da <fork+0x3b2>
+  80176b:	89 e2                	mov    %esp,%edx
+  80176d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801772:	29 d0                	sub    %edx,%eax
+  801774:	89 c3                	mov    %eax,%ebx
+  801776:	c1 eb 0f             	shr    $0xf,%ebx
+  801779:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80177e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801783:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  801786:	83 ec 04             	sub    $0x4,%esp
+  801789:	68 80 00 00 00       	push   $0x80
+  80178e:	6a 00                	push   $0x0
+  801790:	68 40 66 80 00       	push   $0x806640
+  801795:	e8 cd f5 ff ff       	call   800d67 <memset>
+	thread_ids[slot] = sys_getenvid();
+  80179a:	e8 43 f8 ff ff       	call   800fe2 <sys_getenvid>
+  80179f:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8017a6:	8b 04 9d 00 6e 80 00 	mov    0x806e00(,%ebx,4),%eax
+  8017ad:	a3 00 6e 80 00       	mov    %eax,0x806e00
+	mutex_init(&sfork_lock);
+  8017b2:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8017b9:	e8 a4 26 00 00       	call   803e62 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8017be:	83 c4 0c             	add    $0xc,%esp
+  8017c1:	68 07 04 00 00       	push   $0x407
+  8017c6:	68 00 00 00 e1       	push   $0xe1000000
+  8017cb:	6a 00                	push   $0x0
+  8017cd:	e8 4e f8 ff ff       	call   801020 <sys_page_alloc>
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	0f 89 fd 01 00 00    	jns    8019da <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8017dd:	50                   	push   %eax
+  8017de:	68 3f 4d 80 00       	push   $0x804d3f
+  8017e3:	68 12 01 00 00       	push   $0x112
+  8017e8:	68 34 4d 80 00       	push   $0x804d34
+  8017ed:	e8 28 ec ff ff       	call   80041a <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8017f2:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8017f8:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8017fe:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801804:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80180a:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801810:	0f 87 4f 01 00 00    	ja     801965 <fork+0x33d>
+		pd = PDX(addr);
+  801816:	89 d8                	mov    %ebx,%eax
+  801818:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80181b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801822:	f6 c2 01             	test   $0x1,%dl
+  801825:	74 cb                	je     8017f2 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801827:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80182c:	0f 85 92 00 00 00    	jne    8018c4 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801832:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  801838:	76 10                	jbe    80184a <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80183a:	89 d8                	mov    %ebx,%eax
+  80183c:	f7 d8                	neg    %eax
+  80183e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801843:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801848:	74 ba                	je     801804 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80184a:	89 d8                	mov    %ebx,%eax
+  80184c:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80184f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801856:	f6 c2 01             	test   $0x1,%dl
+  801859:	74 a9                	je     801804 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80185b:	89 c1                	mov    %eax,%ecx
+  80185d:	c1 e1 0c             	shl    $0xc,%ecx
+  801860:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801863:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80186a:	f6 c6 04             	test   $0x4,%dh
+  80186d:	0f 85 8e 00 00 00    	jne    801901 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801873:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80187a:	f6 c6 08             	test   $0x8,%dh
+  80187d:	75 0f                	jne    80188e <fork+0x266>
+  80187f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801886:	a8 02                	test   $0x2,%al
+  801888:	0f 84 bb 00 00 00    	je     801949 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  80188e:	83 ec 08             	sub    $0x8,%esp
+  801891:	68 05 08 00 00       	push   $0x805
+  801896:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801899:	50                   	push   %eax
+  80189a:	56                   	push   %esi
+  80189b:	50                   	push   %eax
+  80189c:	6a 00                	push   $0x0
+  80189e:	68 20 63 80 00       	push   $0x806320
+  8018a3:	e8 d2 24 00 00       	call   803d7a <pgbatch_map>
+  8018a8:	83 c4 20             	add    $0x20,%esp
+  8018ab:	85 c0                	test   %eax,%eax
+  8018ad:	79 76                	jns    801925 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8018af:	50                   	push   %eax
+  8018b0:	68 9a 4d 80 00       	push   $0x804d9a
+  8018b5:	68 bc 00 00 00       	push   $0xbc
+  8018ba:	68 34 4d 80 00       	push   $0x804d34
+  8018bf:	e8 56 eb ff ff       	call   80041a <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8018c4:	83 ec 0c             	sub    $0xc,%esp
+  8018c7:	68 00 08 00 00       	push   $0x800
+  8018cc:	56                   	push   %esi
+  8018cd:	53                   	push   %ebx
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	68 20 63 80 00       	push   $0x806320
+  8018d5:	e8 4b 25 00 00       	call   803e25 <pgbatch_sharept>
+  8018da:	83 c4 20             	add    $0x20,%esp
+  8018dd:	85 c0                	test   %eax,%eax
+  8018df:	78 0b                	js     8018ec <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8018e1:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8018e7:	e9 18 ff ff ff       	jmp    801804 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8018ec:	50                   	push   %eax
+  8018ed:	68 86 4d 80 00       	push   $0x804d86
+  8018f2:	68 b2 00 00 00       	push   $0xb2
+  8018f7:	68 34 4d 80 00       	push   $0x804d34
+  8018fc:	e8 19 eb ff ff       	call   80041a <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801901:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801908:	83 ec 08             	sub    $0x8,%esp
+  80190b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801910:	50                   	push   %eax
+  801911:	51                   	push   %ecx
+  801912:	56                   	push   %esi
+  801913:	51                   	push   %ecx
+  801914:	6a 00                	push   $0x0
+  801916:	68 20 63 80 00       	push   $0x806320
+  80191b:	e8 5a 24 00 00       	call   803d7a <pgbatch_map>
+  801920:	83 c4 20             	add    $0x20,%esp
+  801923:	eb 17                	jmp    80193c <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801925:	68 05 08 00 00       	push   $0x805
+  80192a:	ff 75 e4             	push   -0x1c(%ebp)
+  80192d:	6a 00                	push   $0x0
+  80192f:	68 20 63 80 00       	push   $0x806320
+  801934:	e8 b5 24 00 00       	call   803dee <pgbatch_protect>
+  801939:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	0f 89 c0 fe ff ff    	jns    801804 <fork+0x1dc>
+  801944:	e9 66 ff ff ff       	jmp    8018af <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801949:	83 ec 08             	sub    $0x8,%esp
+  80194c:	6a 05                	push   $0x5
+  80194e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801951:	50                   	push   %eax
+  801952:	56                   	push   %esi
+  801953:	50                   	push   %eax
+  801954:	6a 00                	push   $0x0
+  801956:	68 20 63 80 00       	push   $0x806320
+  80195b:	e8 1a 24 00 00       	call   803d7a <pgbatch_map>
+  801960:	83 c4 20             	add    $0x20,%esp
+  801963:	eb d7                	jmp    80193c <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801965:	6a 07                	push   $0x7
+  801967:	68 00 f0 bf ee       	push   $0xeebff000
+  80196c:	57                   	push   %edi
+  80196d:	68 20 63 80 00       	push   $0x806320
+  801972:	e8 cc 23 00 00       	call   803d43 <pgbatch_alloc>
+  801977:	83 c4 10             	add    $0x10,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 66                	js     8019e4 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  80197e:	83 ec 0c             	sub    $0xc,%esp
+  801981:	68 20 63 80 00       	push   $0x806320
+  801986:	e8 3f 23 00 00       	call   803cca <pgbatch_flush>
+  80198b:	83 c4 10             	add    $0x10,%esp
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 52                	js     8019e4 <fork+0x3bc>
+  801992:	89 e2                	mov    %esp,%edx
+  801994:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801999:	29 d0                	sub    %edx,%eax
+  80199b:	89 c2                	mov    %eax,%edx
+  80199d:	c1 ea 0f             	shr    $0xf,%edx
+  8019a0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019aa:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8019ad:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8019b4:	8b 40 78             	mov    0x78(%eax),%eax
+  8019b7:	83 ec 08             	sub    $0x8,%esp
+  8019ba:	50                   	push   %eax
+  8019bb:	57                   	push   %edi
+  8019bc:	e8 aa f7 ff ff       	call   80116b <sys_env_set_pgfault_upcall>
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	78 31                	js     8019f9 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	6a 02                	push   $0x2
+  8019cd:	57                   	push   %edi
+  8019ce:	e8 14 f7 ff ff       	call   8010e7 <sys_env_set_status>
+  8019d3:	83 c4 10             	add    $0x10,%esp
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	78 34                	js     801a0e <fork+0x3e6>
+}
+  8019da:	89 f0                	mov    %esi,%eax
+  8019dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5f                   	pop    %edi
+  8019e2:	5d                   	pop    %ebp
+  8019e3:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8019e4:	50                   	push   %eax
+  8019e5:	68 a6 4d 80 00       	push   $0x804da6
+  8019ea:	68 c0 00 00 00       	push   $0xc0
+  8019ef:	68 34 4d 80 00       	push   $0x804d34
+  8019f4:	e8 21 ea ff ff       	call   80041a <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8019f9:	50                   	push   %eax
+  8019fa:	68 bb 4d 80 00       	push   $0x804dbb
+  8019ff:	68 c2 00 00 00       	push   $0xc2
+  801a04:	68 34 4d 80 00       	push   $0x804d34
+  801a09:	e8 0c ea ff ff       	call   80041a <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801a0e:	50                   	push   %eax
+  801a0f:	68 d6 4d 80 00       	push   $0x804dd6
+  801a14:	68 c4 00 00 00       	push   $0xc4
+  801a19:	68 34 4d 80 00       	push   $0x804d34
+  801a1e:	e8 f7 e9 ff ff       	call   80041a <_panic>
+
+00801a23 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801a23:	55                   	push   %ebp
+  801a24:	89 e5                	mov    %esp,%ebp
+  801a26:	57                   	push   %edi
+  801a27:	56                   	push   %esi
+  801a28:	53                   	push   %ebx
+  801a29:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801a2c:	68 c0 66 80 00       	push   $0x8066c0
+  801a31:	e8 3a 24 00 00       	call   803e70 <mutex_lock>
+  801a36:	89 e2                	mov    %esp,%edx
+  801a38:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a3d:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801a3f:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801a42:	89 c3                	mov    %eax,%ebx
+  801a44:	c1 eb 0f             	shr    $0xf,%ebx
+  801a47:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a51:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801a54:	e8 89 f5 ff ff       	call   800fe2 <sys_getenvid>
+  801a59:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801a60:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801a65:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801a6c:	e8 12 fa ff ff       	call   801483 <thread_alive>
+  801a71:	85 c0                	test   %eax,%eax
+  801a73:	74 24                	je     801a99 <sfork+0x76>
+  801a75:	83 c3 01             	add    $0x1,%ebx
+  801a78:	83 fb 20             	cmp    $0x20,%ebx
+  801a7b:	75 e8                	jne    801a65 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801a7d:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	68 c0 66 80 00       	push   $0x8066c0
+  801a8a:	e8 4f 24 00 00       	call   803ede <mutex_unlock>
+	return r;
+}
+  801a8f:	89 f0                	mov    %esi,%eax
+  801a91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a94:	5b                   	pop    %ebx
+  801a95:	5e                   	pop    %esi
+  801a96:	5f                   	pop    %edi
+  801a97:	5d                   	pop    %ebp
+  801a98:	c3                   	ret
+	if (i == NTHREADS) {
+  801a99:	83 fb 20             	cmp    $0x20,%ebx
+  801a9c:	0f 84 53 01 00 00    	je     801bf5 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801aa2:	89 d8                	mov    %ebx,%eax
+  801aa4:	c1 e0 0f             	shl    $0xf,%eax
+  801aa7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801aaa:	83 ec 0c             	sub    $0xc,%esp
+  801aad:	68 00 60 80 00       	push   $0x806000
+  801ab2:	e8 05 22 00 00       	call   803cbc <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	83 3d 80 6e 80 00 00 	cmpl   $0x0,0x806e80
+  801ac1:	75 1f                	jne    801ae2 <sfork+0xbf>
+  801ac3:	68 07 04 00 00       	push   $0x407
+  801ac8:	68 00 00 00 e1       	push   $0xe1000000
+  801acd:	6a 00                	push   $0x0
+  801acf:	68 00 60 80 00       	push   $0x806000
+  801ad4:	e8 6a 22 00 00       	call   803d43 <pgbatch_alloc>
+  801ad9:	89 c6                	mov    %eax,%esi
+  801adb:	83 c4 10             	add    $0x10,%esp
+  801ade:	85 c0                	test   %eax,%eax
+  801ae0:	78 a0                	js     801a82 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801ae2:	6a 07                	push   $0x7
+  801ae4:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801ae9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801aec:	29 c8                	sub    %ecx,%eax
+  801aee:	50                   	push   %eax
+  801aef:	6a 00                	push   $0x0
+  801af1:	68 00 60 80 00       	push   $0x806000
+  801af6:	e8 48 22 00 00       	call   803d43 <pgbatch_alloc>
+  801afb:	89 c6                	mov    %eax,%esi
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	0f 88 7a ff ff ff    	js     801a82 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801b08:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801b0d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b10:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b12:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801b17:	29 c8                	sub    %ecx,%eax
+  801b19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801b1c:	39 c7                	cmp    %eax,%edi
+  801b1e:	73 29                	jae    801b49 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801b20:	6a 07                	push   $0x7
+  801b22:	57                   	push   %edi
+  801b23:	6a 00                	push   $0x0
+  801b25:	68 00 60 80 00       	push   $0x806000
+  801b2a:	e8 14 22 00 00       	call   803d43 <pgbatch_alloc>
+  801b2f:	89 c6                	mov    %eax,%esi
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	0f 88 46 ff ff ff    	js     801a82 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b3c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801b42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b45:	39 c7                	cmp    %eax,%edi
+  801b47:	72 d7                	jb     801b20 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801b49:	83 ec 0c             	sub    $0xc,%esp
+  801b4c:	68 00 60 80 00       	push   $0x806000
+  801b51:	e8 74 21 00 00       	call   803cca <pgbatch_flush>
+  801b56:	89 c6                	mov    %eax,%esi
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	0f 88 1f ff ff ff    	js     801a82 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801b63:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801b68:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b6b:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801b6d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801b73:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b76:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801b79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b7c:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b7f:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801b82:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b87:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b89:	52                   	push   %edx
+  801b8a:	50                   	push   %eax
+  801b8b:	68 0b 16 80 00       	push   $0x80160b
+  801b90:	e8 cc f8 ff ff       	call   801461 <sys_exofork_shared>
+  801b95:	89 c6                	mov    %eax,%esi
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	0f 88 e0 fe ff ff    	js     801a82 <sfork+0x5f>
+	thread_ids[i] = id;
+  801ba2:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801ba9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801bae:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801bb4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801bb9:	89 04 9d 00 6e 80 00 	mov    %eax,0x806e00(,%ebx,4)
+	sforked = 1;
+  801bc0:	c7 05 80 6e 80 00 01 	movl   $0x1,0x806e80
+  801bc7:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801bca:	83 ec 08             	sub    $0x8,%esp
+  801bcd:	6a 02                	push   $0x2
+  801bcf:	56                   	push   %esi
+  801bd0:	e8 12 f5 ff ff       	call   8010e7 <sys_env_set_status>
+  801bd5:	89 c3                	mov    %eax,%ebx
+  801bd7:	83 c4 10             	add    $0x10,%esp
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	0f 89 a0 fe ff ff    	jns    801a82 <sfork+0x5f>
+		sys_env_destroy(id);
+  801be2:	83 ec 0c             	sub    $0xc,%esp
+  801be5:	56                   	push   %esi
+  801be6:	e8 b6 f3 ff ff       	call   800fa1 <sys_env_destroy>
+		goto out;
+  801beb:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801bee:	89 de                	mov    %ebx,%esi
+		goto out;
+  801bf0:	e9 8d fe ff ff       	jmp    801a82 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801bf5:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801bfa:	e9 83 fe ff ff       	jmp    801a82 <sfork+0x5f>
+
+00801bff <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c05:	05 00 00 00 30       	add    $0x30000000,%eax
+  801c0a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+
+00801c0f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801c0f:	55                   	push   %ebp
+  801c10:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c12:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c15:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c1a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c1f:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801c24:	5d                   	pop    %ebp
+  801c25:	c3                   	ret
+
+00801c26 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c2e:	89 c2                	mov    %eax,%edx
+  801c30:	c1 ea 16             	shr    $0x16,%edx
+  801c33:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c3a:	f6 c2 01             	test   $0x1,%dl
+  801c3d:	74 29                	je     801c68 <fd_alloc+0x42>
+  801c3f:	89 c2                	mov    %eax,%edx
+  801c41:	c1 ea 0c             	shr    $0xc,%edx
+  801c44:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c4b:	f6 c2 01             	test   $0x1,%dl
+  801c4e:	74 18                	je     801c68 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801c50:	05 00 10 00 00       	add    $0x1000,%eax
+  801c55:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801c5a:	75 d2                	jne    801c2e <fd_alloc+0x8>
+  801c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c61:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c66:	eb 05                	jmp    801c6d <fd_alloc+0x47>
+			return 0;
+  801c68:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c70:	89 02                	mov    %eax,(%edx)
+}
+  801c72:	89 c8                	mov    %ecx,%eax
+  801c74:	5d                   	pop    %ebp
+  801c75:	c3                   	ret
+
+00801c76 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c76:	55                   	push   %ebp
+  801c77:	89 e5                	mov    %esp,%ebp
+  801c79:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c7c:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801c81:	77 30                	ja     801cb3 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c83:	c1 e0 0c             	shl    $0xc,%eax
+  801c86:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801c8b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c91:	f6 c2 01             	test   $0x1,%dl
+  801c94:	74 24                	je     801cba <fd_lookup+0x44>
+  801c96:	89 c2                	mov    %eax,%edx
+  801c98:	c1 ea 0c             	shr    $0xc,%edx
+  801c9b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ca2:	f6 c2 01             	test   $0x1,%dl
+  801ca5:	74 1a                	je     801cc1 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801ca7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801caa:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801cac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cb1:	5d                   	pop    %ebp
+  801cb2:	c3                   	ret
+		return -E_INVAL;
+  801cb3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb8:	eb f7                	jmp    801cb1 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801cba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cbf:	eb f0                	jmp    801cb1 <fd_lookup+0x3b>
+  801cc1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cc6:	eb e9                	jmp    801cb1 <fd_lookup+0x3b>
+
+00801cc8 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	53                   	push   %ebx
+  801ccc:	83 ec 04             	sub    $0x4,%esp
+  801ccf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd7:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801cdc:	39 13                	cmp    %edx,(%ebx)
+  801cde:	74 54                	je     801d34 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801ce0:	83 c0 01             	add    $0x1,%eax
+  801ce3:	8b 1c 85 8c 4e 80 00 	mov    0x804e8c(,%eax,4),%ebx
+  801cea:	85 db                	test   %ebx,%ebx
+  801cec:	75 ee                	jne    801cdc <dev_lookup+0x14>
+  801cee:	89 e1                	mov    %esp,%ecx
+  801cf0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cf5:	29 c8                	sub    %ecx,%eax
+  801cf7:	89 c1                	mov    %eax,%ecx
+  801cf9:	c1 e9 0f             	shr    $0xf,%ecx
+  801cfc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d06:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d09:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  801d10:	8b 40 48             	mov    0x48(%eax),%eax
+  801d13:	83 ec 04             	sub    $0x4,%esp
+  801d16:	52                   	push   %edx
+  801d17:	50                   	push   %eax
+  801d18:	68 10 4e 80 00       	push   $0x804e10
+  801d1d:	e8 d3 e7 ff ff       	call   8004f5 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801d2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d2d:	89 1a                	mov    %ebx,(%edx)
+}
+  801d2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d32:	c9                   	leave
+  801d33:	c3                   	ret
+			return 0;
+  801d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d39:	eb ef                	jmp    801d2a <dev_lookup+0x62>
+
+00801d3b <fd_close>:
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	57                   	push   %edi
+  801d3f:	56                   	push   %esi
+  801d40:	53                   	push   %ebx
+  801d41:	83 ec 24             	sub    $0x24,%esp
+  801d44:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d47:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d4a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d4d:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d4e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d54:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d57:	50                   	push   %eax
+  801d58:	e8 19 ff ff ff       	call   801c76 <fd_lookup>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 05                	js     801d6b <fd_close+0x30>
+	    || fd != fd2)
+  801d66:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d69:	74 0f                	je     801d7a <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801d6b:	85 ff                	test   %edi,%edi
+  801d6d:	0f 44 df             	cmove  %edi,%ebx
+}
+  801d70:	89 d8                	mov    %ebx,%eax
+  801d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d75:	5b                   	pop    %ebx
+  801d76:	5e                   	pop    %esi
+  801d77:	5f                   	pop    %edi
+  801d78:	5d                   	pop    %ebp
+  801d79:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d80:	50                   	push   %eax
+  801d81:	ff 36                	push   (%esi)
+  801d83:	e8 40 ff ff ff       	call   801cc8 <dev_lookup>
+  801d88:	89 c3                	mov    %eax,%ebx
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 1a                	js     801dab <fd_close+0x70>
+		if (dev->dev_close)
+  801d91:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d94:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d97:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	74 0b                	je     801dab <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801da0:	83 ec 0c             	sub    $0xc,%esp
+  801da3:	56                   	push   %esi
+  801da4:	ff d0                	call   *%eax
+  801da6:	89 c3                	mov    %eax,%ebx
+  801da8:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	56                   	push   %esi
+  801daf:	6a 00                	push   $0x0
+  801db1:	e8 ef f2 ff ff       	call   8010a5 <sys_page_unmap>
+	return r;
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	eb b5                	jmp    801d70 <fd_close+0x35>
+
+00801dbb <close>:
+
+int
+close(int fdnum)
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801dc1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc4:	50                   	push   %eax
+  801dc5:	ff 75 08             	push   0x8(%ebp)
+  801dc8:	e8 a9 fe ff ff       	call   801c76 <fd_lookup>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	79 02                	jns    801dd6 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801dd4:	c9                   	leave
+  801dd5:	c3                   	ret
+		return fd_close(fd, 1);
+  801dd6:	83 ec 08             	sub    $0x8,%esp
+  801dd9:	6a 01                	push   $0x1
+  801ddb:	ff 75 f4             	push   -0xc(%ebp)
+  801dde:	e8 58 ff ff ff       	call   801d3b <fd_close>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	eb ec                	jmp    801dd4 <close+0x19>
+
+00801de8 <close_all>:
+
+void
+close_all(void)
+{
+  801de8:	55                   	push   %ebp
+  801de9:	89 e5                	mov    %esp,%ebp
+  801deb:	53                   	push   %ebx
+  801dec:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801def:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+  801df7:	53                   	push   %ebx
+  801df8:	e8 be ff ff ff       	call   801dbb <close>
+	for (i = 0; i < MAXFD; i++)
+  801dfd:	83 c3 01             	add    $0x1,%ebx
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801e09:	75 e9                	jne    801df4 <close_all+0xc>
+}
+  801e0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e0e:	c9                   	leave
+  801e0f:	c3                   	ret
+
+00801e10 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801e10:	55                   	push   %ebp
+  801e11:	89 e5                	mov    %esp,%ebp
+  801e13:	57                   	push   %edi
+  801e14:	56                   	push   %esi
+  801e15:	53                   	push   %ebx
+  801e16:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801e19:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e1c:	50                   	push   %eax
+  801e1d:	ff 75 08             	push   0x8(%ebp)
+  801e20:	e8 51 fe ff ff       	call   801c76 <fd_lookup>
+  801e25:	89 c3                	mov    %eax,%ebx
+  801e27:	83 c4 10             	add    $0x10,%esp
+  801e2a:	85 c0                	test   %eax,%eax
+  801e2c:	78 7f                	js     801ead <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	ff 75 0c             	push   0xc(%ebp)
+  801e34:	e8 82 ff ff ff       	call   801dbb <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e39:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e3c:	c1 e6 0c             	shl    $0xc,%esi
+  801e3f:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e45:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e48:	89 3c 24             	mov    %edi,(%esp)
+  801e4b:	e8 bf fd ff ff       	call   801c0f <fd2data>
+  801e50:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e52:	89 34 24             	mov    %esi,(%esp)
+  801e55:	e8 b5 fd ff ff       	call   801c0f <fd2data>
+  801e5a:	83 c4 10             	add    $0x10,%esp
+  801e5d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801e60:	89 d8                	mov    %ebx,%eax
+  801e62:	c1 e8 16             	shr    $0x16,%eax
+  801e65:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e6c:	a8 01                	test   $0x1,%al
+  801e6e:	74 11                	je     801e81 <dup+0x71>
+  801e70:	89 d8                	mov    %ebx,%eax
+  801e72:	c1 e8 0c             	shr    $0xc,%eax
+  801e75:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e7c:	f6 c2 01             	test   $0x1,%dl
+  801e7f:	75 36                	jne    801eb7 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e81:	89 f8                	mov    %edi,%eax
+  801e83:	c1 e8 0c             	shr    $0xc,%eax
+  801e86:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e8d:	83 ec 0c             	sub    $0xc,%esp
+  801e90:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e95:	50                   	push   %eax
+  801e96:	56                   	push   %esi
+  801e97:	6a 00                	push   $0x0
+  801e99:	57                   	push   %edi
+  801e9a:	6a 00                	push   $0x0
+  801e9c:	e8 c2 f1 ff ff       	call   801063 <sys_page_map>
+  801ea1:	89 c3                	mov    %eax,%ebx
+  801ea3:	83 c4 20             	add    $0x20,%esp
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 33                	js     801edd <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801eaa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801ead:	89 d8                	mov    %ebx,%eax
+  801eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb2:	5b                   	pop    %ebx
+  801eb3:	5e                   	pop    %esi
+  801eb4:	5f                   	pop    %edi
+  801eb5:	5d                   	pop    %ebp
+  801eb6:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801eb7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ec6:	50                   	push   %eax
+  801ec7:	ff 75 d4             	push   -0x2c(%ebp)
+  801eca:	6a 00                	push   $0x0
+  801ecc:	53                   	push   %ebx
+  801ecd:	6a 00                	push   $0x0
+  801ecf:	e8 8f f1 ff ff       	call   801063 <sys_page_map>
+  801ed4:	89 c3                	mov    %eax,%ebx
+  801ed6:	83 c4 20             	add    $0x20,%esp
+  801ed9:	85 c0                	test   %eax,%eax
+  801edb:	79 a4                	jns    801e81 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801edd:	83 ec 08             	sub    $0x8,%esp
+  801ee0:	56                   	push   %esi
+  801ee1:	6a 00                	push   $0x0
+  801ee3:	e8 bd f1 ff ff       	call   8010a5 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ee8:	83 c4 08             	add    $0x8,%esp
+  801eeb:	ff 75 d4             	push   -0x2c(%ebp)
+  801eee:	6a 00                	push   $0x0
+  801ef0:	e8 b0 f1 ff ff       	call   8010a5 <sys_page_unmap>
+	return r;
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	eb b3                	jmp    801ead <dup+0x9d>
+
+00801efa <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801efa:	55                   	push   %ebp
+  801efb:	89 e5                	mov    %esp,%ebp
+  801efd:	56                   	push   %esi
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 18             	sub    $0x18,%esp
+  801f02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f05:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f08:	50                   	push   %eax
+  801f09:	53                   	push   %ebx
+  801f0a:	e8 67 fd ff ff       	call   801c76 <fd_lookup>
+  801f0f:	83 c4 10             	add    $0x10,%esp
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 3c                	js     801f52 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f16:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f19:	83 ec 08             	sub    $0x8,%esp
+  801f1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f1f:	50                   	push   %eax
+  801f20:	ff 36                	push   (%esi)
+  801f22:	e8 a1 fd ff ff       	call   801cc8 <dev_lookup>
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	85 c0                	test   %eax,%eax
+  801f2c:	78 24                	js     801f52 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f2e:	8b 46 08             	mov    0x8(%esi),%eax
+  801f31:	83 e0 03             	and    $0x3,%eax
+  801f34:	83 f8 01             	cmp    $0x1,%eax
+  801f37:	74 20                	je     801f59 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3c:	8b 40 08             	mov    0x8(%eax),%eax
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	74 54                	je     801f97 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f43:	83 ec 04             	sub    $0x4,%esp
+  801f46:	ff 75 10             	push   0x10(%ebp)
+  801f49:	ff 75 0c             	push   0xc(%ebp)
+  801f4c:	56                   	push   %esi
+  801f4d:	ff d0                	call   *%eax
+  801f4f:	83 c4 10             	add    $0x10,%esp
+}
+  801f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f55:	5b                   	pop    %ebx
+  801f56:	5e                   	pop    %esi
+  801f57:	5d                   	pop    %ebp
+  801f58:	c3                   	ret
+  801f59:	89 e2                	mov    %esp,%edx
+  801f5b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f60:	29 d0                	sub    %edx,%eax
+  801f62:	89 c2                	mov    %eax,%edx
+  801f64:	c1 ea 0f             	shr    $0xf,%edx
+  801f67:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f71:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f74:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  801f7b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f7e:	83 ec 04             	sub    $0x4,%esp
+  801f81:	53                   	push   %ebx
+  801f82:	50                   	push   %eax
+  801f83:	68 51 4e 80 00       	push   $0x804e51
+  801f88:	e8 68 e5 ff ff       	call   8004f5 <cprintf>
+		return -E_INVAL;
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f95:	eb bb                	jmp    801f52 <read+0x58>
+		return -E_NOT_SUPP;
+  801f97:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f9c:	eb b4                	jmp    801f52 <read+0x58>
+
+00801f9e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	57                   	push   %edi
+  801fa2:	56                   	push   %esi
+  801fa3:	53                   	push   %ebx
+  801fa4:	83 ec 0c             	sub    $0xc,%esp
+  801fa7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801faa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801fad:	85 f6                	test   %esi,%esi
+  801faf:	74 30                	je     801fe1 <readn+0x43>
+  801fb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801fbb:	83 ec 04             	sub    $0x4,%esp
+  801fbe:	89 f2                	mov    %esi,%edx
+  801fc0:	29 c2                	sub    %eax,%edx
+  801fc2:	52                   	push   %edx
+  801fc3:	01 f8                	add    %edi,%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	ff 75 08             	push   0x8(%ebp)
+  801fc9:	e8 2c ff ff ff       	call   801efa <read>
+		if (m < 0)
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 15                	js     801fea <readn+0x4c>
+			return m;
+		if (m == 0)
+  801fd5:	74 11                	je     801fe8 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801fd7:	01 c3                	add    %eax,%ebx
+  801fd9:	89 d8                	mov    %ebx,%eax
+  801fdb:	39 f3                	cmp    %esi,%ebx
+  801fdd:	72 dc                	jb     801fbb <readn+0x1d>
+  801fdf:	eb 09                	jmp    801fea <readn+0x4c>
+  801fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe6:	eb 02                	jmp    801fea <readn+0x4c>
+  801fe8:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fed:	5b                   	pop    %ebx
+  801fee:	5e                   	pop    %esi
+  801fef:	5f                   	pop    %edi
+  801ff0:	5d                   	pop    %ebp
+  801ff1:	c3                   	ret
+
+00801ff2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ff2:	55                   	push   %ebp
+  801ff3:	89 e5                	mov    %esp,%ebp
+  801ff5:	56                   	push   %esi
+  801ff6:	53                   	push   %ebx
+  801ff7:	83 ec 18             	sub    $0x18,%esp
+  801ffa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ffd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802000:	50                   	push   %eax
+  802001:	53                   	push   %ebx
+  802002:	e8 6f fc ff ff       	call   801c76 <fd_lookup>
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	78 37                	js     802045 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80200e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802011:	83 ec 08             	sub    $0x8,%esp
+  802014:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802017:	50                   	push   %eax
+  802018:	ff 36                	push   (%esi)
+  80201a:	e8 a9 fc ff ff       	call   801cc8 <dev_lookup>
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 1f                	js     802045 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802026:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80202a:	74 20                	je     80204c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80202c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80202f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802032:	85 c0                	test   %eax,%eax
+  802034:	74 54                	je     80208a <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802036:	83 ec 04             	sub    $0x4,%esp
+  802039:	ff 75 10             	push   0x10(%ebp)
+  80203c:	ff 75 0c             	push   0xc(%ebp)
+  80203f:	56                   	push   %esi
+  802040:	ff d0                	call   *%eax
+  802042:	83 c4 10             	add    $0x10,%esp
+}
+  802045:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802048:	5b                   	pop    %ebx
+  802049:	5e                   	pop    %esi
+  80204a:	5d                   	pop    %ebp
+  80204b:	c3                   	ret
+  80204c:	89 e2                	mov    %esp,%edx
+  80204e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802053:	29 d0                	sub    %edx,%eax
+  802055:	89 c2                	mov    %eax,%edx
+  802057:	c1 ea 0f             	shr    $0xf,%edx
+  80205a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80205f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802064:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802067:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  80206e:	8b 40 48             	mov    0x48(%eax),%eax
+  802071:	83 ec 04             	sub    $0x4,%esp
+  802074:	53                   	push   %ebx
+  802075:	50                   	push   %eax
+  802076:	68 6d 4e 80 00       	push   $0x804e6d
+  80207b:	e8 75 e4 ff ff       	call   8004f5 <cprintf>
+		return -E_INVAL;
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802088:	eb bb                	jmp    802045 <write+0x53>
+		return -E_NOT_SUPP;
+  80208a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80208f:	eb b4                	jmp    802045 <write+0x53>
+
+00802091 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802097:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209a:	50                   	push   %eax
+  80209b:	ff 75 08             	push   0x8(%ebp)
+  80209e:	e8 d3 fb ff ff       	call   801c76 <fd_lookup>
+  8020a3:	83 c4 10             	add    $0x10,%esp
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	78 0e                	js     8020b8 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8020aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020b0:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8020b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b8:	c9                   	leave
+  8020b9:	c3                   	ret
+
+008020ba <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8020ba:	55                   	push   %ebp
+  8020bb:	89 e5                	mov    %esp,%ebp
+  8020bd:	53                   	push   %ebx
+  8020be:	83 ec 1c             	sub    $0x1c,%esp
+  8020c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c7:	50                   	push   %eax
+  8020c8:	ff 75 08             	push   0x8(%ebp)
+  8020cb:	e8 a6 fb ff ff       	call   801c76 <fd_lookup>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 33                	js     80210a <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8020d7:	83 fb 03             	cmp    $0x3,%ebx
+  8020da:	74 28                	je     802104 <fcntl+0x4a>
+  8020dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e1:	83 fb 04             	cmp    $0x4,%ebx
+  8020e4:	75 24                	jne    80210a <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8020e6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8020e9:	8b 41 08             	mov    0x8(%ecx),%eax
+  8020ec:	80 e4 ef             	and    $0xef,%ah
+  8020ef:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020f2:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8020f8:	09 d0                	or     %edx,%eax
+  8020fa:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8020fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802102:	eb 06                	jmp    80210a <fcntl+0x50>
+		return fd->fd_omode;
+  802104:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802107:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80210a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+
+0080210f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	56                   	push   %esi
+  802113:	53                   	push   %ebx
+  802114:	83 ec 18             	sub    $0x18,%esp
+  802117:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80211a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80211d:	50                   	push   %eax
+  80211e:	53                   	push   %ebx
+  80211f:	e8 52 fb ff ff       	call   801c76 <fd_lookup>
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 34                	js     80215f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80212b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80212e:	83 ec 08             	sub    $0x8,%esp
+  802131:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802134:	50                   	push   %eax
+  802135:	ff 36                	push   (%esi)
+  802137:	e8 8c fb ff ff       	call   801cc8 <dev_lookup>
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 1c                	js     80215f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802143:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802147:	74 1d                	je     802166 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802149:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214c:	8b 40 18             	mov    0x18(%eax),%eax
+  80214f:	85 c0                	test   %eax,%eax
+  802151:	74 51                	je     8021a4 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802153:	83 ec 08             	sub    $0x8,%esp
+  802156:	ff 75 0c             	push   0xc(%ebp)
+  802159:	56                   	push   %esi
+  80215a:	ff d0                	call   *%eax
+  80215c:	83 c4 10             	add    $0x10,%esp
+}
+  80215f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802162:	5b                   	pop    %ebx
+  802163:	5e                   	pop    %esi
+  802164:	5d                   	pop    %ebp
+  802165:	c3                   	ret
+  802166:	89 e2                	mov    %esp,%edx
+  802168:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80216d:	29 d0                	sub    %edx,%eax
+  80216f:	89 c2                	mov    %eax,%edx
+  802171:	c1 ea 0f             	shr    $0xf,%edx
+  802174:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217e:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802181:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  802188:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80218b:	83 ec 04             	sub    $0x4,%esp
+  80218e:	53                   	push   %ebx
+  80218f:	50                   	push   %eax
+  802190:	68 30 4e 80 00       	push   $0x804e30
+  802195:	e8 5b e3 ff ff       	call   8004f5 <cprintf>
+		return -E_INVAL;
+  80219a:	83 c4 10             	add    $0x10,%esp
+  80219d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021a2:	eb bb                	jmp    80215f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8021a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021a9:	eb b4                	jmp    80215f <ftruncate+0x50>
+
+008021ab <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8021ab:	55                   	push   %ebp
+  8021ac:	89 e5                	mov    %esp,%ebp
+  8021ae:	56                   	push   %esi
+  8021af:	53                   	push   %ebx
+  8021b0:	83 ec 18             	sub    $0x18,%esp
+  8021b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021b6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021b9:	50                   	push   %eax
+  8021ba:	ff 75 08             	push   0x8(%ebp)
+  8021bd:	e8 b4 fa ff ff       	call   801c76 <fd_lookup>
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	85 c0                	test   %eax,%eax
+  8021c7:	78 53                	js     80221c <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021c9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021cc:	83 ec 08             	sub    $0x8,%esp
+  8021cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d2:	50                   	push   %eax
+  8021d3:	ff 36                	push   (%esi)
+  8021d5:	e8 ee fa ff ff       	call   801cc8 <dev_lookup>
+  8021da:	83 c4 10             	add    $0x10,%esp
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	78 3b                	js     80221c <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8021e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021e4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021e8:	74 39                	je     802223 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021ea:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021ed:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021f4:	00 00 00 
+	stat->st_isdir = 0;
+  8021f7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021fe:	00 00 00 
+	stat->st_version = 0;
+  802201:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802208:	00 00 00 
+	stat->st_dev = dev;
+  80220b:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802211:	83 ec 08             	sub    $0x8,%esp
+  802214:	53                   	push   %ebx
+  802215:	56                   	push   %esi
+  802216:	ff 50 14             	call   *0x14(%eax)
+  802219:	83 c4 10             	add    $0x10,%esp
+}
+  80221c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221f:	5b                   	pop    %ebx
+  802220:	5e                   	pop    %esi
+  802221:	5d                   	pop    %ebp
+  802222:	c3                   	ret
+		return -E_NOT_SUPP;
+  802223:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802228:	eb f2                	jmp    80221c <fstat+0x71>
+
+0080222a <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80222a:	55                   	push   %ebp
+  80222b:	89 e5                	mov    %esp,%ebp
+  80222d:	56                   	push   %esi
+  80222e:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80222f:	83 ec 08             	sub    $0x8,%esp
+  802232:	6a 00                	push   $0x0
+  802234:	ff 75 08             	push   0x8(%ebp)
+  802237:	e8 b7 01 00 00       	call   8023f3 <open>
+  80223c:	89 c3                	mov    %eax,%ebx
+  80223e:	83 c4 10             	add    $0x10,%esp
+  802241:	85 c0                	test   %eax,%eax
+  802243:	78 1b                	js     802260 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802245:	83 ec 08             	sub    $0x8,%esp
+  802248:	ff 75 0c             	push   0xc(%ebp)
+  80224b:	50                   	push   %eax
+  80224c:	e8 5a ff ff ff       	call   8021ab <fstat>
+  802251:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802253:	89 1c 24             	mov    %ebx,(%esp)
+  802256:	e8 60 fb ff ff       	call   801dbb <close>
+	return r;
+  80225b:	83 c4 10             	add    $0x10,%esp
+  80225e:	89 f3                	mov    %esi,%ebx
+}
+  802260:	89 d8                	mov    %ebx,%eax
+  802262:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802265:	5b                   	pop    %ebx
+  802266:	5e                   	pop    %esi
+  802267:	5d                   	pop    %ebp
+  802268:	c3                   	ret
+
+00802269 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802269:	55                   	push   %ebp
+  80226a:	89 e5                	mov    %esp,%ebp
+  80226c:	56                   	push   %esi
+  80226d:	53                   	push   %ebx
+  80226e:	89 c6                	mov    %eax,%esi
+  802270:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802272:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802279:	74 27                	je     8022a2 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80227b:	6a 07                	push   $0x7
+  80227d:	68 00 70 80 00       	push   $0x807000
+  802282:	56                   	push   %esi
+  802283:	ff 35 c4 66 80 00    	push   0x8066c4
+  802289:	e8 22 22 00 00       	call   8044b0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80228e:	83 c4 0c             	add    $0xc,%esp
+  802291:	6a 00                	push   $0x0
+  802293:	53                   	push   %ebx
+  802294:	6a 00                	push   $0x0
+  802296:	e8 85 1f 00 00       	call   804220 <ipc_recv>
+}
+  80229b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229e:	5b                   	pop    %ebx
+  80229f:	5e                   	pop    %esi
+  8022a0:	5d                   	pop    %ebp
+  8022a1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8022a2:	83 ec 0c             	sub    $0xc,%esp
+  8022a5:	6a 02                	push   $0x2
+  8022a7:	e8 6d 22 00 00       	call   804519 <ipc_find_env>
+  8022ac:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8022b1:	83 c4 10             	add    $0x10,%esp
+  8022b4:	eb c5                	jmp    80227b <fsipc+0x12>
+
+008022b6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8022c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ca:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022d9:	e8 8b ff ff ff       	call   802269 <fsipc>
+}
+  8022de:	c9                   	leave
+  8022df:	c3                   	ret
+
+008022e0 <devfile_flush>:
+{
+  8022e0:	55                   	push   %ebp
+  8022e1:	89 e5                	mov    %esp,%ebp
+  8022e3:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022ec:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022fb:	e8 69 ff ff ff       	call   802269 <fsipc>
+}
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+
+00802302 <devfile_stat>:
+{
+  802302:	55                   	push   %ebp
+  802303:	89 e5                	mov    %esp,%ebp
+  802305:	53                   	push   %ebx
+  802306:	83 ec 04             	sub    $0x4,%esp
+  802309:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80230c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802312:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802317:	ba 00 00 00 00       	mov    $0x0,%edx
+  80231c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802321:	e8 43 ff ff ff       	call   802269 <fsipc>
+  802326:	85 c0                	test   %eax,%eax
+  802328:	78 37                	js     802361 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80232a:	83 ec 08             	sub    $0x8,%esp
+  80232d:	68 00 70 80 00       	push   $0x807000
+  802332:	53                   	push   %ebx
+  802333:	e8 b4 e8 ff ff       	call   800bec <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802338:	a1 80 70 80 00       	mov    0x807080,%eax
+  80233d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802343:	a1 84 70 80 00       	mov    0x807084,%eax
+  802348:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80234e:	a1 88 70 80 00       	mov    0x807088,%eax
+  802353:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+00802366 <devfile_write>:
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	83 ec 0c             	sub    $0xc,%esp
+  80236c:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80236f:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802374:	39 d0                	cmp    %edx,%eax
+  802376:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80237c:	8b 52 0c             	mov    0xc(%edx),%edx
+  80237f:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  802385:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80238a:	50                   	push   %eax
+  80238b:	ff 75 0c             	push   0xc(%ebp)
+  80238e:	68 08 70 80 00       	push   $0x807008
+  802393:	e8 04 ea ff ff       	call   800d9c <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239d:	b8 04 00 00 00       	mov    $0x4,%eax
+  8023a2:	e8 c2 fe ff ff       	call   802269 <fsipc>
+}
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+
+008023a9 <devfile_read>:
+{
+  8023a9:	55                   	push   %ebp
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	53                   	push   %ebx
+  8023ad:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8023b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8023bb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023be:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8023c3:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8023c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023cd:	e8 97 fe ff ff       	call   802269 <fsipc>
+  8023d2:	89 c3                	mov    %eax,%ebx
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	78 14                	js     8023ec <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8023d8:	83 ec 04             	sub    $0x4,%esp
+  8023db:	50                   	push   %eax
+  8023dc:	68 00 70 80 00       	push   $0x807000
+  8023e1:	ff 75 0c             	push   0xc(%ebp)
+  8023e4:	e8 b3 e9 ff ff       	call   800d9c <memmove>
+	return r;
+  8023e9:	83 c4 10             	add    $0x10,%esp
+}
+  8023ec:	89 d8                	mov    %ebx,%eax
+  8023ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+
+008023f3 <open>:
+{
+  8023f3:	55                   	push   %ebp
+  8023f4:	89 e5                	mov    %esp,%ebp
+  8023f6:	53                   	push   %ebx
+  8023f7:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8023fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023fd:	50                   	push   %eax
+  8023fe:	e8 23 f8 ff ff       	call   801c26 <fd_alloc>
+  802403:	89 c3                	mov    %eax,%ebx
+  802405:	83 c4 10             	add    $0x10,%esp
+  802408:	85 c0                	test   %eax,%eax
+  80240a:	78 2a                	js     802436 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80240c:	83 ec 0c             	sub    $0xc,%esp
+  80240f:	ff 75 08             	push   0x8(%ebp)
+  802412:	e8 89 e7 ff ff       	call   800ba0 <strlen>
+  802417:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80241a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80241f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802424:	7e 17                	jle    80243d <open+0x4a>
+	fd_close(fd, 1);
+  802426:	83 ec 08             	sub    $0x8,%esp
+  802429:	6a 01                	push   $0x1
+  80242b:	ff 75 f4             	push   -0xc(%ebp)
+  80242e:	e8 08 f9 ff ff       	call   801d3b <fd_close>
+	return r;
+  802433:	83 c4 10             	add    $0x10,%esp
+}
+  802436:	89 d8                	mov    %ebx,%eax
+  802438:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80243b:	c9                   	leave
+  80243c:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80243d:	83 ec 08             	sub    $0x8,%esp
+  802440:	ff 75 08             	push   0x8(%ebp)
+  802443:	68 00 70 80 00       	push   $0x807000
+  802448:	e8 9f e7 ff ff       	call   800bec <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80244d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802450:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802455:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802458:	b8 01 00 00 00       	mov    $0x1,%eax
+  80245d:	e8 07 fe ff ff       	call   802269 <fsipc>
+  802462:	89 c3                	mov    %eax,%ebx
+  802464:	83 c4 10             	add    $0x10,%esp
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 bb                	js     802426 <open+0x33>
+	return fd2num(fd); 	
+  80246b:	83 ec 0c             	sub    $0xc,%esp
+  80246e:	ff 75 f4             	push   -0xc(%ebp)
+  802471:	e8 89 f7 ff ff       	call   801bff <fd2num>
+  802476:	89 c3                	mov    %eax,%ebx
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	eb b9                	jmp    802436 <open+0x43>
+
+0080247d <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  80247d:	55                   	push   %ebp
+  80247e:	89 e5                	mov    %esp,%ebp
+  802480:	53                   	push   %ebx
+  802481:	83 ec 1c             	sub    $0x1c,%esp
+  802484:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80248a:	50                   	push   %eax
+  80248b:	ff 75 08             	push   0x8(%ebp)
+  80248e:	e8 e3 f7 ff ff       	call   801c76 <fd_lookup>
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	85 c0                	test   %eax,%eax
+  802498:	78 5a                	js     8024f4 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80249a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80249d:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8024a3:	39 10                	cmp    %edx,(%eax)
+  8024a5:	75 66                	jne    80250d <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8024a7:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8024ae:	74 49                	je     8024f9 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  8024bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024be:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  8024c3:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8024c9:	6a 07                	push   $0x7
+  8024cb:	68 00 70 80 00       	push   $0x807000
+  8024d0:	6a 09                	push   $0x9
+  8024d2:	ff 35 c4 66 80 00    	push   0x8066c4
+  8024d8:	e8 d3 1f 00 00       	call   8044b0 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8024dd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8024e4:	6a 00                	push   $0x0
+  8024e6:	53                   	push   %ebx
+  8024e7:	ff 75 10             	push   0x10(%ebp)
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	e8 fc 1d 00 00       	call   8042ed <ipc_recv_pages>
+  8024f1:	83 c4 20             	add    $0x20,%esp
+}
+  8024f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f7:	c9                   	leave
+  8024f8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024f9:	83 ec 0c             	sub    $0xc,%esp
+  8024fc:	6a 02                	push   $0x2
+  8024fe:	e8 16 20 00 00       	call   804519 <ipc_find_env>
+  802503:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802508:	83 c4 10             	add    $0x10,%esp
+  80250b:	eb a3                	jmp    8024b0 <fmap+0x33>
+		return -E_INVAL;
+  80250d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802512:	eb e0                	jmp    8024f4 <fmap+0x77>
+
+00802514 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802514:	55                   	push   %ebp
+  802515:	89 e5                	mov    %esp,%ebp
+  802517:	53                   	push   %ebx
+  802518:	83 ec 10             	sub    $0x10,%esp
+  80251b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80251e:	53                   	push   %ebx
+  80251f:	e8 7c e6 ff ff       	call   800ba0 <strlen>
+  802524:	83 c4 10             	add    $0x10,%esp
+  802527:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80252c:	7f 25                	jg     802553 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80252e:	83 ec 08             	sub    $0x8,%esp
+  802531:	53                   	push   %ebx
+  802532:	68 00 70 80 00       	push   $0x807000
+  802537:	e8 b0 e6 ff ff       	call   800bec <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80253c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802541:	b8 07 00 00 00       	mov    $0x7,%eax
+  802546:	e8 1e fd ff ff       	call   802269 <fsipc>
+  80254b:	83 c4 10             	add    $0x10,%esp
+}
+  80254e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802551:	c9                   	leave
+  802552:	c3                   	ret
+		return -E_BAD_PATH;
+  802553:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802558:	eb f4                	jmp    80254e <remove+0x3a>
+
+0080255a <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80255a:	55                   	push   %ebp
+  80255b:	89 e5                	mov    %esp,%ebp
+  80255d:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802560:	ba 00 00 00 00       	mov    $0x0,%edx
+  802565:	b8 08 00 00 00       	mov    $0x8,%eax
+  80256a:	e8 fa fc ff ff       	call   802269 <fsipc>
+}
+  80256f:	c9                   	leave
+  802570:	c3                   	ret
+
+00802571 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802571:	55                   	push   %ebp
+  802572:	89 e5                	mov    %esp,%ebp
+  802574:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802577:	68 a0 4e 80 00       	push   $0x804ea0
+  80257c:	ff 75 0c             	push   0xc(%ebp)
+  80257f:	e8 68 e6 ff ff       	call   800bec <strcpy>
+	return 0;
+}
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+  802589:	c9                   	leave
+  80258a:	c3                   	ret
+
+0080258b <devsock_close>:
+{
+  80258b:	55                   	push   %ebp
+  80258c:	89 e5                	mov    %esp,%ebp
+  80258e:	53                   	push   %ebx
+  80258f:	83 ec 10             	sub    $0x10,%esp
+  802592:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802595:	53                   	push   %ebx
+  802596:	e8 bd 1f 00 00       	call   804558 <pageref>
+  80259b:	89 c2                	mov    %eax,%edx
+  80259d:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8025a0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8025a5:	83 fa 01             	cmp    $0x1,%edx
+  8025a8:	74 05                	je     8025af <devsock_close+0x24>
+}
+  8025aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ad:	c9                   	leave
+  8025ae:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8025af:	83 ec 0c             	sub    $0xc,%esp
+  8025b2:	ff 73 0c             	push   0xc(%ebx)
+  8025b5:	e8 b0 05 00 00       	call   802b6a <nsipc_close>
+  8025ba:	83 c4 10             	add    $0x10,%esp
+  8025bd:	eb eb                	jmp    8025aa <devsock_close+0x1f>
+
+008025bf <devsock_write>:
+{
+  8025bf:	55                   	push   %ebp
+  8025c0:	89 e5                	mov    %esp,%ebp
+  8025c2:	53                   	push   %ebx
+  8025c3:	83 ec 14             	sub    $0x14,%esp
+  8025c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025cc:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8025cf:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8025d2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8025d5:	8b 41 08             	mov    0x8(%ecx),%eax
+  8025d8:	c1 f8 09             	sar    $0x9,%eax
+  8025db:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8025de:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8025e4:	77 13                	ja     8025f9 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8025e6:	50                   	push   %eax
+  8025e7:	52                   	push   %edx
+  8025e8:	53                   	push   %ebx
+  8025e9:	ff 71 0c             	push   0xc(%ecx)
+  8025ec:	e8 5c 06 00 00       	call   802c4d <nsipc_send>
+  8025f1:	83 c4 10             	add    $0x10,%esp
+}
+  8025f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8025f9:	50                   	push   %eax
+  8025fa:	6a 01                	push   $0x1
+  8025fc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025ff:	50                   	push   %eax
+  802600:	ff 71 0c             	push   0xc(%ecx)
+  802603:	e8 a6 06 00 00       	call   802cae <nsipc_sendmsg>
+  802608:	83 c4 10             	add    $0x10,%esp
+  80260b:	eb e7                	jmp    8025f4 <devsock_write+0x35>
+
+0080260d <devsock_read>:
+{
+  80260d:	55                   	push   %ebp
+  80260e:	89 e5                	mov    %esp,%ebp
+  802610:	53                   	push   %ebx
+  802611:	83 ec 14             	sub    $0x14,%esp
+  802614:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802617:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80261a:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80261d:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802620:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802623:	8b 41 08             	mov    0x8(%ecx),%eax
+  802626:	c1 f8 09             	sar    $0x9,%eax
+  802629:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80262c:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802632:	77 13                	ja     802647 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802634:	50                   	push   %eax
+  802635:	52                   	push   %edx
+  802636:	53                   	push   %ebx
+  802637:	ff 71 0c             	push   0xc(%ecx)
+  80263a:	e8 9c 05 00 00       	call   802bdb <nsipc_recv>
+  80263f:	83 c4 10             	add    $0x10,%esp
+}
+  802642:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802647:	50                   	push   %eax
+  802648:	6a 01                	push   $0x1
+  80264a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80264d:	50                   	push   %eax
+  80264e:	ff 71 0c             	push   0xc(%ecx)
+  802651:	e8 02 0a 00 00       	call   803058 <nsipc_recvmsg>
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	eb e7                	jmp    802642 <devsock_read+0x35>
+
+0080265b <fd2sockid>:
+{
+  80265b:	55                   	push   %ebp
+  80265c:	89 e5                	mov    %esp,%ebp
+  80265e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802661:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802664:	52                   	push   %edx
+  802665:	50                   	push   %eax
+  802666:	e8 0b f6 ff ff       	call   801c76 <fd_lookup>
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	78 10                	js     802682 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802672:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802675:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  80267b:	39 08                	cmp    %ecx,(%eax)
+  80267d:	75 05                	jne    802684 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80267f:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+		return -E_NOT_SUPP;
+  802684:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802689:	eb f7                	jmp    802682 <fd2sockid+0x27>
+
+0080268b <sock_flags>:
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802691:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802694:	52                   	push   %edx
+  802695:	50                   	push   %eax
+  802696:	e8 db f5 ff ff       	call   801c76 <fd_lookup>
+  80269b:	83 c4 10             	add    $0x10,%esp
+  80269e:	85 c0                	test   %eax,%eax
+  8026a0:	78 0e                	js     8026b0 <sock_flags+0x25>
+  8026a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026a5:	8b 40 08             	mov    0x8(%eax),%eax
+  8026a8:	c1 e8 09             	shr    $0x9,%eax
+  8026ab:	83 e0 08             	and    $0x8,%eax
+}
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+		return 0;
+  8026b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b5:	eb f7                	jmp    8026ae <sock_flags+0x23>
+
+008026b7 <alloc_sockfd>:
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	56                   	push   %esi
+  8026bb:	53                   	push   %ebx
+  8026bc:	83 ec 1c             	sub    $0x1c,%esp
+  8026bf:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026c4:	50                   	push   %eax
+  8026c5:	e8 5c f5 ff ff       	call   801c26 <fd_alloc>
+  8026ca:	89 c3                	mov    %eax,%ebx
+  8026cc:	83 c4 10             	add    $0x10,%esp
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	78 43                	js     802716 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026d3:	83 ec 04             	sub    $0x4,%esp
+  8026d6:	68 07 04 00 00       	push   $0x407
+  8026db:	ff 75 f4             	push   -0xc(%ebp)
+  8026de:	6a 00                	push   $0x0
+  8026e0:	e8 3b e9 ff ff       	call   801020 <sys_page_alloc>
+  8026e5:	89 c3                	mov    %eax,%ebx
+  8026e7:	83 c4 10             	add    $0x10,%esp
+  8026ea:	85 c0                	test   %eax,%eax
+  8026ec:	78 28                	js     802716 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f1:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8026f7:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026fc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802703:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802706:	83 ec 0c             	sub    $0xc,%esp
+  802709:	50                   	push   %eax
+  80270a:	e8 f0 f4 ff ff       	call   801bff <fd2num>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	83 c4 10             	add    $0x10,%esp
+  802714:	eb 0c                	jmp    802722 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802716:	83 ec 0c             	sub    $0xc,%esp
+  802719:	56                   	push   %esi
+  80271a:	e8 4b 04 00 00       	call   802b6a <nsipc_close>
+		return r;
+  80271f:	83 c4 10             	add    $0x10,%esp
+}
+  802722:	89 d8                	mov    %ebx,%eax
+  802724:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802727:	5b                   	pop    %ebx
+  802728:	5e                   	pop    %esi
+  802729:	5d                   	pop    %ebp
+  80272a:	c3                   	ret
+
+0080272b <accept>:
+{
+  80272b:	55                   	push   %ebp
+  80272c:	89 e5                	mov    %esp,%ebp
+  80272e:	56                   	push   %esi
+  80272f:	53                   	push   %ebx
+  802730:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802733:	89 f0                	mov    %esi,%eax
+  802735:	e8 21 ff ff ff       	call   80265b <fd2sockid>
+  80273a:	89 c3                	mov    %eax,%ebx
+  80273c:	85 c0                	test   %eax,%eax
+  80273e:	78 24                	js     802764 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802740:	89 f0                	mov    %esi,%eax
+  802742:	e8 44 ff ff ff       	call   80268b <sock_flags>
+  802747:	50                   	push   %eax
+  802748:	ff 75 10             	push   0x10(%ebp)
+  80274b:	ff 75 0c             	push   0xc(%ebp)
+  80274e:	53                   	push   %ebx
+  80274f:	e8 6b 03 00 00       	call   802abf <nsipc_accept>
+  802754:	89 c3                	mov    %eax,%ebx
+  802756:	83 c4 10             	add    $0x10,%esp
+  802759:	85 c0                	test   %eax,%eax
+  80275b:	78 07                	js     802764 <accept+0x39>
+	return alloc_sockfd(r);
+  80275d:	e8 55 ff ff ff       	call   8026b7 <alloc_sockfd>
+  802762:	89 c3                	mov    %eax,%ebx
+}
+  802764:	89 d8                	mov    %ebx,%eax
+  802766:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802769:	5b                   	pop    %ebx
+  80276a:	5e                   	pop    %esi
+  80276b:	5d                   	pop    %ebp
+  80276c:	c3                   	ret
+
+0080276d <bind>:
+{
+  80276d:	55                   	push   %ebp
+  80276e:	89 e5                	mov    %esp,%ebp
+  802770:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802773:	8b 45 08             	mov    0x8(%ebp),%eax
+  802776:	e8 e0 fe ff ff       	call   80265b <fd2sockid>
+  80277b:	85 c0                	test   %eax,%eax
+  80277d:	78 12                	js     802791 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80277f:	83 ec 04             	sub    $0x4,%esp
+  802782:	ff 75 10             	push   0x10(%ebp)
+  802785:	ff 75 0c             	push   0xc(%ebp)
+  802788:	50                   	push   %eax
+  802789:	e8 85 03 00 00       	call   802b13 <nsipc_bind>
+  80278e:	83 c4 10             	add    $0x10,%esp
+}
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+00802793 <shutdown>:
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802799:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279c:	e8 ba fe ff ff       	call   80265b <fd2sockid>
+  8027a1:	85 c0                	test   %eax,%eax
+  8027a3:	78 0f                	js     8027b4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027a5:	83 ec 08             	sub    $0x8,%esp
+  8027a8:	ff 75 0c             	push   0xc(%ebp)
+  8027ab:	50                   	push   %eax
+  8027ac:	e8 97 03 00 00       	call   802b48 <nsipc_shutdown>
+  8027b1:	83 c4 10             	add    $0x10,%esp
+}
+  8027b4:	c9                   	leave
+  8027b5:	c3                   	ret
+
+008027b6 <connect>:
+{
+  8027b6:	55                   	push   %ebp
+  8027b7:	89 e5                	mov    %esp,%ebp
+  8027b9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027bf:	e8 97 fe ff ff       	call   80265b <fd2sockid>
+  8027c4:	85 c0                	test   %eax,%eax
+  8027c6:	78 12                	js     8027da <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027c8:	83 ec 04             	sub    $0x4,%esp
+  8027cb:	ff 75 10             	push   0x10(%ebp)
+  8027ce:	ff 75 0c             	push   0xc(%ebp)
+  8027d1:	50                   	push   %eax
+  8027d2:	e8 ad 03 00 00       	call   802b84 <nsipc_connect>
+  8027d7:	83 c4 10             	add    $0x10,%esp
+}
+  8027da:	c9                   	leave
+  8027db:	c3                   	ret
+
+008027dc <listen>:
+{
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027e5:	e8 71 fe ff ff       	call   80265b <fd2sockid>
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	78 0f                	js     8027fd <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027ee:	83 ec 08             	sub    $0x8,%esp
+  8027f1:	ff 75 0c             	push   0xc(%ebp)
+  8027f4:	50                   	push   %eax
+  8027f5:	e8 bf 03 00 00       	call   802bb9 <nsipc_listen>
+  8027fa:	83 c4 10             	add    $0x10,%esp
+}
+  8027fd:	c9                   	leave
+  8027fe:	c3                   	ret
+
+008027ff <sendmsg>:
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	57                   	push   %edi
+  802803:	56                   	push   %esi
+  802804:	53                   	push   %ebx
+  802805:	83 ec 0c             	sub    $0xc,%esp
+  802808:	8b 75 08             	mov    0x8(%ebp),%esi
+  80280b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80280e:	89 f0                	mov    %esi,%eax
+  802810:	e8 46 fe ff ff       	call   80265b <fd2sockid>
+  802815:	89 c3                	mov    %eax,%ebx
+  802817:	85 c0                	test   %eax,%eax
+  802819:	78 1c                	js     802837 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80281b:	89 f0                	mov    %esi,%eax
+  80281d:	e8 69 fe ff ff       	call   80268b <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802822:	0b 45 10             	or     0x10(%ebp),%eax
+  802825:	50                   	push   %eax
+  802826:	ff 77 0c             	push   0xc(%edi)
+  802829:	ff 77 08             	push   0x8(%edi)
+  80282c:	53                   	push   %ebx
+  80282d:	e8 7c 04 00 00       	call   802cae <nsipc_sendmsg>
+  802832:	89 c3                	mov    %eax,%ebx
+  802834:	83 c4 10             	add    $0x10,%esp
+}
+  802837:	89 d8                	mov    %ebx,%eax
+  802839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283c:	5b                   	pop    %ebx
+  80283d:	5e                   	pop    %esi
+  80283e:	5f                   	pop    %edi
+  80283f:	5d                   	pop    %ebp
+  802840:	c3                   	ret
+
+00802841 <recvmsg>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	57                   	push   %edi
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	83 ec 0c             	sub    $0xc,%esp
+  80284a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80284d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802850:	89 f8                	mov    %edi,%eax
+  802852:	e8 04 fe ff ff       	call   80265b <fd2sockid>
+  802857:	89 c3                	mov    %eax,%ebx
+  802859:	85 c0                	test   %eax,%eax
+  80285b:	78 2a                	js     802887 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  80285d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802864:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80286b:	89 f8                	mov    %edi,%eax
+  80286d:	e8 19 fe ff ff       	call   80268b <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802872:	0b 45 10             	or     0x10(%ebp),%eax
+  802875:	50                   	push   %eax
+  802876:	ff 76 0c             	push   0xc(%esi)
+  802879:	ff 76 08             	push   0x8(%esi)
+  80287c:	53                   	push   %ebx
+  80287d:	e8 d6 07 00 00       	call   803058 <nsipc_recvmsg>
+  802882:	89 c3                	mov    %eax,%ebx
+  802884:	83 c4 10             	add    $0x10,%esp
+}
+  802887:	89 d8                	mov    %ebx,%eax
+  802889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288c:	5b                   	pop    %ebx
+  80288d:	5e                   	pop    %esi
+  80288e:	5f                   	pop    %edi
+  80288f:	5d                   	pop    %ebp
+  802890:	c3                   	ret
+
+00802891 <sendfile>:
+{
+  802891:	55                   	push   %ebp
+  802892:	89 e5                	mov    %esp,%ebp
+  802894:	56                   	push   %esi
+  802895:	53                   	push   %ebx
+  802896:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802899:	89 f0                	mov    %esi,%eax
+  80289b:	e8 bb fd ff ff       	call   80265b <fd2sockid>
+  8028a0:	89 c3                	mov    %eax,%ebx
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	78 1f                	js     8028c5 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8028a6:	89 f0                	mov    %esi,%eax
+  8028a8:	e8 de fd ff ff       	call   80268b <sock_flags>
+  8028ad:	83 ec 0c             	sub    $0xc,%esp
+  8028b0:	50                   	push   %eax
+  8028b1:	ff 75 14             	push   0x14(%ebp)
+  8028b4:	ff 75 10             	push   0x10(%ebp)
+  8028b7:	ff 75 0c             	push   0xc(%ebp)
+  8028ba:	53                   	push   %ebx
+  8028bb:	e8 64 06 00 00       	call   802f24 <nsipc_sendfile>
+  8028c0:	89 c3                	mov    %eax,%ebx
+  8028c2:	83 c4 20             	add    $0x20,%esp
+}
+  8028c5:	89 d8                	mov    %ebx,%eax
+  8028c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ca:	5b                   	pop    %ebx
+  8028cb:	5e                   	pop    %esi
+  8028cc:	5d                   	pop    %ebp
+  8028cd:	c3                   	ret
+
+008028ce <evctl>:
+{
+  8028ce:	55                   	push   %ebp
+  8028cf:	89 e5                	mov    %esp,%ebp
+  8028d1:	53                   	push   %ebx
+  8028d2:	83 ec 04             	sub    $0x4,%esp
+  8028d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8028d8:	89 d8                	mov    %ebx,%eax
+  8028da:	e8 7c fd ff ff       	call   80265b <fd2sockid>
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	78 10                	js     8028f3 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8028e3:	83 ec 04             	sub    $0x4,%esp
+  8028e6:	53                   	push   %ebx
+  8028e7:	ff 75 0c             	push   0xc(%ebp)
+  8028ea:	50                   	push   %eax
+  8028eb:	e8 d2 0b 00 00       	call   8034c2 <nsipc_evctl>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+}
+  8028f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028f6:	c9                   	leave
+  8028f7:	c3                   	ret
+
+008028f8 <evwait>:
+{
+  8028f8:	55                   	push   %ebp
+  8028f9:	89 e5                	mov    %esp,%ebp
+  8028fb:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8028fe:	ff 75 10             	push   0x10(%ebp)
+  802901:	ff 75 0c             	push   0xc(%ebp)
+  802904:	ff 75 08             	push   0x8(%ebp)
+  802907:	e8 e0 0b 00 00       	call   8034ec <nsipc_evwait>
+}
+  80290c:	c9                   	leave
+  80290d:	c3                   	ret
+
+0080290e <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80290e:	55                   	push   %ebp
+  80290f:	89 e5                	mov    %esp,%ebp
+  802911:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802914:	ff 75 10             	push   0x10(%ebp)
+  802917:	ff 75 0c             	push   0xc(%ebp)
+  80291a:	ff 75 08             	push   0x8(%ebp)
+  80291d:	e8 31 0c 00 00       	call   803553 <nsipc_socket>
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	85 c0                	test   %eax,%eax
+  802927:	78 05                	js     80292e <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802929:	e8 89 fd ff ff       	call   8026b7 <alloc_sockfd>
+}
+  80292e:	c9                   	leave
+  80292f:	c3                   	ret
+
+00802930 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802930:	55                   	push   %ebp
+  802931:	89 e5                	mov    %esp,%ebp
+  802933:	53                   	push   %ebx
+  802934:	83 ec 04             	sub    $0x4,%esp
+  802937:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802939:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802940:	74 26                	je     802968 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802942:	6a 07                	push   $0x7
+  802944:	68 00 80 80 00       	push   $0x808000
+  802949:	53                   	push   %ebx
+  80294a:	ff 35 e4 69 80 00    	push   0x8069e4
+  802950:	e8 5b 1b 00 00       	call   8044b0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802955:	83 c4 0c             	add    $0xc,%esp
+  802958:	6a 00                	push   $0x0
+  80295a:	6a 00                	push   $0x0
+  80295c:	6a 00                	push   $0x0
+  80295e:	e8 bd 18 00 00       	call   804220 <ipc_recv>
+}
+  802963:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802966:	c9                   	leave
+  802967:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802968:	83 ec 0c             	sub    $0xc,%esp
+  80296b:	6a 03                	push   $0x3
+  80296d:	e8 a7 1b 00 00       	call   804519 <ipc_find_env>
+  802972:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	eb c6                	jmp    802942 <nsipc+0x12>
+
+0080297c <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80297c:	55                   	push   %ebp
+  80297d:	89 e5                	mov    %esp,%ebp
+  80297f:	56                   	push   %esi
+  802980:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802981:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802987:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80298c:	85 f6                	test   %esi,%esi
+  80298e:	75 33                	jne    8029c3 <nsbulk_map+0x47>
+  802990:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802995:	83 ec 04             	sub    $0x4,%esp
+  802998:	6a 07                	push   $0x7
+  80299a:	53                   	push   %ebx
+  80299b:	6a 00                	push   $0x0
+  80299d:	e8 7e e6 ff ff       	call   801020 <sys_page_alloc>
+  8029a2:	83 c4 10             	add    $0x10,%esp
+  8029a5:	85 c0                	test   %eax,%eax
+  8029a7:	78 1a                	js     8029c3 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8029a9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029af:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8029b5:	75 de                	jne    802995 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8029b7:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  8029be:	00 00 00 
+	return 0;
+  8029c1:	89 f0                	mov    %esi,%eax
+}
+  8029c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029c6:	5b                   	pop    %ebx
+  8029c7:	5e                   	pop    %esi
+  8029c8:	5d                   	pop    %ebp
+  8029c9:	c3                   	ret
+
+008029ca <nsbulk_own>:
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	57                   	push   %edi
+  8029ce:	56                   	push   %esi
+  8029cf:	53                   	push   %ebx
+  8029d0:	83 ec 0c             	sub    $0xc,%esp
+  8029d3:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8029d5:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8029d8:	85 d2                	test   %edx,%edx
+  8029da:	7f 0e                	jg     8029ea <nsbulk_own+0x20>
+	return 0;
+  8029dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e1:	eb 47                	jmp    802a2a <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8029e3:	83 c3 01             	add    $0x1,%ebx
+  8029e6:	39 fb                	cmp    %edi,%ebx
+  8029e8:	7d 3b                	jge    802a25 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8029ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ef:	89 d9                	mov    %ebx,%ecx
+  8029f1:	d3 e6                	shl    %cl,%esi
+  8029f3:	89 f0                	mov    %esi,%eax
+  8029f5:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  8029fb:	74 e6                	je     8029e3 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	6a 07                	push   $0x7
+  802a02:	89 d8                	mov    %ebx,%eax
+  802a04:	c1 e0 0c             	shl    $0xc,%eax
+  802a07:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802a0c:	50                   	push   %eax
+  802a0d:	6a 00                	push   $0x0
+  802a0f:	e8 0c e6 ff ff       	call   801020 <sys_page_alloc>
+  802a14:	83 c4 10             	add    $0x10,%esp
+  802a17:	85 c0                	test   %eax,%eax
+  802a19:	78 0f                	js     802a2a <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802a1b:	f7 d6                	not    %esi
+  802a1d:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802a23:	eb be                	jmp    8029e3 <nsbulk_own+0x19>
+	return 0;
+  802a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a2d:	5b                   	pop    %ebx
+  802a2e:	5e                   	pop    %esi
+  802a2f:	5f                   	pop    %edi
+  802a30:	5d                   	pop    %ebp
+  802a31:	c3                   	ret
+
+00802a32 <nsipc_bulk>:
+{
+  802a32:	55                   	push   %ebp
+  802a33:	89 e5                	mov    %esp,%ebp
+  802a35:	57                   	push   %edi
+  802a36:	56                   	push   %esi
+  802a37:	53                   	push   %ebx
+  802a38:	83 ec 1c             	sub    $0x1c,%esp
+  802a3b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a3e:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802a40:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802a46:	c1 fb 0c             	sar    $0xc,%ebx
+  802a49:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802a4c:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802a53:	74 56                	je     802aab <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a55:	85 ff                	test   %edi,%edi
+  802a57:	7e 24                	jle    802a7d <nsipc_bulk+0x4b>
+  802a59:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802a5f:	74 1c                	je     802a7d <nsipc_bulk+0x4b>
+  802a61:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802a67:	c1 e3 0c             	shl    $0xc,%ebx
+  802a6a:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802a6f:	0f b6 10             	movzbl (%eax),%edx
+  802a72:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a74:	05 00 10 00 00       	add    $0x1000,%eax
+  802a79:	39 d8                	cmp    %ebx,%eax
+  802a7b:	75 f2                	jne    802a6f <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802a7d:	83 ec 0c             	sub    $0xc,%esp
+  802a80:	56                   	push   %esi
+  802a81:	57                   	push   %edi
+  802a82:	68 00 00 00 e0       	push   $0xe0000000
+  802a87:	ff 75 e4             	push   -0x1c(%ebp)
+  802a8a:	ff 35 e4 69 80 00    	push   0x8069e4
+  802a90:	e8 4f 1a 00 00       	call   8044e4 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802a95:	83 c4 1c             	add    $0x1c,%esp
+  802a98:	6a 00                	push   $0x0
+  802a9a:	6a 00                	push   $0x0
+  802a9c:	6a 00                	push   $0x0
+  802a9e:	e8 7d 17 00 00       	call   804220 <ipc_recv>
+}
+  802aa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aa6:	5b                   	pop    %ebx
+  802aa7:	5e                   	pop    %esi
+  802aa8:	5f                   	pop    %edi
+  802aa9:	5d                   	pop    %ebp
+  802aaa:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	6a 03                	push   $0x3
+  802ab0:	e8 64 1a 00 00       	call   804519 <ipc_find_env>
+  802ab5:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802aba:	83 c4 10             	add    $0x10,%esp
+  802abd:	eb 96                	jmp    802a55 <nsipc_bulk+0x23>
+
+00802abf <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802abf:	55                   	push   %ebp
+  802ac0:	89 e5                	mov    %esp,%ebp
+  802ac2:	53                   	push   %ebx
+  802ac3:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ac6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ac9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802ace:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ad1:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802ad6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802adb:	e8 50 fe ff ff       	call   802930 <nsipc>
+  802ae0:	89 c3                	mov    %eax,%ebx
+  802ae2:	85 c0                	test   %eax,%eax
+  802ae4:	79 07                	jns    802aed <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802ae6:	89 d8                	mov    %ebx,%eax
+  802ae8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aeb:	c9                   	leave
+  802aec:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802aed:	83 ec 04             	sub    $0x4,%esp
+  802af0:	ff 35 10 80 80 00    	push   0x808010
+  802af6:	68 00 80 80 00       	push   $0x808000
+  802afb:	ff 75 0c             	push   0xc(%ebp)
+  802afe:	e8 99 e2 ff ff       	call   800d9c <memmove>
+		*addrlen = ret->ret_addrlen;
+  802b03:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b09:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b0c:	89 10                	mov    %edx,(%eax)
+  802b0e:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802b11:	eb d3                	jmp    802ae6 <nsipc_accept+0x27>
+
+00802b13 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	53                   	push   %ebx
+  802b17:	83 ec 08             	sub    $0x8,%esp
+  802b1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b20:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802b25:	53                   	push   %ebx
+  802b26:	ff 75 0c             	push   0xc(%ebp)
+  802b29:	68 04 80 80 00       	push   $0x808004
+  802b2e:	e8 69 e2 ff ff       	call   800d9c <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b33:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802b39:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b3e:	e8 ed fd ff ff       	call   802930 <nsipc>
+}
+  802b43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b46:	c9                   	leave
+  802b47:	c3                   	ret
+
+00802b48 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b48:	55                   	push   %ebp
+  802b49:	89 e5                	mov    %esp,%ebp
+  802b4b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b51:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802b56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b59:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b5e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b63:	e8 c8 fd ff ff       	call   802930 <nsipc>
+}
+  802b68:	c9                   	leave
+  802b69:	c3                   	ret
+
+00802b6a <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b6a:	55                   	push   %ebp
+  802b6b:	89 e5                	mov    %esp,%ebp
+  802b6d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b73:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802b78:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b7d:	e8 ae fd ff ff       	call   802930 <nsipc>
+}
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+00802b84 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	53                   	push   %ebx
+  802b88:	83 ec 08             	sub    $0x8,%esp
+  802b8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b91:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b96:	53                   	push   %ebx
+  802b97:	ff 75 0c             	push   0xc(%ebp)
+  802b9a:	68 04 80 80 00       	push   $0x808004
+  802b9f:	e8 f8 e1 ff ff       	call   800d9c <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802ba4:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802baa:	b8 05 00 00 00       	mov    $0x5,%eax
+  802baf:	e8 7c fd ff ff       	call   802930 <nsipc>
+}
+  802bb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bb7:	c9                   	leave
+  802bb8:	c3                   	ret
+
+00802bb9 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802bb9:	55                   	push   %ebp
+  802bba:	89 e5                	mov    %esp,%ebp
+  802bbc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bca:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802bcf:	b8 06 00 00 00       	mov    $0x6,%eax
+  802bd4:	e8 57 fd ff ff       	call   802930 <nsipc>
+}
+  802bd9:	c9                   	leave
+  802bda:	c3                   	ret
+
+00802bdb <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802bdb:	55                   	push   %ebp
+  802bdc:	89 e5                	mov    %esp,%ebp
+  802bde:	56                   	push   %esi
+  802bdf:	53                   	push   %ebx
+  802be0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  802be6:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802beb:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802bf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bf4:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bf9:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bfe:	e8 2d fd ff ff       	call   802930 <nsipc>
+  802c03:	89 c3                	mov    %eax,%ebx
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	78 22                	js     802c2b <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802c09:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802c0e:	39 c6                	cmp    %eax,%esi
+  802c10:	0f 4e c6             	cmovle %esi,%eax
+  802c13:	39 c3                	cmp    %eax,%ebx
+  802c15:	7f 1d                	jg     802c34 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802c17:	83 ec 04             	sub    $0x4,%esp
+  802c1a:	53                   	push   %ebx
+  802c1b:	68 00 80 80 00       	push   $0x808000
+  802c20:	ff 75 0c             	push   0xc(%ebp)
+  802c23:	e8 74 e1 ff ff       	call   800d9c <memmove>
+  802c28:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c2b:	89 d8                	mov    %ebx,%eax
+  802c2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c30:	5b                   	pop    %ebx
+  802c31:	5e                   	pop    %esi
+  802c32:	5d                   	pop    %ebp
+  802c33:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c34:	68 ac 4e 80 00       	push   $0x804eac
+  802c39:	68 c1 4e 80 00       	push   $0x804ec1
+  802c3e:	68 b2 00 00 00       	push   $0xb2
+  802c43:	68 d6 4e 80 00       	push   $0x804ed6
+  802c48:	e8 cd d7 ff ff       	call   80041a <_panic>
+
+00802c4d <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	53                   	push   %ebx
+  802c51:	83 ec 04             	sub    $0x4,%esp
+  802c54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c5a:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802c5f:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c65:	7f 2e                	jg     802c95 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c67:	83 ec 04             	sub    $0x4,%esp
+  802c6a:	53                   	push   %ebx
+  802c6b:	ff 75 0c             	push   0xc(%ebp)
+  802c6e:	68 0c 80 80 00       	push   $0x80800c
+  802c73:	e8 24 e1 ff ff       	call   800d9c <memmove>
+	nsipcbuf.send.req_size = size;
+  802c78:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802c7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c81:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802c86:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c8b:	e8 a0 fc ff ff       	call   802930 <nsipc>
+}
+  802c90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c93:	c9                   	leave
+  802c94:	c3                   	ret
+	assert(size < 1600);
+  802c95:	68 e2 4e 80 00       	push   $0x804ee2
+  802c9a:	68 c1 4e 80 00       	push   $0x804ec1
+  802c9f:	68 bd 00 00 00       	push   $0xbd
+  802ca4:	68 d6 4e 80 00       	push   $0x804ed6
+  802ca9:	e8 6c d7 ff ff       	call   80041a <_panic>
+
+00802cae <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	57                   	push   %edi
+  802cb2:	56                   	push   %esi
+  802cb3:	53                   	push   %ebx
+  802cb4:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802cb7:	e8 c0 fc ff ff       	call   80297c <nsbulk_map>
+  802cbc:	85 c0                	test   %eax,%eax
+  802cbe:	78 55                	js     802d15 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802cc0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802cc7:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802cce:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802cd5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802cd8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802cdb:	0f 8d 24 02 00 00    	jge    802f05 <nsipc_sendmsg+0x257>
+  802ce1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ce4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802ce7:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802cea:	89 d8                	mov    %ebx,%eax
+  802cec:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802cf1:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802cf3:	83 ec 0c             	sub    $0xc,%esp
+  802cf6:	68 e0 66 80 00       	push   $0x8066e0
+  802cfb:	e8 bc 0f 00 00       	call   803cbc <pgbatch_init>
+  802d00:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d03:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d05:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802d08:	e9 82 00 00 00       	jmp    802d8f <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802d0d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d10:	85 db                	test   %ebx,%ebx
+  802d12:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d18:	5b                   	pop    %ebx
+  802d19:	5e                   	pop    %esi
+  802d1a:	5f                   	pop    %edi
+  802d1b:	5d                   	pop    %ebp
+  802d1c:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802d1d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802d22:	29 c8                	sub    %ecx,%eax
+  802d24:	39 d0                	cmp    %edx,%eax
+  802d26:	0f 46 d0             	cmovbe %eax,%edx
+  802d29:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802d2b:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d31:	85 ff                	test   %edi,%edi
+  802d33:	0f 49 c7             	cmovns %edi,%eax
+  802d36:	c1 f8 0c             	sar    $0xc,%eax
+  802d39:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d3e:	e8 87 fc ff ff       	call   8029ca <nsbulk_own>
+  802d43:	85 c0                	test   %eax,%eax
+  802d45:	0f 88 17 01 00 00    	js     802e62 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802d4b:	83 ec 04             	sub    $0x4,%esp
+  802d4e:	56                   	push   %esi
+  802d4f:	ff 75 e0             	push   -0x20(%ebp)
+  802d52:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d55:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d5a:	50                   	push   %eax
+  802d5b:	e8 3c e0 ff ff       	call   800d9c <memmove>
+  802d60:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802d63:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802d66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d69:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d6c:	0f 84 fd 00 00 00    	je     802e6f <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802d72:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d75:	01 f7                	add    %esi,%edi
+  802d77:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d7a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d7d:	0f 8d 01 01 00 00    	jge    802e84 <nsipc_sendmsg+0x1d6>
+  802d83:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802d89:	0f 8f f0 00 00 00    	jg     802e7f <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802d8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d92:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802d95:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802d98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d9b:	89 c2                	mov    %eax,%edx
+  802d9d:	03 13                	add    (%ebx),%edx
+  802d9f:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802da2:	8b 73 04             	mov    0x4(%ebx),%esi
+  802da5:	29 c6                	sub    %eax,%esi
+  802da7:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802dac:	29 f9                	sub    %edi,%ecx
+  802dae:	39 ce                	cmp    %ecx,%esi
+  802db0:	89 ca                	mov    %ecx,%edx
+  802db2:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802db5:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802db8:	89 f9                	mov    %edi,%ecx
+  802dba:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802dc0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802dc3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802dc8:	09 c8                	or     %ecx,%eax
+  802dca:	0f 85 4d ff ff ff    	jne    802d1d <nsipc_sendmsg+0x6f>
+  802dd0:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802dd6:	0f 86 41 ff ff ff    	jbe    802d1d <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ddc:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802de2:	85 ff                	test   %edi,%edi
+  802de4:	0f 49 c7             	cmovns %edi,%eax
+  802de7:	c1 f8 0c             	sar    $0xc,%eax
+  802dea:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802dec:	89 d1                	mov    %edx,%ecx
+  802dee:	c1 e9 0c             	shr    $0xc,%ecx
+  802df1:	01 c8                	add    %ecx,%eax
+  802df3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802df6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802df9:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802dfb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802dfe:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e03:	29 c8                	sub    %ecx,%eax
+  802e05:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e08:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802e0b:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802e0d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e12:	89 f9                	mov    %edi,%ecx
+  802e14:	d3 e0                	shl    %cl,%eax
+  802e16:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e1c:	83 ec 08             	sub    $0x8,%esp
+  802e1f:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802e21:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802e24:	50                   	push   %eax
+  802e25:	6a 00                	push   $0x0
+  802e27:	56                   	push   %esi
+  802e28:	6a 00                	push   $0x0
+  802e2a:	68 e0 66 80 00       	push   $0x8066e0
+  802e2f:	e8 46 0f 00 00       	call   803d7a <pgbatch_map>
+  802e34:	83 c4 20             	add    $0x20,%esp
+  802e37:	85 c0                	test   %eax,%eax
+  802e39:	0f 88 ce fe ff ff    	js     802d0d <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e3f:	83 c7 01             	add    $0x1,%edi
+  802e42:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e48:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e4b:	39 c7                	cmp    %eax,%edi
+  802e4d:	75 be                	jne    802e0d <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802e4f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802e52:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802e55:	89 d6                	mov    %edx,%esi
+  802e57:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802e5d:	e9 01 ff ff ff       	jmp    802d63 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802e62:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e65:	85 db                	test   %ebx,%ebx
+  802e67:	0f 45 c3             	cmovne %ebx,%eax
+  802e6a:	e9 a6 fe ff ff       	jmp    802d15 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802e6f:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802e73:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e7a:	e9 f3 fe ff ff       	jmp    802d72 <nsipc_sendmsg+0xc4>
+  802e7f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802e82:	eb 03                	jmp    802e87 <nsipc_sendmsg+0x1d9>
+  802e84:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e87:	83 ec 0c             	sub    $0xc,%esp
+  802e8a:	68 e0 66 80 00       	push   $0x8066e0
+  802e8f:	e8 36 0e 00 00       	call   803cca <pgbatch_flush>
+  802e94:	83 c4 10             	add    $0x10,%esp
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	78 50                	js     802eeb <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9e:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802ea3:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802ea9:	89 fb                	mov    %edi,%ebx
+  802eab:	29 f3                	sub    %esi,%ebx
+  802ead:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802eb3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802eb6:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802ebb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802ec0:	89 fa                	mov    %edi,%edx
+  802ec2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802ec7:	e8 66 fb ff ff       	call   802a32 <nsipc_bulk>
+  802ecc:	85 c0                	test   %eax,%eax
+  802ece:	78 28                	js     802ef8 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802ed0:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802ed3:	39 c3                	cmp    %eax,%ebx
+  802ed5:	75 0c                	jne    802ee3 <nsipc_sendmsg+0x235>
+  802ed7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802eda:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802edd:	0f 8f f2 fd ff ff    	jg     802cd5 <nsipc_sendmsg+0x27>
+		sent += r;
+  802ee3:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802ee6:	e9 2a fe ff ff       	jmp    802d15 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802eeb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802eee:	85 db                	test   %ebx,%ebx
+  802ef0:	0f 45 c3             	cmovne %ebx,%eax
+  802ef3:	e9 1d fe ff ff       	jmp    802d15 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802ef8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802efb:	85 db                	test   %ebx,%ebx
+  802efd:	0f 45 c3             	cmovne %ebx,%eax
+  802f00:	e9 10 fe ff ff       	jmp    802d15 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802f05:	83 ec 0c             	sub    $0xc,%esp
+  802f08:	68 e0 66 80 00       	push   $0x8066e0
+  802f0d:	e8 aa 0d 00 00       	call   803cbc <pgbatch_init>
+  802f12:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f15:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f1f:	e9 63 ff ff ff       	jmp    802e87 <nsipc_sendmsg+0x1d9>
+
+00802f24 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802f24:	55                   	push   %ebp
+  802f25:	89 e5                	mov    %esp,%ebp
+  802f27:	57                   	push   %edi
+  802f28:	56                   	push   %esi
+  802f29:	53                   	push   %ebx
+  802f2a:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802f2d:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802f34:	0f 84 c8 00 00 00    	je     803002 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802f3a:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802f41:	0f 84 e4 00 00 00    	je     80302b <nsipc_sendfile+0x107>
+{
+  802f47:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802f4c:	89 fb                	mov    %edi,%ebx
+  802f4e:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802f51:	0f 83 f0 00 00 00    	jae    803047 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802f57:	89 fa                	mov    %edi,%edx
+  802f59:	03 55 10             	add    0x10(%ebp),%edx
+  802f5c:	89 d0                	mov    %edx,%eax
+  802f5e:	c1 f8 1f             	sar    $0x1f,%eax
+  802f61:	c1 e8 14             	shr    $0x14,%eax
+  802f64:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802f67:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802f6d:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f6f:	6a 10                	push   $0x10
+  802f71:	68 00 20 01 e0       	push   $0xe0012000
+  802f76:	52                   	push   %edx
+  802f77:	ff 75 0c             	push   0xc(%ebp)
+  802f7a:	e8 fe f4 ff ff       	call   80247d <fmap>
+  802f7f:	83 c4 10             	add    $0x10,%esp
+  802f82:	85 c0                	test   %eax,%eax
+  802f84:	0f 8e b8 00 00 00    	jle    803042 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802f8a:	39 c6                	cmp    %eax,%esi
+  802f8c:	0f 8d b5 00 00 00    	jge    803047 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802f92:	29 f0                	sub    %esi,%eax
+  802f94:	8b 55 14             	mov    0x14(%ebp),%edx
+  802f97:	29 da                	sub    %ebx,%edx
+  802f99:	39 d0                	cmp    %edx,%eax
+  802f9b:	89 d3                	mov    %edx,%ebx
+  802f9d:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802fa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fa3:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802fa8:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802fae:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802fb4:	8b 45 18             	mov    0x18(%ebp),%eax
+  802fb7:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802fbc:	83 ec 0c             	sub    $0xc,%esp
+  802fbf:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802fc1:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802fc8:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802fcb:	83 c0 01             	add    $0x1,%eax
+  802fce:	50                   	push   %eax
+  802fcf:	68 00 10 01 e0       	push   $0xe0011000
+  802fd4:	6a 11                	push   $0x11
+  802fd6:	ff 35 e4 69 80 00    	push   0x8069e4
+  802fdc:	e8 03 15 00 00       	call   8044e4 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802fe1:	83 c4 1c             	add    $0x1c,%esp
+  802fe4:	6a 00                	push   $0x0
+  802fe6:	6a 00                	push   $0x0
+  802fe8:	6a 00                	push   $0x0
+  802fea:	e8 31 12 00 00       	call   804220 <ipc_recv>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	78 5b                	js     803051 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802ff6:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802ff8:	39 c3                	cmp    %eax,%ebx
+  802ffa:	0f 8e 4c ff ff ff    	jle    802f4c <nsipc_sendfile+0x28>
+  803000:	eb 45                	jmp    803047 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803002:	83 ec 04             	sub    $0x4,%esp
+  803005:	6a 07                	push   $0x7
+  803007:	68 00 10 01 e0       	push   $0xe0011000
+  80300c:	6a 00                	push   $0x0
+  80300e:	e8 0d e0 ff ff       	call   801020 <sys_page_alloc>
+  803013:	89 c7                	mov    %eax,%edi
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	85 c0                	test   %eax,%eax
+  80301a:	78 2b                	js     803047 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80301c:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  803023:	00 00 00 
+  803026:	e9 0f ff ff ff       	jmp    802f3a <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80302b:	83 ec 0c             	sub    $0xc,%esp
+  80302e:	6a 03                	push   $0x3
+  803030:	e8 e4 14 00 00       	call   804519 <ipc_find_env>
+  803035:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80303a:	83 c4 10             	add    $0x10,%esp
+  80303d:	e9 05 ff ff ff       	jmp    802f47 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803042:	85 ff                	test   %edi,%edi
+  803044:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803047:	89 f8                	mov    %edi,%eax
+  803049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80304c:	5b                   	pop    %ebx
+  80304d:	5e                   	pop    %esi
+  80304e:	5f                   	pop    %edi
+  80304f:	5d                   	pop    %ebp
+  803050:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803051:	85 ff                	test   %edi,%edi
+  803053:	0f 44 f8             	cmove  %eax,%edi
+  803056:	eb ef                	jmp    803047 <nsipc_sendfile+0x123>
+
+00803058 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803058:	55                   	push   %ebp
+  803059:	89 e5                	mov    %esp,%ebp
+  80305b:	57                   	push   %edi
+  80305c:	56                   	push   %esi
+  80305d:	53                   	push   %ebx
+  80305e:	83 ec 1c             	sub    $0x1c,%esp
+  803061:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803064:	e8 13 f9 ff ff       	call   80297c <nsbulk_map>
+  803069:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	0f 88 ba 00 00 00    	js     80312e <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803074:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803078:	0f 8e bb 00 00 00    	jle    803139 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80307e:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803083:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803088:	bf 00 00 01 00       	mov    $0x10000,%edi
+  80308d:	89 f8                	mov    %edi,%eax
+  80308f:	29 f0                	sub    %esi,%eax
+  803091:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  803095:	39 c8                	cmp    %ecx,%eax
+  803097:	0f 47 c1             	cmova  %ecx,%eax
+  80309a:	01 f0                	add    %esi,%eax
+  80309c:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80309e:	83 c2 01             	add    $0x1,%edx
+  8030a1:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8030a4:	7e 07                	jle    8030ad <nsipc_recvmsg+0x55>
+  8030a6:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8030ab:	7e e0                	jle    80308d <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8030ad:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8030b3:	c1 fa 0c             	sar    $0xc,%edx
+  8030b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030bb:	e8 0a f9 ff ff       	call   8029ca <nsbulk_own>
+  8030c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030c3:	85 c0                	test   %eax,%eax
+  8030c5:	78 67                	js     80312e <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8030c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ca:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8030cf:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8030d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030d8:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8030dd:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030e2:	89 f2                	mov    %esi,%edx
+  8030e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8030e9:	e8 44 f9 ff ff       	call   802a32 <nsipc_bulk>
+  8030ee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	78 39                	js     80312e <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8030f5:	39 f0                	cmp    %esi,%eax
+  8030f7:	7f 4a                	jg     803143 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8030f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	7e 2c                	jle    80312e <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803102:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803105:	29 fe                	sub    %edi,%esi
+  803107:	8b 43 04             	mov    0x4(%ebx),%eax
+  80310a:	39 c6                	cmp    %eax,%esi
+  80310c:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80310f:	83 ec 04             	sub    $0x4,%esp
+  803112:	56                   	push   %esi
+  803113:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803119:	50                   	push   %eax
+  80311a:	ff 33                	push   (%ebx)
+  80311c:	e8 7b dc ff ff       	call   800d9c <memmove>
+		n += m;
+  803121:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803123:	83 c3 08             	add    $0x8,%ebx
+  803126:	83 c4 10             	add    $0x10,%esp
+  803129:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80312c:	7f d4                	jg     803102 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80312e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803134:	5b                   	pop    %ebx
+  803135:	5e                   	pop    %esi
+  803136:	5f                   	pop    %edi
+  803137:	5d                   	pop    %ebp
+  803138:	c3                   	ret
+	int r, i, n, len = 0;
+  803139:	be 00 00 00 00       	mov    $0x0,%esi
+  80313e:	e9 6a ff ff ff       	jmp    8030ad <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803143:	68 b8 4e 80 00       	push   $0x804eb8
+  803148:	68 c1 4e 80 00       	push   $0x804ec1
+  80314d:	68 3b 01 00 00       	push   $0x13b
+  803152:	68 d6 4e 80 00       	push   $0x804ed6
+  803157:	e8 be d2 ff ff       	call   80041a <_panic>
+
+0080315c <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80315c:	55                   	push   %ebp
+  80315d:	89 e5                	mov    %esp,%ebp
+  80315f:	57                   	push   %edi
+  803160:	56                   	push   %esi
+  803161:	53                   	push   %ebx
+  803162:	83 ec 0c             	sub    $0xc,%esp
+  803165:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803168:	8b 75 10             	mov    0x10(%ebp),%esi
+  80316b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80316e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803171:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  803176:	8b 07                	mov    (%edi),%eax
+  803178:	a3 04 80 80 00       	mov    %eax,0x808004
+  80317d:	8b 47 04             	mov    0x4(%edi),%eax
+  803180:	a3 08 80 80 00       	mov    %eax,0x808008
+  803185:	8b 47 08             	mov    0x8(%edi),%eax
+  803188:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  80318d:	8b 47 0c             	mov    0xc(%edi),%eax
+  803190:	a3 10 80 80 00       	mov    %eax,0x808010
+  803195:	8b 47 10             	mov    0x10(%edi),%eax
+  803198:	a3 14 80 80 00       	mov    %eax,0x808014
+  80319d:	8b 47 14             	mov    0x14(%edi),%eax
+  8031a0:	a3 18 80 80 00       	mov    %eax,0x808018
+  8031a5:	8b 47 18             	mov    0x18(%edi),%eax
+  8031a8:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8031ad:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8031b0:	a3 20 80 80 00       	mov    %eax,0x808020
+  8031b5:	8b 47 20             	mov    0x20(%edi),%eax
+  8031b8:	a3 24 80 80 00       	mov    %eax,0x808024
+  8031bd:	8b 47 24             	mov    0x24(%edi),%eax
+  8031c0:	a3 28 80 80 00       	mov    %eax,0x808028
+  8031c5:	8b 47 28             	mov    0x28(%edi),%eax
+  8031c8:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8031cd:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8031d0:	a3 30 80 80 00       	mov    %eax,0x808030
+  8031d5:	8b 47 30             	mov    0x30(%edi),%eax
+  8031d8:	a3 34 80 80 00       	mov    %eax,0x808034
+  8031dd:	8b 47 34             	mov    0x34(%edi),%eax
+  8031e0:	a3 38 80 80 00       	mov    %eax,0x808038
+  8031e5:	8b 47 38             	mov    0x38(%edi),%eax
+  8031e8:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8031ed:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8031f0:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8031f5:	8b 06                	mov    (%esi),%eax
+  8031f7:	a3 44 80 80 00       	mov    %eax,0x808044
+  8031fc:	8b 46 04             	mov    0x4(%esi),%eax
+  8031ff:	a3 48 80 80 00       	mov    %eax,0x808048
+  803204:	8b 46 08             	mov    0x8(%esi),%eax
+  803207:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80320c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80320f:	a3 50 80 80 00       	mov    %eax,0x808050
+  803214:	8b 46 10             	mov    0x10(%esi),%eax
+  803217:	a3 54 80 80 00       	mov    %eax,0x808054
+  80321c:	8b 46 14             	mov    0x14(%esi),%eax
+  80321f:	a3 58 80 80 00       	mov    %eax,0x808058
+  803224:	8b 46 18             	mov    0x18(%esi),%eax
+  803227:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80322c:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80322f:	a3 60 80 80 00       	mov    %eax,0x808060
+  803234:	8b 46 20             	mov    0x20(%esi),%eax
+  803237:	a3 64 80 80 00       	mov    %eax,0x808064
+  80323c:	8b 46 24             	mov    0x24(%esi),%eax
+  80323f:	a3 68 80 80 00       	mov    %eax,0x808068
+  803244:	8b 46 28             	mov    0x28(%esi),%eax
+  803247:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  80324c:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80324f:	a3 70 80 80 00       	mov    %eax,0x808070
+  803254:	8b 46 30             	mov    0x30(%esi),%eax
+  803257:	a3 74 80 80 00       	mov    %eax,0x808074
+  80325c:	8b 46 34             	mov    0x34(%esi),%eax
+  80325f:	a3 78 80 80 00       	mov    %eax,0x808078
+  803264:	8b 46 38             	mov    0x38(%esi),%eax
+  803267:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  80326c:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80326f:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803274:	8b 03                	mov    (%ebx),%eax
+  803276:	a3 84 80 80 00       	mov    %eax,0x808084
+  80327b:	8b 43 04             	mov    0x4(%ebx),%eax
+  80327e:	a3 88 80 80 00       	mov    %eax,0x808088
+  803283:	8b 43 08             	mov    0x8(%ebx),%eax
+  803286:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  80328b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80328e:	a3 90 80 80 00       	mov    %eax,0x808090
+  803293:	8b 43 10             	mov    0x10(%ebx),%eax
+  803296:	a3 94 80 80 00       	mov    %eax,0x808094
+  80329b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80329e:	a3 98 80 80 00       	mov    %eax,0x808098
+  8032a3:	8b 43 18             	mov    0x18(%ebx),%eax
+  8032a6:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8032ab:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8032ae:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8032b3:	8b 43 20             	mov    0x20(%ebx),%eax
+  8032b6:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8032bb:	8b 43 24             	mov    0x24(%ebx),%eax
+  8032be:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8032c3:	8b 43 28             	mov    0x28(%ebx),%eax
+  8032c6:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8032cb:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8032ce:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8032d3:	8b 43 30             	mov    0x30(%ebx),%eax
+  8032d6:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8032db:	8b 43 34             	mov    0x34(%ebx),%eax
+  8032de:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8032e3:	8b 43 38             	mov    0x38(%ebx),%eax
+  8032e6:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8032eb:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8032ee:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8032f3:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032f6:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8032fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803300:	e8 2b f6 ff ff       	call   802930 <nsipc>
+  803305:	85 c0                	test   %eax,%eax
+  803307:	0f 88 ad 01 00 00    	js     8034ba <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80330d:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803313:	89 17                	mov    %edx,(%edi)
+  803315:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80331b:	89 57 04             	mov    %edx,0x4(%edi)
+  80331e:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803324:	89 57 08             	mov    %edx,0x8(%edi)
+  803327:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80332d:	89 57 0c             	mov    %edx,0xc(%edi)
+  803330:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803336:	89 57 10             	mov    %edx,0x10(%edi)
+  803339:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80333f:	89 57 14             	mov    %edx,0x14(%edi)
+  803342:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803348:	89 57 18             	mov    %edx,0x18(%edi)
+  80334b:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803351:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803354:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80335a:	89 57 20             	mov    %edx,0x20(%edi)
+  80335d:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  803363:	89 57 24             	mov    %edx,0x24(%edi)
+  803366:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  80336c:	89 57 28             	mov    %edx,0x28(%edi)
+  80336f:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  803375:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803378:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  80337e:	89 57 30             	mov    %edx,0x30(%edi)
+  803381:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  803387:	89 57 34             	mov    %edx,0x34(%edi)
+  80338a:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803390:	89 57 38             	mov    %edx,0x38(%edi)
+  803393:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803399:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80339c:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8033a2:	89 16                	mov    %edx,(%esi)
+  8033a4:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8033aa:	89 56 04             	mov    %edx,0x4(%esi)
+  8033ad:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8033b3:	89 56 08             	mov    %edx,0x8(%esi)
+  8033b6:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8033bc:	89 56 0c             	mov    %edx,0xc(%esi)
+  8033bf:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8033c5:	89 56 10             	mov    %edx,0x10(%esi)
+  8033c8:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8033ce:	89 56 14             	mov    %edx,0x14(%esi)
+  8033d1:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8033d7:	89 56 18             	mov    %edx,0x18(%esi)
+  8033da:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8033e0:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8033e3:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8033e9:	89 56 20             	mov    %edx,0x20(%esi)
+  8033ec:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8033f2:	89 56 24             	mov    %edx,0x24(%esi)
+  8033f5:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8033fb:	89 56 28             	mov    %edx,0x28(%esi)
+  8033fe:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803404:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803407:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80340d:	89 56 30             	mov    %edx,0x30(%esi)
+  803410:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803416:	89 56 34             	mov    %edx,0x34(%esi)
+  803419:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80341f:	89 56 38             	mov    %edx,0x38(%esi)
+  803422:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803428:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80342b:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  803431:	89 13                	mov    %edx,(%ebx)
+  803433:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803439:	89 53 04             	mov    %edx,0x4(%ebx)
+  80343c:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803442:	89 53 08             	mov    %edx,0x8(%ebx)
+  803445:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  80344b:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80344e:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803454:	89 53 10             	mov    %edx,0x10(%ebx)
+  803457:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  80345d:	89 53 14             	mov    %edx,0x14(%ebx)
+  803460:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  803466:	89 53 18             	mov    %edx,0x18(%ebx)
+  803469:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  80346f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803472:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803478:	89 53 20             	mov    %edx,0x20(%ebx)
+  80347b:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803481:	89 53 24             	mov    %edx,0x24(%ebx)
+  803484:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  80348a:	89 53 28             	mov    %edx,0x28(%ebx)
+  80348d:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803493:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803496:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  80349c:	89 53 30             	mov    %edx,0x30(%ebx)
+  80349f:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8034a5:	89 53 34             	mov    %edx,0x34(%ebx)
+  8034a8:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8034ae:	89 53 38             	mov    %edx,0x38(%ebx)
+  8034b1:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8034b7:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8034ba:	83 c4 0c             	add    $0xc,%esp
+  8034bd:	5b                   	pop    %ebx
+  8034be:	5e                   	pop    %esi
+  8034bf:	5f                   	pop    %edi
+  8034c0:	5d                   	pop    %ebp
+  8034c1:	c3                   	ret
+
+008034c2 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8034c2:	55                   	push   %ebp
+  8034c3:	89 e5                	mov    %esp,%ebp
+  8034c5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8034c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034cb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8034d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034d3:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8034d8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034db:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8034e0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8034e5:	e8 46 f4 ff ff       	call   802930 <nsipc>
+}
+  8034ea:	c9                   	leave
+  8034eb:	c3                   	ret
+
+008034ec <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8034ec:	55                   	push   %ebp
+  8034ed:	89 e5                	mov    %esp,%ebp
+  8034ef:	56                   	push   %esi
+  8034f0:	53                   	push   %ebx
+  8034f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8034f4:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8034fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034fd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803502:	b8 10 00 00 00       	mov    $0x10,%eax
+  803507:	e8 24 f4 ff ff       	call   802930 <nsipc>
+  80350c:	89 c3                	mov    %eax,%ebx
+  80350e:	85 c0                	test   %eax,%eax
+  803510:	7e 1f                	jle    803531 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803512:	39 c6                	cmp    %eax,%esi
+  803514:	7c 24                	jl     80353a <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803516:	83 ec 04             	sub    $0x4,%esp
+  803519:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803520:	50                   	push   %eax
+  803521:	68 00 80 80 00       	push   $0x808000
+  803526:	ff 75 08             	push   0x8(%ebp)
+  803529:	e8 6e d8 ff ff       	call   800d9c <memmove>
+  80352e:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803531:	89 d8                	mov    %ebx,%eax
+  803533:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803536:	5b                   	pop    %ebx
+  803537:	5e                   	pop    %esi
+  803538:	5d                   	pop    %ebp
+  803539:	c3                   	ret
+		assert(r <= max);
+  80353a:	68 ee 4e 80 00       	push   $0x804eee
+  80353f:	68 c1 4e 80 00       	push   $0x804ec1
+  803544:	68 6a 01 00 00       	push   $0x16a
+  803549:	68 d6 4e 80 00       	push   $0x804ed6
+  80354e:	e8 c7 ce ff ff       	call   80041a <_panic>
+
+00803553 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803553:	55                   	push   %ebp
+  803554:	89 e5                	mov    %esp,%ebp
+  803556:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803559:	8b 45 08             	mov    0x8(%ebp),%eax
+  80355c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803561:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803564:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803569:	8b 45 10             	mov    0x10(%ebp),%eax
+  80356c:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803571:	b8 09 00 00 00       	mov    $0x9,%eax
+  803576:	e8 b5 f3 ff ff       	call   802930 <nsipc>
+}
+  80357b:	c9                   	leave
+  80357c:	c3                   	ret
+
+0080357d <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  80357d:	55                   	push   %ebp
+  80357e:	89 e5                	mov    %esp,%ebp
+  803580:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803583:	8b 45 08             	mov    0x8(%ebp),%eax
+  803586:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  80358b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803590:	e8 9b f3 ff ff       	call   802930 <nsipc>
+}
+  803595:	c9                   	leave
+  803596:	c3                   	ret
+
+00803597 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803597:	55                   	push   %ebp
+  803598:	89 e5                	mov    %esp,%ebp
+  80359a:	53                   	push   %ebx
+  80359b:	83 ec 04             	sub    $0x4,%esp
+  80359e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8035a1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8035a6:	e8 85 f3 ff ff       	call   802930 <nsipc>
+  8035ab:	85 c0                	test   %eax,%eax
+  8035ad:	78 50                	js     8035ff <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8035af:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8035b5:	89 13                	mov    %edx,(%ebx)
+  8035b7:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8035bd:	89 53 04             	mov    %edx,0x4(%ebx)
+  8035c0:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8035c6:	89 53 08             	mov    %edx,0x8(%ebx)
+  8035c9:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8035cf:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8035d2:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8035d8:	89 53 10             	mov    %edx,0x10(%ebx)
+  8035db:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8035e1:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035e4:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8035ea:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035ed:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8035f3:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035f6:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8035fc:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8035ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803602:	c9                   	leave
+  803603:	c3                   	ret
+
+00803604 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803604:	55                   	push   %ebp
+  803605:	89 e5                	mov    %esp,%ebp
+  803607:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80360a:	6a 03                	push   $0x3
+  80360c:	e8 08 0f 00 00       	call   804519 <ipc_find_env>
+  803611:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803616:	8b 45 08             	mov    0x8(%ebp),%eax
+  803619:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80361e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803623:	e8 08 f3 ff ff       	call   802930 <nsipc>
+  803628:	83 c4 10             	add    $0x10,%esp
+  80362b:	85 c0                	test   %eax,%eax
+  80362d:	78 0a                	js     803639 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80362f:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803634:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803639:	c9                   	leave
+  80363a:	c3                   	ret
+
+0080363b <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80363b:	55                   	push   %ebp
+  80363c:	89 e5                	mov    %esp,%ebp
+  80363e:	57                   	push   %edi
+  80363f:	56                   	push   %esi
+  803640:	53                   	push   %ebx
+  803641:	83 ec 1c             	sub    $0x1c,%esp
+  803644:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803647:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80364a:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80364f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803654:	89 e0                	mov    %esp,%eax
+  803656:	89 f2                	mov    %esi,%edx
+  803658:	29 c2                	sub    %eax,%edx
+  80365a:	89 d0                	mov    %edx,%eax
+  80365c:	c1 e8 0f             	shr    $0xf,%eax
+  80365f:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803665:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803668:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  80366f:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803672:	83 ec 0c             	sub    $0xc,%esp
+  803675:	ff 75 e0             	push   -0x20(%ebp)
+  803678:	e8 db 0e 00 00       	call   804558 <pageref>
+  80367d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803680:	83 c4 04             	add    $0x4,%esp
+  803683:	ff 75 dc             	push   -0x24(%ebp)
+  803686:	e8 cd 0e 00 00       	call   804558 <pageref>
+  80368b:	89 e2                	mov    %esp,%edx
+  80368d:	89 f1                	mov    %esi,%ecx
+  80368f:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803691:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803694:	89 ca                	mov    %ecx,%edx
+  803696:	c1 ea 0f             	shr    $0xf,%edx
+  803699:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80369f:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8036a2:	8b 14 95 00 6e 80 00 	mov    0x806e00(,%edx,4),%edx
+  8036a9:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8036ac:	39 d7                	cmp    %edx,%edi
+  8036ae:	74 40                	je     8036f0 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8036b0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036b3:	75 9f                	jne    803654 <_pipeisclosed+0x19>
+  8036b5:	89 e2                	mov    %esp,%edx
+  8036b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036bc:	29 d0                	sub    %edx,%eax
+  8036be:	89 c2                	mov    %eax,%edx
+  8036c0:	c1 ea 0f             	shr    $0xf,%edx
+  8036c3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036cd:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036d0:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8036d7:	8b 40 58             	mov    0x58(%eax),%eax
+  8036da:	6a 01                	push   $0x1
+  8036dc:	50                   	push   %eax
+  8036dd:	57                   	push   %edi
+  8036de:	68 f7 4e 80 00       	push   $0x804ef7
+  8036e3:	e8 0d ce ff ff       	call   8004f5 <cprintf>
+  8036e8:	83 c4 10             	add    $0x10,%esp
+  8036eb:	e9 5f ff ff ff       	jmp    80364f <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8036f0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036f3:	0f 94 c0             	sete   %al
+  8036f6:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8036f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036fc:	5b                   	pop    %ebx
+  8036fd:	5e                   	pop    %esi
+  8036fe:	5f                   	pop    %edi
+  8036ff:	5d                   	pop    %ebp
+  803700:	c3                   	ret
+
+00803701 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803701:	55                   	push   %ebp
+  803702:	89 e5                	mov    %esp,%ebp
+  803704:	53                   	push   %ebx
+  803705:	83 ec 0c             	sub    $0xc,%esp
+  803708:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80370b:	53                   	push   %ebx
+  80370c:	6a 00                	push   $0x0
+  80370e:	e8 92 d9 ff ff       	call   8010a5 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803713:	89 1c 24             	mov    %ebx,(%esp)
+  803716:	e8 f4 e4 ff ff       	call   801c0f <fd2data>
+  80371b:	83 c4 08             	add    $0x8,%esp
+  80371e:	50                   	push   %eax
+  80371f:	6a 00                	push   $0x0
+  803721:	e8 7f d9 ff ff       	call   8010a5 <sys_page_unmap>
+}
+  803726:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803729:	c9                   	leave
+  80372a:	c3                   	ret
+
+0080372b <devpipe_read>:
+{
+  80372b:	55                   	push   %ebp
+  80372c:	89 e5                	mov    %esp,%ebp
+  80372e:	57                   	push   %edi
+  80372f:	56                   	push   %esi
+  803730:	53                   	push   %ebx
+  803731:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803734:	ff 75 08             	push   0x8(%ebp)
+  803737:	e8 d3 e4 ff ff       	call   801c0f <fd2data>
+  80373c:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80373e:	8b 70 04             	mov    0x4(%eax),%esi
+  803741:	8b 00                	mov    (%eax),%eax
+  803743:	83 c4 10             	add    $0x10,%esp
+  803746:	39 f0                	cmp    %esi,%eax
+  803748:	75 36                	jne    803780 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80374a:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  80374d:	89 da                	mov    %ebx,%edx
+  80374f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803752:	e8 e4 fe ff ff       	call   80363b <_pipeisclosed>
+  803757:	85 c0                	test   %eax,%eax
+  803759:	0f 85 d4 00 00 00    	jne    803833 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80375f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803764:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803768:	83 ec 04             	sub    $0x4,%esp
+  80376b:	6a ff                	push   $0xffffffff
+  80376d:	56                   	push   %esi
+  80376e:	57                   	push   %edi
+  80376f:	e8 aa dc ff ff       	call   80141e <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803774:	8b 73 04             	mov    0x4(%ebx),%esi
+  803777:	8b 03                	mov    (%ebx),%eax
+  803779:	83 c4 10             	add    $0x10,%esp
+  80377c:	39 c6                	cmp    %eax,%esi
+  80377e:	74 cd                	je     80374d <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803780:	8b 73 04             	mov    0x4(%ebx),%esi
+  803783:	8b 03                	mov    (%ebx),%eax
+  803785:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80378b:	29 c6                	sub    %eax,%esi
+  80378d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803792:	f7 e6                	mul    %esi
+  803794:	c1 ea 0c             	shr    $0xc,%edx
+  803797:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80379d:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80379f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037a2:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8037a6:	8b 0b                	mov    (%ebx),%ecx
+  8037a8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037ad:	f7 e1                	mul    %ecx
+  8037af:	c1 ea 0b             	shr    $0xb,%edx
+  8037b2:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8037b8:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8037ba:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8037bf:	29 cf                	sub    %ecx,%edi
+  8037c1:	39 f7                	cmp    %esi,%edi
+  8037c3:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8037c6:	83 ec 04             	sub    $0x4,%esp
+  8037c9:	57                   	push   %edi
+  8037ca:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8037ce:	50                   	push   %eax
+  8037cf:	ff 75 0c             	push   0xc(%ebp)
+  8037d2:	e8 c5 d5 ff ff       	call   800d9c <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8037d7:	83 c4 0c             	add    $0xc,%esp
+  8037da:	89 f0                	mov    %esi,%eax
+  8037dc:	29 f8                	sub    %edi,%eax
+  8037de:	50                   	push   %eax
+  8037df:	8d 43 10             	lea    0x10(%ebx),%eax
+  8037e2:	50                   	push   %eax
+  8037e3:	89 f8                	mov    %edi,%eax
+  8037e5:	03 45 0c             	add    0xc(%ebp),%eax
+  8037e8:	50                   	push   %eax
+  8037e9:	e8 ae d5 ff ff       	call   800d9c <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8037ee:	8b 0b                	mov    (%ebx),%ecx
+  8037f0:	01 f1                	add    %esi,%ecx
+  8037f2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037f7:	f7 e1                	mul    %ecx
+  8037f9:	c1 ea 0c             	shr    $0xc,%edx
+  8037fc:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803802:	29 c1                	sub    %eax,%ecx
+  803804:	89 0b                	mov    %ecx,(%ebx)
+  803806:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380b:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80380f:	83 c4 10             	add    $0x10,%esp
+  803812:	85 c0                	test   %eax,%eax
+  803814:	75 0a                	jne    803820 <devpipe_read+0xf5>
+	return n;
+  803816:	89 f0                	mov    %esi,%eax
+}
+  803818:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80381b:	5b                   	pop    %ebx
+  80381c:	5e                   	pop    %esi
+  80381d:	5f                   	pop    %edi
+  80381e:	5d                   	pop    %ebp
+  80381f:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803820:	83 ec 08             	sub    $0x8,%esp
+  803823:	68 00 04 00 00       	push   $0x400
+  803828:	53                   	push   %ebx
+  803829:	e8 12 dc ff ff       	call   801440 <sys_futex_wake>
+  80382e:	83 c4 10             	add    $0x10,%esp
+  803831:	eb e3                	jmp    803816 <devpipe_read+0xeb>
+			return 0;
+  803833:	b8 00 00 00 00       	mov    $0x0,%eax
+  803838:	eb de                	jmp    803818 <devpipe_read+0xed>
+
+0080383a <devpipe_write>:
+{
+  80383a:	55                   	push   %ebp
+  80383b:	89 e5                	mov    %esp,%ebp
+  80383d:	57                   	push   %edi
+  80383e:	56                   	push   %esi
+  80383f:	53                   	push   %ebx
+  803840:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803843:	ff 75 08             	push   0x8(%ebp)
+  803846:	e8 c4 e3 ff ff       	call   801c0f <fd2data>
+  80384b:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  80384d:	83 c4 10             	add    $0x10,%esp
+  803850:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803857:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80385c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803860:	0f 84 43 01 00 00    	je     8039a9 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803866:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803869:	8b 06                	mov    (%esi),%eax
+  80386b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803871:	29 c1                	sub    %eax,%ecx
+  803873:	89 c8                	mov    %ecx,%eax
+  803875:	f7 e7                	mul    %edi
+  803877:	c1 ea 0c             	shr    $0xc,%edx
+  80387a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803880:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803882:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803888:	75 52                	jne    8038dc <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80388a:	89 f2                	mov    %esi,%edx
+  80388c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80388f:	e8 a7 fd ff ff       	call   80363b <_pipeisclosed>
+  803894:	85 c0                	test   %eax,%eax
+  803896:	0f 85 28 01 00 00    	jne    8039c4 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80389c:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80389e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038a1:	8b 06                	mov    (%esi),%eax
+  8038a3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038a9:	29 c1                	sub    %eax,%ecx
+  8038ab:	89 c8                	mov    %ecx,%eax
+  8038ad:	f7 e7                	mul    %edi
+  8038af:	c1 ea 0c             	shr    $0xc,%edx
+  8038b2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038b8:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8038ba:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8038c0:	75 a4                	jne    803866 <devpipe_write+0x2c>
+  8038c2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038c7:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8038cb:	83 ec 04             	sub    $0x4,%esp
+  8038ce:	6a ff                	push   $0xffffffff
+  8038d0:	53                   	push   %ebx
+  8038d1:	56                   	push   %esi
+  8038d2:	e8 47 db ff ff       	call   80141e <sys_futex_wait>
+}
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	eb 8a                	jmp    803866 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038dc:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038df:	8b 06                	mov    (%esi),%eax
+  8038e1:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038e7:	29 c1                	sub    %eax,%ecx
+  8038e9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038ee:	f7 e1                	mul    %ecx
+  8038f0:	c1 ea 0c             	shr    $0xc,%edx
+  8038f3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038f9:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8038fb:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803900:	89 d8                	mov    %ebx,%eax
+  803902:	29 c8                	sub    %ecx,%eax
+  803904:	8b 55 10             	mov    0x10(%ebp),%edx
+  803907:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80390a:	29 ca                	sub    %ecx,%edx
+  80390c:	39 d0                	cmp    %edx,%eax
+  80390e:	0f 46 d0             	cmovbe %eax,%edx
+  803911:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803914:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803917:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80391c:	f7 e1                	mul    %ecx
+  80391e:	c1 ea 0b             	shr    $0xb,%edx
+  803921:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803927:	89 ca                	mov    %ecx,%edx
+  803929:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80392b:	29 d3                	sub    %edx,%ebx
+  80392d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803930:	39 c3                	cmp    %eax,%ebx
+  803932:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803935:	83 ec 04             	sub    $0x4,%esp
+  803938:	53                   	push   %ebx
+  803939:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80393c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80393f:	51                   	push   %ecx
+  803940:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803944:	50                   	push   %eax
+  803945:	e8 52 d4 ff ff       	call   800d9c <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80394a:	83 c4 0c             	add    $0xc,%esp
+  80394d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803950:	29 d8                	sub    %ebx,%eax
+  803952:	50                   	push   %eax
+  803953:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803956:	01 cb                	add    %ecx,%ebx
+  803958:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80395b:	53                   	push   %ebx
+  80395c:	8d 46 10             	lea    0x10(%esi),%eax
+  80395f:	50                   	push   %eax
+  803960:	e8 37 d4 ff ff       	call   800d9c <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803965:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803968:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80396b:	01 c1                	add    %eax,%ecx
+  80396d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803972:	f7 e1                	mul    %ecx
+  803974:	c1 ea 0c             	shr    $0xc,%edx
+  803977:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80397d:	89 ca                	mov    %ecx,%edx
+  80397f:	29 c2                	sub    %eax,%edx
+  803981:	89 56 04             	mov    %edx,0x4(%esi)
+  803984:	b8 00 00 00 00       	mov    $0x0,%eax
+  803989:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  80398d:	83 c4 10             	add    $0x10,%esp
+  803990:	85 c0                	test   %eax,%eax
+  803992:	75 1a                	jne    8039ae <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803994:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803997:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80399a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80399d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8039a0:	0f 82 c0 fe ff ff    	jb     803866 <devpipe_write+0x2c>
+  8039a6:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8039a9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8039ac:	eb 1b                	jmp    8039c9 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8039ae:	83 ec 08             	sub    $0x8,%esp
+  8039b1:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8039b6:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8039b9:	50                   	push   %eax
+  8039ba:	e8 81 da ff ff       	call   801440 <sys_futex_wake>
+  8039bf:	83 c4 10             	add    $0x10,%esp
+  8039c2:	eb d0                	jmp    803994 <devpipe_write+0x15a>
+				return 0;
+  8039c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039cc:	5b                   	pop    %ebx
+  8039cd:	5e                   	pop    %esi
+  8039ce:	5f                   	pop    %edi
+  8039cf:	5d                   	pop    %ebp
+  8039d0:	c3                   	ret
+
+008039d1 <devpipe_stat>:
+{
+  8039d1:	55                   	push   %ebp
+  8039d2:	89 e5                	mov    %esp,%ebp
+  8039d4:	56                   	push   %esi
+  8039d5:	53                   	push   %ebx
+  8039d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039d9:	83 ec 0c             	sub    $0xc,%esp
+  8039dc:	ff 75 08             	push   0x8(%ebp)
+  8039df:	e8 2b e2 ff ff       	call   801c0f <fd2data>
+  8039e4:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8039e6:	83 c4 08             	add    $0x8,%esp
+  8039e9:	68 0a 4f 80 00       	push   $0x804f0a
+  8039ee:	53                   	push   %ebx
+  8039ef:	e8 f8 d1 ff ff       	call   800bec <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039f4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039f7:	8b 06                	mov    (%esi),%eax
+  8039f9:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039ff:	29 c1                	sub    %eax,%ecx
+  803a01:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a06:	89 c8                	mov    %ecx,%eax
+  803a08:	f7 e2                	mul    %edx
+  803a0a:	c1 ea 0c             	shr    $0xc,%edx
+  803a0d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a13:	29 d1                	sub    %edx,%ecx
+  803a15:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803a1b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803a22:	00 00 00 
+	stat->st_dev = &devpipe;
+  803a25:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803a2c:	50 80 00 
+}
+  803a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a37:	5b                   	pop    %ebx
+  803a38:	5e                   	pop    %esi
+  803a39:	5d                   	pop    %ebp
+  803a3a:	c3                   	ret
+
+00803a3b <devpipe_poll>:
+{
+  803a3b:	55                   	push   %ebp
+  803a3c:	89 e5                	mov    %esp,%ebp
+  803a3e:	57                   	push   %edi
+  803a3f:	56                   	push   %esi
+  803a40:	53                   	push   %ebx
+  803a41:	83 ec 18             	sub    $0x18,%esp
+  803a44:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a47:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a4a:	57                   	push   %edi
+  803a4b:	e8 bf e1 ff ff       	call   801c0f <fd2data>
+  803a50:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a52:	83 c4 10             	add    $0x10,%esp
+  803a55:	89 f3                	mov    %esi,%ebx
+  803a57:	83 e3 01             	and    $0x1,%ebx
+  803a5a:	75 27                	jne    803a83 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803a5c:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803a62:	75 48                	jne    803aac <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803a64:	89 ca                	mov    %ecx,%edx
+  803a66:	89 f8                	mov    %edi,%eax
+  803a68:	e8 ce fb ff ff       	call   80363b <_pipeisclosed>
+  803a6d:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803a6f:	89 d8                	mov    %ebx,%eax
+  803a71:	83 c8 10             	or     $0x10,%eax
+  803a74:	85 d2                	test   %edx,%edx
+  803a76:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803a79:	89 d8                	mov    %ebx,%eax
+  803a7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a7e:	5b                   	pop    %ebx
+  803a7f:	5e                   	pop    %esi
+  803a80:	5f                   	pop    %edi
+  803a81:	5d                   	pop    %ebp
+  803a82:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a83:	8b 58 04             	mov    0x4(%eax),%ebx
+  803a86:	8b 00                	mov    (%eax),%eax
+  803a88:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803a8e:	29 c3                	sub    %eax,%ebx
+  803a90:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a95:	89 d8                	mov    %ebx,%eax
+  803a97:	f7 e2                	mul    %edx
+  803a99:	c1 ea 0c             	shr    $0xc,%edx
+  803a9c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803aa2:	39 d3                	cmp    %edx,%ebx
+  803aa4:	0f 95 c3             	setne  %bl
+  803aa7:	0f b6 db             	movzbl %bl,%ebx
+  803aaa:	eb b0                	jmp    803a5c <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803aac:	8b 71 04             	mov    0x4(%ecx),%esi
+  803aaf:	8b 01                	mov    (%ecx),%eax
+  803ab1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803ab7:	29 c6                	sub    %eax,%esi
+  803ab9:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803abe:	89 f0                	mov    %esi,%eax
+  803ac0:	f7 e2                	mul    %edx
+  803ac2:	c1 ea 0c             	shr    $0xc,%edx
+  803ac5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803acb:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803acd:	89 d8                	mov    %ebx,%eax
+  803acf:	83 c8 04             	or     $0x4,%eax
+  803ad2:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803ad8:	0f 42 d8             	cmovb  %eax,%ebx
+  803adb:	eb 87                	jmp    803a64 <devpipe_poll+0x29>
+
+00803add <pipe>:
+{
+  803add:	55                   	push   %ebp
+  803ade:	89 e5                	mov    %esp,%ebp
+  803ae0:	56                   	push   %esi
+  803ae1:	53                   	push   %ebx
+  803ae2:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803ae5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803ae8:	50                   	push   %eax
+  803ae9:	e8 38 e1 ff ff       	call   801c26 <fd_alloc>
+  803aee:	89 c3                	mov    %eax,%ebx
+  803af0:	83 c4 10             	add    $0x10,%esp
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	0f 88 23 01 00 00    	js     803c1e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803afb:	83 ec 04             	sub    $0x4,%esp
+  803afe:	68 07 04 00 00       	push   $0x407
+  803b03:	ff 75 f4             	push   -0xc(%ebp)
+  803b06:	6a 00                	push   $0x0
+  803b08:	e8 13 d5 ff ff       	call   801020 <sys_page_alloc>
+  803b0d:	89 c3                	mov    %eax,%ebx
+  803b0f:	83 c4 10             	add    $0x10,%esp
+  803b12:	85 c0                	test   %eax,%eax
+  803b14:	0f 88 04 01 00 00    	js     803c1e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803b1a:	83 ec 0c             	sub    $0xc,%esp
+  803b1d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803b20:	50                   	push   %eax
+  803b21:	e8 00 e1 ff ff       	call   801c26 <fd_alloc>
+  803b26:	89 c3                	mov    %eax,%ebx
+  803b28:	83 c4 10             	add    $0x10,%esp
+  803b2b:	85 c0                	test   %eax,%eax
+  803b2d:	0f 88 db 00 00 00    	js     803c0e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b33:	83 ec 04             	sub    $0x4,%esp
+  803b36:	68 07 04 00 00       	push   $0x407
+  803b3b:	ff 75 f0             	push   -0x10(%ebp)
+  803b3e:	6a 00                	push   $0x0
+  803b40:	e8 db d4 ff ff       	call   801020 <sys_page_alloc>
+  803b45:	89 c3                	mov    %eax,%ebx
+  803b47:	83 c4 10             	add    $0x10,%esp
+  803b4a:	85 c0                	test   %eax,%eax
+  803b4c:	0f 88 bc 00 00 00    	js     803c0e <pipe+0x131>
+	va = fd2data(fd0);
+  803b52:	83 ec 0c             	sub    $0xc,%esp
+  803b55:	ff 75 f4             	push   -0xc(%ebp)
+  803b58:	e8 b2 e0 ff ff       	call   801c0f <fd2data>
+  803b5d:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b5f:	83 c4 0c             	add    $0xc,%esp
+  803b62:	68 07 04 00 00       	push   $0x407
+  803b67:	50                   	push   %eax
+  803b68:	6a 00                	push   $0x0
+  803b6a:	e8 b1 d4 ff ff       	call   801020 <sys_page_alloc>
+  803b6f:	89 c3                	mov    %eax,%ebx
+  803b71:	83 c4 10             	add    $0x10,%esp
+  803b74:	85 c0                	test   %eax,%eax
+  803b76:	0f 88 82 00 00 00    	js     803bfe <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b7c:	83 ec 0c             	sub    $0xc,%esp
+  803b7f:	ff 75 f0             	push   -0x10(%ebp)
+  803b82:	e8 88 e0 ff ff       	call   801c0f <fd2data>
+  803b87:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b8e:	50                   	push   %eax
+  803b8f:	6a 00                	push   $0x0
+  803b91:	56                   	push   %esi
+  803b92:	6a 00                	push   $0x0
+  803b94:	e8 ca d4 ff ff       	call   801063 <sys_page_map>
+  803b99:	89 c3                	mov    %eax,%ebx
+  803b9b:	83 c4 20             	add    $0x20,%esp
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	78 4e                	js     803bf0 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803ba2:	a1 60 50 80 00       	mov    0x805060,%eax
+  803ba7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803baa:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803bac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803baf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803bb6:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803bb9:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803bbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bbe:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803bc5:	83 ec 0c             	sub    $0xc,%esp
+  803bc8:	ff 75 f4             	push   -0xc(%ebp)
+  803bcb:	e8 2f e0 ff ff       	call   801bff <fd2num>
+  803bd0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bd3:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803bd5:	83 c4 04             	add    $0x4,%esp
+  803bd8:	ff 75 f0             	push   -0x10(%ebp)
+  803bdb:	e8 1f e0 ff ff       	call   801bff <fd2num>
+  803be0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803be3:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803be6:	83 c4 10             	add    $0x10,%esp
+  803be9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bee:	eb 2e                	jmp    803c1e <pipe+0x141>
+	sys_page_unmap(0, va);
+  803bf0:	83 ec 08             	sub    $0x8,%esp
+  803bf3:	56                   	push   %esi
+  803bf4:	6a 00                	push   $0x0
+  803bf6:	e8 aa d4 ff ff       	call   8010a5 <sys_page_unmap>
+  803bfb:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bfe:	83 ec 08             	sub    $0x8,%esp
+  803c01:	ff 75 f0             	push   -0x10(%ebp)
+  803c04:	6a 00                	push   $0x0
+  803c06:	e8 9a d4 ff ff       	call   8010a5 <sys_page_unmap>
+  803c0b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803c0e:	83 ec 08             	sub    $0x8,%esp
+  803c11:	ff 75 f4             	push   -0xc(%ebp)
+  803c14:	6a 00                	push   $0x0
+  803c16:	e8 8a d4 ff ff       	call   8010a5 <sys_page_unmap>
+  803c1b:	83 c4 10             	add    $0x10,%esp
+}
+  803c1e:	89 d8                	mov    %ebx,%eax
+  803c20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c23:	5b                   	pop    %ebx
+  803c24:	5e                   	pop    %esi
+  803c25:	5d                   	pop    %ebp
+  803c26:	c3                   	ret
+
+00803c27 <pipeisclosed>:
+{
+  803c27:	55                   	push   %ebp
+  803c28:	89 e5                	mov    %esp,%ebp
+  803c2a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c2d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c30:	50                   	push   %eax
+  803c31:	ff 75 08             	push   0x8(%ebp)
+  803c34:	e8 3d e0 ff ff       	call   801c76 <fd_lookup>
+  803c39:	83 c4 10             	add    $0x10,%esp
+  803c3c:	85 c0                	test   %eax,%eax
+  803c3e:	78 18                	js     803c58 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c40:	83 ec 0c             	sub    $0xc,%esp
+  803c43:	ff 75 f4             	push   -0xc(%ebp)
+  803c46:	e8 c4 df ff ff       	call   801c0f <fd2data>
+  803c4b:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c50:	e8 e6 f9 ff ff       	call   80363b <_pipeisclosed>
+  803c55:	83 c4 10             	add    $0x10,%esp
+}
+  803c58:	c9                   	leave
+  803c59:	c3                   	ret
+
+00803c5a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c5a:	55                   	push   %ebp
+  803c5b:	89 e5                	mov    %esp,%ebp
+  803c5d:	56                   	push   %esi
+  803c5e:	53                   	push   %ebx
+  803c5f:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c62:	85 f6                	test   %esi,%esi
+  803c64:	74 40                	je     803ca6 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803c66:	89 f3                	mov    %esi,%ebx
+  803c68:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c6e:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803c74:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c79:	8b 40 48             	mov    0x48(%eax),%eax
+  803c7c:	39 c6                	cmp    %eax,%esi
+  803c7e:	75 1f                	jne    803c9f <wait+0x45>
+  803c80:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803c86:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c8c:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c8f:	85 c0                	test   %eax,%eax
+  803c91:	74 0c                	je     803c9f <wait+0x45>
+		sys_yield();
+  803c93:	e8 69 d3 ff ff       	call   801001 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c98:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c9b:	39 f0                	cmp    %esi,%eax
+  803c9d:	74 ed                	je     803c8c <wait+0x32>
+}
+  803c9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ca2:	5b                   	pop    %ebx
+  803ca3:	5e                   	pop    %esi
+  803ca4:	5d                   	pop    %ebp
+  803ca5:	c3                   	ret
+	assert(envid != 0);
+  803ca6:	68 16 4f 80 00       	push   $0x804f16
+  803cab:	68 c1 4e 80 00       	push   $0x804ec1
+  803cb0:	6a 09                	push   $0x9
+  803cb2:	68 21 4f 80 00       	push   $0x804f21
+  803cb7:	e8 5e c7 ff ff       	call   80041a <_panic>
+
+00803cbc <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803cbc:	55                   	push   %ebp
+  803cbd:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803cc8:	5d                   	pop    %ebp
+  803cc9:	c3                   	ret
+
+00803cca <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803cca:	55                   	push   %ebp
+  803ccb:	89 e5                	mov    %esp,%ebp
+  803ccd:	53                   	push   %ebx
+  803cce:	83 ec 04             	sub    $0x4,%esp
+  803cd1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803cd4:	8b 03                	mov    (%ebx),%eax
+  803cd6:	85 c0                	test   %eax,%eax
+  803cd8:	75 05                	jne    803cdf <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803cda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cdd:	c9                   	leave
+  803cde:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803cdf:	83 ec 08             	sub    $0x8,%esp
+  803ce2:	50                   	push   %eax
+  803ce3:	8d 43 04             	lea    0x4(%ebx),%eax
+  803ce6:	50                   	push   %eax
+  803ce7:	e8 09 d6 ff ff       	call   8012f5 <sys_page_batch>
+	pb->pb_n = 0;
+  803cec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803cf2:	83 c4 10             	add    $0x10,%esp
+  803cf5:	eb e3                	jmp    803cda <pgbatch_flush+0x10>
+
+00803cf7 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803cf7:	55                   	push   %ebp
+  803cf8:	89 e5                	mov    %esp,%ebp
+  803cfa:	56                   	push   %esi
+  803cfb:	53                   	push   %ebx
+  803cfc:	89 c3                	mov    %eax,%ebx
+  803cfe:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d00:	83 38 20             	cmpl   $0x20,(%eax)
+  803d03:	74 2c                	je     803d31 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803d05:	8b 03                	mov    (%ebx),%eax
+  803d07:	8d 50 01             	lea    0x1(%eax),%edx
+  803d0a:	89 13                	mov    %edx,(%ebx)
+  803d0c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803d0f:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803d13:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803d15:	83 ec 04             	sub    $0x4,%esp
+  803d18:	6a 18                	push   $0x18
+  803d1a:	6a 00                	push   $0x0
+  803d1c:	50                   	push   %eax
+  803d1d:	e8 45 d0 ff ff       	call   800d67 <memset>
+	return 0;
+  803d22:	83 c4 10             	add    $0x10,%esp
+  803d25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d2d:	5b                   	pop    %ebx
+  803d2e:	5e                   	pop    %esi
+  803d2f:	5d                   	pop    %ebp
+  803d30:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d31:	83 ec 0c             	sub    $0xc,%esp
+  803d34:	50                   	push   %eax
+  803d35:	e8 90 ff ff ff       	call   803cca <pgbatch_flush>
+  803d3a:	83 c4 10             	add    $0x10,%esp
+  803d3d:	85 c0                	test   %eax,%eax
+  803d3f:	79 c4                	jns    803d05 <pgbatch_slot+0xe>
+  803d41:	eb e7                	jmp    803d2a <pgbatch_slot+0x33>
+
+00803d43 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d49:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d4f:	e8 a3 ff ff ff       	call   803cf7 <pgbatch_slot>
+  803d54:	85 c0                	test   %eax,%eax
+  803d56:	78 20                	js     803d78 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803d58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d5b:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803d61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d64:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d67:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d6a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d6d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d70:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d78:	c9                   	leave
+  803d79:	c3                   	ret
+
+00803d7a <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803d7a:	55                   	push   %ebp
+  803d7b:	89 e5                	mov    %esp,%ebp
+  803d7d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d80:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d83:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d86:	e8 6c ff ff ff       	call   803cf7 <pgbatch_slot>
+  803d8b:	85 c0                	test   %eax,%eax
+  803d8d:	78 2c                	js     803dbb <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803d8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d92:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803d98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d9b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803d9e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803da1:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803da4:	8b 55 14             	mov    0x14(%ebp),%edx
+  803da7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803daa:	8b 55 18             	mov    0x18(%ebp),%edx
+  803dad:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803db0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803db3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803db6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dbb:	c9                   	leave
+  803dbc:	c3                   	ret
+
+00803dbd <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803dbd:	55                   	push   %ebp
+  803dbe:	89 e5                	mov    %esp,%ebp
+  803dc0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dc3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc9:	e8 29 ff ff ff       	call   803cf7 <pgbatch_slot>
+  803dce:	85 c0                	test   %eax,%eax
+  803dd0:	78 1a                	js     803dec <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803dd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dd5:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dde:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803de1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803de4:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803de7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dec:	c9                   	leave
+  803ded:	c3                   	ret
+
+00803dee <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803dee:	55                   	push   %ebp
+  803def:	89 e5                	mov    %esp,%ebp
+  803df1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803df4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803df7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dfa:	e8 f8 fe ff ff       	call   803cf7 <pgbatch_slot>
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	78 20                	js     803e23 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e06:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803e0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e0f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e12:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e15:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e18:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e1b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e23:	c9                   	leave
+  803e24:	c3                   	ret
+
+00803e25 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803e25:	55                   	push   %ebp
+  803e26:	89 e5                	mov    %esp,%ebp
+  803e28:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e2b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e31:	e8 c1 fe ff ff       	call   803cf7 <pgbatch_slot>
+  803e36:	85 c0                	test   %eax,%eax
+  803e38:	78 26                	js     803e60 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803e3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e3d:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803e43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e46:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803e49:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e4c:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e4f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e52:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803e55:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e58:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e60:	c9                   	leave
+  803e61:	c3                   	ret
+
+00803e62 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803e62:	55                   	push   %ebp
+  803e63:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803e65:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e68:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e6e:	5d                   	pop    %ebp
+  803e6f:	c3                   	ret
+
+00803e70 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803e70:	55                   	push   %ebp
+  803e71:	89 e5                	mov    %esp,%ebp
+  803e73:	56                   	push   %esi
+  803e74:	53                   	push   %ebx
+  803e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e7d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e82:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e86:	85 c0                	test   %eax,%eax
+  803e88:	74 2f                	je     803eb9 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803e8a:	83 f8 02             	cmp    $0x2,%eax
+  803e8d:	74 0c                	je     803e9b <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803e8f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e94:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803e97:	85 c0                	test   %eax,%eax
+  803e99:	74 1e                	je     803eb9 <mutex_lock+0x49>
+  803e9b:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803ea0:	83 ec 04             	sub    $0x4,%esp
+  803ea3:	6a ff                	push   $0xffffffff
+  803ea5:	6a 02                	push   $0x2
+  803ea7:	53                   	push   %ebx
+  803ea8:	e8 71 d5 ff ff       	call   80141e <sys_futex_wait>
+  803ead:	89 f0                	mov    %esi,%eax
+  803eaf:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803eb2:	83 c4 10             	add    $0x10,%esp
+  803eb5:	85 c0                	test   %eax,%eax
+  803eb7:	75 e7                	jne    803ea0 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803eb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ebc:	5b                   	pop    %ebx
+  803ebd:	5e                   	pop    %esi
+  803ebe:	5d                   	pop    %ebp
+  803ebf:	c3                   	ret
+
+00803ec0 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803ec0:	55                   	push   %ebp
+  803ec1:	89 e5                	mov    %esp,%ebp
+  803ec3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ed0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803ed4:	85 c0                	test   %eax,%eax
+  803ed6:	0f 94 c0             	sete   %al
+  803ed9:	0f b6 c0             	movzbl %al,%eax
+}
+  803edc:	5d                   	pop    %ebp
+  803edd:	c3                   	ret
+
+00803ede <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803ede:	55                   	push   %ebp
+  803edf:	89 e5                	mov    %esp,%ebp
+  803ee1:	83 ec 08             	sub    $0x8,%esp
+  803ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eec:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803eef:	83 f8 02             	cmp    $0x2,%eax
+  803ef2:	74 02                	je     803ef6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ef4:	c9                   	leave
+  803ef5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803ef6:	83 ec 08             	sub    $0x8,%esp
+  803ef9:	6a 01                	push   $0x1
+  803efb:	52                   	push   %edx
+  803efc:	e8 3f d5 ff ff       	call   801440 <sys_futex_wake>
+  803f01:	83 c4 10             	add    $0x10,%esp
+}
+  803f04:	eb ee                	jmp    803ef4 <mutex_unlock+0x16>
+
+00803f06 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803f06:	55                   	push   %ebp
+  803f07:	89 e5                	mov    %esp,%ebp
+  803f09:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803f0c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803f12:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803f19:	5d                   	pop    %ebp
+  803f1a:	c3                   	ret
+
+00803f1b <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803f1b:	55                   	push   %ebp
+  803f1c:	89 e5                	mov    %esp,%ebp
+  803f1e:	57                   	push   %edi
+  803f1f:	56                   	push   %esi
+  803f20:	53                   	push   %ebx
+  803f21:	83 ec 18             	sub    $0x18,%esp
+  803f24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803f2a:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803f2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f31:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803f36:	57                   	push   %edi
+  803f37:	e8 a2 ff ff ff       	call   803ede <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f3c:	83 c4 0c             	add    $0xc,%esp
+  803f3f:	ff 75 10             	push   0x10(%ebp)
+  803f42:	56                   	push   %esi
+  803f43:	53                   	push   %ebx
+  803f44:	e8 d5 d4 ff ff       	call   80141e <sys_futex_wait>
+  803f49:	89 c6                	mov    %eax,%esi
+  803f4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803f50:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803f55:	89 3c 24             	mov    %edi,(%esp)
+  803f58:	e8 13 ff ff ff       	call   803e70 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803f5d:	83 c4 10             	add    $0x10,%esp
+  803f60:	83 fe ef             	cmp    $0xffffffef,%esi
+  803f63:	74 05                	je     803f6a <cond_timedwait+0x4f>
+  803f65:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f6a:	89 f0                	mov    %esi,%eax
+  803f6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f6f:	5b                   	pop    %ebx
+  803f70:	5e                   	pop    %esi
+  803f71:	5f                   	pop    %edi
+  803f72:	5d                   	pop    %ebp
+  803f73:	c3                   	ret
+
+00803f74 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f74:	55                   	push   %ebp
+  803f75:	89 e5                	mov    %esp,%ebp
+  803f77:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803f7a:	6a ff                	push   $0xffffffff
+  803f7c:	ff 75 0c             	push   0xc(%ebp)
+  803f7f:	ff 75 08             	push   0x8(%ebp)
+  803f82:	e8 94 ff ff ff       	call   803f1b <cond_timedwait>
+}
+  803f87:	83 c4 10             	add    $0x10,%esp
+  803f8a:	c9                   	leave
+  803f8b:	c3                   	ret
+
+00803f8c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f8c:	55                   	push   %ebp
+  803f8d:	89 e5                	mov    %esp,%ebp
+  803f8f:	83 ec 08             	sub    $0x8,%esp
+  803f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f95:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f9a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f9e:	8b 50 04             	mov    0x4(%eax),%edx
+  803fa1:	85 d2                	test   %edx,%edx
+  803fa3:	75 02                	jne    803fa7 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803fa7:	83 ec 08             	sub    $0x8,%esp
+  803faa:	6a 01                	push   $0x1
+  803fac:	50                   	push   %eax
+  803fad:	e8 8e d4 ff ff       	call   801440 <sys_futex_wake>
+  803fb2:	83 c4 10             	add    $0x10,%esp
+}
+  803fb5:	eb ee                	jmp    803fa5 <cond_signal+0x19>
+
+00803fb7 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803fb7:	55                   	push   %ebp
+  803fb8:	89 e5                	mov    %esp,%ebp
+  803fba:	83 ec 08             	sub    $0x8,%esp
+  803fbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fc0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803fc5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803fc9:	8b 50 04             	mov    0x4(%eax),%edx
+  803fcc:	85 d2                	test   %edx,%edx
+  803fce:	75 02                	jne    803fd2 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803fd0:	c9                   	leave
+  803fd1:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803fd2:	83 ec 08             	sub    $0x8,%esp
+  803fd5:	68 00 04 00 00       	push   $0x400
+  803fda:	50                   	push   %eax
+  803fdb:	e8 60 d4 ff ff       	call   801440 <sys_futex_wake>
+  803fe0:	83 c4 10             	add    $0x10,%esp
+}
+  803fe3:	eb eb                	jmp    803fd0 <cond_broadcast+0x19>
+
+00803fe5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803fe5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fea:	c3                   	ret
+
+00803feb <devcons_poll>:
+{
+  803feb:	55                   	push   %ebp
+  803fec:	89 e5                	mov    %esp,%ebp
+  803fee:	53                   	push   %ebx
+  803fef:	83 ec 04             	sub    $0x4,%esp
+  803ff2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ff5:	89 da                	mov    %ebx,%edx
+  803ff7:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803ffa:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  804001:	74 0c                	je     80400f <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804003:	89 d8                	mov    %ebx,%eax
+  804005:	83 e0 01             	and    $0x1,%eax
+  804008:	09 d0                	or     %edx,%eax
+}
+  80400a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80400d:	c9                   	leave
+  80400e:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80400f:	e8 6e cf ff ff       	call   800f82 <sys_cgetc>
+  804014:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804019:	89 da                	mov    %ebx,%edx
+  80401b:	83 e2 04             	and    $0x4,%edx
+  80401e:	85 c0                	test   %eax,%eax
+  804020:	74 e6                	je     804008 <devcons_poll+0x1d>
+  804022:	eb df                	jmp    804003 <devcons_poll+0x18>
+
+00804024 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804024:	55                   	push   %ebp
+  804025:	89 e5                	mov    %esp,%ebp
+  804027:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80402a:	68 2c 4f 80 00       	push   $0x804f2c
+  80402f:	ff 75 0c             	push   0xc(%ebp)
+  804032:	e8 b5 cb ff ff       	call   800bec <strcpy>
+	return 0;
+}
+  804037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80403c:	c9                   	leave
+  80403d:	c3                   	ret
+
+0080403e <devcons_write>:
+{
+  80403e:	55                   	push   %ebp
+  80403f:	89 e5                	mov    %esp,%ebp
+  804041:	57                   	push   %edi
+  804042:	56                   	push   %esi
+  804043:	53                   	push   %ebx
+  804044:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80404a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80404d:	85 ff                	test   %edi,%edi
+  80404f:	74 51                	je     8040a2 <devcons_write+0x64>
+  804051:	be 00 00 00 00       	mov    $0x0,%esi
+  804056:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80405b:	89 fb                	mov    %edi,%ebx
+  80405d:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80405f:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804064:	39 d3                	cmp    %edx,%ebx
+  804066:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804069:	83 ec 04             	sub    $0x4,%esp
+  80406c:	53                   	push   %ebx
+  80406d:	03 45 0c             	add    0xc(%ebp),%eax
+  804070:	50                   	push   %eax
+  804071:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804077:	50                   	push   %eax
+  804078:	e8 1f cd ff ff       	call   800d9c <memmove>
+		sys_cputs(buf, m);
+  80407d:	83 c4 08             	add    $0x8,%esp
+  804080:	53                   	push   %ebx
+  804081:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804087:	50                   	push   %eax
+  804088:	e8 d7 ce ff ff       	call   800f64 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80408d:	01 de                	add    %ebx,%esi
+  80408f:	89 f0                	mov    %esi,%eax
+  804091:	83 c4 10             	add    $0x10,%esp
+  804094:	39 fe                	cmp    %edi,%esi
+  804096:	72 c3                	jb     80405b <devcons_write+0x1d>
+}
+  804098:	89 f0                	mov    %esi,%eax
+  80409a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80409d:	5b                   	pop    %ebx
+  80409e:	5e                   	pop    %esi
+  80409f:	5f                   	pop    %edi
+  8040a0:	5d                   	pop    %ebp
+  8040a1:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8040a2:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8040a7:	eb ef                	jmp    804098 <devcons_write+0x5a>
+
+008040a9 <devcons_read>:
+{
+  8040a9:	55                   	push   %ebp
+  8040aa:	89 e5                	mov    %esp,%ebp
+  8040ac:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8040af:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8040b4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8040b8:	74 36                	je     8040f0 <devcons_read+0x47>
+	c = cons_peek;
+  8040ba:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  8040bf:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  8040c6:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040c9:	85 c0                	test   %eax,%eax
+  8040cb:	75 10                	jne    8040dd <devcons_read+0x34>
+  8040cd:	e8 b0 ce ff ff       	call   800f82 <sys_cgetc>
+  8040d2:	85 c0                	test   %eax,%eax
+  8040d4:	75 07                	jne    8040dd <devcons_read+0x34>
+		sys_yield();
+  8040d6:	e8 26 cf ff ff       	call   801001 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040db:	eb f0                	jmp    8040cd <devcons_read+0x24>
+	if (c < 0)
+  8040dd:	85 c0                	test   %eax,%eax
+  8040df:	78 0f                	js     8040f0 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8040e1:	83 f8 04             	cmp    $0x4,%eax
+  8040e4:	74 0c                	je     8040f2 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8040e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8040e9:	88 02                	mov    %al,(%edx)
+	return 1;
+  8040eb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8040f0:	c9                   	leave
+  8040f1:	c3                   	ret
+		return 0;
+  8040f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f7:	eb f7                	jmp    8040f0 <devcons_read+0x47>
+
+008040f9 <cputchar>:
+{
+  8040f9:	55                   	push   %ebp
+  8040fa:	89 e5                	mov    %esp,%ebp
+  8040fc:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8040ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  804102:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804105:	6a 01                	push   $0x1
+  804107:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80410a:	50                   	push   %eax
+  80410b:	e8 54 ce ff ff       	call   800f64 <sys_cputs>
+}
+  804110:	83 c4 10             	add    $0x10,%esp
+  804113:	c9                   	leave
+  804114:	c3                   	ret
+
+00804115 <getchar>:
+{
+  804115:	55                   	push   %ebp
+  804116:	89 e5                	mov    %esp,%ebp
+  804118:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80411b:	6a 01                	push   $0x1
+  80411d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804120:	50                   	push   %eax
+  804121:	6a 00                	push   $0x0
+  804123:	e8 d2 dd ff ff       	call   801efa <read>
+	if (r < 0)
+  804128:	83 c4 10             	add    $0x10,%esp
+  80412b:	85 c0                	test   %eax,%eax
+  80412d:	78 06                	js     804135 <getchar+0x20>
+	if (r < 1)
+  80412f:	74 06                	je     804137 <getchar+0x22>
+	return c;
+  804131:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804135:	c9                   	leave
+  804136:	c3                   	ret
+		return -E_EOF;
+  804137:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80413c:	eb f7                	jmp    804135 <getchar+0x20>
+
+0080413e <iscons>:
+{
+  80413e:	55                   	push   %ebp
+  80413f:	89 e5                	mov    %esp,%ebp
+  804141:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804144:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804147:	50                   	push   %eax
+  804148:	ff 75 08             	push   0x8(%ebp)
+  80414b:	e8 26 db ff ff       	call   801c76 <fd_lookup>
+  804150:	83 c4 10             	add    $0x10,%esp
+  804153:	85 c0                	test   %eax,%eax
+  804155:	78 11                	js     804168 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804157:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80415a:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804160:	39 10                	cmp    %edx,(%eax)
+  804162:	0f 94 c0             	sete   %al
+  804165:	0f b6 c0             	movzbl %al,%eax
+}
+  804168:	c9                   	leave
+  804169:	c3                   	ret
+
+0080416a <opencons>:
+{
+  80416a:	55                   	push   %ebp
+  80416b:	89 e5                	mov    %esp,%ebp
+  80416d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804170:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804173:	50                   	push   %eax
+  804174:	e8 ad da ff ff       	call   801c26 <fd_alloc>
+  804179:	83 c4 10             	add    $0x10,%esp
+  80417c:	85 c0                	test   %eax,%eax
+  80417e:	78 3a                	js     8041ba <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804180:	83 ec 04             	sub    $0x4,%esp
+  804183:	68 07 04 00 00       	push   $0x407
+  804188:	ff 75 f4             	push   -0xc(%ebp)
+  80418b:	6a 00                	push   $0x0
+  80418d:	e8 8e ce ff ff       	call   801020 <sys_page_alloc>
+  804192:	83 c4 10             	add    $0x10,%esp
+  804195:	85 c0                	test   %eax,%eax
+  804197:	78 21                	js     8041ba <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80419c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8041a2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8041a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041a7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8041ae:	83 ec 0c             	sub    $0xc,%esp
+  8041b1:	50                   	push   %eax
+  8041b2:	e8 48 da ff ff       	call   801bff <fd2num>
+  8041b7:	83 c4 10             	add    $0x10,%esp
+}
+  8041ba:	c9                   	leave
+  8041bb:	c3                   	ret
+
+008041bc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8041bc:	55                   	push   %ebp
+  8041bd:	89 e5                	mov    %esp,%ebp
+  8041bf:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8041c2:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8041c9:	74 0a                	je     8041d5 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8041cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041ce:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8041d3:	c9                   	leave
+  8041d4:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8041d5:	83 ec 04             	sub    $0x4,%esp
+  8041d8:	6a 07                	push   $0x7
+  8041da:	68 00 f0 bf ee       	push   $0xeebff000
+  8041df:	6a 00                	push   $0x0
+  8041e1:	e8 3a ce ff ff       	call   801020 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8041e6:	83 c4 08             	add    $0x8,%esp
+  8041e9:	68 fa 41 80 00       	push   $0x8041fa
+  8041ee:	6a 00                	push   $0x0
+  8041f0:	e8 76 cf ff ff       	call   80116b <sys_env_set_pgfault_upcall>
+  8041f5:	83 c4 10             	add    $0x10,%esp
+  8041f8:	eb d1                	jmp    8041cb <set_pgfault_handler+0xf>
+
+008041fa <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8041fa:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8041fb:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804200:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804202:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804205:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804209:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80420c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804210:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804212:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804216:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804219:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80421a:	83 c4 04             	add    $0x4,%esp
+	popf
+  80421d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80421e:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80421f:	c3                   	ret
+
+00804220 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804220:	55                   	push   %ebp
+  804221:	89 e5                	mov    %esp,%ebp
+  804223:	56                   	push   %esi
+  804224:	53                   	push   %ebx
+  804225:	8b 75 08             	mov    0x8(%ebp),%esi
+  804228:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80422b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804235:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804238:	83 ec 0c             	sub    $0xc,%esp
+  80423b:	50                   	push   %eax
+  80423c:	e8 8f cf ff ff       	call   8011d0 <sys_ipc_recv>
+  804241:	83 c4 10             	add    $0x10,%esp
+  804244:	85 c0                	test   %eax,%eax
+  804246:	0f 88 8b 00 00 00    	js     8042d7 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80424c:	85 f6                	test   %esi,%esi
+  80424e:	74 2a                	je     80427a <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804250:	89 e2                	mov    %esp,%edx
+  804252:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804257:	29 d0                	sub    %edx,%eax
+  804259:	89 c2                	mov    %eax,%edx
+  80425b:	c1 ea 0f             	shr    $0xf,%edx
+  80425e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804263:	b8 00 00 00 00       	mov    $0x0,%eax
+  804268:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80426b:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  804272:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804278:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80427a:	85 db                	test   %ebx,%ebx
+  80427c:	74 2a                	je     8042a8 <ipc_recv+0x88>
+  80427e:	89 e2                	mov    %esp,%edx
+  804280:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804285:	29 d0                	sub    %edx,%eax
+  804287:	89 c2                	mov    %eax,%edx
+  804289:	c1 ea 0f             	shr    $0xf,%edx
+  80428c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804291:	b8 00 00 00 00       	mov    $0x0,%eax
+  804296:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804299:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8042a0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8042a6:	89 03                	mov    %eax,(%ebx)
+  8042a8:	89 e2                	mov    %esp,%edx
+  8042aa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042af:	29 d0                	sub    %edx,%eax
+  8042b1:	89 c2                	mov    %eax,%edx
+  8042b3:	c1 ea 0f             	shr    $0xf,%edx
+  8042b6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8042c3:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8042ca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8042d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042d3:	5b                   	pop    %ebx
+  8042d4:	5e                   	pop    %esi
+  8042d5:	5d                   	pop    %ebp
+  8042d6:	c3                   	ret
+		if(from_env_store != NULL)
+  8042d7:	85 f6                	test   %esi,%esi
+  8042d9:	74 06                	je     8042e1 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8042db:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8042e1:	85 db                	test   %ebx,%ebx
+  8042e3:	74 eb                	je     8042d0 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8042e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8042eb:	eb e3                	jmp    8042d0 <ipc_recv+0xb0>
+
+008042ed <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8042ed:	55                   	push   %ebp
+  8042ee:	89 e5                	mov    %esp,%ebp
+  8042f0:	57                   	push   %edi
+  8042f1:	56                   	push   %esi
+  8042f2:	53                   	push   %ebx
+  8042f3:	83 ec 14             	sub    $0x14,%esp
+  8042f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042fc:	8b 75 14             	mov    0x14(%ebp),%esi
+  8042ff:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804302:	85 c0                	test   %eax,%eax
+  804304:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804309:	0f 44 c2             	cmove  %edx,%eax
+  80430c:	ff 75 10             	push   0x10(%ebp)
+  80430f:	50                   	push   %eax
+  804310:	e8 1d cf ff ff       	call   801232 <sys_ipc_recv_pages>
+  804315:	83 c4 10             	add    $0x10,%esp
+  804318:	85 c0                	test   %eax,%eax
+  80431a:	0f 88 ba 00 00 00    	js     8043da <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804320:	85 ff                	test   %edi,%edi
+  804322:	74 2a                	je     80434e <ipc_recv_pages+0x61>
+  804324:	89 e2                	mov    %esp,%edx
+  804326:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80432b:	29 d0                	sub    %edx,%eax
+  80432d:	89 c2                	mov    %eax,%edx
+  80432f:	c1 ea 0f             	shr    $0xf,%edx
+  804332:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80433f:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  804346:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80434c:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80434e:	85 f6                	test   %esi,%esi
+  804350:	74 2a                	je     80437c <ipc_recv_pages+0x8f>
+  804352:	89 e2                	mov    %esp,%edx
+  804354:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804359:	29 d0                	sub    %edx,%eax
+  80435b:	89 c2                	mov    %eax,%edx
+  80435d:	c1 ea 0f             	shr    $0xf,%edx
+  804360:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80436a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80436d:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  804374:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80437a:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80437c:	85 db                	test   %ebx,%ebx
+  80437e:	74 2a                	je     8043aa <ipc_recv_pages+0xbd>
+  804380:	89 e2                	mov    %esp,%edx
+  804382:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804387:	29 d0                	sub    %edx,%eax
+  804389:	89 c2                	mov    %eax,%edx
+  80438b:	c1 ea 0f             	shr    $0xf,%edx
+  80438e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804393:	b8 00 00 00 00       	mov    $0x0,%eax
+  804398:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80439b:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8043a2:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8043a8:	89 03                	mov    %eax,(%ebx)
+  8043aa:	89 e2                	mov    %esp,%edx
+  8043ac:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043b1:	29 d0                	sub    %edx,%eax
+  8043b3:	89 c2                	mov    %eax,%edx
+  8043b5:	c1 ea 0f             	shr    $0xf,%edx
+  8043b8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8043c5:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  8043cc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8043d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043d5:	5b                   	pop    %ebx
+  8043d6:	5e                   	pop    %esi
+  8043d7:	5f                   	pop    %edi
+  8043d8:	5d                   	pop    %ebp
+  8043d9:	c3                   	ret
+		if (from_env_store)
+  8043da:	85 ff                	test   %edi,%edi
+  8043dc:	74 06                	je     8043e4 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8043de:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8043e4:	85 f6                	test   %esi,%esi
+  8043e6:	74 06                	je     8043ee <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8043e8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8043ee:	85 db                	test   %ebx,%ebx
+  8043f0:	74 e0                	je     8043d2 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8043f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8043f8:	eb d8                	jmp    8043d2 <ipc_recv_pages+0xe5>
+
+008043fa <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8043fa:	55                   	push   %ebp
+  8043fb:	89 e5                	mov    %esp,%ebp
+  8043fd:	57                   	push   %edi
+  8043fe:	56                   	push   %esi
+  8043ff:	53                   	push   %ebx
+  804400:	83 ec 1c             	sub    $0x1c,%esp
+  804403:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804406:	8b 75 08             	mov    0x8(%ebp),%esi
+  804409:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80440f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804413:	75 2b                	jne    804440 <ipc_try_send_pages+0x46>
+  804415:	89 e2                	mov    %esp,%edx
+  804417:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80441c:	29 d0                	sub    %edx,%eax
+  80441e:	89 c2                	mov    %eax,%edx
+  804420:	c1 ea 0f             	shr    $0xf,%edx
+  804423:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442d:	0f 42 c2             	cmovb  %edx,%eax
+  804430:	8b 04 85 00 6e 80 00 	mov    0x806e00(,%eax,4),%eax
+  804437:	8b 70 48             	mov    0x48(%eax),%esi
+  80443a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804440:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804446:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80444b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80444e:	85 ff                	test   %edi,%edi
+  804450:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804455:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804458:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80445e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804464:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80446a:	83 ec 0c             	sub    $0xc,%esp
+  80446d:	ff 75 14             	push   0x14(%ebp)
+  804470:	ff 75 18             	push   0x18(%ebp)
+  804473:	57                   	push   %edi
+  804474:	ff 75 0c             	push   0xc(%ebp)
+  804477:	ff 75 08             	push   0x8(%ebp)
+  80447a:	e8 92 cd ff ff       	call   801211 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80447f:	83 c4 20             	add    $0x20,%esp
+  804482:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804485:	75 21                	jne    8044a8 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804487:	83 ec 04             	sub    $0x4,%esp
+  80448a:	6a ff                	push   $0xffffffff
+  80448c:	53                   	push   %ebx
+  80448d:	ff 75 e4             	push   -0x1c(%ebp)
+  804490:	e8 89 cf ff ff       	call   80141e <sys_futex_wait>
+  804495:	83 c4 10             	add    $0x10,%esp
+  804498:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80449b:	74 c7                	je     804464 <ipc_try_send_pages+0x6a>
+  80449d:	85 c0                	test   %eax,%eax
+  80449f:	79 c3                	jns    804464 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8044a1:	e8 5b cb ff ff       	call   801001 <sys_yield>
+  8044a6:	eb bc                	jmp    804464 <ipc_try_send_pages+0x6a>
+	}
+}
+  8044a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044ab:	5b                   	pop    %ebx
+  8044ac:	5e                   	pop    %esi
+  8044ad:	5f                   	pop    %edi
+  8044ae:	5d                   	pop    %ebp
+  8044af:	c3                   	ret
+
+008044b0 <ipc_send>:
+{
+  8044b0:	55                   	push   %ebp
+  8044b1:	89 e5                	mov    %esp,%ebp
+  8044b3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8044b6:	ff 75 14             	push   0x14(%ebp)
+  8044b9:	6a 01                	push   $0x1
+  8044bb:	ff 75 10             	push   0x10(%ebp)
+  8044be:	ff 75 0c             	push   0xc(%ebp)
+  8044c1:	ff 75 08             	push   0x8(%ebp)
+  8044c4:	e8 31 ff ff ff       	call   8043fa <ipc_try_send_pages>
+  8044c9:	83 c4 20             	add    $0x20,%esp
+  8044cc:	85 c0                	test   %eax,%eax
+  8044ce:	78 02                	js     8044d2 <ipc_send+0x22>
+}
+  8044d0:	c9                   	leave
+  8044d1:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8044d2:	50                   	push   %eax
+  8044d3:	68 38 4f 80 00       	push   $0x804f38
+  8044d8:	6a 3f                	push   $0x3f
+  8044da:	68 4d 4f 80 00       	push   $0x804f4d
+  8044df:	e8 36 bf ff ff       	call   80041a <_panic>
+
+008044e4 <ipc_send_pages>:
+{
+  8044e4:	55                   	push   %ebp
+  8044e5:	89 e5                	mov    %esp,%ebp
+  8044e7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8044ea:	ff 75 18             	push   0x18(%ebp)
+  8044ed:	ff 75 14             	push   0x14(%ebp)
+  8044f0:	ff 75 10             	push   0x10(%ebp)
+  8044f3:	ff 75 0c             	push   0xc(%ebp)
+  8044f6:	ff 75 08             	push   0x8(%ebp)
+  8044f9:	e8 fc fe ff ff       	call   8043fa <ipc_try_send_pages>
+  8044fe:	83 c4 20             	add    $0x20,%esp
+  804501:	85 c0                	test   %eax,%eax
+  804503:	78 02                	js     804507 <ipc_send_pages+0x23>
+}
+  804505:	c9                   	leave
+  804506:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804507:	50                   	push   %eax
+  804508:	68 57 4f 80 00       	push   $0x804f57
+  80450d:	6a 64                	push   $0x64
+  80450f:	68 4d 4f 80 00       	push   $0x804f4d
+  804514:	e8 01 bf ff ff       	call   80041a <_panic>
+
+00804519 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804519:	55                   	push   %ebp
+  80451a:	89 e5                	mov    %esp,%ebp
+  80451c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80451f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804524:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80452a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804530:	8b 52 50             	mov    0x50(%edx),%edx
+  804533:	39 ca                	cmp    %ecx,%edx
+  804535:	74 11                	je     804548 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804537:	83 c0 01             	add    $0x1,%eax
+  80453a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80453f:	75 e3                	jne    804524 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804541:	b8 00 00 00 00       	mov    $0x0,%eax
+  804546:	eb 0e                	jmp    804556 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804548:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80454e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804553:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804556:	5d                   	pop    %ebp
+  804557:	c3                   	ret
+
+00804558 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804558:	55                   	push   %ebp
+  804559:	89 e5                	mov    %esp,%ebp
+  80455b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80455e:	89 c2                	mov    %eax,%edx
+  804560:	c1 ea 16             	shr    $0x16,%edx
+  804563:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80456a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80456f:	f6 c1 01             	test   $0x1,%cl
+  804572:	74 1e                	je     804592 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804574:	c1 e8 0c             	shr    $0xc,%eax
+  804577:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80457e:	a8 01                	test   $0x1,%al
+  804580:	74 10                	je     804592 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804582:	c1 e8 0c             	shr    $0xc,%eax
+  804585:	c1 e0 04             	shl    $0x4,%eax
+  804588:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80458f:	0f b7 d2             	movzwl %dx,%edx
+}
+  804592:	89 d0                	mov    %edx,%eax
+  804594:	5d                   	pop    %ebp
+  804595:	c3                   	ret
+
+00804596 <__udivdi3>:
+  804596:	57                   	push   %edi
+  804597:	56                   	push   %esi
+  804598:	53                   	push   %ebx
+  804599:	83 ec 20             	sub    $0x20,%esp
+  80459c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8045a0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8045a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8045a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8045ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8045b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8045b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8045b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8045bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045cb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045d2:	00 
+  8045d3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045da:	00 
+  8045db:	eb 08                	jmp    8045e5 <__udivdi3+0x4f>
+  8045dd:	83 e9 01             	sub    $0x1,%ecx
+  8045e0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8045e3:	74 68                	je     80464d <__udivdi3+0xb7>
+  8045e5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8045e9:	01 c0                	add    %eax,%eax
+  8045eb:	89 c6                	mov    %eax,%esi
+  8045ed:	89 d7                	mov    %edx,%edi
+  8045ef:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8045f3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8045f7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045fa:	d3 ea                	shr    %cl,%edx
+  8045fc:	f6 c1 20             	test   $0x20,%cl
+  8045ff:	74 04                	je     804605 <__udivdi3+0x6f>
+  804601:	89 d0                	mov    %edx,%eax
+  804603:	31 d2                	xor    %edx,%edx
+  804605:	83 e0 01             	and    $0x1,%eax
+  804608:	89 04 24             	mov    %eax,(%esp)
+  80460b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804612:	00 
+  804613:	8b 04 24             	mov    (%esp),%eax
+  804616:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80461a:	09 f0                	or     %esi,%eax
+  80461c:	09 fa                	or     %edi,%edx
+  80461e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804622:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804626:	39 f0                	cmp    %esi,%eax
+  804628:	89 d3                	mov    %edx,%ebx
+  80462a:	19 fb                	sbb    %edi,%ebx
+  80462c:	72 af                	jb     8045dd <__udivdi3+0x47>
+  80462e:	29 f0                	sub    %esi,%eax
+  804630:	19 fa                	sbb    %edi,%edx
+  804632:	89 cf                	mov    %ecx,%edi
+  804634:	c1 ef 05             	shr    $0x5,%edi
+  804637:	83 e7 01             	and    $0x1,%edi
+  80463a:	89 fe                	mov    %edi,%esi
+  80463c:	83 f6 01             	xor    $0x1,%esi
+  80463f:	d3 e6                	shl    %cl,%esi
+  804641:	d3 e7                	shl    %cl,%edi
+  804643:	09 74 24 18          	or     %esi,0x18(%esp)
+  804647:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80464b:	eb 90                	jmp    8045dd <__udivdi3+0x47>
+  80464d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804651:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804655:	83 c4 20             	add    $0x20,%esp
+  804658:	5b                   	pop    %ebx
+  804659:	5e                   	pop    %esi
+  80465a:	5f                   	pop    %edi
+  80465b:	c3                   	ret
+
+0080465c <__umoddi3>:
+  80465c:	57                   	push   %edi
+  80465d:	56                   	push   %esi
+  80465e:	53                   	push   %ebx
+  80465f:	83 ec 08             	sub    $0x8,%esp
+  804662:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804666:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80466a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80466e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804672:	57                   	push   %edi
+  804673:	56                   	push   %esi
+  804674:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804678:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80467c:	52                   	push   %edx
+  80467d:	50                   	push   %eax
+  80467e:	e8 13 ff ff ff       	call   804596 <__udivdi3>
+  804683:	89 c3                	mov    %eax,%ebx
+  804685:	0f af d6             	imul   %esi,%edx
+  804688:	89 f9                	mov    %edi,%ecx
+  80468a:	0f af cb             	imul   %ebx,%ecx
+  80468d:	01 d1                	add    %edx,%ecx
+  80468f:	89 d8                	mov    %ebx,%eax
+  804691:	f7 e6                	mul    %esi
+  804693:	89 c6                	mov    %eax,%esi
+  804695:	89 d7                	mov    %edx,%edi
+  804697:	01 cf                	add    %ecx,%edi
+  804699:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80469d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8046a1:	29 f0                	sub    %esi,%eax
+  8046a3:	19 fa                	sbb    %edi,%edx
+  8046a5:	83 c4 18             	add    $0x18,%esp
+  8046a8:	5b                   	pop    %ebx
+  8046a9:	5e                   	pop    %esi
+  8046aa:	5f                   	pop    %edi
+  8046ab:	c3                   	ret
+
+008046ac <__divdi3>:
+  8046ac:	53                   	push   %ebx
+  8046ad:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8046b1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8046b5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8046b9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8046bd:	85 d2                	test   %edx,%edx
+  8046bf:	78 12                	js     8046d3 <__divdi3+0x27>
+  8046c1:	85 db                	test   %ebx,%ebx
+  8046c3:	78 2e                	js     8046f3 <__divdi3+0x47>
+  8046c5:	53                   	push   %ebx
+  8046c6:	51                   	push   %ecx
+  8046c7:	52                   	push   %edx
+  8046c8:	50                   	push   %eax
+  8046c9:	e8 c8 fe ff ff       	call   804596 <__udivdi3>
+  8046ce:	83 c4 10             	add    $0x10,%esp
+  8046d1:	eb 1e                	jmp    8046f1 <__divdi3+0x45>
+  8046d3:	f7 d8                	neg    %eax
+  8046d5:	83 d2 00             	adc    $0x0,%edx
+  8046d8:	f7 da                	neg    %edx
+  8046da:	85 db                	test   %ebx,%ebx
+  8046dc:	78 2a                	js     804708 <__divdi3+0x5c>
+  8046de:	53                   	push   %ebx
+  8046df:	51                   	push   %ecx
+  8046e0:	52                   	push   %edx
+  8046e1:	50                   	push   %eax
+  8046e2:	e8 af fe ff ff       	call   804596 <__udivdi3>
+  8046e7:	83 c4 10             	add    $0x10,%esp
+  8046ea:	f7 d8                	neg    %eax
+  8046ec:	83 d2 00             	adc    $0x0,%edx
+  8046ef:	f7 da                	neg    %edx
+  8046f1:	5b                   	pop    %ebx
+  8046f2:	c3                   	ret
+  8046f3:	f7 d9                	neg    %ecx
+  8046f5:	83 d3 00             	adc    $0x0,%ebx
+  8046f8:	f7 db                	neg    %ebx
+  8046fa:	53                   	push   %ebx
+  8046fb:	51                   	push   %ecx
+  8046fc:	52                   	push   %edx
+  8046fd:	50                   	push   %eax
+  8046fe:	e8 93 fe ff ff       	call   804596 <__udivdi3>
+  804703:	83 c4 10             	add    $0x10,%esp
+  804706:	eb e2                	jmp    8046ea <__divdi3+0x3e>
+  804708:	f7 d9                	neg    %ecx
+  80470a:	83 d3 00             	adc    $0x0,%ebx
+  80470d:	f7 db                	neg    %ebx
+  80470f:	53                   	push   %ebx
+  804710:	51                   	push   %ecx
+  804711:	52                   	push   %edx
+  804712:	50                   	push   %eax
+  804713:	e8 7e fe ff ff       	call   804596 <__udivdi3>
+  804718:	83 c4 10             	add    $0x10,%esp
+  80471b:	eb d4                	jmp    8046f1 <__divdi3+0x45>
+
+0080471d <__moddi3>:
+  80471d:	57                   	push   %edi
+  80471e:	56                   	push   %esi
+  80471f:	53                   	push   %ebx
+  804720:	83 ec 08             	sub    $0x8,%esp
+  804723:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804727:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80472b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80472f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804733:	57                   	push   %edi
+  804734:	56                   	push   %esi
+  804735:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804739:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80473d:	52                   	push   %edx
+  80473e:	50                   	push   %eax
+  80473f:	e8 68 ff ff ff       	call   8046ac <__divdi3>
+  804744:	89 c3                	mov    %eax,%ebx
+  804746:	0f af d6             	imul   %esi,%edx
+  804749:	89 f9                	mov    %edi,%ecx
+  80474b:	0f af cb             	imul   %ebx,%ecx
+  80474e:	01 d1                	add    %edx,%ecx
+  804750:	89 d8                	mov    %ebx,%eax
+  804752:	f7 e6                	mul    %esi
+  804754:	89 c6                	mov    %eax,%esi
+  804756:	89 d7                	mov    %edx,%edi
+  804758:	01 cf                	add    %ecx,%edi
+  80475a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80475e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804762:	29 f0                	sub    %esi,%eax
+  804764:	19 fa                	sbb    %edi,%edx
+  804766:	83 c4 18             	add    $0x18,%esp
+  804769:	5b                   	pop    %ebx
+  80476a:	5e                   	pop    %esi
+  80476b:	5f                   	pop    %edi
+  80476c:	c3                   	ret
@@ -0,0 +1,8418 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 50 06 00 00       	call   800681 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003e:	50                   	push   %eax
+  80003f:	68 00 70 80 00       	push   $0x807000
+  800044:	e8 b1 0e 00 00       	call   800efa <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800049:	89 1d 00 74 80 00    	mov    %ebx,0x807400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004f:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  800056:	e8 2f 1a 00 00       	call   801a8a <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80005b:	6a 07                	push   $0x7
+  80005d:	68 00 70 80 00       	push   $0x807000
+  800062:	6a 01                	push   $0x1
+  800064:	50                   	push   %eax
+  800065:	e8 b7 19 00 00       	call   801a21 <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  80006a:	83 c4 1c             	add    $0x1c,%esp
+  80006d:	6a 00                	push   $0x0
+  80006f:	68 00 c0 cc cc       	push   $0xccccc000
+  800074:	6a 00                	push   $0x0
+  800076:	e8 16 17 00 00       	call   801791 <ipc_recv>
+}
+  80007b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	57                   	push   %edi
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800091:	b8 c0 40 80 00       	mov    $0x8040c0,%eax
+  800096:	e8 9a ff ff ff       	call   800035 <xopen>
+  80009b:	85 c0                	test   %eax,%eax
+  80009d:	0f 89 fa 03 00 00    	jns    80049d <umain+0x41d>
+  8000a3:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a6:	0f 85 df 03 00 00    	jne    80048b <umain+0x40b>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b1:	b8 f5 40 80 00       	mov    $0x8040f5,%eax
+  8000b6:	e8 7a ff ff ff       	call   800035 <xopen>
+  8000bb:	85 c0                	test   %eax,%eax
+  8000bd:	0f 88 ee 03 00 00    	js     8004b1 <umain+0x431>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c3:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000ca:	0f 85 f3 03 00 00    	jne    8004c3 <umain+0x443>
+  8000d0:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d7:	0f 85 e6 03 00 00    	jne    8004c3 <umain+0x443>
+  8000dd:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e4:	0f 85 d9 03 00 00    	jne    8004c3 <umain+0x443>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000ea:	83 ec 0c             	sub    $0xc,%esp
+  8000ed:	68 16 41 80 00       	push   $0x804116
+  8000f2:	e8 0c 07 00 00       	call   800803 <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f7:	83 c4 08             	add    $0x8,%esp
+  8000fa:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+  800100:	50                   	push   %eax
+  800101:	68 00 c0 cc cc       	push   $0xccccc000
+  800106:	ff 15 34 50 80 00    	call   *0x805034
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 c0 03 00 00    	js     8004d7 <umain+0x457>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800117:	83 ec 0c             	sub    $0xc,%esp
+  80011a:	ff 35 00 50 80 00    	push   0x805000
+  800120:	e8 89 0d 00 00       	call   800eae <strlen>
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	3b 45 c8             	cmp    -0x38(%ebp),%eax
+  80012b:	0f 85 b8 03 00 00    	jne    8004e9 <umain+0x469>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  800131:	83 ec 0c             	sub    $0xc,%esp
+  800134:	68 38 41 80 00       	push   $0x804138
+  800139:	e8 c5 06 00 00       	call   800803 <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013e:	83 c4 0c             	add    $0xc,%esp
+  800141:	68 00 02 00 00       	push   $0x200
+  800146:	6a 00                	push   $0x0
+  800148:	8d 9d 48 fd ff ff    	lea    -0x2b8(%ebp),%ebx
+  80014e:	53                   	push   %ebx
+  80014f:	e8 21 0f 00 00       	call   801075 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800154:	83 c4 0c             	add    $0xc,%esp
+  800157:	68 00 02 00 00       	push   $0x200
+  80015c:	53                   	push   %ebx
+  80015d:	68 00 c0 cc cc       	push   $0xccccc000
+  800162:	ff 15 28 50 80 00    	call   *0x805028
+  800168:	83 c4 10             	add    $0x10,%esp
+  80016b:	85 c0                	test   %eax,%eax
+  80016d:	0f 88 9b 03 00 00    	js     80050e <umain+0x48e>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800173:	83 ec 08             	sub    $0x8,%esp
+  800176:	ff 35 00 50 80 00    	push   0x805000
+  80017c:	8d 85 48 fd ff ff    	lea    -0x2b8(%ebp),%eax
+  800182:	50                   	push   %eax
+  800183:	e8 22 0e 00 00       	call   800faa <strcmp>
+  800188:	83 c4 10             	add    $0x10,%esp
+  80018b:	85 c0                	test   %eax,%eax
+  80018d:	0f 85 8d 03 00 00    	jne    800520 <umain+0x4a0>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800193:	83 ec 0c             	sub    $0xc,%esp
+  800196:	68 77 41 80 00       	push   $0x804177
+  80019b:	e8 63 06 00 00       	call   800803 <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  8001a0:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a7:	ff 15 30 50 80 00    	call   *0x805030
+  8001ad:	83 c4 10             	add    $0x10,%esp
+  8001b0:	85 c0                	test   %eax,%eax
+  8001b2:	0f 88 7c 03 00 00    	js     800534 <umain+0x4b4>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b8:	83 ec 0c             	sub    $0xc,%esp
+  8001bb:	68 99 41 80 00       	push   $0x804199
+  8001c0:	e8 3e 06 00 00       	call   800803 <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c5:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cd:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d5:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001dd:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e5:	83 c4 08             	add    $0x8,%esp
+  8001e8:	68 00 c0 cc cc       	push   $0xccccc000
+  8001ed:	6a 00                	push   $0x0
+  8001ef:	e8 bf 11 00 00       	call   8013b3 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f4:	83 c4 0c             	add    $0xc,%esp
+  8001f7:	68 00 02 00 00       	push   $0x200
+  8001fc:	8d 85 48 fd ff ff    	lea    -0x2b8(%ebp),%eax
+  800202:	50                   	push   %eax
+  800203:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800206:	50                   	push   %eax
+  800207:	ff 15 28 50 80 00    	call   *0x805028
+  80020d:	83 c4 10             	add    $0x10,%esp
+  800210:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800213:	0f 85 2d 03 00 00    	jne    800546 <umain+0x4c6>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800219:	83 ec 0c             	sub    $0xc,%esp
+  80021c:	68 ad 41 80 00       	push   $0x8041ad
+  800221:	e8 dd 05 00 00       	call   800803 <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800226:	ba 02 01 00 00       	mov    $0x102,%edx
+  80022b:	b8 c3 41 80 00       	mov    $0x8041c3,%eax
+  800230:	e8 00 fe ff ff       	call   800035 <xopen>
+  800235:	83 c4 10             	add    $0x10,%esp
+  800238:	85 c0                	test   %eax,%eax
+  80023a:	0f 88 18 03 00 00    	js     800558 <umain+0x4d8>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  800240:	8b 1d 2c 50 80 00    	mov    0x80502c,%ebx
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	ff 35 00 50 80 00    	push   0x805000
+  80024f:	e8 5a 0c 00 00       	call   800eae <strlen>
+  800254:	83 c4 0c             	add    $0xc,%esp
+  800257:	50                   	push   %eax
+  800258:	ff 35 00 50 80 00    	push   0x805000
+  80025e:	68 00 c0 cc cc       	push   $0xccccc000
+  800263:	ff d3                	call   *%ebx
+  800265:	89 c3                	mov    %eax,%ebx
+  800267:	83 c4 04             	add    $0x4,%esp
+  80026a:	ff 35 00 50 80 00    	push   0x805000
+  800270:	e8 39 0c 00 00       	call   800eae <strlen>
+  800275:	83 c4 10             	add    $0x10,%esp
+  800278:	39 d8                	cmp    %ebx,%eax
+  80027a:	0f 85 ea 02 00 00    	jne    80056a <umain+0x4ea>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  800280:	83 ec 0c             	sub    $0xc,%esp
+  800283:	68 f5 41 80 00       	push   $0x8041f5
+  800288:	e8 76 05 00 00       	call   800803 <cprintf>
+
+	FVA->fd_offset = 0;
+  80028d:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800294:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800297:	83 c4 0c             	add    $0xc,%esp
+  80029a:	68 00 02 00 00       	push   $0x200
+  80029f:	6a 00                	push   $0x0
+  8002a1:	8d 9d 48 fd ff ff    	lea    -0x2b8(%ebp),%ebx
+  8002a7:	53                   	push   %ebx
+  8002a8:	e8 c8 0d 00 00       	call   801075 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ad:	83 c4 0c             	add    $0xc,%esp
+  8002b0:	68 00 02 00 00       	push   $0x200
+  8002b5:	53                   	push   %ebx
+  8002b6:	68 00 c0 cc cc       	push   $0xccccc000
+  8002bb:	ff 15 28 50 80 00    	call   *0x805028
+  8002c1:	89 c3                	mov    %eax,%ebx
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	85 c0                	test   %eax,%eax
+  8002c8:	0f 88 ae 02 00 00    	js     80057c <umain+0x4fc>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002ce:	83 ec 0c             	sub    $0xc,%esp
+  8002d1:	ff 35 00 50 80 00    	push   0x805000
+  8002d7:	e8 d2 0b 00 00       	call   800eae <strlen>
+  8002dc:	83 c4 10             	add    $0x10,%esp
+  8002df:	39 d8                	cmp    %ebx,%eax
+  8002e1:	0f 85 a7 02 00 00    	jne    80058e <umain+0x50e>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e7:	83 ec 08             	sub    $0x8,%esp
+  8002ea:	ff 35 00 50 80 00    	push   0x805000
+  8002f0:	8d 85 48 fd ff ff    	lea    -0x2b8(%ebp),%eax
+  8002f6:	50                   	push   %eax
+  8002f7:	e8 ae 0c 00 00       	call   800faa <strcmp>
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	0f 85 99 02 00 00    	jne    8005a0 <umain+0x520>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800307:	83 ec 0c             	sub    $0xc,%esp
+  80030a:	68 bc 43 80 00       	push   $0x8043bc
+  80030f:	e8 ef 04 00 00       	call   800803 <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800314:	83 c4 08             	add    $0x8,%esp
+  800317:	6a 00                	push   $0x0
+  800319:	68 c0 40 80 00       	push   $0x8040c0
+  80031e:	e8 9a 1f 00 00       	call   8022bd <open>
+  800323:	83 c4 10             	add    $0x10,%esp
+  800326:	85 c0                	test   %eax,%eax
+  800328:	0f 89 98 02 00 00    	jns    8005c6 <umain+0x546>
+  80032e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  800331:	0f 85 7d 02 00 00    	jne    8005b4 <umain+0x534>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800337:	83 ec 08             	sub    $0x8,%esp
+  80033a:	6a 00                	push   $0x0
+  80033c:	68 f5 40 80 00       	push   $0x8040f5
+  800341:	e8 77 1f 00 00       	call   8022bd <open>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	0f 88 89 02 00 00    	js     8005da <umain+0x55a>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  800351:	c1 e0 0c             	shl    $0xc,%eax
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800354:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  80035b:	0f 85 8b 02 00 00    	jne    8005ec <umain+0x56c>
+  800361:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800368:	0f 85 7e 02 00 00    	jne    8005ec <umain+0x56c>
+  80036e:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800374:	85 db                	test   %ebx,%ebx
+  800376:	0f 85 70 02 00 00    	jne    8005ec <umain+0x56c>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  80037c:	83 ec 0c             	sub    $0xc,%esp
+  80037f:	68 1c 41 80 00       	push   $0x80411c
+  800384:	e8 7a 04 00 00       	call   800803 <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800389:	83 c4 08             	add    $0x8,%esp
+  80038c:	68 01 01 00 00       	push   $0x101
+  800391:	68 24 42 80 00       	push   $0x804224
+  800396:	e8 22 1f 00 00       	call   8022bd <open>
+  80039b:	89 c7                	mov    %eax,%edi
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	85 c0                	test   %eax,%eax
+  8003a2:	0f 88 58 02 00 00    	js     800600 <umain+0x580>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003a8:	83 ec 04             	sub    $0x4,%esp
+  8003ab:	68 00 02 00 00       	push   $0x200
+  8003b0:	6a 00                	push   $0x0
+  8003b2:	8d 85 48 fd ff ff    	lea    -0x2b8(%ebp),%eax
+  8003b8:	50                   	push   %eax
+  8003b9:	e8 b7 0c 00 00       	call   801075 <memset>
+  8003be:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003c1:	89 de                	mov    %ebx,%esi
+		*(int*)buf = i;
+  8003c3:	89 b5 48 fd ff ff    	mov    %esi,-0x2b8(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c9:	83 ec 04             	sub    $0x4,%esp
+  8003cc:	68 00 02 00 00       	push   $0x200
+  8003d1:	8d 85 48 fd ff ff    	lea    -0x2b8(%ebp),%eax
+  8003d7:	50                   	push   %eax
+  8003d8:	57                   	push   %edi
+  8003d9:	e8 de 1a 00 00       	call   801ebc <write>
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	85 c0                	test   %eax,%eax
+  8003e3:	0f 88 29 02 00 00    	js     800612 <umain+0x592>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e9:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ef:	89 c6                	mov    %eax,%esi
+  8003f1:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f6:	75 cb                	jne    8003c3 <umain+0x343>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  8003f8:	83 ec 0c             	sub    $0xc,%esp
+  8003fb:	57                   	push   %edi
+  8003fc:	e8 84 18 00 00       	call   801c85 <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  800401:	83 c4 08             	add    $0x8,%esp
+  800404:	6a 00                	push   $0x0
+  800406:	68 24 42 80 00       	push   $0x804224
+  80040b:	e8 ad 1e 00 00       	call   8022bd <open>
+  800410:	89 c6                	mov    %eax,%esi
+  800412:	83 c4 10             	add    $0x10,%esp
+  800415:	85 c0                	test   %eax,%eax
+  800417:	0f 88 0b 02 00 00    	js     800628 <umain+0x5a8>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041d:	8d bd 48 fd ff ff    	lea    -0x2b8(%ebp),%edi
+		*(int*)buf = i;
+  800423:	89 9d 48 fd ff ff    	mov    %ebx,-0x2b8(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800429:	83 ec 04             	sub    $0x4,%esp
+  80042c:	68 00 02 00 00       	push   $0x200
+  800431:	57                   	push   %edi
+  800432:	56                   	push   %esi
+  800433:	e8 30 1a 00 00       	call   801e68 <readn>
+  800438:	83 c4 10             	add    $0x10,%esp
+  80043b:	85 c0                	test   %eax,%eax
+  80043d:	0f 88 f7 01 00 00    	js     80063a <umain+0x5ba>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800443:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800448:	0f 85 02 02 00 00    	jne    800650 <umain+0x5d0>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80044e:	8b 85 48 fd ff ff    	mov    -0x2b8(%ebp),%eax
+  800454:	39 d8                	cmp    %ebx,%eax
+  800456:	0f 85 0f 02 00 00    	jne    80066b <umain+0x5eb>
+	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045c:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800462:	89 c3                	mov    %eax,%ebx
+  800464:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800469:	75 b8                	jne    800423 <umain+0x3a3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  80046b:	83 ec 0c             	sub    $0xc,%esp
+  80046e:	56                   	push   %esi
+  80046f:	e8 11 18 00 00       	call   801c85 <close>
+	cprintf("large file is good\n");
+  800474:	c7 04 24 69 42 80 00 	movl   $0x804269,(%esp)
+  80047b:	e8 83 03 00 00       	call   800803 <cprintf>
+}
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800486:	5b                   	pop    %ebx
+  800487:	5e                   	pop    %esi
+  800488:	5f                   	pop    %edi
+  800489:	5d                   	pop    %ebp
+  80048a:	c3                   	ret
+		panic("serve_open /not-found: %e", r);
+  80048b:	50                   	push   %eax
+  80048c:	68 cb 40 80 00       	push   $0x8040cb
+  800491:	6a 20                	push   $0x20
+  800493:	68 e5 40 80 00       	push   $0x8040e5
+  800498:	e8 8b 02 00 00       	call   800728 <_panic>
+		panic("serve_open /not-found succeeded!");
+  80049d:	83 ec 04             	sub    $0x4,%esp
+  8004a0:	68 80 42 80 00       	push   $0x804280
+  8004a5:	6a 22                	push   $0x22
+  8004a7:	68 e5 40 80 00       	push   $0x8040e5
+  8004ac:	e8 77 02 00 00       	call   800728 <_panic>
+		panic("serve_open /newmotd: %e", r);
+  8004b1:	50                   	push   %eax
+  8004b2:	68 fe 40 80 00       	push   $0x8040fe
+  8004b7:	6a 25                	push   $0x25
+  8004b9:	68 e5 40 80 00       	push   $0x8040e5
+  8004be:	e8 65 02 00 00       	call   800728 <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  8004c3:	83 ec 04             	sub    $0x4,%esp
+  8004c6:	68 a4 42 80 00       	push   $0x8042a4
+  8004cb:	6a 27                	push   $0x27
+  8004cd:	68 e5 40 80 00       	push   $0x8040e5
+  8004d2:	e8 51 02 00 00       	call   800728 <_panic>
+		panic("file_stat: %e", r);
+  8004d7:	50                   	push   %eax
+  8004d8:	68 2a 41 80 00       	push   $0x80412a
+  8004dd:	6a 2b                	push   $0x2b
+  8004df:	68 e5 40 80 00       	push   $0x8040e5
+  8004e4:	e8 3f 02 00 00       	call   800728 <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e9:	83 ec 0c             	sub    $0xc,%esp
+  8004ec:	ff 35 00 50 80 00    	push   0x805000
+  8004f2:	e8 b7 09 00 00       	call   800eae <strlen>
+  8004f7:	89 04 24             	mov    %eax,(%esp)
+  8004fa:	ff 75 c8             	push   -0x38(%ebp)
+  8004fd:	68 d4 42 80 00       	push   $0x8042d4
+  800502:	6a 2d                	push   $0x2d
+  800504:	68 e5 40 80 00       	push   $0x8040e5
+  800509:	e8 1a 02 00 00       	call   800728 <_panic>
+		panic("file_read: %e", r);
+  80050e:	50                   	push   %eax
+  80050f:	68 4b 41 80 00       	push   $0x80414b
+  800514:	6a 32                	push   $0x32
+  800516:	68 e5 40 80 00       	push   $0x8040e5
+  80051b:	e8 08 02 00 00       	call   800728 <_panic>
+		panic("file_read returned wrong data");
+  800520:	83 ec 04             	sub    $0x4,%esp
+  800523:	68 59 41 80 00       	push   $0x804159
+  800528:	6a 34                	push   $0x34
+  80052a:	68 e5 40 80 00       	push   $0x8040e5
+  80052f:	e8 f4 01 00 00       	call   800728 <_panic>
+		panic("file_close: %e", r);
+  800534:	50                   	push   %eax
+  800535:	68 8a 41 80 00       	push   $0x80418a
+  80053a:	6a 38                	push   $0x38
+  80053c:	68 e5 40 80 00       	push   $0x8040e5
+  800541:	e8 e2 01 00 00       	call   800728 <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  800546:	50                   	push   %eax
+  800547:	68 fc 42 80 00       	push   $0x8042fc
+  80054c:	6a 43                	push   $0x43
+  80054e:	68 e5 40 80 00       	push   $0x8040e5
+  800553:	e8 d0 01 00 00       	call   800728 <_panic>
+		panic("serve_open /new-file: %e", r);
+  800558:	50                   	push   %eax
+  800559:	68 cd 41 80 00       	push   $0x8041cd
+  80055e:	6a 48                	push   $0x48
+  800560:	68 e5 40 80 00       	push   $0x8040e5
+  800565:	e8 be 01 00 00       	call   800728 <_panic>
+		panic("file_write: %e", r);
+  80056a:	53                   	push   %ebx
+  80056b:	68 e6 41 80 00       	push   $0x8041e6
+  800570:	6a 4b                	push   $0x4b
+  800572:	68 e5 40 80 00       	push   $0x8040e5
+  800577:	e8 ac 01 00 00       	call   800728 <_panic>
+		panic("file_read after file_write: %e", r);
+  80057c:	50                   	push   %eax
+  80057d:	68 34 43 80 00       	push   $0x804334
+  800582:	6a 51                	push   $0x51
+  800584:	68 e5 40 80 00       	push   $0x8040e5
+  800589:	e8 9a 01 00 00       	call   800728 <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  80058e:	53                   	push   %ebx
+  80058f:	68 54 43 80 00       	push   $0x804354
+  800594:	6a 53                	push   $0x53
+  800596:	68 e5 40 80 00       	push   $0x8040e5
+  80059b:	e8 88 01 00 00       	call   800728 <_panic>
+		panic("file_read after file_write returned wrong data");
+  8005a0:	83 ec 04             	sub    $0x4,%esp
+  8005a3:	68 8c 43 80 00       	push   $0x80438c
+  8005a8:	6a 55                	push   $0x55
+  8005aa:	68 e5 40 80 00       	push   $0x8040e5
+  8005af:	e8 74 01 00 00       	call   800728 <_panic>
+		panic("open /not-found: %e", r);
+  8005b4:	50                   	push   %eax
+  8005b5:	68 d1 40 80 00       	push   $0x8040d1
+  8005ba:	6a 5a                	push   $0x5a
+  8005bc:	68 e5 40 80 00       	push   $0x8040e5
+  8005c1:	e8 62 01 00 00       	call   800728 <_panic>
+		panic("open /not-found succeeded!");
+  8005c6:	83 ec 04             	sub    $0x4,%esp
+  8005c9:	68 09 42 80 00       	push   $0x804209
+  8005ce:	6a 5c                	push   $0x5c
+  8005d0:	68 e5 40 80 00       	push   $0x8040e5
+  8005d5:	e8 4e 01 00 00       	call   800728 <_panic>
+		panic("open /newmotd: %e", r);
+  8005da:	50                   	push   %eax
+  8005db:	68 04 41 80 00       	push   $0x804104
+  8005e0:	6a 5f                	push   $0x5f
+  8005e2:	68 e5 40 80 00       	push   $0x8040e5
+  8005e7:	e8 3c 01 00 00       	call   800728 <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  8005ec:	83 ec 04             	sub    $0x4,%esp
+  8005ef:	68 e0 43 80 00       	push   $0x8043e0
+  8005f4:	6a 62                	push   $0x62
+  8005f6:	68 e5 40 80 00       	push   $0x8040e5
+  8005fb:	e8 28 01 00 00       	call   800728 <_panic>
+		panic("creat /big: %e", f);
+  800600:	50                   	push   %eax
+  800601:	68 29 42 80 00       	push   $0x804229
+  800606:	6a 67                	push   $0x67
+  800608:	68 e5 40 80 00       	push   $0x8040e5
+  80060d:	e8 16 01 00 00       	call   800728 <_panic>
+			panic("write /big@%d: %e", i, r);
+  800612:	83 ec 0c             	sub    $0xc,%esp
+  800615:	50                   	push   %eax
+  800616:	56                   	push   %esi
+  800617:	68 38 42 80 00       	push   $0x804238
+  80061c:	6a 6c                	push   $0x6c
+  80061e:	68 e5 40 80 00       	push   $0x8040e5
+  800623:	e8 00 01 00 00       	call   800728 <_panic>
+		panic("open /big: %e", f);
+  800628:	50                   	push   %eax
+  800629:	68 4a 42 80 00       	push   $0x80424a
+  80062e:	6a 71                	push   $0x71
+  800630:	68 e5 40 80 00       	push   $0x8040e5
+  800635:	e8 ee 00 00 00       	call   800728 <_panic>
+			panic("read /big@%d: %e", i, r);
+  80063a:	83 ec 0c             	sub    $0xc,%esp
+  80063d:	50                   	push   %eax
+  80063e:	53                   	push   %ebx
+  80063f:	68 58 42 80 00       	push   $0x804258
+  800644:	6a 75                	push   $0x75
+  800646:	68 e5 40 80 00       	push   $0x8040e5
+  80064b:	e8 d8 00 00 00       	call   800728 <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	68 00 02 00 00       	push   $0x200
+  800658:	50                   	push   %eax
+  800659:	53                   	push   %ebx
+  80065a:	68 08 44 80 00       	push   $0x804408
+  80065f:	6a 77                	push   $0x77
+  800661:	68 e5 40 80 00       	push   $0x8040e5
+  800666:	e8 bd 00 00 00       	call   800728 <_panic>
+			panic("read /big from %d returned bad data %d",
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+  80066e:	50                   	push   %eax
+  80066f:	53                   	push   %ebx
+  800670:	68 34 44 80 00       	push   $0x804434
+  800675:	6a 7a                	push   $0x7a
+  800677:	68 e5 40 80 00       	push   $0x8040e5
+  80067c:	e8 a7 00 00 00       	call   800728 <_panic>
+
+00800681 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800681:	55                   	push   %ebp
+  800682:	89 e5                	mov    %esp,%ebp
+  800684:	56                   	push   %esi
+  800685:	53                   	push   %ebx
+  800686:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800689:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80068c:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80068e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800693:	29 d0                	sub    %edx,%eax
+  800695:	89 c2                	mov    %eax,%edx
+  800697:	c1 ea 0f             	shr    $0xf,%edx
+  80069a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8006a7:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  8006ae:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8006b2:	e8 39 0c 00 00       	call   8012f0 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8006b7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8006bc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8006c2:	89 e1                	mov    %esp,%ecx
+  8006c4:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8006c9:	29 ca                	sub    %ecx,%edx
+  8006cb:	89 d1                	mov    %edx,%ecx
+  8006cd:	c1 e9 0f             	shr    $0xf,%ecx
+  8006d0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8006d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006db:	0f 42 d1             	cmovb  %ecx,%edx
+  8006de:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006e3:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8006ea:	85 db                	test   %ebx,%ebx
+  8006ec:	7e 07                	jle    8006f5 <libmain+0x74>
+		binaryname = argv[0];
+  8006ee:	8b 06                	mov    (%esi),%eax
+  8006f0:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	56                   	push   %esi
+  8006f9:	53                   	push   %ebx
+  8006fa:	e8 81 f9 ff ff       	call   800080 <umain>
+
+	// exit gracefully
+	exit();
+  8006ff:	e8 0a 00 00 00       	call   80070e <exit>
+}
+  800704:	83 c4 10             	add    $0x10,%esp
+  800707:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80070a:	5b                   	pop    %ebx
+  80070b:	5e                   	pop    %esi
+  80070c:	5d                   	pop    %ebp
+  80070d:	c3                   	ret
+
+0080070e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800714:	e8 99 15 00 00       	call   801cb2 <close_all>
+	sys_env_destroy(0);
+  800719:	83 ec 0c             	sub    $0xc,%esp
+  80071c:	6a 00                	push   $0x0
+  80071e:	e8 8c 0b 00 00       	call   8012af <sys_env_destroy>
+}
+  800723:	83 c4 10             	add    $0x10,%esp
+  800726:	c9                   	leave
+  800727:	c3                   	ret
+
+00800728 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	56                   	push   %esi
+  80072c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80072d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800730:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  800736:	e8 b5 0b 00 00       	call   8012f0 <sys_getenvid>
+  80073b:	83 ec 0c             	sub    $0xc,%esp
+  80073e:	ff 75 0c             	push   0xc(%ebp)
+  800741:	ff 75 08             	push   0x8(%ebp)
+  800744:	56                   	push   %esi
+  800745:	50                   	push   %eax
+  800746:	68 8c 44 80 00       	push   $0x80448c
+  80074b:	e8 b3 00 00 00       	call   800803 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800750:	83 c4 18             	add    $0x18,%esp
+  800753:	53                   	push   %ebx
+  800754:	ff 75 10             	push   0x10(%ebp)
+  800757:	e8 56 00 00 00       	call   8007b2 <vcprintf>
+	cprintf("\n");
+  80075c:	c7 04 24 48 49 80 00 	movl   $0x804948,(%esp)
+  800763:	e8 9b 00 00 00       	call   800803 <cprintf>
+  800768:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80076b:	cc                   	int3
+	while (1)
+  80076c:	eb fd                	jmp    80076b <_panic+0x43>
+
+0080076e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80076e:	55                   	push   %ebp
+  80076f:	89 e5                	mov    %esp,%ebp
+  800771:	53                   	push   %ebx
+  800772:	83 ec 04             	sub    $0x4,%esp
+  800775:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800778:	8b 13                	mov    (%ebx),%edx
+  80077a:	8d 42 01             	lea    0x1(%edx),%eax
+  80077d:	89 03                	mov    %eax,(%ebx)
+  80077f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800782:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800786:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80078b:	74 09                	je     800796 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80078d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800794:	c9                   	leave
+  800795:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	68 ff 00 00 00       	push   $0xff
+  80079e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8007a1:	50                   	push   %eax
+  8007a2:	e8 cb 0a 00 00       	call   801272 <sys_cputs>
+		b->idx = 0;
+  8007a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8007ad:	83 c4 10             	add    $0x10,%esp
+  8007b0:	eb db                	jmp    80078d <putch+0x1f>
+
+008007b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8007b2:	55                   	push   %ebp
+  8007b3:	89 e5                	mov    %esp,%ebp
+  8007b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8007bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8007c2:	00 00 00 
+	b.cnt = 0;
+  8007c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8007cc:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8007cf:	ff 75 0c             	push   0xc(%ebp)
+  8007d2:	ff 75 08             	push   0x8(%ebp)
+  8007d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8007db:	50                   	push   %eax
+  8007dc:	68 6e 07 80 00       	push   $0x80076e
+  8007e1:	e8 1c 01 00 00       	call   800902 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8007e6:	83 c4 08             	add    $0x8,%esp
+  8007e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007f5:	50                   	push   %eax
+  8007f6:	e8 77 0a 00 00       	call   801272 <sys_cputs>
+
+	return b.cnt;
+}
+  8007fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800801:	c9                   	leave
+  800802:	c3                   	ret
+
+00800803 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800803:	55                   	push   %ebp
+  800804:	89 e5                	mov    %esp,%ebp
+  800806:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800809:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80080c:	50                   	push   %eax
+  80080d:	ff 75 08             	push   0x8(%ebp)
+  800810:	e8 9d ff ff ff       	call   8007b2 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+00800817 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	57                   	push   %edi
+  80081b:	56                   	push   %esi
+  80081c:	53                   	push   %ebx
+  80081d:	83 ec 1c             	sub    $0x1c,%esp
+  800820:	89 c3                	mov    %eax,%ebx
+  800822:	89 d6                	mov    %edx,%esi
+  800824:	8b 45 08             	mov    0x8(%ebp),%eax
+  800827:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80082a:	89 d1                	mov    %edx,%ecx
+  80082c:	89 c2                	mov    %eax,%edx
+  80082e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800831:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800834:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800837:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80083a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800841:	39 c2                	cmp    %eax,%edx
+  800843:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800846:	73 4b                	jae    800893 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800848:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084b:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80084e:	85 ff                	test   %edi,%edi
+  800850:	7e 11                	jle    800863 <printnum+0x4c>
+			putch(padc, putdat);
+  800852:	83 ec 08             	sub    $0x8,%esp
+  800855:	56                   	push   %esi
+  800856:	ff 75 18             	push   0x18(%ebp)
+  800859:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	83 ef 01             	sub    $0x1,%edi
+  800861:	75 ef                	jne    800852 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800863:	83 ec 08             	sub    $0x8,%esp
+  800866:	56                   	push   %esi
+  800867:	83 ec 04             	sub    $0x4,%esp
+  80086a:	ff 75 e4             	push   -0x1c(%ebp)
+  80086d:	ff 75 e0             	push   -0x20(%ebp)
+  800870:	ff 75 dc             	push   -0x24(%ebp)
+  800873:	ff 75 d8             	push   -0x28(%ebp)
+  800876:	e8 2a 37 00 00       	call   803fa5 <__umoddi3>
+  80087b:	83 c4 14             	add    $0x14,%esp
+  80087e:	0f be 80 af 44 80 00 	movsbl 0x8044af(%eax),%eax
+  800885:	50                   	push   %eax
+  800886:	ff d3                	call   *%ebx
+}
+  800888:	83 c4 10             	add    $0x10,%esp
+  80088b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5f                   	pop    %edi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800893:	83 ec 0c             	sub    $0xc,%esp
+  800896:	ff 75 18             	push   0x18(%ebp)
+  800899:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80089c:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80089f:	52                   	push   %edx
+  8008a0:	50                   	push   %eax
+  8008a1:	83 ec 08             	sub    $0x8,%esp
+  8008a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8008a7:	ff 75 e0             	push   -0x20(%ebp)
+  8008aa:	ff 75 dc             	push   -0x24(%ebp)
+  8008ad:	ff 75 d8             	push   -0x28(%ebp)
+  8008b0:	e8 2a 36 00 00       	call   803edf <__udivdi3>
+  8008b5:	83 c4 18             	add    $0x18,%esp
+  8008b8:	52                   	push   %edx
+  8008b9:	50                   	push   %eax
+  8008ba:	89 f2                	mov    %esi,%edx
+  8008bc:	89 d8                	mov    %ebx,%eax
+  8008be:	e8 54 ff ff ff       	call   800817 <printnum>
+  8008c3:	83 c4 20             	add    $0x20,%esp
+  8008c6:	eb 9b                	jmp    800863 <printnum+0x4c>
+
+008008c8 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8008ce:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8008d2:	8b 10                	mov    (%eax),%edx
+  8008d4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8008d7:	73 0a                	jae    8008e3 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8008d9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8008dc:	89 08                	mov    %ecx,(%eax)
+  8008de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e1:	88 02                	mov    %al,(%edx)
+}
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <printfmt>:
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8008eb:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8008ee:	50                   	push   %eax
+  8008ef:	ff 75 10             	push   0x10(%ebp)
+  8008f2:	ff 75 0c             	push   0xc(%ebp)
+  8008f5:	ff 75 08             	push   0x8(%ebp)
+  8008f8:	e8 05 00 00 00       	call   800902 <vprintfmt>
+}
+  8008fd:	83 c4 10             	add    $0x10,%esp
+  800900:	c9                   	leave
+  800901:	c3                   	ret
+
+00800902 <vprintfmt>:
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	57                   	push   %edi
+  800906:	56                   	push   %esi
+  800907:	53                   	push   %ebx
+  800908:	83 ec 2c             	sub    $0x2c,%esp
+  80090b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80090e:	89 df                	mov    %ebx,%edi
+  800910:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800913:	8b 45 10             	mov    0x10(%ebp),%eax
+  800916:	8d 70 01             	lea    0x1(%eax),%esi
+  800919:	0f b6 00             	movzbl (%eax),%eax
+  80091c:	83 f8 25             	cmp    $0x25,%eax
+  80091f:	74 1e                	je     80093f <vprintfmt+0x3d>
+			if (ch == '\0')
+  800921:	85 c0                	test   %eax,%eax
+  800923:	0f 84 15 05 00 00    	je     800e3e <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	53                   	push   %ebx
+  80092d:	50                   	push   %eax
+  80092e:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800930:	83 c6 01             	add    $0x1,%esi
+  800933:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	83 f8 25             	cmp    $0x25,%eax
+  80093d:	75 e2                	jne    800921 <vprintfmt+0x1f>
+		padc = ' ';
+  80093f:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800943:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80094a:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800951:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800958:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80095d:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800960:	8d 56 01             	lea    0x1(%esi),%edx
+  800963:	0f b6 0e             	movzbl (%esi),%ecx
+  800966:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800969:	3c 55                	cmp    $0x55,%al
+  80096b:	0f 87 3b 04 00 00    	ja     800dac <vprintfmt+0x4aa>
+  800971:	0f b6 c0             	movzbl %al,%eax
+  800974:	ff 24 85 20 46 80 00 	jmp    *0x804620(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80097b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80097e:	eb 93                	jmp    800913 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800980:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800982:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800986:	eb d8                	jmp    800960 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800988:	89 d6                	mov    %edx,%esi
+  80098a:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80098e:	eb d0                	jmp    800960 <vprintfmt+0x5e>
+  800990:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800993:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800996:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800999:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80099d:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8009a0:	83 f9 09             	cmp    $0x9,%ecx
+  8009a3:	77 6f                	ja     800a14 <vprintfmt+0x112>
+  8009a5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8009a8:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8009ab:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8009ae:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8009b2:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8009b5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8009b8:	83 fe 09             	cmp    $0x9,%esi
+  8009bb:	76 eb                	jbe    8009a8 <vprintfmt+0xa6>
+  8009bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8009c0:	89 d6                	mov    %edx,%esi
+  8009c2:	eb 13                	jmp    8009d7 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8009c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c7:	8b 00                	mov    (%eax),%eax
+  8009c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8009cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8009d2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009d5:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8009d7:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009db:	79 83                	jns    800960 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8009dd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8009e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009e3:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8009ea:	e9 71 ff ff ff       	jmp    800960 <vprintfmt+0x5e>
+			if (width < 0)
+  8009ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009f2:	85 c9                	test   %ecx,%ecx
+  8009f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f9:	0f 49 c1             	cmovns %ecx,%eax
+  8009fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8009ff:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800a01:	e9 5a ff ff ff       	jmp    800960 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a06:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800a08:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800a0f:	e9 4c ff ff ff       	jmp    800960 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800a14:	89 d6                	mov    %edx,%esi
+  800a16:	eb bf                	jmp    8009d7 <vprintfmt+0xd5>
+			lflag++;
+  800a18:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800a1c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800a1e:	e9 3d ff ff ff       	jmp    800960 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800a23:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a29:	8d 70 04             	lea    0x4(%eax),%esi
+  800a2c:	83 ec 08             	sub    $0x8,%esp
+  800a2f:	53                   	push   %ebx
+  800a30:	ff 30                	push   (%eax)
+  800a32:	ff d7                	call   *%edi
+			break;
+  800a34:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800a37:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800a3a:	e9 d4 fe ff ff       	jmp    800913 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800a3f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a45:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800a48:	8b 10                	mov    (%eax),%edx
+  800a4a:	89 d0                	mov    %edx,%eax
+  800a4c:	f7 d8                	neg    %eax
+  800a4e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800a51:	83 f8 12             	cmp    $0x12,%eax
+  800a54:	7f 23                	jg     800a79 <vprintfmt+0x177>
+  800a56:	8b 14 85 80 47 80 00 	mov    0x804780(,%eax,4),%edx
+  800a5d:	85 d2                	test   %edx,%edx
+  800a5f:	74 18                	je     800a79 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800a61:	52                   	push   %edx
+  800a62:	68 13 49 80 00       	push   $0x804913
+  800a67:	53                   	push   %ebx
+  800a68:	57                   	push   %edi
+  800a69:	e8 77 fe ff ff       	call   8008e5 <printfmt>
+  800a6e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a71:	89 75 14             	mov    %esi,0x14(%ebp)
+  800a74:	e9 9a fe ff ff       	jmp    800913 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800a79:	50                   	push   %eax
+  800a7a:	68 c7 44 80 00       	push   $0x8044c7
+  800a7f:	53                   	push   %ebx
+  800a80:	57                   	push   %edi
+  800a81:	e8 5f fe ff ff       	call   8008e5 <printfmt>
+  800a86:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800a89:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800a8c:	e9 82 fe ff ff       	jmp    800913 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a91:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a97:	83 c0 04             	add    $0x4,%eax
+  800a9a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800a9d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa0:	8b 00                	mov    (%eax),%eax
+  800aa2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800aa5:	85 c0                	test   %eax,%eax
+  800aa7:	0f 84 61 03 00 00    	je     800e0e <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800aad:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ab1:	7e 06                	jle    800ab9 <vprintfmt+0x1b7>
+  800ab3:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800ab7:	75 29                	jne    800ae2 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ab9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800abc:	8d 70 01             	lea    0x1(%eax),%esi
+  800abf:	0f b6 00             	movzbl (%eax),%eax
+  800ac2:	0f be d0             	movsbl %al,%edx
+  800ac5:	85 d2                	test   %edx,%edx
+  800ac7:	0f 84 bb 00 00 00    	je     800b88 <vprintfmt+0x286>
+  800acd:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ad0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ad3:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ad6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ad9:	eb 7a                	jmp    800b55 <vprintfmt+0x253>
+				p = "(null)";
+  800adb:	c7 45 d0 c0 44 80 00 	movl   $0x8044c0,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800ae2:	83 ec 08             	sub    $0x8,%esp
+  800ae5:	ff 75 d4             	push   -0x2c(%ebp)
+  800ae8:	ff 75 d0             	push   -0x30(%ebp)
+  800aeb:	e8 e0 03 00 00       	call   800ed0 <strnlen>
+  800af0:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800af3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800af6:	83 c4 10             	add    $0x10,%esp
+  800af9:	85 d2                	test   %edx,%edx
+  800afb:	0f 8e d6 02 00 00    	jle    800dd7 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800b01:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800b05:	83 ec 08             	sub    $0x8,%esp
+  800b08:	53                   	push   %ebx
+  800b09:	56                   	push   %esi
+  800b0a:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800b0c:	83 c4 10             	add    $0x10,%esp
+  800b0f:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800b13:	75 f0                	jne    800b05 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b15:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800b18:	8d 70 01             	lea    0x1(%eax),%esi
+  800b1b:	0f b6 00             	movzbl (%eax),%eax
+  800b1e:	0f be d0             	movsbl %al,%edx
+  800b21:	85 d2                	test   %edx,%edx
+  800b23:	0f 84 da 02 00 00    	je     800e03 <vprintfmt+0x501>
+  800b29:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800b2c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800b2f:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800b32:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b35:	eb 1e                	jmp    800b55 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800b37:	83 ec 08             	sub    $0x8,%esp
+  800b3a:	ff 75 0c             	push   0xc(%ebp)
+  800b3d:	52                   	push   %edx
+  800b3e:	ff 55 08             	call   *0x8(%ebp)
+  800b41:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800b44:	83 eb 01             	sub    $0x1,%ebx
+  800b47:	83 c6 01             	add    $0x1,%esi
+  800b4a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800b4e:	0f be d0             	movsbl %al,%edx
+  800b51:	85 d2                	test   %edx,%edx
+  800b53:	74 2a                	je     800b7f <vprintfmt+0x27d>
+  800b55:	85 ff                	test   %edi,%edi
+  800b57:	78 05                	js     800b5e <vprintfmt+0x25c>
+  800b59:	83 ef 01             	sub    $0x1,%edi
+  800b5c:	78 59                	js     800bb7 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800b5e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800b62:	74 d3                	je     800b37 <vprintfmt+0x235>
+  800b64:	0f be c0             	movsbl %al,%eax
+  800b67:	83 e8 20             	sub    $0x20,%eax
+  800b6a:	83 f8 5e             	cmp    $0x5e,%eax
+  800b6d:	76 c8                	jbe    800b37 <vprintfmt+0x235>
+					putch('?', putdat);
+  800b6f:	83 ec 08             	sub    $0x8,%esp
+  800b72:	ff 75 0c             	push   0xc(%ebp)
+  800b75:	6a 3f                	push   $0x3f
+  800b77:	ff 55 08             	call   *0x8(%ebp)
+  800b7a:	83 c4 10             	add    $0x10,%esp
+  800b7d:	eb c5                	jmp    800b44 <vprintfmt+0x242>
+  800b7f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800b82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800b88:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800b8b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800b8f:	7e 1b                	jle    800bac <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800b91:	83 ec 08             	sub    $0x8,%esp
+  800b94:	53                   	push   %ebx
+  800b95:	6a 20                	push   $0x20
+  800b97:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800b99:	83 c4 10             	add    $0x10,%esp
+  800b9c:	83 ee 01             	sub    $0x1,%esi
+  800b9f:	75 f0                	jne    800b91 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ba1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ba4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ba7:	e9 67 fd ff ff       	jmp    800913 <vprintfmt+0x11>
+  800bac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800baf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb2:	e9 5c fd ff ff       	jmp    800913 <vprintfmt+0x11>
+  800bb7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800bba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800bc0:	eb c6                	jmp    800b88 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800bc2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800bc5:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bc8:	83 f9 01             	cmp    $0x1,%ecx
+  800bcb:	7f 1f                	jg     800bec <vprintfmt+0x2ea>
+	else if (lflag)
+  800bcd:	85 c9                	test   %ecx,%ecx
+  800bcf:	74 67                	je     800c38 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800bd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bd4:	8b 30                	mov    (%eax),%esi
+  800bd6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800bd9:	89 f0                	mov    %esi,%eax
+  800bdb:	c1 f8 1f             	sar    $0x1f,%eax
+  800bde:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800be1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be4:	8d 40 04             	lea    0x4(%eax),%eax
+  800be7:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bea:	eb 17                	jmp    800c03 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800bec:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bef:	8b 50 04             	mov    0x4(%eax),%edx
+  800bf2:	8b 00                	mov    (%eax),%eax
+  800bf4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800bf7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800bfa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bfd:	8d 40 08             	lea    0x8(%eax),%eax
+  800c00:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800c03:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800c06:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800c09:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800c0e:	85 c9                	test   %ecx,%ecx
+  800c10:	0f 89 12 01 00 00    	jns    800d28 <vprintfmt+0x426>
+				putch('-', putdat);
+  800c16:	83 ec 08             	sub    $0x8,%esp
+  800c19:	53                   	push   %ebx
+  800c1a:	6a 2d                	push   $0x2d
+  800c1c:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800c1e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800c21:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800c24:	f7 da                	neg    %edx
+  800c26:	83 d1 00             	adc    $0x0,%ecx
+  800c29:	f7 d9                	neg    %ecx
+  800c2b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800c2e:	be 0a 00 00 00       	mov    $0xa,%esi
+  800c33:	e9 f0 00 00 00       	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800c38:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3b:	8b 30                	mov    (%eax),%esi
+  800c3d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800c40:	89 f0                	mov    %esi,%eax
+  800c42:	c1 f8 1f             	sar    $0x1f,%eax
+  800c45:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800c48:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c4b:	8d 40 04             	lea    0x4(%eax),%eax
+  800c4e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c51:	eb b0                	jmp    800c03 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800c53:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800c56:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c59:	83 f9 01             	cmp    $0x1,%ecx
+  800c5c:	7f 1e                	jg     800c7c <vprintfmt+0x37a>
+	else if (lflag)
+  800c5e:	85 c9                	test   %ecx,%ecx
+  800c60:	74 32                	je     800c94 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800c62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c65:	8b 10                	mov    (%eax),%edx
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c6c:	8d 40 04             	lea    0x4(%eax),%eax
+  800c6f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c72:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800c77:	e9 ac 00 00 00       	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c7c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c7f:	8b 10                	mov    (%eax),%edx
+  800c81:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c84:	8d 40 08             	lea    0x8(%eax),%eax
+  800c87:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800c8a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800c8f:	e9 94 00 00 00       	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c94:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c97:	8b 10                	mov    (%eax),%edx
+  800c99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9e:	8d 40 04             	lea    0x4(%eax),%eax
+  800ca1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ca4:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800ca9:	eb 7d                	jmp    800d28 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800cab:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800cae:	89 55 10             	mov    %edx,0x10(%ebp)
+  800cb1:	83 f9 01             	cmp    $0x1,%ecx
+  800cb4:	7f 1b                	jg     800cd1 <vprintfmt+0x3cf>
+	else if (lflag)
+  800cb6:	85 c9                	test   %ecx,%ecx
+  800cb8:	74 2c                	je     800ce6 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800cba:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbd:	8b 10                	mov    (%eax),%edx
+  800cbf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc4:	8d 40 04             	lea    0x4(%eax),%eax
+  800cc7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cca:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800ccf:	eb 57                	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800cd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd4:	8b 10                	mov    (%eax),%edx
+  800cd6:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cd9:	8d 40 08             	lea    0x8(%eax),%eax
+  800cdc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cdf:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800ce4:	eb 42                	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800ce6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ce9:	8b 10                	mov    (%eax),%edx
+  800ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf0:	8d 40 04             	lea    0x4(%eax),%eax
+  800cf3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800cf6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800cfb:	eb 2b                	jmp    800d28 <vprintfmt+0x426>
+			putch('0', putdat);
+  800cfd:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d00:	83 ec 08             	sub    $0x8,%esp
+  800d03:	53                   	push   %ebx
+  800d04:	6a 30                	push   $0x30
+  800d06:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800d08:	83 c4 08             	add    $0x8,%esp
+  800d0b:	53                   	push   %ebx
+  800d0c:	6a 78                	push   $0x78
+  800d0e:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800d10:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d13:	8b 10                	mov    (%eax),%edx
+  800d15:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800d1a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800d1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800d20:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d23:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800d28:	83 ec 0c             	sub    $0xc,%esp
+  800d2b:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800d2f:	50                   	push   %eax
+  800d30:	ff 75 e4             	push   -0x1c(%ebp)
+  800d33:	56                   	push   %esi
+  800d34:	51                   	push   %ecx
+  800d35:	52                   	push   %edx
+  800d36:	89 da                	mov    %ebx,%edx
+  800d38:	89 f8                	mov    %edi,%eax
+  800d3a:	e8 d8 fa ff ff       	call   800817 <printnum>
+			break;
+  800d3f:	83 c4 20             	add    $0x20,%esp
+  800d42:	e9 cc fb ff ff       	jmp    800913 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800d47:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800d4a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d4d:	83 f9 01             	cmp    $0x1,%ecx
+  800d50:	7f 1b                	jg     800d6d <vprintfmt+0x46b>
+	else if (lflag)
+  800d52:	85 c9                	test   %ecx,%ecx
+  800d54:	74 2c                	je     800d82 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800d56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d59:	8b 10                	mov    (%eax),%edx
+  800d5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d60:	8d 40 04             	lea    0x4(%eax),%eax
+  800d63:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d66:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800d6b:	eb bb                	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800d6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d70:	8b 10                	mov    (%eax),%edx
+  800d72:	8b 48 04             	mov    0x4(%eax),%ecx
+  800d75:	8d 40 08             	lea    0x8(%eax),%eax
+  800d78:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d7b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800d80:	eb a6                	jmp    800d28 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800d82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d85:	8b 10                	mov    (%eax),%edx
+  800d87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800d8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800d92:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800d97:	eb 8f                	jmp    800d28 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800d99:	89 55 10             	mov    %edx,0x10(%ebp)
+  800d9c:	83 ec 08             	sub    $0x8,%esp
+  800d9f:	53                   	push   %ebx
+  800da0:	6a 25                	push   $0x25
+  800da2:	ff d7                	call   *%edi
+			break;
+  800da4:	83 c4 10             	add    $0x10,%esp
+  800da7:	e9 67 fb ff ff       	jmp    800913 <vprintfmt+0x11>
+			putch('%', putdat);
+  800dac:	83 ec 08             	sub    $0x8,%esp
+  800daf:	53                   	push   %ebx
+  800db0:	6a 25                	push   $0x25
+  800db2:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800db4:	83 c4 10             	add    $0x10,%esp
+  800db7:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800dbb:	0f 84 ba fb ff ff    	je     80097b <vprintfmt+0x79>
+  800dc1:	89 75 10             	mov    %esi,0x10(%ebp)
+  800dc4:	89 f0                	mov    %esi,%eax
+  800dc6:	83 e8 01             	sub    $0x1,%eax
+  800dc9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800dcd:	75 f7                	jne    800dc6 <vprintfmt+0x4c4>
+  800dcf:	89 45 10             	mov    %eax,0x10(%ebp)
+  800dd2:	e9 3c fb ff ff       	jmp    800913 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800dd7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800dda:	8d 70 01             	lea    0x1(%eax),%esi
+  800ddd:	0f b6 00             	movzbl (%eax),%eax
+  800de0:	0f be d0             	movsbl %al,%edx
+  800de3:	85 d2                	test   %edx,%edx
+  800de5:	74 11                	je     800df8 <vprintfmt+0x4f6>
+  800de7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800dea:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ded:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800df0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800df3:	e9 5d fd ff ff       	jmp    800b55 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800df8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800dfb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800dfe:	e9 10 fb ff ff       	jmp    800913 <vprintfmt+0x11>
+  800e03:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e06:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e09:	e9 05 fb ff ff       	jmp    800913 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800e0e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800e12:	7e 0a                	jle    800e1e <vprintfmt+0x51c>
+  800e14:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800e18:	0f 85 bd fc ff ff    	jne    800adb <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e1e:	ba 28 00 00 00       	mov    $0x28,%edx
+  800e23:	b8 28 00 00 00       	mov    $0x28,%eax
+  800e28:	be c1 44 80 00       	mov    $0x8044c1,%esi
+  800e2d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800e30:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800e33:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800e36:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800e39:	e9 17 fd ff ff       	jmp    800b55 <vprintfmt+0x253>
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	83 ec 18             	sub    $0x18,%esp
+  800e4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800e52:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800e55:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800e59:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800e5c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	74 26                	je     800e8d <vsnprintf+0x47>
+  800e67:	85 d2                	test   %edx,%edx
+  800e69:	7e 22                	jle    800e8d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800e6b:	ff 75 14             	push   0x14(%ebp)
+  800e6e:	ff 75 10             	push   0x10(%ebp)
+  800e71:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800e74:	50                   	push   %eax
+  800e75:	68 c8 08 80 00       	push   $0x8008c8
+  800e7a:	e8 83 fa ff ff       	call   800902 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800e7f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800e82:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800e85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e88:	83 c4 10             	add    $0x10,%esp
+}
+  800e8b:	c9                   	leave
+  800e8c:	c3                   	ret
+		return -E_INVAL;
+  800e8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e92:	eb f7                	jmp    800e8b <vsnprintf+0x45>
+
+00800e94 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800e9a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800e9d:	50                   	push   %eax
+  800e9e:	ff 75 10             	push   0x10(%ebp)
+  800ea1:	ff 75 0c             	push   0xc(%ebp)
+  800ea4:	ff 75 08             	push   0x8(%ebp)
+  800ea7:	e8 9a ff ff ff       	call   800e46 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800eac:	c9                   	leave
+  800ead:	c3                   	ret
+
+00800eae <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800eae:	55                   	push   %ebp
+  800eaf:	89 e5                	mov    %esp,%ebp
+  800eb1:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800eb4:	80 3a 00             	cmpb   $0x0,(%edx)
+  800eb7:	74 10                	je     800ec9 <strlen+0x1b>
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800ebe:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800ec1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800ec5:	75 f7                	jne    800ebe <strlen+0x10>
+	return n;
+}
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800ece:	eb f7                	jmp    800ec7 <strlen+0x19>
+
+00800ed0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ed0:	55                   	push   %ebp
+  800ed1:	89 e5                	mov    %esp,%ebp
+  800ed3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ed6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ed9:	85 d2                	test   %edx,%edx
+  800edb:	74 16                	je     800ef3 <strnlen+0x23>
+  800edd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ee6:	74 09                	je     800ef1 <strnlen+0x21>
+		n++;
+  800ee8:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800eeb:	39 d0                	cmp    %edx,%eax
+  800eed:	75 f3                	jne    800ee2 <strnlen+0x12>
+		n++;
+  800eef:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ef3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ef8:	eb f7                	jmp    800ef1 <strnlen+0x21>
+
+00800efa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	53                   	push   %ebx
+  800efe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800f01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f09:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800f0d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800f10:	83 c0 01             	add    $0x1,%eax
+  800f13:	84 d2                	test   %dl,%dl
+  800f15:	75 f2                	jne    800f09 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800f17:	89 c8                	mov    %ecx,%eax
+  800f19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f1c:	c9                   	leave
+  800f1d:	c3                   	ret
+
+00800f1e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800f1e:	55                   	push   %ebp
+  800f1f:	89 e5                	mov    %esp,%ebp
+  800f21:	53                   	push   %ebx
+  800f22:	83 ec 10             	sub    $0x10,%esp
+  800f25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800f28:	53                   	push   %ebx
+  800f29:	e8 80 ff ff ff       	call   800eae <strlen>
+  800f2e:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800f31:	ff 75 0c             	push   0xc(%ebp)
+  800f34:	01 d8                	add    %ebx,%eax
+  800f36:	50                   	push   %eax
+  800f37:	e8 be ff ff ff       	call   800efa <strcpy>
+	return dst;
+}
+  800f3c:	89 d8                	mov    %ebx,%eax
+  800f3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f41:	c9                   	leave
+  800f42:	c3                   	ret
+
+00800f43 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800f51:	85 db                	test   %ebx,%ebx
+  800f53:	74 17                	je     800f6c <strncpy+0x29>
+  800f55:	01 f3                	add    %esi,%ebx
+  800f57:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800f59:	83 c0 01             	add    $0x1,%eax
+  800f5c:	0f b6 0a             	movzbl (%edx),%ecx
+  800f5f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800f62:	80 f9 01             	cmp    $0x1,%cl
+  800f65:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800f68:	39 c3                	cmp    %eax,%ebx
+  800f6a:	75 ed                	jne    800f59 <strncpy+0x16>
+	}
+	return ret;
+}
+  800f6c:	89 f0                	mov    %esi,%eax
+  800f6e:	5b                   	pop    %ebx
+  800f6f:	5e                   	pop    %esi
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+
+00800f72 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	8b 75 08             	mov    0x8(%ebp),%esi
+  800f7a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800f80:	89 f0                	mov    %esi,%eax
+  800f82:	85 db                	test   %ebx,%ebx
+  800f84:	74 1e                	je     800fa4 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800f86:	83 eb 01             	sub    $0x1,%ebx
+  800f89:	74 16                	je     800fa1 <strlcpy+0x2f>
+  800f8b:	01 f3                	add    %esi,%ebx
+  800f8d:	0f b6 0a             	movzbl (%edx),%ecx
+  800f90:	84 c9                	test   %cl,%cl
+  800f92:	74 0d                	je     800fa1 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800f94:	83 c2 01             	add    $0x1,%edx
+  800f97:	83 c0 01             	add    $0x1,%eax
+  800f9a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800f9d:	39 d8                	cmp    %ebx,%eax
+  800f9f:	75 ec                	jne    800f8d <strlcpy+0x1b>
+		*dst = '\0';
+  800fa1:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800fa4:	29 f0                	sub    %esi,%eax
+}
+  800fa6:	5b                   	pop    %ebx
+  800fa7:	5e                   	pop    %esi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fb0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800fb3:	0f b6 01             	movzbl (%ecx),%eax
+  800fb6:	84 c0                	test   %al,%al
+  800fb8:	74 11                	je     800fcb <strcmp+0x21>
+  800fba:	38 02                	cmp    %al,(%edx)
+  800fbc:	75 0d                	jne    800fcb <strcmp+0x21>
+		p++, q++;
+  800fbe:	83 c1 01             	add    $0x1,%ecx
+  800fc1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800fc4:	0f b6 01             	movzbl (%ecx),%eax
+  800fc7:	84 c0                	test   %al,%al
+  800fc9:	75 ef                	jne    800fba <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800fcb:	0f b6 c0             	movzbl %al,%eax
+  800fce:	0f b6 12             	movzbl (%edx),%edx
+  800fd1:	29 d0                	sub    %edx,%eax
+}
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+
+00800fd5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	53                   	push   %ebx
+  800fd9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800fdc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800fdf:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800fe7:	85 d2                	test   %edx,%edx
+  800fe9:	74 2e                	je     801019 <strncmp+0x44>
+  800feb:	0f b6 01             	movzbl (%ecx),%eax
+  800fee:	84 c0                	test   %al,%al
+  800ff0:	74 16                	je     801008 <strncmp+0x33>
+  800ff2:	3a 03                	cmp    (%ebx),%al
+  800ff4:	75 12                	jne    801008 <strncmp+0x33>
+		n--, p++, q++;
+  800ff6:	83 c1 01             	add    $0x1,%ecx
+  800ff9:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800ffc:	83 ea 01             	sub    $0x1,%edx
+  800fff:	75 ea                	jne    800feb <strncmp+0x16>
+		return 0;
+  801001:	b8 00 00 00 00       	mov    $0x0,%eax
+  801006:	eb 11                	jmp    801019 <strncmp+0x44>
+  801008:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80100d:	85 d2                	test   %edx,%edx
+  80100f:	74 08                	je     801019 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  801011:	0f b6 01             	movzbl (%ecx),%eax
+  801014:	0f b6 13             	movzbl (%ebx),%edx
+  801017:	29 d0                	sub    %edx,%eax
+}
+  801019:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101c:	c9                   	leave
+  80101d:	c3                   	ret
+
+0080101e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	8b 45 08             	mov    0x8(%ebp),%eax
+  801024:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801028:	0f b6 10             	movzbl (%eax),%edx
+  80102b:	84 d2                	test   %dl,%dl
+  80102d:	74 15                	je     801044 <strchr+0x26>
+		if (*s == c)
+  80102f:	38 d1                	cmp    %dl,%cl
+  801031:	74 0f                	je     801042 <strchr+0x24>
+	for (; *s; s++)
+  801033:	83 c0 01             	add    $0x1,%eax
+  801036:	0f b6 10             	movzbl (%eax),%edx
+  801039:	84 d2                	test   %dl,%dl
+  80103b:	75 f2                	jne    80102f <strchr+0x11>
+			return (char *) s;
+	return 0;
+  80103d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+	return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+  801049:	eb f7                	jmp    801042 <strchr+0x24>
+
+0080104b <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80104b:	55                   	push   %ebp
+  80104c:	89 e5                	mov    %esp,%ebp
+  80104e:	53                   	push   %ebx
+  80104f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801052:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  801055:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  801058:	38 d3                	cmp    %dl,%bl
+  80105a:	74 14                	je     801070 <strfind+0x25>
+  80105c:	89 d1                	mov    %edx,%ecx
+  80105e:	84 db                	test   %bl,%bl
+  801060:	74 0e                	je     801070 <strfind+0x25>
+	for (; *s; s++)
+  801062:	83 c0 01             	add    $0x1,%eax
+  801065:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801068:	38 ca                	cmp    %cl,%dl
+  80106a:	74 04                	je     801070 <strfind+0x25>
+  80106c:	84 d2                	test   %dl,%dl
+  80106e:	75 f2                	jne    801062 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  801070:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801073:	c9                   	leave
+  801074:	c3                   	ret
+
+00801075 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	57                   	push   %edi
+  801079:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80107c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80107f:	85 c9                	test   %ecx,%ecx
+  801081:	74 20                	je     8010a3 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801083:	89 f8                	mov    %edi,%eax
+  801085:	09 c8                	or     %ecx,%eax
+  801087:	a8 03                	test   $0x3,%al
+  801089:	75 12                	jne    80109d <memset+0x28>
+		c &= 0xFF;
+  80108b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80108f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801095:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801098:	fc                   	cld
+  801099:	f3 ab                	rep stos %eax,%es:(%edi)
+  80109b:	eb 06                	jmp    8010a3 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80109d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010a0:	fc                   	cld
+  8010a1:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8010a3:	89 f8                	mov    %edi,%eax
+  8010a5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8010a8:	c9                   	leave
+  8010a9:	c3                   	ret
+
+008010aa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8010aa:	55                   	push   %ebp
+  8010ab:	89 e5                	mov    %esp,%ebp
+  8010ad:	57                   	push   %edi
+  8010ae:	56                   	push   %esi
+  8010af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8010b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8010b8:	39 c6                	cmp    %eax,%esi
+  8010ba:	73 32                	jae    8010ee <memmove+0x44>
+  8010bc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8010bf:	39 d0                	cmp    %edx,%eax
+  8010c1:	73 2b                	jae    8010ee <memmove+0x44>
+		s += n;
+		d += n;
+  8010c3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010c6:	89 d6                	mov    %edx,%esi
+  8010c8:	09 fe                	or     %edi,%esi
+  8010ca:	09 ce                	or     %ecx,%esi
+  8010cc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8010d2:	75 0e                	jne    8010e2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8010d4:	83 ef 04             	sub    $0x4,%edi
+  8010d7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8010da:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8010dd:	fd                   	std
+  8010de:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8010e0:	eb 09                	jmp    8010eb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8010e2:	83 ef 01             	sub    $0x1,%edi
+  8010e5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8010e8:	fd                   	std
+  8010e9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8010eb:	fc                   	cld
+  8010ec:	eb 1a                	jmp    801108 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8010ee:	89 f2                	mov    %esi,%edx
+  8010f0:	09 c2                	or     %eax,%edx
+  8010f2:	09 ca                	or     %ecx,%edx
+  8010f4:	f6 c2 03             	test   $0x3,%dl
+  8010f7:	75 0a                	jne    801103 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8010f9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8010fc:	89 c7                	mov    %eax,%edi
+  8010fe:	fc                   	cld
+  8010ff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  801101:	eb 05                	jmp    801108 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  801103:	89 c7                	mov    %eax,%edi
+  801105:	fc                   	cld
+  801106:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801108:	5e                   	pop    %esi
+  801109:	5f                   	pop    %edi
+  80110a:	5d                   	pop    %ebp
+  80110b:	c3                   	ret
+
+0080110c <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  801112:	ff 75 10             	push   0x10(%ebp)
+  801115:	ff 75 0c             	push   0xc(%ebp)
+  801118:	ff 75 08             	push   0x8(%ebp)
+  80111b:	e8 8a ff ff ff       	call   8010aa <memmove>
+}
+  801120:	c9                   	leave
+  801121:	c3                   	ret
+
+00801122 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	56                   	push   %esi
+  801126:	53                   	push   %ebx
+  801127:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80112d:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801130:	85 f6                	test   %esi,%esi
+  801132:	74 29                	je     80115d <memcmp+0x3b>
+  801134:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  801136:	0f b6 08             	movzbl (%eax),%ecx
+  801139:	0f b6 1a             	movzbl (%edx),%ebx
+  80113c:	38 d9                	cmp    %bl,%cl
+  80113e:	75 11                	jne    801151 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801140:	83 c0 01             	add    $0x1,%eax
+  801143:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801146:	39 c6                	cmp    %eax,%esi
+  801148:	75 ec                	jne    801136 <memcmp+0x14>
+	}
+
+	return 0;
+  80114a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114f:	eb 08                	jmp    801159 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  801151:	0f b6 c1             	movzbl %cl,%eax
+  801154:	0f b6 db             	movzbl %bl,%ebx
+  801157:	29 d8                	sub    %ebx,%eax
+}
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+	return 0;
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801162:	eb f5                	jmp    801159 <memcmp+0x37>
+
+00801164 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	8b 45 08             	mov    0x8(%ebp),%eax
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80116d:	89 c2                	mov    %eax,%edx
+  80116f:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801172:	39 d0                	cmp    %edx,%eax
+  801174:	73 0d                	jae    801183 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801176:	38 08                	cmp    %cl,(%eax)
+  801178:	74 0d                	je     801187 <memfind+0x23>
+	for (; s < ends; s++)
+  80117a:	83 c0 01             	add    $0x1,%eax
+  80117d:	39 c2                	cmp    %eax,%edx
+  80117f:	75 f5                	jne    801176 <memfind+0x12>
+  801181:	eb 06                	jmp    801189 <memfind+0x25>
+  801183:	89 c2                	mov    %eax,%edx
+  801185:	eb 02                	jmp    801189 <memfind+0x25>
+  801187:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  801189:	89 d0                	mov    %edx,%eax
+  80118b:	5d                   	pop    %ebp
+  80118c:	c3                   	ret
+
+0080118d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	8b 55 08             	mov    0x8(%ebp),%edx
+  801196:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801199:	0f b6 02             	movzbl (%edx),%eax
+  80119c:	3c 20                	cmp    $0x20,%al
+  80119e:	74 04                	je     8011a4 <strtol+0x17>
+  8011a0:	3c 09                	cmp    $0x9,%al
+  8011a2:	75 0e                	jne    8011b2 <strtol+0x25>
+		s++;
+  8011a4:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8011a7:	0f b6 02             	movzbl (%edx),%eax
+  8011aa:	3c 20                	cmp    $0x20,%al
+  8011ac:	74 f6                	je     8011a4 <strtol+0x17>
+  8011ae:	3c 09                	cmp    $0x9,%al
+  8011b0:	74 f2                	je     8011a4 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  8011b2:	3c 2b                	cmp    $0x2b,%al
+  8011b4:	74 2a                	je     8011e0 <strtol+0x53>
+	int neg = 0;
+  8011b6:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8011bb:	3c 2d                	cmp    $0x2d,%al
+  8011bd:	74 2b                	je     8011ea <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011bf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8011c5:	75 0f                	jne    8011d6 <strtol+0x49>
+  8011c7:	80 3a 30             	cmpb   $0x30,(%edx)
+  8011ca:	74 28                	je     8011f4 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8011cc:	85 db                	test   %ebx,%ebx
+  8011ce:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011d3:	0f 44 d8             	cmove  %eax,%ebx
+  8011d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011db:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8011de:	eb 46                	jmp    801226 <strtol+0x99>
+		s++;
+  8011e0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8011e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011e8:	eb d5                	jmp    8011bf <strtol+0x32>
+		s++, neg = 1;
+  8011ea:	83 c2 01             	add    $0x1,%edx
+  8011ed:	bf 01 00 00 00       	mov    $0x1,%edi
+  8011f2:	eb cb                	jmp    8011bf <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8011f4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8011f8:	74 0e                	je     801208 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8011fa:	85 db                	test   %ebx,%ebx
+  8011fc:	75 d8                	jne    8011d6 <strtol+0x49>
+		s++, base = 8;
+  8011fe:	83 c2 01             	add    $0x1,%edx
+  801201:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801206:	eb ce                	jmp    8011d6 <strtol+0x49>
+		s += 2, base = 16;
+  801208:	83 c2 02             	add    $0x2,%edx
+  80120b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801210:	eb c4                	jmp    8011d6 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801212:	0f be c0             	movsbl %al,%eax
+  801215:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801218:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80121b:	7d 3a                	jge    801257 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  80121d:	83 c2 01             	add    $0x1,%edx
+  801220:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801224:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801226:	0f b6 02             	movzbl (%edx),%eax
+  801229:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80122c:	89 f3                	mov    %esi,%ebx
+  80122e:	80 fb 09             	cmp    $0x9,%bl
+  801231:	76 df                	jbe    801212 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  801233:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801236:	89 f3                	mov    %esi,%ebx
+  801238:	80 fb 19             	cmp    $0x19,%bl
+  80123b:	77 08                	ja     801245 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80123d:	0f be c0             	movsbl %al,%eax
+  801240:	83 e8 57             	sub    $0x57,%eax
+  801243:	eb d3                	jmp    801218 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  801245:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801248:	89 f3                	mov    %esi,%ebx
+  80124a:	80 fb 19             	cmp    $0x19,%bl
+  80124d:	77 08                	ja     801257 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80124f:	0f be c0             	movsbl %al,%eax
+  801252:	83 e8 37             	sub    $0x37,%eax
+  801255:	eb c1                	jmp    801218 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801257:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80125b:	74 05                	je     801262 <strtol+0xd5>
+		*endptr = (char *) s;
+  80125d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801260:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801262:	89 c8                	mov    %ecx,%eax
+  801264:	f7 d8                	neg    %eax
+  801266:	85 ff                	test   %edi,%edi
+  801268:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80126b:	89 c8                	mov    %ecx,%eax
+  80126d:	5b                   	pop    %ebx
+  80126e:	5e                   	pop    %esi
+  80126f:	5f                   	pop    %edi
+  801270:	5d                   	pop    %ebp
+  801271:	c3                   	ret
+
+00801272 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	56                   	push   %esi
+  801277:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	89 c3                	mov    %eax,%ebx
+  801285:	89 c7                	mov    %eax,%edi
+  801287:	89 c6                	mov    %eax,%esi
+  801289:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+
+00801290 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801296:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012a0:	89 d1                	mov    %edx,%ecx
+  8012a2:	89 d3                	mov    %edx,%ebx
+  8012a4:	89 d7                	mov    %edx,%edi
+  8012a6:	89 d6                	mov    %edx,%esi
+  8012a8:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8012aa:	5b                   	pop    %ebx
+  8012ab:	5e                   	pop    %esi
+  8012ac:	5f                   	pop    %edi
+  8012ad:	5d                   	pop    %ebp
+  8012ae:	c3                   	ret
+
+008012af <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	57                   	push   %edi
+  8012b3:	56                   	push   %esi
+  8012b4:	53                   	push   %ebx
+  8012b5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012c5:	89 cb                	mov    %ecx,%ebx
+  8012c7:	89 cf                	mov    %ecx,%edi
+  8012c9:	89 ce                	mov    %ecx,%esi
+  8012cb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	7f 08                	jg     8012d9 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8012d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d4:	5b                   	pop    %ebx
+  8012d5:	5e                   	pop    %esi
+  8012d6:	5f                   	pop    %edi
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d9:	83 ec 0c             	sub    $0xc,%esp
+  8012dc:	50                   	push   %eax
+  8012dd:	6a 03                	push   $0x3
+  8012df:	68 eb 47 80 00       	push   $0x8047eb
+  8012e4:	6a 23                	push   $0x23
+  8012e6:	68 08 48 80 00       	push   $0x804808
+  8012eb:	e8 38 f4 ff ff       	call   800728 <_panic>
+
+008012f0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	57                   	push   %edi
+  8012f4:	56                   	push   %esi
+  8012f5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  801300:	89 d1                	mov    %edx,%ecx
+  801302:	89 d3                	mov    %edx,%ebx
+  801304:	89 d7                	mov    %edx,%edi
+  801306:	89 d6                	mov    %edx,%esi
+  801308:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80130a:	5b                   	pop    %ebx
+  80130b:	5e                   	pop    %esi
+  80130c:	5f                   	pop    %edi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+
+0080130f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801315:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80131f:	89 d1                	mov    %edx,%ecx
+  801321:	89 d3                	mov    %edx,%ebx
+  801323:	89 d7                	mov    %edx,%edi
+  801325:	89 d6                	mov    %edx,%esi
+  801327:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+
+0080132e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80132e:	55                   	push   %ebp
+  80132f:	89 e5                	mov    %esp,%ebp
+  801331:	57                   	push   %edi
+  801332:	56                   	push   %esi
+  801333:	53                   	push   %ebx
+  801334:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801337:	be 00 00 00 00       	mov    $0x0,%esi
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 04 00 00 00       	mov    $0x4,%eax
+  801347:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134a:	89 f7                	mov    %esi,%edi
+  80134c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80134e:	85 c0                	test   %eax,%eax
+  801350:	7f 08                	jg     80135a <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801352:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801355:	5b                   	pop    %ebx
+  801356:	5e                   	pop    %esi
+  801357:	5f                   	pop    %edi
+  801358:	5d                   	pop    %ebp
+  801359:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80135a:	83 ec 0c             	sub    $0xc,%esp
+  80135d:	50                   	push   %eax
+  80135e:	6a 04                	push   $0x4
+  801360:	68 eb 47 80 00       	push   $0x8047eb
+  801365:	6a 23                	push   $0x23
+  801367:	68 08 48 80 00       	push   $0x804808
+  80136c:	e8 b7 f3 ff ff       	call   800728 <_panic>
+
+00801371 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	57                   	push   %edi
+  801375:	56                   	push   %esi
+  801376:	53                   	push   %ebx
+  801377:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	b8 05 00 00 00       	mov    $0x5,%eax
+  801385:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801388:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80138b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80138e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801390:	85 c0                	test   %eax,%eax
+  801392:	7f 08                	jg     80139c <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801394:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801397:	5b                   	pop    %ebx
+  801398:	5e                   	pop    %esi
+  801399:	5f                   	pop    %edi
+  80139a:	5d                   	pop    %ebp
+  80139b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80139c:	83 ec 0c             	sub    $0xc,%esp
+  80139f:	50                   	push   %eax
+  8013a0:	6a 05                	push   $0x5
+  8013a2:	68 eb 47 80 00       	push   $0x8047eb
+  8013a7:	6a 23                	push   $0x23
+  8013a9:	68 08 48 80 00       	push   $0x804808
+  8013ae:	e8 75 f3 ff ff       	call   800728 <_panic>
+
+008013b3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8013b3:	55                   	push   %ebp
+  8013b4:	89 e5                	mov    %esp,%ebp
+  8013b6:	57                   	push   %edi
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+  8013b9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	b8 06 00 00 00       	mov    $0x6,%eax
+  8013cc:	89 df                	mov    %ebx,%edi
+  8013ce:	89 de                	mov    %ebx,%esi
+  8013d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	7f 08                	jg     8013de <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8013d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013d9:	5b                   	pop    %ebx
+  8013da:	5e                   	pop    %esi
+  8013db:	5f                   	pop    %edi
+  8013dc:	5d                   	pop    %ebp
+  8013dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	50                   	push   %eax
+  8013e2:	6a 06                	push   $0x6
+  8013e4:	68 eb 47 80 00       	push   $0x8047eb
+  8013e9:	6a 23                	push   $0x23
+  8013eb:	68 08 48 80 00       	push   $0x804808
+  8013f0:	e8 33 f3 ff ff       	call   800728 <_panic>
+
+008013f5 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801403:	8b 55 08             	mov    0x8(%ebp),%edx
+  801406:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801409:	b8 08 00 00 00       	mov    $0x8,%eax
+  80140e:	89 df                	mov    %ebx,%edi
+  801410:	89 de                	mov    %ebx,%esi
+  801412:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801414:	85 c0                	test   %eax,%eax
+  801416:	7f 08                	jg     801420 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801418:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141b:	5b                   	pop    %ebx
+  80141c:	5e                   	pop    %esi
+  80141d:	5f                   	pop    %edi
+  80141e:	5d                   	pop    %ebp
+  80141f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801420:	83 ec 0c             	sub    $0xc,%esp
+  801423:	50                   	push   %eax
+  801424:	6a 08                	push   $0x8
+  801426:	68 eb 47 80 00       	push   $0x8047eb
+  80142b:	6a 23                	push   $0x23
+  80142d:	68 08 48 80 00       	push   $0x804808
+  801432:	e8 f1 f2 ff ff       	call   800728 <_panic>
+
+00801437 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+  80143d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801440:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801445:	8b 55 08             	mov    0x8(%ebp),%edx
+  801448:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801450:	89 df                	mov    %ebx,%edi
+  801452:	89 de                	mov    %ebx,%esi
+  801454:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801456:	85 c0                	test   %eax,%eax
+  801458:	7f 08                	jg     801462 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80145a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80145d:	5b                   	pop    %ebx
+  80145e:	5e                   	pop    %esi
+  80145f:	5f                   	pop    %edi
+  801460:	5d                   	pop    %ebp
+  801461:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801462:	83 ec 0c             	sub    $0xc,%esp
+  801465:	50                   	push   %eax
+  801466:	6a 09                	push   $0x9
+  801468:	68 eb 47 80 00       	push   $0x8047eb
+  80146d:	6a 23                	push   $0x23
+  80146f:	68 08 48 80 00       	push   $0x804808
+  801474:	e8 af f2 ff ff       	call   800728 <_panic>
+
+00801479 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	57                   	push   %edi
+  80147d:	56                   	push   %esi
+  80147e:	53                   	push   %ebx
+  80147f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801492:	89 df                	mov    %ebx,%edi
+  801494:	89 de                	mov    %ebx,%esi
+  801496:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801498:	85 c0                	test   %eax,%eax
+  80149a:	7f 08                	jg     8014a4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80149c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149f:	5b                   	pop    %ebx
+  8014a0:	5e                   	pop    %esi
+  8014a1:	5f                   	pop    %edi
+  8014a2:	5d                   	pop    %ebp
+  8014a3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	50                   	push   %eax
+  8014a8:	6a 0a                	push   $0xa
+  8014aa:	68 eb 47 80 00       	push   $0x8047eb
+  8014af:	6a 23                	push   $0x23
+  8014b1:	68 08 48 80 00       	push   $0x804808
+  8014b6:	e8 6d f2 ff ff       	call   800728 <_panic>
+
+008014bb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+  8014be:	57                   	push   %edi
+  8014bf:	56                   	push   %esi
+  8014c0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014c7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8014d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014d7:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8014d9:	5b                   	pop    %ebx
+  8014da:	5e                   	pop    %esi
+  8014db:	5f                   	pop    %edi
+  8014dc:	5d                   	pop    %ebp
+  8014dd:	c3                   	ret
+
+008014de <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	57                   	push   %edi
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+  8014e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014f4:	89 cb                	mov    %ecx,%ebx
+  8014f6:	89 cf                	mov    %ecx,%edi
+  8014f8:	89 ce                	mov    %ecx,%esi
+  8014fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014fc:	85 c0                	test   %eax,%eax
+  8014fe:	7f 08                	jg     801508 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801503:	5b                   	pop    %ebx
+  801504:	5e                   	pop    %esi
+  801505:	5f                   	pop    %edi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801508:	83 ec 0c             	sub    $0xc,%esp
+  80150b:	50                   	push   %eax
+  80150c:	6a 0d                	push   $0xd
+  80150e:	68 eb 47 80 00       	push   $0x8047eb
+  801513:	6a 23                	push   $0x23
+  801515:	68 08 48 80 00       	push   $0x804808
+  80151a:	e8 09 f2 ff ff       	call   800728 <_panic>
+
+0080151f <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	57                   	push   %edi
+  801523:	56                   	push   %esi
+  801524:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801525:	8b 55 08             	mov    0x8(%ebp),%edx
+  801528:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80152b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801530:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801533:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801536:	8b 75 18             	mov    0x18(%ebp),%esi
+  801539:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+
+00801540 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  801546:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801549:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801554:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801559:	89 df                	mov    %ebx,%edi
+  80155b:	89 de                	mov    %ebx,%esi
+  80155d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	7f 08                	jg     80156b <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801566:	5b                   	pop    %ebx
+  801567:	5e                   	pop    %esi
+  801568:	5f                   	pop    %edi
+  801569:	5d                   	pop    %ebp
+  80156a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80156b:	83 ec 0c             	sub    $0xc,%esp
+  80156e:	50                   	push   %eax
+  80156f:	6a 0d                	push   $0xd
+  801571:	68 eb 47 80 00       	push   $0x8047eb
+  801576:	6a 23                	push   $0x23
+  801578:	68 08 48 80 00       	push   $0x804808
+  80157d:	e8 a6 f1 ff ff       	call   800728 <_panic>
+
+00801582 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	57                   	push   %edi
+  801586:	56                   	push   %esi
+  801587:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801588:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801592:	89 d1                	mov    %edx,%ecx
+  801594:	89 d3                	mov    %edx,%ebx
+  801596:	89 d7                	mov    %edx,%edi
+  801598:	89 d6                	mov    %edx,%esi
+  80159a:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80159c:	5b                   	pop    %ebx
+  80159d:	5e                   	pop    %esi
+  80159e:	5f                   	pop    %edi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+
+008015a1 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8015a1:	55                   	push   %ebp
+  8015a2:	89 e5                	mov    %esp,%ebp
+  8015a4:	57                   	push   %edi
+  8015a5:	56                   	push   %esi
+  8015a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015b7:	89 df                	mov    %ebx,%edi
+  8015b9:	89 de                	mov    %ebx,%esi
+  8015bb:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8015bd:	5b                   	pop    %ebx
+  8015be:	5e                   	pop    %esi
+  8015bf:	5f                   	pop    %edi
+  8015c0:	5d                   	pop    %ebp
+  8015c1:	c3                   	ret
+
+008015c2 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8015c2:	55                   	push   %ebp
+  8015c3:	89 e5                	mov    %esp,%ebp
+  8015c5:	57                   	push   %edi
+  8015c6:	56                   	push   %esi
+  8015c7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8015d5:	89 cb                	mov    %ecx,%ebx
+  8015d7:	89 cf                	mov    %ecx,%edi
+  8015d9:	89 ce                	mov    %ecx,%esi
+  8015db:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8015dd:	5b                   	pop    %ebx
+  8015de:	5e                   	pop    %esi
+  8015df:	5f                   	pop    %edi
+  8015e0:	5d                   	pop    %ebp
+  8015e1:	c3                   	ret
+
+008015e2 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	57                   	push   %edi
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015f3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8015f8:	89 df                	mov    %ebx,%edi
+  8015fa:	89 de                	mov    %ebx,%esi
+  8015fc:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8015fe:	5b                   	pop    %ebx
+  8015ff:	5e                   	pop    %esi
+  801600:	5f                   	pop    %edi
+  801601:	5d                   	pop    %ebp
+  801602:	c3                   	ret
+
+00801603 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801603:	55                   	push   %ebp
+  801604:	89 e5                	mov    %esp,%ebp
+  801606:	57                   	push   %edi
+  801607:	56                   	push   %esi
+  801608:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801609:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801611:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801614:	b8 12 00 00 00       	mov    $0x12,%eax
+  801619:	89 df                	mov    %ebx,%edi
+  80161b:	89 de                	mov    %ebx,%esi
+  80161d:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80161f:	5b                   	pop    %ebx
+  801620:	5e                   	pop    %esi
+  801621:	5f                   	pop    %edi
+  801622:	5d                   	pop    %ebp
+  801623:	c3                   	ret
+
+00801624 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801624:	55                   	push   %ebp
+  801625:	89 e5                	mov    %esp,%ebp
+  801627:	57                   	push   %edi
+  801628:	56                   	push   %esi
+  801629:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80162a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80162f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801632:	b8 13 00 00 00       	mov    $0x13,%eax
+  801637:	89 cb                	mov    %ecx,%ebx
+  801639:	89 cf                	mov    %ecx,%edi
+  80163b:	89 ce                	mov    %ecx,%esi
+  80163d:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80163f:	5b                   	pop    %ebx
+  801640:	5e                   	pop    %esi
+  801641:	5f                   	pop    %edi
+  801642:	5d                   	pop    %ebp
+  801643:	c3                   	ret
+
+00801644 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	57                   	push   %edi
+  801648:	56                   	push   %esi
+  801649:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80164a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801652:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801655:	b8 14 00 00 00       	mov    $0x14,%eax
+  80165a:	89 df                	mov    %ebx,%edi
+  80165c:	89 de                	mov    %ebx,%esi
+  80165e:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801660:	5b                   	pop    %ebx
+  801661:	5e                   	pop    %esi
+  801662:	5f                   	pop    %edi
+  801663:	5d                   	pop    %ebp
+  801664:	c3                   	ret
+
+00801665 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	57                   	push   %edi
+  801669:	56                   	push   %esi
+  80166a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80166b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801670:	8b 55 08             	mov    0x8(%ebp),%edx
+  801673:	b8 15 00 00 00       	mov    $0x15,%eax
+  801678:	89 cb                	mov    %ecx,%ebx
+  80167a:	89 cf                	mov    %ecx,%edi
+  80167c:	89 ce                	mov    %ecx,%esi
+  80167e:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801680:	5b                   	pop    %ebx
+  801681:	5e                   	pop    %esi
+  801682:	5f                   	pop    %edi
+  801683:	5d                   	pop    %ebp
+  801684:	c3                   	ret
+
+00801685 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	57                   	push   %edi
+  801689:	56                   	push   %esi
+  80168a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80168b:	be 00 00 00 00       	mov    $0x0,%esi
+  801690:	8b 55 08             	mov    0x8(%ebp),%edx
+  801693:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801696:	b8 16 00 00 00       	mov    $0x16,%eax
+  80169b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80169e:	89 f7                	mov    %esi,%edi
+  8016a0:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8016a2:	5b                   	pop    %ebx
+  8016a3:	5e                   	pop    %esi
+  8016a4:	5f                   	pop    %edi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+
+008016a7 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	57                   	push   %edi
+  8016ab:	56                   	push   %esi
+  8016ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016b8:	b8 17 00 00 00       	mov    $0x17,%eax
+  8016bd:	89 df                	mov    %ebx,%edi
+  8016bf:	89 de                	mov    %ebx,%esi
+  8016c1:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5f                   	pop    %edi
+  8016c6:	5d                   	pop    %ebp
+  8016c7:	c3                   	ret
+
+008016c8 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8016c8:	55                   	push   %ebp
+  8016c9:	89 e5                	mov    %esp,%ebp
+  8016cb:	57                   	push   %edi
+  8016cc:	56                   	push   %esi
+  8016cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d6:	b8 18 00 00 00       	mov    $0x18,%eax
+  8016db:	89 cb                	mov    %ecx,%ebx
+  8016dd:	89 cf                	mov    %ecx,%edi
+  8016df:	89 ce                	mov    %ecx,%esi
+  8016e1:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+
+008016e8 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	57                   	push   %edi
+  8016ec:	56                   	push   %esi
+  8016ed:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8016ee:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8016f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016fa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8016ff:	89 df                	mov    %ebx,%edi
+  801701:	89 de                	mov    %ebx,%esi
+  801703:	cd 30                	int    $0x30
+}
+  801705:	5b                   	pop    %ebx
+  801706:	5e                   	pop    %esi
+  801707:	5f                   	pop    %edi
+  801708:	5d                   	pop    %ebp
+  801709:	c3                   	ret
+
+0080170a <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801710:	be 00 00 00 00       	mov    $0x0,%esi
+  801715:	8b 55 08             	mov    0x8(%ebp),%edx
+  801718:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80171b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801720:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801723:	89 f7                	mov    %esi,%edi
+  801725:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801727:	5b                   	pop    %ebx
+  801728:	5e                   	pop    %esi
+  801729:	5f                   	pop    %edi
+  80172a:	5d                   	pop    %ebp
+  80172b:	c3                   	ret
+
+0080172c <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  80172c:	55                   	push   %ebp
+  80172d:	89 e5                	mov    %esp,%ebp
+  80172f:	57                   	push   %edi
+  801730:	56                   	push   %esi
+  801731:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801732:	be 00 00 00 00       	mov    $0x0,%esi
+  801737:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80173d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801742:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801745:	89 f7                	mov    %esi,%edi
+  801747:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801749:	5b                   	pop    %ebx
+  80174a:	5e                   	pop    %esi
+  80174b:	5f                   	pop    %edi
+  80174c:	5d                   	pop    %ebp
+  80174d:	c3                   	ret
+
+0080174e <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	57                   	push   %edi
+  801752:	56                   	push   %esi
+  801753:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801754:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801759:	8b 55 08             	mov    0x8(%ebp),%edx
+  80175c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80175f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801764:	89 df                	mov    %ebx,%edi
+  801766:	89 de                	mov    %ebx,%esi
+  801768:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80176a:	5b                   	pop    %ebx
+  80176b:	5e                   	pop    %esi
+  80176c:	5f                   	pop    %edi
+  80176d:	5d                   	pop    %ebp
+  80176e:	c3                   	ret
+
+0080176f <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80176f:	55                   	push   %ebp
+  801770:	89 e5                	mov    %esp,%ebp
+  801772:	57                   	push   %edi
+  801773:	56                   	push   %esi
+  801774:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801775:	be 00 00 00 00       	mov    $0x0,%esi
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801780:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801785:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801788:	89 f7                	mov    %esi,%edi
+  80178a:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  80178c:	5b                   	pop    %ebx
+  80178d:	5e                   	pop    %esi
+  80178e:	5f                   	pop    %edi
+  80178f:	5d                   	pop    %ebp
+  801790:	c3                   	ret
+
+00801791 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	56                   	push   %esi
+  801795:	53                   	push   %ebx
+  801796:	8b 75 08             	mov    0x8(%ebp),%esi
+  801799:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80179c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80179f:	85 c0                	test   %eax,%eax
+  8017a1:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8017a6:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8017a9:	83 ec 0c             	sub    $0xc,%esp
+  8017ac:	50                   	push   %eax
+  8017ad:	e8 2c fd ff ff       	call   8014de <sys_ipc_recv>
+  8017b2:	83 c4 10             	add    $0x10,%esp
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	0f 88 8b 00 00 00    	js     801848 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8017bd:	85 f6                	test   %esi,%esi
+  8017bf:	74 2a                	je     8017eb <ipc_recv+0x5a>
+  8017c1:	89 e2                	mov    %esp,%edx
+  8017c3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017c8:	29 d0                	sub    %edx,%eax
+  8017ca:	89 c2                	mov    %eax,%edx
+  8017cc:	c1 ea 0f             	shr    $0xf,%edx
+  8017cf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d9:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8017dc:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8017e3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8017e9:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  8017eb:	85 db                	test   %ebx,%ebx
+  8017ed:	74 2a                	je     801819 <ipc_recv+0x88>
+  8017ef:	89 e2                	mov    %esp,%edx
+  8017f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017f6:	29 d0                	sub    %edx,%eax
+  8017f8:	89 c2                	mov    %eax,%edx
+  8017fa:	c1 ea 0f             	shr    $0xf,%edx
+  8017fd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801802:	b8 00 00 00 00       	mov    $0x0,%eax
+  801807:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80180a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801811:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801817:	89 03                	mov    %eax,(%ebx)
+  801819:	89 e2                	mov    %esp,%edx
+  80181b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801820:	29 d0                	sub    %edx,%eax
+  801822:	89 c2                	mov    %eax,%edx
+  801824:	c1 ea 0f             	shr    $0xf,%edx
+  801827:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80182c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801831:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801834:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80183b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801841:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801844:	5b                   	pop    %ebx
+  801845:	5e                   	pop    %esi
+  801846:	5d                   	pop    %ebp
+  801847:	c3                   	ret
+		if(from_env_store != NULL)
+  801848:	85 f6                	test   %esi,%esi
+  80184a:	74 06                	je     801852 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80184c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801852:	85 db                	test   %ebx,%ebx
+  801854:	74 eb                	je     801841 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801856:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80185c:	eb e3                	jmp    801841 <ipc_recv+0xb0>
+
+0080185e <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80185e:	55                   	push   %ebp
+  80185f:	89 e5                	mov    %esp,%ebp
+  801861:	57                   	push   %edi
+  801862:	56                   	push   %esi
+  801863:	53                   	push   %ebx
+  801864:	83 ec 14             	sub    $0x14,%esp
+  801867:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80186a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80186d:	8b 75 14             	mov    0x14(%ebp),%esi
+  801870:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801873:	85 c0                	test   %eax,%eax
+  801875:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80187a:	0f 44 c2             	cmove  %edx,%eax
+  80187d:	ff 75 10             	push   0x10(%ebp)
+  801880:	50                   	push   %eax
+  801881:	e8 ba fc ff ff       	call   801540 <sys_ipc_recv_pages>
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	0f 88 ba 00 00 00    	js     80194b <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801891:	85 ff                	test   %edi,%edi
+  801893:	74 2a                	je     8018bf <ipc_recv_pages+0x61>
+  801895:	89 e2                	mov    %esp,%edx
+  801897:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80189c:	29 d0                	sub    %edx,%eax
+  80189e:	89 c2                	mov    %eax,%edx
+  8018a0:	c1 ea 0f             	shr    $0xf,%edx
+  8018a3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ad:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8018b0:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8018b7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8018bd:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8018bf:	85 f6                	test   %esi,%esi
+  8018c1:	74 2a                	je     8018ed <ipc_recv_pages+0x8f>
+  8018c3:	89 e2                	mov    %esp,%edx
+  8018c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018ca:	29 d0                	sub    %edx,%eax
+  8018cc:	89 c2                	mov    %eax,%edx
+  8018ce:	c1 ea 0f             	shr    $0xf,%edx
+  8018d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018db:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8018de:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8018e5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8018eb:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  8018ed:	85 db                	test   %ebx,%ebx
+  8018ef:	74 2a                	je     80191b <ipc_recv_pages+0xbd>
+  8018f1:	89 e2                	mov    %esp,%edx
+  8018f3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018f8:	29 d0                	sub    %edx,%eax
+  8018fa:	89 c2                	mov    %eax,%edx
+  8018fc:	c1 ea 0f             	shr    $0xf,%edx
+  8018ff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801904:	b8 00 00 00 00       	mov    $0x0,%eax
+  801909:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80190c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801913:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801919:	89 03                	mov    %eax,(%ebx)
+  80191b:	89 e2                	mov    %esp,%edx
+  80191d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801922:	29 d0                	sub    %edx,%eax
+  801924:	89 c2                	mov    %eax,%edx
+  801926:	c1 ea 0f             	shr    $0xf,%edx
+  801929:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80192e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801933:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801936:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80193d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801943:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5f                   	pop    %edi
+  801949:	5d                   	pop    %ebp
+  80194a:	c3                   	ret
+		if (from_env_store)
+  80194b:	85 ff                	test   %edi,%edi
+  80194d:	74 06                	je     801955 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80194f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801955:	85 f6                	test   %esi,%esi
+  801957:	74 06                	je     80195f <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801959:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80195f:	85 db                	test   %ebx,%ebx
+  801961:	74 e0                	je     801943 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801963:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801969:	eb d8                	jmp    801943 <ipc_recv_pages+0xe5>
+
+0080196b <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	57                   	push   %edi
+  80196f:	56                   	push   %esi
+  801970:	53                   	push   %ebx
+  801971:	83 ec 1c             	sub    $0x1c,%esp
+  801974:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801977:	8b 75 08             	mov    0x8(%ebp),%esi
+  80197a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801980:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801984:	75 2b                	jne    8019b1 <ipc_try_send_pages+0x46>
+  801986:	89 e2                	mov    %esp,%edx
+  801988:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80198d:	29 d0                	sub    %edx,%eax
+  80198f:	89 c2                	mov    %eax,%edx
+  801991:	c1 ea 0f             	shr    $0xf,%edx
+  801994:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199e:	0f 42 c2             	cmovb  %edx,%eax
+  8019a1:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8019a8:	8b 70 48             	mov    0x48(%eax),%esi
+  8019ab:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8019b1:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8019b7:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8019bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019bf:	85 ff                	test   %edi,%edi
+  8019c1:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8019c6:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8019c9:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8019cf:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8019d5:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	ff 75 14             	push   0x14(%ebp)
+  8019e1:	ff 75 18             	push   0x18(%ebp)
+  8019e4:	57                   	push   %edi
+  8019e5:	ff 75 0c             	push   0xc(%ebp)
+  8019e8:	ff 75 08             	push   0x8(%ebp)
+  8019eb:	e8 2f fb ff ff       	call   80151f <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  8019f0:	83 c4 20             	add    $0x20,%esp
+  8019f3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019f6:	75 21                	jne    801a19 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  8019f8:	83 ec 04             	sub    $0x4,%esp
+  8019fb:	6a ff                	push   $0xffffffff
+  8019fd:	53                   	push   %ebx
+  8019fe:	ff 75 e4             	push   -0x1c(%ebp)
+  801a01:	e8 26 fd ff ff       	call   80172c <sys_futex_wait>
+  801a06:	83 c4 10             	add    $0x10,%esp
+  801a09:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801a0c:	74 c7                	je     8019d5 <ipc_try_send_pages+0x6a>
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	79 c3                	jns    8019d5 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801a12:	e8 f8 f8 ff ff       	call   80130f <sys_yield>
+  801a17:	eb bc                	jmp    8019d5 <ipc_try_send_pages+0x6a>
+	}
+}
+  801a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a1c:	5b                   	pop    %ebx
+  801a1d:	5e                   	pop    %esi
+  801a1e:	5f                   	pop    %edi
+  801a1f:	5d                   	pop    %ebp
+  801a20:	c3                   	ret
+
+00801a21 <ipc_send>:
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801a27:	ff 75 14             	push   0x14(%ebp)
+  801a2a:	6a 01                	push   $0x1
+  801a2c:	ff 75 10             	push   0x10(%ebp)
+  801a2f:	ff 75 0c             	push   0xc(%ebp)
+  801a32:	ff 75 08             	push   0x8(%ebp)
+  801a35:	e8 31 ff ff ff       	call   80196b <ipc_try_send_pages>
+  801a3a:	83 c4 20             	add    $0x20,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 02                	js     801a43 <ipc_send+0x22>
+}
+  801a41:	c9                   	leave
+  801a42:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801a43:	50                   	push   %eax
+  801a44:	68 16 48 80 00       	push   $0x804816
+  801a49:	6a 3f                	push   $0x3f
+  801a4b:	68 2b 48 80 00       	push   $0x80482b
+  801a50:	e8 d3 ec ff ff       	call   800728 <_panic>
+
+00801a55 <ipc_send_pages>:
+{
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801a5b:	ff 75 18             	push   0x18(%ebp)
+  801a5e:	ff 75 14             	push   0x14(%ebp)
+  801a61:	ff 75 10             	push   0x10(%ebp)
+  801a64:	ff 75 0c             	push   0xc(%ebp)
+  801a67:	ff 75 08             	push   0x8(%ebp)
+  801a6a:	e8 fc fe ff ff       	call   80196b <ipc_try_send_pages>
+  801a6f:	83 c4 20             	add    $0x20,%esp
+  801a72:	85 c0                	test   %eax,%eax
+  801a74:	78 02                	js     801a78 <ipc_send_pages+0x23>
+}
+  801a76:	c9                   	leave
+  801a77:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801a78:	50                   	push   %eax
+  801a79:	68 35 48 80 00       	push   $0x804835
+  801a7e:	6a 64                	push   $0x64
+  801a80:	68 2b 48 80 00       	push   $0x80482b
+  801a85:	e8 9e ec ff ff       	call   800728 <_panic>
+
+00801a8a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801a90:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801a95:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801a9b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801aa1:	8b 52 50             	mov    0x50(%edx),%edx
+  801aa4:	39 ca                	cmp    %ecx,%edx
+  801aa6:	74 11                	je     801ab9 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801aa8:	83 c0 01             	add    $0x1,%eax
+  801aab:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ab0:	75 e3                	jne    801a95 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab7:	eb 0e                	jmp    801ac7 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801ab9:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801abf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ac4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+
+00801ac9 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801acf:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ad4:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ad7:	5d                   	pop    %ebp
+  801ad8:	c3                   	ret
+
+00801ad9 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ad9:	55                   	push   %ebp
+  801ada:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801adc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801adf:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801ae4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801ae9:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+
+00801af0 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801af8:	89 c2                	mov    %eax,%edx
+  801afa:	c1 ea 16             	shr    $0x16,%edx
+  801afd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b04:	f6 c2 01             	test   $0x1,%dl
+  801b07:	74 29                	je     801b32 <fd_alloc+0x42>
+  801b09:	89 c2                	mov    %eax,%edx
+  801b0b:	c1 ea 0c             	shr    $0xc,%edx
+  801b0e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b15:	f6 c2 01             	test   $0x1,%dl
+  801b18:	74 18                	je     801b32 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801b1a:	05 00 10 00 00       	add    $0x1000,%eax
+  801b1f:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801b24:	75 d2                	jne    801af8 <fd_alloc+0x8>
+  801b26:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801b2b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801b30:	eb 05                	jmp    801b37 <fd_alloc+0x47>
+			return 0;
+  801b32:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801b37:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b3a:	89 02                	mov    %eax,(%edx)
+}
+  801b3c:	89 c8                	mov    %ecx,%eax
+  801b3e:	5d                   	pop    %ebp
+  801b3f:	c3                   	ret
+
+00801b40 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801b46:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801b4b:	77 30                	ja     801b7d <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801b4d:	c1 e0 0c             	shl    $0xc,%eax
+  801b50:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801b55:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b5b:	f6 c2 01             	test   $0x1,%dl
+  801b5e:	74 24                	je     801b84 <fd_lookup+0x44>
+  801b60:	89 c2                	mov    %eax,%edx
+  801b62:	c1 ea 0c             	shr    $0xc,%edx
+  801b65:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b6c:	f6 c2 01             	test   $0x1,%dl
+  801b6f:	74 1a                	je     801b8b <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b74:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b7b:	5d                   	pop    %ebp
+  801b7c:	c3                   	ret
+		return -E_INVAL;
+  801b7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b82:	eb f7                	jmp    801b7b <fd_lookup+0x3b>
+		return -E_INVAL;
+  801b84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b89:	eb f0                	jmp    801b7b <fd_lookup+0x3b>
+  801b8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b90:	eb e9                	jmp    801b7b <fd_lookup+0x3b>
+
+00801b92 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	53                   	push   %ebx
+  801b96:	83 ec 04             	sub    $0x4,%esp
+  801b99:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba1:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801ba6:	39 13                	cmp    %edx,(%ebx)
+  801ba8:	74 54                	je     801bfe <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801baa:	83 c0 01             	add    $0x1,%eax
+  801bad:	8b 1c 85 cc 48 80 00 	mov    0x8048cc(,%eax,4),%ebx
+  801bb4:	85 db                	test   %ebx,%ebx
+  801bb6:	75 ee                	jne    801ba6 <dev_lookup+0x14>
+  801bb8:	89 e1                	mov    %esp,%ecx
+  801bba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bbf:	29 c8                	sub    %ecx,%eax
+  801bc1:	89 c1                	mov    %eax,%ecx
+  801bc3:	c1 e9 0f             	shr    $0xf,%ecx
+  801bc6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd0:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bd3:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801bda:	8b 40 48             	mov    0x48(%eax),%eax
+  801bdd:	83 ec 04             	sub    $0x4,%esp
+  801be0:	52                   	push   %edx
+  801be1:	50                   	push   %eax
+  801be2:	68 50 48 80 00       	push   $0x804850
+  801be7:	e8 17 ec ff ff       	call   800803 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801bf4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bf7:	89 1a                	mov    %ebx,(%edx)
+}
+  801bf9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfc:	c9                   	leave
+  801bfd:	c3                   	ret
+			return 0;
+  801bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c03:	eb ef                	jmp    801bf4 <dev_lookup+0x62>
+
+00801c05 <fd_close>:
+{
+  801c05:	55                   	push   %ebp
+  801c06:	89 e5                	mov    %esp,%ebp
+  801c08:	57                   	push   %edi
+  801c09:	56                   	push   %esi
+  801c0a:	53                   	push   %ebx
+  801c0b:	83 ec 24             	sub    $0x24,%esp
+  801c0e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c11:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c14:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c17:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801c18:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801c1e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801c21:	50                   	push   %eax
+  801c22:	e8 19 ff ff ff       	call   801b40 <fd_lookup>
+  801c27:	89 c3                	mov    %eax,%ebx
+  801c29:	83 c4 10             	add    $0x10,%esp
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	78 05                	js     801c35 <fd_close+0x30>
+	    || fd != fd2)
+  801c30:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801c33:	74 0f                	je     801c44 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801c35:	85 ff                	test   %edi,%edi
+  801c37:	0f 44 df             	cmove  %edi,%ebx
+}
+  801c3a:	89 d8                	mov    %ebx,%eax
+  801c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5f                   	pop    %edi
+  801c42:	5d                   	pop    %ebp
+  801c43:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c44:	83 ec 08             	sub    $0x8,%esp
+  801c47:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801c4a:	50                   	push   %eax
+  801c4b:	ff 36                	push   (%esi)
+  801c4d:	e8 40 ff ff ff       	call   801b92 <dev_lookup>
+  801c52:	89 c3                	mov    %eax,%ebx
+  801c54:	83 c4 10             	add    $0x10,%esp
+  801c57:	85 c0                	test   %eax,%eax
+  801c59:	78 1a                	js     801c75 <fd_close+0x70>
+		if (dev->dev_close)
+  801c5b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c5e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801c61:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	74 0b                	je     801c75 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801c6a:	83 ec 0c             	sub    $0xc,%esp
+  801c6d:	56                   	push   %esi
+  801c6e:	ff d0                	call   *%eax
+  801c70:	89 c3                	mov    %eax,%ebx
+  801c72:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c75:	83 ec 08             	sub    $0x8,%esp
+  801c78:	56                   	push   %esi
+  801c79:	6a 00                	push   $0x0
+  801c7b:	e8 33 f7 ff ff       	call   8013b3 <sys_page_unmap>
+	return r;
+  801c80:	83 c4 10             	add    $0x10,%esp
+  801c83:	eb b5                	jmp    801c3a <fd_close+0x35>
+
+00801c85 <close>:
+
+int
+close(int fdnum)
+{
+  801c85:	55                   	push   %ebp
+  801c86:	89 e5                	mov    %esp,%ebp
+  801c88:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8e:	50                   	push   %eax
+  801c8f:	ff 75 08             	push   0x8(%ebp)
+  801c92:	e8 a9 fe ff ff       	call   801b40 <fd_lookup>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	79 02                	jns    801ca0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c9e:	c9                   	leave
+  801c9f:	c3                   	ret
+		return fd_close(fd, 1);
+  801ca0:	83 ec 08             	sub    $0x8,%esp
+  801ca3:	6a 01                	push   $0x1
+  801ca5:	ff 75 f4             	push   -0xc(%ebp)
+  801ca8:	e8 58 ff ff ff       	call   801c05 <fd_close>
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	eb ec                	jmp    801c9e <close+0x19>
+
+00801cb2 <close_all>:
+
+void
+close_all(void)
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801cb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801cbe:	83 ec 0c             	sub    $0xc,%esp
+  801cc1:	53                   	push   %ebx
+  801cc2:	e8 be ff ff ff       	call   801c85 <close>
+	for (i = 0; i < MAXFD; i++)
+  801cc7:	83 c3 01             	add    $0x1,%ebx
+  801cca:	83 c4 10             	add    $0x10,%esp
+  801ccd:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801cd3:	75 e9                	jne    801cbe <close_all+0xc>
+}
+  801cd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cd8:	c9                   	leave
+  801cd9:	c3                   	ret
+
+00801cda <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801cda:	55                   	push   %ebp
+  801cdb:	89 e5                	mov    %esp,%ebp
+  801cdd:	57                   	push   %edi
+  801cde:	56                   	push   %esi
+  801cdf:	53                   	push   %ebx
+  801ce0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ce3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	ff 75 08             	push   0x8(%ebp)
+  801cea:	e8 51 fe ff ff       	call   801b40 <fd_lookup>
+  801cef:	89 c3                	mov    %eax,%ebx
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	85 c0                	test   %eax,%eax
+  801cf6:	78 7f                	js     801d77 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801cf8:	83 ec 0c             	sub    $0xc,%esp
+  801cfb:	ff 75 0c             	push   0xc(%ebp)
+  801cfe:	e8 82 ff ff ff       	call   801c85 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801d03:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801d06:	c1 e6 0c             	shl    $0xc,%esi
+  801d09:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801d0f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801d12:	89 3c 24             	mov    %edi,(%esp)
+  801d15:	e8 bf fd ff ff       	call   801ad9 <fd2data>
+  801d1a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801d1c:	89 34 24             	mov    %esi,(%esp)
+  801d1f:	e8 b5 fd ff ff       	call   801ad9 <fd2data>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801d2a:	89 d8                	mov    %ebx,%eax
+  801d2c:	c1 e8 16             	shr    $0x16,%eax
+  801d2f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d36:	a8 01                	test   $0x1,%al
+  801d38:	74 11                	je     801d4b <dup+0x71>
+  801d3a:	89 d8                	mov    %ebx,%eax
+  801d3c:	c1 e8 0c             	shr    $0xc,%eax
+  801d3f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801d46:	f6 c2 01             	test   $0x1,%dl
+  801d49:	75 36                	jne    801d81 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d4b:	89 f8                	mov    %edi,%eax
+  801d4d:	c1 e8 0c             	shr    $0xc,%eax
+  801d50:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d5f:	50                   	push   %eax
+  801d60:	56                   	push   %esi
+  801d61:	6a 00                	push   $0x0
+  801d63:	57                   	push   %edi
+  801d64:	6a 00                	push   $0x0
+  801d66:	e8 06 f6 ff ff       	call   801371 <sys_page_map>
+  801d6b:	89 c3                	mov    %eax,%ebx
+  801d6d:	83 c4 20             	add    $0x20,%esp
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	78 33                	js     801da7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d77:	89 d8                	mov    %ebx,%eax
+  801d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7c:	5b                   	pop    %ebx
+  801d7d:	5e                   	pop    %esi
+  801d7e:	5f                   	pop    %edi
+  801d7f:	5d                   	pop    %ebp
+  801d80:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d81:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d88:	83 ec 0c             	sub    $0xc,%esp
+  801d8b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d90:	50                   	push   %eax
+  801d91:	ff 75 d4             	push   -0x2c(%ebp)
+  801d94:	6a 00                	push   $0x0
+  801d96:	53                   	push   %ebx
+  801d97:	6a 00                	push   $0x0
+  801d99:	e8 d3 f5 ff ff       	call   801371 <sys_page_map>
+  801d9e:	89 c3                	mov    %eax,%ebx
+  801da0:	83 c4 20             	add    $0x20,%esp
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	79 a4                	jns    801d4b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801da7:	83 ec 08             	sub    $0x8,%esp
+  801daa:	56                   	push   %esi
+  801dab:	6a 00                	push   $0x0
+  801dad:	e8 01 f6 ff ff       	call   8013b3 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801db2:	83 c4 08             	add    $0x8,%esp
+  801db5:	ff 75 d4             	push   -0x2c(%ebp)
+  801db8:	6a 00                	push   $0x0
+  801dba:	e8 f4 f5 ff ff       	call   8013b3 <sys_page_unmap>
+	return r;
+  801dbf:	83 c4 10             	add    $0x10,%esp
+  801dc2:	eb b3                	jmp    801d77 <dup+0x9d>
+
+00801dc4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801dc4:	55                   	push   %ebp
+  801dc5:	89 e5                	mov    %esp,%ebp
+  801dc7:	56                   	push   %esi
+  801dc8:	53                   	push   %ebx
+  801dc9:	83 ec 18             	sub    $0x18,%esp
+  801dcc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dcf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dd2:	50                   	push   %eax
+  801dd3:	53                   	push   %ebx
+  801dd4:	e8 67 fd ff ff       	call   801b40 <fd_lookup>
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 3c                	js     801e1c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801de0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801de9:	50                   	push   %eax
+  801dea:	ff 36                	push   (%esi)
+  801dec:	e8 a1 fd ff ff       	call   801b92 <dev_lookup>
+  801df1:	83 c4 10             	add    $0x10,%esp
+  801df4:	85 c0                	test   %eax,%eax
+  801df6:	78 24                	js     801e1c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801df8:	8b 46 08             	mov    0x8(%esi),%eax
+  801dfb:	83 e0 03             	and    $0x3,%eax
+  801dfe:	83 f8 01             	cmp    $0x1,%eax
+  801e01:	74 20                	je     801e23 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801e03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e06:	8b 40 08             	mov    0x8(%eax),%eax
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	74 54                	je     801e61 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801e0d:	83 ec 04             	sub    $0x4,%esp
+  801e10:	ff 75 10             	push   0x10(%ebp)
+  801e13:	ff 75 0c             	push   0xc(%ebp)
+  801e16:	56                   	push   %esi
+  801e17:	ff d0                	call   *%eax
+  801e19:	83 c4 10             	add    $0x10,%esp
+}
+  801e1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1f:	5b                   	pop    %ebx
+  801e20:	5e                   	pop    %esi
+  801e21:	5d                   	pop    %ebp
+  801e22:	c3                   	ret
+  801e23:	89 e2                	mov    %esp,%edx
+  801e25:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e2a:	29 d0                	sub    %edx,%eax
+  801e2c:	89 c2                	mov    %eax,%edx
+  801e2e:	c1 ea 0f             	shr    $0xf,%edx
+  801e31:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e3b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e3e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801e45:	8b 40 48             	mov    0x48(%eax),%eax
+  801e48:	83 ec 04             	sub    $0x4,%esp
+  801e4b:	53                   	push   %ebx
+  801e4c:	50                   	push   %eax
+  801e4d:	68 91 48 80 00       	push   $0x804891
+  801e52:	e8 ac e9 ff ff       	call   800803 <cprintf>
+		return -E_INVAL;
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e5f:	eb bb                	jmp    801e1c <read+0x58>
+		return -E_NOT_SUPP;
+  801e61:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e66:	eb b4                	jmp    801e1c <read+0x58>
+
+00801e68 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e68:	55                   	push   %ebp
+  801e69:	89 e5                	mov    %esp,%ebp
+  801e6b:	57                   	push   %edi
+  801e6c:	56                   	push   %esi
+  801e6d:	53                   	push   %ebx
+  801e6e:	83 ec 0c             	sub    $0xc,%esp
+  801e71:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e74:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e77:	85 f6                	test   %esi,%esi
+  801e79:	74 30                	je     801eab <readn+0x43>
+  801e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e80:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e85:	83 ec 04             	sub    $0x4,%esp
+  801e88:	89 f2                	mov    %esi,%edx
+  801e8a:	29 c2                	sub    %eax,%edx
+  801e8c:	52                   	push   %edx
+  801e8d:	01 f8                	add    %edi,%eax
+  801e8f:	50                   	push   %eax
+  801e90:	ff 75 08             	push   0x8(%ebp)
+  801e93:	e8 2c ff ff ff       	call   801dc4 <read>
+		if (m < 0)
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 15                	js     801eb4 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801e9f:	74 11                	je     801eb2 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801ea1:	01 c3                	add    %eax,%ebx
+  801ea3:	89 d8                	mov    %ebx,%eax
+  801ea5:	39 f3                	cmp    %esi,%ebx
+  801ea7:	72 dc                	jb     801e85 <readn+0x1d>
+  801ea9:	eb 09                	jmp    801eb4 <readn+0x4c>
+  801eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb0:	eb 02                	jmp    801eb4 <readn+0x4c>
+  801eb2:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801eb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb7:	5b                   	pop    %ebx
+  801eb8:	5e                   	pop    %esi
+  801eb9:	5f                   	pop    %edi
+  801eba:	5d                   	pop    %ebp
+  801ebb:	c3                   	ret
+
+00801ebc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ebc:	55                   	push   %ebp
+  801ebd:	89 e5                	mov    %esp,%ebp
+  801ebf:	56                   	push   %esi
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 18             	sub    $0x18,%esp
+  801ec4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ec7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801eca:	50                   	push   %eax
+  801ecb:	53                   	push   %ebx
+  801ecc:	e8 6f fc ff ff       	call   801b40 <fd_lookup>
+  801ed1:	83 c4 10             	add    $0x10,%esp
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 37                	js     801f0f <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ed8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801edb:	83 ec 08             	sub    $0x8,%esp
+  801ede:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ee1:	50                   	push   %eax
+  801ee2:	ff 36                	push   (%esi)
+  801ee4:	e8 a9 fc ff ff       	call   801b92 <dev_lookup>
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	78 1f                	js     801f0f <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ef4:	74 20                	je     801f16 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801ef6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	74 54                	je     801f54 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801f00:	83 ec 04             	sub    $0x4,%esp
+  801f03:	ff 75 10             	push   0x10(%ebp)
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	56                   	push   %esi
+  801f0a:	ff d0                	call   *%eax
+  801f0c:	83 c4 10             	add    $0x10,%esp
+}
+  801f0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f12:	5b                   	pop    %ebx
+  801f13:	5e                   	pop    %esi
+  801f14:	5d                   	pop    %ebp
+  801f15:	c3                   	ret
+  801f16:	89 e2                	mov    %esp,%edx
+  801f18:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f1d:	29 d0                	sub    %edx,%eax
+  801f1f:	89 c2                	mov    %eax,%edx
+  801f21:	c1 ea 0f             	shr    $0xf,%edx
+  801f24:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f31:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801f38:	8b 40 48             	mov    0x48(%eax),%eax
+  801f3b:	83 ec 04             	sub    $0x4,%esp
+  801f3e:	53                   	push   %ebx
+  801f3f:	50                   	push   %eax
+  801f40:	68 ad 48 80 00       	push   $0x8048ad
+  801f45:	e8 b9 e8 ff ff       	call   800803 <cprintf>
+		return -E_INVAL;
+  801f4a:	83 c4 10             	add    $0x10,%esp
+  801f4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f52:	eb bb                	jmp    801f0f <write+0x53>
+		return -E_NOT_SUPP;
+  801f54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f59:	eb b4                	jmp    801f0f <write+0x53>
+
+00801f5b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801f5b:	55                   	push   %ebp
+  801f5c:	89 e5                	mov    %esp,%ebp
+  801f5e:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f64:	50                   	push   %eax
+  801f65:	ff 75 08             	push   0x8(%ebp)
+  801f68:	e8 d3 fb ff ff       	call   801b40 <fd_lookup>
+  801f6d:	83 c4 10             	add    $0x10,%esp
+  801f70:	85 c0                	test   %eax,%eax
+  801f72:	78 0e                	js     801f82 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7a:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f82:	c9                   	leave
+  801f83:	c3                   	ret
+
+00801f84 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801f84:	55                   	push   %ebp
+  801f85:	89 e5                	mov    %esp,%ebp
+  801f87:	53                   	push   %ebx
+  801f88:	83 ec 1c             	sub    $0x1c,%esp
+  801f8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f91:	50                   	push   %eax
+  801f92:	ff 75 08             	push   0x8(%ebp)
+  801f95:	e8 a6 fb ff ff       	call   801b40 <fd_lookup>
+  801f9a:	83 c4 10             	add    $0x10,%esp
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 33                	js     801fd4 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801fa1:	83 fb 03             	cmp    $0x3,%ebx
+  801fa4:	74 28                	je     801fce <fcntl+0x4a>
+  801fa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fab:	83 fb 04             	cmp    $0x4,%ebx
+  801fae:	75 24                	jne    801fd4 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801fb0:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801fb3:	8b 41 08             	mov    0x8(%ecx),%eax
+  801fb6:	80 e4 ef             	and    $0xef,%ah
+  801fb9:	8b 55 10             	mov    0x10(%ebp),%edx
+  801fbc:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801fc2:	09 d0                	or     %edx,%eax
+  801fc4:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	eb 06                	jmp    801fd4 <fcntl+0x50>
+		return fd->fd_omode;
+  801fce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd1:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801fd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fd7:	c9                   	leave
+  801fd8:	c3                   	ret
+
+00801fd9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801fd9:	55                   	push   %ebp
+  801fda:	89 e5                	mov    %esp,%ebp
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 18             	sub    $0x18,%esp
+  801fe1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fe4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fe7:	50                   	push   %eax
+  801fe8:	53                   	push   %ebx
+  801fe9:	e8 52 fb ff ff       	call   801b40 <fd_lookup>
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 34                	js     802029 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ff5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ff8:	83 ec 08             	sub    $0x8,%esp
+  801ffb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ffe:	50                   	push   %eax
+  801fff:	ff 36                	push   (%esi)
+  802001:	e8 8c fb ff ff       	call   801b92 <dev_lookup>
+  802006:	83 c4 10             	add    $0x10,%esp
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	78 1c                	js     802029 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80200d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802011:	74 1d                	je     802030 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802013:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802016:	8b 40 18             	mov    0x18(%eax),%eax
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	74 51                	je     80206e <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80201d:	83 ec 08             	sub    $0x8,%esp
+  802020:	ff 75 0c             	push   0xc(%ebp)
+  802023:	56                   	push   %esi
+  802024:	ff d0                	call   *%eax
+  802026:	83 c4 10             	add    $0x10,%esp
+}
+  802029:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80202c:	5b                   	pop    %ebx
+  80202d:	5e                   	pop    %esi
+  80202e:	5d                   	pop    %ebp
+  80202f:	c3                   	ret
+  802030:	89 e2                	mov    %esp,%edx
+  802032:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802037:	29 d0                	sub    %edx,%eax
+  802039:	89 c2                	mov    %eax,%edx
+  80203b:	c1 ea 0f             	shr    $0xf,%edx
+  80203e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802043:	b8 00 00 00 00       	mov    $0x0,%eax
+  802048:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80204b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802052:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	53                   	push   %ebx
+  802059:	50                   	push   %eax
+  80205a:	68 70 48 80 00       	push   $0x804870
+  80205f:	e8 9f e7 ff ff       	call   800803 <cprintf>
+		return -E_INVAL;
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80206c:	eb bb                	jmp    802029 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80206e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802073:	eb b4                	jmp    802029 <ftruncate+0x50>
+
+00802075 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802075:	55                   	push   %ebp
+  802076:	89 e5                	mov    %esp,%ebp
+  802078:	56                   	push   %esi
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 18             	sub    $0x18,%esp
+  80207d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802080:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802083:	50                   	push   %eax
+  802084:	ff 75 08             	push   0x8(%ebp)
+  802087:	e8 b4 fa ff ff       	call   801b40 <fd_lookup>
+  80208c:	83 c4 10             	add    $0x10,%esp
+  80208f:	85 c0                	test   %eax,%eax
+  802091:	78 53                	js     8020e6 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802093:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802096:	83 ec 08             	sub    $0x8,%esp
+  802099:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209c:	50                   	push   %eax
+  80209d:	ff 36                	push   (%esi)
+  80209f:	e8 ee fa ff ff       	call   801b92 <dev_lookup>
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 3b                	js     8020e6 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8020ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ae:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020b2:	74 39                	je     8020ed <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8020b4:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8020b7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020be:	00 00 00 
+	stat->st_isdir = 0;
+  8020c1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020c8:	00 00 00 
+	stat->st_version = 0;
+  8020cb:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8020d2:	00 00 00 
+	stat->st_dev = dev;
+  8020d5:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8020db:	83 ec 08             	sub    $0x8,%esp
+  8020de:	53                   	push   %ebx
+  8020df:	56                   	push   %esi
+  8020e0:	ff 50 14             	call   *0x14(%eax)
+  8020e3:	83 c4 10             	add    $0x10,%esp
+}
+  8020e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020e9:	5b                   	pop    %ebx
+  8020ea:	5e                   	pop    %esi
+  8020eb:	5d                   	pop    %ebp
+  8020ec:	c3                   	ret
+		return -E_NOT_SUPP;
+  8020ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020f2:	eb f2                	jmp    8020e6 <fstat+0x71>
+
+008020f4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	56                   	push   %esi
+  8020f8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  8020fc:	6a 00                	push   $0x0
+  8020fe:	ff 75 08             	push   0x8(%ebp)
+  802101:	e8 b7 01 00 00       	call   8022bd <open>
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	83 c4 10             	add    $0x10,%esp
+  80210b:	85 c0                	test   %eax,%eax
+  80210d:	78 1b                	js     80212a <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80210f:	83 ec 08             	sub    $0x8,%esp
+  802112:	ff 75 0c             	push   0xc(%ebp)
+  802115:	50                   	push   %eax
+  802116:	e8 5a ff ff ff       	call   802075 <fstat>
+  80211b:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80211d:	89 1c 24             	mov    %ebx,(%esp)
+  802120:	e8 60 fb ff ff       	call   801c85 <close>
+	return r;
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	89 f3                	mov    %esi,%ebx
+}
+  80212a:	89 d8                	mov    %ebx,%eax
+  80212c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80212f:	5b                   	pop    %ebx
+  802130:	5e                   	pop    %esi
+  802131:	5d                   	pop    %ebp
+  802132:	c3                   	ret
+
+00802133 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802133:	55                   	push   %ebp
+  802134:	89 e5                	mov    %esp,%ebp
+  802136:	56                   	push   %esi
+  802137:	53                   	push   %ebx
+  802138:	89 c6                	mov    %eax,%esi
+  80213a:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80213c:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802143:	74 27                	je     80216c <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802145:	6a 07                	push   $0x7
+  802147:	68 00 70 80 00       	push   $0x807000
+  80214c:	56                   	push   %esi
+  80214d:	ff 35 00 60 80 00    	push   0x806000
+  802153:	e8 c9 f8 ff ff       	call   801a21 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802158:	83 c4 0c             	add    $0xc,%esp
+  80215b:	6a 00                	push   $0x0
+  80215d:	53                   	push   %ebx
+  80215e:	6a 00                	push   $0x0
+  802160:	e8 2c f6 ff ff       	call   801791 <ipc_recv>
+}
+  802165:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802168:	5b                   	pop    %ebx
+  802169:	5e                   	pop    %esi
+  80216a:	5d                   	pop    %ebp
+  80216b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80216c:	83 ec 0c             	sub    $0xc,%esp
+  80216f:	6a 02                	push   $0x2
+  802171:	e8 14 f9 ff ff       	call   801a8a <ipc_find_env>
+  802176:	a3 00 60 80 00       	mov    %eax,0x806000
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	eb c5                	jmp    802145 <fsipc+0x12>
+
+00802180 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802186:	8b 45 08             	mov    0x8(%ebp),%eax
+  802189:	8b 40 0c             	mov    0xc(%eax),%eax
+  80218c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802194:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219e:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021a3:	e8 8b ff ff ff       	call   802133 <fsipc>
+}
+  8021a8:	c9                   	leave
+  8021a9:	c3                   	ret
+
+008021aa <devfile_flush>:
+{
+  8021aa:	55                   	push   %ebp
+  8021ab:	89 e5                	mov    %esp,%ebp
+  8021ad:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021b6:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8021bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021c5:	e8 69 ff ff ff       	call   802133 <fsipc>
+}
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+008021cc <devfile_stat>:
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	53                   	push   %ebx
+  8021d0:	83 ec 04             	sub    $0x4,%esp
+  8021d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021dc:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021eb:	e8 43 ff ff ff       	call   802133 <fsipc>
+  8021f0:	85 c0                	test   %eax,%eax
+  8021f2:	78 37                	js     80222b <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021f4:	83 ec 08             	sub    $0x8,%esp
+  8021f7:	68 00 70 80 00       	push   $0x807000
+  8021fc:	53                   	push   %ebx
+  8021fd:	e8 f8 ec ff ff       	call   800efa <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802202:	a1 80 70 80 00       	mov    0x807080,%eax
+  802207:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80220d:	a1 84 70 80 00       	mov    0x807084,%eax
+  802212:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802218:	a1 88 70 80 00       	mov    0x807088,%eax
+  80221d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802223:	83 c4 10             	add    $0x10,%esp
+  802226:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+00802230 <devfile_write>:
+{
+  802230:	55                   	push   %ebp
+  802231:	89 e5                	mov    %esp,%ebp
+  802233:	83 ec 0c             	sub    $0xc,%esp
+  802236:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802239:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80223e:	39 d0                	cmp    %edx,%eax
+  802240:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802243:	8b 55 08             	mov    0x8(%ebp),%edx
+  802246:	8b 52 0c             	mov    0xc(%edx),%edx
+  802249:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80224f:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802254:	50                   	push   %eax
+  802255:	ff 75 0c             	push   0xc(%ebp)
+  802258:	68 08 70 80 00       	push   $0x807008
+  80225d:	e8 48 ee ff ff       	call   8010aa <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802262:	ba 00 00 00 00       	mov    $0x0,%edx
+  802267:	b8 04 00 00 00       	mov    $0x4,%eax
+  80226c:	e8 c2 fe ff ff       	call   802133 <fsipc>
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+00802273 <devfile_read>:
+{
+  802273:	55                   	push   %ebp
+  802274:	89 e5                	mov    %esp,%ebp
+  802276:	53                   	push   %ebx
+  802277:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80227a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802280:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802285:	8b 45 10             	mov    0x10(%ebp),%eax
+  802288:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80228d:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802292:	b8 03 00 00 00       	mov    $0x3,%eax
+  802297:	e8 97 fe ff ff       	call   802133 <fsipc>
+  80229c:	89 c3                	mov    %eax,%ebx
+  80229e:	85 c0                	test   %eax,%eax
+  8022a0:	78 14                	js     8022b6 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	50                   	push   %eax
+  8022a6:	68 00 70 80 00       	push   $0x807000
+  8022ab:	ff 75 0c             	push   0xc(%ebp)
+  8022ae:	e8 f7 ed ff ff       	call   8010aa <memmove>
+	return r;
+  8022b3:	83 c4 10             	add    $0x10,%esp
+}
+  8022b6:	89 d8                	mov    %ebx,%eax
+  8022b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022bb:	c9                   	leave
+  8022bc:	c3                   	ret
+
+008022bd <open>:
+{
+  8022bd:	55                   	push   %ebp
+  8022be:	89 e5                	mov    %esp,%ebp
+  8022c0:	53                   	push   %ebx
+  8022c1:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8022c4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022c7:	50                   	push   %eax
+  8022c8:	e8 23 f8 ff ff       	call   801af0 <fd_alloc>
+  8022cd:	89 c3                	mov    %eax,%ebx
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 2a                	js     802300 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8022d6:	83 ec 0c             	sub    $0xc,%esp
+  8022d9:	ff 75 08             	push   0x8(%ebp)
+  8022dc:	e8 cd eb ff ff       	call   800eae <strlen>
+  8022e1:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8022e4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8022e9:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8022ee:	7e 17                	jle    802307 <open+0x4a>
+	fd_close(fd, 1);
+  8022f0:	83 ec 08             	sub    $0x8,%esp
+  8022f3:	6a 01                	push   $0x1
+  8022f5:	ff 75 f4             	push   -0xc(%ebp)
+  8022f8:	e8 08 f9 ff ff       	call   801c05 <fd_close>
+	return r;
+  8022fd:	83 c4 10             	add    $0x10,%esp
+}
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802307:	83 ec 08             	sub    $0x8,%esp
+  80230a:	ff 75 08             	push   0x8(%ebp)
+  80230d:	68 00 70 80 00       	push   $0x807000
+  802312:	e8 e3 eb ff ff       	call   800efa <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802317:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231a:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80231f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802322:	b8 01 00 00 00       	mov    $0x1,%eax
+  802327:	e8 07 fe ff ff       	call   802133 <fsipc>
+  80232c:	89 c3                	mov    %eax,%ebx
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	85 c0                	test   %eax,%eax
+  802333:	78 bb                	js     8022f0 <open+0x33>
+	return fd2num(fd); 	
+  802335:	83 ec 0c             	sub    $0xc,%esp
+  802338:	ff 75 f4             	push   -0xc(%ebp)
+  80233b:	e8 89 f7 ff ff       	call   801ac9 <fd2num>
+  802340:	89 c3                	mov    %eax,%ebx
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	eb b9                	jmp    802300 <open+0x43>
+
+00802347 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802347:	55                   	push   %ebp
+  802348:	89 e5                	mov    %esp,%ebp
+  80234a:	53                   	push   %ebx
+  80234b:	83 ec 1c             	sub    $0x1c,%esp
+  80234e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802351:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802354:	50                   	push   %eax
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 e3 f7 ff ff       	call   801b40 <fd_lookup>
+  80235d:	83 c4 10             	add    $0x10,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 5a                	js     8023be <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802364:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802367:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80236d:	39 10                	cmp    %edx,(%eax)
+  80236f:	75 66                	jne    8023d7 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802371:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  802378:	74 49                	je     8023c3 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80237a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80237d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802380:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802385:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802388:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80238d:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802393:	6a 07                	push   $0x7
+  802395:	68 00 70 80 00       	push   $0x807000
+  80239a:	6a 09                	push   $0x9
+  80239c:	ff 35 00 60 80 00    	push   0x806000
+  8023a2:	e8 7a f6 ff ff       	call   801a21 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8023a7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8023ae:	6a 00                	push   $0x0
+  8023b0:	53                   	push   %ebx
+  8023b1:	ff 75 10             	push   0x10(%ebp)
+  8023b4:	6a 00                	push   $0x0
+  8023b6:	e8 a3 f4 ff ff       	call   80185e <ipc_recv_pages>
+  8023bb:	83 c4 20             	add    $0x20,%esp
+}
+  8023be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c1:	c9                   	leave
+  8023c2:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023c3:	83 ec 0c             	sub    $0xc,%esp
+  8023c6:	6a 02                	push   $0x2
+  8023c8:	e8 bd f6 ff ff       	call   801a8a <ipc_find_env>
+  8023cd:	a3 00 60 80 00       	mov    %eax,0x806000
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	eb a3                	jmp    80237a <fmap+0x33>
+		return -E_INVAL;
+  8023d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023dc:	eb e0                	jmp    8023be <fmap+0x77>
+
+008023de <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8023de:	55                   	push   %ebp
+  8023df:	89 e5                	mov    %esp,%ebp
+  8023e1:	53                   	push   %ebx
+  8023e2:	83 ec 10             	sub    $0x10,%esp
+  8023e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8023e8:	53                   	push   %ebx
+  8023e9:	e8 c0 ea ff ff       	call   800eae <strlen>
+  8023ee:	83 c4 10             	add    $0x10,%esp
+  8023f1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023f6:	7f 25                	jg     80241d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8023f8:	83 ec 08             	sub    $0x8,%esp
+  8023fb:	53                   	push   %ebx
+  8023fc:	68 00 70 80 00       	push   $0x807000
+  802401:	e8 f4 ea ff ff       	call   800efa <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802406:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802410:	e8 1e fd ff ff       	call   802133 <fsipc>
+  802415:	83 c4 10             	add    $0x10,%esp
+}
+  802418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80241b:	c9                   	leave
+  80241c:	c3                   	ret
+		return -E_BAD_PATH;
+  80241d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802422:	eb f4                	jmp    802418 <remove+0x3a>
+
+00802424 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802434:	e8 fa fc ff ff       	call   802133 <fsipc>
+}
+  802439:	c9                   	leave
+  80243a:	c3                   	ret
+
+0080243b <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80243b:	55                   	push   %ebp
+  80243c:	89 e5                	mov    %esp,%ebp
+  80243e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802441:	68 e0 48 80 00       	push   $0x8048e0
+  802446:	ff 75 0c             	push   0xc(%ebp)
+  802449:	e8 ac ea ff ff       	call   800efa <strcpy>
+	return 0;
+}
+  80244e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802453:	c9                   	leave
+  802454:	c3                   	ret
+
+00802455 <devsock_close>:
+{
+  802455:	55                   	push   %ebp
+  802456:	89 e5                	mov    %esp,%ebp
+  802458:	53                   	push   %ebx
+  802459:	83 ec 10             	sub    $0x10,%esp
+  80245c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80245f:	53                   	push   %ebx
+  802460:	e8 3c 1a 00 00       	call   803ea1 <pageref>
+  802465:	89 c2                	mov    %eax,%edx
+  802467:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80246a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80246f:	83 fa 01             	cmp    $0x1,%edx
+  802472:	74 05                	je     802479 <devsock_close+0x24>
+}
+  802474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802479:	83 ec 0c             	sub    $0xc,%esp
+  80247c:	ff 73 0c             	push   0xc(%ebx)
+  80247f:	e8 b0 05 00 00       	call   802a34 <nsipc_close>
+  802484:	83 c4 10             	add    $0x10,%esp
+  802487:	eb eb                	jmp    802474 <devsock_close+0x1f>
+
+00802489 <devsock_write>:
+{
+  802489:	55                   	push   %ebp
+  80248a:	89 e5                	mov    %esp,%ebp
+  80248c:	53                   	push   %ebx
+  80248d:	83 ec 14             	sub    $0x14,%esp
+  802490:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802493:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802496:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802499:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80249c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80249f:	8b 41 08             	mov    0x8(%ecx),%eax
+  8024a2:	c1 f8 09             	sar    $0x9,%eax
+  8024a5:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8024a8:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8024ae:	77 13                	ja     8024c3 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8024b0:	50                   	push   %eax
+  8024b1:	52                   	push   %edx
+  8024b2:	53                   	push   %ebx
+  8024b3:	ff 71 0c             	push   0xc(%ecx)
+  8024b6:	e8 5c 06 00 00       	call   802b17 <nsipc_send>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+}
+  8024be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c1:	c9                   	leave
+  8024c2:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8024c3:	50                   	push   %eax
+  8024c4:	6a 01                	push   $0x1
+  8024c6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024c9:	50                   	push   %eax
+  8024ca:	ff 71 0c             	push   0xc(%ecx)
+  8024cd:	e8 a6 06 00 00       	call   802b78 <nsipc_sendmsg>
+  8024d2:	83 c4 10             	add    $0x10,%esp
+  8024d5:	eb e7                	jmp    8024be <devsock_write+0x35>
+
+008024d7 <devsock_read>:
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 14             	sub    $0x14,%esp
+  8024de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8024e4:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8024e7:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8024ea:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8024ed:	8b 41 08             	mov    0x8(%ecx),%eax
+  8024f0:	c1 f8 09             	sar    $0x9,%eax
+  8024f3:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8024f6:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8024fc:	77 13                	ja     802511 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8024fe:	50                   	push   %eax
+  8024ff:	52                   	push   %edx
+  802500:	53                   	push   %ebx
+  802501:	ff 71 0c             	push   0xc(%ecx)
+  802504:	e8 9c 05 00 00       	call   802aa5 <nsipc_recv>
+  802509:	83 c4 10             	add    $0x10,%esp
+}
+  80250c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802511:	50                   	push   %eax
+  802512:	6a 01                	push   $0x1
+  802514:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802517:	50                   	push   %eax
+  802518:	ff 71 0c             	push   0xc(%ecx)
+  80251b:	e8 02 0a 00 00       	call   802f22 <nsipc_recvmsg>
+  802520:	83 c4 10             	add    $0x10,%esp
+  802523:	eb e7                	jmp    80250c <devsock_read+0x35>
+
+00802525 <fd2sockid>:
+{
+  802525:	55                   	push   %ebp
+  802526:	89 e5                	mov    %esp,%ebp
+  802528:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80252b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80252e:	52                   	push   %edx
+  80252f:	50                   	push   %eax
+  802530:	e8 0b f6 ff ff       	call   801b40 <fd_lookup>
+  802535:	83 c4 10             	add    $0x10,%esp
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 10                	js     80254c <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80253c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253f:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802545:	39 08                	cmp    %ecx,(%eax)
+  802547:	75 05                	jne    80254e <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802549:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80254c:	c9                   	leave
+  80254d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80254e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802553:	eb f7                	jmp    80254c <fd2sockid+0x27>
+
+00802555 <sock_flags>:
+{
+  802555:	55                   	push   %ebp
+  802556:	89 e5                	mov    %esp,%ebp
+  802558:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80255b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80255e:	52                   	push   %edx
+  80255f:	50                   	push   %eax
+  802560:	e8 db f5 ff ff       	call   801b40 <fd_lookup>
+  802565:	83 c4 10             	add    $0x10,%esp
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	78 0e                	js     80257a <sock_flags+0x25>
+  80256c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80256f:	8b 40 08             	mov    0x8(%eax),%eax
+  802572:	c1 e8 09             	shr    $0x9,%eax
+  802575:	83 e0 08             	and    $0x8,%eax
+}
+  802578:	c9                   	leave
+  802579:	c3                   	ret
+		return 0;
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	eb f7                	jmp    802578 <sock_flags+0x23>
+
+00802581 <alloc_sockfd>:
+{
+  802581:	55                   	push   %ebp
+  802582:	89 e5                	mov    %esp,%ebp
+  802584:	56                   	push   %esi
+  802585:	53                   	push   %ebx
+  802586:	83 ec 1c             	sub    $0x1c,%esp
+  802589:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80258b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80258e:	50                   	push   %eax
+  80258f:	e8 5c f5 ff ff       	call   801af0 <fd_alloc>
+  802594:	89 c3                	mov    %eax,%ebx
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	78 43                	js     8025e0 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80259d:	83 ec 04             	sub    $0x4,%esp
+  8025a0:	68 07 04 00 00       	push   $0x407
+  8025a5:	ff 75 f4             	push   -0xc(%ebp)
+  8025a8:	6a 00                	push   $0x0
+  8025aa:	e8 7f ed ff ff       	call   80132e <sys_page_alloc>
+  8025af:	89 c3                	mov    %eax,%ebx
+  8025b1:	83 c4 10             	add    $0x10,%esp
+  8025b4:	85 c0                	test   %eax,%eax
+  8025b6:	78 28                	js     8025e0 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8025b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025bb:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8025c1:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8025c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8025cd:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8025d0:	83 ec 0c             	sub    $0xc,%esp
+  8025d3:	50                   	push   %eax
+  8025d4:	e8 f0 f4 ff ff       	call   801ac9 <fd2num>
+  8025d9:	89 c3                	mov    %eax,%ebx
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	eb 0c                	jmp    8025ec <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8025e0:	83 ec 0c             	sub    $0xc,%esp
+  8025e3:	56                   	push   %esi
+  8025e4:	e8 4b 04 00 00       	call   802a34 <nsipc_close>
+		return r;
+  8025e9:	83 c4 10             	add    $0x10,%esp
+}
+  8025ec:	89 d8                	mov    %ebx,%eax
+  8025ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f1:	5b                   	pop    %ebx
+  8025f2:	5e                   	pop    %esi
+  8025f3:	5d                   	pop    %ebp
+  8025f4:	c3                   	ret
+
+008025f5 <accept>:
+{
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	56                   	push   %esi
+  8025f9:	53                   	push   %ebx
+  8025fa:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8025fd:	89 f0                	mov    %esi,%eax
+  8025ff:	e8 21 ff ff ff       	call   802525 <fd2sockid>
+  802604:	89 c3                	mov    %eax,%ebx
+  802606:	85 c0                	test   %eax,%eax
+  802608:	78 24                	js     80262e <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80260a:	89 f0                	mov    %esi,%eax
+  80260c:	e8 44 ff ff ff       	call   802555 <sock_flags>
+  802611:	50                   	push   %eax
+  802612:	ff 75 10             	push   0x10(%ebp)
+  802615:	ff 75 0c             	push   0xc(%ebp)
+  802618:	53                   	push   %ebx
+  802619:	e8 6b 03 00 00       	call   802989 <nsipc_accept>
+  80261e:	89 c3                	mov    %eax,%ebx
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	78 07                	js     80262e <accept+0x39>
+	return alloc_sockfd(r);
+  802627:	e8 55 ff ff ff       	call   802581 <alloc_sockfd>
+  80262c:	89 c3                	mov    %eax,%ebx
+}
+  80262e:	89 d8                	mov    %ebx,%eax
+  802630:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802633:	5b                   	pop    %ebx
+  802634:	5e                   	pop    %esi
+  802635:	5d                   	pop    %ebp
+  802636:	c3                   	ret
+
+00802637 <bind>:
+{
+  802637:	55                   	push   %ebp
+  802638:	89 e5                	mov    %esp,%ebp
+  80263a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80263d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802640:	e8 e0 fe ff ff       	call   802525 <fd2sockid>
+  802645:	85 c0                	test   %eax,%eax
+  802647:	78 12                	js     80265b <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802649:	83 ec 04             	sub    $0x4,%esp
+  80264c:	ff 75 10             	push   0x10(%ebp)
+  80264f:	ff 75 0c             	push   0xc(%ebp)
+  802652:	50                   	push   %eax
+  802653:	e8 85 03 00 00       	call   8029dd <nsipc_bind>
+  802658:	83 c4 10             	add    $0x10,%esp
+}
+  80265b:	c9                   	leave
+  80265c:	c3                   	ret
+
+0080265d <shutdown>:
+{
+  80265d:	55                   	push   %ebp
+  80265e:	89 e5                	mov    %esp,%ebp
+  802660:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802663:	8b 45 08             	mov    0x8(%ebp),%eax
+  802666:	e8 ba fe ff ff       	call   802525 <fd2sockid>
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	78 0f                	js     80267e <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80266f:	83 ec 08             	sub    $0x8,%esp
+  802672:	ff 75 0c             	push   0xc(%ebp)
+  802675:	50                   	push   %eax
+  802676:	e8 97 03 00 00       	call   802a12 <nsipc_shutdown>
+  80267b:	83 c4 10             	add    $0x10,%esp
+}
+  80267e:	c9                   	leave
+  80267f:	c3                   	ret
+
+00802680 <connect>:
+{
+  802680:	55                   	push   %ebp
+  802681:	89 e5                	mov    %esp,%ebp
+  802683:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802686:	8b 45 08             	mov    0x8(%ebp),%eax
+  802689:	e8 97 fe ff ff       	call   802525 <fd2sockid>
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	78 12                	js     8026a4 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802692:	83 ec 04             	sub    $0x4,%esp
+  802695:	ff 75 10             	push   0x10(%ebp)
+  802698:	ff 75 0c             	push   0xc(%ebp)
+  80269b:	50                   	push   %eax
+  80269c:	e8 ad 03 00 00       	call   802a4e <nsipc_connect>
+  8026a1:	83 c4 10             	add    $0x10,%esp
+}
+  8026a4:	c9                   	leave
+  8026a5:	c3                   	ret
+
+008026a6 <listen>:
+{
+  8026a6:	55                   	push   %ebp
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8026ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026af:	e8 71 fe ff ff       	call   802525 <fd2sockid>
+  8026b4:	85 c0                	test   %eax,%eax
+  8026b6:	78 0f                	js     8026c7 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8026b8:	83 ec 08             	sub    $0x8,%esp
+  8026bb:	ff 75 0c             	push   0xc(%ebp)
+  8026be:	50                   	push   %eax
+  8026bf:	e8 bf 03 00 00       	call   802a83 <nsipc_listen>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+}
+  8026c7:	c9                   	leave
+  8026c8:	c3                   	ret
+
+008026c9 <sendmsg>:
+{
+  8026c9:	55                   	push   %ebp
+  8026ca:	89 e5                	mov    %esp,%ebp
+  8026cc:	57                   	push   %edi
+  8026cd:	56                   	push   %esi
+  8026ce:	53                   	push   %ebx
+  8026cf:	83 ec 0c             	sub    $0xc,%esp
+  8026d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8026d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8026d8:	89 f0                	mov    %esi,%eax
+  8026da:	e8 46 fe ff ff       	call   802525 <fd2sockid>
+  8026df:	89 c3                	mov    %eax,%ebx
+  8026e1:	85 c0                	test   %eax,%eax
+  8026e3:	78 1c                	js     802701 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8026e5:	89 f0                	mov    %esi,%eax
+  8026e7:	e8 69 fe ff ff       	call   802555 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8026ec:	0b 45 10             	or     0x10(%ebp),%eax
+  8026ef:	50                   	push   %eax
+  8026f0:	ff 77 0c             	push   0xc(%edi)
+  8026f3:	ff 77 08             	push   0x8(%edi)
+  8026f6:	53                   	push   %ebx
+  8026f7:	e8 7c 04 00 00       	call   802b78 <nsipc_sendmsg>
+  8026fc:	89 c3                	mov    %eax,%ebx
+  8026fe:	83 c4 10             	add    $0x10,%esp
+}
+  802701:	89 d8                	mov    %ebx,%eax
+  802703:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802706:	5b                   	pop    %ebx
+  802707:	5e                   	pop    %esi
+  802708:	5f                   	pop    %edi
+  802709:	5d                   	pop    %ebp
+  80270a:	c3                   	ret
+
+0080270b <recvmsg>:
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	57                   	push   %edi
+  80270f:	56                   	push   %esi
+  802710:	53                   	push   %ebx
+  802711:	83 ec 0c             	sub    $0xc,%esp
+  802714:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802717:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80271a:	89 f8                	mov    %edi,%eax
+  80271c:	e8 04 fe ff ff       	call   802525 <fd2sockid>
+  802721:	89 c3                	mov    %eax,%ebx
+  802723:	85 c0                	test   %eax,%eax
+  802725:	78 2a                	js     802751 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802727:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80272e:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802735:	89 f8                	mov    %edi,%eax
+  802737:	e8 19 fe ff ff       	call   802555 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80273c:	0b 45 10             	or     0x10(%ebp),%eax
+  80273f:	50                   	push   %eax
+  802740:	ff 76 0c             	push   0xc(%esi)
+  802743:	ff 76 08             	push   0x8(%esi)
+  802746:	53                   	push   %ebx
+  802747:	e8 d6 07 00 00       	call   802f22 <nsipc_recvmsg>
+  80274c:	89 c3                	mov    %eax,%ebx
+  80274e:	83 c4 10             	add    $0x10,%esp
+}
+  802751:	89 d8                	mov    %ebx,%eax
+  802753:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802756:	5b                   	pop    %ebx
+  802757:	5e                   	pop    %esi
+  802758:	5f                   	pop    %edi
+  802759:	5d                   	pop    %ebp
+  80275a:	c3                   	ret
+
+0080275b <sendfile>:
+{
+  80275b:	55                   	push   %ebp
+  80275c:	89 e5                	mov    %esp,%ebp
+  80275e:	56                   	push   %esi
+  80275f:	53                   	push   %ebx
+  802760:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802763:	89 f0                	mov    %esi,%eax
+  802765:	e8 bb fd ff ff       	call   802525 <fd2sockid>
+  80276a:	89 c3                	mov    %eax,%ebx
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	78 1f                	js     80278f <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802770:	89 f0                	mov    %esi,%eax
+  802772:	e8 de fd ff ff       	call   802555 <sock_flags>
+  802777:	83 ec 0c             	sub    $0xc,%esp
+  80277a:	50                   	push   %eax
+  80277b:	ff 75 14             	push   0x14(%ebp)
+  80277e:	ff 75 10             	push   0x10(%ebp)
+  802781:	ff 75 0c             	push   0xc(%ebp)
+  802784:	53                   	push   %ebx
+  802785:	e8 64 06 00 00       	call   802dee <nsipc_sendfile>
+  80278a:	89 c3                	mov    %eax,%ebx
+  80278c:	83 c4 20             	add    $0x20,%esp
+}
+  80278f:	89 d8                	mov    %ebx,%eax
+  802791:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802794:	5b                   	pop    %ebx
+  802795:	5e                   	pop    %esi
+  802796:	5d                   	pop    %ebp
+  802797:	c3                   	ret
+
+00802798 <evctl>:
+{
+  802798:	55                   	push   %ebp
+  802799:	89 e5                	mov    %esp,%ebp
+  80279b:	53                   	push   %ebx
+  80279c:	83 ec 04             	sub    $0x4,%esp
+  80279f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8027a2:	89 d8                	mov    %ebx,%eax
+  8027a4:	e8 7c fd ff ff       	call   802525 <fd2sockid>
+  8027a9:	85 c0                	test   %eax,%eax
+  8027ab:	78 10                	js     8027bd <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8027ad:	83 ec 04             	sub    $0x4,%esp
+  8027b0:	53                   	push   %ebx
+  8027b1:	ff 75 0c             	push   0xc(%ebp)
+  8027b4:	50                   	push   %eax
+  8027b5:	e8 d2 0b 00 00       	call   80338c <nsipc_evctl>
+  8027ba:	83 c4 10             	add    $0x10,%esp
+}
+  8027bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <evwait>:
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8027c8:	ff 75 10             	push   0x10(%ebp)
+  8027cb:	ff 75 0c             	push   0xc(%ebp)
+  8027ce:	ff 75 08             	push   0x8(%ebp)
+  8027d1:	e8 e0 0b 00 00       	call   8033b6 <nsipc_evwait>
+}
+  8027d6:	c9                   	leave
+  8027d7:	c3                   	ret
+
+008027d8 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8027d8:	55                   	push   %ebp
+  8027d9:	89 e5                	mov    %esp,%ebp
+  8027db:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8027de:	ff 75 10             	push   0x10(%ebp)
+  8027e1:	ff 75 0c             	push   0xc(%ebp)
+  8027e4:	ff 75 08             	push   0x8(%ebp)
+  8027e7:	e8 31 0c 00 00       	call   80341d <nsipc_socket>
+  8027ec:	83 c4 10             	add    $0x10,%esp
+  8027ef:	85 c0                	test   %eax,%eax
+  8027f1:	78 05                	js     8027f8 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8027f3:	e8 89 fd ff ff       	call   802581 <alloc_sockfd>
+}
+  8027f8:	c9                   	leave
+  8027f9:	c3                   	ret
+
+008027fa <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8027fa:	55                   	push   %ebp
+  8027fb:	89 e5                	mov    %esp,%ebp
+  8027fd:	53                   	push   %ebx
+  8027fe:	83 ec 04             	sub    $0x4,%esp
+  802801:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802803:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80280a:	74 26                	je     802832 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80280c:	6a 07                	push   $0x7
+  80280e:	68 00 80 80 00       	push   $0x808000
+  802813:	53                   	push   %ebx
+  802814:	ff 35 24 63 80 00    	push   0x806324
+  80281a:	e8 02 f2 ff ff       	call   801a21 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80281f:	83 c4 0c             	add    $0xc,%esp
+  802822:	6a 00                	push   $0x0
+  802824:	6a 00                	push   $0x0
+  802826:	6a 00                	push   $0x0
+  802828:	e8 64 ef ff ff       	call   801791 <ipc_recv>
+}
+  80282d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802830:	c9                   	leave
+  802831:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802832:	83 ec 0c             	sub    $0xc,%esp
+  802835:	6a 03                	push   $0x3
+  802837:	e8 4e f2 ff ff       	call   801a8a <ipc_find_env>
+  80283c:	a3 24 63 80 00       	mov    %eax,0x806324
+  802841:	83 c4 10             	add    $0x10,%esp
+  802844:	eb c6                	jmp    80280c <nsipc+0x12>
+
+00802846 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	56                   	push   %esi
+  80284a:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80284b:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802851:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802856:	85 f6                	test   %esi,%esi
+  802858:	75 33                	jne    80288d <nsbulk_map+0x47>
+  80285a:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80285f:	83 ec 04             	sub    $0x4,%esp
+  802862:	6a 07                	push   $0x7
+  802864:	53                   	push   %ebx
+  802865:	6a 00                	push   $0x0
+  802867:	e8 c2 ea ff ff       	call   80132e <sys_page_alloc>
+  80286c:	83 c4 10             	add    $0x10,%esp
+  80286f:	85 c0                	test   %eax,%eax
+  802871:	78 1a                	js     80288d <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802873:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802879:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80287f:	75 de                	jne    80285f <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802881:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  802888:	00 00 00 
+	return 0;
+  80288b:	89 f0                	mov    %esi,%eax
+}
+  80288d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802890:	5b                   	pop    %ebx
+  802891:	5e                   	pop    %esi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+
+00802894 <nsbulk_own>:
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	57                   	push   %edi
+  802898:	56                   	push   %esi
+  802899:	53                   	push   %ebx
+  80289a:	83 ec 0c             	sub    $0xc,%esp
+  80289d:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80289f:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8028a2:	85 d2                	test   %edx,%edx
+  8028a4:	7f 0e                	jg     8028b4 <nsbulk_own+0x20>
+	return 0;
+  8028a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ab:	eb 47                	jmp    8028f4 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8028ad:	83 c3 01             	add    $0x1,%ebx
+  8028b0:	39 fb                	cmp    %edi,%ebx
+  8028b2:	7d 3b                	jge    8028ef <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8028b4:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b9:	89 d9                	mov    %ebx,%ecx
+  8028bb:	d3 e6                	shl    %cl,%esi
+  8028bd:	89 f0                	mov    %esi,%eax
+  8028bf:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8028c5:	74 e6                	je     8028ad <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8028c7:	83 ec 04             	sub    $0x4,%esp
+  8028ca:	6a 07                	push   $0x7
+  8028cc:	89 d8                	mov    %ebx,%eax
+  8028ce:	c1 e0 0c             	shl    $0xc,%eax
+  8028d1:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8028d6:	50                   	push   %eax
+  8028d7:	6a 00                	push   $0x0
+  8028d9:	e8 50 ea ff ff       	call   80132e <sys_page_alloc>
+  8028de:	83 c4 10             	add    $0x10,%esp
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	78 0f                	js     8028f4 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8028e5:	f7 d6                	not    %esi
+  8028e7:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  8028ed:	eb be                	jmp    8028ad <nsbulk_own+0x19>
+	return 0;
+  8028ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f7:	5b                   	pop    %ebx
+  8028f8:	5e                   	pop    %esi
+  8028f9:	5f                   	pop    %edi
+  8028fa:	5d                   	pop    %ebp
+  8028fb:	c3                   	ret
+
+008028fc <nsipc_bulk>:
+{
+  8028fc:	55                   	push   %ebp
+  8028fd:	89 e5                	mov    %esp,%ebp
+  8028ff:	57                   	push   %edi
+  802900:	56                   	push   %esi
+  802901:	53                   	push   %ebx
+  802902:	83 ec 1c             	sub    $0x1c,%esp
+  802905:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802908:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80290a:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802910:	c1 fb 0c             	sar    $0xc,%ebx
+  802913:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802916:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80291d:	74 56                	je     802975 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80291f:	85 ff                	test   %edi,%edi
+  802921:	7e 24                	jle    802947 <nsipc_bulk+0x4b>
+  802923:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802929:	74 1c                	je     802947 <nsipc_bulk+0x4b>
+  80292b:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802931:	c1 e3 0c             	shl    $0xc,%ebx
+  802934:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802939:	0f b6 10             	movzbl (%eax),%edx
+  80293c:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80293e:	05 00 10 00 00       	add    $0x1000,%eax
+  802943:	39 d8                	cmp    %ebx,%eax
+  802945:	75 f2                	jne    802939 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802947:	83 ec 0c             	sub    $0xc,%esp
+  80294a:	56                   	push   %esi
+  80294b:	57                   	push   %edi
+  80294c:	68 00 00 00 e0       	push   $0xe0000000
+  802951:	ff 75 e4             	push   -0x1c(%ebp)
+  802954:	ff 35 24 63 80 00    	push   0x806324
+  80295a:	e8 f6 f0 ff ff       	call   801a55 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80295f:	83 c4 1c             	add    $0x1c,%esp
+  802962:	6a 00                	push   $0x0
+  802964:	6a 00                	push   $0x0
+  802966:	6a 00                	push   $0x0
+  802968:	e8 24 ee ff ff       	call   801791 <ipc_recv>
+}
+  80296d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802970:	5b                   	pop    %ebx
+  802971:	5e                   	pop    %esi
+  802972:	5f                   	pop    %edi
+  802973:	5d                   	pop    %ebp
+  802974:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802975:	83 ec 0c             	sub    $0xc,%esp
+  802978:	6a 03                	push   $0x3
+  80297a:	e8 0b f1 ff ff       	call   801a8a <ipc_find_env>
+  80297f:	a3 24 63 80 00       	mov    %eax,0x806324
+  802984:	83 c4 10             	add    $0x10,%esp
+  802987:	eb 96                	jmp    80291f <nsipc_bulk+0x23>
+
+00802989 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	53                   	push   %ebx
+  80298d:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802990:	8b 45 08             	mov    0x8(%ebp),%eax
+  802993:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80299b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8029a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029a5:	e8 50 fe ff ff       	call   8027fa <nsipc>
+  8029aa:	89 c3                	mov    %eax,%ebx
+  8029ac:	85 c0                	test   %eax,%eax
+  8029ae:	79 07                	jns    8029b7 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8029b0:	89 d8                	mov    %ebx,%eax
+  8029b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b5:	c9                   	leave
+  8029b6:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8029b7:	83 ec 04             	sub    $0x4,%esp
+  8029ba:	ff 35 10 80 80 00    	push   0x808010
+  8029c0:	68 00 80 80 00       	push   $0x808000
+  8029c5:	ff 75 0c             	push   0xc(%ebp)
+  8029c8:	e8 dd e6 ff ff       	call   8010aa <memmove>
+		*addrlen = ret->ret_addrlen;
+  8029cd:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8029d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029d6:	89 10                	mov    %edx,(%eax)
+  8029d8:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8029db:	eb d3                	jmp    8029b0 <nsipc_accept+0x27>
+
+008029dd <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8029dd:	55                   	push   %ebp
+  8029de:	89 e5                	mov    %esp,%ebp
+  8029e0:	53                   	push   %ebx
+  8029e1:	83 ec 08             	sub    $0x8,%esp
+  8029e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8029e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ea:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8029ef:	53                   	push   %ebx
+  8029f0:	ff 75 0c             	push   0xc(%ebp)
+  8029f3:	68 04 80 80 00       	push   $0x808004
+  8029f8:	e8 ad e6 ff ff       	call   8010aa <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8029fd:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802a03:	b8 02 00 00 00       	mov    $0x2,%eax
+  802a08:	e8 ed fd ff ff       	call   8027fa <nsipc>
+}
+  802a0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a10:	c9                   	leave
+  802a11:	c3                   	ret
+
+00802a12 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802a12:	55                   	push   %ebp
+  802a13:	89 e5                	mov    %esp,%ebp
+  802a15:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802a20:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a23:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802a28:	b8 03 00 00 00       	mov    $0x3,%eax
+  802a2d:	e8 c8 fd ff ff       	call   8027fa <nsipc>
+}
+  802a32:	c9                   	leave
+  802a33:	c3                   	ret
+
+00802a34 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802a34:	55                   	push   %ebp
+  802a35:	89 e5                	mov    %esp,%ebp
+  802a37:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a3d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802a42:	b8 04 00 00 00       	mov    $0x4,%eax
+  802a47:	e8 ae fd ff ff       	call   8027fa <nsipc>
+}
+  802a4c:	c9                   	leave
+  802a4d:	c3                   	ret
+
+00802a4e <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	53                   	push   %ebx
+  802a52:	83 ec 08             	sub    $0x8,%esp
+  802a55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802a58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a5b:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802a60:	53                   	push   %ebx
+  802a61:	ff 75 0c             	push   0xc(%ebp)
+  802a64:	68 04 80 80 00       	push   $0x808004
+  802a69:	e8 3c e6 ff ff       	call   8010aa <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a6e:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a74:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a79:	e8 7c fd ff ff       	call   8027fa <nsipc>
+}
+  802a7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a81:	c9                   	leave
+  802a82:	c3                   	ret
+
+00802a83 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a94:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a99:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a9e:	e8 57 fd ff ff       	call   8027fa <nsipc>
+}
+  802aa3:	c9                   	leave
+  802aa4:	c3                   	ret
+
+00802aa5 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802aa5:	55                   	push   %ebp
+  802aa6:	89 e5                	mov    %esp,%ebp
+  802aa8:	56                   	push   %esi
+  802aa9:	53                   	push   %ebx
+  802aaa:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802aad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802ab5:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802abb:	8b 45 14             	mov    0x14(%ebp),%eax
+  802abe:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ac3:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ac8:	e8 2d fd ff ff       	call   8027fa <nsipc>
+  802acd:	89 c3                	mov    %eax,%ebx
+  802acf:	85 c0                	test   %eax,%eax
+  802ad1:	78 22                	js     802af5 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ad3:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ad8:	39 c6                	cmp    %eax,%esi
+  802ada:	0f 4e c6             	cmovle %esi,%eax
+  802add:	39 c3                	cmp    %eax,%ebx
+  802adf:	7f 1d                	jg     802afe <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ae1:	83 ec 04             	sub    $0x4,%esp
+  802ae4:	53                   	push   %ebx
+  802ae5:	68 00 80 80 00       	push   $0x808000
+  802aea:	ff 75 0c             	push   0xc(%ebp)
+  802aed:	e8 b8 e5 ff ff       	call   8010aa <memmove>
+  802af2:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802af5:	89 d8                	mov    %ebx,%eax
+  802af7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802afa:	5b                   	pop    %ebx
+  802afb:	5e                   	pop    %esi
+  802afc:	5d                   	pop    %ebp
+  802afd:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802afe:	68 ec 48 80 00       	push   $0x8048ec
+  802b03:	68 01 49 80 00       	push   $0x804901
+  802b08:	68 b2 00 00 00       	push   $0xb2
+  802b0d:	68 16 49 80 00       	push   $0x804916
+  802b12:	e8 11 dc ff ff       	call   800728 <_panic>
+
+00802b17 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	53                   	push   %ebx
+  802b1b:	83 ec 04             	sub    $0x4,%esp
+  802b1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802b21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b24:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802b29:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802b2f:	7f 2e                	jg     802b5f <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802b31:	83 ec 04             	sub    $0x4,%esp
+  802b34:	53                   	push   %ebx
+  802b35:	ff 75 0c             	push   0xc(%ebp)
+  802b38:	68 0c 80 80 00       	push   $0x80800c
+  802b3d:	e8 68 e5 ff ff       	call   8010aa <memmove>
+	nsipcbuf.send.req_size = size;
+  802b42:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802b48:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b4b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802b50:	b8 08 00 00 00       	mov    $0x8,%eax
+  802b55:	e8 a0 fc ff ff       	call   8027fa <nsipc>
+}
+  802b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5d:	c9                   	leave
+  802b5e:	c3                   	ret
+	assert(size < 1600);
+  802b5f:	68 22 49 80 00       	push   $0x804922
+  802b64:	68 01 49 80 00       	push   $0x804901
+  802b69:	68 bd 00 00 00       	push   $0xbd
+  802b6e:	68 16 49 80 00       	push   $0x804916
+  802b73:	e8 b0 db ff ff       	call   800728 <_panic>
+
+00802b78 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802b78:	55                   	push   %ebp
+  802b79:	89 e5                	mov    %esp,%ebp
+  802b7b:	57                   	push   %edi
+  802b7c:	56                   	push   %esi
+  802b7d:	53                   	push   %ebx
+  802b7e:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802b81:	e8 c0 fc ff ff       	call   802846 <nsbulk_map>
+  802b86:	85 c0                	test   %eax,%eax
+  802b88:	78 55                	js     802bdf <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802b8a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802b91:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802b98:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802b9f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ba2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ba5:	0f 8d 24 02 00 00    	jge    802dcf <nsipc_sendmsg+0x257>
+  802bab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bae:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802bb1:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802bb4:	89 d8                	mov    %ebx,%eax
+  802bb6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802bbb:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802bbd:	83 ec 0c             	sub    $0xc,%esp
+  802bc0:	68 20 60 80 00       	push   $0x806020
+  802bc5:	e8 5a 0f 00 00       	call   803b24 <pgbatch_init>
+  802bca:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802bcd:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802bcf:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802bd2:	e9 82 00 00 00       	jmp    802c59 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802bd7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802bda:	85 db                	test   %ebx,%ebx
+  802bdc:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802bdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be2:	5b                   	pop    %ebx
+  802be3:	5e                   	pop    %esi
+  802be4:	5f                   	pop    %edi
+  802be5:	5d                   	pop    %ebp
+  802be6:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802be7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802bec:	29 c8                	sub    %ecx,%eax
+  802bee:	39 d0                	cmp    %edx,%eax
+  802bf0:	0f 46 d0             	cmovbe %eax,%edx
+  802bf3:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802bf5:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802bfb:	85 ff                	test   %edi,%edi
+  802bfd:	0f 49 c7             	cmovns %edi,%eax
+  802c00:	c1 f8 0c             	sar    $0xc,%eax
+  802c03:	ba 01 00 00 00       	mov    $0x1,%edx
+  802c08:	e8 87 fc ff ff       	call   802894 <nsbulk_own>
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	0f 88 17 01 00 00    	js     802d2c <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802c15:	83 ec 04             	sub    $0x4,%esp
+  802c18:	56                   	push   %esi
+  802c19:	ff 75 e0             	push   -0x20(%ebp)
+  802c1c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802c1f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802c24:	50                   	push   %eax
+  802c25:	e8 80 e4 ff ff       	call   8010aa <memmove>
+  802c2a:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802c2d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802c30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c33:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802c36:	0f 84 fd 00 00 00    	je     802d39 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802c3c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802c3f:	01 f7                	add    %esi,%edi
+  802c41:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c44:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c47:	0f 8d 01 01 00 00    	jge    802d4e <nsipc_sendmsg+0x1d6>
+  802c4d:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802c53:	0f 8f f0 00 00 00    	jg     802d49 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802c59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5c:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802c5f:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802c62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c65:	89 c2                	mov    %eax,%edx
+  802c67:	03 13                	add    (%ebx),%edx
+  802c69:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802c6c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802c6f:	29 c6                	sub    %eax,%esi
+  802c71:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802c76:	29 f9                	sub    %edi,%ecx
+  802c78:	39 ce                	cmp    %ecx,%esi
+  802c7a:	89 ca                	mov    %ecx,%edx
+  802c7c:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802c7f:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802c82:	89 f9                	mov    %edi,%ecx
+  802c84:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802c8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c8d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c92:	09 c8                	or     %ecx,%eax
+  802c94:	0f 85 4d ff ff ff    	jne    802be7 <nsipc_sendmsg+0x6f>
+  802c9a:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802ca0:	0f 86 41 ff ff ff    	jbe    802be7 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ca6:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cac:	85 ff                	test   %edi,%edi
+  802cae:	0f 49 c7             	cmovns %edi,%eax
+  802cb1:	c1 f8 0c             	sar    $0xc,%eax
+  802cb4:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802cb6:	89 d1                	mov    %edx,%ecx
+  802cb8:	c1 e9 0c             	shr    $0xc,%ecx
+  802cbb:	01 c8                	add    %ecx,%eax
+  802cbd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802cc0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802cc3:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802cc5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802cc8:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802ccd:	29 c8                	sub    %ecx,%eax
+  802ccf:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802cd2:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802cd5:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802cd7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cdc:	89 f9                	mov    %edi,%ecx
+  802cde:	d3 e0                	shl    %cl,%eax
+  802ce0:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802ce6:	83 ec 08             	sub    $0x8,%esp
+  802ce9:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802ceb:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802cee:	50                   	push   %eax
+  802cef:	6a 00                	push   $0x0
+  802cf1:	56                   	push   %esi
+  802cf2:	6a 00                	push   $0x0
+  802cf4:	68 20 60 80 00       	push   $0x806020
+  802cf9:	e8 e4 0e 00 00       	call   803be2 <pgbatch_map>
+  802cfe:	83 c4 20             	add    $0x20,%esp
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	0f 88 ce fe ff ff    	js     802bd7 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d09:	83 c7 01             	add    $0x1,%edi
+  802d0c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d12:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d15:	39 c7                	cmp    %eax,%edi
+  802d17:	75 be                	jne    802cd7 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802d19:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802d1c:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802d1f:	89 d6                	mov    %edx,%esi
+  802d21:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802d27:	e9 01 ff ff ff       	jmp    802c2d <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802d2c:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d2f:	85 db                	test   %ebx,%ebx
+  802d31:	0f 45 c3             	cmovne %ebx,%eax
+  802d34:	e9 a6 fe ff ff       	jmp    802bdf <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802d39:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802d3d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d44:	e9 f3 fe ff ff       	jmp    802c3c <nsipc_sendmsg+0xc4>
+  802d49:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802d4c:	eb 03                	jmp    802d51 <nsipc_sendmsg+0x1d9>
+  802d4e:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802d51:	83 ec 0c             	sub    $0xc,%esp
+  802d54:	68 20 60 80 00       	push   $0x806020
+  802d59:	e8 d4 0d 00 00       	call   803b32 <pgbatch_flush>
+  802d5e:	83 c4 10             	add    $0x10,%esp
+  802d61:	85 c0                	test   %eax,%eax
+  802d63:	78 50                	js     802db5 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802d65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d68:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802d6d:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802d73:	89 fb                	mov    %edi,%ebx
+  802d75:	29 f3                	sub    %esi,%ebx
+  802d77:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802d7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d80:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802d85:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802d8a:	89 fa                	mov    %edi,%edx
+  802d8c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802d91:	e8 66 fb ff ff       	call   8028fc <nsipc_bulk>
+  802d96:	85 c0                	test   %eax,%eax
+  802d98:	78 28                	js     802dc2 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802d9a:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802d9d:	39 c3                	cmp    %eax,%ebx
+  802d9f:	75 0c                	jne    802dad <nsipc_sendmsg+0x235>
+  802da1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802da4:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802da7:	0f 8f f2 fd ff ff    	jg     802b9f <nsipc_sendmsg+0x27>
+		sent += r;
+  802dad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802db0:	e9 2a fe ff ff       	jmp    802bdf <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802db5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802db8:	85 db                	test   %ebx,%ebx
+  802dba:	0f 45 c3             	cmovne %ebx,%eax
+  802dbd:	e9 1d fe ff ff       	jmp    802bdf <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802dc2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802dc5:	85 db                	test   %ebx,%ebx
+  802dc7:	0f 45 c3             	cmovne %ebx,%eax
+  802dca:	e9 10 fe ff ff       	jmp    802bdf <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802dcf:	83 ec 0c             	sub    $0xc,%esp
+  802dd2:	68 20 60 80 00       	push   $0x806020
+  802dd7:	e8 48 0d 00 00       	call   803b24 <pgbatch_init>
+  802ddc:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ddf:	be 00 00 00 00       	mov    $0x0,%esi
+  802de4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802de9:	e9 63 ff ff ff       	jmp    802d51 <nsipc_sendmsg+0x1d9>
+
+00802dee <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802dee:	55                   	push   %ebp
+  802def:	89 e5                	mov    %esp,%ebp
+  802df1:	57                   	push   %edi
+  802df2:	56                   	push   %esi
+  802df3:	53                   	push   %ebx
+  802df4:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802df7:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802dfe:	0f 84 c8 00 00 00    	je     802ecc <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802e04:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802e0b:	0f 84 e4 00 00 00    	je     802ef5 <nsipc_sendfile+0x107>
+{
+  802e11:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802e16:	89 fb                	mov    %edi,%ebx
+  802e18:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802e1b:	0f 83 f0 00 00 00    	jae    802f11 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802e21:	89 fa                	mov    %edi,%edx
+  802e23:	03 55 10             	add    0x10(%ebp),%edx
+  802e26:	89 d0                	mov    %edx,%eax
+  802e28:	c1 f8 1f             	sar    $0x1f,%eax
+  802e2b:	c1 e8 14             	shr    $0x14,%eax
+  802e2e:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802e31:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802e37:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802e39:	6a 10                	push   $0x10
+  802e3b:	68 00 20 01 e0       	push   $0xe0012000
+  802e40:	52                   	push   %edx
+  802e41:	ff 75 0c             	push   0xc(%ebp)
+  802e44:	e8 fe f4 ff ff       	call   802347 <fmap>
+  802e49:	83 c4 10             	add    $0x10,%esp
+  802e4c:	85 c0                	test   %eax,%eax
+  802e4e:	0f 8e b8 00 00 00    	jle    802f0c <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802e54:	39 c6                	cmp    %eax,%esi
+  802e56:	0f 8d b5 00 00 00    	jge    802f11 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802e5c:	29 f0                	sub    %esi,%eax
+  802e5e:	8b 55 14             	mov    0x14(%ebp),%edx
+  802e61:	29 da                	sub    %ebx,%edx
+  802e63:	39 d0                	cmp    %edx,%eax
+  802e65:	89 d3                	mov    %edx,%ebx
+  802e67:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802e6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e6d:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802e72:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802e78:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802e7e:	8b 45 18             	mov    0x18(%ebp),%eax
+  802e81:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802e86:	83 ec 0c             	sub    $0xc,%esp
+  802e89:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802e8b:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802e92:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802e95:	83 c0 01             	add    $0x1,%eax
+  802e98:	50                   	push   %eax
+  802e99:	68 00 10 01 e0       	push   $0xe0011000
+  802e9e:	6a 11                	push   $0x11
+  802ea0:	ff 35 24 63 80 00    	push   0x806324
+  802ea6:	e8 aa eb ff ff       	call   801a55 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802eab:	83 c4 1c             	add    $0x1c,%esp
+  802eae:	6a 00                	push   $0x0
+  802eb0:	6a 00                	push   $0x0
+  802eb2:	6a 00                	push   $0x0
+  802eb4:	e8 d8 e8 ff ff       	call   801791 <ipc_recv>
+  802eb9:	83 c4 10             	add    $0x10,%esp
+  802ebc:	85 c0                	test   %eax,%eax
+  802ebe:	78 5b                	js     802f1b <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802ec0:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802ec2:	39 c3                	cmp    %eax,%ebx
+  802ec4:	0f 8e 4c ff ff ff    	jle    802e16 <nsipc_sendfile+0x28>
+  802eca:	eb 45                	jmp    802f11 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802ecc:	83 ec 04             	sub    $0x4,%esp
+  802ecf:	6a 07                	push   $0x7
+  802ed1:	68 00 10 01 e0       	push   $0xe0011000
+  802ed6:	6a 00                	push   $0x0
+  802ed8:	e8 51 e4 ff ff       	call   80132e <sys_page_alloc>
+  802edd:	89 c7                	mov    %eax,%edi
+  802edf:	83 c4 10             	add    $0x10,%esp
+  802ee2:	85 c0                	test   %eax,%eax
+  802ee4:	78 2b                	js     802f11 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802ee6:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802eed:	00 00 00 
+  802ef0:	e9 0f ff ff ff       	jmp    802e04 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802ef5:	83 ec 0c             	sub    $0xc,%esp
+  802ef8:	6a 03                	push   $0x3
+  802efa:	e8 8b eb ff ff       	call   801a8a <ipc_find_env>
+  802eff:	a3 24 63 80 00       	mov    %eax,0x806324
+  802f04:	83 c4 10             	add    $0x10,%esp
+  802f07:	e9 05 ff ff ff       	jmp    802e11 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f0c:	85 ff                	test   %edi,%edi
+  802f0e:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802f11:	89 f8                	mov    %edi,%eax
+  802f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f16:	5b                   	pop    %ebx
+  802f17:	5e                   	pop    %esi
+  802f18:	5f                   	pop    %edi
+  802f19:	5d                   	pop    %ebp
+  802f1a:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802f1b:	85 ff                	test   %edi,%edi
+  802f1d:	0f 44 f8             	cmove  %eax,%edi
+  802f20:	eb ef                	jmp    802f11 <nsipc_sendfile+0x123>
+
+00802f22 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802f22:	55                   	push   %ebp
+  802f23:	89 e5                	mov    %esp,%ebp
+  802f25:	57                   	push   %edi
+  802f26:	56                   	push   %esi
+  802f27:	53                   	push   %ebx
+  802f28:	83 ec 1c             	sub    $0x1c,%esp
+  802f2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802f2e:	e8 13 f9 ff ff       	call   802846 <nsbulk_map>
+  802f33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f36:	85 c0                	test   %eax,%eax
+  802f38:	0f 88 ba 00 00 00    	js     802ff8 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802f3e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f42:	0f 8e bb 00 00 00    	jle    803003 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802f48:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802f52:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802f57:	89 f8                	mov    %edi,%eax
+  802f59:	29 f0                	sub    %esi,%eax
+  802f5b:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802f5f:	39 c8                	cmp    %ecx,%eax
+  802f61:	0f 47 c1             	cmova  %ecx,%eax
+  802f64:	01 f0                	add    %esi,%eax
+  802f66:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802f68:	83 c2 01             	add    $0x1,%edx
+  802f6b:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802f6e:	7e 07                	jle    802f77 <nsipc_recvmsg+0x55>
+  802f70:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802f75:	7e e0                	jle    802f57 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802f77:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802f7d:	c1 fa 0c             	sar    $0xc,%edx
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	e8 0a f9 ff ff       	call   802894 <nsbulk_own>
+  802f8a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f8d:	85 c0                	test   %eax,%eax
+  802f8f:	78 67                	js     802ff8 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802f91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f94:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802f99:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802f9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fa2:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802fa7:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802fac:	89 f2                	mov    %esi,%edx
+  802fae:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802fb3:	e8 44 f9 ff ff       	call   8028fc <nsipc_bulk>
+  802fb8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	78 39                	js     802ff8 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802fbf:	39 f0                	cmp    %esi,%eax
+  802fc1:	7f 4a                	jg     80300d <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802fc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc8:	85 c0                	test   %eax,%eax
+  802fca:	7e 2c                	jle    802ff8 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802fcc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802fcf:	29 fe                	sub    %edi,%esi
+  802fd1:	8b 43 04             	mov    0x4(%ebx),%eax
+  802fd4:	39 c6                	cmp    %eax,%esi
+  802fd6:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802fd9:	83 ec 04             	sub    $0x4,%esp
+  802fdc:	56                   	push   %esi
+  802fdd:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802fe3:	50                   	push   %eax
+  802fe4:	ff 33                	push   (%ebx)
+  802fe6:	e8 bf e0 ff ff       	call   8010aa <memmove>
+		n += m;
+  802feb:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802fed:	83 c3 08             	add    $0x8,%ebx
+  802ff0:	83 c4 10             	add    $0x10,%esp
+  802ff3:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802ff6:	7f d4                	jg     802fcc <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802ff8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ffe:	5b                   	pop    %ebx
+  802fff:	5e                   	pop    %esi
+  803000:	5f                   	pop    %edi
+  803001:	5d                   	pop    %ebp
+  803002:	c3                   	ret
+	int r, i, n, len = 0;
+  803003:	be 00 00 00 00       	mov    $0x0,%esi
+  803008:	e9 6a ff ff ff       	jmp    802f77 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80300d:	68 f8 48 80 00       	push   $0x8048f8
+  803012:	68 01 49 80 00       	push   $0x804901
+  803017:	68 3b 01 00 00       	push   $0x13b
+  80301c:	68 16 49 80 00       	push   $0x804916
+  803021:	e8 02 d7 ff ff       	call   800728 <_panic>
+
+00803026 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803026:	55                   	push   %ebp
+  803027:	89 e5                	mov    %esp,%ebp
+  803029:	57                   	push   %edi
+  80302a:	56                   	push   %esi
+  80302b:	53                   	push   %ebx
+  80302c:	83 ec 0c             	sub    $0xc,%esp
+  80302f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803032:	8b 75 10             	mov    0x10(%ebp),%esi
+  803035:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803038:	8b 45 08             	mov    0x8(%ebp),%eax
+  80303b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  803040:	8b 07                	mov    (%edi),%eax
+  803042:	a3 04 80 80 00       	mov    %eax,0x808004
+  803047:	8b 47 04             	mov    0x4(%edi),%eax
+  80304a:	a3 08 80 80 00       	mov    %eax,0x808008
+  80304f:	8b 47 08             	mov    0x8(%edi),%eax
+  803052:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803057:	8b 47 0c             	mov    0xc(%edi),%eax
+  80305a:	a3 10 80 80 00       	mov    %eax,0x808010
+  80305f:	8b 47 10             	mov    0x10(%edi),%eax
+  803062:	a3 14 80 80 00       	mov    %eax,0x808014
+  803067:	8b 47 14             	mov    0x14(%edi),%eax
+  80306a:	a3 18 80 80 00       	mov    %eax,0x808018
+  80306f:	8b 47 18             	mov    0x18(%edi),%eax
+  803072:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803077:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80307a:	a3 20 80 80 00       	mov    %eax,0x808020
+  80307f:	8b 47 20             	mov    0x20(%edi),%eax
+  803082:	a3 24 80 80 00       	mov    %eax,0x808024
+  803087:	8b 47 24             	mov    0x24(%edi),%eax
+  80308a:	a3 28 80 80 00       	mov    %eax,0x808028
+  80308f:	8b 47 28             	mov    0x28(%edi),%eax
+  803092:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803097:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80309a:	a3 30 80 80 00       	mov    %eax,0x808030
+  80309f:	8b 47 30             	mov    0x30(%edi),%eax
+  8030a2:	a3 34 80 80 00       	mov    %eax,0x808034
+  8030a7:	8b 47 34             	mov    0x34(%edi),%eax
+  8030aa:	a3 38 80 80 00       	mov    %eax,0x808038
+  8030af:	8b 47 38             	mov    0x38(%edi),%eax
+  8030b2:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8030b7:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8030ba:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8030bf:	8b 06                	mov    (%esi),%eax
+  8030c1:	a3 44 80 80 00       	mov    %eax,0x808044
+  8030c6:	8b 46 04             	mov    0x4(%esi),%eax
+  8030c9:	a3 48 80 80 00       	mov    %eax,0x808048
+  8030ce:	8b 46 08             	mov    0x8(%esi),%eax
+  8030d1:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8030d6:	8b 46 0c             	mov    0xc(%esi),%eax
+  8030d9:	a3 50 80 80 00       	mov    %eax,0x808050
+  8030de:	8b 46 10             	mov    0x10(%esi),%eax
+  8030e1:	a3 54 80 80 00       	mov    %eax,0x808054
+  8030e6:	8b 46 14             	mov    0x14(%esi),%eax
+  8030e9:	a3 58 80 80 00       	mov    %eax,0x808058
+  8030ee:	8b 46 18             	mov    0x18(%esi),%eax
+  8030f1:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8030f6:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8030f9:	a3 60 80 80 00       	mov    %eax,0x808060
+  8030fe:	8b 46 20             	mov    0x20(%esi),%eax
+  803101:	a3 64 80 80 00       	mov    %eax,0x808064
+  803106:	8b 46 24             	mov    0x24(%esi),%eax
+  803109:	a3 68 80 80 00       	mov    %eax,0x808068
+  80310e:	8b 46 28             	mov    0x28(%esi),%eax
+  803111:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803116:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803119:	a3 70 80 80 00       	mov    %eax,0x808070
+  80311e:	8b 46 30             	mov    0x30(%esi),%eax
+  803121:	a3 74 80 80 00       	mov    %eax,0x808074
+  803126:	8b 46 34             	mov    0x34(%esi),%eax
+  803129:	a3 78 80 80 00       	mov    %eax,0x808078
+  80312e:	8b 46 38             	mov    0x38(%esi),%eax
+  803131:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803136:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803139:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80313e:	8b 03                	mov    (%ebx),%eax
+  803140:	a3 84 80 80 00       	mov    %eax,0x808084
+  803145:	8b 43 04             	mov    0x4(%ebx),%eax
+  803148:	a3 88 80 80 00       	mov    %eax,0x808088
+  80314d:	8b 43 08             	mov    0x8(%ebx),%eax
+  803150:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803155:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803158:	a3 90 80 80 00       	mov    %eax,0x808090
+  80315d:	8b 43 10             	mov    0x10(%ebx),%eax
+  803160:	a3 94 80 80 00       	mov    %eax,0x808094
+  803165:	8b 43 14             	mov    0x14(%ebx),%eax
+  803168:	a3 98 80 80 00       	mov    %eax,0x808098
+  80316d:	8b 43 18             	mov    0x18(%ebx),%eax
+  803170:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803175:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803178:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80317d:	8b 43 20             	mov    0x20(%ebx),%eax
+  803180:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803185:	8b 43 24             	mov    0x24(%ebx),%eax
+  803188:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80318d:	8b 43 28             	mov    0x28(%ebx),%eax
+  803190:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803195:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803198:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80319d:	8b 43 30             	mov    0x30(%ebx),%eax
+  8031a0:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8031a5:	8b 43 34             	mov    0x34(%ebx),%eax
+  8031a8:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8031ad:	8b 43 38             	mov    0x38(%ebx),%eax
+  8031b0:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8031b5:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8031b8:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8031bd:	8b 45 18             	mov    0x18(%ebp),%eax
+  8031c0:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8031c5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8031ca:	e8 2b f6 ff ff       	call   8027fa <nsipc>
+  8031cf:	85 c0                	test   %eax,%eax
+  8031d1:	0f 88 ad 01 00 00    	js     803384 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8031d7:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8031dd:	89 17                	mov    %edx,(%edi)
+  8031df:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8031e5:	89 57 04             	mov    %edx,0x4(%edi)
+  8031e8:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8031ee:	89 57 08             	mov    %edx,0x8(%edi)
+  8031f1:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8031f7:	89 57 0c             	mov    %edx,0xc(%edi)
+  8031fa:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803200:	89 57 10             	mov    %edx,0x10(%edi)
+  803203:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803209:	89 57 14             	mov    %edx,0x14(%edi)
+  80320c:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803212:	89 57 18             	mov    %edx,0x18(%edi)
+  803215:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80321b:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80321e:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  803224:	89 57 20             	mov    %edx,0x20(%edi)
+  803227:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80322d:	89 57 24             	mov    %edx,0x24(%edi)
+  803230:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803236:	89 57 28             	mov    %edx,0x28(%edi)
+  803239:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80323f:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803242:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803248:	89 57 30             	mov    %edx,0x30(%edi)
+  80324b:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  803251:	89 57 34             	mov    %edx,0x34(%edi)
+  803254:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  80325a:	89 57 38             	mov    %edx,0x38(%edi)
+  80325d:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803263:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803266:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  80326c:	89 16                	mov    %edx,(%esi)
+  80326e:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803274:	89 56 04             	mov    %edx,0x4(%esi)
+  803277:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80327d:	89 56 08             	mov    %edx,0x8(%esi)
+  803280:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803286:	89 56 0c             	mov    %edx,0xc(%esi)
+  803289:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80328f:	89 56 10             	mov    %edx,0x10(%esi)
+  803292:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803298:	89 56 14             	mov    %edx,0x14(%esi)
+  80329b:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8032a1:	89 56 18             	mov    %edx,0x18(%esi)
+  8032a4:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8032aa:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8032ad:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8032b3:	89 56 20             	mov    %edx,0x20(%esi)
+  8032b6:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8032bc:	89 56 24             	mov    %edx,0x24(%esi)
+  8032bf:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8032c5:	89 56 28             	mov    %edx,0x28(%esi)
+  8032c8:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8032ce:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8032d1:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8032d7:	89 56 30             	mov    %edx,0x30(%esi)
+  8032da:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8032e0:	89 56 34             	mov    %edx,0x34(%esi)
+  8032e3:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8032e9:	89 56 38             	mov    %edx,0x38(%esi)
+  8032ec:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8032f2:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8032f5:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8032fb:	89 13                	mov    %edx,(%ebx)
+  8032fd:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803303:	89 53 04             	mov    %edx,0x4(%ebx)
+  803306:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80330c:	89 53 08             	mov    %edx,0x8(%ebx)
+  80330f:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803315:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803318:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  80331e:	89 53 10             	mov    %edx,0x10(%ebx)
+  803321:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803327:	89 53 14             	mov    %edx,0x14(%ebx)
+  80332a:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  803330:	89 53 18             	mov    %edx,0x18(%ebx)
+  803333:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803339:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80333c:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803342:	89 53 20             	mov    %edx,0x20(%ebx)
+  803345:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  80334b:	89 53 24             	mov    %edx,0x24(%ebx)
+  80334e:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803354:	89 53 28             	mov    %edx,0x28(%ebx)
+  803357:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  80335d:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803360:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803366:	89 53 30             	mov    %edx,0x30(%ebx)
+  803369:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80336f:	89 53 34             	mov    %edx,0x34(%ebx)
+  803372:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803378:	89 53 38             	mov    %edx,0x38(%ebx)
+  80337b:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803381:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803384:	83 c4 0c             	add    $0xc,%esp
+  803387:	5b                   	pop    %ebx
+  803388:	5e                   	pop    %esi
+  803389:	5f                   	pop    %edi
+  80338a:	5d                   	pop    %ebp
+  80338b:	c3                   	ret
+
+0080338c <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80338c:	55                   	push   %ebp
+  80338d:	89 e5                	mov    %esp,%ebp
+  80338f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803392:	8b 45 08             	mov    0x8(%ebp),%eax
+  803395:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80339a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80339d:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8033a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033a5:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8033aa:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8033af:	e8 46 f4 ff ff       	call   8027fa <nsipc>
+}
+  8033b4:	c9                   	leave
+  8033b5:	c3                   	ret
+
+008033b6 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8033b6:	55                   	push   %ebp
+  8033b7:	89 e5                	mov    %esp,%ebp
+  8033b9:	56                   	push   %esi
+  8033ba:	53                   	push   %ebx
+  8033bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8033be:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8033c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033c7:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8033cc:	b8 10 00 00 00       	mov    $0x10,%eax
+  8033d1:	e8 24 f4 ff ff       	call   8027fa <nsipc>
+  8033d6:	89 c3                	mov    %eax,%ebx
+  8033d8:	85 c0                	test   %eax,%eax
+  8033da:	7e 1f                	jle    8033fb <nsipc_evwait+0x45>
+		assert(r <= max);
+  8033dc:	39 c6                	cmp    %eax,%esi
+  8033de:	7c 24                	jl     803404 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8033e0:	83 ec 04             	sub    $0x4,%esp
+  8033e3:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8033ea:	50                   	push   %eax
+  8033eb:	68 00 80 80 00       	push   $0x808000
+  8033f0:	ff 75 08             	push   0x8(%ebp)
+  8033f3:	e8 b2 dc ff ff       	call   8010aa <memmove>
+  8033f8:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8033fb:	89 d8                	mov    %ebx,%eax
+  8033fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803400:	5b                   	pop    %ebx
+  803401:	5e                   	pop    %esi
+  803402:	5d                   	pop    %ebp
+  803403:	c3                   	ret
+		assert(r <= max);
+  803404:	68 2e 49 80 00       	push   $0x80492e
+  803409:	68 01 49 80 00       	push   $0x804901
+  80340e:	68 6a 01 00 00       	push   $0x16a
+  803413:	68 16 49 80 00       	push   $0x804916
+  803418:	e8 0b d3 ff ff       	call   800728 <_panic>
+
+0080341d <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80341d:	55                   	push   %ebp
+  80341e:	89 e5                	mov    %esp,%ebp
+  803420:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803423:	8b 45 08             	mov    0x8(%ebp),%eax
+  803426:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80342b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80342e:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803433:	8b 45 10             	mov    0x10(%ebp),%eax
+  803436:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80343b:	b8 09 00 00 00       	mov    $0x9,%eax
+  803440:	e8 b5 f3 ff ff       	call   8027fa <nsipc>
+}
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+
+00803447 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803450:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803455:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80345a:	e8 9b f3 ff ff       	call   8027fa <nsipc>
+}
+  80345f:	c9                   	leave
+  803460:	c3                   	ret
+
+00803461 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803461:	55                   	push   %ebp
+  803462:	89 e5                	mov    %esp,%ebp
+  803464:	53                   	push   %ebx
+  803465:	83 ec 04             	sub    $0x4,%esp
+  803468:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80346b:	b8 12 00 00 00       	mov    $0x12,%eax
+  803470:	e8 85 f3 ff ff       	call   8027fa <nsipc>
+  803475:	85 c0                	test   %eax,%eax
+  803477:	78 50                	js     8034c9 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803479:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80347f:	89 13                	mov    %edx,(%ebx)
+  803481:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803487:	89 53 04             	mov    %edx,0x4(%ebx)
+  80348a:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803490:	89 53 08             	mov    %edx,0x8(%ebx)
+  803493:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803499:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80349c:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8034a2:	89 53 10             	mov    %edx,0x10(%ebx)
+  8034a5:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8034ab:	89 53 14             	mov    %edx,0x14(%ebx)
+  8034ae:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8034b4:	89 53 18             	mov    %edx,0x18(%ebx)
+  8034b7:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8034bd:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8034c0:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8034c6:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8034c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034cc:	c9                   	leave
+  8034cd:	c3                   	ret
+
+008034ce <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8034ce:	55                   	push   %ebp
+  8034cf:	89 e5                	mov    %esp,%ebp
+  8034d1:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8034d4:	6a 03                	push   $0x3
+  8034d6:	e8 af e5 ff ff       	call   801a8a <ipc_find_env>
+  8034db:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  8034e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8034e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8034ed:	e8 08 f3 ff ff       	call   8027fa <nsipc>
+  8034f2:	83 c4 10             	add    $0x10,%esp
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	78 0a                	js     803503 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8034f9:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  8034fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803503:	c9                   	leave
+  803504:	c3                   	ret
+
+00803505 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803505:	55                   	push   %ebp
+  803506:	89 e5                	mov    %esp,%ebp
+  803508:	57                   	push   %edi
+  803509:	56                   	push   %esi
+  80350a:	53                   	push   %ebx
+  80350b:	83 ec 1c             	sub    $0x1c,%esp
+  80350e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803511:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803514:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803519:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80351e:	89 e0                	mov    %esp,%eax
+  803520:	89 f2                	mov    %esi,%edx
+  803522:	29 c2                	sub    %eax,%edx
+  803524:	89 d0                	mov    %edx,%eax
+  803526:	c1 e8 0f             	shr    $0xf,%eax
+  803529:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80352f:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803532:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803539:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80353c:	83 ec 0c             	sub    $0xc,%esp
+  80353f:	ff 75 e0             	push   -0x20(%ebp)
+  803542:	e8 5a 09 00 00       	call   803ea1 <pageref>
+  803547:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80354a:	83 c4 04             	add    $0x4,%esp
+  80354d:	ff 75 dc             	push   -0x24(%ebp)
+  803550:	e8 4c 09 00 00       	call   803ea1 <pageref>
+  803555:	89 e2                	mov    %esp,%edx
+  803557:	89 f1                	mov    %esi,%ecx
+  803559:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  80355b:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80355e:	89 ca                	mov    %ecx,%edx
+  803560:	c1 ea 0f             	shr    $0xf,%edx
+  803563:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803569:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  80356c:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  803573:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803576:	39 d7                	cmp    %edx,%edi
+  803578:	74 40                	je     8035ba <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80357a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80357d:	75 9f                	jne    80351e <_pipeisclosed+0x19>
+  80357f:	89 e2                	mov    %esp,%edx
+  803581:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803586:	29 d0                	sub    %edx,%eax
+  803588:	89 c2                	mov    %eax,%edx
+  80358a:	c1 ea 0f             	shr    $0xf,%edx
+  80358d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803592:	b8 00 00 00 00       	mov    $0x0,%eax
+  803597:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80359a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8035a1:	8b 40 58             	mov    0x58(%eax),%eax
+  8035a4:	6a 01                	push   $0x1
+  8035a6:	50                   	push   %eax
+  8035a7:	57                   	push   %edi
+  8035a8:	68 37 49 80 00       	push   $0x804937
+  8035ad:	e8 51 d2 ff ff       	call   800803 <cprintf>
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	e9 5f ff ff ff       	jmp    803519 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8035ba:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8035bd:	0f 94 c0             	sete   %al
+  8035c0:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8035c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035c6:	5b                   	pop    %ebx
+  8035c7:	5e                   	pop    %esi
+  8035c8:	5f                   	pop    %edi
+  8035c9:	5d                   	pop    %ebp
+  8035ca:	c3                   	ret
+
+008035cb <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8035cb:	55                   	push   %ebp
+  8035cc:	89 e5                	mov    %esp,%ebp
+  8035ce:	53                   	push   %ebx
+  8035cf:	83 ec 0c             	sub    $0xc,%esp
+  8035d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8035d5:	53                   	push   %ebx
+  8035d6:	6a 00                	push   $0x0
+  8035d8:	e8 d6 dd ff ff       	call   8013b3 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8035dd:	89 1c 24             	mov    %ebx,(%esp)
+  8035e0:	e8 f4 e4 ff ff       	call   801ad9 <fd2data>
+  8035e5:	83 c4 08             	add    $0x8,%esp
+  8035e8:	50                   	push   %eax
+  8035e9:	6a 00                	push   $0x0
+  8035eb:	e8 c3 dd ff ff       	call   8013b3 <sys_page_unmap>
+}
+  8035f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f3:	c9                   	leave
+  8035f4:	c3                   	ret
+
+008035f5 <devpipe_read>:
+{
+  8035f5:	55                   	push   %ebp
+  8035f6:	89 e5                	mov    %esp,%ebp
+  8035f8:	57                   	push   %edi
+  8035f9:	56                   	push   %esi
+  8035fa:	53                   	push   %ebx
+  8035fb:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8035fe:	ff 75 08             	push   0x8(%ebp)
+  803601:	e8 d3 e4 ff ff       	call   801ad9 <fd2data>
+  803606:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803608:	8b 70 04             	mov    0x4(%eax),%esi
+  80360b:	8b 00                	mov    (%eax),%eax
+  80360d:	83 c4 10             	add    $0x10,%esp
+  803610:	39 f0                	cmp    %esi,%eax
+  803612:	75 36                	jne    80364a <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803614:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803617:	89 da                	mov    %ebx,%edx
+  803619:	8b 45 08             	mov    0x8(%ebp),%eax
+  80361c:	e8 e4 fe ff ff       	call   803505 <_pipeisclosed>
+  803621:	85 c0                	test   %eax,%eax
+  803623:	0f 85 d4 00 00 00    	jne    8036fd <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803629:	b8 01 00 00 00       	mov    $0x1,%eax
+  80362e:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803632:	83 ec 04             	sub    $0x4,%esp
+  803635:	6a ff                	push   $0xffffffff
+  803637:	56                   	push   %esi
+  803638:	57                   	push   %edi
+  803639:	e8 ee e0 ff ff       	call   80172c <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80363e:	8b 73 04             	mov    0x4(%ebx),%esi
+  803641:	8b 03                	mov    (%ebx),%eax
+  803643:	83 c4 10             	add    $0x10,%esp
+  803646:	39 c6                	cmp    %eax,%esi
+  803648:	74 cd                	je     803617 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80364a:	8b 73 04             	mov    0x4(%ebx),%esi
+  80364d:	8b 03                	mov    (%ebx),%eax
+  80364f:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803655:	29 c6                	sub    %eax,%esi
+  803657:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80365c:	f7 e6                	mul    %esi
+  80365e:	c1 ea 0c             	shr    $0xc,%edx
+  803661:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803667:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803669:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80366c:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803670:	8b 0b                	mov    (%ebx),%ecx
+  803672:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803677:	f7 e1                	mul    %ecx
+  803679:	c1 ea 0b             	shr    $0xb,%edx
+  80367c:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803682:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803684:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803689:	29 cf                	sub    %ecx,%edi
+  80368b:	39 f7                	cmp    %esi,%edi
+  80368d:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803690:	83 ec 04             	sub    $0x4,%esp
+  803693:	57                   	push   %edi
+  803694:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803698:	50                   	push   %eax
+  803699:	ff 75 0c             	push   0xc(%ebp)
+  80369c:	e8 09 da ff ff       	call   8010aa <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8036a1:	83 c4 0c             	add    $0xc,%esp
+  8036a4:	89 f0                	mov    %esi,%eax
+  8036a6:	29 f8                	sub    %edi,%eax
+  8036a8:	50                   	push   %eax
+  8036a9:	8d 43 10             	lea    0x10(%ebx),%eax
+  8036ac:	50                   	push   %eax
+  8036ad:	89 f8                	mov    %edi,%eax
+  8036af:	03 45 0c             	add    0xc(%ebp),%eax
+  8036b2:	50                   	push   %eax
+  8036b3:	e8 f2 d9 ff ff       	call   8010aa <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8036b8:	8b 0b                	mov    (%ebx),%ecx
+  8036ba:	01 f1                	add    %esi,%ecx
+  8036bc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8036c1:	f7 e1                	mul    %ecx
+  8036c3:	c1 ea 0c             	shr    $0xc,%edx
+  8036c6:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8036cc:	29 c1                	sub    %eax,%ecx
+  8036ce:	89 0b                	mov    %ecx,(%ebx)
+  8036d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036d5:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8036d9:	83 c4 10             	add    $0x10,%esp
+  8036dc:	85 c0                	test   %eax,%eax
+  8036de:	75 0a                	jne    8036ea <devpipe_read+0xf5>
+	return n;
+  8036e0:	89 f0                	mov    %esi,%eax
+}
+  8036e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036e5:	5b                   	pop    %ebx
+  8036e6:	5e                   	pop    %esi
+  8036e7:	5f                   	pop    %edi
+  8036e8:	5d                   	pop    %ebp
+  8036e9:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8036ea:	83 ec 08             	sub    $0x8,%esp
+  8036ed:	68 00 04 00 00       	push   $0x400
+  8036f2:	53                   	push   %ebx
+  8036f3:	e8 56 e0 ff ff       	call   80174e <sys_futex_wake>
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	eb e3                	jmp    8036e0 <devpipe_read+0xeb>
+			return 0;
+  8036fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803702:	eb de                	jmp    8036e2 <devpipe_read+0xed>
+
+00803704 <devpipe_write>:
+{
+  803704:	55                   	push   %ebp
+  803705:	89 e5                	mov    %esp,%ebp
+  803707:	57                   	push   %edi
+  803708:	56                   	push   %esi
+  803709:	53                   	push   %ebx
+  80370a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80370d:	ff 75 08             	push   0x8(%ebp)
+  803710:	e8 c4 e3 ff ff       	call   801ad9 <fd2data>
+  803715:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803717:	83 c4 10             	add    $0x10,%esp
+  80371a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803721:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803726:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80372a:	0f 84 43 01 00 00    	je     803873 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803730:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803733:	8b 06                	mov    (%esi),%eax
+  803735:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80373b:	29 c1                	sub    %eax,%ecx
+  80373d:	89 c8                	mov    %ecx,%eax
+  80373f:	f7 e7                	mul    %edi
+  803741:	c1 ea 0c             	shr    $0xc,%edx
+  803744:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80374a:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80374c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803752:	75 52                	jne    8037a6 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803754:	89 f2                	mov    %esi,%edx
+  803756:	8b 45 08             	mov    0x8(%ebp),%eax
+  803759:	e8 a7 fd ff ff       	call   803505 <_pipeisclosed>
+  80375e:	85 c0                	test   %eax,%eax
+  803760:	0f 85 28 01 00 00    	jne    80388e <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803766:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803768:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80376b:	8b 06                	mov    (%esi),%eax
+  80376d:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803773:	29 c1                	sub    %eax,%ecx
+  803775:	89 c8                	mov    %ecx,%eax
+  803777:	f7 e7                	mul    %edi
+  803779:	c1 ea 0c             	shr    $0xc,%edx
+  80377c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803782:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803784:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80378a:	75 a4                	jne    803730 <devpipe_write+0x2c>
+  80378c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803791:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803795:	83 ec 04             	sub    $0x4,%esp
+  803798:	6a ff                	push   $0xffffffff
+  80379a:	53                   	push   %ebx
+  80379b:	56                   	push   %esi
+  80379c:	e8 8b df ff ff       	call   80172c <sys_futex_wait>
+}
+  8037a1:	83 c4 10             	add    $0x10,%esp
+  8037a4:	eb 8a                	jmp    803730 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037a6:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037a9:	8b 06                	mov    (%esi),%eax
+  8037ab:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8037b1:	29 c1                	sub    %eax,%ecx
+  8037b3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037b8:	f7 e1                	mul    %ecx
+  8037ba:	c1 ea 0c             	shr    $0xc,%edx
+  8037bd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8037c3:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8037c5:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8037ca:	89 d8                	mov    %ebx,%eax
+  8037cc:	29 c8                	sub    %ecx,%eax
+  8037ce:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8037d4:	29 ca                	sub    %ecx,%edx
+  8037d6:	39 d0                	cmp    %edx,%eax
+  8037d8:	0f 46 d0             	cmovbe %eax,%edx
+  8037db:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8037de:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037e1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037e6:	f7 e1                	mul    %ecx
+  8037e8:	c1 ea 0b             	shr    $0xb,%edx
+  8037eb:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8037f1:	89 ca                	mov    %ecx,%edx
+  8037f3:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8037f5:	29 d3                	sub    %edx,%ebx
+  8037f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8037fa:	39 c3                	cmp    %eax,%ebx
+  8037fc:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8037ff:	83 ec 04             	sub    $0x4,%esp
+  803802:	53                   	push   %ebx
+  803803:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803806:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803809:	51                   	push   %ecx
+  80380a:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80380e:	50                   	push   %eax
+  80380f:	e8 96 d8 ff ff       	call   8010aa <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803814:	83 c4 0c             	add    $0xc,%esp
+  803817:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80381a:	29 d8                	sub    %ebx,%eax
+  80381c:	50                   	push   %eax
+  80381d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803820:	01 cb                	add    %ecx,%ebx
+  803822:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803825:	53                   	push   %ebx
+  803826:	8d 46 10             	lea    0x10(%esi),%eax
+  803829:	50                   	push   %eax
+  80382a:	e8 7b d8 ff ff       	call   8010aa <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80382f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803832:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803835:	01 c1                	add    %eax,%ecx
+  803837:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80383c:	f7 e1                	mul    %ecx
+  80383e:	c1 ea 0c             	shr    $0xc,%edx
+  803841:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803847:	89 ca                	mov    %ecx,%edx
+  803849:	29 c2                	sub    %eax,%edx
+  80384b:	89 56 04             	mov    %edx,0x4(%esi)
+  80384e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803853:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803857:	83 c4 10             	add    $0x10,%esp
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	75 1a                	jne    803878 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80385e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803861:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803864:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803867:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80386a:	0f 82 c0 fe ff ff    	jb     803730 <devpipe_write+0x2c>
+  803870:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803873:	8b 45 10             	mov    0x10(%ebp),%eax
+  803876:	eb 1b                	jmp    803893 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803878:	83 ec 08             	sub    $0x8,%esp
+  80387b:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803880:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803883:	50                   	push   %eax
+  803884:	e8 c5 de ff ff       	call   80174e <sys_futex_wake>
+  803889:	83 c4 10             	add    $0x10,%esp
+  80388c:	eb d0                	jmp    80385e <devpipe_write+0x15a>
+				return 0;
+  80388e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803893:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803896:	5b                   	pop    %ebx
+  803897:	5e                   	pop    %esi
+  803898:	5f                   	pop    %edi
+  803899:	5d                   	pop    %ebp
+  80389a:	c3                   	ret
+
+0080389b <devpipe_stat>:
+{
+  80389b:	55                   	push   %ebp
+  80389c:	89 e5                	mov    %esp,%ebp
+  80389e:	56                   	push   %esi
+  80389f:	53                   	push   %ebx
+  8038a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8038a3:	83 ec 0c             	sub    $0xc,%esp
+  8038a6:	ff 75 08             	push   0x8(%ebp)
+  8038a9:	e8 2b e2 ff ff       	call   801ad9 <fd2data>
+  8038ae:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8038b0:	83 c4 08             	add    $0x8,%esp
+  8038b3:	68 4a 49 80 00       	push   $0x80494a
+  8038b8:	53                   	push   %ebx
+  8038b9:	e8 3c d6 ff ff       	call   800efa <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038be:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038c1:	8b 06                	mov    (%esi),%eax
+  8038c3:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038c9:	29 c1                	sub    %eax,%ecx
+  8038cb:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8038d0:	89 c8                	mov    %ecx,%eax
+  8038d2:	f7 e2                	mul    %edx
+  8038d4:	c1 ea 0c             	shr    $0xc,%edx
+  8038d7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038dd:	29 d1                	sub    %edx,%ecx
+  8038df:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8038e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8038ec:	00 00 00 
+	stat->st_dev = &devpipe;
+  8038ef:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8038f6:	50 80 00 
+}
+  8038f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803901:	5b                   	pop    %ebx
+  803902:	5e                   	pop    %esi
+  803903:	5d                   	pop    %ebp
+  803904:	c3                   	ret
+
+00803905 <devpipe_poll>:
+{
+  803905:	55                   	push   %ebp
+  803906:	89 e5                	mov    %esp,%ebp
+  803908:	57                   	push   %edi
+  803909:	56                   	push   %esi
+  80390a:	53                   	push   %ebx
+  80390b:	83 ec 18             	sub    $0x18,%esp
+  80390e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803911:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803914:	57                   	push   %edi
+  803915:	e8 bf e1 ff ff       	call   801ad9 <fd2data>
+  80391a:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80391c:	83 c4 10             	add    $0x10,%esp
+  80391f:	89 f3                	mov    %esi,%ebx
+  803921:	83 e3 01             	and    $0x1,%ebx
+  803924:	75 27                	jne    80394d <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803926:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80392c:	75 48                	jne    803976 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80392e:	89 ca                	mov    %ecx,%edx
+  803930:	89 f8                	mov    %edi,%eax
+  803932:	e8 ce fb ff ff       	call   803505 <_pipeisclosed>
+  803937:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803939:	89 d8                	mov    %ebx,%eax
+  80393b:	83 c8 10             	or     $0x10,%eax
+  80393e:	85 d2                	test   %edx,%edx
+  803940:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803943:	89 d8                	mov    %ebx,%eax
+  803945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803948:	5b                   	pop    %ebx
+  803949:	5e                   	pop    %esi
+  80394a:	5f                   	pop    %edi
+  80394b:	5d                   	pop    %ebp
+  80394c:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80394d:	8b 58 04             	mov    0x4(%eax),%ebx
+  803950:	8b 00                	mov    (%eax),%eax
+  803952:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803958:	29 c3                	sub    %eax,%ebx
+  80395a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80395f:	89 d8                	mov    %ebx,%eax
+  803961:	f7 e2                	mul    %edx
+  803963:	c1 ea 0c             	shr    $0xc,%edx
+  803966:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80396c:	39 d3                	cmp    %edx,%ebx
+  80396e:	0f 95 c3             	setne  %bl
+  803971:	0f b6 db             	movzbl %bl,%ebx
+  803974:	eb b0                	jmp    803926 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803976:	8b 71 04             	mov    0x4(%ecx),%esi
+  803979:	8b 01                	mov    (%ecx),%eax
+  80397b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803981:	29 c6                	sub    %eax,%esi
+  803983:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803988:	89 f0                	mov    %esi,%eax
+  80398a:	f7 e2                	mul    %edx
+  80398c:	c1 ea 0c             	shr    $0xc,%edx
+  80398f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803995:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803997:	89 d8                	mov    %ebx,%eax
+  803999:	83 c8 04             	or     $0x4,%eax
+  80399c:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8039a2:	0f 42 d8             	cmovb  %eax,%ebx
+  8039a5:	eb 87                	jmp    80392e <devpipe_poll+0x29>
+
+008039a7 <pipe>:
+{
+  8039a7:	55                   	push   %ebp
+  8039a8:	89 e5                	mov    %esp,%ebp
+  8039aa:	56                   	push   %esi
+  8039ab:	53                   	push   %ebx
+  8039ac:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8039af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039b2:	50                   	push   %eax
+  8039b3:	e8 38 e1 ff ff       	call   801af0 <fd_alloc>
+  8039b8:	89 c3                	mov    %eax,%ebx
+  8039ba:	83 c4 10             	add    $0x10,%esp
+  8039bd:	85 c0                	test   %eax,%eax
+  8039bf:	0f 88 23 01 00 00    	js     803ae8 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039c5:	83 ec 04             	sub    $0x4,%esp
+  8039c8:	68 07 04 00 00       	push   $0x407
+  8039cd:	ff 75 f4             	push   -0xc(%ebp)
+  8039d0:	6a 00                	push   $0x0
+  8039d2:	e8 57 d9 ff ff       	call   80132e <sys_page_alloc>
+  8039d7:	89 c3                	mov    %eax,%ebx
+  8039d9:	83 c4 10             	add    $0x10,%esp
+  8039dc:	85 c0                	test   %eax,%eax
+  8039de:	0f 88 04 01 00 00    	js     803ae8 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8039e4:	83 ec 0c             	sub    $0xc,%esp
+  8039e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8039ea:	50                   	push   %eax
+  8039eb:	e8 00 e1 ff ff       	call   801af0 <fd_alloc>
+  8039f0:	89 c3                	mov    %eax,%ebx
+  8039f2:	83 c4 10             	add    $0x10,%esp
+  8039f5:	85 c0                	test   %eax,%eax
+  8039f7:	0f 88 db 00 00 00    	js     803ad8 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039fd:	83 ec 04             	sub    $0x4,%esp
+  803a00:	68 07 04 00 00       	push   $0x407
+  803a05:	ff 75 f0             	push   -0x10(%ebp)
+  803a08:	6a 00                	push   $0x0
+  803a0a:	e8 1f d9 ff ff       	call   80132e <sys_page_alloc>
+  803a0f:	89 c3                	mov    %eax,%ebx
+  803a11:	83 c4 10             	add    $0x10,%esp
+  803a14:	85 c0                	test   %eax,%eax
+  803a16:	0f 88 bc 00 00 00    	js     803ad8 <pipe+0x131>
+	va = fd2data(fd0);
+  803a1c:	83 ec 0c             	sub    $0xc,%esp
+  803a1f:	ff 75 f4             	push   -0xc(%ebp)
+  803a22:	e8 b2 e0 ff ff       	call   801ad9 <fd2data>
+  803a27:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a29:	83 c4 0c             	add    $0xc,%esp
+  803a2c:	68 07 04 00 00       	push   $0x407
+  803a31:	50                   	push   %eax
+  803a32:	6a 00                	push   $0x0
+  803a34:	e8 f5 d8 ff ff       	call   80132e <sys_page_alloc>
+  803a39:	89 c3                	mov    %eax,%ebx
+  803a3b:	83 c4 10             	add    $0x10,%esp
+  803a3e:	85 c0                	test   %eax,%eax
+  803a40:	0f 88 82 00 00 00    	js     803ac8 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a46:	83 ec 0c             	sub    $0xc,%esp
+  803a49:	ff 75 f0             	push   -0x10(%ebp)
+  803a4c:	e8 88 e0 ff ff       	call   801ad9 <fd2data>
+  803a51:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803a58:	50                   	push   %eax
+  803a59:	6a 00                	push   $0x0
+  803a5b:	56                   	push   %esi
+  803a5c:	6a 00                	push   $0x0
+  803a5e:	e8 0e d9 ff ff       	call   801371 <sys_page_map>
+  803a63:	89 c3                	mov    %eax,%ebx
+  803a65:	83 c4 20             	add    $0x20,%esp
+  803a68:	85 c0                	test   %eax,%eax
+  803a6a:	78 4e                	js     803aba <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a6c:	a1 60 50 80 00       	mov    0x805060,%eax
+  803a71:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a74:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a76:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a79:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a80:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a83:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a85:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a88:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a8f:	83 ec 0c             	sub    $0xc,%esp
+  803a92:	ff 75 f4             	push   -0xc(%ebp)
+  803a95:	e8 2f e0 ff ff       	call   801ac9 <fd2num>
+  803a9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a9d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a9f:	83 c4 04             	add    $0x4,%esp
+  803aa2:	ff 75 f0             	push   -0x10(%ebp)
+  803aa5:	e8 1f e0 ff ff       	call   801ac9 <fd2num>
+  803aaa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803aad:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803ab0:	83 c4 10             	add    $0x10,%esp
+  803ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ab8:	eb 2e                	jmp    803ae8 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803aba:	83 ec 08             	sub    $0x8,%esp
+  803abd:	56                   	push   %esi
+  803abe:	6a 00                	push   $0x0
+  803ac0:	e8 ee d8 ff ff       	call   8013b3 <sys_page_unmap>
+  803ac5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803ac8:	83 ec 08             	sub    $0x8,%esp
+  803acb:	ff 75 f0             	push   -0x10(%ebp)
+  803ace:	6a 00                	push   $0x0
+  803ad0:	e8 de d8 ff ff       	call   8013b3 <sys_page_unmap>
+  803ad5:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803ad8:	83 ec 08             	sub    $0x8,%esp
+  803adb:	ff 75 f4             	push   -0xc(%ebp)
+  803ade:	6a 00                	push   $0x0
+  803ae0:	e8 ce d8 ff ff       	call   8013b3 <sys_page_unmap>
+  803ae5:	83 c4 10             	add    $0x10,%esp
+}
+  803ae8:	89 d8                	mov    %ebx,%eax
+  803aea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803aed:	5b                   	pop    %ebx
+  803aee:	5e                   	pop    %esi
+  803aef:	5d                   	pop    %ebp
+  803af0:	c3                   	ret
+
+00803af1 <pipeisclosed>:
+{
+  803af1:	55                   	push   %ebp
+  803af2:	89 e5                	mov    %esp,%ebp
+  803af4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803af7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803afa:	50                   	push   %eax
+  803afb:	ff 75 08             	push   0x8(%ebp)
+  803afe:	e8 3d e0 ff ff       	call   801b40 <fd_lookup>
+  803b03:	83 c4 10             	add    $0x10,%esp
+  803b06:	85 c0                	test   %eax,%eax
+  803b08:	78 18                	js     803b22 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803b0a:	83 ec 0c             	sub    $0xc,%esp
+  803b0d:	ff 75 f4             	push   -0xc(%ebp)
+  803b10:	e8 c4 df ff ff       	call   801ad9 <fd2data>
+  803b15:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803b17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b1a:	e8 e6 f9 ff ff       	call   803505 <_pipeisclosed>
+  803b1f:	83 c4 10             	add    $0x10,%esp
+}
+  803b22:	c9                   	leave
+  803b23:	c3                   	ret
+
+00803b24 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803b24:	55                   	push   %ebp
+  803b25:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b2a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803b30:	5d                   	pop    %ebp
+  803b31:	c3                   	ret
+
+00803b32 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803b32:	55                   	push   %ebp
+  803b33:	89 e5                	mov    %esp,%ebp
+  803b35:	53                   	push   %ebx
+  803b36:	83 ec 04             	sub    $0x4,%esp
+  803b39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803b3c:	8b 03                	mov    (%ebx),%eax
+  803b3e:	85 c0                	test   %eax,%eax
+  803b40:	75 05                	jne    803b47 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803b42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b45:	c9                   	leave
+  803b46:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803b47:	83 ec 08             	sub    $0x8,%esp
+  803b4a:	50                   	push   %eax
+  803b4b:	8d 43 04             	lea    0x4(%ebx),%eax
+  803b4e:	50                   	push   %eax
+  803b4f:	e8 af da ff ff       	call   801603 <sys_page_batch>
+	pb->pb_n = 0;
+  803b54:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803b5a:	83 c4 10             	add    $0x10,%esp
+  803b5d:	eb e3                	jmp    803b42 <pgbatch_flush+0x10>
+
+00803b5f <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803b5f:	55                   	push   %ebp
+  803b60:	89 e5                	mov    %esp,%ebp
+  803b62:	56                   	push   %esi
+  803b63:	53                   	push   %ebx
+  803b64:	89 c3                	mov    %eax,%ebx
+  803b66:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803b68:	83 38 20             	cmpl   $0x20,(%eax)
+  803b6b:	74 2c                	je     803b99 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803b6d:	8b 03                	mov    (%ebx),%eax
+  803b6f:	8d 50 01             	lea    0x1(%eax),%edx
+  803b72:	89 13                	mov    %edx,(%ebx)
+  803b74:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803b77:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803b7b:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803b7d:	83 ec 04             	sub    $0x4,%esp
+  803b80:	6a 18                	push   $0x18
+  803b82:	6a 00                	push   $0x0
+  803b84:	50                   	push   %eax
+  803b85:	e8 eb d4 ff ff       	call   801075 <memset>
+	return 0;
+  803b8a:	83 c4 10             	add    $0x10,%esp
+  803b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b95:	5b                   	pop    %ebx
+  803b96:	5e                   	pop    %esi
+  803b97:	5d                   	pop    %ebp
+  803b98:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803b99:	83 ec 0c             	sub    $0xc,%esp
+  803b9c:	50                   	push   %eax
+  803b9d:	e8 90 ff ff ff       	call   803b32 <pgbatch_flush>
+  803ba2:	83 c4 10             	add    $0x10,%esp
+  803ba5:	85 c0                	test   %eax,%eax
+  803ba7:	79 c4                	jns    803b6d <pgbatch_slot+0xe>
+  803ba9:	eb e7                	jmp    803b92 <pgbatch_slot+0x33>
+
+00803bab <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803bab:	55                   	push   %ebp
+  803bac:	89 e5                	mov    %esp,%ebp
+  803bae:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803bb1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bb7:	e8 a3 ff ff ff       	call   803b5f <pgbatch_slot>
+  803bbc:	85 c0                	test   %eax,%eax
+  803bbe:	78 20                	js     803be0 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803bc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bc3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803bc9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bcc:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803bcf:	8b 55 10             	mov    0x10(%ebp),%edx
+  803bd2:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803bd5:	8b 55 14             	mov    0x14(%ebp),%edx
+  803bd8:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803bdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be0:	c9                   	leave
+  803be1:	c3                   	ret
+
+00803be2 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803be2:	55                   	push   %ebp
+  803be3:	89 e5                	mov    %esp,%ebp
+  803be5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803be8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bee:	e8 6c ff ff ff       	call   803b5f <pgbatch_slot>
+  803bf3:	85 c0                	test   %eax,%eax
+  803bf5:	78 2c                	js     803c23 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803bf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bfa:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803c00:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c03:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803c06:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c09:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803c0c:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c0f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803c12:	8b 55 18             	mov    0x18(%ebp),%edx
+  803c15:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c18:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803c1b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c23:	c9                   	leave
+  803c24:	c3                   	ret
+
+00803c25 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803c25:	55                   	push   %ebp
+  803c26:	89 e5                	mov    %esp,%ebp
+  803c28:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c2b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c31:	e8 29 ff ff ff       	call   803b5f <pgbatch_slot>
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	78 1a                	js     803c54 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c3d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803c43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c46:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803c49:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c4c:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c54:	c9                   	leave
+  803c55:	c3                   	ret
+
+00803c56 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803c56:	55                   	push   %ebp
+  803c57:	89 e5                	mov    %esp,%ebp
+  803c59:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c5c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c62:	e8 f8 fe ff ff       	call   803b5f <pgbatch_slot>
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	78 20                	js     803c8b <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803c6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c6e:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803c74:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c77:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803c7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c7d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c80:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c83:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c8b:	c9                   	leave
+  803c8c:	c3                   	ret
+
+00803c8d <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803c8d:	55                   	push   %ebp
+  803c8e:	89 e5                	mov    %esp,%ebp
+  803c90:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c93:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c99:	e8 c1 fe ff ff       	call   803b5f <pgbatch_slot>
+  803c9e:	85 c0                	test   %eax,%eax
+  803ca0:	78 26                	js     803cc8 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803ca2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ca5:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803cab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cae:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803cb1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803cb4:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803cb7:	8b 55 14             	mov    0x14(%ebp),%edx
+  803cba:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803cbd:	8b 55 18             	mov    0x18(%ebp),%edx
+  803cc0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc8:	c9                   	leave
+  803cc9:	c3                   	ret
+
+00803cca <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccf:	c3                   	ret
+
+00803cd0 <devcons_poll>:
+{
+  803cd0:	55                   	push   %ebp
+  803cd1:	89 e5                	mov    %esp,%ebp
+  803cd3:	53                   	push   %ebx
+  803cd4:	83 ec 04             	sub    $0x4,%esp
+  803cd7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803cda:	89 da                	mov    %ebx,%edx
+  803cdc:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803cdf:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803ce6:	74 0c                	je     803cf4 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803ce8:	89 d8                	mov    %ebx,%eax
+  803cea:	83 e0 01             	and    $0x1,%eax
+  803ced:	09 d0                	or     %edx,%eax
+}
+  803cef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cf2:	c9                   	leave
+  803cf3:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803cf4:	e8 97 d5 ff ff       	call   801290 <sys_cgetc>
+  803cf9:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803cfe:	89 da                	mov    %ebx,%edx
+  803d00:	83 e2 04             	and    $0x4,%edx
+  803d03:	85 c0                	test   %eax,%eax
+  803d05:	74 e6                	je     803ced <devcons_poll+0x1d>
+  803d07:	eb df                	jmp    803ce8 <devcons_poll+0x18>
+
+00803d09 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803d09:	55                   	push   %ebp
+  803d0a:	89 e5                	mov    %esp,%ebp
+  803d0c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803d0f:	68 56 49 80 00       	push   $0x804956
+  803d14:	ff 75 0c             	push   0xc(%ebp)
+  803d17:	e8 de d1 ff ff       	call   800efa <strcpy>
+	return 0;
+}
+  803d1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d21:	c9                   	leave
+  803d22:	c3                   	ret
+
+00803d23 <devcons_write>:
+{
+  803d23:	55                   	push   %ebp
+  803d24:	89 e5                	mov    %esp,%ebp
+  803d26:	57                   	push   %edi
+  803d27:	56                   	push   %esi
+  803d28:	53                   	push   %ebx
+  803d29:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803d2f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803d32:	85 ff                	test   %edi,%edi
+  803d34:	74 51                	je     803d87 <devcons_write+0x64>
+  803d36:	be 00 00 00 00       	mov    $0x0,%esi
+  803d3b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803d40:	89 fb                	mov    %edi,%ebx
+  803d42:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803d44:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803d49:	39 d3                	cmp    %edx,%ebx
+  803d4b:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803d4e:	83 ec 04             	sub    $0x4,%esp
+  803d51:	53                   	push   %ebx
+  803d52:	03 45 0c             	add    0xc(%ebp),%eax
+  803d55:	50                   	push   %eax
+  803d56:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d5c:	50                   	push   %eax
+  803d5d:	e8 48 d3 ff ff       	call   8010aa <memmove>
+		sys_cputs(buf, m);
+  803d62:	83 c4 08             	add    $0x8,%esp
+  803d65:	53                   	push   %ebx
+  803d66:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803d6c:	50                   	push   %eax
+  803d6d:	e8 00 d5 ff ff       	call   801272 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803d72:	01 de                	add    %ebx,%esi
+  803d74:	89 f0                	mov    %esi,%eax
+  803d76:	83 c4 10             	add    $0x10,%esp
+  803d79:	39 fe                	cmp    %edi,%esi
+  803d7b:	72 c3                	jb     803d40 <devcons_write+0x1d>
+}
+  803d7d:	89 f0                	mov    %esi,%eax
+  803d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d82:	5b                   	pop    %ebx
+  803d83:	5e                   	pop    %esi
+  803d84:	5f                   	pop    %edi
+  803d85:	5d                   	pop    %ebp
+  803d86:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803d87:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803d8c:	eb ef                	jmp    803d7d <devcons_write+0x5a>
+
+00803d8e <devcons_read>:
+{
+  803d8e:	55                   	push   %ebp
+  803d8f:	89 e5                	mov    %esp,%ebp
+  803d91:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803d99:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803d9d:	74 36                	je     803dd5 <devcons_read+0x47>
+	c = cons_peek;
+  803d9f:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  803da4:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  803dab:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803dae:	85 c0                	test   %eax,%eax
+  803db0:	75 10                	jne    803dc2 <devcons_read+0x34>
+  803db2:	e8 d9 d4 ff ff       	call   801290 <sys_cgetc>
+  803db7:	85 c0                	test   %eax,%eax
+  803db9:	75 07                	jne    803dc2 <devcons_read+0x34>
+		sys_yield();
+  803dbb:	e8 4f d5 ff ff       	call   80130f <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803dc0:	eb f0                	jmp    803db2 <devcons_read+0x24>
+	if (c < 0)
+  803dc2:	85 c0                	test   %eax,%eax
+  803dc4:	78 0f                	js     803dd5 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803dc6:	83 f8 04             	cmp    $0x4,%eax
+  803dc9:	74 0c                	je     803dd7 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803dcb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dce:	88 02                	mov    %al,(%edx)
+	return 1;
+  803dd0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803dd5:	c9                   	leave
+  803dd6:	c3                   	ret
+		return 0;
+  803dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ddc:	eb f7                	jmp    803dd5 <devcons_read+0x47>
+
+00803dde <cputchar>:
+{
+  803dde:	55                   	push   %ebp
+  803ddf:	89 e5                	mov    %esp,%ebp
+  803de1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803de4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803de7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803dea:	6a 01                	push   $0x1
+  803dec:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803def:	50                   	push   %eax
+  803df0:	e8 7d d4 ff ff       	call   801272 <sys_cputs>
+}
+  803df5:	83 c4 10             	add    $0x10,%esp
+  803df8:	c9                   	leave
+  803df9:	c3                   	ret
+
+00803dfa <getchar>:
+{
+  803dfa:	55                   	push   %ebp
+  803dfb:	89 e5                	mov    %esp,%ebp
+  803dfd:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803e00:	6a 01                	push   $0x1
+  803e02:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803e05:	50                   	push   %eax
+  803e06:	6a 00                	push   $0x0
+  803e08:	e8 b7 df ff ff       	call   801dc4 <read>
+	if (r < 0)
+  803e0d:	83 c4 10             	add    $0x10,%esp
+  803e10:	85 c0                	test   %eax,%eax
+  803e12:	78 06                	js     803e1a <getchar+0x20>
+	if (r < 1)
+  803e14:	74 06                	je     803e1c <getchar+0x22>
+	return c;
+  803e16:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803e1a:	c9                   	leave
+  803e1b:	c3                   	ret
+		return -E_EOF;
+  803e1c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803e21:	eb f7                	jmp    803e1a <getchar+0x20>
+
+00803e23 <iscons>:
+{
+  803e23:	55                   	push   %ebp
+  803e24:	89 e5                	mov    %esp,%ebp
+  803e26:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e2c:	50                   	push   %eax
+  803e2d:	ff 75 08             	push   0x8(%ebp)
+  803e30:	e8 0b dd ff ff       	call   801b40 <fd_lookup>
+  803e35:	83 c4 10             	add    $0x10,%esp
+  803e38:	85 c0                	test   %eax,%eax
+  803e3a:	78 11                	js     803e4d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803e3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e3f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803e45:	39 10                	cmp    %edx,(%eax)
+  803e47:	0f 94 c0             	sete   %al
+  803e4a:	0f b6 c0             	movzbl %al,%eax
+}
+  803e4d:	c9                   	leave
+  803e4e:	c3                   	ret
+
+00803e4f <opencons>:
+{
+  803e4f:	55                   	push   %ebp
+  803e50:	89 e5                	mov    %esp,%ebp
+  803e52:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803e55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e58:	50                   	push   %eax
+  803e59:	e8 92 dc ff ff       	call   801af0 <fd_alloc>
+  803e5e:	83 c4 10             	add    $0x10,%esp
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	78 3a                	js     803e9f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803e65:	83 ec 04             	sub    $0x4,%esp
+  803e68:	68 07 04 00 00       	push   $0x407
+  803e6d:	ff 75 f4             	push   -0xc(%ebp)
+  803e70:	6a 00                	push   $0x0
+  803e72:	e8 b7 d4 ff ff       	call   80132e <sys_page_alloc>
+  803e77:	83 c4 10             	add    $0x10,%esp
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	78 21                	js     803e9f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803e7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e81:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803e87:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e8c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803e93:	83 ec 0c             	sub    $0xc,%esp
+  803e96:	50                   	push   %eax
+  803e97:	e8 2d dc ff ff       	call   801ac9 <fd2num>
+  803e9c:	83 c4 10             	add    $0x10,%esp
+}
+  803e9f:	c9                   	leave
+  803ea0:	c3                   	ret
+
+00803ea1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803ea1:	55                   	push   %ebp
+  803ea2:	89 e5                	mov    %esp,%ebp
+  803ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803ea7:	89 c2                	mov    %eax,%edx
+  803ea9:	c1 ea 16             	shr    $0x16,%edx
+  803eac:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803eb3:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803eb8:	f6 c1 01             	test   $0x1,%cl
+  803ebb:	74 1e                	je     803edb <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803ebd:	c1 e8 0c             	shr    $0xc,%eax
+  803ec0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803ec7:	a8 01                	test   $0x1,%al
+  803ec9:	74 10                	je     803edb <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803ecb:	c1 e8 0c             	shr    $0xc,%eax
+  803ece:	c1 e0 04             	shl    $0x4,%eax
+  803ed1:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803ed8:	0f b7 d2             	movzwl %dx,%edx
+}
+  803edb:	89 d0                	mov    %edx,%eax
+  803edd:	5d                   	pop    %ebp
+  803ede:	c3                   	ret
+
+00803edf <__udivdi3>:
+  803edf:	57                   	push   %edi
+  803ee0:	56                   	push   %esi
+  803ee1:	53                   	push   %ebx
+  803ee2:	83 ec 20             	sub    $0x20,%esp
+  803ee5:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803ee9:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803eed:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803ef1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803ef5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803ef9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803efd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f01:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f05:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f14:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f1b:	00 
+  803f1c:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f23:	00 
+  803f24:	eb 08                	jmp    803f2e <__udivdi3+0x4f>
+  803f26:	83 e9 01             	sub    $0x1,%ecx
+  803f29:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f2c:	74 68                	je     803f96 <__udivdi3+0xb7>
+  803f2e:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f32:	01 c0                	add    %eax,%eax
+  803f34:	89 c6                	mov    %eax,%esi
+  803f36:	89 d7                	mov    %edx,%edi
+  803f38:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f3c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803f40:	0f ad d0             	shrd   %cl,%edx,%eax
+  803f43:	d3 ea                	shr    %cl,%edx
+  803f45:	f6 c1 20             	test   $0x20,%cl
+  803f48:	74 04                	je     803f4e <__udivdi3+0x6f>
+  803f4a:	89 d0                	mov    %edx,%eax
+  803f4c:	31 d2                	xor    %edx,%edx
+  803f4e:	83 e0 01             	and    $0x1,%eax
+  803f51:	89 04 24             	mov    %eax,(%esp)
+  803f54:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f5b:	00 
+  803f5c:	8b 04 24             	mov    (%esp),%eax
+  803f5f:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f63:	09 f0                	or     %esi,%eax
+  803f65:	09 fa                	or     %edi,%edx
+  803f67:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f6b:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f6f:	39 f0                	cmp    %esi,%eax
+  803f71:	89 d3                	mov    %edx,%ebx
+  803f73:	19 fb                	sbb    %edi,%ebx
+  803f75:	72 af                	jb     803f26 <__udivdi3+0x47>
+  803f77:	29 f0                	sub    %esi,%eax
+  803f79:	19 fa                	sbb    %edi,%edx
+  803f7b:	89 cf                	mov    %ecx,%edi
+  803f7d:	c1 ef 05             	shr    $0x5,%edi
+  803f80:	83 e7 01             	and    $0x1,%edi
+  803f83:	89 fe                	mov    %edi,%esi
+  803f85:	83 f6 01             	xor    $0x1,%esi
+  803f88:	d3 e6                	shl    %cl,%esi
+  803f8a:	d3 e7                	shl    %cl,%edi
+  803f8c:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f90:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f94:	eb 90                	jmp    803f26 <__udivdi3+0x47>
+  803f96:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f9a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f9e:	83 c4 20             	add    $0x20,%esp
+  803fa1:	5b                   	pop    %ebx
+  803fa2:	5e                   	pop    %esi
+  803fa3:	5f                   	pop    %edi
+  803fa4:	c3                   	ret
+
+00803fa5 <__umoddi3>:
+  803fa5:	57                   	push   %edi
+  803fa6:	56                   	push   %esi
+  803fa7:	53                   	push   %ebx
+  803fa8:	83 ec 08             	sub    $0x8,%esp
+  803fab:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803faf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fb3:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803fb7:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803fbb:	57                   	push   %edi
+  803fbc:	56                   	push   %esi
+  803fbd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803fc1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803fc5:	52                   	push   %edx
+  803fc6:	50                   	push   %eax
+  803fc7:	e8 13 ff ff ff       	call   803edf <__udivdi3>
+  803fcc:	89 c3                	mov    %eax,%ebx
+  803fce:	0f af d6             	imul   %esi,%edx
+  803fd1:	89 f9                	mov    %edi,%ecx
+  803fd3:	0f af cb             	imul   %ebx,%ecx
+  803fd6:	01 d1                	add    %edx,%ecx
+  803fd8:	89 d8                	mov    %ebx,%eax
+  803fda:	f7 e6                	mul    %esi
+  803fdc:	89 c6                	mov    %eax,%esi
+  803fde:	89 d7                	mov    %edx,%edi
+  803fe0:	01 cf                	add    %ecx,%edi
+  803fe2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803fe6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803fea:	29 f0                	sub    %esi,%eax
+  803fec:	19 fa                	sbb    %edi,%edx
+  803fee:	83 c4 18             	add    $0x18,%esp
+  803ff1:	5b                   	pop    %ebx
+  803ff2:	5e                   	pop    %esi
+  803ff3:	5f                   	pop    %edi
+  803ff4:	c3                   	ret
+
+00803ff5 <__divdi3>:
+  803ff5:	53                   	push   %ebx
+  803ff6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ffa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ffe:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804002:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804006:	85 d2                	test   %edx,%edx
+  804008:	78 12                	js     80401c <__divdi3+0x27>
+  80400a:	85 db                	test   %ebx,%ebx
+  80400c:	78 2e                	js     80403c <__divdi3+0x47>
+  80400e:	53                   	push   %ebx
+  80400f:	51                   	push   %ecx
+  804010:	52                   	push   %edx
+  804011:	50                   	push   %eax
+  804012:	e8 c8 fe ff ff       	call   803edf <__udivdi3>
+  804017:	83 c4 10             	add    $0x10,%esp
+  80401a:	eb 1e                	jmp    80403a <__divdi3+0x45>
+  80401c:	f7 d8                	neg    %eax
+  80401e:	83 d2 00             	adc    $0x0,%edx
+  804021:	f7 da                	neg    %edx
+  804023:	85 db                	test   %ebx,%ebx
+  804025:	78 2a                	js     804051 <__divdi3+0x5c>
+  804027:	53                   	push   %ebx
+  804028:	51                   	push   %ecx
+  804029:	52                   	push   %edx
+  80402a:	50                   	push   %eax
+  80402b:	e8 af fe ff ff       	call   803edf <__udivdi3>
+  804030:	83 c4 10             	add    $0x10,%esp
+  804033:	f7 d8                	neg    %eax
+  804035:	83 d2 00             	adc    $0x0,%edx
+  804038:	f7 da                	neg    %edx
+  80403a:	5b                   	pop    %ebx
+  80403b:	c3                   	ret
+  80403c:	f7 d9                	neg    %ecx
+  80403e:	83 d3 00             	adc    $0x0,%ebx
+  804041:	f7 db                	neg    %ebx
+  804043:	53                   	push   %ebx
+  804044:	51                   	push   %ecx
+  804045:	52                   	push   %edx
+  804046:	50                   	push   %eax
+  804047:	e8 93 fe ff ff       	call   803edf <__udivdi3>
+  80404c:	83 c4 10             	add    $0x10,%esp
+  80404f:	eb e2                	jmp    804033 <__divdi3+0x3e>
+  804051:	f7 d9                	neg    %ecx
+  804053:	83 d3 00             	adc    $0x0,%ebx
+  804056:	f7 db                	neg    %ebx
+  804058:	53                   	push   %ebx
+  804059:	51                   	push   %ecx
+  80405a:	52                   	push   %edx
+  80405b:	50                   	push   %eax
+  80405c:	e8 7e fe ff ff       	call   803edf <__udivdi3>
+  804061:	83 c4 10             	add    $0x10,%esp
+  804064:	eb d4                	jmp    80403a <__divdi3+0x45>
+
+00804066 <__moddi3>:
+  804066:	57                   	push   %edi
+  804067:	56                   	push   %esi
+  804068:	53                   	push   %ebx
+  804069:	83 ec 08             	sub    $0x8,%esp
+  80406c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804070:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804074:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804078:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80407c:	57                   	push   %edi
+  80407d:	56                   	push   %esi
+  80407e:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804082:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804086:	52                   	push   %edx
+  804087:	50                   	push   %eax
+  804088:	e8 68 ff ff ff       	call   803ff5 <__divdi3>
+  80408d:	89 c3                	mov    %eax,%ebx
+  80408f:	0f af d6             	imul   %esi,%edx
+  804092:	89 f9                	mov    %edi,%ecx
+  804094:	0f af cb             	imul   %ebx,%ecx
+  804097:	01 d1                	add    %edx,%ecx
+  804099:	89 d8                	mov    %ebx,%eax
+  80409b:	f7 e6                	mul    %esi
+  80409d:	89 c6                	mov    %eax,%esi
+  80409f:	89 d7                	mov    %edx,%edi
+  8040a1:	01 cf                	add    %ecx,%edi
+  8040a3:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8040a7:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8040ab:	29 f0                	sub    %esi,%eax
+  8040ad:	19 fa                	sbb    %edi,%edx
+  8040af:	83 c4 18             	add    $0x18,%esp
+  8040b2:	5b                   	pop    %ebx
+  8040b3:	5e                   	pop    %esi
+  8040b4:	5f                   	pop    %edi
+  8040b5:	c3                   	ret
@@ -0,0 +1,8242 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8d 02 00 00       	call   8002be <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 04             	sub    $0x4,%esp
+  80003c:	bb 0a 00 00 00       	mov    $0xa,%ebx
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+		sys_yield();
+  800041:	e8 f6 0f 00 00       	call   80103c <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xc>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 25 16 00 00       	call   80167a <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 12 02 00 00       	call   80026c <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x40>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x52>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 3c 3d 80 00       	push   $0x803d3c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 2d 3d 80 00       	push   $0x803d2d
+  800070:	e8 f0 02 00 00       	call   800365 <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 20 3d 80 00       	push   $0x803d20
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 2d 3d 80 00       	push   $0x803d2d
+  800082:	e8 de 02 00 00       	call   800365 <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 3c 16 00 00       	call   8016cf <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8a>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 56 3d 80 00       	push   $0x803d56
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 2d 3d 80 00       	push   $0x803d2d
+  8000a7:	e8 b9 02 00 00       	call   800365 <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 6c 3d 80 00       	push   $0x803d6c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 5b 1e 00 00       	call   801f17 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 5e 3d 80 00       	push   $0x803d5e
+  8000c7:	e8 1f 0a 00 00       	call   800aeb <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x77>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 70 3d 80 00       	push   $0x803d70
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 35 1e 00 00       	call   801f17 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8a>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_poll>:
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 04             	sub    $0x4,%esp
+  8000f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8000f7:	89 da                	mov    %ebx,%edx
+  8000f9:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8000fc:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  800103:	74 0c                	je     800111 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800105:	89 d8                	mov    %ebx,%eax
+  800107:	83 e0 01             	and    $0x1,%eax
+  80010a:	09 d0                	or     %edx,%eax
+}
+  80010c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80010f:	c9                   	leave
+  800110:	c3                   	ret
+		cons_peek = sys_cgetc();
+  800111:	e8 a7 0e 00 00       	call   800fbd <sys_cgetc>
+  800116:	a3 00 60 80 00       	mov    %eax,0x806000
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80011b:	89 da                	mov    %ebx,%edx
+  80011d:	83 e2 04             	and    $0x4,%edx
+  800120:	85 c0                	test   %eax,%eax
+  800122:	74 e6                	je     80010a <devcons_poll+0x1d>
+  800124:	eb df                	jmp    800105 <devcons_poll+0x18>
+
+00800126 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800126:	55                   	push   %ebp
+  800127:	89 e5                	mov    %esp,%ebp
+  800129:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80012c:	68 88 3d 80 00       	push   $0x803d88
+  800131:	ff 75 0c             	push   0xc(%ebp)
+  800134:	e8 ee 0a 00 00       	call   800c27 <strcpy>
+	return 0;
+}
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	c9                   	leave
+  80013f:	c3                   	ret
+
+00800140 <devcons_write>:
+{
+  800140:	55                   	push   %ebp
+  800141:	89 e5                	mov    %esp,%ebp
+  800143:	57                   	push   %edi
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  800146:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80014c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80014f:	85 ff                	test   %edi,%edi
+  800151:	74 51                	je     8001a4 <devcons_write+0x64>
+  800153:	be 00 00 00 00       	mov    $0x0,%esi
+  800158:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80015d:	89 fb                	mov    %edi,%ebx
+  80015f:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  800161:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  800166:	39 d3                	cmp    %edx,%ebx
+  800168:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80016b:	83 ec 04             	sub    $0x4,%esp
+  80016e:	53                   	push   %ebx
+  80016f:	03 45 0c             	add    0xc(%ebp),%eax
+  800172:	50                   	push   %eax
+  800173:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800179:	50                   	push   %eax
+  80017a:	e8 58 0c 00 00       	call   800dd7 <memmove>
+		sys_cputs(buf, m);
+  80017f:	83 c4 08             	add    $0x8,%esp
+  800182:	53                   	push   %ebx
+  800183:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800189:	50                   	push   %eax
+  80018a:	e8 10 0e 00 00       	call   800f9f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80018f:	01 de                	add    %ebx,%esi
+  800191:	89 f0                	mov    %esi,%eax
+  800193:	83 c4 10             	add    $0x10,%esp
+  800196:	39 fe                	cmp    %edi,%esi
+  800198:	72 c3                	jb     80015d <devcons_write+0x1d>
+}
+  80019a:	89 f0                	mov    %esi,%eax
+  80019c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019f:	5b                   	pop    %ebx
+  8001a0:	5e                   	pop    %esi
+  8001a1:	5f                   	pop    %edi
+  8001a2:	5d                   	pop    %ebp
+  8001a3:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8001a9:	eb ef                	jmp    80019a <devcons_write+0x5a>
+
+008001ab <devcons_read>:
+{
+  8001ab:	55                   	push   %ebp
+  8001ac:	89 e5                	mov    %esp,%ebp
+  8001ae:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8001b1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8001b6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8001ba:	74 36                	je     8001f2 <devcons_read+0x47>
+	c = cons_peek;
+  8001bc:	a1 00 60 80 00       	mov    0x806000,%eax
+	cons_peek = 0;
+  8001c1:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8001c8:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	75 10                	jne    8001df <devcons_read+0x34>
+  8001cf:	e8 e9 0d 00 00       	call   800fbd <sys_cgetc>
+  8001d4:	85 c0                	test   %eax,%eax
+  8001d6:	75 07                	jne    8001df <devcons_read+0x34>
+		sys_yield();
+  8001d8:	e8 5f 0e 00 00       	call   80103c <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8001dd:	eb f0                	jmp    8001cf <devcons_read+0x24>
+	if (c < 0)
+  8001df:	85 c0                	test   %eax,%eax
+  8001e1:	78 0f                	js     8001f2 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8001e3:	83 f8 04             	cmp    $0x4,%eax
+  8001e6:	74 0c                	je     8001f4 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8001e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001eb:	88 02                	mov    %al,(%edx)
+	return 1;
+  8001ed:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8001f2:	c9                   	leave
+  8001f3:	c3                   	ret
+		return 0;
+  8001f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f9:	eb f7                	jmp    8001f2 <devcons_read+0x47>
+
+008001fb <cputchar>:
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800201:	8b 45 08             	mov    0x8(%ebp),%eax
+  800204:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800207:	6a 01                	push   $0x1
+  800209:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	e8 8d 0d 00 00       	call   800f9f <sys_cputs>
+}
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	c9                   	leave
+  800216:	c3                   	ret
+
+00800217 <getchar>:
+{
+  800217:	55                   	push   %ebp
+  800218:	89 e5                	mov    %esp,%ebp
+  80021a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80021d:	6a 01                	push   $0x1
+  80021f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800222:	50                   	push   %eax
+  800223:	6a 00                	push   $0x0
+  800225:	e8 8f 15 00 00       	call   8017b9 <read>
+	if (r < 0)
+  80022a:	83 c4 10             	add    $0x10,%esp
+  80022d:	85 c0                	test   %eax,%eax
+  80022f:	78 06                	js     800237 <getchar+0x20>
+	if (r < 1)
+  800231:	74 06                	je     800239 <getchar+0x22>
+	return c;
+  800233:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+		return -E_EOF;
+  800239:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80023e:	eb f7                	jmp    800237 <getchar+0x20>
+
+00800240 <iscons>:
+{
+  800240:	55                   	push   %ebp
+  800241:	89 e5                	mov    %esp,%ebp
+  800243:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800246:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800249:	50                   	push   %eax
+  80024a:	ff 75 08             	push   0x8(%ebp)
+  80024d:	e8 e3 12 00 00       	call   801535 <fd_lookup>
+  800252:	83 c4 10             	add    $0x10,%esp
+  800255:	85 c0                	test   %eax,%eax
+  800257:	78 11                	js     80026a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800259:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80025c:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800262:	39 10                	cmp    %edx,(%eax)
+  800264:	0f 94 c0             	sete   %al
+  800267:	0f b6 c0             	movzbl %al,%eax
+}
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+0080026c <opencons>:
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800272:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800275:	50                   	push   %eax
+  800276:	e8 6a 12 00 00       	call   8014e5 <fd_alloc>
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 3a                	js     8002bc <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800282:	83 ec 04             	sub    $0x4,%esp
+  800285:	68 07 04 00 00       	push   $0x407
+  80028a:	ff 75 f4             	push   -0xc(%ebp)
+  80028d:	6a 00                	push   $0x0
+  80028f:	e8 c7 0d 00 00       	call   80105b <sys_page_alloc>
+  800294:	83 c4 10             	add    $0x10,%esp
+  800297:	85 c0                	test   %eax,%eax
+  800299:	78 21                	js     8002bc <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80029b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80029e:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8002a4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8002a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8002a9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	e8 05 12 00 00       	call   8014be <fd2num>
+  8002b9:	83 c4 10             	add    $0x10,%esp
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+008002be <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	56                   	push   %esi
+  8002c2:	53                   	push   %ebx
+  8002c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c6:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002c9:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8002cb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002d0:	29 d0                	sub    %edx,%eax
+  8002d2:	89 c2                	mov    %eax,%edx
+  8002d4:	c1 ea 0f             	shr    $0xf,%edx
+  8002d7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8002dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e1:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8002e4:	c7 04 85 60 67 80 00 	movl   $0x0,0x806760(,%eax,4)
+  8002eb:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8002ef:	e8 29 0d 00 00       	call   80101d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8002f4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002f9:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8002ff:	89 e1                	mov    %esp,%ecx
+  800301:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800306:	29 ca                	sub    %ecx,%edx
+  800308:	89 d1                	mov    %edx,%ecx
+  80030a:	c1 e9 0f             	shr    $0xf,%ecx
+  80030d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800313:	ba 00 00 00 00       	mov    $0x0,%edx
+  800318:	0f 42 d1             	cmovb  %ecx,%edx
+  80031b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800320:	89 04 95 60 67 80 00 	mov    %eax,0x806760(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800327:	85 db                	test   %ebx,%ebx
+  800329:	7e 07                	jle    800332 <libmain+0x74>
+		binaryname = argv[0];
+  80032b:	8b 06                	mov    (%esi),%eax
+  80032d:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	// call user main routine
+	umain(argc, argv);
+  800332:	83 ec 08             	sub    $0x8,%esp
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	e8 f9 fc ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  80033c:	e8 0a 00 00 00       	call   80034b <exit>
+}
+  800341:	83 c4 10             	add    $0x10,%esp
+  800344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800347:	5b                   	pop    %ebx
+  800348:	5e                   	pop    %esi
+  800349:	5d                   	pop    %ebp
+  80034a:	c3                   	ret
+
+0080034b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80034b:	55                   	push   %ebp
+  80034c:	89 e5                	mov    %esp,%ebp
+  80034e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800351:	e8 51 13 00 00       	call   8016a7 <close_all>
+	sys_env_destroy(0);
+  800356:	83 ec 0c             	sub    $0xc,%esp
+  800359:	6a 00                	push   $0x0
+  80035b:	e8 7c 0c 00 00       	call   800fdc <sys_env_destroy>
+}
+  800360:	83 c4 10             	add    $0x10,%esp
+  800363:	c9                   	leave
+  800364:	c3                   	ret
+
+00800365 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800365:	55                   	push   %ebp
+  800366:	89 e5                	mov    %esp,%ebp
+  800368:	56                   	push   %esi
+  800369:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80036a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80036d:	8b 35 20 50 80 00    	mov    0x805020,%esi
+  800373:	e8 a5 0c 00 00       	call   80101d <sys_getenvid>
+  800378:	83 ec 0c             	sub    $0xc,%esp
+  80037b:	ff 75 0c             	push   0xc(%ebp)
+  80037e:	ff 75 08             	push   0x8(%ebp)
+  800381:	56                   	push   %esi
+  800382:	50                   	push   %eax
+  800383:	68 a0 3d 80 00       	push   $0x803da0
+  800388:	e8 b3 00 00 00       	call   800440 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80038d:	83 c4 18             	add    $0x18,%esp
+  800390:	53                   	push   %ebx
+  800391:	ff 75 10             	push   0x10(%ebp)
+  800394:	e8 56 00 00 00       	call   8003ef <vcprintf>
+	cprintf("\n");
+  800399:	c7 04 24 86 3d 80 00 	movl   $0x803d86,(%esp)
+  8003a0:	e8 9b 00 00 00       	call   800440 <cprintf>
+  8003a5:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003a8:	cc                   	int3
+	while (1)
+  8003a9:	eb fd                	jmp    8003a8 <_panic+0x43>
+
+008003ab <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	53                   	push   %ebx
+  8003af:	83 ec 04             	sub    $0x4,%esp
+  8003b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003b5:	8b 13                	mov    (%ebx),%edx
+  8003b7:	8d 42 01             	lea    0x1(%edx),%eax
+  8003ba:	89 03                	mov    %eax,(%ebx)
+  8003bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003bf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003c3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003c8:	74 09                	je     8003d3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003ca:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003d1:	c9                   	leave
+  8003d2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003d3:	83 ec 08             	sub    $0x8,%esp
+  8003d6:	68 ff 00 00 00       	push   $0xff
+  8003db:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003de:	50                   	push   %eax
+  8003df:	e8 bb 0b 00 00       	call   800f9f <sys_cputs>
+		b->idx = 0;
+  8003e4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ea:	83 c4 10             	add    $0x10,%esp
+  8003ed:	eb db                	jmp    8003ca <putch+0x1f>
+
+008003ef <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003f8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003ff:	00 00 00 
+	b.cnt = 0;
+  800402:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800409:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80040c:	ff 75 0c             	push   0xc(%ebp)
+  80040f:	ff 75 08             	push   0x8(%ebp)
+  800412:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800418:	50                   	push   %eax
+  800419:	68 ab 03 80 00       	push   $0x8003ab
+  80041e:	e8 1c 01 00 00       	call   80053f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800423:	83 c4 08             	add    $0x8,%esp
+  800426:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80042c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800432:	50                   	push   %eax
+  800433:	e8 67 0b 00 00       	call   800f9f <sys_cputs>
+
+	return b.cnt;
+}
+  800438:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80043e:	c9                   	leave
+  80043f:	c3                   	ret
+
+00800440 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800440:	55                   	push   %ebp
+  800441:	89 e5                	mov    %esp,%ebp
+  800443:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800446:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800449:	50                   	push   %eax
+  80044a:	ff 75 08             	push   0x8(%ebp)
+  80044d:	e8 9d ff ff ff       	call   8003ef <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+
+00800454 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800454:	55                   	push   %ebp
+  800455:	89 e5                	mov    %esp,%ebp
+  800457:	57                   	push   %edi
+  800458:	56                   	push   %esi
+  800459:	53                   	push   %ebx
+  80045a:	83 ec 1c             	sub    $0x1c,%esp
+  80045d:	89 c3                	mov    %eax,%ebx
+  80045f:	89 d6                	mov    %edx,%esi
+  800461:	8b 45 08             	mov    0x8(%ebp),%eax
+  800464:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800467:	89 d1                	mov    %edx,%ecx
+  800469:	89 c2                	mov    %eax,%edx
+  80046b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80046e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800471:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800474:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800477:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80047e:	39 c2                	cmp    %eax,%edx
+  800480:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800483:	73 4b                	jae    8004d0 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  800485:	8b 45 14             	mov    0x14(%ebp),%eax
+  800488:	8d 78 ff             	lea    -0x1(%eax),%edi
+  80048b:	85 ff                	test   %edi,%edi
+  80048d:	7e 11                	jle    8004a0 <printnum+0x4c>
+			putch(padc, putdat);
+  80048f:	83 ec 08             	sub    $0x8,%esp
+  800492:	56                   	push   %esi
+  800493:	ff 75 18             	push   0x18(%ebp)
+  800496:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800498:	83 c4 10             	add    $0x10,%esp
+  80049b:	83 ef 01             	sub    $0x1,%edi
+  80049e:	75 ef                	jne    80048f <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004a0:	83 ec 08             	sub    $0x8,%esp
+  8004a3:	56                   	push   %esi
+  8004a4:	83 ec 04             	sub    $0x4,%esp
+  8004a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8004aa:	ff 75 e0             	push   -0x20(%ebp)
+  8004ad:	ff 75 dc             	push   -0x24(%ebp)
+  8004b0:	ff 75 d8             	push   -0x28(%ebp)
+  8004b3:	e8 57 37 00 00       	call   803c0f <__umoddi3>
+  8004b8:	83 c4 14             	add    $0x14,%esp
+  8004bb:	0f be 80 c3 3d 80 00 	movsbl 0x803dc3(%eax),%eax
+  8004c2:	50                   	push   %eax
+  8004c3:	ff d3                	call   *%ebx
+}
+  8004c5:	83 c4 10             	add    $0x10,%esp
+  8004c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004cb:	5b                   	pop    %ebx
+  8004cc:	5e                   	pop    %esi
+  8004cd:	5f                   	pop    %edi
+  8004ce:	5d                   	pop    %ebp
+  8004cf:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	ff 75 18             	push   0x18(%ebp)
+  8004d6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004d9:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8004dc:	52                   	push   %edx
+  8004dd:	50                   	push   %eax
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	ff 75 e4             	push   -0x1c(%ebp)
+  8004e4:	ff 75 e0             	push   -0x20(%ebp)
+  8004e7:	ff 75 dc             	push   -0x24(%ebp)
+  8004ea:	ff 75 d8             	push   -0x28(%ebp)
+  8004ed:	e8 57 36 00 00       	call   803b49 <__udivdi3>
+  8004f2:	83 c4 18             	add    $0x18,%esp
+  8004f5:	52                   	push   %edx
+  8004f6:	50                   	push   %eax
+  8004f7:	89 f2                	mov    %esi,%edx
+  8004f9:	89 d8                	mov    %ebx,%eax
+  8004fb:	e8 54 ff ff ff       	call   800454 <printnum>
+  800500:	83 c4 20             	add    $0x20,%esp
+  800503:	eb 9b                	jmp    8004a0 <printnum+0x4c>
+
+00800505 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800505:	55                   	push   %ebp
+  800506:	89 e5                	mov    %esp,%ebp
+  800508:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80050b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80050f:	8b 10                	mov    (%eax),%edx
+  800511:	3b 50 04             	cmp    0x4(%eax),%edx
+  800514:	73 0a                	jae    800520 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800516:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800519:	89 08                	mov    %ecx,(%eax)
+  80051b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80051e:	88 02                	mov    %al,(%edx)
+}
+  800520:	5d                   	pop    %ebp
+  800521:	c3                   	ret
+
+00800522 <printfmt>:
+{
+  800522:	55                   	push   %ebp
+  800523:	89 e5                	mov    %esp,%ebp
+  800525:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800528:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80052b:	50                   	push   %eax
+  80052c:	ff 75 10             	push   0x10(%ebp)
+  80052f:	ff 75 0c             	push   0xc(%ebp)
+  800532:	ff 75 08             	push   0x8(%ebp)
+  800535:	e8 05 00 00 00       	call   80053f <vprintfmt>
+}
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	c9                   	leave
+  80053e:	c3                   	ret
+
+0080053f <vprintfmt>:
+{
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	57                   	push   %edi
+  800543:	56                   	push   %esi
+  800544:	53                   	push   %ebx
+  800545:	83 ec 2c             	sub    $0x2c,%esp
+  800548:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80054b:	89 df                	mov    %ebx,%edi
+  80054d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800550:	8b 45 10             	mov    0x10(%ebp),%eax
+  800553:	8d 70 01             	lea    0x1(%eax),%esi
+  800556:	0f b6 00             	movzbl (%eax),%eax
+  800559:	83 f8 25             	cmp    $0x25,%eax
+  80055c:	74 1e                	je     80057c <vprintfmt+0x3d>
+			if (ch == '\0')
+  80055e:	85 c0                	test   %eax,%eax
+  800560:	0f 84 15 05 00 00    	je     800a7b <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800566:	83 ec 08             	sub    $0x8,%esp
+  800569:	53                   	push   %ebx
+  80056a:	50                   	push   %eax
+  80056b:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80056d:	83 c6 01             	add    $0x1,%esi
+  800570:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	83 f8 25             	cmp    $0x25,%eax
+  80057a:	75 e2                	jne    80055e <vprintfmt+0x1f>
+		padc = ' ';
+  80057c:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800580:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800587:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  80058e:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  800595:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80059a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80059d:	8d 56 01             	lea    0x1(%esi),%edx
+  8005a0:	0f b6 0e             	movzbl (%esi),%ecx
+  8005a3:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005a6:	3c 55                	cmp    $0x55,%al
+  8005a8:	0f 87 3b 04 00 00    	ja     8009e9 <vprintfmt+0x4aa>
+  8005ae:	0f b6 c0             	movzbl %al,%eax
+  8005b1:	ff 24 85 40 3f 80 00 	jmp    *0x803f40(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005b8:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005bb:	eb 93                	jmp    800550 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005bd:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005bf:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005c3:	eb d8                	jmp    80059d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c5:	89 d6                	mov    %edx,%esi
+  8005c7:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005cb:	eb d0                	jmp    80059d <vprintfmt+0x5e>
+  8005cd:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005d0:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8005d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8005d6:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8005da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8005dd:	83 f9 09             	cmp    $0x9,%ecx
+  8005e0:	77 6f                	ja     800651 <vprintfmt+0x112>
+  8005e2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8005e5:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8005e8:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8005eb:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8005ef:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8005f2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005f5:	83 fe 09             	cmp    $0x9,%esi
+  8005f8:	76 eb                	jbe    8005e5 <vprintfmt+0xa6>
+  8005fa:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8005fd:	89 d6                	mov    %edx,%esi
+  8005ff:	eb 13                	jmp    800614 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 00                	mov    (%eax),%eax
+  800606:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8d 40 04             	lea    0x4(%eax),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800612:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800614:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800618:	79 83                	jns    80059d <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80061a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80061d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800620:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800627:	e9 71 ff ff ff       	jmp    80059d <vprintfmt+0x5e>
+			if (width < 0)
+  80062c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80062f:	85 c9                	test   %ecx,%ecx
+  800631:	b8 00 00 00 00       	mov    $0x0,%eax
+  800636:	0f 49 c1             	cmovns %ecx,%eax
+  800639:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80063c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80063e:	e9 5a ff ff ff       	jmp    80059d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800643:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800645:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80064c:	e9 4c ff ff ff       	jmp    80059d <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800651:	89 d6                	mov    %edx,%esi
+  800653:	eb bf                	jmp    800614 <vprintfmt+0xd5>
+			lflag++;
+  800655:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800659:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80065b:	e9 3d ff ff ff       	jmp    80059d <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800660:	89 55 10             	mov    %edx,0x10(%ebp)
+  800663:	8b 45 14             	mov    0x14(%ebp),%eax
+  800666:	8d 70 04             	lea    0x4(%eax),%esi
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	ff 30                	push   (%eax)
+  80066f:	ff d7                	call   *%edi
+			break;
+  800671:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800674:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800677:	e9 d4 fe ff ff       	jmp    800550 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  80067c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  800685:	8b 10                	mov    (%eax),%edx
+  800687:	89 d0                	mov    %edx,%eax
+  800689:	f7 d8                	neg    %eax
+  80068b:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80068e:	83 f8 12             	cmp    $0x12,%eax
+  800691:	7f 23                	jg     8006b6 <vprintfmt+0x177>
+  800693:	8b 14 85 a0 40 80 00 	mov    0x8040a0(,%eax,4),%edx
+  80069a:	85 d2                	test   %edx,%edx
+  80069c:	74 18                	je     8006b6 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  80069e:	52                   	push   %edx
+  80069f:	68 0b 42 80 00       	push   $0x80420b
+  8006a4:	53                   	push   %ebx
+  8006a5:	57                   	push   %edi
+  8006a6:	e8 77 fe ff ff       	call   800522 <printfmt>
+  8006ab:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006ae:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006b1:	e9 9a fe ff ff       	jmp    800550 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006b6:	50                   	push   %eax
+  8006b7:	68 db 3d 80 00       	push   $0x803ddb
+  8006bc:	53                   	push   %ebx
+  8006bd:	57                   	push   %edi
+  8006be:	e8 5f fe ff ff       	call   800522 <printfmt>
+  8006c3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006c6:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006c9:	e9 82 fe ff ff       	jmp    800550 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006ce:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	83 c0 04             	add    $0x4,%eax
+  8006d7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 00                	mov    (%eax),%eax
+  8006df:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006e2:	85 c0                	test   %eax,%eax
+  8006e4:	0f 84 61 03 00 00    	je     800a4b <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8006ea:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006ee:	7e 06                	jle    8006f6 <vprintfmt+0x1b7>
+  8006f0:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8006f4:	75 29                	jne    80071f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006f6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006f9:	8d 70 01             	lea    0x1(%eax),%esi
+  8006fc:	0f b6 00             	movzbl (%eax),%eax
+  8006ff:	0f be d0             	movsbl %al,%edx
+  800702:	85 d2                	test   %edx,%edx
+  800704:	0f 84 bb 00 00 00    	je     8007c5 <vprintfmt+0x286>
+  80070a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80070d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800710:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800713:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800716:	eb 7a                	jmp    800792 <vprintfmt+0x253>
+				p = "(null)";
+  800718:	c7 45 d0 d4 3d 80 00 	movl   $0x803dd4,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80071f:	83 ec 08             	sub    $0x8,%esp
+  800722:	ff 75 d4             	push   -0x2c(%ebp)
+  800725:	ff 75 d0             	push   -0x30(%ebp)
+  800728:	e8 d0 04 00 00       	call   800bfd <strnlen>
+  80072d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800730:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	85 d2                	test   %edx,%edx
+  800738:	0f 8e d6 02 00 00    	jle    800a14 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80073e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800742:	83 ec 08             	sub    $0x8,%esp
+  800745:	53                   	push   %ebx
+  800746:	56                   	push   %esi
+  800747:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800749:	83 c4 10             	add    $0x10,%esp
+  80074c:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800750:	75 f0                	jne    800742 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800752:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800755:	8d 70 01             	lea    0x1(%eax),%esi
+  800758:	0f b6 00             	movzbl (%eax),%eax
+  80075b:	0f be d0             	movsbl %al,%edx
+  80075e:	85 d2                	test   %edx,%edx
+  800760:	0f 84 da 02 00 00    	je     800a40 <vprintfmt+0x501>
+  800766:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800769:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80076c:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80076f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800772:	eb 1e                	jmp    800792 <vprintfmt+0x253>
+					putch(ch, putdat);
+  800774:	83 ec 08             	sub    $0x8,%esp
+  800777:	ff 75 0c             	push   0xc(%ebp)
+  80077a:	52                   	push   %edx
+  80077b:	ff 55 08             	call   *0x8(%ebp)
+  80077e:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800781:	83 eb 01             	sub    $0x1,%ebx
+  800784:	83 c6 01             	add    $0x1,%esi
+  800787:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80078b:	0f be d0             	movsbl %al,%edx
+  80078e:	85 d2                	test   %edx,%edx
+  800790:	74 2a                	je     8007bc <vprintfmt+0x27d>
+  800792:	85 ff                	test   %edi,%edi
+  800794:	78 05                	js     80079b <vprintfmt+0x25c>
+  800796:	83 ef 01             	sub    $0x1,%edi
+  800799:	78 59                	js     8007f4 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80079b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80079f:	74 d3                	je     800774 <vprintfmt+0x235>
+  8007a1:	0f be c0             	movsbl %al,%eax
+  8007a4:	83 e8 20             	sub    $0x20,%eax
+  8007a7:	83 f8 5e             	cmp    $0x5e,%eax
+  8007aa:	76 c8                	jbe    800774 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007ac:	83 ec 08             	sub    $0x8,%esp
+  8007af:	ff 75 0c             	push   0xc(%ebp)
+  8007b2:	6a 3f                	push   $0x3f
+  8007b4:	ff 55 08             	call   *0x8(%ebp)
+  8007b7:	83 c4 10             	add    $0x10,%esp
+  8007ba:	eb c5                	jmp    800781 <vprintfmt+0x242>
+  8007bc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007c5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007c8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007cc:	7e 1b                	jle    8007e9 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007ce:	83 ec 08             	sub    $0x8,%esp
+  8007d1:	53                   	push   %ebx
+  8007d2:	6a 20                	push   $0x20
+  8007d4:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8007d6:	83 c4 10             	add    $0x10,%esp
+  8007d9:	83 ee 01             	sub    $0x1,%esi
+  8007dc:	75 f0                	jne    8007ce <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8007de:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e4:	e9 67 fd ff ff       	jmp    800550 <vprintfmt+0x11>
+  8007e9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ef:	e9 5c fd ff ff       	jmp    800550 <vprintfmt+0x11>
+  8007f4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007fd:	eb c6                	jmp    8007c5 <vprintfmt+0x286>
+	if (lflag >= 2)
+  8007ff:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800802:	89 55 10             	mov    %edx,0x10(%ebp)
+  800805:	83 f9 01             	cmp    $0x1,%ecx
+  800808:	7f 1f                	jg     800829 <vprintfmt+0x2ea>
+	else if (lflag)
+  80080a:	85 c9                	test   %ecx,%ecx
+  80080c:	74 67                	je     800875 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 30                	mov    (%eax),%esi
+  800813:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800816:	89 f0                	mov    %esi,%eax
+  800818:	c1 f8 1f             	sar    $0x1f,%eax
+  80081b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8d 40 04             	lea    0x4(%eax),%eax
+  800824:	89 45 14             	mov    %eax,0x14(%ebp)
+  800827:	eb 17                	jmp    800840 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8b 50 04             	mov    0x4(%eax),%edx
+  80082f:	8b 00                	mov    (%eax),%eax
+  800831:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800834:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8d 40 08             	lea    0x8(%eax),%eax
+  80083d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800840:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800843:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800846:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  80084b:	85 c9                	test   %ecx,%ecx
+  80084d:	0f 89 12 01 00 00    	jns    800965 <vprintfmt+0x426>
+				putch('-', putdat);
+  800853:	83 ec 08             	sub    $0x8,%esp
+  800856:	53                   	push   %ebx
+  800857:	6a 2d                	push   $0x2d
+  800859:	ff d7                	call   *%edi
+				num = -(long long) num;
+  80085b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80085e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800861:	f7 da                	neg    %edx
+  800863:	83 d1 00             	adc    $0x0,%ecx
+  800866:	f7 d9                	neg    %ecx
+  800868:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80086b:	be 0a 00 00 00       	mov    $0xa,%esi
+  800870:	e9 f0 00 00 00       	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800875:	8b 45 14             	mov    0x14(%ebp),%eax
+  800878:	8b 30                	mov    (%eax),%esi
+  80087a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80087d:	89 f0                	mov    %esi,%eax
+  80087f:	c1 f8 1f             	sar    $0x1f,%eax
+  800882:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8d 40 04             	lea    0x4(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80088e:	eb b0                	jmp    800840 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800890:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800893:	89 55 10             	mov    %edx,0x10(%ebp)
+  800896:	83 f9 01             	cmp    $0x1,%ecx
+  800899:	7f 1e                	jg     8008b9 <vprintfmt+0x37a>
+	else if (lflag)
+  80089b:	85 c9                	test   %ecx,%ecx
+  80089d:	74 32                	je     8008d1 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8b 10                	mov    (%eax),%edx
+  8008a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008af:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008b4:	e9 ac 00 00 00       	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bc:	8b 10                	mov    (%eax),%edx
+  8008be:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c1:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008c7:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008cc:	e9 94 00 00 00       	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d4:	8b 10                	mov    (%eax),%edx
+  8008d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008db:	8d 40 04             	lea    0x4(%eax),%eax
+  8008de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008e1:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8008e6:	eb 7d                	jmp    800965 <vprintfmt+0x426>
+	if (lflag >= 2)
+  8008e8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008eb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ee:	83 f9 01             	cmp    $0x1,%ecx
+  8008f1:	7f 1b                	jg     80090e <vprintfmt+0x3cf>
+	else if (lflag)
+  8008f3:	85 c9                	test   %ecx,%ecx
+  8008f5:	74 2c                	je     800923 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8008f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fa:	8b 10                	mov    (%eax),%edx
+  8008fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800901:	8d 40 04             	lea    0x4(%eax),%eax
+  800904:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800907:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  80090c:	eb 57                	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80090e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800911:	8b 10                	mov    (%eax),%edx
+  800913:	8b 48 04             	mov    0x4(%eax),%ecx
+  800916:	8d 40 08             	lea    0x8(%eax),%eax
+  800919:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80091c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800921:	eb 42                	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800923:	8b 45 14             	mov    0x14(%ebp),%eax
+  800926:	8b 10                	mov    (%eax),%edx
+  800928:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092d:	8d 40 04             	lea    0x4(%eax),%eax
+  800930:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800933:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800938:	eb 2b                	jmp    800965 <vprintfmt+0x426>
+			putch('0', putdat);
+  80093a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80093d:	83 ec 08             	sub    $0x8,%esp
+  800940:	53                   	push   %ebx
+  800941:	6a 30                	push   $0x30
+  800943:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800945:	83 c4 08             	add    $0x8,%esp
+  800948:	53                   	push   %ebx
+  800949:	6a 78                	push   $0x78
+  80094b:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80094d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800950:	8b 10                	mov    (%eax),%edx
+  800952:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800957:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80095a:	8d 40 04             	lea    0x4(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800960:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800965:	83 ec 0c             	sub    $0xc,%esp
+  800968:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  80096c:	50                   	push   %eax
+  80096d:	ff 75 e4             	push   -0x1c(%ebp)
+  800970:	56                   	push   %esi
+  800971:	51                   	push   %ecx
+  800972:	52                   	push   %edx
+  800973:	89 da                	mov    %ebx,%edx
+  800975:	89 f8                	mov    %edi,%eax
+  800977:	e8 d8 fa ff ff       	call   800454 <printnum>
+			break;
+  80097c:	83 c4 20             	add    $0x20,%esp
+  80097f:	e9 cc fb ff ff       	jmp    800550 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800984:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800987:	89 55 10             	mov    %edx,0x10(%ebp)
+  80098a:	83 f9 01             	cmp    $0x1,%ecx
+  80098d:	7f 1b                	jg     8009aa <vprintfmt+0x46b>
+	else if (lflag)
+  80098f:	85 c9                	test   %ecx,%ecx
+  800991:	74 2c                	je     8009bf <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800993:	8b 45 14             	mov    0x14(%ebp),%eax
+  800996:	8b 10                	mov    (%eax),%edx
+  800998:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099d:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009a3:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009a8:	eb bb                	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ad:	8b 10                	mov    (%eax),%edx
+  8009af:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009b2:	8d 40 08             	lea    0x8(%eax),%eax
+  8009b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009b8:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009bd:	eb a6                	jmp    800965 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c2:	8b 10                	mov    (%eax),%edx
+  8009c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009cf:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8009d4:	eb 8f                	jmp    800965 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8009d6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+  8009dc:	53                   	push   %ebx
+  8009dd:	6a 25                	push   $0x25
+  8009df:	ff d7                	call   *%edi
+			break;
+  8009e1:	83 c4 10             	add    $0x10,%esp
+  8009e4:	e9 67 fb ff ff       	jmp    800550 <vprintfmt+0x11>
+			putch('%', putdat);
+  8009e9:	83 ec 08             	sub    $0x8,%esp
+  8009ec:	53                   	push   %ebx
+  8009ed:	6a 25                	push   $0x25
+  8009ef:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8009f1:	83 c4 10             	add    $0x10,%esp
+  8009f4:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8009f8:	0f 84 ba fb ff ff    	je     8005b8 <vprintfmt+0x79>
+  8009fe:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a01:	89 f0                	mov    %esi,%eax
+  800a03:	83 e8 01             	sub    $0x1,%eax
+  800a06:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0a:	75 f7                	jne    800a03 <vprintfmt+0x4c4>
+  800a0c:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a0f:	e9 3c fb ff ff       	jmp    800550 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a14:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a17:	8d 70 01             	lea    0x1(%eax),%esi
+  800a1a:	0f b6 00             	movzbl (%eax),%eax
+  800a1d:	0f be d0             	movsbl %al,%edx
+  800a20:	85 d2                	test   %edx,%edx
+  800a22:	74 11                	je     800a35 <vprintfmt+0x4f6>
+  800a24:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a27:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a2a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a2d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a30:	e9 5d fd ff ff       	jmp    800792 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a35:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a38:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a3b:	e9 10 fb ff ff       	jmp    800550 <vprintfmt+0x11>
+  800a40:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a43:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a46:	e9 05 fb ff ff       	jmp    800550 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a4b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a4f:	7e 0a                	jle    800a5b <vprintfmt+0x51c>
+  800a51:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a55:	0f 85 bd fc ff ff    	jne    800718 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a5b:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a60:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a65:	be d5 3d 80 00       	mov    $0x803dd5,%esi
+  800a6a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a6d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a70:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a73:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a76:	e9 17 fd ff ff       	jmp    800792 <vprintfmt+0x253>
+}
+  800a7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a7e:	5b                   	pop    %ebx
+  800a7f:	5e                   	pop    %esi
+  800a80:	5f                   	pop    %edi
+  800a81:	5d                   	pop    %ebp
+  800a82:	c3                   	ret
+
+00800a83 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a83:	55                   	push   %ebp
+  800a84:	89 e5                	mov    %esp,%ebp
+  800a86:	83 ec 18             	sub    $0x18,%esp
+  800a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800a8f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a92:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a96:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a99:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aa0:	85 c0                	test   %eax,%eax
+  800aa2:	74 26                	je     800aca <vsnprintf+0x47>
+  800aa4:	85 d2                	test   %edx,%edx
+  800aa6:	7e 22                	jle    800aca <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800aa8:	ff 75 14             	push   0x14(%ebp)
+  800aab:	ff 75 10             	push   0x10(%ebp)
+  800aae:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ab1:	50                   	push   %eax
+  800ab2:	68 05 05 80 00       	push   $0x800505
+  800ab7:	e8 83 fa ff ff       	call   80053f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800abc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800abf:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ac2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac5:	83 c4 10             	add    $0x10,%esp
+}
+  800ac8:	c9                   	leave
+  800ac9:	c3                   	ret
+		return -E_INVAL;
+  800aca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800acf:	eb f7                	jmp    800ac8 <vsnprintf+0x45>
+
+00800ad1 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800ad1:	55                   	push   %ebp
+  800ad2:	89 e5                	mov    %esp,%ebp
+  800ad4:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800ad7:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ada:	50                   	push   %eax
+  800adb:	ff 75 10             	push   0x10(%ebp)
+  800ade:	ff 75 0c             	push   0xc(%ebp)
+  800ae1:	ff 75 08             	push   0x8(%ebp)
+  800ae4:	e8 9a ff ff ff       	call   800a83 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800ae9:	c9                   	leave
+  800aea:	c3                   	ret
+
+00800aeb <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800aeb:	55                   	push   %ebp
+  800aec:	89 e5                	mov    %esp,%ebp
+  800aee:	57                   	push   %edi
+  800aef:	56                   	push   %esi
+  800af0:	53                   	push   %ebx
+  800af1:	83 ec 0c             	sub    $0xc,%esp
+  800af4:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800af7:	85 c0                	test   %eax,%eax
+  800af9:	74 13                	je     800b0e <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800afb:	83 ec 04             	sub    $0x4,%esp
+  800afe:	50                   	push   %eax
+  800aff:	68 0b 42 80 00       	push   $0x80420b
+  800b04:	6a 01                	push   $0x1
+  800b06:	e8 0c 14 00 00       	call   801f17 <fprintf>
+  800b0b:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  800b0e:	83 ec 0c             	sub    $0xc,%esp
+  800b11:	6a 00                	push   $0x0
+  800b13:	e8 28 f7 ff ff       	call   800240 <iscons>
+  800b18:	89 c7                	mov    %eax,%edi
+  800b1a:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  800b1d:	be 00 00 00 00       	mov    $0x0,%esi
+  800b22:	eb 4b                	jmp    800b6f <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  800b24:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  800b29:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800b2c:	75 08                	jne    800b36 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  800b2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b31:	5b                   	pop    %ebx
+  800b32:	5e                   	pop    %esi
+  800b33:	5f                   	pop    %edi
+  800b34:	5d                   	pop    %ebp
+  800b35:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800b36:	83 ec 08             	sub    $0x8,%esp
+  800b39:	53                   	push   %ebx
+  800b3a:	68 0b 41 80 00       	push   $0x80410b
+  800b3f:	e8 fc f8 ff ff       	call   800440 <cprintf>
+  800b44:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4c:	eb e0                	jmp    800b2e <readline+0x43>
+			if (echoing)
+  800b4e:	85 ff                	test   %edi,%edi
+  800b50:	75 05                	jne    800b57 <readline+0x6c>
+			i--;
+  800b52:	83 ee 01             	sub    $0x1,%esi
+  800b55:	eb 18                	jmp    800b6f <readline+0x84>
+				cputchar('\b');
+  800b57:	83 ec 0c             	sub    $0xc,%esp
+  800b5a:	6a 08                	push   $0x8
+  800b5c:	e8 9a f6 ff ff       	call   8001fb <cputchar>
+  800b61:	83 c4 10             	add    $0x10,%esp
+  800b64:	eb ec                	jmp    800b52 <readline+0x67>
+			buf[i++] = c;
+  800b66:	88 9e 20 60 80 00    	mov    %bl,0x806020(%esi)
+  800b6c:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  800b6f:	e8 a3 f6 ff ff       	call   800217 <getchar>
+  800b74:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  800b76:	85 c0                	test   %eax,%eax
+  800b78:	78 aa                	js     800b24 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  800b7a:	83 f8 08             	cmp    $0x8,%eax
+  800b7d:	0f 94 c0             	sete   %al
+  800b80:	83 fb 7f             	cmp    $0x7f,%ebx
+  800b83:	0f 94 c2             	sete   %dl
+  800b86:	08 d0                	or     %dl,%al
+  800b88:	74 04                	je     800b8e <readline+0xa3>
+  800b8a:	85 f6                	test   %esi,%esi
+  800b8c:	7f c0                	jg     800b4e <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  800b8e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800b91:	7e 1a                	jle    800bad <readline+0xc2>
+  800b93:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800b99:	7f 12                	jg     800bad <readline+0xc2>
+			if (echoing)
+  800b9b:	85 ff                	test   %edi,%edi
+  800b9d:	74 c7                	je     800b66 <readline+0x7b>
+				cputchar(c);
+  800b9f:	83 ec 0c             	sub    $0xc,%esp
+  800ba2:	53                   	push   %ebx
+  800ba3:	e8 53 f6 ff ff       	call   8001fb <cputchar>
+  800ba8:	83 c4 10             	add    $0x10,%esp
+  800bab:	eb b9                	jmp    800b66 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800bad:	83 fb 0a             	cmp    $0xa,%ebx
+  800bb0:	74 05                	je     800bb7 <readline+0xcc>
+  800bb2:	83 fb 0d             	cmp    $0xd,%ebx
+  800bb5:	75 b8                	jne    800b6f <readline+0x84>
+			if (echoing)
+  800bb7:	85 ff                	test   %edi,%edi
+  800bb9:	75 11                	jne    800bcc <readline+0xe1>
+			buf[i] = 0;
+  800bbb:	c6 86 20 60 80 00 00 	movb   $0x0,0x806020(%esi)
+			return buf;
+  800bc2:	b8 20 60 80 00       	mov    $0x806020,%eax
+  800bc7:	e9 62 ff ff ff       	jmp    800b2e <readline+0x43>
+				cputchar('\n');
+  800bcc:	83 ec 0c             	sub    $0xc,%esp
+  800bcf:	6a 0a                	push   $0xa
+  800bd1:	e8 25 f6 ff ff       	call   8001fb <cputchar>
+  800bd6:	83 c4 10             	add    $0x10,%esp
+  800bd9:	eb e0                	jmp    800bbb <readline+0xd0>
+
+00800bdb <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bdb:	55                   	push   %ebp
+  800bdc:	89 e5                	mov    %esp,%ebp
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800be1:	80 3a 00             	cmpb   $0x0,(%edx)
+  800be4:	74 10                	je     800bf6 <strlen+0x1b>
+  800be6:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800beb:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800bee:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bf2:	75 f7                	jne    800beb <strlen+0x10>
+	return n;
+}
+  800bf4:	5d                   	pop    %ebp
+  800bf5:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800bfb:	eb f7                	jmp    800bf4 <strlen+0x19>
+
+00800bfd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c03:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c06:	85 d2                	test   %edx,%edx
+  800c08:	74 16                	je     800c20 <strnlen+0x23>
+  800c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c13:	74 09                	je     800c1e <strnlen+0x21>
+		n++;
+  800c15:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c18:	39 d0                	cmp    %edx,%eax
+  800c1a:	75 f3                	jne    800c0f <strnlen+0x12>
+		n++;
+  800c1c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c25:	eb f7                	jmp    800c1e <strnlen+0x21>
+
+00800c27 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	53                   	push   %ebx
+  800c2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c36:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c3a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c3d:	83 c0 01             	add    $0x1,%eax
+  800c40:	84 d2                	test   %dl,%dl
+  800c42:	75 f2                	jne    800c36 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800c44:	89 c8                	mov    %ecx,%eax
+  800c46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c49:	c9                   	leave
+  800c4a:	c3                   	ret
+
+00800c4b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	53                   	push   %ebx
+  800c4f:	83 ec 10             	sub    $0x10,%esp
+  800c52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800c55:	53                   	push   %ebx
+  800c56:	e8 80 ff ff ff       	call   800bdb <strlen>
+  800c5b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800c5e:	ff 75 0c             	push   0xc(%ebp)
+  800c61:	01 d8                	add    %ebx,%eax
+  800c63:	50                   	push   %eax
+  800c64:	e8 be ff ff ff       	call   800c27 <strcpy>
+	return dst;
+}
+  800c69:	89 d8                	mov    %ebx,%eax
+  800c6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c6e:	c9                   	leave
+  800c6f:	c3                   	ret
+
+00800c70 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	56                   	push   %esi
+  800c74:	53                   	push   %ebx
+  800c75:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c78:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c7e:	85 db                	test   %ebx,%ebx
+  800c80:	74 17                	je     800c99 <strncpy+0x29>
+  800c82:	01 f3                	add    %esi,%ebx
+  800c84:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c86:	83 c0 01             	add    $0x1,%eax
+  800c89:	0f b6 0a             	movzbl (%edx),%ecx
+  800c8c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c8f:	80 f9 01             	cmp    $0x1,%cl
+  800c92:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c95:	39 c3                	cmp    %eax,%ebx
+  800c97:	75 ed                	jne    800c86 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c99:	89 f0                	mov    %esi,%eax
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+
+00800c9f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	56                   	push   %esi
+  800ca3:	53                   	push   %ebx
+  800ca4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800caa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800cad:	89 f0                	mov    %esi,%eax
+  800caf:	85 db                	test   %ebx,%ebx
+  800cb1:	74 1e                	je     800cd1 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800cb3:	83 eb 01             	sub    $0x1,%ebx
+  800cb6:	74 16                	je     800cce <strlcpy+0x2f>
+  800cb8:	01 f3                	add    %esi,%ebx
+  800cba:	0f b6 0a             	movzbl (%edx),%ecx
+  800cbd:	84 c9                	test   %cl,%cl
+  800cbf:	74 0d                	je     800cce <strlcpy+0x2f>
+			*dst++ = *src++;
+  800cc1:	83 c2 01             	add    $0x1,%edx
+  800cc4:	83 c0 01             	add    $0x1,%eax
+  800cc7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800cca:	39 d8                	cmp    %ebx,%eax
+  800ccc:	75 ec                	jne    800cba <strlcpy+0x1b>
+		*dst = '\0';
+  800cce:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800cd1:	29 f0                	sub    %esi,%eax
+}
+  800cd3:	5b                   	pop    %ebx
+  800cd4:	5e                   	pop    %esi
+  800cd5:	5d                   	pop    %ebp
+  800cd6:	c3                   	ret
+
+00800cd7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cd7:	55                   	push   %ebp
+  800cd8:	89 e5                	mov    %esp,%ebp
+  800cda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cdd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ce0:	0f b6 01             	movzbl (%ecx),%eax
+  800ce3:	84 c0                	test   %al,%al
+  800ce5:	74 11                	je     800cf8 <strcmp+0x21>
+  800ce7:	38 02                	cmp    %al,(%edx)
+  800ce9:	75 0d                	jne    800cf8 <strcmp+0x21>
+		p++, q++;
+  800ceb:	83 c1 01             	add    $0x1,%ecx
+  800cee:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800cf1:	0f b6 01             	movzbl (%ecx),%eax
+  800cf4:	84 c0                	test   %al,%al
+  800cf6:	75 ef                	jne    800ce7 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cf8:	0f b6 c0             	movzbl %al,%eax
+  800cfb:	0f b6 12             	movzbl (%edx),%edx
+  800cfe:	29 d0                	sub    %edx,%eax
+}
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+
+00800d02 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	53                   	push   %ebx
+  800d06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800d0c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800d14:	85 d2                	test   %edx,%edx
+  800d16:	74 2e                	je     800d46 <strncmp+0x44>
+  800d18:	0f b6 01             	movzbl (%ecx),%eax
+  800d1b:	84 c0                	test   %al,%al
+  800d1d:	74 16                	je     800d35 <strncmp+0x33>
+  800d1f:	3a 03                	cmp    (%ebx),%al
+  800d21:	75 12                	jne    800d35 <strncmp+0x33>
+		n--, p++, q++;
+  800d23:	83 c1 01             	add    $0x1,%ecx
+  800d26:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800d29:	83 ea 01             	sub    $0x1,%edx
+  800d2c:	75 ea                	jne    800d18 <strncmp+0x16>
+		return 0;
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d33:	eb 11                	jmp    800d46 <strncmp+0x44>
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800d3a:	85 d2                	test   %edx,%edx
+  800d3c:	74 08                	je     800d46 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d3e:	0f b6 01             	movzbl (%ecx),%eax
+  800d41:	0f b6 13             	movzbl (%ebx),%edx
+  800d44:	29 d0                	sub    %edx,%eax
+}
+  800d46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d49:	c9                   	leave
+  800d4a:	c3                   	ret
+
+00800d4b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d51:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800d55:	0f b6 10             	movzbl (%eax),%edx
+  800d58:	84 d2                	test   %dl,%dl
+  800d5a:	74 15                	je     800d71 <strchr+0x26>
+		if (*s == c)
+  800d5c:	38 d1                	cmp    %dl,%cl
+  800d5e:	74 0f                	je     800d6f <strchr+0x24>
+	for (; *s; s++)
+  800d60:	83 c0 01             	add    $0x1,%eax
+  800d63:	0f b6 10             	movzbl (%eax),%edx
+  800d66:	84 d2                	test   %dl,%dl
+  800d68:	75 f2                	jne    800d5c <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+	return 0;
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	eb f7                	jmp    800d6f <strchr+0x24>
+
+00800d78 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	53                   	push   %ebx
+  800d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d82:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d85:	38 d3                	cmp    %dl,%bl
+  800d87:	74 14                	je     800d9d <strfind+0x25>
+  800d89:	89 d1                	mov    %edx,%ecx
+  800d8b:	84 db                	test   %bl,%bl
+  800d8d:	74 0e                	je     800d9d <strfind+0x25>
+	for (; *s; s++)
+  800d8f:	83 c0 01             	add    $0x1,%eax
+  800d92:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d95:	38 ca                	cmp    %cl,%dl
+  800d97:	74 04                	je     800d9d <strfind+0x25>
+  800d99:	84 d2                	test   %dl,%dl
+  800d9b:	75 f2                	jne    800d8f <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800da0:	c9                   	leave
+  800da1:	c3                   	ret
+
+00800da2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800da9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800dac:	85 c9                	test   %ecx,%ecx
+  800dae:	74 20                	je     800dd0 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800db0:	89 f8                	mov    %edi,%eax
+  800db2:	09 c8                	or     %ecx,%eax
+  800db4:	a8 03                	test   $0x3,%al
+  800db6:	75 12                	jne    800dca <memset+0x28>
+		c &= 0xFF;
+  800db8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800dbc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800dc2:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800dc5:	fc                   	cld
+  800dc6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800dc8:	eb 06                	jmp    800dd0 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800dca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dcd:	fc                   	cld
+  800dce:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800dd0:	89 f8                	mov    %edi,%eax
+  800dd2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800dd5:	c9                   	leave
+  800dd6:	c3                   	ret
+
+00800dd7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800dd7:	55                   	push   %ebp
+  800dd8:	89 e5                	mov    %esp,%ebp
+  800dda:	57                   	push   %edi
+  800ddb:	56                   	push   %esi
+  800ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddf:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800de2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800de5:	39 c6                	cmp    %eax,%esi
+  800de7:	73 32                	jae    800e1b <memmove+0x44>
+  800de9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800dec:	39 d0                	cmp    %edx,%eax
+  800dee:	73 2b                	jae    800e1b <memmove+0x44>
+		s += n;
+		d += n;
+  800df0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800df3:	89 d6                	mov    %edx,%esi
+  800df5:	09 fe                	or     %edi,%esi
+  800df7:	09 ce                	or     %ecx,%esi
+  800df9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800dff:	75 0e                	jne    800e0f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e01:	83 ef 04             	sub    $0x4,%edi
+  800e04:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e07:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e0a:	fd                   	std
+  800e0b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e0d:	eb 09                	jmp    800e18 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e0f:	83 ef 01             	sub    $0x1,%edi
+  800e12:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e15:	fd                   	std
+  800e16:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e18:	fc                   	cld
+  800e19:	eb 1a                	jmp    800e35 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e1b:	89 f2                	mov    %esi,%edx
+  800e1d:	09 c2                	or     %eax,%edx
+  800e1f:	09 ca                	or     %ecx,%edx
+  800e21:	f6 c2 03             	test   $0x3,%dl
+  800e24:	75 0a                	jne    800e30 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e26:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e29:	89 c7                	mov    %eax,%edi
+  800e2b:	fc                   	cld
+  800e2c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e2e:	eb 05                	jmp    800e35 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e30:	89 c7                	mov    %eax,%edi
+  800e32:	fc                   	cld
+  800e33:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e35:	5e                   	pop    %esi
+  800e36:	5f                   	pop    %edi
+  800e37:	5d                   	pop    %ebp
+  800e38:	c3                   	ret
+
+00800e39 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800e39:	55                   	push   %ebp
+  800e3a:	89 e5                	mov    %esp,%ebp
+  800e3c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e3f:	ff 75 10             	push   0x10(%ebp)
+  800e42:	ff 75 0c             	push   0xc(%ebp)
+  800e45:	ff 75 08             	push   0x8(%ebp)
+  800e48:	e8 8a ff ff ff       	call   800dd7 <memmove>
+}
+  800e4d:	c9                   	leave
+  800e4e:	c3                   	ret
+
+00800e4f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+  800e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e57:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e5a:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e5d:	85 f6                	test   %esi,%esi
+  800e5f:	74 29                	je     800e8a <memcmp+0x3b>
+  800e61:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800e63:	0f b6 08             	movzbl (%eax),%ecx
+  800e66:	0f b6 1a             	movzbl (%edx),%ebx
+  800e69:	38 d9                	cmp    %bl,%cl
+  800e6b:	75 11                	jne    800e7e <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e6d:	83 c0 01             	add    $0x1,%eax
+  800e70:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e73:	39 c6                	cmp    %eax,%esi
+  800e75:	75 ec                	jne    800e63 <memcmp+0x14>
+	}
+
+	return 0;
+  800e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7c:	eb 08                	jmp    800e86 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e7e:	0f b6 c1             	movzbl %cl,%eax
+  800e81:	0f b6 db             	movzbl %bl,%ebx
+  800e84:	29 d8                	sub    %ebx,%eax
+}
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+	return 0;
+  800e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8f:	eb f5                	jmp    800e86 <memcmp+0x37>
+
+00800e91 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e9a:	89 c2                	mov    %eax,%edx
+  800e9c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e9f:	39 d0                	cmp    %edx,%eax
+  800ea1:	73 0d                	jae    800eb0 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ea3:	38 08                	cmp    %cl,(%eax)
+  800ea5:	74 0d                	je     800eb4 <memfind+0x23>
+	for (; s < ends; s++)
+  800ea7:	83 c0 01             	add    $0x1,%eax
+  800eaa:	39 c2                	cmp    %eax,%edx
+  800eac:	75 f5                	jne    800ea3 <memfind+0x12>
+  800eae:	eb 06                	jmp    800eb6 <memfind+0x25>
+  800eb0:	89 c2                	mov    %eax,%edx
+  800eb2:	eb 02                	jmp    800eb6 <memfind+0x25>
+  800eb4:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800eb6:	89 d0                	mov    %edx,%eax
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+
+00800eba <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800eba:	55                   	push   %ebp
+  800ebb:	89 e5                	mov    %esp,%ebp
+  800ebd:	57                   	push   %edi
+  800ebe:	56                   	push   %esi
+  800ebf:	53                   	push   %ebx
+  800ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ec6:	0f b6 02             	movzbl (%edx),%eax
+  800ec9:	3c 20                	cmp    $0x20,%al
+  800ecb:	74 04                	je     800ed1 <strtol+0x17>
+  800ecd:	3c 09                	cmp    $0x9,%al
+  800ecf:	75 0e                	jne    800edf <strtol+0x25>
+		s++;
+  800ed1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ed4:	0f b6 02             	movzbl (%edx),%eax
+  800ed7:	3c 20                	cmp    $0x20,%al
+  800ed9:	74 f6                	je     800ed1 <strtol+0x17>
+  800edb:	3c 09                	cmp    $0x9,%al
+  800edd:	74 f2                	je     800ed1 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800edf:	3c 2b                	cmp    $0x2b,%al
+  800ee1:	74 2a                	je     800f0d <strtol+0x53>
+	int neg = 0;
+  800ee3:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ee8:	3c 2d                	cmp    $0x2d,%al
+  800eea:	74 2b                	je     800f17 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eec:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ef2:	75 0f                	jne    800f03 <strtol+0x49>
+  800ef4:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ef7:	74 28                	je     800f21 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ef9:	85 db                	test   %ebx,%ebx
+  800efb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f00:	0f 44 d8             	cmove  %eax,%ebx
+  800f03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f08:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f0b:	eb 46                	jmp    800f53 <strtol+0x99>
+		s++;
+  800f0d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f10:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f15:	eb d5                	jmp    800eec <strtol+0x32>
+		s++, neg = 1;
+  800f17:	83 c2 01             	add    $0x1,%edx
+  800f1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f1f:	eb cb                	jmp    800eec <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f21:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f25:	74 0e                	je     800f35 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800f27:	85 db                	test   %ebx,%ebx
+  800f29:	75 d8                	jne    800f03 <strtol+0x49>
+		s++, base = 8;
+  800f2b:	83 c2 01             	add    $0x1,%edx
+  800f2e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f33:	eb ce                	jmp    800f03 <strtol+0x49>
+		s += 2, base = 16;
+  800f35:	83 c2 02             	add    $0x2,%edx
+  800f38:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f3d:	eb c4                	jmp    800f03 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f3f:	0f be c0             	movsbl %al,%eax
+  800f42:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f45:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f48:	7d 3a                	jge    800f84 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800f4a:	83 c2 01             	add    $0x1,%edx
+  800f4d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f51:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f53:	0f b6 02             	movzbl (%edx),%eax
+  800f56:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f59:	89 f3                	mov    %esi,%ebx
+  800f5b:	80 fb 09             	cmp    $0x9,%bl
+  800f5e:	76 df                	jbe    800f3f <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800f60:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f63:	89 f3                	mov    %esi,%ebx
+  800f65:	80 fb 19             	cmp    $0x19,%bl
+  800f68:	77 08                	ja     800f72 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f6a:	0f be c0             	movsbl %al,%eax
+  800f6d:	83 e8 57             	sub    $0x57,%eax
+  800f70:	eb d3                	jmp    800f45 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f72:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f75:	89 f3                	mov    %esi,%ebx
+  800f77:	80 fb 19             	cmp    $0x19,%bl
+  800f7a:	77 08                	ja     800f84 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f7c:	0f be c0             	movsbl %al,%eax
+  800f7f:	83 e8 37             	sub    $0x37,%eax
+  800f82:	eb c1                	jmp    800f45 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f84:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f88:	74 05                	je     800f8f <strtol+0xd5>
+		*endptr = (char *) s;
+  800f8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f8d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f8f:	89 c8                	mov    %ecx,%eax
+  800f91:	f7 d8                	neg    %eax
+  800f93:	85 ff                	test   %edi,%edi
+  800f95:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f98:	89 c8                	mov    %ecx,%eax
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5e                   	pop    %esi
+  800f9c:	5f                   	pop    %edi
+  800f9d:	5d                   	pop    %ebp
+  800f9e:	c3                   	ret
+
+00800f9f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800faa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb0:	89 c3                	mov    %eax,%ebx
+  800fb2:	89 c7                	mov    %eax,%edi
+  800fb4:	89 c6                	mov    %eax,%esi
+  800fb6:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+
+00800fbd <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fcd:	89 d1                	mov    %edx,%ecx
+  800fcf:	89 d3                	mov    %edx,%ebx
+  800fd1:	89 d7                	mov    %edx,%edi
+  800fd3:	89 d6                	mov    %edx,%esi
+  800fd5:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+
+00800fdc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800fdc:	55                   	push   %ebp
+  800fdd:	89 e5                	mov    %esp,%ebp
+  800fdf:	57                   	push   %edi
+  800fe0:	56                   	push   %esi
+  800fe1:	53                   	push   %ebx
+  800fe2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fed:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ff2:	89 cb                	mov    %ecx,%ebx
+  800ff4:	89 cf                	mov    %ecx,%edi
+  800ff6:	89 ce                	mov    %ecx,%esi
+  800ff8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	7f 08                	jg     801006 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  801009:	50                   	push   %eax
+  80100a:	6a 03                	push   $0x3
+  80100c:	68 1b 41 80 00       	push   $0x80411b
+  801011:	6a 23                	push   $0x23
+  801013:	68 38 41 80 00       	push   $0x804138
+  801018:	e8 48 f3 ff ff       	call   800365 <_panic>
+
+0080101d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	b8 02 00 00 00       	mov    $0x2,%eax
+  80102d:	89 d1                	mov    %edx,%ecx
+  80102f:	89 d3                	mov    %edx,%ebx
+  801031:	89 d7                	mov    %edx,%edi
+  801033:	89 d6                	mov    %edx,%esi
+  801035:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801042:	ba 00 00 00 00       	mov    $0x0,%edx
+  801047:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80104c:	89 d1                	mov    %edx,%ecx
+  80104e:	89 d3                	mov    %edx,%ebx
+  801050:	89 d7                	mov    %edx,%edi
+  801052:	89 d6                	mov    %edx,%esi
+  801054:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801056:	5b                   	pop    %ebx
+  801057:	5e                   	pop    %esi
+  801058:	5f                   	pop    %edi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+
+0080105b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80105b:	55                   	push   %ebp
+  80105c:	89 e5                	mov    %esp,%ebp
+  80105e:	57                   	push   %edi
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801064:	be 00 00 00 00       	mov    $0x0,%esi
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801074:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801077:	89 f7                	mov    %esi,%edi
+  801079:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107b:	85 c0                	test   %eax,%eax
+  80107d:	7f 08                	jg     801087 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80107f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801082:	5b                   	pop    %ebx
+  801083:	5e                   	pop    %esi
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801087:	83 ec 0c             	sub    $0xc,%esp
+  80108a:	50                   	push   %eax
+  80108b:	6a 04                	push   $0x4
+  80108d:	68 1b 41 80 00       	push   $0x80411b
+  801092:	6a 23                	push   $0x23
+  801094:	68 38 41 80 00       	push   $0x804138
+  801099:	e8 c7 f2 ff ff       	call   800365 <_panic>
+
+0080109e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80109e:	55                   	push   %ebp
+  80109f:	89 e5                	mov    %esp,%ebp
+  8010a1:	57                   	push   %edi
+  8010a2:	56                   	push   %esi
+  8010a3:	53                   	push   %ebx
+  8010a4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ad:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b8:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bd:	85 c0                	test   %eax,%eax
+  8010bf:	7f 08                	jg     8010c9 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8010c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c4:	5b                   	pop    %ebx
+  8010c5:	5e                   	pop    %esi
+  8010c6:	5f                   	pop    %edi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c9:	83 ec 0c             	sub    $0xc,%esp
+  8010cc:	50                   	push   %eax
+  8010cd:	6a 05                	push   $0x5
+  8010cf:	68 1b 41 80 00       	push   $0x80411b
+  8010d4:	6a 23                	push   $0x23
+  8010d6:	68 38 41 80 00       	push   $0x804138
+  8010db:	e8 85 f2 ff ff       	call   800365 <_panic>
+
+008010e0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	57                   	push   %edi
+  8010e4:	56                   	push   %esi
+  8010e5:	53                   	push   %ebx
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010f9:	89 df                	mov    %ebx,%edi
+  8010fb:	89 de                	mov    %ebx,%esi
+  8010fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	7f 08                	jg     80110b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801106:	5b                   	pop    %ebx
+  801107:	5e                   	pop    %esi
+  801108:	5f                   	pop    %edi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+  80110e:	50                   	push   %eax
+  80110f:	6a 06                	push   $0x6
+  801111:	68 1b 41 80 00       	push   $0x80411b
+  801116:	6a 23                	push   $0x23
+  801118:	68 38 41 80 00       	push   $0x804138
+  80111d:	e8 43 f2 ff ff       	call   800365 <_panic>
+
+00801122 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 08 00 00 00       	mov    $0x8,%eax
+  80113b:	89 df                	mov    %ebx,%edi
+  80113d:	89 de                	mov    %ebx,%esi
+  80113f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 08                	push   $0x8
+  801153:	68 1b 41 80 00       	push   $0x80411b
+  801158:	6a 23                	push   $0x23
+  80115a:	68 38 41 80 00       	push   $0x804138
+  80115f:	e8 01 f2 ff ff       	call   800365 <_panic>
+
+00801164 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 09 00 00 00       	mov    $0x9,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801183:	85 c0                	test   %eax,%eax
+  801185:	7f 08                	jg     80118f <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118a:	5b                   	pop    %ebx
+  80118b:	5e                   	pop    %esi
+  80118c:	5f                   	pop    %edi
+  80118d:	5d                   	pop    %ebp
+  80118e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	50                   	push   %eax
+  801193:	6a 09                	push   $0x9
+  801195:	68 1b 41 80 00       	push   $0x80411b
+  80119a:	6a 23                	push   $0x23
+  80119c:	68 38 41 80 00       	push   $0x804138
+  8011a1:	e8 bf f1 ff ff       	call   800365 <_panic>
+
+008011a6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+  8011ac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011bf:	89 df                	mov    %ebx,%edi
+  8011c1:	89 de                	mov    %ebx,%esi
+  8011c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c5:	85 c0                	test   %eax,%eax
+  8011c7:	7f 08                	jg     8011d1 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8011c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011cc:	5b                   	pop    %ebx
+  8011cd:	5e                   	pop    %esi
+  8011ce:	5f                   	pop    %edi
+  8011cf:	5d                   	pop    %ebp
+  8011d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d1:	83 ec 0c             	sub    $0xc,%esp
+  8011d4:	50                   	push   %eax
+  8011d5:	6a 0a                	push   $0xa
+  8011d7:	68 1b 41 80 00       	push   $0x80411b
+  8011dc:	6a 23                	push   $0x23
+  8011de:	68 38 41 80 00       	push   $0x804138
+  8011e3:	e8 7d f1 ff ff       	call   800365 <_panic>
+
+008011e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011e8:	55                   	push   %ebp
+  8011e9:	89 e5                	mov    %esp,%ebp
+  8011eb:	57                   	push   %edi
+  8011ec:	56                   	push   %esi
+  8011ed:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801201:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801204:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801214:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801221:	89 cb                	mov    %ecx,%ebx
+  801223:	89 cf                	mov    %ecx,%edi
+  801225:	89 ce                	mov    %ecx,%esi
+  801227:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801229:	85 c0                	test   %eax,%eax
+  80122b:	7f 08                	jg     801235 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80122d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801230:	5b                   	pop    %ebx
+  801231:	5e                   	pop    %esi
+  801232:	5f                   	pop    %edi
+  801233:	5d                   	pop    %ebp
+  801234:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801235:	83 ec 0c             	sub    $0xc,%esp
+  801238:	50                   	push   %eax
+  801239:	6a 0d                	push   $0xd
+  80123b:	68 1b 41 80 00       	push   $0x80411b
+  801240:	6a 23                	push   $0x23
+  801242:	68 38 41 80 00       	push   $0x804138
+  801247:	e8 19 f1 ff ff       	call   800365 <_panic>
+
+0080124c <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801252:	8b 55 08             	mov    0x8(%ebp),%edx
+  801255:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801258:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80125d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801260:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801263:	8b 75 18             	mov    0x18(%ebp),%esi
+  801266:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  801273:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801281:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801286:	89 df                	mov    %ebx,%edi
+  801288:	89 de                	mov    %ebx,%esi
+  80128a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80128c:	85 c0                	test   %eax,%eax
+  80128e:	7f 08                	jg     801298 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801290:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801293:	5b                   	pop    %ebx
+  801294:	5e                   	pop    %esi
+  801295:	5f                   	pop    %edi
+  801296:	5d                   	pop    %ebp
+  801297:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801298:	83 ec 0c             	sub    $0xc,%esp
+  80129b:	50                   	push   %eax
+  80129c:	6a 0d                	push   $0xd
+  80129e:	68 1b 41 80 00       	push   $0x80411b
+  8012a3:	6a 23                	push   $0x23
+  8012a5:	68 38 41 80 00       	push   $0x804138
+  8012aa:	e8 b6 f0 ff ff       	call   800365 <_panic>
+
+008012af <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8012af:	55                   	push   %ebp
+  8012b0:	89 e5                	mov    %esp,%ebp
+  8012b2:	57                   	push   %edi
+  8012b3:	56                   	push   %esi
+  8012b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ba:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012bf:	89 d1                	mov    %edx,%ecx
+  8012c1:	89 d3                	mov    %edx,%ebx
+  8012c3:	89 d7                	mov    %edx,%edi
+  8012c5:	89 d6                	mov    %edx,%esi
+  8012c7:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012c9:	5b                   	pop    %ebx
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5f                   	pop    %edi
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+
+008012ce <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  801302:	89 cb                	mov    %ecx,%ebx
+  801304:	89 cf                	mov    %ecx,%edi
+  801306:	89 ce                	mov    %ecx,%esi
+  801308:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80130a:	5b                   	pop    %ebx
+  80130b:	5e                   	pop    %esi
+  80130c:	5f                   	pop    %edi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+
+0080130f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801315:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	b8 11 00 00 00       	mov    $0x11,%eax
+  801325:	89 df                	mov    %ebx,%edi
+  801327:	89 de                	mov    %ebx,%esi
+  801329:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80132b:	5b                   	pop    %ebx
+  80132c:	5e                   	pop    %esi
+  80132d:	5f                   	pop    %edi
+  80132e:	5d                   	pop    %ebp
+  80132f:	c3                   	ret
+
+00801330 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	56                   	push   %esi
+  801335:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801336:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801341:	b8 12 00 00 00       	mov    $0x12,%eax
+  801346:	89 df                	mov    %ebx,%edi
+  801348:	89 de                	mov    %ebx,%esi
+  80134a:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+
+00801351 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801357:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801364:	89 cb                	mov    %ecx,%ebx
+  801366:	89 cf                	mov    %ecx,%edi
+  801368:	89 ce                	mov    %ecx,%esi
+  80136a:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  80136c:	5b                   	pop    %ebx
+  80136d:	5e                   	pop    %esi
+  80136e:	5f                   	pop    %edi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+
+00801371 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801371:	55                   	push   %ebp
+  801372:	89 e5                	mov    %esp,%ebp
+  801374:	57                   	push   %edi
+  801375:	56                   	push   %esi
+  801376:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801377:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80137c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801382:	b8 14 00 00 00       	mov    $0x14,%eax
+  801387:	89 df                	mov    %ebx,%edi
+  801389:	89 de                	mov    %ebx,%esi
+  80138b:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  80138d:	5b                   	pop    %ebx
+  80138e:	5e                   	pop    %esi
+  80138f:	5f                   	pop    %edi
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+
+00801392 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801392:	55                   	push   %ebp
+  801393:	89 e5                	mov    %esp,%ebp
+  801395:	57                   	push   %edi
+  801396:	56                   	push   %esi
+  801397:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801398:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a0:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013a5:	89 cb                	mov    %ecx,%ebx
+  8013a7:	89 cf                	mov    %ecx,%edi
+  8013a9:	89 ce                	mov    %ecx,%esi
+  8013ab:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8013ad:	5b                   	pop    %ebx
+  8013ae:	5e                   	pop    %esi
+  8013af:	5f                   	pop    %edi
+  8013b0:	5d                   	pop    %ebp
+  8013b1:	c3                   	ret
+
+008013b2 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8013b2:	55                   	push   %ebp
+  8013b3:	89 e5                	mov    %esp,%ebp
+  8013b5:	57                   	push   %edi
+  8013b6:	56                   	push   %esi
+  8013b7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8013bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cb:	89 f7                	mov    %esi,%edi
+  8013cd:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8013cf:	5b                   	pop    %ebx
+  8013d0:	5e                   	pop    %esi
+  8013d1:	5f                   	pop    %edi
+  8013d2:	5d                   	pop    %ebp
+  8013d3:	c3                   	ret
+
+008013d4 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e5:	b8 17 00 00 00       	mov    $0x17,%eax
+  8013ea:	89 df                	mov    %ebx,%edi
+  8013ec:	89 de                	mov    %ebx,%esi
+  8013ee:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8013f0:	5b                   	pop    %ebx
+  8013f1:	5e                   	pop    %esi
+  8013f2:	5f                   	pop    %edi
+  8013f3:	5d                   	pop    %ebp
+  8013f4:	c3                   	ret
+
+008013f5 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8013f5:	55                   	push   %ebp
+  8013f6:	89 e5                	mov    %esp,%ebp
+  8013f8:	57                   	push   %edi
+  8013f9:	56                   	push   %esi
+  8013fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801400:	8b 55 08             	mov    0x8(%ebp),%edx
+  801403:	b8 18 00 00 00       	mov    $0x18,%eax
+  801408:	89 cb                	mov    %ecx,%ebx
+  80140a:	89 cf                	mov    %ecx,%edi
+  80140c:	89 ce                	mov    %ecx,%esi
+  80140e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80141b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80141f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	b8 19 00 00 00       	mov    $0x19,%eax
+  80142c:	89 df                	mov    %ebx,%edi
+  80142e:	89 de                	mov    %ebx,%esi
+  801430:	cd 30                	int    $0x30
+}
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+
+00801437 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801437:	55                   	push   %ebp
+  801438:	89 e5                	mov    %esp,%ebp
+  80143a:	57                   	push   %edi
+  80143b:	56                   	push   %esi
+  80143c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143d:	be 00 00 00 00       	mov    $0x0,%esi
+  801442:	8b 55 08             	mov    0x8(%ebp),%edx
+  801445:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801448:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80144d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801450:	89 f7                	mov    %esi,%edi
+  801452:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801454:	5b                   	pop    %ebx
+  801455:	5e                   	pop    %esi
+  801456:	5f                   	pop    %edi
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+
+00801459 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80145f:	be 00 00 00 00       	mov    $0x0,%esi
+  801464:	8b 55 08             	mov    0x8(%ebp),%edx
+  801467:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  80146f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801472:	89 f7                	mov    %esi,%edi
+  801474:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5f                   	pop    %edi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+
+0080147b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  80147b:	55                   	push   %ebp
+  80147c:	89 e5                	mov    %esp,%ebp
+  80147e:	57                   	push   %edi
+  80147f:	56                   	push   %esi
+  801480:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801481:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801486:	8b 55 08             	mov    0x8(%ebp),%edx
+  801489:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80148c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801491:	89 df                	mov    %ebx,%edi
+  801493:	89 de                	mov    %ebx,%esi
+  801495:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ad:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8014b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b5:	89 f7                	mov    %esi,%edi
+  8014b7:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+
+008014be <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014c9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014cc:	5d                   	pop    %ebp
+  8014cd:	c3                   	ret
+
+008014ce <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014d9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014de:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8014e3:	5d                   	pop    %ebp
+  8014e4:	c3                   	ret
+
+008014e5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  8014e8:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014ed:	89 c2                	mov    %eax,%edx
+  8014ef:	c1 ea 16             	shr    $0x16,%edx
+  8014f2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014f9:	f6 c2 01             	test   $0x1,%dl
+  8014fc:	74 29                	je     801527 <fd_alloc+0x42>
+  8014fe:	89 c2                	mov    %eax,%edx
+  801500:	c1 ea 0c             	shr    $0xc,%edx
+  801503:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80150a:	f6 c2 01             	test   $0x1,%dl
+  80150d:	74 18                	je     801527 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80150f:	05 00 10 00 00       	add    $0x1000,%eax
+  801514:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801519:	75 d2                	jne    8014ed <fd_alloc+0x8>
+  80151b:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801520:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801525:	eb 05                	jmp    80152c <fd_alloc+0x47>
+			return 0;
+  801527:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	89 02                	mov    %eax,(%edx)
+}
+  801531:	89 c8                	mov    %ecx,%eax
+  801533:	5d                   	pop    %ebp
+  801534:	c3                   	ret
+
+00801535 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80153b:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801540:	77 30                	ja     801572 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801542:	c1 e0 0c             	shl    $0xc,%eax
+  801545:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  80154a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801550:	f6 c2 01             	test   $0x1,%dl
+  801553:	74 24                	je     801579 <fd_lookup+0x44>
+  801555:	89 c2                	mov    %eax,%edx
+  801557:	c1 ea 0c             	shr    $0xc,%edx
+  80155a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801561:	f6 c2 01             	test   $0x1,%dl
+  801564:	74 1a                	je     801580 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801566:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801569:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80156b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801570:	5d                   	pop    %ebp
+  801571:	c3                   	ret
+		return -E_INVAL;
+  801572:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801577:	eb f7                	jmp    801570 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801579:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157e:	eb f0                	jmp    801570 <fd_lookup+0x3b>
+  801580:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801585:	eb e9                	jmp    801570 <fd_lookup+0x3b>
+
+00801587 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	53                   	push   %ebx
+  80158b:	83 ec 04             	sub    $0x4,%esp
+  80158e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+  801596:	bb 40 50 80 00       	mov    $0x805040,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  80159b:	39 13                	cmp    %edx,(%ebx)
+  80159d:	74 54                	je     8015f3 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80159f:	83 c0 01             	add    $0x1,%eax
+  8015a2:	8b 1c 85 c4 41 80 00 	mov    0x8041c4(,%eax,4),%ebx
+  8015a9:	85 db                	test   %ebx,%ebx
+  8015ab:	75 ee                	jne    80159b <dev_lookup+0x14>
+  8015ad:	89 e1                	mov    %esp,%ecx
+  8015af:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015b4:	29 c8                	sub    %ecx,%eax
+  8015b6:	89 c1                	mov    %eax,%ecx
+  8015b8:	c1 e9 0f             	shr    $0xf,%ecx
+  8015bb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c5:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015c8:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  8015cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8015d2:	83 ec 04             	sub    $0x4,%esp
+  8015d5:	52                   	push   %edx
+  8015d6:	50                   	push   %eax
+  8015d7:	68 48 41 80 00       	push   $0x804148
+  8015dc:	e8 5f ee ff ff       	call   800440 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015e1:	83 c4 10             	add    $0x10,%esp
+  8015e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ec:	89 1a                	mov    %ebx,(%edx)
+}
+  8015ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f1:	c9                   	leave
+  8015f2:	c3                   	ret
+			return 0;
+  8015f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f8:	eb ef                	jmp    8015e9 <dev_lookup+0x62>
+
+008015fa <fd_close>:
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	57                   	push   %edi
+  8015fe:	56                   	push   %esi
+  8015ff:	53                   	push   %ebx
+  801600:	83 ec 24             	sub    $0x24,%esp
+  801603:	8b 75 08             	mov    0x8(%ebp),%esi
+  801606:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801609:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80160c:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80160d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801613:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801616:	50                   	push   %eax
+  801617:	e8 19 ff ff ff       	call   801535 <fd_lookup>
+  80161c:	89 c3                	mov    %eax,%ebx
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	85 c0                	test   %eax,%eax
+  801623:	78 05                	js     80162a <fd_close+0x30>
+	    || fd != fd2)
+  801625:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801628:	74 0f                	je     801639 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  80162a:	85 ff                	test   %edi,%edi
+  80162c:	0f 44 df             	cmove  %edi,%ebx
+}
+  80162f:	89 d8                	mov    %ebx,%eax
+  801631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801634:	5b                   	pop    %ebx
+  801635:	5e                   	pop    %esi
+  801636:	5f                   	pop    %edi
+  801637:	5d                   	pop    %ebp
+  801638:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801639:	83 ec 08             	sub    $0x8,%esp
+  80163c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80163f:	50                   	push   %eax
+  801640:	ff 36                	push   (%esi)
+  801642:	e8 40 ff ff ff       	call   801587 <dev_lookup>
+  801647:	89 c3                	mov    %eax,%ebx
+  801649:	83 c4 10             	add    $0x10,%esp
+  80164c:	85 c0                	test   %eax,%eax
+  80164e:	78 1a                	js     80166a <fd_close+0x70>
+		if (dev->dev_close)
+  801650:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801653:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801656:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	74 0b                	je     80166a <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80165f:	83 ec 0c             	sub    $0xc,%esp
+  801662:	56                   	push   %esi
+  801663:	ff d0                	call   *%eax
+  801665:	89 c3                	mov    %eax,%ebx
+  801667:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80166a:	83 ec 08             	sub    $0x8,%esp
+  80166d:	56                   	push   %esi
+  80166e:	6a 00                	push   $0x0
+  801670:	e8 6b fa ff ff       	call   8010e0 <sys_page_unmap>
+	return r;
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	eb b5                	jmp    80162f <fd_close+0x35>
+
+0080167a <close>:
+
+int
+close(int fdnum)
+{
+  80167a:	55                   	push   %ebp
+  80167b:	89 e5                	mov    %esp,%ebp
+  80167d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801680:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801683:	50                   	push   %eax
+  801684:	ff 75 08             	push   0x8(%ebp)
+  801687:	e8 a9 fe ff ff       	call   801535 <fd_lookup>
+  80168c:	83 c4 10             	add    $0x10,%esp
+  80168f:	85 c0                	test   %eax,%eax
+  801691:	79 02                	jns    801695 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+		return fd_close(fd, 1);
+  801695:	83 ec 08             	sub    $0x8,%esp
+  801698:	6a 01                	push   $0x1
+  80169a:	ff 75 f4             	push   -0xc(%ebp)
+  80169d:	e8 58 ff ff ff       	call   8015fa <fd_close>
+  8016a2:	83 c4 10             	add    $0x10,%esp
+  8016a5:	eb ec                	jmp    801693 <close+0x19>
+
+008016a7 <close_all>:
+
+void
+close_all(void)
+{
+  8016a7:	55                   	push   %ebp
+  8016a8:	89 e5                	mov    %esp,%ebp
+  8016aa:	53                   	push   %ebx
+  8016ab:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016b3:	83 ec 0c             	sub    $0xc,%esp
+  8016b6:	53                   	push   %ebx
+  8016b7:	e8 be ff ff ff       	call   80167a <close>
+	for (i = 0; i < MAXFD; i++)
+  8016bc:	83 c3 01             	add    $0x1,%ebx
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8016c8:	75 e9                	jne    8016b3 <close_all+0xc>
+}
+  8016ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016cd:	c9                   	leave
+  8016ce:	c3                   	ret
+
+008016cf <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	57                   	push   %edi
+  8016d3:	56                   	push   %esi
+  8016d4:	53                   	push   %ebx
+  8016d5:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016db:	50                   	push   %eax
+  8016dc:	ff 75 08             	push   0x8(%ebp)
+  8016df:	e8 51 fe ff ff       	call   801535 <fd_lookup>
+  8016e4:	89 c3                	mov    %eax,%ebx
+  8016e6:	83 c4 10             	add    $0x10,%esp
+  8016e9:	85 c0                	test   %eax,%eax
+  8016eb:	78 7f                	js     80176c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016ed:	83 ec 0c             	sub    $0xc,%esp
+  8016f0:	ff 75 0c             	push   0xc(%ebp)
+  8016f3:	e8 82 ff ff ff       	call   80167a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016fb:	c1 e6 0c             	shl    $0xc,%esi
+  8016fe:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801704:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801707:	89 3c 24             	mov    %edi,(%esp)
+  80170a:	e8 bf fd ff ff       	call   8014ce <fd2data>
+  80170f:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801711:	89 34 24             	mov    %esi,(%esp)
+  801714:	e8 b5 fd ff ff       	call   8014ce <fd2data>
+  801719:	83 c4 10             	add    $0x10,%esp
+  80171c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80171f:	89 d8                	mov    %ebx,%eax
+  801721:	c1 e8 16             	shr    $0x16,%eax
+  801724:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80172b:	a8 01                	test   $0x1,%al
+  80172d:	74 11                	je     801740 <dup+0x71>
+  80172f:	89 d8                	mov    %ebx,%eax
+  801731:	c1 e8 0c             	shr    $0xc,%eax
+  801734:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80173b:	f6 c2 01             	test   $0x1,%dl
+  80173e:	75 36                	jne    801776 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801740:	89 f8                	mov    %edi,%eax
+  801742:	c1 e8 0c             	shr    $0xc,%eax
+  801745:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801754:	50                   	push   %eax
+  801755:	56                   	push   %esi
+  801756:	6a 00                	push   $0x0
+  801758:	57                   	push   %edi
+  801759:	6a 00                	push   $0x0
+  80175b:	e8 3e f9 ff ff       	call   80109e <sys_page_map>
+  801760:	89 c3                	mov    %eax,%ebx
+  801762:	83 c4 20             	add    $0x20,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 33                	js     80179c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801769:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80176c:	89 d8                	mov    %ebx,%eax
+  80176e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801771:	5b                   	pop    %ebx
+  801772:	5e                   	pop    %esi
+  801773:	5f                   	pop    %edi
+  801774:	5d                   	pop    %ebp
+  801775:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801776:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80177d:	83 ec 0c             	sub    $0xc,%esp
+  801780:	25 07 0e 00 00       	and    $0xe07,%eax
+  801785:	50                   	push   %eax
+  801786:	ff 75 d4             	push   -0x2c(%ebp)
+  801789:	6a 00                	push   $0x0
+  80178b:	53                   	push   %ebx
+  80178c:	6a 00                	push   $0x0
+  80178e:	e8 0b f9 ff ff       	call   80109e <sys_page_map>
+  801793:	89 c3                	mov    %eax,%ebx
+  801795:	83 c4 20             	add    $0x20,%esp
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	79 a4                	jns    801740 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80179c:	83 ec 08             	sub    $0x8,%esp
+  80179f:	56                   	push   %esi
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	e8 39 f9 ff ff       	call   8010e0 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017a7:	83 c4 08             	add    $0x8,%esp
+  8017aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ad:	6a 00                	push   $0x0
+  8017af:	e8 2c f9 ff ff       	call   8010e0 <sys_page_unmap>
+	return r;
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	eb b3                	jmp    80176c <dup+0x9d>
+
+008017b9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017b9:	55                   	push   %ebp
+  8017ba:	89 e5                	mov    %esp,%ebp
+  8017bc:	56                   	push   %esi
+  8017bd:	53                   	push   %ebx
+  8017be:	83 ec 18             	sub    $0x18,%esp
+  8017c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017c4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c7:	50                   	push   %eax
+  8017c8:	53                   	push   %ebx
+  8017c9:	e8 67 fd ff ff       	call   801535 <fd_lookup>
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	78 3c                	js     801811 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d8:	83 ec 08             	sub    $0x8,%esp
+  8017db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017de:	50                   	push   %eax
+  8017df:	ff 36                	push   (%esi)
+  8017e1:	e8 a1 fd ff ff       	call   801587 <dev_lookup>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 24                	js     801811 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017ed:	8b 46 08             	mov    0x8(%esi),%eax
+  8017f0:	83 e0 03             	and    $0x3,%eax
+  8017f3:	83 f8 01             	cmp    $0x1,%eax
+  8017f6:	74 20                	je     801818 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fb:	8b 40 08             	mov    0x8(%eax),%eax
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	74 54                	je     801856 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801802:	83 ec 04             	sub    $0x4,%esp
+  801805:	ff 75 10             	push   0x10(%ebp)
+  801808:	ff 75 0c             	push   0xc(%ebp)
+  80180b:	56                   	push   %esi
+  80180c:	ff d0                	call   *%eax
+  80180e:	83 c4 10             	add    $0x10,%esp
+}
+  801811:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5d                   	pop    %ebp
+  801817:	c3                   	ret
+  801818:	89 e2                	mov    %esp,%edx
+  80181a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80181f:	29 d0                	sub    %edx,%eax
+  801821:	89 c2                	mov    %eax,%edx
+  801823:	c1 ea 0f             	shr    $0xf,%edx
+  801826:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80182b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801830:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801833:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80183a:	8b 40 48             	mov    0x48(%eax),%eax
+  80183d:	83 ec 04             	sub    $0x4,%esp
+  801840:	53                   	push   %ebx
+  801841:	50                   	push   %eax
+  801842:	68 89 41 80 00       	push   $0x804189
+  801847:	e8 f4 eb ff ff       	call   800440 <cprintf>
+		return -E_INVAL;
+  80184c:	83 c4 10             	add    $0x10,%esp
+  80184f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801854:	eb bb                	jmp    801811 <read+0x58>
+		return -E_NOT_SUPP;
+  801856:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80185b:	eb b4                	jmp    801811 <read+0x58>
+
+0080185d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80185d:	55                   	push   %ebp
+  80185e:	89 e5                	mov    %esp,%ebp
+  801860:	57                   	push   %edi
+  801861:	56                   	push   %esi
+  801862:	53                   	push   %ebx
+  801863:	83 ec 0c             	sub    $0xc,%esp
+  801866:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801869:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80186c:	85 f6                	test   %esi,%esi
+  80186e:	74 30                	je     8018a0 <readn+0x43>
+  801870:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801875:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	89 f2                	mov    %esi,%edx
+  80187f:	29 c2                	sub    %eax,%edx
+  801881:	52                   	push   %edx
+  801882:	01 f8                	add    %edi,%eax
+  801884:	50                   	push   %eax
+  801885:	ff 75 08             	push   0x8(%ebp)
+  801888:	e8 2c ff ff ff       	call   8017b9 <read>
+		if (m < 0)
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 15                	js     8018a9 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801894:	74 11                	je     8018a7 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801896:	01 c3                	add    %eax,%ebx
+  801898:	89 d8                	mov    %ebx,%eax
+  80189a:	39 f3                	cmp    %esi,%ebx
+  80189c:	72 dc                	jb     80187a <readn+0x1d>
+  80189e:	eb 09                	jmp    8018a9 <readn+0x4c>
+  8018a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a5:	eb 02                	jmp    8018a9 <readn+0x4c>
+  8018a7:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8018a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+
+008018b1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	56                   	push   %esi
+  8018b5:	53                   	push   %ebx
+  8018b6:	83 ec 18             	sub    $0x18,%esp
+  8018b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018bf:	50                   	push   %eax
+  8018c0:	53                   	push   %ebx
+  8018c1:	e8 6f fc ff ff       	call   801535 <fd_lookup>
+  8018c6:	83 c4 10             	add    $0x10,%esp
+  8018c9:	85 c0                	test   %eax,%eax
+  8018cb:	78 37                	js     801904 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d0:	83 ec 08             	sub    $0x8,%esp
+  8018d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018d6:	50                   	push   %eax
+  8018d7:	ff 36                	push   (%esi)
+  8018d9:	e8 a9 fc ff ff       	call   801587 <dev_lookup>
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	85 c0                	test   %eax,%eax
+  8018e3:	78 1f                	js     801904 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018e5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018e9:	74 20                	je     80190b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	74 54                	je     801949 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018f5:	83 ec 04             	sub    $0x4,%esp
+  8018f8:	ff 75 10             	push   0x10(%ebp)
+  8018fb:	ff 75 0c             	push   0xc(%ebp)
+  8018fe:	56                   	push   %esi
+  8018ff:	ff d0                	call   *%eax
+  801901:	83 c4 10             	add    $0x10,%esp
+}
+  801904:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801907:	5b                   	pop    %ebx
+  801908:	5e                   	pop    %esi
+  801909:	5d                   	pop    %ebp
+  80190a:	c3                   	ret
+  80190b:	89 e2                	mov    %esp,%edx
+  80190d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801912:	29 d0                	sub    %edx,%eax
+  801914:	89 c2                	mov    %eax,%edx
+  801916:	c1 ea 0f             	shr    $0xf,%edx
+  801919:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80191e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801923:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801926:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80192d:	8b 40 48             	mov    0x48(%eax),%eax
+  801930:	83 ec 04             	sub    $0x4,%esp
+  801933:	53                   	push   %ebx
+  801934:	50                   	push   %eax
+  801935:	68 a5 41 80 00       	push   $0x8041a5
+  80193a:	e8 01 eb ff ff       	call   800440 <cprintf>
+		return -E_INVAL;
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801947:	eb bb                	jmp    801904 <write+0x53>
+		return -E_NOT_SUPP;
+  801949:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80194e:	eb b4                	jmp    801904 <write+0x53>
+
+00801950 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801950:	55                   	push   %ebp
+  801951:	89 e5                	mov    %esp,%ebp
+  801953:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801959:	50                   	push   %eax
+  80195a:	ff 75 08             	push   0x8(%ebp)
+  80195d:	e8 d3 fb ff ff       	call   801535 <fd_lookup>
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	85 c0                	test   %eax,%eax
+  801967:	78 0e                	js     801977 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801969:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80196c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80196f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801972:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801977:	c9                   	leave
+  801978:	c3                   	ret
+
+00801979 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	53                   	push   %ebx
+  80197d:	83 ec 1c             	sub    $0x1c,%esp
+  801980:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801983:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801986:	50                   	push   %eax
+  801987:	ff 75 08             	push   0x8(%ebp)
+  80198a:	e8 a6 fb ff ff       	call   801535 <fd_lookup>
+  80198f:	83 c4 10             	add    $0x10,%esp
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 33                	js     8019c9 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801996:	83 fb 03             	cmp    $0x3,%ebx
+  801999:	74 28                	je     8019c3 <fcntl+0x4a>
+  80199b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019a0:	83 fb 04             	cmp    $0x4,%ebx
+  8019a3:	75 24                	jne    8019c9 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8019a5:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8019a8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8019ab:	80 e4 ef             	and    $0xef,%ah
+  8019ae:	8b 55 10             	mov    0x10(%ebp),%edx
+  8019b1:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8019b7:	09 d0                	or     %edx,%eax
+  8019b9:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8019bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c1:	eb 06                	jmp    8019c9 <fcntl+0x50>
+		return fd->fd_omode;
+  8019c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c6:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8019c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019cc:	c9                   	leave
+  8019cd:	c3                   	ret
+
+008019ce <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019ce:	55                   	push   %ebp
+  8019cf:	89 e5                	mov    %esp,%ebp
+  8019d1:	56                   	push   %esi
+  8019d2:	53                   	push   %ebx
+  8019d3:	83 ec 18             	sub    $0x18,%esp
+  8019d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019dc:	50                   	push   %eax
+  8019dd:	53                   	push   %ebx
+  8019de:	e8 52 fb ff ff       	call   801535 <fd_lookup>
+  8019e3:	83 c4 10             	add    $0x10,%esp
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	78 34                	js     801a1e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f3:	50                   	push   %eax
+  8019f4:	ff 36                	push   (%esi)
+  8019f6:	e8 8c fb ff ff       	call   801587 <dev_lookup>
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	78 1c                	js     801a1e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a02:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a06:	74 1d                	je     801a25 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801a08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0b:	8b 40 18             	mov    0x18(%eax),%eax
+  801a0e:	85 c0                	test   %eax,%eax
+  801a10:	74 51                	je     801a63 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801a12:	83 ec 08             	sub    $0x8,%esp
+  801a15:	ff 75 0c             	push   0xc(%ebp)
+  801a18:	56                   	push   %esi
+  801a19:	ff d0                	call   *%eax
+  801a1b:	83 c4 10             	add    $0x10,%esp
+}
+  801a1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a21:	5b                   	pop    %ebx
+  801a22:	5e                   	pop    %esi
+  801a23:	5d                   	pop    %ebp
+  801a24:	c3                   	ret
+  801a25:	89 e2                	mov    %esp,%edx
+  801a27:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a2c:	29 d0                	sub    %edx,%eax
+  801a2e:	89 c2                	mov    %eax,%edx
+  801a30:	c1 ea 0f             	shr    $0xf,%edx
+  801a33:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3d:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801a40:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  801a47:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a4a:	83 ec 04             	sub    $0x4,%esp
+  801a4d:	53                   	push   %ebx
+  801a4e:	50                   	push   %eax
+  801a4f:	68 68 41 80 00       	push   $0x804168
+  801a54:	e8 e7 e9 ff ff       	call   800440 <cprintf>
+		return -E_INVAL;
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a61:	eb bb                	jmp    801a1e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801a63:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a68:	eb b4                	jmp    801a1e <ftruncate+0x50>
+
+00801a6a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a6a:	55                   	push   %ebp
+  801a6b:	89 e5                	mov    %esp,%ebp
+  801a6d:	56                   	push   %esi
+  801a6e:	53                   	push   %ebx
+  801a6f:	83 ec 18             	sub    $0x18,%esp
+  801a72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a75:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a78:	50                   	push   %eax
+  801a79:	ff 75 08             	push   0x8(%ebp)
+  801a7c:	e8 b4 fa ff ff       	call   801535 <fd_lookup>
+  801a81:	83 c4 10             	add    $0x10,%esp
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 53                	js     801adb <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a88:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	ff 36                	push   (%esi)
+  801a94:	e8 ee fa ff ff       	call   801587 <dev_lookup>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 3b                	js     801adb <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa3:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801aa7:	74 39                	je     801ae2 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801aa9:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801aac:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ab3:	00 00 00 
+	stat->st_isdir = 0;
+  801ab6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801abd:	00 00 00 
+	stat->st_version = 0;
+  801ac0:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801ac7:	00 00 00 
+	stat->st_dev = dev;
+  801aca:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801ad0:	83 ec 08             	sub    $0x8,%esp
+  801ad3:	53                   	push   %ebx
+  801ad4:	56                   	push   %esi
+  801ad5:	ff 50 14             	call   *0x14(%eax)
+  801ad8:	83 c4 10             	add    $0x10,%esp
+}
+  801adb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ade:	5b                   	pop    %ebx
+  801adf:	5e                   	pop    %esi
+  801ae0:	5d                   	pop    %ebp
+  801ae1:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ae2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ae7:	eb f2                	jmp    801adb <fstat+0x71>
+
+00801ae9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	56                   	push   %esi
+  801aed:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801aee:	83 ec 08             	sub    $0x8,%esp
+  801af1:	6a 00                	push   $0x0
+  801af3:	ff 75 08             	push   0x8(%ebp)
+  801af6:	e8 b7 01 00 00       	call   801cb2 <open>
+  801afb:	89 c3                	mov    %eax,%ebx
+  801afd:	83 c4 10             	add    $0x10,%esp
+  801b00:	85 c0                	test   %eax,%eax
+  801b02:	78 1b                	js     801b1f <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801b04:	83 ec 08             	sub    $0x8,%esp
+  801b07:	ff 75 0c             	push   0xc(%ebp)
+  801b0a:	50                   	push   %eax
+  801b0b:	e8 5a ff ff ff       	call   801a6a <fstat>
+  801b10:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801b12:	89 1c 24             	mov    %ebx,(%esp)
+  801b15:	e8 60 fb ff ff       	call   80167a <close>
+	return r;
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	89 f3                	mov    %esi,%ebx
+}
+  801b1f:	89 d8                	mov    %ebx,%eax
+  801b21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b24:	5b                   	pop    %ebx
+  801b25:	5e                   	pop    %esi
+  801b26:	5d                   	pop    %ebp
+  801b27:	c3                   	ret
+
+00801b28 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b28:	55                   	push   %ebp
+  801b29:	89 e5                	mov    %esp,%ebp
+  801b2b:	56                   	push   %esi
+  801b2c:	53                   	push   %ebx
+  801b2d:	89 c6                	mov    %eax,%esi
+  801b2f:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801b31:	83 3d 20 64 80 00 00 	cmpl   $0x0,0x806420
+  801b38:	74 27                	je     801b61 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b3a:	6a 07                	push   $0x7
+  801b3c:	68 00 70 80 00       	push   $0x807000
+  801b41:	56                   	push   %esi
+  801b42:	ff 35 20 64 80 00    	push   0x806420
+  801b48:	e8 16 1f 00 00       	call   803a63 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801b4d:	83 c4 0c             	add    $0xc,%esp
+  801b50:	6a 00                	push   $0x0
+  801b52:	53                   	push   %ebx
+  801b53:	6a 00                	push   $0x0
+  801b55:	e8 79 1c 00 00       	call   8037d3 <ipc_recv>
+}
+  801b5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b5d:	5b                   	pop    %ebx
+  801b5e:	5e                   	pop    %esi
+  801b5f:	5d                   	pop    %ebp
+  801b60:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b61:	83 ec 0c             	sub    $0xc,%esp
+  801b64:	6a 02                	push   $0x2
+  801b66:	e8 61 1f 00 00       	call   803acc <ipc_find_env>
+  801b6b:	a3 20 64 80 00       	mov    %eax,0x806420
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	eb c5                	jmp    801b3a <fsipc+0x12>
+
+00801b75 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b81:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801b86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b89:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b93:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b98:	e8 8b ff ff ff       	call   801b28 <fsipc>
+}
+  801b9d:	c9                   	leave
+  801b9e:	c3                   	ret
+
+00801b9f <devfile_flush>:
+{
+  801b9f:	55                   	push   %ebp
+  801ba0:	89 e5                	mov    %esp,%ebp
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bab:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801bb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb5:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bba:	e8 69 ff ff ff       	call   801b28 <fsipc>
+}
+  801bbf:	c9                   	leave
+  801bc0:	c3                   	ret
+
+00801bc1 <devfile_stat>:
+{
+  801bc1:	55                   	push   %ebp
+  801bc2:	89 e5                	mov    %esp,%ebp
+  801bc4:	53                   	push   %ebx
+  801bc5:	83 ec 04             	sub    $0x4,%esp
+  801bc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bce:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd1:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdb:	b8 05 00 00 00       	mov    $0x5,%eax
+  801be0:	e8 43 ff ff ff       	call   801b28 <fsipc>
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 37                	js     801c20 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801be9:	83 ec 08             	sub    $0x8,%esp
+  801bec:	68 00 70 80 00       	push   $0x807000
+  801bf1:	53                   	push   %ebx
+  801bf2:	e8 30 f0 ff ff       	call   800c27 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801bf7:	a1 80 70 80 00       	mov    0x807080,%eax
+  801bfc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c02:	a1 84 70 80 00       	mov    0x807084,%eax
+  801c07:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801c0d:	a1 88 70 80 00       	mov    0x807088,%eax
+  801c12:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c23:	c9                   	leave
+  801c24:	c3                   	ret
+
+00801c25 <devfile_write>:
+{
+  801c25:	55                   	push   %ebp
+  801c26:	89 e5                	mov    %esp,%ebp
+  801c28:	83 ec 0c             	sub    $0xc,%esp
+  801c2b:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801c2e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801c33:	39 d0                	cmp    %edx,%eax
+  801c35:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c38:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c3b:	8b 52 0c             	mov    0xc(%edx),%edx
+  801c3e:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801c44:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801c49:	50                   	push   %eax
+  801c4a:	ff 75 0c             	push   0xc(%ebp)
+  801c4d:	68 08 70 80 00       	push   $0x807008
+  801c52:	e8 80 f1 ff ff       	call   800dd7 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c61:	e8 c2 fe ff ff       	call   801b28 <fsipc>
+}
+  801c66:	c9                   	leave
+  801c67:	c3                   	ret
+
+00801c68 <devfile_read>:
+{
+  801c68:	55                   	push   %ebp
+  801c69:	89 e5                	mov    %esp,%ebp
+  801c6b:	53                   	push   %ebx
+  801c6c:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c72:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c75:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801c7a:	8b 45 10             	mov    0x10(%ebp),%eax
+  801c7d:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801c82:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801c87:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c8c:	e8 97 fe ff ff       	call   801b28 <fsipc>
+  801c91:	89 c3                	mov    %eax,%ebx
+  801c93:	85 c0                	test   %eax,%eax
+  801c95:	78 14                	js     801cab <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801c97:	83 ec 04             	sub    $0x4,%esp
+  801c9a:	50                   	push   %eax
+  801c9b:	68 00 70 80 00       	push   $0x807000
+  801ca0:	ff 75 0c             	push   0xc(%ebp)
+  801ca3:	e8 2f f1 ff ff       	call   800dd7 <memmove>
+	return r;
+  801ca8:	83 c4 10             	add    $0x10,%esp
+}
+  801cab:	89 d8                	mov    %ebx,%eax
+  801cad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb0:	c9                   	leave
+  801cb1:	c3                   	ret
+
+00801cb2 <open>:
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	53                   	push   %ebx
+  801cb6:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801cb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbc:	50                   	push   %eax
+  801cbd:	e8 23 f8 ff ff       	call   8014e5 <fd_alloc>
+  801cc2:	89 c3                	mov    %eax,%ebx
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 2a                	js     801cf5 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801ccb:	83 ec 0c             	sub    $0xc,%esp
+  801cce:	ff 75 08             	push   0x8(%ebp)
+  801cd1:	e8 05 ef ff ff       	call   800bdb <strlen>
+  801cd6:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801cd9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801cde:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ce3:	7e 17                	jle    801cfc <open+0x4a>
+	fd_close(fd, 1);
+  801ce5:	83 ec 08             	sub    $0x8,%esp
+  801ce8:	6a 01                	push   $0x1
+  801cea:	ff 75 f4             	push   -0xc(%ebp)
+  801ced:	e8 08 f9 ff ff       	call   8015fa <fd_close>
+	return r;
+  801cf2:	83 c4 10             	add    $0x10,%esp
+}
+  801cf5:	89 d8                	mov    %ebx,%eax
+  801cf7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cfa:	c9                   	leave
+  801cfb:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801cfc:	83 ec 08             	sub    $0x8,%esp
+  801cff:	ff 75 08             	push   0x8(%ebp)
+  801d02:	68 00 70 80 00       	push   $0x807000
+  801d07:	e8 1b ef ff ff       	call   800c27 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d0f:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801d14:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d1c:	e8 07 fe ff ff       	call   801b28 <fsipc>
+  801d21:	89 c3                	mov    %eax,%ebx
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	78 bb                	js     801ce5 <open+0x33>
+	return fd2num(fd); 	
+  801d2a:	83 ec 0c             	sub    $0xc,%esp
+  801d2d:	ff 75 f4             	push   -0xc(%ebp)
+  801d30:	e8 89 f7 ff ff       	call   8014be <fd2num>
+  801d35:	89 c3                	mov    %eax,%ebx
+  801d37:	83 c4 10             	add    $0x10,%esp
+  801d3a:	eb b9                	jmp    801cf5 <open+0x43>
+
+00801d3c <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801d3c:	55                   	push   %ebp
+  801d3d:	89 e5                	mov    %esp,%ebp
+  801d3f:	53                   	push   %ebx
+  801d40:	83 ec 1c             	sub    $0x1c,%esp
+  801d43:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d49:	50                   	push   %eax
+  801d4a:	ff 75 08             	push   0x8(%ebp)
+  801d4d:	e8 e3 f7 ff ff       	call   801535 <fd_lookup>
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 5a                	js     801db3 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801d59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801d62:	39 10                	cmp    %edx,(%eax)
+  801d64:	75 66                	jne    801dcc <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801d66:	83 3d 20 64 80 00 00 	cmpl   $0x0,0x806420
+  801d6d:	74 49                	je     801db8 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d72:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d75:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801d7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d7d:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801d82:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801d88:	6a 07                	push   $0x7
+  801d8a:	68 00 70 80 00       	push   $0x807000
+  801d8f:	6a 09                	push   $0x9
+  801d91:	ff 35 20 64 80 00    	push   0x806420
+  801d97:	e8 c7 1c 00 00       	call   803a63 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801d9c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801da3:	6a 00                	push   $0x0
+  801da5:	53                   	push   %ebx
+  801da6:	ff 75 10             	push   0x10(%ebp)
+  801da9:	6a 00                	push   $0x0
+  801dab:	e8 f0 1a 00 00       	call   8038a0 <ipc_recv_pages>
+  801db0:	83 c4 20             	add    $0x20,%esp
+}
+  801db3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db6:	c9                   	leave
+  801db7:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801db8:	83 ec 0c             	sub    $0xc,%esp
+  801dbb:	6a 02                	push   $0x2
+  801dbd:	e8 0a 1d 00 00       	call   803acc <ipc_find_env>
+  801dc2:	a3 20 64 80 00       	mov    %eax,0x806420
+  801dc7:	83 c4 10             	add    $0x10,%esp
+  801dca:	eb a3                	jmp    801d6f <fmap+0x33>
+		return -E_INVAL;
+  801dcc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd1:	eb e0                	jmp    801db3 <fmap+0x77>
+
+00801dd3 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801dd3:	55                   	push   %ebp
+  801dd4:	89 e5                	mov    %esp,%ebp
+  801dd6:	53                   	push   %ebx
+  801dd7:	83 ec 10             	sub    $0x10,%esp
+  801dda:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801ddd:	53                   	push   %ebx
+  801dde:	e8 f8 ed ff ff       	call   800bdb <strlen>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801deb:	7f 25                	jg     801e12 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	53                   	push   %ebx
+  801df1:	68 00 70 80 00       	push   $0x807000
+  801df6:	e8 2c ee ff ff       	call   800c27 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801dfb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e00:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e05:	e8 1e fd ff ff       	call   801b28 <fsipc>
+  801e0a:	83 c4 10             	add    $0x10,%esp
+}
+  801e0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e10:	c9                   	leave
+  801e11:	c3                   	ret
+		return -E_BAD_PATH;
+  801e12:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e17:	eb f4                	jmp    801e0d <remove+0x3a>
+
+00801e19 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e19:	55                   	push   %ebp
+  801e1a:	89 e5                	mov    %esp,%ebp
+  801e1c:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e24:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e29:	e8 fa fc ff ff       	call   801b28 <fsipc>
+}
+  801e2e:	c9                   	leave
+  801e2f:	c3                   	ret
+
+00801e30 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801e30:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801e34:	7f 01                	jg     801e37 <writebuf+0x7>
+  801e36:	c3                   	ret
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	53                   	push   %ebx
+  801e3b:	83 ec 08             	sub    $0x8,%esp
+  801e3e:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801e40:	ff 70 04             	push   0x4(%eax)
+  801e43:	8d 40 10             	lea    0x10(%eax),%eax
+  801e46:	50                   	push   %eax
+  801e47:	ff 33                	push   (%ebx)
+  801e49:	e8 63 fa ff ff       	call   8018b1 <write>
+		if (result > 0)
+  801e4e:	83 c4 10             	add    $0x10,%esp
+  801e51:	85 c0                	test   %eax,%eax
+  801e53:	7e 03                	jle    801e58 <writebuf+0x28>
+			b->result += result;
+  801e55:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801e58:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e5b:	74 0d                	je     801e6a <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e64:	0f 4f c2             	cmovg  %edx,%eax
+  801e67:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801e6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6d:	c9                   	leave
+  801e6e:	c3                   	ret
+
+00801e6f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801e6f:	55                   	push   %ebp
+  801e70:	89 e5                	mov    %esp,%ebp
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 04             	sub    $0x4,%esp
+  801e76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801e79:	8b 53 04             	mov    0x4(%ebx),%edx
+  801e7c:	8d 42 01             	lea    0x1(%edx),%eax
+  801e7f:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e85:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801e89:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801e8e:	74 05                	je     801e95 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801e90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e93:	c9                   	leave
+  801e94:	c3                   	ret
+		writebuf(b);
+  801e95:	89 d8                	mov    %ebx,%eax
+  801e97:	e8 94 ff ff ff       	call   801e30 <writebuf>
+		b->idx = 0;
+  801e9c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801ea3:	eb eb                	jmp    801e90 <putch+0x21>
+
+00801ea5 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801eae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb1:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801eb7:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801ebe:	00 00 00 
+	b.result = 0;
+  801ec1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801ec8:	00 00 00 
+	b.error = 1;
+  801ecb:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801ed2:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801ed5:	ff 75 10             	push   0x10(%ebp)
+  801ed8:	ff 75 0c             	push   0xc(%ebp)
+  801edb:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801ee1:	50                   	push   %eax
+  801ee2:	68 6f 1e 80 00       	push   $0x801e6f
+  801ee7:	e8 53 e6 ff ff       	call   80053f <vprintfmt>
+	if (b.idx > 0)
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801ef6:	7f 12                	jg     801f0a <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801ef8:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	75 06                	jne    801f08 <vfprintf+0x63>
+  801f02:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801f08:	c9                   	leave
+  801f09:	c3                   	ret
+		writebuf(&b);
+  801f0a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801f10:	e8 1b ff ff ff       	call   801e30 <writebuf>
+  801f15:	eb e1                	jmp    801ef8 <vfprintf+0x53>
+
+00801f17 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801f17:	55                   	push   %ebp
+  801f18:	89 e5                	mov    %esp,%ebp
+  801f1a:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f1d:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801f20:	50                   	push   %eax
+  801f21:	ff 75 0c             	push   0xc(%ebp)
+  801f24:	ff 75 08             	push   0x8(%ebp)
+  801f27:	e8 79 ff ff ff       	call   801ea5 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801f2c:	c9                   	leave
+  801f2d:	c3                   	ret
+
+00801f2e <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801f2e:	55                   	push   %ebp
+  801f2f:	89 e5                	mov    %esp,%ebp
+  801f31:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f34:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801f37:	50                   	push   %eax
+  801f38:	ff 75 08             	push   0x8(%ebp)
+  801f3b:	6a 01                	push   $0x1
+  801f3d:	e8 63 ff ff ff       	call   801ea5 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801f42:	c9                   	leave
+  801f43:	c3                   	ret
+
+00801f44 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f44:	55                   	push   %ebp
+  801f45:	89 e5                	mov    %esp,%ebp
+  801f47:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801f4a:	68 d8 41 80 00       	push   $0x8041d8
+  801f4f:	ff 75 0c             	push   0xc(%ebp)
+  801f52:	e8 d0 ec ff ff       	call   800c27 <strcpy>
+	return 0;
+}
+  801f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f5c:	c9                   	leave
+  801f5d:	c3                   	ret
+
+00801f5e <devsock_close>:
+{
+  801f5e:	55                   	push   %ebp
+  801f5f:	89 e5                	mov    %esp,%ebp
+  801f61:	53                   	push   %ebx
+  801f62:	83 ec 10             	sub    $0x10,%esp
+  801f65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801f68:	53                   	push   %ebx
+  801f69:	e8 9d 1b 00 00       	call   803b0b <pageref>
+  801f6e:	89 c2                	mov    %eax,%edx
+  801f70:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f73:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801f78:	83 fa 01             	cmp    $0x1,%edx
+  801f7b:	74 05                	je     801f82 <devsock_close+0x24>
+}
+  801f7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f80:	c9                   	leave
+  801f81:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801f82:	83 ec 0c             	sub    $0xc,%esp
+  801f85:	ff 73 0c             	push   0xc(%ebx)
+  801f88:	e8 b0 05 00 00       	call   80253d <nsipc_close>
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	eb eb                	jmp    801f7d <devsock_close+0x1f>
+
+00801f92 <devsock_write>:
+{
+  801f92:	55                   	push   %ebp
+  801f93:	89 e5                	mov    %esp,%ebp
+  801f95:	53                   	push   %ebx
+  801f96:	83 ec 14             	sub    $0x14,%esp
+  801f99:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801f9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801f9f:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801fa2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801fa5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801fa8:	8b 41 08             	mov    0x8(%ecx),%eax
+  801fab:	c1 f8 09             	sar    $0x9,%eax
+  801fae:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801fb1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801fb7:	77 13                	ja     801fcc <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801fb9:	50                   	push   %eax
+  801fba:	52                   	push   %edx
+  801fbb:	53                   	push   %ebx
+  801fbc:	ff 71 0c             	push   0xc(%ecx)
+  801fbf:	e8 5c 06 00 00       	call   802620 <nsipc_send>
+  801fc4:	83 c4 10             	add    $0x10,%esp
+}
+  801fc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801fcc:	50                   	push   %eax
+  801fcd:	6a 01                	push   $0x1
+  801fcf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fd2:	50                   	push   %eax
+  801fd3:	ff 71 0c             	push   0xc(%ecx)
+  801fd6:	e8 a6 06 00 00       	call   802681 <nsipc_sendmsg>
+  801fdb:	83 c4 10             	add    $0x10,%esp
+  801fde:	eb e7                	jmp    801fc7 <devsock_write+0x35>
+
+00801fe0 <devsock_read>:
+{
+  801fe0:	55                   	push   %ebp
+  801fe1:	89 e5                	mov    %esp,%ebp
+  801fe3:	53                   	push   %ebx
+  801fe4:	83 ec 14             	sub    $0x14,%esp
+  801fe7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801fed:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801ff0:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801ff3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ff6:	8b 41 08             	mov    0x8(%ecx),%eax
+  801ff9:	c1 f8 09             	sar    $0x9,%eax
+  801ffc:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801fff:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802005:	77 13                	ja     80201a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802007:	50                   	push   %eax
+  802008:	52                   	push   %edx
+  802009:	53                   	push   %ebx
+  80200a:	ff 71 0c             	push   0xc(%ecx)
+  80200d:	e8 9c 05 00 00       	call   8025ae <nsipc_recv>
+  802012:	83 c4 10             	add    $0x10,%esp
+}
+  802015:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802018:	c9                   	leave
+  802019:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80201a:	50                   	push   %eax
+  80201b:	6a 01                	push   $0x1
+  80201d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802020:	50                   	push   %eax
+  802021:	ff 71 0c             	push   0xc(%ecx)
+  802024:	e8 02 0a 00 00       	call   802a2b <nsipc_recvmsg>
+  802029:	83 c4 10             	add    $0x10,%esp
+  80202c:	eb e7                	jmp    802015 <devsock_read+0x35>
+
+0080202e <fd2sockid>:
+{
+  80202e:	55                   	push   %ebp
+  80202f:	89 e5                	mov    %esp,%ebp
+  802031:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802034:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802037:	52                   	push   %edx
+  802038:	50                   	push   %eax
+  802039:	e8 f7 f4 ff ff       	call   801535 <fd_lookup>
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 10                	js     802055 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802045:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802048:	8b 0d 60 50 80 00    	mov    0x805060,%ecx
+  80204e:	39 08                	cmp    %ecx,(%eax)
+  802050:	75 05                	jne    802057 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802052:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802055:	c9                   	leave
+  802056:	c3                   	ret
+		return -E_NOT_SUPP;
+  802057:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80205c:	eb f7                	jmp    802055 <fd2sockid+0x27>
+
+0080205e <sock_flags>:
+{
+  80205e:	55                   	push   %ebp
+  80205f:	89 e5                	mov    %esp,%ebp
+  802061:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802064:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802067:	52                   	push   %edx
+  802068:	50                   	push   %eax
+  802069:	e8 c7 f4 ff ff       	call   801535 <fd_lookup>
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 0e                	js     802083 <sock_flags+0x25>
+  802075:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802078:	8b 40 08             	mov    0x8(%eax),%eax
+  80207b:	c1 e8 09             	shr    $0x9,%eax
+  80207e:	83 e0 08             	and    $0x8,%eax
+}
+  802081:	c9                   	leave
+  802082:	c3                   	ret
+		return 0;
+  802083:	b8 00 00 00 00       	mov    $0x0,%eax
+  802088:	eb f7                	jmp    802081 <sock_flags+0x23>
+
+0080208a <alloc_sockfd>:
+{
+  80208a:	55                   	push   %ebp
+  80208b:	89 e5                	mov    %esp,%ebp
+  80208d:	56                   	push   %esi
+  80208e:	53                   	push   %ebx
+  80208f:	83 ec 1c             	sub    $0x1c,%esp
+  802092:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802094:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802097:	50                   	push   %eax
+  802098:	e8 48 f4 ff ff       	call   8014e5 <fd_alloc>
+  80209d:	89 c3                	mov    %eax,%ebx
+  80209f:	83 c4 10             	add    $0x10,%esp
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	78 43                	js     8020e9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8020a6:	83 ec 04             	sub    $0x4,%esp
+  8020a9:	68 07 04 00 00       	push   $0x407
+  8020ae:	ff 75 f4             	push   -0xc(%ebp)
+  8020b1:	6a 00                	push   $0x0
+  8020b3:	e8 a3 ef ff ff       	call   80105b <sys_page_alloc>
+  8020b8:	89 c3                	mov    %eax,%ebx
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 28                	js     8020e9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8020c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c4:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  8020ca:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8020cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020cf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8020d6:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8020d9:	83 ec 0c             	sub    $0xc,%esp
+  8020dc:	50                   	push   %eax
+  8020dd:	e8 dc f3 ff ff       	call   8014be <fd2num>
+  8020e2:	89 c3                	mov    %eax,%ebx
+  8020e4:	83 c4 10             	add    $0x10,%esp
+  8020e7:	eb 0c                	jmp    8020f5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8020e9:	83 ec 0c             	sub    $0xc,%esp
+  8020ec:	56                   	push   %esi
+  8020ed:	e8 4b 04 00 00       	call   80253d <nsipc_close>
+		return r;
+  8020f2:	83 c4 10             	add    $0x10,%esp
+}
+  8020f5:	89 d8                	mov    %ebx,%eax
+  8020f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fa:	5b                   	pop    %ebx
+  8020fb:	5e                   	pop    %esi
+  8020fc:	5d                   	pop    %ebp
+  8020fd:	c3                   	ret
+
+008020fe <accept>:
+{
+  8020fe:	55                   	push   %ebp
+  8020ff:	89 e5                	mov    %esp,%ebp
+  802101:	56                   	push   %esi
+  802102:	53                   	push   %ebx
+  802103:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802106:	89 f0                	mov    %esi,%eax
+  802108:	e8 21 ff ff ff       	call   80202e <fd2sockid>
+  80210d:	89 c3                	mov    %eax,%ebx
+  80210f:	85 c0                	test   %eax,%eax
+  802111:	78 24                	js     802137 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802113:	89 f0                	mov    %esi,%eax
+  802115:	e8 44 ff ff ff       	call   80205e <sock_flags>
+  80211a:	50                   	push   %eax
+  80211b:	ff 75 10             	push   0x10(%ebp)
+  80211e:	ff 75 0c             	push   0xc(%ebp)
+  802121:	53                   	push   %ebx
+  802122:	e8 6b 03 00 00       	call   802492 <nsipc_accept>
+  802127:	89 c3                	mov    %eax,%ebx
+  802129:	83 c4 10             	add    $0x10,%esp
+  80212c:	85 c0                	test   %eax,%eax
+  80212e:	78 07                	js     802137 <accept+0x39>
+	return alloc_sockfd(r);
+  802130:	e8 55 ff ff ff       	call   80208a <alloc_sockfd>
+  802135:	89 c3                	mov    %eax,%ebx
+}
+  802137:	89 d8                	mov    %ebx,%eax
+  802139:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80213c:	5b                   	pop    %ebx
+  80213d:	5e                   	pop    %esi
+  80213e:	5d                   	pop    %ebp
+  80213f:	c3                   	ret
+
+00802140 <bind>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802146:	8b 45 08             	mov    0x8(%ebp),%eax
+  802149:	e8 e0 fe ff ff       	call   80202e <fd2sockid>
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 12                	js     802164 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802152:	83 ec 04             	sub    $0x4,%esp
+  802155:	ff 75 10             	push   0x10(%ebp)
+  802158:	ff 75 0c             	push   0xc(%ebp)
+  80215b:	50                   	push   %eax
+  80215c:	e8 85 03 00 00       	call   8024e6 <nsipc_bind>
+  802161:	83 c4 10             	add    $0x10,%esp
+}
+  802164:	c9                   	leave
+  802165:	c3                   	ret
+
+00802166 <shutdown>:
+{
+  802166:	55                   	push   %ebp
+  802167:	89 e5                	mov    %esp,%ebp
+  802169:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80216c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216f:	e8 ba fe ff ff       	call   80202e <fd2sockid>
+  802174:	85 c0                	test   %eax,%eax
+  802176:	78 0f                	js     802187 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802178:	83 ec 08             	sub    $0x8,%esp
+  80217b:	ff 75 0c             	push   0xc(%ebp)
+  80217e:	50                   	push   %eax
+  80217f:	e8 97 03 00 00       	call   80251b <nsipc_shutdown>
+  802184:	83 c4 10             	add    $0x10,%esp
+}
+  802187:	c9                   	leave
+  802188:	c3                   	ret
+
+00802189 <connect>:
+{
+  802189:	55                   	push   %ebp
+  80218a:	89 e5                	mov    %esp,%ebp
+  80218c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80218f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802192:	e8 97 fe ff ff       	call   80202e <fd2sockid>
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 12                	js     8021ad <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80219b:	83 ec 04             	sub    $0x4,%esp
+  80219e:	ff 75 10             	push   0x10(%ebp)
+  8021a1:	ff 75 0c             	push   0xc(%ebp)
+  8021a4:	50                   	push   %eax
+  8021a5:	e8 ad 03 00 00       	call   802557 <nsipc_connect>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+}
+  8021ad:	c9                   	leave
+  8021ae:	c3                   	ret
+
+008021af <listen>:
+{
+  8021af:	55                   	push   %ebp
+  8021b0:	89 e5                	mov    %esp,%ebp
+  8021b2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8021b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b8:	e8 71 fe ff ff       	call   80202e <fd2sockid>
+  8021bd:	85 c0                	test   %eax,%eax
+  8021bf:	78 0f                	js     8021d0 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8021c1:	83 ec 08             	sub    $0x8,%esp
+  8021c4:	ff 75 0c             	push   0xc(%ebp)
+  8021c7:	50                   	push   %eax
+  8021c8:	e8 bf 03 00 00       	call   80258c <nsipc_listen>
+  8021cd:	83 c4 10             	add    $0x10,%esp
+}
+  8021d0:	c9                   	leave
+  8021d1:	c3                   	ret
+
+008021d2 <sendmsg>:
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	57                   	push   %edi
+  8021d6:	56                   	push   %esi
+  8021d7:	53                   	push   %ebx
+  8021d8:	83 ec 0c             	sub    $0xc,%esp
+  8021db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8021e1:	89 f0                	mov    %esi,%eax
+  8021e3:	e8 46 fe ff ff       	call   80202e <fd2sockid>
+  8021e8:	89 c3                	mov    %eax,%ebx
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 1c                	js     80220a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8021ee:	89 f0                	mov    %esi,%eax
+  8021f0:	e8 69 fe ff ff       	call   80205e <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8021f5:	0b 45 10             	or     0x10(%ebp),%eax
+  8021f8:	50                   	push   %eax
+  8021f9:	ff 77 0c             	push   0xc(%edi)
+  8021fc:	ff 77 08             	push   0x8(%edi)
+  8021ff:	53                   	push   %ebx
+  802200:	e8 7c 04 00 00       	call   802681 <nsipc_sendmsg>
+  802205:	89 c3                	mov    %eax,%ebx
+  802207:	83 c4 10             	add    $0x10,%esp
+}
+  80220a:	89 d8                	mov    %ebx,%eax
+  80220c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220f:	5b                   	pop    %ebx
+  802210:	5e                   	pop    %esi
+  802211:	5f                   	pop    %edi
+  802212:	5d                   	pop    %ebp
+  802213:	c3                   	ret
+
+00802214 <recvmsg>:
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	57                   	push   %edi
+  802218:	56                   	push   %esi
+  802219:	53                   	push   %ebx
+  80221a:	83 ec 0c             	sub    $0xc,%esp
+  80221d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802220:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802223:	89 f8                	mov    %edi,%eax
+  802225:	e8 04 fe ff ff       	call   80202e <fd2sockid>
+  80222a:	89 c3                	mov    %eax,%ebx
+  80222c:	85 c0                	test   %eax,%eax
+  80222e:	78 2a                	js     80225a <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802230:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802237:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80223e:	89 f8                	mov    %edi,%eax
+  802240:	e8 19 fe ff ff       	call   80205e <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802245:	0b 45 10             	or     0x10(%ebp),%eax
+  802248:	50                   	push   %eax
+  802249:	ff 76 0c             	push   0xc(%esi)
+  80224c:	ff 76 08             	push   0x8(%esi)
+  80224f:	53                   	push   %ebx
+  802250:	e8 d6 07 00 00       	call   802a2b <nsipc_recvmsg>
+  802255:	89 c3                	mov    %eax,%ebx
+  802257:	83 c4 10             	add    $0x10,%esp
+}
+  80225a:	89 d8                	mov    %ebx,%eax
+  80225c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80225f:	5b                   	pop    %ebx
+  802260:	5e                   	pop    %esi
+  802261:	5f                   	pop    %edi
+  802262:	5d                   	pop    %ebp
+  802263:	c3                   	ret
+
+00802264 <sendfile>:
+{
+  802264:	55                   	push   %ebp
+  802265:	89 e5                	mov    %esp,%ebp
+  802267:	56                   	push   %esi
+  802268:	53                   	push   %ebx
+  802269:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80226c:	89 f0                	mov    %esi,%eax
+  80226e:	e8 bb fd ff ff       	call   80202e <fd2sockid>
+  802273:	89 c3                	mov    %eax,%ebx
+  802275:	85 c0                	test   %eax,%eax
+  802277:	78 1f                	js     802298 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802279:	89 f0                	mov    %esi,%eax
+  80227b:	e8 de fd ff ff       	call   80205e <sock_flags>
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	50                   	push   %eax
+  802284:	ff 75 14             	push   0x14(%ebp)
+  802287:	ff 75 10             	push   0x10(%ebp)
+  80228a:	ff 75 0c             	push   0xc(%ebp)
+  80228d:	53                   	push   %ebx
+  80228e:	e8 64 06 00 00       	call   8028f7 <nsipc_sendfile>
+  802293:	89 c3                	mov    %eax,%ebx
+  802295:	83 c4 20             	add    $0x20,%esp
+}
+  802298:	89 d8                	mov    %ebx,%eax
+  80229a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80229d:	5b                   	pop    %ebx
+  80229e:	5e                   	pop    %esi
+  80229f:	5d                   	pop    %ebp
+  8022a0:	c3                   	ret
+
+008022a1 <evctl>:
+{
+  8022a1:	55                   	push   %ebp
+  8022a2:	89 e5                	mov    %esp,%ebp
+  8022a4:	53                   	push   %ebx
+  8022a5:	83 ec 04             	sub    $0x4,%esp
+  8022a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8022ab:	89 d8                	mov    %ebx,%eax
+  8022ad:	e8 7c fd ff ff       	call   80202e <fd2sockid>
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 10                	js     8022c6 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8022b6:	83 ec 04             	sub    $0x4,%esp
+  8022b9:	53                   	push   %ebx
+  8022ba:	ff 75 0c             	push   0xc(%ebp)
+  8022bd:	50                   	push   %eax
+  8022be:	e8 d2 0b 00 00       	call   802e95 <nsipc_evctl>
+  8022c3:	83 c4 10             	add    $0x10,%esp
+}
+  8022c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c9:	c9                   	leave
+  8022ca:	c3                   	ret
+
+008022cb <evwait>:
+{
+  8022cb:	55                   	push   %ebp
+  8022cc:	89 e5                	mov    %esp,%ebp
+  8022ce:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8022d1:	ff 75 10             	push   0x10(%ebp)
+  8022d4:	ff 75 0c             	push   0xc(%ebp)
+  8022d7:	ff 75 08             	push   0x8(%ebp)
+  8022da:	e8 e0 0b 00 00       	call   802ebf <nsipc_evwait>
+}
+  8022df:	c9                   	leave
+  8022e0:	c3                   	ret
+
+008022e1 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8022e7:	ff 75 10             	push   0x10(%ebp)
+  8022ea:	ff 75 0c             	push   0xc(%ebp)
+  8022ed:	ff 75 08             	push   0x8(%ebp)
+  8022f0:	e8 31 0c 00 00       	call   802f26 <nsipc_socket>
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	85 c0                	test   %eax,%eax
+  8022fa:	78 05                	js     802301 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8022fc:	e8 89 fd ff ff       	call   80208a <alloc_sockfd>
+}
+  802301:	c9                   	leave
+  802302:	c3                   	ret
+
+00802303 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802303:	55                   	push   %ebp
+  802304:	89 e5                	mov    %esp,%ebp
+  802306:	53                   	push   %ebx
+  802307:	83 ec 04             	sub    $0x4,%esp
+  80230a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80230c:	83 3d 44 67 80 00 00 	cmpl   $0x0,0x806744
+  802313:	74 26                	je     80233b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802315:	6a 07                	push   $0x7
+  802317:	68 00 80 80 00       	push   $0x808000
+  80231c:	53                   	push   %ebx
+  80231d:	ff 35 44 67 80 00    	push   0x806744
+  802323:	e8 3b 17 00 00       	call   803a63 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802328:	83 c4 0c             	add    $0xc,%esp
+  80232b:	6a 00                	push   $0x0
+  80232d:	6a 00                	push   $0x0
+  80232f:	6a 00                	push   $0x0
+  802331:	e8 9d 14 00 00       	call   8037d3 <ipc_recv>
+}
+  802336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80233b:	83 ec 0c             	sub    $0xc,%esp
+  80233e:	6a 03                	push   $0x3
+  802340:	e8 87 17 00 00       	call   803acc <ipc_find_env>
+  802345:	a3 44 67 80 00       	mov    %eax,0x806744
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	eb c6                	jmp    802315 <nsipc+0x12>
+
+0080234f <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80234f:	55                   	push   %ebp
+  802350:	89 e5                	mov    %esp,%ebp
+  802352:	56                   	push   %esi
+  802353:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802354:	8b 35 50 67 80 00    	mov    0x806750,%esi
+		return 0;
+  80235a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  80235f:	85 f6                	test   %esi,%esi
+  802361:	75 33                	jne    802396 <nsbulk_map+0x47>
+  802363:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802368:	83 ec 04             	sub    $0x4,%esp
+  80236b:	6a 07                	push   $0x7
+  80236d:	53                   	push   %ebx
+  80236e:	6a 00                	push   $0x0
+  802370:	e8 e6 ec ff ff       	call   80105b <sys_page_alloc>
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 1a                	js     802396 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80237c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802382:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802388:	75 de                	jne    802368 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80238a:	c7 05 50 67 80 00 01 	movl   $0x1,0x806750
+  802391:	00 00 00 
+	return 0;
+  802394:	89 f0                	mov    %esi,%eax
+}
+  802396:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802399:	5b                   	pop    %ebx
+  80239a:	5e                   	pop    %esi
+  80239b:	5d                   	pop    %ebp
+  80239c:	c3                   	ret
+
+0080239d <nsbulk_own>:
+{
+  80239d:	55                   	push   %ebp
+  80239e:	89 e5                	mov    %esp,%ebp
+  8023a0:	57                   	push   %edi
+  8023a1:	56                   	push   %esi
+  8023a2:	53                   	push   %ebx
+  8023a3:	83 ec 0c             	sub    $0xc,%esp
+  8023a6:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8023a8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8023ab:	85 d2                	test   %edx,%edx
+  8023ad:	7f 0e                	jg     8023bd <nsbulk_own+0x20>
+	return 0;
+  8023af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b4:	eb 47                	jmp    8023fd <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8023b6:	83 c3 01             	add    $0x1,%ebx
+  8023b9:	39 fb                	cmp    %edi,%ebx
+  8023bb:	7d 3b                	jge    8023f8 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8023bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c2:	89 d9                	mov    %ebx,%ecx
+  8023c4:	d3 e6                	shl    %cl,%esi
+  8023c6:	89 f0                	mov    %esi,%eax
+  8023c8:	23 05 4c 67 80 00    	and    0x80674c,%eax
+  8023ce:	74 e6                	je     8023b6 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8023d0:	83 ec 04             	sub    $0x4,%esp
+  8023d3:	6a 07                	push   $0x7
+  8023d5:	89 d8                	mov    %ebx,%eax
+  8023d7:	c1 e0 0c             	shl    $0xc,%eax
+  8023da:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8023df:	50                   	push   %eax
+  8023e0:	6a 00                	push   $0x0
+  8023e2:	e8 74 ec ff ff       	call   80105b <sys_page_alloc>
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 0f                	js     8023fd <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8023ee:	f7 d6                	not    %esi
+  8023f0:	21 35 4c 67 80 00    	and    %esi,0x80674c
+  8023f6:	eb be                	jmp    8023b6 <nsbulk_own+0x19>
+	return 0;
+  8023f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802400:	5b                   	pop    %ebx
+  802401:	5e                   	pop    %esi
+  802402:	5f                   	pop    %edi
+  802403:	5d                   	pop    %ebp
+  802404:	c3                   	ret
+
+00802405 <nsipc_bulk>:
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	57                   	push   %edi
+  802409:	56                   	push   %esi
+  80240a:	53                   	push   %ebx
+  80240b:	83 ec 1c             	sub    $0x1c,%esp
+  80240e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802411:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802413:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802419:	c1 fb 0c             	sar    $0xc,%ebx
+  80241c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80241f:	83 3d 44 67 80 00 00 	cmpl   $0x0,0x806744
+  802426:	74 56                	je     80247e <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802428:	85 ff                	test   %edi,%edi
+  80242a:	7e 24                	jle    802450 <nsipc_bulk+0x4b>
+  80242c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802432:	74 1c                	je     802450 <nsipc_bulk+0x4b>
+  802434:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80243a:	c1 e3 0c             	shl    $0xc,%ebx
+  80243d:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802442:	0f b6 10             	movzbl (%eax),%edx
+  802445:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802447:	05 00 10 00 00       	add    $0x1000,%eax
+  80244c:	39 d8                	cmp    %ebx,%eax
+  80244e:	75 f2                	jne    802442 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802450:	83 ec 0c             	sub    $0xc,%esp
+  802453:	56                   	push   %esi
+  802454:	57                   	push   %edi
+  802455:	68 00 00 00 e0       	push   $0xe0000000
+  80245a:	ff 75 e4             	push   -0x1c(%ebp)
+  80245d:	ff 35 44 67 80 00    	push   0x806744
+  802463:	e8 2f 16 00 00       	call   803a97 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802468:	83 c4 1c             	add    $0x1c,%esp
+  80246b:	6a 00                	push   $0x0
+  80246d:	6a 00                	push   $0x0
+  80246f:	6a 00                	push   $0x0
+  802471:	e8 5d 13 00 00       	call   8037d3 <ipc_recv>
+}
+  802476:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802479:	5b                   	pop    %ebx
+  80247a:	5e                   	pop    %esi
+  80247b:	5f                   	pop    %edi
+  80247c:	5d                   	pop    %ebp
+  80247d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80247e:	83 ec 0c             	sub    $0xc,%esp
+  802481:	6a 03                	push   $0x3
+  802483:	e8 44 16 00 00       	call   803acc <ipc_find_env>
+  802488:	a3 44 67 80 00       	mov    %eax,0x806744
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	eb 96                	jmp    802428 <nsipc_bulk+0x23>
+
+00802492 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802492:	55                   	push   %ebp
+  802493:	89 e5                	mov    %esp,%ebp
+  802495:	53                   	push   %ebx
+  802496:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802499:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8024a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024a4:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8024a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ae:	e8 50 fe ff ff       	call   802303 <nsipc>
+  8024b3:	89 c3                	mov    %eax,%ebx
+  8024b5:	85 c0                	test   %eax,%eax
+  8024b7:	79 07                	jns    8024c0 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8024b9:	89 d8                	mov    %ebx,%eax
+  8024bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024be:	c9                   	leave
+  8024bf:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8024c0:	83 ec 04             	sub    $0x4,%esp
+  8024c3:	ff 35 10 80 80 00    	push   0x808010
+  8024c9:	68 00 80 80 00       	push   $0x808000
+  8024ce:	ff 75 0c             	push   0xc(%ebp)
+  8024d1:	e8 01 e9 ff ff       	call   800dd7 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8024d6:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8024dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024df:	89 10                	mov    %edx,(%eax)
+  8024e1:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8024e4:	eb d3                	jmp    8024b9 <nsipc_accept+0x27>
+
+008024e6 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8024e6:	55                   	push   %ebp
+  8024e7:	89 e5                	mov    %esp,%ebp
+  8024e9:	53                   	push   %ebx
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8024f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f3:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8024f8:	53                   	push   %ebx
+  8024f9:	ff 75 0c             	push   0xc(%ebp)
+  8024fc:	68 04 80 80 00       	push   $0x808004
+  802501:	e8 d1 e8 ff ff       	call   800dd7 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802506:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80250c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802511:	e8 ed fd ff ff       	call   802303 <nsipc>
+}
+  802516:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802519:	c9                   	leave
+  80251a:	c3                   	ret
+
+0080251b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80251b:	55                   	push   %ebp
+  80251c:	89 e5                	mov    %esp,%ebp
+  80251e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802521:	8b 45 08             	mov    0x8(%ebp),%eax
+  802524:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802529:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802531:	b8 03 00 00 00       	mov    $0x3,%eax
+  802536:	e8 c8 fd ff ff       	call   802303 <nsipc>
+}
+  80253b:	c9                   	leave
+  80253c:	c3                   	ret
+
+0080253d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802543:	8b 45 08             	mov    0x8(%ebp),%eax
+  802546:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80254b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802550:	e8 ae fd ff ff       	call   802303 <nsipc>
+}
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+00802557 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	53                   	push   %ebx
+  80255b:	83 ec 08             	sub    $0x8,%esp
+  80255e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802561:	8b 45 08             	mov    0x8(%ebp),%eax
+  802564:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802569:	53                   	push   %ebx
+  80256a:	ff 75 0c             	push   0xc(%ebp)
+  80256d:	68 04 80 80 00       	push   $0x808004
+  802572:	e8 60 e8 ff ff       	call   800dd7 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802577:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  80257d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802582:	e8 7c fd ff ff       	call   802303 <nsipc>
+}
+  802587:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258a:	c9                   	leave
+  80258b:	c3                   	ret
+
+0080258c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80258c:	55                   	push   %ebp
+  80258d:	89 e5                	mov    %esp,%ebp
+  80258f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802592:	8b 45 08             	mov    0x8(%ebp),%eax
+  802595:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80259a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259d:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8025a2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8025a7:	e8 57 fd ff ff       	call   802303 <nsipc>
+}
+  8025ac:	c9                   	leave
+  8025ad:	c3                   	ret
+
+008025ae <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8025ae:	55                   	push   %ebp
+  8025af:	89 e5                	mov    %esp,%ebp
+  8025b1:	56                   	push   %esi
+  8025b2:	53                   	push   %ebx
+  8025b3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8025b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8025be:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8025c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c7:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8025cc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025d1:	e8 2d fd ff ff       	call   802303 <nsipc>
+  8025d6:	89 c3                	mov    %eax,%ebx
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	78 22                	js     8025fe <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8025dc:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8025e1:	39 c6                	cmp    %eax,%esi
+  8025e3:	0f 4e c6             	cmovle %esi,%eax
+  8025e6:	39 c3                	cmp    %eax,%ebx
+  8025e8:	7f 1d                	jg     802607 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8025ea:	83 ec 04             	sub    $0x4,%esp
+  8025ed:	53                   	push   %ebx
+  8025ee:	68 00 80 80 00       	push   $0x808000
+  8025f3:	ff 75 0c             	push   0xc(%ebp)
+  8025f6:	e8 dc e7 ff ff       	call   800dd7 <memmove>
+  8025fb:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8025fe:	89 d8                	mov    %ebx,%eax
+  802600:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802603:	5b                   	pop    %ebx
+  802604:	5e                   	pop    %esi
+  802605:	5d                   	pop    %ebp
+  802606:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802607:	68 e4 41 80 00       	push   $0x8041e4
+  80260c:	68 f9 41 80 00       	push   $0x8041f9
+  802611:	68 b2 00 00 00       	push   $0xb2
+  802616:	68 0e 42 80 00       	push   $0x80420e
+  80261b:	e8 45 dd ff ff       	call   800365 <_panic>
+
+00802620 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802620:	55                   	push   %ebp
+  802621:	89 e5                	mov    %esp,%ebp
+  802623:	53                   	push   %ebx
+  802624:	83 ec 04             	sub    $0x4,%esp
+  802627:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80262a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262d:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802632:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802638:	7f 2e                	jg     802668 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80263a:	83 ec 04             	sub    $0x4,%esp
+  80263d:	53                   	push   %ebx
+  80263e:	ff 75 0c             	push   0xc(%ebp)
+  802641:	68 0c 80 80 00       	push   $0x80800c
+  802646:	e8 8c e7 ff ff       	call   800dd7 <memmove>
+	nsipcbuf.send.req_size = size;
+  80264b:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802651:	8b 45 14             	mov    0x14(%ebp),%eax
+  802654:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802659:	b8 08 00 00 00       	mov    $0x8,%eax
+  80265e:	e8 a0 fc ff ff       	call   802303 <nsipc>
+}
+  802663:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802666:	c9                   	leave
+  802667:	c3                   	ret
+	assert(size < 1600);
+  802668:	68 1a 42 80 00       	push   $0x80421a
+  80266d:	68 f9 41 80 00       	push   $0x8041f9
+  802672:	68 bd 00 00 00       	push   $0xbd
+  802677:	68 0e 42 80 00       	push   $0x80420e
+  80267c:	e8 e4 dc ff ff       	call   800365 <_panic>
+
+00802681 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802681:	55                   	push   %ebp
+  802682:	89 e5                	mov    %esp,%ebp
+  802684:	57                   	push   %edi
+  802685:	56                   	push   %esi
+  802686:	53                   	push   %ebx
+  802687:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  80268a:	e8 c0 fc ff ff       	call   80234f <nsbulk_map>
+  80268f:	85 c0                	test   %eax,%eax
+  802691:	78 55                	js     8026e8 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802693:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80269a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8026a1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8026a8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026ab:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8026ae:	0f 8d 24 02 00 00    	jge    8028d8 <nsipc_sendmsg+0x257>
+  8026b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8026ba:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8026bd:	89 d8                	mov    %ebx,%eax
+  8026bf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8026c4:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8026c6:	83 ec 0c             	sub    $0xc,%esp
+  8026c9:	68 40 64 80 00       	push   $0x806440
+  8026ce:	e8 5a 0f 00 00       	call   80362d <pgbatch_init>
+  8026d3:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8026d6:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8026d8:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8026db:	e9 82 00 00 00       	jmp    802762 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8026e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026e3:	85 db                	test   %ebx,%ebx
+  8026e5:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8026e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026eb:	5b                   	pop    %ebx
+  8026ec:	5e                   	pop    %esi
+  8026ed:	5f                   	pop    %edi
+  8026ee:	5d                   	pop    %ebp
+  8026ef:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8026f0:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8026f5:	29 c8                	sub    %ecx,%eax
+  8026f7:	39 d0                	cmp    %edx,%eax
+  8026f9:	0f 46 d0             	cmovbe %eax,%edx
+  8026fc:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8026fe:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802704:	85 ff                	test   %edi,%edi
+  802706:	0f 49 c7             	cmovns %edi,%eax
+  802709:	c1 f8 0c             	sar    $0xc,%eax
+  80270c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802711:	e8 87 fc ff ff       	call   80239d <nsbulk_own>
+  802716:	85 c0                	test   %eax,%eax
+  802718:	0f 88 17 01 00 00    	js     802835 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80271e:	83 ec 04             	sub    $0x4,%esp
+  802721:	56                   	push   %esi
+  802722:	ff 75 e0             	push   -0x20(%ebp)
+  802725:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802728:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80272d:	50                   	push   %eax
+  80272e:	e8 a4 e6 ff ff       	call   800dd7 <memmove>
+  802733:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802736:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802739:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80273c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80273f:	0f 84 fd 00 00 00    	je     802842 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802745:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802748:	01 f7                	add    %esi,%edi
+  80274a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80274d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802750:	0f 8d 01 01 00 00    	jge    802857 <nsipc_sendmsg+0x1d6>
+  802756:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80275c:	0f 8f f0 00 00 00    	jg     802852 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802762:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802765:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802768:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80276b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80276e:	89 c2                	mov    %eax,%edx
+  802770:	03 13                	add    (%ebx),%edx
+  802772:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802775:	8b 73 04             	mov    0x4(%ebx),%esi
+  802778:	29 c6                	sub    %eax,%esi
+  80277a:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  80277f:	29 f9                	sub    %edi,%ecx
+  802781:	39 ce                	cmp    %ecx,%esi
+  802783:	89 ca                	mov    %ecx,%edx
+  802785:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802788:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80278b:	89 f9                	mov    %edi,%ecx
+  80278d:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802793:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802796:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80279b:	09 c8                	or     %ecx,%eax
+  80279d:	0f 85 4d ff ff ff    	jne    8026f0 <nsipc_sendmsg+0x6f>
+  8027a3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8027a9:	0f 86 41 ff ff ff    	jbe    8026f0 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8027af:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8027b5:	85 ff                	test   %edi,%edi
+  8027b7:	0f 49 c7             	cmovns %edi,%eax
+  8027ba:	c1 f8 0c             	sar    $0xc,%eax
+  8027bd:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8027bf:	89 d1                	mov    %edx,%ecx
+  8027c1:	c1 e9 0c             	shr    $0xc,%ecx
+  8027c4:	01 c8                	add    %ecx,%eax
+  8027c6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8027c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027cc:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8027ce:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027d1:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8027d6:	29 c8                	sub    %ecx,%eax
+  8027d8:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8027db:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8027de:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8027e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e5:	89 f9                	mov    %edi,%ecx
+  8027e7:	d3 e0                	shl    %cl,%eax
+  8027e9:	09 05 4c 67 80 00    	or     %eax,0x80674c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8027ef:	83 ec 08             	sub    $0x8,%esp
+  8027f2:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8027f4:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8027f7:	50                   	push   %eax
+  8027f8:	6a 00                	push   $0x0
+  8027fa:	56                   	push   %esi
+  8027fb:	6a 00                	push   $0x0
+  8027fd:	68 40 64 80 00       	push   $0x806440
+  802802:	e8 e4 0e 00 00       	call   8036eb <pgbatch_map>
+  802807:	83 c4 20             	add    $0x20,%esp
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	0f 88 ce fe ff ff    	js     8026e0 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802812:	83 c7 01             	add    $0x1,%edi
+  802815:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80281b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80281e:	39 c7                	cmp    %eax,%edi
+  802820:	75 be                	jne    8027e0 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802822:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802825:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802828:	89 d6                	mov    %edx,%esi
+  80282a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802830:	e9 01 ff ff ff       	jmp    802736 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802835:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802838:	85 db                	test   %ebx,%ebx
+  80283a:	0f 45 c3             	cmovne %ebx,%eax
+  80283d:	e9 a6 fe ff ff       	jmp    8026e8 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802842:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802846:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80284d:	e9 f3 fe ff ff       	jmp    802745 <nsipc_sendmsg+0xc4>
+  802852:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802855:	eb 03                	jmp    80285a <nsipc_sendmsg+0x1d9>
+  802857:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80285a:	83 ec 0c             	sub    $0xc,%esp
+  80285d:	68 40 64 80 00       	push   $0x806440
+  802862:	e8 d4 0d 00 00       	call   80363b <pgbatch_flush>
+  802867:	83 c4 10             	add    $0x10,%esp
+  80286a:	85 c0                	test   %eax,%eax
+  80286c:	78 50                	js     8028be <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  80286e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802871:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802876:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80287c:	89 fb                	mov    %edi,%ebx
+  80287e:	29 f3                	sub    %esi,%ebx
+  802880:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802886:	8b 45 14             	mov    0x14(%ebp),%eax
+  802889:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  80288e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802893:	89 fa                	mov    %edi,%edx
+  802895:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80289a:	e8 66 fb ff ff       	call   802405 <nsipc_bulk>
+  80289f:	85 c0                	test   %eax,%eax
+  8028a1:	78 28                	js     8028cb <nsipc_sendmsg+0x24a>
+		sent += r;
+  8028a3:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8028a6:	39 c3                	cmp    %eax,%ebx
+  8028a8:	75 0c                	jne    8028b6 <nsipc_sendmsg+0x235>
+  8028aa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8028ad:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8028b0:	0f 8f f2 fd ff ff    	jg     8026a8 <nsipc_sendmsg+0x27>
+		sent += r;
+  8028b6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8028b9:	e9 2a fe ff ff       	jmp    8026e8 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8028be:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028c1:	85 db                	test   %ebx,%ebx
+  8028c3:	0f 45 c3             	cmovne %ebx,%eax
+  8028c6:	e9 1d fe ff ff       	jmp    8026e8 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8028cb:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8028ce:	85 db                	test   %ebx,%ebx
+  8028d0:	0f 45 c3             	cmovne %ebx,%eax
+  8028d3:	e9 10 fe ff ff       	jmp    8026e8 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8028d8:	83 ec 0c             	sub    $0xc,%esp
+  8028db:	68 40 64 80 00       	push   $0x806440
+  8028e0:	e8 48 0d 00 00       	call   80362d <pgbatch_init>
+  8028e5:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8028e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f2:	e9 63 ff ff ff       	jmp    80285a <nsipc_sendmsg+0x1d9>
+
+008028f7 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8028f7:	55                   	push   %ebp
+  8028f8:	89 e5                	mov    %esp,%ebp
+  8028fa:	57                   	push   %edi
+  8028fb:	56                   	push   %esi
+  8028fc:	53                   	push   %ebx
+  8028fd:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802900:	83 3d 48 67 80 00 00 	cmpl   $0x0,0x806748
+  802907:	0f 84 c8 00 00 00    	je     8029d5 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80290d:	83 3d 44 67 80 00 00 	cmpl   $0x0,0x806744
+  802914:	0f 84 e4 00 00 00    	je     8029fe <nsipc_sendfile+0x107>
+{
+  80291a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80291f:	89 fb                	mov    %edi,%ebx
+  802921:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802924:	0f 83 f0 00 00 00    	jae    802a1a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80292a:	89 fa                	mov    %edi,%edx
+  80292c:	03 55 10             	add    0x10(%ebp),%edx
+  80292f:	89 d0                	mov    %edx,%eax
+  802931:	c1 f8 1f             	sar    $0x1f,%eax
+  802934:	c1 e8 14             	shr    $0x14,%eax
+  802937:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80293a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802940:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802942:	6a 10                	push   $0x10
+  802944:	68 00 20 01 e0       	push   $0xe0012000
+  802949:	52                   	push   %edx
+  80294a:	ff 75 0c             	push   0xc(%ebp)
+  80294d:	e8 ea f3 ff ff       	call   801d3c <fmap>
+  802952:	83 c4 10             	add    $0x10,%esp
+  802955:	85 c0                	test   %eax,%eax
+  802957:	0f 8e b8 00 00 00    	jle    802a15 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80295d:	39 c6                	cmp    %eax,%esi
+  80295f:	0f 8d b5 00 00 00    	jge    802a1a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802965:	29 f0                	sub    %esi,%eax
+  802967:	8b 55 14             	mov    0x14(%ebp),%edx
+  80296a:	29 da                	sub    %ebx,%edx
+  80296c:	39 d0                	cmp    %edx,%eax
+  80296e:	89 d3                	mov    %edx,%ebx
+  802970:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802973:	8b 45 08             	mov    0x8(%ebp),%eax
+  802976:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80297b:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802981:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802987:	8b 45 18             	mov    0x18(%ebp),%eax
+  80298a:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80298f:	83 ec 0c             	sub    $0xc,%esp
+  802992:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802994:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80299b:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80299e:	83 c0 01             	add    $0x1,%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	68 00 10 01 e0       	push   $0xe0011000
+  8029a7:	6a 11                	push   $0x11
+  8029a9:	ff 35 44 67 80 00    	push   0x806744
+  8029af:	e8 e3 10 00 00       	call   803a97 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8029b4:	83 c4 1c             	add    $0x1c,%esp
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	6a 00                	push   $0x0
+  8029bd:	e8 11 0e 00 00       	call   8037d3 <ipc_recv>
+  8029c2:	83 c4 10             	add    $0x10,%esp
+  8029c5:	85 c0                	test   %eax,%eax
+  8029c7:	78 5b                	js     802a24 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8029c9:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8029cb:	39 c3                	cmp    %eax,%ebx
+  8029cd:	0f 8e 4c ff ff ff    	jle    80291f <nsipc_sendfile+0x28>
+  8029d3:	eb 45                	jmp    802a1a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8029d5:	83 ec 04             	sub    $0x4,%esp
+  8029d8:	6a 07                	push   $0x7
+  8029da:	68 00 10 01 e0       	push   $0xe0011000
+  8029df:	6a 00                	push   $0x0
+  8029e1:	e8 75 e6 ff ff       	call   80105b <sys_page_alloc>
+  8029e6:	89 c7                	mov    %eax,%edi
+  8029e8:	83 c4 10             	add    $0x10,%esp
+  8029eb:	85 c0                	test   %eax,%eax
+  8029ed:	78 2b                	js     802a1a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8029ef:	c7 05 48 67 80 00 01 	movl   $0x1,0x806748
+  8029f6:	00 00 00 
+  8029f9:	e9 0f ff ff ff       	jmp    80290d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8029fe:	83 ec 0c             	sub    $0xc,%esp
+  802a01:	6a 03                	push   $0x3
+  802a03:	e8 c4 10 00 00       	call   803acc <ipc_find_env>
+  802a08:	a3 44 67 80 00       	mov    %eax,0x806744
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	e9 05 ff ff ff       	jmp    80291a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802a15:	85 ff                	test   %edi,%edi
+  802a17:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802a1a:	89 f8                	mov    %edi,%eax
+  802a1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a1f:	5b                   	pop    %ebx
+  802a20:	5e                   	pop    %esi
+  802a21:	5f                   	pop    %edi
+  802a22:	5d                   	pop    %ebp
+  802a23:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802a24:	85 ff                	test   %edi,%edi
+  802a26:	0f 44 f8             	cmove  %eax,%edi
+  802a29:	eb ef                	jmp    802a1a <nsipc_sendfile+0x123>
+
+00802a2b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802a2b:	55                   	push   %ebp
+  802a2c:	89 e5                	mov    %esp,%ebp
+  802a2e:	57                   	push   %edi
+  802a2f:	56                   	push   %esi
+  802a30:	53                   	push   %ebx
+  802a31:	83 ec 1c             	sub    $0x1c,%esp
+  802a34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802a37:	e8 13 f9 ff ff       	call   80234f <nsbulk_map>
+  802a3c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a3f:	85 c0                	test   %eax,%eax
+  802a41:	0f 88 ba 00 00 00    	js     802b01 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802a47:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a4b:	0f 8e bb 00 00 00    	jle    802b0c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802a51:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802a56:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802a5b:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802a60:	89 f8                	mov    %edi,%eax
+  802a62:	29 f0                	sub    %esi,%eax
+  802a64:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802a68:	39 c8                	cmp    %ecx,%eax
+  802a6a:	0f 47 c1             	cmova  %ecx,%eax
+  802a6d:	01 f0                	add    %esi,%eax
+  802a6f:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802a71:	83 c2 01             	add    $0x1,%edx
+  802a74:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802a77:	7e 07                	jle    802a80 <nsipc_recvmsg+0x55>
+  802a79:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802a7e:	7e e0                	jle    802a60 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802a80:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802a86:	c1 fa 0c             	sar    $0xc,%edx
+  802a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8e:	e8 0a f9 ff ff       	call   80239d <nsbulk_own>
+  802a93:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	78 67                	js     802b01 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9d:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802aa2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802aa8:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aab:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802ab0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802ab5:	89 f2                	mov    %esi,%edx
+  802ab7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802abc:	e8 44 f9 ff ff       	call   802405 <nsipc_bulk>
+  802ac1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ac4:	85 c0                	test   %eax,%eax
+  802ac6:	78 39                	js     802b01 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802ac8:	39 f0                	cmp    %esi,%eax
+  802aca:	7f 4a                	jg     802b16 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802acc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	7e 2c                	jle    802b01 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802ad5:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802ad8:	29 fe                	sub    %edi,%esi
+  802ada:	8b 43 04             	mov    0x4(%ebx),%eax
+  802add:	39 c6                	cmp    %eax,%esi
+  802adf:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802ae2:	83 ec 04             	sub    $0x4,%esp
+  802ae5:	56                   	push   %esi
+  802ae6:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802aec:	50                   	push   %eax
+  802aed:	ff 33                	push   (%ebx)
+  802aef:	e8 e3 e2 ff ff       	call   800dd7 <memmove>
+		n += m;
+  802af4:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802af6:	83 c3 08             	add    $0x8,%ebx
+  802af9:	83 c4 10             	add    $0x10,%esp
+  802afc:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802aff:	7f d4                	jg     802ad5 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802b01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b07:	5b                   	pop    %ebx
+  802b08:	5e                   	pop    %esi
+  802b09:	5f                   	pop    %edi
+  802b0a:	5d                   	pop    %ebp
+  802b0b:	c3                   	ret
+	int r, i, n, len = 0;
+  802b0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b11:	e9 6a ff ff ff       	jmp    802a80 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802b16:	68 f0 41 80 00       	push   $0x8041f0
+  802b1b:	68 f9 41 80 00       	push   $0x8041f9
+  802b20:	68 3b 01 00 00       	push   $0x13b
+  802b25:	68 0e 42 80 00       	push   $0x80420e
+  802b2a:	e8 36 d8 ff ff       	call   800365 <_panic>
+
+00802b2f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	57                   	push   %edi
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 0c             	sub    $0xc,%esp
+  802b38:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802b3b:	8b 75 10             	mov    0x10(%ebp),%esi
+  802b3e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802b41:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b44:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802b49:	8b 07                	mov    (%edi),%eax
+  802b4b:	a3 04 80 80 00       	mov    %eax,0x808004
+  802b50:	8b 47 04             	mov    0x4(%edi),%eax
+  802b53:	a3 08 80 80 00       	mov    %eax,0x808008
+  802b58:	8b 47 08             	mov    0x8(%edi),%eax
+  802b5b:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802b60:	8b 47 0c             	mov    0xc(%edi),%eax
+  802b63:	a3 10 80 80 00       	mov    %eax,0x808010
+  802b68:	8b 47 10             	mov    0x10(%edi),%eax
+  802b6b:	a3 14 80 80 00       	mov    %eax,0x808014
+  802b70:	8b 47 14             	mov    0x14(%edi),%eax
+  802b73:	a3 18 80 80 00       	mov    %eax,0x808018
+  802b78:	8b 47 18             	mov    0x18(%edi),%eax
+  802b7b:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802b80:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802b83:	a3 20 80 80 00       	mov    %eax,0x808020
+  802b88:	8b 47 20             	mov    0x20(%edi),%eax
+  802b8b:	a3 24 80 80 00       	mov    %eax,0x808024
+  802b90:	8b 47 24             	mov    0x24(%edi),%eax
+  802b93:	a3 28 80 80 00       	mov    %eax,0x808028
+  802b98:	8b 47 28             	mov    0x28(%edi),%eax
+  802b9b:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802ba0:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802ba3:	a3 30 80 80 00       	mov    %eax,0x808030
+  802ba8:	8b 47 30             	mov    0x30(%edi),%eax
+  802bab:	a3 34 80 80 00       	mov    %eax,0x808034
+  802bb0:	8b 47 34             	mov    0x34(%edi),%eax
+  802bb3:	a3 38 80 80 00       	mov    %eax,0x808038
+  802bb8:	8b 47 38             	mov    0x38(%edi),%eax
+  802bbb:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  802bc0:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802bc3:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802bc8:	8b 06                	mov    (%esi),%eax
+  802bca:	a3 44 80 80 00       	mov    %eax,0x808044
+  802bcf:	8b 46 04             	mov    0x4(%esi),%eax
+  802bd2:	a3 48 80 80 00       	mov    %eax,0x808048
+  802bd7:	8b 46 08             	mov    0x8(%esi),%eax
+  802bda:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802bdf:	8b 46 0c             	mov    0xc(%esi),%eax
+  802be2:	a3 50 80 80 00       	mov    %eax,0x808050
+  802be7:	8b 46 10             	mov    0x10(%esi),%eax
+  802bea:	a3 54 80 80 00       	mov    %eax,0x808054
+  802bef:	8b 46 14             	mov    0x14(%esi),%eax
+  802bf2:	a3 58 80 80 00       	mov    %eax,0x808058
+  802bf7:	8b 46 18             	mov    0x18(%esi),%eax
+  802bfa:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802bff:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802c02:	a3 60 80 80 00       	mov    %eax,0x808060
+  802c07:	8b 46 20             	mov    0x20(%esi),%eax
+  802c0a:	a3 64 80 80 00       	mov    %eax,0x808064
+  802c0f:	8b 46 24             	mov    0x24(%esi),%eax
+  802c12:	a3 68 80 80 00       	mov    %eax,0x808068
+  802c17:	8b 46 28             	mov    0x28(%esi),%eax
+  802c1a:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802c1f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802c22:	a3 70 80 80 00       	mov    %eax,0x808070
+  802c27:	8b 46 30             	mov    0x30(%esi),%eax
+  802c2a:	a3 74 80 80 00       	mov    %eax,0x808074
+  802c2f:	8b 46 34             	mov    0x34(%esi),%eax
+  802c32:	a3 78 80 80 00       	mov    %eax,0x808078
+  802c37:	8b 46 38             	mov    0x38(%esi),%eax
+  802c3a:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802c3f:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802c42:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802c47:	8b 03                	mov    (%ebx),%eax
+  802c49:	a3 84 80 80 00       	mov    %eax,0x808084
+  802c4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c51:	a3 88 80 80 00       	mov    %eax,0x808088
+  802c56:	8b 43 08             	mov    0x8(%ebx),%eax
+  802c59:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802c5e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802c61:	a3 90 80 80 00       	mov    %eax,0x808090
+  802c66:	8b 43 10             	mov    0x10(%ebx),%eax
+  802c69:	a3 94 80 80 00       	mov    %eax,0x808094
+  802c6e:	8b 43 14             	mov    0x14(%ebx),%eax
+  802c71:	a3 98 80 80 00       	mov    %eax,0x808098
+  802c76:	8b 43 18             	mov    0x18(%ebx),%eax
+  802c79:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802c7e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802c81:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802c86:	8b 43 20             	mov    0x20(%ebx),%eax
+  802c89:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802c8e:	8b 43 24             	mov    0x24(%ebx),%eax
+  802c91:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802c96:	8b 43 28             	mov    0x28(%ebx),%eax
+  802c99:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802c9e:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802ca1:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802ca6:	8b 43 30             	mov    0x30(%ebx),%eax
+  802ca9:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  802cae:	8b 43 34             	mov    0x34(%ebx),%eax
+  802cb1:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  802cb6:	8b 43 38             	mov    0x38(%ebx),%eax
+  802cb9:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  802cbe:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802cc1:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  802cc6:	8b 45 18             	mov    0x18(%ebp),%eax
+  802cc9:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802cce:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802cd3:	e8 2b f6 ff ff       	call   802303 <nsipc>
+  802cd8:	85 c0                	test   %eax,%eax
+  802cda:	0f 88 ad 01 00 00    	js     802e8d <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802ce0:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802ce6:	89 17                	mov    %edx,(%edi)
+  802ce8:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802cee:	89 57 04             	mov    %edx,0x4(%edi)
+  802cf1:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802cf7:	89 57 08             	mov    %edx,0x8(%edi)
+  802cfa:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802d00:	89 57 0c             	mov    %edx,0xc(%edi)
+  802d03:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802d09:	89 57 10             	mov    %edx,0x10(%edi)
+  802d0c:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802d12:	89 57 14             	mov    %edx,0x14(%edi)
+  802d15:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802d1b:	89 57 18             	mov    %edx,0x18(%edi)
+  802d1e:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802d24:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802d27:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802d2d:	89 57 20             	mov    %edx,0x20(%edi)
+  802d30:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802d36:	89 57 24             	mov    %edx,0x24(%edi)
+  802d39:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802d3f:	89 57 28             	mov    %edx,0x28(%edi)
+  802d42:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802d48:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802d4b:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802d51:	89 57 30             	mov    %edx,0x30(%edi)
+  802d54:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802d5a:	89 57 34             	mov    %edx,0x34(%edi)
+  802d5d:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802d63:	89 57 38             	mov    %edx,0x38(%edi)
+  802d66:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802d6c:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802d6f:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802d75:	89 16                	mov    %edx,(%esi)
+  802d77:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802d7d:	89 56 04             	mov    %edx,0x4(%esi)
+  802d80:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802d86:	89 56 08             	mov    %edx,0x8(%esi)
+  802d89:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802d8f:	89 56 0c             	mov    %edx,0xc(%esi)
+  802d92:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802d98:	89 56 10             	mov    %edx,0x10(%esi)
+  802d9b:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802da1:	89 56 14             	mov    %edx,0x14(%esi)
+  802da4:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802daa:	89 56 18             	mov    %edx,0x18(%esi)
+  802dad:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802db3:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802db6:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802dbc:	89 56 20             	mov    %edx,0x20(%esi)
+  802dbf:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802dc5:	89 56 24             	mov    %edx,0x24(%esi)
+  802dc8:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802dce:	89 56 28             	mov    %edx,0x28(%esi)
+  802dd1:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802dd7:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802dda:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802de0:	89 56 30             	mov    %edx,0x30(%esi)
+  802de3:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802de9:	89 56 34             	mov    %edx,0x34(%esi)
+  802dec:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802df2:	89 56 38             	mov    %edx,0x38(%esi)
+  802df5:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802dfb:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802dfe:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802e04:	89 13                	mov    %edx,(%ebx)
+  802e06:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802e0c:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e0f:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802e15:	89 53 08             	mov    %edx,0x8(%ebx)
+  802e18:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802e1e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802e21:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802e27:	89 53 10             	mov    %edx,0x10(%ebx)
+  802e2a:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802e30:	89 53 14             	mov    %edx,0x14(%ebx)
+  802e33:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802e39:	89 53 18             	mov    %edx,0x18(%ebx)
+  802e3c:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802e42:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802e45:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802e4b:	89 53 20             	mov    %edx,0x20(%ebx)
+  802e4e:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802e54:	89 53 24             	mov    %edx,0x24(%ebx)
+  802e57:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802e5d:	89 53 28             	mov    %edx,0x28(%ebx)
+  802e60:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802e66:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802e69:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802e6f:	89 53 30             	mov    %edx,0x30(%ebx)
+  802e72:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802e78:	89 53 34             	mov    %edx,0x34(%ebx)
+  802e7b:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802e81:	89 53 38             	mov    %edx,0x38(%ebx)
+  802e84:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802e8a:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802e8d:	83 c4 0c             	add    $0xc,%esp
+  802e90:	5b                   	pop    %ebx
+  802e91:	5e                   	pop    %esi
+  802e92:	5f                   	pop    %edi
+  802e93:	5d                   	pop    %ebp
+  802e94:	c3                   	ret
+
+00802e95 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802e95:	55                   	push   %ebp
+  802e96:	89 e5                	mov    %esp,%ebp
+  802e98:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802ea3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea6:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802eab:	8b 45 10             	mov    0x10(%ebp),%eax
+  802eae:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802eb3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802eb8:	e8 46 f4 ff ff       	call   802303 <nsipc>
+}
+  802ebd:	c9                   	leave
+  802ebe:	c3                   	ret
+
+00802ebf <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	56                   	push   %esi
+  802ec3:	53                   	push   %ebx
+  802ec4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802ec7:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ecd:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ed0:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802ed5:	b8 10 00 00 00       	mov    $0x10,%eax
+  802eda:	e8 24 f4 ff ff       	call   802303 <nsipc>
+  802edf:	89 c3                	mov    %eax,%ebx
+  802ee1:	85 c0                	test   %eax,%eax
+  802ee3:	7e 1f                	jle    802f04 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802ee5:	39 c6                	cmp    %eax,%esi
+  802ee7:	7c 24                	jl     802f0d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802ee9:	83 ec 04             	sub    $0x4,%esp
+  802eec:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802ef3:	50                   	push   %eax
+  802ef4:	68 00 80 80 00       	push   $0x808000
+  802ef9:	ff 75 08             	push   0x8(%ebp)
+  802efc:	e8 d6 de ff ff       	call   800dd7 <memmove>
+  802f01:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802f04:	89 d8                	mov    %ebx,%eax
+  802f06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f09:	5b                   	pop    %ebx
+  802f0a:	5e                   	pop    %esi
+  802f0b:	5d                   	pop    %ebp
+  802f0c:	c3                   	ret
+		assert(r <= max);
+  802f0d:	68 26 42 80 00       	push   $0x804226
+  802f12:	68 f9 41 80 00       	push   $0x8041f9
+  802f17:	68 6a 01 00 00       	push   $0x16a
+  802f1c:	68 0e 42 80 00       	push   $0x80420e
+  802f21:	e8 3f d4 ff ff       	call   800365 <_panic>
+
+00802f26 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802f34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f37:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f3c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f3f:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802f44:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f49:	e8 b5 f3 ff ff       	call   802303 <nsipc>
+}
+  802f4e:	c9                   	leave
+  802f4f:	c3                   	ret
+
+00802f50 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802f50:	55                   	push   %ebp
+  802f51:	89 e5                	mov    %esp,%ebp
+  802f53:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802f56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f59:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802f5e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802f63:	e8 9b f3 ff ff       	call   802303 <nsipc>
+}
+  802f68:	c9                   	leave
+  802f69:	c3                   	ret
+
+00802f6a <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802f6a:	55                   	push   %ebp
+  802f6b:	89 e5                	mov    %esp,%ebp
+  802f6d:	53                   	push   %ebx
+  802f6e:	83 ec 04             	sub    $0x4,%esp
+  802f71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802f74:	b8 12 00 00 00       	mov    $0x12,%eax
+  802f79:	e8 85 f3 ff ff       	call   802303 <nsipc>
+  802f7e:	85 c0                	test   %eax,%eax
+  802f80:	78 50                	js     802fd2 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802f82:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802f88:	89 13                	mov    %edx,(%ebx)
+  802f8a:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802f90:	89 53 04             	mov    %edx,0x4(%ebx)
+  802f93:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802f99:	89 53 08             	mov    %edx,0x8(%ebx)
+  802f9c:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802fa2:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802fa5:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802fab:	89 53 10             	mov    %edx,0x10(%ebx)
+  802fae:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802fb4:	89 53 14             	mov    %edx,0x14(%ebx)
+  802fb7:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802fbd:	89 53 18             	mov    %edx,0x18(%ebx)
+  802fc0:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802fc6:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802fc9:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802fcf:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fd5:	c9                   	leave
+  802fd6:	c3                   	ret
+
+00802fd7 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fdd:	6a 03                	push   $0x3
+  802fdf:	e8 e8 0a 00 00       	call   803acc <ipc_find_env>
+  802fe4:	a3 44 67 80 00       	mov    %eax,0x806744
+	nsipcbuf.shard.req_shard = shard;
+  802fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fec:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802ff1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802ff6:	e8 08 f3 ff ff       	call   802303 <nsipc>
+  802ffb:	83 c4 10             	add    $0x10,%esp
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	78 0a                	js     80300c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803002:	a3 44 67 80 00       	mov    %eax,0x806744
+	return 0;
+  803007:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80300c:	c9                   	leave
+  80300d:	c3                   	ret
+
+0080300e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80300e:	55                   	push   %ebp
+  80300f:	89 e5                	mov    %esp,%ebp
+  803011:	57                   	push   %edi
+  803012:	56                   	push   %esi
+  803013:	53                   	push   %ebx
+  803014:	83 ec 1c             	sub    $0x1c,%esp
+  803017:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80301a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80301d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803022:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803027:	89 e0                	mov    %esp,%eax
+  803029:	89 f2                	mov    %esi,%edx
+  80302b:	29 c2                	sub    %eax,%edx
+  80302d:	89 d0                	mov    %edx,%eax
+  80302f:	c1 e8 0f             	shr    $0xf,%eax
+  803032:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803038:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80303b:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803042:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803045:	83 ec 0c             	sub    $0xc,%esp
+  803048:	ff 75 e0             	push   -0x20(%ebp)
+  80304b:	e8 bb 0a 00 00       	call   803b0b <pageref>
+  803050:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803053:	83 c4 04             	add    $0x4,%esp
+  803056:	ff 75 dc             	push   -0x24(%ebp)
+  803059:	e8 ad 0a 00 00       	call   803b0b <pageref>
+  80305e:	89 e2                	mov    %esp,%edx
+  803060:	89 f1                	mov    %esi,%ecx
+  803062:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  803064:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803067:	89 ca                	mov    %ecx,%edx
+  803069:	c1 ea 0f             	shr    $0xf,%edx
+  80306c:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803072:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803075:	8b 14 95 60 67 80 00 	mov    0x806760(,%edx,4),%edx
+  80307c:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80307f:	39 d7                	cmp    %edx,%edi
+  803081:	74 40                	je     8030c3 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803083:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803086:	75 9f                	jne    803027 <_pipeisclosed+0x19>
+  803088:	89 e2                	mov    %esp,%edx
+  80308a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80308f:	29 d0                	sub    %edx,%eax
+  803091:	89 c2                	mov    %eax,%edx
+  803093:	c1 ea 0f             	shr    $0xf,%edx
+  803096:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80309b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a0:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8030a3:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  8030aa:	8b 40 58             	mov    0x58(%eax),%eax
+  8030ad:	6a 01                	push   $0x1
+  8030af:	50                   	push   %eax
+  8030b0:	57                   	push   %edi
+  8030b1:	68 2f 42 80 00       	push   $0x80422f
+  8030b6:	e8 85 d3 ff ff       	call   800440 <cprintf>
+  8030bb:	83 c4 10             	add    $0x10,%esp
+  8030be:	e9 5f ff ff ff       	jmp    803022 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8030c3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8030c6:	0f 94 c0             	sete   %al
+  8030c9:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8030cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030cf:	5b                   	pop    %ebx
+  8030d0:	5e                   	pop    %esi
+  8030d1:	5f                   	pop    %edi
+  8030d2:	5d                   	pop    %ebp
+  8030d3:	c3                   	ret
+
+008030d4 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8030d4:	55                   	push   %ebp
+  8030d5:	89 e5                	mov    %esp,%ebp
+  8030d7:	53                   	push   %ebx
+  8030d8:	83 ec 0c             	sub    $0xc,%esp
+  8030db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8030de:	53                   	push   %ebx
+  8030df:	6a 00                	push   $0x0
+  8030e1:	e8 fa df ff ff       	call   8010e0 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8030e6:	89 1c 24             	mov    %ebx,(%esp)
+  8030e9:	e8 e0 e3 ff ff       	call   8014ce <fd2data>
+  8030ee:	83 c4 08             	add    $0x8,%esp
+  8030f1:	50                   	push   %eax
+  8030f2:	6a 00                	push   $0x0
+  8030f4:	e8 e7 df ff ff       	call   8010e0 <sys_page_unmap>
+}
+  8030f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030fc:	c9                   	leave
+  8030fd:	c3                   	ret
+
+008030fe <devpipe_read>:
+{
+  8030fe:	55                   	push   %ebp
+  8030ff:	89 e5                	mov    %esp,%ebp
+  803101:	57                   	push   %edi
+  803102:	56                   	push   %esi
+  803103:	53                   	push   %ebx
+  803104:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803107:	ff 75 08             	push   0x8(%ebp)
+  80310a:	e8 bf e3 ff ff       	call   8014ce <fd2data>
+  80310f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803111:	8b 70 04             	mov    0x4(%eax),%esi
+  803114:	8b 00                	mov    (%eax),%eax
+  803116:	83 c4 10             	add    $0x10,%esp
+  803119:	39 f0                	cmp    %esi,%eax
+  80311b:	75 36                	jne    803153 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80311d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803120:	89 da                	mov    %ebx,%edx
+  803122:	8b 45 08             	mov    0x8(%ebp),%eax
+  803125:	e8 e4 fe ff ff       	call   80300e <_pipeisclosed>
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	0f 85 d4 00 00 00    	jne    803206 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803132:	b8 01 00 00 00       	mov    $0x1,%eax
+  803137:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80313b:	83 ec 04             	sub    $0x4,%esp
+  80313e:	6a ff                	push   $0xffffffff
+  803140:	56                   	push   %esi
+  803141:	57                   	push   %edi
+  803142:	e8 12 e3 ff ff       	call   801459 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803147:	8b 73 04             	mov    0x4(%ebx),%esi
+  80314a:	8b 03                	mov    (%ebx),%eax
+  80314c:	83 c4 10             	add    $0x10,%esp
+  80314f:	39 c6                	cmp    %eax,%esi
+  803151:	74 cd                	je     803120 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803153:	8b 73 04             	mov    0x4(%ebx),%esi
+  803156:	8b 03                	mov    (%ebx),%eax
+  803158:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80315e:	29 c6                	sub    %eax,%esi
+  803160:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803165:	f7 e6                	mul    %esi
+  803167:	c1 ea 0c             	shr    $0xc,%edx
+  80316a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803170:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803172:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803175:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803179:	8b 0b                	mov    (%ebx),%ecx
+  80317b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803180:	f7 e1                	mul    %ecx
+  803182:	c1 ea 0b             	shr    $0xb,%edx
+  803185:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80318b:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80318d:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803192:	29 cf                	sub    %ecx,%edi
+  803194:	39 f7                	cmp    %esi,%edi
+  803196:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803199:	83 ec 04             	sub    $0x4,%esp
+  80319c:	57                   	push   %edi
+  80319d:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8031a1:	50                   	push   %eax
+  8031a2:	ff 75 0c             	push   0xc(%ebp)
+  8031a5:	e8 2d dc ff ff       	call   800dd7 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8031aa:	83 c4 0c             	add    $0xc,%esp
+  8031ad:	89 f0                	mov    %esi,%eax
+  8031af:	29 f8                	sub    %edi,%eax
+  8031b1:	50                   	push   %eax
+  8031b2:	8d 43 10             	lea    0x10(%ebx),%eax
+  8031b5:	50                   	push   %eax
+  8031b6:	89 f8                	mov    %edi,%eax
+  8031b8:	03 45 0c             	add    0xc(%ebp),%eax
+  8031bb:	50                   	push   %eax
+  8031bc:	e8 16 dc ff ff       	call   800dd7 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8031c1:	8b 0b                	mov    (%ebx),%ecx
+  8031c3:	01 f1                	add    %esi,%ecx
+  8031c5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8031ca:	f7 e1                	mul    %ecx
+  8031cc:	c1 ea 0c             	shr    $0xc,%edx
+  8031cf:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8031d5:	29 c1                	sub    %eax,%ecx
+  8031d7:	89 0b                	mov    %ecx,(%ebx)
+  8031d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031de:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8031e2:	83 c4 10             	add    $0x10,%esp
+  8031e5:	85 c0                	test   %eax,%eax
+  8031e7:	75 0a                	jne    8031f3 <devpipe_read+0xf5>
+	return n;
+  8031e9:	89 f0                	mov    %esi,%eax
+}
+  8031eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031ee:	5b                   	pop    %ebx
+  8031ef:	5e                   	pop    %esi
+  8031f0:	5f                   	pop    %edi
+  8031f1:	5d                   	pop    %ebp
+  8031f2:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+  8031f6:	68 00 04 00 00       	push   $0x400
+  8031fb:	53                   	push   %ebx
+  8031fc:	e8 7a e2 ff ff       	call   80147b <sys_futex_wake>
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	eb e3                	jmp    8031e9 <devpipe_read+0xeb>
+			return 0;
+  803206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320b:	eb de                	jmp    8031eb <devpipe_read+0xed>
+
+0080320d <devpipe_write>:
+{
+  80320d:	55                   	push   %ebp
+  80320e:	89 e5                	mov    %esp,%ebp
+  803210:	57                   	push   %edi
+  803211:	56                   	push   %esi
+  803212:	53                   	push   %ebx
+  803213:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803216:	ff 75 08             	push   0x8(%ebp)
+  803219:	e8 b0 e2 ff ff       	call   8014ce <fd2data>
+  80321e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803220:	83 c4 10             	add    $0x10,%esp
+  803223:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80322a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80322f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803233:	0f 84 43 01 00 00    	je     80337c <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803239:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80323c:	8b 06                	mov    (%esi),%eax
+  80323e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803244:	29 c1                	sub    %eax,%ecx
+  803246:	89 c8                	mov    %ecx,%eax
+  803248:	f7 e7                	mul    %edi
+  80324a:	c1 ea 0c             	shr    $0xc,%edx
+  80324d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803253:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803255:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80325b:	75 52                	jne    8032af <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80325d:	89 f2                	mov    %esi,%edx
+  80325f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803262:	e8 a7 fd ff ff       	call   80300e <_pipeisclosed>
+  803267:	85 c0                	test   %eax,%eax
+  803269:	0f 85 28 01 00 00    	jne    803397 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  80326f:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803271:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803274:	8b 06                	mov    (%esi),%eax
+  803276:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80327c:	29 c1                	sub    %eax,%ecx
+  80327e:	89 c8                	mov    %ecx,%eax
+  803280:	f7 e7                	mul    %edi
+  803282:	c1 ea 0c             	shr    $0xc,%edx
+  803285:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80328b:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80328d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803293:	75 a4                	jne    803239 <devpipe_write+0x2c>
+  803295:	b8 01 00 00 00       	mov    $0x1,%eax
+  80329a:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80329e:	83 ec 04             	sub    $0x4,%esp
+  8032a1:	6a ff                	push   $0xffffffff
+  8032a3:	53                   	push   %ebx
+  8032a4:	56                   	push   %esi
+  8032a5:	e8 af e1 ff ff       	call   801459 <sys_futex_wait>
+}
+  8032aa:	83 c4 10             	add    $0x10,%esp
+  8032ad:	eb 8a                	jmp    803239 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032af:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8032b2:	8b 06                	mov    (%esi),%eax
+  8032b4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8032ba:	29 c1                	sub    %eax,%ecx
+  8032bc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8032c1:	f7 e1                	mul    %ecx
+  8032c3:	c1 ea 0c             	shr    $0xc,%edx
+  8032c6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032cc:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8032ce:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8032d3:	89 d8                	mov    %ebx,%eax
+  8032d5:	29 c8                	sub    %ecx,%eax
+  8032d7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032da:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8032dd:	29 ca                	sub    %ecx,%edx
+  8032df:	39 d0                	cmp    %edx,%eax
+  8032e1:	0f 46 d0             	cmovbe %eax,%edx
+  8032e4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8032e7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8032ea:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8032ef:	f7 e1                	mul    %ecx
+  8032f1:	c1 ea 0b             	shr    $0xb,%edx
+  8032f4:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8032fa:	89 ca                	mov    %ecx,%edx
+  8032fc:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8032fe:	29 d3                	sub    %edx,%ebx
+  803300:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803303:	39 c3                	cmp    %eax,%ebx
+  803305:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803308:	83 ec 04             	sub    $0x4,%esp
+  80330b:	53                   	push   %ebx
+  80330c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80330f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803312:	51                   	push   %ecx
+  803313:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803317:	50                   	push   %eax
+  803318:	e8 ba da ff ff       	call   800dd7 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80331d:	83 c4 0c             	add    $0xc,%esp
+  803320:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803323:	29 d8                	sub    %ebx,%eax
+  803325:	50                   	push   %eax
+  803326:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803329:	01 cb                	add    %ecx,%ebx
+  80332b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80332e:	53                   	push   %ebx
+  80332f:	8d 46 10             	lea    0x10(%esi),%eax
+  803332:	50                   	push   %eax
+  803333:	e8 9f da ff ff       	call   800dd7 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803338:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80333b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80333e:	01 c1                	add    %eax,%ecx
+  803340:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803345:	f7 e1                	mul    %ecx
+  803347:	c1 ea 0c             	shr    $0xc,%edx
+  80334a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803350:	89 ca                	mov    %ecx,%edx
+  803352:	29 c2                	sub    %eax,%edx
+  803354:	89 56 04             	mov    %edx,0x4(%esi)
+  803357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335c:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803360:	83 c4 10             	add    $0x10,%esp
+  803363:	85 c0                	test   %eax,%eax
+  803365:	75 1a                	jne    803381 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803367:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80336a:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80336d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803370:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803373:	0f 82 c0 fe ff ff    	jb     803239 <devpipe_write+0x2c>
+  803379:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80337c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80337f:	eb 1b                	jmp    80339c <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803381:	83 ec 08             	sub    $0x8,%esp
+  803384:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803389:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80338c:	50                   	push   %eax
+  80338d:	e8 e9 e0 ff ff       	call   80147b <sys_futex_wake>
+  803392:	83 c4 10             	add    $0x10,%esp
+  803395:	eb d0                	jmp    803367 <devpipe_write+0x15a>
+				return 0;
+  803397:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80339c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80339f:	5b                   	pop    %ebx
+  8033a0:	5e                   	pop    %esi
+  8033a1:	5f                   	pop    %edi
+  8033a2:	5d                   	pop    %ebp
+  8033a3:	c3                   	ret
+
+008033a4 <devpipe_stat>:
+{
+  8033a4:	55                   	push   %ebp
+  8033a5:	89 e5                	mov    %esp,%ebp
+  8033a7:	56                   	push   %esi
+  8033a8:	53                   	push   %ebx
+  8033a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8033ac:	83 ec 0c             	sub    $0xc,%esp
+  8033af:	ff 75 08             	push   0x8(%ebp)
+  8033b2:	e8 17 e1 ff ff       	call   8014ce <fd2data>
+  8033b7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8033b9:	83 c4 08             	add    $0x8,%esp
+  8033bc:	68 42 42 80 00       	push   $0x804242
+  8033c1:	53                   	push   %ebx
+  8033c2:	e8 60 d8 ff ff       	call   800c27 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033c7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8033ca:	8b 06                	mov    (%esi),%eax
+  8033cc:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8033d2:	29 c1                	sub    %eax,%ecx
+  8033d4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8033d9:	89 c8                	mov    %ecx,%eax
+  8033db:	f7 e2                	mul    %edx
+  8033dd:	c1 ea 0c             	shr    $0xc,%edx
+  8033e0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8033e6:	29 d1                	sub    %edx,%ecx
+  8033e8:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8033ee:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8033f5:	00 00 00 
+	stat->st_dev = &devpipe;
+  8033f8:	c7 83 8c 00 00 00 80 	movl   $0x805080,0x8c(%ebx)
+  8033ff:	50 80 00 
+}
+  803402:	b8 00 00 00 00       	mov    $0x0,%eax
+  803407:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80340a:	5b                   	pop    %ebx
+  80340b:	5e                   	pop    %esi
+  80340c:	5d                   	pop    %ebp
+  80340d:	c3                   	ret
+
+0080340e <devpipe_poll>:
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	57                   	push   %edi
+  803412:	56                   	push   %esi
+  803413:	53                   	push   %ebx
+  803414:	83 ec 18             	sub    $0x18,%esp
+  803417:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80341a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80341d:	57                   	push   %edi
+  80341e:	e8 ab e0 ff ff       	call   8014ce <fd2data>
+  803423:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803425:	83 c4 10             	add    $0x10,%esp
+  803428:	89 f3                	mov    %esi,%ebx
+  80342a:	83 e3 01             	and    $0x1,%ebx
+  80342d:	75 27                	jne    803456 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80342f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803435:	75 48                	jne    80347f <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803437:	89 ca                	mov    %ecx,%edx
+  803439:	89 f8                	mov    %edi,%eax
+  80343b:	e8 ce fb ff ff       	call   80300e <_pipeisclosed>
+  803440:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803442:	89 d8                	mov    %ebx,%eax
+  803444:	83 c8 10             	or     $0x10,%eax
+  803447:	85 d2                	test   %edx,%edx
+  803449:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80344c:	89 d8                	mov    %ebx,%eax
+  80344e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803451:	5b                   	pop    %ebx
+  803452:	5e                   	pop    %esi
+  803453:	5f                   	pop    %edi
+  803454:	5d                   	pop    %ebp
+  803455:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803456:	8b 58 04             	mov    0x4(%eax),%ebx
+  803459:	8b 00                	mov    (%eax),%eax
+  80345b:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803461:	29 c3                	sub    %eax,%ebx
+  803463:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803468:	89 d8                	mov    %ebx,%eax
+  80346a:	f7 e2                	mul    %edx
+  80346c:	c1 ea 0c             	shr    $0xc,%edx
+  80346f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803475:	39 d3                	cmp    %edx,%ebx
+  803477:	0f 95 c3             	setne  %bl
+  80347a:	0f b6 db             	movzbl %bl,%ebx
+  80347d:	eb b0                	jmp    80342f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80347f:	8b 71 04             	mov    0x4(%ecx),%esi
+  803482:	8b 01                	mov    (%ecx),%eax
+  803484:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80348a:	29 c6                	sub    %eax,%esi
+  80348c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803491:	89 f0                	mov    %esi,%eax
+  803493:	f7 e2                	mul    %edx
+  803495:	c1 ea 0c             	shr    $0xc,%edx
+  803498:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80349e:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8034a0:	89 d8                	mov    %ebx,%eax
+  8034a2:	83 c8 04             	or     $0x4,%eax
+  8034a5:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8034ab:	0f 42 d8             	cmovb  %eax,%ebx
+  8034ae:	eb 87                	jmp    803437 <devpipe_poll+0x29>
+
+008034b0 <pipe>:
+{
+  8034b0:	55                   	push   %ebp
+  8034b1:	89 e5                	mov    %esp,%ebp
+  8034b3:	56                   	push   %esi
+  8034b4:	53                   	push   %ebx
+  8034b5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8034b8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034bb:	50                   	push   %eax
+  8034bc:	e8 24 e0 ff ff       	call   8014e5 <fd_alloc>
+  8034c1:	89 c3                	mov    %eax,%ebx
+  8034c3:	83 c4 10             	add    $0x10,%esp
+  8034c6:	85 c0                	test   %eax,%eax
+  8034c8:	0f 88 23 01 00 00    	js     8035f1 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8034ce:	83 ec 04             	sub    $0x4,%esp
+  8034d1:	68 07 04 00 00       	push   $0x407
+  8034d6:	ff 75 f4             	push   -0xc(%ebp)
+  8034d9:	6a 00                	push   $0x0
+  8034db:	e8 7b db ff ff       	call   80105b <sys_page_alloc>
+  8034e0:	89 c3                	mov    %eax,%ebx
+  8034e2:	83 c4 10             	add    $0x10,%esp
+  8034e5:	85 c0                	test   %eax,%eax
+  8034e7:	0f 88 04 01 00 00    	js     8035f1 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8034ed:	83 ec 0c             	sub    $0xc,%esp
+  8034f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8034f3:	50                   	push   %eax
+  8034f4:	e8 ec df ff ff       	call   8014e5 <fd_alloc>
+  8034f9:	89 c3                	mov    %eax,%ebx
+  8034fb:	83 c4 10             	add    $0x10,%esp
+  8034fe:	85 c0                	test   %eax,%eax
+  803500:	0f 88 db 00 00 00    	js     8035e1 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803506:	83 ec 04             	sub    $0x4,%esp
+  803509:	68 07 04 00 00       	push   $0x407
+  80350e:	ff 75 f0             	push   -0x10(%ebp)
+  803511:	6a 00                	push   $0x0
+  803513:	e8 43 db ff ff       	call   80105b <sys_page_alloc>
+  803518:	89 c3                	mov    %eax,%ebx
+  80351a:	83 c4 10             	add    $0x10,%esp
+  80351d:	85 c0                	test   %eax,%eax
+  80351f:	0f 88 bc 00 00 00    	js     8035e1 <pipe+0x131>
+	va = fd2data(fd0);
+  803525:	83 ec 0c             	sub    $0xc,%esp
+  803528:	ff 75 f4             	push   -0xc(%ebp)
+  80352b:	e8 9e df ff ff       	call   8014ce <fd2data>
+  803530:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803532:	83 c4 0c             	add    $0xc,%esp
+  803535:	68 07 04 00 00       	push   $0x407
+  80353a:	50                   	push   %eax
+  80353b:	6a 00                	push   $0x0
+  80353d:	e8 19 db ff ff       	call   80105b <sys_page_alloc>
+  803542:	89 c3                	mov    %eax,%ebx
+  803544:	83 c4 10             	add    $0x10,%esp
+  803547:	85 c0                	test   %eax,%eax
+  803549:	0f 88 82 00 00 00    	js     8035d1 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80354f:	83 ec 0c             	sub    $0xc,%esp
+  803552:	ff 75 f0             	push   -0x10(%ebp)
+  803555:	e8 74 df ff ff       	call   8014ce <fd2data>
+  80355a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803561:	50                   	push   %eax
+  803562:	6a 00                	push   $0x0
+  803564:	56                   	push   %esi
+  803565:	6a 00                	push   $0x0
+  803567:	e8 32 db ff ff       	call   80109e <sys_page_map>
+  80356c:	89 c3                	mov    %eax,%ebx
+  80356e:	83 c4 20             	add    $0x20,%esp
+  803571:	85 c0                	test   %eax,%eax
+  803573:	78 4e                	js     8035c3 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803575:	a1 80 50 80 00       	mov    0x805080,%eax
+  80357a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80357d:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80357f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803582:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803589:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80358c:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80358e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803591:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803598:	83 ec 0c             	sub    $0xc,%esp
+  80359b:	ff 75 f4             	push   -0xc(%ebp)
+  80359e:	e8 1b df ff ff       	call   8014be <fd2num>
+  8035a3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035a6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8035a8:	83 c4 04             	add    $0x4,%esp
+  8035ab:	ff 75 f0             	push   -0x10(%ebp)
+  8035ae:	e8 0b df ff ff       	call   8014be <fd2num>
+  8035b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8035b6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8035b9:	83 c4 10             	add    $0x10,%esp
+  8035bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035c1:	eb 2e                	jmp    8035f1 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8035c3:	83 ec 08             	sub    $0x8,%esp
+  8035c6:	56                   	push   %esi
+  8035c7:	6a 00                	push   $0x0
+  8035c9:	e8 12 db ff ff       	call   8010e0 <sys_page_unmap>
+  8035ce:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8035d1:	83 ec 08             	sub    $0x8,%esp
+  8035d4:	ff 75 f0             	push   -0x10(%ebp)
+  8035d7:	6a 00                	push   $0x0
+  8035d9:	e8 02 db ff ff       	call   8010e0 <sys_page_unmap>
+  8035de:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8035e1:	83 ec 08             	sub    $0x8,%esp
+  8035e4:	ff 75 f4             	push   -0xc(%ebp)
+  8035e7:	6a 00                	push   $0x0
+  8035e9:	e8 f2 da ff ff       	call   8010e0 <sys_page_unmap>
+  8035ee:	83 c4 10             	add    $0x10,%esp
+}
+  8035f1:	89 d8                	mov    %ebx,%eax
+  8035f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035f6:	5b                   	pop    %ebx
+  8035f7:	5e                   	pop    %esi
+  8035f8:	5d                   	pop    %ebp
+  8035f9:	c3                   	ret
+
+008035fa <pipeisclosed>:
+{
+  8035fa:	55                   	push   %ebp
+  8035fb:	89 e5                	mov    %esp,%ebp
+  8035fd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803600:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803603:	50                   	push   %eax
+  803604:	ff 75 08             	push   0x8(%ebp)
+  803607:	e8 29 df ff ff       	call   801535 <fd_lookup>
+  80360c:	83 c4 10             	add    $0x10,%esp
+  80360f:	85 c0                	test   %eax,%eax
+  803611:	78 18                	js     80362b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803613:	83 ec 0c             	sub    $0xc,%esp
+  803616:	ff 75 f4             	push   -0xc(%ebp)
+  803619:	e8 b0 de ff ff       	call   8014ce <fd2data>
+  80361e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803623:	e8 e6 f9 ff ff       	call   80300e <_pipeisclosed>
+  803628:	83 c4 10             	add    $0x10,%esp
+}
+  80362b:	c9                   	leave
+  80362c:	c3                   	ret
+
+0080362d <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  80362d:	55                   	push   %ebp
+  80362e:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803630:	8b 45 08             	mov    0x8(%ebp),%eax
+  803633:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803639:	5d                   	pop    %ebp
+  80363a:	c3                   	ret
+
+0080363b <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80363b:	55                   	push   %ebp
+  80363c:	89 e5                	mov    %esp,%ebp
+  80363e:	53                   	push   %ebx
+  80363f:	83 ec 04             	sub    $0x4,%esp
+  803642:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803645:	8b 03                	mov    (%ebx),%eax
+  803647:	85 c0                	test   %eax,%eax
+  803649:	75 05                	jne    803650 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80364b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80364e:	c9                   	leave
+  80364f:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803650:	83 ec 08             	sub    $0x8,%esp
+  803653:	50                   	push   %eax
+  803654:	8d 43 04             	lea    0x4(%ebx),%eax
+  803657:	50                   	push   %eax
+  803658:	e8 d3 dc ff ff       	call   801330 <sys_page_batch>
+	pb->pb_n = 0;
+  80365d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803663:	83 c4 10             	add    $0x10,%esp
+  803666:	eb e3                	jmp    80364b <pgbatch_flush+0x10>
+
+00803668 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803668:	55                   	push   %ebp
+  803669:	89 e5                	mov    %esp,%ebp
+  80366b:	56                   	push   %esi
+  80366c:	53                   	push   %ebx
+  80366d:	89 c3                	mov    %eax,%ebx
+  80366f:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803671:	83 38 20             	cmpl   $0x20,(%eax)
+  803674:	74 2c                	je     8036a2 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803676:	8b 03                	mov    (%ebx),%eax
+  803678:	8d 50 01             	lea    0x1(%eax),%edx
+  80367b:	89 13                	mov    %edx,(%ebx)
+  80367d:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803680:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803684:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803686:	83 ec 04             	sub    $0x4,%esp
+  803689:	6a 18                	push   $0x18
+  80368b:	6a 00                	push   $0x0
+  80368d:	50                   	push   %eax
+  80368e:	e8 0f d7 ff ff       	call   800da2 <memset>
+	return 0;
+  803693:	83 c4 10             	add    $0x10,%esp
+  803696:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80369b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80369e:	5b                   	pop    %ebx
+  80369f:	5e                   	pop    %esi
+  8036a0:	5d                   	pop    %ebp
+  8036a1:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8036a2:	83 ec 0c             	sub    $0xc,%esp
+  8036a5:	50                   	push   %eax
+  8036a6:	e8 90 ff ff ff       	call   80363b <pgbatch_flush>
+  8036ab:	83 c4 10             	add    $0x10,%esp
+  8036ae:	85 c0                	test   %eax,%eax
+  8036b0:	79 c4                	jns    803676 <pgbatch_slot+0xe>
+  8036b2:	eb e7                	jmp    80369b <pgbatch_slot+0x33>
+
+008036b4 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8036b4:	55                   	push   %ebp
+  8036b5:	89 e5                	mov    %esp,%ebp
+  8036b7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8036ba:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8036bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c0:	e8 a3 ff ff ff       	call   803668 <pgbatch_slot>
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	78 20                	js     8036e9 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8036c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036cc:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8036d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036d5:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8036d8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8036db:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8036de:	8b 55 14             	mov    0x14(%ebp),%edx
+  8036e1:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8036e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036e9:	c9                   	leave
+  8036ea:	c3                   	ret
+
+008036eb <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8036eb:	55                   	push   %ebp
+  8036ec:	89 e5                	mov    %esp,%ebp
+  8036ee:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8036f1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8036f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f7:	e8 6c ff ff ff       	call   803668 <pgbatch_slot>
+  8036fc:	85 c0                	test   %eax,%eax
+  8036fe:	78 2c                	js     80372c <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803700:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803703:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803709:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80370c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  80370f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803712:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803715:	8b 55 14             	mov    0x14(%ebp),%edx
+  803718:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80371b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80371e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803721:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803724:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80372c:	c9                   	leave
+  80372d:	c3                   	ret
+
+0080372e <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80372e:	55                   	push   %ebp
+  80372f:	89 e5                	mov    %esp,%ebp
+  803731:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803734:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803737:	8b 45 08             	mov    0x8(%ebp),%eax
+  80373a:	e8 29 ff ff ff       	call   803668 <pgbatch_slot>
+  80373f:	85 c0                	test   %eax,%eax
+  803741:	78 1a                	js     80375d <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803746:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80374c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80374f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803752:	8b 55 10             	mov    0x10(%ebp),%edx
+  803755:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803758:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80375d:	c9                   	leave
+  80375e:	c3                   	ret
+
+0080375f <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80375f:	55                   	push   %ebp
+  803760:	89 e5                	mov    %esp,%ebp
+  803762:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803765:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80376b:	e8 f8 fe ff ff       	call   803668 <pgbatch_slot>
+  803770:	85 c0                	test   %eax,%eax
+  803772:	78 20                	js     803794 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803774:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803777:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80377d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803780:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803783:	8b 55 10             	mov    0x10(%ebp),%edx
+  803786:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803789:	8b 55 14             	mov    0x14(%ebp),%edx
+  80378c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803794:	c9                   	leave
+  803795:	c3                   	ret
+
+00803796 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803796:	55                   	push   %ebp
+  803797:	89 e5                	mov    %esp,%ebp
+  803799:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80379c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80379f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a2:	e8 c1 fe ff ff       	call   803668 <pgbatch_slot>
+  8037a7:	85 c0                	test   %eax,%eax
+  8037a9:	78 26                	js     8037d1 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8037ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037ae:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8037b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037b7:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8037ba:	8b 55 10             	mov    0x10(%ebp),%edx
+  8037bd:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8037c0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8037c3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8037c6:	8b 55 18             	mov    0x18(%ebp),%edx
+  8037c9:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8037cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037d1:	c9                   	leave
+  8037d2:	c3                   	ret
+
+008037d3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037d3:	55                   	push   %ebp
+  8037d4:	89 e5                	mov    %esp,%ebp
+  8037d6:	56                   	push   %esi
+  8037d7:	53                   	push   %ebx
+  8037d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037e8:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8037eb:	83 ec 0c             	sub    $0xc,%esp
+  8037ee:	50                   	push   %eax
+  8037ef:	e8 17 da ff ff       	call   80120b <sys_ipc_recv>
+  8037f4:	83 c4 10             	add    $0x10,%esp
+  8037f7:	85 c0                	test   %eax,%eax
+  8037f9:	0f 88 8b 00 00 00    	js     80388a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8037ff:	85 f6                	test   %esi,%esi
+  803801:	74 2a                	je     80382d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803803:	89 e2                	mov    %esp,%edx
+  803805:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80380a:	29 d0                	sub    %edx,%eax
+  80380c:	89 c2                	mov    %eax,%edx
+  80380e:	c1 ea 0f             	shr    $0xf,%edx
+  803811:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80381e:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803825:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80382b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80382d:	85 db                	test   %ebx,%ebx
+  80382f:	74 2a                	je     80385b <ipc_recv+0x88>
+  803831:	89 e2                	mov    %esp,%edx
+  803833:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803838:	29 d0                	sub    %edx,%eax
+  80383a:	89 c2                	mov    %eax,%edx
+  80383c:	c1 ea 0f             	shr    $0xf,%edx
+  80383f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803844:	b8 00 00 00 00       	mov    $0x0,%eax
+  803849:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80384c:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803853:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803859:	89 03                	mov    %eax,(%ebx)
+  80385b:	89 e2                	mov    %esp,%edx
+  80385d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803862:	29 d0                	sub    %edx,%eax
+  803864:	89 c2                	mov    %eax,%edx
+  803866:	c1 ea 0f             	shr    $0xf,%edx
+  803869:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80386e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803873:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803876:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80387d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803883:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803886:	5b                   	pop    %ebx
+  803887:	5e                   	pop    %esi
+  803888:	5d                   	pop    %ebp
+  803889:	c3                   	ret
+		if(from_env_store != NULL)
+  80388a:	85 f6                	test   %esi,%esi
+  80388c:	74 06                	je     803894 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80388e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803894:	85 db                	test   %ebx,%ebx
+  803896:	74 eb                	je     803883 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803898:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80389e:	eb e3                	jmp    803883 <ipc_recv+0xb0>
+
+008038a0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8038a0:	55                   	push   %ebp
+  8038a1:	89 e5                	mov    %esp,%ebp
+  8038a3:	57                   	push   %edi
+  8038a4:	56                   	push   %esi
+  8038a5:	53                   	push   %ebx
+  8038a6:	83 ec 14             	sub    $0x14,%esp
+  8038a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038af:	8b 75 14             	mov    0x14(%ebp),%esi
+  8038b2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8038b5:	85 c0                	test   %eax,%eax
+  8038b7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8038bc:	0f 44 c2             	cmove  %edx,%eax
+  8038bf:	ff 75 10             	push   0x10(%ebp)
+  8038c2:	50                   	push   %eax
+  8038c3:	e8 a5 d9 ff ff       	call   80126d <sys_ipc_recv_pages>
+  8038c8:	83 c4 10             	add    $0x10,%esp
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	0f 88 ba 00 00 00    	js     80398d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8038d3:	85 ff                	test   %edi,%edi
+  8038d5:	74 2a                	je     803901 <ipc_recv_pages+0x61>
+  8038d7:	89 e2                	mov    %esp,%edx
+  8038d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038de:	29 d0                	sub    %edx,%eax
+  8038e0:	89 c2                	mov    %eax,%edx
+  8038e2:	c1 ea 0f             	shr    $0xf,%edx
+  8038e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ef:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8038f2:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  8038f9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8038ff:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803901:	85 f6                	test   %esi,%esi
+  803903:	74 2a                	je     80392f <ipc_recv_pages+0x8f>
+  803905:	89 e2                	mov    %esp,%edx
+  803907:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80390c:	29 d0                	sub    %edx,%eax
+  80390e:	89 c2                	mov    %eax,%edx
+  803910:	c1 ea 0f             	shr    $0xf,%edx
+  803913:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803920:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803927:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80392d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80392f:	85 db                	test   %ebx,%ebx
+  803931:	74 2a                	je     80395d <ipc_recv_pages+0xbd>
+  803933:	89 e2                	mov    %esp,%edx
+  803935:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80393a:	29 d0                	sub    %edx,%eax
+  80393c:	89 c2                	mov    %eax,%edx
+  80393e:	c1 ea 0f             	shr    $0xf,%edx
+  803941:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80394e:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  803955:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80395b:	89 03                	mov    %eax,(%ebx)
+  80395d:	89 e2                	mov    %esp,%edx
+  80395f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803964:	29 d0                	sub    %edx,%eax
+  803966:	89 c2                	mov    %eax,%edx
+  803968:	c1 ea 0f             	shr    $0xf,%edx
+  80396b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803978:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  80397f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803988:	5b                   	pop    %ebx
+  803989:	5e                   	pop    %esi
+  80398a:	5f                   	pop    %edi
+  80398b:	5d                   	pop    %ebp
+  80398c:	c3                   	ret
+		if (from_env_store)
+  80398d:	85 ff                	test   %edi,%edi
+  80398f:	74 06                	je     803997 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803991:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803997:	85 f6                	test   %esi,%esi
+  803999:	74 06                	je     8039a1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80399b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8039a1:	85 db                	test   %ebx,%ebx
+  8039a3:	74 e0                	je     803985 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8039a5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8039ab:	eb d8                	jmp    803985 <ipc_recv_pages+0xe5>
+
+008039ad <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8039ad:	55                   	push   %ebp
+  8039ae:	89 e5                	mov    %esp,%ebp
+  8039b0:	57                   	push   %edi
+  8039b1:	56                   	push   %esi
+  8039b2:	53                   	push   %ebx
+  8039b3:	83 ec 1c             	sub    $0x1c,%esp
+  8039b6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8039b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039bc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039c2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8039c6:	75 2b                	jne    8039f3 <ipc_try_send_pages+0x46>
+  8039c8:	89 e2                	mov    %esp,%edx
+  8039ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039cf:	29 d0                	sub    %edx,%eax
+  8039d1:	89 c2                	mov    %eax,%edx
+  8039d3:	c1 ea 0f             	shr    $0xf,%edx
+  8039d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e0:	0f 42 c2             	cmovb  %edx,%eax
+  8039e3:	8b 04 85 60 67 80 00 	mov    0x806760(,%eax,4),%eax
+  8039ea:	8b 70 48             	mov    0x48(%eax),%esi
+  8039ed:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039f3:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8039f9:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8039fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a01:	85 ff                	test   %edi,%edi
+  803a03:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803a08:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803a0b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803a11:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803a17:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803a1d:	83 ec 0c             	sub    $0xc,%esp
+  803a20:	ff 75 14             	push   0x14(%ebp)
+  803a23:	ff 75 18             	push   0x18(%ebp)
+  803a26:	57                   	push   %edi
+  803a27:	ff 75 0c             	push   0xc(%ebp)
+  803a2a:	ff 75 08             	push   0x8(%ebp)
+  803a2d:	e8 1a d8 ff ff       	call   80124c <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803a32:	83 c4 20             	add    $0x20,%esp
+  803a35:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a38:	75 21                	jne    803a5b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803a3a:	83 ec 04             	sub    $0x4,%esp
+  803a3d:	6a ff                	push   $0xffffffff
+  803a3f:	53                   	push   %ebx
+  803a40:	ff 75 e4             	push   -0x1c(%ebp)
+  803a43:	e8 11 da ff ff       	call   801459 <sys_futex_wait>
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803a4e:	74 c7                	je     803a17 <ipc_try_send_pages+0x6a>
+  803a50:	85 c0                	test   %eax,%eax
+  803a52:	79 c3                	jns    803a17 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803a54:	e8 e3 d5 ff ff       	call   80103c <sys_yield>
+  803a59:	eb bc                	jmp    803a17 <ipc_try_send_pages+0x6a>
+	}
+}
+  803a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a5e:	5b                   	pop    %ebx
+  803a5f:	5e                   	pop    %esi
+  803a60:	5f                   	pop    %edi
+  803a61:	5d                   	pop    %ebp
+  803a62:	c3                   	ret
+
+00803a63 <ipc_send>:
+{
+  803a63:	55                   	push   %ebp
+  803a64:	89 e5                	mov    %esp,%ebp
+  803a66:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803a69:	ff 75 14             	push   0x14(%ebp)
+  803a6c:	6a 01                	push   $0x1
+  803a6e:	ff 75 10             	push   0x10(%ebp)
+  803a71:	ff 75 0c             	push   0xc(%ebp)
+  803a74:	ff 75 08             	push   0x8(%ebp)
+  803a77:	e8 31 ff ff ff       	call   8039ad <ipc_try_send_pages>
+  803a7c:	83 c4 20             	add    $0x20,%esp
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	78 02                	js     803a85 <ipc_send+0x22>
+}
+  803a83:	c9                   	leave
+  803a84:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803a85:	50                   	push   %eax
+  803a86:	68 4e 42 80 00       	push   $0x80424e
+  803a8b:	6a 3f                	push   $0x3f
+  803a8d:	68 63 42 80 00       	push   $0x804263
+  803a92:	e8 ce c8 ff ff       	call   800365 <_panic>
+
+00803a97 <ipc_send_pages>:
+{
+  803a97:	55                   	push   %ebp
+  803a98:	89 e5                	mov    %esp,%ebp
+  803a9a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803a9d:	ff 75 18             	push   0x18(%ebp)
+  803aa0:	ff 75 14             	push   0x14(%ebp)
+  803aa3:	ff 75 10             	push   0x10(%ebp)
+  803aa6:	ff 75 0c             	push   0xc(%ebp)
+  803aa9:	ff 75 08             	push   0x8(%ebp)
+  803aac:	e8 fc fe ff ff       	call   8039ad <ipc_try_send_pages>
+  803ab1:	83 c4 20             	add    $0x20,%esp
+  803ab4:	85 c0                	test   %eax,%eax
+  803ab6:	78 02                	js     803aba <ipc_send_pages+0x23>
+}
+  803ab8:	c9                   	leave
+  803ab9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803aba:	50                   	push   %eax
+  803abb:	68 6d 42 80 00       	push   $0x80426d
+  803ac0:	6a 64                	push   $0x64
+  803ac2:	68 63 42 80 00       	push   $0x804263
+  803ac7:	e8 99 c8 ff ff       	call   800365 <_panic>
+
+00803acc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803acc:	55                   	push   %ebp
+  803acd:	89 e5                	mov    %esp,%ebp
+  803acf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803ad7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803add:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803ae3:	8b 52 50             	mov    0x50(%edx),%edx
+  803ae6:	39 ca                	cmp    %ecx,%edx
+  803ae8:	74 11                	je     803afb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803aea:	83 c0 01             	add    $0x1,%eax
+  803aed:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803af2:	75 e3                	jne    803ad7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af9:	eb 0e                	jmp    803b09 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803afb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803b01:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b06:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b09:	5d                   	pop    %ebp
+  803b0a:	c3                   	ret
+
+00803b0b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b0b:	55                   	push   %ebp
+  803b0c:	89 e5                	mov    %esp,%ebp
+  803b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b11:	89 c2                	mov    %eax,%edx
+  803b13:	c1 ea 16             	shr    $0x16,%edx
+  803b16:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b22:	f6 c1 01             	test   $0x1,%cl
+  803b25:	74 1e                	je     803b45 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803b27:	c1 e8 0c             	shr    $0xc,%eax
+  803b2a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803b31:	a8 01                	test   $0x1,%al
+  803b33:	74 10                	je     803b45 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803b35:	c1 e8 0c             	shr    $0xc,%eax
+  803b38:	c1 e0 04             	shl    $0x4,%eax
+  803b3b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803b42:	0f b7 d2             	movzwl %dx,%edx
+}
+  803b45:	89 d0                	mov    %edx,%eax
+  803b47:	5d                   	pop    %ebp
+  803b48:	c3                   	ret
+
+00803b49 <__udivdi3>:
+  803b49:	57                   	push   %edi
+  803b4a:	56                   	push   %esi
+  803b4b:	53                   	push   %ebx
+  803b4c:	83 ec 20             	sub    $0x20,%esp
+  803b4f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803b53:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803b57:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b5b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b5f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b63:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b67:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803b6b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803b6f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b7e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803b85:	00 
+  803b86:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803b8d:	00 
+  803b8e:	eb 08                	jmp    803b98 <__udivdi3+0x4f>
+  803b90:	83 e9 01             	sub    $0x1,%ecx
+  803b93:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803b96:	74 68                	je     803c00 <__udivdi3+0xb7>
+  803b98:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803b9c:	01 c0                	add    %eax,%eax
+  803b9e:	89 c6                	mov    %eax,%esi
+  803ba0:	89 d7                	mov    %edx,%edi
+  803ba2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ba6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803baa:	0f ad d0             	shrd   %cl,%edx,%eax
+  803bad:	d3 ea                	shr    %cl,%edx
+  803baf:	f6 c1 20             	test   $0x20,%cl
+  803bb2:	74 04                	je     803bb8 <__udivdi3+0x6f>
+  803bb4:	89 d0                	mov    %edx,%eax
+  803bb6:	31 d2                	xor    %edx,%edx
+  803bb8:	83 e0 01             	and    $0x1,%eax
+  803bbb:	89 04 24             	mov    %eax,(%esp)
+  803bbe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803bc5:	00 
+  803bc6:	8b 04 24             	mov    (%esp),%eax
+  803bc9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803bcd:	09 f0                	or     %esi,%eax
+  803bcf:	09 fa                	or     %edi,%edx
+  803bd1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803bd5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803bd9:	39 f0                	cmp    %esi,%eax
+  803bdb:	89 d3                	mov    %edx,%ebx
+  803bdd:	19 fb                	sbb    %edi,%ebx
+  803bdf:	72 af                	jb     803b90 <__udivdi3+0x47>
+  803be1:	29 f0                	sub    %esi,%eax
+  803be3:	19 fa                	sbb    %edi,%edx
+  803be5:	89 cf                	mov    %ecx,%edi
+  803be7:	c1 ef 05             	shr    $0x5,%edi
+  803bea:	83 e7 01             	and    $0x1,%edi
+  803bed:	89 fe                	mov    %edi,%esi
+  803bef:	83 f6 01             	xor    $0x1,%esi
+  803bf2:	d3 e6                	shl    %cl,%esi
+  803bf4:	d3 e7                	shl    %cl,%edi
+  803bf6:	09 74 24 18          	or     %esi,0x18(%esp)
+  803bfa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803bfe:	eb 90                	jmp    803b90 <__udivdi3+0x47>
+  803c00:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c04:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c08:	83 c4 20             	add    $0x20,%esp
+  803c0b:	5b                   	pop    %ebx
+  803c0c:	5e                   	pop    %esi
+  803c0d:	5f                   	pop    %edi
+  803c0e:	c3                   	ret
+
+00803c0f <__umoddi3>:
+  803c0f:	57                   	push   %edi
+  803c10:	56                   	push   %esi
+  803c11:	53                   	push   %ebx
+  803c12:	83 ec 08             	sub    $0x8,%esp
+  803c15:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c19:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c1d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803c21:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803c25:	57                   	push   %edi
+  803c26:	56                   	push   %esi
+  803c27:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c2b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c2f:	52                   	push   %edx
+  803c30:	50                   	push   %eax
+  803c31:	e8 13 ff ff ff       	call   803b49 <__udivdi3>
+  803c36:	89 c3                	mov    %eax,%ebx
+  803c38:	0f af d6             	imul   %esi,%edx
+  803c3b:	89 f9                	mov    %edi,%ecx
+  803c3d:	0f af cb             	imul   %ebx,%ecx
+  803c40:	01 d1                	add    %edx,%ecx
+  803c42:	89 d8                	mov    %ebx,%eax
+  803c44:	f7 e6                	mul    %esi
+  803c46:	89 c6                	mov    %eax,%esi
+  803c48:	89 d7                	mov    %edx,%edi
+  803c4a:	01 cf                	add    %ecx,%edi
+  803c4c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c50:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c54:	29 f0                	sub    %esi,%eax
+  803c56:	19 fa                	sbb    %edi,%edx
+  803c58:	83 c4 18             	add    $0x18,%esp
+  803c5b:	5b                   	pop    %ebx
+  803c5c:	5e                   	pop    %esi
+  803c5d:	5f                   	pop    %edi
+  803c5e:	c3                   	ret
+
+00803c5f <__divdi3>:
+  803c5f:	53                   	push   %ebx
+  803c60:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c64:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c68:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803c6c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803c70:	85 d2                	test   %edx,%edx
+  803c72:	78 12                	js     803c86 <__divdi3+0x27>
+  803c74:	85 db                	test   %ebx,%ebx
+  803c76:	78 2e                	js     803ca6 <__divdi3+0x47>
+  803c78:	53                   	push   %ebx
+  803c79:	51                   	push   %ecx
+  803c7a:	52                   	push   %edx
+  803c7b:	50                   	push   %eax
+  803c7c:	e8 c8 fe ff ff       	call   803b49 <__udivdi3>
+  803c81:	83 c4 10             	add    $0x10,%esp
+  803c84:	eb 1e                	jmp    803ca4 <__divdi3+0x45>
+  803c86:	f7 d8                	neg    %eax
+  803c88:	83 d2 00             	adc    $0x0,%edx
+  803c8b:	f7 da                	neg    %edx
+  803c8d:	85 db                	test   %ebx,%ebx
+  803c8f:	78 2a                	js     803cbb <__divdi3+0x5c>
+  803c91:	53                   	push   %ebx
+  803c92:	51                   	push   %ecx
+  803c93:	52                   	push   %edx
+  803c94:	50                   	push   %eax
+  803c95:	e8 af fe ff ff       	call   803b49 <__udivdi3>
+  803c9a:	83 c4 10             	add    $0x10,%esp
+  803c9d:	f7 d8                	neg    %eax
+  803c9f:	83 d2 00             	adc    $0x0,%edx
+  803ca2:	f7 da                	neg    %edx
+  803ca4:	5b                   	pop    %ebx
+  803ca5:	c3                   	ret
+  803ca6:	f7 d9                	neg    %ecx
+  803ca8:	83 d3 00             	adc    $0x0,%ebx
+  803cab:	f7 db                	neg    %ebx
+  803cad:	53                   	push   %ebx
+  803cae:	51                   	push   %ecx
+  803caf:	52                   	push   %edx
+  803cb0:	50                   	push   %eax
+  803cb1:	e8 93 fe ff ff       	call   803b49 <__udivdi3>
+  803cb6:	83 c4 10             	add    $0x10,%esp
+  803cb9:	eb e2                	jmp    803c9d <__divdi3+0x3e>
+  803cbb:	f7 d9                	neg    %ecx
+  803cbd:	83 d3 00             	adc    $0x0,%ebx
+  803cc0:	f7 db                	neg    %ebx
+  803cc2:	53                   	push   %ebx
+  803cc3:	51                   	push   %ecx
+  803cc4:	52                   	push   %edx
+  803cc5:	50                   	push   %eax
+  803cc6:	e8 7e fe ff ff       	call   803b49 <__udivdi3>
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	eb d4                	jmp    803ca4 <__divdi3+0x45>
+
+00803cd0 <__moddi3>:
+  803cd0:	57                   	push   %edi
+  803cd1:	56                   	push   %esi
+  803cd2:	53                   	push   %ebx
+  803cd3:	83 ec 08             	sub    $0x8,%esp
+  803cd6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803cda:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803cde:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ce2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ce6:	57                   	push   %edi
+  803ce7:	56                   	push   %esi
+  803ce8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803cec:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803cf0:	52                   	push   %edx
+  803cf1:	50                   	push   %eax
+  803cf2:	e8 68 ff ff ff       	call   803c5f <__divdi3>
+  803cf7:	89 c3                	mov    %eax,%ebx
+  803cf9:	0f af d6             	imul   %esi,%edx
+  803cfc:	89 f9                	mov    %edi,%ecx
+  803cfe:	0f af cb             	imul   %ebx,%ecx
+  803d01:	01 d1                	add    %edx,%ecx
+  803d03:	89 d8                	mov    %ebx,%eax
+  803d05:	f7 e6                	mul    %esi
+  803d07:	89 c6                	mov    %eax,%esi
+  803d09:	89 d7                	mov    %edx,%edi
+  803d0b:	01 cf                	add    %ecx,%edi
+  803d0d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803d11:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803d15:	29 f0                	sub    %esi,%eax
+  803d17:	19 fa                	sbb    %edi,%edx
+  803d19:	83 c4 18             	add    $0x18,%esp
+  803d1c:	5b                   	pop    %ebx
+  803d1d:	5e                   	pop    %esi
+  803d1e:	5f                   	pop    %edi
+  803d1f:	c3                   	ret
@@ -0,0 +1,10658 @@
+
+obj/user/testmalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 04             	sub    $0x4,%esp
+  80003c:	eb 22                	jmp    800060 <umain+0x2b>
+	void *v;
+
+	while (1) {
+		buf = readline("> ");
+		if (buf == 0)
+			exit();
+  80003e:	e8 2e 01 00 00       	call   800171 <exit>
+  800043:	eb 31                	jmp    800076 <umain+0x41>
+		if (memcmp(buf, "free ", 5) == 0) {
+			v = (void*) strtol(buf + 5, 0, 0);
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 00                	push   $0x0
+  80004a:	6a 00                	push   $0x0
+  80004c:	83 c3 05             	add    $0x5,%ebx
+  80004f:	53                   	push   %ebx
+  800050:	e8 05 05 00 00       	call   80055a <strtol>
+			free(v);
+  800055:	89 04 24             	mov    %eax,(%esp)
+  800058:	e8 ba 2e 00 00       	call   802f17 <free>
+  80005d:	83 c4 10             	add    $0x10,%esp
+		buf = readline("> ");
+  800060:	83 ec 0c             	sub    $0xc,%esp
+  800063:	68 40 52 80 00       	push   $0x805240
+  800068:	e8 1e 01 00 00       	call   80018b <readline>
+  80006d:	89 c3                	mov    %eax,%ebx
+		if (buf == 0)
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	74 c8                	je     80003e <umain+0x9>
+		if (memcmp(buf, "free ", 5) == 0) {
+  800076:	83 ec 04             	sub    $0x4,%esp
+  800079:	6a 05                	push   $0x5
+  80007b:	68 43 52 80 00       	push   $0x805243
+  800080:	53                   	push   %ebx
+  800081:	e8 69 04 00 00       	call   8004ef <memcmp>
+  800086:	83 c4 10             	add    $0x10,%esp
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	74 b8                	je     800045 <umain+0x10>
+		} else if (memcmp(buf, "malloc ", 7) == 0) {
+  80008d:	83 ec 04             	sub    $0x4,%esp
+  800090:	6a 07                	push   $0x7
+  800092:	68 49 52 80 00       	push   $0x805249
+  800097:	53                   	push   %ebx
+  800098:	e8 52 04 00 00       	call   8004ef <memcmp>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	85 c0                	test   %eax,%eax
+  8000a2:	75 2b                	jne    8000cf <umain+0x9a>
+			n = strtol(buf + 7, 0, 0);
+  8000a4:	83 ec 04             	sub    $0x4,%esp
+  8000a7:	6a 00                	push   $0x0
+  8000a9:	6a 00                	push   $0x0
+  8000ab:	83 c3 07             	add    $0x7,%ebx
+  8000ae:	53                   	push   %ebx
+  8000af:	e8 a6 04 00 00       	call   80055a <strtol>
+			v = malloc(n);
+  8000b4:	89 04 24             	mov    %eax,(%esp)
+  8000b7:	e8 39 2e 00 00       	call   802ef5 <malloc>
+			printf("\t0x%x\n", (uintptr_t) v);
+  8000bc:	83 c4 08             	add    $0x8,%esp
+  8000bf:	50                   	push   %eax
+  8000c0:	68 51 52 80 00       	push   $0x805251
+  8000c5:	e8 04 15 00 00       	call   8015ce <printf>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+  8000cd:	eb 91                	jmp    800060 <umain+0x2b>
+		} else
+			printf("?unknown command\n");
+  8000cf:	83 ec 0c             	sub    $0xc,%esp
+  8000d2:	68 58 52 80 00       	push   $0x805258
+  8000d7:	e8 f2 14 00 00       	call   8015ce <printf>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	e9 7c ff ff ff       	jmp    800060 <umain+0x2b>
+
+008000e4 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8000ef:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000f1:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000f6:	29 d0                	sub    %edx,%eax
+  8000f8:	89 c2                	mov    %eax,%edx
+  8000fa:	c1 ea 0f             	shr    $0xf,%edx
+  8000fd:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800102:	b8 00 00 00 00       	mov    $0x0,%eax
+  800107:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80010a:	c7 04 85 20 83 80 00 	movl   $0x0,0x808320(,%eax,4)
+  800111:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800115:	e8 a3 05 00 00       	call   8006bd <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80011a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80011f:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800125:	89 e1                	mov    %esp,%ecx
+  800127:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80012c:	29 ca                	sub    %ecx,%edx
+  80012e:	89 d1                	mov    %edx,%ecx
+  800130:	c1 e9 0f             	shr    $0xf,%ecx
+  800133:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013e:	0f 42 d1             	cmovb  %ecx,%edx
+  800141:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800146:	89 04 95 20 83 80 00 	mov    %eax,0x808320(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80014d:	85 db                	test   %ebx,%ebx
+  80014f:	7e 07                	jle    800158 <libmain+0x74>
+		binaryname = argv[0];
+  800151:	8b 06                	mov    (%esi),%eax
+  800153:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  800158:	83 ec 08             	sub    $0x8,%esp
+  80015b:	56                   	push   %esi
+  80015c:	53                   	push   %ebx
+  80015d:	e8 d3 fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800162:	e8 0a 00 00 00       	call   800171 <exit>
+}
+  800167:	83 c4 10             	add    $0x10,%esp
+  80016a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80016d:	5b                   	pop    %ebx
+  80016e:	5e                   	pop    %esi
+  80016f:	5d                   	pop    %ebp
+  800170:	c3                   	ret
+
+00800171 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800177:	e8 cb 0b 00 00       	call   800d47 <close_all>
+	sys_env_destroy(0);
+  80017c:	83 ec 0c             	sub    $0xc,%esp
+  80017f:	6a 00                	push   $0x0
+  800181:	e8 f6 04 00 00       	call   80067c <sys_env_destroy>
+}
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	c9                   	leave
+  80018a:	c3                   	ret
+
+0080018b <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  80018b:	55                   	push   %ebp
+  80018c:	89 e5                	mov    %esp,%ebp
+  80018e:	57                   	push   %edi
+  80018f:	56                   	push   %esi
+  800190:	53                   	push   %ebx
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800197:	85 c0                	test   %eax,%eax
+  800199:	74 13                	je     8001ae <readline+0x23>
+		fprintf(1, "%s", prompt);
+  80019b:	83 ec 04             	sub    $0x4,%esp
+  80019e:	50                   	push   %eax
+  80019f:	68 73 53 80 00       	push   $0x805373
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	e8 0c 14 00 00       	call   8015b7 <fprintf>
+  8001ab:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  8001ae:	83 ec 0c             	sub    $0xc,%esp
+  8001b1:	6a 00                	push   $0x0
+  8001b3:	e8 4a 3b 00 00       	call   803d02 <iscons>
+  8001b8:	89 c7                	mov    %eax,%edi
+  8001ba:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  8001bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c2:	eb 4b                	jmp    80020f <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  8001c9:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  8001cc:	75 08                	jne    8001d6 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  8001ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d1:	5b                   	pop    %ebx
+  8001d2:	5e                   	pop    %esi
+  8001d3:	5f                   	pop    %edi
+  8001d4:	5d                   	pop    %ebp
+  8001d5:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  8001d6:	83 ec 08             	sub    $0x8,%esp
+  8001d9:	53                   	push   %ebx
+  8001da:	68 74 52 80 00       	push   $0x805274
+  8001df:	e8 77 3c 00 00       	call   803e5b <cprintf>
+  8001e4:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8001e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ec:	eb e0                	jmp    8001ce <readline+0x43>
+			if (echoing)
+  8001ee:	85 ff                	test   %edi,%edi
+  8001f0:	75 05                	jne    8001f7 <readline+0x6c>
+			i--;
+  8001f2:	83 ee 01             	sub    $0x1,%esi
+  8001f5:	eb 18                	jmp    80020f <readline+0x84>
+				cputchar('\b');
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	6a 08                	push   $0x8
+  8001fc:	e8 bc 3a 00 00       	call   803cbd <cputchar>
+  800201:	83 c4 10             	add    $0x10,%esp
+  800204:	eb ec                	jmp    8001f2 <readline+0x67>
+			buf[i++] = c;
+  800206:	88 9e 00 70 80 00    	mov    %bl,0x807000(%esi)
+  80020c:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  80020f:	e8 c5 3a 00 00       	call   803cd9 <getchar>
+  800214:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  800216:	85 c0                	test   %eax,%eax
+  800218:	78 aa                	js     8001c4 <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  80021a:	83 f8 08             	cmp    $0x8,%eax
+  80021d:	0f 94 c0             	sete   %al
+  800220:	83 fb 7f             	cmp    $0x7f,%ebx
+  800223:	0f 94 c2             	sete   %dl
+  800226:	08 d0                	or     %dl,%al
+  800228:	74 04                	je     80022e <readline+0xa3>
+  80022a:	85 f6                	test   %esi,%esi
+  80022c:	7f c0                	jg     8001ee <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  80022e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800231:	7e 1a                	jle    80024d <readline+0xc2>
+  800233:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800239:	7f 12                	jg     80024d <readline+0xc2>
+			if (echoing)
+  80023b:	85 ff                	test   %edi,%edi
+  80023d:	74 c7                	je     800206 <readline+0x7b>
+				cputchar(c);
+  80023f:	83 ec 0c             	sub    $0xc,%esp
+  800242:	53                   	push   %ebx
+  800243:	e8 75 3a 00 00       	call   803cbd <cputchar>
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	eb b9                	jmp    800206 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  80024d:	83 fb 0a             	cmp    $0xa,%ebx
+  800250:	74 05                	je     800257 <readline+0xcc>
+  800252:	83 fb 0d             	cmp    $0xd,%ebx
+  800255:	75 b8                	jne    80020f <readline+0x84>
+			if (echoing)
+  800257:	85 ff                	test   %edi,%edi
+  800259:	75 11                	jne    80026c <readline+0xe1>
+			buf[i] = 0;
+  80025b:	c6 86 00 70 80 00 00 	movb   $0x0,0x807000(%esi)
+			return buf;
+  800262:	b8 00 70 80 00       	mov    $0x807000,%eax
+  800267:	e9 62 ff ff ff       	jmp    8001ce <readline+0x43>
+				cputchar('\n');
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	6a 0a                	push   $0xa
+  800271:	e8 47 3a 00 00       	call   803cbd <cputchar>
+  800276:	83 c4 10             	add    $0x10,%esp
+  800279:	eb e0                	jmp    80025b <readline+0xd0>
+
+0080027b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800281:	80 3a 00             	cmpb   $0x0,(%edx)
+  800284:	74 10                	je     800296 <strlen+0x1b>
+  800286:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  80028b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80028e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800292:	75 f7                	jne    80028b <strlen+0x10>
+	return n;
+}
+  800294:	5d                   	pop    %ebp
+  800295:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800296:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  80029b:	eb f7                	jmp    800294 <strlen+0x19>
+
+0080029d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8002a6:	85 d2                	test   %edx,%edx
+  8002a8:	74 16                	je     8002c0 <strnlen+0x23>
+  8002aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002af:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8002b3:	74 09                	je     8002be <strnlen+0x21>
+		n++;
+  8002b5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8002b8:	39 d0                	cmp    %edx,%eax
+  8002ba:	75 f3                	jne    8002af <strnlen+0x12>
+		n++;
+  8002bc:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  8002be:	5d                   	pop    %ebp
+  8002bf:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8002c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c5:	eb f7                	jmp    8002be <strnlen+0x21>
+
+008002c7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	53                   	push   %ebx
+  8002cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8002da:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8002dd:	83 c0 01             	add    $0x1,%eax
+  8002e0:	84 d2                	test   %dl,%dl
+  8002e2:	75 f2                	jne    8002d6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8002e4:	89 c8                	mov    %ecx,%eax
+  8002e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002e9:	c9                   	leave
+  8002ea:	c3                   	ret
+
+008002eb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	53                   	push   %ebx
+  8002ef:	83 ec 10             	sub    $0x10,%esp
+  8002f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8002f5:	53                   	push   %ebx
+  8002f6:	e8 80 ff ff ff       	call   80027b <strlen>
+  8002fb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8002fe:	ff 75 0c             	push   0xc(%ebp)
+  800301:	01 d8                	add    %ebx,%eax
+  800303:	50                   	push   %eax
+  800304:	e8 be ff ff ff       	call   8002c7 <strcpy>
+	return dst;
+}
+  800309:	89 d8                	mov    %ebx,%eax
+  80030b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+00800310 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	56                   	push   %esi
+  800314:	53                   	push   %ebx
+  800315:	8b 75 08             	mov    0x8(%ebp),%esi
+  800318:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80031b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80031e:	85 db                	test   %ebx,%ebx
+  800320:	74 17                	je     800339 <strncpy+0x29>
+  800322:	01 f3                	add    %esi,%ebx
+  800324:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800326:	83 c0 01             	add    $0x1,%eax
+  800329:	0f b6 0a             	movzbl (%edx),%ecx
+  80032c:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80032f:	80 f9 01             	cmp    $0x1,%cl
+  800332:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800335:	39 c3                	cmp    %eax,%ebx
+  800337:	75 ed                	jne    800326 <strncpy+0x16>
+	}
+	return ret;
+}
+  800339:	89 f0                	mov    %esi,%eax
+  80033b:	5b                   	pop    %ebx
+  80033c:	5e                   	pop    %esi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+
+0080033f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80033f:	55                   	push   %ebp
+  800340:	89 e5                	mov    %esp,%ebp
+  800342:	56                   	push   %esi
+  800343:	53                   	push   %ebx
+  800344:	8b 75 08             	mov    0x8(%ebp),%esi
+  800347:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80034d:	89 f0                	mov    %esi,%eax
+  80034f:	85 db                	test   %ebx,%ebx
+  800351:	74 1e                	je     800371 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800353:	83 eb 01             	sub    $0x1,%ebx
+  800356:	74 16                	je     80036e <strlcpy+0x2f>
+  800358:	01 f3                	add    %esi,%ebx
+  80035a:	0f b6 0a             	movzbl (%edx),%ecx
+  80035d:	84 c9                	test   %cl,%cl
+  80035f:	74 0d                	je     80036e <strlcpy+0x2f>
+			*dst++ = *src++;
+  800361:	83 c2 01             	add    $0x1,%edx
+  800364:	83 c0 01             	add    $0x1,%eax
+  800367:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  80036a:	39 d8                	cmp    %ebx,%eax
+  80036c:	75 ec                	jne    80035a <strlcpy+0x1b>
+		*dst = '\0';
+  80036e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800371:	29 f0                	sub    %esi,%eax
+}
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5d                   	pop    %ebp
+  800376:	c3                   	ret
+
+00800377 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800377:	55                   	push   %ebp
+  800378:	89 e5                	mov    %esp,%ebp
+  80037a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80037d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800380:	0f b6 01             	movzbl (%ecx),%eax
+  800383:	84 c0                	test   %al,%al
+  800385:	74 11                	je     800398 <strcmp+0x21>
+  800387:	38 02                	cmp    %al,(%edx)
+  800389:	75 0d                	jne    800398 <strcmp+0x21>
+		p++, q++;
+  80038b:	83 c1 01             	add    $0x1,%ecx
+  80038e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800391:	0f b6 01             	movzbl (%ecx),%eax
+  800394:	84 c0                	test   %al,%al
+  800396:	75 ef                	jne    800387 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800398:	0f b6 c0             	movzbl %al,%eax
+  80039b:	0f b6 12             	movzbl (%edx),%edx
+  80039e:	29 d0                	sub    %edx,%eax
+}
+  8003a0:	5d                   	pop    %ebp
+  8003a1:	c3                   	ret
+
+008003a2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8003a2:	55                   	push   %ebp
+  8003a3:	89 e5                	mov    %esp,%ebp
+  8003a5:	53                   	push   %ebx
+  8003a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003ac:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  8003af:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  8003b4:	85 d2                	test   %edx,%edx
+  8003b6:	74 2e                	je     8003e6 <strncmp+0x44>
+  8003b8:	0f b6 01             	movzbl (%ecx),%eax
+  8003bb:	84 c0                	test   %al,%al
+  8003bd:	74 16                	je     8003d5 <strncmp+0x33>
+  8003bf:	3a 03                	cmp    (%ebx),%al
+  8003c1:	75 12                	jne    8003d5 <strncmp+0x33>
+		n--, p++, q++;
+  8003c3:	83 c1 01             	add    $0x1,%ecx
+  8003c6:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  8003c9:	83 ea 01             	sub    $0x1,%edx
+  8003cc:	75 ea                	jne    8003b8 <strncmp+0x16>
+		return 0;
+  8003ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d3:	eb 11                	jmp    8003e6 <strncmp+0x44>
+  8003d5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8003da:	85 d2                	test   %edx,%edx
+  8003dc:	74 08                	je     8003e6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8003de:	0f b6 01             	movzbl (%ecx),%eax
+  8003e1:	0f b6 13             	movzbl (%ebx),%edx
+  8003e4:	29 d0                	sub    %edx,%eax
+}
+  8003e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003e9:	c9                   	leave
+  8003ea:	c3                   	ret
+
+008003eb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8003eb:	55                   	push   %ebp
+  8003ec:	89 e5                	mov    %esp,%ebp
+  8003ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8003f5:	0f b6 10             	movzbl (%eax),%edx
+  8003f8:	84 d2                	test   %dl,%dl
+  8003fa:	74 15                	je     800411 <strchr+0x26>
+		if (*s == c)
+  8003fc:	38 d1                	cmp    %dl,%cl
+  8003fe:	74 0f                	je     80040f <strchr+0x24>
+	for (; *s; s++)
+  800400:	83 c0 01             	add    $0x1,%eax
+  800403:	0f b6 10             	movzbl (%eax),%edx
+  800406:	84 d2                	test   %dl,%dl
+  800408:	75 f2                	jne    8003fc <strchr+0x11>
+			return (char *) s;
+	return 0;
+  80040a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+	return 0;
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+  800416:	eb f7                	jmp    80040f <strchr+0x24>
+
+00800418 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800418:	55                   	push   %ebp
+  800419:	89 e5                	mov    %esp,%ebp
+  80041b:	53                   	push   %ebx
+  80041c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80041f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800422:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800425:	38 d3                	cmp    %dl,%bl
+  800427:	74 14                	je     80043d <strfind+0x25>
+  800429:	89 d1                	mov    %edx,%ecx
+  80042b:	84 db                	test   %bl,%bl
+  80042d:	74 0e                	je     80043d <strfind+0x25>
+	for (; *s; s++)
+  80042f:	83 c0 01             	add    $0x1,%eax
+  800432:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800435:	38 ca                	cmp    %cl,%dl
+  800437:	74 04                	je     80043d <strfind+0x25>
+  800439:	84 d2                	test   %dl,%dl
+  80043b:	75 f2                	jne    80042f <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  80043d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800440:	c9                   	leave
+  800441:	c3                   	ret
+
+00800442 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	57                   	push   %edi
+  800446:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800449:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80044c:	85 c9                	test   %ecx,%ecx
+  80044e:	74 20                	je     800470 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800450:	89 f8                	mov    %edi,%eax
+  800452:	09 c8                	or     %ecx,%eax
+  800454:	a8 03                	test   $0x3,%al
+  800456:	75 12                	jne    80046a <memset+0x28>
+		c &= 0xFF;
+  800458:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80045c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800462:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800465:	fc                   	cld
+  800466:	f3 ab                	rep stos %eax,%es:(%edi)
+  800468:	eb 06                	jmp    800470 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80046a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80046d:	fc                   	cld
+  80046e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800470:	89 f8                	mov    %edi,%eax
+  800472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800475:	c9                   	leave
+  800476:	c3                   	ret
+
+00800477 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	57                   	push   %edi
+  80047b:	56                   	push   %esi
+  80047c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80047f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800482:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800485:	39 c6                	cmp    %eax,%esi
+  800487:	73 32                	jae    8004bb <memmove+0x44>
+  800489:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80048c:	39 d0                	cmp    %edx,%eax
+  80048e:	73 2b                	jae    8004bb <memmove+0x44>
+		s += n;
+		d += n;
+  800490:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800493:	89 d6                	mov    %edx,%esi
+  800495:	09 fe                	or     %edi,%esi
+  800497:	09 ce                	or     %ecx,%esi
+  800499:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80049f:	75 0e                	jne    8004af <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8004a1:	83 ef 04             	sub    $0x4,%edi
+  8004a4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8004a7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8004aa:	fd                   	std
+  8004ab:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8004ad:	eb 09                	jmp    8004b8 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8004af:	83 ef 01             	sub    $0x1,%edi
+  8004b2:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8004b5:	fd                   	std
+  8004b6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8004b8:	fc                   	cld
+  8004b9:	eb 1a                	jmp    8004d5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8004bb:	89 f2                	mov    %esi,%edx
+  8004bd:	09 c2                	or     %eax,%edx
+  8004bf:	09 ca                	or     %ecx,%edx
+  8004c1:	f6 c2 03             	test   $0x3,%dl
+  8004c4:	75 0a                	jne    8004d0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8004c6:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8004c9:	89 c7                	mov    %eax,%edi
+  8004cb:	fc                   	cld
+  8004cc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8004ce:	eb 05                	jmp    8004d5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8004d0:	89 c7                	mov    %eax,%edi
+  8004d2:	fc                   	cld
+  8004d3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8004d5:	5e                   	pop    %esi
+  8004d6:	5f                   	pop    %edi
+  8004d7:	5d                   	pop    %ebp
+  8004d8:	c3                   	ret
+
+008004d9 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  8004d9:	55                   	push   %ebp
+  8004da:	89 e5                	mov    %esp,%ebp
+  8004dc:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8004df:	ff 75 10             	push   0x10(%ebp)
+  8004e2:	ff 75 0c             	push   0xc(%ebp)
+  8004e5:	ff 75 08             	push   0x8(%ebp)
+  8004e8:	e8 8a ff ff ff       	call   800477 <memmove>
+}
+  8004ed:	c9                   	leave
+  8004ee:	c3                   	ret
+
+008004ef <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	56                   	push   %esi
+  8004f3:	53                   	push   %ebx
+  8004f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004fa:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8004fd:	85 f6                	test   %esi,%esi
+  8004ff:	74 29                	je     80052a <memcmp+0x3b>
+  800501:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800503:	0f b6 08             	movzbl (%eax),%ecx
+  800506:	0f b6 1a             	movzbl (%edx),%ebx
+  800509:	38 d9                	cmp    %bl,%cl
+  80050b:	75 11                	jne    80051e <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80050d:	83 c0 01             	add    $0x1,%eax
+  800510:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800513:	39 c6                	cmp    %eax,%esi
+  800515:	75 ec                	jne    800503 <memcmp+0x14>
+	}
+
+	return 0;
+  800517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051c:	eb 08                	jmp    800526 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  80051e:	0f b6 c1             	movzbl %cl,%eax
+  800521:	0f b6 db             	movzbl %bl,%ebx
+  800524:	29 d8                	sub    %ebx,%eax
+}
+  800526:	5b                   	pop    %ebx
+  800527:	5e                   	pop    %esi
+  800528:	5d                   	pop    %ebp
+  800529:	c3                   	ret
+	return 0;
+  80052a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80052f:	eb f5                	jmp    800526 <memcmp+0x37>
+
+00800531 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800531:	55                   	push   %ebp
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	8b 45 08             	mov    0x8(%ebp),%eax
+  800537:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80053a:	89 c2                	mov    %eax,%edx
+  80053c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80053f:	39 d0                	cmp    %edx,%eax
+  800541:	73 0d                	jae    800550 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800543:	38 08                	cmp    %cl,(%eax)
+  800545:	74 0d                	je     800554 <memfind+0x23>
+	for (; s < ends; s++)
+  800547:	83 c0 01             	add    $0x1,%eax
+  80054a:	39 c2                	cmp    %eax,%edx
+  80054c:	75 f5                	jne    800543 <memfind+0x12>
+  80054e:	eb 06                	jmp    800556 <memfind+0x25>
+  800550:	89 c2                	mov    %eax,%edx
+  800552:	eb 02                	jmp    800556 <memfind+0x25>
+  800554:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800556:	89 d0                	mov    %edx,%eax
+  800558:	5d                   	pop    %ebp
+  800559:	c3                   	ret
+
+0080055a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80055a:	55                   	push   %ebp
+  80055b:	89 e5                	mov    %esp,%ebp
+  80055d:	57                   	push   %edi
+  80055e:	56                   	push   %esi
+  80055f:	53                   	push   %ebx
+  800560:	8b 55 08             	mov    0x8(%ebp),%edx
+  800563:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800566:	0f b6 02             	movzbl (%edx),%eax
+  800569:	3c 20                	cmp    $0x20,%al
+  80056b:	74 04                	je     800571 <strtol+0x17>
+  80056d:	3c 09                	cmp    $0x9,%al
+  80056f:	75 0e                	jne    80057f <strtol+0x25>
+		s++;
+  800571:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800574:	0f b6 02             	movzbl (%edx),%eax
+  800577:	3c 20                	cmp    $0x20,%al
+  800579:	74 f6                	je     800571 <strtol+0x17>
+  80057b:	3c 09                	cmp    $0x9,%al
+  80057d:	74 f2                	je     800571 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80057f:	3c 2b                	cmp    $0x2b,%al
+  800581:	74 2a                	je     8005ad <strtol+0x53>
+	int neg = 0;
+  800583:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800588:	3c 2d                	cmp    $0x2d,%al
+  80058a:	74 2b                	je     8005b7 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80058c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800592:	75 0f                	jne    8005a3 <strtol+0x49>
+  800594:	80 3a 30             	cmpb   $0x30,(%edx)
+  800597:	74 28                	je     8005c1 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800599:	85 db                	test   %ebx,%ebx
+  80059b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8005a0:	0f 44 d8             	cmove  %eax,%ebx
+  8005a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8005ab:	eb 46                	jmp    8005f3 <strtol+0x99>
+		s++;
+  8005ad:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  8005b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005b5:	eb d5                	jmp    80058c <strtol+0x32>
+		s++, neg = 1;
+  8005b7:	83 c2 01             	add    $0x1,%edx
+  8005ba:	bf 01 00 00 00       	mov    $0x1,%edi
+  8005bf:	eb cb                	jmp    80058c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8005c1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8005c5:	74 0e                	je     8005d5 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  8005c7:	85 db                	test   %ebx,%ebx
+  8005c9:	75 d8                	jne    8005a3 <strtol+0x49>
+		s++, base = 8;
+  8005cb:	83 c2 01             	add    $0x1,%edx
+  8005ce:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8005d3:	eb ce                	jmp    8005a3 <strtol+0x49>
+		s += 2, base = 16;
+  8005d5:	83 c2 02             	add    $0x2,%edx
+  8005d8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8005dd:	eb c4                	jmp    8005a3 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8005df:	0f be c0             	movsbl %al,%eax
+  8005e2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8005e5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8005e8:	7d 3a                	jge    800624 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8005ea:	83 c2 01             	add    $0x1,%edx
+  8005ed:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8005f1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8005f3:	0f b6 02             	movzbl (%edx),%eax
+  8005f6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8005f9:	89 f3                	mov    %esi,%ebx
+  8005fb:	80 fb 09             	cmp    $0x9,%bl
+  8005fe:	76 df                	jbe    8005df <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800600:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800603:	89 f3                	mov    %esi,%ebx
+  800605:	80 fb 19             	cmp    $0x19,%bl
+  800608:	77 08                	ja     800612 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  80060a:	0f be c0             	movsbl %al,%eax
+  80060d:	83 e8 57             	sub    $0x57,%eax
+  800610:	eb d3                	jmp    8005e5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800612:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800615:	89 f3                	mov    %esi,%ebx
+  800617:	80 fb 19             	cmp    $0x19,%bl
+  80061a:	77 08                	ja     800624 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  80061c:	0f be c0             	movsbl %al,%eax
+  80061f:	83 e8 37             	sub    $0x37,%eax
+  800622:	eb c1                	jmp    8005e5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800624:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800628:	74 05                	je     80062f <strtol+0xd5>
+		*endptr = (char *) s;
+  80062a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80062d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80062f:	89 c8                	mov    %ecx,%eax
+  800631:	f7 d8                	neg    %eax
+  800633:	85 ff                	test   %edi,%edi
+  800635:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800638:	89 c8                	mov    %ecx,%eax
+  80063a:	5b                   	pop    %ebx
+  80063b:	5e                   	pop    %esi
+  80063c:	5f                   	pop    %edi
+  80063d:	5d                   	pop    %ebp
+  80063e:	c3                   	ret
+
+0080063f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80063f:	55                   	push   %ebp
+  800640:	89 e5                	mov    %esp,%ebp
+  800642:	57                   	push   %edi
+  800643:	56                   	push   %esi
+  800644:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800645:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80064d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800650:	89 c3                	mov    %eax,%ebx
+  800652:	89 c7                	mov    %eax,%edi
+  800654:	89 c6                	mov    %eax,%esi
+  800656:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800658:	5b                   	pop    %ebx
+  800659:	5e                   	pop    %esi
+  80065a:	5f                   	pop    %edi
+  80065b:	5d                   	pop    %ebp
+  80065c:	c3                   	ret
+
+0080065d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80065d:	55                   	push   %ebp
+  80065e:	89 e5                	mov    %esp,%ebp
+  800660:	57                   	push   %edi
+  800661:	56                   	push   %esi
+  800662:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800663:	ba 00 00 00 00       	mov    $0x0,%edx
+  800668:	b8 01 00 00 00       	mov    $0x1,%eax
+  80066d:	89 d1                	mov    %edx,%ecx
+  80066f:	89 d3                	mov    %edx,%ebx
+  800671:	89 d7                	mov    %edx,%edi
+  800673:	89 d6                	mov    %edx,%esi
+  800675:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800677:	5b                   	pop    %ebx
+  800678:	5e                   	pop    %esi
+  800679:	5f                   	pop    %edi
+  80067a:	5d                   	pop    %ebp
+  80067b:	c3                   	ret
+
+0080067c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80067c:	55                   	push   %ebp
+  80067d:	89 e5                	mov    %esp,%ebp
+  80067f:	57                   	push   %edi
+  800680:	56                   	push   %esi
+  800681:	53                   	push   %ebx
+  800682:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80068d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800692:	89 cb                	mov    %ecx,%ebx
+  800694:	89 cf                	mov    %ecx,%edi
+  800696:	89 ce                	mov    %ecx,%esi
+  800698:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	7f 08                	jg     8006a6 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80069e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a1:	5b                   	pop    %ebx
+  8006a2:	5e                   	pop    %esi
+  8006a3:	5f                   	pop    %edi
+  8006a4:	5d                   	pop    %ebp
+  8006a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8006a6:	83 ec 0c             	sub    $0xc,%esp
+  8006a9:	50                   	push   %eax
+  8006aa:	6a 03                	push   $0x3
+  8006ac:	68 84 52 80 00       	push   $0x805284
+  8006b1:	6a 23                	push   $0x23
+  8006b3:	68 a1 52 80 00       	push   $0x8052a1
+  8006b8:	e8 c3 36 00 00       	call   803d80 <_panic>
+
+008006bd <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8006bd:	55                   	push   %ebp
+  8006be:	89 e5                	mov    %esp,%ebp
+  8006c0:	57                   	push   %edi
+  8006c1:	56                   	push   %esi
+  8006c2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8006c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c8:	b8 02 00 00 00       	mov    $0x2,%eax
+  8006cd:	89 d1                	mov    %edx,%ecx
+  8006cf:	89 d3                	mov    %edx,%ebx
+  8006d1:	89 d7                	mov    %edx,%edi
+  8006d3:	89 d6                	mov    %edx,%esi
+  8006d5:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8006d7:	5b                   	pop    %ebx
+  8006d8:	5e                   	pop    %esi
+  8006d9:	5f                   	pop    %edi
+  8006da:	5d                   	pop    %ebp
+  8006db:	c3                   	ret
+
+008006dc <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	57                   	push   %edi
+  8006e0:	56                   	push   %esi
+  8006e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8006e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8006ec:	89 d1                	mov    %edx,%ecx
+  8006ee:	89 d3                	mov    %edx,%ebx
+  8006f0:	89 d7                	mov    %edx,%edi
+  8006f2:	89 d6                	mov    %edx,%esi
+  8006f4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8006f6:	5b                   	pop    %ebx
+  8006f7:	5e                   	pop    %esi
+  8006f8:	5f                   	pop    %edi
+  8006f9:	5d                   	pop    %ebp
+  8006fa:	c3                   	ret
+
+008006fb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8006fb:	55                   	push   %ebp
+  8006fc:	89 e5                	mov    %esp,%ebp
+  8006fe:	57                   	push   %edi
+  8006ff:	56                   	push   %esi
+  800700:	53                   	push   %ebx
+  800701:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800704:	be 00 00 00 00       	mov    $0x0,%esi
+  800709:	8b 55 08             	mov    0x8(%ebp),%edx
+  80070c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80070f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800714:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800717:	89 f7                	mov    %esi,%edi
+  800719:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80071b:	85 c0                	test   %eax,%eax
+  80071d:	7f 08                	jg     800727 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  80071f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800722:	5b                   	pop    %ebx
+  800723:	5e                   	pop    %esi
+  800724:	5f                   	pop    %edi
+  800725:	5d                   	pop    %ebp
+  800726:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800727:	83 ec 0c             	sub    $0xc,%esp
+  80072a:	50                   	push   %eax
+  80072b:	6a 04                	push   $0x4
+  80072d:	68 84 52 80 00       	push   $0x805284
+  800732:	6a 23                	push   $0x23
+  800734:	68 a1 52 80 00       	push   $0x8052a1
+  800739:	e8 42 36 00 00       	call   803d80 <_panic>
+
+0080073e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	57                   	push   %edi
+  800742:	56                   	push   %esi
+  800743:	53                   	push   %ebx
+  800744:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80074a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80074d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800752:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800755:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800758:	8b 75 18             	mov    0x18(%ebp),%esi
+  80075b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80075d:	85 c0                	test   %eax,%eax
+  80075f:	7f 08                	jg     800769 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800761:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800764:	5b                   	pop    %ebx
+  800765:	5e                   	pop    %esi
+  800766:	5f                   	pop    %edi
+  800767:	5d                   	pop    %ebp
+  800768:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800769:	83 ec 0c             	sub    $0xc,%esp
+  80076c:	50                   	push   %eax
+  80076d:	6a 05                	push   $0x5
+  80076f:	68 84 52 80 00       	push   $0x805284
+  800774:	6a 23                	push   $0x23
+  800776:	68 a1 52 80 00       	push   $0x8052a1
+  80077b:	e8 00 36 00 00       	call   803d80 <_panic>
+
+00800780 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	57                   	push   %edi
+  800784:	56                   	push   %esi
+  800785:	53                   	push   %ebx
+  800786:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800789:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80078e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800791:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800794:	b8 06 00 00 00       	mov    $0x6,%eax
+  800799:	89 df                	mov    %ebx,%edi
+  80079b:	89 de                	mov    %ebx,%esi
+  80079d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80079f:	85 c0                	test   %eax,%eax
+  8007a1:	7f 08                	jg     8007ab <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8007a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a6:	5b                   	pop    %ebx
+  8007a7:	5e                   	pop    %esi
+  8007a8:	5f                   	pop    %edi
+  8007a9:	5d                   	pop    %ebp
+  8007aa:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007ab:	83 ec 0c             	sub    $0xc,%esp
+  8007ae:	50                   	push   %eax
+  8007af:	6a 06                	push   $0x6
+  8007b1:	68 84 52 80 00       	push   $0x805284
+  8007b6:	6a 23                	push   $0x23
+  8007b8:	68 a1 52 80 00       	push   $0x8052a1
+  8007bd:	e8 be 35 00 00       	call   803d80 <_panic>
+
+008007c2 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	57                   	push   %edi
+  8007c6:	56                   	push   %esi
+  8007c7:	53                   	push   %ebx
+  8007c8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8007cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8007db:	89 df                	mov    %ebx,%edi
+  8007dd:	89 de                	mov    %ebx,%esi
+  8007df:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8007e1:	85 c0                	test   %eax,%eax
+  8007e3:	7f 08                	jg     8007ed <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8007e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007e8:	5b                   	pop    %ebx
+  8007e9:	5e                   	pop    %esi
+  8007ea:	5f                   	pop    %edi
+  8007eb:	5d                   	pop    %ebp
+  8007ec:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8007ed:	83 ec 0c             	sub    $0xc,%esp
+  8007f0:	50                   	push   %eax
+  8007f1:	6a 08                	push   $0x8
+  8007f3:	68 84 52 80 00       	push   $0x805284
+  8007f8:	6a 23                	push   $0x23
+  8007fa:	68 a1 52 80 00       	push   $0x8052a1
+  8007ff:	e8 7c 35 00 00       	call   803d80 <_panic>
+
+00800804 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800804:	55                   	push   %ebp
+  800805:	89 e5                	mov    %esp,%ebp
+  800807:	57                   	push   %edi
+  800808:	56                   	push   %esi
+  800809:	53                   	push   %ebx
+  80080a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80080d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800812:	8b 55 08             	mov    0x8(%ebp),%edx
+  800815:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800818:	b8 09 00 00 00       	mov    $0x9,%eax
+  80081d:	89 df                	mov    %ebx,%edi
+  80081f:	89 de                	mov    %ebx,%esi
+  800821:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800823:	85 c0                	test   %eax,%eax
+  800825:	7f 08                	jg     80082f <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80082a:	5b                   	pop    %ebx
+  80082b:	5e                   	pop    %esi
+  80082c:	5f                   	pop    %edi
+  80082d:	5d                   	pop    %ebp
+  80082e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80082f:	83 ec 0c             	sub    $0xc,%esp
+  800832:	50                   	push   %eax
+  800833:	6a 09                	push   $0x9
+  800835:	68 84 52 80 00       	push   $0x805284
+  80083a:	6a 23                	push   $0x23
+  80083c:	68 a1 52 80 00       	push   $0x8052a1
+  800841:	e8 3a 35 00 00       	call   803d80 <_panic>
+
+00800846 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800846:	55                   	push   %ebp
+  800847:	89 e5                	mov    %esp,%ebp
+  800849:	57                   	push   %edi
+  80084a:	56                   	push   %esi
+  80084b:	53                   	push   %ebx
+  80084c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80084f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800854:	8b 55 08             	mov    0x8(%ebp),%edx
+  800857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80085f:	89 df                	mov    %ebx,%edi
+  800861:	89 de                	mov    %ebx,%esi
+  800863:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800865:	85 c0                	test   %eax,%eax
+  800867:	7f 08                	jg     800871 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80086c:	5b                   	pop    %ebx
+  80086d:	5e                   	pop    %esi
+  80086e:	5f                   	pop    %edi
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800871:	83 ec 0c             	sub    $0xc,%esp
+  800874:	50                   	push   %eax
+  800875:	6a 0a                	push   $0xa
+  800877:	68 84 52 80 00       	push   $0x805284
+  80087c:	6a 23                	push   $0x23
+  80087e:	68 a1 52 80 00       	push   $0x8052a1
+  800883:	e8 f8 34 00 00       	call   803d80 <_panic>
+
+00800888 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	57                   	push   %edi
+  80088c:	56                   	push   %esi
+  80088d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80088e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800891:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800894:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800899:	be 00 00 00 00       	mov    $0x0,%esi
+  80089e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008a1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8008a4:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8008a6:	5b                   	pop    %ebx
+  8008a7:	5e                   	pop    %esi
+  8008a8:	5f                   	pop    %edi
+  8008a9:	5d                   	pop    %ebp
+  8008aa:	c3                   	ret
+
+008008ab <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	57                   	push   %edi
+  8008af:	56                   	push   %esi
+  8008b0:	53                   	push   %ebx
+  8008b1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8008b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8008c1:	89 cb                	mov    %ecx,%ebx
+  8008c3:	89 cf                	mov    %ecx,%edi
+  8008c5:	89 ce                	mov    %ecx,%esi
+  8008c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8008c9:	85 c0                	test   %eax,%eax
+  8008cb:	7f 08                	jg     8008d5 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8008cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d0:	5b                   	pop    %ebx
+  8008d1:	5e                   	pop    %esi
+  8008d2:	5f                   	pop    %edi
+  8008d3:	5d                   	pop    %ebp
+  8008d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8008d5:	83 ec 0c             	sub    $0xc,%esp
+  8008d8:	50                   	push   %eax
+  8008d9:	6a 0d                	push   $0xd
+  8008db:	68 84 52 80 00       	push   $0x805284
+  8008e0:	6a 23                	push   $0x23
+  8008e2:	68 a1 52 80 00       	push   $0x8052a1
+  8008e7:	e8 94 34 00 00       	call   803d80 <_panic>
+
+008008ec <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8008ec:	55                   	push   %ebp
+  8008ed:	89 e5                	mov    %esp,%ebp
+  8008ef:	57                   	push   %edi
+  8008f0:	56                   	push   %esi
+  8008f1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8008f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8008fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800900:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800903:	8b 75 18             	mov    0x18(%ebp),%esi
+  800906:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800908:	5b                   	pop    %ebx
+  800909:	5e                   	pop    %esi
+  80090a:	5f                   	pop    %edi
+  80090b:	5d                   	pop    %ebp
+  80090c:	c3                   	ret
+
+0080090d <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  80090d:	55                   	push   %ebp
+  80090e:	89 e5                	mov    %esp,%ebp
+  800910:	57                   	push   %edi
+  800911:	56                   	push   %esi
+  800912:	53                   	push   %ebx
+  800913:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800916:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80091b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80091e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800921:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800926:	89 df                	mov    %ebx,%edi
+  800928:	89 de                	mov    %ebx,%esi
+  80092a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80092c:	85 c0                	test   %eax,%eax
+  80092e:	7f 08                	jg     800938 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800933:	5b                   	pop    %ebx
+  800934:	5e                   	pop    %esi
+  800935:	5f                   	pop    %edi
+  800936:	5d                   	pop    %ebp
+  800937:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800938:	83 ec 0c             	sub    $0xc,%esp
+  80093b:	50                   	push   %eax
+  80093c:	6a 0d                	push   $0xd
+  80093e:	68 84 52 80 00       	push   $0x805284
+  800943:	6a 23                	push   $0x23
+  800945:	68 a1 52 80 00       	push   $0x8052a1
+  80094a:	e8 31 34 00 00       	call   803d80 <_panic>
+
+0080094f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80094f:	55                   	push   %ebp
+  800950:	89 e5                	mov    %esp,%ebp
+  800952:	57                   	push   %edi
+  800953:	56                   	push   %esi
+  800954:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80095f:	89 d1                	mov    %edx,%ecx
+  800961:	89 d3                	mov    %edx,%ebx
+  800963:	89 d7                	mov    %edx,%edi
+  800965:	89 d6                	mov    %edx,%esi
+  800967:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5f                   	pop    %edi
+  80096c:	5d                   	pop    %ebp
+  80096d:	c3                   	ret
+
+0080096e <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	57                   	push   %edi
+  800972:	56                   	push   %esi
+  800973:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800974:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800979:	8b 55 08             	mov    0x8(%ebp),%edx
+  80097c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80097f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800984:	89 df                	mov    %ebx,%edi
+  800986:	89 de                	mov    %ebx,%esi
+  800988:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80098a:	5b                   	pop    %ebx
+  80098b:	5e                   	pop    %esi
+  80098c:	5f                   	pop    %edi
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	57                   	push   %edi
+  800993:	56                   	push   %esi
+  800994:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800995:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099d:	b8 10 00 00 00       	mov    $0x10,%eax
+  8009a2:	89 cb                	mov    %ecx,%ebx
+  8009a4:	89 cf                	mov    %ecx,%edi
+  8009a6:	89 ce                	mov    %ecx,%esi
+  8009a8:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8009aa:	5b                   	pop    %ebx
+  8009ab:	5e                   	pop    %esi
+  8009ac:	5f                   	pop    %edi
+  8009ad:	5d                   	pop    %ebp
+  8009ae:	c3                   	ret
+
+008009af <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	57                   	push   %edi
+  8009b3:	56                   	push   %esi
+  8009b4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009c0:	b8 11 00 00 00       	mov    $0x11,%eax
+  8009c5:	89 df                	mov    %ebx,%edi
+  8009c7:	89 de                	mov    %ebx,%esi
+  8009c9:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8009cb:	5b                   	pop    %ebx
+  8009cc:	5e                   	pop    %esi
+  8009cd:	5f                   	pop    %edi
+  8009ce:	5d                   	pop    %ebp
+  8009cf:	c3                   	ret
+
+008009d0 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8009d0:	55                   	push   %ebp
+  8009d1:	89 e5                	mov    %esp,%ebp
+  8009d3:	57                   	push   %edi
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8009e6:	89 df                	mov    %ebx,%edi
+  8009e8:	89 de                	mov    %ebx,%esi
+  8009ea:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8009ec:	5b                   	pop    %ebx
+  8009ed:	5e                   	pop    %esi
+  8009ee:	5f                   	pop    %edi
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	57                   	push   %edi
+  8009f5:	56                   	push   %esi
+  8009f6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8009f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ff:	b8 13 00 00 00       	mov    $0x13,%eax
+  800a04:	89 cb                	mov    %ecx,%ebx
+  800a06:	89 cf                	mov    %ecx,%edi
+  800a08:	89 ce                	mov    %ecx,%esi
+  800a0a:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  800a0c:	5b                   	pop    %ebx
+  800a0d:	5e                   	pop    %esi
+  800a0e:	5f                   	pop    %edi
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	56                   	push   %esi
+  800a16:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a22:	b8 14 00 00 00       	mov    $0x14,%eax
+  800a27:	89 df                	mov    %ebx,%edi
+  800a29:	89 de                	mov    %ebx,%esi
+  800a2b:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  800a2d:	5b                   	pop    %ebx
+  800a2e:	5e                   	pop    %esi
+  800a2f:	5f                   	pop    %edi
+  800a30:	5d                   	pop    %ebp
+  800a31:	c3                   	ret
+
+00800a32 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  800a32:	55                   	push   %ebp
+  800a33:	89 e5                	mov    %esp,%ebp
+  800a35:	57                   	push   %edi
+  800a36:	56                   	push   %esi
+  800a37:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a40:	b8 15 00 00 00       	mov    $0x15,%eax
+  800a45:	89 cb                	mov    %ecx,%ebx
+  800a47:	89 cf                	mov    %ecx,%edi
+  800a49:	89 ce                	mov    %ecx,%esi
+  800a4b:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  800a4d:	5b                   	pop    %ebx
+  800a4e:	5e                   	pop    %esi
+  800a4f:	5f                   	pop    %edi
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+
+00800a52 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	57                   	push   %edi
+  800a56:	56                   	push   %esi
+  800a57:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a58:	be 00 00 00 00       	mov    $0x0,%esi
+  800a5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a63:	b8 16 00 00 00       	mov    $0x16,%eax
+  800a68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800a6b:	89 f7                	mov    %esi,%edi
+  800a6d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  800a6f:	5b                   	pop    %ebx
+  800a70:	5e                   	pop    %esi
+  800a71:	5f                   	pop    %edi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a85:	b8 17 00 00 00       	mov    $0x17,%eax
+  800a8a:	89 df                	mov    %ebx,%edi
+  800a8c:	89 de                	mov    %ebx,%esi
+  800a8e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  800a90:	5b                   	pop    %ebx
+  800a91:	5e                   	pop    %esi
+  800a92:	5f                   	pop    %edi
+  800a93:	5d                   	pop    %ebp
+  800a94:	c3                   	ret
+
+00800a95 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  800a95:	55                   	push   %ebp
+  800a96:	89 e5                	mov    %esp,%ebp
+  800a98:	57                   	push   %edi
+  800a99:	56                   	push   %esi
+  800a9a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800a9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aa3:	b8 18 00 00 00       	mov    $0x18,%eax
+  800aa8:	89 cb                	mov    %ecx,%ebx
+  800aaa:	89 cf                	mov    %ecx,%edi
+  800aac:	89 ce                	mov    %ecx,%esi
+  800aae:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  800ab0:	5b                   	pop    %ebx
+  800ab1:	5e                   	pop    %esi
+  800ab2:	5f                   	pop    %edi
+  800ab3:	5d                   	pop    %ebp
+  800ab4:	c3                   	ret
+
+00800ab5 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  800ab5:	55                   	push   %ebp
+  800ab6:	89 e5                	mov    %esp,%ebp
+  800ab8:	57                   	push   %edi
+  800ab9:	56                   	push   %esi
+  800aba:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  800abb:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  800abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ac4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac7:	b8 19 00 00 00       	mov    $0x19,%eax
+  800acc:	89 df                	mov    %ebx,%edi
+  800ace:	89 de                	mov    %ebx,%esi
+  800ad0:	cd 30                	int    $0x30
+}
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5f                   	pop    %edi
+  800ad5:	5d                   	pop    %ebp
+  800ad6:	c3                   	ret
+
+00800ad7 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	57                   	push   %edi
+  800adb:	56                   	push   %esi
+  800adc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800add:	be 00 00 00 00       	mov    $0x0,%esi
+  800ae2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800aed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800af0:	89 f7                	mov    %esi,%edi
+  800af2:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  800af4:	5b                   	pop    %ebx
+  800af5:	5e                   	pop    %esi
+  800af6:	5f                   	pop    %edi
+  800af7:	5d                   	pop    %ebp
+  800af8:	c3                   	ret
+
+00800af9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	57                   	push   %edi
+  800afd:	56                   	push   %esi
+  800afe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800aff:	be 00 00 00 00       	mov    $0x0,%esi
+  800b04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b0a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800b0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b12:	89 f7                	mov    %esi,%edi
+  800b14:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  800b16:	5b                   	pop    %ebx
+  800b17:	5e                   	pop    %esi
+  800b18:	5f                   	pop    %edi
+  800b19:	5d                   	pop    %ebp
+  800b1a:	c3                   	ret
+
+00800b1b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  800b31:	89 df                	mov    %ebx,%edi
+  800b33:	89 de                	mov    %ebx,%esi
+  800b35:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  800b37:	5b                   	pop    %ebx
+  800b38:	5e                   	pop    %esi
+  800b39:	5f                   	pop    %edi
+  800b3a:	5d                   	pop    %ebp
+  800b3b:	c3                   	ret
+
+00800b3c <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  800b3c:	55                   	push   %ebp
+  800b3d:	89 e5                	mov    %esp,%ebp
+  800b3f:	57                   	push   %edi
+  800b40:	56                   	push   %esi
+  800b41:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b42:	be 00 00 00 00       	mov    $0x0,%esi
+  800b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b4d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  800b52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b55:	89 f7                	mov    %esi,%edi
+  800b57:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800b61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b64:	05 00 00 00 30       	add    $0x30000000,%eax
+  800b69:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800b6c:	5d                   	pop    %ebp
+  800b6d:	c3                   	ret
+
+00800b6e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800b71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b74:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800b79:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b7e:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  800b83:	5d                   	pop    %ebp
+  800b84:	c3                   	ret
+
+00800b85 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  800b8d:	89 c2                	mov    %eax,%edx
+  800b8f:	c1 ea 16             	shr    $0x16,%edx
+  800b92:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800b99:	f6 c2 01             	test   $0x1,%dl
+  800b9c:	74 29                	je     800bc7 <fd_alloc+0x42>
+  800b9e:	89 c2                	mov    %eax,%edx
+  800ba0:	c1 ea 0c             	shr    $0xc,%edx
+  800ba3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800baa:	f6 c2 01             	test   $0x1,%dl
+  800bad:	74 18                	je     800bc7 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  800baf:	05 00 10 00 00       	add    $0x1000,%eax
+  800bb4:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  800bb9:	75 d2                	jne    800b8d <fd_alloc+0x8>
+  800bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800bc0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800bc5:	eb 05                	jmp    800bcc <fd_alloc+0x47>
+			return 0;
+  800bc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  800bcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcf:	89 02                	mov    %eax,(%edx)
+}
+  800bd1:	89 c8                	mov    %ecx,%eax
+  800bd3:	5d                   	pop    %ebp
+  800bd4:	c3                   	ret
+
+00800bd5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  800bdb:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  800be0:	77 30                	ja     800c12 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  800be2:	c1 e0 0c             	shl    $0xc,%eax
+  800be5:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  800bea:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800bf0:	f6 c2 01             	test   $0x1,%dl
+  800bf3:	74 24                	je     800c19 <fd_lookup+0x44>
+  800bf5:	89 c2                	mov    %eax,%edx
+  800bf7:	c1 ea 0c             	shr    $0xc,%edx
+  800bfa:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800c01:	f6 c2 01             	test   $0x1,%dl
+  800c04:	74 1a                	je     800c20 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  800c06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c09:	89 02                	mov    %eax,(%edx)
+	return 0;
+  800c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c10:	5d                   	pop    %ebp
+  800c11:	c3                   	ret
+		return -E_INVAL;
+  800c12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c17:	eb f7                	jmp    800c10 <fd_lookup+0x3b>
+		return -E_INVAL;
+  800c19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c1e:	eb f0                	jmp    800c10 <fd_lookup+0x3b>
+  800c20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c25:	eb e9                	jmp    800c10 <fd_lookup+0x3b>
+
+00800c27 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	53                   	push   %ebx
+  800c2b:	83 ec 04             	sub    $0x4,%esp
+  800c2e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c36:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  800c3b:	39 13                	cmp    %edx,(%ebx)
+  800c3d:	74 54                	je     800c93 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  800c3f:	83 c0 01             	add    $0x1,%eax
+  800c42:	8b 1c 85 2c 53 80 00 	mov    0x80532c(,%eax,4),%ebx
+  800c49:	85 db                	test   %ebx,%ebx
+  800c4b:	75 ee                	jne    800c3b <dev_lookup+0x14>
+  800c4d:	89 e1                	mov    %esp,%ecx
+  800c4f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800c54:	29 c8                	sub    %ecx,%eax
+  800c56:	89 c1                	mov    %eax,%ecx
+  800c58:	c1 e9 0f             	shr    $0xf,%ecx
+  800c5b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800c68:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  800c6f:	8b 40 48             	mov    0x48(%eax),%eax
+  800c72:	83 ec 04             	sub    $0x4,%esp
+  800c75:	52                   	push   %edx
+  800c76:	50                   	push   %eax
+  800c77:	68 b0 52 80 00       	push   $0x8052b0
+  800c7c:	e8 da 31 00 00       	call   803e5b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  800c81:	83 c4 10             	add    $0x10,%esp
+  800c84:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  800c89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c8c:	89 1a                	mov    %ebx,(%edx)
+}
+  800c8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c91:	c9                   	leave
+  800c92:	c3                   	ret
+			return 0;
+  800c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c98:	eb ef                	jmp    800c89 <dev_lookup+0x62>
+
+00800c9a <fd_close>:
+{
+  800c9a:	55                   	push   %ebp
+  800c9b:	89 e5                	mov    %esp,%ebp
+  800c9d:	57                   	push   %edi
+  800c9e:	56                   	push   %esi
+  800c9f:	53                   	push   %ebx
+  800ca0:	83 ec 24             	sub    $0x24,%esp
+  800ca3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ca6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800ca9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800cac:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800cad:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800cb3:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800cb6:	50                   	push   %eax
+  800cb7:	e8 19 ff ff ff       	call   800bd5 <fd_lookup>
+  800cbc:	89 c3                	mov    %eax,%ebx
+  800cbe:	83 c4 10             	add    $0x10,%esp
+  800cc1:	85 c0                	test   %eax,%eax
+  800cc3:	78 05                	js     800cca <fd_close+0x30>
+	    || fd != fd2)
+  800cc5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800cc8:	74 0f                	je     800cd9 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  800cca:	85 ff                	test   %edi,%edi
+  800ccc:	0f 44 df             	cmove  %edi,%ebx
+}
+  800ccf:	89 d8                	mov    %ebx,%eax
+  800cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd4:	5b                   	pop    %ebx
+  800cd5:	5e                   	pop    %esi
+  800cd6:	5f                   	pop    %edi
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800cd9:	83 ec 08             	sub    $0x8,%esp
+  800cdc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800cdf:	50                   	push   %eax
+  800ce0:	ff 36                	push   (%esi)
+  800ce2:	e8 40 ff ff ff       	call   800c27 <dev_lookup>
+  800ce7:	89 c3                	mov    %eax,%ebx
+  800ce9:	83 c4 10             	add    $0x10,%esp
+  800cec:	85 c0                	test   %eax,%eax
+  800cee:	78 1a                	js     800d0a <fd_close+0x70>
+		if (dev->dev_close)
+  800cf0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800cf3:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  800cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  800cfb:	85 c0                	test   %eax,%eax
+  800cfd:	74 0b                	je     800d0a <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  800cff:	83 ec 0c             	sub    $0xc,%esp
+  800d02:	56                   	push   %esi
+  800d03:	ff d0                	call   *%eax
+  800d05:	89 c3                	mov    %eax,%ebx
+  800d07:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  800d0a:	83 ec 08             	sub    $0x8,%esp
+  800d0d:	56                   	push   %esi
+  800d0e:	6a 00                	push   $0x0
+  800d10:	e8 6b fa ff ff       	call   800780 <sys_page_unmap>
+	return r;
+  800d15:	83 c4 10             	add    $0x10,%esp
+  800d18:	eb b5                	jmp    800ccf <fd_close+0x35>
+
+00800d1a <close>:
+
+int
+close(int fdnum)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800d20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d23:	50                   	push   %eax
+  800d24:	ff 75 08             	push   0x8(%ebp)
+  800d27:	e8 a9 fe ff ff       	call   800bd5 <fd_lookup>
+  800d2c:	83 c4 10             	add    $0x10,%esp
+  800d2f:	85 c0                	test   %eax,%eax
+  800d31:	79 02                	jns    800d35 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  800d33:	c9                   	leave
+  800d34:	c3                   	ret
+		return fd_close(fd, 1);
+  800d35:	83 ec 08             	sub    $0x8,%esp
+  800d38:	6a 01                	push   $0x1
+  800d3a:	ff 75 f4             	push   -0xc(%ebp)
+  800d3d:	e8 58 ff ff ff       	call   800c9a <fd_close>
+  800d42:	83 c4 10             	add    $0x10,%esp
+  800d45:	eb ec                	jmp    800d33 <close+0x19>
+
+00800d47 <close_all>:
+
+void
+close_all(void)
+{
+  800d47:	55                   	push   %ebp
+  800d48:	89 e5                	mov    %esp,%ebp
+  800d4a:	53                   	push   %ebx
+  800d4b:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  800d4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  800d56:	53                   	push   %ebx
+  800d57:	e8 be ff ff ff       	call   800d1a <close>
+	for (i = 0; i < MAXFD; i++)
+  800d5c:	83 c3 01             	add    $0x1,%ebx
+  800d5f:	83 c4 10             	add    $0x10,%esp
+  800d62:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  800d68:	75 e9                	jne    800d53 <close_all+0xc>
+}
+  800d6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+
+00800d6f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800d78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800d7b:	50                   	push   %eax
+  800d7c:	ff 75 08             	push   0x8(%ebp)
+  800d7f:	e8 51 fe ff ff       	call   800bd5 <fd_lookup>
+  800d84:	89 c3                	mov    %eax,%ebx
+  800d86:	83 c4 10             	add    $0x10,%esp
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	78 7f                	js     800e0c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  800d90:	ff 75 0c             	push   0xc(%ebp)
+  800d93:	e8 82 ff ff ff       	call   800d1a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  800d98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d9b:	c1 e6 0c             	shl    $0xc,%esi
+  800d9e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  800da4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800da7:	89 3c 24             	mov    %edi,(%esp)
+  800daa:	e8 bf fd ff ff       	call   800b6e <fd2data>
+  800daf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  800db1:	89 34 24             	mov    %esi,(%esp)
+  800db4:	e8 b5 fd ff ff       	call   800b6e <fd2data>
+  800db9:	83 c4 10             	add    $0x10,%esp
+  800dbc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  800dbf:	89 d8                	mov    %ebx,%eax
+  800dc1:	c1 e8 16             	shr    $0x16,%eax
+  800dc4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800dcb:	a8 01                	test   $0x1,%al
+  800dcd:	74 11                	je     800de0 <dup+0x71>
+  800dcf:	89 d8                	mov    %ebx,%eax
+  800dd1:	c1 e8 0c             	shr    $0xc,%eax
+  800dd4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800ddb:	f6 c2 01             	test   $0x1,%dl
+  800dde:	75 36                	jne    800e16 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800de0:	89 f8                	mov    %edi,%eax
+  800de2:	c1 e8 0c             	shr    $0xc,%eax
+  800de5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  800def:	25 07 0e 00 00       	and    $0xe07,%eax
+  800df4:	50                   	push   %eax
+  800df5:	56                   	push   %esi
+  800df6:	6a 00                	push   $0x0
+  800df8:	57                   	push   %edi
+  800df9:	6a 00                	push   $0x0
+  800dfb:	e8 3e f9 ff ff       	call   80073e <sys_page_map>
+  800e00:	89 c3                	mov    %eax,%ebx
+  800e02:	83 c4 20             	add    $0x20,%esp
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	78 33                	js     800e3c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  800e09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  800e0c:	89 d8                	mov    %ebx,%eax
+  800e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  800e16:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	25 07 0e 00 00       	and    $0xe07,%eax
+  800e25:	50                   	push   %eax
+  800e26:	ff 75 d4             	push   -0x2c(%ebp)
+  800e29:	6a 00                	push   $0x0
+  800e2b:	53                   	push   %ebx
+  800e2c:	6a 00                	push   $0x0
+  800e2e:	e8 0b f9 ff ff       	call   80073e <sys_page_map>
+  800e33:	89 c3                	mov    %eax,%ebx
+  800e35:	83 c4 20             	add    $0x20,%esp
+  800e38:	85 c0                	test   %eax,%eax
+  800e3a:	79 a4                	jns    800de0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  800e3c:	83 ec 08             	sub    $0x8,%esp
+  800e3f:	56                   	push   %esi
+  800e40:	6a 00                	push   $0x0
+  800e42:	e8 39 f9 ff ff       	call   800780 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  800e47:	83 c4 08             	add    $0x8,%esp
+  800e4a:	ff 75 d4             	push   -0x2c(%ebp)
+  800e4d:	6a 00                	push   $0x0
+  800e4f:	e8 2c f9 ff ff       	call   800780 <sys_page_unmap>
+	return r;
+  800e54:	83 c4 10             	add    $0x10,%esp
+  800e57:	eb b3                	jmp    800e0c <dup+0x9d>
+
+00800e59 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800e59:	55                   	push   %ebp
+  800e5a:	89 e5                	mov    %esp,%ebp
+  800e5c:	56                   	push   %esi
+  800e5d:	53                   	push   %ebx
+  800e5e:	83 ec 18             	sub    $0x18,%esp
+  800e61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e67:	50                   	push   %eax
+  800e68:	53                   	push   %ebx
+  800e69:	e8 67 fd ff ff       	call   800bd5 <fd_lookup>
+  800e6e:	83 c4 10             	add    $0x10,%esp
+  800e71:	85 c0                	test   %eax,%eax
+  800e73:	78 3c                	js     800eb1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e75:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e78:	83 ec 08             	sub    $0x8,%esp
+  800e7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e7e:	50                   	push   %eax
+  800e7f:	ff 36                	push   (%esi)
+  800e81:	e8 a1 fd ff ff       	call   800c27 <dev_lookup>
+  800e86:	83 c4 10             	add    $0x10,%esp
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	78 24                	js     800eb1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800e8d:	8b 46 08             	mov    0x8(%esi),%eax
+  800e90:	83 e0 03             	and    $0x3,%eax
+  800e93:	83 f8 01             	cmp    $0x1,%eax
+  800e96:	74 20                	je     800eb8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  800e98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e9b:	8b 40 08             	mov    0x8(%eax),%eax
+  800e9e:	85 c0                	test   %eax,%eax
+  800ea0:	74 54                	je     800ef6 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  800ea2:	83 ec 04             	sub    $0x4,%esp
+  800ea5:	ff 75 10             	push   0x10(%ebp)
+  800ea8:	ff 75 0c             	push   0xc(%ebp)
+  800eab:	56                   	push   %esi
+  800eac:	ff d0                	call   *%eax
+  800eae:	83 c4 10             	add    $0x10,%esp
+}
+  800eb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb4:	5b                   	pop    %ebx
+  800eb5:	5e                   	pop    %esi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+  800eb8:	89 e2                	mov    %esp,%edx
+  800eba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800ebf:	29 d0                	sub    %edx,%eax
+  800ec1:	89 c2                	mov    %eax,%edx
+  800ec3:	c1 ea 0f             	shr    $0xf,%edx
+  800ec6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed0:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ed3:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  800eda:	8b 40 48             	mov    0x48(%eax),%eax
+  800edd:	83 ec 04             	sub    $0x4,%esp
+  800ee0:	53                   	push   %ebx
+  800ee1:	50                   	push   %eax
+  800ee2:	68 f1 52 80 00       	push   $0x8052f1
+  800ee7:	e8 6f 2f 00 00       	call   803e5b <cprintf>
+		return -E_INVAL;
+  800eec:	83 c4 10             	add    $0x10,%esp
+  800eef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ef4:	eb bb                	jmp    800eb1 <read+0x58>
+		return -E_NOT_SUPP;
+  800ef6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800efb:	eb b4                	jmp    800eb1 <read+0x58>
+
+00800efd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800efd:	55                   	push   %ebp
+  800efe:	89 e5                	mov    %esp,%ebp
+  800f00:	57                   	push   %edi
+  800f01:	56                   	push   %esi
+  800f02:	53                   	push   %ebx
+  800f03:	83 ec 0c             	sub    $0xc,%esp
+  800f06:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800f09:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  800f0c:	85 f6                	test   %esi,%esi
+  800f0e:	74 30                	je     800f40 <readn+0x43>
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  800f1a:	83 ec 04             	sub    $0x4,%esp
+  800f1d:	89 f2                	mov    %esi,%edx
+  800f1f:	29 c2                	sub    %eax,%edx
+  800f21:	52                   	push   %edx
+  800f22:	01 f8                	add    %edi,%eax
+  800f24:	50                   	push   %eax
+  800f25:	ff 75 08             	push   0x8(%ebp)
+  800f28:	e8 2c ff ff ff       	call   800e59 <read>
+		if (m < 0)
+  800f2d:	83 c4 10             	add    $0x10,%esp
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	78 15                	js     800f49 <readn+0x4c>
+			return m;
+		if (m == 0)
+  800f34:	74 11                	je     800f47 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  800f36:	01 c3                	add    %eax,%ebx
+  800f38:	89 d8                	mov    %ebx,%eax
+  800f3a:	39 f3                	cmp    %esi,%ebx
+  800f3c:	72 dc                	jb     800f1a <readn+0x1d>
+  800f3e:	eb 09                	jmp    800f49 <readn+0x4c>
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f45:	eb 02                	jmp    800f49 <readn+0x4c>
+  800f47:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  800f49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4c:	5b                   	pop    %ebx
+  800f4d:	5e                   	pop    %esi
+  800f4e:	5f                   	pop    %edi
+  800f4f:	5d                   	pop    %ebp
+  800f50:	c3                   	ret
+
+00800f51 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800f51:	55                   	push   %ebp
+  800f52:	89 e5                	mov    %esp,%ebp
+  800f54:	56                   	push   %esi
+  800f55:	53                   	push   %ebx
+  800f56:	83 ec 18             	sub    $0x18,%esp
+  800f59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  800f5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f5f:	50                   	push   %eax
+  800f60:	53                   	push   %ebx
+  800f61:	e8 6f fc ff ff       	call   800bd5 <fd_lookup>
+  800f66:	83 c4 10             	add    $0x10,%esp
+  800f69:	85 c0                	test   %eax,%eax
+  800f6b:	78 37                	js     800fa4 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f6d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f70:	83 ec 08             	sub    $0x8,%esp
+  800f73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f76:	50                   	push   %eax
+  800f77:	ff 36                	push   (%esi)
+  800f79:	e8 a9 fc ff ff       	call   800c27 <dev_lookup>
+  800f7e:	83 c4 10             	add    $0x10,%esp
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	78 1f                	js     800fa4 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f85:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800f89:	74 20                	je     800fab <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  800f8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800f91:	85 c0                	test   %eax,%eax
+  800f93:	74 54                	je     800fe9 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  800f95:	83 ec 04             	sub    $0x4,%esp
+  800f98:	ff 75 10             	push   0x10(%ebp)
+  800f9b:	ff 75 0c             	push   0xc(%ebp)
+  800f9e:	56                   	push   %esi
+  800f9f:	ff d0                	call   *%eax
+  800fa1:	83 c4 10             	add    $0x10,%esp
+}
+  800fa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5d                   	pop    %ebp
+  800faa:	c3                   	ret
+  800fab:	89 e2                	mov    %esp,%edx
+  800fad:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800fb2:	29 d0                	sub    %edx,%eax
+  800fb4:	89 c2                	mov    %eax,%edx
+  800fb6:	c1 ea 0f             	shr    $0xf,%edx
+  800fb9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc3:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800fc6:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  800fcd:	8b 40 48             	mov    0x48(%eax),%eax
+  800fd0:	83 ec 04             	sub    $0x4,%esp
+  800fd3:	53                   	push   %ebx
+  800fd4:	50                   	push   %eax
+  800fd5:	68 0d 53 80 00       	push   $0x80530d
+  800fda:	e8 7c 2e 00 00       	call   803e5b <cprintf>
+		return -E_INVAL;
+  800fdf:	83 c4 10             	add    $0x10,%esp
+  800fe2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fe7:	eb bb                	jmp    800fa4 <write+0x53>
+		return -E_NOT_SUPP;
+  800fe9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800fee:	eb b4                	jmp    800fa4 <write+0x53>
+
+00800ff0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ff0:	55                   	push   %ebp
+  800ff1:	89 e5                	mov    %esp,%ebp
+  800ff3:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ff6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ff9:	50                   	push   %eax
+  800ffa:	ff 75 08             	push   0x8(%ebp)
+  800ffd:	e8 d3 fb ff ff       	call   800bd5 <fd_lookup>
+  801002:	83 c4 10             	add    $0x10,%esp
+  801005:	85 c0                	test   %eax,%eax
+  801007:	78 0e                	js     801017 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801009:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80100c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80100f:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801012:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801017:	c9                   	leave
+  801018:	c3                   	ret
+
+00801019 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	53                   	push   %ebx
+  80101d:	83 ec 1c             	sub    $0x1c,%esp
+  801020:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801023:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801026:	50                   	push   %eax
+  801027:	ff 75 08             	push   0x8(%ebp)
+  80102a:	e8 a6 fb ff ff       	call   800bd5 <fd_lookup>
+  80102f:	83 c4 10             	add    $0x10,%esp
+  801032:	85 c0                	test   %eax,%eax
+  801034:	78 33                	js     801069 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801036:	83 fb 03             	cmp    $0x3,%ebx
+  801039:	74 28                	je     801063 <fcntl+0x4a>
+  80103b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801040:	83 fb 04             	cmp    $0x4,%ebx
+  801043:	75 24                	jne    801069 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801045:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801048:	8b 41 08             	mov    0x8(%ecx),%eax
+  80104b:	80 e4 ef             	and    $0xef,%ah
+  80104e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801051:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801057:	09 d0                	or     %edx,%eax
+  801059:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80105c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801061:	eb 06                	jmp    801069 <fcntl+0x50>
+		return fd->fd_omode;
+  801063:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801066:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801069:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80106c:	c9                   	leave
+  80106d:	c3                   	ret
+
+0080106e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	56                   	push   %esi
+  801072:	53                   	push   %ebx
+  801073:	83 ec 18             	sub    $0x18,%esp
+  801076:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801079:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80107c:	50                   	push   %eax
+  80107d:	53                   	push   %ebx
+  80107e:	e8 52 fb ff ff       	call   800bd5 <fd_lookup>
+  801083:	83 c4 10             	add    $0x10,%esp
+  801086:	85 c0                	test   %eax,%eax
+  801088:	78 34                	js     8010be <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80108a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80108d:	83 ec 08             	sub    $0x8,%esp
+  801090:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801093:	50                   	push   %eax
+  801094:	ff 36                	push   (%esi)
+  801096:	e8 8c fb ff ff       	call   800c27 <dev_lookup>
+  80109b:	83 c4 10             	add    $0x10,%esp
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	78 1c                	js     8010be <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8010a2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8010a6:	74 1d                	je     8010c5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8010a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010ab:	8b 40 18             	mov    0x18(%eax),%eax
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	74 51                	je     801103 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8010b2:	83 ec 08             	sub    $0x8,%esp
+  8010b5:	ff 75 0c             	push   0xc(%ebp)
+  8010b8:	56                   	push   %esi
+  8010b9:	ff d0                	call   *%eax
+  8010bb:	83 c4 10             	add    $0x10,%esp
+}
+  8010be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+  8010c5:	89 e2                	mov    %esp,%edx
+  8010c7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8010cc:	29 d0                	sub    %edx,%eax
+  8010ce:	89 c2                	mov    %eax,%edx
+  8010d0:	c1 ea 0f             	shr    $0xf,%edx
+  8010d3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8010d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010dd:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8010e0:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  8010e7:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8010ea:	83 ec 04             	sub    $0x4,%esp
+  8010ed:	53                   	push   %ebx
+  8010ee:	50                   	push   %eax
+  8010ef:	68 d0 52 80 00       	push   $0x8052d0
+  8010f4:	e8 62 2d 00 00       	call   803e5b <cprintf>
+		return -E_INVAL;
+  8010f9:	83 c4 10             	add    $0x10,%esp
+  8010fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801101:	eb bb                	jmp    8010be <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801103:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801108:	eb b4                	jmp    8010be <ftruncate+0x50>
+
+0080110a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80110a:	55                   	push   %ebp
+  80110b:	89 e5                	mov    %esp,%ebp
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 18             	sub    $0x18,%esp
+  801112:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801115:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801118:	50                   	push   %eax
+  801119:	ff 75 08             	push   0x8(%ebp)
+  80111c:	e8 b4 fa ff ff       	call   800bd5 <fd_lookup>
+  801121:	83 c4 10             	add    $0x10,%esp
+  801124:	85 c0                	test   %eax,%eax
+  801126:	78 53                	js     80117b <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801128:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80112b:	83 ec 08             	sub    $0x8,%esp
+  80112e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801131:	50                   	push   %eax
+  801132:	ff 36                	push   (%esi)
+  801134:	e8 ee fa ff ff       	call   800c27 <dev_lookup>
+  801139:	83 c4 10             	add    $0x10,%esp
+  80113c:	85 c0                	test   %eax,%eax
+  80113e:	78 3b                	js     80117b <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  801140:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801143:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801147:	74 39                	je     801182 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801149:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80114c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801153:	00 00 00 
+	stat->st_isdir = 0;
+  801156:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80115d:	00 00 00 
+	stat->st_version = 0;
+  801160:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801167:	00 00 00 
+	stat->st_dev = dev;
+  80116a:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801170:	83 ec 08             	sub    $0x8,%esp
+  801173:	53                   	push   %ebx
+  801174:	56                   	push   %esi
+  801175:	ff 50 14             	call   *0x14(%eax)
+  801178:	83 c4 10             	add    $0x10,%esp
+}
+  80117b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80117e:	5b                   	pop    %ebx
+  80117f:	5e                   	pop    %esi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+		return -E_NOT_SUPP;
+  801182:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801187:	eb f2                	jmp    80117b <fstat+0x71>
+
+00801189 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80118e:	83 ec 08             	sub    $0x8,%esp
+  801191:	6a 00                	push   $0x0
+  801193:	ff 75 08             	push   0x8(%ebp)
+  801196:	e8 b7 01 00 00       	call   801352 <open>
+  80119b:	89 c3                	mov    %eax,%ebx
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	85 c0                	test   %eax,%eax
+  8011a2:	78 1b                	js     8011bf <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8011a4:	83 ec 08             	sub    $0x8,%esp
+  8011a7:	ff 75 0c             	push   0xc(%ebp)
+  8011aa:	50                   	push   %eax
+  8011ab:	e8 5a ff ff ff       	call   80110a <fstat>
+  8011b0:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8011b2:	89 1c 24             	mov    %ebx,(%esp)
+  8011b5:	e8 60 fb ff ff       	call   800d1a <close>
+	return r;
+  8011ba:	83 c4 10             	add    $0x10,%esp
+  8011bd:	89 f3                	mov    %esi,%ebx
+}
+  8011bf:	89 d8                	mov    %ebx,%eax
+  8011c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	c3                   	ret
+
+008011c8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	56                   	push   %esi
+  8011cc:	53                   	push   %ebx
+  8011cd:	89 c6                	mov    %eax,%esi
+  8011cf:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8011d1:	83 3d 00 74 80 00 00 	cmpl   $0x0,0x807400
+  8011d8:	74 27                	je     801201 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8011da:	6a 07                	push   $0x7
+  8011dc:	68 00 90 80 00       	push   $0x809000
+  8011e1:	56                   	push   %esi
+  8011e2:	ff 35 00 74 80 00    	push   0x807400
+  8011e8:	e8 25 3d 00 00       	call   804f12 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8011ed:	83 c4 0c             	add    $0xc,%esp
+  8011f0:	6a 00                	push   $0x0
+  8011f2:	53                   	push   %ebx
+  8011f3:	6a 00                	push   $0x0
+  8011f5:	e8 88 3a 00 00       	call   804c82 <ipc_recv>
+}
+  8011fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	6a 02                	push   $0x2
+  801206:	e8 70 3d 00 00       	call   804f7b <ipc_find_env>
+  80120b:	a3 00 74 80 00       	mov    %eax,0x807400
+  801210:	83 c4 10             	add    $0x10,%esp
+  801213:	eb c5                	jmp    8011da <fsipc+0x12>
+
+00801215 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80121b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801221:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  801226:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801229:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80122e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801233:	b8 02 00 00 00       	mov    $0x2,%eax
+  801238:	e8 8b ff ff ff       	call   8011c8 <fsipc>
+}
+  80123d:	c9                   	leave
+  80123e:	c3                   	ret
+
+0080123f <devfile_flush>:
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801245:	8b 45 08             	mov    0x8(%ebp),%eax
+  801248:	8b 40 0c             	mov    0xc(%eax),%eax
+  80124b:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801250:	ba 00 00 00 00       	mov    $0x0,%edx
+  801255:	b8 06 00 00 00       	mov    $0x6,%eax
+  80125a:	e8 69 ff ff ff       	call   8011c8 <fsipc>
+}
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+00801261 <devfile_stat>:
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	53                   	push   %ebx
+  801265:	83 ec 04             	sub    $0x4,%esp
+  801268:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80126b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80126e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801271:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80127b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801280:	e8 43 ff ff ff       	call   8011c8 <fsipc>
+  801285:	85 c0                	test   %eax,%eax
+  801287:	78 37                	js     8012c0 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801289:	83 ec 08             	sub    $0x8,%esp
+  80128c:	68 00 90 80 00       	push   $0x809000
+  801291:	53                   	push   %ebx
+  801292:	e8 30 f0 ff ff       	call   8002c7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801297:	a1 80 90 80 00       	mov    0x809080,%eax
+  80129c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8012a2:	a1 84 90 80 00       	mov    0x809084,%eax
+  8012a7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8012ad:	a1 88 90 80 00       	mov    0x809088,%eax
+  8012b2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8012b8:	83 c4 10             	add    $0x10,%esp
+  8012bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c3:	c9                   	leave
+  8012c4:	c3                   	ret
+
+008012c5 <devfile_write>:
+{
+  8012c5:	55                   	push   %ebp
+  8012c6:	89 e5                	mov    %esp,%ebp
+  8012c8:	83 ec 0c             	sub    $0xc,%esp
+  8012cb:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8012ce:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8012d3:	39 d0                	cmp    %edx,%eax
+  8012d5:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 52 0c             	mov    0xc(%edx),%edx
+  8012de:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  8012e4:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8012e9:	50                   	push   %eax
+  8012ea:	ff 75 0c             	push   0xc(%ebp)
+  8012ed:	68 08 90 80 00       	push   $0x809008
+  8012f2:	e8 80 f1 ff ff       	call   800477 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8012f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801301:	e8 c2 fe ff ff       	call   8011c8 <fsipc>
+}
+  801306:	c9                   	leave
+  801307:	c3                   	ret
+
+00801308 <devfile_read>:
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	53                   	push   %ebx
+  80130c:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80130f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801312:	8b 40 0c             	mov    0xc(%eax),%eax
+  801315:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  80131a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80131d:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801322:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801327:	b8 03 00 00 00       	mov    $0x3,%eax
+  80132c:	e8 97 fe ff ff       	call   8011c8 <fsipc>
+  801331:	89 c3                	mov    %eax,%ebx
+  801333:	85 c0                	test   %eax,%eax
+  801335:	78 14                	js     80134b <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801337:	83 ec 04             	sub    $0x4,%esp
+  80133a:	50                   	push   %eax
+  80133b:	68 00 90 80 00       	push   $0x809000
+  801340:	ff 75 0c             	push   0xc(%ebp)
+  801343:	e8 2f f1 ff ff       	call   800477 <memmove>
+	return r;
+  801348:	83 c4 10             	add    $0x10,%esp
+}
+  80134b:	89 d8                	mov    %ebx,%eax
+  80134d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801350:	c9                   	leave
+  801351:	c3                   	ret
+
+00801352 <open>:
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	53                   	push   %ebx
+  801356:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801359:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80135c:	50                   	push   %eax
+  80135d:	e8 23 f8 ff ff       	call   800b85 <fd_alloc>
+  801362:	89 c3                	mov    %eax,%ebx
+  801364:	83 c4 10             	add    $0x10,%esp
+  801367:	85 c0                	test   %eax,%eax
+  801369:	78 2a                	js     801395 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80136b:	83 ec 0c             	sub    $0xc,%esp
+  80136e:	ff 75 08             	push   0x8(%ebp)
+  801371:	e8 05 ef ff ff       	call   80027b <strlen>
+  801376:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801379:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80137e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801383:	7e 17                	jle    80139c <open+0x4a>
+	fd_close(fd, 1);
+  801385:	83 ec 08             	sub    $0x8,%esp
+  801388:	6a 01                	push   $0x1
+  80138a:	ff 75 f4             	push   -0xc(%ebp)
+  80138d:	e8 08 f9 ff ff       	call   800c9a <fd_close>
+	return r;
+  801392:	83 c4 10             	add    $0x10,%esp
+}
+  801395:	89 d8                	mov    %ebx,%eax
+  801397:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80139a:	c9                   	leave
+  80139b:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80139c:	83 ec 08             	sub    $0x8,%esp
+  80139f:	ff 75 08             	push   0x8(%ebp)
+  8013a2:	68 00 90 80 00       	push   $0x809000
+  8013a7:	e8 1b ef ff ff       	call   8002c7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8013ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013af:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8013b4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8013b7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8013bc:	e8 07 fe ff ff       	call   8011c8 <fsipc>
+  8013c1:	89 c3                	mov    %eax,%ebx
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	85 c0                	test   %eax,%eax
+  8013c8:	78 bb                	js     801385 <open+0x33>
+	return fd2num(fd); 	
+  8013ca:	83 ec 0c             	sub    $0xc,%esp
+  8013cd:	ff 75 f4             	push   -0xc(%ebp)
+  8013d0:	e8 89 f7 ff ff       	call   800b5e <fd2num>
+  8013d5:	89 c3                	mov    %eax,%ebx
+  8013d7:	83 c4 10             	add    $0x10,%esp
+  8013da:	eb b9                	jmp    801395 <open+0x43>
+
+008013dc <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8013dc:	55                   	push   %ebp
+  8013dd:	89 e5                	mov    %esp,%ebp
+  8013df:	53                   	push   %ebx
+  8013e0:	83 ec 1c             	sub    $0x1c,%esp
+  8013e3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e9:	50                   	push   %eax
+  8013ea:	ff 75 08             	push   0x8(%ebp)
+  8013ed:	e8 e3 f7 ff ff       	call   800bd5 <fd_lookup>
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	85 c0                	test   %eax,%eax
+  8013f7:	78 5a                	js     801453 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8013f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013fc:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  801402:	39 10                	cmp    %edx,(%eax)
+  801404:	75 66                	jne    80146c <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801406:	83 3d 00 74 80 00 00 	cmpl   $0x0,0x807400
+  80140d:	74 49                	je     801458 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80140f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801412:	8b 40 0c             	mov    0xc(%eax),%eax
+  801415:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  80141a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80141d:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  801422:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801428:	6a 07                	push   $0x7
+  80142a:	68 00 90 80 00       	push   $0x809000
+  80142f:	6a 09                	push   $0x9
+  801431:	ff 35 00 74 80 00    	push   0x807400
+  801437:	e8 d6 3a 00 00       	call   804f12 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80143c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801443:	6a 00                	push   $0x0
+  801445:	53                   	push   %ebx
+  801446:	ff 75 10             	push   0x10(%ebp)
+  801449:	6a 00                	push   $0x0
+  80144b:	e8 ff 38 00 00       	call   804d4f <ipc_recv_pages>
+  801450:	83 c4 20             	add    $0x20,%esp
+}
+  801453:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801456:	c9                   	leave
+  801457:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801458:	83 ec 0c             	sub    $0xc,%esp
+  80145b:	6a 02                	push   $0x2
+  80145d:	e8 19 3b 00 00       	call   804f7b <ipc_find_env>
+  801462:	a3 00 74 80 00       	mov    %eax,0x807400
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	eb a3                	jmp    80140f <fmap+0x33>
+		return -E_INVAL;
+  80146c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801471:	eb e0                	jmp    801453 <fmap+0x77>
+
+00801473 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801473:	55                   	push   %ebp
+  801474:	89 e5                	mov    %esp,%ebp
+  801476:	53                   	push   %ebx
+  801477:	83 ec 10             	sub    $0x10,%esp
+  80147a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80147d:	53                   	push   %ebx
+  80147e:	e8 f8 ed ff ff       	call   80027b <strlen>
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80148b:	7f 25                	jg     8014b2 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80148d:	83 ec 08             	sub    $0x8,%esp
+  801490:	53                   	push   %ebx
+  801491:	68 00 90 80 00       	push   $0x809000
+  801496:	e8 2c ee ff ff       	call   8002c7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80149b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014a5:	e8 1e fd ff ff       	call   8011c8 <fsipc>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+}
+  8014ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b0:	c9                   	leave
+  8014b1:	c3                   	ret
+		return -E_BAD_PATH;
+  8014b2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8014b7:	eb f4                	jmp    8014ad <remove+0x3a>
+
+008014b9 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8014b9:	55                   	push   %ebp
+  8014ba:	89 e5                	mov    %esp,%ebp
+  8014bc:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8014bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014c9:	e8 fa fc ff ff       	call   8011c8 <fsipc>
+}
+  8014ce:	c9                   	leave
+  8014cf:	c3                   	ret
+
+008014d0 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  8014d0:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8014d4:	7f 01                	jg     8014d7 <writebuf+0x7>
+  8014d6:	c3                   	ret
+{
+  8014d7:	55                   	push   %ebp
+  8014d8:	89 e5                	mov    %esp,%ebp
+  8014da:	53                   	push   %ebx
+  8014db:	83 ec 08             	sub    $0x8,%esp
+  8014de:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  8014e0:	ff 70 04             	push   0x4(%eax)
+  8014e3:	8d 40 10             	lea    0x10(%eax),%eax
+  8014e6:	50                   	push   %eax
+  8014e7:	ff 33                	push   (%ebx)
+  8014e9:	e8 63 fa ff ff       	call   800f51 <write>
+		if (result > 0)
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	7e 03                	jle    8014f8 <writebuf+0x28>
+			b->result += result;
+  8014f5:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  8014f8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8014fb:	74 0d                	je     80150a <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801504:	0f 4f c2             	cmovg  %edx,%eax
+  801507:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  80150a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80150d:	c9                   	leave
+  80150e:	c3                   	ret
+
+0080150f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80150f:	55                   	push   %ebp
+  801510:	89 e5                	mov    %esp,%ebp
+  801512:	53                   	push   %ebx
+  801513:	83 ec 04             	sub    $0x4,%esp
+  801516:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801519:	8b 53 04             	mov    0x4(%ebx),%edx
+  80151c:	8d 42 01             	lea    0x1(%edx),%eax
+  80151f:	89 43 04             	mov    %eax,0x4(%ebx)
+  801522:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801525:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801529:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80152e:	74 05                	je     801535 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801530:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+		writebuf(b);
+  801535:	89 d8                	mov    %ebx,%eax
+  801537:	e8 94 ff ff ff       	call   8014d0 <writebuf>
+		b->idx = 0;
+  80153c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801543:	eb eb                	jmp    801530 <putch+0x21>
+
+00801545 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  80154e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801551:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801557:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80155e:	00 00 00 
+	b.result = 0;
+  801561:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801568:	00 00 00 
+	b.error = 1;
+  80156b:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801572:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801575:	ff 75 10             	push   0x10(%ebp)
+  801578:	ff 75 0c             	push   0xc(%ebp)
+  80157b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801581:	50                   	push   %eax
+  801582:	68 0f 15 80 00       	push   $0x80150f
+  801587:	e8 ce 29 00 00       	call   803f5a <vprintfmt>
+	if (b.idx > 0)
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801596:	7f 12                	jg     8015aa <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801598:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	75 06                	jne    8015a8 <vfprintf+0x63>
+  8015a2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  8015a8:	c9                   	leave
+  8015a9:	c3                   	ret
+		writebuf(&b);
+  8015aa:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8015b0:	e8 1b ff ff ff       	call   8014d0 <writebuf>
+  8015b5:	eb e1                	jmp    801598 <vfprintf+0x53>
+
+008015b7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8015bd:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  8015c0:	50                   	push   %eax
+  8015c1:	ff 75 0c             	push   0xc(%ebp)
+  8015c4:	ff 75 08             	push   0x8(%ebp)
+  8015c7:	e8 79 ff ff ff       	call   801545 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8015cc:	c9                   	leave
+  8015cd:	c3                   	ret
+
+008015ce <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8015ce:	55                   	push   %ebp
+  8015cf:	89 e5                	mov    %esp,%ebp
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8015d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  8015d7:	50                   	push   %eax
+  8015d8:	ff 75 08             	push   0x8(%ebp)
+  8015db:	6a 01                	push   $0x1
+  8015dd:	e8 63 ff ff ff       	call   801545 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8015e2:	c9                   	leave
+  8015e3:	c3                   	ret
+
+008015e4 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8015ea:	68 40 53 80 00       	push   $0x805340
+  8015ef:	ff 75 0c             	push   0xc(%ebp)
+  8015f2:	e8 d0 ec ff ff       	call   8002c7 <strcpy>
+	return 0;
+}
+  8015f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fc:	c9                   	leave
+  8015fd:	c3                   	ret
+
+008015fe <devsock_close>:
+{
+  8015fe:	55                   	push   %ebp
+  8015ff:	89 e5                	mov    %esp,%ebp
+  801601:	53                   	push   %ebx
+  801602:	83 ec 10             	sub    $0x10,%esp
+  801605:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801608:	53                   	push   %ebx
+  801609:	e8 ac 39 00 00       	call   804fba <pageref>
+  80160e:	89 c2                	mov    %eax,%edx
+  801610:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801613:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801618:	83 fa 01             	cmp    $0x1,%edx
+  80161b:	74 05                	je     801622 <devsock_close+0x24>
+}
+  80161d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801620:	c9                   	leave
+  801621:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801622:	83 ec 0c             	sub    $0xc,%esp
+  801625:	ff 73 0c             	push   0xc(%ebx)
+  801628:	e8 b0 05 00 00       	call   801bdd <nsipc_close>
+  80162d:	83 c4 10             	add    $0x10,%esp
+  801630:	eb eb                	jmp    80161d <devsock_close+0x1f>
+
+00801632 <devsock_write>:
+{
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	53                   	push   %ebx
+  801636:	83 ec 14             	sub    $0x14,%esp
+  801639:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80163c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80163f:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801642:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801645:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801648:	8b 41 08             	mov    0x8(%ecx),%eax
+  80164b:	c1 f8 09             	sar    $0x9,%eax
+  80164e:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801651:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801657:	77 13                	ja     80166c <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801659:	50                   	push   %eax
+  80165a:	52                   	push   %edx
+  80165b:	53                   	push   %ebx
+  80165c:	ff 71 0c             	push   0xc(%ecx)
+  80165f:	e8 5c 06 00 00       	call   801cc0 <nsipc_send>
+  801664:	83 c4 10             	add    $0x10,%esp
+}
+  801667:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80166a:	c9                   	leave
+  80166b:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80166c:	50                   	push   %eax
+  80166d:	6a 01                	push   $0x1
+  80166f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801672:	50                   	push   %eax
+  801673:	ff 71 0c             	push   0xc(%ecx)
+  801676:	e8 a6 06 00 00       	call   801d21 <nsipc_sendmsg>
+  80167b:	83 c4 10             	add    $0x10,%esp
+  80167e:	eb e7                	jmp    801667 <devsock_write+0x35>
+
+00801680 <devsock_read>:
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	53                   	push   %ebx
+  801684:	83 ec 14             	sub    $0x14,%esp
+  801687:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80168a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80168d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801690:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801693:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801696:	8b 41 08             	mov    0x8(%ecx),%eax
+  801699:	c1 f8 09             	sar    $0x9,%eax
+  80169c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80169f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8016a5:	77 13                	ja     8016ba <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8016a7:	50                   	push   %eax
+  8016a8:	52                   	push   %edx
+  8016a9:	53                   	push   %ebx
+  8016aa:	ff 71 0c             	push   0xc(%ecx)
+  8016ad:	e8 9c 05 00 00       	call   801c4e <nsipc_recv>
+  8016b2:	83 c4 10             	add    $0x10,%esp
+}
+  8016b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016b8:	c9                   	leave
+  8016b9:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8016ba:	50                   	push   %eax
+  8016bb:	6a 01                	push   $0x1
+  8016bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016c0:	50                   	push   %eax
+  8016c1:	ff 71 0c             	push   0xc(%ecx)
+  8016c4:	e8 02 0a 00 00       	call   8020cb <nsipc_recvmsg>
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	eb e7                	jmp    8016b5 <devsock_read+0x35>
+
+008016ce <fd2sockid>:
+{
+  8016ce:	55                   	push   %ebp
+  8016cf:	89 e5                	mov    %esp,%ebp
+  8016d1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8016d4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8016d7:	52                   	push   %edx
+  8016d8:	50                   	push   %eax
+  8016d9:	e8 f7 f4 ff ff       	call   800bd5 <fd_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 10                	js     8016f5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8016e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e8:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  8016ee:	39 08                	cmp    %ecx,(%eax)
+  8016f0:	75 05                	jne    8016f7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8016f2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8016f5:	c9                   	leave
+  8016f6:	c3                   	ret
+		return -E_NOT_SUPP;
+  8016f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016fc:	eb f7                	jmp    8016f5 <fd2sockid+0x27>
+
+008016fe <sock_flags>:
+{
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801704:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801707:	52                   	push   %edx
+  801708:	50                   	push   %eax
+  801709:	e8 c7 f4 ff ff       	call   800bd5 <fd_lookup>
+  80170e:	83 c4 10             	add    $0x10,%esp
+  801711:	85 c0                	test   %eax,%eax
+  801713:	78 0e                	js     801723 <sock_flags+0x25>
+  801715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801718:	8b 40 08             	mov    0x8(%eax),%eax
+  80171b:	c1 e8 09             	shr    $0x9,%eax
+  80171e:	83 e0 08             	and    $0x8,%eax
+}
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+		return 0;
+  801723:	b8 00 00 00 00       	mov    $0x0,%eax
+  801728:	eb f7                	jmp    801721 <sock_flags+0x23>
+
+0080172a <alloc_sockfd>:
+{
+  80172a:	55                   	push   %ebp
+  80172b:	89 e5                	mov    %esp,%ebp
+  80172d:	56                   	push   %esi
+  80172e:	53                   	push   %ebx
+  80172f:	83 ec 1c             	sub    $0x1c,%esp
+  801732:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801734:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801737:	50                   	push   %eax
+  801738:	e8 48 f4 ff ff       	call   800b85 <fd_alloc>
+  80173d:	89 c3                	mov    %eax,%ebx
+  80173f:	83 c4 10             	add    $0x10,%esp
+  801742:	85 c0                	test   %eax,%eax
+  801744:	78 43                	js     801789 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801746:	83 ec 04             	sub    $0x4,%esp
+  801749:	68 07 04 00 00       	push   $0x407
+  80174e:	ff 75 f4             	push   -0xc(%ebp)
+  801751:	6a 00                	push   $0x0
+  801753:	e8 a3 ef ff ff       	call   8006fb <sys_page_alloc>
+  801758:	89 c3                	mov    %eax,%ebx
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	85 c0                	test   %eax,%eax
+  80175f:	78 28                	js     801789 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801764:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  80176a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80176c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80176f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801776:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801779:	83 ec 0c             	sub    $0xc,%esp
+  80177c:	50                   	push   %eax
+  80177d:	e8 dc f3 ff ff       	call   800b5e <fd2num>
+  801782:	89 c3                	mov    %eax,%ebx
+  801784:	83 c4 10             	add    $0x10,%esp
+  801787:	eb 0c                	jmp    801795 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801789:	83 ec 0c             	sub    $0xc,%esp
+  80178c:	56                   	push   %esi
+  80178d:	e8 4b 04 00 00       	call   801bdd <nsipc_close>
+		return r;
+  801792:	83 c4 10             	add    $0x10,%esp
+}
+  801795:	89 d8                	mov    %ebx,%eax
+  801797:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80179a:	5b                   	pop    %ebx
+  80179b:	5e                   	pop    %esi
+  80179c:	5d                   	pop    %ebp
+  80179d:	c3                   	ret
+
+0080179e <accept>:
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	56                   	push   %esi
+  8017a2:	53                   	push   %ebx
+  8017a3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8017a6:	89 f0                	mov    %esi,%eax
+  8017a8:	e8 21 ff ff ff       	call   8016ce <fd2sockid>
+  8017ad:	89 c3                	mov    %eax,%ebx
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 24                	js     8017d7 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8017b3:	89 f0                	mov    %esi,%eax
+  8017b5:	e8 44 ff ff ff       	call   8016fe <sock_flags>
+  8017ba:	50                   	push   %eax
+  8017bb:	ff 75 10             	push   0x10(%ebp)
+  8017be:	ff 75 0c             	push   0xc(%ebp)
+  8017c1:	53                   	push   %ebx
+  8017c2:	e8 6b 03 00 00       	call   801b32 <nsipc_accept>
+  8017c7:	89 c3                	mov    %eax,%ebx
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 07                	js     8017d7 <accept+0x39>
+	return alloc_sockfd(r);
+  8017d0:	e8 55 ff ff ff       	call   80172a <alloc_sockfd>
+  8017d5:	89 c3                	mov    %eax,%ebx
+}
+  8017d7:	89 d8                	mov    %ebx,%eax
+  8017d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017dc:	5b                   	pop    %ebx
+  8017dd:	5e                   	pop    %esi
+  8017de:	5d                   	pop    %ebp
+  8017df:	c3                   	ret
+
+008017e0 <bind>:
+{
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8017e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e9:	e8 e0 fe ff ff       	call   8016ce <fd2sockid>
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 12                	js     801804 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8017f2:	83 ec 04             	sub    $0x4,%esp
+  8017f5:	ff 75 10             	push   0x10(%ebp)
+  8017f8:	ff 75 0c             	push   0xc(%ebp)
+  8017fb:	50                   	push   %eax
+  8017fc:	e8 85 03 00 00       	call   801b86 <nsipc_bind>
+  801801:	83 c4 10             	add    $0x10,%esp
+}
+  801804:	c9                   	leave
+  801805:	c3                   	ret
+
+00801806 <shutdown>:
+{
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80180c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180f:	e8 ba fe ff ff       	call   8016ce <fd2sockid>
+  801814:	85 c0                	test   %eax,%eax
+  801816:	78 0f                	js     801827 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801818:	83 ec 08             	sub    $0x8,%esp
+  80181b:	ff 75 0c             	push   0xc(%ebp)
+  80181e:	50                   	push   %eax
+  80181f:	e8 97 03 00 00       	call   801bbb <nsipc_shutdown>
+  801824:	83 c4 10             	add    $0x10,%esp
+}
+  801827:	c9                   	leave
+  801828:	c3                   	ret
+
+00801829 <connect>:
+{
+  801829:	55                   	push   %ebp
+  80182a:	89 e5                	mov    %esp,%ebp
+  80182c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80182f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801832:	e8 97 fe ff ff       	call   8016ce <fd2sockid>
+  801837:	85 c0                	test   %eax,%eax
+  801839:	78 12                	js     80184d <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80183b:	83 ec 04             	sub    $0x4,%esp
+  80183e:	ff 75 10             	push   0x10(%ebp)
+  801841:	ff 75 0c             	push   0xc(%ebp)
+  801844:	50                   	push   %eax
+  801845:	e8 ad 03 00 00       	call   801bf7 <nsipc_connect>
+  80184a:	83 c4 10             	add    $0x10,%esp
+}
+  80184d:	c9                   	leave
+  80184e:	c3                   	ret
+
+0080184f <listen>:
+{
+  80184f:	55                   	push   %ebp
+  801850:	89 e5                	mov    %esp,%ebp
+  801852:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801855:	8b 45 08             	mov    0x8(%ebp),%eax
+  801858:	e8 71 fe ff ff       	call   8016ce <fd2sockid>
+  80185d:	85 c0                	test   %eax,%eax
+  80185f:	78 0f                	js     801870 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801861:	83 ec 08             	sub    $0x8,%esp
+  801864:	ff 75 0c             	push   0xc(%ebp)
+  801867:	50                   	push   %eax
+  801868:	e8 bf 03 00 00       	call   801c2c <nsipc_listen>
+  80186d:	83 c4 10             	add    $0x10,%esp
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+
+00801872 <sendmsg>:
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	57                   	push   %edi
+  801876:	56                   	push   %esi
+  801877:	53                   	push   %ebx
+  801878:	83 ec 0c             	sub    $0xc,%esp
+  80187b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80187e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801881:	89 f0                	mov    %esi,%eax
+  801883:	e8 46 fe ff ff       	call   8016ce <fd2sockid>
+  801888:	89 c3                	mov    %eax,%ebx
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	78 1c                	js     8018aa <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80188e:	89 f0                	mov    %esi,%eax
+  801890:	e8 69 fe ff ff       	call   8016fe <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801895:	0b 45 10             	or     0x10(%ebp),%eax
+  801898:	50                   	push   %eax
+  801899:	ff 77 0c             	push   0xc(%edi)
+  80189c:	ff 77 08             	push   0x8(%edi)
+  80189f:	53                   	push   %ebx
+  8018a0:	e8 7c 04 00 00       	call   801d21 <nsipc_sendmsg>
+  8018a5:	89 c3                	mov    %eax,%ebx
+  8018a7:	83 c4 10             	add    $0x10,%esp
+}
+  8018aa:	89 d8                	mov    %ebx,%eax
+  8018ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018af:	5b                   	pop    %ebx
+  8018b0:	5e                   	pop    %esi
+  8018b1:	5f                   	pop    %edi
+  8018b2:	5d                   	pop    %ebp
+  8018b3:	c3                   	ret
+
+008018b4 <recvmsg>:
+{
+  8018b4:	55                   	push   %ebp
+  8018b5:	89 e5                	mov    %esp,%ebp
+  8018b7:	57                   	push   %edi
+  8018b8:	56                   	push   %esi
+  8018b9:	53                   	push   %ebx
+  8018ba:	83 ec 0c             	sub    $0xc,%esp
+  8018bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018c0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8018c3:	89 f8                	mov    %edi,%eax
+  8018c5:	e8 04 fe ff ff       	call   8016ce <fd2sockid>
+  8018ca:	89 c3                	mov    %eax,%ebx
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	78 2a                	js     8018fa <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8018d0:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8018d7:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8018de:	89 f8                	mov    %edi,%eax
+  8018e0:	e8 19 fe ff ff       	call   8016fe <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8018e5:	0b 45 10             	or     0x10(%ebp),%eax
+  8018e8:	50                   	push   %eax
+  8018e9:	ff 76 0c             	push   0xc(%esi)
+  8018ec:	ff 76 08             	push   0x8(%esi)
+  8018ef:	53                   	push   %ebx
+  8018f0:	e8 d6 07 00 00       	call   8020cb <nsipc_recvmsg>
+  8018f5:	89 c3                	mov    %eax,%ebx
+  8018f7:	83 c4 10             	add    $0x10,%esp
+}
+  8018fa:	89 d8                	mov    %ebx,%eax
+  8018fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ff:	5b                   	pop    %ebx
+  801900:	5e                   	pop    %esi
+  801901:	5f                   	pop    %edi
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+
+00801904 <sendfile>:
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	56                   	push   %esi
+  801908:	53                   	push   %ebx
+  801909:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80190c:	89 f0                	mov    %esi,%eax
+  80190e:	e8 bb fd ff ff       	call   8016ce <fd2sockid>
+  801913:	89 c3                	mov    %eax,%ebx
+  801915:	85 c0                	test   %eax,%eax
+  801917:	78 1f                	js     801938 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801919:	89 f0                	mov    %esi,%eax
+  80191b:	e8 de fd ff ff       	call   8016fe <sock_flags>
+  801920:	83 ec 0c             	sub    $0xc,%esp
+  801923:	50                   	push   %eax
+  801924:	ff 75 14             	push   0x14(%ebp)
+  801927:	ff 75 10             	push   0x10(%ebp)
+  80192a:	ff 75 0c             	push   0xc(%ebp)
+  80192d:	53                   	push   %ebx
+  80192e:	e8 64 06 00 00       	call   801f97 <nsipc_sendfile>
+  801933:	89 c3                	mov    %eax,%ebx
+  801935:	83 c4 20             	add    $0x20,%esp
+}
+  801938:	89 d8                	mov    %ebx,%eax
+  80193a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80193d:	5b                   	pop    %ebx
+  80193e:	5e                   	pop    %esi
+  80193f:	5d                   	pop    %ebp
+  801940:	c3                   	ret
+
+00801941 <evctl>:
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	53                   	push   %ebx
+  801945:	83 ec 04             	sub    $0x4,%esp
+  801948:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80194b:	89 d8                	mov    %ebx,%eax
+  80194d:	e8 7c fd ff ff       	call   8016ce <fd2sockid>
+  801952:	85 c0                	test   %eax,%eax
+  801954:	78 10                	js     801966 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801956:	83 ec 04             	sub    $0x4,%esp
+  801959:	53                   	push   %ebx
+  80195a:	ff 75 0c             	push   0xc(%ebp)
+  80195d:	50                   	push   %eax
+  80195e:	e8 d2 0b 00 00       	call   802535 <nsipc_evctl>
+  801963:	83 c4 10             	add    $0x10,%esp
+}
+  801966:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801969:	c9                   	leave
+  80196a:	c3                   	ret
+
+0080196b <evwait>:
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801971:	ff 75 10             	push   0x10(%ebp)
+  801974:	ff 75 0c             	push   0xc(%ebp)
+  801977:	ff 75 08             	push   0x8(%ebp)
+  80197a:	e8 e0 0b 00 00       	call   80255f <nsipc_evwait>
+}
+  80197f:	c9                   	leave
+  801980:	c3                   	ret
+
+00801981 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801987:	ff 75 10             	push   0x10(%ebp)
+  80198a:	ff 75 0c             	push   0xc(%ebp)
+  80198d:	ff 75 08             	push   0x8(%ebp)
+  801990:	e8 31 0c 00 00       	call   8025c6 <nsipc_socket>
+  801995:	83 c4 10             	add    $0x10,%esp
+  801998:	85 c0                	test   %eax,%eax
+  80199a:	78 05                	js     8019a1 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80199c:	e8 89 fd ff ff       	call   80172a <alloc_sockfd>
+}
+  8019a1:	c9                   	leave
+  8019a2:	c3                   	ret
+
+008019a3 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8019a3:	55                   	push   %ebp
+  8019a4:	89 e5                	mov    %esp,%ebp
+  8019a6:	53                   	push   %ebx
+  8019a7:	83 ec 04             	sub    $0x4,%esp
+  8019aa:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8019ac:	83 3d 24 77 80 00 00 	cmpl   $0x0,0x807724
+  8019b3:	74 26                	je     8019db <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8019b5:	6a 07                	push   $0x7
+  8019b7:	68 00 a0 80 00       	push   $0x80a000
+  8019bc:	53                   	push   %ebx
+  8019bd:	ff 35 24 77 80 00    	push   0x807724
+  8019c3:	e8 4a 35 00 00       	call   804f12 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8019c8:	83 c4 0c             	add    $0xc,%esp
+  8019cb:	6a 00                	push   $0x0
+  8019cd:	6a 00                	push   $0x0
+  8019cf:	6a 00                	push   $0x0
+  8019d1:	e8 ac 32 00 00       	call   804c82 <ipc_recv>
+}
+  8019d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019d9:	c9                   	leave
+  8019da:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	6a 03                	push   $0x3
+  8019e0:	e8 96 35 00 00       	call   804f7b <ipc_find_env>
+  8019e5:	a3 24 77 80 00       	mov    %eax,0x807724
+  8019ea:	83 c4 10             	add    $0x10,%esp
+  8019ed:	eb c6                	jmp    8019b5 <nsipc+0x12>
+
+008019ef <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8019ef:	55                   	push   %ebp
+  8019f0:	89 e5                	mov    %esp,%ebp
+  8019f2:	56                   	push   %esi
+  8019f3:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8019f4:	8b 35 30 77 80 00    	mov    0x807730,%esi
+		return 0;
+  8019fa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8019ff:	85 f6                	test   %esi,%esi
+  801a01:	75 33                	jne    801a36 <nsbulk_map+0x47>
+  801a03:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801a08:	83 ec 04             	sub    $0x4,%esp
+  801a0b:	6a 07                	push   $0x7
+  801a0d:	53                   	push   %ebx
+  801a0e:	6a 00                	push   $0x0
+  801a10:	e8 e6 ec ff ff       	call   8006fb <sys_page_alloc>
+  801a15:	83 c4 10             	add    $0x10,%esp
+  801a18:	85 c0                	test   %eax,%eax
+  801a1a:	78 1a                	js     801a36 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801a1c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a22:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801a28:	75 de                	jne    801a08 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801a2a:	c7 05 30 77 80 00 01 	movl   $0x1,0x807730
+  801a31:	00 00 00 
+	return 0;
+  801a34:	89 f0                	mov    %esi,%eax
+}
+  801a36:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a39:	5b                   	pop    %ebx
+  801a3a:	5e                   	pop    %esi
+  801a3b:	5d                   	pop    %ebp
+  801a3c:	c3                   	ret
+
+00801a3d <nsbulk_own>:
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	57                   	push   %edi
+  801a41:	56                   	push   %esi
+  801a42:	53                   	push   %ebx
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801a48:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801a4b:	85 d2                	test   %edx,%edx
+  801a4d:	7f 0e                	jg     801a5d <nsbulk_own+0x20>
+	return 0;
+  801a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a54:	eb 47                	jmp    801a9d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801a56:	83 c3 01             	add    $0x1,%ebx
+  801a59:	39 fb                	cmp    %edi,%ebx
+  801a5b:	7d 3b                	jge    801a98 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801a5d:	be 01 00 00 00       	mov    $0x1,%esi
+  801a62:	89 d9                	mov    %ebx,%ecx
+  801a64:	d3 e6                	shl    %cl,%esi
+  801a66:	89 f0                	mov    %esi,%eax
+  801a68:	23 05 2c 77 80 00    	and    0x80772c,%eax
+  801a6e:	74 e6                	je     801a56 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801a70:	83 ec 04             	sub    $0x4,%esp
+  801a73:	6a 07                	push   $0x7
+  801a75:	89 d8                	mov    %ebx,%eax
+  801a77:	c1 e0 0c             	shl    $0xc,%eax
+  801a7a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801a7f:	50                   	push   %eax
+  801a80:	6a 00                	push   $0x0
+  801a82:	e8 74 ec ff ff       	call   8006fb <sys_page_alloc>
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 0f                	js     801a9d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801a8e:	f7 d6                	not    %esi
+  801a90:	21 35 2c 77 80 00    	and    %esi,0x80772c
+  801a96:	eb be                	jmp    801a56 <nsbulk_own+0x19>
+	return 0;
+  801a98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa0:	5b                   	pop    %ebx
+  801aa1:	5e                   	pop    %esi
+  801aa2:	5f                   	pop    %edi
+  801aa3:	5d                   	pop    %ebp
+  801aa4:	c3                   	ret
+
+00801aa5 <nsipc_bulk>:
+{
+  801aa5:	55                   	push   %ebp
+  801aa6:	89 e5                	mov    %esp,%ebp
+  801aa8:	57                   	push   %edi
+  801aa9:	56                   	push   %esi
+  801aaa:	53                   	push   %ebx
+  801aab:	83 ec 1c             	sub    $0x1c,%esp
+  801aae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ab1:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  801ab3:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  801ab9:	c1 fb 0c             	sar    $0xc,%ebx
+  801abc:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  801abf:	83 3d 24 77 80 00 00 	cmpl   $0x0,0x807724
+  801ac6:	74 56                	je     801b1e <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801ac8:	85 ff                	test   %edi,%edi
+  801aca:	7e 24                	jle    801af0 <nsipc_bulk+0x4b>
+  801acc:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801ad2:	74 1c                	je     801af0 <nsipc_bulk+0x4b>
+  801ad4:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  801ada:	c1 e3 0c             	shl    $0xc,%ebx
+  801add:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  801ae2:	0f b6 10             	movzbl (%eax),%edx
+  801ae5:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  801ae7:	05 00 10 00 00       	add    $0x1000,%eax
+  801aec:	39 d8                	cmp    %ebx,%eax
+  801aee:	75 f2                	jne    801ae2 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  801af0:	83 ec 0c             	sub    $0xc,%esp
+  801af3:	56                   	push   %esi
+  801af4:	57                   	push   %edi
+  801af5:	68 00 00 00 e0       	push   $0xe0000000
+  801afa:	ff 75 e4             	push   -0x1c(%ebp)
+  801afd:	ff 35 24 77 80 00    	push   0x807724
+  801b03:	e8 3e 34 00 00       	call   804f46 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  801b08:	83 c4 1c             	add    $0x1c,%esp
+  801b0b:	6a 00                	push   $0x0
+  801b0d:	6a 00                	push   $0x0
+  801b0f:	6a 00                	push   $0x0
+  801b11:	e8 6c 31 00 00       	call   804c82 <ipc_recv>
+}
+  801b16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b19:	5b                   	pop    %ebx
+  801b1a:	5e                   	pop    %esi
+  801b1b:	5f                   	pop    %edi
+  801b1c:	5d                   	pop    %ebp
+  801b1d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801b1e:	83 ec 0c             	sub    $0xc,%esp
+  801b21:	6a 03                	push   $0x3
+  801b23:	e8 53 34 00 00       	call   804f7b <ipc_find_env>
+  801b28:	a3 24 77 80 00       	mov    %eax,0x807724
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	eb 96                	jmp    801ac8 <nsipc_bulk+0x23>
+
+00801b32 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  801b32:	55                   	push   %ebp
+  801b33:	89 e5                	mov    %esp,%ebp
+  801b35:	53                   	push   %ebx
+  801b36:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  801b39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  801b41:	8b 45 14             	mov    0x14(%ebp),%eax
+  801b44:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  801b49:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b4e:	e8 50 fe ff ff       	call   8019a3 <nsipc>
+  801b53:	89 c3                	mov    %eax,%ebx
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	79 07                	jns    801b60 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  801b59:	89 d8                	mov    %ebx,%eax
+  801b5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5e:	c9                   	leave
+  801b5f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  801b60:	83 ec 04             	sub    $0x4,%esp
+  801b63:	ff 35 10 a0 80 00    	push   0x80a010
+  801b69:	68 00 a0 80 00       	push   $0x80a000
+  801b6e:	ff 75 0c             	push   0xc(%ebp)
+  801b71:	e8 01 e9 ff ff       	call   800477 <memmove>
+		*addrlen = ret->ret_addrlen;
+  801b76:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  801b7c:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b7f:	89 10                	mov    %edx,(%eax)
+  801b81:	83 c4 10             	add    $0x10,%esp
+	return r;
+  801b84:	eb d3                	jmp    801b59 <nsipc_accept+0x27>
+
+00801b86 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  801b86:	55                   	push   %ebp
+  801b87:	89 e5                	mov    %esp,%ebp
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 08             	sub    $0x8,%esp
+  801b8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  801b90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b93:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  801b98:	53                   	push   %ebx
+  801b99:	ff 75 0c             	push   0xc(%ebp)
+  801b9c:	68 04 a0 80 00       	push   $0x80a004
+  801ba1:	e8 d1 e8 ff ff       	call   800477 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  801ba6:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  801bac:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bb1:	e8 ed fd ff ff       	call   8019a3 <nsipc>
+}
+  801bb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb9:	c9                   	leave
+  801bba:	c3                   	ret
+
+00801bbb <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  801bbb:	55                   	push   %ebp
+  801bbc:	89 e5                	mov    %esp,%ebp
+  801bbe:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  801bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  801bc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bcc:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  801bd1:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd6:	e8 c8 fd ff ff       	call   8019a3 <nsipc>
+}
+  801bdb:	c9                   	leave
+  801bdc:	c3                   	ret
+
+00801bdd <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  801bdd:	55                   	push   %ebp
+  801bde:	89 e5                	mov    %esp,%ebp
+  801be0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  801be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be6:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  801beb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bf0:	e8 ae fd ff ff       	call   8019a3 <nsipc>
+}
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+00801bf7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  801bf7:	55                   	push   %ebp
+  801bf8:	89 e5                	mov    %esp,%ebp
+  801bfa:	53                   	push   %ebx
+  801bfb:	83 ec 08             	sub    $0x8,%esp
+  801bfe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  801c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c04:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  801c09:	53                   	push   %ebx
+  801c0a:	ff 75 0c             	push   0xc(%ebp)
+  801c0d:	68 04 a0 80 00       	push   $0x80a004
+  801c12:	e8 60 e8 ff ff       	call   800477 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  801c17:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  801c1d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c22:	e8 7c fd ff ff       	call   8019a3 <nsipc>
+}
+  801c27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c2a:	c9                   	leave
+  801c2b:	c3                   	ret
+
+00801c2c <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  801c2c:	55                   	push   %ebp
+  801c2d:	89 e5                	mov    %esp,%ebp
+  801c2f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  801c32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c35:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  801c3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c3d:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  801c42:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c47:	e8 57 fd ff ff       	call   8019a3 <nsipc>
+}
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+00801c4e <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	56                   	push   %esi
+  801c52:	53                   	push   %ebx
+  801c53:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  801c56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c59:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  801c5e:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  801c64:	8b 45 14             	mov    0x14(%ebp),%eax
+  801c67:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  801c6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c71:	e8 2d fd ff ff       	call   8019a3 <nsipc>
+  801c76:	89 c3                	mov    %eax,%ebx
+  801c78:	85 c0                	test   %eax,%eax
+  801c7a:	78 22                	js     801c9e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  801c7c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  801c81:	39 c6                	cmp    %eax,%esi
+  801c83:	0f 4e c6             	cmovle %esi,%eax
+  801c86:	39 c3                	cmp    %eax,%ebx
+  801c88:	7f 1d                	jg     801ca7 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  801c8a:	83 ec 04             	sub    $0x4,%esp
+  801c8d:	53                   	push   %ebx
+  801c8e:	68 00 a0 80 00       	push   $0x80a000
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	e8 dc e7 ff ff       	call   800477 <memmove>
+  801c9b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  801c9e:	89 d8                	mov    %ebx,%eax
+  801ca0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca3:	5b                   	pop    %ebx
+  801ca4:	5e                   	pop    %esi
+  801ca5:	5d                   	pop    %ebp
+  801ca6:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  801ca7:	68 4c 53 80 00       	push   $0x80534c
+  801cac:	68 61 53 80 00       	push   $0x805361
+  801cb1:	68 b2 00 00 00       	push   $0xb2
+  801cb6:	68 76 53 80 00       	push   $0x805376
+  801cbb:	e8 c0 20 00 00       	call   803d80 <_panic>
+
+00801cc0 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  801cc0:	55                   	push   %ebp
+  801cc1:	89 e5                	mov    %esp,%ebp
+  801cc3:	53                   	push   %ebx
+  801cc4:	83 ec 04             	sub    $0x4,%esp
+  801cc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  801cca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ccd:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  801cd2:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  801cd8:	7f 2e                	jg     801d08 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  801cda:	83 ec 04             	sub    $0x4,%esp
+  801cdd:	53                   	push   %ebx
+  801cde:	ff 75 0c             	push   0xc(%ebp)
+  801ce1:	68 0c a0 80 00       	push   $0x80a00c
+  801ce6:	e8 8c e7 ff ff       	call   800477 <memmove>
+	nsipcbuf.send.req_size = size;
+  801ceb:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  801cf1:	8b 45 14             	mov    0x14(%ebp),%eax
+  801cf4:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  801cf9:	b8 08 00 00 00       	mov    $0x8,%eax
+  801cfe:	e8 a0 fc ff ff       	call   8019a3 <nsipc>
+}
+  801d03:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d06:	c9                   	leave
+  801d07:	c3                   	ret
+	assert(size < 1600);
+  801d08:	68 82 53 80 00       	push   $0x805382
+  801d0d:	68 61 53 80 00       	push   $0x805361
+  801d12:	68 bd 00 00 00       	push   $0xbd
+  801d17:	68 76 53 80 00       	push   $0x805376
+  801d1c:	e8 5f 20 00 00       	call   803d80 <_panic>
+
+00801d21 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  801d21:	55                   	push   %ebp
+  801d22:	89 e5                	mov    %esp,%ebp
+  801d24:	57                   	push   %edi
+  801d25:	56                   	push   %esi
+  801d26:	53                   	push   %ebx
+  801d27:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  801d2a:	e8 c0 fc ff ff       	call   8019ef <nsbulk_map>
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 55                	js     801d88 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  801d33:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  801d3a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  801d41:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801d48:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801d4b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801d4e:	0f 8d 24 02 00 00    	jge    801f78 <nsipc_sendmsg+0x257>
+  801d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d57:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  801d5a:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  801d5d:	89 d8                	mov    %ebx,%eax
+  801d5f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d64:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  801d66:	83 ec 0c             	sub    $0xc,%esp
+  801d69:	68 20 74 80 00       	push   $0x807420
+  801d6e:	e8 0d 1b 00 00       	call   803880 <pgbatch_init>
+  801d73:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801d76:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801d78:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  801d7b:	e9 82 00 00 00       	jmp    801e02 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  801d80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801d83:	85 db                	test   %ebx,%ebx
+  801d85:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  801d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8b:	5b                   	pop    %ebx
+  801d8c:	5e                   	pop    %esi
+  801d8d:	5f                   	pop    %edi
+  801d8e:	5d                   	pop    %ebp
+  801d8f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  801d90:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801d95:	29 c8                	sub    %ecx,%eax
+  801d97:	39 d0                	cmp    %edx,%eax
+  801d99:	0f 46 d0             	cmovbe %eax,%edx
+  801d9c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  801d9e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801da4:	85 ff                	test   %edi,%edi
+  801da6:	0f 49 c7             	cmovns %edi,%eax
+  801da9:	c1 f8 0c             	sar    $0xc,%eax
+  801dac:	ba 01 00 00 00       	mov    $0x1,%edx
+  801db1:	e8 87 fc ff ff       	call   801a3d <nsbulk_own>
+  801db6:	85 c0                	test   %eax,%eax
+  801db8:	0f 88 17 01 00 00    	js     801ed5 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  801dbe:	83 ec 04             	sub    $0x4,%esp
+  801dc1:	56                   	push   %esi
+  801dc2:	ff 75 e0             	push   -0x20(%ebp)
+  801dc5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801dc8:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801dcd:	50                   	push   %eax
+  801dce:	e8 a4 e6 ff ff       	call   800477 <memmove>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  801dd6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801dd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ddc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801ddf:	0f 84 fd 00 00 00    	je     801ee2 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  801de5:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  801de8:	01 f7                	add    %esi,%edi
+  801dea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801ded:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801df0:	0f 8d 01 01 00 00    	jge    801ef7 <nsipc_sendmsg+0x1d6>
+  801df6:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  801dfc:	0f 8f f0 00 00 00    	jg     801ef2 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  801e02:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e05:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  801e08:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  801e0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e0e:	89 c2                	mov    %eax,%edx
+  801e10:	03 13                	add    (%ebx),%edx
+  801e12:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  801e15:	8b 73 04             	mov    0x4(%ebx),%esi
+  801e18:	29 c6                	sub    %eax,%esi
+  801e1a:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  801e1f:	29 f9                	sub    %edi,%ecx
+  801e21:	39 ce                	cmp    %ecx,%esi
+  801e23:	89 ca                	mov    %ecx,%edx
+  801e25:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  801e28:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  801e2b:	89 f9                	mov    %edi,%ecx
+  801e2d:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  801e33:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e36:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e3b:	09 c8                	or     %ecx,%eax
+  801e3d:	0f 85 4d ff ff ff    	jne    801d90 <nsipc_sendmsg+0x6f>
+  801e43:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  801e49:	0f 86 41 ff ff ff    	jbe    801d90 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801e4f:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  801e55:	85 ff                	test   %edi,%edi
+  801e57:	0f 49 c7             	cmovns %edi,%eax
+  801e5a:	c1 f8 0c             	sar    $0xc,%eax
+  801e5d:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  801e5f:	89 d1                	mov    %edx,%ecx
+  801e61:	c1 e9 0c             	shr    $0xc,%ecx
+  801e64:	01 c8                	add    %ecx,%eax
+  801e66:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801e69:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e6c:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  801e6e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801e71:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801e76:	29 c8                	sub    %ecx,%eax
+  801e78:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  801e7b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  801e7e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  801e80:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e85:	89 f9                	mov    %edi,%ecx
+  801e87:	d3 e0                	shl    %cl,%eax
+  801e89:	09 05 2c 77 80 00    	or     %eax,0x80772c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801e8f:	83 ec 08             	sub    $0x8,%esp
+  801e92:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  801e94:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  801e97:	50                   	push   %eax
+  801e98:	6a 00                	push   $0x0
+  801e9a:	56                   	push   %esi
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	68 20 74 80 00       	push   $0x807420
+  801ea2:	e8 97 1a 00 00       	call   80393e <pgbatch_map>
+  801ea7:	83 c4 20             	add    $0x20,%esp
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	0f 88 ce fe ff ff    	js     801d80 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  801eb2:	83 c7 01             	add    $0x1,%edi
+  801eb5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801ebb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ebe:	39 c7                	cmp    %eax,%edi
+  801ec0:	75 be                	jne    801e80 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  801ec2:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801ec5:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  801ec8:	89 d6                	mov    %edx,%esi
+  801eca:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801ed0:	e9 01 ff ff ff       	jmp    801dd6 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  801ed5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801ed8:	85 db                	test   %ebx,%ebx
+  801eda:	0f 45 c3             	cmovne %ebx,%eax
+  801edd:	e9 a6 fe ff ff       	jmp    801d88 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  801ee2:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  801ee6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801eed:	e9 f3 fe ff ff       	jmp    801de5 <nsipc_sendmsg+0xc4>
+  801ef2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  801ef5:	eb 03                	jmp    801efa <nsipc_sendmsg+0x1d9>
+  801ef7:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  801efa:	83 ec 0c             	sub    $0xc,%esp
+  801efd:	68 20 74 80 00       	push   $0x807420
+  801f02:	e8 87 19 00 00       	call   80388e <pgbatch_flush>
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	85 c0                	test   %eax,%eax
+  801f0c:	78 50                	js     801f5e <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  801f0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f11:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  801f16:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  801f1c:	89 fb                	mov    %edi,%ebx
+  801f1e:	29 f3                	sub    %esi,%ebx
+  801f20:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  801f26:	8b 45 14             	mov    0x14(%ebp),%eax
+  801f29:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  801f2e:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f33:	89 fa                	mov    %edi,%edx
+  801f35:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f3a:	e8 66 fb ff ff       	call   801aa5 <nsipc_bulk>
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 28                	js     801f6b <nsipc_sendmsg+0x24a>
+		sent += r;
+  801f43:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  801f46:	39 c3                	cmp    %eax,%ebx
+  801f48:	75 0c                	jne    801f56 <nsipc_sendmsg+0x235>
+  801f4a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801f4d:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f50:	0f 8f f2 fd ff ff    	jg     801d48 <nsipc_sendmsg+0x27>
+		sent += r;
+  801f56:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f59:	e9 2a fe ff ff       	jmp    801d88 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801f5e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801f61:	85 db                	test   %ebx,%ebx
+  801f63:	0f 45 c3             	cmovne %ebx,%eax
+  801f66:	e9 1d fe ff ff       	jmp    801d88 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  801f6b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  801f6e:	85 db                	test   %ebx,%ebx
+  801f70:	0f 45 c3             	cmovne %ebx,%eax
+  801f73:	e9 10 fe ff ff       	jmp    801d88 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  801f78:	83 ec 0c             	sub    $0xc,%esp
+  801f7b:	68 20 74 80 00       	push   $0x807420
+  801f80:	e8 fb 18 00 00       	call   803880 <pgbatch_init>
+  801f85:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  801f88:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f92:	e9 63 ff ff ff       	jmp    801efa <nsipc_sendmsg+0x1d9>
+
+00801f97 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	57                   	push   %edi
+  801f9b:	56                   	push   %esi
+  801f9c:	53                   	push   %ebx
+  801f9d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  801fa0:	83 3d 28 77 80 00 00 	cmpl   $0x0,0x807728
+  801fa7:	0f 84 c8 00 00 00    	je     802075 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  801fad:	83 3d 24 77 80 00 00 	cmpl   $0x0,0x807724
+  801fb4:	0f 84 e4 00 00 00    	je     80209e <nsipc_sendfile+0x107>
+{
+  801fba:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  801fbf:	89 fb                	mov    %edi,%ebx
+  801fc1:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  801fc4:	0f 83 f0 00 00 00    	jae    8020ba <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  801fca:	89 fa                	mov    %edi,%edx
+  801fcc:	03 55 10             	add    0x10(%ebp),%edx
+  801fcf:	89 d0                	mov    %edx,%eax
+  801fd1:	c1 f8 1f             	sar    $0x1f,%eax
+  801fd4:	c1 e8 14             	shr    $0x14,%eax
+  801fd7:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  801fda:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801fe0:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  801fe2:	6a 10                	push   $0x10
+  801fe4:	68 00 20 01 e0       	push   $0xe0012000
+  801fe9:	52                   	push   %edx
+  801fea:	ff 75 0c             	push   0xc(%ebp)
+  801fed:	e8 ea f3 ff ff       	call   8013dc <fmap>
+  801ff2:	83 c4 10             	add    $0x10,%esp
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	0f 8e b8 00 00 00    	jle    8020b5 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  801ffd:	39 c6                	cmp    %eax,%esi
+  801fff:	0f 8d b5 00 00 00    	jge    8020ba <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802005:	29 f0                	sub    %esi,%eax
+  802007:	8b 55 14             	mov    0x14(%ebp),%edx
+  80200a:	29 da                	sub    %ebx,%edx
+  80200c:	39 d0                	cmp    %edx,%eax
+  80200e:	89 d3                	mov    %edx,%ebx
+  802010:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802013:	8b 45 08             	mov    0x8(%ebp),%eax
+  802016:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80201b:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802021:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802027:	8b 45 18             	mov    0x18(%ebp),%eax
+  80202a:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80202f:	83 ec 0c             	sub    $0xc,%esp
+  802032:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802034:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80203b:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  80203e:	83 c0 01             	add    $0x1,%eax
+  802041:	50                   	push   %eax
+  802042:	68 00 10 01 e0       	push   $0xe0011000
+  802047:	6a 11                	push   $0x11
+  802049:	ff 35 24 77 80 00    	push   0x807724
+  80204f:	e8 f2 2e 00 00       	call   804f46 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802054:	83 c4 1c             	add    $0x1c,%esp
+  802057:	6a 00                	push   $0x0
+  802059:	6a 00                	push   $0x0
+  80205b:	6a 00                	push   $0x0
+  80205d:	e8 20 2c 00 00       	call   804c82 <ipc_recv>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 5b                	js     8020c4 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802069:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80206b:	39 c3                	cmp    %eax,%ebx
+  80206d:	0f 8e 4c ff ff ff    	jle    801fbf <nsipc_sendfile+0x28>
+  802073:	eb 45                	jmp    8020ba <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802075:	83 ec 04             	sub    $0x4,%esp
+  802078:	6a 07                	push   $0x7
+  80207a:	68 00 10 01 e0       	push   $0xe0011000
+  80207f:	6a 00                	push   $0x0
+  802081:	e8 75 e6 ff ff       	call   8006fb <sys_page_alloc>
+  802086:	89 c7                	mov    %eax,%edi
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	78 2b                	js     8020ba <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80208f:	c7 05 28 77 80 00 01 	movl   $0x1,0x807728
+  802096:	00 00 00 
+  802099:	e9 0f ff ff ff       	jmp    801fad <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	6a 03                	push   $0x3
+  8020a3:	e8 d3 2e 00 00       	call   804f7b <ipc_find_env>
+  8020a8:	a3 24 77 80 00       	mov    %eax,0x807724
+  8020ad:	83 c4 10             	add    $0x10,%esp
+  8020b0:	e9 05 ff ff ff       	jmp    801fba <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8020b5:	85 ff                	test   %edi,%edi
+  8020b7:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8020ba:	89 f8                	mov    %edi,%eax
+  8020bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020bf:	5b                   	pop    %ebx
+  8020c0:	5e                   	pop    %esi
+  8020c1:	5f                   	pop    %edi
+  8020c2:	5d                   	pop    %ebp
+  8020c3:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8020c4:	85 ff                	test   %edi,%edi
+  8020c6:	0f 44 f8             	cmove  %eax,%edi
+  8020c9:	eb ef                	jmp    8020ba <nsipc_sendfile+0x123>
+
+008020cb <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8020cb:	55                   	push   %ebp
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	57                   	push   %edi
+  8020cf:	56                   	push   %esi
+  8020d0:	53                   	push   %ebx
+  8020d1:	83 ec 1c             	sub    $0x1c,%esp
+  8020d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8020d7:	e8 13 f9 ff ff       	call   8019ef <nsbulk_map>
+  8020dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8020df:	85 c0                	test   %eax,%eax
+  8020e1:	0f 88 ba 00 00 00    	js     8021a1 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8020e7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020eb:	0f 8e bb 00 00 00    	jle    8021ac <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8020f1:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8020f6:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8020fb:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802100:	89 f8                	mov    %edi,%eax
+  802102:	29 f0                	sub    %esi,%eax
+  802104:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802108:	39 c8                	cmp    %ecx,%eax
+  80210a:	0f 47 c1             	cmova  %ecx,%eax
+  80210d:	01 f0                	add    %esi,%eax
+  80210f:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802111:	83 c2 01             	add    $0x1,%edx
+  802114:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802117:	7e 07                	jle    802120 <nsipc_recvmsg+0x55>
+  802119:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  80211e:	7e e0                	jle    802100 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802120:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802126:	c1 fa 0c             	sar    $0xc,%edx
+  802129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212e:	e8 0a f9 ff ff       	call   801a3d <nsbulk_own>
+  802133:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802136:	85 c0                	test   %eax,%eax
+  802138:	78 67                	js     8021a1 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80213a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80213d:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802142:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802148:	8b 45 14             	mov    0x14(%ebp),%eax
+  80214b:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802150:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802155:	89 f2                	mov    %esi,%edx
+  802157:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80215c:	e8 44 f9 ff ff       	call   801aa5 <nsipc_bulk>
+  802161:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802164:	85 c0                	test   %eax,%eax
+  802166:	78 39                	js     8021a1 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802168:	39 f0                	cmp    %esi,%eax
+  80216a:	7f 4a                	jg     8021b6 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80216c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802171:	85 c0                	test   %eax,%eax
+  802173:	7e 2c                	jle    8021a1 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802175:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802178:	29 fe                	sub    %edi,%esi
+  80217a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80217d:	39 c6                	cmp    %eax,%esi
+  80217f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802182:	83 ec 04             	sub    $0x4,%esp
+  802185:	56                   	push   %esi
+  802186:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80218c:	50                   	push   %eax
+  80218d:	ff 33                	push   (%ebx)
+  80218f:	e8 e3 e2 ff ff       	call   800477 <memmove>
+		n += m;
+  802194:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802196:	83 c3 08             	add    $0x8,%ebx
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80219f:	7f d4                	jg     802175 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8021a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021a7:	5b                   	pop    %ebx
+  8021a8:	5e                   	pop    %esi
+  8021a9:	5f                   	pop    %edi
+  8021aa:	5d                   	pop    %ebp
+  8021ab:	c3                   	ret
+	int r, i, n, len = 0;
+  8021ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b1:	e9 6a ff ff ff       	jmp    802120 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8021b6:	68 58 53 80 00       	push   $0x805358
+  8021bb:	68 61 53 80 00       	push   $0x805361
+  8021c0:	68 3b 01 00 00       	push   $0x13b
+  8021c5:	68 76 53 80 00       	push   $0x805376
+  8021ca:	e8 b1 1b 00 00       	call   803d80 <_panic>
+
+008021cf <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	57                   	push   %edi
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 0c             	sub    $0xc,%esp
+  8021d8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021db:	8b 75 10             	mov    0x10(%ebp),%esi
+  8021de:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8021e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  8021e9:	8b 07                	mov    (%edi),%eax
+  8021eb:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8021f0:	8b 47 04             	mov    0x4(%edi),%eax
+  8021f3:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8021f8:	8b 47 08             	mov    0x8(%edi),%eax
+  8021fb:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  802200:	8b 47 0c             	mov    0xc(%edi),%eax
+  802203:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  802208:	8b 47 10             	mov    0x10(%edi),%eax
+  80220b:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  802210:	8b 47 14             	mov    0x14(%edi),%eax
+  802213:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  802218:	8b 47 18             	mov    0x18(%edi),%eax
+  80221b:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  802220:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802223:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  802228:	8b 47 20             	mov    0x20(%edi),%eax
+  80222b:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  802230:	8b 47 24             	mov    0x24(%edi),%eax
+  802233:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  802238:	8b 47 28             	mov    0x28(%edi),%eax
+  80223b:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  802240:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802243:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  802248:	8b 47 30             	mov    0x30(%edi),%eax
+  80224b:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  802250:	8b 47 34             	mov    0x34(%edi),%eax
+  802253:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  802258:	8b 47 38             	mov    0x38(%edi),%eax
+  80225b:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  802260:	8b 47 3c             	mov    0x3c(%edi),%eax
+  802263:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  802268:	8b 06                	mov    (%esi),%eax
+  80226a:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  80226f:	8b 46 04             	mov    0x4(%esi),%eax
+  802272:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  802277:	8b 46 08             	mov    0x8(%esi),%eax
+  80227a:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  80227f:	8b 46 0c             	mov    0xc(%esi),%eax
+  802282:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  802287:	8b 46 10             	mov    0x10(%esi),%eax
+  80228a:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  80228f:	8b 46 14             	mov    0x14(%esi),%eax
+  802292:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  802297:	8b 46 18             	mov    0x18(%esi),%eax
+  80229a:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  80229f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8022a2:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  8022a7:	8b 46 20             	mov    0x20(%esi),%eax
+  8022aa:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  8022af:	8b 46 24             	mov    0x24(%esi),%eax
+  8022b2:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  8022b7:	8b 46 28             	mov    0x28(%esi),%eax
+  8022ba:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  8022bf:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8022c2:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  8022c7:	8b 46 30             	mov    0x30(%esi),%eax
+  8022ca:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  8022cf:	8b 46 34             	mov    0x34(%esi),%eax
+  8022d2:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  8022d7:	8b 46 38             	mov    0x38(%esi),%eax
+  8022da:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  8022df:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8022e2:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8022e7:	8b 03                	mov    (%ebx),%eax
+  8022e9:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  8022ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022f1:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  8022f6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8022f9:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  8022fe:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802301:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  802306:	8b 43 10             	mov    0x10(%ebx),%eax
+  802309:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  80230e:	8b 43 14             	mov    0x14(%ebx),%eax
+  802311:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  802316:	8b 43 18             	mov    0x18(%ebx),%eax
+  802319:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  80231e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802321:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  802326:	8b 43 20             	mov    0x20(%ebx),%eax
+  802329:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  80232e:	8b 43 24             	mov    0x24(%ebx),%eax
+  802331:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  802336:	8b 43 28             	mov    0x28(%ebx),%eax
+  802339:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  80233e:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802341:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  802346:	8b 43 30             	mov    0x30(%ebx),%eax
+  802349:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  80234e:	8b 43 34             	mov    0x34(%ebx),%eax
+  802351:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  802356:	8b 43 38             	mov    0x38(%ebx),%eax
+  802359:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  80235e:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802361:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  802366:	8b 45 18             	mov    0x18(%ebp),%eax
+  802369:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80236e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802373:	e8 2b f6 ff ff       	call   8019a3 <nsipc>
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	0f 88 ad 01 00 00    	js     80252d <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802380:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  802386:	89 17                	mov    %edx,(%edi)
+  802388:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  80238e:	89 57 04             	mov    %edx,0x4(%edi)
+  802391:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  802397:	89 57 08             	mov    %edx,0x8(%edi)
+  80239a:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  8023a0:	89 57 0c             	mov    %edx,0xc(%edi)
+  8023a3:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  8023a9:	89 57 10             	mov    %edx,0x10(%edi)
+  8023ac:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  8023b2:	89 57 14             	mov    %edx,0x14(%edi)
+  8023b5:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  8023bb:	89 57 18             	mov    %edx,0x18(%edi)
+  8023be:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  8023c4:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8023c7:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  8023cd:	89 57 20             	mov    %edx,0x20(%edi)
+  8023d0:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  8023d6:	89 57 24             	mov    %edx,0x24(%edi)
+  8023d9:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  8023df:	89 57 28             	mov    %edx,0x28(%edi)
+  8023e2:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  8023e8:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8023eb:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  8023f1:	89 57 30             	mov    %edx,0x30(%edi)
+  8023f4:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  8023fa:	89 57 34             	mov    %edx,0x34(%edi)
+  8023fd:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  802403:	89 57 38             	mov    %edx,0x38(%edi)
+  802406:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  80240c:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  80240f:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  802415:	89 16                	mov    %edx,(%esi)
+  802417:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  80241d:	89 56 04             	mov    %edx,0x4(%esi)
+  802420:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  802426:	89 56 08             	mov    %edx,0x8(%esi)
+  802429:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  80242f:	89 56 0c             	mov    %edx,0xc(%esi)
+  802432:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  802438:	89 56 10             	mov    %edx,0x10(%esi)
+  80243b:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  802441:	89 56 14             	mov    %edx,0x14(%esi)
+  802444:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  80244a:	89 56 18             	mov    %edx,0x18(%esi)
+  80244d:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  802453:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802456:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  80245c:	89 56 20             	mov    %edx,0x20(%esi)
+  80245f:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  802465:	89 56 24             	mov    %edx,0x24(%esi)
+  802468:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  80246e:	89 56 28             	mov    %edx,0x28(%esi)
+  802471:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  802477:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80247a:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  802480:	89 56 30             	mov    %edx,0x30(%esi)
+  802483:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  802489:	89 56 34             	mov    %edx,0x34(%esi)
+  80248c:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  802492:	89 56 38             	mov    %edx,0x38(%esi)
+  802495:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  80249b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80249e:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  8024a4:	89 13                	mov    %edx,(%ebx)
+  8024a6:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  8024ac:	89 53 04             	mov    %edx,0x4(%ebx)
+  8024af:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  8024b5:	89 53 08             	mov    %edx,0x8(%ebx)
+  8024b8:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  8024be:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8024c1:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  8024c7:	89 53 10             	mov    %edx,0x10(%ebx)
+  8024ca:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  8024d0:	89 53 14             	mov    %edx,0x14(%ebx)
+  8024d3:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  8024d9:	89 53 18             	mov    %edx,0x18(%ebx)
+  8024dc:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  8024e2:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8024e5:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  8024eb:	89 53 20             	mov    %edx,0x20(%ebx)
+  8024ee:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  8024f4:	89 53 24             	mov    %edx,0x24(%ebx)
+  8024f7:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  8024fd:	89 53 28             	mov    %edx,0x28(%ebx)
+  802500:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  802506:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802509:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  80250f:	89 53 30             	mov    %edx,0x30(%ebx)
+  802512:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  802518:	89 53 34             	mov    %edx,0x34(%ebx)
+  80251b:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  802521:	89 53 38             	mov    %edx,0x38(%ebx)
+  802524:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  80252a:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80252d:	83 c4 0c             	add    $0xc,%esp
+  802530:	5b                   	pop    %ebx
+  802531:	5e                   	pop    %esi
+  802532:	5f                   	pop    %edi
+  802533:	5d                   	pop    %ebp
+  802534:	c3                   	ret
+
+00802535 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802535:	55                   	push   %ebp
+  802536:	89 e5                	mov    %esp,%ebp
+  802538:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80253b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  802543:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802546:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  80254b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80254e:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  802553:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802558:	e8 46 f4 ff ff       	call   8019a3 <nsipc>
+}
+  80255d:	c9                   	leave
+  80255e:	c3                   	ret
+
+0080255f <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80255f:	55                   	push   %ebp
+  802560:	89 e5                	mov    %esp,%ebp
+  802562:	56                   	push   %esi
+  802563:	53                   	push   %ebx
+  802564:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802567:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80256d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802570:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802575:	b8 10 00 00 00       	mov    $0x10,%eax
+  80257a:	e8 24 f4 ff ff       	call   8019a3 <nsipc>
+  80257f:	89 c3                	mov    %eax,%ebx
+  802581:	85 c0                	test   %eax,%eax
+  802583:	7e 1f                	jle    8025a4 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802585:	39 c6                	cmp    %eax,%esi
+  802587:	7c 24                	jl     8025ad <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802589:	83 ec 04             	sub    $0x4,%esp
+  80258c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802593:	50                   	push   %eax
+  802594:	68 00 a0 80 00       	push   $0x80a000
+  802599:	ff 75 08             	push   0x8(%ebp)
+  80259c:	e8 d6 de ff ff       	call   800477 <memmove>
+  8025a1:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8025a4:	89 d8                	mov    %ebx,%eax
+  8025a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025a9:	5b                   	pop    %ebx
+  8025aa:	5e                   	pop    %esi
+  8025ab:	5d                   	pop    %ebp
+  8025ac:	c3                   	ret
+		assert(r <= max);
+  8025ad:	68 8e 53 80 00       	push   $0x80538e
+  8025b2:	68 61 53 80 00       	push   $0x805361
+  8025b7:	68 6a 01 00 00       	push   $0x16a
+  8025bc:	68 76 53 80 00       	push   $0x805376
+  8025c1:	e8 ba 17 00 00       	call   803d80 <_panic>
+
+008025c6 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8025cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025cf:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  8025d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d7:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  8025dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025df:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  8025e4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025e9:	e8 b5 f3 ff ff       	call   8019a3 <nsipc>
+}
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+
+008025f0 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8025f0:	55                   	push   %ebp
+  8025f1:	89 e5                	mov    %esp,%ebp
+  8025f3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8025f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  8025fe:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802603:	e8 9b f3 ff ff       	call   8019a3 <nsipc>
+}
+  802608:	c9                   	leave
+  802609:	c3                   	ret
+
+0080260a <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80260a:	55                   	push   %ebp
+  80260b:	89 e5                	mov    %esp,%ebp
+  80260d:	53                   	push   %ebx
+  80260e:	83 ec 04             	sub    $0x4,%esp
+  802611:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802614:	b8 12 00 00 00       	mov    $0x12,%eax
+  802619:	e8 85 f3 ff ff       	call   8019a3 <nsipc>
+  80261e:	85 c0                	test   %eax,%eax
+  802620:	78 50                	js     802672 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802622:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  802628:	89 13                	mov    %edx,(%ebx)
+  80262a:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  802630:	89 53 04             	mov    %edx,0x4(%ebx)
+  802633:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  802639:	89 53 08             	mov    %edx,0x8(%ebx)
+  80263c:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  802642:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802645:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  80264b:	89 53 10             	mov    %edx,0x10(%ebx)
+  80264e:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  802654:	89 53 14             	mov    %edx,0x14(%ebx)
+  802657:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  80265d:	89 53 18             	mov    %edx,0x18(%ebx)
+  802660:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  802666:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802669:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  80266f:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802672:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802675:	c9                   	leave
+  802676:	c3                   	ret
+
+00802677 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80267d:	6a 03                	push   $0x3
+  80267f:	e8 f7 28 00 00       	call   804f7b <ipc_find_env>
+  802684:	a3 24 77 80 00       	mov    %eax,0x807724
+	nsipcbuf.shard.req_shard = shard;
+  802689:	8b 45 08             	mov    0x8(%ebp),%eax
+  80268c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802691:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802696:	e8 08 f3 ff ff       	call   8019a3 <nsipc>
+  80269b:	83 c4 10             	add    $0x10,%esp
+  80269e:	85 c0                	test   %eax,%eax
+  8026a0:	78 0a                	js     8026ac <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8026a2:	a3 24 77 80 00       	mov    %eax,0x807724
+	return 0;
+  8026a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026ac:	c9                   	leave
+  8026ad:	c3                   	ret
+
+008026ae <list_remove>:
+}
+
+static void
+list_remove(struct mspan **head, struct mspan *mp)
+{
+	if (mp->mp_prev)
+  8026ae:	8b 4a 14             	mov    0x14(%edx),%ecx
+  8026b1:	85 c9                	test   %ecx,%ecx
+  8026b3:	74 14                	je     8026c9 <list_remove+0x1b>
+		mp->mp_prev->mp_next = mp->mp_next;
+  8026b5:	8b 42 10             	mov    0x10(%edx),%eax
+  8026b8:	89 41 10             	mov    %eax,0x10(%ecx)
+	else
+		*head = mp->mp_next;
+	if (mp->mp_next)
+  8026bb:	8b 42 10             	mov    0x10(%edx),%eax
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	74 06                	je     8026c8 <list_remove+0x1a>
+		mp->mp_next->mp_prev = mp->mp_prev;
+  8026c2:	8b 52 14             	mov    0x14(%edx),%edx
+  8026c5:	89 50 14             	mov    %edx,0x14(%eax)
+}
+  8026c8:	c3                   	ret
+		*head = mp->mp_next;
+  8026c9:	8b 4a 10             	mov    0x10(%edx),%ecx
+  8026cc:	89 08                	mov    %ecx,(%eax)
+  8026ce:	eb eb                	jmp    8026bb <list_remove+0xd>
+
+008026d0 <span_set>:
+}
+
+// Make 'mp' a span of 'npages', and tell the span above.
+static void
+span_set(struct mspan *mp, int npages, int kind)
+{
+  8026d0:	55                   	push   %ebp
+  8026d1:	89 e5                	mov    %esp,%ebp
+  8026d3:	53                   	push   %ebx
+  8026d4:	89 d3                	mov    %edx,%ebx
+	struct mspan *next;
+
+	mp->mp_magic = MSPAN_MAGIC;
+  8026d6:	c7 00 4e 50 53 4d    	movl   $0x4d53504e,(%eax)
+	mp->mp_npages = npages;
+  8026dc:	66 89 50 04          	mov    %dx,0x4(%eax)
+	mp->mp_kind = kind;
+  8026e0:	88 48 08             	mov    %cl,0x8(%eax)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  8026e3:	0f b7 d2             	movzwl %dx,%edx
+  8026e6:	c1 e2 0c             	shl    $0xc,%edx
+  8026e9:	01 c2                	add    %eax,%edx
+	return next < mtop ? (struct mspan *) next : NULL;
+  8026eb:	3b 15 24 7c 80 00    	cmp    0x807c24,%edx
+  8026f1:	73 09                	jae    8026fc <span_set+0x2c>
+	if ((next = span_next(mp)))
+		next->mp_prevpages = npages;
+  8026f3:	66 89 5a 06          	mov    %bx,0x6(%edx)
+	else
+		mlast = mp;
+}
+  8026f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fa:	c9                   	leave
+  8026fb:	c3                   	ret
+		mlast = mp;
+  8026fc:	a3 20 7c 80 00       	mov    %eax,0x807c20
+  802701:	eb f4                	jmp    8026f7 <span_set+0x27>
+
+00802703 <mlock_acquire>:
+}
+
+static void
+mlock_acquire(void)
+{
+	if (sforked)
+  802703:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  80270a:	75 01                	jne    80270d <mlock_acquire+0xa>
+  80270c:	c3                   	ret
+{
+  80270d:	55                   	push   %ebp
+  80270e:	89 e5                	mov    %esp,%ebp
+  802710:	83 ec 14             	sub    $0x14,%esp
+		mutex_lock(&mlock);
+  802713:	68 40 77 80 00       	push   $0x807740
+  802718:	e8 17 13 00 00       	call   803a34 <mutex_lock>
+  80271d:	83 c4 10             	add    $0x10,%esp
+}
+  802720:	c9                   	leave
+  802721:	c3                   	ret
+
+00802722 <mlock_release>:
+
+static void
+mlock_release(void)
+{
+	if (sforked)
+  802722:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  802729:	75 01                	jne    80272c <mlock_release+0xa>
+  80272b:	c3                   	ret
+{
+  80272c:	55                   	push   %ebp
+  80272d:	89 e5                	mov    %esp,%ebp
+  80272f:	83 ec 14             	sub    $0x14,%esp
+		mutex_unlock(&mlock);
+  802732:	68 40 77 80 00       	push   $0x807740
+  802737:	e8 66 13 00 00       	call   803aa2 <mutex_unlock>
+  80273c:	83 c4 10             	add    $0x10,%esp
+}
+  80273f:	c9                   	leave
+  802740:	c3                   	ret
+
+00802741 <span_of>:
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	83 ec 08             	sub    $0x8,%esp
+	struct mspan *mp = ROUNDDOWN(v, PGSIZE);
+  802747:	89 c2                	mov    %eax,%edx
+  802749:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  80274f:	3d ff ff ff 07       	cmp    $0x7ffffff,%eax
+  802754:	76 1a                	jbe    802770 <span_of+0x2f>
+  802756:	3b 05 24 7c 80 00    	cmp    0x807c24,%eax
+  80275c:	73 12                	jae    802770 <span_of+0x2f>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  80275e:	81 3a 4e 50 53 4d    	cmpl   $0x4d53504e,(%edx)
+  802764:	75 23                	jne    802789 <span_of+0x48>
+  802766:	80 7a 08 00          	cmpb   $0x0,0x8(%edx)
+  80276a:	74 1d                	je     802789 <span_of+0x48>
+}
+  80276c:	89 d0                	mov    %edx,%eax
+  80276e:	c9                   	leave
+  80276f:	c3                   	ret
+	assert(mbegin <= (uint8_t*) v && (uint8_t*) v < mtop);
+  802770:	68 98 53 80 00       	push   $0x805398
+  802775:	68 61 53 80 00       	push   $0x805361
+  80277a:	68 4f 01 00 00       	push   $0x14f
+  80277f:	68 fe 53 80 00       	push   $0x8053fe
+  802784:	e8 f7 15 00 00       	call   803d80 <_panic>
+	assert(mp->mp_magic == MSPAN_MAGIC && mp->mp_kind != MS_FREE);
+  802789:	68 c8 53 80 00       	push   $0x8053c8
+  80278e:	68 61 53 80 00       	push   $0x805361
+  802793:	68 50 01 00 00       	push   $0x150
+  802798:	68 fe 53 80 00       	push   $0x8053fe
+  80279d:	e8 de 15 00 00       	call   803d80 <_panic>
+
+008027a2 <span_merge>:
+{
+  8027a2:	55                   	push   %ebp
+  8027a3:	89 e5                	mov    %esp,%ebp
+  8027a5:	56                   	push   %esi
+  8027a6:	53                   	push   %ebx
+  8027a7:	89 c3                	mov    %eax,%ebx
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  8027a9:	0f b7 70 04          	movzwl 0x4(%eax),%esi
+  8027ad:	c1 e6 0c             	shl    $0xc,%esi
+  8027b0:	01 c6                	add    %eax,%esi
+	return next < mtop ? (struct mspan *) next : NULL;
+  8027b2:	3b 35 24 7c 80 00    	cmp    0x807c24,%esi
+  8027b8:	73 06                	jae    8027c0 <span_merge+0x1e>
+	if ((other = span_next(mp)) && other->mp_kind == MS_FREE) {
+  8027ba:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  8027be:	74 23                	je     8027e3 <span_merge+0x41>
+	if (mp->mp_prevpages == 0)
+  8027c0:	0f b7 43 06          	movzwl 0x6(%ebx),%eax
+  8027c4:	66 85 c0             	test   %ax,%ax
+  8027c7:	74 10                	je     8027d9 <span_merge+0x37>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  8027c9:	0f b7 c0             	movzwl %ax,%eax
+  8027cc:	c1 e0 0c             	shl    $0xc,%eax
+  8027cf:	89 de                	mov    %ebx,%esi
+  8027d1:	29 c6                	sub    %eax,%esi
+	if ((other = span_prev(mp)) && other->mp_kind == MS_FREE) {
+  8027d3:	80 7e 08 00          	cmpb   $0x0,0x8(%esi)
+  8027d7:	74 3e                	je     802817 <span_merge+0x75>
+	mp->mp_kind = MS_FREE;
+  8027d9:	c6 43 08 00          	movb   $0x0,0x8(%ebx)
+}
+  8027dd:	89 d8                	mov    %ebx,%eax
+  8027df:	5b                   	pop    %ebx
+  8027e0:	5e                   	pop    %esi
+  8027e1:	5d                   	pop    %ebp
+  8027e2:	c3                   	ret
+		list_remove(bin_of(other->mp_npages), other);
+  8027e3:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  8027e7:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  8027ec:	39 d0                	cmp    %edx,%eax
+  8027ee:	0f 4f c2             	cmovg  %edx,%eax
+  8027f1:	8d 04 85 a0 7b 80 00 	lea    0x807ba0(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  8027f8:	89 f2                	mov    %esi,%edx
+  8027fa:	e8 af fe ff ff       	call   8026ae <list_remove>
+		span_set(mp, mp->mp_npages + other->mp_npages, MS_FREE);
+  8027ff:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  802803:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  802807:	01 c2                	add    %eax,%edx
+  802809:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80280e:	89 d8                	mov    %ebx,%eax
+  802810:	e8 bb fe ff ff       	call   8026d0 <span_set>
+  802815:	eb a9                	jmp    8027c0 <span_merge+0x1e>
+		list_remove(bin_of(other->mp_npages), other);
+  802817:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  80281b:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  802820:	39 d0                	cmp    %edx,%eax
+  802822:	0f 4f c2             	cmovg  %edx,%eax
+  802825:	8d 04 85 a0 7b 80 00 	lea    0x807ba0(,%eax,4),%eax
+		list_remove(bin_of(other->mp_npages), other);
+  80282c:	89 f2                	mov    %esi,%edx
+  80282e:	e8 7b fe ff ff       	call   8026ae <list_remove>
+		span_set(other, other->mp_npages + mp->mp_npages, MS_FREE);
+  802833:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  802837:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  80283b:	01 c2                	add    %eax,%edx
+  80283d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802842:	89 f0                	mov    %esi,%eax
+  802844:	e8 87 fe ff ff       	call   8026d0 <span_set>
+	return (struct mspan *) ((uint8_t *) mp - mp->mp_prevpages * PGSIZE);
+  802849:	89 f3                	mov    %esi,%ebx
+  80284b:	eb 8c                	jmp    8027d9 <span_merge+0x37>
+
+0080284d <span_free>:
+{
+  80284d:	55                   	push   %ebp
+  80284e:	89 e5                	mov    %esp,%ebp
+  802850:	56                   	push   %esi
+  802851:	53                   	push   %ebx
+	mp = span_merge(mp);
+  802852:	e8 4b ff ff ff       	call   8027a2 <span_merge>
+  802857:	89 c3                	mov    %eax,%ebx
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  802859:	39 05 20 7c 80 00    	cmp    %eax,0x807c20
+  80285f:	74 34                	je     802895 <span_free+0x48>
+	list_push(bin_of(mp->mp_npages), mp);
+  802861:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  802865:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  80286a:	39 d0                	cmp    %edx,%eax
+  80286c:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  80286f:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  802876:	8b 14 85 a0 7b 80 00 	mov    0x807ba0(,%eax,4),%edx
+  80287d:	89 53 10             	mov    %edx,0x10(%ebx)
+	if (*head)
+  802880:	85 d2                	test   %edx,%edx
+  802882:	74 03                	je     802887 <span_free+0x3a>
+		(*head)->mp_prev = mp;
+  802884:	89 5a 14             	mov    %ebx,0x14(%edx)
+	*head = mp;
+  802887:	89 1c 85 a0 7b 80 00 	mov    %ebx,0x807ba0(,%eax,4)
+}
+  80288e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802891:	5b                   	pop    %ebx
+  802892:	5e                   	pop    %esi
+  802893:	5d                   	pop    %ebp
+  802894:	c3                   	ret
+	if (mp == mlast && mp->mp_npages >= MTRIM) {
+  802895:	66 83 78 04 1f       	cmpw   $0x1f,0x4(%eax)
+  80289a:	76 c5                	jbe    802861 <span_free+0x14>
+		pgbatch_init(&mbatch);
+  80289c:	83 ec 0c             	sub    $0xc,%esp
+  80289f:	68 60 77 80 00       	push   $0x807760
+  8028a4:	e8 d7 0f 00 00       	call   803880 <pgbatch_init>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  8028a9:	83 c4 10             	add    $0x10,%esp
+  8028ac:	66 83 7b 04 10       	cmpw   $0x10,0x4(%ebx)
+  8028b1:	76 2a                	jbe    8028dd <span_free+0x90>
+  8028b3:	be 10 00 00 00       	mov    $0x10,%esi
+			pgbatch_unmap(&mbatch, 0, (uint8_t *) mp + i * PGSIZE);
+  8028b8:	83 ec 04             	sub    $0x4,%esp
+  8028bb:	89 f0                	mov    %esi,%eax
+  8028bd:	c1 e0 0c             	shl    $0xc,%eax
+  8028c0:	01 d8                	add    %ebx,%eax
+  8028c2:	50                   	push   %eax
+  8028c3:	6a 00                	push   $0x0
+  8028c5:	68 60 77 80 00       	push   $0x807760
+  8028ca:	e8 b2 10 00 00       	call   803981 <pgbatch_unmap>
+		for (i = MGROW; i < mp->mp_npages; i++)
+  8028cf:	83 c6 01             	add    $0x1,%esi
+  8028d2:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  8028d6:	83 c4 10             	add    $0x10,%esp
+  8028d9:	39 f0                	cmp    %esi,%eax
+  8028db:	7f db                	jg     8028b8 <span_free+0x6b>
+		pgbatch_flush(&mbatch);
+  8028dd:	83 ec 0c             	sub    $0xc,%esp
+  8028e0:	68 60 77 80 00       	push   $0x807760
+  8028e5:	e8 a4 0f 00 00       	call   80388e <pgbatch_flush>
+		mstat.ms_arena -= (mp->mp_npages - MGROW) * PGSIZE;
+  8028ea:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  8028ee:	83 e8 10             	sub    $0x10,%eax
+  8028f1:	c1 e0 0c             	shl    $0xc,%eax
+  8028f4:	29 05 80 7a 80 00    	sub    %eax,0x807a80
+		mtop = (uint8_t *) mp + MGROW * PGSIZE;
+  8028fa:	8d 83 00 00 01 00    	lea    0x10000(%ebx),%eax
+  802900:	a3 24 7c 80 00       	mov    %eax,0x807c24
+		mp->mp_npages = MGROW;
+  802905:	66 c7 43 04 10 00    	movw   $0x10,0x4(%ebx)
+  80290b:	83 c4 10             	add    $0x10,%esp
+  80290e:	e9 4e ff ff ff       	jmp    802861 <span_free+0x14>
+
+00802913 <slab_free>:
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	57                   	push   %edi
+  802917:	56                   	push   %esi
+  802918:	53                   	push   %ebx
+  802919:	83 ec 0c             	sub    $0xc,%esp
+  80291c:	89 c3                	mov    %eax,%ebx
+	int c = mp->mp_class;
+  80291e:	0f b6 48 09          	movzbl 0x9(%eax),%ecx
+  802922:	0f b6 f9             	movzbl %cl,%edi
+	*(void **) v = mp->mp_free;
+  802925:	8b 40 0c             	mov    0xc(%eax),%eax
+  802928:	89 02                	mov    %eax,(%edx)
+	mp->mp_free = v;
+  80292a:	89 53 0c             	mov    %edx,0xc(%ebx)
+	mstat.ms_inuse -= mclass_size[c];
+  80292d:	0f b7 b4 3f 20 54 80 	movzwl 0x805420(%edi,%edi,1),%esi
+  802934:	00 
+  802935:	0f b7 c6             	movzwl %si,%eax
+  802938:	29 05 84 7a 80 00    	sub    %eax,0x807a84
+	if (mp->mp_nfree++ == 0)
+  80293e:	0f b7 43 0a          	movzwl 0xa(%ebx),%eax
+  802942:	8d 50 01             	lea    0x1(%eax),%edx
+  802945:	66 89 53 0a          	mov    %dx,0xa(%ebx)
+  802949:	66 85 c0             	test   %ax,%ax
+  80294c:	74 1b                	je     802969 <slab_free+0x56>
+	if (mp->mp_nfree == (PGSIZE - MHDR) / mclass_size[c]
+  80294e:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  802953:	ba 00 00 00 00       	mov    $0x0,%edx
+  802958:	66 f7 f6             	div    %si
+  80295b:	66 39 43 0a          	cmp    %ax,0xa(%ebx)
+  80295f:	74 29                	je     80298a <slab_free+0x77>
+}
+  802961:	83 c4 0c             	add    $0xc,%esp
+  802964:	5b                   	pop    %ebx
+  802965:	5e                   	pop    %esi
+  802966:	5f                   	pop    %edi
+  802967:	5d                   	pop    %ebp
+  802968:	c3                   	ret
+	mp->mp_prev = NULL;
+  802969:	c7 43 14 00 00 00 00 	movl   $0x0,0x14(%ebx)
+	mp->mp_next = *head;
+  802970:	8b 04 bd 40 7b 80 00 	mov    0x807b40(,%edi,4),%eax
+  802977:	89 43 10             	mov    %eax,0x10(%ebx)
+	if (*head)
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	74 03                	je     802981 <slab_free+0x6e>
+		(*head)->mp_prev = mp;
+  80297e:	89 58 14             	mov    %ebx,0x14(%eax)
+	*head = mp;
+  802981:	89 1c bd 40 7b 80 00 	mov    %ebx,0x807b40(,%edi,4)
+}
+  802988:	eb c4                	jmp    80294e <slab_free+0x3b>
+	    && (mp->mp_prev || mp->mp_next)) {
+  80298a:	83 7b 14 00          	cmpl   $0x0,0x14(%ebx)
+  80298e:	74 21                	je     8029b1 <slab_free+0x9e>
+		list_remove(&mslabs[c], mp);
+  802990:	0f b6 c9             	movzbl %cl,%ecx
+  802993:	8d 04 8d 40 7b 80 00 	lea    0x807b40(,%ecx,4),%eax
+  80299a:	89 da                	mov    %ebx,%edx
+  80299c:	e8 0d fd ff ff       	call   8026ae <list_remove>
+		mstat.ms_slabs--;
+  8029a1:	83 2d 88 7a 80 00 01 	subl   $0x1,0x807a88
+		span_free(mp);
+  8029a8:	89 d8                	mov    %ebx,%eax
+  8029aa:	e8 9e fe ff ff       	call   80284d <span_free>
+}
+  8029af:	eb b0                	jmp    802961 <slab_free+0x4e>
+	    && (mp->mp_prev || mp->mp_next)) {
+  8029b1:	83 7b 10 00          	cmpl   $0x0,0x10(%ebx)
+  8029b5:	75 d9                	jne    802990 <slab_free+0x7d>
+  8029b7:	eb a8                	jmp    802961 <slab_free+0x4e>
+
+008029b9 <free_locked>:
+	if (v == 0)
+  8029b9:	85 c0                	test   %eax,%eax
+  8029bb:	74 71                	je     802a2e <free_locked+0x75>
+{
+  8029bd:	55                   	push   %ebp
+  8029be:	89 e5                	mov    %esp,%ebp
+  8029c0:	56                   	push   %esi
+  8029c1:	53                   	push   %ebx
+  8029c2:	89 c3                	mov    %eax,%ebx
+	struct mcache *mc = mcache_cur;
+  8029c4:	8b 35 00 b0 80 00    	mov    0x80b000,%esi
+	mp = span_of(v);
+  8029ca:	e8 72 fd ff ff       	call   802741 <span_of>
+	if (mp->mp_kind == MS_SLAB) {
+  8029cf:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  8029d3:	75 41                	jne    802a16 <free_locked+0x5d>
+		c = mp->mp_class;
+  8029d5:	0f b6 50 09          	movzbl 0x9(%eax),%edx
+		if (mc && mc->mc_n[c] < mcache_max[c]) {
+  8029d9:	85 f6                	test   %esi,%esi
+  8029db:	74 30                	je     802a0d <free_locked+0x54>
+  8029dd:	0f b6 8a a0 7a 80 00 	movzbl 0x807aa0(%edx),%ecx
+  8029e4:	38 4c 16 58          	cmp    %cl,0x58(%esi,%edx,1)
+  8029e8:	73 23                	jae    802a0d <free_locked+0x54>
+			*(void **) v = mc->mc_free[c];
+  8029ea:	8b 04 96             	mov    (%esi,%edx,4),%eax
+  8029ed:	89 03                	mov    %eax,(%ebx)
+			mc->mc_free[c] = v;
+  8029ef:	89 1c 96             	mov    %ebx,(%esi,%edx,4)
+			mc->mc_n[c]++;
+  8029f2:	80 44 16 58 01       	addb   $0x1,0x58(%esi,%edx,1)
+			mstat.ms_cached += mclass_size[c];
+  8029f7:	0f b7 84 12 20 54 80 	movzwl 0x805420(%edx,%edx,1),%eax
+  8029fe:	00 
+  8029ff:	01 05 94 7a 80 00    	add    %eax,0x807a94
+			mstat.ms_inuse -= mclass_size[c];
+  802a05:	29 05 84 7a 80 00    	sub    %eax,0x807a84
+			return;
+  802a0b:	eb 1d                	jmp    802a2a <free_locked+0x71>
+		slab_free(mp, v);
+  802a0d:	89 da                	mov    %ebx,%edx
+  802a0f:	e8 ff fe ff ff       	call   802913 <slab_free>
+		return;
+  802a14:	eb 14                	jmp    802a2a <free_locked+0x71>
+	mstat.ms_inuse -= mp->mp_size;
+  802a16:	8b 15 84 7a 80 00    	mov    0x807a84,%edx
+  802a1c:	2b 50 18             	sub    0x18(%eax),%edx
+  802a1f:	89 15 84 7a 80 00    	mov    %edx,0x807a84
+	span_free(mp);
+  802a25:	e8 23 fe ff ff       	call   80284d <span_free>
+}
+  802a2a:	5b                   	pop    %ebx
+  802a2b:	5e                   	pop    %esi
+  802a2c:	5d                   	pop    %ebp
+  802a2d:	c3                   	ret
+  802a2e:	c3                   	ret
+
+00802a2f <span_alloc>:
+{
+  802a2f:	55                   	push   %ebp
+  802a30:	89 e5                	mov    %esp,%ebp
+  802a32:	57                   	push   %edi
+  802a33:	56                   	push   %esi
+  802a34:	53                   	push   %ebx
+  802a35:	83 ec 1c             	sub    $0x1c,%esp
+  802a38:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	if (npages > 0xFFFF)
+  802a3b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802a40:	0f 8f 08 02 00 00    	jg     802c4e <span_alloc+0x21f>
+  802a46:	89 c6                	mov    %eax,%esi
+	npages = ROUNDUP(MAX(npages, MGROW), MGROW);
+  802a48:	b8 10 00 00 00       	mov    $0x10,%eax
+  802a4d:	39 c6                	cmp    %eax,%esi
+  802a4f:	0f 4d c6             	cmovge %esi,%eax
+  802a52:	89 c7                	mov    %eax,%edi
+  802a54:	83 c7 0f             	add    $0xf,%edi
+  802a57:	83 e7 f0             	and    $0xfffffff0,%edi
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  802a5a:	89 f8                	mov    %edi,%eax
+  802a5c:	c1 e0 0c             	shl    $0xc,%eax
+  802a5f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a62:	e9 30 01 00 00       	jmp    802b97 <span_alloc+0x168>
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  802a67:	83 c2 01             	add    $0x1,%edx
+  802a6a:	83 fa 20             	cmp    $0x20,%edx
+  802a6d:	0f 84 e2 01 00 00    	je     802c55 <span_alloc+0x226>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  802a73:	8b 1c 95 a0 7b 80 00 	mov    0x807ba0(,%edx,4),%ebx
+  802a7a:	85 db                	test   %ebx,%ebx
+  802a7c:	74 e9                	je     802a67 <span_alloc+0x38>
+				if (mp->mp_npages >= npages)
+  802a7e:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  802a82:	39 f0                	cmp    %esi,%eax
+  802a84:	0f 8d f5 01 00 00    	jge    802c7f <span_alloc+0x250>
+			for (mp = mbins[b]; mp; mp = mp->mp_next)
+  802a8a:	8b 5b 10             	mov    0x10(%ebx),%ebx
+  802a8d:	85 db                	test   %ebx,%ebx
+  802a8f:	75 ed                	jne    802a7e <span_alloc+0x4f>
+  802a91:	eb d4                	jmp    802a67 <span_alloc+0x38>
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802a93:	05 00 10 00 00       	add    $0x1000,%eax
+  802a98:	39 c8                	cmp    %ecx,%eax
+  802a9a:	73 32                	jae    802ace <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  802a9c:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802aa1:	0f 87 51 01 00 00    	ja     802bf8 <span_alloc+0x1c9>
+		    || ((vpd[PDX(va)] & PTE_P) && (vpt[PGNUM(va)] & PTE_P)))
+  802aa7:	89 c2                	mov    %eax,%edx
+  802aa9:	c1 ea 16             	shr    $0x16,%edx
+  802aac:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802ab3:	f6 c2 01             	test   $0x1,%dl
+  802ab6:	74 db                	je     802a93 <span_alloc+0x64>
+  802ab8:	89 c2                	mov    %eax,%edx
+  802aba:	c1 ea 0c             	shr    $0xc,%edx
+  802abd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ac4:	f6 c2 01             	test   $0x1,%dl
+  802ac7:	74 ca                	je     802a93 <span_alloc+0x64>
+  802ac9:	e9 2a 01 00 00       	jmp    802bf8 <span_alloc+0x1c9>
+	pgbatch_init(&mbatch);
+  802ace:	83 ec 0c             	sub    $0xc,%esp
+  802ad1:	68 60 77 80 00       	push   $0x807760
+  802ad6:	e8 a5 0d 00 00       	call   803880 <pgbatch_init>
+  802adb:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < npages; i++)
+  802ade:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((r = pgbatch_alloc(&mbatch, 0, mtop + i * PGSIZE,
+  802ae3:	6a 07                	push   $0x7
+  802ae5:	89 d8                	mov    %ebx,%eax
+  802ae7:	c1 e0 0c             	shl    $0xc,%eax
+  802aea:	03 05 24 7c 80 00    	add    0x807c24,%eax
+  802af0:	50                   	push   %eax
+  802af1:	6a 00                	push   $0x0
+  802af3:	68 60 77 80 00       	push   $0x807760
+  802af8:	e8 0a 0e 00 00       	call   803907 <pgbatch_alloc>
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	0f 88 9e 00 00 00    	js     802ba6 <span_alloc+0x177>
+	for (i = 0; i < npages; i++)
+  802b08:	83 c3 01             	add    $0x1,%ebx
+  802b0b:	39 df                	cmp    %ebx,%edi
+  802b0d:	7f d4                	jg     802ae3 <span_alloc+0xb4>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  802b0f:	83 ec 0c             	sub    $0xc,%esp
+  802b12:	68 60 77 80 00       	push   $0x807760
+  802b17:	e8 72 0d 00 00       	call   80388e <pgbatch_flush>
+  802b1c:	83 c4 10             	add    $0x10,%esp
+  802b1f:	85 c0                	test   %eax,%eax
+  802b21:	0f 88 87 00 00 00    	js     802bae <span_alloc+0x17f>
+	mp = (struct mspan *) mtop;
+  802b27:	8b 1d 24 7c 80 00    	mov    0x807c24,%ebx
+	mp->mp_prevpages = mlast ? mlast->mp_npages : 0;
+  802b2d:	8b 15 20 7c 80 00    	mov    0x807c20,%edx
+  802b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b38:	85 d2                	test   %edx,%edx
+  802b3a:	74 04                	je     802b40 <span_alloc+0x111>
+  802b3c:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+  802b40:	66 89 43 06          	mov    %ax,0x6(%ebx)
+	mtop += npages * PGSIZE;
+  802b44:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b47:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+  802b4a:	a3 24 7c 80 00       	mov    %eax,0x807c24
+	mstat.ms_arena += npages * PGSIZE;
+  802b4f:	01 0d 80 7a 80 00    	add    %ecx,0x807a80
+	span_set(mp, npages, MS_FREE);
+  802b55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b5a:	89 fa                	mov    %edi,%edx
+  802b5c:	89 d8                	mov    %ebx,%eax
+  802b5e:	e8 6d fb ff ff       	call   8026d0 <span_set>
+	mp = span_merge(mp);
+  802b63:	89 d8                	mov    %ebx,%eax
+  802b65:	e8 38 fc ff ff       	call   8027a2 <span_merge>
+	list_push(bin_of(mp->mp_npages), mp);
+  802b6a:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+	return &mbins[MIN(npages, MBINS - 1)];
+  802b6e:	b9 1f 00 00 00       	mov    $0x1f,%ecx
+  802b73:	39 ca                	cmp    %ecx,%edx
+  802b75:	0f 4f d1             	cmovg  %ecx,%edx
+	mp->mp_prev = NULL;
+  802b78:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+	mp->mp_next = *head;
+  802b7f:	8b 0c 95 a0 7b 80 00 	mov    0x807ba0(,%edx,4),%ecx
+  802b86:	89 48 10             	mov    %ecx,0x10(%eax)
+	if (*head)
+  802b89:	85 c9                	test   %ecx,%ecx
+  802b8b:	74 03                	je     802b90 <span_alloc+0x161>
+		(*head)->mp_prev = mp;
+  802b8d:	89 41 14             	mov    %eax,0x14(%ecx)
+	*head = mp;
+  802b90:	89 04 95 a0 7b 80 00 	mov    %eax,0x807ba0(,%edx,4)
+		for (b = MIN(npages, MBINS - 1); b < MBINS && !mp; b++)
+  802b97:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  802b9c:	39 d6                	cmp    %edx,%esi
+  802b9e:	0f 4e d6             	cmovle %esi,%edx
+  802ba1:	e9 cd fe ff ff       	jmp    802a73 <span_alloc+0x44>
+	if (i < npages || (r = pgbatch_flush(&mbatch)) < 0) {
+  802ba6:	39 fb                	cmp    %edi,%ebx
+  802ba8:	0f 8d 61 ff ff ff    	jge    802b0f <span_alloc+0xe0>
+		pgbatch_init(&mbatch);
+  802bae:	83 ec 0c             	sub    $0xc,%esp
+  802bb1:	68 60 77 80 00       	push   $0x807760
+  802bb6:	e8 c5 0c 00 00       	call   803880 <pgbatch_init>
+  802bbb:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < npages; i++)
+  802bbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+			pgbatch_unmap(&mbatch, 0, mtop + i * PGSIZE);
+  802bc3:	83 ec 04             	sub    $0x4,%esp
+  802bc6:	89 d8                	mov    %ebx,%eax
+  802bc8:	c1 e0 0c             	shl    $0xc,%eax
+  802bcb:	03 05 24 7c 80 00    	add    0x807c24,%eax
+  802bd1:	50                   	push   %eax
+  802bd2:	6a 00                	push   $0x0
+  802bd4:	68 60 77 80 00       	push   $0x807760
+  802bd9:	e8 a3 0d 00 00       	call   803981 <pgbatch_unmap>
+		for (i = 0; i < npages; i++)
+  802bde:	83 c3 01             	add    $0x1,%ebx
+  802be1:	83 c4 10             	add    $0x10,%esp
+  802be4:	39 df                	cmp    %ebx,%edi
+  802be6:	7f db                	jg     802bc3 <span_alloc+0x194>
+		pgbatch_flush(&mbatch);
+  802be8:	83 ec 0c             	sub    $0xc,%esp
+  802beb:	68 60 77 80 00       	push   $0x807760
+  802bf0:	e8 99 0c 00 00       	call   80388e <pgbatch_flush>
+		return r < 0 ? r : -E_NO_MEM;
+  802bf5:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  802bf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bfd:	e9 b1 00 00 00       	jmp    802cb3 <span_alloc+0x284>
+		rest = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  802c02:	89 f7                	mov    %esi,%edi
+  802c04:	c1 e7 0c             	shl    $0xc,%edi
+  802c07:	01 df                	add    %ebx,%edi
+		rest->mp_prevpages = npages;
+  802c09:	66 89 77 06          	mov    %si,0x6(%edi)
+		span_set(rest, mp->mp_npages - npages, MS_FREE);
+  802c0d:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  802c11:	29 f2                	sub    %esi,%edx
+  802c13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c18:	89 f8                	mov    %edi,%eax
+  802c1a:	e8 b1 fa ff ff       	call   8026d0 <span_set>
+		list_push(bin_of(rest->mp_npages), rest);
+  802c1f:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  802c23:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  802c28:	39 d0                	cmp    %edx,%eax
+  802c2a:	0f 4f c2             	cmovg  %edx,%eax
+	mp->mp_prev = NULL;
+  802c2d:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+	mp->mp_next = *head;
+  802c34:	8b 14 85 a0 7b 80 00 	mov    0x807ba0(,%eax,4),%edx
+  802c3b:	89 57 10             	mov    %edx,0x10(%edi)
+	if (*head)
+  802c3e:	85 d2                	test   %edx,%edx
+  802c40:	74 03                	je     802c45 <span_alloc+0x216>
+		(*head)->mp_prev = mp;
+  802c42:	89 7a 14             	mov    %edi,0x14(%edx)
+	*head = mp;
+  802c45:	89 3c 85 a0 7b 80 00 	mov    %edi,0x807ba0(,%eax,4)
+}
+  802c4c:	eb 59                	jmp    802ca7 <span_alloc+0x278>
+		return NULL;
+  802c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c53:	eb 5e                	jmp    802cb3 <span_alloc+0x284>
+	if (npages > 0xFFFF || !isfree(mtop, npages * PGSIZE))
+  802c55:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802c5b:	7f 9b                	jg     802bf8 <span_alloc+0x1c9>
+	uintptr_t va, end_va = (uintptr_t) v + n;
+  802c5d:	a1 24 7c 80 00       	mov    0x807c24,%eax
+  802c62:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802c65:	01 c1                	add    %eax,%ecx
+	for (va = (uintptr_t) v; va < end_va; va += PGSIZE)
+  802c67:	39 c8                	cmp    %ecx,%eax
+  802c69:	0f 83 5f fe ff ff    	jae    802ace <span_alloc+0x9f>
+		if (va >= (uintptr_t) mend
+  802c6f:	3d ff ff ff 0f       	cmp    $0xfffffff,%eax
+  802c74:	0f 86 2d fe ff ff    	jbe    802aa7 <span_alloc+0x78>
+  802c7a:	e9 79 ff ff ff       	jmp    802bf8 <span_alloc+0x1c9>
+	bin = bin_of(mp->mp_npages);
+  802c7f:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+	return &mbins[MIN(npages, MBINS - 1)];
+  802c83:	ba 1f 00 00 00       	mov    $0x1f,%edx
+  802c88:	39 d0                	cmp    %edx,%eax
+  802c8a:	0f 4f c2             	cmovg  %edx,%eax
+  802c8d:	8d 04 85 a0 7b 80 00 	lea    0x807ba0(,%eax,4),%eax
+	list_remove(bin, mp);
+  802c94:	89 da                	mov    %ebx,%edx
+  802c96:	e8 13 fa ff ff       	call   8026ae <list_remove>
+	if (mp->mp_npages > npages) {
+  802c9b:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  802c9f:	39 f0                	cmp    %esi,%eax
+  802ca1:	0f 8f 5b ff ff ff    	jg     802c02 <span_alloc+0x1d3>
+	span_set(mp, npages, kind);
+  802ca7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802caa:	89 f2                	mov    %esi,%edx
+  802cac:	89 d8                	mov    %ebx,%eax
+  802cae:	e8 1d fa ff ff       	call   8026d0 <span_set>
+}
+  802cb3:	89 d8                	mov    %ebx,%eax
+  802cb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb8:	5b                   	pop    %ebx
+  802cb9:	5e                   	pop    %esi
+  802cba:	5f                   	pop    %edi
+  802cbb:	5d                   	pop    %ebp
+  802cbc:	c3                   	ret
+
+00802cbd <malloc_locked>:
+{
+  802cbd:	55                   	push   %ebp
+  802cbe:	89 e5                	mov    %esp,%ebp
+  802cc0:	57                   	push   %edi
+  802cc1:	56                   	push   %esi
+  802cc2:	53                   	push   %ebx
+  802cc3:	83 ec 1c             	sub    $0x1c,%esp
+  802cc6:	89 c7                	mov    %eax,%edi
+	struct mcache *mc = mcache_cur;
+  802cc8:	8b 35 00 b0 80 00    	mov    0x80b000,%esi
+	if (mtop == 0)
+  802cce:	83 3d 24 7c 80 00 00 	cmpl   $0x0,0x807c24
+  802cd5:	74 63                	je     802d3a <malloc_locked+0x7d>
+	mstat.ms_nmalloc++;
+  802cd7:	83 05 98 7a 80 00 01 	addl   $0x1,0x807a98
+	if (n <= SMALL_MAX) {
+  802cde:	81 ff f0 07 00 00    	cmp    $0x7f0,%edi
+  802ce4:	0f 87 cb 01 00 00    	ja     802eb5 <malloc_locked+0x1f8>
+		c = mclass_of[(n + 15) / 16];
+  802cea:	8d 47 0f             	lea    0xf(%edi),%eax
+  802ced:	c1 e8 04             	shr    $0x4,%eax
+  802cf0:	0f b6 80 c0 7a 80 00 	movzbl 0x807ac0(%eax),%eax
+  802cf7:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  802cfa:	0f b6 f8             	movzbl %al,%edi
+		if (mc && (v = mc->mc_free[c])) {
+  802cfd:	85 f6                	test   %esi,%esi
+  802cff:	0f 84 c7 00 00 00    	je     802dcc <malloc_locked+0x10f>
+  802d05:	8b 1c be             	mov    (%esi,%edi,4),%ebx
+  802d08:	85 db                	test   %ebx,%ebx
+  802d0a:	0f 84 bc 00 00 00    	je     802dcc <malloc_locked+0x10f>
+			mc->mc_free[c] = *(void **) v;
+  802d10:	8b 03                	mov    (%ebx),%eax
+  802d12:	89 04 be             	mov    %eax,(%esi,%edi,4)
+			mc->mc_n[c]--;
+  802d15:	80 6c 3e 58 01       	subb   $0x1,0x58(%esi,%edi,1)
+			mstat.ms_cachehits++;
+  802d1a:	83 05 9c 7a 80 00 01 	addl   $0x1,0x807a9c
+			mstat.ms_cached -= mclass_size[c];
+  802d21:	0f b7 84 3f 20 54 80 	movzwl 0x805420(%edi,%edi,1),%eax
+  802d28:	00 
+  802d29:	29 05 94 7a 80 00    	sub    %eax,0x807a94
+			mstat.ms_inuse += mclass_size[c];
+  802d2f:	01 05 84 7a 80 00    	add    %eax,0x807a84
+			return v;
+  802d35:	e9 ad 01 00 00       	jmp    802ee7 <malloc_locked+0x22a>
+	mtop = mbegin;
+  802d3a:	c7 05 24 7c 80 00 00 	movl   $0x8000000,0x807c24
+  802d41:	00 00 08 
+  802d44:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  802d49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d53:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802d56:	eb 23                	jmp    802d7b <malloc_locked+0xbe>
+			c++;
+  802d58:	83 c0 01             	add    $0x1,%eax
+		while (mclass_size[c] < i * 16)
+  802d5b:	0f b7 9c 00 20 54 80 	movzwl 0x805420(%eax,%eax,1),%ebx
+  802d62:	00 
+  802d63:	39 f3                	cmp    %esi,%ebx
+  802d65:	7c f1                	jl     802d58 <malloc_locked+0x9b>
+		mclass_of[i] = c;
+  802d67:	88 82 c0 7a 80 00    	mov    %al,0x807ac0(%edx)
+	for (c = 0, i = 0; i <= SMALL_MAX / 16; i++) {
+  802d6d:	83 c2 01             	add    $0x1,%edx
+  802d70:	83 c1 10             	add    $0x10,%ecx
+  802d73:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  802d79:	74 10                	je     802d8b <malloc_locked+0xce>
+		while (mclass_size[c] < i * 16)
+  802d7b:	89 ce                	mov    %ecx,%esi
+  802d7d:	0f b7 9c 00 20 54 80 	movzwl 0x805420(%eax,%eax,1),%ebx
+  802d84:	00 
+  802d85:	39 cb                	cmp    %ecx,%ebx
+  802d87:	7c cf                	jl     802d58 <malloc_locked+0x9b>
+  802d89:	eb dc                	jmp    802d67 <malloc_locked+0xaa>
+	for (c = 0; c < NCLASS; c++)
+  802d8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+		mcache_max[c] = MIN(MCACHE_MAX,
+  802d90:	bb 00 08 00 00       	mov    $0x800,%ebx
+  802d95:	0f b7 b4 09 20 54 80 	movzwl 0x805420(%ecx,%ecx,1),%esi
+  802d9c:	00 
+  802d9d:	89 d8                	mov    %ebx,%eax
+  802d9f:	99                   	cltd
+  802da0:	f7 fe                	idiv   %esi
+  802da2:	85 c0                	test   %eax,%eax
+  802da4:	ba 01 00 00 00       	mov    $0x1,%edx
+  802da9:	0f 4e c2             	cmovle %edx,%eax
+  802dac:	ba 10 00 00 00       	mov    $0x10,%edx
+  802db1:	39 d0                	cmp    %edx,%eax
+  802db3:	0f 4f c2             	cmovg  %edx,%eax
+  802db6:	88 81 a0 7a 80 00    	mov    %al,0x807aa0(%ecx)
+	for (c = 0; c < NCLASS; c++)
+  802dbc:	83 c1 01             	add    $0x1,%ecx
+  802dbf:	83 f9 16             	cmp    $0x16,%ecx
+  802dc2:	75 d1                	jne    802d95 <malloc_locked+0xd8>
+  802dc4:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802dc7:	e9 0b ff ff ff       	jmp    802cd7 <malloc_locked+0x1a>
+	int i, size = mclass_size[c];
+  802dcc:	0f b7 b4 3f 20 54 80 	movzwl 0x805420(%edi,%edi,1),%esi
+  802dd3:	00 
+	if (!(mp = mslabs[c])) {
+  802dd4:	8b 0c bd 40 7b 80 00 	mov    0x807b40(,%edi,4),%ecx
+  802ddb:	85 c9                	test   %ecx,%ecx
+  802ddd:	74 2a                	je     802e09 <malloc_locked+0x14c>
+	obj = mp->mp_free;
+  802ddf:	8b 59 0c             	mov    0xc(%ecx),%ebx
+	mp->mp_free = *(void **) obj;
+  802de2:	8b 03                	mov    (%ebx),%eax
+  802de4:	89 41 0c             	mov    %eax,0xc(%ecx)
+	if (--mp->mp_nfree == 0)
+  802de7:	0f b7 41 0a          	movzwl 0xa(%ecx),%eax
+  802deb:	83 e8 01             	sub    $0x1,%eax
+  802dee:	66 89 41 0a          	mov    %ax,0xa(%ecx)
+  802df2:	66 85 c0             	test   %ax,%ax
+  802df5:	0f 84 a3 00 00 00    	je     802e9e <malloc_locked+0x1e1>
+	mstat.ms_inuse += size;
+  802dfb:	0f b7 f6             	movzwl %si,%esi
+  802dfe:	01 35 84 7a 80 00    	add    %esi,0x807a84
+	return obj;
+  802e04:	e9 de 00 00 00       	jmp    802ee7 <malloc_locked+0x22a>
+		if (!(mp = span_alloc(1, MS_SLAB)))
+  802e09:	ba 02 00 00 00       	mov    $0x2,%edx
+  802e0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e13:	e8 17 fc ff ff       	call   802a2f <span_alloc>
+  802e18:	89 c1                	mov    %eax,%ecx
+  802e1a:	85 c0                	test   %eax,%eax
+  802e1c:	0f 84 cf 00 00 00    	je     802ef1 <malloc_locked+0x234>
+		mp->mp_class = c;
+  802e22:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  802e26:	88 41 09             	mov    %al,0x9(%ecx)
+		mp->mp_free = NULL;
+  802e29:	c7 41 0c 00 00 00 00 	movl   $0x0,0xc(%ecx)
+		mp->mp_nfree = 0;
+  802e30:	66 c7 41 0a 00 00    	movw   $0x0,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  802e36:	0f b7 de             	movzwl %si,%ebx
+  802e39:	b8 e0 0f 00 00       	mov    $0xfe0,%eax
+  802e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e43:	f7 f3                	div    %ebx
+  802e45:	83 e8 01             	sub    $0x1,%eax
+  802e48:	89 c3                	mov    %eax,%ebx
+  802e4a:	78 27                	js     802e73 <malloc_locked+0x1b6>
+	int i, size = mclass_size[c];
+  802e4c:	0f b7 c6             	movzwl %si,%eax
+  802e4f:	0f af c3             	imul   %ebx,%eax
+  802e52:	8d 44 01 20          	lea    0x20(%ecx,%eax,1),%eax
+  802e56:	0f b7 d6             	movzwl %si,%edx
+  802e59:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			*(void **) obj = mp->mp_free;
+  802e5c:	8b 51 0c             	mov    0xc(%ecx),%edx
+  802e5f:	89 10                	mov    %edx,(%eax)
+			mp->mp_free = obj;
+  802e61:	89 41 0c             	mov    %eax,0xc(%ecx)
+			mp->mp_nfree++;
+  802e64:	66 83 41 0a 01       	addw   $0x1,0xa(%ecx)
+		for (i = (PGSIZE - MHDR) / size - 1; i >= 0; i--) {
+  802e69:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802e6c:	29 d0                	sub    %edx,%eax
+  802e6e:	83 eb 01             	sub    $0x1,%ebx
+  802e71:	79 e9                	jns    802e5c <malloc_locked+0x19f>
+	mp->mp_prev = NULL;
+  802e73:	c7 41 14 00 00 00 00 	movl   $0x0,0x14(%ecx)
+	mp->mp_next = *head;
+  802e7a:	8b 04 bd 40 7b 80 00 	mov    0x807b40(,%edi,4),%eax
+  802e81:	89 41 10             	mov    %eax,0x10(%ecx)
+	if (*head)
+  802e84:	85 c0                	test   %eax,%eax
+  802e86:	74 03                	je     802e8b <malloc_locked+0x1ce>
+		(*head)->mp_prev = mp;
+  802e88:	89 48 14             	mov    %ecx,0x14(%eax)
+	*head = mp;
+  802e8b:	89 0c bd 40 7b 80 00 	mov    %ecx,0x807b40(,%edi,4)
+		mstat.ms_slabs++;
+  802e92:	83 05 88 7a 80 00 01 	addl   $0x1,0x807a88
+  802e99:	e9 41 ff ff ff       	jmp    802ddf <malloc_locked+0x122>
+		list_remove(&mslabs[c], mp);
+  802e9e:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+  802ea2:	8d 04 85 40 7b 80 00 	lea    0x807b40(,%eax,4),%eax
+  802ea9:	89 ca                	mov    %ecx,%edx
+  802eab:	e8 fe f7 ff ff       	call   8026ae <list_remove>
+  802eb0:	e9 46 ff ff ff       	jmp    802dfb <malloc_locked+0x13e>
+		return 0;
+  802eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (n > (size_t) (mend - mbegin))
+  802eba:	81 ff 00 00 00 08    	cmp    $0x8000000,%edi
+  802ec0:	77 25                	ja     802ee7 <malloc_locked+0x22a>
+	if (!(mp = span_alloc(ROUNDUP(n + MHDR, PGSIZE) / PGSIZE, MS_LARGE)))
+  802ec2:	8d 87 1f 10 00 00    	lea    0x101f(%edi),%eax
+  802ec8:	c1 e8 0c             	shr    $0xc,%eax
+  802ecb:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ed0:	e8 5a fb ff ff       	call   802a2f <span_alloc>
+  802ed5:	89 c3                	mov    %eax,%ebx
+  802ed7:	85 c0                	test   %eax,%eax
+  802ed9:	74 0c                	je     802ee7 <malloc_locked+0x22a>
+	mp->mp_size = n;
+  802edb:	89 78 18             	mov    %edi,0x18(%eax)
+	mstat.ms_inuse += n;
+  802ede:	01 3d 84 7a 80 00    	add    %edi,0x807a84
+	return (uint8_t *) mp + MHDR;
+  802ee4:	83 c3 20             	add    $0x20,%ebx
+}
+  802ee7:	89 d8                	mov    %ebx,%eax
+  802ee9:	83 c4 1c             	add    $0x1c,%esp
+  802eec:	5b                   	pop    %ebx
+  802eed:	5e                   	pop    %esi
+  802eee:	5f                   	pop    %edi
+  802eef:	5d                   	pop    %ebp
+  802ef0:	c3                   	ret
+			return NULL;
+  802ef1:	89 c3                	mov    %eax,%ebx
+  802ef3:	eb f2                	jmp    802ee7 <malloc_locked+0x22a>
+
+00802ef5 <malloc>:
+
+void *
+malloc(size_t n)
+{
+  802ef5:	55                   	push   %ebp
+  802ef6:	89 e5                	mov    %esp,%ebp
+  802ef8:	53                   	push   %ebx
+  802ef9:	83 ec 04             	sub    $0x4,%esp
+	void *v;
+
+	mlock_acquire();
+  802efc:	e8 02 f8 ff ff       	call   802703 <mlock_acquire>
+	v = malloc_locked(n);
+  802f01:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f04:	e8 b4 fd ff ff       	call   802cbd <malloc_locked>
+  802f09:	89 c3                	mov    %eax,%ebx
+	mlock_release();
+  802f0b:	e8 12 f8 ff ff       	call   802722 <mlock_release>
+	return v;
+}
+  802f10:	89 d8                	mov    %ebx,%eax
+  802f12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f15:	c9                   	leave
+  802f16:	c3                   	ret
+
+00802f17 <free>:
+
+void
+free(void *v)
+{
+  802f17:	55                   	push   %ebp
+  802f18:	89 e5                	mov    %esp,%ebp
+  802f1a:	83 ec 08             	sub    $0x8,%esp
+	mlock_acquire();
+  802f1d:	e8 e1 f7 ff ff       	call   802703 <mlock_acquire>
+	free_locked(v);
+  802f22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f25:	e8 8f fa ff ff       	call   8029b9 <free_locked>
+	mlock_release();
+  802f2a:	e8 f3 f7 ff ff       	call   802722 <mlock_release>
+}
+  802f2f:	c9                   	leave
+  802f30:	c3                   	ret
+
+00802f31 <mcache_flush>:
+
+// Give the objects in 'mc' back to their slabs, as a thread that owns
+// it does before it goes away.
+void
+mcache_flush(struct mcache *mc)
+{
+  802f31:	55                   	push   %ebp
+  802f32:	89 e5                	mov    %esp,%ebp
+  802f34:	57                   	push   %edi
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+  802f37:	83 ec 1c             	sub    $0x1c,%esp
+  802f3a:	8b 75 08             	mov    0x8(%ebp),%esi
+	void *v;
+	int c;
+
+	mlock_acquire();
+  802f3d:	e8 c1 f7 ff ff       	call   802703 <mlock_acquire>
+	for (c = 0; c < NCLASS; c++)
+  802f42:	89 f1                	mov    %esi,%ecx
+  802f44:	83 c6 58             	add    $0x58,%esi
+  802f47:	ba 20 54 80 00       	mov    $0x805420,%edx
+  802f4c:	eb 4a                	jmp    802f98 <mcache_flush+0x67>
+  802f4e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802f51:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+		while ((v = mc->mc_free[c])) {
+			mc->mc_free[c] = *(void **) v;
+  802f54:	8b 03                	mov    (%ebx),%eax
+  802f56:	89 07                	mov    %eax,(%edi)
+			mc->mc_n[c]--;
+  802f58:	80 2e 01             	subb   $0x1,(%esi)
+			mstat.ms_cached -= mclass_size[c];
+  802f5b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f5e:	0f b7 00             	movzwl (%eax),%eax
+  802f61:	29 05 94 7a 80 00    	sub    %eax,0x807a94
+			mstat.ms_inuse += mclass_size[c];
+  802f67:	01 05 84 7a 80 00    	add    %eax,0x807a84
+			slab_free(span_of(v), v);
+  802f6d:	89 d8                	mov    %ebx,%eax
+  802f6f:	e8 cd f7 ff ff       	call   802741 <span_of>
+  802f74:	89 da                	mov    %ebx,%edx
+  802f76:	e8 98 f9 ff ff       	call   802913 <slab_free>
+		while ((v = mc->mc_free[c])) {
+  802f7b:	8b 1f                	mov    (%edi),%ebx
+  802f7d:	85 db                	test   %ebx,%ebx
+  802f7f:	75 d3                	jne    802f54 <mcache_flush+0x23>
+  802f81:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f84:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+	for (c = 0; c < NCLASS; c++)
+  802f87:	83 c1 04             	add    $0x4,%ecx
+  802f8a:	83 c6 01             	add    $0x1,%esi
+  802f8d:	83 c2 02             	add    $0x2,%edx
+  802f90:	81 fa 4c 54 80 00    	cmp    $0x80544c,%edx
+  802f96:	74 0a                	je     802fa2 <mcache_flush+0x71>
+		while ((v = mc->mc_free[c])) {
+  802f98:	89 cf                	mov    %ecx,%edi
+  802f9a:	8b 19                	mov    (%ecx),%ebx
+  802f9c:	85 db                	test   %ebx,%ebx
+  802f9e:	75 ae                	jne    802f4e <mcache_flush+0x1d>
+  802fa0:	eb e5                	jmp    802f87 <mcache_flush+0x56>
+		}
+	mlock_release();
+  802fa2:	e8 7b f7 ff ff       	call   802722 <mlock_release>
+}
+  802fa7:	83 c4 1c             	add    $0x1c,%esp
+  802faa:	5b                   	pop    %ebx
+  802fab:	5e                   	pop    %esi
+  802fac:	5f                   	pop    %edi
+  802fad:	5d                   	pop    %ebp
+  802fae:	c3                   	ret
+
+00802faf <calloc>:
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+  802faf:	55                   	push   %ebp
+  802fb0:	89 e5                	mov    %esp,%ebp
+  802fb2:	56                   	push   %esi
+  802fb3:	53                   	push   %ebx
+  802fb4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802fb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	void *v;
+
+	if (size && nmemb > (size_t) -1 / size)
+  802fba:	85 c9                	test   %ecx,%ecx
+  802fbc:	74 06                	je     802fc4 <calloc+0x15>
+  802fbe:	89 c8                	mov    %ecx,%eax
+  802fc0:	f7 e3                	mul    %ebx
+  802fc2:	70 2d                	jo     802ff1 <calloc+0x42>
+		return 0;
+	if ((v = malloc(nmemb * size)))
+  802fc4:	0f af d9             	imul   %ecx,%ebx
+  802fc7:	83 ec 0c             	sub    $0xc,%esp
+  802fca:	53                   	push   %ebx
+  802fcb:	e8 25 ff ff ff       	call   802ef5 <malloc>
+  802fd0:	89 c6                	mov    %eax,%esi
+  802fd2:	83 c4 10             	add    $0x10,%esp
+  802fd5:	85 c0                	test   %eax,%eax
+  802fd7:	74 0f                	je     802fe8 <calloc+0x39>
+		memset(v, 0, nmemb * size);
+  802fd9:	83 ec 04             	sub    $0x4,%esp
+  802fdc:	53                   	push   %ebx
+  802fdd:	6a 00                	push   $0x0
+  802fdf:	50                   	push   %eax
+  802fe0:	e8 5d d4 ff ff       	call   800442 <memset>
+  802fe5:	83 c4 10             	add    $0x10,%esp
+	return v;
+}
+  802fe8:	89 f0                	mov    %esi,%eax
+  802fea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fed:	5b                   	pop    %ebx
+  802fee:	5e                   	pop    %esi
+  802fef:	5d                   	pop    %ebp
+  802ff0:	c3                   	ret
+		return 0;
+  802ff1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff6:	eb f0                	jmp    802fe8 <calloc+0x39>
+
+00802ff8 <realloc>:
+	return nv;
+}
+
+void *
+realloc(void *v, size_t n)
+{
+  802ff8:	55                   	push   %ebp
+  802ff9:	89 e5                	mov    %esp,%ebp
+  802ffb:	57                   	push   %edi
+  802ffc:	56                   	push   %esi
+  802ffd:	53                   	push   %ebx
+  802ffe:	83 ec 1c             	sub    $0x1c,%esp
+  803001:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	mlock_acquire();
+  803004:	e8 fa f6 ff ff       	call   802703 <mlock_acquire>
+	if (v == 0)
+  803009:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80300d:	74 71                	je     803080 <realloc+0x88>
+	if (n == 0) {
+  80300f:	85 db                	test   %ebx,%ebx
+  803011:	74 7b                	je     80308e <realloc+0x96>
+	mp = span_of(v);
+  803013:	8b 45 08             	mov    0x8(%ebp),%eax
+  803016:	e8 26 f7 ff ff       	call   802741 <span_of>
+  80301b:	89 c6                	mov    %eax,%esi
+	if (mp->mp_kind == MS_SLAB) {
+  80301d:	80 78 08 02          	cmpb   $0x2,0x8(%eax)
+  803021:	74 7d                	je     8030a0 <realloc+0xa8>
+		npages = ROUNDUP(n + MHDR, PGSIZE) / PGSIZE;
+  803023:	8d 83 1f 10 00 00    	lea    0x101f(%ebx),%eax
+  803029:	89 c1                	mov    %eax,%ecx
+  80302b:	c1 e9 0c             	shr    $0xc,%ecx
+  80302e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	uint8_t *next = (uint8_t *) mp + mp->mp_npages * PGSIZE;
+  803031:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  803035:	89 c7                	mov    %eax,%edi
+  803037:	c1 e7 0c             	shl    $0xc,%edi
+  80303a:	01 f7                	add    %esi,%edi
+	return next < mtop ? (struct mspan *) next : NULL;
+  80303c:	3b 3d 24 7c 80 00    	cmp    0x807c24,%edi
+  803042:	0f 83 13 01 00 00    	jae    80315b <realloc+0x163>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  803048:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  80304e:	0f 86 1c 01 00 00    	jbe    803170 <realloc+0x178>
+  803054:	39 c1                	cmp    %eax,%ecx
+  803056:	7f 7d                	jg     8030d5 <realloc+0xdd>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  803058:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+			if (npages < mp->mp_npages) {
+  80305c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80305f:	0f 8c b8 00 00 00    	jl     80311d <realloc+0x125>
+			mstat.ms_inuse += n - mp->mp_size;
+  803065:	89 d8                	mov    %ebx,%eax
+  803067:	03 05 84 7a 80 00    	add    0x807a84,%eax
+  80306d:	2b 46 18             	sub    0x18(%esi),%eax
+  803070:	a3 84 7a 80 00       	mov    %eax,0x807a84
+			mp->mp_size = n;
+  803075:	89 5e 18             	mov    %ebx,0x18(%esi)
+			return v;
+  803078:	8b 75 08             	mov    0x8(%ebp),%esi
+  80307b:	e9 1d 01 00 00       	jmp    80319d <realloc+0x1a5>
+		return malloc_locked(n);
+  803080:	89 d8                	mov    %ebx,%eax
+  803082:	e8 36 fc ff ff       	call   802cbd <malloc_locked>
+  803087:	89 c6                	mov    %eax,%esi
+  803089:	e9 0f 01 00 00       	jmp    80319d <realloc+0x1a5>
+		free_locked(v);
+  80308e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803091:	e8 23 f9 ff ff       	call   8029b9 <free_locked>
+		return 0;
+  803096:	be 00 00 00 00       	mov    $0x0,%esi
+  80309b:	e9 fd 00 00 00       	jmp    80319d <realloc+0x1a5>
+		have = mclass_size[mp->mp_class];
+  8030a0:	0f b6 40 09          	movzbl 0x9(%eax),%eax
+  8030a4:	0f b6 d0             	movzbl %al,%edx
+  8030a7:	0f b7 bc 12 20 54 80 	movzwl 0x805420(%edx,%edx,1),%edi
+  8030ae:	00 
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  8030af:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  8030b5:	0f 87 b8 00 00 00    	ja     803173 <realloc+0x17b>
+  8030bb:	8d 53 0f             	lea    0xf(%ebx),%edx
+  8030be:	c1 ea 04             	shr    $0x4,%edx
+			return v;
+  8030c1:	8b 75 08             	mov    0x8(%ebp),%esi
+		if (n <= SMALL_MAX && mclass_of[(n + 15) / 16] == mp->mp_class)
+  8030c4:	3a 82 c0 7a 80 00    	cmp    0x807ac0(%edx),%al
+  8030ca:	0f 85 a3 00 00 00    	jne    803173 <realloc+0x17b>
+  8030d0:	e9 c8 00 00 00       	jmp    80319d <realloc+0x1a5>
+		    && next->mp_kind == MS_FREE
+  8030d5:	80 7f 08 00          	cmpb   $0x0,0x8(%edi)
+  8030d9:	0f 85 91 00 00 00    	jne    803170 <realloc+0x178>
+		    && mp->mp_npages + next->mp_npages >= npages) {
+  8030df:	0f b7 57 04          	movzwl 0x4(%edi),%edx
+  8030e3:	01 d0                	add    %edx,%eax
+  8030e5:	39 c1                	cmp    %eax,%ecx
+  8030e7:	0f 8f 83 00 00 00    	jg     803170 <realloc+0x178>
+	return &mbins[MIN(npages, MBINS - 1)];
+  8030ed:	b8 1f 00 00 00       	mov    $0x1f,%eax
+  8030f2:	39 c2                	cmp    %eax,%edx
+  8030f4:	0f 4f d0             	cmovg  %eax,%edx
+  8030f7:	8d 04 95 a0 7b 80 00 	lea    0x807ba0(,%edx,4),%eax
+			list_remove(bin_of(next->mp_npages), next);
+  8030fe:	89 fa                	mov    %edi,%edx
+  803100:	e8 a9 f5 ff ff       	call   8026ae <list_remove>
+			span_set(mp, mp->mp_npages + next->mp_npages, MS_LARGE);
+  803105:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  803109:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+  80310d:	01 c2                	add    %eax,%edx
+  80310f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803114:	89 f0                	mov    %esi,%eax
+  803116:	e8 b5 f5 ff ff       	call   8026d0 <span_set>
+  80311b:	eb 46                	jmp    803163 <realloc+0x16b>
+				next = (struct mspan *) ((uint8_t *) mp + npages * PGSIZE);
+  80311d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803120:	89 d0                	mov    %edx,%eax
+  803122:	c1 e0 0c             	shl    $0xc,%eax
+  803125:	8d 3c 06             	lea    (%esi,%eax,1),%edi
+				next->mp_prevpages = npages;
+  803128:	89 d0                	mov    %edx,%eax
+  80312a:	66 89 57 06          	mov    %dx,0x6(%edi)
+				span_set(next, mp->mp_npages - npages, MS_FREE);
+  80312e:	0f b7 56 04          	movzwl 0x4(%esi),%edx
+  803132:	29 c2                	sub    %eax,%edx
+  803134:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803139:	89 f8                	mov    %edi,%eax
+  80313b:	e8 90 f5 ff ff       	call   8026d0 <span_set>
+				span_set(mp, npages, MS_LARGE);
+  803140:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803145:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803148:	89 f0                	mov    %esi,%eax
+  80314a:	e8 81 f5 ff ff       	call   8026d0 <span_set>
+				span_free(next);
+  80314f:	89 f8                	mov    %edi,%eax
+  803151:	e8 f7 f6 ff ff       	call   80284d <span_free>
+  803156:	e9 0a ff ff ff       	jmp    803065 <realloc+0x6d>
+		if (n > SMALL_MAX && npages > mp->mp_npages && next
+  80315b:	81 fb f0 07 00 00    	cmp    $0x7f0,%ebx
+  803161:	76 0d                	jbe    803170 <realloc+0x178>
+		if (n > SMALL_MAX && npages <= mp->mp_npages) {
+  803163:	0f b7 46 04          	movzwl 0x4(%esi),%eax
+  803167:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80316a:	0f 8e ec fe ff ff    	jle    80305c <realloc+0x64>
+		have = mp->mp_size;
+  803170:	8b 7e 18             	mov    0x18(%esi),%edi
+	if (!(nv = malloc_locked(n)))
+  803173:	89 d8                	mov    %ebx,%eax
+  803175:	e8 43 fb ff ff       	call   802cbd <malloc_locked>
+  80317a:	89 c6                	mov    %eax,%esi
+  80317c:	85 c0                	test   %eax,%eax
+  80317e:	74 1d                	je     80319d <realloc+0x1a5>
+	memmove(nv, v, MIN(have, n));
+  803180:	83 ec 04             	sub    $0x4,%esp
+  803183:	39 fb                	cmp    %edi,%ebx
+  803185:	0f 46 fb             	cmovbe %ebx,%edi
+  803188:	57                   	push   %edi
+  803189:	ff 75 08             	push   0x8(%ebp)
+  80318c:	50                   	push   %eax
+  80318d:	e8 e5 d2 ff ff       	call   800477 <memmove>
+	free_locked(v);
+  803192:	8b 45 08             	mov    0x8(%ebp),%eax
+  803195:	e8 1f f8 ff ff       	call   8029b9 <free_locked>
+	return nv;
+  80319a:	83 c4 10             	add    $0x10,%esp
+	v = realloc_locked(v, n);
+	mlock_release();
+  80319d:	e8 80 f5 ff ff       	call   802722 <mlock_release>
+	return v;
+}
+  8031a2:	89 f0                	mov    %esi,%eax
+  8031a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a7:	5b                   	pop    %ebx
+  8031a8:	5e                   	pop    %esi
+  8031a9:	5f                   	pop    %edi
+  8031aa:	5d                   	pop    %ebp
+  8031ab:	c3                   	ret
+
+008031ac <malloc_stats>:
+
+// Fill in 'st' with how the heap is used.
+void
+malloc_stats(struct mstats *st)
+{
+  8031ac:	55                   	push   %ebp
+  8031ad:	89 e5                	mov    %esp,%ebp
+  8031af:	56                   	push   %esi
+  8031b0:	53                   	push   %ebx
+  8031b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct mspan *mp;
+	int c;
+
+	mlock_acquire();
+  8031b4:	e8 4a f5 ff ff       	call   802703 <mlock_acquire>
+	*st = mstat;
+  8031b9:	a1 80 7a 80 00       	mov    0x807a80,%eax
+  8031be:	89 03                	mov    %eax,(%ebx)
+  8031c0:	a1 84 7a 80 00       	mov    0x807a84,%eax
+  8031c5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8031c8:	a1 88 7a 80 00       	mov    0x807a88,%eax
+  8031cd:	89 43 08             	mov    %eax,0x8(%ebx)
+  8031d0:	a1 94 7a 80 00       	mov    0x807a94,%eax
+  8031d5:	89 43 14             	mov    %eax,0x14(%ebx)
+  8031d8:	a1 98 7a 80 00       	mov    0x807a98,%eax
+  8031dd:	89 43 18             	mov    %eax,0x18(%ebx)
+  8031e0:	a1 9c 7a 80 00       	mov    0x807a9c,%eax
+  8031e5:	89 43 1c             	mov    %eax,0x1c(%ebx)
+	st->ms_slabfree = st->ms_spanfree = 0;
+  8031e8:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  8031ef:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+	for (c = 0; c < NCLASS; c++)
+  8031f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8031fb:	eb 08                	jmp    803205 <malloc_stats+0x59>
+  8031fd:	83 c6 01             	add    $0x1,%esi
+  803200:	83 fe 16             	cmp    $0x16,%esi
+  803203:	74 26                	je     80322b <malloc_stats+0x7f>
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  803205:	8b 04 b5 40 7b 80 00 	mov    0x807b40(,%esi,4),%eax
+  80320c:	85 c0                	test   %eax,%eax
+  80320e:	74 ed                	je     8031fd <malloc_stats+0x51>
+			st->ms_slabfree += mp->mp_nfree * mclass_size[c];
+  803210:	0f b7 8c 36 20 54 80 	movzwl 0x805420(%esi,%esi,1),%ecx
+  803217:	00 
+  803218:	0f b7 50 0a          	movzwl 0xa(%eax),%edx
+  80321c:	0f af d1             	imul   %ecx,%edx
+  80321f:	01 53 0c             	add    %edx,0xc(%ebx)
+		for (mp = mslabs[c]; mp; mp = mp->mp_next)
+  803222:	8b 40 10             	mov    0x10(%eax),%eax
+  803225:	85 c0                	test   %eax,%eax
+  803227:	75 ef                	jne    803218 <malloc_stats+0x6c>
+  803229:	eb d2                	jmp    8031fd <malloc_stats+0x51>
+	for (c = 0; c < MBINS; c++)
+  80322b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803230:	eb 08                	jmp    80323a <malloc_stats+0x8e>
+  803232:	83 c1 01             	add    $0x1,%ecx
+  803235:	83 f9 20             	cmp    $0x20,%ecx
+  803238:	74 1e                	je     803258 <malloc_stats+0xac>
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  80323a:	8b 04 8d a0 7b 80 00 	mov    0x807ba0(,%ecx,4),%eax
+  803241:	85 c0                	test   %eax,%eax
+  803243:	74 ed                	je     803232 <malloc_stats+0x86>
+			st->ms_spanfree += mp->mp_npages * PGSIZE;
+  803245:	0f b7 50 04          	movzwl 0x4(%eax),%edx
+  803249:	c1 e2 0c             	shl    $0xc,%edx
+  80324c:	01 53 10             	add    %edx,0x10(%ebx)
+		for (mp = mbins[c]; mp; mp = mp->mp_next)
+  80324f:	8b 40 10             	mov    0x10(%eax),%eax
+  803252:	85 c0                	test   %eax,%eax
+  803254:	75 ef                	jne    803245 <malloc_stats+0x99>
+  803256:	eb da                	jmp    803232 <malloc_stats+0x86>
+	mlock_release();
+  803258:	e8 c5 f4 ff ff       	call   802722 <mlock_release>
+}
+  80325d:	5b                   	pop    %ebx
+  80325e:	5e                   	pop    %esi
+  80325f:	5d                   	pop    %ebp
+  803260:	c3                   	ret
+
+00803261 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803261:	55                   	push   %ebp
+  803262:	89 e5                	mov    %esp,%ebp
+  803264:	57                   	push   %edi
+  803265:	56                   	push   %esi
+  803266:	53                   	push   %ebx
+  803267:	83 ec 1c             	sub    $0x1c,%esp
+  80326a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80326d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803270:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803275:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80327a:	89 e0                	mov    %esp,%eax
+  80327c:	89 f2                	mov    %esi,%edx
+  80327e:	29 c2                	sub    %eax,%edx
+  803280:	89 d0                	mov    %edx,%eax
+  803282:	c1 e8 0f             	shr    $0xf,%eax
+  803285:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80328b:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80328e:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  803295:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803298:	83 ec 0c             	sub    $0xc,%esp
+  80329b:	ff 75 e0             	push   -0x20(%ebp)
+  80329e:	e8 17 1d 00 00       	call   804fba <pageref>
+  8032a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032a6:	83 c4 04             	add    $0x4,%esp
+  8032a9:	ff 75 dc             	push   -0x24(%ebp)
+  8032ac:	e8 09 1d 00 00       	call   804fba <pageref>
+  8032b1:	89 e2                	mov    %esp,%edx
+  8032b3:	89 f1                	mov    %esi,%ecx
+  8032b5:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  8032b7:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8032ba:	89 ca                	mov    %ecx,%edx
+  8032bc:	c1 ea 0f             	shr    $0xf,%edx
+  8032bf:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8032c5:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8032c8:	8b 14 95 20 83 80 00 	mov    0x808320(,%edx,4),%edx
+  8032cf:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8032d2:	39 d7                	cmp    %edx,%edi
+  8032d4:	74 40                	je     803316 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8032d6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8032d9:	75 9f                	jne    80327a <_pipeisclosed+0x19>
+  8032db:	89 e2                	mov    %esp,%edx
+  8032dd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8032e2:	29 d0                	sub    %edx,%eax
+  8032e4:	89 c2                	mov    %eax,%edx
+  8032e6:	c1 ea 0f             	shr    $0xf,%edx
+  8032e9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8032ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032f3:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8032f6:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  8032fd:	8b 40 58             	mov    0x58(%eax),%eax
+  803300:	6a 01                	push   $0x1
+  803302:	50                   	push   %eax
+  803303:	57                   	push   %edi
+  803304:	68 4c 54 80 00       	push   $0x80544c
+  803309:	e8 4d 0b 00 00       	call   803e5b <cprintf>
+  80330e:	83 c4 10             	add    $0x10,%esp
+  803311:	e9 5f ff ff ff       	jmp    803275 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803316:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803319:	0f 94 c0             	sete   %al
+  80331c:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80331f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803322:	5b                   	pop    %ebx
+  803323:	5e                   	pop    %esi
+  803324:	5f                   	pop    %edi
+  803325:	5d                   	pop    %ebp
+  803326:	c3                   	ret
+
+00803327 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803327:	55                   	push   %ebp
+  803328:	89 e5                	mov    %esp,%ebp
+  80332a:	53                   	push   %ebx
+  80332b:	83 ec 0c             	sub    $0xc,%esp
+  80332e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803331:	53                   	push   %ebx
+  803332:	6a 00                	push   $0x0
+  803334:	e8 47 d4 ff ff       	call   800780 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803339:	89 1c 24             	mov    %ebx,(%esp)
+  80333c:	e8 2d d8 ff ff       	call   800b6e <fd2data>
+  803341:	83 c4 08             	add    $0x8,%esp
+  803344:	50                   	push   %eax
+  803345:	6a 00                	push   $0x0
+  803347:	e8 34 d4 ff ff       	call   800780 <sys_page_unmap>
+}
+  80334c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80334f:	c9                   	leave
+  803350:	c3                   	ret
+
+00803351 <devpipe_read>:
+{
+  803351:	55                   	push   %ebp
+  803352:	89 e5                	mov    %esp,%ebp
+  803354:	57                   	push   %edi
+  803355:	56                   	push   %esi
+  803356:	53                   	push   %ebx
+  803357:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80335a:	ff 75 08             	push   0x8(%ebp)
+  80335d:	e8 0c d8 ff ff       	call   800b6e <fd2data>
+  803362:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803364:	8b 70 04             	mov    0x4(%eax),%esi
+  803367:	8b 00                	mov    (%eax),%eax
+  803369:	83 c4 10             	add    $0x10,%esp
+  80336c:	39 f0                	cmp    %esi,%eax
+  80336e:	75 36                	jne    8033a6 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803370:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803373:	89 da                	mov    %ebx,%edx
+  803375:	8b 45 08             	mov    0x8(%ebp),%eax
+  803378:	e8 e4 fe ff ff       	call   803261 <_pipeisclosed>
+  80337d:	85 c0                	test   %eax,%eax
+  80337f:	0f 85 d4 00 00 00    	jne    803459 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803385:	b8 01 00 00 00       	mov    $0x1,%eax
+  80338a:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80338e:	83 ec 04             	sub    $0x4,%esp
+  803391:	6a ff                	push   $0xffffffff
+  803393:	56                   	push   %esi
+  803394:	57                   	push   %edi
+  803395:	e8 5f d7 ff ff       	call   800af9 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80339a:	8b 73 04             	mov    0x4(%ebx),%esi
+  80339d:	8b 03                	mov    (%ebx),%eax
+  80339f:	83 c4 10             	add    $0x10,%esp
+  8033a2:	39 c6                	cmp    %eax,%esi
+  8033a4:	74 cd                	je     803373 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8033a6:	8b 73 04             	mov    0x4(%ebx),%esi
+  8033a9:	8b 03                	mov    (%ebx),%eax
+  8033ab:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8033b1:	29 c6                	sub    %eax,%esi
+  8033b3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8033b8:	f7 e6                	mul    %esi
+  8033ba:	c1 ea 0c             	shr    $0xc,%edx
+  8033bd:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8033c3:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8033c5:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033c8:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8033cc:	8b 0b                	mov    (%ebx),%ecx
+  8033ce:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8033d3:	f7 e1                	mul    %ecx
+  8033d5:	c1 ea 0b             	shr    $0xb,%edx
+  8033d8:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8033de:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8033e0:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8033e5:	29 cf                	sub    %ecx,%edi
+  8033e7:	39 f7                	cmp    %esi,%edi
+  8033e9:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8033ec:	83 ec 04             	sub    $0x4,%esp
+  8033ef:	57                   	push   %edi
+  8033f0:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8033f4:	50                   	push   %eax
+  8033f5:	ff 75 0c             	push   0xc(%ebp)
+  8033f8:	e8 7a d0 ff ff       	call   800477 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8033fd:	83 c4 0c             	add    $0xc,%esp
+  803400:	89 f0                	mov    %esi,%eax
+  803402:	29 f8                	sub    %edi,%eax
+  803404:	50                   	push   %eax
+  803405:	8d 43 10             	lea    0x10(%ebx),%eax
+  803408:	50                   	push   %eax
+  803409:	89 f8                	mov    %edi,%eax
+  80340b:	03 45 0c             	add    0xc(%ebp),%eax
+  80340e:	50                   	push   %eax
+  80340f:	e8 63 d0 ff ff       	call   800477 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803414:	8b 0b                	mov    (%ebx),%ecx
+  803416:	01 f1                	add    %esi,%ecx
+  803418:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80341d:	f7 e1                	mul    %ecx
+  80341f:	c1 ea 0c             	shr    $0xc,%edx
+  803422:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803428:	29 c1                	sub    %eax,%ecx
+  80342a:	89 0b                	mov    %ecx,(%ebx)
+  80342c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803431:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803435:	83 c4 10             	add    $0x10,%esp
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	75 0a                	jne    803446 <devpipe_read+0xf5>
+	return n;
+  80343c:	89 f0                	mov    %esi,%eax
+}
+  80343e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803441:	5b                   	pop    %ebx
+  803442:	5e                   	pop    %esi
+  803443:	5f                   	pop    %edi
+  803444:	5d                   	pop    %ebp
+  803445:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803446:	83 ec 08             	sub    $0x8,%esp
+  803449:	68 00 04 00 00       	push   $0x400
+  80344e:	53                   	push   %ebx
+  80344f:	e8 c7 d6 ff ff       	call   800b1b <sys_futex_wake>
+  803454:	83 c4 10             	add    $0x10,%esp
+  803457:	eb e3                	jmp    80343c <devpipe_read+0xeb>
+			return 0;
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	eb de                	jmp    80343e <devpipe_read+0xed>
+
+00803460 <devpipe_write>:
+{
+  803460:	55                   	push   %ebp
+  803461:	89 e5                	mov    %esp,%ebp
+  803463:	57                   	push   %edi
+  803464:	56                   	push   %esi
+  803465:	53                   	push   %ebx
+  803466:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803469:	ff 75 08             	push   0x8(%ebp)
+  80346c:	e8 fd d6 ff ff       	call   800b6e <fd2data>
+  803471:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803473:	83 c4 10             	add    $0x10,%esp
+  803476:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80347d:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803482:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803486:	0f 84 43 01 00 00    	je     8035cf <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80348c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80348f:	8b 06                	mov    (%esi),%eax
+  803491:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803497:	29 c1                	sub    %eax,%ecx
+  803499:	89 c8                	mov    %ecx,%eax
+  80349b:	f7 e7                	mul    %edi
+  80349d:	c1 ea 0c             	shr    $0xc,%edx
+  8034a0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8034a6:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8034a8:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8034ae:	75 52                	jne    803502 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8034b0:	89 f2                	mov    %esi,%edx
+  8034b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b5:	e8 a7 fd ff ff       	call   803261 <_pipeisclosed>
+  8034ba:	85 c0                	test   %eax,%eax
+  8034bc:	0f 85 28 01 00 00    	jne    8035ea <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8034c2:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8034c4:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8034c7:	8b 06                	mov    (%esi),%eax
+  8034c9:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8034cf:	29 c1                	sub    %eax,%ecx
+  8034d1:	89 c8                	mov    %ecx,%eax
+  8034d3:	f7 e7                	mul    %edi
+  8034d5:	c1 ea 0c             	shr    $0xc,%edx
+  8034d8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8034de:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8034e0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8034e6:	75 a4                	jne    80348c <devpipe_write+0x2c>
+  8034e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034ed:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8034f1:	83 ec 04             	sub    $0x4,%esp
+  8034f4:	6a ff                	push   $0xffffffff
+  8034f6:	53                   	push   %ebx
+  8034f7:	56                   	push   %esi
+  8034f8:	e8 fc d5 ff ff       	call   800af9 <sys_futex_wait>
+}
+  8034fd:	83 c4 10             	add    $0x10,%esp
+  803500:	eb 8a                	jmp    80348c <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803502:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803505:	8b 06                	mov    (%esi),%eax
+  803507:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80350d:	29 c1                	sub    %eax,%ecx
+  80350f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803514:	f7 e1                	mul    %ecx
+  803516:	c1 ea 0c             	shr    $0xc,%edx
+  803519:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80351f:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803521:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803526:	89 d8                	mov    %ebx,%eax
+  803528:	29 c8                	sub    %ecx,%eax
+  80352a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80352d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803530:	29 ca                	sub    %ecx,%edx
+  803532:	39 d0                	cmp    %edx,%eax
+  803534:	0f 46 d0             	cmovbe %eax,%edx
+  803537:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80353a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80353d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803542:	f7 e1                	mul    %ecx
+  803544:	c1 ea 0b             	shr    $0xb,%edx
+  803547:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80354d:	89 ca                	mov    %ecx,%edx
+  80354f:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803551:	29 d3                	sub    %edx,%ebx
+  803553:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803556:	39 c3                	cmp    %eax,%ebx
+  803558:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80355b:	83 ec 04             	sub    $0x4,%esp
+  80355e:	53                   	push   %ebx
+  80355f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803562:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803565:	51                   	push   %ecx
+  803566:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80356a:	50                   	push   %eax
+  80356b:	e8 07 cf ff ff       	call   800477 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803570:	83 c4 0c             	add    $0xc,%esp
+  803573:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803576:	29 d8                	sub    %ebx,%eax
+  803578:	50                   	push   %eax
+  803579:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80357c:	01 cb                	add    %ecx,%ebx
+  80357e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803581:	53                   	push   %ebx
+  803582:	8d 46 10             	lea    0x10(%esi),%eax
+  803585:	50                   	push   %eax
+  803586:	e8 ec ce ff ff       	call   800477 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80358b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80358e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803591:	01 c1                	add    %eax,%ecx
+  803593:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803598:	f7 e1                	mul    %ecx
+  80359a:	c1 ea 0c             	shr    $0xc,%edx
+  80359d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8035a3:	89 ca                	mov    %ecx,%edx
+  8035a5:	29 c2                	sub    %eax,%edx
+  8035a7:	89 56 04             	mov    %edx,0x4(%esi)
+  8035aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035af:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8035b3:	83 c4 10             	add    $0x10,%esp
+  8035b6:	85 c0                	test   %eax,%eax
+  8035b8:	75 1a                	jne    8035d4 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8035ba:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8035bd:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8035c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035c3:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8035c6:	0f 82 c0 fe ff ff    	jb     80348c <devpipe_write+0x2c>
+  8035cc:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8035cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035d2:	eb 1b                	jmp    8035ef <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8035d4:	83 ec 08             	sub    $0x8,%esp
+  8035d7:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8035dc:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8035df:	50                   	push   %eax
+  8035e0:	e8 36 d5 ff ff       	call   800b1b <sys_futex_wake>
+  8035e5:	83 c4 10             	add    $0x10,%esp
+  8035e8:	eb d0                	jmp    8035ba <devpipe_write+0x15a>
+				return 0;
+  8035ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035f2:	5b                   	pop    %ebx
+  8035f3:	5e                   	pop    %esi
+  8035f4:	5f                   	pop    %edi
+  8035f5:	5d                   	pop    %ebp
+  8035f6:	c3                   	ret
+
+008035f7 <devpipe_stat>:
+{
+  8035f7:	55                   	push   %ebp
+  8035f8:	89 e5                	mov    %esp,%ebp
+  8035fa:	56                   	push   %esi
+  8035fb:	53                   	push   %ebx
+  8035fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035ff:	83 ec 0c             	sub    $0xc,%esp
+  803602:	ff 75 08             	push   0x8(%ebp)
+  803605:	e8 64 d5 ff ff       	call   800b6e <fd2data>
+  80360a:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80360c:	83 c4 08             	add    $0x8,%esp
+  80360f:	68 5f 54 80 00       	push   $0x80545f
+  803614:	53                   	push   %ebx
+  803615:	e8 ad cc ff ff       	call   8002c7 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80361a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80361d:	8b 06                	mov    (%esi),%eax
+  80361f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803625:	29 c1                	sub    %eax,%ecx
+  803627:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80362c:	89 c8                	mov    %ecx,%eax
+  80362e:	f7 e2                	mul    %edx
+  803630:	c1 ea 0c             	shr    $0xc,%edx
+  803633:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803639:	29 d1                	sub    %edx,%ecx
+  80363b:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803641:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803648:	00 00 00 
+	stat->st_dev = &devpipe;
+  80364b:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  803652:	60 80 00 
+}
+  803655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80365a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80365d:	5b                   	pop    %ebx
+  80365e:	5e                   	pop    %esi
+  80365f:	5d                   	pop    %ebp
+  803660:	c3                   	ret
+
+00803661 <devpipe_poll>:
+{
+  803661:	55                   	push   %ebp
+  803662:	89 e5                	mov    %esp,%ebp
+  803664:	57                   	push   %edi
+  803665:	56                   	push   %esi
+  803666:	53                   	push   %ebx
+  803667:	83 ec 18             	sub    $0x18,%esp
+  80366a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80366d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803670:	57                   	push   %edi
+  803671:	e8 f8 d4 ff ff       	call   800b6e <fd2data>
+  803676:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803678:	83 c4 10             	add    $0x10,%esp
+  80367b:	89 f3                	mov    %esi,%ebx
+  80367d:	83 e3 01             	and    $0x1,%ebx
+  803680:	75 27                	jne    8036a9 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803682:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803688:	75 48                	jne    8036d2 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80368a:	89 ca                	mov    %ecx,%edx
+  80368c:	89 f8                	mov    %edi,%eax
+  80368e:	e8 ce fb ff ff       	call   803261 <_pipeisclosed>
+  803693:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803695:	89 d8                	mov    %ebx,%eax
+  803697:	83 c8 10             	or     $0x10,%eax
+  80369a:	85 d2                	test   %edx,%edx
+  80369c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80369f:	89 d8                	mov    %ebx,%eax
+  8036a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a4:	5b                   	pop    %ebx
+  8036a5:	5e                   	pop    %esi
+  8036a6:	5f                   	pop    %edi
+  8036a7:	5d                   	pop    %ebp
+  8036a8:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036a9:	8b 58 04             	mov    0x4(%eax),%ebx
+  8036ac:	8b 00                	mov    (%eax),%eax
+  8036ae:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8036b4:	29 c3                	sub    %eax,%ebx
+  8036b6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8036bb:	89 d8                	mov    %ebx,%eax
+  8036bd:	f7 e2                	mul    %edx
+  8036bf:	c1 ea 0c             	shr    $0xc,%edx
+  8036c2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8036c8:	39 d3                	cmp    %edx,%ebx
+  8036ca:	0f 95 c3             	setne  %bl
+  8036cd:	0f b6 db             	movzbl %bl,%ebx
+  8036d0:	eb b0                	jmp    803682 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036d2:	8b 71 04             	mov    0x4(%ecx),%esi
+  8036d5:	8b 01                	mov    (%ecx),%eax
+  8036d7:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8036dd:	29 c6                	sub    %eax,%esi
+  8036df:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8036e4:	89 f0                	mov    %esi,%eax
+  8036e6:	f7 e2                	mul    %edx
+  8036e8:	c1 ea 0c             	shr    $0xc,%edx
+  8036eb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8036f1:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8036f3:	89 d8                	mov    %ebx,%eax
+  8036f5:	83 c8 04             	or     $0x4,%eax
+  8036f8:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8036fe:	0f 42 d8             	cmovb  %eax,%ebx
+  803701:	eb 87                	jmp    80368a <devpipe_poll+0x29>
+
+00803703 <pipe>:
+{
+  803703:	55                   	push   %ebp
+  803704:	89 e5                	mov    %esp,%ebp
+  803706:	56                   	push   %esi
+  803707:	53                   	push   %ebx
+  803708:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80370b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80370e:	50                   	push   %eax
+  80370f:	e8 71 d4 ff ff       	call   800b85 <fd_alloc>
+  803714:	89 c3                	mov    %eax,%ebx
+  803716:	83 c4 10             	add    $0x10,%esp
+  803719:	85 c0                	test   %eax,%eax
+  80371b:	0f 88 23 01 00 00    	js     803844 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803721:	83 ec 04             	sub    $0x4,%esp
+  803724:	68 07 04 00 00       	push   $0x407
+  803729:	ff 75 f4             	push   -0xc(%ebp)
+  80372c:	6a 00                	push   $0x0
+  80372e:	e8 c8 cf ff ff       	call   8006fb <sys_page_alloc>
+  803733:	89 c3                	mov    %eax,%ebx
+  803735:	83 c4 10             	add    $0x10,%esp
+  803738:	85 c0                	test   %eax,%eax
+  80373a:	0f 88 04 01 00 00    	js     803844 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803740:	83 ec 0c             	sub    $0xc,%esp
+  803743:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803746:	50                   	push   %eax
+  803747:	e8 39 d4 ff ff       	call   800b85 <fd_alloc>
+  80374c:	89 c3                	mov    %eax,%ebx
+  80374e:	83 c4 10             	add    $0x10,%esp
+  803751:	85 c0                	test   %eax,%eax
+  803753:	0f 88 db 00 00 00    	js     803834 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803759:	83 ec 04             	sub    $0x4,%esp
+  80375c:	68 07 04 00 00       	push   $0x407
+  803761:	ff 75 f0             	push   -0x10(%ebp)
+  803764:	6a 00                	push   $0x0
+  803766:	e8 90 cf ff ff       	call   8006fb <sys_page_alloc>
+  80376b:	89 c3                	mov    %eax,%ebx
+  80376d:	83 c4 10             	add    $0x10,%esp
+  803770:	85 c0                	test   %eax,%eax
+  803772:	0f 88 bc 00 00 00    	js     803834 <pipe+0x131>
+	va = fd2data(fd0);
+  803778:	83 ec 0c             	sub    $0xc,%esp
+  80377b:	ff 75 f4             	push   -0xc(%ebp)
+  80377e:	e8 eb d3 ff ff       	call   800b6e <fd2data>
+  803783:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803785:	83 c4 0c             	add    $0xc,%esp
+  803788:	68 07 04 00 00       	push   $0x407
+  80378d:	50                   	push   %eax
+  80378e:	6a 00                	push   $0x0
+  803790:	e8 66 cf ff ff       	call   8006fb <sys_page_alloc>
+  803795:	89 c3                	mov    %eax,%ebx
+  803797:	83 c4 10             	add    $0x10,%esp
+  80379a:	85 c0                	test   %eax,%eax
+  80379c:	0f 88 82 00 00 00    	js     803824 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037a2:	83 ec 0c             	sub    $0xc,%esp
+  8037a5:	ff 75 f0             	push   -0x10(%ebp)
+  8037a8:	e8 c1 d3 ff ff       	call   800b6e <fd2data>
+  8037ad:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8037b4:	50                   	push   %eax
+  8037b5:	6a 00                	push   $0x0
+  8037b7:	56                   	push   %esi
+  8037b8:	6a 00                	push   $0x0
+  8037ba:	e8 7f cf ff ff       	call   80073e <sys_page_map>
+  8037bf:	89 c3                	mov    %eax,%ebx
+  8037c1:	83 c4 20             	add    $0x20,%esp
+  8037c4:	85 c0                	test   %eax,%eax
+  8037c6:	78 4e                	js     803816 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8037c8:	a1 60 60 80 00       	mov    0x806060,%eax
+  8037cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037d0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8037d2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8037d5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8037dc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8037df:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8037e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8037e4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8037eb:	83 ec 0c             	sub    $0xc,%esp
+  8037ee:	ff 75 f4             	push   -0xc(%ebp)
+  8037f1:	e8 68 d3 ff ff       	call   800b5e <fd2num>
+  8037f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8037f9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8037fb:	83 c4 04             	add    $0x4,%esp
+  8037fe:	ff 75 f0             	push   -0x10(%ebp)
+  803801:	e8 58 d3 ff ff       	call   800b5e <fd2num>
+  803806:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803809:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80380c:	83 c4 10             	add    $0x10,%esp
+  80380f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803814:	eb 2e                	jmp    803844 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803816:	83 ec 08             	sub    $0x8,%esp
+  803819:	56                   	push   %esi
+  80381a:	6a 00                	push   $0x0
+  80381c:	e8 5f cf ff ff       	call   800780 <sys_page_unmap>
+  803821:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803824:	83 ec 08             	sub    $0x8,%esp
+  803827:	ff 75 f0             	push   -0x10(%ebp)
+  80382a:	6a 00                	push   $0x0
+  80382c:	e8 4f cf ff ff       	call   800780 <sys_page_unmap>
+  803831:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803834:	83 ec 08             	sub    $0x8,%esp
+  803837:	ff 75 f4             	push   -0xc(%ebp)
+  80383a:	6a 00                	push   $0x0
+  80383c:	e8 3f cf ff ff       	call   800780 <sys_page_unmap>
+  803841:	83 c4 10             	add    $0x10,%esp
+}
+  803844:	89 d8                	mov    %ebx,%eax
+  803846:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803849:	5b                   	pop    %ebx
+  80384a:	5e                   	pop    %esi
+  80384b:	5d                   	pop    %ebp
+  80384c:	c3                   	ret
+
+0080384d <pipeisclosed>:
+{
+  80384d:	55                   	push   %ebp
+  80384e:	89 e5                	mov    %esp,%ebp
+  803850:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803853:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803856:	50                   	push   %eax
+  803857:	ff 75 08             	push   0x8(%ebp)
+  80385a:	e8 76 d3 ff ff       	call   800bd5 <fd_lookup>
+  80385f:	83 c4 10             	add    $0x10,%esp
+  803862:	85 c0                	test   %eax,%eax
+  803864:	78 18                	js     80387e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803866:	83 ec 0c             	sub    $0xc,%esp
+  803869:	ff 75 f4             	push   -0xc(%ebp)
+  80386c:	e8 fd d2 ff ff       	call   800b6e <fd2data>
+  803871:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803873:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803876:	e8 e6 f9 ff ff       	call   803261 <_pipeisclosed>
+  80387b:	83 c4 10             	add    $0x10,%esp
+}
+  80387e:	c9                   	leave
+  80387f:	c3                   	ret
+
+00803880 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803880:	55                   	push   %ebp
+  803881:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803883:	8b 45 08             	mov    0x8(%ebp),%eax
+  803886:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80388c:	5d                   	pop    %ebp
+  80388d:	c3                   	ret
+
+0080388e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80388e:	55                   	push   %ebp
+  80388f:	89 e5                	mov    %esp,%ebp
+  803891:	53                   	push   %ebx
+  803892:	83 ec 04             	sub    $0x4,%esp
+  803895:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803898:	8b 03                	mov    (%ebx),%eax
+  80389a:	85 c0                	test   %eax,%eax
+  80389c:	75 05                	jne    8038a3 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80389e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a1:	c9                   	leave
+  8038a2:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  8038a3:	83 ec 08             	sub    $0x8,%esp
+  8038a6:	50                   	push   %eax
+  8038a7:	8d 43 04             	lea    0x4(%ebx),%eax
+  8038aa:	50                   	push   %eax
+  8038ab:	e8 20 d1 ff ff       	call   8009d0 <sys_page_batch>
+	pb->pb_n = 0;
+  8038b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  8038b6:	83 c4 10             	add    $0x10,%esp
+  8038b9:	eb e3                	jmp    80389e <pgbatch_flush+0x10>
+
+008038bb <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8038bb:	55                   	push   %ebp
+  8038bc:	89 e5                	mov    %esp,%ebp
+  8038be:	56                   	push   %esi
+  8038bf:	53                   	push   %ebx
+  8038c0:	89 c3                	mov    %eax,%ebx
+  8038c2:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8038c4:	83 38 20             	cmpl   $0x20,(%eax)
+  8038c7:	74 2c                	je     8038f5 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8038c9:	8b 03                	mov    (%ebx),%eax
+  8038cb:	8d 50 01             	lea    0x1(%eax),%edx
+  8038ce:	89 13                	mov    %edx,(%ebx)
+  8038d0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8038d3:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8038d7:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8038d9:	83 ec 04             	sub    $0x4,%esp
+  8038dc:	6a 18                	push   $0x18
+  8038de:	6a 00                	push   $0x0
+  8038e0:	50                   	push   %eax
+  8038e1:	e8 5c cb ff ff       	call   800442 <memset>
+	return 0;
+  8038e6:	83 c4 10             	add    $0x10,%esp
+  8038e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038f1:	5b                   	pop    %ebx
+  8038f2:	5e                   	pop    %esi
+  8038f3:	5d                   	pop    %ebp
+  8038f4:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8038f5:	83 ec 0c             	sub    $0xc,%esp
+  8038f8:	50                   	push   %eax
+  8038f9:	e8 90 ff ff ff       	call   80388e <pgbatch_flush>
+  8038fe:	83 c4 10             	add    $0x10,%esp
+  803901:	85 c0                	test   %eax,%eax
+  803903:	79 c4                	jns    8038c9 <pgbatch_slot+0xe>
+  803905:	eb e7                	jmp    8038ee <pgbatch_slot+0x33>
+
+00803907 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803907:	55                   	push   %ebp
+  803908:	89 e5                	mov    %esp,%ebp
+  80390a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80390d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803910:	8b 45 08             	mov    0x8(%ebp),%eax
+  803913:	e8 a3 ff ff ff       	call   8038bb <pgbatch_slot>
+  803918:	85 c0                	test   %eax,%eax
+  80391a:	78 20                	js     80393c <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80391c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80391f:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803925:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803928:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80392b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80392e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803931:	8b 55 14             	mov    0x14(%ebp),%edx
+  803934:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803937:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80393c:	c9                   	leave
+  80393d:	c3                   	ret
+
+0080393e <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80393e:	55                   	push   %ebp
+  80393f:	89 e5                	mov    %esp,%ebp
+  803941:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803944:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80394a:	e8 6c ff ff ff       	call   8038bb <pgbatch_slot>
+  80394f:	85 c0                	test   %eax,%eax
+  803951:	78 2c                	js     80397f <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803956:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80395c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80395f:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803962:	8b 55 10             	mov    0x10(%ebp),%edx
+  803965:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803968:	8b 55 14             	mov    0x14(%ebp),%edx
+  80396b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80396e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803971:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803974:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803977:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80397a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397f:	c9                   	leave
+  803980:	c3                   	ret
+
+00803981 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803981:	55                   	push   %ebp
+  803982:	89 e5                	mov    %esp,%ebp
+  803984:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803987:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80398a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80398d:	e8 29 ff ff ff       	call   8038bb <pgbatch_slot>
+  803992:	85 c0                	test   %eax,%eax
+  803994:	78 1a                	js     8039b0 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803996:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803999:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80399f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039a2:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8039a5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039a8:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  8039ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b0:	c9                   	leave
+  8039b1:	c3                   	ret
+
+008039b2 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8039b2:	55                   	push   %ebp
+  8039b3:	89 e5                	mov    %esp,%ebp
+  8039b5:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8039b8:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8039bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039be:	e8 f8 fe ff ff       	call   8038bb <pgbatch_slot>
+  8039c3:	85 c0                	test   %eax,%eax
+  8039c5:	78 20                	js     8039e7 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8039c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039ca:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8039d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8039d3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8039d6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8039d9:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8039dc:	8b 55 14             	mov    0x14(%ebp),%edx
+  8039df:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8039e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039e7:	c9                   	leave
+  8039e8:	c3                   	ret
+
+008039e9 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8039e9:	55                   	push   %ebp
+  8039ea:	89 e5                	mov    %esp,%ebp
+  8039ec:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8039ef:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8039f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039f5:	e8 c1 fe ff ff       	call   8038bb <pgbatch_slot>
+  8039fa:	85 c0                	test   %eax,%eax
+  8039fc:	78 26                	js     803a24 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8039fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a01:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a0a:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803a0d:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a10:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803a13:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a16:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803a19:	8b 55 18             	mov    0x18(%ebp),%edx
+  803a1c:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a24:	c9                   	leave
+  803a25:	c3                   	ret
+
+00803a26 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803a26:	55                   	push   %ebp
+  803a27:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a2c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803a32:	5d                   	pop    %ebp
+  803a33:	c3                   	ret
+
+00803a34 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803a34:	55                   	push   %ebp
+  803a35:	89 e5                	mov    %esp,%ebp
+  803a37:	56                   	push   %esi
+  803a38:	53                   	push   %ebx
+  803a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a41:	ba 01 00 00 00       	mov    $0x1,%edx
+  803a46:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803a4a:	85 c0                	test   %eax,%eax
+  803a4c:	74 2f                	je     803a7d <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803a4e:	83 f8 02             	cmp    $0x2,%eax
+  803a51:	74 0c                	je     803a5f <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803a53:	b8 02 00 00 00       	mov    $0x2,%eax
+  803a58:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803a5b:	85 c0                	test   %eax,%eax
+  803a5d:	74 1e                	je     803a7d <mutex_lock+0x49>
+  803a5f:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803a64:	83 ec 04             	sub    $0x4,%esp
+  803a67:	6a ff                	push   $0xffffffff
+  803a69:	6a 02                	push   $0x2
+  803a6b:	53                   	push   %ebx
+  803a6c:	e8 88 d0 ff ff       	call   800af9 <sys_futex_wait>
+  803a71:	89 f0                	mov    %esi,%eax
+  803a73:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803a76:	83 c4 10             	add    $0x10,%esp
+  803a79:	85 c0                	test   %eax,%eax
+  803a7b:	75 e7                	jne    803a64 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a80:	5b                   	pop    %ebx
+  803a81:	5e                   	pop    %esi
+  803a82:	5d                   	pop    %ebp
+  803a83:	c3                   	ret
+
+00803a84 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803a84:	55                   	push   %ebp
+  803a85:	89 e5                	mov    %esp,%ebp
+  803a87:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803a8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a8f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803a94:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	0f 94 c0             	sete   %al
+  803a9d:	0f b6 c0             	movzbl %al,%eax
+}
+  803aa0:	5d                   	pop    %ebp
+  803aa1:	c3                   	ret
+
+00803aa2 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803aa2:	55                   	push   %ebp
+  803aa3:	89 e5                	mov    %esp,%ebp
+  803aa5:	83 ec 08             	sub    $0x8,%esp
+  803aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab0:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ab3:	83 f8 02             	cmp    $0x2,%eax
+  803ab6:	74 02                	je     803aba <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ab8:	c9                   	leave
+  803ab9:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803aba:	83 ec 08             	sub    $0x8,%esp
+  803abd:	6a 01                	push   $0x1
+  803abf:	52                   	push   %edx
+  803ac0:	e8 56 d0 ff ff       	call   800b1b <sys_futex_wake>
+  803ac5:	83 c4 10             	add    $0x10,%esp
+}
+  803ac8:	eb ee                	jmp    803ab8 <mutex_unlock+0x16>
+
+00803aca <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803aca:	55                   	push   %ebp
+  803acb:	89 e5                	mov    %esp,%ebp
+  803acd:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803ad0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803ad6:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803add:	5d                   	pop    %ebp
+  803ade:	c3                   	ret
+
+00803adf <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803adf:	55                   	push   %ebp
+  803ae0:	89 e5                	mov    %esp,%ebp
+  803ae2:	57                   	push   %edi
+  803ae3:	56                   	push   %esi
+  803ae4:	53                   	push   %ebx
+  803ae5:	83 ec 18             	sub    $0x18,%esp
+  803ae8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803aeb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803aee:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803af0:	b8 01 00 00 00       	mov    $0x1,%eax
+  803af5:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803afa:	57                   	push   %edi
+  803afb:	e8 a2 ff ff ff       	call   803aa2 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803b00:	83 c4 0c             	add    $0xc,%esp
+  803b03:	ff 75 10             	push   0x10(%ebp)
+  803b06:	56                   	push   %esi
+  803b07:	53                   	push   %ebx
+  803b08:	e8 ec cf ff ff       	call   800af9 <sys_futex_wait>
+  803b0d:	89 c6                	mov    %eax,%esi
+  803b0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803b14:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803b19:	89 3c 24             	mov    %edi,(%esp)
+  803b1c:	e8 13 ff ff ff       	call   803a34 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803b21:	83 c4 10             	add    $0x10,%esp
+  803b24:	83 fe ef             	cmp    $0xffffffef,%esi
+  803b27:	74 05                	je     803b2e <cond_timedwait+0x4f>
+  803b29:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803b2e:	89 f0                	mov    %esi,%eax
+  803b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b33:	5b                   	pop    %ebx
+  803b34:	5e                   	pop    %esi
+  803b35:	5f                   	pop    %edi
+  803b36:	5d                   	pop    %ebp
+  803b37:	c3                   	ret
+
+00803b38 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803b38:	55                   	push   %ebp
+  803b39:	89 e5                	mov    %esp,%ebp
+  803b3b:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803b3e:	6a ff                	push   $0xffffffff
+  803b40:	ff 75 0c             	push   0xc(%ebp)
+  803b43:	ff 75 08             	push   0x8(%ebp)
+  803b46:	e8 94 ff ff ff       	call   803adf <cond_timedwait>
+}
+  803b4b:	83 c4 10             	add    $0x10,%esp
+  803b4e:	c9                   	leave
+  803b4f:	c3                   	ret
+
+00803b50 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803b50:	55                   	push   %ebp
+  803b51:	89 e5                	mov    %esp,%ebp
+  803b53:	83 ec 08             	sub    $0x8,%esp
+  803b56:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b59:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b5e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803b62:	8b 50 04             	mov    0x4(%eax),%edx
+  803b65:	85 d2                	test   %edx,%edx
+  803b67:	75 02                	jne    803b6b <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803b69:	c9                   	leave
+  803b6a:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803b6b:	83 ec 08             	sub    $0x8,%esp
+  803b6e:	6a 01                	push   $0x1
+  803b70:	50                   	push   %eax
+  803b71:	e8 a5 cf ff ff       	call   800b1b <sys_futex_wake>
+  803b76:	83 c4 10             	add    $0x10,%esp
+}
+  803b79:	eb ee                	jmp    803b69 <cond_signal+0x19>
+
+00803b7b <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803b7b:	55                   	push   %ebp
+  803b7c:	89 e5                	mov    %esp,%ebp
+  803b7e:	83 ec 08             	sub    $0x8,%esp
+  803b81:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b84:	ba 01 00 00 00       	mov    $0x1,%edx
+  803b89:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803b8d:	8b 50 04             	mov    0x4(%eax),%edx
+  803b90:	85 d2                	test   %edx,%edx
+  803b92:	75 02                	jne    803b96 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803b94:	c9                   	leave
+  803b95:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803b96:	83 ec 08             	sub    $0x8,%esp
+  803b99:	68 00 04 00 00       	push   $0x400
+  803b9e:	50                   	push   %eax
+  803b9f:	e8 77 cf ff ff       	call   800b1b <sys_futex_wake>
+  803ba4:	83 c4 10             	add    $0x10,%esp
+}
+  803ba7:	eb eb                	jmp    803b94 <cond_broadcast+0x19>
+
+00803ba9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bae:	c3                   	ret
+
+00803baf <devcons_poll>:
+{
+  803baf:	55                   	push   %ebp
+  803bb0:	89 e5                	mov    %esp,%ebp
+  803bb2:	53                   	push   %ebx
+  803bb3:	83 ec 04             	sub    $0x4,%esp
+  803bb6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803bb9:	89 da                	mov    %ebx,%edx
+  803bbb:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803bbe:	83 3d 28 7c 80 00 00 	cmpl   $0x0,0x807c28
+  803bc5:	74 0c                	je     803bd3 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803bc7:	89 d8                	mov    %ebx,%eax
+  803bc9:	83 e0 01             	and    $0x1,%eax
+  803bcc:	09 d0                	or     %edx,%eax
+}
+  803bce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803bd1:	c9                   	leave
+  803bd2:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803bd3:	e8 85 ca ff ff       	call   80065d <sys_cgetc>
+  803bd8:	a3 28 7c 80 00       	mov    %eax,0x807c28
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803bdd:	89 da                	mov    %ebx,%edx
+  803bdf:	83 e2 04             	and    $0x4,%edx
+  803be2:	85 c0                	test   %eax,%eax
+  803be4:	74 e6                	je     803bcc <devcons_poll+0x1d>
+  803be6:	eb df                	jmp    803bc7 <devcons_poll+0x18>
+
+00803be8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803be8:	55                   	push   %ebp
+  803be9:	89 e5                	mov    %esp,%ebp
+  803beb:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803bee:	68 6b 54 80 00       	push   $0x80546b
+  803bf3:	ff 75 0c             	push   0xc(%ebp)
+  803bf6:	e8 cc c6 ff ff       	call   8002c7 <strcpy>
+	return 0;
+}
+  803bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c00:	c9                   	leave
+  803c01:	c3                   	ret
+
+00803c02 <devcons_write>:
+{
+  803c02:	55                   	push   %ebp
+  803c03:	89 e5                	mov    %esp,%ebp
+  803c05:	57                   	push   %edi
+  803c06:	56                   	push   %esi
+  803c07:	53                   	push   %ebx
+  803c08:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803c0e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803c11:	85 ff                	test   %edi,%edi
+  803c13:	74 51                	je     803c66 <devcons_write+0x64>
+  803c15:	be 00 00 00 00       	mov    $0x0,%esi
+  803c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803c1f:	89 fb                	mov    %edi,%ebx
+  803c21:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803c23:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803c28:	39 d3                	cmp    %edx,%ebx
+  803c2a:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803c2d:	83 ec 04             	sub    $0x4,%esp
+  803c30:	53                   	push   %ebx
+  803c31:	03 45 0c             	add    0xc(%ebp),%eax
+  803c34:	50                   	push   %eax
+  803c35:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803c3b:	50                   	push   %eax
+  803c3c:	e8 36 c8 ff ff       	call   800477 <memmove>
+		sys_cputs(buf, m);
+  803c41:	83 c4 08             	add    $0x8,%esp
+  803c44:	53                   	push   %ebx
+  803c45:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803c4b:	50                   	push   %eax
+  803c4c:	e8 ee c9 ff ff       	call   80063f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803c51:	01 de                	add    %ebx,%esi
+  803c53:	89 f0                	mov    %esi,%eax
+  803c55:	83 c4 10             	add    $0x10,%esp
+  803c58:	39 fe                	cmp    %edi,%esi
+  803c5a:	72 c3                	jb     803c1f <devcons_write+0x1d>
+}
+  803c5c:	89 f0                	mov    %esi,%eax
+  803c5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c61:	5b                   	pop    %ebx
+  803c62:	5e                   	pop    %esi
+  803c63:	5f                   	pop    %edi
+  803c64:	5d                   	pop    %ebp
+  803c65:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803c66:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803c6b:	eb ef                	jmp    803c5c <devcons_write+0x5a>
+
+00803c6d <devcons_read>:
+{
+  803c6d:	55                   	push   %ebp
+  803c6e:	89 e5                	mov    %esp,%ebp
+  803c70:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803c73:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803c78:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803c7c:	74 36                	je     803cb4 <devcons_read+0x47>
+	c = cons_peek;
+  803c7e:	a1 28 7c 80 00       	mov    0x807c28,%eax
+	cons_peek = 0;
+  803c83:	c7 05 28 7c 80 00 00 	movl   $0x0,0x807c28
+  803c8a:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803c8d:	85 c0                	test   %eax,%eax
+  803c8f:	75 10                	jne    803ca1 <devcons_read+0x34>
+  803c91:	e8 c7 c9 ff ff       	call   80065d <sys_cgetc>
+  803c96:	85 c0                	test   %eax,%eax
+  803c98:	75 07                	jne    803ca1 <devcons_read+0x34>
+		sys_yield();
+  803c9a:	e8 3d ca ff ff       	call   8006dc <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803c9f:	eb f0                	jmp    803c91 <devcons_read+0x24>
+	if (c < 0)
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	78 0f                	js     803cb4 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803ca5:	83 f8 04             	cmp    $0x4,%eax
+  803ca8:	74 0c                	je     803cb6 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803caa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cad:	88 02                	mov    %al,(%edx)
+	return 1;
+  803caf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803cb4:	c9                   	leave
+  803cb5:	c3                   	ret
+		return 0;
+  803cb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cbb:	eb f7                	jmp    803cb4 <devcons_read+0x47>
+
+00803cbd <cputchar>:
+{
+  803cbd:	55                   	push   %ebp
+  803cbe:	89 e5                	mov    %esp,%ebp
+  803cc0:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803cc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cc6:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803cc9:	6a 01                	push   $0x1
+  803ccb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803cce:	50                   	push   %eax
+  803ccf:	e8 6b c9 ff ff       	call   80063f <sys_cputs>
+}
+  803cd4:	83 c4 10             	add    $0x10,%esp
+  803cd7:	c9                   	leave
+  803cd8:	c3                   	ret
+
+00803cd9 <getchar>:
+{
+  803cd9:	55                   	push   %ebp
+  803cda:	89 e5                	mov    %esp,%ebp
+  803cdc:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803cdf:	6a 01                	push   $0x1
+  803ce1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803ce4:	50                   	push   %eax
+  803ce5:	6a 00                	push   $0x0
+  803ce7:	e8 6d d1 ff ff       	call   800e59 <read>
+	if (r < 0)
+  803cec:	83 c4 10             	add    $0x10,%esp
+  803cef:	85 c0                	test   %eax,%eax
+  803cf1:	78 06                	js     803cf9 <getchar+0x20>
+	if (r < 1)
+  803cf3:	74 06                	je     803cfb <getchar+0x22>
+	return c;
+  803cf5:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803cf9:	c9                   	leave
+  803cfa:	c3                   	ret
+		return -E_EOF;
+  803cfb:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803d00:	eb f7                	jmp    803cf9 <getchar+0x20>
+
+00803d02 <iscons>:
+{
+  803d02:	55                   	push   %ebp
+  803d03:	89 e5                	mov    %esp,%ebp
+  803d05:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d0b:	50                   	push   %eax
+  803d0c:	ff 75 08             	push   0x8(%ebp)
+  803d0f:	e8 c1 ce ff ff       	call   800bd5 <fd_lookup>
+  803d14:	83 c4 10             	add    $0x10,%esp
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	78 11                	js     803d2c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803d1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d1e:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  803d24:	39 10                	cmp    %edx,(%eax)
+  803d26:	0f 94 c0             	sete   %al
+  803d29:	0f b6 c0             	movzbl %al,%eax
+}
+  803d2c:	c9                   	leave
+  803d2d:	c3                   	ret
+
+00803d2e <opencons>:
+{
+  803d2e:	55                   	push   %ebp
+  803d2f:	89 e5                	mov    %esp,%ebp
+  803d31:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803d34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d37:	50                   	push   %eax
+  803d38:	e8 48 ce ff ff       	call   800b85 <fd_alloc>
+  803d3d:	83 c4 10             	add    $0x10,%esp
+  803d40:	85 c0                	test   %eax,%eax
+  803d42:	78 3a                	js     803d7e <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803d44:	83 ec 04             	sub    $0x4,%esp
+  803d47:	68 07 04 00 00       	push   $0x407
+  803d4c:	ff 75 f4             	push   -0xc(%ebp)
+  803d4f:	6a 00                	push   $0x0
+  803d51:	e8 a5 c9 ff ff       	call   8006fb <sys_page_alloc>
+  803d56:	83 c4 10             	add    $0x10,%esp
+  803d59:	85 c0                	test   %eax,%eax
+  803d5b:	78 21                	js     803d7e <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803d5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d60:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  803d66:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803d68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d6b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803d72:	83 ec 0c             	sub    $0xc,%esp
+  803d75:	50                   	push   %eax
+  803d76:	e8 e3 cd ff ff       	call   800b5e <fd2num>
+  803d7b:	83 c4 10             	add    $0x10,%esp
+}
+  803d7e:	c9                   	leave
+  803d7f:	c3                   	ret
+
+00803d80 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  803d80:	55                   	push   %ebp
+  803d81:	89 e5                	mov    %esp,%ebp
+  803d83:	56                   	push   %esi
+  803d84:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  803d85:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  803d88:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  803d8e:	e8 2a c9 ff ff       	call   8006bd <sys_getenvid>
+  803d93:	83 ec 0c             	sub    $0xc,%esp
+  803d96:	ff 75 0c             	push   0xc(%ebp)
+  803d99:	ff 75 08             	push   0x8(%ebp)
+  803d9c:	56                   	push   %esi
+  803d9d:	50                   	push   %eax
+  803d9e:	68 78 54 80 00       	push   $0x805478
+  803da3:	e8 b3 00 00 00       	call   803e5b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  803da8:	83 c4 18             	add    $0x18,%esp
+  803dab:	53                   	push   %ebx
+  803dac:	ff 75 10             	push   0x10(%ebp)
+  803daf:	e8 56 00 00 00       	call   803e0a <vcprintf>
+	cprintf("\n");
+  803db4:	c7 04 24 5d 54 80 00 	movl   $0x80545d,(%esp)
+  803dbb:	e8 9b 00 00 00       	call   803e5b <cprintf>
+  803dc0:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  803dc3:	cc                   	int3
+	while (1)
+  803dc4:	eb fd                	jmp    803dc3 <_panic+0x43>
+
+00803dc6 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  803dc6:	55                   	push   %ebp
+  803dc7:	89 e5                	mov    %esp,%ebp
+  803dc9:	53                   	push   %ebx
+  803dca:	83 ec 04             	sub    $0x4,%esp
+  803dcd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  803dd0:	8b 13                	mov    (%ebx),%edx
+  803dd2:	8d 42 01             	lea    0x1(%edx),%eax
+  803dd5:	89 03                	mov    %eax,(%ebx)
+  803dd7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803dda:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  803dde:	3d ff 00 00 00       	cmp    $0xff,%eax
+  803de3:	74 09                	je     803dee <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  803de5:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  803de9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803dec:	c9                   	leave
+  803ded:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  803dee:	83 ec 08             	sub    $0x8,%esp
+  803df1:	68 ff 00 00 00       	push   $0xff
+  803df6:	8d 43 08             	lea    0x8(%ebx),%eax
+  803df9:	50                   	push   %eax
+  803dfa:	e8 40 c8 ff ff       	call   80063f <sys_cputs>
+		b->idx = 0;
+  803dff:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	eb db                	jmp    803de5 <putch+0x1f>
+
+00803e0a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  803e0a:	55                   	push   %ebp
+  803e0b:	89 e5                	mov    %esp,%ebp
+  803e0d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  803e13:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  803e1a:	00 00 00 
+	b.cnt = 0;
+  803e1d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  803e24:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  803e27:	ff 75 0c             	push   0xc(%ebp)
+  803e2a:	ff 75 08             	push   0x8(%ebp)
+  803e2d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  803e33:	50                   	push   %eax
+  803e34:	68 c6 3d 80 00       	push   $0x803dc6
+  803e39:	e8 1c 01 00 00       	call   803f5a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  803e3e:	83 c4 08             	add    $0x8,%esp
+  803e41:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  803e47:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  803e4d:	50                   	push   %eax
+  803e4e:	e8 ec c7 ff ff       	call   80063f <sys_cputs>
+
+	return b.cnt;
+}
+  803e53:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  803e59:	c9                   	leave
+  803e5a:	c3                   	ret
+
+00803e5b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  803e5b:	55                   	push   %ebp
+  803e5c:	89 e5                	mov    %esp,%ebp
+  803e5e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  803e61:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  803e64:	50                   	push   %eax
+  803e65:	ff 75 08             	push   0x8(%ebp)
+  803e68:	e8 9d ff ff ff       	call   803e0a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  803e6d:	c9                   	leave
+  803e6e:	c3                   	ret
+
+00803e6f <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  803e6f:	55                   	push   %ebp
+  803e70:	89 e5                	mov    %esp,%ebp
+  803e72:	57                   	push   %edi
+  803e73:	56                   	push   %esi
+  803e74:	53                   	push   %ebx
+  803e75:	83 ec 1c             	sub    $0x1c,%esp
+  803e78:	89 c3                	mov    %eax,%ebx
+  803e7a:	89 d6                	mov    %edx,%esi
+  803e7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e82:	89 d1                	mov    %edx,%ecx
+  803e84:	89 c2                	mov    %eax,%edx
+  803e86:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803e89:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803e8c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  803e8f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803e92:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803e99:	39 c2                	cmp    %eax,%edx
+  803e9b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  803e9e:	73 4b                	jae    803eeb <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  803ea0:	8b 45 14             	mov    0x14(%ebp),%eax
+  803ea3:	8d 78 ff             	lea    -0x1(%eax),%edi
+  803ea6:	85 ff                	test   %edi,%edi
+  803ea8:	7e 11                	jle    803ebb <printnum+0x4c>
+			putch(padc, putdat);
+  803eaa:	83 ec 08             	sub    $0x8,%esp
+  803ead:	56                   	push   %esi
+  803eae:	ff 75 18             	push   0x18(%ebp)
+  803eb1:	ff d3                	call   *%ebx
+		while (--width > 0)
+  803eb3:	83 c4 10             	add    $0x10,%esp
+  803eb6:	83 ef 01             	sub    $0x1,%edi
+  803eb9:	75 ef                	jne    803eaa <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  803ebb:	83 ec 08             	sub    $0x8,%esp
+  803ebe:	56                   	push   %esi
+  803ebf:	83 ec 04             	sub    $0x4,%esp
+  803ec2:	ff 75 e4             	push   -0x1c(%ebp)
+  803ec5:	ff 75 e0             	push   -0x20(%ebp)
+  803ec8:	ff 75 dc             	push   -0x24(%ebp)
+  803ecb:	ff 75 d8             	push   -0x28(%ebp)
+  803ece:	e8 4f 12 00 00       	call   805122 <__umoddi3>
+  803ed3:	83 c4 14             	add    $0x14,%esp
+  803ed6:	0f be 80 9b 54 80 00 	movsbl 0x80549b(%eax),%eax
+  803edd:	50                   	push   %eax
+  803ede:	ff d3                	call   *%ebx
+}
+  803ee0:	83 c4 10             	add    $0x10,%esp
+  803ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ee6:	5b                   	pop    %ebx
+  803ee7:	5e                   	pop    %esi
+  803ee8:	5f                   	pop    %edi
+  803ee9:	5d                   	pop    %ebp
+  803eea:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  803eeb:	83 ec 0c             	sub    $0xc,%esp
+  803eee:	ff 75 18             	push   0x18(%ebp)
+  803ef1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  803ef4:	8d 57 ff             	lea    -0x1(%edi),%edx
+  803ef7:	52                   	push   %edx
+  803ef8:	50                   	push   %eax
+  803ef9:	83 ec 08             	sub    $0x8,%esp
+  803efc:	ff 75 e4             	push   -0x1c(%ebp)
+  803eff:	ff 75 e0             	push   -0x20(%ebp)
+  803f02:	ff 75 dc             	push   -0x24(%ebp)
+  803f05:	ff 75 d8             	push   -0x28(%ebp)
+  803f08:	e8 4f 11 00 00       	call   80505c <__udivdi3>
+  803f0d:	83 c4 18             	add    $0x18,%esp
+  803f10:	52                   	push   %edx
+  803f11:	50                   	push   %eax
+  803f12:	89 f2                	mov    %esi,%edx
+  803f14:	89 d8                	mov    %ebx,%eax
+  803f16:	e8 54 ff ff ff       	call   803e6f <printnum>
+  803f1b:	83 c4 20             	add    $0x20,%esp
+  803f1e:	eb 9b                	jmp    803ebb <printnum+0x4c>
+
+00803f20 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  803f20:	55                   	push   %ebp
+  803f21:	89 e5                	mov    %esp,%ebp
+  803f23:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  803f26:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  803f2a:	8b 10                	mov    (%eax),%edx
+  803f2c:	3b 50 04             	cmp    0x4(%eax),%edx
+  803f2f:	73 0a                	jae    803f3b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  803f31:	8d 4a 01             	lea    0x1(%edx),%ecx
+  803f34:	89 08                	mov    %ecx,(%eax)
+  803f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f39:	88 02                	mov    %al,(%edx)
+}
+  803f3b:	5d                   	pop    %ebp
+  803f3c:	c3                   	ret
+
+00803f3d <printfmt>:
+{
+  803f3d:	55                   	push   %ebp
+  803f3e:	89 e5                	mov    %esp,%ebp
+  803f40:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  803f43:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  803f46:	50                   	push   %eax
+  803f47:	ff 75 10             	push   0x10(%ebp)
+  803f4a:	ff 75 0c             	push   0xc(%ebp)
+  803f4d:	ff 75 08             	push   0x8(%ebp)
+  803f50:	e8 05 00 00 00       	call   803f5a <vprintfmt>
+}
+  803f55:	83 c4 10             	add    $0x10,%esp
+  803f58:	c9                   	leave
+  803f59:	c3                   	ret
+
+00803f5a <vprintfmt>:
+{
+  803f5a:	55                   	push   %ebp
+  803f5b:	89 e5                	mov    %esp,%ebp
+  803f5d:	57                   	push   %edi
+  803f5e:	56                   	push   %esi
+  803f5f:	53                   	push   %ebx
+  803f60:	83 ec 2c             	sub    $0x2c,%esp
+  803f63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803f66:	89 df                	mov    %ebx,%edi
+  803f68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803f6b:	8b 45 10             	mov    0x10(%ebp),%eax
+  803f6e:	8d 70 01             	lea    0x1(%eax),%esi
+  803f71:	0f b6 00             	movzbl (%eax),%eax
+  803f74:	83 f8 25             	cmp    $0x25,%eax
+  803f77:	74 1e                	je     803f97 <vprintfmt+0x3d>
+			if (ch == '\0')
+  803f79:	85 c0                	test   %eax,%eax
+  803f7b:	0f 84 15 05 00 00    	je     804496 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  803f81:	83 ec 08             	sub    $0x8,%esp
+  803f84:	53                   	push   %ebx
+  803f85:	50                   	push   %eax
+  803f86:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  803f88:	83 c6 01             	add    $0x1,%esi
+  803f8b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  803f8f:	83 c4 10             	add    $0x10,%esp
+  803f92:	83 f8 25             	cmp    $0x25,%eax
+  803f95:	75 e2                	jne    803f79 <vprintfmt+0x1f>
+		padc = ' ';
+  803f97:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  803f9b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  803fa2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  803fa9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  803fb0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803fb5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  803fb8:	8d 56 01             	lea    0x1(%esi),%edx
+  803fbb:	0f b6 0e             	movzbl (%esi),%ecx
+  803fbe:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  803fc1:	3c 55                	cmp    $0x55,%al
+  803fc3:	0f 87 3b 04 00 00    	ja     804404 <vprintfmt+0x4aa>
+  803fc9:	0f b6 c0             	movzbl %al,%eax
+  803fcc:	ff 24 85 00 56 80 00 	jmp    *0x805600(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  803fd3:	89 75 10             	mov    %esi,0x10(%ebp)
+  803fd6:	eb 93                	jmp    803f6b <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  803fd8:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  803fda:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  803fde:	eb d8                	jmp    803fb8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  803fe0:	89 d6                	mov    %edx,%esi
+  803fe2:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  803fe6:	eb d0                	jmp    803fb8 <vprintfmt+0x5e>
+  803fe8:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  803feb:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  803fee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  803ff1:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  803ff5:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  803ff8:	83 f9 09             	cmp    $0x9,%ecx
+  803ffb:	77 6f                	ja     80406c <vprintfmt+0x112>
+  803ffd:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  804000:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  804003:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  804006:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80400a:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80400d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  804010:	83 fe 09             	cmp    $0x9,%esi
+  804013:	76 eb                	jbe    804000 <vprintfmt+0xa6>
+  804015:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  804018:	89 d6                	mov    %edx,%esi
+  80401a:	eb 13                	jmp    80402f <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80401c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80401f:	8b 00                	mov    (%eax),%eax
+  804021:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804024:	8b 45 14             	mov    0x14(%ebp),%eax
+  804027:	8d 40 04             	lea    0x4(%eax),%eax
+  80402a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80402d:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80402f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804033:	79 83                	jns    803fb8 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  804035:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804038:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80403b:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  804042:	e9 71 ff ff ff       	jmp    803fb8 <vprintfmt+0x5e>
+			if (width < 0)
+  804047:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80404a:	85 c9                	test   %ecx,%ecx
+  80404c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804051:	0f 49 c1             	cmovns %ecx,%eax
+  804054:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  804057:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  804059:	e9 5a ff ff ff       	jmp    803fb8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80405e:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  804060:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  804067:	e9 4c ff ff ff       	jmp    803fb8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80406c:	89 d6                	mov    %edx,%esi
+  80406e:	eb bf                	jmp    80402f <vprintfmt+0xd5>
+			lflag++;
+  804070:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  804074:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  804076:	e9 3d ff ff ff       	jmp    803fb8 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80407b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80407e:	8b 45 14             	mov    0x14(%ebp),%eax
+  804081:	8d 70 04             	lea    0x4(%eax),%esi
+  804084:	83 ec 08             	sub    $0x8,%esp
+  804087:	53                   	push   %ebx
+  804088:	ff 30                	push   (%eax)
+  80408a:	ff d7                	call   *%edi
+			break;
+  80408c:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80408f:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  804092:	e9 d4 fe ff ff       	jmp    803f6b <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  804097:	89 55 10             	mov    %edx,0x10(%ebp)
+  80409a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80409d:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8040a0:	8b 10                	mov    (%eax),%edx
+  8040a2:	89 d0                	mov    %edx,%eax
+  8040a4:	f7 d8                	neg    %eax
+  8040a6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8040a9:	83 f8 12             	cmp    $0x12,%eax
+  8040ac:	7f 23                	jg     8040d1 <vprintfmt+0x177>
+  8040ae:	8b 14 85 60 57 80 00 	mov    0x805760(,%eax,4),%edx
+  8040b5:	85 d2                	test   %edx,%edx
+  8040b7:	74 18                	je     8040d1 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8040b9:	52                   	push   %edx
+  8040ba:	68 73 53 80 00       	push   $0x805373
+  8040bf:	53                   	push   %ebx
+  8040c0:	57                   	push   %edi
+  8040c1:	e8 77 fe ff ff       	call   803f3d <printfmt>
+  8040c6:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8040c9:	89 75 14             	mov    %esi,0x14(%ebp)
+  8040cc:	e9 9a fe ff ff       	jmp    803f6b <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8040d1:	50                   	push   %eax
+  8040d2:	68 b3 54 80 00       	push   $0x8054b3
+  8040d7:	53                   	push   %ebx
+  8040d8:	57                   	push   %edi
+  8040d9:	e8 5f fe ff ff       	call   803f3d <printfmt>
+  8040de:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8040e1:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8040e4:	e9 82 fe ff ff       	jmp    803f6b <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8040e9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8040ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040ef:	83 c0 04             	add    $0x4,%eax
+  8040f2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8040f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8040f8:	8b 00                	mov    (%eax),%eax
+  8040fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	0f 84 61 03 00 00    	je     804466 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  804105:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  804109:	7e 06                	jle    804111 <vprintfmt+0x1b7>
+  80410b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80410f:	75 29                	jne    80413a <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804111:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804114:	8d 70 01             	lea    0x1(%eax),%esi
+  804117:	0f b6 00             	movzbl (%eax),%eax
+  80411a:	0f be d0             	movsbl %al,%edx
+  80411d:	85 d2                	test   %edx,%edx
+  80411f:	0f 84 bb 00 00 00    	je     8041e0 <vprintfmt+0x286>
+  804125:	89 7d 08             	mov    %edi,0x8(%ebp)
+  804128:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80412b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80412e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804131:	eb 7a                	jmp    8041ad <vprintfmt+0x253>
+				p = "(null)";
+  804133:	c7 45 d0 ac 54 80 00 	movl   $0x8054ac,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80413a:	83 ec 08             	sub    $0x8,%esp
+  80413d:	ff 75 d4             	push   -0x2c(%ebp)
+  804140:	ff 75 d0             	push   -0x30(%ebp)
+  804143:	e8 55 c1 ff ff       	call   80029d <strnlen>
+  804148:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80414b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80414e:	83 c4 10             	add    $0x10,%esp
+  804151:	85 d2                	test   %edx,%edx
+  804153:	0f 8e d6 02 00 00    	jle    80442f <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  804159:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80415d:	83 ec 08             	sub    $0x8,%esp
+  804160:	53                   	push   %ebx
+  804161:	56                   	push   %esi
+  804162:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  804164:	83 c4 10             	add    $0x10,%esp
+  804167:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80416b:	75 f0                	jne    80415d <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80416d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804170:	8d 70 01             	lea    0x1(%eax),%esi
+  804173:	0f b6 00             	movzbl (%eax),%eax
+  804176:	0f be d0             	movsbl %al,%edx
+  804179:	85 d2                	test   %edx,%edx
+  80417b:	0f 84 da 02 00 00    	je     80445b <vprintfmt+0x501>
+  804181:	89 7d 08             	mov    %edi,0x8(%ebp)
+  804184:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  804187:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80418a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80418d:	eb 1e                	jmp    8041ad <vprintfmt+0x253>
+					putch(ch, putdat);
+  80418f:	83 ec 08             	sub    $0x8,%esp
+  804192:	ff 75 0c             	push   0xc(%ebp)
+  804195:	52                   	push   %edx
+  804196:	ff 55 08             	call   *0x8(%ebp)
+  804199:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80419c:	83 eb 01             	sub    $0x1,%ebx
+  80419f:	83 c6 01             	add    $0x1,%esi
+  8041a2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8041a6:	0f be d0             	movsbl %al,%edx
+  8041a9:	85 d2                	test   %edx,%edx
+  8041ab:	74 2a                	je     8041d7 <vprintfmt+0x27d>
+  8041ad:	85 ff                	test   %edi,%edi
+  8041af:	78 05                	js     8041b6 <vprintfmt+0x25c>
+  8041b1:	83 ef 01             	sub    $0x1,%edi
+  8041b4:	78 59                	js     80420f <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8041b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8041ba:	74 d3                	je     80418f <vprintfmt+0x235>
+  8041bc:	0f be c0             	movsbl %al,%eax
+  8041bf:	83 e8 20             	sub    $0x20,%eax
+  8041c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8041c5:	76 c8                	jbe    80418f <vprintfmt+0x235>
+					putch('?', putdat);
+  8041c7:	83 ec 08             	sub    $0x8,%esp
+  8041ca:	ff 75 0c             	push   0xc(%ebp)
+  8041cd:	6a 3f                	push   $0x3f
+  8041cf:	ff 55 08             	call   *0x8(%ebp)
+  8041d2:	83 c4 10             	add    $0x10,%esp
+  8041d5:	eb c5                	jmp    80419c <vprintfmt+0x242>
+  8041d7:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8041da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8041dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8041e0:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8041e3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8041e7:	7e 1b                	jle    804204 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8041e9:	83 ec 08             	sub    $0x8,%esp
+  8041ec:	53                   	push   %ebx
+  8041ed:	6a 20                	push   $0x20
+  8041ef:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8041f1:	83 c4 10             	add    $0x10,%esp
+  8041f4:	83 ee 01             	sub    $0x1,%esi
+  8041f7:	75 f0                	jne    8041e9 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8041f9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8041fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8041ff:	e9 67 fd ff ff       	jmp    803f6b <vprintfmt+0x11>
+  804204:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  804207:	89 45 14             	mov    %eax,0x14(%ebp)
+  80420a:	e9 5c fd ff ff       	jmp    803f6b <vprintfmt+0x11>
+  80420f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  804212:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804215:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804218:	eb c6                	jmp    8041e0 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80421a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80421d:	89 55 10             	mov    %edx,0x10(%ebp)
+  804220:	83 f9 01             	cmp    $0x1,%ecx
+  804223:	7f 1f                	jg     804244 <vprintfmt+0x2ea>
+	else if (lflag)
+  804225:	85 c9                	test   %ecx,%ecx
+  804227:	74 67                	je     804290 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  804229:	8b 45 14             	mov    0x14(%ebp),%eax
+  80422c:	8b 30                	mov    (%eax),%esi
+  80422e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  804231:	89 f0                	mov    %esi,%eax
+  804233:	c1 f8 1f             	sar    $0x1f,%eax
+  804236:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804239:	8b 45 14             	mov    0x14(%ebp),%eax
+  80423c:	8d 40 04             	lea    0x4(%eax),%eax
+  80423f:	89 45 14             	mov    %eax,0x14(%ebp)
+  804242:	eb 17                	jmp    80425b <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  804244:	8b 45 14             	mov    0x14(%ebp),%eax
+  804247:	8b 50 04             	mov    0x4(%eax),%edx
+  80424a:	8b 00                	mov    (%eax),%eax
+  80424c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80424f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  804252:	8b 45 14             	mov    0x14(%ebp),%eax
+  804255:	8d 40 08             	lea    0x8(%eax),%eax
+  804258:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80425b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80425e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  804261:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  804266:	85 c9                	test   %ecx,%ecx
+  804268:	0f 89 12 01 00 00    	jns    804380 <vprintfmt+0x426>
+				putch('-', putdat);
+  80426e:	83 ec 08             	sub    $0x8,%esp
+  804271:	53                   	push   %ebx
+  804272:	6a 2d                	push   $0x2d
+  804274:	ff d7                	call   *%edi
+				num = -(long long) num;
+  804276:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  804279:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80427c:	f7 da                	neg    %edx
+  80427e:	83 d1 00             	adc    $0x0,%ecx
+  804281:	f7 d9                	neg    %ecx
+  804283:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  804286:	be 0a 00 00 00       	mov    $0xa,%esi
+  80428b:	e9 f0 00 00 00       	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  804290:	8b 45 14             	mov    0x14(%ebp),%eax
+  804293:	8b 30                	mov    (%eax),%esi
+  804295:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  804298:	89 f0                	mov    %esi,%eax
+  80429a:	c1 f8 1f             	sar    $0x1f,%eax
+  80429d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8042a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8042a6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8042a9:	eb b0                	jmp    80425b <vprintfmt+0x301>
+	if (lflag >= 2)
+  8042ab:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8042ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  8042b1:	83 f9 01             	cmp    $0x1,%ecx
+  8042b4:	7f 1e                	jg     8042d4 <vprintfmt+0x37a>
+	else if (lflag)
+  8042b6:	85 c9                	test   %ecx,%ecx
+  8042b8:	74 32                	je     8042ec <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8042ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042bd:	8b 10                	mov    (%eax),%edx
+  8042bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8042c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8042ca:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8042cf:	e9 ac 00 00 00       	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8042d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042d7:	8b 10                	mov    (%eax),%edx
+  8042d9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8042dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8042df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8042e2:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8042e7:	e9 94 00 00 00       	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8042ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8042ef:	8b 10                	mov    (%eax),%edx
+  8042f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8042f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8042f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8042fc:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  804301:	eb 7d                	jmp    804380 <vprintfmt+0x426>
+	if (lflag >= 2)
+  804303:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  804306:	89 55 10             	mov    %edx,0x10(%ebp)
+  804309:	83 f9 01             	cmp    $0x1,%ecx
+  80430c:	7f 1b                	jg     804329 <vprintfmt+0x3cf>
+	else if (lflag)
+  80430e:	85 c9                	test   %ecx,%ecx
+  804310:	74 2c                	je     80433e <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  804312:	8b 45 14             	mov    0x14(%ebp),%eax
+  804315:	8b 10                	mov    (%eax),%edx
+  804317:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80431c:	8d 40 04             	lea    0x4(%eax),%eax
+  80431f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  804322:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  804327:	eb 57                	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  804329:	8b 45 14             	mov    0x14(%ebp),%eax
+  80432c:	8b 10                	mov    (%eax),%edx
+  80432e:	8b 48 04             	mov    0x4(%eax),%ecx
+  804331:	8d 40 08             	lea    0x8(%eax),%eax
+  804334:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  804337:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80433c:	eb 42                	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80433e:	8b 45 14             	mov    0x14(%ebp),%eax
+  804341:	8b 10                	mov    (%eax),%edx
+  804343:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804348:	8d 40 04             	lea    0x4(%eax),%eax
+  80434b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80434e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  804353:	eb 2b                	jmp    804380 <vprintfmt+0x426>
+			putch('0', putdat);
+  804355:	89 55 10             	mov    %edx,0x10(%ebp)
+  804358:	83 ec 08             	sub    $0x8,%esp
+  80435b:	53                   	push   %ebx
+  80435c:	6a 30                	push   $0x30
+  80435e:	ff d7                	call   *%edi
+			putch('x', putdat);
+  804360:	83 c4 08             	add    $0x8,%esp
+  804363:	53                   	push   %ebx
+  804364:	6a 78                	push   $0x78
+  804366:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  804368:	8b 45 14             	mov    0x14(%ebp),%eax
+  80436b:	8b 10                	mov    (%eax),%edx
+  80436d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  804372:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  804375:	8d 40 04             	lea    0x4(%eax),%eax
+  804378:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80437b:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  804380:	83 ec 0c             	sub    $0xc,%esp
+  804383:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  804387:	50                   	push   %eax
+  804388:	ff 75 e4             	push   -0x1c(%ebp)
+  80438b:	56                   	push   %esi
+  80438c:	51                   	push   %ecx
+  80438d:	52                   	push   %edx
+  80438e:	89 da                	mov    %ebx,%edx
+  804390:	89 f8                	mov    %edi,%eax
+  804392:	e8 d8 fa ff ff       	call   803e6f <printnum>
+			break;
+  804397:	83 c4 20             	add    $0x20,%esp
+  80439a:	e9 cc fb ff ff       	jmp    803f6b <vprintfmt+0x11>
+	if (lflag >= 2)
+  80439f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8043a2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8043a5:	83 f9 01             	cmp    $0x1,%ecx
+  8043a8:	7f 1b                	jg     8043c5 <vprintfmt+0x46b>
+	else if (lflag)
+  8043aa:	85 c9                	test   %ecx,%ecx
+  8043ac:	74 2c                	je     8043da <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8043ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8043b1:	8b 10                	mov    (%eax),%edx
+  8043b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8043b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8043bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8043be:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8043c3:	eb bb                	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8043c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8043c8:	8b 10                	mov    (%eax),%edx
+  8043ca:	8b 48 04             	mov    0x4(%eax),%ecx
+  8043cd:	8d 40 08             	lea    0x8(%eax),%eax
+  8043d0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8043d3:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8043d8:	eb a6                	jmp    804380 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8043da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8043dd:	8b 10                	mov    (%eax),%edx
+  8043df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8043e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8043e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8043ea:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8043ef:	eb 8f                	jmp    804380 <vprintfmt+0x426>
+			putch(ch, putdat);
+  8043f1:	89 55 10             	mov    %edx,0x10(%ebp)
+  8043f4:	83 ec 08             	sub    $0x8,%esp
+  8043f7:	53                   	push   %ebx
+  8043f8:	6a 25                	push   $0x25
+  8043fa:	ff d7                	call   *%edi
+			break;
+  8043fc:	83 c4 10             	add    $0x10,%esp
+  8043ff:	e9 67 fb ff ff       	jmp    803f6b <vprintfmt+0x11>
+			putch('%', putdat);
+  804404:	83 ec 08             	sub    $0x8,%esp
+  804407:	53                   	push   %ebx
+  804408:	6a 25                	push   $0x25
+  80440a:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80440c:	83 c4 10             	add    $0x10,%esp
+  80440f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  804413:	0f 84 ba fb ff ff    	je     803fd3 <vprintfmt+0x79>
+  804419:	89 75 10             	mov    %esi,0x10(%ebp)
+  80441c:	89 f0                	mov    %esi,%eax
+  80441e:	83 e8 01             	sub    $0x1,%eax
+  804421:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  804425:	75 f7                	jne    80441e <vprintfmt+0x4c4>
+  804427:	89 45 10             	mov    %eax,0x10(%ebp)
+  80442a:	e9 3c fb ff ff       	jmp    803f6b <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80442f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804432:	8d 70 01             	lea    0x1(%eax),%esi
+  804435:	0f b6 00             	movzbl (%eax),%eax
+  804438:	0f be d0             	movsbl %al,%edx
+  80443b:	85 d2                	test   %edx,%edx
+  80443d:	74 11                	je     804450 <vprintfmt+0x4f6>
+  80443f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  804442:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  804445:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  804448:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80444b:	e9 5d fd ff ff       	jmp    8041ad <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  804450:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  804453:	89 45 14             	mov    %eax,0x14(%ebp)
+  804456:	e9 10 fb ff ff       	jmp    803f6b <vprintfmt+0x11>
+  80445b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80445e:	89 45 14             	mov    %eax,0x14(%ebp)
+  804461:	e9 05 fb ff ff       	jmp    803f6b <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  804466:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80446a:	7e 0a                	jle    804476 <vprintfmt+0x51c>
+  80446c:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  804470:	0f 85 bd fc ff ff    	jne    804133 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  804476:	ba 28 00 00 00       	mov    $0x28,%edx
+  80447b:	b8 28 00 00 00       	mov    $0x28,%eax
+  804480:	be ad 54 80 00       	mov    $0x8054ad,%esi
+  804485:	89 7d 08             	mov    %edi,0x8(%ebp)
+  804488:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80448b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80448e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804491:	e9 17 fd ff ff       	jmp    8041ad <vprintfmt+0x253>
+}
+  804496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804499:	5b                   	pop    %ebx
+  80449a:	5e                   	pop    %esi
+  80449b:	5f                   	pop    %edi
+  80449c:	5d                   	pop    %ebp
+  80449d:	c3                   	ret
+
+0080449e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80449e:	55                   	push   %ebp
+  80449f:	89 e5                	mov    %esp,%ebp
+  8044a1:	83 ec 18             	sub    $0x18,%esp
+  8044a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8044aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8044ad:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8044b1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8044b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8044bb:	85 c0                	test   %eax,%eax
+  8044bd:	74 26                	je     8044e5 <vsnprintf+0x47>
+  8044bf:	85 d2                	test   %edx,%edx
+  8044c1:	7e 22                	jle    8044e5 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8044c3:	ff 75 14             	push   0x14(%ebp)
+  8044c6:	ff 75 10             	push   0x10(%ebp)
+  8044c9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8044cc:	50                   	push   %eax
+  8044cd:	68 20 3f 80 00       	push   $0x803f20
+  8044d2:	e8 83 fa ff ff       	call   803f5a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8044d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8044da:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8044dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044e0:	83 c4 10             	add    $0x10,%esp
+}
+  8044e3:	c9                   	leave
+  8044e4:	c3                   	ret
+		return -E_INVAL;
+  8044e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8044ea:	eb f7                	jmp    8044e3 <vsnprintf+0x45>
+
+008044ec <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8044ec:	55                   	push   %ebp
+  8044ed:	89 e5                	mov    %esp,%ebp
+  8044ef:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8044f2:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8044f5:	50                   	push   %eax
+  8044f6:	ff 75 10             	push   0x10(%ebp)
+  8044f9:	ff 75 0c             	push   0xc(%ebp)
+  8044fc:	ff 75 08             	push   0x8(%ebp)
+  8044ff:	e8 9a ff ff ff       	call   80449e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  804504:	c9                   	leave
+  804505:	c3                   	ret
+
+00804506 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  804506:	85 c0                	test   %eax,%eax
+  804508:	74 20                	je     80452a <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80450a:	89 c1                	mov    %eax,%ecx
+  80450c:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  804512:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  804518:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80451e:	8b 52 48             	mov    0x48(%edx),%edx
+  804521:	39 c2                	cmp    %eax,%edx
+  804523:	74 06                	je     80452b <thread_alive+0x25>
+  804525:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80452a:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80452b:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  804531:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  804537:	85 c0                	test   %eax,%eax
+  804539:	0f 95 c0             	setne  %al
+  80453c:	0f b6 c0             	movzbl %al,%eax
+  80453f:	c3                   	ret
+
+00804540 <pgfault>:
+{
+  804540:	55                   	push   %ebp
+  804541:	89 e5                	mov    %esp,%ebp
+  804543:	57                   	push   %edi
+  804544:	56                   	push   %esi
+  804545:	53                   	push   %ebx
+  804546:	83 ec 0c             	sub    $0xc,%esp
+  804549:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80454c:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80454e:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  804551:	89 f3                	mov    %esi,%ebx
+  804553:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  804556:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  80455d:	74 52                	je     8045b1 <pgfault+0x71>
+  80455f:	a8 02                	test   $0x2,%al
+  804561:	75 14                	jne    804577 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  804563:	83 ec 04             	sub    $0x4,%esp
+  804566:	68 cb 57 80 00       	push   $0x8057cb
+  80456b:	6a 2e                	push   $0x2e
+  80456d:	68 e9 57 80 00       	push   $0x8057e9
+  804572:	e8 09 f8 ff ff       	call   803d80 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  804577:	89 d8                	mov    %ebx,%eax
+  804579:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80457e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  804585:	83 ec 0c             	sub    $0xc,%esp
+  804588:	57                   	push   %edi
+  804589:	e8 a6 f4 ff ff       	call   803a34 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80458e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  804595:	83 e0 03             	and    $0x3,%eax
+  804598:	83 c4 10             	add    $0x10,%esp
+  80459b:	83 f8 03             	cmp    $0x3,%eax
+  80459e:	75 1a                	jne    8045ba <pgfault+0x7a>
+			mutex_unlock(m);
+  8045a0:	83 ec 0c             	sub    $0xc,%esp
+  8045a3:	57                   	push   %edi
+  8045a4:	e8 f9 f4 ff ff       	call   803aa2 <mutex_unlock>
+			return;
+  8045a9:	83 c4 10             	add    $0x10,%esp
+  8045ac:	e9 9f 00 00 00       	jmp    804650 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8045b1:	a8 02                	test   $0x2,%al
+  8045b3:	74 ae                	je     804563 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8045b5:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8045ba:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8045c1:	f6 c4 08             	test   $0x8,%ah
+  8045c4:	74 9d                	je     804563 <pgfault+0x23>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8045c6:	89 e0                	mov    %esp,%eax
+  8045c8:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8045cd:	29 c2                	sub    %eax,%edx
+  8045cf:	89 d0                	mov    %edx,%eax
+  8045d1:	c1 e8 0f             	shr    $0xf,%eax
+  8045d4:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8045da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045df:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8045e2:	c1 e0 0c             	shl    $0xc,%eax
+  8045e5:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8045ea:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8045ec:	83 ec 04             	sub    $0x4,%esp
+  8045ef:	6a 07                	push   $0x7
+  8045f1:	53                   	push   %ebx
+  8045f2:	6a 00                	push   $0x0
+  8045f4:	e8 02 c1 ff ff       	call   8006fb <sys_page_alloc>
+  8045f9:	83 c4 10             	add    $0x10,%esp
+  8045fc:	85 c0                	test   %eax,%eax
+  8045fe:	78 58                	js     804658 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  804600:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804606:	83 ec 04             	sub    $0x4,%esp
+  804609:	68 00 10 00 00       	push   $0x1000
+  80460e:	56                   	push   %esi
+  80460f:	53                   	push   %ebx
+  804610:	e8 62 be ff ff       	call   800477 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  804615:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80461c:	56                   	push   %esi
+  80461d:	6a 00                	push   $0x0
+  80461f:	53                   	push   %ebx
+  804620:	6a 00                	push   $0x0
+  804622:	e8 17 c1 ff ff       	call   80073e <sys_page_map>
+  804627:	83 c4 20             	add    $0x20,%esp
+  80462a:	85 c0                	test   %eax,%eax
+  80462c:	78 3c                	js     80466a <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  80462e:	83 ec 08             	sub    $0x8,%esp
+  804631:	53                   	push   %ebx
+  804632:	6a 00                	push   $0x0
+  804634:	e8 47 c1 ff ff       	call   800780 <sys_page_unmap>
+  804639:	83 c4 10             	add    $0x10,%esp
+  80463c:	85 c0                	test   %eax,%eax
+  80463e:	78 3c                	js     80467c <pgfault+0x13c>
+	if(m)
+  804640:	85 ff                	test   %edi,%edi
+  804642:	74 0c                	je     804650 <pgfault+0x110>
+		mutex_unlock(m);
+  804644:	83 ec 0c             	sub    $0xc,%esp
+  804647:	57                   	push   %edi
+  804648:	e8 55 f4 ff ff       	call   803aa2 <mutex_unlock>
+  80464d:	83 c4 10             	add    $0x10,%esp
+}
+  804650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804653:	5b                   	pop    %ebx
+  804654:	5e                   	pop    %esi
+  804655:	5f                   	pop    %edi
+  804656:	5d                   	pop    %ebp
+  804657:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  804658:	50                   	push   %eax
+  804659:	68 f4 57 80 00       	push   $0x8057f4
+  80465e:	6a 3d                	push   $0x3d
+  804660:	68 e9 57 80 00       	push   $0x8057e9
+  804665:	e8 16 f7 ff ff       	call   803d80 <_panic>
+		panic("sys_page_map: %e", ret);
+  80466a:	50                   	push   %eax
+  80466b:	68 07 58 80 00       	push   $0x805807
+  804670:	6a 40                	push   $0x40
+  804672:	68 e9 57 80 00       	push   $0x8057e9
+  804677:	e8 04 f7 ff ff       	call   803d80 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80467c:	50                   	push   %eax
+  80467d:	68 18 58 80 00       	push   $0x805818
+  804682:	6a 42                	push   $0x42
+  804684:	68 e9 57 80 00       	push   $0x8057e9
+  804689:	e8 f2 f6 ff ff       	call   803d80 <_panic>
+
+0080468e <thread_main>:
+{
+  80468e:	55                   	push   %ebp
+  80468f:	89 e5                	mov    %esp,%ebp
+  804691:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  804694:	ff 75 0c             	push   0xc(%ebp)
+  804697:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80469a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8046a1:	e8 d6 bf ff ff       	call   80067c <sys_env_destroy>
+}
+  8046a6:	83 c4 10             	add    $0x10,%esp
+  8046a9:	c9                   	leave
+  8046aa:	c3                   	ret
+
+008046ab <fork>:
+{
+  8046ab:	55                   	push   %ebp
+  8046ac:	89 e5                	mov    %esp,%ebp
+  8046ae:	57                   	push   %edi
+  8046af:	56                   	push   %esi
+  8046b0:	53                   	push   %ebx
+  8046b1:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8046b4:	68 40 45 80 00       	push   $0x804540
+  8046b9:	e8 3a 09 00 00       	call   804ff8 <set_pgfault_handler>
+	if(sforked)
+  8046be:	83 c4 10             	add    $0x10,%esp
+  8046c1:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  8046c8:	75 33                	jne    8046fd <fork+0x52>
+	__asm __volatile("int %2"
+  8046ca:	b8 07 00 00 00       	mov    $0x7,%eax
+  8046cf:	cd 30                	int    $0x30
+  8046d1:	89 c7                	mov    %eax,%edi
+  8046d3:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8046d5:	85 c0                	test   %eax,%eax
+  8046d7:	0f 88 b4 00 00 00    	js     804791 <fork+0xe6>
+	if(envid == 0) {
+  8046dd:	0f 84 c3 00 00 00    	je     8047a6 <fork+0xfb>
+	pgbatch_init(&pb);
+  8046e3:	83 ec 0c             	sub    $0xc,%esp
+  8046e6:	68 60 7f 80 00       	push   $0x807f60
+  8046eb:	e8 90 f1 ff ff       	call   803880 <pgbatch_init>
+  8046f0:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8046f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8046f8:	e9 9c 01 00 00       	jmp    804899 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8046fd:	83 ec 0c             	sub    $0xc,%esp
+  804700:	68 00 83 80 00       	push   $0x808300
+  804705:	e8 2a f3 ff ff       	call   803a34 <mutex_lock>
+  80470a:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80470d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804712:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  804717:	eb 08                	jmp    804721 <fork+0x76>
+  804719:	83 c3 01             	add    $0x1,%ebx
+  80471c:	83 fb 20             	cmp    $0x20,%ebx
+  80471f:	74 5b                	je     80477c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  804721:	8b 34 9d 80 82 80 00 	mov    0x808280(,%ebx,4),%esi
+  804728:	89 f0                	mov    %esi,%eax
+  80472a:	e8 d7 fd ff ff       	call   804506 <thread_alive>
+  80472f:	85 c0                	test   %eax,%eax
+  804731:	74 e6                	je     804719 <fork+0x6e>
+  804733:	89 e0                	mov    %esp,%eax
+  804735:	89 fa                	mov    %edi,%edx
+  804737:	29 c2                	sub    %eax,%edx
+  804739:	89 d0                	mov    %edx,%eax
+  80473b:	c1 e8 0f             	shr    $0xf,%eax
+  80473e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804744:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804749:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80474c:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804753:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  804756:	83 ec 08             	sub    $0x8,%esp
+  804759:	50                   	push   %eax
+  80475a:	56                   	push   %esi
+  80475b:	e8 e6 c0 ff ff       	call   800846 <sys_env_set_pgfault_upcall>
+  804760:	83 c4 10             	add    $0x10,%esp
+  804763:	85 c0                	test   %eax,%eax
+  804765:	79 b2                	jns    804719 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  804767:	50                   	push   %eax
+  804768:	68 a4 58 80 00       	push   $0x8058a4
+  80476d:	68 00 01 00 00       	push   $0x100
+  804772:	68 e9 57 80 00       	push   $0x8057e9
+  804777:	e8 04 f6 ff ff       	call   803d80 <_panic>
+	mutex_unlock(&sfork_lock);
+  80477c:	83 ec 0c             	sub    $0xc,%esp
+  80477f:	68 00 83 80 00       	push   $0x808300
+  804784:	e8 19 f3 ff ff       	call   803aa2 <mutex_unlock>
+}
+  804789:	83 c4 10             	add    $0x10,%esp
+  80478c:	e9 39 ff ff ff       	jmp    8046ca <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  804791:	50                   	push   %eax
+  804792:	68 2b 58 80 00       	push   $0x80582b
+  804797:	68 91 00 00 00       	push   $0x91
+  80479c:	68 e9 57 80 00       	push   $0x8057e9
+  8047a1:	e8 da f5 ff ff       	call   803d80 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8047a6:	e8 12 bf ff ff       	call   8006bd <sys_getenvid>
+  8047ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8047b0:	89 e1                	mov    %esp,%ecx
+  8047b2:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8047b7:	29 ca                	sub    %ecx,%edx
+  8047b9:	89 d1                	mov    %edx,%ecx
+  8047bb:	c1 e9 0f             	shr    $0xf,%ecx
+  8047be:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8047c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047c9:	0f 42 d1             	cmovb  %ecx,%edx
+  8047cc:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8047d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8047d7:	89 04 95 20 83 80 00 	mov    %eax,0x808320(,%edx,4)
+		if(sforked)
+  8047de:	a1 04 b0 80 00       	mov    0x80b004,%eax
+  8047e3:	85 c0                	test   %eax,%eax
+  8047e5:	75 07                	jne    8047ee <fork+0x143>
+		return 0;
+  8047e7:	89 c6                	mov    %eax,%esi
+  8047e9:	e9 6f 02 00 00       	jmp    804a5d <fork+0x3b2>
+  8047ee:	89 e2                	mov    %esp,%edx
+  8047f0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8047f5:	29 d0                	sub    %edx,%eax
+  8047f7:	89 c3                	mov    %eax,%ebx
+  8047f9:	c1 eb 0f             	shr    $0xf,%ebx
+  8047fc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804801:	b8 00 00 00 00       	mov    $0x0,%eax
+  804806:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  804809:	83 ec 04             	sub    $0x4,%esp
+  80480c:	68 80 00 00 00       	push   $0x80
+  804811:	6a 00                	push   $0x0
+  804813:	68 80 82 80 00       	push   $0x808280
+  804818:	e8 25 bc ff ff       	call   800442 <memset>
+	thread_ids[slot] = sys_getenvid();
+  80481d:	e8 9b be ff ff       	call   8006bd <sys_getenvid>
+  804822:	89 04 9d 80 82 80 00 	mov    %eax,0x808280(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  804829:	8b 04 9d 20 83 80 00 	mov    0x808320(,%ebx,4),%eax
+  804830:	a3 20 83 80 00       	mov    %eax,0x808320
+	mutex_init(&sfork_lock);
+  804835:	c7 04 24 00 83 80 00 	movl   $0x808300,(%esp)
+  80483c:	e8 e5 f1 ff ff       	call   803a26 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804841:	83 c4 0c             	add    $0xc,%esp
+  804844:	68 07 04 00 00       	push   $0x407
+  804849:	68 00 00 00 e1       	push   $0xe1000000
+  80484e:	6a 00                	push   $0x0
+  804850:	e8 a6 be ff ff       	call   8006fb <sys_page_alloc>
+  804855:	83 c4 10             	add    $0x10,%esp
+  804858:	85 c0                	test   %eax,%eax
+  80485a:	0f 89 fd 01 00 00    	jns    804a5d <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  804860:	50                   	push   %eax
+  804861:	68 f4 57 80 00       	push   $0x8057f4
+  804866:	68 12 01 00 00       	push   $0x112
+  80486b:	68 e9 57 80 00       	push   $0x8057e9
+  804870:	e8 0b f5 ff ff       	call   803d80 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  804875:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80487b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  804881:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  804887:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80488d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  804893:	0f 87 4f 01 00 00    	ja     8049e8 <fork+0x33d>
+		pd = PDX(addr);
+  804899:	89 d8                	mov    %ebx,%eax
+  80489b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80489e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8048a5:	f6 c2 01             	test   $0x1,%dl
+  8048a8:	74 cb                	je     804875 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8048aa:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8048af:	0f 85 92 00 00 00    	jne    804947 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8048b5:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8048bb:	76 10                	jbe    8048cd <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8048bd:	89 d8                	mov    %ebx,%eax
+  8048bf:	f7 d8                	neg    %eax
+  8048c1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8048c6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8048cb:	74 ba                	je     804887 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8048cd:	89 d8                	mov    %ebx,%eax
+  8048cf:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8048d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8048d9:	f6 c2 01             	test   $0x1,%dl
+  8048dc:	74 a9                	je     804887 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8048de:	89 c1                	mov    %eax,%ecx
+  8048e0:	c1 e1 0c             	shl    $0xc,%ecx
+  8048e3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8048e6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8048ed:	f6 c6 04             	test   $0x4,%dh
+  8048f0:	0f 85 8e 00 00 00    	jne    804984 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8048f6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8048fd:	f6 c6 08             	test   $0x8,%dh
+  804900:	75 0f                	jne    804911 <fork+0x266>
+  804902:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804909:	a8 02                	test   $0x2,%al
+  80490b:	0f 84 bb 00 00 00    	je     8049cc <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  804911:	83 ec 08             	sub    $0x8,%esp
+  804914:	68 05 08 00 00       	push   $0x805
+  804919:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80491c:	50                   	push   %eax
+  80491d:	56                   	push   %esi
+  80491e:	50                   	push   %eax
+  80491f:	6a 00                	push   $0x0
+  804921:	68 60 7f 80 00       	push   $0x807f60
+  804926:	e8 13 f0 ff ff       	call   80393e <pgbatch_map>
+  80492b:	83 c4 20             	add    $0x20,%esp
+  80492e:	85 c0                	test   %eax,%eax
+  804930:	79 76                	jns    8049a8 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  804932:	50                   	push   %eax
+  804933:	68 4f 58 80 00       	push   $0x80584f
+  804938:	68 bc 00 00 00       	push   $0xbc
+  80493d:	68 e9 57 80 00       	push   $0x8057e9
+  804942:	e8 39 f4 ff ff       	call   803d80 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  804947:	83 ec 0c             	sub    $0xc,%esp
+  80494a:	68 00 08 00 00       	push   $0x800
+  80494f:	56                   	push   %esi
+  804950:	53                   	push   %ebx
+  804951:	6a 00                	push   $0x0
+  804953:	68 60 7f 80 00       	push   $0x807f60
+  804958:	e8 8c f0 ff ff       	call   8039e9 <pgbatch_sharept>
+  80495d:	83 c4 20             	add    $0x20,%esp
+  804960:	85 c0                	test   %eax,%eax
+  804962:	78 0b                	js     80496f <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  804964:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80496a:	e9 18 ff ff ff       	jmp    804887 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80496f:	50                   	push   %eax
+  804970:	68 3b 58 80 00       	push   $0x80583b
+  804975:	68 b2 00 00 00       	push   $0xb2
+  80497a:	68 e9 57 80 00       	push   $0x8057e9
+  80497f:	e8 fc f3 ff ff       	call   803d80 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  804984:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80498b:	83 ec 08             	sub    $0x8,%esp
+  80498e:	25 07 0e 00 00       	and    $0xe07,%eax
+  804993:	50                   	push   %eax
+  804994:	51                   	push   %ecx
+  804995:	56                   	push   %esi
+  804996:	51                   	push   %ecx
+  804997:	6a 00                	push   $0x0
+  804999:	68 60 7f 80 00       	push   $0x807f60
+  80499e:	e8 9b ef ff ff       	call   80393e <pgbatch_map>
+  8049a3:	83 c4 20             	add    $0x20,%esp
+  8049a6:	eb 17                	jmp    8049bf <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8049a8:	68 05 08 00 00       	push   $0x805
+  8049ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8049b0:	6a 00                	push   $0x0
+  8049b2:	68 60 7f 80 00       	push   $0x807f60
+  8049b7:	e8 f6 ef ff ff       	call   8039b2 <pgbatch_protect>
+  8049bc:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8049bf:	85 c0                	test   %eax,%eax
+  8049c1:	0f 89 c0 fe ff ff    	jns    804887 <fork+0x1dc>
+  8049c7:	e9 66 ff ff ff       	jmp    804932 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8049cc:	83 ec 08             	sub    $0x8,%esp
+  8049cf:	6a 05                	push   $0x5
+  8049d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049d4:	50                   	push   %eax
+  8049d5:	56                   	push   %esi
+  8049d6:	50                   	push   %eax
+  8049d7:	6a 00                	push   $0x0
+  8049d9:	68 60 7f 80 00       	push   $0x807f60
+  8049de:	e8 5b ef ff ff       	call   80393e <pgbatch_map>
+  8049e3:	83 c4 20             	add    $0x20,%esp
+  8049e6:	eb d7                	jmp    8049bf <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8049e8:	6a 07                	push   $0x7
+  8049ea:	68 00 f0 bf ee       	push   $0xeebff000
+  8049ef:	57                   	push   %edi
+  8049f0:	68 60 7f 80 00       	push   $0x807f60
+  8049f5:	e8 0d ef ff ff       	call   803907 <pgbatch_alloc>
+  8049fa:	83 c4 10             	add    $0x10,%esp
+  8049fd:	85 c0                	test   %eax,%eax
+  8049ff:	78 66                	js     804a67 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  804a01:	83 ec 0c             	sub    $0xc,%esp
+  804a04:	68 60 7f 80 00       	push   $0x807f60
+  804a09:	e8 80 ee ff ff       	call   80388e <pgbatch_flush>
+  804a0e:	83 c4 10             	add    $0x10,%esp
+  804a11:	85 c0                	test   %eax,%eax
+  804a13:	78 52                	js     804a67 <fork+0x3bc>
+  804a15:	89 e2                	mov    %esp,%edx
+  804a17:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804a1c:	29 d0                	sub    %edx,%eax
+  804a1e:	89 c2                	mov    %eax,%edx
+  804a20:	c1 ea 0f             	shr    $0xf,%edx
+  804a23:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804a28:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a2d:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  804a30:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804a37:	8b 40 78             	mov    0x78(%eax),%eax
+  804a3a:	83 ec 08             	sub    $0x8,%esp
+  804a3d:	50                   	push   %eax
+  804a3e:	57                   	push   %edi
+  804a3f:	e8 02 be ff ff       	call   800846 <sys_env_set_pgfault_upcall>
+  804a44:	83 c4 10             	add    $0x10,%esp
+  804a47:	85 c0                	test   %eax,%eax
+  804a49:	78 31                	js     804a7c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  804a4b:	83 ec 08             	sub    $0x8,%esp
+  804a4e:	6a 02                	push   $0x2
+  804a50:	57                   	push   %edi
+  804a51:	e8 6c bd ff ff       	call   8007c2 <sys_env_set_status>
+  804a56:	83 c4 10             	add    $0x10,%esp
+  804a59:	85 c0                	test   %eax,%eax
+  804a5b:	78 34                	js     804a91 <fork+0x3e6>
+}
+  804a5d:	89 f0                	mov    %esi,%eax
+  804a5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a62:	5b                   	pop    %ebx
+  804a63:	5e                   	pop    %esi
+  804a64:	5f                   	pop    %edi
+  804a65:	5d                   	pop    %ebp
+  804a66:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  804a67:	50                   	push   %eax
+  804a68:	68 5b 58 80 00       	push   $0x80585b
+  804a6d:	68 c0 00 00 00       	push   $0xc0
+  804a72:	68 e9 57 80 00       	push   $0x8057e9
+  804a77:	e8 04 f3 ff ff       	call   803d80 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  804a7c:	50                   	push   %eax
+  804a7d:	68 70 58 80 00       	push   $0x805870
+  804a82:	68 c2 00 00 00       	push   $0xc2
+  804a87:	68 e9 57 80 00       	push   $0x8057e9
+  804a8c:	e8 ef f2 ff ff       	call   803d80 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  804a91:	50                   	push   %eax
+  804a92:	68 8b 58 80 00       	push   $0x80588b
+  804a97:	68 c4 00 00 00       	push   $0xc4
+  804a9c:	68 e9 57 80 00       	push   $0x8057e9
+  804aa1:	e8 da f2 ff ff       	call   803d80 <_panic>
+
+00804aa6 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  804aa6:	55                   	push   %ebp
+  804aa7:	89 e5                	mov    %esp,%ebp
+  804aa9:	57                   	push   %edi
+  804aaa:	56                   	push   %esi
+  804aab:	53                   	push   %ebx
+  804aac:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  804aaf:	68 00 83 80 00       	push   $0x808300
+  804ab4:	e8 7b ef ff ff       	call   803a34 <mutex_lock>
+  804ab9:	89 e2                	mov    %esp,%edx
+  804abb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ac0:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  804ac2:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  804ac5:	89 c3                	mov    %eax,%ebx
+  804ac7:	c1 eb 0f             	shr    $0xf,%ebx
+  804aca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ad4:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  804ad7:	e8 e1 bb ff ff       	call   8006bd <sys_getenvid>
+  804adc:	89 04 9d 80 82 80 00 	mov    %eax,0x808280(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  804ae3:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804ae8:	8b 04 9d 80 82 80 00 	mov    0x808280(,%ebx,4),%eax
+  804aef:	e8 12 fa ff ff       	call   804506 <thread_alive>
+  804af4:	85 c0                	test   %eax,%eax
+  804af6:	74 24                	je     804b1c <sfork+0x76>
+  804af8:	83 c3 01             	add    $0x1,%ebx
+  804afb:	83 fb 20             	cmp    $0x20,%ebx
+  804afe:	75 e8                	jne    804ae8 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  804b00:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  804b05:	83 ec 0c             	sub    $0xc,%esp
+  804b08:	68 00 83 80 00       	push   $0x808300
+  804b0d:	e8 90 ef ff ff       	call   803aa2 <mutex_unlock>
+	return r;
+}
+  804b12:	89 f0                	mov    %esi,%eax
+  804b14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b17:	5b                   	pop    %ebx
+  804b18:	5e                   	pop    %esi
+  804b19:	5f                   	pop    %edi
+  804b1a:	5d                   	pop    %ebp
+  804b1b:	c3                   	ret
+	if (i == NTHREADS) {
+  804b1c:	83 fb 20             	cmp    $0x20,%ebx
+  804b1f:	0f 84 53 01 00 00    	je     804c78 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  804b25:	89 d8                	mov    %ebx,%eax
+  804b27:	c1 e0 0f             	shl    $0xf,%eax
+  804b2a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  804b2d:	83 ec 0c             	sub    $0xc,%esp
+  804b30:	68 40 7c 80 00       	push   $0x807c40
+  804b35:	e8 46 ed ff ff       	call   803880 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  804b3a:	83 c4 10             	add    $0x10,%esp
+  804b3d:	83 3d 04 b0 80 00 00 	cmpl   $0x0,0x80b004
+  804b44:	75 1f                	jne    804b65 <sfork+0xbf>
+  804b46:	68 07 04 00 00       	push   $0x407
+  804b4b:	68 00 00 00 e1       	push   $0xe1000000
+  804b50:	6a 00                	push   $0x0
+  804b52:	68 40 7c 80 00       	push   $0x807c40
+  804b57:	e8 ab ed ff ff       	call   803907 <pgbatch_alloc>
+  804b5c:	89 c6                	mov    %eax,%esi
+  804b5e:	83 c4 10             	add    $0x10,%esp
+  804b61:	85 c0                	test   %eax,%eax
+  804b63:	78 a0                	js     804b05 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  804b65:	6a 07                	push   $0x7
+  804b67:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  804b6c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804b6f:	29 c8                	sub    %ecx,%eax
+  804b71:	50                   	push   %eax
+  804b72:	6a 00                	push   $0x0
+  804b74:	68 40 7c 80 00       	push   $0x807c40
+  804b79:	e8 89 ed ff ff       	call   803907 <pgbatch_alloc>
+  804b7e:	89 c6                	mov    %eax,%esi
+  804b80:	83 c4 10             	add    $0x10,%esp
+  804b83:	85 c0                	test   %eax,%eax
+  804b85:	0f 88 7a ff ff ff    	js     804b05 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  804b8b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  804b90:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804b93:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  804b95:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804b9a:	29 c8                	sub    %ecx,%eax
+  804b9c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b9f:	39 c7                	cmp    %eax,%edi
+  804ba1:	73 29                	jae    804bcc <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  804ba3:	6a 07                	push   $0x7
+  804ba5:	57                   	push   %edi
+  804ba6:	6a 00                	push   $0x0
+  804ba8:	68 40 7c 80 00       	push   $0x807c40
+  804bad:	e8 55 ed ff ff       	call   803907 <pgbatch_alloc>
+  804bb2:	89 c6                	mov    %eax,%esi
+  804bb4:	83 c4 10             	add    $0x10,%esp
+  804bb7:	85 c0                	test   %eax,%eax
+  804bb9:	0f 88 46 ff ff ff    	js     804b05 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  804bbf:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804bc5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804bc8:	39 c7                	cmp    %eax,%edi
+  804bca:	72 d7                	jb     804ba3 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  804bcc:	83 ec 0c             	sub    $0xc,%esp
+  804bcf:	68 40 7c 80 00       	push   $0x807c40
+  804bd4:	e8 b5 ec ff ff       	call   80388e <pgbatch_flush>
+  804bd9:	89 c6                	mov    %eax,%esi
+  804bdb:	83 c4 10             	add    $0x10,%esp
+  804bde:	85 c0                	test   %eax,%eax
+  804be0:	0f 88 1f ff ff ff    	js     804b05 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  804be6:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  804beb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  804bee:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  804bf0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  804bf6:	8b 55 08             	mov    0x8(%ebp),%edx
+  804bf9:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  804bfc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804bff:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  804c02:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  804c05:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804c0a:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  804c0c:	52                   	push   %edx
+  804c0d:	50                   	push   %eax
+  804c0e:	68 8e 46 80 00       	push   $0x80468e
+  804c13:	e8 24 bf ff ff       	call   800b3c <sys_exofork_shared>
+  804c18:	89 c6                	mov    %eax,%esi
+  804c1a:	83 c4 10             	add    $0x10,%esp
+  804c1d:	85 c0                	test   %eax,%eax
+  804c1f:	0f 88 e0 fe ff ff    	js     804b05 <sfork+0x5f>
+	thread_ids[i] = id;
+  804c25:	89 04 9d 80 82 80 00 	mov    %eax,0x808280(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  804c2c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c31:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804c37:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804c3c:	89 04 9d 20 83 80 00 	mov    %eax,0x808320(,%ebx,4)
+	sforked = 1;
+  804c43:	c7 05 04 b0 80 00 01 	movl   $0x1,0x80b004
+  804c4a:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  804c4d:	83 ec 08             	sub    $0x8,%esp
+  804c50:	6a 02                	push   $0x2
+  804c52:	56                   	push   %esi
+  804c53:	e8 6a bb ff ff       	call   8007c2 <sys_env_set_status>
+  804c58:	89 c3                	mov    %eax,%ebx
+  804c5a:	83 c4 10             	add    $0x10,%esp
+  804c5d:	85 c0                	test   %eax,%eax
+  804c5f:	0f 89 a0 fe ff ff    	jns    804b05 <sfork+0x5f>
+		sys_env_destroy(id);
+  804c65:	83 ec 0c             	sub    $0xc,%esp
+  804c68:	56                   	push   %esi
+  804c69:	e8 0e ba ff ff       	call   80067c <sys_env_destroy>
+		goto out;
+  804c6e:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  804c71:	89 de                	mov    %ebx,%esi
+		goto out;
+  804c73:	e9 8d fe ff ff       	jmp    804b05 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  804c78:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  804c7d:	e9 83 fe ff ff       	jmp    804b05 <sfork+0x5f>
+
+00804c82 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804c82:	55                   	push   %ebp
+  804c83:	89 e5                	mov    %esp,%ebp
+  804c85:	56                   	push   %esi
+  804c86:	53                   	push   %ebx
+  804c87:	8b 75 08             	mov    0x8(%ebp),%esi
+  804c8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804c8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804c90:	85 c0                	test   %eax,%eax
+  804c92:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804c97:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804c9a:	83 ec 0c             	sub    $0xc,%esp
+  804c9d:	50                   	push   %eax
+  804c9e:	e8 08 bc ff ff       	call   8008ab <sys_ipc_recv>
+  804ca3:	83 c4 10             	add    $0x10,%esp
+  804ca6:	85 c0                	test   %eax,%eax
+  804ca8:	0f 88 8b 00 00 00    	js     804d39 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804cae:	85 f6                	test   %esi,%esi
+  804cb0:	74 2a                	je     804cdc <ipc_recv+0x5a>
+  804cb2:	89 e2                	mov    %esp,%edx
+  804cb4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804cb9:	29 d0                	sub    %edx,%eax
+  804cbb:	89 c2                	mov    %eax,%edx
+  804cbd:	c1 ea 0f             	shr    $0xf,%edx
+  804cc0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cca:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804ccd:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804cd4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804cda:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804cdc:	85 db                	test   %ebx,%ebx
+  804cde:	74 2a                	je     804d0a <ipc_recv+0x88>
+  804ce0:	89 e2                	mov    %esp,%edx
+  804ce2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ce7:	29 d0                	sub    %edx,%eax
+  804ce9:	89 c2                	mov    %eax,%edx
+  804ceb:	c1 ea 0f             	shr    $0xf,%edx
+  804cee:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804cf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf8:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804cfb:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804d02:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804d08:	89 03                	mov    %eax,(%ebx)
+  804d0a:	89 e2                	mov    %esp,%edx
+  804d0c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804d11:	29 d0                	sub    %edx,%eax
+  804d13:	89 c2                	mov    %eax,%edx
+  804d15:	c1 ea 0f             	shr    $0xf,%edx
+  804d18:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d22:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804d25:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804d2c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804d32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804d35:	5b                   	pop    %ebx
+  804d36:	5e                   	pop    %esi
+  804d37:	5d                   	pop    %ebp
+  804d38:	c3                   	ret
+		if(from_env_store != NULL)
+  804d39:	85 f6                	test   %esi,%esi
+  804d3b:	74 06                	je     804d43 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804d3d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804d43:	85 db                	test   %ebx,%ebx
+  804d45:	74 eb                	je     804d32 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804d47:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804d4d:	eb e3                	jmp    804d32 <ipc_recv+0xb0>
+
+00804d4f <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804d4f:	55                   	push   %ebp
+  804d50:	89 e5                	mov    %esp,%ebp
+  804d52:	57                   	push   %edi
+  804d53:	56                   	push   %esi
+  804d54:	53                   	push   %ebx
+  804d55:	83 ec 14             	sub    $0x14,%esp
+  804d58:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804d5e:	8b 75 14             	mov    0x14(%ebp),%esi
+  804d61:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804d64:	85 c0                	test   %eax,%eax
+  804d66:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804d6b:	0f 44 c2             	cmove  %edx,%eax
+  804d6e:	ff 75 10             	push   0x10(%ebp)
+  804d71:	50                   	push   %eax
+  804d72:	e8 96 bb ff ff       	call   80090d <sys_ipc_recv_pages>
+  804d77:	83 c4 10             	add    $0x10,%esp
+  804d7a:	85 c0                	test   %eax,%eax
+  804d7c:	0f 88 ba 00 00 00    	js     804e3c <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804d82:	85 ff                	test   %edi,%edi
+  804d84:	74 2a                	je     804db0 <ipc_recv_pages+0x61>
+  804d86:	89 e2                	mov    %esp,%edx
+  804d88:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804d8d:	29 d0                	sub    %edx,%eax
+  804d8f:	89 c2                	mov    %eax,%edx
+  804d91:	c1 ea 0f             	shr    $0xf,%edx
+  804d94:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d9e:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804da1:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804da8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804dae:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804db0:	85 f6                	test   %esi,%esi
+  804db2:	74 2a                	je     804dde <ipc_recv_pages+0x8f>
+  804db4:	89 e2                	mov    %esp,%edx
+  804db6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804dbb:	29 d0                	sub    %edx,%eax
+  804dbd:	89 c2                	mov    %eax,%edx
+  804dbf:	c1 ea 0f             	shr    $0xf,%edx
+  804dc2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcc:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804dcf:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804dd6:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804ddc:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804dde:	85 db                	test   %ebx,%ebx
+  804de0:	74 2a                	je     804e0c <ipc_recv_pages+0xbd>
+  804de2:	89 e2                	mov    %esp,%edx
+  804de4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804de9:	29 d0                	sub    %edx,%eax
+  804deb:	89 c2                	mov    %eax,%edx
+  804ded:	c1 ea 0f             	shr    $0xf,%edx
+  804df0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfa:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804dfd:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804e04:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804e0a:	89 03                	mov    %eax,(%ebx)
+  804e0c:	89 e2                	mov    %esp,%edx
+  804e0e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804e13:	29 d0                	sub    %edx,%eax
+  804e15:	89 c2                	mov    %eax,%edx
+  804e17:	c1 ea 0f             	shr    $0xf,%edx
+  804e1a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e24:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804e27:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804e2e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804e34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e37:	5b                   	pop    %ebx
+  804e38:	5e                   	pop    %esi
+  804e39:	5f                   	pop    %edi
+  804e3a:	5d                   	pop    %ebp
+  804e3b:	c3                   	ret
+		if (from_env_store)
+  804e3c:	85 ff                	test   %edi,%edi
+  804e3e:	74 06                	je     804e46 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804e40:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804e46:	85 f6                	test   %esi,%esi
+  804e48:	74 06                	je     804e50 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804e4a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804e50:	85 db                	test   %ebx,%ebx
+  804e52:	74 e0                	je     804e34 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804e54:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804e5a:	eb d8                	jmp    804e34 <ipc_recv_pages+0xe5>
+
+00804e5c <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804e5c:	55                   	push   %ebp
+  804e5d:	89 e5                	mov    %esp,%ebp
+  804e5f:	57                   	push   %edi
+  804e60:	56                   	push   %esi
+  804e61:	53                   	push   %ebx
+  804e62:	83 ec 1c             	sub    $0x1c,%esp
+  804e65:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804e68:	8b 75 08             	mov    0x8(%ebp),%esi
+  804e6b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804e71:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804e75:	75 2b                	jne    804ea2 <ipc_try_send_pages+0x46>
+  804e77:	89 e2                	mov    %esp,%edx
+  804e79:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804e7e:	29 d0                	sub    %edx,%eax
+  804e80:	89 c2                	mov    %eax,%edx
+  804e82:	c1 ea 0f             	shr    $0xf,%edx
+  804e85:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e8f:	0f 42 c2             	cmovb  %edx,%eax
+  804e92:	8b 04 85 20 83 80 00 	mov    0x808320(,%eax,4),%eax
+  804e99:	8b 70 48             	mov    0x48(%eax),%esi
+  804e9c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804ea2:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804ea8:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804ead:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804eb0:	85 ff                	test   %edi,%edi
+  804eb2:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804eb7:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804eba:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804ec0:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804ec6:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804ecc:	83 ec 0c             	sub    $0xc,%esp
+  804ecf:	ff 75 14             	push   0x14(%ebp)
+  804ed2:	ff 75 18             	push   0x18(%ebp)
+  804ed5:	57                   	push   %edi
+  804ed6:	ff 75 0c             	push   0xc(%ebp)
+  804ed9:	ff 75 08             	push   0x8(%ebp)
+  804edc:	e8 0b ba ff ff       	call   8008ec <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804ee1:	83 c4 20             	add    $0x20,%esp
+  804ee4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804ee7:	75 21                	jne    804f0a <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804ee9:	83 ec 04             	sub    $0x4,%esp
+  804eec:	6a ff                	push   $0xffffffff
+  804eee:	53                   	push   %ebx
+  804eef:	ff 75 e4             	push   -0x1c(%ebp)
+  804ef2:	e8 02 bc ff ff       	call   800af9 <sys_futex_wait>
+  804ef7:	83 c4 10             	add    $0x10,%esp
+  804efa:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804efd:	74 c7                	je     804ec6 <ipc_try_send_pages+0x6a>
+  804eff:	85 c0                	test   %eax,%eax
+  804f01:	79 c3                	jns    804ec6 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804f03:	e8 d4 b7 ff ff       	call   8006dc <sys_yield>
+  804f08:	eb bc                	jmp    804ec6 <ipc_try_send_pages+0x6a>
+	}
+}
+  804f0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f0d:	5b                   	pop    %ebx
+  804f0e:	5e                   	pop    %esi
+  804f0f:	5f                   	pop    %edi
+  804f10:	5d                   	pop    %ebp
+  804f11:	c3                   	ret
+
+00804f12 <ipc_send>:
+{
+  804f12:	55                   	push   %ebp
+  804f13:	89 e5                	mov    %esp,%ebp
+  804f15:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804f18:	ff 75 14             	push   0x14(%ebp)
+  804f1b:	6a 01                	push   $0x1
+  804f1d:	ff 75 10             	push   0x10(%ebp)
+  804f20:	ff 75 0c             	push   0xc(%ebp)
+  804f23:	ff 75 08             	push   0x8(%ebp)
+  804f26:	e8 31 ff ff ff       	call   804e5c <ipc_try_send_pages>
+  804f2b:	83 c4 20             	add    $0x20,%esp
+  804f2e:	85 c0                	test   %eax,%eax
+  804f30:	78 02                	js     804f34 <ipc_send+0x22>
+}
+  804f32:	c9                   	leave
+  804f33:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804f34:	50                   	push   %eax
+  804f35:	68 c3 58 80 00       	push   $0x8058c3
+  804f3a:	6a 3f                	push   $0x3f
+  804f3c:	68 d8 58 80 00       	push   $0x8058d8
+  804f41:	e8 3a ee ff ff       	call   803d80 <_panic>
+
+00804f46 <ipc_send_pages>:
+{
+  804f46:	55                   	push   %ebp
+  804f47:	89 e5                	mov    %esp,%ebp
+  804f49:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804f4c:	ff 75 18             	push   0x18(%ebp)
+  804f4f:	ff 75 14             	push   0x14(%ebp)
+  804f52:	ff 75 10             	push   0x10(%ebp)
+  804f55:	ff 75 0c             	push   0xc(%ebp)
+  804f58:	ff 75 08             	push   0x8(%ebp)
+  804f5b:	e8 fc fe ff ff       	call   804e5c <ipc_try_send_pages>
+  804f60:	83 c4 20             	add    $0x20,%esp
+  804f63:	85 c0                	test   %eax,%eax
+  804f65:	78 02                	js     804f69 <ipc_send_pages+0x23>
+}
+  804f67:	c9                   	leave
+  804f68:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804f69:	50                   	push   %eax
+  804f6a:	68 e2 58 80 00       	push   $0x8058e2
+  804f6f:	6a 64                	push   $0x64
+  804f71:	68 d8 58 80 00       	push   $0x8058d8
+  804f76:	e8 05 ee ff ff       	call   803d80 <_panic>
+
+00804f7b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804f7b:	55                   	push   %ebp
+  804f7c:	89 e5                	mov    %esp,%ebp
+  804f7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804f81:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804f86:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804f8c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804f92:	8b 52 50             	mov    0x50(%edx),%edx
+  804f95:	39 ca                	cmp    %ecx,%edx
+  804f97:	74 11                	je     804faa <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804f99:	83 c0 01             	add    $0x1,%eax
+  804f9c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804fa1:	75 e3                	jne    804f86 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa8:	eb 0e                	jmp    804fb8 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804faa:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804fb0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804fb5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804fb8:	5d                   	pop    %ebp
+  804fb9:	c3                   	ret
+
+00804fba <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804fba:	55                   	push   %ebp
+  804fbb:	89 e5                	mov    %esp,%ebp
+  804fbd:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804fc0:	89 c2                	mov    %eax,%edx
+  804fc2:	c1 ea 16             	shr    $0x16,%edx
+  804fc5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804fd1:	f6 c1 01             	test   $0x1,%cl
+  804fd4:	74 1e                	je     804ff4 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804fd6:	c1 e8 0c             	shr    $0xc,%eax
+  804fd9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804fe0:	a8 01                	test   $0x1,%al
+  804fe2:	74 10                	je     804ff4 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804fe4:	c1 e8 0c             	shr    $0xc,%eax
+  804fe7:	c1 e0 04             	shl    $0x4,%eax
+  804fea:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804ff1:	0f b7 d2             	movzwl %dx,%edx
+}
+  804ff4:	89 d0                	mov    %edx,%eax
+  804ff6:	5d                   	pop    %ebp
+  804ff7:	c3                   	ret
+
+00804ff8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804ff8:	55                   	push   %ebp
+  804ff9:	89 e5                	mov    %esp,%ebp
+  804ffb:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804ffe:	83 3d 08 b0 80 00 00 	cmpl   $0x0,0x80b008
+  805005:	74 0a                	je     805011 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805007:	8b 45 08             	mov    0x8(%ebp),%eax
+  80500a:	a3 08 b0 80 00       	mov    %eax,0x80b008
+}
+  80500f:	c9                   	leave
+  805010:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  805011:	83 ec 04             	sub    $0x4,%esp
+  805014:	6a 07                	push   $0x7
+  805016:	68 00 f0 bf ee       	push   $0xeebff000
+  80501b:	6a 00                	push   $0x0
+  80501d:	e8 d9 b6 ff ff       	call   8006fb <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805022:	83 c4 08             	add    $0x8,%esp
+  805025:	68 36 50 80 00       	push   $0x805036
+  80502a:	6a 00                	push   $0x0
+  80502c:	e8 15 b8 ff ff       	call   800846 <sys_env_set_pgfault_upcall>
+  805031:	83 c4 10             	add    $0x10,%esp
+  805034:	eb d1                	jmp    805007 <set_pgfault_handler+0xf>
+
+00805036 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805036:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805037:	a1 08 b0 80 00       	mov    0x80b008,%eax
+	call *%eax
+  80503c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80503e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  805041:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  805045:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  805048:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80504c:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80504e:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  805052:	83 c4 08             	add    $0x8,%esp
+	popal;
+  805055:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  805056:	83 c4 04             	add    $0x4,%esp
+	popf
+  805059:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80505a:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80505b:	c3                   	ret
+
+0080505c <__udivdi3>:
+  80505c:	57                   	push   %edi
+  80505d:	56                   	push   %esi
+  80505e:	53                   	push   %ebx
+  80505f:	83 ec 20             	sub    $0x20,%esp
+  805062:	8b 44 24 30          	mov    0x30(%esp),%eax
+  805066:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80506a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80506e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805072:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805076:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80507a:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80507e:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805082:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80508c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805091:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805098:	00 
+  805099:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8050a0:	00 
+  8050a1:	eb 08                	jmp    8050ab <__udivdi3+0x4f>
+  8050a3:	83 e9 01             	sub    $0x1,%ecx
+  8050a6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8050a9:	74 68                	je     805113 <__udivdi3+0xb7>
+  8050ab:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8050af:	01 c0                	add    %eax,%eax
+  8050b1:	89 c6                	mov    %eax,%esi
+  8050b3:	89 d7                	mov    %edx,%edi
+  8050b5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8050b9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8050bd:	0f ad d0             	shrd   %cl,%edx,%eax
+  8050c0:	d3 ea                	shr    %cl,%edx
+  8050c2:	f6 c1 20             	test   $0x20,%cl
+  8050c5:	74 04                	je     8050cb <__udivdi3+0x6f>
+  8050c7:	89 d0                	mov    %edx,%eax
+  8050c9:	31 d2                	xor    %edx,%edx
+  8050cb:	83 e0 01             	and    $0x1,%eax
+  8050ce:	89 04 24             	mov    %eax,(%esp)
+  8050d1:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8050d8:	00 
+  8050d9:	8b 04 24             	mov    (%esp),%eax
+  8050dc:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8050e0:	09 f0                	or     %esi,%eax
+  8050e2:	09 fa                	or     %edi,%edx
+  8050e4:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8050e8:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8050ec:	39 f0                	cmp    %esi,%eax
+  8050ee:	89 d3                	mov    %edx,%ebx
+  8050f0:	19 fb                	sbb    %edi,%ebx
+  8050f2:	72 af                	jb     8050a3 <__udivdi3+0x47>
+  8050f4:	29 f0                	sub    %esi,%eax
+  8050f6:	19 fa                	sbb    %edi,%edx
+  8050f8:	89 cf                	mov    %ecx,%edi
+  8050fa:	c1 ef 05             	shr    $0x5,%edi
+  8050fd:	83 e7 01             	and    $0x1,%edi
+  805100:	89 fe                	mov    %edi,%esi
+  805102:	83 f6 01             	xor    $0x1,%esi
+  805105:	d3 e6                	shl    %cl,%esi
+  805107:	d3 e7                	shl    %cl,%edi
+  805109:	09 74 24 18          	or     %esi,0x18(%esp)
+  80510d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805111:	eb 90                	jmp    8050a3 <__udivdi3+0x47>
+  805113:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805117:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80511b:	83 c4 20             	add    $0x20,%esp
+  80511e:	5b                   	pop    %ebx
+  80511f:	5e                   	pop    %esi
+  805120:	5f                   	pop    %edi
+  805121:	c3                   	ret
+
+00805122 <__umoddi3>:
+  805122:	57                   	push   %edi
+  805123:	56                   	push   %esi
+  805124:	53                   	push   %ebx
+  805125:	83 ec 08             	sub    $0x8,%esp
+  805128:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80512c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805130:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805134:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  805138:	57                   	push   %edi
+  805139:	56                   	push   %esi
+  80513a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80513e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805142:	52                   	push   %edx
+  805143:	50                   	push   %eax
+  805144:	e8 13 ff ff ff       	call   80505c <__udivdi3>
+  805149:	89 c3                	mov    %eax,%ebx
+  80514b:	0f af d6             	imul   %esi,%edx
+  80514e:	89 f9                	mov    %edi,%ecx
+  805150:	0f af cb             	imul   %ebx,%ecx
+  805153:	01 d1                	add    %edx,%ecx
+  805155:	89 d8                	mov    %ebx,%eax
+  805157:	f7 e6                	mul    %esi
+  805159:	89 c6                	mov    %eax,%esi
+  80515b:	89 d7                	mov    %edx,%edi
+  80515d:	01 cf                	add    %ecx,%edi
+  80515f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805163:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805167:	29 f0                	sub    %esi,%eax
+  805169:	19 fa                	sbb    %edi,%edx
+  80516b:	83 c4 18             	add    $0x18,%esp
+  80516e:	5b                   	pop    %ebx
+  80516f:	5e                   	pop    %esi
+  805170:	5f                   	pop    %edi
+  805171:	c3                   	ret
+
+00805172 <__divdi3>:
+  805172:	53                   	push   %ebx
+  805173:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805177:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80517b:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80517f:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  805183:	85 d2                	test   %edx,%edx
+  805185:	78 12                	js     805199 <__divdi3+0x27>
+  805187:	85 db                	test   %ebx,%ebx
+  805189:	78 2e                	js     8051b9 <__divdi3+0x47>
+  80518b:	53                   	push   %ebx
+  80518c:	51                   	push   %ecx
+  80518d:	52                   	push   %edx
+  80518e:	50                   	push   %eax
+  80518f:	e8 c8 fe ff ff       	call   80505c <__udivdi3>
+  805194:	83 c4 10             	add    $0x10,%esp
+  805197:	eb 1e                	jmp    8051b7 <__divdi3+0x45>
+  805199:	f7 d8                	neg    %eax
+  80519b:	83 d2 00             	adc    $0x0,%edx
+  80519e:	f7 da                	neg    %edx
+  8051a0:	85 db                	test   %ebx,%ebx
+  8051a2:	78 2a                	js     8051ce <__divdi3+0x5c>
+  8051a4:	53                   	push   %ebx
+  8051a5:	51                   	push   %ecx
+  8051a6:	52                   	push   %edx
+  8051a7:	50                   	push   %eax
+  8051a8:	e8 af fe ff ff       	call   80505c <__udivdi3>
+  8051ad:	83 c4 10             	add    $0x10,%esp
+  8051b0:	f7 d8                	neg    %eax
+  8051b2:	83 d2 00             	adc    $0x0,%edx
+  8051b5:	f7 da                	neg    %edx
+  8051b7:	5b                   	pop    %ebx
+  8051b8:	c3                   	ret
+  8051b9:	f7 d9                	neg    %ecx
+  8051bb:	83 d3 00             	adc    $0x0,%ebx
+  8051be:	f7 db                	neg    %ebx
+  8051c0:	53                   	push   %ebx
+  8051c1:	51                   	push   %ecx
+  8051c2:	52                   	push   %edx
+  8051c3:	50                   	push   %eax
+  8051c4:	e8 93 fe ff ff       	call   80505c <__udivdi3>
+  8051c9:	83 c4 10             	add    $0x10,%esp
+  8051cc:	eb e2                	jmp    8051b0 <__divdi3+0x3e>
+  8051ce:	f7 d9                	neg    %ecx
+  8051d0:	83 d3 00             	adc    $0x0,%ebx
+  8051d3:	f7 db                	neg    %ebx
+  8051d5:	53                   	push   %ebx
+  8051d6:	51                   	push   %ecx
+  8051d7:	52                   	push   %edx
+  8051d8:	50                   	push   %eax
+  8051d9:	e8 7e fe ff ff       	call   80505c <__udivdi3>
+  8051de:	83 c4 10             	add    $0x10,%esp
+  8051e1:	eb d4                	jmp    8051b7 <__divdi3+0x45>
+
+008051e3 <__moddi3>:
+  8051e3:	57                   	push   %edi
+  8051e4:	56                   	push   %esi
+  8051e5:	53                   	push   %ebx
+  8051e6:	83 ec 08             	sub    $0x8,%esp
+  8051e9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8051ed:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8051f1:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8051f5:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8051f9:	57                   	push   %edi
+  8051fa:	56                   	push   %esi
+  8051fb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051ff:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805203:	52                   	push   %edx
+  805204:	50                   	push   %eax
+  805205:	e8 68 ff ff ff       	call   805172 <__divdi3>
+  80520a:	89 c3                	mov    %eax,%ebx
+  80520c:	0f af d6             	imul   %esi,%edx
+  80520f:	89 f9                	mov    %edi,%ecx
+  805211:	0f af cb             	imul   %ebx,%ecx
+  805214:	01 d1                	add    %edx,%ecx
+  805216:	89 d8                	mov    %ebx,%eax
+  805218:	f7 e6                	mul    %esi
+  80521a:	89 c6                	mov    %eax,%esi
+  80521c:	89 d7                	mov    %edx,%edi
+  80521e:	01 cf                	add    %ecx,%edi
+  805220:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805224:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805228:	29 f0                	sub    %esi,%eax
+  80522a:	19 fa                	sbb    %edi,%edx
+  80522c:	83 c4 18             	add    $0x18,%esp
+  80522f:	5b                   	pop    %ebx
+  805230:	5e                   	pop    %esi
+  805231:	5f                   	pop    %edi
+  805232:	c3                   	ret
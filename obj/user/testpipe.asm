@@ -0,0 +1,9297 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 17 03 00 00       	call   800348 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003d:	c7 05 04 50 80 00 60 	movl   $0x804760,0x805004
+  800044:	47 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800047:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  80004a:	50                   	push   %eax
+  80004b:	e8 62 3a 00 00       	call   803ab2 <pipe>
+  800050:	89 c6                	mov    %eax,%esi
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	85 c0                	test   %eax,%eax
+  800057:	0f 88 55 01 00 00    	js     8001b2 <umain+0x17d>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005d:	e8 9b 15 00 00       	call   8015fd <fork>
+  800062:	89 c3                	mov    %eax,%ebx
+  800064:	85 c0                	test   %eax,%eax
+  800066:	0f 88 58 01 00 00    	js     8001c4 <umain+0x18f>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006c:	0f 85 90 01 00 00    	jne    800202 <umain+0x1cd>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800072:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800074:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800079:	29 d0                	sub    %edx,%eax
+  80007b:	89 c2                	mov    %eax,%edx
+  80007d:	c1 ea 0f             	shr    $0xf,%edx
+  800080:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  80008d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800094:	8b 40 48             	mov    0x48(%eax),%eax
+  800097:	83 ec 04             	sub    $0x4,%esp
+  80009a:	ff 75 90             	push   -0x70(%ebp)
+  80009d:	50                   	push   %eax
+  80009e:	68 85 47 80 00       	push   $0x804785
+  8000a3:	e8 22 04 00 00       	call   8004ca <cprintf>
+		close(p[1]);
+  8000a8:	83 c4 04             	add    $0x4,%esp
+  8000ab:	ff 75 90             	push   -0x70(%ebp)
+  8000ae:	e8 dd 1c 00 00       	call   801d90 <close>
+  8000b3:	89 e2                	mov    %esp,%edx
+  8000b5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000ba:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8000bc:	83 c4 0c             	add    $0xc,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8000bf:	89 c2                	mov    %eax,%edx
+  8000c1:	c1 ea 0f             	shr    $0xf,%edx
+  8000c4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000d1:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8000d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8000db:	ff 75 8c             	push   -0x74(%ebp)
+  8000de:	50                   	push   %eax
+  8000df:	68 a2 47 80 00       	push   $0x8047a2
+  8000e4:	e8 e1 03 00 00       	call   8004ca <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000e9:	83 c4 0c             	add    $0xc,%esp
+  8000ec:	6a 63                	push   $0x63
+  8000ee:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000f1:	50                   	push   %eax
+  8000f2:	ff 75 8c             	push   -0x74(%ebp)
+  8000f5:	e8 79 1e 00 00       	call   801f73 <readn>
+  8000fa:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	85 c0                	test   %eax,%eax
+  800101:	0f 88 cf 00 00 00    	js     8001d6 <umain+0x1a1>
+			panic("read: %e", i);
+		buf[i] = 0;
+  800107:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  80010c:	83 ec 08             	sub    $0x8,%esp
+  80010f:	ff 35 00 50 80 00    	push   0x805000
+  800115:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  800118:	50                   	push   %eax
+  800119:	e8 53 0b 00 00       	call   800c71 <strcmp>
+  80011e:	83 c4 10             	add    $0x10,%esp
+  800121:	85 c0                	test   %eax,%eax
+  800123:	0f 85 bf 00 00 00    	jne    8001e8 <umain+0x1b3>
+			cprintf("\npipe read closed properly\n");
+  800129:	83 ec 0c             	sub    $0xc,%esp
+  80012c:	68 c8 47 80 00       	push   $0x8047c8
+  800131:	e8 94 03 00 00       	call   8004ca <cprintf>
+  800136:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  800139:	e8 97 02 00 00       	call   8003d5 <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  80013e:	83 ec 0c             	sub    $0xc,%esp
+  800141:	53                   	push   %ebx
+  800142:	e8 e8 3a 00 00       	call   803c2f <wait>
+
+	binaryname = "pipewriteeof";
+  800147:	c7 05 04 50 80 00 1e 	movl   $0x80481e,0x805004
+  80014e:	48 80 00 
+	if ((i = pipe(p)) < 0)
+  800151:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800154:	89 04 24             	mov    %eax,(%esp)
+  800157:	e8 56 39 00 00       	call   803ab2 <pipe>
+  80015c:	89 c6                	mov    %eax,%esi
+  80015e:	83 c4 10             	add    $0x10,%esp
+  800161:	85 c0                	test   %eax,%eax
+  800163:	0f 88 6c 01 00 00    	js     8002d5 <umain+0x2a0>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  800169:	e8 8f 14 00 00       	call   8015fd <fork>
+  80016e:	89 c3                	mov    %eax,%ebx
+  800170:	85 c0                	test   %eax,%eax
+  800172:	0f 88 6f 01 00 00    	js     8002e7 <umain+0x2b2>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  800178:	0f 84 7b 01 00 00    	je     8002f9 <umain+0x2c4>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  800181:	ff 75 8c             	push   -0x74(%ebp)
+  800184:	e8 07 1c 00 00       	call   801d90 <close>
+	close(p[1]);
+  800189:	83 c4 04             	add    $0x4,%esp
+  80018c:	ff 75 90             	push   -0x70(%ebp)
+  80018f:	e8 fc 1b 00 00       	call   801d90 <close>
+	wait(pid);
+  800194:	89 1c 24             	mov    %ebx,(%esp)
+  800197:	e8 93 3a 00 00       	call   803c2f <wait>
+
+	cprintf("pipe tests passed\n");
+  80019c:	c7 04 24 4a 48 80 00 	movl   $0x80484a,(%esp)
+  8001a3:	e8 22 03 00 00       	call   8004ca <cprintf>
+}
+  8001a8:	83 c4 10             	add    $0x10,%esp
+  8001ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ae:	5b                   	pop    %ebx
+  8001af:	5e                   	pop    %esi
+  8001b0:	5d                   	pop    %ebp
+  8001b1:	c3                   	ret
+		panic("pipe: %e", i);
+  8001b2:	50                   	push   %eax
+  8001b3:	68 6c 47 80 00       	push   $0x80476c
+  8001b8:	6a 0e                	push   $0xe
+  8001ba:	68 75 47 80 00       	push   $0x804775
+  8001bf:	e8 2b 02 00 00       	call   8003ef <_panic>
+		panic("fork: %e", i);
+  8001c4:	56                   	push   %esi
+  8001c5:	68 9d 4c 80 00       	push   $0x804c9d
+  8001ca:	6a 11                	push   $0x11
+  8001cc:	68 75 47 80 00       	push   $0x804775
+  8001d1:	e8 19 02 00 00       	call   8003ef <_panic>
+			panic("read: %e", i);
+  8001d6:	50                   	push   %eax
+  8001d7:	68 bf 47 80 00       	push   $0x8047bf
+  8001dc:	6a 19                	push   $0x19
+  8001de:	68 75 47 80 00       	push   $0x804775
+  8001e3:	e8 07 02 00 00       	call   8003ef <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001e8:	83 ec 04             	sub    $0x4,%esp
+  8001eb:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001ee:	50                   	push   %eax
+  8001ef:	56                   	push   %esi
+  8001f0:	68 e4 47 80 00       	push   $0x8047e4
+  8001f5:	e8 d0 02 00 00       	call   8004ca <cprintf>
+  8001fa:	83 c4 10             	add    $0x10,%esp
+  8001fd:	e9 37 ff ff ff       	jmp    800139 <umain+0x104>
+  800202:	89 e2                	mov    %esp,%edx
+  800204:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800209:	29 d0                	sub    %edx,%eax
+  80020b:	89 c2                	mov    %eax,%edx
+  80020d:	c1 ea 0f             	shr    $0xf,%edx
+  800210:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  80021d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800224:	8b 40 48             	mov    0x48(%eax),%eax
+  800227:	83 ec 04             	sub    $0x4,%esp
+  80022a:	ff 75 8c             	push   -0x74(%ebp)
+  80022d:	50                   	push   %eax
+  80022e:	68 85 47 80 00       	push   $0x804785
+  800233:	e8 92 02 00 00       	call   8004ca <cprintf>
+		close(p[0]);
+  800238:	83 c4 04             	add    $0x4,%esp
+  80023b:	ff 75 8c             	push   -0x74(%ebp)
+  80023e:	e8 4d 1b 00 00       	call   801d90 <close>
+  800243:	89 e2                	mov    %esp,%edx
+  800245:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80024a:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  80024c:	83 c4 0c             	add    $0xc,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80024f:	89 c2                	mov    %eax,%edx
+  800251:	c1 ea 0f             	shr    $0xf,%edx
+  800254:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025e:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800261:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800268:	8b 40 48             	mov    0x48(%eax),%eax
+  80026b:	ff 75 90             	push   -0x70(%ebp)
+  80026e:	50                   	push   %eax
+  80026f:	68 f7 47 80 00       	push   $0x8047f7
+  800274:	e8 51 02 00 00       	call   8004ca <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800279:	83 c4 04             	add    $0x4,%esp
+  80027c:	ff 35 00 50 80 00    	push   0x805000
+  800282:	e8 ee 08 00 00       	call   800b75 <strlen>
+  800287:	83 c4 0c             	add    $0xc,%esp
+  80028a:	50                   	push   %eax
+  80028b:	ff 35 00 50 80 00    	push   0x805000
+  800291:	ff 75 90             	push   -0x70(%ebp)
+  800294:	e8 2e 1d 00 00       	call   801fc7 <write>
+  800299:	89 c6                	mov    %eax,%esi
+  80029b:	83 c4 04             	add    $0x4,%esp
+  80029e:	ff 35 00 50 80 00    	push   0x805000
+  8002a4:	e8 cc 08 00 00       	call   800b75 <strlen>
+  8002a9:	83 c4 10             	add    $0x10,%esp
+  8002ac:	39 f0                	cmp    %esi,%eax
+  8002ae:	75 13                	jne    8002c3 <umain+0x28e>
+		close(p[1]);
+  8002b0:	83 ec 0c             	sub    $0xc,%esp
+  8002b3:	ff 75 90             	push   -0x70(%ebp)
+  8002b6:	e8 d5 1a 00 00       	call   801d90 <close>
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	e9 7b fe ff ff       	jmp    80013e <umain+0x109>
+			panic("write: %e", i);
+  8002c3:	56                   	push   %esi
+  8002c4:	68 14 48 80 00       	push   $0x804814
+  8002c9:	6a 25                	push   $0x25
+  8002cb:	68 75 47 80 00       	push   $0x804775
+  8002d0:	e8 1a 01 00 00       	call   8003ef <_panic>
+		panic("pipe: %e", i);
+  8002d5:	50                   	push   %eax
+  8002d6:	68 6c 47 80 00       	push   $0x80476c
+  8002db:	6a 2c                	push   $0x2c
+  8002dd:	68 75 47 80 00       	push   $0x804775
+  8002e2:	e8 08 01 00 00       	call   8003ef <_panic>
+		panic("fork: %e", i);
+  8002e7:	56                   	push   %esi
+  8002e8:	68 9d 4c 80 00       	push   $0x804c9d
+  8002ed:	6a 2f                	push   $0x2f
+  8002ef:	68 75 47 80 00       	push   $0x804775
+  8002f4:	e8 f6 00 00 00       	call   8003ef <_panic>
+		close(p[0]);
+  8002f9:	83 ec 0c             	sub    $0xc,%esp
+  8002fc:	ff 75 8c             	push   -0x74(%ebp)
+  8002ff:	e8 8c 1a 00 00       	call   801d90 <close>
+  800304:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800307:	83 ec 0c             	sub    $0xc,%esp
+  80030a:	68 2b 48 80 00       	push   $0x80482b
+  80030f:	e8 b6 01 00 00       	call   8004ca <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  800314:	83 c4 0c             	add    $0xc,%esp
+  800317:	6a 01                	push   $0x1
+  800319:	68 15 4e 80 00       	push   $0x804e15
+  80031e:	ff 75 90             	push   -0x70(%ebp)
+  800321:	e8 a1 1c 00 00       	call   801fc7 <write>
+  800326:	83 c4 10             	add    $0x10,%esp
+  800329:	83 f8 01             	cmp    $0x1,%eax
+  80032c:	74 d9                	je     800307 <umain+0x2d2>
+		cprintf("\npipe write closed properly\n");
+  80032e:	83 ec 0c             	sub    $0xc,%esp
+  800331:	68 2d 48 80 00       	push   $0x80482d
+  800336:	e8 8f 01 00 00       	call   8004ca <cprintf>
+		exit();
+  80033b:	e8 95 00 00 00       	call   8003d5 <exit>
+  800340:	83 c4 10             	add    $0x10,%esp
+  800343:	e9 36 fe ff ff       	jmp    80017e <umain+0x149>
+
+00800348 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	56                   	push   %esi
+  80034c:	53                   	push   %ebx
+  80034d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800350:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800353:	89 e2                	mov    %esp,%edx
+  800355:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80035a:	29 d0                	sub    %edx,%eax
+  80035c:	89 c2                	mov    %eax,%edx
+  80035e:	c1 ea 0f             	shr    $0xf,%edx
+  800361:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036b:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80036e:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800375:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800379:	e8 39 0c 00 00       	call   800fb7 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80037e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800383:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800389:	89 e1                	mov    %esp,%ecx
+  80038b:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800390:	29 ca                	sub    %ecx,%edx
+  800392:	89 d1                	mov    %edx,%ecx
+  800394:	c1 e9 0f             	shr    $0xf,%ecx
+  800397:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80039d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a2:	0f 42 d1             	cmovb  %ecx,%edx
+  8003a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003aa:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8003b1:	85 db                	test   %ebx,%ebx
+  8003b3:	7e 07                	jle    8003bc <libmain+0x74>
+		binaryname = argv[0];
+  8003b5:	8b 06                	mov    (%esi),%eax
+  8003b7:	a3 04 50 80 00       	mov    %eax,0x805004
+
+	// call user main routine
+	umain(argc, argv);
+  8003bc:	83 ec 08             	sub    $0x8,%esp
+  8003bf:	56                   	push   %esi
+  8003c0:	53                   	push   %ebx
+  8003c1:	e8 6f fc ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  8003c6:	e8 0a 00 00 00       	call   8003d5 <exit>
+}
+  8003cb:	83 c4 10             	add    $0x10,%esp
+  8003ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d1:	5b                   	pop    %ebx
+  8003d2:	5e                   	pop    %esi
+  8003d3:	5d                   	pop    %ebp
+  8003d4:	c3                   	ret
+
+008003d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8003db:	e8 dd 19 00 00       	call   801dbd <close_all>
+	sys_env_destroy(0);
+  8003e0:	83 ec 0c             	sub    $0xc,%esp
+  8003e3:	6a 00                	push   $0x0
+  8003e5:	e8 8c 0b 00 00       	call   800f76 <sys_env_destroy>
+}
+  8003ea:	83 c4 10             	add    $0x10,%esp
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+008003ef <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003ef:	55                   	push   %ebp
+  8003f0:	89 e5                	mov    %esp,%ebp
+  8003f2:	56                   	push   %esi
+  8003f3:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003f4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f7:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  8003fd:	e8 b5 0b 00 00       	call   800fb7 <sys_getenvid>
+  800402:	83 ec 0c             	sub    $0xc,%esp
+  800405:	ff 75 0c             	push   0xc(%ebp)
+  800408:	ff 75 08             	push   0x8(%ebp)
+  80040b:	56                   	push   %esi
+  80040c:	50                   	push   %eax
+  80040d:	68 b0 48 80 00       	push   $0x8048b0
+  800412:	e8 b3 00 00 00       	call   8004ca <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800417:	83 c4 18             	add    $0x18,%esp
+  80041a:	53                   	push   %ebx
+  80041b:	ff 75 10             	push   0x10(%ebp)
+  80041e:	e8 56 00 00 00       	call   800479 <vcprintf>
+	cprintf("\n");
+  800423:	c7 04 24 a0 47 80 00 	movl   $0x8047a0,(%esp)
+  80042a:	e8 9b 00 00 00       	call   8004ca <cprintf>
+  80042f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800432:	cc                   	int3
+	while (1)
+  800433:	eb fd                	jmp    800432 <_panic+0x43>
+
+00800435 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800435:	55                   	push   %ebp
+  800436:	89 e5                	mov    %esp,%ebp
+  800438:	53                   	push   %ebx
+  800439:	83 ec 04             	sub    $0x4,%esp
+  80043c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80043f:	8b 13                	mov    (%ebx),%edx
+  800441:	8d 42 01             	lea    0x1(%edx),%eax
+  800444:	89 03                	mov    %eax,(%ebx)
+  800446:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800449:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80044d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800452:	74 09                	je     80045d <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800454:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800458:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045b:	c9                   	leave
+  80045c:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 ff 00 00 00       	push   $0xff
+  800465:	8d 43 08             	lea    0x8(%ebx),%eax
+  800468:	50                   	push   %eax
+  800469:	e8 cb 0a 00 00       	call   800f39 <sys_cputs>
+		b->idx = 0;
+  80046e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800474:	83 c4 10             	add    $0x10,%esp
+  800477:	eb db                	jmp    800454 <putch+0x1f>
+
+00800479 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800482:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800489:	00 00 00 
+	b.cnt = 0;
+  80048c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800493:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800496:	ff 75 0c             	push   0xc(%ebp)
+  800499:	ff 75 08             	push   0x8(%ebp)
+  80049c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a2:	50                   	push   %eax
+  8004a3:	68 35 04 80 00       	push   $0x800435
+  8004a8:	e8 1c 01 00 00       	call   8005c9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8004ad:	83 c4 08             	add    $0x8,%esp
+  8004b0:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004b6:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004bc:	50                   	push   %eax
+  8004bd:	e8 77 0a 00 00       	call   800f39 <sys_cputs>
+
+	return b.cnt;
+}
+  8004c2:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004c8:	c9                   	leave
+  8004c9:	c3                   	ret
+
+008004ca <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ca:	55                   	push   %ebp
+  8004cb:	89 e5                	mov    %esp,%ebp
+  8004cd:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8004d0:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8004d3:	50                   	push   %eax
+  8004d4:	ff 75 08             	push   0x8(%ebp)
+  8004d7:	e8 9d ff ff ff       	call   800479 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8004dc:	c9                   	leave
+  8004dd:	c3                   	ret
+
+008004de <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004de:	55                   	push   %ebp
+  8004df:	89 e5                	mov    %esp,%ebp
+  8004e1:	57                   	push   %edi
+  8004e2:	56                   	push   %esi
+  8004e3:	53                   	push   %ebx
+  8004e4:	83 ec 1c             	sub    $0x1c,%esp
+  8004e7:	89 c3                	mov    %eax,%ebx
+  8004e9:	89 d6                	mov    %edx,%esi
+  8004eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f1:	89 d1                	mov    %edx,%ecx
+  8004f3:	89 c2                	mov    %eax,%edx
+  8004f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004fb:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800501:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800508:	39 c2                	cmp    %eax,%edx
+  80050a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80050d:	73 4b                	jae    80055a <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80050f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800512:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800515:	85 ff                	test   %edi,%edi
+  800517:	7e 11                	jle    80052a <printnum+0x4c>
+			putch(padc, putdat);
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	56                   	push   %esi
+  80051d:	ff 75 18             	push   0x18(%ebp)
+  800520:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800522:	83 c4 10             	add    $0x10,%esp
+  800525:	83 ef 01             	sub    $0x1,%edi
+  800528:	75 ef                	jne    800519 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	56                   	push   %esi
+  80052e:	83 ec 04             	sub    $0x4,%esp
+  800531:	ff 75 e4             	push   -0x1c(%ebp)
+  800534:	ff 75 e0             	push   -0x20(%ebp)
+  800537:	ff 75 dc             	push   -0x24(%ebp)
+  80053a:	ff 75 d8             	push   -0x28(%ebp)
+  80053d:	e8 ef 40 00 00       	call   804631 <__umoddi3>
+  800542:	83 c4 14             	add    $0x14,%esp
+  800545:	0f be 80 d3 48 80 00 	movsbl 0x8048d3(%eax),%eax
+  80054c:	50                   	push   %eax
+  80054d:	ff d3                	call   *%ebx
+}
+  80054f:	83 c4 10             	add    $0x10,%esp
+  800552:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800555:	5b                   	pop    %ebx
+  800556:	5e                   	pop    %esi
+  800557:	5f                   	pop    %edi
+  800558:	5d                   	pop    %ebp
+  800559:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80055a:	83 ec 0c             	sub    $0xc,%esp
+  80055d:	ff 75 18             	push   0x18(%ebp)
+  800560:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800563:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800566:	52                   	push   %edx
+  800567:	50                   	push   %eax
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	ff 75 e4             	push   -0x1c(%ebp)
+  80056e:	ff 75 e0             	push   -0x20(%ebp)
+  800571:	ff 75 dc             	push   -0x24(%ebp)
+  800574:	ff 75 d8             	push   -0x28(%ebp)
+  800577:	e8 ef 3f 00 00       	call   80456b <__udivdi3>
+  80057c:	83 c4 18             	add    $0x18,%esp
+  80057f:	52                   	push   %edx
+  800580:	50                   	push   %eax
+  800581:	89 f2                	mov    %esi,%edx
+  800583:	89 d8                	mov    %ebx,%eax
+  800585:	e8 54 ff ff ff       	call   8004de <printnum>
+  80058a:	83 c4 20             	add    $0x20,%esp
+  80058d:	eb 9b                	jmp    80052a <printnum+0x4c>
+
+0080058f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80058f:	55                   	push   %ebp
+  800590:	89 e5                	mov    %esp,%ebp
+  800592:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800595:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800599:	8b 10                	mov    (%eax),%edx
+  80059b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80059e:	73 0a                	jae    8005aa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8005a0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005a3:	89 08                	mov    %ecx,(%eax)
+  8005a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a8:	88 02                	mov    %al,(%edx)
+}
+  8005aa:	5d                   	pop    %ebp
+  8005ab:	c3                   	ret
+
+008005ac <printfmt>:
+{
+  8005ac:	55                   	push   %ebp
+  8005ad:	89 e5                	mov    %esp,%ebp
+  8005af:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8005b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8005b5:	50                   	push   %eax
+  8005b6:	ff 75 10             	push   0x10(%ebp)
+  8005b9:	ff 75 0c             	push   0xc(%ebp)
+  8005bc:	ff 75 08             	push   0x8(%ebp)
+  8005bf:	e8 05 00 00 00       	call   8005c9 <vprintfmt>
+}
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	c9                   	leave
+  8005c8:	c3                   	ret
+
+008005c9 <vprintfmt>:
+{
+  8005c9:	55                   	push   %ebp
+  8005ca:	89 e5                	mov    %esp,%ebp
+  8005cc:	57                   	push   %edi
+  8005cd:	56                   	push   %esi
+  8005ce:	53                   	push   %ebx
+  8005cf:	83 ec 2c             	sub    $0x2c,%esp
+  8005d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005d5:	89 df                	mov    %ebx,%edi
+  8005d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005da:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005dd:	8d 70 01             	lea    0x1(%eax),%esi
+  8005e0:	0f b6 00             	movzbl (%eax),%eax
+  8005e3:	83 f8 25             	cmp    $0x25,%eax
+  8005e6:	74 1e                	je     800606 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8005e8:	85 c0                	test   %eax,%eax
+  8005ea:	0f 84 15 05 00 00    	je     800b05 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8005f0:	83 ec 08             	sub    $0x8,%esp
+  8005f3:	53                   	push   %ebx
+  8005f4:	50                   	push   %eax
+  8005f5:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005f7:	83 c6 01             	add    $0x1,%esi
+  8005fa:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005fe:	83 c4 10             	add    $0x10,%esp
+  800601:	83 f8 25             	cmp    $0x25,%eax
+  800604:	75 e2                	jne    8005e8 <vprintfmt+0x1f>
+		padc = ' ';
+  800606:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80060a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800611:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800618:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80061f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800624:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800627:	8d 56 01             	lea    0x1(%esi),%edx
+  80062a:	0f b6 0e             	movzbl (%esi),%ecx
+  80062d:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800630:	3c 55                	cmp    $0x55,%al
+  800632:	0f 87 3b 04 00 00    	ja     800a73 <vprintfmt+0x4aa>
+  800638:	0f b6 c0             	movzbl %al,%eax
+  80063b:	ff 24 85 40 4a 80 00 	jmp    *0x804a40(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800642:	89 75 10             	mov    %esi,0x10(%ebp)
+  800645:	eb 93                	jmp    8005da <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800647:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800649:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80064d:	eb d8                	jmp    800627 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80064f:	89 d6                	mov    %edx,%esi
+  800651:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800655:	eb d0                	jmp    800627 <vprintfmt+0x5e>
+  800657:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80065a:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80065d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800660:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800664:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800667:	83 f9 09             	cmp    $0x9,%ecx
+  80066a:	77 6f                	ja     8006db <vprintfmt+0x112>
+  80066c:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80066f:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800672:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800675:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800679:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80067c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80067f:	83 fe 09             	cmp    $0x9,%esi
+  800682:	76 eb                	jbe    80066f <vprintfmt+0xa6>
+  800684:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800687:	89 d6                	mov    %edx,%esi
+  800689:	eb 13                	jmp    80069e <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8b 00                	mov    (%eax),%eax
+  800690:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80069c:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80069e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006a2:	79 83                	jns    800627 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8006a4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8006a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006aa:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8006b1:	e9 71 ff ff ff       	jmp    800627 <vprintfmt+0x5e>
+			if (width < 0)
+  8006b6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c0:	0f 49 c1             	cmovns %ecx,%eax
+  8006c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006c6:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006c8:	e9 5a ff ff ff       	jmp    800627 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006cd:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8006cf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8006d6:	e9 4c ff ff ff       	jmp    800627 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8006db:	89 d6                	mov    %edx,%esi
+  8006dd:	eb bf                	jmp    80069e <vprintfmt+0xd5>
+			lflag++;
+  8006df:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006e3:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006e5:	e9 3d ff ff ff       	jmp    800627 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8006ea:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f0:	8d 70 04             	lea    0x4(%eax),%esi
+  8006f3:	83 ec 08             	sub    $0x8,%esp
+  8006f6:	53                   	push   %ebx
+  8006f7:	ff 30                	push   (%eax)
+  8006f9:	ff d7                	call   *%edi
+			break;
+  8006fb:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006fe:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800701:	e9 d4 fe ff ff       	jmp    8005da <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800706:	89 55 10             	mov    %edx,0x10(%ebp)
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80070f:	8b 10                	mov    (%eax),%edx
+  800711:	89 d0                	mov    %edx,%eax
+  800713:	f7 d8                	neg    %eax
+  800715:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800718:	83 f8 12             	cmp    $0x12,%eax
+  80071b:	7f 23                	jg     800740 <vprintfmt+0x177>
+  80071d:	8b 14 85 a0 4b 80 00 	mov    0x804ba0(,%eax,4),%edx
+  800724:	85 d2                	test   %edx,%edx
+  800726:	74 18                	je     800740 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800728:	52                   	push   %edx
+  800729:	68 f3 4d 80 00       	push   $0x804df3
+  80072e:	53                   	push   %ebx
+  80072f:	57                   	push   %edi
+  800730:	e8 77 fe ff ff       	call   8005ac <printfmt>
+  800735:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800738:	89 75 14             	mov    %esi,0x14(%ebp)
+  80073b:	e9 9a fe ff ff       	jmp    8005da <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800740:	50                   	push   %eax
+  800741:	68 eb 48 80 00       	push   $0x8048eb
+  800746:	53                   	push   %ebx
+  800747:	57                   	push   %edi
+  800748:	e8 5f fe ff ff       	call   8005ac <printfmt>
+  80074d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800750:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800753:	e9 82 fe ff ff       	jmp    8005da <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800758:	89 55 10             	mov    %edx,0x10(%ebp)
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	83 c0 04             	add    $0x4,%eax
+  800761:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800764:	8b 45 14             	mov    0x14(%ebp),%eax
+  800767:	8b 00                	mov    (%eax),%eax
+  800769:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80076c:	85 c0                	test   %eax,%eax
+  80076e:	0f 84 61 03 00 00    	je     800ad5 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800774:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800778:	7e 06                	jle    800780 <vprintfmt+0x1b7>
+  80077a:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80077e:	75 29                	jne    8007a9 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800780:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800783:	8d 70 01             	lea    0x1(%eax),%esi
+  800786:	0f b6 00             	movzbl (%eax),%eax
+  800789:	0f be d0             	movsbl %al,%edx
+  80078c:	85 d2                	test   %edx,%edx
+  80078e:	0f 84 bb 00 00 00    	je     80084f <vprintfmt+0x286>
+  800794:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800797:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80079a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80079d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007a0:	eb 7a                	jmp    80081c <vprintfmt+0x253>
+				p = "(null)";
+  8007a2:	c7 45 d0 e4 48 80 00 	movl   $0x8048e4,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007a9:	83 ec 08             	sub    $0x8,%esp
+  8007ac:	ff 75 d4             	push   -0x2c(%ebp)
+  8007af:	ff 75 d0             	push   -0x30(%ebp)
+  8007b2:	e8 e0 03 00 00       	call   800b97 <strnlen>
+  8007b7:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8007ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	85 d2                	test   %edx,%edx
+  8007c2:	0f 8e d6 02 00 00    	jle    800a9e <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  8007c8:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8007cc:	83 ec 08             	sub    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	56                   	push   %esi
+  8007d1:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8007d3:	83 c4 10             	add    $0x10,%esp
+  8007d6:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8007da:	75 f0                	jne    8007cc <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007df:	8d 70 01             	lea    0x1(%eax),%esi
+  8007e2:	0f b6 00             	movzbl (%eax),%eax
+  8007e5:	0f be d0             	movsbl %al,%edx
+  8007e8:	85 d2                	test   %edx,%edx
+  8007ea:	0f 84 da 02 00 00    	je     800aca <vprintfmt+0x501>
+  8007f0:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007f3:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007f6:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007f9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007fc:	eb 1e                	jmp    80081c <vprintfmt+0x253>
+					putch(ch, putdat);
+  8007fe:	83 ec 08             	sub    $0x8,%esp
+  800801:	ff 75 0c             	push   0xc(%ebp)
+  800804:	52                   	push   %edx
+  800805:	ff 55 08             	call   *0x8(%ebp)
+  800808:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80080b:	83 eb 01             	sub    $0x1,%ebx
+  80080e:	83 c6 01             	add    $0x1,%esi
+  800811:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800815:	0f be d0             	movsbl %al,%edx
+  800818:	85 d2                	test   %edx,%edx
+  80081a:	74 2a                	je     800846 <vprintfmt+0x27d>
+  80081c:	85 ff                	test   %edi,%edi
+  80081e:	78 05                	js     800825 <vprintfmt+0x25c>
+  800820:	83 ef 01             	sub    $0x1,%edi
+  800823:	78 59                	js     80087e <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800825:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800829:	74 d3                	je     8007fe <vprintfmt+0x235>
+  80082b:	0f be c0             	movsbl %al,%eax
+  80082e:	83 e8 20             	sub    $0x20,%eax
+  800831:	83 f8 5e             	cmp    $0x5e,%eax
+  800834:	76 c8                	jbe    8007fe <vprintfmt+0x235>
+					putch('?', putdat);
+  800836:	83 ec 08             	sub    $0x8,%esp
+  800839:	ff 75 0c             	push   0xc(%ebp)
+  80083c:	6a 3f                	push   $0x3f
+  80083e:	ff 55 08             	call   *0x8(%ebp)
+  800841:	83 c4 10             	add    $0x10,%esp
+  800844:	eb c5                	jmp    80080b <vprintfmt+0x242>
+  800846:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800849:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80084c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80084f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800852:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800856:	7e 1b                	jle    800873 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800858:	83 ec 08             	sub    $0x8,%esp
+  80085b:	53                   	push   %ebx
+  80085c:	6a 20                	push   $0x20
+  80085e:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800860:	83 c4 10             	add    $0x10,%esp
+  800863:	83 ee 01             	sub    $0x1,%esi
+  800866:	75 f0                	jne    800858 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800868:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80086b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80086e:	e9 67 fd ff ff       	jmp    8005da <vprintfmt+0x11>
+  800873:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800876:	89 45 14             	mov    %eax,0x14(%ebp)
+  800879:	e9 5c fd ff ff       	jmp    8005da <vprintfmt+0x11>
+  80087e:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800881:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800884:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800887:	eb c6                	jmp    80084f <vprintfmt+0x286>
+	if (lflag >= 2)
+  800889:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80088c:	89 55 10             	mov    %edx,0x10(%ebp)
+  80088f:	83 f9 01             	cmp    $0x1,%ecx
+  800892:	7f 1f                	jg     8008b3 <vprintfmt+0x2ea>
+	else if (lflag)
+  800894:	85 c9                	test   %ecx,%ecx
+  800896:	74 67                	je     8008ff <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 30                	mov    (%eax),%esi
+  80089d:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008a0:	89 f0                	mov    %esi,%eax
+  8008a2:	c1 f8 1f             	sar    $0x1f,%eax
+  8008a5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ae:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b1:	eb 17                	jmp    8008ca <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8008b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b6:	8b 50 04             	mov    0x4(%eax),%edx
+  8008b9:	8b 00                	mov    (%eax),%eax
+  8008bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008be:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8008ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8008d0:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8008d5:	85 c9                	test   %ecx,%ecx
+  8008d7:	0f 89 12 01 00 00    	jns    8009ef <vprintfmt+0x426>
+				putch('-', putdat);
+  8008dd:	83 ec 08             	sub    $0x8,%esp
+  8008e0:	53                   	push   %ebx
+  8008e1:	6a 2d                	push   $0x2d
+  8008e3:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8008e5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008e8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008eb:	f7 da                	neg    %edx
+  8008ed:	83 d1 00             	adc    $0x0,%ecx
+  8008f0:	f7 d9                	neg    %ecx
+  8008f2:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008f5:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008fa:	e9 f0 00 00 00       	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8008ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800902:	8b 30                	mov    (%eax),%esi
+  800904:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800907:	89 f0                	mov    %esi,%eax
+  800909:	c1 f8 1f             	sar    $0x1f,%eax
+  80090c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80090f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800912:	8d 40 04             	lea    0x4(%eax),%eax
+  800915:	89 45 14             	mov    %eax,0x14(%ebp)
+  800918:	eb b0                	jmp    8008ca <vprintfmt+0x301>
+	if (lflag >= 2)
+  80091a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80091d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800920:	83 f9 01             	cmp    $0x1,%ecx
+  800923:	7f 1e                	jg     800943 <vprintfmt+0x37a>
+	else if (lflag)
+  800925:	85 c9                	test   %ecx,%ecx
+  800927:	74 32                	je     80095b <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800929:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092c:	8b 10                	mov    (%eax),%edx
+  80092e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800933:	8d 40 04             	lea    0x4(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800939:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80093e:	e9 ac 00 00 00       	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800943:	8b 45 14             	mov    0x14(%ebp),%eax
+  800946:	8b 10                	mov    (%eax),%edx
+  800948:	8b 48 04             	mov    0x4(%eax),%ecx
+  80094b:	8d 40 08             	lea    0x8(%eax),%eax
+  80094e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800951:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800956:	e9 94 00 00 00       	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80095b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095e:	8b 10                	mov    (%eax),%edx
+  800960:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800965:	8d 40 04             	lea    0x4(%eax),%eax
+  800968:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80096b:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800970:	eb 7d                	jmp    8009ef <vprintfmt+0x426>
+	if (lflag >= 2)
+  800972:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800975:	89 55 10             	mov    %edx,0x10(%ebp)
+  800978:	83 f9 01             	cmp    $0x1,%ecx
+  80097b:	7f 1b                	jg     800998 <vprintfmt+0x3cf>
+	else if (lflag)
+  80097d:	85 c9                	test   %ecx,%ecx
+  80097f:	74 2c                	je     8009ad <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800981:	8b 45 14             	mov    0x14(%ebp),%eax
+  800984:	8b 10                	mov    (%eax),%edx
+  800986:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80098b:	8d 40 04             	lea    0x4(%eax),%eax
+  80098e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800991:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800996:	eb 57                	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800998:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099b:	8b 10                	mov    (%eax),%edx
+  80099d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009a6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8009ab:	eb 42                	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b0:	8b 10                	mov    (%eax),%edx
+  8009b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ba:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8009bd:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  8009c2:	eb 2b                	jmp    8009ef <vprintfmt+0x426>
+			putch('0', putdat);
+  8009c4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	53                   	push   %ebx
+  8009cb:	6a 30                	push   $0x30
+  8009cd:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8009cf:	83 c4 08             	add    $0x8,%esp
+  8009d2:	53                   	push   %ebx
+  8009d3:	6a 78                	push   $0x78
+  8009d5:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8009d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009da:	8b 10                	mov    (%eax),%edx
+  8009dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009e1:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ea:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8009ef:	83 ec 0c             	sub    $0xc,%esp
+  8009f2:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8009f6:	50                   	push   %eax
+  8009f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8009fa:	56                   	push   %esi
+  8009fb:	51                   	push   %ecx
+  8009fc:	52                   	push   %edx
+  8009fd:	89 da                	mov    %ebx,%edx
+  8009ff:	89 f8                	mov    %edi,%eax
+  800a01:	e8 d8 fa ff ff       	call   8004de <printnum>
+			break;
+  800a06:	83 c4 20             	add    $0x20,%esp
+  800a09:	e9 cc fb ff ff       	jmp    8005da <vprintfmt+0x11>
+	if (lflag >= 2)
+  800a0e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a11:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a14:	83 f9 01             	cmp    $0x1,%ecx
+  800a17:	7f 1b                	jg     800a34 <vprintfmt+0x46b>
+	else if (lflag)
+  800a19:	85 c9                	test   %ecx,%ecx
+  800a1b:	74 2c                	je     800a49 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800a1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a20:	8b 10                	mov    (%eax),%edx
+  800a22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a27:	8d 40 04             	lea    0x4(%eax),%eax
+  800a2a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a2d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800a32:	eb bb                	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a37:	8b 10                	mov    (%eax),%edx
+  800a39:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a3c:	8d 40 08             	lea    0x8(%eax),%eax
+  800a3f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a42:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a47:	eb a6                	jmp    8009ef <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a49:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4c:	8b 10                	mov    (%eax),%edx
+  800a4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a53:	8d 40 04             	lea    0x4(%eax),%eax
+  800a56:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a59:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a5e:	eb 8f                	jmp    8009ef <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a60:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a63:	83 ec 08             	sub    $0x8,%esp
+  800a66:	53                   	push   %ebx
+  800a67:	6a 25                	push   $0x25
+  800a69:	ff d7                	call   *%edi
+			break;
+  800a6b:	83 c4 10             	add    $0x10,%esp
+  800a6e:	e9 67 fb ff ff       	jmp    8005da <vprintfmt+0x11>
+			putch('%', putdat);
+  800a73:	83 ec 08             	sub    $0x8,%esp
+  800a76:	53                   	push   %ebx
+  800a77:	6a 25                	push   $0x25
+  800a79:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a7b:	83 c4 10             	add    $0x10,%esp
+  800a7e:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a82:	0f 84 ba fb ff ff    	je     800642 <vprintfmt+0x79>
+  800a88:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a8b:	89 f0                	mov    %esi,%eax
+  800a8d:	83 e8 01             	sub    $0x1,%eax
+  800a90:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a94:	75 f7                	jne    800a8d <vprintfmt+0x4c4>
+  800a96:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a99:	e9 3c fb ff ff       	jmp    8005da <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a9e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800aa1:	8d 70 01             	lea    0x1(%eax),%esi
+  800aa4:	0f b6 00             	movzbl (%eax),%eax
+  800aa7:	0f be d0             	movsbl %al,%edx
+  800aaa:	85 d2                	test   %edx,%edx
+  800aac:	74 11                	je     800abf <vprintfmt+0x4f6>
+  800aae:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ab1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800ab4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ab7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800aba:	e9 5d fd ff ff       	jmp    80081c <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800abf:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ac2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac5:	e9 10 fb ff ff       	jmp    8005da <vprintfmt+0x11>
+  800aca:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800acd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad0:	e9 05 fb ff ff       	jmp    8005da <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800ad5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800ad9:	7e 0a                	jle    800ae5 <vprintfmt+0x51c>
+  800adb:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800adf:	0f 85 bd fc ff ff    	jne    8007a2 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ae5:	ba 28 00 00 00       	mov    $0x28,%edx
+  800aea:	b8 28 00 00 00       	mov    $0x28,%eax
+  800aef:	be e5 48 80 00       	mov    $0x8048e5,%esi
+  800af4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800af7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800afa:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800afd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800b00:	e9 17 fd ff ff       	jmp    80081c <vprintfmt+0x253>
+}
+  800b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b08:	5b                   	pop    %ebx
+  800b09:	5e                   	pop    %esi
+  800b0a:	5f                   	pop    %edi
+  800b0b:	5d                   	pop    %ebp
+  800b0c:	c3                   	ret
+
+00800b0d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b0d:	55                   	push   %ebp
+  800b0e:	89 e5                	mov    %esp,%ebp
+  800b10:	83 ec 18             	sub    $0x18,%esp
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b19:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b1c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b20:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b23:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b2a:	85 c0                	test   %eax,%eax
+  800b2c:	74 26                	je     800b54 <vsnprintf+0x47>
+  800b2e:	85 d2                	test   %edx,%edx
+  800b30:	7e 22                	jle    800b54 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b32:	ff 75 14             	push   0x14(%ebp)
+  800b35:	ff 75 10             	push   0x10(%ebp)
+  800b38:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b3b:	50                   	push   %eax
+  800b3c:	68 8f 05 80 00       	push   $0x80058f
+  800b41:	e8 83 fa ff ff       	call   8005c9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b46:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b49:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b4f:	83 c4 10             	add    $0x10,%esp
+}
+  800b52:	c9                   	leave
+  800b53:	c3                   	ret
+		return -E_INVAL;
+  800b54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b59:	eb f7                	jmp    800b52 <vsnprintf+0x45>
+
+00800b5b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b61:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b64:	50                   	push   %eax
+  800b65:	ff 75 10             	push   0x10(%ebp)
+  800b68:	ff 75 0c             	push   0xc(%ebp)
+  800b6b:	ff 75 08             	push   0x8(%ebp)
+  800b6e:	e8 9a ff ff ff       	call   800b0d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b73:	c9                   	leave
+  800b74:	c3                   	ret
+
+00800b75 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b75:	55                   	push   %ebp
+  800b76:	89 e5                	mov    %esp,%ebp
+  800b78:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b7b:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b7e:	74 10                	je     800b90 <strlen+0x1b>
+  800b80:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b85:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b88:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b8c:	75 f7                	jne    800b85 <strlen+0x10>
+	return n;
+}
+  800b8e:	5d                   	pop    %ebp
+  800b8f:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b95:	eb f7                	jmp    800b8e <strlen+0x19>
+
+00800b97 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ba0:	85 d2                	test   %edx,%edx
+  800ba2:	74 16                	je     800bba <strnlen+0x23>
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bad:	74 09                	je     800bb8 <strnlen+0x21>
+		n++;
+  800baf:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bb2:	39 d0                	cmp    %edx,%eax
+  800bb4:	75 f3                	jne    800ba9 <strnlen+0x12>
+		n++;
+  800bb6:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbf:	eb f7                	jmp    800bb8 <strnlen+0x21>
+
+00800bc1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	53                   	push   %ebx
+  800bc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bc8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bd4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bd7:	83 c0 01             	add    $0x1,%eax
+  800bda:	84 d2                	test   %dl,%dl
+  800bdc:	75 f2                	jne    800bd0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bde:	89 c8                	mov    %ecx,%eax
+  800be0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800be3:	c9                   	leave
+  800be4:	c3                   	ret
+
+00800be5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800be5:	55                   	push   %ebp
+  800be6:	89 e5                	mov    %esp,%ebp
+  800be8:	53                   	push   %ebx
+  800be9:	83 ec 10             	sub    $0x10,%esp
+  800bec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bef:	53                   	push   %ebx
+  800bf0:	e8 80 ff ff ff       	call   800b75 <strlen>
+  800bf5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bf8:	ff 75 0c             	push   0xc(%ebp)
+  800bfb:	01 d8                	add    %ebx,%eax
+  800bfd:	50                   	push   %eax
+  800bfe:	e8 be ff ff ff       	call   800bc1 <strcpy>
+	return dst;
+}
+  800c03:	89 d8                	mov    %ebx,%eax
+  800c05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c08:	c9                   	leave
+  800c09:	c3                   	ret
+
+00800c0a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	56                   	push   %esi
+  800c0e:	53                   	push   %ebx
+  800c0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c18:	85 db                	test   %ebx,%ebx
+  800c1a:	74 17                	je     800c33 <strncpy+0x29>
+  800c1c:	01 f3                	add    %esi,%ebx
+  800c1e:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800c20:	83 c0 01             	add    $0x1,%eax
+  800c23:	0f b6 0a             	movzbl (%edx),%ecx
+  800c26:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c29:	80 f9 01             	cmp    $0x1,%cl
+  800c2c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c2f:	39 c3                	cmp    %eax,%ebx
+  800c31:	75 ed                	jne    800c20 <strncpy+0x16>
+	}
+	return ret;
+}
+  800c33:	89 f0                	mov    %esi,%eax
+  800c35:	5b                   	pop    %ebx
+  800c36:	5e                   	pop    %esi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+
+00800c39 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  800c3e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c47:	89 f0                	mov    %esi,%eax
+  800c49:	85 db                	test   %ebx,%ebx
+  800c4b:	74 1e                	je     800c6b <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c4d:	83 eb 01             	sub    $0x1,%ebx
+  800c50:	74 16                	je     800c68 <strlcpy+0x2f>
+  800c52:	01 f3                	add    %esi,%ebx
+  800c54:	0f b6 0a             	movzbl (%edx),%ecx
+  800c57:	84 c9                	test   %cl,%cl
+  800c59:	74 0d                	je     800c68 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c5b:	83 c2 01             	add    $0x1,%edx
+  800c5e:	83 c0 01             	add    $0x1,%eax
+  800c61:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c64:	39 d8                	cmp    %ebx,%eax
+  800c66:	75 ec                	jne    800c54 <strlcpy+0x1b>
+		*dst = '\0';
+  800c68:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c6b:	29 f0                	sub    %esi,%eax
+}
+  800c6d:	5b                   	pop    %ebx
+  800c6e:	5e                   	pop    %esi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c77:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c7a:	0f b6 01             	movzbl (%ecx),%eax
+  800c7d:	84 c0                	test   %al,%al
+  800c7f:	74 11                	je     800c92 <strcmp+0x21>
+  800c81:	38 02                	cmp    %al,(%edx)
+  800c83:	75 0d                	jne    800c92 <strcmp+0x21>
+		p++, q++;
+  800c85:	83 c1 01             	add    $0x1,%ecx
+  800c88:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c8b:	0f b6 01             	movzbl (%ecx),%eax
+  800c8e:	84 c0                	test   %al,%al
+  800c90:	75 ef                	jne    800c81 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c92:	0f b6 c0             	movzbl %al,%eax
+  800c95:	0f b6 12             	movzbl (%edx),%edx
+  800c98:	29 d0                	sub    %edx,%eax
+}
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+
+00800c9c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	53                   	push   %ebx
+  800ca0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ca3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800ca6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800cae:	85 d2                	test   %edx,%edx
+  800cb0:	74 2e                	je     800ce0 <strncmp+0x44>
+  800cb2:	0f b6 01             	movzbl (%ecx),%eax
+  800cb5:	84 c0                	test   %al,%al
+  800cb7:	74 16                	je     800ccf <strncmp+0x33>
+  800cb9:	3a 03                	cmp    (%ebx),%al
+  800cbb:	75 12                	jne    800ccf <strncmp+0x33>
+		n--, p++, q++;
+  800cbd:	83 c1 01             	add    $0x1,%ecx
+  800cc0:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800cc3:	83 ea 01             	sub    $0x1,%edx
+  800cc6:	75 ea                	jne    800cb2 <strncmp+0x16>
+		return 0;
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	eb 11                	jmp    800ce0 <strncmp+0x44>
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800cd4:	85 d2                	test   %edx,%edx
+  800cd6:	74 08                	je     800ce0 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800cd8:	0f b6 01             	movzbl (%ecx),%eax
+  800cdb:	0f b6 13             	movzbl (%ebx),%edx
+  800cde:	29 d0                	sub    %edx,%eax
+}
+  800ce0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ce3:	c9                   	leave
+  800ce4:	c3                   	ret
+
+00800ce5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ce5:	55                   	push   %ebp
+  800ce6:	89 e5                	mov    %esp,%ebp
+  800ce8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ceb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cef:	0f b6 10             	movzbl (%eax),%edx
+  800cf2:	84 d2                	test   %dl,%dl
+  800cf4:	74 15                	je     800d0b <strchr+0x26>
+		if (*s == c)
+  800cf6:	38 d1                	cmp    %dl,%cl
+  800cf8:	74 0f                	je     800d09 <strchr+0x24>
+	for (; *s; s++)
+  800cfa:	83 c0 01             	add    $0x1,%eax
+  800cfd:	0f b6 10             	movzbl (%eax),%edx
+  800d00:	84 d2                	test   %dl,%dl
+  800d02:	75 f2                	jne    800cf6 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800d04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d09:	5d                   	pop    %ebp
+  800d0a:	c3                   	ret
+	return 0;
+  800d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d10:	eb f7                	jmp    800d09 <strchr+0x24>
+
+00800d12 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	53                   	push   %ebx
+  800d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d19:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800d1c:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800d1f:	38 d3                	cmp    %dl,%bl
+  800d21:	74 14                	je     800d37 <strfind+0x25>
+  800d23:	89 d1                	mov    %edx,%ecx
+  800d25:	84 db                	test   %bl,%bl
+  800d27:	74 0e                	je     800d37 <strfind+0x25>
+	for (; *s; s++)
+  800d29:	83 c0 01             	add    $0x1,%eax
+  800d2c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800d2f:	38 ca                	cmp    %cl,%dl
+  800d31:	74 04                	je     800d37 <strfind+0x25>
+  800d33:	84 d2                	test   %dl,%dl
+  800d35:	75 f2                	jne    800d29 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800d37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3a:	c9                   	leave
+  800d3b:	c3                   	ret
+
+00800d3c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d3c:	55                   	push   %ebp
+  800d3d:	89 e5                	mov    %esp,%ebp
+  800d3f:	57                   	push   %edi
+  800d40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d43:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d46:	85 c9                	test   %ecx,%ecx
+  800d48:	74 20                	je     800d6a <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d4a:	89 f8                	mov    %edi,%eax
+  800d4c:	09 c8                	or     %ecx,%eax
+  800d4e:	a8 03                	test   $0x3,%al
+  800d50:	75 12                	jne    800d64 <memset+0x28>
+		c &= 0xFF;
+  800d52:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d56:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d5c:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d5f:	fc                   	cld
+  800d60:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d62:	eb 06                	jmp    800d6a <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d67:	fc                   	cld
+  800d68:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d6a:	89 f8                	mov    %edi,%eax
+  800d6c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d6f:	c9                   	leave
+  800d70:	c3                   	ret
+
+00800d71 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d79:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d7c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d7f:	39 c6                	cmp    %eax,%esi
+  800d81:	73 32                	jae    800db5 <memmove+0x44>
+  800d83:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d86:	39 d0                	cmp    %edx,%eax
+  800d88:	73 2b                	jae    800db5 <memmove+0x44>
+		s += n;
+		d += n;
+  800d8a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d8d:	89 d6                	mov    %edx,%esi
+  800d8f:	09 fe                	or     %edi,%esi
+  800d91:	09 ce                	or     %ecx,%esi
+  800d93:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d99:	75 0e                	jne    800da9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d9b:	83 ef 04             	sub    $0x4,%edi
+  800d9e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800da1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800da4:	fd                   	std
+  800da5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800da7:	eb 09                	jmp    800db2 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800da9:	83 ef 01             	sub    $0x1,%edi
+  800dac:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800daf:	fd                   	std
+  800db0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800db2:	fc                   	cld
+  800db3:	eb 1a                	jmp    800dcf <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800db5:	89 f2                	mov    %esi,%edx
+  800db7:	09 c2                	or     %eax,%edx
+  800db9:	09 ca                	or     %ecx,%edx
+  800dbb:	f6 c2 03             	test   $0x3,%dl
+  800dbe:	75 0a                	jne    800dca <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dc0:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800dc3:	89 c7                	mov    %eax,%edi
+  800dc5:	fc                   	cld
+  800dc6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dc8:	eb 05                	jmp    800dcf <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800dca:	89 c7                	mov    %eax,%edi
+  800dcc:	fc                   	cld
+  800dcd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800dcf:	5e                   	pop    %esi
+  800dd0:	5f                   	pop    %edi
+  800dd1:	5d                   	pop    %ebp
+  800dd2:	c3                   	ret
+
+00800dd3 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800dd3:	55                   	push   %ebp
+  800dd4:	89 e5                	mov    %esp,%ebp
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800dd9:	ff 75 10             	push   0x10(%ebp)
+  800ddc:	ff 75 0c             	push   0xc(%ebp)
+  800ddf:	ff 75 08             	push   0x8(%ebp)
+  800de2:	e8 8a ff ff ff       	call   800d71 <memmove>
+}
+  800de7:	c9                   	leave
+  800de8:	c3                   	ret
+
+00800de9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+  800dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800df4:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800df7:	85 f6                	test   %esi,%esi
+  800df9:	74 29                	je     800e24 <memcmp+0x3b>
+  800dfb:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800dfd:	0f b6 08             	movzbl (%eax),%ecx
+  800e00:	0f b6 1a             	movzbl (%edx),%ebx
+  800e03:	38 d9                	cmp    %bl,%cl
+  800e05:	75 11                	jne    800e18 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800e07:	83 c0 01             	add    $0x1,%eax
+  800e0a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800e0d:	39 c6                	cmp    %eax,%esi
+  800e0f:	75 ec                	jne    800dfd <memcmp+0x14>
+	}
+
+	return 0;
+  800e11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e16:	eb 08                	jmp    800e20 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800e18:	0f b6 c1             	movzbl %cl,%eax
+  800e1b:	0f b6 db             	movzbl %bl,%ebx
+  800e1e:	29 d8                	sub    %ebx,%eax
+}
+  800e20:	5b                   	pop    %ebx
+  800e21:	5e                   	pop    %esi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+	return 0;
+  800e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e29:	eb f5                	jmp    800e20 <memcmp+0x37>
+
+00800e2b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800e34:	89 c2                	mov    %eax,%edx
+  800e36:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800e39:	39 d0                	cmp    %edx,%eax
+  800e3b:	73 0d                	jae    800e4a <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e3d:	38 08                	cmp    %cl,(%eax)
+  800e3f:	74 0d                	je     800e4e <memfind+0x23>
+	for (; s < ends; s++)
+  800e41:	83 c0 01             	add    $0x1,%eax
+  800e44:	39 c2                	cmp    %eax,%edx
+  800e46:	75 f5                	jne    800e3d <memfind+0x12>
+  800e48:	eb 06                	jmp    800e50 <memfind+0x25>
+  800e4a:	89 c2                	mov    %eax,%edx
+  800e4c:	eb 02                	jmp    800e50 <memfind+0x25>
+  800e4e:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e50:	89 d0                	mov    %edx,%eax
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  800e5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e60:	0f b6 02             	movzbl (%edx),%eax
+  800e63:	3c 20                	cmp    $0x20,%al
+  800e65:	74 04                	je     800e6b <strtol+0x17>
+  800e67:	3c 09                	cmp    $0x9,%al
+  800e69:	75 0e                	jne    800e79 <strtol+0x25>
+		s++;
+  800e6b:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e6e:	0f b6 02             	movzbl (%edx),%eax
+  800e71:	3c 20                	cmp    $0x20,%al
+  800e73:	74 f6                	je     800e6b <strtol+0x17>
+  800e75:	3c 09                	cmp    $0x9,%al
+  800e77:	74 f2                	je     800e6b <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e79:	3c 2b                	cmp    $0x2b,%al
+  800e7b:	74 2a                	je     800ea7 <strtol+0x53>
+	int neg = 0;
+  800e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e82:	3c 2d                	cmp    $0x2d,%al
+  800e84:	74 2b                	je     800eb1 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e86:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e8c:	75 0f                	jne    800e9d <strtol+0x49>
+  800e8e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e91:	74 28                	je     800ebb <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e93:	85 db                	test   %ebx,%ebx
+  800e95:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e9a:	0f 44 d8             	cmove  %eax,%ebx
+  800e9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ea5:	eb 46                	jmp    800eed <strtol+0x99>
+		s++;
+  800ea7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eaf:	eb d5                	jmp    800e86 <strtol+0x32>
+		s++, neg = 1;
+  800eb1:	83 c2 01             	add    $0x1,%edx
+  800eb4:	bf 01 00 00 00       	mov    $0x1,%edi
+  800eb9:	eb cb                	jmp    800e86 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ebb:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ebf:	74 0e                	je     800ecf <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800ec1:	85 db                	test   %ebx,%ebx
+  800ec3:	75 d8                	jne    800e9d <strtol+0x49>
+		s++, base = 8;
+  800ec5:	83 c2 01             	add    $0x1,%edx
+  800ec8:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ecd:	eb ce                	jmp    800e9d <strtol+0x49>
+		s += 2, base = 16;
+  800ecf:	83 c2 02             	add    $0x2,%edx
+  800ed2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ed7:	eb c4                	jmp    800e9d <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ed9:	0f be c0             	movsbl %al,%eax
+  800edc:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800edf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ee2:	7d 3a                	jge    800f1e <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ee4:	83 c2 01             	add    $0x1,%edx
+  800ee7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eeb:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eed:	0f b6 02             	movzbl (%edx),%eax
+  800ef0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ef3:	89 f3                	mov    %esi,%ebx
+  800ef5:	80 fb 09             	cmp    $0x9,%bl
+  800ef8:	76 df                	jbe    800ed9 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800efa:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800efd:	89 f3                	mov    %esi,%ebx
+  800eff:	80 fb 19             	cmp    $0x19,%bl
+  800f02:	77 08                	ja     800f0c <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800f04:	0f be c0             	movsbl %al,%eax
+  800f07:	83 e8 57             	sub    $0x57,%eax
+  800f0a:	eb d3                	jmp    800edf <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f0c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f0f:	89 f3                	mov    %esi,%ebx
+  800f11:	80 fb 19             	cmp    $0x19,%bl
+  800f14:	77 08                	ja     800f1e <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800f16:	0f be c0             	movsbl %al,%eax
+  800f19:	83 e8 37             	sub    $0x37,%eax
+  800f1c:	eb c1                	jmp    800edf <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800f1e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f22:	74 05                	je     800f29 <strtol+0xd5>
+		*endptr = (char *) s;
+  800f24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f27:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800f29:	89 c8                	mov    %ecx,%eax
+  800f2b:	f7 d8                	neg    %eax
+  800f2d:	85 ff                	test   %edi,%edi
+  800f2f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f32:	89 c8                	mov    %ecx,%eax
+  800f34:	5b                   	pop    %ebx
+  800f35:	5e                   	pop    %esi
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	89 c3                	mov    %eax,%ebx
+  800f4c:	89 c7                	mov    %eax,%edi
+  800f4e:	89 c6                	mov    %eax,%esi
+  800f50:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+
+00800f57 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f57:	55                   	push   %ebp
+  800f58:	89 e5                	mov    %esp,%ebp
+  800f5a:	57                   	push   %edi
+  800f5b:	56                   	push   %esi
+  800f5c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f62:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f67:	89 d1                	mov    %edx,%ecx
+  800f69:	89 d3                	mov    %edx,%ebx
+  800f6b:	89 d7                	mov    %edx,%edi
+  800f6d:	89 d6                	mov    %edx,%esi
+  800f6f:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+
+00800f76 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f8c:	89 cb                	mov    %ecx,%ebx
+  800f8e:	89 cf                	mov    %ecx,%edi
+  800f90:	89 ce                	mov    %ecx,%esi
+  800f92:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f94:	85 c0                	test   %eax,%eax
+  800f96:	7f 08                	jg     800fa0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  800fa3:	50                   	push   %eax
+  800fa4:	6a 03                	push   $0x3
+  800fa6:	68 0b 4c 80 00       	push   $0x804c0b
+  800fab:	6a 23                	push   $0x23
+  800fad:	68 28 4c 80 00       	push   $0x804c28
+  800fb2:	e8 38 f4 ff ff       	call   8003ef <_panic>
+
+00800fb7 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800fb7:	55                   	push   %ebp
+  800fb8:	89 e5                	mov    %esp,%ebp
+  800fba:	57                   	push   %edi
+  800fbb:	56                   	push   %esi
+  800fbc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc2:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fc7:	89 d1                	mov    %edx,%ecx
+  800fc9:	89 d3                	mov    %edx,%ebx
+  800fcb:	89 d7                	mov    %edx,%edi
+  800fcd:	89 d6                	mov    %edx,%esi
+  800fcf:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fd1:	5b                   	pop    %ebx
+  800fd2:	5e                   	pop    %esi
+  800fd3:	5f                   	pop    %edi
+  800fd4:	5d                   	pop    %ebp
+  800fd5:	c3                   	ret
+
+00800fd6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fd6:	55                   	push   %ebp
+  800fd7:	89 e5                	mov    %esp,%ebp
+  800fd9:	57                   	push   %edi
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fe6:	89 d1                	mov    %edx,%ecx
+  800fe8:	89 d3                	mov    %edx,%ebx
+  800fea:	89 d7                	mov    %edx,%edi
+  800fec:	89 d6                	mov    %edx,%esi
+  800fee:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  800ffb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffe:	be 00 00 00 00       	mov    $0x0,%esi
+  801003:	8b 55 08             	mov    0x8(%ebp),%edx
+  801006:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801009:	b8 04 00 00 00       	mov    $0x4,%eax
+  80100e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801011:	89 f7                	mov    %esi,%edi
+  801013:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801015:	85 c0                	test   %eax,%eax
+  801017:	7f 08                	jg     801021 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 04                	push   $0x4
+  801027:	68 0b 4c 80 00       	push   $0x804c0b
+  80102c:	6a 23                	push   $0x23
+  80102e:	68 28 4c 80 00       	push   $0x804c28
+  801033:	e8 b7 f3 ff ff       	call   8003ef <_panic>
+
+00801038 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801047:	b8 05 00 00 00       	mov    $0x5,%eax
+  80104c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801052:	8b 75 18             	mov    0x18(%ebp),%esi
+  801055:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801057:	85 c0                	test   %eax,%eax
+  801059:	7f 08                	jg     801063 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80105b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105e:	5b                   	pop    %ebx
+  80105f:	5e                   	pop    %esi
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801063:	83 ec 0c             	sub    $0xc,%esp
+  801066:	50                   	push   %eax
+  801067:	6a 05                	push   $0x5
+  801069:	68 0b 4c 80 00       	push   $0x804c0b
+  80106e:	6a 23                	push   $0x23
+  801070:	68 28 4c 80 00       	push   $0x804c28
+  801075:	e8 75 f3 ff ff       	call   8003ef <_panic>
+
+0080107a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+  801080:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801083:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801093:	89 df                	mov    %ebx,%edi
+  801095:	89 de                	mov    %ebx,%esi
+  801097:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801099:	85 c0                	test   %eax,%eax
+  80109b:	7f 08                	jg     8010a5 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80109d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a5:	83 ec 0c             	sub    $0xc,%esp
+  8010a8:	50                   	push   %eax
+  8010a9:	6a 06                	push   $0x6
+  8010ab:	68 0b 4c 80 00       	push   $0x804c0b
+  8010b0:	6a 23                	push   $0x23
+  8010b2:	68 28 4c 80 00       	push   $0x804c28
+  8010b7:	e8 33 f3 ff ff       	call   8003ef <_panic>
+
+008010bc <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  8010c2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010d5:	89 df                	mov    %ebx,%edi
+  8010d7:	89 de                	mov    %ebx,%esi
+  8010d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010db:	85 c0                	test   %eax,%eax
+  8010dd:	7f 08                	jg     8010e7 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e7:	83 ec 0c             	sub    $0xc,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	6a 08                	push   $0x8
+  8010ed:	68 0b 4c 80 00       	push   $0x804c0b
+  8010f2:	6a 23                	push   $0x23
+  8010f4:	68 28 4c 80 00       	push   $0x804c28
+  8010f9:	e8 f1 f2 ff ff       	call   8003ef <_panic>
+
+008010fe <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801107:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801112:	b8 09 00 00 00       	mov    $0x9,%eax
+  801117:	89 df                	mov    %ebx,%edi
+  801119:	89 de                	mov    %ebx,%esi
+  80111b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	7f 08                	jg     801129 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801124:	5b                   	pop    %ebx
+  801125:	5e                   	pop    %esi
+  801126:	5f                   	pop    %edi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801129:	83 ec 0c             	sub    $0xc,%esp
+  80112c:	50                   	push   %eax
+  80112d:	6a 09                	push   $0x9
+  80112f:	68 0b 4c 80 00       	push   $0x804c0b
+  801134:	6a 23                	push   $0x23
+  801136:	68 28 4c 80 00       	push   $0x804c28
+  80113b:	e8 af f2 ff ff       	call   8003ef <_panic>
+
+00801140 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801159:	89 df                	mov    %ebx,%edi
+  80115b:	89 de                	mov    %ebx,%esi
+  80115d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	7f 08                	jg     80116b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116b:	83 ec 0c             	sub    $0xc,%esp
+  80116e:	50                   	push   %eax
+  80116f:	6a 0a                	push   $0xa
+  801171:	68 0b 4c 80 00       	push   $0x804c0b
+  801176:	6a 23                	push   $0x23
+  801178:	68 28 4c 80 00       	push   $0x804c28
+  80117d:	e8 6d f2 ff ff       	call   8003ef <_panic>
+
+00801182 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8011a0:	5b                   	pop    %ebx
+  8011a1:	5e                   	pop    %esi
+  8011a2:	5f                   	pop    %edi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+
+008011a5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+  8011ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011bb:	89 cb                	mov    %ecx,%ebx
+  8011bd:	89 cf                	mov    %ecx,%edi
+  8011bf:	89 ce                	mov    %ecx,%esi
+  8011c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	7f 08                	jg     8011cf <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  8011c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ca:	5b                   	pop    %ebx
+  8011cb:	5e                   	pop    %esi
+  8011cc:	5f                   	pop    %edi
+  8011cd:	5d                   	pop    %ebp
+  8011ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  8011d2:	50                   	push   %eax
+  8011d3:	6a 0d                	push   $0xd
+  8011d5:	68 0b 4c 80 00       	push   $0x804c0b
+  8011da:	6a 23                	push   $0x23
+  8011dc:	68 28 4c 80 00       	push   $0x804c28
+  8011e1:	e8 09 f2 ff ff       	call   8003ef <_panic>
+
+008011e6 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	57                   	push   %edi
+  8011ea:	56                   	push   %esi
+  8011eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011fd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801200:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801202:	5b                   	pop    %ebx
+  801203:	5e                   	pop    %esi
+  801204:	5f                   	pop    %edi
+  801205:	5d                   	pop    %ebp
+  801206:	c3                   	ret
+
+00801207 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+  80120d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801210:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801215:	8b 55 08             	mov    0x8(%ebp),%edx
+  801218:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801220:	89 df                	mov    %ebx,%edi
+  801222:	89 de                	mov    %ebx,%esi
+  801224:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801226:	85 c0                	test   %eax,%eax
+  801228:	7f 08                	jg     801232 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80122a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80122d:	5b                   	pop    %ebx
+  80122e:	5e                   	pop    %esi
+  80122f:	5f                   	pop    %edi
+  801230:	5d                   	pop    %ebp
+  801231:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801232:	83 ec 0c             	sub    $0xc,%esp
+  801235:	50                   	push   %eax
+  801236:	6a 0d                	push   $0xd
+  801238:	68 0b 4c 80 00       	push   $0x804c0b
+  80123d:	6a 23                	push   $0x23
+  80123f:	68 28 4c 80 00       	push   $0x804c28
+  801244:	e8 a6 f1 ff ff       	call   8003ef <_panic>
+
+00801249 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801249:	55                   	push   %ebp
+  80124a:	89 e5                	mov    %esp,%ebp
+  80124c:	57                   	push   %edi
+  80124d:	56                   	push   %esi
+  80124e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80124f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801254:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801259:	89 d1                	mov    %edx,%ecx
+  80125b:	89 d3                	mov    %edx,%ebx
+  80125d:	89 d7                	mov    %edx,%edi
+  80125f:	89 d6                	mov    %edx,%esi
+  801261:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801263:	5b                   	pop    %ebx
+  801264:	5e                   	pop    %esi
+  801265:	5f                   	pop    %edi
+  801266:	5d                   	pop    %ebp
+  801267:	c3                   	ret
+
+00801268 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801268:	55                   	push   %ebp
+  801269:	89 e5                	mov    %esp,%ebp
+  80126b:	57                   	push   %edi
+  80126c:	56                   	push   %esi
+  80126d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80126e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801273:	8b 55 08             	mov    0x8(%ebp),%edx
+  801276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801279:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80127e:	89 df                	mov    %ebx,%edi
+  801280:	89 de                	mov    %ebx,%esi
+  801282:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801284:	5b                   	pop    %ebx
+  801285:	5e                   	pop    %esi
+  801286:	5f                   	pop    %edi
+  801287:	5d                   	pop    %ebp
+  801288:	c3                   	ret
+
+00801289 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801289:	55                   	push   %ebp
+  80128a:	89 e5                	mov    %esp,%ebp
+  80128c:	57                   	push   %edi
+  80128d:	56                   	push   %esi
+  80128e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	b8 10 00 00 00       	mov    $0x10,%eax
+  80129c:	89 cb                	mov    %ecx,%ebx
+  80129e:	89 cf                	mov    %ecx,%edi
+  8012a0:	89 ce                	mov    %ecx,%esi
+  8012a2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+
+008012a9 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8012a9:	55                   	push   %ebp
+  8012aa:	89 e5                	mov    %esp,%ebp
+  8012ac:	57                   	push   %edi
+  8012ad:	56                   	push   %esi
+  8012ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ba:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012bf:	89 df                	mov    %ebx,%edi
+  8012c1:	89 de                	mov    %ebx,%esi
+  8012c3:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  8012c5:	5b                   	pop    %ebx
+  8012c6:	5e                   	pop    %esi
+  8012c7:	5f                   	pop    %edi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+
+008012ca <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8012ca:	55                   	push   %ebp
+  8012cb:	89 e5                	mov    %esp,%ebp
+  8012cd:	57                   	push   %edi
+  8012ce:	56                   	push   %esi
+  8012cf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012db:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012e0:	89 df                	mov    %ebx,%edi
+  8012e2:	89 de                	mov    %ebx,%esi
+  8012e4:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+
+008012eb <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8012eb:	55                   	push   %ebp
+  8012ec:	89 e5                	mov    %esp,%ebp
+  8012ee:	57                   	push   %edi
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f9:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012fe:	89 cb                	mov    %ecx,%ebx
+  801300:	89 cf                	mov    %ecx,%edi
+  801302:	89 ce                	mov    %ecx,%esi
+  801304:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+
+0080130b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	57                   	push   %edi
+  80130f:	56                   	push   %esi
+  801310:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801316:	8b 55 08             	mov    0x8(%ebp),%edx
+  801319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801321:	89 df                	mov    %ebx,%edi
+  801323:	89 de                	mov    %ebx,%esi
+  801325:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5f                   	pop    %edi
+  80132a:	5d                   	pop    %ebp
+  80132b:	c3                   	ret
+
+0080132c <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	57                   	push   %edi
+  801330:	56                   	push   %esi
+  801331:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801332:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801337:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80133f:	89 cb                	mov    %ecx,%ebx
+  801341:	89 cf                	mov    %ecx,%edi
+  801343:	89 ce                	mov    %ecx,%esi
+  801345:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801347:	5b                   	pop    %ebx
+  801348:	5e                   	pop    %esi
+  801349:	5f                   	pop    %edi
+  80134a:	5d                   	pop    %ebp
+  80134b:	c3                   	ret
+
+0080134c <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80134c:	55                   	push   %ebp
+  80134d:	89 e5                	mov    %esp,%ebp
+  80134f:	57                   	push   %edi
+  801350:	56                   	push   %esi
+  801351:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801352:	be 00 00 00 00       	mov    $0x0,%esi
+  801357:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80135d:	b8 16 00 00 00       	mov    $0x16,%eax
+  801362:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801365:	89 f7                	mov    %esi,%edi
+  801367:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5f                   	pop    %edi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+
+0080136e <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801374:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80137f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801384:	89 df                	mov    %ebx,%edi
+  801386:	89 de                	mov    %ebx,%esi
+  801388:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80138a:	5b                   	pop    %ebx
+  80138b:	5e                   	pop    %esi
+  80138c:	5f                   	pop    %edi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+
+0080138f <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	57                   	push   %edi
+  801393:	56                   	push   %esi
+  801394:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801395:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	b8 18 00 00 00       	mov    $0x18,%eax
+  8013a2:	89 cb                	mov    %ecx,%ebx
+  8013a4:	89 cf                	mov    %ecx,%edi
+  8013a6:	89 ce                	mov    %ecx,%esi
+  8013a8:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8013aa:	5b                   	pop    %ebx
+  8013ab:	5e                   	pop    %esi
+  8013ac:	5f                   	pop    %edi
+  8013ad:	5d                   	pop    %ebp
+  8013ae:	c3                   	ret
+
+008013af <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	57                   	push   %edi
+  8013b3:	56                   	push   %esi
+  8013b4:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8013b5:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8013b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013c6:	89 df                	mov    %ebx,%edi
+  8013c8:	89 de                	mov    %ebx,%esi
+  8013ca:	cd 30                	int    $0x30
+}
+  8013cc:	5b                   	pop    %ebx
+  8013cd:	5e                   	pop    %esi
+  8013ce:	5f                   	pop    %edi
+  8013cf:	5d                   	pop    %ebp
+  8013d0:	c3                   	ret
+
+008013d1 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8013dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ea:	89 f7                	mov    %esi,%edi
+  8013ec:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8013ee:	5b                   	pop    %ebx
+  8013ef:	5e                   	pop    %esi
+  8013f0:	5f                   	pop    %edi
+  8013f1:	5d                   	pop    %ebp
+  8013f2:	c3                   	ret
+
+008013f3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	57                   	push   %edi
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801401:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801404:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801409:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140c:	89 f7                	mov    %esi,%edi
+  80140e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	57                   	push   %edi
+  801419:	56                   	push   %esi
+  80141a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80141b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801420:	8b 55 08             	mov    0x8(%ebp),%edx
+  801423:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801426:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80142b:	89 df                	mov    %ebx,%edi
+  80142d:	89 de                	mov    %ebx,%esi
+  80142f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801431:	5b                   	pop    %ebx
+  801432:	5e                   	pop    %esi
+  801433:	5f                   	pop    %edi
+  801434:	5d                   	pop    %ebp
+  801435:	c3                   	ret
+
+00801436 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801436:	55                   	push   %ebp
+  801437:	89 e5                	mov    %esp,%ebp
+  801439:	57                   	push   %edi
+  80143a:	56                   	push   %esi
+  80143b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80143c:	be 00 00 00 00       	mov    $0x0,%esi
+  801441:	8b 55 08             	mov    0x8(%ebp),%edx
+  801444:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801447:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80144c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80144f:	89 f7                	mov    %esi,%edi
+  801451:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801453:	5b                   	pop    %ebx
+  801454:	5e                   	pop    %esi
+  801455:	5f                   	pop    %edi
+  801456:	5d                   	pop    %ebp
+  801457:	c3                   	ret
+
+00801458 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	74 20                	je     80147c <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80145c:	89 c1                	mov    %eax,%ecx
+  80145e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801464:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80146a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801470:	8b 52 48             	mov    0x48(%edx),%edx
+  801473:	39 c2                	cmp    %eax,%edx
+  801475:	74 06                	je     80147d <thread_alive+0x25>
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80147c:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80147d:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801483:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	0f 95 c0             	setne  %al
+  80148e:	0f b6 c0             	movzbl %al,%eax
+  801491:	c3                   	ret
+
+00801492 <pgfault>:
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	57                   	push   %edi
+  801496:	56                   	push   %esi
+  801497:	53                   	push   %ebx
+  801498:	83 ec 0c             	sub    $0xc,%esp
+  80149b:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80149e:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8014a0:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8014a3:	89 f3                	mov    %esi,%ebx
+  8014a5:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8014a8:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8014af:	74 52                	je     801503 <pgfault+0x71>
+  8014b1:	a8 02                	test   $0x2,%al
+  8014b3:	75 14                	jne    8014c9 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8014b5:	83 ec 04             	sub    $0x4,%esp
+  8014b8:	68 36 4c 80 00       	push   $0x804c36
+  8014bd:	6a 2e                	push   $0x2e
+  8014bf:	68 54 4c 80 00       	push   $0x804c54
+  8014c4:	e8 26 ef ff ff       	call   8003ef <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  8014c9:	89 d8                	mov    %ebx,%eax
+  8014cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014d0:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8014d7:	83 ec 0c             	sub    $0xc,%esp
+  8014da:	57                   	push   %edi
+  8014db:	e8 65 29 00 00       	call   803e45 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8014e0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014e7:	83 e0 03             	and    $0x3,%eax
+  8014ea:	83 c4 10             	add    $0x10,%esp
+  8014ed:	83 f8 03             	cmp    $0x3,%eax
+  8014f0:	75 1a                	jne    80150c <pgfault+0x7a>
+			mutex_unlock(m);
+  8014f2:	83 ec 0c             	sub    $0xc,%esp
+  8014f5:	57                   	push   %edi
+  8014f6:	e8 b8 29 00 00       	call   803eb3 <mutex_unlock>
+			return;
+  8014fb:	83 c4 10             	add    $0x10,%esp
+  8014fe:	e9 9f 00 00 00       	jmp    8015a2 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801503:	a8 02                	test   $0x2,%al
+  801505:	74 ae                	je     8014b5 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801507:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80150c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801513:	f6 c4 08             	test   $0x8,%ah
+  801516:	74 9d                	je     8014b5 <pgfault+0x23>
+  801518:	89 e0                	mov    %esp,%eax
+  80151a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80151f:	29 c2                	sub    %eax,%edx
+  801521:	89 d0                	mov    %edx,%eax
+  801523:	c1 e8 0f             	shr    $0xf,%eax
+  801526:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80152c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801531:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801534:	c1 e0 0c             	shl    $0xc,%eax
+  801537:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80153c:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80153e:	83 ec 04             	sub    $0x4,%esp
+  801541:	6a 07                	push   $0x7
+  801543:	53                   	push   %ebx
+  801544:	6a 00                	push   $0x0
+  801546:	e8 aa fa ff ff       	call   800ff5 <sys_page_alloc>
+  80154b:	83 c4 10             	add    $0x10,%esp
+  80154e:	85 c0                	test   %eax,%eax
+  801550:	78 58                	js     8015aa <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801552:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801558:	83 ec 04             	sub    $0x4,%esp
+  80155b:	68 00 10 00 00       	push   $0x1000
+  801560:	56                   	push   %esi
+  801561:	53                   	push   %ebx
+  801562:	e8 0a f8 ff ff       	call   800d71 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801567:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80156e:	56                   	push   %esi
+  80156f:	6a 00                	push   $0x0
+  801571:	53                   	push   %ebx
+  801572:	6a 00                	push   $0x0
+  801574:	e8 bf fa ff ff       	call   801038 <sys_page_map>
+  801579:	83 c4 20             	add    $0x20,%esp
+  80157c:	85 c0                	test   %eax,%eax
+  80157e:	78 3c                	js     8015bc <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801580:	83 ec 08             	sub    $0x8,%esp
+  801583:	53                   	push   %ebx
+  801584:	6a 00                	push   $0x0
+  801586:	e8 ef fa ff ff       	call   80107a <sys_page_unmap>
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	78 3c                	js     8015ce <pgfault+0x13c>
+	if(m)
+  801592:	85 ff                	test   %edi,%edi
+  801594:	74 0c                	je     8015a2 <pgfault+0x110>
+		mutex_unlock(m);
+  801596:	83 ec 0c             	sub    $0xc,%esp
+  801599:	57                   	push   %edi
+  80159a:	e8 14 29 00 00       	call   803eb3 <mutex_unlock>
+  80159f:	83 c4 10             	add    $0x10,%esp
+}
+  8015a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5f                   	pop    %edi
+  8015a8:	5d                   	pop    %ebp
+  8015a9:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8015aa:	50                   	push   %eax
+  8015ab:	68 5f 4c 80 00       	push   $0x804c5f
+  8015b0:	6a 3d                	push   $0x3d
+  8015b2:	68 54 4c 80 00       	push   $0x804c54
+  8015b7:	e8 33 ee ff ff       	call   8003ef <_panic>
+		panic("sys_page_map: %e", ret);
+  8015bc:	50                   	push   %eax
+  8015bd:	68 72 4c 80 00       	push   $0x804c72
+  8015c2:	6a 40                	push   $0x40
+  8015c4:	68 54 4c 80 00       	push   $0x804c54
+  8015c9:	e8 21 ee ff ff       	call   8003ef <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8015ce:	50                   	push   %eax
+  8015cf:	68 83 4c 80 00       	push   $0x804c83
+  8015d4:	6a 42                	push   $0x42
+  8015d6:	68 54 4c 80 00       	push   $0x804c54
+  8015db:	e8 0f ee ff ff       	call   8003ef <_panic>
+
+008015e0 <thread_main>:
+{
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8015e6:	ff 75 0c             	push   0xc(%ebp)
+  8015e9:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8015ec:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8015f3:	e8 7e f9 ff ff       	call   800f76 <sys_env_destroy>
+}
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	c9                   	leave
+  8015fc:	c3                   	ret
+
+008015fd <fork>:
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+  801603:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801606:	68 92 14 80 00       	push   $0x801492
+  80160b:	e8 81 2b 00 00       	call   804191 <set_pgfault_handler>
+	if(sforked)
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80161a:	75 33                	jne    80164f <fork+0x52>
+	__asm __volatile("int %2"
+  80161c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801621:	cd 30                	int    $0x30
+  801623:	89 c7                	mov    %eax,%edi
+  801625:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801627:	85 c0                	test   %eax,%eax
+  801629:	0f 88 b4 00 00 00    	js     8016e3 <fork+0xe6>
+	if(envid == 0) {
+  80162f:	0f 84 c3 00 00 00    	je     8016f8 <fork+0xfb>
+	pgbatch_init(&pb);
+  801635:	83 ec 0c             	sub    $0xc,%esp
+  801638:	68 20 63 80 00       	push   $0x806320
+  80163d:	e8 4f 26 00 00       	call   803c91 <pgbatch_init>
+  801642:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801645:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80164a:	e9 9c 01 00 00       	jmp    8017eb <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80164f:	83 ec 0c             	sub    $0xc,%esp
+  801652:	68 c0 66 80 00       	push   $0x8066c0
+  801657:	e8 e9 27 00 00       	call   803e45 <mutex_lock>
+  80165c:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80165f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801664:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  801669:	eb 08                	jmp    801673 <fork+0x76>
+  80166b:	83 c3 01             	add    $0x1,%ebx
+  80166e:	83 fb 20             	cmp    $0x20,%ebx
+  801671:	74 5b                	je     8016ce <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801673:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  80167a:	89 f0                	mov    %esi,%eax
+  80167c:	e8 d7 fd ff ff       	call   801458 <thread_alive>
+  801681:	85 c0                	test   %eax,%eax
+  801683:	74 e6                	je     80166b <fork+0x6e>
+  801685:	89 e0                	mov    %esp,%eax
+  801687:	89 fa                	mov    %edi,%edx
+  801689:	29 c2                	sub    %eax,%edx
+  80168b:	89 d0                	mov    %edx,%eax
+  80168d:	c1 e8 0f             	shr    $0xf,%eax
+  801690:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801696:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80169b:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80169e:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8016a5:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8016a8:	83 ec 08             	sub    $0x8,%esp
+  8016ab:	50                   	push   %eax
+  8016ac:	56                   	push   %esi
+  8016ad:	e8 8e fa ff ff       	call   801140 <sys_env_set_pgfault_upcall>
+  8016b2:	83 c4 10             	add    $0x10,%esp
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	79 b2                	jns    80166b <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8016b9:	50                   	push   %eax
+  8016ba:	68 10 4d 80 00       	push   $0x804d10
+  8016bf:	68 00 01 00 00       	push   $0x100
+  8016c4:	68 54 4c 80 00       	push   $0x804c54
+  8016c9:	e8 21 ed ff ff       	call   8003ef <_panic>
+	mutex_unlock(&sfork_lock);
+  8016ce:	83 ec 0c             	sub    $0xc,%esp
+  8016d1:	68 c0 66 80 00       	push   $0x8066c0
+  8016d6:	e8 d8 27 00 00       	call   803eb3 <mutex_unlock>
+}
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	e9 39 ff ff ff       	jmp    80161c <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8016e3:	50                   	push   %eax
+  8016e4:	68 96 4c 80 00       	push   $0x804c96
+  8016e9:	68 91 00 00 00       	push   $0x91
+  8016ee:	68 54 4c 80 00       	push   $0x804c54
+  8016f3:	e8 f7 ec ff ff       	call   8003ef <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016f8:	e8 ba f8 ff ff       	call   800fb7 <sys_getenvid>
+  8016fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801702:	89 e1                	mov    %esp,%ecx
+  801704:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801709:	29 ca                	sub    %ecx,%edx
+  80170b:	89 d1                	mov    %edx,%ecx
+  80170d:	c1 e9 0f             	shr    $0xf,%ecx
+  801710:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801716:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171b:	0f 42 d1             	cmovb  %ecx,%edx
+  80171e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801724:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801729:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801730:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801735:	85 c0                	test   %eax,%eax
+  801737:	75 07                	jne    801740 <fork+0x143>
+		return 0;
+  801739:	89 c6                	mov    %eax,%esi
+  80173b:	e9 6f 02 00 00       	jmp    8019af <fork+0x3b2>
+  801740:	89 e2                	mov    %esp,%edx
+  801742:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801747:	29 d0                	sub    %edx,%eax
+  801749:	89 c3                	mov    %eax,%ebx
+  80174b:	c1 eb 0f             	shr    $0xf,%ebx
+  80174e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801753:	b8 00 00 00 00       	mov    $0x0,%eax
+  801758:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80175b:	83 ec 04             	sub    $0x4,%esp
+  80175e:	68 80 00 00 00       	push   $0x80
+  801763:	6a 00                	push   $0x0
+  801765:	68 40 66 80 00       	push   $0x806640
+  80176a:	e8 cd f5 ff ff       	call   800d3c <memset>
+	thread_ids[slot] = sys_getenvid();
+  80176f:	e8 43 f8 ff ff       	call   800fb7 <sys_getenvid>
+  801774:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80177b:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  801782:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801787:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80178e:	e8 a4 26 00 00       	call   803e37 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801793:	83 c4 0c             	add    $0xc,%esp
+  801796:	68 07 04 00 00       	push   $0x407
+  80179b:	68 00 00 00 e1       	push   $0xe1000000
+  8017a0:	6a 00                	push   $0x0
+  8017a2:	e8 4e f8 ff ff       	call   800ff5 <sys_page_alloc>
+  8017a7:	83 c4 10             	add    $0x10,%esp
+  8017aa:	85 c0                	test   %eax,%eax
+  8017ac:	0f 89 fd 01 00 00    	jns    8019af <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8017b2:	50                   	push   %eax
+  8017b3:	68 5f 4c 80 00       	push   $0x804c5f
+  8017b8:	68 12 01 00 00       	push   $0x112
+  8017bd:	68 54 4c 80 00       	push   $0x804c54
+  8017c2:	e8 28 ec ff ff       	call   8003ef <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  8017c7:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8017cd:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8017d3:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8017d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8017df:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8017e5:	0f 87 4f 01 00 00    	ja     80193a <fork+0x33d>
+		pd = PDX(addr);
+  8017eb:	89 d8                	mov    %ebx,%eax
+  8017ed:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8017f0:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8017f7:	f6 c2 01             	test   $0x1,%dl
+  8017fa:	74 cb                	je     8017c7 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8017fc:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801801:	0f 85 92 00 00 00    	jne    801899 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801807:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80180d:	76 10                	jbe    80181f <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80180f:	89 d8                	mov    %ebx,%eax
+  801811:	f7 d8                	neg    %eax
+  801813:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801818:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80181d:	74 ba                	je     8017d9 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80181f:	89 d8                	mov    %ebx,%eax
+  801821:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801824:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80182b:	f6 c2 01             	test   $0x1,%dl
+  80182e:	74 a9                	je     8017d9 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801830:	89 c1                	mov    %eax,%ecx
+  801832:	c1 e1 0c             	shl    $0xc,%ecx
+  801835:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801838:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80183f:	f6 c6 04             	test   $0x4,%dh
+  801842:	0f 85 8e 00 00 00    	jne    8018d6 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801848:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80184f:	f6 c6 08             	test   $0x8,%dh
+  801852:	75 0f                	jne    801863 <fork+0x266>
+  801854:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80185b:	a8 02                	test   $0x2,%al
+  80185d:	0f 84 bb 00 00 00    	je     80191e <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801863:	83 ec 08             	sub    $0x8,%esp
+  801866:	68 05 08 00 00       	push   $0x805
+  80186b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80186e:	50                   	push   %eax
+  80186f:	56                   	push   %esi
+  801870:	50                   	push   %eax
+  801871:	6a 00                	push   $0x0
+  801873:	68 20 63 80 00       	push   $0x806320
+  801878:	e8 d2 24 00 00       	call   803d4f <pgbatch_map>
+  80187d:	83 c4 20             	add    $0x20,%esp
+  801880:	85 c0                	test   %eax,%eax
+  801882:	79 76                	jns    8018fa <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801884:	50                   	push   %eax
+  801885:	68 ba 4c 80 00       	push   $0x804cba
+  80188a:	68 bc 00 00 00       	push   $0xbc
+  80188f:	68 54 4c 80 00       	push   $0x804c54
+  801894:	e8 56 eb ff ff       	call   8003ef <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801899:	83 ec 0c             	sub    $0xc,%esp
+  80189c:	68 00 08 00 00       	push   $0x800
+  8018a1:	56                   	push   %esi
+  8018a2:	53                   	push   %ebx
+  8018a3:	6a 00                	push   $0x0
+  8018a5:	68 20 63 80 00       	push   $0x806320
+  8018aa:	e8 4b 25 00 00       	call   803dfa <pgbatch_sharept>
+  8018af:	83 c4 20             	add    $0x20,%esp
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 0b                	js     8018c1 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8018b6:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8018bc:	e9 18 ff ff ff       	jmp    8017d9 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8018c1:	50                   	push   %eax
+  8018c2:	68 a6 4c 80 00       	push   $0x804ca6
+  8018c7:	68 b2 00 00 00       	push   $0xb2
+  8018cc:	68 54 4c 80 00       	push   $0x804c54
+  8018d1:	e8 19 eb ff ff       	call   8003ef <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8018d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018dd:	83 ec 08             	sub    $0x8,%esp
+  8018e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018e5:	50                   	push   %eax
+  8018e6:	51                   	push   %ecx
+  8018e7:	56                   	push   %esi
+  8018e8:	51                   	push   %ecx
+  8018e9:	6a 00                	push   $0x0
+  8018eb:	68 20 63 80 00       	push   $0x806320
+  8018f0:	e8 5a 24 00 00       	call   803d4f <pgbatch_map>
+  8018f5:	83 c4 20             	add    $0x20,%esp
+  8018f8:	eb 17                	jmp    801911 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8018fa:	68 05 08 00 00       	push   $0x805
+  8018ff:	ff 75 e4             	push   -0x1c(%ebp)
+  801902:	6a 00                	push   $0x0
+  801904:	68 20 63 80 00       	push   $0x806320
+  801909:	e8 b5 24 00 00       	call   803dc3 <pgbatch_protect>
+  80190e:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801911:	85 c0                	test   %eax,%eax
+  801913:	0f 89 c0 fe ff ff    	jns    8017d9 <fork+0x1dc>
+  801919:	e9 66 ff ff ff       	jmp    801884 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80191e:	83 ec 08             	sub    $0x8,%esp
+  801921:	6a 05                	push   $0x5
+  801923:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801926:	50                   	push   %eax
+  801927:	56                   	push   %esi
+  801928:	50                   	push   %eax
+  801929:	6a 00                	push   $0x0
+  80192b:	68 20 63 80 00       	push   $0x806320
+  801930:	e8 1a 24 00 00       	call   803d4f <pgbatch_map>
+  801935:	83 c4 20             	add    $0x20,%esp
+  801938:	eb d7                	jmp    801911 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80193a:	6a 07                	push   $0x7
+  80193c:	68 00 f0 bf ee       	push   $0xeebff000
+  801941:	57                   	push   %edi
+  801942:	68 20 63 80 00       	push   $0x806320
+  801947:	e8 cc 23 00 00       	call   803d18 <pgbatch_alloc>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 66                	js     8019b9 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801953:	83 ec 0c             	sub    $0xc,%esp
+  801956:	68 20 63 80 00       	push   $0x806320
+  80195b:	e8 3f 23 00 00       	call   803c9f <pgbatch_flush>
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	85 c0                	test   %eax,%eax
+  801965:	78 52                	js     8019b9 <fork+0x3bc>
+  801967:	89 e2                	mov    %esp,%edx
+  801969:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80196e:	29 d0                	sub    %edx,%eax
+  801970:	89 c2                	mov    %eax,%edx
+  801972:	c1 ea 0f             	shr    $0xf,%edx
+  801975:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801982:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801989:	8b 40 78             	mov    0x78(%eax),%eax
+  80198c:	83 ec 08             	sub    $0x8,%esp
+  80198f:	50                   	push   %eax
+  801990:	57                   	push   %edi
+  801991:	e8 aa f7 ff ff       	call   801140 <sys_env_set_pgfault_upcall>
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 31                	js     8019ce <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  80199d:	83 ec 08             	sub    $0x8,%esp
+  8019a0:	6a 02                	push   $0x2
+  8019a2:	57                   	push   %edi
+  8019a3:	e8 14 f7 ff ff       	call   8010bc <sys_env_set_status>
+  8019a8:	83 c4 10             	add    $0x10,%esp
+  8019ab:	85 c0                	test   %eax,%eax
+  8019ad:	78 34                	js     8019e3 <fork+0x3e6>
+}
+  8019af:	89 f0                	mov    %esi,%eax
+  8019b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b4:	5b                   	pop    %ebx
+  8019b5:	5e                   	pop    %esi
+  8019b6:	5f                   	pop    %edi
+  8019b7:	5d                   	pop    %ebp
+  8019b8:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  8019b9:	50                   	push   %eax
+  8019ba:	68 c6 4c 80 00       	push   $0x804cc6
+  8019bf:	68 c0 00 00 00       	push   $0xc0
+  8019c4:	68 54 4c 80 00       	push   $0x804c54
+  8019c9:	e8 21 ea ff ff       	call   8003ef <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  8019ce:	50                   	push   %eax
+  8019cf:	68 db 4c 80 00       	push   $0x804cdb
+  8019d4:	68 c2 00 00 00       	push   $0xc2
+  8019d9:	68 54 4c 80 00       	push   $0x804c54
+  8019de:	e8 0c ea ff ff       	call   8003ef <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8019e3:	50                   	push   %eax
+  8019e4:	68 f6 4c 80 00       	push   $0x804cf6
+  8019e9:	68 c4 00 00 00       	push   $0xc4
+  8019ee:	68 54 4c 80 00       	push   $0x804c54
+  8019f3:	e8 f7 e9 ff ff       	call   8003ef <_panic>
+
+008019f8 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	57                   	push   %edi
+  8019fc:	56                   	push   %esi
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801a01:	68 c0 66 80 00       	push   $0x8066c0
+  801a06:	e8 3a 24 00 00       	call   803e45 <mutex_lock>
+  801a0b:	89 e2                	mov    %esp,%edx
+  801a0d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801a12:	29 d0                	sub    %edx,%eax
+	return slot < NTHREADS ? slot : 0;
+  801a14:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801a17:	89 c3                	mov    %eax,%ebx
+  801a19:	c1 eb 0f             	shr    $0xf,%ebx
+  801a1c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801a21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a26:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801a29:	e8 89 f5 ff ff       	call   800fb7 <sys_getenvid>
+  801a2e:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801a35:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801a3a:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801a41:	e8 12 fa ff ff       	call   801458 <thread_alive>
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	74 24                	je     801a6e <sfork+0x76>
+  801a4a:	83 c3 01             	add    $0x1,%ebx
+  801a4d:	83 fb 20             	cmp    $0x20,%ebx
+  801a50:	75 e8                	jne    801a3a <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801a52:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801a57:	83 ec 0c             	sub    $0xc,%esp
+  801a5a:	68 c0 66 80 00       	push   $0x8066c0
+  801a5f:	e8 4f 24 00 00       	call   803eb3 <mutex_unlock>
+	return r;
+}
+  801a64:	89 f0                	mov    %esi,%eax
+  801a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a69:	5b                   	pop    %ebx
+  801a6a:	5e                   	pop    %esi
+  801a6b:	5f                   	pop    %edi
+  801a6c:	5d                   	pop    %ebp
+  801a6d:	c3                   	ret
+	if (i == NTHREADS) {
+  801a6e:	83 fb 20             	cmp    $0x20,%ebx
+  801a71:	0f 84 53 01 00 00    	je     801bca <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801a77:	89 d8                	mov    %ebx,%eax
+  801a79:	c1 e0 0f             	shl    $0xf,%eax
+  801a7c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801a7f:	83 ec 0c             	sub    $0xc,%esp
+  801a82:	68 00 60 80 00       	push   $0x806000
+  801a87:	e8 05 22 00 00       	call   803c91 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801a8c:	83 c4 10             	add    $0x10,%esp
+  801a8f:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801a96:	75 1f                	jne    801ab7 <sfork+0xbf>
+  801a98:	68 07 04 00 00       	push   $0x407
+  801a9d:	68 00 00 00 e1       	push   $0xe1000000
+  801aa2:	6a 00                	push   $0x0
+  801aa4:	68 00 60 80 00       	push   $0x806000
+  801aa9:	e8 6a 22 00 00       	call   803d18 <pgbatch_alloc>
+  801aae:	89 c6                	mov    %eax,%esi
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 a0                	js     801a57 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801ab7:	6a 07                	push   $0x7
+  801ab9:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801abe:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ac1:	29 c8                	sub    %ecx,%eax
+  801ac3:	50                   	push   %eax
+  801ac4:	6a 00                	push   $0x0
+  801ac6:	68 00 60 80 00       	push   $0x806000
+  801acb:	e8 48 22 00 00       	call   803d18 <pgbatch_alloc>
+  801ad0:	89 c6                	mov    %eax,%esi
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	0f 88 7a ff ff ff    	js     801a57 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801add:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801ae2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ae5:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801ae7:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801aec:	29 c8                	sub    %ecx,%eax
+  801aee:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801af1:	39 c7                	cmp    %eax,%edi
+  801af3:	73 29                	jae    801b1e <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801af5:	6a 07                	push   $0x7
+  801af7:	57                   	push   %edi
+  801af8:	6a 00                	push   $0x0
+  801afa:	68 00 60 80 00       	push   $0x806000
+  801aff:	e8 14 22 00 00       	call   803d18 <pgbatch_alloc>
+  801b04:	89 c6                	mov    %eax,%esi
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	0f 88 46 ff ff ff    	js     801a57 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801b11:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801b17:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801b1a:	39 c7                	cmp    %eax,%edi
+  801b1c:	72 d7                	jb     801af5 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801b1e:	83 ec 0c             	sub    $0xc,%esp
+  801b21:	68 00 60 80 00       	push   $0x806000
+  801b26:	e8 74 21 00 00       	call   803c9f <pgbatch_flush>
+  801b2b:	89 c6                	mov    %eax,%esi
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	0f 88 1f ff ff ff    	js     801a57 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801b38:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801b3d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b40:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801b42:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801b48:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b4b:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801b4e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b51:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b54:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801b57:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b5c:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b5e:	52                   	push   %edx
+  801b5f:	50                   	push   %eax
+  801b60:	68 e0 15 80 00       	push   $0x8015e0
+  801b65:	e8 cc f8 ff ff       	call   801436 <sys_exofork_shared>
+  801b6a:	89 c6                	mov    %eax,%esi
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	0f 88 e0 fe ff ff    	js     801a57 <sfork+0x5f>
+	thread_ids[i] = id;
+  801b77:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b7e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b83:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801b89:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b8e:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801b95:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801b9c:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+  801ba2:	6a 02                	push   $0x2
+  801ba4:	56                   	push   %esi
+  801ba5:	e8 12 f5 ff ff       	call   8010bc <sys_env_set_status>
+  801baa:	89 c3                	mov    %eax,%ebx
+  801bac:	83 c4 10             	add    $0x10,%esp
+  801baf:	85 c0                	test   %eax,%eax
+  801bb1:	0f 89 a0 fe ff ff    	jns    801a57 <sfork+0x5f>
+		sys_env_destroy(id);
+  801bb7:	83 ec 0c             	sub    $0xc,%esp
+  801bba:	56                   	push   %esi
+  801bbb:	e8 b6 f3 ff ff       	call   800f76 <sys_env_destroy>
+		goto out;
+  801bc0:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801bc3:	89 de                	mov    %ebx,%esi
+		goto out;
+  801bc5:	e9 8d fe ff ff       	jmp    801a57 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801bca:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801bcf:	e9 83 fe ff ff       	jmp    801a57 <sfork+0x5f>
+
+00801bd4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bda:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bdf:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801be2:	5d                   	pop    %ebp
+  801be3:	c3                   	ret
+
+00801be4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bea:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801bef:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bf4:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801bf9:	5d                   	pop    %ebp
+  801bfa:	c3                   	ret
+
+00801bfb <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801bfb:	55                   	push   %ebp
+  801bfc:	89 e5                	mov    %esp,%ebp
+  801bfe:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c03:	89 c2                	mov    %eax,%edx
+  801c05:	c1 ea 16             	shr    $0x16,%edx
+  801c08:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c0f:	f6 c2 01             	test   $0x1,%dl
+  801c12:	74 29                	je     801c3d <fd_alloc+0x42>
+  801c14:	89 c2                	mov    %eax,%edx
+  801c16:	c1 ea 0c             	shr    $0xc,%edx
+  801c19:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c20:	f6 c2 01             	test   $0x1,%dl
+  801c23:	74 18                	je     801c3d <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801c25:	05 00 10 00 00       	add    $0x1000,%eax
+  801c2a:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801c2f:	75 d2                	jne    801c03 <fd_alloc+0x8>
+  801c31:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c36:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801c3b:	eb 05                	jmp    801c42 <fd_alloc+0x47>
+			return 0;
+  801c3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c42:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c45:	89 02                	mov    %eax,(%edx)
+}
+  801c47:	89 c8                	mov    %ecx,%eax
+  801c49:	5d                   	pop    %ebp
+  801c4a:	c3                   	ret
+
+00801c4b <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c51:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801c56:	77 30                	ja     801c88 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c58:	c1 e0 0c             	shl    $0xc,%eax
+  801c5b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801c60:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c66:	f6 c2 01             	test   $0x1,%dl
+  801c69:	74 24                	je     801c8f <fd_lookup+0x44>
+  801c6b:	89 c2                	mov    %eax,%edx
+  801c6d:	c1 ea 0c             	shr    $0xc,%edx
+  801c70:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c77:	f6 c2 01             	test   $0x1,%dl
+  801c7a:	74 1a                	je     801c96 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c7f:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c86:	5d                   	pop    %ebp
+  801c87:	c3                   	ret
+		return -E_INVAL;
+  801c88:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c8d:	eb f7                	jmp    801c86 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801c8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c94:	eb f0                	jmp    801c86 <fd_lookup+0x3b>
+  801c96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c9b:	eb e9                	jmp    801c86 <fd_lookup+0x3b>
+
+00801c9d <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c9d:	55                   	push   %ebp
+  801c9e:	89 e5                	mov    %esp,%ebp
+  801ca0:	53                   	push   %ebx
+  801ca1:	83 ec 04             	sub    $0x4,%esp
+  801ca4:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cac:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801cb1:	39 13                	cmp    %edx,(%ebx)
+  801cb3:	74 54                	je     801d09 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801cb5:	83 c0 01             	add    $0x1,%eax
+  801cb8:	8b 1c 85 ac 4d 80 00 	mov    0x804dac(,%eax,4),%ebx
+  801cbf:	85 db                	test   %ebx,%ebx
+  801cc1:	75 ee                	jne    801cb1 <dev_lookup+0x14>
+  801cc3:	89 e1                	mov    %esp,%ecx
+  801cc5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801cca:	29 c8                	sub    %ecx,%eax
+  801ccc:	89 c1                	mov    %eax,%ecx
+  801cce:	c1 e9 0f             	shr    $0xf,%ecx
+  801cd1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cdb:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cde:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ce5:	8b 40 48             	mov    0x48(%eax),%eax
+  801ce8:	83 ec 04             	sub    $0x4,%esp
+  801ceb:	52                   	push   %edx
+  801cec:	50                   	push   %eax
+  801ced:	68 30 4d 80 00       	push   $0x804d30
+  801cf2:	e8 d3 e7 ff ff       	call   8004ca <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801cff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d02:	89 1a                	mov    %ebx,(%edx)
+}
+  801d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d07:	c9                   	leave
+  801d08:	c3                   	ret
+			return 0;
+  801d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0e:	eb ef                	jmp    801cff <dev_lookup+0x62>
+
+00801d10 <fd_close>:
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	57                   	push   %edi
+  801d14:	56                   	push   %esi
+  801d15:	53                   	push   %ebx
+  801d16:	83 ec 24             	sub    $0x24,%esp
+  801d19:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d1c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d1f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d22:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d23:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d29:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d2c:	50                   	push   %eax
+  801d2d:	e8 19 ff ff ff       	call   801c4b <fd_lookup>
+  801d32:	89 c3                	mov    %eax,%ebx
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 05                	js     801d40 <fd_close+0x30>
+	    || fd != fd2)
+  801d3b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d3e:	74 0f                	je     801d4f <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801d40:	85 ff                	test   %edi,%edi
+  801d42:	0f 44 df             	cmove  %edi,%ebx
+}
+  801d45:	89 d8                	mov    %ebx,%eax
+  801d47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d4a:	5b                   	pop    %ebx
+  801d4b:	5e                   	pop    %esi
+  801d4c:	5f                   	pop    %edi
+  801d4d:	5d                   	pop    %ebp
+  801d4e:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  801d52:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d55:	50                   	push   %eax
+  801d56:	ff 36                	push   (%esi)
+  801d58:	e8 40 ff ff ff       	call   801c9d <dev_lookup>
+  801d5d:	89 c3                	mov    %eax,%ebx
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 1a                	js     801d80 <fd_close+0x70>
+		if (dev->dev_close)
+  801d66:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d69:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	74 0b                	je     801d80 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801d75:	83 ec 0c             	sub    $0xc,%esp
+  801d78:	56                   	push   %esi
+  801d79:	ff d0                	call   *%eax
+  801d7b:	89 c3                	mov    %eax,%ebx
+  801d7d:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d80:	83 ec 08             	sub    $0x8,%esp
+  801d83:	56                   	push   %esi
+  801d84:	6a 00                	push   $0x0
+  801d86:	e8 ef f2 ff ff       	call   80107a <sys_page_unmap>
+	return r;
+  801d8b:	83 c4 10             	add    $0x10,%esp
+  801d8e:	eb b5                	jmp    801d45 <fd_close+0x35>
+
+00801d90 <close>:
+
+int
+close(int fdnum)
+{
+  801d90:	55                   	push   %ebp
+  801d91:	89 e5                	mov    %esp,%ebp
+  801d93:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d99:	50                   	push   %eax
+  801d9a:	ff 75 08             	push   0x8(%ebp)
+  801d9d:	e8 a9 fe ff ff       	call   801c4b <fd_lookup>
+  801da2:	83 c4 10             	add    $0x10,%esp
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	79 02                	jns    801dab <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+		return fd_close(fd, 1);
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	6a 01                	push   $0x1
+  801db0:	ff 75 f4             	push   -0xc(%ebp)
+  801db3:	e8 58 ff ff ff       	call   801d10 <fd_close>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	eb ec                	jmp    801da9 <close+0x19>
+
+00801dbd <close_all>:
+
+void
+close_all(void)
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	53                   	push   %ebx
+  801dc1:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dc9:	83 ec 0c             	sub    $0xc,%esp
+  801dcc:	53                   	push   %ebx
+  801dcd:	e8 be ff ff ff       	call   801d90 <close>
+	for (i = 0; i < MAXFD; i++)
+  801dd2:	83 c3 01             	add    $0x1,%ebx
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801dde:	75 e9                	jne    801dc9 <close_all+0xc>
+}
+  801de0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801de3:	c9                   	leave
+  801de4:	c3                   	ret
+
+00801de5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801de5:	55                   	push   %ebp
+  801de6:	89 e5                	mov    %esp,%ebp
+  801de8:	57                   	push   %edi
+  801de9:	56                   	push   %esi
+  801dea:	53                   	push   %ebx
+  801deb:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801dee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801df1:	50                   	push   %eax
+  801df2:	ff 75 08             	push   0x8(%ebp)
+  801df5:	e8 51 fe ff ff       	call   801c4b <fd_lookup>
+  801dfa:	89 c3                	mov    %eax,%ebx
+  801dfc:	83 c4 10             	add    $0x10,%esp
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 7f                	js     801e82 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801e03:	83 ec 0c             	sub    $0xc,%esp
+  801e06:	ff 75 0c             	push   0xc(%ebp)
+  801e09:	e8 82 ff ff ff       	call   801d90 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e0e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e11:	c1 e6 0c             	shl    $0xc,%esi
+  801e14:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e1a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e1d:	89 3c 24             	mov    %edi,(%esp)
+  801e20:	e8 bf fd ff ff       	call   801be4 <fd2data>
+  801e25:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e27:	89 34 24             	mov    %esi,(%esp)
+  801e2a:	e8 b5 fd ff ff       	call   801be4 <fd2data>
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801e35:	89 d8                	mov    %ebx,%eax
+  801e37:	c1 e8 16             	shr    $0x16,%eax
+  801e3a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e41:	a8 01                	test   $0x1,%al
+  801e43:	74 11                	je     801e56 <dup+0x71>
+  801e45:	89 d8                	mov    %ebx,%eax
+  801e47:	c1 e8 0c             	shr    $0xc,%eax
+  801e4a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e51:	f6 c2 01             	test   $0x1,%dl
+  801e54:	75 36                	jne    801e8c <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e56:	89 f8                	mov    %edi,%eax
+  801e58:	c1 e8 0c             	shr    $0xc,%eax
+  801e5b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e6a:	50                   	push   %eax
+  801e6b:	56                   	push   %esi
+  801e6c:	6a 00                	push   $0x0
+  801e6e:	57                   	push   %edi
+  801e6f:	6a 00                	push   $0x0
+  801e71:	e8 c2 f1 ff ff       	call   801038 <sys_page_map>
+  801e76:	89 c3                	mov    %eax,%ebx
+  801e78:	83 c4 20             	add    $0x20,%esp
+  801e7b:	85 c0                	test   %eax,%eax
+  801e7d:	78 33                	js     801eb2 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e82:	89 d8                	mov    %ebx,%eax
+  801e84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e87:	5b                   	pop    %ebx
+  801e88:	5e                   	pop    %esi
+  801e89:	5f                   	pop    %edi
+  801e8a:	5d                   	pop    %ebp
+  801e8b:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e8c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e93:	83 ec 0c             	sub    $0xc,%esp
+  801e96:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e9b:	50                   	push   %eax
+  801e9c:	ff 75 d4             	push   -0x2c(%ebp)
+  801e9f:	6a 00                	push   $0x0
+  801ea1:	53                   	push   %ebx
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	e8 8f f1 ff ff       	call   801038 <sys_page_map>
+  801ea9:	89 c3                	mov    %eax,%ebx
+  801eab:	83 c4 20             	add    $0x20,%esp
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	79 a4                	jns    801e56 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801eb2:	83 ec 08             	sub    $0x8,%esp
+  801eb5:	56                   	push   %esi
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	e8 bd f1 ff ff       	call   80107a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ebd:	83 c4 08             	add    $0x8,%esp
+  801ec0:	ff 75 d4             	push   -0x2c(%ebp)
+  801ec3:	6a 00                	push   $0x0
+  801ec5:	e8 b0 f1 ff ff       	call   80107a <sys_page_unmap>
+	return r;
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	eb b3                	jmp    801e82 <dup+0x9d>
+
+00801ecf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ecf:	55                   	push   %ebp
+  801ed0:	89 e5                	mov    %esp,%ebp
+  801ed2:	56                   	push   %esi
+  801ed3:	53                   	push   %ebx
+  801ed4:	83 ec 18             	sub    $0x18,%esp
+  801ed7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801eda:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801edd:	50                   	push   %eax
+  801ede:	53                   	push   %ebx
+  801edf:	e8 67 fd ff ff       	call   801c4b <fd_lookup>
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	85 c0                	test   %eax,%eax
+  801ee9:	78 3c                	js     801f27 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801eeb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eee:	83 ec 08             	sub    $0x8,%esp
+  801ef1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef4:	50                   	push   %eax
+  801ef5:	ff 36                	push   (%esi)
+  801ef7:	e8 a1 fd ff ff       	call   801c9d <dev_lookup>
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 24                	js     801f27 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f03:	8b 46 08             	mov    0x8(%esi),%eax
+  801f06:	83 e0 03             	and    $0x3,%eax
+  801f09:	83 f8 01             	cmp    $0x1,%eax
+  801f0c:	74 20                	je     801f2e <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f11:	8b 40 08             	mov    0x8(%eax),%eax
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	74 54                	je     801f6c <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f18:	83 ec 04             	sub    $0x4,%esp
+  801f1b:	ff 75 10             	push   0x10(%ebp)
+  801f1e:	ff 75 0c             	push   0xc(%ebp)
+  801f21:	56                   	push   %esi
+  801f22:	ff d0                	call   *%eax
+  801f24:	83 c4 10             	add    $0x10,%esp
+}
+  801f27:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f2a:	5b                   	pop    %ebx
+  801f2b:	5e                   	pop    %esi
+  801f2c:	5d                   	pop    %ebp
+  801f2d:	c3                   	ret
+  801f2e:	89 e2                	mov    %esp,%edx
+  801f30:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f35:	29 d0                	sub    %edx,%eax
+  801f37:	89 c2                	mov    %eax,%edx
+  801f39:	c1 ea 0f             	shr    $0xf,%edx
+  801f3c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f46:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f49:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801f50:	8b 40 48             	mov    0x48(%eax),%eax
+  801f53:	83 ec 04             	sub    $0x4,%esp
+  801f56:	53                   	push   %ebx
+  801f57:	50                   	push   %eax
+  801f58:	68 71 4d 80 00       	push   $0x804d71
+  801f5d:	e8 68 e5 ff ff       	call   8004ca <cprintf>
+		return -E_INVAL;
+  801f62:	83 c4 10             	add    $0x10,%esp
+  801f65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6a:	eb bb                	jmp    801f27 <read+0x58>
+		return -E_NOT_SUPP;
+  801f6c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f71:	eb b4                	jmp    801f27 <read+0x58>
+
+00801f73 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f73:	55                   	push   %ebp
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	57                   	push   %edi
+  801f77:	56                   	push   %esi
+  801f78:	53                   	push   %ebx
+  801f79:	83 ec 0c             	sub    $0xc,%esp
+  801f7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f7f:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f82:	85 f6                	test   %esi,%esi
+  801f84:	74 30                	je     801fb6 <readn+0x43>
+  801f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f90:	83 ec 04             	sub    $0x4,%esp
+  801f93:	89 f2                	mov    %esi,%edx
+  801f95:	29 c2                	sub    %eax,%edx
+  801f97:	52                   	push   %edx
+  801f98:	01 f8                	add    %edi,%eax
+  801f9a:	50                   	push   %eax
+  801f9b:	ff 75 08             	push   0x8(%ebp)
+  801f9e:	e8 2c ff ff ff       	call   801ecf <read>
+		if (m < 0)
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	78 15                	js     801fbf <readn+0x4c>
+			return m;
+		if (m == 0)
+  801faa:	74 11                	je     801fbd <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801fac:	01 c3                	add    %eax,%ebx
+  801fae:	89 d8                	mov    %ebx,%eax
+  801fb0:	39 f3                	cmp    %esi,%ebx
+  801fb2:	72 dc                	jb     801f90 <readn+0x1d>
+  801fb4:	eb 09                	jmp    801fbf <readn+0x4c>
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbb:	eb 02                	jmp    801fbf <readn+0x4c>
+  801fbd:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+
+00801fc7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	56                   	push   %esi
+  801fcb:	53                   	push   %ebx
+  801fcc:	83 ec 18             	sub    $0x18,%esp
+  801fcf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fd2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fd5:	50                   	push   %eax
+  801fd6:	53                   	push   %ebx
+  801fd7:	e8 6f fc ff ff       	call   801c4b <fd_lookup>
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	78 37                	js     80201a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fe3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fe6:	83 ec 08             	sub    $0x8,%esp
+  801fe9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fec:	50                   	push   %eax
+  801fed:	ff 36                	push   (%esi)
+  801fef:	e8 a9 fc ff ff       	call   801c9d <dev_lookup>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 1f                	js     80201a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ffb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fff:	74 20                	je     802021 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802001:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802004:	8b 40 0c             	mov    0xc(%eax),%eax
+  802007:	85 c0                	test   %eax,%eax
+  802009:	74 54                	je     80205f <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80200b:	83 ec 04             	sub    $0x4,%esp
+  80200e:	ff 75 10             	push   0x10(%ebp)
+  802011:	ff 75 0c             	push   0xc(%ebp)
+  802014:	56                   	push   %esi
+  802015:	ff d0                	call   *%eax
+  802017:	83 c4 10             	add    $0x10,%esp
+}
+  80201a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80201d:	5b                   	pop    %ebx
+  80201e:	5e                   	pop    %esi
+  80201f:	5d                   	pop    %ebp
+  802020:	c3                   	ret
+  802021:	89 e2                	mov    %esp,%edx
+  802023:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802028:	29 d0                	sub    %edx,%eax
+  80202a:	89 c2                	mov    %eax,%edx
+  80202c:	c1 ea 0f             	shr    $0xf,%edx
+  80202f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802034:	b8 00 00 00 00       	mov    $0x0,%eax
+  802039:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80203c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802043:	8b 40 48             	mov    0x48(%eax),%eax
+  802046:	83 ec 04             	sub    $0x4,%esp
+  802049:	53                   	push   %ebx
+  80204a:	50                   	push   %eax
+  80204b:	68 8d 4d 80 00       	push   $0x804d8d
+  802050:	e8 75 e4 ff ff       	call   8004ca <cprintf>
+		return -E_INVAL;
+  802055:	83 c4 10             	add    $0x10,%esp
+  802058:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205d:	eb bb                	jmp    80201a <write+0x53>
+		return -E_NOT_SUPP;
+  80205f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802064:	eb b4                	jmp    80201a <write+0x53>
+
+00802066 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80206c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80206f:	50                   	push   %eax
+  802070:	ff 75 08             	push   0x8(%ebp)
+  802073:	e8 d3 fb ff ff       	call   801c4b <fd_lookup>
+  802078:	83 c4 10             	add    $0x10,%esp
+  80207b:	85 c0                	test   %eax,%eax
+  80207d:	78 0e                	js     80208d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80207f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802082:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802085:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208d:	c9                   	leave
+  80208e:	c3                   	ret
+
+0080208f <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  80208f:	55                   	push   %ebp
+  802090:	89 e5                	mov    %esp,%ebp
+  802092:	53                   	push   %ebx
+  802093:	83 ec 1c             	sub    $0x1c,%esp
+  802096:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802099:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209c:	50                   	push   %eax
+  80209d:	ff 75 08             	push   0x8(%ebp)
+  8020a0:	e8 a6 fb ff ff       	call   801c4b <fd_lookup>
+  8020a5:	83 c4 10             	add    $0x10,%esp
+  8020a8:	85 c0                	test   %eax,%eax
+  8020aa:	78 33                	js     8020df <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8020ac:	83 fb 03             	cmp    $0x3,%ebx
+  8020af:	74 28                	je     8020d9 <fcntl+0x4a>
+  8020b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b6:	83 fb 04             	cmp    $0x4,%ebx
+  8020b9:	75 24                	jne    8020df <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8020bb:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8020be:	8b 41 08             	mov    0x8(%ecx),%eax
+  8020c1:	80 e4 ef             	and    $0xef,%ah
+  8020c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020c7:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8020cd:	09 d0                	or     %edx,%eax
+  8020cf:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8020d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d7:	eb 06                	jmp    8020df <fcntl+0x50>
+		return fd->fd_omode;
+  8020d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020dc:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8020df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e2:	c9                   	leave
+  8020e3:	c3                   	ret
+
+008020e4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8020e4:	55                   	push   %ebp
+  8020e5:	89 e5                	mov    %esp,%ebp
+  8020e7:	56                   	push   %esi
+  8020e8:	53                   	push   %ebx
+  8020e9:	83 ec 18             	sub    $0x18,%esp
+  8020ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020f2:	50                   	push   %eax
+  8020f3:	53                   	push   %ebx
+  8020f4:	e8 52 fb ff ff       	call   801c4b <fd_lookup>
+  8020f9:	83 c4 10             	add    $0x10,%esp
+  8020fc:	85 c0                	test   %eax,%eax
+  8020fe:	78 34                	js     802134 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802100:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802103:	83 ec 08             	sub    $0x8,%esp
+  802106:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802109:	50                   	push   %eax
+  80210a:	ff 36                	push   (%esi)
+  80210c:	e8 8c fb ff ff       	call   801c9d <dev_lookup>
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 1c                	js     802134 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802118:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80211c:	74 1d                	je     80213b <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80211e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802121:	8b 40 18             	mov    0x18(%eax),%eax
+  802124:	85 c0                	test   %eax,%eax
+  802126:	74 51                	je     802179 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802128:	83 ec 08             	sub    $0x8,%esp
+  80212b:	ff 75 0c             	push   0xc(%ebp)
+  80212e:	56                   	push   %esi
+  80212f:	ff d0                	call   *%eax
+  802131:	83 c4 10             	add    $0x10,%esp
+}
+  802134:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802137:	5b                   	pop    %ebx
+  802138:	5e                   	pop    %esi
+  802139:	5d                   	pop    %ebp
+  80213a:	c3                   	ret
+  80213b:	89 e2                	mov    %esp,%edx
+  80213d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802142:	29 d0                	sub    %edx,%eax
+  802144:	89 c2                	mov    %eax,%edx
+  802146:	c1 ea 0f             	shr    $0xf,%edx
+  802149:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80214e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802153:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802156:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80215d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802160:	83 ec 04             	sub    $0x4,%esp
+  802163:	53                   	push   %ebx
+  802164:	50                   	push   %eax
+  802165:	68 50 4d 80 00       	push   $0x804d50
+  80216a:	e8 5b e3 ff ff       	call   8004ca <cprintf>
+		return -E_INVAL;
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802177:	eb bb                	jmp    802134 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802179:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80217e:	eb b4                	jmp    802134 <ftruncate+0x50>
+
+00802180 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	56                   	push   %esi
+  802184:	53                   	push   %ebx
+  802185:	83 ec 18             	sub    $0x18,%esp
+  802188:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80218b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80218e:	50                   	push   %eax
+  80218f:	ff 75 08             	push   0x8(%ebp)
+  802192:	e8 b4 fa ff ff       	call   801c4b <fd_lookup>
+  802197:	83 c4 10             	add    $0x10,%esp
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 53                	js     8021f1 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80219e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a7:	50                   	push   %eax
+  8021a8:	ff 36                	push   (%esi)
+  8021aa:	e8 ee fa ff ff       	call   801c9d <dev_lookup>
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	85 c0                	test   %eax,%eax
+  8021b4:	78 3b                	js     8021f1 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8021b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8021bd:	74 39                	je     8021f8 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8021bf:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8021c2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8021c9:	00 00 00 
+	stat->st_isdir = 0;
+  8021cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021d3:	00 00 00 
+	stat->st_version = 0;
+  8021d6:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8021dd:	00 00 00 
+	stat->st_dev = dev;
+  8021e0:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	53                   	push   %ebx
+  8021ea:	56                   	push   %esi
+  8021eb:	ff 50 14             	call   *0x14(%eax)
+  8021ee:	83 c4 10             	add    $0x10,%esp
+}
+  8021f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f4:	5b                   	pop    %ebx
+  8021f5:	5e                   	pop    %esi
+  8021f6:	5d                   	pop    %ebp
+  8021f7:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021f8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021fd:	eb f2                	jmp    8021f1 <fstat+0x71>
+
+008021ff <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	56                   	push   %esi
+  802203:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802204:	83 ec 08             	sub    $0x8,%esp
+  802207:	6a 00                	push   $0x0
+  802209:	ff 75 08             	push   0x8(%ebp)
+  80220c:	e8 b7 01 00 00       	call   8023c8 <open>
+  802211:	89 c3                	mov    %eax,%ebx
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 1b                	js     802235 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80221a:	83 ec 08             	sub    $0x8,%esp
+  80221d:	ff 75 0c             	push   0xc(%ebp)
+  802220:	50                   	push   %eax
+  802221:	e8 5a ff ff ff       	call   802180 <fstat>
+  802226:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802228:	89 1c 24             	mov    %ebx,(%esp)
+  80222b:	e8 60 fb ff ff       	call   801d90 <close>
+	return r;
+  802230:	83 c4 10             	add    $0x10,%esp
+  802233:	89 f3                	mov    %esi,%ebx
+}
+  802235:	89 d8                	mov    %ebx,%eax
+  802237:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80223a:	5b                   	pop    %ebx
+  80223b:	5e                   	pop    %esi
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+
+0080223e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	56                   	push   %esi
+  802242:	53                   	push   %ebx
+  802243:	89 c6                	mov    %eax,%esi
+  802245:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802247:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  80224e:	74 27                	je     802277 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802250:	6a 07                	push   $0x7
+  802252:	68 00 70 80 00       	push   $0x807000
+  802257:	56                   	push   %esi
+  802258:	ff 35 c4 66 80 00    	push   0x8066c4
+  80225e:	e8 22 22 00 00       	call   804485 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802263:	83 c4 0c             	add    $0xc,%esp
+  802266:	6a 00                	push   $0x0
+  802268:	53                   	push   %ebx
+  802269:	6a 00                	push   $0x0
+  80226b:	e8 85 1f 00 00       	call   8041f5 <ipc_recv>
+}
+  802270:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802273:	5b                   	pop    %ebx
+  802274:	5e                   	pop    %esi
+  802275:	5d                   	pop    %ebp
+  802276:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  80227a:	6a 02                	push   $0x2
+  80227c:	e8 6d 22 00 00       	call   8044ee <ipc_find_env>
+  802281:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802286:	83 c4 10             	add    $0x10,%esp
+  802289:	eb c5                	jmp    802250 <fsipc+0x12>
+
+0080228b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802291:	8b 45 08             	mov    0x8(%ebp),%eax
+  802294:	8b 40 0c             	mov    0xc(%eax),%eax
+  802297:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80229c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80229f:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022ae:	e8 8b ff ff ff       	call   80223e <fsipc>
+}
+  8022b3:	c9                   	leave
+  8022b4:	c3                   	ret
+
+008022b5 <devfile_flush>:
+{
+  8022b5:	55                   	push   %ebp
+  8022b6:	89 e5                	mov    %esp,%ebp
+  8022b8:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8022bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c1:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8022c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022cb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022d0:	e8 69 ff ff ff       	call   80223e <fsipc>
+}
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+
+008022d7 <devfile_stat>:
+{
+  8022d7:	55                   	push   %ebp
+  8022d8:	89 e5                	mov    %esp,%ebp
+  8022da:	53                   	push   %ebx
+  8022db:	83 ec 04             	sub    $0x4,%esp
+  8022de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022e7:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8022ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022f6:	e8 43 ff ff ff       	call   80223e <fsipc>
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 37                	js     802336 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022ff:	83 ec 08             	sub    $0x8,%esp
+  802302:	68 00 70 80 00       	push   $0x807000
+  802307:	53                   	push   %ebx
+  802308:	e8 b4 e8 ff ff       	call   800bc1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80230d:	a1 80 70 80 00       	mov    0x807080,%eax
+  802312:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802318:	a1 84 70 80 00       	mov    0x807084,%eax
+  80231d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802323:	a1 88 70 80 00       	mov    0x807088,%eax
+  802328:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802339:	c9                   	leave
+  80233a:	c3                   	ret
+
+0080233b <devfile_write>:
+{
+  80233b:	55                   	push   %ebp
+  80233c:	89 e5                	mov    %esp,%ebp
+  80233e:	83 ec 0c             	sub    $0xc,%esp
+  802341:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802344:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802349:	39 d0                	cmp    %edx,%eax
+  80234b:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80234e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802351:	8b 52 0c             	mov    0xc(%edx),%edx
+  802354:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80235a:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80235f:	50                   	push   %eax
+  802360:	ff 75 0c             	push   0xc(%ebp)
+  802363:	68 08 70 80 00       	push   $0x807008
+  802368:	e8 04 ea ff ff       	call   800d71 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80236d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802372:	b8 04 00 00 00       	mov    $0x4,%eax
+  802377:	e8 c2 fe ff ff       	call   80223e <fsipc>
+}
+  80237c:	c9                   	leave
+  80237d:	c3                   	ret
+
+0080237e <devfile_read>:
+{
+  80237e:	55                   	push   %ebp
+  80237f:	89 e5                	mov    %esp,%ebp
+  802381:	53                   	push   %ebx
+  802382:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802385:	8b 45 08             	mov    0x8(%ebp),%eax
+  802388:	8b 40 0c             	mov    0xc(%eax),%eax
+  80238b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802390:	8b 45 10             	mov    0x10(%ebp),%eax
+  802393:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802398:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80239d:	b8 03 00 00 00       	mov    $0x3,%eax
+  8023a2:	e8 97 fe ff ff       	call   80223e <fsipc>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	85 c0                	test   %eax,%eax
+  8023ab:	78 14                	js     8023c1 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8023ad:	83 ec 04             	sub    $0x4,%esp
+  8023b0:	50                   	push   %eax
+  8023b1:	68 00 70 80 00       	push   $0x807000
+  8023b6:	ff 75 0c             	push   0xc(%ebp)
+  8023b9:	e8 b3 e9 ff ff       	call   800d71 <memmove>
+	return r;
+  8023be:	83 c4 10             	add    $0x10,%esp
+}
+  8023c1:	89 d8                	mov    %ebx,%eax
+  8023c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c6:	c9                   	leave
+  8023c7:	c3                   	ret
+
+008023c8 <open>:
+{
+  8023c8:	55                   	push   %ebp
+  8023c9:	89 e5                	mov    %esp,%ebp
+  8023cb:	53                   	push   %ebx
+  8023cc:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8023cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023d2:	50                   	push   %eax
+  8023d3:	e8 23 f8 ff ff       	call   801bfb <fd_alloc>
+  8023d8:	89 c3                	mov    %eax,%ebx
+  8023da:	83 c4 10             	add    $0x10,%esp
+  8023dd:	85 c0                	test   %eax,%eax
+  8023df:	78 2a                	js     80240b <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8023e1:	83 ec 0c             	sub    $0xc,%esp
+  8023e4:	ff 75 08             	push   0x8(%ebp)
+  8023e7:	e8 89 e7 ff ff       	call   800b75 <strlen>
+  8023ec:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8023ef:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8023f4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8023f9:	7e 17                	jle    802412 <open+0x4a>
+	fd_close(fd, 1);
+  8023fb:	83 ec 08             	sub    $0x8,%esp
+  8023fe:	6a 01                	push   $0x1
+  802400:	ff 75 f4             	push   -0xc(%ebp)
+  802403:	e8 08 f9 ff ff       	call   801d10 <fd_close>
+	return r;
+  802408:	83 c4 10             	add    $0x10,%esp
+}
+  80240b:	89 d8                	mov    %ebx,%eax
+  80240d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802410:	c9                   	leave
+  802411:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802412:	83 ec 08             	sub    $0x8,%esp
+  802415:	ff 75 08             	push   0x8(%ebp)
+  802418:	68 00 70 80 00       	push   $0x807000
+  80241d:	e8 9f e7 ff ff       	call   800bc1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802422:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802425:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  80242a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80242d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802432:	e8 07 fe ff ff       	call   80223e <fsipc>
+  802437:	89 c3                	mov    %eax,%ebx
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	85 c0                	test   %eax,%eax
+  80243e:	78 bb                	js     8023fb <open+0x33>
+	return fd2num(fd); 	
+  802440:	83 ec 0c             	sub    $0xc,%esp
+  802443:	ff 75 f4             	push   -0xc(%ebp)
+  802446:	e8 89 f7 ff ff       	call   801bd4 <fd2num>
+  80244b:	89 c3                	mov    %eax,%ebx
+  80244d:	83 c4 10             	add    $0x10,%esp
+  802450:	eb b9                	jmp    80240b <open+0x43>
+
+00802452 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	53                   	push   %ebx
+  802456:	83 ec 1c             	sub    $0x1c,%esp
+  802459:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245f:	50                   	push   %eax
+  802460:	ff 75 08             	push   0x8(%ebp)
+  802463:	e8 e3 f7 ff ff       	call   801c4b <fd_lookup>
+  802468:	83 c4 10             	add    $0x10,%esp
+  80246b:	85 c0                	test   %eax,%eax
+  80246d:	78 5a                	js     8024c9 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  80246f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802472:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802478:	39 10                	cmp    %edx,(%eax)
+  80247a:	75 66                	jne    8024e2 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80247c:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802483:	74 49                	je     8024ce <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802488:	8b 40 0c             	mov    0xc(%eax),%eax
+  80248b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802490:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802493:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802498:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80249e:	6a 07                	push   $0x7
+  8024a0:	68 00 70 80 00       	push   $0x807000
+  8024a5:	6a 09                	push   $0x9
+  8024a7:	ff 35 c4 66 80 00    	push   0x8066c4
+  8024ad:	e8 d3 1f 00 00       	call   804485 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8024b2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8024b9:	6a 00                	push   $0x0
+  8024bb:	53                   	push   %ebx
+  8024bc:	ff 75 10             	push   0x10(%ebp)
+  8024bf:	6a 00                	push   $0x0
+  8024c1:	e8 fc 1d 00 00       	call   8042c2 <ipc_recv_pages>
+  8024c6:	83 c4 20             	add    $0x20,%esp
+}
+  8024c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ce:	83 ec 0c             	sub    $0xc,%esp
+  8024d1:	6a 02                	push   $0x2
+  8024d3:	e8 16 20 00 00       	call   8044ee <ipc_find_env>
+  8024d8:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	eb a3                	jmp    802485 <fmap+0x33>
+		return -E_INVAL;
+  8024e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e7:	eb e0                	jmp    8024c9 <fmap+0x77>
+
+008024e9 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024e9:	55                   	push   %ebp
+  8024ea:	89 e5                	mov    %esp,%ebp
+  8024ec:	53                   	push   %ebx
+  8024ed:	83 ec 10             	sub    $0x10,%esp
+  8024f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024f3:	53                   	push   %ebx
+  8024f4:	e8 7c e6 ff ff       	call   800b75 <strlen>
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802501:	7f 25                	jg     802528 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802503:	83 ec 08             	sub    $0x8,%esp
+  802506:	53                   	push   %ebx
+  802507:	68 00 70 80 00       	push   $0x807000
+  80250c:	e8 b0 e6 ff ff       	call   800bc1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802511:	ba 00 00 00 00       	mov    $0x0,%edx
+  802516:	b8 07 00 00 00       	mov    $0x7,%eax
+  80251b:	e8 1e fd ff ff       	call   80223e <fsipc>
+  802520:	83 c4 10             	add    $0x10,%esp
+}
+  802523:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802526:	c9                   	leave
+  802527:	c3                   	ret
+		return -E_BAD_PATH;
+  802528:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80252d:	eb f4                	jmp    802523 <remove+0x3a>
+
+0080252f <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80252f:	55                   	push   %ebp
+  802530:	89 e5                	mov    %esp,%ebp
+  802532:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802535:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253a:	b8 08 00 00 00       	mov    $0x8,%eax
+  80253f:	e8 fa fc ff ff       	call   80223e <fsipc>
+}
+  802544:	c9                   	leave
+  802545:	c3                   	ret
+
+00802546 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802546:	55                   	push   %ebp
+  802547:	89 e5                	mov    %esp,%ebp
+  802549:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80254c:	68 c0 4d 80 00       	push   $0x804dc0
+  802551:	ff 75 0c             	push   0xc(%ebp)
+  802554:	e8 68 e6 ff ff       	call   800bc1 <strcpy>
+	return 0;
+}
+  802559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+
+00802560 <devsock_close>:
+{
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	53                   	push   %ebx
+  802564:	83 ec 10             	sub    $0x10,%esp
+  802567:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80256a:	53                   	push   %ebx
+  80256b:	e8 bd 1f 00 00       	call   80452d <pageref>
+  802570:	89 c2                	mov    %eax,%edx
+  802572:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802575:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80257a:	83 fa 01             	cmp    $0x1,%edx
+  80257d:	74 05                	je     802584 <devsock_close+0x24>
+}
+  80257f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802582:	c9                   	leave
+  802583:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802584:	83 ec 0c             	sub    $0xc,%esp
+  802587:	ff 73 0c             	push   0xc(%ebx)
+  80258a:	e8 b0 05 00 00       	call   802b3f <nsipc_close>
+  80258f:	83 c4 10             	add    $0x10,%esp
+  802592:	eb eb                	jmp    80257f <devsock_close+0x1f>
+
+00802594 <devsock_write>:
+{
+  802594:	55                   	push   %ebp
+  802595:	89 e5                	mov    %esp,%ebp
+  802597:	53                   	push   %ebx
+  802598:	83 ec 14             	sub    $0x14,%esp
+  80259b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80259e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8025a4:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8025a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8025aa:	8b 41 08             	mov    0x8(%ecx),%eax
+  8025ad:	c1 f8 09             	sar    $0x9,%eax
+  8025b0:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8025b3:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8025b9:	77 13                	ja     8025ce <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8025bb:	50                   	push   %eax
+  8025bc:	52                   	push   %edx
+  8025bd:	53                   	push   %ebx
+  8025be:	ff 71 0c             	push   0xc(%ecx)
+  8025c1:	e8 5c 06 00 00       	call   802c22 <nsipc_send>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+}
+  8025c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cc:	c9                   	leave
+  8025cd:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8025ce:	50                   	push   %eax
+  8025cf:	6a 01                	push   $0x1
+  8025d1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025d4:	50                   	push   %eax
+  8025d5:	ff 71 0c             	push   0xc(%ecx)
+  8025d8:	e8 a6 06 00 00       	call   802c83 <nsipc_sendmsg>
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	eb e7                	jmp    8025c9 <devsock_write+0x35>
+
+008025e2 <devsock_read>:
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	53                   	push   %ebx
+  8025e6:	83 ec 14             	sub    $0x14,%esp
+  8025e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025ef:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8025f2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8025f5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8025f8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8025fb:	c1 f8 09             	sar    $0x9,%eax
+  8025fe:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802601:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802607:	77 13                	ja     80261c <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802609:	50                   	push   %eax
+  80260a:	52                   	push   %edx
+  80260b:	53                   	push   %ebx
+  80260c:	ff 71 0c             	push   0xc(%ecx)
+  80260f:	e8 9c 05 00 00       	call   802bb0 <nsipc_recv>
+  802614:	83 c4 10             	add    $0x10,%esp
+}
+  802617:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80261a:	c9                   	leave
+  80261b:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80261c:	50                   	push   %eax
+  80261d:	6a 01                	push   $0x1
+  80261f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802622:	50                   	push   %eax
+  802623:	ff 71 0c             	push   0xc(%ecx)
+  802626:	e8 02 0a 00 00       	call   80302d <nsipc_recvmsg>
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	eb e7                	jmp    802617 <devsock_read+0x35>
+
+00802630 <fd2sockid>:
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802636:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802639:	52                   	push   %edx
+  80263a:	50                   	push   %eax
+  80263b:	e8 0b f6 ff ff       	call   801c4b <fd_lookup>
+  802640:	83 c4 10             	add    $0x10,%esp
+  802643:	85 c0                	test   %eax,%eax
+  802645:	78 10                	js     802657 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802647:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80264a:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802650:	39 08                	cmp    %ecx,(%eax)
+  802652:	75 05                	jne    802659 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802654:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+		return -E_NOT_SUPP;
+  802659:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80265e:	eb f7                	jmp    802657 <fd2sockid+0x27>
+
+00802660 <sock_flags>:
+{
+  802660:	55                   	push   %ebp
+  802661:	89 e5                	mov    %esp,%ebp
+  802663:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802666:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802669:	52                   	push   %edx
+  80266a:	50                   	push   %eax
+  80266b:	e8 db f5 ff ff       	call   801c4b <fd_lookup>
+  802670:	83 c4 10             	add    $0x10,%esp
+  802673:	85 c0                	test   %eax,%eax
+  802675:	78 0e                	js     802685 <sock_flags+0x25>
+  802677:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267a:	8b 40 08             	mov    0x8(%eax),%eax
+  80267d:	c1 e8 09             	shr    $0x9,%eax
+  802680:	83 e0 08             	and    $0x8,%eax
+}
+  802683:	c9                   	leave
+  802684:	c3                   	ret
+		return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268a:	eb f7                	jmp    802683 <sock_flags+0x23>
+
+0080268c <alloc_sockfd>:
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	56                   	push   %esi
+  802690:	53                   	push   %ebx
+  802691:	83 ec 1c             	sub    $0x1c,%esp
+  802694:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802696:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802699:	50                   	push   %eax
+  80269a:	e8 5c f5 ff ff       	call   801bfb <fd_alloc>
+  80269f:	89 c3                	mov    %eax,%ebx
+  8026a1:	83 c4 10             	add    $0x10,%esp
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	78 43                	js     8026eb <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026a8:	83 ec 04             	sub    $0x4,%esp
+  8026ab:	68 07 04 00 00       	push   $0x407
+  8026b0:	ff 75 f4             	push   -0xc(%ebp)
+  8026b3:	6a 00                	push   $0x0
+  8026b5:	e8 3b e9 ff ff       	call   800ff5 <sys_page_alloc>
+  8026ba:	89 c3                	mov    %eax,%ebx
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	78 28                	js     8026eb <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8026c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c6:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  8026cc:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8026ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8026d8:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	50                   	push   %eax
+  8026df:	e8 f0 f4 ff ff       	call   801bd4 <fd2num>
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	83 c4 10             	add    $0x10,%esp
+  8026e9:	eb 0c                	jmp    8026f7 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8026eb:	83 ec 0c             	sub    $0xc,%esp
+  8026ee:	56                   	push   %esi
+  8026ef:	e8 4b 04 00 00       	call   802b3f <nsipc_close>
+		return r;
+  8026f4:	83 c4 10             	add    $0x10,%esp
+}
+  8026f7:	89 d8                	mov    %ebx,%eax
+  8026f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fc:	5b                   	pop    %ebx
+  8026fd:	5e                   	pop    %esi
+  8026fe:	5d                   	pop    %ebp
+  8026ff:	c3                   	ret
+
+00802700 <accept>:
+{
+  802700:	55                   	push   %ebp
+  802701:	89 e5                	mov    %esp,%ebp
+  802703:	56                   	push   %esi
+  802704:	53                   	push   %ebx
+  802705:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802708:	89 f0                	mov    %esi,%eax
+  80270a:	e8 21 ff ff ff       	call   802630 <fd2sockid>
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	85 c0                	test   %eax,%eax
+  802713:	78 24                	js     802739 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802715:	89 f0                	mov    %esi,%eax
+  802717:	e8 44 ff ff ff       	call   802660 <sock_flags>
+  80271c:	50                   	push   %eax
+  80271d:	ff 75 10             	push   0x10(%ebp)
+  802720:	ff 75 0c             	push   0xc(%ebp)
+  802723:	53                   	push   %ebx
+  802724:	e8 6b 03 00 00       	call   802a94 <nsipc_accept>
+  802729:	89 c3                	mov    %eax,%ebx
+  80272b:	83 c4 10             	add    $0x10,%esp
+  80272e:	85 c0                	test   %eax,%eax
+  802730:	78 07                	js     802739 <accept+0x39>
+	return alloc_sockfd(r);
+  802732:	e8 55 ff ff ff       	call   80268c <alloc_sockfd>
+  802737:	89 c3                	mov    %eax,%ebx
+}
+  802739:	89 d8                	mov    %ebx,%eax
+  80273b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80273e:	5b                   	pop    %ebx
+  80273f:	5e                   	pop    %esi
+  802740:	5d                   	pop    %ebp
+  802741:	c3                   	ret
+
+00802742 <bind>:
+{
+  802742:	55                   	push   %ebp
+  802743:	89 e5                	mov    %esp,%ebp
+  802745:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802748:	8b 45 08             	mov    0x8(%ebp),%eax
+  80274b:	e8 e0 fe ff ff       	call   802630 <fd2sockid>
+  802750:	85 c0                	test   %eax,%eax
+  802752:	78 12                	js     802766 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802754:	83 ec 04             	sub    $0x4,%esp
+  802757:	ff 75 10             	push   0x10(%ebp)
+  80275a:	ff 75 0c             	push   0xc(%ebp)
+  80275d:	50                   	push   %eax
+  80275e:	e8 85 03 00 00       	call   802ae8 <nsipc_bind>
+  802763:	83 c4 10             	add    $0x10,%esp
+}
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+
+00802768 <shutdown>:
+{
+  802768:	55                   	push   %ebp
+  802769:	89 e5                	mov    %esp,%ebp
+  80276b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80276e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802771:	e8 ba fe ff ff       	call   802630 <fd2sockid>
+  802776:	85 c0                	test   %eax,%eax
+  802778:	78 0f                	js     802789 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80277a:	83 ec 08             	sub    $0x8,%esp
+  80277d:	ff 75 0c             	push   0xc(%ebp)
+  802780:	50                   	push   %eax
+  802781:	e8 97 03 00 00       	call   802b1d <nsipc_shutdown>
+  802786:	83 c4 10             	add    $0x10,%esp
+}
+  802789:	c9                   	leave
+  80278a:	c3                   	ret
+
+0080278b <connect>:
+{
+  80278b:	55                   	push   %ebp
+  80278c:	89 e5                	mov    %esp,%ebp
+  80278e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802791:	8b 45 08             	mov    0x8(%ebp),%eax
+  802794:	e8 97 fe ff ff       	call   802630 <fd2sockid>
+  802799:	85 c0                	test   %eax,%eax
+  80279b:	78 12                	js     8027af <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80279d:	83 ec 04             	sub    $0x4,%esp
+  8027a0:	ff 75 10             	push   0x10(%ebp)
+  8027a3:	ff 75 0c             	push   0xc(%ebp)
+  8027a6:	50                   	push   %eax
+  8027a7:	e8 ad 03 00 00       	call   802b59 <nsipc_connect>
+  8027ac:	83 c4 10             	add    $0x10,%esp
+}
+  8027af:	c9                   	leave
+  8027b0:	c3                   	ret
+
+008027b1 <listen>:
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ba:	e8 71 fe ff ff       	call   802630 <fd2sockid>
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	78 0f                	js     8027d2 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027c3:	83 ec 08             	sub    $0x8,%esp
+  8027c6:	ff 75 0c             	push   0xc(%ebp)
+  8027c9:	50                   	push   %eax
+  8027ca:	e8 bf 03 00 00       	call   802b8e <nsipc_listen>
+  8027cf:	83 c4 10             	add    $0x10,%esp
+}
+  8027d2:	c9                   	leave
+  8027d3:	c3                   	ret
+
+008027d4 <sendmsg>:
+{
+  8027d4:	55                   	push   %ebp
+  8027d5:	89 e5                	mov    %esp,%ebp
+  8027d7:	57                   	push   %edi
+  8027d8:	56                   	push   %esi
+  8027d9:	53                   	push   %ebx
+  8027da:	83 ec 0c             	sub    $0xc,%esp
+  8027dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8027e3:	89 f0                	mov    %esi,%eax
+  8027e5:	e8 46 fe ff ff       	call   802630 <fd2sockid>
+  8027ea:	89 c3                	mov    %eax,%ebx
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	78 1c                	js     80280c <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8027f0:	89 f0                	mov    %esi,%eax
+  8027f2:	e8 69 fe ff ff       	call   802660 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8027f7:	0b 45 10             	or     0x10(%ebp),%eax
+  8027fa:	50                   	push   %eax
+  8027fb:	ff 77 0c             	push   0xc(%edi)
+  8027fe:	ff 77 08             	push   0x8(%edi)
+  802801:	53                   	push   %ebx
+  802802:	e8 7c 04 00 00       	call   802c83 <nsipc_sendmsg>
+  802807:	89 c3                	mov    %eax,%ebx
+  802809:	83 c4 10             	add    $0x10,%esp
+}
+  80280c:	89 d8                	mov    %ebx,%eax
+  80280e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802811:	5b                   	pop    %ebx
+  802812:	5e                   	pop    %esi
+  802813:	5f                   	pop    %edi
+  802814:	5d                   	pop    %ebp
+  802815:	c3                   	ret
+
+00802816 <recvmsg>:
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	57                   	push   %edi
+  80281a:	56                   	push   %esi
+  80281b:	53                   	push   %ebx
+  80281c:	83 ec 0c             	sub    $0xc,%esp
+  80281f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802822:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802825:	89 f8                	mov    %edi,%eax
+  802827:	e8 04 fe ff ff       	call   802630 <fd2sockid>
+  80282c:	89 c3                	mov    %eax,%ebx
+  80282e:	85 c0                	test   %eax,%eax
+  802830:	78 2a                	js     80285c <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802832:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802839:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802840:	89 f8                	mov    %edi,%eax
+  802842:	e8 19 fe ff ff       	call   802660 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802847:	0b 45 10             	or     0x10(%ebp),%eax
+  80284a:	50                   	push   %eax
+  80284b:	ff 76 0c             	push   0xc(%esi)
+  80284e:	ff 76 08             	push   0x8(%esi)
+  802851:	53                   	push   %ebx
+  802852:	e8 d6 07 00 00       	call   80302d <nsipc_recvmsg>
+  802857:	89 c3                	mov    %eax,%ebx
+  802859:	83 c4 10             	add    $0x10,%esp
+}
+  80285c:	89 d8                	mov    %ebx,%eax
+  80285e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802861:	5b                   	pop    %ebx
+  802862:	5e                   	pop    %esi
+  802863:	5f                   	pop    %edi
+  802864:	5d                   	pop    %ebp
+  802865:	c3                   	ret
+
+00802866 <sendfile>:
+{
+  802866:	55                   	push   %ebp
+  802867:	89 e5                	mov    %esp,%ebp
+  802869:	56                   	push   %esi
+  80286a:	53                   	push   %ebx
+  80286b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80286e:	89 f0                	mov    %esi,%eax
+  802870:	e8 bb fd ff ff       	call   802630 <fd2sockid>
+  802875:	89 c3                	mov    %eax,%ebx
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 1f                	js     80289a <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80287b:	89 f0                	mov    %esi,%eax
+  80287d:	e8 de fd ff ff       	call   802660 <sock_flags>
+  802882:	83 ec 0c             	sub    $0xc,%esp
+  802885:	50                   	push   %eax
+  802886:	ff 75 14             	push   0x14(%ebp)
+  802889:	ff 75 10             	push   0x10(%ebp)
+  80288c:	ff 75 0c             	push   0xc(%ebp)
+  80288f:	53                   	push   %ebx
+  802890:	e8 64 06 00 00       	call   802ef9 <nsipc_sendfile>
+  802895:	89 c3                	mov    %eax,%ebx
+  802897:	83 c4 20             	add    $0x20,%esp
+}
+  80289a:	89 d8                	mov    %ebx,%eax
+  80289c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80289f:	5b                   	pop    %ebx
+  8028a0:	5e                   	pop    %esi
+  8028a1:	5d                   	pop    %ebp
+  8028a2:	c3                   	ret
+
+008028a3 <evctl>:
+{
+  8028a3:	55                   	push   %ebp
+  8028a4:	89 e5                	mov    %esp,%ebp
+  8028a6:	53                   	push   %ebx
+  8028a7:	83 ec 04             	sub    $0x4,%esp
+  8028aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8028ad:	89 d8                	mov    %ebx,%eax
+  8028af:	e8 7c fd ff ff       	call   802630 <fd2sockid>
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 10                	js     8028c8 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8028b8:	83 ec 04             	sub    $0x4,%esp
+  8028bb:	53                   	push   %ebx
+  8028bc:	ff 75 0c             	push   0xc(%ebp)
+  8028bf:	50                   	push   %eax
+  8028c0:	e8 d2 0b 00 00       	call   803497 <nsipc_evctl>
+  8028c5:	83 c4 10             	add    $0x10,%esp
+}
+  8028c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028cb:	c9                   	leave
+  8028cc:	c3                   	ret
+
+008028cd <evwait>:
+{
+  8028cd:	55                   	push   %ebp
+  8028ce:	89 e5                	mov    %esp,%ebp
+  8028d0:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8028d3:	ff 75 10             	push   0x10(%ebp)
+  8028d6:	ff 75 0c             	push   0xc(%ebp)
+  8028d9:	ff 75 08             	push   0x8(%ebp)
+  8028dc:	e8 e0 0b 00 00       	call   8034c1 <nsipc_evwait>
+}
+  8028e1:	c9                   	leave
+  8028e2:	c3                   	ret
+
+008028e3 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028e3:	55                   	push   %ebp
+  8028e4:	89 e5                	mov    %esp,%ebp
+  8028e6:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028e9:	ff 75 10             	push   0x10(%ebp)
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	ff 75 08             	push   0x8(%ebp)
+  8028f2:	e8 31 0c 00 00       	call   803528 <nsipc_socket>
+  8028f7:	83 c4 10             	add    $0x10,%esp
+  8028fa:	85 c0                	test   %eax,%eax
+  8028fc:	78 05                	js     802903 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028fe:	e8 89 fd ff ff       	call   80268c <alloc_sockfd>
+}
+  802903:	c9                   	leave
+  802904:	c3                   	ret
+
+00802905 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802905:	55                   	push   %ebp
+  802906:	89 e5                	mov    %esp,%ebp
+  802908:	53                   	push   %ebx
+  802909:	83 ec 04             	sub    $0x4,%esp
+  80290c:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80290e:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802915:	74 26                	je     80293d <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802917:	6a 07                	push   $0x7
+  802919:	68 00 80 80 00       	push   $0x808000
+  80291e:	53                   	push   %ebx
+  80291f:	ff 35 e4 69 80 00    	push   0x8069e4
+  802925:	e8 5b 1b 00 00       	call   804485 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80292a:	83 c4 0c             	add    $0xc,%esp
+  80292d:	6a 00                	push   $0x0
+  80292f:	6a 00                	push   $0x0
+  802931:	6a 00                	push   $0x0
+  802933:	e8 bd 18 00 00       	call   8041f5 <ipc_recv>
+}
+  802938:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80293d:	83 ec 0c             	sub    $0xc,%esp
+  802940:	6a 03                	push   $0x3
+  802942:	e8 a7 1b 00 00       	call   8044ee <ipc_find_env>
+  802947:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	eb c6                	jmp    802917 <nsipc+0x12>
+
+00802951 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802951:	55                   	push   %ebp
+  802952:	89 e5                	mov    %esp,%ebp
+  802954:	56                   	push   %esi
+  802955:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802956:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  80295c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802961:	85 f6                	test   %esi,%esi
+  802963:	75 33                	jne    802998 <nsbulk_map+0x47>
+  802965:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80296a:	83 ec 04             	sub    $0x4,%esp
+  80296d:	6a 07                	push   $0x7
+  80296f:	53                   	push   %ebx
+  802970:	6a 00                	push   $0x0
+  802972:	e8 7e e6 ff ff       	call   800ff5 <sys_page_alloc>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 1a                	js     802998 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80297e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802984:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80298a:	75 de                	jne    80296a <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80298c:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802993:	00 00 00 
+	return 0;
+  802996:	89 f0                	mov    %esi,%eax
+}
+  802998:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80299b:	5b                   	pop    %ebx
+  80299c:	5e                   	pop    %esi
+  80299d:	5d                   	pop    %ebp
+  80299e:	c3                   	ret
+
+0080299f <nsbulk_own>:
+{
+  80299f:	55                   	push   %ebp
+  8029a0:	89 e5                	mov    %esp,%ebp
+  8029a2:	57                   	push   %edi
+  8029a3:	56                   	push   %esi
+  8029a4:	53                   	push   %ebx
+  8029a5:	83 ec 0c             	sub    $0xc,%esp
+  8029a8:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8029aa:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8029ad:	85 d2                	test   %edx,%edx
+  8029af:	7f 0e                	jg     8029bf <nsbulk_own+0x20>
+	return 0;
+  8029b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b6:	eb 47                	jmp    8029ff <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8029b8:	83 c3 01             	add    $0x1,%ebx
+  8029bb:	39 fb                	cmp    %edi,%ebx
+  8029bd:	7d 3b                	jge    8029fa <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8029bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8029c4:	89 d9                	mov    %ebx,%ecx
+  8029c6:	d3 e6                	shl    %cl,%esi
+  8029c8:	89 f0                	mov    %esi,%eax
+  8029ca:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  8029d0:	74 e6                	je     8029b8 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8029d2:	83 ec 04             	sub    $0x4,%esp
+  8029d5:	6a 07                	push   $0x7
+  8029d7:	89 d8                	mov    %ebx,%eax
+  8029d9:	c1 e0 0c             	shl    $0xc,%eax
+  8029dc:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8029e1:	50                   	push   %eax
+  8029e2:	6a 00                	push   $0x0
+  8029e4:	e8 0c e6 ff ff       	call   800ff5 <sys_page_alloc>
+  8029e9:	83 c4 10             	add    $0x10,%esp
+  8029ec:	85 c0                	test   %eax,%eax
+  8029ee:	78 0f                	js     8029ff <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8029f0:	f7 d6                	not    %esi
+  8029f2:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  8029f8:	eb be                	jmp    8029b8 <nsbulk_own+0x19>
+	return 0;
+  8029fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+
+00802a07 <nsipc_bulk>:
+{
+  802a07:	55                   	push   %ebp
+  802a08:	89 e5                	mov    %esp,%ebp
+  802a0a:	57                   	push   %edi
+  802a0b:	56                   	push   %esi
+  802a0c:	53                   	push   %ebx
+  802a0d:	83 ec 1c             	sub    $0x1c,%esp
+  802a10:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a13:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802a15:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802a1b:	c1 fb 0c             	sar    $0xc,%ebx
+  802a1e:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802a21:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802a28:	74 56                	je     802a80 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a2a:	85 ff                	test   %edi,%edi
+  802a2c:	7e 24                	jle    802a52 <nsipc_bulk+0x4b>
+  802a2e:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802a34:	74 1c                	je     802a52 <nsipc_bulk+0x4b>
+  802a36:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802a3c:	c1 e3 0c             	shl    $0xc,%ebx
+  802a3f:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802a44:	0f b6 10             	movzbl (%eax),%edx
+  802a47:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a49:	05 00 10 00 00       	add    $0x1000,%eax
+  802a4e:	39 d8                	cmp    %ebx,%eax
+  802a50:	75 f2                	jne    802a44 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802a52:	83 ec 0c             	sub    $0xc,%esp
+  802a55:	56                   	push   %esi
+  802a56:	57                   	push   %edi
+  802a57:	68 00 00 00 e0       	push   $0xe0000000
+  802a5c:	ff 75 e4             	push   -0x1c(%ebp)
+  802a5f:	ff 35 e4 69 80 00    	push   0x8069e4
+  802a65:	e8 4f 1a 00 00       	call   8044b9 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802a6a:	83 c4 1c             	add    $0x1c,%esp
+  802a6d:	6a 00                	push   $0x0
+  802a6f:	6a 00                	push   $0x0
+  802a71:	6a 00                	push   $0x0
+  802a73:	e8 7d 17 00 00       	call   8041f5 <ipc_recv>
+}
+  802a78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a7b:	5b                   	pop    %ebx
+  802a7c:	5e                   	pop    %esi
+  802a7d:	5f                   	pop    %edi
+  802a7e:	5d                   	pop    %ebp
+  802a7f:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a80:	83 ec 0c             	sub    $0xc,%esp
+  802a83:	6a 03                	push   $0x3
+  802a85:	e8 64 1a 00 00       	call   8044ee <ipc_find_env>
+  802a8a:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802a8f:	83 c4 10             	add    $0x10,%esp
+  802a92:	eb 96                	jmp    802a2a <nsipc_bulk+0x23>
+
+00802a94 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802a94:	55                   	push   %ebp
+  802a95:	89 e5                	mov    %esp,%ebp
+  802a97:	53                   	push   %ebx
+  802a98:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a9e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802aa3:	8b 45 14             	mov    0x14(%ebp),%eax
+  802aa6:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802aab:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ab0:	e8 50 fe ff ff       	call   802905 <nsipc>
+  802ab5:	89 c3                	mov    %eax,%ebx
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	79 07                	jns    802ac2 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802abb:	89 d8                	mov    %ebx,%eax
+  802abd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802ac2:	83 ec 04             	sub    $0x4,%esp
+  802ac5:	ff 35 10 80 80 00    	push   0x808010
+  802acb:	68 00 80 80 00       	push   $0x808000
+  802ad0:	ff 75 0c             	push   0xc(%ebp)
+  802ad3:	e8 99 e2 ff ff       	call   800d71 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802ad8:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802ade:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ae1:	89 10                	mov    %edx,(%eax)
+  802ae3:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ae6:	eb d3                	jmp    802abb <nsipc_accept+0x27>
+
+00802ae8 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	53                   	push   %ebx
+  802aec:	83 ec 08             	sub    $0x8,%esp
+  802aef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802af5:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802afa:	53                   	push   %ebx
+  802afb:	ff 75 0c             	push   0xc(%ebp)
+  802afe:	68 04 80 80 00       	push   $0x808004
+  802b03:	e8 69 e2 ff ff       	call   800d71 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802b08:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802b0e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802b13:	e8 ed fd ff ff       	call   802905 <nsipc>
+}
+  802b18:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802b23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b26:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802b2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2e:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802b33:	b8 03 00 00 00       	mov    $0x3,%eax
+  802b38:	e8 c8 fd ff ff       	call   802905 <nsipc>
+}
+  802b3d:	c9                   	leave
+  802b3e:	c3                   	ret
+
+00802b3f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b3f:	55                   	push   %ebp
+  802b40:	89 e5                	mov    %esp,%ebp
+  802b42:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b48:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802b4d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b52:	e8 ae fd ff ff       	call   802905 <nsipc>
+}
+  802b57:	c9                   	leave
+  802b58:	c3                   	ret
+
+00802b59 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b59:	55                   	push   %ebp
+  802b5a:	89 e5                	mov    %esp,%ebp
+  802b5c:	53                   	push   %ebx
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+  802b60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b63:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b66:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b6b:	53                   	push   %ebx
+  802b6c:	ff 75 0c             	push   0xc(%ebp)
+  802b6f:	68 04 80 80 00       	push   $0x808004
+  802b74:	e8 f8 e1 ff ff       	call   800d71 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b79:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802b7f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b84:	e8 7c fd ff ff       	call   802905 <nsipc>
+}
+  802b89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b8c:	c9                   	leave
+  802b8d:	c3                   	ret
+
+00802b8e <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b8e:	55                   	push   %ebp
+  802b8f:	89 e5                	mov    %esp,%ebp
+  802b91:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b94:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b97:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b9f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802ba4:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ba9:	e8 57 fd ff ff       	call   802905 <nsipc>
+}
+  802bae:	c9                   	leave
+  802baf:	c3                   	ret
+
+00802bb0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802bb0:	55                   	push   %ebp
+  802bb1:	89 e5                	mov    %esp,%ebp
+  802bb3:	56                   	push   %esi
+  802bb4:	53                   	push   %ebx
+  802bb5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802bb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bbb:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802bc0:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802bc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802bc9:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802bce:	b8 07 00 00 00       	mov    $0x7,%eax
+  802bd3:	e8 2d fd ff ff       	call   802905 <nsipc>
+  802bd8:	89 c3                	mov    %eax,%ebx
+  802bda:	85 c0                	test   %eax,%eax
+  802bdc:	78 22                	js     802c00 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802bde:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802be3:	39 c6                	cmp    %eax,%esi
+  802be5:	0f 4e c6             	cmovle %esi,%eax
+  802be8:	39 c3                	cmp    %eax,%ebx
+  802bea:	7f 1d                	jg     802c09 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802bec:	83 ec 04             	sub    $0x4,%esp
+  802bef:	53                   	push   %ebx
+  802bf0:	68 00 80 80 00       	push   $0x808000
+  802bf5:	ff 75 0c             	push   0xc(%ebp)
+  802bf8:	e8 74 e1 ff ff       	call   800d71 <memmove>
+  802bfd:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802c00:	89 d8                	mov    %ebx,%eax
+  802c02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c05:	5b                   	pop    %ebx
+  802c06:	5e                   	pop    %esi
+  802c07:	5d                   	pop    %ebp
+  802c08:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802c09:	68 cc 4d 80 00       	push   $0x804dcc
+  802c0e:	68 e1 4d 80 00       	push   $0x804de1
+  802c13:	68 b2 00 00 00       	push   $0xb2
+  802c18:	68 f6 4d 80 00       	push   $0x804df6
+  802c1d:	e8 cd d7 ff ff       	call   8003ef <_panic>
+
+00802c22 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802c22:	55                   	push   %ebp
+  802c23:	89 e5                	mov    %esp,%ebp
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 04             	sub    $0x4,%esp
+  802c29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c2f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802c34:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802c3a:	7f 2e                	jg     802c6a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802c3c:	83 ec 04             	sub    $0x4,%esp
+  802c3f:	53                   	push   %ebx
+  802c40:	ff 75 0c             	push   0xc(%ebp)
+  802c43:	68 0c 80 80 00       	push   $0x80800c
+  802c48:	e8 24 e1 ff ff       	call   800d71 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c4d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802c53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c56:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802c5b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c60:	e8 a0 fc ff ff       	call   802905 <nsipc>
+}
+  802c65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+	assert(size < 1600);
+  802c6a:	68 02 4e 80 00       	push   $0x804e02
+  802c6f:	68 e1 4d 80 00       	push   $0x804de1
+  802c74:	68 bd 00 00 00       	push   $0xbd
+  802c79:	68 f6 4d 80 00       	push   $0x804df6
+  802c7e:	e8 6c d7 ff ff       	call   8003ef <_panic>
+
+00802c83 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802c83:	55                   	push   %ebp
+  802c84:	89 e5                	mov    %esp,%ebp
+  802c86:	57                   	push   %edi
+  802c87:	56                   	push   %esi
+  802c88:	53                   	push   %ebx
+  802c89:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802c8c:	e8 c0 fc ff ff       	call   802951 <nsbulk_map>
+  802c91:	85 c0                	test   %eax,%eax
+  802c93:	78 55                	js     802cea <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802c95:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802c9c:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802ca3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802caa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802cad:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802cb0:	0f 8d 24 02 00 00    	jge    802eda <nsipc_sendmsg+0x257>
+  802cb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cb9:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802cbc:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802cbf:	89 d8                	mov    %ebx,%eax
+  802cc1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802cc6:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802cc8:	83 ec 0c             	sub    $0xc,%esp
+  802ccb:	68 e0 66 80 00       	push   $0x8066e0
+  802cd0:	e8 bc 0f 00 00       	call   803c91 <pgbatch_init>
+  802cd5:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802cd8:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802cda:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802cdd:	e9 82 00 00 00       	jmp    802d64 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802ce2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ce5:	85 db                	test   %ebx,%ebx
+  802ce7:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802cea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ced:	5b                   	pop    %ebx
+  802cee:	5e                   	pop    %esi
+  802cef:	5f                   	pop    %edi
+  802cf0:	5d                   	pop    %ebp
+  802cf1:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802cf2:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802cf7:	29 c8                	sub    %ecx,%eax
+  802cf9:	39 d0                	cmp    %edx,%eax
+  802cfb:	0f 46 d0             	cmovbe %eax,%edx
+  802cfe:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802d00:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d06:	85 ff                	test   %edi,%edi
+  802d08:	0f 49 c7             	cmovns %edi,%eax
+  802d0b:	c1 f8 0c             	sar    $0xc,%eax
+  802d0e:	ba 01 00 00 00       	mov    $0x1,%edx
+  802d13:	e8 87 fc ff ff       	call   80299f <nsbulk_own>
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	0f 88 17 01 00 00    	js     802e37 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802d20:	83 ec 04             	sub    $0x4,%esp
+  802d23:	56                   	push   %esi
+  802d24:	ff 75 e0             	push   -0x20(%ebp)
+  802d27:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d2a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d2f:	50                   	push   %eax
+  802d30:	e8 3c e0 ff ff       	call   800d71 <memmove>
+  802d35:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802d38:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802d3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d3e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d41:	0f 84 fd 00 00 00    	je     802e44 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802d47:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d4a:	01 f7                	add    %esi,%edi
+  802d4c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d4f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d52:	0f 8d 01 01 00 00    	jge    802e59 <nsipc_sendmsg+0x1d6>
+  802d58:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802d5e:	0f 8f f0 00 00 00    	jg     802e54 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d67:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802d6a:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802d6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d70:	89 c2                	mov    %eax,%edx
+  802d72:	03 13                	add    (%ebx),%edx
+  802d74:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d77:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d7a:	29 c6                	sub    %eax,%esi
+  802d7c:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802d81:	29 f9                	sub    %edi,%ecx
+  802d83:	39 ce                	cmp    %ecx,%esi
+  802d85:	89 ca                	mov    %ecx,%edx
+  802d87:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802d8a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802d8d:	89 f9                	mov    %edi,%ecx
+  802d8f:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802d95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d98:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d9d:	09 c8                	or     %ecx,%eax
+  802d9f:	0f 85 4d ff ff ff    	jne    802cf2 <nsipc_sendmsg+0x6f>
+  802da5:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802dab:	0f 86 41 ff ff ff    	jbe    802cf2 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802db1:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802db7:	85 ff                	test   %edi,%edi
+  802db9:	0f 49 c7             	cmovns %edi,%eax
+  802dbc:	c1 f8 0c             	sar    $0xc,%eax
+  802dbf:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802dc1:	89 d1                	mov    %edx,%ecx
+  802dc3:	c1 e9 0c             	shr    $0xc,%ecx
+  802dc6:	01 c8                	add    %ecx,%eax
+  802dc8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802dcb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802dce:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802dd0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802dd3:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802dd8:	29 c8                	sub    %ecx,%eax
+  802dda:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802ddd:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802de0:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802de2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802de7:	89 f9                	mov    %edi,%ecx
+  802de9:	d3 e0                	shl    %cl,%eax
+  802deb:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802df1:	83 ec 08             	sub    $0x8,%esp
+  802df4:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802df6:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802df9:	50                   	push   %eax
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	56                   	push   %esi
+  802dfd:	6a 00                	push   $0x0
+  802dff:	68 e0 66 80 00       	push   $0x8066e0
+  802e04:	e8 46 0f 00 00       	call   803d4f <pgbatch_map>
+  802e09:	83 c4 20             	add    $0x20,%esp
+  802e0c:	85 c0                	test   %eax,%eax
+  802e0e:	0f 88 ce fe ff ff    	js     802ce2 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802e14:	83 c7 01             	add    $0x1,%edi
+  802e17:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e1d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e20:	39 c7                	cmp    %eax,%edi
+  802e22:	75 be                	jne    802de2 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802e24:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802e27:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802e2a:	89 d6                	mov    %edx,%esi
+  802e2c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802e32:	e9 01 ff ff ff       	jmp    802d38 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802e37:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e3a:	85 db                	test   %ebx,%ebx
+  802e3c:	0f 45 c3             	cmovne %ebx,%eax
+  802e3f:	e9 a6 fe ff ff       	jmp    802cea <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802e44:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802e48:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e4f:	e9 f3 fe ff ff       	jmp    802d47 <nsipc_sendmsg+0xc4>
+  802e54:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802e57:	eb 03                	jmp    802e5c <nsipc_sendmsg+0x1d9>
+  802e59:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e5c:	83 ec 0c             	sub    $0xc,%esp
+  802e5f:	68 e0 66 80 00       	push   $0x8066e0
+  802e64:	e8 36 0e 00 00       	call   803c9f <pgbatch_flush>
+  802e69:	83 c4 10             	add    $0x10,%esp
+  802e6c:	85 c0                	test   %eax,%eax
+  802e6e:	78 50                	js     802ec0 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e73:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802e78:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802e7e:	89 fb                	mov    %edi,%ebx
+  802e80:	29 f3                	sub    %esi,%ebx
+  802e82:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802e88:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e8b:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802e90:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e95:	89 fa                	mov    %edi,%edx
+  802e97:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802e9c:	e8 66 fb ff ff       	call   802a07 <nsipc_bulk>
+  802ea1:	85 c0                	test   %eax,%eax
+  802ea3:	78 28                	js     802ecd <nsipc_sendmsg+0x24a>
+		sent += r;
+  802ea5:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802ea8:	39 c3                	cmp    %eax,%ebx
+  802eaa:	75 0c                	jne    802eb8 <nsipc_sendmsg+0x235>
+  802eac:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802eaf:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802eb2:	0f 8f f2 fd ff ff    	jg     802caa <nsipc_sendmsg+0x27>
+		sent += r;
+  802eb8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802ebb:	e9 2a fe ff ff       	jmp    802cea <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802ec0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ec3:	85 db                	test   %ebx,%ebx
+  802ec5:	0f 45 c3             	cmovne %ebx,%eax
+  802ec8:	e9 1d fe ff ff       	jmp    802cea <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802ecd:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ed0:	85 db                	test   %ebx,%ebx
+  802ed2:	0f 45 c3             	cmovne %ebx,%eax
+  802ed5:	e9 10 fe ff ff       	jmp    802cea <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802eda:	83 ec 0c             	sub    $0xc,%esp
+  802edd:	68 e0 66 80 00       	push   $0x8066e0
+  802ee2:	e8 aa 0d 00 00       	call   803c91 <pgbatch_init>
+  802ee7:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802eea:	be 00 00 00 00       	mov    $0x0,%esi
+  802eef:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef4:	e9 63 ff ff ff       	jmp    802e5c <nsipc_sendmsg+0x1d9>
+
+00802ef9 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802ef9:	55                   	push   %ebp
+  802efa:	89 e5                	mov    %esp,%ebp
+  802efc:	57                   	push   %edi
+  802efd:	56                   	push   %esi
+  802efe:	53                   	push   %ebx
+  802eff:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802f02:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802f09:	0f 84 c8 00 00 00    	je     802fd7 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802f0f:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802f16:	0f 84 e4 00 00 00    	je     803000 <nsipc_sendfile+0x107>
+{
+  802f1c:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802f21:	89 fb                	mov    %edi,%ebx
+  802f23:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802f26:	0f 83 f0 00 00 00    	jae    80301c <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802f2c:	89 fa                	mov    %edi,%edx
+  802f2e:	03 55 10             	add    0x10(%ebp),%edx
+  802f31:	89 d0                	mov    %edx,%eax
+  802f33:	c1 f8 1f             	sar    $0x1f,%eax
+  802f36:	c1 e8 14             	shr    $0x14,%eax
+  802f39:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802f3c:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802f42:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f44:	6a 10                	push   $0x10
+  802f46:	68 00 20 01 e0       	push   $0xe0012000
+  802f4b:	52                   	push   %edx
+  802f4c:	ff 75 0c             	push   0xc(%ebp)
+  802f4f:	e8 fe f4 ff ff       	call   802452 <fmap>
+  802f54:	83 c4 10             	add    $0x10,%esp
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	0f 8e b8 00 00 00    	jle    803017 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802f5f:	39 c6                	cmp    %eax,%esi
+  802f61:	0f 8d b5 00 00 00    	jge    80301c <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802f67:	29 f0                	sub    %esi,%eax
+  802f69:	8b 55 14             	mov    0x14(%ebp),%edx
+  802f6c:	29 da                	sub    %ebx,%edx
+  802f6e:	39 d0                	cmp    %edx,%eax
+  802f70:	89 d3                	mov    %edx,%ebx
+  802f72:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f78:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802f7d:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802f83:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802f89:	8b 45 18             	mov    0x18(%ebp),%eax
+  802f8c:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f91:	83 ec 0c             	sub    $0xc,%esp
+  802f94:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802f96:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802f9d:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802fa0:	83 c0 01             	add    $0x1,%eax
+  802fa3:	50                   	push   %eax
+  802fa4:	68 00 10 01 e0       	push   $0xe0011000
+  802fa9:	6a 11                	push   $0x11
+  802fab:	ff 35 e4 69 80 00    	push   0x8069e4
+  802fb1:	e8 03 15 00 00       	call   8044b9 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802fb6:	83 c4 1c             	add    $0x1c,%esp
+  802fb9:	6a 00                	push   $0x0
+  802fbb:	6a 00                	push   $0x0
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	e8 31 12 00 00       	call   8041f5 <ipc_recv>
+  802fc4:	83 c4 10             	add    $0x10,%esp
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	78 5b                	js     803026 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802fcb:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802fcd:	39 c3                	cmp    %eax,%ebx
+  802fcf:	0f 8e 4c ff ff ff    	jle    802f21 <nsipc_sendfile+0x28>
+  802fd5:	eb 45                	jmp    80301c <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802fd7:	83 ec 04             	sub    $0x4,%esp
+  802fda:	6a 07                	push   $0x7
+  802fdc:	68 00 10 01 e0       	push   $0xe0011000
+  802fe1:	6a 00                	push   $0x0
+  802fe3:	e8 0d e0 ff ff       	call   800ff5 <sys_page_alloc>
+  802fe8:	89 c7                	mov    %eax,%edi
+  802fea:	83 c4 10             	add    $0x10,%esp
+  802fed:	85 c0                	test   %eax,%eax
+  802fef:	78 2b                	js     80301c <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802ff1:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802ff8:	00 00 00 
+  802ffb:	e9 0f ff ff ff       	jmp    802f0f <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803000:	83 ec 0c             	sub    $0xc,%esp
+  803003:	6a 03                	push   $0x3
+  803005:	e8 e4 14 00 00       	call   8044ee <ipc_find_env>
+  80300a:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	e9 05 ff ff ff       	jmp    802f1c <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803017:	85 ff                	test   %edi,%edi
+  803019:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80301c:	89 f8                	mov    %edi,%eax
+  80301e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803021:	5b                   	pop    %ebx
+  803022:	5e                   	pop    %esi
+  803023:	5f                   	pop    %edi
+  803024:	5d                   	pop    %ebp
+  803025:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803026:	85 ff                	test   %edi,%edi
+  803028:	0f 44 f8             	cmove  %eax,%edi
+  80302b:	eb ef                	jmp    80301c <nsipc_sendfile+0x123>
+
+0080302d <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80302d:	55                   	push   %ebp
+  80302e:	89 e5                	mov    %esp,%ebp
+  803030:	57                   	push   %edi
+  803031:	56                   	push   %esi
+  803032:	53                   	push   %ebx
+  803033:	83 ec 1c             	sub    $0x1c,%esp
+  803036:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803039:	e8 13 f9 ff ff       	call   802951 <nsbulk_map>
+  80303e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803041:	85 c0                	test   %eax,%eax
+  803043:	0f 88 ba 00 00 00    	js     803103 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803049:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80304d:	0f 8e bb 00 00 00    	jle    80310e <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803053:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803058:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80305d:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803062:	89 f8                	mov    %edi,%eax
+  803064:	29 f0                	sub    %esi,%eax
+  803066:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80306a:	39 c8                	cmp    %ecx,%eax
+  80306c:	0f 47 c1             	cmova  %ecx,%eax
+  80306f:	01 f0                	add    %esi,%eax
+  803071:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803073:	83 c2 01             	add    $0x1,%edx
+  803076:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803079:	7e 07                	jle    803082 <nsipc_recvmsg+0x55>
+  80307b:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803080:	7e e0                	jle    803062 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803082:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803088:	c1 fa 0c             	sar    $0xc,%edx
+  80308b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803090:	e8 0a f9 ff ff       	call   80299f <nsbulk_own>
+  803095:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803098:	85 c0                	test   %eax,%eax
+  80309a:	78 67                	js     803103 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80309c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80309f:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8030a4:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8030aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030ad:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8030b2:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030b7:	89 f2                	mov    %esi,%edx
+  8030b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8030be:	e8 44 f9 ff ff       	call   802a07 <nsipc_bulk>
+  8030c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8030c6:	85 c0                	test   %eax,%eax
+  8030c8:	78 39                	js     803103 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8030ca:	39 f0                	cmp    %esi,%eax
+  8030cc:	7f 4a                	jg     803118 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8030ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030d3:	85 c0                	test   %eax,%eax
+  8030d5:	7e 2c                	jle    803103 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8030d7:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8030da:	29 fe                	sub    %edi,%esi
+  8030dc:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030df:	39 c6                	cmp    %eax,%esi
+  8030e1:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8030e4:	83 ec 04             	sub    $0x4,%esp
+  8030e7:	56                   	push   %esi
+  8030e8:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8030ee:	50                   	push   %eax
+  8030ef:	ff 33                	push   (%ebx)
+  8030f1:	e8 7b dc ff ff       	call   800d71 <memmove>
+		n += m;
+  8030f6:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8030f8:	83 c3 08             	add    $0x8,%ebx
+  8030fb:	83 c4 10             	add    $0x10,%esp
+  8030fe:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803101:	7f d4                	jg     8030d7 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803103:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803109:	5b                   	pop    %ebx
+  80310a:	5e                   	pop    %esi
+  80310b:	5f                   	pop    %edi
+  80310c:	5d                   	pop    %ebp
+  80310d:	c3                   	ret
+	int r, i, n, len = 0;
+  80310e:	be 00 00 00 00       	mov    $0x0,%esi
+  803113:	e9 6a ff ff ff       	jmp    803082 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803118:	68 d8 4d 80 00       	push   $0x804dd8
+  80311d:	68 e1 4d 80 00       	push   $0x804de1
+  803122:	68 3b 01 00 00       	push   $0x13b
+  803127:	68 f6 4d 80 00       	push   $0x804df6
+  80312c:	e8 be d2 ff ff       	call   8003ef <_panic>
+
+00803131 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	57                   	push   %edi
+  803135:	56                   	push   %esi
+  803136:	53                   	push   %ebx
+  803137:	83 ec 0c             	sub    $0xc,%esp
+  80313a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80313d:	8b 75 10             	mov    0x10(%ebp),%esi
+  803140:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803143:	8b 45 08             	mov    0x8(%ebp),%eax
+  803146:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80314b:	8b 07                	mov    (%edi),%eax
+  80314d:	a3 04 80 80 00       	mov    %eax,0x808004
+  803152:	8b 47 04             	mov    0x4(%edi),%eax
+  803155:	a3 08 80 80 00       	mov    %eax,0x808008
+  80315a:	8b 47 08             	mov    0x8(%edi),%eax
+  80315d:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803162:	8b 47 0c             	mov    0xc(%edi),%eax
+  803165:	a3 10 80 80 00       	mov    %eax,0x808010
+  80316a:	8b 47 10             	mov    0x10(%edi),%eax
+  80316d:	a3 14 80 80 00       	mov    %eax,0x808014
+  803172:	8b 47 14             	mov    0x14(%edi),%eax
+  803175:	a3 18 80 80 00       	mov    %eax,0x808018
+  80317a:	8b 47 18             	mov    0x18(%edi),%eax
+  80317d:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803182:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803185:	a3 20 80 80 00       	mov    %eax,0x808020
+  80318a:	8b 47 20             	mov    0x20(%edi),%eax
+  80318d:	a3 24 80 80 00       	mov    %eax,0x808024
+  803192:	8b 47 24             	mov    0x24(%edi),%eax
+  803195:	a3 28 80 80 00       	mov    %eax,0x808028
+  80319a:	8b 47 28             	mov    0x28(%edi),%eax
+  80319d:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8031a2:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8031a5:	a3 30 80 80 00       	mov    %eax,0x808030
+  8031aa:	8b 47 30             	mov    0x30(%edi),%eax
+  8031ad:	a3 34 80 80 00       	mov    %eax,0x808034
+  8031b2:	8b 47 34             	mov    0x34(%edi),%eax
+  8031b5:	a3 38 80 80 00       	mov    %eax,0x808038
+  8031ba:	8b 47 38             	mov    0x38(%edi),%eax
+  8031bd:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8031c2:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8031c5:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8031ca:	8b 06                	mov    (%esi),%eax
+  8031cc:	a3 44 80 80 00       	mov    %eax,0x808044
+  8031d1:	8b 46 04             	mov    0x4(%esi),%eax
+  8031d4:	a3 48 80 80 00       	mov    %eax,0x808048
+  8031d9:	8b 46 08             	mov    0x8(%esi),%eax
+  8031dc:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8031e1:	8b 46 0c             	mov    0xc(%esi),%eax
+  8031e4:	a3 50 80 80 00       	mov    %eax,0x808050
+  8031e9:	8b 46 10             	mov    0x10(%esi),%eax
+  8031ec:	a3 54 80 80 00       	mov    %eax,0x808054
+  8031f1:	8b 46 14             	mov    0x14(%esi),%eax
+  8031f4:	a3 58 80 80 00       	mov    %eax,0x808058
+  8031f9:	8b 46 18             	mov    0x18(%esi),%eax
+  8031fc:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803201:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803204:	a3 60 80 80 00       	mov    %eax,0x808060
+  803209:	8b 46 20             	mov    0x20(%esi),%eax
+  80320c:	a3 64 80 80 00       	mov    %eax,0x808064
+  803211:	8b 46 24             	mov    0x24(%esi),%eax
+  803214:	a3 68 80 80 00       	mov    %eax,0x808068
+  803219:	8b 46 28             	mov    0x28(%esi),%eax
+  80321c:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803221:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803224:	a3 70 80 80 00       	mov    %eax,0x808070
+  803229:	8b 46 30             	mov    0x30(%esi),%eax
+  80322c:	a3 74 80 80 00       	mov    %eax,0x808074
+  803231:	8b 46 34             	mov    0x34(%esi),%eax
+  803234:	a3 78 80 80 00       	mov    %eax,0x808078
+  803239:	8b 46 38             	mov    0x38(%esi),%eax
+  80323c:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803241:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803244:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803249:	8b 03                	mov    (%ebx),%eax
+  80324b:	a3 84 80 80 00       	mov    %eax,0x808084
+  803250:	8b 43 04             	mov    0x4(%ebx),%eax
+  803253:	a3 88 80 80 00       	mov    %eax,0x808088
+  803258:	8b 43 08             	mov    0x8(%ebx),%eax
+  80325b:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803260:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803263:	a3 90 80 80 00       	mov    %eax,0x808090
+  803268:	8b 43 10             	mov    0x10(%ebx),%eax
+  80326b:	a3 94 80 80 00       	mov    %eax,0x808094
+  803270:	8b 43 14             	mov    0x14(%ebx),%eax
+  803273:	a3 98 80 80 00       	mov    %eax,0x808098
+  803278:	8b 43 18             	mov    0x18(%ebx),%eax
+  80327b:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803280:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803283:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803288:	8b 43 20             	mov    0x20(%ebx),%eax
+  80328b:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803290:	8b 43 24             	mov    0x24(%ebx),%eax
+  803293:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803298:	8b 43 28             	mov    0x28(%ebx),%eax
+  80329b:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8032a0:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8032a3:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8032a8:	8b 43 30             	mov    0x30(%ebx),%eax
+  8032ab:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8032b0:	8b 43 34             	mov    0x34(%ebx),%eax
+  8032b3:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8032b8:	8b 43 38             	mov    0x38(%ebx),%eax
+  8032bb:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8032c0:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8032c3:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8032c8:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032cb:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8032d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8032d5:	e8 2b f6 ff ff       	call   802905 <nsipc>
+  8032da:	85 c0                	test   %eax,%eax
+  8032dc:	0f 88 ad 01 00 00    	js     80348f <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8032e2:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8032e8:	89 17                	mov    %edx,(%edi)
+  8032ea:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8032f0:	89 57 04             	mov    %edx,0x4(%edi)
+  8032f3:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8032f9:	89 57 08             	mov    %edx,0x8(%edi)
+  8032fc:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803302:	89 57 0c             	mov    %edx,0xc(%edi)
+  803305:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80330b:	89 57 10             	mov    %edx,0x10(%edi)
+  80330e:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803314:	89 57 14             	mov    %edx,0x14(%edi)
+  803317:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80331d:	89 57 18             	mov    %edx,0x18(%edi)
+  803320:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803326:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803329:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  80332f:	89 57 20             	mov    %edx,0x20(%edi)
+  803332:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  803338:	89 57 24             	mov    %edx,0x24(%edi)
+  80333b:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803341:	89 57 28             	mov    %edx,0x28(%edi)
+  803344:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80334a:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80334d:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803353:	89 57 30             	mov    %edx,0x30(%edi)
+  803356:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80335c:	89 57 34             	mov    %edx,0x34(%edi)
+  80335f:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803365:	89 57 38             	mov    %edx,0x38(%edi)
+  803368:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80336e:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803371:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  803377:	89 16                	mov    %edx,(%esi)
+  803379:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80337f:	89 56 04             	mov    %edx,0x4(%esi)
+  803382:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803388:	89 56 08             	mov    %edx,0x8(%esi)
+  80338b:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803391:	89 56 0c             	mov    %edx,0xc(%esi)
+  803394:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80339a:	89 56 10             	mov    %edx,0x10(%esi)
+  80339d:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8033a3:	89 56 14             	mov    %edx,0x14(%esi)
+  8033a6:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8033ac:	89 56 18             	mov    %edx,0x18(%esi)
+  8033af:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8033b5:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8033b8:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8033be:	89 56 20             	mov    %edx,0x20(%esi)
+  8033c1:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8033c7:	89 56 24             	mov    %edx,0x24(%esi)
+  8033ca:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8033d0:	89 56 28             	mov    %edx,0x28(%esi)
+  8033d3:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8033d9:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8033dc:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8033e2:	89 56 30             	mov    %edx,0x30(%esi)
+  8033e5:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8033eb:	89 56 34             	mov    %edx,0x34(%esi)
+  8033ee:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8033f4:	89 56 38             	mov    %edx,0x38(%esi)
+  8033f7:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8033fd:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803400:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  803406:	89 13                	mov    %edx,(%ebx)
+  803408:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  80340e:	89 53 04             	mov    %edx,0x4(%ebx)
+  803411:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  803417:	89 53 08             	mov    %edx,0x8(%ebx)
+  80341a:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803420:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803423:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803429:	89 53 10             	mov    %edx,0x10(%ebx)
+  80342c:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803432:	89 53 14             	mov    %edx,0x14(%ebx)
+  803435:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  80343b:	89 53 18             	mov    %edx,0x18(%ebx)
+  80343e:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803444:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803447:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  80344d:	89 53 20             	mov    %edx,0x20(%ebx)
+  803450:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803456:	89 53 24             	mov    %edx,0x24(%ebx)
+  803459:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  80345f:	89 53 28             	mov    %edx,0x28(%ebx)
+  803462:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  803468:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80346b:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803471:	89 53 30             	mov    %edx,0x30(%ebx)
+  803474:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80347a:	89 53 34             	mov    %edx,0x34(%ebx)
+  80347d:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803483:	89 53 38             	mov    %edx,0x38(%ebx)
+  803486:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  80348c:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80348f:	83 c4 0c             	add    $0xc,%esp
+  803492:	5b                   	pop    %ebx
+  803493:	5e                   	pop    %esi
+  803494:	5f                   	pop    %edi
+  803495:	5d                   	pop    %ebp
+  803496:	c3                   	ret
+
+00803497 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803497:	55                   	push   %ebp
+  803498:	89 e5                	mov    %esp,%ebp
+  80349a:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80349d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8034a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034a8:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8034ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034b0:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8034b5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8034ba:	e8 46 f4 ff ff       	call   802905 <nsipc>
+}
+  8034bf:	c9                   	leave
+  8034c0:	c3                   	ret
+
+008034c1 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8034c1:	55                   	push   %ebp
+  8034c2:	89 e5                	mov    %esp,%ebp
+  8034c4:	56                   	push   %esi
+  8034c5:	53                   	push   %ebx
+  8034c6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  8034c9:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  8034cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8034d2:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  8034d7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8034dc:	e8 24 f4 ff ff       	call   802905 <nsipc>
+  8034e1:	89 c3                	mov    %eax,%ebx
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	7e 1f                	jle    803506 <nsipc_evwait+0x45>
+		assert(r <= max);
+  8034e7:	39 c6                	cmp    %eax,%esi
+  8034e9:	7c 24                	jl     80350f <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8034eb:	83 ec 04             	sub    $0x4,%esp
+  8034ee:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8034f5:	50                   	push   %eax
+  8034f6:	68 00 80 80 00       	push   $0x808000
+  8034fb:	ff 75 08             	push   0x8(%ebp)
+  8034fe:	e8 6e d8 ff ff       	call   800d71 <memmove>
+  803503:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803506:	89 d8                	mov    %ebx,%eax
+  803508:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80350b:	5b                   	pop    %ebx
+  80350c:	5e                   	pop    %esi
+  80350d:	5d                   	pop    %ebp
+  80350e:	c3                   	ret
+		assert(r <= max);
+  80350f:	68 0e 4e 80 00       	push   $0x804e0e
+  803514:	68 e1 4d 80 00       	push   $0x804de1
+  803519:	68 6a 01 00 00       	push   $0x16a
+  80351e:	68 f6 4d 80 00       	push   $0x804df6
+  803523:	e8 c7 ce ff ff       	call   8003ef <_panic>
+
+00803528 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803528:	55                   	push   %ebp
+  803529:	89 e5                	mov    %esp,%ebp
+  80352b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80352e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803531:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  803536:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803539:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  80353e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803541:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803546:	b8 09 00 00 00       	mov    $0x9,%eax
+  80354b:	e8 b5 f3 ff ff       	call   802905 <nsipc>
+}
+  803550:	c9                   	leave
+  803551:	c3                   	ret
+
+00803552 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803552:	55                   	push   %ebp
+  803553:	89 e5                	mov    %esp,%ebp
+  803555:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803558:	8b 45 08             	mov    0x8(%ebp),%eax
+  80355b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803560:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803565:	e8 9b f3 ff ff       	call   802905 <nsipc>
+}
+  80356a:	c9                   	leave
+  80356b:	c3                   	ret
+
+0080356c <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80356c:	55                   	push   %ebp
+  80356d:	89 e5                	mov    %esp,%ebp
+  80356f:	53                   	push   %ebx
+  803570:	83 ec 04             	sub    $0x4,%esp
+  803573:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803576:	b8 12 00 00 00       	mov    $0x12,%eax
+  80357b:	e8 85 f3 ff ff       	call   802905 <nsipc>
+  803580:	85 c0                	test   %eax,%eax
+  803582:	78 50                	js     8035d4 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803584:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80358a:	89 13                	mov    %edx,(%ebx)
+  80358c:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803592:	89 53 04             	mov    %edx,0x4(%ebx)
+  803595:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80359b:	89 53 08             	mov    %edx,0x8(%ebx)
+  80359e:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8035a4:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8035a7:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8035ad:	89 53 10             	mov    %edx,0x10(%ebx)
+  8035b0:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8035b6:	89 53 14             	mov    %edx,0x14(%ebx)
+  8035b9:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8035bf:	89 53 18             	mov    %edx,0x18(%ebx)
+  8035c2:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8035c8:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8035cb:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8035d1:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8035d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035d7:	c9                   	leave
+  8035d8:	c3                   	ret
+
+008035d9 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8035df:	6a 03                	push   $0x3
+  8035e1:	e8 08 0f 00 00       	call   8044ee <ipc_find_env>
+  8035e6:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  8035eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ee:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8035f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8035f8:	e8 08 f3 ff ff       	call   802905 <nsipc>
+  8035fd:	83 c4 10             	add    $0x10,%esp
+  803600:	85 c0                	test   %eax,%eax
+  803602:	78 0a                	js     80360e <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803604:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803609:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80360e:	c9                   	leave
+  80360f:	c3                   	ret
+
+00803610 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803610:	55                   	push   %ebp
+  803611:	89 e5                	mov    %esp,%ebp
+  803613:	57                   	push   %edi
+  803614:	56                   	push   %esi
+  803615:	53                   	push   %ebx
+  803616:	83 ec 1c             	sub    $0x1c,%esp
+  803619:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80361c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80361f:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803624:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803629:	89 e0                	mov    %esp,%eax
+  80362b:	89 f2                	mov    %esi,%edx
+  80362d:	29 c2                	sub    %eax,%edx
+  80362f:	89 d0                	mov    %edx,%eax
+  803631:	c1 e8 0f             	shr    $0xf,%eax
+  803634:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80363a:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80363d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803644:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803647:	83 ec 0c             	sub    $0xc,%esp
+  80364a:	ff 75 e0             	push   -0x20(%ebp)
+  80364d:	e8 db 0e 00 00       	call   80452d <pageref>
+  803652:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803655:	83 c4 04             	add    $0x4,%esp
+  803658:	ff 75 dc             	push   -0x24(%ebp)
+  80365b:	e8 cd 0e 00 00       	call   80452d <pageref>
+  803660:	89 e2                	mov    %esp,%edx
+  803662:	89 f1                	mov    %esi,%ecx
+  803664:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803666:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803669:	89 ca                	mov    %ecx,%edx
+  80366b:	c1 ea 0f             	shr    $0xf,%edx
+  80366e:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803674:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803677:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  80367e:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803681:	39 d7                	cmp    %edx,%edi
+  803683:	74 40                	je     8036c5 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803685:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803688:	75 9f                	jne    803629 <_pipeisclosed+0x19>
+  80368a:	89 e2                	mov    %esp,%edx
+  80368c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803691:	29 d0                	sub    %edx,%eax
+  803693:	89 c2                	mov    %eax,%edx
+  803695:	c1 ea 0f             	shr    $0xf,%edx
+  803698:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80369d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a2:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036a5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8036ac:	8b 40 58             	mov    0x58(%eax),%eax
+  8036af:	6a 01                	push   $0x1
+  8036b1:	50                   	push   %eax
+  8036b2:	57                   	push   %edi
+  8036b3:	68 17 4e 80 00       	push   $0x804e17
+  8036b8:	e8 0d ce ff ff       	call   8004ca <cprintf>
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	e9 5f ff ff ff       	jmp    803624 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  8036c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036c8:	0f 94 c0             	sete   %al
+  8036cb:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8036ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036d1:	5b                   	pop    %ebx
+  8036d2:	5e                   	pop    %esi
+  8036d3:	5f                   	pop    %edi
+  8036d4:	5d                   	pop    %ebp
+  8036d5:	c3                   	ret
+
+008036d6 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8036d6:	55                   	push   %ebp
+  8036d7:	89 e5                	mov    %esp,%ebp
+  8036d9:	53                   	push   %ebx
+  8036da:	83 ec 0c             	sub    $0xc,%esp
+  8036dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8036e0:	53                   	push   %ebx
+  8036e1:	6a 00                	push   $0x0
+  8036e3:	e8 92 d9 ff ff       	call   80107a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8036e8:	89 1c 24             	mov    %ebx,(%esp)
+  8036eb:	e8 f4 e4 ff ff       	call   801be4 <fd2data>
+  8036f0:	83 c4 08             	add    $0x8,%esp
+  8036f3:	50                   	push   %eax
+  8036f4:	6a 00                	push   $0x0
+  8036f6:	e8 7f d9 ff ff       	call   80107a <sys_page_unmap>
+}
+  8036fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036fe:	c9                   	leave
+  8036ff:	c3                   	ret
+
+00803700 <devpipe_read>:
+{
+  803700:	55                   	push   %ebp
+  803701:	89 e5                	mov    %esp,%ebp
+  803703:	57                   	push   %edi
+  803704:	56                   	push   %esi
+  803705:	53                   	push   %ebx
+  803706:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803709:	ff 75 08             	push   0x8(%ebp)
+  80370c:	e8 d3 e4 ff ff       	call   801be4 <fd2data>
+  803711:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803713:	8b 70 04             	mov    0x4(%eax),%esi
+  803716:	8b 00                	mov    (%eax),%eax
+  803718:	83 c4 10             	add    $0x10,%esp
+  80371b:	39 f0                	cmp    %esi,%eax
+  80371d:	75 36                	jne    803755 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80371f:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803722:	89 da                	mov    %ebx,%edx
+  803724:	8b 45 08             	mov    0x8(%ebp),%eax
+  803727:	e8 e4 fe ff ff       	call   803610 <_pipeisclosed>
+  80372c:	85 c0                	test   %eax,%eax
+  80372e:	0f 85 d4 00 00 00    	jne    803808 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803734:	b8 01 00 00 00       	mov    $0x1,%eax
+  803739:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80373d:	83 ec 04             	sub    $0x4,%esp
+  803740:	6a ff                	push   $0xffffffff
+  803742:	56                   	push   %esi
+  803743:	57                   	push   %edi
+  803744:	e8 aa dc ff ff       	call   8013f3 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803749:	8b 73 04             	mov    0x4(%ebx),%esi
+  80374c:	8b 03                	mov    (%ebx),%eax
+  80374e:	83 c4 10             	add    $0x10,%esp
+  803751:	39 c6                	cmp    %eax,%esi
+  803753:	74 cd                	je     803722 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803755:	8b 73 04             	mov    0x4(%ebx),%esi
+  803758:	8b 03                	mov    (%ebx),%eax
+  80375a:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803760:	29 c6                	sub    %eax,%esi
+  803762:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803767:	f7 e6                	mul    %esi
+  803769:	c1 ea 0c             	shr    $0xc,%edx
+  80376c:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803772:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803774:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803777:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80377b:	8b 0b                	mov    (%ebx),%ecx
+  80377d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803782:	f7 e1                	mul    %ecx
+  803784:	c1 ea 0b             	shr    $0xb,%edx
+  803787:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80378d:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80378f:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803794:	29 cf                	sub    %ecx,%edi
+  803796:	39 f7                	cmp    %esi,%edi
+  803798:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80379b:	83 ec 04             	sub    $0x4,%esp
+  80379e:	57                   	push   %edi
+  80379f:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8037a3:	50                   	push   %eax
+  8037a4:	ff 75 0c             	push   0xc(%ebp)
+  8037a7:	e8 c5 d5 ff ff       	call   800d71 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8037ac:	83 c4 0c             	add    $0xc,%esp
+  8037af:	89 f0                	mov    %esi,%eax
+  8037b1:	29 f8                	sub    %edi,%eax
+  8037b3:	50                   	push   %eax
+  8037b4:	8d 43 10             	lea    0x10(%ebx),%eax
+  8037b7:	50                   	push   %eax
+  8037b8:	89 f8                	mov    %edi,%eax
+  8037ba:	03 45 0c             	add    0xc(%ebp),%eax
+  8037bd:	50                   	push   %eax
+  8037be:	e8 ae d5 ff ff       	call   800d71 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  8037c3:	8b 0b                	mov    (%ebx),%ecx
+  8037c5:	01 f1                	add    %esi,%ecx
+  8037c7:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037cc:	f7 e1                	mul    %ecx
+  8037ce:	c1 ea 0c             	shr    $0xc,%edx
+  8037d1:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8037d7:	29 c1                	sub    %eax,%ecx
+  8037d9:	89 0b                	mov    %ecx,(%ebx)
+  8037db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e0:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8037e4:	83 c4 10             	add    $0x10,%esp
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	75 0a                	jne    8037f5 <devpipe_read+0xf5>
+	return n;
+  8037eb:	89 f0                	mov    %esi,%eax
+}
+  8037ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f0:	5b                   	pop    %ebx
+  8037f1:	5e                   	pop    %esi
+  8037f2:	5f                   	pop    %edi
+  8037f3:	5d                   	pop    %ebp
+  8037f4:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8037f5:	83 ec 08             	sub    $0x8,%esp
+  8037f8:	68 00 04 00 00       	push   $0x400
+  8037fd:	53                   	push   %ebx
+  8037fe:	e8 12 dc ff ff       	call   801415 <sys_futex_wake>
+  803803:	83 c4 10             	add    $0x10,%esp
+  803806:	eb e3                	jmp    8037eb <devpipe_read+0xeb>
+			return 0;
+  803808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380d:	eb de                	jmp    8037ed <devpipe_read+0xed>
+
+0080380f <devpipe_write>:
+{
+  80380f:	55                   	push   %ebp
+  803810:	89 e5                	mov    %esp,%ebp
+  803812:	57                   	push   %edi
+  803813:	56                   	push   %esi
+  803814:	53                   	push   %ebx
+  803815:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803818:	ff 75 08             	push   0x8(%ebp)
+  80381b:	e8 c4 e3 ff ff       	call   801be4 <fd2data>
+  803820:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803822:	83 c4 10             	add    $0x10,%esp
+  803825:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80382c:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803831:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803835:	0f 84 43 01 00 00    	je     80397e <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80383b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80383e:	8b 06                	mov    (%esi),%eax
+  803840:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803846:	29 c1                	sub    %eax,%ecx
+  803848:	89 c8                	mov    %ecx,%eax
+  80384a:	f7 e7                	mul    %edi
+  80384c:	c1 ea 0c             	shr    $0xc,%edx
+  80384f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803855:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803857:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80385d:	75 52                	jne    8038b1 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80385f:	89 f2                	mov    %esi,%edx
+  803861:	8b 45 08             	mov    0x8(%ebp),%eax
+  803864:	e8 a7 fd ff ff       	call   803610 <_pipeisclosed>
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	0f 85 28 01 00 00    	jne    803999 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803871:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803873:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803876:	8b 06                	mov    (%esi),%eax
+  803878:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80387e:	29 c1                	sub    %eax,%ecx
+  803880:	89 c8                	mov    %ecx,%eax
+  803882:	f7 e7                	mul    %edi
+  803884:	c1 ea 0c             	shr    $0xc,%edx
+  803887:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80388d:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80388f:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803895:	75 a4                	jne    80383b <devpipe_write+0x2c>
+  803897:	b8 01 00 00 00       	mov    $0x1,%eax
+  80389c:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8038a0:	83 ec 04             	sub    $0x4,%esp
+  8038a3:	6a ff                	push   $0xffffffff
+  8038a5:	53                   	push   %ebx
+  8038a6:	56                   	push   %esi
+  8038a7:	e8 47 db ff ff       	call   8013f3 <sys_futex_wait>
+}
+  8038ac:	83 c4 10             	add    $0x10,%esp
+  8038af:	eb 8a                	jmp    80383b <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038b1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038b4:	8b 06                	mov    (%esi),%eax
+  8038b6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8038bc:	29 c1                	sub    %eax,%ecx
+  8038be:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038c3:	f7 e1                	mul    %ecx
+  8038c5:	c1 ea 0c             	shr    $0xc,%edx
+  8038c8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038ce:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8038d0:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8038d5:	89 d8                	mov    %ebx,%eax
+  8038d7:	29 c8                	sub    %ecx,%eax
+  8038d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8038dc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038df:	29 ca                	sub    %ecx,%edx
+  8038e1:	39 d0                	cmp    %edx,%eax
+  8038e3:	0f 46 d0             	cmovbe %eax,%edx
+  8038e6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8038e9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038ec:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038f1:	f7 e1                	mul    %ecx
+  8038f3:	c1 ea 0b             	shr    $0xb,%edx
+  8038f6:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8038fc:	89 ca                	mov    %ecx,%edx
+  8038fe:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803900:	29 d3                	sub    %edx,%ebx
+  803902:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803905:	39 c3                	cmp    %eax,%ebx
+  803907:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80390a:	83 ec 04             	sub    $0x4,%esp
+  80390d:	53                   	push   %ebx
+  80390e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803911:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803914:	51                   	push   %ecx
+  803915:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803919:	50                   	push   %eax
+  80391a:	e8 52 d4 ff ff       	call   800d71 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80391f:	83 c4 0c             	add    $0xc,%esp
+  803922:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803925:	29 d8                	sub    %ebx,%eax
+  803927:	50                   	push   %eax
+  803928:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80392b:	01 cb                	add    %ecx,%ebx
+  80392d:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803930:	53                   	push   %ebx
+  803931:	8d 46 10             	lea    0x10(%esi),%eax
+  803934:	50                   	push   %eax
+  803935:	e8 37 d4 ff ff       	call   800d71 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80393a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80393d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803940:	01 c1                	add    %eax,%ecx
+  803942:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803947:	f7 e1                	mul    %ecx
+  803949:	c1 ea 0c             	shr    $0xc,%edx
+  80394c:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803952:	89 ca                	mov    %ecx,%edx
+  803954:	29 c2                	sub    %eax,%edx
+  803956:	89 56 04             	mov    %edx,0x4(%esi)
+  803959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80395e:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803962:	83 c4 10             	add    $0x10,%esp
+  803965:	85 c0                	test   %eax,%eax
+  803967:	75 1a                	jne    803983 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803969:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80396c:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  80396f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803972:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803975:	0f 82 c0 fe ff ff    	jb     80383b <devpipe_write+0x2c>
+  80397b:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80397e:	8b 45 10             	mov    0x10(%ebp),%eax
+  803981:	eb 1b                	jmp    80399e <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803983:	83 ec 08             	sub    $0x8,%esp
+  803986:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80398b:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80398e:	50                   	push   %eax
+  80398f:	e8 81 da ff ff       	call   801415 <sys_futex_wake>
+  803994:	83 c4 10             	add    $0x10,%esp
+  803997:	eb d0                	jmp    803969 <devpipe_write+0x15a>
+				return 0;
+  803999:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80399e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039a1:	5b                   	pop    %ebx
+  8039a2:	5e                   	pop    %esi
+  8039a3:	5f                   	pop    %edi
+  8039a4:	5d                   	pop    %ebp
+  8039a5:	c3                   	ret
+
+008039a6 <devpipe_stat>:
+{
+  8039a6:	55                   	push   %ebp
+  8039a7:	89 e5                	mov    %esp,%ebp
+  8039a9:	56                   	push   %esi
+  8039aa:	53                   	push   %ebx
+  8039ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039ae:	83 ec 0c             	sub    $0xc,%esp
+  8039b1:	ff 75 08             	push   0x8(%ebp)
+  8039b4:	e8 2b e2 ff ff       	call   801be4 <fd2data>
+  8039b9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8039bb:	83 c4 08             	add    $0x8,%esp
+  8039be:	68 2a 4e 80 00       	push   $0x804e2a
+  8039c3:	53                   	push   %ebx
+  8039c4:	e8 f8 d1 ff ff       	call   800bc1 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039c9:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039cc:	8b 06                	mov    (%esi),%eax
+  8039ce:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039d4:	29 c1                	sub    %eax,%ecx
+  8039d6:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8039db:	89 c8                	mov    %ecx,%eax
+  8039dd:	f7 e2                	mul    %edx
+  8039df:	c1 ea 0c             	shr    $0xc,%edx
+  8039e2:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039e8:	29 d1                	sub    %edx,%ecx
+  8039ea:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8039f0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8039f7:	00 00 00 
+	stat->st_dev = &devpipe;
+  8039fa:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803a01:	50 80 00 
+}
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a0c:	5b                   	pop    %ebx
+  803a0d:	5e                   	pop    %esi
+  803a0e:	5d                   	pop    %ebp
+  803a0f:	c3                   	ret
+
+00803a10 <devpipe_poll>:
+{
+  803a10:	55                   	push   %ebp
+  803a11:	89 e5                	mov    %esp,%ebp
+  803a13:	57                   	push   %edi
+  803a14:	56                   	push   %esi
+  803a15:	53                   	push   %ebx
+  803a16:	83 ec 18             	sub    $0x18,%esp
+  803a19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803a1c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803a1f:	57                   	push   %edi
+  803a20:	e8 bf e1 ff ff       	call   801be4 <fd2data>
+  803a25:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a27:	83 c4 10             	add    $0x10,%esp
+  803a2a:	89 f3                	mov    %esi,%ebx
+  803a2c:	83 e3 01             	and    $0x1,%ebx
+  803a2f:	75 27                	jne    803a58 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803a31:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803a37:	75 48                	jne    803a81 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803a39:	89 ca                	mov    %ecx,%edx
+  803a3b:	89 f8                	mov    %edi,%eax
+  803a3d:	e8 ce fb ff ff       	call   803610 <_pipeisclosed>
+  803a42:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803a44:	89 d8                	mov    %ebx,%eax
+  803a46:	83 c8 10             	or     $0x10,%eax
+  803a49:	85 d2                	test   %edx,%edx
+  803a4b:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803a4e:	89 d8                	mov    %ebx,%eax
+  803a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a53:	5b                   	pop    %ebx
+  803a54:	5e                   	pop    %esi
+  803a55:	5f                   	pop    %edi
+  803a56:	5d                   	pop    %ebp
+  803a57:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a58:	8b 58 04             	mov    0x4(%eax),%ebx
+  803a5b:	8b 00                	mov    (%eax),%eax
+  803a5d:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803a63:	29 c3                	sub    %eax,%ebx
+  803a65:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a6a:	89 d8                	mov    %ebx,%eax
+  803a6c:	f7 e2                	mul    %edx
+  803a6e:	c1 ea 0c             	shr    $0xc,%edx
+  803a71:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a77:	39 d3                	cmp    %edx,%ebx
+  803a79:	0f 95 c3             	setne  %bl
+  803a7c:	0f b6 db             	movzbl %bl,%ebx
+  803a7f:	eb b0                	jmp    803a31 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a81:	8b 71 04             	mov    0x4(%ecx),%esi
+  803a84:	8b 01                	mov    (%ecx),%eax
+  803a86:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803a8c:	29 c6                	sub    %eax,%esi
+  803a8e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a93:	89 f0                	mov    %esi,%eax
+  803a95:	f7 e2                	mul    %edx
+  803a97:	c1 ea 0c             	shr    $0xc,%edx
+  803a9a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803aa0:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803aa2:	89 d8                	mov    %ebx,%eax
+  803aa4:	83 c8 04             	or     $0x4,%eax
+  803aa7:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803aad:	0f 42 d8             	cmovb  %eax,%ebx
+  803ab0:	eb 87                	jmp    803a39 <devpipe_poll+0x29>
+
+00803ab2 <pipe>:
+{
+  803ab2:	55                   	push   %ebp
+  803ab3:	89 e5                	mov    %esp,%ebp
+  803ab5:	56                   	push   %esi
+  803ab6:	53                   	push   %ebx
+  803ab7:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803aba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803abd:	50                   	push   %eax
+  803abe:	e8 38 e1 ff ff       	call   801bfb <fd_alloc>
+  803ac3:	89 c3                	mov    %eax,%ebx
+  803ac5:	83 c4 10             	add    $0x10,%esp
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	0f 88 23 01 00 00    	js     803bf3 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ad0:	83 ec 04             	sub    $0x4,%esp
+  803ad3:	68 07 04 00 00       	push   $0x407
+  803ad8:	ff 75 f4             	push   -0xc(%ebp)
+  803adb:	6a 00                	push   $0x0
+  803add:	e8 13 d5 ff ff       	call   800ff5 <sys_page_alloc>
+  803ae2:	89 c3                	mov    %eax,%ebx
+  803ae4:	83 c4 10             	add    $0x10,%esp
+  803ae7:	85 c0                	test   %eax,%eax
+  803ae9:	0f 88 04 01 00 00    	js     803bf3 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803aef:	83 ec 0c             	sub    $0xc,%esp
+  803af2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803af5:	50                   	push   %eax
+  803af6:	e8 00 e1 ff ff       	call   801bfb <fd_alloc>
+  803afb:	89 c3                	mov    %eax,%ebx
+  803afd:	83 c4 10             	add    $0x10,%esp
+  803b00:	85 c0                	test   %eax,%eax
+  803b02:	0f 88 db 00 00 00    	js     803be3 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b08:	83 ec 04             	sub    $0x4,%esp
+  803b0b:	68 07 04 00 00       	push   $0x407
+  803b10:	ff 75 f0             	push   -0x10(%ebp)
+  803b13:	6a 00                	push   $0x0
+  803b15:	e8 db d4 ff ff       	call   800ff5 <sys_page_alloc>
+  803b1a:	89 c3                	mov    %eax,%ebx
+  803b1c:	83 c4 10             	add    $0x10,%esp
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	0f 88 bc 00 00 00    	js     803be3 <pipe+0x131>
+	va = fd2data(fd0);
+  803b27:	83 ec 0c             	sub    $0xc,%esp
+  803b2a:	ff 75 f4             	push   -0xc(%ebp)
+  803b2d:	e8 b2 e0 ff ff       	call   801be4 <fd2data>
+  803b32:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b34:	83 c4 0c             	add    $0xc,%esp
+  803b37:	68 07 04 00 00       	push   $0x407
+  803b3c:	50                   	push   %eax
+  803b3d:	6a 00                	push   $0x0
+  803b3f:	e8 b1 d4 ff ff       	call   800ff5 <sys_page_alloc>
+  803b44:	89 c3                	mov    %eax,%ebx
+  803b46:	83 c4 10             	add    $0x10,%esp
+  803b49:	85 c0                	test   %eax,%eax
+  803b4b:	0f 88 82 00 00 00    	js     803bd3 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b51:	83 ec 0c             	sub    $0xc,%esp
+  803b54:	ff 75 f0             	push   -0x10(%ebp)
+  803b57:	e8 88 e0 ff ff       	call   801be4 <fd2data>
+  803b5c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b63:	50                   	push   %eax
+  803b64:	6a 00                	push   $0x0
+  803b66:	56                   	push   %esi
+  803b67:	6a 00                	push   $0x0
+  803b69:	e8 ca d4 ff ff       	call   801038 <sys_page_map>
+  803b6e:	89 c3                	mov    %eax,%ebx
+  803b70:	83 c4 20             	add    $0x20,%esp
+  803b73:	85 c0                	test   %eax,%eax
+  803b75:	78 4e                	js     803bc5 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b77:	a1 60 50 80 00       	mov    0x805060,%eax
+  803b7c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b7f:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b81:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b84:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b8b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b8e:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b90:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b9a:	83 ec 0c             	sub    $0xc,%esp
+  803b9d:	ff 75 f4             	push   -0xc(%ebp)
+  803ba0:	e8 2f e0 ff ff       	call   801bd4 <fd2num>
+  803ba5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803ba8:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803baa:	83 c4 04             	add    $0x4,%esp
+  803bad:	ff 75 f0             	push   -0x10(%ebp)
+  803bb0:	e8 1f e0 ff ff       	call   801bd4 <fd2num>
+  803bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bb8:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803bbb:	83 c4 10             	add    $0x10,%esp
+  803bbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bc3:	eb 2e                	jmp    803bf3 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803bc5:	83 ec 08             	sub    $0x8,%esp
+  803bc8:	56                   	push   %esi
+  803bc9:	6a 00                	push   $0x0
+  803bcb:	e8 aa d4 ff ff       	call   80107a <sys_page_unmap>
+  803bd0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bd3:	83 ec 08             	sub    $0x8,%esp
+  803bd6:	ff 75 f0             	push   -0x10(%ebp)
+  803bd9:	6a 00                	push   $0x0
+  803bdb:	e8 9a d4 ff ff       	call   80107a <sys_page_unmap>
+  803be0:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803be3:	83 ec 08             	sub    $0x8,%esp
+  803be6:	ff 75 f4             	push   -0xc(%ebp)
+  803be9:	6a 00                	push   $0x0
+  803beb:	e8 8a d4 ff ff       	call   80107a <sys_page_unmap>
+  803bf0:	83 c4 10             	add    $0x10,%esp
+}
+  803bf3:	89 d8                	mov    %ebx,%eax
+  803bf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bf8:	5b                   	pop    %ebx
+  803bf9:	5e                   	pop    %esi
+  803bfa:	5d                   	pop    %ebp
+  803bfb:	c3                   	ret
+
+00803bfc <pipeisclosed>:
+{
+  803bfc:	55                   	push   %ebp
+  803bfd:	89 e5                	mov    %esp,%ebp
+  803bff:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c05:	50                   	push   %eax
+  803c06:	ff 75 08             	push   0x8(%ebp)
+  803c09:	e8 3d e0 ff ff       	call   801c4b <fd_lookup>
+  803c0e:	83 c4 10             	add    $0x10,%esp
+  803c11:	85 c0                	test   %eax,%eax
+  803c13:	78 18                	js     803c2d <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c15:	83 ec 0c             	sub    $0xc,%esp
+  803c18:	ff 75 f4             	push   -0xc(%ebp)
+  803c1b:	e8 c4 df ff ff       	call   801be4 <fd2data>
+  803c20:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c25:	e8 e6 f9 ff ff       	call   803610 <_pipeisclosed>
+  803c2a:	83 c4 10             	add    $0x10,%esp
+}
+  803c2d:	c9                   	leave
+  803c2e:	c3                   	ret
+
+00803c2f <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c2f:	55                   	push   %ebp
+  803c30:	89 e5                	mov    %esp,%ebp
+  803c32:	56                   	push   %esi
+  803c33:	53                   	push   %ebx
+  803c34:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c37:	85 f6                	test   %esi,%esi
+  803c39:	74 40                	je     803c7b <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803c3b:	89 f3                	mov    %esi,%ebx
+  803c3d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c43:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803c49:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c4e:	8b 40 48             	mov    0x48(%eax),%eax
+  803c51:	39 c6                	cmp    %eax,%esi
+  803c53:	75 1f                	jne    803c74 <wait+0x45>
+  803c55:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803c5b:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c61:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c64:	85 c0                	test   %eax,%eax
+  803c66:	74 0c                	je     803c74 <wait+0x45>
+		sys_yield();
+  803c68:	e8 69 d3 ff ff       	call   800fd6 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c6d:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c70:	39 f0                	cmp    %esi,%eax
+  803c72:	74 ed                	je     803c61 <wait+0x32>
+}
+  803c74:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c77:	5b                   	pop    %ebx
+  803c78:	5e                   	pop    %esi
+  803c79:	5d                   	pop    %ebp
+  803c7a:	c3                   	ret
+	assert(envid != 0);
+  803c7b:	68 36 4e 80 00       	push   $0x804e36
+  803c80:	68 e1 4d 80 00       	push   $0x804de1
+  803c85:	6a 09                	push   $0x9
+  803c87:	68 41 4e 80 00       	push   $0x804e41
+  803c8c:	e8 5e c7 ff ff       	call   8003ef <_panic>
+
+00803c91 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803c91:	55                   	push   %ebp
+  803c92:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803c94:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c97:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c9d:	5d                   	pop    %ebp
+  803c9e:	c3                   	ret
+
+00803c9f <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803c9f:	55                   	push   %ebp
+  803ca0:	89 e5                	mov    %esp,%ebp
+  803ca2:	53                   	push   %ebx
+  803ca3:	83 ec 04             	sub    $0x4,%esp
+  803ca6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803ca9:	8b 03                	mov    (%ebx),%eax
+  803cab:	85 c0                	test   %eax,%eax
+  803cad:	75 05                	jne    803cb4 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803caf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cb2:	c9                   	leave
+  803cb3:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803cb4:	83 ec 08             	sub    $0x8,%esp
+  803cb7:	50                   	push   %eax
+  803cb8:	8d 43 04             	lea    0x4(%ebx),%eax
+  803cbb:	50                   	push   %eax
+  803cbc:	e8 09 d6 ff ff       	call   8012ca <sys_page_batch>
+	pb->pb_n = 0;
+  803cc1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803cc7:	83 c4 10             	add    $0x10,%esp
+  803cca:	eb e3                	jmp    803caf <pgbatch_flush+0x10>
+
+00803ccc <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803ccc:	55                   	push   %ebp
+  803ccd:	89 e5                	mov    %esp,%ebp
+  803ccf:	56                   	push   %esi
+  803cd0:	53                   	push   %ebx
+  803cd1:	89 c3                	mov    %eax,%ebx
+  803cd3:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803cd5:	83 38 20             	cmpl   $0x20,(%eax)
+  803cd8:	74 2c                	je     803d06 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803cda:	8b 03                	mov    (%ebx),%eax
+  803cdc:	8d 50 01             	lea    0x1(%eax),%edx
+  803cdf:	89 13                	mov    %edx,(%ebx)
+  803ce1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803ce4:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803ce8:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803cea:	83 ec 04             	sub    $0x4,%esp
+  803ced:	6a 18                	push   $0x18
+  803cef:	6a 00                	push   $0x0
+  803cf1:	50                   	push   %eax
+  803cf2:	e8 45 d0 ff ff       	call   800d3c <memset>
+	return 0;
+  803cf7:	83 c4 10             	add    $0x10,%esp
+  803cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d02:	5b                   	pop    %ebx
+  803d03:	5e                   	pop    %esi
+  803d04:	5d                   	pop    %ebp
+  803d05:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803d06:	83 ec 0c             	sub    $0xc,%esp
+  803d09:	50                   	push   %eax
+  803d0a:	e8 90 ff ff ff       	call   803c9f <pgbatch_flush>
+  803d0f:	83 c4 10             	add    $0x10,%esp
+  803d12:	85 c0                	test   %eax,%eax
+  803d14:	79 c4                	jns    803cda <pgbatch_slot+0xe>
+  803d16:	eb e7                	jmp    803cff <pgbatch_slot+0x33>
+
+00803d18 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803d18:	55                   	push   %ebp
+  803d19:	89 e5                	mov    %esp,%ebp
+  803d1b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d1e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d21:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d24:	e8 a3 ff ff ff       	call   803ccc <pgbatch_slot>
+  803d29:	85 c0                	test   %eax,%eax
+  803d2b:	78 20                	js     803d4d <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d30:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803d36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d39:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d3c:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d3f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d42:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d45:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d48:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d4d:	c9                   	leave
+  803d4e:	c3                   	ret
+
+00803d4f <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803d4f:	55                   	push   %ebp
+  803d50:	89 e5                	mov    %esp,%ebp
+  803d52:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d55:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d5b:	e8 6c ff ff ff       	call   803ccc <pgbatch_slot>
+  803d60:	85 c0                	test   %eax,%eax
+  803d62:	78 2c                	js     803d90 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803d64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d67:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803d6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d70:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803d73:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d76:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d79:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d7c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803d7f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d82:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d85:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803d88:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d90:	c9                   	leave
+  803d91:	c3                   	ret
+
+00803d92 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803d92:	55                   	push   %ebp
+  803d93:	89 e5                	mov    %esp,%ebp
+  803d95:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d98:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d9e:	e8 29 ff ff ff       	call   803ccc <pgbatch_slot>
+  803da3:	85 c0                	test   %eax,%eax
+  803da5:	78 1a                	js     803dc1 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803da7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803daa:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803db0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803db3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803db6:	8b 55 10             	mov    0x10(%ebp),%edx
+  803db9:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dc1:	c9                   	leave
+  803dc2:	c3                   	ret
+
+00803dc3 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803dc3:	55                   	push   %ebp
+  803dc4:	89 e5                	mov    %esp,%ebp
+  803dc6:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dc9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dcf:	e8 f8 fe ff ff       	call   803ccc <pgbatch_slot>
+  803dd4:	85 c0                	test   %eax,%eax
+  803dd6:	78 20                	js     803df8 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803dd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ddb:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803de1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803de4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803de7:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dea:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ded:	8b 55 14             	mov    0x14(%ebp),%edx
+  803df0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803df3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803df8:	c9                   	leave
+  803df9:	c3                   	ret
+
+00803dfa <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803dfa:	55                   	push   %ebp
+  803dfb:	89 e5                	mov    %esp,%ebp
+  803dfd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e00:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e03:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e06:	e8 c1 fe ff ff       	call   803ccc <pgbatch_slot>
+  803e0b:	85 c0                	test   %eax,%eax
+  803e0d:	78 26                	js     803e35 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803e0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e12:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803e18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e1b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803e1e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e21:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e24:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e27:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803e2a:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e2d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e35:	c9                   	leave
+  803e36:	c3                   	ret
+
+00803e37 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803e37:	55                   	push   %ebp
+  803e38:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e3d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e43:	5d                   	pop    %ebp
+  803e44:	c3                   	ret
+
+00803e45 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803e45:	55                   	push   %ebp
+  803e46:	89 e5                	mov    %esp,%ebp
+  803e48:	56                   	push   %esi
+  803e49:	53                   	push   %ebx
+  803e4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e52:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e57:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e5b:	85 c0                	test   %eax,%eax
+  803e5d:	74 2f                	je     803e8e <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803e5f:	83 f8 02             	cmp    $0x2,%eax
+  803e62:	74 0c                	je     803e70 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803e64:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e69:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	74 1e                	je     803e8e <mutex_lock+0x49>
+  803e70:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803e75:	83 ec 04             	sub    $0x4,%esp
+  803e78:	6a ff                	push   $0xffffffff
+  803e7a:	6a 02                	push   $0x2
+  803e7c:	53                   	push   %ebx
+  803e7d:	e8 71 d5 ff ff       	call   8013f3 <sys_futex_wait>
+  803e82:	89 f0                	mov    %esi,%eax
+  803e84:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803e87:	83 c4 10             	add    $0x10,%esp
+  803e8a:	85 c0                	test   %eax,%eax
+  803e8c:	75 e7                	jne    803e75 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803e8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e91:	5b                   	pop    %ebx
+  803e92:	5e                   	pop    %esi
+  803e93:	5d                   	pop    %ebp
+  803e94:	c3                   	ret
+
+00803e95 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803e95:	55                   	push   %ebp
+  803e96:	89 e5                	mov    %esp,%ebp
+  803e98:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803ea5:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803ea9:	85 c0                	test   %eax,%eax
+  803eab:	0f 94 c0             	sete   %al
+  803eae:	0f b6 c0             	movzbl %al,%eax
+}
+  803eb1:	5d                   	pop    %ebp
+  803eb2:	c3                   	ret
+
+00803eb3 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803eb3:	55                   	push   %ebp
+  803eb4:	89 e5                	mov    %esp,%ebp
+  803eb6:	83 ec 08             	sub    $0x8,%esp
+  803eb9:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec1:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803ec4:	83 f8 02             	cmp    $0x2,%eax
+  803ec7:	74 02                	je     803ecb <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803ec9:	c9                   	leave
+  803eca:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803ecb:	83 ec 08             	sub    $0x8,%esp
+  803ece:	6a 01                	push   $0x1
+  803ed0:	52                   	push   %edx
+  803ed1:	e8 3f d5 ff ff       	call   801415 <sys_futex_wake>
+  803ed6:	83 c4 10             	add    $0x10,%esp
+}
+  803ed9:	eb ee                	jmp    803ec9 <mutex_unlock+0x16>
+
+00803edb <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803edb:	55                   	push   %ebp
+  803edc:	89 e5                	mov    %esp,%ebp
+  803ede:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803ee1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803ee7:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803eee:	5d                   	pop    %ebp
+  803eef:	c3                   	ret
+
+00803ef0 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803ef0:	55                   	push   %ebp
+  803ef1:	89 e5                	mov    %esp,%ebp
+  803ef3:	57                   	push   %edi
+  803ef4:	56                   	push   %esi
+  803ef5:	53                   	push   %ebx
+  803ef6:	83 ec 18             	sub    $0x18,%esp
+  803ef9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803efc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803eff:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803f01:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f06:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803f0b:	57                   	push   %edi
+  803f0c:	e8 a2 ff ff ff       	call   803eb3 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803f11:	83 c4 0c             	add    $0xc,%esp
+  803f14:	ff 75 10             	push   0x10(%ebp)
+  803f17:	56                   	push   %esi
+  803f18:	53                   	push   %ebx
+  803f19:	e8 d5 d4 ff ff       	call   8013f3 <sys_futex_wait>
+  803f1e:	89 c6                	mov    %eax,%esi
+  803f20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803f25:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803f2a:	89 3c 24             	mov    %edi,(%esp)
+  803f2d:	e8 13 ff ff ff       	call   803e45 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	83 fe ef             	cmp    $0xffffffef,%esi
+  803f38:	74 05                	je     803f3f <cond_timedwait+0x4f>
+  803f3a:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f3f:	89 f0                	mov    %esi,%eax
+  803f41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f44:	5b                   	pop    %ebx
+  803f45:	5e                   	pop    %esi
+  803f46:	5f                   	pop    %edi
+  803f47:	5d                   	pop    %ebp
+  803f48:	c3                   	ret
+
+00803f49 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f49:	55                   	push   %ebp
+  803f4a:	89 e5                	mov    %esp,%ebp
+  803f4c:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803f4f:	6a ff                	push   $0xffffffff
+  803f51:	ff 75 0c             	push   0xc(%ebp)
+  803f54:	ff 75 08             	push   0x8(%ebp)
+  803f57:	e8 94 ff ff ff       	call   803ef0 <cond_timedwait>
+}
+  803f5c:	83 c4 10             	add    $0x10,%esp
+  803f5f:	c9                   	leave
+  803f60:	c3                   	ret
+
+00803f61 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f61:	55                   	push   %ebp
+  803f62:	89 e5                	mov    %esp,%ebp
+  803f64:	83 ec 08             	sub    $0x8,%esp
+  803f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f6a:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f6f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f73:	8b 50 04             	mov    0x4(%eax),%edx
+  803f76:	85 d2                	test   %edx,%edx
+  803f78:	75 02                	jne    803f7c <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803f7a:	c9                   	leave
+  803f7b:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803f7c:	83 ec 08             	sub    $0x8,%esp
+  803f7f:	6a 01                	push   $0x1
+  803f81:	50                   	push   %eax
+  803f82:	e8 8e d4 ff ff       	call   801415 <sys_futex_wake>
+  803f87:	83 c4 10             	add    $0x10,%esp
+}
+  803f8a:	eb ee                	jmp    803f7a <cond_signal+0x19>
+
+00803f8c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803f8c:	55                   	push   %ebp
+  803f8d:	89 e5                	mov    %esp,%ebp
+  803f8f:	83 ec 08             	sub    $0x8,%esp
+  803f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f95:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f9a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f9e:	8b 50 04             	mov    0x4(%eax),%edx
+  803fa1:	85 d2                	test   %edx,%edx
+  803fa3:	75 02                	jne    803fa7 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803fa7:	83 ec 08             	sub    $0x8,%esp
+  803faa:	68 00 04 00 00       	push   $0x400
+  803faf:	50                   	push   %eax
+  803fb0:	e8 60 d4 ff ff       	call   801415 <sys_futex_wake>
+  803fb5:	83 c4 10             	add    $0x10,%esp
+}
+  803fb8:	eb eb                	jmp    803fa5 <cond_broadcast+0x19>
+
+00803fba <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbf:	c3                   	ret
+
+00803fc0 <devcons_poll>:
+{
+  803fc0:	55                   	push   %ebp
+  803fc1:	89 e5                	mov    %esp,%ebp
+  803fc3:	53                   	push   %ebx
+  803fc4:	83 ec 04             	sub    $0x4,%esp
+  803fc7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fca:	89 da                	mov    %ebx,%edx
+  803fcc:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803fcf:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803fd6:	74 0c                	je     803fe4 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fd8:	89 d8                	mov    %ebx,%eax
+  803fda:	83 e0 01             	and    $0x1,%eax
+  803fdd:	09 d0                	or     %edx,%eax
+}
+  803fdf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fe2:	c9                   	leave
+  803fe3:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803fe4:	e8 6e cf ff ff       	call   800f57 <sys_cgetc>
+  803fe9:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fee:	89 da                	mov    %ebx,%edx
+  803ff0:	83 e2 04             	and    $0x4,%edx
+  803ff3:	85 c0                	test   %eax,%eax
+  803ff5:	74 e6                	je     803fdd <devcons_poll+0x1d>
+  803ff7:	eb df                	jmp    803fd8 <devcons_poll+0x18>
+
+00803ff9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803ff9:	55                   	push   %ebp
+  803ffa:	89 e5                	mov    %esp,%ebp
+  803ffc:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803fff:	68 4c 4e 80 00       	push   $0x804e4c
+  804004:	ff 75 0c             	push   0xc(%ebp)
+  804007:	e8 b5 cb ff ff       	call   800bc1 <strcpy>
+	return 0;
+}
+  80400c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804011:	c9                   	leave
+  804012:	c3                   	ret
+
+00804013 <devcons_write>:
+{
+  804013:	55                   	push   %ebp
+  804014:	89 e5                	mov    %esp,%ebp
+  804016:	57                   	push   %edi
+  804017:	56                   	push   %esi
+  804018:	53                   	push   %ebx
+  804019:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80401f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804022:	85 ff                	test   %edi,%edi
+  804024:	74 51                	je     804077 <devcons_write+0x64>
+  804026:	be 00 00 00 00       	mov    $0x0,%esi
+  80402b:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804030:	89 fb                	mov    %edi,%ebx
+  804032:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804034:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804039:	39 d3                	cmp    %edx,%ebx
+  80403b:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80403e:	83 ec 04             	sub    $0x4,%esp
+  804041:	53                   	push   %ebx
+  804042:	03 45 0c             	add    0xc(%ebp),%eax
+  804045:	50                   	push   %eax
+  804046:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80404c:	50                   	push   %eax
+  80404d:	e8 1f cd ff ff       	call   800d71 <memmove>
+		sys_cputs(buf, m);
+  804052:	83 c4 08             	add    $0x8,%esp
+  804055:	53                   	push   %ebx
+  804056:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80405c:	50                   	push   %eax
+  80405d:	e8 d7 ce ff ff       	call   800f39 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804062:	01 de                	add    %ebx,%esi
+  804064:	89 f0                	mov    %esi,%eax
+  804066:	83 c4 10             	add    $0x10,%esp
+  804069:	39 fe                	cmp    %edi,%esi
+  80406b:	72 c3                	jb     804030 <devcons_write+0x1d>
+}
+  80406d:	89 f0                	mov    %esi,%eax
+  80406f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804072:	5b                   	pop    %ebx
+  804073:	5e                   	pop    %esi
+  804074:	5f                   	pop    %edi
+  804075:	5d                   	pop    %ebp
+  804076:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  804077:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80407c:	eb ef                	jmp    80406d <devcons_write+0x5a>
+
+0080407e <devcons_read>:
+{
+  80407e:	55                   	push   %ebp
+  80407f:	89 e5                	mov    %esp,%ebp
+  804081:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804084:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804089:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80408d:	74 36                	je     8040c5 <devcons_read+0x47>
+	c = cons_peek;
+  80408f:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  804094:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  80409b:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80409e:	85 c0                	test   %eax,%eax
+  8040a0:	75 10                	jne    8040b2 <devcons_read+0x34>
+  8040a2:	e8 b0 ce ff ff       	call   800f57 <sys_cgetc>
+  8040a7:	85 c0                	test   %eax,%eax
+  8040a9:	75 07                	jne    8040b2 <devcons_read+0x34>
+		sys_yield();
+  8040ab:	e8 26 cf ff ff       	call   800fd6 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8040b0:	eb f0                	jmp    8040a2 <devcons_read+0x24>
+	if (c < 0)
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	78 0f                	js     8040c5 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8040b6:	83 f8 04             	cmp    $0x4,%eax
+  8040b9:	74 0c                	je     8040c7 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8040bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8040be:	88 02                	mov    %al,(%edx)
+	return 1;
+  8040c0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8040c5:	c9                   	leave
+  8040c6:	c3                   	ret
+		return 0;
+  8040c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040cc:	eb f7                	jmp    8040c5 <devcons_read+0x47>
+
+008040ce <cputchar>:
+{
+  8040ce:	55                   	push   %ebp
+  8040cf:	89 e5                	mov    %esp,%ebp
+  8040d1:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8040d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040d7:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8040da:	6a 01                	push   $0x1
+  8040dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040df:	50                   	push   %eax
+  8040e0:	e8 54 ce ff ff       	call   800f39 <sys_cputs>
+}
+  8040e5:	83 c4 10             	add    $0x10,%esp
+  8040e8:	c9                   	leave
+  8040e9:	c3                   	ret
+
+008040ea <getchar>:
+{
+  8040ea:	55                   	push   %ebp
+  8040eb:	89 e5                	mov    %esp,%ebp
+  8040ed:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8040f0:	6a 01                	push   $0x1
+  8040f2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040f5:	50                   	push   %eax
+  8040f6:	6a 00                	push   $0x0
+  8040f8:	e8 d2 dd ff ff       	call   801ecf <read>
+	if (r < 0)
+  8040fd:	83 c4 10             	add    $0x10,%esp
+  804100:	85 c0                	test   %eax,%eax
+  804102:	78 06                	js     80410a <getchar+0x20>
+	if (r < 1)
+  804104:	74 06                	je     80410c <getchar+0x22>
+	return c;
+  804106:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80410a:	c9                   	leave
+  80410b:	c3                   	ret
+		return -E_EOF;
+  80410c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804111:	eb f7                	jmp    80410a <getchar+0x20>
+
+00804113 <iscons>:
+{
+  804113:	55                   	push   %ebp
+  804114:	89 e5                	mov    %esp,%ebp
+  804116:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804119:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80411c:	50                   	push   %eax
+  80411d:	ff 75 08             	push   0x8(%ebp)
+  804120:	e8 26 db ff ff       	call   801c4b <fd_lookup>
+  804125:	83 c4 10             	add    $0x10,%esp
+  804128:	85 c0                	test   %eax,%eax
+  80412a:	78 11                	js     80413d <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80412c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80412f:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804135:	39 10                	cmp    %edx,(%eax)
+  804137:	0f 94 c0             	sete   %al
+  80413a:	0f b6 c0             	movzbl %al,%eax
+}
+  80413d:	c9                   	leave
+  80413e:	c3                   	ret
+
+0080413f <opencons>:
+{
+  80413f:	55                   	push   %ebp
+  804140:	89 e5                	mov    %esp,%ebp
+  804142:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804145:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804148:	50                   	push   %eax
+  804149:	e8 ad da ff ff       	call   801bfb <fd_alloc>
+  80414e:	83 c4 10             	add    $0x10,%esp
+  804151:	85 c0                	test   %eax,%eax
+  804153:	78 3a                	js     80418f <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804155:	83 ec 04             	sub    $0x4,%esp
+  804158:	68 07 04 00 00       	push   $0x407
+  80415d:	ff 75 f4             	push   -0xc(%ebp)
+  804160:	6a 00                	push   $0x0
+  804162:	e8 8e ce ff ff       	call   800ff5 <sys_page_alloc>
+  804167:	83 c4 10             	add    $0x10,%esp
+  80416a:	85 c0                	test   %eax,%eax
+  80416c:	78 21                	js     80418f <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80416e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804171:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  804177:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804179:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80417c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804183:	83 ec 0c             	sub    $0xc,%esp
+  804186:	50                   	push   %eax
+  804187:	e8 48 da ff ff       	call   801bd4 <fd2num>
+  80418c:	83 c4 10             	add    $0x10,%esp
+}
+  80418f:	c9                   	leave
+  804190:	c3                   	ret
+
+00804191 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804191:	55                   	push   %ebp
+  804192:	89 e5                	mov    %esp,%ebp
+  804194:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804197:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80419e:	74 0a                	je     8041aa <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8041a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041a3:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  8041a8:	c9                   	leave
+  8041a9:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8041aa:	83 ec 04             	sub    $0x4,%esp
+  8041ad:	6a 07                	push   $0x7
+  8041af:	68 00 f0 bf ee       	push   $0xeebff000
+  8041b4:	6a 00                	push   $0x0
+  8041b6:	e8 3a ce ff ff       	call   800ff5 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8041bb:	83 c4 08             	add    $0x8,%esp
+  8041be:	68 cf 41 80 00       	push   $0x8041cf
+  8041c3:	6a 00                	push   $0x0
+  8041c5:	e8 76 cf ff ff       	call   801140 <sys_env_set_pgfault_upcall>
+  8041ca:	83 c4 10             	add    $0x10,%esp
+  8041cd:	eb d1                	jmp    8041a0 <set_pgfault_handler+0xf>
+
+008041cf <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8041cf:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8041d0:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8041d5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8041d7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8041da:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8041de:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  8041e1:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8041e5:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8041e7:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8041eb:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8041ee:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8041ef:	83 c4 04             	add    $0x4,%esp
+	popf
+  8041f2:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8041f3:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8041f4:	c3                   	ret
+
+008041f5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8041f5:	55                   	push   %ebp
+  8041f6:	89 e5                	mov    %esp,%ebp
+  8041f8:	56                   	push   %esi
+  8041f9:	53                   	push   %ebx
+  8041fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8041fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804200:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804203:	85 c0                	test   %eax,%eax
+  804205:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  80420a:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80420d:	83 ec 0c             	sub    $0xc,%esp
+  804210:	50                   	push   %eax
+  804211:	e8 8f cf ff ff       	call   8011a5 <sys_ipc_recv>
+  804216:	83 c4 10             	add    $0x10,%esp
+  804219:	85 c0                	test   %eax,%eax
+  80421b:	0f 88 8b 00 00 00    	js     8042ac <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804221:	85 f6                	test   %esi,%esi
+  804223:	74 2a                	je     80424f <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804225:	89 e2                	mov    %esp,%edx
+  804227:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80422c:	29 d0                	sub    %edx,%eax
+  80422e:	89 c2                	mov    %eax,%edx
+  804230:	c1 ea 0f             	shr    $0xf,%edx
+  804233:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423d:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804240:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804247:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80424d:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80424f:	85 db                	test   %ebx,%ebx
+  804251:	74 2a                	je     80427d <ipc_recv+0x88>
+  804253:	89 e2                	mov    %esp,%edx
+  804255:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80425a:	29 d0                	sub    %edx,%eax
+  80425c:	89 c2                	mov    %eax,%edx
+  80425e:	c1 ea 0f             	shr    $0xf,%edx
+  804261:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80426b:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80426e:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804275:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80427b:	89 03                	mov    %eax,(%ebx)
+  80427d:	89 e2                	mov    %esp,%edx
+  80427f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804284:	29 d0                	sub    %edx,%eax
+  804286:	89 c2                	mov    %eax,%edx
+  804288:	c1 ea 0f             	shr    $0xf,%edx
+  80428b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804290:	b8 00 00 00 00       	mov    $0x0,%eax
+  804295:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804298:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80429f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8042a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8042a8:	5b                   	pop    %ebx
+  8042a9:	5e                   	pop    %esi
+  8042aa:	5d                   	pop    %ebp
+  8042ab:	c3                   	ret
+		if(from_env_store != NULL)
+  8042ac:	85 f6                	test   %esi,%esi
+  8042ae:	74 06                	je     8042b6 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8042b0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8042b6:	85 db                	test   %ebx,%ebx
+  8042b8:	74 eb                	je     8042a5 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8042ba:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8042c0:	eb e3                	jmp    8042a5 <ipc_recv+0xb0>
+
+008042c2 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8042c2:	55                   	push   %ebp
+  8042c3:	89 e5                	mov    %esp,%ebp
+  8042c5:	57                   	push   %edi
+  8042c6:	56                   	push   %esi
+  8042c7:	53                   	push   %ebx
+  8042c8:	83 ec 14             	sub    $0x14,%esp
+  8042cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042d1:	8b 75 14             	mov    0x14(%ebp),%esi
+  8042d4:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8042d7:	85 c0                	test   %eax,%eax
+  8042d9:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8042de:	0f 44 c2             	cmove  %edx,%eax
+  8042e1:	ff 75 10             	push   0x10(%ebp)
+  8042e4:	50                   	push   %eax
+  8042e5:	e8 1d cf ff ff       	call   801207 <sys_ipc_recv_pages>
+  8042ea:	83 c4 10             	add    $0x10,%esp
+  8042ed:	85 c0                	test   %eax,%eax
+  8042ef:	0f 88 ba 00 00 00    	js     8043af <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8042f5:	85 ff                	test   %edi,%edi
+  8042f7:	74 2a                	je     804323 <ipc_recv_pages+0x61>
+  8042f9:	89 e2                	mov    %esp,%edx
+  8042fb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804300:	29 d0                	sub    %edx,%eax
+  804302:	89 c2                	mov    %eax,%edx
+  804304:	c1 ea 0f             	shr    $0xf,%edx
+  804307:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80430c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804311:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804314:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80431b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804321:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804323:	85 f6                	test   %esi,%esi
+  804325:	74 2a                	je     804351 <ipc_recv_pages+0x8f>
+  804327:	89 e2                	mov    %esp,%edx
+  804329:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80432e:	29 d0                	sub    %edx,%eax
+  804330:	89 c2                	mov    %eax,%edx
+  804332:	c1 ea 0f             	shr    $0xf,%edx
+  804335:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80433a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433f:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804342:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804349:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80434f:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804351:	85 db                	test   %ebx,%ebx
+  804353:	74 2a                	je     80437f <ipc_recv_pages+0xbd>
+  804355:	89 e2                	mov    %esp,%edx
+  804357:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80435c:	29 d0                	sub    %edx,%eax
+  80435e:	89 c2                	mov    %eax,%edx
+  804360:	c1 ea 0f             	shr    $0xf,%edx
+  804363:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80436d:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804370:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804377:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80437d:	89 03                	mov    %eax,(%ebx)
+  80437f:	89 e2                	mov    %esp,%edx
+  804381:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804386:	29 d0                	sub    %edx,%eax
+  804388:	89 c2                	mov    %eax,%edx
+  80438a:	c1 ea 0f             	shr    $0xf,%edx
+  80438d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804392:	b8 00 00 00 00       	mov    $0x0,%eax
+  804397:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80439a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8043a1:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8043a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043aa:	5b                   	pop    %ebx
+  8043ab:	5e                   	pop    %esi
+  8043ac:	5f                   	pop    %edi
+  8043ad:	5d                   	pop    %ebp
+  8043ae:	c3                   	ret
+		if (from_env_store)
+  8043af:	85 ff                	test   %edi,%edi
+  8043b1:	74 06                	je     8043b9 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8043b3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8043b9:	85 f6                	test   %esi,%esi
+  8043bb:	74 06                	je     8043c3 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8043bd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8043c3:	85 db                	test   %ebx,%ebx
+  8043c5:	74 e0                	je     8043a7 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8043c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8043cd:	eb d8                	jmp    8043a7 <ipc_recv_pages+0xe5>
+
+008043cf <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8043cf:	55                   	push   %ebp
+  8043d0:	89 e5                	mov    %esp,%ebp
+  8043d2:	57                   	push   %edi
+  8043d3:	56                   	push   %esi
+  8043d4:	53                   	push   %ebx
+  8043d5:	83 ec 1c             	sub    $0x1c,%esp
+  8043d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8043db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043de:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8043e4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8043e8:	75 2b                	jne    804415 <ipc_try_send_pages+0x46>
+  8043ea:	89 e2                	mov    %esp,%edx
+  8043ec:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043f1:	29 d0                	sub    %edx,%eax
+  8043f3:	89 c2                	mov    %eax,%edx
+  8043f5:	c1 ea 0f             	shr    $0xf,%edx
+  8043f8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804402:	0f 42 c2             	cmovb  %edx,%eax
+  804405:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80440c:	8b 70 48             	mov    0x48(%eax),%esi
+  80440f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804415:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  80441b:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804423:	85 ff                	test   %edi,%edi
+  804425:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80442a:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80442d:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804433:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804439:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80443f:	83 ec 0c             	sub    $0xc,%esp
+  804442:	ff 75 14             	push   0x14(%ebp)
+  804445:	ff 75 18             	push   0x18(%ebp)
+  804448:	57                   	push   %edi
+  804449:	ff 75 0c             	push   0xc(%ebp)
+  80444c:	ff 75 08             	push   0x8(%ebp)
+  80444f:	e8 92 cd ff ff       	call   8011e6 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804454:	83 c4 20             	add    $0x20,%esp
+  804457:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80445a:	75 21                	jne    80447d <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80445c:	83 ec 04             	sub    $0x4,%esp
+  80445f:	6a ff                	push   $0xffffffff
+  804461:	53                   	push   %ebx
+  804462:	ff 75 e4             	push   -0x1c(%ebp)
+  804465:	e8 89 cf ff ff       	call   8013f3 <sys_futex_wait>
+  80446a:	83 c4 10             	add    $0x10,%esp
+  80446d:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804470:	74 c7                	je     804439 <ipc_try_send_pages+0x6a>
+  804472:	85 c0                	test   %eax,%eax
+  804474:	79 c3                	jns    804439 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804476:	e8 5b cb ff ff       	call   800fd6 <sys_yield>
+  80447b:	eb bc                	jmp    804439 <ipc_try_send_pages+0x6a>
+	}
+}
+  80447d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804480:	5b                   	pop    %ebx
+  804481:	5e                   	pop    %esi
+  804482:	5f                   	pop    %edi
+  804483:	5d                   	pop    %ebp
+  804484:	c3                   	ret
+
+00804485 <ipc_send>:
+{
+  804485:	55                   	push   %ebp
+  804486:	89 e5                	mov    %esp,%ebp
+  804488:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80448b:	ff 75 14             	push   0x14(%ebp)
+  80448e:	6a 01                	push   $0x1
+  804490:	ff 75 10             	push   0x10(%ebp)
+  804493:	ff 75 0c             	push   0xc(%ebp)
+  804496:	ff 75 08             	push   0x8(%ebp)
+  804499:	e8 31 ff ff ff       	call   8043cf <ipc_try_send_pages>
+  80449e:	83 c4 20             	add    $0x20,%esp
+  8044a1:	85 c0                	test   %eax,%eax
+  8044a3:	78 02                	js     8044a7 <ipc_send+0x22>
+}
+  8044a5:	c9                   	leave
+  8044a6:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8044a7:	50                   	push   %eax
+  8044a8:	68 58 4e 80 00       	push   $0x804e58
+  8044ad:	6a 3f                	push   $0x3f
+  8044af:	68 6d 4e 80 00       	push   $0x804e6d
+  8044b4:	e8 36 bf ff ff       	call   8003ef <_panic>
+
+008044b9 <ipc_send_pages>:
+{
+  8044b9:	55                   	push   %ebp
+  8044ba:	89 e5                	mov    %esp,%ebp
+  8044bc:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8044bf:	ff 75 18             	push   0x18(%ebp)
+  8044c2:	ff 75 14             	push   0x14(%ebp)
+  8044c5:	ff 75 10             	push   0x10(%ebp)
+  8044c8:	ff 75 0c             	push   0xc(%ebp)
+  8044cb:	ff 75 08             	push   0x8(%ebp)
+  8044ce:	e8 fc fe ff ff       	call   8043cf <ipc_try_send_pages>
+  8044d3:	83 c4 20             	add    $0x20,%esp
+  8044d6:	85 c0                	test   %eax,%eax
+  8044d8:	78 02                	js     8044dc <ipc_send_pages+0x23>
+}
+  8044da:	c9                   	leave
+  8044db:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8044dc:	50                   	push   %eax
+  8044dd:	68 77 4e 80 00       	push   $0x804e77
+  8044e2:	6a 64                	push   $0x64
+  8044e4:	68 6d 4e 80 00       	push   $0x804e6d
+  8044e9:	e8 01 bf ff ff       	call   8003ef <_panic>
+
+008044ee <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044ee:	55                   	push   %ebp
+  8044ef:	89 e5                	mov    %esp,%ebp
+  8044f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044f4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8044f9:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8044ff:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804505:	8b 52 50             	mov    0x50(%edx),%edx
+  804508:	39 ca                	cmp    %ecx,%edx
+  80450a:	74 11                	je     80451d <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80450c:	83 c0 01             	add    $0x1,%eax
+  80450f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804514:	75 e3                	jne    8044f9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451b:	eb 0e                	jmp    80452b <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80451d:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804523:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804528:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80452b:	5d                   	pop    %ebp
+  80452c:	c3                   	ret
+
+0080452d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80452d:	55                   	push   %ebp
+  80452e:	89 e5                	mov    %esp,%ebp
+  804530:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804533:	89 c2                	mov    %eax,%edx
+  804535:	c1 ea 16             	shr    $0x16,%edx
+  804538:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80453f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804544:	f6 c1 01             	test   $0x1,%cl
+  804547:	74 1e                	je     804567 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804549:	c1 e8 0c             	shr    $0xc,%eax
+  80454c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804553:	a8 01                	test   $0x1,%al
+  804555:	74 10                	je     804567 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804557:	c1 e8 0c             	shr    $0xc,%eax
+  80455a:	c1 e0 04             	shl    $0x4,%eax
+  80455d:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804564:	0f b7 d2             	movzwl %dx,%edx
+}
+  804567:	89 d0                	mov    %edx,%eax
+  804569:	5d                   	pop    %ebp
+  80456a:	c3                   	ret
+
+0080456b <__udivdi3>:
+  80456b:	57                   	push   %edi
+  80456c:	56                   	push   %esi
+  80456d:	53                   	push   %ebx
+  80456e:	83 ec 20             	sub    $0x20,%esp
+  804571:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804575:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804579:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80457d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804581:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804585:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804589:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80458d:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804591:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80459b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8045a7:	00 
+  8045a8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8045af:	00 
+  8045b0:	eb 08                	jmp    8045ba <__udivdi3+0x4f>
+  8045b2:	83 e9 01             	sub    $0x1,%ecx
+  8045b5:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8045b8:	74 68                	je     804622 <__udivdi3+0xb7>
+  8045ba:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8045be:	01 c0                	add    %eax,%eax
+  8045c0:	89 c6                	mov    %eax,%esi
+  8045c2:	89 d7                	mov    %edx,%edi
+  8045c4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8045c8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8045cc:	0f ad d0             	shrd   %cl,%edx,%eax
+  8045cf:	d3 ea                	shr    %cl,%edx
+  8045d1:	f6 c1 20             	test   $0x20,%cl
+  8045d4:	74 04                	je     8045da <__udivdi3+0x6f>
+  8045d6:	89 d0                	mov    %edx,%eax
+  8045d8:	31 d2                	xor    %edx,%edx
+  8045da:	83 e0 01             	and    $0x1,%eax
+  8045dd:	89 04 24             	mov    %eax,(%esp)
+  8045e0:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8045e7:	00 
+  8045e8:	8b 04 24             	mov    (%esp),%eax
+  8045eb:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8045ef:	09 f0                	or     %esi,%eax
+  8045f1:	09 fa                	or     %edi,%edx
+  8045f3:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8045f7:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8045fb:	39 f0                	cmp    %esi,%eax
+  8045fd:	89 d3                	mov    %edx,%ebx
+  8045ff:	19 fb                	sbb    %edi,%ebx
+  804601:	72 af                	jb     8045b2 <__udivdi3+0x47>
+  804603:	29 f0                	sub    %esi,%eax
+  804605:	19 fa                	sbb    %edi,%edx
+  804607:	89 cf                	mov    %ecx,%edi
+  804609:	c1 ef 05             	shr    $0x5,%edi
+  80460c:	83 e7 01             	and    $0x1,%edi
+  80460f:	89 fe                	mov    %edi,%esi
+  804611:	83 f6 01             	xor    $0x1,%esi
+  804614:	d3 e6                	shl    %cl,%esi
+  804616:	d3 e7                	shl    %cl,%edi
+  804618:	09 74 24 18          	or     %esi,0x18(%esp)
+  80461c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804620:	eb 90                	jmp    8045b2 <__udivdi3+0x47>
+  804622:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804626:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80462a:	83 c4 20             	add    $0x20,%esp
+  80462d:	5b                   	pop    %ebx
+  80462e:	5e                   	pop    %esi
+  80462f:	5f                   	pop    %edi
+  804630:	c3                   	ret
+
+00804631 <__umoddi3>:
+  804631:	57                   	push   %edi
+  804632:	56                   	push   %esi
+  804633:	53                   	push   %ebx
+  804634:	83 ec 08             	sub    $0x8,%esp
+  804637:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80463b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80463f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804643:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804647:	57                   	push   %edi
+  804648:	56                   	push   %esi
+  804649:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80464d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804651:	52                   	push   %edx
+  804652:	50                   	push   %eax
+  804653:	e8 13 ff ff ff       	call   80456b <__udivdi3>
+  804658:	89 c3                	mov    %eax,%ebx
+  80465a:	0f af d6             	imul   %esi,%edx
+  80465d:	89 f9                	mov    %edi,%ecx
+  80465f:	0f af cb             	imul   %ebx,%ecx
+  804662:	01 d1                	add    %edx,%ecx
+  804664:	89 d8                	mov    %ebx,%eax
+  804666:	f7 e6                	mul    %esi
+  804668:	89 c6                	mov    %eax,%esi
+  80466a:	89 d7                	mov    %edx,%edi
+  80466c:	01 cf                	add    %ecx,%edi
+  80466e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804672:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804676:	29 f0                	sub    %esi,%eax
+  804678:	19 fa                	sbb    %edi,%edx
+  80467a:	83 c4 18             	add    $0x18,%esp
+  80467d:	5b                   	pop    %ebx
+  80467e:	5e                   	pop    %esi
+  80467f:	5f                   	pop    %edi
+  804680:	c3                   	ret
+
+00804681 <__divdi3>:
+  804681:	53                   	push   %ebx
+  804682:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804686:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80468a:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  80468e:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804692:	85 d2                	test   %edx,%edx
+  804694:	78 12                	js     8046a8 <__divdi3+0x27>
+  804696:	85 db                	test   %ebx,%ebx
+  804698:	78 2e                	js     8046c8 <__divdi3+0x47>
+  80469a:	53                   	push   %ebx
+  80469b:	51                   	push   %ecx
+  80469c:	52                   	push   %edx
+  80469d:	50                   	push   %eax
+  80469e:	e8 c8 fe ff ff       	call   80456b <__udivdi3>
+  8046a3:	83 c4 10             	add    $0x10,%esp
+  8046a6:	eb 1e                	jmp    8046c6 <__divdi3+0x45>
+  8046a8:	f7 d8                	neg    %eax
+  8046aa:	83 d2 00             	adc    $0x0,%edx
+  8046ad:	f7 da                	neg    %edx
+  8046af:	85 db                	test   %ebx,%ebx
+  8046b1:	78 2a                	js     8046dd <__divdi3+0x5c>
+  8046b3:	53                   	push   %ebx
+  8046b4:	51                   	push   %ecx
+  8046b5:	52                   	push   %edx
+  8046b6:	50                   	push   %eax
+  8046b7:	e8 af fe ff ff       	call   80456b <__udivdi3>
+  8046bc:	83 c4 10             	add    $0x10,%esp
+  8046bf:	f7 d8                	neg    %eax
+  8046c1:	83 d2 00             	adc    $0x0,%edx
+  8046c4:	f7 da                	neg    %edx
+  8046c6:	5b                   	pop    %ebx
+  8046c7:	c3                   	ret
+  8046c8:	f7 d9                	neg    %ecx
+  8046ca:	83 d3 00             	adc    $0x0,%ebx
+  8046cd:	f7 db                	neg    %ebx
+  8046cf:	53                   	push   %ebx
+  8046d0:	51                   	push   %ecx
+  8046d1:	52                   	push   %edx
+  8046d2:	50                   	push   %eax
+  8046d3:	e8 93 fe ff ff       	call   80456b <__udivdi3>
+  8046d8:	83 c4 10             	add    $0x10,%esp
+  8046db:	eb e2                	jmp    8046bf <__divdi3+0x3e>
+  8046dd:	f7 d9                	neg    %ecx
+  8046df:	83 d3 00             	adc    $0x0,%ebx
+  8046e2:	f7 db                	neg    %ebx
+  8046e4:	53                   	push   %ebx
+  8046e5:	51                   	push   %ecx
+  8046e6:	52                   	push   %edx
+  8046e7:	50                   	push   %eax
+  8046e8:	e8 7e fe ff ff       	call   80456b <__udivdi3>
+  8046ed:	83 c4 10             	add    $0x10,%esp
+  8046f0:	eb d4                	jmp    8046c6 <__divdi3+0x45>
+
+008046f2 <__moddi3>:
+  8046f2:	57                   	push   %edi
+  8046f3:	56                   	push   %esi
+  8046f4:	53                   	push   %ebx
+  8046f5:	83 ec 08             	sub    $0x8,%esp
+  8046f8:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046fc:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804700:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804704:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804708:	57                   	push   %edi
+  804709:	56                   	push   %esi
+  80470a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80470e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804712:	52                   	push   %edx
+  804713:	50                   	push   %eax
+  804714:	e8 68 ff ff ff       	call   804681 <__divdi3>
+  804719:	89 c3                	mov    %eax,%ebx
+  80471b:	0f af d6             	imul   %esi,%edx
+  80471e:	89 f9                	mov    %edi,%ecx
+  804720:	0f af cb             	imul   %ebx,%ecx
+  804723:	01 d1                	add    %edx,%ecx
+  804725:	89 d8                	mov    %ebx,%eax
+  804727:	f7 e6                	mul    %esi
+  804729:	89 c6                	mov    %eax,%esi
+  80472b:	89 d7                	mov    %edx,%edi
+  80472d:	01 cf                	add    %ecx,%edi
+  80472f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804733:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804737:	29 f0                	sub    %esi,%eax
+  804739:	19 fa                	sbb    %edi,%edx
+  80473b:	83 c4 18             	add    $0x18,%esp
+  80473e:	5b                   	pop    %ebx
+  80473f:	5e                   	pop    %esi
+  804740:	5f                   	pop    %edi
+  804741:	c3                   	ret
@@ -0,0 +1,9140 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e8 01 00 00       	call   800219 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003d:	68 c0 45 80 00       	push   $0x8045c0
+  800042:	e8 54 03 00 00       	call   80039b <cprintf>
+	if ((r = pipe(p)) < 0)
+  800047:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80004a:	89 04 24             	mov    %eax,(%esp)
+  80004d:	e8 a7 3c 00 00       	call   803cf9 <pipe>
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	85 c0                	test   %eax,%eax
+  800057:	0f 88 fa 00 00 00    	js     800157 <umain+0x122>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  80005d:	e8 6c 14 00 00       	call   8014ce <fork>
+  800062:	89 c6                	mov    %eax,%esi
+  800064:	85 c0                	test   %eax,%eax
+  800066:	0f 88 fd 00 00 00    	js     800169 <umain+0x134>
+		panic("fork: %e", r);
+	if (r == 0) {
+  80006c:	0f 84 09 01 00 00    	je     80017b <umain+0x146>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800072:	83 ec 08             	sub    $0x8,%esp
+  800075:	56                   	push   %esi
+  800076:	68 11 46 80 00       	push   $0x804611
+  80007b:	e8 1b 03 00 00       	call   80039b <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800080:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800086:	83 c4 08             	add    $0x8,%esp
+  800089:	69 de bc 00 00 00    	imul   $0xbc,%esi,%ebx
+  80008f:	89 d8                	mov    %ebx,%eax
+  800091:	c1 f8 02             	sar    $0x2,%eax
+  800094:	69 c0 cf 46 7d 67    	imul   $0x677d46cf,%eax,%eax
+  80009a:	50                   	push   %eax
+  80009b:	68 1c 46 80 00       	push   $0x80461c
+  8000a0:	e8 f6 02 00 00       	call   80039b <cprintf>
+	dup(p[0], 10);
+  8000a5:	83 c4 08             	add    $0x8,%esp
+  8000a8:	6a 0a                	push   $0xa
+  8000aa:	ff 75 f0             	push   -0x10(%ebp)
+  8000ad:	e8 3c 1f 00 00       	call   801fee <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  8000b2:	8b 83 54 00 c0 ee    	mov    -0x113fffac(%ebx),%eax
+  8000b8:	83 c4 10             	add    $0x10,%esp
+  8000bb:	83 f8 02             	cmp    $0x2,%eax
+  8000be:	75 24                	jne    8000e4 <umain+0xaf>
+  8000c0:	69 de bc 00 00 00    	imul   $0xbc,%esi,%ebx
+  8000c6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+		dup(p[0], 10);
+  8000cc:	83 ec 08             	sub    $0x8,%esp
+  8000cf:	6a 0a                	push   $0xa
+  8000d1:	ff 75 f0             	push   -0x10(%ebp)
+  8000d4:	e8 15 1f 00 00       	call   801fee <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  8000d9:	8b 43 54             	mov    0x54(%ebx),%eax
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	83 f8 02             	cmp    $0x2,%eax
+  8000e2:	74 e8                	je     8000cc <umain+0x97>
+
+	cprintf("child done with loop\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 27 46 80 00       	push   $0x804627
+  8000ec:	e8 aa 02 00 00       	call   80039b <cprintf>
+	if (pipeisclosed(p[0]))
+  8000f1:	83 c4 04             	add    $0x4,%esp
+  8000f4:	ff 75 f0             	push   -0x10(%ebp)
+  8000f7:	e8 47 3d 00 00       	call   803e43 <pipeisclosed>
+  8000fc:	83 c4 10             	add    $0x10,%esp
+  8000ff:	85 c0                	test   %eax,%eax
+  800101:	0f 85 d2 00 00 00    	jne    8001d9 <umain+0x1a4>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800107:	83 ec 08             	sub    $0x8,%esp
+  80010a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80010d:	50                   	push   %eax
+  80010e:	ff 75 f0             	push   -0x10(%ebp)
+  800111:	e8 3e 1d 00 00       	call   801e54 <fd_lookup>
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	85 c0                	test   %eax,%eax
+  80011b:	0f 88 cc 00 00 00    	js     8001ed <umain+0x1b8>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  800121:	83 ec 0c             	sub    $0xc,%esp
+  800124:	ff 75 ec             	push   -0x14(%ebp)
+  800127:	e8 c1 1c 00 00       	call   801ded <fd2data>
+	if (pageref(va) != 3+1)
+  80012c:	89 04 24             	mov    %eax,(%esp)
+  80012f:	e8 1b 26 00 00       	call   80274f <pageref>
+  800134:	83 c4 10             	add    $0x10,%esp
+  800137:	83 f8 04             	cmp    $0x4,%eax
+  80013a:	0f 84 bf 00 00 00    	je     8001ff <umain+0x1ca>
+		cprintf("\nchild detected race\n");
+  800140:	83 ec 0c             	sub    $0xc,%esp
+  800143:	68 55 46 80 00       	push   $0x804655
+  800148:	e8 4e 02 00 00       	call   80039b <cprintf>
+  80014d:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  800150:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800153:	5b                   	pop    %ebx
+  800154:	5e                   	pop    %esi
+  800155:	5d                   	pop    %ebp
+  800156:	c3                   	ret
+		panic("pipe: %e", r);
+  800157:	50                   	push   %eax
+  800158:	68 d9 45 80 00       	push   $0x8045d9
+  80015d:	6a 0d                	push   $0xd
+  80015f:	68 e2 45 80 00       	push   $0x8045e2
+  800164:	e8 57 01 00 00       	call   8002c0 <_panic>
+		panic("fork: %e", r);
+  800169:	50                   	push   %eax
+  80016a:	68 9d 4a 80 00       	push   $0x804a9d
+  80016f:	6a 10                	push   $0x10
+  800171:	68 e2 45 80 00       	push   $0x8045e2
+  800176:	e8 45 01 00 00       	call   8002c0 <_panic>
+		close(p[1]);
+  80017b:	83 ec 0c             	sub    $0xc,%esp
+  80017e:	ff 75 f4             	push   -0xc(%ebp)
+  800181:	e8 13 1e 00 00       	call   801f99 <close>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	bb c8 00 00 00       	mov    $0xc8,%ebx
+  80018e:	eb 0a                	jmp    80019a <umain+0x165>
+			sys_yield();
+  800190:	e8 12 0d 00 00       	call   800ea7 <sys_yield>
+		for (i=0; i<max; i++) {
+  800195:	83 eb 01             	sub    $0x1,%ebx
+  800198:	74 29                	je     8001c3 <umain+0x18e>
+			if(pipeisclosed(p[0])){
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	ff 75 f0             	push   -0x10(%ebp)
+  8001a0:	e8 9e 3c 00 00       	call   803e43 <pipeisclosed>
+  8001a5:	83 c4 10             	add    $0x10,%esp
+  8001a8:	85 c0                	test   %eax,%eax
+  8001aa:	74 e4                	je     800190 <umain+0x15b>
+				cprintf("RACE: pipe appears closed\n");
+  8001ac:	83 ec 0c             	sub    $0xc,%esp
+  8001af:	68 f6 45 80 00       	push   $0x8045f6
+  8001b4:	e8 e2 01 00 00       	call   80039b <cprintf>
+				exit();
+  8001b9:	e8 e8 00 00 00       	call   8002a6 <exit>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	eb cd                	jmp    800190 <umain+0x15b>
+		ipc_recv(0,0,0);
+  8001c3:	83 ec 04             	sub    $0x4,%esp
+  8001c6:	6a 00                	push   $0x0
+  8001c8:	6a 00                	push   $0x0
+  8001ca:	6a 00                	push   $0x0
+  8001cc:	e8 d4 18 00 00       	call   801aa5 <ipc_recv>
+  8001d1:	83 c4 10             	add    $0x10,%esp
+  8001d4:	e9 99 fe ff ff       	jmp    800072 <umain+0x3d>
+		panic("somehow the other end of p[0] got closed!");
+  8001d9:	83 ec 04             	sub    $0x4,%esp
+  8001dc:	68 80 46 80 00       	push   $0x804680
+  8001e1:	6a 3a                	push   $0x3a
+  8001e3:	68 e2 45 80 00       	push   $0x8045e2
+  8001e8:	e8 d3 00 00 00       	call   8002c0 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001ed:	50                   	push   %eax
+  8001ee:	68 3d 46 80 00       	push   $0x80463d
+  8001f3:	6a 3c                	push   $0x3c
+  8001f5:	68 e2 45 80 00       	push   $0x8045e2
+  8001fa:	e8 c1 00 00 00       	call   8002c0 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001ff:	83 ec 08             	sub    $0x8,%esp
+  800202:	68 c8 00 00 00       	push   $0xc8
+  800207:	68 6b 46 80 00       	push   $0x80466b
+  80020c:	e8 8a 01 00 00       	call   80039b <cprintf>
+  800211:	83 c4 10             	add    $0x10,%esp
+}
+  800214:	e9 37 ff ff ff       	jmp    800150 <umain+0x11b>
+
+00800219 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	56                   	push   %esi
+  80021d:	53                   	push   %ebx
+  80021e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800221:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800224:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800226:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80022b:	29 d0                	sub    %edx,%eax
+  80022d:	89 c2                	mov    %eax,%edx
+  80022f:	c1 ea 0f             	shr    $0xf,%edx
+  800232:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023c:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80023f:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800246:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80024a:	e8 39 0c 00 00       	call   800e88 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80024f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800254:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80025a:	89 e1                	mov    %esp,%ecx
+  80025c:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800261:	29 ca                	sub    %ecx,%edx
+  800263:	89 d1                	mov    %edx,%ecx
+  800265:	c1 e9 0f             	shr    $0xf,%ecx
+  800268:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80026e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800273:	0f 42 d1             	cmovb  %ecx,%edx
+  800276:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027b:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800282:	85 db                	test   %ebx,%ebx
+  800284:	7e 07                	jle    80028d <libmain+0x74>
+		binaryname = argv[0];
+  800286:	8b 06                	mov    (%esi),%eax
+  800288:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80028d:	83 ec 08             	sub    $0x8,%esp
+  800290:	56                   	push   %esi
+  800291:	53                   	push   %ebx
+  800292:	e8 9e fd ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800297:	e8 0a 00 00 00       	call   8002a6 <exit>
+}
+  80029c:	83 c4 10             	add    $0x10,%esp
+  80029f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a2:	5b                   	pop    %ebx
+  8002a3:	5e                   	pop    %esi
+  8002a4:	5d                   	pop    %ebp
+  8002a5:	c3                   	ret
+
+008002a6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a6:	55                   	push   %ebp
+  8002a7:	89 e5                	mov    %esp,%ebp
+  8002a9:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002ac:	e8 15 1d 00 00       	call   801fc6 <close_all>
+	sys_env_destroy(0);
+  8002b1:	83 ec 0c             	sub    $0xc,%esp
+  8002b4:	6a 00                	push   $0x0
+  8002b6:	e8 8c 0b 00 00       	call   800e47 <sys_env_destroy>
+}
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	c9                   	leave
+  8002bf:	c3                   	ret
+
+008002c0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002c0:	55                   	push   %ebp
+  8002c1:	89 e5                	mov    %esp,%ebp
+  8002c3:	56                   	push   %esi
+  8002c4:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c8:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002ce:	e8 b5 0b 00 00       	call   800e88 <sys_getenvid>
+  8002d3:	83 ec 0c             	sub    $0xc,%esp
+  8002d6:	ff 75 0c             	push   0xc(%ebp)
+  8002d9:	ff 75 08             	push   0x8(%ebp)
+  8002dc:	56                   	push   %esi
+  8002dd:	50                   	push   %eax
+  8002de:	68 b4 46 80 00       	push   $0x8046b4
+  8002e3:	e8 b3 00 00 00       	call   80039b <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e8:	83 c4 18             	add    $0x18,%esp
+  8002eb:	53                   	push   %ebx
+  8002ec:	ff 75 10             	push   0x10(%ebp)
+  8002ef:	e8 56 00 00 00       	call   80034a <vcprintf>
+	cprintf("\n");
+  8002f4:	c7 04 24 d7 45 80 00 	movl   $0x8045d7,(%esp)
+  8002fb:	e8 9b 00 00 00       	call   80039b <cprintf>
+  800300:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800303:	cc                   	int3
+	while (1)
+  800304:	eb fd                	jmp    800303 <_panic+0x43>
+
+00800306 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	53                   	push   %ebx
+  80030a:	83 ec 04             	sub    $0x4,%esp
+  80030d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800310:	8b 13                	mov    (%ebx),%edx
+  800312:	8d 42 01             	lea    0x1(%edx),%eax
+  800315:	89 03                	mov    %eax,(%ebx)
+  800317:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80031a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80031e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800323:	74 09                	je     80032e <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800325:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800329:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80032c:	c9                   	leave
+  80032d:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80032e:	83 ec 08             	sub    $0x8,%esp
+  800331:	68 ff 00 00 00       	push   $0xff
+  800336:	8d 43 08             	lea    0x8(%ebx),%eax
+  800339:	50                   	push   %eax
+  80033a:	e8 cb 0a 00 00       	call   800e0a <sys_cputs>
+		b->idx = 0;
+  80033f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800345:	83 c4 10             	add    $0x10,%esp
+  800348:	eb db                	jmp    800325 <putch+0x1f>
+
+0080034a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80034a:	55                   	push   %ebp
+  80034b:	89 e5                	mov    %esp,%ebp
+  80034d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800353:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80035a:	00 00 00 
+	b.cnt = 0;
+  80035d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800364:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800367:	ff 75 0c             	push   0xc(%ebp)
+  80036a:	ff 75 08             	push   0x8(%ebp)
+  80036d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800373:	50                   	push   %eax
+  800374:	68 06 03 80 00       	push   $0x800306
+  800379:	e8 1c 01 00 00       	call   80049a <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80037e:	83 c4 08             	add    $0x8,%esp
+  800381:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800387:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80038d:	50                   	push   %eax
+  80038e:	e8 77 0a 00 00       	call   800e0a <sys_cputs>
+
+	return b.cnt;
+}
+  800393:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800399:	c9                   	leave
+  80039a:	c3                   	ret
+
+0080039b <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80039b:	55                   	push   %ebp
+  80039c:	89 e5                	mov    %esp,%ebp
+  80039e:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8003a1:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003a4:	50                   	push   %eax
+  8003a5:	ff 75 08             	push   0x8(%ebp)
+  8003a8:	e8 9d ff ff ff       	call   80034a <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ad:	c9                   	leave
+  8003ae:	c3                   	ret
+
+008003af <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003af:	55                   	push   %ebp
+  8003b0:	89 e5                	mov    %esp,%ebp
+  8003b2:	57                   	push   %edi
+  8003b3:	56                   	push   %esi
+  8003b4:	53                   	push   %ebx
+  8003b5:	83 ec 1c             	sub    $0x1c,%esp
+  8003b8:	89 c3                	mov    %eax,%ebx
+  8003ba:	89 d6                	mov    %edx,%esi
+  8003bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003c2:	89 d1                	mov    %edx,%ecx
+  8003c4:	89 c2                	mov    %eax,%edx
+  8003c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003cc:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003d9:	39 c2                	cmp    %eax,%edx
+  8003db:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003de:	73 4b                	jae    80042b <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8003e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e3:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003e6:	85 ff                	test   %edi,%edi
+  8003e8:	7e 11                	jle    8003fb <printnum+0x4c>
+			putch(padc, putdat);
+  8003ea:	83 ec 08             	sub    $0x8,%esp
+  8003ed:	56                   	push   %esi
+  8003ee:	ff 75 18             	push   0x18(%ebp)
+  8003f1:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003f3:	83 c4 10             	add    $0x10,%esp
+  8003f6:	83 ef 01             	sub    $0x1,%edi
+  8003f9:	75 ef                	jne    8003ea <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003fb:	83 ec 08             	sub    $0x8,%esp
+  8003fe:	56                   	push   %esi
+  8003ff:	83 ec 04             	sub    $0x4,%esp
+  800402:	ff 75 e4             	push   -0x1c(%ebp)
+  800405:	ff 75 e0             	push   -0x20(%ebp)
+  800408:	ff 75 dc             	push   -0x24(%ebp)
+  80040b:	ff 75 d8             	push   -0x28(%ebp)
+  80040e:	e8 8d 40 00 00       	call   8044a0 <__umoddi3>
+  800413:	83 c4 14             	add    $0x14,%esp
+  800416:	0f be 80 d7 46 80 00 	movsbl 0x8046d7(%eax),%eax
+  80041d:	50                   	push   %eax
+  80041e:	ff d3                	call   *%ebx
+}
+  800420:	83 c4 10             	add    $0x10,%esp
+  800423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800426:	5b                   	pop    %ebx
+  800427:	5e                   	pop    %esi
+  800428:	5f                   	pop    %edi
+  800429:	5d                   	pop    %ebp
+  80042a:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80042b:	83 ec 0c             	sub    $0xc,%esp
+  80042e:	ff 75 18             	push   0x18(%ebp)
+  800431:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800434:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800437:	52                   	push   %edx
+  800438:	50                   	push   %eax
+  800439:	83 ec 08             	sub    $0x8,%esp
+  80043c:	ff 75 e4             	push   -0x1c(%ebp)
+  80043f:	ff 75 e0             	push   -0x20(%ebp)
+  800442:	ff 75 dc             	push   -0x24(%ebp)
+  800445:	ff 75 d8             	push   -0x28(%ebp)
+  800448:	e8 8d 3f 00 00       	call   8043da <__udivdi3>
+  80044d:	83 c4 18             	add    $0x18,%esp
+  800450:	52                   	push   %edx
+  800451:	50                   	push   %eax
+  800452:	89 f2                	mov    %esi,%edx
+  800454:	89 d8                	mov    %ebx,%eax
+  800456:	e8 54 ff ff ff       	call   8003af <printnum>
+  80045b:	83 c4 20             	add    $0x20,%esp
+  80045e:	eb 9b                	jmp    8003fb <printnum+0x4c>
+
+00800460 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800466:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80046a:	8b 10                	mov    (%eax),%edx
+  80046c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80046f:	73 0a                	jae    80047b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800471:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800474:	89 08                	mov    %ecx,(%eax)
+  800476:	8b 45 08             	mov    0x8(%ebp),%eax
+  800479:	88 02                	mov    %al,(%edx)
+}
+  80047b:	5d                   	pop    %ebp
+  80047c:	c3                   	ret
+
+0080047d <printfmt>:
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800483:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800486:	50                   	push   %eax
+  800487:	ff 75 10             	push   0x10(%ebp)
+  80048a:	ff 75 0c             	push   0xc(%ebp)
+  80048d:	ff 75 08             	push   0x8(%ebp)
+  800490:	e8 05 00 00 00       	call   80049a <vprintfmt>
+}
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+
+0080049a <vprintfmt>:
+{
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	57                   	push   %edi
+  80049e:	56                   	push   %esi
+  80049f:	53                   	push   %ebx
+  8004a0:	83 ec 2c             	sub    $0x2c,%esp
+  8004a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004a6:	89 df                	mov    %ebx,%edi
+  8004a8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004ae:	8d 70 01             	lea    0x1(%eax),%esi
+  8004b1:	0f b6 00             	movzbl (%eax),%eax
+  8004b4:	83 f8 25             	cmp    $0x25,%eax
+  8004b7:	74 1e                	je     8004d7 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8004b9:	85 c0                	test   %eax,%eax
+  8004bb:	0f 84 15 05 00 00    	je     8009d6 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8004c1:	83 ec 08             	sub    $0x8,%esp
+  8004c4:	53                   	push   %ebx
+  8004c5:	50                   	push   %eax
+  8004c6:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004c8:	83 c6 01             	add    $0x1,%esi
+  8004cb:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004cf:	83 c4 10             	add    $0x10,%esp
+  8004d2:	83 f8 25             	cmp    $0x25,%eax
+  8004d5:	75 e2                	jne    8004b9 <vprintfmt+0x1f>
+		padc = ' ';
+  8004d7:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8004db:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004e2:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004e9:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004f5:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f8:	8d 56 01             	lea    0x1(%esi),%edx
+  8004fb:	0f b6 0e             	movzbl (%esi),%ecx
+  8004fe:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800501:	3c 55                	cmp    $0x55,%al
+  800503:	0f 87 3b 04 00 00    	ja     800944 <vprintfmt+0x4aa>
+  800509:	0f b6 c0             	movzbl %al,%eax
+  80050c:	ff 24 85 40 48 80 00 	jmp    *0x804840(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800513:	89 75 10             	mov    %esi,0x10(%ebp)
+  800516:	eb 93                	jmp    8004ab <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800518:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80051a:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80051e:	eb d8                	jmp    8004f8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800520:	89 d6                	mov    %edx,%esi
+  800522:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800526:	eb d0                	jmp    8004f8 <vprintfmt+0x5e>
+  800528:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80052b:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80052e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800531:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800535:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800538:	83 f9 09             	cmp    $0x9,%ecx
+  80053b:	77 6f                	ja     8005ac <vprintfmt+0x112>
+  80053d:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800540:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800543:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800546:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80054a:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80054d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800550:	83 fe 09             	cmp    $0x9,%esi
+  800553:	76 eb                	jbe    800540 <vprintfmt+0xa6>
+  800555:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800558:	89 d6                	mov    %edx,%esi
+  80055a:	eb 13                	jmp    80056f <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80055c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055f:	8b 00                	mov    (%eax),%eax
+  800561:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8d 40 04             	lea    0x4(%eax),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80056d:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80056f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800573:	79 83                	jns    8004f8 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800575:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800578:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80057b:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800582:	e9 71 ff ff ff       	jmp    8004f8 <vprintfmt+0x5e>
+			if (width < 0)
+  800587:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80058a:	85 c9                	test   %ecx,%ecx
+  80058c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800591:	0f 49 c1             	cmovns %ecx,%eax
+  800594:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800597:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800599:	e9 5a ff ff ff       	jmp    8004f8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80059e:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8005a0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005a7:	e9 4c ff ff ff       	jmp    8004f8 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ac:	89 d6                	mov    %edx,%esi
+  8005ae:	eb bf                	jmp    80056f <vprintfmt+0xd5>
+			lflag++;
+  8005b0:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005b4:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8005b6:	e9 3d ff ff ff       	jmp    8004f8 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8005bb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c1:	8d 70 04             	lea    0x4(%eax),%esi
+  8005c4:	83 ec 08             	sub    $0x8,%esp
+  8005c7:	53                   	push   %ebx
+  8005c8:	ff 30                	push   (%eax)
+  8005ca:	ff d7                	call   *%edi
+			break;
+  8005cc:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005cf:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8005d2:	e9 d4 fe ff ff       	jmp    8004ab <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8005d7:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8005e0:	8b 10                	mov    (%eax),%edx
+  8005e2:	89 d0                	mov    %edx,%eax
+  8005e4:	f7 d8                	neg    %eax
+  8005e6:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005e9:	83 f8 12             	cmp    $0x12,%eax
+  8005ec:	7f 23                	jg     800611 <vprintfmt+0x177>
+  8005ee:	8b 14 85 a0 49 80 00 	mov    0x8049a0(,%eax,4),%edx
+  8005f5:	85 d2                	test   %edx,%edx
+  8005f7:	74 18                	je     800611 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005f9:	52                   	push   %edx
+  8005fa:	68 2f 4c 80 00       	push   $0x804c2f
+  8005ff:	53                   	push   %ebx
+  800600:	57                   	push   %edi
+  800601:	e8 77 fe ff ff       	call   80047d <printfmt>
+  800606:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800609:	89 75 14             	mov    %esi,0x14(%ebp)
+  80060c:	e9 9a fe ff ff       	jmp    8004ab <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800611:	50                   	push   %eax
+  800612:	68 ef 46 80 00       	push   $0x8046ef
+  800617:	53                   	push   %ebx
+  800618:	57                   	push   %edi
+  800619:	e8 5f fe ff ff       	call   80047d <printfmt>
+  80061e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800621:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800624:	e9 82 fe ff ff       	jmp    8004ab <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800629:	89 55 10             	mov    %edx,0x10(%ebp)
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	83 c0 04             	add    $0x4,%eax
+  800632:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800635:	8b 45 14             	mov    0x14(%ebp),%eax
+  800638:	8b 00                	mov    (%eax),%eax
+  80063a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80063d:	85 c0                	test   %eax,%eax
+  80063f:	0f 84 61 03 00 00    	je     8009a6 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800645:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800649:	7e 06                	jle    800651 <vprintfmt+0x1b7>
+  80064b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80064f:	75 29                	jne    80067a <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800651:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800654:	8d 70 01             	lea    0x1(%eax),%esi
+  800657:	0f b6 00             	movzbl (%eax),%eax
+  80065a:	0f be d0             	movsbl %al,%edx
+  80065d:	85 d2                	test   %edx,%edx
+  80065f:	0f 84 bb 00 00 00    	je     800720 <vprintfmt+0x286>
+  800665:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800668:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80066b:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80066e:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800671:	eb 7a                	jmp    8006ed <vprintfmt+0x253>
+				p = "(null)";
+  800673:	c7 45 d0 e8 46 80 00 	movl   $0x8046e8,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	ff 75 d4             	push   -0x2c(%ebp)
+  800680:	ff 75 d0             	push   -0x30(%ebp)
+  800683:	e8 e0 03 00 00       	call   800a68 <strnlen>
+  800688:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80068b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80068e:	83 c4 10             	add    $0x10,%esp
+  800691:	85 d2                	test   %edx,%edx
+  800693:	0f 8e d6 02 00 00    	jle    80096f <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800699:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80069d:	83 ec 08             	sub    $0x8,%esp
+  8006a0:	53                   	push   %ebx
+  8006a1:	56                   	push   %esi
+  8006a2:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a4:	83 c4 10             	add    $0x10,%esp
+  8006a7:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8006ab:	75 f0                	jne    80069d <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006ad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006b0:	8d 70 01             	lea    0x1(%eax),%esi
+  8006b3:	0f b6 00             	movzbl (%eax),%eax
+  8006b6:	0f be d0             	movsbl %al,%edx
+  8006b9:	85 d2                	test   %edx,%edx
+  8006bb:	0f 84 da 02 00 00    	je     80099b <vprintfmt+0x501>
+  8006c1:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006c4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006c7:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ca:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006cd:	eb 1e                	jmp    8006ed <vprintfmt+0x253>
+					putch(ch, putdat);
+  8006cf:	83 ec 08             	sub    $0x8,%esp
+  8006d2:	ff 75 0c             	push   0xc(%ebp)
+  8006d5:	52                   	push   %edx
+  8006d6:	ff 55 08             	call   *0x8(%ebp)
+  8006d9:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006dc:	83 eb 01             	sub    $0x1,%ebx
+  8006df:	83 c6 01             	add    $0x1,%esi
+  8006e2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006e6:	0f be d0             	movsbl %al,%edx
+  8006e9:	85 d2                	test   %edx,%edx
+  8006eb:	74 2a                	je     800717 <vprintfmt+0x27d>
+  8006ed:	85 ff                	test   %edi,%edi
+  8006ef:	78 05                	js     8006f6 <vprintfmt+0x25c>
+  8006f1:	83 ef 01             	sub    $0x1,%edi
+  8006f4:	78 59                	js     80074f <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006f6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006fa:	74 d3                	je     8006cf <vprintfmt+0x235>
+  8006fc:	0f be c0             	movsbl %al,%eax
+  8006ff:	83 e8 20             	sub    $0x20,%eax
+  800702:	83 f8 5e             	cmp    $0x5e,%eax
+  800705:	76 c8                	jbe    8006cf <vprintfmt+0x235>
+					putch('?', putdat);
+  800707:	83 ec 08             	sub    $0x8,%esp
+  80070a:	ff 75 0c             	push   0xc(%ebp)
+  80070d:	6a 3f                	push   $0x3f
+  80070f:	ff 55 08             	call   *0x8(%ebp)
+  800712:	83 c4 10             	add    $0x10,%esp
+  800715:	eb c5                	jmp    8006dc <vprintfmt+0x242>
+  800717:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80071a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80071d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800720:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800723:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800727:	7e 1b                	jle    800744 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800729:	83 ec 08             	sub    $0x8,%esp
+  80072c:	53                   	push   %ebx
+  80072d:	6a 20                	push   $0x20
+  80072f:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800731:	83 c4 10             	add    $0x10,%esp
+  800734:	83 ee 01             	sub    $0x1,%esi
+  800737:	75 f0                	jne    800729 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800739:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073f:	e9 67 fd ff ff       	jmp    8004ab <vprintfmt+0x11>
+  800744:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074a:	e9 5c fd ff ff       	jmp    8004ab <vprintfmt+0x11>
+  80074f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800752:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800755:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800758:	eb c6                	jmp    800720 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80075a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80075d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800760:	83 f9 01             	cmp    $0x1,%ecx
+  800763:	7f 1f                	jg     800784 <vprintfmt+0x2ea>
+	else if (lflag)
+  800765:	85 c9                	test   %ecx,%ecx
+  800767:	74 67                	je     8007d0 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800769:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076c:	8b 30                	mov    (%eax),%esi
+  80076e:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800771:	89 f0                	mov    %esi,%eax
+  800773:	c1 f8 1f             	sar    $0x1f,%eax
+  800776:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8d 40 04             	lea    0x4(%eax),%eax
+  80077f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800782:	eb 17                	jmp    80079b <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8b 50 04             	mov    0x4(%eax),%edx
+  80078a:	8b 00                	mov    (%eax),%eax
+  80078c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80078f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8d 40 08             	lea    0x8(%eax),%eax
+  800798:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80079b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80079e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007a1:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  8007a6:	85 c9                	test   %ecx,%ecx
+  8007a8:	0f 89 12 01 00 00    	jns    8008c0 <vprintfmt+0x426>
+				putch('-', putdat);
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+  8007b1:	53                   	push   %ebx
+  8007b2:	6a 2d                	push   $0x2d
+  8007b4:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8007b6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007bc:	f7 da                	neg    %edx
+  8007be:	83 d1 00             	adc    $0x0,%ecx
+  8007c1:	f7 d9                	neg    %ecx
+  8007c3:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007c6:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007cb:	e9 f0 00 00 00       	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8b 30                	mov    (%eax),%esi
+  8007d5:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007d8:	89 f0                	mov    %esi,%eax
+  8007da:	c1 f8 1f             	sar    $0x1f,%eax
+  8007dd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e9:	eb b0                	jmp    80079b <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007eb:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007ee:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007f1:	83 f9 01             	cmp    $0x1,%ecx
+  8007f4:	7f 1e                	jg     800814 <vprintfmt+0x37a>
+	else if (lflag)
+  8007f6:	85 c9                	test   %ecx,%ecx
+  8007f8:	74 32                	je     80082c <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fd:	8b 10                	mov    (%eax),%edx
+  8007ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800804:	8d 40 04             	lea    0x4(%eax),%eax
+  800807:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080a:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80080f:	e9 ac 00 00 00       	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800814:	8b 45 14             	mov    0x14(%ebp),%eax
+  800817:	8b 10                	mov    (%eax),%edx
+  800819:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081c:	8d 40 08             	lea    0x8(%eax),%eax
+  80081f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800822:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800827:	e9 94 00 00 00       	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80082c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082f:	8b 10                	mov    (%eax),%edx
+  800831:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800836:	8d 40 04             	lea    0x4(%eax),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083c:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800841:	eb 7d                	jmp    8008c0 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800843:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800846:	89 55 10             	mov    %edx,0x10(%ebp)
+  800849:	83 f9 01             	cmp    $0x1,%ecx
+  80084c:	7f 1b                	jg     800869 <vprintfmt+0x3cf>
+	else if (lflag)
+  80084e:	85 c9                	test   %ecx,%ecx
+  800850:	74 2c                	je     80087e <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8b 10                	mov    (%eax),%edx
+  800857:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80085c:	8d 40 04             	lea    0x4(%eax),%eax
+  80085f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800862:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800867:	eb 57                	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8b 10                	mov    (%eax),%edx
+  80086e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800871:	8d 40 08             	lea    0x8(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800877:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80087c:	eb 42                	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	8b 10                	mov    (%eax),%edx
+  800883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800888:	8d 40 04             	lea    0x4(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80088e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800893:	eb 2b                	jmp    8008c0 <vprintfmt+0x426>
+			putch('0', putdat);
+  800895:	89 55 10             	mov    %edx,0x10(%ebp)
+  800898:	83 ec 08             	sub    $0x8,%esp
+  80089b:	53                   	push   %ebx
+  80089c:	6a 30                	push   $0x30
+  80089e:	ff d7                	call   *%edi
+			putch('x', putdat);
+  8008a0:	83 c4 08             	add    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 78                	push   $0x78
+  8008a6:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  8008a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ab:	8b 10                	mov    (%eax),%edx
+  8008ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008b2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008bb:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8008c0:	83 ec 0c             	sub    $0xc,%esp
+  8008c3:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008c7:	50                   	push   %eax
+  8008c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8008cb:	56                   	push   %esi
+  8008cc:	51                   	push   %ecx
+  8008cd:	52                   	push   %edx
+  8008ce:	89 da                	mov    %ebx,%edx
+  8008d0:	89 f8                	mov    %edi,%eax
+  8008d2:	e8 d8 fa ff ff       	call   8003af <printnum>
+			break;
+  8008d7:	83 c4 20             	add    $0x20,%esp
+  8008da:	e9 cc fb ff ff       	jmp    8004ab <vprintfmt+0x11>
+	if (lflag >= 2)
+  8008df:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008e2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008e5:	83 f9 01             	cmp    $0x1,%ecx
+  8008e8:	7f 1b                	jg     800905 <vprintfmt+0x46b>
+	else if (lflag)
+  8008ea:	85 c9                	test   %ecx,%ecx
+  8008ec:	74 2c                	je     80091a <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008fe:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800903:	eb bb                	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8b 10                	mov    (%eax),%edx
+  80090a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090d:	8d 40 08             	lea    0x8(%eax),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800913:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800918:	eb a6                	jmp    8008c0 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 10                	mov    (%eax),%edx
+  80091f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800924:	8d 40 04             	lea    0x4(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80092a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80092f:	eb 8f                	jmp    8008c0 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800931:	89 55 10             	mov    %edx,0x10(%ebp)
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	53                   	push   %ebx
+  800938:	6a 25                	push   $0x25
+  80093a:	ff d7                	call   *%edi
+			break;
+  80093c:	83 c4 10             	add    $0x10,%esp
+  80093f:	e9 67 fb ff ff       	jmp    8004ab <vprintfmt+0x11>
+			putch('%', putdat);
+  800944:	83 ec 08             	sub    $0x8,%esp
+  800947:	53                   	push   %ebx
+  800948:	6a 25                	push   $0x25
+  80094a:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80094c:	83 c4 10             	add    $0x10,%esp
+  80094f:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800953:	0f 84 ba fb ff ff    	je     800513 <vprintfmt+0x79>
+  800959:	89 75 10             	mov    %esi,0x10(%ebp)
+  80095c:	89 f0                	mov    %esi,%eax
+  80095e:	83 e8 01             	sub    $0x1,%eax
+  800961:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800965:	75 f7                	jne    80095e <vprintfmt+0x4c4>
+  800967:	89 45 10             	mov    %eax,0x10(%ebp)
+  80096a:	e9 3c fb ff ff       	jmp    8004ab <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80096f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800972:	8d 70 01             	lea    0x1(%eax),%esi
+  800975:	0f b6 00             	movzbl (%eax),%eax
+  800978:	0f be d0             	movsbl %al,%edx
+  80097b:	85 d2                	test   %edx,%edx
+  80097d:	74 11                	je     800990 <vprintfmt+0x4f6>
+  80097f:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800982:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800985:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800988:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80098b:	e9 5d fd ff ff       	jmp    8006ed <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800990:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800993:	89 45 14             	mov    %eax,0x14(%ebp)
+  800996:	e9 10 fb ff ff       	jmp    8004ab <vprintfmt+0x11>
+  80099b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80099e:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a1:	e9 05 fb ff ff       	jmp    8004ab <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  8009a6:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009aa:	7e 0a                	jle    8009b6 <vprintfmt+0x51c>
+  8009ac:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8009b0:	0f 85 bd fc ff ff    	jne    800673 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009b6:	ba 28 00 00 00       	mov    $0x28,%edx
+  8009bb:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009c0:	be e9 46 80 00       	mov    $0x8046e9,%esi
+  8009c5:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009c8:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009cb:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009ce:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009d1:	e9 17 fd ff ff       	jmp    8006ed <vprintfmt+0x253>
+}
+  8009d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009d9:	5b                   	pop    %ebx
+  8009da:	5e                   	pop    %esi
+  8009db:	5f                   	pop    %edi
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	83 ec 18             	sub    $0x18,%esp
+  8009e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009ea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009ed:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009f1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009fb:	85 c0                	test   %eax,%eax
+  8009fd:	74 26                	je     800a25 <vsnprintf+0x47>
+  8009ff:	85 d2                	test   %edx,%edx
+  800a01:	7e 22                	jle    800a25 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a03:	ff 75 14             	push   0x14(%ebp)
+  800a06:	ff 75 10             	push   0x10(%ebp)
+  800a09:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a0c:	50                   	push   %eax
+  800a0d:	68 60 04 80 00       	push   $0x800460
+  800a12:	e8 83 fa ff ff       	call   80049a <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800a17:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a1a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800a1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a20:	83 c4 10             	add    $0x10,%esp
+}
+  800a23:	c9                   	leave
+  800a24:	c3                   	ret
+		return -E_INVAL;
+  800a25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a2a:	eb f7                	jmp    800a23 <vsnprintf+0x45>
+
+00800a2c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a32:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a35:	50                   	push   %eax
+  800a36:	ff 75 10             	push   0x10(%ebp)
+  800a39:	ff 75 0c             	push   0xc(%ebp)
+  800a3c:	ff 75 08             	push   0x8(%ebp)
+  800a3f:	e8 9a ff ff ff       	call   8009de <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a44:	c9                   	leave
+  800a45:	c3                   	ret
+
+00800a46 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a4c:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a4f:	74 10                	je     800a61 <strlen+0x1b>
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a56:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a59:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a5d:	75 f7                	jne    800a56 <strlen+0x10>
+	return n;
+}
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a61:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a66:	eb f7                	jmp    800a5f <strlen+0x19>
+
+00800a68 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a71:	85 d2                	test   %edx,%edx
+  800a73:	74 16                	je     800a8b <strnlen+0x23>
+  800a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a7e:	74 09                	je     800a89 <strnlen+0x21>
+		n++;
+  800a80:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a83:	39 d0                	cmp    %edx,%eax
+  800a85:	75 f3                	jne    800a7a <strnlen+0x12>
+		n++;
+  800a87:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a89:	5d                   	pop    %ebp
+  800a8a:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a90:	eb f7                	jmp    800a89 <strnlen+0x21>
+
+00800a92 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	53                   	push   %ebx
+  800a96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a99:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800aa5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800aa8:	83 c0 01             	add    $0x1,%eax
+  800aab:	84 d2                	test   %dl,%dl
+  800aad:	75 f2                	jne    800aa1 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800aaf:	89 c8                	mov    %ecx,%eax
+  800ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+
+00800ab6 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	53                   	push   %ebx
+  800aba:	83 ec 10             	sub    $0x10,%esp
+  800abd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800ac0:	53                   	push   %ebx
+  800ac1:	e8 80 ff ff ff       	call   800a46 <strlen>
+  800ac6:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ac9:	ff 75 0c             	push   0xc(%ebp)
+  800acc:	01 d8                	add    %ebx,%eax
+  800ace:	50                   	push   %eax
+  800acf:	e8 be ff ff ff       	call   800a92 <strcpy>
+	return dst;
+}
+  800ad4:	89 d8                	mov    %ebx,%eax
+  800ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ad9:	c9                   	leave
+  800ada:	c3                   	ret
+
+00800adb <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800adb:	55                   	push   %ebp
+  800adc:	89 e5                	mov    %esp,%ebp
+  800ade:	56                   	push   %esi
+  800adf:	53                   	push   %ebx
+  800ae0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ae9:	85 db                	test   %ebx,%ebx
+  800aeb:	74 17                	je     800b04 <strncpy+0x29>
+  800aed:	01 f3                	add    %esi,%ebx
+  800aef:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800af1:	83 c0 01             	add    $0x1,%eax
+  800af4:	0f b6 0a             	movzbl (%edx),%ecx
+  800af7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800afa:	80 f9 01             	cmp    $0x1,%cl
+  800afd:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800b00:	39 c3                	cmp    %eax,%ebx
+  800b02:	75 ed                	jne    800af1 <strncpy+0x16>
+	}
+	return ret;
+}
+  800b04:	89 f0                	mov    %esi,%eax
+  800b06:	5b                   	pop    %ebx
+  800b07:	5e                   	pop    %esi
+  800b08:	5d                   	pop    %ebp
+  800b09:	c3                   	ret
+
+00800b0a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	56                   	push   %esi
+  800b0e:	53                   	push   %ebx
+  800b0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800b18:	89 f0                	mov    %esi,%eax
+  800b1a:	85 db                	test   %ebx,%ebx
+  800b1c:	74 1e                	je     800b3c <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800b1e:	83 eb 01             	sub    $0x1,%ebx
+  800b21:	74 16                	je     800b39 <strlcpy+0x2f>
+  800b23:	01 f3                	add    %esi,%ebx
+  800b25:	0f b6 0a             	movzbl (%edx),%ecx
+  800b28:	84 c9                	test   %cl,%cl
+  800b2a:	74 0d                	je     800b39 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800b2c:	83 c2 01             	add    $0x1,%edx
+  800b2f:	83 c0 01             	add    $0x1,%eax
+  800b32:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800b35:	39 d8                	cmp    %ebx,%eax
+  800b37:	75 ec                	jne    800b25 <strlcpy+0x1b>
+		*dst = '\0';
+  800b39:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b3c:	29 f0                	sub    %esi,%eax
+}
+  800b3e:	5b                   	pop    %ebx
+  800b3f:	5e                   	pop    %esi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b4b:	0f b6 01             	movzbl (%ecx),%eax
+  800b4e:	84 c0                	test   %al,%al
+  800b50:	74 11                	je     800b63 <strcmp+0x21>
+  800b52:	38 02                	cmp    %al,(%edx)
+  800b54:	75 0d                	jne    800b63 <strcmp+0x21>
+		p++, q++;
+  800b56:	83 c1 01             	add    $0x1,%ecx
+  800b59:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b5c:	0f b6 01             	movzbl (%ecx),%eax
+  800b5f:	84 c0                	test   %al,%al
+  800b61:	75 ef                	jne    800b52 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b63:	0f b6 c0             	movzbl %al,%eax
+  800b66:	0f b6 12             	movzbl (%edx),%edx
+  800b69:	29 d0                	sub    %edx,%eax
+}
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	53                   	push   %ebx
+  800b71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b77:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b7f:	85 d2                	test   %edx,%edx
+  800b81:	74 2e                	je     800bb1 <strncmp+0x44>
+  800b83:	0f b6 01             	movzbl (%ecx),%eax
+  800b86:	84 c0                	test   %al,%al
+  800b88:	74 16                	je     800ba0 <strncmp+0x33>
+  800b8a:	3a 03                	cmp    (%ebx),%al
+  800b8c:	75 12                	jne    800ba0 <strncmp+0x33>
+		n--, p++, q++;
+  800b8e:	83 c1 01             	add    $0x1,%ecx
+  800b91:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b94:	83 ea 01             	sub    $0x1,%edx
+  800b97:	75 ea                	jne    800b83 <strncmp+0x16>
+		return 0;
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	eb 11                	jmp    800bb1 <strncmp+0x44>
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800ba5:	85 d2                	test   %edx,%edx
+  800ba7:	74 08                	je     800bb1 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ba9:	0f b6 01             	movzbl (%ecx),%eax
+  800bac:	0f b6 13             	movzbl (%ebx),%edx
+  800baf:	29 d0                	sub    %edx,%eax
+}
+  800bb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bb4:	c9                   	leave
+  800bb5:	c3                   	ret
+
+00800bb6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800bc0:	0f b6 10             	movzbl (%eax),%edx
+  800bc3:	84 d2                	test   %dl,%dl
+  800bc5:	74 15                	je     800bdc <strchr+0x26>
+		if (*s == c)
+  800bc7:	38 d1                	cmp    %dl,%cl
+  800bc9:	74 0f                	je     800bda <strchr+0x24>
+	for (; *s; s++)
+  800bcb:	83 c0 01             	add    $0x1,%eax
+  800bce:	0f b6 10             	movzbl (%eax),%edx
+  800bd1:	84 d2                	test   %dl,%dl
+  800bd3:	75 f2                	jne    800bc7 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bda:	5d                   	pop    %ebp
+  800bdb:	c3                   	ret
+	return 0;
+  800bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be1:	eb f7                	jmp    800bda <strchr+0x24>
+
+00800be3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	53                   	push   %ebx
+  800be7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bea:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800bed:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bf0:	38 d3                	cmp    %dl,%bl
+  800bf2:	74 14                	je     800c08 <strfind+0x25>
+  800bf4:	89 d1                	mov    %edx,%ecx
+  800bf6:	84 db                	test   %bl,%bl
+  800bf8:	74 0e                	je     800c08 <strfind+0x25>
+	for (; *s; s++)
+  800bfa:	83 c0 01             	add    $0x1,%eax
+  800bfd:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800c00:	38 ca                	cmp    %cl,%dl
+  800c02:	74 04                	je     800c08 <strfind+0x25>
+  800c04:	84 d2                	test   %dl,%dl
+  800c06:	75 f2                	jne    800bfa <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800c08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c0b:	c9                   	leave
+  800c0c:	c3                   	ret
+
+00800c0d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800c17:	85 c9                	test   %ecx,%ecx
+  800c19:	74 20                	je     800c3b <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800c1b:	89 f8                	mov    %edi,%eax
+  800c1d:	09 c8                	or     %ecx,%eax
+  800c1f:	a8 03                	test   $0x3,%al
+  800c21:	75 12                	jne    800c35 <memset+0x28>
+		c &= 0xFF;
+  800c23:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c27:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c2d:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c30:	fc                   	cld
+  800c31:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c33:	eb 06                	jmp    800c3b <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c38:	fc                   	cld
+  800c39:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c3b:	89 f8                	mov    %edi,%eax
+  800c3d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+00800c42 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c50:	39 c6                	cmp    %eax,%esi
+  800c52:	73 32                	jae    800c86 <memmove+0x44>
+  800c54:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c57:	39 d0                	cmp    %edx,%eax
+  800c59:	73 2b                	jae    800c86 <memmove+0x44>
+		s += n;
+		d += n;
+  800c5b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5e:	89 d6                	mov    %edx,%esi
+  800c60:	09 fe                	or     %edi,%esi
+  800c62:	09 ce                	or     %ecx,%esi
+  800c64:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c6a:	75 0e                	jne    800c7a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c6c:	83 ef 04             	sub    $0x4,%edi
+  800c6f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c72:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c75:	fd                   	std
+  800c76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c78:	eb 09                	jmp    800c83 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c7a:	83 ef 01             	sub    $0x1,%edi
+  800c7d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c80:	fd                   	std
+  800c81:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c83:	fc                   	cld
+  800c84:	eb 1a                	jmp    800ca0 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c86:	89 f2                	mov    %esi,%edx
+  800c88:	09 c2                	or     %eax,%edx
+  800c8a:	09 ca                	or     %ecx,%edx
+  800c8c:	f6 c2 03             	test   $0x3,%dl
+  800c8f:	75 0a                	jne    800c9b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c91:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c94:	89 c7                	mov    %eax,%edi
+  800c96:	fc                   	cld
+  800c97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c99:	eb 05                	jmp    800ca0 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c9b:	89 c7                	mov    %eax,%edi
+  800c9d:	fc                   	cld
+  800c9e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+
+00800ca4 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800caa:	ff 75 10             	push   0x10(%ebp)
+  800cad:	ff 75 0c             	push   0xc(%ebp)
+  800cb0:	ff 75 08             	push   0x8(%ebp)
+  800cb3:	e8 8a ff ff ff       	call   800c42 <memmove>
+}
+  800cb8:	c9                   	leave
+  800cb9:	c3                   	ret
+
+00800cba <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cc5:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800cc8:	85 f6                	test   %esi,%esi
+  800cca:	74 29                	je     800cf5 <memcmp+0x3b>
+  800ccc:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800cce:	0f b6 08             	movzbl (%eax),%ecx
+  800cd1:	0f b6 1a             	movzbl (%edx),%ebx
+  800cd4:	38 d9                	cmp    %bl,%cl
+  800cd6:	75 11                	jne    800ce9 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cd8:	83 c0 01             	add    $0x1,%eax
+  800cdb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cde:	39 c6                	cmp    %eax,%esi
+  800ce0:	75 ec                	jne    800cce <memcmp+0x14>
+	}
+
+	return 0;
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	eb 08                	jmp    800cf1 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ce9:	0f b6 c1             	movzbl %cl,%eax
+  800cec:	0f b6 db             	movzbl %bl,%ebx
+  800cef:	29 d8                	sub    %ebx,%eax
+}
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5d                   	pop    %ebp
+  800cf4:	c3                   	ret
+	return 0;
+  800cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfa:	eb f5                	jmp    800cf1 <memcmp+0x37>
+
+00800cfc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800d05:	89 c2                	mov    %eax,%edx
+  800d07:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800d0a:	39 d0                	cmp    %edx,%eax
+  800d0c:	73 0d                	jae    800d1b <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800d0e:	38 08                	cmp    %cl,(%eax)
+  800d10:	74 0d                	je     800d1f <memfind+0x23>
+	for (; s < ends; s++)
+  800d12:	83 c0 01             	add    $0x1,%eax
+  800d15:	39 c2                	cmp    %eax,%edx
+  800d17:	75 f5                	jne    800d0e <memfind+0x12>
+  800d19:	eb 06                	jmp    800d21 <memfind+0x25>
+  800d1b:	89 c2                	mov    %eax,%edx
+  800d1d:	eb 02                	jmp    800d21 <memfind+0x25>
+  800d1f:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800d21:	89 d0                	mov    %edx,%eax
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+
+00800d25 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+  800d2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d31:	0f b6 02             	movzbl (%edx),%eax
+  800d34:	3c 20                	cmp    $0x20,%al
+  800d36:	74 04                	je     800d3c <strtol+0x17>
+  800d38:	3c 09                	cmp    $0x9,%al
+  800d3a:	75 0e                	jne    800d4a <strtol+0x25>
+		s++;
+  800d3c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d3f:	0f b6 02             	movzbl (%edx),%eax
+  800d42:	3c 20                	cmp    $0x20,%al
+  800d44:	74 f6                	je     800d3c <strtol+0x17>
+  800d46:	3c 09                	cmp    $0x9,%al
+  800d48:	74 f2                	je     800d3c <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d4a:	3c 2b                	cmp    $0x2b,%al
+  800d4c:	74 2a                	je     800d78 <strtol+0x53>
+	int neg = 0;
+  800d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d53:	3c 2d                	cmp    $0x2d,%al
+  800d55:	74 2b                	je     800d82 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d57:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d5d:	75 0f                	jne    800d6e <strtol+0x49>
+  800d5f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d62:	74 28                	je     800d8c <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d64:	85 db                	test   %ebx,%ebx
+  800d66:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d6b:	0f 44 d8             	cmove  %eax,%ebx
+  800d6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d73:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d76:	eb 46                	jmp    800dbe <strtol+0x99>
+		s++;
+  800d78:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d80:	eb d5                	jmp    800d57 <strtol+0x32>
+		s++, neg = 1;
+  800d82:	83 c2 01             	add    $0x1,%edx
+  800d85:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d8a:	eb cb                	jmp    800d57 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d8c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d90:	74 0e                	je     800da0 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d92:	85 db                	test   %ebx,%ebx
+  800d94:	75 d8                	jne    800d6e <strtol+0x49>
+		s++, base = 8;
+  800d96:	83 c2 01             	add    $0x1,%edx
+  800d99:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d9e:	eb ce                	jmp    800d6e <strtol+0x49>
+		s += 2, base = 16;
+  800da0:	83 c2 02             	add    $0x2,%edx
+  800da3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800da8:	eb c4                	jmp    800d6e <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800daa:	0f be c0             	movsbl %al,%eax
+  800dad:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800db0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800db3:	7d 3a                	jge    800def <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800db5:	83 c2 01             	add    $0x1,%edx
+  800db8:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dbc:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800dbe:	0f b6 02             	movzbl (%edx),%eax
+  800dc1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dc4:	89 f3                	mov    %esi,%ebx
+  800dc6:	80 fb 09             	cmp    $0x9,%bl
+  800dc9:	76 df                	jbe    800daa <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800dcb:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dce:	89 f3                	mov    %esi,%ebx
+  800dd0:	80 fb 19             	cmp    $0x19,%bl
+  800dd3:	77 08                	ja     800ddd <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800dd5:	0f be c0             	movsbl %al,%eax
+  800dd8:	83 e8 57             	sub    $0x57,%eax
+  800ddb:	eb d3                	jmp    800db0 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ddd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800de0:	89 f3                	mov    %esi,%ebx
+  800de2:	80 fb 19             	cmp    $0x19,%bl
+  800de5:	77 08                	ja     800def <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800de7:	0f be c0             	movsbl %al,%eax
+  800dea:	83 e8 37             	sub    $0x37,%eax
+  800ded:	eb c1                	jmp    800db0 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800def:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800df3:	74 05                	je     800dfa <strtol+0xd5>
+		*endptr = (char *) s;
+  800df5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800df8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dfa:	89 c8                	mov    %ecx,%eax
+  800dfc:	f7 d8                	neg    %eax
+  800dfe:	85 ff                	test   %edi,%edi
+  800e00:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e03:	89 c8                	mov    %ecx,%eax
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	89 c3                	mov    %eax,%ebx
+  800e1d:	89 c7                	mov    %eax,%edi
+  800e1f:	89 c6                	mov    %eax,%esi
+  800e21:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e23:	5b                   	pop    %ebx
+  800e24:	5e                   	pop    %esi
+  800e25:	5f                   	pop    %edi
+  800e26:	5d                   	pop    %ebp
+  800e27:	c3                   	ret
+
+00800e28 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e33:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e38:	89 d1                	mov    %edx,%ecx
+  800e3a:	89 d3                	mov    %edx,%ebx
+  800e3c:	89 d7                	mov    %edx,%edi
+  800e3e:	89 d6                	mov    %edx,%esi
+  800e40:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e42:	5b                   	pop    %ebx
+  800e43:	5e                   	pop    %esi
+  800e44:	5f                   	pop    %edi
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+
+00800e47 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	57                   	push   %edi
+  800e4b:	56                   	push   %esi
+  800e4c:	53                   	push   %ebx
+  800e4d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e55:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e58:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e5d:	89 cb                	mov    %ecx,%ebx
+  800e5f:	89 cf                	mov    %ecx,%edi
+  800e61:	89 ce                	mov    %ecx,%esi
+  800e63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e65:	85 c0                	test   %eax,%eax
+  800e67:	7f 08                	jg     800e71 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6c:	5b                   	pop    %ebx
+  800e6d:	5e                   	pop    %esi
+  800e6e:	5f                   	pop    %edi
+  800e6f:	5d                   	pop    %ebp
+  800e70:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+  800e74:	50                   	push   %eax
+  800e75:	6a 03                	push   $0x3
+  800e77:	68 0b 4a 80 00       	push   $0x804a0b
+  800e7c:	6a 23                	push   $0x23
+  800e7e:	68 28 4a 80 00       	push   $0x804a28
+  800e83:	e8 38 f4 ff ff       	call   8002c0 <_panic>
+
+00800e88 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e88:	55                   	push   %ebp
+  800e89:	89 e5                	mov    %esp,%ebp
+  800e8b:	57                   	push   %edi
+  800e8c:	56                   	push   %esi
+  800e8d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e93:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e98:	89 d1                	mov    %edx,%ecx
+  800e9a:	89 d3                	mov    %edx,%ebx
+  800e9c:	89 d7                	mov    %edx,%edi
+  800e9e:	89 d6                	mov    %edx,%esi
+  800ea0:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+
+00800ea7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	57                   	push   %edi
+  800eab:	56                   	push   %esi
+  800eac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ead:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800eb7:	89 d1                	mov    %edx,%ecx
+  800eb9:	89 d3                	mov    %edx,%ebx
+  800ebb:	89 d7                	mov    %edx,%edi
+  800ebd:	89 d6                	mov    %edx,%esi
+  800ebf:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ec1:	5b                   	pop    %ebx
+  800ec2:	5e                   	pop    %esi
+  800ec3:	5f                   	pop    %edi
+  800ec4:	5d                   	pop    %ebp
+  800ec5:	c3                   	ret
+
+00800ec6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ec6:	55                   	push   %ebp
+  800ec7:	89 e5                	mov    %esp,%ebp
+  800ec9:	57                   	push   %edi
+  800eca:	56                   	push   %esi
+  800ecb:	53                   	push   %ebx
+  800ecc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eda:	b8 04 00 00 00       	mov    $0x4,%eax
+  800edf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee2:	89 f7                	mov    %esi,%edi
+  800ee4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee6:	85 c0                	test   %eax,%eax
+  800ee8:	7f 08                	jg     800ef2 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+  800ef5:	50                   	push   %eax
+  800ef6:	6a 04                	push   $0x4
+  800ef8:	68 0b 4a 80 00       	push   $0x804a0b
+  800efd:	6a 23                	push   $0x23
+  800eff:	68 28 4a 80 00       	push   $0x804a28
+  800f04:	e8 b7 f3 ff ff       	call   8002c0 <_panic>
+
+00800f09 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f15:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f18:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f20:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f23:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f26:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f28:	85 c0                	test   %eax,%eax
+  800f2a:	7f 08                	jg     800f34 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+  800f37:	50                   	push   %eax
+  800f38:	6a 05                	push   $0x5
+  800f3a:	68 0b 4a 80 00       	push   $0x804a0b
+  800f3f:	6a 23                	push   $0x23
+  800f41:	68 28 4a 80 00       	push   $0x804a28
+  800f46:	e8 75 f3 ff ff       	call   8002c0 <_panic>
+
+00800f4b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f4b:	55                   	push   %ebp
+  800f4c:	89 e5                	mov    %esp,%ebp
+  800f4e:	57                   	push   %edi
+  800f4f:	56                   	push   %esi
+  800f50:	53                   	push   %ebx
+  800f51:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f64:	89 df                	mov    %ebx,%edi
+  800f66:	89 de                	mov    %ebx,%esi
+  800f68:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6a:	85 c0                	test   %eax,%eax
+  800f6c:	7f 08                	jg     800f76 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+  800f79:	50                   	push   %eax
+  800f7a:	6a 06                	push   $0x6
+  800f7c:	68 0b 4a 80 00       	push   $0x804a0b
+  800f81:	6a 23                	push   $0x23
+  800f83:	68 28 4a 80 00       	push   $0x804a28
+  800f88:	e8 33 f3 ff ff       	call   8002c0 <_panic>
+
+00800f8d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	7f 08                	jg     800fb8 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 08                	push   $0x8
+  800fbe:	68 0b 4a 80 00       	push   $0x804a0b
+  800fc3:	6a 23                	push   $0x23
+  800fc5:	68 28 4a 80 00       	push   $0x804a28
+  800fca:	e8 f1 f2 ff ff       	call   8002c0 <_panic>
+
+00800fcf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe8:	89 df                	mov    %ebx,%edi
+  800fea:	89 de                	mov    %ebx,%esi
+  800fec:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fee:	85 c0                	test   %eax,%eax
+  800ff0:	7f 08                	jg     800ffa <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	50                   	push   %eax
+  800ffe:	6a 09                	push   $0x9
+  801000:	68 0b 4a 80 00       	push   $0x804a0b
+  801005:	6a 23                	push   $0x23
+  801007:	68 28 4a 80 00       	push   $0x804a28
+  80100c:	e8 af f2 ff ff       	call   8002c0 <_panic>
+
+00801011 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801030:	85 c0                	test   %eax,%eax
+  801032:	7f 08                	jg     80103c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 0a                	push   $0xa
+  801042:	68 0b 4a 80 00       	push   $0x804a0b
+  801047:	6a 23                	push   $0x23
+  801049:	68 28 4a 80 00       	push   $0x804a28
+  80104e:	e8 6d f2 ff ff       	call   8002c0 <_panic>
+
+00801053 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801064:	be 00 00 00 00       	mov    $0x0,%esi
+  801069:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801071:	5b                   	pop    %ebx
+  801072:	5e                   	pop    %esi
+  801073:	5f                   	pop    %edi
+  801074:	5d                   	pop    %ebp
+  801075:	c3                   	ret
+
+00801076 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801076:	55                   	push   %ebp
+  801077:	89 e5                	mov    %esp,%ebp
+  801079:	57                   	push   %edi
+  80107a:	56                   	push   %esi
+  80107b:	53                   	push   %ebx
+  80107c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80107f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80108c:	89 cb                	mov    %ecx,%ebx
+  80108e:	89 cf                	mov    %ecx,%edi
+  801090:	89 ce                	mov    %ecx,%esi
+  801092:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801094:	85 c0                	test   %eax,%eax
+  801096:	7f 08                	jg     8010a0 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801098:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109b:	5b                   	pop    %ebx
+  80109c:	5e                   	pop    %esi
+  80109d:	5f                   	pop    %edi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a0:	83 ec 0c             	sub    $0xc,%esp
+  8010a3:	50                   	push   %eax
+  8010a4:	6a 0d                	push   $0xd
+  8010a6:	68 0b 4a 80 00       	push   $0x804a0b
+  8010ab:	6a 23                	push   $0x23
+  8010ad:	68 28 4a 80 00       	push   $0x804a28
+  8010b2:	e8 09 f2 ff ff       	call   8002c0 <_panic>
+
+008010b7 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8010b7:	55                   	push   %ebp
+  8010b8:	89 e5                	mov    %esp,%ebp
+  8010ba:	57                   	push   %edi
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010c8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010cb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ce:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010d1:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8010d3:	5b                   	pop    %ebx
+  8010d4:	5e                   	pop    %esi
+  8010d5:	5f                   	pop    %edi
+  8010d6:	5d                   	pop    %ebp
+  8010d7:	c3                   	ret
+
+008010d8 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	89 de                	mov    %ebx,%esi
+  8010f5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	7f 08                	jg     801103 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801103:	83 ec 0c             	sub    $0xc,%esp
+  801106:	50                   	push   %eax
+  801107:	6a 0d                	push   $0xd
+  801109:	68 0b 4a 80 00       	push   $0x804a0b
+  80110e:	6a 23                	push   $0x23
+  801110:	68 28 4a 80 00       	push   $0x804a28
+  801115:	e8 a6 f1 ff ff       	call   8002c0 <_panic>
+
+0080111a <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	56                   	push   %esi
+  80111f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801120:	ba 00 00 00 00       	mov    $0x0,%edx
+  801125:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80112a:	89 d1                	mov    %edx,%ecx
+  80112c:	89 d3                	mov    %edx,%ebx
+  80112e:	89 d7                	mov    %edx,%edi
+  801130:	89 d6                	mov    %edx,%esi
+  801132:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+
+00801139 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80113f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80114f:	89 df                	mov    %ebx,%edi
+  801151:	89 de                	mov    %ebx,%esi
+  801153:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801155:	5b                   	pop    %ebx
+  801156:	5e                   	pop    %esi
+  801157:	5f                   	pop    %edi
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+
+0080115a <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	57                   	push   %edi
+  80115e:	56                   	push   %esi
+  80115f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801160:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	b8 10 00 00 00       	mov    $0x10,%eax
+  80116d:	89 cb                	mov    %ecx,%ebx
+  80116f:	89 cf                	mov    %ecx,%edi
+  801171:	89 ce                	mov    %ecx,%esi
+  801173:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801190:	89 df                	mov    %ebx,%edi
+  801192:	89 de                	mov    %ebx,%esi
+  801194:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801196:	5b                   	pop    %ebx
+  801197:	5e                   	pop    %esi
+  801198:	5f                   	pop    %edi
+  801199:	5d                   	pop    %ebp
+  80119a:	c3                   	ret
+
+0080119b <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ac:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011b1:	89 df                	mov    %ebx,%edi
+  8011b3:	89 de                	mov    %ebx,%esi
+  8011b5:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011cf:	89 cb                	mov    %ecx,%ebx
+  8011d1:	89 cf                	mov    %ecx,%edi
+  8011d3:	89 ce                	mov    %ecx,%esi
+  8011d5:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+
+008011dc <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	57                   	push   %edi
+  8011e0:	56                   	push   %esi
+  8011e1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ed:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011f2:	89 df                	mov    %ebx,%edi
+  8011f4:	89 de                	mov    %ebx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+
+008011fd <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801203:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801210:	89 cb                	mov    %ecx,%ebx
+  801212:	89 cf                	mov    %ecx,%edi
+  801214:	89 ce                	mov    %ecx,%esi
+  801216:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801218:	5b                   	pop    %ebx
+  801219:	5e                   	pop    %esi
+  80121a:	5f                   	pop    %edi
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+
+0080121d <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801223:	be 00 00 00 00       	mov    $0x0,%esi
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122e:	b8 16 00 00 00       	mov    $0x16,%eax
+  801233:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801236:	89 f7                	mov    %esi,%edi
+  801238:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801250:	b8 17 00 00 00       	mov    $0x17,%eax
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80125b:	5b                   	pop    %ebx
+  80125c:	5e                   	pop    %esi
+  80125d:	5f                   	pop    %edi
+  80125e:	5d                   	pop    %ebp
+  80125f:	c3                   	ret
+
+00801260 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801260:	55                   	push   %ebp
+  801261:	89 e5                	mov    %esp,%ebp
+  801263:	57                   	push   %edi
+  801264:	56                   	push   %esi
+  801265:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801266:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801273:	89 cb                	mov    %ecx,%ebx
+  801275:	89 cf                	mov    %ecx,%edi
+  801277:	89 ce                	mov    %ecx,%esi
+  801279:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5f                   	pop    %edi
+  80127e:	5d                   	pop    %ebp
+  80127f:	c3                   	ret
+
+00801280 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801286:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80128a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 19 00 00 00       	mov    $0x19,%eax
+  801297:	89 df                	mov    %ebx,%edi
+  801299:	89 de                	mov    %ebx,%esi
+  80129b:	cd 30                	int    $0x30
+}
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	56                   	push   %esi
+  8012a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8012b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bb:	89 f7                	mov    %esi,%edi
+  8012bd:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+
+008012c4 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012dd:	89 f7                	mov    %esi,%edi
+  8012df:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8012e1:	5b                   	pop    %ebx
+  8012e2:	5e                   	pop    %esi
+  8012e3:	5f                   	pop    %edi
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	c3                   	ret
+
+008012e6 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	57                   	push   %edi
+  8012ea:	56                   	push   %esi
+  8012eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012fc:	89 df                	mov    %ebx,%edi
+  8012fe:	89 de                	mov    %ebx,%esi
+  801300:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801302:	5b                   	pop    %ebx
+  801303:	5e                   	pop    %esi
+  801304:	5f                   	pop    %edi
+  801305:	5d                   	pop    %ebp
+  801306:	c3                   	ret
+
+00801307 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801307:	55                   	push   %ebp
+  801308:	89 e5                	mov    %esp,%ebp
+  80130a:	57                   	push   %edi
+  80130b:	56                   	push   %esi
+  80130c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80130d:	be 00 00 00 00       	mov    $0x0,%esi
+  801312:	8b 55 08             	mov    0x8(%ebp),%edx
+  801315:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801318:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80131d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801320:	89 f7                	mov    %esi,%edi
+  801322:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801324:	5b                   	pop    %ebx
+  801325:	5e                   	pop    %esi
+  801326:	5f                   	pop    %edi
+  801327:	5d                   	pop    %ebp
+  801328:	c3                   	ret
+
+00801329 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801329:	85 c0                	test   %eax,%eax
+  80132b:	74 20                	je     80134d <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80132d:	89 c1                	mov    %eax,%ecx
+  80132f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801335:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80133b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801341:	8b 52 48             	mov    0x48(%edx),%edx
+  801344:	39 c2                	cmp    %eax,%edx
+  801346:	74 06                	je     80134e <thread_alive+0x25>
+  801348:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80134d:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80134e:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801354:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	0f 95 c0             	setne  %al
+  80135f:	0f b6 c0             	movzbl %al,%eax
+  801362:	c3                   	ret
+
+00801363 <pgfault>:
+{
+  801363:	55                   	push   %ebp
+  801364:	89 e5                	mov    %esp,%ebp
+  801366:	57                   	push   %edi
+  801367:	56                   	push   %esi
+  801368:	53                   	push   %ebx
+  801369:	83 ec 0c             	sub    $0xc,%esp
+  80136c:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80136f:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801371:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801374:	89 f3                	mov    %esi,%ebx
+  801376:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801379:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801380:	74 52                	je     8013d4 <pgfault+0x71>
+  801382:	a8 02                	test   $0x2,%al
+  801384:	75 14                	jne    80139a <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801386:	83 ec 04             	sub    $0x4,%esp
+  801389:	68 36 4a 80 00       	push   $0x804a36
+  80138e:	6a 2e                	push   $0x2e
+  801390:	68 54 4a 80 00       	push   $0x804a54
+  801395:	e8 26 ef ff ff       	call   8002c0 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  80139a:	89 d8                	mov    %ebx,%eax
+  80139c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013a1:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	57                   	push   %edi
+  8013ac:	e8 79 2c 00 00       	call   80402a <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8013b1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8013b8:	83 e0 03             	and    $0x3,%eax
+  8013bb:	83 c4 10             	add    $0x10,%esp
+  8013be:	83 f8 03             	cmp    $0x3,%eax
+  8013c1:	75 1a                	jne    8013dd <pgfault+0x7a>
+			mutex_unlock(m);
+  8013c3:	83 ec 0c             	sub    $0xc,%esp
+  8013c6:	57                   	push   %edi
+  8013c7:	e8 cc 2c 00 00       	call   804098 <mutex_unlock>
+			return;
+  8013cc:	83 c4 10             	add    $0x10,%esp
+  8013cf:	e9 9f 00 00 00       	jmp    801473 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8013d4:	a8 02                	test   $0x2,%al
+  8013d6:	74 ae                	je     801386 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8013d8:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8013dd:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8013e4:	f6 c4 08             	test   $0x8,%ah
+  8013e7:	74 9d                	je     801386 <pgfault+0x23>
+  8013e9:	89 e0                	mov    %esp,%eax
+  8013eb:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8013f0:	29 c2                	sub    %eax,%edx
+  8013f2:	89 d0                	mov    %edx,%eax
+  8013f4:	c1 e8 0f             	shr    $0xf,%eax
+  8013f7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801402:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801405:	c1 e0 0c             	shl    $0xc,%eax
+  801408:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80140d:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80140f:	83 ec 04             	sub    $0x4,%esp
+  801412:	6a 07                	push   $0x7
+  801414:	53                   	push   %ebx
+  801415:	6a 00                	push   $0x0
+  801417:	e8 aa fa ff ff       	call   800ec6 <sys_page_alloc>
+  80141c:	83 c4 10             	add    $0x10,%esp
+  80141f:	85 c0                	test   %eax,%eax
+  801421:	78 58                	js     80147b <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801423:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801429:	83 ec 04             	sub    $0x4,%esp
+  80142c:	68 00 10 00 00       	push   $0x1000
+  801431:	56                   	push   %esi
+  801432:	53                   	push   %ebx
+  801433:	e8 0a f8 ff ff       	call   800c42 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  801438:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80143f:	56                   	push   %esi
+  801440:	6a 00                	push   $0x0
+  801442:	53                   	push   %ebx
+  801443:	6a 00                	push   $0x0
+  801445:	e8 bf fa ff ff       	call   800f09 <sys_page_map>
+  80144a:	83 c4 20             	add    $0x20,%esp
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	78 3c                	js     80148d <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801451:	83 ec 08             	sub    $0x8,%esp
+  801454:	53                   	push   %ebx
+  801455:	6a 00                	push   $0x0
+  801457:	e8 ef fa ff ff       	call   800f4b <sys_page_unmap>
+  80145c:	83 c4 10             	add    $0x10,%esp
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	78 3c                	js     80149f <pgfault+0x13c>
+	if(m)
+  801463:	85 ff                	test   %edi,%edi
+  801465:	74 0c                	je     801473 <pgfault+0x110>
+		mutex_unlock(m);
+  801467:	83 ec 0c             	sub    $0xc,%esp
+  80146a:	57                   	push   %edi
+  80146b:	e8 28 2c 00 00       	call   804098 <mutex_unlock>
+  801470:	83 c4 10             	add    $0x10,%esp
+}
+  801473:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801476:	5b                   	pop    %ebx
+  801477:	5e                   	pop    %esi
+  801478:	5f                   	pop    %edi
+  801479:	5d                   	pop    %ebp
+  80147a:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  80147b:	50                   	push   %eax
+  80147c:	68 5f 4a 80 00       	push   $0x804a5f
+  801481:	6a 3d                	push   $0x3d
+  801483:	68 54 4a 80 00       	push   $0x804a54
+  801488:	e8 33 ee ff ff       	call   8002c0 <_panic>
+		panic("sys_page_map: %e", ret);
+  80148d:	50                   	push   %eax
+  80148e:	68 72 4a 80 00       	push   $0x804a72
+  801493:	6a 40                	push   $0x40
+  801495:	68 54 4a 80 00       	push   $0x804a54
+  80149a:	e8 21 ee ff ff       	call   8002c0 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80149f:	50                   	push   %eax
+  8014a0:	68 83 4a 80 00       	push   $0x804a83
+  8014a5:	6a 42                	push   $0x42
+  8014a7:	68 54 4a 80 00       	push   $0x804a54
+  8014ac:	e8 0f ee ff ff       	call   8002c0 <_panic>
+
+008014b1 <thread_main>:
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8014b7:	ff 75 0c             	push   0xc(%ebp)
+  8014ba:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8014bd:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8014c4:	e8 7e f9 ff ff       	call   800e47 <sys_env_destroy>
+}
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	c9                   	leave
+  8014cd:	c3                   	ret
+
+008014ce <fork>:
+{
+  8014ce:	55                   	push   %ebp
+  8014cf:	89 e5                	mov    %esp,%ebp
+  8014d1:	57                   	push   %edi
+  8014d2:	56                   	push   %esi
+  8014d3:	53                   	push   %ebx
+  8014d4:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8014d7:	68 63 13 80 00       	push   $0x801363
+  8014dc:	e8 95 2e 00 00       	call   804376 <set_pgfault_handler>
+	if(sforked)
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8014eb:	75 33                	jne    801520 <fork+0x52>
+	__asm __volatile("int %2"
+  8014ed:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014f2:	cd 30                	int    $0x30
+  8014f4:	89 c7                	mov    %eax,%edi
+  8014f6:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	0f 88 b4 00 00 00    	js     8015b4 <fork+0xe6>
+	if(envid == 0) {
+  801500:	0f 84 c3 00 00 00    	je     8015c9 <fork+0xfb>
+	pgbatch_init(&pb);
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	68 20 63 80 00       	push   $0x806320
+  80150e:	e8 63 29 00 00       	call   803e76 <pgbatch_init>
+  801513:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801516:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151b:	e9 9c 01 00 00       	jmp    8016bc <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801520:	83 ec 0c             	sub    $0xc,%esp
+  801523:	68 c0 66 80 00       	push   $0x8066c0
+  801528:	e8 fd 2a 00 00       	call   80402a <mutex_lock>
+  80152d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801530:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801535:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80153a:	eb 08                	jmp    801544 <fork+0x76>
+  80153c:	83 c3 01             	add    $0x1,%ebx
+  80153f:	83 fb 20             	cmp    $0x20,%ebx
+  801542:	74 5b                	je     80159f <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801544:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  80154b:	89 f0                	mov    %esi,%eax
+  80154d:	e8 d7 fd ff ff       	call   801329 <thread_alive>
+  801552:	85 c0                	test   %eax,%eax
+  801554:	74 e6                	je     80153c <fork+0x6e>
+  801556:	89 e0                	mov    %esp,%eax
+  801558:	89 fa                	mov    %edi,%edx
+  80155a:	29 c2                	sub    %eax,%edx
+  80155c:	89 d0                	mov    %edx,%eax
+  80155e:	c1 e8 0f             	shr    $0xf,%eax
+  801561:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80156c:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80156f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801576:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801579:	83 ec 08             	sub    $0x8,%esp
+  80157c:	50                   	push   %eax
+  80157d:	56                   	push   %esi
+  80157e:	e8 8e fa ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  801583:	83 c4 10             	add    $0x10,%esp
+  801586:	85 c0                	test   %eax,%eax
+  801588:	79 b2                	jns    80153c <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  80158a:	50                   	push   %eax
+  80158b:	68 10 4b 80 00       	push   $0x804b10
+  801590:	68 00 01 00 00       	push   $0x100
+  801595:	68 54 4a 80 00       	push   $0x804a54
+  80159a:	e8 21 ed ff ff       	call   8002c0 <_panic>
+	mutex_unlock(&sfork_lock);
+  80159f:	83 ec 0c             	sub    $0xc,%esp
+  8015a2:	68 c0 66 80 00       	push   $0x8066c0
+  8015a7:	e8 ec 2a 00 00       	call   804098 <mutex_unlock>
+}
+  8015ac:	83 c4 10             	add    $0x10,%esp
+  8015af:	e9 39 ff ff ff       	jmp    8014ed <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8015b4:	50                   	push   %eax
+  8015b5:	68 96 4a 80 00       	push   $0x804a96
+  8015ba:	68 91 00 00 00       	push   $0x91
+  8015bf:	68 54 4a 80 00       	push   $0x804a54
+  8015c4:	e8 f7 ec ff ff       	call   8002c0 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8015c9:	e8 ba f8 ff ff       	call   800e88 <sys_getenvid>
+  8015ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015d3:	89 e1                	mov    %esp,%ecx
+  8015d5:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8015da:	29 ca                	sub    %ecx,%edx
+  8015dc:	89 d1                	mov    %edx,%ecx
+  8015de:	c1 e9 0f             	shr    $0xf,%ecx
+  8015e1:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8015e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ec:	0f 42 d1             	cmovb  %ecx,%edx
+  8015ef:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8015f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015fa:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801601:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801606:	85 c0                	test   %eax,%eax
+  801608:	75 07                	jne    801611 <fork+0x143>
+		return 0;
+  80160a:	89 c6                	mov    %eax,%esi
+  80160c:	e9 6f 02 00 00       	jmp    801880 <fork+0x3b2>
+  801611:	89 e2                	mov    %esp,%edx
+  801613:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801618:	29 d0                	sub    %edx,%eax
+  80161a:	89 c3                	mov    %eax,%ebx
+  80161c:	c1 eb 0f             	shr    $0xf,%ebx
+  80161f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80162c:	83 ec 04             	sub    $0x4,%esp
+  80162f:	68 80 00 00 00       	push   $0x80
+  801634:	6a 00                	push   $0x0
+  801636:	68 40 66 80 00       	push   $0x806640
+  80163b:	e8 cd f5 ff ff       	call   800c0d <memset>
+	thread_ids[slot] = sys_getenvid();
+  801640:	e8 43 f8 ff ff       	call   800e88 <sys_getenvid>
+  801645:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80164c:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  801653:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801658:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80165f:	e8 b8 29 00 00       	call   80401c <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801664:	83 c4 0c             	add    $0xc,%esp
+  801667:	68 07 04 00 00       	push   $0x407
+  80166c:	68 00 00 00 e1       	push   $0xe1000000
+  801671:	6a 00                	push   $0x0
+  801673:	e8 4e f8 ff ff       	call   800ec6 <sys_page_alloc>
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	0f 89 fd 01 00 00    	jns    801880 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801683:	50                   	push   %eax
+  801684:	68 5f 4a 80 00       	push   $0x804a5f
+  801689:	68 12 01 00 00       	push   $0x112
+  80168e:	68 54 4a 80 00       	push   $0x804a54
+  801693:	e8 28 ec ff ff       	call   8002c0 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801698:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80169e:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8016a4:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8016aa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016b0:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8016b6:	0f 87 4f 01 00 00    	ja     80180b <fork+0x33d>
+		pd = PDX(addr);
+  8016bc:	89 d8                	mov    %ebx,%eax
+  8016be:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8016c1:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8016c8:	f6 c2 01             	test   $0x1,%dl
+  8016cb:	74 cb                	je     801698 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8016cd:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8016d2:	0f 85 92 00 00 00    	jne    80176a <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8016d8:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8016de:	76 10                	jbe    8016f0 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8016e0:	89 d8                	mov    %ebx,%eax
+  8016e2:	f7 d8                	neg    %eax
+  8016e4:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8016e9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016ee:	74 ba                	je     8016aa <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8016f0:	89 d8                	mov    %ebx,%eax
+  8016f2:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8016f5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016fc:	f6 c2 01             	test   $0x1,%dl
+  8016ff:	74 a9                	je     8016aa <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801701:	89 c1                	mov    %eax,%ecx
+  801703:	c1 e1 0c             	shl    $0xc,%ecx
+  801706:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801709:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801710:	f6 c6 04             	test   $0x4,%dh
+  801713:	0f 85 8e 00 00 00    	jne    8017a7 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801719:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801720:	f6 c6 08             	test   $0x8,%dh
+  801723:	75 0f                	jne    801734 <fork+0x266>
+  801725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172c:	a8 02                	test   $0x2,%al
+  80172e:	0f 84 bb 00 00 00    	je     8017ef <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801734:	83 ec 08             	sub    $0x8,%esp
+  801737:	68 05 08 00 00       	push   $0x805
+  80173c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80173f:	50                   	push   %eax
+  801740:	56                   	push   %esi
+  801741:	50                   	push   %eax
+  801742:	6a 00                	push   $0x0
+  801744:	68 20 63 80 00       	push   $0x806320
+  801749:	e8 e6 27 00 00       	call   803f34 <pgbatch_map>
+  80174e:	83 c4 20             	add    $0x20,%esp
+  801751:	85 c0                	test   %eax,%eax
+  801753:	79 76                	jns    8017cb <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801755:	50                   	push   %eax
+  801756:	68 ba 4a 80 00       	push   $0x804aba
+  80175b:	68 bc 00 00 00       	push   $0xbc
+  801760:	68 54 4a 80 00       	push   $0x804a54
+  801765:	e8 56 eb ff ff       	call   8002c0 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	68 00 08 00 00       	push   $0x800
+  801772:	56                   	push   %esi
+  801773:	53                   	push   %ebx
+  801774:	6a 00                	push   $0x0
+  801776:	68 20 63 80 00       	push   $0x806320
+  80177b:	e8 5f 28 00 00       	call   803fdf <pgbatch_sharept>
+  801780:	83 c4 20             	add    $0x20,%esp
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 0b                	js     801792 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801787:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80178d:	e9 18 ff ff ff       	jmp    8016aa <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801792:	50                   	push   %eax
+  801793:	68 a6 4a 80 00       	push   $0x804aa6
+  801798:	68 b2 00 00 00       	push   $0xb2
+  80179d:	68 54 4a 80 00       	push   $0x804a54
+  8017a2:	e8 19 eb ff ff       	call   8002c0 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  8017a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ae:	83 ec 08             	sub    $0x8,%esp
+  8017b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017b6:	50                   	push   %eax
+  8017b7:	51                   	push   %ecx
+  8017b8:	56                   	push   %esi
+  8017b9:	51                   	push   %ecx
+  8017ba:	6a 00                	push   $0x0
+  8017bc:	68 20 63 80 00       	push   $0x806320
+  8017c1:	e8 6e 27 00 00       	call   803f34 <pgbatch_map>
+  8017c6:	83 c4 20             	add    $0x20,%esp
+  8017c9:	eb 17                	jmp    8017e2 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8017cb:	68 05 08 00 00       	push   $0x805
+  8017d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8017d3:	6a 00                	push   $0x0
+  8017d5:	68 20 63 80 00       	push   $0x806320
+  8017da:	e8 c9 27 00 00       	call   803fa8 <pgbatch_protect>
+  8017df:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8017e2:	85 c0                	test   %eax,%eax
+  8017e4:	0f 89 c0 fe ff ff    	jns    8016aa <fork+0x1dc>
+  8017ea:	e9 66 ff ff ff       	jmp    801755 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8017ef:	83 ec 08             	sub    $0x8,%esp
+  8017f2:	6a 05                	push   $0x5
+  8017f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017f7:	50                   	push   %eax
+  8017f8:	56                   	push   %esi
+  8017f9:	50                   	push   %eax
+  8017fa:	6a 00                	push   $0x0
+  8017fc:	68 20 63 80 00       	push   $0x806320
+  801801:	e8 2e 27 00 00       	call   803f34 <pgbatch_map>
+  801806:	83 c4 20             	add    $0x20,%esp
+  801809:	eb d7                	jmp    8017e2 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  80180b:	6a 07                	push   $0x7
+  80180d:	68 00 f0 bf ee       	push   $0xeebff000
+  801812:	57                   	push   %edi
+  801813:	68 20 63 80 00       	push   $0x806320
+  801818:	e8 e0 26 00 00       	call   803efd <pgbatch_alloc>
+  80181d:	83 c4 10             	add    $0x10,%esp
+  801820:	85 c0                	test   %eax,%eax
+  801822:	78 66                	js     80188a <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801824:	83 ec 0c             	sub    $0xc,%esp
+  801827:	68 20 63 80 00       	push   $0x806320
+  80182c:	e8 53 26 00 00       	call   803e84 <pgbatch_flush>
+  801831:	83 c4 10             	add    $0x10,%esp
+  801834:	85 c0                	test   %eax,%eax
+  801836:	78 52                	js     80188a <fork+0x3bc>
+  801838:	89 e2                	mov    %esp,%edx
+  80183a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80183f:	29 d0                	sub    %edx,%eax
+  801841:	89 c2                	mov    %eax,%edx
+  801843:	c1 ea 0f             	shr    $0xf,%edx
+  801846:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80184b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801850:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801853:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80185a:	8b 40 78             	mov    0x78(%eax),%eax
+  80185d:	83 ec 08             	sub    $0x8,%esp
+  801860:	50                   	push   %eax
+  801861:	57                   	push   %edi
+  801862:	e8 aa f7 ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  801867:	83 c4 10             	add    $0x10,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 31                	js     80189f <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  80186e:	83 ec 08             	sub    $0x8,%esp
+  801871:	6a 02                	push   $0x2
+  801873:	57                   	push   %edi
+  801874:	e8 14 f7 ff ff       	call   800f8d <sys_env_set_status>
+  801879:	83 c4 10             	add    $0x10,%esp
+  80187c:	85 c0                	test   %eax,%eax
+  80187e:	78 34                	js     8018b4 <fork+0x3e6>
+}
+  801880:	89 f0                	mov    %esi,%eax
+  801882:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801885:	5b                   	pop    %ebx
+  801886:	5e                   	pop    %esi
+  801887:	5f                   	pop    %edi
+  801888:	5d                   	pop    %ebp
+  801889:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  80188a:	50                   	push   %eax
+  80188b:	68 c6 4a 80 00       	push   $0x804ac6
+  801890:	68 c0 00 00 00       	push   $0xc0
+  801895:	68 54 4a 80 00       	push   $0x804a54
+  80189a:	e8 21 ea ff ff       	call   8002c0 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80189f:	50                   	push   %eax
+  8018a0:	68 db 4a 80 00       	push   $0x804adb
+  8018a5:	68 c2 00 00 00       	push   $0xc2
+  8018aa:	68 54 4a 80 00       	push   $0x804a54
+  8018af:	e8 0c ea ff ff       	call   8002c0 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8018b4:	50                   	push   %eax
+  8018b5:	68 f6 4a 80 00       	push   $0x804af6
+  8018ba:	68 c4 00 00 00       	push   $0xc4
+  8018bf:	68 54 4a 80 00       	push   $0x804a54
+  8018c4:	e8 f7 e9 ff ff       	call   8002c0 <_panic>
+
+008018c9 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8018c9:	55                   	push   %ebp
+  8018ca:	89 e5                	mov    %esp,%ebp
+  8018cc:	57                   	push   %edi
+  8018cd:	56                   	push   %esi
+  8018ce:	53                   	push   %ebx
+  8018cf:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8018d2:	68 c0 66 80 00       	push   $0x8066c0
+  8018d7:	e8 4e 27 00 00       	call   80402a <mutex_lock>
+  8018dc:	89 e2                	mov    %esp,%edx
+  8018de:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8018e3:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8018e5:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8018e8:	89 c3                	mov    %eax,%ebx
+  8018ea:	c1 eb 0f             	shr    $0xf,%ebx
+  8018ed:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018f7:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8018fa:	e8 89 f5 ff ff       	call   800e88 <sys_getenvid>
+  8018ff:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801906:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80190b:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801912:	e8 12 fa ff ff       	call   801329 <thread_alive>
+  801917:	85 c0                	test   %eax,%eax
+  801919:	74 24                	je     80193f <sfork+0x76>
+  80191b:	83 c3 01             	add    $0x1,%ebx
+  80191e:	83 fb 20             	cmp    $0x20,%ebx
+  801921:	75 e8                	jne    80190b <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801923:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801928:	83 ec 0c             	sub    $0xc,%esp
+  80192b:	68 c0 66 80 00       	push   $0x8066c0
+  801930:	e8 63 27 00 00       	call   804098 <mutex_unlock>
+	return r;
+}
+  801935:	89 f0                	mov    %esi,%eax
+  801937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80193a:	5b                   	pop    %ebx
+  80193b:	5e                   	pop    %esi
+  80193c:	5f                   	pop    %edi
+  80193d:	5d                   	pop    %ebp
+  80193e:	c3                   	ret
+	if (i == NTHREADS) {
+  80193f:	83 fb 20             	cmp    $0x20,%ebx
+  801942:	0f 84 53 01 00 00    	je     801a9b <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801948:	89 d8                	mov    %ebx,%eax
+  80194a:	c1 e0 0f             	shl    $0xf,%eax
+  80194d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801950:	83 ec 0c             	sub    $0xc,%esp
+  801953:	68 00 60 80 00       	push   $0x806000
+  801958:	e8 19 25 00 00       	call   803e76 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801967:	75 1f                	jne    801988 <sfork+0xbf>
+  801969:	68 07 04 00 00       	push   $0x407
+  80196e:	68 00 00 00 e1       	push   $0xe1000000
+  801973:	6a 00                	push   $0x0
+  801975:	68 00 60 80 00       	push   $0x806000
+  80197a:	e8 7e 25 00 00       	call   803efd <pgbatch_alloc>
+  80197f:	89 c6                	mov    %eax,%esi
+  801981:	83 c4 10             	add    $0x10,%esp
+  801984:	85 c0                	test   %eax,%eax
+  801986:	78 a0                	js     801928 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801988:	6a 07                	push   $0x7
+  80198a:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80198f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801992:	29 c8                	sub    %ecx,%eax
+  801994:	50                   	push   %eax
+  801995:	6a 00                	push   $0x0
+  801997:	68 00 60 80 00       	push   $0x806000
+  80199c:	e8 5c 25 00 00       	call   803efd <pgbatch_alloc>
+  8019a1:	89 c6                	mov    %eax,%esi
+  8019a3:	83 c4 10             	add    $0x10,%esp
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	0f 88 7a ff ff ff    	js     801928 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  8019ae:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  8019b3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019b6:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8019b8:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8019bd:	29 c8                	sub    %ecx,%eax
+  8019bf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019c2:	39 c7                	cmp    %eax,%edi
+  8019c4:	73 29                	jae    8019ef <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  8019c6:	6a 07                	push   $0x7
+  8019c8:	57                   	push   %edi
+  8019c9:	6a 00                	push   $0x0
+  8019cb:	68 00 60 80 00       	push   $0x806000
+  8019d0:	e8 28 25 00 00       	call   803efd <pgbatch_alloc>
+  8019d5:	89 c6                	mov    %eax,%esi
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	0f 88 46 ff ff ff    	js     801928 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  8019e2:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8019e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019eb:	39 c7                	cmp    %eax,%edi
+  8019ed:	72 d7                	jb     8019c6 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8019ef:	83 ec 0c             	sub    $0xc,%esp
+  8019f2:	68 00 60 80 00       	push   $0x806000
+  8019f7:	e8 88 24 00 00       	call   803e84 <pgbatch_flush>
+  8019fc:	89 c6                	mov    %eax,%esi
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	0f 88 1f ff ff ff    	js     801928 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801a09:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801a0e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a11:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801a13:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801a19:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a1c:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801a1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a22:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801a25:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801a28:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801a2d:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801a2f:	52                   	push   %edx
+  801a30:	50                   	push   %eax
+  801a31:	68 b1 14 80 00       	push   $0x8014b1
+  801a36:	e8 cc f8 ff ff       	call   801307 <sys_exofork_shared>
+  801a3b:	89 c6                	mov    %eax,%esi
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	0f 88 e0 fe ff ff    	js     801928 <sfork+0x5f>
+	thread_ids[i] = id;
+  801a48:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801a4f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a54:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801a5a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a5f:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801a66:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801a6d:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a70:	83 ec 08             	sub    $0x8,%esp
+  801a73:	6a 02                	push   $0x2
+  801a75:	56                   	push   %esi
+  801a76:	e8 12 f5 ff ff       	call   800f8d <sys_env_set_status>
+  801a7b:	89 c3                	mov    %eax,%ebx
+  801a7d:	83 c4 10             	add    $0x10,%esp
+  801a80:	85 c0                	test   %eax,%eax
+  801a82:	0f 89 a0 fe ff ff    	jns    801928 <sfork+0x5f>
+		sys_env_destroy(id);
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	56                   	push   %esi
+  801a8c:	e8 b6 f3 ff ff       	call   800e47 <sys_env_destroy>
+		goto out;
+  801a91:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a94:	89 de                	mov    %ebx,%esi
+		goto out;
+  801a96:	e9 8d fe ff ff       	jmp    801928 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801a9b:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801aa0:	e9 83 fe ff ff       	jmp    801928 <sfork+0x5f>
+
+00801aa5 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801aa5:	55                   	push   %ebp
+  801aa6:	89 e5                	mov    %esp,%ebp
+  801aa8:	56                   	push   %esi
+  801aa9:	53                   	push   %ebx
+  801aaa:	8b 75 08             	mov    0x8(%ebp),%esi
+  801aad:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ab0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801aba:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801abd:	83 ec 0c             	sub    $0xc,%esp
+  801ac0:	50                   	push   %eax
+  801ac1:	e8 b0 f5 ff ff       	call   801076 <sys_ipc_recv>
+  801ac6:	83 c4 10             	add    $0x10,%esp
+  801ac9:	85 c0                	test   %eax,%eax
+  801acb:	0f 88 8b 00 00 00    	js     801b5c <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801ad1:	85 f6                	test   %esi,%esi
+  801ad3:	74 2a                	je     801aff <ipc_recv+0x5a>
+  801ad5:	89 e2                	mov    %esp,%edx
+  801ad7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801adc:	29 d0                	sub    %edx,%eax
+  801ade:	89 c2                	mov    %eax,%edx
+  801ae0:	c1 ea 0f             	shr    $0xf,%edx
+  801ae3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aed:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801af0:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801af7:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801afd:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801aff:	85 db                	test   %ebx,%ebx
+  801b01:	74 2a                	je     801b2d <ipc_recv+0x88>
+  801b03:	89 e2                	mov    %esp,%edx
+  801b05:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b0a:	29 d0                	sub    %edx,%eax
+  801b0c:	89 c2                	mov    %eax,%edx
+  801b0e:	c1 ea 0f             	shr    $0xf,%edx
+  801b11:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b1b:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801b1e:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b25:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801b2b:	89 03                	mov    %eax,(%ebx)
+  801b2d:	89 e2                	mov    %esp,%edx
+  801b2f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b34:	29 d0                	sub    %edx,%eax
+  801b36:	89 c2                	mov    %eax,%edx
+  801b38:	c1 ea 0f             	shr    $0xf,%edx
+  801b3b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b45:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801b48:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b4f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801b55:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b58:	5b                   	pop    %ebx
+  801b59:	5e                   	pop    %esi
+  801b5a:	5d                   	pop    %ebp
+  801b5b:	c3                   	ret
+		if(from_env_store != NULL)
+  801b5c:	85 f6                	test   %esi,%esi
+  801b5e:	74 06                	je     801b66 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801b60:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801b66:	85 db                	test   %ebx,%ebx
+  801b68:	74 eb                	je     801b55 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801b6a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b70:	eb e3                	jmp    801b55 <ipc_recv+0xb0>
+
+00801b72 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	57                   	push   %edi
+  801b76:	56                   	push   %esi
+  801b77:	53                   	push   %ebx
+  801b78:	83 ec 14             	sub    $0x14,%esp
+  801b7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b81:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b84:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801b8e:	0f 44 c2             	cmove  %edx,%eax
+  801b91:	ff 75 10             	push   0x10(%ebp)
+  801b94:	50                   	push   %eax
+  801b95:	e8 3e f5 ff ff       	call   8010d8 <sys_ipc_recv_pages>
+  801b9a:	83 c4 10             	add    $0x10,%esp
+  801b9d:	85 c0                	test   %eax,%eax
+  801b9f:	0f 88 ba 00 00 00    	js     801c5f <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801ba5:	85 ff                	test   %edi,%edi
+  801ba7:	74 2a                	je     801bd3 <ipc_recv_pages+0x61>
+  801ba9:	89 e2                	mov    %esp,%edx
+  801bab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bb0:	29 d0                	sub    %edx,%eax
+  801bb2:	89 c2                	mov    %eax,%edx
+  801bb4:	c1 ea 0f             	shr    $0xf,%edx
+  801bb7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc1:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801bc4:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bcb:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801bd1:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801bd3:	85 f6                	test   %esi,%esi
+  801bd5:	74 2a                	je     801c01 <ipc_recv_pages+0x8f>
+  801bd7:	89 e2                	mov    %esp,%edx
+  801bd9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801bde:	29 d0                	sub    %edx,%eax
+  801be0:	89 c2                	mov    %eax,%edx
+  801be2:	c1 ea 0f             	shr    $0xf,%edx
+  801be5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bef:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801bf2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801bf9:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801bff:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801c01:	85 db                	test   %ebx,%ebx
+  801c03:	74 2a                	je     801c2f <ipc_recv_pages+0xbd>
+  801c05:	89 e2                	mov    %esp,%edx
+  801c07:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c0c:	29 d0                	sub    %edx,%eax
+  801c0e:	89 c2                	mov    %eax,%edx
+  801c10:	c1 ea 0f             	shr    $0xf,%edx
+  801c13:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801c20:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801c27:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801c2d:	89 03                	mov    %eax,(%ebx)
+  801c2f:	89 e2                	mov    %esp,%edx
+  801c31:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c36:	29 d0                	sub    %edx,%eax
+  801c38:	89 c2                	mov    %eax,%edx
+  801c3a:	c1 ea 0f             	shr    $0xf,%edx
+  801c3d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c42:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c47:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801c4a:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801c51:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801c57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5a:	5b                   	pop    %ebx
+  801c5b:	5e                   	pop    %esi
+  801c5c:	5f                   	pop    %edi
+  801c5d:	5d                   	pop    %ebp
+  801c5e:	c3                   	ret
+		if (from_env_store)
+  801c5f:	85 ff                	test   %edi,%edi
+  801c61:	74 06                	je     801c69 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801c63:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801c69:	85 f6                	test   %esi,%esi
+  801c6b:	74 06                	je     801c73 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801c6d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801c73:	85 db                	test   %ebx,%ebx
+  801c75:	74 e0                	je     801c57 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801c77:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801c7d:	eb d8                	jmp    801c57 <ipc_recv_pages+0xe5>
+
+00801c7f <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801c7f:	55                   	push   %ebp
+  801c80:	89 e5                	mov    %esp,%ebp
+  801c82:	57                   	push   %edi
+  801c83:	56                   	push   %esi
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 1c             	sub    $0x1c,%esp
+  801c88:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801c8b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c8e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801c94:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801c98:	75 2b                	jne    801cc5 <ipc_try_send_pages+0x46>
+  801c9a:	89 e2                	mov    %esp,%edx
+  801c9c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ca1:	29 d0                	sub    %edx,%eax
+  801ca3:	89 c2                	mov    %eax,%edx
+  801ca5:	c1 ea 0f             	shr    $0xf,%edx
+  801ca8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801cad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb2:	0f 42 c2             	cmovb  %edx,%eax
+  801cb5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801cbc:	8b 70 48             	mov    0x48(%eax),%esi
+  801cbf:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801cc5:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801ccb:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801cd0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cd3:	85 ff                	test   %edi,%edi
+  801cd5:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801cda:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801cdd:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801ce3:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801ce9:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	ff 75 14             	push   0x14(%ebp)
+  801cf5:	ff 75 18             	push   0x18(%ebp)
+  801cf8:	57                   	push   %edi
+  801cf9:	ff 75 0c             	push   0xc(%ebp)
+  801cfc:	ff 75 08             	push   0x8(%ebp)
+  801cff:	e8 b3 f3 ff ff       	call   8010b7 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801d04:	83 c4 20             	add    $0x20,%esp
+  801d07:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d0a:	75 21                	jne    801d2d <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801d0c:	83 ec 04             	sub    $0x4,%esp
+  801d0f:	6a ff                	push   $0xffffffff
+  801d11:	53                   	push   %ebx
+  801d12:	ff 75 e4             	push   -0x1c(%ebp)
+  801d15:	e8 aa f5 ff ff       	call   8012c4 <sys_futex_wait>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801d20:	74 c7                	je     801ce9 <ipc_try_send_pages+0x6a>
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	79 c3                	jns    801ce9 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801d26:	e8 7c f1 ff ff       	call   800ea7 <sys_yield>
+  801d2b:	eb bc                	jmp    801ce9 <ipc_try_send_pages+0x6a>
+	}
+}
+  801d2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d30:	5b                   	pop    %ebx
+  801d31:	5e                   	pop    %esi
+  801d32:	5f                   	pop    %edi
+  801d33:	5d                   	pop    %ebp
+  801d34:	c3                   	ret
+
+00801d35 <ipc_send>:
+{
+  801d35:	55                   	push   %ebp
+  801d36:	89 e5                	mov    %esp,%ebp
+  801d38:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801d3b:	ff 75 14             	push   0x14(%ebp)
+  801d3e:	6a 01                	push   $0x1
+  801d40:	ff 75 10             	push   0x10(%ebp)
+  801d43:	ff 75 0c             	push   0xc(%ebp)
+  801d46:	ff 75 08             	push   0x8(%ebp)
+  801d49:	e8 31 ff ff ff       	call   801c7f <ipc_try_send_pages>
+  801d4e:	83 c4 20             	add    $0x20,%esp
+  801d51:	85 c0                	test   %eax,%eax
+  801d53:	78 02                	js     801d57 <ipc_send+0x22>
+}
+  801d55:	c9                   	leave
+  801d56:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801d57:	50                   	push   %eax
+  801d58:	68 2f 4b 80 00       	push   $0x804b2f
+  801d5d:	6a 3f                	push   $0x3f
+  801d5f:	68 44 4b 80 00       	push   $0x804b44
+  801d64:	e8 57 e5 ff ff       	call   8002c0 <_panic>
+
+00801d69 <ipc_send_pages>:
+{
+  801d69:	55                   	push   %ebp
+  801d6a:	89 e5                	mov    %esp,%ebp
+  801d6c:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801d6f:	ff 75 18             	push   0x18(%ebp)
+  801d72:	ff 75 14             	push   0x14(%ebp)
+  801d75:	ff 75 10             	push   0x10(%ebp)
+  801d78:	ff 75 0c             	push   0xc(%ebp)
+  801d7b:	ff 75 08             	push   0x8(%ebp)
+  801d7e:	e8 fc fe ff ff       	call   801c7f <ipc_try_send_pages>
+  801d83:	83 c4 20             	add    $0x20,%esp
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 02                	js     801d8c <ipc_send_pages+0x23>
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  801d8c:	50                   	push   %eax
+  801d8d:	68 4e 4b 80 00       	push   $0x804b4e
+  801d92:	6a 64                	push   $0x64
+  801d94:	68 44 4b 80 00       	push   $0x804b44
+  801d99:	e8 22 e5 ff ff       	call   8002c0 <_panic>
+
+00801d9e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801d9e:	55                   	push   %ebp
+  801d9f:	89 e5                	mov    %esp,%ebp
+  801da1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801da4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  801da9:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  801daf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801db5:	8b 52 50             	mov    0x50(%edx),%edx
+  801db8:	39 ca                	cmp    %ecx,%edx
+  801dba:	74 11                	je     801dcd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801dbc:	83 c0 01             	add    $0x1,%eax
+  801dbf:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801dc4:	75 e3                	jne    801da9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801dc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dcb:	eb 0e                	jmp    801ddb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801dcd:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801dd3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dd8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801ddb:	5d                   	pop    %ebp
+  801ddc:	c3                   	ret
+
+00801ddd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801ddd:	55                   	push   %ebp
+  801dde:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801de0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de3:	05 00 00 00 30       	add    $0x30000000,%eax
+  801de8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801deb:	5d                   	pop    %ebp
+  801dec:	c3                   	ret
+
+00801ded <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ded:	55                   	push   %ebp
+  801dee:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801df8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dfd:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801e02:	5d                   	pop    %ebp
+  801e03:	c3                   	ret
+
+00801e04 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801e04:	55                   	push   %ebp
+  801e05:	89 e5                	mov    %esp,%ebp
+  801e07:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801e0c:	89 c2                	mov    %eax,%edx
+  801e0e:	c1 ea 16             	shr    $0x16,%edx
+  801e11:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e18:	f6 c2 01             	test   $0x1,%dl
+  801e1b:	74 29                	je     801e46 <fd_alloc+0x42>
+  801e1d:	89 c2                	mov    %eax,%edx
+  801e1f:	c1 ea 0c             	shr    $0xc,%edx
+  801e22:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e29:	f6 c2 01             	test   $0x1,%dl
+  801e2c:	74 18                	je     801e46 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801e2e:	05 00 10 00 00       	add    $0x1000,%eax
+  801e33:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801e38:	75 d2                	jne    801e0c <fd_alloc+0x8>
+  801e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801e3f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e44:	eb 05                	jmp    801e4b <fd_alloc+0x47>
+			return 0;
+  801e46:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801e4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e4e:	89 02                	mov    %eax,(%edx)
+}
+  801e50:	89 c8                	mov    %ecx,%eax
+  801e52:	5d                   	pop    %ebp
+  801e53:	c3                   	ret
+
+00801e54 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e5a:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801e5f:	77 30                	ja     801e91 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e61:	c1 e0 0c             	shl    $0xc,%eax
+  801e64:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801e69:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e6f:	f6 c2 01             	test   $0x1,%dl
+  801e72:	74 24                	je     801e98 <fd_lookup+0x44>
+  801e74:	89 c2                	mov    %eax,%edx
+  801e76:	c1 ea 0c             	shr    $0xc,%edx
+  801e79:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e80:	f6 c2 01             	test   $0x1,%dl
+  801e83:	74 1a                	je     801e9f <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e85:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e88:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+		return -E_INVAL;
+  801e91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e96:	eb f7                	jmp    801e8f <fd_lookup+0x3b>
+		return -E_INVAL;
+  801e98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e9d:	eb f0                	jmp    801e8f <fd_lookup+0x3b>
+  801e9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ea4:	eb e9                	jmp    801e8f <fd_lookup+0x3b>
+
+00801ea6 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801ea6:	55                   	push   %ebp
+  801ea7:	89 e5                	mov    %esp,%ebp
+  801ea9:	53                   	push   %ebx
+  801eaa:	83 ec 04             	sub    $0x4,%esp
+  801ead:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb5:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801eba:	39 13                	cmp    %edx,(%ebx)
+  801ebc:	74 54                	je     801f12 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801ebe:	83 c0 01             	add    $0x1,%eax
+  801ec1:	8b 1c 85 e8 4b 80 00 	mov    0x804be8(,%eax,4),%ebx
+  801ec8:	85 db                	test   %ebx,%ebx
+  801eca:	75 ee                	jne    801eba <dev_lookup+0x14>
+  801ecc:	89 e1                	mov    %esp,%ecx
+  801ece:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ed3:	29 c8                	sub    %ecx,%eax
+  801ed5:	89 c1                	mov    %eax,%ecx
+  801ed7:	c1 e9 0f             	shr    $0xf,%ecx
+  801eda:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ee7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801eee:	8b 40 48             	mov    0x48(%eax),%eax
+  801ef1:	83 ec 04             	sub    $0x4,%esp
+  801ef4:	52                   	push   %edx
+  801ef5:	50                   	push   %eax
+  801ef6:	68 6c 4b 80 00       	push   $0x804b6c
+  801efb:	e8 9b e4 ff ff       	call   80039b <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801f00:	83 c4 10             	add    $0x10,%esp
+  801f03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801f08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f0b:	89 1a                	mov    %ebx,(%edx)
+}
+  801f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+			return 0;
+  801f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f17:	eb ef                	jmp    801f08 <dev_lookup+0x62>
+
+00801f19 <fd_close>:
+{
+  801f19:	55                   	push   %ebp
+  801f1a:	89 e5                	mov    %esp,%ebp
+  801f1c:	57                   	push   %edi
+  801f1d:	56                   	push   %esi
+  801f1e:	53                   	push   %ebx
+  801f1f:	83 ec 24             	sub    $0x24,%esp
+  801f22:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f25:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f28:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f2b:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801f2c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801f32:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f35:	50                   	push   %eax
+  801f36:	e8 19 ff ff ff       	call   801e54 <fd_lookup>
+  801f3b:	89 c3                	mov    %eax,%ebx
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 05                	js     801f49 <fd_close+0x30>
+	    || fd != fd2)
+  801f44:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f47:	74 0f                	je     801f58 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801f49:	85 ff                	test   %edi,%edi
+  801f4b:	0f 44 df             	cmove  %edi,%ebx
+}
+  801f4e:	89 d8                	mov    %ebx,%eax
+  801f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f53:	5b                   	pop    %ebx
+  801f54:	5e                   	pop    %esi
+  801f55:	5f                   	pop    %edi
+  801f56:	5d                   	pop    %ebp
+  801f57:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f5e:	50                   	push   %eax
+  801f5f:	ff 36                	push   (%esi)
+  801f61:	e8 40 ff ff ff       	call   801ea6 <dev_lookup>
+  801f66:	89 c3                	mov    %eax,%ebx
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 1a                	js     801f89 <fd_close+0x70>
+		if (dev->dev_close)
+  801f6f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f72:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f75:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f7a:	85 c0                	test   %eax,%eax
+  801f7c:	74 0b                	je     801f89 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801f7e:	83 ec 0c             	sub    $0xc,%esp
+  801f81:	56                   	push   %esi
+  801f82:	ff d0                	call   *%eax
+  801f84:	89 c3                	mov    %eax,%ebx
+  801f86:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f89:	83 ec 08             	sub    $0x8,%esp
+  801f8c:	56                   	push   %esi
+  801f8d:	6a 00                	push   $0x0
+  801f8f:	e8 b7 ef ff ff       	call   800f4b <sys_page_unmap>
+	return r;
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	eb b5                	jmp    801f4e <fd_close+0x35>
+
+00801f99 <close>:
+
+int
+close(int fdnum)
+{
+  801f99:	55                   	push   %ebp
+  801f9a:	89 e5                	mov    %esp,%ebp
+  801f9c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa2:	50                   	push   %eax
+  801fa3:	ff 75 08             	push   0x8(%ebp)
+  801fa6:	e8 a9 fe ff ff       	call   801e54 <fd_lookup>
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	79 02                	jns    801fb4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801fb2:	c9                   	leave
+  801fb3:	c3                   	ret
+		return fd_close(fd, 1);
+  801fb4:	83 ec 08             	sub    $0x8,%esp
+  801fb7:	6a 01                	push   $0x1
+  801fb9:	ff 75 f4             	push   -0xc(%ebp)
+  801fbc:	e8 58 ff ff ff       	call   801f19 <fd_close>
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	eb ec                	jmp    801fb2 <close+0x19>
+
+00801fc6 <close_all>:
+
+void
+close_all(void)
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	53                   	push   %ebx
+  801fca:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801fcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801fd2:	83 ec 0c             	sub    $0xc,%esp
+  801fd5:	53                   	push   %ebx
+  801fd6:	e8 be ff ff ff       	call   801f99 <close>
+	for (i = 0; i < MAXFD; i++)
+  801fdb:	83 c3 01             	add    $0x1,%ebx
+  801fde:	83 c4 10             	add    $0x10,%esp
+  801fe1:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801fe7:	75 e9                	jne    801fd2 <close_all+0xc>
+}
+  801fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+
+00801fee <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	57                   	push   %edi
+  801ff2:	56                   	push   %esi
+  801ff3:	53                   	push   %ebx
+  801ff4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801ff7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ffa:	50                   	push   %eax
+  801ffb:	ff 75 08             	push   0x8(%ebp)
+  801ffe:	e8 51 fe ff ff       	call   801e54 <fd_lookup>
+  802003:	89 c3                	mov    %eax,%ebx
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	78 7f                	js     80208b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80200c:	83 ec 0c             	sub    $0xc,%esp
+  80200f:	ff 75 0c             	push   0xc(%ebp)
+  802012:	e8 82 ff ff ff       	call   801f99 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802017:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80201a:	c1 e6 0c             	shl    $0xc,%esi
+  80201d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  802023:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802026:	89 3c 24             	mov    %edi,(%esp)
+  802029:	e8 bf fd ff ff       	call   801ded <fd2data>
+  80202e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  802030:	89 34 24             	mov    %esi,(%esp)
+  802033:	e8 b5 fd ff ff       	call   801ded <fd2data>
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80203e:	89 d8                	mov    %ebx,%eax
+  802040:	c1 e8 16             	shr    $0x16,%eax
+  802043:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80204a:	a8 01                	test   $0x1,%al
+  80204c:	74 11                	je     80205f <dup+0x71>
+  80204e:	89 d8                	mov    %ebx,%eax
+  802050:	c1 e8 0c             	shr    $0xc,%eax
+  802053:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80205a:	f6 c2 01             	test   $0x1,%dl
+  80205d:	75 36                	jne    802095 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80205f:	89 f8                	mov    %edi,%eax
+  802061:	c1 e8 0c             	shr    $0xc,%eax
+  802064:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80206b:	83 ec 0c             	sub    $0xc,%esp
+  80206e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802073:	50                   	push   %eax
+  802074:	56                   	push   %esi
+  802075:	6a 00                	push   $0x0
+  802077:	57                   	push   %edi
+  802078:	6a 00                	push   $0x0
+  80207a:	e8 8a ee ff ff       	call   800f09 <sys_page_map>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	83 c4 20             	add    $0x20,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	78 33                	js     8020bb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802088:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80208b:	89 d8                	mov    %ebx,%eax
+  80208d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802090:	5b                   	pop    %ebx
+  802091:	5e                   	pop    %esi
+  802092:	5f                   	pop    %edi
+  802093:	5d                   	pop    %ebp
+  802094:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802095:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80209c:	83 ec 0c             	sub    $0xc,%esp
+  80209f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8020a4:	50                   	push   %eax
+  8020a5:	ff 75 d4             	push   -0x2c(%ebp)
+  8020a8:	6a 00                	push   $0x0
+  8020aa:	53                   	push   %ebx
+  8020ab:	6a 00                	push   $0x0
+  8020ad:	e8 57 ee ff ff       	call   800f09 <sys_page_map>
+  8020b2:	89 c3                	mov    %eax,%ebx
+  8020b4:	83 c4 20             	add    $0x20,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	79 a4                	jns    80205f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8020bb:	83 ec 08             	sub    $0x8,%esp
+  8020be:	56                   	push   %esi
+  8020bf:	6a 00                	push   $0x0
+  8020c1:	e8 85 ee ff ff       	call   800f4b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8020c6:	83 c4 08             	add    $0x8,%esp
+  8020c9:	ff 75 d4             	push   -0x2c(%ebp)
+  8020cc:	6a 00                	push   $0x0
+  8020ce:	e8 78 ee ff ff       	call   800f4b <sys_page_unmap>
+	return r;
+  8020d3:	83 c4 10             	add    $0x10,%esp
+  8020d6:	eb b3                	jmp    80208b <dup+0x9d>
+
+008020d8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8020d8:	55                   	push   %ebp
+  8020d9:	89 e5                	mov    %esp,%ebp
+  8020db:	56                   	push   %esi
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 18             	sub    $0x18,%esp
+  8020e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020e6:	50                   	push   %eax
+  8020e7:	53                   	push   %ebx
+  8020e8:	e8 67 fd ff ff       	call   801e54 <fd_lookup>
+  8020ed:	83 c4 10             	add    $0x10,%esp
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	78 3c                	js     802130 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020f7:	83 ec 08             	sub    $0x8,%esp
+  8020fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020fd:	50                   	push   %eax
+  8020fe:	ff 36                	push   (%esi)
+  802100:	e8 a1 fd ff ff       	call   801ea6 <dev_lookup>
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 24                	js     802130 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80210c:	8b 46 08             	mov    0x8(%esi),%eax
+  80210f:	83 e0 03             	and    $0x3,%eax
+  802112:	83 f8 01             	cmp    $0x1,%eax
+  802115:	74 20                	je     802137 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80211a:	8b 40 08             	mov    0x8(%eax),%eax
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	74 54                	je     802175 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802121:	83 ec 04             	sub    $0x4,%esp
+  802124:	ff 75 10             	push   0x10(%ebp)
+  802127:	ff 75 0c             	push   0xc(%ebp)
+  80212a:	56                   	push   %esi
+  80212b:	ff d0                	call   *%eax
+  80212d:	83 c4 10             	add    $0x10,%esp
+}
+  802130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802133:	5b                   	pop    %ebx
+  802134:	5e                   	pop    %esi
+  802135:	5d                   	pop    %ebp
+  802136:	c3                   	ret
+  802137:	89 e2                	mov    %esp,%edx
+  802139:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80213e:	29 d0                	sub    %edx,%eax
+  802140:	89 c2                	mov    %eax,%edx
+  802142:	c1 ea 0f             	shr    $0xf,%edx
+  802145:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80214a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802152:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802159:	8b 40 48             	mov    0x48(%eax),%eax
+  80215c:	83 ec 04             	sub    $0x4,%esp
+  80215f:	53                   	push   %ebx
+  802160:	50                   	push   %eax
+  802161:	68 ad 4b 80 00       	push   $0x804bad
+  802166:	e8 30 e2 ff ff       	call   80039b <cprintf>
+		return -E_INVAL;
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802173:	eb bb                	jmp    802130 <read+0x58>
+		return -E_NOT_SUPP;
+  802175:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80217a:	eb b4                	jmp    802130 <read+0x58>
+
+0080217c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	57                   	push   %edi
+  802180:	56                   	push   %esi
+  802181:	53                   	push   %ebx
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802188:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80218b:	85 f6                	test   %esi,%esi
+  80218d:	74 30                	je     8021bf <readn+0x43>
+  80218f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802194:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802199:	83 ec 04             	sub    $0x4,%esp
+  80219c:	89 f2                	mov    %esi,%edx
+  80219e:	29 c2                	sub    %eax,%edx
+  8021a0:	52                   	push   %edx
+  8021a1:	01 f8                	add    %edi,%eax
+  8021a3:	50                   	push   %eax
+  8021a4:	ff 75 08             	push   0x8(%ebp)
+  8021a7:	e8 2c ff ff ff       	call   8020d8 <read>
+		if (m < 0)
+  8021ac:	83 c4 10             	add    $0x10,%esp
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 15                	js     8021c8 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8021b3:	74 11                	je     8021c6 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8021b5:	01 c3                	add    %eax,%ebx
+  8021b7:	89 d8                	mov    %ebx,%eax
+  8021b9:	39 f3                	cmp    %esi,%ebx
+  8021bb:	72 dc                	jb     802199 <readn+0x1d>
+  8021bd:	eb 09                	jmp    8021c8 <readn+0x4c>
+  8021bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c4:	eb 02                	jmp    8021c8 <readn+0x4c>
+  8021c6:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8021c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021cb:	5b                   	pop    %ebx
+  8021cc:	5e                   	pop    %esi
+  8021cd:	5f                   	pop    %edi
+  8021ce:	5d                   	pop    %ebp
+  8021cf:	c3                   	ret
+
+008021d0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 18             	sub    $0x18,%esp
+  8021d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021de:	50                   	push   %eax
+  8021df:	53                   	push   %ebx
+  8021e0:	e8 6f fc ff ff       	call   801e54 <fd_lookup>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	78 37                	js     802223 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+  8021f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	ff 36                	push   (%esi)
+  8021f8:	e8 a9 fc ff ff       	call   801ea6 <dev_lookup>
+  8021fd:	83 c4 10             	add    $0x10,%esp
+  802200:	85 c0                	test   %eax,%eax
+  802202:	78 1f                	js     802223 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802204:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802208:	74 20                	je     80222a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80220a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802210:	85 c0                	test   %eax,%eax
+  802212:	74 54                	je     802268 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802214:	83 ec 04             	sub    $0x4,%esp
+  802217:	ff 75 10             	push   0x10(%ebp)
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	56                   	push   %esi
+  80221e:	ff d0                	call   *%eax
+  802220:	83 c4 10             	add    $0x10,%esp
+}
+  802223:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802226:	5b                   	pop    %ebx
+  802227:	5e                   	pop    %esi
+  802228:	5d                   	pop    %ebp
+  802229:	c3                   	ret
+  80222a:	89 e2                	mov    %esp,%edx
+  80222c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802231:	29 d0                	sub    %edx,%eax
+  802233:	89 c2                	mov    %eax,%edx
+  802235:	c1 ea 0f             	shr    $0xf,%edx
+  802238:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80223d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802242:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802245:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80224c:	8b 40 48             	mov    0x48(%eax),%eax
+  80224f:	83 ec 04             	sub    $0x4,%esp
+  802252:	53                   	push   %ebx
+  802253:	50                   	push   %eax
+  802254:	68 c9 4b 80 00       	push   $0x804bc9
+  802259:	e8 3d e1 ff ff       	call   80039b <cprintf>
+		return -E_INVAL;
+  80225e:	83 c4 10             	add    $0x10,%esp
+  802261:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802266:	eb bb                	jmp    802223 <write+0x53>
+		return -E_NOT_SUPP;
+  802268:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80226d:	eb b4                	jmp    802223 <write+0x53>
+
+0080226f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80226f:	55                   	push   %ebp
+  802270:	89 e5                	mov    %esp,%ebp
+  802272:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802275:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802278:	50                   	push   %eax
+  802279:	ff 75 08             	push   0x8(%ebp)
+  80227c:	e8 d3 fb ff ff       	call   801e54 <fd_lookup>
+  802281:	83 c4 10             	add    $0x10,%esp
+  802284:	85 c0                	test   %eax,%eax
+  802286:	78 0e                	js     802296 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802288:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80228b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80228e:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802291:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802296:	c9                   	leave
+  802297:	c3                   	ret
+
+00802298 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	53                   	push   %ebx
+  80229c:	83 ec 1c             	sub    $0x1c,%esp
+  80229f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	ff 75 08             	push   0x8(%ebp)
+  8022a9:	e8 a6 fb ff ff       	call   801e54 <fd_lookup>
+  8022ae:	83 c4 10             	add    $0x10,%esp
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 33                	js     8022e8 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8022b5:	83 fb 03             	cmp    $0x3,%ebx
+  8022b8:	74 28                	je     8022e2 <fcntl+0x4a>
+  8022ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022bf:	83 fb 04             	cmp    $0x4,%ebx
+  8022c2:	75 24                	jne    8022e8 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8022c4:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8022c7:	8b 41 08             	mov    0x8(%ecx),%eax
+  8022ca:	80 e4 ef             	and    $0xef,%ah
+  8022cd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022d0:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8022d6:	09 d0                	or     %edx,%eax
+  8022d8:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8022db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e0:	eb 06                	jmp    8022e8 <fcntl+0x50>
+		return fd->fd_omode;
+  8022e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022e5:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8022e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022eb:	c9                   	leave
+  8022ec:	c3                   	ret
+
+008022ed <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8022ed:	55                   	push   %ebp
+  8022ee:	89 e5                	mov    %esp,%ebp
+  8022f0:	56                   	push   %esi
+  8022f1:	53                   	push   %ebx
+  8022f2:	83 ec 18             	sub    $0x18,%esp
+  8022f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022f8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022fb:	50                   	push   %eax
+  8022fc:	53                   	push   %ebx
+  8022fd:	e8 52 fb ff ff       	call   801e54 <fd_lookup>
+  802302:	83 c4 10             	add    $0x10,%esp
+  802305:	85 c0                	test   %eax,%eax
+  802307:	78 34                	js     80233d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802309:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80230c:	83 ec 08             	sub    $0x8,%esp
+  80230f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802312:	50                   	push   %eax
+  802313:	ff 36                	push   (%esi)
+  802315:	e8 8c fb ff ff       	call   801ea6 <dev_lookup>
+  80231a:	83 c4 10             	add    $0x10,%esp
+  80231d:	85 c0                	test   %eax,%eax
+  80231f:	78 1c                	js     80233d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802321:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802325:	74 1d                	je     802344 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802327:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80232a:	8b 40 18             	mov    0x18(%eax),%eax
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	74 51                	je     802382 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802331:	83 ec 08             	sub    $0x8,%esp
+  802334:	ff 75 0c             	push   0xc(%ebp)
+  802337:	56                   	push   %esi
+  802338:	ff d0                	call   *%eax
+  80233a:	83 c4 10             	add    $0x10,%esp
+}
+  80233d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802340:	5b                   	pop    %ebx
+  802341:	5e                   	pop    %esi
+  802342:	5d                   	pop    %ebp
+  802343:	c3                   	ret
+  802344:	89 e2                	mov    %esp,%edx
+  802346:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80234b:	29 d0                	sub    %edx,%eax
+  80234d:	89 c2                	mov    %eax,%edx
+  80234f:	c1 ea 0f             	shr    $0xf,%edx
+  802352:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235c:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80235f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802366:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802369:	83 ec 04             	sub    $0x4,%esp
+  80236c:	53                   	push   %ebx
+  80236d:	50                   	push   %eax
+  80236e:	68 8c 4b 80 00       	push   $0x804b8c
+  802373:	e8 23 e0 ff ff       	call   80039b <cprintf>
+		return -E_INVAL;
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802380:	eb bb                	jmp    80233d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802382:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802387:	eb b4                	jmp    80233d <ftruncate+0x50>
+
+00802389 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802389:	55                   	push   %ebp
+  80238a:	89 e5                	mov    %esp,%ebp
+  80238c:	56                   	push   %esi
+  80238d:	53                   	push   %ebx
+  80238e:	83 ec 18             	sub    $0x18,%esp
+  802391:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802394:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802397:	50                   	push   %eax
+  802398:	ff 75 08             	push   0x8(%ebp)
+  80239b:	e8 b4 fa ff ff       	call   801e54 <fd_lookup>
+  8023a0:	83 c4 10             	add    $0x10,%esp
+  8023a3:	85 c0                	test   %eax,%eax
+  8023a5:	78 53                	js     8023fa <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8023aa:	83 ec 08             	sub    $0x8,%esp
+  8023ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023b0:	50                   	push   %eax
+  8023b1:	ff 36                	push   (%esi)
+  8023b3:	e8 ee fa ff ff       	call   801ea6 <dev_lookup>
+  8023b8:	83 c4 10             	add    $0x10,%esp
+  8023bb:	85 c0                	test   %eax,%eax
+  8023bd:	78 3b                	js     8023fa <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8023bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023c2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8023c6:	74 39                	je     802401 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8023c8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8023cb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8023d2:	00 00 00 
+	stat->st_isdir = 0;
+  8023d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023dc:	00 00 00 
+	stat->st_version = 0;
+  8023df:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8023e6:	00 00 00 
+	stat->st_dev = dev;
+  8023e9:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8023ef:	83 ec 08             	sub    $0x8,%esp
+  8023f2:	53                   	push   %ebx
+  8023f3:	56                   	push   %esi
+  8023f4:	ff 50 14             	call   *0x14(%eax)
+  8023f7:	83 c4 10             	add    $0x10,%esp
+}
+  8023fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023fd:	5b                   	pop    %ebx
+  8023fe:	5e                   	pop    %esi
+  8023ff:	5d                   	pop    %ebp
+  802400:	c3                   	ret
+		return -E_NOT_SUPP;
+  802401:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802406:	eb f2                	jmp    8023fa <fstat+0x71>
+
+00802408 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802408:	55                   	push   %ebp
+  802409:	89 e5                	mov    %esp,%ebp
+  80240b:	56                   	push   %esi
+  80240c:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80240d:	83 ec 08             	sub    $0x8,%esp
+  802410:	6a 00                	push   $0x0
+  802412:	ff 75 08             	push   0x8(%ebp)
+  802415:	e8 b7 01 00 00       	call   8025d1 <open>
+  80241a:	89 c3                	mov    %eax,%ebx
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	85 c0                	test   %eax,%eax
+  802421:	78 1b                	js     80243e <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	ff 75 0c             	push   0xc(%ebp)
+  802429:	50                   	push   %eax
+  80242a:	e8 5a ff ff ff       	call   802389 <fstat>
+  80242f:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802431:	89 1c 24             	mov    %ebx,(%esp)
+  802434:	e8 60 fb ff ff       	call   801f99 <close>
+	return r;
+  802439:	83 c4 10             	add    $0x10,%esp
+  80243c:	89 f3                	mov    %esi,%ebx
+}
+  80243e:	89 d8                	mov    %ebx,%eax
+  802440:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802443:	5b                   	pop    %ebx
+  802444:	5e                   	pop    %esi
+  802445:	5d                   	pop    %ebp
+  802446:	c3                   	ret
+
+00802447 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	89 c6                	mov    %eax,%esi
+  80244e:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802450:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802457:	74 27                	je     802480 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802459:	6a 07                	push   $0x7
+  80245b:	68 00 70 80 00       	push   $0x807000
+  802460:	56                   	push   %esi
+  802461:	ff 35 c4 66 80 00    	push   0x8066c4
+  802467:	e8 c9 f8 ff ff       	call   801d35 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80246c:	83 c4 0c             	add    $0xc,%esp
+  80246f:	6a 00                	push   $0x0
+  802471:	53                   	push   %ebx
+  802472:	6a 00                	push   $0x0
+  802474:	e8 2c f6 ff ff       	call   801aa5 <ipc_recv>
+}
+  802479:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80247c:	5b                   	pop    %ebx
+  80247d:	5e                   	pop    %esi
+  80247e:	5d                   	pop    %ebp
+  80247f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802480:	83 ec 0c             	sub    $0xc,%esp
+  802483:	6a 02                	push   $0x2
+  802485:	e8 14 f9 ff ff       	call   801d9e <ipc_find_env>
+  80248a:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80248f:	83 c4 10             	add    $0x10,%esp
+  802492:	eb c5                	jmp    802459 <fsipc+0x12>
+
+00802494 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80249a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80249d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024a0:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8024a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024a8:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8024ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8024b7:	e8 8b ff ff ff       	call   802447 <fsipc>
+}
+  8024bc:	c9                   	leave
+  8024bd:	c3                   	ret
+
+008024be <devfile_flush>:
+{
+  8024be:	55                   	push   %ebp
+  8024bf:	89 e5                	mov    %esp,%ebp
+  8024c1:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8024c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024ca:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8024cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8024d9:	e8 69 ff ff ff       	call   802447 <fsipc>
+}
+  8024de:	c9                   	leave
+  8024df:	c3                   	ret
+
+008024e0 <devfile_stat>:
+{
+  8024e0:	55                   	push   %ebp
+  8024e1:	89 e5                	mov    %esp,%ebp
+  8024e3:	53                   	push   %ebx
+  8024e4:	83 ec 04             	sub    $0x4,%esp
+  8024e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8024ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024f0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8024f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024ff:	e8 43 ff ff ff       	call   802447 <fsipc>
+  802504:	85 c0                	test   %eax,%eax
+  802506:	78 37                	js     80253f <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802508:	83 ec 08             	sub    $0x8,%esp
+  80250b:	68 00 70 80 00       	push   $0x807000
+  802510:	53                   	push   %ebx
+  802511:	e8 7c e5 ff ff       	call   800a92 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802516:	a1 80 70 80 00       	mov    0x807080,%eax
+  80251b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802521:	a1 84 70 80 00       	mov    0x807084,%eax
+  802526:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  80252c:	a1 88 70 80 00       	mov    0x807088,%eax
+  802531:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802537:	83 c4 10             	add    $0x10,%esp
+  80253a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80253f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802542:	c9                   	leave
+  802543:	c3                   	ret
+
+00802544 <devfile_write>:
+{
+  802544:	55                   	push   %ebp
+  802545:	89 e5                	mov    %esp,%ebp
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80254d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802552:	39 d0                	cmp    %edx,%eax
+  802554:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802557:	8b 55 08             	mov    0x8(%ebp),%edx
+  80255a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80255d:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  802563:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802568:	50                   	push   %eax
+  802569:	ff 75 0c             	push   0xc(%ebp)
+  80256c:	68 08 70 80 00       	push   $0x807008
+  802571:	e8 cc e6 ff ff       	call   800c42 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802580:	e8 c2 fe ff ff       	call   802447 <fsipc>
+}
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+00802587 <devfile_read>:
+{
+  802587:	55                   	push   %ebp
+  802588:	89 e5                	mov    %esp,%ebp
+  80258a:	53                   	push   %ebx
+  80258b:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80258e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802591:	8b 40 0c             	mov    0xc(%eax),%eax
+  802594:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802599:	8b 45 10             	mov    0x10(%ebp),%eax
+  80259c:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8025a1:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8025a6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8025ab:	e8 97 fe ff ff       	call   802447 <fsipc>
+  8025b0:	89 c3                	mov    %eax,%ebx
+  8025b2:	85 c0                	test   %eax,%eax
+  8025b4:	78 14                	js     8025ca <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8025b6:	83 ec 04             	sub    $0x4,%esp
+  8025b9:	50                   	push   %eax
+  8025ba:	68 00 70 80 00       	push   $0x807000
+  8025bf:	ff 75 0c             	push   0xc(%ebp)
+  8025c2:	e8 7b e6 ff ff       	call   800c42 <memmove>
+	return r;
+  8025c7:	83 c4 10             	add    $0x10,%esp
+}
+  8025ca:	89 d8                	mov    %ebx,%eax
+  8025cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+008025d1 <open>:
+{
+  8025d1:	55                   	push   %ebp
+  8025d2:	89 e5                	mov    %esp,%ebp
+  8025d4:	53                   	push   %ebx
+  8025d5:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8025d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025db:	50                   	push   %eax
+  8025dc:	e8 23 f8 ff ff       	call   801e04 <fd_alloc>
+  8025e1:	89 c3                	mov    %eax,%ebx
+  8025e3:	83 c4 10             	add    $0x10,%esp
+  8025e6:	85 c0                	test   %eax,%eax
+  8025e8:	78 2a                	js     802614 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8025ea:	83 ec 0c             	sub    $0xc,%esp
+  8025ed:	ff 75 08             	push   0x8(%ebp)
+  8025f0:	e8 51 e4 ff ff       	call   800a46 <strlen>
+  8025f5:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8025f8:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8025fd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802602:	7e 17                	jle    80261b <open+0x4a>
+	fd_close(fd, 1);
+  802604:	83 ec 08             	sub    $0x8,%esp
+  802607:	6a 01                	push   $0x1
+  802609:	ff 75 f4             	push   -0xc(%ebp)
+  80260c:	e8 08 f9 ff ff       	call   801f19 <fd_close>
+	return r;
+  802611:	83 c4 10             	add    $0x10,%esp
+}
+  802614:	89 d8                	mov    %ebx,%eax
+  802616:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802619:	c9                   	leave
+  80261a:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80261b:	83 ec 08             	sub    $0x8,%esp
+  80261e:	ff 75 08             	push   0x8(%ebp)
+  802621:	68 00 70 80 00       	push   $0x807000
+  802626:	e8 67 e4 ff ff       	call   800a92 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80262b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80262e:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802633:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802636:	b8 01 00 00 00       	mov    $0x1,%eax
+  80263b:	e8 07 fe ff ff       	call   802447 <fsipc>
+  802640:	89 c3                	mov    %eax,%ebx
+  802642:	83 c4 10             	add    $0x10,%esp
+  802645:	85 c0                	test   %eax,%eax
+  802647:	78 bb                	js     802604 <open+0x33>
+	return fd2num(fd); 	
+  802649:	83 ec 0c             	sub    $0xc,%esp
+  80264c:	ff 75 f4             	push   -0xc(%ebp)
+  80264f:	e8 89 f7 ff ff       	call   801ddd <fd2num>
+  802654:	89 c3                	mov    %eax,%ebx
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	eb b9                	jmp    802614 <open+0x43>
+
+0080265b <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  80265b:	55                   	push   %ebp
+  80265c:	89 e5                	mov    %esp,%ebp
+  80265e:	53                   	push   %ebx
+  80265f:	83 ec 1c             	sub    $0x1c,%esp
+  802662:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802665:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802668:	50                   	push   %eax
+  802669:	ff 75 08             	push   0x8(%ebp)
+  80266c:	e8 e3 f7 ff ff       	call   801e54 <fd_lookup>
+  802671:	83 c4 10             	add    $0x10,%esp
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 5a                	js     8026d2 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802678:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267b:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802681:	39 10                	cmp    %edx,(%eax)
+  802683:	75 66                	jne    8026eb <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802685:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  80268c:	74 49                	je     8026d7 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80268e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802691:	8b 40 0c             	mov    0xc(%eax),%eax
+  802694:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802699:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80269c:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  8026a1:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8026a7:	6a 07                	push   $0x7
+  8026a9:	68 00 70 80 00       	push   $0x807000
+  8026ae:	6a 09                	push   $0x9
+  8026b0:	ff 35 c4 66 80 00    	push   0x8066c4
+  8026b6:	e8 7a f6 ff ff       	call   801d35 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8026bb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	53                   	push   %ebx
+  8026c5:	ff 75 10             	push   0x10(%ebp)
+  8026c8:	6a 00                	push   $0x0
+  8026ca:	e8 a3 f4 ff ff       	call   801b72 <ipc_recv_pages>
+  8026cf:	83 c4 20             	add    $0x20,%esp
+}
+  8026d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026d7:	83 ec 0c             	sub    $0xc,%esp
+  8026da:	6a 02                	push   $0x2
+  8026dc:	e8 bd f6 ff ff       	call   801d9e <ipc_find_env>
+  8026e1:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8026e6:	83 c4 10             	add    $0x10,%esp
+  8026e9:	eb a3                	jmp    80268e <fmap+0x33>
+		return -E_INVAL;
+  8026eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026f0:	eb e0                	jmp    8026d2 <fmap+0x77>
+
+008026f2 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8026f2:	55                   	push   %ebp
+  8026f3:	89 e5                	mov    %esp,%ebp
+  8026f5:	53                   	push   %ebx
+  8026f6:	83 ec 10             	sub    $0x10,%esp
+  8026f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8026fc:	53                   	push   %ebx
+  8026fd:	e8 44 e3 ff ff       	call   800a46 <strlen>
+  802702:	83 c4 10             	add    $0x10,%esp
+  802705:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80270a:	7f 25                	jg     802731 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80270c:	83 ec 08             	sub    $0x8,%esp
+  80270f:	53                   	push   %ebx
+  802710:	68 00 70 80 00       	push   $0x807000
+  802715:	e8 78 e3 ff ff       	call   800a92 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80271a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802724:	e8 1e fd ff ff       	call   802447 <fsipc>
+  802729:	83 c4 10             	add    $0x10,%esp
+}
+  80272c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80272f:	c9                   	leave
+  802730:	c3                   	ret
+		return -E_BAD_PATH;
+  802731:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802736:	eb f4                	jmp    80272c <remove+0x3a>
+
+00802738 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80273e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802743:	b8 08 00 00 00       	mov    $0x8,%eax
+  802748:	e8 fa fc ff ff       	call   802447 <fsipc>
+}
+  80274d:	c9                   	leave
+  80274e:	c3                   	ret
+
+0080274f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80274f:	55                   	push   %ebp
+  802750:	89 e5                	mov    %esp,%ebp
+  802752:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  802755:	89 c2                	mov    %eax,%edx
+  802757:	c1 ea 16             	shr    $0x16,%edx
+  80275a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802761:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  802766:	f6 c1 01             	test   $0x1,%cl
+  802769:	74 1e                	je     802789 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80276b:	c1 e8 0c             	shr    $0xc,%eax
+  80276e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802775:	a8 01                	test   $0x1,%al
+  802777:	74 10                	je     802789 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802779:	c1 e8 0c             	shr    $0xc,%eax
+  80277c:	c1 e0 04             	shl    $0x4,%eax
+  80277f:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  802786:	0f b7 d2             	movzwl %dx,%edx
+}
+  802789:	89 d0                	mov    %edx,%eax
+  80278b:	5d                   	pop    %ebp
+  80278c:	c3                   	ret
+
+0080278d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80278d:	55                   	push   %ebp
+  80278e:	89 e5                	mov    %esp,%ebp
+  802790:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802793:	68 fc 4b 80 00       	push   $0x804bfc
+  802798:	ff 75 0c             	push   0xc(%ebp)
+  80279b:	e8 f2 e2 ff ff       	call   800a92 <strcpy>
+	return 0;
+}
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a5:	c9                   	leave
+  8027a6:	c3                   	ret
+
+008027a7 <devsock_close>:
+{
+  8027a7:	55                   	push   %ebp
+  8027a8:	89 e5                	mov    %esp,%ebp
+  8027aa:	53                   	push   %ebx
+  8027ab:	83 ec 10             	sub    $0x10,%esp
+  8027ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8027b1:	53                   	push   %ebx
+  8027b2:	e8 98 ff ff ff       	call   80274f <pageref>
+  8027b7:	89 c2                	mov    %eax,%edx
+  8027b9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8027c1:	83 fa 01             	cmp    $0x1,%edx
+  8027c4:	74 05                	je     8027cb <devsock_close+0x24>
+}
+  8027c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c9:	c9                   	leave
+  8027ca:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8027cb:	83 ec 0c             	sub    $0xc,%esp
+  8027ce:	ff 73 0c             	push   0xc(%ebx)
+  8027d1:	e8 b0 05 00 00       	call   802d86 <nsipc_close>
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	eb eb                	jmp    8027c6 <devsock_close+0x1f>
+
+008027db <devsock_write>:
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	53                   	push   %ebx
+  8027df:	83 ec 14             	sub    $0x14,%esp
+  8027e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8027e8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8027eb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8027ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8027f1:	8b 41 08             	mov    0x8(%ecx),%eax
+  8027f4:	c1 f8 09             	sar    $0x9,%eax
+  8027f7:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8027fa:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802800:	77 13                	ja     802815 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802802:	50                   	push   %eax
+  802803:	52                   	push   %edx
+  802804:	53                   	push   %ebx
+  802805:	ff 71 0c             	push   0xc(%ecx)
+  802808:	e8 5c 06 00 00       	call   802e69 <nsipc_send>
+  80280d:	83 c4 10             	add    $0x10,%esp
+}
+  802810:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802813:	c9                   	leave
+  802814:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802815:	50                   	push   %eax
+  802816:	6a 01                	push   $0x1
+  802818:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80281b:	50                   	push   %eax
+  80281c:	ff 71 0c             	push   0xc(%ecx)
+  80281f:	e8 a6 06 00 00       	call   802eca <nsipc_sendmsg>
+  802824:	83 c4 10             	add    $0x10,%esp
+  802827:	eb e7                	jmp    802810 <devsock_write+0x35>
+
+00802829 <devsock_read>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	53                   	push   %ebx
+  80282d:	83 ec 14             	sub    $0x14,%esp
+  802830:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802833:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802836:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802839:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80283c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80283f:	8b 41 08             	mov    0x8(%ecx),%eax
+  802842:	c1 f8 09             	sar    $0x9,%eax
+  802845:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802848:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80284e:	77 13                	ja     802863 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802850:	50                   	push   %eax
+  802851:	52                   	push   %edx
+  802852:	53                   	push   %ebx
+  802853:	ff 71 0c             	push   0xc(%ecx)
+  802856:	e8 9c 05 00 00       	call   802df7 <nsipc_recv>
+  80285b:	83 c4 10             	add    $0x10,%esp
+}
+  80285e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802861:	c9                   	leave
+  802862:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802863:	50                   	push   %eax
+  802864:	6a 01                	push   $0x1
+  802866:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802869:	50                   	push   %eax
+  80286a:	ff 71 0c             	push   0xc(%ecx)
+  80286d:	e8 02 0a 00 00       	call   803274 <nsipc_recvmsg>
+  802872:	83 c4 10             	add    $0x10,%esp
+  802875:	eb e7                	jmp    80285e <devsock_read+0x35>
+
+00802877 <fd2sockid>:
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80287d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802880:	52                   	push   %edx
+  802881:	50                   	push   %eax
+  802882:	e8 cd f5 ff ff       	call   801e54 <fd_lookup>
+  802887:	83 c4 10             	add    $0x10,%esp
+  80288a:	85 c0                	test   %eax,%eax
+  80288c:	78 10                	js     80289e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80288e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802891:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802897:	39 08                	cmp    %ecx,(%eax)
+  802899:	75 05                	jne    8028a0 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80289b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80289e:	c9                   	leave
+  80289f:	c3                   	ret
+		return -E_NOT_SUPP;
+  8028a0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8028a5:	eb f7                	jmp    80289e <fd2sockid+0x27>
+
+008028a7 <sock_flags>:
+{
+  8028a7:	55                   	push   %ebp
+  8028a8:	89 e5                	mov    %esp,%ebp
+  8028aa:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8028ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028b0:	52                   	push   %edx
+  8028b1:	50                   	push   %eax
+  8028b2:	e8 9d f5 ff ff       	call   801e54 <fd_lookup>
+  8028b7:	83 c4 10             	add    $0x10,%esp
+  8028ba:	85 c0                	test   %eax,%eax
+  8028bc:	78 0e                	js     8028cc <sock_flags+0x25>
+  8028be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c1:	8b 40 08             	mov    0x8(%eax),%eax
+  8028c4:	c1 e8 09             	shr    $0x9,%eax
+  8028c7:	83 e0 08             	and    $0x8,%eax
+}
+  8028ca:	c9                   	leave
+  8028cb:	c3                   	ret
+		return 0;
+  8028cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d1:	eb f7                	jmp    8028ca <sock_flags+0x23>
+
+008028d3 <alloc_sockfd>:
+{
+  8028d3:	55                   	push   %ebp
+  8028d4:	89 e5                	mov    %esp,%ebp
+  8028d6:	56                   	push   %esi
+  8028d7:	53                   	push   %ebx
+  8028d8:	83 ec 1c             	sub    $0x1c,%esp
+  8028db:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8028dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e0:	50                   	push   %eax
+  8028e1:	e8 1e f5 ff ff       	call   801e04 <fd_alloc>
+  8028e6:	89 c3                	mov    %eax,%ebx
+  8028e8:	83 c4 10             	add    $0x10,%esp
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	78 43                	js     802932 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8028ef:	83 ec 04             	sub    $0x4,%esp
+  8028f2:	68 07 04 00 00       	push   $0x407
+  8028f7:	ff 75 f4             	push   -0xc(%ebp)
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	e8 c5 e5 ff ff       	call   800ec6 <sys_page_alloc>
+  802901:	89 c3                	mov    %eax,%ebx
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	85 c0                	test   %eax,%eax
+  802908:	78 28                	js     802932 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80290a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80290d:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802913:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802915:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802918:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80291f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802922:	83 ec 0c             	sub    $0xc,%esp
+  802925:	50                   	push   %eax
+  802926:	e8 b2 f4 ff ff       	call   801ddd <fd2num>
+  80292b:	89 c3                	mov    %eax,%ebx
+  80292d:	83 c4 10             	add    $0x10,%esp
+  802930:	eb 0c                	jmp    80293e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802932:	83 ec 0c             	sub    $0xc,%esp
+  802935:	56                   	push   %esi
+  802936:	e8 4b 04 00 00       	call   802d86 <nsipc_close>
+		return r;
+  80293b:	83 c4 10             	add    $0x10,%esp
+}
+  80293e:	89 d8                	mov    %ebx,%eax
+  802940:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5d                   	pop    %ebp
+  802946:	c3                   	ret
+
+00802947 <accept>:
+{
+  802947:	55                   	push   %ebp
+  802948:	89 e5                	mov    %esp,%ebp
+  80294a:	56                   	push   %esi
+  80294b:	53                   	push   %ebx
+  80294c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80294f:	89 f0                	mov    %esi,%eax
+  802951:	e8 21 ff ff ff       	call   802877 <fd2sockid>
+  802956:	89 c3                	mov    %eax,%ebx
+  802958:	85 c0                	test   %eax,%eax
+  80295a:	78 24                	js     802980 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  80295c:	89 f0                	mov    %esi,%eax
+  80295e:	e8 44 ff ff ff       	call   8028a7 <sock_flags>
+  802963:	50                   	push   %eax
+  802964:	ff 75 10             	push   0x10(%ebp)
+  802967:	ff 75 0c             	push   0xc(%ebp)
+  80296a:	53                   	push   %ebx
+  80296b:	e8 6b 03 00 00       	call   802cdb <nsipc_accept>
+  802970:	89 c3                	mov    %eax,%ebx
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	85 c0                	test   %eax,%eax
+  802977:	78 07                	js     802980 <accept+0x39>
+	return alloc_sockfd(r);
+  802979:	e8 55 ff ff ff       	call   8028d3 <alloc_sockfd>
+  80297e:	89 c3                	mov    %eax,%ebx
+}
+  802980:	89 d8                	mov    %ebx,%eax
+  802982:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802985:	5b                   	pop    %ebx
+  802986:	5e                   	pop    %esi
+  802987:	5d                   	pop    %ebp
+  802988:	c3                   	ret
+
+00802989 <bind>:
+{
+  802989:	55                   	push   %ebp
+  80298a:	89 e5                	mov    %esp,%ebp
+  80298c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80298f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802992:	e8 e0 fe ff ff       	call   802877 <fd2sockid>
+  802997:	85 c0                	test   %eax,%eax
+  802999:	78 12                	js     8029ad <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80299b:	83 ec 04             	sub    $0x4,%esp
+  80299e:	ff 75 10             	push   0x10(%ebp)
+  8029a1:	ff 75 0c             	push   0xc(%ebp)
+  8029a4:	50                   	push   %eax
+  8029a5:	e8 85 03 00 00       	call   802d2f <nsipc_bind>
+  8029aa:	83 c4 10             	add    $0x10,%esp
+}
+  8029ad:	c9                   	leave
+  8029ae:	c3                   	ret
+
+008029af <shutdown>:
+{
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b8:	e8 ba fe ff ff       	call   802877 <fd2sockid>
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 0f                	js     8029d0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8029c1:	83 ec 08             	sub    $0x8,%esp
+  8029c4:	ff 75 0c             	push   0xc(%ebp)
+  8029c7:	50                   	push   %eax
+  8029c8:	e8 97 03 00 00       	call   802d64 <nsipc_shutdown>
+  8029cd:	83 c4 10             	add    $0x10,%esp
+}
+  8029d0:	c9                   	leave
+  8029d1:	c3                   	ret
+
+008029d2 <connect>:
+{
+  8029d2:	55                   	push   %ebp
+  8029d3:	89 e5                	mov    %esp,%ebp
+  8029d5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029db:	e8 97 fe ff ff       	call   802877 <fd2sockid>
+  8029e0:	85 c0                	test   %eax,%eax
+  8029e2:	78 12                	js     8029f6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8029e4:	83 ec 04             	sub    $0x4,%esp
+  8029e7:	ff 75 10             	push   0x10(%ebp)
+  8029ea:	ff 75 0c             	push   0xc(%ebp)
+  8029ed:	50                   	push   %eax
+  8029ee:	e8 ad 03 00 00       	call   802da0 <nsipc_connect>
+  8029f3:	83 c4 10             	add    $0x10,%esp
+}
+  8029f6:	c9                   	leave
+  8029f7:	c3                   	ret
+
+008029f8 <listen>:
+{
+  8029f8:	55                   	push   %ebp
+  8029f9:	89 e5                	mov    %esp,%ebp
+  8029fb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8029fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a01:	e8 71 fe ff ff       	call   802877 <fd2sockid>
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 0f                	js     802a19 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802a0a:	83 ec 08             	sub    $0x8,%esp
+  802a0d:	ff 75 0c             	push   0xc(%ebp)
+  802a10:	50                   	push   %eax
+  802a11:	e8 bf 03 00 00       	call   802dd5 <nsipc_listen>
+  802a16:	83 c4 10             	add    $0x10,%esp
+}
+  802a19:	c9                   	leave
+  802a1a:	c3                   	ret
+
+00802a1b <sendmsg>:
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	57                   	push   %edi
+  802a1f:	56                   	push   %esi
+  802a20:	53                   	push   %ebx
+  802a21:	83 ec 0c             	sub    $0xc,%esp
+  802a24:	8b 75 08             	mov    0x8(%ebp),%esi
+  802a27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802a2a:	89 f0                	mov    %esi,%eax
+  802a2c:	e8 46 fe ff ff       	call   802877 <fd2sockid>
+  802a31:	89 c3                	mov    %eax,%ebx
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	78 1c                	js     802a53 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802a37:	89 f0                	mov    %esi,%eax
+  802a39:	e8 69 fe ff ff       	call   8028a7 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802a3e:	0b 45 10             	or     0x10(%ebp),%eax
+  802a41:	50                   	push   %eax
+  802a42:	ff 77 0c             	push   0xc(%edi)
+  802a45:	ff 77 08             	push   0x8(%edi)
+  802a48:	53                   	push   %ebx
+  802a49:	e8 7c 04 00 00       	call   802eca <nsipc_sendmsg>
+  802a4e:	89 c3                	mov    %eax,%ebx
+  802a50:	83 c4 10             	add    $0x10,%esp
+}
+  802a53:	89 d8                	mov    %ebx,%eax
+  802a55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a58:	5b                   	pop    %ebx
+  802a59:	5e                   	pop    %esi
+  802a5a:	5f                   	pop    %edi
+  802a5b:	5d                   	pop    %ebp
+  802a5c:	c3                   	ret
+
+00802a5d <recvmsg>:
+{
+  802a5d:	55                   	push   %ebp
+  802a5e:	89 e5                	mov    %esp,%ebp
+  802a60:	57                   	push   %edi
+  802a61:	56                   	push   %esi
+  802a62:	53                   	push   %ebx
+  802a63:	83 ec 0c             	sub    $0xc,%esp
+  802a66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a69:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802a6c:	89 f8                	mov    %edi,%eax
+  802a6e:	e8 04 fe ff ff       	call   802877 <fd2sockid>
+  802a73:	89 c3                	mov    %eax,%ebx
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	78 2a                	js     802aa3 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802a79:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802a80:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802a87:	89 f8                	mov    %edi,%eax
+  802a89:	e8 19 fe ff ff       	call   8028a7 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802a8e:	0b 45 10             	or     0x10(%ebp),%eax
+  802a91:	50                   	push   %eax
+  802a92:	ff 76 0c             	push   0xc(%esi)
+  802a95:	ff 76 08             	push   0x8(%esi)
+  802a98:	53                   	push   %ebx
+  802a99:	e8 d6 07 00 00       	call   803274 <nsipc_recvmsg>
+  802a9e:	89 c3                	mov    %eax,%ebx
+  802aa0:	83 c4 10             	add    $0x10,%esp
+}
+  802aa3:	89 d8                	mov    %ebx,%eax
+  802aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aa8:	5b                   	pop    %ebx
+  802aa9:	5e                   	pop    %esi
+  802aaa:	5f                   	pop    %edi
+  802aab:	5d                   	pop    %ebp
+  802aac:	c3                   	ret
+
+00802aad <sendfile>:
+{
+  802aad:	55                   	push   %ebp
+  802aae:	89 e5                	mov    %esp,%ebp
+  802ab0:	56                   	push   %esi
+  802ab1:	53                   	push   %ebx
+  802ab2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802ab5:	89 f0                	mov    %esi,%eax
+  802ab7:	e8 bb fd ff ff       	call   802877 <fd2sockid>
+  802abc:	89 c3                	mov    %eax,%ebx
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	78 1f                	js     802ae1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802ac2:	89 f0                	mov    %esi,%eax
+  802ac4:	e8 de fd ff ff       	call   8028a7 <sock_flags>
+  802ac9:	83 ec 0c             	sub    $0xc,%esp
+  802acc:	50                   	push   %eax
+  802acd:	ff 75 14             	push   0x14(%ebp)
+  802ad0:	ff 75 10             	push   0x10(%ebp)
+  802ad3:	ff 75 0c             	push   0xc(%ebp)
+  802ad6:	53                   	push   %ebx
+  802ad7:	e8 64 06 00 00       	call   803140 <nsipc_sendfile>
+  802adc:	89 c3                	mov    %eax,%ebx
+  802ade:	83 c4 20             	add    $0x20,%esp
+}
+  802ae1:	89 d8                	mov    %ebx,%eax
+  802ae3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ae6:	5b                   	pop    %ebx
+  802ae7:	5e                   	pop    %esi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+
+00802aea <evctl>:
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	53                   	push   %ebx
+  802aee:	83 ec 04             	sub    $0x4,%esp
+  802af1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802af4:	89 d8                	mov    %ebx,%eax
+  802af6:	e8 7c fd ff ff       	call   802877 <fd2sockid>
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	78 10                	js     802b0f <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802aff:	83 ec 04             	sub    $0x4,%esp
+  802b02:	53                   	push   %ebx
+  802b03:	ff 75 0c             	push   0xc(%ebp)
+  802b06:	50                   	push   %eax
+  802b07:	e8 d2 0b 00 00       	call   8036de <nsipc_evctl>
+  802b0c:	83 c4 10             	add    $0x10,%esp
+}
+  802b0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b12:	c9                   	leave
+  802b13:	c3                   	ret
+
+00802b14 <evwait>:
+{
+  802b14:	55                   	push   %ebp
+  802b15:	89 e5                	mov    %esp,%ebp
+  802b17:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802b1a:	ff 75 10             	push   0x10(%ebp)
+  802b1d:	ff 75 0c             	push   0xc(%ebp)
+  802b20:	ff 75 08             	push   0x8(%ebp)
+  802b23:	e8 e0 0b 00 00       	call   803708 <nsipc_evwait>
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+00802b2a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802b30:	ff 75 10             	push   0x10(%ebp)
+  802b33:	ff 75 0c             	push   0xc(%ebp)
+  802b36:	ff 75 08             	push   0x8(%ebp)
+  802b39:	e8 31 0c 00 00       	call   80376f <nsipc_socket>
+  802b3e:	83 c4 10             	add    $0x10,%esp
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	78 05                	js     802b4a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802b45:	e8 89 fd ff ff       	call   8028d3 <alloc_sockfd>
+}
+  802b4a:	c9                   	leave
+  802b4b:	c3                   	ret
+
+00802b4c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	53                   	push   %ebx
+  802b50:	83 ec 04             	sub    $0x4,%esp
+  802b53:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802b55:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802b5c:	74 26                	je     802b84 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802b5e:	6a 07                	push   $0x7
+  802b60:	68 00 80 80 00       	push   $0x808000
+  802b65:	53                   	push   %ebx
+  802b66:	ff 35 e4 69 80 00    	push   0x8069e4
+  802b6c:	e8 c4 f1 ff ff       	call   801d35 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802b71:	83 c4 0c             	add    $0xc,%esp
+  802b74:	6a 00                	push   $0x0
+  802b76:	6a 00                	push   $0x0
+  802b78:	6a 00                	push   $0x0
+  802b7a:	e8 26 ef ff ff       	call   801aa5 <ipc_recv>
+}
+  802b7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802b84:	83 ec 0c             	sub    $0xc,%esp
+  802b87:	6a 03                	push   $0x3
+  802b89:	e8 10 f2 ff ff       	call   801d9e <ipc_find_env>
+  802b8e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	eb c6                	jmp    802b5e <nsipc+0x12>
+
+00802b98 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802b98:	55                   	push   %ebp
+  802b99:	89 e5                	mov    %esp,%ebp
+  802b9b:	56                   	push   %esi
+  802b9c:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802b9d:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802ba8:	85 f6                	test   %esi,%esi
+  802baa:	75 33                	jne    802bdf <nsbulk_map+0x47>
+  802bac:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802bb1:	83 ec 04             	sub    $0x4,%esp
+  802bb4:	6a 07                	push   $0x7
+  802bb6:	53                   	push   %ebx
+  802bb7:	6a 00                	push   $0x0
+  802bb9:	e8 08 e3 ff ff       	call   800ec6 <sys_page_alloc>
+  802bbe:	83 c4 10             	add    $0x10,%esp
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	78 1a                	js     802bdf <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802bc5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802bcb:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802bd1:	75 de                	jne    802bb1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802bd3:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802bda:	00 00 00 
+	return 0;
+  802bdd:	89 f0                	mov    %esi,%eax
+}
+  802bdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802be2:	5b                   	pop    %ebx
+  802be3:	5e                   	pop    %esi
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+
+00802be6 <nsbulk_own>:
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	57                   	push   %edi
+  802bea:	56                   	push   %esi
+  802beb:	53                   	push   %ebx
+  802bec:	83 ec 0c             	sub    $0xc,%esp
+  802bef:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802bf1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802bf4:	85 d2                	test   %edx,%edx
+  802bf6:	7f 0e                	jg     802c06 <nsbulk_own+0x20>
+	return 0;
+  802bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfd:	eb 47                	jmp    802c46 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802bff:	83 c3 01             	add    $0x1,%ebx
+  802c02:	39 fb                	cmp    %edi,%ebx
+  802c04:	7d 3b                	jge    802c41 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802c06:	be 01 00 00 00       	mov    $0x1,%esi
+  802c0b:	89 d9                	mov    %ebx,%ecx
+  802c0d:	d3 e6                	shl    %cl,%esi
+  802c0f:	89 f0                	mov    %esi,%eax
+  802c11:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802c17:	74 e6                	je     802bff <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802c19:	83 ec 04             	sub    $0x4,%esp
+  802c1c:	6a 07                	push   $0x7
+  802c1e:	89 d8                	mov    %ebx,%eax
+  802c20:	c1 e0 0c             	shl    $0xc,%eax
+  802c23:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802c28:	50                   	push   %eax
+  802c29:	6a 00                	push   $0x0
+  802c2b:	e8 96 e2 ff ff       	call   800ec6 <sys_page_alloc>
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	78 0f                	js     802c46 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802c37:	f7 d6                	not    %esi
+  802c39:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802c3f:	eb be                	jmp    802bff <nsbulk_own+0x19>
+	return 0;
+  802c41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c49:	5b                   	pop    %ebx
+  802c4a:	5e                   	pop    %esi
+  802c4b:	5f                   	pop    %edi
+  802c4c:	5d                   	pop    %ebp
+  802c4d:	c3                   	ret
+
+00802c4e <nsipc_bulk>:
+{
+  802c4e:	55                   	push   %ebp
+  802c4f:	89 e5                	mov    %esp,%ebp
+  802c51:	57                   	push   %edi
+  802c52:	56                   	push   %esi
+  802c53:	53                   	push   %ebx
+  802c54:	83 ec 1c             	sub    $0x1c,%esp
+  802c57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c5a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802c5c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802c62:	c1 fb 0c             	sar    $0xc,%ebx
+  802c65:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802c68:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802c6f:	74 56                	je     802cc7 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802c71:	85 ff                	test   %edi,%edi
+  802c73:	7e 24                	jle    802c99 <nsipc_bulk+0x4b>
+  802c75:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802c7b:	74 1c                	je     802c99 <nsipc_bulk+0x4b>
+  802c7d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802c83:	c1 e3 0c             	shl    $0xc,%ebx
+  802c86:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802c8b:	0f b6 10             	movzbl (%eax),%edx
+  802c8e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802c90:	05 00 10 00 00       	add    $0x1000,%eax
+  802c95:	39 d8                	cmp    %ebx,%eax
+  802c97:	75 f2                	jne    802c8b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+  802c9c:	56                   	push   %esi
+  802c9d:	57                   	push   %edi
+  802c9e:	68 00 00 00 e0       	push   $0xe0000000
+  802ca3:	ff 75 e4             	push   -0x1c(%ebp)
+  802ca6:	ff 35 e4 69 80 00    	push   0x8069e4
+  802cac:	e8 b8 f0 ff ff       	call   801d69 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802cb1:	83 c4 1c             	add    $0x1c,%esp
+  802cb4:	6a 00                	push   $0x0
+  802cb6:	6a 00                	push   $0x0
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 e6 ed ff ff       	call   801aa5 <ipc_recv>
+}
+  802cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc2:	5b                   	pop    %ebx
+  802cc3:	5e                   	pop    %esi
+  802cc4:	5f                   	pop    %edi
+  802cc5:	5d                   	pop    %ebp
+  802cc6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802cc7:	83 ec 0c             	sub    $0xc,%esp
+  802cca:	6a 03                	push   $0x3
+  802ccc:	e8 cd f0 ff ff       	call   801d9e <ipc_find_env>
+  802cd1:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	eb 96                	jmp    802c71 <nsipc_bulk+0x23>
+
+00802cdb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802cdb:	55                   	push   %ebp
+  802cdc:	89 e5                	mov    %esp,%ebp
+  802cde:	53                   	push   %ebx
+  802cdf:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ce5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802cea:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ced:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802cf2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cf7:	e8 50 fe ff ff       	call   802b4c <nsipc>
+  802cfc:	89 c3                	mov    %eax,%ebx
+  802cfe:	85 c0                	test   %eax,%eax
+  802d00:	79 07                	jns    802d09 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802d02:	89 d8                	mov    %ebx,%eax
+  802d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d07:	c9                   	leave
+  802d08:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802d09:	83 ec 04             	sub    $0x4,%esp
+  802d0c:	ff 35 10 80 80 00    	push   0x808010
+  802d12:	68 00 80 80 00       	push   $0x808000
+  802d17:	ff 75 0c             	push   0xc(%ebp)
+  802d1a:	e8 23 df ff ff       	call   800c42 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802d1f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802d25:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d28:	89 10                	mov    %edx,(%eax)
+  802d2a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802d2d:	eb d3                	jmp    802d02 <nsipc_accept+0x27>
+
+00802d2f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802d2f:	55                   	push   %ebp
+  802d30:	89 e5                	mov    %esp,%ebp
+  802d32:	53                   	push   %ebx
+  802d33:	83 ec 08             	sub    $0x8,%esp
+  802d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d3c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802d41:	53                   	push   %ebx
+  802d42:	ff 75 0c             	push   0xc(%ebp)
+  802d45:	68 04 80 80 00       	push   $0x808004
+  802d4a:	e8 f3 de ff ff       	call   800c42 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802d4f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802d55:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d5a:	e8 ed fd ff ff       	call   802b4c <nsipc>
+}
+  802d5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d62:	c9                   	leave
+  802d63:	c3                   	ret
+
+00802d64 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802d64:	55                   	push   %ebp
+  802d65:	89 e5                	mov    %esp,%ebp
+  802d67:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d75:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802d7a:	b8 03 00 00 00       	mov    $0x3,%eax
+  802d7f:	e8 c8 fd ff ff       	call   802b4c <nsipc>
+}
+  802d84:	c9                   	leave
+  802d85:	c3                   	ret
+
+00802d86 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802d86:	55                   	push   %ebp
+  802d87:	89 e5                	mov    %esp,%ebp
+  802d89:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d8f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802d94:	b8 04 00 00 00       	mov    $0x4,%eax
+  802d99:	e8 ae fd ff ff       	call   802b4c <nsipc>
+}
+  802d9e:	c9                   	leave
+  802d9f:	c3                   	ret
+
+00802da0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802da0:	55                   	push   %ebp
+  802da1:	89 e5                	mov    %esp,%ebp
+  802da3:	53                   	push   %ebx
+  802da4:	83 ec 08             	sub    $0x8,%esp
+  802da7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802daa:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dad:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802db2:	53                   	push   %ebx
+  802db3:	ff 75 0c             	push   0xc(%ebp)
+  802db6:	68 04 80 80 00       	push   $0x808004
+  802dbb:	e8 82 de ff ff       	call   800c42 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802dc0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802dc6:	b8 05 00 00 00       	mov    $0x5,%eax
+  802dcb:	e8 7c fd ff ff       	call   802b4c <nsipc>
+}
+  802dd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dd3:	c9                   	leave
+  802dd4:	c3                   	ret
+
+00802dd5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802dd5:	55                   	push   %ebp
+  802dd6:	89 e5                	mov    %esp,%ebp
+  802dd8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802ddb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dde:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802de3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802de6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802deb:	b8 06 00 00 00       	mov    $0x6,%eax
+  802df0:	e8 57 fd ff ff       	call   802b4c <nsipc>
+}
+  802df5:	c9                   	leave
+  802df6:	c3                   	ret
+
+00802df7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	56                   	push   %esi
+  802dfb:	53                   	push   %ebx
+  802dfc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802dff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e02:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802e07:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802e0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e10:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802e15:	b8 07 00 00 00       	mov    $0x7,%eax
+  802e1a:	e8 2d fd ff ff       	call   802b4c <nsipc>
+  802e1f:	89 c3                	mov    %eax,%ebx
+  802e21:	85 c0                	test   %eax,%eax
+  802e23:	78 22                	js     802e47 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802e25:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802e2a:	39 c6                	cmp    %eax,%esi
+  802e2c:	0f 4e c6             	cmovle %esi,%eax
+  802e2f:	39 c3                	cmp    %eax,%ebx
+  802e31:	7f 1d                	jg     802e50 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802e33:	83 ec 04             	sub    $0x4,%esp
+  802e36:	53                   	push   %ebx
+  802e37:	68 00 80 80 00       	push   $0x808000
+  802e3c:	ff 75 0c             	push   0xc(%ebp)
+  802e3f:	e8 fe dd ff ff       	call   800c42 <memmove>
+  802e44:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802e47:	89 d8                	mov    %ebx,%eax
+  802e49:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4c:	5b                   	pop    %ebx
+  802e4d:	5e                   	pop    %esi
+  802e4e:	5d                   	pop    %ebp
+  802e4f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802e50:	68 08 4c 80 00       	push   $0x804c08
+  802e55:	68 1d 4c 80 00       	push   $0x804c1d
+  802e5a:	68 b2 00 00 00       	push   $0xb2
+  802e5f:	68 32 4c 80 00       	push   $0x804c32
+  802e64:	e8 57 d4 ff ff       	call   8002c0 <_panic>
+
+00802e69 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802e69:	55                   	push   %ebp
+  802e6a:	89 e5                	mov    %esp,%ebp
+  802e6c:	53                   	push   %ebx
+  802e6d:	83 ec 04             	sub    $0x4,%esp
+  802e70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802e73:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e76:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802e7b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802e81:	7f 2e                	jg     802eb1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802e83:	83 ec 04             	sub    $0x4,%esp
+  802e86:	53                   	push   %ebx
+  802e87:	ff 75 0c             	push   0xc(%ebp)
+  802e8a:	68 0c 80 80 00       	push   $0x80800c
+  802e8f:	e8 ae dd ff ff       	call   800c42 <memmove>
+	nsipcbuf.send.req_size = size;
+  802e94:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802e9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e9d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802ea2:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ea7:	e8 a0 fc ff ff       	call   802b4c <nsipc>
+}
+  802eac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eaf:	c9                   	leave
+  802eb0:	c3                   	ret
+	assert(size < 1600);
+  802eb1:	68 3e 4c 80 00       	push   $0x804c3e
+  802eb6:	68 1d 4c 80 00       	push   $0x804c1d
+  802ebb:	68 bd 00 00 00       	push   $0xbd
+  802ec0:	68 32 4c 80 00       	push   $0x804c32
+  802ec5:	e8 f6 d3 ff ff       	call   8002c0 <_panic>
+
+00802eca <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802eca:	55                   	push   %ebp
+  802ecb:	89 e5                	mov    %esp,%ebp
+  802ecd:	57                   	push   %edi
+  802ece:	56                   	push   %esi
+  802ecf:	53                   	push   %ebx
+  802ed0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802ed3:	e8 c0 fc ff ff       	call   802b98 <nsbulk_map>
+  802ed8:	85 c0                	test   %eax,%eax
+  802eda:	78 55                	js     802f31 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802edc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802ee3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802eea:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ef1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ef4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802ef7:	0f 8d 24 02 00 00    	jge    803121 <nsipc_sendmsg+0x257>
+  802efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f00:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802f03:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802f06:	89 d8                	mov    %ebx,%eax
+  802f08:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f0d:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802f0f:	83 ec 0c             	sub    $0xc,%esp
+  802f12:	68 e0 66 80 00       	push   $0x8066e0
+  802f17:	e8 5a 0f 00 00       	call   803e76 <pgbatch_init>
+  802f1c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802f1f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802f21:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802f24:	e9 82 00 00 00       	jmp    802fab <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802f29:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f2c:	85 db                	test   %ebx,%ebx
+  802f2e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f34:	5b                   	pop    %ebx
+  802f35:	5e                   	pop    %esi
+  802f36:	5f                   	pop    %edi
+  802f37:	5d                   	pop    %ebp
+  802f38:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802f39:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802f3e:	29 c8                	sub    %ecx,%eax
+  802f40:	39 d0                	cmp    %edx,%eax
+  802f42:	0f 46 d0             	cmovbe %eax,%edx
+  802f45:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802f47:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802f4d:	85 ff                	test   %edi,%edi
+  802f4f:	0f 49 c7             	cmovns %edi,%eax
+  802f52:	c1 f8 0c             	sar    $0xc,%eax
+  802f55:	ba 01 00 00 00       	mov    $0x1,%edx
+  802f5a:	e8 87 fc ff ff       	call   802be6 <nsbulk_own>
+  802f5f:	85 c0                	test   %eax,%eax
+  802f61:	0f 88 17 01 00 00    	js     80307e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802f67:	83 ec 04             	sub    $0x4,%esp
+  802f6a:	56                   	push   %esi
+  802f6b:	ff 75 e0             	push   -0x20(%ebp)
+  802f6e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f71:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f76:	50                   	push   %eax
+  802f77:	e8 c6 dc ff ff       	call   800c42 <memmove>
+  802f7c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802f7f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802f82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f85:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802f88:	0f 84 fd 00 00 00    	je     80308b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802f8e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802f91:	01 f7                	add    %esi,%edi
+  802f93:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802f96:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f99:	0f 8d 01 01 00 00    	jge    8030a0 <nsipc_sendmsg+0x1d6>
+  802f9f:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802fa5:	0f 8f f0 00 00 00    	jg     80309b <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802fab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fae:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802fb1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802fb4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fb7:	89 c2                	mov    %eax,%edx
+  802fb9:	03 13                	add    (%ebx),%edx
+  802fbb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802fbe:	8b 73 04             	mov    0x4(%ebx),%esi
+  802fc1:	29 c6                	sub    %eax,%esi
+  802fc3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802fc8:	29 f9                	sub    %edi,%ecx
+  802fca:	39 ce                	cmp    %ecx,%esi
+  802fcc:	89 ca                	mov    %ecx,%edx
+  802fce:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802fd1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802fd4:	89 f9                	mov    %edi,%ecx
+  802fd6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802fdc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fdf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802fe4:	09 c8                	or     %ecx,%eax
+  802fe6:	0f 85 4d ff ff ff    	jne    802f39 <nsipc_sendmsg+0x6f>
+  802fec:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802ff2:	0f 86 41 ff ff ff    	jbe    802f39 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802ff8:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ffe:	85 ff                	test   %edi,%edi
+  803000:	0f 49 c7             	cmovns %edi,%eax
+  803003:	c1 f8 0c             	sar    $0xc,%eax
+  803006:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803008:	89 d1                	mov    %edx,%ecx
+  80300a:	c1 e9 0c             	shr    $0xc,%ecx
+  80300d:	01 c8                	add    %ecx,%eax
+  80300f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803012:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803015:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  803017:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80301a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80301f:	29 c8                	sub    %ecx,%eax
+  803021:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803024:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  803027:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803029:	b8 01 00 00 00       	mov    $0x1,%eax
+  80302e:	89 f9                	mov    %edi,%ecx
+  803030:	d3 e0                	shl    %cl,%eax
+  803032:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803038:	83 ec 08             	sub    $0x8,%esp
+  80303b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80303d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803040:	50                   	push   %eax
+  803041:	6a 00                	push   $0x0
+  803043:	56                   	push   %esi
+  803044:	6a 00                	push   $0x0
+  803046:	68 e0 66 80 00       	push   $0x8066e0
+  80304b:	e8 e4 0e 00 00       	call   803f34 <pgbatch_map>
+  803050:	83 c4 20             	add    $0x20,%esp
+  803053:	85 c0                	test   %eax,%eax
+  803055:	0f 88 ce fe ff ff    	js     802f29 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80305b:	83 c7 01             	add    $0x1,%edi
+  80305e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803064:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803067:	39 c7                	cmp    %eax,%edi
+  803069:	75 be                	jne    803029 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80306b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80306e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803071:	89 d6                	mov    %edx,%esi
+  803073:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803079:	e9 01 ff ff ff       	jmp    802f7f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80307e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803081:	85 db                	test   %ebx,%ebx
+  803083:	0f 45 c3             	cmovne %ebx,%eax
+  803086:	e9 a6 fe ff ff       	jmp    802f31 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80308b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80308f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803096:	e9 f3 fe ff ff       	jmp    802f8e <nsipc_sendmsg+0xc4>
+  80309b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80309e:	eb 03                	jmp    8030a3 <nsipc_sendmsg+0x1d9>
+  8030a0:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8030a3:	83 ec 0c             	sub    $0xc,%esp
+  8030a6:	68 e0 66 80 00       	push   $0x8066e0
+  8030ab:	e8 d4 0d 00 00       	call   803e84 <pgbatch_flush>
+  8030b0:	83 c4 10             	add    $0x10,%esp
+  8030b3:	85 c0                	test   %eax,%eax
+  8030b5:	78 50                	js     803107 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8030b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030ba:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8030bf:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8030c5:	89 fb                	mov    %edi,%ebx
+  8030c7:	29 f3                	sub    %esi,%ebx
+  8030c9:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8030cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030d2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8030d7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8030dc:	89 fa                	mov    %edi,%edx
+  8030de:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8030e3:	e8 66 fb ff ff       	call   802c4e <nsipc_bulk>
+  8030e8:	85 c0                	test   %eax,%eax
+  8030ea:	78 28                	js     803114 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8030ec:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8030ef:	39 c3                	cmp    %eax,%ebx
+  8030f1:	75 0c                	jne    8030ff <nsipc_sendmsg+0x235>
+  8030f3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8030f6:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8030f9:	0f 8f f2 fd ff ff    	jg     802ef1 <nsipc_sendmsg+0x27>
+		sent += r;
+  8030ff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803102:	e9 2a fe ff ff       	jmp    802f31 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803107:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80310a:	85 db                	test   %ebx,%ebx
+  80310c:	0f 45 c3             	cmovne %ebx,%eax
+  80310f:	e9 1d fe ff ff       	jmp    802f31 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803114:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803117:	85 db                	test   %ebx,%ebx
+  803119:	0f 45 c3             	cmovne %ebx,%eax
+  80311c:	e9 10 fe ff ff       	jmp    802f31 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803121:	83 ec 0c             	sub    $0xc,%esp
+  803124:	68 e0 66 80 00       	push   $0x8066e0
+  803129:	e8 48 0d 00 00       	call   803e76 <pgbatch_init>
+  80312e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803131:	be 00 00 00 00       	mov    $0x0,%esi
+  803136:	bf 00 00 00 00       	mov    $0x0,%edi
+  80313b:	e9 63 ff ff ff       	jmp    8030a3 <nsipc_sendmsg+0x1d9>
+
+00803140 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803140:	55                   	push   %ebp
+  803141:	89 e5                	mov    %esp,%ebp
+  803143:	57                   	push   %edi
+  803144:	56                   	push   %esi
+  803145:	53                   	push   %ebx
+  803146:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803149:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  803150:	0f 84 c8 00 00 00    	je     80321e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803156:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80315d:	0f 84 e4 00 00 00    	je     803247 <nsipc_sendfile+0x107>
+{
+  803163:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  803168:	89 fb                	mov    %edi,%ebx
+  80316a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80316d:	0f 83 f0 00 00 00    	jae    803263 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803173:	89 fa                	mov    %edi,%edx
+  803175:	03 55 10             	add    0x10(%ebp),%edx
+  803178:	89 d0                	mov    %edx,%eax
+  80317a:	c1 f8 1f             	sar    $0x1f,%eax
+  80317d:	c1 e8 14             	shr    $0x14,%eax
+  803180:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803183:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803189:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80318b:	6a 10                	push   $0x10
+  80318d:	68 00 20 01 e0       	push   $0xe0012000
+  803192:	52                   	push   %edx
+  803193:	ff 75 0c             	push   0xc(%ebp)
+  803196:	e8 c0 f4 ff ff       	call   80265b <fmap>
+  80319b:	83 c4 10             	add    $0x10,%esp
+  80319e:	85 c0                	test   %eax,%eax
+  8031a0:	0f 8e b8 00 00 00    	jle    80325e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8031a6:	39 c6                	cmp    %eax,%esi
+  8031a8:	0f 8d b5 00 00 00    	jge    803263 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8031ae:	29 f0                	sub    %esi,%eax
+  8031b0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8031b3:	29 da                	sub    %ebx,%edx
+  8031b5:	39 d0                	cmp    %edx,%eax
+  8031b7:	89 d3                	mov    %edx,%ebx
+  8031b9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8031bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031bf:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8031c4:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8031ca:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8031d0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8031d3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8031d8:	83 ec 0c             	sub    $0xc,%esp
+  8031db:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8031dd:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8031e4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8031e7:	83 c0 01             	add    $0x1,%eax
+  8031ea:	50                   	push   %eax
+  8031eb:	68 00 10 01 e0       	push   $0xe0011000
+  8031f0:	6a 11                	push   $0x11
+  8031f2:	ff 35 e4 69 80 00    	push   0x8069e4
+  8031f8:	e8 6c eb ff ff       	call   801d69 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8031fd:	83 c4 1c             	add    $0x1c,%esp
+  803200:	6a 00                	push   $0x0
+  803202:	6a 00                	push   $0x0
+  803204:	6a 00                	push   $0x0
+  803206:	e8 9a e8 ff ff       	call   801aa5 <ipc_recv>
+  80320b:	83 c4 10             	add    $0x10,%esp
+  80320e:	85 c0                	test   %eax,%eax
+  803210:	78 5b                	js     80326d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803212:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803214:	39 c3                	cmp    %eax,%ebx
+  803216:	0f 8e 4c ff ff ff    	jle    803168 <nsipc_sendfile+0x28>
+  80321c:	eb 45                	jmp    803263 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80321e:	83 ec 04             	sub    $0x4,%esp
+  803221:	6a 07                	push   $0x7
+  803223:	68 00 10 01 e0       	push   $0xe0011000
+  803228:	6a 00                	push   $0x0
+  80322a:	e8 97 dc ff ff       	call   800ec6 <sys_page_alloc>
+  80322f:	89 c7                	mov    %eax,%edi
+  803231:	83 c4 10             	add    $0x10,%esp
+  803234:	85 c0                	test   %eax,%eax
+  803236:	78 2b                	js     803263 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803238:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  80323f:	00 00 00 
+  803242:	e9 0f ff ff ff       	jmp    803156 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803247:	83 ec 0c             	sub    $0xc,%esp
+  80324a:	6a 03                	push   $0x3
+  80324c:	e8 4d eb ff ff       	call   801d9e <ipc_find_env>
+  803251:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  803256:	83 c4 10             	add    $0x10,%esp
+  803259:	e9 05 ff ff ff       	jmp    803163 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80325e:	85 ff                	test   %edi,%edi
+  803260:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803263:	89 f8                	mov    %edi,%eax
+  803265:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803268:	5b                   	pop    %ebx
+  803269:	5e                   	pop    %esi
+  80326a:	5f                   	pop    %edi
+  80326b:	5d                   	pop    %ebp
+  80326c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80326d:	85 ff                	test   %edi,%edi
+  80326f:	0f 44 f8             	cmove  %eax,%edi
+  803272:	eb ef                	jmp    803263 <nsipc_sendfile+0x123>
+
+00803274 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803274:	55                   	push   %ebp
+  803275:	89 e5                	mov    %esp,%ebp
+  803277:	57                   	push   %edi
+  803278:	56                   	push   %esi
+  803279:	53                   	push   %ebx
+  80327a:	83 ec 1c             	sub    $0x1c,%esp
+  80327d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803280:	e8 13 f9 ff ff       	call   802b98 <nsbulk_map>
+  803285:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803288:	85 c0                	test   %eax,%eax
+  80328a:	0f 88 ba 00 00 00    	js     80334a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803290:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803294:	0f 8e bb 00 00 00    	jle    803355 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80329a:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80329f:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8032a4:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8032a9:	89 f8                	mov    %edi,%eax
+  8032ab:	29 f0                	sub    %esi,%eax
+  8032ad:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8032b1:	39 c8                	cmp    %ecx,%eax
+  8032b3:	0f 47 c1             	cmova  %ecx,%eax
+  8032b6:	01 f0                	add    %esi,%eax
+  8032b8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8032ba:	83 c2 01             	add    $0x1,%edx
+  8032bd:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8032c0:	7e 07                	jle    8032c9 <nsipc_recvmsg+0x55>
+  8032c2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8032c7:	7e e0                	jle    8032a9 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8032c9:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8032cf:	c1 fa 0c             	sar    $0xc,%edx
+  8032d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d7:	e8 0a f9 ff ff       	call   802be6 <nsbulk_own>
+  8032dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8032df:	85 c0                	test   %eax,%eax
+  8032e1:	78 67                	js     80334a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8032e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8032eb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8032f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8032f4:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8032f9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8032fe:	89 f2                	mov    %esi,%edx
+  803300:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803305:	e8 44 f9 ff ff       	call   802c4e <nsipc_bulk>
+  80330a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	78 39                	js     80334a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803311:	39 f0                	cmp    %esi,%eax
+  803313:	7f 4a                	jg     80335f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331a:	85 c0                	test   %eax,%eax
+  80331c:	7e 2c                	jle    80334a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80331e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803321:	29 fe                	sub    %edi,%esi
+  803323:	8b 43 04             	mov    0x4(%ebx),%eax
+  803326:	39 c6                	cmp    %eax,%esi
+  803328:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80332b:	83 ec 04             	sub    $0x4,%esp
+  80332e:	56                   	push   %esi
+  80332f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803335:	50                   	push   %eax
+  803336:	ff 33                	push   (%ebx)
+  803338:	e8 05 d9 ff ff       	call   800c42 <memmove>
+		n += m;
+  80333d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80333f:	83 c3 08             	add    $0x8,%ebx
+  803342:	83 c4 10             	add    $0x10,%esp
+  803345:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803348:	7f d4                	jg     80331e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80334a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80334d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803350:	5b                   	pop    %ebx
+  803351:	5e                   	pop    %esi
+  803352:	5f                   	pop    %edi
+  803353:	5d                   	pop    %ebp
+  803354:	c3                   	ret
+	int r, i, n, len = 0;
+  803355:	be 00 00 00 00       	mov    $0x0,%esi
+  80335a:	e9 6a ff ff ff       	jmp    8032c9 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80335f:	68 14 4c 80 00       	push   $0x804c14
+  803364:	68 1d 4c 80 00       	push   $0x804c1d
+  803369:	68 3b 01 00 00       	push   $0x13b
+  80336e:	68 32 4c 80 00       	push   $0x804c32
+  803373:	e8 48 cf ff ff       	call   8002c0 <_panic>
+
+00803378 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803378:	55                   	push   %ebp
+  803379:	89 e5                	mov    %esp,%ebp
+  80337b:	57                   	push   %edi
+  80337c:	56                   	push   %esi
+  80337d:	53                   	push   %ebx
+  80337e:	83 ec 0c             	sub    $0xc,%esp
+  803381:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803384:	8b 75 10             	mov    0x10(%ebp),%esi
+  803387:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80338a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80338d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  803392:	8b 07                	mov    (%edi),%eax
+  803394:	a3 04 80 80 00       	mov    %eax,0x808004
+  803399:	8b 47 04             	mov    0x4(%edi),%eax
+  80339c:	a3 08 80 80 00       	mov    %eax,0x808008
+  8033a1:	8b 47 08             	mov    0x8(%edi),%eax
+  8033a4:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8033a9:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033ac:	a3 10 80 80 00       	mov    %eax,0x808010
+  8033b1:	8b 47 10             	mov    0x10(%edi),%eax
+  8033b4:	a3 14 80 80 00       	mov    %eax,0x808014
+  8033b9:	8b 47 14             	mov    0x14(%edi),%eax
+  8033bc:	a3 18 80 80 00       	mov    %eax,0x808018
+  8033c1:	8b 47 18             	mov    0x18(%edi),%eax
+  8033c4:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8033c9:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8033cc:	a3 20 80 80 00       	mov    %eax,0x808020
+  8033d1:	8b 47 20             	mov    0x20(%edi),%eax
+  8033d4:	a3 24 80 80 00       	mov    %eax,0x808024
+  8033d9:	8b 47 24             	mov    0x24(%edi),%eax
+  8033dc:	a3 28 80 80 00       	mov    %eax,0x808028
+  8033e1:	8b 47 28             	mov    0x28(%edi),%eax
+  8033e4:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8033e9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8033ec:	a3 30 80 80 00       	mov    %eax,0x808030
+  8033f1:	8b 47 30             	mov    0x30(%edi),%eax
+  8033f4:	a3 34 80 80 00       	mov    %eax,0x808034
+  8033f9:	8b 47 34             	mov    0x34(%edi),%eax
+  8033fc:	a3 38 80 80 00       	mov    %eax,0x808038
+  803401:	8b 47 38             	mov    0x38(%edi),%eax
+  803404:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803409:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80340c:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803411:	8b 06                	mov    (%esi),%eax
+  803413:	a3 44 80 80 00       	mov    %eax,0x808044
+  803418:	8b 46 04             	mov    0x4(%esi),%eax
+  80341b:	a3 48 80 80 00       	mov    %eax,0x808048
+  803420:	8b 46 08             	mov    0x8(%esi),%eax
+  803423:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803428:	8b 46 0c             	mov    0xc(%esi),%eax
+  80342b:	a3 50 80 80 00       	mov    %eax,0x808050
+  803430:	8b 46 10             	mov    0x10(%esi),%eax
+  803433:	a3 54 80 80 00       	mov    %eax,0x808054
+  803438:	8b 46 14             	mov    0x14(%esi),%eax
+  80343b:	a3 58 80 80 00       	mov    %eax,0x808058
+  803440:	8b 46 18             	mov    0x18(%esi),%eax
+  803443:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803448:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80344b:	a3 60 80 80 00       	mov    %eax,0x808060
+  803450:	8b 46 20             	mov    0x20(%esi),%eax
+  803453:	a3 64 80 80 00       	mov    %eax,0x808064
+  803458:	8b 46 24             	mov    0x24(%esi),%eax
+  80345b:	a3 68 80 80 00       	mov    %eax,0x808068
+  803460:	8b 46 28             	mov    0x28(%esi),%eax
+  803463:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  803468:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80346b:	a3 70 80 80 00       	mov    %eax,0x808070
+  803470:	8b 46 30             	mov    0x30(%esi),%eax
+  803473:	a3 74 80 80 00       	mov    %eax,0x808074
+  803478:	8b 46 34             	mov    0x34(%esi),%eax
+  80347b:	a3 78 80 80 00       	mov    %eax,0x808078
+  803480:	8b 46 38             	mov    0x38(%esi),%eax
+  803483:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803488:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80348b:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803490:	8b 03                	mov    (%ebx),%eax
+  803492:	a3 84 80 80 00       	mov    %eax,0x808084
+  803497:	8b 43 04             	mov    0x4(%ebx),%eax
+  80349a:	a3 88 80 80 00       	mov    %eax,0x808088
+  80349f:	8b 43 08             	mov    0x8(%ebx),%eax
+  8034a2:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8034a7:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8034aa:	a3 90 80 80 00       	mov    %eax,0x808090
+  8034af:	8b 43 10             	mov    0x10(%ebx),%eax
+  8034b2:	a3 94 80 80 00       	mov    %eax,0x808094
+  8034b7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8034ba:	a3 98 80 80 00       	mov    %eax,0x808098
+  8034bf:	8b 43 18             	mov    0x18(%ebx),%eax
+  8034c2:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8034c7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8034ca:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8034cf:	8b 43 20             	mov    0x20(%ebx),%eax
+  8034d2:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8034d7:	8b 43 24             	mov    0x24(%ebx),%eax
+  8034da:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8034df:	8b 43 28             	mov    0x28(%ebx),%eax
+  8034e2:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8034e7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8034ea:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8034ef:	8b 43 30             	mov    0x30(%ebx),%eax
+  8034f2:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8034f7:	8b 43 34             	mov    0x34(%ebx),%eax
+  8034fa:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8034ff:	8b 43 38             	mov    0x38(%ebx),%eax
+  803502:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803507:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80350a:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80350f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803512:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803517:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80351c:	e8 2b f6 ff ff       	call   802b4c <nsipc>
+  803521:	85 c0                	test   %eax,%eax
+  803523:	0f 88 ad 01 00 00    	js     8036d6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803529:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80352f:	89 17                	mov    %edx,(%edi)
+  803531:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803537:	89 57 04             	mov    %edx,0x4(%edi)
+  80353a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803540:	89 57 08             	mov    %edx,0x8(%edi)
+  803543:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803549:	89 57 0c             	mov    %edx,0xc(%edi)
+  80354c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803552:	89 57 10             	mov    %edx,0x10(%edi)
+  803555:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80355b:	89 57 14             	mov    %edx,0x14(%edi)
+  80355e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803564:	89 57 18             	mov    %edx,0x18(%edi)
+  803567:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80356d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803570:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  803576:	89 57 20             	mov    %edx,0x20(%edi)
+  803579:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80357f:	89 57 24             	mov    %edx,0x24(%edi)
+  803582:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803588:	89 57 28             	mov    %edx,0x28(%edi)
+  80358b:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  803591:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803594:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  80359a:	89 57 30             	mov    %edx,0x30(%edi)
+  80359d:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8035a3:	89 57 34             	mov    %edx,0x34(%edi)
+  8035a6:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8035ac:	89 57 38             	mov    %edx,0x38(%edi)
+  8035af:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8035b5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8035b8:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8035be:	89 16                	mov    %edx,(%esi)
+  8035c0:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8035c6:	89 56 04             	mov    %edx,0x4(%esi)
+  8035c9:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8035cf:	89 56 08             	mov    %edx,0x8(%esi)
+  8035d2:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8035d8:	89 56 0c             	mov    %edx,0xc(%esi)
+  8035db:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8035e1:	89 56 10             	mov    %edx,0x10(%esi)
+  8035e4:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8035ea:	89 56 14             	mov    %edx,0x14(%esi)
+  8035ed:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8035f3:	89 56 18             	mov    %edx,0x18(%esi)
+  8035f6:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8035fc:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8035ff:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803605:	89 56 20             	mov    %edx,0x20(%esi)
+  803608:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80360e:	89 56 24             	mov    %edx,0x24(%esi)
+  803611:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803617:	89 56 28             	mov    %edx,0x28(%esi)
+  80361a:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803620:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803623:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  803629:	89 56 30             	mov    %edx,0x30(%esi)
+  80362c:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803632:	89 56 34             	mov    %edx,0x34(%esi)
+  803635:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80363b:	89 56 38             	mov    %edx,0x38(%esi)
+  80363e:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803644:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803647:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80364d:	89 13                	mov    %edx,(%ebx)
+  80364f:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803655:	89 53 04             	mov    %edx,0x4(%ebx)
+  803658:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80365e:	89 53 08             	mov    %edx,0x8(%ebx)
+  803661:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  803667:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80366a:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  803670:	89 53 10             	mov    %edx,0x10(%ebx)
+  803673:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  803679:	89 53 14             	mov    %edx,0x14(%ebx)
+  80367c:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  803682:	89 53 18             	mov    %edx,0x18(%ebx)
+  803685:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  80368b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80368e:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803694:	89 53 20             	mov    %edx,0x20(%ebx)
+  803697:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  80369d:	89 53 24             	mov    %edx,0x24(%ebx)
+  8036a0:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8036a6:	89 53 28             	mov    %edx,0x28(%ebx)
+  8036a9:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8036af:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8036b2:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8036b8:	89 53 30             	mov    %edx,0x30(%ebx)
+  8036bb:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  8036c1:	89 53 34             	mov    %edx,0x34(%ebx)
+  8036c4:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  8036ca:	89 53 38             	mov    %edx,0x38(%ebx)
+  8036cd:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  8036d3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8036d6:	83 c4 0c             	add    $0xc,%esp
+  8036d9:	5b                   	pop    %ebx
+  8036da:	5e                   	pop    %esi
+  8036db:	5f                   	pop    %edi
+  8036dc:	5d                   	pop    %ebp
+  8036dd:	c3                   	ret
+
+008036de <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8036de:	55                   	push   %ebp
+  8036df:	89 e5                	mov    %esp,%ebp
+  8036e1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8036e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  8036ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036ef:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  8036f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8036f7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  8036fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803701:	e8 46 f4 ff ff       	call   802b4c <nsipc>
+}
+  803706:	c9                   	leave
+  803707:	c3                   	ret
+
+00803708 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803708:	55                   	push   %ebp
+  803709:	89 e5                	mov    %esp,%ebp
+  80370b:	56                   	push   %esi
+  80370c:	53                   	push   %ebx
+  80370d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803710:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803716:	8b 45 10             	mov    0x10(%ebp),%eax
+  803719:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80371e:	b8 10 00 00 00       	mov    $0x10,%eax
+  803723:	e8 24 f4 ff ff       	call   802b4c <nsipc>
+  803728:	89 c3                	mov    %eax,%ebx
+  80372a:	85 c0                	test   %eax,%eax
+  80372c:	7e 1f                	jle    80374d <nsipc_evwait+0x45>
+		assert(r <= max);
+  80372e:	39 c6                	cmp    %eax,%esi
+  803730:	7c 24                	jl     803756 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803732:	83 ec 04             	sub    $0x4,%esp
+  803735:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80373c:	50                   	push   %eax
+  80373d:	68 00 80 80 00       	push   $0x808000
+  803742:	ff 75 08             	push   0x8(%ebp)
+  803745:	e8 f8 d4 ff ff       	call   800c42 <memmove>
+  80374a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80374d:	89 d8                	mov    %ebx,%eax
+  80374f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803752:	5b                   	pop    %ebx
+  803753:	5e                   	pop    %esi
+  803754:	5d                   	pop    %ebp
+  803755:	c3                   	ret
+		assert(r <= max);
+  803756:	68 4a 4c 80 00       	push   $0x804c4a
+  80375b:	68 1d 4c 80 00       	push   $0x804c1d
+  803760:	68 6a 01 00 00       	push   $0x16a
+  803765:	68 32 4c 80 00       	push   $0x804c32
+  80376a:	e8 51 cb ff ff       	call   8002c0 <_panic>
+
+0080376f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  80376f:	55                   	push   %ebp
+  803770:	89 e5                	mov    %esp,%ebp
+  803772:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803775:	8b 45 08             	mov    0x8(%ebp),%eax
+  803778:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  80377d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803780:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803785:	8b 45 10             	mov    0x10(%ebp),%eax
+  803788:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  80378d:	b8 09 00 00 00       	mov    $0x9,%eax
+  803792:	e8 b5 f3 ff ff       	call   802b4c <nsipc>
+}
+  803797:	c9                   	leave
+  803798:	c3                   	ret
+
+00803799 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803799:	55                   	push   %ebp
+  80379a:	89 e5                	mov    %esp,%ebp
+  80379c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80379f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a2:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8037a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8037ac:	e8 9b f3 ff ff       	call   802b4c <nsipc>
+}
+  8037b1:	c9                   	leave
+  8037b2:	c3                   	ret
+
+008037b3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8037b3:	55                   	push   %ebp
+  8037b4:	89 e5                	mov    %esp,%ebp
+  8037b6:	53                   	push   %ebx
+  8037b7:	83 ec 04             	sub    $0x4,%esp
+  8037ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8037bd:	b8 12 00 00 00       	mov    $0x12,%eax
+  8037c2:	e8 85 f3 ff ff       	call   802b4c <nsipc>
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	78 50                	js     80381b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8037cb:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8037d1:	89 13                	mov    %edx,(%ebx)
+  8037d3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8037d9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8037dc:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8037e2:	89 53 08             	mov    %edx,0x8(%ebx)
+  8037e5:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8037eb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8037ee:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8037f4:	89 53 10             	mov    %edx,0x10(%ebx)
+  8037f7:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8037fd:	89 53 14             	mov    %edx,0x14(%ebx)
+  803800:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803806:	89 53 18             	mov    %edx,0x18(%ebx)
+  803809:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80380f:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803812:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803818:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  80381b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80381e:	c9                   	leave
+  80381f:	c3                   	ret
+
+00803820 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803820:	55                   	push   %ebp
+  803821:	89 e5                	mov    %esp,%ebp
+  803823:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803826:	6a 03                	push   $0x3
+  803828:	e8 71 e5 ff ff       	call   801d9e <ipc_find_env>
+  80382d:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803832:	8b 45 08             	mov    0x8(%ebp),%eax
+  803835:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  80383a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80383f:	e8 08 f3 ff ff       	call   802b4c <nsipc>
+  803844:	83 c4 10             	add    $0x10,%esp
+  803847:	85 c0                	test   %eax,%eax
+  803849:	78 0a                	js     803855 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  80384b:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803850:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803855:	c9                   	leave
+  803856:	c3                   	ret
+
+00803857 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803857:	55                   	push   %ebp
+  803858:	89 e5                	mov    %esp,%ebp
+  80385a:	57                   	push   %edi
+  80385b:	56                   	push   %esi
+  80385c:	53                   	push   %ebx
+  80385d:	83 ec 1c             	sub    $0x1c,%esp
+  803860:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803863:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803866:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  80386b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803870:	89 e0                	mov    %esp,%eax
+  803872:	89 f2                	mov    %esi,%edx
+  803874:	29 c2                	sub    %eax,%edx
+  803876:	89 d0                	mov    %edx,%eax
+  803878:	c1 e8 0f             	shr    $0xf,%eax
+  80387b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803881:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803884:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80388b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80388e:	83 ec 0c             	sub    $0xc,%esp
+  803891:	ff 75 e0             	push   -0x20(%ebp)
+  803894:	e8 b6 ee ff ff       	call   80274f <pageref>
+  803899:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80389c:	83 c4 04             	add    $0x4,%esp
+  80389f:	ff 75 dc             	push   -0x24(%ebp)
+  8038a2:	e8 a8 ee ff ff       	call   80274f <pageref>
+  8038a7:	89 e2                	mov    %esp,%edx
+  8038a9:	89 f1                	mov    %esi,%ecx
+  8038ab:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8038ad:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8038b0:	89 ca                	mov    %ecx,%edx
+  8038b2:	c1 ea 0f             	shr    $0xf,%edx
+  8038b5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8038bb:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8038be:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  8038c5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8038c8:	39 d7                	cmp    %edx,%edi
+  8038ca:	74 40                	je     80390c <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8038cc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8038cf:	75 9f                	jne    803870 <_pipeisclosed+0x19>
+  8038d1:	89 e2                	mov    %esp,%edx
+  8038d3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038d8:	29 d0                	sub    %edx,%eax
+  8038da:	89 c2                	mov    %eax,%edx
+  8038dc:	c1 ea 0f             	shr    $0xf,%edx
+  8038df:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8038ec:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8038f3:	8b 40 58             	mov    0x58(%eax),%eax
+  8038f6:	6a 01                	push   $0x1
+  8038f8:	50                   	push   %eax
+  8038f9:	57                   	push   %edi
+  8038fa:	68 53 4c 80 00       	push   $0x804c53
+  8038ff:	e8 97 ca ff ff       	call   80039b <cprintf>
+  803904:	83 c4 10             	add    $0x10,%esp
+  803907:	e9 5f ff ff ff       	jmp    80386b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80390c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80390f:	0f 94 c0             	sete   %al
+  803912:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803918:	5b                   	pop    %ebx
+  803919:	5e                   	pop    %esi
+  80391a:	5f                   	pop    %edi
+  80391b:	5d                   	pop    %ebp
+  80391c:	c3                   	ret
+
+0080391d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80391d:	55                   	push   %ebp
+  80391e:	89 e5                	mov    %esp,%ebp
+  803920:	53                   	push   %ebx
+  803921:	83 ec 0c             	sub    $0xc,%esp
+  803924:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803927:	53                   	push   %ebx
+  803928:	6a 00                	push   $0x0
+  80392a:	e8 1c d6 ff ff       	call   800f4b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80392f:	89 1c 24             	mov    %ebx,(%esp)
+  803932:	e8 b6 e4 ff ff       	call   801ded <fd2data>
+  803937:	83 c4 08             	add    $0x8,%esp
+  80393a:	50                   	push   %eax
+  80393b:	6a 00                	push   $0x0
+  80393d:	e8 09 d6 ff ff       	call   800f4b <sys_page_unmap>
+}
+  803942:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803945:	c9                   	leave
+  803946:	c3                   	ret
+
+00803947 <devpipe_read>:
+{
+  803947:	55                   	push   %ebp
+  803948:	89 e5                	mov    %esp,%ebp
+  80394a:	57                   	push   %edi
+  80394b:	56                   	push   %esi
+  80394c:	53                   	push   %ebx
+  80394d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803950:	ff 75 08             	push   0x8(%ebp)
+  803953:	e8 95 e4 ff ff       	call   801ded <fd2data>
+  803958:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80395a:	8b 70 04             	mov    0x4(%eax),%esi
+  80395d:	8b 00                	mov    (%eax),%eax
+  80395f:	83 c4 10             	add    $0x10,%esp
+  803962:	39 f0                	cmp    %esi,%eax
+  803964:	75 36                	jne    80399c <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803966:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803969:	89 da                	mov    %ebx,%edx
+  80396b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80396e:	e8 e4 fe ff ff       	call   803857 <_pipeisclosed>
+  803973:	85 c0                	test   %eax,%eax
+  803975:	0f 85 d4 00 00 00    	jne    803a4f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80397b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803980:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803984:	83 ec 04             	sub    $0x4,%esp
+  803987:	6a ff                	push   $0xffffffff
+  803989:	56                   	push   %esi
+  80398a:	57                   	push   %edi
+  80398b:	e8 34 d9 ff ff       	call   8012c4 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803990:	8b 73 04             	mov    0x4(%ebx),%esi
+  803993:	8b 03                	mov    (%ebx),%eax
+  803995:	83 c4 10             	add    $0x10,%esp
+  803998:	39 c6                	cmp    %eax,%esi
+  80399a:	74 cd                	je     803969 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80399c:	8b 73 04             	mov    0x4(%ebx),%esi
+  80399f:	8b 03                	mov    (%ebx),%eax
+  8039a1:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8039a7:	29 c6                	sub    %eax,%esi
+  8039a9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039ae:	f7 e6                	mul    %esi
+  8039b0:	c1 ea 0c             	shr    $0xc,%edx
+  8039b3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039b9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8039bb:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039be:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8039c2:	8b 0b                	mov    (%ebx),%ecx
+  8039c4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8039c9:	f7 e1                	mul    %ecx
+  8039cb:	c1 ea 0b             	shr    $0xb,%edx
+  8039ce:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8039d4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8039d6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8039db:	29 cf                	sub    %ecx,%edi
+  8039dd:	39 f7                	cmp    %esi,%edi
+  8039df:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8039e2:	83 ec 04             	sub    $0x4,%esp
+  8039e5:	57                   	push   %edi
+  8039e6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8039ea:	50                   	push   %eax
+  8039eb:	ff 75 0c             	push   0xc(%ebp)
+  8039ee:	e8 4f d2 ff ff       	call   800c42 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8039f3:	83 c4 0c             	add    $0xc,%esp
+  8039f6:	89 f0                	mov    %esi,%eax
+  8039f8:	29 f8                	sub    %edi,%eax
+  8039fa:	50                   	push   %eax
+  8039fb:	8d 43 10             	lea    0x10(%ebx),%eax
+  8039fe:	50                   	push   %eax
+  8039ff:	89 f8                	mov    %edi,%eax
+  803a01:	03 45 0c             	add    0xc(%ebp),%eax
+  803a04:	50                   	push   %eax
+  803a05:	e8 38 d2 ff ff       	call   800c42 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803a0a:	8b 0b                	mov    (%ebx),%ecx
+  803a0c:	01 f1                	add    %esi,%ecx
+  803a0e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a13:	f7 e1                	mul    %ecx
+  803a15:	c1 ea 0c             	shr    $0xc,%edx
+  803a18:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803a1e:	29 c1                	sub    %eax,%ecx
+  803a20:	89 0b                	mov    %ecx,(%ebx)
+  803a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a27:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803a2b:	83 c4 10             	add    $0x10,%esp
+  803a2e:	85 c0                	test   %eax,%eax
+  803a30:	75 0a                	jne    803a3c <devpipe_read+0xf5>
+	return n;
+  803a32:	89 f0                	mov    %esi,%eax
+}
+  803a34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a37:	5b                   	pop    %ebx
+  803a38:	5e                   	pop    %esi
+  803a39:	5f                   	pop    %edi
+  803a3a:	5d                   	pop    %ebp
+  803a3b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803a3c:	83 ec 08             	sub    $0x8,%esp
+  803a3f:	68 00 04 00 00       	push   $0x400
+  803a44:	53                   	push   %ebx
+  803a45:	e8 9c d8 ff ff       	call   8012e6 <sys_futex_wake>
+  803a4a:	83 c4 10             	add    $0x10,%esp
+  803a4d:	eb e3                	jmp    803a32 <devpipe_read+0xeb>
+			return 0;
+  803a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a54:	eb de                	jmp    803a34 <devpipe_read+0xed>
+
+00803a56 <devpipe_write>:
+{
+  803a56:	55                   	push   %ebp
+  803a57:	89 e5                	mov    %esp,%ebp
+  803a59:	57                   	push   %edi
+  803a5a:	56                   	push   %esi
+  803a5b:	53                   	push   %ebx
+  803a5c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803a5f:	ff 75 08             	push   0x8(%ebp)
+  803a62:	e8 86 e3 ff ff       	call   801ded <fd2data>
+  803a67:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803a69:	83 c4 10             	add    $0x10,%esp
+  803a6c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a73:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803a78:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a7c:	0f 84 43 01 00 00    	je     803bc5 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a82:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a85:	8b 06                	mov    (%esi),%eax
+  803a87:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803a8d:	29 c1                	sub    %eax,%ecx
+  803a8f:	89 c8                	mov    %ecx,%eax
+  803a91:	f7 e7                	mul    %edi
+  803a93:	c1 ea 0c             	shr    $0xc,%edx
+  803a96:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a9c:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803a9e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803aa4:	75 52                	jne    803af8 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803aa6:	89 f2                	mov    %esi,%edx
+  803aa8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aab:	e8 a7 fd ff ff       	call   803857 <_pipeisclosed>
+  803ab0:	85 c0                	test   %eax,%eax
+  803ab2:	0f 85 28 01 00 00    	jne    803be0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803ab8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803aba:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803abd:	8b 06                	mov    (%esi),%eax
+  803abf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803ac5:	29 c1                	sub    %eax,%ecx
+  803ac7:	89 c8                	mov    %ecx,%eax
+  803ac9:	f7 e7                	mul    %edi
+  803acb:	c1 ea 0c             	shr    $0xc,%edx
+  803ace:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ad4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803ad6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803adc:	75 a4                	jne    803a82 <devpipe_write+0x2c>
+  803ade:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ae3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803ae7:	83 ec 04             	sub    $0x4,%esp
+  803aea:	6a ff                	push   $0xffffffff
+  803aec:	53                   	push   %ebx
+  803aed:	56                   	push   %esi
+  803aee:	e8 d1 d7 ff ff       	call   8012c4 <sys_futex_wait>
+}
+  803af3:	83 c4 10             	add    $0x10,%esp
+  803af6:	eb 8a                	jmp    803a82 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803af8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803afb:	8b 06                	mov    (%esi),%eax
+  803afd:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b03:	29 c1                	sub    %eax,%ecx
+  803b05:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b0a:	f7 e1                	mul    %ecx
+  803b0c:	c1 ea 0c             	shr    $0xc,%edx
+  803b0f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b15:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803b17:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803b1c:	89 d8                	mov    %ebx,%eax
+  803b1e:	29 c8                	sub    %ecx,%eax
+  803b20:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b23:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b26:	29 ca                	sub    %ecx,%edx
+  803b28:	39 d0                	cmp    %edx,%eax
+  803b2a:	0f 46 d0             	cmovbe %eax,%edx
+  803b2d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803b30:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b33:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b38:	f7 e1                	mul    %ecx
+  803b3a:	c1 ea 0b             	shr    $0xb,%edx
+  803b3d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803b43:	89 ca                	mov    %ecx,%edx
+  803b45:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803b47:	29 d3                	sub    %edx,%ebx
+  803b49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b4c:	39 c3                	cmp    %eax,%ebx
+  803b4e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803b51:	83 ec 04             	sub    $0x4,%esp
+  803b54:	53                   	push   %ebx
+  803b55:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b58:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803b5b:	51                   	push   %ecx
+  803b5c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803b60:	50                   	push   %eax
+  803b61:	e8 dc d0 ff ff       	call   800c42 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803b66:	83 c4 0c             	add    $0xc,%esp
+  803b69:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b6c:	29 d8                	sub    %ebx,%eax
+  803b6e:	50                   	push   %eax
+  803b6f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b72:	01 cb                	add    %ecx,%ebx
+  803b74:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803b77:	53                   	push   %ebx
+  803b78:	8d 46 10             	lea    0x10(%esi),%eax
+  803b7b:	50                   	push   %eax
+  803b7c:	e8 c1 d0 ff ff       	call   800c42 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803b81:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b84:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b87:	01 c1                	add    %eax,%ecx
+  803b89:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803b8e:	f7 e1                	mul    %ecx
+  803b90:	c1 ea 0c             	shr    $0xc,%edx
+  803b93:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803b99:	89 ca                	mov    %ecx,%edx
+  803b9b:	29 c2                	sub    %eax,%edx
+  803b9d:	89 56 04             	mov    %edx,0x4(%esi)
+  803ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ba5:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803ba9:	83 c4 10             	add    $0x10,%esp
+  803bac:	85 c0                	test   %eax,%eax
+  803bae:	75 1a                	jne    803bca <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803bb0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803bb3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803bb6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803bb9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803bbc:	0f 82 c0 fe ff ff    	jb     803a82 <devpipe_write+0x2c>
+  803bc2:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803bc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  803bc8:	eb 1b                	jmp    803be5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803bca:	83 ec 08             	sub    $0x8,%esp
+  803bcd:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803bd2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803bd5:	50                   	push   %eax
+  803bd6:	e8 0b d7 ff ff       	call   8012e6 <sys_futex_wake>
+  803bdb:	83 c4 10             	add    $0x10,%esp
+  803bde:	eb d0                	jmp    803bb0 <devpipe_write+0x15a>
+				return 0;
+  803be0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803be5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803be8:	5b                   	pop    %ebx
+  803be9:	5e                   	pop    %esi
+  803bea:	5f                   	pop    %edi
+  803beb:	5d                   	pop    %ebp
+  803bec:	c3                   	ret
+
+00803bed <devpipe_stat>:
+{
+  803bed:	55                   	push   %ebp
+  803bee:	89 e5                	mov    %esp,%ebp
+  803bf0:	56                   	push   %esi
+  803bf1:	53                   	push   %ebx
+  803bf2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803bf5:	83 ec 0c             	sub    $0xc,%esp
+  803bf8:	ff 75 08             	push   0x8(%ebp)
+  803bfb:	e8 ed e1 ff ff       	call   801ded <fd2data>
+  803c00:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803c02:	83 c4 08             	add    $0x8,%esp
+  803c05:	68 66 4c 80 00       	push   $0x804c66
+  803c0a:	53                   	push   %ebx
+  803c0b:	e8 82 ce ff ff       	call   800a92 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c10:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803c13:	8b 06                	mov    (%esi),%eax
+  803c15:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803c1b:	29 c1                	sub    %eax,%ecx
+  803c1d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803c22:	89 c8                	mov    %ecx,%eax
+  803c24:	f7 e2                	mul    %edx
+  803c26:	c1 ea 0c             	shr    $0xc,%edx
+  803c29:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803c2f:	29 d1                	sub    %edx,%ecx
+  803c31:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803c37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803c3e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803c41:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803c48:	50 80 00 
+}
+  803c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c53:	5b                   	pop    %ebx
+  803c54:	5e                   	pop    %esi
+  803c55:	5d                   	pop    %ebp
+  803c56:	c3                   	ret
+
+00803c57 <devpipe_poll>:
+{
+  803c57:	55                   	push   %ebp
+  803c58:	89 e5                	mov    %esp,%ebp
+  803c5a:	57                   	push   %edi
+  803c5b:	56                   	push   %esi
+  803c5c:	53                   	push   %ebx
+  803c5d:	83 ec 18             	sub    $0x18,%esp
+  803c60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c63:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803c66:	57                   	push   %edi
+  803c67:	e8 81 e1 ff ff       	call   801ded <fd2data>
+  803c6c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803c6e:	83 c4 10             	add    $0x10,%esp
+  803c71:	89 f3                	mov    %esi,%ebx
+  803c73:	83 e3 01             	and    $0x1,%ebx
+  803c76:	75 27                	jne    803c9f <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803c78:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803c7e:	75 48                	jne    803cc8 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803c80:	89 ca                	mov    %ecx,%edx
+  803c82:	89 f8                	mov    %edi,%eax
+  803c84:	e8 ce fb ff ff       	call   803857 <_pipeisclosed>
+  803c89:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803c8b:	89 d8                	mov    %ebx,%eax
+  803c8d:	83 c8 10             	or     $0x10,%eax
+  803c90:	85 d2                	test   %edx,%edx
+  803c92:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803c95:	89 d8                	mov    %ebx,%eax
+  803c97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c9a:	5b                   	pop    %ebx
+  803c9b:	5e                   	pop    %esi
+  803c9c:	5f                   	pop    %edi
+  803c9d:	5d                   	pop    %ebp
+  803c9e:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803c9f:	8b 58 04             	mov    0x4(%eax),%ebx
+  803ca2:	8b 00                	mov    (%eax),%eax
+  803ca4:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803caa:	29 c3                	sub    %eax,%ebx
+  803cac:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803cb1:	89 d8                	mov    %ebx,%eax
+  803cb3:	f7 e2                	mul    %edx
+  803cb5:	c1 ea 0c             	shr    $0xc,%edx
+  803cb8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803cbe:	39 d3                	cmp    %edx,%ebx
+  803cc0:	0f 95 c3             	setne  %bl
+  803cc3:	0f b6 db             	movzbl %bl,%ebx
+  803cc6:	eb b0                	jmp    803c78 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803cc8:	8b 71 04             	mov    0x4(%ecx),%esi
+  803ccb:	8b 01                	mov    (%ecx),%eax
+  803ccd:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803cd3:	29 c6                	sub    %eax,%esi
+  803cd5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803cda:	89 f0                	mov    %esi,%eax
+  803cdc:	f7 e2                	mul    %edx
+  803cde:	c1 ea 0c             	shr    $0xc,%edx
+  803ce1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ce7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803ce9:	89 d8                	mov    %ebx,%eax
+  803ceb:	83 c8 04             	or     $0x4,%eax
+  803cee:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803cf4:	0f 42 d8             	cmovb  %eax,%ebx
+  803cf7:	eb 87                	jmp    803c80 <devpipe_poll+0x29>
+
+00803cf9 <pipe>:
+{
+  803cf9:	55                   	push   %ebp
+  803cfa:	89 e5                	mov    %esp,%ebp
+  803cfc:	56                   	push   %esi
+  803cfd:	53                   	push   %ebx
+  803cfe:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803d01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d04:	50                   	push   %eax
+  803d05:	e8 fa e0 ff ff       	call   801e04 <fd_alloc>
+  803d0a:	89 c3                	mov    %eax,%ebx
+  803d0c:	83 c4 10             	add    $0x10,%esp
+  803d0f:	85 c0                	test   %eax,%eax
+  803d11:	0f 88 23 01 00 00    	js     803e3a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d17:	83 ec 04             	sub    $0x4,%esp
+  803d1a:	68 07 04 00 00       	push   $0x407
+  803d1f:	ff 75 f4             	push   -0xc(%ebp)
+  803d22:	6a 00                	push   $0x0
+  803d24:	e8 9d d1 ff ff       	call   800ec6 <sys_page_alloc>
+  803d29:	89 c3                	mov    %eax,%ebx
+  803d2b:	83 c4 10             	add    $0x10,%esp
+  803d2e:	85 c0                	test   %eax,%eax
+  803d30:	0f 88 04 01 00 00    	js     803e3a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803d36:	83 ec 0c             	sub    $0xc,%esp
+  803d39:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803d3c:	50                   	push   %eax
+  803d3d:	e8 c2 e0 ff ff       	call   801e04 <fd_alloc>
+  803d42:	89 c3                	mov    %eax,%ebx
+  803d44:	83 c4 10             	add    $0x10,%esp
+  803d47:	85 c0                	test   %eax,%eax
+  803d49:	0f 88 db 00 00 00    	js     803e2a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d4f:	83 ec 04             	sub    $0x4,%esp
+  803d52:	68 07 04 00 00       	push   $0x407
+  803d57:	ff 75 f0             	push   -0x10(%ebp)
+  803d5a:	6a 00                	push   $0x0
+  803d5c:	e8 65 d1 ff ff       	call   800ec6 <sys_page_alloc>
+  803d61:	89 c3                	mov    %eax,%ebx
+  803d63:	83 c4 10             	add    $0x10,%esp
+  803d66:	85 c0                	test   %eax,%eax
+  803d68:	0f 88 bc 00 00 00    	js     803e2a <pipe+0x131>
+	va = fd2data(fd0);
+  803d6e:	83 ec 0c             	sub    $0xc,%esp
+  803d71:	ff 75 f4             	push   -0xc(%ebp)
+  803d74:	e8 74 e0 ff ff       	call   801ded <fd2data>
+  803d79:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d7b:	83 c4 0c             	add    $0xc,%esp
+  803d7e:	68 07 04 00 00       	push   $0x407
+  803d83:	50                   	push   %eax
+  803d84:	6a 00                	push   $0x0
+  803d86:	e8 3b d1 ff ff       	call   800ec6 <sys_page_alloc>
+  803d8b:	89 c3                	mov    %eax,%ebx
+  803d8d:	83 c4 10             	add    $0x10,%esp
+  803d90:	85 c0                	test   %eax,%eax
+  803d92:	0f 88 82 00 00 00    	js     803e1a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803d98:	83 ec 0c             	sub    $0xc,%esp
+  803d9b:	ff 75 f0             	push   -0x10(%ebp)
+  803d9e:	e8 4a e0 ff ff       	call   801ded <fd2data>
+  803da3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803daa:	50                   	push   %eax
+  803dab:	6a 00                	push   $0x0
+  803dad:	56                   	push   %esi
+  803dae:	6a 00                	push   $0x0
+  803db0:	e8 54 d1 ff ff       	call   800f09 <sys_page_map>
+  803db5:	89 c3                	mov    %eax,%ebx
+  803db7:	83 c4 20             	add    $0x20,%esp
+  803dba:	85 c0                	test   %eax,%eax
+  803dbc:	78 4e                	js     803e0c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803dbe:	a1 60 50 80 00       	mov    0x805060,%eax
+  803dc3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803dc6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803dc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803dcb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803dd2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803dd5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803dd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803dda:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803de1:	83 ec 0c             	sub    $0xc,%esp
+  803de4:	ff 75 f4             	push   -0xc(%ebp)
+  803de7:	e8 f1 df ff ff       	call   801ddd <fd2num>
+  803dec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803def:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803df1:	83 c4 04             	add    $0x4,%esp
+  803df4:	ff 75 f0             	push   -0x10(%ebp)
+  803df7:	e8 e1 df ff ff       	call   801ddd <fd2num>
+  803dfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803dff:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803e02:	83 c4 10             	add    $0x10,%esp
+  803e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e0a:	eb 2e                	jmp    803e3a <pipe+0x141>
+	sys_page_unmap(0, va);
+  803e0c:	83 ec 08             	sub    $0x8,%esp
+  803e0f:	56                   	push   %esi
+  803e10:	6a 00                	push   $0x0
+  803e12:	e8 34 d1 ff ff       	call   800f4b <sys_page_unmap>
+  803e17:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803e1a:	83 ec 08             	sub    $0x8,%esp
+  803e1d:	ff 75 f0             	push   -0x10(%ebp)
+  803e20:	6a 00                	push   $0x0
+  803e22:	e8 24 d1 ff ff       	call   800f4b <sys_page_unmap>
+  803e27:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803e2a:	83 ec 08             	sub    $0x8,%esp
+  803e2d:	ff 75 f4             	push   -0xc(%ebp)
+  803e30:	6a 00                	push   $0x0
+  803e32:	e8 14 d1 ff ff       	call   800f4b <sys_page_unmap>
+  803e37:	83 c4 10             	add    $0x10,%esp
+}
+  803e3a:	89 d8                	mov    %ebx,%eax
+  803e3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e3f:	5b                   	pop    %ebx
+  803e40:	5e                   	pop    %esi
+  803e41:	5d                   	pop    %ebp
+  803e42:	c3                   	ret
+
+00803e43 <pipeisclosed>:
+{
+  803e43:	55                   	push   %ebp
+  803e44:	89 e5                	mov    %esp,%ebp
+  803e46:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803e4c:	50                   	push   %eax
+  803e4d:	ff 75 08             	push   0x8(%ebp)
+  803e50:	e8 ff df ff ff       	call   801e54 <fd_lookup>
+  803e55:	83 c4 10             	add    $0x10,%esp
+  803e58:	85 c0                	test   %eax,%eax
+  803e5a:	78 18                	js     803e74 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803e5c:	83 ec 0c             	sub    $0xc,%esp
+  803e5f:	ff 75 f4             	push   -0xc(%ebp)
+  803e62:	e8 86 df ff ff       	call   801ded <fd2data>
+  803e67:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e6c:	e8 e6 f9 ff ff       	call   803857 <_pipeisclosed>
+  803e71:	83 c4 10             	add    $0x10,%esp
+}
+  803e74:	c9                   	leave
+  803e75:	c3                   	ret
+
+00803e76 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803e76:	55                   	push   %ebp
+  803e77:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803e79:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e7c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e82:	5d                   	pop    %ebp
+  803e83:	c3                   	ret
+
+00803e84 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803e84:	55                   	push   %ebp
+  803e85:	89 e5                	mov    %esp,%ebp
+  803e87:	53                   	push   %ebx
+  803e88:	83 ec 04             	sub    $0x4,%esp
+  803e8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803e8e:	8b 03                	mov    (%ebx),%eax
+  803e90:	85 c0                	test   %eax,%eax
+  803e92:	75 05                	jne    803e99 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803e94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e97:	c9                   	leave
+  803e98:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803e99:	83 ec 08             	sub    $0x8,%esp
+  803e9c:	50                   	push   %eax
+  803e9d:	8d 43 04             	lea    0x4(%ebx),%eax
+  803ea0:	50                   	push   %eax
+  803ea1:	e8 f5 d2 ff ff       	call   80119b <sys_page_batch>
+	pb->pb_n = 0;
+  803ea6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803eac:	83 c4 10             	add    $0x10,%esp
+  803eaf:	eb e3                	jmp    803e94 <pgbatch_flush+0x10>
+
+00803eb1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803eb1:	55                   	push   %ebp
+  803eb2:	89 e5                	mov    %esp,%ebp
+  803eb4:	56                   	push   %esi
+  803eb5:	53                   	push   %ebx
+  803eb6:	89 c3                	mov    %eax,%ebx
+  803eb8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803eba:	83 38 20             	cmpl   $0x20,(%eax)
+  803ebd:	74 2c                	je     803eeb <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803ebf:	8b 03                	mov    (%ebx),%eax
+  803ec1:	8d 50 01             	lea    0x1(%eax),%edx
+  803ec4:	89 13                	mov    %edx,(%ebx)
+  803ec6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803ec9:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803ecd:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803ecf:	83 ec 04             	sub    $0x4,%esp
+  803ed2:	6a 18                	push   $0x18
+  803ed4:	6a 00                	push   $0x0
+  803ed6:	50                   	push   %eax
+  803ed7:	e8 31 cd ff ff       	call   800c0d <memset>
+	return 0;
+  803edc:	83 c4 10             	add    $0x10,%esp
+  803edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803ee7:	5b                   	pop    %ebx
+  803ee8:	5e                   	pop    %esi
+  803ee9:	5d                   	pop    %ebp
+  803eea:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803eeb:	83 ec 0c             	sub    $0xc,%esp
+  803eee:	50                   	push   %eax
+  803eef:	e8 90 ff ff ff       	call   803e84 <pgbatch_flush>
+  803ef4:	83 c4 10             	add    $0x10,%esp
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	79 c4                	jns    803ebf <pgbatch_slot+0xe>
+  803efb:	eb e7                	jmp    803ee4 <pgbatch_slot+0x33>
+
+00803efd <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803efd:	55                   	push   %ebp
+  803efe:	89 e5                	mov    %esp,%ebp
+  803f00:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f03:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f06:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f09:	e8 a3 ff ff ff       	call   803eb1 <pgbatch_slot>
+  803f0e:	85 c0                	test   %eax,%eax
+  803f10:	78 20                	js     803f32 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803f12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f15:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803f1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f1e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f21:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f24:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f27:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f2a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f32:	c9                   	leave
+  803f33:	c3                   	ret
+
+00803f34 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803f34:	55                   	push   %ebp
+  803f35:	89 e5                	mov    %esp,%ebp
+  803f37:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f3a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f40:	e8 6c ff ff ff       	call   803eb1 <pgbatch_slot>
+  803f45:	85 c0                	test   %eax,%eax
+  803f47:	78 2c                	js     803f75 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803f49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f4c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803f52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f55:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803f58:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f5b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803f5e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f61:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803f64:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f67:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803f6a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803f6d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f75:	c9                   	leave
+  803f76:	c3                   	ret
+
+00803f77 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803f77:	55                   	push   %ebp
+  803f78:	89 e5                	mov    %esp,%ebp
+  803f7a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803f7d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f83:	e8 29 ff ff ff       	call   803eb1 <pgbatch_slot>
+  803f88:	85 c0                	test   %eax,%eax
+  803f8a:	78 1a                	js     803fa6 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803f8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f8f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803f95:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803f98:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803f9b:	8b 55 10             	mov    0x10(%ebp),%edx
+  803f9e:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa6:	c9                   	leave
+  803fa7:	c3                   	ret
+
+00803fa8 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803fa8:	55                   	push   %ebp
+  803fa9:	89 e5                	mov    %esp,%ebp
+  803fab:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803fae:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb4:	e8 f8 fe ff ff       	call   803eb1 <pgbatch_slot>
+  803fb9:	85 c0                	test   %eax,%eax
+  803fbb:	78 20                	js     803fdd <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fc0:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803fc6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803fc9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803fcc:	8b 55 10             	mov    0x10(%ebp),%edx
+  803fcf:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803fd2:	8b 55 14             	mov    0x14(%ebp),%edx
+  803fd5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fdd:	c9                   	leave
+  803fde:	c3                   	ret
+
+00803fdf <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803fdf:	55                   	push   %ebp
+  803fe0:	89 e5                	mov    %esp,%ebp
+  803fe2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803fe5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803fe8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803feb:	e8 c1 fe ff ff       	call   803eb1 <pgbatch_slot>
+  803ff0:	85 c0                	test   %eax,%eax
+  803ff2:	78 26                	js     80401a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803ff4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ff7:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803ffd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804000:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  804003:	8b 55 10             	mov    0x10(%ebp),%edx
+  804006:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804009:	8b 55 14             	mov    0x14(%ebp),%edx
+  80400c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  80400f:	8b 55 18             	mov    0x18(%ebp),%edx
+  804012:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804015:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80401a:	c9                   	leave
+  80401b:	c3                   	ret
+
+0080401c <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  80401c:	55                   	push   %ebp
+  80401d:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  80401f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804022:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804028:	5d                   	pop    %ebp
+  804029:	c3                   	ret
+
+0080402a <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80402a:	55                   	push   %ebp
+  80402b:	89 e5                	mov    %esp,%ebp
+  80402d:	56                   	push   %esi
+  80402e:	53                   	push   %ebx
+  80402f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804032:	b8 00 00 00 00       	mov    $0x0,%eax
+  804037:	ba 01 00 00 00       	mov    $0x1,%edx
+  80403c:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804040:	85 c0                	test   %eax,%eax
+  804042:	74 2f                	je     804073 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804044:	83 f8 02             	cmp    $0x2,%eax
+  804047:	74 0c                	je     804055 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  804049:	b8 02 00 00 00       	mov    $0x2,%eax
+  80404e:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  804051:	85 c0                	test   %eax,%eax
+  804053:	74 1e                	je     804073 <mutex_lock+0x49>
+  804055:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  80405a:	83 ec 04             	sub    $0x4,%esp
+  80405d:	6a ff                	push   $0xffffffff
+  80405f:	6a 02                	push   $0x2
+  804061:	53                   	push   %ebx
+  804062:	e8 5d d2 ff ff       	call   8012c4 <sys_futex_wait>
+  804067:	89 f0                	mov    %esi,%eax
+  804069:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80406c:	83 c4 10             	add    $0x10,%esp
+  80406f:	85 c0                	test   %eax,%eax
+  804071:	75 e7                	jne    80405a <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804073:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804076:	5b                   	pop    %ebx
+  804077:	5e                   	pop    %esi
+  804078:	5d                   	pop    %ebp
+  804079:	c3                   	ret
+
+0080407a <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  80407a:	55                   	push   %ebp
+  80407b:	89 e5                	mov    %esp,%ebp
+  80407d:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804080:	b8 00 00 00 00       	mov    $0x0,%eax
+  804085:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80408a:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  80408e:	85 c0                	test   %eax,%eax
+  804090:	0f 94 c0             	sete   %al
+  804093:	0f b6 c0             	movzbl %al,%eax
+}
+  804096:	5d                   	pop    %ebp
+  804097:	c3                   	ret
+
+00804098 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804098:	55                   	push   %ebp
+  804099:	89 e5                	mov    %esp,%ebp
+  80409b:	83 ec 08             	sub    $0x8,%esp
+  80409e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  8040a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a6:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8040a9:	83 f8 02             	cmp    $0x2,%eax
+  8040ac:	74 02                	je     8040b0 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  8040ae:	c9                   	leave
+  8040af:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8040b0:	83 ec 08             	sub    $0x8,%esp
+  8040b3:	6a 01                	push   $0x1
+  8040b5:	52                   	push   %edx
+  8040b6:	e8 2b d2 ff ff       	call   8012e6 <sys_futex_wake>
+  8040bb:	83 c4 10             	add    $0x10,%esp
+}
+  8040be:	eb ee                	jmp    8040ae <mutex_unlock+0x16>
+
+008040c0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  8040c0:	55                   	push   %ebp
+  8040c1:	89 e5                	mov    %esp,%ebp
+  8040c3:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  8040c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  8040cc:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8040d3:	5d                   	pop    %ebp
+  8040d4:	c3                   	ret
+
+008040d5 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8040d5:	55                   	push   %ebp
+  8040d6:	89 e5                	mov    %esp,%ebp
+  8040d8:	57                   	push   %edi
+  8040d9:	56                   	push   %esi
+  8040da:	53                   	push   %ebx
+  8040db:	83 ec 18             	sub    $0x18,%esp
+  8040de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8040e1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  8040e4:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  8040e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040eb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  8040f0:	57                   	push   %edi
+  8040f1:	e8 a2 ff ff ff       	call   804098 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8040f6:	83 c4 0c             	add    $0xc,%esp
+  8040f9:	ff 75 10             	push   0x10(%ebp)
+  8040fc:	56                   	push   %esi
+  8040fd:	53                   	push   %ebx
+  8040fe:	e8 c1 d1 ff ff       	call   8012c4 <sys_futex_wait>
+  804103:	89 c6                	mov    %eax,%esi
+  804105:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80410a:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  80410f:	89 3c 24             	mov    %edi,(%esp)
+  804112:	e8 13 ff ff ff       	call   80402a <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804117:	83 c4 10             	add    $0x10,%esp
+  80411a:	83 fe ef             	cmp    $0xffffffef,%esi
+  80411d:	74 05                	je     804124 <cond_timedwait+0x4f>
+  80411f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804124:	89 f0                	mov    %esi,%eax
+  804126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804129:	5b                   	pop    %ebx
+  80412a:	5e                   	pop    %esi
+  80412b:	5f                   	pop    %edi
+  80412c:	5d                   	pop    %ebp
+  80412d:	c3                   	ret
+
+0080412e <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  80412e:	55                   	push   %ebp
+  80412f:	89 e5                	mov    %esp,%ebp
+  804131:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804134:	6a ff                	push   $0xffffffff
+  804136:	ff 75 0c             	push   0xc(%ebp)
+  804139:	ff 75 08             	push   0x8(%ebp)
+  80413c:	e8 94 ff ff ff       	call   8040d5 <cond_timedwait>
+}
+  804141:	83 c4 10             	add    $0x10,%esp
+  804144:	c9                   	leave
+  804145:	c3                   	ret
+
+00804146 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804146:	55                   	push   %ebp
+  804147:	89 e5                	mov    %esp,%ebp
+  804149:	83 ec 08             	sub    $0x8,%esp
+  80414c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80414f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804154:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804158:	8b 50 04             	mov    0x4(%eax),%edx
+  80415b:	85 d2                	test   %edx,%edx
+  80415d:	75 02                	jne    804161 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  80415f:	c9                   	leave
+  804160:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804161:	83 ec 08             	sub    $0x8,%esp
+  804164:	6a 01                	push   $0x1
+  804166:	50                   	push   %eax
+  804167:	e8 7a d1 ff ff       	call   8012e6 <sys_futex_wake>
+  80416c:	83 c4 10             	add    $0x10,%esp
+}
+  80416f:	eb ee                	jmp    80415f <cond_signal+0x19>
+
+00804171 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804171:	55                   	push   %ebp
+  804172:	89 e5                	mov    %esp,%ebp
+  804174:	83 ec 08             	sub    $0x8,%esp
+  804177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80417a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80417f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804183:	8b 50 04             	mov    0x4(%eax),%edx
+  804186:	85 d2                	test   %edx,%edx
+  804188:	75 02                	jne    80418c <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80418a:	c9                   	leave
+  80418b:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80418c:	83 ec 08             	sub    $0x8,%esp
+  80418f:	68 00 04 00 00       	push   $0x400
+  804194:	50                   	push   %eax
+  804195:	e8 4c d1 ff ff       	call   8012e6 <sys_futex_wake>
+  80419a:	83 c4 10             	add    $0x10,%esp
+}
+  80419d:	eb eb                	jmp    80418a <cond_broadcast+0x19>
+
+0080419f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80419f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a4:	c3                   	ret
+
+008041a5 <devcons_poll>:
+{
+  8041a5:	55                   	push   %ebp
+  8041a6:	89 e5                	mov    %esp,%ebp
+  8041a8:	53                   	push   %ebx
+  8041a9:	83 ec 04             	sub    $0x4,%esp
+  8041ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8041af:	89 da                	mov    %ebx,%edx
+  8041b1:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8041b4:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  8041bb:	74 0c                	je     8041c9 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8041bd:	89 d8                	mov    %ebx,%eax
+  8041bf:	83 e0 01             	and    $0x1,%eax
+  8041c2:	09 d0                	or     %edx,%eax
+}
+  8041c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041c7:	c9                   	leave
+  8041c8:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8041c9:	e8 5a cc ff ff       	call   800e28 <sys_cgetc>
+  8041ce:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8041d3:	89 da                	mov    %ebx,%edx
+  8041d5:	83 e2 04             	and    $0x4,%edx
+  8041d8:	85 c0                	test   %eax,%eax
+  8041da:	74 e6                	je     8041c2 <devcons_poll+0x1d>
+  8041dc:	eb df                	jmp    8041bd <devcons_poll+0x18>
+
+008041de <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8041de:	55                   	push   %ebp
+  8041df:	89 e5                	mov    %esp,%ebp
+  8041e1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8041e4:	68 72 4c 80 00       	push   $0x804c72
+  8041e9:	ff 75 0c             	push   0xc(%ebp)
+  8041ec:	e8 a1 c8 ff ff       	call   800a92 <strcpy>
+	return 0;
+}
+  8041f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f6:	c9                   	leave
+  8041f7:	c3                   	ret
+
+008041f8 <devcons_write>:
+{
+  8041f8:	55                   	push   %ebp
+  8041f9:	89 e5                	mov    %esp,%ebp
+  8041fb:	57                   	push   %edi
+  8041fc:	56                   	push   %esi
+  8041fd:	53                   	push   %ebx
+  8041fe:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804204:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804207:	85 ff                	test   %edi,%edi
+  804209:	74 51                	je     80425c <devcons_write+0x64>
+  80420b:	be 00 00 00 00       	mov    $0x0,%esi
+  804210:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804215:	89 fb                	mov    %edi,%ebx
+  804217:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804219:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80421e:	39 d3                	cmp    %edx,%ebx
+  804220:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804223:	83 ec 04             	sub    $0x4,%esp
+  804226:	53                   	push   %ebx
+  804227:	03 45 0c             	add    0xc(%ebp),%eax
+  80422a:	50                   	push   %eax
+  80422b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804231:	50                   	push   %eax
+  804232:	e8 0b ca ff ff       	call   800c42 <memmove>
+		sys_cputs(buf, m);
+  804237:	83 c4 08             	add    $0x8,%esp
+  80423a:	53                   	push   %ebx
+  80423b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804241:	50                   	push   %eax
+  804242:	e8 c3 cb ff ff       	call   800e0a <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804247:	01 de                	add    %ebx,%esi
+  804249:	89 f0                	mov    %esi,%eax
+  80424b:	83 c4 10             	add    $0x10,%esp
+  80424e:	39 fe                	cmp    %edi,%esi
+  804250:	72 c3                	jb     804215 <devcons_write+0x1d>
+}
+  804252:	89 f0                	mov    %esi,%eax
+  804254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804257:	5b                   	pop    %ebx
+  804258:	5e                   	pop    %esi
+  804259:	5f                   	pop    %edi
+  80425a:	5d                   	pop    %ebp
+  80425b:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80425c:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804261:	eb ef                	jmp    804252 <devcons_write+0x5a>
+
+00804263 <devcons_read>:
+{
+  804263:	55                   	push   %ebp
+  804264:	89 e5                	mov    %esp,%ebp
+  804266:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804269:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80426e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804272:	74 36                	je     8042aa <devcons_read+0x47>
+	c = cons_peek;
+  804274:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  804279:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  804280:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804283:	85 c0                	test   %eax,%eax
+  804285:	75 10                	jne    804297 <devcons_read+0x34>
+  804287:	e8 9c cb ff ff       	call   800e28 <sys_cgetc>
+  80428c:	85 c0                	test   %eax,%eax
+  80428e:	75 07                	jne    804297 <devcons_read+0x34>
+		sys_yield();
+  804290:	e8 12 cc ff ff       	call   800ea7 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804295:	eb f0                	jmp    804287 <devcons_read+0x24>
+	if (c < 0)
+  804297:	85 c0                	test   %eax,%eax
+  804299:	78 0f                	js     8042aa <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80429b:	83 f8 04             	cmp    $0x4,%eax
+  80429e:	74 0c                	je     8042ac <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8042a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042a3:	88 02                	mov    %al,(%edx)
+	return 1;
+  8042a5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8042aa:	c9                   	leave
+  8042ab:	c3                   	ret
+		return 0;
+  8042ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b1:	eb f7                	jmp    8042aa <devcons_read+0x47>
+
+008042b3 <cputchar>:
+{
+  8042b3:	55                   	push   %ebp
+  8042b4:	89 e5                	mov    %esp,%ebp
+  8042b6:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8042b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042bc:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8042bf:	6a 01                	push   $0x1
+  8042c1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042c4:	50                   	push   %eax
+  8042c5:	e8 40 cb ff ff       	call   800e0a <sys_cputs>
+}
+  8042ca:	83 c4 10             	add    $0x10,%esp
+  8042cd:	c9                   	leave
+  8042ce:	c3                   	ret
+
+008042cf <getchar>:
+{
+  8042cf:	55                   	push   %ebp
+  8042d0:	89 e5                	mov    %esp,%ebp
+  8042d2:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8042d5:	6a 01                	push   $0x1
+  8042d7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8042da:	50                   	push   %eax
+  8042db:	6a 00                	push   $0x0
+  8042dd:	e8 f6 dd ff ff       	call   8020d8 <read>
+	if (r < 0)
+  8042e2:	83 c4 10             	add    $0x10,%esp
+  8042e5:	85 c0                	test   %eax,%eax
+  8042e7:	78 06                	js     8042ef <getchar+0x20>
+	if (r < 1)
+  8042e9:	74 06                	je     8042f1 <getchar+0x22>
+	return c;
+  8042eb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8042ef:	c9                   	leave
+  8042f0:	c3                   	ret
+		return -E_EOF;
+  8042f1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8042f6:	eb f7                	jmp    8042ef <getchar+0x20>
+
+008042f8 <iscons>:
+{
+  8042f8:	55                   	push   %ebp
+  8042f9:	89 e5                	mov    %esp,%ebp
+  8042fb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8042fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804301:	50                   	push   %eax
+  804302:	ff 75 08             	push   0x8(%ebp)
+  804305:	e8 4a db ff ff       	call   801e54 <fd_lookup>
+  80430a:	83 c4 10             	add    $0x10,%esp
+  80430d:	85 c0                	test   %eax,%eax
+  80430f:	78 11                	js     804322 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804311:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804314:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80431a:	39 10                	cmp    %edx,(%eax)
+  80431c:	0f 94 c0             	sete   %al
+  80431f:	0f b6 c0             	movzbl %al,%eax
+}
+  804322:	c9                   	leave
+  804323:	c3                   	ret
+
+00804324 <opencons>:
+{
+  804324:	55                   	push   %ebp
+  804325:	89 e5                	mov    %esp,%ebp
+  804327:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80432a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80432d:	50                   	push   %eax
+  80432e:	e8 d1 da ff ff       	call   801e04 <fd_alloc>
+  804333:	83 c4 10             	add    $0x10,%esp
+  804336:	85 c0                	test   %eax,%eax
+  804338:	78 3a                	js     804374 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80433a:	83 ec 04             	sub    $0x4,%esp
+  80433d:	68 07 04 00 00       	push   $0x407
+  804342:	ff 75 f4             	push   -0xc(%ebp)
+  804345:	6a 00                	push   $0x0
+  804347:	e8 7a cb ff ff       	call   800ec6 <sys_page_alloc>
+  80434c:	83 c4 10             	add    $0x10,%esp
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	78 21                	js     804374 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804353:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804356:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80435c:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80435e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804361:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804368:	83 ec 0c             	sub    $0xc,%esp
+  80436b:	50                   	push   %eax
+  80436c:	e8 6c da ff ff       	call   801ddd <fd2num>
+  804371:	83 c4 10             	add    $0x10,%esp
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+00804376 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804376:	55                   	push   %ebp
+  804377:	89 e5                	mov    %esp,%ebp
+  804379:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80437c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804383:	74 0a                	je     80438f <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804385:	8b 45 08             	mov    0x8(%ebp),%eax
+  804388:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80438d:	c9                   	leave
+  80438e:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  80438f:	83 ec 04             	sub    $0x4,%esp
+  804392:	6a 07                	push   $0x7
+  804394:	68 00 f0 bf ee       	push   $0xeebff000
+  804399:	6a 00                	push   $0x0
+  80439b:	e8 26 cb ff ff       	call   800ec6 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8043a0:	83 c4 08             	add    $0x8,%esp
+  8043a3:	68 b4 43 80 00       	push   $0x8043b4
+  8043a8:	6a 00                	push   $0x0
+  8043aa:	e8 62 cc ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  8043af:	83 c4 10             	add    $0x10,%esp
+  8043b2:	eb d1                	jmp    804385 <set_pgfault_handler+0xf>
+
+008043b4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8043b4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8043b5:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  8043ba:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8043bc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  8043bf:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8043c3:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  8043c6:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8043ca:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8043cc:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8043d0:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8043d3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8043d4:	83 c4 04             	add    $0x4,%esp
+	popf
+  8043d7:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8043d8:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8043d9:	c3                   	ret
+
+008043da <__udivdi3>:
+  8043da:	57                   	push   %edi
+  8043db:	56                   	push   %esi
+  8043dc:	53                   	push   %ebx
+  8043dd:	83 ec 20             	sub    $0x20,%esp
+  8043e0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8043e4:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8043e8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8043ec:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8043f0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8043f4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8043f8:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8043fc:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804400:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80440a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80440f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804416:	00 
+  804417:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80441e:	00 
+  80441f:	eb 08                	jmp    804429 <__udivdi3+0x4f>
+  804421:	83 e9 01             	sub    $0x1,%ecx
+  804424:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804427:	74 68                	je     804491 <__udivdi3+0xb7>
+  804429:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80442d:	01 c0                	add    %eax,%eax
+  80442f:	89 c6                	mov    %eax,%esi
+  804431:	89 d7                	mov    %edx,%edi
+  804433:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804437:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80443b:	0f ad d0             	shrd   %cl,%edx,%eax
+  80443e:	d3 ea                	shr    %cl,%edx
+  804440:	f6 c1 20             	test   $0x20,%cl
+  804443:	74 04                	je     804449 <__udivdi3+0x6f>
+  804445:	89 d0                	mov    %edx,%eax
+  804447:	31 d2                	xor    %edx,%edx
+  804449:	83 e0 01             	and    $0x1,%eax
+  80444c:	89 04 24             	mov    %eax,(%esp)
+  80444f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804456:	00 
+  804457:	8b 04 24             	mov    (%esp),%eax
+  80445a:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80445e:	09 f0                	or     %esi,%eax
+  804460:	09 fa                	or     %edi,%edx
+  804462:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804466:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80446a:	39 f0                	cmp    %esi,%eax
+  80446c:	89 d3                	mov    %edx,%ebx
+  80446e:	19 fb                	sbb    %edi,%ebx
+  804470:	72 af                	jb     804421 <__udivdi3+0x47>
+  804472:	29 f0                	sub    %esi,%eax
+  804474:	19 fa                	sbb    %edi,%edx
+  804476:	89 cf                	mov    %ecx,%edi
+  804478:	c1 ef 05             	shr    $0x5,%edi
+  80447b:	83 e7 01             	and    $0x1,%edi
+  80447e:	89 fe                	mov    %edi,%esi
+  804480:	83 f6 01             	xor    $0x1,%esi
+  804483:	d3 e6                	shl    %cl,%esi
+  804485:	d3 e7                	shl    %cl,%edi
+  804487:	09 74 24 18          	or     %esi,0x18(%esp)
+  80448b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80448f:	eb 90                	jmp    804421 <__udivdi3+0x47>
+  804491:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804495:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804499:	83 c4 20             	add    $0x20,%esp
+  80449c:	5b                   	pop    %ebx
+  80449d:	5e                   	pop    %esi
+  80449e:	5f                   	pop    %edi
+  80449f:	c3                   	ret
+
+008044a0 <__umoddi3>:
+  8044a0:	57                   	push   %edi
+  8044a1:	56                   	push   %esi
+  8044a2:	53                   	push   %ebx
+  8044a3:	83 ec 08             	sub    $0x8,%esp
+  8044a6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8044aa:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8044ae:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8044b2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8044b6:	57                   	push   %edi
+  8044b7:	56                   	push   %esi
+  8044b8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8044bc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8044c0:	52                   	push   %edx
+  8044c1:	50                   	push   %eax
+  8044c2:	e8 13 ff ff ff       	call   8043da <__udivdi3>
+  8044c7:	89 c3                	mov    %eax,%ebx
+  8044c9:	0f af d6             	imul   %esi,%edx
+  8044cc:	89 f9                	mov    %edi,%ecx
+  8044ce:	0f af cb             	imul   %ebx,%ecx
+  8044d1:	01 d1                	add    %edx,%ecx
+  8044d3:	89 d8                	mov    %ebx,%eax
+  8044d5:	f7 e6                	mul    %esi
+  8044d7:	89 c6                	mov    %eax,%esi
+  8044d9:	89 d7                	mov    %edx,%edi
+  8044db:	01 cf                	add    %ecx,%edi
+  8044dd:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8044e1:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044e5:	29 f0                	sub    %esi,%eax
+  8044e7:	19 fa                	sbb    %edi,%edx
+  8044e9:	83 c4 18             	add    $0x18,%esp
+  8044ec:	5b                   	pop    %ebx
+  8044ed:	5e                   	pop    %esi
+  8044ee:	5f                   	pop    %edi
+  8044ef:	c3                   	ret
+
+008044f0 <__divdi3>:
+  8044f0:	53                   	push   %ebx
+  8044f1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044f5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8044f9:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8044fd:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804501:	85 d2                	test   %edx,%edx
+  804503:	78 12                	js     804517 <__divdi3+0x27>
+  804505:	85 db                	test   %ebx,%ebx
+  804507:	78 2e                	js     804537 <__divdi3+0x47>
+  804509:	53                   	push   %ebx
+  80450a:	51                   	push   %ecx
+  80450b:	52                   	push   %edx
+  80450c:	50                   	push   %eax
+  80450d:	e8 c8 fe ff ff       	call   8043da <__udivdi3>
+  804512:	83 c4 10             	add    $0x10,%esp
+  804515:	eb 1e                	jmp    804535 <__divdi3+0x45>
+  804517:	f7 d8                	neg    %eax
+  804519:	83 d2 00             	adc    $0x0,%edx
+  80451c:	f7 da                	neg    %edx
+  80451e:	85 db                	test   %ebx,%ebx
+  804520:	78 2a                	js     80454c <__divdi3+0x5c>
+  804522:	53                   	push   %ebx
+  804523:	51                   	push   %ecx
+  804524:	52                   	push   %edx
+  804525:	50                   	push   %eax
+  804526:	e8 af fe ff ff       	call   8043da <__udivdi3>
+  80452b:	83 c4 10             	add    $0x10,%esp
+  80452e:	f7 d8                	neg    %eax
+  804530:	83 d2 00             	adc    $0x0,%edx
+  804533:	f7 da                	neg    %edx
+  804535:	5b                   	pop    %ebx
+  804536:	c3                   	ret
+  804537:	f7 d9                	neg    %ecx
+  804539:	83 d3 00             	adc    $0x0,%ebx
+  80453c:	f7 db                	neg    %ebx
+  80453e:	53                   	push   %ebx
+  80453f:	51                   	push   %ecx
+  804540:	52                   	push   %edx
+  804541:	50                   	push   %eax
+  804542:	e8 93 fe ff ff       	call   8043da <__udivdi3>
+  804547:	83 c4 10             	add    $0x10,%esp
+  80454a:	eb e2                	jmp    80452e <__divdi3+0x3e>
+  80454c:	f7 d9                	neg    %ecx
+  80454e:	83 d3 00             	adc    $0x0,%ebx
+  804551:	f7 db                	neg    %ebx
+  804553:	53                   	push   %ebx
+  804554:	51                   	push   %ecx
+  804555:	52                   	push   %edx
+  804556:	50                   	push   %eax
+  804557:	e8 7e fe ff ff       	call   8043da <__udivdi3>
+  80455c:	83 c4 10             	add    $0x10,%esp
+  80455f:	eb d4                	jmp    804535 <__divdi3+0x45>
+
+00804561 <__moddi3>:
+  804561:	57                   	push   %edi
+  804562:	56                   	push   %esi
+  804563:	53                   	push   %ebx
+  804564:	83 ec 08             	sub    $0x8,%esp
+  804567:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80456b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80456f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804573:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804577:	57                   	push   %edi
+  804578:	56                   	push   %esi
+  804579:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80457d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804581:	52                   	push   %edx
+  804582:	50                   	push   %eax
+  804583:	e8 68 ff ff ff       	call   8044f0 <__divdi3>
+  804588:	89 c3                	mov    %eax,%ebx
+  80458a:	0f af d6             	imul   %esi,%edx
+  80458d:	89 f9                	mov    %edi,%ecx
+  80458f:	0f af cb             	imul   %ebx,%ecx
+  804592:	01 d1                	add    %edx,%ecx
+  804594:	89 d8                	mov    %ebx,%eax
+  804596:	f7 e6                	mul    %esi
+  804598:	89 c6                	mov    %eax,%esi
+  80459a:	89 d7                	mov    %edx,%edi
+  80459c:	01 cf                	add    %ecx,%edi
+  80459e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8045a2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8045a6:	29 f0                	sub    %esi,%eax
+  8045a8:	19 fa                	sbb    %edi,%edx
+  8045aa:	83 c4 18             	add    $0x18,%esp
+  8045ad:	5b                   	pop    %ebx
+  8045ae:	5e                   	pop    %esi
+  8045af:	5f                   	pop    %edi
+  8045b0:	c3                   	ret
@@ -0,0 +1,9126 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a4 01 00 00       	call   8001d5 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003e:	68 80 45 80 00       	push   $0x804580
+  800043:	e8 0f 03 00 00       	call   800357 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800048:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80004b:	89 04 24             	mov    %eax,(%esp)
+  80004e:	e8 ec 38 00 00       	call   80393f <pipe>
+  800053:	83 c4 10             	add    $0x10,%esp
+  800056:	85 c0                	test   %eax,%eax
+  800058:	78 5e                	js     8000b8 <umain+0x83>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  80005a:	e8 2b 14 00 00       	call   80148a <fork>
+  80005f:	89 c7                	mov    %eax,%edi
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 65                	js     8000ca <umain+0x95>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800065:	74 75                	je     8000dc <umain+0xa7>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800067:	89 fb                	mov    %edi,%ebx
+  800069:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (kid->env_status == ENV_RUNNABLE)
+  80006f:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  800075:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80007b:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007e:	83 f8 02             	cmp    $0x2,%eax
+  800081:	0f 85 d1 00 00 00    	jne    800158 <umain+0x123>
+		if (pipeisclosed(p[0]) != 0) {
+  800087:	83 ec 0c             	sub    $0xc,%esp
+  80008a:	ff 75 e0             	push   -0x20(%ebp)
+  80008d:	e8 f7 39 00 00       	call   803a89 <pipeisclosed>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	74 e2                	je     80007b <umain+0x46>
+			cprintf("\nRACE: pipe appears closed\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 f0 45 80 00       	push   $0x8045f0
+  8000a1:	e8 b1 02 00 00       	call   800357 <cprintf>
+			sys_env_destroy(r);
+  8000a6:	89 3c 24             	mov    %edi,(%esp)
+  8000a9:	e8 55 0d 00 00       	call   800e03 <sys_env_destroy>
+			exit();
+  8000ae:	e8 af 01 00 00       	call   800262 <exit>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+  8000b6:	eb c3                	jmp    80007b <umain+0x46>
+		panic("pipe: %e", r);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 ce 45 80 00       	push   $0x8045ce
+  8000be:	6a 0d                	push   $0xd
+  8000c0:	68 d7 45 80 00       	push   $0x8045d7
+  8000c5:	e8 b2 01 00 00       	call   80027c <_panic>
+		panic("fork: %e", r);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 3d 4a 80 00       	push   $0x804a3d
+  8000d0:	6a 0f                	push   $0xf
+  8000d2:	68 d7 45 80 00       	push   $0x8045d7
+  8000d7:	e8 a0 01 00 00       	call   80027c <_panic>
+		close(p[1]);
+  8000dc:	83 ec 0c             	sub    $0xc,%esp
+  8000df:	ff 75 e4             	push   -0x1c(%ebp)
+  8000e2:	e8 36 1b 00 00       	call   801c1d <close>
+  8000e7:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000ea:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000ec:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000f1:	eb 31                	jmp    800124 <umain+0xef>
+			dup(p[0], 10);
+  8000f3:	83 ec 08             	sub    $0x8,%esp
+  8000f6:	6a 0a                	push   $0xa
+  8000f8:	ff 75 e0             	push   -0x20(%ebp)
+  8000fb:	e8 72 1b 00 00       	call   801c72 <dup>
+			sys_yield();
+  800100:	e8 5e 0d 00 00       	call   800e63 <sys_yield>
+			close(10);
+  800105:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  80010c:	e8 0c 1b 00 00       	call   801c1d <close>
+			sys_yield();
+  800111:	e8 4d 0d 00 00       	call   800e63 <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800116:	83 c3 01             	add    $0x1,%ebx
+  800119:	83 c4 10             	add    $0x10,%esp
+  80011c:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  800122:	74 2a                	je     80014e <umain+0x119>
+			if (i % 10 == 0)
+  800124:	89 d8                	mov    %ebx,%eax
+  800126:	f7 ee                	imul   %esi
+  800128:	c1 fa 02             	sar    $0x2,%edx
+  80012b:	89 d8                	mov    %ebx,%eax
+  80012d:	c1 f8 1f             	sar    $0x1f,%eax
+  800130:	29 c2                	sub    %eax,%edx
+  800132:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800135:	01 c0                	add    %eax,%eax
+  800137:	39 c3                	cmp    %eax,%ebx
+  800139:	75 b8                	jne    8000f3 <umain+0xbe>
+				cprintf("%d.", i);
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	53                   	push   %ebx
+  80013f:	68 ec 45 80 00       	push   $0x8045ec
+  800144:	e8 0e 02 00 00       	call   800357 <cprintf>
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	eb a5                	jmp    8000f3 <umain+0xbe>
+		exit();
+  80014e:	e8 0f 01 00 00       	call   800262 <exit>
+  800153:	e9 0f ff ff ff       	jmp    800067 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800158:	83 ec 0c             	sub    $0xc,%esp
+  80015b:	68 0c 46 80 00       	push   $0x80460c
+  800160:	e8 f2 01 00 00       	call   800357 <cprintf>
+	if (pipeisclosed(p[0]))
+  800165:	83 c4 04             	add    $0x4,%esp
+  800168:	ff 75 e0             	push   -0x20(%ebp)
+  80016b:	e8 19 39 00 00       	call   803a89 <pipeisclosed>
+  800170:	83 c4 10             	add    $0x10,%esp
+  800173:	85 c0                	test   %eax,%eax
+  800175:	75 38                	jne    8001af <umain+0x17a>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800177:	83 ec 08             	sub    $0x8,%esp
+  80017a:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017d:	50                   	push   %eax
+  80017e:	ff 75 e0             	push   -0x20(%ebp)
+  800181:	e8 52 19 00 00       	call   801ad8 <fd_lookup>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	78 36                	js     8001c3 <umain+0x18e>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018d:	83 ec 0c             	sub    $0xc,%esp
+  800190:	ff 75 dc             	push   -0x24(%ebp)
+  800193:	e8 d9 18 00 00       	call   801a71 <fd2data>
+	cprintf("race didn't happen\n");
+  800198:	c7 04 24 3a 46 80 00 	movl   $0x80463a,(%esp)
+  80019f:	e8 b3 01 00 00       	call   800357 <cprintf>
+}
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5f                   	pop    %edi
+  8001ad:	5d                   	pop    %ebp
+  8001ae:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001af:	83 ec 04             	sub    $0x4,%esp
+  8001b2:	68 a4 45 80 00       	push   $0x8045a4
+  8001b7:	6a 40                	push   $0x40
+  8001b9:	68 d7 45 80 00       	push   $0x8045d7
+  8001be:	e8 b9 00 00 00       	call   80027c <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 22 46 80 00       	push   $0x804622
+  8001c9:	6a 42                	push   $0x42
+  8001cb:	68 d7 45 80 00       	push   $0x8045d7
+  8001d0:	e8 a7 00 00 00       	call   80027c <_panic>
+
+008001d5 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	56                   	push   %esi
+  8001d9:	53                   	push   %ebx
+  8001da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001e0:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8001e2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001e7:	29 d0                	sub    %edx,%eax
+  8001e9:	89 c2                	mov    %eax,%edx
+  8001eb:	c1 ea 0f             	shr    $0xf,%edx
+  8001ee:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f8:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8001fb:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800202:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800206:	e8 39 0c 00 00       	call   800e44 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80020b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800210:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800216:	89 e1                	mov    %esp,%ecx
+  800218:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80021d:	29 ca                	sub    %ecx,%edx
+  80021f:	89 d1                	mov    %edx,%ecx
+  800221:	c1 e9 0f             	shr    $0xf,%ecx
+  800224:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80022a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022f:	0f 42 d1             	cmovb  %ecx,%edx
+  800232:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800237:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80023e:	85 db                	test   %ebx,%ebx
+  800240:	7e 07                	jle    800249 <libmain+0x74>
+		binaryname = argv[0];
+  800242:	8b 06                	mov    (%esi),%eax
+  800244:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800249:	83 ec 08             	sub    $0x8,%esp
+  80024c:	56                   	push   %esi
+  80024d:	53                   	push   %ebx
+  80024e:	e8 e2 fd ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800253:	e8 0a 00 00 00       	call   800262 <exit>
+}
+  800258:	83 c4 10             	add    $0x10,%esp
+  80025b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80025e:	5b                   	pop    %ebx
+  80025f:	5e                   	pop    %esi
+  800260:	5d                   	pop    %ebp
+  800261:	c3                   	ret
+
+00800262 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800262:	55                   	push   %ebp
+  800263:	89 e5                	mov    %esp,%ebp
+  800265:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800268:	e8 dd 19 00 00       	call   801c4a <close_all>
+	sys_env_destroy(0);
+  80026d:	83 ec 0c             	sub    $0xc,%esp
+  800270:	6a 00                	push   $0x0
+  800272:	e8 8c 0b 00 00       	call   800e03 <sys_env_destroy>
+}
+  800277:	83 c4 10             	add    $0x10,%esp
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+0080027c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	56                   	push   %esi
+  800280:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800281:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800284:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80028a:	e8 b5 0b 00 00       	call   800e44 <sys_getenvid>
+  80028f:	83 ec 0c             	sub    $0xc,%esp
+  800292:	ff 75 0c             	push   0xc(%ebp)
+  800295:	ff 75 08             	push   0x8(%ebp)
+  800298:	56                   	push   %esi
+  800299:	50                   	push   %eax
+  80029a:	68 58 46 80 00       	push   $0x804658
+  80029f:	e8 b3 00 00 00       	call   800357 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002a4:	83 c4 18             	add    $0x18,%esp
+  8002a7:	53                   	push   %ebx
+  8002a8:	ff 75 10             	push   0x10(%ebp)
+  8002ab:	e8 56 00 00 00       	call   800306 <vcprintf>
+	cprintf("\n");
+  8002b0:	c7 04 24 c8 4b 80 00 	movl   $0x804bc8,(%esp)
+  8002b7:	e8 9b 00 00 00       	call   800357 <cprintf>
+  8002bc:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002bf:	cc                   	int3
+	while (1)
+  8002c0:	eb fd                	jmp    8002bf <_panic+0x43>
+
+008002c2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	53                   	push   %ebx
+  8002c6:	83 ec 04             	sub    $0x4,%esp
+  8002c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002cc:	8b 13                	mov    (%ebx),%edx
+  8002ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8002d1:	89 03                	mov    %eax,(%ebx)
+  8002d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002da:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002df:	74 09                	je     8002ea <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002e1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ea:	83 ec 08             	sub    $0x8,%esp
+  8002ed:	68 ff 00 00 00       	push   $0xff
+  8002f2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002f5:	50                   	push   %eax
+  8002f6:	e8 cb 0a 00 00       	call   800dc6 <sys_cputs>
+		b->idx = 0;
+  8002fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800301:	83 c4 10             	add    $0x10,%esp
+  800304:	eb db                	jmp    8002e1 <putch+0x1f>
+
+00800306 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800306:	55                   	push   %ebp
+  800307:	89 e5                	mov    %esp,%ebp
+  800309:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80030f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800316:	00 00 00 
+	b.cnt = 0;
+  800319:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800320:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800323:	ff 75 0c             	push   0xc(%ebp)
+  800326:	ff 75 08             	push   0x8(%ebp)
+  800329:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80032f:	50                   	push   %eax
+  800330:	68 c2 02 80 00       	push   $0x8002c2
+  800335:	e8 1c 01 00 00       	call   800456 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80033a:	83 c4 08             	add    $0x8,%esp
+  80033d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800343:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800349:	50                   	push   %eax
+  80034a:	e8 77 0a 00 00       	call   800dc6 <sys_cputs>
+
+	return b.cnt;
+}
+  80034f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800355:	c9                   	leave
+  800356:	c3                   	ret
+
+00800357 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800357:	55                   	push   %ebp
+  800358:	89 e5                	mov    %esp,%ebp
+  80035a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80035d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800360:	50                   	push   %eax
+  800361:	ff 75 08             	push   0x8(%ebp)
+  800364:	e8 9d ff ff ff       	call   800306 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800369:	c9                   	leave
+  80036a:	c3                   	ret
+
+0080036b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80036b:	55                   	push   %ebp
+  80036c:	89 e5                	mov    %esp,%ebp
+  80036e:	57                   	push   %edi
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+  800371:	83 ec 1c             	sub    $0x1c,%esp
+  800374:	89 c3                	mov    %eax,%ebx
+  800376:	89 d6                	mov    %edx,%esi
+  800378:	8b 45 08             	mov    0x8(%ebp),%eax
+  80037b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80037e:	89 d1                	mov    %edx,%ecx
+  800380:	89 c2                	mov    %eax,%edx
+  800382:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800385:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800388:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80038b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80038e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800395:	39 c2                	cmp    %eax,%edx
+  800397:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80039a:	73 4b                	jae    8003e7 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80039c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80039f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003a2:	85 ff                	test   %edi,%edi
+  8003a4:	7e 11                	jle    8003b7 <printnum+0x4c>
+			putch(padc, putdat);
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	56                   	push   %esi
+  8003aa:	ff 75 18             	push   0x18(%ebp)
+  8003ad:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003af:	83 c4 10             	add    $0x10,%esp
+  8003b2:	83 ef 01             	sub    $0x1,%edi
+  8003b5:	75 ef                	jne    8003a6 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003b7:	83 ec 08             	sub    $0x8,%esp
+  8003ba:	56                   	push   %esi
+  8003bb:	83 ec 04             	sub    $0x4,%esp
+  8003be:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c1:	ff 75 e0             	push   -0x20(%ebp)
+  8003c4:	ff 75 dc             	push   -0x24(%ebp)
+  8003c7:	ff 75 d8             	push   -0x28(%ebp)
+  8003ca:	e8 8d 40 00 00       	call   80445c <__umoddi3>
+  8003cf:	83 c4 14             	add    $0x14,%esp
+  8003d2:	0f be 80 7b 46 80 00 	movsbl 0x80467b(%eax),%eax
+  8003d9:	50                   	push   %eax
+  8003da:	ff d3                	call   *%ebx
+}
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e2:	5b                   	pop    %ebx
+  8003e3:	5e                   	pop    %esi
+  8003e4:	5f                   	pop    %edi
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003e7:	83 ec 0c             	sub    $0xc,%esp
+  8003ea:	ff 75 18             	push   0x18(%ebp)
+  8003ed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003f0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003f3:	52                   	push   %edx
+  8003f4:	50                   	push   %eax
+  8003f5:	83 ec 08             	sub    $0x8,%esp
+  8003f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8003fb:	ff 75 e0             	push   -0x20(%ebp)
+  8003fe:	ff 75 dc             	push   -0x24(%ebp)
+  800401:	ff 75 d8             	push   -0x28(%ebp)
+  800404:	e8 8d 3f 00 00       	call   804396 <__udivdi3>
+  800409:	83 c4 18             	add    $0x18,%esp
+  80040c:	52                   	push   %edx
+  80040d:	50                   	push   %eax
+  80040e:	89 f2                	mov    %esi,%edx
+  800410:	89 d8                	mov    %ebx,%eax
+  800412:	e8 54 ff ff ff       	call   80036b <printnum>
+  800417:	83 c4 20             	add    $0x20,%esp
+  80041a:	eb 9b                	jmp    8003b7 <printnum+0x4c>
+
+0080041c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800422:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800426:	8b 10                	mov    (%eax),%edx
+  800428:	3b 50 04             	cmp    0x4(%eax),%edx
+  80042b:	73 0a                	jae    800437 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80042d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800430:	89 08                	mov    %ecx,(%eax)
+  800432:	8b 45 08             	mov    0x8(%ebp),%eax
+  800435:	88 02                	mov    %al,(%edx)
+}
+  800437:	5d                   	pop    %ebp
+  800438:	c3                   	ret
+
+00800439 <printfmt>:
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80043f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800442:	50                   	push   %eax
+  800443:	ff 75 10             	push   0x10(%ebp)
+  800446:	ff 75 0c             	push   0xc(%ebp)
+  800449:	ff 75 08             	push   0x8(%ebp)
+  80044c:	e8 05 00 00 00       	call   800456 <vprintfmt>
+}
+  800451:	83 c4 10             	add    $0x10,%esp
+  800454:	c9                   	leave
+  800455:	c3                   	ret
+
+00800456 <vprintfmt>:
+{
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	57                   	push   %edi
+  80045a:	56                   	push   %esi
+  80045b:	53                   	push   %ebx
+  80045c:	83 ec 2c             	sub    $0x2c,%esp
+  80045f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800462:	89 df                	mov    %ebx,%edi
+  800464:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800467:	8b 45 10             	mov    0x10(%ebp),%eax
+  80046a:	8d 70 01             	lea    0x1(%eax),%esi
+  80046d:	0f b6 00             	movzbl (%eax),%eax
+  800470:	83 f8 25             	cmp    $0x25,%eax
+  800473:	74 1e                	je     800493 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800475:	85 c0                	test   %eax,%eax
+  800477:	0f 84 15 05 00 00    	je     800992 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	53                   	push   %ebx
+  800481:	50                   	push   %eax
+  800482:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800484:	83 c6 01             	add    $0x1,%esi
+  800487:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	83 f8 25             	cmp    $0x25,%eax
+  800491:	75 e2                	jne    800475 <vprintfmt+0x1f>
+		padc = ' ';
+  800493:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800497:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80049e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004a5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004b1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b4:	8d 56 01             	lea    0x1(%esi),%edx
+  8004b7:	0f b6 0e             	movzbl (%esi),%ecx
+  8004ba:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004bd:	3c 55                	cmp    $0x55,%al
+  8004bf:	0f 87 3b 04 00 00    	ja     800900 <vprintfmt+0x4aa>
+  8004c5:	0f b6 c0             	movzbl %al,%eax
+  8004c8:	ff 24 85 e0 47 80 00 	jmp    *0x8047e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004cf:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004d2:	eb 93                	jmp    800467 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d4:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8004d6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004da:	eb d8                	jmp    8004b4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004dc:	89 d6                	mov    %edx,%esi
+  8004de:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004e2:	eb d0                	jmp    8004b4 <vprintfmt+0x5e>
+  8004e4:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004e7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004ed:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8004f1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004f4:	83 f9 09             	cmp    $0x9,%ecx
+  8004f7:	77 6f                	ja     800568 <vprintfmt+0x112>
+  8004f9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004fc:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004ff:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800502:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800506:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800509:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80050c:	83 fe 09             	cmp    $0x9,%esi
+  80050f:	76 eb                	jbe    8004fc <vprintfmt+0xa6>
+  800511:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800514:	89 d6                	mov    %edx,%esi
+  800516:	eb 13                	jmp    80052b <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 00                	mov    (%eax),%eax
+  80051d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800520:	8b 45 14             	mov    0x14(%ebp),%eax
+  800523:	8d 40 04             	lea    0x4(%eax),%eax
+  800526:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800529:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80052b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80052f:	79 83                	jns    8004b4 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800531:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800534:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800537:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80053e:	e9 71 ff ff ff       	jmp    8004b4 <vprintfmt+0x5e>
+			if (width < 0)
+  800543:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800546:	85 c9                	test   %ecx,%ecx
+  800548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054d:	0f 49 c1             	cmovns %ecx,%eax
+  800550:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800553:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800555:	e9 5a ff ff ff       	jmp    8004b4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80055a:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80055c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800563:	e9 4c ff ff ff       	jmp    8004b4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800568:	89 d6                	mov    %edx,%esi
+  80056a:	eb bf                	jmp    80052b <vprintfmt+0xd5>
+			lflag++;
+  80056c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800570:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800572:	e9 3d ff ff ff       	jmp    8004b4 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800577:	89 55 10             	mov    %edx,0x10(%ebp)
+  80057a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057d:	8d 70 04             	lea    0x4(%eax),%esi
+  800580:	83 ec 08             	sub    $0x8,%esp
+  800583:	53                   	push   %ebx
+  800584:	ff 30                	push   (%eax)
+  800586:	ff d7                	call   *%edi
+			break;
+  800588:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80058b:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80058e:	e9 d4 fe ff ff       	jmp    800467 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800593:	89 55 10             	mov    %edx,0x10(%ebp)
+  800596:	8b 45 14             	mov    0x14(%ebp),%eax
+  800599:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80059c:	8b 10                	mov    (%eax),%edx
+  80059e:	89 d0                	mov    %edx,%eax
+  8005a0:	f7 d8                	neg    %eax
+  8005a2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005a5:	83 f8 12             	cmp    $0x12,%eax
+  8005a8:	7f 23                	jg     8005cd <vprintfmt+0x177>
+  8005aa:	8b 14 85 40 49 80 00 	mov    0x804940(,%eax,4),%edx
+  8005b1:	85 d2                	test   %edx,%edx
+  8005b3:	74 18                	je     8005cd <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005b5:	52                   	push   %edx
+  8005b6:	68 93 4b 80 00       	push   $0x804b93
+  8005bb:	53                   	push   %ebx
+  8005bc:	57                   	push   %edi
+  8005bd:	e8 77 fe ff ff       	call   800439 <printfmt>
+  8005c2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005c5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005c8:	e9 9a fe ff ff       	jmp    800467 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005cd:	50                   	push   %eax
+  8005ce:	68 93 46 80 00       	push   $0x804693
+  8005d3:	53                   	push   %ebx
+  8005d4:	57                   	push   %edi
+  8005d5:	e8 5f fe ff ff       	call   800439 <printfmt>
+  8005da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005dd:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005e0:	e9 82 fe ff ff       	jmp    800467 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005e5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005eb:	83 c0 04             	add    $0x4,%eax
+  8005ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 00                	mov    (%eax),%eax
+  8005f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005f9:	85 c0                	test   %eax,%eax
+  8005fb:	0f 84 61 03 00 00    	je     800962 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800601:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800605:	7e 06                	jle    80060d <vprintfmt+0x1b7>
+  800607:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80060b:	75 29                	jne    800636 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80060d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800610:	8d 70 01             	lea    0x1(%eax),%esi
+  800613:	0f b6 00             	movzbl (%eax),%eax
+  800616:	0f be d0             	movsbl %al,%edx
+  800619:	85 d2                	test   %edx,%edx
+  80061b:	0f 84 bb 00 00 00    	je     8006dc <vprintfmt+0x286>
+  800621:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800624:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800627:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80062a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80062d:	eb 7a                	jmp    8006a9 <vprintfmt+0x253>
+				p = "(null)";
+  80062f:	c7 45 d0 8c 46 80 00 	movl   $0x80468c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800636:	83 ec 08             	sub    $0x8,%esp
+  800639:	ff 75 d4             	push   -0x2c(%ebp)
+  80063c:	ff 75 d0             	push   -0x30(%ebp)
+  80063f:	e8 e0 03 00 00       	call   800a24 <strnlen>
+  800644:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800647:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	85 d2                	test   %edx,%edx
+  80064f:	0f 8e d6 02 00 00    	jle    80092b <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800655:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800659:	83 ec 08             	sub    $0x8,%esp
+  80065c:	53                   	push   %ebx
+  80065d:	56                   	push   %esi
+  80065e:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800667:	75 f0                	jne    800659 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800669:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80066c:	8d 70 01             	lea    0x1(%eax),%esi
+  80066f:	0f b6 00             	movzbl (%eax),%eax
+  800672:	0f be d0             	movsbl %al,%edx
+  800675:	85 d2                	test   %edx,%edx
+  800677:	0f 84 da 02 00 00    	je     800957 <vprintfmt+0x501>
+  80067d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800680:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800683:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800686:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800689:	eb 1e                	jmp    8006a9 <vprintfmt+0x253>
+					putch(ch, putdat);
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	ff 75 0c             	push   0xc(%ebp)
+  800691:	52                   	push   %edx
+  800692:	ff 55 08             	call   *0x8(%ebp)
+  800695:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800698:	83 eb 01             	sub    $0x1,%ebx
+  80069b:	83 c6 01             	add    $0x1,%esi
+  80069e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006a2:	0f be d0             	movsbl %al,%edx
+  8006a5:	85 d2                	test   %edx,%edx
+  8006a7:	74 2a                	je     8006d3 <vprintfmt+0x27d>
+  8006a9:	85 ff                	test   %edi,%edi
+  8006ab:	78 05                	js     8006b2 <vprintfmt+0x25c>
+  8006ad:	83 ef 01             	sub    $0x1,%edi
+  8006b0:	78 59                	js     80070b <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006b2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006b6:	74 d3                	je     80068b <vprintfmt+0x235>
+  8006b8:	0f be c0             	movsbl %al,%eax
+  8006bb:	83 e8 20             	sub    $0x20,%eax
+  8006be:	83 f8 5e             	cmp    $0x5e,%eax
+  8006c1:	76 c8                	jbe    80068b <vprintfmt+0x235>
+					putch('?', putdat);
+  8006c3:	83 ec 08             	sub    $0x8,%esp
+  8006c6:	ff 75 0c             	push   0xc(%ebp)
+  8006c9:	6a 3f                	push   $0x3f
+  8006cb:	ff 55 08             	call   *0x8(%ebp)
+  8006ce:	83 c4 10             	add    $0x10,%esp
+  8006d1:	eb c5                	jmp    800698 <vprintfmt+0x242>
+  8006d3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006d6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8006dc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006df:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006e3:	7e 1b                	jle    800700 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	53                   	push   %ebx
+  8006e9:	6a 20                	push   $0x20
+  8006eb:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	83 ee 01             	sub    $0x1,%esi
+  8006f3:	75 f0                	jne    8006e5 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fb:	e9 67 fd ff ff       	jmp    800467 <vprintfmt+0x11>
+  800700:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800703:	89 45 14             	mov    %eax,0x14(%ebp)
+  800706:	e9 5c fd ff ff       	jmp    800467 <vprintfmt+0x11>
+  80070b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80070e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800711:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800714:	eb c6                	jmp    8006dc <vprintfmt+0x286>
+	if (lflag >= 2)
+  800716:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800719:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071c:	83 f9 01             	cmp    $0x1,%ecx
+  80071f:	7f 1f                	jg     800740 <vprintfmt+0x2ea>
+	else if (lflag)
+  800721:	85 c9                	test   %ecx,%ecx
+  800723:	74 67                	je     80078c <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800725:	8b 45 14             	mov    0x14(%ebp),%eax
+  800728:	8b 30                	mov    (%eax),%esi
+  80072a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80072d:	89 f0                	mov    %esi,%eax
+  80072f:	c1 f8 1f             	sar    $0x1f,%eax
+  800732:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800735:	8b 45 14             	mov    0x14(%ebp),%eax
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80073e:	eb 17                	jmp    800757 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 50 04             	mov    0x4(%eax),%edx
+  800746:	8b 00                	mov    (%eax),%eax
+  800748:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80074b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8d 40 08             	lea    0x8(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800757:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80075a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80075d:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800762:	85 c9                	test   %ecx,%ecx
+  800764:	0f 89 12 01 00 00    	jns    80087c <vprintfmt+0x426>
+				putch('-', putdat);
+  80076a:	83 ec 08             	sub    $0x8,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	6a 2d                	push   $0x2d
+  800770:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800772:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800775:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800778:	f7 da                	neg    %edx
+  80077a:	83 d1 00             	adc    $0x0,%ecx
+  80077d:	f7 d9                	neg    %ecx
+  80077f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800782:	be 0a 00 00 00       	mov    $0xa,%esi
+  800787:	e9 f0 00 00 00       	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8b 30                	mov    (%eax),%esi
+  800791:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800794:	89 f0                	mov    %esi,%eax
+  800796:	c1 f8 1f             	sar    $0x1f,%eax
+  800799:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007a5:	eb b0                	jmp    800757 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007a7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007aa:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007ad:	83 f9 01             	cmp    $0x1,%ecx
+  8007b0:	7f 1e                	jg     8007d0 <vprintfmt+0x37a>
+	else if (lflag)
+  8007b2:	85 c9                	test   %ecx,%ecx
+  8007b4:	74 32                	je     8007e8 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007c6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007cb:	e9 ac 00 00 00       	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d3:	8b 10                	mov    (%eax),%edx
+  8007d5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007db:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007de:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007e3:	e9 94 00 00 00       	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8b 10                	mov    (%eax),%edx
+  8007ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007f8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007fd:	eb 7d                	jmp    80087c <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007ff:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800802:	89 55 10             	mov    %edx,0x10(%ebp)
+  800805:	83 f9 01             	cmp    $0x1,%ecx
+  800808:	7f 1b                	jg     800825 <vprintfmt+0x3cf>
+	else if (lflag)
+  80080a:	85 c9                	test   %ecx,%ecx
+  80080c:	74 2c                	je     80083a <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 10                	mov    (%eax),%edx
+  800813:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800818:	8d 40 04             	lea    0x4(%eax),%eax
+  80081b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80081e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800823:	eb 57                	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800825:	8b 45 14             	mov    0x14(%ebp),%eax
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082d:	8d 40 08             	lea    0x8(%eax),%eax
+  800830:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800833:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800838:	eb 42                	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	8b 10                	mov    (%eax),%edx
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	8d 40 04             	lea    0x4(%eax),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80084a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80084f:	eb 2b                	jmp    80087c <vprintfmt+0x426>
+			putch('0', putdat);
+  800851:	89 55 10             	mov    %edx,0x10(%ebp)
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	53                   	push   %ebx
+  800858:	6a 30                	push   $0x30
+  80085a:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80085c:	83 c4 08             	add    $0x8,%esp
+  80085f:	53                   	push   %ebx
+  800860:	6a 78                	push   $0x78
+  800862:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8b 10                	mov    (%eax),%edx
+  800869:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80086e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800871:	8d 40 04             	lea    0x4(%eax),%eax
+  800874:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800877:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80087c:	83 ec 0c             	sub    $0xc,%esp
+  80087f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800883:	50                   	push   %eax
+  800884:	ff 75 e4             	push   -0x1c(%ebp)
+  800887:	56                   	push   %esi
+  800888:	51                   	push   %ecx
+  800889:	52                   	push   %edx
+  80088a:	89 da                	mov    %ebx,%edx
+  80088c:	89 f8                	mov    %edi,%eax
+  80088e:	e8 d8 fa ff ff       	call   80036b <printnum>
+			break;
+  800893:	83 c4 20             	add    $0x20,%esp
+  800896:	e9 cc fb ff ff       	jmp    800467 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80089b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80089e:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008a1:	83 f9 01             	cmp    $0x1,%ecx
+  8008a4:	7f 1b                	jg     8008c1 <vprintfmt+0x46b>
+	else if (lflag)
+  8008a6:	85 c9                	test   %ecx,%ecx
+  8008a8:	74 2c                	je     8008d6 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 10                	mov    (%eax),%edx
+  8008af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ba:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008bf:	eb bb                	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c4:	8b 10                	mov    (%eax),%edx
+  8008c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008cf:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8008d4:	eb a6                	jmp    80087c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8b 10                	mov    (%eax),%edx
+  8008db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008eb:	eb 8f                	jmp    80087c <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008ed:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008f0:	83 ec 08             	sub    $0x8,%esp
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 25                	push   $0x25
+  8008f6:	ff d7                	call   *%edi
+			break;
+  8008f8:	83 c4 10             	add    $0x10,%esp
+  8008fb:	e9 67 fb ff ff       	jmp    800467 <vprintfmt+0x11>
+			putch('%', putdat);
+  800900:	83 ec 08             	sub    $0x8,%esp
+  800903:	53                   	push   %ebx
+  800904:	6a 25                	push   $0x25
+  800906:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80090f:	0f 84 ba fb ff ff    	je     8004cf <vprintfmt+0x79>
+  800915:	89 75 10             	mov    %esi,0x10(%ebp)
+  800918:	89 f0                	mov    %esi,%eax
+  80091a:	83 e8 01             	sub    $0x1,%eax
+  80091d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800921:	75 f7                	jne    80091a <vprintfmt+0x4c4>
+  800923:	89 45 10             	mov    %eax,0x10(%ebp)
+  800926:	e9 3c fb ff ff       	jmp    800467 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80092b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80092e:	8d 70 01             	lea    0x1(%eax),%esi
+  800931:	0f b6 00             	movzbl (%eax),%eax
+  800934:	0f be d0             	movsbl %al,%edx
+  800937:	85 d2                	test   %edx,%edx
+  800939:	74 11                	je     80094c <vprintfmt+0x4f6>
+  80093b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80093e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800941:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800944:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800947:	e9 5d fd ff ff       	jmp    8006a9 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80094c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800952:	e9 10 fb ff ff       	jmp    800467 <vprintfmt+0x11>
+  800957:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80095a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80095d:	e9 05 fb ff ff       	jmp    800467 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800962:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800966:	7e 0a                	jle    800972 <vprintfmt+0x51c>
+  800968:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80096c:	0f 85 bd fc ff ff    	jne    80062f <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800972:	ba 28 00 00 00       	mov    $0x28,%edx
+  800977:	b8 28 00 00 00       	mov    $0x28,%eax
+  80097c:	be 8d 46 80 00       	mov    $0x80468d,%esi
+  800981:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800984:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800987:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80098a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80098d:	e9 17 fd ff ff       	jmp    8006a9 <vprintfmt+0x253>
+}
+  800992:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800995:	5b                   	pop    %ebx
+  800996:	5e                   	pop    %esi
+  800997:	5f                   	pop    %edi
+  800998:	5d                   	pop    %ebp
+  800999:	c3                   	ret
+
+0080099a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80099a:	55                   	push   %ebp
+  80099b:	89 e5                	mov    %esp,%ebp
+  80099d:	83 ec 18             	sub    $0x18,%esp
+  8009a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009a9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009ad:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009b7:	85 c0                	test   %eax,%eax
+  8009b9:	74 26                	je     8009e1 <vsnprintf+0x47>
+  8009bb:	85 d2                	test   %edx,%edx
+  8009bd:	7e 22                	jle    8009e1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009bf:	ff 75 14             	push   0x14(%ebp)
+  8009c2:	ff 75 10             	push   0x10(%ebp)
+  8009c5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009c8:	50                   	push   %eax
+  8009c9:	68 1c 04 80 00       	push   $0x80041c
+  8009ce:	e8 83 fa ff ff       	call   800456 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009d6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009dc:	83 c4 10             	add    $0x10,%esp
+}
+  8009df:	c9                   	leave
+  8009e0:	c3                   	ret
+		return -E_INVAL;
+  8009e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009e6:	eb f7                	jmp    8009df <vsnprintf+0x45>
+
+008009e8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009ee:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009f1:	50                   	push   %eax
+  8009f2:	ff 75 10             	push   0x10(%ebp)
+  8009f5:	ff 75 0c             	push   0xc(%ebp)
+  8009f8:	ff 75 08             	push   0x8(%ebp)
+  8009fb:	e8 9a ff ff ff       	call   80099a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a00:	c9                   	leave
+  800a01:	c3                   	ret
+
+00800a02 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a08:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a0b:	74 10                	je     800a1d <strlen+0x1b>
+  800a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a12:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a15:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a19:	75 f7                	jne    800a12 <strlen+0x10>
+	return n;
+}
+  800a1b:	5d                   	pop    %ebp
+  800a1c:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a22:	eb f7                	jmp    800a1b <strlen+0x19>
+
+00800a24 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a2d:	85 d2                	test   %edx,%edx
+  800a2f:	74 16                	je     800a47 <strnlen+0x23>
+  800a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a36:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a3a:	74 09                	je     800a45 <strnlen+0x21>
+		n++;
+  800a3c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a3f:	39 d0                	cmp    %edx,%eax
+  800a41:	75 f3                	jne    800a36 <strnlen+0x12>
+		n++;
+  800a43:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4c:	eb f7                	jmp    800a45 <strnlen+0x21>
+
+00800a4e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a4e:	55                   	push   %ebp
+  800a4f:	89 e5                	mov    %esp,%ebp
+  800a51:	53                   	push   %ebx
+  800a52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a61:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a64:	83 c0 01             	add    $0x1,%eax
+  800a67:	84 d2                	test   %dl,%dl
+  800a69:	75 f2                	jne    800a5d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a6b:	89 c8                	mov    %ecx,%eax
+  800a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a70:	c9                   	leave
+  800a71:	c3                   	ret
+
+00800a72 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	53                   	push   %ebx
+  800a76:	83 ec 10             	sub    $0x10,%esp
+  800a79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a7c:	53                   	push   %ebx
+  800a7d:	e8 80 ff ff ff       	call   800a02 <strlen>
+  800a82:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a85:	ff 75 0c             	push   0xc(%ebp)
+  800a88:	01 d8                	add    %ebx,%eax
+  800a8a:	50                   	push   %eax
+  800a8b:	e8 be ff ff ff       	call   800a4e <strcpy>
+	return dst;
+}
+  800a90:	89 d8                	mov    %ebx,%eax
+  800a92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a95:	c9                   	leave
+  800a96:	c3                   	ret
+
+00800a97 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	56                   	push   %esi
+  800a9b:	53                   	push   %ebx
+  800a9c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800aa5:	85 db                	test   %ebx,%ebx
+  800aa7:	74 17                	je     800ac0 <strncpy+0x29>
+  800aa9:	01 f3                	add    %esi,%ebx
+  800aab:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800aad:	83 c0 01             	add    $0x1,%eax
+  800ab0:	0f b6 0a             	movzbl (%edx),%ecx
+  800ab3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ab6:	80 f9 01             	cmp    $0x1,%cl
+  800ab9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800abc:	39 c3                	cmp    %eax,%ebx
+  800abe:	75 ed                	jne    800aad <strncpy+0x16>
+	}
+	return ret;
+}
+  800ac0:	89 f0                	mov    %esi,%eax
+  800ac2:	5b                   	pop    %ebx
+  800ac3:	5e                   	pop    %esi
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	56                   	push   %esi
+  800aca:	53                   	push   %ebx
+  800acb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ace:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ad1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ad4:	89 f0                	mov    %esi,%eax
+  800ad6:	85 db                	test   %ebx,%ebx
+  800ad8:	74 1e                	je     800af8 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800ada:	83 eb 01             	sub    $0x1,%ebx
+  800add:	74 16                	je     800af5 <strlcpy+0x2f>
+  800adf:	01 f3                	add    %esi,%ebx
+  800ae1:	0f b6 0a             	movzbl (%edx),%ecx
+  800ae4:	84 c9                	test   %cl,%cl
+  800ae6:	74 0d                	je     800af5 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800ae8:	83 c2 01             	add    $0x1,%edx
+  800aeb:	83 c0 01             	add    $0x1,%eax
+  800aee:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800af1:	39 d8                	cmp    %ebx,%eax
+  800af3:	75 ec                	jne    800ae1 <strlcpy+0x1b>
+		*dst = '\0';
+  800af5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800af8:	29 f0                	sub    %esi,%eax
+}
+  800afa:	5b                   	pop    %ebx
+  800afb:	5e                   	pop    %esi
+  800afc:	5d                   	pop    %ebp
+  800afd:	c3                   	ret
+
+00800afe <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b04:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b07:	0f b6 01             	movzbl (%ecx),%eax
+  800b0a:	84 c0                	test   %al,%al
+  800b0c:	74 11                	je     800b1f <strcmp+0x21>
+  800b0e:	38 02                	cmp    %al,(%edx)
+  800b10:	75 0d                	jne    800b1f <strcmp+0x21>
+		p++, q++;
+  800b12:	83 c1 01             	add    $0x1,%ecx
+  800b15:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b18:	0f b6 01             	movzbl (%ecx),%eax
+  800b1b:	84 c0                	test   %al,%al
+  800b1d:	75 ef                	jne    800b0e <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b1f:	0f b6 c0             	movzbl %al,%eax
+  800b22:	0f b6 12             	movzbl (%edx),%edx
+  800b25:	29 d0                	sub    %edx,%eax
+}
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+
+00800b29 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	53                   	push   %ebx
+  800b2d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b30:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b33:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b3b:	85 d2                	test   %edx,%edx
+  800b3d:	74 2e                	je     800b6d <strncmp+0x44>
+  800b3f:	0f b6 01             	movzbl (%ecx),%eax
+  800b42:	84 c0                	test   %al,%al
+  800b44:	74 16                	je     800b5c <strncmp+0x33>
+  800b46:	3a 03                	cmp    (%ebx),%al
+  800b48:	75 12                	jne    800b5c <strncmp+0x33>
+		n--, p++, q++;
+  800b4a:	83 c1 01             	add    $0x1,%ecx
+  800b4d:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b50:	83 ea 01             	sub    $0x1,%edx
+  800b53:	75 ea                	jne    800b3f <strncmp+0x16>
+		return 0;
+  800b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5a:	eb 11                	jmp    800b6d <strncmp+0x44>
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b61:	85 d2                	test   %edx,%edx
+  800b63:	74 08                	je     800b6d <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b65:	0f b6 01             	movzbl (%ecx),%eax
+  800b68:	0f b6 13             	movzbl (%ebx),%edx
+  800b6b:	29 d0                	sub    %edx,%eax
+}
+  800b6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b70:	c9                   	leave
+  800b71:	c3                   	ret
+
+00800b72 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b78:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b7c:	0f b6 10             	movzbl (%eax),%edx
+  800b7f:	84 d2                	test   %dl,%dl
+  800b81:	74 15                	je     800b98 <strchr+0x26>
+		if (*s == c)
+  800b83:	38 d1                	cmp    %dl,%cl
+  800b85:	74 0f                	je     800b96 <strchr+0x24>
+	for (; *s; s++)
+  800b87:	83 c0 01             	add    $0x1,%eax
+  800b8a:	0f b6 10             	movzbl (%eax),%edx
+  800b8d:	84 d2                	test   %dl,%dl
+  800b8f:	75 f2                	jne    800b83 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+	return 0;
+  800b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9d:	eb f7                	jmp    800b96 <strchr+0x24>
+
+00800b9f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	53                   	push   %ebx
+  800ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ba9:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bac:	38 d3                	cmp    %dl,%bl
+  800bae:	74 14                	je     800bc4 <strfind+0x25>
+  800bb0:	89 d1                	mov    %edx,%ecx
+  800bb2:	84 db                	test   %bl,%bl
+  800bb4:	74 0e                	je     800bc4 <strfind+0x25>
+	for (; *s; s++)
+  800bb6:	83 c0 01             	add    $0x1,%eax
+  800bb9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bbc:	38 ca                	cmp    %cl,%dl
+  800bbe:	74 04                	je     800bc4 <strfind+0x25>
+  800bc0:	84 d2                	test   %dl,%dl
+  800bc2:	75 f2                	jne    800bb6 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800bc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc7:	c9                   	leave
+  800bc8:	c3                   	ret
+
+00800bc9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bc9:	55                   	push   %ebp
+  800bca:	89 e5                	mov    %esp,%ebp
+  800bcc:	57                   	push   %edi
+  800bcd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bd0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bd3:	85 c9                	test   %ecx,%ecx
+  800bd5:	74 20                	je     800bf7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bd7:	89 f8                	mov    %edi,%eax
+  800bd9:	09 c8                	or     %ecx,%eax
+  800bdb:	a8 03                	test   $0x3,%al
+  800bdd:	75 12                	jne    800bf1 <memset+0x28>
+		c &= 0xFF;
+  800bdf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800be3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800be9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bec:	fc                   	cld
+  800bed:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bef:	eb 06                	jmp    800bf7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf4:	fc                   	cld
+  800bf5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bf7:	89 f8                	mov    %edi,%eax
+  800bf9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bfc:	c9                   	leave
+  800bfd:	c3                   	ret
+
+00800bfe <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c06:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c0c:	39 c6                	cmp    %eax,%esi
+  800c0e:	73 32                	jae    800c42 <memmove+0x44>
+  800c10:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c13:	39 d0                	cmp    %edx,%eax
+  800c15:	73 2b                	jae    800c42 <memmove+0x44>
+		s += n;
+		d += n;
+  800c17:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c1a:	89 d6                	mov    %edx,%esi
+  800c1c:	09 fe                	or     %edi,%esi
+  800c1e:	09 ce                	or     %ecx,%esi
+  800c20:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c26:	75 0e                	jne    800c36 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c28:	83 ef 04             	sub    $0x4,%edi
+  800c2b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c2e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c31:	fd                   	std
+  800c32:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c34:	eb 09                	jmp    800c3f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c36:	83 ef 01             	sub    $0x1,%edi
+  800c39:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c3c:	fd                   	std
+  800c3d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c3f:	fc                   	cld
+  800c40:	eb 1a                	jmp    800c5c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c42:	89 f2                	mov    %esi,%edx
+  800c44:	09 c2                	or     %eax,%edx
+  800c46:	09 ca                	or     %ecx,%edx
+  800c48:	f6 c2 03             	test   $0x3,%dl
+  800c4b:	75 0a                	jne    800c57 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c4d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c50:	89 c7                	mov    %eax,%edi
+  800c52:	fc                   	cld
+  800c53:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c55:	eb 05                	jmp    800c5c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c57:	89 c7                	mov    %eax,%edi
+  800c59:	fc                   	cld
+  800c5a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c5c:	5e                   	pop    %esi
+  800c5d:	5f                   	pop    %edi
+  800c5e:	5d                   	pop    %ebp
+  800c5f:	c3                   	ret
+
+00800c60 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c60:	55                   	push   %ebp
+  800c61:	89 e5                	mov    %esp,%ebp
+  800c63:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c66:	ff 75 10             	push   0x10(%ebp)
+  800c69:	ff 75 0c             	push   0xc(%ebp)
+  800c6c:	ff 75 08             	push   0x8(%ebp)
+  800c6f:	e8 8a ff ff ff       	call   800bfe <memmove>
+}
+  800c74:	c9                   	leave
+  800c75:	c3                   	ret
+
+00800c76 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	56                   	push   %esi
+  800c7a:	53                   	push   %ebx
+  800c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c81:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c84:	85 f6                	test   %esi,%esi
+  800c86:	74 29                	je     800cb1 <memcmp+0x3b>
+  800c88:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c8a:	0f b6 08             	movzbl (%eax),%ecx
+  800c8d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c90:	38 d9                	cmp    %bl,%cl
+  800c92:	75 11                	jne    800ca5 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c94:	83 c0 01             	add    $0x1,%eax
+  800c97:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c9a:	39 c6                	cmp    %eax,%esi
+  800c9c:	75 ec                	jne    800c8a <memcmp+0x14>
+	}
+
+	return 0;
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca3:	eb 08                	jmp    800cad <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ca5:	0f b6 c1             	movzbl %cl,%eax
+  800ca8:	0f b6 db             	movzbl %bl,%ebx
+  800cab:	29 d8                	sub    %ebx,%eax
+}
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5d                   	pop    %ebp
+  800cb0:	c3                   	ret
+	return 0;
+  800cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb6:	eb f5                	jmp    800cad <memcmp+0x37>
+
+00800cb8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cc1:	89 c2                	mov    %eax,%edx
+  800cc3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cc6:	39 d0                	cmp    %edx,%eax
+  800cc8:	73 0d                	jae    800cd7 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cca:	38 08                	cmp    %cl,(%eax)
+  800ccc:	74 0d                	je     800cdb <memfind+0x23>
+	for (; s < ends; s++)
+  800cce:	83 c0 01             	add    $0x1,%eax
+  800cd1:	39 c2                	cmp    %eax,%edx
+  800cd3:	75 f5                	jne    800cca <memfind+0x12>
+  800cd5:	eb 06                	jmp    800cdd <memfind+0x25>
+  800cd7:	89 c2                	mov    %eax,%edx
+  800cd9:	eb 02                	jmp    800cdd <memfind+0x25>
+  800cdb:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800cdd:	89 d0                	mov    %edx,%eax
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+
+00800ce1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ced:	0f b6 02             	movzbl (%edx),%eax
+  800cf0:	3c 20                	cmp    $0x20,%al
+  800cf2:	74 04                	je     800cf8 <strtol+0x17>
+  800cf4:	3c 09                	cmp    $0x9,%al
+  800cf6:	75 0e                	jne    800d06 <strtol+0x25>
+		s++;
+  800cf8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cfb:	0f b6 02             	movzbl (%edx),%eax
+  800cfe:	3c 20                	cmp    $0x20,%al
+  800d00:	74 f6                	je     800cf8 <strtol+0x17>
+  800d02:	3c 09                	cmp    $0x9,%al
+  800d04:	74 f2                	je     800cf8 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d06:	3c 2b                	cmp    $0x2b,%al
+  800d08:	74 2a                	je     800d34 <strtol+0x53>
+	int neg = 0;
+  800d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d0f:	3c 2d                	cmp    $0x2d,%al
+  800d11:	74 2b                	je     800d3e <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d13:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d19:	75 0f                	jne    800d2a <strtol+0x49>
+  800d1b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d1e:	74 28                	je     800d48 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d20:	85 db                	test   %ebx,%ebx
+  800d22:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d27:	0f 44 d8             	cmove  %eax,%ebx
+  800d2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d2f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d32:	eb 46                	jmp    800d7a <strtol+0x99>
+		s++;
+  800d34:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d37:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d3c:	eb d5                	jmp    800d13 <strtol+0x32>
+		s++, neg = 1;
+  800d3e:	83 c2 01             	add    $0x1,%edx
+  800d41:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d46:	eb cb                	jmp    800d13 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d48:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d4c:	74 0e                	je     800d5c <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d4e:	85 db                	test   %ebx,%ebx
+  800d50:	75 d8                	jne    800d2a <strtol+0x49>
+		s++, base = 8;
+  800d52:	83 c2 01             	add    $0x1,%edx
+  800d55:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d5a:	eb ce                	jmp    800d2a <strtol+0x49>
+		s += 2, base = 16;
+  800d5c:	83 c2 02             	add    $0x2,%edx
+  800d5f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d64:	eb c4                	jmp    800d2a <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d66:	0f be c0             	movsbl %al,%eax
+  800d69:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d6c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d6f:	7d 3a                	jge    800dab <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d71:	83 c2 01             	add    $0x1,%edx
+  800d74:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d78:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d7a:	0f b6 02             	movzbl (%edx),%eax
+  800d7d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d80:	89 f3                	mov    %esi,%ebx
+  800d82:	80 fb 09             	cmp    $0x9,%bl
+  800d85:	76 df                	jbe    800d66 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d87:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d8a:	89 f3                	mov    %esi,%ebx
+  800d8c:	80 fb 19             	cmp    $0x19,%bl
+  800d8f:	77 08                	ja     800d99 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d91:	0f be c0             	movsbl %al,%eax
+  800d94:	83 e8 57             	sub    $0x57,%eax
+  800d97:	eb d3                	jmp    800d6c <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d99:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d9c:	89 f3                	mov    %esi,%ebx
+  800d9e:	80 fb 19             	cmp    $0x19,%bl
+  800da1:	77 08                	ja     800dab <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800da3:	0f be c0             	movsbl %al,%eax
+  800da6:	83 e8 37             	sub    $0x37,%eax
+  800da9:	eb c1                	jmp    800d6c <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800daf:	74 05                	je     800db6 <strtol+0xd5>
+		*endptr = (char *) s;
+  800db1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800db4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800db6:	89 c8                	mov    %ecx,%eax
+  800db8:	f7 d8                	neg    %eax
+  800dba:	85 ff                	test   %edi,%edi
+  800dbc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dbf:	89 c8                	mov    %ecx,%eax
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+
+00800dc6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd7:	89 c3                	mov    %eax,%ebx
+  800dd9:	89 c7                	mov    %eax,%edi
+  800ddb:	89 c6                	mov    %eax,%esi
+  800ddd:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ddf:	5b                   	pop    %ebx
+  800de0:	5e                   	pop    %esi
+  800de1:	5f                   	pop    %edi
+  800de2:	5d                   	pop    %ebp
+  800de3:	c3                   	ret
+
+00800de4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800de4:	55                   	push   %ebp
+  800de5:	89 e5                	mov    %esp,%ebp
+  800de7:	57                   	push   %edi
+  800de8:	56                   	push   %esi
+  800de9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800def:	b8 01 00 00 00       	mov    $0x1,%eax
+  800df4:	89 d1                	mov    %edx,%ecx
+  800df6:	89 d3                	mov    %edx,%ebx
+  800df8:	89 d7                	mov    %edx,%edi
+  800dfa:	89 d6                	mov    %edx,%esi
+  800dfc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dfe:	5b                   	pop    %ebx
+  800dff:	5e                   	pop    %esi
+  800e00:	5f                   	pop    %edi
+  800e01:	5d                   	pop    %ebp
+  800e02:	c3                   	ret
+
+00800e03 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e03:	55                   	push   %ebp
+  800e04:	89 e5                	mov    %esp,%ebp
+  800e06:	57                   	push   %edi
+  800e07:	56                   	push   %esi
+  800e08:	53                   	push   %ebx
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e19:	89 cb                	mov    %ecx,%ebx
+  800e1b:	89 cf                	mov    %ecx,%edi
+  800e1d:	89 ce                	mov    %ecx,%esi
+  800e1f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e21:	85 c0                	test   %eax,%eax
+  800e23:	7f 08                	jg     800e2d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e28:	5b                   	pop    %ebx
+  800e29:	5e                   	pop    %esi
+  800e2a:	5f                   	pop    %edi
+  800e2b:	5d                   	pop    %ebp
+  800e2c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  800e30:	50                   	push   %eax
+  800e31:	6a 03                	push   $0x3
+  800e33:	68 ab 49 80 00       	push   $0x8049ab
+  800e38:	6a 23                	push   $0x23
+  800e3a:	68 c8 49 80 00       	push   $0x8049c8
+  800e3f:	e8 38 f4 ff ff       	call   80027c <_panic>
+
+00800e44 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e44:	55                   	push   %ebp
+  800e45:	89 e5                	mov    %esp,%ebp
+  800e47:	57                   	push   %edi
+  800e48:	56                   	push   %esi
+  800e49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e54:	89 d1                	mov    %edx,%ecx
+  800e56:	89 d3                	mov    %edx,%ebx
+  800e58:	89 d7                	mov    %edx,%edi
+  800e5a:	89 d6                	mov    %edx,%esi
+  800e5c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+
+00800e63 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e73:	89 d1                	mov    %edx,%ecx
+  800e75:	89 d3                	mov    %edx,%ebx
+  800e77:	89 d7                	mov    %edx,%edi
+  800e79:	89 d6                	mov    %edx,%esi
+  800e7b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e7d:	5b                   	pop    %ebx
+  800e7e:	5e                   	pop    %esi
+  800e7f:	5f                   	pop    %edi
+  800e80:	5d                   	pop    %ebp
+  800e81:	c3                   	ret
+
+00800e82 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e82:	55                   	push   %ebp
+  800e83:	89 e5                	mov    %esp,%ebp
+  800e85:	57                   	push   %edi
+  800e86:	56                   	push   %esi
+  800e87:	53                   	push   %ebx
+  800e88:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e8b:	be 00 00 00 00       	mov    $0x0,%esi
+  800e90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e96:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9e:	89 f7                	mov    %esi,%edi
+  800ea0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 04                	push   $0x4
+  800eb4:	68 ab 49 80 00       	push   $0x8049ab
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 c8 49 80 00       	push   $0x8049c8
+  800ec0:	e8 b7 f3 ff ff       	call   80027c <_panic>
+
+00800ec5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ece:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ed9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800edf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ee2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 05                	push   $0x5
+  800ef6:	68 ab 49 80 00       	push   $0x8049ab
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 c8 49 80 00       	push   $0x8049c8
+  800f02:	e8 75 f3 ff ff       	call   80027c <_panic>
+
+00800f07 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	89 de                	mov    %ebx,%esi
+  800f24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 08                	jg     800f32 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 06                	push   $0x6
+  800f38:	68 ab 49 80 00       	push   $0x8049ab
+  800f3d:	6a 23                	push   $0x23
+  800f3f:	68 c8 49 80 00       	push   $0x8049c8
+  800f44:	e8 33 f3 ff ff       	call   80027c <_panic>
+
+00800f49 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f62:	89 df                	mov    %ebx,%edi
+  800f64:	89 de                	mov    %ebx,%esi
+  800f66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f68:	85 c0                	test   %eax,%eax
+  800f6a:	7f 08                	jg     800f74 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f74:	83 ec 0c             	sub    $0xc,%esp
+  800f77:	50                   	push   %eax
+  800f78:	6a 08                	push   $0x8
+  800f7a:	68 ab 49 80 00       	push   $0x8049ab
+  800f7f:	6a 23                	push   $0x23
+  800f81:	68 c8 49 80 00       	push   $0x8049c8
+  800f86:	e8 f1 f2 ff ff       	call   80027c <_panic>
+
+00800f8b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fa4:	89 df                	mov    %ebx,%edi
+  800fa6:	89 de                	mov    %ebx,%esi
+  800fa8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800faa:	85 c0                	test   %eax,%eax
+  800fac:	7f 08                	jg     800fb6 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb1:	5b                   	pop    %ebx
+  800fb2:	5e                   	pop    %esi
+  800fb3:	5f                   	pop    %edi
+  800fb4:	5d                   	pop    %ebp
+  800fb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  800fb9:	50                   	push   %eax
+  800fba:	6a 09                	push   $0x9
+  800fbc:	68 ab 49 80 00       	push   $0x8049ab
+  800fc1:	6a 23                	push   $0x23
+  800fc3:	68 c8 49 80 00       	push   $0x8049c8
+  800fc8:	e8 af f2 ff ff       	call   80027c <_panic>
+
+00800fcd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fcd:	55                   	push   %ebp
+  800fce:	89 e5                	mov    %esp,%ebp
+  800fd0:	57                   	push   %edi
+  800fd1:	56                   	push   %esi
+  800fd2:	53                   	push   %ebx
+  800fd3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe6:	89 df                	mov    %ebx,%edi
+  800fe8:	89 de                	mov    %ebx,%esi
+  800fea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fec:	85 c0                	test   %eax,%eax
+  800fee:	7f 08                	jg     800ff8 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff3:	5b                   	pop    %ebx
+  800ff4:	5e                   	pop    %esi
+  800ff5:	5f                   	pop    %edi
+  800ff6:	5d                   	pop    %ebp
+  800ff7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff8:	83 ec 0c             	sub    $0xc,%esp
+  800ffb:	50                   	push   %eax
+  800ffc:	6a 0a                	push   $0xa
+  800ffe:	68 ab 49 80 00       	push   $0x8049ab
+  801003:	6a 23                	push   $0x23
+  801005:	68 c8 49 80 00       	push   $0x8049c8
+  80100a:	e8 6d f2 ff ff       	call   80027c <_panic>
+
+0080100f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801015:	8b 55 08             	mov    0x8(%ebp),%edx
+  801018:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801020:	be 00 00 00 00       	mov    $0x0,%esi
+  801025:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801028:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80102b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	57                   	push   %edi
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+  801038:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80103b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801040:	8b 55 08             	mov    0x8(%ebp),%edx
+  801043:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801048:	89 cb                	mov    %ecx,%ebx
+  80104a:	89 cf                	mov    %ecx,%edi
+  80104c:	89 ce                	mov    %ecx,%esi
+  80104e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 08                	jg     80105c <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 0d                	push   $0xd
+  801062:	68 ab 49 80 00       	push   $0x8049ab
+  801067:	6a 23                	push   $0x23
+  801069:	68 c8 49 80 00       	push   $0x8049c8
+  80106e:	e8 09 f2 ff ff       	call   80027c <_panic>
+
+00801073 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801079:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801084:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801087:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80108d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80108f:	5b                   	pop    %ebx
+  801090:	5e                   	pop    %esi
+  801091:	5f                   	pop    %edi
+  801092:	5d                   	pop    %ebp
+  801093:	c3                   	ret
+
+00801094 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	89 de                	mov    %ebx,%esi
+  8010b1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010b3:	85 c0                	test   %eax,%eax
+  8010b5:	7f 08                	jg     8010bf <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ba:	5b                   	pop    %ebx
+  8010bb:	5e                   	pop    %esi
+  8010bc:	5f                   	pop    %edi
+  8010bd:	5d                   	pop    %ebp
+  8010be:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010bf:	83 ec 0c             	sub    $0xc,%esp
+  8010c2:	50                   	push   %eax
+  8010c3:	6a 0d                	push   $0xd
+  8010c5:	68 ab 49 80 00       	push   $0x8049ab
+  8010ca:	6a 23                	push   $0x23
+  8010cc:	68 c8 49 80 00       	push   $0x8049c8
+  8010d1:	e8 a6 f1 ff ff       	call   80027c <_panic>
+
+008010d6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010d6:	55                   	push   %ebp
+  8010d7:	89 e5                	mov    %esp,%ebp
+  8010d9:	57                   	push   %edi
+  8010da:	56                   	push   %esi
+  8010db:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010e6:	89 d1                	mov    %edx,%ecx
+  8010e8:	89 d3                	mov    %edx,%ebx
+  8010ea:	89 d7                	mov    %edx,%edi
+  8010ec:	89 d6                	mov    %edx,%esi
+  8010ee:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+
+008010f5 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801106:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80110b:	89 df                	mov    %ebx,%edi
+  80110d:	89 de                	mov    %ebx,%esi
+  80110f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801111:	5b                   	pop    %ebx
+  801112:	5e                   	pop    %esi
+  801113:	5f                   	pop    %edi
+  801114:	5d                   	pop    %ebp
+  801115:	c3                   	ret
+
+00801116 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+  801119:	57                   	push   %edi
+  80111a:	56                   	push   %esi
+  80111b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801121:	8b 55 08             	mov    0x8(%ebp),%edx
+  801124:	b8 10 00 00 00       	mov    $0x10,%eax
+  801129:	89 cb                	mov    %ecx,%ebx
+  80112b:	89 cf                	mov    %ecx,%edi
+  80112d:	89 ce                	mov    %ecx,%esi
+  80112f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801131:	5b                   	pop    %ebx
+  801132:	5e                   	pop    %esi
+  801133:	5f                   	pop    %edi
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+
+00801136 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	57                   	push   %edi
+  80113a:	56                   	push   %esi
+  80113b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80113c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801147:	b8 11 00 00 00       	mov    $0x11,%eax
+  80114c:	89 df                	mov    %ebx,%edi
+  80114e:	89 de                	mov    %ebx,%esi
+  801150:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801152:	5b                   	pop    %ebx
+  801153:	5e                   	pop    %esi
+  801154:	5f                   	pop    %edi
+  801155:	5d                   	pop    %ebp
+  801156:	c3                   	ret
+
+00801157 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801157:	55                   	push   %ebp
+  801158:	89 e5                	mov    %esp,%ebp
+  80115a:	57                   	push   %edi
+  80115b:	56                   	push   %esi
+  80115c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801162:	8b 55 08             	mov    0x8(%ebp),%edx
+  801165:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801168:	b8 12 00 00 00       	mov    $0x12,%eax
+  80116d:	89 df                	mov    %ebx,%edi
+  80116f:	89 de                	mov    %ebx,%esi
+  801171:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+
+00801178 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  80117b:	57                   	push   %edi
+  80117c:	56                   	push   %esi
+  80117d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80117e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801183:	8b 55 08             	mov    0x8(%ebp),%edx
+  801186:	b8 13 00 00 00       	mov    $0x13,%eax
+  80118b:	89 cb                	mov    %ecx,%ebx
+  80118d:	89 cf                	mov    %ecx,%edi
+  80118f:	89 ce                	mov    %ecx,%esi
+  801191:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801193:	5b                   	pop    %ebx
+  801194:	5e                   	pop    %esi
+  801195:	5f                   	pop    %edi
+  801196:	5d                   	pop    %ebp
+  801197:	c3                   	ret
+
+00801198 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801198:	55                   	push   %ebp
+  801199:	89 e5                	mov    %esp,%ebp
+  80119b:	57                   	push   %edi
+  80119c:	56                   	push   %esi
+  80119d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80119e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011ae:	89 df                	mov    %ebx,%edi
+  8011b0:	89 de                	mov    %ebx,%esi
+  8011b2:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011b4:	5b                   	pop    %ebx
+  8011b5:	5e                   	pop    %esi
+  8011b6:	5f                   	pop    %edi
+  8011b7:	5d                   	pop    %ebp
+  8011b8:	c3                   	ret
+
+008011b9 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011cc:	89 cb                	mov    %ecx,%ebx
+  8011ce:	89 cf                	mov    %ecx,%edi
+  8011d0:	89 ce                	mov    %ecx,%esi
+  8011d2:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8011d4:	5b                   	pop    %ebx
+  8011d5:	5e                   	pop    %esi
+  8011d6:	5f                   	pop    %edi
+  8011d7:	5d                   	pop    %ebp
+  8011d8:	c3                   	ret
+
+008011d9 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8011d9:	55                   	push   %ebp
+  8011da:	89 e5                	mov    %esp,%ebp
+  8011dc:	57                   	push   %edi
+  8011dd:	56                   	push   %esi
+  8011de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011df:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f2:	89 f7                	mov    %esi,%edi
+  8011f4:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011f6:	5b                   	pop    %ebx
+  8011f7:	5e                   	pop    %esi
+  8011f8:	5f                   	pop    %edi
+  8011f9:	5d                   	pop    %ebp
+  8011fa:	c3                   	ret
+
+008011fb <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011fb:	55                   	push   %ebp
+  8011fc:	89 e5                	mov    %esp,%ebp
+  8011fe:	57                   	push   %edi
+  8011ff:	56                   	push   %esi
+  801200:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801211:	89 df                	mov    %ebx,%edi
+  801213:	89 de                	mov    %ebx,%esi
+  801215:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801217:	5b                   	pop    %ebx
+  801218:	5e                   	pop    %esi
+  801219:	5f                   	pop    %edi
+  80121a:	5d                   	pop    %ebp
+  80121b:	c3                   	ret
+
+0080121c <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80121c:	55                   	push   %ebp
+  80121d:	89 e5                	mov    %esp,%ebp
+  80121f:	57                   	push   %edi
+  801220:	56                   	push   %esi
+  801221:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801222:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80122f:	89 cb                	mov    %ecx,%ebx
+  801231:	89 cf                	mov    %ecx,%edi
+  801233:	89 ce                	mov    %ecx,%esi
+  801235:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801237:	5b                   	pop    %ebx
+  801238:	5e                   	pop    %esi
+  801239:	5f                   	pop    %edi
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801242:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801246:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801253:	89 df                	mov    %ebx,%edi
+  801255:	89 de                	mov    %ebx,%esi
+  801257:	cd 30                	int    $0x30
+}
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+
+0080125e <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801264:	be 00 00 00 00       	mov    $0x0,%esi
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801274:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801277:	89 f7                	mov    %esi,%edi
+  801279:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5f                   	pop    %edi
+  80127e:	5d                   	pop    %ebp
+  80127f:	c3                   	ret
+
+00801280 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801286:	be 00 00 00 00       	mov    $0x0,%esi
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801291:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801299:	89 f7                	mov    %esi,%edi
+  80129b:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	56                   	push   %esi
+  8012a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012b8:	89 df                	mov    %ebx,%edi
+  8012ba:	89 de                	mov    %ebx,%esi
+  8012bc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012be:	5b                   	pop    %ebx
+  8012bf:	5e                   	pop    %esi
+  8012c0:	5f                   	pop    %edi
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	c3                   	ret
+
+008012c3 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012dc:	89 f7                	mov    %esi,%edi
+  8012de:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012e0:	5b                   	pop    %ebx
+  8012e1:	5e                   	pop    %esi
+  8012e2:	5f                   	pop    %edi
+  8012e3:	5d                   	pop    %ebp
+  8012e4:	c3                   	ret
+
+008012e5 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012e5:	85 c0                	test   %eax,%eax
+  8012e7:	74 20                	je     801309 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8012e9:	89 c1                	mov    %eax,%ecx
+  8012eb:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012f1:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8012f7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8012fd:	8b 52 48             	mov    0x48(%edx),%edx
+  801300:	39 c2                	cmp    %eax,%edx
+  801302:	74 06                	je     80130a <thread_alive+0x25>
+  801304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801309:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80130a:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801310:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  801316:	85 c0                	test   %eax,%eax
+  801318:	0f 95 c0             	setne  %al
+  80131b:	0f b6 c0             	movzbl %al,%eax
+  80131e:	c3                   	ret
+
+0080131f <pgfault>:
+{
+  80131f:	55                   	push   %ebp
+  801320:	89 e5                	mov    %esp,%ebp
+  801322:	57                   	push   %edi
+  801323:	56                   	push   %esi
+  801324:	53                   	push   %ebx
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80132b:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  80132d:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801330:	89 f3                	mov    %esi,%ebx
+  801332:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  801335:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80133c:	74 52                	je     801390 <pgfault+0x71>
+  80133e:	a8 02                	test   $0x2,%al
+  801340:	75 14                	jne    801356 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801342:	83 ec 04             	sub    $0x4,%esp
+  801345:	68 d6 49 80 00       	push   $0x8049d6
+  80134a:	6a 2e                	push   $0x2e
+  80134c:	68 f4 49 80 00       	push   $0x8049f4
+  801351:	e8 26 ef ff ff       	call   80027c <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801356:	89 d8                	mov    %ebx,%eax
+  801358:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80135d:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	57                   	push   %edi
+  801368:	e8 03 29 00 00       	call   803c70 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80136d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801374:	83 e0 03             	and    $0x3,%eax
+  801377:	83 c4 10             	add    $0x10,%esp
+  80137a:	83 f8 03             	cmp    $0x3,%eax
+  80137d:	75 1a                	jne    801399 <pgfault+0x7a>
+			mutex_unlock(m);
+  80137f:	83 ec 0c             	sub    $0xc,%esp
+  801382:	57                   	push   %edi
+  801383:	e8 56 29 00 00       	call   803cde <mutex_unlock>
+			return;
+  801388:	83 c4 10             	add    $0x10,%esp
+  80138b:	e9 9f 00 00 00       	jmp    80142f <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801390:	a8 02                	test   $0x2,%al
+  801392:	74 ae                	je     801342 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801394:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801399:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8013a0:	f6 c4 08             	test   $0x8,%ah
+  8013a3:	74 9d                	je     801342 <pgfault+0x23>
+  8013a5:	89 e0                	mov    %esp,%eax
+  8013a7:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8013ac:	29 c2                	sub    %eax,%edx
+  8013ae:	89 d0                	mov    %edx,%eax
+  8013b0:	c1 e8 0f             	shr    $0xf,%eax
+  8013b3:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8013b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013be:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8013c1:	c1 e0 0c             	shl    $0xc,%eax
+  8013c4:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8013c9:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  8013cb:	83 ec 04             	sub    $0x4,%esp
+  8013ce:	6a 07                	push   $0x7
+  8013d0:	53                   	push   %ebx
+  8013d1:	6a 00                	push   $0x0
+  8013d3:	e8 aa fa ff ff       	call   800e82 <sys_page_alloc>
+  8013d8:	83 c4 10             	add    $0x10,%esp
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	78 58                	js     801437 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8013df:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8013e5:	83 ec 04             	sub    $0x4,%esp
+  8013e8:	68 00 10 00 00       	push   $0x1000
+  8013ed:	56                   	push   %esi
+  8013ee:	53                   	push   %ebx
+  8013ef:	e8 0a f8 ff ff       	call   800bfe <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8013f4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8013fb:	56                   	push   %esi
+  8013fc:	6a 00                	push   $0x0
+  8013fe:	53                   	push   %ebx
+  8013ff:	6a 00                	push   $0x0
+  801401:	e8 bf fa ff ff       	call   800ec5 <sys_page_map>
+  801406:	83 c4 20             	add    $0x20,%esp
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	78 3c                	js     801449 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  80140d:	83 ec 08             	sub    $0x8,%esp
+  801410:	53                   	push   %ebx
+  801411:	6a 00                	push   $0x0
+  801413:	e8 ef fa ff ff       	call   800f07 <sys_page_unmap>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	78 3c                	js     80145b <pgfault+0x13c>
+	if(m)
+  80141f:	85 ff                	test   %edi,%edi
+  801421:	74 0c                	je     80142f <pgfault+0x110>
+		mutex_unlock(m);
+  801423:	83 ec 0c             	sub    $0xc,%esp
+  801426:	57                   	push   %edi
+  801427:	e8 b2 28 00 00       	call   803cde <mutex_unlock>
+  80142c:	83 c4 10             	add    $0x10,%esp
+}
+  80142f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801432:	5b                   	pop    %ebx
+  801433:	5e                   	pop    %esi
+  801434:	5f                   	pop    %edi
+  801435:	5d                   	pop    %ebp
+  801436:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801437:	50                   	push   %eax
+  801438:	68 ff 49 80 00       	push   $0x8049ff
+  80143d:	6a 3d                	push   $0x3d
+  80143f:	68 f4 49 80 00       	push   $0x8049f4
+  801444:	e8 33 ee ff ff       	call   80027c <_panic>
+		panic("sys_page_map: %e", ret);
+  801449:	50                   	push   %eax
+  80144a:	68 12 4a 80 00       	push   $0x804a12
+  80144f:	6a 40                	push   $0x40
+  801451:	68 f4 49 80 00       	push   $0x8049f4
+  801456:	e8 21 ee ff ff       	call   80027c <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80145b:	50                   	push   %eax
+  80145c:	68 23 4a 80 00       	push   $0x804a23
+  801461:	6a 42                	push   $0x42
+  801463:	68 f4 49 80 00       	push   $0x8049f4
+  801468:	e8 0f ee ff ff       	call   80027c <_panic>
+
+0080146d <thread_main>:
+{
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801473:	ff 75 0c             	push   0xc(%ebp)
+  801476:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  801479:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801480:	e8 7e f9 ff ff       	call   800e03 <sys_env_destroy>
+}
+  801485:	83 c4 10             	add    $0x10,%esp
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+
+0080148a <fork>:
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	57                   	push   %edi
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+  801490:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801493:	68 1f 13 80 00       	push   $0x80131f
+  801498:	e8 1f 2b 00 00       	call   803fbc <set_pgfault_handler>
+	if(sforked)
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8014a7:	75 33                	jne    8014dc <fork+0x52>
+	__asm __volatile("int %2"
+  8014a9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014ae:	cd 30                	int    $0x30
+  8014b0:	89 c7                	mov    %eax,%edi
+  8014b2:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8014b4:	85 c0                	test   %eax,%eax
+  8014b6:	0f 88 b4 00 00 00    	js     801570 <fork+0xe6>
+	if(envid == 0) {
+  8014bc:	0f 84 c3 00 00 00    	je     801585 <fork+0xfb>
+	pgbatch_init(&pb);
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  8014c5:	68 20 63 80 00       	push   $0x806320
+  8014ca:	e8 ed 25 00 00       	call   803abc <pgbatch_init>
+  8014cf:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	e9 9c 01 00 00       	jmp    801678 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8014dc:	83 ec 0c             	sub    $0xc,%esp
+  8014df:	68 c0 66 80 00       	push   $0x8066c0
+  8014e4:	e8 87 27 00 00       	call   803c70 <mutex_lock>
+  8014e9:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8014ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8014f1:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8014f6:	eb 08                	jmp    801500 <fork+0x76>
+  8014f8:	83 c3 01             	add    $0x1,%ebx
+  8014fb:	83 fb 20             	cmp    $0x20,%ebx
+  8014fe:	74 5b                	je     80155b <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801500:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  801507:	89 f0                	mov    %esi,%eax
+  801509:	e8 d7 fd ff ff       	call   8012e5 <thread_alive>
+  80150e:	85 c0                	test   %eax,%eax
+  801510:	74 e6                	je     8014f8 <fork+0x6e>
+  801512:	89 e0                	mov    %esp,%eax
+  801514:	89 fa                	mov    %edi,%edx
+  801516:	29 c2                	sub    %eax,%edx
+  801518:	89 d0                	mov    %edx,%eax
+  80151a:	c1 e8 0f             	shr    $0xf,%eax
+  80151d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801523:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801528:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  80152b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801532:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  801535:	83 ec 08             	sub    $0x8,%esp
+  801538:	50                   	push   %eax
+  801539:	56                   	push   %esi
+  80153a:	e8 8e fa ff ff       	call   800fcd <sys_env_set_pgfault_upcall>
+  80153f:	83 c4 10             	add    $0x10,%esp
+  801542:	85 c0                	test   %eax,%eax
+  801544:	79 b2                	jns    8014f8 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801546:	50                   	push   %eax
+  801547:	68 b0 4a 80 00       	push   $0x804ab0
+  80154c:	68 00 01 00 00       	push   $0x100
+  801551:	68 f4 49 80 00       	push   $0x8049f4
+  801556:	e8 21 ed ff ff       	call   80027c <_panic>
+	mutex_unlock(&sfork_lock);
+  80155b:	83 ec 0c             	sub    $0xc,%esp
+  80155e:	68 c0 66 80 00       	push   $0x8066c0
+  801563:	e8 76 27 00 00       	call   803cde <mutex_unlock>
+}
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	e9 39 ff ff ff       	jmp    8014a9 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801570:	50                   	push   %eax
+  801571:	68 36 4a 80 00       	push   $0x804a36
+  801576:	68 91 00 00 00       	push   $0x91
+  80157b:	68 f4 49 80 00       	push   $0x8049f4
+  801580:	e8 f7 ec ff ff       	call   80027c <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801585:	e8 ba f8 ff ff       	call   800e44 <sys_getenvid>
+  80158a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80158f:	89 e1                	mov    %esp,%ecx
+  801591:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801596:	29 ca                	sub    %ecx,%edx
+  801598:	89 d1                	mov    %edx,%ecx
+  80159a:	c1 e9 0f             	shr    $0xf,%ecx
+  80159d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8015a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a8:	0f 42 d1             	cmovb  %ecx,%edx
+  8015ab:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8015b1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015b6:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  8015bd:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	75 07                	jne    8015cd <fork+0x143>
+		return 0;
+  8015c6:	89 c6                	mov    %eax,%esi
+  8015c8:	e9 6f 02 00 00       	jmp    80183c <fork+0x3b2>
+  8015cd:	89 e2                	mov    %esp,%edx
+  8015cf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8015d4:	29 d0                	sub    %edx,%eax
+  8015d6:	89 c3                	mov    %eax,%ebx
+  8015d8:	c1 eb 0f             	shr    $0xf,%ebx
+  8015db:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e5:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8015e8:	83 ec 04             	sub    $0x4,%esp
+  8015eb:	68 80 00 00 00       	push   $0x80
+  8015f0:	6a 00                	push   $0x0
+  8015f2:	68 40 66 80 00       	push   $0x806640
+  8015f7:	e8 cd f5 ff ff       	call   800bc9 <memset>
+	thread_ids[slot] = sys_getenvid();
+  8015fc:	e8 43 f8 ff ff       	call   800e44 <sys_getenvid>
+  801601:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801608:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  80160f:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  801614:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  80161b:	e8 42 26 00 00       	call   803c62 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801620:	83 c4 0c             	add    $0xc,%esp
+  801623:	68 07 04 00 00       	push   $0x407
+  801628:	68 00 00 00 e1       	push   $0xe1000000
+  80162d:	6a 00                	push   $0x0
+  80162f:	e8 4e f8 ff ff       	call   800e82 <sys_page_alloc>
+  801634:	83 c4 10             	add    $0x10,%esp
+  801637:	85 c0                	test   %eax,%eax
+  801639:	0f 89 fd 01 00 00    	jns    80183c <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  80163f:	50                   	push   %eax
+  801640:	68 ff 49 80 00       	push   $0x8049ff
+  801645:	68 12 01 00 00       	push   $0x112
+  80164a:	68 f4 49 80 00       	push   $0x8049f4
+  80164f:	e8 28 ec ff ff       	call   80027c <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801654:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80165a:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801660:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801666:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80166c:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801672:	0f 87 4f 01 00 00    	ja     8017c7 <fork+0x33d>
+		pd = PDX(addr);
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80167d:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801684:	f6 c2 01             	test   $0x1,%dl
+  801687:	74 cb                	je     801654 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  801689:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80168e:	0f 85 92 00 00 00    	jne    801726 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801694:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80169a:	76 10                	jbe    8016ac <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80169c:	89 d8                	mov    %ebx,%eax
+  80169e:	f7 d8                	neg    %eax
+  8016a0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8016a5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8016aa:	74 ba                	je     801666 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8016ac:	89 d8                	mov    %ebx,%eax
+  8016ae:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8016b1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016b8:	f6 c2 01             	test   $0x1,%dl
+  8016bb:	74 a9                	je     801666 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8016bd:	89 c1                	mov    %eax,%ecx
+  8016bf:	c1 e1 0c             	shl    $0xc,%ecx
+  8016c2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8016c5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016cc:	f6 c6 04             	test   $0x4,%dh
+  8016cf:	0f 85 8e 00 00 00    	jne    801763 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  8016d5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016dc:	f6 c6 08             	test   $0x8,%dh
+  8016df:	75 0f                	jne    8016f0 <fork+0x266>
+  8016e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016e8:	a8 02                	test   $0x2,%al
+  8016ea:	0f 84 bb 00 00 00    	je     8017ab <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8016f0:	83 ec 08             	sub    $0x8,%esp
+  8016f3:	68 05 08 00 00       	push   $0x805
+  8016f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016fb:	50                   	push   %eax
+  8016fc:	56                   	push   %esi
+  8016fd:	50                   	push   %eax
+  8016fe:	6a 00                	push   $0x0
+  801700:	68 20 63 80 00       	push   $0x806320
+  801705:	e8 70 24 00 00       	call   803b7a <pgbatch_map>
+  80170a:	83 c4 20             	add    $0x20,%esp
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	79 76                	jns    801787 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801711:	50                   	push   %eax
+  801712:	68 5a 4a 80 00       	push   $0x804a5a
+  801717:	68 bc 00 00 00       	push   $0xbc
+  80171c:	68 f4 49 80 00       	push   $0x8049f4
+  801721:	e8 56 eb ff ff       	call   80027c <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801726:	83 ec 0c             	sub    $0xc,%esp
+  801729:	68 00 08 00 00       	push   $0x800
+  80172e:	56                   	push   %esi
+  80172f:	53                   	push   %ebx
+  801730:	6a 00                	push   $0x0
+  801732:	68 20 63 80 00       	push   $0x806320
+  801737:	e8 e9 24 00 00       	call   803c25 <pgbatch_sharept>
+  80173c:	83 c4 20             	add    $0x20,%esp
+  80173f:	85 c0                	test   %eax,%eax
+  801741:	78 0b                	js     80174e <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801743:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801749:	e9 18 ff ff ff       	jmp    801666 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80174e:	50                   	push   %eax
+  80174f:	68 46 4a 80 00       	push   $0x804a46
+  801754:	68 b2 00 00 00       	push   $0xb2
+  801759:	68 f4 49 80 00       	push   $0x8049f4
+  80175e:	e8 19 eb ff ff       	call   80027c <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801763:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80176a:	83 ec 08             	sub    $0x8,%esp
+  80176d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801772:	50                   	push   %eax
+  801773:	51                   	push   %ecx
+  801774:	56                   	push   %esi
+  801775:	51                   	push   %ecx
+  801776:	6a 00                	push   $0x0
+  801778:	68 20 63 80 00       	push   $0x806320
+  80177d:	e8 f8 23 00 00       	call   803b7a <pgbatch_map>
+  801782:	83 c4 20             	add    $0x20,%esp
+  801785:	eb 17                	jmp    80179e <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801787:	68 05 08 00 00       	push   $0x805
+  80178c:	ff 75 e4             	push   -0x1c(%ebp)
+  80178f:	6a 00                	push   $0x0
+  801791:	68 20 63 80 00       	push   $0x806320
+  801796:	e8 53 24 00 00       	call   803bee <pgbatch_protect>
+  80179b:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80179e:	85 c0                	test   %eax,%eax
+  8017a0:	0f 89 c0 fe ff ff    	jns    801666 <fork+0x1dc>
+  8017a6:	e9 66 ff ff ff       	jmp    801711 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8017ab:	83 ec 08             	sub    $0x8,%esp
+  8017ae:	6a 05                	push   $0x5
+  8017b0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017b3:	50                   	push   %eax
+  8017b4:	56                   	push   %esi
+  8017b5:	50                   	push   %eax
+  8017b6:	6a 00                	push   $0x0
+  8017b8:	68 20 63 80 00       	push   $0x806320
+  8017bd:	e8 b8 23 00 00       	call   803b7a <pgbatch_map>
+  8017c2:	83 c4 20             	add    $0x20,%esp
+  8017c5:	eb d7                	jmp    80179e <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8017c7:	6a 07                	push   $0x7
+  8017c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8017ce:	57                   	push   %edi
+  8017cf:	68 20 63 80 00       	push   $0x806320
+  8017d4:	e8 6a 23 00 00       	call   803b43 <pgbatch_alloc>
+  8017d9:	83 c4 10             	add    $0x10,%esp
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	78 66                	js     801846 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8017e0:	83 ec 0c             	sub    $0xc,%esp
+  8017e3:	68 20 63 80 00       	push   $0x806320
+  8017e8:	e8 dd 22 00 00       	call   803aca <pgbatch_flush>
+  8017ed:	83 c4 10             	add    $0x10,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 52                	js     801846 <fork+0x3bc>
+  8017f4:	89 e2                	mov    %esp,%edx
+  8017f6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017fb:	29 d0                	sub    %edx,%eax
+  8017fd:	89 c2                	mov    %eax,%edx
+  8017ff:	c1 ea 0f             	shr    $0xf,%edx
+  801802:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180c:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  80180f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801816:	8b 40 78             	mov    0x78(%eax),%eax
+  801819:	83 ec 08             	sub    $0x8,%esp
+  80181c:	50                   	push   %eax
+  80181d:	57                   	push   %edi
+  80181e:	e8 aa f7 ff ff       	call   800fcd <sys_env_set_pgfault_upcall>
+  801823:	83 c4 10             	add    $0x10,%esp
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 31                	js     80185b <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  80182a:	83 ec 08             	sub    $0x8,%esp
+  80182d:	6a 02                	push   $0x2
+  80182f:	57                   	push   %edi
+  801830:	e8 14 f7 ff ff       	call   800f49 <sys_env_set_status>
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 34                	js     801870 <fork+0x3e6>
+}
+  80183c:	89 f0                	mov    %esi,%eax
+  80183e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801841:	5b                   	pop    %ebx
+  801842:	5e                   	pop    %esi
+  801843:	5f                   	pop    %edi
+  801844:	5d                   	pop    %ebp
+  801845:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801846:	50                   	push   %eax
+  801847:	68 66 4a 80 00       	push   $0x804a66
+  80184c:	68 c0 00 00 00       	push   $0xc0
+  801851:	68 f4 49 80 00       	push   $0x8049f4
+  801856:	e8 21 ea ff ff       	call   80027c <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80185b:	50                   	push   %eax
+  80185c:	68 7b 4a 80 00       	push   $0x804a7b
+  801861:	68 c2 00 00 00       	push   $0xc2
+  801866:	68 f4 49 80 00       	push   $0x8049f4
+  80186b:	e8 0c ea ff ff       	call   80027c <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801870:	50                   	push   %eax
+  801871:	68 96 4a 80 00       	push   $0x804a96
+  801876:	68 c4 00 00 00       	push   $0xc4
+  80187b:	68 f4 49 80 00       	push   $0x8049f4
+  801880:	e8 f7 e9 ff ff       	call   80027c <_panic>
+
+00801885 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	57                   	push   %edi
+  801889:	56                   	push   %esi
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80188e:	68 c0 66 80 00       	push   $0x8066c0
+  801893:	e8 d8 23 00 00       	call   803c70 <mutex_lock>
+  801898:	89 e2                	mov    %esp,%edx
+  80189a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80189f:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8018a1:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8018a4:	89 c3                	mov    %eax,%ebx
+  8018a6:	c1 eb 0f             	shr    $0xf,%ebx
+  8018a9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b3:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8018b6:	e8 89 f5 ff ff       	call   800e44 <sys_getenvid>
+  8018bb:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  8018c2:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8018c7:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  8018ce:	e8 12 fa ff ff       	call   8012e5 <thread_alive>
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	74 24                	je     8018fb <sfork+0x76>
+  8018d7:	83 c3 01             	add    $0x1,%ebx
+  8018da:	83 fb 20             	cmp    $0x20,%ebx
+  8018dd:	75 e8                	jne    8018c7 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8018df:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8018e4:	83 ec 0c             	sub    $0xc,%esp
+  8018e7:	68 c0 66 80 00       	push   $0x8066c0
+  8018ec:	e8 ed 23 00 00       	call   803cde <mutex_unlock>
+	return r;
+}
+  8018f1:	89 f0                	mov    %esi,%eax
+  8018f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018f6:	5b                   	pop    %ebx
+  8018f7:	5e                   	pop    %esi
+  8018f8:	5f                   	pop    %edi
+  8018f9:	5d                   	pop    %ebp
+  8018fa:	c3                   	ret
+	if (i == NTHREADS) {
+  8018fb:	83 fb 20             	cmp    $0x20,%ebx
+  8018fe:	0f 84 53 01 00 00    	je     801a57 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801904:	89 d8                	mov    %ebx,%eax
+  801906:	c1 e0 0f             	shl    $0xf,%eax
+  801909:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  80190c:	83 ec 0c             	sub    $0xc,%esp
+  80190f:	68 00 60 80 00       	push   $0x806000
+  801914:	e8 a3 21 00 00       	call   803abc <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801919:	83 c4 10             	add    $0x10,%esp
+  80191c:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801923:	75 1f                	jne    801944 <sfork+0xbf>
+  801925:	68 07 04 00 00       	push   $0x407
+  80192a:	68 00 00 00 e1       	push   $0xe1000000
+  80192f:	6a 00                	push   $0x0
+  801931:	68 00 60 80 00       	push   $0x806000
+  801936:	e8 08 22 00 00       	call   803b43 <pgbatch_alloc>
+  80193b:	89 c6                	mov    %eax,%esi
+  80193d:	83 c4 10             	add    $0x10,%esp
+  801940:	85 c0                	test   %eax,%eax
+  801942:	78 a0                	js     8018e4 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801944:	6a 07                	push   $0x7
+  801946:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80194b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80194e:	29 c8                	sub    %ecx,%eax
+  801950:	50                   	push   %eax
+  801951:	6a 00                	push   $0x0
+  801953:	68 00 60 80 00       	push   $0x806000
+  801958:	e8 e6 21 00 00       	call   803b43 <pgbatch_alloc>
+  80195d:	89 c6                	mov    %eax,%esi
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	85 c0                	test   %eax,%eax
+  801964:	0f 88 7a ff ff ff    	js     8018e4 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  80196a:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  80196f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801972:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801974:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801979:	29 c8                	sub    %ecx,%eax
+  80197b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80197e:	39 c7                	cmp    %eax,%edi
+  801980:	73 29                	jae    8019ab <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801982:	6a 07                	push   $0x7
+  801984:	57                   	push   %edi
+  801985:	6a 00                	push   $0x0
+  801987:	68 00 60 80 00       	push   $0x806000
+  80198c:	e8 b2 21 00 00       	call   803b43 <pgbatch_alloc>
+  801991:	89 c6                	mov    %eax,%esi
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 c0                	test   %eax,%eax
+  801998:	0f 88 46 ff ff ff    	js     8018e4 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80199e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8019a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019a7:	39 c7                	cmp    %eax,%edi
+  8019a9:	72 d7                	jb     801982 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8019ab:	83 ec 0c             	sub    $0xc,%esp
+  8019ae:	68 00 60 80 00       	push   $0x806000
+  8019b3:	e8 12 21 00 00       	call   803aca <pgbatch_flush>
+  8019b8:	89 c6                	mov    %eax,%esi
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	0f 88 1f ff ff ff    	js     8018e4 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  8019c5:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  8019ca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019cd:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  8019cf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  8019d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019d8:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  8019db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019de:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019e1:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  8019e4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019e9:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019eb:	52                   	push   %edx
+  8019ec:	50                   	push   %eax
+  8019ed:	68 6d 14 80 00       	push   $0x80146d
+  8019f2:	e8 cc f8 ff ff       	call   8012c3 <sys_exofork_shared>
+  8019f7:	89 c6                	mov    %eax,%esi
+  8019f9:	83 c4 10             	add    $0x10,%esp
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	0f 88 e0 fe ff ff    	js     8018e4 <sfork+0x5f>
+	thread_ids[i] = id;
+  801a04:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801a0b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801a10:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801a16:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a1b:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801a22:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801a29:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+  801a2f:	6a 02                	push   $0x2
+  801a31:	56                   	push   %esi
+  801a32:	e8 12 f5 ff ff       	call   800f49 <sys_env_set_status>
+  801a37:	89 c3                	mov    %eax,%ebx
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	0f 89 a0 fe ff ff    	jns    8018e4 <sfork+0x5f>
+		sys_env_destroy(id);
+  801a44:	83 ec 0c             	sub    $0xc,%esp
+  801a47:	56                   	push   %esi
+  801a48:	e8 b6 f3 ff ff       	call   800e03 <sys_env_destroy>
+		goto out;
+  801a4d:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a50:	89 de                	mov    %ebx,%esi
+		goto out;
+  801a52:	e9 8d fe ff ff       	jmp    8018e4 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801a57:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801a5c:	e9 83 fe ff ff       	jmp    8018e4 <sfork+0x5f>
+
+00801a61 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a67:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a6c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a6f:	5d                   	pop    %ebp
+  801a70:	c3                   	ret
+
+00801a71 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a71:	55                   	push   %ebp
+  801a72:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a77:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a7c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a81:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801a86:	5d                   	pop    %ebp
+  801a87:	c3                   	ret
+
+00801a88 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a90:	89 c2                	mov    %eax,%edx
+  801a92:	c1 ea 16             	shr    $0x16,%edx
+  801a95:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a9c:	f6 c2 01             	test   $0x1,%dl
+  801a9f:	74 29                	je     801aca <fd_alloc+0x42>
+  801aa1:	89 c2                	mov    %eax,%edx
+  801aa3:	c1 ea 0c             	shr    $0xc,%edx
+  801aa6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aad:	f6 c2 01             	test   $0x1,%dl
+  801ab0:	74 18                	je     801aca <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801ab2:	05 00 10 00 00       	add    $0x1000,%eax
+  801ab7:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801abc:	75 d2                	jne    801a90 <fd_alloc+0x8>
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ac3:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ac8:	eb 05                	jmp    801acf <fd_alloc+0x47>
+			return 0;
+  801aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801acf:	8b 55 08             	mov    0x8(%ebp),%edx
+  801ad2:	89 02                	mov    %eax,(%edx)
+}
+  801ad4:	89 c8                	mov    %ecx,%eax
+  801ad6:	5d                   	pop    %ebp
+  801ad7:	c3                   	ret
+
+00801ad8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801ade:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801ae3:	77 30                	ja     801b15 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801ae5:	c1 e0 0c             	shl    $0xc,%eax
+  801ae8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801aed:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801af3:	f6 c2 01             	test   $0x1,%dl
+  801af6:	74 24                	je     801b1c <fd_lookup+0x44>
+  801af8:	89 c2                	mov    %eax,%edx
+  801afa:	c1 ea 0c             	shr    $0xc,%edx
+  801afd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b04:	f6 c2 01             	test   $0x1,%dl
+  801b07:	74 1a                	je     801b23 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801b09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b0c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b13:	5d                   	pop    %ebp
+  801b14:	c3                   	ret
+		return -E_INVAL;
+  801b15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b1a:	eb f7                	jmp    801b13 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801b1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b21:	eb f0                	jmp    801b13 <fd_lookup+0x3b>
+  801b23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b28:	eb e9                	jmp    801b13 <fd_lookup+0x3b>
+
+00801b2a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b2a:	55                   	push   %ebp
+  801b2b:	89 e5                	mov    %esp,%ebp
+  801b2d:	53                   	push   %ebx
+  801b2e:	83 ec 04             	sub    $0x4,%esp
+  801b31:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b39:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801b3e:	39 13                	cmp    %edx,(%ebx)
+  801b40:	74 54                	je     801b96 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801b42:	83 c0 01             	add    $0x1,%eax
+  801b45:	8b 1c 85 4c 4b 80 00 	mov    0x804b4c(,%eax,4),%ebx
+  801b4c:	85 db                	test   %ebx,%ebx
+  801b4e:	75 ee                	jne    801b3e <dev_lookup+0x14>
+  801b50:	89 e1                	mov    %esp,%ecx
+  801b52:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b57:	29 c8                	sub    %ecx,%eax
+  801b59:	89 c1                	mov    %eax,%ecx
+  801b5b:	c1 e9 0f             	shr    $0xf,%ecx
+  801b5e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b68:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b6b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801b72:	8b 40 48             	mov    0x48(%eax),%eax
+  801b75:	83 ec 04             	sub    $0x4,%esp
+  801b78:	52                   	push   %edx
+  801b79:	50                   	push   %eax
+  801b7a:	68 d0 4a 80 00       	push   $0x804ad0
+  801b7f:	e8 d3 e7 ff ff       	call   800357 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b8f:	89 1a                	mov    %ebx,(%edx)
+}
+  801b91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b94:	c9                   	leave
+  801b95:	c3                   	ret
+			return 0;
+  801b96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9b:	eb ef                	jmp    801b8c <dev_lookup+0x62>
+
+00801b9d <fd_close>:
+{
+  801b9d:	55                   	push   %ebp
+  801b9e:	89 e5                	mov    %esp,%ebp
+  801ba0:	57                   	push   %edi
+  801ba1:	56                   	push   %esi
+  801ba2:	53                   	push   %ebx
+  801ba3:	83 ec 24             	sub    $0x24,%esp
+  801ba6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ba9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801baf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bb0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801bb6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801bb9:	50                   	push   %eax
+  801bba:	e8 19 ff ff ff       	call   801ad8 <fd_lookup>
+  801bbf:	89 c3                	mov    %eax,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 05                	js     801bcd <fd_close+0x30>
+	    || fd != fd2)
+  801bc8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801bcb:	74 0f                	je     801bdc <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801bcd:	85 ff                	test   %edi,%edi
+  801bcf:	0f 44 df             	cmove  %edi,%ebx
+}
+  801bd2:	89 d8                	mov    %ebx,%eax
+  801bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bdc:	83 ec 08             	sub    $0x8,%esp
+  801bdf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801be2:	50                   	push   %eax
+  801be3:	ff 36                	push   (%esi)
+  801be5:	e8 40 ff ff ff       	call   801b2a <dev_lookup>
+  801bea:	89 c3                	mov    %eax,%ebx
+  801bec:	83 c4 10             	add    $0x10,%esp
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 1a                	js     801c0d <fd_close+0x70>
+		if (dev->dev_close)
+  801bf3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bf6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801bfe:	85 c0                	test   %eax,%eax
+  801c00:	74 0b                	je     801c0d <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801c02:	83 ec 0c             	sub    $0xc,%esp
+  801c05:	56                   	push   %esi
+  801c06:	ff d0                	call   *%eax
+  801c08:	89 c3                	mov    %eax,%ebx
+  801c0a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801c0d:	83 ec 08             	sub    $0x8,%esp
+  801c10:	56                   	push   %esi
+  801c11:	6a 00                	push   $0x0
+  801c13:	e8 ef f2 ff ff       	call   800f07 <sys_page_unmap>
+	return r;
+  801c18:	83 c4 10             	add    $0x10,%esp
+  801c1b:	eb b5                	jmp    801bd2 <fd_close+0x35>
+
+00801c1d <close>:
+
+int
+close(int fdnum)
+{
+  801c1d:	55                   	push   %ebp
+  801c1e:	89 e5                	mov    %esp,%ebp
+  801c20:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c26:	50                   	push   %eax
+  801c27:	ff 75 08             	push   0x8(%ebp)
+  801c2a:	e8 a9 fe ff ff       	call   801ad8 <fd_lookup>
+  801c2f:	83 c4 10             	add    $0x10,%esp
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	79 02                	jns    801c38 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801c36:	c9                   	leave
+  801c37:	c3                   	ret
+		return fd_close(fd, 1);
+  801c38:	83 ec 08             	sub    $0x8,%esp
+  801c3b:	6a 01                	push   $0x1
+  801c3d:	ff 75 f4             	push   -0xc(%ebp)
+  801c40:	e8 58 ff ff ff       	call   801b9d <fd_close>
+  801c45:	83 c4 10             	add    $0x10,%esp
+  801c48:	eb ec                	jmp    801c36 <close+0x19>
+
+00801c4a <close_all>:
+
+void
+close_all(void)
+{
+  801c4a:	55                   	push   %ebp
+  801c4b:	89 e5                	mov    %esp,%ebp
+  801c4d:	53                   	push   %ebx
+  801c4e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c56:	83 ec 0c             	sub    $0xc,%esp
+  801c59:	53                   	push   %ebx
+  801c5a:	e8 be ff ff ff       	call   801c1d <close>
+	for (i = 0; i < MAXFD; i++)
+  801c5f:	83 c3 01             	add    $0x1,%ebx
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801c6b:	75 e9                	jne    801c56 <close_all+0xc>
+}
+  801c6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c70:	c9                   	leave
+  801c71:	c3                   	ret
+
+00801c72 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c72:	55                   	push   %ebp
+  801c73:	89 e5                	mov    %esp,%ebp
+  801c75:	57                   	push   %edi
+  801c76:	56                   	push   %esi
+  801c77:	53                   	push   %ebx
+  801c78:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c7e:	50                   	push   %eax
+  801c7f:	ff 75 08             	push   0x8(%ebp)
+  801c82:	e8 51 fe ff ff       	call   801ad8 <fd_lookup>
+  801c87:	89 c3                	mov    %eax,%ebx
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 7f                	js     801d0f <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c90:	83 ec 0c             	sub    $0xc,%esp
+  801c93:	ff 75 0c             	push   0xc(%ebp)
+  801c96:	e8 82 ff ff ff       	call   801c1d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c9b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c9e:	c1 e6 0c             	shl    $0xc,%esi
+  801ca1:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ca7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801caa:	89 3c 24             	mov    %edi,(%esp)
+  801cad:	e8 bf fd ff ff       	call   801a71 <fd2data>
+  801cb2:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801cb4:	89 34 24             	mov    %esi,(%esp)
+  801cb7:	e8 b5 fd ff ff       	call   801a71 <fd2data>
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801cc2:	89 d8                	mov    %ebx,%eax
+  801cc4:	c1 e8 16             	shr    $0x16,%eax
+  801cc7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cce:	a8 01                	test   $0x1,%al
+  801cd0:	74 11                	je     801ce3 <dup+0x71>
+  801cd2:	89 d8                	mov    %ebx,%eax
+  801cd4:	c1 e8 0c             	shr    $0xc,%eax
+  801cd7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cde:	f6 c2 01             	test   $0x1,%dl
+  801ce1:	75 36                	jne    801d19 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ce3:	89 f8                	mov    %edi,%eax
+  801ce5:	c1 e8 0c             	shr    $0xc,%eax
+  801ce8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cf7:	50                   	push   %eax
+  801cf8:	56                   	push   %esi
+  801cf9:	6a 00                	push   $0x0
+  801cfb:	57                   	push   %edi
+  801cfc:	6a 00                	push   $0x0
+  801cfe:	e8 c2 f1 ff ff       	call   800ec5 <sys_page_map>
+  801d03:	89 c3                	mov    %eax,%ebx
+  801d05:	83 c4 20             	add    $0x20,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 33                	js     801d3f <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801d0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801d0f:	89 d8                	mov    %ebx,%eax
+  801d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d14:	5b                   	pop    %ebx
+  801d15:	5e                   	pop    %esi
+  801d16:	5f                   	pop    %edi
+  801d17:	5d                   	pop    %ebp
+  801d18:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801d19:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d28:	50                   	push   %eax
+  801d29:	ff 75 d4             	push   -0x2c(%ebp)
+  801d2c:	6a 00                	push   $0x0
+  801d2e:	53                   	push   %ebx
+  801d2f:	6a 00                	push   $0x0
+  801d31:	e8 8f f1 ff ff       	call   800ec5 <sys_page_map>
+  801d36:	89 c3                	mov    %eax,%ebx
+  801d38:	83 c4 20             	add    $0x20,%esp
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	79 a4                	jns    801ce3 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d3f:	83 ec 08             	sub    $0x8,%esp
+  801d42:	56                   	push   %esi
+  801d43:	6a 00                	push   $0x0
+  801d45:	e8 bd f1 ff ff       	call   800f07 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d4a:	83 c4 08             	add    $0x8,%esp
+  801d4d:	ff 75 d4             	push   -0x2c(%ebp)
+  801d50:	6a 00                	push   $0x0
+  801d52:	e8 b0 f1 ff ff       	call   800f07 <sys_page_unmap>
+	return r;
+  801d57:	83 c4 10             	add    $0x10,%esp
+  801d5a:	eb b3                	jmp    801d0f <dup+0x9d>
+
+00801d5c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d5c:	55                   	push   %ebp
+  801d5d:	89 e5                	mov    %esp,%ebp
+  801d5f:	56                   	push   %esi
+  801d60:	53                   	push   %ebx
+  801d61:	83 ec 18             	sub    $0x18,%esp
+  801d64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d67:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d6a:	50                   	push   %eax
+  801d6b:	53                   	push   %ebx
+  801d6c:	e8 67 fd ff ff       	call   801ad8 <fd_lookup>
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 3c                	js     801db4 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d78:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d7b:	83 ec 08             	sub    $0x8,%esp
+  801d7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d81:	50                   	push   %eax
+  801d82:	ff 36                	push   (%esi)
+  801d84:	e8 a1 fd ff ff       	call   801b2a <dev_lookup>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 24                	js     801db4 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d90:	8b 46 08             	mov    0x8(%esi),%eax
+  801d93:	83 e0 03             	and    $0x3,%eax
+  801d96:	83 f8 01             	cmp    $0x1,%eax
+  801d99:	74 20                	je     801dbb <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9e:	8b 40 08             	mov    0x8(%eax),%eax
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	74 54                	je     801df9 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801da5:	83 ec 04             	sub    $0x4,%esp
+  801da8:	ff 75 10             	push   0x10(%ebp)
+  801dab:	ff 75 0c             	push   0xc(%ebp)
+  801dae:	56                   	push   %esi
+  801daf:	ff d0                	call   *%eax
+  801db1:	83 c4 10             	add    $0x10,%esp
+}
+  801db4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801db7:	5b                   	pop    %ebx
+  801db8:	5e                   	pop    %esi
+  801db9:	5d                   	pop    %ebp
+  801dba:	c3                   	ret
+  801dbb:	89 e2                	mov    %esp,%edx
+  801dbd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801dc2:	29 d0                	sub    %edx,%eax
+  801dc4:	89 c2                	mov    %eax,%edx
+  801dc6:	c1 ea 0f             	shr    $0xf,%edx
+  801dc9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd3:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dd6:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ddd:	8b 40 48             	mov    0x48(%eax),%eax
+  801de0:	83 ec 04             	sub    $0x4,%esp
+  801de3:	53                   	push   %ebx
+  801de4:	50                   	push   %eax
+  801de5:	68 11 4b 80 00       	push   $0x804b11
+  801dea:	e8 68 e5 ff ff       	call   800357 <cprintf>
+		return -E_INVAL;
+  801def:	83 c4 10             	add    $0x10,%esp
+  801df2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df7:	eb bb                	jmp    801db4 <read+0x58>
+		return -E_NOT_SUPP;
+  801df9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dfe:	eb b4                	jmp    801db4 <read+0x58>
+
+00801e00 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	57                   	push   %edi
+  801e04:	56                   	push   %esi
+  801e05:	53                   	push   %ebx
+  801e06:	83 ec 0c             	sub    $0xc,%esp
+  801e09:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801e0c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801e0f:	85 f6                	test   %esi,%esi
+  801e11:	74 30                	je     801e43 <readn+0x43>
+  801e13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e18:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801e1d:	83 ec 04             	sub    $0x4,%esp
+  801e20:	89 f2                	mov    %esi,%edx
+  801e22:	29 c2                	sub    %eax,%edx
+  801e24:	52                   	push   %edx
+  801e25:	01 f8                	add    %edi,%eax
+  801e27:	50                   	push   %eax
+  801e28:	ff 75 08             	push   0x8(%ebp)
+  801e2b:	e8 2c ff ff ff       	call   801d5c <read>
+		if (m < 0)
+  801e30:	83 c4 10             	add    $0x10,%esp
+  801e33:	85 c0                	test   %eax,%eax
+  801e35:	78 15                	js     801e4c <readn+0x4c>
+			return m;
+		if (m == 0)
+  801e37:	74 11                	je     801e4a <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801e39:	01 c3                	add    %eax,%ebx
+  801e3b:	89 d8                	mov    %ebx,%eax
+  801e3d:	39 f3                	cmp    %esi,%ebx
+  801e3f:	72 dc                	jb     801e1d <readn+0x1d>
+  801e41:	eb 09                	jmp    801e4c <readn+0x4c>
+  801e43:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e48:	eb 02                	jmp    801e4c <readn+0x4c>
+  801e4a:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4f:	5b                   	pop    %ebx
+  801e50:	5e                   	pop    %esi
+  801e51:	5f                   	pop    %edi
+  801e52:	5d                   	pop    %ebp
+  801e53:	c3                   	ret
+
+00801e54 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	56                   	push   %esi
+  801e58:	53                   	push   %ebx
+  801e59:	83 ec 18             	sub    $0x18,%esp
+  801e5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e5f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e62:	50                   	push   %eax
+  801e63:	53                   	push   %ebx
+  801e64:	e8 6f fc ff ff       	call   801ad8 <fd_lookup>
+  801e69:	83 c4 10             	add    $0x10,%esp
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 37                	js     801ea7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e70:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e73:	83 ec 08             	sub    $0x8,%esp
+  801e76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e79:	50                   	push   %eax
+  801e7a:	ff 36                	push   (%esi)
+  801e7c:	e8 a9 fc ff ff       	call   801b2a <dev_lookup>
+  801e81:	83 c4 10             	add    $0x10,%esp
+  801e84:	85 c0                	test   %eax,%eax
+  801e86:	78 1f                	js     801ea7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e88:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e8c:	74 20                	je     801eae <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	74 54                	je     801eec <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e98:	83 ec 04             	sub    $0x4,%esp
+  801e9b:	ff 75 10             	push   0x10(%ebp)
+  801e9e:	ff 75 0c             	push   0xc(%ebp)
+  801ea1:	56                   	push   %esi
+  801ea2:	ff d0                	call   *%eax
+  801ea4:	83 c4 10             	add    $0x10,%esp
+}
+  801ea7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eaa:	5b                   	pop    %ebx
+  801eab:	5e                   	pop    %esi
+  801eac:	5d                   	pop    %ebp
+  801ead:	c3                   	ret
+  801eae:	89 e2                	mov    %esp,%edx
+  801eb0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801eb5:	29 d0                	sub    %edx,%eax
+  801eb7:	89 c2                	mov    %eax,%edx
+  801eb9:	c1 ea 0f             	shr    $0xf,%edx
+  801ebc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec6:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ec9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ed0:	8b 40 48             	mov    0x48(%eax),%eax
+  801ed3:	83 ec 04             	sub    $0x4,%esp
+  801ed6:	53                   	push   %ebx
+  801ed7:	50                   	push   %eax
+  801ed8:	68 2d 4b 80 00       	push   $0x804b2d
+  801edd:	e8 75 e4 ff ff       	call   800357 <cprintf>
+		return -E_INVAL;
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eea:	eb bb                	jmp    801ea7 <write+0x53>
+		return -E_NOT_SUPP;
+  801eec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ef1:	eb b4                	jmp    801ea7 <write+0x53>
+
+00801ef3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ef9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801efc:	50                   	push   %eax
+  801efd:	ff 75 08             	push   0x8(%ebp)
+  801f00:	e8 d3 fb ff ff       	call   801ad8 <fd_lookup>
+  801f05:	83 c4 10             	add    $0x10,%esp
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	78 0e                	js     801f1a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801f0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f12:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801f15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f1a:	c9                   	leave
+  801f1b:	c3                   	ret
+
+00801f1c <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801f1c:	55                   	push   %ebp
+  801f1d:	89 e5                	mov    %esp,%ebp
+  801f1f:	53                   	push   %ebx
+  801f20:	83 ec 1c             	sub    $0x1c,%esp
+  801f23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f29:	50                   	push   %eax
+  801f2a:	ff 75 08             	push   0x8(%ebp)
+  801f2d:	e8 a6 fb ff ff       	call   801ad8 <fd_lookup>
+  801f32:	83 c4 10             	add    $0x10,%esp
+  801f35:	85 c0                	test   %eax,%eax
+  801f37:	78 33                	js     801f6c <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801f39:	83 fb 03             	cmp    $0x3,%ebx
+  801f3c:	74 28                	je     801f66 <fcntl+0x4a>
+  801f3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f43:	83 fb 04             	cmp    $0x4,%ebx
+  801f46:	75 24                	jne    801f6c <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801f48:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801f4b:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f4e:	80 e4 ef             	and    $0xef,%ah
+  801f51:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f54:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801f5a:	09 d0                	or     %edx,%eax
+  801f5c:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801f5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f64:	eb 06                	jmp    801f6c <fcntl+0x50>
+		return fd->fd_omode;
+  801f66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f69:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801f6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6f:	c9                   	leave
+  801f70:	c3                   	ret
+
+00801f71 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f71:	55                   	push   %ebp
+  801f72:	89 e5                	mov    %esp,%ebp
+  801f74:	56                   	push   %esi
+  801f75:	53                   	push   %ebx
+  801f76:	83 ec 18             	sub    $0x18,%esp
+  801f79:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f7c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f7f:	50                   	push   %eax
+  801f80:	53                   	push   %ebx
+  801f81:	e8 52 fb ff ff       	call   801ad8 <fd_lookup>
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	78 34                	js     801fc1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f8d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f90:	83 ec 08             	sub    $0x8,%esp
+  801f93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f96:	50                   	push   %eax
+  801f97:	ff 36                	push   (%esi)
+  801f99:	e8 8c fb ff ff       	call   801b2a <dev_lookup>
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 1c                	js     801fc1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fa5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fa9:	74 1d                	je     801fc8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801fab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fae:	8b 40 18             	mov    0x18(%eax),%eax
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	74 51                	je     802006 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801fb5:	83 ec 08             	sub    $0x8,%esp
+  801fb8:	ff 75 0c             	push   0xc(%ebp)
+  801fbb:	56                   	push   %esi
+  801fbc:	ff d0                	call   *%eax
+  801fbe:	83 c4 10             	add    $0x10,%esp
+}
+  801fc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc4:	5b                   	pop    %ebx
+  801fc5:	5e                   	pop    %esi
+  801fc6:	5d                   	pop    %ebp
+  801fc7:	c3                   	ret
+  801fc8:	89 e2                	mov    %esp,%edx
+  801fca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801fcf:	29 d0                	sub    %edx,%eax
+  801fd1:	89 c2                	mov    %eax,%edx
+  801fd3:	c1 ea 0f             	shr    $0xf,%edx
+  801fd6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801fe3:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801fea:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fed:	83 ec 04             	sub    $0x4,%esp
+  801ff0:	53                   	push   %ebx
+  801ff1:	50                   	push   %eax
+  801ff2:	68 f0 4a 80 00       	push   $0x804af0
+  801ff7:	e8 5b e3 ff ff       	call   800357 <cprintf>
+		return -E_INVAL;
+  801ffc:	83 c4 10             	add    $0x10,%esp
+  801fff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802004:	eb bb                	jmp    801fc1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802006:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80200b:	eb b4                	jmp    801fc1 <ftruncate+0x50>
+
+0080200d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	83 ec 18             	sub    $0x18,%esp
+  802015:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802018:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80201b:	50                   	push   %eax
+  80201c:	ff 75 08             	push   0x8(%ebp)
+  80201f:	e8 b4 fa ff ff       	call   801ad8 <fd_lookup>
+  802024:	83 c4 10             	add    $0x10,%esp
+  802027:	85 c0                	test   %eax,%eax
+  802029:	78 53                	js     80207e <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80202b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80202e:	83 ec 08             	sub    $0x8,%esp
+  802031:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802034:	50                   	push   %eax
+  802035:	ff 36                	push   (%esi)
+  802037:	e8 ee fa ff ff       	call   801b2a <dev_lookup>
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 3b                	js     80207e <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802043:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802046:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80204a:	74 39                	je     802085 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80204c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80204f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802056:	00 00 00 
+	stat->st_isdir = 0;
+  802059:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802060:	00 00 00 
+	stat->st_version = 0;
+  802063:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80206a:	00 00 00 
+	stat->st_dev = dev;
+  80206d:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802073:	83 ec 08             	sub    $0x8,%esp
+  802076:	53                   	push   %ebx
+  802077:	56                   	push   %esi
+  802078:	ff 50 14             	call   *0x14(%eax)
+  80207b:	83 c4 10             	add    $0x10,%esp
+}
+  80207e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802081:	5b                   	pop    %ebx
+  802082:	5e                   	pop    %esi
+  802083:	5d                   	pop    %ebp
+  802084:	c3                   	ret
+		return -E_NOT_SUPP;
+  802085:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80208a:	eb f2                	jmp    80207e <fstat+0x71>
+
+0080208c <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	56                   	push   %esi
+  802090:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802091:	83 ec 08             	sub    $0x8,%esp
+  802094:	6a 00                	push   $0x0
+  802096:	ff 75 08             	push   0x8(%ebp)
+  802099:	e8 b7 01 00 00       	call   802255 <open>
+  80209e:	89 c3                	mov    %eax,%ebx
+  8020a0:	83 c4 10             	add    $0x10,%esp
+  8020a3:	85 c0                	test   %eax,%eax
+  8020a5:	78 1b                	js     8020c2 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8020a7:	83 ec 08             	sub    $0x8,%esp
+  8020aa:	ff 75 0c             	push   0xc(%ebp)
+  8020ad:	50                   	push   %eax
+  8020ae:	e8 5a ff ff ff       	call   80200d <fstat>
+  8020b3:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8020b5:	89 1c 24             	mov    %ebx,(%esp)
+  8020b8:	e8 60 fb ff ff       	call   801c1d <close>
+	return r;
+  8020bd:	83 c4 10             	add    $0x10,%esp
+  8020c0:	89 f3                	mov    %esi,%ebx
+}
+  8020c2:	89 d8                	mov    %ebx,%eax
+  8020c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c7:	5b                   	pop    %ebx
+  8020c8:	5e                   	pop    %esi
+  8020c9:	5d                   	pop    %ebp
+  8020ca:	c3                   	ret
+
+008020cb <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8020cb:	55                   	push   %ebp
+  8020cc:	89 e5                	mov    %esp,%ebp
+  8020ce:	56                   	push   %esi
+  8020cf:	53                   	push   %ebx
+  8020d0:	89 c6                	mov    %eax,%esi
+  8020d2:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8020d4:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8020db:	74 27                	je     802104 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8020dd:	6a 07                	push   $0x7
+  8020df:	68 00 70 80 00       	push   $0x807000
+  8020e4:	56                   	push   %esi
+  8020e5:	ff 35 c4 66 80 00    	push   0x8066c4
+  8020eb:	e8 c0 21 00 00       	call   8042b0 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8020f0:	83 c4 0c             	add    $0xc,%esp
+  8020f3:	6a 00                	push   $0x0
+  8020f5:	53                   	push   %ebx
+  8020f6:	6a 00                	push   $0x0
+  8020f8:	e8 23 1f 00 00       	call   804020 <ipc_recv>
+}
+  8020fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802100:	5b                   	pop    %ebx
+  802101:	5e                   	pop    %esi
+  802102:	5d                   	pop    %ebp
+  802103:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802104:	83 ec 0c             	sub    $0xc,%esp
+  802107:	6a 02                	push   $0x2
+  802109:	e8 0b 22 00 00       	call   804319 <ipc_find_env>
+  80210e:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802113:	83 c4 10             	add    $0x10,%esp
+  802116:	eb c5                	jmp    8020dd <fsipc+0x12>
+
+00802118 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802118:	55                   	push   %ebp
+  802119:	89 e5                	mov    %esp,%ebp
+  80211b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80211e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802121:	8b 40 0c             	mov    0xc(%eax),%eax
+  802124:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802129:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80212c:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802131:	ba 00 00 00 00       	mov    $0x0,%edx
+  802136:	b8 02 00 00 00       	mov    $0x2,%eax
+  80213b:	e8 8b ff ff ff       	call   8020cb <fsipc>
+}
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+
+00802142 <devfile_flush>:
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802148:	8b 45 08             	mov    0x8(%ebp),%eax
+  80214b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80214e:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802153:	ba 00 00 00 00       	mov    $0x0,%edx
+  802158:	b8 06 00 00 00       	mov    $0x6,%eax
+  80215d:	e8 69 ff ff ff       	call   8020cb <fsipc>
+}
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+
+00802164 <devfile_stat>:
+{
+  802164:	55                   	push   %ebp
+  802165:	89 e5                	mov    %esp,%ebp
+  802167:	53                   	push   %ebx
+  802168:	83 ec 04             	sub    $0x4,%esp
+  80216b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80216e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802171:	8b 40 0c             	mov    0xc(%eax),%eax
+  802174:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802183:	e8 43 ff ff ff       	call   8020cb <fsipc>
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	78 37                	js     8021c3 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80218c:	83 ec 08             	sub    $0x8,%esp
+  80218f:	68 00 70 80 00       	push   $0x807000
+  802194:	53                   	push   %ebx
+  802195:	e8 b4 e8 ff ff       	call   800a4e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80219a:	a1 80 70 80 00       	mov    0x807080,%eax
+  80219f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021a5:	a1 84 70 80 00       	mov    0x807084,%eax
+  8021aa:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8021b0:	a1 88 70 80 00       	mov    0x807088,%eax
+  8021b5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8021bb:	83 c4 10             	add    $0x10,%esp
+  8021be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+
+008021c8 <devfile_write>:
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	83 ec 0c             	sub    $0xc,%esp
+  8021ce:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8021d1:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8021d6:	39 d0                	cmp    %edx,%eax
+  8021d8:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8021de:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021e1:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8021e7:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8021ec:	50                   	push   %eax
+  8021ed:	ff 75 0c             	push   0xc(%ebp)
+  8021f0:	68 08 70 80 00       	push   $0x807008
+  8021f5:	e8 04 ea ff ff       	call   800bfe <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8021fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ff:	b8 04 00 00 00       	mov    $0x4,%eax
+  802204:	e8 c2 fe ff ff       	call   8020cb <fsipc>
+}
+  802209:	c9                   	leave
+  80220a:	c3                   	ret
+
+0080220b <devfile_read>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	53                   	push   %ebx
+  80220f:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802212:	8b 45 08             	mov    0x8(%ebp),%eax
+  802215:	8b 40 0c             	mov    0xc(%eax),%eax
+  802218:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  80221d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802220:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802225:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80222a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80222f:	e8 97 fe ff ff       	call   8020cb <fsipc>
+  802234:	89 c3                	mov    %eax,%ebx
+  802236:	85 c0                	test   %eax,%eax
+  802238:	78 14                	js     80224e <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80223a:	83 ec 04             	sub    $0x4,%esp
+  80223d:	50                   	push   %eax
+  80223e:	68 00 70 80 00       	push   $0x807000
+  802243:	ff 75 0c             	push   0xc(%ebp)
+  802246:	e8 b3 e9 ff ff       	call   800bfe <memmove>
+	return r;
+  80224b:	83 c4 10             	add    $0x10,%esp
+}
+  80224e:	89 d8                	mov    %ebx,%eax
+  802250:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802253:	c9                   	leave
+  802254:	c3                   	ret
+
+00802255 <open>:
+{
+  802255:	55                   	push   %ebp
+  802256:	89 e5                	mov    %esp,%ebp
+  802258:	53                   	push   %ebx
+  802259:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80225c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225f:	50                   	push   %eax
+  802260:	e8 23 f8 ff ff       	call   801a88 <fd_alloc>
+  802265:	89 c3                	mov    %eax,%ebx
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	78 2a                	js     802298 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80226e:	83 ec 0c             	sub    $0xc,%esp
+  802271:	ff 75 08             	push   0x8(%ebp)
+  802274:	e8 89 e7 ff ff       	call   800a02 <strlen>
+  802279:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80227c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802281:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802286:	7e 17                	jle    80229f <open+0x4a>
+	fd_close(fd, 1);
+  802288:	83 ec 08             	sub    $0x8,%esp
+  80228b:	6a 01                	push   $0x1
+  80228d:	ff 75 f4             	push   -0xc(%ebp)
+  802290:	e8 08 f9 ff ff       	call   801b9d <fd_close>
+	return r;
+  802295:	83 c4 10             	add    $0x10,%esp
+}
+  802298:	89 d8                	mov    %ebx,%eax
+  80229a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229d:	c9                   	leave
+  80229e:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80229f:	83 ec 08             	sub    $0x8,%esp
+  8022a2:	ff 75 08             	push   0x8(%ebp)
+  8022a5:	68 00 70 80 00       	push   $0x807000
+  8022aa:	e8 9f e7 ff ff       	call   800a4e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8022af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b2:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8022b7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022bf:	e8 07 fe ff ff       	call   8020cb <fsipc>
+  8022c4:	89 c3                	mov    %eax,%ebx
+  8022c6:	83 c4 10             	add    $0x10,%esp
+  8022c9:	85 c0                	test   %eax,%eax
+  8022cb:	78 bb                	js     802288 <open+0x33>
+	return fd2num(fd); 	
+  8022cd:	83 ec 0c             	sub    $0xc,%esp
+  8022d0:	ff 75 f4             	push   -0xc(%ebp)
+  8022d3:	e8 89 f7 ff ff       	call   801a61 <fd2num>
+  8022d8:	89 c3                	mov    %eax,%ebx
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	eb b9                	jmp    802298 <open+0x43>
+
+008022df <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	53                   	push   %ebx
+  8022e3:	83 ec 1c             	sub    $0x1c,%esp
+  8022e6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ec:	50                   	push   %eax
+  8022ed:	ff 75 08             	push   0x8(%ebp)
+  8022f0:	e8 e3 f7 ff ff       	call   801ad8 <fd_lookup>
+  8022f5:	83 c4 10             	add    $0x10,%esp
+  8022f8:	85 c0                	test   %eax,%eax
+  8022fa:	78 5a                	js     802356 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8022fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ff:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802305:	39 10                	cmp    %edx,(%eax)
+  802307:	75 66                	jne    80236f <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802309:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802310:	74 49                	je     80235b <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802312:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802315:	8b 40 0c             	mov    0xc(%eax),%eax
+  802318:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  80231d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802320:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802325:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80232b:	6a 07                	push   $0x7
+  80232d:	68 00 70 80 00       	push   $0x807000
+  802332:	6a 09                	push   $0x9
+  802334:	ff 35 c4 66 80 00    	push   0x8066c4
+  80233a:	e8 71 1f 00 00       	call   8042b0 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80233f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802346:	6a 00                	push   $0x0
+  802348:	53                   	push   %ebx
+  802349:	ff 75 10             	push   0x10(%ebp)
+  80234c:	6a 00                	push   $0x0
+  80234e:	e8 9a 1d 00 00       	call   8040ed <ipc_recv_pages>
+  802353:	83 c4 20             	add    $0x20,%esp
+}
+  802356:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802359:	c9                   	leave
+  80235a:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80235b:	83 ec 0c             	sub    $0xc,%esp
+  80235e:	6a 02                	push   $0x2
+  802360:	e8 b4 1f 00 00       	call   804319 <ipc_find_env>
+  802365:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80236a:	83 c4 10             	add    $0x10,%esp
+  80236d:	eb a3                	jmp    802312 <fmap+0x33>
+		return -E_INVAL;
+  80236f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802374:	eb e0                	jmp    802356 <fmap+0x77>
+
+00802376 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	53                   	push   %ebx
+  80237a:	83 ec 10             	sub    $0x10,%esp
+  80237d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802380:	53                   	push   %ebx
+  802381:	e8 7c e6 ff ff       	call   800a02 <strlen>
+  802386:	83 c4 10             	add    $0x10,%esp
+  802389:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80238e:	7f 25                	jg     8023b5 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802390:	83 ec 08             	sub    $0x8,%esp
+  802393:	53                   	push   %ebx
+  802394:	68 00 70 80 00       	push   $0x807000
+  802399:	e8 b0 e6 ff ff       	call   800a4e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80239e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023a8:	e8 1e fd ff ff       	call   8020cb <fsipc>
+  8023ad:	83 c4 10             	add    $0x10,%esp
+}
+  8023b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b3:	c9                   	leave
+  8023b4:	c3                   	ret
+		return -E_BAD_PATH;
+  8023b5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023ba:	eb f4                	jmp    8023b0 <remove+0x3a>
+
+008023bc <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023bc:	55                   	push   %ebp
+  8023bd:	89 e5                	mov    %esp,%ebp
+  8023bf:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8023c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023cc:	e8 fa fc ff ff       	call   8020cb <fsipc>
+}
+  8023d1:	c9                   	leave
+  8023d2:	c3                   	ret
+
+008023d3 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023d3:	55                   	push   %ebp
+  8023d4:	89 e5                	mov    %esp,%ebp
+  8023d6:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8023d9:	68 60 4b 80 00       	push   $0x804b60
+  8023de:	ff 75 0c             	push   0xc(%ebp)
+  8023e1:	e8 68 e6 ff ff       	call   800a4e <strcpy>
+	return 0;
+}
+  8023e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023eb:	c9                   	leave
+  8023ec:	c3                   	ret
+
+008023ed <devsock_close>:
+{
+  8023ed:	55                   	push   %ebp
+  8023ee:	89 e5                	mov    %esp,%ebp
+  8023f0:	53                   	push   %ebx
+  8023f1:	83 ec 10             	sub    $0x10,%esp
+  8023f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8023f7:	53                   	push   %ebx
+  8023f8:	e8 5b 1f 00 00       	call   804358 <pageref>
+  8023fd:	89 c2                	mov    %eax,%edx
+  8023ff:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802402:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802407:	83 fa 01             	cmp    $0x1,%edx
+  80240a:	74 05                	je     802411 <devsock_close+0x24>
+}
+  80240c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80240f:	c9                   	leave
+  802410:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802411:	83 ec 0c             	sub    $0xc,%esp
+  802414:	ff 73 0c             	push   0xc(%ebx)
+  802417:	e8 b0 05 00 00       	call   8029cc <nsipc_close>
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	eb eb                	jmp    80240c <devsock_close+0x1f>
+
+00802421 <devsock_write>:
+{
+  802421:	55                   	push   %ebp
+  802422:	89 e5                	mov    %esp,%ebp
+  802424:	53                   	push   %ebx
+  802425:	83 ec 14             	sub    $0x14,%esp
+  802428:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80242b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80242e:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802431:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802434:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802437:	8b 41 08             	mov    0x8(%ecx),%eax
+  80243a:	c1 f8 09             	sar    $0x9,%eax
+  80243d:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802440:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802446:	77 13                	ja     80245b <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802448:	50                   	push   %eax
+  802449:	52                   	push   %edx
+  80244a:	53                   	push   %ebx
+  80244b:	ff 71 0c             	push   0xc(%ecx)
+  80244e:	e8 5c 06 00 00       	call   802aaf <nsipc_send>
+  802453:	83 c4 10             	add    $0x10,%esp
+}
+  802456:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802459:	c9                   	leave
+  80245a:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80245b:	50                   	push   %eax
+  80245c:	6a 01                	push   $0x1
+  80245e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802461:	50                   	push   %eax
+  802462:	ff 71 0c             	push   0xc(%ecx)
+  802465:	e8 a6 06 00 00       	call   802b10 <nsipc_sendmsg>
+  80246a:	83 c4 10             	add    $0x10,%esp
+  80246d:	eb e7                	jmp    802456 <devsock_write+0x35>
+
+0080246f <devsock_read>:
+{
+  80246f:	55                   	push   %ebp
+  802470:	89 e5                	mov    %esp,%ebp
+  802472:	53                   	push   %ebx
+  802473:	83 ec 14             	sub    $0x14,%esp
+  802476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802479:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80247c:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  80247f:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802482:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802485:	8b 41 08             	mov    0x8(%ecx),%eax
+  802488:	c1 f8 09             	sar    $0x9,%eax
+  80248b:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80248e:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802494:	77 13                	ja     8024a9 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802496:	50                   	push   %eax
+  802497:	52                   	push   %edx
+  802498:	53                   	push   %ebx
+  802499:	ff 71 0c             	push   0xc(%ecx)
+  80249c:	e8 9c 05 00 00       	call   802a3d <nsipc_recv>
+  8024a1:	83 c4 10             	add    $0x10,%esp
+}
+  8024a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024a7:	c9                   	leave
+  8024a8:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8024a9:	50                   	push   %eax
+  8024aa:	6a 01                	push   $0x1
+  8024ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8024af:	50                   	push   %eax
+  8024b0:	ff 71 0c             	push   0xc(%ecx)
+  8024b3:	e8 02 0a 00 00       	call   802eba <nsipc_recvmsg>
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	eb e7                	jmp    8024a4 <devsock_read+0x35>
+
+008024bd <fd2sockid>:
+{
+  8024bd:	55                   	push   %ebp
+  8024be:	89 e5                	mov    %esp,%ebp
+  8024c0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8024c3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024c6:	52                   	push   %edx
+  8024c7:	50                   	push   %eax
+  8024c8:	e8 0b f6 ff ff       	call   801ad8 <fd_lookup>
+  8024cd:	83 c4 10             	add    $0x10,%esp
+  8024d0:	85 c0                	test   %eax,%eax
+  8024d2:	78 10                	js     8024e4 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8024d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024d7:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  8024dd:	39 08                	cmp    %ecx,(%eax)
+  8024df:	75 05                	jne    8024e6 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8024e1:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8024e4:	c9                   	leave
+  8024e5:	c3                   	ret
+		return -E_NOT_SUPP;
+  8024e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024eb:	eb f7                	jmp    8024e4 <fd2sockid+0x27>
+
+008024ed <sock_flags>:
+{
+  8024ed:	55                   	push   %ebp
+  8024ee:	89 e5                	mov    %esp,%ebp
+  8024f0:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8024f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8024f6:	52                   	push   %edx
+  8024f7:	50                   	push   %eax
+  8024f8:	e8 db f5 ff ff       	call   801ad8 <fd_lookup>
+  8024fd:	83 c4 10             	add    $0x10,%esp
+  802500:	85 c0                	test   %eax,%eax
+  802502:	78 0e                	js     802512 <sock_flags+0x25>
+  802504:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802507:	8b 40 08             	mov    0x8(%eax),%eax
+  80250a:	c1 e8 09             	shr    $0x9,%eax
+  80250d:	83 e0 08             	and    $0x8,%eax
+}
+  802510:	c9                   	leave
+  802511:	c3                   	ret
+		return 0;
+  802512:	b8 00 00 00 00       	mov    $0x0,%eax
+  802517:	eb f7                	jmp    802510 <sock_flags+0x23>
+
+00802519 <alloc_sockfd>:
+{
+  802519:	55                   	push   %ebp
+  80251a:	89 e5                	mov    %esp,%ebp
+  80251c:	56                   	push   %esi
+  80251d:	53                   	push   %ebx
+  80251e:	83 ec 1c             	sub    $0x1c,%esp
+  802521:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802523:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802526:	50                   	push   %eax
+  802527:	e8 5c f5 ff ff       	call   801a88 <fd_alloc>
+  80252c:	89 c3                	mov    %eax,%ebx
+  80252e:	83 c4 10             	add    $0x10,%esp
+  802531:	85 c0                	test   %eax,%eax
+  802533:	78 43                	js     802578 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802535:	83 ec 04             	sub    $0x4,%esp
+  802538:	68 07 04 00 00       	push   $0x407
+  80253d:	ff 75 f4             	push   -0xc(%ebp)
+  802540:	6a 00                	push   $0x0
+  802542:	e8 3b e9 ff ff       	call   800e82 <sys_page_alloc>
+  802547:	89 c3                	mov    %eax,%ebx
+  802549:	83 c4 10             	add    $0x10,%esp
+  80254c:	85 c0                	test   %eax,%eax
+  80254e:	78 28                	js     802578 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802550:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802553:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802559:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80255b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80255e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802565:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802568:	83 ec 0c             	sub    $0xc,%esp
+  80256b:	50                   	push   %eax
+  80256c:	e8 f0 f4 ff ff       	call   801a61 <fd2num>
+  802571:	89 c3                	mov    %eax,%ebx
+  802573:	83 c4 10             	add    $0x10,%esp
+  802576:	eb 0c                	jmp    802584 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802578:	83 ec 0c             	sub    $0xc,%esp
+  80257b:	56                   	push   %esi
+  80257c:	e8 4b 04 00 00       	call   8029cc <nsipc_close>
+		return r;
+  802581:	83 c4 10             	add    $0x10,%esp
+}
+  802584:	89 d8                	mov    %ebx,%eax
+  802586:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802589:	5b                   	pop    %ebx
+  80258a:	5e                   	pop    %esi
+  80258b:	5d                   	pop    %ebp
+  80258c:	c3                   	ret
+
+0080258d <accept>:
+{
+  80258d:	55                   	push   %ebp
+  80258e:	89 e5                	mov    %esp,%ebp
+  802590:	56                   	push   %esi
+  802591:	53                   	push   %ebx
+  802592:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802595:	89 f0                	mov    %esi,%eax
+  802597:	e8 21 ff ff ff       	call   8024bd <fd2sockid>
+  80259c:	89 c3                	mov    %eax,%ebx
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	78 24                	js     8025c6 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8025a2:	89 f0                	mov    %esi,%eax
+  8025a4:	e8 44 ff ff ff       	call   8024ed <sock_flags>
+  8025a9:	50                   	push   %eax
+  8025aa:	ff 75 10             	push   0x10(%ebp)
+  8025ad:	ff 75 0c             	push   0xc(%ebp)
+  8025b0:	53                   	push   %ebx
+  8025b1:	e8 6b 03 00 00       	call   802921 <nsipc_accept>
+  8025b6:	89 c3                	mov    %eax,%ebx
+  8025b8:	83 c4 10             	add    $0x10,%esp
+  8025bb:	85 c0                	test   %eax,%eax
+  8025bd:	78 07                	js     8025c6 <accept+0x39>
+	return alloc_sockfd(r);
+  8025bf:	e8 55 ff ff ff       	call   802519 <alloc_sockfd>
+  8025c4:	89 c3                	mov    %eax,%ebx
+}
+  8025c6:	89 d8                	mov    %ebx,%eax
+  8025c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025cb:	5b                   	pop    %ebx
+  8025cc:	5e                   	pop    %esi
+  8025cd:	5d                   	pop    %ebp
+  8025ce:	c3                   	ret
+
+008025cf <bind>:
+{
+  8025cf:	55                   	push   %ebp
+  8025d0:	89 e5                	mov    %esp,%ebp
+  8025d2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d8:	e8 e0 fe ff ff       	call   8024bd <fd2sockid>
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	78 12                	js     8025f3 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8025e1:	83 ec 04             	sub    $0x4,%esp
+  8025e4:	ff 75 10             	push   0x10(%ebp)
+  8025e7:	ff 75 0c             	push   0xc(%ebp)
+  8025ea:	50                   	push   %eax
+  8025eb:	e8 85 03 00 00       	call   802975 <nsipc_bind>
+  8025f0:	83 c4 10             	add    $0x10,%esp
+}
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+008025f5 <shutdown>:
+{
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8025fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fe:	e8 ba fe ff ff       	call   8024bd <fd2sockid>
+  802603:	85 c0                	test   %eax,%eax
+  802605:	78 0f                	js     802616 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802607:	83 ec 08             	sub    $0x8,%esp
+  80260a:	ff 75 0c             	push   0xc(%ebp)
+  80260d:	50                   	push   %eax
+  80260e:	e8 97 03 00 00       	call   8029aa <nsipc_shutdown>
+  802613:	83 c4 10             	add    $0x10,%esp
+}
+  802616:	c9                   	leave
+  802617:	c3                   	ret
+
+00802618 <connect>:
+{
+  802618:	55                   	push   %ebp
+  802619:	89 e5                	mov    %esp,%ebp
+  80261b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80261e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802621:	e8 97 fe ff ff       	call   8024bd <fd2sockid>
+  802626:	85 c0                	test   %eax,%eax
+  802628:	78 12                	js     80263c <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  80262a:	83 ec 04             	sub    $0x4,%esp
+  80262d:	ff 75 10             	push   0x10(%ebp)
+  802630:	ff 75 0c             	push   0xc(%ebp)
+  802633:	50                   	push   %eax
+  802634:	e8 ad 03 00 00       	call   8029e6 <nsipc_connect>
+  802639:	83 c4 10             	add    $0x10,%esp
+}
+  80263c:	c9                   	leave
+  80263d:	c3                   	ret
+
+0080263e <listen>:
+{
+  80263e:	55                   	push   %ebp
+  80263f:	89 e5                	mov    %esp,%ebp
+  802641:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802644:	8b 45 08             	mov    0x8(%ebp),%eax
+  802647:	e8 71 fe ff ff       	call   8024bd <fd2sockid>
+  80264c:	85 c0                	test   %eax,%eax
+  80264e:	78 0f                	js     80265f <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802650:	83 ec 08             	sub    $0x8,%esp
+  802653:	ff 75 0c             	push   0xc(%ebp)
+  802656:	50                   	push   %eax
+  802657:	e8 bf 03 00 00       	call   802a1b <nsipc_listen>
+  80265c:	83 c4 10             	add    $0x10,%esp
+}
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+
+00802661 <sendmsg>:
+{
+  802661:	55                   	push   %ebp
+  802662:	89 e5                	mov    %esp,%ebp
+  802664:	57                   	push   %edi
+  802665:	56                   	push   %esi
+  802666:	53                   	push   %ebx
+  802667:	83 ec 0c             	sub    $0xc,%esp
+  80266a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80266d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802670:	89 f0                	mov    %esi,%eax
+  802672:	e8 46 fe ff ff       	call   8024bd <fd2sockid>
+  802677:	89 c3                	mov    %eax,%ebx
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	78 1c                	js     802699 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80267d:	89 f0                	mov    %esi,%eax
+  80267f:	e8 69 fe ff ff       	call   8024ed <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802684:	0b 45 10             	or     0x10(%ebp),%eax
+  802687:	50                   	push   %eax
+  802688:	ff 77 0c             	push   0xc(%edi)
+  80268b:	ff 77 08             	push   0x8(%edi)
+  80268e:	53                   	push   %ebx
+  80268f:	e8 7c 04 00 00       	call   802b10 <nsipc_sendmsg>
+  802694:	89 c3                	mov    %eax,%ebx
+  802696:	83 c4 10             	add    $0x10,%esp
+}
+  802699:	89 d8                	mov    %ebx,%eax
+  80269b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269e:	5b                   	pop    %ebx
+  80269f:	5e                   	pop    %esi
+  8026a0:	5f                   	pop    %edi
+  8026a1:	5d                   	pop    %ebp
+  8026a2:	c3                   	ret
+
+008026a3 <recvmsg>:
+{
+  8026a3:	55                   	push   %ebp
+  8026a4:	89 e5                	mov    %esp,%ebp
+  8026a6:	57                   	push   %edi
+  8026a7:	56                   	push   %esi
+  8026a8:	53                   	push   %ebx
+  8026a9:	83 ec 0c             	sub    $0xc,%esp
+  8026ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026af:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8026b2:	89 f8                	mov    %edi,%eax
+  8026b4:	e8 04 fe ff ff       	call   8024bd <fd2sockid>
+  8026b9:	89 c3                	mov    %eax,%ebx
+  8026bb:	85 c0                	test   %eax,%eax
+  8026bd:	78 2a                	js     8026e9 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8026bf:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8026c6:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  8026cd:	89 f8                	mov    %edi,%eax
+  8026cf:	e8 19 fe ff ff       	call   8024ed <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8026d4:	0b 45 10             	or     0x10(%ebp),%eax
+  8026d7:	50                   	push   %eax
+  8026d8:	ff 76 0c             	push   0xc(%esi)
+  8026db:	ff 76 08             	push   0x8(%esi)
+  8026de:	53                   	push   %ebx
+  8026df:	e8 d6 07 00 00       	call   802eba <nsipc_recvmsg>
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	83 c4 10             	add    $0x10,%esp
+}
+  8026e9:	89 d8                	mov    %ebx,%eax
+  8026eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ee:	5b                   	pop    %ebx
+  8026ef:	5e                   	pop    %esi
+  8026f0:	5f                   	pop    %edi
+  8026f1:	5d                   	pop    %ebp
+  8026f2:	c3                   	ret
+
+008026f3 <sendfile>:
+{
+  8026f3:	55                   	push   %ebp
+  8026f4:	89 e5                	mov    %esp,%ebp
+  8026f6:	56                   	push   %esi
+  8026f7:	53                   	push   %ebx
+  8026f8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8026fb:	89 f0                	mov    %esi,%eax
+  8026fd:	e8 bb fd ff ff       	call   8024bd <fd2sockid>
+  802702:	89 c3                	mov    %eax,%ebx
+  802704:	85 c0                	test   %eax,%eax
+  802706:	78 1f                	js     802727 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802708:	89 f0                	mov    %esi,%eax
+  80270a:	e8 de fd ff ff       	call   8024ed <sock_flags>
+  80270f:	83 ec 0c             	sub    $0xc,%esp
+  802712:	50                   	push   %eax
+  802713:	ff 75 14             	push   0x14(%ebp)
+  802716:	ff 75 10             	push   0x10(%ebp)
+  802719:	ff 75 0c             	push   0xc(%ebp)
+  80271c:	53                   	push   %ebx
+  80271d:	e8 64 06 00 00       	call   802d86 <nsipc_sendfile>
+  802722:	89 c3                	mov    %eax,%ebx
+  802724:	83 c4 20             	add    $0x20,%esp
+}
+  802727:	89 d8                	mov    %ebx,%eax
+  802729:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80272c:	5b                   	pop    %ebx
+  80272d:	5e                   	pop    %esi
+  80272e:	5d                   	pop    %ebp
+  80272f:	c3                   	ret
+
+00802730 <evctl>:
+{
+  802730:	55                   	push   %ebp
+  802731:	89 e5                	mov    %esp,%ebp
+  802733:	53                   	push   %ebx
+  802734:	83 ec 04             	sub    $0x4,%esp
+  802737:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  80273a:	89 d8                	mov    %ebx,%eax
+  80273c:	e8 7c fd ff ff       	call   8024bd <fd2sockid>
+  802741:	85 c0                	test   %eax,%eax
+  802743:	78 10                	js     802755 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802745:	83 ec 04             	sub    $0x4,%esp
+  802748:	53                   	push   %ebx
+  802749:	ff 75 0c             	push   0xc(%ebp)
+  80274c:	50                   	push   %eax
+  80274d:	e8 d2 0b 00 00       	call   803324 <nsipc_evctl>
+  802752:	83 c4 10             	add    $0x10,%esp
+}
+  802755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802758:	c9                   	leave
+  802759:	c3                   	ret
+
+0080275a <evwait>:
+{
+  80275a:	55                   	push   %ebp
+  80275b:	89 e5                	mov    %esp,%ebp
+  80275d:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802760:	ff 75 10             	push   0x10(%ebp)
+  802763:	ff 75 0c             	push   0xc(%ebp)
+  802766:	ff 75 08             	push   0x8(%ebp)
+  802769:	e8 e0 0b 00 00       	call   80334e <nsipc_evwait>
+}
+  80276e:	c9                   	leave
+  80276f:	c3                   	ret
+
+00802770 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802770:	55                   	push   %ebp
+  802771:	89 e5                	mov    %esp,%ebp
+  802773:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802776:	ff 75 10             	push   0x10(%ebp)
+  802779:	ff 75 0c             	push   0xc(%ebp)
+  80277c:	ff 75 08             	push   0x8(%ebp)
+  80277f:	e8 31 0c 00 00       	call   8033b5 <nsipc_socket>
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 05                	js     802790 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80278b:	e8 89 fd ff ff       	call   802519 <alloc_sockfd>
+}
+  802790:	c9                   	leave
+  802791:	c3                   	ret
+
+00802792 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802792:	55                   	push   %ebp
+  802793:	89 e5                	mov    %esp,%ebp
+  802795:	53                   	push   %ebx
+  802796:	83 ec 04             	sub    $0x4,%esp
+  802799:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80279b:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  8027a2:	74 26                	je     8027ca <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8027a4:	6a 07                	push   $0x7
+  8027a6:	68 00 80 80 00       	push   $0x808000
+  8027ab:	53                   	push   %ebx
+  8027ac:	ff 35 e4 69 80 00    	push   0x8069e4
+  8027b2:	e8 f9 1a 00 00       	call   8042b0 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8027b7:	83 c4 0c             	add    $0xc,%esp
+  8027ba:	6a 00                	push   $0x0
+  8027bc:	6a 00                	push   $0x0
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 5b 18 00 00       	call   804020 <ipc_recv>
+}
+  8027c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c8:	c9                   	leave
+  8027c9:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8027ca:	83 ec 0c             	sub    $0xc,%esp
+  8027cd:	6a 03                	push   $0x3
+  8027cf:	e8 45 1b 00 00       	call   804319 <ipc_find_env>
+  8027d4:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	eb c6                	jmp    8027a4 <nsipc+0x12>
+
+008027de <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  8027de:	55                   	push   %ebp
+  8027df:	89 e5                	mov    %esp,%ebp
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8027e3:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  8027e9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8027ee:	85 f6                	test   %esi,%esi
+  8027f0:	75 33                	jne    802825 <nsbulk_map+0x47>
+  8027f2:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8027f7:	83 ec 04             	sub    $0x4,%esp
+  8027fa:	6a 07                	push   $0x7
+  8027fc:	53                   	push   %ebx
+  8027fd:	6a 00                	push   $0x0
+  8027ff:	e8 7e e6 ff ff       	call   800e82 <sys_page_alloc>
+  802804:	83 c4 10             	add    $0x10,%esp
+  802807:	85 c0                	test   %eax,%eax
+  802809:	78 1a                	js     802825 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80280b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802811:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802817:	75 de                	jne    8027f7 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802819:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802820:	00 00 00 
+	return 0;
+  802823:	89 f0                	mov    %esi,%eax
+}
+  802825:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802828:	5b                   	pop    %ebx
+  802829:	5e                   	pop    %esi
+  80282a:	5d                   	pop    %ebp
+  80282b:	c3                   	ret
+
+0080282c <nsbulk_own>:
+{
+  80282c:	55                   	push   %ebp
+  80282d:	89 e5                	mov    %esp,%ebp
+  80282f:	57                   	push   %edi
+  802830:	56                   	push   %esi
+  802831:	53                   	push   %ebx
+  802832:	83 ec 0c             	sub    $0xc,%esp
+  802835:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802837:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  80283a:	85 d2                	test   %edx,%edx
+  80283c:	7f 0e                	jg     80284c <nsbulk_own+0x20>
+	return 0;
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802843:	eb 47                	jmp    80288c <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802845:	83 c3 01             	add    $0x1,%ebx
+  802848:	39 fb                	cmp    %edi,%ebx
+  80284a:	7d 3b                	jge    802887 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80284c:	be 01 00 00 00       	mov    $0x1,%esi
+  802851:	89 d9                	mov    %ebx,%ecx
+  802853:	d3 e6                	shl    %cl,%esi
+  802855:	89 f0                	mov    %esi,%eax
+  802857:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  80285d:	74 e6                	je     802845 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  80285f:	83 ec 04             	sub    $0x4,%esp
+  802862:	6a 07                	push   $0x7
+  802864:	89 d8                	mov    %ebx,%eax
+  802866:	c1 e0 0c             	shl    $0xc,%eax
+  802869:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80286e:	50                   	push   %eax
+  80286f:	6a 00                	push   $0x0
+  802871:	e8 0c e6 ff ff       	call   800e82 <sys_page_alloc>
+  802876:	83 c4 10             	add    $0x10,%esp
+  802879:	85 c0                	test   %eax,%eax
+  80287b:	78 0f                	js     80288c <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80287d:	f7 d6                	not    %esi
+  80287f:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802885:	eb be                	jmp    802845 <nsbulk_own+0x19>
+	return 0;
+  802887:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5f                   	pop    %edi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+
+00802894 <nsipc_bulk>:
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	57                   	push   %edi
+  802898:	56                   	push   %esi
+  802899:	53                   	push   %ebx
+  80289a:	83 ec 1c             	sub    $0x1c,%esp
+  80289d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028a0:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8028a2:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8028a8:	c1 fb 0c             	sar    $0xc,%ebx
+  8028ab:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8028ae:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  8028b5:	74 56                	je     80290d <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8028b7:	85 ff                	test   %edi,%edi
+  8028b9:	7e 24                	jle    8028df <nsipc_bulk+0x4b>
+  8028bb:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8028c1:	74 1c                	je     8028df <nsipc_bulk+0x4b>
+  8028c3:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8028c9:	c1 e3 0c             	shl    $0xc,%ebx
+  8028cc:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  8028d1:	0f b6 10             	movzbl (%eax),%edx
+  8028d4:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8028d6:	05 00 10 00 00       	add    $0x1000,%eax
+  8028db:	39 d8                	cmp    %ebx,%eax
+  8028dd:	75 f2                	jne    8028d1 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8028df:	83 ec 0c             	sub    $0xc,%esp
+  8028e2:	56                   	push   %esi
+  8028e3:	57                   	push   %edi
+  8028e4:	68 00 00 00 e0       	push   $0xe0000000
+  8028e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8028ec:	ff 35 e4 69 80 00    	push   0x8069e4
+  8028f2:	e8 ed 19 00 00       	call   8042e4 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8028f7:	83 c4 1c             	add    $0x1c,%esp
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	6a 00                	push   $0x0
+  8028fe:	6a 00                	push   $0x0
+  802900:	e8 1b 17 00 00       	call   804020 <ipc_recv>
+}
+  802905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802908:	5b                   	pop    %ebx
+  802909:	5e                   	pop    %esi
+  80290a:	5f                   	pop    %edi
+  80290b:	5d                   	pop    %ebp
+  80290c:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80290d:	83 ec 0c             	sub    $0xc,%esp
+  802910:	6a 03                	push   $0x3
+  802912:	e8 02 1a 00 00       	call   804319 <ipc_find_env>
+  802917:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80291c:	83 c4 10             	add    $0x10,%esp
+  80291f:	eb 96                	jmp    8028b7 <nsipc_bulk+0x23>
+
+00802921 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802921:	55                   	push   %ebp
+  802922:	89 e5                	mov    %esp,%ebp
+  802924:	53                   	push   %ebx
+  802925:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802930:	8b 45 14             	mov    0x14(%ebp),%eax
+  802933:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802938:	b8 01 00 00 00       	mov    $0x1,%eax
+  80293d:	e8 50 fe ff ff       	call   802792 <nsipc>
+  802942:	89 c3                	mov    %eax,%ebx
+  802944:	85 c0                	test   %eax,%eax
+  802946:	79 07                	jns    80294f <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802948:	89 d8                	mov    %ebx,%eax
+  80294a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80294d:	c9                   	leave
+  80294e:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80294f:	83 ec 04             	sub    $0x4,%esp
+  802952:	ff 35 10 80 80 00    	push   0x808010
+  802958:	68 00 80 80 00       	push   $0x808000
+  80295d:	ff 75 0c             	push   0xc(%ebp)
+  802960:	e8 99 e2 ff ff       	call   800bfe <memmove>
+		*addrlen = ret->ret_addrlen;
+  802965:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80296b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80296e:	89 10                	mov    %edx,(%eax)
+  802970:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802973:	eb d3                	jmp    802948 <nsipc_accept+0x27>
+
+00802975 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802975:	55                   	push   %ebp
+  802976:	89 e5                	mov    %esp,%ebp
+  802978:	53                   	push   %ebx
+  802979:	83 ec 08             	sub    $0x8,%esp
+  80297c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  80297f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802982:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802987:	53                   	push   %ebx
+  802988:	ff 75 0c             	push   0xc(%ebp)
+  80298b:	68 04 80 80 00       	push   $0x808004
+  802990:	e8 69 e2 ff ff       	call   800bfe <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802995:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80299b:	b8 02 00 00 00       	mov    $0x2,%eax
+  8029a0:	e8 ed fd ff ff       	call   802792 <nsipc>
+}
+  8029a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a8:	c9                   	leave
+  8029a9:	c3                   	ret
+
+008029aa <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029aa:	55                   	push   %ebp
+  8029ab:	89 e5                	mov    %esp,%ebp
+  8029ad:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029b3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8029b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029bb:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8029c0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029c5:	e8 c8 fd ff ff       	call   802792 <nsipc>
+}
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+
+008029cc <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029cc:	55                   	push   %ebp
+  8029cd:	89 e5                	mov    %esp,%ebp
+  8029cf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029d5:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8029da:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029df:	e8 ae fd ff ff       	call   802792 <nsipc>
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+008029e6 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029e6:	55                   	push   %ebp
+  8029e7:	89 e5                	mov    %esp,%ebp
+  8029e9:	53                   	push   %ebx
+  8029ea:	83 ec 08             	sub    $0x8,%esp
+  8029ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8029f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029f3:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029f8:	53                   	push   %ebx
+  8029f9:	ff 75 0c             	push   0xc(%ebp)
+  8029fc:	68 04 80 80 00       	push   $0x808004
+  802a01:	e8 f8 e1 ff ff       	call   800bfe <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802a06:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a0c:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a11:	e8 7c fd ff ff       	call   802792 <nsipc>
+}
+  802a16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a19:	c9                   	leave
+  802a1a:	c3                   	ret
+
+00802a1b <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a1b:	55                   	push   %ebp
+  802a1c:	89 e5                	mov    %esp,%ebp
+  802a1e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a21:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a24:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a29:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a2c:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a31:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a36:	e8 57 fd ff ff       	call   802792 <nsipc>
+}
+  802a3b:	c9                   	leave
+  802a3c:	c3                   	ret
+
+00802a3d <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	56                   	push   %esi
+  802a41:	53                   	push   %ebx
+  802a42:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a48:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a4d:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a53:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a56:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a5b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a60:	e8 2d fd ff ff       	call   802792 <nsipc>
+  802a65:	89 c3                	mov    %eax,%ebx
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 22                	js     802a8d <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a6b:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a70:	39 c6                	cmp    %eax,%esi
+  802a72:	0f 4e c6             	cmovle %esi,%eax
+  802a75:	39 c3                	cmp    %eax,%ebx
+  802a77:	7f 1d                	jg     802a96 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a79:	83 ec 04             	sub    $0x4,%esp
+  802a7c:	53                   	push   %ebx
+  802a7d:	68 00 80 80 00       	push   $0x808000
+  802a82:	ff 75 0c             	push   0xc(%ebp)
+  802a85:	e8 74 e1 ff ff       	call   800bfe <memmove>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a8d:	89 d8                	mov    %ebx,%eax
+  802a8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a92:	5b                   	pop    %ebx
+  802a93:	5e                   	pop    %esi
+  802a94:	5d                   	pop    %ebp
+  802a95:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a96:	68 6c 4b 80 00       	push   $0x804b6c
+  802a9b:	68 81 4b 80 00       	push   $0x804b81
+  802aa0:	68 b2 00 00 00       	push   $0xb2
+  802aa5:	68 96 4b 80 00       	push   $0x804b96
+  802aaa:	e8 cd d7 ff ff       	call   80027c <_panic>
+
+00802aaf <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802aaf:	55                   	push   %ebp
+  802ab0:	89 e5                	mov    %esp,%ebp
+  802ab2:	53                   	push   %ebx
+  802ab3:	83 ec 04             	sub    $0x4,%esp
+  802ab6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abc:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ac1:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802ac7:	7f 2e                	jg     802af7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802ac9:	83 ec 04             	sub    $0x4,%esp
+  802acc:	53                   	push   %ebx
+  802acd:	ff 75 0c             	push   0xc(%ebp)
+  802ad0:	68 0c 80 80 00       	push   $0x80800c
+  802ad5:	e8 24 e1 ff ff       	call   800bfe <memmove>
+	nsipcbuf.send.req_size = size;
+  802ada:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802ae0:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ae3:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802ae8:	b8 08 00 00 00       	mov    $0x8,%eax
+  802aed:	e8 a0 fc ff ff       	call   802792 <nsipc>
+}
+  802af2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802af5:	c9                   	leave
+  802af6:	c3                   	ret
+	assert(size < 1600);
+  802af7:	68 a2 4b 80 00       	push   $0x804ba2
+  802afc:	68 81 4b 80 00       	push   $0x804b81
+  802b01:	68 bd 00 00 00       	push   $0xbd
+  802b06:	68 96 4b 80 00       	push   $0x804b96
+  802b0b:	e8 6c d7 ff ff       	call   80027c <_panic>
+
+00802b10 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802b10:	55                   	push   %ebp
+  802b11:	89 e5                	mov    %esp,%ebp
+  802b13:	57                   	push   %edi
+  802b14:	56                   	push   %esi
+  802b15:	53                   	push   %ebx
+  802b16:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802b19:	e8 c0 fc ff ff       	call   8027de <nsbulk_map>
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	78 55                	js     802b77 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802b22:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802b29:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802b30:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802b37:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802b3a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802b3d:	0f 8d 24 02 00 00    	jge    802d67 <nsipc_sendmsg+0x257>
+  802b43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b46:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802b49:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802b4c:	89 d8                	mov    %ebx,%eax
+  802b4e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802b53:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802b55:	83 ec 0c             	sub    $0xc,%esp
+  802b58:	68 e0 66 80 00       	push   $0x8066e0
+  802b5d:	e8 5a 0f 00 00       	call   803abc <pgbatch_init>
+  802b62:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802b65:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802b67:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802b6a:	e9 82 00 00 00       	jmp    802bf1 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802b6f:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802b72:	85 db                	test   %ebx,%ebx
+  802b74:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802b77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7a:	5b                   	pop    %ebx
+  802b7b:	5e                   	pop    %esi
+  802b7c:	5f                   	pop    %edi
+  802b7d:	5d                   	pop    %ebp
+  802b7e:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802b7f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802b84:	29 c8                	sub    %ecx,%eax
+  802b86:	39 d0                	cmp    %edx,%eax
+  802b88:	0f 46 d0             	cmovbe %eax,%edx
+  802b8b:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802b8d:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802b93:	85 ff                	test   %edi,%edi
+  802b95:	0f 49 c7             	cmovns %edi,%eax
+  802b98:	c1 f8 0c             	sar    $0xc,%eax
+  802b9b:	ba 01 00 00 00       	mov    $0x1,%edx
+  802ba0:	e8 87 fc ff ff       	call   80282c <nsbulk_own>
+  802ba5:	85 c0                	test   %eax,%eax
+  802ba7:	0f 88 17 01 00 00    	js     802cc4 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802bad:	83 ec 04             	sub    $0x4,%esp
+  802bb0:	56                   	push   %esi
+  802bb1:	ff 75 e0             	push   -0x20(%ebp)
+  802bb4:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802bb7:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802bbc:	50                   	push   %eax
+  802bbd:	e8 3c e0 ff ff       	call   800bfe <memmove>
+  802bc2:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802bc5:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802bc8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bcb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802bce:	0f 84 fd 00 00 00    	je     802cd1 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802bd4:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802bd7:	01 f7                	add    %esi,%edi
+  802bd9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802bdc:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802bdf:	0f 8d 01 01 00 00    	jge    802ce6 <nsipc_sendmsg+0x1d6>
+  802be5:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802beb:	0f 8f f0 00 00 00    	jg     802ce1 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bf4:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802bf7:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802bfa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bfd:	89 c2                	mov    %eax,%edx
+  802bff:	03 13                	add    (%ebx),%edx
+  802c01:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802c04:	8b 73 04             	mov    0x4(%ebx),%esi
+  802c07:	29 c6                	sub    %eax,%esi
+  802c09:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802c0e:	29 f9                	sub    %edi,%ecx
+  802c10:	39 ce                	cmp    %ecx,%esi
+  802c12:	89 ca                	mov    %ecx,%edx
+  802c14:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802c17:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802c1a:	89 f9                	mov    %edi,%ecx
+  802c1c:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802c22:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c25:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c2a:	09 c8                	or     %ecx,%eax
+  802c2c:	0f 85 4d ff ff ff    	jne    802b7f <nsipc_sendmsg+0x6f>
+  802c32:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802c38:	0f 86 41 ff ff ff    	jbe    802b7f <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802c3e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802c44:	85 ff                	test   %edi,%edi
+  802c46:	0f 49 c7             	cmovns %edi,%eax
+  802c49:	c1 f8 0c             	sar    $0xc,%eax
+  802c4c:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802c4e:	89 d1                	mov    %edx,%ecx
+  802c50:	c1 e9 0c             	shr    $0xc,%ecx
+  802c53:	01 c8                	add    %ecx,%eax
+  802c55:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802c58:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c5b:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802c5d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802c60:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802c65:	29 c8                	sub    %ecx,%eax
+  802c67:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802c6a:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802c6d:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802c6f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c74:	89 f9                	mov    %edi,%ecx
+  802c76:	d3 e0                	shl    %cl,%eax
+  802c78:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802c7e:	83 ec 08             	sub    $0x8,%esp
+  802c81:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802c83:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802c86:	50                   	push   %eax
+  802c87:	6a 00                	push   $0x0
+  802c89:	56                   	push   %esi
+  802c8a:	6a 00                	push   $0x0
+  802c8c:	68 e0 66 80 00       	push   $0x8066e0
+  802c91:	e8 e4 0e 00 00       	call   803b7a <pgbatch_map>
+  802c96:	83 c4 20             	add    $0x20,%esp
+  802c99:	85 c0                	test   %eax,%eax
+  802c9b:	0f 88 ce fe ff ff    	js     802b6f <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802ca1:	83 c7 01             	add    $0x1,%edi
+  802ca4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802caa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802cad:	39 c7                	cmp    %eax,%edi
+  802caf:	75 be                	jne    802c6f <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802cb1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802cb4:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802cb7:	89 d6                	mov    %edx,%esi
+  802cb9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802cbf:	e9 01 ff ff ff       	jmp    802bc5 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802cc4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802cc7:	85 db                	test   %ebx,%ebx
+  802cc9:	0f 45 c3             	cmovne %ebx,%eax
+  802ccc:	e9 a6 fe ff ff       	jmp    802b77 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802cd1:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802cd5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802cdc:	e9 f3 fe ff ff       	jmp    802bd4 <nsipc_sendmsg+0xc4>
+  802ce1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802ce4:	eb 03                	jmp    802ce9 <nsipc_sendmsg+0x1d9>
+  802ce6:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802ce9:	83 ec 0c             	sub    $0xc,%esp
+  802cec:	68 e0 66 80 00       	push   $0x8066e0
+  802cf1:	e8 d4 0d 00 00       	call   803aca <pgbatch_flush>
+  802cf6:	83 c4 10             	add    $0x10,%esp
+  802cf9:	85 c0                	test   %eax,%eax
+  802cfb:	78 50                	js     802d4d <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d00:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802d05:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802d0b:	89 fb                	mov    %edi,%ebx
+  802d0d:	29 f3                	sub    %esi,%ebx
+  802d0f:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802d15:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d18:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802d1d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802d22:	89 fa                	mov    %edi,%edx
+  802d24:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802d29:	e8 66 fb ff ff       	call   802894 <nsipc_bulk>
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	78 28                	js     802d5a <nsipc_sendmsg+0x24a>
+		sent += r;
+  802d32:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802d35:	39 c3                	cmp    %eax,%ebx
+  802d37:	75 0c                	jne    802d45 <nsipc_sendmsg+0x235>
+  802d39:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d3c:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802d3f:	0f 8f f2 fd ff ff    	jg     802b37 <nsipc_sendmsg+0x27>
+		sent += r;
+  802d45:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802d48:	e9 2a fe ff ff       	jmp    802b77 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802d4d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d50:	85 db                	test   %ebx,%ebx
+  802d52:	0f 45 c3             	cmovne %ebx,%eax
+  802d55:	e9 1d fe ff ff       	jmp    802b77 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802d5a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802d5d:	85 db                	test   %ebx,%ebx
+  802d5f:	0f 45 c3             	cmovne %ebx,%eax
+  802d62:	e9 10 fe ff ff       	jmp    802b77 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802d67:	83 ec 0c             	sub    $0xc,%esp
+  802d6a:	68 e0 66 80 00       	push   $0x8066e0
+  802d6f:	e8 48 0d 00 00       	call   803abc <pgbatch_init>
+  802d74:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802d77:	be 00 00 00 00       	mov    $0x0,%esi
+  802d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d81:	e9 63 ff ff ff       	jmp    802ce9 <nsipc_sendmsg+0x1d9>
+
+00802d86 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802d86:	55                   	push   %ebp
+  802d87:	89 e5                	mov    %esp,%ebp
+  802d89:	57                   	push   %edi
+  802d8a:	56                   	push   %esi
+  802d8b:	53                   	push   %ebx
+  802d8c:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802d8f:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802d96:	0f 84 c8 00 00 00    	je     802e64 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802d9c:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802da3:	0f 84 e4 00 00 00    	je     802e8d <nsipc_sendfile+0x107>
+{
+  802da9:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802dae:	89 fb                	mov    %edi,%ebx
+  802db0:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802db3:	0f 83 f0 00 00 00    	jae    802ea9 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802db9:	89 fa                	mov    %edi,%edx
+  802dbb:	03 55 10             	add    0x10(%ebp),%edx
+  802dbe:	89 d0                	mov    %edx,%eax
+  802dc0:	c1 f8 1f             	sar    $0x1f,%eax
+  802dc3:	c1 e8 14             	shr    $0x14,%eax
+  802dc6:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802dc9:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802dcf:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802dd1:	6a 10                	push   $0x10
+  802dd3:	68 00 20 01 e0       	push   $0xe0012000
+  802dd8:	52                   	push   %edx
+  802dd9:	ff 75 0c             	push   0xc(%ebp)
+  802ddc:	e8 fe f4 ff ff       	call   8022df <fmap>
+  802de1:	83 c4 10             	add    $0x10,%esp
+  802de4:	85 c0                	test   %eax,%eax
+  802de6:	0f 8e b8 00 00 00    	jle    802ea4 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802dec:	39 c6                	cmp    %eax,%esi
+  802dee:	0f 8d b5 00 00 00    	jge    802ea9 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802df4:	29 f0                	sub    %esi,%eax
+  802df6:	8b 55 14             	mov    0x14(%ebp),%edx
+  802df9:	29 da                	sub    %ebx,%edx
+  802dfb:	39 d0                	cmp    %edx,%eax
+  802dfd:	89 d3                	mov    %edx,%ebx
+  802dff:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802e02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e05:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802e0a:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802e10:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802e16:	8b 45 18             	mov    0x18(%ebp),%eax
+  802e19:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802e1e:	83 ec 0c             	sub    $0xc,%esp
+  802e21:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802e23:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802e2a:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802e2d:	83 c0 01             	add    $0x1,%eax
+  802e30:	50                   	push   %eax
+  802e31:	68 00 10 01 e0       	push   $0xe0011000
+  802e36:	6a 11                	push   $0x11
+  802e38:	ff 35 e4 69 80 00    	push   0x8069e4
+  802e3e:	e8 a1 14 00 00       	call   8042e4 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802e43:	83 c4 1c             	add    $0x1c,%esp
+  802e46:	6a 00                	push   $0x0
+  802e48:	6a 00                	push   $0x0
+  802e4a:	6a 00                	push   $0x0
+  802e4c:	e8 cf 11 00 00       	call   804020 <ipc_recv>
+  802e51:	83 c4 10             	add    $0x10,%esp
+  802e54:	85 c0                	test   %eax,%eax
+  802e56:	78 5b                	js     802eb3 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802e58:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802e5a:	39 c3                	cmp    %eax,%ebx
+  802e5c:	0f 8e 4c ff ff ff    	jle    802dae <nsipc_sendfile+0x28>
+  802e62:	eb 45                	jmp    802ea9 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802e64:	83 ec 04             	sub    $0x4,%esp
+  802e67:	6a 07                	push   $0x7
+  802e69:	68 00 10 01 e0       	push   $0xe0011000
+  802e6e:	6a 00                	push   $0x0
+  802e70:	e8 0d e0 ff ff       	call   800e82 <sys_page_alloc>
+  802e75:	89 c7                	mov    %eax,%edi
+  802e77:	83 c4 10             	add    $0x10,%esp
+  802e7a:	85 c0                	test   %eax,%eax
+  802e7c:	78 2b                	js     802ea9 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802e7e:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802e85:	00 00 00 
+  802e88:	e9 0f ff ff ff       	jmp    802d9c <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e8d:	83 ec 0c             	sub    $0xc,%esp
+  802e90:	6a 03                	push   $0x3
+  802e92:	e8 82 14 00 00       	call   804319 <ipc_find_env>
+  802e97:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802e9c:	83 c4 10             	add    $0x10,%esp
+  802e9f:	e9 05 ff ff ff       	jmp    802da9 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802ea4:	85 ff                	test   %edi,%edi
+  802ea6:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802ea9:	89 f8                	mov    %edi,%eax
+  802eab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eae:	5b                   	pop    %ebx
+  802eaf:	5e                   	pop    %esi
+  802eb0:	5f                   	pop    %edi
+  802eb1:	5d                   	pop    %ebp
+  802eb2:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802eb3:	85 ff                	test   %edi,%edi
+  802eb5:	0f 44 f8             	cmove  %eax,%edi
+  802eb8:	eb ef                	jmp    802ea9 <nsipc_sendfile+0x123>
+
+00802eba <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	57                   	push   %edi
+  802ebe:	56                   	push   %esi
+  802ebf:	53                   	push   %ebx
+  802ec0:	83 ec 1c             	sub    $0x1c,%esp
+  802ec3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802ec6:	e8 13 f9 ff ff       	call   8027de <nsbulk_map>
+  802ecb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	0f 88 ba 00 00 00    	js     802f90 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802ed6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802eda:	0f 8e bb 00 00 00    	jle    802f9b <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802ee0:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802eea:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802eef:	89 f8                	mov    %edi,%eax
+  802ef1:	29 f0                	sub    %esi,%eax
+  802ef3:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802ef7:	39 c8                	cmp    %ecx,%eax
+  802ef9:	0f 47 c1             	cmova  %ecx,%eax
+  802efc:	01 f0                	add    %esi,%eax
+  802efe:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802f00:	83 c2 01             	add    $0x1,%edx
+  802f03:	39 55 10             	cmp    %edx,0x10(%ebp)
+  802f06:	7e 07                	jle    802f0f <nsipc_recvmsg+0x55>
+  802f08:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802f0d:	7e e0                	jle    802eef <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802f0f:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802f15:	c1 fa 0c             	sar    $0xc,%edx
+  802f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1d:	e8 0a f9 ff ff       	call   80282c <nsbulk_own>
+  802f22:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f25:	85 c0                	test   %eax,%eax
+  802f27:	78 67                	js     802f90 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  802f29:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f2c:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802f31:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  802f37:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f3a:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  802f3f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  802f44:	89 f2                	mov    %esi,%edx
+  802f46:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802f4b:	e8 44 f9 ff ff       	call   802894 <nsipc_bulk>
+  802f50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	78 39                	js     802f90 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802f57:	39 f0                	cmp    %esi,%eax
+  802f59:	7f 4a                	jg     802fa5 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802f5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	7e 2c                	jle    802f90 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802f64:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802f67:	29 fe                	sub    %edi,%esi
+  802f69:	8b 43 04             	mov    0x4(%ebx),%eax
+  802f6c:	39 c6                	cmp    %eax,%esi
+  802f6e:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802f71:	83 ec 04             	sub    $0x4,%esp
+  802f74:	56                   	push   %esi
+  802f75:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802f7b:	50                   	push   %eax
+  802f7c:	ff 33                	push   (%ebx)
+  802f7e:	e8 7b dc ff ff       	call   800bfe <memmove>
+		n += m;
+  802f83:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802f85:	83 c3 08             	add    $0x8,%ebx
+  802f88:	83 c4 10             	add    $0x10,%esp
+  802f8b:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802f8e:	7f d4                	jg     802f64 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802f90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f96:	5b                   	pop    %ebx
+  802f97:	5e                   	pop    %esi
+  802f98:	5f                   	pop    %edi
+  802f99:	5d                   	pop    %ebp
+  802f9a:	c3                   	ret
+	int r, i, n, len = 0;
+  802f9b:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa0:	e9 6a ff ff ff       	jmp    802f0f <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802fa5:	68 78 4b 80 00       	push   $0x804b78
+  802faa:	68 81 4b 80 00       	push   $0x804b81
+  802faf:	68 3b 01 00 00       	push   $0x13b
+  802fb4:	68 96 4b 80 00       	push   $0x804b96
+  802fb9:	e8 be d2 ff ff       	call   80027c <_panic>
+
+00802fbe <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802fbe:	55                   	push   %ebp
+  802fbf:	89 e5                	mov    %esp,%ebp
+  802fc1:	57                   	push   %edi
+  802fc2:	56                   	push   %esi
+  802fc3:	53                   	push   %ebx
+  802fc4:	83 ec 0c             	sub    $0xc,%esp
+  802fc7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802fca:	8b 75 10             	mov    0x10(%ebp),%esi
+  802fcd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd3:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802fd8:	8b 07                	mov    (%edi),%eax
+  802fda:	a3 04 80 80 00       	mov    %eax,0x808004
+  802fdf:	8b 47 04             	mov    0x4(%edi),%eax
+  802fe2:	a3 08 80 80 00       	mov    %eax,0x808008
+  802fe7:	8b 47 08             	mov    0x8(%edi),%eax
+  802fea:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802fef:	8b 47 0c             	mov    0xc(%edi),%eax
+  802ff2:	a3 10 80 80 00       	mov    %eax,0x808010
+  802ff7:	8b 47 10             	mov    0x10(%edi),%eax
+  802ffa:	a3 14 80 80 00       	mov    %eax,0x808014
+  802fff:	8b 47 14             	mov    0x14(%edi),%eax
+  803002:	a3 18 80 80 00       	mov    %eax,0x808018
+  803007:	8b 47 18             	mov    0x18(%edi),%eax
+  80300a:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80300f:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803012:	a3 20 80 80 00       	mov    %eax,0x808020
+  803017:	8b 47 20             	mov    0x20(%edi),%eax
+  80301a:	a3 24 80 80 00       	mov    %eax,0x808024
+  80301f:	8b 47 24             	mov    0x24(%edi),%eax
+  803022:	a3 28 80 80 00       	mov    %eax,0x808028
+  803027:	8b 47 28             	mov    0x28(%edi),%eax
+  80302a:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80302f:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803032:	a3 30 80 80 00       	mov    %eax,0x808030
+  803037:	8b 47 30             	mov    0x30(%edi),%eax
+  80303a:	a3 34 80 80 00       	mov    %eax,0x808034
+  80303f:	8b 47 34             	mov    0x34(%edi),%eax
+  803042:	a3 38 80 80 00       	mov    %eax,0x808038
+  803047:	8b 47 38             	mov    0x38(%edi),%eax
+  80304a:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80304f:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803052:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803057:	8b 06                	mov    (%esi),%eax
+  803059:	a3 44 80 80 00       	mov    %eax,0x808044
+  80305e:	8b 46 04             	mov    0x4(%esi),%eax
+  803061:	a3 48 80 80 00       	mov    %eax,0x808048
+  803066:	8b 46 08             	mov    0x8(%esi),%eax
+  803069:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  80306e:	8b 46 0c             	mov    0xc(%esi),%eax
+  803071:	a3 50 80 80 00       	mov    %eax,0x808050
+  803076:	8b 46 10             	mov    0x10(%esi),%eax
+  803079:	a3 54 80 80 00       	mov    %eax,0x808054
+  80307e:	8b 46 14             	mov    0x14(%esi),%eax
+  803081:	a3 58 80 80 00       	mov    %eax,0x808058
+  803086:	8b 46 18             	mov    0x18(%esi),%eax
+  803089:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  80308e:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803091:	a3 60 80 80 00       	mov    %eax,0x808060
+  803096:	8b 46 20             	mov    0x20(%esi),%eax
+  803099:	a3 64 80 80 00       	mov    %eax,0x808064
+  80309e:	8b 46 24             	mov    0x24(%esi),%eax
+  8030a1:	a3 68 80 80 00       	mov    %eax,0x808068
+  8030a6:	8b 46 28             	mov    0x28(%esi),%eax
+  8030a9:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8030ae:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8030b1:	a3 70 80 80 00       	mov    %eax,0x808070
+  8030b6:	8b 46 30             	mov    0x30(%esi),%eax
+  8030b9:	a3 74 80 80 00       	mov    %eax,0x808074
+  8030be:	8b 46 34             	mov    0x34(%esi),%eax
+  8030c1:	a3 78 80 80 00       	mov    %eax,0x808078
+  8030c6:	8b 46 38             	mov    0x38(%esi),%eax
+  8030c9:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8030ce:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8030d1:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8030d6:	8b 03                	mov    (%ebx),%eax
+  8030d8:	a3 84 80 80 00       	mov    %eax,0x808084
+  8030dd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030e0:	a3 88 80 80 00       	mov    %eax,0x808088
+  8030e5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030e8:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8030ed:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030f0:	a3 90 80 80 00       	mov    %eax,0x808090
+  8030f5:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030f8:	a3 94 80 80 00       	mov    %eax,0x808094
+  8030fd:	8b 43 14             	mov    0x14(%ebx),%eax
+  803100:	a3 98 80 80 00       	mov    %eax,0x808098
+  803105:	8b 43 18             	mov    0x18(%ebx),%eax
+  803108:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  80310d:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803110:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803115:	8b 43 20             	mov    0x20(%ebx),%eax
+  803118:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  80311d:	8b 43 24             	mov    0x24(%ebx),%eax
+  803120:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803125:	8b 43 28             	mov    0x28(%ebx),%eax
+  803128:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  80312d:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803130:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803135:	8b 43 30             	mov    0x30(%ebx),%eax
+  803138:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  80313d:	8b 43 34             	mov    0x34(%ebx),%eax
+  803140:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  803145:	8b 43 38             	mov    0x38(%ebx),%eax
+  803148:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  80314d:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803150:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  803155:	8b 45 18             	mov    0x18(%ebp),%eax
+  803158:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80315d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803162:	e8 2b f6 ff ff       	call   802792 <nsipc>
+  803167:	85 c0                	test   %eax,%eax
+  803169:	0f 88 ad 01 00 00    	js     80331c <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80316f:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803175:	89 17                	mov    %edx,(%edi)
+  803177:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80317d:	89 57 04             	mov    %edx,0x4(%edi)
+  803180:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803186:	89 57 08             	mov    %edx,0x8(%edi)
+  803189:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80318f:	89 57 0c             	mov    %edx,0xc(%edi)
+  803192:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803198:	89 57 10             	mov    %edx,0x10(%edi)
+  80319b:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8031a1:	89 57 14             	mov    %edx,0x14(%edi)
+  8031a4:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8031aa:	89 57 18             	mov    %edx,0x18(%edi)
+  8031ad:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8031b3:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8031b6:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8031bc:	89 57 20             	mov    %edx,0x20(%edi)
+  8031bf:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8031c5:	89 57 24             	mov    %edx,0x24(%edi)
+  8031c8:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8031ce:	89 57 28             	mov    %edx,0x28(%edi)
+  8031d1:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8031d7:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8031da:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8031e0:	89 57 30             	mov    %edx,0x30(%edi)
+  8031e3:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8031e9:	89 57 34             	mov    %edx,0x34(%edi)
+  8031ec:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8031f2:	89 57 38             	mov    %edx,0x38(%edi)
+  8031f5:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8031fb:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8031fe:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  803204:	89 16                	mov    %edx,(%esi)
+  803206:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  80320c:	89 56 04             	mov    %edx,0x4(%esi)
+  80320f:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803215:	89 56 08             	mov    %edx,0x8(%esi)
+  803218:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  80321e:	89 56 0c             	mov    %edx,0xc(%esi)
+  803221:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803227:	89 56 10             	mov    %edx,0x10(%esi)
+  80322a:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803230:	89 56 14             	mov    %edx,0x14(%esi)
+  803233:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803239:	89 56 18             	mov    %edx,0x18(%esi)
+  80323c:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803242:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803245:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  80324b:	89 56 20             	mov    %edx,0x20(%esi)
+  80324e:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  803254:	89 56 24             	mov    %edx,0x24(%esi)
+  803257:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  80325d:	89 56 28             	mov    %edx,0x28(%esi)
+  803260:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803266:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803269:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80326f:	89 56 30             	mov    %edx,0x30(%esi)
+  803272:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803278:	89 56 34             	mov    %edx,0x34(%esi)
+  80327b:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  803281:	89 56 38             	mov    %edx,0x38(%esi)
+  803284:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  80328a:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80328d:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  803293:	89 13                	mov    %edx,(%ebx)
+  803295:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  80329b:	89 53 04             	mov    %edx,0x4(%ebx)
+  80329e:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8032a4:	89 53 08             	mov    %edx,0x8(%ebx)
+  8032a7:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8032ad:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8032b0:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8032b6:	89 53 10             	mov    %edx,0x10(%ebx)
+  8032b9:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8032bf:	89 53 14             	mov    %edx,0x14(%ebx)
+  8032c2:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8032c8:	89 53 18             	mov    %edx,0x18(%ebx)
+  8032cb:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8032d1:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8032d4:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8032da:	89 53 20             	mov    %edx,0x20(%ebx)
+  8032dd:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8032e3:	89 53 24             	mov    %edx,0x24(%ebx)
+  8032e6:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8032ec:	89 53 28             	mov    %edx,0x28(%ebx)
+  8032ef:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8032f5:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8032f8:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8032fe:	89 53 30             	mov    %edx,0x30(%ebx)
+  803301:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803307:	89 53 34             	mov    %edx,0x34(%ebx)
+  80330a:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803310:	89 53 38             	mov    %edx,0x38(%ebx)
+  803313:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803319:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  80331c:	83 c4 0c             	add    $0xc,%esp
+  80331f:	5b                   	pop    %ebx
+  803320:	5e                   	pop    %esi
+  803321:	5f                   	pop    %edi
+  803322:	5d                   	pop    %ebp
+  803323:	c3                   	ret
+
+00803324 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803324:	55                   	push   %ebp
+  803325:	89 e5                	mov    %esp,%ebp
+  803327:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  80332a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803332:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803335:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  80333a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80333d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803342:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803347:	e8 46 f4 ff ff       	call   802792 <nsipc>
+}
+  80334c:	c9                   	leave
+  80334d:	c3                   	ret
+
+0080334e <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  80334e:	55                   	push   %ebp
+  80334f:	89 e5                	mov    %esp,%ebp
+  803351:	56                   	push   %esi
+  803352:	53                   	push   %ebx
+  803353:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803356:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80335c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80335f:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803364:	b8 10 00 00 00       	mov    $0x10,%eax
+  803369:	e8 24 f4 ff ff       	call   802792 <nsipc>
+  80336e:	89 c3                	mov    %eax,%ebx
+  803370:	85 c0                	test   %eax,%eax
+  803372:	7e 1f                	jle    803393 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803374:	39 c6                	cmp    %eax,%esi
+  803376:	7c 24                	jl     80339c <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803378:	83 ec 04             	sub    $0x4,%esp
+  80337b:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803382:	50                   	push   %eax
+  803383:	68 00 80 80 00       	push   $0x808000
+  803388:	ff 75 08             	push   0x8(%ebp)
+  80338b:	e8 6e d8 ff ff       	call   800bfe <memmove>
+  803390:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803393:	89 d8                	mov    %ebx,%eax
+  803395:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803398:	5b                   	pop    %ebx
+  803399:	5e                   	pop    %esi
+  80339a:	5d                   	pop    %ebp
+  80339b:	c3                   	ret
+		assert(r <= max);
+  80339c:	68 ae 4b 80 00       	push   $0x804bae
+  8033a1:	68 81 4b 80 00       	push   $0x804b81
+  8033a6:	68 6a 01 00 00       	push   $0x16a
+  8033ab:	68 96 4b 80 00       	push   $0x804b96
+  8033b0:	e8 c7 ce ff ff       	call   80027c <_panic>
+
+008033b5 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8033b5:	55                   	push   %ebp
+  8033b6:	89 e5                	mov    %esp,%ebp
+  8033b8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8033bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033be:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8033c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033c6:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8033cb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033ce:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8033d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8033d8:	e8 b5 f3 ff ff       	call   802792 <nsipc>
+}
+  8033dd:	c9                   	leave
+  8033de:	c3                   	ret
+
+008033df <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8033df:	55                   	push   %ebp
+  8033e0:	89 e5                	mov    %esp,%ebp
+  8033e2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8033e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e8:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8033ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8033f2:	e8 9b f3 ff ff       	call   802792 <nsipc>
+}
+  8033f7:	c9                   	leave
+  8033f8:	c3                   	ret
+
+008033f9 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8033f9:	55                   	push   %ebp
+  8033fa:	89 e5                	mov    %esp,%ebp
+  8033fc:	53                   	push   %ebx
+  8033fd:	83 ec 04             	sub    $0x4,%esp
+  803400:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803403:	b8 12 00 00 00       	mov    $0x12,%eax
+  803408:	e8 85 f3 ff ff       	call   802792 <nsipc>
+  80340d:	85 c0                	test   %eax,%eax
+  80340f:	78 50                	js     803461 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803411:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803417:	89 13                	mov    %edx,(%ebx)
+  803419:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80341f:	89 53 04             	mov    %edx,0x4(%ebx)
+  803422:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803428:	89 53 08             	mov    %edx,0x8(%ebx)
+  80342b:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803431:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803434:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80343a:	89 53 10             	mov    %edx,0x10(%ebx)
+  80343d:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803443:	89 53 14             	mov    %edx,0x14(%ebx)
+  803446:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80344c:	89 53 18             	mov    %edx,0x18(%ebx)
+  80344f:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803455:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803458:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  80345e:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803461:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803464:	c9                   	leave
+  803465:	c3                   	ret
+
+00803466 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803466:	55                   	push   %ebp
+  803467:	89 e5                	mov    %esp,%ebp
+  803469:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80346c:	6a 03                	push   $0x3
+  80346e:	e8 a6 0e 00 00       	call   804319 <ipc_find_env>
+  803473:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80347b:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803480:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803485:	e8 08 f3 ff ff       	call   802792 <nsipc>
+  80348a:	83 c4 10             	add    $0x10,%esp
+  80348d:	85 c0                	test   %eax,%eax
+  80348f:	78 0a                	js     80349b <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803491:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80349b:	c9                   	leave
+  80349c:	c3                   	ret
+
+0080349d <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80349d:	55                   	push   %ebp
+  80349e:	89 e5                	mov    %esp,%ebp
+  8034a0:	57                   	push   %edi
+  8034a1:	56                   	push   %esi
+  8034a2:	53                   	push   %ebx
+  8034a3:	83 ec 1c             	sub    $0x1c,%esp
+  8034a6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8034a9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8034ac:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8034b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034b6:	89 e0                	mov    %esp,%eax
+  8034b8:	89 f2                	mov    %esi,%edx
+  8034ba:	29 c2                	sub    %eax,%edx
+  8034bc:	89 d0                	mov    %edx,%eax
+  8034be:	c1 e8 0f             	shr    $0xf,%eax
+  8034c1:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8034c7:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  8034ca:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8034d1:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  8034d4:	83 ec 0c             	sub    $0xc,%esp
+  8034d7:	ff 75 e0             	push   -0x20(%ebp)
+  8034da:	e8 79 0e 00 00       	call   804358 <pageref>
+  8034df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034e2:	83 c4 04             	add    $0x4,%esp
+  8034e5:	ff 75 dc             	push   -0x24(%ebp)
+  8034e8:	e8 6b 0e 00 00       	call   804358 <pageref>
+  8034ed:	89 e2                	mov    %esp,%edx
+  8034ef:	89 f1                	mov    %esi,%ecx
+  8034f1:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8034f3:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8034f6:	89 ca                	mov    %ecx,%edx
+  8034f8:	c1 ea 0f             	shr    $0xf,%edx
+  8034fb:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803501:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803504:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  80350b:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  80350e:	39 d7                	cmp    %edx,%edi
+  803510:	74 40                	je     803552 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803512:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803515:	75 9f                	jne    8034b6 <_pipeisclosed+0x19>
+  803517:	89 e2                	mov    %esp,%edx
+  803519:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80351e:	29 d0                	sub    %edx,%eax
+  803520:	89 c2                	mov    %eax,%edx
+  803522:	c1 ea 0f             	shr    $0xf,%edx
+  803525:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80352a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352f:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803532:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803539:	8b 40 58             	mov    0x58(%eax),%eax
+  80353c:	6a 01                	push   $0x1
+  80353e:	50                   	push   %eax
+  80353f:	57                   	push   %edi
+  803540:	68 b7 4b 80 00       	push   $0x804bb7
+  803545:	e8 0d ce ff ff       	call   800357 <cprintf>
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	e9 5f ff ff ff       	jmp    8034b1 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803552:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803555:	0f 94 c0             	sete   %al
+  803558:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80355b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80355e:	5b                   	pop    %ebx
+  80355f:	5e                   	pop    %esi
+  803560:	5f                   	pop    %edi
+  803561:	5d                   	pop    %ebp
+  803562:	c3                   	ret
+
+00803563 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803563:	55                   	push   %ebp
+  803564:	89 e5                	mov    %esp,%ebp
+  803566:	53                   	push   %ebx
+  803567:	83 ec 0c             	sub    $0xc,%esp
+  80356a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80356d:	53                   	push   %ebx
+  80356e:	6a 00                	push   $0x0
+  803570:	e8 92 d9 ff ff       	call   800f07 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803575:	89 1c 24             	mov    %ebx,(%esp)
+  803578:	e8 f4 e4 ff ff       	call   801a71 <fd2data>
+  80357d:	83 c4 08             	add    $0x8,%esp
+  803580:	50                   	push   %eax
+  803581:	6a 00                	push   $0x0
+  803583:	e8 7f d9 ff ff       	call   800f07 <sys_page_unmap>
+}
+  803588:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80358b:	c9                   	leave
+  80358c:	c3                   	ret
+
+0080358d <devpipe_read>:
+{
+  80358d:	55                   	push   %ebp
+  80358e:	89 e5                	mov    %esp,%ebp
+  803590:	57                   	push   %edi
+  803591:	56                   	push   %esi
+  803592:	53                   	push   %ebx
+  803593:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803596:	ff 75 08             	push   0x8(%ebp)
+  803599:	e8 d3 e4 ff ff       	call   801a71 <fd2data>
+  80359e:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8035a0:	8b 70 04             	mov    0x4(%eax),%esi
+  8035a3:	8b 00                	mov    (%eax),%eax
+  8035a5:	83 c4 10             	add    $0x10,%esp
+  8035a8:	39 f0                	cmp    %esi,%eax
+  8035aa:	75 36                	jne    8035e2 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8035ac:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8035af:	89 da                	mov    %ebx,%edx
+  8035b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b4:	e8 e4 fe ff ff       	call   80349d <_pipeisclosed>
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	0f 85 d4 00 00 00    	jne    803695 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8035c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035c6:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  8035ca:	83 ec 04             	sub    $0x4,%esp
+  8035cd:	6a ff                	push   $0xffffffff
+  8035cf:	56                   	push   %esi
+  8035d0:	57                   	push   %edi
+  8035d1:	e8 aa dc ff ff       	call   801280 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8035d6:	8b 73 04             	mov    0x4(%ebx),%esi
+  8035d9:	8b 03                	mov    (%ebx),%eax
+  8035db:	83 c4 10             	add    $0x10,%esp
+  8035de:	39 c6                	cmp    %eax,%esi
+  8035e0:	74 cd                	je     8035af <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8035e2:	8b 73 04             	mov    0x4(%ebx),%esi
+  8035e5:	8b 03                	mov    (%ebx),%eax
+  8035e7:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8035ed:	29 c6                	sub    %eax,%esi
+  8035ef:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8035f4:	f7 e6                	mul    %esi
+  8035f6:	c1 ea 0c             	shr    $0xc,%edx
+  8035f9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8035ff:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803601:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803604:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803608:	8b 0b                	mov    (%ebx),%ecx
+  80360a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80360f:	f7 e1                	mul    %ecx
+  803611:	c1 ea 0b             	shr    $0xb,%edx
+  803614:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80361a:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  80361c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803621:	29 cf                	sub    %ecx,%edi
+  803623:	39 f7                	cmp    %esi,%edi
+  803625:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803628:	83 ec 04             	sub    $0x4,%esp
+  80362b:	57                   	push   %edi
+  80362c:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803630:	50                   	push   %eax
+  803631:	ff 75 0c             	push   0xc(%ebp)
+  803634:	e8 c5 d5 ff ff       	call   800bfe <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803639:	83 c4 0c             	add    $0xc,%esp
+  80363c:	89 f0                	mov    %esi,%eax
+  80363e:	29 f8                	sub    %edi,%eax
+  803640:	50                   	push   %eax
+  803641:	8d 43 10             	lea    0x10(%ebx),%eax
+  803644:	50                   	push   %eax
+  803645:	89 f8                	mov    %edi,%eax
+  803647:	03 45 0c             	add    0xc(%ebp),%eax
+  80364a:	50                   	push   %eax
+  80364b:	e8 ae d5 ff ff       	call   800bfe <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803650:	8b 0b                	mov    (%ebx),%ecx
+  803652:	01 f1                	add    %esi,%ecx
+  803654:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803659:	f7 e1                	mul    %ecx
+  80365b:	c1 ea 0c             	shr    $0xc,%edx
+  80365e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803664:	29 c1                	sub    %eax,%ecx
+  803666:	89 0b                	mov    %ecx,(%ebx)
+  803668:	b8 00 00 00 00       	mov    $0x0,%eax
+  80366d:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803671:	83 c4 10             	add    $0x10,%esp
+  803674:	85 c0                	test   %eax,%eax
+  803676:	75 0a                	jne    803682 <devpipe_read+0xf5>
+	return n;
+  803678:	89 f0                	mov    %esi,%eax
+}
+  80367a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80367d:	5b                   	pop    %ebx
+  80367e:	5e                   	pop    %esi
+  80367f:	5f                   	pop    %edi
+  803680:	5d                   	pop    %ebp
+  803681:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803682:	83 ec 08             	sub    $0x8,%esp
+  803685:	68 00 04 00 00       	push   $0x400
+  80368a:	53                   	push   %ebx
+  80368b:	e8 12 dc ff ff       	call   8012a2 <sys_futex_wake>
+  803690:	83 c4 10             	add    $0x10,%esp
+  803693:	eb e3                	jmp    803678 <devpipe_read+0xeb>
+			return 0;
+  803695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369a:	eb de                	jmp    80367a <devpipe_read+0xed>
+
+0080369c <devpipe_write>:
+{
+  80369c:	55                   	push   %ebp
+  80369d:	89 e5                	mov    %esp,%ebp
+  80369f:	57                   	push   %edi
+  8036a0:	56                   	push   %esi
+  8036a1:	53                   	push   %ebx
+  8036a2:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8036a5:	ff 75 08             	push   0x8(%ebp)
+  8036a8:	e8 c4 e3 ff ff       	call   801a71 <fd2data>
+  8036ad:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8036af:	83 c4 10             	add    $0x10,%esp
+  8036b2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036b9:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8036be:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036c2:	0f 84 43 01 00 00    	je     80380b <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8036c8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8036cb:	8b 06                	mov    (%esi),%eax
+  8036cd:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8036d3:	29 c1                	sub    %eax,%ecx
+  8036d5:	89 c8                	mov    %ecx,%eax
+  8036d7:	f7 e7                	mul    %edi
+  8036d9:	c1 ea 0c             	shr    $0xc,%edx
+  8036dc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8036e2:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8036e4:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8036ea:	75 52                	jne    80373e <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  8036ec:	89 f2                	mov    %esi,%edx
+  8036ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036f1:	e8 a7 fd ff ff       	call   80349d <_pipeisclosed>
+  8036f6:	85 c0                	test   %eax,%eax
+  8036f8:	0f 85 28 01 00 00    	jne    803826 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8036fe:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803700:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803703:	8b 06                	mov    (%esi),%eax
+  803705:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80370b:	29 c1                	sub    %eax,%ecx
+  80370d:	89 c8                	mov    %ecx,%eax
+  80370f:	f7 e7                	mul    %edi
+  803711:	c1 ea 0c             	shr    $0xc,%edx
+  803714:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80371a:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  80371c:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803722:	75 a4                	jne    8036c8 <devpipe_write+0x2c>
+  803724:	b8 01 00 00 00       	mov    $0x1,%eax
+  803729:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  80372d:	83 ec 04             	sub    $0x4,%esp
+  803730:	6a ff                	push   $0xffffffff
+  803732:	53                   	push   %ebx
+  803733:	56                   	push   %esi
+  803734:	e8 47 db ff ff       	call   801280 <sys_futex_wait>
+}
+  803739:	83 c4 10             	add    $0x10,%esp
+  80373c:	eb 8a                	jmp    8036c8 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80373e:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803741:	8b 06                	mov    (%esi),%eax
+  803743:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803749:	29 c1                	sub    %eax,%ecx
+  80374b:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803750:	f7 e1                	mul    %ecx
+  803752:	c1 ea 0c             	shr    $0xc,%edx
+  803755:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80375b:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80375d:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803762:	89 d8                	mov    %ebx,%eax
+  803764:	29 c8                	sub    %ecx,%eax
+  803766:	8b 55 10             	mov    0x10(%ebp),%edx
+  803769:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80376c:	29 ca                	sub    %ecx,%edx
+  80376e:	39 d0                	cmp    %edx,%eax
+  803770:	0f 46 d0             	cmovbe %eax,%edx
+  803773:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803776:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803779:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80377e:	f7 e1                	mul    %ecx
+  803780:	c1 ea 0b             	shr    $0xb,%edx
+  803783:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803789:	89 ca                	mov    %ecx,%edx
+  80378b:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80378d:	29 d3                	sub    %edx,%ebx
+  80378f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803792:	39 c3                	cmp    %eax,%ebx
+  803794:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803797:	83 ec 04             	sub    $0x4,%esp
+  80379a:	53                   	push   %ebx
+  80379b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80379e:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8037a1:	51                   	push   %ecx
+  8037a2:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8037a6:	50                   	push   %eax
+  8037a7:	e8 52 d4 ff ff       	call   800bfe <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8037ac:	83 c4 0c             	add    $0xc,%esp
+  8037af:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8037b2:	29 d8                	sub    %ebx,%eax
+  8037b4:	50                   	push   %eax
+  8037b5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8037b8:	01 cb                	add    %ecx,%ebx
+  8037ba:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8037bd:	53                   	push   %ebx
+  8037be:	8d 46 10             	lea    0x10(%esi),%eax
+  8037c1:	50                   	push   %eax
+  8037c2:	e8 37 d4 ff ff       	call   800bfe <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8037c7:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8037ca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8037cd:	01 c1                	add    %eax,%ecx
+  8037cf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8037d4:	f7 e1                	mul    %ecx
+  8037d6:	c1 ea 0c             	shr    $0xc,%edx
+  8037d9:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8037df:	89 ca                	mov    %ecx,%edx
+  8037e1:	29 c2                	sub    %eax,%edx
+  8037e3:	89 56 04             	mov    %edx,0x4(%esi)
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8037ef:	83 c4 10             	add    $0x10,%esp
+  8037f2:	85 c0                	test   %eax,%eax
+  8037f4:	75 1a                	jne    803810 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8037f6:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8037f9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8037fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037ff:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803802:	0f 82 c0 fe ff ff    	jb     8036c8 <devpipe_write+0x2c>
+  803808:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80380b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80380e:	eb 1b                	jmp    80382b <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803810:	83 ec 08             	sub    $0x8,%esp
+  803813:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803818:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  80381b:	50                   	push   %eax
+  80381c:	e8 81 da ff ff       	call   8012a2 <sys_futex_wake>
+  803821:	83 c4 10             	add    $0x10,%esp
+  803824:	eb d0                	jmp    8037f6 <devpipe_write+0x15a>
+				return 0;
+  803826:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80382b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382e:	5b                   	pop    %ebx
+  80382f:	5e                   	pop    %esi
+  803830:	5f                   	pop    %edi
+  803831:	5d                   	pop    %ebp
+  803832:	c3                   	ret
+
+00803833 <devpipe_stat>:
+{
+  803833:	55                   	push   %ebp
+  803834:	89 e5                	mov    %esp,%ebp
+  803836:	56                   	push   %esi
+  803837:	53                   	push   %ebx
+  803838:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80383b:	83 ec 0c             	sub    $0xc,%esp
+  80383e:	ff 75 08             	push   0x8(%ebp)
+  803841:	e8 2b e2 ff ff       	call   801a71 <fd2data>
+  803846:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803848:	83 c4 08             	add    $0x8,%esp
+  80384b:	68 ca 4b 80 00       	push   $0x804bca
+  803850:	53                   	push   %ebx
+  803851:	e8 f8 d1 ff ff       	call   800a4e <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803856:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803859:	8b 06                	mov    (%esi),%eax
+  80385b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803861:	29 c1                	sub    %eax,%ecx
+  803863:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803868:	89 c8                	mov    %ecx,%eax
+  80386a:	f7 e2                	mul    %edx
+  80386c:	c1 ea 0c             	shr    $0xc,%edx
+  80386f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803875:	29 d1                	sub    %edx,%ecx
+  803877:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80387d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803884:	00 00 00 
+	stat->st_dev = &devpipe;
+  803887:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  80388e:	50 80 00 
+}
+  803891:	b8 00 00 00 00       	mov    $0x0,%eax
+  803896:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803899:	5b                   	pop    %ebx
+  80389a:	5e                   	pop    %esi
+  80389b:	5d                   	pop    %ebp
+  80389c:	c3                   	ret
+
+0080389d <devpipe_poll>:
+{
+  80389d:	55                   	push   %ebp
+  80389e:	89 e5                	mov    %esp,%ebp
+  8038a0:	57                   	push   %edi
+  8038a1:	56                   	push   %esi
+  8038a2:	53                   	push   %ebx
+  8038a3:	83 ec 18             	sub    $0x18,%esp
+  8038a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8038ac:	57                   	push   %edi
+  8038ad:	e8 bf e1 ff ff       	call   801a71 <fd2data>
+  8038b2:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8038b4:	83 c4 10             	add    $0x10,%esp
+  8038b7:	89 f3                	mov    %esi,%ebx
+  8038b9:	83 e3 01             	and    $0x1,%ebx
+  8038bc:	75 27                	jne    8038e5 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8038be:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8038c4:	75 48                	jne    80390e <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8038c6:	89 ca                	mov    %ecx,%edx
+  8038c8:	89 f8                	mov    %edi,%eax
+  8038ca:	e8 ce fb ff ff       	call   80349d <_pipeisclosed>
+  8038cf:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  8038d1:	89 d8                	mov    %ebx,%eax
+  8038d3:	83 c8 10             	or     $0x10,%eax
+  8038d6:	85 d2                	test   %edx,%edx
+  8038d8:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8038db:	89 d8                	mov    %ebx,%eax
+  8038dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038e0:	5b                   	pop    %ebx
+  8038e1:	5e                   	pop    %esi
+  8038e2:	5f                   	pop    %edi
+  8038e3:	5d                   	pop    %ebp
+  8038e4:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8038e5:	8b 58 04             	mov    0x4(%eax),%ebx
+  8038e8:	8b 00                	mov    (%eax),%eax
+  8038ea:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8038f0:	29 c3                	sub    %eax,%ebx
+  8038f2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8038f7:	89 d8                	mov    %ebx,%eax
+  8038f9:	f7 e2                	mul    %edx
+  8038fb:	c1 ea 0c             	shr    $0xc,%edx
+  8038fe:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803904:	39 d3                	cmp    %edx,%ebx
+  803906:	0f 95 c3             	setne  %bl
+  803909:	0f b6 db             	movzbl %bl,%ebx
+  80390c:	eb b0                	jmp    8038be <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80390e:	8b 71 04             	mov    0x4(%ecx),%esi
+  803911:	8b 01                	mov    (%ecx),%eax
+  803913:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803919:	29 c6                	sub    %eax,%esi
+  80391b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803920:	89 f0                	mov    %esi,%eax
+  803922:	f7 e2                	mul    %edx
+  803924:	c1 ea 0c             	shr    $0xc,%edx
+  803927:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80392d:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  80392f:	89 d8                	mov    %ebx,%eax
+  803931:	83 c8 04             	or     $0x4,%eax
+  803934:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80393a:	0f 42 d8             	cmovb  %eax,%ebx
+  80393d:	eb 87                	jmp    8038c6 <devpipe_poll+0x29>
+
+0080393f <pipe>:
+{
+  80393f:	55                   	push   %ebp
+  803940:	89 e5                	mov    %esp,%ebp
+  803942:	56                   	push   %esi
+  803943:	53                   	push   %ebx
+  803944:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803947:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80394a:	50                   	push   %eax
+  80394b:	e8 38 e1 ff ff       	call   801a88 <fd_alloc>
+  803950:	89 c3                	mov    %eax,%ebx
+  803952:	83 c4 10             	add    $0x10,%esp
+  803955:	85 c0                	test   %eax,%eax
+  803957:	0f 88 23 01 00 00    	js     803a80 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80395d:	83 ec 04             	sub    $0x4,%esp
+  803960:	68 07 04 00 00       	push   $0x407
+  803965:	ff 75 f4             	push   -0xc(%ebp)
+  803968:	6a 00                	push   $0x0
+  80396a:	e8 13 d5 ff ff       	call   800e82 <sys_page_alloc>
+  80396f:	89 c3                	mov    %eax,%ebx
+  803971:	83 c4 10             	add    $0x10,%esp
+  803974:	85 c0                	test   %eax,%eax
+  803976:	0f 88 04 01 00 00    	js     803a80 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80397c:	83 ec 0c             	sub    $0xc,%esp
+  80397f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803982:	50                   	push   %eax
+  803983:	e8 00 e1 ff ff       	call   801a88 <fd_alloc>
+  803988:	89 c3                	mov    %eax,%ebx
+  80398a:	83 c4 10             	add    $0x10,%esp
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	0f 88 db 00 00 00    	js     803a70 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803995:	83 ec 04             	sub    $0x4,%esp
+  803998:	68 07 04 00 00       	push   $0x407
+  80399d:	ff 75 f0             	push   -0x10(%ebp)
+  8039a0:	6a 00                	push   $0x0
+  8039a2:	e8 db d4 ff ff       	call   800e82 <sys_page_alloc>
+  8039a7:	89 c3                	mov    %eax,%ebx
+  8039a9:	83 c4 10             	add    $0x10,%esp
+  8039ac:	85 c0                	test   %eax,%eax
+  8039ae:	0f 88 bc 00 00 00    	js     803a70 <pipe+0x131>
+	va = fd2data(fd0);
+  8039b4:	83 ec 0c             	sub    $0xc,%esp
+  8039b7:	ff 75 f4             	push   -0xc(%ebp)
+  8039ba:	e8 b2 e0 ff ff       	call   801a71 <fd2data>
+  8039bf:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039c1:	83 c4 0c             	add    $0xc,%esp
+  8039c4:	68 07 04 00 00       	push   $0x407
+  8039c9:	50                   	push   %eax
+  8039ca:	6a 00                	push   $0x0
+  8039cc:	e8 b1 d4 ff ff       	call   800e82 <sys_page_alloc>
+  8039d1:	89 c3                	mov    %eax,%ebx
+  8039d3:	83 c4 10             	add    $0x10,%esp
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	0f 88 82 00 00 00    	js     803a60 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8039de:	83 ec 0c             	sub    $0xc,%esp
+  8039e1:	ff 75 f0             	push   -0x10(%ebp)
+  8039e4:	e8 88 e0 ff ff       	call   801a71 <fd2data>
+  8039e9:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8039f0:	50                   	push   %eax
+  8039f1:	6a 00                	push   $0x0
+  8039f3:	56                   	push   %esi
+  8039f4:	6a 00                	push   $0x0
+  8039f6:	e8 ca d4 ff ff       	call   800ec5 <sys_page_map>
+  8039fb:	89 c3                	mov    %eax,%ebx
+  8039fd:	83 c4 20             	add    $0x20,%esp
+  803a00:	85 c0                	test   %eax,%eax
+  803a02:	78 4e                	js     803a52 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803a04:	a1 60 50 80 00       	mov    0x805060,%eax
+  803a09:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a0c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803a0e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803a11:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803a18:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803a1b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803a1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803a20:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803a27:	83 ec 0c             	sub    $0xc,%esp
+  803a2a:	ff 75 f4             	push   -0xc(%ebp)
+  803a2d:	e8 2f e0 ff ff       	call   801a61 <fd2num>
+  803a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a35:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803a37:	83 c4 04             	add    $0x4,%esp
+  803a3a:	ff 75 f0             	push   -0x10(%ebp)
+  803a3d:	e8 1f e0 ff ff       	call   801a61 <fd2num>
+  803a42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803a45:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a50:	eb 2e                	jmp    803a80 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803a52:	83 ec 08             	sub    $0x8,%esp
+  803a55:	56                   	push   %esi
+  803a56:	6a 00                	push   $0x0
+  803a58:	e8 aa d4 ff ff       	call   800f07 <sys_page_unmap>
+  803a5d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803a60:	83 ec 08             	sub    $0x8,%esp
+  803a63:	ff 75 f0             	push   -0x10(%ebp)
+  803a66:	6a 00                	push   $0x0
+  803a68:	e8 9a d4 ff ff       	call   800f07 <sys_page_unmap>
+  803a6d:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803a70:	83 ec 08             	sub    $0x8,%esp
+  803a73:	ff 75 f4             	push   -0xc(%ebp)
+  803a76:	6a 00                	push   $0x0
+  803a78:	e8 8a d4 ff ff       	call   800f07 <sys_page_unmap>
+  803a7d:	83 c4 10             	add    $0x10,%esp
+}
+  803a80:	89 d8                	mov    %ebx,%eax
+  803a82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803a85:	5b                   	pop    %ebx
+  803a86:	5e                   	pop    %esi
+  803a87:	5d                   	pop    %ebp
+  803a88:	c3                   	ret
+
+00803a89 <pipeisclosed>:
+{
+  803a89:	55                   	push   %ebp
+  803a8a:	89 e5                	mov    %esp,%ebp
+  803a8c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a8f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a92:	50                   	push   %eax
+  803a93:	ff 75 08             	push   0x8(%ebp)
+  803a96:	e8 3d e0 ff ff       	call   801ad8 <fd_lookup>
+  803a9b:	83 c4 10             	add    $0x10,%esp
+  803a9e:	85 c0                	test   %eax,%eax
+  803aa0:	78 18                	js     803aba <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803aa2:	83 ec 0c             	sub    $0xc,%esp
+  803aa5:	ff 75 f4             	push   -0xc(%ebp)
+  803aa8:	e8 c4 df ff ff       	call   801a71 <fd2data>
+  803aad:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ab2:	e8 e6 f9 ff ff       	call   80349d <_pipeisclosed>
+  803ab7:	83 c4 10             	add    $0x10,%esp
+}
+  803aba:	c9                   	leave
+  803abb:	c3                   	ret
+
+00803abc <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803abc:	55                   	push   %ebp
+  803abd:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803abf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ac2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803ac8:	5d                   	pop    %ebp
+  803ac9:	c3                   	ret
+
+00803aca <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803aca:	55                   	push   %ebp
+  803acb:	89 e5                	mov    %esp,%ebp
+  803acd:	53                   	push   %ebx
+  803ace:	83 ec 04             	sub    $0x4,%esp
+  803ad1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803ad4:	8b 03                	mov    (%ebx),%eax
+  803ad6:	85 c0                	test   %eax,%eax
+  803ad8:	75 05                	jne    803adf <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803ada:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803add:	c9                   	leave
+  803ade:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803adf:	83 ec 08             	sub    $0x8,%esp
+  803ae2:	50                   	push   %eax
+  803ae3:	8d 43 04             	lea    0x4(%ebx),%eax
+  803ae6:	50                   	push   %eax
+  803ae7:	e8 6b d6 ff ff       	call   801157 <sys_page_batch>
+	pb->pb_n = 0;
+  803aec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803af2:	83 c4 10             	add    $0x10,%esp
+  803af5:	eb e3                	jmp    803ada <pgbatch_flush+0x10>
+
+00803af7 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803af7:	55                   	push   %ebp
+  803af8:	89 e5                	mov    %esp,%ebp
+  803afa:	56                   	push   %esi
+  803afb:	53                   	push   %ebx
+  803afc:	89 c3                	mov    %eax,%ebx
+  803afe:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803b00:	83 38 20             	cmpl   $0x20,(%eax)
+  803b03:	74 2c                	je     803b31 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803b05:	8b 03                	mov    (%ebx),%eax
+  803b07:	8d 50 01             	lea    0x1(%eax),%edx
+  803b0a:	89 13                	mov    %edx,(%ebx)
+  803b0c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803b0f:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803b13:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803b15:	83 ec 04             	sub    $0x4,%esp
+  803b18:	6a 18                	push   $0x18
+  803b1a:	6a 00                	push   $0x0
+  803b1c:	50                   	push   %eax
+  803b1d:	e8 a7 d0 ff ff       	call   800bc9 <memset>
+	return 0;
+  803b22:	83 c4 10             	add    $0x10,%esp
+  803b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b2d:	5b                   	pop    %ebx
+  803b2e:	5e                   	pop    %esi
+  803b2f:	5d                   	pop    %ebp
+  803b30:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803b31:	83 ec 0c             	sub    $0xc,%esp
+  803b34:	50                   	push   %eax
+  803b35:	e8 90 ff ff ff       	call   803aca <pgbatch_flush>
+  803b3a:	83 c4 10             	add    $0x10,%esp
+  803b3d:	85 c0                	test   %eax,%eax
+  803b3f:	79 c4                	jns    803b05 <pgbatch_slot+0xe>
+  803b41:	eb e7                	jmp    803b2a <pgbatch_slot+0x33>
+
+00803b43 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803b43:	55                   	push   %ebp
+  803b44:	89 e5                	mov    %esp,%ebp
+  803b46:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b49:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b4f:	e8 a3 ff ff ff       	call   803af7 <pgbatch_slot>
+  803b54:	85 c0                	test   %eax,%eax
+  803b56:	78 20                	js     803b78 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b5b:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803b61:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b64:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803b67:	8b 55 10             	mov    0x10(%ebp),%edx
+  803b6a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803b6d:	8b 55 14             	mov    0x14(%ebp),%edx
+  803b70:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b78:	c9                   	leave
+  803b79:	c3                   	ret
+
+00803b7a <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803b7a:	55                   	push   %ebp
+  803b7b:	89 e5                	mov    %esp,%ebp
+  803b7d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803b80:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803b83:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b86:	e8 6c ff ff ff       	call   803af7 <pgbatch_slot>
+  803b8b:	85 c0                	test   %eax,%eax
+  803b8d:	78 2c                	js     803bbb <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803b8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803b92:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803b98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803b9b:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803b9e:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ba1:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803ba4:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ba7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803baa:	8b 55 18             	mov    0x18(%ebp),%edx
+  803bad:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803bb0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803bb3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bbb:	c9                   	leave
+  803bbc:	c3                   	ret
+
+00803bbd <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803bbd:	55                   	push   %ebp
+  803bbe:	89 e5                	mov    %esp,%ebp
+  803bc0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803bc3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803bc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bc9:	e8 29 ff ff ff       	call   803af7 <pgbatch_slot>
+  803bce:	85 c0                	test   %eax,%eax
+  803bd0:	78 1a                	js     803bec <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803bd5:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803bdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803bde:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803be1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803be4:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803be7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bec:	c9                   	leave
+  803bed:	c3                   	ret
+
+00803bee <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803bee:	55                   	push   %ebp
+  803bef:	89 e5                	mov    %esp,%ebp
+  803bf1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803bf4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bfa:	e8 f8 fe ff ff       	call   803af7 <pgbatch_slot>
+  803bff:	85 c0                	test   %eax,%eax
+  803c01:	78 20                	js     803c23 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803c03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c06:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803c0c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c0f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803c12:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c15:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803c18:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c1b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c23:	c9                   	leave
+  803c24:	c3                   	ret
+
+00803c25 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803c25:	55                   	push   %ebp
+  803c26:	89 e5                	mov    %esp,%ebp
+  803c28:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803c2b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c31:	e8 c1 fe ff ff       	call   803af7 <pgbatch_slot>
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	78 26                	js     803c60 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803c3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c3d:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803c43:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803c46:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803c49:	8b 55 10             	mov    0x10(%ebp),%edx
+  803c4c:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803c4f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803c52:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803c55:	8b 55 18             	mov    0x18(%ebp),%edx
+  803c58:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c60:	c9                   	leave
+  803c61:	c3                   	ret
+
+00803c62 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803c62:	55                   	push   %ebp
+  803c63:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c68:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c6e:	5d                   	pop    %ebp
+  803c6f:	c3                   	ret
+
+00803c70 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803c70:	55                   	push   %ebp
+  803c71:	89 e5                	mov    %esp,%ebp
+  803c73:	56                   	push   %esi
+  803c74:	53                   	push   %ebx
+  803c75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c7d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803c82:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803c86:	85 c0                	test   %eax,%eax
+  803c88:	74 2f                	je     803cb9 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803c8a:	83 f8 02             	cmp    $0x2,%eax
+  803c8d:	74 0c                	je     803c9b <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803c8f:	b8 02 00 00 00       	mov    $0x2,%eax
+  803c94:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803c97:	85 c0                	test   %eax,%eax
+  803c99:	74 1e                	je     803cb9 <mutex_lock+0x49>
+  803c9b:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803ca0:	83 ec 04             	sub    $0x4,%esp
+  803ca3:	6a ff                	push   $0xffffffff
+  803ca5:	6a 02                	push   $0x2
+  803ca7:	53                   	push   %ebx
+  803ca8:	e8 d3 d5 ff ff       	call   801280 <sys_futex_wait>
+  803cad:	89 f0                	mov    %esi,%eax
+  803caf:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803cb2:	83 c4 10             	add    $0x10,%esp
+  803cb5:	85 c0                	test   %eax,%eax
+  803cb7:	75 e7                	jne    803ca0 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803cb9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cbc:	5b                   	pop    %ebx
+  803cbd:	5e                   	pop    %esi
+  803cbe:	5d                   	pop    %ebp
+  803cbf:	c3                   	ret
+
+00803cc0 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803cc0:	55                   	push   %ebp
+  803cc1:	89 e5                	mov    %esp,%ebp
+  803cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803cd0:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	0f 94 c0             	sete   %al
+  803cd9:	0f b6 c0             	movzbl %al,%eax
+}
+  803cdc:	5d                   	pop    %ebp
+  803cdd:	c3                   	ret
+
+00803cde <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803cde:	55                   	push   %ebp
+  803cdf:	89 e5                	mov    %esp,%ebp
+  803ce1:	83 ec 08             	sub    $0x8,%esp
+  803ce4:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803ce7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cec:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803cef:	83 f8 02             	cmp    $0x2,%eax
+  803cf2:	74 02                	je     803cf6 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803cf4:	c9                   	leave
+  803cf5:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803cf6:	83 ec 08             	sub    $0x8,%esp
+  803cf9:	6a 01                	push   $0x1
+  803cfb:	52                   	push   %edx
+  803cfc:	e8 a1 d5 ff ff       	call   8012a2 <sys_futex_wake>
+  803d01:	83 c4 10             	add    $0x10,%esp
+}
+  803d04:	eb ee                	jmp    803cf4 <mutex_unlock+0x16>
+
+00803d06 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803d06:	55                   	push   %ebp
+  803d07:	89 e5                	mov    %esp,%ebp
+  803d09:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803d0c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803d12:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803d19:	5d                   	pop    %ebp
+  803d1a:	c3                   	ret
+
+00803d1b <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803d1b:	55                   	push   %ebp
+  803d1c:	89 e5                	mov    %esp,%ebp
+  803d1e:	57                   	push   %edi
+  803d1f:	56                   	push   %esi
+  803d20:	53                   	push   %ebx
+  803d21:	83 ec 18             	sub    $0x18,%esp
+  803d24:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803d27:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803d2a:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803d2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d31:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803d36:	57                   	push   %edi
+  803d37:	e8 a2 ff ff ff       	call   803cde <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803d3c:	83 c4 0c             	add    $0xc,%esp
+  803d3f:	ff 75 10             	push   0x10(%ebp)
+  803d42:	56                   	push   %esi
+  803d43:	53                   	push   %ebx
+  803d44:	e8 37 d5 ff ff       	call   801280 <sys_futex_wait>
+  803d49:	89 c6                	mov    %eax,%esi
+  803d4b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803d50:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803d55:	89 3c 24             	mov    %edi,(%esp)
+  803d58:	e8 13 ff ff ff       	call   803c70 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803d5d:	83 c4 10             	add    $0x10,%esp
+  803d60:	83 fe ef             	cmp    $0xffffffef,%esi
+  803d63:	74 05                	je     803d6a <cond_timedwait+0x4f>
+  803d65:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803d6a:	89 f0                	mov    %esi,%eax
+  803d6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d6f:	5b                   	pop    %ebx
+  803d70:	5e                   	pop    %esi
+  803d71:	5f                   	pop    %edi
+  803d72:	5d                   	pop    %ebp
+  803d73:	c3                   	ret
+
+00803d74 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803d74:	55                   	push   %ebp
+  803d75:	89 e5                	mov    %esp,%ebp
+  803d77:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803d7a:	6a ff                	push   $0xffffffff
+  803d7c:	ff 75 0c             	push   0xc(%ebp)
+  803d7f:	ff 75 08             	push   0x8(%ebp)
+  803d82:	e8 94 ff ff ff       	call   803d1b <cond_timedwait>
+}
+  803d87:	83 c4 10             	add    $0x10,%esp
+  803d8a:	c9                   	leave
+  803d8b:	c3                   	ret
+
+00803d8c <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803d8c:	55                   	push   %ebp
+  803d8d:	89 e5                	mov    %esp,%ebp
+  803d8f:	83 ec 08             	sub    $0x8,%esp
+  803d92:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d95:	ba 01 00 00 00       	mov    $0x1,%edx
+  803d9a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803d9e:	8b 50 04             	mov    0x4(%eax),%edx
+  803da1:	85 d2                	test   %edx,%edx
+  803da3:	75 02                	jne    803da7 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803da5:	c9                   	leave
+  803da6:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803da7:	83 ec 08             	sub    $0x8,%esp
+  803daa:	6a 01                	push   $0x1
+  803dac:	50                   	push   %eax
+  803dad:	e8 f0 d4 ff ff       	call   8012a2 <sys_futex_wake>
+  803db2:	83 c4 10             	add    $0x10,%esp
+}
+  803db5:	eb ee                	jmp    803da5 <cond_signal+0x19>
+
+00803db7 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803db7:	55                   	push   %ebp
+  803db8:	89 e5                	mov    %esp,%ebp
+  803dba:	83 ec 08             	sub    $0x8,%esp
+  803dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc0:	ba 01 00 00 00       	mov    $0x1,%edx
+  803dc5:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803dc9:	8b 50 04             	mov    0x4(%eax),%edx
+  803dcc:	85 d2                	test   %edx,%edx
+  803dce:	75 02                	jne    803dd2 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803dd0:	c9                   	leave
+  803dd1:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803dd2:	83 ec 08             	sub    $0x8,%esp
+  803dd5:	68 00 04 00 00       	push   $0x400
+  803dda:	50                   	push   %eax
+  803ddb:	e8 c2 d4 ff ff       	call   8012a2 <sys_futex_wake>
+  803de0:	83 c4 10             	add    $0x10,%esp
+}
+  803de3:	eb eb                	jmp    803dd0 <cond_broadcast+0x19>
+
+00803de5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dea:	c3                   	ret
+
+00803deb <devcons_poll>:
+{
+  803deb:	55                   	push   %ebp
+  803dec:	89 e5                	mov    %esp,%ebp
+  803dee:	53                   	push   %ebx
+  803def:	83 ec 04             	sub    $0x4,%esp
+  803df2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803df5:	89 da                	mov    %ebx,%edx
+  803df7:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803dfa:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803e01:	74 0c                	je     803e0f <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803e03:	89 d8                	mov    %ebx,%eax
+  803e05:	83 e0 01             	and    $0x1,%eax
+  803e08:	09 d0                	or     %edx,%eax
+}
+  803e0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e0d:	c9                   	leave
+  803e0e:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803e0f:	e8 d0 cf ff ff       	call   800de4 <sys_cgetc>
+  803e14:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803e19:	89 da                	mov    %ebx,%edx
+  803e1b:	83 e2 04             	and    $0x4,%edx
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	74 e6                	je     803e08 <devcons_poll+0x1d>
+  803e22:	eb df                	jmp    803e03 <devcons_poll+0x18>
+
+00803e24 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803e24:	55                   	push   %ebp
+  803e25:	89 e5                	mov    %esp,%ebp
+  803e27:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803e2a:	68 d6 4b 80 00       	push   $0x804bd6
+  803e2f:	ff 75 0c             	push   0xc(%ebp)
+  803e32:	e8 17 cc ff ff       	call   800a4e <strcpy>
+	return 0;
+}
+  803e37:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3c:	c9                   	leave
+  803e3d:	c3                   	ret
+
+00803e3e <devcons_write>:
+{
+  803e3e:	55                   	push   %ebp
+  803e3f:	89 e5                	mov    %esp,%ebp
+  803e41:	57                   	push   %edi
+  803e42:	56                   	push   %esi
+  803e43:	53                   	push   %ebx
+  803e44:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803e4a:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803e4d:	85 ff                	test   %edi,%edi
+  803e4f:	74 51                	je     803ea2 <devcons_write+0x64>
+  803e51:	be 00 00 00 00       	mov    $0x0,%esi
+  803e56:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803e5b:	89 fb                	mov    %edi,%ebx
+  803e5d:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803e5f:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803e64:	39 d3                	cmp    %edx,%ebx
+  803e66:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803e69:	83 ec 04             	sub    $0x4,%esp
+  803e6c:	53                   	push   %ebx
+  803e6d:	03 45 0c             	add    0xc(%ebp),%eax
+  803e70:	50                   	push   %eax
+  803e71:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803e77:	50                   	push   %eax
+  803e78:	e8 81 cd ff ff       	call   800bfe <memmove>
+		sys_cputs(buf, m);
+  803e7d:	83 c4 08             	add    $0x8,%esp
+  803e80:	53                   	push   %ebx
+  803e81:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803e87:	50                   	push   %eax
+  803e88:	e8 39 cf ff ff       	call   800dc6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  803e8d:	01 de                	add    %ebx,%esi
+  803e8f:	89 f0                	mov    %esi,%eax
+  803e91:	83 c4 10             	add    $0x10,%esp
+  803e94:	39 fe                	cmp    %edi,%esi
+  803e96:	72 c3                	jb     803e5b <devcons_write+0x1d>
+}
+  803e98:	89 f0                	mov    %esi,%eax
+  803e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e9d:	5b                   	pop    %ebx
+  803e9e:	5e                   	pop    %esi
+  803e9f:	5f                   	pop    %edi
+  803ea0:	5d                   	pop    %ebp
+  803ea1:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803ea2:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803ea7:	eb ef                	jmp    803e98 <devcons_write+0x5a>
+
+00803ea9 <devcons_read>:
+{
+  803ea9:	55                   	push   %ebp
+  803eaa:	89 e5                	mov    %esp,%ebp
+  803eac:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803eb4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803eb8:	74 36                	je     803ef0 <devcons_read+0x47>
+	c = cons_peek;
+  803eba:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  803ebf:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  803ec6:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803ec9:	85 c0                	test   %eax,%eax
+  803ecb:	75 10                	jne    803edd <devcons_read+0x34>
+  803ecd:	e8 12 cf ff ff       	call   800de4 <sys_cgetc>
+  803ed2:	85 c0                	test   %eax,%eax
+  803ed4:	75 07                	jne    803edd <devcons_read+0x34>
+		sys_yield();
+  803ed6:	e8 88 cf ff ff       	call   800e63 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803edb:	eb f0                	jmp    803ecd <devcons_read+0x24>
+	if (c < 0)
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	78 0f                	js     803ef0 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803ee1:	83 f8 04             	cmp    $0x4,%eax
+  803ee4:	74 0c                	je     803ef2 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803ee6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ee9:	88 02                	mov    %al,(%edx)
+	return 1;
+  803eeb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803ef0:	c9                   	leave
+  803ef1:	c3                   	ret
+		return 0;
+  803ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef7:	eb f7                	jmp    803ef0 <devcons_read+0x47>
+
+00803ef9 <cputchar>:
+{
+  803ef9:	55                   	push   %ebp
+  803efa:	89 e5                	mov    %esp,%ebp
+  803efc:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f02:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803f05:	6a 01                	push   $0x1
+  803f07:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f0a:	50                   	push   %eax
+  803f0b:	e8 b6 ce ff ff       	call   800dc6 <sys_cputs>
+}
+  803f10:	83 c4 10             	add    $0x10,%esp
+  803f13:	c9                   	leave
+  803f14:	c3                   	ret
+
+00803f15 <getchar>:
+{
+  803f15:	55                   	push   %ebp
+  803f16:	89 e5                	mov    %esp,%ebp
+  803f18:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803f1b:	6a 01                	push   $0x1
+  803f1d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803f20:	50                   	push   %eax
+  803f21:	6a 00                	push   $0x0
+  803f23:	e8 34 de ff ff       	call   801d5c <read>
+	if (r < 0)
+  803f28:	83 c4 10             	add    $0x10,%esp
+  803f2b:	85 c0                	test   %eax,%eax
+  803f2d:	78 06                	js     803f35 <getchar+0x20>
+	if (r < 1)
+  803f2f:	74 06                	je     803f37 <getchar+0x22>
+	return c;
+  803f31:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803f35:	c9                   	leave
+  803f36:	c3                   	ret
+		return -E_EOF;
+  803f37:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803f3c:	eb f7                	jmp    803f35 <getchar+0x20>
+
+00803f3e <iscons>:
+{
+  803f3e:	55                   	push   %ebp
+  803f3f:	89 e5                	mov    %esp,%ebp
+  803f41:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f47:	50                   	push   %eax
+  803f48:	ff 75 08             	push   0x8(%ebp)
+  803f4b:	e8 88 db ff ff       	call   801ad8 <fd_lookup>
+  803f50:	83 c4 10             	add    $0x10,%esp
+  803f53:	85 c0                	test   %eax,%eax
+  803f55:	78 11                	js     803f68 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803f57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f5a:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803f60:	39 10                	cmp    %edx,(%eax)
+  803f62:	0f 94 c0             	sete   %al
+  803f65:	0f b6 c0             	movzbl %al,%eax
+}
+  803f68:	c9                   	leave
+  803f69:	c3                   	ret
+
+00803f6a <opencons>:
+{
+  803f6a:	55                   	push   %ebp
+  803f6b:	89 e5                	mov    %esp,%ebp
+  803f6d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803f70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f73:	50                   	push   %eax
+  803f74:	e8 0f db ff ff       	call   801a88 <fd_alloc>
+  803f79:	83 c4 10             	add    $0x10,%esp
+  803f7c:	85 c0                	test   %eax,%eax
+  803f7e:	78 3a                	js     803fba <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803f80:	83 ec 04             	sub    $0x4,%esp
+  803f83:	68 07 04 00 00       	push   $0x407
+  803f88:	ff 75 f4             	push   -0xc(%ebp)
+  803f8b:	6a 00                	push   $0x0
+  803f8d:	e8 f0 ce ff ff       	call   800e82 <sys_page_alloc>
+  803f92:	83 c4 10             	add    $0x10,%esp
+  803f95:	85 c0                	test   %eax,%eax
+  803f97:	78 21                	js     803fba <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803f99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803f9c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803fa2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803fa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803fa7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803fae:	83 ec 0c             	sub    $0xc,%esp
+  803fb1:	50                   	push   %eax
+  803fb2:	e8 aa da ff ff       	call   801a61 <fd2num>
+  803fb7:	83 c4 10             	add    $0x10,%esp
+}
+  803fba:	c9                   	leave
+  803fbb:	c3                   	ret
+
+00803fbc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803fbc:	55                   	push   %ebp
+  803fbd:	89 e5                	mov    %esp,%ebp
+  803fbf:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  803fc2:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803fc9:	74 0a                	je     803fd5 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803fcb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fce:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803fd3:	c9                   	leave
+  803fd4:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  803fd5:	83 ec 04             	sub    $0x4,%esp
+  803fd8:	6a 07                	push   $0x7
+  803fda:	68 00 f0 bf ee       	push   $0xeebff000
+  803fdf:	6a 00                	push   $0x0
+  803fe1:	e8 9c ce ff ff       	call   800e82 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  803fe6:	83 c4 08             	add    $0x8,%esp
+  803fe9:	68 fa 3f 80 00       	push   $0x803ffa
+  803fee:	6a 00                	push   $0x0
+  803ff0:	e8 d8 cf ff ff       	call   800fcd <sys_env_set_pgfault_upcall>
+  803ff5:	83 c4 10             	add    $0x10,%esp
+  803ff8:	eb d1                	jmp    803fcb <set_pgfault_handler+0xf>
+
+00803ffa <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803ffa:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803ffb:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804000:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804002:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804005:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804009:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80400c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804010:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804012:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804016:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804019:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80401a:	83 c4 04             	add    $0x4,%esp
+	popf
+  80401d:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80401e:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80401f:	c3                   	ret
+
+00804020 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804020:	55                   	push   %ebp
+  804021:	89 e5                	mov    %esp,%ebp
+  804023:	56                   	push   %esi
+  804024:	53                   	push   %ebx
+  804025:	8b 75 08             	mov    0x8(%ebp),%esi
+  804028:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80402b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  80402e:	85 c0                	test   %eax,%eax
+  804030:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804035:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804038:	83 ec 0c             	sub    $0xc,%esp
+  80403b:	50                   	push   %eax
+  80403c:	e8 f1 cf ff ff       	call   801032 <sys_ipc_recv>
+  804041:	83 c4 10             	add    $0x10,%esp
+  804044:	85 c0                	test   %eax,%eax
+  804046:	0f 88 8b 00 00 00    	js     8040d7 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80404c:	85 f6                	test   %esi,%esi
+  80404e:	74 2a                	je     80407a <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804050:	89 e2                	mov    %esp,%edx
+  804052:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804057:	29 d0                	sub    %edx,%eax
+  804059:	89 c2                	mov    %eax,%edx
+  80405b:	c1 ea 0f             	shr    $0xf,%edx
+  80405e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804063:	b8 00 00 00 00       	mov    $0x0,%eax
+  804068:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80406b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804072:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804078:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80407a:	85 db                	test   %ebx,%ebx
+  80407c:	74 2a                	je     8040a8 <ipc_recv+0x88>
+  80407e:	89 e2                	mov    %esp,%edx
+  804080:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804085:	29 d0                	sub    %edx,%eax
+  804087:	89 c2                	mov    %eax,%edx
+  804089:	c1 ea 0f             	shr    $0xf,%edx
+  80408c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804091:	b8 00 00 00 00       	mov    $0x0,%eax
+  804096:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804099:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040a0:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8040a6:	89 03                	mov    %eax,(%ebx)
+  8040a8:	89 e2                	mov    %esp,%edx
+  8040aa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8040af:	29 d0                	sub    %edx,%eax
+  8040b1:	89 c2                	mov    %eax,%edx
+  8040b3:	c1 ea 0f             	shr    $0xf,%edx
+  8040b6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8040bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8040c3:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8040ca:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8040d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040d3:	5b                   	pop    %ebx
+  8040d4:	5e                   	pop    %esi
+  8040d5:	5d                   	pop    %ebp
+  8040d6:	c3                   	ret
+		if(from_env_store != NULL)
+  8040d7:	85 f6                	test   %esi,%esi
+  8040d9:	74 06                	je     8040e1 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8040db:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8040e1:	85 db                	test   %ebx,%ebx
+  8040e3:	74 eb                	je     8040d0 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8040e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8040eb:	eb e3                	jmp    8040d0 <ipc_recv+0xb0>
+
+008040ed <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8040ed:	55                   	push   %ebp
+  8040ee:	89 e5                	mov    %esp,%ebp
+  8040f0:	57                   	push   %edi
+  8040f1:	56                   	push   %esi
+  8040f2:	53                   	push   %ebx
+  8040f3:	83 ec 14             	sub    $0x14,%esp
+  8040f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8040f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8040fc:	8b 75 14             	mov    0x14(%ebp),%esi
+  8040ff:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804102:	85 c0                	test   %eax,%eax
+  804104:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804109:	0f 44 c2             	cmove  %edx,%eax
+  80410c:	ff 75 10             	push   0x10(%ebp)
+  80410f:	50                   	push   %eax
+  804110:	e8 7f cf ff ff       	call   801094 <sys_ipc_recv_pages>
+  804115:	83 c4 10             	add    $0x10,%esp
+  804118:	85 c0                	test   %eax,%eax
+  80411a:	0f 88 ba 00 00 00    	js     8041da <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804120:	85 ff                	test   %edi,%edi
+  804122:	74 2a                	je     80414e <ipc_recv_pages+0x61>
+  804124:	89 e2                	mov    %esp,%edx
+  804126:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80412b:	29 d0                	sub    %edx,%eax
+  80412d:	89 c2                	mov    %eax,%edx
+  80412f:	c1 ea 0f             	shr    $0xf,%edx
+  804132:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80413c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80413f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804146:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80414c:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80414e:	85 f6                	test   %esi,%esi
+  804150:	74 2a                	je     80417c <ipc_recv_pages+0x8f>
+  804152:	89 e2                	mov    %esp,%edx
+  804154:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804159:	29 d0                	sub    %edx,%eax
+  80415b:	89 c2                	mov    %eax,%edx
+  80415d:	c1 ea 0f             	shr    $0xf,%edx
+  804160:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80416a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80416d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804174:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80417a:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80417c:	85 db                	test   %ebx,%ebx
+  80417e:	74 2a                	je     8041aa <ipc_recv_pages+0xbd>
+  804180:	89 e2                	mov    %esp,%edx
+  804182:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804187:	29 d0                	sub    %edx,%eax
+  804189:	89 c2                	mov    %eax,%edx
+  80418b:	c1 ea 0f             	shr    $0xf,%edx
+  80418e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804193:	b8 00 00 00 00       	mov    $0x0,%eax
+  804198:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80419b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8041a2:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  8041a8:	89 03                	mov    %eax,(%ebx)
+  8041aa:	89 e2                	mov    %esp,%edx
+  8041ac:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8041b1:	29 d0                	sub    %edx,%eax
+  8041b3:	89 c2                	mov    %eax,%edx
+  8041b5:	c1 ea 0f             	shr    $0xf,%edx
+  8041b8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8041bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c2:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8041c5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8041cc:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  8041d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041d5:	5b                   	pop    %ebx
+  8041d6:	5e                   	pop    %esi
+  8041d7:	5f                   	pop    %edi
+  8041d8:	5d                   	pop    %ebp
+  8041d9:	c3                   	ret
+		if (from_env_store)
+  8041da:	85 ff                	test   %edi,%edi
+  8041dc:	74 06                	je     8041e4 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8041de:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8041e4:	85 f6                	test   %esi,%esi
+  8041e6:	74 06                	je     8041ee <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8041e8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8041ee:	85 db                	test   %ebx,%ebx
+  8041f0:	74 e0                	je     8041d2 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8041f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8041f8:	eb d8                	jmp    8041d2 <ipc_recv_pages+0xe5>
+
+008041fa <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8041fa:	55                   	push   %ebp
+  8041fb:	89 e5                	mov    %esp,%ebp
+  8041fd:	57                   	push   %edi
+  8041fe:	56                   	push   %esi
+  8041ff:	53                   	push   %ebx
+  804200:	83 ec 1c             	sub    $0x1c,%esp
+  804203:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804206:	8b 75 08             	mov    0x8(%ebp),%esi
+  804209:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  80420f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804213:	75 2b                	jne    804240 <ipc_try_send_pages+0x46>
+  804215:	89 e2                	mov    %esp,%edx
+  804217:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80421c:	29 d0                	sub    %edx,%eax
+  80421e:	89 c2                	mov    %eax,%edx
+  804220:	c1 ea 0f             	shr    $0xf,%edx
+  804223:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422d:	0f 42 c2             	cmovb  %edx,%eax
+  804230:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804237:	8b 70 48             	mov    0x48(%eax),%esi
+  80423a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804240:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804246:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80424b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80424e:	85 ff                	test   %edi,%edi
+  804250:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804255:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804258:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80425e:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804264:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80426a:	83 ec 0c             	sub    $0xc,%esp
+  80426d:	ff 75 14             	push   0x14(%ebp)
+  804270:	ff 75 18             	push   0x18(%ebp)
+  804273:	57                   	push   %edi
+  804274:	ff 75 0c             	push   0xc(%ebp)
+  804277:	ff 75 08             	push   0x8(%ebp)
+  80427a:	e8 f4 cd ff ff       	call   801073 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80427f:	83 c4 20             	add    $0x20,%esp
+  804282:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804285:	75 21                	jne    8042a8 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804287:	83 ec 04             	sub    $0x4,%esp
+  80428a:	6a ff                	push   $0xffffffff
+  80428c:	53                   	push   %ebx
+  80428d:	ff 75 e4             	push   -0x1c(%ebp)
+  804290:	e8 eb cf ff ff       	call   801280 <sys_futex_wait>
+  804295:	83 c4 10             	add    $0x10,%esp
+  804298:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80429b:	74 c7                	je     804264 <ipc_try_send_pages+0x6a>
+  80429d:	85 c0                	test   %eax,%eax
+  80429f:	79 c3                	jns    804264 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  8042a1:	e8 bd cb ff ff       	call   800e63 <sys_yield>
+  8042a6:	eb bc                	jmp    804264 <ipc_try_send_pages+0x6a>
+	}
+}
+  8042a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042ab:	5b                   	pop    %ebx
+  8042ac:	5e                   	pop    %esi
+  8042ad:	5f                   	pop    %edi
+  8042ae:	5d                   	pop    %ebp
+  8042af:	c3                   	ret
+
+008042b0 <ipc_send>:
+{
+  8042b0:	55                   	push   %ebp
+  8042b1:	89 e5                	mov    %esp,%ebp
+  8042b3:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  8042b6:	ff 75 14             	push   0x14(%ebp)
+  8042b9:	6a 01                	push   $0x1
+  8042bb:	ff 75 10             	push   0x10(%ebp)
+  8042be:	ff 75 0c             	push   0xc(%ebp)
+  8042c1:	ff 75 08             	push   0x8(%ebp)
+  8042c4:	e8 31 ff ff ff       	call   8041fa <ipc_try_send_pages>
+  8042c9:	83 c4 20             	add    $0x20,%esp
+  8042cc:	85 c0                	test   %eax,%eax
+  8042ce:	78 02                	js     8042d2 <ipc_send+0x22>
+}
+  8042d0:	c9                   	leave
+  8042d1:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  8042d2:	50                   	push   %eax
+  8042d3:	68 e2 4b 80 00       	push   $0x804be2
+  8042d8:	6a 3f                	push   $0x3f
+  8042da:	68 f7 4b 80 00       	push   $0x804bf7
+  8042df:	e8 98 bf ff ff       	call   80027c <_panic>
+
+008042e4 <ipc_send_pages>:
+{
+  8042e4:	55                   	push   %ebp
+  8042e5:	89 e5                	mov    %esp,%ebp
+  8042e7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8042ea:	ff 75 18             	push   0x18(%ebp)
+  8042ed:	ff 75 14             	push   0x14(%ebp)
+  8042f0:	ff 75 10             	push   0x10(%ebp)
+  8042f3:	ff 75 0c             	push   0xc(%ebp)
+  8042f6:	ff 75 08             	push   0x8(%ebp)
+  8042f9:	e8 fc fe ff ff       	call   8041fa <ipc_try_send_pages>
+  8042fe:	83 c4 20             	add    $0x20,%esp
+  804301:	85 c0                	test   %eax,%eax
+  804303:	78 02                	js     804307 <ipc_send_pages+0x23>
+}
+  804305:	c9                   	leave
+  804306:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804307:	50                   	push   %eax
+  804308:	68 01 4c 80 00       	push   $0x804c01
+  80430d:	6a 64                	push   $0x64
+  80430f:	68 f7 4b 80 00       	push   $0x804bf7
+  804314:	e8 63 bf ff ff       	call   80027c <_panic>
+
+00804319 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804319:	55                   	push   %ebp
+  80431a:	89 e5                	mov    %esp,%ebp
+  80431c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80431f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804324:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80432a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804330:	8b 52 50             	mov    0x50(%edx),%edx
+  804333:	39 ca                	cmp    %ecx,%edx
+  804335:	74 11                	je     804348 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804337:	83 c0 01             	add    $0x1,%eax
+  80433a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80433f:	75 e3                	jne    804324 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804341:	b8 00 00 00 00       	mov    $0x0,%eax
+  804346:	eb 0e                	jmp    804356 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804348:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80434e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804353:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804356:	5d                   	pop    %ebp
+  804357:	c3                   	ret
+
+00804358 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804358:	55                   	push   %ebp
+  804359:	89 e5                	mov    %esp,%ebp
+  80435b:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80435e:	89 c2                	mov    %eax,%edx
+  804360:	c1 ea 16             	shr    $0x16,%edx
+  804363:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80436a:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80436f:	f6 c1 01             	test   $0x1,%cl
+  804372:	74 1e                	je     804392 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804374:	c1 e8 0c             	shr    $0xc,%eax
+  804377:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80437e:	a8 01                	test   $0x1,%al
+  804380:	74 10                	je     804392 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804382:	c1 e8 0c             	shr    $0xc,%eax
+  804385:	c1 e0 04             	shl    $0x4,%eax
+  804388:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80438f:	0f b7 d2             	movzwl %dx,%edx
+}
+  804392:	89 d0                	mov    %edx,%eax
+  804394:	5d                   	pop    %ebp
+  804395:	c3                   	ret
+
+00804396 <__udivdi3>:
+  804396:	57                   	push   %edi
+  804397:	56                   	push   %esi
+  804398:	53                   	push   %ebx
+  804399:	83 ec 20             	sub    $0x20,%esp
+  80439c:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8043a0:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8043a4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8043a8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8043ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8043b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8043b4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8043b8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8043bc:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8043c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043cb:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8043d2:	00 
+  8043d3:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8043da:	00 
+  8043db:	eb 08                	jmp    8043e5 <__udivdi3+0x4f>
+  8043dd:	83 e9 01             	sub    $0x1,%ecx
+  8043e0:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8043e3:	74 68                	je     80444d <__udivdi3+0xb7>
+  8043e5:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8043e9:	01 c0                	add    %eax,%eax
+  8043eb:	89 c6                	mov    %eax,%esi
+  8043ed:	89 d7                	mov    %edx,%edi
+  8043ef:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8043f3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8043f7:	0f ad d0             	shrd   %cl,%edx,%eax
+  8043fa:	d3 ea                	shr    %cl,%edx
+  8043fc:	f6 c1 20             	test   $0x20,%cl
+  8043ff:	74 04                	je     804405 <__udivdi3+0x6f>
+  804401:	89 d0                	mov    %edx,%eax
+  804403:	31 d2                	xor    %edx,%edx
+  804405:	83 e0 01             	and    $0x1,%eax
+  804408:	89 04 24             	mov    %eax,(%esp)
+  80440b:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804412:	00 
+  804413:	8b 04 24             	mov    (%esp),%eax
+  804416:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80441a:	09 f0                	or     %esi,%eax
+  80441c:	09 fa                	or     %edi,%edx
+  80441e:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804422:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804426:	39 f0                	cmp    %esi,%eax
+  804428:	89 d3                	mov    %edx,%ebx
+  80442a:	19 fb                	sbb    %edi,%ebx
+  80442c:	72 af                	jb     8043dd <__udivdi3+0x47>
+  80442e:	29 f0                	sub    %esi,%eax
+  804430:	19 fa                	sbb    %edi,%edx
+  804432:	89 cf                	mov    %ecx,%edi
+  804434:	c1 ef 05             	shr    $0x5,%edi
+  804437:	83 e7 01             	and    $0x1,%edi
+  80443a:	89 fe                	mov    %edi,%esi
+  80443c:	83 f6 01             	xor    $0x1,%esi
+  80443f:	d3 e6                	shl    %cl,%esi
+  804441:	d3 e7                	shl    %cl,%edi
+  804443:	09 74 24 18          	or     %esi,0x18(%esp)
+  804447:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80444b:	eb 90                	jmp    8043dd <__udivdi3+0x47>
+  80444d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804451:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804455:	83 c4 20             	add    $0x20,%esp
+  804458:	5b                   	pop    %ebx
+  804459:	5e                   	pop    %esi
+  80445a:	5f                   	pop    %edi
+  80445b:	c3                   	ret
+
+0080445c <__umoddi3>:
+  80445c:	57                   	push   %edi
+  80445d:	56                   	push   %esi
+  80445e:	53                   	push   %ebx
+  80445f:	83 ec 08             	sub    $0x8,%esp
+  804462:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804466:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80446a:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80446e:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804472:	57                   	push   %edi
+  804473:	56                   	push   %esi
+  804474:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804478:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80447c:	52                   	push   %edx
+  80447d:	50                   	push   %eax
+  80447e:	e8 13 ff ff ff       	call   804396 <__udivdi3>
+  804483:	89 c3                	mov    %eax,%ebx
+  804485:	0f af d6             	imul   %esi,%edx
+  804488:	89 f9                	mov    %edi,%ecx
+  80448a:	0f af cb             	imul   %ebx,%ecx
+  80448d:	01 d1                	add    %edx,%ecx
+  80448f:	89 d8                	mov    %ebx,%eax
+  804491:	f7 e6                	mul    %esi
+  804493:	89 c6                	mov    %eax,%esi
+  804495:	89 d7                	mov    %edx,%edi
+  804497:	01 cf                	add    %ecx,%edi
+  804499:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80449d:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8044a1:	29 f0                	sub    %esi,%eax
+  8044a3:	19 fa                	sbb    %edi,%edx
+  8044a5:	83 c4 18             	add    $0x18,%esp
+  8044a8:	5b                   	pop    %ebx
+  8044a9:	5e                   	pop    %esi
+  8044aa:	5f                   	pop    %edi
+  8044ab:	c3                   	ret
+
+008044ac <__divdi3>:
+  8044ac:	53                   	push   %ebx
+  8044ad:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8044b1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8044b5:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8044b9:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8044bd:	85 d2                	test   %edx,%edx
+  8044bf:	78 12                	js     8044d3 <__divdi3+0x27>
+  8044c1:	85 db                	test   %ebx,%ebx
+  8044c3:	78 2e                	js     8044f3 <__divdi3+0x47>
+  8044c5:	53                   	push   %ebx
+  8044c6:	51                   	push   %ecx
+  8044c7:	52                   	push   %edx
+  8044c8:	50                   	push   %eax
+  8044c9:	e8 c8 fe ff ff       	call   804396 <__udivdi3>
+  8044ce:	83 c4 10             	add    $0x10,%esp
+  8044d1:	eb 1e                	jmp    8044f1 <__divdi3+0x45>
+  8044d3:	f7 d8                	neg    %eax
+  8044d5:	83 d2 00             	adc    $0x0,%edx
+  8044d8:	f7 da                	neg    %edx
+  8044da:	85 db                	test   %ebx,%ebx
+  8044dc:	78 2a                	js     804508 <__divdi3+0x5c>
+  8044de:	53                   	push   %ebx
+  8044df:	51                   	push   %ecx
+  8044e0:	52                   	push   %edx
+  8044e1:	50                   	push   %eax
+  8044e2:	e8 af fe ff ff       	call   804396 <__udivdi3>
+  8044e7:	83 c4 10             	add    $0x10,%esp
+  8044ea:	f7 d8                	neg    %eax
+  8044ec:	83 d2 00             	adc    $0x0,%edx
+  8044ef:	f7 da                	neg    %edx
+  8044f1:	5b                   	pop    %ebx
+  8044f2:	c3                   	ret
+  8044f3:	f7 d9                	neg    %ecx
+  8044f5:	83 d3 00             	adc    $0x0,%ebx
+  8044f8:	f7 db                	neg    %ebx
+  8044fa:	53                   	push   %ebx
+  8044fb:	51                   	push   %ecx
+  8044fc:	52                   	push   %edx
+  8044fd:	50                   	push   %eax
+  8044fe:	e8 93 fe ff ff       	call   804396 <__udivdi3>
+  804503:	83 c4 10             	add    $0x10,%esp
+  804506:	eb e2                	jmp    8044ea <__divdi3+0x3e>
+  804508:	f7 d9                	neg    %ecx
+  80450a:	83 d3 00             	adc    $0x0,%ebx
+  80450d:	f7 db                	neg    %ebx
+  80450f:	53                   	push   %ebx
+  804510:	51                   	push   %ecx
+  804511:	52                   	push   %edx
+  804512:	50                   	push   %eax
+  804513:	e8 7e fe ff ff       	call   804396 <__udivdi3>
+  804518:	83 c4 10             	add    $0x10,%esp
+  80451b:	eb d4                	jmp    8044f1 <__divdi3+0x45>
+
+0080451d <__moddi3>:
+  80451d:	57                   	push   %edi
+  80451e:	56                   	push   %esi
+  80451f:	53                   	push   %ebx
+  804520:	83 ec 08             	sub    $0x8,%esp
+  804523:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804527:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80452b:	8b 74 24 20          	mov    0x20(%esp),%esi
+  80452f:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804533:	57                   	push   %edi
+  804534:	56                   	push   %esi
+  804535:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804539:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80453d:	52                   	push   %edx
+  80453e:	50                   	push   %eax
+  80453f:	e8 68 ff ff ff       	call   8044ac <__divdi3>
+  804544:	89 c3                	mov    %eax,%ebx
+  804546:	0f af d6             	imul   %esi,%edx
+  804549:	89 f9                	mov    %edi,%ecx
+  80454b:	0f af cb             	imul   %ebx,%ecx
+  80454e:	01 d1                	add    %edx,%ecx
+  804550:	89 d8                	mov    %ebx,%eax
+  804552:	f7 e6                	mul    %esi
+  804554:	89 c6                	mov    %eax,%esi
+  804556:	89 d7                	mov    %edx,%edi
+  804558:	01 cf                	add    %ecx,%edi
+  80455a:	8b 44 24 10          	mov    0x10(%esp),%eax
+  80455e:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804562:	29 f0                	sub    %esi,%eax
+  804564:	19 fa                	sbb    %edi,%edx
+  804566:	83 c4 18             	add    $0x18,%esp
+  804569:	5b                   	pop    %ebx
+  80456a:	5e                   	pop    %esi
+  80456b:	5f                   	pop    %edi
+  80456c:	c3                   	ret
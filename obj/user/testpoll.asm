@@ -0,0 +1,10503 @@
+
+obj/user/testpoll.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 55 04 00 00       	call   800486 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+static struct pollfd fds[2 + NCONN];
+static char buf[512];
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 a0 52 80 00       	push   $0x8052a0
+  800041:	e8 c2 05 00 00       	call   800608 <cprintf>
+	exit();
+  800046:	e8 c8 04 00 00       	call   800513 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <umain>:
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	83 ec 58             	sub    $0x58,%esp
+	struct sockaddr_in addr;
+	unsigned int len;
+	uint32_t polls = 0, ticks = 0, conns = 0, closed = 0;
+	int p[2], s, c, i, n, r;
+
+	binaryname = "testpoll";
+  800059:	c7 05 00 60 80 00 a4 	movl   $0x8052a4,0x806000
+  800060:	52 80 00 
+	if ((r = pipe(p)) < 0)
+  800063:	8d 45 cc             	lea    -0x34(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 84 3b 00 00       	call   803bf0 <pipe>
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	0f 88 ef 00 00 00    	js     800166 <umain+0x116>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800077:	e8 bf 16 00 00       	call   80173b <fork>
+  80007c:	85 c0                	test   %eax,%eax
+  80007e:	0f 88 f4 00 00 00    	js     800178 <umain+0x128>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800084:	0f 84 00 01 00 00    	je     80018a <umain+0x13a>
+		close(p[0]);
+		ticker(p[1]);
+	}
+	close(p[1]);
+  80008a:	83 ec 0c             	sub    $0xc,%esp
+  80008d:	ff 75 d0             	push   -0x30(%ebp)
+  800090:	e8 39 1e 00 00       	call   801ece <close>
+
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800095:	83 c4 0c             	add    $0xc,%esp
+  800098:	6a 06                	push   $0x6
+  80009a:	6a 01                	push   $0x1
+  80009c:	6a 02                	push   $0x2
+  80009e:	e8 7e 29 00 00       	call   802a21 <socket>
+  8000a3:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	85 c0                	test   %eax,%eax
+  8000ab:	0f 88 5f 01 00 00    	js     800210 <umain+0x1c0>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  8000b1:	83 ec 04             	sub    $0x4,%esp
+  8000b4:	6a 10                	push   $0x10
+  8000b6:	6a 00                	push   $0x0
+  8000b8:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  8000bb:	53                   	push   %ebx
+  8000bc:	e8 b9 0d 00 00       	call   800e7a <memset>
+	addr.sin_family = AF_INET;
+  8000c1:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  8000c5:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000cc:	e8 a1 4d 00 00       	call   804e72 <htonl>
+  8000d1:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	addr.sin_port = htons(PORT);
+  8000d4:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8000db:	e8 78 4d 00 00       	call   804e58 <htons>
+  8000e0:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  8000e4:	83 c4 0c             	add    $0xc,%esp
+  8000e7:	6a 10                	push   $0x10
+  8000e9:	53                   	push   %ebx
+  8000ea:	ff 75 b4             	push   -0x4c(%ebp)
+  8000ed:	e8 8e 27 00 00       	call   802880 <bind>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	85 c0                	test   %eax,%eax
+  8000f7:	0f 88 22 01 00 00    	js     80021f <umain+0x1cf>
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+  8000fd:	83 ec 08             	sub    $0x8,%esp
+  800100:	6a 64                	push   $0x64
+  800102:	ff 75 b4             	push   -0x4c(%ebp)
+  800105:	e8 e5 27 00 00       	call   8028ef <listen>
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 19 01 00 00    	js     80022e <umain+0x1de>
+		die("Failed to listen on server socket");
+	cprintf("testpoll: listening\n");
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	68 f2 52 80 00       	push   $0x8052f2
+  80011d:	e8 e6 04 00 00       	call   800608 <cprintf>
+
+	fds[0].fd = s;
+  800122:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+  800125:	a3 00 72 80 00       	mov    %eax,0x807200
+	fds[0].events = POLLIN;
+  80012a:	66 c7 05 04 72 80 00 	movw   $0x1,0x807204
+  800131:	01 00 
+	fds[1].fd = p[0];
+  800133:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800136:	a3 08 72 80 00       	mov    %eax,0x807208
+	fds[1].events = POLLIN;
+  80013b:	66 c7 05 0c 72 80 00 	movw   $0x1,0x80720c
+  800142:	01 00 
+  800144:	83 c4 10             	add    $0x10,%esp
+	uint32_t polls = 0, ticks = 0, conns = 0, closed = 0;
+  800147:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+  80014e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800153:	c7 45 b0 00 00 00 00 	movl   $0x0,-0x50(%ebp)
+  80015a:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  800161:	e9 54 02 00 00       	jmp    8003ba <umain+0x36a>
+		panic("pipe: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 ad 52 80 00       	push   $0x8052ad
+  80016c:	6a 32                	push   $0x32
+  80016e:	68 b6 52 80 00       	push   $0x8052b6
+  800173:	e8 b5 03 00 00       	call   80052d <_panic>
+		panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 fd 57 80 00       	push   $0x8057fd
+  80017e:	6a 34                	push   $0x34
+  800180:	68 b6 52 80 00       	push   $0x8052b6
+  800185:	e8 a3 03 00 00       	call   80052d <_panic>
+		close(p[0]);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 cc             	push   -0x34(%ebp)
+  800190:	e8 39 1d 00 00       	call   801ece <close>
+		ticker(p[1]);
+  800195:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800198:	83 c4 10             	add    $0x10,%esp
+  80019b:	be 14 00 00 00       	mov    $0x14,%esi
+  8001a0:	eb 36                	jmp    8001d8 <umain+0x188>
+		if (write(wfd, TICK, strlen(TICK)) != strlen(TICK))
+  8001a2:	83 ec 0c             	sub    $0xc,%esp
+  8001a5:	68 c6 52 80 00       	push   $0x8052c6
+  8001aa:	e8 04 0b 00 00       	call   800cb3 <strlen>
+  8001af:	83 c4 0c             	add    $0xc,%esp
+  8001b2:	50                   	push   %eax
+  8001b3:	68 c6 52 80 00       	push   $0x8052c6
+  8001b8:	57                   	push   %edi
+  8001b9:	e8 47 1f 00 00       	call   802105 <write>
+  8001be:	89 c3                	mov    %eax,%ebx
+  8001c0:	c7 04 24 c6 52 80 00 	movl   $0x8052c6,(%esp)
+  8001c7:	e8 e7 0a 00 00       	call   800cb3 <strlen>
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	39 c3                	cmp    %eax,%ebx
+  8001d1:	75 1f                	jne    8001f2 <umain+0x1a2>
+	for (i = 0; i < NTICK; i++) {
+  8001d3:	83 ee 01             	sub    $0x1,%esi
+  8001d6:	74 2e                	je     800206 <umain+0x1b6>
+		start = sys_time_msec();
+  8001d8:	e8 aa 11 00 00       	call   801387 <sys_time_msec>
+  8001dd:	89 c3                	mov    %eax,%ebx
+		while (sys_time_msec() - start < 20)
+  8001df:	e8 a3 11 00 00       	call   801387 <sys_time_msec>
+  8001e4:	29 d8                	sub    %ebx,%eax
+  8001e6:	83 f8 13             	cmp    $0x13,%eax
+  8001e9:	77 b7                	ja     8001a2 <umain+0x152>
+			sys_yield();
+  8001eb:	e8 24 0f 00 00       	call   801114 <sys_yield>
+  8001f0:	eb ed                	jmp    8001df <umain+0x18f>
+			panic("write to pipe");
+  8001f2:	83 ec 04             	sub    $0x4,%esp
+  8001f5:	68 cc 52 80 00       	push   $0x8052cc
+  8001fa:	6a 23                	push   $0x23
+  8001fc:	68 b6 52 80 00       	push   $0x8052b6
+  800201:	e8 27 03 00 00       	call   80052d <_panic>
+	exit();
+  800206:	e8 08 03 00 00       	call   800513 <exit>
+}
+  80020b:	e9 7a fe ff ff       	jmp    80008a <umain+0x3a>
+		die("Failed to create socket");
+  800210:	b8 da 52 80 00       	mov    $0x8052da,%eax
+  800215:	e8 1b fe ff ff       	call   800035 <die>
+  80021a:	e9 92 fe ff ff       	jmp    8000b1 <umain+0x61>
+		die("Failed to bind the server socket");
+  80021f:	b8 48 53 80 00       	mov    $0x805348,%eax
+  800224:	e8 0c fe ff ff       	call   800035 <die>
+  800229:	e9 cf fe ff ff       	jmp    8000fd <umain+0xad>
+		die("Failed to listen on server socket");
+  80022e:	b8 6c 53 80 00       	mov    $0x80536c,%eax
+  800233:	e8 fd fd ff ff       	call   800035 <die>
+  800238:	e9 d8 fe ff ff       	jmp    800115 <umain+0xc5>
+	while (closed < NCONN || fds[1].fd >= 0) {
+		if ((r = poll(fds, 2 + conns, -1)) < 0)
+			panic("poll: %e", r);
+  80023d:	50                   	push   %eax
+  80023e:	68 07 53 80 00       	push   $0x805307
+  800243:	6a 4d                	push   $0x4d
+  800245:	68 b6 52 80 00       	push   $0x8052b6
+  80024a:	e8 de 02 00 00       	call   80052d <_panic>
+		polls++;
+
+		if (fds[0].revents & POLLIN) {
+			len = sizeof(addr);
+  80024f:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+			if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+  800256:	83 ec 04             	sub    $0x4,%esp
+  800259:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  80025c:	50                   	push   %eax
+  80025d:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800260:	50                   	push   %eax
+  800261:	ff 75 b4             	push   -0x4c(%ebp)
+  800264:	e8 d5 25 00 00       	call   80283e <accept>
+  800269:	89 c6                	mov    %eax,%esi
+  80026b:	83 c4 10             	add    $0x10,%esp
+  80026e:	85 c0                	test   %eax,%eax
+  800270:	78 64                	js     8002d6 <umain+0x286>
+				die("Failed to accept client connection");
+			if (conns == NCONN)
+  800272:	83 ff 64             	cmp    $0x64,%edi
+  800275:	74 6b                	je     8002e2 <umain+0x292>
+				die("Too many connections");
+			fds[2 + conns].fd = c;
+  800277:	89 34 dd 00 72 80 00 	mov    %esi,0x807200(,%ebx,8)
+			fds[2 + conns].events = POLLIN;
+  80027e:	66 c7 04 dd 04 72 80 	movw   $0x1,0x807204(,%ebx,8)
+  800285:	00 01 00 
+			if (++conns == NCONN)
+  800288:	83 c7 01             	add    $0x1,%edi
+  80028b:	83 ff 64             	cmp    $0x64,%edi
+  80028e:	0f 85 55 01 00 00    	jne    8003e9 <umain+0x399>
+				fds[0].fd = -1;
+  800294:	c7 05 00 72 80 00 ff 	movl   $0xffffffff,0x807200
+  80029b:	ff ff ff 
+				close(fds[1].fd);
+				fds[1].fd = -1;
+			} else
+				ticks += n;
+		}
+		for (i = 2; i < 2 + conns; i++) {
+  80029e:	8d 47 02             	lea    0x2(%edi),%eax
+		if (fds[1].revents) {
+  8002a1:	66 83 3d 0e 72 80 00 	cmpw   $0x0,0x80720e
+  8002a8:	00 
+  8002a9:	0f 84 50 01 00 00    	je     8003ff <umain+0x3af>
+			if ((n = read(fds[1].fd, buf, sizeof(buf))) <= 0) {
+  8002af:	83 ec 04             	sub    $0x4,%esp
+  8002b2:	68 00 02 00 00       	push   $0x200
+  8002b7:	68 00 70 80 00       	push   $0x807000
+  8002bc:	ff 35 08 72 80 00    	push   0x807208
+  8002c2:	e8 46 1d 00 00       	call   80200d <read>
+  8002c7:	83 c4 10             	add    $0x10,%esp
+  8002ca:	85 c0                	test   %eax,%eax
+  8002cc:	7e 34                	jle    800302 <umain+0x2b2>
+				ticks += n;
+  8002ce:	01 45 b0             	add    %eax,-0x50(%ebp)
+  8002d1:	e9 21 01 00 00       	jmp    8003f7 <umain+0x3a7>
+				die("Failed to accept client connection");
+  8002d6:	b8 90 53 80 00       	mov    $0x805390,%eax
+  8002db:	e8 55 fd ff ff       	call   800035 <die>
+  8002e0:	eb 90                	jmp    800272 <umain+0x222>
+				die("Too many connections");
+  8002e2:	b8 10 53 80 00       	mov    $0x805310,%eax
+  8002e7:	e8 49 fd ff ff       	call   800035 <die>
+			fds[2 + conns].fd = c;
+  8002ec:	89 35 30 75 80 00    	mov    %esi,0x807530
+			fds[2 + conns].events = POLLIN;
+  8002f2:	66 c7 05 34 75 80 00 	movw   $0x1,0x807534
+  8002f9:	01 00 
+			if (++conns == NCONN)
+  8002fb:	bf 65 00 00 00       	mov    $0x65,%edi
+  800300:	eb 9c                	jmp    80029e <umain+0x24e>
+				close(fds[1].fd);
+  800302:	83 ec 0c             	sub    $0xc,%esp
+  800305:	ff 35 08 72 80 00    	push   0x807208
+  80030b:	e8 be 1b 00 00       	call   801ece <close>
+				fds[1].fd = -1;
+  800310:	c7 05 08 72 80 00 ff 	movl   $0xffffffff,0x807208
+  800317:	ff ff ff 
+  80031a:	83 c4 10             	add    $0x10,%esp
+  80031d:	e9 d5 00 00 00       	jmp    8003f7 <umain+0x3a7>
+			if (!fds[i].revents)
+				continue;
+			if ((n = read(fds[i].fd, buf, sizeof(buf))) <= 0) {
+				close(fds[i].fd);
+  800322:	83 ec 0c             	sub    $0xc,%esp
+  800325:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  800328:	ff 34 f5 00 72 80 00 	push   0x807200(,%esi,8)
+  80032f:	e8 9a 1b 00 00       	call   801ece <close>
+				fds[i].fd = -1;
+  800334:	c7 04 f5 00 72 80 00 	movl   $0xffffffff,0x807200(,%esi,8)
+  80033b:	ff ff ff ff 
+				closed++;
+  80033f:	83 45 c0 01          	addl   $0x1,-0x40(%ebp)
+  800343:	83 c4 10             	add    $0x10,%esp
+		for (i = 2; i < 2 + conns; i++) {
+  800346:	83 c3 01             	add    $0x1,%ebx
+  800349:	39 fb                	cmp    %edi,%ebx
+  80034b:	74 5b                	je     8003a8 <umain+0x358>
+			if (!fds[i].revents)
+  80034d:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+  800350:	66 83 3c dd 06 72 80 	cmpw   $0x0,0x807206(,%ebx,8)
+  800357:	00 00 
+  800359:	74 eb                	je     800346 <umain+0x2f6>
+			if ((n = read(fds[i].fd, buf, sizeof(buf))) <= 0) {
+  80035b:	83 ec 04             	sub    $0x4,%esp
+  80035e:	68 00 02 00 00       	push   $0x200
+  800363:	68 00 70 80 00       	push   $0x807000
+  800368:	ff 34 dd 00 72 80 00 	push   0x807200(,%ebx,8)
+  80036f:	e8 99 1c 00 00       	call   80200d <read>
+  800374:	89 c6                	mov    %eax,%esi
+  800376:	83 c4 10             	add    $0x10,%esp
+  800379:	85 c0                	test   %eax,%eax
+  80037b:	7e a5                	jle    800322 <umain+0x2d2>
+			} else if (write(fds[i].fd, buf, n) != n)
+  80037d:	83 ec 04             	sub    $0x4,%esp
+  800380:	50                   	push   %eax
+  800381:	68 00 70 80 00       	push   $0x807000
+  800386:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800389:	ff 34 c5 00 72 80 00 	push   0x807200(,%eax,8)
+  800390:	e8 70 1d 00 00       	call   802105 <write>
+  800395:	83 c4 10             	add    $0x10,%esp
+  800398:	39 f0                	cmp    %esi,%eax
+  80039a:	74 aa                	je     800346 <umain+0x2f6>
+				die("Failed to send bytes to client");
+  80039c:	b8 b4 53 80 00       	mov    $0x8053b4,%eax
+  8003a1:	e8 8f fc ff ff       	call   800035 <die>
+  8003a6:	eb 9e                	jmp    800346 <umain+0x2f6>
+  8003a8:	8b 7d bc             	mov    -0x44(%ebp),%edi
+	while (closed < NCONN || fds[1].fd >= 0) {
+  8003ab:	83 7d c0 63          	cmpl   $0x63,-0x40(%ebp)
+  8003af:	76 09                	jbe    8003ba <umain+0x36a>
+  8003b1:	83 3d 08 72 80 00 00 	cmpl   $0x0,0x807208
+  8003b8:	78 54                	js     80040e <umain+0x3be>
+		if ((r = poll(fds, 2 + conns, -1)) < 0)
+  8003ba:	8d 5f 02             	lea    0x2(%edi),%ebx
+  8003bd:	83 ec 04             	sub    $0x4,%esp
+  8003c0:	6a ff                	push   $0xffffffff
+  8003c2:	53                   	push   %ebx
+  8003c3:	68 00 72 80 00       	push   $0x807200
+  8003c8:	e8 46 3b 00 00       	call   803f13 <poll>
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	85 c0                	test   %eax,%eax
+  8003d2:	0f 88 65 fe ff ff    	js     80023d <umain+0x1ed>
+		polls++;
+  8003d8:	83 45 b8 01          	addl   $0x1,-0x48(%ebp)
+		if (fds[0].revents & POLLIN) {
+  8003dc:	f6 05 06 72 80 00 01 	testb  $0x1,0x807206
+  8003e3:	0f 85 66 fe ff ff    	jne    80024f <umain+0x1ff>
+		if (fds[1].revents) {
+  8003e9:	66 83 3d 0e 72 80 00 	cmpw   $0x0,0x80720e
+  8003f0:	00 
+  8003f1:	0f 85 b8 fe ff ff    	jne    8002af <umain+0x25f>
+		for (i = 2; i < 2 + conns; i++) {
+  8003f7:	8d 47 02             	lea    0x2(%edi),%eax
+  8003fa:	83 f8 02             	cmp    $0x2,%eax
+  8003fd:	76 ac                	jbe    8003ab <umain+0x35b>
+  8003ff:	bb 02 00 00 00       	mov    $0x2,%ebx
+  800404:	89 7d bc             	mov    %edi,-0x44(%ebp)
+  800407:	89 c7                	mov    %eax,%edi
+  800409:	e9 3f ff ff ff       	jmp    80034d <umain+0x2fd>
+		}
+	}
+	close(s);
+  80040e:	83 ec 0c             	sub    $0xc,%esp
+  800411:	ff 75 b4             	push   -0x4c(%ebp)
+  800414:	e8 b5 1a 00 00       	call   801ece <close>
+
+	cprintf("testpoll: %u connections, %u pipe messages, %u polls\n",
+		conns, ticks / strlen(TICK), polls);
+  800419:	c7 04 24 c6 52 80 00 	movl   $0x8052c6,(%esp)
+  800420:	e8 8e 08 00 00       	call   800cb3 <strlen>
+  800425:	89 c1                	mov    %eax,%ecx
+	cprintf("testpoll: %u connections, %u pipe messages, %u polls\n",
+  800427:	ff 75 b8             	push   -0x48(%ebp)
+  80042a:	8b 45 b0             	mov    -0x50(%ebp),%eax
+  80042d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800432:	f7 f1                	div    %ecx
+  800434:	50                   	push   %eax
+  800435:	57                   	push   %edi
+  800436:	68 d4 53 80 00       	push   $0x8053d4
+  80043b:	e8 c8 01 00 00       	call   800608 <cprintf>
+	if (ticks != NTICK * strlen(TICK))
+  800440:	83 c4 14             	add    $0x14,%esp
+  800443:	68 c6 52 80 00       	push   $0x8052c6
+  800448:	e8 66 08 00 00       	call   800cb3 <strlen>
+  80044d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800450:	c1 e0 02             	shl    $0x2,%eax
+  800453:	83 c4 10             	add    $0x10,%esp
+  800456:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+  800459:	39 c8                	cmp    %ecx,%eax
+  80045b:	75 15                	jne    800472 <umain+0x422>
+		panic("lost pipe messages");
+	cprintf("testpoll: OK\n");
+  80045d:	83 ec 0c             	sub    $0xc,%esp
+  800460:	68 38 53 80 00       	push   $0x805338
+  800465:	e8 9e 01 00 00       	call   800608 <cprintf>
+}
+  80046a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046d:	5b                   	pop    %ebx
+  80046e:	5e                   	pop    %esi
+  80046f:	5f                   	pop    %edi
+  800470:	5d                   	pop    %ebp
+  800471:	c3                   	ret
+		panic("lost pipe messages");
+  800472:	83 ec 04             	sub    $0x4,%esp
+  800475:	68 25 53 80 00       	push   $0x805325
+  80047a:	6a 72                	push   $0x72
+  80047c:	68 b6 52 80 00       	push   $0x8052b6
+  800481:	e8 a7 00 00 00       	call   80052d <_panic>
+
+00800486 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800486:	55                   	push   %ebp
+  800487:	89 e5                	mov    %esp,%ebp
+  800489:	56                   	push   %esi
+  80048a:	53                   	push   %ebx
+  80048b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800491:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800493:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800498:	29 d0                	sub    %edx,%eax
+  80049a:	89 c2                	mov    %eax,%edx
+  80049c:	c1 ea 0f             	shr    $0xf,%edx
+  80049f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8004a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a9:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8004ac:	c7 04 85 60 8f 80 00 	movl   $0x0,0x808f60(,%eax,4)
+  8004b3:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8004b7:	e8 39 0c 00 00       	call   8010f5 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8004bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004c1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8004c7:	89 e1                	mov    %esp,%ecx
+  8004c9:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8004ce:	29 ca                	sub    %ecx,%edx
+  8004d0:	89 d1                	mov    %edx,%ecx
+  8004d2:	c1 e9 0f             	shr    $0xf,%ecx
+  8004d5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8004db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e0:	0f 42 d1             	cmovb  %ecx,%edx
+  8004e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004e8:	89 04 95 60 8f 80 00 	mov    %eax,0x808f60(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004ef:	85 db                	test   %ebx,%ebx
+  8004f1:	7e 07                	jle    8004fa <libmain+0x74>
+		binaryname = argv[0];
+  8004f3:	8b 06                	mov    (%esi),%eax
+  8004f5:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8004fa:	83 ec 08             	sub    $0x8,%esp
+  8004fd:	56                   	push   %esi
+  8004fe:	53                   	push   %ebx
+  8004ff:	e8 4c fb ff ff       	call   800050 <umain>
+
+	// exit gracefully
+	exit();
+  800504:	e8 0a 00 00 00       	call   800513 <exit>
+}
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80050f:	5b                   	pop    %ebx
+  800510:	5e                   	pop    %esi
+  800511:	5d                   	pop    %ebp
+  800512:	c3                   	ret
+
+00800513 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800513:	55                   	push   %ebp
+  800514:	89 e5                	mov    %esp,%ebp
+  800516:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800519:	e8 dd 19 00 00       	call   801efb <close_all>
+	sys_env_destroy(0);
+  80051e:	83 ec 0c             	sub    $0xc,%esp
+  800521:	6a 00                	push   $0x0
+  800523:	e8 8c 0b 00 00       	call   8010b4 <sys_env_destroy>
+}
+  800528:	83 c4 10             	add    $0x10,%esp
+  80052b:	c9                   	leave
+  80052c:	c3                   	ret
+
+0080052d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80052d:	55                   	push   %ebp
+  80052e:	89 e5                	mov    %esp,%ebp
+  800530:	56                   	push   %esi
+  800531:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800532:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800535:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80053b:	e8 b5 0b 00 00       	call   8010f5 <sys_getenvid>
+  800540:	83 ec 0c             	sub    $0xc,%esp
+  800543:	ff 75 0c             	push   0xc(%ebp)
+  800546:	ff 75 08             	push   0x8(%ebp)
+  800549:	56                   	push   %esi
+  80054a:	50                   	push   %eax
+  80054b:	68 14 54 80 00       	push   $0x805414
+  800550:	e8 b3 00 00 00       	call   800608 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800555:	83 c4 18             	add    $0x18,%esp
+  800558:	53                   	push   %ebx
+  800559:	ff 75 10             	push   0x10(%ebp)
+  80055c:	e8 56 00 00 00       	call   8005b7 <vcprintf>
+	cprintf("\n");
+  800561:	c7 04 24 44 53 80 00 	movl   $0x805344,(%esp)
+  800568:	e8 9b 00 00 00       	call   800608 <cprintf>
+  80056d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800570:	cc                   	int3
+	while (1)
+  800571:	eb fd                	jmp    800570 <_panic+0x43>
+
+00800573 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800573:	55                   	push   %ebp
+  800574:	89 e5                	mov    %esp,%ebp
+  800576:	53                   	push   %ebx
+  800577:	83 ec 04             	sub    $0x4,%esp
+  80057a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80057d:	8b 13                	mov    (%ebx),%edx
+  80057f:	8d 42 01             	lea    0x1(%edx),%eax
+  800582:	89 03                	mov    %eax,(%ebx)
+  800584:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800587:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80058b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800590:	74 09                	je     80059b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800592:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800596:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800599:	c9                   	leave
+  80059a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80059b:	83 ec 08             	sub    $0x8,%esp
+  80059e:	68 ff 00 00 00       	push   $0xff
+  8005a3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005a6:	50                   	push   %eax
+  8005a7:	e8 cb 0a 00 00       	call   801077 <sys_cputs>
+		b->idx = 0;
+  8005ac:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005b2:	83 c4 10             	add    $0x10,%esp
+  8005b5:	eb db                	jmp    800592 <putch+0x1f>
+
+008005b7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005b7:	55                   	push   %ebp
+  8005b8:	89 e5                	mov    %esp,%ebp
+  8005ba:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005c0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005c7:	00 00 00 
+	b.cnt = 0;
+  8005ca:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005d1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005d4:	ff 75 0c             	push   0xc(%ebp)
+  8005d7:	ff 75 08             	push   0x8(%ebp)
+  8005da:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005e0:	50                   	push   %eax
+  8005e1:	68 73 05 80 00       	push   $0x800573
+  8005e6:	e8 1c 01 00 00       	call   800707 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005eb:	83 c4 08             	add    $0x8,%esp
+  8005ee:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005f4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005fa:	50                   	push   %eax
+  8005fb:	e8 77 0a 00 00       	call   801077 <sys_cputs>
+
+	return b.cnt;
+}
+  800600:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800606:	c9                   	leave
+  800607:	c3                   	ret
+
+00800608 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800608:	55                   	push   %ebp
+  800609:	89 e5                	mov    %esp,%ebp
+  80060b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80060e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800611:	50                   	push   %eax
+  800612:	ff 75 08             	push   0x8(%ebp)
+  800615:	e8 9d ff ff ff       	call   8005b7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80061a:	c9                   	leave
+  80061b:	c3                   	ret
+
+0080061c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80061c:	55                   	push   %ebp
+  80061d:	89 e5                	mov    %esp,%ebp
+  80061f:	57                   	push   %edi
+  800620:	56                   	push   %esi
+  800621:	53                   	push   %ebx
+  800622:	83 ec 1c             	sub    $0x1c,%esp
+  800625:	89 c3                	mov    %eax,%ebx
+  800627:	89 d6                	mov    %edx,%esi
+  800629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80062c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80062f:	89 d1                	mov    %edx,%ecx
+  800631:	89 c2                	mov    %eax,%edx
+  800633:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800636:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800639:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80063c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80063f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800646:	39 c2                	cmp    %eax,%edx
+  800648:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80064b:	73 4b                	jae    800698 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800653:	85 ff                	test   %edi,%edi
+  800655:	7e 11                	jle    800668 <printnum+0x4c>
+			putch(padc, putdat);
+  800657:	83 ec 08             	sub    $0x8,%esp
+  80065a:	56                   	push   %esi
+  80065b:	ff 75 18             	push   0x18(%ebp)
+  80065e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	83 ef 01             	sub    $0x1,%edi
+  800666:	75 ef                	jne    800657 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800668:	83 ec 08             	sub    $0x8,%esp
+  80066b:	56                   	push   %esi
+  80066c:	83 ec 04             	sub    $0x4,%esp
+  80066f:	ff 75 e4             	push   -0x1c(%ebp)
+  800672:	ff 75 e0             	push   -0x20(%ebp)
+  800675:	ff 75 dc             	push   -0x24(%ebp)
+  800678:	ff 75 d8             	push   -0x28(%ebp)
+  80067b:	e8 0f 4b 00 00       	call   80518f <__umoddi3>
+  800680:	83 c4 14             	add    $0x14,%esp
+  800683:	0f be 80 37 54 80 00 	movsbl 0x805437(%eax),%eax
+  80068a:	50                   	push   %eax
+  80068b:	ff d3                	call   *%ebx
+}
+  80068d:	83 c4 10             	add    $0x10,%esp
+  800690:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800693:	5b                   	pop    %ebx
+  800694:	5e                   	pop    %esi
+  800695:	5f                   	pop    %edi
+  800696:	5d                   	pop    %ebp
+  800697:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800698:	83 ec 0c             	sub    $0xc,%esp
+  80069b:	ff 75 18             	push   0x18(%ebp)
+  80069e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006a1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006a4:	52                   	push   %edx
+  8006a5:	50                   	push   %eax
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	ff 75 e4             	push   -0x1c(%ebp)
+  8006ac:	ff 75 e0             	push   -0x20(%ebp)
+  8006af:	ff 75 dc             	push   -0x24(%ebp)
+  8006b2:	ff 75 d8             	push   -0x28(%ebp)
+  8006b5:	e8 0f 4a 00 00       	call   8050c9 <__udivdi3>
+  8006ba:	83 c4 18             	add    $0x18,%esp
+  8006bd:	52                   	push   %edx
+  8006be:	50                   	push   %eax
+  8006bf:	89 f2                	mov    %esi,%edx
+  8006c1:	89 d8                	mov    %ebx,%eax
+  8006c3:	e8 54 ff ff ff       	call   80061c <printnum>
+  8006c8:	83 c4 20             	add    $0x20,%esp
+  8006cb:	eb 9b                	jmp    800668 <printnum+0x4c>
+
+008006cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006dc:	73 0a                	jae    8006e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006e1:	89 08                	mov    %ecx,(%eax)
+  8006e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e6:	88 02                	mov    %al,(%edx)
+}
+  8006e8:	5d                   	pop    %ebp
+  8006e9:	c3                   	ret
+
+008006ea <printfmt>:
+{
+  8006ea:	55                   	push   %ebp
+  8006eb:	89 e5                	mov    %esp,%ebp
+  8006ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006f3:	50                   	push   %eax
+  8006f4:	ff 75 10             	push   0x10(%ebp)
+  8006f7:	ff 75 0c             	push   0xc(%ebp)
+  8006fa:	ff 75 08             	push   0x8(%ebp)
+  8006fd:	e8 05 00 00 00       	call   800707 <vprintfmt>
+}
+  800702:	83 c4 10             	add    $0x10,%esp
+  800705:	c9                   	leave
+  800706:	c3                   	ret
+
+00800707 <vprintfmt>:
+{
+  800707:	55                   	push   %ebp
+  800708:	89 e5                	mov    %esp,%ebp
+  80070a:	57                   	push   %edi
+  80070b:	56                   	push   %esi
+  80070c:	53                   	push   %ebx
+  80070d:	83 ec 2c             	sub    $0x2c,%esp
+  800710:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800713:	89 df                	mov    %ebx,%edi
+  800715:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800718:	8b 45 10             	mov    0x10(%ebp),%eax
+  80071b:	8d 70 01             	lea    0x1(%eax),%esi
+  80071e:	0f b6 00             	movzbl (%eax),%eax
+  800721:	83 f8 25             	cmp    $0x25,%eax
+  800724:	74 1e                	je     800744 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800726:	85 c0                	test   %eax,%eax
+  800728:	0f 84 15 05 00 00    	je     800c43 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80072e:	83 ec 08             	sub    $0x8,%esp
+  800731:	53                   	push   %ebx
+  800732:	50                   	push   %eax
+  800733:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800735:	83 c6 01             	add    $0x1,%esi
+  800738:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	83 f8 25             	cmp    $0x25,%eax
+  800742:	75 e2                	jne    800726 <vprintfmt+0x1f>
+		padc = ' ';
+  800744:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800748:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80074f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800756:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80075d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800762:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800765:	8d 56 01             	lea    0x1(%esi),%edx
+  800768:	0f b6 0e             	movzbl (%esi),%ecx
+  80076b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80076e:	3c 55                	cmp    $0x55,%al
+  800770:	0f 87 3b 04 00 00    	ja     800bb1 <vprintfmt+0x4aa>
+  800776:	0f b6 c0             	movzbl %al,%eax
+  800779:	ff 24 85 a0 55 80 00 	jmp    *0x8055a0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800780:	89 75 10             	mov    %esi,0x10(%ebp)
+  800783:	eb 93                	jmp    800718 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800785:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800787:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80078b:	eb d8                	jmp    800765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80078d:	89 d6                	mov    %edx,%esi
+  80078f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800793:	eb d0                	jmp    800765 <vprintfmt+0x5e>
+  800795:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800798:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80079b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80079e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8007a2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007a5:	83 f9 09             	cmp    $0x9,%ecx
+  8007a8:	77 6f                	ja     800819 <vprintfmt+0x112>
+  8007aa:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8007ad:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8007b0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007b3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8007b7:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8007ba:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007bd:	83 fe 09             	cmp    $0x9,%esi
+  8007c0:	76 eb                	jbe    8007ad <vprintfmt+0xa6>
+  8007c2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8007c5:	89 d6                	mov    %edx,%esi
+  8007c7:	eb 13                	jmp    8007dc <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8007c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007cc:	8b 00                	mov    (%eax),%eax
+  8007ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007da:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8007dc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007e0:	79 83                	jns    800765 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8007e2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8007ef:	e9 71 ff ff ff       	jmp    800765 <vprintfmt+0x5e>
+			if (width < 0)
+  8007f4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007f7:	85 c9                	test   %ecx,%ecx
+  8007f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fe:	0f 49 c1             	cmovns %ecx,%eax
+  800801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800804:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800806:	e9 5a ff ff ff       	jmp    800765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80080b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80080d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800814:	e9 4c ff ff ff       	jmp    800765 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800819:	89 d6                	mov    %edx,%esi
+  80081b:	eb bf                	jmp    8007dc <vprintfmt+0xd5>
+			lflag++;
+  80081d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800821:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800823:	e9 3d ff ff ff       	jmp    800765 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800828:	89 55 10             	mov    %edx,0x10(%ebp)
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8d 70 04             	lea    0x4(%eax),%esi
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	53                   	push   %ebx
+  800835:	ff 30                	push   (%eax)
+  800837:	ff d7                	call   *%edi
+			break;
+  800839:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80083c:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80083f:	e9 d4 fe ff ff       	jmp    800718 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800844:	89 55 10             	mov    %edx,0x10(%ebp)
+  800847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084a:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80084d:	8b 10                	mov    (%eax),%edx
+  80084f:	89 d0                	mov    %edx,%eax
+  800851:	f7 d8                	neg    %eax
+  800853:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800856:	83 f8 12             	cmp    $0x12,%eax
+  800859:	7f 23                	jg     80087e <vprintfmt+0x177>
+  80085b:	8b 14 85 00 57 80 00 	mov    0x805700(,%eax,4),%edx
+  800862:	85 d2                	test   %edx,%edx
+  800864:	74 18                	je     80087e <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800866:	52                   	push   %edx
+  800867:	68 53 59 80 00       	push   $0x805953
+  80086c:	53                   	push   %ebx
+  80086d:	57                   	push   %edi
+  80086e:	e8 77 fe ff ff       	call   8006ea <printfmt>
+  800873:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800876:	89 75 14             	mov    %esi,0x14(%ebp)
+  800879:	e9 9a fe ff ff       	jmp    800718 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80087e:	50                   	push   %eax
+  80087f:	68 4f 54 80 00       	push   $0x80544f
+  800884:	53                   	push   %ebx
+  800885:	57                   	push   %edi
+  800886:	e8 5f fe ff ff       	call   8006ea <printfmt>
+  80088b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80088e:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800891:	e9 82 fe ff ff       	jmp    800718 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800896:	89 55 10             	mov    %edx,0x10(%ebp)
+  800899:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089c:	83 c0 04             	add    $0x4,%eax
+  80089f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 00                	mov    (%eax),%eax
+  8008a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008aa:	85 c0                	test   %eax,%eax
+  8008ac:	0f 84 61 03 00 00    	je     800c13 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8008b2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008b6:	7e 06                	jle    8008be <vprintfmt+0x1b7>
+  8008b8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008bc:	75 29                	jne    8008e7 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008be:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008c1:	8d 70 01             	lea    0x1(%eax),%esi
+  8008c4:	0f b6 00             	movzbl (%eax),%eax
+  8008c7:	0f be d0             	movsbl %al,%edx
+  8008ca:	85 d2                	test   %edx,%edx
+  8008cc:	0f 84 bb 00 00 00    	je     80098d <vprintfmt+0x286>
+  8008d2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008d5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008d8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008db:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008de:	eb 7a                	jmp    80095a <vprintfmt+0x253>
+				p = "(null)";
+  8008e0:	c7 45 d0 48 54 80 00 	movl   $0x805448,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008e7:	83 ec 08             	sub    $0x8,%esp
+  8008ea:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ed:	ff 75 d0             	push   -0x30(%ebp)
+  8008f0:	e8 e0 03 00 00       	call   800cd5 <strnlen>
+  8008f5:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  8008f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8008fb:	83 c4 10             	add    $0x10,%esp
+  8008fe:	85 d2                	test   %edx,%edx
+  800900:	0f 8e d6 02 00 00    	jle    800bdc <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800906:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80090a:	83 ec 08             	sub    $0x8,%esp
+  80090d:	53                   	push   %ebx
+  80090e:	56                   	push   %esi
+  80090f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800911:	83 c4 10             	add    $0x10,%esp
+  800914:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800918:	75 f0                	jne    80090a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80091a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80091d:	8d 70 01             	lea    0x1(%eax),%esi
+  800920:	0f b6 00             	movzbl (%eax),%eax
+  800923:	0f be d0             	movsbl %al,%edx
+  800926:	85 d2                	test   %edx,%edx
+  800928:	0f 84 da 02 00 00    	je     800c08 <vprintfmt+0x501>
+  80092e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800931:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800934:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800937:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80093a:	eb 1e                	jmp    80095a <vprintfmt+0x253>
+					putch(ch, putdat);
+  80093c:	83 ec 08             	sub    $0x8,%esp
+  80093f:	ff 75 0c             	push   0xc(%ebp)
+  800942:	52                   	push   %edx
+  800943:	ff 55 08             	call   *0x8(%ebp)
+  800946:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800949:	83 eb 01             	sub    $0x1,%ebx
+  80094c:	83 c6 01             	add    $0x1,%esi
+  80094f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800953:	0f be d0             	movsbl %al,%edx
+  800956:	85 d2                	test   %edx,%edx
+  800958:	74 2a                	je     800984 <vprintfmt+0x27d>
+  80095a:	85 ff                	test   %edi,%edi
+  80095c:	78 05                	js     800963 <vprintfmt+0x25c>
+  80095e:	83 ef 01             	sub    $0x1,%edi
+  800961:	78 59                	js     8009bc <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800963:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800967:	74 d3                	je     80093c <vprintfmt+0x235>
+  800969:	0f be c0             	movsbl %al,%eax
+  80096c:	83 e8 20             	sub    $0x20,%eax
+  80096f:	83 f8 5e             	cmp    $0x5e,%eax
+  800972:	76 c8                	jbe    80093c <vprintfmt+0x235>
+					putch('?', putdat);
+  800974:	83 ec 08             	sub    $0x8,%esp
+  800977:	ff 75 0c             	push   0xc(%ebp)
+  80097a:	6a 3f                	push   $0x3f
+  80097c:	ff 55 08             	call   *0x8(%ebp)
+  80097f:	83 c4 10             	add    $0x10,%esp
+  800982:	eb c5                	jmp    800949 <vprintfmt+0x242>
+  800984:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800987:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80098a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80098d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800990:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800994:	7e 1b                	jle    8009b1 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800996:	83 ec 08             	sub    $0x8,%esp
+  800999:	53                   	push   %ebx
+  80099a:	6a 20                	push   $0x20
+  80099c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80099e:	83 c4 10             	add    $0x10,%esp
+  8009a1:	83 ee 01             	sub    $0x1,%esi
+  8009a4:	75 f0                	jne    800996 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009a6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ac:	e9 67 fd ff ff       	jmp    800718 <vprintfmt+0x11>
+  8009b1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009b7:	e9 5c fd ff ff       	jmp    800718 <vprintfmt+0x11>
+  8009bc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009c5:	eb c6                	jmp    80098d <vprintfmt+0x286>
+	if (lflag >= 2)
+  8009c7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009ca:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009cd:	83 f9 01             	cmp    $0x1,%ecx
+  8009d0:	7f 1f                	jg     8009f1 <vprintfmt+0x2ea>
+	else if (lflag)
+  8009d2:	85 c9                	test   %ecx,%ecx
+  8009d4:	74 67                	je     800a3d <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8009d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d9:	8b 30                	mov    (%eax),%esi
+  8009db:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009de:	89 f0                	mov    %esi,%eax
+  8009e0:	c1 f8 1f             	sar    $0x1f,%eax
+  8009e3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8009e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ef:	eb 17                	jmp    800a08 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  8009f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f4:	8b 50 04             	mov    0x4(%eax),%edx
+  8009f7:	8b 00                	mov    (%eax),%eax
+  8009f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009fc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a02:	8d 40 08             	lea    0x8(%eax),%eax
+  800a05:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a08:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a0b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a0e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800a13:	85 c9                	test   %ecx,%ecx
+  800a15:	0f 89 12 01 00 00    	jns    800b2d <vprintfmt+0x426>
+				putch('-', putdat);
+  800a1b:	83 ec 08             	sub    $0x8,%esp
+  800a1e:	53                   	push   %ebx
+  800a1f:	6a 2d                	push   $0x2d
+  800a21:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a23:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a26:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a29:	f7 da                	neg    %edx
+  800a2b:	83 d1 00             	adc    $0x0,%ecx
+  800a2e:	f7 d9                	neg    %ecx
+  800a30:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a33:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a38:	e9 f0 00 00 00       	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800a3d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a40:	8b 30                	mov    (%eax),%esi
+  800a42:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a45:	89 f0                	mov    %esi,%eax
+  800a47:	c1 f8 1f             	sar    $0x1f,%eax
+  800a4a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a50:	8d 40 04             	lea    0x4(%eax),%eax
+  800a53:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a56:	eb b0                	jmp    800a08 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800a58:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a5b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a5e:	83 f9 01             	cmp    $0x1,%ecx
+  800a61:	7f 1e                	jg     800a81 <vprintfmt+0x37a>
+	else if (lflag)
+  800a63:	85 c9                	test   %ecx,%ecx
+  800a65:	74 32                	je     800a99 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800a67:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6a:	8b 10                	mov    (%eax),%edx
+  800a6c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a71:	8d 40 04             	lea    0x4(%eax),%eax
+  800a74:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a77:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800a7c:	e9 ac 00 00 00       	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a84:	8b 10                	mov    (%eax),%edx
+  800a86:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a89:	8d 40 08             	lea    0x8(%eax),%eax
+  800a8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a8f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800a94:	e9 94 00 00 00       	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9c:	8b 10                	mov    (%eax),%edx
+  800a9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa3:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aa9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800aae:	eb 7d                	jmp    800b2d <vprintfmt+0x426>
+	if (lflag >= 2)
+  800ab0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ab3:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ab6:	83 f9 01             	cmp    $0x1,%ecx
+  800ab9:	7f 1b                	jg     800ad6 <vprintfmt+0x3cf>
+	else if (lflag)
+  800abb:	85 c9                	test   %ecx,%ecx
+  800abd:	74 2c                	je     800aeb <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800abf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac2:	8b 10                	mov    (%eax),%edx
+  800ac4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac9:	8d 40 04             	lea    0x4(%eax),%eax
+  800acc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800acf:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800ad4:	eb 57                	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800ad6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad9:	8b 10                	mov    (%eax),%edx
+  800adb:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ade:	8d 40 08             	lea    0x8(%eax),%eax
+  800ae1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ae4:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800ae9:	eb 42                	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800aeb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aee:	8b 10                	mov    (%eax),%edx
+  800af0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af5:	8d 40 04             	lea    0x4(%eax),%eax
+  800af8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800afb:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b00:	eb 2b                	jmp    800b2d <vprintfmt+0x426>
+			putch('0', putdat);
+  800b02:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b05:	83 ec 08             	sub    $0x8,%esp
+  800b08:	53                   	push   %ebx
+  800b09:	6a 30                	push   $0x30
+  800b0b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800b0d:	83 c4 08             	add    $0x8,%esp
+  800b10:	53                   	push   %ebx
+  800b11:	6a 78                	push   $0x78
+  800b13:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b15:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b18:	8b 10                	mov    (%eax),%edx
+  800b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b1f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b22:	8d 40 04             	lea    0x4(%eax),%eax
+  800b25:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b28:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800b2d:	83 ec 0c             	sub    $0xc,%esp
+  800b30:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b34:	50                   	push   %eax
+  800b35:	ff 75 e4             	push   -0x1c(%ebp)
+  800b38:	56                   	push   %esi
+  800b39:	51                   	push   %ecx
+  800b3a:	52                   	push   %edx
+  800b3b:	89 da                	mov    %ebx,%edx
+  800b3d:	89 f8                	mov    %edi,%eax
+  800b3f:	e8 d8 fa ff ff       	call   80061c <printnum>
+			break;
+  800b44:	83 c4 20             	add    $0x20,%esp
+  800b47:	e9 cc fb ff ff       	jmp    800718 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800b4c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b4f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b52:	83 f9 01             	cmp    $0x1,%ecx
+  800b55:	7f 1b                	jg     800b72 <vprintfmt+0x46b>
+	else if (lflag)
+  800b57:	85 c9                	test   %ecx,%ecx
+  800b59:	74 2c                	je     800b87 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800b5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b5e:	8b 10                	mov    (%eax),%edx
+  800b60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b65:	8d 40 04             	lea    0x4(%eax),%eax
+  800b68:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b6b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800b70:	eb bb                	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b72:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b75:	8b 10                	mov    (%eax),%edx
+  800b77:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b7a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b7d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b80:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800b85:	eb a6                	jmp    800b2d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b87:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b8a:	8b 10                	mov    (%eax),%edx
+  800b8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b91:	8d 40 04             	lea    0x4(%eax),%eax
+  800b94:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b97:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800b9c:	eb 8f                	jmp    800b2d <vprintfmt+0x426>
+			putch(ch, putdat);
+  800b9e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ba1:	83 ec 08             	sub    $0x8,%esp
+  800ba4:	53                   	push   %ebx
+  800ba5:	6a 25                	push   $0x25
+  800ba7:	ff d7                	call   *%edi
+			break;
+  800ba9:	83 c4 10             	add    $0x10,%esp
+  800bac:	e9 67 fb ff ff       	jmp    800718 <vprintfmt+0x11>
+			putch('%', putdat);
+  800bb1:	83 ec 08             	sub    $0x8,%esp
+  800bb4:	53                   	push   %ebx
+  800bb5:	6a 25                	push   $0x25
+  800bb7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bb9:	83 c4 10             	add    $0x10,%esp
+  800bbc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bc0:	0f 84 ba fb ff ff    	je     800780 <vprintfmt+0x79>
+  800bc6:	89 75 10             	mov    %esi,0x10(%ebp)
+  800bc9:	89 f0                	mov    %esi,%eax
+  800bcb:	83 e8 01             	sub    $0x1,%eax
+  800bce:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800bd2:	75 f7                	jne    800bcb <vprintfmt+0x4c4>
+  800bd4:	89 45 10             	mov    %eax,0x10(%ebp)
+  800bd7:	e9 3c fb ff ff       	jmp    800718 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bdc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800bdf:	8d 70 01             	lea    0x1(%eax),%esi
+  800be2:	0f b6 00             	movzbl (%eax),%eax
+  800be5:	0f be d0             	movsbl %al,%edx
+  800be8:	85 d2                	test   %edx,%edx
+  800bea:	74 11                	je     800bfd <vprintfmt+0x4f6>
+  800bec:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800bef:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800bf2:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800bf5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800bf8:	e9 5d fd ff ff       	jmp    80095a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800bfd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c00:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c03:	e9 10 fb ff ff       	jmp    800718 <vprintfmt+0x11>
+  800c08:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c0e:	e9 05 fb ff ff       	jmp    800718 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800c13:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c17:	7e 0a                	jle    800c23 <vprintfmt+0x51c>
+  800c19:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c1d:	0f 85 bd fc ff ff    	jne    8008e0 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c23:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c28:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c2d:	be 49 54 80 00       	mov    $0x805449,%esi
+  800c32:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c35:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c38:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c3b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c3e:	e9 17 fd ff ff       	jmp    80095a <vprintfmt+0x253>
+}
+  800c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c46:	5b                   	pop    %ebx
+  800c47:	5e                   	pop    %esi
+  800c48:	5f                   	pop    %edi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	83 ec 18             	sub    $0x18,%esp
+  800c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c54:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c57:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c5a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c5e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c61:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	74 26                	je     800c92 <vsnprintf+0x47>
+  800c6c:	85 d2                	test   %edx,%edx
+  800c6e:	7e 22                	jle    800c92 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c70:	ff 75 14             	push   0x14(%ebp)
+  800c73:	ff 75 10             	push   0x10(%ebp)
+  800c76:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c79:	50                   	push   %eax
+  800c7a:	68 cd 06 80 00       	push   $0x8006cd
+  800c7f:	e8 83 fa ff ff       	call   800707 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c84:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c87:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c8d:	83 c4 10             	add    $0x10,%esp
+}
+  800c90:	c9                   	leave
+  800c91:	c3                   	ret
+		return -E_INVAL;
+  800c92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c97:	eb f7                	jmp    800c90 <vsnprintf+0x45>
+
+00800c99 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c9f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800ca2:	50                   	push   %eax
+  800ca3:	ff 75 10             	push   0x10(%ebp)
+  800ca6:	ff 75 0c             	push   0xc(%ebp)
+  800ca9:	ff 75 08             	push   0x8(%ebp)
+  800cac:	e8 9a ff ff ff       	call   800c4b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800cb1:	c9                   	leave
+  800cb2:	c3                   	ret
+
+00800cb3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cb3:	55                   	push   %ebp
+  800cb4:	89 e5                	mov    %esp,%ebp
+  800cb6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800cb9:	80 3a 00             	cmpb   $0x0,(%edx)
+  800cbc:	74 10                	je     800cce <strlen+0x1b>
+  800cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800cc3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cc6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cca:	75 f7                	jne    800cc3 <strlen+0x10>
+	return n;
+}
+  800ccc:	5d                   	pop    %ebp
+  800ccd:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800cce:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800cd3:	eb f7                	jmp    800ccc <strlen+0x19>
+
+00800cd5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cdb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cde:	85 d2                	test   %edx,%edx
+  800ce0:	74 16                	je     800cf8 <strnlen+0x23>
+  800ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ceb:	74 09                	je     800cf6 <strnlen+0x21>
+		n++;
+  800ced:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf0:	39 d0                	cmp    %edx,%eax
+  800cf2:	75 f3                	jne    800ce7 <strnlen+0x12>
+		n++;
+  800cf4:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800cf6:	5d                   	pop    %ebp
+  800cf7:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfd:	eb f7                	jmp    800cf6 <strnlen+0x21>
+
+00800cff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	53                   	push   %ebx
+  800d03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d12:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d15:	83 c0 01             	add    $0x1,%eax
+  800d18:	84 d2                	test   %dl,%dl
+  800d1a:	75 f2                	jne    800d0e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d1c:	89 c8                	mov    %ecx,%eax
+  800d1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d21:	c9                   	leave
+  800d22:	c3                   	ret
+
+00800d23 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	53                   	push   %ebx
+  800d27:	83 ec 10             	sub    $0x10,%esp
+  800d2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d2d:	53                   	push   %ebx
+  800d2e:	e8 80 ff ff ff       	call   800cb3 <strlen>
+  800d33:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d36:	ff 75 0c             	push   0xc(%ebp)
+  800d39:	01 d8                	add    %ebx,%eax
+  800d3b:	50                   	push   %eax
+  800d3c:	e8 be ff ff ff       	call   800cff <strcpy>
+	return dst;
+}
+  800d41:	89 d8                	mov    %ebx,%eax
+  800d43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d46:	c9                   	leave
+  800d47:	c3                   	ret
+
+00800d48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	56                   	push   %esi
+  800d4c:	53                   	push   %ebx
+  800d4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d53:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d56:	85 db                	test   %ebx,%ebx
+  800d58:	74 17                	je     800d71 <strncpy+0x29>
+  800d5a:	01 f3                	add    %esi,%ebx
+  800d5c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800d5e:	83 c0 01             	add    $0x1,%eax
+  800d61:	0f b6 0a             	movzbl (%edx),%ecx
+  800d64:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d67:	80 f9 01             	cmp    $0x1,%cl
+  800d6a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d6d:	39 c3                	cmp    %eax,%ebx
+  800d6f:	75 ed                	jne    800d5e <strncpy+0x16>
+	}
+	return ret;
+}
+  800d71:	89 f0                	mov    %esi,%eax
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+
+00800d77 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d77:	55                   	push   %ebp
+  800d78:	89 e5                	mov    %esp,%ebp
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d85:	89 f0                	mov    %esi,%eax
+  800d87:	85 db                	test   %ebx,%ebx
+  800d89:	74 1e                	je     800da9 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800d8b:	83 eb 01             	sub    $0x1,%ebx
+  800d8e:	74 16                	je     800da6 <strlcpy+0x2f>
+  800d90:	01 f3                	add    %esi,%ebx
+  800d92:	0f b6 0a             	movzbl (%edx),%ecx
+  800d95:	84 c9                	test   %cl,%cl
+  800d97:	74 0d                	je     800da6 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800d99:	83 c2 01             	add    $0x1,%edx
+  800d9c:	83 c0 01             	add    $0x1,%eax
+  800d9f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800da2:	39 d8                	cmp    %ebx,%eax
+  800da4:	75 ec                	jne    800d92 <strlcpy+0x1b>
+		*dst = '\0';
+  800da6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800da9:	29 f0                	sub    %esi,%eax
+}
+  800dab:	5b                   	pop    %ebx
+  800dac:	5e                   	pop    %esi
+  800dad:	5d                   	pop    %ebp
+  800dae:	c3                   	ret
+
+00800daf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800db5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800db8:	0f b6 01             	movzbl (%ecx),%eax
+  800dbb:	84 c0                	test   %al,%al
+  800dbd:	74 11                	je     800dd0 <strcmp+0x21>
+  800dbf:	38 02                	cmp    %al,(%edx)
+  800dc1:	75 0d                	jne    800dd0 <strcmp+0x21>
+		p++, q++;
+  800dc3:	83 c1 01             	add    $0x1,%ecx
+  800dc6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800dc9:	0f b6 01             	movzbl (%ecx),%eax
+  800dcc:	84 c0                	test   %al,%al
+  800dce:	75 ef                	jne    800dbf <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800dd0:	0f b6 c0             	movzbl %al,%eax
+  800dd3:	0f b6 12             	movzbl (%edx),%edx
+  800dd6:	29 d0                	sub    %edx,%eax
+}
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+
+00800dda <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800dda:	55                   	push   %ebp
+  800ddb:	89 e5                	mov    %esp,%ebp
+  800ddd:	53                   	push   %ebx
+  800dde:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800de1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800de4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800de7:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800dec:	85 d2                	test   %edx,%edx
+  800dee:	74 2e                	je     800e1e <strncmp+0x44>
+  800df0:	0f b6 01             	movzbl (%ecx),%eax
+  800df3:	84 c0                	test   %al,%al
+  800df5:	74 16                	je     800e0d <strncmp+0x33>
+  800df7:	3a 03                	cmp    (%ebx),%al
+  800df9:	75 12                	jne    800e0d <strncmp+0x33>
+		n--, p++, q++;
+  800dfb:	83 c1 01             	add    $0x1,%ecx
+  800dfe:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e01:	83 ea 01             	sub    $0x1,%edx
+  800e04:	75 ea                	jne    800df0 <strncmp+0x16>
+		return 0;
+  800e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e0b:	eb 11                	jmp    800e1e <strncmp+0x44>
+  800e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800e12:	85 d2                	test   %edx,%edx
+  800e14:	74 08                	je     800e1e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e16:	0f b6 01             	movzbl (%ecx),%eax
+  800e19:	0f b6 13             	movzbl (%ebx),%edx
+  800e1c:	29 d0                	sub    %edx,%eax
+}
+  800e1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e21:	c9                   	leave
+  800e22:	c3                   	ret
+
+00800e23 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e29:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e2d:	0f b6 10             	movzbl (%eax),%edx
+  800e30:	84 d2                	test   %dl,%dl
+  800e32:	74 15                	je     800e49 <strchr+0x26>
+		if (*s == c)
+  800e34:	38 d1                	cmp    %dl,%cl
+  800e36:	74 0f                	je     800e47 <strchr+0x24>
+	for (; *s; s++)
+  800e38:	83 c0 01             	add    $0x1,%eax
+  800e3b:	0f b6 10             	movzbl (%eax),%edx
+  800e3e:	84 d2                	test   %dl,%dl
+  800e40:	75 f2                	jne    800e34 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800e42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e47:	5d                   	pop    %ebp
+  800e48:	c3                   	ret
+	return 0;
+  800e49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e4e:	eb f7                	jmp    800e47 <strchr+0x24>
+
+00800e50 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e50:	55                   	push   %ebp
+  800e51:	89 e5                	mov    %esp,%ebp
+  800e53:	53                   	push   %ebx
+  800e54:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e57:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800e5a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800e5d:	38 d3                	cmp    %dl,%bl
+  800e5f:	74 14                	je     800e75 <strfind+0x25>
+  800e61:	89 d1                	mov    %edx,%ecx
+  800e63:	84 db                	test   %bl,%bl
+  800e65:	74 0e                	je     800e75 <strfind+0x25>
+	for (; *s; s++)
+  800e67:	83 c0 01             	add    $0x1,%eax
+  800e6a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e6d:	38 ca                	cmp    %cl,%dl
+  800e6f:	74 04                	je     800e75 <strfind+0x25>
+  800e71:	84 d2                	test   %dl,%dl
+  800e73:	75 f2                	jne    800e67 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800e75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e78:	c9                   	leave
+  800e79:	c3                   	ret
+
+00800e7a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e81:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e84:	85 c9                	test   %ecx,%ecx
+  800e86:	74 20                	je     800ea8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e88:	89 f8                	mov    %edi,%eax
+  800e8a:	09 c8                	or     %ecx,%eax
+  800e8c:	a8 03                	test   $0x3,%al
+  800e8e:	75 12                	jne    800ea2 <memset+0x28>
+		c &= 0xFF;
+  800e90:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e94:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e9a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e9d:	fc                   	cld
+  800e9e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ea0:	eb 06                	jmp    800ea8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ea2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ea5:	fc                   	cld
+  800ea6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ea8:	89 f8                	mov    %edi,%eax
+  800eaa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ead:	c9                   	leave
+  800eae:	c3                   	ret
+
+00800eaf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eb7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800eba:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ebd:	39 c6                	cmp    %eax,%esi
+  800ebf:	73 32                	jae    800ef3 <memmove+0x44>
+  800ec1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ec4:	39 d0                	cmp    %edx,%eax
+  800ec6:	73 2b                	jae    800ef3 <memmove+0x44>
+		s += n;
+		d += n;
+  800ec8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ecb:	89 d6                	mov    %edx,%esi
+  800ecd:	09 fe                	or     %edi,%esi
+  800ecf:	09 ce                	or     %ecx,%esi
+  800ed1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ed7:	75 0e                	jne    800ee7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ed9:	83 ef 04             	sub    $0x4,%edi
+  800edc:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800edf:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ee2:	fd                   	std
+  800ee3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ee5:	eb 09                	jmp    800ef0 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ee7:	83 ef 01             	sub    $0x1,%edi
+  800eea:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800eed:	fd                   	std
+  800eee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ef0:	fc                   	cld
+  800ef1:	eb 1a                	jmp    800f0d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ef3:	89 f2                	mov    %esi,%edx
+  800ef5:	09 c2                	or     %eax,%edx
+  800ef7:	09 ca                	or     %ecx,%edx
+  800ef9:	f6 c2 03             	test   $0x3,%dl
+  800efc:	75 0a                	jne    800f08 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800efe:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f01:	89 c7                	mov    %eax,%edi
+  800f03:	fc                   	cld
+  800f04:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f06:	eb 05                	jmp    800f0d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f08:	89 c7                	mov    %eax,%edi
+  800f0a:	fc                   	cld
+  800f0b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f17:	ff 75 10             	push   0x10(%ebp)
+  800f1a:	ff 75 0c             	push   0xc(%ebp)
+  800f1d:	ff 75 08             	push   0x8(%ebp)
+  800f20:	e8 8a ff ff ff       	call   800eaf <memmove>
+}
+  800f25:	c9                   	leave
+  800f26:	c3                   	ret
+
+00800f27 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f27:	55                   	push   %ebp
+  800f28:	89 e5                	mov    %esp,%ebp
+  800f2a:	56                   	push   %esi
+  800f2b:	53                   	push   %ebx
+  800f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f32:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f35:	85 f6                	test   %esi,%esi
+  800f37:	74 29                	je     800f62 <memcmp+0x3b>
+  800f39:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800f3b:	0f b6 08             	movzbl (%eax),%ecx
+  800f3e:	0f b6 1a             	movzbl (%edx),%ebx
+  800f41:	38 d9                	cmp    %bl,%cl
+  800f43:	75 11                	jne    800f56 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f45:	83 c0 01             	add    $0x1,%eax
+  800f48:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f4b:	39 c6                	cmp    %eax,%esi
+  800f4d:	75 ec                	jne    800f3b <memcmp+0x14>
+	}
+
+	return 0;
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f54:	eb 08                	jmp    800f5e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800f56:	0f b6 c1             	movzbl %cl,%eax
+  800f59:	0f b6 db             	movzbl %bl,%ebx
+  800f5c:	29 d8                	sub    %ebx,%eax
+}
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+	return 0;
+  800f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f67:	eb f5                	jmp    800f5e <memcmp+0x37>
+
+00800f69 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f72:	89 c2                	mov    %eax,%edx
+  800f74:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f77:	39 d0                	cmp    %edx,%eax
+  800f79:	73 0d                	jae    800f88 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f7b:	38 08                	cmp    %cl,(%eax)
+  800f7d:	74 0d                	je     800f8c <memfind+0x23>
+	for (; s < ends; s++)
+  800f7f:	83 c0 01             	add    $0x1,%eax
+  800f82:	39 c2                	cmp    %eax,%edx
+  800f84:	75 f5                	jne    800f7b <memfind+0x12>
+  800f86:	eb 06                	jmp    800f8e <memfind+0x25>
+  800f88:	89 c2                	mov    %eax,%edx
+  800f8a:	eb 02                	jmp    800f8e <memfind+0x25>
+  800f8c:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800f8e:	89 d0                	mov    %edx,%eax
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800f9e:	0f b6 02             	movzbl (%edx),%eax
+  800fa1:	3c 20                	cmp    $0x20,%al
+  800fa3:	74 04                	je     800fa9 <strtol+0x17>
+  800fa5:	3c 09                	cmp    $0x9,%al
+  800fa7:	75 0e                	jne    800fb7 <strtol+0x25>
+		s++;
+  800fa9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fac:	0f b6 02             	movzbl (%edx),%eax
+  800faf:	3c 20                	cmp    $0x20,%al
+  800fb1:	74 f6                	je     800fa9 <strtol+0x17>
+  800fb3:	3c 09                	cmp    $0x9,%al
+  800fb5:	74 f2                	je     800fa9 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fb7:	3c 2b                	cmp    $0x2b,%al
+  800fb9:	74 2a                	je     800fe5 <strtol+0x53>
+	int neg = 0;
+  800fbb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fc0:	3c 2d                	cmp    $0x2d,%al
+  800fc2:	74 2b                	je     800fef <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fc4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fca:	75 0f                	jne    800fdb <strtol+0x49>
+  800fcc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fcf:	74 28                	je     800ff9 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fd1:	85 db                	test   %ebx,%ebx
+  800fd3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd8:	0f 44 d8             	cmove  %eax,%ebx
+  800fdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fe3:	eb 46                	jmp    80102b <strtol+0x99>
+		s++;
+  800fe5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fed:	eb d5                	jmp    800fc4 <strtol+0x32>
+		s++, neg = 1;
+  800fef:	83 c2 01             	add    $0x1,%edx
+  800ff2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ff7:	eb cb                	jmp    800fc4 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ff9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ffd:	74 0e                	je     80100d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800fff:	85 db                	test   %ebx,%ebx
+  801001:	75 d8                	jne    800fdb <strtol+0x49>
+		s++, base = 8;
+  801003:	83 c2 01             	add    $0x1,%edx
+  801006:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80100b:	eb ce                	jmp    800fdb <strtol+0x49>
+		s += 2, base = 16;
+  80100d:	83 c2 02             	add    $0x2,%edx
+  801010:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801015:	eb c4                	jmp    800fdb <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801017:	0f be c0             	movsbl %al,%eax
+  80101a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80101d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801020:	7d 3a                	jge    80105c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801022:	83 c2 01             	add    $0x1,%edx
+  801025:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801029:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80102b:	0f b6 02             	movzbl (%edx),%eax
+  80102e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801031:	89 f3                	mov    %esi,%ebx
+  801033:	80 fb 09             	cmp    $0x9,%bl
+  801036:	76 df                	jbe    801017 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  801038:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80103b:	89 f3                	mov    %esi,%ebx
+  80103d:	80 fb 19             	cmp    $0x19,%bl
+  801040:	77 08                	ja     80104a <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801042:	0f be c0             	movsbl %al,%eax
+  801045:	83 e8 57             	sub    $0x57,%eax
+  801048:	eb d3                	jmp    80101d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80104a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80104d:	89 f3                	mov    %esi,%ebx
+  80104f:	80 fb 19             	cmp    $0x19,%bl
+  801052:	77 08                	ja     80105c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  801054:	0f be c0             	movsbl %al,%eax
+  801057:	83 e8 37             	sub    $0x37,%eax
+  80105a:	eb c1                	jmp    80101d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80105c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801060:	74 05                	je     801067 <strtol+0xd5>
+		*endptr = (char *) s;
+  801062:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801065:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801067:	89 c8                	mov    %ecx,%eax
+  801069:	f7 d8                	neg    %eax
+  80106b:	85 ff                	test   %edi,%edi
+  80106d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801070:	89 c8                	mov    %ecx,%eax
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	89 c3                	mov    %eax,%ebx
+  80108a:	89 c7                	mov    %eax,%edi
+  80108c:	89 c6                	mov    %eax,%esi
+  80108e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+
+00801095 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	57                   	push   %edi
+  801099:	56                   	push   %esi
+  80109a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010a5:	89 d1                	mov    %edx,%ecx
+  8010a7:	89 d3                	mov    %edx,%ebx
+  8010a9:	89 d7                	mov    %edx,%edi
+  8010ab:	89 d6                	mov    %edx,%esi
+  8010ad:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5e                   	pop    %esi
+  8010b1:	5f                   	pop    %edi
+  8010b2:	5d                   	pop    %ebp
+  8010b3:	c3                   	ret
+
+008010b4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010ca:	89 cb                	mov    %ecx,%ebx
+  8010cc:	89 cf                	mov    %ecx,%edi
+  8010ce:	89 ce                	mov    %ecx,%esi
+  8010d0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d2:	85 c0                	test   %eax,%eax
+  8010d4:	7f 08                	jg     8010de <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	6a 03                	push   $0x3
+  8010e4:	68 6b 57 80 00       	push   $0x80576b
+  8010e9:	6a 23                	push   $0x23
+  8010eb:	68 88 57 80 00       	push   $0x805788
+  8010f0:	e8 38 f4 ff ff       	call   80052d <_panic>
+
+008010f5 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801100:	b8 02 00 00 00       	mov    $0x2,%eax
+  801105:	89 d1                	mov    %edx,%ecx
+  801107:	89 d3                	mov    %edx,%ebx
+  801109:	89 d7                	mov    %edx,%edi
+  80110b:	89 d6                	mov    %edx,%esi
+  80110d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  801117:	57                   	push   %edi
+  801118:	56                   	push   %esi
+  801119:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801124:	89 d1                	mov    %edx,%ecx
+  801126:	89 d3                	mov    %edx,%ebx
+  801128:	89 d7                	mov    %edx,%edi
+  80112a:	89 d6                	mov    %edx,%esi
+  80112c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80112e:	5b                   	pop    %ebx
+  80112f:	5e                   	pop    %esi
+  801130:	5f                   	pop    %edi
+  801131:	5d                   	pop    %ebp
+  801132:	c3                   	ret
+
+00801133 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	57                   	push   %edi
+  801137:	56                   	push   %esi
+  801138:	53                   	push   %ebx
+  801139:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80113c:	be 00 00 00 00       	mov    $0x0,%esi
+  801141:	8b 55 08             	mov    0x8(%ebp),%edx
+  801144:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801147:	b8 04 00 00 00       	mov    $0x4,%eax
+  80114c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114f:	89 f7                	mov    %esi,%edi
+  801151:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801153:	85 c0                	test   %eax,%eax
+  801155:	7f 08                	jg     80115f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801157:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115a:	5b                   	pop    %ebx
+  80115b:	5e                   	pop    %esi
+  80115c:	5f                   	pop    %edi
+  80115d:	5d                   	pop    %ebp
+  80115e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  801162:	50                   	push   %eax
+  801163:	6a 04                	push   $0x4
+  801165:	68 6b 57 80 00       	push   $0x80576b
+  80116a:	6a 23                	push   $0x23
+  80116c:	68 88 57 80 00       	push   $0x805788
+  801171:	e8 b7 f3 ff ff       	call   80052d <_panic>
+
+00801176 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801176:	55                   	push   %ebp
+  801177:	89 e5                	mov    %esp,%ebp
+  801179:	57                   	push   %edi
+  80117a:	56                   	push   %esi
+  80117b:	53                   	push   %ebx
+  80117c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80117f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801182:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801185:	b8 05 00 00 00       	mov    $0x5,%eax
+  80118a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80118d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801190:	8b 75 18             	mov    0x18(%ebp),%esi
+  801193:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801195:	85 c0                	test   %eax,%eax
+  801197:	7f 08                	jg     8011a1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a1:	83 ec 0c             	sub    $0xc,%esp
+  8011a4:	50                   	push   %eax
+  8011a5:	6a 05                	push   $0x5
+  8011a7:	68 6b 57 80 00       	push   $0x80576b
+  8011ac:	6a 23                	push   $0x23
+  8011ae:	68 88 57 80 00       	push   $0x805788
+  8011b3:	e8 75 f3 ff ff       	call   80052d <_panic>
+
+008011b8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  8011be:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011d1:	89 df                	mov    %ebx,%edi
+  8011d3:	89 de                	mov    %ebx,%esi
+  8011d5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d7:	85 c0                	test   %eax,%eax
+  8011d9:	7f 08                	jg     8011e3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8011db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011de:	5b                   	pop    %ebx
+  8011df:	5e                   	pop    %esi
+  8011e0:	5f                   	pop    %edi
+  8011e1:	5d                   	pop    %ebp
+  8011e2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e3:	83 ec 0c             	sub    $0xc,%esp
+  8011e6:	50                   	push   %eax
+  8011e7:	6a 06                	push   $0x6
+  8011e9:	68 6b 57 80 00       	push   $0x80576b
+  8011ee:	6a 23                	push   $0x23
+  8011f0:	68 88 57 80 00       	push   $0x805788
+  8011f5:	e8 33 f3 ff ff       	call   80052d <_panic>
+
+008011fa <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011fa:	55                   	push   %ebp
+  8011fb:	89 e5                	mov    %esp,%ebp
+  8011fd:	57                   	push   %edi
+  8011fe:	56                   	push   %esi
+  8011ff:	53                   	push   %ebx
+  801200:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801213:	89 df                	mov    %ebx,%edi
+  801215:	89 de                	mov    %ebx,%esi
+  801217:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801219:	85 c0                	test   %eax,%eax
+  80121b:	7f 08                	jg     801225 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80121d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801220:	5b                   	pop    %ebx
+  801221:	5e                   	pop    %esi
+  801222:	5f                   	pop    %edi
+  801223:	5d                   	pop    %ebp
+  801224:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801225:	83 ec 0c             	sub    $0xc,%esp
+  801228:	50                   	push   %eax
+  801229:	6a 08                	push   $0x8
+  80122b:	68 6b 57 80 00       	push   $0x80576b
+  801230:	6a 23                	push   $0x23
+  801232:	68 88 57 80 00       	push   $0x805788
+  801237:	e8 f1 f2 ff ff       	call   80052d <_panic>
+
+0080123c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	57                   	push   %edi
+  801240:	56                   	push   %esi
+  801241:	53                   	push   %ebx
+  801242:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801250:	b8 09 00 00 00       	mov    $0x9,%eax
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	7f 08                	jg     801267 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80125f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801267:	83 ec 0c             	sub    $0xc,%esp
+  80126a:	50                   	push   %eax
+  80126b:	6a 09                	push   $0x9
+  80126d:	68 6b 57 80 00       	push   $0x80576b
+  801272:	6a 23                	push   $0x23
+  801274:	68 88 57 80 00       	push   $0x805788
+  801279:	e8 af f2 ff ff       	call   80052d <_panic>
+
+0080127e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+  801284:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801287:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801292:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801297:	89 df                	mov    %ebx,%edi
+  801299:	89 de                	mov    %ebx,%esi
+  80129b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80129d:	85 c0                	test   %eax,%eax
+  80129f:	7f 08                	jg     8012a9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a4:	5b                   	pop    %ebx
+  8012a5:	5e                   	pop    %esi
+  8012a6:	5f                   	pop    %edi
+  8012a7:	5d                   	pop    %ebp
+  8012a8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a9:	83 ec 0c             	sub    $0xc,%esp
+  8012ac:	50                   	push   %eax
+  8012ad:	6a 0a                	push   $0xa
+  8012af:	68 6b 57 80 00       	push   $0x80576b
+  8012b4:	6a 23                	push   $0x23
+  8012b6:	68 88 57 80 00       	push   $0x805788
+  8012bb:	e8 6d f2 ff ff       	call   80052d <_panic>
+
+008012c0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012c0:	55                   	push   %ebp
+  8012c1:	89 e5                	mov    %esp,%ebp
+  8012c3:	57                   	push   %edi
+  8012c4:	56                   	push   %esi
+  8012c5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8012d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012dc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012de:	5b                   	pop    %ebx
+  8012df:	5e                   	pop    %esi
+  8012e0:	5f                   	pop    %edi
+  8012e1:	5d                   	pop    %ebp
+  8012e2:	c3                   	ret
+
+008012e3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012e3:	55                   	push   %ebp
+  8012e4:	89 e5                	mov    %esp,%ebp
+  8012e6:	57                   	push   %edi
+  8012e7:	56                   	push   %esi
+  8012e8:	53                   	push   %ebx
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012f9:	89 cb                	mov    %ecx,%ebx
+  8012fb:	89 cf                	mov    %ecx,%edi
+  8012fd:	89 ce                	mov    %ecx,%esi
+  8012ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801301:	85 c0                	test   %eax,%eax
+  801303:	7f 08                	jg     80130d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801305:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801308:	5b                   	pop    %ebx
+  801309:	5e                   	pop    %esi
+  80130a:	5f                   	pop    %edi
+  80130b:	5d                   	pop    %ebp
+  80130c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80130d:	83 ec 0c             	sub    $0xc,%esp
+  801310:	50                   	push   %eax
+  801311:	6a 0d                	push   $0xd
+  801313:	68 6b 57 80 00       	push   $0x80576b
+  801318:	6a 23                	push   $0x23
+  80131a:	68 88 57 80 00       	push   $0x805788
+  80131f:	e8 09 f2 ff ff       	call   80052d <_panic>
+
+00801324 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801324:	55                   	push   %ebp
+  801325:	89 e5                	mov    %esp,%ebp
+  801327:	57                   	push   %edi
+  801328:	56                   	push   %esi
+  801329:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80132a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801330:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801335:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801338:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80133e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801340:	5b                   	pop    %ebx
+  801341:	5e                   	pop    %esi
+  801342:	5f                   	pop    %edi
+  801343:	5d                   	pop    %ebp
+  801344:	c3                   	ret
+
+00801345 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80135e:	89 df                	mov    %ebx,%edi
+  801360:	89 de                	mov    %ebx,%esi
+  801362:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 08                	jg     801370 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 0d                	push   $0xd
+  801376:	68 6b 57 80 00       	push   $0x80576b
+  80137b:	6a 23                	push   $0x23
+  80137d:	68 88 57 80 00       	push   $0x805788
+  801382:	e8 a6 f1 ff ff       	call   80052d <_panic>
+
+00801387 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80138d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801392:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801397:	89 d1                	mov    %edx,%ecx
+  801399:	89 d3                	mov    %edx,%ebx
+  80139b:	89 d7                	mov    %edx,%edi
+  80139d:	89 d6                	mov    %edx,%esi
+  80139f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013a1:	5b                   	pop    %ebx
+  8013a2:	5e                   	pop    %esi
+  8013a3:	5f                   	pop    %edi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+
+008013a6 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	57                   	push   %edi
+  8013aa:	56                   	push   %esi
+  8013ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013bc:	89 df                	mov    %ebx,%edi
+  8013be:	89 de                	mov    %ebx,%esi
+  8013c0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8013c2:	5b                   	pop    %ebx
+  8013c3:	5e                   	pop    %esi
+  8013c4:	5f                   	pop    %edi
+  8013c5:	5d                   	pop    %ebp
+  8013c6:	c3                   	ret
+
+008013c7 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8013c7:	55                   	push   %ebp
+  8013c8:	89 e5                	mov    %esp,%ebp
+  8013ca:	57                   	push   %edi
+  8013cb:	56                   	push   %esi
+  8013cc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013da:	89 cb                	mov    %ecx,%ebx
+  8013dc:	89 cf                	mov    %ecx,%edi
+  8013de:	89 ce                	mov    %ecx,%esi
+  8013e0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8013e2:	5b                   	pop    %ebx
+  8013e3:	5e                   	pop    %esi
+  8013e4:	5f                   	pop    %edi
+  8013e5:	5d                   	pop    %ebp
+  8013e6:	c3                   	ret
+
+008013e7 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8013e7:	55                   	push   %ebp
+  8013e8:	89 e5                	mov    %esp,%ebp
+  8013ea:	57                   	push   %edi
+  8013eb:	56                   	push   %esi
+  8013ec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f8:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013fd:	89 df                	mov    %ebx,%edi
+  8013ff:	89 de                	mov    %ebx,%esi
+  801401:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+
+00801408 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801408:	55                   	push   %ebp
+  801409:	89 e5                	mov    %esp,%ebp
+  80140b:	57                   	push   %edi
+  80140c:	56                   	push   %esi
+  80140d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80140e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801413:	8b 55 08             	mov    0x8(%ebp),%edx
+  801416:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801419:	b8 12 00 00 00       	mov    $0x12,%eax
+  80141e:	89 df                	mov    %ebx,%edi
+  801420:	89 de                	mov    %ebx,%esi
+  801422:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801424:	5b                   	pop    %ebx
+  801425:	5e                   	pop    %esi
+  801426:	5f                   	pop    %edi
+  801427:	5d                   	pop    %ebp
+  801428:	c3                   	ret
+
+00801429 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	57                   	push   %edi
+  80142d:	56                   	push   %esi
+  80142e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80142f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801434:	8b 55 08             	mov    0x8(%ebp),%edx
+  801437:	b8 13 00 00 00       	mov    $0x13,%eax
+  80143c:	89 cb                	mov    %ecx,%ebx
+  80143e:	89 cf                	mov    %ecx,%edi
+  801440:	89 ce                	mov    %ecx,%esi
+  801442:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801444:	5b                   	pop    %ebx
+  801445:	5e                   	pop    %esi
+  801446:	5f                   	pop    %edi
+  801447:	5d                   	pop    %ebp
+  801448:	c3                   	ret
+
+00801449 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	57                   	push   %edi
+  80144d:	56                   	push   %esi
+  80144e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80144f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801454:	8b 55 08             	mov    0x8(%ebp),%edx
+  801457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80145f:	89 df                	mov    %ebx,%edi
+  801461:	89 de                	mov    %ebx,%esi
+  801463:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5f                   	pop    %edi
+  801468:	5d                   	pop    %ebp
+  801469:	c3                   	ret
+
+0080146a <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	57                   	push   %edi
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801470:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801475:	8b 55 08             	mov    0x8(%ebp),%edx
+  801478:	b8 15 00 00 00       	mov    $0x15,%eax
+  80147d:	89 cb                	mov    %ecx,%ebx
+  80147f:	89 cf                	mov    %ecx,%edi
+  801481:	89 ce                	mov    %ecx,%esi
+  801483:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801485:	5b                   	pop    %ebx
+  801486:	5e                   	pop    %esi
+  801487:	5f                   	pop    %edi
+  801488:	5d                   	pop    %ebp
+  801489:	c3                   	ret
+
+0080148a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	57                   	push   %edi
+  80148e:	56                   	push   %esi
+  80148f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801490:	be 00 00 00 00       	mov    $0x0,%esi
+  801495:	8b 55 08             	mov    0x8(%ebp),%edx
+  801498:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149b:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014a3:	89 f7                	mov    %esi,%edi
+  8014a5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8014a7:	5b                   	pop    %ebx
+  8014a8:	5e                   	pop    %esi
+  8014a9:	5f                   	pop    %edi
+  8014aa:	5d                   	pop    %ebp
+  8014ab:	c3                   	ret
+
+008014ac <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8014ac:	55                   	push   %ebp
+  8014ad:	89 e5                	mov    %esp,%ebp
+  8014af:	57                   	push   %edi
+  8014b0:	56                   	push   %esi
+  8014b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014bd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014c2:	89 df                	mov    %ebx,%edi
+  8014c4:	89 de                	mov    %ebx,%esi
+  8014c6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8014c8:	5b                   	pop    %ebx
+  8014c9:	5e                   	pop    %esi
+  8014ca:	5f                   	pop    %edi
+  8014cb:	5d                   	pop    %ebp
+  8014cc:	c3                   	ret
+
+008014cd <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	57                   	push   %edi
+  8014d1:	56                   	push   %esi
+  8014d2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014db:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014e0:	89 cb                	mov    %ecx,%ebx
+  8014e2:	89 cf                	mov    %ecx,%edi
+  8014e4:	89 ce                	mov    %ecx,%esi
+  8014e6:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5f                   	pop    %edi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+
+008014ed <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  8014f3:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  8014f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ff:	b8 19 00 00 00       	mov    $0x19,%eax
+  801504:	89 df                	mov    %ebx,%edi
+  801506:	89 de                	mov    %ebx,%esi
+  801508:	cd 30                	int    $0x30
+}
+  80150a:	5b                   	pop    %ebx
+  80150b:	5e                   	pop    %esi
+  80150c:	5f                   	pop    %edi
+  80150d:	5d                   	pop    %ebp
+  80150e:	c3                   	ret
+
+0080150f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80150f:	55                   	push   %ebp
+  801510:	89 e5                	mov    %esp,%ebp
+  801512:	57                   	push   %edi
+  801513:	56                   	push   %esi
+  801514:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801515:	be 00 00 00 00       	mov    $0x0,%esi
+  80151a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801520:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801525:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801528:	89 f7                	mov    %esi,%edi
+  80152a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80152c:	5b                   	pop    %ebx
+  80152d:	5e                   	pop    %esi
+  80152e:	5f                   	pop    %edi
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	57                   	push   %edi
+  801535:	56                   	push   %esi
+  801536:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801537:	be 00 00 00 00       	mov    $0x0,%esi
+  80153c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80153f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801542:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801547:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154a:	89 f7                	mov    %esi,%edi
+  80154c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5f                   	pop    %edi
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+
+00801553 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	57                   	push   %edi
+  801557:	56                   	push   %esi
+  801558:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801559:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80155e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801561:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801564:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801569:	89 df                	mov    %ebx,%edi
+  80156b:	89 de                	mov    %ebx,%esi
+  80156d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80156f:	5b                   	pop    %ebx
+  801570:	5e                   	pop    %esi
+  801571:	5f                   	pop    %edi
+  801572:	5d                   	pop    %ebp
+  801573:	c3                   	ret
+
+00801574 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801574:	55                   	push   %ebp
+  801575:	89 e5                	mov    %esp,%ebp
+  801577:	57                   	push   %edi
+  801578:	56                   	push   %esi
+  801579:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80157a:	be 00 00 00 00       	mov    $0x0,%esi
+  80157f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801582:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801585:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80158a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80158d:	89 f7                	mov    %esi,%edi
+  80158f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801591:	5b                   	pop    %ebx
+  801592:	5e                   	pop    %esi
+  801593:	5f                   	pop    %edi
+  801594:	5d                   	pop    %ebp
+  801595:	c3                   	ret
+
+00801596 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801596:	85 c0                	test   %eax,%eax
+  801598:	74 20                	je     8015ba <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80159a:	89 c1                	mov    %eax,%ecx
+  80159c:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015a2:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8015a8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8015ae:	8b 52 48             	mov    0x48(%edx),%edx
+  8015b1:	39 c2                	cmp    %eax,%edx
+  8015b3:	74 06                	je     8015bb <thread_alive+0x25>
+  8015b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ba:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015bb:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8015c1:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	0f 95 c0             	setne  %al
+  8015cc:	0f b6 c0             	movzbl %al,%eax
+  8015cf:	c3                   	ret
+
+008015d0 <pgfault>:
+{
+  8015d0:	55                   	push   %ebp
+  8015d1:	89 e5                	mov    %esp,%ebp
+  8015d3:	57                   	push   %edi
+  8015d4:	56                   	push   %esi
+  8015d5:	53                   	push   %ebx
+  8015d6:	83 ec 0c             	sub    $0xc,%esp
+  8015d9:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8015dc:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8015de:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8015e1:	89 f3                	mov    %esi,%ebx
+  8015e3:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8015e6:	83 3d e0 8f 80 00 00 	cmpl   $0x0,0x808fe0
+  8015ed:	74 52                	je     801641 <pgfault+0x71>
+  8015ef:	a8 02                	test   $0x2,%al
+  8015f1:	75 14                	jne    801607 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  8015f6:	68 96 57 80 00       	push   $0x805796
+  8015fb:	6a 2e                	push   $0x2e
+  8015fd:	68 b4 57 80 00       	push   $0x8057b4
+  801602:	e8 26 ef ff ff       	call   80052d <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801607:	89 d8                	mov    %ebx,%eax
+  801609:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80160e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801615:	83 ec 0c             	sub    $0xc,%esp
+  801618:	57                   	push   %edi
+  801619:	e8 60 30 00 00       	call   80467e <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80161e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801625:	83 e0 03             	and    $0x3,%eax
+  801628:	83 c4 10             	add    $0x10,%esp
+  80162b:	83 f8 03             	cmp    $0x3,%eax
+  80162e:	75 1a                	jne    80164a <pgfault+0x7a>
+			mutex_unlock(m);
+  801630:	83 ec 0c             	sub    $0xc,%esp
+  801633:	57                   	push   %edi
+  801634:	e8 b3 30 00 00       	call   8046ec <mutex_unlock>
+			return;
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	e9 9f 00 00 00       	jmp    8016e0 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801641:	a8 02                	test   $0x2,%al
+  801643:	74 ae                	je     8015f3 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801645:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80164a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801651:	f6 c4 08             	test   $0x8,%ah
+  801654:	74 9d                	je     8015f3 <pgfault+0x23>
+  801656:	89 e0                	mov    %esp,%eax
+  801658:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80165d:	29 c2                	sub    %eax,%edx
+  80165f:	89 d0                	mov    %edx,%eax
+  801661:	c1 e8 0f             	shr    $0xf,%eax
+  801664:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80166a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166f:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801672:	c1 e0 0c             	shl    $0xc,%eax
+  801675:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80167a:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80167c:	83 ec 04             	sub    $0x4,%esp
+  80167f:	6a 07                	push   $0x7
+  801681:	53                   	push   %ebx
+  801682:	6a 00                	push   $0x0
+  801684:	e8 aa fa ff ff       	call   801133 <sys_page_alloc>
+  801689:	83 c4 10             	add    $0x10,%esp
+  80168c:	85 c0                	test   %eax,%eax
+  80168e:	78 58                	js     8016e8 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801690:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  801696:	83 ec 04             	sub    $0x4,%esp
+  801699:	68 00 10 00 00       	push   $0x1000
+  80169e:	56                   	push   %esi
+  80169f:	53                   	push   %ebx
+  8016a0:	e8 0a f8 ff ff       	call   800eaf <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8016a5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016ac:	56                   	push   %esi
+  8016ad:	6a 00                	push   $0x0
+  8016af:	53                   	push   %ebx
+  8016b0:	6a 00                	push   $0x0
+  8016b2:	e8 bf fa ff ff       	call   801176 <sys_page_map>
+  8016b7:	83 c4 20             	add    $0x20,%esp
+  8016ba:	85 c0                	test   %eax,%eax
+  8016bc:	78 3c                	js     8016fa <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8016be:	83 ec 08             	sub    $0x8,%esp
+  8016c1:	53                   	push   %ebx
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	e8 ef fa ff ff       	call   8011b8 <sys_page_unmap>
+  8016c9:	83 c4 10             	add    $0x10,%esp
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 3c                	js     80170c <pgfault+0x13c>
+	if(m)
+  8016d0:	85 ff                	test   %edi,%edi
+  8016d2:	74 0c                	je     8016e0 <pgfault+0x110>
+		mutex_unlock(m);
+  8016d4:	83 ec 0c             	sub    $0xc,%esp
+  8016d7:	57                   	push   %edi
+  8016d8:	e8 0f 30 00 00       	call   8046ec <mutex_unlock>
+  8016dd:	83 c4 10             	add    $0x10,%esp
+}
+  8016e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8016e8:	50                   	push   %eax
+  8016e9:	68 bf 57 80 00       	push   $0x8057bf
+  8016ee:	6a 3d                	push   $0x3d
+  8016f0:	68 b4 57 80 00       	push   $0x8057b4
+  8016f5:	e8 33 ee ff ff       	call   80052d <_panic>
+		panic("sys_page_map: %e", ret);
+  8016fa:	50                   	push   %eax
+  8016fb:	68 d2 57 80 00       	push   $0x8057d2
+  801700:	6a 40                	push   $0x40
+  801702:	68 b4 57 80 00       	push   $0x8057b4
+  801707:	e8 21 ee ff ff       	call   80052d <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80170c:	50                   	push   %eax
+  80170d:	68 e3 57 80 00       	push   $0x8057e3
+  801712:	6a 42                	push   $0x42
+  801714:	68 b4 57 80 00       	push   $0x8057b4
+  801719:	e8 0f ee ff ff       	call   80052d <_panic>
+
+0080171e <thread_main>:
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801724:	ff 75 0c             	push   0xc(%ebp)
+  801727:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80172a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801731:	e8 7e f9 ff ff       	call   8010b4 <sys_env_destroy>
+}
+  801736:	83 c4 10             	add    $0x10,%esp
+  801739:	c9                   	leave
+  80173a:	c3                   	ret
+
+0080173b <fork>:
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801744:	68 d0 15 80 00       	push   $0x8015d0
+  801749:	e8 7c 32 00 00       	call   8049ca <set_pgfault_handler>
+	if(sforked)
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	83 3d e0 8f 80 00 00 	cmpl   $0x0,0x808fe0
+  801758:	75 33                	jne    80178d <fork+0x52>
+	__asm __volatile("int %2"
+  80175a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80175f:	cd 30                	int    $0x30
+  801761:	89 c7                	mov    %eax,%edi
+  801763:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801765:	85 c0                	test   %eax,%eax
+  801767:	0f 88 b4 00 00 00    	js     801821 <fork+0xe6>
+	if(envid == 0) {
+  80176d:	0f 84 c3 00 00 00    	je     801836 <fork+0xfb>
+	pgbatch_init(&pb);
+  801773:	83 ec 0c             	sub    $0xc,%esp
+  801776:	68 60 78 80 00       	push   $0x807860
+  80177b:	e8 ed 25 00 00       	call   803d6d <pgbatch_init>
+  801780:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801783:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801788:	e9 9c 01 00 00       	jmp    801929 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80178d:	83 ec 0c             	sub    $0xc,%esp
+  801790:	68 00 7c 80 00       	push   $0x807c00
+  801795:	e8 e4 2e 00 00       	call   80467e <mutex_lock>
+  80179a:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  80179d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8017a2:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8017a7:	eb 08                	jmp    8017b1 <fork+0x76>
+  8017a9:	83 c3 01             	add    $0x1,%ebx
+  8017ac:	83 fb 20             	cmp    $0x20,%ebx
+  8017af:	74 5b                	je     80180c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8017b1:	8b 34 9d 80 7b 80 00 	mov    0x807b80(,%ebx,4),%esi
+  8017b8:	89 f0                	mov    %esi,%eax
+  8017ba:	e8 d7 fd ff ff       	call   801596 <thread_alive>
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	74 e6                	je     8017a9 <fork+0x6e>
+  8017c3:	89 e0                	mov    %esp,%eax
+  8017c5:	89 fa                	mov    %edi,%edx
+  8017c7:	29 c2                	sub    %eax,%edx
+  8017c9:	89 d0                	mov    %edx,%eax
+  8017cb:	c1 e8 0f             	shr    $0xf,%eax
+  8017ce:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8017d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017d9:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8017dc:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  8017e3:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8017e6:	83 ec 08             	sub    $0x8,%esp
+  8017e9:	50                   	push   %eax
+  8017ea:	56                   	push   %esi
+  8017eb:	e8 8e fa ff ff       	call   80127e <sys_env_set_pgfault_upcall>
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	79 b2                	jns    8017a9 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  8017f7:	50                   	push   %eax
+  8017f8:	68 70 58 80 00       	push   $0x805870
+  8017fd:	68 00 01 00 00       	push   $0x100
+  801802:	68 b4 57 80 00       	push   $0x8057b4
+  801807:	e8 21 ed ff ff       	call   80052d <_panic>
+	mutex_unlock(&sfork_lock);
+  80180c:	83 ec 0c             	sub    $0xc,%esp
+  80180f:	68 00 7c 80 00       	push   $0x807c00
+  801814:	e8 d3 2e 00 00       	call   8046ec <mutex_unlock>
+}
+  801819:	83 c4 10             	add    $0x10,%esp
+  80181c:	e9 39 ff ff ff       	jmp    80175a <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801821:	50                   	push   %eax
+  801822:	68 f6 57 80 00       	push   $0x8057f6
+  801827:	68 91 00 00 00       	push   $0x91
+  80182c:	68 b4 57 80 00       	push   $0x8057b4
+  801831:	e8 f7 ec ff ff       	call   80052d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801836:	e8 ba f8 ff ff       	call   8010f5 <sys_getenvid>
+  80183b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801840:	89 e1                	mov    %esp,%ecx
+  801842:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801847:	29 ca                	sub    %ecx,%edx
+  801849:	89 d1                	mov    %edx,%ecx
+  80184b:	c1 e9 0f             	shr    $0xf,%ecx
+  80184e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801854:	ba 00 00 00 00       	mov    $0x0,%edx
+  801859:	0f 42 d1             	cmovb  %ecx,%edx
+  80185c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801862:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801867:	89 04 95 60 8f 80 00 	mov    %eax,0x808f60(,%edx,4)
+		if(sforked)
+  80186e:	a1 e0 8f 80 00       	mov    0x808fe0,%eax
+  801873:	85 c0                	test   %eax,%eax
+  801875:	75 07                	jne    80187e <fork+0x143>
+		return 0;
+  801877:	89 c6                	mov    %eax,%esi
+  801879:	e9 6f 02 00 00       	jmp    801aed <fork+0x3b2>
+  80187e:	89 e2                	mov    %esp,%edx
+  801880:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801885:	29 d0                	sub    %edx,%eax
+  801887:	89 c3                	mov    %eax,%ebx
+  801889:	c1 eb 0f             	shr    $0xf,%ebx
+  80188c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  801899:	83 ec 04             	sub    $0x4,%esp
+  80189c:	68 80 00 00 00       	push   $0x80
+  8018a1:	6a 00                	push   $0x0
+  8018a3:	68 80 7b 80 00       	push   $0x807b80
+  8018a8:	e8 cd f5 ff ff       	call   800e7a <memset>
+	thread_ids[slot] = sys_getenvid();
+  8018ad:	e8 43 f8 ff ff       	call   8010f5 <sys_getenvid>
+  8018b2:	89 04 9d 80 7b 80 00 	mov    %eax,0x807b80(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8018b9:	8b 04 9d 60 8f 80 00 	mov    0x808f60(,%ebx,4),%eax
+  8018c0:	a3 60 8f 80 00       	mov    %eax,0x808f60
+	mutex_init(&sfork_lock);
+  8018c5:	c7 04 24 00 7c 80 00 	movl   $0x807c00,(%esp)
+  8018cc:	e8 9f 2d 00 00       	call   804670 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8018d1:	83 c4 0c             	add    $0xc,%esp
+  8018d4:	68 07 04 00 00       	push   $0x407
+  8018d9:	68 00 00 00 e1       	push   $0xe1000000
+  8018de:	6a 00                	push   $0x0
+  8018e0:	e8 4e f8 ff ff       	call   801133 <sys_page_alloc>
+  8018e5:	83 c4 10             	add    $0x10,%esp
+  8018e8:	85 c0                	test   %eax,%eax
+  8018ea:	0f 89 fd 01 00 00    	jns    801aed <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  8018f0:	50                   	push   %eax
+  8018f1:	68 bf 57 80 00       	push   $0x8057bf
+  8018f6:	68 12 01 00 00       	push   $0x112
+  8018fb:	68 b4 57 80 00       	push   $0x8057b4
+  801900:	e8 28 ec ff ff       	call   80052d <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801905:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80190b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801911:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801917:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80191d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801923:	0f 87 4f 01 00 00    	ja     801a78 <fork+0x33d>
+		pd = PDX(addr);
+  801929:	89 d8                	mov    %ebx,%eax
+  80192b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80192e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801935:	f6 c2 01             	test   $0x1,%dl
+  801938:	74 cb                	je     801905 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80193a:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80193f:	0f 85 92 00 00 00    	jne    8019d7 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801945:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80194b:	76 10                	jbe    80195d <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80194d:	89 d8                	mov    %ebx,%eax
+  80194f:	f7 d8                	neg    %eax
+  801951:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801956:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80195b:	74 ba                	je     801917 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80195d:	89 d8                	mov    %ebx,%eax
+  80195f:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801962:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801969:	f6 c2 01             	test   $0x1,%dl
+  80196c:	74 a9                	je     801917 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80196e:	89 c1                	mov    %eax,%ecx
+  801970:	c1 e1 0c             	shl    $0xc,%ecx
+  801973:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801976:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80197d:	f6 c6 04             	test   $0x4,%dh
+  801980:	0f 85 8e 00 00 00    	jne    801a14 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801986:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80198d:	f6 c6 08             	test   $0x8,%dh
+  801990:	75 0f                	jne    8019a1 <fork+0x266>
+  801992:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801999:	a8 02                	test   $0x2,%al
+  80199b:	0f 84 bb 00 00 00    	je     801a5c <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8019a1:	83 ec 08             	sub    $0x8,%esp
+  8019a4:	68 05 08 00 00       	push   $0x805
+  8019a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019ac:	50                   	push   %eax
+  8019ad:	56                   	push   %esi
+  8019ae:	50                   	push   %eax
+  8019af:	6a 00                	push   $0x0
+  8019b1:	68 60 78 80 00       	push   $0x807860
+  8019b6:	e8 70 24 00 00       	call   803e2b <pgbatch_map>
+  8019bb:	83 c4 20             	add    $0x20,%esp
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	79 76                	jns    801a38 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8019c2:	50                   	push   %eax
+  8019c3:	68 1a 58 80 00       	push   $0x80581a
+  8019c8:	68 bc 00 00 00       	push   $0xbc
+  8019cd:	68 b4 57 80 00       	push   $0x8057b4
+  8019d2:	e8 56 eb ff ff       	call   80052d <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8019d7:	83 ec 0c             	sub    $0xc,%esp
+  8019da:	68 00 08 00 00       	push   $0x800
+  8019df:	56                   	push   %esi
+  8019e0:	53                   	push   %ebx
+  8019e1:	6a 00                	push   $0x0
+  8019e3:	68 60 78 80 00       	push   $0x807860
+  8019e8:	e8 e9 24 00 00       	call   803ed6 <pgbatch_sharept>
+  8019ed:	83 c4 20             	add    $0x20,%esp
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 0b                	js     8019ff <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  8019f4:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  8019fa:	e9 18 ff ff ff       	jmp    801917 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  8019ff:	50                   	push   %eax
+  801a00:	68 06 58 80 00       	push   $0x805806
+  801a05:	68 b2 00 00 00       	push   $0xb2
+  801a0a:	68 b4 57 80 00       	push   $0x8057b4
+  801a0f:	e8 19 eb ff ff       	call   80052d <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801a14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a1b:	83 ec 08             	sub    $0x8,%esp
+  801a1e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a23:	50                   	push   %eax
+  801a24:	51                   	push   %ecx
+  801a25:	56                   	push   %esi
+  801a26:	51                   	push   %ecx
+  801a27:	6a 00                	push   $0x0
+  801a29:	68 60 78 80 00       	push   $0x807860
+  801a2e:	e8 f8 23 00 00       	call   803e2b <pgbatch_map>
+  801a33:	83 c4 20             	add    $0x20,%esp
+  801a36:	eb 17                	jmp    801a4f <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801a38:	68 05 08 00 00       	push   $0x805
+  801a3d:	ff 75 e4             	push   -0x1c(%ebp)
+  801a40:	6a 00                	push   $0x0
+  801a42:	68 60 78 80 00       	push   $0x807860
+  801a47:	e8 53 24 00 00       	call   803e9f <pgbatch_protect>
+  801a4c:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	0f 89 c0 fe ff ff    	jns    801917 <fork+0x1dc>
+  801a57:	e9 66 ff ff ff       	jmp    8019c2 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801a5c:	83 ec 08             	sub    $0x8,%esp
+  801a5f:	6a 05                	push   $0x5
+  801a61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	56                   	push   %esi
+  801a66:	50                   	push   %eax
+  801a67:	6a 00                	push   $0x0
+  801a69:	68 60 78 80 00       	push   $0x807860
+  801a6e:	e8 b8 23 00 00       	call   803e2b <pgbatch_map>
+  801a73:	83 c4 20             	add    $0x20,%esp
+  801a76:	eb d7                	jmp    801a4f <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801a78:	6a 07                	push   $0x7
+  801a7a:	68 00 f0 bf ee       	push   $0xeebff000
+  801a7f:	57                   	push   %edi
+  801a80:	68 60 78 80 00       	push   $0x807860
+  801a85:	e8 6a 23 00 00       	call   803df4 <pgbatch_alloc>
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 66                	js     801af7 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801a91:	83 ec 0c             	sub    $0xc,%esp
+  801a94:	68 60 78 80 00       	push   $0x807860
+  801a99:	e8 dd 22 00 00       	call   803d7b <pgbatch_flush>
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 52                	js     801af7 <fork+0x3bc>
+  801aa5:	89 e2                	mov    %esp,%edx
+  801aa7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801aac:	29 d0                	sub    %edx,%eax
+  801aae:	89 c2                	mov    %eax,%edx
+  801ab0:	c1 ea 0f             	shr    $0xf,%edx
+  801ab3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801abd:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801ac0:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  801ac7:	8b 40 78             	mov    0x78(%eax),%eax
+  801aca:	83 ec 08             	sub    $0x8,%esp
+  801acd:	50                   	push   %eax
+  801ace:	57                   	push   %edi
+  801acf:	e8 aa f7 ff ff       	call   80127e <sys_env_set_pgfault_upcall>
+  801ad4:	83 c4 10             	add    $0x10,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 31                	js     801b0c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801adb:	83 ec 08             	sub    $0x8,%esp
+  801ade:	6a 02                	push   $0x2
+  801ae0:	57                   	push   %edi
+  801ae1:	e8 14 f7 ff ff       	call   8011fa <sys_env_set_status>
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 34                	js     801b21 <fork+0x3e6>
+}
+  801aed:	89 f0                	mov    %esi,%eax
+  801aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af2:	5b                   	pop    %ebx
+  801af3:	5e                   	pop    %esi
+  801af4:	5f                   	pop    %edi
+  801af5:	5d                   	pop    %ebp
+  801af6:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801af7:	50                   	push   %eax
+  801af8:	68 26 58 80 00       	push   $0x805826
+  801afd:	68 c0 00 00 00       	push   $0xc0
+  801b02:	68 b4 57 80 00       	push   $0x8057b4
+  801b07:	e8 21 ea ff ff       	call   80052d <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801b0c:	50                   	push   %eax
+  801b0d:	68 3b 58 80 00       	push   $0x80583b
+  801b12:	68 c2 00 00 00       	push   $0xc2
+  801b17:	68 b4 57 80 00       	push   $0x8057b4
+  801b1c:	e8 0c ea ff ff       	call   80052d <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801b21:	50                   	push   %eax
+  801b22:	68 56 58 80 00       	push   $0x805856
+  801b27:	68 c4 00 00 00       	push   $0xc4
+  801b2c:	68 b4 57 80 00       	push   $0x8057b4
+  801b31:	e8 f7 e9 ff ff       	call   80052d <_panic>
+
+00801b36 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801b36:	55                   	push   %ebp
+  801b37:	89 e5                	mov    %esp,%ebp
+  801b39:	57                   	push   %edi
+  801b3a:	56                   	push   %esi
+  801b3b:	53                   	push   %ebx
+  801b3c:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801b3f:	68 00 7c 80 00       	push   $0x807c00
+  801b44:	e8 35 2b 00 00       	call   80467e <mutex_lock>
+  801b49:	89 e2                	mov    %esp,%edx
+  801b4b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b50:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801b52:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801b55:	89 c3                	mov    %eax,%ebx
+  801b57:	c1 eb 0f             	shr    $0xf,%ebx
+  801b5a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b64:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801b67:	e8 89 f5 ff ff       	call   8010f5 <sys_getenvid>
+  801b6c:	89 04 9d 80 7b 80 00 	mov    %eax,0x807b80(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801b73:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801b78:	8b 04 9d 80 7b 80 00 	mov    0x807b80(,%ebx,4),%eax
+  801b7f:	e8 12 fa ff ff       	call   801596 <thread_alive>
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	74 24                	je     801bac <sfork+0x76>
+  801b88:	83 c3 01             	add    $0x1,%ebx
+  801b8b:	83 fb 20             	cmp    $0x20,%ebx
+  801b8e:	75 e8                	jne    801b78 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801b90:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801b95:	83 ec 0c             	sub    $0xc,%esp
+  801b98:	68 00 7c 80 00       	push   $0x807c00
+  801b9d:	e8 4a 2b 00 00       	call   8046ec <mutex_unlock>
+	return r;
+}
+  801ba2:	89 f0                	mov    %esi,%eax
+  801ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5f                   	pop    %edi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+	if (i == NTHREADS) {
+  801bac:	83 fb 20             	cmp    $0x20,%ebx
+  801baf:	0f 84 53 01 00 00    	je     801d08 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801bb5:	89 d8                	mov    %ebx,%eax
+  801bb7:	c1 e0 0f             	shl    $0xf,%eax
+  801bba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801bbd:	83 ec 0c             	sub    $0xc,%esp
+  801bc0:	68 40 75 80 00       	push   $0x807540
+  801bc5:	e8 a3 21 00 00       	call   803d6d <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801bca:	83 c4 10             	add    $0x10,%esp
+  801bcd:	83 3d e0 8f 80 00 00 	cmpl   $0x0,0x808fe0
+  801bd4:	75 1f                	jne    801bf5 <sfork+0xbf>
+  801bd6:	68 07 04 00 00       	push   $0x407
+  801bdb:	68 00 00 00 e1       	push   $0xe1000000
+  801be0:	6a 00                	push   $0x0
+  801be2:	68 40 75 80 00       	push   $0x807540
+  801be7:	e8 08 22 00 00       	call   803df4 <pgbatch_alloc>
+  801bec:	89 c6                	mov    %eax,%esi
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 a0                	js     801b95 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801bf5:	6a 07                	push   $0x7
+  801bf7:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801bfc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801bff:	29 c8                	sub    %ecx,%eax
+  801c01:	50                   	push   %eax
+  801c02:	6a 00                	push   $0x0
+  801c04:	68 40 75 80 00       	push   $0x807540
+  801c09:	e8 e6 21 00 00       	call   803df4 <pgbatch_alloc>
+  801c0e:	89 c6                	mov    %eax,%esi
+  801c10:	83 c4 10             	add    $0x10,%esp
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	0f 88 7a ff ff ff    	js     801b95 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801c1b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801c20:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c23:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c25:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c2a:	29 c8                	sub    %ecx,%eax
+  801c2c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c2f:	39 c7                	cmp    %eax,%edi
+  801c31:	73 29                	jae    801c5c <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801c33:	6a 07                	push   $0x7
+  801c35:	57                   	push   %edi
+  801c36:	6a 00                	push   $0x0
+  801c38:	68 40 75 80 00       	push   $0x807540
+  801c3d:	e8 b2 21 00 00       	call   803df4 <pgbatch_alloc>
+  801c42:	89 c6                	mov    %eax,%esi
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	0f 88 46 ff ff ff    	js     801b95 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c4f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801c55:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c58:	39 c7                	cmp    %eax,%edi
+  801c5a:	72 d7                	jb     801c33 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801c5c:	83 ec 0c             	sub    $0xc,%esp
+  801c5f:	68 40 75 80 00       	push   $0x807540
+  801c64:	e8 12 21 00 00       	call   803d7b <pgbatch_flush>
+  801c69:	89 c6                	mov    %eax,%esi
+  801c6b:	83 c4 10             	add    $0x10,%esp
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	0f 88 1f ff ff ff    	js     801b95 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801c76:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801c7b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c7e:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801c80:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801c86:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c89:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801c8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c8f:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801c92:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801c95:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801c9a:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801c9c:	52                   	push   %edx
+  801c9d:	50                   	push   %eax
+  801c9e:	68 1e 17 80 00       	push   $0x80171e
+  801ca3:	e8 cc f8 ff ff       	call   801574 <sys_exofork_shared>
+  801ca8:	89 c6                	mov    %eax,%esi
+  801caa:	83 c4 10             	add    $0x10,%esp
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	0f 88 e0 fe ff ff    	js     801b95 <sfork+0x5f>
+	thread_ids[i] = id;
+  801cb5:	89 04 9d 80 7b 80 00 	mov    %eax,0x807b80(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801cbc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cc1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801cc7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801ccc:	89 04 9d 60 8f 80 00 	mov    %eax,0x808f60(,%ebx,4)
+	sforked = 1;
+  801cd3:	c7 05 e0 8f 80 00 01 	movl   $0x1,0x808fe0
+  801cda:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+  801ce0:	6a 02                	push   $0x2
+  801ce2:	56                   	push   %esi
+  801ce3:	e8 12 f5 ff ff       	call   8011fa <sys_env_set_status>
+  801ce8:	89 c3                	mov    %eax,%ebx
+  801cea:	83 c4 10             	add    $0x10,%esp
+  801ced:	85 c0                	test   %eax,%eax
+  801cef:	0f 89 a0 fe ff ff    	jns    801b95 <sfork+0x5f>
+		sys_env_destroy(id);
+  801cf5:	83 ec 0c             	sub    $0xc,%esp
+  801cf8:	56                   	push   %esi
+  801cf9:	e8 b6 f3 ff ff       	call   8010b4 <sys_env_destroy>
+		goto out;
+  801cfe:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d01:	89 de                	mov    %ebx,%esi
+		goto out;
+  801d03:	e9 8d fe ff ff       	jmp    801b95 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801d08:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801d0d:	e9 83 fe ff ff       	jmp    801b95 <sfork+0x5f>
+
+00801d12 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d12:	55                   	push   %ebp
+  801d13:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d18:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d1d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d20:	5d                   	pop    %ebp
+  801d21:	c3                   	ret
+
+00801d22 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d28:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d2d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d32:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801d37:	5d                   	pop    %ebp
+  801d38:	c3                   	ret
+
+00801d39 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801d39:	55                   	push   %ebp
+  801d3a:	89 e5                	mov    %esp,%ebp
+  801d3c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801d41:	89 c2                	mov    %eax,%edx
+  801d43:	c1 ea 16             	shr    $0x16,%edx
+  801d46:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d4d:	f6 c2 01             	test   $0x1,%dl
+  801d50:	74 29                	je     801d7b <fd_alloc+0x42>
+  801d52:	89 c2                	mov    %eax,%edx
+  801d54:	c1 ea 0c             	shr    $0xc,%edx
+  801d57:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d5e:	f6 c2 01             	test   $0x1,%dl
+  801d61:	74 18                	je     801d7b <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801d63:	05 00 10 00 00       	add    $0x1000,%eax
+  801d68:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801d6d:	75 d2                	jne    801d41 <fd_alloc+0x8>
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801d74:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801d79:	eb 05                	jmp    801d80 <fd_alloc+0x47>
+			return 0;
+  801d7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d83:	89 02                	mov    %eax,(%edx)
+}
+  801d85:	89 c8                	mov    %ecx,%eax
+  801d87:	5d                   	pop    %ebp
+  801d88:	c3                   	ret
+
+00801d89 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801d8f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801d94:	77 30                	ja     801dc6 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801d96:	c1 e0 0c             	shl    $0xc,%eax
+  801d99:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801d9e:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801da4:	f6 c2 01             	test   $0x1,%dl
+  801da7:	74 24                	je     801dcd <fd_lookup+0x44>
+  801da9:	89 c2                	mov    %eax,%edx
+  801dab:	c1 ea 0c             	shr    $0xc,%edx
+  801dae:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801db5:	f6 c2 01             	test   $0x1,%dl
+  801db8:	74 1a                	je     801dd4 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801dba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dbd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dc4:	5d                   	pop    %ebp
+  801dc5:	c3                   	ret
+		return -E_INVAL;
+  801dc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dcb:	eb f7                	jmp    801dc4 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801dcd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd2:	eb f0                	jmp    801dc4 <fd_lookup+0x3b>
+  801dd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dd9:	eb e9                	jmp    801dc4 <fd_lookup+0x3b>
+
+00801ddb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	53                   	push   %ebx
+  801ddf:	83 ec 04             	sub    $0x4,%esp
+  801de2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dea:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801def:	39 13                	cmp    %edx,(%ebx)
+  801df1:	74 54                	je     801e47 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801df3:	83 c0 01             	add    $0x1,%eax
+  801df6:	8b 1c 85 0c 59 80 00 	mov    0x80590c(,%eax,4),%ebx
+  801dfd:	85 db                	test   %ebx,%ebx
+  801dff:	75 ee                	jne    801def <dev_lookup+0x14>
+  801e01:	89 e1                	mov    %esp,%ecx
+  801e03:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e08:	29 c8                	sub    %ecx,%eax
+  801e0a:	89 c1                	mov    %eax,%ecx
+  801e0c:	c1 e9 0f             	shr    $0xf,%ecx
+  801e0f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e19:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e1c:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  801e23:	8b 40 48             	mov    0x48(%eax),%eax
+  801e26:	83 ec 04             	sub    $0x4,%esp
+  801e29:	52                   	push   %edx
+  801e2a:	50                   	push   %eax
+  801e2b:	68 90 58 80 00       	push   $0x805890
+  801e30:	e8 d3 e7 ff ff       	call   800608 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e40:	89 1a                	mov    %ebx,(%edx)
+}
+  801e42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e45:	c9                   	leave
+  801e46:	c3                   	ret
+			return 0;
+  801e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4c:	eb ef                	jmp    801e3d <dev_lookup+0x62>
+
+00801e4e <fd_close>:
+{
+  801e4e:	55                   	push   %ebp
+  801e4f:	89 e5                	mov    %esp,%ebp
+  801e51:	57                   	push   %edi
+  801e52:	56                   	push   %esi
+  801e53:	53                   	push   %ebx
+  801e54:	83 ec 24             	sub    $0x24,%esp
+  801e57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e60:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801e61:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801e67:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801e6a:	50                   	push   %eax
+  801e6b:	e8 19 ff ff ff       	call   801d89 <fd_lookup>
+  801e70:	89 c3                	mov    %eax,%ebx
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	85 c0                	test   %eax,%eax
+  801e77:	78 05                	js     801e7e <fd_close+0x30>
+	    || fd != fd2)
+  801e79:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801e7c:	74 0f                	je     801e8d <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801e7e:	85 ff                	test   %edi,%edi
+  801e80:	0f 44 df             	cmove  %edi,%ebx
+}
+  801e83:	89 d8                	mov    %ebx,%eax
+  801e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e88:	5b                   	pop    %ebx
+  801e89:	5e                   	pop    %esi
+  801e8a:	5f                   	pop    %edi
+  801e8b:	5d                   	pop    %ebp
+  801e8c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e8d:	83 ec 08             	sub    $0x8,%esp
+  801e90:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801e93:	50                   	push   %eax
+  801e94:	ff 36                	push   (%esi)
+  801e96:	e8 40 ff ff ff       	call   801ddb <dev_lookup>
+  801e9b:	89 c3                	mov    %eax,%ebx
+  801e9d:	83 c4 10             	add    $0x10,%esp
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 1a                	js     801ebe <fd_close+0x70>
+		if (dev->dev_close)
+  801ea4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ea7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	74 0b                	je     801ebe <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801eb3:	83 ec 0c             	sub    $0xc,%esp
+  801eb6:	56                   	push   %esi
+  801eb7:	ff d0                	call   *%eax
+  801eb9:	89 c3                	mov    %eax,%ebx
+  801ebb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+  801ec1:	56                   	push   %esi
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	e8 ef f2 ff ff       	call   8011b8 <sys_page_unmap>
+	return r;
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	eb b5                	jmp    801e83 <fd_close+0x35>
+
+00801ece <close>:
+
+int
+close(int fdnum)
+{
+  801ece:	55                   	push   %ebp
+  801ecf:	89 e5                	mov    %esp,%ebp
+  801ed1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ed4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed7:	50                   	push   %eax
+  801ed8:	ff 75 08             	push   0x8(%ebp)
+  801edb:	e8 a9 fe ff ff       	call   801d89 <fd_lookup>
+  801ee0:	83 c4 10             	add    $0x10,%esp
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	79 02                	jns    801ee9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ee7:	c9                   	leave
+  801ee8:	c3                   	ret
+		return fd_close(fd, 1);
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	6a 01                	push   $0x1
+  801eee:	ff 75 f4             	push   -0xc(%ebp)
+  801ef1:	e8 58 ff ff ff       	call   801e4e <fd_close>
+  801ef6:	83 c4 10             	add    $0x10,%esp
+  801ef9:	eb ec                	jmp    801ee7 <close+0x19>
+
+00801efb <close_all>:
+
+void
+close_all(void)
+{
+  801efb:	55                   	push   %ebp
+  801efc:	89 e5                	mov    %esp,%ebp
+  801efe:	53                   	push   %ebx
+  801eff:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f07:	83 ec 0c             	sub    $0xc,%esp
+  801f0a:	53                   	push   %ebx
+  801f0b:	e8 be ff ff ff       	call   801ece <close>
+	for (i = 0; i < MAXFD; i++)
+  801f10:	83 c3 01             	add    $0x1,%ebx
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801f1c:	75 e9                	jne    801f07 <close_all+0xc>
+}
+  801f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f21:	c9                   	leave
+  801f22:	c3                   	ret
+
+00801f23 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	57                   	push   %edi
+  801f27:	56                   	push   %esi
+  801f28:	53                   	push   %ebx
+  801f29:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f2c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f2f:	50                   	push   %eax
+  801f30:	ff 75 08             	push   0x8(%ebp)
+  801f33:	e8 51 fe ff ff       	call   801d89 <fd_lookup>
+  801f38:	89 c3                	mov    %eax,%ebx
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 7f                	js     801fc0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f41:	83 ec 0c             	sub    $0xc,%esp
+  801f44:	ff 75 0c             	push   0xc(%ebp)
+  801f47:	e8 82 ff ff ff       	call   801ece <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f4f:	c1 e6 0c             	shl    $0xc,%esi
+  801f52:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801f58:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801f5b:	89 3c 24             	mov    %edi,(%esp)
+  801f5e:	e8 bf fd ff ff       	call   801d22 <fd2data>
+  801f63:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801f65:	89 34 24             	mov    %esi,(%esp)
+  801f68:	e8 b5 fd ff ff       	call   801d22 <fd2data>
+  801f6d:	83 c4 10             	add    $0x10,%esp
+  801f70:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801f73:	89 d8                	mov    %ebx,%eax
+  801f75:	c1 e8 16             	shr    $0x16,%eax
+  801f78:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f7f:	a8 01                	test   $0x1,%al
+  801f81:	74 11                	je     801f94 <dup+0x71>
+  801f83:	89 d8                	mov    %ebx,%eax
+  801f85:	c1 e8 0c             	shr    $0xc,%eax
+  801f88:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801f8f:	f6 c2 01             	test   $0x1,%dl
+  801f92:	75 36                	jne    801fca <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801f94:	89 f8                	mov    %edi,%eax
+  801f96:	c1 e8 0c             	shr    $0xc,%eax
+  801f99:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fa0:	83 ec 0c             	sub    $0xc,%esp
+  801fa3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fa8:	50                   	push   %eax
+  801fa9:	56                   	push   %esi
+  801faa:	6a 00                	push   $0x0
+  801fac:	57                   	push   %edi
+  801fad:	6a 00                	push   $0x0
+  801faf:	e8 c2 f1 ff ff       	call   801176 <sys_page_map>
+  801fb4:	89 c3                	mov    %eax,%ebx
+  801fb6:	83 c4 20             	add    $0x20,%esp
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 33                	js     801ff0 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801fbd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801fc0:	89 d8                	mov    %ebx,%eax
+  801fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc5:	5b                   	pop    %ebx
+  801fc6:	5e                   	pop    %esi
+  801fc7:	5f                   	pop    %edi
+  801fc8:	5d                   	pop    %ebp
+  801fc9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801fca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fd1:	83 ec 0c             	sub    $0xc,%esp
+  801fd4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801fd9:	50                   	push   %eax
+  801fda:	ff 75 d4             	push   -0x2c(%ebp)
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	53                   	push   %ebx
+  801fe0:	6a 00                	push   $0x0
+  801fe2:	e8 8f f1 ff ff       	call   801176 <sys_page_map>
+  801fe7:	89 c3                	mov    %eax,%ebx
+  801fe9:	83 c4 20             	add    $0x20,%esp
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	79 a4                	jns    801f94 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ff0:	83 ec 08             	sub    $0x8,%esp
+  801ff3:	56                   	push   %esi
+  801ff4:	6a 00                	push   $0x0
+  801ff6:	e8 bd f1 ff ff       	call   8011b8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801ffb:	83 c4 08             	add    $0x8,%esp
+  801ffe:	ff 75 d4             	push   -0x2c(%ebp)
+  802001:	6a 00                	push   $0x0
+  802003:	e8 b0 f1 ff ff       	call   8011b8 <sys_page_unmap>
+	return r;
+  802008:	83 c4 10             	add    $0x10,%esp
+  80200b:	eb b3                	jmp    801fc0 <dup+0x9d>
+
+0080200d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	56                   	push   %esi
+  802011:	53                   	push   %ebx
+  802012:	83 ec 18             	sub    $0x18,%esp
+  802015:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802018:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80201b:	50                   	push   %eax
+  80201c:	53                   	push   %ebx
+  80201d:	e8 67 fd ff ff       	call   801d89 <fd_lookup>
+  802022:	83 c4 10             	add    $0x10,%esp
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 3c                	js     802065 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802029:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  80202f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802032:	50                   	push   %eax
+  802033:	ff 36                	push   (%esi)
+  802035:	e8 a1 fd ff ff       	call   801ddb <dev_lookup>
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 24                	js     802065 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802041:	8b 46 08             	mov    0x8(%esi),%eax
+  802044:	83 e0 03             	and    $0x3,%eax
+  802047:	83 f8 01             	cmp    $0x1,%eax
+  80204a:	74 20                	je     80206c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80204c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204f:	8b 40 08             	mov    0x8(%eax),%eax
+  802052:	85 c0                	test   %eax,%eax
+  802054:	74 54                	je     8020aa <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  802056:	83 ec 04             	sub    $0x4,%esp
+  802059:	ff 75 10             	push   0x10(%ebp)
+  80205c:	ff 75 0c             	push   0xc(%ebp)
+  80205f:	56                   	push   %esi
+  802060:	ff d0                	call   *%eax
+  802062:	83 c4 10             	add    $0x10,%esp
+}
+  802065:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802068:	5b                   	pop    %ebx
+  802069:	5e                   	pop    %esi
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+  80206c:	89 e2                	mov    %esp,%edx
+  80206e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802073:	29 d0                	sub    %edx,%eax
+  802075:	89 c2                	mov    %eax,%edx
+  802077:	c1 ea 0f             	shr    $0xf,%edx
+  80207a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80207f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802084:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802087:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  80208e:	8b 40 48             	mov    0x48(%eax),%eax
+  802091:	83 ec 04             	sub    $0x4,%esp
+  802094:	53                   	push   %ebx
+  802095:	50                   	push   %eax
+  802096:	68 d1 58 80 00       	push   $0x8058d1
+  80209b:	e8 68 e5 ff ff       	call   800608 <cprintf>
+		return -E_INVAL;
+  8020a0:	83 c4 10             	add    $0x10,%esp
+  8020a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a8:	eb bb                	jmp    802065 <read+0x58>
+		return -E_NOT_SUPP;
+  8020aa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020af:	eb b4                	jmp    802065 <read+0x58>
+
+008020b1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020b1:	55                   	push   %ebp
+  8020b2:	89 e5                	mov    %esp,%ebp
+  8020b4:	57                   	push   %edi
+  8020b5:	56                   	push   %esi
+  8020b6:	53                   	push   %ebx
+  8020b7:	83 ec 0c             	sub    $0xc,%esp
+  8020ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020bd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020c0:	85 f6                	test   %esi,%esi
+  8020c2:	74 30                	je     8020f4 <readn+0x43>
+  8020c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020c9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	89 f2                	mov    %esi,%edx
+  8020d3:	29 c2                	sub    %eax,%edx
+  8020d5:	52                   	push   %edx
+  8020d6:	01 f8                	add    %edi,%eax
+  8020d8:	50                   	push   %eax
+  8020d9:	ff 75 08             	push   0x8(%ebp)
+  8020dc:	e8 2c ff ff ff       	call   80200d <read>
+		if (m < 0)
+  8020e1:	83 c4 10             	add    $0x10,%esp
+  8020e4:	85 c0                	test   %eax,%eax
+  8020e6:	78 15                	js     8020fd <readn+0x4c>
+			return m;
+		if (m == 0)
+  8020e8:	74 11                	je     8020fb <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8020ea:	01 c3                	add    %eax,%ebx
+  8020ec:	89 d8                	mov    %ebx,%eax
+  8020ee:	39 f3                	cmp    %esi,%ebx
+  8020f0:	72 dc                	jb     8020ce <readn+0x1d>
+  8020f2:	eb 09                	jmp    8020fd <readn+0x4c>
+  8020f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f9:	eb 02                	jmp    8020fd <readn+0x4c>
+  8020fb:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8020fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802100:	5b                   	pop    %ebx
+  802101:	5e                   	pop    %esi
+  802102:	5f                   	pop    %edi
+  802103:	5d                   	pop    %ebp
+  802104:	c3                   	ret
+
+00802105 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	56                   	push   %esi
+  802109:	53                   	push   %ebx
+  80210a:	83 ec 18             	sub    $0x18,%esp
+  80210d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802110:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802113:	50                   	push   %eax
+  802114:	53                   	push   %ebx
+  802115:	e8 6f fc ff ff       	call   801d89 <fd_lookup>
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	85 c0                	test   %eax,%eax
+  80211f:	78 37                	js     802158 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802121:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802124:	83 ec 08             	sub    $0x8,%esp
+  802127:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	ff 36                	push   (%esi)
+  80212d:	e8 a9 fc ff ff       	call   801ddb <dev_lookup>
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 1f                	js     802158 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802139:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80213d:	74 20                	je     80215f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80213f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802142:	8b 40 0c             	mov    0xc(%eax),%eax
+  802145:	85 c0                	test   %eax,%eax
+  802147:	74 54                	je     80219d <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802149:	83 ec 04             	sub    $0x4,%esp
+  80214c:	ff 75 10             	push   0x10(%ebp)
+  80214f:	ff 75 0c             	push   0xc(%ebp)
+  802152:	56                   	push   %esi
+  802153:	ff d0                	call   *%eax
+  802155:	83 c4 10             	add    $0x10,%esp
+}
+  802158:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80215b:	5b                   	pop    %ebx
+  80215c:	5e                   	pop    %esi
+  80215d:	5d                   	pop    %ebp
+  80215e:	c3                   	ret
+  80215f:	89 e2                	mov    %esp,%edx
+  802161:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802166:	29 d0                	sub    %edx,%eax
+  802168:	89 c2                	mov    %eax,%edx
+  80216a:	c1 ea 0f             	shr    $0xf,%edx
+  80216d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802172:	b8 00 00 00 00       	mov    $0x0,%eax
+  802177:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80217a:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  802181:	8b 40 48             	mov    0x48(%eax),%eax
+  802184:	83 ec 04             	sub    $0x4,%esp
+  802187:	53                   	push   %ebx
+  802188:	50                   	push   %eax
+  802189:	68 ed 58 80 00       	push   $0x8058ed
+  80218e:	e8 75 e4 ff ff       	call   800608 <cprintf>
+		return -E_INVAL;
+  802193:	83 c4 10             	add    $0x10,%esp
+  802196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80219b:	eb bb                	jmp    802158 <write+0x53>
+		return -E_NOT_SUPP;
+  80219d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021a2:	eb b4                	jmp    802158 <write+0x53>
+
+008021a4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021a4:	55                   	push   %ebp
+  8021a5:	89 e5                	mov    %esp,%ebp
+  8021a7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021ad:	50                   	push   %eax
+  8021ae:	ff 75 08             	push   0x8(%ebp)
+  8021b1:	e8 d3 fb ff ff       	call   801d89 <fd_lookup>
+  8021b6:	83 c4 10             	add    $0x10,%esp
+  8021b9:	85 c0                	test   %eax,%eax
+  8021bb:	78 0e                	js     8021cb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8021bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8021c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+008021cd <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8021cd:	55                   	push   %ebp
+  8021ce:	89 e5                	mov    %esp,%ebp
+  8021d0:	53                   	push   %ebx
+  8021d1:	83 ec 1c             	sub    $0x1c,%esp
+  8021d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021da:	50                   	push   %eax
+  8021db:	ff 75 08             	push   0x8(%ebp)
+  8021de:	e8 a6 fb ff ff       	call   801d89 <fd_lookup>
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	78 33                	js     80221d <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8021ea:	83 fb 03             	cmp    $0x3,%ebx
+  8021ed:	74 28                	je     802217 <fcntl+0x4a>
+  8021ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f4:	83 fb 04             	cmp    $0x4,%ebx
+  8021f7:	75 24                	jne    80221d <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8021f9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8021fc:	8b 41 08             	mov    0x8(%ecx),%eax
+  8021ff:	80 e4 ef             	and    $0xef,%ah
+  802202:	8b 55 10             	mov    0x10(%ebp),%edx
+  802205:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  80220b:	09 d0                	or     %edx,%eax
+  80220d:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+  802215:	eb 06                	jmp    80221d <fcntl+0x50>
+		return fd->fd_omode;
+  802217:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221a:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  80221d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802220:	c9                   	leave
+  802221:	c3                   	ret
+
+00802222 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	56                   	push   %esi
+  802226:	53                   	push   %ebx
+  802227:	83 ec 18             	sub    $0x18,%esp
+  80222a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80222d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802230:	50                   	push   %eax
+  802231:	53                   	push   %ebx
+  802232:	e8 52 fb ff ff       	call   801d89 <fd_lookup>
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	85 c0                	test   %eax,%eax
+  80223c:	78 34                	js     802272 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80223e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802241:	83 ec 08             	sub    $0x8,%esp
+  802244:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802247:	50                   	push   %eax
+  802248:	ff 36                	push   (%esi)
+  80224a:	e8 8c fb ff ff       	call   801ddb <dev_lookup>
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 1c                	js     802272 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802256:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80225a:	74 1d                	je     802279 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80225c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225f:	8b 40 18             	mov    0x18(%eax),%eax
+  802262:	85 c0                	test   %eax,%eax
+  802264:	74 51                	je     8022b7 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802266:	83 ec 08             	sub    $0x8,%esp
+  802269:	ff 75 0c             	push   0xc(%ebp)
+  80226c:	56                   	push   %esi
+  80226d:	ff d0                	call   *%eax
+  80226f:	83 c4 10             	add    $0x10,%esp
+}
+  802272:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802275:	5b                   	pop    %ebx
+  802276:	5e                   	pop    %esi
+  802277:	5d                   	pop    %ebp
+  802278:	c3                   	ret
+  802279:	89 e2                	mov    %esp,%edx
+  80227b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802280:	29 d0                	sub    %edx,%eax
+  802282:	89 c2                	mov    %eax,%edx
+  802284:	c1 ea 0f             	shr    $0xf,%edx
+  802287:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80228c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802291:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802294:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  80229b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80229e:	83 ec 04             	sub    $0x4,%esp
+  8022a1:	53                   	push   %ebx
+  8022a2:	50                   	push   %eax
+  8022a3:	68 b0 58 80 00       	push   $0x8058b0
+  8022a8:	e8 5b e3 ff ff       	call   800608 <cprintf>
+		return -E_INVAL;
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022b5:	eb bb                	jmp    802272 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8022b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022bc:	eb b4                	jmp    802272 <ftruncate+0x50>
+
+008022be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	56                   	push   %esi
+  8022c2:	53                   	push   %ebx
+  8022c3:	83 ec 18             	sub    $0x18,%esp
+  8022c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022cc:	50                   	push   %eax
+  8022cd:	ff 75 08             	push   0x8(%ebp)
+  8022d0:	e8 b4 fa ff ff       	call   801d89 <fd_lookup>
+  8022d5:	83 c4 10             	add    $0x10,%esp
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	78 53                	js     80232f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022df:	83 ec 08             	sub    $0x8,%esp
+  8022e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e5:	50                   	push   %eax
+  8022e6:	ff 36                	push   (%esi)
+  8022e8:	e8 ee fa ff ff       	call   801ddb <dev_lookup>
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	85 c0                	test   %eax,%eax
+  8022f2:	78 3b                	js     80232f <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8022f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8022fb:	74 39                	je     802336 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8022fd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802300:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802307:	00 00 00 
+	stat->st_isdir = 0;
+  80230a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802311:	00 00 00 
+	stat->st_version = 0;
+  802314:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80231b:	00 00 00 
+	stat->st_dev = dev;
+  80231e:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802324:	83 ec 08             	sub    $0x8,%esp
+  802327:	53                   	push   %ebx
+  802328:	56                   	push   %esi
+  802329:	ff 50 14             	call   *0x14(%eax)
+  80232c:	83 c4 10             	add    $0x10,%esp
+}
+  80232f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802332:	5b                   	pop    %ebx
+  802333:	5e                   	pop    %esi
+  802334:	5d                   	pop    %ebp
+  802335:	c3                   	ret
+		return -E_NOT_SUPP;
+  802336:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80233b:	eb f2                	jmp    80232f <fstat+0x71>
+
+0080233d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80233d:	55                   	push   %ebp
+  80233e:	89 e5                	mov    %esp,%ebp
+  802340:	56                   	push   %esi
+  802341:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802342:	83 ec 08             	sub    $0x8,%esp
+  802345:	6a 00                	push   $0x0
+  802347:	ff 75 08             	push   0x8(%ebp)
+  80234a:	e8 b7 01 00 00       	call   802506 <open>
+  80234f:	89 c3                	mov    %eax,%ebx
+  802351:	83 c4 10             	add    $0x10,%esp
+  802354:	85 c0                	test   %eax,%eax
+  802356:	78 1b                	js     802373 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802358:	83 ec 08             	sub    $0x8,%esp
+  80235b:	ff 75 0c             	push   0xc(%ebp)
+  80235e:	50                   	push   %eax
+  80235f:	e8 5a ff ff ff       	call   8022be <fstat>
+  802364:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802366:	89 1c 24             	mov    %ebx,(%esp)
+  802369:	e8 60 fb ff ff       	call   801ece <close>
+	return r;
+  80236e:	83 c4 10             	add    $0x10,%esp
+  802371:	89 f3                	mov    %esi,%ebx
+}
+  802373:	89 d8                	mov    %ebx,%eax
+  802375:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802378:	5b                   	pop    %ebx
+  802379:	5e                   	pop    %esi
+  80237a:	5d                   	pop    %ebp
+  80237b:	c3                   	ret
+
+0080237c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80237c:	55                   	push   %ebp
+  80237d:	89 e5                	mov    %esp,%ebp
+  80237f:	56                   	push   %esi
+  802380:	53                   	push   %ebx
+  802381:	89 c6                	mov    %eax,%esi
+  802383:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802385:	83 3d 04 7c 80 00 00 	cmpl   $0x0,0x807c04
+  80238c:	74 27                	je     8023b5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80238e:	6a 07                	push   $0x7
+  802390:	68 00 90 80 00       	push   $0x809000
+  802395:	56                   	push   %esi
+  802396:	ff 35 04 7c 80 00    	push   0x807c04
+  80239c:	e8 1d 29 00 00       	call   804cbe <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8023a1:	83 c4 0c             	add    $0xc,%esp
+  8023a4:	6a 00                	push   $0x0
+  8023a6:	53                   	push   %ebx
+  8023a7:	6a 00                	push   $0x0
+  8023a9:	e8 80 26 00 00       	call   804a2e <ipc_recv>
+}
+  8023ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b1:	5b                   	pop    %ebx
+  8023b2:	5e                   	pop    %esi
+  8023b3:	5d                   	pop    %ebp
+  8023b4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8023b5:	83 ec 0c             	sub    $0xc,%esp
+  8023b8:	6a 02                	push   $0x2
+  8023ba:	e8 68 29 00 00       	call   804d27 <ipc_find_env>
+  8023bf:	a3 04 7c 80 00       	mov    %eax,0x807c04
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	eb c5                	jmp    80238e <fsipc+0x12>
+
+008023c9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8023cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023d5:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  8023da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023dd:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8023e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023ec:	e8 8b ff ff ff       	call   80237c <fsipc>
+}
+  8023f1:	c9                   	leave
+  8023f2:	c3                   	ret
+
+008023f3 <devfile_flush>:
+{
+  8023f3:	55                   	push   %ebp
+  8023f4:	89 e5                	mov    %esp,%ebp
+  8023f6:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023ff:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802404:	ba 00 00 00 00       	mov    $0x0,%edx
+  802409:	b8 06 00 00 00       	mov    $0x6,%eax
+  80240e:	e8 69 ff ff ff       	call   80237c <fsipc>
+}
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+
+00802415 <devfile_stat>:
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	53                   	push   %ebx
+  802419:	83 ec 04             	sub    $0x4,%esp
+  80241c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80241f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802422:	8b 40 0c             	mov    0xc(%eax),%eax
+  802425:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80242a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802434:	e8 43 ff ff ff       	call   80237c <fsipc>
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	78 37                	js     802474 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80243d:	83 ec 08             	sub    $0x8,%esp
+  802440:	68 00 90 80 00       	push   $0x809000
+  802445:	53                   	push   %ebx
+  802446:	e8 b4 e8 ff ff       	call   800cff <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80244b:	a1 80 90 80 00       	mov    0x809080,%eax
+  802450:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802456:	a1 84 90 80 00       	mov    0x809084,%eax
+  80245b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802461:	a1 88 90 80 00       	mov    0x809088,%eax
+  802466:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80246c:	83 c4 10             	add    $0x10,%esp
+  80246f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+00802479 <devfile_write>:
+{
+  802479:	55                   	push   %ebp
+  80247a:	89 e5                	mov    %esp,%ebp
+  80247c:	83 ec 0c             	sub    $0xc,%esp
+  80247f:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802482:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802487:	39 d0                	cmp    %edx,%eax
+  802489:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80248c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80248f:	8b 52 0c             	mov    0xc(%edx),%edx
+  802492:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  802498:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  80249d:	50                   	push   %eax
+  80249e:	ff 75 0c             	push   0xc(%ebp)
+  8024a1:	68 08 90 80 00       	push   $0x809008
+  8024a6:	e8 04 ea ff ff       	call   800eaf <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8024ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8024b5:	e8 c2 fe ff ff       	call   80237c <fsipc>
+}
+  8024ba:	c9                   	leave
+  8024bb:	c3                   	ret
+
+008024bc <devfile_read>:
+{
+  8024bc:	55                   	push   %ebp
+  8024bd:	89 e5                	mov    %esp,%ebp
+  8024bf:	53                   	push   %ebx
+  8024c0:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024c9:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  8024ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024d1:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8024d6:	ba 00 90 80 00       	mov    $0x809000,%edx
+  8024db:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024e0:	e8 97 fe ff ff       	call   80237c <fsipc>
+  8024e5:	89 c3                	mov    %eax,%ebx
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	78 14                	js     8024ff <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8024eb:	83 ec 04             	sub    $0x4,%esp
+  8024ee:	50                   	push   %eax
+  8024ef:	68 00 90 80 00       	push   $0x809000
+  8024f4:	ff 75 0c             	push   0xc(%ebp)
+  8024f7:	e8 b3 e9 ff ff       	call   800eaf <memmove>
+	return r;
+  8024fc:	83 c4 10             	add    $0x10,%esp
+}
+  8024ff:	89 d8                	mov    %ebx,%eax
+  802501:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802504:	c9                   	leave
+  802505:	c3                   	ret
+
+00802506 <open>:
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	53                   	push   %ebx
+  80250a:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80250d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802510:	50                   	push   %eax
+  802511:	e8 23 f8 ff ff       	call   801d39 <fd_alloc>
+  802516:	89 c3                	mov    %eax,%ebx
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 2a                	js     802549 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80251f:	83 ec 0c             	sub    $0xc,%esp
+  802522:	ff 75 08             	push   0x8(%ebp)
+  802525:	e8 89 e7 ff ff       	call   800cb3 <strlen>
+  80252a:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80252d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802532:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802537:	7e 17                	jle    802550 <open+0x4a>
+	fd_close(fd, 1);
+  802539:	83 ec 08             	sub    $0x8,%esp
+  80253c:	6a 01                	push   $0x1
+  80253e:	ff 75 f4             	push   -0xc(%ebp)
+  802541:	e8 08 f9 ff ff       	call   801e4e <fd_close>
+	return r;
+  802546:	83 c4 10             	add    $0x10,%esp
+}
+  802549:	89 d8                	mov    %ebx,%eax
+  80254b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80254e:	c9                   	leave
+  80254f:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802550:	83 ec 08             	sub    $0x8,%esp
+  802553:	ff 75 08             	push   0x8(%ebp)
+  802556:	68 00 90 80 00       	push   $0x809000
+  80255b:	e8 9f e7 ff ff       	call   800cff <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802560:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802563:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802568:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80256b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802570:	e8 07 fe ff ff       	call   80237c <fsipc>
+  802575:	89 c3                	mov    %eax,%ebx
+  802577:	83 c4 10             	add    $0x10,%esp
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	78 bb                	js     802539 <open+0x33>
+	return fd2num(fd); 	
+  80257e:	83 ec 0c             	sub    $0xc,%esp
+  802581:	ff 75 f4             	push   -0xc(%ebp)
+  802584:	e8 89 f7 ff ff       	call   801d12 <fd2num>
+  802589:	89 c3                	mov    %eax,%ebx
+  80258b:	83 c4 10             	add    $0x10,%esp
+  80258e:	eb b9                	jmp    802549 <open+0x43>
+
+00802590 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802590:	55                   	push   %ebp
+  802591:	89 e5                	mov    %esp,%ebp
+  802593:	53                   	push   %ebx
+  802594:	83 ec 1c             	sub    $0x1c,%esp
+  802597:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80259a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80259d:	50                   	push   %eax
+  80259e:	ff 75 08             	push   0x8(%ebp)
+  8025a1:	e8 e3 f7 ff ff       	call   801d89 <fd_lookup>
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	85 c0                	test   %eax,%eax
+  8025ab:	78 5a                	js     802607 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8025ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b0:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  8025b6:	39 10                	cmp    %edx,(%eax)
+  8025b8:	75 66                	jne    802620 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8025ba:	83 3d 04 7c 80 00 00 	cmpl   $0x0,0x807c04
+  8025c1:	74 49                	je     80260c <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8025c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025c9:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  8025ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d1:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  8025d6:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8025dc:	6a 07                	push   $0x7
+  8025de:	68 00 90 80 00       	push   $0x809000
+  8025e3:	6a 09                	push   $0x9
+  8025e5:	ff 35 04 7c 80 00    	push   0x807c04
+  8025eb:	e8 ce 26 00 00       	call   804cbe <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  8025f0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8025f7:	6a 00                	push   $0x0
+  8025f9:	53                   	push   %ebx
+  8025fa:	ff 75 10             	push   0x10(%ebp)
+  8025fd:	6a 00                	push   $0x0
+  8025ff:	e8 f7 24 00 00       	call   804afb <ipc_recv_pages>
+  802604:	83 c4 20             	add    $0x20,%esp
+}
+  802607:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80260a:	c9                   	leave
+  80260b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80260c:	83 ec 0c             	sub    $0xc,%esp
+  80260f:	6a 02                	push   $0x2
+  802611:	e8 11 27 00 00       	call   804d27 <ipc_find_env>
+  802616:	a3 04 7c 80 00       	mov    %eax,0x807c04
+  80261b:	83 c4 10             	add    $0x10,%esp
+  80261e:	eb a3                	jmp    8025c3 <fmap+0x33>
+		return -E_INVAL;
+  802620:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802625:	eb e0                	jmp    802607 <fmap+0x77>
+
+00802627 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802627:	55                   	push   %ebp
+  802628:	89 e5                	mov    %esp,%ebp
+  80262a:	53                   	push   %ebx
+  80262b:	83 ec 10             	sub    $0x10,%esp
+  80262e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802631:	53                   	push   %ebx
+  802632:	e8 7c e6 ff ff       	call   800cb3 <strlen>
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80263f:	7f 25                	jg     802666 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802641:	83 ec 08             	sub    $0x8,%esp
+  802644:	53                   	push   %ebx
+  802645:	68 00 90 80 00       	push   $0x809000
+  80264a:	e8 b0 e6 ff ff       	call   800cff <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80264f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802654:	b8 07 00 00 00       	mov    $0x7,%eax
+  802659:	e8 1e fd ff ff       	call   80237c <fsipc>
+  80265e:	83 c4 10             	add    $0x10,%esp
+}
+  802661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802664:	c9                   	leave
+  802665:	c3                   	ret
+		return -E_BAD_PATH;
+  802666:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80266b:	eb f4                	jmp    802661 <remove+0x3a>
+
+0080266d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80266d:	55                   	push   %ebp
+  80266e:	89 e5                	mov    %esp,%ebp
+  802670:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802673:	ba 00 00 00 00       	mov    $0x0,%edx
+  802678:	b8 08 00 00 00       	mov    $0x8,%eax
+  80267d:	e8 fa fc ff ff       	call   80237c <fsipc>
+}
+  802682:	c9                   	leave
+  802683:	c3                   	ret
+
+00802684 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802684:	55                   	push   %ebp
+  802685:	89 e5                	mov    %esp,%ebp
+  802687:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80268a:	68 20 59 80 00       	push   $0x805920
+  80268f:	ff 75 0c             	push   0xc(%ebp)
+  802692:	e8 68 e6 ff ff       	call   800cff <strcpy>
+	return 0;
+}
+  802697:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269c:	c9                   	leave
+  80269d:	c3                   	ret
+
+0080269e <devsock_close>:
+{
+  80269e:	55                   	push   %ebp
+  80269f:	89 e5                	mov    %esp,%ebp
+  8026a1:	53                   	push   %ebx
+  8026a2:	83 ec 10             	sub    $0x10,%esp
+  8026a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026a8:	53                   	push   %ebx
+  8026a9:	e8 b8 26 00 00       	call   804d66 <pageref>
+  8026ae:	89 c2                	mov    %eax,%edx
+  8026b0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026b3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026b8:	83 fa 01             	cmp    $0x1,%edx
+  8026bb:	74 05                	je     8026c2 <devsock_close+0x24>
+}
+  8026bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026c0:	c9                   	leave
+  8026c1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8026c2:	83 ec 0c             	sub    $0xc,%esp
+  8026c5:	ff 73 0c             	push   0xc(%ebx)
+  8026c8:	e8 b0 05 00 00       	call   802c7d <nsipc_close>
+  8026cd:	83 c4 10             	add    $0x10,%esp
+  8026d0:	eb eb                	jmp    8026bd <devsock_close+0x1f>
+
+008026d2 <devsock_write>:
+{
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	53                   	push   %ebx
+  8026d6:	83 ec 14             	sub    $0x14,%esp
+  8026d9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026df:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  8026e2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8026e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8026e8:	8b 41 08             	mov    0x8(%ecx),%eax
+  8026eb:	c1 f8 09             	sar    $0x9,%eax
+  8026ee:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8026f1:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8026f7:	77 13                	ja     80270c <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  8026f9:	50                   	push   %eax
+  8026fa:	52                   	push   %edx
+  8026fb:	53                   	push   %ebx
+  8026fc:	ff 71 0c             	push   0xc(%ecx)
+  8026ff:	e8 5c 06 00 00       	call   802d60 <nsipc_send>
+  802704:	83 c4 10             	add    $0x10,%esp
+}
+  802707:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80270a:	c9                   	leave
+  80270b:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80270c:	50                   	push   %eax
+  80270d:	6a 01                	push   $0x1
+  80270f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802712:	50                   	push   %eax
+  802713:	ff 71 0c             	push   0xc(%ecx)
+  802716:	e8 a6 06 00 00       	call   802dc1 <nsipc_sendmsg>
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	eb e7                	jmp    802707 <devsock_write+0x35>
+
+00802720 <devsock_read>:
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	53                   	push   %ebx
+  802724:	83 ec 14             	sub    $0x14,%esp
+  802727:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80272a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80272d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802730:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802733:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802736:	8b 41 08             	mov    0x8(%ecx),%eax
+  802739:	c1 f8 09             	sar    $0x9,%eax
+  80273c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  80273f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802745:	77 13                	ja     80275a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802747:	50                   	push   %eax
+  802748:	52                   	push   %edx
+  802749:	53                   	push   %ebx
+  80274a:	ff 71 0c             	push   0xc(%ecx)
+  80274d:	e8 9c 05 00 00       	call   802cee <nsipc_recv>
+  802752:	83 c4 10             	add    $0x10,%esp
+}
+  802755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802758:	c9                   	leave
+  802759:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  80275a:	50                   	push   %eax
+  80275b:	6a 01                	push   $0x1
+  80275d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802760:	50                   	push   %eax
+  802761:	ff 71 0c             	push   0xc(%ecx)
+  802764:	e8 02 0a 00 00       	call   80316b <nsipc_recvmsg>
+  802769:	83 c4 10             	add    $0x10,%esp
+  80276c:	eb e7                	jmp    802755 <devsock_read+0x35>
+
+0080276e <fd2sockid>:
+{
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802774:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802777:	52                   	push   %edx
+  802778:	50                   	push   %eax
+  802779:	e8 0b f6 ff ff       	call   801d89 <fd_lookup>
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	85 c0                	test   %eax,%eax
+  802783:	78 10                	js     802795 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802785:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802788:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  80278e:	39 08                	cmp    %ecx,(%eax)
+  802790:	75 05                	jne    802797 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802792:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+		return -E_NOT_SUPP;
+  802797:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80279c:	eb f7                	jmp    802795 <fd2sockid+0x27>
+
+0080279e <sock_flags>:
+{
+  80279e:	55                   	push   %ebp
+  80279f:	89 e5                	mov    %esp,%ebp
+  8027a1:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  8027a4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8027a7:	52                   	push   %edx
+  8027a8:	50                   	push   %eax
+  8027a9:	e8 db f5 ff ff       	call   801d89 <fd_lookup>
+  8027ae:	83 c4 10             	add    $0x10,%esp
+  8027b1:	85 c0                	test   %eax,%eax
+  8027b3:	78 0e                	js     8027c3 <sock_flags+0x25>
+  8027b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8027bb:	c1 e8 09             	shr    $0x9,%eax
+  8027be:	83 e0 08             	and    $0x8,%eax
+}
+  8027c1:	c9                   	leave
+  8027c2:	c3                   	ret
+		return 0;
+  8027c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c8:	eb f7                	jmp    8027c1 <sock_flags+0x23>
+
+008027ca <alloc_sockfd>:
+{
+  8027ca:	55                   	push   %ebp
+  8027cb:	89 e5                	mov    %esp,%ebp
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+  8027cf:	83 ec 1c             	sub    $0x1c,%esp
+  8027d2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8027d4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027d7:	50                   	push   %eax
+  8027d8:	e8 5c f5 ff ff       	call   801d39 <fd_alloc>
+  8027dd:	89 c3                	mov    %eax,%ebx
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	78 43                	js     802829 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8027e6:	83 ec 04             	sub    $0x4,%esp
+  8027e9:	68 07 04 00 00       	push   $0x407
+  8027ee:	ff 75 f4             	push   -0xc(%ebp)
+  8027f1:	6a 00                	push   $0x0
+  8027f3:	e8 3b e9 ff ff       	call   801133 <sys_page_alloc>
+  8027f8:	89 c3                	mov    %eax,%ebx
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	78 28                	js     802829 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802804:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  80280a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80280c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80280f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802816:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802819:	83 ec 0c             	sub    $0xc,%esp
+  80281c:	50                   	push   %eax
+  80281d:	e8 f0 f4 ff ff       	call   801d12 <fd2num>
+  802822:	89 c3                	mov    %eax,%ebx
+  802824:	83 c4 10             	add    $0x10,%esp
+  802827:	eb 0c                	jmp    802835 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802829:	83 ec 0c             	sub    $0xc,%esp
+  80282c:	56                   	push   %esi
+  80282d:	e8 4b 04 00 00       	call   802c7d <nsipc_close>
+		return r;
+  802832:	83 c4 10             	add    $0x10,%esp
+}
+  802835:	89 d8                	mov    %ebx,%eax
+  802837:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80283a:	5b                   	pop    %ebx
+  80283b:	5e                   	pop    %esi
+  80283c:	5d                   	pop    %ebp
+  80283d:	c3                   	ret
+
+0080283e <accept>:
+{
+  80283e:	55                   	push   %ebp
+  80283f:	89 e5                	mov    %esp,%ebp
+  802841:	56                   	push   %esi
+  802842:	53                   	push   %ebx
+  802843:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802846:	89 f0                	mov    %esi,%eax
+  802848:	e8 21 ff ff ff       	call   80276e <fd2sockid>
+  80284d:	89 c3                	mov    %eax,%ebx
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	78 24                	js     802877 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802853:	89 f0                	mov    %esi,%eax
+  802855:	e8 44 ff ff ff       	call   80279e <sock_flags>
+  80285a:	50                   	push   %eax
+  80285b:	ff 75 10             	push   0x10(%ebp)
+  80285e:	ff 75 0c             	push   0xc(%ebp)
+  802861:	53                   	push   %ebx
+  802862:	e8 6b 03 00 00       	call   802bd2 <nsipc_accept>
+  802867:	89 c3                	mov    %eax,%ebx
+  802869:	83 c4 10             	add    $0x10,%esp
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	78 07                	js     802877 <accept+0x39>
+	return alloc_sockfd(r);
+  802870:	e8 55 ff ff ff       	call   8027ca <alloc_sockfd>
+  802875:	89 c3                	mov    %eax,%ebx
+}
+  802877:	89 d8                	mov    %ebx,%eax
+  802879:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80287c:	5b                   	pop    %ebx
+  80287d:	5e                   	pop    %esi
+  80287e:	5d                   	pop    %ebp
+  80287f:	c3                   	ret
+
+00802880 <bind>:
+{
+  802880:	55                   	push   %ebp
+  802881:	89 e5                	mov    %esp,%ebp
+  802883:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802886:	8b 45 08             	mov    0x8(%ebp),%eax
+  802889:	e8 e0 fe ff ff       	call   80276e <fd2sockid>
+  80288e:	85 c0                	test   %eax,%eax
+  802890:	78 12                	js     8028a4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802892:	83 ec 04             	sub    $0x4,%esp
+  802895:	ff 75 10             	push   0x10(%ebp)
+  802898:	ff 75 0c             	push   0xc(%ebp)
+  80289b:	50                   	push   %eax
+  80289c:	e8 85 03 00 00       	call   802c26 <nsipc_bind>
+  8028a1:	83 c4 10             	add    $0x10,%esp
+}
+  8028a4:	c9                   	leave
+  8028a5:	c3                   	ret
+
+008028a6 <shutdown>:
+{
+  8028a6:	55                   	push   %ebp
+  8028a7:	89 e5                	mov    %esp,%ebp
+  8028a9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028af:	e8 ba fe ff ff       	call   80276e <fd2sockid>
+  8028b4:	85 c0                	test   %eax,%eax
+  8028b6:	78 0f                	js     8028c7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8028b8:	83 ec 08             	sub    $0x8,%esp
+  8028bb:	ff 75 0c             	push   0xc(%ebp)
+  8028be:	50                   	push   %eax
+  8028bf:	e8 97 03 00 00       	call   802c5b <nsipc_shutdown>
+  8028c4:	83 c4 10             	add    $0x10,%esp
+}
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+
+008028c9 <connect>:
+{
+  8028c9:	55                   	push   %ebp
+  8028ca:	89 e5                	mov    %esp,%ebp
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d2:	e8 97 fe ff ff       	call   80276e <fd2sockid>
+  8028d7:	85 c0                	test   %eax,%eax
+  8028d9:	78 12                	js     8028ed <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8028db:	83 ec 04             	sub    $0x4,%esp
+  8028de:	ff 75 10             	push   0x10(%ebp)
+  8028e1:	ff 75 0c             	push   0xc(%ebp)
+  8028e4:	50                   	push   %eax
+  8028e5:	e8 ad 03 00 00       	call   802c97 <nsipc_connect>
+  8028ea:	83 c4 10             	add    $0x10,%esp
+}
+  8028ed:	c9                   	leave
+  8028ee:	c3                   	ret
+
+008028ef <listen>:
+{
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8028f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f8:	e8 71 fe ff ff       	call   80276e <fd2sockid>
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	78 0f                	js     802910 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802901:	83 ec 08             	sub    $0x8,%esp
+  802904:	ff 75 0c             	push   0xc(%ebp)
+  802907:	50                   	push   %eax
+  802908:	e8 bf 03 00 00       	call   802ccc <nsipc_listen>
+  80290d:	83 c4 10             	add    $0x10,%esp
+}
+  802910:	c9                   	leave
+  802911:	c3                   	ret
+
+00802912 <sendmsg>:
+{
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	57                   	push   %edi
+  802916:	56                   	push   %esi
+  802917:	53                   	push   %ebx
+  802918:	83 ec 0c             	sub    $0xc,%esp
+  80291b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80291e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802921:	89 f0                	mov    %esi,%eax
+  802923:	e8 46 fe ff ff       	call   80276e <fd2sockid>
+  802928:	89 c3                	mov    %eax,%ebx
+  80292a:	85 c0                	test   %eax,%eax
+  80292c:	78 1c                	js     80294a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  80292e:	89 f0                	mov    %esi,%eax
+  802930:	e8 69 fe ff ff       	call   80279e <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802935:	0b 45 10             	or     0x10(%ebp),%eax
+  802938:	50                   	push   %eax
+  802939:	ff 77 0c             	push   0xc(%edi)
+  80293c:	ff 77 08             	push   0x8(%edi)
+  80293f:	53                   	push   %ebx
+  802940:	e8 7c 04 00 00       	call   802dc1 <nsipc_sendmsg>
+  802945:	89 c3                	mov    %eax,%ebx
+  802947:	83 c4 10             	add    $0x10,%esp
+}
+  80294a:	89 d8                	mov    %ebx,%eax
+  80294c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80294f:	5b                   	pop    %ebx
+  802950:	5e                   	pop    %esi
+  802951:	5f                   	pop    %edi
+  802952:	5d                   	pop    %ebp
+  802953:	c3                   	ret
+
+00802954 <recvmsg>:
+{
+  802954:	55                   	push   %ebp
+  802955:	89 e5                	mov    %esp,%ebp
+  802957:	57                   	push   %edi
+  802958:	56                   	push   %esi
+  802959:	53                   	push   %ebx
+  80295a:	83 ec 0c             	sub    $0xc,%esp
+  80295d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802960:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802963:	89 f8                	mov    %edi,%eax
+  802965:	e8 04 fe ff ff       	call   80276e <fd2sockid>
+  80296a:	89 c3                	mov    %eax,%ebx
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 2a                	js     80299a <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802970:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802977:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  80297e:	89 f8                	mov    %edi,%eax
+  802980:	e8 19 fe ff ff       	call   80279e <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802985:	0b 45 10             	or     0x10(%ebp),%eax
+  802988:	50                   	push   %eax
+  802989:	ff 76 0c             	push   0xc(%esi)
+  80298c:	ff 76 08             	push   0x8(%esi)
+  80298f:	53                   	push   %ebx
+  802990:	e8 d6 07 00 00       	call   80316b <nsipc_recvmsg>
+  802995:	89 c3                	mov    %eax,%ebx
+  802997:	83 c4 10             	add    $0x10,%esp
+}
+  80299a:	89 d8                	mov    %ebx,%eax
+  80299c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80299f:	5b                   	pop    %ebx
+  8029a0:	5e                   	pop    %esi
+  8029a1:	5f                   	pop    %edi
+  8029a2:	5d                   	pop    %ebp
+  8029a3:	c3                   	ret
+
+008029a4 <sendfile>:
+{
+  8029a4:	55                   	push   %ebp
+  8029a5:	89 e5                	mov    %esp,%ebp
+  8029a7:	56                   	push   %esi
+  8029a8:	53                   	push   %ebx
+  8029a9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8029ac:	89 f0                	mov    %esi,%eax
+  8029ae:	e8 bb fd ff ff       	call   80276e <fd2sockid>
+  8029b3:	89 c3                	mov    %eax,%ebx
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	78 1f                	js     8029d8 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8029b9:	89 f0                	mov    %esi,%eax
+  8029bb:	e8 de fd ff ff       	call   80279e <sock_flags>
+  8029c0:	83 ec 0c             	sub    $0xc,%esp
+  8029c3:	50                   	push   %eax
+  8029c4:	ff 75 14             	push   0x14(%ebp)
+  8029c7:	ff 75 10             	push   0x10(%ebp)
+  8029ca:	ff 75 0c             	push   0xc(%ebp)
+  8029cd:	53                   	push   %ebx
+  8029ce:	e8 64 06 00 00       	call   803037 <nsipc_sendfile>
+  8029d3:	89 c3                	mov    %eax,%ebx
+  8029d5:	83 c4 20             	add    $0x20,%esp
+}
+  8029d8:	89 d8                	mov    %ebx,%eax
+  8029da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029dd:	5b                   	pop    %ebx
+  8029de:	5e                   	pop    %esi
+  8029df:	5d                   	pop    %ebp
+  8029e0:	c3                   	ret
+
+008029e1 <evctl>:
+{
+  8029e1:	55                   	push   %ebp
+  8029e2:	89 e5                	mov    %esp,%ebp
+  8029e4:	53                   	push   %ebx
+  8029e5:	83 ec 04             	sub    $0x4,%esp
+  8029e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8029eb:	89 d8                	mov    %ebx,%eax
+  8029ed:	e8 7c fd ff ff       	call   80276e <fd2sockid>
+  8029f2:	85 c0                	test   %eax,%eax
+  8029f4:	78 10                	js     802a06 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8029f6:	83 ec 04             	sub    $0x4,%esp
+  8029f9:	53                   	push   %ebx
+  8029fa:	ff 75 0c             	push   0xc(%ebp)
+  8029fd:	50                   	push   %eax
+  8029fe:	e8 d2 0b 00 00       	call   8035d5 <nsipc_evctl>
+  802a03:	83 c4 10             	add    $0x10,%esp
+}
+  802a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+
+00802a0b <evwait>:
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802a11:	ff 75 10             	push   0x10(%ebp)
+  802a14:	ff 75 0c             	push   0xc(%ebp)
+  802a17:	ff 75 08             	push   0x8(%ebp)
+  802a1a:	e8 e0 0b 00 00       	call   8035ff <nsipc_evwait>
+}
+  802a1f:	c9                   	leave
+  802a20:	c3                   	ret
+
+00802a21 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802a27:	ff 75 10             	push   0x10(%ebp)
+  802a2a:	ff 75 0c             	push   0xc(%ebp)
+  802a2d:	ff 75 08             	push   0x8(%ebp)
+  802a30:	e8 31 0c 00 00       	call   803666 <nsipc_socket>
+  802a35:	83 c4 10             	add    $0x10,%esp
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	78 05                	js     802a41 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802a3c:	e8 89 fd ff ff       	call   8027ca <alloc_sockfd>
+}
+  802a41:	c9                   	leave
+  802a42:	c3                   	ret
+
+00802a43 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802a43:	55                   	push   %ebp
+  802a44:	89 e5                	mov    %esp,%ebp
+  802a46:	53                   	push   %ebx
+  802a47:	83 ec 04             	sub    $0x4,%esp
+  802a4a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802a4c:	83 3d 24 7f 80 00 00 	cmpl   $0x0,0x807f24
+  802a53:	74 26                	je     802a7b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802a55:	6a 07                	push   $0x7
+  802a57:	68 00 a0 80 00       	push   $0x80a000
+  802a5c:	53                   	push   %ebx
+  802a5d:	ff 35 24 7f 80 00    	push   0x807f24
+  802a63:	e8 56 22 00 00       	call   804cbe <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802a68:	83 c4 0c             	add    $0xc,%esp
+  802a6b:	6a 00                	push   $0x0
+  802a6d:	6a 00                	push   $0x0
+  802a6f:	6a 00                	push   $0x0
+  802a71:	e8 b8 1f 00 00       	call   804a2e <ipc_recv>
+}
+  802a76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a79:	c9                   	leave
+  802a7a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a7b:	83 ec 0c             	sub    $0xc,%esp
+  802a7e:	6a 03                	push   $0x3
+  802a80:	e8 a2 22 00 00       	call   804d27 <ipc_find_env>
+  802a85:	a3 24 7f 80 00       	mov    %eax,0x807f24
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	eb c6                	jmp    802a55 <nsipc+0x12>
+
+00802a8f <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	56                   	push   %esi
+  802a93:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802a94:	8b 35 30 7f 80 00    	mov    0x807f30,%esi
+		return 0;
+  802a9a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802a9f:	85 f6                	test   %esi,%esi
+  802aa1:	75 33                	jne    802ad6 <nsbulk_map+0x47>
+  802aa3:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802aa8:	83 ec 04             	sub    $0x4,%esp
+  802aab:	6a 07                	push   $0x7
+  802aad:	53                   	push   %ebx
+  802aae:	6a 00                	push   $0x0
+  802ab0:	e8 7e e6 ff ff       	call   801133 <sys_page_alloc>
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	78 1a                	js     802ad6 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802abc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ac2:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802ac8:	75 de                	jne    802aa8 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802aca:	c7 05 30 7f 80 00 01 	movl   $0x1,0x807f30
+  802ad1:	00 00 00 
+	return 0;
+  802ad4:	89 f0                	mov    %esi,%eax
+}
+  802ad6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad9:	5b                   	pop    %ebx
+  802ada:	5e                   	pop    %esi
+  802adb:	5d                   	pop    %ebp
+  802adc:	c3                   	ret
+
+00802add <nsbulk_own>:
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	57                   	push   %edi
+  802ae1:	56                   	push   %esi
+  802ae2:	53                   	push   %ebx
+  802ae3:	83 ec 0c             	sub    $0xc,%esp
+  802ae6:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802ae8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802aeb:	85 d2                	test   %edx,%edx
+  802aed:	7f 0e                	jg     802afd <nsbulk_own+0x20>
+	return 0;
+  802aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af4:	eb 47                	jmp    802b3d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802af6:	83 c3 01             	add    $0x1,%ebx
+  802af9:	39 fb                	cmp    %edi,%ebx
+  802afb:	7d 3b                	jge    802b38 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802afd:	be 01 00 00 00       	mov    $0x1,%esi
+  802b02:	89 d9                	mov    %ebx,%ecx
+  802b04:	d3 e6                	shl    %cl,%esi
+  802b06:	89 f0                	mov    %esi,%eax
+  802b08:	23 05 2c 7f 80 00    	and    0x807f2c,%eax
+  802b0e:	74 e6                	je     802af6 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802b10:	83 ec 04             	sub    $0x4,%esp
+  802b13:	6a 07                	push   $0x7
+  802b15:	89 d8                	mov    %ebx,%eax
+  802b17:	c1 e0 0c             	shl    $0xc,%eax
+  802b1a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802b1f:	50                   	push   %eax
+  802b20:	6a 00                	push   $0x0
+  802b22:	e8 0c e6 ff ff       	call   801133 <sys_page_alloc>
+  802b27:	83 c4 10             	add    $0x10,%esp
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	78 0f                	js     802b3d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802b2e:	f7 d6                	not    %esi
+  802b30:	21 35 2c 7f 80 00    	and    %esi,0x807f2c
+  802b36:	eb be                	jmp    802af6 <nsbulk_own+0x19>
+	return 0;
+  802b38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b40:	5b                   	pop    %ebx
+  802b41:	5e                   	pop    %esi
+  802b42:	5f                   	pop    %edi
+  802b43:	5d                   	pop    %ebp
+  802b44:	c3                   	ret
+
+00802b45 <nsipc_bulk>:
+{
+  802b45:	55                   	push   %ebp
+  802b46:	89 e5                	mov    %esp,%ebp
+  802b48:	57                   	push   %edi
+  802b49:	56                   	push   %esi
+  802b4a:	53                   	push   %ebx
+  802b4b:	83 ec 1c             	sub    $0x1c,%esp
+  802b4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b51:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802b53:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802b59:	c1 fb 0c             	sar    $0xc,%ebx
+  802b5c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802b5f:	83 3d 24 7f 80 00 00 	cmpl   $0x0,0x807f24
+  802b66:	74 56                	je     802bbe <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b68:	85 ff                	test   %edi,%edi
+  802b6a:	7e 24                	jle    802b90 <nsipc_bulk+0x4b>
+  802b6c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802b72:	74 1c                	je     802b90 <nsipc_bulk+0x4b>
+  802b74:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802b7a:	c1 e3 0c             	shl    $0xc,%ebx
+  802b7d:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802b82:	0f b6 10             	movzbl (%eax),%edx
+  802b85:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802b87:	05 00 10 00 00       	add    $0x1000,%eax
+  802b8c:	39 d8                	cmp    %ebx,%eax
+  802b8e:	75 f2                	jne    802b82 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802b90:	83 ec 0c             	sub    $0xc,%esp
+  802b93:	56                   	push   %esi
+  802b94:	57                   	push   %edi
+  802b95:	68 00 00 00 e0       	push   $0xe0000000
+  802b9a:	ff 75 e4             	push   -0x1c(%ebp)
+  802b9d:	ff 35 24 7f 80 00    	push   0x807f24
+  802ba3:	e8 4a 21 00 00       	call   804cf2 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802ba8:	83 c4 1c             	add    $0x1c,%esp
+  802bab:	6a 00                	push   $0x0
+  802bad:	6a 00                	push   $0x0
+  802baf:	6a 00                	push   $0x0
+  802bb1:	e8 78 1e 00 00       	call   804a2e <ipc_recv>
+}
+  802bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb9:	5b                   	pop    %ebx
+  802bba:	5e                   	pop    %esi
+  802bbb:	5f                   	pop    %edi
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bbe:	83 ec 0c             	sub    $0xc,%esp
+  802bc1:	6a 03                	push   $0x3
+  802bc3:	e8 5f 21 00 00       	call   804d27 <ipc_find_env>
+  802bc8:	a3 24 7f 80 00       	mov    %eax,0x807f24
+  802bcd:	83 c4 10             	add    $0x10,%esp
+  802bd0:	eb 96                	jmp    802b68 <nsipc_bulk+0x23>
+
+00802bd2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802bd2:	55                   	push   %ebp
+  802bd3:	89 e5                	mov    %esp,%ebp
+  802bd5:	53                   	push   %ebx
+  802bd6:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  802be1:	8b 45 14             	mov    0x14(%ebp),%eax
+  802be4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802be9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bee:	e8 50 fe ff ff       	call   802a43 <nsipc>
+  802bf3:	89 c3                	mov    %eax,%ebx
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	79 07                	jns    802c00 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802bf9:	89 d8                	mov    %ebx,%eax
+  802bfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bfe:	c9                   	leave
+  802bff:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802c00:	83 ec 04             	sub    $0x4,%esp
+  802c03:	ff 35 10 a0 80 00    	push   0x80a010
+  802c09:	68 00 a0 80 00       	push   $0x80a000
+  802c0e:	ff 75 0c             	push   0xc(%ebp)
+  802c11:	e8 99 e2 ff ff       	call   800eaf <memmove>
+		*addrlen = ret->ret_addrlen;
+  802c16:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  802c1c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c1f:	89 10                	mov    %edx,(%eax)
+  802c21:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802c24:	eb d3                	jmp    802bf9 <nsipc_accept+0x27>
+
+00802c26 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802c26:	55                   	push   %ebp
+  802c27:	89 e5                	mov    %esp,%ebp
+  802c29:	53                   	push   %ebx
+  802c2a:	83 ec 08             	sub    $0x8,%esp
+  802c2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c33:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802c38:	53                   	push   %ebx
+  802c39:	ff 75 0c             	push   0xc(%ebp)
+  802c3c:	68 04 a0 80 00       	push   $0x80a004
+  802c41:	e8 69 e2 ff ff       	call   800eaf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802c46:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  802c4c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802c51:	e8 ed fd ff ff       	call   802a43 <nsipc>
+}
+  802c56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+
+00802c5b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802c5b:	55                   	push   %ebp
+  802c5c:	89 e5                	mov    %esp,%ebp
+  802c5e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802c61:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c64:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  802c69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c6c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802c71:	b8 03 00 00 00       	mov    $0x3,%eax
+  802c76:	e8 c8 fd ff ff       	call   802a43 <nsipc>
+}
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+
+00802c7d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802c7d:	55                   	push   %ebp
+  802c7e:	89 e5                	mov    %esp,%ebp
+  802c80:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802c83:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c86:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  802c8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802c90:	e8 ae fd ff ff       	call   802a43 <nsipc>
+}
+  802c95:	c9                   	leave
+  802c96:	c3                   	ret
+
+00802c97 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802c97:	55                   	push   %ebp
+  802c98:	89 e5                	mov    %esp,%ebp
+  802c9a:	53                   	push   %ebx
+  802c9b:	83 ec 08             	sub    $0x8,%esp
+  802c9e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ca9:	53                   	push   %ebx
+  802caa:	ff 75 0c             	push   0xc(%ebp)
+  802cad:	68 04 a0 80 00       	push   $0x80a004
+  802cb2:	e8 f8 e1 ff ff       	call   800eaf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802cb7:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  802cbd:	b8 05 00 00 00       	mov    $0x5,%eax
+  802cc2:	e8 7c fd ff ff       	call   802a43 <nsipc>
+}
+  802cc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cca:	c9                   	leave
+  802ccb:	c3                   	ret
+
+00802ccc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802ccc:	55                   	push   %ebp
+  802ccd:	89 e5                	mov    %esp,%ebp
+  802ccf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802cd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cd5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802cda:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cdd:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  802ce2:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ce7:	e8 57 fd ff ff       	call   802a43 <nsipc>
+}
+  802cec:	c9                   	leave
+  802ced:	c3                   	ret
+
+00802cee <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	56                   	push   %esi
+  802cf2:	53                   	push   %ebx
+  802cf3:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cf9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  802cfe:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  802d04:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d07:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802d0c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802d11:	e8 2d fd ff ff       	call   802a43 <nsipc>
+  802d16:	89 c3                	mov    %eax,%ebx
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	78 22                	js     802d3e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802d1c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802d21:	39 c6                	cmp    %eax,%esi
+  802d23:	0f 4e c6             	cmovle %esi,%eax
+  802d26:	39 c3                	cmp    %eax,%ebx
+  802d28:	7f 1d                	jg     802d47 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802d2a:	83 ec 04             	sub    $0x4,%esp
+  802d2d:	53                   	push   %ebx
+  802d2e:	68 00 a0 80 00       	push   $0x80a000
+  802d33:	ff 75 0c             	push   0xc(%ebp)
+  802d36:	e8 74 e1 ff ff       	call   800eaf <memmove>
+  802d3b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802d3e:	89 d8                	mov    %ebx,%eax
+  802d40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d43:	5b                   	pop    %ebx
+  802d44:	5e                   	pop    %esi
+  802d45:	5d                   	pop    %ebp
+  802d46:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802d47:	68 2c 59 80 00       	push   $0x80592c
+  802d4c:	68 41 59 80 00       	push   $0x805941
+  802d51:	68 b2 00 00 00       	push   $0xb2
+  802d56:	68 56 59 80 00       	push   $0x805956
+  802d5b:	e8 cd d7 ff ff       	call   80052d <_panic>
+
+00802d60 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802d60:	55                   	push   %ebp
+  802d61:	89 e5                	mov    %esp,%ebp
+  802d63:	53                   	push   %ebx
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d6d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  802d72:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802d78:	7f 2e                	jg     802da8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802d7a:	83 ec 04             	sub    $0x4,%esp
+  802d7d:	53                   	push   %ebx
+  802d7e:	ff 75 0c             	push   0xc(%ebp)
+  802d81:	68 0c a0 80 00       	push   $0x80a00c
+  802d86:	e8 24 e1 ff ff       	call   800eaf <memmove>
+	nsipcbuf.send.req_size = size;
+  802d8b:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  802d91:	8b 45 14             	mov    0x14(%ebp),%eax
+  802d94:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  802d99:	b8 08 00 00 00       	mov    $0x8,%eax
+  802d9e:	e8 a0 fc ff ff       	call   802a43 <nsipc>
+}
+  802da3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802da6:	c9                   	leave
+  802da7:	c3                   	ret
+	assert(size < 1600);
+  802da8:	68 62 59 80 00       	push   $0x805962
+  802dad:	68 41 59 80 00       	push   $0x805941
+  802db2:	68 bd 00 00 00       	push   $0xbd
+  802db7:	68 56 59 80 00       	push   $0x805956
+  802dbc:	e8 6c d7 ff ff       	call   80052d <_panic>
+
+00802dc1 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802dc1:	55                   	push   %ebp
+  802dc2:	89 e5                	mov    %esp,%ebp
+  802dc4:	57                   	push   %edi
+  802dc5:	56                   	push   %esi
+  802dc6:	53                   	push   %ebx
+  802dc7:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802dca:	e8 c0 fc ff ff       	call   802a8f <nsbulk_map>
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	78 55                	js     802e28 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802dd3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802dda:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802de1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802de8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802deb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802dee:	0f 8d 24 02 00 00    	jge    803018 <nsipc_sendmsg+0x257>
+  802df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802df7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802dfa:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802dfd:	89 d8                	mov    %ebx,%eax
+  802dff:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802e04:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802e06:	83 ec 0c             	sub    $0xc,%esp
+  802e09:	68 20 7c 80 00       	push   $0x807c20
+  802e0e:	e8 5a 0f 00 00       	call   803d6d <pgbatch_init>
+  802e13:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802e16:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802e18:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802e1b:	e9 82 00 00 00       	jmp    802ea2 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802e20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e23:	85 db                	test   %ebx,%ebx
+  802e25:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e2b:	5b                   	pop    %ebx
+  802e2c:	5e                   	pop    %esi
+  802e2d:	5f                   	pop    %edi
+  802e2e:	5d                   	pop    %ebp
+  802e2f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802e30:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802e35:	29 c8                	sub    %ecx,%eax
+  802e37:	39 d0                	cmp    %edx,%eax
+  802e39:	0f 46 d0             	cmovbe %eax,%edx
+  802e3c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802e3e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802e44:	85 ff                	test   %edi,%edi
+  802e46:	0f 49 c7             	cmovns %edi,%eax
+  802e49:	c1 f8 0c             	sar    $0xc,%eax
+  802e4c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802e51:	e8 87 fc ff ff       	call   802add <nsbulk_own>
+  802e56:	85 c0                	test   %eax,%eax
+  802e58:	0f 88 17 01 00 00    	js     802f75 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802e5e:	83 ec 04             	sub    $0x4,%esp
+  802e61:	56                   	push   %esi
+  802e62:	ff 75 e0             	push   -0x20(%ebp)
+  802e65:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802e68:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e6d:	50                   	push   %eax
+  802e6e:	e8 3c e0 ff ff       	call   800eaf <memmove>
+  802e73:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802e76:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802e79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e7c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e7f:	0f 84 fd 00 00 00    	je     802f82 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802e85:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802e88:	01 f7                	add    %esi,%edi
+  802e8a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e8d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e90:	0f 8d 01 01 00 00    	jge    802f97 <nsipc_sendmsg+0x1d6>
+  802e96:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802e9c:	0f 8f f0 00 00 00    	jg     802f92 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802ea2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ea5:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802ea8:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802eab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eae:	89 c2                	mov    %eax,%edx
+  802eb0:	03 13                	add    (%ebx),%edx
+  802eb2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802eb5:	8b 73 04             	mov    0x4(%ebx),%esi
+  802eb8:	29 c6                	sub    %eax,%esi
+  802eba:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802ebf:	29 f9                	sub    %edi,%ecx
+  802ec1:	39 ce                	cmp    %ecx,%esi
+  802ec3:	89 ca                	mov    %ecx,%edx
+  802ec5:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802ec8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802ecb:	89 f9                	mov    %edi,%ecx
+  802ecd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802ed3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ed6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802edb:	09 c8                	or     %ecx,%eax
+  802edd:	0f 85 4d ff ff ff    	jne    802e30 <nsipc_sendmsg+0x6f>
+  802ee3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802ee9:	0f 86 41 ff ff ff    	jbe    802e30 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802eef:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802ef5:	85 ff                	test   %edi,%edi
+  802ef7:	0f 49 c7             	cmovns %edi,%eax
+  802efa:	c1 f8 0c             	sar    $0xc,%eax
+  802efd:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802eff:	89 d1                	mov    %edx,%ecx
+  802f01:	c1 e9 0c             	shr    $0xc,%ecx
+  802f04:	01 c8                	add    %ecx,%eax
+  802f06:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f09:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f0c:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802f0e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f11:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802f16:	29 c8                	sub    %ecx,%eax
+  802f18:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f1b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802f1e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802f20:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f25:	89 f9                	mov    %edi,%ecx
+  802f27:	d3 e0                	shl    %cl,%eax
+  802f29:	09 05 2c 7f 80 00    	or     %eax,0x807f2c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f2f:	83 ec 08             	sub    $0x8,%esp
+  802f32:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802f34:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802f37:	50                   	push   %eax
+  802f38:	6a 00                	push   $0x0
+  802f3a:	56                   	push   %esi
+  802f3b:	6a 00                	push   $0x0
+  802f3d:	68 20 7c 80 00       	push   $0x807c20
+  802f42:	e8 e4 0e 00 00       	call   803e2b <pgbatch_map>
+  802f47:	83 c4 20             	add    $0x20,%esp
+  802f4a:	85 c0                	test   %eax,%eax
+  802f4c:	0f 88 ce fe ff ff    	js     802e20 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802f52:	83 c7 01             	add    $0x1,%edi
+  802f55:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f5b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802f5e:	39 c7                	cmp    %eax,%edi
+  802f60:	75 be                	jne    802f20 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802f62:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f65:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802f68:	89 d6                	mov    %edx,%esi
+  802f6a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802f70:	e9 01 ff ff ff       	jmp    802e76 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802f75:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802f78:	85 db                	test   %ebx,%ebx
+  802f7a:	0f 45 c3             	cmovne %ebx,%eax
+  802f7d:	e9 a6 fe ff ff       	jmp    802e28 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802f82:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802f86:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f8d:	e9 f3 fe ff ff       	jmp    802e85 <nsipc_sendmsg+0xc4>
+  802f92:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802f95:	eb 03                	jmp    802f9a <nsipc_sendmsg+0x1d9>
+  802f97:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802f9a:	83 ec 0c             	sub    $0xc,%esp
+  802f9d:	68 20 7c 80 00       	push   $0x807c20
+  802fa2:	e8 d4 0d 00 00       	call   803d7b <pgbatch_flush>
+  802fa7:	83 c4 10             	add    $0x10,%esp
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 50                	js     802ffe <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802fae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802fb6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802fbc:	89 fb                	mov    %edi,%ebx
+  802fbe:	29 f3                	sub    %esi,%ebx
+  802fc0:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802fc6:	8b 45 14             	mov    0x14(%ebp),%eax
+  802fc9:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802fce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802fd3:	89 fa                	mov    %edi,%edx
+  802fd5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802fda:	e8 66 fb ff ff       	call   802b45 <nsipc_bulk>
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	78 28                	js     80300b <nsipc_sendmsg+0x24a>
+		sent += r;
+  802fe3:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802fe6:	39 c3                	cmp    %eax,%ebx
+  802fe8:	75 0c                	jne    802ff6 <nsipc_sendmsg+0x235>
+  802fea:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802fed:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802ff0:	0f 8f f2 fd ff ff    	jg     802de8 <nsipc_sendmsg+0x27>
+		sent += r;
+  802ff6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802ff9:	e9 2a fe ff ff       	jmp    802e28 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802ffe:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803001:	85 db                	test   %ebx,%ebx
+  803003:	0f 45 c3             	cmovne %ebx,%eax
+  803006:	e9 1d fe ff ff       	jmp    802e28 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80300b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80300e:	85 db                	test   %ebx,%ebx
+  803010:	0f 45 c3             	cmovne %ebx,%eax
+  803013:	e9 10 fe ff ff       	jmp    802e28 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803018:	83 ec 0c             	sub    $0xc,%esp
+  80301b:	68 20 7c 80 00       	push   $0x807c20
+  803020:	e8 48 0d 00 00       	call   803d6d <pgbatch_init>
+  803025:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803028:	be 00 00 00 00       	mov    $0x0,%esi
+  80302d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803032:	e9 63 ff ff ff       	jmp    802f9a <nsipc_sendmsg+0x1d9>
+
+00803037 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803037:	55                   	push   %ebp
+  803038:	89 e5                	mov    %esp,%ebp
+  80303a:	57                   	push   %edi
+  80303b:	56                   	push   %esi
+  80303c:	53                   	push   %ebx
+  80303d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803040:	83 3d 28 7f 80 00 00 	cmpl   $0x0,0x807f28
+  803047:	0f 84 c8 00 00 00    	je     803115 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80304d:	83 3d 24 7f 80 00 00 	cmpl   $0x0,0x807f24
+  803054:	0f 84 e4 00 00 00    	je     80313e <nsipc_sendfile+0x107>
+{
+  80305a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80305f:	89 fb                	mov    %edi,%ebx
+  803061:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  803064:	0f 83 f0 00 00 00    	jae    80315a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80306a:	89 fa                	mov    %edi,%edx
+  80306c:	03 55 10             	add    0x10(%ebp),%edx
+  80306f:	89 d0                	mov    %edx,%eax
+  803071:	c1 f8 1f             	sar    $0x1f,%eax
+  803074:	c1 e8 14             	shr    $0x14,%eax
+  803077:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80307a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803080:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803082:	6a 10                	push   $0x10
+  803084:	68 00 20 01 e0       	push   $0xe0012000
+  803089:	52                   	push   %edx
+  80308a:	ff 75 0c             	push   0xc(%ebp)
+  80308d:	e8 fe f4 ff ff       	call   802590 <fmap>
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	85 c0                	test   %eax,%eax
+  803097:	0f 8e b8 00 00 00    	jle    803155 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  80309d:	39 c6                	cmp    %eax,%esi
+  80309f:	0f 8d b5 00 00 00    	jge    80315a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8030a5:	29 f0                	sub    %esi,%eax
+  8030a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8030aa:	29 da                	sub    %ebx,%edx
+  8030ac:	39 d0                	cmp    %edx,%eax
+  8030ae:	89 d3                	mov    %edx,%ebx
+  8030b0:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8030b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b6:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8030bb:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8030c1:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8030c7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8030ca:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8030cf:	83 ec 0c             	sub    $0xc,%esp
+  8030d2:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8030d4:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8030db:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8030de:	83 c0 01             	add    $0x1,%eax
+  8030e1:	50                   	push   %eax
+  8030e2:	68 00 10 01 e0       	push   $0xe0011000
+  8030e7:	6a 11                	push   $0x11
+  8030e9:	ff 35 24 7f 80 00    	push   0x807f24
+  8030ef:	e8 fe 1b 00 00       	call   804cf2 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8030f4:	83 c4 1c             	add    $0x1c,%esp
+  8030f7:	6a 00                	push   $0x0
+  8030f9:	6a 00                	push   $0x0
+  8030fb:	6a 00                	push   $0x0
+  8030fd:	e8 2c 19 00 00       	call   804a2e <ipc_recv>
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	85 c0                	test   %eax,%eax
+  803107:	78 5b                	js     803164 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803109:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80310b:	39 c3                	cmp    %eax,%ebx
+  80310d:	0f 8e 4c ff ff ff    	jle    80305f <nsipc_sendfile+0x28>
+  803113:	eb 45                	jmp    80315a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803115:	83 ec 04             	sub    $0x4,%esp
+  803118:	6a 07                	push   $0x7
+  80311a:	68 00 10 01 e0       	push   $0xe0011000
+  80311f:	6a 00                	push   $0x0
+  803121:	e8 0d e0 ff ff       	call   801133 <sys_page_alloc>
+  803126:	89 c7                	mov    %eax,%edi
+  803128:	83 c4 10             	add    $0x10,%esp
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	78 2b                	js     80315a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80312f:	c7 05 28 7f 80 00 01 	movl   $0x1,0x807f28
+  803136:	00 00 00 
+  803139:	e9 0f ff ff ff       	jmp    80304d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80313e:	83 ec 0c             	sub    $0xc,%esp
+  803141:	6a 03                	push   $0x3
+  803143:	e8 df 1b 00 00       	call   804d27 <ipc_find_env>
+  803148:	a3 24 7f 80 00       	mov    %eax,0x807f24
+  80314d:	83 c4 10             	add    $0x10,%esp
+  803150:	e9 05 ff ff ff       	jmp    80305a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803155:	85 ff                	test   %edi,%edi
+  803157:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80315a:	89 f8                	mov    %edi,%eax
+  80315c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80315f:	5b                   	pop    %ebx
+  803160:	5e                   	pop    %esi
+  803161:	5f                   	pop    %edi
+  803162:	5d                   	pop    %ebp
+  803163:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803164:	85 ff                	test   %edi,%edi
+  803166:	0f 44 f8             	cmove  %eax,%edi
+  803169:	eb ef                	jmp    80315a <nsipc_sendfile+0x123>
+
+0080316b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80316b:	55                   	push   %ebp
+  80316c:	89 e5                	mov    %esp,%ebp
+  80316e:	57                   	push   %edi
+  80316f:	56                   	push   %esi
+  803170:	53                   	push   %ebx
+  803171:	83 ec 1c             	sub    $0x1c,%esp
+  803174:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803177:	e8 13 f9 ff ff       	call   802a8f <nsbulk_map>
+  80317c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80317f:	85 c0                	test   %eax,%eax
+  803181:	0f 88 ba 00 00 00    	js     803241 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803187:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80318b:	0f 8e bb 00 00 00    	jle    80324c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803191:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803196:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80319b:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8031a0:	89 f8                	mov    %edi,%eax
+  8031a2:	29 f0                	sub    %esi,%eax
+  8031a4:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8031a8:	39 c8                	cmp    %ecx,%eax
+  8031aa:	0f 47 c1             	cmova  %ecx,%eax
+  8031ad:	01 f0                	add    %esi,%eax
+  8031af:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8031b1:	83 c2 01             	add    $0x1,%edx
+  8031b4:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8031b7:	7e 07                	jle    8031c0 <nsipc_recvmsg+0x55>
+  8031b9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8031be:	7e e0                	jle    8031a0 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8031c0:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8031c6:	c1 fa 0c             	sar    $0xc,%edx
+  8031c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ce:	e8 0a f9 ff ff       	call   802add <nsbulk_own>
+  8031d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8031d6:	85 c0                	test   %eax,%eax
+  8031d8:	78 67                	js     803241 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8031da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031dd:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8031e2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8031e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031eb:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8031f0:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8031f5:	89 f2                	mov    %esi,%edx
+  8031f7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8031fc:	e8 44 f9 ff ff       	call   802b45 <nsipc_bulk>
+  803201:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803204:	85 c0                	test   %eax,%eax
+  803206:	78 39                	js     803241 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803208:	39 f0                	cmp    %esi,%eax
+  80320a:	7f 4a                	jg     803256 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80320c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803211:	85 c0                	test   %eax,%eax
+  803213:	7e 2c                	jle    803241 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803215:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803218:	29 fe                	sub    %edi,%esi
+  80321a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80321d:	39 c6                	cmp    %eax,%esi
+  80321f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803222:	83 ec 04             	sub    $0x4,%esp
+  803225:	56                   	push   %esi
+  803226:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80322c:	50                   	push   %eax
+  80322d:	ff 33                	push   (%ebx)
+  80322f:	e8 7b dc ff ff       	call   800eaf <memmove>
+		n += m;
+  803234:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803236:	83 c3 08             	add    $0x8,%ebx
+  803239:	83 c4 10             	add    $0x10,%esp
+  80323c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80323f:	7f d4                	jg     803215 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803241:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803247:	5b                   	pop    %ebx
+  803248:	5e                   	pop    %esi
+  803249:	5f                   	pop    %edi
+  80324a:	5d                   	pop    %ebp
+  80324b:	c3                   	ret
+	int r, i, n, len = 0;
+  80324c:	be 00 00 00 00       	mov    $0x0,%esi
+  803251:	e9 6a ff ff ff       	jmp    8031c0 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803256:	68 38 59 80 00       	push   $0x805938
+  80325b:	68 41 59 80 00       	push   $0x805941
+  803260:	68 3b 01 00 00       	push   $0x13b
+  803265:	68 56 59 80 00       	push   $0x805956
+  80326a:	e8 be d2 ff ff       	call   80052d <_panic>
+
+0080326f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80326f:	55                   	push   %ebp
+  803270:	89 e5                	mov    %esp,%ebp
+  803272:	57                   	push   %edi
+  803273:	56                   	push   %esi
+  803274:	53                   	push   %ebx
+  803275:	83 ec 0c             	sub    $0xc,%esp
+  803278:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80327b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80327e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803281:	8b 45 08             	mov    0x8(%ebp),%eax
+  803284:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  803289:	8b 07                	mov    (%edi),%eax
+  80328b:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  803290:	8b 47 04             	mov    0x4(%edi),%eax
+  803293:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  803298:	8b 47 08             	mov    0x8(%edi),%eax
+  80329b:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  8032a0:	8b 47 0c             	mov    0xc(%edi),%eax
+  8032a3:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  8032a8:	8b 47 10             	mov    0x10(%edi),%eax
+  8032ab:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  8032b0:	8b 47 14             	mov    0x14(%edi),%eax
+  8032b3:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  8032b8:	8b 47 18             	mov    0x18(%edi),%eax
+  8032bb:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  8032c0:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8032c3:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  8032c8:	8b 47 20             	mov    0x20(%edi),%eax
+  8032cb:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  8032d0:	8b 47 24             	mov    0x24(%edi),%eax
+  8032d3:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  8032d8:	8b 47 28             	mov    0x28(%edi),%eax
+  8032db:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  8032e0:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8032e3:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  8032e8:	8b 47 30             	mov    0x30(%edi),%eax
+  8032eb:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  8032f0:	8b 47 34             	mov    0x34(%edi),%eax
+  8032f3:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  8032f8:	8b 47 38             	mov    0x38(%edi),%eax
+  8032fb:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  803300:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803303:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803308:	8b 06                	mov    (%esi),%eax
+  80330a:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  80330f:	8b 46 04             	mov    0x4(%esi),%eax
+  803312:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  803317:	8b 46 08             	mov    0x8(%esi),%eax
+  80331a:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  80331f:	8b 46 0c             	mov    0xc(%esi),%eax
+  803322:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  803327:	8b 46 10             	mov    0x10(%esi),%eax
+  80332a:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  80332f:	8b 46 14             	mov    0x14(%esi),%eax
+  803332:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  803337:	8b 46 18             	mov    0x18(%esi),%eax
+  80333a:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  80333f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803342:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  803347:	8b 46 20             	mov    0x20(%esi),%eax
+  80334a:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  80334f:	8b 46 24             	mov    0x24(%esi),%eax
+  803352:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  803357:	8b 46 28             	mov    0x28(%esi),%eax
+  80335a:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  80335f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803362:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  803367:	8b 46 30             	mov    0x30(%esi),%eax
+  80336a:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  80336f:	8b 46 34             	mov    0x34(%esi),%eax
+  803372:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  803377:	8b 46 38             	mov    0x38(%esi),%eax
+  80337a:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  80337f:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803382:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803387:	8b 03                	mov    (%ebx),%eax
+  803389:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  80338e:	8b 43 04             	mov    0x4(%ebx),%eax
+  803391:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  803396:	8b 43 08             	mov    0x8(%ebx),%eax
+  803399:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  80339e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8033a1:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  8033a6:	8b 43 10             	mov    0x10(%ebx),%eax
+  8033a9:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  8033ae:	8b 43 14             	mov    0x14(%ebx),%eax
+  8033b1:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  8033b6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8033b9:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  8033be:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8033c1:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  8033c6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8033c9:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  8033ce:	8b 43 24             	mov    0x24(%ebx),%eax
+  8033d1:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  8033d6:	8b 43 28             	mov    0x28(%ebx),%eax
+  8033d9:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  8033de:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8033e1:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  8033e6:	8b 43 30             	mov    0x30(%ebx),%eax
+  8033e9:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  8033ee:	8b 43 34             	mov    0x34(%ebx),%eax
+  8033f1:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  8033f6:	8b 43 38             	mov    0x38(%ebx),%eax
+  8033f9:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  8033fe:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803401:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803406:	8b 45 18             	mov    0x18(%ebp),%eax
+  803409:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  80340e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803413:	e8 2b f6 ff ff       	call   802a43 <nsipc>
+  803418:	85 c0                	test   %eax,%eax
+  80341a:	0f 88 ad 01 00 00    	js     8035cd <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803420:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803426:	89 17                	mov    %edx,(%edi)
+  803428:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  80342e:	89 57 04             	mov    %edx,0x4(%edi)
+  803431:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  803437:	89 57 08             	mov    %edx,0x8(%edi)
+  80343a:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803440:	89 57 0c             	mov    %edx,0xc(%edi)
+  803443:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  803449:	89 57 10             	mov    %edx,0x10(%edi)
+  80344c:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  803452:	89 57 14             	mov    %edx,0x14(%edi)
+  803455:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  80345b:	89 57 18             	mov    %edx,0x18(%edi)
+  80345e:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  803464:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803467:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  80346d:	89 57 20             	mov    %edx,0x20(%edi)
+  803470:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  803476:	89 57 24             	mov    %edx,0x24(%edi)
+  803479:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  80347f:	89 57 28             	mov    %edx,0x28(%edi)
+  803482:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  803488:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80348b:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  803491:	89 57 30             	mov    %edx,0x30(%edi)
+  803494:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  80349a:	89 57 34             	mov    %edx,0x34(%edi)
+  80349d:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  8034a3:	89 57 38             	mov    %edx,0x38(%edi)
+  8034a6:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  8034ac:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8034af:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  8034b5:	89 16                	mov    %edx,(%esi)
+  8034b7:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  8034bd:	89 56 04             	mov    %edx,0x4(%esi)
+  8034c0:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  8034c6:	89 56 08             	mov    %edx,0x8(%esi)
+  8034c9:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  8034cf:	89 56 0c             	mov    %edx,0xc(%esi)
+  8034d2:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  8034d8:	89 56 10             	mov    %edx,0x10(%esi)
+  8034db:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  8034e1:	89 56 14             	mov    %edx,0x14(%esi)
+  8034e4:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  8034ea:	89 56 18             	mov    %edx,0x18(%esi)
+  8034ed:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  8034f3:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8034f6:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  8034fc:	89 56 20             	mov    %edx,0x20(%esi)
+  8034ff:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  803505:	89 56 24             	mov    %edx,0x24(%esi)
+  803508:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  80350e:	89 56 28             	mov    %edx,0x28(%esi)
+  803511:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  803517:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80351a:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  803520:	89 56 30             	mov    %edx,0x30(%esi)
+  803523:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  803529:	89 56 34             	mov    %edx,0x34(%esi)
+  80352c:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  803532:	89 56 38             	mov    %edx,0x38(%esi)
+  803535:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  80353b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  80353e:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  803544:	89 13                	mov    %edx,(%ebx)
+  803546:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  80354c:	89 53 04             	mov    %edx,0x4(%ebx)
+  80354f:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  803555:	89 53 08             	mov    %edx,0x8(%ebx)
+  803558:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  80355e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803561:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  803567:	89 53 10             	mov    %edx,0x10(%ebx)
+  80356a:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  803570:	89 53 14             	mov    %edx,0x14(%ebx)
+  803573:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  803579:	89 53 18             	mov    %edx,0x18(%ebx)
+  80357c:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  803582:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803585:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  80358b:	89 53 20             	mov    %edx,0x20(%ebx)
+  80358e:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  803594:	89 53 24             	mov    %edx,0x24(%ebx)
+  803597:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  80359d:	89 53 28             	mov    %edx,0x28(%ebx)
+  8035a0:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  8035a6:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8035a9:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  8035af:	89 53 30             	mov    %edx,0x30(%ebx)
+  8035b2:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  8035b8:	89 53 34             	mov    %edx,0x34(%ebx)
+  8035bb:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  8035c1:	89 53 38             	mov    %edx,0x38(%ebx)
+  8035c4:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  8035ca:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  8035cd:	83 c4 0c             	add    $0xc,%esp
+  8035d0:	5b                   	pop    %ebx
+  8035d1:	5e                   	pop    %esi
+  8035d2:	5f                   	pop    %edi
+  8035d3:	5d                   	pop    %ebp
+  8035d4:	c3                   	ret
+
+008035d5 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  8035d5:	55                   	push   %ebp
+  8035d6:	89 e5                	mov    %esp,%ebp
+  8035d8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  8035db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035de:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  8035e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035e6:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  8035eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035ee:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  8035f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8035f8:	e8 46 f4 ff ff       	call   802a43 <nsipc>
+}
+  8035fd:	c9                   	leave
+  8035fe:	c3                   	ret
+
+008035ff <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  8035ff:	55                   	push   %ebp
+  803600:	89 e5                	mov    %esp,%ebp
+  803602:	56                   	push   %esi
+  803603:	53                   	push   %ebx
+  803604:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803607:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  80360d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803610:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803615:	b8 10 00 00 00       	mov    $0x10,%eax
+  80361a:	e8 24 f4 ff ff       	call   802a43 <nsipc>
+  80361f:	89 c3                	mov    %eax,%ebx
+  803621:	85 c0                	test   %eax,%eax
+  803623:	7e 1f                	jle    803644 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803625:	39 c6                	cmp    %eax,%esi
+  803627:	7c 24                	jl     80364d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803629:	83 ec 04             	sub    $0x4,%esp
+  80362c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803633:	50                   	push   %eax
+  803634:	68 00 a0 80 00       	push   $0x80a000
+  803639:	ff 75 08             	push   0x8(%ebp)
+  80363c:	e8 6e d8 ff ff       	call   800eaf <memmove>
+  803641:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803644:	89 d8                	mov    %ebx,%eax
+  803646:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803649:	5b                   	pop    %ebx
+  80364a:	5e                   	pop    %esi
+  80364b:	5d                   	pop    %ebp
+  80364c:	c3                   	ret
+		assert(r <= max);
+  80364d:	68 6e 59 80 00       	push   $0x80596e
+  803652:	68 41 59 80 00       	push   $0x805941
+  803657:	68 6a 01 00 00       	push   $0x16a
+  80365c:	68 56 59 80 00       	push   $0x805956
+  803661:	e8 c7 ce ff ff       	call   80052d <_panic>
+
+00803666 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803666:	55                   	push   %ebp
+  803667:	89 e5                	mov    %esp,%ebp
+  803669:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  80366c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80366f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  803674:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803677:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  80367c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80367f:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  803684:	b8 09 00 00 00       	mov    $0x9,%eax
+  803689:	e8 b5 f3 ff ff       	call   802a43 <nsipc>
+}
+  80368e:	c9                   	leave
+  80368f:	c3                   	ret
+
+00803690 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803690:	55                   	push   %ebp
+  803691:	89 e5                	mov    %esp,%ebp
+  803693:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803696:	8b 45 08             	mov    0x8(%ebp),%eax
+  803699:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  80369e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8036a3:	e8 9b f3 ff ff       	call   802a43 <nsipc>
+}
+  8036a8:	c9                   	leave
+  8036a9:	c3                   	ret
+
+008036aa <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8036aa:	55                   	push   %ebp
+  8036ab:	89 e5                	mov    %esp,%ebp
+  8036ad:	53                   	push   %ebx
+  8036ae:	83 ec 04             	sub    $0x4,%esp
+  8036b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8036b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8036b9:	e8 85 f3 ff ff       	call   802a43 <nsipc>
+  8036be:	85 c0                	test   %eax,%eax
+  8036c0:	78 50                	js     803712 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  8036c2:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  8036c8:	89 13                	mov    %edx,(%ebx)
+  8036ca:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  8036d0:	89 53 04             	mov    %edx,0x4(%ebx)
+  8036d3:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  8036d9:	89 53 08             	mov    %edx,0x8(%ebx)
+  8036dc:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  8036e2:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8036e5:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  8036eb:	89 53 10             	mov    %edx,0x10(%ebx)
+  8036ee:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  8036f4:	89 53 14             	mov    %edx,0x14(%ebx)
+  8036f7:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  8036fd:	89 53 18             	mov    %edx,0x18(%ebx)
+  803700:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803706:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803709:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  80370f:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803712:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803715:	c9                   	leave
+  803716:	c3                   	ret
+
+00803717 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803717:	55                   	push   %ebp
+  803718:	89 e5                	mov    %esp,%ebp
+  80371a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  80371d:	6a 03                	push   $0x3
+  80371f:	e8 03 16 00 00       	call   804d27 <ipc_find_env>
+  803724:	a3 24 7f 80 00       	mov    %eax,0x807f24
+	nsipcbuf.shard.req_shard = shard;
+  803729:	8b 45 08             	mov    0x8(%ebp),%eax
+  80372c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803731:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803736:	e8 08 f3 ff ff       	call   802a43 <nsipc>
+  80373b:	83 c4 10             	add    $0x10,%esp
+  80373e:	85 c0                	test   %eax,%eax
+  803740:	78 0a                	js     80374c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803742:	a3 24 7f 80 00       	mov    %eax,0x807f24
+	return 0;
+  803747:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80374c:	c9                   	leave
+  80374d:	c3                   	ret
+
+0080374e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  80374e:	55                   	push   %ebp
+  80374f:	89 e5                	mov    %esp,%ebp
+  803751:	57                   	push   %edi
+  803752:	56                   	push   %esi
+  803753:	53                   	push   %ebx
+  803754:	83 ec 1c             	sub    $0x1c,%esp
+  803757:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80375a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80375d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803762:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803767:	89 e0                	mov    %esp,%eax
+  803769:	89 f2                	mov    %esi,%edx
+  80376b:	29 c2                	sub    %eax,%edx
+  80376d:	89 d0                	mov    %edx,%eax
+  80376f:	c1 e8 0f             	shr    $0xf,%eax
+  803772:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803778:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  80377b:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  803782:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803785:	83 ec 0c             	sub    $0xc,%esp
+  803788:	ff 75 e0             	push   -0x20(%ebp)
+  80378b:	e8 d6 15 00 00       	call   804d66 <pageref>
+  803790:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803793:	83 c4 04             	add    $0x4,%esp
+  803796:	ff 75 dc             	push   -0x24(%ebp)
+  803799:	e8 c8 15 00 00       	call   804d66 <pageref>
+  80379e:	89 e2                	mov    %esp,%edx
+  8037a0:	89 f1                	mov    %esi,%ecx
+  8037a2:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  8037a4:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8037a7:	89 ca                	mov    %ecx,%edx
+  8037a9:	c1 ea 0f             	shr    $0xf,%edx
+  8037ac:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  8037b2:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  8037b5:	8b 14 95 60 8f 80 00 	mov    0x808f60(,%edx,4),%edx
+  8037bc:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  8037bf:	39 d7                	cmp    %edx,%edi
+  8037c1:	74 40                	je     803803 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  8037c3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8037c6:	75 9f                	jne    803767 <_pipeisclosed+0x19>
+  8037c8:	89 e2                	mov    %esp,%edx
+  8037ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037cf:	29 d0                	sub    %edx,%eax
+  8037d1:	89 c2                	mov    %eax,%edx
+  8037d3:	c1 ea 0f             	shr    $0xf,%edx
+  8037d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e0:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8037e3:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  8037ea:	8b 40 58             	mov    0x58(%eax),%eax
+  8037ed:	6a 01                	push   $0x1
+  8037ef:	50                   	push   %eax
+  8037f0:	57                   	push   %edi
+  8037f1:	68 77 59 80 00       	push   $0x805977
+  8037f6:	e8 0d ce ff ff       	call   800608 <cprintf>
+  8037fb:	83 c4 10             	add    $0x10,%esp
+  8037fe:	e9 5f ff ff ff       	jmp    803762 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803803:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803806:	0f 94 c0             	sete   %al
+  803809:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  80380c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80380f:	5b                   	pop    %ebx
+  803810:	5e                   	pop    %esi
+  803811:	5f                   	pop    %edi
+  803812:	5d                   	pop    %ebp
+  803813:	c3                   	ret
+
+00803814 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803814:	55                   	push   %ebp
+  803815:	89 e5                	mov    %esp,%ebp
+  803817:	53                   	push   %ebx
+  803818:	83 ec 0c             	sub    $0xc,%esp
+  80381b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80381e:	53                   	push   %ebx
+  80381f:	6a 00                	push   $0x0
+  803821:	e8 92 d9 ff ff       	call   8011b8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803826:	89 1c 24             	mov    %ebx,(%esp)
+  803829:	e8 f4 e4 ff ff       	call   801d22 <fd2data>
+  80382e:	83 c4 08             	add    $0x8,%esp
+  803831:	50                   	push   %eax
+  803832:	6a 00                	push   $0x0
+  803834:	e8 7f d9 ff ff       	call   8011b8 <sys_page_unmap>
+}
+  803839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80383c:	c9                   	leave
+  80383d:	c3                   	ret
+
+0080383e <devpipe_read>:
+{
+  80383e:	55                   	push   %ebp
+  80383f:	89 e5                	mov    %esp,%ebp
+  803841:	57                   	push   %edi
+  803842:	56                   	push   %esi
+  803843:	53                   	push   %ebx
+  803844:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803847:	ff 75 08             	push   0x8(%ebp)
+  80384a:	e8 d3 e4 ff ff       	call   801d22 <fd2data>
+  80384f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803851:	8b 70 04             	mov    0x4(%eax),%esi
+  803854:	8b 00                	mov    (%eax),%eax
+  803856:	83 c4 10             	add    $0x10,%esp
+  803859:	39 f0                	cmp    %esi,%eax
+  80385b:	75 36                	jne    803893 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  80385d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803860:	89 da                	mov    %ebx,%edx
+  803862:	8b 45 08             	mov    0x8(%ebp),%eax
+  803865:	e8 e4 fe ff ff       	call   80374e <_pipeisclosed>
+  80386a:	85 c0                	test   %eax,%eax
+  80386c:	0f 85 d4 00 00 00    	jne    803946 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803872:	b8 01 00 00 00       	mov    $0x1,%eax
+  803877:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  80387b:	83 ec 04             	sub    $0x4,%esp
+  80387e:	6a ff                	push   $0xffffffff
+  803880:	56                   	push   %esi
+  803881:	57                   	push   %edi
+  803882:	e8 aa dc ff ff       	call   801531 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803887:	8b 73 04             	mov    0x4(%ebx),%esi
+  80388a:	8b 03                	mov    (%ebx),%eax
+  80388c:	83 c4 10             	add    $0x10,%esp
+  80388f:	39 c6                	cmp    %eax,%esi
+  803891:	74 cd                	je     803860 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803893:	8b 73 04             	mov    0x4(%ebx),%esi
+  803896:	8b 03                	mov    (%ebx),%eax
+  803898:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80389e:	29 c6                	sub    %eax,%esi
+  8038a0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038a5:	f7 e6                	mul    %esi
+  8038a7:	c1 ea 0c             	shr    $0xc,%edx
+  8038aa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8038b0:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  8038b2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8038b5:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8038b9:	8b 0b                	mov    (%ebx),%ecx
+  8038bb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038c0:	f7 e1                	mul    %ecx
+  8038c2:	c1 ea 0b             	shr    $0xb,%edx
+  8038c5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8038cb:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  8038cd:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8038d2:	29 cf                	sub    %ecx,%edi
+  8038d4:	39 f7                	cmp    %esi,%edi
+  8038d6:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  8038d9:	83 ec 04             	sub    $0x4,%esp
+  8038dc:	57                   	push   %edi
+  8038dd:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  8038e1:	50                   	push   %eax
+  8038e2:	ff 75 0c             	push   0xc(%ebp)
+  8038e5:	e8 c5 d5 ff ff       	call   800eaf <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  8038ea:	83 c4 0c             	add    $0xc,%esp
+  8038ed:	89 f0                	mov    %esi,%eax
+  8038ef:	29 f8                	sub    %edi,%eax
+  8038f1:	50                   	push   %eax
+  8038f2:	8d 43 10             	lea    0x10(%ebx),%eax
+  8038f5:	50                   	push   %eax
+  8038f6:	89 f8                	mov    %edi,%eax
+  8038f8:	03 45 0c             	add    0xc(%ebp),%eax
+  8038fb:	50                   	push   %eax
+  8038fc:	e8 ae d5 ff ff       	call   800eaf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803901:	8b 0b                	mov    (%ebx),%ecx
+  803903:	01 f1                	add    %esi,%ecx
+  803905:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80390a:	f7 e1                	mul    %ecx
+  80390c:	c1 ea 0c             	shr    $0xc,%edx
+  80390f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803915:	29 c1                	sub    %eax,%ecx
+  803917:	89 0b                	mov    %ecx,(%ebx)
+  803919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391e:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803922:	83 c4 10             	add    $0x10,%esp
+  803925:	85 c0                	test   %eax,%eax
+  803927:	75 0a                	jne    803933 <devpipe_read+0xf5>
+	return n;
+  803929:	89 f0                	mov    %esi,%eax
+}
+  80392b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80392e:	5b                   	pop    %ebx
+  80392f:	5e                   	pop    %esi
+  803930:	5f                   	pop    %edi
+  803931:	5d                   	pop    %ebp
+  803932:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803933:	83 ec 08             	sub    $0x8,%esp
+  803936:	68 00 04 00 00       	push   $0x400
+  80393b:	53                   	push   %ebx
+  80393c:	e8 12 dc ff ff       	call   801553 <sys_futex_wake>
+  803941:	83 c4 10             	add    $0x10,%esp
+  803944:	eb e3                	jmp    803929 <devpipe_read+0xeb>
+			return 0;
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	eb de                	jmp    80392b <devpipe_read+0xed>
+
+0080394d <devpipe_write>:
+{
+  80394d:	55                   	push   %ebp
+  80394e:	89 e5                	mov    %esp,%ebp
+  803950:	57                   	push   %edi
+  803951:	56                   	push   %esi
+  803952:	53                   	push   %ebx
+  803953:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803956:	ff 75 08             	push   0x8(%ebp)
+  803959:	e8 c4 e3 ff ff       	call   801d22 <fd2data>
+  80395e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803960:	83 c4 10             	add    $0x10,%esp
+  803963:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80396a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  80396f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803973:	0f 84 43 01 00 00    	je     803abc <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803979:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80397c:	8b 06                	mov    (%esi),%eax
+  80397e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803984:	29 c1                	sub    %eax,%ecx
+  803986:	89 c8                	mov    %ecx,%eax
+  803988:	f7 e7                	mul    %edi
+  80398a:	c1 ea 0c             	shr    $0xc,%edx
+  80398d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803993:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803995:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80399b:	75 52                	jne    8039ef <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  80399d:	89 f2                	mov    %esi,%edx
+  80399f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039a2:	e8 a7 fd ff ff       	call   80374e <_pipeisclosed>
+  8039a7:	85 c0                	test   %eax,%eax
+  8039a9:	0f 85 28 01 00 00    	jne    803ad7 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  8039af:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039b1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039b4:	8b 06                	mov    (%esi),%eax
+  8039b6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039bc:	29 c1                	sub    %eax,%ecx
+  8039be:	89 c8                	mov    %ecx,%eax
+  8039c0:	f7 e7                	mul    %edi
+  8039c2:	c1 ea 0c             	shr    $0xc,%edx
+  8039c5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039cb:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8039cd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8039d3:	75 a4                	jne    803979 <devpipe_write+0x2c>
+  8039d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8039da:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8039de:	83 ec 04             	sub    $0x4,%esp
+  8039e1:	6a ff                	push   $0xffffffff
+  8039e3:	53                   	push   %ebx
+  8039e4:	56                   	push   %esi
+  8039e5:	e8 47 db ff ff       	call   801531 <sys_futex_wait>
+}
+  8039ea:	83 c4 10             	add    $0x10,%esp
+  8039ed:	eb 8a                	jmp    803979 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8039ef:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8039f2:	8b 06                	mov    (%esi),%eax
+  8039f4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8039fa:	29 c1                	sub    %eax,%ecx
+  8039fc:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a01:	f7 e1                	mul    %ecx
+  803a03:	c1 ea 0c             	shr    $0xc,%edx
+  803a06:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a0c:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803a0e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803a13:	89 d8                	mov    %ebx,%eax
+  803a15:	29 c8                	sub    %ecx,%eax
+  803a17:	8b 55 10             	mov    0x10(%ebp),%edx
+  803a1a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a1d:	29 ca                	sub    %ecx,%edx
+  803a1f:	39 d0                	cmp    %edx,%eax
+  803a21:	0f 46 d0             	cmovbe %eax,%edx
+  803a24:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803a27:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a2a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a2f:	f7 e1                	mul    %ecx
+  803a31:	c1 ea 0b             	shr    $0xb,%edx
+  803a34:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803a3a:	89 ca                	mov    %ecx,%edx
+  803a3c:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803a3e:	29 d3                	sub    %edx,%ebx
+  803a40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a43:	39 c3                	cmp    %eax,%ebx
+  803a45:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803a48:	83 ec 04             	sub    $0x4,%esp
+  803a4b:	53                   	push   %ebx
+  803a4c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a4f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803a52:	51                   	push   %ecx
+  803a53:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803a57:	50                   	push   %eax
+  803a58:	e8 52 d4 ff ff       	call   800eaf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803a5d:	83 c4 0c             	add    $0xc,%esp
+  803a60:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a63:	29 d8                	sub    %ebx,%eax
+  803a65:	50                   	push   %eax
+  803a66:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803a69:	01 cb                	add    %ecx,%ebx
+  803a6b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803a6e:	53                   	push   %ebx
+  803a6f:	8d 46 10             	lea    0x10(%esi),%eax
+  803a72:	50                   	push   %eax
+  803a73:	e8 37 d4 ff ff       	call   800eaf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803a78:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803a7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803a7e:	01 c1                	add    %eax,%ecx
+  803a80:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803a85:	f7 e1                	mul    %ecx
+  803a87:	c1 ea 0c             	shr    $0xc,%edx
+  803a8a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803a90:	89 ca                	mov    %ecx,%edx
+  803a92:	29 c2                	sub    %eax,%edx
+  803a94:	89 56 04             	mov    %edx,0x4(%esi)
+  803a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9c:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803aa0:	83 c4 10             	add    $0x10,%esp
+  803aa3:	85 c0                	test   %eax,%eax
+  803aa5:	75 1a                	jne    803ac1 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803aa7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803aaa:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803aad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ab0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803ab3:	0f 82 c0 fe ff ff    	jb     803979 <devpipe_write+0x2c>
+  803ab9:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803abc:	8b 45 10             	mov    0x10(%ebp),%eax
+  803abf:	eb 1b                	jmp    803adc <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803ac1:	83 ec 08             	sub    $0x8,%esp
+  803ac4:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803ac9:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803acc:	50                   	push   %eax
+  803acd:	e8 81 da ff ff       	call   801553 <sys_futex_wake>
+  803ad2:	83 c4 10             	add    $0x10,%esp
+  803ad5:	eb d0                	jmp    803aa7 <devpipe_write+0x15a>
+				return 0;
+  803ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803adc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803adf:	5b                   	pop    %ebx
+  803ae0:	5e                   	pop    %esi
+  803ae1:	5f                   	pop    %edi
+  803ae2:	5d                   	pop    %ebp
+  803ae3:	c3                   	ret
+
+00803ae4 <devpipe_stat>:
+{
+  803ae4:	55                   	push   %ebp
+  803ae5:	89 e5                	mov    %esp,%ebp
+  803ae7:	56                   	push   %esi
+  803ae8:	53                   	push   %ebx
+  803ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803aec:	83 ec 0c             	sub    $0xc,%esp
+  803aef:	ff 75 08             	push   0x8(%ebp)
+  803af2:	e8 2b e2 ff ff       	call   801d22 <fd2data>
+  803af7:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803af9:	83 c4 08             	add    $0x8,%esp
+  803afc:	68 8a 59 80 00       	push   $0x80598a
+  803b01:	53                   	push   %ebx
+  803b02:	e8 f8 d1 ff ff       	call   800cff <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b07:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803b0a:	8b 06                	mov    (%esi),%eax
+  803b0c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803b12:	29 c1                	sub    %eax,%ecx
+  803b14:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803b19:	89 c8                	mov    %ecx,%eax
+  803b1b:	f7 e2                	mul    %edx
+  803b1d:	c1 ea 0c             	shr    $0xc,%edx
+  803b20:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803b26:	29 d1                	sub    %edx,%ecx
+  803b28:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803b2e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803b35:	00 00 00 
+	stat->st_dev = &devpipe;
+  803b38:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  803b3f:	60 80 00 
+}
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803b4a:	5b                   	pop    %ebx
+  803b4b:	5e                   	pop    %esi
+  803b4c:	5d                   	pop    %ebp
+  803b4d:	c3                   	ret
+
+00803b4e <devpipe_poll>:
+{
+  803b4e:	55                   	push   %ebp
+  803b4f:	89 e5                	mov    %esp,%ebp
+  803b51:	57                   	push   %edi
+  803b52:	56                   	push   %esi
+  803b53:	53                   	push   %ebx
+  803b54:	83 ec 18             	sub    $0x18,%esp
+  803b57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b5a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803b5d:	57                   	push   %edi
+  803b5e:	e8 bf e1 ff ff       	call   801d22 <fd2data>
+  803b63:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803b65:	83 c4 10             	add    $0x10,%esp
+  803b68:	89 f3                	mov    %esi,%ebx
+  803b6a:	83 e3 01             	and    $0x1,%ebx
+  803b6d:	75 27                	jne    803b96 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803b6f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803b75:	75 48                	jne    803bbf <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803b77:	89 ca                	mov    %ecx,%edx
+  803b79:	89 f8                	mov    %edi,%eax
+  803b7b:	e8 ce fb ff ff       	call   80374e <_pipeisclosed>
+  803b80:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803b82:	89 d8                	mov    %ebx,%eax
+  803b84:	83 c8 10             	or     $0x10,%eax
+  803b87:	85 d2                	test   %edx,%edx
+  803b89:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803b8c:	89 d8                	mov    %ebx,%eax
+  803b8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b91:	5b                   	pop    %ebx
+  803b92:	5e                   	pop    %esi
+  803b93:	5f                   	pop    %edi
+  803b94:	5d                   	pop    %ebp
+  803b95:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803b96:	8b 58 04             	mov    0x4(%eax),%ebx
+  803b99:	8b 00                	mov    (%eax),%eax
+  803b9b:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803ba1:	29 c3                	sub    %eax,%ebx
+  803ba3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803ba8:	89 d8                	mov    %ebx,%eax
+  803baa:	f7 e2                	mul    %edx
+  803bac:	c1 ea 0c             	shr    $0xc,%edx
+  803baf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803bb5:	39 d3                	cmp    %edx,%ebx
+  803bb7:	0f 95 c3             	setne  %bl
+  803bba:	0f b6 db             	movzbl %bl,%ebx
+  803bbd:	eb b0                	jmp    803b6f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bbf:	8b 71 04             	mov    0x4(%ecx),%esi
+  803bc2:	8b 01                	mov    (%ecx),%eax
+  803bc4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803bca:	29 c6                	sub    %eax,%esi
+  803bcc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803bd1:	89 f0                	mov    %esi,%eax
+  803bd3:	f7 e2                	mul    %edx
+  803bd5:	c1 ea 0c             	shr    $0xc,%edx
+  803bd8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803bde:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803be0:	89 d8                	mov    %ebx,%eax
+  803be2:	83 c8 04             	or     $0x4,%eax
+  803be5:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803beb:	0f 42 d8             	cmovb  %eax,%ebx
+  803bee:	eb 87                	jmp    803b77 <devpipe_poll+0x29>
+
+00803bf0 <pipe>:
+{
+  803bf0:	55                   	push   %ebp
+  803bf1:	89 e5                	mov    %esp,%ebp
+  803bf3:	56                   	push   %esi
+  803bf4:	53                   	push   %ebx
+  803bf5:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803bf8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bfb:	50                   	push   %eax
+  803bfc:	e8 38 e1 ff ff       	call   801d39 <fd_alloc>
+  803c01:	89 c3                	mov    %eax,%ebx
+  803c03:	83 c4 10             	add    $0x10,%esp
+  803c06:	85 c0                	test   %eax,%eax
+  803c08:	0f 88 23 01 00 00    	js     803d31 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c0e:	83 ec 04             	sub    $0x4,%esp
+  803c11:	68 07 04 00 00       	push   $0x407
+  803c16:	ff 75 f4             	push   -0xc(%ebp)
+  803c19:	6a 00                	push   $0x0
+  803c1b:	e8 13 d5 ff ff       	call   801133 <sys_page_alloc>
+  803c20:	89 c3                	mov    %eax,%ebx
+  803c22:	83 c4 10             	add    $0x10,%esp
+  803c25:	85 c0                	test   %eax,%eax
+  803c27:	0f 88 04 01 00 00    	js     803d31 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803c2d:	83 ec 0c             	sub    $0xc,%esp
+  803c30:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803c33:	50                   	push   %eax
+  803c34:	e8 00 e1 ff ff       	call   801d39 <fd_alloc>
+  803c39:	89 c3                	mov    %eax,%ebx
+  803c3b:	83 c4 10             	add    $0x10,%esp
+  803c3e:	85 c0                	test   %eax,%eax
+  803c40:	0f 88 db 00 00 00    	js     803d21 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c46:	83 ec 04             	sub    $0x4,%esp
+  803c49:	68 07 04 00 00       	push   $0x407
+  803c4e:	ff 75 f0             	push   -0x10(%ebp)
+  803c51:	6a 00                	push   $0x0
+  803c53:	e8 db d4 ff ff       	call   801133 <sys_page_alloc>
+  803c58:	89 c3                	mov    %eax,%ebx
+  803c5a:	83 c4 10             	add    $0x10,%esp
+  803c5d:	85 c0                	test   %eax,%eax
+  803c5f:	0f 88 bc 00 00 00    	js     803d21 <pipe+0x131>
+	va = fd2data(fd0);
+  803c65:	83 ec 0c             	sub    $0xc,%esp
+  803c68:	ff 75 f4             	push   -0xc(%ebp)
+  803c6b:	e8 b2 e0 ff ff       	call   801d22 <fd2data>
+  803c70:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c72:	83 c4 0c             	add    $0xc,%esp
+  803c75:	68 07 04 00 00       	push   $0x407
+  803c7a:	50                   	push   %eax
+  803c7b:	6a 00                	push   $0x0
+  803c7d:	e8 b1 d4 ff ff       	call   801133 <sys_page_alloc>
+  803c82:	89 c3                	mov    %eax,%ebx
+  803c84:	83 c4 10             	add    $0x10,%esp
+  803c87:	85 c0                	test   %eax,%eax
+  803c89:	0f 88 82 00 00 00    	js     803d11 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803c8f:	83 ec 0c             	sub    $0xc,%esp
+  803c92:	ff 75 f0             	push   -0x10(%ebp)
+  803c95:	e8 88 e0 ff ff       	call   801d22 <fd2data>
+  803c9a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803ca1:	50                   	push   %eax
+  803ca2:	6a 00                	push   $0x0
+  803ca4:	56                   	push   %esi
+  803ca5:	6a 00                	push   $0x0
+  803ca7:	e8 ca d4 ff ff       	call   801176 <sys_page_map>
+  803cac:	89 c3                	mov    %eax,%ebx
+  803cae:	83 c4 20             	add    $0x20,%esp
+  803cb1:	85 c0                	test   %eax,%eax
+  803cb3:	78 4e                	js     803d03 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803cb5:	a1 60 60 80 00       	mov    0x806060,%eax
+  803cba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cbd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803cbf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803cc2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803cc9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803ccc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803cce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803cd1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803cd8:	83 ec 0c             	sub    $0xc,%esp
+  803cdb:	ff 75 f4             	push   -0xc(%ebp)
+  803cde:	e8 2f e0 ff ff       	call   801d12 <fd2num>
+  803ce3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803ce6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803ce8:	83 c4 04             	add    $0x4,%esp
+  803ceb:	ff 75 f0             	push   -0x10(%ebp)
+  803cee:	e8 1f e0 ff ff       	call   801d12 <fd2num>
+  803cf3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803cf6:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803cf9:	83 c4 10             	add    $0x10,%esp
+  803cfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d01:	eb 2e                	jmp    803d31 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803d03:	83 ec 08             	sub    $0x8,%esp
+  803d06:	56                   	push   %esi
+  803d07:	6a 00                	push   $0x0
+  803d09:	e8 aa d4 ff ff       	call   8011b8 <sys_page_unmap>
+  803d0e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803d11:	83 ec 08             	sub    $0x8,%esp
+  803d14:	ff 75 f0             	push   -0x10(%ebp)
+  803d17:	6a 00                	push   $0x0
+  803d19:	e8 9a d4 ff ff       	call   8011b8 <sys_page_unmap>
+  803d1e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803d21:	83 ec 08             	sub    $0x8,%esp
+  803d24:	ff 75 f4             	push   -0xc(%ebp)
+  803d27:	6a 00                	push   $0x0
+  803d29:	e8 8a d4 ff ff       	call   8011b8 <sys_page_unmap>
+  803d2e:	83 c4 10             	add    $0x10,%esp
+}
+  803d31:	89 d8                	mov    %ebx,%eax
+  803d33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d36:	5b                   	pop    %ebx
+  803d37:	5e                   	pop    %esi
+  803d38:	5d                   	pop    %ebp
+  803d39:	c3                   	ret
+
+00803d3a <pipeisclosed>:
+{
+  803d3a:	55                   	push   %ebp
+  803d3b:	89 e5                	mov    %esp,%ebp
+  803d3d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d43:	50                   	push   %eax
+  803d44:	ff 75 08             	push   0x8(%ebp)
+  803d47:	e8 3d e0 ff ff       	call   801d89 <fd_lookup>
+  803d4c:	83 c4 10             	add    $0x10,%esp
+  803d4f:	85 c0                	test   %eax,%eax
+  803d51:	78 18                	js     803d6b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803d53:	83 ec 0c             	sub    $0xc,%esp
+  803d56:	ff 75 f4             	push   -0xc(%ebp)
+  803d59:	e8 c4 df ff ff       	call   801d22 <fd2data>
+  803d5e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803d60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d63:	e8 e6 f9 ff ff       	call   80374e <_pipeisclosed>
+  803d68:	83 c4 10             	add    $0x10,%esp
+}
+  803d6b:	c9                   	leave
+  803d6c:	c3                   	ret
+
+00803d6d <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803d6d:	55                   	push   %ebp
+  803d6e:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d73:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803d79:	5d                   	pop    %ebp
+  803d7a:	c3                   	ret
+
+00803d7b <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803d7b:	55                   	push   %ebp
+  803d7c:	89 e5                	mov    %esp,%ebp
+  803d7e:	53                   	push   %ebx
+  803d7f:	83 ec 04             	sub    $0x4,%esp
+  803d82:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803d85:	8b 03                	mov    (%ebx),%eax
+  803d87:	85 c0                	test   %eax,%eax
+  803d89:	75 05                	jne    803d90 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803d8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d8e:	c9                   	leave
+  803d8f:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803d90:	83 ec 08             	sub    $0x8,%esp
+  803d93:	50                   	push   %eax
+  803d94:	8d 43 04             	lea    0x4(%ebx),%eax
+  803d97:	50                   	push   %eax
+  803d98:	e8 6b d6 ff ff       	call   801408 <sys_page_batch>
+	pb->pb_n = 0;
+  803d9d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803da3:	83 c4 10             	add    $0x10,%esp
+  803da6:	eb e3                	jmp    803d8b <pgbatch_flush+0x10>
+
+00803da8 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803da8:	55                   	push   %ebp
+  803da9:	89 e5                	mov    %esp,%ebp
+  803dab:	56                   	push   %esi
+  803dac:	53                   	push   %ebx
+  803dad:	89 c3                	mov    %eax,%ebx
+  803daf:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803db1:	83 38 20             	cmpl   $0x20,(%eax)
+  803db4:	74 2c                	je     803de2 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803db6:	8b 03                	mov    (%ebx),%eax
+  803db8:	8d 50 01             	lea    0x1(%eax),%edx
+  803dbb:	89 13                	mov    %edx,(%ebx)
+  803dbd:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803dc0:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803dc4:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803dc6:	83 ec 04             	sub    $0x4,%esp
+  803dc9:	6a 18                	push   $0x18
+  803dcb:	6a 00                	push   $0x0
+  803dcd:	50                   	push   %eax
+  803dce:	e8 a7 d0 ff ff       	call   800e7a <memset>
+	return 0;
+  803dd3:	83 c4 10             	add    $0x10,%esp
+  803dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ddb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dde:	5b                   	pop    %ebx
+  803ddf:	5e                   	pop    %esi
+  803de0:	5d                   	pop    %ebp
+  803de1:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803de2:	83 ec 0c             	sub    $0xc,%esp
+  803de5:	50                   	push   %eax
+  803de6:	e8 90 ff ff ff       	call   803d7b <pgbatch_flush>
+  803deb:	83 c4 10             	add    $0x10,%esp
+  803dee:	85 c0                	test   %eax,%eax
+  803df0:	79 c4                	jns    803db6 <pgbatch_slot+0xe>
+  803df2:	eb e7                	jmp    803ddb <pgbatch_slot+0x33>
+
+00803df4 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803df4:	55                   	push   %ebp
+  803df5:	89 e5                	mov    %esp,%ebp
+  803df7:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dfa:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e00:	e8 a3 ff ff ff       	call   803da8 <pgbatch_slot>
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	78 20                	js     803e29 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803e09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e0c:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803e12:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e15:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e18:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e1b:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e1e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e21:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e29:	c9                   	leave
+  803e2a:	c3                   	ret
+
+00803e2b <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803e2b:	55                   	push   %ebp
+  803e2c:	89 e5                	mov    %esp,%ebp
+  803e2e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e31:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e34:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e37:	e8 6c ff ff ff       	call   803da8 <pgbatch_slot>
+  803e3c:	85 c0                	test   %eax,%eax
+  803e3e:	78 2c                	js     803e6c <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803e40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e43:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803e49:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e4c:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803e4f:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e52:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803e55:	8b 55 14             	mov    0x14(%ebp),%edx
+  803e58:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803e5b:	8b 55 18             	mov    0x18(%ebp),%edx
+  803e5e:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803e61:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803e64:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803e67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e6c:	c9                   	leave
+  803e6d:	c3                   	ret
+
+00803e6e <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803e6e:	55                   	push   %ebp
+  803e6f:	89 e5                	mov    %esp,%ebp
+  803e71:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803e74:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803e77:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e7a:	e8 29 ff ff ff       	call   803da8 <pgbatch_slot>
+  803e7f:	85 c0                	test   %eax,%eax
+  803e81:	78 1a                	js     803e9d <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803e83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803e86:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803e8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803e8f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803e92:	8b 55 10             	mov    0x10(%ebp),%edx
+  803e95:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803e98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9d:	c9                   	leave
+  803e9e:	c3                   	ret
+
+00803e9f <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803e9f:	55                   	push   %ebp
+  803ea0:	89 e5                	mov    %esp,%ebp
+  803ea2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ea5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ea8:	8b 45 08             	mov    0x8(%ebp),%eax
+  803eab:	e8 f8 fe ff ff       	call   803da8 <pgbatch_slot>
+  803eb0:	85 c0                	test   %eax,%eax
+  803eb2:	78 20                	js     803ed4 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eb7:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803ebd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ec0:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803ec3:	8b 55 10             	mov    0x10(%ebp),%edx
+  803ec6:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803ec9:	8b 55 14             	mov    0x14(%ebp),%edx
+  803ecc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed4:	c9                   	leave
+  803ed5:	c3                   	ret
+
+00803ed6 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803ed6:	55                   	push   %ebp
+  803ed7:	89 e5                	mov    %esp,%ebp
+  803ed9:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803edc:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ee2:	e8 c1 fe ff ff       	call   803da8 <pgbatch_slot>
+  803ee7:	85 c0                	test   %eax,%eax
+  803ee9:	78 26                	js     803f11 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803eeb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803eee:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803ef4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803ef7:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803efa:	8b 55 10             	mov    0x10(%ebp),%edx
+  803efd:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803f00:	8b 55 14             	mov    0x14(%ebp),%edx
+  803f03:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803f06:	8b 55 18             	mov    0x18(%ebp),%edx
+  803f09:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f11:	c9                   	leave
+  803f12:	c3                   	ret
+
+00803f13 <poll>:
+// Wait until one of the 'nfds' descriptors in 'fds' is ready for one of
+// its events, or for 'timeout' msec (forever if < 0).  Sets each
+// revents, and returns how many are nonzero, or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, int timeout)
+{
+  803f13:	55                   	push   %ebp
+  803f14:	89 e5                	mov    %esp,%ebp
+  803f16:	57                   	push   %edi
+  803f17:	56                   	push   %esi
+  803f18:	53                   	push   %ebx
+  803f19:	81 ec fc 00 00 00    	sub    $0xfc,%esp
+	fd_set rset, wset, eset;
+	struct pollfd *p;
+	struct Fd *fd;
+	struct Dev *dev;
+	unsigned start = sys_time_msec();
+  803f1f:	e8 63 d4 ff ff       	call   801387 <sys_time_msec>
+  803f24:	89 85 08 ff ff ff    	mov    %eax,-0xf8(%ebp)
+		FD_ZERO(&rset);
+		FD_ZERO(&wset);
+		FD_ZERO(&eset);
+		n = pending = 0;
+		maxsock = -1;
+		for (p = fds; p < fds + nfds; p++) {
+  803f2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f2d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803f30:	8d 34 c7             	lea    (%edi,%eax,8),%esi
+
+		if (maxsock >= 0) {
+			if ((r = nsipc_select(maxsock + 1, &rset, &wset, &eset,
+					      wait)) < 0)
+				return r;
+			for (p = fds; r > 0 && p < fds + nfds; p++)
+  803f33:	39 f7                	cmp    %esi,%edi
+  803f35:	0f 92 85 07 ff ff ff 	setb   -0xf9(%ebp)
+  803f3c:	e9 7a 01 00 00       	jmp    8040bb <poll+0x1a8>
+			    || dev_lookup(fd->fd_dev_id, &dev) < 0)
+  803f41:	83 ec 08             	sub    $0x8,%esp
+  803f44:	8d 85 20 ff ff ff    	lea    -0xe0(%ebp),%eax
+  803f4a:	50                   	push   %eax
+  803f4b:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  803f51:	ff 30                	push   (%eax)
+  803f53:	e8 83 de ff ff       	call   801ddb <dev_lookup>
+  803f58:	83 c4 10             	add    $0x10,%esp
+  803f5b:	85 c0                	test   %eax,%eax
+  803f5d:	78 73                	js     803fd2 <poll+0xbf>
+			else if (dev == &devsock) {
+  803f5f:	8b 85 20 ff ff ff    	mov    -0xe0(%ebp),%eax
+  803f65:	3d 40 60 80 00       	cmp    $0x806040,%eax
+  803f6a:	74 71                	je     803fdd <poll+0xca>
+			} else if (dev->dev_poll) {
+  803f6c:	8b 40 1c             	mov    0x1c(%eax),%eax
+  803f6f:	85 c0                	test   %eax,%eax
+  803f71:	0f 84 0d 01 00 00    	je     804084 <poll+0x171>
+				p->revents = dev->dev_poll(fd, p->events);
+  803f77:	83 ec 08             	sub    $0x8,%esp
+  803f7a:	0f bf 53 04          	movswl 0x4(%ebx),%edx
+  803f7e:	52                   	push   %edx
+  803f7f:	ff b5 24 ff ff ff    	push   -0xdc(%ebp)
+  803f85:	ff d0                	call   *%eax
+  803f87:	66 89 43 06          	mov    %ax,0x6(%ebx)
+				pending += !p->revents;
+  803f8b:	83 c4 10             	add    $0x10,%esp
+  803f8e:	66 83 f8 01          	cmp    $0x1,%ax
+  803f92:	83 95 10 ff ff ff 00 	adcl   $0x0,-0xf0(%ebp)
+			if (p->revents)
+  803f99:	66 83 7b 06 00       	cmpw   $0x0,0x6(%ebx)
+  803f9e:	75 38                	jne    803fd8 <poll+0xc5>
+		for (p = fds; p < fds + nfds; p++) {
+  803fa0:	83 c3 08             	add    $0x8,%ebx
+  803fa3:	39 f3                	cmp    %esi,%ebx
+  803fa5:	0f 83 e9 00 00 00    	jae    804094 <poll+0x181>
+			p->revents = 0;
+  803fab:	66 c7 43 06 00 00    	movw   $0x0,0x6(%ebx)
+			if (p->fd < 0)
+  803fb1:	8b 03                	mov    (%ebx),%eax
+  803fb3:	85 c0                	test   %eax,%eax
+  803fb5:	78 e9                	js     803fa0 <poll+0x8d>
+			if (fd_lookup(p->fd, &fd) < 0
+  803fb7:	83 ec 08             	sub    $0x8,%esp
+  803fba:	8d 95 24 ff ff ff    	lea    -0xdc(%ebp),%edx
+  803fc0:	52                   	push   %edx
+  803fc1:	50                   	push   %eax
+  803fc2:	e8 c2 dd ff ff       	call   801d89 <fd_lookup>
+  803fc7:	83 c4 10             	add    $0x10,%esp
+  803fca:	85 c0                	test   %eax,%eax
+  803fcc:	0f 89 6f ff ff ff    	jns    803f41 <poll+0x2e>
+				p->revents = POLLNVAL;
+  803fd2:	66 c7 43 06 20 00    	movw   $0x20,0x6(%ebx)
+				n++;
+  803fd8:	83 c7 01             	add    $0x1,%edi
+  803fdb:	eb c3                	jmp    803fa0 <poll+0x8d>
+				if (p->events & POLLIN)
+  803fdd:	0f b7 53 04          	movzwl 0x4(%ebx),%edx
+  803fe1:	f6 c2 01             	test   $0x1,%dl
+  803fe4:	74 30                	je     804016 <poll+0x103>
+					FD_SET(fd->fd_sock.sockid, &rset);
+  803fe6:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  803fec:	8b 48 0c             	mov    0xc(%eax),%ecx
+  803fef:	8d 41 07             	lea    0x7(%ecx),%eax
+  803ff2:	85 c9                	test   %ecx,%ecx
+  803ff4:	0f 49 c1             	cmovns %ecx,%eax
+  803ff7:	c1 f8 03             	sar    $0x3,%eax
+  803ffa:	89 85 0c ff ff ff    	mov    %eax,-0xf4(%ebp)
+  804000:	83 e1 07             	and    $0x7,%ecx
+  804003:	b8 01 00 00 00       	mov    $0x1,%eax
+  804008:	d3 e0                	shl    %cl,%eax
+  80400a:	89 c1                	mov    %eax,%ecx
+  80400c:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+  804012:	08 4c 05 a8          	or     %cl,-0x58(%ebp,%eax,1)
+				if (p->events & POLLOUT)
+  804016:	f6 c2 04             	test   $0x4,%dl
+  804019:	74 25                	je     804040 <poll+0x12d>
+					FD_SET(fd->fd_sock.sockid, &wset);
+  80401b:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  804021:	8b 48 0c             	mov    0xc(%eax),%ecx
+  804024:	8d 41 07             	lea    0x7(%ecx),%eax
+  804027:	85 c9                	test   %ecx,%ecx
+  804029:	0f 49 c1             	cmovns %ecx,%eax
+  80402c:	c1 f8 03             	sar    $0x3,%eax
+  80402f:	83 e1 07             	and    $0x7,%ecx
+  804032:	ba 01 00 00 00       	mov    $0x1,%edx
+  804037:	d3 e2                	shl    %cl,%edx
+  804039:	08 94 05 68 ff ff ff 	or     %dl,-0x98(%ebp,%eax,1)
+				FD_SET(fd->fd_sock.sockid, &eset);
+  804040:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  804046:	8b 48 0c             	mov    0xc(%eax),%ecx
+  804049:	8d 41 07             	lea    0x7(%ecx),%eax
+  80404c:	85 c9                	test   %ecx,%ecx
+  80404e:	0f 49 c1             	cmovns %ecx,%eax
+  804051:	c1 f8 03             	sar    $0x3,%eax
+  804054:	83 e1 07             	and    $0x7,%ecx
+  804057:	ba 01 00 00 00       	mov    $0x1,%edx
+  80405c:	d3 e2                	shl    %cl,%edx
+  80405e:	08 94 05 28 ff ff ff 	or     %dl,-0xd8(%ebp,%eax,1)
+				maxsock = MAX(maxsock, fd->fd_sock.sockid);
+  804065:	8b 85 24 ff ff ff    	mov    -0xdc(%ebp),%eax
+  80406b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80406e:	8b 8d 14 ff ff ff    	mov    -0xec(%ebp),%ecx
+  804074:	39 c1                	cmp    %eax,%ecx
+  804076:	0f 4d c1             	cmovge %ecx,%eax
+  804079:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  80407f:	e9 15 ff ff ff       	jmp    803f99 <poll+0x86>
+				p->revents = p->events & (POLLIN | POLLOUT);
+  804084:	0f b7 43 04          	movzwl 0x4(%ebx),%eax
+  804088:	83 e0 05             	and    $0x5,%eax
+  80408b:	66 89 43 06          	mov    %ax,0x6(%ebx)
+  80408f:	e9 05 ff ff ff       	jmp    803f99 <poll+0x86>
+		if (n)
+  804094:	85 ff                	test   %edi,%edi
+  804096:	0f 84 82 00 00 00    	je     80411e <poll+0x20b>
+		if (maxsock >= 0) {
+  80409c:	83 bd 14 ff ff ff 00 	cmpl   $0x0,-0xec(%ebp)
+  8040a3:	0f 89 53 01 00 00    	jns    8041fc <poll+0x2e9>
+					p->events, &rset, &wset, &eset)))
+					n++;
+		} else if (wait != 0)
+			poll_sleep(wait < 0 ? POLL_SLICE : wait);
+
+		if (n || (timeout >= 0 && sys_time_msec() - start >= timeout))
+  8040a9:	85 ff                	test   %edi,%edi
+  8040ab:	0f 85 70 02 00 00    	jne    804321 <poll+0x40e>
+  8040b1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8040b5:	0f 89 47 02 00 00    	jns    804302 <poll+0x3ef>
+		FD_ZERO(&rset);
+  8040bb:	83 ec 04             	sub    $0x4,%esp
+  8040be:	6a 40                	push   $0x40
+  8040c0:	6a 00                	push   $0x0
+  8040c2:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8040c5:	50                   	push   %eax
+  8040c6:	e8 af cd ff ff       	call   800e7a <memset>
+		FD_ZERO(&wset);
+  8040cb:	83 c4 0c             	add    $0xc,%esp
+  8040ce:	6a 40                	push   $0x40
+  8040d0:	6a 00                	push   $0x0
+  8040d2:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8040d8:	50                   	push   %eax
+  8040d9:	e8 9c cd ff ff       	call   800e7a <memset>
+		FD_ZERO(&eset);
+  8040de:	83 c4 0c             	add    $0xc,%esp
+  8040e1:	6a 40                	push   $0x40
+  8040e3:	6a 00                	push   $0x0
+  8040e5:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+  8040eb:	50                   	push   %eax
+  8040ec:	e8 89 cd ff ff       	call   800e7a <memset>
+		for (p = fds; p < fds + nfds; p++) {
+  8040f1:	83 c4 10             	add    $0x10,%esp
+  8040f4:	39 75 08             	cmp    %esi,0x8(%ebp)
+  8040f7:	0f 83 67 02 00 00    	jae    804364 <poll+0x451>
+  8040fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+		n = pending = 0;
+  804100:	c7 85 10 ff ff ff 00 	movl   $0x0,-0xf0(%ebp)
+  804107:	00 00 00 
+		maxsock = -1;
+  80410a:	c7 85 14 ff ff ff ff 	movl   $0xffffffff,-0xec(%ebp)
+  804111:	ff ff ff 
+		n = pending = 0;
+  804114:	bf 00 00 00 00       	mov    $0x0,%edi
+  804119:	e9 8d fe ff ff       	jmp    803fab <poll+0x98>
+			wait = -1;
+  80411e:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+		else if (timeout < 0)
+  804123:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804127:	0f 89 55 02 00 00    	jns    804382 <poll+0x46f>
+		if (pending && (wait < 0 || wait > POLL_SLICE))
+  80412d:	83 bd 10 ff ff ff 00 	cmpl   $0x0,-0xf0(%ebp)
+  804134:	74 7c                	je     8041b2 <poll+0x29f>
+  804136:	83 fb 0a             	cmp    $0xa,%ebx
+  804139:	76 77                	jbe    8041b2 <poll+0x29f>
+		if (maxsock >= 0) {
+  80413b:	83 bd 14 ff ff ff 00 	cmpl   $0x0,-0xec(%ebp)
+  804142:	0f 88 e9 01 00 00    	js     804331 <poll+0x41e>
+  804148:	bf 00 00 00 00       	mov    $0x0,%edi
+			wait = POLL_SLICE;
+  80414d:	bb 0a 00 00 00       	mov    $0xa,%ebx
+			if ((r = nsipc_select(maxsock + 1, &rset, &wset, &eset,
+  804152:	83 ec 0c             	sub    $0xc,%esp
+  804155:	53                   	push   %ebx
+  804156:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+  80415c:	50                   	push   %eax
+  80415d:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804163:	50                   	push   %eax
+  804164:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  804167:	50                   	push   %eax
+  804168:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  80416e:	83 c0 01             	add    $0x1,%eax
+  804171:	50                   	push   %eax
+  804172:	e8 f8 f0 ff ff       	call   80326f <nsipc_select>
+  804177:	83 c4 20             	add    $0x20,%esp
+  80417a:	85 c0                	test   %eax,%eax
+  80417c:	0f 88 9d 01 00 00    	js     80431f <poll+0x40c>
+			for (p = fds; r > 0 && p < fds + nfds; p++)
+  804182:	0f 8e 21 ff ff ff    	jle    8040a9 <poll+0x196>
+  804188:	80 bd 07 ff ff ff 00 	cmpb   $0x0,-0xf9(%ebp)
+  80418f:	0f 84 14 ff ff ff    	je     8040a9 <poll+0x196>
+  804195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804198:	89 bd 14 ff ff ff    	mov    %edi,-0xec(%ebp)
+  80419e:	e9 9a 00 00 00       	jmp    80423d <poll+0x32a>
+		maxsock = -1;
+  8041a3:	c7 85 14 ff ff ff ff 	movl   $0xffffffff,-0xec(%ebp)
+  8041aa:	ff ff ff 
+			wait = -1;
+  8041ad:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+		if (maxsock >= 0) {
+  8041b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b7:	83 bd 14 ff ff ff 00 	cmpl   $0x0,-0xec(%ebp)
+  8041be:	79 92                	jns    804152 <poll+0x23f>
+		} else if (wait != 0)
+  8041c0:	85 db                	test   %ebx,%ebx
+  8041c2:	0f 84 33 01 00 00    	je     8042fb <poll+0x3e8>
+			poll_sleep(wait < 0 ? POLL_SLICE : wait);
+  8041c8:	79 05                	jns    8041cf <poll+0x2bc>
+  8041ca:	bb 0a 00 00 00       	mov    $0xa,%ebx
+	if (sys_futex_wait(&nap, 0, sys_time_msec() + msec) != -E_TIMEOUT)
+  8041cf:	e8 b3 d1 ff ff       	call   801387 <sys_time_msec>
+  8041d4:	83 ec 04             	sub    $0x4,%esp
+  8041d7:	01 d8                	add    %ebx,%eax
+  8041d9:	50                   	push   %eax
+  8041da:	6a 00                	push   $0x0
+  8041dc:	68 40 8f 80 00       	push   $0x808f40
+  8041e1:	e8 4b d3 ff ff       	call   801531 <sys_futex_wait>
+  8041e6:	83 c4 10             	add    $0x10,%esp
+  8041e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ee:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8041f1:	0f 84 b2 fe ff ff    	je     8040a9 <poll+0x196>
+  8041f7:	e9 59 01 00 00       	jmp    804355 <poll+0x442>
+			wait = 0;
+  8041fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804201:	e9 4c ff ff ff       	jmp    804152 <poll+0x23f>
+	if (FD_ISSET(sockid, eset))
+  804206:	8d 4a 07             	lea    0x7(%edx),%ecx
+  804209:	85 d2                	test   %edx,%edx
+  80420b:	0f 49 ca             	cmovns %edx,%ecx
+  80420e:	c1 f9 03             	sar    $0x3,%ecx
+  804211:	0f b6 8c 0d 28 ff ff 	movzbl -0xd8(%ebp,%ecx,1),%ecx
+  804218:	ff 
+  804219:	83 e2 07             	and    $0x7,%edx
+  80421c:	0f a3 d1             	bt     %edx,%ecx
+  80421f:	0f 82 b8 00 00 00    	jb     8042dd <poll+0x3ca>
+				    && (p->revents = sock_revents(fd->fd_sock.sockid,
+  804225:	66 89 43 06          	mov    %ax,0x6(%ebx)
+  804229:	66 85 c0             	test   %ax,%ax
+  80422c:	0f 85 b2 00 00 00    	jne    8042e4 <poll+0x3d1>
+			for (p = fds; r > 0 && p < fds + nfds; p++)
+  804232:	83 c3 08             	add    $0x8,%ebx
+  804235:	39 f3                	cmp    %esi,%ebx
+  804237:	0f 83 b3 00 00 00    	jae    8042f0 <poll+0x3dd>
+				if (p->fd >= 0 && fd_lookup(p->fd, &fd) == 0
+  80423d:	8b 03                	mov    (%ebx),%eax
+  80423f:	85 c0                	test   %eax,%eax
+  804241:	78 ef                	js     804232 <poll+0x31f>
+  804243:	83 ec 08             	sub    $0x8,%esp
+  804246:	8d 8d 24 ff ff ff    	lea    -0xdc(%ebp),%ecx
+  80424c:	51                   	push   %ecx
+  80424d:	50                   	push   %eax
+  80424e:	e8 36 db ff ff       	call   801d89 <fd_lookup>
+  804253:	83 c4 10             	add    $0x10,%esp
+  804256:	85 c0                	test   %eax,%eax
+  804258:	75 d8                	jne    804232 <poll+0x31f>
+				    && fd->fd_dev_id == devsock.dev_id
+  80425a:	8b 95 24 ff ff ff    	mov    -0xdc(%ebp),%edx
+  804260:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  804266:	39 0a                	cmp    %ecx,(%edx)
+  804268:	75 c8                	jne    804232 <poll+0x31f>
+					p->events, &rset, &wset, &eset)))
+  80426a:	0f b7 4b 04          	movzwl 0x4(%ebx),%ecx
+  80426e:	89 cf                	mov    %ecx,%edi
+				    && (p->revents = sock_revents(fd->fd_sock.sockid,
+  804270:	8b 52 0c             	mov    0xc(%edx),%edx
+	if ((events & POLLIN) && FD_ISSET(sockid, rset))
+  804273:	f6 c1 01             	test   $0x1,%cl
+  804276:	74 1a                	je     804292 <poll+0x37f>
+  804278:	8d 42 07             	lea    0x7(%edx),%eax
+  80427b:	85 d2                	test   %edx,%edx
+  80427d:	0f 49 c2             	cmovns %edx,%eax
+  804280:	c1 f8 03             	sar    $0x3,%eax
+  804283:	0f b6 44 05 a8       	movzbl -0x58(%ebp,%eax,1),%eax
+  804288:	89 d1                	mov    %edx,%ecx
+  80428a:	83 e1 07             	and    $0x7,%ecx
+  80428d:	d3 f8                	sar    %cl,%eax
+  80428f:	83 e0 01             	and    $0x1,%eax
+	if ((events & POLLOUT) && FD_ISSET(sockid, wset))
+  804292:	f7 c7 04 00 00 00    	test   $0x4,%edi
+  804298:	0f 84 68 ff ff ff    	je     804206 <poll+0x2f3>
+  80429e:	8d 4a 07             	lea    0x7(%edx),%ecx
+  8042a1:	85 d2                	test   %edx,%edx
+  8042a3:	0f 49 ca             	cmovns %edx,%ecx
+  8042a6:	89 cf                	mov    %ecx,%edi
+  8042a8:	c1 ff 03             	sar    $0x3,%edi
+  8042ab:	89 d1                	mov    %edx,%ecx
+  8042ad:	83 e1 07             	and    $0x7,%ecx
+  8042b0:	89 bd 10 ff ff ff    	mov    %edi,-0xf0(%ebp)
+  8042b6:	0f b6 bc 3d 68 ff ff 	movzbl -0x98(%ebp,%edi,1),%edi
+  8042bd:	ff 
+  8042be:	0f a3 cf             	bt     %ecx,%edi
+  8042c1:	0f 83 3f ff ff ff    	jae    804206 <poll+0x2f3>
+		revents |= POLLOUT;
+  8042c7:	83 c8 04             	or     $0x4,%eax
+	if (FD_ISSET(sockid, eset))
+  8042ca:	8b bd 10 ff ff ff    	mov    -0xf0(%ebp),%edi
+  8042d0:	0f b6 94 3d 28 ff ff 	movzbl -0xd8(%ebp,%edi,1),%edx
+  8042d7:	ff 
+  8042d8:	0f a3 ca             	bt     %ecx,%edx
+  8042db:	73 4e                	jae    80432b <poll+0x418>
+		revents |= POLLERR;
+  8042dd:	83 c8 08             	or     $0x8,%eax
+				    && (p->revents = sock_revents(fd->fd_sock.sockid,
+  8042e0:	66 89 43 06          	mov    %ax,0x6(%ebx)
+					n++;
+  8042e4:	83 85 14 ff ff ff 01 	addl   $0x1,-0xec(%ebp)
+  8042eb:	e9 42 ff ff ff       	jmp    804232 <poll+0x31f>
+  8042f0:	8b bd 14 ff ff ff    	mov    -0xec(%ebp),%edi
+  8042f6:	e9 ae fd ff ff       	jmp    8040a9 <poll+0x196>
+  8042fb:	89 df                	mov    %ebx,%edi
+  8042fd:	e9 a7 fd ff ff       	jmp    8040a9 <poll+0x196>
+		if (n || (timeout >= 0 && sys_time_msec() - start >= timeout))
+  804302:	e8 80 d0 ff ff       	call   801387 <sys_time_msec>
+  804307:	8b bd 08 ff ff ff    	mov    -0xf8(%ebp),%edi
+  80430d:	29 f8                	sub    %edi,%eax
+  80430f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  804312:	0f 82 a3 fd ff ff    	jb     8040bb <poll+0x1a8>
+			return n;
+  804318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431d:	eb 02                	jmp    804321 <poll+0x40e>
+			if ((r = nsipc_select(maxsock + 1, &rset, &wset, &eset,
+  80431f:	89 c7                	mov    %eax,%edi
+	}
+}
+  804321:	89 f8                	mov    %edi,%eax
+  804323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804326:	5b                   	pop    %ebx
+  804327:	5e                   	pop    %esi
+  804328:	5f                   	pop    %edi
+  804329:	5d                   	pop    %ebp
+  80432a:	c3                   	ret
+				    && (p->revents = sock_revents(fd->fd_sock.sockid,
+  80432b:	66 89 43 06          	mov    %ax,0x6(%ebx)
+  80432f:	eb b3                	jmp    8042e4 <poll+0x3d1>
+	if (sys_futex_wait(&nap, 0, sys_time_msec() + msec) != -E_TIMEOUT)
+  804331:	e8 51 d0 ff ff       	call   801387 <sys_time_msec>
+  804336:	83 ec 04             	sub    $0x4,%esp
+  804339:	83 c0 0a             	add    $0xa,%eax
+  80433c:	50                   	push   %eax
+  80433d:	6a 00                	push   $0x0
+  80433f:	68 40 8f 80 00       	push   $0x808f40
+  804344:	e8 e8 d1 ff ff       	call   801531 <sys_futex_wait>
+  804349:	83 c4 10             	add    $0x10,%esp
+  80434c:	83 f8 ef             	cmp    $0xffffffef,%eax
+  80434f:	0f 84 5c fd ff ff    	je     8040b1 <poll+0x19e>
+		sys_yield();
+  804355:	e8 ba cd ff ff       	call   801114 <sys_yield>
+  80435a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80435f:	e9 45 fd ff ff       	jmp    8040a9 <poll+0x196>
+		else if (timeout < 0)
+  804364:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804368:	0f 88 35 fe ff ff    	js     8041a3 <poll+0x290>
+		n = pending = 0;
+  80436e:	c7 85 10 ff ff ff 00 	movl   $0x0,-0xf0(%ebp)
+  804375:	00 00 00 
+		maxsock = -1;
+  804378:	c7 85 14 ff ff ff ff 	movl   $0xffffffff,-0xec(%ebp)
+  80437f:	ff ff ff 
+			wait = MAX(0, timeout - (int) (sys_time_msec() - start));
+  804382:	e8 00 d0 ff ff       	call   801387 <sys_time_msec>
+  804387:	8b bd 08 ff ff ff    	mov    -0xf8(%ebp),%edi
+  80438d:	29 f8                	sub    %edi,%eax
+  80438f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804392:	29 c3                	sub    %eax,%ebx
+  804394:	b8 00 00 00 00       	mov    $0x0,%eax
+  804399:	0f 48 d8             	cmovs  %eax,%ebx
+  80439c:	e9 8c fd ff ff       	jmp    80412d <poll+0x21a>
+
+008043a1 <select>:
+// select() on top of poll().  Returns the number of bits left set in
+// the three sets.
+int
+select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+       struct timeval *timeout)
+{
+  8043a1:	55                   	push   %ebp
+  8043a2:	89 e5                	mov    %esp,%ebp
+  8043a4:	57                   	push   %edi
+  8043a5:	56                   	push   %esi
+  8043a6:	53                   	push   %ebx
+  8043a7:	83 ec 1c             	sub    $0x1c,%esp
+  8043aa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8043ad:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8043b0:	8b 75 18             	mov    0x18(%ebp),%esi
+	static struct pollfd fds[FD_SETSIZE];
+	int i, r, n = 0;
+
+	if (nfds < 0 || nfds > FD_SETSIZE)
+  8043b3:	81 7d 08 00 02 00 00 	cmpl   $0x200,0x8(%ebp)
+  8043ba:	0f 87 45 02 00 00    	ja     804605 <select+0x264>
+		return -E_INVAL;
+	for (i = 0; i < nfds; i++) {
+  8043c0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8043c4:	0f 8e 87 00 00 00    	jle    804451 <select+0xb0>
+  8043ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043cf:	eb 18                	jmp    8043e9 <select+0x48>
+		fds[i].fd = -1;
+		fds[i].events = 0;
+		if (readset && FD_ISSET(i, readset))
+			fds[i].events |= POLLIN;
+		if (writeset && FD_ISSET(i, writeset))
+			fds[i].events |= POLLOUT;
+  8043d1:	66 83 0c d5 44 7f 80 	orw    $0x4,0x807f44(,%edx,8)
+  8043d8:	00 04 
+		if (fds[i].events || (exceptset && FD_ISSET(i, exceptset)))
+			fds[i].fd = i;
+  8043da:	89 04 d5 40 7f 80 00 	mov    %eax,0x807f40(,%edx,8)
+	for (i = 0; i < nfds; i++) {
+  8043e1:	83 c0 01             	add    $0x1,%eax
+  8043e4:	39 45 08             	cmp    %eax,0x8(%ebp)
+  8043e7:	74 65                	je     80444e <select+0xad>
+		fds[i].fd = -1;
+  8043e9:	89 c2                	mov    %eax,%edx
+  8043eb:	c7 04 c5 40 7f 80 00 	movl   $0xffffffff,0x807f40(,%eax,8)
+  8043f2:	ff ff ff ff 
+		fds[i].events = 0;
+  8043f6:	66 c7 04 c5 44 7f 80 	movw   $0x0,0x807f44(,%eax,8)
+  8043fd:	00 00 00 
+		if (readset && FD_ISSET(i, readset))
+  804400:	85 db                	test   %ebx,%ebx
+  804402:	0f 84 18 02 00 00    	je     804620 <select+0x27f>
+  804408:	8d 48 07             	lea    0x7(%eax),%ecx
+  80440b:	85 c0                	test   %eax,%eax
+  80440d:	0f 49 c8             	cmovns %eax,%ecx
+  804410:	c1 f9 03             	sar    $0x3,%ecx
+  804413:	0f b6 34 0b          	movzbl (%ebx,%ecx,1),%esi
+  804417:	89 c1                	mov    %eax,%ecx
+  804419:	83 e1 07             	and    $0x7,%ecx
+  80441c:	0f a3 ce             	bt     %ecx,%esi
+  80441f:	0f 83 fb 01 00 00    	jae    804620 <select+0x27f>
+			fds[i].events |= POLLIN;
+  804425:	66 c7 04 c5 44 7f 80 	movw   $0x1,0x807f44(,%eax,8)
+  80442c:	00 01 00 
+		if (writeset && FD_ISSET(i, writeset))
+  80442f:	85 ff                	test   %edi,%edi
+  804431:	74 a7                	je     8043da <select+0x39>
+  804433:	8d 48 07             	lea    0x7(%eax),%ecx
+  804436:	85 c0                	test   %eax,%eax
+  804438:	0f 49 c8             	cmovns %eax,%ecx
+  80443b:	c1 f9 03             	sar    $0x3,%ecx
+  80443e:	0f b6 34 0f          	movzbl (%edi,%ecx,1),%esi
+  804442:	89 c1                	mov    %eax,%ecx
+  804444:	83 e1 07             	and    $0x7,%ecx
+  804447:	0f a3 ce             	bt     %ecx,%esi
+  80444a:	72 85                	jb     8043d1 <select+0x30>
+  80444c:	eb 8c                	jmp    8043da <select+0x39>
+  80444e:	8b 75 18             	mov    0x18(%ebp),%esi
+	}
+	if ((r = poll(fds, nfds, timeout ? timeout->tv_sec * 1000
+  804451:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  804456:	85 f6                	test   %esi,%esi
+  804458:	74 1c                	je     804476 <select+0xd5>
+  80445a:	69 0e e8 03 00 00    	imul   $0x3e8,(%esi),%ecx
+		      + timeout->tv_usec / 1000 : -1)) < 0)
+  804460:	8b 76 04             	mov    0x4(%esi),%esi
+  804463:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+  804468:	89 f0                	mov    %esi,%eax
+  80446a:	f7 ea                	imul   %edx
+  80446c:	c1 fa 06             	sar    $0x6,%edx
+  80446f:	c1 fe 1f             	sar    $0x1f,%esi
+  804472:	29 f2                	sub    %esi,%edx
+	if ((r = poll(fds, nfds, timeout ? timeout->tv_sec * 1000
+  804474:	01 d1                	add    %edx,%ecx
+  804476:	83 ec 04             	sub    $0x4,%esp
+  804479:	51                   	push   %ecx
+  80447a:	ff 75 08             	push   0x8(%ebp)
+  80447d:	68 40 7f 80 00       	push   $0x807f40
+  804482:	e8 8c fa ff ff       	call   803f13 <poll>
+  804487:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80448a:	83 c4 10             	add    $0x10,%esp
+  80448d:	85 c0                	test   %eax,%eax
+  80448f:	0f 88 80 01 00 00    	js     804615 <select+0x274>
+		return r;
+
+	for (i = 0; i < nfds; i++) {
+  804495:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804499:	0f 8e 6f 01 00 00    	jle    80460e <select+0x26d>
+	int i, r, n = 0;
+  80449f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (i = 0; i < nfds; i++) {
+  8044a6:	b8 00 00 00 00       	mov    $0x0,%eax
+		    && !(fds[i].revents & (POLLOUT | POLLERR)))
+			FD_CLR(i, writeset);
+		if (exceptset && FD_ISSET(i, exceptset)
+		    && !(fds[i].revents & (POLLERR | POLLNVAL)))
+			FD_CLR(i, exceptset);
+		n += (readset && FD_ISSET(i, readset))
+  8044ab:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8044ae:	e9 83 00 00 00       	jmp    804536 <select+0x195>
+  8044b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044b8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8044bc:	74 1c                	je     8044da <select+0x139>
+  8044be:	8d 50 07             	lea    0x7(%eax),%edx
+  8044c1:	85 c0                	test   %eax,%eax
+  8044c3:	0f 49 d0             	cmovns %eax,%edx
+  8044c6:	c1 fa 03             	sar    $0x3,%edx
+  8044c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8044cc:	0f b6 1c 16          	movzbl (%esi,%edx,1),%ebx
+  8044d0:	89 c1                	mov    %eax,%ecx
+  8044d2:	83 e1 07             	and    $0x7,%ecx
+  8044d5:	d3 fb                	sar    %cl,%ebx
+  8044d7:	83 e3 01             	and    $0x1,%ebx
+			+ (writeset && FD_ISSET(i, writeset))
+  8044da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044df:	85 ff                	test   %edi,%edi
+  8044e1:	74 19                	je     8044fc <select+0x15b>
+  8044e3:	8d 50 07             	lea    0x7(%eax),%edx
+  8044e6:	85 c0                	test   %eax,%eax
+  8044e8:	0f 49 d0             	cmovns %eax,%edx
+  8044eb:	c1 fa 03             	sar    $0x3,%edx
+  8044ee:	0f b6 14 17          	movzbl (%edi,%edx,1),%edx
+  8044f2:	89 c1                	mov    %eax,%ecx
+  8044f4:	83 e1 07             	and    $0x7,%ecx
+  8044f7:	d3 fa                	sar    %cl,%edx
+  8044f9:	83 e2 01             	and    $0x1,%edx
+  8044fc:	01 da                	add    %ebx,%edx
+			+ (exceptset && FD_ISSET(i, exceptset));
+  8044fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804503:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  804507:	74 1c                	je     804525 <select+0x184>
+  804509:	8d 48 07             	lea    0x7(%eax),%ecx
+  80450c:	85 c0                	test   %eax,%eax
+  80450e:	0f 49 c8             	cmovns %eax,%ecx
+  804511:	c1 f9 03             	sar    $0x3,%ecx
+  804514:	8b 75 14             	mov    0x14(%ebp),%esi
+  804517:	0f b6 1c 0e          	movzbl (%esi,%ecx,1),%ebx
+  80451b:	89 c1                	mov    %eax,%ecx
+  80451d:	83 e1 07             	and    $0x7,%ecx
+  804520:	d3 fb                	sar    %cl,%ebx
+  804522:	83 e3 01             	and    $0x1,%ebx
+  804525:	01 da                	add    %ebx,%edx
+		n += (readset && FD_ISSET(i, readset))
+  804527:	01 55 e4             	add    %edx,-0x1c(%ebp)
+	for (i = 0; i < nfds; i++) {
+  80452a:	83 c0 01             	add    $0x1,%eax
+  80452d:	39 45 08             	cmp    %eax,0x8(%ebp)
+  804530:	0f 84 df 00 00 00    	je     804615 <select+0x274>
+		if (readset && FD_ISSET(i, readset)
+  804536:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80453a:	74 3c                	je     804578 <select+0x1d7>
+  80453c:	8d 50 07             	lea    0x7(%eax),%edx
+  80453f:	85 c0                	test   %eax,%eax
+  804541:	0f 49 d0             	cmovns %eax,%edx
+  804544:	c1 fa 03             	sar    $0x3,%edx
+  804547:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80454a:	0f b6 1c 16          	movzbl (%esi,%edx,1),%ebx
+  80454e:	89 c1                	mov    %eax,%ecx
+  804550:	83 e1 07             	and    $0x7,%ecx
+  804553:	0f b6 f3             	movzbl %bl,%esi
+  804556:	0f a3 ce             	bt     %ecx,%esi
+  804559:	73 1d                	jae    804578 <select+0x1d7>
+		    && !(fds[i].revents & (POLLIN | POLLHUP | POLLERR)))
+  80455b:	f6 04 c5 46 7f 80 00 	testb  $0x19,0x807f46(,%eax,8)
+  804562:	19 
+  804563:	75 13                	jne    804578 <select+0x1d7>
+			FD_CLR(i, readset);
+  804565:	be 01 00 00 00       	mov    $0x1,%esi
+  80456a:	d3 e6                	shl    %cl,%esi
+  80456c:	89 f1                	mov    %esi,%ecx
+  80456e:	f7 d1                	not    %ecx
+  804570:	21 d9                	and    %ebx,%ecx
+  804572:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804575:	88 0c 13             	mov    %cl,(%ebx,%edx,1)
+		if (writeset && FD_ISSET(i, writeset)
+  804578:	85 ff                	test   %edi,%edi
+  80457a:	74 36                	je     8045b2 <select+0x211>
+  80457c:	8d 50 07             	lea    0x7(%eax),%edx
+  80457f:	85 c0                	test   %eax,%eax
+  804581:	0f 49 d0             	cmovns %eax,%edx
+  804584:	c1 fa 03             	sar    $0x3,%edx
+  804587:	0f b6 1c 17          	movzbl (%edi,%edx,1),%ebx
+  80458b:	89 c1                	mov    %eax,%ecx
+  80458d:	83 e1 07             	and    $0x7,%ecx
+  804590:	0f b6 f3             	movzbl %bl,%esi
+  804593:	0f a3 ce             	bt     %ecx,%esi
+  804596:	73 1a                	jae    8045b2 <select+0x211>
+		    && !(fds[i].revents & (POLLOUT | POLLERR)))
+  804598:	f6 04 c5 46 7f 80 00 	testb  $0xc,0x807f46(,%eax,8)
+  80459f:	0c 
+  8045a0:	75 10                	jne    8045b2 <select+0x211>
+			FD_CLR(i, writeset);
+  8045a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8045a7:	d3 e6                	shl    %cl,%esi
+  8045a9:	89 f1                	mov    %esi,%ecx
+  8045ab:	f7 d1                	not    %ecx
+  8045ad:	21 d9                	and    %ebx,%ecx
+  8045af:	88 0c 17             	mov    %cl,(%edi,%edx,1)
+		if (exceptset && FD_ISSET(i, exceptset)
+  8045b2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8045b6:	0f 84 f7 fe ff ff    	je     8044b3 <select+0x112>
+  8045bc:	8d 50 07             	lea    0x7(%eax),%edx
+  8045bf:	85 c0                	test   %eax,%eax
+  8045c1:	0f 49 d0             	cmovns %eax,%edx
+  8045c4:	c1 fa 03             	sar    $0x3,%edx
+  8045c7:	8b 75 14             	mov    0x14(%ebp),%esi
+  8045ca:	0f b6 1c 16          	movzbl (%esi,%edx,1),%ebx
+  8045ce:	89 c1                	mov    %eax,%ecx
+  8045d0:	83 e1 07             	and    $0x7,%ecx
+  8045d3:	0f b6 f3             	movzbl %bl,%esi
+  8045d6:	0f a3 ce             	bt     %ecx,%esi
+  8045d9:	0f 83 d4 fe ff ff    	jae    8044b3 <select+0x112>
+		    && !(fds[i].revents & (POLLERR | POLLNVAL)))
+  8045df:	f6 04 c5 46 7f 80 00 	testb  $0x28,0x807f46(,%eax,8)
+  8045e6:	28 
+  8045e7:	0f 85 c6 fe ff ff    	jne    8044b3 <select+0x112>
+			FD_CLR(i, exceptset);
+  8045ed:	be 01 00 00 00       	mov    $0x1,%esi
+  8045f2:	d3 e6                	shl    %cl,%esi
+  8045f4:	89 f1                	mov    %esi,%ecx
+  8045f6:	f7 d1                	not    %ecx
+  8045f8:	21 d9                	and    %ebx,%ecx
+  8045fa:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8045fd:	88 0c 13             	mov    %cl,(%ebx,%edx,1)
+  804600:	e9 ae fe ff ff       	jmp    8044b3 <select+0x112>
+		return -E_INVAL;
+  804605:	c7 45 e4 fd ff ff ff 	movl   $0xfffffffd,-0x1c(%ebp)
+  80460c:	eb 07                	jmp    804615 <select+0x274>
+	int i, r, n = 0;
+  80460e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	}
+	return n;
+}
+  804615:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804618:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80461b:	5b                   	pop    %ebx
+  80461c:	5e                   	pop    %esi
+  80461d:	5f                   	pop    %edi
+  80461e:	5d                   	pop    %ebp
+  80461f:	c3                   	ret
+		if (writeset && FD_ISSET(i, writeset))
+  804620:	85 ff                	test   %edi,%edi
+  804622:	74 1d                	je     804641 <select+0x2a0>
+  804624:	8d 48 07             	lea    0x7(%eax),%ecx
+  804627:	85 c0                	test   %eax,%eax
+  804629:	0f 49 c8             	cmovns %eax,%ecx
+  80462c:	c1 f9 03             	sar    $0x3,%ecx
+  80462f:	0f b6 34 0f          	movzbl (%edi,%ecx,1),%esi
+  804633:	89 c1                	mov    %eax,%ecx
+  804635:	83 e1 07             	and    $0x7,%ecx
+  804638:	0f a3 ce             	bt     %ecx,%esi
+  80463b:	0f 82 90 fd ff ff    	jb     8043d1 <select+0x30>
+		if (fds[i].events || (exceptset && FD_ISSET(i, exceptset)))
+  804641:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  804645:	0f 84 96 fd ff ff    	je     8043e1 <select+0x40>
+  80464b:	8d 48 07             	lea    0x7(%eax),%ecx
+  80464e:	85 c0                	test   %eax,%eax
+  804650:	0f 49 c8             	cmovns %eax,%ecx
+  804653:	c1 f9 03             	sar    $0x3,%ecx
+  804656:	8b 75 14             	mov    0x14(%ebp),%esi
+  804659:	0f b6 34 0e          	movzbl (%esi,%ecx,1),%esi
+  80465d:	89 c1                	mov    %eax,%ecx
+  80465f:	83 e1 07             	and    $0x7,%ecx
+  804662:	0f a3 ce             	bt     %ecx,%esi
+  804665:	0f 83 76 fd ff ff    	jae    8043e1 <select+0x40>
+  80466b:	e9 6a fd ff ff       	jmp    8043da <select+0x39>
+
+00804670 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  804670:	55                   	push   %ebp
+  804671:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804673:	8b 45 08             	mov    0x8(%ebp),%eax
+  804676:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80467c:	5d                   	pop    %ebp
+  80467d:	c3                   	ret
+
+0080467e <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80467e:	55                   	push   %ebp
+  80467f:	89 e5                	mov    %esp,%ebp
+  804681:	56                   	push   %esi
+  804682:	53                   	push   %ebx
+  804683:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804690:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804694:	85 c0                	test   %eax,%eax
+  804696:	74 2f                	je     8046c7 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804698:	83 f8 02             	cmp    $0x2,%eax
+  80469b:	74 0c                	je     8046a9 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  80469d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8046a2:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8046a5:	85 c0                	test   %eax,%eax
+  8046a7:	74 1e                	je     8046c7 <mutex_lock+0x49>
+  8046a9:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8046ae:	83 ec 04             	sub    $0x4,%esp
+  8046b1:	6a ff                	push   $0xffffffff
+  8046b3:	6a 02                	push   $0x2
+  8046b5:	53                   	push   %ebx
+  8046b6:	e8 76 ce ff ff       	call   801531 <sys_futex_wait>
+  8046bb:	89 f0                	mov    %esi,%eax
+  8046bd:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  8046c0:	83 c4 10             	add    $0x10,%esp
+  8046c3:	85 c0                	test   %eax,%eax
+  8046c5:	75 e7                	jne    8046ae <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8046c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8046ca:	5b                   	pop    %ebx
+  8046cb:	5e                   	pop    %esi
+  8046cc:	5d                   	pop    %ebp
+  8046cd:	c3                   	ret
+
+008046ce <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  8046ce:	55                   	push   %ebp
+  8046cf:	89 e5                	mov    %esp,%ebp
+  8046d1:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8046d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8046de:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  8046e2:	85 c0                	test   %eax,%eax
+  8046e4:	0f 94 c0             	sete   %al
+  8046e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8046ea:	5d                   	pop    %ebp
+  8046eb:	c3                   	ret
+
+008046ec <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  8046ec:	55                   	push   %ebp
+  8046ed:	89 e5                	mov    %esp,%ebp
+  8046ef:	83 ec 08             	sub    $0x8,%esp
+  8046f2:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  8046f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fa:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  8046fd:	83 f8 02             	cmp    $0x2,%eax
+  804700:	74 02                	je     804704 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804702:	c9                   	leave
+  804703:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804704:	83 ec 08             	sub    $0x8,%esp
+  804707:	6a 01                	push   $0x1
+  804709:	52                   	push   %edx
+  80470a:	e8 44 ce ff ff       	call   801553 <sys_futex_wake>
+  80470f:	83 c4 10             	add    $0x10,%esp
+}
+  804712:	eb ee                	jmp    804702 <mutex_unlock+0x16>
+
+00804714 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804714:	55                   	push   %ebp
+  804715:	89 e5                	mov    %esp,%ebp
+  804717:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  80471a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  804720:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804727:	5d                   	pop    %ebp
+  804728:	c3                   	ret
+
+00804729 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804729:	55                   	push   %ebp
+  80472a:	89 e5                	mov    %esp,%ebp
+  80472c:	57                   	push   %edi
+  80472d:	56                   	push   %esi
+  80472e:	53                   	push   %ebx
+  80472f:	83 ec 18             	sub    $0x18,%esp
+  804732:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804735:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804738:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  80473a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80473f:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804744:	57                   	push   %edi
+  804745:	e8 a2 ff ff ff       	call   8046ec <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80474a:	83 c4 0c             	add    $0xc,%esp
+  80474d:	ff 75 10             	push   0x10(%ebp)
+  804750:	56                   	push   %esi
+  804751:	53                   	push   %ebx
+  804752:	e8 da cd ff ff       	call   801531 <sys_futex_wait>
+  804757:	89 c6                	mov    %eax,%esi
+  804759:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80475e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804763:	89 3c 24             	mov    %edi,(%esp)
+  804766:	e8 13 ff ff ff       	call   80467e <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  80476b:	83 c4 10             	add    $0x10,%esp
+  80476e:	83 fe ef             	cmp    $0xffffffef,%esi
+  804771:	74 05                	je     804778 <cond_timedwait+0x4f>
+  804773:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804778:	89 f0                	mov    %esi,%eax
+  80477a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80477d:	5b                   	pop    %ebx
+  80477e:	5e                   	pop    %esi
+  80477f:	5f                   	pop    %edi
+  804780:	5d                   	pop    %ebp
+  804781:	c3                   	ret
+
+00804782 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804782:	55                   	push   %ebp
+  804783:	89 e5                	mov    %esp,%ebp
+  804785:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804788:	6a ff                	push   $0xffffffff
+  80478a:	ff 75 0c             	push   0xc(%ebp)
+  80478d:	ff 75 08             	push   0x8(%ebp)
+  804790:	e8 94 ff ff ff       	call   804729 <cond_timedwait>
+}
+  804795:	83 c4 10             	add    $0x10,%esp
+  804798:	c9                   	leave
+  804799:	c3                   	ret
+
+0080479a <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  80479a:	55                   	push   %ebp
+  80479b:	89 e5                	mov    %esp,%ebp
+  80479d:	83 ec 08             	sub    $0x8,%esp
+  8047a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047a3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047a8:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8047ac:	8b 50 04             	mov    0x4(%eax),%edx
+  8047af:	85 d2                	test   %edx,%edx
+  8047b1:	75 02                	jne    8047b5 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8047b3:	c9                   	leave
+  8047b4:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8047b5:	83 ec 08             	sub    $0x8,%esp
+  8047b8:	6a 01                	push   $0x1
+  8047ba:	50                   	push   %eax
+  8047bb:	e8 93 cd ff ff       	call   801553 <sys_futex_wake>
+  8047c0:	83 c4 10             	add    $0x10,%esp
+}
+  8047c3:	eb ee                	jmp    8047b3 <cond_signal+0x19>
+
+008047c5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8047c5:	55                   	push   %ebp
+  8047c6:	89 e5                	mov    %esp,%ebp
+  8047c8:	83 ec 08             	sub    $0x8,%esp
+  8047cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047ce:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047d3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8047d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8047da:	85 d2                	test   %edx,%edx
+  8047dc:	75 02                	jne    8047e0 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  8047de:	c9                   	leave
+  8047df:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  8047e0:	83 ec 08             	sub    $0x8,%esp
+  8047e3:	68 00 04 00 00       	push   $0x400
+  8047e8:	50                   	push   %eax
+  8047e9:	e8 65 cd ff ff       	call   801553 <sys_futex_wake>
+  8047ee:	83 c4 10             	add    $0x10,%esp
+}
+  8047f1:	eb eb                	jmp    8047de <cond_broadcast+0x19>
+
+008047f3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8047f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f8:	c3                   	ret
+
+008047f9 <devcons_poll>:
+{
+  8047f9:	55                   	push   %ebp
+  8047fa:	89 e5                	mov    %esp,%ebp
+  8047fc:	53                   	push   %ebx
+  8047fd:	83 ec 04             	sub    $0x4,%esp
+  804800:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804803:	89 da                	mov    %ebx,%edx
+  804805:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804808:	83 3d 44 8f 80 00 00 	cmpl   $0x0,0x808f44
+  80480f:	74 0c                	je     80481d <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804811:	89 d8                	mov    %ebx,%eax
+  804813:	83 e0 01             	and    $0x1,%eax
+  804816:	09 d0                	or     %edx,%eax
+}
+  804818:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80481b:	c9                   	leave
+  80481c:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80481d:	e8 73 c8 ff ff       	call   801095 <sys_cgetc>
+  804822:	a3 44 8f 80 00       	mov    %eax,0x808f44
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804827:	89 da                	mov    %ebx,%edx
+  804829:	83 e2 04             	and    $0x4,%edx
+  80482c:	85 c0                	test   %eax,%eax
+  80482e:	74 e6                	je     804816 <devcons_poll+0x1d>
+  804830:	eb df                	jmp    804811 <devcons_poll+0x18>
+
+00804832 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804832:	55                   	push   %ebp
+  804833:	89 e5                	mov    %esp,%ebp
+  804835:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804838:	68 91 59 80 00       	push   $0x805991
+  80483d:	ff 75 0c             	push   0xc(%ebp)
+  804840:	e8 ba c4 ff ff       	call   800cff <strcpy>
+	return 0;
+}
+  804845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80484a:	c9                   	leave
+  80484b:	c3                   	ret
+
+0080484c <devcons_write>:
+{
+  80484c:	55                   	push   %ebp
+  80484d:	89 e5                	mov    %esp,%ebp
+  80484f:	57                   	push   %edi
+  804850:	56                   	push   %esi
+  804851:	53                   	push   %ebx
+  804852:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  804858:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80485b:	85 ff                	test   %edi,%edi
+  80485d:	74 51                	je     8048b0 <devcons_write+0x64>
+  80485f:	be 00 00 00 00       	mov    $0x0,%esi
+  804864:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  804869:	89 fb                	mov    %edi,%ebx
+  80486b:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  80486d:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804872:	39 d3                	cmp    %edx,%ebx
+  804874:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804877:	83 ec 04             	sub    $0x4,%esp
+  80487a:	53                   	push   %ebx
+  80487b:	03 45 0c             	add    0xc(%ebp),%eax
+  80487e:	50                   	push   %eax
+  80487f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804885:	50                   	push   %eax
+  804886:	e8 24 c6 ff ff       	call   800eaf <memmove>
+		sys_cputs(buf, m);
+  80488b:	83 c4 08             	add    $0x8,%esp
+  80488e:	53                   	push   %ebx
+  80488f:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  804895:	50                   	push   %eax
+  804896:	e8 dc c7 ff ff       	call   801077 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80489b:	01 de                	add    %ebx,%esi
+  80489d:	89 f0                	mov    %esi,%eax
+  80489f:	83 c4 10             	add    $0x10,%esp
+  8048a2:	39 fe                	cmp    %edi,%esi
+  8048a4:	72 c3                	jb     804869 <devcons_write+0x1d>
+}
+  8048a6:	89 f0                	mov    %esi,%eax
+  8048a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048ab:	5b                   	pop    %ebx
+  8048ac:	5e                   	pop    %esi
+  8048ad:	5f                   	pop    %edi
+  8048ae:	5d                   	pop    %ebp
+  8048af:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8048b0:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8048b5:	eb ef                	jmp    8048a6 <devcons_write+0x5a>
+
+008048b7 <devcons_read>:
+{
+  8048b7:	55                   	push   %ebp
+  8048b8:	89 e5                	mov    %esp,%ebp
+  8048ba:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8048bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8048c2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8048c6:	74 36                	je     8048fe <devcons_read+0x47>
+	c = cons_peek;
+  8048c8:	a1 44 8f 80 00       	mov    0x808f44,%eax
+	cons_peek = 0;
+  8048cd:	c7 05 44 8f 80 00 00 	movl   $0x0,0x808f44
+  8048d4:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8048d7:	85 c0                	test   %eax,%eax
+  8048d9:	75 10                	jne    8048eb <devcons_read+0x34>
+  8048db:	e8 b5 c7 ff ff       	call   801095 <sys_cgetc>
+  8048e0:	85 c0                	test   %eax,%eax
+  8048e2:	75 07                	jne    8048eb <devcons_read+0x34>
+		sys_yield();
+  8048e4:	e8 2b c8 ff ff       	call   801114 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8048e9:	eb f0                	jmp    8048db <devcons_read+0x24>
+	if (c < 0)
+  8048eb:	85 c0                	test   %eax,%eax
+  8048ed:	78 0f                	js     8048fe <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8048ef:	83 f8 04             	cmp    $0x4,%eax
+  8048f2:	74 0c                	je     804900 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8048f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048f7:	88 02                	mov    %al,(%edx)
+	return 1;
+  8048f9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8048fe:	c9                   	leave
+  8048ff:	c3                   	ret
+		return 0;
+  804900:	b8 00 00 00 00       	mov    $0x0,%eax
+  804905:	eb f7                	jmp    8048fe <devcons_read+0x47>
+
+00804907 <cputchar>:
+{
+  804907:	55                   	push   %ebp
+  804908:	89 e5                	mov    %esp,%ebp
+  80490a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80490d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804910:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804913:	6a 01                	push   $0x1
+  804915:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804918:	50                   	push   %eax
+  804919:	e8 59 c7 ff ff       	call   801077 <sys_cputs>
+}
+  80491e:	83 c4 10             	add    $0x10,%esp
+  804921:	c9                   	leave
+  804922:	c3                   	ret
+
+00804923 <getchar>:
+{
+  804923:	55                   	push   %ebp
+  804924:	89 e5                	mov    %esp,%ebp
+  804926:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804929:	6a 01                	push   $0x1
+  80492b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80492e:	50                   	push   %eax
+  80492f:	6a 00                	push   $0x0
+  804931:	e8 d7 d6 ff ff       	call   80200d <read>
+	if (r < 0)
+  804936:	83 c4 10             	add    $0x10,%esp
+  804939:	85 c0                	test   %eax,%eax
+  80493b:	78 06                	js     804943 <getchar+0x20>
+	if (r < 1)
+  80493d:	74 06                	je     804945 <getchar+0x22>
+	return c;
+  80493f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804943:	c9                   	leave
+  804944:	c3                   	ret
+		return -E_EOF;
+  804945:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80494a:	eb f7                	jmp    804943 <getchar+0x20>
+
+0080494c <iscons>:
+{
+  80494c:	55                   	push   %ebp
+  80494d:	89 e5                	mov    %esp,%ebp
+  80494f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804952:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804955:	50                   	push   %eax
+  804956:	ff 75 08             	push   0x8(%ebp)
+  804959:	e8 2b d4 ff ff       	call   801d89 <fd_lookup>
+  80495e:	83 c4 10             	add    $0x10,%esp
+  804961:	85 c0                	test   %eax,%eax
+  804963:	78 11                	js     804976 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804965:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804968:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  80496e:	39 10                	cmp    %edx,(%eax)
+  804970:	0f 94 c0             	sete   %al
+  804973:	0f b6 c0             	movzbl %al,%eax
+}
+  804976:	c9                   	leave
+  804977:	c3                   	ret
+
+00804978 <opencons>:
+{
+  804978:	55                   	push   %ebp
+  804979:	89 e5                	mov    %esp,%ebp
+  80497b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80497e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804981:	50                   	push   %eax
+  804982:	e8 b2 d3 ff ff       	call   801d39 <fd_alloc>
+  804987:	83 c4 10             	add    $0x10,%esp
+  80498a:	85 c0                	test   %eax,%eax
+  80498c:	78 3a                	js     8049c8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80498e:	83 ec 04             	sub    $0x4,%esp
+  804991:	68 07 04 00 00       	push   $0x407
+  804996:	ff 75 f4             	push   -0xc(%ebp)
+  804999:	6a 00                	push   $0x0
+  80499b:	e8 93 c7 ff ff       	call   801133 <sys_page_alloc>
+  8049a0:	83 c4 10             	add    $0x10,%esp
+  8049a3:	85 c0                	test   %eax,%eax
+  8049a5:	78 21                	js     8049c8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8049a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049aa:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  8049b0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8049b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8049b5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8049bc:	83 ec 0c             	sub    $0xc,%esp
+  8049bf:	50                   	push   %eax
+  8049c0:	e8 4d d3 ff ff       	call   801d12 <fd2num>
+  8049c5:	83 c4 10             	add    $0x10,%esp
+}
+  8049c8:	c9                   	leave
+  8049c9:	c3                   	ret
+
+008049ca <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8049ca:	55                   	push   %ebp
+  8049cb:	89 e5                	mov    %esp,%ebp
+  8049cd:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8049d0:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8049d7:	74 0a                	je     8049e3 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8049d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8049dc:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  8049e1:	c9                   	leave
+  8049e2:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8049e3:	83 ec 04             	sub    $0x4,%esp
+  8049e6:	6a 07                	push   $0x7
+  8049e8:	68 00 f0 bf ee       	push   $0xeebff000
+  8049ed:	6a 00                	push   $0x0
+  8049ef:	e8 3f c7 ff ff       	call   801133 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8049f4:	83 c4 08             	add    $0x8,%esp
+  8049f7:	68 08 4a 80 00       	push   $0x804a08
+  8049fc:	6a 00                	push   $0x0
+  8049fe:	e8 7b c8 ff ff       	call   80127e <sys_env_set_pgfault_upcall>
+  804a03:	83 c4 10             	add    $0x10,%esp
+  804a06:	eb d1                	jmp    8049d9 <set_pgfault_handler+0xf>
+
+00804a08 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804a08:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804a09:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  804a0e:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804a10:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804a13:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804a17:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804a1a:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804a1e:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804a20:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804a24:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804a27:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804a28:	83 c4 04             	add    $0x4,%esp
+	popf
+  804a2b:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804a2c:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804a2d:	c3                   	ret
+
+00804a2e <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804a2e:	55                   	push   %ebp
+  804a2f:	89 e5                	mov    %esp,%ebp
+  804a31:	56                   	push   %esi
+  804a32:	53                   	push   %ebx
+  804a33:	8b 75 08             	mov    0x8(%ebp),%esi
+  804a36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804a3c:	85 c0                	test   %eax,%eax
+  804a3e:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804a43:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804a46:	83 ec 0c             	sub    $0xc,%esp
+  804a49:	50                   	push   %eax
+  804a4a:	e8 94 c8 ff ff       	call   8012e3 <sys_ipc_recv>
+  804a4f:	83 c4 10             	add    $0x10,%esp
+  804a52:	85 c0                	test   %eax,%eax
+  804a54:	0f 88 8b 00 00 00    	js     804ae5 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804a5a:	85 f6                	test   %esi,%esi
+  804a5c:	74 2a                	je     804a88 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804a5e:	89 e2                	mov    %esp,%edx
+  804a60:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804a65:	29 d0                	sub    %edx,%eax
+  804a67:	89 c2                	mov    %eax,%edx
+  804a69:	c1 ea 0f             	shr    $0xf,%edx
+  804a6c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a76:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804a79:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804a80:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a86:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804a88:	85 db                	test   %ebx,%ebx
+  804a8a:	74 2a                	je     804ab6 <ipc_recv+0x88>
+  804a8c:	89 e2                	mov    %esp,%edx
+  804a8e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804a93:	29 d0                	sub    %edx,%eax
+  804a95:	89 c2                	mov    %eax,%edx
+  804a97:	c1 ea 0f             	shr    $0xf,%edx
+  804a9a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aa4:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804aa7:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804aae:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804ab4:	89 03                	mov    %eax,(%ebx)
+  804ab6:	89 e2                	mov    %esp,%edx
+  804ab8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804abd:	29 d0                	sub    %edx,%eax
+  804abf:	89 c2                	mov    %eax,%edx
+  804ac1:	c1 ea 0f             	shr    $0xf,%edx
+  804ac4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ace:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804ad1:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804ad8:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804ade:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804ae1:	5b                   	pop    %ebx
+  804ae2:	5e                   	pop    %esi
+  804ae3:	5d                   	pop    %ebp
+  804ae4:	c3                   	ret
+		if(from_env_store != NULL)
+  804ae5:	85 f6                	test   %esi,%esi
+  804ae7:	74 06                	je     804aef <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804ae9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804aef:	85 db                	test   %ebx,%ebx
+  804af1:	74 eb                	je     804ade <ipc_recv+0xb0>
+			*perm_store = 0;
+  804af3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804af9:	eb e3                	jmp    804ade <ipc_recv+0xb0>
+
+00804afb <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804afb:	55                   	push   %ebp
+  804afc:	89 e5                	mov    %esp,%ebp
+  804afe:	57                   	push   %edi
+  804aff:	56                   	push   %esi
+  804b00:	53                   	push   %ebx
+  804b01:	83 ec 14             	sub    $0x14,%esp
+  804b04:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804b07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804b0a:	8b 75 14             	mov    0x14(%ebp),%esi
+  804b0d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804b10:	85 c0                	test   %eax,%eax
+  804b12:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804b17:	0f 44 c2             	cmove  %edx,%eax
+  804b1a:	ff 75 10             	push   0x10(%ebp)
+  804b1d:	50                   	push   %eax
+  804b1e:	e8 22 c8 ff ff       	call   801345 <sys_ipc_recv_pages>
+  804b23:	83 c4 10             	add    $0x10,%esp
+  804b26:	85 c0                	test   %eax,%eax
+  804b28:	0f 88 ba 00 00 00    	js     804be8 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804b2e:	85 ff                	test   %edi,%edi
+  804b30:	74 2a                	je     804b5c <ipc_recv_pages+0x61>
+  804b32:	89 e2                	mov    %esp,%edx
+  804b34:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b39:	29 d0                	sub    %edx,%eax
+  804b3b:	89 c2                	mov    %eax,%edx
+  804b3d:	c1 ea 0f             	shr    $0xf,%edx
+  804b40:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b45:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b4a:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804b4d:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804b54:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b5a:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804b5c:	85 f6                	test   %esi,%esi
+  804b5e:	74 2a                	je     804b8a <ipc_recv_pages+0x8f>
+  804b60:	89 e2                	mov    %esp,%edx
+  804b62:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b67:	29 d0                	sub    %edx,%eax
+  804b69:	89 c2                	mov    %eax,%edx
+  804b6b:	c1 ea 0f             	shr    $0xf,%edx
+  804b6e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b78:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804b7b:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804b82:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b88:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804b8a:	85 db                	test   %ebx,%ebx
+  804b8c:	74 2a                	je     804bb8 <ipc_recv_pages+0xbd>
+  804b8e:	89 e2                	mov    %esp,%edx
+  804b90:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b95:	29 d0                	sub    %edx,%eax
+  804b97:	89 c2                	mov    %eax,%edx
+  804b99:	c1 ea 0f             	shr    $0xf,%edx
+  804b9c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba6:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804ba9:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804bb0:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804bb6:	89 03                	mov    %eax,(%ebx)
+  804bb8:	89 e2                	mov    %esp,%edx
+  804bba:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804bbf:	29 d0                	sub    %edx,%eax
+  804bc1:	89 c2                	mov    %eax,%edx
+  804bc3:	c1 ea 0f             	shr    $0xf,%edx
+  804bc6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bd0:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804bd3:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804bda:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804be3:	5b                   	pop    %ebx
+  804be4:	5e                   	pop    %esi
+  804be5:	5f                   	pop    %edi
+  804be6:	5d                   	pop    %ebp
+  804be7:	c3                   	ret
+		if (from_env_store)
+  804be8:	85 ff                	test   %edi,%edi
+  804bea:	74 06                	je     804bf2 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804bec:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804bf2:	85 f6                	test   %esi,%esi
+  804bf4:	74 06                	je     804bfc <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804bf6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804bfc:	85 db                	test   %ebx,%ebx
+  804bfe:	74 e0                	je     804be0 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804c00:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804c06:	eb d8                	jmp    804be0 <ipc_recv_pages+0xe5>
+
+00804c08 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804c08:	55                   	push   %ebp
+  804c09:	89 e5                	mov    %esp,%ebp
+  804c0b:	57                   	push   %edi
+  804c0c:	56                   	push   %esi
+  804c0d:	53                   	push   %ebx
+  804c0e:	83 ec 1c             	sub    $0x1c,%esp
+  804c11:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804c14:	8b 75 08             	mov    0x8(%ebp),%esi
+  804c17:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804c1d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804c21:	75 2b                	jne    804c4e <ipc_try_send_pages+0x46>
+  804c23:	89 e2                	mov    %esp,%edx
+  804c25:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c2a:	29 d0                	sub    %edx,%eax
+  804c2c:	89 c2                	mov    %eax,%edx
+  804c2e:	c1 ea 0f             	shr    $0xf,%edx
+  804c31:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3b:	0f 42 c2             	cmovb  %edx,%eax
+  804c3e:	8b 04 85 60 8f 80 00 	mov    0x808f60(,%eax,4),%eax
+  804c45:	8b 70 48             	mov    0x48(%eax),%esi
+  804c48:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804c4e:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804c54:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804c59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804c5c:	85 ff                	test   %edi,%edi
+  804c5e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804c63:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804c66:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804c6c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804c72:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804c78:	83 ec 0c             	sub    $0xc,%esp
+  804c7b:	ff 75 14             	push   0x14(%ebp)
+  804c7e:	ff 75 18             	push   0x18(%ebp)
+  804c81:	57                   	push   %edi
+  804c82:	ff 75 0c             	push   0xc(%ebp)
+  804c85:	ff 75 08             	push   0x8(%ebp)
+  804c88:	e8 97 c6 ff ff       	call   801324 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804c8d:	83 c4 20             	add    $0x20,%esp
+  804c90:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804c93:	75 21                	jne    804cb6 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804c95:	83 ec 04             	sub    $0x4,%esp
+  804c98:	6a ff                	push   $0xffffffff
+  804c9a:	53                   	push   %ebx
+  804c9b:	ff 75 e4             	push   -0x1c(%ebp)
+  804c9e:	e8 8e c8 ff ff       	call   801531 <sys_futex_wait>
+  804ca3:	83 c4 10             	add    $0x10,%esp
+  804ca6:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804ca9:	74 c7                	je     804c72 <ipc_try_send_pages+0x6a>
+  804cab:	85 c0                	test   %eax,%eax
+  804cad:	79 c3                	jns    804c72 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804caf:	e8 60 c4 ff ff       	call   801114 <sys_yield>
+  804cb4:	eb bc                	jmp    804c72 <ipc_try_send_pages+0x6a>
+	}
+}
+  804cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cb9:	5b                   	pop    %ebx
+  804cba:	5e                   	pop    %esi
+  804cbb:	5f                   	pop    %edi
+  804cbc:	5d                   	pop    %ebp
+  804cbd:	c3                   	ret
+
+00804cbe <ipc_send>:
+{
+  804cbe:	55                   	push   %ebp
+  804cbf:	89 e5                	mov    %esp,%ebp
+  804cc1:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804cc4:	ff 75 14             	push   0x14(%ebp)
+  804cc7:	6a 01                	push   $0x1
+  804cc9:	ff 75 10             	push   0x10(%ebp)
+  804ccc:	ff 75 0c             	push   0xc(%ebp)
+  804ccf:	ff 75 08             	push   0x8(%ebp)
+  804cd2:	e8 31 ff ff ff       	call   804c08 <ipc_try_send_pages>
+  804cd7:	83 c4 20             	add    $0x20,%esp
+  804cda:	85 c0                	test   %eax,%eax
+  804cdc:	78 02                	js     804ce0 <ipc_send+0x22>
+}
+  804cde:	c9                   	leave
+  804cdf:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804ce0:	50                   	push   %eax
+  804ce1:	68 9d 59 80 00       	push   $0x80599d
+  804ce6:	6a 3f                	push   $0x3f
+  804ce8:	68 b2 59 80 00       	push   $0x8059b2
+  804ced:	e8 3b b8 ff ff       	call   80052d <_panic>
+
+00804cf2 <ipc_send_pages>:
+{
+  804cf2:	55                   	push   %ebp
+  804cf3:	89 e5                	mov    %esp,%ebp
+  804cf5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804cf8:	ff 75 18             	push   0x18(%ebp)
+  804cfb:	ff 75 14             	push   0x14(%ebp)
+  804cfe:	ff 75 10             	push   0x10(%ebp)
+  804d01:	ff 75 0c             	push   0xc(%ebp)
+  804d04:	ff 75 08             	push   0x8(%ebp)
+  804d07:	e8 fc fe ff ff       	call   804c08 <ipc_try_send_pages>
+  804d0c:	83 c4 20             	add    $0x20,%esp
+  804d0f:	85 c0                	test   %eax,%eax
+  804d11:	78 02                	js     804d15 <ipc_send_pages+0x23>
+}
+  804d13:	c9                   	leave
+  804d14:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804d15:	50                   	push   %eax
+  804d16:	68 bc 59 80 00       	push   $0x8059bc
+  804d1b:	6a 64                	push   $0x64
+  804d1d:	68 b2 59 80 00       	push   $0x8059b2
+  804d22:	e8 06 b8 ff ff       	call   80052d <_panic>
+
+00804d27 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804d27:	55                   	push   %ebp
+  804d28:	89 e5                	mov    %esp,%ebp
+  804d2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804d32:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804d38:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804d3e:	8b 52 50             	mov    0x50(%edx),%edx
+  804d41:	39 ca                	cmp    %ecx,%edx
+  804d43:	74 11                	je     804d56 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804d45:	83 c0 01             	add    $0x1,%eax
+  804d48:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804d4d:	75 e3                	jne    804d32 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d54:	eb 0e                	jmp    804d64 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804d56:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804d5c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804d61:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804d64:	5d                   	pop    %ebp
+  804d65:	c3                   	ret
+
+00804d66 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804d66:	55                   	push   %ebp
+  804d67:	89 e5                	mov    %esp,%ebp
+  804d69:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804d6c:	89 c2                	mov    %eax,%edx
+  804d6e:	c1 ea 16             	shr    $0x16,%edx
+  804d71:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804d78:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804d7d:	f6 c1 01             	test   $0x1,%cl
+  804d80:	74 1e                	je     804da0 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804d82:	c1 e8 0c             	shr    $0xc,%eax
+  804d85:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804d8c:	a8 01                	test   $0x1,%al
+  804d8e:	74 10                	je     804da0 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804d90:	c1 e8 0c             	shr    $0xc,%eax
+  804d93:	c1 e0 04             	shl    $0x4,%eax
+  804d96:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804d9d:	0f b7 d2             	movzwl %dx,%edx
+}
+  804da0:	89 d0                	mov    %edx,%eax
+  804da2:	5d                   	pop    %ebp
+  804da3:	c3                   	ret
+
+00804da4 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  804da4:	55                   	push   %ebp
+  804da5:	89 e5                	mov    %esp,%ebp
+  804da7:	57                   	push   %edi
+  804da8:	56                   	push   %esi
+  804da9:	53                   	push   %ebx
+  804daa:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  804dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  804db0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  804db3:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  804db6:	bf 48 8f 80 00       	mov    $0x808f48,%edi
+  804dbb:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  804dbe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804dc3:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  804dc6:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  804dc9:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  804dce:	f6 e2                	mul    %dl
+  804dd0:	66 c1 e8 0b          	shr    $0xb,%ax
+  804dd4:	89 c7                	mov    %eax,%edi
+  804dd6:	88 45 e0             	mov    %al,-0x20(%ebp)
+  804dd9:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  804ddc:	01 db                	add    %ebx,%ebx
+  804dde:	89 d0                	mov    %edx,%eax
+  804de0:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  804de2:	89 d6                	mov    %edx,%esi
+  804de4:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  804de6:	89 cb                	mov    %ecx,%ebx
+  804de8:	83 c1 01             	add    $0x1,%ecx
+  804deb:	0f b6 fb             	movzbl %bl,%edi
+  804dee:	83 c0 30             	add    $0x30,%eax
+  804df1:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  804df5:	89 f0                	mov    %esi,%eax
+  804df7:	3c 09                	cmp    $0x9,%al
+  804df9:	77 ce                	ja     804dc9 <inet_ntoa+0x25>
+  804dfb:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804dfe:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  804e01:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  804e03:	84 c9                	test   %cl,%cl
+  804e05:	74 4d                	je     804e54 <inet_ntoa+0xb0>
+  804e07:	0f b6 db             	movzbl %bl,%ebx
+  804e0a:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  804e0d:	01 d8                	add    %ebx,%eax
+  804e0f:	89 f9                	mov    %edi,%ecx
+  804e11:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  804e14:	83 c1 01             	add    $0x1,%ecx
+  804e17:	0f b6 10             	movzbl (%eax),%edx
+  804e1a:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  804e1d:	89 c2                	mov    %eax,%edx
+  804e1f:	83 e8 01             	sub    $0x1,%eax
+  804e22:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  804e25:	39 da                	cmp    %ebx,%edx
+  804e27:	75 eb                	jne    804e14 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  804e29:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804e2c:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  804e30:	8d 78 01             	lea    0x1(%eax),%edi
+  804e33:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  804e36:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  804e39:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  804e3c:	39 ce                	cmp    %ecx,%esi
+  804e3e:	0f 85 77 ff ff ff    	jne    804dbb <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  804e44:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  804e47:	b8 48 8f 80 00       	mov    $0x808f48,%eax
+  804e4c:	83 c4 1c             	add    $0x1c,%esp
+  804e4f:	5b                   	pop    %ebx
+  804e50:	5e                   	pop    %esi
+  804e51:	5f                   	pop    %edi
+  804e52:	5d                   	pop    %ebp
+  804e53:	c3                   	ret
+    while(i--)
+  804e54:	89 f8                	mov    %edi,%eax
+  804e56:	eb d8                	jmp    804e30 <inet_ntoa+0x8c>
+
+00804e58 <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  804e58:	55                   	push   %ebp
+  804e59:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804e5b:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  804e5f:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  804e63:	5d                   	pop    %ebp
+  804e64:	c3                   	ret
+
+00804e65 <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  804e65:	55                   	push   %ebp
+  804e66:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  804e68:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  804e6c:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  804e70:	5d                   	pop    %ebp
+  804e71:	c3                   	ret
+
+00804e72 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  804e72:	55                   	push   %ebp
+  804e73:	89 e5                	mov    %esp,%ebp
+  804e75:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  804e78:	89 d0                	mov    %edx,%eax
+  804e7a:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  804e7d:	89 d1                	mov    %edx,%ecx
+  804e7f:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804e82:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  804e84:	89 d1                	mov    %edx,%ecx
+  804e86:	c1 e1 08             	shl    $0x8,%ecx
+  804e89:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  804e8f:	09 c8                	or     %ecx,%eax
+  804e91:	c1 ea 08             	shr    $0x8,%edx
+  804e94:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  804e9a:	09 d0                	or     %edx,%eax
+}
+  804e9c:	5d                   	pop    %ebp
+  804e9d:	c3                   	ret
+
+00804e9e <inet_aton>:
+{
+  804e9e:	55                   	push   %ebp
+  804e9f:	89 e5                	mov    %esp,%ebp
+  804ea1:	57                   	push   %edi
+  804ea2:	56                   	push   %esi
+  804ea3:	53                   	push   %ebx
+  804ea4:	83 ec 2c             	sub    $0x2c,%esp
+  804ea7:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  804eaa:	0f b6 0a             	movzbl (%edx),%ecx
+  804ead:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  804eb0:	83 e9 30             	sub    $0x30,%ecx
+  804eb3:	80 f9 09             	cmp    $0x9,%cl
+  804eb6:	0f 87 b6 01 00 00    	ja     805072 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  804ebc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  804ebf:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  804ec2:	e9 aa 00 00 00       	jmp    804f71 <inet_aton+0xd3>
+      c = *++cp;
+  804ec7:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  804ecb:	89 c1                	mov    %eax,%ecx
+  804ecd:	83 e1 df             	and    $0xffffffdf,%ecx
+  804ed0:	80 f9 58             	cmp    $0x58,%cl
+  804ed3:	74 10                	je     804ee5 <inet_aton+0x47>
+      c = *++cp;
+  804ed5:	83 c2 01             	add    $0x1,%edx
+  804ed8:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  804edb:	bf 08 00 00 00       	mov    $0x8,%edi
+  804ee0:	e9 9a 00 00 00       	jmp    804f7f <inet_aton+0xe1>
+        c = *++cp;
+  804ee5:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  804ee9:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  804eec:	bf 10 00 00 00       	mov    $0x10,%edi
+  804ef1:	e9 89 00 00 00       	jmp    804f7f <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  804ef6:	0f af d7             	imul   %edi,%edx
+  804ef9:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  804efd:	0f be 01             	movsbl (%ecx),%eax
+  804f00:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  804f03:	88 45 d7             	mov    %al,-0x29(%ebp)
+  804f06:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  804f09:	80 fb 09             	cmp    $0x9,%bl
+  804f0c:	76 e8                	jbe    804ef6 <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  804f0e:	83 ff 10             	cmp    $0x10,%edi
+  804f11:	75 2e                	jne    804f41 <inet_aton+0xa3>
+  804f13:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  804f17:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  804f1a:	83 e3 df             	and    $0xffffffdf,%ebx
+  804f1d:	83 eb 41             	sub    $0x41,%ebx
+  804f20:	80 fb 05             	cmp    $0x5,%bl
+  804f23:	77 1c                	ja     804f41 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  804f25:	c1 e2 04             	shl    $0x4,%edx
+  804f28:	83 c0 0a             	add    $0xa,%eax
+  804f2b:	89 f3                	mov    %esi,%ebx
+  804f2d:	80 fb 1a             	cmp    $0x1a,%bl
+  804f30:	19 db                	sbb    %ebx,%ebx
+  804f32:	83 e3 20             	and    $0x20,%ebx
+  804f35:	83 c3 41             	add    $0x41,%ebx
+  804f38:	29 d8                	sub    %ebx,%eax
+  804f3a:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  804f3c:	0f be 01             	movsbl (%ecx),%eax
+  804f3f:	eb bf                	jmp    804f00 <inet_aton+0x62>
+    if (c == '.') {
+  804f41:	83 f8 2e             	cmp    $0x2e,%eax
+  804f44:	75 46                	jne    804f8c <inet_aton+0xee>
+      if (pp >= parts + 3)
+  804f46:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  804f49:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  804f4c:	39 f0                	cmp    %esi,%eax
+  804f4e:	0f 84 25 01 00 00    	je     805079 <inet_aton+0x1db>
+      *pp++ = val;
+  804f54:	83 c0 04             	add    $0x4,%eax
+  804f57:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  804f5a:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  804f5d:	89 ca                	mov    %ecx,%edx
+  804f5f:	0f b6 09             	movzbl (%ecx),%ecx
+  804f62:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  804f65:	83 e9 30             	sub    $0x30,%ecx
+  804f68:	80 f9 09             	cmp    $0x9,%cl
+  804f6b:	0f 87 17 01 00 00    	ja     805088 <inet_aton+0x1ea>
+    base = 10;
+  804f71:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  804f76:	83 f8 30             	cmp    $0x30,%eax
+  804f79:	0f 84 48 ff ff ff    	je     804ec7 <inet_aton+0x29>
+  804f7f:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  804f82:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f87:	e9 77 ff ff ff       	jmp    804f03 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804f8c:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  804f90:	89 d6                	mov    %edx,%esi
+  804f92:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  804f95:	85 c0                	test   %eax,%eax
+  804f97:	74 2e                	je     804fc7 <inet_aton+0x129>
+    return (0);
+  804f99:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804f9e:	89 fa                	mov    %edi,%edx
+  804fa0:	80 fa 1f             	cmp    $0x1f,%dl
+  804fa3:	0f 86 d5 00 00 00    	jbe    80507e <inet_aton+0x1e0>
+  804fa9:	84 c0                	test   %al,%al
+  804fab:	0f 88 cd 00 00 00    	js     80507e <inet_aton+0x1e0>
+  804fb1:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  804fb4:	83 f9 04             	cmp    $0x4,%ecx
+  804fb7:	76 0e                	jbe    804fc7 <inet_aton+0x129>
+    return (0);
+  804fb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  804fbe:	83 f8 20             	cmp    $0x20,%eax
+  804fc1:	0f 85 b7 00 00 00    	jne    80507e <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  804fc7:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  804fca:	89 d8                	mov    %ebx,%eax
+  804fcc:	29 c8                	sub    %ecx,%eax
+  804fce:	c1 f8 02             	sar    $0x2,%eax
+  804fd1:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  804fd4:	83 f8 02             	cmp    $0x2,%eax
+  804fd7:	74 7a                	je     805053 <inet_aton+0x1b5>
+  804fd9:	83 f9 03             	cmp    $0x3,%ecx
+  804fdc:	7f 49                	jg     805027 <inet_aton+0x189>
+  804fde:	85 c9                	test   %ecx,%ecx
+  804fe0:	0f 84 98 00 00 00    	je     80507e <inet_aton+0x1e0>
+  804fe6:	83 f9 02             	cmp    $0x2,%ecx
+  804fe9:	75 19                	jne    805004 <inet_aton+0x166>
+      return (0);
+  804feb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  804ff0:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  804ff6:	0f 87 82 00 00 00    	ja     80507e <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  804ffc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  804fff:	c1 e0 18             	shl    $0x18,%eax
+  805002:	09 c6                	or     %eax,%esi
+  return (1);
+  805004:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  805009:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80500d:	74 6f                	je     80507e <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  80500f:	83 ec 0c             	sub    $0xc,%esp
+  805012:	56                   	push   %esi
+  805013:	e8 5a fe ff ff       	call   804e72 <htonl>
+  805018:	83 c4 10             	add    $0x10,%esp
+  80501b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80501e:	89 06                	mov    %eax,(%esi)
+  return (1);
+  805020:	b9 01 00 00 00       	mov    $0x1,%ecx
+  805025:	eb 57                	jmp    80507e <inet_aton+0x1e0>
+  switch (n) {
+  805027:	83 f9 04             	cmp    $0x4,%ecx
+  80502a:	75 d8                	jne    805004 <inet_aton+0x166>
+      return (0);
+  80502c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  805031:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  805037:	77 45                	ja     80507e <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  805039:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80503c:	c1 e0 18             	shl    $0x18,%eax
+  80503f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  805042:	c1 e1 10             	shl    $0x10,%ecx
+  805045:	09 c8                	or     %ecx,%eax
+  805047:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80504a:	c1 e1 08             	shl    $0x8,%ecx
+  80504d:	09 c8                	or     %ecx,%eax
+  80504f:	09 c6                	or     %eax,%esi
+    break;
+  805051:	eb b1                	jmp    805004 <inet_aton+0x166>
+      return (0);
+  805053:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  805058:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  80505e:	77 1e                	ja     80507e <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  805060:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  805063:	c1 e0 18             	shl    $0x18,%eax
+  805066:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  805069:	c1 e1 10             	shl    $0x10,%ecx
+  80506c:	09 c8                	or     %ecx,%eax
+  80506e:	09 c6                	or     %eax,%esi
+    break;
+  805070:	eb 92                	jmp    805004 <inet_aton+0x166>
+      return (0);
+  805072:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805077:	eb 05                	jmp    80507e <inet_aton+0x1e0>
+        return (0);
+  805079:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  80507e:	89 c8                	mov    %ecx,%eax
+  805080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805083:	5b                   	pop    %ebx
+  805084:	5e                   	pop    %esi
+  805085:	5f                   	pop    %edi
+  805086:	5d                   	pop    %ebp
+  805087:	c3                   	ret
+      return (0);
+  805088:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80508d:	eb ef                	jmp    80507e <inet_aton+0x1e0>
+
+0080508f <inet_addr>:
+{
+  80508f:	55                   	push   %ebp
+  805090:	89 e5                	mov    %esp,%ebp
+  805092:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  805095:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805098:	50                   	push   %eax
+  805099:	ff 75 08             	push   0x8(%ebp)
+  80509c:	e8 fd fd ff ff       	call   804e9e <inet_aton>
+  8050a1:	89 c2                	mov    %eax,%edx
+  8050a3:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  8050a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  8050ab:	85 d2                	test   %edx,%edx
+  8050ad:	75 02                	jne    8050b1 <inet_addr+0x22>
+}
+  8050af:	c9                   	leave
+  8050b0:	c3                   	ret
+    return (val.s_addr);
+  8050b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8050b4:	eb f9                	jmp    8050af <inet_addr+0x20>
+
+008050b6 <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  8050b6:	55                   	push   %ebp
+  8050b7:	89 e5                	mov    %esp,%ebp
+  8050b9:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  8050bc:	ff 75 08             	push   0x8(%ebp)
+  8050bf:	e8 ae fd ff ff       	call   804e72 <htonl>
+  8050c4:	83 c4 10             	add    $0x10,%esp
+}
+  8050c7:	c9                   	leave
+  8050c8:	c3                   	ret
+
+008050c9 <__udivdi3>:
+  8050c9:	57                   	push   %edi
+  8050ca:	56                   	push   %esi
+  8050cb:	53                   	push   %ebx
+  8050cc:	83 ec 20             	sub    $0x20,%esp
+  8050cf:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8050d3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8050d7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8050db:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8050df:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8050e3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8050e7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8050eb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8050ef:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8050f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050fe:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805105:	00 
+  805106:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80510d:	00 
+  80510e:	eb 08                	jmp    805118 <__udivdi3+0x4f>
+  805110:	83 e9 01             	sub    $0x1,%ecx
+  805113:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805116:	74 68                	je     805180 <__udivdi3+0xb7>
+  805118:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80511c:	01 c0                	add    %eax,%eax
+  80511e:	89 c6                	mov    %eax,%esi
+  805120:	89 d7                	mov    %edx,%edi
+  805122:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805126:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80512a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80512d:	d3 ea                	shr    %cl,%edx
+  80512f:	f6 c1 20             	test   $0x20,%cl
+  805132:	74 04                	je     805138 <__udivdi3+0x6f>
+  805134:	89 d0                	mov    %edx,%eax
+  805136:	31 d2                	xor    %edx,%edx
+  805138:	83 e0 01             	and    $0x1,%eax
+  80513b:	89 04 24             	mov    %eax,(%esp)
+  80513e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805145:	00 
+  805146:	8b 04 24             	mov    (%esp),%eax
+  805149:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80514d:	09 f0                	or     %esi,%eax
+  80514f:	09 fa                	or     %edi,%edx
+  805151:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805155:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805159:	39 f0                	cmp    %esi,%eax
+  80515b:	89 d3                	mov    %edx,%ebx
+  80515d:	19 fb                	sbb    %edi,%ebx
+  80515f:	72 af                	jb     805110 <__udivdi3+0x47>
+  805161:	29 f0                	sub    %esi,%eax
+  805163:	19 fa                	sbb    %edi,%edx
+  805165:	89 cf                	mov    %ecx,%edi
+  805167:	c1 ef 05             	shr    $0x5,%edi
+  80516a:	83 e7 01             	and    $0x1,%edi
+  80516d:	89 fe                	mov    %edi,%esi
+  80516f:	83 f6 01             	xor    $0x1,%esi
+  805172:	d3 e6                	shl    %cl,%esi
+  805174:	d3 e7                	shl    %cl,%edi
+  805176:	09 74 24 18          	or     %esi,0x18(%esp)
+  80517a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80517e:	eb 90                	jmp    805110 <__udivdi3+0x47>
+  805180:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805184:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805188:	83 c4 20             	add    $0x20,%esp
+  80518b:	5b                   	pop    %ebx
+  80518c:	5e                   	pop    %esi
+  80518d:	5f                   	pop    %edi
+  80518e:	c3                   	ret
+
+0080518f <__umoddi3>:
+  80518f:	57                   	push   %edi
+  805190:	56                   	push   %esi
+  805191:	53                   	push   %ebx
+  805192:	83 ec 08             	sub    $0x8,%esp
+  805195:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805199:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80519d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8051a1:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8051a5:	57                   	push   %edi
+  8051a6:	56                   	push   %esi
+  8051a7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051ab:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8051af:	52                   	push   %edx
+  8051b0:	50                   	push   %eax
+  8051b1:	e8 13 ff ff ff       	call   8050c9 <__udivdi3>
+  8051b6:	89 c3                	mov    %eax,%ebx
+  8051b8:	0f af d6             	imul   %esi,%edx
+  8051bb:	89 f9                	mov    %edi,%ecx
+  8051bd:	0f af cb             	imul   %ebx,%ecx
+  8051c0:	01 d1                	add    %edx,%ecx
+  8051c2:	89 d8                	mov    %ebx,%eax
+  8051c4:	f7 e6                	mul    %esi
+  8051c6:	89 c6                	mov    %eax,%esi
+  8051c8:	89 d7                	mov    %edx,%edi
+  8051ca:	01 cf                	add    %ecx,%edi
+  8051cc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8051d0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8051d4:	29 f0                	sub    %esi,%eax
+  8051d6:	19 fa                	sbb    %edi,%edx
+  8051d8:	83 c4 18             	add    $0x18,%esp
+  8051db:	5b                   	pop    %ebx
+  8051dc:	5e                   	pop    %esi
+  8051dd:	5f                   	pop    %edi
+  8051de:	c3                   	ret
+
+008051df <__divdi3>:
+  8051df:	53                   	push   %ebx
+  8051e0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8051e4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8051e8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8051ec:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8051f0:	85 d2                	test   %edx,%edx
+  8051f2:	78 12                	js     805206 <__divdi3+0x27>
+  8051f4:	85 db                	test   %ebx,%ebx
+  8051f6:	78 2e                	js     805226 <__divdi3+0x47>
+  8051f8:	53                   	push   %ebx
+  8051f9:	51                   	push   %ecx
+  8051fa:	52                   	push   %edx
+  8051fb:	50                   	push   %eax
+  8051fc:	e8 c8 fe ff ff       	call   8050c9 <__udivdi3>
+  805201:	83 c4 10             	add    $0x10,%esp
+  805204:	eb 1e                	jmp    805224 <__divdi3+0x45>
+  805206:	f7 d8                	neg    %eax
+  805208:	83 d2 00             	adc    $0x0,%edx
+  80520b:	f7 da                	neg    %edx
+  80520d:	85 db                	test   %ebx,%ebx
+  80520f:	78 2a                	js     80523b <__divdi3+0x5c>
+  805211:	53                   	push   %ebx
+  805212:	51                   	push   %ecx
+  805213:	52                   	push   %edx
+  805214:	50                   	push   %eax
+  805215:	e8 af fe ff ff       	call   8050c9 <__udivdi3>
+  80521a:	83 c4 10             	add    $0x10,%esp
+  80521d:	f7 d8                	neg    %eax
+  80521f:	83 d2 00             	adc    $0x0,%edx
+  805222:	f7 da                	neg    %edx
+  805224:	5b                   	pop    %ebx
+  805225:	c3                   	ret
+  805226:	f7 d9                	neg    %ecx
+  805228:	83 d3 00             	adc    $0x0,%ebx
+  80522b:	f7 db                	neg    %ebx
+  80522d:	53                   	push   %ebx
+  80522e:	51                   	push   %ecx
+  80522f:	52                   	push   %edx
+  805230:	50                   	push   %eax
+  805231:	e8 93 fe ff ff       	call   8050c9 <__udivdi3>
+  805236:	83 c4 10             	add    $0x10,%esp
+  805239:	eb e2                	jmp    80521d <__divdi3+0x3e>
+  80523b:	f7 d9                	neg    %ecx
+  80523d:	83 d3 00             	adc    $0x0,%ebx
+  805240:	f7 db                	neg    %ebx
+  805242:	53                   	push   %ebx
+  805243:	51                   	push   %ecx
+  805244:	52                   	push   %edx
+  805245:	50                   	push   %eax
+  805246:	e8 7e fe ff ff       	call   8050c9 <__udivdi3>
+  80524b:	83 c4 10             	add    $0x10,%esp
+  80524e:	eb d4                	jmp    805224 <__divdi3+0x45>
+
+00805250 <__moddi3>:
+  805250:	57                   	push   %edi
+  805251:	56                   	push   %esi
+  805252:	53                   	push   %ebx
+  805253:	83 ec 08             	sub    $0x8,%esp
+  805256:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80525a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80525e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805262:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  805266:	57                   	push   %edi
+  805267:	56                   	push   %esi
+  805268:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80526c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805270:	52                   	push   %edx
+  805271:	50                   	push   %eax
+  805272:	e8 68 ff ff ff       	call   8051df <__divdi3>
+  805277:	89 c3                	mov    %eax,%ebx
+  805279:	0f af d6             	imul   %esi,%edx
+  80527c:	89 f9                	mov    %edi,%ecx
+  80527e:	0f af cb             	imul   %ebx,%ecx
+  805281:	01 d1                	add    %edx,%ecx
+  805283:	89 d8                	mov    %ebx,%eax
+  805285:	f7 e6                	mul    %esi
+  805287:	89 c6                	mov    %eax,%esi
+  805289:	89 d7                	mov    %edx,%edi
+  80528b:	01 cf                	add    %ecx,%edi
+  80528d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805291:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805295:	29 f0                	sub    %esi,%eax
+  805297:	19 fa                	sbb    %edi,%edx
+  805299:	83 c4 18             	add    $0x18,%esp
+  80529c:	5b                   	pop    %ebx
+  80529d:	5e                   	pop    %esi
+  80529e:	5f                   	pop    %edi
+  80529f:	c3                   	ret
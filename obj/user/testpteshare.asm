@@ -0,0 +1,9930 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 65 01 00 00       	call   800196 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  80003b:	ff 35 00 60 80 00    	push   0x806000
+  800041:	68 00 00 00 a0       	push   $0xa0000000
+  800046:	e8 c4 09 00 00       	call   800a0f <strcpy>
+	exit();
+  80004b:	e8 d3 01 00 00       	call   800223 <exit>
+}
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	c9                   	leave
+  800054:	c3                   	ret
+
+00800055 <umain>:
+{
+  800055:	55                   	push   %ebp
+  800056:	89 e5                	mov    %esp,%ebp
+  800058:	53                   	push   %ebx
+  800059:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800060:	0f 85 d0 00 00 00    	jne    800136 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800066:	83 ec 04             	sub    $0x4,%esp
+  800069:	68 07 04 00 00       	push   $0x407
+  80006e:	68 00 00 00 a0       	push   $0xa0000000
+  800073:	6a 00                	push   $0x0
+  800075:	e8 c9 0d 00 00       	call   800e43 <sys_page_alloc>
+  80007a:	83 c4 10             	add    $0x10,%esp
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	0f 88 bb 00 00 00    	js     800140 <umain+0xeb>
+	if ((r = fork()) < 0)
+  800085:	e8 c1 13 00 00       	call   80144b <fork>
+  80008a:	89 c3                	mov    %eax,%ebx
+  80008c:	85 c0                	test   %eax,%eax
+  80008e:	0f 88 be 00 00 00    	js     800152 <umain+0xfd>
+	if (r == 0) {
+  800094:	0f 84 ca 00 00 00    	je     800164 <umain+0x10f>
+	wait(r);
+  80009a:	83 ec 0c             	sub    $0xc,%esp
+  80009d:	53                   	push   %ebx
+  80009e:	e8 da 42 00 00       	call   80437d <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a3:	83 c4 08             	add    $0x8,%esp
+  8000a6:	ff 35 04 60 80 00    	push   0x806004
+  8000ac:	68 00 00 00 a0       	push   $0xa0000000
+  8000b1:	e8 09 0a 00 00       	call   800abf <strcmp>
+  8000b6:	83 c4 08             	add    $0x8,%esp
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	b8 a6 4e 80 00       	mov    $0x804ea6,%eax
+  8000c0:	ba a0 4e 80 00       	mov    $0x804ea0,%edx
+  8000c5:	0f 44 c2             	cmove  %edx,%eax
+  8000c8:	50                   	push   %eax
+  8000c9:	68 d3 4e 80 00       	push   $0x804ed3
+  8000ce:	e8 45 02 00 00       	call   800318 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d3:	6a 00                	push   $0x0
+  8000d5:	68 ee 4e 80 00       	push   $0x804eee
+  8000da:	68 f3 4e 80 00       	push   $0x804ef3
+  8000df:	68 f2 4e 80 00       	push   $0x804ef2
+  8000e4:	e8 33 2b 00 00       	call   802c1c <spawnl>
+  8000e9:	83 c4 20             	add    $0x20,%esp
+  8000ec:	85 c0                	test   %eax,%eax
+  8000ee:	0f 88 90 00 00 00    	js     800184 <umain+0x12f>
+	wait(r);
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	50                   	push   %eax
+  8000f8:	e8 80 42 00 00       	call   80437d <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fd:	83 c4 08             	add    $0x8,%esp
+  800100:	ff 35 00 60 80 00    	push   0x806000
+  800106:	68 00 00 00 a0       	push   $0xa0000000
+  80010b:	e8 af 09 00 00       	call   800abf <strcmp>
+  800110:	83 c4 08             	add    $0x8,%esp
+  800113:	85 c0                	test   %eax,%eax
+  800115:	b8 a6 4e 80 00       	mov    $0x804ea6,%eax
+  80011a:	ba a0 4e 80 00       	mov    $0x804ea0,%edx
+  80011f:	0f 44 c2             	cmove  %edx,%eax
+  800122:	50                   	push   %eax
+  800123:	68 0a 4f 80 00       	push   $0x804f0a
+  800128:	e8 eb 01 00 00       	call   800318 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80012d:	cc                   	int3
+}
+  80012e:	83 c4 10             	add    $0x10,%esp
+  800131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800134:	c9                   	leave
+  800135:	c3                   	ret
+		childofspawn();
+  800136:	e8 fa fe ff ff       	call   800035 <childofspawn>
+  80013b:	e9 26 ff ff ff       	jmp    800066 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  800140:	50                   	push   %eax
+  800141:	68 ac 4e 80 00       	push   $0x804eac
+  800146:	6a 13                	push   $0x13
+  800148:	68 bf 4e 80 00       	push   $0x804ebf
+  80014d:	e8 eb 00 00 00       	call   80023d <_panic>
+		panic("fork: %e", r);
+  800152:	50                   	push   %eax
+  800153:	68 2a 53 80 00       	push   $0x80532a
+  800158:	6a 17                	push   $0x17
+  80015a:	68 bf 4e 80 00       	push   $0x804ebf
+  80015f:	e8 d9 00 00 00       	call   80023d <_panic>
+		strcpy(VA, msg);
+  800164:	83 ec 08             	sub    $0x8,%esp
+  800167:	ff 35 04 60 80 00    	push   0x806004
+  80016d:	68 00 00 00 a0       	push   $0xa0000000
+  800172:	e8 98 08 00 00       	call   800a0f <strcpy>
+		exit();
+  800177:	e8 a7 00 00 00       	call   800223 <exit>
+  80017c:	83 c4 10             	add    $0x10,%esp
+  80017f:	e9 16 ff ff ff       	jmp    80009a <umain+0x45>
+		panic("spawn: %e", r);
+  800184:	50                   	push   %eax
+  800185:	68 00 4f 80 00       	push   $0x804f00
+  80018a:	6a 21                	push   $0x21
+  80018c:	68 bf 4e 80 00       	push   $0x804ebf
+  800191:	e8 a7 00 00 00       	call   80023d <_panic>
+
+00800196 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	56                   	push   %esi
+  80019a:	53                   	push   %ebx
+  80019b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019e:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001a1:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8001a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001a8:	29 d0                	sub    %edx,%eax
+  8001aa:	89 c2                	mov    %eax,%edx
+  8001ac:	c1 ea 0f             	shr    $0xf,%edx
+  8001af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8001b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b9:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8001bc:	c7 04 85 40 80 80 00 	movl   $0x0,0x808040(,%eax,4)
+  8001c3:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8001c7:	e8 39 0c 00 00       	call   800e05 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8001cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8001d7:	89 e1                	mov    %esp,%ecx
+  8001d9:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8001de:	29 ca                	sub    %ecx,%edx
+  8001e0:	89 d1                	mov    %edx,%ecx
+  8001e2:	c1 e9 0f             	shr    $0xf,%ecx
+  8001e5:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8001eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f0:	0f 42 d1             	cmovb  %ecx,%edx
+  8001f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f8:	89 04 95 40 80 80 00 	mov    %eax,0x808040(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001ff:	85 db                	test   %ebx,%ebx
+  800201:	7e 07                	jle    80020a <libmain+0x74>
+		binaryname = argv[0];
+  800203:	8b 06                	mov    (%esi),%eax
+  800205:	a3 08 60 80 00       	mov    %eax,0x806008
+
+	// call user main routine
+	umain(argc, argv);
+  80020a:	83 ec 08             	sub    $0x8,%esp
+  80020d:	56                   	push   %esi
+  80020e:	53                   	push   %ebx
+  80020f:	e8 41 fe ff ff       	call   800055 <umain>
+
+	// exit gracefully
+	exit();
+  800214:	e8 0a 00 00 00       	call   800223 <exit>
+}
+  800219:	83 c4 10             	add    $0x10,%esp
+  80021c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80021f:	5b                   	pop    %ebx
+  800220:	5e                   	pop    %esi
+  800221:	5d                   	pop    %ebp
+  800222:	c3                   	ret
+
+00800223 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800223:	55                   	push   %ebp
+  800224:	89 e5                	mov    %esp,%ebp
+  800226:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800229:	e8 dd 19 00 00       	call   801c0b <close_all>
+	sys_env_destroy(0);
+  80022e:	83 ec 0c             	sub    $0xc,%esp
+  800231:	6a 00                	push   $0x0
+  800233:	e8 8c 0b 00 00       	call   800dc4 <sys_env_destroy>
+}
+  800238:	83 c4 10             	add    $0x10,%esp
+  80023b:	c9                   	leave
+  80023c:	c3                   	ret
+
+0080023d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800242:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800245:	8b 35 08 60 80 00    	mov    0x806008,%esi
+  80024b:	e8 b5 0b 00 00       	call   800e05 <sys_getenvid>
+  800250:	83 ec 0c             	sub    $0xc,%esp
+  800253:	ff 75 0c             	push   0xc(%ebp)
+  800256:	ff 75 08             	push   0x8(%ebp)
+  800259:	56                   	push   %esi
+  80025a:	50                   	push   %eax
+  80025b:	68 50 4f 80 00       	push   $0x804f50
+  800260:	e8 b3 00 00 00       	call   800318 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800265:	83 c4 18             	add    $0x18,%esp
+  800268:	53                   	push   %ebx
+  800269:	ff 75 10             	push   0x10(%ebp)
+  80026c:	e8 56 00 00 00       	call   8002c7 <vcprintf>
+	cprintf("\n");
+  800271:	c7 04 24 4e 55 80 00 	movl   $0x80554e,(%esp)
+  800278:	e8 9b 00 00 00       	call   800318 <cprintf>
+  80027d:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800280:	cc                   	int3
+	while (1)
+  800281:	eb fd                	jmp    800280 <_panic+0x43>
+
+00800283 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800283:	55                   	push   %ebp
+  800284:	89 e5                	mov    %esp,%ebp
+  800286:	53                   	push   %ebx
+  800287:	83 ec 04             	sub    $0x4,%esp
+  80028a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80028d:	8b 13                	mov    (%ebx),%edx
+  80028f:	8d 42 01             	lea    0x1(%edx),%eax
+  800292:	89 03                	mov    %eax,(%ebx)
+  800294:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800297:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80029b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002a0:	74 09                	je     8002ab <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002a2:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a9:	c9                   	leave
+  8002aa:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002ab:	83 ec 08             	sub    $0x8,%esp
+  8002ae:	68 ff 00 00 00       	push   $0xff
+  8002b3:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	e8 cb 0a 00 00       	call   800d87 <sys_cputs>
+		b->idx = 0;
+  8002bc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	eb db                	jmp    8002a2 <putch+0x1f>
+
+008002c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c7:	55                   	push   %ebp
+  8002c8:	89 e5                	mov    %esp,%ebp
+  8002ca:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002d0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d7:	00 00 00 
+	b.cnt = 0;
+  8002da:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002e1:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002e4:	ff 75 0c             	push   0xc(%ebp)
+  8002e7:	ff 75 08             	push   0x8(%ebp)
+  8002ea:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002f0:	50                   	push   %eax
+  8002f1:	68 83 02 80 00       	push   $0x800283
+  8002f6:	e8 1c 01 00 00       	call   800417 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002fb:	83 c4 08             	add    $0x8,%esp
+  8002fe:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800304:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80030a:	50                   	push   %eax
+  80030b:	e8 77 0a 00 00       	call   800d87 <sys_cputs>
+
+	return b.cnt;
+}
+  800310:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800316:	c9                   	leave
+  800317:	c3                   	ret
+
+00800318 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800318:	55                   	push   %ebp
+  800319:	89 e5                	mov    %esp,%ebp
+  80031b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80031e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800321:	50                   	push   %eax
+  800322:	ff 75 08             	push   0x8(%ebp)
+  800325:	e8 9d ff ff ff       	call   8002c7 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	57                   	push   %edi
+  800330:	56                   	push   %esi
+  800331:	53                   	push   %ebx
+  800332:	83 ec 1c             	sub    $0x1c,%esp
+  800335:	89 c3                	mov    %eax,%ebx
+  800337:	89 d6                	mov    %edx,%esi
+  800339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80033f:	89 d1                	mov    %edx,%ecx
+  800341:	89 c2                	mov    %eax,%edx
+  800343:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800346:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800349:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80034c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800356:	39 c2                	cmp    %eax,%edx
+  800358:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80035b:	73 4b                	jae    8003a8 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80035d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800360:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800363:	85 ff                	test   %edi,%edi
+  800365:	7e 11                	jle    800378 <printnum+0x4c>
+			putch(padc, putdat);
+  800367:	83 ec 08             	sub    $0x8,%esp
+  80036a:	56                   	push   %esi
+  80036b:	ff 75 18             	push   0x18(%ebp)
+  80036e:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800370:	83 c4 10             	add    $0x10,%esp
+  800373:	83 ef 01             	sub    $0x1,%edi
+  800376:	75 ef                	jne    800367 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800378:	83 ec 08             	sub    $0x8,%esp
+  80037b:	56                   	push   %esi
+  80037c:	83 ec 04             	sub    $0x4,%esp
+  80037f:	ff 75 e4             	push   -0x1c(%ebp)
+  800382:	ff 75 e0             	push   -0x20(%ebp)
+  800385:	ff 75 dc             	push   -0x24(%ebp)
+  800388:	ff 75 d8             	push   -0x28(%ebp)
+  80038b:	e8 ef 49 00 00       	call   804d7f <__umoddi3>
+  800390:	83 c4 14             	add    $0x14,%esp
+  800393:	0f be 80 73 4f 80 00 	movsbl 0x804f73(%eax),%eax
+  80039a:	50                   	push   %eax
+  80039b:	ff d3                	call   *%ebx
+}
+  80039d:	83 c4 10             	add    $0x10,%esp
+  8003a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a3:	5b                   	pop    %ebx
+  8003a4:	5e                   	pop    %esi
+  8003a5:	5f                   	pop    %edi
+  8003a6:	5d                   	pop    %ebp
+  8003a7:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003a8:	83 ec 0c             	sub    $0xc,%esp
+  8003ab:	ff 75 18             	push   0x18(%ebp)
+  8003ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8003b1:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8003b4:	52                   	push   %edx
+  8003b5:	50                   	push   %eax
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	ff 75 e4             	push   -0x1c(%ebp)
+  8003bc:	ff 75 e0             	push   -0x20(%ebp)
+  8003bf:	ff 75 dc             	push   -0x24(%ebp)
+  8003c2:	ff 75 d8             	push   -0x28(%ebp)
+  8003c5:	e8 ef 48 00 00       	call   804cb9 <__udivdi3>
+  8003ca:	83 c4 18             	add    $0x18,%esp
+  8003cd:	52                   	push   %edx
+  8003ce:	50                   	push   %eax
+  8003cf:	89 f2                	mov    %esi,%edx
+  8003d1:	89 d8                	mov    %ebx,%eax
+  8003d3:	e8 54 ff ff ff       	call   80032c <printnum>
+  8003d8:	83 c4 20             	add    $0x20,%esp
+  8003db:	eb 9b                	jmp    800378 <printnum+0x4c>
+
+008003dd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003e3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003e7:	8b 10                	mov    (%eax),%edx
+  8003e9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003ec:	73 0a                	jae    8003f8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003ee:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003f1:	89 08                	mov    %ecx,(%eax)
+  8003f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003f6:	88 02                	mov    %al,(%edx)
+}
+  8003f8:	5d                   	pop    %ebp
+  8003f9:	c3                   	ret
+
+008003fa <printfmt>:
+{
+  8003fa:	55                   	push   %ebp
+  8003fb:	89 e5                	mov    %esp,%ebp
+  8003fd:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800400:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800403:	50                   	push   %eax
+  800404:	ff 75 10             	push   0x10(%ebp)
+  800407:	ff 75 0c             	push   0xc(%ebp)
+  80040a:	ff 75 08             	push   0x8(%ebp)
+  80040d:	e8 05 00 00 00       	call   800417 <vprintfmt>
+}
+  800412:	83 c4 10             	add    $0x10,%esp
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+
+00800417 <vprintfmt>:
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	57                   	push   %edi
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 2c             	sub    $0x2c,%esp
+  800420:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800423:	89 df                	mov    %ebx,%edi
+  800425:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800428:	8b 45 10             	mov    0x10(%ebp),%eax
+  80042b:	8d 70 01             	lea    0x1(%eax),%esi
+  80042e:	0f b6 00             	movzbl (%eax),%eax
+  800431:	83 f8 25             	cmp    $0x25,%eax
+  800434:	74 1e                	je     800454 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800436:	85 c0                	test   %eax,%eax
+  800438:	0f 84 15 05 00 00    	je     800953 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80043e:	83 ec 08             	sub    $0x8,%esp
+  800441:	53                   	push   %ebx
+  800442:	50                   	push   %eax
+  800443:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800445:	83 c6 01             	add    $0x1,%esi
+  800448:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80044c:	83 c4 10             	add    $0x10,%esp
+  80044f:	83 f8 25             	cmp    $0x25,%eax
+  800452:	75 e2                	jne    800436 <vprintfmt+0x1f>
+		padc = ' ';
+  800454:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800458:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80045f:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800466:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80046d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800472:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800475:	8d 56 01             	lea    0x1(%esi),%edx
+  800478:	0f b6 0e             	movzbl (%esi),%ecx
+  80047b:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80047e:	3c 55                	cmp    $0x55,%al
+  800480:	0f 87 3b 04 00 00    	ja     8008c1 <vprintfmt+0x4aa>
+  800486:	0f b6 c0             	movzbl %al,%eax
+  800489:	ff 24 85 e0 50 80 00 	jmp    *0x8050e0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800490:	89 75 10             	mov    %esi,0x10(%ebp)
+  800493:	eb 93                	jmp    800428 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800495:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800497:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80049b:	eb d8                	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049d:	89 d6                	mov    %edx,%esi
+  80049f:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004a3:	eb d0                	jmp    800475 <vprintfmt+0x5e>
+  8004a5:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004a8:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004ae:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8004b2:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8004b5:	83 f9 09             	cmp    $0x9,%ecx
+  8004b8:	77 6f                	ja     800529 <vprintfmt+0x112>
+  8004ba:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8004bd:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8004c0:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8004c3:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8004c7:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8004ca:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8004cd:	83 fe 09             	cmp    $0x9,%esi
+  8004d0:	76 eb                	jbe    8004bd <vprintfmt+0xa6>
+  8004d2:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8004d5:	89 d6                	mov    %edx,%esi
+  8004d7:	eb 13                	jmp    8004ec <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8004d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004dc:	8b 00                	mov    (%eax),%eax
+  8004de:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8004e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e7:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ea:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8004ec:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004f0:	79 83                	jns    800475 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8004f2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8004f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004f8:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  8004ff:	e9 71 ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+			if (width < 0)
+  800504:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800507:	85 c9                	test   %ecx,%ecx
+  800509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050e:	0f 49 c1             	cmovns %ecx,%eax
+  800511:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800514:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800516:	e9 5a ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80051b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80051d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800524:	e9 4c ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800529:	89 d6                	mov    %edx,%esi
+  80052b:	eb bf                	jmp    8004ec <vprintfmt+0xd5>
+			lflag++;
+  80052d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800531:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800533:	e9 3d ff ff ff       	jmp    800475 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800538:	89 55 10             	mov    %edx,0x10(%ebp)
+  80053b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053e:	8d 70 04             	lea    0x4(%eax),%esi
+  800541:	83 ec 08             	sub    $0x8,%esp
+  800544:	53                   	push   %ebx
+  800545:	ff 30                	push   (%eax)
+  800547:	ff d7                	call   *%edi
+			break;
+  800549:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80054c:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80054f:	e9 d4 fe ff ff       	jmp    800428 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800554:	89 55 10             	mov    %edx,0x10(%ebp)
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80055d:	8b 10                	mov    (%eax),%edx
+  80055f:	89 d0                	mov    %edx,%eax
+  800561:	f7 d8                	neg    %eax
+  800563:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800566:	83 f8 12             	cmp    $0x12,%eax
+  800569:	7f 23                	jg     80058e <vprintfmt+0x177>
+  80056b:	8b 14 85 40 52 80 00 	mov    0x805240(,%eax,4),%edx
+  800572:	85 d2                	test   %edx,%edx
+  800574:	74 18                	je     80058e <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800576:	52                   	push   %edx
+  800577:	68 78 54 80 00       	push   $0x805478
+  80057c:	53                   	push   %ebx
+  80057d:	57                   	push   %edi
+  80057e:	e8 77 fe ff ff       	call   8003fa <printfmt>
+  800583:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800586:	89 75 14             	mov    %esi,0x14(%ebp)
+  800589:	e9 9a fe ff ff       	jmp    800428 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  80058e:	50                   	push   %eax
+  80058f:	68 8b 4f 80 00       	push   $0x804f8b
+  800594:	53                   	push   %ebx
+  800595:	57                   	push   %edi
+  800596:	e8 5f fe ff ff       	call   8003fa <printfmt>
+  80059b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80059e:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005a1:	e9 82 fe ff ff       	jmp    800428 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005a6:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ac:	83 c0 04             	add    $0x4,%eax
+  8005af:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8005b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b5:	8b 00                	mov    (%eax),%eax
+  8005b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ba:	85 c0                	test   %eax,%eax
+  8005bc:	0f 84 61 03 00 00    	je     800923 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8005c2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005c6:	7e 06                	jle    8005ce <vprintfmt+0x1b7>
+  8005c8:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8005cc:	75 29                	jne    8005f7 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005d1:	8d 70 01             	lea    0x1(%eax),%esi
+  8005d4:	0f b6 00             	movzbl (%eax),%eax
+  8005d7:	0f be d0             	movsbl %al,%edx
+  8005da:	85 d2                	test   %edx,%edx
+  8005dc:	0f 84 bb 00 00 00    	je     80069d <vprintfmt+0x286>
+  8005e2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005e5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005e8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005ee:	eb 7a                	jmp    80066a <vprintfmt+0x253>
+				p = "(null)";
+  8005f0:	c7 45 d0 84 4f 80 00 	movl   $0x804f84,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f7:	83 ec 08             	sub    $0x8,%esp
+  8005fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8005fd:	ff 75 d0             	push   -0x30(%ebp)
+  800600:	e8 e0 03 00 00       	call   8009e5 <strnlen>
+  800605:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800608:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	85 d2                	test   %edx,%edx
+  800610:	0f 8e d6 02 00 00    	jle    8008ec <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800616:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	56                   	push   %esi
+  80061f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800621:	83 c4 10             	add    $0x10,%esp
+  800624:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800628:	75 f0                	jne    80061a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80062a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80062d:	8d 70 01             	lea    0x1(%eax),%esi
+  800630:	0f b6 00             	movzbl (%eax),%eax
+  800633:	0f be d0             	movsbl %al,%edx
+  800636:	85 d2                	test   %edx,%edx
+  800638:	0f 84 da 02 00 00    	je     800918 <vprintfmt+0x501>
+  80063e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800641:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800644:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800647:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80064a:	eb 1e                	jmp    80066a <vprintfmt+0x253>
+					putch(ch, putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	ff 75 0c             	push   0xc(%ebp)
+  800652:	52                   	push   %edx
+  800653:	ff 55 08             	call   *0x8(%ebp)
+  800656:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800659:	83 eb 01             	sub    $0x1,%ebx
+  80065c:	83 c6 01             	add    $0x1,%esi
+  80065f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800663:	0f be d0             	movsbl %al,%edx
+  800666:	85 d2                	test   %edx,%edx
+  800668:	74 2a                	je     800694 <vprintfmt+0x27d>
+  80066a:	85 ff                	test   %edi,%edi
+  80066c:	78 05                	js     800673 <vprintfmt+0x25c>
+  80066e:	83 ef 01             	sub    $0x1,%edi
+  800671:	78 59                	js     8006cc <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800673:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800677:	74 d3                	je     80064c <vprintfmt+0x235>
+  800679:	0f be c0             	movsbl %al,%eax
+  80067c:	83 e8 20             	sub    $0x20,%eax
+  80067f:	83 f8 5e             	cmp    $0x5e,%eax
+  800682:	76 c8                	jbe    80064c <vprintfmt+0x235>
+					putch('?', putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	ff 75 0c             	push   0xc(%ebp)
+  80068a:	6a 3f                	push   $0x3f
+  80068c:	ff 55 08             	call   *0x8(%ebp)
+  80068f:	83 c4 10             	add    $0x10,%esp
+  800692:	eb c5                	jmp    800659 <vprintfmt+0x242>
+  800694:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800697:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80069a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80069d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006a0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006a4:	7e 1b                	jle    8006c1 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 20                	push   $0x20
+  8006ac:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	83 ee 01             	sub    $0x1,%esi
+  8006b4:	75 f0                	jne    8006a6 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006b6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bc:	e9 67 fd ff ff       	jmp    800428 <vprintfmt+0x11>
+  8006c1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006c4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c7:	e9 5c fd ff ff       	jmp    800428 <vprintfmt+0x11>
+  8006cc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006cf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006d5:	eb c6                	jmp    80069d <vprintfmt+0x286>
+	if (lflag >= 2)
+  8006d7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006da:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006dd:	83 f9 01             	cmp    $0x1,%ecx
+  8006e0:	7f 1f                	jg     800701 <vprintfmt+0x2ea>
+	else if (lflag)
+  8006e2:	85 c9                	test   %ecx,%ecx
+  8006e4:	74 67                	je     80074d <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8006e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e9:	8b 30                	mov    (%eax),%esi
+  8006eb:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006ee:	89 f0                	mov    %esi,%eax
+  8006f0:	c1 f8 1f             	sar    $0x1f,%eax
+  8006f3:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ff:	eb 17                	jmp    800718 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800701:	8b 45 14             	mov    0x14(%ebp),%eax
+  800704:	8b 50 04             	mov    0x4(%eax),%edx
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8d 40 08             	lea    0x8(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800718:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80071e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800723:	85 c9                	test   %ecx,%ecx
+  800725:	0f 89 12 01 00 00    	jns    80083d <vprintfmt+0x426>
+				putch('-', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 2d                	push   $0x2d
+  800731:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800733:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800736:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800739:	f7 da                	neg    %edx
+  80073b:	83 d1 00             	adc    $0x0,%ecx
+  80073e:	f7 d9                	neg    %ecx
+  800740:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800743:	be 0a 00 00 00       	mov    $0xa,%esi
+  800748:	e9 f0 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80074d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800750:	8b 30                	mov    (%eax),%esi
+  800752:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800755:	89 f0                	mov    %esi,%eax
+  800757:	c1 f8 1f             	sar    $0x1f,%eax
+  80075a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8d 40 04             	lea    0x4(%eax),%eax
+  800763:	89 45 14             	mov    %eax,0x14(%ebp)
+  800766:	eb b0                	jmp    800718 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800768:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80076b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80076e:	83 f9 01             	cmp    $0x1,%ecx
+  800771:	7f 1e                	jg     800791 <vprintfmt+0x37a>
+	else if (lflag)
+  800773:	85 c9                	test   %ecx,%ecx
+  800775:	74 32                	je     8007a9 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800781:	8d 40 04             	lea    0x4(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800787:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  80078c:	e9 ac 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80079f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007a4:	e9 94 00 00 00       	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ac:	8b 10                	mov    (%eax),%edx
+  8007ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007b9:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8007be:	eb 7d                	jmp    80083d <vprintfmt+0x426>
+	if (lflag >= 2)
+  8007c0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007c3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c6:	83 f9 01             	cmp    $0x1,%ecx
+  8007c9:	7f 1b                	jg     8007e6 <vprintfmt+0x3cf>
+	else if (lflag)
+  8007cb:	85 c9                	test   %ecx,%ecx
+  8007cd:	74 2c                	je     8007fb <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8b 10                	mov    (%eax),%edx
+  8007d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007df:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  8007e4:	eb 57                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 10                	mov    (%eax),%edx
+  8007eb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8007f4:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  8007f9:	eb 42                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fe:	8b 10                	mov    (%eax),%edx
+  800800:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800805:	8d 40 04             	lea    0x4(%eax),%eax
+  800808:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80080b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800810:	eb 2b                	jmp    80083d <vprintfmt+0x426>
+			putch('0', putdat);
+  800812:	89 55 10             	mov    %edx,0x10(%ebp)
+  800815:	83 ec 08             	sub    $0x8,%esp
+  800818:	53                   	push   %ebx
+  800819:	6a 30                	push   $0x30
+  80081b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80081d:	83 c4 08             	add    $0x8,%esp
+  800820:	53                   	push   %ebx
+  800821:	6a 78                	push   $0x78
+  800823:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800825:	8b 45 14             	mov    0x14(%ebp),%eax
+  800828:	8b 10                	mov    (%eax),%edx
+  80082a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80082f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800832:	8d 40 04             	lea    0x4(%eax),%eax
+  800835:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800838:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80083d:	83 ec 0c             	sub    $0xc,%esp
+  800840:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800844:	50                   	push   %eax
+  800845:	ff 75 e4             	push   -0x1c(%ebp)
+  800848:	56                   	push   %esi
+  800849:	51                   	push   %ecx
+  80084a:	52                   	push   %edx
+  80084b:	89 da                	mov    %ebx,%edx
+  80084d:	89 f8                	mov    %edi,%eax
+  80084f:	e8 d8 fa ff ff       	call   80032c <printnum>
+			break;
+  800854:	83 c4 20             	add    $0x20,%esp
+  800857:	e9 cc fb ff ff       	jmp    800428 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80085c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80085f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800862:	83 f9 01             	cmp    $0x1,%ecx
+  800865:	7f 1b                	jg     800882 <vprintfmt+0x46b>
+	else if (lflag)
+  800867:	85 c9                	test   %ecx,%ecx
+  800869:	74 2c                	je     800897 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8b 10                	mov    (%eax),%edx
+  800870:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800875:	8d 40 04             	lea    0x4(%eax),%eax
+  800878:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80087b:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800880:	eb bb                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800882:	8b 45 14             	mov    0x14(%ebp),%eax
+  800885:	8b 10                	mov    (%eax),%edx
+  800887:	8b 48 04             	mov    0x4(%eax),%ecx
+  80088a:	8d 40 08             	lea    0x8(%eax),%eax
+  80088d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800890:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800895:	eb a6                	jmp    80083d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 10                	mov    (%eax),%edx
+  80089c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a7:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008ac:	eb 8f                	jmp    80083d <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b1:	83 ec 08             	sub    $0x8,%esp
+  8008b4:	53                   	push   %ebx
+  8008b5:	6a 25                	push   $0x25
+  8008b7:	ff d7                	call   *%edi
+			break;
+  8008b9:	83 c4 10             	add    $0x10,%esp
+  8008bc:	e9 67 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			putch('%', putdat);
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+  8008c4:	53                   	push   %ebx
+  8008c5:	6a 25                	push   $0x25
+  8008c7:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8008d0:	0f 84 ba fb ff ff    	je     800490 <vprintfmt+0x79>
+  8008d6:	89 75 10             	mov    %esi,0x10(%ebp)
+  8008d9:	89 f0                	mov    %esi,%eax
+  8008db:	83 e8 01             	sub    $0x1,%eax
+  8008de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008e2:	75 f7                	jne    8008db <vprintfmt+0x4c4>
+  8008e4:	89 45 10             	mov    %eax,0x10(%ebp)
+  8008e7:	e9 3c fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ec:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008ef:	8d 70 01             	lea    0x1(%eax),%esi
+  8008f2:	0f b6 00             	movzbl (%eax),%eax
+  8008f5:	0f be d0             	movsbl %al,%edx
+  8008f8:	85 d2                	test   %edx,%edx
+  8008fa:	74 11                	je     80090d <vprintfmt+0x4f6>
+  8008fc:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008ff:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800902:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800905:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800908:	e9 5d fd ff ff       	jmp    80066a <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80090d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+  800913:	e9 10 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+  800918:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80091b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80091e:	e9 05 fb ff ff       	jmp    800428 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800923:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800927:	7e 0a                	jle    800933 <vprintfmt+0x51c>
+  800929:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80092d:	0f 85 bd fc ff ff    	jne    8005f0 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800933:	ba 28 00 00 00       	mov    $0x28,%edx
+  800938:	b8 28 00 00 00       	mov    $0x28,%eax
+  80093d:	be 85 4f 80 00       	mov    $0x804f85,%esi
+  800942:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800945:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800948:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80094b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80094e:	e9 17 fd ff ff       	jmp    80066a <vprintfmt+0x253>
+}
+  800953:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800956:	5b                   	pop    %ebx
+  800957:	5e                   	pop    %esi
+  800958:	5f                   	pop    %edi
+  800959:	5d                   	pop    %ebp
+  80095a:	c3                   	ret
+
+0080095b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	83 ec 18             	sub    $0x18,%esp
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800967:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800971:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	74 26                	je     8009a2 <vsnprintf+0x47>
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	7e 22                	jle    8009a2 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800980:	ff 75 14             	push   0x14(%ebp)
+  800983:	ff 75 10             	push   0x10(%ebp)
+  800986:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800989:	50                   	push   %eax
+  80098a:	68 dd 03 80 00       	push   $0x8003dd
+  80098f:	e8 83 fa ff ff       	call   800417 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800994:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80099a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099d:	83 c4 10             	add    $0x10,%esp
+}
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+		return -E_INVAL;
+  8009a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a7:	eb f7                	jmp    8009a0 <vsnprintf+0x45>
+
+008009a9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009af:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009b2:	50                   	push   %eax
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	ff 75 08             	push   0x8(%ebp)
+  8009bc:	e8 9a ff ff ff       	call   80095b <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c9:	80 3a 00             	cmpb   $0x0,(%edx)
+  8009cc:	74 10                	je     8009de <strlen+0x1b>
+  8009ce:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8009d3:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009d6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009da:	75 f7                	jne    8009d3 <strlen+0x10>
+	return n;
+}
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  8009e3:	eb f7                	jmp    8009dc <strlen+0x19>
+
+008009e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	74 16                	je     800a08 <strnlen+0x23>
+  8009f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009fb:	74 09                	je     800a06 <strnlen+0x21>
+		n++;
+  8009fd:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a00:	39 d0                	cmp    %edx,%eax
+  800a02:	75 f3                	jne    8009f7 <strnlen+0x12>
+		n++;
+  800a04:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	eb f7                	jmp    800a06 <strnlen+0x21>
+
+00800a0f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a0f:	55                   	push   %ebp
+  800a10:	89 e5                	mov    %esp,%ebp
+  800a12:	53                   	push   %ebx
+  800a13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a16:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a22:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a25:	83 c0 01             	add    $0x1,%eax
+  800a28:	84 d2                	test   %dl,%dl
+  800a2a:	75 f2                	jne    800a1e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a2c:	89 c8                	mov    %ecx,%eax
+  800a2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+
+00800a33 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a33:	55                   	push   %ebp
+  800a34:	89 e5                	mov    %esp,%ebp
+  800a36:	53                   	push   %ebx
+  800a37:	83 ec 10             	sub    $0x10,%esp
+  800a3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a3d:	53                   	push   %ebx
+  800a3e:	e8 80 ff ff ff       	call   8009c3 <strlen>
+  800a43:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a46:	ff 75 0c             	push   0xc(%ebp)
+  800a49:	01 d8                	add    %ebx,%eax
+  800a4b:	50                   	push   %eax
+  800a4c:	e8 be ff ff ff       	call   800a0f <strcpy>
+	return dst;
+}
+  800a51:	89 d8                	mov    %ebx,%eax
+  800a53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a56:	c9                   	leave
+  800a57:	c3                   	ret
+
+00800a58 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	56                   	push   %esi
+  800a5c:	53                   	push   %ebx
+  800a5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a60:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a66:	85 db                	test   %ebx,%ebx
+  800a68:	74 17                	je     800a81 <strncpy+0x29>
+  800a6a:	01 f3                	add    %esi,%ebx
+  800a6c:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  800a71:	0f b6 0a             	movzbl (%edx),%ecx
+  800a74:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a77:	80 f9 01             	cmp    $0x1,%cl
+  800a7a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a7d:	39 c3                	cmp    %eax,%ebx
+  800a7f:	75 ed                	jne    800a6e <strncpy+0x16>
+	}
+	return ret;
+}
+  800a81:	89 f0                	mov    %esi,%eax
+  800a83:	5b                   	pop    %ebx
+  800a84:	5e                   	pop    %esi
+  800a85:	5d                   	pop    %ebp
+  800a86:	c3                   	ret
+
+00800a87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a87:	55                   	push   %ebp
+  800a88:	89 e5                	mov    %esp,%ebp
+  800a8a:	56                   	push   %esi
+  800a8b:	53                   	push   %ebx
+  800a8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a95:	89 f0                	mov    %esi,%eax
+  800a97:	85 db                	test   %ebx,%ebx
+  800a99:	74 1e                	je     800ab9 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800a9b:	83 eb 01             	sub    $0x1,%ebx
+  800a9e:	74 16                	je     800ab6 <strlcpy+0x2f>
+  800aa0:	01 f3                	add    %esi,%ebx
+  800aa2:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa5:	84 c9                	test   %cl,%cl
+  800aa7:	74 0d                	je     800ab6 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	83 c0 01             	add    $0x1,%eax
+  800aaf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800ab2:	39 d8                	cmp    %ebx,%eax
+  800ab4:	75 ec                	jne    800aa2 <strlcpy+0x1b>
+		*dst = '\0';
+  800ab6:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800ab9:	29 f0                	sub    %esi,%eax
+}
+  800abb:	5b                   	pop    %ebx
+  800abc:	5e                   	pop    %esi
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+
+00800abf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ac8:	0f b6 01             	movzbl (%ecx),%eax
+  800acb:	84 c0                	test   %al,%al
+  800acd:	74 11                	je     800ae0 <strcmp+0x21>
+  800acf:	38 02                	cmp    %al,(%edx)
+  800ad1:	75 0d                	jne    800ae0 <strcmp+0x21>
+		p++, q++;
+  800ad3:	83 c1 01             	add    $0x1,%ecx
+  800ad6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ad9:	0f b6 01             	movzbl (%ecx),%eax
+  800adc:	84 c0                	test   %al,%al
+  800ade:	75 ef                	jne    800acf <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ae0:	0f b6 c0             	movzbl %al,%eax
+  800ae3:	0f b6 12             	movzbl (%edx),%edx
+  800ae6:	29 d0                	sub    %edx,%eax
+}
+  800ae8:	5d                   	pop    %ebp
+  800ae9:	c3                   	ret
+
+00800aea <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	53                   	push   %ebx
+  800aee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800af1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800af4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800af7:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	74 2e                	je     800b2e <strncmp+0x44>
+  800b00:	0f b6 01             	movzbl (%ecx),%eax
+  800b03:	84 c0                	test   %al,%al
+  800b05:	74 16                	je     800b1d <strncmp+0x33>
+  800b07:	3a 03                	cmp    (%ebx),%al
+  800b09:	75 12                	jne    800b1d <strncmp+0x33>
+		n--, p++, q++;
+  800b0b:	83 c1 01             	add    $0x1,%ecx
+  800b0e:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b11:	83 ea 01             	sub    $0x1,%edx
+  800b14:	75 ea                	jne    800b00 <strncmp+0x16>
+		return 0;
+  800b16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1b:	eb 11                	jmp    800b2e <strncmp+0x44>
+  800b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b22:	85 d2                	test   %edx,%edx
+  800b24:	74 08                	je     800b2e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b26:	0f b6 01             	movzbl (%ecx),%eax
+  800b29:	0f b6 13             	movzbl (%ebx),%edx
+  800b2c:	29 d0                	sub    %edx,%eax
+}
+  800b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b31:	c9                   	leave
+  800b32:	c3                   	ret
+
+00800b33 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b3d:	0f b6 10             	movzbl (%eax),%edx
+  800b40:	84 d2                	test   %dl,%dl
+  800b42:	74 15                	je     800b59 <strchr+0x26>
+		if (*s == c)
+  800b44:	38 d1                	cmp    %dl,%cl
+  800b46:	74 0f                	je     800b57 <strchr+0x24>
+	for (; *s; s++)
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	0f b6 10             	movzbl (%eax),%edx
+  800b4e:	84 d2                	test   %dl,%dl
+  800b50:	75 f2                	jne    800b44 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800b52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+	return 0;
+  800b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5e:	eb f7                	jmp    800b57 <strchr+0x24>
+
+00800b60 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	53                   	push   %ebx
+  800b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b67:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800b6a:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800b6d:	38 d3                	cmp    %dl,%bl
+  800b6f:	74 14                	je     800b85 <strfind+0x25>
+  800b71:	89 d1                	mov    %edx,%ecx
+  800b73:	84 db                	test   %bl,%bl
+  800b75:	74 0e                	je     800b85 <strfind+0x25>
+	for (; *s; s++)
+  800b77:	83 c0 01             	add    $0x1,%eax
+  800b7a:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b7d:	38 ca                	cmp    %cl,%dl
+  800b7f:	74 04                	je     800b85 <strfind+0x25>
+  800b81:	84 d2                	test   %dl,%dl
+  800b83:	75 f2                	jne    800b77 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800b85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b88:	c9                   	leave
+  800b89:	c3                   	ret
+
+00800b8a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b8a:	55                   	push   %ebp
+  800b8b:	89 e5                	mov    %esp,%ebp
+  800b8d:	57                   	push   %edi
+  800b8e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b94:	85 c9                	test   %ecx,%ecx
+  800b96:	74 20                	je     800bb8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b98:	89 f8                	mov    %edi,%eax
+  800b9a:	09 c8                	or     %ecx,%eax
+  800b9c:	a8 03                	test   $0x3,%al
+  800b9e:	75 12                	jne    800bb2 <memset+0x28>
+		c &= 0xFF;
+  800ba0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ba4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800baa:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bad:	fc                   	cld
+  800bae:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bb0:	eb 06                	jmp    800bb8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800bb2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb5:	fc                   	cld
+  800bb6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bb8:	89 f8                	mov    %edi,%eax
+  800bba:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bbd:	c9                   	leave
+  800bbe:	c3                   	ret
+
+00800bbf <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800bcd:	39 c6                	cmp    %eax,%esi
+  800bcf:	73 32                	jae    800c03 <memmove+0x44>
+  800bd1:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bd4:	39 d0                	cmp    %edx,%eax
+  800bd6:	73 2b                	jae    800c03 <memmove+0x44>
+		s += n;
+		d += n;
+  800bd8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bdb:	89 d6                	mov    %edx,%esi
+  800bdd:	09 fe                	or     %edi,%esi
+  800bdf:	09 ce                	or     %ecx,%esi
+  800be1:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800be7:	75 0e                	jne    800bf7 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800be9:	83 ef 04             	sub    $0x4,%edi
+  800bec:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bef:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bf2:	fd                   	std
+  800bf3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bf5:	eb 09                	jmp    800c00 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bf7:	83 ef 01             	sub    $0x1,%edi
+  800bfa:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bfd:	fd                   	std
+  800bfe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c00:	fc                   	cld
+  800c01:	eb 1a                	jmp    800c1d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c03:	89 f2                	mov    %esi,%edx
+  800c05:	09 c2                	or     %eax,%edx
+  800c07:	09 ca                	or     %ecx,%edx
+  800c09:	f6 c2 03             	test   $0x3,%dl
+  800c0c:	75 0a                	jne    800c18 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c11:	89 c7                	mov    %eax,%edi
+  800c13:	fc                   	cld
+  800c14:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c16:	eb 05                	jmp    800c1d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c18:	89 c7                	mov    %eax,%edi
+  800c1a:	fc                   	cld
+  800c1b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5f                   	pop    %edi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+
+00800c21 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c21:	55                   	push   %ebp
+  800c22:	89 e5                	mov    %esp,%ebp
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c27:	ff 75 10             	push   0x10(%ebp)
+  800c2a:	ff 75 0c             	push   0xc(%ebp)
+  800c2d:	ff 75 08             	push   0x8(%ebp)
+  800c30:	e8 8a ff ff ff       	call   800bbf <memmove>
+}
+  800c35:	c9                   	leave
+  800c36:	c3                   	ret
+
+00800c37 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	56                   	push   %esi
+  800c3b:	53                   	push   %ebx
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c42:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c45:	85 f6                	test   %esi,%esi
+  800c47:	74 29                	je     800c72 <memcmp+0x3b>
+  800c49:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c4b:	0f b6 08             	movzbl (%eax),%ecx
+  800c4e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c51:	38 d9                	cmp    %bl,%cl
+  800c53:	75 11                	jne    800c66 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c55:	83 c0 01             	add    $0x1,%eax
+  800c58:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c5b:	39 c6                	cmp    %eax,%esi
+  800c5d:	75 ec                	jne    800c4b <memcmp+0x14>
+	}
+
+	return 0;
+  800c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c64:	eb 08                	jmp    800c6e <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800c66:	0f b6 c1             	movzbl %cl,%eax
+  800c69:	0f b6 db             	movzbl %bl,%ebx
+  800c6c:	29 d8                	sub    %ebx,%eax
+}
+  800c6e:	5b                   	pop    %ebx
+  800c6f:	5e                   	pop    %esi
+  800c70:	5d                   	pop    %ebp
+  800c71:	c3                   	ret
+	return 0;
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	eb f5                	jmp    800c6e <memcmp+0x37>
+
+00800c79 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c82:	89 c2                	mov    %eax,%edx
+  800c84:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c87:	39 d0                	cmp    %edx,%eax
+  800c89:	73 0d                	jae    800c98 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c8b:	38 08                	cmp    %cl,(%eax)
+  800c8d:	74 0d                	je     800c9c <memfind+0x23>
+	for (; s < ends; s++)
+  800c8f:	83 c0 01             	add    $0x1,%eax
+  800c92:	39 c2                	cmp    %eax,%edx
+  800c94:	75 f5                	jne    800c8b <memfind+0x12>
+  800c96:	eb 06                	jmp    800c9e <memfind+0x25>
+  800c98:	89 c2                	mov    %eax,%edx
+  800c9a:	eb 02                	jmp    800c9e <memfind+0x25>
+  800c9c:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800c9e:	89 d0                	mov    %edx,%eax
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+
+00800ca2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca2:	55                   	push   %ebp
+  800ca3:	89 e5                	mov    %esp,%ebp
+  800ca5:	57                   	push   %edi
+  800ca6:	56                   	push   %esi
+  800ca7:	53                   	push   %ebx
+  800ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cae:	0f b6 02             	movzbl (%edx),%eax
+  800cb1:	3c 20                	cmp    $0x20,%al
+  800cb3:	74 04                	je     800cb9 <strtol+0x17>
+  800cb5:	3c 09                	cmp    $0x9,%al
+  800cb7:	75 0e                	jne    800cc7 <strtol+0x25>
+		s++;
+  800cb9:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cbc:	0f b6 02             	movzbl (%edx),%eax
+  800cbf:	3c 20                	cmp    $0x20,%al
+  800cc1:	74 f6                	je     800cb9 <strtol+0x17>
+  800cc3:	3c 09                	cmp    $0x9,%al
+  800cc5:	74 f2                	je     800cb9 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800cc7:	3c 2b                	cmp    $0x2b,%al
+  800cc9:	74 2a                	je     800cf5 <strtol+0x53>
+	int neg = 0;
+  800ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800cd0:	3c 2d                	cmp    $0x2d,%al
+  800cd2:	74 2b                	je     800cff <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cd4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cda:	75 0f                	jne    800ceb <strtol+0x49>
+  800cdc:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cdf:	74 28                	je     800d09 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800ce1:	85 db                	test   %ebx,%ebx
+  800ce3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce8:	0f 44 d8             	cmove  %eax,%ebx
+  800ceb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf0:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cf3:	eb 46                	jmp    800d3b <strtol+0x99>
+		s++;
+  800cf5:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800cf8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cfd:	eb d5                	jmp    800cd4 <strtol+0x32>
+		s++, neg = 1;
+  800cff:	83 c2 01             	add    $0x1,%edx
+  800d02:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d07:	eb cb                	jmp    800cd4 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d09:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d0d:	74 0e                	je     800d1d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d0f:	85 db                	test   %ebx,%ebx
+  800d11:	75 d8                	jne    800ceb <strtol+0x49>
+		s++, base = 8;
+  800d13:	83 c2 01             	add    $0x1,%edx
+  800d16:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d1b:	eb ce                	jmp    800ceb <strtol+0x49>
+		s += 2, base = 16;
+  800d1d:	83 c2 02             	add    $0x2,%edx
+  800d20:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d25:	eb c4                	jmp    800ceb <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d27:	0f be c0             	movsbl %al,%eax
+  800d2a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d2d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d30:	7d 3a                	jge    800d6c <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d32:	83 c2 01             	add    $0x1,%edx
+  800d35:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d39:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d3b:	0f b6 02             	movzbl (%edx),%eax
+  800d3e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d41:	89 f3                	mov    %esi,%ebx
+  800d43:	80 fb 09             	cmp    $0x9,%bl
+  800d46:	76 df                	jbe    800d27 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d48:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d4b:	89 f3                	mov    %esi,%ebx
+  800d4d:	80 fb 19             	cmp    $0x19,%bl
+  800d50:	77 08                	ja     800d5a <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800d52:	0f be c0             	movsbl %al,%eax
+  800d55:	83 e8 57             	sub    $0x57,%eax
+  800d58:	eb d3                	jmp    800d2d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d5a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d5d:	89 f3                	mov    %esi,%ebx
+  800d5f:	80 fb 19             	cmp    $0x19,%bl
+  800d62:	77 08                	ja     800d6c <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800d64:	0f be c0             	movsbl %al,%eax
+  800d67:	83 e8 37             	sub    $0x37,%eax
+  800d6a:	eb c1                	jmp    800d2d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d6c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d70:	74 05                	je     800d77 <strtol+0xd5>
+		*endptr = (char *) s;
+  800d72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d75:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d77:	89 c8                	mov    %ecx,%eax
+  800d79:	f7 d8                	neg    %eax
+  800d7b:	85 ff                	test   %edi,%edi
+  800d7d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d80:	89 c8                	mov    %ecx,%eax
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d98:	89 c3                	mov    %eax,%ebx
+  800d9a:	89 c7                	mov    %eax,%edi
+  800d9c:	89 c6                	mov    %eax,%esi
+  800d9e:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800da0:	5b                   	pop    %ebx
+  800da1:	5e                   	pop    %esi
+  800da2:	5f                   	pop    %edi
+  800da3:	5d                   	pop    %ebp
+  800da4:	c3                   	ret
+
+00800da5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db5:	89 d1                	mov    %edx,%ecx
+  800db7:	89 d3                	mov    %edx,%ebx
+  800db9:	89 d7                	mov    %edx,%edi
+  800dbb:	89 d6                	mov    %edx,%esi
+  800dbd:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dda:	89 cb                	mov    %ecx,%ebx
+  800ddc:	89 cf                	mov    %ecx,%edi
+  800dde:	89 ce                	mov    %ecx,%esi
+  800de0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 08                	jg     800dee <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 03                	push   $0x3
+  800df4:	68 ab 52 80 00       	push   $0x8052ab
+  800df9:	6a 23                	push   $0x23
+  800dfb:	68 c8 52 80 00       	push   $0x8052c8
+  800e00:	e8 38 f4 ff ff       	call   80023d <_panic>
+
+00800e05 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e10:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e15:	89 d1                	mov    %edx,%ecx
+  800e17:	89 d3                	mov    %edx,%ebx
+  800e19:	89 d7                	mov    %edx,%edi
+  800e1b:	89 d6                	mov    %edx,%esi
+  800e1d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e1f:	5b                   	pop    %ebx
+  800e20:	5e                   	pop    %esi
+  800e21:	5f                   	pop    %edi
+  800e22:	5d                   	pop    %ebp
+  800e23:	c3                   	ret
+
+00800e24 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e34:	89 d1                	mov    %edx,%ecx
+  800e36:	89 d3                	mov    %edx,%ebx
+  800e38:	89 d7                	mov    %edx,%edi
+  800e3a:	89 d6                	mov    %edx,%esi
+  800e3c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+
+00800e43 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  800e49:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e57:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5f:	89 f7                	mov    %esi,%edi
+  800e61:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e63:	85 c0                	test   %eax,%eax
+  800e65:	7f 08                	jg     800e6f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6a:	5b                   	pop    %ebx
+  800e6b:	5e                   	pop    %esi
+  800e6c:	5f                   	pop    %edi
+  800e6d:	5d                   	pop    %ebp
+  800e6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6f:	83 ec 0c             	sub    $0xc,%esp
+  800e72:	50                   	push   %eax
+  800e73:	6a 04                	push   $0x4
+  800e75:	68 ab 52 80 00       	push   $0x8052ab
+  800e7a:	6a 23                	push   $0x23
+  800e7c:	68 c8 52 80 00       	push   $0x8052c8
+  800e81:	e8 b7 f3 ff ff       	call   80023d <_panic>
+
+00800e86 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e86:	55                   	push   %ebp
+  800e87:	89 e5                	mov    %esp,%ebp
+  800e89:	57                   	push   %edi
+  800e8a:	56                   	push   %esi
+  800e8b:	53                   	push   %ebx
+  800e8c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ea5:	85 c0                	test   %eax,%eax
+  800ea7:	7f 08                	jg     800eb1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ea9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eac:	5b                   	pop    %ebx
+  800ead:	5e                   	pop    %esi
+  800eae:	5f                   	pop    %edi
+  800eaf:	5d                   	pop    %ebp
+  800eb0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb1:	83 ec 0c             	sub    $0xc,%esp
+  800eb4:	50                   	push   %eax
+  800eb5:	6a 05                	push   $0x5
+  800eb7:	68 ab 52 80 00       	push   $0x8052ab
+  800ebc:	6a 23                	push   $0x23
+  800ebe:	68 c8 52 80 00       	push   $0x8052c8
+  800ec3:	e8 75 f3 ff ff       	call   80023d <_panic>
+
+00800ec8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ec8:	55                   	push   %ebp
+  800ec9:	89 e5                	mov    %esp,%ebp
+  800ecb:	57                   	push   %edi
+  800ecc:	56                   	push   %esi
+  800ecd:	53                   	push   %ebx
+  800ece:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ee1:	89 df                	mov    %ebx,%edi
+  800ee3:	89 de                	mov    %ebx,%esi
+  800ee5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ee7:	85 c0                	test   %eax,%eax
+  800ee9:	7f 08                	jg     800ef3 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eeb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eee:	5b                   	pop    %ebx
+  800eef:	5e                   	pop    %esi
+  800ef0:	5f                   	pop    %edi
+  800ef1:	5d                   	pop    %ebp
+  800ef2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef3:	83 ec 0c             	sub    $0xc,%esp
+  800ef6:	50                   	push   %eax
+  800ef7:	6a 06                	push   $0x6
+  800ef9:	68 ab 52 80 00       	push   $0x8052ab
+  800efe:	6a 23                	push   $0x23
+  800f00:	68 c8 52 80 00       	push   $0x8052c8
+  800f05:	e8 33 f3 ff ff       	call   80023d <_panic>
+
+00800f0a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f0a:	55                   	push   %ebp
+  800f0b:	89 e5                	mov    %esp,%ebp
+  800f0d:	57                   	push   %edi
+  800f0e:	56                   	push   %esi
+  800f0f:	53                   	push   %ebx
+  800f10:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f23:	89 df                	mov    %ebx,%edi
+  800f25:	89 de                	mov    %ebx,%esi
+  800f27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 08                	push   $0x8
+  800f3b:	68 ab 52 80 00       	push   $0x8052ab
+  800f40:	6a 23                	push   $0x23
+  800f42:	68 c8 52 80 00       	push   $0x8052c8
+  800f47:	e8 f1 f2 ff ff       	call   80023d <_panic>
+
+00800f4c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f65:	89 df                	mov    %ebx,%edi
+  800f67:	89 de                	mov    %ebx,%esi
+  800f69:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6b:	85 c0                	test   %eax,%eax
+  800f6d:	7f 08                	jg     800f77 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f72:	5b                   	pop    %ebx
+  800f73:	5e                   	pop    %esi
+  800f74:	5f                   	pop    %edi
+  800f75:	5d                   	pop    %ebp
+  800f76:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  800f7a:	50                   	push   %eax
+  800f7b:	6a 09                	push   $0x9
+  800f7d:	68 ab 52 80 00       	push   $0x8052ab
+  800f82:	6a 23                	push   $0x23
+  800f84:	68 c8 52 80 00       	push   $0x8052c8
+  800f89:	e8 af f2 ff ff       	call   80023d <_panic>
+
+00800f8e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f8e:	55                   	push   %ebp
+  800f8f:	89 e5                	mov    %esp,%ebp
+  800f91:	57                   	push   %edi
+  800f92:	56                   	push   %esi
+  800f93:	53                   	push   %ebx
+  800f94:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa7:	89 df                	mov    %ebx,%edi
+  800fa9:	89 de                	mov    %ebx,%esi
+  800fab:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 0a                	push   $0xa
+  800fbf:	68 ab 52 80 00       	push   $0x8052ab
+  800fc4:	6a 23                	push   $0x23
+  800fc6:	68 c8 52 80 00       	push   $0x8052c8
+  800fcb:	e8 6d f2 ff ff       	call   80023d <_panic>
+
+00800fd0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fec:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800fee:	5b                   	pop    %ebx
+  800fef:	5e                   	pop    %esi
+  800ff0:	5f                   	pop    %edi
+  800ff1:	5d                   	pop    %ebp
+  800ff2:	c3                   	ret
+
+00800ff3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801009:	89 cb                	mov    %ecx,%ebx
+  80100b:	89 cf                	mov    %ecx,%edi
+  80100d:	89 ce                	mov    %ecx,%esi
+  80100f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801011:	85 c0                	test   %eax,%eax
+  801013:	7f 08                	jg     80101d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801015:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  801020:	50                   	push   %eax
+  801021:	6a 0d                	push   $0xd
+  801023:	68 ab 52 80 00       	push   $0x8052ab
+  801028:	6a 23                	push   $0x23
+  80102a:	68 c8 52 80 00       	push   $0x8052c8
+  80102f:	e8 09 f2 ff ff       	call   80023d <_panic>
+
+00801034 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	57                   	push   %edi
+  801038:	56                   	push   %esi
+  801039:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801040:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801048:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80104e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+
+00801055 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  80105b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80105e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106e:	89 df                	mov    %ebx,%edi
+  801070:	89 de                	mov    %ebx,%esi
+  801072:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801074:	85 c0                	test   %eax,%eax
+  801076:	7f 08                	jg     801080 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801078:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107b:	5b                   	pop    %ebx
+  80107c:	5e                   	pop    %esi
+  80107d:	5f                   	pop    %edi
+  80107e:	5d                   	pop    %ebp
+  80107f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  801083:	50                   	push   %eax
+  801084:	6a 0d                	push   $0xd
+  801086:	68 ab 52 80 00       	push   $0x8052ab
+  80108b:	6a 23                	push   $0x23
+  80108d:	68 c8 52 80 00       	push   $0x8052c8
+  801092:	e8 a6 f1 ff ff       	call   80023d <_panic>
+
+00801097 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801097:	55                   	push   %ebp
+  801098:	89 e5                	mov    %esp,%ebp
+  80109a:	57                   	push   %edi
+  80109b:	56                   	push   %esi
+  80109c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010a7:	89 d1                	mov    %edx,%ecx
+  8010a9:	89 d3                	mov    %edx,%ebx
+  8010ab:	89 d7                	mov    %edx,%edi
+  8010ad:	89 d6                	mov    %edx,%esi
+  8010af:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010b1:	5b                   	pop    %ebx
+  8010b2:	5e                   	pop    %esi
+  8010b3:	5f                   	pop    %edi
+  8010b4:	5d                   	pop    %ebp
+  8010b5:	c3                   	ret
+
+008010b6 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010cc:	89 df                	mov    %ebx,%edi
+  8010ce:	89 de                	mov    %ebx,%esi
+  8010d0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+
+008010d7 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010ea:	89 cb                	mov    %ecx,%ebx
+  8010ec:	89 cf                	mov    %ecx,%edi
+  8010ee:	89 ce                	mov    %ecx,%esi
+  8010f0:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8010f2:	5b                   	pop    %ebx
+  8010f3:	5e                   	pop    %esi
+  8010f4:	5f                   	pop    %edi
+  8010f5:	5d                   	pop    %ebp
+  8010f6:	c3                   	ret
+
+008010f7 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801102:	8b 55 08             	mov    0x8(%ebp),%edx
+  801105:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801108:	b8 11 00 00 00       	mov    $0x11,%eax
+  80110d:	89 df                	mov    %ebx,%edi
+  80110f:	89 de                	mov    %ebx,%esi
+  801111:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80111e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801123:	8b 55 08             	mov    0x8(%ebp),%edx
+  801126:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801129:	b8 12 00 00 00       	mov    $0x12,%eax
+  80112e:	89 df                	mov    %ebx,%edi
+  801130:	89 de                	mov    %ebx,%esi
+  801132:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+
+00801139 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801139:	55                   	push   %ebp
+  80113a:	89 e5                	mov    %esp,%ebp
+  80113c:	57                   	push   %edi
+  80113d:	56                   	push   %esi
+  80113e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80113f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801144:	8b 55 08             	mov    0x8(%ebp),%edx
+  801147:	b8 13 00 00 00       	mov    $0x13,%eax
+  80114c:	89 cb                	mov    %ecx,%ebx
+  80114e:	89 cf                	mov    %ecx,%edi
+  801150:	89 ce                	mov    %ecx,%esi
+  801152:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80115f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801164:	8b 55 08             	mov    0x8(%ebp),%edx
+  801167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80116f:	89 df                	mov    %ebx,%edi
+  801171:	89 de                	mov    %ebx,%esi
+  801173:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801175:	5b                   	pop    %ebx
+  801176:	5e                   	pop    %esi
+  801177:	5f                   	pop    %edi
+  801178:	5d                   	pop    %ebp
+  801179:	c3                   	ret
+
+0080117a <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80117a:	55                   	push   %ebp
+  80117b:	89 e5                	mov    %esp,%ebp
+  80117d:	57                   	push   %edi
+  80117e:	56                   	push   %esi
+  80117f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801180:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	b8 15 00 00 00       	mov    $0x15,%eax
+  80118d:	89 cb                	mov    %ecx,%ebx
+  80118f:	89 cf                	mov    %ecx,%edi
+  801191:	89 ce                	mov    %ecx,%esi
+  801193:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011b0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b3:	89 f7                	mov    %esi,%edi
+  8011b5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8011b7:	5b                   	pop    %ebx
+  8011b8:	5e                   	pop    %esi
+  8011b9:	5f                   	pop    %edi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+
+008011bc <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8011bc:	55                   	push   %ebp
+  8011bd:	89 e5                	mov    %esp,%ebp
+  8011bf:	57                   	push   %edi
+  8011c0:	56                   	push   %esi
+  8011c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cd:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011d2:	89 df                	mov    %ebx,%edi
+  8011d4:	89 de                	mov    %ebx,%esi
+  8011d6:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011f0:	89 cb                	mov    %ecx,%ebx
+  8011f2:	89 cf                	mov    %ecx,%edi
+  8011f4:	89 ce                	mov    %ecx,%esi
+  8011f6:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8011f8:	5b                   	pop    %ebx
+  8011f9:	5e                   	pop    %esi
+  8011fa:	5f                   	pop    %edi
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+
+008011fd <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8011fd:	55                   	push   %ebp
+  8011fe:	89 e5                	mov    %esp,%ebp
+  801200:	57                   	push   %edi
+  801201:	56                   	push   %esi
+  801202:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801203:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801207:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801214:	89 df                	mov    %ebx,%edi
+  801216:	89 de                	mov    %ebx,%esi
+  801218:	cd 30                	int    $0x30
+}
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+
+0080121f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80121f:	55                   	push   %ebp
+  801220:	89 e5                	mov    %esp,%ebp
+  801222:	57                   	push   %edi
+  801223:	56                   	push   %esi
+  801224:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801225:	be 00 00 00 00       	mov    $0x0,%esi
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801230:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801235:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801238:	89 f7                	mov    %esi,%edi
+  80123a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80123c:	5b                   	pop    %ebx
+  80123d:	5e                   	pop    %esi
+  80123e:	5f                   	pop    %edi
+  80123f:	5d                   	pop    %ebp
+  801240:	c3                   	ret
+
+00801241 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	57                   	push   %edi
+  801245:	56                   	push   %esi
+  801246:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801247:	be 00 00 00 00       	mov    $0x0,%esi
+  80124c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801252:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801257:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125a:	89 f7                	mov    %esi,%edi
+  80125c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80125e:	5b                   	pop    %ebx
+  80125f:	5e                   	pop    %esi
+  801260:	5f                   	pop    %edi
+  801261:	5d                   	pop    %ebp
+  801262:	c3                   	ret
+
+00801263 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	89 de                	mov    %ebx,%esi
+  80127d:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128a:	be 00 00 00 00       	mov    $0x0,%esi
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801295:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80129a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129d:	89 f7                	mov    %esi,%edi
+  80129f:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5e                   	pop    %esi
+  8012a3:	5f                   	pop    %edi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+
+008012a6 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	74 20                	je     8012ca <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8012aa:	89 c1                	mov    %eax,%ecx
+  8012ac:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012b2:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8012b8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8012be:	8b 52 48             	mov    0x48(%edx),%edx
+  8012c1:	39 c2                	cmp    %eax,%edx
+  8012c3:	74 06                	je     8012cb <thread_alive+0x25>
+  8012c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012ca:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8012cb:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8012d1:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	0f 95 c0             	setne  %al
+  8012dc:	0f b6 c0             	movzbl %al,%eax
+  8012df:	c3                   	ret
+
+008012e0 <pgfault>:
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	57                   	push   %edi
+  8012e4:	56                   	push   %esi
+  8012e5:	53                   	push   %ebx
+  8012e6:	83 ec 0c             	sub    $0xc,%esp
+  8012e9:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8012ec:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8012ee:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8012f1:	89 f3                	mov    %esi,%ebx
+  8012f3:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8012f6:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8012fd:	74 52                	je     801351 <pgfault+0x71>
+  8012ff:	a8 02                	test   $0x2,%al
+  801301:	75 14                	jne    801317 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801303:	83 ec 04             	sub    $0x4,%esp
+  801306:	68 d6 52 80 00       	push   $0x8052d6
+  80130b:	6a 2e                	push   $0x2e
+  80130d:	68 f4 52 80 00       	push   $0x8052f4
+  801312:	e8 26 ef ff ff       	call   80023d <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801317:	89 d8                	mov    %ebx,%eax
+  801319:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80131e:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801325:	83 ec 0c             	sub    $0xc,%esp
+  801328:	57                   	push   %edi
+  801329:	e8 65 32 00 00       	call   804593 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  80132e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801335:	83 e0 03             	and    $0x3,%eax
+  801338:	83 c4 10             	add    $0x10,%esp
+  80133b:	83 f8 03             	cmp    $0x3,%eax
+  80133e:	75 1a                	jne    80135a <pgfault+0x7a>
+			mutex_unlock(m);
+  801340:	83 ec 0c             	sub    $0xc,%esp
+  801343:	57                   	push   %edi
+  801344:	e8 b8 32 00 00       	call   804601 <mutex_unlock>
+			return;
+  801349:	83 c4 10             	add    $0x10,%esp
+  80134c:	e9 9f 00 00 00       	jmp    8013f0 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801351:	a8 02                	test   $0x2,%al
+  801353:	74 ae                	je     801303 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801355:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80135a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801361:	f6 c4 08             	test   $0x8,%ah
+  801364:	74 9d                	je     801303 <pgfault+0x23>
+  801366:	89 e0                	mov    %esp,%eax
+  801368:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80136d:	29 c2                	sub    %eax,%edx
+  80136f:	89 d0                	mov    %edx,%eax
+  801371:	c1 e8 0f             	shr    $0xf,%eax
+  801374:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80137a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80137f:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801382:	c1 e0 0c             	shl    $0xc,%eax
+  801385:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80138a:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80138c:	83 ec 04             	sub    $0x4,%esp
+  80138f:	6a 07                	push   $0x7
+  801391:	53                   	push   %ebx
+  801392:	6a 00                	push   $0x0
+  801394:	e8 aa fa ff ff       	call   800e43 <sys_page_alloc>
+  801399:	83 c4 10             	add    $0x10,%esp
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	78 58                	js     8013f8 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8013a0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8013a6:	83 ec 04             	sub    $0x4,%esp
+  8013a9:	68 00 10 00 00       	push   $0x1000
+  8013ae:	56                   	push   %esi
+  8013af:	53                   	push   %ebx
+  8013b0:	e8 0a f8 ff ff       	call   800bbf <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8013b5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8013bc:	56                   	push   %esi
+  8013bd:	6a 00                	push   $0x0
+  8013bf:	53                   	push   %ebx
+  8013c0:	6a 00                	push   $0x0
+  8013c2:	e8 bf fa ff ff       	call   800e86 <sys_page_map>
+  8013c7:	83 c4 20             	add    $0x20,%esp
+  8013ca:	85 c0                	test   %eax,%eax
+  8013cc:	78 3c                	js     80140a <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8013ce:	83 ec 08             	sub    $0x8,%esp
+  8013d1:	53                   	push   %ebx
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	e8 ef fa ff ff       	call   800ec8 <sys_page_unmap>
+  8013d9:	83 c4 10             	add    $0x10,%esp
+  8013dc:	85 c0                	test   %eax,%eax
+  8013de:	78 3c                	js     80141c <pgfault+0x13c>
+	if(m)
+  8013e0:	85 ff                	test   %edi,%edi
+  8013e2:	74 0c                	je     8013f0 <pgfault+0x110>
+		mutex_unlock(m);
+  8013e4:	83 ec 0c             	sub    $0xc,%esp
+  8013e7:	57                   	push   %edi
+  8013e8:	e8 14 32 00 00       	call   804601 <mutex_unlock>
+  8013ed:	83 c4 10             	add    $0x10,%esp
+}
+  8013f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f3:	5b                   	pop    %ebx
+  8013f4:	5e                   	pop    %esi
+  8013f5:	5f                   	pop    %edi
+  8013f6:	5d                   	pop    %ebp
+  8013f7:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8013f8:	50                   	push   %eax
+  8013f9:	68 ac 4e 80 00       	push   $0x804eac
+  8013fe:	6a 3d                	push   $0x3d
+  801400:	68 f4 52 80 00       	push   $0x8052f4
+  801405:	e8 33 ee ff ff       	call   80023d <_panic>
+		panic("sys_page_map: %e", ret);
+  80140a:	50                   	push   %eax
+  80140b:	68 ff 52 80 00       	push   $0x8052ff
+  801410:	6a 40                	push   $0x40
+  801412:	68 f4 52 80 00       	push   $0x8052f4
+  801417:	e8 21 ee ff ff       	call   80023d <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80141c:	50                   	push   %eax
+  80141d:	68 10 53 80 00       	push   $0x805310
+  801422:	6a 42                	push   $0x42
+  801424:	68 f4 52 80 00       	push   $0x8052f4
+  801429:	e8 0f ee ff ff       	call   80023d <_panic>
+
+0080142e <thread_main>:
+{
+  80142e:	55                   	push   %ebp
+  80142f:	89 e5                	mov    %esp,%ebp
+  801431:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801434:	ff 75 0c             	push   0xc(%ebp)
+  801437:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80143a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801441:	e8 7e f9 ff ff       	call   800dc4 <sys_env_destroy>
+}
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	c9                   	leave
+  80144a:	c3                   	ret
+
+0080144b <fork>:
+{
+  80144b:	55                   	push   %ebp
+  80144c:	89 e5                	mov    %esp,%ebp
+  80144e:	57                   	push   %edi
+  80144f:	56                   	push   %esi
+  801450:	53                   	push   %ebx
+  801451:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801454:	68 e0 12 80 00       	push   $0x8012e0
+  801459:	e8 81 34 00 00       	call   8048df <set_pgfault_handler>
+	if(sforked)
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  801468:	75 33                	jne    80149d <fork+0x52>
+	__asm __volatile("int %2"
+  80146a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80146f:	cd 30                	int    $0x30
+  801471:	89 c7                	mov    %eax,%edi
+  801473:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801475:	85 c0                	test   %eax,%eax
+  801477:	0f 88 b4 00 00 00    	js     801531 <fork+0xe6>
+	if(envid == 0) {
+  80147d:	0f 84 c3 00 00 00    	je     801546 <fork+0xfb>
+	pgbatch_init(&pb);
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	68 20 73 80 00       	push   $0x807320
+  80148b:	e8 4f 2f 00 00       	call   8043df <pgbatch_init>
+  801490:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801493:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801498:	e9 9c 01 00 00       	jmp    801639 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80149d:	83 ec 0c             	sub    $0xc,%esp
+  8014a0:	68 c0 76 80 00       	push   $0x8076c0
+  8014a5:	e8 e9 30 00 00       	call   804593 <mutex_lock>
+  8014aa:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8014ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8014b2:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8014b7:	eb 08                	jmp    8014c1 <fork+0x76>
+  8014b9:	83 c3 01             	add    $0x1,%ebx
+  8014bc:	83 fb 20             	cmp    $0x20,%ebx
+  8014bf:	74 5b                	je     80151c <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8014c1:	8b 34 9d 40 76 80 00 	mov    0x807640(,%ebx,4),%esi
+  8014c8:	89 f0                	mov    %esi,%eax
+  8014ca:	e8 d7 fd ff ff       	call   8012a6 <thread_alive>
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	74 e6                	je     8014b9 <fork+0x6e>
+  8014d3:	89 e0                	mov    %esp,%eax
+  8014d5:	89 fa                	mov    %edi,%edx
+  8014d7:	29 c2                	sub    %eax,%edx
+  8014d9:	89 d0                	mov    %edx,%eax
+  8014db:	c1 e8 0f             	shr    $0xf,%eax
+  8014de:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e9:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8014ec:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  8014f3:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8014f6:	83 ec 08             	sub    $0x8,%esp
+  8014f9:	50                   	push   %eax
+  8014fa:	56                   	push   %esi
+  8014fb:	e8 8e fa ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	85 c0                	test   %eax,%eax
+  801505:	79 b2                	jns    8014b9 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801507:	50                   	push   %eax
+  801508:	68 9c 53 80 00       	push   $0x80539c
+  80150d:	68 00 01 00 00       	push   $0x100
+  801512:	68 f4 52 80 00       	push   $0x8052f4
+  801517:	e8 21 ed ff ff       	call   80023d <_panic>
+	mutex_unlock(&sfork_lock);
+  80151c:	83 ec 0c             	sub    $0xc,%esp
+  80151f:	68 c0 76 80 00       	push   $0x8076c0
+  801524:	e8 d8 30 00 00       	call   804601 <mutex_unlock>
+}
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	e9 39 ff ff ff       	jmp    80146a <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801531:	50                   	push   %eax
+  801532:	68 23 53 80 00       	push   $0x805323
+  801537:	68 91 00 00 00       	push   $0x91
+  80153c:	68 f4 52 80 00       	push   $0x8052f4
+  801541:	e8 f7 ec ff ff       	call   80023d <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801546:	e8 ba f8 ff ff       	call   800e05 <sys_getenvid>
+  80154b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801550:	89 e1                	mov    %esp,%ecx
+  801552:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801557:	29 ca                	sub    %ecx,%edx
+  801559:	89 d1                	mov    %edx,%ecx
+  80155b:	c1 e9 0f             	shr    $0xf,%ecx
+  80155e:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801564:	ba 00 00 00 00       	mov    $0x0,%edx
+  801569:	0f 42 d1             	cmovb  %ecx,%edx
+  80156c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801572:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801577:	89 04 95 40 80 80 00 	mov    %eax,0x808040(,%edx,4)
+		if(sforked)
+  80157e:	a1 c0 80 80 00       	mov    0x8080c0,%eax
+  801583:	85 c0                	test   %eax,%eax
+  801585:	75 07                	jne    80158e <fork+0x143>
+		return 0;
+  801587:	89 c6                	mov    %eax,%esi
+  801589:	e9 6f 02 00 00       	jmp    8017fd <fork+0x3b2>
+  80158e:	89 e2                	mov    %esp,%edx
+  801590:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801595:	29 d0                	sub    %edx,%eax
+  801597:	89 c3                	mov    %eax,%ebx
+  801599:	c1 eb 0f             	shr    $0xf,%ebx
+  80159c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8015a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a6:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8015a9:	83 ec 04             	sub    $0x4,%esp
+  8015ac:	68 80 00 00 00       	push   $0x80
+  8015b1:	6a 00                	push   $0x0
+  8015b3:	68 40 76 80 00       	push   $0x807640
+  8015b8:	e8 cd f5 ff ff       	call   800b8a <memset>
+	thread_ids[slot] = sys_getenvid();
+  8015bd:	e8 43 f8 ff ff       	call   800e05 <sys_getenvid>
+  8015c2:	89 04 9d 40 76 80 00 	mov    %eax,0x807640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8015c9:	8b 04 9d 40 80 80 00 	mov    0x808040(,%ebx,4),%eax
+  8015d0:	a3 40 80 80 00       	mov    %eax,0x808040
+	mutex_init(&sfork_lock);
+  8015d5:	c7 04 24 c0 76 80 00 	movl   $0x8076c0,(%esp)
+  8015dc:	e8 a4 2f 00 00       	call   804585 <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8015e1:	83 c4 0c             	add    $0xc,%esp
+  8015e4:	68 07 04 00 00       	push   $0x407
+  8015e9:	68 00 00 00 e1       	push   $0xe1000000
+  8015ee:	6a 00                	push   $0x0
+  8015f0:	e8 4e f8 ff ff       	call   800e43 <sys_page_alloc>
+  8015f5:	83 c4 10             	add    $0x10,%esp
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	0f 89 fd 01 00 00    	jns    8017fd <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801600:	50                   	push   %eax
+  801601:	68 ac 4e 80 00       	push   $0x804eac
+  801606:	68 12 01 00 00       	push   $0x112
+  80160b:	68 f4 52 80 00       	push   $0x8052f4
+  801610:	e8 28 ec ff ff       	call   80023d <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801615:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80161b:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801621:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801627:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80162d:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801633:	0f 87 4f 01 00 00    	ja     801788 <fork+0x33d>
+		pd = PDX(addr);
+  801639:	89 d8                	mov    %ebx,%eax
+  80163b:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  80163e:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801645:	f6 c2 01             	test   $0x1,%dl
+  801648:	74 cb                	je     801615 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80164a:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  80164f:	0f 85 92 00 00 00    	jne    8016e7 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801655:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80165b:	76 10                	jbe    80166d <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80165d:	89 d8                	mov    %ebx,%eax
+  80165f:	f7 d8                	neg    %eax
+  801661:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801666:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80166b:	74 ba                	je     801627 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80166d:	89 d8                	mov    %ebx,%eax
+  80166f:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801672:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801679:	f6 c2 01             	test   $0x1,%dl
+  80167c:	74 a9                	je     801627 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  80167e:	89 c1                	mov    %eax,%ecx
+  801680:	c1 e1 0c             	shl    $0xc,%ecx
+  801683:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801686:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80168d:	f6 c6 04             	test   $0x4,%dh
+  801690:	0f 85 8e 00 00 00    	jne    801724 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801696:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80169d:	f6 c6 08             	test   $0x8,%dh
+  8016a0:	75 0f                	jne    8016b1 <fork+0x266>
+  8016a2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016a9:	a8 02                	test   $0x2,%al
+  8016ab:	0f 84 bb 00 00 00    	je     80176c <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8016b1:	83 ec 08             	sub    $0x8,%esp
+  8016b4:	68 05 08 00 00       	push   $0x805
+  8016b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016bc:	50                   	push   %eax
+  8016bd:	56                   	push   %esi
+  8016be:	50                   	push   %eax
+  8016bf:	6a 00                	push   $0x0
+  8016c1:	68 20 73 80 00       	push   $0x807320
+  8016c6:	e8 d2 2d 00 00       	call   80449d <pgbatch_map>
+  8016cb:	83 c4 20             	add    $0x20,%esp
+  8016ce:	85 c0                	test   %eax,%eax
+  8016d0:	79 76                	jns    801748 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8016d2:	50                   	push   %eax
+  8016d3:	68 47 53 80 00       	push   $0x805347
+  8016d8:	68 bc 00 00 00       	push   $0xbc
+  8016dd:	68 f4 52 80 00       	push   $0x8052f4
+  8016e2:	e8 56 eb ff ff       	call   80023d <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8016e7:	83 ec 0c             	sub    $0xc,%esp
+  8016ea:	68 00 08 00 00       	push   $0x800
+  8016ef:	56                   	push   %esi
+  8016f0:	53                   	push   %ebx
+  8016f1:	6a 00                	push   $0x0
+  8016f3:	68 20 73 80 00       	push   $0x807320
+  8016f8:	e8 4b 2e 00 00       	call   804548 <pgbatch_sharept>
+  8016fd:	83 c4 20             	add    $0x20,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 0b                	js     80170f <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801704:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80170a:	e9 18 ff ff ff       	jmp    801627 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  80170f:	50                   	push   %eax
+  801710:	68 33 53 80 00       	push   $0x805333
+  801715:	68 b2 00 00 00       	push   $0xb2
+  80171a:	68 f4 52 80 00       	push   $0x8052f4
+  80171f:	e8 19 eb ff ff       	call   80023d <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801724:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80172b:	83 ec 08             	sub    $0x8,%esp
+  80172e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801733:	50                   	push   %eax
+  801734:	51                   	push   %ecx
+  801735:	56                   	push   %esi
+  801736:	51                   	push   %ecx
+  801737:	6a 00                	push   $0x0
+  801739:	68 20 73 80 00       	push   $0x807320
+  80173e:	e8 5a 2d 00 00       	call   80449d <pgbatch_map>
+  801743:	83 c4 20             	add    $0x20,%esp
+  801746:	eb 17                	jmp    80175f <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801748:	68 05 08 00 00       	push   $0x805
+  80174d:	ff 75 e4             	push   -0x1c(%ebp)
+  801750:	6a 00                	push   $0x0
+  801752:	68 20 73 80 00       	push   $0x807320
+  801757:	e8 b5 2d 00 00       	call   804511 <pgbatch_protect>
+  80175c:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	0f 89 c0 fe ff ff    	jns    801627 <fork+0x1dc>
+  801767:	e9 66 ff ff ff       	jmp    8016d2 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	6a 05                	push   $0x5
+  801771:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801774:	50                   	push   %eax
+  801775:	56                   	push   %esi
+  801776:	50                   	push   %eax
+  801777:	6a 00                	push   $0x0
+  801779:	68 20 73 80 00       	push   $0x807320
+  80177e:	e8 1a 2d 00 00       	call   80449d <pgbatch_map>
+  801783:	83 c4 20             	add    $0x20,%esp
+  801786:	eb d7                	jmp    80175f <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801788:	6a 07                	push   $0x7
+  80178a:	68 00 f0 bf ee       	push   $0xeebff000
+  80178f:	57                   	push   %edi
+  801790:	68 20 73 80 00       	push   $0x807320
+  801795:	e8 cc 2c 00 00       	call   804466 <pgbatch_alloc>
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 66                	js     801807 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  8017a1:	83 ec 0c             	sub    $0xc,%esp
+  8017a4:	68 20 73 80 00       	push   $0x807320
+  8017a9:	e8 3f 2c 00 00       	call   8043ed <pgbatch_flush>
+  8017ae:	83 c4 10             	add    $0x10,%esp
+  8017b1:	85 c0                	test   %eax,%eax
+  8017b3:	78 52                	js     801807 <fork+0x3bc>
+  8017b5:	89 e2                	mov    %esp,%edx
+  8017b7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8017bc:	29 d0                	sub    %edx,%eax
+  8017be:	89 c2                	mov    %eax,%edx
+  8017c0:	c1 ea 0f             	shr    $0xf,%edx
+  8017c3:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cd:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  8017d0:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  8017d7:	8b 40 78             	mov    0x78(%eax),%eax
+  8017da:	83 ec 08             	sub    $0x8,%esp
+  8017dd:	50                   	push   %eax
+  8017de:	57                   	push   %edi
+  8017df:	e8 aa f7 ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  8017e4:	83 c4 10             	add    $0x10,%esp
+  8017e7:	85 c0                	test   %eax,%eax
+  8017e9:	78 31                	js     80181c <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  8017eb:	83 ec 08             	sub    $0x8,%esp
+  8017ee:	6a 02                	push   $0x2
+  8017f0:	57                   	push   %edi
+  8017f1:	e8 14 f7 ff ff       	call   800f0a <sys_env_set_status>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	85 c0                	test   %eax,%eax
+  8017fb:	78 34                	js     801831 <fork+0x3e6>
+}
+  8017fd:	89 f0                	mov    %esi,%eax
+  8017ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801802:	5b                   	pop    %ebx
+  801803:	5e                   	pop    %esi
+  801804:	5f                   	pop    %edi
+  801805:	5d                   	pop    %ebp
+  801806:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801807:	50                   	push   %eax
+  801808:	68 53 53 80 00       	push   $0x805353
+  80180d:	68 c0 00 00 00       	push   $0xc0
+  801812:	68 f4 52 80 00       	push   $0x8052f4
+  801817:	e8 21 ea ff ff       	call   80023d <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  80181c:	50                   	push   %eax
+  80181d:	68 68 53 80 00       	push   $0x805368
+  801822:	68 c2 00 00 00       	push   $0xc2
+  801827:	68 f4 52 80 00       	push   $0x8052f4
+  80182c:	e8 0c ea ff ff       	call   80023d <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801831:	50                   	push   %eax
+  801832:	68 83 53 80 00       	push   $0x805383
+  801837:	68 c4 00 00 00       	push   $0xc4
+  80183c:	68 f4 52 80 00       	push   $0x8052f4
+  801841:	e8 f7 e9 ff ff       	call   80023d <_panic>
+
+00801846 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801846:	55                   	push   %ebp
+  801847:	89 e5                	mov    %esp,%ebp
+  801849:	57                   	push   %edi
+  80184a:	56                   	push   %esi
+  80184b:	53                   	push   %ebx
+  80184c:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80184f:	68 c0 76 80 00       	push   $0x8076c0
+  801854:	e8 3a 2d 00 00       	call   804593 <mutex_lock>
+  801859:	89 e2                	mov    %esp,%edx
+  80185b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801860:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801862:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801865:	89 c3                	mov    %eax,%ebx
+  801867:	c1 eb 0f             	shr    $0xf,%ebx
+  80186a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80186f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801874:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801877:	e8 89 f5 ff ff       	call   800e05 <sys_getenvid>
+  80187c:	89 04 9d 40 76 80 00 	mov    %eax,0x807640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801883:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801888:	8b 04 9d 40 76 80 00 	mov    0x807640(,%ebx,4),%eax
+  80188f:	e8 12 fa ff ff       	call   8012a6 <thread_alive>
+  801894:	85 c0                	test   %eax,%eax
+  801896:	74 24                	je     8018bc <sfork+0x76>
+  801898:	83 c3 01             	add    $0x1,%ebx
+  80189b:	83 fb 20             	cmp    $0x20,%ebx
+  80189e:	75 e8                	jne    801888 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  8018a0:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+  8018a8:	68 c0 76 80 00       	push   $0x8076c0
+  8018ad:	e8 4f 2d 00 00       	call   804601 <mutex_unlock>
+	return r;
+}
+  8018b2:	89 f0                	mov    %esi,%eax
+  8018b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b7:	5b                   	pop    %ebx
+  8018b8:	5e                   	pop    %esi
+  8018b9:	5f                   	pop    %edi
+  8018ba:	5d                   	pop    %ebp
+  8018bb:	c3                   	ret
+	if (i == NTHREADS) {
+  8018bc:	83 fb 20             	cmp    $0x20,%ebx
+  8018bf:	0f 84 53 01 00 00    	je     801a18 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  8018c5:	89 d8                	mov    %ebx,%eax
+  8018c7:	c1 e0 0f             	shl    $0xf,%eax
+  8018ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  8018cd:	83 ec 0c             	sub    $0xc,%esp
+  8018d0:	68 00 70 80 00       	push   $0x807000
+  8018d5:	e8 05 2b 00 00       	call   8043df <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8018e4:	75 1f                	jne    801905 <sfork+0xbf>
+  8018e6:	68 07 04 00 00       	push   $0x407
+  8018eb:	68 00 00 00 e1       	push   $0xe1000000
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	68 00 70 80 00       	push   $0x807000
+  8018f7:	e8 6a 2b 00 00       	call   804466 <pgbatch_alloc>
+  8018fc:	89 c6                	mov    %eax,%esi
+  8018fe:	83 c4 10             	add    $0x10,%esp
+  801901:	85 c0                	test   %eax,%eax
+  801903:	78 a0                	js     8018a5 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801905:	6a 07                	push   $0x7
+  801907:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  80190c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80190f:	29 c8                	sub    %ecx,%eax
+  801911:	50                   	push   %eax
+  801912:	6a 00                	push   $0x0
+  801914:	68 00 70 80 00       	push   $0x807000
+  801919:	e8 48 2b 00 00       	call   804466 <pgbatch_alloc>
+  80191e:	89 c6                	mov    %eax,%esi
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	0f 88 7a ff ff ff    	js     8018a5 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  80192b:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801930:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801933:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801935:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  80193a:	29 c8                	sub    %ecx,%eax
+  80193c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80193f:	39 c7                	cmp    %eax,%edi
+  801941:	73 29                	jae    80196c <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801943:	6a 07                	push   $0x7
+  801945:	57                   	push   %edi
+  801946:	6a 00                	push   $0x0
+  801948:	68 00 70 80 00       	push   $0x807000
+  80194d:	e8 14 2b 00 00       	call   804466 <pgbatch_alloc>
+  801952:	89 c6                	mov    %eax,%esi
+  801954:	83 c4 10             	add    $0x10,%esp
+  801957:	85 c0                	test   %eax,%eax
+  801959:	0f 88 46 ff ff ff    	js     8018a5 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  80195f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801965:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801968:	39 c7                	cmp    %eax,%edi
+  80196a:	72 d7                	jb     801943 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  80196c:	83 ec 0c             	sub    $0xc,%esp
+  80196f:	68 00 70 80 00       	push   $0x807000
+  801974:	e8 74 2a 00 00       	call   8043ed <pgbatch_flush>
+  801979:	89 c6                	mov    %eax,%esi
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	0f 88 1f ff ff ff    	js     8018a5 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801986:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  80198b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80198e:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801990:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801996:	8b 55 08             	mov    0x8(%ebp),%edx
+  801999:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  80199c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80199f:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019a2:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  8019a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8019aa:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  8019ac:	52                   	push   %edx
+  8019ad:	50                   	push   %eax
+  8019ae:	68 2e 14 80 00       	push   $0x80142e
+  8019b3:	e8 cc f8 ff ff       	call   801284 <sys_exofork_shared>
+  8019b8:	89 c6                	mov    %eax,%esi
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	0f 88 e0 fe ff ff    	js     8018a5 <sfork+0x5f>
+	thread_ids[i] = id;
+  8019c5:	89 04 9d 40 76 80 00 	mov    %eax,0x807640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  8019cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019d1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8019d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019dc:	89 04 9d 40 80 80 00 	mov    %eax,0x808040(,%ebx,4)
+	sforked = 1;
+  8019e3:	c7 05 c0 80 80 00 01 	movl   $0x1,0x8080c0
+  8019ea:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  8019ed:	83 ec 08             	sub    $0x8,%esp
+  8019f0:	6a 02                	push   $0x2
+  8019f2:	56                   	push   %esi
+  8019f3:	e8 12 f5 ff ff       	call   800f0a <sys_env_set_status>
+  8019f8:	89 c3                	mov    %eax,%ebx
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	0f 89 a0 fe ff ff    	jns    8018a5 <sfork+0x5f>
+		sys_env_destroy(id);
+  801a05:	83 ec 0c             	sub    $0xc,%esp
+  801a08:	56                   	push   %esi
+  801a09:	e8 b6 f3 ff ff       	call   800dc4 <sys_env_destroy>
+		goto out;
+  801a0e:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801a11:	89 de                	mov    %ebx,%esi
+		goto out;
+  801a13:	e9 8d fe ff ff       	jmp    8018a5 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801a18:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801a1d:	e9 83 fe ff ff       	jmp    8018a5 <sfork+0x5f>
+
+00801a22 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a22:	55                   	push   %ebp
+  801a23:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a28:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a2d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a30:	5d                   	pop    %ebp
+  801a31:	c3                   	ret
+
+00801a32 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a32:	55                   	push   %ebp
+  801a33:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a38:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a3d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a42:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+
+00801a49 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a51:	89 c2                	mov    %eax,%edx
+  801a53:	c1 ea 16             	shr    $0x16,%edx
+  801a56:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a5d:	f6 c2 01             	test   $0x1,%dl
+  801a60:	74 29                	je     801a8b <fd_alloc+0x42>
+  801a62:	89 c2                	mov    %eax,%edx
+  801a64:	c1 ea 0c             	shr    $0xc,%edx
+  801a67:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a6e:	f6 c2 01             	test   $0x1,%dl
+  801a71:	74 18                	je     801a8b <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801a73:	05 00 10 00 00       	add    $0x1000,%eax
+  801a78:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801a7d:	75 d2                	jne    801a51 <fd_alloc+0x8>
+  801a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a84:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a89:	eb 05                	jmp    801a90 <fd_alloc+0x47>
+			return 0;
+  801a8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801a90:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a93:	89 02                	mov    %eax,(%edx)
+}
+  801a95:	89 c8                	mov    %ecx,%eax
+  801a97:	5d                   	pop    %ebp
+  801a98:	c3                   	ret
+
+00801a99 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a99:	55                   	push   %ebp
+  801a9a:	89 e5                	mov    %esp,%ebp
+  801a9c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801a9f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801aa4:	77 30                	ja     801ad6 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801aa6:	c1 e0 0c             	shl    $0xc,%eax
+  801aa9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801aae:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801ab4:	f6 c2 01             	test   $0x1,%dl
+  801ab7:	74 24                	je     801add <fd_lookup+0x44>
+  801ab9:	89 c2                	mov    %eax,%edx
+  801abb:	c1 ea 0c             	shr    $0xc,%edx
+  801abe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ac5:	f6 c2 01             	test   $0x1,%dl
+  801ac8:	74 1a                	je     801ae4 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801aca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801acd:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801acf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad4:	5d                   	pop    %ebp
+  801ad5:	c3                   	ret
+		return -E_INVAL;
+  801ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801adb:	eb f7                	jmp    801ad4 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae2:	eb f0                	jmp    801ad4 <fd_lookup+0x3b>
+  801ae4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae9:	eb e9                	jmp    801ad4 <fd_lookup+0x3b>
+
+00801aeb <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801aeb:	55                   	push   %ebp
+  801aec:	89 e5                	mov    %esp,%ebp
+  801aee:	53                   	push   %ebx
+  801aef:	83 ec 04             	sub    $0x4,%esp
+  801af2:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801afa:	bb 20 60 80 00       	mov    $0x806020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801aff:	39 13                	cmp    %edx,(%ebx)
+  801b01:	74 54                	je     801b57 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801b03:	83 c0 01             	add    $0x1,%eax
+  801b06:	8b 1c 85 38 54 80 00 	mov    0x805438(,%eax,4),%ebx
+  801b0d:	85 db                	test   %ebx,%ebx
+  801b0f:	75 ee                	jne    801aff <dev_lookup+0x14>
+  801b11:	89 e1                	mov    %esp,%ecx
+  801b13:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b18:	29 c8                	sub    %ecx,%eax
+  801b1a:	89 c1                	mov    %eax,%ecx
+  801b1c:	c1 e9 0f             	shr    $0xf,%ecx
+  801b1f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b29:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b2c:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  801b33:	8b 40 48             	mov    0x48(%eax),%eax
+  801b36:	83 ec 04             	sub    $0x4,%esp
+  801b39:	52                   	push   %edx
+  801b3a:	50                   	push   %eax
+  801b3b:	68 bc 53 80 00       	push   $0x8053bc
+  801b40:	e8 d3 e7 ff ff       	call   800318 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b50:	89 1a                	mov    %ebx,(%edx)
+}
+  801b52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b55:	c9                   	leave
+  801b56:	c3                   	ret
+			return 0;
+  801b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b5c:	eb ef                	jmp    801b4d <dev_lookup+0x62>
+
+00801b5e <fd_close>:
+{
+  801b5e:	55                   	push   %ebp
+  801b5f:	89 e5                	mov    %esp,%ebp
+  801b61:	57                   	push   %edi
+  801b62:	56                   	push   %esi
+  801b63:	53                   	push   %ebx
+  801b64:	83 ec 24             	sub    $0x24,%esp
+  801b67:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b6a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b70:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b71:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b77:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b7a:	50                   	push   %eax
+  801b7b:	e8 19 ff ff ff       	call   801a99 <fd_lookup>
+  801b80:	89 c3                	mov    %eax,%ebx
+  801b82:	83 c4 10             	add    $0x10,%esp
+  801b85:	85 c0                	test   %eax,%eax
+  801b87:	78 05                	js     801b8e <fd_close+0x30>
+	    || fd != fd2)
+  801b89:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b8c:	74 0f                	je     801b9d <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801b8e:	85 ff                	test   %edi,%edi
+  801b90:	0f 44 df             	cmove  %edi,%ebx
+}
+  801b93:	89 d8                	mov    %ebx,%eax
+  801b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b98:	5b                   	pop    %ebx
+  801b99:	5e                   	pop    %esi
+  801b9a:	5f                   	pop    %edi
+  801b9b:	5d                   	pop    %ebp
+  801b9c:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b9d:	83 ec 08             	sub    $0x8,%esp
+  801ba0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ba3:	50                   	push   %eax
+  801ba4:	ff 36                	push   (%esi)
+  801ba6:	e8 40 ff ff ff       	call   801aeb <dev_lookup>
+  801bab:	89 c3                	mov    %eax,%ebx
+  801bad:	83 c4 10             	add    $0x10,%esp
+  801bb0:	85 c0                	test   %eax,%eax
+  801bb2:	78 1a                	js     801bce <fd_close+0x70>
+		if (dev->dev_close)
+  801bb4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bb7:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bba:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	74 0b                	je     801bce <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801bc3:	83 ec 0c             	sub    $0xc,%esp
+  801bc6:	56                   	push   %esi
+  801bc7:	ff d0                	call   *%eax
+  801bc9:	89 c3                	mov    %eax,%ebx
+  801bcb:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bce:	83 ec 08             	sub    $0x8,%esp
+  801bd1:	56                   	push   %esi
+  801bd2:	6a 00                	push   $0x0
+  801bd4:	e8 ef f2 ff ff       	call   800ec8 <sys_page_unmap>
+	return r;
+  801bd9:	83 c4 10             	add    $0x10,%esp
+  801bdc:	eb b5                	jmp    801b93 <fd_close+0x35>
+
+00801bde <close>:
+
+int
+close(int fdnum)
+{
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801be4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be7:	50                   	push   %eax
+  801be8:	ff 75 08             	push   0x8(%ebp)
+  801beb:	e8 a9 fe ff ff       	call   801a99 <fd_lookup>
+  801bf0:	83 c4 10             	add    $0x10,%esp
+  801bf3:	85 c0                	test   %eax,%eax
+  801bf5:	79 02                	jns    801bf9 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801bf7:	c9                   	leave
+  801bf8:	c3                   	ret
+		return fd_close(fd, 1);
+  801bf9:	83 ec 08             	sub    $0x8,%esp
+  801bfc:	6a 01                	push   $0x1
+  801bfe:	ff 75 f4             	push   -0xc(%ebp)
+  801c01:	e8 58 ff ff ff       	call   801b5e <fd_close>
+  801c06:	83 c4 10             	add    $0x10,%esp
+  801c09:	eb ec                	jmp    801bf7 <close+0x19>
+
+00801c0b <close_all>:
+
+void
+close_all(void)
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	53                   	push   %ebx
+  801c0f:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c12:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c17:	83 ec 0c             	sub    $0xc,%esp
+  801c1a:	53                   	push   %ebx
+  801c1b:	e8 be ff ff ff       	call   801bde <close>
+	for (i = 0; i < MAXFD; i++)
+  801c20:	83 c3 01             	add    $0x1,%ebx
+  801c23:	83 c4 10             	add    $0x10,%esp
+  801c26:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801c2c:	75 e9                	jne    801c17 <close_all+0xc>
+}
+  801c2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c31:	c9                   	leave
+  801c32:	c3                   	ret
+
+00801c33 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c33:	55                   	push   %ebp
+  801c34:	89 e5                	mov    %esp,%ebp
+  801c36:	57                   	push   %edi
+  801c37:	56                   	push   %esi
+  801c38:	53                   	push   %ebx
+  801c39:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c3c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c3f:	50                   	push   %eax
+  801c40:	ff 75 08             	push   0x8(%ebp)
+  801c43:	e8 51 fe ff ff       	call   801a99 <fd_lookup>
+  801c48:	89 c3                	mov    %eax,%ebx
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 7f                	js     801cd0 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c51:	83 ec 0c             	sub    $0xc,%esp
+  801c54:	ff 75 0c             	push   0xc(%ebp)
+  801c57:	e8 82 ff ff ff       	call   801bde <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c5f:	c1 e6 0c             	shl    $0xc,%esi
+  801c62:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c68:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c6b:	89 3c 24             	mov    %edi,(%esp)
+  801c6e:	e8 bf fd ff ff       	call   801a32 <fd2data>
+  801c73:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c75:	89 34 24             	mov    %esi,(%esp)
+  801c78:	e8 b5 fd ff ff       	call   801a32 <fd2data>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801c83:	89 d8                	mov    %ebx,%eax
+  801c85:	c1 e8 16             	shr    $0x16,%eax
+  801c88:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c8f:	a8 01                	test   $0x1,%al
+  801c91:	74 11                	je     801ca4 <dup+0x71>
+  801c93:	89 d8                	mov    %ebx,%eax
+  801c95:	c1 e8 0c             	shr    $0xc,%eax
+  801c98:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c9f:	f6 c2 01             	test   $0x1,%dl
+  801ca2:	75 36                	jne    801cda <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801ca4:	89 f8                	mov    %edi,%eax
+  801ca6:	c1 e8 0c             	shr    $0xc,%eax
+  801ca9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cb0:	83 ec 0c             	sub    $0xc,%esp
+  801cb3:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cb8:	50                   	push   %eax
+  801cb9:	56                   	push   %esi
+  801cba:	6a 00                	push   $0x0
+  801cbc:	57                   	push   %edi
+  801cbd:	6a 00                	push   $0x0
+  801cbf:	e8 c2 f1 ff ff       	call   800e86 <sys_page_map>
+  801cc4:	89 c3                	mov    %eax,%ebx
+  801cc6:	83 c4 20             	add    $0x20,%esp
+  801cc9:	85 c0                	test   %eax,%eax
+  801ccb:	78 33                	js     801d00 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801ccd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cd0:	89 d8                	mov    %ebx,%eax
+  801cd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd5:	5b                   	pop    %ebx
+  801cd6:	5e                   	pop    %esi
+  801cd7:	5f                   	pop    %edi
+  801cd8:	5d                   	pop    %ebp
+  801cd9:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801cda:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ce1:	83 ec 0c             	sub    $0xc,%esp
+  801ce4:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ce9:	50                   	push   %eax
+  801cea:	ff 75 d4             	push   -0x2c(%ebp)
+  801ced:	6a 00                	push   $0x0
+  801cef:	53                   	push   %ebx
+  801cf0:	6a 00                	push   $0x0
+  801cf2:	e8 8f f1 ff ff       	call   800e86 <sys_page_map>
+  801cf7:	89 c3                	mov    %eax,%ebx
+  801cf9:	83 c4 20             	add    $0x20,%esp
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	79 a4                	jns    801ca4 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801d00:	83 ec 08             	sub    $0x8,%esp
+  801d03:	56                   	push   %esi
+  801d04:	6a 00                	push   $0x0
+  801d06:	e8 bd f1 ff ff       	call   800ec8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d0b:	83 c4 08             	add    $0x8,%esp
+  801d0e:	ff 75 d4             	push   -0x2c(%ebp)
+  801d11:	6a 00                	push   $0x0
+  801d13:	e8 b0 f1 ff ff       	call   800ec8 <sys_page_unmap>
+	return r;
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	eb b3                	jmp    801cd0 <dup+0x9d>
+
+00801d1d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d1d:	55                   	push   %ebp
+  801d1e:	89 e5                	mov    %esp,%ebp
+  801d20:	56                   	push   %esi
+  801d21:	53                   	push   %ebx
+  801d22:	83 ec 18             	sub    $0x18,%esp
+  801d25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d28:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d2b:	50                   	push   %eax
+  801d2c:	53                   	push   %ebx
+  801d2d:	e8 67 fd ff ff       	call   801a99 <fd_lookup>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 3c                	js     801d75 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d39:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d3c:	83 ec 08             	sub    $0x8,%esp
+  801d3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d42:	50                   	push   %eax
+  801d43:	ff 36                	push   (%esi)
+  801d45:	e8 a1 fd ff ff       	call   801aeb <dev_lookup>
+  801d4a:	83 c4 10             	add    $0x10,%esp
+  801d4d:	85 c0                	test   %eax,%eax
+  801d4f:	78 24                	js     801d75 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d51:	8b 46 08             	mov    0x8(%esi),%eax
+  801d54:	83 e0 03             	and    $0x3,%eax
+  801d57:	83 f8 01             	cmp    $0x1,%eax
+  801d5a:	74 20                	je     801d7c <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d5f:	8b 40 08             	mov    0x8(%eax),%eax
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	74 54                	je     801dba <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d66:	83 ec 04             	sub    $0x4,%esp
+  801d69:	ff 75 10             	push   0x10(%ebp)
+  801d6c:	ff 75 0c             	push   0xc(%ebp)
+  801d6f:	56                   	push   %esi
+  801d70:	ff d0                	call   *%eax
+  801d72:	83 c4 10             	add    $0x10,%esp
+}
+  801d75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d78:	5b                   	pop    %ebx
+  801d79:	5e                   	pop    %esi
+  801d7a:	5d                   	pop    %ebp
+  801d7b:	c3                   	ret
+  801d7c:	89 e2                	mov    %esp,%edx
+  801d7e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d83:	29 d0                	sub    %edx,%eax
+  801d85:	89 c2                	mov    %eax,%edx
+  801d87:	c1 ea 0f             	shr    $0xf,%edx
+  801d8a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d94:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d97:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  801d9e:	8b 40 48             	mov    0x48(%eax),%eax
+  801da1:	83 ec 04             	sub    $0x4,%esp
+  801da4:	53                   	push   %ebx
+  801da5:	50                   	push   %eax
+  801da6:	68 fd 53 80 00       	push   $0x8053fd
+  801dab:	e8 68 e5 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801db8:	eb bb                	jmp    801d75 <read+0x58>
+		return -E_NOT_SUPP;
+  801dba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dbf:	eb b4                	jmp    801d75 <read+0x58>
+
+00801dc1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801dc1:	55                   	push   %ebp
+  801dc2:	89 e5                	mov    %esp,%ebp
+  801dc4:	57                   	push   %edi
+  801dc5:	56                   	push   %esi
+  801dc6:	53                   	push   %ebx
+  801dc7:	83 ec 0c             	sub    $0xc,%esp
+  801dca:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801dcd:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801dd0:	85 f6                	test   %esi,%esi
+  801dd2:	74 30                	je     801e04 <readn+0x43>
+  801dd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801dde:	83 ec 04             	sub    $0x4,%esp
+  801de1:	89 f2                	mov    %esi,%edx
+  801de3:	29 c2                	sub    %eax,%edx
+  801de5:	52                   	push   %edx
+  801de6:	01 f8                	add    %edi,%eax
+  801de8:	50                   	push   %eax
+  801de9:	ff 75 08             	push   0x8(%ebp)
+  801dec:	e8 2c ff ff ff       	call   801d1d <read>
+		if (m < 0)
+  801df1:	83 c4 10             	add    $0x10,%esp
+  801df4:	85 c0                	test   %eax,%eax
+  801df6:	78 15                	js     801e0d <readn+0x4c>
+			return m;
+		if (m == 0)
+  801df8:	74 11                	je     801e0b <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801dfa:	01 c3                	add    %eax,%ebx
+  801dfc:	89 d8                	mov    %ebx,%eax
+  801dfe:	39 f3                	cmp    %esi,%ebx
+  801e00:	72 dc                	jb     801dde <readn+0x1d>
+  801e02:	eb 09                	jmp    801e0d <readn+0x4c>
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e09:	eb 02                	jmp    801e0d <readn+0x4c>
+  801e0b:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801e0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e10:	5b                   	pop    %ebx
+  801e11:	5e                   	pop    %esi
+  801e12:	5f                   	pop    %edi
+  801e13:	5d                   	pop    %ebp
+  801e14:	c3                   	ret
+
+00801e15 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e15:	55                   	push   %ebp
+  801e16:	89 e5                	mov    %esp,%ebp
+  801e18:	56                   	push   %esi
+  801e19:	53                   	push   %ebx
+  801e1a:	83 ec 18             	sub    $0x18,%esp
+  801e1d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e20:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e23:	50                   	push   %eax
+  801e24:	53                   	push   %ebx
+  801e25:	e8 6f fc ff ff       	call   801a99 <fd_lookup>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 37                	js     801e68 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e31:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e34:	83 ec 08             	sub    $0x8,%esp
+  801e37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e3a:	50                   	push   %eax
+  801e3b:	ff 36                	push   (%esi)
+  801e3d:	e8 a9 fc ff ff       	call   801aeb <dev_lookup>
+  801e42:	83 c4 10             	add    $0x10,%esp
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	78 1f                	js     801e68 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e49:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e4d:	74 20                	je     801e6f <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e52:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	74 54                	je     801ead <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e59:	83 ec 04             	sub    $0x4,%esp
+  801e5c:	ff 75 10             	push   0x10(%ebp)
+  801e5f:	ff 75 0c             	push   0xc(%ebp)
+  801e62:	56                   	push   %esi
+  801e63:	ff d0                	call   *%eax
+  801e65:	83 c4 10             	add    $0x10,%esp
+}
+  801e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e6b:	5b                   	pop    %ebx
+  801e6c:	5e                   	pop    %esi
+  801e6d:	5d                   	pop    %ebp
+  801e6e:	c3                   	ret
+  801e6f:	89 e2                	mov    %esp,%edx
+  801e71:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e76:	29 d0                	sub    %edx,%eax
+  801e78:	89 c2                	mov    %eax,%edx
+  801e7a:	c1 ea 0f             	shr    $0xf,%edx
+  801e7d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8a:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  801e91:	8b 40 48             	mov    0x48(%eax),%eax
+  801e94:	83 ec 04             	sub    $0x4,%esp
+  801e97:	53                   	push   %ebx
+  801e98:	50                   	push   %eax
+  801e99:	68 19 54 80 00       	push   $0x805419
+  801e9e:	e8 75 e4 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eab:	eb bb                	jmp    801e68 <write+0x53>
+		return -E_NOT_SUPP;
+  801ead:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801eb2:	eb b4                	jmp    801e68 <write+0x53>
+
+00801eb4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ebd:	50                   	push   %eax
+  801ebe:	ff 75 08             	push   0x8(%ebp)
+  801ec1:	e8 d3 fb ff ff       	call   801a99 <fd_lookup>
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 0e                	js     801edb <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801ecd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ed0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed3:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801edb:	c9                   	leave
+  801edc:	c3                   	ret
+
+00801edd <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	53                   	push   %ebx
+  801ee1:	83 ec 1c             	sub    $0x1c,%esp
+  801ee4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ee7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eea:	50                   	push   %eax
+  801eeb:	ff 75 08             	push   0x8(%ebp)
+  801eee:	e8 a6 fb ff ff       	call   801a99 <fd_lookup>
+  801ef3:	83 c4 10             	add    $0x10,%esp
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 33                	js     801f2d <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  801efa:	83 fb 03             	cmp    $0x3,%ebx
+  801efd:	74 28                	je     801f27 <fcntl+0x4a>
+  801eff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f04:	83 fb 04             	cmp    $0x4,%ebx
+  801f07:	75 24                	jne    801f2d <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  801f09:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  801f0c:	8b 41 08             	mov    0x8(%ecx),%eax
+  801f0f:	80 e4 ef             	and    $0xef,%ah
+  801f12:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f15:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801f1b:	09 d0                	or     %edx,%eax
+  801f1d:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f25:	eb 06                	jmp    801f2d <fcntl+0x50>
+		return fd->fd_omode;
+  801f27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f2a:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801f2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f30:	c9                   	leave
+  801f31:	c3                   	ret
+
+00801f32 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	56                   	push   %esi
+  801f36:	53                   	push   %ebx
+  801f37:	83 ec 18             	sub    $0x18,%esp
+  801f3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f3d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f40:	50                   	push   %eax
+  801f41:	53                   	push   %ebx
+  801f42:	e8 52 fb ff ff       	call   801a99 <fd_lookup>
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 34                	js     801f82 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f4e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f51:	83 ec 08             	sub    $0x8,%esp
+  801f54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f57:	50                   	push   %eax
+  801f58:	ff 36                	push   (%esi)
+  801f5a:	e8 8c fb ff ff       	call   801aeb <dev_lookup>
+  801f5f:	83 c4 10             	add    $0x10,%esp
+  801f62:	85 c0                	test   %eax,%eax
+  801f64:	78 1c                	js     801f82 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f66:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f6a:	74 1d                	je     801f89 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801f6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f6f:	8b 40 18             	mov    0x18(%eax),%eax
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	74 51                	je     801fc7 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801f76:	83 ec 08             	sub    $0x8,%esp
+  801f79:	ff 75 0c             	push   0xc(%ebp)
+  801f7c:	56                   	push   %esi
+  801f7d:	ff d0                	call   *%eax
+  801f7f:	83 c4 10             	add    $0x10,%esp
+}
+  801f82:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f85:	5b                   	pop    %ebx
+  801f86:	5e                   	pop    %esi
+  801f87:	5d                   	pop    %ebp
+  801f88:	c3                   	ret
+  801f89:	89 e2                	mov    %esp,%edx
+  801f8b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f90:	29 d0                	sub    %edx,%eax
+  801f92:	89 c2                	mov    %eax,%edx
+  801f94:	c1 ea 0f             	shr    $0xf,%edx
+  801f97:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa1:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801fa4:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  801fab:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fae:	83 ec 04             	sub    $0x4,%esp
+  801fb1:	53                   	push   %ebx
+  801fb2:	50                   	push   %eax
+  801fb3:	68 dc 53 80 00       	push   $0x8053dc
+  801fb8:	e8 5b e3 ff ff       	call   800318 <cprintf>
+		return -E_INVAL;
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  801fc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fc5:	eb bb                	jmp    801f82 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801fc7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fcc:	eb b4                	jmp    801f82 <ftruncate+0x50>
+
+00801fce <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	56                   	push   %esi
+  801fd2:	53                   	push   %ebx
+  801fd3:	83 ec 18             	sub    $0x18,%esp
+  801fd6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801fd9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fdc:	50                   	push   %eax
+  801fdd:	ff 75 08             	push   0x8(%ebp)
+  801fe0:	e8 b4 fa ff ff       	call   801a99 <fd_lookup>
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 53                	js     80203f <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fef:	83 ec 08             	sub    $0x8,%esp
+  801ff2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	ff 36                	push   (%esi)
+  801ff8:	e8 ee fa ff ff       	call   801aeb <dev_lookup>
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 3b                	js     80203f <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802004:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802007:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80200b:	74 39                	je     802046 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80200d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802010:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802017:	00 00 00 
+	stat->st_isdir = 0;
+  80201a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802021:	00 00 00 
+	stat->st_version = 0;
+  802024:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80202b:	00 00 00 
+	stat->st_dev = dev;
+  80202e:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802034:	83 ec 08             	sub    $0x8,%esp
+  802037:	53                   	push   %ebx
+  802038:	56                   	push   %esi
+  802039:	ff 50 14             	call   *0x14(%eax)
+  80203c:	83 c4 10             	add    $0x10,%esp
+}
+  80203f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802042:	5b                   	pop    %ebx
+  802043:	5e                   	pop    %esi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+		return -E_NOT_SUPP;
+  802046:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80204b:	eb f2                	jmp    80203f <fstat+0x71>
+
+0080204d <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	56                   	push   %esi
+  802051:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802052:	83 ec 08             	sub    $0x8,%esp
+  802055:	6a 00                	push   $0x0
+  802057:	ff 75 08             	push   0x8(%ebp)
+  80205a:	e8 b7 01 00 00       	call   802216 <open>
+  80205f:	89 c3                	mov    %eax,%ebx
+  802061:	83 c4 10             	add    $0x10,%esp
+  802064:	85 c0                	test   %eax,%eax
+  802066:	78 1b                	js     802083 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802068:	83 ec 08             	sub    $0x8,%esp
+  80206b:	ff 75 0c             	push   0xc(%ebp)
+  80206e:	50                   	push   %eax
+  80206f:	e8 5a ff ff ff       	call   801fce <fstat>
+  802074:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802076:	89 1c 24             	mov    %ebx,(%esp)
+  802079:	e8 60 fb ff ff       	call   801bde <close>
+	return r;
+  80207e:	83 c4 10             	add    $0x10,%esp
+  802081:	89 f3                	mov    %esi,%ebx
+}
+  802083:	89 d8                	mov    %ebx,%eax
+  802085:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802088:	5b                   	pop    %ebx
+  802089:	5e                   	pop    %esi
+  80208a:	5d                   	pop    %ebp
+  80208b:	c3                   	ret
+
+0080208c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80208c:	55                   	push   %ebp
+  80208d:	89 e5                	mov    %esp,%ebp
+  80208f:	56                   	push   %esi
+  802090:	53                   	push   %ebx
+  802091:	89 c6                	mov    %eax,%esi
+  802093:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  802095:	83 3d c4 76 80 00 00 	cmpl   $0x0,0x8076c4
+  80209c:	74 27                	je     8020c5 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80209e:	6a 07                	push   $0x7
+  8020a0:	68 00 90 80 00       	push   $0x809000
+  8020a5:	56                   	push   %esi
+  8020a6:	ff 35 c4 76 80 00    	push   0x8076c4
+  8020ac:	e8 22 2b 00 00       	call   804bd3 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8020b1:	83 c4 0c             	add    $0xc,%esp
+  8020b4:	6a 00                	push   $0x0
+  8020b6:	53                   	push   %ebx
+  8020b7:	6a 00                	push   $0x0
+  8020b9:	e8 85 28 00 00       	call   804943 <ipc_recv>
+}
+  8020be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c1:	5b                   	pop    %ebx
+  8020c2:	5e                   	pop    %esi
+  8020c3:	5d                   	pop    %ebp
+  8020c4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020c5:	83 ec 0c             	sub    $0xc,%esp
+  8020c8:	6a 02                	push   $0x2
+  8020ca:	e8 6d 2b 00 00       	call   804c3c <ipc_find_env>
+  8020cf:	a3 c4 76 80 00       	mov    %eax,0x8076c4
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	eb c5                	jmp    80209e <fsipc+0x12>
+
+008020d9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020e5:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  8020ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ed:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8020f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f7:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020fc:	e8 8b ff ff ff       	call   80208c <fsipc>
+}
+  802101:	c9                   	leave
+  802102:	c3                   	ret
+
+00802103 <devfile_flush>:
+{
+  802103:	55                   	push   %ebp
+  802104:	89 e5                	mov    %esp,%ebp
+  802106:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802109:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80210f:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802114:	ba 00 00 00 00       	mov    $0x0,%edx
+  802119:	b8 06 00 00 00       	mov    $0x6,%eax
+  80211e:	e8 69 ff ff ff       	call   80208c <fsipc>
+}
+  802123:	c9                   	leave
+  802124:	c3                   	ret
+
+00802125 <devfile_stat>:
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	53                   	push   %ebx
+  802129:	83 ec 04             	sub    $0x4,%esp
+  80212c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80212f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802132:	8b 40 0c             	mov    0xc(%eax),%eax
+  802135:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80213a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802144:	e8 43 ff ff ff       	call   80208c <fsipc>
+  802149:	85 c0                	test   %eax,%eax
+  80214b:	78 37                	js     802184 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80214d:	83 ec 08             	sub    $0x8,%esp
+  802150:	68 00 90 80 00       	push   $0x809000
+  802155:	53                   	push   %ebx
+  802156:	e8 b4 e8 ff ff       	call   800a0f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80215b:	a1 80 90 80 00       	mov    0x809080,%eax
+  802160:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802166:	a1 84 90 80 00       	mov    0x809084,%eax
+  80216b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  802171:	a1 88 90 80 00       	mov    0x809088,%eax
+  802176:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802184:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802187:	c9                   	leave
+  802188:	c3                   	ret
+
+00802189 <devfile_write>:
+{
+  802189:	55                   	push   %ebp
+  80218a:	89 e5                	mov    %esp,%ebp
+  80218c:	83 ec 0c             	sub    $0xc,%esp
+  80218f:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802192:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802197:	39 d0                	cmp    %edx,%eax
+  802199:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80219c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80219f:	8b 52 0c             	mov    0xc(%edx),%edx
+  8021a2:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  8021a8:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8021ad:	50                   	push   %eax
+  8021ae:	ff 75 0c             	push   0xc(%ebp)
+  8021b1:	68 08 90 80 00       	push   $0x809008
+  8021b6:	e8 04 ea ff ff       	call   800bbf <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8021bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c0:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021c5:	e8 c2 fe ff ff       	call   80208c <fsipc>
+}
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+008021cc <devfile_read>:
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	53                   	push   %ebx
+  8021d0:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d9:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  8021de:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021e1:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8021e6:	ba 00 90 80 00       	mov    $0x809000,%edx
+  8021eb:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021f0:	e8 97 fe ff ff       	call   80208c <fsipc>
+  8021f5:	89 c3                	mov    %eax,%ebx
+  8021f7:	85 c0                	test   %eax,%eax
+  8021f9:	78 14                	js     80220f <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8021fb:	83 ec 04             	sub    $0x4,%esp
+  8021fe:	50                   	push   %eax
+  8021ff:	68 00 90 80 00       	push   $0x809000
+  802204:	ff 75 0c             	push   0xc(%ebp)
+  802207:	e8 b3 e9 ff ff       	call   800bbf <memmove>
+	return r;
+  80220c:	83 c4 10             	add    $0x10,%esp
+}
+  80220f:	89 d8                	mov    %ebx,%eax
+  802211:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+00802216 <open>:
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	53                   	push   %ebx
+  80221a:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  80221d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802220:	50                   	push   %eax
+  802221:	e8 23 f8 ff ff       	call   801a49 <fd_alloc>
+  802226:	89 c3                	mov    %eax,%ebx
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 2a                	js     802259 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  80222f:	83 ec 0c             	sub    $0xc,%esp
+  802232:	ff 75 08             	push   0x8(%ebp)
+  802235:	e8 89 e7 ff ff       	call   8009c3 <strlen>
+  80223a:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  80223d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  802242:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802247:	7e 17                	jle    802260 <open+0x4a>
+	fd_close(fd, 1);
+  802249:	83 ec 08             	sub    $0x8,%esp
+  80224c:	6a 01                	push   $0x1
+  80224e:	ff 75 f4             	push   -0xc(%ebp)
+  802251:	e8 08 f9 ff ff       	call   801b5e <fd_close>
+	return r;
+  802256:	83 c4 10             	add    $0x10,%esp
+}
+  802259:	89 d8                	mov    %ebx,%eax
+  80225b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  802260:	83 ec 08             	sub    $0x8,%esp
+  802263:	ff 75 08             	push   0x8(%ebp)
+  802266:	68 00 90 80 00       	push   $0x809000
+  80226b:	e8 9f e7 ff ff       	call   800a0f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  802270:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802273:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802278:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80227b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802280:	e8 07 fe ff ff       	call   80208c <fsipc>
+  802285:	89 c3                	mov    %eax,%ebx
+  802287:	83 c4 10             	add    $0x10,%esp
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	78 bb                	js     802249 <open+0x33>
+	return fd2num(fd); 	
+  80228e:	83 ec 0c             	sub    $0xc,%esp
+  802291:	ff 75 f4             	push   -0xc(%ebp)
+  802294:	e8 89 f7 ff ff       	call   801a22 <fd2num>
+  802299:	89 c3                	mov    %eax,%ebx
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	eb b9                	jmp    802259 <open+0x43>
+
+008022a0 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8022a0:	55                   	push   %ebp
+  8022a1:	89 e5                	mov    %esp,%ebp
+  8022a3:	53                   	push   %ebx
+  8022a4:	83 ec 1c             	sub    $0x1c,%esp
+  8022a7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ad:	50                   	push   %eax
+  8022ae:	ff 75 08             	push   0x8(%ebp)
+  8022b1:	e8 e3 f7 ff ff       	call   801a99 <fd_lookup>
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	85 c0                	test   %eax,%eax
+  8022bb:	78 5a                	js     802317 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8022bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c0:	8b 15 20 60 80 00    	mov    0x806020,%edx
+  8022c6:	39 10                	cmp    %edx,(%eax)
+  8022c8:	75 66                	jne    802330 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  8022ca:	83 3d c4 76 80 00 00 	cmpl   $0x0,0x8076c4
+  8022d1:	74 49                	je     80231c <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8022d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022d9:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  8022de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e1:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  8022e6:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8022ec:	6a 07                	push   $0x7
+  8022ee:	68 00 90 80 00       	push   $0x809000
+  8022f3:	6a 09                	push   $0x9
+  8022f5:	ff 35 c4 76 80 00    	push   0x8076c4
+  8022fb:	e8 d3 28 00 00       	call   804bd3 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802300:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802307:	6a 00                	push   $0x0
+  802309:	53                   	push   %ebx
+  80230a:	ff 75 10             	push   0x10(%ebp)
+  80230d:	6a 00                	push   $0x0
+  80230f:	e8 fc 26 00 00       	call   804a10 <ipc_recv_pages>
+  802314:	83 c4 20             	add    $0x20,%esp
+}
+  802317:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80231a:	c9                   	leave
+  80231b:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80231c:	83 ec 0c             	sub    $0xc,%esp
+  80231f:	6a 02                	push   $0x2
+  802321:	e8 16 29 00 00       	call   804c3c <ipc_find_env>
+  802326:	a3 c4 76 80 00       	mov    %eax,0x8076c4
+  80232b:	83 c4 10             	add    $0x10,%esp
+  80232e:	eb a3                	jmp    8022d3 <fmap+0x33>
+		return -E_INVAL;
+  802330:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802335:	eb e0                	jmp    802317 <fmap+0x77>
+
+00802337 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	53                   	push   %ebx
+  80233b:	83 ec 10             	sub    $0x10,%esp
+  80233e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802341:	53                   	push   %ebx
+  802342:	e8 7c e6 ff ff       	call   8009c3 <strlen>
+  802347:	83 c4 10             	add    $0x10,%esp
+  80234a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80234f:	7f 25                	jg     802376 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802351:	83 ec 08             	sub    $0x8,%esp
+  802354:	53                   	push   %ebx
+  802355:	68 00 90 80 00       	push   $0x809000
+  80235a:	e8 b0 e6 ff ff       	call   800a0f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80235f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802364:	b8 07 00 00 00       	mov    $0x7,%eax
+  802369:	e8 1e fd ff ff       	call   80208c <fsipc>
+  80236e:	83 c4 10             	add    $0x10,%esp
+}
+  802371:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+		return -E_BAD_PATH;
+  802376:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80237b:	eb f4                	jmp    802371 <remove+0x3a>
+
+0080237d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80237d:	55                   	push   %ebp
+  80237e:	89 e5                	mov    %esp,%ebp
+  802380:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802383:	ba 00 00 00 00       	mov    $0x0,%edx
+  802388:	b8 08 00 00 00       	mov    $0x8,%eax
+  80238d:	e8 fa fc ff ff       	call   80208c <fsipc>
+}
+  802392:	c9                   	leave
+  802393:	c3                   	ret
+
+00802394 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802394:	55                   	push   %ebp
+  802395:	89 e5                	mov    %esp,%ebp
+  802397:	57                   	push   %edi
+  802398:	56                   	push   %esi
+  802399:	53                   	push   %ebx
+  80239a:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  8023a0:	6a 00                	push   $0x0
+  8023a2:	ff 75 08             	push   0x8(%ebp)
+  8023a5:	e8 6c fe ff ff       	call   802216 <open>
+  8023aa:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8023b0:	83 c4 10             	add    $0x10,%esp
+  8023b3:	85 c0                	test   %eax,%eax
+  8023b5:	0f 88 ab 04 00 00    	js     802866 <spawn+0x4d2>
+  8023bb:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8023bd:	83 ec 04             	sub    $0x4,%esp
+  8023c0:	68 00 02 00 00       	push   $0x200
+  8023c5:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8023cb:	50                   	push   %eax
+  8023cc:	51                   	push   %ecx
+  8023cd:	e8 ef f9 ff ff       	call   801dc1 <readn>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8023da:	0f 85 e6 01 00 00    	jne    8025c6 <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  8023e0:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8023e7:	45 4c 46 
+  8023ea:	0f 85 d6 01 00 00    	jne    8025c6 <spawn+0x232>
+	__asm __volatile("int %2"
+  8023f0:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023f5:	cd 30                	int    $0x30
+  8023f7:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	0f 88 55 04 00 00    	js     80285a <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802405:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80240a:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  802410:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802416:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80241c:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802421:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802423:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802429:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80242f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802432:	8b 00                	mov    (%eax),%eax
+  802434:	85 c0                	test   %eax,%eax
+  802436:	0f 84 a5 07 00 00    	je     802be1 <spawn+0x84d>
+  80243c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802441:	bf 00 00 00 00       	mov    $0x0,%edi
+  802446:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  802449:	83 ec 0c             	sub    $0xc,%esp
+  80244c:	50                   	push   %eax
+  80244d:	e8 71 e5 ff ff       	call   8009c3 <strlen>
+  802452:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802456:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  80245c:	83 c3 01             	add    $0x1,%ebx
+  80245f:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  802466:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  802469:	83 c4 10             	add    $0x10,%esp
+  80246c:	85 c0                	test   %eax,%eax
+  80246e:	75 d9                	jne    802449 <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802470:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  802476:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  80247c:	be 00 10 40 00       	mov    $0x401000,%esi
+  802481:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802483:	89 f2                	mov    %esi,%edx
+  802485:	83 e2 fc             	and    $0xfffffffc,%edx
+  802488:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80248e:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  802495:	29 c2                	sub    %eax,%edx
+  802497:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802499:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80249c:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8024a1:	0f 86 ee 06 00 00    	jbe    802b95 <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8024a7:	83 ec 04             	sub    $0x4,%esp
+  8024aa:	6a 07                	push   $0x7
+  8024ac:	68 00 00 40 00       	push   $0x400000
+  8024b1:	6a 00                	push   $0x0
+  8024b3:	e8 8b e9 ff ff       	call   800e43 <sys_page_alloc>
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	0f 88 d7 06 00 00    	js     802b9a <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8024c3:	85 db                	test   %ebx,%ebx
+  8024c5:	7e 58                	jle    80251f <spawn+0x18b>
+  8024c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8024cc:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  8024d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8024d5:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8024db:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  8024e1:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  8024e7:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  8024ea:	83 ec 08             	sub    $0x8,%esp
+  8024ed:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024f0:	56                   	push   %esi
+  8024f1:	e8 19 e5 ff ff       	call   800a0f <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8024f6:	83 c4 04             	add    $0x4,%esp
+  8024f9:	ff 34 9f             	push   (%edi,%ebx,4)
+  8024fc:	e8 c2 e4 ff ff       	call   8009c3 <strlen>
+  802501:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  802505:	83 c3 01             	add    $0x1,%ebx
+  802508:	83 c4 10             	add    $0x10,%esp
+  80250b:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802511:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  802517:	75 bc                	jne    8024d5 <spawn+0x141>
+  802519:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  80251f:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802525:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80252c:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  802532:	0f 85 c6 00 00 00    	jne    8025fe <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802538:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80253e:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  802541:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802547:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  80254a:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  802550:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802556:	83 ec 0c             	sub    $0xc,%esp
+  802559:	6a 07                	push   $0x7
+  80255b:	68 00 d0 bf ee       	push   $0xeebfd000
+  802560:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802566:	68 00 00 40 00       	push   $0x400000
+  80256b:	6a 00                	push   $0x0
+  80256d:	e8 14 e9 ff ff       	call   800e86 <sys_page_map>
+  802572:	89 c3                	mov    %eax,%ebx
+  802574:	83 c4 20             	add    $0x20,%esp
+  802577:	85 c0                	test   %eax,%eax
+  802579:	0f 88 45 06 00 00    	js     802bc4 <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80257f:	83 ec 08             	sub    $0x8,%esp
+  802582:	68 00 00 40 00       	push   $0x400000
+  802587:	6a 00                	push   $0x0
+  802589:	e8 3a e9 ff ff       	call   800ec8 <sys_page_unmap>
+  80258e:	89 c3                	mov    %eax,%ebx
+  802590:	83 c4 10             	add    $0x10,%esp
+  802593:	85 c0                	test   %eax,%eax
+  802595:	0f 88 29 06 00 00    	js     802bc4 <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  80259b:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8025a1:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  8025a8:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8025ae:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  8025b5:	00 
+  8025b6:	0f 84 a4 00 00 00    	je     802660 <spawn+0x2cc>
+  8025bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025c1:	e9 19 03 00 00       	jmp    8028df <spawn+0x54b>
+		close(fd);
+  8025c6:	83 ec 0c             	sub    $0xc,%esp
+  8025c9:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8025cf:	e8 0a f6 ff ff       	call   801bde <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8025d4:	83 c4 0c             	add    $0xc,%esp
+  8025d7:	68 7f 45 4c 46       	push   $0x464c457f
+  8025dc:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8025e2:	68 4c 54 80 00       	push   $0x80544c
+  8025e7:	e8 2c dd ff ff       	call   800318 <cprintf>
+		return -E_NOT_EXEC;
+  8025ec:	83 c4 10             	add    $0x10,%esp
+  8025ef:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  8025f6:	ff ff ff 
+  8025f9:	e9 68 02 00 00       	jmp    802866 <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8025fe:	68 b4 54 80 00       	push   $0x8054b4
+  802603:	68 66 54 80 00       	push   $0x805466
+  802608:	68 f1 00 00 00       	push   $0xf1
+  80260d:	68 7b 54 80 00       	push   $0x80547b
+  802612:	e8 26 dc ff ff       	call   80023d <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  802617:	50                   	push   %eax
+  802618:	68 dc 54 80 00       	push   $0x8054dc
+  80261d:	68 2d 01 00 00       	push   $0x12d
+  802622:	68 7b 54 80 00       	push   $0x80547b
+  802627:	e8 11 dc ff ff       	call   80023d <_panic>
+  80262c:	89 c6                	mov    %eax,%esi
+  80262e:	eb 02                	jmp    802632 <spawn+0x29e>
+  802630:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  802632:	83 ec 0c             	sub    $0xc,%esp
+  802635:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80263b:	e8 84 e7 ff ff       	call   800dc4 <sys_env_destroy>
+	close(fd);
+  802640:	83 c4 04             	add    $0x4,%esp
+  802643:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802649:	e8 90 f5 ff ff       	call   801bde <close>
+	return r;
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  802657:	e9 0a 02 00 00       	jmp    802866 <spawn+0x4d2>
+  80265c:	89 c6                	mov    %eax,%esi
+  80265e:	eb d2                	jmp    802632 <spawn+0x29e>
+	close(fd);
+  802660:	83 ec 0c             	sub    $0xc,%esp
+  802663:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802669:	e8 70 f5 ff ff       	call   801bde <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  80266e:	c7 04 24 e0 76 80 00 	movl   $0x8076e0,(%esp)
+  802675:	e8 65 1d 00 00       	call   8043df <pgbatch_init>
+  80267a:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80267d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802682:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  802688:	eb 24                	jmp    8026ae <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80268a:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802690:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  802696:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80269c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026a2:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8026a8:	0f 87 18 01 00 00    	ja     8027c6 <spawn+0x432>
+		pd = PDX(addr);
+  8026ae:	89 d8                	mov    %ebx,%eax
+  8026b0:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  8026b3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8026ba:	a8 01                	test   $0x1,%al
+  8026bc:	74 cc                	je     80268a <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  8026be:	89 d9                	mov    %ebx,%ecx
+  8026c0:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  8026c6:	74 4c                	je     802714 <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  8026c8:	89 d8                	mov    %ebx,%eax
+  8026ca:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  8026cd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8026d4:	f6 c6 04             	test   $0x4,%dh
+  8026d7:	74 c3                	je     80269c <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  8026d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8026e0:	83 ec 08             	sub    $0x8,%esp
+  8026e3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8026e8:	50                   	push   %eax
+  8026e9:	53                   	push   %ebx
+  8026ea:	56                   	push   %esi
+  8026eb:	53                   	push   %ebx
+  8026ec:	6a 00                	push   $0x0
+  8026ee:	68 e0 76 80 00       	push   $0x8076e0
+  8026f3:	e8 a5 1d 00 00       	call   80449d <pgbatch_map>
+  8026f8:	83 c4 20             	add    $0x20,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	79 9d                	jns    80269c <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  8026ff:	50                   	push   %eax
+  802700:	68 87 54 80 00       	push   $0x805487
+  802705:	68 6b 01 00 00       	push   $0x16b
+  80270a:	68 7b 54 80 00       	push   $0x80547b
+  80270f:	e8 29 db ff ff       	call   80023d <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802714:	89 d8                	mov    %ebx,%eax
+  802716:	c1 e8 0c             	shr    $0xc,%eax
+  802719:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  80271f:	eb 0a                	jmp    80272b <spawn+0x397>
+			n++;
+  802721:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802724:	83 c0 01             	add    $0x1,%eax
+  802727:	39 f8                	cmp    %edi,%eax
+  802729:	73 1a                	jae    802745 <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  80272b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802732:	f6 c2 01             	test   $0x1,%dl
+  802735:	74 ed                	je     802724 <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  802737:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80273e:	f6 c6 04             	test   $0x4,%dh
+  802741:	75 de                	jne    802721 <spawn+0x38d>
+  802743:	eb 83                	jmp    8026c8 <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802745:	85 c9                	test   %ecx,%ecx
+  802747:	0f 84 7b ff ff ff    	je     8026c8 <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  80274d:	83 ec 0c             	sub    $0xc,%esp
+  802750:	68 e0 76 80 00       	push   $0x8076e0
+  802755:	e8 93 1c 00 00       	call   8043ed <pgbatch_flush>
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	85 c0                	test   %eax,%eax
+  80275f:	78 45                	js     8027a6 <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  802761:	83 ec 0c             	sub    $0xc,%esp
+  802764:	6a 00                	push   $0x0
+  802766:	56                   	push   %esi
+  802767:	53                   	push   %ebx
+  802768:	6a 00                	push   $0x0
+  80276a:	68 e0 76 80 00       	push   $0x8076e0
+  80276f:	e8 d4 1d 00 00       	call   804548 <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  802774:	83 c4 14             	add    $0x14,%esp
+  802777:	68 e0 76 80 00       	push   $0x8076e0
+  80277c:	e8 6c 1c 00 00       	call   8043ed <pgbatch_flush>
+  802781:	83 c4 10             	add    $0x10,%esp
+  802784:	85 c0                	test   %eax,%eax
+  802786:	74 33                	je     8027bb <spawn+0x427>
+			if (r != -E_INVAL)
+  802788:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80278b:	0f 84 37 ff ff ff    	je     8026c8 <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  802791:	50                   	push   %eax
+  802792:	68 87 54 80 00       	push   $0x805487
+  802797:	68 66 01 00 00       	push   $0x166
+  80279c:	68 7b 54 80 00       	push   $0x80547b
+  8027a1:	e8 97 da ff ff       	call   80023d <_panic>
+				panic("sys_page_batch: %e", r);
+  8027a6:	50                   	push   %eax
+  8027a7:	68 87 54 80 00       	push   $0x805487
+  8027ac:	68 5f 01 00 00       	push   $0x15f
+  8027b1:	68 7b 54 80 00       	push   $0x80547b
+  8027b6:	e8 82 da ff ff       	call   80023d <_panic>
+				addr += PTSIZE - PGSIZE;
+  8027bb:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  8027c1:	e9 d6 fe ff ff       	jmp    80269c <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8027c6:	83 ec 0c             	sub    $0xc,%esp
+  8027c9:	68 e0 76 80 00       	push   $0x8076e0
+  8027ce:	e8 1a 1c 00 00       	call   8043ed <pgbatch_flush>
+  8027d3:	83 c4 10             	add    $0x10,%esp
+  8027d6:	85 c0                	test   %eax,%eax
+  8027d8:	78 41                	js     80281b <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  8027da:	83 ec 08             	sub    $0x8,%esp
+  8027dd:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8027e3:	50                   	push   %eax
+  8027e4:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8027ea:	e8 5d e7 ff ff       	call   800f4c <sys_env_set_trapframe>
+  8027ef:	83 c4 10             	add    $0x10,%esp
+  8027f2:	85 c0                	test   %eax,%eax
+  8027f4:	78 3a                	js     802830 <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  8027f6:	83 ec 08             	sub    $0x8,%esp
+  8027f9:	6a 02                	push   $0x2
+  8027fb:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802801:	e8 04 e7 ff ff       	call   800f0a <sys_env_set_status>
+  802806:	83 c4 10             	add    $0x10,%esp
+  802809:	85 c0                	test   %eax,%eax
+  80280b:	78 38                	js     802845 <spawn+0x4b1>
+	return child;
+  80280d:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802813:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802819:	eb 4b                	jmp    802866 <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  80281b:	50                   	push   %eax
+  80281c:	68 87 54 80 00       	push   $0x805487
+  802821:	68 6f 01 00 00       	push   $0x16f
+  802826:	68 7b 54 80 00       	push   $0x80547b
+  80282b:	e8 0d da ff ff       	call   80023d <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802830:	50                   	push   %eax
+  802831:	68 9a 54 80 00       	push   $0x80549a
+  802836:	68 85 00 00 00       	push   $0x85
+  80283b:	68 7b 54 80 00       	push   $0x80547b
+  802840:	e8 f8 d9 ff ff       	call   80023d <_panic>
+		panic("sys_env_set_status: %e", r);
+  802845:	50                   	push   %eax
+  802846:	68 83 53 80 00       	push   $0x805383
+  80284b:	68 88 00 00 00       	push   $0x88
+  802850:	68 7b 54 80 00       	push   $0x80547b
+  802855:	e8 e3 d9 ff ff       	call   80023d <_panic>
+		return r;
+  80285a:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802860:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  802866:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  80286c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80286f:	5b                   	pop    %ebx
+  802870:	5e                   	pop    %esi
+  802871:	5f                   	pop    %edi
+  802872:	5d                   	pop    %ebp
+  802873:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802874:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  80287a:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802880:	85 db                	test   %ebx,%ebx
+  802882:	0f 8e 06 03 00 00    	jle    802b8e <spawn+0x7fa>
+  802888:	81 c6 00 04 00 00    	add    $0x400,%esi
+  80288e:	c1 e6 0c             	shl    $0xc,%esi
+  802891:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  802896:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  80289c:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  80289e:	83 ec 08             	sub    $0x8,%esp
+  8028a1:	53                   	push   %ebx
+  8028a2:	6a 00                	push   $0x0
+  8028a4:	e8 1f e6 ff ff       	call   800ec8 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  8028a9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	39 f3                	cmp    %esi,%ebx
+  8028b4:	75 e8                	jne    80289e <spawn+0x50a>
+  8028b6:	89 f8                	mov    %edi,%eax
+  8028b8:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	0f 88 66 fd ff ff    	js     80262c <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8028c6:	83 c7 01             	add    $0x1,%edi
+  8028c9:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  8028d0:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8028d7:	39 f8                	cmp    %edi,%eax
+  8028d9:	0f 8e 81 fd ff ff    	jle    802660 <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8028df:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8028e5:	83 39 01             	cmpl   $0x1,(%ecx)
+  8028e8:	75 dc                	jne    8028c6 <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8028ea:	8b 41 18             	mov    0x18(%ecx),%eax
+  8028ed:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  8028f3:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8028f6:	83 f8 01             	cmp    $0x1,%eax
+  8028f9:	19 c0                	sbb    %eax,%eax
+  8028fb:	83 e0 fe             	and    $0xfffffffe,%eax
+  8028fe:	83 c0 07             	add    $0x7,%eax
+  802901:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802907:	8b 51 04             	mov    0x4(%ecx),%edx
+  80290a:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802910:	8b 59 10             	mov    0x10(%ecx),%ebx
+  802913:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802919:	8b 41 14             	mov    0x14(%ecx),%eax
+  80291c:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  802922:	8b 71 08             	mov    0x8(%ecx),%esi
+  802925:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  80292b:	89 f0                	mov    %esi,%eax
+  80292d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802932:	74 1e                	je     802952 <spawn+0x5be>
+		va -= i;
+  802934:	29 c6                	sub    %eax,%esi
+  802936:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  80293c:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  802942:	01 c3                	add    %eax,%ebx
+  802944:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  80294a:	29 c2                	sub    %eax,%edx
+  80294c:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  802952:	83 ec 0c             	sub    $0xc,%esp
+  802955:	68 00 7a 80 00       	push   $0x807a00
+  80295a:	e8 80 1a 00 00       	call   8043df <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  802969:	0f 84 a6 01 00 00    	je     802b15 <spawn+0x781>
+  80296f:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802976:	00 00 00 
+  802979:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802980:	00 00 00 
+  802983:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802989:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  80298f:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802995:	29 c7                	sub    %eax,%edi
+  802997:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  80299d:	c1 ee 0c             	shr    $0xc,%esi
+  8029a0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8029a5:	39 c6                	cmp    %eax,%esi
+  8029a7:	0f 47 f0             	cmova  %eax,%esi
+  8029aa:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  8029b0:	85 f6                	test   %esi,%esi
+  8029b2:	0f 8e ed 01 00 00    	jle    802ba5 <spawn+0x811>
+  8029b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029bd:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  8029c3:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8029c5:	6a 07                	push   $0x7
+  8029c7:	89 d8                	mov    %ebx,%eax
+  8029c9:	c1 e0 0c             	shl    $0xc,%eax
+  8029cc:	05 00 00 40 00       	add    $0x400000,%eax
+  8029d1:	50                   	push   %eax
+  8029d2:	6a 00                	push   $0x0
+  8029d4:	68 00 7a 80 00       	push   $0x807a00
+  8029d9:	e8 88 1a 00 00       	call   804466 <pgbatch_alloc>
+  8029de:	83 c4 10             	add    $0x10,%esp
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	0f 88 47 fc ff ff    	js     802630 <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  8029e9:	83 c3 01             	add    $0x1,%ebx
+  8029ec:	39 df                	cmp    %ebx,%edi
+  8029ee:	75 d5                	jne    8029c5 <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8029f0:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  8029f6:	83 ec 0c             	sub    $0xc,%esp
+  8029f9:	68 00 7a 80 00       	push   $0x807a00
+  8029fe:	e8 ea 19 00 00       	call   8043ed <pgbatch_flush>
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	0f 88 66 fe ff ff    	js     802874 <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802a0e:	83 ec 08             	sub    $0x8,%esp
+  802a11:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802a17:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802a1d:	01 c8                	add    %ecx,%eax
+  802a1f:	50                   	push   %eax
+  802a20:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802a26:	e8 89 f4 ff ff       	call   801eb4 <seek>
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	0f 88 3e fe ff ff    	js     802874 <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802a36:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802a3c:	c1 e3 0c             	shl    $0xc,%ebx
+  802a3f:	83 ec 04             	sub    $0x4,%esp
+  802a42:	39 fb                	cmp    %edi,%ebx
+  802a44:	0f 46 fb             	cmovbe %ebx,%edi
+  802a47:	57                   	push   %edi
+  802a48:	68 00 00 40 00       	push   $0x400000
+  802a4d:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802a53:	e8 69 f3 ff ff       	call   801dc1 <readn>
+  802a58:	83 c4 10             	add    $0x10,%esp
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	0f 88 11 fe ff ff    	js     802874 <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  802a63:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  802a6a:	7e 6b                	jle    802ad7 <spawn+0x743>
+  802a6c:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802a72:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802a78:	01 c7                	add    %eax,%edi
+  802a7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7f:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  802a85:	89 f3                	mov    %esi,%ebx
+  802a87:	c1 e3 0c             	shl    $0xc,%ebx
+  802a8a:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802a90:	83 ec 08             	sub    $0x8,%esp
+  802a93:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802a99:	57                   	push   %edi
+  802a9a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802aa0:	53                   	push   %ebx
+  802aa1:	6a 00                	push   $0x0
+  802aa3:	68 00 7a 80 00       	push   $0x807a00
+  802aa8:	e8 f0 19 00 00       	call   80449d <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  802aad:	83 c4 1c             	add    $0x1c,%esp
+  802ab0:	53                   	push   %ebx
+  802ab1:	6a 00                	push   $0x0
+  802ab3:	68 00 7a 80 00       	push   $0x807a00
+  802ab8:	e8 23 1a 00 00       	call   8044e0 <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  802abd:	83 c6 01             	add    $0x1,%esi
+  802ac0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  802acf:	75 b4                	jne    802a85 <spawn+0x6f1>
+  802ad1:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802ad7:	83 ec 0c             	sub    $0xc,%esp
+  802ada:	68 00 7a 80 00       	push   $0x807a00
+  802adf:	e8 09 19 00 00       	call   8043ed <pgbatch_flush>
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	85 c0                	test   %eax,%eax
+  802ae9:	0f 88 28 fb ff ff    	js     802617 <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802aef:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  802af5:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802afb:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802b01:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802b07:	39 f0                	cmp    %esi,%eax
+  802b09:	0f 82 7a fe ff ff    	jb     802989 <spawn+0x5f5>
+  802b0f:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802b15:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802b1b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802b20:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b25:	89 c3                	mov    %eax,%ebx
+  802b27:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802b2d:	39 f0                	cmp    %esi,%eax
+  802b2f:	73 48                	jae    802b79 <spawn+0x7e5>
+  802b31:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802b37:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802b3d:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  802b43:	56                   	push   %esi
+  802b44:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802b4a:	01 d8                	add    %ebx,%eax
+  802b4c:	50                   	push   %eax
+  802b4d:	57                   	push   %edi
+  802b4e:	68 00 7a 80 00       	push   $0x807a00
+  802b53:	e8 0e 19 00 00       	call   804466 <pgbatch_alloc>
+  802b58:	83 c4 10             	add    $0x10,%esp
+  802b5b:	85 c0                	test   %eax,%eax
+  802b5d:	0f 88 f9 fa ff ff    	js     80265c <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802b63:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b69:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  802b6f:	39 c3                	cmp    %eax,%ebx
+  802b71:	72 d0                	jb     802b43 <spawn+0x7af>
+  802b73:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  802b79:	83 ec 0c             	sub    $0xc,%esp
+  802b7c:	68 00 7a 80 00       	push   $0x807a00
+  802b81:	e8 67 18 00 00       	call   8043ed <pgbatch_flush>
+  802b86:	83 c4 10             	add    $0x10,%esp
+  802b89:	e9 30 fd ff ff       	jmp    8028be <spawn+0x52a>
+  802b8e:	89 c6                	mov    %eax,%esi
+  802b90:	e9 9d fa ff ff       	jmp    802632 <spawn+0x29e>
+		return -E_NO_MEM;
+  802b95:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802b9a:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802ba0:	e9 c1 fc ff ff       	jmp    802866 <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802ba5:	83 ec 0c             	sub    $0xc,%esp
+  802ba8:	68 00 7a 80 00       	push   $0x807a00
+  802bad:	e8 3b 18 00 00       	call   8043ed <pgbatch_flush>
+  802bb2:	83 c4 10             	add    $0x10,%esp
+  802bb5:	85 c0                	test   %eax,%eax
+  802bb7:	0f 89 51 fe ff ff    	jns    802a0e <spawn+0x67a>
+  802bbd:	89 c6                	mov    %eax,%esi
+  802bbf:	e9 6e fa ff ff       	jmp    802632 <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  802bc4:	83 ec 08             	sub    $0x8,%esp
+  802bc7:	68 00 00 40 00       	push   $0x400000
+  802bcc:	6a 00                	push   $0x0
+  802bce:	e8 f5 e2 ff ff       	call   800ec8 <sys_page_unmap>
+  802bd3:	83 c4 10             	add    $0x10,%esp
+  802bd6:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  802bdc:	e9 85 fc ff ff       	jmp    802866 <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802be1:	83 ec 04             	sub    $0x4,%esp
+  802be4:	6a 07                	push   $0x7
+  802be6:	68 00 00 40 00       	push   $0x400000
+  802beb:	6a 00                	push   $0x0
+  802bed:	e8 51 e2 ff ff       	call   800e43 <sys_page_alloc>
+  802bf2:	83 c4 10             	add    $0x10,%esp
+  802bf5:	85 c0                	test   %eax,%eax
+  802bf7:	78 a1                	js     802b9a <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  802bf9:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802c00:	00 00 00 
+  802c03:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802c0a:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802c0d:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802c12:	be 00 10 40 00       	mov    $0x401000,%esi
+  802c17:	e9 03 f9 ff ff       	jmp    80251f <spawn+0x18b>
+
+00802c1c <spawnl>:
+{
+  802c1c:	55                   	push   %ebp
+  802c1d:	89 e5                	mov    %esp,%ebp
+  802c1f:	56                   	push   %esi
+  802c20:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802c21:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  802c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802c29:	eb 05                	jmp    802c30 <spawnl+0x14>
+		argc++;
+  802c2b:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802c2e:	89 d0                	mov    %edx,%eax
+  802c30:	8d 50 04             	lea    0x4(%eax),%edx
+  802c33:	83 38 00             	cmpl   $0x0,(%eax)
+  802c36:	75 f3                	jne    802c2b <spawnl+0xf>
+	const char *argv[argc+2];
+  802c38:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802c3f:	83 e0 f0             	and    $0xfffffff0,%eax
+  802c42:	29 c4                	sub    %eax,%esp
+  802c44:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802c48:	89 d8                	mov    %ebx,%eax
+  802c4a:	c1 e8 02             	shr    $0x2,%eax
+  802c4d:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802c50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c53:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  802c5a:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802c61:	00 
+	va_start(vl, arg0);
+  802c62:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  802c65:	89 ce                	mov    %ecx,%esi
+  802c67:	85 c9                	test   %ecx,%ecx
+  802c69:	74 16                	je     802c81 <spawnl+0x65>
+  802c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  802c70:	83 c0 01             	add    $0x1,%eax
+  802c73:	89 d1                	mov    %edx,%ecx
+  802c75:	83 c2 04             	add    $0x4,%edx
+  802c78:	8b 09                	mov    (%ecx),%ecx
+  802c7a:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  802c7d:	39 f0                	cmp    %esi,%eax
+  802c7f:	75 ef                	jne    802c70 <spawnl+0x54>
+	return spawn(prog, argv);
+  802c81:	83 ec 08             	sub    $0x8,%esp
+  802c84:	53                   	push   %ebx
+  802c85:	ff 75 08             	push   0x8(%ebp)
+  802c88:	e8 07 f7 ff ff       	call   802394 <spawn>
+}
+  802c8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c90:	5b                   	pop    %ebx
+  802c91:	5e                   	pop    %esi
+  802c92:	5d                   	pop    %ebp
+  802c93:	c3                   	ret
+
+00802c94 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c94:	55                   	push   %ebp
+  802c95:	89 e5                	mov    %esp,%ebp
+  802c97:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802c9a:	68 fb 54 80 00       	push   $0x8054fb
+  802c9f:	ff 75 0c             	push   0xc(%ebp)
+  802ca2:	e8 68 dd ff ff       	call   800a0f <strcpy>
+	return 0;
+}
+  802ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cac:	c9                   	leave
+  802cad:	c3                   	ret
+
+00802cae <devsock_close>:
+{
+  802cae:	55                   	push   %ebp
+  802caf:	89 e5                	mov    %esp,%ebp
+  802cb1:	53                   	push   %ebx
+  802cb2:	83 ec 10             	sub    $0x10,%esp
+  802cb5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802cb8:	53                   	push   %ebx
+  802cb9:	e8 bd 1f 00 00       	call   804c7b <pageref>
+  802cbe:	89 c2                	mov    %eax,%edx
+  802cc0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802cc8:	83 fa 01             	cmp    $0x1,%edx
+  802ccb:	74 05                	je     802cd2 <devsock_close+0x24>
+}
+  802ccd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802cd2:	83 ec 0c             	sub    $0xc,%esp
+  802cd5:	ff 73 0c             	push   0xc(%ebx)
+  802cd8:	e8 b0 05 00 00       	call   80328d <nsipc_close>
+  802cdd:	83 c4 10             	add    $0x10,%esp
+  802ce0:	eb eb                	jmp    802ccd <devsock_close+0x1f>
+
+00802ce2 <devsock_write>:
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	53                   	push   %ebx
+  802ce6:	83 ec 14             	sub    $0x14,%esp
+  802ce9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802cef:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802cf2:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802cf5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802cf8:	8b 41 08             	mov    0x8(%ecx),%eax
+  802cfb:	c1 f8 09             	sar    $0x9,%eax
+  802cfe:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802d01:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802d07:	77 13                	ja     802d1c <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802d09:	50                   	push   %eax
+  802d0a:	52                   	push   %edx
+  802d0b:	53                   	push   %ebx
+  802d0c:	ff 71 0c             	push   0xc(%ecx)
+  802d0f:	e8 5c 06 00 00       	call   803370 <nsipc_send>
+  802d14:	83 c4 10             	add    $0x10,%esp
+}
+  802d17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d1a:	c9                   	leave
+  802d1b:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802d1c:	50                   	push   %eax
+  802d1d:	6a 01                	push   $0x1
+  802d1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d22:	50                   	push   %eax
+  802d23:	ff 71 0c             	push   0xc(%ecx)
+  802d26:	e8 a6 06 00 00       	call   8033d1 <nsipc_sendmsg>
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	eb e7                	jmp    802d17 <devsock_write+0x35>
+
+00802d30 <devsock_read>:
+{
+  802d30:	55                   	push   %ebp
+  802d31:	89 e5                	mov    %esp,%ebp
+  802d33:	53                   	push   %ebx
+  802d34:	83 ec 14             	sub    $0x14,%esp
+  802d37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d3a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802d3d:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802d40:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802d43:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802d46:	8b 41 08             	mov    0x8(%ecx),%eax
+  802d49:	c1 f8 09             	sar    $0x9,%eax
+  802d4c:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802d4f:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802d55:	77 13                	ja     802d6a <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802d57:	50                   	push   %eax
+  802d58:	52                   	push   %edx
+  802d59:	53                   	push   %ebx
+  802d5a:	ff 71 0c             	push   0xc(%ecx)
+  802d5d:	e8 9c 05 00 00       	call   8032fe <nsipc_recv>
+  802d62:	83 c4 10             	add    $0x10,%esp
+}
+  802d65:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d68:	c9                   	leave
+  802d69:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802d6a:	50                   	push   %eax
+  802d6b:	6a 01                	push   $0x1
+  802d6d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d70:	50                   	push   %eax
+  802d71:	ff 71 0c             	push   0xc(%ecx)
+  802d74:	e8 02 0a 00 00       	call   80377b <nsipc_recvmsg>
+  802d79:	83 c4 10             	add    $0x10,%esp
+  802d7c:	eb e7                	jmp    802d65 <devsock_read+0x35>
+
+00802d7e <fd2sockid>:
+{
+  802d7e:	55                   	push   %ebp
+  802d7f:	89 e5                	mov    %esp,%ebp
+  802d81:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802d84:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802d87:	52                   	push   %edx
+  802d88:	50                   	push   %eax
+  802d89:	e8 0b ed ff ff       	call   801a99 <fd_lookup>
+  802d8e:	83 c4 10             	add    $0x10,%esp
+  802d91:	85 c0                	test   %eax,%eax
+  802d93:	78 10                	js     802da5 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802d95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d98:	8b 0d 40 60 80 00    	mov    0x806040,%ecx
+  802d9e:	39 08                	cmp    %ecx,(%eax)
+  802da0:	75 05                	jne    802da7 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802da2:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802da5:	c9                   	leave
+  802da6:	c3                   	ret
+		return -E_NOT_SUPP;
+  802da7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802dac:	eb f7                	jmp    802da5 <fd2sockid+0x27>
+
+00802dae <sock_flags>:
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802db4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802db7:	52                   	push   %edx
+  802db8:	50                   	push   %eax
+  802db9:	e8 db ec ff ff       	call   801a99 <fd_lookup>
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	85 c0                	test   %eax,%eax
+  802dc3:	78 0e                	js     802dd3 <sock_flags+0x25>
+  802dc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dc8:	8b 40 08             	mov    0x8(%eax),%eax
+  802dcb:	c1 e8 09             	shr    $0x9,%eax
+  802dce:	83 e0 08             	and    $0x8,%eax
+}
+  802dd1:	c9                   	leave
+  802dd2:	c3                   	ret
+		return 0;
+  802dd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd8:	eb f7                	jmp    802dd1 <sock_flags+0x23>
+
+00802dda <alloc_sockfd>:
+{
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	56                   	push   %esi
+  802dde:	53                   	push   %ebx
+  802ddf:	83 ec 1c             	sub    $0x1c,%esp
+  802de2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802de4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802de7:	50                   	push   %eax
+  802de8:	e8 5c ec ff ff       	call   801a49 <fd_alloc>
+  802ded:	89 c3                	mov    %eax,%ebx
+  802def:	83 c4 10             	add    $0x10,%esp
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	78 43                	js     802e39 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802df6:	83 ec 04             	sub    $0x4,%esp
+  802df9:	68 07 04 00 00       	push   $0x407
+  802dfe:	ff 75 f4             	push   -0xc(%ebp)
+  802e01:	6a 00                	push   $0x0
+  802e03:	e8 3b e0 ff ff       	call   800e43 <sys_page_alloc>
+  802e08:	89 c3                	mov    %eax,%ebx
+  802e0a:	83 c4 10             	add    $0x10,%esp
+  802e0d:	85 c0                	test   %eax,%eax
+  802e0f:	78 28                	js     802e39 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802e11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e14:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  802e1a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e1f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802e26:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802e29:	83 ec 0c             	sub    $0xc,%esp
+  802e2c:	50                   	push   %eax
+  802e2d:	e8 f0 eb ff ff       	call   801a22 <fd2num>
+  802e32:	89 c3                	mov    %eax,%ebx
+  802e34:	83 c4 10             	add    $0x10,%esp
+  802e37:	eb 0c                	jmp    802e45 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802e39:	83 ec 0c             	sub    $0xc,%esp
+  802e3c:	56                   	push   %esi
+  802e3d:	e8 4b 04 00 00       	call   80328d <nsipc_close>
+		return r;
+  802e42:	83 c4 10             	add    $0x10,%esp
+}
+  802e45:	89 d8                	mov    %ebx,%eax
+  802e47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e4a:	5b                   	pop    %ebx
+  802e4b:	5e                   	pop    %esi
+  802e4c:	5d                   	pop    %ebp
+  802e4d:	c3                   	ret
+
+00802e4e <accept>:
+{
+  802e4e:	55                   	push   %ebp
+  802e4f:	89 e5                	mov    %esp,%ebp
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802e56:	89 f0                	mov    %esi,%eax
+  802e58:	e8 21 ff ff ff       	call   802d7e <fd2sockid>
+  802e5d:	89 c3                	mov    %eax,%ebx
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	78 24                	js     802e87 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802e63:	89 f0                	mov    %esi,%eax
+  802e65:	e8 44 ff ff ff       	call   802dae <sock_flags>
+  802e6a:	50                   	push   %eax
+  802e6b:	ff 75 10             	push   0x10(%ebp)
+  802e6e:	ff 75 0c             	push   0xc(%ebp)
+  802e71:	53                   	push   %ebx
+  802e72:	e8 6b 03 00 00       	call   8031e2 <nsipc_accept>
+  802e77:	89 c3                	mov    %eax,%ebx
+  802e79:	83 c4 10             	add    $0x10,%esp
+  802e7c:	85 c0                	test   %eax,%eax
+  802e7e:	78 07                	js     802e87 <accept+0x39>
+	return alloc_sockfd(r);
+  802e80:	e8 55 ff ff ff       	call   802dda <alloc_sockfd>
+  802e85:	89 c3                	mov    %eax,%ebx
+}
+  802e87:	89 d8                	mov    %ebx,%eax
+  802e89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e8c:	5b                   	pop    %ebx
+  802e8d:	5e                   	pop    %esi
+  802e8e:	5d                   	pop    %ebp
+  802e8f:	c3                   	ret
+
+00802e90 <bind>:
+{
+  802e90:	55                   	push   %ebp
+  802e91:	89 e5                	mov    %esp,%ebp
+  802e93:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802e96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e99:	e8 e0 fe ff ff       	call   802d7e <fd2sockid>
+  802e9e:	85 c0                	test   %eax,%eax
+  802ea0:	78 12                	js     802eb4 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802ea2:	83 ec 04             	sub    $0x4,%esp
+  802ea5:	ff 75 10             	push   0x10(%ebp)
+  802ea8:	ff 75 0c             	push   0xc(%ebp)
+  802eab:	50                   	push   %eax
+  802eac:	e8 85 03 00 00       	call   803236 <nsipc_bind>
+  802eb1:	83 c4 10             	add    $0x10,%esp
+}
+  802eb4:	c9                   	leave
+  802eb5:	c3                   	ret
+
+00802eb6 <shutdown>:
+{
+  802eb6:	55                   	push   %ebp
+  802eb7:	89 e5                	mov    %esp,%ebp
+  802eb9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebf:	e8 ba fe ff ff       	call   802d7e <fd2sockid>
+  802ec4:	85 c0                	test   %eax,%eax
+  802ec6:	78 0f                	js     802ed7 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802ec8:	83 ec 08             	sub    $0x8,%esp
+  802ecb:	ff 75 0c             	push   0xc(%ebp)
+  802ece:	50                   	push   %eax
+  802ecf:	e8 97 03 00 00       	call   80326b <nsipc_shutdown>
+  802ed4:	83 c4 10             	add    $0x10,%esp
+}
+  802ed7:	c9                   	leave
+  802ed8:	c3                   	ret
+
+00802ed9 <connect>:
+{
+  802ed9:	55                   	push   %ebp
+  802eda:	89 e5                	mov    %esp,%ebp
+  802edc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ee2:	e8 97 fe ff ff       	call   802d7e <fd2sockid>
+  802ee7:	85 c0                	test   %eax,%eax
+  802ee9:	78 12                	js     802efd <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802eeb:	83 ec 04             	sub    $0x4,%esp
+  802eee:	ff 75 10             	push   0x10(%ebp)
+  802ef1:	ff 75 0c             	push   0xc(%ebp)
+  802ef4:	50                   	push   %eax
+  802ef5:	e8 ad 03 00 00       	call   8032a7 <nsipc_connect>
+  802efa:	83 c4 10             	add    $0x10,%esp
+}
+  802efd:	c9                   	leave
+  802efe:	c3                   	ret
+
+00802eff <listen>:
+{
+  802eff:	55                   	push   %ebp
+  802f00:	89 e5                	mov    %esp,%ebp
+  802f02:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802f05:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f08:	e8 71 fe ff ff       	call   802d7e <fd2sockid>
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 0f                	js     802f20 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802f11:	83 ec 08             	sub    $0x8,%esp
+  802f14:	ff 75 0c             	push   0xc(%ebp)
+  802f17:	50                   	push   %eax
+  802f18:	e8 bf 03 00 00       	call   8032dc <nsipc_listen>
+  802f1d:	83 c4 10             	add    $0x10,%esp
+}
+  802f20:	c9                   	leave
+  802f21:	c3                   	ret
+
+00802f22 <sendmsg>:
+{
+  802f22:	55                   	push   %ebp
+  802f23:	89 e5                	mov    %esp,%ebp
+  802f25:	57                   	push   %edi
+  802f26:	56                   	push   %esi
+  802f27:	53                   	push   %ebx
+  802f28:	83 ec 0c             	sub    $0xc,%esp
+  802f2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802f2e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802f31:	89 f0                	mov    %esi,%eax
+  802f33:	e8 46 fe ff ff       	call   802d7e <fd2sockid>
+  802f38:	89 c3                	mov    %eax,%ebx
+  802f3a:	85 c0                	test   %eax,%eax
+  802f3c:	78 1c                	js     802f5a <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802f3e:	89 f0                	mov    %esi,%eax
+  802f40:	e8 69 fe ff ff       	call   802dae <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802f45:	0b 45 10             	or     0x10(%ebp),%eax
+  802f48:	50                   	push   %eax
+  802f49:	ff 77 0c             	push   0xc(%edi)
+  802f4c:	ff 77 08             	push   0x8(%edi)
+  802f4f:	53                   	push   %ebx
+  802f50:	e8 7c 04 00 00       	call   8033d1 <nsipc_sendmsg>
+  802f55:	89 c3                	mov    %eax,%ebx
+  802f57:	83 c4 10             	add    $0x10,%esp
+}
+  802f5a:	89 d8                	mov    %ebx,%eax
+  802f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f5f:	5b                   	pop    %ebx
+  802f60:	5e                   	pop    %esi
+  802f61:	5f                   	pop    %edi
+  802f62:	5d                   	pop    %ebp
+  802f63:	c3                   	ret
+
+00802f64 <recvmsg>:
+{
+  802f64:	55                   	push   %ebp
+  802f65:	89 e5                	mov    %esp,%ebp
+  802f67:	57                   	push   %edi
+  802f68:	56                   	push   %esi
+  802f69:	53                   	push   %ebx
+  802f6a:	83 ec 0c             	sub    $0xc,%esp
+  802f6d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f70:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802f73:	89 f8                	mov    %edi,%eax
+  802f75:	e8 04 fe ff ff       	call   802d7e <fd2sockid>
+  802f7a:	89 c3                	mov    %eax,%ebx
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	78 2a                	js     802faa <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802f80:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802f87:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802f8e:	89 f8                	mov    %edi,%eax
+  802f90:	e8 19 fe ff ff       	call   802dae <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802f95:	0b 45 10             	or     0x10(%ebp),%eax
+  802f98:	50                   	push   %eax
+  802f99:	ff 76 0c             	push   0xc(%esi)
+  802f9c:	ff 76 08             	push   0x8(%esi)
+  802f9f:	53                   	push   %ebx
+  802fa0:	e8 d6 07 00 00       	call   80377b <nsipc_recvmsg>
+  802fa5:	89 c3                	mov    %eax,%ebx
+  802fa7:	83 c4 10             	add    $0x10,%esp
+}
+  802faa:	89 d8                	mov    %ebx,%eax
+  802fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802faf:	5b                   	pop    %ebx
+  802fb0:	5e                   	pop    %esi
+  802fb1:	5f                   	pop    %edi
+  802fb2:	5d                   	pop    %ebp
+  802fb3:	c3                   	ret
+
+00802fb4 <sendfile>:
+{
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	56                   	push   %esi
+  802fb8:	53                   	push   %ebx
+  802fb9:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802fbc:	89 f0                	mov    %esi,%eax
+  802fbe:	e8 bb fd ff ff       	call   802d7e <fd2sockid>
+  802fc3:	89 c3                	mov    %eax,%ebx
+  802fc5:	85 c0                	test   %eax,%eax
+  802fc7:	78 1f                	js     802fe8 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802fc9:	89 f0                	mov    %esi,%eax
+  802fcb:	e8 de fd ff ff       	call   802dae <sock_flags>
+  802fd0:	83 ec 0c             	sub    $0xc,%esp
+  802fd3:	50                   	push   %eax
+  802fd4:	ff 75 14             	push   0x14(%ebp)
+  802fd7:	ff 75 10             	push   0x10(%ebp)
+  802fda:	ff 75 0c             	push   0xc(%ebp)
+  802fdd:	53                   	push   %ebx
+  802fde:	e8 64 06 00 00       	call   803647 <nsipc_sendfile>
+  802fe3:	89 c3                	mov    %eax,%ebx
+  802fe5:	83 c4 20             	add    $0x20,%esp
+}
+  802fe8:	89 d8                	mov    %ebx,%eax
+  802fea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fed:	5b                   	pop    %ebx
+  802fee:	5e                   	pop    %esi
+  802fef:	5d                   	pop    %ebp
+  802ff0:	c3                   	ret
+
+00802ff1 <evctl>:
+{
+  802ff1:	55                   	push   %ebp
+  802ff2:	89 e5                	mov    %esp,%ebp
+  802ff4:	53                   	push   %ebx
+  802ff5:	83 ec 04             	sub    $0x4,%esp
+  802ff8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802ffb:	89 d8                	mov    %ebx,%eax
+  802ffd:	e8 7c fd ff ff       	call   802d7e <fd2sockid>
+  803002:	85 c0                	test   %eax,%eax
+  803004:	78 10                	js     803016 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  803006:	83 ec 04             	sub    $0x4,%esp
+  803009:	53                   	push   %ebx
+  80300a:	ff 75 0c             	push   0xc(%ebp)
+  80300d:	50                   	push   %eax
+  80300e:	e8 d2 0b 00 00       	call   803be5 <nsipc_evctl>
+  803013:	83 c4 10             	add    $0x10,%esp
+}
+  803016:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803019:	c9                   	leave
+  80301a:	c3                   	ret
+
+0080301b <evwait>:
+{
+  80301b:	55                   	push   %ebp
+  80301c:	89 e5                	mov    %esp,%ebp
+  80301e:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  803021:	ff 75 10             	push   0x10(%ebp)
+  803024:	ff 75 0c             	push   0xc(%ebp)
+  803027:	ff 75 08             	push   0x8(%ebp)
+  80302a:	e8 e0 0b 00 00       	call   803c0f <nsipc_evwait>
+}
+  80302f:	c9                   	leave
+  803030:	c3                   	ret
+
+00803031 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803031:	55                   	push   %ebp
+  803032:	89 e5                	mov    %esp,%ebp
+  803034:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803037:	ff 75 10             	push   0x10(%ebp)
+  80303a:	ff 75 0c             	push   0xc(%ebp)
+  80303d:	ff 75 08             	push   0x8(%ebp)
+  803040:	e8 31 0c 00 00       	call   803c76 <nsipc_socket>
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	78 05                	js     803051 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80304c:	e8 89 fd ff ff       	call   802dda <alloc_sockfd>
+}
+  803051:	c9                   	leave
+  803052:	c3                   	ret
+
+00803053 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803053:	55                   	push   %ebp
+  803054:	89 e5                	mov    %esp,%ebp
+  803056:	53                   	push   %ebx
+  803057:	83 ec 04             	sub    $0x4,%esp
+  80305a:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80305c:	83 3d 24 80 80 00 00 	cmpl   $0x0,0x808024
+  803063:	74 26                	je     80308b <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  803065:	6a 07                	push   $0x7
+  803067:	68 00 a0 80 00       	push   $0x80a000
+  80306c:	53                   	push   %ebx
+  80306d:	ff 35 24 80 80 00    	push   0x808024
+  803073:	e8 5b 1b 00 00       	call   804bd3 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803078:	83 c4 0c             	add    $0xc,%esp
+  80307b:	6a 00                	push   $0x0
+  80307d:	6a 00                	push   $0x0
+  80307f:	6a 00                	push   $0x0
+  803081:	e8 bd 18 00 00       	call   804943 <ipc_recv>
+}
+  803086:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803089:	c9                   	leave
+  80308a:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80308b:	83 ec 0c             	sub    $0xc,%esp
+  80308e:	6a 03                	push   $0x3
+  803090:	e8 a7 1b 00 00       	call   804c3c <ipc_find_env>
+  803095:	a3 24 80 80 00       	mov    %eax,0x808024
+  80309a:	83 c4 10             	add    $0x10,%esp
+  80309d:	eb c6                	jmp    803065 <nsipc+0x12>
+
+0080309f <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  80309f:	55                   	push   %ebp
+  8030a0:	89 e5                	mov    %esp,%ebp
+  8030a2:	56                   	push   %esi
+  8030a3:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  8030a4:	8b 35 30 80 80 00    	mov    0x808030,%esi
+		return 0;
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  8030af:	85 f6                	test   %esi,%esi
+  8030b1:	75 33                	jne    8030e6 <nsbulk_map+0x47>
+  8030b3:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8030b8:	83 ec 04             	sub    $0x4,%esp
+  8030bb:	6a 07                	push   $0x7
+  8030bd:	53                   	push   %ebx
+  8030be:	6a 00                	push   $0x0
+  8030c0:	e8 7e dd ff ff       	call   800e43 <sys_page_alloc>
+  8030c5:	83 c4 10             	add    $0x10,%esp
+  8030c8:	85 c0                	test   %eax,%eax
+  8030ca:	78 1a                	js     8030e6 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8030cc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8030d2:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8030d8:	75 de                	jne    8030b8 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8030da:	c7 05 30 80 80 00 01 	movl   $0x1,0x808030
+  8030e1:	00 00 00 
+	return 0;
+  8030e4:	89 f0                	mov    %esi,%eax
+}
+  8030e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030e9:	5b                   	pop    %ebx
+  8030ea:	5e                   	pop    %esi
+  8030eb:	5d                   	pop    %ebp
+  8030ec:	c3                   	ret
+
+008030ed <nsbulk_own>:
+{
+  8030ed:	55                   	push   %ebp
+  8030ee:	89 e5                	mov    %esp,%ebp
+  8030f0:	57                   	push   %edi
+  8030f1:	56                   	push   %esi
+  8030f2:	53                   	push   %ebx
+  8030f3:	83 ec 0c             	sub    $0xc,%esp
+  8030f6:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8030f8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8030fb:	85 d2                	test   %edx,%edx
+  8030fd:	7f 0e                	jg     80310d <nsbulk_own+0x20>
+	return 0;
+  8030ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803104:	eb 47                	jmp    80314d <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  803106:	83 c3 01             	add    $0x1,%ebx
+  803109:	39 fb                	cmp    %edi,%ebx
+  80310b:	7d 3b                	jge    803148 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  80310d:	be 01 00 00 00       	mov    $0x1,%esi
+  803112:	89 d9                	mov    %ebx,%ecx
+  803114:	d3 e6                	shl    %cl,%esi
+  803116:	89 f0                	mov    %esi,%eax
+  803118:	23 05 2c 80 80 00    	and    0x80802c,%eax
+  80311e:	74 e6                	je     803106 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  803120:	83 ec 04             	sub    $0x4,%esp
+  803123:	6a 07                	push   $0x7
+  803125:	89 d8                	mov    %ebx,%eax
+  803127:	c1 e0 0c             	shl    $0xc,%eax
+  80312a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80312f:	50                   	push   %eax
+  803130:	6a 00                	push   $0x0
+  803132:	e8 0c dd ff ff       	call   800e43 <sys_page_alloc>
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	85 c0                	test   %eax,%eax
+  80313c:	78 0f                	js     80314d <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  80313e:	f7 d6                	not    %esi
+  803140:	21 35 2c 80 80 00    	and    %esi,0x80802c
+  803146:	eb be                	jmp    803106 <nsbulk_own+0x19>
+	return 0;
+  803148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80314d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803150:	5b                   	pop    %ebx
+  803151:	5e                   	pop    %esi
+  803152:	5f                   	pop    %edi
+  803153:	5d                   	pop    %ebp
+  803154:	c3                   	ret
+
+00803155 <nsipc_bulk>:
+{
+  803155:	55                   	push   %ebp
+  803156:	89 e5                	mov    %esp,%ebp
+  803158:	57                   	push   %edi
+  803159:	56                   	push   %esi
+  80315a:	53                   	push   %ebx
+  80315b:	83 ec 1c             	sub    $0x1c,%esp
+  80315e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803161:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  803163:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  803169:	c1 fb 0c             	sar    $0xc,%ebx
+  80316c:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  80316f:	83 3d 24 80 80 00 00 	cmpl   $0x0,0x808024
+  803176:	74 56                	je     8031ce <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803178:	85 ff                	test   %edi,%edi
+  80317a:	7e 24                	jle    8031a0 <nsipc_bulk+0x4b>
+  80317c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  803182:	74 1c                	je     8031a0 <nsipc_bulk+0x4b>
+  803184:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80318a:	c1 e3 0c             	shl    $0xc,%ebx
+  80318d:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  803192:	0f b6 10             	movzbl (%eax),%edx
+  803195:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803197:	05 00 10 00 00       	add    $0x1000,%eax
+  80319c:	39 d8                	cmp    %ebx,%eax
+  80319e:	75 f2                	jne    803192 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  8031a0:	83 ec 0c             	sub    $0xc,%esp
+  8031a3:	56                   	push   %esi
+  8031a4:	57                   	push   %edi
+  8031a5:	68 00 00 00 e0       	push   $0xe0000000
+  8031aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8031ad:	ff 35 24 80 80 00    	push   0x808024
+  8031b3:	e8 4f 1a 00 00       	call   804c07 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8031b8:	83 c4 1c             	add    $0x1c,%esp
+  8031bb:	6a 00                	push   $0x0
+  8031bd:	6a 00                	push   $0x0
+  8031bf:	6a 00                	push   $0x0
+  8031c1:	e8 7d 17 00 00       	call   804943 <ipc_recv>
+}
+  8031c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031c9:	5b                   	pop    %ebx
+  8031ca:	5e                   	pop    %esi
+  8031cb:	5f                   	pop    %edi
+  8031cc:	5d                   	pop    %ebp
+  8031cd:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031ce:	83 ec 0c             	sub    $0xc,%esp
+  8031d1:	6a 03                	push   $0x3
+  8031d3:	e8 64 1a 00 00       	call   804c3c <ipc_find_env>
+  8031d8:	a3 24 80 80 00       	mov    %eax,0x808024
+  8031dd:	83 c4 10             	add    $0x10,%esp
+  8031e0:	eb 96                	jmp    803178 <nsipc_bulk+0x23>
+
+008031e2 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8031e2:	55                   	push   %ebp
+  8031e3:	89 e5                	mov    %esp,%ebp
+  8031e5:	53                   	push   %ebx
+  8031e6:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8031e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ec:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  8031f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8031f4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8031f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031fe:	e8 50 fe ff ff       	call   803053 <nsipc>
+  803203:	89 c3                	mov    %eax,%ebx
+  803205:	85 c0                	test   %eax,%eax
+  803207:	79 07                	jns    803210 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803209:	89 d8                	mov    %ebx,%eax
+  80320b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80320e:	c9                   	leave
+  80320f:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803210:	83 ec 04             	sub    $0x4,%esp
+  803213:	ff 35 10 a0 80 00    	push   0x80a010
+  803219:	68 00 a0 80 00       	push   $0x80a000
+  80321e:	ff 75 0c             	push   0xc(%ebp)
+  803221:	e8 99 d9 ff ff       	call   800bbf <memmove>
+		*addrlen = ret->ret_addrlen;
+  803226:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  80322c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80322f:	89 10                	mov    %edx,(%eax)
+  803231:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803234:	eb d3                	jmp    803209 <nsipc_accept+0x27>
+
+00803236 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803236:	55                   	push   %ebp
+  803237:	89 e5                	mov    %esp,%ebp
+  803239:	53                   	push   %ebx
+  80323a:	83 ec 08             	sub    $0x8,%esp
+  80323d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803240:	8b 45 08             	mov    0x8(%ebp),%eax
+  803243:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803248:	53                   	push   %ebx
+  803249:	ff 75 0c             	push   0xc(%ebp)
+  80324c:	68 04 a0 80 00       	push   $0x80a004
+  803251:	e8 69 d9 ff ff       	call   800bbf <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803256:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  80325c:	b8 02 00 00 00       	mov    $0x2,%eax
+  803261:	e8 ed fd ff ff       	call   803053 <nsipc>
+}
+  803266:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803269:	c9                   	leave
+  80326a:	c3                   	ret
+
+0080326b <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80326b:	55                   	push   %ebp
+  80326c:	89 e5                	mov    %esp,%ebp
+  80326e:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803271:	8b 45 08             	mov    0x8(%ebp),%eax
+  803274:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  803279:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80327c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  803281:	b8 03 00 00 00       	mov    $0x3,%eax
+  803286:	e8 c8 fd ff ff       	call   803053 <nsipc>
+}
+  80328b:	c9                   	leave
+  80328c:	c3                   	ret
+
+0080328d <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80328d:	55                   	push   %ebp
+  80328e:	89 e5                	mov    %esp,%ebp
+  803290:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803293:	8b 45 08             	mov    0x8(%ebp),%eax
+  803296:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  80329b:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032a0:	e8 ae fd ff ff       	call   803053 <nsipc>
+}
+  8032a5:	c9                   	leave
+  8032a6:	c3                   	ret
+
+008032a7 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032a7:	55                   	push   %ebp
+  8032a8:	89 e5                	mov    %esp,%ebp
+  8032aa:	53                   	push   %ebx
+  8032ab:	83 ec 08             	sub    $0x8,%esp
+  8032ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8032b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8032b9:	53                   	push   %ebx
+  8032ba:	ff 75 0c             	push   0xc(%ebp)
+  8032bd:	68 04 a0 80 00       	push   $0x80a004
+  8032c2:	e8 f8 d8 ff ff       	call   800bbf <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8032c7:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  8032cd:	b8 05 00 00 00       	mov    $0x5,%eax
+  8032d2:	e8 7c fd ff ff       	call   803053 <nsipc>
+}
+  8032d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032da:	c9                   	leave
+  8032db:	c3                   	ret
+
+008032dc <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8032dc:	55                   	push   %ebp
+  8032dd:	89 e5                	mov    %esp,%ebp
+  8032df:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8032e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032e5:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  8032ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032ed:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  8032f2:	b8 06 00 00 00       	mov    $0x6,%eax
+  8032f7:	e8 57 fd ff ff       	call   803053 <nsipc>
+}
+  8032fc:	c9                   	leave
+  8032fd:	c3                   	ret
+
+008032fe <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8032fe:	55                   	push   %ebp
+  8032ff:	89 e5                	mov    %esp,%ebp
+  803301:	56                   	push   %esi
+  803302:	53                   	push   %ebx
+  803303:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803306:	8b 45 08             	mov    0x8(%ebp),%eax
+  803309:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  80330e:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  803314:	8b 45 14             	mov    0x14(%ebp),%eax
+  803317:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80331c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803321:	e8 2d fd ff ff       	call   803053 <nsipc>
+  803326:	89 c3                	mov    %eax,%ebx
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	78 22                	js     80334e <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80332c:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803331:	39 c6                	cmp    %eax,%esi
+  803333:	0f 4e c6             	cmovle %esi,%eax
+  803336:	39 c3                	cmp    %eax,%ebx
+  803338:	7f 1d                	jg     803357 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80333a:	83 ec 04             	sub    $0x4,%esp
+  80333d:	53                   	push   %ebx
+  80333e:	68 00 a0 80 00       	push   $0x80a000
+  803343:	ff 75 0c             	push   0xc(%ebp)
+  803346:	e8 74 d8 ff ff       	call   800bbf <memmove>
+  80334b:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80334e:	89 d8                	mov    %ebx,%eax
+  803350:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803353:	5b                   	pop    %ebx
+  803354:	5e                   	pop    %esi
+  803355:	5d                   	pop    %ebp
+  803356:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803357:	68 07 55 80 00       	push   $0x805507
+  80335c:	68 66 54 80 00       	push   $0x805466
+  803361:	68 b2 00 00 00       	push   $0xb2
+  803366:	68 1c 55 80 00       	push   $0x80551c
+  80336b:	e8 cd ce ff ff       	call   80023d <_panic>
+
+00803370 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803370:	55                   	push   %ebp
+  803371:	89 e5                	mov    %esp,%ebp
+  803373:	53                   	push   %ebx
+  803374:	83 ec 04             	sub    $0x4,%esp
+  803377:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80337a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80337d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  803382:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803388:	7f 2e                	jg     8033b8 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80338a:	83 ec 04             	sub    $0x4,%esp
+  80338d:	53                   	push   %ebx
+  80338e:	ff 75 0c             	push   0xc(%ebp)
+  803391:	68 0c a0 80 00       	push   $0x80a00c
+  803396:	e8 24 d8 ff ff       	call   800bbf <memmove>
+	nsipcbuf.send.req_size = size;
+  80339b:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  8033a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033a4:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  8033a9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033ae:	e8 a0 fc ff ff       	call   803053 <nsipc>
+}
+  8033b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033b6:	c9                   	leave
+  8033b7:	c3                   	ret
+	assert(size < 1600);
+  8033b8:	68 28 55 80 00       	push   $0x805528
+  8033bd:	68 66 54 80 00       	push   $0x805466
+  8033c2:	68 bd 00 00 00       	push   $0xbd
+  8033c7:	68 1c 55 80 00       	push   $0x80551c
+  8033cc:	e8 6c ce ff ff       	call   80023d <_panic>
+
+008033d1 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8033d1:	55                   	push   %ebp
+  8033d2:	89 e5                	mov    %esp,%ebp
+  8033d4:	57                   	push   %edi
+  8033d5:	56                   	push   %esi
+  8033d6:	53                   	push   %ebx
+  8033d7:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8033da:	e8 c0 fc ff ff       	call   80309f <nsbulk_map>
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	78 55                	js     803438 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8033e3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8033ea:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8033f1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8033f8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8033fb:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8033fe:	0f 8d 24 02 00 00    	jge    803628 <nsipc_sendmsg+0x257>
+  803404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803407:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80340a:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  80340d:	89 d8                	mov    %ebx,%eax
+  80340f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803414:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  803416:	83 ec 0c             	sub    $0xc,%esp
+  803419:	68 20 7d 80 00       	push   $0x807d20
+  80341e:	e8 bc 0f 00 00       	call   8043df <pgbatch_init>
+  803423:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803426:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803428:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80342b:	e9 82 00 00 00       	jmp    8034b2 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  803430:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803433:	85 db                	test   %ebx,%ebx
+  803435:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  803438:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80343b:	5b                   	pop    %ebx
+  80343c:	5e                   	pop    %esi
+  80343d:	5f                   	pop    %edi
+  80343e:	5d                   	pop    %ebp
+  80343f:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  803440:	b8 00 10 00 00       	mov    $0x1000,%eax
+  803445:	29 c8                	sub    %ecx,%eax
+  803447:	39 d0                	cmp    %edx,%eax
+  803449:	0f 46 d0             	cmovbe %eax,%edx
+  80344c:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  80344e:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803454:	85 ff                	test   %edi,%edi
+  803456:	0f 49 c7             	cmovns %edi,%eax
+  803459:	c1 f8 0c             	sar    $0xc,%eax
+  80345c:	ba 01 00 00 00       	mov    $0x1,%edx
+  803461:	e8 87 fc ff ff       	call   8030ed <nsbulk_own>
+  803466:	85 c0                	test   %eax,%eax
+  803468:	0f 88 17 01 00 00    	js     803585 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  80346e:	83 ec 04             	sub    $0x4,%esp
+  803471:	56                   	push   %esi
+  803472:	ff 75 e0             	push   -0x20(%ebp)
+  803475:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803478:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80347d:	50                   	push   %eax
+  80347e:	e8 3c d7 ff ff       	call   800bbf <memmove>
+  803483:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  803486:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  803489:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80348c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80348f:	0f 84 fd 00 00 00    	je     803592 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  803495:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803498:	01 f7                	add    %esi,%edi
+  80349a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80349d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8034a0:	0f 8d 01 01 00 00    	jge    8035a7 <nsipc_sendmsg+0x1d6>
+  8034a6:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8034ac:	0f 8f f0 00 00 00    	jg     8035a2 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8034b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034b5:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8034b8:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8034bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034be:	89 c2                	mov    %eax,%edx
+  8034c0:	03 13                	add    (%ebx),%edx
+  8034c2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8034c5:	8b 73 04             	mov    0x4(%ebx),%esi
+  8034c8:	29 c6                	sub    %eax,%esi
+  8034ca:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8034cf:	29 f9                	sub    %edi,%ecx
+  8034d1:	39 ce                	cmp    %ecx,%esi
+  8034d3:	89 ca                	mov    %ecx,%edx
+  8034d5:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8034d8:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8034db:	89 f9                	mov    %edi,%ecx
+  8034dd:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8034e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8034e6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8034eb:	09 c8                	or     %ecx,%eax
+  8034ed:	0f 85 4d ff ff ff    	jne    803440 <nsipc_sendmsg+0x6f>
+  8034f3:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8034f9:	0f 86 41 ff ff ff    	jbe    803440 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8034ff:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  803505:	85 ff                	test   %edi,%edi
+  803507:	0f 49 c7             	cmovns %edi,%eax
+  80350a:	c1 f8 0c             	sar    $0xc,%eax
+  80350d:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  80350f:	89 d1                	mov    %edx,%ecx
+  803511:	c1 e9 0c             	shr    $0xc,%ecx
+  803514:	01 c8                	add    %ecx,%eax
+  803516:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803519:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80351c:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  80351e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803521:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803526:	29 c8                	sub    %ecx,%eax
+  803528:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80352b:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80352e:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803530:	b8 01 00 00 00       	mov    $0x1,%eax
+  803535:	89 f9                	mov    %edi,%ecx
+  803537:	d3 e0                	shl    %cl,%eax
+  803539:	09 05 2c 80 80 00    	or     %eax,0x80802c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80353f:	83 ec 08             	sub    $0x8,%esp
+  803542:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  803544:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803547:	50                   	push   %eax
+  803548:	6a 00                	push   $0x0
+  80354a:	56                   	push   %esi
+  80354b:	6a 00                	push   $0x0
+  80354d:	68 20 7d 80 00       	push   $0x807d20
+  803552:	e8 46 0f 00 00       	call   80449d <pgbatch_map>
+  803557:	83 c4 20             	add    $0x20,%esp
+  80355a:	85 c0                	test   %eax,%eax
+  80355c:	0f 88 ce fe ff ff    	js     803430 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  803562:	83 c7 01             	add    $0x1,%edi
+  803565:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80356b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80356e:	39 c7                	cmp    %eax,%edi
+  803570:	75 be                	jne    803530 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  803572:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803575:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803578:	89 d6                	mov    %edx,%esi
+  80357a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803580:	e9 01 ff ff ff       	jmp    803486 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  803585:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803588:	85 db                	test   %ebx,%ebx
+  80358a:	0f 45 c3             	cmovne %ebx,%eax
+  80358d:	e9 a6 fe ff ff       	jmp    803438 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  803592:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  803596:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80359d:	e9 f3 fe ff ff       	jmp    803495 <nsipc_sendmsg+0xc4>
+  8035a2:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8035a5:	eb 03                	jmp    8035aa <nsipc_sendmsg+0x1d9>
+  8035a7:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8035aa:	83 ec 0c             	sub    $0xc,%esp
+  8035ad:	68 20 7d 80 00       	push   $0x807d20
+  8035b2:	e8 36 0e 00 00       	call   8043ed <pgbatch_flush>
+  8035b7:	83 c4 10             	add    $0x10,%esp
+  8035ba:	85 c0                	test   %eax,%eax
+  8035bc:	78 50                	js     80360e <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8035be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035c1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8035c6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8035cc:	89 fb                	mov    %edi,%ebx
+  8035ce:	29 f3                	sub    %esi,%ebx
+  8035d0:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8035d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035d9:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8035de:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8035e3:	89 fa                	mov    %edi,%edx
+  8035e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8035ea:	e8 66 fb ff ff       	call   803155 <nsipc_bulk>
+  8035ef:	85 c0                	test   %eax,%eax
+  8035f1:	78 28                	js     80361b <nsipc_sendmsg+0x24a>
+		sent += r;
+  8035f3:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8035f6:	39 c3                	cmp    %eax,%ebx
+  8035f8:	75 0c                	jne    803606 <nsipc_sendmsg+0x235>
+  8035fa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8035fd:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803600:	0f 8f f2 fd ff ff    	jg     8033f8 <nsipc_sendmsg+0x27>
+		sent += r;
+  803606:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803609:	e9 2a fe ff ff       	jmp    803438 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80360e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803611:	85 db                	test   %ebx,%ebx
+  803613:	0f 45 c3             	cmovne %ebx,%eax
+  803616:	e9 1d fe ff ff       	jmp    803438 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  80361b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80361e:	85 db                	test   %ebx,%ebx
+  803620:	0f 45 c3             	cmovne %ebx,%eax
+  803623:	e9 10 fe ff ff       	jmp    803438 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803628:	83 ec 0c             	sub    $0xc,%esp
+  80362b:	68 20 7d 80 00       	push   $0x807d20
+  803630:	e8 aa 0d 00 00       	call   8043df <pgbatch_init>
+  803635:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803638:	be 00 00 00 00       	mov    $0x0,%esi
+  80363d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803642:	e9 63 ff ff ff       	jmp    8035aa <nsipc_sendmsg+0x1d9>
+
+00803647 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803647:	55                   	push   %ebp
+  803648:	89 e5                	mov    %esp,%ebp
+  80364a:	57                   	push   %edi
+  80364b:	56                   	push   %esi
+  80364c:	53                   	push   %ebx
+  80364d:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  803650:	83 3d 28 80 80 00 00 	cmpl   $0x0,0x808028
+  803657:	0f 84 c8 00 00 00    	je     803725 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  80365d:	83 3d 24 80 80 00 00 	cmpl   $0x0,0x808024
+  803664:	0f 84 e4 00 00 00    	je     80374e <nsipc_sendfile+0x107>
+{
+  80366a:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  80366f:	89 fb                	mov    %edi,%ebx
+  803671:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  803674:	0f 83 f0 00 00 00    	jae    80376a <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80367a:	89 fa                	mov    %edi,%edx
+  80367c:	03 55 10             	add    0x10(%ebp),%edx
+  80367f:	89 d0                	mov    %edx,%eax
+  803681:	c1 f8 1f             	sar    $0x1f,%eax
+  803684:	c1 e8 14             	shr    $0x14,%eax
+  803687:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80368a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803690:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803692:	6a 10                	push   $0x10
+  803694:	68 00 20 01 e0       	push   $0xe0012000
+  803699:	52                   	push   %edx
+  80369a:	ff 75 0c             	push   0xc(%ebp)
+  80369d:	e8 fe eb ff ff       	call   8022a0 <fmap>
+  8036a2:	83 c4 10             	add    $0x10,%esp
+  8036a5:	85 c0                	test   %eax,%eax
+  8036a7:	0f 8e b8 00 00 00    	jle    803765 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8036ad:	39 c6                	cmp    %eax,%esi
+  8036af:	0f 8d b5 00 00 00    	jge    80376a <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8036b5:	29 f0                	sub    %esi,%eax
+  8036b7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8036ba:	29 da                	sub    %ebx,%edx
+  8036bc:	39 d0                	cmp    %edx,%eax
+  8036be:	89 d3                	mov    %edx,%ebx
+  8036c0:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8036c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036c6:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8036cb:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8036d1:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8036d7:	8b 45 18             	mov    0x18(%ebp),%eax
+  8036da:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8036df:	83 ec 0c             	sub    $0xc,%esp
+  8036e2:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8036e4:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8036eb:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8036ee:	83 c0 01             	add    $0x1,%eax
+  8036f1:	50                   	push   %eax
+  8036f2:	68 00 10 01 e0       	push   $0xe0011000
+  8036f7:	6a 11                	push   $0x11
+  8036f9:	ff 35 24 80 80 00    	push   0x808024
+  8036ff:	e8 03 15 00 00       	call   804c07 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803704:	83 c4 1c             	add    $0x1c,%esp
+  803707:	6a 00                	push   $0x0
+  803709:	6a 00                	push   $0x0
+  80370b:	6a 00                	push   $0x0
+  80370d:	e8 31 12 00 00       	call   804943 <ipc_recv>
+  803712:	83 c4 10             	add    $0x10,%esp
+  803715:	85 c0                	test   %eax,%eax
+  803717:	78 5b                	js     803774 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803719:	01 c7                	add    %eax,%edi
+		if (r < n)
+  80371b:	39 c3                	cmp    %eax,%ebx
+  80371d:	0f 8e 4c ff ff ff    	jle    80366f <nsipc_sendfile+0x28>
+  803723:	eb 45                	jmp    80376a <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803725:	83 ec 04             	sub    $0x4,%esp
+  803728:	6a 07                	push   $0x7
+  80372a:	68 00 10 01 e0       	push   $0xe0011000
+  80372f:	6a 00                	push   $0x0
+  803731:	e8 0d d7 ff ff       	call   800e43 <sys_page_alloc>
+  803736:	89 c7                	mov    %eax,%edi
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	85 c0                	test   %eax,%eax
+  80373d:	78 2b                	js     80376a <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  80373f:	c7 05 28 80 80 00 01 	movl   $0x1,0x808028
+  803746:	00 00 00 
+  803749:	e9 0f ff ff ff       	jmp    80365d <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80374e:	83 ec 0c             	sub    $0xc,%esp
+  803751:	6a 03                	push   $0x3
+  803753:	e8 e4 14 00 00       	call   804c3c <ipc_find_env>
+  803758:	a3 24 80 80 00       	mov    %eax,0x808024
+  80375d:	83 c4 10             	add    $0x10,%esp
+  803760:	e9 05 ff ff ff       	jmp    80366a <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803765:	85 ff                	test   %edi,%edi
+  803767:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80376a:	89 f8                	mov    %edi,%eax
+  80376c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80376f:	5b                   	pop    %ebx
+  803770:	5e                   	pop    %esi
+  803771:	5f                   	pop    %edi
+  803772:	5d                   	pop    %ebp
+  803773:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803774:	85 ff                	test   %edi,%edi
+  803776:	0f 44 f8             	cmove  %eax,%edi
+  803779:	eb ef                	jmp    80376a <nsipc_sendfile+0x123>
+
+0080377b <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80377b:	55                   	push   %ebp
+  80377c:	89 e5                	mov    %esp,%ebp
+  80377e:	57                   	push   %edi
+  80377f:	56                   	push   %esi
+  803780:	53                   	push   %ebx
+  803781:	83 ec 1c             	sub    $0x1c,%esp
+  803784:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803787:	e8 13 f9 ff ff       	call   80309f <nsbulk_map>
+  80378c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	0f 88 ba 00 00 00    	js     803851 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803797:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80379b:	0f 8e bb 00 00 00    	jle    80385c <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8037a1:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8037a6:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8037ab:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8037b0:	89 f8                	mov    %edi,%eax
+  8037b2:	29 f0                	sub    %esi,%eax
+  8037b4:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8037b8:	39 c8                	cmp    %ecx,%eax
+  8037ba:	0f 47 c1             	cmova  %ecx,%eax
+  8037bd:	01 f0                	add    %esi,%eax
+  8037bf:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8037c1:	83 c2 01             	add    $0x1,%edx
+  8037c4:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8037c7:	7e 07                	jle    8037d0 <nsipc_recvmsg+0x55>
+  8037c9:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8037ce:	7e e0                	jle    8037b0 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8037d0:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8037d6:	c1 fa 0c             	sar    $0xc,%edx
+  8037d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037de:	e8 0a f9 ff ff       	call   8030ed <nsbulk_own>
+  8037e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8037e6:	85 c0                	test   %eax,%eax
+  8037e8:	78 67                	js     803851 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8037ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037ed:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8037f2:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8037f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8037fb:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803800:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803805:	89 f2                	mov    %esi,%edx
+  803807:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80380c:	e8 44 f9 ff ff       	call   803155 <nsipc_bulk>
+  803811:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803814:	85 c0                	test   %eax,%eax
+  803816:	78 39                	js     803851 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803818:	39 f0                	cmp    %esi,%eax
+  80381a:	7f 4a                	jg     803866 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  80381c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803821:	85 c0                	test   %eax,%eax
+  803823:	7e 2c                	jle    803851 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803825:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803828:	29 fe                	sub    %edi,%esi
+  80382a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80382d:	39 c6                	cmp    %eax,%esi
+  80382f:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803832:	83 ec 04             	sub    $0x4,%esp
+  803835:	56                   	push   %esi
+  803836:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80383c:	50                   	push   %eax
+  80383d:	ff 33                	push   (%ebx)
+  80383f:	e8 7b d3 ff ff       	call   800bbf <memmove>
+		n += m;
+  803844:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803846:	83 c3 08             	add    $0x8,%ebx
+  803849:	83 c4 10             	add    $0x10,%esp
+  80384c:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  80384f:	7f d4                	jg     803825 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803851:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803854:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803857:	5b                   	pop    %ebx
+  803858:	5e                   	pop    %esi
+  803859:	5f                   	pop    %edi
+  80385a:	5d                   	pop    %ebp
+  80385b:	c3                   	ret
+	int r, i, n, len = 0;
+  80385c:	be 00 00 00 00       	mov    $0x0,%esi
+  803861:	e9 6a ff ff ff       	jmp    8037d0 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803866:	68 13 55 80 00       	push   $0x805513
+  80386b:	68 66 54 80 00       	push   $0x805466
+  803870:	68 3b 01 00 00       	push   $0x13b
+  803875:	68 1c 55 80 00       	push   $0x80551c
+  80387a:	e8 be c9 ff ff       	call   80023d <_panic>
+
+0080387f <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  80387f:	55                   	push   %ebp
+  803880:	89 e5                	mov    %esp,%ebp
+  803882:	57                   	push   %edi
+  803883:	56                   	push   %esi
+  803884:	53                   	push   %ebx
+  803885:	83 ec 0c             	sub    $0xc,%esp
+  803888:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80388b:	8b 75 10             	mov    0x10(%ebp),%esi
+  80388e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803891:	8b 45 08             	mov    0x8(%ebp),%eax
+  803894:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  803899:	8b 07                	mov    (%edi),%eax
+  80389b:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  8038a0:	8b 47 04             	mov    0x4(%edi),%eax
+  8038a3:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  8038a8:	8b 47 08             	mov    0x8(%edi),%eax
+  8038ab:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  8038b0:	8b 47 0c             	mov    0xc(%edi),%eax
+  8038b3:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  8038b8:	8b 47 10             	mov    0x10(%edi),%eax
+  8038bb:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  8038c0:	8b 47 14             	mov    0x14(%edi),%eax
+  8038c3:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  8038c8:	8b 47 18             	mov    0x18(%edi),%eax
+  8038cb:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  8038d0:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8038d3:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  8038d8:	8b 47 20             	mov    0x20(%edi),%eax
+  8038db:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  8038e0:	8b 47 24             	mov    0x24(%edi),%eax
+  8038e3:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  8038e8:	8b 47 28             	mov    0x28(%edi),%eax
+  8038eb:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  8038f0:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8038f3:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  8038f8:	8b 47 30             	mov    0x30(%edi),%eax
+  8038fb:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  803900:	8b 47 34             	mov    0x34(%edi),%eax
+  803903:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  803908:	8b 47 38             	mov    0x38(%edi),%eax
+  80390b:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  803910:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803913:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803918:	8b 06                	mov    (%esi),%eax
+  80391a:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  80391f:	8b 46 04             	mov    0x4(%esi),%eax
+  803922:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  803927:	8b 46 08             	mov    0x8(%esi),%eax
+  80392a:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  80392f:	8b 46 0c             	mov    0xc(%esi),%eax
+  803932:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  803937:	8b 46 10             	mov    0x10(%esi),%eax
+  80393a:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  80393f:	8b 46 14             	mov    0x14(%esi),%eax
+  803942:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  803947:	8b 46 18             	mov    0x18(%esi),%eax
+  80394a:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  80394f:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803952:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  803957:	8b 46 20             	mov    0x20(%esi),%eax
+  80395a:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  80395f:	8b 46 24             	mov    0x24(%esi),%eax
+  803962:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  803967:	8b 46 28             	mov    0x28(%esi),%eax
+  80396a:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  80396f:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803972:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  803977:	8b 46 30             	mov    0x30(%esi),%eax
+  80397a:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  80397f:	8b 46 34             	mov    0x34(%esi),%eax
+  803982:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  803987:	8b 46 38             	mov    0x38(%esi),%eax
+  80398a:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  80398f:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803992:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803997:	8b 03                	mov    (%ebx),%eax
+  803999:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  80399e:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039a1:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  8039a6:	8b 43 08             	mov    0x8(%ebx),%eax
+  8039a9:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  8039ae:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8039b1:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  8039b6:	8b 43 10             	mov    0x10(%ebx),%eax
+  8039b9:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  8039be:	8b 43 14             	mov    0x14(%ebx),%eax
+  8039c1:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  8039c6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8039c9:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  8039ce:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8039d1:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  8039d6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8039d9:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  8039de:	8b 43 24             	mov    0x24(%ebx),%eax
+  8039e1:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  8039e6:	8b 43 28             	mov    0x28(%ebx),%eax
+  8039e9:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  8039ee:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8039f1:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  8039f6:	8b 43 30             	mov    0x30(%ebx),%eax
+  8039f9:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  8039fe:	8b 43 34             	mov    0x34(%ebx),%eax
+  803a01:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  803a06:	8b 43 38             	mov    0x38(%ebx),%eax
+  803a09:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  803a0e:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803a11:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803a16:	8b 45 18             	mov    0x18(%ebp),%eax
+  803a19:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803a1e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803a23:	e8 2b f6 ff ff       	call   803053 <nsipc>
+  803a28:	85 c0                	test   %eax,%eax
+  803a2a:	0f 88 ad 01 00 00    	js     803bdd <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803a30:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803a36:	89 17                	mov    %edx,(%edi)
+  803a38:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  803a3e:	89 57 04             	mov    %edx,0x4(%edi)
+  803a41:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  803a47:	89 57 08             	mov    %edx,0x8(%edi)
+  803a4a:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803a50:	89 57 0c             	mov    %edx,0xc(%edi)
+  803a53:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  803a59:	89 57 10             	mov    %edx,0x10(%edi)
+  803a5c:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  803a62:	89 57 14             	mov    %edx,0x14(%edi)
+  803a65:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803a6b:	89 57 18             	mov    %edx,0x18(%edi)
+  803a6e:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  803a74:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803a77:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  803a7d:	89 57 20             	mov    %edx,0x20(%edi)
+  803a80:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  803a86:	89 57 24             	mov    %edx,0x24(%edi)
+  803a89:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  803a8f:	89 57 28             	mov    %edx,0x28(%edi)
+  803a92:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  803a98:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803a9b:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  803aa1:	89 57 30             	mov    %edx,0x30(%edi)
+  803aa4:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  803aaa:	89 57 34             	mov    %edx,0x34(%edi)
+  803aad:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  803ab3:	89 57 38             	mov    %edx,0x38(%edi)
+  803ab6:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  803abc:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803abf:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  803ac5:	89 16                	mov    %edx,(%esi)
+  803ac7:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  803acd:	89 56 04             	mov    %edx,0x4(%esi)
+  803ad0:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  803ad6:	89 56 08             	mov    %edx,0x8(%esi)
+  803ad9:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  803adf:	89 56 0c             	mov    %edx,0xc(%esi)
+  803ae2:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  803ae8:	89 56 10             	mov    %edx,0x10(%esi)
+  803aeb:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  803af1:	89 56 14             	mov    %edx,0x14(%esi)
+  803af4:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  803afa:	89 56 18             	mov    %edx,0x18(%esi)
+  803afd:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  803b03:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803b06:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  803b0c:	89 56 20             	mov    %edx,0x20(%esi)
+  803b0f:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  803b15:	89 56 24             	mov    %edx,0x24(%esi)
+  803b18:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  803b1e:	89 56 28             	mov    %edx,0x28(%esi)
+  803b21:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  803b27:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803b2a:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  803b30:	89 56 30             	mov    %edx,0x30(%esi)
+  803b33:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  803b39:	89 56 34             	mov    %edx,0x34(%esi)
+  803b3c:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  803b42:	89 56 38             	mov    %edx,0x38(%esi)
+  803b45:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  803b4b:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803b4e:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  803b54:	89 13                	mov    %edx,(%ebx)
+  803b56:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  803b5c:	89 53 04             	mov    %edx,0x4(%ebx)
+  803b5f:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  803b65:	89 53 08             	mov    %edx,0x8(%ebx)
+  803b68:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  803b6e:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803b71:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  803b77:	89 53 10             	mov    %edx,0x10(%ebx)
+  803b7a:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  803b80:	89 53 14             	mov    %edx,0x14(%ebx)
+  803b83:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  803b89:	89 53 18             	mov    %edx,0x18(%ebx)
+  803b8c:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  803b92:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803b95:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  803b9b:	89 53 20             	mov    %edx,0x20(%ebx)
+  803b9e:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  803ba4:	89 53 24             	mov    %edx,0x24(%ebx)
+  803ba7:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  803bad:	89 53 28             	mov    %edx,0x28(%ebx)
+  803bb0:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  803bb6:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803bb9:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  803bbf:	89 53 30             	mov    %edx,0x30(%ebx)
+  803bc2:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  803bc8:	89 53 34             	mov    %edx,0x34(%ebx)
+  803bcb:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  803bd1:	89 53 38             	mov    %edx,0x38(%ebx)
+  803bd4:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  803bda:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803bdd:	83 c4 0c             	add    $0xc,%esp
+  803be0:	5b                   	pop    %ebx
+  803be1:	5e                   	pop    %esi
+  803be2:	5f                   	pop    %edi
+  803be3:	5d                   	pop    %ebp
+  803be4:	c3                   	ret
+
+00803be5 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803be5:	55                   	push   %ebp
+  803be6:	89 e5                	mov    %esp,%ebp
+  803be8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  803bee:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  803bf3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bf6:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  803bfb:	8b 45 10             	mov    0x10(%ebp),%eax
+  803bfe:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  803c03:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803c08:	e8 46 f4 ff ff       	call   803053 <nsipc>
+}
+  803c0d:	c9                   	leave
+  803c0e:	c3                   	ret
+
+00803c0f <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803c0f:	55                   	push   %ebp
+  803c10:	89 e5                	mov    %esp,%ebp
+  803c12:	56                   	push   %esi
+  803c13:	53                   	push   %ebx
+  803c14:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803c17:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803c1d:	8b 45 10             	mov    0x10(%ebp),%eax
+  803c20:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803c25:	b8 10 00 00 00       	mov    $0x10,%eax
+  803c2a:	e8 24 f4 ff ff       	call   803053 <nsipc>
+  803c2f:	89 c3                	mov    %eax,%ebx
+  803c31:	85 c0                	test   %eax,%eax
+  803c33:	7e 1f                	jle    803c54 <nsipc_evwait+0x45>
+		assert(r <= max);
+  803c35:	39 c6                	cmp    %eax,%esi
+  803c37:	7c 24                	jl     803c5d <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803c39:	83 ec 04             	sub    $0x4,%esp
+  803c3c:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803c43:	50                   	push   %eax
+  803c44:	68 00 a0 80 00       	push   $0x80a000
+  803c49:	ff 75 08             	push   0x8(%ebp)
+  803c4c:	e8 6e cf ff ff       	call   800bbf <memmove>
+  803c51:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803c54:	89 d8                	mov    %ebx,%eax
+  803c56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c59:	5b                   	pop    %ebx
+  803c5a:	5e                   	pop    %esi
+  803c5b:	5d                   	pop    %ebp
+  803c5c:	c3                   	ret
+		assert(r <= max);
+  803c5d:	68 34 55 80 00       	push   $0x805534
+  803c62:	68 66 54 80 00       	push   $0x805466
+  803c67:	68 6a 01 00 00       	push   $0x16a
+  803c6c:	68 1c 55 80 00       	push   $0x80551c
+  803c71:	e8 c7 c5 ff ff       	call   80023d <_panic>
+
+00803c76 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803c76:	55                   	push   %ebp
+  803c77:	89 e5                	mov    %esp,%ebp
+  803c79:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  803c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c7f:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  803c84:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c87:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  803c8c:	8b 45 10             	mov    0x10(%ebp),%eax
+  803c8f:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  803c94:	b8 09 00 00 00       	mov    $0x9,%eax
+  803c99:	e8 b5 f3 ff ff       	call   803053 <nsipc>
+}
+  803c9e:	c9                   	leave
+  803c9f:	c3                   	ret
+
+00803ca0 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803ca0:	55                   	push   %ebp
+  803ca1:	89 e5                	mov    %esp,%ebp
+  803ca3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  803ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ca9:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  803cae:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803cb3:	e8 9b f3 ff ff       	call   803053 <nsipc>
+}
+  803cb8:	c9                   	leave
+  803cb9:	c3                   	ret
+
+00803cba <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  803cba:	55                   	push   %ebp
+  803cbb:	89 e5                	mov    %esp,%ebp
+  803cbd:	53                   	push   %ebx
+  803cbe:	83 ec 04             	sub    $0x4,%esp
+  803cc1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803cc4:	b8 12 00 00 00       	mov    $0x12,%eax
+  803cc9:	e8 85 f3 ff ff       	call   803053 <nsipc>
+  803cce:	85 c0                	test   %eax,%eax
+  803cd0:	78 50                	js     803d22 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803cd2:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  803cd8:	89 13                	mov    %edx,(%ebx)
+  803cda:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803ce0:	89 53 04             	mov    %edx,0x4(%ebx)
+  803ce3:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  803ce9:	89 53 08             	mov    %edx,0x8(%ebx)
+  803cec:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  803cf2:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803cf5:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803cfb:	89 53 10             	mov    %edx,0x10(%ebx)
+  803cfe:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  803d04:	89 53 14             	mov    %edx,0x14(%ebx)
+  803d07:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  803d0d:	89 53 18             	mov    %edx,0x18(%ebx)
+  803d10:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803d16:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803d19:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  803d1f:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803d22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d25:	c9                   	leave
+  803d26:	c3                   	ret
+
+00803d27 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803d27:	55                   	push   %ebp
+  803d28:	89 e5                	mov    %esp,%ebp
+  803d2a:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803d2d:	6a 03                	push   $0x3
+  803d2f:	e8 08 0f 00 00       	call   804c3c <ipc_find_env>
+  803d34:	a3 24 80 80 00       	mov    %eax,0x808024
+	nsipcbuf.shard.req_shard = shard;
+  803d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803d41:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803d46:	e8 08 f3 ff ff       	call   803053 <nsipc>
+  803d4b:	83 c4 10             	add    $0x10,%esp
+  803d4e:	85 c0                	test   %eax,%eax
+  803d50:	78 0a                	js     803d5c <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803d52:	a3 24 80 80 00       	mov    %eax,0x808024
+	return 0;
+  803d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d5c:	c9                   	leave
+  803d5d:	c3                   	ret
+
+00803d5e <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803d5e:	55                   	push   %ebp
+  803d5f:	89 e5                	mov    %esp,%ebp
+  803d61:	57                   	push   %edi
+  803d62:	56                   	push   %esi
+  803d63:	53                   	push   %ebx
+  803d64:	83 ec 1c             	sub    $0x1c,%esp
+  803d67:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803d6a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803d6d:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d77:	89 e0                	mov    %esp,%eax
+  803d79:	89 f2                	mov    %esi,%edx
+  803d7b:	29 c2                	sub    %eax,%edx
+  803d7d:	89 d0                	mov    %edx,%eax
+  803d7f:	c1 e8 0f             	shr    $0xf,%eax
+  803d82:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803d88:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803d8b:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  803d92:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803d95:	83 ec 0c             	sub    $0xc,%esp
+  803d98:	ff 75 e0             	push   -0x20(%ebp)
+  803d9b:	e8 db 0e 00 00       	call   804c7b <pageref>
+  803da0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803da3:	83 c4 04             	add    $0x4,%esp
+  803da6:	ff 75 dc             	push   -0x24(%ebp)
+  803da9:	e8 cd 0e 00 00       	call   804c7b <pageref>
+  803dae:	89 e2                	mov    %esp,%edx
+  803db0:	89 f1                	mov    %esi,%ecx
+  803db2:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803db4:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803db7:	89 ca                	mov    %ecx,%edx
+  803db9:	c1 ea 0f             	shr    $0xf,%edx
+  803dbc:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803dc2:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803dc5:	8b 14 95 40 80 80 00 	mov    0x808040(,%edx,4),%edx
+  803dcc:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803dcf:	39 d7                	cmp    %edx,%edi
+  803dd1:	74 40                	je     803e13 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803dd3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803dd6:	75 9f                	jne    803d77 <_pipeisclosed+0x19>
+  803dd8:	89 e2                	mov    %esp,%edx
+  803dda:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803ddf:	29 d0                	sub    %edx,%eax
+  803de1:	89 c2                	mov    %eax,%edx
+  803de3:	c1 ea 0f             	shr    $0xf,%edx
+  803de6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803deb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df0:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803df3:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  803dfa:	8b 40 58             	mov    0x58(%eax),%eax
+  803dfd:	6a 01                	push   $0x1
+  803dff:	50                   	push   %eax
+  803e00:	57                   	push   %edi
+  803e01:	68 3d 55 80 00       	push   $0x80553d
+  803e06:	e8 0d c5 ff ff       	call   800318 <cprintf>
+  803e0b:	83 c4 10             	add    $0x10,%esp
+  803e0e:	e9 5f ff ff ff       	jmp    803d72 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803e13:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803e16:	0f 94 c0             	sete   %al
+  803e19:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e1f:	5b                   	pop    %ebx
+  803e20:	5e                   	pop    %esi
+  803e21:	5f                   	pop    %edi
+  803e22:	5d                   	pop    %ebp
+  803e23:	c3                   	ret
+
+00803e24 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803e24:	55                   	push   %ebp
+  803e25:	89 e5                	mov    %esp,%ebp
+  803e27:	53                   	push   %ebx
+  803e28:	83 ec 0c             	sub    $0xc,%esp
+  803e2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803e2e:	53                   	push   %ebx
+  803e2f:	6a 00                	push   $0x0
+  803e31:	e8 92 d0 ff ff       	call   800ec8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803e36:	89 1c 24             	mov    %ebx,(%esp)
+  803e39:	e8 f4 db ff ff       	call   801a32 <fd2data>
+  803e3e:	83 c4 08             	add    $0x8,%esp
+  803e41:	50                   	push   %eax
+  803e42:	6a 00                	push   $0x0
+  803e44:	e8 7f d0 ff ff       	call   800ec8 <sys_page_unmap>
+}
+  803e49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e4c:	c9                   	leave
+  803e4d:	c3                   	ret
+
+00803e4e <devpipe_read>:
+{
+  803e4e:	55                   	push   %ebp
+  803e4f:	89 e5                	mov    %esp,%ebp
+  803e51:	57                   	push   %edi
+  803e52:	56                   	push   %esi
+  803e53:	53                   	push   %ebx
+  803e54:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803e57:	ff 75 08             	push   0x8(%ebp)
+  803e5a:	e8 d3 db ff ff       	call   801a32 <fd2data>
+  803e5f:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803e61:	8b 70 04             	mov    0x4(%eax),%esi
+  803e64:	8b 00                	mov    (%eax),%eax
+  803e66:	83 c4 10             	add    $0x10,%esp
+  803e69:	39 f0                	cmp    %esi,%eax
+  803e6b:	75 36                	jne    803ea3 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803e6d:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803e70:	89 da                	mov    %ebx,%edx
+  803e72:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e75:	e8 e4 fe ff ff       	call   803d5e <_pipeisclosed>
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	0f 85 d4 00 00 00    	jne    803f56 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803e82:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e87:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803e8b:	83 ec 04             	sub    $0x4,%esp
+  803e8e:	6a ff                	push   $0xffffffff
+  803e90:	56                   	push   %esi
+  803e91:	57                   	push   %edi
+  803e92:	e8 aa d3 ff ff       	call   801241 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803e97:	8b 73 04             	mov    0x4(%ebx),%esi
+  803e9a:	8b 03                	mov    (%ebx),%eax
+  803e9c:	83 c4 10             	add    $0x10,%esp
+  803e9f:	39 c6                	cmp    %eax,%esi
+  803ea1:	74 cd                	je     803e70 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ea3:	8b 73 04             	mov    0x4(%ebx),%esi
+  803ea6:	8b 03                	mov    (%ebx),%eax
+  803ea8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803eae:	29 c6                	sub    %eax,%esi
+  803eb0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803eb5:	f7 e6                	mul    %esi
+  803eb7:	c1 ea 0c             	shr    $0xc,%edx
+  803eba:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803ec0:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803ec2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803ec5:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803ec9:	8b 0b                	mov    (%ebx),%ecx
+  803ecb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803ed0:	f7 e1                	mul    %ecx
+  803ed2:	c1 ea 0b             	shr    $0xb,%edx
+  803ed5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803edb:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803edd:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803ee2:	29 cf                	sub    %ecx,%edi
+  803ee4:	39 f7                	cmp    %esi,%edi
+  803ee6:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803ee9:	83 ec 04             	sub    $0x4,%esp
+  803eec:	57                   	push   %edi
+  803eed:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803ef1:	50                   	push   %eax
+  803ef2:	ff 75 0c             	push   0xc(%ebp)
+  803ef5:	e8 c5 cc ff ff       	call   800bbf <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803efa:	83 c4 0c             	add    $0xc,%esp
+  803efd:	89 f0                	mov    %esi,%eax
+  803eff:	29 f8                	sub    %edi,%eax
+  803f01:	50                   	push   %eax
+  803f02:	8d 43 10             	lea    0x10(%ebx),%eax
+  803f05:	50                   	push   %eax
+  803f06:	89 f8                	mov    %edi,%eax
+  803f08:	03 45 0c             	add    0xc(%ebp),%eax
+  803f0b:	50                   	push   %eax
+  803f0c:	e8 ae cc ff ff       	call   800bbf <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803f11:	8b 0b                	mov    (%ebx),%ecx
+  803f13:	01 f1                	add    %esi,%ecx
+  803f15:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803f1a:	f7 e1                	mul    %ecx
+  803f1c:	c1 ea 0c             	shr    $0xc,%edx
+  803f1f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803f25:	29 c1                	sub    %eax,%ecx
+  803f27:	89 0b                	mov    %ecx,(%ebx)
+  803f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2e:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803f32:	83 c4 10             	add    $0x10,%esp
+  803f35:	85 c0                	test   %eax,%eax
+  803f37:	75 0a                	jne    803f43 <devpipe_read+0xf5>
+	return n;
+  803f39:	89 f0                	mov    %esi,%eax
+}
+  803f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f3e:	5b                   	pop    %ebx
+  803f3f:	5e                   	pop    %esi
+  803f40:	5f                   	pop    %edi
+  803f41:	5d                   	pop    %ebp
+  803f42:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803f43:	83 ec 08             	sub    $0x8,%esp
+  803f46:	68 00 04 00 00       	push   $0x400
+  803f4b:	53                   	push   %ebx
+  803f4c:	e8 12 d3 ff ff       	call   801263 <sys_futex_wake>
+  803f51:	83 c4 10             	add    $0x10,%esp
+  803f54:	eb e3                	jmp    803f39 <devpipe_read+0xeb>
+			return 0;
+  803f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5b:	eb de                	jmp    803f3b <devpipe_read+0xed>
+
+00803f5d <devpipe_write>:
+{
+  803f5d:	55                   	push   %ebp
+  803f5e:	89 e5                	mov    %esp,%ebp
+  803f60:	57                   	push   %edi
+  803f61:	56                   	push   %esi
+  803f62:	53                   	push   %ebx
+  803f63:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803f66:	ff 75 08             	push   0x8(%ebp)
+  803f69:	e8 c4 da ff ff       	call   801a32 <fd2data>
+  803f6e:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803f70:	83 c4 10             	add    $0x10,%esp
+  803f73:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f7a:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803f7f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803f83:	0f 84 43 01 00 00    	je     8040cc <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f89:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803f8c:	8b 06                	mov    (%esi),%eax
+  803f8e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803f94:	29 c1                	sub    %eax,%ecx
+  803f96:	89 c8                	mov    %ecx,%eax
+  803f98:	f7 e7                	mul    %edi
+  803f9a:	c1 ea 0c             	shr    $0xc,%edx
+  803f9d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803fa3:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803fa5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803fab:	75 52                	jne    803fff <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803fad:	89 f2                	mov    %esi,%edx
+  803faf:	8b 45 08             	mov    0x8(%ebp),%eax
+  803fb2:	e8 a7 fd ff ff       	call   803d5e <_pipeisclosed>
+  803fb7:	85 c0                	test   %eax,%eax
+  803fb9:	0f 85 28 01 00 00    	jne    8040e7 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803fbf:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803fc1:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803fc4:	8b 06                	mov    (%esi),%eax
+  803fc6:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803fcc:	29 c1                	sub    %eax,%ecx
+  803fce:	89 c8                	mov    %ecx,%eax
+  803fd0:	f7 e7                	mul    %edi
+  803fd2:	c1 ea 0c             	shr    $0xc,%edx
+  803fd5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803fdb:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803fdd:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803fe3:	75 a4                	jne    803f89 <devpipe_write+0x2c>
+  803fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+  803fea:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803fee:	83 ec 04             	sub    $0x4,%esp
+  803ff1:	6a ff                	push   $0xffffffff
+  803ff3:	53                   	push   %ebx
+  803ff4:	56                   	push   %esi
+  803ff5:	e8 47 d2 ff ff       	call   801241 <sys_futex_wait>
+}
+  803ffa:	83 c4 10             	add    $0x10,%esp
+  803ffd:	eb 8a                	jmp    803f89 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803fff:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804002:	8b 06                	mov    (%esi),%eax
+  804004:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80400a:	29 c1                	sub    %eax,%ecx
+  80400c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804011:	f7 e1                	mul    %ecx
+  804013:	c1 ea 0c             	shr    $0xc,%edx
+  804016:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80401c:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80401e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  804023:	89 d8                	mov    %ebx,%eax
+  804025:	29 c8                	sub    %ecx,%eax
+  804027:	8b 55 10             	mov    0x10(%ebp),%edx
+  80402a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80402d:	29 ca                	sub    %ecx,%edx
+  80402f:	39 d0                	cmp    %edx,%eax
+  804031:	0f 46 d0             	cmovbe %eax,%edx
+  804034:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  804037:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80403a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80403f:	f7 e1                	mul    %ecx
+  804041:	c1 ea 0b             	shr    $0xb,%edx
+  804044:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80404a:	89 ca                	mov    %ecx,%edx
+  80404c:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80404e:	29 d3                	sub    %edx,%ebx
+  804050:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804053:	39 c3                	cmp    %eax,%ebx
+  804055:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  804058:	83 ec 04             	sub    $0x4,%esp
+  80405b:	53                   	push   %ebx
+  80405c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80405f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  804062:	51                   	push   %ecx
+  804063:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  804067:	50                   	push   %eax
+  804068:	e8 52 cb ff ff       	call   800bbf <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80406d:	83 c4 0c             	add    $0xc,%esp
+  804070:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804073:	29 d8                	sub    %ebx,%eax
+  804075:	50                   	push   %eax
+  804076:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804079:	01 cb                	add    %ecx,%ebx
+  80407b:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80407e:	53                   	push   %ebx
+  80407f:	8d 46 10             	lea    0x10(%esi),%eax
+  804082:	50                   	push   %eax
+  804083:	e8 37 cb ff ff       	call   800bbf <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  804088:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80408b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80408e:	01 c1                	add    %eax,%ecx
+  804090:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804095:	f7 e1                	mul    %ecx
+  804097:	c1 ea 0c             	shr    $0xc,%edx
+  80409a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8040a0:	89 ca                	mov    %ecx,%edx
+  8040a2:	29 c2                	sub    %eax,%edx
+  8040a4:	89 56 04             	mov    %edx,0x4(%esi)
+  8040a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ac:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  8040b0:	83 c4 10             	add    $0x10,%esp
+  8040b3:	85 c0                	test   %eax,%eax
+  8040b5:	75 1a                	jne    8040d1 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8040b7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8040ba:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8040bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8040c0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8040c3:	0f 82 c0 fe ff ff    	jb     803f89 <devpipe_write+0x2c>
+  8040c9:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8040cc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8040cf:	eb 1b                	jmp    8040ec <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8040d1:	83 ec 08             	sub    $0x8,%esp
+  8040d4:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8040d9:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8040dc:	50                   	push   %eax
+  8040dd:	e8 81 d1 ff ff       	call   801263 <sys_futex_wake>
+  8040e2:	83 c4 10             	add    $0x10,%esp
+  8040e5:	eb d0                	jmp    8040b7 <devpipe_write+0x15a>
+				return 0;
+  8040e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040ef:	5b                   	pop    %ebx
+  8040f0:	5e                   	pop    %esi
+  8040f1:	5f                   	pop    %edi
+  8040f2:	5d                   	pop    %ebp
+  8040f3:	c3                   	ret
+
+008040f4 <devpipe_stat>:
+{
+  8040f4:	55                   	push   %ebp
+  8040f5:	89 e5                	mov    %esp,%ebp
+  8040f7:	56                   	push   %esi
+  8040f8:	53                   	push   %ebx
+  8040f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8040fc:	83 ec 0c             	sub    $0xc,%esp
+  8040ff:	ff 75 08             	push   0x8(%ebp)
+  804102:	e8 2b d9 ff ff       	call   801a32 <fd2data>
+  804107:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804109:	83 c4 08             	add    $0x8,%esp
+  80410c:	68 50 55 80 00       	push   $0x805550
+  804111:	53                   	push   %ebx
+  804112:	e8 f8 c8 ff ff       	call   800a0f <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804117:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80411a:	8b 06                	mov    (%esi),%eax
+  80411c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804122:	29 c1                	sub    %eax,%ecx
+  804124:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804129:	89 c8                	mov    %ecx,%eax
+  80412b:	f7 e2                	mul    %edx
+  80412d:	c1 ea 0c             	shr    $0xc,%edx
+  804130:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804136:	29 d1                	sub    %edx,%ecx
+  804138:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  80413e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  804145:	00 00 00 
+	stat->st_dev = &devpipe;
+  804148:	c7 83 8c 00 00 00 60 	movl   $0x806060,0x8c(%ebx)
+  80414f:	60 80 00 
+}
+  804152:	b8 00 00 00 00       	mov    $0x0,%eax
+  804157:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80415a:	5b                   	pop    %ebx
+  80415b:	5e                   	pop    %esi
+  80415c:	5d                   	pop    %ebp
+  80415d:	c3                   	ret
+
+0080415e <devpipe_poll>:
+{
+  80415e:	55                   	push   %ebp
+  80415f:	89 e5                	mov    %esp,%ebp
+  804161:	57                   	push   %edi
+  804162:	56                   	push   %esi
+  804163:	53                   	push   %ebx
+  804164:	83 ec 18             	sub    $0x18,%esp
+  804167:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80416a:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80416d:	57                   	push   %edi
+  80416e:	e8 bf d8 ff ff       	call   801a32 <fd2data>
+  804173:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  804175:	83 c4 10             	add    $0x10,%esp
+  804178:	89 f3                	mov    %esi,%ebx
+  80417a:	83 e3 01             	and    $0x1,%ebx
+  80417d:	75 27                	jne    8041a6 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  80417f:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  804185:	75 48                	jne    8041cf <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  804187:	89 ca                	mov    %ecx,%edx
+  804189:	89 f8                	mov    %edi,%eax
+  80418b:	e8 ce fb ff ff       	call   803d5e <_pipeisclosed>
+  804190:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  804192:	89 d8                	mov    %ebx,%eax
+  804194:	83 c8 10             	or     $0x10,%eax
+  804197:	85 d2                	test   %edx,%edx
+  804199:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80419c:	89 d8                	mov    %ebx,%eax
+  80419e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041a1:	5b                   	pop    %ebx
+  8041a2:	5e                   	pop    %esi
+  8041a3:	5f                   	pop    %edi
+  8041a4:	5d                   	pop    %ebp
+  8041a5:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8041a6:	8b 58 04             	mov    0x4(%eax),%ebx
+  8041a9:	8b 00                	mov    (%eax),%eax
+  8041ab:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  8041b1:	29 c3                	sub    %eax,%ebx
+  8041b3:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8041b8:	89 d8                	mov    %ebx,%eax
+  8041ba:	f7 e2                	mul    %edx
+  8041bc:	c1 ea 0c             	shr    $0xc,%edx
+  8041bf:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8041c5:	39 d3                	cmp    %edx,%ebx
+  8041c7:	0f 95 c3             	setne  %bl
+  8041ca:	0f b6 db             	movzbl %bl,%ebx
+  8041cd:	eb b0                	jmp    80417f <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8041cf:	8b 71 04             	mov    0x4(%ecx),%esi
+  8041d2:	8b 01                	mov    (%ecx),%eax
+  8041d4:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8041da:	29 c6                	sub    %eax,%esi
+  8041dc:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8041e1:	89 f0                	mov    %esi,%eax
+  8041e3:	f7 e2                	mul    %edx
+  8041e5:	c1 ea 0c             	shr    $0xc,%edx
+  8041e8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8041ee:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8041f0:	89 d8                	mov    %ebx,%eax
+  8041f2:	83 c8 04             	or     $0x4,%eax
+  8041f5:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8041fb:	0f 42 d8             	cmovb  %eax,%ebx
+  8041fe:	eb 87                	jmp    804187 <devpipe_poll+0x29>
+
+00804200 <pipe>:
+{
+  804200:	55                   	push   %ebp
+  804201:	89 e5                	mov    %esp,%ebp
+  804203:	56                   	push   %esi
+  804204:	53                   	push   %ebx
+  804205:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804208:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80420b:	50                   	push   %eax
+  80420c:	e8 38 d8 ff ff       	call   801a49 <fd_alloc>
+  804211:	89 c3                	mov    %eax,%ebx
+  804213:	83 c4 10             	add    $0x10,%esp
+  804216:	85 c0                	test   %eax,%eax
+  804218:	0f 88 23 01 00 00    	js     804341 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80421e:	83 ec 04             	sub    $0x4,%esp
+  804221:	68 07 04 00 00       	push   $0x407
+  804226:	ff 75 f4             	push   -0xc(%ebp)
+  804229:	6a 00                	push   $0x0
+  80422b:	e8 13 cc ff ff       	call   800e43 <sys_page_alloc>
+  804230:	89 c3                	mov    %eax,%ebx
+  804232:	83 c4 10             	add    $0x10,%esp
+  804235:	85 c0                	test   %eax,%eax
+  804237:	0f 88 04 01 00 00    	js     804341 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80423d:	83 ec 0c             	sub    $0xc,%esp
+  804240:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  804243:	50                   	push   %eax
+  804244:	e8 00 d8 ff ff       	call   801a49 <fd_alloc>
+  804249:	89 c3                	mov    %eax,%ebx
+  80424b:	83 c4 10             	add    $0x10,%esp
+  80424e:	85 c0                	test   %eax,%eax
+  804250:	0f 88 db 00 00 00    	js     804331 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804256:	83 ec 04             	sub    $0x4,%esp
+  804259:	68 07 04 00 00       	push   $0x407
+  80425e:	ff 75 f0             	push   -0x10(%ebp)
+  804261:	6a 00                	push   $0x0
+  804263:	e8 db cb ff ff       	call   800e43 <sys_page_alloc>
+  804268:	89 c3                	mov    %eax,%ebx
+  80426a:	83 c4 10             	add    $0x10,%esp
+  80426d:	85 c0                	test   %eax,%eax
+  80426f:	0f 88 bc 00 00 00    	js     804331 <pipe+0x131>
+	va = fd2data(fd0);
+  804275:	83 ec 0c             	sub    $0xc,%esp
+  804278:	ff 75 f4             	push   -0xc(%ebp)
+  80427b:	e8 b2 d7 ff ff       	call   801a32 <fd2data>
+  804280:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804282:	83 c4 0c             	add    $0xc,%esp
+  804285:	68 07 04 00 00       	push   $0x407
+  80428a:	50                   	push   %eax
+  80428b:	6a 00                	push   $0x0
+  80428d:	e8 b1 cb ff ff       	call   800e43 <sys_page_alloc>
+  804292:	89 c3                	mov    %eax,%ebx
+  804294:	83 c4 10             	add    $0x10,%esp
+  804297:	85 c0                	test   %eax,%eax
+  804299:	0f 88 82 00 00 00    	js     804321 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80429f:	83 ec 0c             	sub    $0xc,%esp
+  8042a2:	ff 75 f0             	push   -0x10(%ebp)
+  8042a5:	e8 88 d7 ff ff       	call   801a32 <fd2data>
+  8042aa:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8042b1:	50                   	push   %eax
+  8042b2:	6a 00                	push   $0x0
+  8042b4:	56                   	push   %esi
+  8042b5:	6a 00                	push   $0x0
+  8042b7:	e8 ca cb ff ff       	call   800e86 <sys_page_map>
+  8042bc:	89 c3                	mov    %eax,%ebx
+  8042be:	83 c4 20             	add    $0x20,%esp
+  8042c1:	85 c0                	test   %eax,%eax
+  8042c3:	78 4e                	js     804313 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8042c5:	a1 60 60 80 00       	mov    0x806060,%eax
+  8042ca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8042cd:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8042cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8042d2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8042d9:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8042dc:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8042de:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8042e1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8042e8:	83 ec 0c             	sub    $0xc,%esp
+  8042eb:	ff 75 f4             	push   -0xc(%ebp)
+  8042ee:	e8 2f d7 ff ff       	call   801a22 <fd2num>
+  8042f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8042f6:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8042f8:	83 c4 04             	add    $0x4,%esp
+  8042fb:	ff 75 f0             	push   -0x10(%ebp)
+  8042fe:	e8 1f d7 ff ff       	call   801a22 <fd2num>
+  804303:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804306:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804309:	83 c4 10             	add    $0x10,%esp
+  80430c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804311:	eb 2e                	jmp    804341 <pipe+0x141>
+	sys_page_unmap(0, va);
+  804313:	83 ec 08             	sub    $0x8,%esp
+  804316:	56                   	push   %esi
+  804317:	6a 00                	push   $0x0
+  804319:	e8 aa cb ff ff       	call   800ec8 <sys_page_unmap>
+  80431e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  804321:	83 ec 08             	sub    $0x8,%esp
+  804324:	ff 75 f0             	push   -0x10(%ebp)
+  804327:	6a 00                	push   $0x0
+  804329:	e8 9a cb ff ff       	call   800ec8 <sys_page_unmap>
+  80432e:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  804331:	83 ec 08             	sub    $0x8,%esp
+  804334:	ff 75 f4             	push   -0xc(%ebp)
+  804337:	6a 00                	push   $0x0
+  804339:	e8 8a cb ff ff       	call   800ec8 <sys_page_unmap>
+  80433e:	83 c4 10             	add    $0x10,%esp
+}
+  804341:	89 d8                	mov    %ebx,%eax
+  804343:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804346:	5b                   	pop    %ebx
+  804347:	5e                   	pop    %esi
+  804348:	5d                   	pop    %ebp
+  804349:	c3                   	ret
+
+0080434a <pipeisclosed>:
+{
+  80434a:	55                   	push   %ebp
+  80434b:	89 e5                	mov    %esp,%ebp
+  80434d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804350:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804353:	50                   	push   %eax
+  804354:	ff 75 08             	push   0x8(%ebp)
+  804357:	e8 3d d7 ff ff       	call   801a99 <fd_lookup>
+  80435c:	83 c4 10             	add    $0x10,%esp
+  80435f:	85 c0                	test   %eax,%eax
+  804361:	78 18                	js     80437b <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  804363:	83 ec 0c             	sub    $0xc,%esp
+  804366:	ff 75 f4             	push   -0xc(%ebp)
+  804369:	e8 c4 d6 ff ff       	call   801a32 <fd2data>
+  80436e:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  804370:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804373:	e8 e6 f9 ff ff       	call   803d5e <_pipeisclosed>
+  804378:	83 c4 10             	add    $0x10,%esp
+}
+  80437b:	c9                   	leave
+  80437c:	c3                   	ret
+
+0080437d <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80437d:	55                   	push   %ebp
+  80437e:	89 e5                	mov    %esp,%ebp
+  804380:	56                   	push   %esi
+  804381:	53                   	push   %ebx
+  804382:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  804385:	85 f6                	test   %esi,%esi
+  804387:	74 40                	je     8043c9 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  804389:	89 f3                	mov    %esi,%ebx
+  80438b:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804391:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  804397:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80439c:	8b 40 48             	mov    0x48(%eax),%eax
+  80439f:	39 c6                	cmp    %eax,%esi
+  8043a1:	75 1f                	jne    8043c2 <wait+0x45>
+  8043a3:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  8043a9:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8043af:	8b 43 54             	mov    0x54(%ebx),%eax
+  8043b2:	85 c0                	test   %eax,%eax
+  8043b4:	74 0c                	je     8043c2 <wait+0x45>
+		sys_yield();
+  8043b6:	e8 69 ca ff ff       	call   800e24 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8043bb:	8b 43 48             	mov    0x48(%ebx),%eax
+  8043be:	39 f0                	cmp    %esi,%eax
+  8043c0:	74 ed                	je     8043af <wait+0x32>
+}
+  8043c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8043c5:	5b                   	pop    %ebx
+  8043c6:	5e                   	pop    %esi
+  8043c7:	5d                   	pop    %ebp
+  8043c8:	c3                   	ret
+	assert(envid != 0);
+  8043c9:	68 5c 55 80 00       	push   $0x80555c
+  8043ce:	68 66 54 80 00       	push   $0x805466
+  8043d3:	6a 09                	push   $0x9
+  8043d5:	68 67 55 80 00       	push   $0x805567
+  8043da:	e8 5e be ff ff       	call   80023d <_panic>
+
+008043df <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  8043df:	55                   	push   %ebp
+  8043e0:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  8043e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043e5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8043eb:	5d                   	pop    %ebp
+  8043ec:	c3                   	ret
+
+008043ed <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  8043ed:	55                   	push   %ebp
+  8043ee:	89 e5                	mov    %esp,%ebp
+  8043f0:	53                   	push   %ebx
+  8043f1:	83 ec 04             	sub    $0x4,%esp
+  8043f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  8043f7:	8b 03                	mov    (%ebx),%eax
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	75 05                	jne    804402 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  8043fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804400:	c9                   	leave
+  804401:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  804402:	83 ec 08             	sub    $0x8,%esp
+  804405:	50                   	push   %eax
+  804406:	8d 43 04             	lea    0x4(%ebx),%eax
+  804409:	50                   	push   %eax
+  80440a:	e8 09 cd ff ff       	call   801118 <sys_page_batch>
+	pb->pb_n = 0;
+  80440f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  804415:	83 c4 10             	add    $0x10,%esp
+  804418:	eb e3                	jmp    8043fd <pgbatch_flush+0x10>
+
+0080441a <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80441a:	55                   	push   %ebp
+  80441b:	89 e5                	mov    %esp,%ebp
+  80441d:	56                   	push   %esi
+  80441e:	53                   	push   %ebx
+  80441f:	89 c3                	mov    %eax,%ebx
+  804421:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  804423:	83 38 20             	cmpl   $0x20,(%eax)
+  804426:	74 2c                	je     804454 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  804428:	8b 03                	mov    (%ebx),%eax
+  80442a:	8d 50 01             	lea    0x1(%eax),%edx
+  80442d:	89 13                	mov    %edx,(%ebx)
+  80442f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  804432:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  804436:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  804438:	83 ec 04             	sub    $0x4,%esp
+  80443b:	6a 18                	push   $0x18
+  80443d:	6a 00                	push   $0x0
+  80443f:	50                   	push   %eax
+  804440:	e8 45 c7 ff ff       	call   800b8a <memset>
+	return 0;
+  804445:	83 c4 10             	add    $0x10,%esp
+  804448:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80444d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804450:	5b                   	pop    %ebx
+  804451:	5e                   	pop    %esi
+  804452:	5d                   	pop    %ebp
+  804453:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  804454:	83 ec 0c             	sub    $0xc,%esp
+  804457:	50                   	push   %eax
+  804458:	e8 90 ff ff ff       	call   8043ed <pgbatch_flush>
+  80445d:	83 c4 10             	add    $0x10,%esp
+  804460:	85 c0                	test   %eax,%eax
+  804462:	79 c4                	jns    804428 <pgbatch_slot+0xe>
+  804464:	eb e7                	jmp    80444d <pgbatch_slot+0x33>
+
+00804466 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  804466:	55                   	push   %ebp
+  804467:	89 e5                	mov    %esp,%ebp
+  804469:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80446c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80446f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804472:	e8 a3 ff ff ff       	call   80441a <pgbatch_slot>
+  804477:	85 c0                	test   %eax,%eax
+  804479:	78 20                	js     80449b <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  80447b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80447e:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  804484:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804487:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80448a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80448d:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804490:	8b 55 14             	mov    0x14(%ebp),%edx
+  804493:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804496:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+
+0080449d <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80449d:	55                   	push   %ebp
+  80449e:	89 e5                	mov    %esp,%ebp
+  8044a0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8044a3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8044a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044a9:	e8 6c ff ff ff       	call   80441a <pgbatch_slot>
+  8044ae:	85 c0                	test   %eax,%eax
+  8044b0:	78 2c                	js     8044de <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8044b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044b5:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8044bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8044be:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8044c1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8044c4:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8044c7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8044ca:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  8044cd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8044d0:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8044d3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8044d6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8044d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044de:	c9                   	leave
+  8044df:	c3                   	ret
+
+008044e0 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  8044e0:	55                   	push   %ebp
+  8044e1:	89 e5                	mov    %esp,%ebp
+  8044e3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8044e6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8044e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8044ec:	e8 29 ff ff ff       	call   80441a <pgbatch_slot>
+  8044f1:	85 c0                	test   %eax,%eax
+  8044f3:	78 1a                	js     80450f <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  8044f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8044f8:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  8044fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804501:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804504:	8b 55 10             	mov    0x10(%ebp),%edx
+  804507:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80450a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80450f:	c9                   	leave
+  804510:	c3                   	ret
+
+00804511 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  804511:	55                   	push   %ebp
+  804512:	89 e5                	mov    %esp,%ebp
+  804514:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804517:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80451a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80451d:	e8 f8 fe ff ff       	call   80441a <pgbatch_slot>
+  804522:	85 c0                	test   %eax,%eax
+  804524:	78 20                	js     804546 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  804526:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804529:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  80452f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804532:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804535:	8b 55 10             	mov    0x10(%ebp),%edx
+  804538:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80453b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80453e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804541:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804546:	c9                   	leave
+  804547:	c3                   	ret
+
+00804548 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804548:	55                   	push   %ebp
+  804549:	89 e5                	mov    %esp,%ebp
+  80454b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80454e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804551:	8b 45 08             	mov    0x8(%ebp),%eax
+  804554:	e8 c1 fe ff ff       	call   80441a <pgbatch_slot>
+  804559:	85 c0                	test   %eax,%eax
+  80455b:	78 26                	js     804583 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80455d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804560:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  804566:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804569:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  80456c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80456f:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804572:	8b 55 14             	mov    0x14(%ebp),%edx
+  804575:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804578:	8b 55 18             	mov    0x18(%ebp),%edx
+  80457b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80457e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804583:	c9                   	leave
+  804584:	c3                   	ret
+
+00804585 <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  804585:	55                   	push   %ebp
+  804586:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804588:	8b 45 08             	mov    0x8(%ebp),%eax
+  80458b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804591:	5d                   	pop    %ebp
+  804592:	c3                   	ret
+
+00804593 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  804593:	55                   	push   %ebp
+  804594:	89 e5                	mov    %esp,%ebp
+  804596:	56                   	push   %esi
+  804597:	53                   	push   %ebx
+  804598:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  80459b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045a5:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8045a9:	85 c0                	test   %eax,%eax
+  8045ab:	74 2f                	je     8045dc <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  8045ad:	83 f8 02             	cmp    $0x2,%eax
+  8045b0:	74 0c                	je     8045be <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  8045b2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8045b7:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8045ba:	85 c0                	test   %eax,%eax
+  8045bc:	74 1e                	je     8045dc <mutex_lock+0x49>
+  8045be:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8045c3:	83 ec 04             	sub    $0x4,%esp
+  8045c6:	6a ff                	push   $0xffffffff
+  8045c8:	6a 02                	push   $0x2
+  8045ca:	53                   	push   %ebx
+  8045cb:	e8 71 cc ff ff       	call   801241 <sys_futex_wait>
+  8045d0:	89 f0                	mov    %esi,%eax
+  8045d2:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  8045d5:	83 c4 10             	add    $0x10,%esp
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	75 e7                	jne    8045c3 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  8045dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8045df:	5b                   	pop    %ebx
+  8045e0:	5e                   	pop    %esi
+  8045e1:	5d                   	pop    %ebp
+  8045e2:	c3                   	ret
+
+008045e3 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  8045e3:	55                   	push   %ebp
+  8045e4:	89 e5                	mov    %esp,%ebp
+  8045e6:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8045e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8045f3:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  8045f7:	85 c0                	test   %eax,%eax
+  8045f9:	0f 94 c0             	sete   %al
+  8045fc:	0f b6 c0             	movzbl %al,%eax
+}
+  8045ff:	5d                   	pop    %ebp
+  804600:	c3                   	ret
+
+00804601 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804601:	55                   	push   %ebp
+  804602:	89 e5                	mov    %esp,%ebp
+  804604:	83 ec 08             	sub    $0x8,%esp
+  804607:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  80460a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460f:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  804612:	83 f8 02             	cmp    $0x2,%eax
+  804615:	74 02                	je     804619 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804617:	c9                   	leave
+  804618:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804619:	83 ec 08             	sub    $0x8,%esp
+  80461c:	6a 01                	push   $0x1
+  80461e:	52                   	push   %edx
+  80461f:	e8 3f cc ff ff       	call   801263 <sys_futex_wake>
+  804624:	83 c4 10             	add    $0x10,%esp
+}
+  804627:	eb ee                	jmp    804617 <mutex_unlock+0x16>
+
+00804629 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804629:	55                   	push   %ebp
+  80462a:	89 e5                	mov    %esp,%ebp
+  80462c:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  80462f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  804635:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  80463c:	5d                   	pop    %ebp
+  80463d:	c3                   	ret
+
+0080463e <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  80463e:	55                   	push   %ebp
+  80463f:	89 e5                	mov    %esp,%ebp
+  804641:	57                   	push   %edi
+  804642:	56                   	push   %esi
+  804643:	53                   	push   %ebx
+  804644:	83 ec 18             	sub    $0x18,%esp
+  804647:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80464a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  80464d:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  80464f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804654:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804659:	57                   	push   %edi
+  80465a:	e8 a2 ff ff ff       	call   804601 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  80465f:	83 c4 0c             	add    $0xc,%esp
+  804662:	ff 75 10             	push   0x10(%ebp)
+  804665:	56                   	push   %esi
+  804666:	53                   	push   %ebx
+  804667:	e8 d5 cb ff ff       	call   801241 <sys_futex_wait>
+  80466c:	89 c6                	mov    %eax,%esi
+  80466e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804673:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804678:	89 3c 24             	mov    %edi,(%esp)
+  80467b:	e8 13 ff ff ff       	call   804593 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804680:	83 c4 10             	add    $0x10,%esp
+  804683:	83 fe ef             	cmp    $0xffffffef,%esi
+  804686:	74 05                	je     80468d <cond_timedwait+0x4f>
+  804688:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80468d:	89 f0                	mov    %esi,%eax
+  80468f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804692:	5b                   	pop    %ebx
+  804693:	5e                   	pop    %esi
+  804694:	5f                   	pop    %edi
+  804695:	5d                   	pop    %ebp
+  804696:	c3                   	ret
+
+00804697 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804697:	55                   	push   %ebp
+  804698:	89 e5                	mov    %esp,%ebp
+  80469a:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  80469d:	6a ff                	push   $0xffffffff
+  80469f:	ff 75 0c             	push   0xc(%ebp)
+  8046a2:	ff 75 08             	push   0x8(%ebp)
+  8046a5:	e8 94 ff ff ff       	call   80463e <cond_timedwait>
+}
+  8046aa:	83 c4 10             	add    $0x10,%esp
+  8046ad:	c9                   	leave
+  8046ae:	c3                   	ret
+
+008046af <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8046af:	55                   	push   %ebp
+  8046b0:	89 e5                	mov    %esp,%ebp
+  8046b2:	83 ec 08             	sub    $0x8,%esp
+  8046b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046bd:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8046c1:	8b 50 04             	mov    0x4(%eax),%edx
+  8046c4:	85 d2                	test   %edx,%edx
+  8046c6:	75 02                	jne    8046ca <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  8046c8:	c9                   	leave
+  8046c9:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  8046ca:	83 ec 08             	sub    $0x8,%esp
+  8046cd:	6a 01                	push   $0x1
+  8046cf:	50                   	push   %eax
+  8046d0:	e8 8e cb ff ff       	call   801263 <sys_futex_wake>
+  8046d5:	83 c4 10             	add    $0x10,%esp
+}
+  8046d8:	eb ee                	jmp    8046c8 <cond_signal+0x19>
+
+008046da <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  8046da:	55                   	push   %ebp
+  8046db:	89 e5                	mov    %esp,%ebp
+  8046dd:	83 ec 08             	sub    $0x8,%esp
+  8046e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8046e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8046e8:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8046ec:	8b 50 04             	mov    0x4(%eax),%edx
+  8046ef:	85 d2                	test   %edx,%edx
+  8046f1:	75 02                	jne    8046f5 <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  8046f3:	c9                   	leave
+  8046f4:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  8046f5:	83 ec 08             	sub    $0x8,%esp
+  8046f8:	68 00 04 00 00       	push   $0x400
+  8046fd:	50                   	push   %eax
+  8046fe:	e8 60 cb ff ff       	call   801263 <sys_futex_wake>
+  804703:	83 c4 10             	add    $0x10,%esp
+}
+  804706:	eb eb                	jmp    8046f3 <cond_broadcast+0x19>
+
+00804708 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804708:	b8 00 00 00 00       	mov    $0x0,%eax
+  80470d:	c3                   	ret
+
+0080470e <devcons_poll>:
+{
+  80470e:	55                   	push   %ebp
+  80470f:	89 e5                	mov    %esp,%ebp
+  804711:	53                   	push   %ebx
+  804712:	83 ec 04             	sub    $0x4,%esp
+  804715:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804718:	89 da                	mov    %ebx,%edx
+  80471a:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80471d:	83 3d 34 80 80 00 00 	cmpl   $0x0,0x808034
+  804724:	74 0c                	je     804732 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804726:	89 d8                	mov    %ebx,%eax
+  804728:	83 e0 01             	and    $0x1,%eax
+  80472b:	09 d0                	or     %edx,%eax
+}
+  80472d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804730:	c9                   	leave
+  804731:	c3                   	ret
+		cons_peek = sys_cgetc();
+  804732:	e8 6e c6 ff ff       	call   800da5 <sys_cgetc>
+  804737:	a3 34 80 80 00       	mov    %eax,0x808034
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80473c:	89 da                	mov    %ebx,%edx
+  80473e:	83 e2 04             	and    $0x4,%edx
+  804741:	85 c0                	test   %eax,%eax
+  804743:	74 e6                	je     80472b <devcons_poll+0x1d>
+  804745:	eb df                	jmp    804726 <devcons_poll+0x18>
+
+00804747 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804747:	55                   	push   %ebp
+  804748:	89 e5                	mov    %esp,%ebp
+  80474a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80474d:	68 72 55 80 00       	push   $0x805572
+  804752:	ff 75 0c             	push   0xc(%ebp)
+  804755:	e8 b5 c2 ff ff       	call   800a0f <strcpy>
+	return 0;
+}
+  80475a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80475f:	c9                   	leave
+  804760:	c3                   	ret
+
+00804761 <devcons_write>:
+{
+  804761:	55                   	push   %ebp
+  804762:	89 e5                	mov    %esp,%ebp
+  804764:	57                   	push   %edi
+  804765:	56                   	push   %esi
+  804766:	53                   	push   %ebx
+  804767:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80476d:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804770:	85 ff                	test   %edi,%edi
+  804772:	74 51                	je     8047c5 <devcons_write+0x64>
+  804774:	be 00 00 00 00       	mov    $0x0,%esi
+  804779:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80477e:	89 fb                	mov    %edi,%ebx
+  804780:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  804782:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  804787:	39 d3                	cmp    %edx,%ebx
+  804789:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80478c:	83 ec 04             	sub    $0x4,%esp
+  80478f:	53                   	push   %ebx
+  804790:	03 45 0c             	add    0xc(%ebp),%eax
+  804793:	50                   	push   %eax
+  804794:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80479a:	50                   	push   %eax
+  80479b:	e8 1f c4 ff ff       	call   800bbf <memmove>
+		sys_cputs(buf, m);
+  8047a0:	83 c4 08             	add    $0x8,%esp
+  8047a3:	53                   	push   %ebx
+  8047a4:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8047aa:	50                   	push   %eax
+  8047ab:	e8 d7 c5 ff ff       	call   800d87 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8047b0:	01 de                	add    %ebx,%esi
+  8047b2:	89 f0                	mov    %esi,%eax
+  8047b4:	83 c4 10             	add    $0x10,%esp
+  8047b7:	39 fe                	cmp    %edi,%esi
+  8047b9:	72 c3                	jb     80477e <devcons_write+0x1d>
+}
+  8047bb:	89 f0                	mov    %esi,%eax
+  8047bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047c0:	5b                   	pop    %ebx
+  8047c1:	5e                   	pop    %esi
+  8047c2:	5f                   	pop    %edi
+  8047c3:	5d                   	pop    %ebp
+  8047c4:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8047c5:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8047ca:	eb ef                	jmp    8047bb <devcons_write+0x5a>
+
+008047cc <devcons_read>:
+{
+  8047cc:	55                   	push   %ebp
+  8047cd:	89 e5                	mov    %esp,%ebp
+  8047cf:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8047d2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8047d7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8047db:	74 36                	je     804813 <devcons_read+0x47>
+	c = cons_peek;
+  8047dd:	a1 34 80 80 00       	mov    0x808034,%eax
+	cons_peek = 0;
+  8047e2:	c7 05 34 80 80 00 00 	movl   $0x0,0x808034
+  8047e9:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8047ec:	85 c0                	test   %eax,%eax
+  8047ee:	75 10                	jne    804800 <devcons_read+0x34>
+  8047f0:	e8 b0 c5 ff ff       	call   800da5 <sys_cgetc>
+  8047f5:	85 c0                	test   %eax,%eax
+  8047f7:	75 07                	jne    804800 <devcons_read+0x34>
+		sys_yield();
+  8047f9:	e8 26 c6 ff ff       	call   800e24 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8047fe:	eb f0                	jmp    8047f0 <devcons_read+0x24>
+	if (c < 0)
+  804800:	85 c0                	test   %eax,%eax
+  804802:	78 0f                	js     804813 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804804:	83 f8 04             	cmp    $0x4,%eax
+  804807:	74 0c                	je     804815 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804809:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80480c:	88 02                	mov    %al,(%edx)
+	return 1;
+  80480e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804813:	c9                   	leave
+  804814:	c3                   	ret
+		return 0;
+  804815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481a:	eb f7                	jmp    804813 <devcons_read+0x47>
+
+0080481c <cputchar>:
+{
+  80481c:	55                   	push   %ebp
+  80481d:	89 e5                	mov    %esp,%ebp
+  80481f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804822:	8b 45 08             	mov    0x8(%ebp),%eax
+  804825:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804828:	6a 01                	push   $0x1
+  80482a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80482d:	50                   	push   %eax
+  80482e:	e8 54 c5 ff ff       	call   800d87 <sys_cputs>
+}
+  804833:	83 c4 10             	add    $0x10,%esp
+  804836:	c9                   	leave
+  804837:	c3                   	ret
+
+00804838 <getchar>:
+{
+  804838:	55                   	push   %ebp
+  804839:	89 e5                	mov    %esp,%ebp
+  80483b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80483e:	6a 01                	push   $0x1
+  804840:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804843:	50                   	push   %eax
+  804844:	6a 00                	push   $0x0
+  804846:	e8 d2 d4 ff ff       	call   801d1d <read>
+	if (r < 0)
+  80484b:	83 c4 10             	add    $0x10,%esp
+  80484e:	85 c0                	test   %eax,%eax
+  804850:	78 06                	js     804858 <getchar+0x20>
+	if (r < 1)
+  804852:	74 06                	je     80485a <getchar+0x22>
+	return c;
+  804854:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804858:	c9                   	leave
+  804859:	c3                   	ret
+		return -E_EOF;
+  80485a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80485f:	eb f7                	jmp    804858 <getchar+0x20>
+
+00804861 <iscons>:
+{
+  804861:	55                   	push   %ebp
+  804862:	89 e5                	mov    %esp,%ebp
+  804864:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804867:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80486a:	50                   	push   %eax
+  80486b:	ff 75 08             	push   0x8(%ebp)
+  80486e:	e8 26 d2 ff ff       	call   801a99 <fd_lookup>
+  804873:	83 c4 10             	add    $0x10,%esp
+  804876:	85 c0                	test   %eax,%eax
+  804878:	78 11                	js     80488b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80487a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80487d:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  804883:	39 10                	cmp    %edx,(%eax)
+  804885:	0f 94 c0             	sete   %al
+  804888:	0f b6 c0             	movzbl %al,%eax
+}
+  80488b:	c9                   	leave
+  80488c:	c3                   	ret
+
+0080488d <opencons>:
+{
+  80488d:	55                   	push   %ebp
+  80488e:	89 e5                	mov    %esp,%ebp
+  804890:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804893:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804896:	50                   	push   %eax
+  804897:	e8 ad d1 ff ff       	call   801a49 <fd_alloc>
+  80489c:	83 c4 10             	add    $0x10,%esp
+  80489f:	85 c0                	test   %eax,%eax
+  8048a1:	78 3a                	js     8048dd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8048a3:	83 ec 04             	sub    $0x4,%esp
+  8048a6:	68 07 04 00 00       	push   $0x407
+  8048ab:	ff 75 f4             	push   -0xc(%ebp)
+  8048ae:	6a 00                	push   $0x0
+  8048b0:	e8 8e c5 ff ff       	call   800e43 <sys_page_alloc>
+  8048b5:	83 c4 10             	add    $0x10,%esp
+  8048b8:	85 c0                	test   %eax,%eax
+  8048ba:	78 21                	js     8048dd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8048bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048bf:	8b 15 80 60 80 00    	mov    0x806080,%edx
+  8048c5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8048c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048ca:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8048d1:	83 ec 0c             	sub    $0xc,%esp
+  8048d4:	50                   	push   %eax
+  8048d5:	e8 48 d1 ff ff       	call   801a22 <fd2num>
+  8048da:	83 c4 10             	add    $0x10,%esp
+}
+  8048dd:	c9                   	leave
+  8048de:	c3                   	ret
+
+008048df <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8048df:	55                   	push   %ebp
+  8048e0:	89 e5                	mov    %esp,%ebp
+  8048e2:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  8048e5:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8048ec:	74 0a                	je     8048f8 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8048ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048f1:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  8048f6:	c9                   	leave
+  8048f7:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  8048f8:	83 ec 04             	sub    $0x4,%esp
+  8048fb:	6a 07                	push   $0x7
+  8048fd:	68 00 f0 bf ee       	push   $0xeebff000
+  804902:	6a 00                	push   $0x0
+  804904:	e8 3a c5 ff ff       	call   800e43 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804909:	83 c4 08             	add    $0x8,%esp
+  80490c:	68 1d 49 80 00       	push   $0x80491d
+  804911:	6a 00                	push   $0x0
+  804913:	e8 76 c6 ff ff       	call   800f8e <sys_env_set_pgfault_upcall>
+  804918:	83 c4 10             	add    $0x10,%esp
+  80491b:	eb d1                	jmp    8048ee <set_pgfault_handler+0xf>
+
+0080491d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80491d:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80491e:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  804923:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804925:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804928:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  80492c:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  80492f:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804933:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804935:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804939:	83 c4 08             	add    $0x8,%esp
+	popal;
+  80493c:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  80493d:	83 c4 04             	add    $0x4,%esp
+	popf
+  804940:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804941:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804942:	c3                   	ret
+
+00804943 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804943:	55                   	push   %ebp
+  804944:	89 e5                	mov    %esp,%ebp
+  804946:	56                   	push   %esi
+  804947:	53                   	push   %ebx
+  804948:	8b 75 08             	mov    0x8(%ebp),%esi
+  80494b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80494e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804951:	85 c0                	test   %eax,%eax
+  804953:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804958:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  80495b:	83 ec 0c             	sub    $0xc,%esp
+  80495e:	50                   	push   %eax
+  80495f:	e8 8f c6 ff ff       	call   800ff3 <sys_ipc_recv>
+  804964:	83 c4 10             	add    $0x10,%esp
+  804967:	85 c0                	test   %eax,%eax
+  804969:	0f 88 8b 00 00 00    	js     8049fa <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80496f:	85 f6                	test   %esi,%esi
+  804971:	74 2a                	je     80499d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804973:	89 e2                	mov    %esp,%edx
+  804975:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80497a:	29 d0                	sub    %edx,%eax
+  80497c:	89 c2                	mov    %eax,%edx
+  80497e:	c1 ea 0f             	shr    $0xf,%edx
+  804981:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80498b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80498e:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804995:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80499b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80499d:	85 db                	test   %ebx,%ebx
+  80499f:	74 2a                	je     8049cb <ipc_recv+0x88>
+  8049a1:	89 e2                	mov    %esp,%edx
+  8049a3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8049a8:	29 d0                	sub    %edx,%eax
+  8049aa:	89 c2                	mov    %eax,%edx
+  8049ac:	c1 ea 0f             	shr    $0xf,%edx
+  8049af:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8049b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b9:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  8049bc:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  8049c3:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8049c9:	89 03                	mov    %eax,(%ebx)
+  8049cb:	89 e2                	mov    %esp,%edx
+  8049cd:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8049d2:	29 d0                	sub    %edx,%eax
+  8049d4:	89 c2                	mov    %eax,%edx
+  8049d6:	c1 ea 0f             	shr    $0xf,%edx
+  8049d9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8049de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049e3:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  8049e6:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  8049ed:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  8049f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049f6:	5b                   	pop    %ebx
+  8049f7:	5e                   	pop    %esi
+  8049f8:	5d                   	pop    %ebp
+  8049f9:	c3                   	ret
+		if(from_env_store != NULL)
+  8049fa:	85 f6                	test   %esi,%esi
+  8049fc:	74 06                	je     804a04 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  8049fe:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804a04:	85 db                	test   %ebx,%ebx
+  804a06:	74 eb                	je     8049f3 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804a08:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a0e:	eb e3                	jmp    8049f3 <ipc_recv+0xb0>
+
+00804a10 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804a10:	55                   	push   %ebp
+  804a11:	89 e5                	mov    %esp,%ebp
+  804a13:	57                   	push   %edi
+  804a14:	56                   	push   %esi
+  804a15:	53                   	push   %ebx
+  804a16:	83 ec 14             	sub    $0x14,%esp
+  804a19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804a1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a1f:	8b 75 14             	mov    0x14(%ebp),%esi
+  804a22:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804a25:	85 c0                	test   %eax,%eax
+  804a27:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804a2c:	0f 44 c2             	cmove  %edx,%eax
+  804a2f:	ff 75 10             	push   0x10(%ebp)
+  804a32:	50                   	push   %eax
+  804a33:	e8 1d c6 ff ff       	call   801055 <sys_ipc_recv_pages>
+  804a38:	83 c4 10             	add    $0x10,%esp
+  804a3b:	85 c0                	test   %eax,%eax
+  804a3d:	0f 88 ba 00 00 00    	js     804afd <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804a43:	85 ff                	test   %edi,%edi
+  804a45:	74 2a                	je     804a71 <ipc_recv_pages+0x61>
+  804a47:	89 e2                	mov    %esp,%edx
+  804a49:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804a4e:	29 d0                	sub    %edx,%eax
+  804a50:	89 c2                	mov    %eax,%edx
+  804a52:	c1 ea 0f             	shr    $0xf,%edx
+  804a55:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a5f:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804a62:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804a69:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804a6f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804a71:	85 f6                	test   %esi,%esi
+  804a73:	74 2a                	je     804a9f <ipc_recv_pages+0x8f>
+  804a75:	89 e2                	mov    %esp,%edx
+  804a77:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804a7c:	29 d0                	sub    %edx,%eax
+  804a7e:	89 c2                	mov    %eax,%edx
+  804a80:	c1 ea 0f             	shr    $0xf,%edx
+  804a83:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a8d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804a90:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804a97:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804a9d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804a9f:	85 db                	test   %ebx,%ebx
+  804aa1:	74 2a                	je     804acd <ipc_recv_pages+0xbd>
+  804aa3:	89 e2                	mov    %esp,%edx
+  804aa5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804aaa:	29 d0                	sub    %edx,%eax
+  804aac:	89 c2                	mov    %eax,%edx
+  804aae:	c1 ea 0f             	shr    $0xf,%edx
+  804ab1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804abb:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804abe:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804ac5:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804acb:	89 03                	mov    %eax,(%ebx)
+  804acd:	89 e2                	mov    %esp,%edx
+  804acf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804ad4:	29 d0                	sub    %edx,%eax
+  804ad6:	89 c2                	mov    %eax,%edx
+  804ad8:	c1 ea 0f             	shr    $0xf,%edx
+  804adb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae5:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804ae8:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804aef:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804af8:	5b                   	pop    %ebx
+  804af9:	5e                   	pop    %esi
+  804afa:	5f                   	pop    %edi
+  804afb:	5d                   	pop    %ebp
+  804afc:	c3                   	ret
+		if (from_env_store)
+  804afd:	85 ff                	test   %edi,%edi
+  804aff:	74 06                	je     804b07 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804b01:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804b07:	85 f6                	test   %esi,%esi
+  804b09:	74 06                	je     804b11 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804b0b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804b11:	85 db                	test   %ebx,%ebx
+  804b13:	74 e0                	je     804af5 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804b15:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b1b:	eb d8                	jmp    804af5 <ipc_recv_pages+0xe5>
+
+00804b1d <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804b1d:	55                   	push   %ebp
+  804b1e:	89 e5                	mov    %esp,%ebp
+  804b20:	57                   	push   %edi
+  804b21:	56                   	push   %esi
+  804b22:	53                   	push   %ebx
+  804b23:	83 ec 1c             	sub    $0x1c,%esp
+  804b26:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804b29:	8b 75 08             	mov    0x8(%ebp),%esi
+  804b2c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804b32:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804b36:	75 2b                	jne    804b63 <ipc_try_send_pages+0x46>
+  804b38:	89 e2                	mov    %esp,%edx
+  804b3a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b3f:	29 d0                	sub    %edx,%eax
+  804b41:	89 c2                	mov    %eax,%edx
+  804b43:	c1 ea 0f             	shr    $0xf,%edx
+  804b46:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b50:	0f 42 c2             	cmovb  %edx,%eax
+  804b53:	8b 04 85 40 80 80 00 	mov    0x808040(,%eax,4),%eax
+  804b5a:	8b 70 48             	mov    0x48(%eax),%esi
+  804b5d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804b63:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804b69:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804b6e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b71:	85 ff                	test   %edi,%edi
+  804b73:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804b78:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804b7b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804b81:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804b87:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804b8d:	83 ec 0c             	sub    $0xc,%esp
+  804b90:	ff 75 14             	push   0x14(%ebp)
+  804b93:	ff 75 18             	push   0x18(%ebp)
+  804b96:	57                   	push   %edi
+  804b97:	ff 75 0c             	push   0xc(%ebp)
+  804b9a:	ff 75 08             	push   0x8(%ebp)
+  804b9d:	e8 92 c4 ff ff       	call   801034 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804ba2:	83 c4 20             	add    $0x20,%esp
+  804ba5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804ba8:	75 21                	jne    804bcb <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804baa:	83 ec 04             	sub    $0x4,%esp
+  804bad:	6a ff                	push   $0xffffffff
+  804baf:	53                   	push   %ebx
+  804bb0:	ff 75 e4             	push   -0x1c(%ebp)
+  804bb3:	e8 89 c6 ff ff       	call   801241 <sys_futex_wait>
+  804bb8:	83 c4 10             	add    $0x10,%esp
+  804bbb:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804bbe:	74 c7                	je     804b87 <ipc_try_send_pages+0x6a>
+  804bc0:	85 c0                	test   %eax,%eax
+  804bc2:	79 c3                	jns    804b87 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804bc4:	e8 5b c2 ff ff       	call   800e24 <sys_yield>
+  804bc9:	eb bc                	jmp    804b87 <ipc_try_send_pages+0x6a>
+	}
+}
+  804bcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804bce:	5b                   	pop    %ebx
+  804bcf:	5e                   	pop    %esi
+  804bd0:	5f                   	pop    %edi
+  804bd1:	5d                   	pop    %ebp
+  804bd2:	c3                   	ret
+
+00804bd3 <ipc_send>:
+{
+  804bd3:	55                   	push   %ebp
+  804bd4:	89 e5                	mov    %esp,%ebp
+  804bd6:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804bd9:	ff 75 14             	push   0x14(%ebp)
+  804bdc:	6a 01                	push   $0x1
+  804bde:	ff 75 10             	push   0x10(%ebp)
+  804be1:	ff 75 0c             	push   0xc(%ebp)
+  804be4:	ff 75 08             	push   0x8(%ebp)
+  804be7:	e8 31 ff ff ff       	call   804b1d <ipc_try_send_pages>
+  804bec:	83 c4 20             	add    $0x20,%esp
+  804bef:	85 c0                	test   %eax,%eax
+  804bf1:	78 02                	js     804bf5 <ipc_send+0x22>
+}
+  804bf3:	c9                   	leave
+  804bf4:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804bf5:	50                   	push   %eax
+  804bf6:	68 7e 55 80 00       	push   $0x80557e
+  804bfb:	6a 3f                	push   $0x3f
+  804bfd:	68 93 55 80 00       	push   $0x805593
+  804c02:	e8 36 b6 ff ff       	call   80023d <_panic>
+
+00804c07 <ipc_send_pages>:
+{
+  804c07:	55                   	push   %ebp
+  804c08:	89 e5                	mov    %esp,%ebp
+  804c0a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804c0d:	ff 75 18             	push   0x18(%ebp)
+  804c10:	ff 75 14             	push   0x14(%ebp)
+  804c13:	ff 75 10             	push   0x10(%ebp)
+  804c16:	ff 75 0c             	push   0xc(%ebp)
+  804c19:	ff 75 08             	push   0x8(%ebp)
+  804c1c:	e8 fc fe ff ff       	call   804b1d <ipc_try_send_pages>
+  804c21:	83 c4 20             	add    $0x20,%esp
+  804c24:	85 c0                	test   %eax,%eax
+  804c26:	78 02                	js     804c2a <ipc_send_pages+0x23>
+}
+  804c28:	c9                   	leave
+  804c29:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804c2a:	50                   	push   %eax
+  804c2b:	68 9d 55 80 00       	push   $0x80559d
+  804c30:	6a 64                	push   $0x64
+  804c32:	68 93 55 80 00       	push   $0x805593
+  804c37:	e8 01 b6 ff ff       	call   80023d <_panic>
+
+00804c3c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804c3c:	55                   	push   %ebp
+  804c3d:	89 e5                	mov    %esp,%ebp
+  804c3f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804c42:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804c47:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804c4d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804c53:	8b 52 50             	mov    0x50(%edx),%edx
+  804c56:	39 ca                	cmp    %ecx,%edx
+  804c58:	74 11                	je     804c6b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804c5a:	83 c0 01             	add    $0x1,%eax
+  804c5d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804c62:	75 e3                	jne    804c47 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804c64:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c69:	eb 0e                	jmp    804c79 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804c6b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804c71:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804c76:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804c79:	5d                   	pop    %ebp
+  804c7a:	c3                   	ret
+
+00804c7b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804c7b:	55                   	push   %ebp
+  804c7c:	89 e5                	mov    %esp,%ebp
+  804c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804c81:	89 c2                	mov    %eax,%edx
+  804c83:	c1 ea 16             	shr    $0x16,%edx
+  804c86:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804c8d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804c92:	f6 c1 01             	test   $0x1,%cl
+  804c95:	74 1e                	je     804cb5 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804c97:	c1 e8 0c             	shr    $0xc,%eax
+  804c9a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804ca1:	a8 01                	test   $0x1,%al
+  804ca3:	74 10                	je     804cb5 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804ca5:	c1 e8 0c             	shr    $0xc,%eax
+  804ca8:	c1 e0 04             	shl    $0x4,%eax
+  804cab:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804cb2:	0f b7 d2             	movzwl %dx,%edx
+}
+  804cb5:	89 d0                	mov    %edx,%eax
+  804cb7:	5d                   	pop    %ebp
+  804cb8:	c3                   	ret
+
+00804cb9 <__udivdi3>:
+  804cb9:	57                   	push   %edi
+  804cba:	56                   	push   %esi
+  804cbb:	53                   	push   %ebx
+  804cbc:	83 ec 20             	sub    $0x20,%esp
+  804cbf:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804cc3:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804cc7:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804ccb:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804ccf:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804cd3:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804cd7:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804cdb:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804cdf:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cee:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804cf5:	00 
+  804cf6:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804cfd:	00 
+  804cfe:	eb 08                	jmp    804d08 <__udivdi3+0x4f>
+  804d00:	83 e9 01             	sub    $0x1,%ecx
+  804d03:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804d06:	74 68                	je     804d70 <__udivdi3+0xb7>
+  804d08:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804d0c:	01 c0                	add    %eax,%eax
+  804d0e:	89 c6                	mov    %eax,%esi
+  804d10:	89 d7                	mov    %edx,%edi
+  804d12:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d16:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d1a:	0f ad d0             	shrd   %cl,%edx,%eax
+  804d1d:	d3 ea                	shr    %cl,%edx
+  804d1f:	f6 c1 20             	test   $0x20,%cl
+  804d22:	74 04                	je     804d28 <__udivdi3+0x6f>
+  804d24:	89 d0                	mov    %edx,%eax
+  804d26:	31 d2                	xor    %edx,%edx
+  804d28:	83 e0 01             	and    $0x1,%eax
+  804d2b:	89 04 24             	mov    %eax,(%esp)
+  804d2e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804d35:	00 
+  804d36:	8b 04 24             	mov    (%esp),%eax
+  804d39:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804d3d:	09 f0                	or     %esi,%eax
+  804d3f:	09 fa                	or     %edi,%edx
+  804d41:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804d45:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804d49:	39 f0                	cmp    %esi,%eax
+  804d4b:	89 d3                	mov    %edx,%ebx
+  804d4d:	19 fb                	sbb    %edi,%ebx
+  804d4f:	72 af                	jb     804d00 <__udivdi3+0x47>
+  804d51:	29 f0                	sub    %esi,%eax
+  804d53:	19 fa                	sbb    %edi,%edx
+  804d55:	89 cf                	mov    %ecx,%edi
+  804d57:	c1 ef 05             	shr    $0x5,%edi
+  804d5a:	83 e7 01             	and    $0x1,%edi
+  804d5d:	89 fe                	mov    %edi,%esi
+  804d5f:	83 f6 01             	xor    $0x1,%esi
+  804d62:	d3 e6                	shl    %cl,%esi
+  804d64:	d3 e7                	shl    %cl,%edi
+  804d66:	09 74 24 18          	or     %esi,0x18(%esp)
+  804d6a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804d6e:	eb 90                	jmp    804d00 <__udivdi3+0x47>
+  804d70:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d74:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d78:	83 c4 20             	add    $0x20,%esp
+  804d7b:	5b                   	pop    %ebx
+  804d7c:	5e                   	pop    %esi
+  804d7d:	5f                   	pop    %edi
+  804d7e:	c3                   	ret
+
+00804d7f <__umoddi3>:
+  804d7f:	57                   	push   %edi
+  804d80:	56                   	push   %esi
+  804d81:	53                   	push   %ebx
+  804d82:	83 ec 08             	sub    $0x8,%esp
+  804d85:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804d89:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804d8d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804d91:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804d95:	57                   	push   %edi
+  804d96:	56                   	push   %esi
+  804d97:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804d9b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804d9f:	52                   	push   %edx
+  804da0:	50                   	push   %eax
+  804da1:	e8 13 ff ff ff       	call   804cb9 <__udivdi3>
+  804da6:	89 c3                	mov    %eax,%ebx
+  804da8:	0f af d6             	imul   %esi,%edx
+  804dab:	89 f9                	mov    %edi,%ecx
+  804dad:	0f af cb             	imul   %ebx,%ecx
+  804db0:	01 d1                	add    %edx,%ecx
+  804db2:	89 d8                	mov    %ebx,%eax
+  804db4:	f7 e6                	mul    %esi
+  804db6:	89 c6                	mov    %eax,%esi
+  804db8:	89 d7                	mov    %edx,%edi
+  804dba:	01 cf                	add    %ecx,%edi
+  804dbc:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804dc0:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804dc4:	29 f0                	sub    %esi,%eax
+  804dc6:	19 fa                	sbb    %edi,%edx
+  804dc8:	83 c4 18             	add    $0x18,%esp
+  804dcb:	5b                   	pop    %ebx
+  804dcc:	5e                   	pop    %esi
+  804dcd:	5f                   	pop    %edi
+  804dce:	c3                   	ret
+
+00804dcf <__divdi3>:
+  804dcf:	53                   	push   %ebx
+  804dd0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804dd4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dd8:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804ddc:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804de0:	85 d2                	test   %edx,%edx
+  804de2:	78 12                	js     804df6 <__divdi3+0x27>
+  804de4:	85 db                	test   %ebx,%ebx
+  804de6:	78 2e                	js     804e16 <__divdi3+0x47>
+  804de8:	53                   	push   %ebx
+  804de9:	51                   	push   %ecx
+  804dea:	52                   	push   %edx
+  804deb:	50                   	push   %eax
+  804dec:	e8 c8 fe ff ff       	call   804cb9 <__udivdi3>
+  804df1:	83 c4 10             	add    $0x10,%esp
+  804df4:	eb 1e                	jmp    804e14 <__divdi3+0x45>
+  804df6:	f7 d8                	neg    %eax
+  804df8:	83 d2 00             	adc    $0x0,%edx
+  804dfb:	f7 da                	neg    %edx
+  804dfd:	85 db                	test   %ebx,%ebx
+  804dff:	78 2a                	js     804e2b <__divdi3+0x5c>
+  804e01:	53                   	push   %ebx
+  804e02:	51                   	push   %ecx
+  804e03:	52                   	push   %edx
+  804e04:	50                   	push   %eax
+  804e05:	e8 af fe ff ff       	call   804cb9 <__udivdi3>
+  804e0a:	83 c4 10             	add    $0x10,%esp
+  804e0d:	f7 d8                	neg    %eax
+  804e0f:	83 d2 00             	adc    $0x0,%edx
+  804e12:	f7 da                	neg    %edx
+  804e14:	5b                   	pop    %ebx
+  804e15:	c3                   	ret
+  804e16:	f7 d9                	neg    %ecx
+  804e18:	83 d3 00             	adc    $0x0,%ebx
+  804e1b:	f7 db                	neg    %ebx
+  804e1d:	53                   	push   %ebx
+  804e1e:	51                   	push   %ecx
+  804e1f:	52                   	push   %edx
+  804e20:	50                   	push   %eax
+  804e21:	e8 93 fe ff ff       	call   804cb9 <__udivdi3>
+  804e26:	83 c4 10             	add    $0x10,%esp
+  804e29:	eb e2                	jmp    804e0d <__divdi3+0x3e>
+  804e2b:	f7 d9                	neg    %ecx
+  804e2d:	83 d3 00             	adc    $0x0,%ebx
+  804e30:	f7 db                	neg    %ebx
+  804e32:	53                   	push   %ebx
+  804e33:	51                   	push   %ecx
+  804e34:	52                   	push   %edx
+  804e35:	50                   	push   %eax
+  804e36:	e8 7e fe ff ff       	call   804cb9 <__udivdi3>
+  804e3b:	83 c4 10             	add    $0x10,%esp
+  804e3e:	eb d4                	jmp    804e14 <__divdi3+0x45>
+
+00804e40 <__moddi3>:
+  804e40:	57                   	push   %edi
+  804e41:	56                   	push   %esi
+  804e42:	53                   	push   %ebx
+  804e43:	83 ec 08             	sub    $0x8,%esp
+  804e46:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804e4a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804e4e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804e52:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804e56:	57                   	push   %edi
+  804e57:	56                   	push   %esi
+  804e58:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804e5c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804e60:	52                   	push   %edx
+  804e61:	50                   	push   %eax
+  804e62:	e8 68 ff ff ff       	call   804dcf <__divdi3>
+  804e67:	89 c3                	mov    %eax,%ebx
+  804e69:	0f af d6             	imul   %esi,%edx
+  804e6c:	89 f9                	mov    %edi,%ecx
+  804e6e:	0f af cb             	imul   %ebx,%ecx
+  804e71:	01 d1                	add    %edx,%ecx
+  804e73:	89 d8                	mov    %ebx,%eax
+  804e75:	f7 e6                	mul    %esi
+  804e77:	89 c6                	mov    %eax,%esi
+  804e79:	89 d7                	mov    %edx,%edi
+  804e7b:	01 cf                	add    %ecx,%edi
+  804e7d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804e81:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804e85:	29 f0                	sub    %esi,%eax
+  804e87:	19 fa                	sbb    %edi,%edx
+  804e89:	83 c4 18             	add    $0x18,%esp
+  804e8c:	5b                   	pop    %ebx
+  804e8d:	5e                   	pop    %esi
+  804e8e:	5f                   	pop    %edi
+  804e8f:	c3                   	ret
@@ -0,0 +1,8149 @@
+
+obj/user/testreclaim.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ba 02 00 00       	call   8002eb <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <fill_memory>:
+
+// Allocate anonymous pages until memory runs out, then free them again.
+// Returns the number of pages we got.
+static int
+fill_memory(void)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+	char *va;
+	int r;
+
+	for (va = ARENA; va < ARENAEND; va += PGSIZE)
+  80003a:	bb 00 00 00 20       	mov    $0x20000000,%ebx
+		if ((r = sys_page_alloc(0, va, PTE_P|PTE_U|PTE_W)) < 0)
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 07                	push   $0x7
+  800044:	53                   	push   %ebx
+  800045:	6a 00                	push   $0x0
+  800047:	e8 4c 0f 00 00       	call   800f98 <sys_page_alloc>
+  80004c:	83 c4 10             	add    $0x10,%esp
+  80004f:	85 c0                	test   %eax,%eax
+  800051:	78 22                	js     800075 <fill_memory+0x40>
+	for (va = ARENA; va < ARENAEND; va += PGSIZE)
+  800053:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800059:	81 fb 00 00 00 c0    	cmp    $0xc0000000,%ebx
+  80005f:	75 de                	jne    80003f <fill_memory+0xa>
+			break;
+	if (va == ARENAEND)
+		panic("never ran out of memory");
+  800061:	83 ec 04             	sub    $0x4,%esp
+  800064:	68 20 3d 80 00       	push   $0x803d20
+  800069:	6a 19                	push   $0x19
+  80006b:	68 38 3d 80 00       	push   $0x803d38
+  800070:	e8 1d 03 00 00       	call   800392 <_panic>
+	if (va == ARENAEND)
+  800075:	81 fb 00 00 00 c0    	cmp    $0xc0000000,%ebx
+  80007b:	74 e4                	je     800061 <fill_memory+0x2c>
+	if (r != -E_NO_MEM)
+  80007d:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  800080:	75 40                	jne    8000c2 <fill_memory+0x8d>
+		panic("sys_page_alloc: %e", r);
+	r = (va - ARENA) / PGSIZE;
+  800082:	8d b3 ff 0f 00 e0    	lea    -0x1ffff001(%ebx),%esi
+  800088:	89 d8                	mov    %ebx,%eax
+  80008a:	2d 00 00 00 20       	sub    $0x20000000,%eax
+  80008f:	0f 49 f0             	cmovns %eax,%esi
+  800092:	c1 fe 0c             	sar    $0xc,%esi
+	while (va > ARENA) {
+  800095:	81 fb 00 00 00 20    	cmp    $0x20000000,%ebx
+  80009b:	76 1c                	jbe    8000b9 <fill_memory+0x84>
+		va -= PGSIZE;
+  80009d:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+		sys_page_unmap(0, va);
+  8000a3:	83 ec 08             	sub    $0x8,%esp
+  8000a6:	53                   	push   %ebx
+  8000a7:	6a 00                	push   $0x0
+  8000a9:	e8 6f 0f 00 00       	call   80101d <sys_page_unmap>
+	while (va > ARENA) {
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	81 fb 00 00 00 20    	cmp    $0x20000000,%ebx
+  8000b7:	77 e4                	ja     80009d <fill_memory+0x68>
+	}
+	return r;
+}
+  8000b9:	89 f0                	mov    %esi,%eax
+  8000bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000be:	5b                   	pop    %ebx
+  8000bf:	5e                   	pop    %esi
+  8000c0:	5d                   	pop    %ebp
+  8000c1:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 4b 3d 80 00       	push   $0x803d4b
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 38 3d 80 00       	push   $0x803d38
+  8000cf:	e8 be 02 00 00       	call   800392 <_panic>
+
+008000d4 <check_file>:
+
+static void
+check_file(const char *what)
+{
+  8000d4:	55                   	push   %ebp
+  8000d5:	89 e5                	mov    %esp,%ebp
+  8000d7:	57                   	push   %edi
+  8000d8:	56                   	push   %esi
+  8000d9:	53                   	push   %ebx
+  8000da:	83 ec 24             	sub    $0x24,%esp
+  8000dd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	int fd, i, j, r;
+
+	if ((fd = open("/reclaim", O_RDONLY)) < 0)
+  8000e0:	6a 00                	push   $0x0
+  8000e2:	68 5e 3d 80 00       	push   $0x803d5e
+  8000e7:	e8 03 1b 00 00       	call   801bef <open>
+  8000ec:	89 c7                	mov    %eax,%edi
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	85 c0                	test   %eax,%eax
+  8000f3:	78 0c                	js     800101 <check_file+0x2d>
+  8000f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		panic("open /reclaim: %e", fd);
+	for (i = 0; i < NBLK; i++) {
+  8000fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000ff:	eb 51                	jmp    800152 <check_file+0x7e>
+		panic("open /reclaim: %e", fd);
+  800101:	50                   	push   %eax
+  800102:	68 67 3d 80 00       	push   $0x803d67
+  800107:	6a 2a                	push   $0x2a
+  800109:	68 38 3d 80 00       	push   $0x803d38
+  80010e:	e8 7f 02 00 00       	call   800392 <_panic>
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("read block %d: %e", i, r);
+  800113:	83 ec 0c             	sub    $0xc,%esp
+  800116:	50                   	push   %eax
+  800117:	56                   	push   %esi
+  800118:	68 79 3d 80 00       	push   $0x803d79
+  80011d:	6a 2d                	push   $0x2d
+  80011f:	68 38 3d 80 00       	push   $0x803d38
+  800124:	e8 69 02 00 00       	call   800392 <_panic>
+		for (j = 0; j < BLKSIZE / 4; j++)
+			if (((uint32_t *) buf)[j] != i * 1024 + j)
+				panic("%s: bad data in block %d", what, i);
+  800129:	83 ec 0c             	sub    $0xc,%esp
+  80012c:	56                   	push   %esi
+  80012d:	ff 75 e4             	push   -0x1c(%ebp)
+  800130:	68 8b 3d 80 00       	push   $0x803d8b
+  800135:	6a 30                	push   $0x30
+  800137:	68 38 3d 80 00       	push   $0x803d38
+  80013c:	e8 51 02 00 00       	call   800392 <_panic>
+	for (i = 0; i < NBLK; i++) {
+  800141:	83 c6 01             	add    $0x1,%esi
+  800144:	81 c3 00 04 00 00    	add    $0x400,%ebx
+  80014a:	81 fe 00 02 00 00    	cmp    $0x200,%esi
+  800150:	74 3a                	je     80018c <check_file+0xb8>
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  800152:	83 ec 04             	sub    $0x4,%esp
+  800155:	68 00 10 00 00       	push   $0x1000
+  80015a:	68 40 63 80 00       	push   $0x806340
+  80015f:	57                   	push   %edi
+  800160:	e8 35 16 00 00       	call   80179a <readn>
+  800165:	83 c4 10             	add    $0x10,%esp
+  800168:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80016d:	75 a4                	jne    800113 <check_file+0x3f>
+		for (j = 0; j < BLKSIZE / 4; j++)
+  80016f:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (((uint32_t *) buf)[j] != i * 1024 + j)
+  800174:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  800177:	39 14 85 40 63 80 00 	cmp    %edx,0x806340(,%eax,4)
+  80017e:	75 a9                	jne    800129 <check_file+0x55>
+		for (j = 0; j < BLKSIZE / 4; j++)
+  800180:	83 c0 01             	add    $0x1,%eax
+  800183:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800188:	75 ea                	jne    800174 <check_file+0xa0>
+  80018a:	eb b5                	jmp    800141 <check_file+0x6d>
+	}
+	close(fd);
+  80018c:	83 ec 0c             	sub    $0xc,%esp
+  80018f:	57                   	push   %edi
+  800190:	e8 22 14 00 00       	call   8015b7 <close>
+}
+  800195:	83 c4 10             	add    $0x10,%esp
+  800198:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019b:	5b                   	pop    %ebx
+  80019c:	5e                   	pop    %esi
+  80019d:	5f                   	pop    %edi
+  80019e:	5d                   	pop    %ebp
+  80019f:	c3                   	ret
+
+008001a0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001a0:	55                   	push   %ebp
+  8001a1:	89 e5                	mov    %esp,%ebp
+  8001a3:	57                   	push   %edi
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 1c             	sub    $0x1c,%esp
+	int fd, i, j, r, before, after;
+
+	before = fill_memory();
+  8001a9:	e8 87 fe ff ff       	call   800035 <fill_memory>
+  8001ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	cprintf("testreclaim: %d pages before caching the file\n", before);
+  8001b1:	83 ec 08             	sub    $0x8,%esp
+  8001b4:	50                   	push   %eax
+  8001b5:	68 f8 3d 80 00       	push   $0x803df8
+  8001ba:	e8 ae 02 00 00       	call   80046d <cprintf>
+
+	// Write the file and flush it so its blocks are cached but clean.
+	if ((fd = open("/reclaim", O_RDWR|O_CREAT|O_TRUNC)) < 0)
+  8001bf:	83 c4 08             	add    $0x8,%esp
+  8001c2:	68 02 03 00 00       	push   $0x302
+  8001c7:	68 5e 3d 80 00       	push   $0x803d5e
+  8001cc:	e8 1e 1a 00 00       	call   801bef <open>
+  8001d1:	89 c7                	mov    %eax,%edi
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	85 c0                	test   %eax,%eax
+  8001d8:	0f 88 bf 00 00 00    	js     80029d <umain+0xfd>
+  8001de:	bb 00 00 00 00       	mov    $0x0,%ebx
+		panic("create /reclaim: %e", fd);
+	for (i = 0; i < NBLK; i++) {
+  8001e3:	be 00 00 00 00       	mov    $0x0,%esi
+		for (j = 0; j < BLKSIZE / 4; j++)
+  8001e8:	b8 00 00 00 00       	mov    $0x0,%eax
+			((uint32_t *) buf)[j] = i * 1024 + j;
+  8001ed:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8001f0:	89 14 85 40 63 80 00 	mov    %edx,0x806340(,%eax,4)
+		for (j = 0; j < BLKSIZE / 4; j++)
+  8001f7:	83 c0 01             	add    $0x1,%eax
+  8001fa:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8001ff:	75 ec                	jne    8001ed <umain+0x4d>
+		if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	68 00 10 00 00       	push   $0x1000
+  800209:	68 40 63 80 00       	push   $0x806340
+  80020e:	57                   	push   %edi
+  80020f:	e8 da 15 00 00       	call   8017ee <write>
+  800214:	83 c4 10             	add    $0x10,%esp
+  800217:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80021c:	0f 85 8d 00 00 00    	jne    8002af <umain+0x10f>
+	for (i = 0; i < NBLK; i++) {
+  800222:	83 c6 01             	add    $0x1,%esi
+  800225:	81 c3 00 04 00 00    	add    $0x400,%ebx
+  80022b:	81 fe 00 02 00 00    	cmp    $0x200,%esi
+  800231:	75 b5                	jne    8001e8 <umain+0x48>
+			panic("write block %d: %e", i, r);
+	}
+	close(fd);
+  800233:	83 ec 0c             	sub    $0xc,%esp
+  800236:	57                   	push   %edi
+  800237:	e8 7b 13 00 00       	call   8015b7 <close>
+	if ((r = sync()) < 0)
+  80023c:	e8 15 1b 00 00       	call   801d56 <sync>
+  800241:	83 c4 10             	add    $0x10,%esp
+  800244:	85 c0                	test   %eax,%eax
+  800246:	78 7d                	js     8002c5 <umain+0x125>
+		panic("sync: %e", r);
+	check_file("cached");
+  800248:	b8 d4 3d 80 00       	mov    $0x803dd4,%eax
+  80024d:	e8 82 fe ff ff       	call   8000d4 <check_file>
+
+	// The cached file plus our pages exceed physical memory,
+	// so the file's pages must have been reclaimed to get these.
+	after = fill_memory();
+  800252:	e8 de fd ff ff       	call   800035 <fill_memory>
+  800257:	89 c3                	mov    %eax,%ebx
+	cprintf("testreclaim: %d pages with %d file blocks cached\n", after, NBLK);
+  800259:	83 ec 04             	sub    $0x4,%esp
+  80025c:	68 00 02 00 00       	push   $0x200
+  800261:	50                   	push   %eax
+  800262:	68 28 3e 80 00       	push   $0x803e28
+  800267:	e8 01 02 00 00       	call   80046d <cprintf>
+	if (after < before - NBLK / 2)
+  80026c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80026f:	2d 00 01 00 00       	sub    $0x100,%eax
+  800274:	83 c4 10             	add    $0x10,%esp
+  800277:	39 d8                	cmp    %ebx,%eax
+  800279:	7f 5c                	jg     8002d7 <umain+0x137>
+		panic("cached file blocks were not reclaimed");
+
+	check_file("reclaimed");
+  80027b:	b8 db 3d 80 00       	mov    $0x803ddb,%eax
+  800280:	e8 4f fe ff ff       	call   8000d4 <check_file>
+	cprintf("testreclaim: OK\n");
+  800285:	83 ec 0c             	sub    $0xc,%esp
+  800288:	68 e5 3d 80 00       	push   $0x803de5
+  80028d:	e8 db 01 00 00       	call   80046d <cprintf>
+}
+  800292:	83 c4 10             	add    $0x10,%esp
+  800295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800298:	5b                   	pop    %ebx
+  800299:	5e                   	pop    %esi
+  80029a:	5f                   	pop    %edi
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+		panic("create /reclaim: %e", fd);
+  80029d:	50                   	push   %eax
+  80029e:	68 a4 3d 80 00       	push   $0x803da4
+  8002a3:	6a 3f                	push   $0x3f
+  8002a5:	68 38 3d 80 00       	push   $0x803d38
+  8002aa:	e8 e3 00 00 00       	call   800392 <_panic>
+			panic("write block %d: %e", i, r);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	50                   	push   %eax
+  8002b3:	56                   	push   %esi
+  8002b4:	68 b8 3d 80 00       	push   $0x803db8
+  8002b9:	6a 44                	push   $0x44
+  8002bb:	68 38 3d 80 00       	push   $0x803d38
+  8002c0:	e8 cd 00 00 00       	call   800392 <_panic>
+		panic("sync: %e", r);
+  8002c5:	50                   	push   %eax
+  8002c6:	68 cb 3d 80 00       	push   $0x803dcb
+  8002cb:	6a 48                	push   $0x48
+  8002cd:	68 38 3d 80 00       	push   $0x803d38
+  8002d2:	e8 bb 00 00 00       	call   800392 <_panic>
+		panic("cached file blocks were not reclaimed");
+  8002d7:	83 ec 04             	sub    $0x4,%esp
+  8002da:	68 5c 3e 80 00       	push   $0x803e5c
+  8002df:	6a 50                	push   $0x50
+  8002e1:	68 38 3d 80 00       	push   $0x803d38
+  8002e6:	e8 a7 00 00 00       	call   800392 <_panic>
+
+008002eb <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002eb:	55                   	push   %ebp
+  8002ec:	89 e5                	mov    %esp,%ebp
+  8002ee:	56                   	push   %esi
+  8002ef:	53                   	push   %ebx
+  8002f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8002f6:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8002f8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8002fd:	29 d0                	sub    %edx,%eax
+  8002ff:	89 c2                	mov    %eax,%edx
+  800301:	c1 ea 0f             	shr    $0xf,%edx
+  800304:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030e:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800311:	c7 04 85 40 73 80 00 	movl   $0x0,0x807340(,%eax,4)
+  800318:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80031c:	e8 39 0c 00 00       	call   800f5a <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800321:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800326:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80032c:	89 e1                	mov    %esp,%ecx
+  80032e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800333:	29 ca                	sub    %ecx,%edx
+  800335:	89 d1                	mov    %edx,%ecx
+  800337:	c1 e9 0f             	shr    $0xf,%ecx
+  80033a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800340:	ba 00 00 00 00       	mov    $0x0,%edx
+  800345:	0f 42 d1             	cmovb  %ecx,%edx
+  800348:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80034d:	89 04 95 40 73 80 00 	mov    %eax,0x807340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800354:	85 db                	test   %ebx,%ebx
+  800356:	7e 07                	jle    80035f <libmain+0x74>
+		binaryname = argv[0];
+  800358:	8b 06                	mov    (%esi),%eax
+  80035a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	56                   	push   %esi
+  800363:	53                   	push   %ebx
+  800364:	e8 37 fe ff ff       	call   8001a0 <umain>
+
+	// exit gracefully
+	exit();
+  800369:	e8 0a 00 00 00       	call   800378 <exit>
+}
+  80036e:	83 c4 10             	add    $0x10,%esp
+  800371:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800374:	5b                   	pop    %ebx
+  800375:	5e                   	pop    %esi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+
+00800378 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80037e:	e8 61 12 00 00       	call   8015e4 <close_all>
+	sys_env_destroy(0);
+  800383:	83 ec 0c             	sub    $0xc,%esp
+  800386:	6a 00                	push   $0x0
+  800388:	e8 8c 0b 00 00       	call   800f19 <sys_env_destroy>
+}
+  80038d:	83 c4 10             	add    $0x10,%esp
+  800390:	c9                   	leave
+  800391:	c3                   	ret
+
+00800392 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	56                   	push   %esi
+  800396:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800397:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80039a:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8003a0:	e8 b5 0b 00 00       	call   800f5a <sys_getenvid>
+  8003a5:	83 ec 0c             	sub    $0xc,%esp
+  8003a8:	ff 75 0c             	push   0xc(%ebp)
+  8003ab:	ff 75 08             	push   0x8(%ebp)
+  8003ae:	56                   	push   %esi
+  8003af:	50                   	push   %eax
+  8003b0:	68 8c 3e 80 00       	push   $0x803e8c
+  8003b5:	e8 b3 00 00 00       	call   80046d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003ba:	83 c4 18             	add    $0x18,%esp
+  8003bd:	53                   	push   %ebx
+  8003be:	ff 75 10             	push   0x10(%ebp)
+  8003c1:	e8 56 00 00 00       	call   80041c <vcprintf>
+	cprintf("\n");
+  8003c6:	c7 04 24 f4 3d 80 00 	movl   $0x803df4,(%esp)
+  8003cd:	e8 9b 00 00 00       	call   80046d <cprintf>
+  8003d2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003d5:	cc                   	int3
+	while (1)
+  8003d6:	eb fd                	jmp    8003d5 <_panic+0x43>
+
+008003d8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003d8:	55                   	push   %ebp
+  8003d9:	89 e5                	mov    %esp,%ebp
+  8003db:	53                   	push   %ebx
+  8003dc:	83 ec 04             	sub    $0x4,%esp
+  8003df:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8003e2:	8b 13                	mov    (%ebx),%edx
+  8003e4:	8d 42 01             	lea    0x1(%edx),%eax
+  8003e7:	89 03                	mov    %eax,(%ebx)
+  8003e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003ec:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8003f0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003f5:	74 09                	je     800400 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8003f7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800400:	83 ec 08             	sub    $0x8,%esp
+  800403:	68 ff 00 00 00       	push   $0xff
+  800408:	8d 43 08             	lea    0x8(%ebx),%eax
+  80040b:	50                   	push   %eax
+  80040c:	e8 cb 0a 00 00       	call   800edc <sys_cputs>
+		b->idx = 0;
+  800411:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800417:	83 c4 10             	add    $0x10,%esp
+  80041a:	eb db                	jmp    8003f7 <putch+0x1f>
+
+0080041c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80041c:	55                   	push   %ebp
+  80041d:	89 e5                	mov    %esp,%ebp
+  80041f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800425:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80042c:	00 00 00 
+	b.cnt = 0;
+  80042f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800436:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800439:	ff 75 0c             	push   0xc(%ebp)
+  80043c:	ff 75 08             	push   0x8(%ebp)
+  80043f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800445:	50                   	push   %eax
+  800446:	68 d8 03 80 00       	push   $0x8003d8
+  80044b:	e8 1c 01 00 00       	call   80056c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800450:	83 c4 08             	add    $0x8,%esp
+  800453:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800459:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80045f:	50                   	push   %eax
+  800460:	e8 77 0a 00 00       	call   800edc <sys_cputs>
+
+	return b.cnt;
+}
+  800465:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80046b:	c9                   	leave
+  80046c:	c3                   	ret
+
+0080046d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800473:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800476:	50                   	push   %eax
+  800477:	ff 75 08             	push   0x8(%ebp)
+  80047a:	e8 9d ff ff ff       	call   80041c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80047f:	c9                   	leave
+  800480:	c3                   	ret
+
+00800481 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800481:	55                   	push   %ebp
+  800482:	89 e5                	mov    %esp,%ebp
+  800484:	57                   	push   %edi
+  800485:	56                   	push   %esi
+  800486:	53                   	push   %ebx
+  800487:	83 ec 1c             	sub    $0x1c,%esp
+  80048a:	89 c3                	mov    %eax,%ebx
+  80048c:	89 d6                	mov    %edx,%esi
+  80048e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800491:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800494:	89 d1                	mov    %edx,%ecx
+  800496:	89 c2                	mov    %eax,%edx
+  800498:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80049b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80049e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004ab:	39 c2                	cmp    %eax,%edx
+  8004ad:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004b0:	73 4b                	jae    8004fd <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8004b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b5:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8004b8:	85 ff                	test   %edi,%edi
+  8004ba:	7e 11                	jle    8004cd <printnum+0x4c>
+			putch(padc, putdat);
+  8004bc:	83 ec 08             	sub    $0x8,%esp
+  8004bf:	56                   	push   %esi
+  8004c0:	ff 75 18             	push   0x18(%ebp)
+  8004c3:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004c5:	83 c4 10             	add    $0x10,%esp
+  8004c8:	83 ef 01             	sub    $0x1,%edi
+  8004cb:	75 ef                	jne    8004bc <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004cd:	83 ec 08             	sub    $0x8,%esp
+  8004d0:	56                   	push   %esi
+  8004d1:	83 ec 04             	sub    $0x4,%esp
+  8004d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004d7:	ff 75 e0             	push   -0x20(%ebp)
+  8004da:	ff 75 dc             	push   -0x24(%ebp)
+  8004dd:	ff 75 d8             	push   -0x28(%ebp)
+  8004e0:	e8 2a 37 00 00       	call   803c0f <__umoddi3>
+  8004e5:	83 c4 14             	add    $0x14,%esp
+  8004e8:	0f be 80 af 3e 80 00 	movsbl 0x803eaf(%eax),%eax
+  8004ef:	50                   	push   %eax
+  8004f0:	ff d3                	call   *%ebx
+}
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004f8:	5b                   	pop    %ebx
+  8004f9:	5e                   	pop    %esi
+  8004fa:	5f                   	pop    %edi
+  8004fb:	5d                   	pop    %ebp
+  8004fc:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004fd:	83 ec 0c             	sub    $0xc,%esp
+  800500:	ff 75 18             	push   0x18(%ebp)
+  800503:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800506:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800509:	52                   	push   %edx
+  80050a:	50                   	push   %eax
+  80050b:	83 ec 08             	sub    $0x8,%esp
+  80050e:	ff 75 e4             	push   -0x1c(%ebp)
+  800511:	ff 75 e0             	push   -0x20(%ebp)
+  800514:	ff 75 dc             	push   -0x24(%ebp)
+  800517:	ff 75 d8             	push   -0x28(%ebp)
+  80051a:	e8 2a 36 00 00       	call   803b49 <__udivdi3>
+  80051f:	83 c4 18             	add    $0x18,%esp
+  800522:	52                   	push   %edx
+  800523:	50                   	push   %eax
+  800524:	89 f2                	mov    %esi,%edx
+  800526:	89 d8                	mov    %ebx,%eax
+  800528:	e8 54 ff ff ff       	call   800481 <printnum>
+  80052d:	83 c4 20             	add    $0x20,%esp
+  800530:	eb 9b                	jmp    8004cd <printnum+0x4c>
+
+00800532 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800532:	55                   	push   %ebp
+  800533:	89 e5                	mov    %esp,%ebp
+  800535:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800538:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80053c:	8b 10                	mov    (%eax),%edx
+  80053e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800541:	73 0a                	jae    80054d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800543:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800546:	89 08                	mov    %ecx,(%eax)
+  800548:	8b 45 08             	mov    0x8(%ebp),%eax
+  80054b:	88 02                	mov    %al,(%edx)
+}
+  80054d:	5d                   	pop    %ebp
+  80054e:	c3                   	ret
+
+0080054f <printfmt>:
+{
+  80054f:	55                   	push   %ebp
+  800550:	89 e5                	mov    %esp,%ebp
+  800552:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800555:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800558:	50                   	push   %eax
+  800559:	ff 75 10             	push   0x10(%ebp)
+  80055c:	ff 75 0c             	push   0xc(%ebp)
+  80055f:	ff 75 08             	push   0x8(%ebp)
+  800562:	e8 05 00 00 00       	call   80056c <vprintfmt>
+}
+  800567:	83 c4 10             	add    $0x10,%esp
+  80056a:	c9                   	leave
+  80056b:	c3                   	ret
+
+0080056c <vprintfmt>:
+{
+  80056c:	55                   	push   %ebp
+  80056d:	89 e5                	mov    %esp,%ebp
+  80056f:	57                   	push   %edi
+  800570:	56                   	push   %esi
+  800571:	53                   	push   %ebx
+  800572:	83 ec 2c             	sub    $0x2c,%esp
+  800575:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800578:	89 df                	mov    %ebx,%edi
+  80057a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80057d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800580:	8d 70 01             	lea    0x1(%eax),%esi
+  800583:	0f b6 00             	movzbl (%eax),%eax
+  800586:	83 f8 25             	cmp    $0x25,%eax
+  800589:	74 1e                	je     8005a9 <vprintfmt+0x3d>
+			if (ch == '\0')
+  80058b:	85 c0                	test   %eax,%eax
+  80058d:	0f 84 15 05 00 00    	je     800aa8 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	50                   	push   %eax
+  800598:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80059a:	83 c6 01             	add    $0x1,%esi
+  80059d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005a1:	83 c4 10             	add    $0x10,%esp
+  8005a4:	83 f8 25             	cmp    $0x25,%eax
+  8005a7:	75 e2                	jne    80058b <vprintfmt+0x1f>
+		padc = ' ';
+  8005a9:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8005ad:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005b4:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8005bb:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8005c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ca:	8d 56 01             	lea    0x1(%esi),%edx
+  8005cd:	0f b6 0e             	movzbl (%esi),%ecx
+  8005d0:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005d3:	3c 55                	cmp    $0x55,%al
+  8005d5:	0f 87 3b 04 00 00    	ja     800a16 <vprintfmt+0x4aa>
+  8005db:	0f b6 c0             	movzbl %al,%eax
+  8005de:	ff 24 85 20 40 80 00 	jmp    *0x804020(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8005e5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8005e8:	eb 93                	jmp    80057d <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ea:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8005ec:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8005f0:	eb d8                	jmp    8005ca <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f2:	89 d6                	mov    %edx,%esi
+  8005f4:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8005f8:	eb d0                	jmp    8005ca <vprintfmt+0x5e>
+  8005fa:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8005fd:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800600:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800603:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800607:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80060a:	83 f9 09             	cmp    $0x9,%ecx
+  80060d:	77 6f                	ja     80067e <vprintfmt+0x112>
+  80060f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800612:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800615:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800618:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80061c:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80061f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800622:	83 fe 09             	cmp    $0x9,%esi
+  800625:	76 eb                	jbe    800612 <vprintfmt+0xa6>
+  800627:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80062a:	89 d6                	mov    %edx,%esi
+  80062c:	eb 13                	jmp    800641 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 00                	mov    (%eax),%eax
+  800633:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 40 04             	lea    0x4(%eax),%eax
+  80063c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80063f:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800641:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800645:	79 83                	jns    8005ca <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800647:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80064a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80064d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800654:	e9 71 ff ff ff       	jmp    8005ca <vprintfmt+0x5e>
+			if (width < 0)
+  800659:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800663:	0f 49 c1             	cmovns %ecx,%eax
+  800666:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800669:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80066b:	e9 5a ff ff ff       	jmp    8005ca <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800670:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800672:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800679:	e9 4c ff ff ff       	jmp    8005ca <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80067e:	89 d6                	mov    %edx,%esi
+  800680:	eb bf                	jmp    800641 <vprintfmt+0xd5>
+			lflag++;
+  800682:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800686:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800688:	e9 3d ff ff ff       	jmp    8005ca <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80068d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800690:	8b 45 14             	mov    0x14(%ebp),%eax
+  800693:	8d 70 04             	lea    0x4(%eax),%esi
+  800696:	83 ec 08             	sub    $0x8,%esp
+  800699:	53                   	push   %ebx
+  80069a:	ff 30                	push   (%eax)
+  80069c:	ff d7                	call   *%edi
+			break;
+  80069e:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006a1:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8006a4:	e9 d4 fe ff ff       	jmp    80057d <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8006a9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8006b2:	8b 10                	mov    (%eax),%edx
+  8006b4:	89 d0                	mov    %edx,%eax
+  8006b6:	f7 d8                	neg    %eax
+  8006b8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006bb:	83 f8 12             	cmp    $0x12,%eax
+  8006be:	7f 23                	jg     8006e3 <vprintfmt+0x177>
+  8006c0:	8b 14 85 80 41 80 00 	mov    0x804180(,%eax,4),%edx
+  8006c7:	85 d2                	test   %edx,%edx
+  8006c9:	74 18                	je     8006e3 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006cb:	52                   	push   %edx
+  8006cc:	68 db 42 80 00       	push   $0x8042db
+  8006d1:	53                   	push   %ebx
+  8006d2:	57                   	push   %edi
+  8006d3:	e8 77 fe ff ff       	call   80054f <printfmt>
+  8006d8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006db:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006de:	e9 9a fe ff ff       	jmp    80057d <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8006e3:	50                   	push   %eax
+  8006e4:	68 c7 3e 80 00       	push   $0x803ec7
+  8006e9:	53                   	push   %ebx
+  8006ea:	57                   	push   %edi
+  8006eb:	e8 5f fe ff ff       	call   80054f <printfmt>
+  8006f0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006f3:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8006f6:	e9 82 fe ff ff       	jmp    80057d <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006fb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	83 c0 04             	add    $0x4,%eax
+  800704:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 00                	mov    (%eax),%eax
+  80070c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80070f:	85 c0                	test   %eax,%eax
+  800711:	0f 84 61 03 00 00    	je     800a78 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800717:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80071b:	7e 06                	jle    800723 <vprintfmt+0x1b7>
+  80071d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800721:	75 29                	jne    80074c <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800723:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800726:	8d 70 01             	lea    0x1(%eax),%esi
+  800729:	0f b6 00             	movzbl (%eax),%eax
+  80072c:	0f be d0             	movsbl %al,%edx
+  80072f:	85 d2                	test   %edx,%edx
+  800731:	0f 84 bb 00 00 00    	je     8007f2 <vprintfmt+0x286>
+  800737:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80073a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80073d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800740:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800743:	eb 7a                	jmp    8007bf <vprintfmt+0x253>
+				p = "(null)";
+  800745:	c7 45 d0 c0 3e 80 00 	movl   $0x803ec0,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80074c:	83 ec 08             	sub    $0x8,%esp
+  80074f:	ff 75 d4             	push   -0x2c(%ebp)
+  800752:	ff 75 d0             	push   -0x30(%ebp)
+  800755:	e8 e0 03 00 00       	call   800b3a <strnlen>
+  80075a:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80075d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 d2                	test   %edx,%edx
+  800765:	0f 8e d6 02 00 00    	jle    800a41 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80076b:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80076f:	83 ec 08             	sub    $0x8,%esp
+  800772:	53                   	push   %ebx
+  800773:	56                   	push   %esi
+  800774:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800776:	83 c4 10             	add    $0x10,%esp
+  800779:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80077d:	75 f0                	jne    80076f <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80077f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800782:	8d 70 01             	lea    0x1(%eax),%esi
+  800785:	0f b6 00             	movzbl (%eax),%eax
+  800788:	0f be d0             	movsbl %al,%edx
+  80078b:	85 d2                	test   %edx,%edx
+  80078d:	0f 84 da 02 00 00    	je     800a6d <vprintfmt+0x501>
+  800793:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800796:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800799:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80079c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80079f:	eb 1e                	jmp    8007bf <vprintfmt+0x253>
+					putch(ch, putdat);
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  8007a4:	ff 75 0c             	push   0xc(%ebp)
+  8007a7:	52                   	push   %edx
+  8007a8:	ff 55 08             	call   *0x8(%ebp)
+  8007ab:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ae:	83 eb 01             	sub    $0x1,%ebx
+  8007b1:	83 c6 01             	add    $0x1,%esi
+  8007b4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007b8:	0f be d0             	movsbl %al,%edx
+  8007bb:	85 d2                	test   %edx,%edx
+  8007bd:	74 2a                	je     8007e9 <vprintfmt+0x27d>
+  8007bf:	85 ff                	test   %edi,%edi
+  8007c1:	78 05                	js     8007c8 <vprintfmt+0x25c>
+  8007c3:	83 ef 01             	sub    $0x1,%edi
+  8007c6:	78 59                	js     800821 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007c8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007cc:	74 d3                	je     8007a1 <vprintfmt+0x235>
+  8007ce:	0f be c0             	movsbl %al,%eax
+  8007d1:	83 e8 20             	sub    $0x20,%eax
+  8007d4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007d7:	76 c8                	jbe    8007a1 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007d9:	83 ec 08             	sub    $0x8,%esp
+  8007dc:	ff 75 0c             	push   0xc(%ebp)
+  8007df:	6a 3f                	push   $0x3f
+  8007e1:	ff 55 08             	call   *0x8(%ebp)
+  8007e4:	83 c4 10             	add    $0x10,%esp
+  8007e7:	eb c5                	jmp    8007ae <vprintfmt+0x242>
+  8007e9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8007ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8007ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8007f2:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8007f5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007f9:	7e 1b                	jle    800816 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8007fb:	83 ec 08             	sub    $0x8,%esp
+  8007fe:	53                   	push   %ebx
+  8007ff:	6a 20                	push   $0x20
+  800801:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800803:	83 c4 10             	add    $0x10,%esp
+  800806:	83 ee 01             	sub    $0x1,%esi
+  800809:	75 f0                	jne    8007fb <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80080b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80080e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800811:	e9 67 fd ff ff       	jmp    80057d <vprintfmt+0x11>
+  800816:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+  80081c:	e9 5c fd ff ff       	jmp    80057d <vprintfmt+0x11>
+  800821:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800824:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800827:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80082a:	eb c6                	jmp    8007f2 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80082c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80082f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800832:	83 f9 01             	cmp    $0x1,%ecx
+  800835:	7f 1f                	jg     800856 <vprintfmt+0x2ea>
+	else if (lflag)
+  800837:	85 c9                	test   %ecx,%ecx
+  800839:	74 67                	je     8008a2 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80083b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083e:	8b 30                	mov    (%eax),%esi
+  800840:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800843:	89 f0                	mov    %esi,%eax
+  800845:	c1 f8 1f             	sar    $0x1f,%eax
+  800848:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8d 40 04             	lea    0x4(%eax),%eax
+  800851:	89 45 14             	mov    %eax,0x14(%ebp)
+  800854:	eb 17                	jmp    80086d <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800856:	8b 45 14             	mov    0x14(%ebp),%eax
+  800859:	8b 50 04             	mov    0x4(%eax),%edx
+  80085c:	8b 00                	mov    (%eax),%eax
+  80085e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800861:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8d 40 08             	lea    0x8(%eax),%eax
+  80086a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80086d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800870:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800873:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800878:	85 c9                	test   %ecx,%ecx
+  80087a:	0f 89 12 01 00 00    	jns    800992 <vprintfmt+0x426>
+				putch('-', putdat);
+  800880:	83 ec 08             	sub    $0x8,%esp
+  800883:	53                   	push   %ebx
+  800884:	6a 2d                	push   $0x2d
+  800886:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800888:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80088b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80088e:	f7 da                	neg    %edx
+  800890:	83 d1 00             	adc    $0x0,%ecx
+  800893:	f7 d9                	neg    %ecx
+  800895:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800898:	be 0a 00 00 00       	mov    $0xa,%esi
+  80089d:	e9 f0 00 00 00       	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 30                	mov    (%eax),%esi
+  8008a7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008aa:	89 f0                	mov    %esi,%eax
+  8008ac:	c1 f8 1f             	sar    $0x1f,%eax
+  8008af:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008bb:	eb b0                	jmp    80086d <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008bd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008c0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c3:	83 f9 01             	cmp    $0x1,%ecx
+  8008c6:	7f 1e                	jg     8008e6 <vprintfmt+0x37a>
+	else if (lflag)
+  8008c8:	85 c9                	test   %ecx,%ecx
+  8008ca:	74 32                	je     8008fe <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008cf:	8b 10                	mov    (%eax),%edx
+  8008d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008dc:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8008e1:	e9 ac 00 00 00       	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e9:	8b 10                	mov    (%eax),%edx
+  8008eb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008f4:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8008f9:	e9 94 00 00 00       	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800901:	8b 10                	mov    (%eax),%edx
+  800903:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800908:	8d 40 04             	lea    0x4(%eax),%eax
+  80090b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80090e:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800913:	eb 7d                	jmp    800992 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800915:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800918:	89 55 10             	mov    %edx,0x10(%ebp)
+  80091b:	83 f9 01             	cmp    $0x1,%ecx
+  80091e:	7f 1b                	jg     80093b <vprintfmt+0x3cf>
+	else if (lflag)
+  800920:	85 c9                	test   %ecx,%ecx
+  800922:	74 2c                	je     800950 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092e:	8d 40 04             	lea    0x4(%eax),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800934:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800939:	eb 57                	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80093b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093e:	8b 10                	mov    (%eax),%edx
+  800940:	8b 48 04             	mov    0x4(%eax),%ecx
+  800943:	8d 40 08             	lea    0x8(%eax),%eax
+  800946:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800949:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80094e:	eb 42                	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800950:	8b 45 14             	mov    0x14(%ebp),%eax
+  800953:	8b 10                	mov    (%eax),%edx
+  800955:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80095a:	8d 40 04             	lea    0x4(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800960:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800965:	eb 2b                	jmp    800992 <vprintfmt+0x426>
+			putch('0', putdat);
+  800967:	89 55 10             	mov    %edx,0x10(%ebp)
+  80096a:	83 ec 08             	sub    $0x8,%esp
+  80096d:	53                   	push   %ebx
+  80096e:	6a 30                	push   $0x30
+  800970:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800972:	83 c4 08             	add    $0x8,%esp
+  800975:	53                   	push   %ebx
+  800976:	6a 78                	push   $0x78
+  800978:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80097a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80097d:	8b 10                	mov    (%eax),%edx
+  80097f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800984:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800987:	8d 40 04             	lea    0x4(%eax),%eax
+  80098a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80098d:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800992:	83 ec 0c             	sub    $0xc,%esp
+  800995:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800999:	50                   	push   %eax
+  80099a:	ff 75 e4             	push   -0x1c(%ebp)
+  80099d:	56                   	push   %esi
+  80099e:	51                   	push   %ecx
+  80099f:	52                   	push   %edx
+  8009a0:	89 da                	mov    %ebx,%edx
+  8009a2:	89 f8                	mov    %edi,%eax
+  8009a4:	e8 d8 fa ff ff       	call   800481 <printnum>
+			break;
+  8009a9:	83 c4 20             	add    $0x20,%esp
+  8009ac:	e9 cc fb ff ff       	jmp    80057d <vprintfmt+0x11>
+	if (lflag >= 2)
+  8009b1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009b7:	83 f9 01             	cmp    $0x1,%ecx
+  8009ba:	7f 1b                	jg     8009d7 <vprintfmt+0x46b>
+	else if (lflag)
+  8009bc:	85 c9                	test   %ecx,%ecx
+  8009be:	74 2c                	je     8009ec <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8009c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c3:	8b 10                	mov    (%eax),%edx
+  8009c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8009cd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009d0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009d5:	eb bb                	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009da:	8b 10                	mov    (%eax),%edx
+  8009dc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009df:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009e5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8009ea:	eb a6                	jmp    800992 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8009ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ef:	8b 10                	mov    (%eax),%edx
+  8009f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009fc:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a01:	eb 8f                	jmp    800992 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a03:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a06:	83 ec 08             	sub    $0x8,%esp
+  800a09:	53                   	push   %ebx
+  800a0a:	6a 25                	push   $0x25
+  800a0c:	ff d7                	call   *%edi
+			break;
+  800a0e:	83 c4 10             	add    $0x10,%esp
+  800a11:	e9 67 fb ff ff       	jmp    80057d <vprintfmt+0x11>
+			putch('%', putdat);
+  800a16:	83 ec 08             	sub    $0x8,%esp
+  800a19:	53                   	push   %ebx
+  800a1a:	6a 25                	push   $0x25
+  800a1c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a1e:	83 c4 10             	add    $0x10,%esp
+  800a21:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a25:	0f 84 ba fb ff ff    	je     8005e5 <vprintfmt+0x79>
+  800a2b:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a2e:	89 f0                	mov    %esi,%eax
+  800a30:	83 e8 01             	sub    $0x1,%eax
+  800a33:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a37:	75 f7                	jne    800a30 <vprintfmt+0x4c4>
+  800a39:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a3c:	e9 3c fb ff ff       	jmp    80057d <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a41:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a44:	8d 70 01             	lea    0x1(%eax),%esi
+  800a47:	0f b6 00             	movzbl (%eax),%eax
+  800a4a:	0f be d0             	movsbl %al,%edx
+  800a4d:	85 d2                	test   %edx,%edx
+  800a4f:	74 11                	je     800a62 <vprintfmt+0x4f6>
+  800a51:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a54:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a57:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a5a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a5d:	e9 5d fd ff ff       	jmp    8007bf <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a62:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a65:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a68:	e9 10 fb ff ff       	jmp    80057d <vprintfmt+0x11>
+  800a6d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a70:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a73:	e9 05 fb ff ff       	jmp    80057d <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a78:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a7c:	7e 0a                	jle    800a88 <vprintfmt+0x51c>
+  800a7e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800a82:	0f 85 bd fc ff ff    	jne    800745 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a88:	ba 28 00 00 00       	mov    $0x28,%edx
+  800a8d:	b8 28 00 00 00       	mov    $0x28,%eax
+  800a92:	be c1 3e 80 00       	mov    $0x803ec1,%esi
+  800a97:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a9a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a9d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800aa0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800aa3:	e9 17 fd ff ff       	jmp    8007bf <vprintfmt+0x253>
+}
+  800aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5f                   	pop    %edi
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	83 ec 18             	sub    $0x18,%esp
+  800ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800abc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800abf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ac3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ac6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800acd:	85 c0                	test   %eax,%eax
+  800acf:	74 26                	je     800af7 <vsnprintf+0x47>
+  800ad1:	85 d2                	test   %edx,%edx
+  800ad3:	7e 22                	jle    800af7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ad5:	ff 75 14             	push   0x14(%ebp)
+  800ad8:	ff 75 10             	push   0x10(%ebp)
+  800adb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ade:	50                   	push   %eax
+  800adf:	68 32 05 80 00       	push   $0x800532
+  800ae4:	e8 83 fa ff ff       	call   80056c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ae9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800aec:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800aef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800af2:	83 c4 10             	add    $0x10,%esp
+}
+  800af5:	c9                   	leave
+  800af6:	c3                   	ret
+		return -E_INVAL;
+  800af7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800afc:	eb f7                	jmp    800af5 <vsnprintf+0x45>
+
+00800afe <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b04:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b07:	50                   	push   %eax
+  800b08:	ff 75 10             	push   0x10(%ebp)
+  800b0b:	ff 75 0c             	push   0xc(%ebp)
+  800b0e:	ff 75 08             	push   0x8(%ebp)
+  800b11:	e8 9a ff ff ff       	call   800ab0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b16:	c9                   	leave
+  800b17:	c3                   	ret
+
+00800b18 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b18:	55                   	push   %ebp
+  800b19:	89 e5                	mov    %esp,%ebp
+  800b1b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b1e:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b21:	74 10                	je     800b33 <strlen+0x1b>
+  800b23:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b28:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b2b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b2f:	75 f7                	jne    800b28 <strlen+0x10>
+	return n;
+}
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b33:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b38:	eb f7                	jmp    800b31 <strlen+0x19>
+
+00800b3a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b40:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b43:	85 d2                	test   %edx,%edx
+  800b45:	74 16                	je     800b5d <strnlen+0x23>
+  800b47:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b50:	74 09                	je     800b5b <strnlen+0x21>
+		n++;
+  800b52:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b55:	39 d0                	cmp    %edx,%eax
+  800b57:	75 f3                	jne    800b4c <strnlen+0x12>
+		n++;
+  800b59:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b5b:	5d                   	pop    %ebp
+  800b5c:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b62:	eb f7                	jmp    800b5b <strnlen+0x21>
+
+00800b64 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	53                   	push   %ebx
+  800b68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b6b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b73:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b77:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b7a:	83 c0 01             	add    $0x1,%eax
+  800b7d:	84 d2                	test   %dl,%dl
+  800b7f:	75 f2                	jne    800b73 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800b81:	89 c8                	mov    %ecx,%eax
+  800b83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b86:	c9                   	leave
+  800b87:	c3                   	ret
+
+00800b88 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	53                   	push   %ebx
+  800b8c:	83 ec 10             	sub    $0x10,%esp
+  800b8f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800b92:	53                   	push   %ebx
+  800b93:	e8 80 ff ff ff       	call   800b18 <strlen>
+  800b98:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800b9b:	ff 75 0c             	push   0xc(%ebp)
+  800b9e:	01 d8                	add    %ebx,%eax
+  800ba0:	50                   	push   %eax
+  800ba1:	e8 be ff ff ff       	call   800b64 <strcpy>
+	return dst;
+}
+  800ba6:	89 d8                	mov    %ebx,%eax
+  800ba8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bab:	c9                   	leave
+  800bac:	c3                   	ret
+
+00800bad <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bad:	55                   	push   %ebp
+  800bae:	89 e5                	mov    %esp,%ebp
+  800bb0:	56                   	push   %esi
+  800bb1:	53                   	push   %ebx
+  800bb2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bbb:	85 db                	test   %ebx,%ebx
+  800bbd:	74 17                	je     800bd6 <strncpy+0x29>
+  800bbf:	01 f3                	add    %esi,%ebx
+  800bc1:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800bc3:	83 c0 01             	add    $0x1,%eax
+  800bc6:	0f b6 0a             	movzbl (%edx),%ecx
+  800bc9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bcc:	80 f9 01             	cmp    $0x1,%cl
+  800bcf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bd2:	39 c3                	cmp    %eax,%ebx
+  800bd4:	75 ed                	jne    800bc3 <strncpy+0x16>
+	}
+	return ret;
+}
+  800bd6:	89 f0                	mov    %esi,%eax
+  800bd8:	5b                   	pop    %ebx
+  800bd9:	5e                   	pop    %esi
+  800bda:	5d                   	pop    %ebp
+  800bdb:	c3                   	ret
+
+00800bdc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bdc:	55                   	push   %ebp
+  800bdd:	89 e5                	mov    %esp,%ebp
+  800bdf:	56                   	push   %esi
+  800be0:	53                   	push   %ebx
+  800be1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800be4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800bea:	89 f0                	mov    %esi,%eax
+  800bec:	85 db                	test   %ebx,%ebx
+  800bee:	74 1e                	je     800c0e <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800bf0:	83 eb 01             	sub    $0x1,%ebx
+  800bf3:	74 16                	je     800c0b <strlcpy+0x2f>
+  800bf5:	01 f3                	add    %esi,%ebx
+  800bf7:	0f b6 0a             	movzbl (%edx),%ecx
+  800bfa:	84 c9                	test   %cl,%cl
+  800bfc:	74 0d                	je     800c0b <strlcpy+0x2f>
+			*dst++ = *src++;
+  800bfe:	83 c2 01             	add    $0x1,%edx
+  800c01:	83 c0 01             	add    $0x1,%eax
+  800c04:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c07:	39 d8                	cmp    %ebx,%eax
+  800c09:	75 ec                	jne    800bf7 <strlcpy+0x1b>
+		*dst = '\0';
+  800c0b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c0e:	29 f0                	sub    %esi,%eax
+}
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5d                   	pop    %ebp
+  800c13:	c3                   	ret
+
+00800c14 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c14:	55                   	push   %ebp
+  800c15:	89 e5                	mov    %esp,%ebp
+  800c17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c1d:	0f b6 01             	movzbl (%ecx),%eax
+  800c20:	84 c0                	test   %al,%al
+  800c22:	74 11                	je     800c35 <strcmp+0x21>
+  800c24:	38 02                	cmp    %al,(%edx)
+  800c26:	75 0d                	jne    800c35 <strcmp+0x21>
+		p++, q++;
+  800c28:	83 c1 01             	add    $0x1,%ecx
+  800c2b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c2e:	0f b6 01             	movzbl (%ecx),%eax
+  800c31:	84 c0                	test   %al,%al
+  800c33:	75 ef                	jne    800c24 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c35:	0f b6 c0             	movzbl %al,%eax
+  800c38:	0f b6 12             	movzbl (%edx),%edx
+  800c3b:	29 d0                	sub    %edx,%eax
+}
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+
+00800c3f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	53                   	push   %ebx
+  800c43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c46:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c49:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c51:	85 d2                	test   %edx,%edx
+  800c53:	74 2e                	je     800c83 <strncmp+0x44>
+  800c55:	0f b6 01             	movzbl (%ecx),%eax
+  800c58:	84 c0                	test   %al,%al
+  800c5a:	74 16                	je     800c72 <strncmp+0x33>
+  800c5c:	3a 03                	cmp    (%ebx),%al
+  800c5e:	75 12                	jne    800c72 <strncmp+0x33>
+		n--, p++, q++;
+  800c60:	83 c1 01             	add    $0x1,%ecx
+  800c63:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c66:	83 ea 01             	sub    $0x1,%edx
+  800c69:	75 ea                	jne    800c55 <strncmp+0x16>
+		return 0;
+  800c6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c70:	eb 11                	jmp    800c83 <strncmp+0x44>
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c77:	85 d2                	test   %edx,%edx
+  800c79:	74 08                	je     800c83 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c7b:	0f b6 01             	movzbl (%ecx),%eax
+  800c7e:	0f b6 13             	movzbl (%ebx),%edx
+  800c81:	29 d0                	sub    %edx,%eax
+}
+  800c83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c86:	c9                   	leave
+  800c87:	c3                   	ret
+
+00800c88 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800c92:	0f b6 10             	movzbl (%eax),%edx
+  800c95:	84 d2                	test   %dl,%dl
+  800c97:	74 15                	je     800cae <strchr+0x26>
+		if (*s == c)
+  800c99:	38 d1                	cmp    %dl,%cl
+  800c9b:	74 0f                	je     800cac <strchr+0x24>
+	for (; *s; s++)
+  800c9d:	83 c0 01             	add    $0x1,%eax
+  800ca0:	0f b6 10             	movzbl (%eax),%edx
+  800ca3:	84 d2                	test   %dl,%dl
+  800ca5:	75 f2                	jne    800c99 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+	return 0;
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb3:	eb f7                	jmp    800cac <strchr+0x24>
+
+00800cb5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	53                   	push   %ebx
+  800cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800cbf:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800cc2:	38 d3                	cmp    %dl,%bl
+  800cc4:	74 14                	je     800cda <strfind+0x25>
+  800cc6:	89 d1                	mov    %edx,%ecx
+  800cc8:	84 db                	test   %bl,%bl
+  800cca:	74 0e                	je     800cda <strfind+0x25>
+	for (; *s; s++)
+  800ccc:	83 c0 01             	add    $0x1,%eax
+  800ccf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cd2:	38 ca                	cmp    %cl,%dl
+  800cd4:	74 04                	je     800cda <strfind+0x25>
+  800cd6:	84 d2                	test   %dl,%dl
+  800cd8:	75 f2                	jne    800ccc <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cdd:	c9                   	leave
+  800cde:	c3                   	ret
+
+00800cdf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	57                   	push   %edi
+  800ce3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ce6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ce9:	85 c9                	test   %ecx,%ecx
+  800ceb:	74 20                	je     800d0d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ced:	89 f8                	mov    %edi,%eax
+  800cef:	09 c8                	or     %ecx,%eax
+  800cf1:	a8 03                	test   $0x3,%al
+  800cf3:	75 12                	jne    800d07 <memset+0x28>
+		c &= 0xFF;
+  800cf5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cf9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800cff:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d02:	fc                   	cld
+  800d03:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d05:	eb 06                	jmp    800d0d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d07:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d0a:	fc                   	cld
+  800d0b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d0d:	89 f8                	mov    %edi,%eax
+  800d0f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d12:	c9                   	leave
+  800d13:	c3                   	ret
+
+00800d14 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d14:	55                   	push   %ebp
+  800d15:	89 e5                	mov    %esp,%ebp
+  800d17:	57                   	push   %edi
+  800d18:	56                   	push   %esi
+  800d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d1f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d22:	39 c6                	cmp    %eax,%esi
+  800d24:	73 32                	jae    800d58 <memmove+0x44>
+  800d26:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d29:	39 d0                	cmp    %edx,%eax
+  800d2b:	73 2b                	jae    800d58 <memmove+0x44>
+		s += n;
+		d += n;
+  800d2d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d30:	89 d6                	mov    %edx,%esi
+  800d32:	09 fe                	or     %edi,%esi
+  800d34:	09 ce                	or     %ecx,%esi
+  800d36:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d3c:	75 0e                	jne    800d4c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d3e:	83 ef 04             	sub    $0x4,%edi
+  800d41:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d44:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d47:	fd                   	std
+  800d48:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d4a:	eb 09                	jmp    800d55 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d4c:	83 ef 01             	sub    $0x1,%edi
+  800d4f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d52:	fd                   	std
+  800d53:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d55:	fc                   	cld
+  800d56:	eb 1a                	jmp    800d72 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d58:	89 f2                	mov    %esi,%edx
+  800d5a:	09 c2                	or     %eax,%edx
+  800d5c:	09 ca                	or     %ecx,%edx
+  800d5e:	f6 c2 03             	test   $0x3,%dl
+  800d61:	75 0a                	jne    800d6d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d63:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d66:	89 c7                	mov    %eax,%edi
+  800d68:	fc                   	cld
+  800d69:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d6b:	eb 05                	jmp    800d72 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d6d:	89 c7                	mov    %eax,%edi
+  800d6f:	fc                   	cld
+  800d70:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d72:	5e                   	pop    %esi
+  800d73:	5f                   	pop    %edi
+  800d74:	5d                   	pop    %ebp
+  800d75:	c3                   	ret
+
+00800d76 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d7c:	ff 75 10             	push   0x10(%ebp)
+  800d7f:	ff 75 0c             	push   0xc(%ebp)
+  800d82:	ff 75 08             	push   0x8(%ebp)
+  800d85:	e8 8a ff ff ff       	call   800d14 <memmove>
+}
+  800d8a:	c9                   	leave
+  800d8b:	c3                   	ret
+
+00800d8c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	56                   	push   %esi
+  800d90:	53                   	push   %ebx
+  800d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d97:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800d9a:	85 f6                	test   %esi,%esi
+  800d9c:	74 29                	je     800dc7 <memcmp+0x3b>
+  800d9e:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800da0:	0f b6 08             	movzbl (%eax),%ecx
+  800da3:	0f b6 1a             	movzbl (%edx),%ebx
+  800da6:	38 d9                	cmp    %bl,%cl
+  800da8:	75 11                	jne    800dbb <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800daa:	83 c0 01             	add    $0x1,%eax
+  800dad:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800db0:	39 c6                	cmp    %eax,%esi
+  800db2:	75 ec                	jne    800da0 <memcmp+0x14>
+	}
+
+	return 0;
+  800db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db9:	eb 08                	jmp    800dc3 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800dbb:	0f b6 c1             	movzbl %cl,%eax
+  800dbe:	0f b6 db             	movzbl %bl,%ebx
+  800dc1:	29 d8                	sub    %ebx,%eax
+}
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5d                   	pop    %ebp
+  800dc6:	c3                   	ret
+	return 0;
+  800dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcc:	eb f5                	jmp    800dc3 <memcmp+0x37>
+
+00800dce <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dd7:	89 c2                	mov    %eax,%edx
+  800dd9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ddc:	39 d0                	cmp    %edx,%eax
+  800dde:	73 0d                	jae    800ded <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800de0:	38 08                	cmp    %cl,(%eax)
+  800de2:	74 0d                	je     800df1 <memfind+0x23>
+	for (; s < ends; s++)
+  800de4:	83 c0 01             	add    $0x1,%eax
+  800de7:	39 c2                	cmp    %eax,%edx
+  800de9:	75 f5                	jne    800de0 <memfind+0x12>
+  800deb:	eb 06                	jmp    800df3 <memfind+0x25>
+  800ded:	89 c2                	mov    %eax,%edx
+  800def:	eb 02                	jmp    800df3 <memfind+0x25>
+  800df1:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800df3:	89 d0                	mov    %edx,%eax
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+
+00800df7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	57                   	push   %edi
+  800dfb:	56                   	push   %esi
+  800dfc:	53                   	push   %ebx
+  800dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e03:	0f b6 02             	movzbl (%edx),%eax
+  800e06:	3c 20                	cmp    $0x20,%al
+  800e08:	74 04                	je     800e0e <strtol+0x17>
+  800e0a:	3c 09                	cmp    $0x9,%al
+  800e0c:	75 0e                	jne    800e1c <strtol+0x25>
+		s++;
+  800e0e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e11:	0f b6 02             	movzbl (%edx),%eax
+  800e14:	3c 20                	cmp    $0x20,%al
+  800e16:	74 f6                	je     800e0e <strtol+0x17>
+  800e18:	3c 09                	cmp    $0x9,%al
+  800e1a:	74 f2                	je     800e0e <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e1c:	3c 2b                	cmp    $0x2b,%al
+  800e1e:	74 2a                	je     800e4a <strtol+0x53>
+	int neg = 0;
+  800e20:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e25:	3c 2d                	cmp    $0x2d,%al
+  800e27:	74 2b                	je     800e54 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e29:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e2f:	75 0f                	jne    800e40 <strtol+0x49>
+  800e31:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e34:	74 28                	je     800e5e <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e36:	85 db                	test   %ebx,%ebx
+  800e38:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e3d:	0f 44 d8             	cmove  %eax,%ebx
+  800e40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e45:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e48:	eb 46                	jmp    800e90 <strtol+0x99>
+		s++;
+  800e4a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e52:	eb d5                	jmp    800e29 <strtol+0x32>
+		s++, neg = 1;
+  800e54:	83 c2 01             	add    $0x1,%edx
+  800e57:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e5c:	eb cb                	jmp    800e29 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e5e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e62:	74 0e                	je     800e72 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e64:	85 db                	test   %ebx,%ebx
+  800e66:	75 d8                	jne    800e40 <strtol+0x49>
+		s++, base = 8;
+  800e68:	83 c2 01             	add    $0x1,%edx
+  800e6b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e70:	eb ce                	jmp    800e40 <strtol+0x49>
+		s += 2, base = 16;
+  800e72:	83 c2 02             	add    $0x2,%edx
+  800e75:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e7a:	eb c4                	jmp    800e40 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e7c:	0f be c0             	movsbl %al,%eax
+  800e7f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e82:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e85:	7d 3a                	jge    800ec1 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800e87:	83 c2 01             	add    $0x1,%edx
+  800e8a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e8e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e90:	0f b6 02             	movzbl (%edx),%eax
+  800e93:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e96:	89 f3                	mov    %esi,%ebx
+  800e98:	80 fb 09             	cmp    $0x9,%bl
+  800e9b:	76 df                	jbe    800e7c <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800e9d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ea0:	89 f3                	mov    %esi,%ebx
+  800ea2:	80 fb 19             	cmp    $0x19,%bl
+  800ea5:	77 08                	ja     800eaf <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800ea7:	0f be c0             	movsbl %al,%eax
+  800eaa:	83 e8 57             	sub    $0x57,%eax
+  800ead:	eb d3                	jmp    800e82 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eaf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800eb2:	89 f3                	mov    %esi,%ebx
+  800eb4:	80 fb 19             	cmp    $0x19,%bl
+  800eb7:	77 08                	ja     800ec1 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800eb9:	0f be c0             	movsbl %al,%eax
+  800ebc:	83 e8 37             	sub    $0x37,%eax
+  800ebf:	eb c1                	jmp    800e82 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ec5:	74 05                	je     800ecc <strtol+0xd5>
+		*endptr = (char *) s;
+  800ec7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eca:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ecc:	89 c8                	mov    %ecx,%eax
+  800ece:	f7 d8                	neg    %eax
+  800ed0:	85 ff                	test   %edi,%edi
+  800ed2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ed5:	89 c8                	mov    %ecx,%eax
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+
+00800edc <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800edc:	55                   	push   %ebp
+  800edd:	89 e5                	mov    %esp,%ebp
+  800edf:	57                   	push   %edi
+  800ee0:	56                   	push   %esi
+  800ee1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eed:	89 c3                	mov    %eax,%ebx
+  800eef:	89 c7                	mov    %eax,%edi
+  800ef1:	89 c6                	mov    %eax,%esi
+  800ef3:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+
+00800efa <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f05:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f0a:	89 d1                	mov    %edx,%ecx
+  800f0c:	89 d3                	mov    %edx,%ebx
+  800f0e:	89 d7                	mov    %edx,%edi
+  800f10:	89 d6                	mov    %edx,%esi
+  800f12:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f2f:	89 cb                	mov    %ecx,%ebx
+  800f31:	89 cf                	mov    %ecx,%edi
+  800f33:	89 ce                	mov    %ecx,%esi
+  800f35:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f37:	85 c0                	test   %eax,%eax
+  800f39:	7f 08                	jg     800f43 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3e:	5b                   	pop    %ebx
+  800f3f:	5e                   	pop    %esi
+  800f40:	5f                   	pop    %edi
+  800f41:	5d                   	pop    %ebp
+  800f42:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f43:	83 ec 0c             	sub    $0xc,%esp
+  800f46:	50                   	push   %eax
+  800f47:	6a 03                	push   $0x3
+  800f49:	68 eb 41 80 00       	push   $0x8041eb
+  800f4e:	6a 23                	push   $0x23
+  800f50:	68 08 42 80 00       	push   $0x804208
+  800f55:	e8 38 f4 ff ff       	call   800392 <_panic>
+
+00800f5a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	57                   	push   %edi
+  800f5e:	56                   	push   %esi
+  800f5f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f60:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f65:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f6a:	89 d1                	mov    %edx,%ecx
+  800f6c:	89 d3                	mov    %edx,%ebx
+  800f6e:	89 d7                	mov    %edx,%edi
+  800f70:	89 d6                	mov    %edx,%esi
+  800f72:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f74:	5b                   	pop    %ebx
+  800f75:	5e                   	pop    %esi
+  800f76:	5f                   	pop    %edi
+  800f77:	5d                   	pop    %ebp
+  800f78:	c3                   	ret
+
+00800f79 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f79:	55                   	push   %ebp
+  800f7a:	89 e5                	mov    %esp,%ebp
+  800f7c:	57                   	push   %edi
+  800f7d:	56                   	push   %esi
+  800f7e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f84:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f89:	89 d1                	mov    %edx,%ecx
+  800f8b:	89 d3                	mov    %edx,%ebx
+  800f8d:	89 d7                	mov    %edx,%edi
+  800f8f:	89 d6                	mov    %edx,%esi
+  800f91:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fac:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb4:	89 f7                	mov    %esi,%edi
+  800fb6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fb8:	85 c0                	test   %eax,%eax
+  800fba:	7f 08                	jg     800fc4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbf:	5b                   	pop    %ebx
+  800fc0:	5e                   	pop    %esi
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 04                	push   $0x4
+  800fca:	68 eb 41 80 00       	push   $0x8041eb
+  800fcf:	6a 23                	push   $0x23
+  800fd1:	68 08 42 80 00       	push   $0x804208
+  800fd6:	e8 b7 f3 ff ff       	call   800392 <_panic>
+
+00800fdb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+  800fe1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fea:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff5:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ffa:	85 c0                	test   %eax,%eax
+  800ffc:	7f 08                	jg     801006 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801001:	5b                   	pop    %ebx
+  801002:	5e                   	pop    %esi
+  801003:	5f                   	pop    %edi
+  801004:	5d                   	pop    %ebp
+  801005:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  801009:	50                   	push   %eax
+  80100a:	6a 05                	push   $0x5
+  80100c:	68 eb 41 80 00       	push   $0x8041eb
+  801011:	6a 23                	push   $0x23
+  801013:	68 08 42 80 00       	push   $0x804208
+  801018:	e8 75 f3 ff ff       	call   800392 <_panic>
+
+0080101d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+  801023:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801026:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	b8 06 00 00 00       	mov    $0x6,%eax
+  801036:	89 df                	mov    %ebx,%edi
+  801038:	89 de                	mov    %ebx,%esi
+  80103a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	7f 08                	jg     801048 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	50                   	push   %eax
+  80104c:	6a 06                	push   $0x6
+  80104e:	68 eb 41 80 00       	push   $0x8041eb
+  801053:	6a 23                	push   $0x23
+  801055:	68 08 42 80 00       	push   $0x804208
+  80105a:	e8 33 f3 ff ff       	call   800392 <_panic>
+
+0080105f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	53                   	push   %ebx
+  801065:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801068:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	b8 08 00 00 00       	mov    $0x8,%eax
+  801078:	89 df                	mov    %ebx,%edi
+  80107a:	89 de                	mov    %ebx,%esi
+  80107c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80107e:	85 c0                	test   %eax,%eax
+  801080:	7f 08                	jg     80108a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801085:	5b                   	pop    %ebx
+  801086:	5e                   	pop    %esi
+  801087:	5f                   	pop    %edi
+  801088:	5d                   	pop    %ebp
+  801089:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	50                   	push   %eax
+  80108e:	6a 08                	push   $0x8
+  801090:	68 eb 41 80 00       	push   $0x8041eb
+  801095:	6a 23                	push   $0x23
+  801097:	68 08 42 80 00       	push   $0x804208
+  80109c:	e8 f1 f2 ff ff       	call   800392 <_panic>
+
+008010a1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 08                	jg     8010cc <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	50                   	push   %eax
+  8010d0:	6a 09                	push   $0x9
+  8010d2:	68 eb 41 80 00       	push   $0x8041eb
+  8010d7:	6a 23                	push   $0x23
+  8010d9:	68 08 42 80 00       	push   $0x804208
+  8010de:	e8 af f2 ff ff       	call   800392 <_panic>
+
+008010e3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	89 de                	mov    %ebx,%esi
+  801100:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 0a                	push   $0xa
+  801114:	68 eb 41 80 00       	push   $0x8041eb
+  801119:	6a 23                	push   $0x23
+  80111b:	68 08 42 80 00       	push   $0x804208
+  801120:	e8 6d f2 ff ff       	call   800392 <_panic>
+
+00801125 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801131:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801136:	be 00 00 00 00       	mov    $0x0,%esi
+  80113b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801141:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  80114e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801156:	8b 55 08             	mov    0x8(%ebp),%edx
+  801159:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80115e:	89 cb                	mov    %ecx,%ebx
+  801160:	89 cf                	mov    %ecx,%edi
+  801162:	89 ce                	mov    %ecx,%esi
+  801164:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801166:	85 c0                	test   %eax,%eax
+  801168:	7f 08                	jg     801172 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80116a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116d:	5b                   	pop    %ebx
+  80116e:	5e                   	pop    %esi
+  80116f:	5f                   	pop    %edi
+  801170:	5d                   	pop    %ebp
+  801171:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	50                   	push   %eax
+  801176:	6a 0d                	push   $0xd
+  801178:	68 eb 41 80 00       	push   $0x8041eb
+  80117d:	6a 23                	push   $0x23
+  80117f:	68 08 42 80 00       	push   $0x804208
+  801184:	e8 09 f2 ff ff       	call   800392 <_panic>
+
+00801189 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801192:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801195:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80119a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+
+008011aa <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8011aa:	55                   	push   %ebp
+  8011ab:	89 e5                	mov    %esp,%ebp
+  8011ad:	57                   	push   %edi
+  8011ae:	56                   	push   %esi
+  8011af:	53                   	push   %ebx
+  8011b0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011be:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011c3:	89 df                	mov    %ebx,%edi
+  8011c5:	89 de                	mov    %ebx,%esi
+  8011c7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c9:	85 c0                	test   %eax,%eax
+  8011cb:	7f 08                	jg     8011d5 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d0:	5b                   	pop    %ebx
+  8011d1:	5e                   	pop    %esi
+  8011d2:	5f                   	pop    %edi
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011d5:	83 ec 0c             	sub    $0xc,%esp
+  8011d8:	50                   	push   %eax
+  8011d9:	6a 0d                	push   $0xd
+  8011db:	68 eb 41 80 00       	push   $0x8041eb
+  8011e0:	6a 23                	push   $0x23
+  8011e2:	68 08 42 80 00       	push   $0x804208
+  8011e7:	e8 a6 f1 ff ff       	call   800392 <_panic>
+
+008011ec <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011fc:	89 d1                	mov    %edx,%ecx
+  8011fe:	89 d3                	mov    %edx,%ebx
+  801200:	89 d7                	mov    %edx,%edi
+  801202:	89 d6                	mov    %edx,%esi
+  801204:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	89 de                	mov    %ebx,%esi
+  801225:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801227:	5b                   	pop    %ebx
+  801228:	5e                   	pop    %esi
+  801229:	5f                   	pop    %edi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+
+0080122c <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801232:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80123f:	89 cb                	mov    %ecx,%ebx
+  801241:	89 cf                	mov    %ecx,%edi
+  801243:	89 ce                	mov    %ecx,%esi
+  801245:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801262:	89 df                	mov    %ebx,%edi
+  801264:	89 de                	mov    %ebx,%esi
+  801266:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801273:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801283:	89 df                	mov    %ebx,%edi
+  801285:	89 de                	mov    %ebx,%esi
+  801287:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+
+0080128e <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	57                   	push   %edi
+  801292:	56                   	push   %esi
+  801293:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801294:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801299:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129c:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012a1:	89 cb                	mov    %ecx,%ebx
+  8012a3:	89 cf                	mov    %ecx,%edi
+  8012a5:	89 ce                	mov    %ecx,%esi
+  8012a7:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012bf:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012c4:	89 df                	mov    %ebx,%edi
+  8012c6:	89 de                	mov    %ebx,%esi
+  8012c8:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012ca:	5b                   	pop    %ebx
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+
+008012cf <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dd:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012e2:	89 cb                	mov    %ecx,%ebx
+  8012e4:	89 cf                	mov    %ecx,%edi
+  8012e6:	89 ce                	mov    %ecx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f5:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801300:	b8 16 00 00 00       	mov    $0x16,%eax
+  801305:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801308:	89 f7                	mov    %esi,%edi
+  80130a:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80130c:	5b                   	pop    %ebx
+  80130d:	5e                   	pop    %esi
+  80130e:	5f                   	pop    %edi
+  80130f:	5d                   	pop    %ebp
+  801310:	c3                   	ret
+
+00801311 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801311:	55                   	push   %ebp
+  801312:	89 e5                	mov    %esp,%ebp
+  801314:	57                   	push   %edi
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801317:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801322:	b8 17 00 00 00       	mov    $0x17,%eax
+  801327:	89 df                	mov    %ebx,%edi
+  801329:	89 de                	mov    %ebx,%esi
+  80132b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80132d:	5b                   	pop    %ebx
+  80132e:	5e                   	pop    %esi
+  80132f:	5f                   	pop    %edi
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+
+00801332 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	57                   	push   %edi
+  801336:	56                   	push   %esi
+  801337:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801338:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801340:	b8 18 00 00 00       	mov    $0x18,%eax
+  801345:	89 cb                	mov    %ecx,%ebx
+  801347:	89 cf                	mov    %ecx,%edi
+  801349:	89 ce                	mov    %ecx,%esi
+  80134b:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+
+00801352 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801358:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80135c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801364:	b8 19 00 00 00       	mov    $0x19,%eax
+  801369:	89 df                	mov    %ebx,%edi
+  80136b:	89 de                	mov    %ebx,%esi
+  80136d:	cd 30                	int    $0x30
+}
+  80136f:	5b                   	pop    %ebx
+  801370:	5e                   	pop    %esi
+  801371:	5f                   	pop    %edi
+  801372:	5d                   	pop    %ebp
+  801373:	c3                   	ret
+
+00801374 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	57                   	push   %edi
+  801378:	56                   	push   %esi
+  801379:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80137a:	be 00 00 00 00       	mov    $0x0,%esi
+  80137f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801382:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801385:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80138a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80138d:	89 f7                	mov    %esi,%edi
+  80138f:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  801391:	5b                   	pop    %ebx
+  801392:	5e                   	pop    %esi
+  801393:	5f                   	pop    %edi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+
+00801396 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013af:	89 f7                	mov    %esi,%edi
+  8013b1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8013b3:	5b                   	pop    %ebx
+  8013b4:	5e                   	pop    %esi
+  8013b5:	5f                   	pop    %edi
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	c3                   	ret
+
+008013b8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013ce:	89 df                	mov    %ebx,%edi
+  8013d0:	89 de                	mov    %ebx,%esi
+  8013d2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013d4:	5b                   	pop    %ebx
+  8013d5:	5e                   	pop    %esi
+  8013d6:	5f                   	pop    %edi
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	c3                   	ret
+
+008013d9 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013df:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ea:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8013ef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f2:	89 f7                	mov    %esi,%edi
+  8013f4:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8013f6:	5b                   	pop    %ebx
+  8013f7:	5e                   	pop    %esi
+  8013f8:	5f                   	pop    %edi
+  8013f9:	5d                   	pop    %ebp
+  8013fa:	c3                   	ret
+
+008013fb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013fb:	55                   	push   %ebp
+  8013fc:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801401:	05 00 00 00 30       	add    $0x30000000,%eax
+  801406:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801409:	5d                   	pop    %ebp
+  80140a:	c3                   	ret
+
+0080140b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80140b:	55                   	push   %ebp
+  80140c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80140e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801411:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801416:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80141b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801420:	5d                   	pop    %ebp
+  801421:	c3                   	ret
+
+00801422 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80142a:	89 c2                	mov    %eax,%edx
+  80142c:	c1 ea 16             	shr    $0x16,%edx
+  80142f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801436:	f6 c2 01             	test   $0x1,%dl
+  801439:	74 29                	je     801464 <fd_alloc+0x42>
+  80143b:	89 c2                	mov    %eax,%edx
+  80143d:	c1 ea 0c             	shr    $0xc,%edx
+  801440:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801447:	f6 c2 01             	test   $0x1,%dl
+  80144a:	74 18                	je     801464 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80144c:	05 00 10 00 00       	add    $0x1000,%eax
+  801451:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801456:	75 d2                	jne    80142a <fd_alloc+0x8>
+  801458:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80145d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801462:	eb 05                	jmp    801469 <fd_alloc+0x47>
+			return 0;
+  801464:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801469:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146c:	89 02                	mov    %eax,(%edx)
+}
+  80146e:	89 c8                	mov    %ecx,%eax
+  801470:	5d                   	pop    %ebp
+  801471:	c3                   	ret
+
+00801472 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801472:	55                   	push   %ebp
+  801473:	89 e5                	mov    %esp,%ebp
+  801475:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801478:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80147d:	77 30                	ja     8014af <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80147f:	c1 e0 0c             	shl    $0xc,%eax
+  801482:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801487:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80148d:	f6 c2 01             	test   $0x1,%dl
+  801490:	74 24                	je     8014b6 <fd_lookup+0x44>
+  801492:	89 c2                	mov    %eax,%edx
+  801494:	c1 ea 0c             	shr    $0xc,%edx
+  801497:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80149e:	f6 c2 01             	test   $0x1,%dl
+  8014a1:	74 1a                	je     8014bd <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8014a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+		return -E_INVAL;
+  8014af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b4:	eb f7                	jmp    8014ad <fd_lookup+0x3b>
+		return -E_INVAL;
+  8014b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014bb:	eb f0                	jmp    8014ad <fd_lookup+0x3b>
+  8014bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014c2:	eb e9                	jmp    8014ad <fd_lookup+0x3b>
+
+008014c4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	53                   	push   %ebx
+  8014c8:	83 ec 04             	sub    $0x4,%esp
+  8014cb:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d3:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8014d8:	39 13                	cmp    %edx,(%ebx)
+  8014da:	74 54                	je     801530 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8014dc:	83 c0 01             	add    $0x1,%eax
+  8014df:	8b 1c 85 94 42 80 00 	mov    0x804294(,%eax,4),%ebx
+  8014e6:	85 db                	test   %ebx,%ebx
+  8014e8:	75 ee                	jne    8014d8 <dev_lookup+0x14>
+  8014ea:	89 e1                	mov    %esp,%ecx
+  8014ec:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8014f1:	29 c8                	sub    %ecx,%eax
+  8014f3:	89 c1                	mov    %eax,%ecx
+  8014f5:	c1 e9 0f             	shr    $0xf,%ecx
+  8014f8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8014fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801502:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801505:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  80150c:	8b 40 48             	mov    0x48(%eax),%eax
+  80150f:	83 ec 04             	sub    $0x4,%esp
+  801512:	52                   	push   %edx
+  801513:	50                   	push   %eax
+  801514:	68 18 42 80 00       	push   $0x804218
+  801519:	e8 4f ef ff ff       	call   80046d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80151e:	83 c4 10             	add    $0x10,%esp
+  801521:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801526:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801529:	89 1a                	mov    %ebx,(%edx)
+}
+  80152b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152e:	c9                   	leave
+  80152f:	c3                   	ret
+			return 0;
+  801530:	b8 00 00 00 00       	mov    $0x0,%eax
+  801535:	eb ef                	jmp    801526 <dev_lookup+0x62>
+
+00801537 <fd_close>:
+{
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	57                   	push   %edi
+  80153b:	56                   	push   %esi
+  80153c:	53                   	push   %ebx
+  80153d:	83 ec 24             	sub    $0x24,%esp
+  801540:	8b 75 08             	mov    0x8(%ebp),%esi
+  801543:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801546:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801549:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80154a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801550:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801553:	50                   	push   %eax
+  801554:	e8 19 ff ff ff       	call   801472 <fd_lookup>
+  801559:	89 c3                	mov    %eax,%ebx
+  80155b:	83 c4 10             	add    $0x10,%esp
+  80155e:	85 c0                	test   %eax,%eax
+  801560:	78 05                	js     801567 <fd_close+0x30>
+	    || fd != fd2)
+  801562:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801565:	74 0f                	je     801576 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801567:	85 ff                	test   %edi,%edi
+  801569:	0f 44 df             	cmove  %edi,%ebx
+}
+  80156c:	89 d8                	mov    %ebx,%eax
+  80156e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801576:	83 ec 08             	sub    $0x8,%esp
+  801579:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80157c:	50                   	push   %eax
+  80157d:	ff 36                	push   (%esi)
+  80157f:	e8 40 ff ff ff       	call   8014c4 <dev_lookup>
+  801584:	89 c3                	mov    %eax,%ebx
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	78 1a                	js     8015a7 <fd_close+0x70>
+		if (dev->dev_close)
+  80158d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801590:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801593:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	74 0b                	je     8015a7 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  80159c:	83 ec 0c             	sub    $0xc,%esp
+  80159f:	56                   	push   %esi
+  8015a0:	ff d0                	call   *%eax
+  8015a2:	89 c3                	mov    %eax,%ebx
+  8015a4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8015a7:	83 ec 08             	sub    $0x8,%esp
+  8015aa:	56                   	push   %esi
+  8015ab:	6a 00                	push   $0x0
+  8015ad:	e8 6b fa ff ff       	call   80101d <sys_page_unmap>
+	return r;
+  8015b2:	83 c4 10             	add    $0x10,%esp
+  8015b5:	eb b5                	jmp    80156c <fd_close+0x35>
+
+008015b7 <close>:
+
+int
+close(int fdnum)
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  8015ba:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c0:	50                   	push   %eax
+  8015c1:	ff 75 08             	push   0x8(%ebp)
+  8015c4:	e8 a9 fe ff ff       	call   801472 <fd_lookup>
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	85 c0                	test   %eax,%eax
+  8015ce:	79 02                	jns    8015d2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015d0:	c9                   	leave
+  8015d1:	c3                   	ret
+		return fd_close(fd, 1);
+  8015d2:	83 ec 08             	sub    $0x8,%esp
+  8015d5:	6a 01                	push   $0x1
+  8015d7:	ff 75 f4             	push   -0xc(%ebp)
+  8015da:	e8 58 ff ff ff       	call   801537 <fd_close>
+  8015df:	83 c4 10             	add    $0x10,%esp
+  8015e2:	eb ec                	jmp    8015d0 <close+0x19>
+
+008015e4 <close_all>:
+
+void
+close_all(void)
+{
+  8015e4:	55                   	push   %ebp
+  8015e5:	89 e5                	mov    %esp,%ebp
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015f0:	83 ec 0c             	sub    $0xc,%esp
+  8015f3:	53                   	push   %ebx
+  8015f4:	e8 be ff ff ff       	call   8015b7 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015f9:	83 c3 01             	add    $0x1,%ebx
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801605:	75 e9                	jne    8015f0 <close_all+0xc>
+}
+  801607:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160a:	c9                   	leave
+  80160b:	c3                   	ret
+
+0080160c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	57                   	push   %edi
+  801610:	56                   	push   %esi
+  801611:	53                   	push   %ebx
+  801612:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801615:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801618:	50                   	push   %eax
+  801619:	ff 75 08             	push   0x8(%ebp)
+  80161c:	e8 51 fe ff ff       	call   801472 <fd_lookup>
+  801621:	89 c3                	mov    %eax,%ebx
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	85 c0                	test   %eax,%eax
+  801628:	78 7f                	js     8016a9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	ff 75 0c             	push   0xc(%ebp)
+  801630:	e8 82 ff ff ff       	call   8015b7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801635:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801638:	c1 e6 0c             	shl    $0xc,%esi
+  80163b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801641:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801644:	89 3c 24             	mov    %edi,(%esp)
+  801647:	e8 bf fd ff ff       	call   80140b <fd2data>
+  80164c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80164e:	89 34 24             	mov    %esi,(%esp)
+  801651:	e8 b5 fd ff ff       	call   80140b <fd2data>
+  801656:	83 c4 10             	add    $0x10,%esp
+  801659:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80165c:	89 d8                	mov    %ebx,%eax
+  80165e:	c1 e8 16             	shr    $0x16,%eax
+  801661:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801668:	a8 01                	test   $0x1,%al
+  80166a:	74 11                	je     80167d <dup+0x71>
+  80166c:	89 d8                	mov    %ebx,%eax
+  80166e:	c1 e8 0c             	shr    $0xc,%eax
+  801671:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801678:	f6 c2 01             	test   $0x1,%dl
+  80167b:	75 36                	jne    8016b3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80167d:	89 f8                	mov    %edi,%eax
+  80167f:	c1 e8 0c             	shr    $0xc,%eax
+  801682:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801691:	50                   	push   %eax
+  801692:	56                   	push   %esi
+  801693:	6a 00                	push   $0x0
+  801695:	57                   	push   %edi
+  801696:	6a 00                	push   $0x0
+  801698:	e8 3e f9 ff ff       	call   800fdb <sys_page_map>
+  80169d:	89 c3                	mov    %eax,%ebx
+  80169f:	83 c4 20             	add    $0x20,%esp
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 33                	js     8016d9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8016a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8016a9:	89 d8                	mov    %ebx,%eax
+  8016ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ae:	5b                   	pop    %ebx
+  8016af:	5e                   	pop    %esi
+  8016b0:	5f                   	pop    %edi
+  8016b1:	5d                   	pop    %ebp
+  8016b2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8016b3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016ba:	83 ec 0c             	sub    $0xc,%esp
+  8016bd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016c2:	50                   	push   %eax
+  8016c3:	ff 75 d4             	push   -0x2c(%ebp)
+  8016c6:	6a 00                	push   $0x0
+  8016c8:	53                   	push   %ebx
+  8016c9:	6a 00                	push   $0x0
+  8016cb:	e8 0b f9 ff ff       	call   800fdb <sys_page_map>
+  8016d0:	89 c3                	mov    %eax,%ebx
+  8016d2:	83 c4 20             	add    $0x20,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	79 a4                	jns    80167d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016d9:	83 ec 08             	sub    $0x8,%esp
+  8016dc:	56                   	push   %esi
+  8016dd:	6a 00                	push   $0x0
+  8016df:	e8 39 f9 ff ff       	call   80101d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016e4:	83 c4 08             	add    $0x8,%esp
+  8016e7:	ff 75 d4             	push   -0x2c(%ebp)
+  8016ea:	6a 00                	push   $0x0
+  8016ec:	e8 2c f9 ff ff       	call   80101d <sys_page_unmap>
+	return r;
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	eb b3                	jmp    8016a9 <dup+0x9d>
+
+008016f6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	83 ec 18             	sub    $0x18,%esp
+  8016fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801701:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	53                   	push   %ebx
+  801706:	e8 67 fd ff ff       	call   801472 <fd_lookup>
+  80170b:	83 c4 10             	add    $0x10,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 3c                	js     80174e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801712:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801715:	83 ec 08             	sub    $0x8,%esp
+  801718:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171b:	50                   	push   %eax
+  80171c:	ff 36                	push   (%esi)
+  80171e:	e8 a1 fd ff ff       	call   8014c4 <dev_lookup>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 24                	js     80174e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80172a:	8b 46 08             	mov    0x8(%esi),%eax
+  80172d:	83 e0 03             	and    $0x3,%eax
+  801730:	83 f8 01             	cmp    $0x1,%eax
+  801733:	74 20                	je     801755 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801738:	8b 40 08             	mov    0x8(%eax),%eax
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	74 54                	je     801793 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80173f:	83 ec 04             	sub    $0x4,%esp
+  801742:	ff 75 10             	push   0x10(%ebp)
+  801745:	ff 75 0c             	push   0xc(%ebp)
+  801748:	56                   	push   %esi
+  801749:	ff d0                	call   *%eax
+  80174b:	83 c4 10             	add    $0x10,%esp
+}
+  80174e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801751:	5b                   	pop    %ebx
+  801752:	5e                   	pop    %esi
+  801753:	5d                   	pop    %ebp
+  801754:	c3                   	ret
+  801755:	89 e2                	mov    %esp,%edx
+  801757:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80175c:	29 d0                	sub    %edx,%eax
+  80175e:	89 c2                	mov    %eax,%edx
+  801760:	c1 ea 0f             	shr    $0xf,%edx
+  801763:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801770:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  801777:	8b 40 48             	mov    0x48(%eax),%eax
+  80177a:	83 ec 04             	sub    $0x4,%esp
+  80177d:	53                   	push   %ebx
+  80177e:	50                   	push   %eax
+  80177f:	68 59 42 80 00       	push   $0x804259
+  801784:	e8 e4 ec ff ff       	call   80046d <cprintf>
+		return -E_INVAL;
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801791:	eb bb                	jmp    80174e <read+0x58>
+		return -E_NOT_SUPP;
+  801793:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801798:	eb b4                	jmp    80174e <read+0x58>
+
+0080179a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80179a:	55                   	push   %ebp
+  80179b:	89 e5                	mov    %esp,%ebp
+  80179d:	57                   	push   %edi
+  80179e:	56                   	push   %esi
+  80179f:	53                   	push   %ebx
+  8017a0:	83 ec 0c             	sub    $0xc,%esp
+  8017a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8017a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8017a9:	85 f6                	test   %esi,%esi
+  8017ab:	74 30                	je     8017dd <readn+0x43>
+  8017ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8017b7:	83 ec 04             	sub    $0x4,%esp
+  8017ba:	89 f2                	mov    %esi,%edx
+  8017bc:	29 c2                	sub    %eax,%edx
+  8017be:	52                   	push   %edx
+  8017bf:	01 f8                	add    %edi,%eax
+  8017c1:	50                   	push   %eax
+  8017c2:	ff 75 08             	push   0x8(%ebp)
+  8017c5:	e8 2c ff ff ff       	call   8016f6 <read>
+		if (m < 0)
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	78 15                	js     8017e6 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8017d1:	74 11                	je     8017e4 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8017d3:	01 c3                	add    %eax,%ebx
+  8017d5:	89 d8                	mov    %ebx,%eax
+  8017d7:	39 f3                	cmp    %esi,%ebx
+  8017d9:	72 dc                	jb     8017b7 <readn+0x1d>
+  8017db:	eb 09                	jmp    8017e6 <readn+0x4c>
+  8017dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e2:	eb 02                	jmp    8017e6 <readn+0x4c>
+  8017e4:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8017e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5f                   	pop    %edi
+  8017ec:	5d                   	pop    %ebp
+  8017ed:	c3                   	ret
+
+008017ee <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017ee:	55                   	push   %ebp
+  8017ef:	89 e5                	mov    %esp,%ebp
+  8017f1:	56                   	push   %esi
+  8017f2:	53                   	push   %ebx
+  8017f3:	83 ec 18             	sub    $0x18,%esp
+  8017f6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017fc:	50                   	push   %eax
+  8017fd:	53                   	push   %ebx
+  8017fe:	e8 6f fc ff ff       	call   801472 <fd_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 37                	js     801841 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801813:	50                   	push   %eax
+  801814:	ff 36                	push   (%esi)
+  801816:	e8 a9 fc ff ff       	call   8014c4 <dev_lookup>
+  80181b:	83 c4 10             	add    $0x10,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 1f                	js     801841 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801822:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801826:	74 20                	je     801848 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	74 54                	je     801886 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801832:	83 ec 04             	sub    $0x4,%esp
+  801835:	ff 75 10             	push   0x10(%ebp)
+  801838:	ff 75 0c             	push   0xc(%ebp)
+  80183b:	56                   	push   %esi
+  80183c:	ff d0                	call   *%eax
+  80183e:	83 c4 10             	add    $0x10,%esp
+}
+  801841:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801844:	5b                   	pop    %ebx
+  801845:	5e                   	pop    %esi
+  801846:	5d                   	pop    %ebp
+  801847:	c3                   	ret
+  801848:	89 e2                	mov    %esp,%edx
+  80184a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80184f:	29 d0                	sub    %edx,%eax
+  801851:	89 c2                	mov    %eax,%edx
+  801853:	c1 ea 0f             	shr    $0xf,%edx
+  801856:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80185b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801860:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801863:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  80186a:	8b 40 48             	mov    0x48(%eax),%eax
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  801870:	53                   	push   %ebx
+  801871:	50                   	push   %eax
+  801872:	68 75 42 80 00       	push   $0x804275
+  801877:	e8 f1 eb ff ff       	call   80046d <cprintf>
+		return -E_INVAL;
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801884:	eb bb                	jmp    801841 <write+0x53>
+		return -E_NOT_SUPP;
+  801886:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188b:	eb b4                	jmp    801841 <write+0x53>
+
+0080188d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80188d:	55                   	push   %ebp
+  80188e:	89 e5                	mov    %esp,%ebp
+  801890:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801893:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801896:	50                   	push   %eax
+  801897:	ff 75 08             	push   0x8(%ebp)
+  80189a:	e8 d3 fb ff ff       	call   801472 <fd_lookup>
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 0e                	js     8018b4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8018a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ac:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+
+008018b6 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8018b6:	55                   	push   %ebp
+  8018b7:	89 e5                	mov    %esp,%ebp
+  8018b9:	53                   	push   %ebx
+  8018ba:	83 ec 1c             	sub    $0x1c,%esp
+  8018bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 75 08             	push   0x8(%ebp)
+  8018c7:	e8 a6 fb ff ff       	call   801472 <fd_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 33                	js     801906 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8018d3:	83 fb 03             	cmp    $0x3,%ebx
+  8018d6:	74 28                	je     801900 <fcntl+0x4a>
+  8018d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018dd:	83 fb 04             	cmp    $0x4,%ebx
+  8018e0:	75 24                	jne    801906 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8018e2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8018e5:	8b 41 08             	mov    0x8(%ecx),%eax
+  8018e8:	80 e4 ef             	and    $0xef,%ah
+  8018eb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8018ee:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8018f4:	09 d0                	or     %edx,%eax
+  8018f6:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8018f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fe:	eb 06                	jmp    801906 <fcntl+0x50>
+		return fd->fd_omode;
+  801900:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801903:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801909:	c9                   	leave
+  80190a:	c3                   	ret
+
+0080190b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80190b:	55                   	push   %ebp
+  80190c:	89 e5                	mov    %esp,%ebp
+  80190e:	56                   	push   %esi
+  80190f:	53                   	push   %ebx
+  801910:	83 ec 18             	sub    $0x18,%esp
+  801913:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801916:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801919:	50                   	push   %eax
+  80191a:	53                   	push   %ebx
+  80191b:	e8 52 fb ff ff       	call   801472 <fd_lookup>
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 34                	js     80195b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801927:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80192a:	83 ec 08             	sub    $0x8,%esp
+  80192d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801930:	50                   	push   %eax
+  801931:	ff 36                	push   (%esi)
+  801933:	e8 8c fb ff ff       	call   8014c4 <dev_lookup>
+  801938:	83 c4 10             	add    $0x10,%esp
+  80193b:	85 c0                	test   %eax,%eax
+  80193d:	78 1c                	js     80195b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80193f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801943:	74 1d                	je     801962 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801945:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801948:	8b 40 18             	mov    0x18(%eax),%eax
+  80194b:	85 c0                	test   %eax,%eax
+  80194d:	74 51                	je     8019a0 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80194f:	83 ec 08             	sub    $0x8,%esp
+  801952:	ff 75 0c             	push   0xc(%ebp)
+  801955:	56                   	push   %esi
+  801956:	ff d0                	call   *%eax
+  801958:	83 c4 10             	add    $0x10,%esp
+}
+  80195b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195e:	5b                   	pop    %ebx
+  80195f:	5e                   	pop    %esi
+  801960:	5d                   	pop    %ebp
+  801961:	c3                   	ret
+  801962:	89 e2                	mov    %esp,%edx
+  801964:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801969:	29 d0                	sub    %edx,%eax
+  80196b:	89 c2                	mov    %eax,%edx
+  80196d:	c1 ea 0f             	shr    $0xf,%edx
+  801970:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197a:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80197d:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  801984:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801987:	83 ec 04             	sub    $0x4,%esp
+  80198a:	53                   	push   %ebx
+  80198b:	50                   	push   %eax
+  80198c:	68 38 42 80 00       	push   $0x804238
+  801991:	e8 d7 ea ff ff       	call   80046d <cprintf>
+		return -E_INVAL;
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80199e:	eb bb                	jmp    80195b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019a0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019a5:	eb b4                	jmp    80195b <ftruncate+0x50>
+
+008019a7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019a7:	55                   	push   %ebp
+  8019a8:	89 e5                	mov    %esp,%ebp
+  8019aa:	56                   	push   %esi
+  8019ab:	53                   	push   %ebx
+  8019ac:	83 ec 18             	sub    $0x18,%esp
+  8019af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b5:	50                   	push   %eax
+  8019b6:	ff 75 08             	push   0x8(%ebp)
+  8019b9:	e8 b4 fa ff ff       	call   801472 <fd_lookup>
+  8019be:	83 c4 10             	add    $0x10,%esp
+  8019c1:	85 c0                	test   %eax,%eax
+  8019c3:	78 53                	js     801a18 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019c8:	83 ec 08             	sub    $0x8,%esp
+  8019cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	ff 36                	push   (%esi)
+  8019d1:	e8 ee fa ff ff       	call   8014c4 <dev_lookup>
+  8019d6:	83 c4 10             	add    $0x10,%esp
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	78 3b                	js     801a18 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8019dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8019e4:	74 39                	je     801a1f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8019e6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8019e9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019f0:	00 00 00 
+	stat->st_isdir = 0;
+  8019f3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019fa:	00 00 00 
+	stat->st_version = 0;
+  8019fd:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801a04:	00 00 00 
+	stat->st_dev = dev;
+  801a07:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a0d:	83 ec 08             	sub    $0x8,%esp
+  801a10:	53                   	push   %ebx
+  801a11:	56                   	push   %esi
+  801a12:	ff 50 14             	call   *0x14(%eax)
+  801a15:	83 c4 10             	add    $0x10,%esp
+}
+  801a18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1b:	5b                   	pop    %ebx
+  801a1c:	5e                   	pop    %esi
+  801a1d:	5d                   	pop    %ebp
+  801a1e:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a24:	eb f2                	jmp    801a18 <fstat+0x71>
+
+00801a26 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a26:	55                   	push   %ebp
+  801a27:	89 e5                	mov    %esp,%ebp
+  801a29:	56                   	push   %esi
+  801a2a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a2b:	83 ec 08             	sub    $0x8,%esp
+  801a2e:	6a 00                	push   $0x0
+  801a30:	ff 75 08             	push   0x8(%ebp)
+  801a33:	e8 b7 01 00 00       	call   801bef <open>
+  801a38:	89 c3                	mov    %eax,%ebx
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 1b                	js     801a5c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a41:	83 ec 08             	sub    $0x8,%esp
+  801a44:	ff 75 0c             	push   0xc(%ebp)
+  801a47:	50                   	push   %eax
+  801a48:	e8 5a ff ff ff       	call   8019a7 <fstat>
+  801a4d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a4f:	89 1c 24             	mov    %ebx,(%esp)
+  801a52:	e8 60 fb ff ff       	call   8015b7 <close>
+	return r;
+  801a57:	83 c4 10             	add    $0x10,%esp
+  801a5a:	89 f3                	mov    %esi,%ebx
+}
+  801a5c:	89 d8                	mov    %ebx,%eax
+  801a5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a61:	5b                   	pop    %ebx
+  801a62:	5e                   	pop    %esi
+  801a63:	5d                   	pop    %ebp
+  801a64:	c3                   	ret
+
+00801a65 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a65:	55                   	push   %ebp
+  801a66:	89 e5                	mov    %esp,%ebp
+  801a68:	56                   	push   %esi
+  801a69:	53                   	push   %ebx
+  801a6a:	89 c6                	mov    %eax,%esi
+  801a6c:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801a6e:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801a75:	74 27                	je     801a9e <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a77:	6a 07                	push   $0x7
+  801a79:	68 00 80 80 00       	push   $0x808000
+  801a7e:	56                   	push   %esi
+  801a7f:	ff 35 00 60 80 00    	push   0x806000
+  801a85:	e8 d9 1f 00 00       	call   803a63 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801a8a:	83 c4 0c             	add    $0xc,%esp
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	53                   	push   %ebx
+  801a90:	6a 00                	push   $0x0
+  801a92:	e8 3c 1d 00 00       	call   8037d3 <ipc_recv>
+}
+  801a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9a:	5b                   	pop    %ebx
+  801a9b:	5e                   	pop    %esi
+  801a9c:	5d                   	pop    %ebp
+  801a9d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a9e:	83 ec 0c             	sub    $0xc,%esp
+  801aa1:	6a 02                	push   $0x2
+  801aa3:	e8 24 20 00 00       	call   803acc <ipc_find_env>
+  801aa8:	a3 00 60 80 00       	mov    %eax,0x806000
+  801aad:	83 c4 10             	add    $0x10,%esp
+  801ab0:	eb c5                	jmp    801a77 <fsipc+0x12>
+
+00801ab2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ab8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abe:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.set_size.req_size = newsize;
+  801ac3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801acb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad0:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ad5:	e8 8b ff ff ff       	call   801a65 <fsipc>
+}
+  801ada:	c9                   	leave
+  801adb:	c3                   	ret
+
+00801adc <devfile_flush>:
+{
+  801adc:	55                   	push   %ebp
+  801add:	89 e5                	mov    %esp,%ebp
+  801adf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ae2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae8:	a3 00 80 80 00       	mov    %eax,0x808000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af2:	b8 06 00 00 00       	mov    $0x6,%eax
+  801af7:	e8 69 ff ff ff       	call   801a65 <fsipc>
+}
+  801afc:	c9                   	leave
+  801afd:	c3                   	ret
+
+00801afe <devfile_stat>:
+{
+  801afe:	55                   	push   %ebp
+  801aff:	89 e5                	mov    %esp,%ebp
+  801b01:	53                   	push   %ebx
+  801b02:	83 ec 04             	sub    $0x4,%esp
+  801b05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b0e:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b18:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b1d:	e8 43 ff ff ff       	call   801a65 <fsipc>
+  801b22:	85 c0                	test   %eax,%eax
+  801b24:	78 37                	js     801b5d <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b26:	83 ec 08             	sub    $0x8,%esp
+  801b29:	68 00 80 80 00       	push   $0x808000
+  801b2e:	53                   	push   %ebx
+  801b2f:	e8 30 f0 ff ff       	call   800b64 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b34:	a1 80 80 80 00       	mov    0x808080,%eax
+  801b39:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b3f:	a1 84 80 80 00       	mov    0x808084,%eax
+  801b44:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801b4a:	a1 88 80 80 00       	mov    0x808088,%eax
+  801b4f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b5d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b60:	c9                   	leave
+  801b61:	c3                   	ret
+
+00801b62 <devfile_write>:
+{
+  801b62:	55                   	push   %ebp
+  801b63:	89 e5                	mov    %esp,%ebp
+  801b65:	83 ec 0c             	sub    $0xc,%esp
+  801b68:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801b6b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801b70:	39 d0                	cmp    %edx,%eax
+  801b72:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b78:	8b 52 0c             	mov    0xc(%edx),%edx
+  801b7b:	89 15 00 80 80 00    	mov    %edx,0x808000
+	fsipcbuf.write.req_n = count;
+  801b81:	a3 04 80 80 00       	mov    %eax,0x808004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801b86:	50                   	push   %eax
+  801b87:	ff 75 0c             	push   0xc(%ebp)
+  801b8a:	68 08 80 80 00       	push   $0x808008
+  801b8f:	e8 80 f1 ff ff       	call   800d14 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b99:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b9e:	e8 c2 fe ff ff       	call   801a65 <fsipc>
+}
+  801ba3:	c9                   	leave
+  801ba4:	c3                   	ret
+
+00801ba5 <devfile_read>:
+{
+  801ba5:	55                   	push   %ebp
+  801ba6:	89 e5                	mov    %esp,%ebp
+  801ba8:	53                   	push   %ebx
+  801ba9:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801baf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.read.req_n = n;
+  801bb7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801bba:	a3 04 80 80 00       	mov    %eax,0x808004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801bbf:	ba 00 80 80 00       	mov    $0x808000,%edx
+  801bc4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bc9:	e8 97 fe ff ff       	call   801a65 <fsipc>
+  801bce:	89 c3                	mov    %eax,%ebx
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	78 14                	js     801be8 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801bd4:	83 ec 04             	sub    $0x4,%esp
+  801bd7:	50                   	push   %eax
+  801bd8:	68 00 80 80 00       	push   $0x808000
+  801bdd:	ff 75 0c             	push   0xc(%ebp)
+  801be0:	e8 2f f1 ff ff       	call   800d14 <memmove>
+	return r;
+  801be5:	83 c4 10             	add    $0x10,%esp
+}
+  801be8:	89 d8                	mov    %ebx,%eax
+  801bea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+00801bef <open>:
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	53                   	push   %ebx
+  801bf3:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801bf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf9:	50                   	push   %eax
+  801bfa:	e8 23 f8 ff ff       	call   801422 <fd_alloc>
+  801bff:	89 c3                	mov    %eax,%ebx
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 2a                	js     801c32 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801c08:	83 ec 0c             	sub    $0xc,%esp
+  801c0b:	ff 75 08             	push   0x8(%ebp)
+  801c0e:	e8 05 ef ff ff       	call   800b18 <strlen>
+  801c13:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801c16:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801c1b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c20:	7e 17                	jle    801c39 <open+0x4a>
+	fd_close(fd, 1);
+  801c22:	83 ec 08             	sub    $0x8,%esp
+  801c25:	6a 01                	push   $0x1
+  801c27:	ff 75 f4             	push   -0xc(%ebp)
+  801c2a:	e8 08 f9 ff ff       	call   801537 <fd_close>
+	return r;
+  801c2f:	83 c4 10             	add    $0x10,%esp
+}
+  801c32:	89 d8                	mov    %ebx,%eax
+  801c34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c37:	c9                   	leave
+  801c38:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801c39:	83 ec 08             	sub    $0x8,%esp
+  801c3c:	ff 75 08             	push   0x8(%ebp)
+  801c3f:	68 00 80 80 00       	push   $0x808000
+  801c44:	e8 1b ef ff ff       	call   800b64 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801c49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c4c:	a3 00 84 80 00       	mov    %eax,0x808400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801c51:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c54:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c59:	e8 07 fe ff ff       	call   801a65 <fsipc>
+  801c5e:	89 c3                	mov    %eax,%ebx
+  801c60:	83 c4 10             	add    $0x10,%esp
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 bb                	js     801c22 <open+0x33>
+	return fd2num(fd); 	
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	ff 75 f4             	push   -0xc(%ebp)
+  801c6d:	e8 89 f7 ff ff       	call   8013fb <fd2num>
+  801c72:	89 c3                	mov    %eax,%ebx
+  801c74:	83 c4 10             	add    $0x10,%esp
+  801c77:	eb b9                	jmp    801c32 <open+0x43>
+
+00801c79 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801c79:	55                   	push   %ebp
+  801c7a:	89 e5                	mov    %esp,%ebp
+  801c7c:	53                   	push   %ebx
+  801c7d:	83 ec 1c             	sub    $0x1c,%esp
+  801c80:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c86:	50                   	push   %eax
+  801c87:	ff 75 08             	push   0x8(%ebp)
+  801c8a:	e8 e3 f7 ff ff       	call   801472 <fd_lookup>
+  801c8f:	83 c4 10             	add    $0x10,%esp
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 5a                	js     801cf0 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801c96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c99:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801c9f:	39 10                	cmp    %edx,(%eax)
+  801ca1:	75 66                	jne    801d09 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801ca3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801caa:	74 49                	je     801cf5 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801caf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cb2:	a3 00 80 80 00       	mov    %eax,0x808000
+	fsipcbuf.map.req_offset = offset;
+  801cb7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cba:	a3 04 80 80 00       	mov    %eax,0x808004
+	fsipcbuf.map.req_npages = maxpages;
+  801cbf:	89 1d 08 80 80 00    	mov    %ebx,0x808008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801cc5:	6a 07                	push   $0x7
+  801cc7:	68 00 80 80 00       	push   $0x808000
+  801ccc:	6a 09                	push   $0x9
+  801cce:	ff 35 00 60 80 00    	push   0x806000
+  801cd4:	e8 8a 1d 00 00       	call   803a63 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801cd9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ce0:	6a 00                	push   $0x0
+  801ce2:	53                   	push   %ebx
+  801ce3:	ff 75 10             	push   0x10(%ebp)
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 b3 1b 00 00       	call   8038a0 <ipc_recv_pages>
+  801ced:	83 c4 20             	add    $0x20,%esp
+}
+  801cf0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cf3:	c9                   	leave
+  801cf4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801cf5:	83 ec 0c             	sub    $0xc,%esp
+  801cf8:	6a 02                	push   $0x2
+  801cfa:	e8 cd 1d 00 00       	call   803acc <ipc_find_env>
+  801cff:	a3 00 60 80 00       	mov    %eax,0x806000
+  801d04:	83 c4 10             	add    $0x10,%esp
+  801d07:	eb a3                	jmp    801cac <fmap+0x33>
+		return -E_INVAL;
+  801d09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d0e:	eb e0                	jmp    801cf0 <fmap+0x77>
+
+00801d10 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	53                   	push   %ebx
+  801d14:	83 ec 10             	sub    $0x10,%esp
+  801d17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801d1a:	53                   	push   %ebx
+  801d1b:	e8 f8 ed ff ff       	call   800b18 <strlen>
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d28:	7f 25                	jg     801d4f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801d2a:	83 ec 08             	sub    $0x8,%esp
+  801d2d:	53                   	push   %ebx
+  801d2e:	68 00 80 80 00       	push   $0x808000
+  801d33:	e8 2c ee ff ff       	call   800b64 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801d38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d3d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801d42:	e8 1e fd ff ff       	call   801a65 <fsipc>
+  801d47:	83 c4 10             	add    $0x10,%esp
+}
+  801d4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+		return -E_BAD_PATH;
+  801d4f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801d54:	eb f4                	jmp    801d4a <remove+0x3a>
+
+00801d56 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801d56:	55                   	push   %ebp
+  801d57:	89 e5                	mov    %esp,%ebp
+  801d59:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d61:	b8 08 00 00 00       	mov    $0x8,%eax
+  801d66:	e8 fa fc ff ff       	call   801a65 <fsipc>
+}
+  801d6b:	c9                   	leave
+  801d6c:	c3                   	ret
+
+00801d6d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801d73:	68 a8 42 80 00       	push   $0x8042a8
+  801d78:	ff 75 0c             	push   0xc(%ebp)
+  801d7b:	e8 e4 ed ff ff       	call   800b64 <strcpy>
+	return 0;
+}
+  801d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d85:	c9                   	leave
+  801d86:	c3                   	ret
+
+00801d87 <devsock_close>:
+{
+  801d87:	55                   	push   %ebp
+  801d88:	89 e5                	mov    %esp,%ebp
+  801d8a:	53                   	push   %ebx
+  801d8b:	83 ec 10             	sub    $0x10,%esp
+  801d8e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801d91:	53                   	push   %ebx
+  801d92:	e8 74 1d 00 00       	call   803b0b <pageref>
+  801d97:	89 c2                	mov    %eax,%edx
+  801d99:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d9c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801da1:	83 fa 01             	cmp    $0x1,%edx
+  801da4:	74 05                	je     801dab <devsock_close+0x24>
+}
+  801da6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801da9:	c9                   	leave
+  801daa:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801dab:	83 ec 0c             	sub    $0xc,%esp
+  801dae:	ff 73 0c             	push   0xc(%ebx)
+  801db1:	e8 b0 05 00 00       	call   802366 <nsipc_close>
+  801db6:	83 c4 10             	add    $0x10,%esp
+  801db9:	eb eb                	jmp    801da6 <devsock_close+0x1f>
+
+00801dbb <devsock_write>:
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	53                   	push   %ebx
+  801dbf:	83 ec 14             	sub    $0x14,%esp
+  801dc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801dc5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801dc8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801dcb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801dce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801dd1:	8b 41 08             	mov    0x8(%ecx),%eax
+  801dd4:	c1 f8 09             	sar    $0x9,%eax
+  801dd7:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801dda:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801de0:	77 13                	ja     801df5 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801de2:	50                   	push   %eax
+  801de3:	52                   	push   %edx
+  801de4:	53                   	push   %ebx
+  801de5:	ff 71 0c             	push   0xc(%ecx)
+  801de8:	e8 5c 06 00 00       	call   802449 <nsipc_send>
+  801ded:	83 c4 10             	add    $0x10,%esp
+}
+  801df0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df3:	c9                   	leave
+  801df4:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801df5:	50                   	push   %eax
+  801df6:	6a 01                	push   $0x1
+  801df8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dfb:	50                   	push   %eax
+  801dfc:	ff 71 0c             	push   0xc(%ecx)
+  801dff:	e8 a6 06 00 00       	call   8024aa <nsipc_sendmsg>
+  801e04:	83 c4 10             	add    $0x10,%esp
+  801e07:	eb e7                	jmp    801df0 <devsock_write+0x35>
+
+00801e09 <devsock_read>:
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 14             	sub    $0x14,%esp
+  801e10:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801e16:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801e19:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801e1c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801e1f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801e22:	c1 f8 09             	sar    $0x9,%eax
+  801e25:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801e28:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801e2e:	77 13                	ja     801e43 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801e30:	50                   	push   %eax
+  801e31:	52                   	push   %edx
+  801e32:	53                   	push   %ebx
+  801e33:	ff 71 0c             	push   0xc(%ecx)
+  801e36:	e8 9c 05 00 00       	call   8023d7 <nsipc_recv>
+  801e3b:	83 c4 10             	add    $0x10,%esp
+}
+  801e3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e41:	c9                   	leave
+  801e42:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801e43:	50                   	push   %eax
+  801e44:	6a 01                	push   $0x1
+  801e46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e49:	50                   	push   %eax
+  801e4a:	ff 71 0c             	push   0xc(%ecx)
+  801e4d:	e8 02 0a 00 00       	call   802854 <nsipc_recvmsg>
+  801e52:	83 c4 10             	add    $0x10,%esp
+  801e55:	eb e7                	jmp    801e3e <devsock_read+0x35>
+
+00801e57 <fd2sockid>:
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801e5d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e60:	52                   	push   %edx
+  801e61:	50                   	push   %eax
+  801e62:	e8 0b f6 ff ff       	call   801472 <fd_lookup>
+  801e67:	83 c4 10             	add    $0x10,%esp
+  801e6a:	85 c0                	test   %eax,%eax
+  801e6c:	78 10                	js     801e7e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801e6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e71:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801e77:	39 08                	cmp    %ecx,(%eax)
+  801e79:	75 05                	jne    801e80 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801e7b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801e7e:	c9                   	leave
+  801e7f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e85:	eb f7                	jmp    801e7e <fd2sockid+0x27>
+
+00801e87 <sock_flags>:
+{
+  801e87:	55                   	push   %ebp
+  801e88:	89 e5                	mov    %esp,%ebp
+  801e8a:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801e8d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801e90:	52                   	push   %edx
+  801e91:	50                   	push   %eax
+  801e92:	e8 db f5 ff ff       	call   801472 <fd_lookup>
+  801e97:	83 c4 10             	add    $0x10,%esp
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 0e                	js     801eac <sock_flags+0x25>
+  801e9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea1:	8b 40 08             	mov    0x8(%eax),%eax
+  801ea4:	c1 e8 09             	shr    $0x9,%eax
+  801ea7:	83 e0 08             	and    $0x8,%eax
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+		return 0;
+  801eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb1:	eb f7                	jmp    801eaa <sock_flags+0x23>
+
+00801eb3 <alloc_sockfd>:
+{
+  801eb3:	55                   	push   %ebp
+  801eb4:	89 e5                	mov    %esp,%ebp
+  801eb6:	56                   	push   %esi
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 1c             	sub    $0x1c,%esp
+  801ebb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801ebd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec0:	50                   	push   %eax
+  801ec1:	e8 5c f5 ff ff       	call   801422 <fd_alloc>
+  801ec6:	89 c3                	mov    %eax,%ebx
+  801ec8:	83 c4 10             	add    $0x10,%esp
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 43                	js     801f12 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ecf:	83 ec 04             	sub    $0x4,%esp
+  801ed2:	68 07 04 00 00       	push   $0x407
+  801ed7:	ff 75 f4             	push   -0xc(%ebp)
+  801eda:	6a 00                	push   $0x0
+  801edc:	e8 b7 f0 ff ff       	call   800f98 <sys_page_alloc>
+  801ee1:	89 c3                	mov    %eax,%ebx
+  801ee3:	83 c4 10             	add    $0x10,%esp
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 28                	js     801f12 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eed:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ef3:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801ef5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801eff:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	50                   	push   %eax
+  801f06:	e8 f0 f4 ff ff       	call   8013fb <fd2num>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	83 c4 10             	add    $0x10,%esp
+  801f10:	eb 0c                	jmp    801f1e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801f12:	83 ec 0c             	sub    $0xc,%esp
+  801f15:	56                   	push   %esi
+  801f16:	e8 4b 04 00 00       	call   802366 <nsipc_close>
+		return r;
+  801f1b:	83 c4 10             	add    $0x10,%esp
+}
+  801f1e:	89 d8                	mov    %ebx,%eax
+  801f20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f23:	5b                   	pop    %ebx
+  801f24:	5e                   	pop    %esi
+  801f25:	5d                   	pop    %ebp
+  801f26:	c3                   	ret
+
+00801f27 <accept>:
+{
+  801f27:	55                   	push   %ebp
+  801f28:	89 e5                	mov    %esp,%ebp
+  801f2a:	56                   	push   %esi
+  801f2b:	53                   	push   %ebx
+  801f2c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f2f:	89 f0                	mov    %esi,%eax
+  801f31:	e8 21 ff ff ff       	call   801e57 <fd2sockid>
+  801f36:	89 c3                	mov    %eax,%ebx
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 24                	js     801f60 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801f3c:	89 f0                	mov    %esi,%eax
+  801f3e:	e8 44 ff ff ff       	call   801e87 <sock_flags>
+  801f43:	50                   	push   %eax
+  801f44:	ff 75 10             	push   0x10(%ebp)
+  801f47:	ff 75 0c             	push   0xc(%ebp)
+  801f4a:	53                   	push   %ebx
+  801f4b:	e8 6b 03 00 00       	call   8022bb <nsipc_accept>
+  801f50:	89 c3                	mov    %eax,%ebx
+  801f52:	83 c4 10             	add    $0x10,%esp
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 07                	js     801f60 <accept+0x39>
+	return alloc_sockfd(r);
+  801f59:	e8 55 ff ff ff       	call   801eb3 <alloc_sockfd>
+  801f5e:	89 c3                	mov    %eax,%ebx
+}
+  801f60:	89 d8                	mov    %ebx,%eax
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+
+00801f69 <bind>:
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f72:	e8 e0 fe ff ff       	call   801e57 <fd2sockid>
+  801f77:	85 c0                	test   %eax,%eax
+  801f79:	78 12                	js     801f8d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801f7b:	83 ec 04             	sub    $0x4,%esp
+  801f7e:	ff 75 10             	push   0x10(%ebp)
+  801f81:	ff 75 0c             	push   0xc(%ebp)
+  801f84:	50                   	push   %eax
+  801f85:	e8 85 03 00 00       	call   80230f <nsipc_bind>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <shutdown>:
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	e8 ba fe ff ff       	call   801e57 <fd2sockid>
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	78 0f                	js     801fb0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801fa1:	83 ec 08             	sub    $0x8,%esp
+  801fa4:	ff 75 0c             	push   0xc(%ebp)
+  801fa7:	50                   	push   %eax
+  801fa8:	e8 97 03 00 00       	call   802344 <nsipc_shutdown>
+  801fad:	83 c4 10             	add    $0x10,%esp
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+
+00801fb2 <connect>:
+{
+  801fb2:	55                   	push   %ebp
+  801fb3:	89 e5                	mov    %esp,%ebp
+  801fb5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbb:	e8 97 fe ff ff       	call   801e57 <fd2sockid>
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 12                	js     801fd6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801fc4:	83 ec 04             	sub    $0x4,%esp
+  801fc7:	ff 75 10             	push   0x10(%ebp)
+  801fca:	ff 75 0c             	push   0xc(%ebp)
+  801fcd:	50                   	push   %eax
+  801fce:	e8 ad 03 00 00       	call   802380 <nsipc_connect>
+  801fd3:	83 c4 10             	add    $0x10,%esp
+}
+  801fd6:	c9                   	leave
+  801fd7:	c3                   	ret
+
+00801fd8 <listen>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801fde:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe1:	e8 71 fe ff ff       	call   801e57 <fd2sockid>
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 0f                	js     801ff9 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801fea:	83 ec 08             	sub    $0x8,%esp
+  801fed:	ff 75 0c             	push   0xc(%ebp)
+  801ff0:	50                   	push   %eax
+  801ff1:	e8 bf 03 00 00       	call   8023b5 <nsipc_listen>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+}
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+00801ffb <sendmsg>:
+{
+  801ffb:	55                   	push   %ebp
+  801ffc:	89 e5                	mov    %esp,%ebp
+  801ffe:	57                   	push   %edi
+  801fff:	56                   	push   %esi
+  802000:	53                   	push   %ebx
+  802001:	83 ec 0c             	sub    $0xc,%esp
+  802004:	8b 75 08             	mov    0x8(%ebp),%esi
+  802007:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  80200a:	89 f0                	mov    %esi,%eax
+  80200c:	e8 46 fe ff ff       	call   801e57 <fd2sockid>
+  802011:	89 c3                	mov    %eax,%ebx
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 1c                	js     802033 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802017:	89 f0                	mov    %esi,%eax
+  802019:	e8 69 fe ff ff       	call   801e87 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80201e:	0b 45 10             	or     0x10(%ebp),%eax
+  802021:	50                   	push   %eax
+  802022:	ff 77 0c             	push   0xc(%edi)
+  802025:	ff 77 08             	push   0x8(%edi)
+  802028:	53                   	push   %ebx
+  802029:	e8 7c 04 00 00       	call   8024aa <nsipc_sendmsg>
+  80202e:	89 c3                	mov    %eax,%ebx
+  802030:	83 c4 10             	add    $0x10,%esp
+}
+  802033:	89 d8                	mov    %ebx,%eax
+  802035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802038:	5b                   	pop    %ebx
+  802039:	5e                   	pop    %esi
+  80203a:	5f                   	pop    %edi
+  80203b:	5d                   	pop    %ebp
+  80203c:	c3                   	ret
+
+0080203d <recvmsg>:
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	57                   	push   %edi
+  802041:	56                   	push   %esi
+  802042:	53                   	push   %ebx
+  802043:	83 ec 0c             	sub    $0xc,%esp
+  802046:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802049:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  80204c:	89 f8                	mov    %edi,%eax
+  80204e:	e8 04 fe ff ff       	call   801e57 <fd2sockid>
+  802053:	89 c3                	mov    %eax,%ebx
+  802055:	85 c0                	test   %eax,%eax
+  802057:	78 2a                	js     802083 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802059:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802060:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802067:	89 f8                	mov    %edi,%eax
+  802069:	e8 19 fe ff ff       	call   801e87 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80206e:	0b 45 10             	or     0x10(%ebp),%eax
+  802071:	50                   	push   %eax
+  802072:	ff 76 0c             	push   0xc(%esi)
+  802075:	ff 76 08             	push   0x8(%esi)
+  802078:	53                   	push   %ebx
+  802079:	e8 d6 07 00 00       	call   802854 <nsipc_recvmsg>
+  80207e:	89 c3                	mov    %eax,%ebx
+  802080:	83 c4 10             	add    $0x10,%esp
+}
+  802083:	89 d8                	mov    %ebx,%eax
+  802085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802088:	5b                   	pop    %ebx
+  802089:	5e                   	pop    %esi
+  80208a:	5f                   	pop    %edi
+  80208b:	5d                   	pop    %ebp
+  80208c:	c3                   	ret
+
+0080208d <sendfile>:
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	56                   	push   %esi
+  802091:	53                   	push   %ebx
+  802092:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802095:	89 f0                	mov    %esi,%eax
+  802097:	e8 bb fd ff ff       	call   801e57 <fd2sockid>
+  80209c:	89 c3                	mov    %eax,%ebx
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	78 1f                	js     8020c1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  8020a2:	89 f0                	mov    %esi,%eax
+  8020a4:	e8 de fd ff ff       	call   801e87 <sock_flags>
+  8020a9:	83 ec 0c             	sub    $0xc,%esp
+  8020ac:	50                   	push   %eax
+  8020ad:	ff 75 14             	push   0x14(%ebp)
+  8020b0:	ff 75 10             	push   0x10(%ebp)
+  8020b3:	ff 75 0c             	push   0xc(%ebp)
+  8020b6:	53                   	push   %ebx
+  8020b7:	e8 64 06 00 00       	call   802720 <nsipc_sendfile>
+  8020bc:	89 c3                	mov    %eax,%ebx
+  8020be:	83 c4 20             	add    $0x20,%esp
+}
+  8020c1:	89 d8                	mov    %ebx,%eax
+  8020c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c6:	5b                   	pop    %ebx
+  8020c7:	5e                   	pop    %esi
+  8020c8:	5d                   	pop    %ebp
+  8020c9:	c3                   	ret
+
+008020ca <evctl>:
+{
+  8020ca:	55                   	push   %ebp
+  8020cb:	89 e5                	mov    %esp,%ebp
+  8020cd:	53                   	push   %ebx
+  8020ce:	83 ec 04             	sub    $0x4,%esp
+  8020d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  8020d4:	89 d8                	mov    %ebx,%eax
+  8020d6:	e8 7c fd ff ff       	call   801e57 <fd2sockid>
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	78 10                	js     8020ef <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  8020df:	83 ec 04             	sub    $0x4,%esp
+  8020e2:	53                   	push   %ebx
+  8020e3:	ff 75 0c             	push   0xc(%ebp)
+  8020e6:	50                   	push   %eax
+  8020e7:	e8 d2 0b 00 00       	call   802cbe <nsipc_evctl>
+  8020ec:	83 c4 10             	add    $0x10,%esp
+}
+  8020ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+008020f4 <evwait>:
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8020fa:	ff 75 10             	push   0x10(%ebp)
+  8020fd:	ff 75 0c             	push   0xc(%ebp)
+  802100:	ff 75 08             	push   0x8(%ebp)
+  802103:	e8 e0 0b 00 00       	call   802ce8 <nsipc_evwait>
+}
+  802108:	c9                   	leave
+  802109:	c3                   	ret
+
+0080210a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80210a:	55                   	push   %ebp
+  80210b:	89 e5                	mov    %esp,%ebp
+  80210d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802110:	ff 75 10             	push   0x10(%ebp)
+  802113:	ff 75 0c             	push   0xc(%ebp)
+  802116:	ff 75 08             	push   0x8(%ebp)
+  802119:	e8 31 0c 00 00       	call   802d4f <nsipc_socket>
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	85 c0                	test   %eax,%eax
+  802123:	78 05                	js     80212a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802125:	e8 89 fd ff ff       	call   801eb3 <alloc_sockfd>
+}
+  80212a:	c9                   	leave
+  80212b:	c3                   	ret
+
+0080212c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 04             	sub    $0x4,%esp
+  802133:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802135:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80213c:	74 26                	je     802164 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80213e:	6a 07                	push   $0x7
+  802140:	68 00 90 80 00       	push   $0x809000
+  802145:	53                   	push   %ebx
+  802146:	ff 35 24 63 80 00    	push   0x806324
+  80214c:	e8 12 19 00 00       	call   803a63 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802151:	83 c4 0c             	add    $0xc,%esp
+  802154:	6a 00                	push   $0x0
+  802156:	6a 00                	push   $0x0
+  802158:	6a 00                	push   $0x0
+  80215a:	e8 74 16 00 00       	call   8037d3 <ipc_recv>
+}
+  80215f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802162:	c9                   	leave
+  802163:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802164:	83 ec 0c             	sub    $0xc,%esp
+  802167:	6a 03                	push   $0x3
+  802169:	e8 5e 19 00 00       	call   803acc <ipc_find_env>
+  80216e:	a3 24 63 80 00       	mov    %eax,0x806324
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	eb c6                	jmp    80213e <nsipc+0x12>
+
+00802178 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	56                   	push   %esi
+  80217c:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80217d:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802183:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802188:	85 f6                	test   %esi,%esi
+  80218a:	75 33                	jne    8021bf <nsbulk_map+0x47>
+  80218c:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802191:	83 ec 04             	sub    $0x4,%esp
+  802194:	6a 07                	push   $0x7
+  802196:	53                   	push   %ebx
+  802197:	6a 00                	push   $0x0
+  802199:	e8 fa ed ff ff       	call   800f98 <sys_page_alloc>
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 1a                	js     8021bf <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8021a5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021ab:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8021b1:	75 de                	jne    802191 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8021b3:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8021ba:	00 00 00 
+	return 0;
+  8021bd:	89 f0                	mov    %esi,%eax
+}
+  8021bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c2:	5b                   	pop    %ebx
+  8021c3:	5e                   	pop    %esi
+  8021c4:	5d                   	pop    %ebp
+  8021c5:	c3                   	ret
+
+008021c6 <nsbulk_own>:
+{
+  8021c6:	55                   	push   %ebp
+  8021c7:	89 e5                	mov    %esp,%ebp
+  8021c9:	57                   	push   %edi
+  8021ca:	56                   	push   %esi
+  8021cb:	53                   	push   %ebx
+  8021cc:	83 ec 0c             	sub    $0xc,%esp
+  8021cf:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8021d1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8021d4:	85 d2                	test   %edx,%edx
+  8021d6:	7f 0e                	jg     8021e6 <nsbulk_own+0x20>
+	return 0;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dd:	eb 47                	jmp    802226 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8021df:	83 c3 01             	add    $0x1,%ebx
+  8021e2:	39 fb                	cmp    %edi,%ebx
+  8021e4:	7d 3b                	jge    802221 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8021e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8021eb:	89 d9                	mov    %ebx,%ecx
+  8021ed:	d3 e6                	shl    %cl,%esi
+  8021ef:	89 f0                	mov    %esi,%eax
+  8021f1:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8021f7:	74 e6                	je     8021df <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8021f9:	83 ec 04             	sub    $0x4,%esp
+  8021fc:	6a 07                	push   $0x7
+  8021fe:	89 d8                	mov    %ebx,%eax
+  802200:	c1 e0 0c             	shl    $0xc,%eax
+  802203:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802208:	50                   	push   %eax
+  802209:	6a 00                	push   $0x0
+  80220b:	e8 88 ed ff ff       	call   800f98 <sys_page_alloc>
+  802210:	83 c4 10             	add    $0x10,%esp
+  802213:	85 c0                	test   %eax,%eax
+  802215:	78 0f                	js     802226 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802217:	f7 d6                	not    %esi
+  802219:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80221f:	eb be                	jmp    8021df <nsbulk_own+0x19>
+	return 0;
+  802221:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802229:	5b                   	pop    %ebx
+  80222a:	5e                   	pop    %esi
+  80222b:	5f                   	pop    %edi
+  80222c:	5d                   	pop    %ebp
+  80222d:	c3                   	ret
+
+0080222e <nsipc_bulk>:
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 1c             	sub    $0x1c,%esp
+  802237:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80223a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80223c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802242:	c1 fb 0c             	sar    $0xc,%ebx
+  802245:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802248:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80224f:	74 56                	je     8022a7 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802251:	85 ff                	test   %edi,%edi
+  802253:	7e 24                	jle    802279 <nsipc_bulk+0x4b>
+  802255:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80225b:	74 1c                	je     802279 <nsipc_bulk+0x4b>
+  80225d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802263:	c1 e3 0c             	shl    $0xc,%ebx
+  802266:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80226b:	0f b6 10             	movzbl (%eax),%edx
+  80226e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802270:	05 00 10 00 00       	add    $0x1000,%eax
+  802275:	39 d8                	cmp    %ebx,%eax
+  802277:	75 f2                	jne    80226b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802279:	83 ec 0c             	sub    $0xc,%esp
+  80227c:	56                   	push   %esi
+  80227d:	57                   	push   %edi
+  80227e:	68 00 00 00 e0       	push   $0xe0000000
+  802283:	ff 75 e4             	push   -0x1c(%ebp)
+  802286:	ff 35 24 63 80 00    	push   0x806324
+  80228c:	e8 06 18 00 00       	call   803a97 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802291:	83 c4 1c             	add    $0x1c,%esp
+  802294:	6a 00                	push   $0x0
+  802296:	6a 00                	push   $0x0
+  802298:	6a 00                	push   $0x0
+  80229a:	e8 34 15 00 00       	call   8037d3 <ipc_recv>
+}
+  80229f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a2:	5b                   	pop    %ebx
+  8022a3:	5e                   	pop    %esi
+  8022a4:	5f                   	pop    %edi
+  8022a5:	5d                   	pop    %ebp
+  8022a6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8022a7:	83 ec 0c             	sub    $0xc,%esp
+  8022aa:	6a 03                	push   $0x3
+  8022ac:	e8 1b 18 00 00       	call   803acc <ipc_find_env>
+  8022b1:	a3 24 63 80 00       	mov    %eax,0x806324
+  8022b6:	83 c4 10             	add    $0x10,%esp
+  8022b9:	eb 96                	jmp    802251 <nsipc_bulk+0x23>
+
+008022bb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8022bb:	55                   	push   %ebp
+  8022bc:	89 e5                	mov    %esp,%ebp
+  8022be:	53                   	push   %ebx
+  8022bf:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8022c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_flags = flags;
+  8022ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022cd:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8022d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022d7:	e8 50 fe ff ff       	call   80212c <nsipc>
+  8022dc:	89 c3                	mov    %eax,%ebx
+  8022de:	85 c0                	test   %eax,%eax
+  8022e0:	79 07                	jns    8022e9 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8022e2:	89 d8                	mov    %ebx,%eax
+  8022e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e7:	c9                   	leave
+  8022e8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8022e9:	83 ec 04             	sub    $0x4,%esp
+  8022ec:	ff 35 10 90 80 00    	push   0x809010
+  8022f2:	68 00 90 80 00       	push   $0x809000
+  8022f7:	ff 75 0c             	push   0xc(%ebp)
+  8022fa:	e8 15 ea ff ff       	call   800d14 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8022ff:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802305:	8b 45 10             	mov    0x10(%ebp),%eax
+  802308:	89 10                	mov    %edx,(%eax)
+  80230a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80230d:	eb d3                	jmp    8022e2 <nsipc_accept+0x27>
+
+0080230f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80230f:	55                   	push   %ebp
+  802310:	89 e5                	mov    %esp,%ebp
+  802312:	53                   	push   %ebx
+  802313:	83 ec 08             	sub    $0x8,%esp
+  802316:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802319:	8b 45 08             	mov    0x8(%ebp),%eax
+  80231c:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802321:	53                   	push   %ebx
+  802322:	ff 75 0c             	push   0xc(%ebp)
+  802325:	68 04 90 80 00       	push   $0x809004
+  80232a:	e8 e5 e9 ff ff       	call   800d14 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80232f:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  802335:	b8 02 00 00 00       	mov    $0x2,%eax
+  80233a:	e8 ed fd ff ff       	call   80212c <nsipc>
+}
+  80233f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802342:	c9                   	leave
+  802343:	c3                   	ret
+
+00802344 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802344:	55                   	push   %ebp
+  802345:	89 e5                	mov    %esp,%ebp
+  802347:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80234a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  802352:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802355:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  80235a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80235f:	e8 c8 fd ff ff       	call   80212c <nsipc>
+}
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+
+00802366 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802366:	55                   	push   %ebp
+  802367:	89 e5                	mov    %esp,%ebp
+  802369:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80236c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80236f:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  802374:	b8 04 00 00 00       	mov    $0x4,%eax
+  802379:	e8 ae fd ff ff       	call   80212c <nsipc>
+}
+  80237e:	c9                   	leave
+  80237f:	c3                   	ret
+
+00802380 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	53                   	push   %ebx
+  802384:	83 ec 08             	sub    $0x8,%esp
+  802387:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80238a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238d:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802392:	53                   	push   %ebx
+  802393:	ff 75 0c             	push   0xc(%ebp)
+  802396:	68 04 90 80 00       	push   $0x809004
+  80239b:	e8 74 e9 ff ff       	call   800d14 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8023a0:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8023a6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023ab:	e8 7c fd ff ff       	call   80212c <nsipc>
+}
+  8023b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023b3:	c9                   	leave
+  8023b4:	c3                   	ret
+
+008023b5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8023b5:	55                   	push   %ebp
+  8023b6:	89 e5                	mov    %esp,%ebp
+  8023b8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8023bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023be:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8023c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023c6:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8023cb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023d0:	e8 57 fd ff ff       	call   80212c <nsipc>
+}
+  8023d5:	c9                   	leave
+  8023d6:	c3                   	ret
+
+008023d7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8023d7:	55                   	push   %ebp
+  8023d8:	89 e5                	mov    %esp,%ebp
+  8023da:	56                   	push   %esi
+  8023db:	53                   	push   %ebx
+  8023dc:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8023df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e2:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  8023e7:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  8023ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023f0:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8023f5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8023fa:	e8 2d fd ff ff       	call   80212c <nsipc>
+  8023ff:	89 c3                	mov    %eax,%ebx
+  802401:	85 c0                	test   %eax,%eax
+  802403:	78 22                	js     802427 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802405:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80240a:	39 c6                	cmp    %eax,%esi
+  80240c:	0f 4e c6             	cmovle %esi,%eax
+  80240f:	39 c3                	cmp    %eax,%ebx
+  802411:	7f 1d                	jg     802430 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802413:	83 ec 04             	sub    $0x4,%esp
+  802416:	53                   	push   %ebx
+  802417:	68 00 90 80 00       	push   $0x809000
+  80241c:	ff 75 0c             	push   0xc(%ebp)
+  80241f:	e8 f0 e8 ff ff       	call   800d14 <memmove>
+  802424:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802427:	89 d8                	mov    %ebx,%eax
+  802429:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80242c:	5b                   	pop    %ebx
+  80242d:	5e                   	pop    %esi
+  80242e:	5d                   	pop    %ebp
+  80242f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802430:	68 b4 42 80 00       	push   $0x8042b4
+  802435:	68 c9 42 80 00       	push   $0x8042c9
+  80243a:	68 b2 00 00 00       	push   $0xb2
+  80243f:	68 de 42 80 00       	push   $0x8042de
+  802444:	e8 49 df ff ff       	call   800392 <_panic>
+
+00802449 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802449:	55                   	push   %ebp
+  80244a:	89 e5                	mov    %esp,%ebp
+  80244c:	53                   	push   %ebx
+  80244d:	83 ec 04             	sub    $0x4,%esp
+  802450:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802453:	8b 45 08             	mov    0x8(%ebp),%eax
+  802456:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  80245b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802461:	7f 2e                	jg     802491 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802463:	83 ec 04             	sub    $0x4,%esp
+  802466:	53                   	push   %ebx
+  802467:	ff 75 0c             	push   0xc(%ebp)
+  80246a:	68 0c 90 80 00       	push   $0x80900c
+  80246f:	e8 a0 e8 ff ff       	call   800d14 <memmove>
+	nsipcbuf.send.req_size = size;
+  802474:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80247a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80247d:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  802482:	b8 08 00 00 00       	mov    $0x8,%eax
+  802487:	e8 a0 fc ff ff       	call   80212c <nsipc>
+}
+  80248c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+	assert(size < 1600);
+  802491:	68 ea 42 80 00       	push   $0x8042ea
+  802496:	68 c9 42 80 00       	push   $0x8042c9
+  80249b:	68 bd 00 00 00       	push   $0xbd
+  8024a0:	68 de 42 80 00       	push   $0x8042de
+  8024a5:	e8 e8 de ff ff       	call   800392 <_panic>
+
+008024aa <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8024aa:	55                   	push   %ebp
+  8024ab:	89 e5                	mov    %esp,%ebp
+  8024ad:	57                   	push   %edi
+  8024ae:	56                   	push   %esi
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8024b3:	e8 c0 fc ff ff       	call   802178 <nsbulk_map>
+  8024b8:	85 c0                	test   %eax,%eax
+  8024ba:	78 55                	js     802511 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8024bc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8024c3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8024ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024d1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024d4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024d7:	0f 8d 24 02 00 00    	jge    802701 <nsipc_sendmsg+0x257>
+  8024dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8024e3:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8024e6:	89 d8                	mov    %ebx,%eax
+  8024e8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024ed:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+  8024f2:	68 20 60 80 00       	push   $0x806020
+  8024f7:	e8 5a 0f 00 00       	call   803456 <pgbatch_init>
+  8024fc:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024ff:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802501:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802504:	e9 82 00 00 00       	jmp    80258b <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802509:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80250c:	85 db                	test   %ebx,%ebx
+  80250e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802514:	5b                   	pop    %ebx
+  802515:	5e                   	pop    %esi
+  802516:	5f                   	pop    %edi
+  802517:	5d                   	pop    %ebp
+  802518:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802519:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80251e:	29 c8                	sub    %ecx,%eax
+  802520:	39 d0                	cmp    %edx,%eax
+  802522:	0f 46 d0             	cmovbe %eax,%edx
+  802525:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802527:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80252d:	85 ff                	test   %edi,%edi
+  80252f:	0f 49 c7             	cmovns %edi,%eax
+  802532:	c1 f8 0c             	sar    $0xc,%eax
+  802535:	ba 01 00 00 00       	mov    $0x1,%edx
+  80253a:	e8 87 fc ff ff       	call   8021c6 <nsbulk_own>
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	0f 88 17 01 00 00    	js     80265e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802547:	83 ec 04             	sub    $0x4,%esp
+  80254a:	56                   	push   %esi
+  80254b:	ff 75 e0             	push   -0x20(%ebp)
+  80254e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802551:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802556:	50                   	push   %eax
+  802557:	e8 b8 e7 ff ff       	call   800d14 <memmove>
+  80255c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80255f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802562:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802565:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802568:	0f 84 fd 00 00 00    	je     80266b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80256e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802571:	01 f7                	add    %esi,%edi
+  802573:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802576:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802579:	0f 8d 01 01 00 00    	jge    802680 <nsipc_sendmsg+0x1d6>
+  80257f:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802585:	0f 8f f0 00 00 00    	jg     80267b <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80258b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80258e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802591:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802594:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802597:	89 c2                	mov    %eax,%edx
+  802599:	03 13                	add    (%ebx),%edx
+  80259b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80259e:	8b 73 04             	mov    0x4(%ebx),%esi
+  8025a1:	29 c6                	sub    %eax,%esi
+  8025a3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8025a8:	29 f9                	sub    %edi,%ecx
+  8025aa:	39 ce                	cmp    %ecx,%esi
+  8025ac:	89 ca                	mov    %ecx,%edx
+  8025ae:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8025b1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8025b4:	89 f9                	mov    %edi,%ecx
+  8025b6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8025bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025bf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8025c4:	09 c8                	or     %ecx,%eax
+  8025c6:	0f 85 4d ff ff ff    	jne    802519 <nsipc_sendmsg+0x6f>
+  8025cc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8025d2:	0f 86 41 ff ff ff    	jbe    802519 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025d8:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8025de:	85 ff                	test   %edi,%edi
+  8025e0:	0f 49 c7             	cmovns %edi,%eax
+  8025e3:	c1 f8 0c             	sar    $0xc,%eax
+  8025e6:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8025e8:	89 d1                	mov    %edx,%ecx
+  8025ea:	c1 e9 0c             	shr    $0xc,%ecx
+  8025ed:	01 c8                	add    %ecx,%eax
+  8025ef:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8025f2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025f5:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8025f7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025fa:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8025ff:	29 c8                	sub    %ecx,%eax
+  802601:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802604:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802607:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802609:	b8 01 00 00 00       	mov    $0x1,%eax
+  80260e:	89 f9                	mov    %edi,%ecx
+  802610:	d3 e0                	shl    %cl,%eax
+  802612:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802618:	83 ec 08             	sub    $0x8,%esp
+  80261b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80261d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802620:	50                   	push   %eax
+  802621:	6a 00                	push   $0x0
+  802623:	56                   	push   %esi
+  802624:	6a 00                	push   $0x0
+  802626:	68 20 60 80 00       	push   $0x806020
+  80262b:	e8 e4 0e 00 00       	call   803514 <pgbatch_map>
+  802630:	83 c4 20             	add    $0x20,%esp
+  802633:	85 c0                	test   %eax,%eax
+  802635:	0f 88 ce fe ff ff    	js     802509 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80263b:	83 c7 01             	add    $0x1,%edi
+  80263e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802644:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802647:	39 c7                	cmp    %eax,%edi
+  802649:	75 be                	jne    802609 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80264b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80264e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802651:	89 d6                	mov    %edx,%esi
+  802653:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802659:	e9 01 ff ff ff       	jmp    80255f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80265e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802661:	85 db                	test   %ebx,%ebx
+  802663:	0f 45 c3             	cmovne %ebx,%eax
+  802666:	e9 a6 fe ff ff       	jmp    802511 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80266b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80266f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802676:	e9 f3 fe ff ff       	jmp    80256e <nsipc_sendmsg+0xc4>
+  80267b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80267e:	eb 03                	jmp    802683 <nsipc_sendmsg+0x1d9>
+  802680:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802683:	83 ec 0c             	sub    $0xc,%esp
+  802686:	68 20 60 80 00       	push   $0x806020
+  80268b:	e8 d4 0d 00 00       	call   803464 <pgbatch_flush>
+  802690:	83 c4 10             	add    $0x10,%esp
+  802693:	85 c0                	test   %eax,%eax
+  802695:	78 50                	js     8026e7 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802697:	8b 45 08             	mov    0x8(%ebp),%eax
+  80269a:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80269f:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8026a5:	89 fb                	mov    %edi,%ebx
+  8026a7:	29 f3                	sub    %esi,%ebx
+  8026a9:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8026af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026b2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8026b7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8026bc:	89 fa                	mov    %edi,%edx
+  8026be:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8026c3:	e8 66 fb ff ff       	call   80222e <nsipc_bulk>
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	78 28                	js     8026f4 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8026cc:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8026cf:	39 c3                	cmp    %eax,%ebx
+  8026d1:	75 0c                	jne    8026df <nsipc_sendmsg+0x235>
+  8026d3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026d6:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8026d9:	0f 8f f2 fd ff ff    	jg     8024d1 <nsipc_sendmsg+0x27>
+		sent += r;
+  8026df:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8026e2:	e9 2a fe ff ff       	jmp    802511 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026e7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026ea:	85 db                	test   %ebx,%ebx
+  8026ec:	0f 45 c3             	cmovne %ebx,%eax
+  8026ef:	e9 1d fe ff ff       	jmp    802511 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8026f4:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8026f7:	85 db                	test   %ebx,%ebx
+  8026f9:	0f 45 c3             	cmovne %ebx,%eax
+  8026fc:	e9 10 fe ff ff       	jmp    802511 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802701:	83 ec 0c             	sub    $0xc,%esp
+  802704:	68 20 60 80 00       	push   $0x806020
+  802709:	e8 48 0d 00 00       	call   803456 <pgbatch_init>
+  80270e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802711:	be 00 00 00 00       	mov    $0x0,%esi
+  802716:	bf 00 00 00 00       	mov    $0x0,%edi
+  80271b:	e9 63 ff ff ff       	jmp    802683 <nsipc_sendmsg+0x1d9>
+
+00802720 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	57                   	push   %edi
+  802724:	56                   	push   %esi
+  802725:	53                   	push   %ebx
+  802726:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802729:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802730:	0f 84 c8 00 00 00    	je     8027fe <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802736:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80273d:	0f 84 e4 00 00 00    	je     802827 <nsipc_sendfile+0x107>
+{
+  802743:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802748:	89 fb                	mov    %edi,%ebx
+  80274a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80274d:	0f 83 f0 00 00 00    	jae    802843 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802753:	89 fa                	mov    %edi,%edx
+  802755:	03 55 10             	add    0x10(%ebp),%edx
+  802758:	89 d0                	mov    %edx,%eax
+  80275a:	c1 f8 1f             	sar    $0x1f,%eax
+  80275d:	c1 e8 14             	shr    $0x14,%eax
+  802760:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802763:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802769:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80276b:	6a 10                	push   $0x10
+  80276d:	68 00 20 01 e0       	push   $0xe0012000
+  802772:	52                   	push   %edx
+  802773:	ff 75 0c             	push   0xc(%ebp)
+  802776:	e8 fe f4 ff ff       	call   801c79 <fmap>
+  80277b:	83 c4 10             	add    $0x10,%esp
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	0f 8e b8 00 00 00    	jle    80283e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802786:	39 c6                	cmp    %eax,%esi
+  802788:	0f 8d b5 00 00 00    	jge    802843 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80278e:	29 f0                	sub    %esi,%eax
+  802790:	8b 55 14             	mov    0x14(%ebp),%edx
+  802793:	29 da                	sub    %ebx,%edx
+  802795:	39 d0                	cmp    %edx,%eax
+  802797:	89 d3                	mov    %edx,%ebx
+  802799:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  80279c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80279f:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8027a4:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8027aa:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8027b0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8027b3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8027b8:	83 ec 0c             	sub    $0xc,%esp
+  8027bb:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8027bd:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8027c4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8027c7:	83 c0 01             	add    $0x1,%eax
+  8027ca:	50                   	push   %eax
+  8027cb:	68 00 10 01 e0       	push   $0xe0011000
+  8027d0:	6a 11                	push   $0x11
+  8027d2:	ff 35 24 63 80 00    	push   0x806324
+  8027d8:	e8 ba 12 00 00       	call   803a97 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8027dd:	83 c4 1c             	add    $0x1c,%esp
+  8027e0:	6a 00                	push   $0x0
+  8027e2:	6a 00                	push   $0x0
+  8027e4:	6a 00                	push   $0x0
+  8027e6:	e8 e8 0f 00 00       	call   8037d3 <ipc_recv>
+  8027eb:	83 c4 10             	add    $0x10,%esp
+  8027ee:	85 c0                	test   %eax,%eax
+  8027f0:	78 5b                	js     80284d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8027f2:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8027f4:	39 c3                	cmp    %eax,%ebx
+  8027f6:	0f 8e 4c ff ff ff    	jle    802748 <nsipc_sendfile+0x28>
+  8027fc:	eb 45                	jmp    802843 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8027fe:	83 ec 04             	sub    $0x4,%esp
+  802801:	6a 07                	push   $0x7
+  802803:	68 00 10 01 e0       	push   $0xe0011000
+  802808:	6a 00                	push   $0x0
+  80280a:	e8 89 e7 ff ff       	call   800f98 <sys_page_alloc>
+  80280f:	89 c7                	mov    %eax,%edi
+  802811:	83 c4 10             	add    $0x10,%esp
+  802814:	85 c0                	test   %eax,%eax
+  802816:	78 2b                	js     802843 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802818:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80281f:	00 00 00 
+  802822:	e9 0f ff ff ff       	jmp    802736 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802827:	83 ec 0c             	sub    $0xc,%esp
+  80282a:	6a 03                	push   $0x3
+  80282c:	e8 9b 12 00 00       	call   803acc <ipc_find_env>
+  802831:	a3 24 63 80 00       	mov    %eax,0x806324
+  802836:	83 c4 10             	add    $0x10,%esp
+  802839:	e9 05 ff ff ff       	jmp    802743 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80283e:	85 ff                	test   %edi,%edi
+  802840:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802843:	89 f8                	mov    %edi,%eax
+  802845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802848:	5b                   	pop    %ebx
+  802849:	5e                   	pop    %esi
+  80284a:	5f                   	pop    %edi
+  80284b:	5d                   	pop    %ebp
+  80284c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80284d:	85 ff                	test   %edi,%edi
+  80284f:	0f 44 f8             	cmove  %eax,%edi
+  802852:	eb ef                	jmp    802843 <nsipc_sendfile+0x123>
+
+00802854 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802854:	55                   	push   %ebp
+  802855:	89 e5                	mov    %esp,%ebp
+  802857:	57                   	push   %edi
+  802858:	56                   	push   %esi
+  802859:	53                   	push   %ebx
+  80285a:	83 ec 1c             	sub    $0x1c,%esp
+  80285d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802860:	e8 13 f9 ff ff       	call   802178 <nsbulk_map>
+  802865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	0f 88 ba 00 00 00    	js     80292a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802870:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802874:	0f 8e bb 00 00 00    	jle    802935 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80287a:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80287f:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802884:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802889:	89 f8                	mov    %edi,%eax
+  80288b:	29 f0                	sub    %esi,%eax
+  80288d:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  802891:	39 c8                	cmp    %ecx,%eax
+  802893:	0f 47 c1             	cmova  %ecx,%eax
+  802896:	01 f0                	add    %esi,%eax
+  802898:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80289a:	83 c2 01             	add    $0x1,%edx
+  80289d:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8028a0:	7e 07                	jle    8028a9 <nsipc_recvmsg+0x55>
+  8028a2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8028a7:	7e e0                	jle    802889 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8028a9:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8028af:	c1 fa 0c             	sar    $0xc,%edx
+  8028b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b7:	e8 0a f9 ff ff       	call   8021c6 <nsbulk_own>
+  8028bc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028bf:	85 c0                	test   %eax,%eax
+  8028c1:	78 67                	js     80292a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8028c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8028cb:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8028d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028d4:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8028d9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8028de:	89 f2                	mov    %esi,%edx
+  8028e0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8028e5:	e8 44 f9 ff ff       	call   80222e <nsipc_bulk>
+  8028ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	78 39                	js     80292a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8028f1:	39 f0                	cmp    %esi,%eax
+  8028f3:	7f 4a                	jg     80293f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8028f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fa:	85 c0                	test   %eax,%eax
+  8028fc:	7e 2c                	jle    80292a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8028fe:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802901:	29 fe                	sub    %edi,%esi
+  802903:	8b 43 04             	mov    0x4(%ebx),%eax
+  802906:	39 c6                	cmp    %eax,%esi
+  802908:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80290b:	83 ec 04             	sub    $0x4,%esp
+  80290e:	56                   	push   %esi
+  80290f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802915:	50                   	push   %eax
+  802916:	ff 33                	push   (%ebx)
+  802918:	e8 f7 e3 ff ff       	call   800d14 <memmove>
+		n += m;
+  80291d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80291f:	83 c3 08             	add    $0x8,%ebx
+  802922:	83 c4 10             	add    $0x10,%esp
+  802925:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802928:	7f d4                	jg     8028fe <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80292a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80292d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802930:	5b                   	pop    %ebx
+  802931:	5e                   	pop    %esi
+  802932:	5f                   	pop    %edi
+  802933:	5d                   	pop    %ebp
+  802934:	c3                   	ret
+	int r, i, n, len = 0;
+  802935:	be 00 00 00 00       	mov    $0x0,%esi
+  80293a:	e9 6a ff ff ff       	jmp    8028a9 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80293f:	68 c0 42 80 00       	push   $0x8042c0
+  802944:	68 c9 42 80 00       	push   $0x8042c9
+  802949:	68 3b 01 00 00       	push   $0x13b
+  80294e:	68 de 42 80 00       	push   $0x8042de
+  802953:	e8 3a da ff ff       	call   800392 <_panic>
+
+00802958 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	57                   	push   %edi
+  80295c:	56                   	push   %esi
+  80295d:	53                   	push   %ebx
+  80295e:	83 ec 0c             	sub    $0xc,%esp
+  802961:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802964:	8b 75 10             	mov    0x10(%ebp),%esi
+  802967:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80296a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296d:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.select.req_readset = *readset;
+  802972:	8b 07                	mov    (%edi),%eax
+  802974:	a3 04 90 80 00       	mov    %eax,0x809004
+  802979:	8b 47 04             	mov    0x4(%edi),%eax
+  80297c:	a3 08 90 80 00       	mov    %eax,0x809008
+  802981:	8b 47 08             	mov    0x8(%edi),%eax
+  802984:	a3 0c 90 80 00       	mov    %eax,0x80900c
+  802989:	8b 47 0c             	mov    0xc(%edi),%eax
+  80298c:	a3 10 90 80 00       	mov    %eax,0x809010
+  802991:	8b 47 10             	mov    0x10(%edi),%eax
+  802994:	a3 14 90 80 00       	mov    %eax,0x809014
+  802999:	8b 47 14             	mov    0x14(%edi),%eax
+  80299c:	a3 18 90 80 00       	mov    %eax,0x809018
+  8029a1:	8b 47 18             	mov    0x18(%edi),%eax
+  8029a4:	a3 1c 90 80 00       	mov    %eax,0x80901c
+  8029a9:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8029ac:	a3 20 90 80 00       	mov    %eax,0x809020
+  8029b1:	8b 47 20             	mov    0x20(%edi),%eax
+  8029b4:	a3 24 90 80 00       	mov    %eax,0x809024
+  8029b9:	8b 47 24             	mov    0x24(%edi),%eax
+  8029bc:	a3 28 90 80 00       	mov    %eax,0x809028
+  8029c1:	8b 47 28             	mov    0x28(%edi),%eax
+  8029c4:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  8029c9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8029cc:	a3 30 90 80 00       	mov    %eax,0x809030
+  8029d1:	8b 47 30             	mov    0x30(%edi),%eax
+  8029d4:	a3 34 90 80 00       	mov    %eax,0x809034
+  8029d9:	8b 47 34             	mov    0x34(%edi),%eax
+  8029dc:	a3 38 90 80 00       	mov    %eax,0x809038
+  8029e1:	8b 47 38             	mov    0x38(%edi),%eax
+  8029e4:	a3 3c 90 80 00       	mov    %eax,0x80903c
+  8029e9:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8029ec:	a3 40 90 80 00       	mov    %eax,0x809040
+	nsipcbuf.select.req_writeset = *writeset;
+  8029f1:	8b 06                	mov    (%esi),%eax
+  8029f3:	a3 44 90 80 00       	mov    %eax,0x809044
+  8029f8:	8b 46 04             	mov    0x4(%esi),%eax
+  8029fb:	a3 48 90 80 00       	mov    %eax,0x809048
+  802a00:	8b 46 08             	mov    0x8(%esi),%eax
+  802a03:	a3 4c 90 80 00       	mov    %eax,0x80904c
+  802a08:	8b 46 0c             	mov    0xc(%esi),%eax
+  802a0b:	a3 50 90 80 00       	mov    %eax,0x809050
+  802a10:	8b 46 10             	mov    0x10(%esi),%eax
+  802a13:	a3 54 90 80 00       	mov    %eax,0x809054
+  802a18:	8b 46 14             	mov    0x14(%esi),%eax
+  802a1b:	a3 58 90 80 00       	mov    %eax,0x809058
+  802a20:	8b 46 18             	mov    0x18(%esi),%eax
+  802a23:	a3 5c 90 80 00       	mov    %eax,0x80905c
+  802a28:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802a2b:	a3 60 90 80 00       	mov    %eax,0x809060
+  802a30:	8b 46 20             	mov    0x20(%esi),%eax
+  802a33:	a3 64 90 80 00       	mov    %eax,0x809064
+  802a38:	8b 46 24             	mov    0x24(%esi),%eax
+  802a3b:	a3 68 90 80 00       	mov    %eax,0x809068
+  802a40:	8b 46 28             	mov    0x28(%esi),%eax
+  802a43:	a3 6c 90 80 00       	mov    %eax,0x80906c
+  802a48:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802a4b:	a3 70 90 80 00       	mov    %eax,0x809070
+  802a50:	8b 46 30             	mov    0x30(%esi),%eax
+  802a53:	a3 74 90 80 00       	mov    %eax,0x809074
+  802a58:	8b 46 34             	mov    0x34(%esi),%eax
+  802a5b:	a3 78 90 80 00       	mov    %eax,0x809078
+  802a60:	8b 46 38             	mov    0x38(%esi),%eax
+  802a63:	a3 7c 90 80 00       	mov    %eax,0x80907c
+  802a68:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802a6b:	a3 80 90 80 00       	mov    %eax,0x809080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802a70:	8b 03                	mov    (%ebx),%eax
+  802a72:	a3 84 90 80 00       	mov    %eax,0x809084
+  802a77:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a7a:	a3 88 90 80 00       	mov    %eax,0x809088
+  802a7f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802a82:	a3 8c 90 80 00       	mov    %eax,0x80908c
+  802a87:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802a8a:	a3 90 90 80 00       	mov    %eax,0x809090
+  802a8f:	8b 43 10             	mov    0x10(%ebx),%eax
+  802a92:	a3 94 90 80 00       	mov    %eax,0x809094
+  802a97:	8b 43 14             	mov    0x14(%ebx),%eax
+  802a9a:	a3 98 90 80 00       	mov    %eax,0x809098
+  802a9f:	8b 43 18             	mov    0x18(%ebx),%eax
+  802aa2:	a3 9c 90 80 00       	mov    %eax,0x80909c
+  802aa7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802aaa:	a3 a0 90 80 00       	mov    %eax,0x8090a0
+  802aaf:	8b 43 20             	mov    0x20(%ebx),%eax
+  802ab2:	a3 a4 90 80 00       	mov    %eax,0x8090a4
+  802ab7:	8b 43 24             	mov    0x24(%ebx),%eax
+  802aba:	a3 a8 90 80 00       	mov    %eax,0x8090a8
+  802abf:	8b 43 28             	mov    0x28(%ebx),%eax
+  802ac2:	a3 ac 90 80 00       	mov    %eax,0x8090ac
+  802ac7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802aca:	a3 b0 90 80 00       	mov    %eax,0x8090b0
+  802acf:	8b 43 30             	mov    0x30(%ebx),%eax
+  802ad2:	a3 b4 90 80 00       	mov    %eax,0x8090b4
+  802ad7:	8b 43 34             	mov    0x34(%ebx),%eax
+  802ada:	a3 b8 90 80 00       	mov    %eax,0x8090b8
+  802adf:	8b 43 38             	mov    0x38(%ebx),%eax
+  802ae2:	a3 bc 90 80 00       	mov    %eax,0x8090bc
+  802ae7:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  802aea:	a3 c0 90 80 00       	mov    %eax,0x8090c0
+	nsipcbuf.select.req_timeout = msec;
+  802aef:	8b 45 18             	mov    0x18(%ebp),%eax
+  802af2:	a3 c4 90 80 00       	mov    %eax,0x8090c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802af7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802afc:	e8 2b f6 ff ff       	call   80212c <nsipc>
+  802b01:	85 c0                	test   %eax,%eax
+  802b03:	0f 88 ad 01 00 00    	js     802cb6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802b09:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  802b0f:	89 17                	mov    %edx,(%edi)
+  802b11:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  802b17:	89 57 04             	mov    %edx,0x4(%edi)
+  802b1a:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  802b20:	89 57 08             	mov    %edx,0x8(%edi)
+  802b23:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802b29:	89 57 0c             	mov    %edx,0xc(%edi)
+  802b2c:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  802b32:	89 57 10             	mov    %edx,0x10(%edi)
+  802b35:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  802b3b:	89 57 14             	mov    %edx,0x14(%edi)
+  802b3e:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  802b44:	89 57 18             	mov    %edx,0x18(%edi)
+  802b47:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  802b4d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802b50:	8b 15 24 90 80 00    	mov    0x809024,%edx
+  802b56:	89 57 20             	mov    %edx,0x20(%edi)
+  802b59:	8b 15 28 90 80 00    	mov    0x809028,%edx
+  802b5f:	89 57 24             	mov    %edx,0x24(%edi)
+  802b62:	8b 15 2c 90 80 00    	mov    0x80902c,%edx
+  802b68:	89 57 28             	mov    %edx,0x28(%edi)
+  802b6b:	8b 15 30 90 80 00    	mov    0x809030,%edx
+  802b71:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802b74:	8b 15 34 90 80 00    	mov    0x809034,%edx
+  802b7a:	89 57 30             	mov    %edx,0x30(%edi)
+  802b7d:	8b 15 38 90 80 00    	mov    0x809038,%edx
+  802b83:	89 57 34             	mov    %edx,0x34(%edi)
+  802b86:	8b 15 3c 90 80 00    	mov    0x80903c,%edx
+  802b8c:	89 57 38             	mov    %edx,0x38(%edi)
+  802b8f:	8b 15 40 90 80 00    	mov    0x809040,%edx
+  802b95:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802b98:	8b 15 44 90 80 00    	mov    0x809044,%edx
+  802b9e:	89 16                	mov    %edx,(%esi)
+  802ba0:	8b 15 48 90 80 00    	mov    0x809048,%edx
+  802ba6:	89 56 04             	mov    %edx,0x4(%esi)
+  802ba9:	8b 15 4c 90 80 00    	mov    0x80904c,%edx
+  802baf:	89 56 08             	mov    %edx,0x8(%esi)
+  802bb2:	8b 15 50 90 80 00    	mov    0x809050,%edx
+  802bb8:	89 56 0c             	mov    %edx,0xc(%esi)
+  802bbb:	8b 15 54 90 80 00    	mov    0x809054,%edx
+  802bc1:	89 56 10             	mov    %edx,0x10(%esi)
+  802bc4:	8b 15 58 90 80 00    	mov    0x809058,%edx
+  802bca:	89 56 14             	mov    %edx,0x14(%esi)
+  802bcd:	8b 15 5c 90 80 00    	mov    0x80905c,%edx
+  802bd3:	89 56 18             	mov    %edx,0x18(%esi)
+  802bd6:	8b 15 60 90 80 00    	mov    0x809060,%edx
+  802bdc:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802bdf:	8b 15 64 90 80 00    	mov    0x809064,%edx
+  802be5:	89 56 20             	mov    %edx,0x20(%esi)
+  802be8:	8b 15 68 90 80 00    	mov    0x809068,%edx
+  802bee:	89 56 24             	mov    %edx,0x24(%esi)
+  802bf1:	8b 15 6c 90 80 00    	mov    0x80906c,%edx
+  802bf7:	89 56 28             	mov    %edx,0x28(%esi)
+  802bfa:	8b 15 70 90 80 00    	mov    0x809070,%edx
+  802c00:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802c03:	8b 15 74 90 80 00    	mov    0x809074,%edx
+  802c09:	89 56 30             	mov    %edx,0x30(%esi)
+  802c0c:	8b 15 78 90 80 00    	mov    0x809078,%edx
+  802c12:	89 56 34             	mov    %edx,0x34(%esi)
+  802c15:	8b 15 7c 90 80 00    	mov    0x80907c,%edx
+  802c1b:	89 56 38             	mov    %edx,0x38(%esi)
+  802c1e:	8b 15 80 90 80 00    	mov    0x809080,%edx
+  802c24:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802c27:	8b 15 84 90 80 00    	mov    0x809084,%edx
+  802c2d:	89 13                	mov    %edx,(%ebx)
+  802c2f:	8b 15 88 90 80 00    	mov    0x809088,%edx
+  802c35:	89 53 04             	mov    %edx,0x4(%ebx)
+  802c38:	8b 15 8c 90 80 00    	mov    0x80908c,%edx
+  802c3e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802c41:	8b 15 90 90 80 00    	mov    0x809090,%edx
+  802c47:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802c4a:	8b 15 94 90 80 00    	mov    0x809094,%edx
+  802c50:	89 53 10             	mov    %edx,0x10(%ebx)
+  802c53:	8b 15 98 90 80 00    	mov    0x809098,%edx
+  802c59:	89 53 14             	mov    %edx,0x14(%ebx)
+  802c5c:	8b 15 9c 90 80 00    	mov    0x80909c,%edx
+  802c62:	89 53 18             	mov    %edx,0x18(%ebx)
+  802c65:	8b 15 a0 90 80 00    	mov    0x8090a0,%edx
+  802c6b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802c6e:	8b 15 a4 90 80 00    	mov    0x8090a4,%edx
+  802c74:	89 53 20             	mov    %edx,0x20(%ebx)
+  802c77:	8b 15 a8 90 80 00    	mov    0x8090a8,%edx
+  802c7d:	89 53 24             	mov    %edx,0x24(%ebx)
+  802c80:	8b 15 ac 90 80 00    	mov    0x8090ac,%edx
+  802c86:	89 53 28             	mov    %edx,0x28(%ebx)
+  802c89:	8b 15 b0 90 80 00    	mov    0x8090b0,%edx
+  802c8f:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802c92:	8b 15 b4 90 80 00    	mov    0x8090b4,%edx
+  802c98:	89 53 30             	mov    %edx,0x30(%ebx)
+  802c9b:	8b 15 b8 90 80 00    	mov    0x8090b8,%edx
+  802ca1:	89 53 34             	mov    %edx,0x34(%ebx)
+  802ca4:	8b 15 bc 90 80 00    	mov    0x8090bc,%edx
+  802caa:	89 53 38             	mov    %edx,0x38(%ebx)
+  802cad:	8b 15 c0 90 80 00    	mov    0x8090c0,%edx
+  802cb3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802cb6:	83 c4 0c             	add    $0xc,%esp
+  802cb9:	5b                   	pop    %ebx
+  802cba:	5e                   	pop    %esi
+  802cbb:	5f                   	pop    %edi
+  802cbc:	5d                   	pop    %ebp
+  802cbd:	c3                   	ret
+
+00802cbe <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802cbe:	55                   	push   %ebp
+  802cbf:	89 e5                	mov    %esp,%ebp
+  802cc1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cc7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.evctl.req_events = events;
+  802ccc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ccf:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.evctl.req_data = data;
+  802cd4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cd7:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_EVCTL);
+  802cdc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ce1:	e8 46 f4 ff ff       	call   80212c <nsipc>
+}
+  802ce6:	c9                   	leave
+  802ce7:	c3                   	ret
+
+00802ce8 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	56                   	push   %esi
+  802cec:	53                   	push   %ebx
+  802ced:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802cf0:	89 35 00 90 80 00    	mov    %esi,0x809000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802cf6:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cf9:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802cfe:	b8 10 00 00 00       	mov    $0x10,%eax
+  802d03:	e8 24 f4 ff ff       	call   80212c <nsipc>
+  802d08:	89 c3                	mov    %eax,%ebx
+  802d0a:	85 c0                	test   %eax,%eax
+  802d0c:	7e 1f                	jle    802d2d <nsipc_evwait+0x45>
+		assert(r <= max);
+  802d0e:	39 c6                	cmp    %eax,%esi
+  802d10:	7c 24                	jl     802d36 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802d12:	83 ec 04             	sub    $0x4,%esp
+  802d15:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802d1c:	50                   	push   %eax
+  802d1d:	68 00 90 80 00       	push   $0x809000
+  802d22:	ff 75 08             	push   0x8(%ebp)
+  802d25:	e8 ea df ff ff       	call   800d14 <memmove>
+  802d2a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802d2d:	89 d8                	mov    %ebx,%eax
+  802d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d32:	5b                   	pop    %ebx
+  802d33:	5e                   	pop    %esi
+  802d34:	5d                   	pop    %ebp
+  802d35:	c3                   	ret
+		assert(r <= max);
+  802d36:	68 f6 42 80 00       	push   $0x8042f6
+  802d3b:	68 c9 42 80 00       	push   $0x8042c9
+  802d40:	68 6a 01 00 00       	push   $0x16a
+  802d45:	68 de 42 80 00       	push   $0x8042de
+  802d4a:	e8 43 d6 ff ff       	call   800392 <_panic>
+
+00802d4f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802d4f:	55                   	push   %ebp
+  802d50:	89 e5                	mov    %esp,%ebp
+  802d52:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802d55:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d58:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  802d5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d60:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  802d65:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d68:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  802d6d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802d72:	e8 b5 f3 ff ff       	call   80212c <nsipc>
+}
+  802d77:	c9                   	leave
+  802d78:	c3                   	ret
+
+00802d79 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802d79:	55                   	push   %ebp
+  802d7a:	89 e5                	mov    %esp,%ebp
+  802d7c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802d7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d82:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_OFFLOAD);
+  802d87:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802d8c:	e8 9b f3 ff ff       	call   80212c <nsipc>
+}
+  802d91:	c9                   	leave
+  802d92:	c3                   	ret
+
+00802d93 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802d93:	55                   	push   %ebp
+  802d94:	89 e5                	mov    %esp,%ebp
+  802d96:	53                   	push   %ebx
+  802d97:	83 ec 04             	sub    $0x4,%esp
+  802d9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802d9d:	b8 12 00 00 00       	mov    $0x12,%eax
+  802da2:	e8 85 f3 ff ff       	call   80212c <nsipc>
+  802da7:	85 c0                	test   %eax,%eax
+  802da9:	78 50                	js     802dfb <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802dab:	8b 15 00 90 80 00    	mov    0x809000,%edx
+  802db1:	89 13                	mov    %edx,(%ebx)
+  802db3:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  802db9:	89 53 04             	mov    %edx,0x4(%ebx)
+  802dbc:	8b 15 08 90 80 00    	mov    0x809008,%edx
+  802dc2:	89 53 08             	mov    %edx,0x8(%ebx)
+  802dc5:	8b 15 0c 90 80 00    	mov    0x80900c,%edx
+  802dcb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802dce:	8b 15 10 90 80 00    	mov    0x809010,%edx
+  802dd4:	89 53 10             	mov    %edx,0x10(%ebx)
+  802dd7:	8b 15 14 90 80 00    	mov    0x809014,%edx
+  802ddd:	89 53 14             	mov    %edx,0x14(%ebx)
+  802de0:	8b 15 18 90 80 00    	mov    0x809018,%edx
+  802de6:	89 53 18             	mov    %edx,0x18(%ebx)
+  802de9:	8b 15 1c 90 80 00    	mov    0x80901c,%edx
+  802def:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802df2:	8b 15 20 90 80 00    	mov    0x809020,%edx
+  802df8:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802dfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dfe:	c9                   	leave
+  802dff:	c3                   	ret
+
+00802e00 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802e00:	55                   	push   %ebp
+  802e01:	89 e5                	mov    %esp,%ebp
+  802e03:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802e06:	6a 03                	push   $0x3
+  802e08:	e8 bf 0c 00 00       	call   803acc <ipc_find_env>
+  802e0d:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802e12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e15:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802e1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802e1f:	e8 08 f3 ff ff       	call   80212c <nsipc>
+  802e24:	83 c4 10             	add    $0x10,%esp
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	78 0a                	js     802e35 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802e2b:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802e30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e35:	c9                   	leave
+  802e36:	c3                   	ret
+
+00802e37 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802e37:	55                   	push   %ebp
+  802e38:	89 e5                	mov    %esp,%ebp
+  802e3a:	57                   	push   %edi
+  802e3b:	56                   	push   %esi
+  802e3c:	53                   	push   %ebx
+  802e3d:	83 ec 1c             	sub    $0x1c,%esp
+  802e40:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802e43:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802e46:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802e4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e50:	89 e0                	mov    %esp,%eax
+  802e52:	89 f2                	mov    %esi,%edx
+  802e54:	29 c2                	sub    %eax,%edx
+  802e56:	89 d0                	mov    %edx,%eax
+  802e58:	c1 e8 0f             	shr    $0xf,%eax
+  802e5b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802e61:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802e64:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  802e6b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802e6e:	83 ec 0c             	sub    $0xc,%esp
+  802e71:	ff 75 e0             	push   -0x20(%ebp)
+  802e74:	e8 92 0c 00 00       	call   803b0b <pageref>
+  802e79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e7c:	83 c4 04             	add    $0x4,%esp
+  802e7f:	ff 75 dc             	push   -0x24(%ebp)
+  802e82:	e8 84 0c 00 00       	call   803b0b <pageref>
+  802e87:	89 e2                	mov    %esp,%edx
+  802e89:	89 f1                	mov    %esi,%ecx
+  802e8b:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802e8d:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802e90:	89 ca                	mov    %ecx,%edx
+  802e92:	c1 ea 0f             	shr    $0xf,%edx
+  802e95:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802e9b:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802e9e:	8b 14 95 40 73 80 00 	mov    0x807340(,%edx,4),%edx
+  802ea5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802ea8:	39 d7                	cmp    %edx,%edi
+  802eaa:	74 40                	je     802eec <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802eac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802eaf:	75 9f                	jne    802e50 <_pipeisclosed+0x19>
+  802eb1:	89 e2                	mov    %esp,%edx
+  802eb3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802eb8:	29 d0                	sub    %edx,%eax
+  802eba:	89 c2                	mov    %eax,%edx
+  802ebc:	c1 ea 0f             	shr    $0xf,%edx
+  802ebf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ec4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ecc:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  802ed3:	8b 40 58             	mov    0x58(%eax),%eax
+  802ed6:	6a 01                	push   $0x1
+  802ed8:	50                   	push   %eax
+  802ed9:	57                   	push   %edi
+  802eda:	68 ff 42 80 00       	push   $0x8042ff
+  802edf:	e8 89 d5 ff ff       	call   80046d <cprintf>
+  802ee4:	83 c4 10             	add    $0x10,%esp
+  802ee7:	e9 5f ff ff ff       	jmp    802e4b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802eec:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802eef:	0f 94 c0             	sete   %al
+  802ef2:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef8:	5b                   	pop    %ebx
+  802ef9:	5e                   	pop    %esi
+  802efa:	5f                   	pop    %edi
+  802efb:	5d                   	pop    %ebp
+  802efc:	c3                   	ret
+
+00802efd <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802efd:	55                   	push   %ebp
+  802efe:	89 e5                	mov    %esp,%ebp
+  802f00:	53                   	push   %ebx
+  802f01:	83 ec 0c             	sub    $0xc,%esp
+  802f04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802f07:	53                   	push   %ebx
+  802f08:	6a 00                	push   $0x0
+  802f0a:	e8 0e e1 ff ff       	call   80101d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802f0f:	89 1c 24             	mov    %ebx,(%esp)
+  802f12:	e8 f4 e4 ff ff       	call   80140b <fd2data>
+  802f17:	83 c4 08             	add    $0x8,%esp
+  802f1a:	50                   	push   %eax
+  802f1b:	6a 00                	push   $0x0
+  802f1d:	e8 fb e0 ff ff       	call   80101d <sys_page_unmap>
+}
+  802f22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f25:	c9                   	leave
+  802f26:	c3                   	ret
+
+00802f27 <devpipe_read>:
+{
+  802f27:	55                   	push   %ebp
+  802f28:	89 e5                	mov    %esp,%ebp
+  802f2a:	57                   	push   %edi
+  802f2b:	56                   	push   %esi
+  802f2c:	53                   	push   %ebx
+  802f2d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802f30:	ff 75 08             	push   0x8(%ebp)
+  802f33:	e8 d3 e4 ff ff       	call   80140b <fd2data>
+  802f38:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f3a:	8b 70 04             	mov    0x4(%eax),%esi
+  802f3d:	8b 00                	mov    (%eax),%eax
+  802f3f:	83 c4 10             	add    $0x10,%esp
+  802f42:	39 f0                	cmp    %esi,%eax
+  802f44:	75 36                	jne    802f7c <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802f46:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802f49:	89 da                	mov    %ebx,%edx
+  802f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f4e:	e8 e4 fe ff ff       	call   802e37 <_pipeisclosed>
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	0f 85 d4 00 00 00    	jne    80302f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802f5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f60:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802f64:	83 ec 04             	sub    $0x4,%esp
+  802f67:	6a ff                	push   $0xffffffff
+  802f69:	56                   	push   %esi
+  802f6a:	57                   	push   %edi
+  802f6b:	e8 26 e4 ff ff       	call   801396 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802f70:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f73:	8b 03                	mov    (%ebx),%eax
+  802f75:	83 c4 10             	add    $0x10,%esp
+  802f78:	39 c6                	cmp    %eax,%esi
+  802f7a:	74 cd                	je     802f49 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f7c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802f7f:	8b 03                	mov    (%ebx),%eax
+  802f81:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802f87:	29 c6                	sub    %eax,%esi
+  802f89:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f8e:	f7 e6                	mul    %esi
+  802f90:	c1 ea 0c             	shr    $0xc,%edx
+  802f93:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f99:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802f9b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f9e:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802fa2:	8b 0b                	mov    (%ebx),%ecx
+  802fa4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fa9:	f7 e1                	mul    %ecx
+  802fab:	c1 ea 0b             	shr    $0xb,%edx
+  802fae:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802fb4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802fb6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802fbb:	29 cf                	sub    %ecx,%edi
+  802fbd:	39 f7                	cmp    %esi,%edi
+  802fbf:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802fc2:	83 ec 04             	sub    $0x4,%esp
+  802fc5:	57                   	push   %edi
+  802fc6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802fca:	50                   	push   %eax
+  802fcb:	ff 75 0c             	push   0xc(%ebp)
+  802fce:	e8 41 dd ff ff       	call   800d14 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802fd3:	83 c4 0c             	add    $0xc,%esp
+  802fd6:	89 f0                	mov    %esi,%eax
+  802fd8:	29 f8                	sub    %edi,%eax
+  802fda:	50                   	push   %eax
+  802fdb:	8d 43 10             	lea    0x10(%ebx),%eax
+  802fde:	50                   	push   %eax
+  802fdf:	89 f8                	mov    %edi,%eax
+  802fe1:	03 45 0c             	add    0xc(%ebp),%eax
+  802fe4:	50                   	push   %eax
+  802fe5:	e8 2a dd ff ff       	call   800d14 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802fea:	8b 0b                	mov    (%ebx),%ecx
+  802fec:	01 f1                	add    %esi,%ecx
+  802fee:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ff3:	f7 e1                	mul    %ecx
+  802ff5:	c1 ea 0c             	shr    $0xc,%edx
+  802ff8:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802ffe:	29 c1                	sub    %eax,%ecx
+  803000:	89 0b                	mov    %ecx,(%ebx)
+  803002:	b8 00 00 00 00       	mov    $0x0,%eax
+  803007:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  80300b:	83 c4 10             	add    $0x10,%esp
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	75 0a                	jne    80301c <devpipe_read+0xf5>
+	return n;
+  803012:	89 f0                	mov    %esi,%eax
+}
+  803014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803017:	5b                   	pop    %ebx
+  803018:	5e                   	pop    %esi
+  803019:	5f                   	pop    %edi
+  80301a:	5d                   	pop    %ebp
+  80301b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  80301c:	83 ec 08             	sub    $0x8,%esp
+  80301f:	68 00 04 00 00       	push   $0x400
+  803024:	53                   	push   %ebx
+  803025:	e8 8e e3 ff ff       	call   8013b8 <sys_futex_wake>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	eb e3                	jmp    803012 <devpipe_read+0xeb>
+			return 0;
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803034:	eb de                	jmp    803014 <devpipe_read+0xed>
+
+00803036 <devpipe_write>:
+{
+  803036:	55                   	push   %ebp
+  803037:	89 e5                	mov    %esp,%ebp
+  803039:	57                   	push   %edi
+  80303a:	56                   	push   %esi
+  80303b:	53                   	push   %ebx
+  80303c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  80303f:	ff 75 08             	push   0x8(%ebp)
+  803042:	e8 c4 e3 ff ff       	call   80140b <fd2data>
+  803047:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803049:	83 c4 10             	add    $0x10,%esp
+  80304c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803053:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803058:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80305c:	0f 84 43 01 00 00    	je     8031a5 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803062:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803065:	8b 06                	mov    (%esi),%eax
+  803067:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80306d:	29 c1                	sub    %eax,%ecx
+  80306f:	89 c8                	mov    %ecx,%eax
+  803071:	f7 e7                	mul    %edi
+  803073:	c1 ea 0c             	shr    $0xc,%edx
+  803076:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80307c:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80307e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803084:	75 52                	jne    8030d8 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803086:	89 f2                	mov    %esi,%edx
+  803088:	8b 45 08             	mov    0x8(%ebp),%eax
+  80308b:	e8 a7 fd ff ff       	call   802e37 <_pipeisclosed>
+  803090:	85 c0                	test   %eax,%eax
+  803092:	0f 85 28 01 00 00    	jne    8031c0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803098:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80309a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80309d:	8b 06                	mov    (%esi),%eax
+  80309f:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030a5:	29 c1                	sub    %eax,%ecx
+  8030a7:	89 c8                	mov    %ecx,%eax
+  8030a9:	f7 e7                	mul    %edi
+  8030ab:	c1 ea 0c             	shr    $0xc,%edx
+  8030ae:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030b4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  8030b6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8030bc:	75 a4                	jne    803062 <devpipe_write+0x2c>
+  8030be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  8030c7:	83 ec 04             	sub    $0x4,%esp
+  8030ca:	6a ff                	push   $0xffffffff
+  8030cc:	53                   	push   %ebx
+  8030cd:	56                   	push   %esi
+  8030ce:	e8 c3 e2 ff ff       	call   801396 <sys_futex_wait>
+}
+  8030d3:	83 c4 10             	add    $0x10,%esp
+  8030d6:	eb 8a                	jmp    803062 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030d8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030db:	8b 06                	mov    (%esi),%eax
+  8030dd:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030e3:	29 c1                	sub    %eax,%ecx
+  8030e5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8030ea:	f7 e1                	mul    %ecx
+  8030ec:	c1 ea 0c             	shr    $0xc,%edx
+  8030ef:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030f5:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8030f7:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8030fc:	89 d8                	mov    %ebx,%eax
+  8030fe:	29 c8                	sub    %ecx,%eax
+  803100:	8b 55 10             	mov    0x10(%ebp),%edx
+  803103:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803106:	29 ca                	sub    %ecx,%edx
+  803108:	39 d0                	cmp    %edx,%eax
+  80310a:	0f 46 d0             	cmovbe %eax,%edx
+  80310d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803110:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803113:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803118:	f7 e1                	mul    %ecx
+  80311a:	c1 ea 0b             	shr    $0xb,%edx
+  80311d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803123:	89 ca                	mov    %ecx,%edx
+  803125:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803127:	29 d3                	sub    %edx,%ebx
+  803129:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80312c:	39 c3                	cmp    %eax,%ebx
+  80312e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803131:	83 ec 04             	sub    $0x4,%esp
+  803134:	53                   	push   %ebx
+  803135:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803138:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80313b:	51                   	push   %ecx
+  80313c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803140:	50                   	push   %eax
+  803141:	e8 ce db ff ff       	call   800d14 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803146:	83 c4 0c             	add    $0xc,%esp
+  803149:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80314c:	29 d8                	sub    %ebx,%eax
+  80314e:	50                   	push   %eax
+  80314f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803152:	01 cb                	add    %ecx,%ebx
+  803154:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803157:	53                   	push   %ebx
+  803158:	8d 46 10             	lea    0x10(%esi),%eax
+  80315b:	50                   	push   %eax
+  80315c:	e8 b3 db ff ff       	call   800d14 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803161:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803164:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803167:	01 c1                	add    %eax,%ecx
+  803169:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80316e:	f7 e1                	mul    %ecx
+  803170:	c1 ea 0c             	shr    $0xc,%edx
+  803173:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803179:	89 ca                	mov    %ecx,%edx
+  80317b:	29 c2                	sub    %eax,%edx
+  80317d:	89 56 04             	mov    %edx,0x4(%esi)
+  803180:	b8 00 00 00 00       	mov    $0x0,%eax
+  803185:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	75 1a                	jne    8031aa <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803190:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803193:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803196:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803199:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80319c:	0f 82 c0 fe ff ff    	jb     803062 <devpipe_write+0x2c>
+  8031a2:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8031a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8031a8:	eb 1b                	jmp    8031c5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8031aa:	83 ec 08             	sub    $0x8,%esp
+  8031ad:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8031b2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8031b5:	50                   	push   %eax
+  8031b6:	e8 fd e1 ff ff       	call   8013b8 <sys_futex_wake>
+  8031bb:	83 c4 10             	add    $0x10,%esp
+  8031be:	eb d0                	jmp    803190 <devpipe_write+0x15a>
+				return 0;
+  8031c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031c8:	5b                   	pop    %ebx
+  8031c9:	5e                   	pop    %esi
+  8031ca:	5f                   	pop    %edi
+  8031cb:	5d                   	pop    %ebp
+  8031cc:	c3                   	ret
+
+008031cd <devpipe_stat>:
+{
+  8031cd:	55                   	push   %ebp
+  8031ce:	89 e5                	mov    %esp,%ebp
+  8031d0:	56                   	push   %esi
+  8031d1:	53                   	push   %ebx
+  8031d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8031d5:	83 ec 0c             	sub    $0xc,%esp
+  8031d8:	ff 75 08             	push   0x8(%ebp)
+  8031db:	e8 2b e2 ff ff       	call   80140b <fd2data>
+  8031e0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8031e2:	83 c4 08             	add    $0x8,%esp
+  8031e5:	68 12 43 80 00       	push   $0x804312
+  8031ea:	53                   	push   %ebx
+  8031eb:	e8 74 d9 ff ff       	call   800b64 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031f0:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8031f3:	8b 06                	mov    (%esi),%eax
+  8031f5:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8031fb:	29 c1                	sub    %eax,%ecx
+  8031fd:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803202:	89 c8                	mov    %ecx,%eax
+  803204:	f7 e2                	mul    %edx
+  803206:	c1 ea 0c             	shr    $0xc,%edx
+  803209:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80320f:	29 d1                	sub    %edx,%ecx
+  803211:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803217:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80321e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803221:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803228:	50 80 00 
+}
+  80322b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803233:	5b                   	pop    %ebx
+  803234:	5e                   	pop    %esi
+  803235:	5d                   	pop    %ebp
+  803236:	c3                   	ret
+
+00803237 <devpipe_poll>:
+{
+  803237:	55                   	push   %ebp
+  803238:	89 e5                	mov    %esp,%ebp
+  80323a:	57                   	push   %edi
+  80323b:	56                   	push   %esi
+  80323c:	53                   	push   %ebx
+  80323d:	83 ec 18             	sub    $0x18,%esp
+  803240:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803243:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803246:	57                   	push   %edi
+  803247:	e8 bf e1 ff ff       	call   80140b <fd2data>
+  80324c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80324e:	83 c4 10             	add    $0x10,%esp
+  803251:	89 f3                	mov    %esi,%ebx
+  803253:	83 e3 01             	and    $0x1,%ebx
+  803256:	75 27                	jne    80327f <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803258:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80325e:	75 48                	jne    8032a8 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803260:	89 ca                	mov    %ecx,%edx
+  803262:	89 f8                	mov    %edi,%eax
+  803264:	e8 ce fb ff ff       	call   802e37 <_pipeisclosed>
+  803269:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80326b:	89 d8                	mov    %ebx,%eax
+  80326d:	83 c8 10             	or     $0x10,%eax
+  803270:	85 d2                	test   %edx,%edx
+  803272:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803275:	89 d8                	mov    %ebx,%eax
+  803277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80327a:	5b                   	pop    %ebx
+  80327b:	5e                   	pop    %esi
+  80327c:	5f                   	pop    %edi
+  80327d:	5d                   	pop    %ebp
+  80327e:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80327f:	8b 58 04             	mov    0x4(%eax),%ebx
+  803282:	8b 00                	mov    (%eax),%eax
+  803284:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80328a:	29 c3                	sub    %eax,%ebx
+  80328c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803291:	89 d8                	mov    %ebx,%eax
+  803293:	f7 e2                	mul    %edx
+  803295:	c1 ea 0c             	shr    $0xc,%edx
+  803298:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80329e:	39 d3                	cmp    %edx,%ebx
+  8032a0:	0f 95 c3             	setne  %bl
+  8032a3:	0f b6 db             	movzbl %bl,%ebx
+  8032a6:	eb b0                	jmp    803258 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8032a8:	8b 71 04             	mov    0x4(%ecx),%esi
+  8032ab:	8b 01                	mov    (%ecx),%eax
+  8032ad:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8032b3:	29 c6                	sub    %eax,%esi
+  8032b5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8032ba:	89 f0                	mov    %esi,%eax
+  8032bc:	f7 e2                	mul    %edx
+  8032be:	c1 ea 0c             	shr    $0xc,%edx
+  8032c1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8032c7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8032c9:	89 d8                	mov    %ebx,%eax
+  8032cb:	83 c8 04             	or     $0x4,%eax
+  8032ce:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8032d4:	0f 42 d8             	cmovb  %eax,%ebx
+  8032d7:	eb 87                	jmp    803260 <devpipe_poll+0x29>
+
+008032d9 <pipe>:
+{
+  8032d9:	55                   	push   %ebp
+  8032da:	89 e5                	mov    %esp,%ebp
+  8032dc:	56                   	push   %esi
+  8032dd:	53                   	push   %ebx
+  8032de:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8032e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032e4:	50                   	push   %eax
+  8032e5:	e8 38 e1 ff ff       	call   801422 <fd_alloc>
+  8032ea:	89 c3                	mov    %eax,%ebx
+  8032ec:	83 c4 10             	add    $0x10,%esp
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	0f 88 23 01 00 00    	js     80341a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8032f7:	83 ec 04             	sub    $0x4,%esp
+  8032fa:	68 07 04 00 00       	push   $0x407
+  8032ff:	ff 75 f4             	push   -0xc(%ebp)
+  803302:	6a 00                	push   $0x0
+  803304:	e8 8f dc ff ff       	call   800f98 <sys_page_alloc>
+  803309:	89 c3                	mov    %eax,%ebx
+  80330b:	83 c4 10             	add    $0x10,%esp
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	0f 88 04 01 00 00    	js     80341a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803316:	83 ec 0c             	sub    $0xc,%esp
+  803319:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80331c:	50                   	push   %eax
+  80331d:	e8 00 e1 ff ff       	call   801422 <fd_alloc>
+  803322:	89 c3                	mov    %eax,%ebx
+  803324:	83 c4 10             	add    $0x10,%esp
+  803327:	85 c0                	test   %eax,%eax
+  803329:	0f 88 db 00 00 00    	js     80340a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80332f:	83 ec 04             	sub    $0x4,%esp
+  803332:	68 07 04 00 00       	push   $0x407
+  803337:	ff 75 f0             	push   -0x10(%ebp)
+  80333a:	6a 00                	push   $0x0
+  80333c:	e8 57 dc ff ff       	call   800f98 <sys_page_alloc>
+  803341:	89 c3                	mov    %eax,%ebx
+  803343:	83 c4 10             	add    $0x10,%esp
+  803346:	85 c0                	test   %eax,%eax
+  803348:	0f 88 bc 00 00 00    	js     80340a <pipe+0x131>
+	va = fd2data(fd0);
+  80334e:	83 ec 0c             	sub    $0xc,%esp
+  803351:	ff 75 f4             	push   -0xc(%ebp)
+  803354:	e8 b2 e0 ff ff       	call   80140b <fd2data>
+  803359:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80335b:	83 c4 0c             	add    $0xc,%esp
+  80335e:	68 07 04 00 00       	push   $0x407
+  803363:	50                   	push   %eax
+  803364:	6a 00                	push   $0x0
+  803366:	e8 2d dc ff ff       	call   800f98 <sys_page_alloc>
+  80336b:	89 c3                	mov    %eax,%ebx
+  80336d:	83 c4 10             	add    $0x10,%esp
+  803370:	85 c0                	test   %eax,%eax
+  803372:	0f 88 82 00 00 00    	js     8033fa <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803378:	83 ec 0c             	sub    $0xc,%esp
+  80337b:	ff 75 f0             	push   -0x10(%ebp)
+  80337e:	e8 88 e0 ff ff       	call   80140b <fd2data>
+  803383:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80338a:	50                   	push   %eax
+  80338b:	6a 00                	push   $0x0
+  80338d:	56                   	push   %esi
+  80338e:	6a 00                	push   $0x0
+  803390:	e8 46 dc ff ff       	call   800fdb <sys_page_map>
+  803395:	89 c3                	mov    %eax,%ebx
+  803397:	83 c4 20             	add    $0x20,%esp
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	78 4e                	js     8033ec <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80339e:	a1 60 50 80 00       	mov    0x805060,%eax
+  8033a3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033a6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8033a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8033ab:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8033b2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8033b5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8033b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8033ba:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8033c1:	83 ec 0c             	sub    $0xc,%esp
+  8033c4:	ff 75 f4             	push   -0xc(%ebp)
+  8033c7:	e8 2f e0 ff ff       	call   8013fb <fd2num>
+  8033cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033cf:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8033d1:	83 c4 04             	add    $0x4,%esp
+  8033d4:	ff 75 f0             	push   -0x10(%ebp)
+  8033d7:	e8 1f e0 ff ff       	call   8013fb <fd2num>
+  8033dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8033df:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8033e2:	83 c4 10             	add    $0x10,%esp
+  8033e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8033ea:	eb 2e                	jmp    80341a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8033ec:	83 ec 08             	sub    $0x8,%esp
+  8033ef:	56                   	push   %esi
+  8033f0:	6a 00                	push   $0x0
+  8033f2:	e8 26 dc ff ff       	call   80101d <sys_page_unmap>
+  8033f7:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8033fa:	83 ec 08             	sub    $0x8,%esp
+  8033fd:	ff 75 f0             	push   -0x10(%ebp)
+  803400:	6a 00                	push   $0x0
+  803402:	e8 16 dc ff ff       	call   80101d <sys_page_unmap>
+  803407:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80340a:	83 ec 08             	sub    $0x8,%esp
+  80340d:	ff 75 f4             	push   -0xc(%ebp)
+  803410:	6a 00                	push   $0x0
+  803412:	e8 06 dc ff ff       	call   80101d <sys_page_unmap>
+  803417:	83 c4 10             	add    $0x10,%esp
+}
+  80341a:	89 d8                	mov    %ebx,%eax
+  80341c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80341f:	5b                   	pop    %ebx
+  803420:	5e                   	pop    %esi
+  803421:	5d                   	pop    %ebp
+  803422:	c3                   	ret
+
+00803423 <pipeisclosed>:
+{
+  803423:	55                   	push   %ebp
+  803424:	89 e5                	mov    %esp,%ebp
+  803426:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803429:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80342c:	50                   	push   %eax
+  80342d:	ff 75 08             	push   0x8(%ebp)
+  803430:	e8 3d e0 ff ff       	call   801472 <fd_lookup>
+  803435:	83 c4 10             	add    $0x10,%esp
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	78 18                	js     803454 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80343c:	83 ec 0c             	sub    $0xc,%esp
+  80343f:	ff 75 f4             	push   -0xc(%ebp)
+  803442:	e8 c4 df ff ff       	call   80140b <fd2data>
+  803447:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803449:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80344c:	e8 e6 f9 ff ff       	call   802e37 <_pipeisclosed>
+  803451:	83 c4 10             	add    $0x10,%esp
+}
+  803454:	c9                   	leave
+  803455:	c3                   	ret
+
+00803456 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803456:	55                   	push   %ebp
+  803457:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803459:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803462:	5d                   	pop    %ebp
+  803463:	c3                   	ret
+
+00803464 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803464:	55                   	push   %ebp
+  803465:	89 e5                	mov    %esp,%ebp
+  803467:	53                   	push   %ebx
+  803468:	83 ec 04             	sub    $0x4,%esp
+  80346b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80346e:	8b 03                	mov    (%ebx),%eax
+  803470:	85 c0                	test   %eax,%eax
+  803472:	75 05                	jne    803479 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803477:	c9                   	leave
+  803478:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803479:	83 ec 08             	sub    $0x8,%esp
+  80347c:	50                   	push   %eax
+  80347d:	8d 43 04             	lea    0x4(%ebx),%eax
+  803480:	50                   	push   %eax
+  803481:	e8 e7 dd ff ff       	call   80126d <sys_page_batch>
+	pb->pb_n = 0;
+  803486:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80348c:	83 c4 10             	add    $0x10,%esp
+  80348f:	eb e3                	jmp    803474 <pgbatch_flush+0x10>
+
+00803491 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803491:	55                   	push   %ebp
+  803492:	89 e5                	mov    %esp,%ebp
+  803494:	56                   	push   %esi
+  803495:	53                   	push   %ebx
+  803496:	89 c3                	mov    %eax,%ebx
+  803498:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80349a:	83 38 20             	cmpl   $0x20,(%eax)
+  80349d:	74 2c                	je     8034cb <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  80349f:	8b 03                	mov    (%ebx),%eax
+  8034a1:	8d 50 01             	lea    0x1(%eax),%edx
+  8034a4:	89 13                	mov    %edx,(%ebx)
+  8034a6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8034a9:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8034ad:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8034af:	83 ec 04             	sub    $0x4,%esp
+  8034b2:	6a 18                	push   $0x18
+  8034b4:	6a 00                	push   $0x0
+  8034b6:	50                   	push   %eax
+  8034b7:	e8 23 d8 ff ff       	call   800cdf <memset>
+	return 0;
+  8034bc:	83 c4 10             	add    $0x10,%esp
+  8034bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034c7:	5b                   	pop    %ebx
+  8034c8:	5e                   	pop    %esi
+  8034c9:	5d                   	pop    %ebp
+  8034ca:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8034cb:	83 ec 0c             	sub    $0xc,%esp
+  8034ce:	50                   	push   %eax
+  8034cf:	e8 90 ff ff ff       	call   803464 <pgbatch_flush>
+  8034d4:	83 c4 10             	add    $0x10,%esp
+  8034d7:	85 c0                	test   %eax,%eax
+  8034d9:	79 c4                	jns    80349f <pgbatch_slot+0xe>
+  8034db:	eb e7                	jmp    8034c4 <pgbatch_slot+0x33>
+
+008034dd <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034e3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e9:	e8 a3 ff ff ff       	call   803491 <pgbatch_slot>
+  8034ee:	85 c0                	test   %eax,%eax
+  8034f0:	78 20                	js     803512 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8034f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f5:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8034fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034fe:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803501:	8b 55 10             	mov    0x10(%ebp),%edx
+  803504:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803507:	8b 55 14             	mov    0x14(%ebp),%edx
+  80350a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80350d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803512:	c9                   	leave
+  803513:	c3                   	ret
+
+00803514 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803514:	55                   	push   %ebp
+  803515:	89 e5                	mov    %esp,%ebp
+  803517:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80351a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80351d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803520:	e8 6c ff ff ff       	call   803491 <pgbatch_slot>
+  803525:	85 c0                	test   %eax,%eax
+  803527:	78 2c                	js     803555 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80352c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803532:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803535:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803538:	8b 55 10             	mov    0x10(%ebp),%edx
+  80353b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80353e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803541:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803544:	8b 55 18             	mov    0x18(%ebp),%edx
+  803547:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80354a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80354d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803550:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803555:	c9                   	leave
+  803556:	c3                   	ret
+
+00803557 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803557:	55                   	push   %ebp
+  803558:	89 e5                	mov    %esp,%ebp
+  80355a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80355d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803560:	8b 45 08             	mov    0x8(%ebp),%eax
+  803563:	e8 29 ff ff ff       	call   803491 <pgbatch_slot>
+  803568:	85 c0                	test   %eax,%eax
+  80356a:	78 1a                	js     803586 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80356c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80356f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803575:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803578:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80357b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80357e:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803581:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803586:	c9                   	leave
+  803587:	c3                   	ret
+
+00803588 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803588:	55                   	push   %ebp
+  803589:	89 e5                	mov    %esp,%ebp
+  80358b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80358e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803591:	8b 45 08             	mov    0x8(%ebp),%eax
+  803594:	e8 f8 fe ff ff       	call   803491 <pgbatch_slot>
+  803599:	85 c0                	test   %eax,%eax
+  80359b:	78 20                	js     8035bd <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  80359d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035a0:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8035a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035a9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8035ac:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035af:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8035b2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035b5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035bd:	c9                   	leave
+  8035be:	c3                   	ret
+
+008035bf <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8035bf:	55                   	push   %ebp
+  8035c0:	89 e5                	mov    %esp,%ebp
+  8035c2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8035c5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8035c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035cb:	e8 c1 fe ff ff       	call   803491 <pgbatch_slot>
+  8035d0:	85 c0                	test   %eax,%eax
+  8035d2:	78 26                	js     8035fa <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8035d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035d7:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8035dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035e0:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8035e3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8035e6:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8035e9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8035ec:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8035ef:	8b 55 18             	mov    0x18(%ebp),%edx
+  8035f2:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8035f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+
+008035fc <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8035fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803601:	c3                   	ret
+
+00803602 <devcons_poll>:
+{
+  803602:	55                   	push   %ebp
+  803603:	89 e5                	mov    %esp,%ebp
+  803605:	53                   	push   %ebx
+  803606:	83 ec 04             	sub    $0x4,%esp
+  803609:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80360c:	89 da                	mov    %ebx,%edx
+  80360e:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803611:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803618:	74 0c                	je     803626 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80361a:	89 d8                	mov    %ebx,%eax
+  80361c:	83 e0 01             	and    $0x1,%eax
+  80361f:	09 d0                	or     %edx,%eax
+}
+  803621:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803624:	c9                   	leave
+  803625:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803626:	e8 cf d8 ff ff       	call   800efa <sys_cgetc>
+  80362b:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803630:	89 da                	mov    %ebx,%edx
+  803632:	83 e2 04             	and    $0x4,%edx
+  803635:	85 c0                	test   %eax,%eax
+  803637:	74 e6                	je     80361f <devcons_poll+0x1d>
+  803639:	eb df                	jmp    80361a <devcons_poll+0x18>
+
+0080363b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80363b:	55                   	push   %ebp
+  80363c:	89 e5                	mov    %esp,%ebp
+  80363e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803641:	68 1e 43 80 00       	push   $0x80431e
+  803646:	ff 75 0c             	push   0xc(%ebp)
+  803649:	e8 16 d5 ff ff       	call   800b64 <strcpy>
+	return 0;
+}
+  80364e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803653:	c9                   	leave
+  803654:	c3                   	ret
+
+00803655 <devcons_write>:
+{
+  803655:	55                   	push   %ebp
+  803656:	89 e5                	mov    %esp,%ebp
+  803658:	57                   	push   %edi
+  803659:	56                   	push   %esi
+  80365a:	53                   	push   %ebx
+  80365b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803661:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803664:	85 ff                	test   %edi,%edi
+  803666:	74 51                	je     8036b9 <devcons_write+0x64>
+  803668:	be 00 00 00 00       	mov    $0x0,%esi
+  80366d:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803672:	89 fb                	mov    %edi,%ebx
+  803674:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803676:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80367b:	39 d3                	cmp    %edx,%ebx
+  80367d:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803680:	83 ec 04             	sub    $0x4,%esp
+  803683:	53                   	push   %ebx
+  803684:	03 45 0c             	add    0xc(%ebp),%eax
+  803687:	50                   	push   %eax
+  803688:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80368e:	50                   	push   %eax
+  80368f:	e8 80 d6 ff ff       	call   800d14 <memmove>
+		sys_cputs(buf, m);
+  803694:	83 c4 08             	add    $0x8,%esp
+  803697:	53                   	push   %ebx
+  803698:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80369e:	50                   	push   %eax
+  80369f:	e8 38 d8 ff ff       	call   800edc <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8036a4:	01 de                	add    %ebx,%esi
+  8036a6:	89 f0                	mov    %esi,%eax
+  8036a8:	83 c4 10             	add    $0x10,%esp
+  8036ab:	39 fe                	cmp    %edi,%esi
+  8036ad:	72 c3                	jb     803672 <devcons_write+0x1d>
+}
+  8036af:	89 f0                	mov    %esi,%eax
+  8036b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b4:	5b                   	pop    %ebx
+  8036b5:	5e                   	pop    %esi
+  8036b6:	5f                   	pop    %edi
+  8036b7:	5d                   	pop    %ebp
+  8036b8:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8036b9:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8036be:	eb ef                	jmp    8036af <devcons_write+0x5a>
+
+008036c0 <devcons_read>:
+{
+  8036c0:	55                   	push   %ebp
+  8036c1:	89 e5                	mov    %esp,%ebp
+  8036c3:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8036c6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8036cb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036cf:	74 36                	je     803707 <devcons_read+0x47>
+	c = cons_peek;
+  8036d1:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8036d6:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8036dd:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036e0:	85 c0                	test   %eax,%eax
+  8036e2:	75 10                	jne    8036f4 <devcons_read+0x34>
+  8036e4:	e8 11 d8 ff ff       	call   800efa <sys_cgetc>
+  8036e9:	85 c0                	test   %eax,%eax
+  8036eb:	75 07                	jne    8036f4 <devcons_read+0x34>
+		sys_yield();
+  8036ed:	e8 87 d8 ff ff       	call   800f79 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8036f2:	eb f0                	jmp    8036e4 <devcons_read+0x24>
+	if (c < 0)
+  8036f4:	85 c0                	test   %eax,%eax
+  8036f6:	78 0f                	js     803707 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8036f8:	83 f8 04             	cmp    $0x4,%eax
+  8036fb:	74 0c                	je     803709 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8036fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803700:	88 02                	mov    %al,(%edx)
+	return 1;
+  803702:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803707:	c9                   	leave
+  803708:	c3                   	ret
+		return 0;
+  803709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370e:	eb f7                	jmp    803707 <devcons_read+0x47>
+
+00803710 <cputchar>:
+{
+  803710:	55                   	push   %ebp
+  803711:	89 e5                	mov    %esp,%ebp
+  803713:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803716:	8b 45 08             	mov    0x8(%ebp),%eax
+  803719:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80371c:	6a 01                	push   $0x1
+  80371e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803721:	50                   	push   %eax
+  803722:	e8 b5 d7 ff ff       	call   800edc <sys_cputs>
+}
+  803727:	83 c4 10             	add    $0x10,%esp
+  80372a:	c9                   	leave
+  80372b:	c3                   	ret
+
+0080372c <getchar>:
+{
+  80372c:	55                   	push   %ebp
+  80372d:	89 e5                	mov    %esp,%ebp
+  80372f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803732:	6a 01                	push   $0x1
+  803734:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803737:	50                   	push   %eax
+  803738:	6a 00                	push   $0x0
+  80373a:	e8 b7 df ff ff       	call   8016f6 <read>
+	if (r < 0)
+  80373f:	83 c4 10             	add    $0x10,%esp
+  803742:	85 c0                	test   %eax,%eax
+  803744:	78 06                	js     80374c <getchar+0x20>
+	if (r < 1)
+  803746:	74 06                	je     80374e <getchar+0x22>
+	return c;
+  803748:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80374c:	c9                   	leave
+  80374d:	c3                   	ret
+		return -E_EOF;
+  80374e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803753:	eb f7                	jmp    80374c <getchar+0x20>
+
+00803755 <iscons>:
+{
+  803755:	55                   	push   %ebp
+  803756:	89 e5                	mov    %esp,%ebp
+  803758:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80375b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80375e:	50                   	push   %eax
+  80375f:	ff 75 08             	push   0x8(%ebp)
+  803762:	e8 0b dd ff ff       	call   801472 <fd_lookup>
+  803767:	83 c4 10             	add    $0x10,%esp
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	78 11                	js     80377f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80376e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803771:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803777:	39 10                	cmp    %edx,(%eax)
+  803779:	0f 94 c0             	sete   %al
+  80377c:	0f b6 c0             	movzbl %al,%eax
+}
+  80377f:	c9                   	leave
+  803780:	c3                   	ret
+
+00803781 <opencons>:
+{
+  803781:	55                   	push   %ebp
+  803782:	89 e5                	mov    %esp,%ebp
+  803784:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803787:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80378a:	50                   	push   %eax
+  80378b:	e8 92 dc ff ff       	call   801422 <fd_alloc>
+  803790:	83 c4 10             	add    $0x10,%esp
+  803793:	85 c0                	test   %eax,%eax
+  803795:	78 3a                	js     8037d1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803797:	83 ec 04             	sub    $0x4,%esp
+  80379a:	68 07 04 00 00       	push   $0x407
+  80379f:	ff 75 f4             	push   -0xc(%ebp)
+  8037a2:	6a 00                	push   $0x0
+  8037a4:	e8 ef d7 ff ff       	call   800f98 <sys_page_alloc>
+  8037a9:	83 c4 10             	add    $0x10,%esp
+  8037ac:	85 c0                	test   %eax,%eax
+  8037ae:	78 21                	js     8037d1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8037b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037b3:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8037b9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8037bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8037be:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8037c5:	83 ec 0c             	sub    $0xc,%esp
+  8037c8:	50                   	push   %eax
+  8037c9:	e8 2d dc ff ff       	call   8013fb <fd2num>
+  8037ce:	83 c4 10             	add    $0x10,%esp
+}
+  8037d1:	c9                   	leave
+  8037d2:	c3                   	ret
+
+008037d3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8037d3:	55                   	push   %ebp
+  8037d4:	89 e5                	mov    %esp,%ebp
+  8037d6:	56                   	push   %esi
+  8037d7:	53                   	push   %ebx
+  8037d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037db:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037e8:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8037eb:	83 ec 0c             	sub    $0xc,%esp
+  8037ee:	50                   	push   %eax
+  8037ef:	e8 54 d9 ff ff       	call   801148 <sys_ipc_recv>
+  8037f4:	83 c4 10             	add    $0x10,%esp
+  8037f7:	85 c0                	test   %eax,%eax
+  8037f9:	0f 88 8b 00 00 00    	js     80388a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8037ff:	85 f6                	test   %esi,%esi
+  803801:	74 2a                	je     80382d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803803:	89 e2                	mov    %esp,%edx
+  803805:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80380a:	29 d0                	sub    %edx,%eax
+  80380c:	89 c2                	mov    %eax,%edx
+  80380e:	c1 ea 0f             	shr    $0xf,%edx
+  803811:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80381e:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  803825:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80382b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80382d:	85 db                	test   %ebx,%ebx
+  80382f:	74 2a                	je     80385b <ipc_recv+0x88>
+  803831:	89 e2                	mov    %esp,%edx
+  803833:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803838:	29 d0                	sub    %edx,%eax
+  80383a:	89 c2                	mov    %eax,%edx
+  80383c:	c1 ea 0f             	shr    $0xf,%edx
+  80383f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803844:	b8 00 00 00 00       	mov    $0x0,%eax
+  803849:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80384c:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  803853:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803859:	89 03                	mov    %eax,(%ebx)
+  80385b:	89 e2                	mov    %esp,%edx
+  80385d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803862:	29 d0                	sub    %edx,%eax
+  803864:	89 c2                	mov    %eax,%edx
+  803866:	c1 ea 0f             	shr    $0xf,%edx
+  803869:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80386e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803873:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803876:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  80387d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803883:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803886:	5b                   	pop    %ebx
+  803887:	5e                   	pop    %esi
+  803888:	5d                   	pop    %ebp
+  803889:	c3                   	ret
+		if(from_env_store != NULL)
+  80388a:	85 f6                	test   %esi,%esi
+  80388c:	74 06                	je     803894 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80388e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  803894:	85 db                	test   %ebx,%ebx
+  803896:	74 eb                	je     803883 <ipc_recv+0xb0>
+			*perm_store = 0;
+  803898:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80389e:	eb e3                	jmp    803883 <ipc_recv+0xb0>
+
+008038a0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8038a0:	55                   	push   %ebp
+  8038a1:	89 e5                	mov    %esp,%ebp
+  8038a3:	57                   	push   %edi
+  8038a4:	56                   	push   %esi
+  8038a5:	53                   	push   %ebx
+  8038a6:	83 ec 14             	sub    $0x14,%esp
+  8038a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038af:	8b 75 14             	mov    0x14(%ebp),%esi
+  8038b2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8038b5:	85 c0                	test   %eax,%eax
+  8038b7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8038bc:	0f 44 c2             	cmove  %edx,%eax
+  8038bf:	ff 75 10             	push   0x10(%ebp)
+  8038c2:	50                   	push   %eax
+  8038c3:	e8 e2 d8 ff ff       	call   8011aa <sys_ipc_recv_pages>
+  8038c8:	83 c4 10             	add    $0x10,%esp
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	0f 88 ba 00 00 00    	js     80398d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8038d3:	85 ff                	test   %edi,%edi
+  8038d5:	74 2a                	je     803901 <ipc_recv_pages+0x61>
+  8038d7:	89 e2                	mov    %esp,%edx
+  8038d9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038de:	29 d0                	sub    %edx,%eax
+  8038e0:	89 c2                	mov    %eax,%edx
+  8038e2:	c1 ea 0f             	shr    $0xf,%edx
+  8038e5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ef:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8038f2:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  8038f9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8038ff:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803901:	85 f6                	test   %esi,%esi
+  803903:	74 2a                	je     80392f <ipc_recv_pages+0x8f>
+  803905:	89 e2                	mov    %esp,%edx
+  803907:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80390c:	29 d0                	sub    %edx,%eax
+  80390e:	89 c2                	mov    %eax,%edx
+  803910:	c1 ea 0f             	shr    $0xf,%edx
+  803913:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803918:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803920:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  803927:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80392d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80392f:	85 db                	test   %ebx,%ebx
+  803931:	74 2a                	je     80395d <ipc_recv_pages+0xbd>
+  803933:	89 e2                	mov    %esp,%edx
+  803935:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80393a:	29 d0                	sub    %edx,%eax
+  80393c:	89 c2                	mov    %eax,%edx
+  80393e:	c1 ea 0f             	shr    $0xf,%edx
+  803941:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80394e:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  803955:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80395b:	89 03                	mov    %eax,(%ebx)
+  80395d:	89 e2                	mov    %esp,%edx
+  80395f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803964:	29 d0                	sub    %edx,%eax
+  803966:	89 c2                	mov    %eax,%edx
+  803968:	c1 ea 0f             	shr    $0xf,%edx
+  80396b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803970:	b8 00 00 00 00       	mov    $0x0,%eax
+  803975:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803978:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  80397f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803988:	5b                   	pop    %ebx
+  803989:	5e                   	pop    %esi
+  80398a:	5f                   	pop    %edi
+  80398b:	5d                   	pop    %ebp
+  80398c:	c3                   	ret
+		if (from_env_store)
+  80398d:	85 ff                	test   %edi,%edi
+  80398f:	74 06                	je     803997 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  803991:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803997:	85 f6                	test   %esi,%esi
+  803999:	74 06                	je     8039a1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  80399b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8039a1:	85 db                	test   %ebx,%ebx
+  8039a3:	74 e0                	je     803985 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8039a5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8039ab:	eb d8                	jmp    803985 <ipc_recv_pages+0xe5>
+
+008039ad <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8039ad:	55                   	push   %ebp
+  8039ae:	89 e5                	mov    %esp,%ebp
+  8039b0:	57                   	push   %edi
+  8039b1:	56                   	push   %esi
+  8039b2:	53                   	push   %ebx
+  8039b3:	83 ec 1c             	sub    $0x1c,%esp
+  8039b6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8039b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8039bc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039c2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8039c6:	75 2b                	jne    8039f3 <ipc_try_send_pages+0x46>
+  8039c8:	89 e2                	mov    %esp,%edx
+  8039ca:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8039cf:	29 d0                	sub    %edx,%eax
+  8039d1:	89 c2                	mov    %eax,%edx
+  8039d3:	c1 ea 0f             	shr    $0xf,%edx
+  8039d6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8039db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e0:	0f 42 c2             	cmovb  %edx,%eax
+  8039e3:	8b 04 85 40 73 80 00 	mov    0x807340(,%eax,4),%eax
+  8039ea:	8b 70 48             	mov    0x48(%eax),%esi
+  8039ed:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8039f3:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8039f9:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8039fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a01:	85 ff                	test   %edi,%edi
+  803a03:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803a08:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803a0b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803a11:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803a17:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803a1d:	83 ec 0c             	sub    $0xc,%esp
+  803a20:	ff 75 14             	push   0x14(%ebp)
+  803a23:	ff 75 18             	push   0x18(%ebp)
+  803a26:	57                   	push   %edi
+  803a27:	ff 75 0c             	push   0xc(%ebp)
+  803a2a:	ff 75 08             	push   0x8(%ebp)
+  803a2d:	e8 57 d7 ff ff       	call   801189 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803a32:	83 c4 20             	add    $0x20,%esp
+  803a35:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803a38:	75 21                	jne    803a5b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803a3a:	83 ec 04             	sub    $0x4,%esp
+  803a3d:	6a ff                	push   $0xffffffff
+  803a3f:	53                   	push   %ebx
+  803a40:	ff 75 e4             	push   -0x1c(%ebp)
+  803a43:	e8 4e d9 ff ff       	call   801396 <sys_futex_wait>
+  803a48:	83 c4 10             	add    $0x10,%esp
+  803a4b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803a4e:	74 c7                	je     803a17 <ipc_try_send_pages+0x6a>
+  803a50:	85 c0                	test   %eax,%eax
+  803a52:	79 c3                	jns    803a17 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803a54:	e8 20 d5 ff ff       	call   800f79 <sys_yield>
+  803a59:	eb bc                	jmp    803a17 <ipc_try_send_pages+0x6a>
+	}
+}
+  803a5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a5e:	5b                   	pop    %ebx
+  803a5f:	5e                   	pop    %esi
+  803a60:	5f                   	pop    %edi
+  803a61:	5d                   	pop    %ebp
+  803a62:	c3                   	ret
+
+00803a63 <ipc_send>:
+{
+  803a63:	55                   	push   %ebp
+  803a64:	89 e5                	mov    %esp,%ebp
+  803a66:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803a69:	ff 75 14             	push   0x14(%ebp)
+  803a6c:	6a 01                	push   $0x1
+  803a6e:	ff 75 10             	push   0x10(%ebp)
+  803a71:	ff 75 0c             	push   0xc(%ebp)
+  803a74:	ff 75 08             	push   0x8(%ebp)
+  803a77:	e8 31 ff ff ff       	call   8039ad <ipc_try_send_pages>
+  803a7c:	83 c4 20             	add    $0x20,%esp
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	78 02                	js     803a85 <ipc_send+0x22>
+}
+  803a83:	c9                   	leave
+  803a84:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803a85:	50                   	push   %eax
+  803a86:	68 2a 43 80 00       	push   $0x80432a
+  803a8b:	6a 3f                	push   $0x3f
+  803a8d:	68 3f 43 80 00       	push   $0x80433f
+  803a92:	e8 fb c8 ff ff       	call   800392 <_panic>
+
+00803a97 <ipc_send_pages>:
+{
+  803a97:	55                   	push   %ebp
+  803a98:	89 e5                	mov    %esp,%ebp
+  803a9a:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803a9d:	ff 75 18             	push   0x18(%ebp)
+  803aa0:	ff 75 14             	push   0x14(%ebp)
+  803aa3:	ff 75 10             	push   0x10(%ebp)
+  803aa6:	ff 75 0c             	push   0xc(%ebp)
+  803aa9:	ff 75 08             	push   0x8(%ebp)
+  803aac:	e8 fc fe ff ff       	call   8039ad <ipc_try_send_pages>
+  803ab1:	83 c4 20             	add    $0x20,%esp
+  803ab4:	85 c0                	test   %eax,%eax
+  803ab6:	78 02                	js     803aba <ipc_send_pages+0x23>
+}
+  803ab8:	c9                   	leave
+  803ab9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  803aba:	50                   	push   %eax
+  803abb:	68 49 43 80 00       	push   $0x804349
+  803ac0:	6a 64                	push   $0x64
+  803ac2:	68 3f 43 80 00       	push   $0x80433f
+  803ac7:	e8 c6 c8 ff ff       	call   800392 <_panic>
+
+00803acc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803acc:	55                   	push   %ebp
+  803acd:	89 e5                	mov    %esp,%ebp
+  803acf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803ad7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  803add:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803ae3:	8b 52 50             	mov    0x50(%edx),%edx
+  803ae6:	39 ca                	cmp    %ecx,%edx
+  803ae8:	74 11                	je     803afb <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803aea:	83 c0 01             	add    $0x1,%eax
+  803aed:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803af2:	75 e3                	jne    803ad7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af9:	eb 0e                	jmp    803b09 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803afb:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803b01:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803b06:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803b09:	5d                   	pop    %ebp
+  803b0a:	c3                   	ret
+
+00803b0b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b0b:	55                   	push   %ebp
+  803b0c:	89 e5                	mov    %esp,%ebp
+  803b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b11:	89 c2                	mov    %eax,%edx
+  803b13:	c1 ea 16             	shr    $0x16,%edx
+  803b16:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803b22:	f6 c1 01             	test   $0x1,%cl
+  803b25:	74 1e                	je     803b45 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803b27:	c1 e8 0c             	shr    $0xc,%eax
+  803b2a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803b31:	a8 01                	test   $0x1,%al
+  803b33:	74 10                	je     803b45 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803b35:	c1 e8 0c             	shr    $0xc,%eax
+  803b38:	c1 e0 04             	shl    $0x4,%eax
+  803b3b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803b42:	0f b7 d2             	movzwl %dx,%edx
+}
+  803b45:	89 d0                	mov    %edx,%eax
+  803b47:	5d                   	pop    %ebp
+  803b48:	c3                   	ret
+
+00803b49 <__udivdi3>:
+  803b49:	57                   	push   %edi
+  803b4a:	56                   	push   %esi
+  803b4b:	53                   	push   %ebx
+  803b4c:	83 ec 20             	sub    $0x20,%esp
+  803b4f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803b53:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803b57:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b5b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b5f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b63:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b67:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803b6b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803b6f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b79:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b7e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803b85:	00 
+  803b86:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803b8d:	00 
+  803b8e:	eb 08                	jmp    803b98 <__udivdi3+0x4f>
+  803b90:	83 e9 01             	sub    $0x1,%ecx
+  803b93:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803b96:	74 68                	je     803c00 <__udivdi3+0xb7>
+  803b98:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803b9c:	01 c0                	add    %eax,%eax
+  803b9e:	89 c6                	mov    %eax,%esi
+  803ba0:	89 d7                	mov    %edx,%edi
+  803ba2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ba6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803baa:	0f ad d0             	shrd   %cl,%edx,%eax
+  803bad:	d3 ea                	shr    %cl,%edx
+  803baf:	f6 c1 20             	test   $0x20,%cl
+  803bb2:	74 04                	je     803bb8 <__udivdi3+0x6f>
+  803bb4:	89 d0                	mov    %edx,%eax
+  803bb6:	31 d2                	xor    %edx,%edx
+  803bb8:	83 e0 01             	and    $0x1,%eax
+  803bbb:	89 04 24             	mov    %eax,(%esp)
+  803bbe:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803bc5:	00 
+  803bc6:	8b 04 24             	mov    (%esp),%eax
+  803bc9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803bcd:	09 f0                	or     %esi,%eax
+  803bcf:	09 fa                	or     %edi,%edx
+  803bd1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803bd5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803bd9:	39 f0                	cmp    %esi,%eax
+  803bdb:	89 d3                	mov    %edx,%ebx
+  803bdd:	19 fb                	sbb    %edi,%ebx
+  803bdf:	72 af                	jb     803b90 <__udivdi3+0x47>
+  803be1:	29 f0                	sub    %esi,%eax
+  803be3:	19 fa                	sbb    %edi,%edx
+  803be5:	89 cf                	mov    %ecx,%edi
+  803be7:	c1 ef 05             	shr    $0x5,%edi
+  803bea:	83 e7 01             	and    $0x1,%edi
+  803bed:	89 fe                	mov    %edi,%esi
+  803bef:	83 f6 01             	xor    $0x1,%esi
+  803bf2:	d3 e6                	shl    %cl,%esi
+  803bf4:	d3 e7                	shl    %cl,%edi
+  803bf6:	09 74 24 18          	or     %esi,0x18(%esp)
+  803bfa:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803bfe:	eb 90                	jmp    803b90 <__udivdi3+0x47>
+  803c00:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c04:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c08:	83 c4 20             	add    $0x20,%esp
+  803c0b:	5b                   	pop    %ebx
+  803c0c:	5e                   	pop    %esi
+  803c0d:	5f                   	pop    %edi
+  803c0e:	c3                   	ret
+
+00803c0f <__umoddi3>:
+  803c0f:	57                   	push   %edi
+  803c10:	56                   	push   %esi
+  803c11:	53                   	push   %ebx
+  803c12:	83 ec 08             	sub    $0x8,%esp
+  803c15:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c19:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803c1d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803c21:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803c25:	57                   	push   %edi
+  803c26:	56                   	push   %esi
+  803c27:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803c2b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803c2f:	52                   	push   %edx
+  803c30:	50                   	push   %eax
+  803c31:	e8 13 ff ff ff       	call   803b49 <__udivdi3>
+  803c36:	89 c3                	mov    %eax,%ebx
+  803c38:	0f af d6             	imul   %esi,%edx
+  803c3b:	89 f9                	mov    %edi,%ecx
+  803c3d:	0f af cb             	imul   %ebx,%ecx
+  803c40:	01 d1                	add    %edx,%ecx
+  803c42:	89 d8                	mov    %ebx,%eax
+  803c44:	f7 e6                	mul    %esi
+  803c46:	89 c6                	mov    %eax,%esi
+  803c48:	89 d7                	mov    %edx,%edi
+  803c4a:	01 cf                	add    %ecx,%edi
+  803c4c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c50:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c54:	29 f0                	sub    %esi,%eax
+  803c56:	19 fa                	sbb    %edi,%edx
+  803c58:	83 c4 18             	add    $0x18,%esp
+  803c5b:	5b                   	pop    %ebx
+  803c5c:	5e                   	pop    %esi
+  803c5d:	5f                   	pop    %edi
+  803c5e:	c3                   	ret
+
+00803c5f <__divdi3>:
+  803c5f:	53                   	push   %ebx
+  803c60:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c64:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c68:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803c6c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803c70:	85 d2                	test   %edx,%edx
+  803c72:	78 12                	js     803c86 <__divdi3+0x27>
+  803c74:	85 db                	test   %ebx,%ebx
+  803c76:	78 2e                	js     803ca6 <__divdi3+0x47>
+  803c78:	53                   	push   %ebx
+  803c79:	51                   	push   %ecx
+  803c7a:	52                   	push   %edx
+  803c7b:	50                   	push   %eax
+  803c7c:	e8 c8 fe ff ff       	call   803b49 <__udivdi3>
+  803c81:	83 c4 10             	add    $0x10,%esp
+  803c84:	eb 1e                	jmp    803ca4 <__divdi3+0x45>
+  803c86:	f7 d8                	neg    %eax
+  803c88:	83 d2 00             	adc    $0x0,%edx
+  803c8b:	f7 da                	neg    %edx
+  803c8d:	85 db                	test   %ebx,%ebx
+  803c8f:	78 2a                	js     803cbb <__divdi3+0x5c>
+  803c91:	53                   	push   %ebx
+  803c92:	51                   	push   %ecx
+  803c93:	52                   	push   %edx
+  803c94:	50                   	push   %eax
+  803c95:	e8 af fe ff ff       	call   803b49 <__udivdi3>
+  803c9a:	83 c4 10             	add    $0x10,%esp
+  803c9d:	f7 d8                	neg    %eax
+  803c9f:	83 d2 00             	adc    $0x0,%edx
+  803ca2:	f7 da                	neg    %edx
+  803ca4:	5b                   	pop    %ebx
+  803ca5:	c3                   	ret
+  803ca6:	f7 d9                	neg    %ecx
+  803ca8:	83 d3 00             	adc    $0x0,%ebx
+  803cab:	f7 db                	neg    %ebx
+  803cad:	53                   	push   %ebx
+  803cae:	51                   	push   %ecx
+  803caf:	52                   	push   %edx
+  803cb0:	50                   	push   %eax
+  803cb1:	e8 93 fe ff ff       	call   803b49 <__udivdi3>
+  803cb6:	83 c4 10             	add    $0x10,%esp
+  803cb9:	eb e2                	jmp    803c9d <__divdi3+0x3e>
+  803cbb:	f7 d9                	neg    %ecx
+  803cbd:	83 d3 00             	adc    $0x0,%ebx
+  803cc0:	f7 db                	neg    %ebx
+  803cc2:	53                   	push   %ebx
+  803cc3:	51                   	push   %ecx
+  803cc4:	52                   	push   %edx
+  803cc5:	50                   	push   %eax
+  803cc6:	e8 7e fe ff ff       	call   803b49 <__udivdi3>
+  803ccb:	83 c4 10             	add    $0x10,%esp
+  803cce:	eb d4                	jmp    803ca4 <__divdi3+0x45>
+
+00803cd0 <__moddi3>:
+  803cd0:	57                   	push   %edi
+  803cd1:	56                   	push   %esi
+  803cd2:	53                   	push   %ebx
+  803cd3:	83 ec 08             	sub    $0x8,%esp
+  803cd6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803cda:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803cde:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803ce2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803ce6:	57                   	push   %edi
+  803ce7:	56                   	push   %esi
+  803ce8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803cec:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803cf0:	52                   	push   %edx
+  803cf1:	50                   	push   %eax
+  803cf2:	e8 68 ff ff ff       	call   803c5f <__divdi3>
+  803cf7:	89 c3                	mov    %eax,%ebx
+  803cf9:	0f af d6             	imul   %esi,%edx
+  803cfc:	89 f9                	mov    %edi,%ecx
+  803cfe:	0f af cb             	imul   %ebx,%ecx
+  803d01:	01 d1                	add    %edx,%ecx
+  803d03:	89 d8                	mov    %ebx,%eax
+  803d05:	f7 e6                	mul    %esi
+  803d07:	89 c6                	mov    %eax,%esi
+  803d09:	89 d7                	mov    %edx,%edi
+  803d0b:	01 cf                	add    %ecx,%edi
+  803d0d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803d11:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803d15:	29 f0                	sub    %esi,%eax
+  803d17:	19 fa                	sbb    %edi,%edx
+  803d19:	83 c4 18             	add    $0x18,%esp
+  803d1c:	5b                   	pop    %ebx
+  803d1d:	5e                   	pop    %esi
+  803d1e:	5f                   	pop    %edi
+  803d1f:	c3                   	ret
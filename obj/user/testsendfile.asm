@@ -0,0 +1,8466 @@
+
+obj/user/testsendfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ca 01 00 00       	call   8001fb <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <die>:
+	{ "/data64k", 60000, 8192, 5536 },	// Across pages, to the end
+};
+
+static void
+die(char *m)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	83 ec 10             	sub    $0x10,%esp
+	cprintf("%s\n", m);
+  80003b:	50                   	push   %eax
+  80003c:	68 60 3f 80 00       	push   $0x803f60
+  800041:	e8 37 03 00 00       	call   80037d <cprintf>
+	exit();
+  800046:	e8 3d 02 00 00       	call   800288 <exit>
+}
+  80004b:	83 c4 10             	add    $0x10,%esp
+  80004e:	c9                   	leave
+  80004f:	c3                   	ret
+
+00800050 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800050:	55                   	push   %ebp
+  800051:	89 e5                	mov    %esp,%ebp
+  800053:	57                   	push   %edi
+  800054:	56                   	push   %esi
+  800055:	53                   	push   %ebx
+  800056:	83 ec 40             	sub    $0x40,%esp
+	int serversock, clientsock, fd, i, r;
+	struct sockaddr_in addr;
+	unsigned int addrlen;
+
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+  800059:	6a 06                	push   $0x6
+  80005b:	6a 01                	push   $0x1
+  80005d:	6a 02                	push   $0x2
+  80005f:	e8 b6 1f 00 00       	call   80201a <socket>
+  800064:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	85 c0                	test   %eax,%eax
+  80006c:	0f 88 1d 01 00 00    	js     80018f <umain+0x13f>
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+  800072:	83 ec 04             	sub    $0x4,%esp
+  800075:	6a 10                	push   $0x10
+  800077:	6a 00                	push   $0x0
+  800079:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+  80007c:	53                   	push   %ebx
+  80007d:	e8 6d 0b 00 00       	call   800bef <memset>
+	addr.sin_family = AF_INET;
+  800082:	c6 45 d9 02          	movb   $0x2,-0x27(%ebp)
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  800086:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80008d:	e8 95 3a 00 00       	call   803b27 <htonl>
+  800092:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	addr.sin_port = htons(PORT);
+  800095:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80009c:	e8 6c 3a 00 00       	call   803b0d <htons>
+  8000a1:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+	if (bind(serversock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  8000a5:	83 c4 0c             	add    $0xc,%esp
+  8000a8:	6a 10                	push   $0x10
+  8000aa:	53                   	push   %ebx
+  8000ab:	ff 75 bc             	push   -0x44(%ebp)
+  8000ae:	e8 c6 1d 00 00       	call   801e79 <bind>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	0f 88 e0 00 00 00    	js     80019e <umain+0x14e>
+		die("Failed to bind the server socket");
+	if (listen(serversock, 1) < 0)
+  8000be:	83 ec 08             	sub    $0x8,%esp
+  8000c1:	6a 01                	push   $0x1
+  8000c3:	ff 75 bc             	push   -0x44(%ebp)
+  8000c6:	e8 1d 1e 00 00       	call   801ee8 <listen>
+  8000cb:	83 c4 10             	add    $0x10,%esp
+  8000ce:	85 c0                	test   %eax,%eax
+  8000d0:	0f 88 d7 00 00 00    	js     8001ad <umain+0x15d>
+		die("Failed to listen on server socket");
+	cprintf("testsendfile: listening\n");
+  8000d6:	83 ec 0c             	sub    $0xc,%esp
+  8000d9:	68 7c 3f 80 00       	push   $0x803f7c
+  8000de:	e8 9a 02 00 00       	call   80037d <cprintf>
+
+	addrlen = sizeof(addr);
+  8000e3:	c7 45 d4 10 00 00 00 	movl   $0x10,-0x2c(%ebp)
+	if ((clientsock = accept(serversock, (struct sockaddr *) &addr,
+  8000ea:	83 c4 0c             	add    $0xc,%esp
+  8000ed:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  8000f0:	50                   	push   %eax
+  8000f1:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	ff 75 bc             	push   -0x44(%ebp)
+  8000f8:	e8 3a 1d 00 00       	call   801e37 <accept>
+  8000fd:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	85 c0                	test   %eax,%eax
+  800105:	0f 88 b1 00 00 00    	js     8001bc <umain+0x16c>
+				 &addrlen)) < 0)
+		die("Failed to accept client connection");
+
+	for (i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+  80010b:	bb 80 40 80 00       	mov    $0x804080,%ebx
+		if ((fd = open(ranges[i].path, O_RDONLY)) < 0)
+  800110:	8b 3b                	mov    (%ebx),%edi
+  800112:	83 ec 08             	sub    $0x8,%esp
+  800115:	6a 00                	push   $0x0
+  800117:	57                   	push   %edi
+  800118:	e8 e2 19 00 00       	call   801aff <open>
+  80011d:	89 c6                	mov    %eax,%esi
+  80011f:	83 c4 10             	add    $0x10,%esp
+  800122:	85 c0                	test   %eax,%eax
+  800124:	0f 88 a1 00 00 00    	js     8001cb <umain+0x17b>
+			panic("open %s: %e", ranges[i].path, fd);
+		r = sendfile(clientsock, fd, ranges[i].offset, ranges[i].len);
+  80012a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80012d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  800130:	ff 73 08             	push   0x8(%ebx)
+  800133:	50                   	push   %eax
+  800134:	56                   	push   %esi
+  800135:	ff 75 c4             	push   -0x3c(%ebp)
+  800138:	e8 60 1e 00 00       	call   801f9d <sendfile>
+		if (r != ranges[i].expect)
+  80013d:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  800140:	83 c4 10             	add    $0x10,%esp
+  800143:	39 c1                	cmp    %eax,%ecx
+  800145:	0f 85 96 00 00 00    	jne    8001e1 <umain+0x191>
+			panic("sendfile %s at %d: got %d, expected %d",
+			      ranges[i].path, ranges[i].offset, r,
+			      ranges[i].expect);
+		close(fd);
+  80014b:	83 ec 0c             	sub    $0xc,%esp
+  80014e:	56                   	push   %esi
+  80014f:	e8 73 13 00 00       	call   8014c7 <close>
+	for (i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+  800154:	83 c3 10             	add    $0x10,%ebx
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	81 fb e0 40 80 00    	cmp    $0x8040e0,%ebx
+  800160:	75 ae                	jne    800110 <umain+0xc0>
+	}
+	close(clientsock);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	ff 75 c4             	push   -0x3c(%ebp)
+  800168:	e8 5a 13 00 00       	call   8014c7 <close>
+	close(serversock);
+  80016d:	83 c4 04             	add    $0x4,%esp
+  800170:	ff 75 bc             	push   -0x44(%ebp)
+  800173:	e8 4f 13 00 00       	call   8014c7 <close>
+	cprintf("testsendfile: done\n");
+  800178:	c7 04 24 b5 3f 80 00 	movl   $0x803fb5,(%esp)
+  80017f:	e8 f9 01 00 00       	call   80037d <cprintf>
+}
+  800184:	83 c4 10             	add    $0x10,%esp
+  800187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018a:	5b                   	pop    %ebx
+  80018b:	5e                   	pop    %esi
+  80018c:	5f                   	pop    %edi
+  80018d:	5d                   	pop    %ebp
+  80018e:	c3                   	ret
+		die("Failed to create socket");
+  80018f:	b8 64 3f 80 00       	mov    $0x803f64,%eax
+  800194:	e8 9c fe ff ff       	call   800035 <die>
+  800199:	e9 d4 fe ff ff       	jmp    800072 <umain+0x22>
+		die("Failed to bind the server socket");
+  80019e:	b8 dc 3f 80 00       	mov    $0x803fdc,%eax
+  8001a3:	e8 8d fe ff ff       	call   800035 <die>
+  8001a8:	e9 11 ff ff ff       	jmp    8000be <umain+0x6e>
+		die("Failed to listen on server socket");
+  8001ad:	b8 00 40 80 00       	mov    $0x804000,%eax
+  8001b2:	e8 7e fe ff ff       	call   800035 <die>
+  8001b7:	e9 1a ff ff ff       	jmp    8000d6 <umain+0x86>
+		die("Failed to accept client connection");
+  8001bc:	b8 24 40 80 00       	mov    $0x804024,%eax
+  8001c1:	e8 6f fe ff ff       	call   800035 <die>
+  8001c6:	e9 40 ff ff ff       	jmp    80010b <umain+0xbb>
+			panic("open %s: %e", ranges[i].path, fd);
+  8001cb:	83 ec 0c             	sub    $0xc,%esp
+  8001ce:	50                   	push   %eax
+  8001cf:	57                   	push   %edi
+  8001d0:	68 95 3f 80 00       	push   $0x803f95
+  8001d5:	6a 3a                	push   $0x3a
+  8001d7:	68 a1 3f 80 00       	push   $0x803fa1
+  8001dc:	e8 c1 00 00 00       	call   8002a2 <_panic>
+			panic("sendfile %s at %d: got %d, expected %d",
+  8001e1:	83 ec 04             	sub    $0x4,%esp
+  8001e4:	51                   	push   %ecx
+  8001e5:	50                   	push   %eax
+  8001e6:	ff 75 c0             	push   -0x40(%ebp)
+  8001e9:	57                   	push   %edi
+  8001ea:	68 48 40 80 00       	push   $0x804048
+  8001ef:	6a 3d                	push   $0x3d
+  8001f1:	68 a1 3f 80 00       	push   $0x803fa1
+  8001f6:	e8 a7 00 00 00       	call   8002a2 <_panic>
+
+008001fb <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800203:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800206:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800208:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80020d:	29 d0                	sub    %edx,%eax
+  80020f:	89 c2                	mov    %eax,%edx
+  800211:	c1 ea 0f             	shr    $0xf,%edx
+  800214:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021e:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800221:	c7 04 85 60 63 80 00 	movl   $0x0,0x806360(,%eax,4)
+  800228:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80022c:	e8 39 0c 00 00       	call   800e6a <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800231:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800236:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80023c:	89 e1                	mov    %esp,%ecx
+  80023e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800243:	29 ca                	sub    %ecx,%edx
+  800245:	89 d1                	mov    %edx,%ecx
+  800247:	c1 e9 0f             	shr    $0xf,%ecx
+  80024a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800250:	ba 00 00 00 00       	mov    $0x0,%edx
+  800255:	0f 42 d1             	cmovb  %ecx,%edx
+  800258:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80025d:	89 04 95 60 63 80 00 	mov    %eax,0x806360(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800264:	85 db                	test   %ebx,%ebx
+  800266:	7e 07                	jle    80026f <libmain+0x74>
+		binaryname = argv[0];
+  800268:	8b 06                	mov    (%esi),%eax
+  80026a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80026f:	83 ec 08             	sub    $0x8,%esp
+  800272:	56                   	push   %esi
+  800273:	53                   	push   %ebx
+  800274:	e8 d7 fd ff ff       	call   800050 <umain>
+
+	// exit gracefully
+	exit();
+  800279:	e8 0a 00 00 00       	call   800288 <exit>
+}
+  80027e:	83 c4 10             	add    $0x10,%esp
+  800281:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800284:	5b                   	pop    %ebx
+  800285:	5e                   	pop    %esi
+  800286:	5d                   	pop    %ebp
+  800287:	c3                   	ret
+
+00800288 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80028e:	e8 61 12 00 00       	call   8014f4 <close_all>
+	sys_env_destroy(0);
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	6a 00                	push   $0x0
+  800298:	e8 8c 0b 00 00       	call   800e29 <sys_env_destroy>
+}
+  80029d:	83 c4 10             	add    $0x10,%esp
+  8002a0:	c9                   	leave
+  8002a1:	c3                   	ret
+
+008002a2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002a2:	55                   	push   %ebp
+  8002a3:	89 e5                	mov    %esp,%ebp
+  8002a5:	56                   	push   %esi
+  8002a6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002a7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002aa:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002b0:	e8 b5 0b 00 00       	call   800e6a <sys_getenvid>
+  8002b5:	83 ec 0c             	sub    $0xc,%esp
+  8002b8:	ff 75 0c             	push   0xc(%ebp)
+  8002bb:	ff 75 08             	push   0x8(%ebp)
+  8002be:	56                   	push   %esi
+  8002bf:	50                   	push   %eax
+  8002c0:	68 ec 40 80 00       	push   $0x8040ec
+  8002c5:	e8 b3 00 00 00       	call   80037d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002ca:	83 c4 18             	add    $0x18,%esp
+  8002cd:	53                   	push   %ebx
+  8002ce:	ff 75 10             	push   0x10(%ebp)
+  8002d1:	e8 56 00 00 00       	call   80032c <vcprintf>
+	cprintf("\n");
+  8002d6:	c7 04 24 70 45 80 00 	movl   $0x804570,(%esp)
+  8002dd:	e8 9b 00 00 00       	call   80037d <cprintf>
+  8002e2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002e5:	cc                   	int3
+	while (1)
+  8002e6:	eb fd                	jmp    8002e5 <_panic+0x43>
+
+008002e8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002e8:	55                   	push   %ebp
+  8002e9:	89 e5                	mov    %esp,%ebp
+  8002eb:	53                   	push   %ebx
+  8002ec:	83 ec 04             	sub    $0x4,%esp
+  8002ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002f2:	8b 13                	mov    (%ebx),%edx
+  8002f4:	8d 42 01             	lea    0x1(%edx),%eax
+  8002f7:	89 03                	mov    %eax,(%ebx)
+  8002f9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002fc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800300:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800305:	74 09                	je     800310 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800307:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80030b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800310:	83 ec 08             	sub    $0x8,%esp
+  800313:	68 ff 00 00 00       	push   $0xff
+  800318:	8d 43 08             	lea    0x8(%ebx),%eax
+  80031b:	50                   	push   %eax
+  80031c:	e8 cb 0a 00 00       	call   800dec <sys_cputs>
+		b->idx = 0;
+  800321:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	eb db                	jmp    800307 <putch+0x1f>
+
+0080032c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800335:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80033c:	00 00 00 
+	b.cnt = 0;
+  80033f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800346:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800349:	ff 75 0c             	push   0xc(%ebp)
+  80034c:	ff 75 08             	push   0x8(%ebp)
+  80034f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800355:	50                   	push   %eax
+  800356:	68 e8 02 80 00       	push   $0x8002e8
+  80035b:	e8 1c 01 00 00       	call   80047c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800360:	83 c4 08             	add    $0x8,%esp
+  800363:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800369:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80036f:	50                   	push   %eax
+  800370:	e8 77 0a 00 00       	call   800dec <sys_cputs>
+
+	return b.cnt;
+}
+  800375:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80037b:	c9                   	leave
+  80037c:	c3                   	ret
+
+0080037d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80037d:	55                   	push   %ebp
+  80037e:	89 e5                	mov    %esp,%ebp
+  800380:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800383:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800386:	50                   	push   %eax
+  800387:	ff 75 08             	push   0x8(%ebp)
+  80038a:	e8 9d ff ff ff       	call   80032c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80038f:	c9                   	leave
+  800390:	c3                   	ret
+
+00800391 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800391:	55                   	push   %ebp
+  800392:	89 e5                	mov    %esp,%ebp
+  800394:	57                   	push   %edi
+  800395:	56                   	push   %esi
+  800396:	53                   	push   %ebx
+  800397:	83 ec 1c             	sub    $0x1c,%esp
+  80039a:	89 c3                	mov    %eax,%ebx
+  80039c:	89 d6                	mov    %edx,%esi
+  80039e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003a4:	89 d1                	mov    %edx,%ecx
+  8003a6:	89 c2                	mov    %eax,%edx
+  8003a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003ae:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003bb:	39 c2                	cmp    %eax,%edx
+  8003bd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003c0:	73 4b                	jae    80040d <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8003c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c5:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003c8:	85 ff                	test   %edi,%edi
+  8003ca:	7e 11                	jle    8003dd <printnum+0x4c>
+			putch(padc, putdat);
+  8003cc:	83 ec 08             	sub    $0x8,%esp
+  8003cf:	56                   	push   %esi
+  8003d0:	ff 75 18             	push   0x18(%ebp)
+  8003d3:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003d5:	83 c4 10             	add    $0x10,%esp
+  8003d8:	83 ef 01             	sub    $0x1,%edi
+  8003db:	75 ef                	jne    8003cc <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	56                   	push   %esi
+  8003e1:	83 ec 04             	sub    $0x4,%esp
+  8003e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8003e7:	ff 75 e0             	push   -0x20(%ebp)
+  8003ea:	ff 75 dc             	push   -0x24(%ebp)
+  8003ed:	ff 75 d8             	push   -0x28(%ebp)
+  8003f0:	e8 4f 3a 00 00       	call   803e44 <__umoddi3>
+  8003f5:	83 c4 14             	add    $0x14,%esp
+  8003f8:	0f be 80 0f 41 80 00 	movsbl 0x80410f(%eax),%eax
+  8003ff:	50                   	push   %eax
+  800400:	ff d3                	call   *%ebx
+}
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800408:	5b                   	pop    %ebx
+  800409:	5e                   	pop    %esi
+  80040a:	5f                   	pop    %edi
+  80040b:	5d                   	pop    %ebp
+  80040c:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80040d:	83 ec 0c             	sub    $0xc,%esp
+  800410:	ff 75 18             	push   0x18(%ebp)
+  800413:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800416:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800419:	52                   	push   %edx
+  80041a:	50                   	push   %eax
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	ff 75 e4             	push   -0x1c(%ebp)
+  800421:	ff 75 e0             	push   -0x20(%ebp)
+  800424:	ff 75 dc             	push   -0x24(%ebp)
+  800427:	ff 75 d8             	push   -0x28(%ebp)
+  80042a:	e8 4f 39 00 00       	call   803d7e <__udivdi3>
+  80042f:	83 c4 18             	add    $0x18,%esp
+  800432:	52                   	push   %edx
+  800433:	50                   	push   %eax
+  800434:	89 f2                	mov    %esi,%edx
+  800436:	89 d8                	mov    %ebx,%eax
+  800438:	e8 54 ff ff ff       	call   800391 <printnum>
+  80043d:	83 c4 20             	add    $0x20,%esp
+  800440:	eb 9b                	jmp    8003dd <printnum+0x4c>
+
+00800442 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800448:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80044c:	8b 10                	mov    (%eax),%edx
+  80044e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800451:	73 0a                	jae    80045d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800453:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800456:	89 08                	mov    %ecx,(%eax)
+  800458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045b:	88 02                	mov    %al,(%edx)
+}
+  80045d:	5d                   	pop    %ebp
+  80045e:	c3                   	ret
+
+0080045f <printfmt>:
+{
+  80045f:	55                   	push   %ebp
+  800460:	89 e5                	mov    %esp,%ebp
+  800462:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800465:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800468:	50                   	push   %eax
+  800469:	ff 75 10             	push   0x10(%ebp)
+  80046c:	ff 75 0c             	push   0xc(%ebp)
+  80046f:	ff 75 08             	push   0x8(%ebp)
+  800472:	e8 05 00 00 00       	call   80047c <vprintfmt>
+}
+  800477:	83 c4 10             	add    $0x10,%esp
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+0080047c <vprintfmt>:
+{
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+  800482:	83 ec 2c             	sub    $0x2c,%esp
+  800485:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800488:	89 df                	mov    %ebx,%edi
+  80048a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80048d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800490:	8d 70 01             	lea    0x1(%eax),%esi
+  800493:	0f b6 00             	movzbl (%eax),%eax
+  800496:	83 f8 25             	cmp    $0x25,%eax
+  800499:	74 1e                	je     8004b9 <vprintfmt+0x3d>
+			if (ch == '\0')
+  80049b:	85 c0                	test   %eax,%eax
+  80049d:	0f 84 15 05 00 00    	je     8009b8 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	53                   	push   %ebx
+  8004a7:	50                   	push   %eax
+  8004a8:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004aa:	83 c6 01             	add    $0x1,%esi
+  8004ad:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b1:	83 c4 10             	add    $0x10,%esp
+  8004b4:	83 f8 25             	cmp    $0x25,%eax
+  8004b7:	75 e2                	jne    80049b <vprintfmt+0x1f>
+		padc = ' ';
+  8004b9:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8004bd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004c4:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004cb:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004d7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004da:	8d 56 01             	lea    0x1(%esi),%edx
+  8004dd:	0f b6 0e             	movzbl (%esi),%ecx
+  8004e0:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004e3:	3c 55                	cmp    $0x55,%al
+  8004e5:	0f 87 3b 04 00 00    	ja     800926 <vprintfmt+0x4aa>
+  8004eb:	0f b6 c0             	movzbl %al,%eax
+  8004ee:	ff 24 85 80 42 80 00 	jmp    *0x804280(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004f8:	eb 93                	jmp    80048d <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004fa:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8004fc:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800500:	eb d8                	jmp    8004da <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800502:	89 d6                	mov    %edx,%esi
+  800504:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800508:	eb d0                	jmp    8004da <vprintfmt+0x5e>
+  80050a:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80050d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800510:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800513:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800517:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80051a:	83 f9 09             	cmp    $0x9,%ecx
+  80051d:	77 6f                	ja     80058e <vprintfmt+0x112>
+  80051f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800522:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800525:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800528:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80052c:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80052f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800532:	83 fe 09             	cmp    $0x9,%esi
+  800535:	76 eb                	jbe    800522 <vprintfmt+0xa6>
+  800537:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80053a:	89 d6                	mov    %edx,%esi
+  80053c:	eb 13                	jmp    800551 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8b 00                	mov    (%eax),%eax
+  800543:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8d 40 04             	lea    0x4(%eax),%eax
+  80054c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054f:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800551:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800555:	79 83                	jns    8004da <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800557:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80055a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80055d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800564:	e9 71 ff ff ff       	jmp    8004da <vprintfmt+0x5e>
+			if (width < 0)
+  800569:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80056c:	85 c9                	test   %ecx,%ecx
+  80056e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800573:	0f 49 c1             	cmovns %ecx,%eax
+  800576:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800579:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80057b:	e9 5a ff ff ff       	jmp    8004da <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800580:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800582:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800589:	e9 4c ff ff ff       	jmp    8004da <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80058e:	89 d6                	mov    %edx,%esi
+  800590:	eb bf                	jmp    800551 <vprintfmt+0xd5>
+			lflag++;
+  800592:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800596:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800598:	e9 3d ff ff ff       	jmp    8004da <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80059d:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8d 70 04             	lea    0x4(%eax),%esi
+  8005a6:	83 ec 08             	sub    $0x8,%esp
+  8005a9:	53                   	push   %ebx
+  8005aa:	ff 30                	push   (%eax)
+  8005ac:	ff d7                	call   *%edi
+			break;
+  8005ae:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005b1:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8005b4:	e9 d4 fe ff ff       	jmp    80048d <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8005b9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8005c2:	8b 10                	mov    (%eax),%edx
+  8005c4:	89 d0                	mov    %edx,%eax
+  8005c6:	f7 d8                	neg    %eax
+  8005c8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005cb:	83 f8 12             	cmp    $0x12,%eax
+  8005ce:	7f 23                	jg     8005f3 <vprintfmt+0x177>
+  8005d0:	8b 14 85 e0 43 80 00 	mov    0x8043e0(,%eax,4),%edx
+  8005d7:	85 d2                	test   %edx,%edx
+  8005d9:	74 18                	je     8005f3 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005db:	52                   	push   %edx
+  8005dc:	68 3b 45 80 00       	push   $0x80453b
+  8005e1:	53                   	push   %ebx
+  8005e2:	57                   	push   %edi
+  8005e3:	e8 77 fe ff ff       	call   80045f <printfmt>
+  8005e8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005eb:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005ee:	e9 9a fe ff ff       	jmp    80048d <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005f3:	50                   	push   %eax
+  8005f4:	68 27 41 80 00       	push   $0x804127
+  8005f9:	53                   	push   %ebx
+  8005fa:	57                   	push   %edi
+  8005fb:	e8 5f fe ff ff       	call   80045f <printfmt>
+  800600:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800603:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800606:	e9 82 fe ff ff       	jmp    80048d <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80060b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	83 c0 04             	add    $0x4,%eax
+  800614:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 00                	mov    (%eax),%eax
+  80061c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80061f:	85 c0                	test   %eax,%eax
+  800621:	0f 84 61 03 00 00    	je     800988 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800627:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80062b:	7e 06                	jle    800633 <vprintfmt+0x1b7>
+  80062d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800631:	75 29                	jne    80065c <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800633:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800636:	8d 70 01             	lea    0x1(%eax),%esi
+  800639:	0f b6 00             	movzbl (%eax),%eax
+  80063c:	0f be d0             	movsbl %al,%edx
+  80063f:	85 d2                	test   %edx,%edx
+  800641:	0f 84 bb 00 00 00    	je     800702 <vprintfmt+0x286>
+  800647:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80064a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80064d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800650:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800653:	eb 7a                	jmp    8006cf <vprintfmt+0x253>
+				p = "(null)";
+  800655:	c7 45 d0 20 41 80 00 	movl   $0x804120,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	ff 75 d4             	push   -0x2c(%ebp)
+  800662:	ff 75 d0             	push   -0x30(%ebp)
+  800665:	e8 e0 03 00 00       	call   800a4a <strnlen>
+  80066a:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80066d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800670:	83 c4 10             	add    $0x10,%esp
+  800673:	85 d2                	test   %edx,%edx
+  800675:	0f 8e d6 02 00 00    	jle    800951 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80067b:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80067f:	83 ec 08             	sub    $0x8,%esp
+  800682:	53                   	push   %ebx
+  800683:	56                   	push   %esi
+  800684:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800686:	83 c4 10             	add    $0x10,%esp
+  800689:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80068d:	75 f0                	jne    80067f <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80068f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800692:	8d 70 01             	lea    0x1(%eax),%esi
+  800695:	0f b6 00             	movzbl (%eax),%eax
+  800698:	0f be d0             	movsbl %al,%edx
+  80069b:	85 d2                	test   %edx,%edx
+  80069d:	0f 84 da 02 00 00    	je     80097d <vprintfmt+0x501>
+  8006a3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8006a6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8006a9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8006ac:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8006af:	eb 1e                	jmp    8006cf <vprintfmt+0x253>
+					putch(ch, putdat);
+  8006b1:	83 ec 08             	sub    $0x8,%esp
+  8006b4:	ff 75 0c             	push   0xc(%ebp)
+  8006b7:	52                   	push   %edx
+  8006b8:	ff 55 08             	call   *0x8(%ebp)
+  8006bb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006be:	83 eb 01             	sub    $0x1,%ebx
+  8006c1:	83 c6 01             	add    $0x1,%esi
+  8006c4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006c8:	0f be d0             	movsbl %al,%edx
+  8006cb:	85 d2                	test   %edx,%edx
+  8006cd:	74 2a                	je     8006f9 <vprintfmt+0x27d>
+  8006cf:	85 ff                	test   %edi,%edi
+  8006d1:	78 05                	js     8006d8 <vprintfmt+0x25c>
+  8006d3:	83 ef 01             	sub    $0x1,%edi
+  8006d6:	78 59                	js     800731 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006d8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006dc:	74 d3                	je     8006b1 <vprintfmt+0x235>
+  8006de:	0f be c0             	movsbl %al,%eax
+  8006e1:	83 e8 20             	sub    $0x20,%eax
+  8006e4:	83 f8 5e             	cmp    $0x5e,%eax
+  8006e7:	76 c8                	jbe    8006b1 <vprintfmt+0x235>
+					putch('?', putdat);
+  8006e9:	83 ec 08             	sub    $0x8,%esp
+  8006ec:	ff 75 0c             	push   0xc(%ebp)
+  8006ef:	6a 3f                	push   $0x3f
+  8006f1:	ff 55 08             	call   *0x8(%ebp)
+  8006f4:	83 c4 10             	add    $0x10,%esp
+  8006f7:	eb c5                	jmp    8006be <vprintfmt+0x242>
+  8006f9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800702:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800705:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800709:	7e 1b                	jle    800726 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80070b:	83 ec 08             	sub    $0x8,%esp
+  80070e:	53                   	push   %ebx
+  80070f:	6a 20                	push   $0x20
+  800711:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800713:	83 c4 10             	add    $0x10,%esp
+  800716:	83 ee 01             	sub    $0x1,%esi
+  800719:	75 f0                	jne    80070b <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800721:	e9 67 fd ff ff       	jmp    80048d <vprintfmt+0x11>
+  800726:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+  80072c:	e9 5c fd ff ff       	jmp    80048d <vprintfmt+0x11>
+  800731:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800734:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800737:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80073a:	eb c6                	jmp    800702 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80073c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80073f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800742:	83 f9 01             	cmp    $0x1,%ecx
+  800745:	7f 1f                	jg     800766 <vprintfmt+0x2ea>
+	else if (lflag)
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	74 67                	je     8007b2 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80074b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074e:	8b 30                	mov    (%eax),%esi
+  800750:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800753:	89 f0                	mov    %esi,%eax
+  800755:	c1 f8 1f             	sar    $0x1f,%eax
+  800758:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8d 40 04             	lea    0x4(%eax),%eax
+  800761:	89 45 14             	mov    %eax,0x14(%ebp)
+  800764:	eb 17                	jmp    80077d <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800766:	8b 45 14             	mov    0x14(%ebp),%eax
+  800769:	8b 50 04             	mov    0x4(%eax),%edx
+  80076c:	8b 00                	mov    (%eax),%eax
+  80076e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800771:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800774:	8b 45 14             	mov    0x14(%ebp),%eax
+  800777:	8d 40 08             	lea    0x8(%eax),%eax
+  80077a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80077d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800780:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800783:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800788:	85 c9                	test   %ecx,%ecx
+  80078a:	0f 89 12 01 00 00    	jns    8008a2 <vprintfmt+0x426>
+				putch('-', putdat);
+  800790:	83 ec 08             	sub    $0x8,%esp
+  800793:	53                   	push   %ebx
+  800794:	6a 2d                	push   $0x2d
+  800796:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800798:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80079b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80079e:	f7 da                	neg    %edx
+  8007a0:	83 d1 00             	adc    $0x0,%ecx
+  8007a3:	f7 d9                	neg    %ecx
+  8007a5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007a8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8007ad:	e9 f0 00 00 00       	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8007b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b5:	8b 30                	mov    (%eax),%esi
+  8007b7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007ba:	89 f0                	mov    %esi,%eax
+  8007bc:	c1 f8 1f             	sar    $0x1f,%eax
+  8007bf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007cb:	eb b0                	jmp    80077d <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007cd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007d0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d3:	83 f9 01             	cmp    $0x1,%ecx
+  8007d6:	7f 1e                	jg     8007f6 <vprintfmt+0x37a>
+	else if (lflag)
+  8007d8:	85 c9                	test   %ecx,%ecx
+  8007da:	74 32                	je     80080e <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ec:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007f1:	e9 ac 00 00 00       	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f9:	8b 10                	mov    (%eax),%edx
+  8007fb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fe:	8d 40 08             	lea    0x8(%eax),%eax
+  800801:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800804:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800809:	e9 94 00 00 00       	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 10                	mov    (%eax),%edx
+  800813:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800818:	8d 40 04             	lea    0x4(%eax),%eax
+  80081b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80081e:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800823:	eb 7d                	jmp    8008a2 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800825:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800828:	89 55 10             	mov    %edx,0x10(%ebp)
+  80082b:	83 f9 01             	cmp    $0x1,%ecx
+  80082e:	7f 1b                	jg     80084b <vprintfmt+0x3cf>
+	else if (lflag)
+  800830:	85 c9                	test   %ecx,%ecx
+  800832:	74 2c                	je     800860 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800834:	8b 45 14             	mov    0x14(%ebp),%eax
+  800837:	8b 10                	mov    (%eax),%edx
+  800839:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083e:	8d 40 04             	lea    0x4(%eax),%eax
+  800841:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800844:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800849:	eb 57                	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8b 10                	mov    (%eax),%edx
+  800850:	8b 48 04             	mov    0x4(%eax),%ecx
+  800853:	8d 40 08             	lea    0x8(%eax),%eax
+  800856:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800859:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80085e:	eb 42                	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800860:	8b 45 14             	mov    0x14(%ebp),%eax
+  800863:	8b 10                	mov    (%eax),%edx
+  800865:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086a:	8d 40 04             	lea    0x4(%eax),%eax
+  80086d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800870:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800875:	eb 2b                	jmp    8008a2 <vprintfmt+0x426>
+			putch('0', putdat);
+  800877:	89 55 10             	mov    %edx,0x10(%ebp)
+  80087a:	83 ec 08             	sub    $0x8,%esp
+  80087d:	53                   	push   %ebx
+  80087e:	6a 30                	push   $0x30
+  800880:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800882:	83 c4 08             	add    $0x8,%esp
+  800885:	53                   	push   %ebx
+  800886:	6a 78                	push   $0x78
+  800888:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80088a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088d:	8b 10                	mov    (%eax),%edx
+  80088f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800894:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800897:	8d 40 04             	lea    0x4(%eax),%eax
+  80089a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80089d:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8008a2:	83 ec 0c             	sub    $0xc,%esp
+  8008a5:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8008a9:	50                   	push   %eax
+  8008aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8008ad:	56                   	push   %esi
+  8008ae:	51                   	push   %ecx
+  8008af:	52                   	push   %edx
+  8008b0:	89 da                	mov    %ebx,%edx
+  8008b2:	89 f8                	mov    %edi,%eax
+  8008b4:	e8 d8 fa ff ff       	call   800391 <printnum>
+			break;
+  8008b9:	83 c4 20             	add    $0x20,%esp
+  8008bc:	e9 cc fb ff ff       	jmp    80048d <vprintfmt+0x11>
+	if (lflag >= 2)
+  8008c1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008c4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ca:	7f 1b                	jg     8008e7 <vprintfmt+0x46b>
+	else if (lflag)
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	74 2c                	je     8008fc <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d3:	8b 10                	mov    (%eax),%edx
+  8008d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008da:	8d 40 04             	lea    0x4(%eax),%eax
+  8008dd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008e0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008e5:	eb bb                	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ea:	8b 10                	mov    (%eax),%edx
+  8008ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f5:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8008fa:	eb a6                	jmp    8008a2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 10                	mov    (%eax),%edx
+  800901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800906:	8d 40 04             	lea    0x4(%eax),%eax
+  800909:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80090c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800911:	eb 8f                	jmp    8008a2 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800913:	89 55 10             	mov    %edx,0x10(%ebp)
+  800916:	83 ec 08             	sub    $0x8,%esp
+  800919:	53                   	push   %ebx
+  80091a:	6a 25                	push   $0x25
+  80091c:	ff d7                	call   *%edi
+			break;
+  80091e:	83 c4 10             	add    $0x10,%esp
+  800921:	e9 67 fb ff ff       	jmp    80048d <vprintfmt+0x11>
+			putch('%', putdat);
+  800926:	83 ec 08             	sub    $0x8,%esp
+  800929:	53                   	push   %ebx
+  80092a:	6a 25                	push   $0x25
+  80092c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80092e:	83 c4 10             	add    $0x10,%esp
+  800931:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800935:	0f 84 ba fb ff ff    	je     8004f5 <vprintfmt+0x79>
+  80093b:	89 75 10             	mov    %esi,0x10(%ebp)
+  80093e:	89 f0                	mov    %esi,%eax
+  800940:	83 e8 01             	sub    $0x1,%eax
+  800943:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800947:	75 f7                	jne    800940 <vprintfmt+0x4c4>
+  800949:	89 45 10             	mov    %eax,0x10(%ebp)
+  80094c:	e9 3c fb ff ff       	jmp    80048d <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800951:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800954:	8d 70 01             	lea    0x1(%eax),%esi
+  800957:	0f b6 00             	movzbl (%eax),%eax
+  80095a:	0f be d0             	movsbl %al,%edx
+  80095d:	85 d2                	test   %edx,%edx
+  80095f:	74 11                	je     800972 <vprintfmt+0x4f6>
+  800961:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800964:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800967:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80096a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80096d:	e9 5d fd ff ff       	jmp    8006cf <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800972:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800975:	89 45 14             	mov    %eax,0x14(%ebp)
+  800978:	e9 10 fb ff ff       	jmp    80048d <vprintfmt+0x11>
+  80097d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800980:	89 45 14             	mov    %eax,0x14(%ebp)
+  800983:	e9 05 fb ff ff       	jmp    80048d <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800988:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80098c:	7e 0a                	jle    800998 <vprintfmt+0x51c>
+  80098e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800992:	0f 85 bd fc ff ff    	jne    800655 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800998:	ba 28 00 00 00       	mov    $0x28,%edx
+  80099d:	b8 28 00 00 00       	mov    $0x28,%eax
+  8009a2:	be 21 41 80 00       	mov    $0x804121,%esi
+  8009a7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009aa:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009ad:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009b0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009b3:	e9 17 fd ff ff       	jmp    8006cf <vprintfmt+0x253>
+}
+  8009b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009bb:	5b                   	pop    %ebx
+  8009bc:	5e                   	pop    %esi
+  8009bd:	5f                   	pop    %edi
+  8009be:	5d                   	pop    %ebp
+  8009bf:	c3                   	ret
+
+008009c0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009c0:	55                   	push   %ebp
+  8009c1:	89 e5                	mov    %esp,%ebp
+  8009c3:	83 ec 18             	sub    $0x18,%esp
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009cf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009dd:	85 c0                	test   %eax,%eax
+  8009df:	74 26                	je     800a07 <vsnprintf+0x47>
+  8009e1:	85 d2                	test   %edx,%edx
+  8009e3:	7e 22                	jle    800a07 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009e5:	ff 75 14             	push   0x14(%ebp)
+  8009e8:	ff 75 10             	push   0x10(%ebp)
+  8009eb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009ee:	50                   	push   %eax
+  8009ef:	68 42 04 80 00       	push   $0x800442
+  8009f4:	e8 83 fa ff ff       	call   80047c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009fc:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a02:	83 c4 10             	add    $0x10,%esp
+}
+  800a05:	c9                   	leave
+  800a06:	c3                   	ret
+		return -E_INVAL;
+  800a07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a0c:	eb f7                	jmp    800a05 <vsnprintf+0x45>
+
+00800a0e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800a14:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a17:	50                   	push   %eax
+  800a18:	ff 75 10             	push   0x10(%ebp)
+  800a1b:	ff 75 0c             	push   0xc(%ebp)
+  800a1e:	ff 75 08             	push   0x8(%ebp)
+  800a21:	e8 9a ff ff ff       	call   8009c0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a26:	c9                   	leave
+  800a27:	c3                   	ret
+
+00800a28 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a2e:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a31:	74 10                	je     800a43 <strlen+0x1b>
+  800a33:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a38:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a3b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a3f:	75 f7                	jne    800a38 <strlen+0x10>
+	return n;
+}
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a43:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a48:	eb f7                	jmp    800a41 <strlen+0x19>
+
+00800a4a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a50:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a53:	85 d2                	test   %edx,%edx
+  800a55:	74 16                	je     800a6d <strnlen+0x23>
+  800a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a60:	74 09                	je     800a6b <strnlen+0x21>
+		n++;
+  800a62:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a65:	39 d0                	cmp    %edx,%eax
+  800a67:	75 f3                	jne    800a5c <strnlen+0x12>
+		n++;
+  800a69:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a72:	eb f7                	jmp    800a6b <strnlen+0x21>
+
+00800a74 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	53                   	push   %ebx
+  800a78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a87:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a8a:	83 c0 01             	add    $0x1,%eax
+  800a8d:	84 d2                	test   %dl,%dl
+  800a8f:	75 f2                	jne    800a83 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a91:	89 c8                	mov    %ecx,%eax
+  800a93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a96:	c9                   	leave
+  800a97:	c3                   	ret
+
+00800a98 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a98:	55                   	push   %ebp
+  800a99:	89 e5                	mov    %esp,%ebp
+  800a9b:	53                   	push   %ebx
+  800a9c:	83 ec 10             	sub    $0x10,%esp
+  800a9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800aa2:	53                   	push   %ebx
+  800aa3:	e8 80 ff ff ff       	call   800a28 <strlen>
+  800aa8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aab:	ff 75 0c             	push   0xc(%ebp)
+  800aae:	01 d8                	add    %ebx,%eax
+  800ab0:	50                   	push   %eax
+  800ab1:	e8 be ff ff ff       	call   800a74 <strcpy>
+	return dst;
+}
+  800ab6:	89 d8                	mov    %ebx,%eax
+  800ab8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abb:	c9                   	leave
+  800abc:	c3                   	ret
+
+00800abd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800abd:	55                   	push   %ebp
+  800abe:	89 e5                	mov    %esp,%ebp
+  800ac0:	56                   	push   %esi
+  800ac1:	53                   	push   %ebx
+  800ac2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800acb:	85 db                	test   %ebx,%ebx
+  800acd:	74 17                	je     800ae6 <strncpy+0x29>
+  800acf:	01 f3                	add    %esi,%ebx
+  800ad1:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800ad3:	83 c0 01             	add    $0x1,%eax
+  800ad6:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800adc:	80 f9 01             	cmp    $0x1,%cl
+  800adf:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800ae2:	39 c3                	cmp    %eax,%ebx
+  800ae4:	75 ed                	jne    800ad3 <strncpy+0x16>
+	}
+	return ret;
+}
+  800ae6:	89 f0                	mov    %esi,%eax
+  800ae8:	5b                   	pop    %ebx
+  800ae9:	5e                   	pop    %esi
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+
+00800aec <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	56                   	push   %esi
+  800af0:	53                   	push   %ebx
+  800af1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800afa:	89 f0                	mov    %esi,%eax
+  800afc:	85 db                	test   %ebx,%ebx
+  800afe:	74 1e                	je     800b1e <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800b00:	83 eb 01             	sub    $0x1,%ebx
+  800b03:	74 16                	je     800b1b <strlcpy+0x2f>
+  800b05:	01 f3                	add    %esi,%ebx
+  800b07:	0f b6 0a             	movzbl (%edx),%ecx
+  800b0a:	84 c9                	test   %cl,%cl
+  800b0c:	74 0d                	je     800b1b <strlcpy+0x2f>
+			*dst++ = *src++;
+  800b0e:	83 c2 01             	add    $0x1,%edx
+  800b11:	83 c0 01             	add    $0x1,%eax
+  800b14:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800b17:	39 d8                	cmp    %ebx,%eax
+  800b19:	75 ec                	jne    800b07 <strlcpy+0x1b>
+		*dst = '\0';
+  800b1b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b1e:	29 f0                	sub    %esi,%eax
+}
+  800b20:	5b                   	pop    %ebx
+  800b21:	5e                   	pop    %esi
+  800b22:	5d                   	pop    %ebp
+  800b23:	c3                   	ret
+
+00800b24 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b2d:	0f b6 01             	movzbl (%ecx),%eax
+  800b30:	84 c0                	test   %al,%al
+  800b32:	74 11                	je     800b45 <strcmp+0x21>
+  800b34:	38 02                	cmp    %al,(%edx)
+  800b36:	75 0d                	jne    800b45 <strcmp+0x21>
+		p++, q++;
+  800b38:	83 c1 01             	add    $0x1,%ecx
+  800b3b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b3e:	0f b6 01             	movzbl (%ecx),%eax
+  800b41:	84 c0                	test   %al,%al
+  800b43:	75 ef                	jne    800b34 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b45:	0f b6 c0             	movzbl %al,%eax
+  800b48:	0f b6 12             	movzbl (%edx),%edx
+  800b4b:	29 d0                	sub    %edx,%eax
+}
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	53                   	push   %ebx
+  800b53:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b56:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b59:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b61:	85 d2                	test   %edx,%edx
+  800b63:	74 2e                	je     800b93 <strncmp+0x44>
+  800b65:	0f b6 01             	movzbl (%ecx),%eax
+  800b68:	84 c0                	test   %al,%al
+  800b6a:	74 16                	je     800b82 <strncmp+0x33>
+  800b6c:	3a 03                	cmp    (%ebx),%al
+  800b6e:	75 12                	jne    800b82 <strncmp+0x33>
+		n--, p++, q++;
+  800b70:	83 c1 01             	add    $0x1,%ecx
+  800b73:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b76:	83 ea 01             	sub    $0x1,%edx
+  800b79:	75 ea                	jne    800b65 <strncmp+0x16>
+		return 0;
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b80:	eb 11                	jmp    800b93 <strncmp+0x44>
+  800b82:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b87:	85 d2                	test   %edx,%edx
+  800b89:	74 08                	je     800b93 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b8b:	0f b6 01             	movzbl (%ecx),%eax
+  800b8e:	0f b6 13             	movzbl (%ebx),%edx
+  800b91:	29 d0                	sub    %edx,%eax
+}
+  800b93:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b96:	c9                   	leave
+  800b97:	c3                   	ret
+
+00800b98 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ba2:	0f b6 10             	movzbl (%eax),%edx
+  800ba5:	84 d2                	test   %dl,%dl
+  800ba7:	74 15                	je     800bbe <strchr+0x26>
+		if (*s == c)
+  800ba9:	38 d1                	cmp    %dl,%cl
+  800bab:	74 0f                	je     800bbc <strchr+0x24>
+	for (; *s; s++)
+  800bad:	83 c0 01             	add    $0x1,%eax
+  800bb0:	0f b6 10             	movzbl (%eax),%edx
+  800bb3:	84 d2                	test   %dl,%dl
+  800bb5:	75 f2                	jne    800ba9 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bbc:	5d                   	pop    %ebp
+  800bbd:	c3                   	ret
+	return 0;
+  800bbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc3:	eb f7                	jmp    800bbc <strchr+0x24>
+
+00800bc5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bc5:	55                   	push   %ebp
+  800bc6:	89 e5                	mov    %esp,%ebp
+  800bc8:	53                   	push   %ebx
+  800bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bcc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800bcf:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bd2:	38 d3                	cmp    %dl,%bl
+  800bd4:	74 14                	je     800bea <strfind+0x25>
+  800bd6:	89 d1                	mov    %edx,%ecx
+  800bd8:	84 db                	test   %bl,%bl
+  800bda:	74 0e                	je     800bea <strfind+0x25>
+	for (; *s; s++)
+  800bdc:	83 c0 01             	add    $0x1,%eax
+  800bdf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800be2:	38 ca                	cmp    %cl,%dl
+  800be4:	74 04                	je     800bea <strfind+0x25>
+  800be6:	84 d2                	test   %dl,%dl
+  800be8:	75 f2                	jne    800bdc <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800bea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bed:	c9                   	leave
+  800bee:	c3                   	ret
+
+00800bef <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	57                   	push   %edi
+  800bf3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bf6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bf9:	85 c9                	test   %ecx,%ecx
+  800bfb:	74 20                	je     800c1d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bfd:	89 f8                	mov    %edi,%eax
+  800bff:	09 c8                	or     %ecx,%eax
+  800c01:	a8 03                	test   $0x3,%al
+  800c03:	75 12                	jne    800c17 <memset+0x28>
+		c &= 0xFF;
+  800c05:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c09:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800c0f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800c12:	fc                   	cld
+  800c13:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c15:	eb 06                	jmp    800c1d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1a:	fc                   	cld
+  800c1b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c1d:	89 f8                	mov    %edi,%eax
+  800c1f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c22:	c9                   	leave
+  800c23:	c3                   	ret
+
+00800c24 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c2f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c32:	39 c6                	cmp    %eax,%esi
+  800c34:	73 32                	jae    800c68 <memmove+0x44>
+  800c36:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c39:	39 d0                	cmp    %edx,%eax
+  800c3b:	73 2b                	jae    800c68 <memmove+0x44>
+		s += n;
+		d += n;
+  800c3d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c40:	89 d6                	mov    %edx,%esi
+  800c42:	09 fe                	or     %edi,%esi
+  800c44:	09 ce                	or     %ecx,%esi
+  800c46:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c4c:	75 0e                	jne    800c5c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c4e:	83 ef 04             	sub    $0x4,%edi
+  800c51:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c54:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c57:	fd                   	std
+  800c58:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c5a:	eb 09                	jmp    800c65 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c5c:	83 ef 01             	sub    $0x1,%edi
+  800c5f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c62:	fd                   	std
+  800c63:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c65:	fc                   	cld
+  800c66:	eb 1a                	jmp    800c82 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c68:	89 f2                	mov    %esi,%edx
+  800c6a:	09 c2                	or     %eax,%edx
+  800c6c:	09 ca                	or     %ecx,%edx
+  800c6e:	f6 c2 03             	test   $0x3,%dl
+  800c71:	75 0a                	jne    800c7d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c73:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c76:	89 c7                	mov    %eax,%edi
+  800c78:	fc                   	cld
+  800c79:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c7b:	eb 05                	jmp    800c82 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c7d:	89 c7                	mov    %eax,%edi
+  800c7f:	fc                   	cld
+  800c80:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c82:	5e                   	pop    %esi
+  800c83:	5f                   	pop    %edi
+  800c84:	5d                   	pop    %ebp
+  800c85:	c3                   	ret
+
+00800c86 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c8c:	ff 75 10             	push   0x10(%ebp)
+  800c8f:	ff 75 0c             	push   0xc(%ebp)
+  800c92:	ff 75 08             	push   0x8(%ebp)
+  800c95:	e8 8a ff ff ff       	call   800c24 <memmove>
+}
+  800c9a:	c9                   	leave
+  800c9b:	c3                   	ret
+
+00800c9c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+  800ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca7:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800caa:	85 f6                	test   %esi,%esi
+  800cac:	74 29                	je     800cd7 <memcmp+0x3b>
+  800cae:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800cb0:	0f b6 08             	movzbl (%eax),%ecx
+  800cb3:	0f b6 1a             	movzbl (%edx),%ebx
+  800cb6:	38 d9                	cmp    %bl,%cl
+  800cb8:	75 11                	jne    800ccb <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800cba:	83 c0 01             	add    $0x1,%eax
+  800cbd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800cc0:	39 c6                	cmp    %eax,%esi
+  800cc2:	75 ec                	jne    800cb0 <memcmp+0x14>
+	}
+
+	return 0;
+  800cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc9:	eb 08                	jmp    800cd3 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ccb:	0f b6 c1             	movzbl %cl,%eax
+  800cce:	0f b6 db             	movzbl %bl,%ebx
+  800cd1:	29 d8                	sub    %ebx,%eax
+}
+  800cd3:	5b                   	pop    %ebx
+  800cd4:	5e                   	pop    %esi
+  800cd5:	5d                   	pop    %ebp
+  800cd6:	c3                   	ret
+	return 0;
+  800cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdc:	eb f5                	jmp    800cd3 <memcmp+0x37>
+
+00800cde <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ce7:	89 c2                	mov    %eax,%edx
+  800ce9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cec:	39 d0                	cmp    %edx,%eax
+  800cee:	73 0d                	jae    800cfd <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cf0:	38 08                	cmp    %cl,(%eax)
+  800cf2:	74 0d                	je     800d01 <memfind+0x23>
+	for (; s < ends; s++)
+  800cf4:	83 c0 01             	add    $0x1,%eax
+  800cf7:	39 c2                	cmp    %eax,%edx
+  800cf9:	75 f5                	jne    800cf0 <memfind+0x12>
+  800cfb:	eb 06                	jmp    800d03 <memfind+0x25>
+  800cfd:	89 c2                	mov    %eax,%edx
+  800cff:	eb 02                	jmp    800d03 <memfind+0x25>
+  800d01:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800d03:	89 d0                	mov    %edx,%eax
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+
+00800d07 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d07:	55                   	push   %ebp
+  800d08:	89 e5                	mov    %esp,%ebp
+  800d0a:	57                   	push   %edi
+  800d0b:	56                   	push   %esi
+  800d0c:	53                   	push   %ebx
+  800d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800d13:	0f b6 02             	movzbl (%edx),%eax
+  800d16:	3c 20                	cmp    $0x20,%al
+  800d18:	74 04                	je     800d1e <strtol+0x17>
+  800d1a:	3c 09                	cmp    $0x9,%al
+  800d1c:	75 0e                	jne    800d2c <strtol+0x25>
+		s++;
+  800d1e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d21:	0f b6 02             	movzbl (%edx),%eax
+  800d24:	3c 20                	cmp    $0x20,%al
+  800d26:	74 f6                	je     800d1e <strtol+0x17>
+  800d28:	3c 09                	cmp    $0x9,%al
+  800d2a:	74 f2                	je     800d1e <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d2c:	3c 2b                	cmp    $0x2b,%al
+  800d2e:	74 2a                	je     800d5a <strtol+0x53>
+	int neg = 0;
+  800d30:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d35:	3c 2d                	cmp    $0x2d,%al
+  800d37:	74 2b                	je     800d64 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d39:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d3f:	75 0f                	jne    800d50 <strtol+0x49>
+  800d41:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d44:	74 28                	je     800d6e <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d46:	85 db                	test   %ebx,%ebx
+  800d48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4d:	0f 44 d8             	cmove  %eax,%ebx
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d58:	eb 46                	jmp    800da0 <strtol+0x99>
+		s++;
+  800d5a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d62:	eb d5                	jmp    800d39 <strtol+0x32>
+		s++, neg = 1;
+  800d64:	83 c2 01             	add    $0x1,%edx
+  800d67:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d6c:	eb cb                	jmp    800d39 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d72:	74 0e                	je     800d82 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d74:	85 db                	test   %ebx,%ebx
+  800d76:	75 d8                	jne    800d50 <strtol+0x49>
+		s++, base = 8;
+  800d78:	83 c2 01             	add    $0x1,%edx
+  800d7b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d80:	eb ce                	jmp    800d50 <strtol+0x49>
+		s += 2, base = 16;
+  800d82:	83 c2 02             	add    $0x2,%edx
+  800d85:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d8a:	eb c4                	jmp    800d50 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d8c:	0f be c0             	movsbl %al,%eax
+  800d8f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d92:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d95:	7d 3a                	jge    800dd1 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d97:	83 c2 01             	add    $0x1,%edx
+  800d9a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d9e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800da0:	0f b6 02             	movzbl (%edx),%eax
+  800da3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800da6:	89 f3                	mov    %esi,%ebx
+  800da8:	80 fb 09             	cmp    $0x9,%bl
+  800dab:	76 df                	jbe    800d8c <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800dad:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800db0:	89 f3                	mov    %esi,%ebx
+  800db2:	80 fb 19             	cmp    $0x19,%bl
+  800db5:	77 08                	ja     800dbf <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800db7:	0f be c0             	movsbl %al,%eax
+  800dba:	83 e8 57             	sub    $0x57,%eax
+  800dbd:	eb d3                	jmp    800d92 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dbf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dc2:	89 f3                	mov    %esi,%ebx
+  800dc4:	80 fb 19             	cmp    $0x19,%bl
+  800dc7:	77 08                	ja     800dd1 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800dc9:	0f be c0             	movsbl %al,%eax
+  800dcc:	83 e8 37             	sub    $0x37,%eax
+  800dcf:	eb c1                	jmp    800d92 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dd1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dd5:	74 05                	je     800ddc <strtol+0xd5>
+		*endptr = (char *) s;
+  800dd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dda:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ddc:	89 c8                	mov    %ecx,%eax
+  800dde:	f7 d8                	neg    %eax
+  800de0:	85 ff                	test   %edi,%edi
+  800de2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800de5:	89 c8                	mov    %ecx,%eax
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	89 c3                	mov    %eax,%ebx
+  800dff:	89 c7                	mov    %eax,%edi
+  800e01:	89 c6                	mov    %eax,%esi
+  800e03:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e15:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e1a:	89 d1                	mov    %edx,%ecx
+  800e1c:	89 d3                	mov    %edx,%ebx
+  800e1e:	89 d7                	mov    %edx,%edi
+  800e20:	89 d6                	mov    %edx,%esi
+  800e22:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e3f:	89 cb                	mov    %ecx,%ebx
+  800e41:	89 cf                	mov    %ecx,%edi
+  800e43:	89 ce                	mov    %ecx,%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 03                	push   $0x3
+  800e59:	68 4b 44 80 00       	push   $0x80444b
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 68 44 80 00       	push   $0x804468
+  800e65:	e8 38 f4 ff ff       	call   8002a2 <_panic>
+
+00800e6a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e75:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e7a:	89 d1                	mov    %edx,%ecx
+  800e7c:	89 d3                	mov    %edx,%ebx
+  800e7e:	89 d7                	mov    %edx,%edi
+  800e80:	89 d6                	mov    %edx,%esi
+  800e82:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e99:	89 d1                	mov    %edx,%ecx
+  800e9b:	89 d3                	mov    %edx,%ebx
+  800e9d:	89 d7                	mov    %edx,%edi
+  800e9f:	89 d6                	mov    %edx,%esi
+  800ea1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+
+00800ea8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	56                   	push   %esi
+  800ead:	53                   	push   %ebx
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb1:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec4:	89 f7                	mov    %esi,%edi
+  800ec6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 04                	push   $0x4
+  800eda:	68 4b 44 80 00       	push   $0x80444b
+  800edf:	6a 23                	push   $0x23
+  800ee1:	68 68 44 80 00       	push   $0x804468
+  800ee6:	e8 b7 f3 ff ff       	call   8002a2 <_panic>
+
+00800eeb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efa:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f02:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f05:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f08:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	7f 08                	jg     800f16 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+  800f19:	50                   	push   %eax
+  800f1a:	6a 05                	push   $0x5
+  800f1c:	68 4b 44 80 00       	push   $0x80444b
+  800f21:	6a 23                	push   $0x23
+  800f23:	68 68 44 80 00       	push   $0x804468
+  800f28:	e8 75 f3 ff ff       	call   8002a2 <_panic>
+
+00800f2d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f41:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f46:	89 df                	mov    %ebx,%edi
+  800f48:	89 de                	mov    %ebx,%esi
+  800f4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	7f 08                	jg     800f58 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	50                   	push   %eax
+  800f5c:	6a 06                	push   $0x6
+  800f5e:	68 4b 44 80 00       	push   $0x80444b
+  800f63:	6a 23                	push   $0x23
+  800f65:	68 68 44 80 00       	push   $0x804468
+  800f6a:	e8 33 f3 ff ff       	call   8002a2 <_panic>
+
+00800f6f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	57                   	push   %edi
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f83:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f88:	89 df                	mov    %ebx,%edi
+  800f8a:	89 de                	mov    %ebx,%esi
+  800f8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8e:	85 c0                	test   %eax,%eax
+  800f90:	7f 08                	jg     800f9a <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+  800f9d:	50                   	push   %eax
+  800f9e:	6a 08                	push   $0x8
+  800fa0:	68 4b 44 80 00       	push   $0x80444b
+  800fa5:	6a 23                	push   $0x23
+  800fa7:	68 68 44 80 00       	push   $0x804468
+  800fac:	e8 f1 f2 ff ff       	call   8002a2 <_panic>
+
+00800fb1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	57                   	push   %edi
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	89 de                	mov    %ebx,%esi
+  800fce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd0:	85 c0                	test   %eax,%eax
+  800fd2:	7f 08                	jg     800fdc <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+  800fdf:	50                   	push   %eax
+  800fe0:	6a 09                	push   $0x9
+  800fe2:	68 4b 44 80 00       	push   $0x80444b
+  800fe7:	6a 23                	push   $0x23
+  800fe9:	68 68 44 80 00       	push   $0x804468
+  800fee:	e8 af f2 ff ff       	call   8002a2 <_panic>
+
+00800ff3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+  800ff9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801007:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100c:	89 df                	mov    %ebx,%edi
+  80100e:	89 de                	mov    %ebx,%esi
+  801010:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801012:	85 c0                	test   %eax,%eax
+  801014:	7f 08                	jg     80101e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801016:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801019:	5b                   	pop    %ebx
+  80101a:	5e                   	pop    %esi
+  80101b:	5f                   	pop    %edi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101e:	83 ec 0c             	sub    $0xc,%esp
+  801021:	50                   	push   %eax
+  801022:	6a 0a                	push   $0xa
+  801024:	68 4b 44 80 00       	push   $0x80444b
+  801029:	6a 23                	push   $0x23
+  80102b:	68 68 44 80 00       	push   $0x804468
+  801030:	e8 6d f2 ff ff       	call   8002a2 <_panic>
+
+00801035 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801046:	be 00 00 00 00       	mov    $0x0,%esi
+  80104b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801051:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80106e:	89 cb                	mov    %ecx,%ebx
+  801070:	89 cf                	mov    %ecx,%edi
+  801072:	89 ce                	mov    %ecx,%esi
+  801074:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801076:	85 c0                	test   %eax,%eax
+  801078:	7f 08                	jg     801082 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80107a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 0d                	push   $0xd
+  801088:	68 4b 44 80 00       	push   $0x80444b
+  80108d:	6a 23                	push   $0x23
+  80108f:	68 68 44 80 00       	push   $0x804468
+  801094:	e8 09 f2 ff ff       	call   8002a2 <_panic>
+
+00801099 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ad:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010b0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010b3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+
+008010ba <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8010ba:	55                   	push   %ebp
+  8010bb:	89 e5                	mov    %esp,%ebp
+  8010bd:	57                   	push   %edi
+  8010be:	56                   	push   %esi
+  8010bf:	53                   	push   %ebx
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ce:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010d3:	89 df                	mov    %ebx,%edi
+  8010d5:	89 de                	mov    %ebx,%esi
+  8010d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	7f 08                	jg     8010e5 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	50                   	push   %eax
+  8010e9:	6a 0d                	push   $0xd
+  8010eb:	68 4b 44 80 00       	push   $0x80444b
+  8010f0:	6a 23                	push   $0x23
+  8010f2:	68 68 44 80 00       	push   $0x804468
+  8010f7:	e8 a6 f1 ff ff       	call   8002a2 <_panic>
+
+008010fc <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+  801107:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80110c:	89 d1                	mov    %edx,%ecx
+  80110e:	89 d3                	mov    %edx,%ebx
+  801110:	89 d7                	mov    %edx,%edi
+  801112:	89 d6                	mov    %edx,%esi
+  801114:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801116:	5b                   	pop    %ebx
+  801117:	5e                   	pop    %esi
+  801118:	5f                   	pop    %edi
+  801119:	5d                   	pop    %ebp
+  80111a:	c3                   	ret
+
+0080111b <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80111b:	55                   	push   %ebp
+  80111c:	89 e5                	mov    %esp,%ebp
+  80111e:	57                   	push   %edi
+  80111f:	56                   	push   %esi
+  801120:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801121:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801126:	8b 55 08             	mov    0x8(%ebp),%edx
+  801129:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801131:	89 df                	mov    %ebx,%edi
+  801133:	89 de                	mov    %ebx,%esi
+  801135:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+
+0080113c <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80113c:	55                   	push   %ebp
+  80113d:	89 e5                	mov    %esp,%ebp
+  80113f:	57                   	push   %edi
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801142:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801147:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80114f:	89 cb                	mov    %ecx,%ebx
+  801151:	89 cf                	mov    %ecx,%edi
+  801153:	89 ce                	mov    %ecx,%esi
+  801155:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801157:	5b                   	pop    %ebx
+  801158:	5e                   	pop    %esi
+  801159:	5f                   	pop    %edi
+  80115a:	5d                   	pop    %ebp
+  80115b:	c3                   	ret
+
+0080115c <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	89 de                	mov    %ebx,%esi
+  801176:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801183:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118e:	b8 12 00 00 00       	mov    $0x12,%eax
+  801193:	89 df                	mov    %ebx,%edi
+  801195:	89 de                	mov    %ebx,%esi
+  801197:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ac:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011b1:	89 cb                	mov    %ecx,%ebx
+  8011b3:	89 cf                	mov    %ecx,%edi
+  8011b5:	89 ce                	mov    %ecx,%esi
+  8011b7:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8011b9:	5b                   	pop    %ebx
+  8011ba:	5e                   	pop    %esi
+  8011bb:	5f                   	pop    %edi
+  8011bc:	5d                   	pop    %ebp
+  8011bd:	c3                   	ret
+
+008011be <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8011be:	55                   	push   %ebp
+  8011bf:	89 e5                	mov    %esp,%ebp
+  8011c1:	57                   	push   %edi
+  8011c2:	56                   	push   %esi
+  8011c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cf:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011d4:	89 df                	mov    %ebx,%edi
+  8011d6:	89 de                	mov    %ebx,%esi
+  8011d8:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011da:	5b                   	pop    %ebx
+  8011db:	5e                   	pop    %esi
+  8011dc:	5f                   	pop    %edi
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	57                   	push   %edi
+  8011e3:	56                   	push   %esi
+  8011e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011f2:	89 cb                	mov    %ecx,%ebx
+  8011f4:	89 cf                	mov    %ecx,%edi
+  8011f6:	89 ce                	mov    %ecx,%esi
+  8011f8:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8011fa:	5b                   	pop    %ebx
+  8011fb:	5e                   	pop    %esi
+  8011fc:	5f                   	pop    %edi
+  8011fd:	5d                   	pop    %ebp
+  8011fe:	c3                   	ret
+
+008011ff <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	56                   	push   %esi
+  801204:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801205:	be 00 00 00 00       	mov    $0x0,%esi
+  80120a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801210:	b8 16 00 00 00       	mov    $0x16,%eax
+  801215:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801218:	89 f7                	mov    %esi,%edi
+  80121a:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+
+00801221 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801227:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801232:	b8 17 00 00 00       	mov    $0x17,%eax
+  801237:	89 df                	mov    %ebx,%edi
+  801239:	89 de                	mov    %ebx,%esi
+  80123b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80123d:	5b                   	pop    %ebx
+  80123e:	5e                   	pop    %esi
+  80123f:	5f                   	pop    %edi
+  801240:	5d                   	pop    %ebp
+  801241:	c3                   	ret
+
+00801242 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801242:	55                   	push   %ebp
+  801243:	89 e5                	mov    %esp,%ebp
+  801245:	57                   	push   %edi
+  801246:	56                   	push   %esi
+  801247:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801248:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801250:	b8 18 00 00 00       	mov    $0x18,%eax
+  801255:	89 cb                	mov    %ecx,%ebx
+  801257:	89 cf                	mov    %ecx,%edi
+  801259:	89 ce                	mov    %ecx,%esi
+  80125b:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80125d:	5b                   	pop    %ebx
+  80125e:	5e                   	pop    %esi
+  80125f:	5f                   	pop    %edi
+  801260:	5d                   	pop    %ebp
+  801261:	c3                   	ret
+
+00801262 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	57                   	push   %edi
+  801266:	56                   	push   %esi
+  801267:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801268:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801274:	b8 19 00 00 00       	mov    $0x19,%eax
+  801279:	89 df                	mov    %ebx,%edi
+  80127b:	89 de                	mov    %ebx,%esi
+  80127d:	cd 30                	int    $0x30
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80128a:	be 00 00 00 00       	mov    $0x0,%esi
+  80128f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801295:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80129a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80129d:	89 f7                	mov    %esi,%edi
+  80129f:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8012a1:	5b                   	pop    %ebx
+  8012a2:	5e                   	pop    %esi
+  8012a3:	5f                   	pop    %edi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+
+008012a6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	57                   	push   %edi
+  8012aa:	56                   	push   %esi
+  8012ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bf:	89 f7                	mov    %esi,%edi
+  8012c1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8012c3:	5b                   	pop    %ebx
+  8012c4:	5e                   	pop    %esi
+  8012c5:	5f                   	pop    %edi
+  8012c6:	5d                   	pop    %ebp
+  8012c7:	c3                   	ret
+
+008012c8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012c8:	55                   	push   %ebp
+  8012c9:	89 e5                	mov    %esp,%ebp
+  8012cb:	57                   	push   %edi
+  8012cc:	56                   	push   %esi
+  8012cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012de:	89 df                	mov    %ebx,%edi
+  8012e0:	89 de                	mov    %ebx,%esi
+  8012e2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012e4:	5b                   	pop    %ebx
+  8012e5:	5e                   	pop    %esi
+  8012e6:	5f                   	pop    %edi
+  8012e7:	5d                   	pop    %ebp
+  8012e8:	c3                   	ret
+
+008012e9 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012e9:	55                   	push   %ebp
+  8012ea:	89 e5                	mov    %esp,%ebp
+  8012ec:	57                   	push   %edi
+  8012ed:	56                   	push   %esi
+  8012ee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801302:	89 f7                	mov    %esi,%edi
+  801304:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801306:	5b                   	pop    %ebx
+  801307:	5e                   	pop    %esi
+  801308:	5f                   	pop    %edi
+  801309:	5d                   	pop    %ebp
+  80130a:	c3                   	ret
+
+0080130b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80130e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801311:	05 00 00 00 30       	add    $0x30000000,%eax
+  801316:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801319:	5d                   	pop    %ebp
+  80131a:	c3                   	ret
+
+0080131b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80131e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801321:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801326:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80132b:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801330:	5d                   	pop    %ebp
+  801331:	c3                   	ret
+
+00801332 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80133a:	89 c2                	mov    %eax,%edx
+  80133c:	c1 ea 16             	shr    $0x16,%edx
+  80133f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801346:	f6 c2 01             	test   $0x1,%dl
+  801349:	74 29                	je     801374 <fd_alloc+0x42>
+  80134b:	89 c2                	mov    %eax,%edx
+  80134d:	c1 ea 0c             	shr    $0xc,%edx
+  801350:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801357:	f6 c2 01             	test   $0x1,%dl
+  80135a:	74 18                	je     801374 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  80135c:	05 00 10 00 00       	add    $0x1000,%eax
+  801361:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801366:	75 d2                	jne    80133a <fd_alloc+0x8>
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80136d:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801372:	eb 05                	jmp    801379 <fd_alloc+0x47>
+			return 0;
+  801374:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137c:	89 02                	mov    %eax,(%edx)
+}
+  80137e:	89 c8                	mov    %ecx,%eax
+  801380:	5d                   	pop    %ebp
+  801381:	c3                   	ret
+
+00801382 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801382:	55                   	push   %ebp
+  801383:	89 e5                	mov    %esp,%ebp
+  801385:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801388:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  80138d:	77 30                	ja     8013bf <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80138f:	c1 e0 0c             	shl    $0xc,%eax
+  801392:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801397:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80139d:	f6 c2 01             	test   $0x1,%dl
+  8013a0:	74 24                	je     8013c6 <fd_lookup+0x44>
+  8013a2:	89 c2                	mov    %eax,%edx
+  8013a4:	c1 ea 0c             	shr    $0xc,%edx
+  8013a7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013ae:	f6 c2 01             	test   $0x1,%dl
+  8013b1:	74 1a                	je     8013cd <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013b6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013bd:	5d                   	pop    %ebp
+  8013be:	c3                   	ret
+		return -E_INVAL;
+  8013bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c4:	eb f7                	jmp    8013bd <fd_lookup+0x3b>
+		return -E_INVAL;
+  8013c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cb:	eb f0                	jmp    8013bd <fd_lookup+0x3b>
+  8013cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013d2:	eb e9                	jmp    8013bd <fd_lookup+0x3b>
+
+008013d4 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	53                   	push   %ebx
+  8013d8:	83 ec 04             	sub    $0x4,%esp
+  8013db:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e3:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8013e8:	39 13                	cmp    %edx,(%ebx)
+  8013ea:	74 54                	je     801440 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8013ec:	83 c0 01             	add    $0x1,%eax
+  8013ef:	8b 1c 85 f4 44 80 00 	mov    0x8044f4(,%eax,4),%ebx
+  8013f6:	85 db                	test   %ebx,%ebx
+  8013f8:	75 ee                	jne    8013e8 <dev_lookup+0x14>
+  8013fa:	89 e1                	mov    %esp,%ecx
+  8013fc:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801401:	29 c8                	sub    %ecx,%eax
+  801403:	89 c1                	mov    %eax,%ecx
+  801405:	c1 e9 0f             	shr    $0xf,%ecx
+  801408:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801412:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801415:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80141c:	8b 40 48             	mov    0x48(%eax),%eax
+  80141f:	83 ec 04             	sub    $0x4,%esp
+  801422:	52                   	push   %edx
+  801423:	50                   	push   %eax
+  801424:	68 78 44 80 00       	push   $0x804478
+  801429:	e8 4f ef ff ff       	call   80037d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801436:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801439:	89 1a                	mov    %ebx,(%edx)
+}
+  80143b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+			return 0;
+  801440:	b8 00 00 00 00       	mov    $0x0,%eax
+  801445:	eb ef                	jmp    801436 <dev_lookup+0x62>
+
+00801447 <fd_close>:
+{
+  801447:	55                   	push   %ebp
+  801448:	89 e5                	mov    %esp,%ebp
+  80144a:	57                   	push   %edi
+  80144b:	56                   	push   %esi
+  80144c:	53                   	push   %ebx
+  80144d:	83 ec 24             	sub    $0x24,%esp
+  801450:	8b 75 08             	mov    0x8(%ebp),%esi
+  801453:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801456:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801459:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80145a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801460:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801463:	50                   	push   %eax
+  801464:	e8 19 ff ff ff       	call   801382 <fd_lookup>
+  801469:	89 c3                	mov    %eax,%ebx
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	78 05                	js     801477 <fd_close+0x30>
+	    || fd != fd2)
+  801472:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801475:	74 0f                	je     801486 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801477:	85 ff                	test   %edi,%edi
+  801479:	0f 44 df             	cmove  %edi,%ebx
+}
+  80147c:	89 d8                	mov    %ebx,%eax
+  80147e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801481:	5b                   	pop    %ebx
+  801482:	5e                   	pop    %esi
+  801483:	5f                   	pop    %edi
+  801484:	5d                   	pop    %ebp
+  801485:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801486:	83 ec 08             	sub    $0x8,%esp
+  801489:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80148c:	50                   	push   %eax
+  80148d:	ff 36                	push   (%esi)
+  80148f:	e8 40 ff ff ff       	call   8013d4 <dev_lookup>
+  801494:	89 c3                	mov    %eax,%ebx
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	78 1a                	js     8014b7 <fd_close+0x70>
+		if (dev->dev_close)
+  80149d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014a0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	74 0b                	je     8014b7 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8014ac:	83 ec 0c             	sub    $0xc,%esp
+  8014af:	56                   	push   %esi
+  8014b0:	ff d0                	call   *%eax
+  8014b2:	89 c3                	mov    %eax,%ebx
+  8014b4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014b7:	83 ec 08             	sub    $0x8,%esp
+  8014ba:	56                   	push   %esi
+  8014bb:	6a 00                	push   $0x0
+  8014bd:	e8 6b fa ff ff       	call   800f2d <sys_page_unmap>
+	return r;
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	eb b5                	jmp    80147c <fd_close+0x35>
+
+008014c7 <close>:
+
+int
+close(int fdnum)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  8014ca:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d0:	50                   	push   %eax
+  8014d1:	ff 75 08             	push   0x8(%ebp)
+  8014d4:	e8 a9 fe ff ff       	call   801382 <fd_lookup>
+  8014d9:	83 c4 10             	add    $0x10,%esp
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	79 02                	jns    8014e2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014e0:	c9                   	leave
+  8014e1:	c3                   	ret
+		return fd_close(fd, 1);
+  8014e2:	83 ec 08             	sub    $0x8,%esp
+  8014e5:	6a 01                	push   $0x1
+  8014e7:	ff 75 f4             	push   -0xc(%ebp)
+  8014ea:	e8 58 ff ff ff       	call   801447 <fd_close>
+  8014ef:	83 c4 10             	add    $0x10,%esp
+  8014f2:	eb ec                	jmp    8014e0 <close+0x19>
+
+008014f4 <close_all>:
+
+void
+close_all(void)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	53                   	push   %ebx
+  8014f8:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	53                   	push   %ebx
+  801504:	e8 be ff ff ff       	call   8014c7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801509:	83 c3 01             	add    $0x1,%ebx
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801515:	75 e9                	jne    801500 <close_all+0xc>
+}
+  801517:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151a:	c9                   	leave
+  80151b:	c3                   	ret
+
+0080151c <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	57                   	push   %edi
+  801520:	56                   	push   %esi
+  801521:	53                   	push   %ebx
+  801522:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801525:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801528:	50                   	push   %eax
+  801529:	ff 75 08             	push   0x8(%ebp)
+  80152c:	e8 51 fe ff ff       	call   801382 <fd_lookup>
+  801531:	89 c3                	mov    %eax,%ebx
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	85 c0                	test   %eax,%eax
+  801538:	78 7f                	js     8015b9 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80153a:	83 ec 0c             	sub    $0xc,%esp
+  80153d:	ff 75 0c             	push   0xc(%ebp)
+  801540:	e8 82 ff ff ff       	call   8014c7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801545:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801548:	c1 e6 0c             	shl    $0xc,%esi
+  80154b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801551:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801554:	89 3c 24             	mov    %edi,(%esp)
+  801557:	e8 bf fd ff ff       	call   80131b <fd2data>
+  80155c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80155e:	89 34 24             	mov    %esi,(%esp)
+  801561:	e8 b5 fd ff ff       	call   80131b <fd2data>
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80156c:	89 d8                	mov    %ebx,%eax
+  80156e:	c1 e8 16             	shr    $0x16,%eax
+  801571:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801578:	a8 01                	test   $0x1,%al
+  80157a:	74 11                	je     80158d <dup+0x71>
+  80157c:	89 d8                	mov    %ebx,%eax
+  80157e:	c1 e8 0c             	shr    $0xc,%eax
+  801581:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801588:	f6 c2 01             	test   $0x1,%dl
+  80158b:	75 36                	jne    8015c3 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80158d:	89 f8                	mov    %edi,%eax
+  80158f:	c1 e8 0c             	shr    $0xc,%eax
+  801592:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801599:	83 ec 0c             	sub    $0xc,%esp
+  80159c:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015a1:	50                   	push   %eax
+  8015a2:	56                   	push   %esi
+  8015a3:	6a 00                	push   $0x0
+  8015a5:	57                   	push   %edi
+  8015a6:	6a 00                	push   $0x0
+  8015a8:	e8 3e f9 ff ff       	call   800eeb <sys_page_map>
+  8015ad:	89 c3                	mov    %eax,%ebx
+  8015af:	83 c4 20             	add    $0x20,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 33                	js     8015e9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015b9:	89 d8                	mov    %ebx,%eax
+  8015bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015be:	5b                   	pop    %ebx
+  8015bf:	5e                   	pop    %esi
+  8015c0:	5f                   	pop    %edi
+  8015c1:	5d                   	pop    %ebp
+  8015c2:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015c3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ca:	83 ec 0c             	sub    $0xc,%esp
+  8015cd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015d2:	50                   	push   %eax
+  8015d3:	ff 75 d4             	push   -0x2c(%ebp)
+  8015d6:	6a 00                	push   $0x0
+  8015d8:	53                   	push   %ebx
+  8015d9:	6a 00                	push   $0x0
+  8015db:	e8 0b f9 ff ff       	call   800eeb <sys_page_map>
+  8015e0:	89 c3                	mov    %eax,%ebx
+  8015e2:	83 c4 20             	add    $0x20,%esp
+  8015e5:	85 c0                	test   %eax,%eax
+  8015e7:	79 a4                	jns    80158d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015e9:	83 ec 08             	sub    $0x8,%esp
+  8015ec:	56                   	push   %esi
+  8015ed:	6a 00                	push   $0x0
+  8015ef:	e8 39 f9 ff ff       	call   800f2d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015f4:	83 c4 08             	add    $0x8,%esp
+  8015f7:	ff 75 d4             	push   -0x2c(%ebp)
+  8015fa:	6a 00                	push   $0x0
+  8015fc:	e8 2c f9 ff ff       	call   800f2d <sys_page_unmap>
+	return r;
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	eb b3                	jmp    8015b9 <dup+0x9d>
+
+00801606 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+  80160b:	83 ec 18             	sub    $0x18,%esp
+  80160e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801611:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801614:	50                   	push   %eax
+  801615:	53                   	push   %ebx
+  801616:	e8 67 fd ff ff       	call   801382 <fd_lookup>
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 3c                	js     80165e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801622:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801625:	83 ec 08             	sub    $0x8,%esp
+  801628:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162b:	50                   	push   %eax
+  80162c:	ff 36                	push   (%esi)
+  80162e:	e8 a1 fd ff ff       	call   8013d4 <dev_lookup>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	78 24                	js     80165e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80163a:	8b 46 08             	mov    0x8(%esi),%eax
+  80163d:	83 e0 03             	and    $0x3,%eax
+  801640:	83 f8 01             	cmp    $0x1,%eax
+  801643:	74 20                	je     801665 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801648:	8b 40 08             	mov    0x8(%eax),%eax
+  80164b:	85 c0                	test   %eax,%eax
+  80164d:	74 54                	je     8016a3 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80164f:	83 ec 04             	sub    $0x4,%esp
+  801652:	ff 75 10             	push   0x10(%ebp)
+  801655:	ff 75 0c             	push   0xc(%ebp)
+  801658:	56                   	push   %esi
+  801659:	ff d0                	call   *%eax
+  80165b:	83 c4 10             	add    $0x10,%esp
+}
+  80165e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801661:	5b                   	pop    %ebx
+  801662:	5e                   	pop    %esi
+  801663:	5d                   	pop    %ebp
+  801664:	c3                   	ret
+  801665:	89 e2                	mov    %esp,%edx
+  801667:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80166c:	29 d0                	sub    %edx,%eax
+  80166e:	89 c2                	mov    %eax,%edx
+  801670:	c1 ea 0f             	shr    $0xf,%edx
+  801673:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167d:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801680:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801687:	8b 40 48             	mov    0x48(%eax),%eax
+  80168a:	83 ec 04             	sub    $0x4,%esp
+  80168d:	53                   	push   %ebx
+  80168e:	50                   	push   %eax
+  80168f:	68 b9 44 80 00       	push   $0x8044b9
+  801694:	e8 e4 ec ff ff       	call   80037d <cprintf>
+		return -E_INVAL;
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a1:	eb bb                	jmp    80165e <read+0x58>
+		return -E_NOT_SUPP;
+  8016a3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a8:	eb b4                	jmp    80165e <read+0x58>
+
+008016aa <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016aa:	55                   	push   %ebp
+  8016ab:	89 e5                	mov    %esp,%ebp
+  8016ad:	57                   	push   %edi
+  8016ae:	56                   	push   %esi
+  8016af:	53                   	push   %ebx
+  8016b0:	83 ec 0c             	sub    $0xc,%esp
+  8016b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8016b6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016b9:	85 f6                	test   %esi,%esi
+  8016bb:	74 30                	je     8016ed <readn+0x43>
+  8016bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c2:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016c7:	83 ec 04             	sub    $0x4,%esp
+  8016ca:	89 f2                	mov    %esi,%edx
+  8016cc:	29 c2                	sub    %eax,%edx
+  8016ce:	52                   	push   %edx
+  8016cf:	01 f8                	add    %edi,%eax
+  8016d1:	50                   	push   %eax
+  8016d2:	ff 75 08             	push   0x8(%ebp)
+  8016d5:	e8 2c ff ff ff       	call   801606 <read>
+		if (m < 0)
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 15                	js     8016f6 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8016e1:	74 11                	je     8016f4 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8016e3:	01 c3                	add    %eax,%ebx
+  8016e5:	89 d8                	mov    %ebx,%eax
+  8016e7:	39 f3                	cmp    %esi,%ebx
+  8016e9:	72 dc                	jb     8016c7 <readn+0x1d>
+  8016eb:	eb 09                	jmp    8016f6 <readn+0x4c>
+  8016ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f2:	eb 02                	jmp    8016f6 <readn+0x4c>
+  8016f4:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8016f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f9:	5b                   	pop    %ebx
+  8016fa:	5e                   	pop    %esi
+  8016fb:	5f                   	pop    %edi
+  8016fc:	5d                   	pop    %ebp
+  8016fd:	c3                   	ret
+
+008016fe <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016fe:	55                   	push   %ebp
+  8016ff:	89 e5                	mov    %esp,%ebp
+  801701:	56                   	push   %esi
+  801702:	53                   	push   %ebx
+  801703:	83 ec 18             	sub    $0x18,%esp
+  801706:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801709:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170c:	50                   	push   %eax
+  80170d:	53                   	push   %ebx
+  80170e:	e8 6f fc ff ff       	call   801382 <fd_lookup>
+  801713:	83 c4 10             	add    $0x10,%esp
+  801716:	85 c0                	test   %eax,%eax
+  801718:	78 37                	js     801751 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80171d:	83 ec 08             	sub    $0x8,%esp
+  801720:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801723:	50                   	push   %eax
+  801724:	ff 36                	push   (%esi)
+  801726:	e8 a9 fc ff ff       	call   8013d4 <dev_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 1f                	js     801751 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801732:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801736:	74 20                	je     801758 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801738:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80173b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	74 54                	je     801796 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801742:	83 ec 04             	sub    $0x4,%esp
+  801745:	ff 75 10             	push   0x10(%ebp)
+  801748:	ff 75 0c             	push   0xc(%ebp)
+  80174b:	56                   	push   %esi
+  80174c:	ff d0                	call   *%eax
+  80174e:	83 c4 10             	add    $0x10,%esp
+}
+  801751:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801754:	5b                   	pop    %ebx
+  801755:	5e                   	pop    %esi
+  801756:	5d                   	pop    %ebp
+  801757:	c3                   	ret
+  801758:	89 e2                	mov    %esp,%edx
+  80175a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80175f:	29 d0                	sub    %edx,%eax
+  801761:	89 c2                	mov    %eax,%edx
+  801763:	c1 ea 0f             	shr    $0xf,%edx
+  801766:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80176b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801770:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801773:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80177a:	8b 40 48             	mov    0x48(%eax),%eax
+  80177d:	83 ec 04             	sub    $0x4,%esp
+  801780:	53                   	push   %ebx
+  801781:	50                   	push   %eax
+  801782:	68 d5 44 80 00       	push   $0x8044d5
+  801787:	e8 f1 eb ff ff       	call   80037d <cprintf>
+		return -E_INVAL;
+  80178c:	83 c4 10             	add    $0x10,%esp
+  80178f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801794:	eb bb                	jmp    801751 <write+0x53>
+		return -E_NOT_SUPP;
+  801796:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80179b:	eb b4                	jmp    801751 <write+0x53>
+
+0080179d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80179d:	55                   	push   %ebp
+  80179e:	89 e5                	mov    %esp,%ebp
+  8017a0:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a6:	50                   	push   %eax
+  8017a7:	ff 75 08             	push   0x8(%ebp)
+  8017aa:	e8 d3 fb ff ff       	call   801382 <fd_lookup>
+  8017af:	83 c4 10             	add    $0x10,%esp
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 0e                	js     8017c4 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017bc:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c4:	c9                   	leave
+  8017c5:	c3                   	ret
+
+008017c6 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	53                   	push   %ebx
+  8017ca:	83 ec 1c             	sub    $0x1c,%esp
+  8017cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d3:	50                   	push   %eax
+  8017d4:	ff 75 08             	push   0x8(%ebp)
+  8017d7:	e8 a6 fb ff ff       	call   801382 <fd_lookup>
+  8017dc:	83 c4 10             	add    $0x10,%esp
+  8017df:	85 c0                	test   %eax,%eax
+  8017e1:	78 33                	js     801816 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8017e3:	83 fb 03             	cmp    $0x3,%ebx
+  8017e6:	74 28                	je     801810 <fcntl+0x4a>
+  8017e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ed:	83 fb 04             	cmp    $0x4,%ebx
+  8017f0:	75 24                	jne    801816 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8017f2:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8017f5:	8b 41 08             	mov    0x8(%ecx),%eax
+  8017f8:	80 e4 ef             	and    $0xef,%ah
+  8017fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8017fe:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  801804:	09 d0                	or     %edx,%eax
+  801806:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180e:	eb 06                	jmp    801816 <fcntl+0x50>
+		return fd->fd_omode;
+  801810:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801813:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801816:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801819:	c9                   	leave
+  80181a:	c3                   	ret
+
+0080181b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80181b:	55                   	push   %ebp
+  80181c:	89 e5                	mov    %esp,%ebp
+  80181e:	56                   	push   %esi
+  80181f:	53                   	push   %ebx
+  801820:	83 ec 18             	sub    $0x18,%esp
+  801823:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801826:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801829:	50                   	push   %eax
+  80182a:	53                   	push   %ebx
+  80182b:	e8 52 fb ff ff       	call   801382 <fd_lookup>
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	85 c0                	test   %eax,%eax
+  801835:	78 34                	js     80186b <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801837:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80183a:	83 ec 08             	sub    $0x8,%esp
+  80183d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801840:	50                   	push   %eax
+  801841:	ff 36                	push   (%esi)
+  801843:	e8 8c fb ff ff       	call   8013d4 <dev_lookup>
+  801848:	83 c4 10             	add    $0x10,%esp
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 1c                	js     80186b <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80184f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801853:	74 1d                	je     801872 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801855:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801858:	8b 40 18             	mov    0x18(%eax),%eax
+  80185b:	85 c0                	test   %eax,%eax
+  80185d:	74 51                	je     8018b0 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80185f:	83 ec 08             	sub    $0x8,%esp
+  801862:	ff 75 0c             	push   0xc(%ebp)
+  801865:	56                   	push   %esi
+  801866:	ff d0                	call   *%eax
+  801868:	83 c4 10             	add    $0x10,%esp
+}
+  80186b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186e:	5b                   	pop    %ebx
+  80186f:	5e                   	pop    %esi
+  801870:	5d                   	pop    %ebp
+  801871:	c3                   	ret
+  801872:	89 e2                	mov    %esp,%edx
+  801874:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801879:	29 d0                	sub    %edx,%eax
+  80187b:	89 c2                	mov    %eax,%edx
+  80187d:	c1 ea 0f             	shr    $0xf,%edx
+  801880:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188a:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80188d:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  801894:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801897:	83 ec 04             	sub    $0x4,%esp
+  80189a:	53                   	push   %ebx
+  80189b:	50                   	push   %eax
+  80189c:	68 98 44 80 00       	push   $0x804498
+  8018a1:	e8 d7 ea ff ff       	call   80037d <cprintf>
+		return -E_INVAL;
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ae:	eb bb                	jmp    80186b <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8018b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b5:	eb b4                	jmp    80186b <ftruncate+0x50>
+
+008018b7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	56                   	push   %esi
+  8018bb:	53                   	push   %ebx
+  8018bc:	83 ec 18             	sub    $0x18,%esp
+  8018bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c5:	50                   	push   %eax
+  8018c6:	ff 75 08             	push   0x8(%ebp)
+  8018c9:	e8 b4 fa ff ff       	call   801382 <fd_lookup>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	78 53                	js     801928 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018de:	50                   	push   %eax
+  8018df:	ff 36                	push   (%esi)
+  8018e1:	e8 ee fa ff ff       	call   8013d4 <dev_lookup>
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 3b                	js     801928 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8018ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018f4:	74 39                	je     80192f <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018f6:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018f9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801900:	00 00 00 
+	stat->st_isdir = 0;
+  801903:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80190a:	00 00 00 
+	stat->st_version = 0;
+  80190d:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  801914:	00 00 00 
+	stat->st_dev = dev;
+  801917:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80191d:	83 ec 08             	sub    $0x8,%esp
+  801920:	53                   	push   %ebx
+  801921:	56                   	push   %esi
+  801922:	ff 50 14             	call   *0x14(%eax)
+  801925:	83 c4 10             	add    $0x10,%esp
+}
+  801928:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192b:	5b                   	pop    %ebx
+  80192c:	5e                   	pop    %esi
+  80192d:	5d                   	pop    %ebp
+  80192e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80192f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801934:	eb f2                	jmp    801928 <fstat+0x71>
+
+00801936 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	56                   	push   %esi
+  80193a:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80193b:	83 ec 08             	sub    $0x8,%esp
+  80193e:	6a 00                	push   $0x0
+  801940:	ff 75 08             	push   0x8(%ebp)
+  801943:	e8 b7 01 00 00       	call   801aff <open>
+  801948:	89 c3                	mov    %eax,%ebx
+  80194a:	83 c4 10             	add    $0x10,%esp
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	78 1b                	js     80196c <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	ff 75 0c             	push   0xc(%ebp)
+  801957:	50                   	push   %eax
+  801958:	e8 5a ff ff ff       	call   8018b7 <fstat>
+  80195d:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80195f:	89 1c 24             	mov    %ebx,(%esp)
+  801962:	e8 60 fb ff ff       	call   8014c7 <close>
+	return r;
+  801967:	83 c4 10             	add    $0x10,%esp
+  80196a:	89 f3                	mov    %esi,%ebx
+}
+  80196c:	89 d8                	mov    %ebx,%eax
+  80196e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801971:	5b                   	pop    %ebx
+  801972:	5e                   	pop    %esi
+  801973:	5d                   	pop    %ebp
+  801974:	c3                   	ret
+
+00801975 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801975:	55                   	push   %ebp
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	56                   	push   %esi
+  801979:	53                   	push   %ebx
+  80197a:	89 c6                	mov    %eax,%esi
+  80197c:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80197e:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801985:	74 27                	je     8019ae <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801987:	6a 07                	push   $0x7
+  801989:	68 00 70 80 00       	push   $0x807000
+  80198e:	56                   	push   %esi
+  80198f:	ff 35 00 60 80 00    	push   0x806000
+  801995:	e8 d9 1f 00 00       	call   803973 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  80199a:	83 c4 0c             	add    $0xc,%esp
+  80199d:	6a 00                	push   $0x0
+  80199f:	53                   	push   %ebx
+  8019a0:	6a 00                	push   $0x0
+  8019a2:	e8 3c 1d 00 00       	call   8036e3 <ipc_recv>
+}
+  8019a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019aa:	5b                   	pop    %ebx
+  8019ab:	5e                   	pop    %esi
+  8019ac:	5d                   	pop    %ebp
+  8019ad:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8019ae:	83 ec 0c             	sub    $0xc,%esp
+  8019b1:	6a 02                	push   $0x2
+  8019b3:	e8 24 20 00 00       	call   8039dc <ipc_find_env>
+  8019b8:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019bd:	83 c4 10             	add    $0x10,%esp
+  8019c0:	eb c5                	jmp    801987 <fsipc+0x12>
+
+008019c2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019c2:	55                   	push   %ebp
+  8019c3:	89 e5                	mov    %esp,%ebp
+  8019c5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019cb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ce:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8019d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d6:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019e5:	e8 8b ff ff ff       	call   801975 <fsipc>
+}
+  8019ea:	c9                   	leave
+  8019eb:	c3                   	ret
+
+008019ec <devfile_flush>:
+{
+  8019ec:	55                   	push   %ebp
+  8019ed:	89 e5                	mov    %esp,%ebp
+  8019ef:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f8:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a02:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a07:	e8 69 ff ff ff       	call   801975 <fsipc>
+}
+  801a0c:	c9                   	leave
+  801a0d:	c3                   	ret
+
+00801a0e <devfile_stat>:
+{
+  801a0e:	55                   	push   %ebp
+  801a0f:	89 e5                	mov    %esp,%ebp
+  801a11:	53                   	push   %ebx
+  801a12:	83 ec 04             	sub    $0x4,%esp
+  801a15:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a1e:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a28:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a2d:	e8 43 ff ff ff       	call   801975 <fsipc>
+  801a32:	85 c0                	test   %eax,%eax
+  801a34:	78 37                	js     801a6d <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a36:	83 ec 08             	sub    $0x8,%esp
+  801a39:	68 00 70 80 00       	push   $0x807000
+  801a3e:	53                   	push   %ebx
+  801a3f:	e8 30 f0 ff ff       	call   800a74 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a44:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a49:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a4f:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a54:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801a5a:	a1 88 70 80 00       	mov    0x807088,%eax
+  801a5f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a70:	c9                   	leave
+  801a71:	c3                   	ret
+
+00801a72 <devfile_write>:
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	83 ec 0c             	sub    $0xc,%esp
+  801a78:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a7b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a80:	39 d0                	cmp    %edx,%eax
+  801a82:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a85:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a88:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a8b:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a91:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a96:	50                   	push   %eax
+  801a97:	ff 75 0c             	push   0xc(%ebp)
+  801a9a:	68 08 70 80 00       	push   $0x807008
+  801a9f:	e8 80 f1 ff ff       	call   800c24 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801aa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801aae:	e8 c2 fe ff ff       	call   801975 <fsipc>
+}
+  801ab3:	c9                   	leave
+  801ab4:	c3                   	ret
+
+00801ab5 <devfile_read>:
+{
+  801ab5:	55                   	push   %ebp
+  801ab6:	89 e5                	mov    %esp,%ebp
+  801ab8:	53                   	push   %ebx
+  801ab9:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ac7:	8b 45 10             	mov    0x10(%ebp),%eax
+  801aca:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801acf:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801ad4:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ad9:	e8 97 fe ff ff       	call   801975 <fsipc>
+  801ade:	89 c3                	mov    %eax,%ebx
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 14                	js     801af8 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801ae4:	83 ec 04             	sub    $0x4,%esp
+  801ae7:	50                   	push   %eax
+  801ae8:	68 00 70 80 00       	push   $0x807000
+  801aed:	ff 75 0c             	push   0xc(%ebp)
+  801af0:	e8 2f f1 ff ff       	call   800c24 <memmove>
+	return r;
+  801af5:	83 c4 10             	add    $0x10,%esp
+}
+  801af8:	89 d8                	mov    %ebx,%eax
+  801afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+
+00801aff <open>:
+{
+  801aff:	55                   	push   %ebp
+  801b00:	89 e5                	mov    %esp,%ebp
+  801b02:	53                   	push   %ebx
+  801b03:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801b06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b09:	50                   	push   %eax
+  801b0a:	e8 23 f8 ff ff       	call   801332 <fd_alloc>
+  801b0f:	89 c3                	mov    %eax,%ebx
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 2a                	js     801b42 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	ff 75 08             	push   0x8(%ebp)
+  801b1e:	e8 05 ef ff ff       	call   800a28 <strlen>
+  801b23:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801b26:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801b2b:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b30:	7e 17                	jle    801b49 <open+0x4a>
+	fd_close(fd, 1);
+  801b32:	83 ec 08             	sub    $0x8,%esp
+  801b35:	6a 01                	push   $0x1
+  801b37:	ff 75 f4             	push   -0xc(%ebp)
+  801b3a:	e8 08 f9 ff ff       	call   801447 <fd_close>
+	return r;
+  801b3f:	83 c4 10             	add    $0x10,%esp
+}
+  801b42:	89 d8                	mov    %ebx,%eax
+  801b44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801b49:	83 ec 08             	sub    $0x8,%esp
+  801b4c:	ff 75 08             	push   0x8(%ebp)
+  801b4f:	68 00 70 80 00       	push   $0x807000
+  801b54:	e8 1b ef ff ff       	call   800a74 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b5c:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801b61:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b64:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b69:	e8 07 fe ff ff       	call   801975 <fsipc>
+  801b6e:	89 c3                	mov    %eax,%ebx
+  801b70:	83 c4 10             	add    $0x10,%esp
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	78 bb                	js     801b32 <open+0x33>
+	return fd2num(fd); 	
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	ff 75 f4             	push   -0xc(%ebp)
+  801b7d:	e8 89 f7 ff ff       	call   80130b <fd2num>
+  801b82:	89 c3                	mov    %eax,%ebx
+  801b84:	83 c4 10             	add    $0x10,%esp
+  801b87:	eb b9                	jmp    801b42 <open+0x43>
+
+00801b89 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b89:	55                   	push   %ebp
+  801b8a:	89 e5                	mov    %esp,%ebp
+  801b8c:	53                   	push   %ebx
+  801b8d:	83 ec 1c             	sub    $0x1c,%esp
+  801b90:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b96:	50                   	push   %eax
+  801b97:	ff 75 08             	push   0x8(%ebp)
+  801b9a:	e8 e3 f7 ff ff       	call   801382 <fd_lookup>
+  801b9f:	83 c4 10             	add    $0x10,%esp
+  801ba2:	85 c0                	test   %eax,%eax
+  801ba4:	78 5a                	js     801c00 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801ba6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba9:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801baf:	39 10                	cmp    %edx,(%eax)
+  801bb1:	75 66                	jne    801c19 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801bb3:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801bba:	74 49                	je     801c05 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801bbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc2:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bca:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801bcf:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bd5:	6a 07                	push   $0x7
+  801bd7:	68 00 70 80 00       	push   $0x807000
+  801bdc:	6a 09                	push   $0x9
+  801bde:	ff 35 00 60 80 00    	push   0x806000
+  801be4:	e8 8a 1d 00 00       	call   803973 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801be9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801bf0:	6a 00                	push   $0x0
+  801bf2:	53                   	push   %ebx
+  801bf3:	ff 75 10             	push   0x10(%ebp)
+  801bf6:	6a 00                	push   $0x0
+  801bf8:	e8 b3 1b 00 00       	call   8037b0 <ipc_recv_pages>
+  801bfd:	83 c4 20             	add    $0x20,%esp
+}
+  801c00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c03:	c9                   	leave
+  801c04:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c05:	83 ec 0c             	sub    $0xc,%esp
+  801c08:	6a 02                	push   $0x2
+  801c0a:	e8 cd 1d 00 00       	call   8039dc <ipc_find_env>
+  801c0f:	a3 00 60 80 00       	mov    %eax,0x806000
+  801c14:	83 c4 10             	add    $0x10,%esp
+  801c17:	eb a3                	jmp    801bbc <fmap+0x33>
+		return -E_INVAL;
+  801c19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c1e:	eb e0                	jmp    801c00 <fmap+0x77>
+
+00801c20 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c20:	55                   	push   %ebp
+  801c21:	89 e5                	mov    %esp,%ebp
+  801c23:	53                   	push   %ebx
+  801c24:	83 ec 10             	sub    $0x10,%esp
+  801c27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c2a:	53                   	push   %ebx
+  801c2b:	e8 f8 ed ff ff       	call   800a28 <strlen>
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c38:	7f 25                	jg     801c5f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+  801c3d:	53                   	push   %ebx
+  801c3e:	68 00 70 80 00       	push   $0x807000
+  801c43:	e8 2c ee ff ff       	call   800a74 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c52:	e8 1e fd ff ff       	call   801975 <fsipc>
+  801c57:	83 c4 10             	add    $0x10,%esp
+}
+  801c5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c5d:	c9                   	leave
+  801c5e:	c3                   	ret
+		return -E_BAD_PATH;
+  801c5f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c64:	eb f4                	jmp    801c5a <remove+0x3a>
+
+00801c66 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c66:	55                   	push   %ebp
+  801c67:	89 e5                	mov    %esp,%ebp
+  801c69:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c71:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c76:	e8 fa fc ff ff       	call   801975 <fsipc>
+}
+  801c7b:	c9                   	leave
+  801c7c:	c3                   	ret
+
+00801c7d <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c83:	68 08 45 80 00       	push   $0x804508
+  801c88:	ff 75 0c             	push   0xc(%ebp)
+  801c8b:	e8 e4 ed ff ff       	call   800a74 <strcpy>
+	return 0;
+}
+  801c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c95:	c9                   	leave
+  801c96:	c3                   	ret
+
+00801c97 <devsock_close>:
+{
+  801c97:	55                   	push   %ebp
+  801c98:	89 e5                	mov    %esp,%ebp
+  801c9a:	53                   	push   %ebx
+  801c9b:	83 ec 10             	sub    $0x10,%esp
+  801c9e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801ca1:	53                   	push   %ebx
+  801ca2:	e8 74 1d 00 00       	call   803a1b <pageref>
+  801ca7:	89 c2                	mov    %eax,%edx
+  801ca9:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801cac:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801cb1:	83 fa 01             	cmp    $0x1,%edx
+  801cb4:	74 05                	je     801cbb <devsock_close+0x24>
+}
+  801cb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cb9:	c9                   	leave
+  801cba:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801cbb:	83 ec 0c             	sub    $0xc,%esp
+  801cbe:	ff 73 0c             	push   0xc(%ebx)
+  801cc1:	e8 b0 05 00 00       	call   802276 <nsipc_close>
+  801cc6:	83 c4 10             	add    $0x10,%esp
+  801cc9:	eb eb                	jmp    801cb6 <devsock_close+0x1f>
+
+00801ccb <devsock_write>:
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	53                   	push   %ebx
+  801ccf:	83 ec 14             	sub    $0x14,%esp
+  801cd2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cd5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cd8:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801cdb:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801cde:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ce1:	8b 41 08             	mov    0x8(%ecx),%eax
+  801ce4:	c1 f8 09             	sar    $0x9,%eax
+  801ce7:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801cea:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801cf0:	77 13                	ja     801d05 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801cf2:	50                   	push   %eax
+  801cf3:	52                   	push   %edx
+  801cf4:	53                   	push   %ebx
+  801cf5:	ff 71 0c             	push   0xc(%ecx)
+  801cf8:	e8 5c 06 00 00       	call   802359 <nsipc_send>
+  801cfd:	83 c4 10             	add    $0x10,%esp
+}
+  801d00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d03:	c9                   	leave
+  801d04:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d05:	50                   	push   %eax
+  801d06:	6a 01                	push   $0x1
+  801d08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d0b:	50                   	push   %eax
+  801d0c:	ff 71 0c             	push   0xc(%ecx)
+  801d0f:	e8 a6 06 00 00       	call   8023ba <nsipc_sendmsg>
+  801d14:	83 c4 10             	add    $0x10,%esp
+  801d17:	eb e7                	jmp    801d00 <devsock_write+0x35>
+
+00801d19 <devsock_read>:
+{
+  801d19:	55                   	push   %ebp
+  801d1a:	89 e5                	mov    %esp,%ebp
+  801d1c:	53                   	push   %ebx
+  801d1d:	83 ec 14             	sub    $0x14,%esp
+  801d20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d23:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d26:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801d29:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d2c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d2f:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d32:	c1 f8 09             	sar    $0x9,%eax
+  801d35:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d38:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d3e:	77 13                	ja     801d53 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801d40:	50                   	push   %eax
+  801d41:	52                   	push   %edx
+  801d42:	53                   	push   %ebx
+  801d43:	ff 71 0c             	push   0xc(%ecx)
+  801d46:	e8 9c 05 00 00       	call   8022e7 <nsipc_recv>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+}
+  801d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d53:	50                   	push   %eax
+  801d54:	6a 01                	push   $0x1
+  801d56:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d59:	50                   	push   %eax
+  801d5a:	ff 71 0c             	push   0xc(%ecx)
+  801d5d:	e8 02 0a 00 00       	call   802764 <nsipc_recvmsg>
+  801d62:	83 c4 10             	add    $0x10,%esp
+  801d65:	eb e7                	jmp    801d4e <devsock_read+0x35>
+
+00801d67 <fd2sockid>:
+{
+  801d67:	55                   	push   %ebp
+  801d68:	89 e5                	mov    %esp,%ebp
+  801d6a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d6d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d70:	52                   	push   %edx
+  801d71:	50                   	push   %eax
+  801d72:	e8 0b f6 ff ff       	call   801382 <fd_lookup>
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 10                	js     801d8e <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d81:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801d87:	39 08                	cmp    %ecx,(%eax)
+  801d89:	75 05                	jne    801d90 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d8b:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d90:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d95:	eb f7                	jmp    801d8e <fd2sockid+0x27>
+
+00801d97 <sock_flags>:
+{
+  801d97:	55                   	push   %ebp
+  801d98:	89 e5                	mov    %esp,%ebp
+  801d9a:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801d9d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801da0:	52                   	push   %edx
+  801da1:	50                   	push   %eax
+  801da2:	e8 db f5 ff ff       	call   801382 <fd_lookup>
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 0e                	js     801dbc <sock_flags+0x25>
+  801dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801db1:	8b 40 08             	mov    0x8(%eax),%eax
+  801db4:	c1 e8 09             	shr    $0x9,%eax
+  801db7:	83 e0 08             	and    $0x8,%eax
+}
+  801dba:	c9                   	leave
+  801dbb:	c3                   	ret
+		return 0;
+  801dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc1:	eb f7                	jmp    801dba <sock_flags+0x23>
+
+00801dc3 <alloc_sockfd>:
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+  801dc8:	83 ec 1c             	sub    $0x1c,%esp
+  801dcb:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801dcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dd0:	50                   	push   %eax
+  801dd1:	e8 5c f5 ff ff       	call   801332 <fd_alloc>
+  801dd6:	89 c3                	mov    %eax,%ebx
+  801dd8:	83 c4 10             	add    $0x10,%esp
+  801ddb:	85 c0                	test   %eax,%eax
+  801ddd:	78 43                	js     801e22 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801ddf:	83 ec 04             	sub    $0x4,%esp
+  801de2:	68 07 04 00 00       	push   $0x407
+  801de7:	ff 75 f4             	push   -0xc(%ebp)
+  801dea:	6a 00                	push   $0x0
+  801dec:	e8 b7 f0 ff ff       	call   800ea8 <sys_page_alloc>
+  801df1:	89 c3                	mov    %eax,%ebx
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 28                	js     801e22 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801dfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dfd:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801e03:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801e05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e08:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801e0f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801e12:	83 ec 0c             	sub    $0xc,%esp
+  801e15:	50                   	push   %eax
+  801e16:	e8 f0 f4 ff ff       	call   80130b <fd2num>
+  801e1b:	89 c3                	mov    %eax,%ebx
+  801e1d:	83 c4 10             	add    $0x10,%esp
+  801e20:	eb 0c                	jmp    801e2e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e22:	83 ec 0c             	sub    $0xc,%esp
+  801e25:	56                   	push   %esi
+  801e26:	e8 4b 04 00 00       	call   802276 <nsipc_close>
+		return r;
+  801e2b:	83 c4 10             	add    $0x10,%esp
+}
+  801e2e:	89 d8                	mov    %ebx,%eax
+  801e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e33:	5b                   	pop    %ebx
+  801e34:	5e                   	pop    %esi
+  801e35:	5d                   	pop    %ebp
+  801e36:	c3                   	ret
+
+00801e37 <accept>:
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	56                   	push   %esi
+  801e3b:	53                   	push   %ebx
+  801e3c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e3f:	89 f0                	mov    %esi,%eax
+  801e41:	e8 21 ff ff ff       	call   801d67 <fd2sockid>
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	78 24                	js     801e70 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801e4c:	89 f0                	mov    %esi,%eax
+  801e4e:	e8 44 ff ff ff       	call   801d97 <sock_flags>
+  801e53:	50                   	push   %eax
+  801e54:	ff 75 10             	push   0x10(%ebp)
+  801e57:	ff 75 0c             	push   0xc(%ebp)
+  801e5a:	53                   	push   %ebx
+  801e5b:	e8 6b 03 00 00       	call   8021cb <nsipc_accept>
+  801e60:	89 c3                	mov    %eax,%ebx
+  801e62:	83 c4 10             	add    $0x10,%esp
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 07                	js     801e70 <accept+0x39>
+	return alloc_sockfd(r);
+  801e69:	e8 55 ff ff ff       	call   801dc3 <alloc_sockfd>
+  801e6e:	89 c3                	mov    %eax,%ebx
+}
+  801e70:	89 d8                	mov    %ebx,%eax
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+
+00801e79 <bind>:
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e82:	e8 e0 fe ff ff       	call   801d67 <fd2sockid>
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 12                	js     801e9d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e8b:	83 ec 04             	sub    $0x4,%esp
+  801e8e:	ff 75 10             	push   0x10(%ebp)
+  801e91:	ff 75 0c             	push   0xc(%ebp)
+  801e94:	50                   	push   %eax
+  801e95:	e8 85 03 00 00       	call   80221f <nsipc_bind>
+  801e9a:	83 c4 10             	add    $0x10,%esp
+}
+  801e9d:	c9                   	leave
+  801e9e:	c3                   	ret
+
+00801e9f <shutdown>:
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea8:	e8 ba fe ff ff       	call   801d67 <fd2sockid>
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	78 0f                	js     801ec0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801eb1:	83 ec 08             	sub    $0x8,%esp
+  801eb4:	ff 75 0c             	push   0xc(%ebp)
+  801eb7:	50                   	push   %eax
+  801eb8:	e8 97 03 00 00       	call   802254 <nsipc_shutdown>
+  801ebd:	83 c4 10             	add    $0x10,%esp
+}
+  801ec0:	c9                   	leave
+  801ec1:	c3                   	ret
+
+00801ec2 <connect>:
+{
+  801ec2:	55                   	push   %ebp
+  801ec3:	89 e5                	mov    %esp,%ebp
+  801ec5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ec8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ecb:	e8 97 fe ff ff       	call   801d67 <fd2sockid>
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 12                	js     801ee6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ed4:	83 ec 04             	sub    $0x4,%esp
+  801ed7:	ff 75 10             	push   0x10(%ebp)
+  801eda:	ff 75 0c             	push   0xc(%ebp)
+  801edd:	50                   	push   %eax
+  801ede:	e8 ad 03 00 00       	call   802290 <nsipc_connect>
+  801ee3:	83 c4 10             	add    $0x10,%esp
+}
+  801ee6:	c9                   	leave
+  801ee7:	c3                   	ret
+
+00801ee8 <listen>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801eee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef1:	e8 71 fe ff ff       	call   801d67 <fd2sockid>
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 0f                	js     801f09 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801efa:	83 ec 08             	sub    $0x8,%esp
+  801efd:	ff 75 0c             	push   0xc(%ebp)
+  801f00:	50                   	push   %eax
+  801f01:	e8 bf 03 00 00       	call   8022c5 <nsipc_listen>
+  801f06:	83 c4 10             	add    $0x10,%esp
+}
+  801f09:	c9                   	leave
+  801f0a:	c3                   	ret
+
+00801f0b <sendmsg>:
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	57                   	push   %edi
+  801f0f:	56                   	push   %esi
+  801f10:	53                   	push   %ebx
+  801f11:	83 ec 0c             	sub    $0xc,%esp
+  801f14:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f17:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801f1a:	89 f0                	mov    %esi,%eax
+  801f1c:	e8 46 fe ff ff       	call   801d67 <fd2sockid>
+  801f21:	89 c3                	mov    %eax,%ebx
+  801f23:	85 c0                	test   %eax,%eax
+  801f25:	78 1c                	js     801f43 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801f27:	89 f0                	mov    %esi,%eax
+  801f29:	e8 69 fe ff ff       	call   801d97 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f2e:	0b 45 10             	or     0x10(%ebp),%eax
+  801f31:	50                   	push   %eax
+  801f32:	ff 77 0c             	push   0xc(%edi)
+  801f35:	ff 77 08             	push   0x8(%edi)
+  801f38:	53                   	push   %ebx
+  801f39:	e8 7c 04 00 00       	call   8023ba <nsipc_sendmsg>
+  801f3e:	89 c3                	mov    %eax,%ebx
+  801f40:	83 c4 10             	add    $0x10,%esp
+}
+  801f43:	89 d8                	mov    %ebx,%eax
+  801f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f48:	5b                   	pop    %ebx
+  801f49:	5e                   	pop    %esi
+  801f4a:	5f                   	pop    %edi
+  801f4b:	5d                   	pop    %ebp
+  801f4c:	c3                   	ret
+
+00801f4d <recvmsg>:
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	57                   	push   %edi
+  801f51:	56                   	push   %esi
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 0c             	sub    $0xc,%esp
+  801f56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f59:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f5c:	89 f8                	mov    %edi,%eax
+  801f5e:	e8 04 fe ff ff       	call   801d67 <fd2sockid>
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 2a                	js     801f93 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801f69:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801f70:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801f77:	89 f8                	mov    %edi,%eax
+  801f79:	e8 19 fe ff ff       	call   801d97 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f7e:	0b 45 10             	or     0x10(%ebp),%eax
+  801f81:	50                   	push   %eax
+  801f82:	ff 76 0c             	push   0xc(%esi)
+  801f85:	ff 76 08             	push   0x8(%esi)
+  801f88:	53                   	push   %ebx
+  801f89:	e8 d6 07 00 00       	call   802764 <nsipc_recvmsg>
+  801f8e:	89 c3                	mov    %eax,%ebx
+  801f90:	83 c4 10             	add    $0x10,%esp
+}
+  801f93:	89 d8                	mov    %ebx,%eax
+  801f95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f98:	5b                   	pop    %ebx
+  801f99:	5e                   	pop    %esi
+  801f9a:	5f                   	pop    %edi
+  801f9b:	5d                   	pop    %ebp
+  801f9c:	c3                   	ret
+
+00801f9d <sendfile>:
+{
+  801f9d:	55                   	push   %ebp
+  801f9e:	89 e5                	mov    %esp,%ebp
+  801fa0:	56                   	push   %esi
+  801fa1:	53                   	push   %ebx
+  801fa2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801fa5:	89 f0                	mov    %esi,%eax
+  801fa7:	e8 bb fd ff ff       	call   801d67 <fd2sockid>
+  801fac:	89 c3                	mov    %eax,%ebx
+  801fae:	85 c0                	test   %eax,%eax
+  801fb0:	78 1f                	js     801fd1 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801fb2:	89 f0                	mov    %esi,%eax
+  801fb4:	e8 de fd ff ff       	call   801d97 <sock_flags>
+  801fb9:	83 ec 0c             	sub    $0xc,%esp
+  801fbc:	50                   	push   %eax
+  801fbd:	ff 75 14             	push   0x14(%ebp)
+  801fc0:	ff 75 10             	push   0x10(%ebp)
+  801fc3:	ff 75 0c             	push   0xc(%ebp)
+  801fc6:	53                   	push   %ebx
+  801fc7:	e8 64 06 00 00       	call   802630 <nsipc_sendfile>
+  801fcc:	89 c3                	mov    %eax,%ebx
+  801fce:	83 c4 20             	add    $0x20,%esp
+}
+  801fd1:	89 d8                	mov    %ebx,%eax
+  801fd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd6:	5b                   	pop    %ebx
+  801fd7:	5e                   	pop    %esi
+  801fd8:	5d                   	pop    %ebp
+  801fd9:	c3                   	ret
+
+00801fda <evctl>:
+{
+  801fda:	55                   	push   %ebp
+  801fdb:	89 e5                	mov    %esp,%ebp
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 04             	sub    $0x4,%esp
+  801fe1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801fe4:	89 d8                	mov    %ebx,%eax
+  801fe6:	e8 7c fd ff ff       	call   801d67 <fd2sockid>
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	78 10                	js     801fff <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801fef:	83 ec 04             	sub    $0x4,%esp
+  801ff2:	53                   	push   %ebx
+  801ff3:	ff 75 0c             	push   0xc(%ebp)
+  801ff6:	50                   	push   %eax
+  801ff7:	e8 d2 0b 00 00       	call   802bce <nsipc_evctl>
+  801ffc:	83 c4 10             	add    $0x10,%esp
+}
+  801fff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802002:	c9                   	leave
+  802003:	c3                   	ret
+
+00802004 <evwait>:
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  80200a:	ff 75 10             	push   0x10(%ebp)
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	ff 75 08             	push   0x8(%ebp)
+  802013:	e8 e0 0b 00 00       	call   802bf8 <nsipc_evwait>
+}
+  802018:	c9                   	leave
+  802019:	c3                   	ret
+
+0080201a <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802020:	ff 75 10             	push   0x10(%ebp)
+  802023:	ff 75 0c             	push   0xc(%ebp)
+  802026:	ff 75 08             	push   0x8(%ebp)
+  802029:	e8 31 0c 00 00       	call   802c5f <nsipc_socket>
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	85 c0                	test   %eax,%eax
+  802033:	78 05                	js     80203a <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802035:	e8 89 fd ff ff       	call   801dc3 <alloc_sockfd>
+}
+  80203a:	c9                   	leave
+  80203b:	c3                   	ret
+
+0080203c <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80203c:	55                   	push   %ebp
+  80203d:	89 e5                	mov    %esp,%ebp
+  80203f:	53                   	push   %ebx
+  802040:	83 ec 04             	sub    $0x4,%esp
+  802043:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802045:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80204c:	74 26                	je     802074 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80204e:	6a 07                	push   $0x7
+  802050:	68 00 80 80 00       	push   $0x808000
+  802055:	53                   	push   %ebx
+  802056:	ff 35 24 63 80 00    	push   0x806324
+  80205c:	e8 12 19 00 00       	call   803973 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802061:	83 c4 0c             	add    $0xc,%esp
+  802064:	6a 00                	push   $0x0
+  802066:	6a 00                	push   $0x0
+  802068:	6a 00                	push   $0x0
+  80206a:	e8 74 16 00 00       	call   8036e3 <ipc_recv>
+}
+  80206f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802072:	c9                   	leave
+  802073:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802074:	83 ec 0c             	sub    $0xc,%esp
+  802077:	6a 03                	push   $0x3
+  802079:	e8 5e 19 00 00       	call   8039dc <ipc_find_env>
+  80207e:	a3 24 63 80 00       	mov    %eax,0x806324
+  802083:	83 c4 10             	add    $0x10,%esp
+  802086:	eb c6                	jmp    80204e <nsipc+0x12>
+
+00802088 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	56                   	push   %esi
+  80208c:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80208d:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  802093:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802098:	85 f6                	test   %esi,%esi
+  80209a:	75 33                	jne    8020cf <nsbulk_map+0x47>
+  80209c:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  8020a1:	83 ec 04             	sub    $0x4,%esp
+  8020a4:	6a 07                	push   $0x7
+  8020a6:	53                   	push   %ebx
+  8020a7:	6a 00                	push   $0x0
+  8020a9:	e8 fa ed ff ff       	call   800ea8 <sys_page_alloc>
+  8020ae:	83 c4 10             	add    $0x10,%esp
+  8020b1:	85 c0                	test   %eax,%eax
+  8020b3:	78 1a                	js     8020cf <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  8020b5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020bb:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8020c1:	75 de                	jne    8020a1 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8020c3:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8020ca:	00 00 00 
+	return 0;
+  8020cd:	89 f0                	mov    %esi,%eax
+}
+  8020cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020d2:	5b                   	pop    %ebx
+  8020d3:	5e                   	pop    %esi
+  8020d4:	5d                   	pop    %ebp
+  8020d5:	c3                   	ret
+
+008020d6 <nsbulk_own>:
+{
+  8020d6:	55                   	push   %ebp
+  8020d7:	89 e5                	mov    %esp,%ebp
+  8020d9:	57                   	push   %edi
+  8020da:	56                   	push   %esi
+  8020db:	53                   	push   %ebx
+  8020dc:	83 ec 0c             	sub    $0xc,%esp
+  8020df:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8020e1:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8020e4:	85 d2                	test   %edx,%edx
+  8020e6:	7f 0e                	jg     8020f6 <nsbulk_own+0x20>
+	return 0;
+  8020e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ed:	eb 47                	jmp    802136 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8020ef:	83 c3 01             	add    $0x1,%ebx
+  8020f2:	39 fb                	cmp    %edi,%ebx
+  8020f4:	7d 3b                	jge    802131 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8020f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8020fb:	89 d9                	mov    %ebx,%ecx
+  8020fd:	d3 e6                	shl    %cl,%esi
+  8020ff:	89 f0                	mov    %esi,%eax
+  802101:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802107:	74 e6                	je     8020ef <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802109:	83 ec 04             	sub    $0x4,%esp
+  80210c:	6a 07                	push   $0x7
+  80210e:	89 d8                	mov    %ebx,%eax
+  802110:	c1 e0 0c             	shl    $0xc,%eax
+  802113:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802118:	50                   	push   %eax
+  802119:	6a 00                	push   $0x0
+  80211b:	e8 88 ed ff ff       	call   800ea8 <sys_page_alloc>
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	85 c0                	test   %eax,%eax
+  802125:	78 0f                	js     802136 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802127:	f7 d6                	not    %esi
+  802129:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80212f:	eb be                	jmp    8020ef <nsbulk_own+0x19>
+	return 0;
+  802131:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802139:	5b                   	pop    %ebx
+  80213a:	5e                   	pop    %esi
+  80213b:	5f                   	pop    %edi
+  80213c:	5d                   	pop    %ebp
+  80213d:	c3                   	ret
+
+0080213e <nsipc_bulk>:
+{
+  80213e:	55                   	push   %ebp
+  80213f:	89 e5                	mov    %esp,%ebp
+  802141:	57                   	push   %edi
+  802142:	56                   	push   %esi
+  802143:	53                   	push   %ebx
+  802144:	83 ec 1c             	sub    $0x1c,%esp
+  802147:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80214a:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  80214c:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802152:	c1 fb 0c             	sar    $0xc,%ebx
+  802155:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802158:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80215f:	74 56                	je     8021b7 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802161:	85 ff                	test   %edi,%edi
+  802163:	7e 24                	jle    802189 <nsipc_bulk+0x4b>
+  802165:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80216b:	74 1c                	je     802189 <nsipc_bulk+0x4b>
+  80216d:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802173:	c1 e3 0c             	shl    $0xc,%ebx
+  802176:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80217b:	0f b6 10             	movzbl (%eax),%edx
+  80217e:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802180:	05 00 10 00 00       	add    $0x1000,%eax
+  802185:	39 d8                	cmp    %ebx,%eax
+  802187:	75 f2                	jne    80217b <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802189:	83 ec 0c             	sub    $0xc,%esp
+  80218c:	56                   	push   %esi
+  80218d:	57                   	push   %edi
+  80218e:	68 00 00 00 e0       	push   $0xe0000000
+  802193:	ff 75 e4             	push   -0x1c(%ebp)
+  802196:	ff 35 24 63 80 00    	push   0x806324
+  80219c:	e8 06 18 00 00       	call   8039a7 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  8021a1:	83 c4 1c             	add    $0x1c,%esp
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	6a 00                	push   $0x0
+  8021a8:	6a 00                	push   $0x0
+  8021aa:	e8 34 15 00 00       	call   8036e3 <ipc_recv>
+}
+  8021af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b2:	5b                   	pop    %ebx
+  8021b3:	5e                   	pop    %esi
+  8021b4:	5f                   	pop    %edi
+  8021b5:	5d                   	pop    %ebp
+  8021b6:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+  8021ba:	6a 03                	push   $0x3
+  8021bc:	e8 1b 18 00 00       	call   8039dc <ipc_find_env>
+  8021c1:	a3 24 63 80 00       	mov    %eax,0x806324
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	eb 96                	jmp    802161 <nsipc_bulk+0x23>
+
+008021cb <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	53                   	push   %ebx
+  8021cf:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d5:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8021da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021dd:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021e7:	e8 50 fe ff ff       	call   80203c <nsipc>
+  8021ec:	89 c3                	mov    %eax,%ebx
+  8021ee:	85 c0                	test   %eax,%eax
+  8021f0:	79 07                	jns    8021f9 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021f2:	89 d8                	mov    %ebx,%eax
+  8021f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f7:	c9                   	leave
+  8021f8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8021f9:	83 ec 04             	sub    $0x4,%esp
+  8021fc:	ff 35 10 80 80 00    	push   0x808010
+  802202:	68 00 80 80 00       	push   $0x808000
+  802207:	ff 75 0c             	push   0xc(%ebp)
+  80220a:	e8 15 ea ff ff       	call   800c24 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80220f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802215:	8b 45 10             	mov    0x10(%ebp),%eax
+  802218:	89 10                	mov    %edx,(%eax)
+  80221a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80221d:	eb d3                	jmp    8021f2 <nsipc_accept+0x27>
+
+0080221f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	53                   	push   %ebx
+  802223:	83 ec 08             	sub    $0x8,%esp
+  802226:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222c:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802231:	53                   	push   %ebx
+  802232:	ff 75 0c             	push   0xc(%ebp)
+  802235:	68 04 80 80 00       	push   $0x808004
+  80223a:	e8 e5 e9 ff ff       	call   800c24 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80223f:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802245:	b8 02 00 00 00       	mov    $0x2,%eax
+  80224a:	e8 ed fd ff ff       	call   80203c <nsipc>
+}
+  80224f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+
+00802254 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802254:	55                   	push   %ebp
+  802255:	89 e5                	mov    %esp,%ebp
+  802257:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80225a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80225d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802262:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802265:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  80226a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80226f:	e8 c8 fd ff ff       	call   80203c <nsipc>
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+
+00802276 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802276:	55                   	push   %ebp
+  802277:	89 e5                	mov    %esp,%ebp
+  802279:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80227c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80227f:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802284:	b8 04 00 00 00       	mov    $0x4,%eax
+  802289:	e8 ae fd ff ff       	call   80203c <nsipc>
+}
+  80228e:	c9                   	leave
+  80228f:	c3                   	ret
+
+00802290 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802290:	55                   	push   %ebp
+  802291:	89 e5                	mov    %esp,%ebp
+  802293:	53                   	push   %ebx
+  802294:	83 ec 08             	sub    $0x8,%esp
+  802297:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  80229a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8022a2:	53                   	push   %ebx
+  8022a3:	ff 75 0c             	push   0xc(%ebp)
+  8022a6:	68 04 80 80 00       	push   $0x808004
+  8022ab:	e8 74 e9 ff ff       	call   800c24 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8022b0:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8022b6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022bb:	e8 7c fd ff ff       	call   80203c <nsipc>
+}
+  8022c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+
+008022c5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8022db:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022e0:	e8 57 fd ff ff       	call   80203c <nsipc>
+}
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+
+008022e7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	56                   	push   %esi
+  8022eb:	53                   	push   %ebx
+  8022ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8022f7:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8022fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802300:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802305:	b8 07 00 00 00       	mov    $0x7,%eax
+  80230a:	e8 2d fd ff ff       	call   80203c <nsipc>
+  80230f:	89 c3                	mov    %eax,%ebx
+  802311:	85 c0                	test   %eax,%eax
+  802313:	78 22                	js     802337 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802315:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80231a:	39 c6                	cmp    %eax,%esi
+  80231c:	0f 4e c6             	cmovle %esi,%eax
+  80231f:	39 c3                	cmp    %eax,%ebx
+  802321:	7f 1d                	jg     802340 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802323:	83 ec 04             	sub    $0x4,%esp
+  802326:	53                   	push   %ebx
+  802327:	68 00 80 80 00       	push   $0x808000
+  80232c:	ff 75 0c             	push   0xc(%ebp)
+  80232f:	e8 f0 e8 ff ff       	call   800c24 <memmove>
+  802334:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802337:	89 d8                	mov    %ebx,%eax
+  802339:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80233c:	5b                   	pop    %ebx
+  80233d:	5e                   	pop    %esi
+  80233e:	5d                   	pop    %ebp
+  80233f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802340:	68 14 45 80 00       	push   $0x804514
+  802345:	68 29 45 80 00       	push   $0x804529
+  80234a:	68 b2 00 00 00       	push   $0xb2
+  80234f:	68 3e 45 80 00       	push   $0x80453e
+  802354:	e8 49 df ff ff       	call   8002a2 <_panic>
+
+00802359 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	53                   	push   %ebx
+  80235d:	83 ec 04             	sub    $0x4,%esp
+  802360:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802363:	8b 45 08             	mov    0x8(%ebp),%eax
+  802366:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  80236b:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802371:	7f 2e                	jg     8023a1 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802373:	83 ec 04             	sub    $0x4,%esp
+  802376:	53                   	push   %ebx
+  802377:	ff 75 0c             	push   0xc(%ebp)
+  80237a:	68 0c 80 80 00       	push   $0x80800c
+  80237f:	e8 a0 e8 ff ff       	call   800c24 <memmove>
+	nsipcbuf.send.req_size = size;
+  802384:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  80238a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80238d:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802392:	b8 08 00 00 00       	mov    $0x8,%eax
+  802397:	e8 a0 fc ff ff       	call   80203c <nsipc>
+}
+  80239c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80239f:	c9                   	leave
+  8023a0:	c3                   	ret
+	assert(size < 1600);
+  8023a1:	68 4a 45 80 00       	push   $0x80454a
+  8023a6:	68 29 45 80 00       	push   $0x804529
+  8023ab:	68 bd 00 00 00       	push   $0xbd
+  8023b0:	68 3e 45 80 00       	push   $0x80453e
+  8023b5:	e8 e8 de ff ff       	call   8002a2 <_panic>
+
+008023ba <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8023ba:	55                   	push   %ebp
+  8023bb:	89 e5                	mov    %esp,%ebp
+  8023bd:	57                   	push   %edi
+  8023be:	56                   	push   %esi
+  8023bf:	53                   	push   %ebx
+  8023c0:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8023c3:	e8 c0 fc ff ff       	call   802088 <nsbulk_map>
+  8023c8:	85 c0                	test   %eax,%eax
+  8023ca:	78 55                	js     802421 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8023cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8023d3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8023da:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023e1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023e4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023e7:	0f 8d 24 02 00 00    	jge    802611 <nsipc_sendmsg+0x257>
+  8023ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023f0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023f3:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8023f6:	89 d8                	mov    %ebx,%eax
+  8023f8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023fd:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8023ff:	83 ec 0c             	sub    $0xc,%esp
+  802402:	68 20 60 80 00       	push   $0x806020
+  802407:	e8 5a 0f 00 00       	call   803366 <pgbatch_init>
+  80240c:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80240f:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802411:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802414:	e9 82 00 00 00       	jmp    80249b <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802419:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80241c:	85 db                	test   %ebx,%ebx
+  80241e:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802421:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802424:	5b                   	pop    %ebx
+  802425:	5e                   	pop    %esi
+  802426:	5f                   	pop    %edi
+  802427:	5d                   	pop    %ebp
+  802428:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802429:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80242e:	29 c8                	sub    %ecx,%eax
+  802430:	39 d0                	cmp    %edx,%eax
+  802432:	0f 46 d0             	cmovbe %eax,%edx
+  802435:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802437:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80243d:	85 ff                	test   %edi,%edi
+  80243f:	0f 49 c7             	cmovns %edi,%eax
+  802442:	c1 f8 0c             	sar    $0xc,%eax
+  802445:	ba 01 00 00 00       	mov    $0x1,%edx
+  80244a:	e8 87 fc ff ff       	call   8020d6 <nsbulk_own>
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	0f 88 17 01 00 00    	js     80256e <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802457:	83 ec 04             	sub    $0x4,%esp
+  80245a:	56                   	push   %esi
+  80245b:	ff 75 e0             	push   -0x20(%ebp)
+  80245e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802461:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802466:	50                   	push   %eax
+  802467:	e8 b8 e7 ff ff       	call   800c24 <memmove>
+  80246c:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80246f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802472:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802475:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802478:	0f 84 fd 00 00 00    	je     80257b <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80247e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802481:	01 f7                	add    %esi,%edi
+  802483:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802486:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802489:	0f 8d 01 01 00 00    	jge    802590 <nsipc_sendmsg+0x1d6>
+  80248f:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802495:	0f 8f f0 00 00 00    	jg     80258b <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80249b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80249e:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8024a1:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8024a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024a7:	89 c2                	mov    %eax,%edx
+  8024a9:	03 13                	add    (%ebx),%edx
+  8024ab:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8024ae:	8b 73 04             	mov    0x4(%ebx),%esi
+  8024b1:	29 c6                	sub    %eax,%esi
+  8024b3:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8024b8:	29 f9                	sub    %edi,%ecx
+  8024ba:	39 ce                	cmp    %ecx,%esi
+  8024bc:	89 ca                	mov    %ecx,%edx
+  8024be:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8024c1:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8024c4:	89 f9                	mov    %edi,%ecx
+  8024c6:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8024cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024cf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024d4:	09 c8                	or     %ecx,%eax
+  8024d6:	0f 85 4d ff ff ff    	jne    802429 <nsipc_sendmsg+0x6f>
+  8024dc:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8024e2:	0f 86 41 ff ff ff    	jbe    802429 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024e8:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8024ee:	85 ff                	test   %edi,%edi
+  8024f0:	0f 49 c7             	cmovns %edi,%eax
+  8024f3:	c1 f8 0c             	sar    $0xc,%eax
+  8024f6:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8024f8:	89 d1                	mov    %edx,%ecx
+  8024fa:	c1 e9 0c             	shr    $0xc,%ecx
+  8024fd:	01 c8                	add    %ecx,%eax
+  8024ff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802502:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802505:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802507:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80250a:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80250f:	29 c8                	sub    %ecx,%eax
+  802511:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802514:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802517:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802519:	b8 01 00 00 00       	mov    $0x1,%eax
+  80251e:	89 f9                	mov    %edi,%ecx
+  802520:	d3 e0                	shl    %cl,%eax
+  802522:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802528:	83 ec 08             	sub    $0x8,%esp
+  80252b:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80252d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802530:	50                   	push   %eax
+  802531:	6a 00                	push   $0x0
+  802533:	56                   	push   %esi
+  802534:	6a 00                	push   $0x0
+  802536:	68 20 60 80 00       	push   $0x806020
+  80253b:	e8 e4 0e 00 00       	call   803424 <pgbatch_map>
+  802540:	83 c4 20             	add    $0x20,%esp
+  802543:	85 c0                	test   %eax,%eax
+  802545:	0f 88 ce fe ff ff    	js     802419 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80254b:	83 c7 01             	add    $0x1,%edi
+  80254e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802554:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802557:	39 c7                	cmp    %eax,%edi
+  802559:	75 be                	jne    802519 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  80255b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80255e:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802561:	89 d6                	mov    %edx,%esi
+  802563:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802569:	e9 01 ff ff ff       	jmp    80246f <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80256e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802571:	85 db                	test   %ebx,%ebx
+  802573:	0f 45 c3             	cmovne %ebx,%eax
+  802576:	e9 a6 fe ff ff       	jmp    802421 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80257b:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80257f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802586:	e9 f3 fe ff ff       	jmp    80247e <nsipc_sendmsg+0xc4>
+  80258b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80258e:	eb 03                	jmp    802593 <nsipc_sendmsg+0x1d9>
+  802590:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802593:	83 ec 0c             	sub    $0xc,%esp
+  802596:	68 20 60 80 00       	push   $0x806020
+  80259b:	e8 d4 0d 00 00       	call   803374 <pgbatch_flush>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	85 c0                	test   %eax,%eax
+  8025a5:	78 50                	js     8025f7 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8025a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025aa:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8025af:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8025b5:	89 fb                	mov    %edi,%ebx
+  8025b7:	29 f3                	sub    %esi,%ebx
+  8025b9:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8025bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c2:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8025c7:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8025cc:	89 fa                	mov    %edi,%edx
+  8025ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025d3:	e8 66 fb ff ff       	call   80213e <nsipc_bulk>
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	78 28                	js     802604 <nsipc_sendmsg+0x24a>
+		sent += r;
+  8025dc:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8025df:	39 c3                	cmp    %eax,%ebx
+  8025e1:	75 0c                	jne    8025ef <nsipc_sendmsg+0x235>
+  8025e3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025e6:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8025e9:	0f 8f f2 fd ff ff    	jg     8023e1 <nsipc_sendmsg+0x27>
+		sent += r;
+  8025ef:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8025f2:	e9 2a fe ff ff       	jmp    802421 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025f7:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025fa:	85 db                	test   %ebx,%ebx
+  8025fc:	0f 45 c3             	cmovne %ebx,%eax
+  8025ff:	e9 1d fe ff ff       	jmp    802421 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802604:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802607:	85 db                	test   %ebx,%ebx
+  802609:	0f 45 c3             	cmovne %ebx,%eax
+  80260c:	e9 10 fe ff ff       	jmp    802421 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802611:	83 ec 0c             	sub    $0xc,%esp
+  802614:	68 20 60 80 00       	push   $0x806020
+  802619:	e8 48 0d 00 00       	call   803366 <pgbatch_init>
+  80261e:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802621:	be 00 00 00 00       	mov    $0x0,%esi
+  802626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262b:	e9 63 ff ff ff       	jmp    802593 <nsipc_sendmsg+0x1d9>
+
+00802630 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	57                   	push   %edi
+  802634:	56                   	push   %esi
+  802635:	53                   	push   %ebx
+  802636:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802639:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  802640:	0f 84 c8 00 00 00    	je     80270e <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802646:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80264d:	0f 84 e4 00 00 00    	je     802737 <nsipc_sendfile+0x107>
+{
+  802653:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802658:	89 fb                	mov    %edi,%ebx
+  80265a:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  80265d:	0f 83 f0 00 00 00    	jae    802753 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802663:	89 fa                	mov    %edi,%edx
+  802665:	03 55 10             	add    0x10(%ebp),%edx
+  802668:	89 d0                	mov    %edx,%eax
+  80266a:	c1 f8 1f             	sar    $0x1f,%eax
+  80266d:	c1 e8 14             	shr    $0x14,%eax
+  802670:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802673:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802679:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80267b:	6a 10                	push   $0x10
+  80267d:	68 00 20 01 e0       	push   $0xe0012000
+  802682:	52                   	push   %edx
+  802683:	ff 75 0c             	push   0xc(%ebp)
+  802686:	e8 fe f4 ff ff       	call   801b89 <fmap>
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	0f 8e b8 00 00 00    	jle    80274e <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802696:	39 c6                	cmp    %eax,%esi
+  802698:	0f 8d b5 00 00 00    	jge    802753 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  80269e:	29 f0                	sub    %esi,%eax
+  8026a0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8026a3:	29 da                	sub    %ebx,%edx
+  8026a5:	39 d0                	cmp    %edx,%eax
+  8026a7:	89 d3                	mov    %edx,%ebx
+  8026a9:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8026ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026af:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8026b4:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8026ba:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8026c0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026c3:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026c8:	83 ec 0c             	sub    $0xc,%esp
+  8026cb:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8026cd:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8026d4:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026d7:	83 c0 01             	add    $0x1,%eax
+  8026da:	50                   	push   %eax
+  8026db:	68 00 10 01 e0       	push   $0xe0011000
+  8026e0:	6a 11                	push   $0x11
+  8026e2:	ff 35 24 63 80 00    	push   0x806324
+  8026e8:	e8 ba 12 00 00       	call   8039a7 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026ed:	83 c4 1c             	add    $0x1c,%esp
+  8026f0:	6a 00                	push   $0x0
+  8026f2:	6a 00                	push   $0x0
+  8026f4:	6a 00                	push   $0x0
+  8026f6:	e8 e8 0f 00 00       	call   8036e3 <ipc_recv>
+  8026fb:	83 c4 10             	add    $0x10,%esp
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	78 5b                	js     80275d <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802702:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802704:	39 c3                	cmp    %eax,%ebx
+  802706:	0f 8e 4c ff ff ff    	jle    802658 <nsipc_sendfile+0x28>
+  80270c:	eb 45                	jmp    802753 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80270e:	83 ec 04             	sub    $0x4,%esp
+  802711:	6a 07                	push   $0x7
+  802713:	68 00 10 01 e0       	push   $0xe0011000
+  802718:	6a 00                	push   $0x0
+  80271a:	e8 89 e7 ff ff       	call   800ea8 <sys_page_alloc>
+  80271f:	89 c7                	mov    %eax,%edi
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	85 c0                	test   %eax,%eax
+  802726:	78 2b                	js     802753 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802728:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80272f:	00 00 00 
+  802732:	e9 0f ff ff ff       	jmp    802646 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802737:	83 ec 0c             	sub    $0xc,%esp
+  80273a:	6a 03                	push   $0x3
+  80273c:	e8 9b 12 00 00       	call   8039dc <ipc_find_env>
+  802741:	a3 24 63 80 00       	mov    %eax,0x806324
+  802746:	83 c4 10             	add    $0x10,%esp
+  802749:	e9 05 ff ff ff       	jmp    802653 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80274e:	85 ff                	test   %edi,%edi
+  802750:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802753:	89 f8                	mov    %edi,%eax
+  802755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802758:	5b                   	pop    %ebx
+  802759:	5e                   	pop    %esi
+  80275a:	5f                   	pop    %edi
+  80275b:	5d                   	pop    %ebp
+  80275c:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80275d:	85 ff                	test   %edi,%edi
+  80275f:	0f 44 f8             	cmove  %eax,%edi
+  802762:	eb ef                	jmp    802753 <nsipc_sendfile+0x123>
+
+00802764 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	57                   	push   %edi
+  802768:	56                   	push   %esi
+  802769:	53                   	push   %ebx
+  80276a:	83 ec 1c             	sub    $0x1c,%esp
+  80276d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802770:	e8 13 f9 ff ff       	call   802088 <nsbulk_map>
+  802775:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	0f 88 ba 00 00 00    	js     80283a <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802780:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802784:	0f 8e bb 00 00 00    	jle    802845 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  80278a:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80278f:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  802794:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802799:	89 f8                	mov    %edi,%eax
+  80279b:	29 f0                	sub    %esi,%eax
+  80279d:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8027a1:	39 c8                	cmp    %ecx,%eax
+  8027a3:	0f 47 c1             	cmova  %ecx,%eax
+  8027a6:	01 f0                	add    %esi,%eax
+  8027a8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8027aa:	83 c2 01             	add    $0x1,%edx
+  8027ad:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8027b0:	7e 07                	jle    8027b9 <nsipc_recvmsg+0x55>
+  8027b2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8027b7:	7e e0                	jle    802799 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8027b9:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8027bf:	c1 fa 0c             	sar    $0xc,%edx
+  8027c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c7:	e8 0a f9 ff ff       	call   8020d6 <nsbulk_own>
+  8027cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027cf:	85 c0                	test   %eax,%eax
+  8027d1:	78 67                	js     80283a <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8027d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027d6:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8027db:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8027e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027e4:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8027e9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8027ee:	89 f2                	mov    %esi,%edx
+  8027f0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8027f5:	e8 44 f9 ff ff       	call   80213e <nsipc_bulk>
+  8027fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	78 39                	js     80283a <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  802801:	39 f0                	cmp    %esi,%eax
+  802803:	7f 4a                	jg     80284f <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802805:	bf 00 00 00 00       	mov    $0x0,%edi
+  80280a:	85 c0                	test   %eax,%eax
+  80280c:	7e 2c                	jle    80283a <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80280e:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802811:	29 fe                	sub    %edi,%esi
+  802813:	8b 43 04             	mov    0x4(%ebx),%eax
+  802816:	39 c6                	cmp    %eax,%esi
+  802818:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80281b:	83 ec 04             	sub    $0x4,%esp
+  80281e:	56                   	push   %esi
+  80281f:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802825:	50                   	push   %eax
+  802826:	ff 33                	push   (%ebx)
+  802828:	e8 f7 e3 ff ff       	call   800c24 <memmove>
+		n += m;
+  80282d:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80282f:	83 c3 08             	add    $0x8,%ebx
+  802832:	83 c4 10             	add    $0x10,%esp
+  802835:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802838:	7f d4                	jg     80280e <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80283a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80283d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802840:	5b                   	pop    %ebx
+  802841:	5e                   	pop    %esi
+  802842:	5f                   	pop    %edi
+  802843:	5d                   	pop    %ebp
+  802844:	c3                   	ret
+	int r, i, n, len = 0;
+  802845:	be 00 00 00 00       	mov    $0x0,%esi
+  80284a:	e9 6a ff ff ff       	jmp    8027b9 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80284f:	68 20 45 80 00       	push   $0x804520
+  802854:	68 29 45 80 00       	push   $0x804529
+  802859:	68 3b 01 00 00       	push   $0x13b
+  80285e:	68 3e 45 80 00       	push   $0x80453e
+  802863:	e8 3a da ff ff       	call   8002a2 <_panic>
+
+00802868 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	57                   	push   %edi
+  80286c:	56                   	push   %esi
+  80286d:	53                   	push   %ebx
+  80286e:	83 ec 0c             	sub    $0xc,%esp
+  802871:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802874:	8b 75 10             	mov    0x10(%ebp),%esi
+  802877:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  80287a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287d:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  802882:	8b 07                	mov    (%edi),%eax
+  802884:	a3 04 80 80 00       	mov    %eax,0x808004
+  802889:	8b 47 04             	mov    0x4(%edi),%eax
+  80288c:	a3 08 80 80 00       	mov    %eax,0x808008
+  802891:	8b 47 08             	mov    0x8(%edi),%eax
+  802894:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802899:	8b 47 0c             	mov    0xc(%edi),%eax
+  80289c:	a3 10 80 80 00       	mov    %eax,0x808010
+  8028a1:	8b 47 10             	mov    0x10(%edi),%eax
+  8028a4:	a3 14 80 80 00       	mov    %eax,0x808014
+  8028a9:	8b 47 14             	mov    0x14(%edi),%eax
+  8028ac:	a3 18 80 80 00       	mov    %eax,0x808018
+  8028b1:	8b 47 18             	mov    0x18(%edi),%eax
+  8028b4:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8028b9:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8028bc:	a3 20 80 80 00       	mov    %eax,0x808020
+  8028c1:	8b 47 20             	mov    0x20(%edi),%eax
+  8028c4:	a3 24 80 80 00       	mov    %eax,0x808024
+  8028c9:	8b 47 24             	mov    0x24(%edi),%eax
+  8028cc:	a3 28 80 80 00       	mov    %eax,0x808028
+  8028d1:	8b 47 28             	mov    0x28(%edi),%eax
+  8028d4:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8028d9:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8028dc:	a3 30 80 80 00       	mov    %eax,0x808030
+  8028e1:	8b 47 30             	mov    0x30(%edi),%eax
+  8028e4:	a3 34 80 80 00       	mov    %eax,0x808034
+  8028e9:	8b 47 34             	mov    0x34(%edi),%eax
+  8028ec:	a3 38 80 80 00       	mov    %eax,0x808038
+  8028f1:	8b 47 38             	mov    0x38(%edi),%eax
+  8028f4:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8028f9:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8028fc:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  802901:	8b 06                	mov    (%esi),%eax
+  802903:	a3 44 80 80 00       	mov    %eax,0x808044
+  802908:	8b 46 04             	mov    0x4(%esi),%eax
+  80290b:	a3 48 80 80 00       	mov    %eax,0x808048
+  802910:	8b 46 08             	mov    0x8(%esi),%eax
+  802913:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802918:	8b 46 0c             	mov    0xc(%esi),%eax
+  80291b:	a3 50 80 80 00       	mov    %eax,0x808050
+  802920:	8b 46 10             	mov    0x10(%esi),%eax
+  802923:	a3 54 80 80 00       	mov    %eax,0x808054
+  802928:	8b 46 14             	mov    0x14(%esi),%eax
+  80292b:	a3 58 80 80 00       	mov    %eax,0x808058
+  802930:	8b 46 18             	mov    0x18(%esi),%eax
+  802933:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802938:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80293b:	a3 60 80 80 00       	mov    %eax,0x808060
+  802940:	8b 46 20             	mov    0x20(%esi),%eax
+  802943:	a3 64 80 80 00       	mov    %eax,0x808064
+  802948:	8b 46 24             	mov    0x24(%esi),%eax
+  80294b:	a3 68 80 80 00       	mov    %eax,0x808068
+  802950:	8b 46 28             	mov    0x28(%esi),%eax
+  802953:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802958:	8b 46 2c             	mov    0x2c(%esi),%eax
+  80295b:	a3 70 80 80 00       	mov    %eax,0x808070
+  802960:	8b 46 30             	mov    0x30(%esi),%eax
+  802963:	a3 74 80 80 00       	mov    %eax,0x808074
+  802968:	8b 46 34             	mov    0x34(%esi),%eax
+  80296b:	a3 78 80 80 00       	mov    %eax,0x808078
+  802970:	8b 46 38             	mov    0x38(%esi),%eax
+  802973:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802978:	8b 46 3c             	mov    0x3c(%esi),%eax
+  80297b:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  802980:	8b 03                	mov    (%ebx),%eax
+  802982:	a3 84 80 80 00       	mov    %eax,0x808084
+  802987:	8b 43 04             	mov    0x4(%ebx),%eax
+  80298a:	a3 88 80 80 00       	mov    %eax,0x808088
+  80298f:	8b 43 08             	mov    0x8(%ebx),%eax
+  802992:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802997:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80299a:	a3 90 80 80 00       	mov    %eax,0x808090
+  80299f:	8b 43 10             	mov    0x10(%ebx),%eax
+  8029a2:	a3 94 80 80 00       	mov    %eax,0x808094
+  8029a7:	8b 43 14             	mov    0x14(%ebx),%eax
+  8029aa:	a3 98 80 80 00       	mov    %eax,0x808098
+  8029af:	8b 43 18             	mov    0x18(%ebx),%eax
+  8029b2:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8029b7:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8029ba:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8029bf:	8b 43 20             	mov    0x20(%ebx),%eax
+  8029c2:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8029c7:	8b 43 24             	mov    0x24(%ebx),%eax
+  8029ca:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8029cf:	8b 43 28             	mov    0x28(%ebx),%eax
+  8029d2:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8029d7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8029da:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8029df:	8b 43 30             	mov    0x30(%ebx),%eax
+  8029e2:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8029e7:	8b 43 34             	mov    0x34(%ebx),%eax
+  8029ea:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8029ef:	8b 43 38             	mov    0x38(%ebx),%eax
+  8029f2:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8029f7:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8029fa:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8029ff:	8b 45 18             	mov    0x18(%ebp),%eax
+  802a02:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802a07:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802a0c:	e8 2b f6 ff ff       	call   80203c <nsipc>
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	0f 88 ad 01 00 00    	js     802bc6 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802a19:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802a1f:	89 17                	mov    %edx,(%edi)
+  802a21:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802a27:	89 57 04             	mov    %edx,0x4(%edi)
+  802a2a:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802a30:	89 57 08             	mov    %edx,0x8(%edi)
+  802a33:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a39:	89 57 0c             	mov    %edx,0xc(%edi)
+  802a3c:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802a42:	89 57 10             	mov    %edx,0x10(%edi)
+  802a45:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802a4b:	89 57 14             	mov    %edx,0x14(%edi)
+  802a4e:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802a54:	89 57 18             	mov    %edx,0x18(%edi)
+  802a57:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802a5d:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802a60:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802a66:	89 57 20             	mov    %edx,0x20(%edi)
+  802a69:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802a6f:	89 57 24             	mov    %edx,0x24(%edi)
+  802a72:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802a78:	89 57 28             	mov    %edx,0x28(%edi)
+  802a7b:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802a81:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802a84:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802a8a:	89 57 30             	mov    %edx,0x30(%edi)
+  802a8d:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802a93:	89 57 34             	mov    %edx,0x34(%edi)
+  802a96:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802a9c:	89 57 38             	mov    %edx,0x38(%edi)
+  802a9f:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802aa5:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802aa8:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802aae:	89 16                	mov    %edx,(%esi)
+  802ab0:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802ab6:	89 56 04             	mov    %edx,0x4(%esi)
+  802ab9:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802abf:	89 56 08             	mov    %edx,0x8(%esi)
+  802ac2:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802ac8:	89 56 0c             	mov    %edx,0xc(%esi)
+  802acb:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802ad1:	89 56 10             	mov    %edx,0x10(%esi)
+  802ad4:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802ada:	89 56 14             	mov    %edx,0x14(%esi)
+  802add:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802ae3:	89 56 18             	mov    %edx,0x18(%esi)
+  802ae6:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802aec:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802aef:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802af5:	89 56 20             	mov    %edx,0x20(%esi)
+  802af8:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802afe:	89 56 24             	mov    %edx,0x24(%esi)
+  802b01:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802b07:	89 56 28             	mov    %edx,0x28(%esi)
+  802b0a:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802b10:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802b13:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802b19:	89 56 30             	mov    %edx,0x30(%esi)
+  802b1c:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802b22:	89 56 34             	mov    %edx,0x34(%esi)
+  802b25:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802b2b:	89 56 38             	mov    %edx,0x38(%esi)
+  802b2e:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802b34:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802b37:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802b3d:	89 13                	mov    %edx,(%ebx)
+  802b3f:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802b45:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b48:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802b4e:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b51:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802b57:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b5a:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802b60:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b63:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802b69:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b6c:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802b72:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b75:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802b7b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b7e:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802b84:	89 53 20             	mov    %edx,0x20(%ebx)
+  802b87:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802b8d:	89 53 24             	mov    %edx,0x24(%ebx)
+  802b90:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802b96:	89 53 28             	mov    %edx,0x28(%ebx)
+  802b99:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802b9f:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802ba2:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802ba8:	89 53 30             	mov    %edx,0x30(%ebx)
+  802bab:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802bb1:	89 53 34             	mov    %edx,0x34(%ebx)
+  802bb4:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802bba:	89 53 38             	mov    %edx,0x38(%ebx)
+  802bbd:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802bc3:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802bc6:	83 c4 0c             	add    $0xc,%esp
+  802bc9:	5b                   	pop    %ebx
+  802bca:	5e                   	pop    %esi
+  802bcb:	5f                   	pop    %edi
+  802bcc:	5d                   	pop    %ebp
+  802bcd:	c3                   	ret
+
+00802bce <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802bd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd7:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bdf:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802be4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802be7:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802bec:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802bf1:	e8 46 f4 ff ff       	call   80203c <nsipc>
+}
+  802bf6:	c9                   	leave
+  802bf7:	c3                   	ret
+
+00802bf8 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802bf8:	55                   	push   %ebp
+  802bf9:	89 e5                	mov    %esp,%ebp
+  802bfb:	56                   	push   %esi
+  802bfc:	53                   	push   %ebx
+  802bfd:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802c00:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802c06:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c09:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802c0e:	b8 10 00 00 00       	mov    $0x10,%eax
+  802c13:	e8 24 f4 ff ff       	call   80203c <nsipc>
+  802c18:	89 c3                	mov    %eax,%ebx
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	7e 1f                	jle    802c3d <nsipc_evwait+0x45>
+		assert(r <= max);
+  802c1e:	39 c6                	cmp    %eax,%esi
+  802c20:	7c 24                	jl     802c46 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802c22:	83 ec 04             	sub    $0x4,%esp
+  802c25:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802c2c:	50                   	push   %eax
+  802c2d:	68 00 80 80 00       	push   $0x808000
+  802c32:	ff 75 08             	push   0x8(%ebp)
+  802c35:	e8 ea df ff ff       	call   800c24 <memmove>
+  802c3a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c3d:	89 d8                	mov    %ebx,%eax
+  802c3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c42:	5b                   	pop    %ebx
+  802c43:	5e                   	pop    %esi
+  802c44:	5d                   	pop    %ebp
+  802c45:	c3                   	ret
+		assert(r <= max);
+  802c46:	68 56 45 80 00       	push   $0x804556
+  802c4b:	68 29 45 80 00       	push   $0x804529
+  802c50:	68 6a 01 00 00       	push   $0x16a
+  802c55:	68 3e 45 80 00       	push   $0x80453e
+  802c5a:	e8 43 d6 ff ff       	call   8002a2 <_panic>
+
+00802c5f <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c5f:	55                   	push   %ebp
+  802c60:	89 e5                	mov    %esp,%ebp
+  802c62:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c65:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c68:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c70:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c75:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c78:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c7d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c82:	e8 b5 f3 ff ff       	call   80203c <nsipc>
+}
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+
+00802c89 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802c8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c92:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802c97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c9c:	e8 9b f3 ff ff       	call   80203c <nsipc>
+}
+  802ca1:	c9                   	leave
+  802ca2:	c3                   	ret
+
+00802ca3 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802ca3:	55                   	push   %ebp
+  802ca4:	89 e5                	mov    %esp,%ebp
+  802ca6:	53                   	push   %ebx
+  802ca7:	83 ec 04             	sub    $0x4,%esp
+  802caa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802cad:	b8 12 00 00 00       	mov    $0x12,%eax
+  802cb2:	e8 85 f3 ff ff       	call   80203c <nsipc>
+  802cb7:	85 c0                	test   %eax,%eax
+  802cb9:	78 50                	js     802d0b <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802cbb:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802cc1:	89 13                	mov    %edx,(%ebx)
+  802cc3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802cc9:	89 53 04             	mov    %edx,0x4(%ebx)
+  802ccc:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802cd2:	89 53 08             	mov    %edx,0x8(%ebx)
+  802cd5:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802cdb:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802cde:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802ce4:	89 53 10             	mov    %edx,0x10(%ebx)
+  802ce7:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802ced:	89 53 14             	mov    %edx,0x14(%ebx)
+  802cf0:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802cf6:	89 53 18             	mov    %edx,0x18(%ebx)
+  802cf9:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802cff:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802d02:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802d08:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802d0b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d0e:	c9                   	leave
+  802d0f:	c3                   	ret
+
+00802d10 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d16:	6a 03                	push   $0x3
+  802d18:	e8 bf 0c 00 00       	call   8039dc <ipc_find_env>
+  802d1d:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802d22:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d25:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802d2a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d2f:	e8 08 f3 ff ff       	call   80203c <nsipc>
+  802d34:	83 c4 10             	add    $0x10,%esp
+  802d37:	85 c0                	test   %eax,%eax
+  802d39:	78 0a                	js     802d45 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802d3b:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802d40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d45:	c9                   	leave
+  802d46:	c3                   	ret
+
+00802d47 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802d47:	55                   	push   %ebp
+  802d48:	89 e5                	mov    %esp,%ebp
+  802d4a:	57                   	push   %edi
+  802d4b:	56                   	push   %esi
+  802d4c:	53                   	push   %ebx
+  802d4d:	83 ec 1c             	sub    $0x1c,%esp
+  802d50:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802d53:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802d56:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802d5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d60:	89 e0                	mov    %esp,%eax
+  802d62:	89 f2                	mov    %esi,%edx
+  802d64:	29 c2                	sub    %eax,%edx
+  802d66:	89 d0                	mov    %edx,%eax
+  802d68:	c1 e8 0f             	shr    $0xf,%eax
+  802d6b:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802d71:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802d74:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802d7b:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802d7e:	83 ec 0c             	sub    $0xc,%esp
+  802d81:	ff 75 e0             	push   -0x20(%ebp)
+  802d84:	e8 92 0c 00 00       	call   803a1b <pageref>
+  802d89:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d8c:	83 c4 04             	add    $0x4,%esp
+  802d8f:	ff 75 dc             	push   -0x24(%ebp)
+  802d92:	e8 84 0c 00 00       	call   803a1b <pageref>
+  802d97:	89 e2                	mov    %esp,%edx
+  802d99:	89 f1                	mov    %esi,%ecx
+  802d9b:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802d9d:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802da0:	89 ca                	mov    %ecx,%edx
+  802da2:	c1 ea 0f             	shr    $0xf,%edx
+  802da5:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802dab:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802dae:	8b 14 95 60 63 80 00 	mov    0x806360(,%edx,4),%edx
+  802db5:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802db8:	39 d7                	cmp    %edx,%edi
+  802dba:	74 40                	je     802dfc <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802dbc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802dbf:	75 9f                	jne    802d60 <_pipeisclosed+0x19>
+  802dc1:	89 e2                	mov    %esp,%edx
+  802dc3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802dc8:	29 d0                	sub    %edx,%eax
+  802dca:	89 c2                	mov    %eax,%edx
+  802dcc:	c1 ea 0f             	shr    $0xf,%edx
+  802dcf:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd9:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802ddc:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  802de3:	8b 40 58             	mov    0x58(%eax),%eax
+  802de6:	6a 01                	push   $0x1
+  802de8:	50                   	push   %eax
+  802de9:	57                   	push   %edi
+  802dea:	68 5f 45 80 00       	push   $0x80455f
+  802def:	e8 89 d5 ff ff       	call   80037d <cprintf>
+  802df4:	83 c4 10             	add    $0x10,%esp
+  802df7:	e9 5f ff ff ff       	jmp    802d5b <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802dfc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802dff:	0f 94 c0             	sete   %al
+  802e02:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e08:	5b                   	pop    %ebx
+  802e09:	5e                   	pop    %esi
+  802e0a:	5f                   	pop    %edi
+  802e0b:	5d                   	pop    %ebp
+  802e0c:	c3                   	ret
+
+00802e0d <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802e0d:	55                   	push   %ebp
+  802e0e:	89 e5                	mov    %esp,%ebp
+  802e10:	53                   	push   %ebx
+  802e11:	83 ec 0c             	sub    $0xc,%esp
+  802e14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e17:	53                   	push   %ebx
+  802e18:	6a 00                	push   $0x0
+  802e1a:	e8 0e e1 ff ff       	call   800f2d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e1f:	89 1c 24             	mov    %ebx,(%esp)
+  802e22:	e8 f4 e4 ff ff       	call   80131b <fd2data>
+  802e27:	83 c4 08             	add    $0x8,%esp
+  802e2a:	50                   	push   %eax
+  802e2b:	6a 00                	push   $0x0
+  802e2d:	e8 fb e0 ff ff       	call   800f2d <sys_page_unmap>
+}
+  802e32:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e35:	c9                   	leave
+  802e36:	c3                   	ret
+
+00802e37 <devpipe_read>:
+{
+  802e37:	55                   	push   %ebp
+  802e38:	89 e5                	mov    %esp,%ebp
+  802e3a:	57                   	push   %edi
+  802e3b:	56                   	push   %esi
+  802e3c:	53                   	push   %ebx
+  802e3d:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802e40:	ff 75 08             	push   0x8(%ebp)
+  802e43:	e8 d3 e4 ff ff       	call   80131b <fd2data>
+  802e48:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e4a:	8b 70 04             	mov    0x4(%eax),%esi
+  802e4d:	8b 00                	mov    (%eax),%eax
+  802e4f:	83 c4 10             	add    $0x10,%esp
+  802e52:	39 f0                	cmp    %esi,%eax
+  802e54:	75 36                	jne    802e8c <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802e56:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802e59:	89 da                	mov    %ebx,%edx
+  802e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5e:	e8 e4 fe ff ff       	call   802d47 <_pipeisclosed>
+  802e63:	85 c0                	test   %eax,%eax
+  802e65:	0f 85 d4 00 00 00    	jne    802f3f <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e70:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802e74:	83 ec 04             	sub    $0x4,%esp
+  802e77:	6a ff                	push   $0xffffffff
+  802e79:	56                   	push   %esi
+  802e7a:	57                   	push   %edi
+  802e7b:	e8 26 e4 ff ff       	call   8012a6 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e80:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e83:	8b 03                	mov    (%ebx),%eax
+  802e85:	83 c4 10             	add    $0x10,%esp
+  802e88:	39 c6                	cmp    %eax,%esi
+  802e8a:	74 cd                	je     802e59 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e8c:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e8f:	8b 03                	mov    (%ebx),%eax
+  802e91:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802e97:	29 c6                	sub    %eax,%esi
+  802e99:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e9e:	f7 e6                	mul    %esi
+  802ea0:	c1 ea 0c             	shr    $0xc,%edx
+  802ea3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ea9:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802eab:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802eae:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802eb2:	8b 0b                	mov    (%ebx),%ecx
+  802eb4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eb9:	f7 e1                	mul    %ecx
+  802ebb:	c1 ea 0b             	shr    $0xb,%edx
+  802ebe:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802ec4:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802ec6:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802ecb:	29 cf                	sub    %ecx,%edi
+  802ecd:	39 f7                	cmp    %esi,%edi
+  802ecf:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	57                   	push   %edi
+  802ed6:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802eda:	50                   	push   %eax
+  802edb:	ff 75 0c             	push   0xc(%ebp)
+  802ede:	e8 41 dd ff ff       	call   800c24 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802ee3:	83 c4 0c             	add    $0xc,%esp
+  802ee6:	89 f0                	mov    %esi,%eax
+  802ee8:	29 f8                	sub    %edi,%eax
+  802eea:	50                   	push   %eax
+  802eeb:	8d 43 10             	lea    0x10(%ebx),%eax
+  802eee:	50                   	push   %eax
+  802eef:	89 f8                	mov    %edi,%eax
+  802ef1:	03 45 0c             	add    0xc(%ebp),%eax
+  802ef4:	50                   	push   %eax
+  802ef5:	e8 2a dd ff ff       	call   800c24 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802efa:	8b 0b                	mov    (%ebx),%ecx
+  802efc:	01 f1                	add    %esi,%ecx
+  802efe:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f03:	f7 e1                	mul    %ecx
+  802f05:	c1 ea 0c             	shr    $0xc,%edx
+  802f08:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f0e:	29 c1                	sub    %eax,%ecx
+  802f10:	89 0b                	mov    %ecx,(%ebx)
+  802f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f17:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802f1b:	83 c4 10             	add    $0x10,%esp
+  802f1e:	85 c0                	test   %eax,%eax
+  802f20:	75 0a                	jne    802f2c <devpipe_read+0xf5>
+	return n;
+  802f22:	89 f0                	mov    %esi,%eax
+}
+  802f24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f27:	5b                   	pop    %ebx
+  802f28:	5e                   	pop    %esi
+  802f29:	5f                   	pop    %edi
+  802f2a:	5d                   	pop    %ebp
+  802f2b:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802f2c:	83 ec 08             	sub    $0x8,%esp
+  802f2f:	68 00 04 00 00       	push   $0x400
+  802f34:	53                   	push   %ebx
+  802f35:	e8 8e e3 ff ff       	call   8012c8 <sys_futex_wake>
+  802f3a:	83 c4 10             	add    $0x10,%esp
+  802f3d:	eb e3                	jmp    802f22 <devpipe_read+0xeb>
+			return 0;
+  802f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f44:	eb de                	jmp    802f24 <devpipe_read+0xed>
+
+00802f46 <devpipe_write>:
+{
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	57                   	push   %edi
+  802f4a:	56                   	push   %esi
+  802f4b:	53                   	push   %ebx
+  802f4c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f4f:	ff 75 08             	push   0x8(%ebp)
+  802f52:	e8 c4 e3 ff ff       	call   80131b <fd2data>
+  802f57:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802f59:	83 c4 10             	add    $0x10,%esp
+  802f5c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f63:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802f68:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f6c:	0f 84 43 01 00 00    	je     8030b5 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f72:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f75:	8b 06                	mov    (%esi),%eax
+  802f77:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f7d:	29 c1                	sub    %eax,%ecx
+  802f7f:	89 c8                	mov    %ecx,%eax
+  802f81:	f7 e7                	mul    %edi
+  802f83:	c1 ea 0c             	shr    $0xc,%edx
+  802f86:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f8c:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802f8e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f94:	75 52                	jne    802fe8 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802f96:	89 f2                	mov    %esi,%edx
+  802f98:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f9b:	e8 a7 fd ff ff       	call   802d47 <_pipeisclosed>
+  802fa0:	85 c0                	test   %eax,%eax
+  802fa2:	0f 85 28 01 00 00    	jne    8030d0 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802fa8:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802faa:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fad:	8b 06                	mov    (%esi),%eax
+  802faf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fb5:	29 c1                	sub    %eax,%ecx
+  802fb7:	89 c8                	mov    %ecx,%eax
+  802fb9:	f7 e7                	mul    %edi
+  802fbb:	c1 ea 0c             	shr    $0xc,%edx
+  802fbe:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fc4:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802fc6:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802fcc:	75 a4                	jne    802f72 <devpipe_write+0x2c>
+  802fce:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fd3:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802fd7:	83 ec 04             	sub    $0x4,%esp
+  802fda:	6a ff                	push   $0xffffffff
+  802fdc:	53                   	push   %ebx
+  802fdd:	56                   	push   %esi
+  802fde:	e8 c3 e2 ff ff       	call   8012a6 <sys_futex_wait>
+}
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	eb 8a                	jmp    802f72 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fe8:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802feb:	8b 06                	mov    (%esi),%eax
+  802fed:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ff3:	29 c1                	sub    %eax,%ecx
+  802ff5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ffa:	f7 e1                	mul    %ecx
+  802ffc:	c1 ea 0c             	shr    $0xc,%edx
+  802fff:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803005:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803007:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80300c:	89 d8                	mov    %ebx,%eax
+  80300e:	29 c8                	sub    %ecx,%eax
+  803010:	8b 55 10             	mov    0x10(%ebp),%edx
+  803013:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803016:	29 ca                	sub    %ecx,%edx
+  803018:	39 d0                	cmp    %edx,%eax
+  80301a:	0f 46 d0             	cmovbe %eax,%edx
+  80301d:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803020:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803023:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803028:	f7 e1                	mul    %ecx
+  80302a:	c1 ea 0b             	shr    $0xb,%edx
+  80302d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803033:	89 ca                	mov    %ecx,%edx
+  803035:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803037:	29 d3                	sub    %edx,%ebx
+  803039:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80303c:	39 c3                	cmp    %eax,%ebx
+  80303e:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803041:	83 ec 04             	sub    $0x4,%esp
+  803044:	53                   	push   %ebx
+  803045:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803048:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80304b:	51                   	push   %ecx
+  80304c:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803050:	50                   	push   %eax
+  803051:	e8 ce db ff ff       	call   800c24 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803056:	83 c4 0c             	add    $0xc,%esp
+  803059:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80305c:	29 d8                	sub    %ebx,%eax
+  80305e:	50                   	push   %eax
+  80305f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803062:	01 cb                	add    %ecx,%ebx
+  803064:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803067:	53                   	push   %ebx
+  803068:	8d 46 10             	lea    0x10(%esi),%eax
+  80306b:	50                   	push   %eax
+  80306c:	e8 b3 db ff ff       	call   800c24 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803071:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803074:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803077:	01 c1                	add    %eax,%ecx
+  803079:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80307e:	f7 e1                	mul    %ecx
+  803080:	c1 ea 0c             	shr    $0xc,%edx
+  803083:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803089:	89 ca                	mov    %ecx,%edx
+  80308b:	29 c2                	sub    %eax,%edx
+  80308d:	89 56 04             	mov    %edx,0x4(%esi)
+  803090:	b8 00 00 00 00       	mov    $0x0,%eax
+  803095:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803099:	83 c4 10             	add    $0x10,%esp
+  80309c:	85 c0                	test   %eax,%eax
+  80309e:	75 1a                	jne    8030ba <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  8030a0:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8030a3:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  8030a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8030ac:	0f 82 c0 fe ff ff    	jb     802f72 <devpipe_write+0x2c>
+  8030b2:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  8030b5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030b8:	eb 1b                	jmp    8030d5 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8030ba:	83 ec 08             	sub    $0x8,%esp
+  8030bd:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8030c2:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8030c5:	50                   	push   %eax
+  8030c6:	e8 fd e1 ff ff       	call   8012c8 <sys_futex_wake>
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	eb d0                	jmp    8030a0 <devpipe_write+0x15a>
+				return 0;
+  8030d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030d8:	5b                   	pop    %ebx
+  8030d9:	5e                   	pop    %esi
+  8030da:	5f                   	pop    %edi
+  8030db:	5d                   	pop    %ebp
+  8030dc:	c3                   	ret
+
+008030dd <devpipe_stat>:
+{
+  8030dd:	55                   	push   %ebp
+  8030de:	89 e5                	mov    %esp,%ebp
+  8030e0:	56                   	push   %esi
+  8030e1:	53                   	push   %ebx
+  8030e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030e5:	83 ec 0c             	sub    $0xc,%esp
+  8030e8:	ff 75 08             	push   0x8(%ebp)
+  8030eb:	e8 2b e2 ff ff       	call   80131b <fd2data>
+  8030f0:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030f2:	83 c4 08             	add    $0x8,%esp
+  8030f5:	68 72 45 80 00       	push   $0x804572
+  8030fa:	53                   	push   %ebx
+  8030fb:	e8 74 d9 ff ff       	call   800a74 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803100:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803103:	8b 06                	mov    (%esi),%eax
+  803105:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80310b:	29 c1                	sub    %eax,%ecx
+  80310d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803112:	89 c8                	mov    %ecx,%eax
+  803114:	f7 e2                	mul    %edx
+  803116:	c1 ea 0c             	shr    $0xc,%edx
+  803119:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80311f:	29 d1                	sub    %edx,%ecx
+  803121:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803127:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80312e:	00 00 00 
+	stat->st_dev = &devpipe;
+  803131:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803138:	50 80 00 
+}
+  80313b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803140:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803143:	5b                   	pop    %ebx
+  803144:	5e                   	pop    %esi
+  803145:	5d                   	pop    %ebp
+  803146:	c3                   	ret
+
+00803147 <devpipe_poll>:
+{
+  803147:	55                   	push   %ebp
+  803148:	89 e5                	mov    %esp,%ebp
+  80314a:	57                   	push   %edi
+  80314b:	56                   	push   %esi
+  80314c:	53                   	push   %ebx
+  80314d:	83 ec 18             	sub    $0x18,%esp
+  803150:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803153:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803156:	57                   	push   %edi
+  803157:	e8 bf e1 ff ff       	call   80131b <fd2data>
+  80315c:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	89 f3                	mov    %esi,%ebx
+  803163:	83 e3 01             	and    $0x1,%ebx
+  803166:	75 27                	jne    80318f <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803168:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80316e:	75 48                	jne    8031b8 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803170:	89 ca                	mov    %ecx,%edx
+  803172:	89 f8                	mov    %edi,%eax
+  803174:	e8 ce fb ff ff       	call   802d47 <_pipeisclosed>
+  803179:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80317b:	89 d8                	mov    %ebx,%eax
+  80317d:	83 c8 10             	or     $0x10,%eax
+  803180:	85 d2                	test   %edx,%edx
+  803182:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803185:	89 d8                	mov    %ebx,%eax
+  803187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80318a:	5b                   	pop    %ebx
+  80318b:	5e                   	pop    %esi
+  80318c:	5f                   	pop    %edi
+  80318d:	5d                   	pop    %ebp
+  80318e:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80318f:	8b 58 04             	mov    0x4(%eax),%ebx
+  803192:	8b 00                	mov    (%eax),%eax
+  803194:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  80319a:	29 c3                	sub    %eax,%ebx
+  80319c:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031a1:	89 d8                	mov    %ebx,%eax
+  8031a3:	f7 e2                	mul    %edx
+  8031a5:	c1 ea 0c             	shr    $0xc,%edx
+  8031a8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8031ae:	39 d3                	cmp    %edx,%ebx
+  8031b0:	0f 95 c3             	setne  %bl
+  8031b3:	0f b6 db             	movzbl %bl,%ebx
+  8031b6:	eb b0                	jmp    803168 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031b8:	8b 71 04             	mov    0x4(%ecx),%esi
+  8031bb:	8b 01                	mov    (%ecx),%eax
+  8031bd:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8031c3:	29 c6                	sub    %eax,%esi
+  8031c5:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031ca:	89 f0                	mov    %esi,%eax
+  8031cc:	f7 e2                	mul    %edx
+  8031ce:	c1 ea 0c             	shr    $0xc,%edx
+  8031d1:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031d7:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8031d9:	89 d8                	mov    %ebx,%eax
+  8031db:	83 c8 04             	or     $0x4,%eax
+  8031de:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8031e4:	0f 42 d8             	cmovb  %eax,%ebx
+  8031e7:	eb 87                	jmp    803170 <devpipe_poll+0x29>
+
+008031e9 <pipe>:
+{
+  8031e9:	55                   	push   %ebp
+  8031ea:	89 e5                	mov    %esp,%ebp
+  8031ec:	56                   	push   %esi
+  8031ed:	53                   	push   %ebx
+  8031ee:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031f4:	50                   	push   %eax
+  8031f5:	e8 38 e1 ff ff       	call   801332 <fd_alloc>
+  8031fa:	89 c3                	mov    %eax,%ebx
+  8031fc:	83 c4 10             	add    $0x10,%esp
+  8031ff:	85 c0                	test   %eax,%eax
+  803201:	0f 88 23 01 00 00    	js     80332a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803207:	83 ec 04             	sub    $0x4,%esp
+  80320a:	68 07 04 00 00       	push   $0x407
+  80320f:	ff 75 f4             	push   -0xc(%ebp)
+  803212:	6a 00                	push   $0x0
+  803214:	e8 8f dc ff ff       	call   800ea8 <sys_page_alloc>
+  803219:	89 c3                	mov    %eax,%ebx
+  80321b:	83 c4 10             	add    $0x10,%esp
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	0f 88 04 01 00 00    	js     80332a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803226:	83 ec 0c             	sub    $0xc,%esp
+  803229:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80322c:	50                   	push   %eax
+  80322d:	e8 00 e1 ff ff       	call   801332 <fd_alloc>
+  803232:	89 c3                	mov    %eax,%ebx
+  803234:	83 c4 10             	add    $0x10,%esp
+  803237:	85 c0                	test   %eax,%eax
+  803239:	0f 88 db 00 00 00    	js     80331a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80323f:	83 ec 04             	sub    $0x4,%esp
+  803242:	68 07 04 00 00       	push   $0x407
+  803247:	ff 75 f0             	push   -0x10(%ebp)
+  80324a:	6a 00                	push   $0x0
+  80324c:	e8 57 dc ff ff       	call   800ea8 <sys_page_alloc>
+  803251:	89 c3                	mov    %eax,%ebx
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	85 c0                	test   %eax,%eax
+  803258:	0f 88 bc 00 00 00    	js     80331a <pipe+0x131>
+	va = fd2data(fd0);
+  80325e:	83 ec 0c             	sub    $0xc,%esp
+  803261:	ff 75 f4             	push   -0xc(%ebp)
+  803264:	e8 b2 e0 ff ff       	call   80131b <fd2data>
+  803269:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80326b:	83 c4 0c             	add    $0xc,%esp
+  80326e:	68 07 04 00 00       	push   $0x407
+  803273:	50                   	push   %eax
+  803274:	6a 00                	push   $0x0
+  803276:	e8 2d dc ff ff       	call   800ea8 <sys_page_alloc>
+  80327b:	89 c3                	mov    %eax,%ebx
+  80327d:	83 c4 10             	add    $0x10,%esp
+  803280:	85 c0                	test   %eax,%eax
+  803282:	0f 88 82 00 00 00    	js     80330a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803288:	83 ec 0c             	sub    $0xc,%esp
+  80328b:	ff 75 f0             	push   -0x10(%ebp)
+  80328e:	e8 88 e0 ff ff       	call   80131b <fd2data>
+  803293:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80329a:	50                   	push   %eax
+  80329b:	6a 00                	push   $0x0
+  80329d:	56                   	push   %esi
+  80329e:	6a 00                	push   $0x0
+  8032a0:	e8 46 dc ff ff       	call   800eeb <sys_page_map>
+  8032a5:	89 c3                	mov    %eax,%ebx
+  8032a7:	83 c4 20             	add    $0x20,%esp
+  8032aa:	85 c0                	test   %eax,%eax
+  8032ac:	78 4e                	js     8032fc <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8032ae:	a1 60 50 80 00       	mov    0x805060,%eax
+  8032b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032b6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032b8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032bb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032c2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032c5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032ca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032d1:	83 ec 0c             	sub    $0xc,%esp
+  8032d4:	ff 75 f4             	push   -0xc(%ebp)
+  8032d7:	e8 2f e0 ff ff       	call   80130b <fd2num>
+  8032dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032df:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032e1:	83 c4 04             	add    $0x4,%esp
+  8032e4:	ff 75 f0             	push   -0x10(%ebp)
+  8032e7:	e8 1f e0 ff ff       	call   80130b <fd2num>
+  8032ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032ef:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032f2:	83 c4 10             	add    $0x10,%esp
+  8032f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032fa:	eb 2e                	jmp    80332a <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032fc:	83 ec 08             	sub    $0x8,%esp
+  8032ff:	56                   	push   %esi
+  803300:	6a 00                	push   $0x0
+  803302:	e8 26 dc ff ff       	call   800f2d <sys_page_unmap>
+  803307:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80330a:	83 ec 08             	sub    $0x8,%esp
+  80330d:	ff 75 f0             	push   -0x10(%ebp)
+  803310:	6a 00                	push   $0x0
+  803312:	e8 16 dc ff ff       	call   800f2d <sys_page_unmap>
+  803317:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80331a:	83 ec 08             	sub    $0x8,%esp
+  80331d:	ff 75 f4             	push   -0xc(%ebp)
+  803320:	6a 00                	push   $0x0
+  803322:	e8 06 dc ff ff       	call   800f2d <sys_page_unmap>
+  803327:	83 c4 10             	add    $0x10,%esp
+}
+  80332a:	89 d8                	mov    %ebx,%eax
+  80332c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80332f:	5b                   	pop    %ebx
+  803330:	5e                   	pop    %esi
+  803331:	5d                   	pop    %ebp
+  803332:	c3                   	ret
+
+00803333 <pipeisclosed>:
+{
+  803333:	55                   	push   %ebp
+  803334:	89 e5                	mov    %esp,%ebp
+  803336:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803339:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80333c:	50                   	push   %eax
+  80333d:	ff 75 08             	push   0x8(%ebp)
+  803340:	e8 3d e0 ff ff       	call   801382 <fd_lookup>
+  803345:	83 c4 10             	add    $0x10,%esp
+  803348:	85 c0                	test   %eax,%eax
+  80334a:	78 18                	js     803364 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80334c:	83 ec 0c             	sub    $0xc,%esp
+  80334f:	ff 75 f4             	push   -0xc(%ebp)
+  803352:	e8 c4 df ff ff       	call   80131b <fd2data>
+  803357:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335c:	e8 e6 f9 ff ff       	call   802d47 <_pipeisclosed>
+  803361:	83 c4 10             	add    $0x10,%esp
+}
+  803364:	c9                   	leave
+  803365:	c3                   	ret
+
+00803366 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803366:	55                   	push   %ebp
+  803367:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803369:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803372:	5d                   	pop    %ebp
+  803373:	c3                   	ret
+
+00803374 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	53                   	push   %ebx
+  803378:	83 ec 04             	sub    $0x4,%esp
+  80337b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80337e:	8b 03                	mov    (%ebx),%eax
+  803380:	85 c0                	test   %eax,%eax
+  803382:	75 05                	jne    803389 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803384:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803387:	c9                   	leave
+  803388:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803389:	83 ec 08             	sub    $0x8,%esp
+  80338c:	50                   	push   %eax
+  80338d:	8d 43 04             	lea    0x4(%ebx),%eax
+  803390:	50                   	push   %eax
+  803391:	e8 e7 dd ff ff       	call   80117d <sys_page_batch>
+	pb->pb_n = 0;
+  803396:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80339c:	83 c4 10             	add    $0x10,%esp
+  80339f:	eb e3                	jmp    803384 <pgbatch_flush+0x10>
+
+008033a1 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8033a1:	55                   	push   %ebp
+  8033a2:	89 e5                	mov    %esp,%ebp
+  8033a4:	56                   	push   %esi
+  8033a5:	53                   	push   %ebx
+  8033a6:	89 c3                	mov    %eax,%ebx
+  8033a8:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033aa:	83 38 20             	cmpl   $0x20,(%eax)
+  8033ad:	74 2c                	je     8033db <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8033af:	8b 03                	mov    (%ebx),%eax
+  8033b1:	8d 50 01             	lea    0x1(%eax),%edx
+  8033b4:	89 13                	mov    %edx,(%ebx)
+  8033b6:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8033b9:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8033bd:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8033bf:	83 ec 04             	sub    $0x4,%esp
+  8033c2:	6a 18                	push   $0x18
+  8033c4:	6a 00                	push   $0x0
+  8033c6:	50                   	push   %eax
+  8033c7:	e8 23 d8 ff ff       	call   800bef <memset>
+	return 0;
+  8033cc:	83 c4 10             	add    $0x10,%esp
+  8033cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d7:	5b                   	pop    %ebx
+  8033d8:	5e                   	pop    %esi
+  8033d9:	5d                   	pop    %ebp
+  8033da:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033db:	83 ec 0c             	sub    $0xc,%esp
+  8033de:	50                   	push   %eax
+  8033df:	e8 90 ff ff ff       	call   803374 <pgbatch_flush>
+  8033e4:	83 c4 10             	add    $0x10,%esp
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	79 c4                	jns    8033af <pgbatch_slot+0xe>
+  8033eb:	eb e7                	jmp    8033d4 <pgbatch_slot+0x33>
+
+008033ed <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033ed:	55                   	push   %ebp
+  8033ee:	89 e5                	mov    %esp,%ebp
+  8033f0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033f3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f9:	e8 a3 ff ff ff       	call   8033a1 <pgbatch_slot>
+  8033fe:	85 c0                	test   %eax,%eax
+  803400:	78 20                	js     803422 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803402:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803405:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80340b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80340e:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803411:	8b 55 10             	mov    0x10(%ebp),%edx
+  803414:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803417:	8b 55 14             	mov    0x14(%ebp),%edx
+  80341a:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80341d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803422:	c9                   	leave
+  803423:	c3                   	ret
+
+00803424 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80342a:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80342d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803430:	e8 6c ff ff ff       	call   8033a1 <pgbatch_slot>
+  803435:	85 c0                	test   %eax,%eax
+  803437:	78 2c                	js     803465 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80343c:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803442:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803445:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803448:	8b 55 10             	mov    0x10(%ebp),%edx
+  80344b:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80344e:	8b 55 14             	mov    0x14(%ebp),%edx
+  803451:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803454:	8b 55 18             	mov    0x18(%ebp),%edx
+  803457:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80345a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80345d:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803465:	c9                   	leave
+  803466:	c3                   	ret
+
+00803467 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803467:	55                   	push   %ebp
+  803468:	89 e5                	mov    %esp,%ebp
+  80346a:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80346d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803470:	8b 45 08             	mov    0x8(%ebp),%eax
+  803473:	e8 29 ff ff ff       	call   8033a1 <pgbatch_slot>
+  803478:	85 c0                	test   %eax,%eax
+  80347a:	78 1a                	js     803496 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80347c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347f:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803485:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803488:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80348b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80348e:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803491:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803496:	c9                   	leave
+  803497:	c3                   	ret
+
+00803498 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803498:	55                   	push   %ebp
+  803499:	89 e5                	mov    %esp,%ebp
+  80349b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80349e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034a4:	e8 f8 fe ff ff       	call   8033a1 <pgbatch_slot>
+  8034a9:	85 c0                	test   %eax,%eax
+  8034ab:	78 20                	js     8034cd <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8034ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034b0:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8034b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034b9:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034bc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034bf:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034c2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034c5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034cd:	c9                   	leave
+  8034ce:	c3                   	ret
+
+008034cf <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8034cf:	55                   	push   %ebp
+  8034d0:	89 e5                	mov    %esp,%ebp
+  8034d2:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034d5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034db:	e8 c1 fe ff ff       	call   8033a1 <pgbatch_slot>
+  8034e0:	85 c0                	test   %eax,%eax
+  8034e2:	78 26                	js     80350a <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8034e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034e7:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8034ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034f0:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8034f3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034f6:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8034f9:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034fc:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8034ff:	8b 55 18             	mov    0x18(%ebp),%edx
+  803502:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803505:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80350a:	c9                   	leave
+  80350b:	c3                   	ret
+
+0080350c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80350c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803511:	c3                   	ret
+
+00803512 <devcons_poll>:
+{
+  803512:	55                   	push   %ebp
+  803513:	89 e5                	mov    %esp,%ebp
+  803515:	53                   	push   %ebx
+  803516:	83 ec 04             	sub    $0x4,%esp
+  803519:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80351c:	89 da                	mov    %ebx,%edx
+  80351e:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803521:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803528:	74 0c                	je     803536 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80352a:	89 d8                	mov    %ebx,%eax
+  80352c:	83 e0 01             	and    $0x1,%eax
+  80352f:	09 d0                	or     %edx,%eax
+}
+  803531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803534:	c9                   	leave
+  803535:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803536:	e8 cf d8 ff ff       	call   800e0a <sys_cgetc>
+  80353b:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803540:	89 da                	mov    %ebx,%edx
+  803542:	83 e2 04             	and    $0x4,%edx
+  803545:	85 c0                	test   %eax,%eax
+  803547:	74 e6                	je     80352f <devcons_poll+0x1d>
+  803549:	eb df                	jmp    80352a <devcons_poll+0x18>
+
+0080354b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80354b:	55                   	push   %ebp
+  80354c:	89 e5                	mov    %esp,%ebp
+  80354e:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803551:	68 7e 45 80 00       	push   $0x80457e
+  803556:	ff 75 0c             	push   0xc(%ebp)
+  803559:	e8 16 d5 ff ff       	call   800a74 <strcpy>
+	return 0;
+}
+  80355e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803563:	c9                   	leave
+  803564:	c3                   	ret
+
+00803565 <devcons_write>:
+{
+  803565:	55                   	push   %ebp
+  803566:	89 e5                	mov    %esp,%ebp
+  803568:	57                   	push   %edi
+  803569:	56                   	push   %esi
+  80356a:	53                   	push   %ebx
+  80356b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803571:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803574:	85 ff                	test   %edi,%edi
+  803576:	74 51                	je     8035c9 <devcons_write+0x64>
+  803578:	be 00 00 00 00       	mov    $0x0,%esi
+  80357d:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803582:	89 fb                	mov    %edi,%ebx
+  803584:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803586:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  80358b:	39 d3                	cmp    %edx,%ebx
+  80358d:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803590:	83 ec 04             	sub    $0x4,%esp
+  803593:	53                   	push   %ebx
+  803594:	03 45 0c             	add    0xc(%ebp),%eax
+  803597:	50                   	push   %eax
+  803598:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80359e:	50                   	push   %eax
+  80359f:	e8 80 d6 ff ff       	call   800c24 <memmove>
+		sys_cputs(buf, m);
+  8035a4:	83 c4 08             	add    $0x8,%esp
+  8035a7:	53                   	push   %ebx
+  8035a8:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8035ae:	50                   	push   %eax
+  8035af:	e8 38 d8 ff ff       	call   800dec <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8035b4:	01 de                	add    %ebx,%esi
+  8035b6:	89 f0                	mov    %esi,%eax
+  8035b8:	83 c4 10             	add    $0x10,%esp
+  8035bb:	39 fe                	cmp    %edi,%esi
+  8035bd:	72 c3                	jb     803582 <devcons_write+0x1d>
+}
+  8035bf:	89 f0                	mov    %esi,%eax
+  8035c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035c4:	5b                   	pop    %ebx
+  8035c5:	5e                   	pop    %esi
+  8035c6:	5f                   	pop    %edi
+  8035c7:	5d                   	pop    %ebp
+  8035c8:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8035c9:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8035ce:	eb ef                	jmp    8035bf <devcons_write+0x5a>
+
+008035d0 <devcons_read>:
+{
+  8035d0:	55                   	push   %ebp
+  8035d1:	89 e5                	mov    %esp,%ebp
+  8035d3:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8035d6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8035db:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035df:	74 36                	je     803617 <devcons_read+0x47>
+	c = cons_peek;
+  8035e1:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8035e6:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8035ed:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035f0:	85 c0                	test   %eax,%eax
+  8035f2:	75 10                	jne    803604 <devcons_read+0x34>
+  8035f4:	e8 11 d8 ff ff       	call   800e0a <sys_cgetc>
+  8035f9:	85 c0                	test   %eax,%eax
+  8035fb:	75 07                	jne    803604 <devcons_read+0x34>
+		sys_yield();
+  8035fd:	e8 87 d8 ff ff       	call   800e89 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  803602:	eb f0                	jmp    8035f4 <devcons_read+0x24>
+	if (c < 0)
+  803604:	85 c0                	test   %eax,%eax
+  803606:	78 0f                	js     803617 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803608:	83 f8 04             	cmp    $0x4,%eax
+  80360b:	74 0c                	je     803619 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80360d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803610:	88 02                	mov    %al,(%edx)
+	return 1;
+  803612:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803617:	c9                   	leave
+  803618:	c3                   	ret
+		return 0;
+  803619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80361e:	eb f7                	jmp    803617 <devcons_read+0x47>
+
+00803620 <cputchar>:
+{
+  803620:	55                   	push   %ebp
+  803621:	89 e5                	mov    %esp,%ebp
+  803623:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803626:	8b 45 08             	mov    0x8(%ebp),%eax
+  803629:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80362c:	6a 01                	push   $0x1
+  80362e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803631:	50                   	push   %eax
+  803632:	e8 b5 d7 ff ff       	call   800dec <sys_cputs>
+}
+  803637:	83 c4 10             	add    $0x10,%esp
+  80363a:	c9                   	leave
+  80363b:	c3                   	ret
+
+0080363c <getchar>:
+{
+  80363c:	55                   	push   %ebp
+  80363d:	89 e5                	mov    %esp,%ebp
+  80363f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803642:	6a 01                	push   $0x1
+  803644:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803647:	50                   	push   %eax
+  803648:	6a 00                	push   $0x0
+  80364a:	e8 b7 df ff ff       	call   801606 <read>
+	if (r < 0)
+  80364f:	83 c4 10             	add    $0x10,%esp
+  803652:	85 c0                	test   %eax,%eax
+  803654:	78 06                	js     80365c <getchar+0x20>
+	if (r < 1)
+  803656:	74 06                	je     80365e <getchar+0x22>
+	return c;
+  803658:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80365c:	c9                   	leave
+  80365d:	c3                   	ret
+		return -E_EOF;
+  80365e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803663:	eb f7                	jmp    80365c <getchar+0x20>
+
+00803665 <iscons>:
+{
+  803665:	55                   	push   %ebp
+  803666:	89 e5                	mov    %esp,%ebp
+  803668:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80366b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80366e:	50                   	push   %eax
+  80366f:	ff 75 08             	push   0x8(%ebp)
+  803672:	e8 0b dd ff ff       	call   801382 <fd_lookup>
+  803677:	83 c4 10             	add    $0x10,%esp
+  80367a:	85 c0                	test   %eax,%eax
+  80367c:	78 11                	js     80368f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80367e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803681:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803687:	39 10                	cmp    %edx,(%eax)
+  803689:	0f 94 c0             	sete   %al
+  80368c:	0f b6 c0             	movzbl %al,%eax
+}
+  80368f:	c9                   	leave
+  803690:	c3                   	ret
+
+00803691 <opencons>:
+{
+  803691:	55                   	push   %ebp
+  803692:	89 e5                	mov    %esp,%ebp
+  803694:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803697:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80369a:	50                   	push   %eax
+  80369b:	e8 92 dc ff ff       	call   801332 <fd_alloc>
+  8036a0:	83 c4 10             	add    $0x10,%esp
+  8036a3:	85 c0                	test   %eax,%eax
+  8036a5:	78 3a                	js     8036e1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8036a7:	83 ec 04             	sub    $0x4,%esp
+  8036aa:	68 07 04 00 00       	push   $0x407
+  8036af:	ff 75 f4             	push   -0xc(%ebp)
+  8036b2:	6a 00                	push   $0x0
+  8036b4:	e8 ef d7 ff ff       	call   800ea8 <sys_page_alloc>
+  8036b9:	83 c4 10             	add    $0x10,%esp
+  8036bc:	85 c0                	test   %eax,%eax
+  8036be:	78 21                	js     8036e1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8036c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036c3:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036c9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8036cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036ce:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8036d5:	83 ec 0c             	sub    $0xc,%esp
+  8036d8:	50                   	push   %eax
+  8036d9:	e8 2d dc ff ff       	call   80130b <fd2num>
+  8036de:	83 c4 10             	add    $0x10,%esp
+}
+  8036e1:	c9                   	leave
+  8036e2:	c3                   	ret
+
+008036e3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036e3:	55                   	push   %ebp
+  8036e4:	89 e5                	mov    %esp,%ebp
+  8036e6:	56                   	push   %esi
+  8036e7:	53                   	push   %ebx
+  8036e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036f8:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8036fb:	83 ec 0c             	sub    $0xc,%esp
+  8036fe:	50                   	push   %eax
+  8036ff:	e8 54 d9 ff ff       	call   801058 <sys_ipc_recv>
+  803704:	83 c4 10             	add    $0x10,%esp
+  803707:	85 c0                	test   %eax,%eax
+  803709:	0f 88 8b 00 00 00    	js     80379a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80370f:	85 f6                	test   %esi,%esi
+  803711:	74 2a                	je     80373d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803713:	89 e2                	mov    %esp,%edx
+  803715:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80371a:	29 d0                	sub    %edx,%eax
+  80371c:	89 c2                	mov    %eax,%edx
+  80371e:	c1 ea 0f             	shr    $0xf,%edx
+  803721:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80372e:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803735:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80373b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80373d:	85 db                	test   %ebx,%ebx
+  80373f:	74 2a                	je     80376b <ipc_recv+0x88>
+  803741:	89 e2                	mov    %esp,%edx
+  803743:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803748:	29 d0                	sub    %edx,%eax
+  80374a:	89 c2                	mov    %eax,%edx
+  80374c:	c1 ea 0f             	shr    $0xf,%edx
+  80374f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803754:	b8 00 00 00 00       	mov    $0x0,%eax
+  803759:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80375c:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803763:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803769:	89 03                	mov    %eax,(%ebx)
+  80376b:	89 e2                	mov    %esp,%edx
+  80376d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803772:	29 d0                	sub    %edx,%eax
+  803774:	89 c2                	mov    %eax,%edx
+  803776:	c1 ea 0f             	shr    $0xf,%edx
+  803779:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80377e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803783:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803786:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80378d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803793:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803796:	5b                   	pop    %ebx
+  803797:	5e                   	pop    %esi
+  803798:	5d                   	pop    %ebp
+  803799:	c3                   	ret
+		if(from_env_store != NULL)
+  80379a:	85 f6                	test   %esi,%esi
+  80379c:	74 06                	je     8037a4 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80379e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8037a4:	85 db                	test   %ebx,%ebx
+  8037a6:	74 eb                	je     803793 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8037a8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037ae:	eb e3                	jmp    803793 <ipc_recv+0xb0>
+
+008037b0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8037b0:	55                   	push   %ebp
+  8037b1:	89 e5                	mov    %esp,%ebp
+  8037b3:	57                   	push   %edi
+  8037b4:	56                   	push   %esi
+  8037b5:	53                   	push   %ebx
+  8037b6:	83 ec 14             	sub    $0x14,%esp
+  8037b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037bf:	8b 75 14             	mov    0x14(%ebp),%esi
+  8037c2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8037c5:	85 c0                	test   %eax,%eax
+  8037c7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037cc:	0f 44 c2             	cmove  %edx,%eax
+  8037cf:	ff 75 10             	push   0x10(%ebp)
+  8037d2:	50                   	push   %eax
+  8037d3:	e8 e2 d8 ff ff       	call   8010ba <sys_ipc_recv_pages>
+  8037d8:	83 c4 10             	add    $0x10,%esp
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	0f 88 ba 00 00 00    	js     80389d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8037e3:	85 ff                	test   %edi,%edi
+  8037e5:	74 2a                	je     803811 <ipc_recv_pages+0x61>
+  8037e7:	89 e2                	mov    %esp,%edx
+  8037e9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037ee:	29 d0                	sub    %edx,%eax
+  8037f0:	89 c2                	mov    %eax,%edx
+  8037f2:	c1 ea 0f             	shr    $0xf,%edx
+  8037f5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ff:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803802:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803809:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80380f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803811:	85 f6                	test   %esi,%esi
+  803813:	74 2a                	je     80383f <ipc_recv_pages+0x8f>
+  803815:	89 e2                	mov    %esp,%edx
+  803817:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80381c:	29 d0                	sub    %edx,%eax
+  80381e:	89 c2                	mov    %eax,%edx
+  803820:	c1 ea 0f             	shr    $0xf,%edx
+  803823:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80382d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803830:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803837:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80383d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80383f:	85 db                	test   %ebx,%ebx
+  803841:	74 2a                	je     80386d <ipc_recv_pages+0xbd>
+  803843:	89 e2                	mov    %esp,%edx
+  803845:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80384a:	29 d0                	sub    %edx,%eax
+  80384c:	89 c2                	mov    %eax,%edx
+  80384e:	c1 ea 0f             	shr    $0xf,%edx
+  803851:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80385e:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  803865:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80386b:	89 03                	mov    %eax,(%ebx)
+  80386d:	89 e2                	mov    %esp,%edx
+  80386f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803874:	29 d0                	sub    %edx,%eax
+  803876:	89 c2                	mov    %eax,%edx
+  803878:	c1 ea 0f             	shr    $0xf,%edx
+  80387b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803880:	b8 00 00 00 00       	mov    $0x0,%eax
+  803885:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803888:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  80388f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803898:	5b                   	pop    %ebx
+  803899:	5e                   	pop    %esi
+  80389a:	5f                   	pop    %edi
+  80389b:	5d                   	pop    %ebp
+  80389c:	c3                   	ret
+		if (from_env_store)
+  80389d:	85 ff                	test   %edi,%edi
+  80389f:	74 06                	je     8038a7 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8038a1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8038a7:	85 f6                	test   %esi,%esi
+  8038a9:	74 06                	je     8038b1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8038ab:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8038b1:	85 db                	test   %ebx,%ebx
+  8038b3:	74 e0                	je     803895 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8038b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038bb:	eb d8                	jmp    803895 <ipc_recv_pages+0xe5>
+
+008038bd <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8038bd:	55                   	push   %ebp
+  8038be:	89 e5                	mov    %esp,%ebp
+  8038c0:	57                   	push   %edi
+  8038c1:	56                   	push   %esi
+  8038c2:	53                   	push   %ebx
+  8038c3:	83 ec 1c             	sub    $0x1c,%esp
+  8038c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8038c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038cc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038d2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038d6:	75 2b                	jne    803903 <ipc_try_send_pages+0x46>
+  8038d8:	89 e2                	mov    %esp,%edx
+  8038da:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038df:	29 d0                	sub    %edx,%eax
+  8038e1:	89 c2                	mov    %eax,%edx
+  8038e3:	c1 ea 0f             	shr    $0xf,%edx
+  8038e6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f0:	0f 42 c2             	cmovb  %edx,%eax
+  8038f3:	8b 04 85 60 63 80 00 	mov    0x806360(,%eax,4),%eax
+  8038fa:	8b 70 48             	mov    0x48(%eax),%esi
+  8038fd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803903:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803909:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80390e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803911:	85 ff                	test   %edi,%edi
+  803913:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803918:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80391b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803921:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803927:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80392d:	83 ec 0c             	sub    $0xc,%esp
+  803930:	ff 75 14             	push   0x14(%ebp)
+  803933:	ff 75 18             	push   0x18(%ebp)
+  803936:	57                   	push   %edi
+  803937:	ff 75 0c             	push   0xc(%ebp)
+  80393a:	ff 75 08             	push   0x8(%ebp)
+  80393d:	e8 57 d7 ff ff       	call   801099 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803942:	83 c4 20             	add    $0x20,%esp
+  803945:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803948:	75 21                	jne    80396b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80394a:	83 ec 04             	sub    $0x4,%esp
+  80394d:	6a ff                	push   $0xffffffff
+  80394f:	53                   	push   %ebx
+  803950:	ff 75 e4             	push   -0x1c(%ebp)
+  803953:	e8 4e d9 ff ff       	call   8012a6 <sys_futex_wait>
+  803958:	83 c4 10             	add    $0x10,%esp
+  80395b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80395e:	74 c7                	je     803927 <ipc_try_send_pages+0x6a>
+  803960:	85 c0                	test   %eax,%eax
+  803962:	79 c3                	jns    803927 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803964:	e8 20 d5 ff ff       	call   800e89 <sys_yield>
+  803969:	eb bc                	jmp    803927 <ipc_try_send_pages+0x6a>
+	}
+}
+  80396b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80396e:	5b                   	pop    %ebx
+  80396f:	5e                   	pop    %esi
+  803970:	5f                   	pop    %edi
+  803971:	5d                   	pop    %ebp
+  803972:	c3                   	ret
+
+00803973 <ipc_send>:
+{
+  803973:	55                   	push   %ebp
+  803974:	89 e5                	mov    %esp,%ebp
+  803976:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803979:	ff 75 14             	push   0x14(%ebp)
+  80397c:	6a 01                	push   $0x1
+  80397e:	ff 75 10             	push   0x10(%ebp)
+  803981:	ff 75 0c             	push   0xc(%ebp)
+  803984:	ff 75 08             	push   0x8(%ebp)
+  803987:	e8 31 ff ff ff       	call   8038bd <ipc_try_send_pages>
+  80398c:	83 c4 20             	add    $0x20,%esp
+  80398f:	85 c0                	test   %eax,%eax
+  803991:	78 02                	js     803995 <ipc_send+0x22>
+}
+  803993:	c9                   	leave
+  803994:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803995:	50                   	push   %eax
+  803996:	68 8a 45 80 00       	push   $0x80458a
+  80399b:	6a 3f                	push   $0x3f
+  80399d:	68 9f 45 80 00       	push   $0x80459f
+  8039a2:	e8 fb c8 ff ff       	call   8002a2 <_panic>
+
+008039a7 <ipc_send_pages>:
+{
+  8039a7:	55                   	push   %ebp
+  8039a8:	89 e5                	mov    %esp,%ebp
+  8039aa:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8039ad:	ff 75 18             	push   0x18(%ebp)
+  8039b0:	ff 75 14             	push   0x14(%ebp)
+  8039b3:	ff 75 10             	push   0x10(%ebp)
+  8039b6:	ff 75 0c             	push   0xc(%ebp)
+  8039b9:	ff 75 08             	push   0x8(%ebp)
+  8039bc:	e8 fc fe ff ff       	call   8038bd <ipc_try_send_pages>
+  8039c1:	83 c4 20             	add    $0x20,%esp
+  8039c4:	85 c0                	test   %eax,%eax
+  8039c6:	78 02                	js     8039ca <ipc_send_pages+0x23>
+}
+  8039c8:	c9                   	leave
+  8039c9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8039ca:	50                   	push   %eax
+  8039cb:	68 a9 45 80 00       	push   $0x8045a9
+  8039d0:	6a 64                	push   $0x64
+  8039d2:	68 9f 45 80 00       	push   $0x80459f
+  8039d7:	e8 c6 c8 ff ff       	call   8002a2 <_panic>
+
+008039dc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039dc:	55                   	push   %ebp
+  8039dd:	89 e5                	mov    %esp,%ebp
+  8039df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8039e2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8039e7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8039ed:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039f3:	8b 52 50             	mov    0x50(%edx),%edx
+  8039f6:	39 ca                	cmp    %ecx,%edx
+  8039f8:	74 11                	je     803a0b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8039fa:	83 c0 01             	add    $0x1,%eax
+  8039fd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803a02:	75 e3                	jne    8039e7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803a04:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a09:	eb 0e                	jmp    803a19 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803a0b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803a11:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a16:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a19:	5d                   	pop    %ebp
+  803a1a:	c3                   	ret
+
+00803a1b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a1b:	55                   	push   %ebp
+  803a1c:	89 e5                	mov    %esp,%ebp
+  803a1e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a21:	89 c2                	mov    %eax,%edx
+  803a23:	c1 ea 16             	shr    $0x16,%edx
+  803a26:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a2d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a32:	f6 c1 01             	test   $0x1,%cl
+  803a35:	74 1e                	je     803a55 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a37:	c1 e8 0c             	shr    $0xc,%eax
+  803a3a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a41:	a8 01                	test   $0x1,%al
+  803a43:	74 10                	je     803a55 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a45:	c1 e8 0c             	shr    $0xc,%eax
+  803a48:	c1 e0 04             	shl    $0x4,%eax
+  803a4b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a52:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a55:	89 d0                	mov    %edx,%eax
+  803a57:	5d                   	pop    %ebp
+  803a58:	c3                   	ret
+
+00803a59 <inet_ntoa>:
+ * @return pointer to a global static (!) buffer that holds the ASCII
+ *         represenation of addr
+ */
+char *
+inet_ntoa(struct in_addr addr)
+{
+  803a59:	55                   	push   %ebp
+  803a5a:	89 e5                	mov    %esp,%ebp
+  803a5c:	57                   	push   %edi
+  803a5d:	56                   	push   %esi
+  803a5e:	53                   	push   %ebx
+  803a5f:	83 ec 1c             	sub    $0x1c,%esp
+  static char str[16];
+  u32_t s_addr = addr.s_addr;
+  803a62:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a65:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  u8_t rem;
+  u8_t n;
+  u8_t i;
+
+  rp = str;
+  ap = (u8_t *)&s_addr;
+  803a68:	8d 75 f0             	lea    -0x10(%ebp),%esi
+  rp = str;
+  803a6b:	bf 38 63 80 00       	mov    $0x806338,%edi
+  803a70:	0f b6 16             	movzbl (%esi),%edx
+  for(n = 0; n < 4; n++) {
+    i = 0;
+  803a73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803a78:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803a7b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+    do {
+      rem = *ap % (u8_t)10;
+  803a7e:	b8 cd ff ff ff       	mov    $0xffffffcd,%eax
+  803a83:	f6 e2                	mul    %dl
+  803a85:	66 c1 e8 0b          	shr    $0xb,%ax
+  803a89:	89 c7                	mov    %eax,%edi
+  803a8b:	88 45 e0             	mov    %al,-0x20(%ebp)
+  803a8e:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803a91:	01 db                	add    %ebx,%ebx
+  803a93:	89 d0                	mov    %edx,%eax
+  803a95:	29 d8                	sub    %ebx,%eax
+      *ap /= (u8_t)10;
+  803a97:	89 d6                	mov    %edx,%esi
+  803a99:	89 fa                	mov    %edi,%edx
+      inv[i++] = '0' + rem;
+  803a9b:	89 cb                	mov    %ecx,%ebx
+  803a9d:	83 c1 01             	add    $0x1,%ecx
+  803aa0:	0f b6 fb             	movzbl %bl,%edi
+  803aa3:	83 c0 30             	add    $0x30,%eax
+  803aa6:	88 44 3d ed          	mov    %al,-0x13(%ebp,%edi,1)
+    } while(*ap);
+  803aaa:	89 f0                	mov    %esi,%eax
+  803aac:	3c 09                	cmp    $0x9,%al
+  803aae:	77 ce                	ja     803a7e <inet_ntoa+0x25>
+  803ab0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803ab3:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  803ab6:	88 16                	mov    %dl,(%esi)
+    while(i--)
+  803ab8:	84 c9                	test   %cl,%cl
+  803aba:	74 4d                	je     803b09 <inet_ntoa+0xb0>
+  803abc:	0f b6 db             	movzbl %bl,%ebx
+  803abf:	8d 45 ed             	lea    -0x13(%ebp),%eax
+  803ac2:	01 d8                	add    %ebx,%eax
+  803ac4:	89 f9                	mov    %edi,%ecx
+  803ac6:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+      *rp++ = inv[i];
+  803ac9:	83 c1 01             	add    $0x1,%ecx
+  803acc:	0f b6 10             	movzbl (%eax),%edx
+  803acf:	88 51 ff             	mov    %dl,-0x1(%ecx)
+    while(i--)
+  803ad2:	89 c2                	mov    %eax,%edx
+  803ad4:	83 e8 01             	sub    $0x1,%eax
+  803ad7:	8d 5d ed             	lea    -0x13(%ebp),%ebx
+  803ada:	39 da                	cmp    %ebx,%edx
+  803adc:	75 eb                	jne    803ac9 <inet_ntoa+0x70>
+      *rp++ = inv[i];
+  803ade:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803ae1:	8d 44 1f 01          	lea    0x1(%edi,%ebx,1),%eax
+    *rp++ = '.';
+  803ae5:	8d 78 01             	lea    0x1(%eax),%edi
+  803ae8:	c6 00 2e             	movb   $0x2e,(%eax)
+    ap++;
+  803aeb:	83 c6 01             	add    $0x1,%esi
+  for(n = 0; n < 4; n++) {
+  803aee:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  803af1:	39 ce                	cmp    %ecx,%esi
+  803af3:	0f 85 77 ff ff ff    	jne    803a70 <inet_ntoa+0x17>
+  }
+  *--rp = 0;
+  803af9:	c6 00 00             	movb   $0x0,(%eax)
+  return str;
+}
+  803afc:	b8 38 63 80 00       	mov    $0x806338,%eax
+  803b01:	83 c4 1c             	add    $0x1c,%esp
+  803b04:	5b                   	pop    %ebx
+  803b05:	5e                   	pop    %esi
+  803b06:	5f                   	pop    %edi
+  803b07:	5d                   	pop    %ebp
+  803b08:	c3                   	ret
+    while(i--)
+  803b09:	89 f8                	mov    %edi,%eax
+  803b0b:	eb d8                	jmp    803ae5 <inet_ntoa+0x8c>
+
+00803b0d <htons>:
+ * @param n u16_t in host byte order
+ * @return n in network byte order
+ */
+u16_t
+htons(u16_t n)
+{
+  803b0d:	55                   	push   %ebp
+  803b0e:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803b10:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803b14:	66 c1 c0 08          	rol    $0x8,%ax
+}
+  803b18:	5d                   	pop    %ebp
+  803b19:	c3                   	ret
+
+00803b1a <ntohs>:
+ * @param n u16_t in network byte order
+ * @return n in host byte order
+ */
+u16_t
+ntohs(u16_t n)
+{
+  803b1a:	55                   	push   %ebp
+  803b1b:	89 e5                	mov    %esp,%ebp
+  return ((n & 0xff) << 8) | ((n & 0xff00) >> 8);
+  803b1d:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  803b21:	66 c1 c0 08          	rol    $0x8,%ax
+  return htons(n);
+}
+  803b25:	5d                   	pop    %ebp
+  803b26:	c3                   	ret
+
+00803b27 <htonl>:
+ * @param n u32_t in host byte order
+ * @return n in network byte order
+ */
+u32_t
+htonl(u32_t n)
+{
+  803b27:	55                   	push   %ebp
+  803b28:	89 e5                	mov    %esp,%ebp
+  803b2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  return ((n & 0xff) << 24) |
+  803b2d:	89 d0                	mov    %edx,%eax
+  803b2f:	c1 e0 18             	shl    $0x18,%eax
+    ((n & 0xff00) << 8) |
+    ((n & 0xff0000UL) >> 8) |
+    ((n & 0xff000000UL) >> 24);
+  803b32:	89 d1                	mov    %edx,%ecx
+  803b34:	c1 e9 18             	shr    $0x18,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803b37:	09 c8                	or     %ecx,%eax
+    ((n & 0xff00) << 8) |
+  803b39:	89 d1                	mov    %edx,%ecx
+  803b3b:	c1 e1 08             	shl    $0x8,%ecx
+  803b3e:	81 e1 00 00 ff 00    	and    $0xff0000,%ecx
+    ((n & 0xff0000UL) >> 8) |
+  803b44:	09 c8                	or     %ecx,%eax
+  803b46:	c1 ea 08             	shr    $0x8,%edx
+  803b49:	81 e2 00 ff 00 00    	and    $0xff00,%edx
+  803b4f:	09 d0                	or     %edx,%eax
+}
+  803b51:	5d                   	pop    %ebp
+  803b52:	c3                   	ret
+
+00803b53 <inet_aton>:
+{
+  803b53:	55                   	push   %ebp
+  803b54:	89 e5                	mov    %esp,%ebp
+  803b56:	57                   	push   %edi
+  803b57:	56                   	push   %esi
+  803b58:	53                   	push   %ebx
+  803b59:	83 ec 2c             	sub    $0x2c,%esp
+  803b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  c = *cp;
+  803b5f:	0f b6 0a             	movzbl (%edx),%ecx
+  803b62:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803b65:	83 e9 30             	sub    $0x30,%ecx
+  803b68:	80 f9 09             	cmp    $0x9,%cl
+  803b6b:	0f 87 b6 01 00 00    	ja     803d27 <inet_aton+0x1d4>
+  u32_t *pp = parts;
+  803b71:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+      if (pp >= parts + 3)
+  803b74:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  803b77:	e9 aa 00 00 00       	jmp    803c26 <inet_aton+0xd3>
+      c = *++cp;
+  803b7c:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+      if (c == 'x' || c == 'X') {
+  803b80:	89 c1                	mov    %eax,%ecx
+  803b82:	83 e1 df             	and    $0xffffffdf,%ecx
+  803b85:	80 f9 58             	cmp    $0x58,%cl
+  803b88:	74 10                	je     803b9a <inet_aton+0x47>
+      c = *++cp;
+  803b8a:	83 c2 01             	add    $0x1,%edx
+  803b8d:	0f be c0             	movsbl %al,%eax
+        base = 8;
+  803b90:	bf 08 00 00 00       	mov    $0x8,%edi
+  803b95:	e9 9a 00 00 00       	jmp    803c34 <inet_aton+0xe1>
+        c = *++cp;
+  803b9a:	0f be 42 02          	movsbl 0x2(%edx),%eax
+  803b9e:	8d 52 02             	lea    0x2(%edx),%edx
+        base = 16;
+  803ba1:	bf 10 00 00 00       	mov    $0x10,%edi
+  803ba6:	e9 89 00 00 00       	jmp    803c34 <inet_aton+0xe1>
+        val = (val * base) + (int)(c - '0');
+  803bab:	0f af d7             	imul   %edi,%edx
+  803bae:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+        c = *++cp;
+  803bb2:	0f be 01             	movsbl (%ecx),%eax
+  803bb5:	83 c1 01             	add    $0x1,%ecx
+      if (isdigit(c)) {
+  803bb8:	88 45 d7             	mov    %al,-0x29(%ebp)
+  803bbb:	8d 58 d0             	lea    -0x30(%eax),%ebx
+  803bbe:	80 fb 09             	cmp    $0x9,%bl
+  803bc1:	76 e8                	jbe    803bab <inet_aton+0x58>
+      } else if (base == 16 && isxdigit(c)) {
+  803bc3:	83 ff 10             	cmp    $0x10,%edi
+  803bc6:	75 2e                	jne    803bf6 <inet_aton+0xa3>
+  803bc8:	0f b6 5d d7          	movzbl -0x29(%ebp),%ebx
+  803bcc:	8d 73 9f             	lea    -0x61(%ebx),%esi
+  803bcf:	83 e3 df             	and    $0xffffffdf,%ebx
+  803bd2:	83 eb 41             	sub    $0x41,%ebx
+  803bd5:	80 fb 05             	cmp    $0x5,%bl
+  803bd8:	77 1c                	ja     803bf6 <inet_aton+0xa3>
+        val = (val << 4) | (int)(c + 10 - (islower(c) ? 'a' : 'A'));
+  803bda:	c1 e2 04             	shl    $0x4,%edx
+  803bdd:	83 c0 0a             	add    $0xa,%eax
+  803be0:	89 f3                	mov    %esi,%ebx
+  803be2:	80 fb 1a             	cmp    $0x1a,%bl
+  803be5:	19 db                	sbb    %ebx,%ebx
+  803be7:	83 e3 20             	and    $0x20,%ebx
+  803bea:	83 c3 41             	add    $0x41,%ebx
+  803bed:	29 d8                	sub    %ebx,%eax
+  803bef:	09 c2                	or     %eax,%edx
+        c = *++cp;
+  803bf1:	0f be 01             	movsbl (%ecx),%eax
+  803bf4:	eb bf                	jmp    803bb5 <inet_aton+0x62>
+    if (c == '.') {
+  803bf6:	83 f8 2e             	cmp    $0x2e,%eax
+  803bf9:	75 46                	jne    803c41 <inet_aton+0xee>
+      if (pp >= parts + 3)
+  803bfb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803bfe:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  803c01:	39 f0                	cmp    %esi,%eax
+  803c03:	0f 84 25 01 00 00    	je     803d2e <inet_aton+0x1db>
+      *pp++ = val;
+  803c09:	83 c0 04             	add    $0x4,%eax
+  803c0c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803c0f:	89 50 fc             	mov    %edx,-0x4(%eax)
+      c = *++cp;
+  803c12:	89 ca                	mov    %ecx,%edx
+  803c14:	0f b6 09             	movzbl (%ecx),%ecx
+  803c17:	0f be c1             	movsbl %cl,%eax
+    if (!isdigit(c))
+  803c1a:	83 e9 30             	sub    $0x30,%ecx
+  803c1d:	80 f9 09             	cmp    $0x9,%cl
+  803c20:	0f 87 17 01 00 00    	ja     803d3d <inet_aton+0x1ea>
+    base = 10;
+  803c26:	bf 0a 00 00 00       	mov    $0xa,%edi
+    if (c == '0') {
+  803c2b:	83 f8 30             	cmp    $0x30,%eax
+  803c2e:	0f 84 48 ff ff ff    	je     803b7c <inet_aton+0x29>
+  803c34:	8d 4a 01             	lea    0x1(%edx),%ecx
+        base = 8;
+  803c37:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c3c:	e9 77 ff ff ff       	jmp    803bb8 <inet_aton+0x65>
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c41:	0f b6 7d d7          	movzbl -0x29(%ebp),%edi
+  803c45:	89 d6                	mov    %edx,%esi
+  803c47:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803c4a:	85 c0                	test   %eax,%eax
+  803c4c:	74 2e                	je     803c7c <inet_aton+0x129>
+    return (0);
+  803c4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c53:	89 fa                	mov    %edi,%edx
+  803c55:	80 fa 1f             	cmp    $0x1f,%dl
+  803c58:	0f 86 d5 00 00 00    	jbe    803d33 <inet_aton+0x1e0>
+  803c5e:	84 c0                	test   %al,%al
+  803c60:	0f 88 cd 00 00 00    	js     803d33 <inet_aton+0x1e0>
+  803c66:	8d 48 f7             	lea    -0x9(%eax),%ecx
+  803c69:	83 f9 04             	cmp    $0x4,%ecx
+  803c6c:	76 0e                	jbe    803c7c <inet_aton+0x129>
+    return (0);
+  803c6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  if (c != '\0' && (!isprint(c) || !isspace(c)))
+  803c73:	83 f8 20             	cmp    $0x20,%eax
+  803c76:	0f 85 b7 00 00 00    	jne    803d33 <inet_aton+0x1e0>
+  n = pp - parts + 1;
+  803c7c:	8d 4d d8             	lea    -0x28(%ebp),%ecx
+  803c7f:	89 d8                	mov    %ebx,%eax
+  803c81:	29 c8                	sub    %ecx,%eax
+  803c83:	c1 f8 02             	sar    $0x2,%eax
+  803c86:	8d 48 01             	lea    0x1(%eax),%ecx
+  switch (n) {
+  803c89:	83 f8 02             	cmp    $0x2,%eax
+  803c8c:	74 7a                	je     803d08 <inet_aton+0x1b5>
+  803c8e:	83 f9 03             	cmp    $0x3,%ecx
+  803c91:	7f 49                	jg     803cdc <inet_aton+0x189>
+  803c93:	85 c9                	test   %ecx,%ecx
+  803c95:	0f 84 98 00 00 00    	je     803d33 <inet_aton+0x1e0>
+  803c9b:	83 f9 02             	cmp    $0x2,%ecx
+  803c9e:	75 19                	jne    803cb9 <inet_aton+0x166>
+      return (0);
+  803ca0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffffffUL)
+  803ca5:	81 fe ff ff ff 00    	cmp    $0xffffff,%esi
+  803cab:	0f 87 82 00 00 00    	ja     803d33 <inet_aton+0x1e0>
+    val |= parts[0] << 24;
+  803cb1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803cb4:	c1 e0 18             	shl    $0x18,%eax
+  803cb7:	09 c6                	or     %eax,%esi
+  return (1);
+  803cb9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  if (addr)
+  803cbe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803cc2:	74 6f                	je     803d33 <inet_aton+0x1e0>
+    addr->s_addr = htonl(val);
+  803cc4:	83 ec 0c             	sub    $0xc,%esp
+  803cc7:	56                   	push   %esi
+  803cc8:	e8 5a fe ff ff       	call   803b27 <htonl>
+  803ccd:	83 c4 10             	add    $0x10,%esp
+  803cd0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803cd3:	89 06                	mov    %eax,(%esi)
+  return (1);
+  803cd5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803cda:	eb 57                	jmp    803d33 <inet_aton+0x1e0>
+  switch (n) {
+  803cdc:	83 f9 04             	cmp    $0x4,%ecx
+  803cdf:	75 d8                	jne    803cb9 <inet_aton+0x166>
+      return (0);
+  803ce1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xff)
+  803ce6:	81 fe ff 00 00 00    	cmp    $0xff,%esi
+  803cec:	77 45                	ja     803d33 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16) | (parts[2] << 8);
+  803cee:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803cf1:	c1 e0 18             	shl    $0x18,%eax
+  803cf4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803cf7:	c1 e1 10             	shl    $0x10,%ecx
+  803cfa:	09 c8                	or     %ecx,%eax
+  803cfc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803cff:	c1 e1 08             	shl    $0x8,%ecx
+  803d02:	09 c8                	or     %ecx,%eax
+  803d04:	09 c6                	or     %eax,%esi
+    break;
+  803d06:	eb b1                	jmp    803cb9 <inet_aton+0x166>
+      return (0);
+  803d08:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if (val > 0xffff)
+  803d0d:	81 fe ff ff 00 00    	cmp    $0xffff,%esi
+  803d13:	77 1e                	ja     803d33 <inet_aton+0x1e0>
+    val |= (parts[0] << 24) | (parts[1] << 16);
+  803d15:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803d18:	c1 e0 18             	shl    $0x18,%eax
+  803d1b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803d1e:	c1 e1 10             	shl    $0x10,%ecx
+  803d21:	09 c8                	or     %ecx,%eax
+  803d23:	09 c6                	or     %eax,%esi
+    break;
+  803d25:	eb 92                	jmp    803cb9 <inet_aton+0x166>
+      return (0);
+  803d27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d2c:	eb 05                	jmp    803d33 <inet_aton+0x1e0>
+        return (0);
+  803d2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+  803d33:	89 c8                	mov    %ecx,%eax
+  803d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d38:	5b                   	pop    %ebx
+  803d39:	5e                   	pop    %esi
+  803d3a:	5f                   	pop    %edi
+  803d3b:	5d                   	pop    %ebp
+  803d3c:	c3                   	ret
+      return (0);
+  803d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803d42:	eb ef                	jmp    803d33 <inet_aton+0x1e0>
+
+00803d44 <inet_addr>:
+{
+  803d44:	55                   	push   %ebp
+  803d45:	89 e5                	mov    %esp,%ebp
+  803d47:	83 ec 20             	sub    $0x20,%esp
+  if (inet_aton(cp, &val)) {
+  803d4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803d4d:	50                   	push   %eax
+  803d4e:	ff 75 08             	push   0x8(%ebp)
+  803d51:	e8 fd fd ff ff       	call   803b53 <inet_aton>
+  803d56:	89 c2                	mov    %eax,%edx
+  803d58:	83 c4 10             	add    $0x10,%esp
+  return (INADDR_NONE);
+  803d5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  if (inet_aton(cp, &val)) {
+  803d60:	85 d2                	test   %edx,%edx
+  803d62:	75 02                	jne    803d66 <inet_addr+0x22>
+}
+  803d64:	c9                   	leave
+  803d65:	c3                   	ret
+    return (val.s_addr);
+  803d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d69:	eb f9                	jmp    803d64 <inet_addr+0x20>
+
+00803d6b <ntohl>:
+ * @param n u32_t in network byte order
+ * @return n in host byte order
+ */
+u32_t
+ntohl(u32_t n)
+{
+  803d6b:	55                   	push   %ebp
+  803d6c:	89 e5                	mov    %esp,%ebp
+  803d6e:	83 ec 14             	sub    $0x14,%esp
+  return htonl(n);
+  803d71:	ff 75 08             	push   0x8(%ebp)
+  803d74:	e8 ae fd ff ff       	call   803b27 <htonl>
+  803d79:	83 c4 10             	add    $0x10,%esp
+}
+  803d7c:	c9                   	leave
+  803d7d:	c3                   	ret
+
+00803d7e <__udivdi3>:
+  803d7e:	57                   	push   %edi
+  803d7f:	56                   	push   %esi
+  803d80:	53                   	push   %ebx
+  803d81:	83 ec 20             	sub    $0x20,%esp
+  803d84:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803d88:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803d8c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803d90:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803d94:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d98:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d9c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803da0:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803da4:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dae:	ba 00 00 00 00       	mov    $0x0,%edx
+  803db3:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803dba:	00 
+  803dbb:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803dc2:	00 
+  803dc3:	eb 08                	jmp    803dcd <__udivdi3+0x4f>
+  803dc5:	83 e9 01             	sub    $0x1,%ecx
+  803dc8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803dcb:	74 68                	je     803e35 <__udivdi3+0xb7>
+  803dcd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803dd1:	01 c0                	add    %eax,%eax
+  803dd3:	89 c6                	mov    %eax,%esi
+  803dd5:	89 d7                	mov    %edx,%edi
+  803dd7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803ddb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ddf:	0f ad d0             	shrd   %cl,%edx,%eax
+  803de2:	d3 ea                	shr    %cl,%edx
+  803de4:	f6 c1 20             	test   $0x20,%cl
+  803de7:	74 04                	je     803ded <__udivdi3+0x6f>
+  803de9:	89 d0                	mov    %edx,%eax
+  803deb:	31 d2                	xor    %edx,%edx
+  803ded:	83 e0 01             	and    $0x1,%eax
+  803df0:	89 04 24             	mov    %eax,(%esp)
+  803df3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803dfa:	00 
+  803dfb:	8b 04 24             	mov    (%esp),%eax
+  803dfe:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803e02:	09 f0                	or     %esi,%eax
+  803e04:	09 fa                	or     %edi,%edx
+  803e06:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803e0a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803e0e:	39 f0                	cmp    %esi,%eax
+  803e10:	89 d3                	mov    %edx,%ebx
+  803e12:	19 fb                	sbb    %edi,%ebx
+  803e14:	72 af                	jb     803dc5 <__udivdi3+0x47>
+  803e16:	29 f0                	sub    %esi,%eax
+  803e18:	19 fa                	sbb    %edi,%edx
+  803e1a:	89 cf                	mov    %ecx,%edi
+  803e1c:	c1 ef 05             	shr    $0x5,%edi
+  803e1f:	83 e7 01             	and    $0x1,%edi
+  803e22:	89 fe                	mov    %edi,%esi
+  803e24:	83 f6 01             	xor    $0x1,%esi
+  803e27:	d3 e6                	shl    %cl,%esi
+  803e29:	d3 e7                	shl    %cl,%edi
+  803e2b:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e2f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e33:	eb 90                	jmp    803dc5 <__udivdi3+0x47>
+  803e35:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e39:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e3d:	83 c4 20             	add    $0x20,%esp
+  803e40:	5b                   	pop    %ebx
+  803e41:	5e                   	pop    %esi
+  803e42:	5f                   	pop    %edi
+  803e43:	c3                   	ret
+
+00803e44 <__umoddi3>:
+  803e44:	57                   	push   %edi
+  803e45:	56                   	push   %esi
+  803e46:	53                   	push   %ebx
+  803e47:	83 ec 08             	sub    $0x8,%esp
+  803e4a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e4e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e52:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803e56:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803e5a:	57                   	push   %edi
+  803e5b:	56                   	push   %esi
+  803e5c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e60:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e64:	52                   	push   %edx
+  803e65:	50                   	push   %eax
+  803e66:	e8 13 ff ff ff       	call   803d7e <__udivdi3>
+  803e6b:	89 c3                	mov    %eax,%ebx
+  803e6d:	0f af d6             	imul   %esi,%edx
+  803e70:	89 f9                	mov    %edi,%ecx
+  803e72:	0f af cb             	imul   %ebx,%ecx
+  803e75:	01 d1                	add    %edx,%ecx
+  803e77:	89 d8                	mov    %ebx,%eax
+  803e79:	f7 e6                	mul    %esi
+  803e7b:	89 c6                	mov    %eax,%esi
+  803e7d:	89 d7                	mov    %edx,%edi
+  803e7f:	01 cf                	add    %ecx,%edi
+  803e81:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803e85:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803e89:	29 f0                	sub    %esi,%eax
+  803e8b:	19 fa                	sbb    %edi,%edx
+  803e8d:	83 c4 18             	add    $0x18,%esp
+  803e90:	5b                   	pop    %ebx
+  803e91:	5e                   	pop    %esi
+  803e92:	5f                   	pop    %edi
+  803e93:	c3                   	ret
+
+00803e94 <__divdi3>:
+  803e94:	53                   	push   %ebx
+  803e95:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e99:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e9d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ea1:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803ea5:	85 d2                	test   %edx,%edx
+  803ea7:	78 12                	js     803ebb <__divdi3+0x27>
+  803ea9:	85 db                	test   %ebx,%ebx
+  803eab:	78 2e                	js     803edb <__divdi3+0x47>
+  803ead:	53                   	push   %ebx
+  803eae:	51                   	push   %ecx
+  803eaf:	52                   	push   %edx
+  803eb0:	50                   	push   %eax
+  803eb1:	e8 c8 fe ff ff       	call   803d7e <__udivdi3>
+  803eb6:	83 c4 10             	add    $0x10,%esp
+  803eb9:	eb 1e                	jmp    803ed9 <__divdi3+0x45>
+  803ebb:	f7 d8                	neg    %eax
+  803ebd:	83 d2 00             	adc    $0x0,%edx
+  803ec0:	f7 da                	neg    %edx
+  803ec2:	85 db                	test   %ebx,%ebx
+  803ec4:	78 2a                	js     803ef0 <__divdi3+0x5c>
+  803ec6:	53                   	push   %ebx
+  803ec7:	51                   	push   %ecx
+  803ec8:	52                   	push   %edx
+  803ec9:	50                   	push   %eax
+  803eca:	e8 af fe ff ff       	call   803d7e <__udivdi3>
+  803ecf:	83 c4 10             	add    $0x10,%esp
+  803ed2:	f7 d8                	neg    %eax
+  803ed4:	83 d2 00             	adc    $0x0,%edx
+  803ed7:	f7 da                	neg    %edx
+  803ed9:	5b                   	pop    %ebx
+  803eda:	c3                   	ret
+  803edb:	f7 d9                	neg    %ecx
+  803edd:	83 d3 00             	adc    $0x0,%ebx
+  803ee0:	f7 db                	neg    %ebx
+  803ee2:	53                   	push   %ebx
+  803ee3:	51                   	push   %ecx
+  803ee4:	52                   	push   %edx
+  803ee5:	50                   	push   %eax
+  803ee6:	e8 93 fe ff ff       	call   803d7e <__udivdi3>
+  803eeb:	83 c4 10             	add    $0x10,%esp
+  803eee:	eb e2                	jmp    803ed2 <__divdi3+0x3e>
+  803ef0:	f7 d9                	neg    %ecx
+  803ef2:	83 d3 00             	adc    $0x0,%ebx
+  803ef5:	f7 db                	neg    %ebx
+  803ef7:	53                   	push   %ebx
+  803ef8:	51                   	push   %ecx
+  803ef9:	52                   	push   %edx
+  803efa:	50                   	push   %eax
+  803efb:	e8 7e fe ff ff       	call   803d7e <__udivdi3>
+  803f00:	83 c4 10             	add    $0x10,%esp
+  803f03:	eb d4                	jmp    803ed9 <__divdi3+0x45>
+
+00803f05 <__moddi3>:
+  803f05:	57                   	push   %edi
+  803f06:	56                   	push   %esi
+  803f07:	53                   	push   %ebx
+  803f08:	83 ec 08             	sub    $0x8,%esp
+  803f0b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f0f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f13:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803f17:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803f1b:	57                   	push   %edi
+  803f1c:	56                   	push   %esi
+  803f1d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f21:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f25:	52                   	push   %edx
+  803f26:	50                   	push   %eax
+  803f27:	e8 68 ff ff ff       	call   803e94 <__divdi3>
+  803f2c:	89 c3                	mov    %eax,%ebx
+  803f2e:	0f af d6             	imul   %esi,%edx
+  803f31:	89 f9                	mov    %edi,%ecx
+  803f33:	0f af cb             	imul   %ebx,%ecx
+  803f36:	01 d1                	add    %edx,%ecx
+  803f38:	89 d8                	mov    %ebx,%eax
+  803f3a:	f7 e6                	mul    %esi
+  803f3c:	89 c6                	mov    %eax,%esi
+  803f3e:	89 d7                	mov    %edx,%edi
+  803f40:	01 cf                	add    %ecx,%edi
+  803f42:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803f46:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803f4a:	29 f0                	sub    %esi,%eax
+  803f4c:	19 fa                	sbb    %edi,%edx
+  803f4e:	83 c4 18             	add    $0x18,%esp
+  803f51:	5b                   	pop    %ebx
+  803f52:	5e                   	pop    %esi
+  803f53:	5f                   	pop    %edi
+  803f54:	c3                   	ret
@@ -0,0 +1,10125 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ed 04 00 00       	call   80051e <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  800041:	8b 75 08             	mov    0x8(%ebp),%esi
+  800044:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  80004a:	53                   	push   %ebx
+  80004b:	56                   	push   %esi
+  80004c:	e8 eb 21 00 00       	call   80223c <seek>
+	seek(kfd, off);
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	53                   	push   %ebx
+  800055:	57                   	push   %edi
+  800056:	e8 e1 21 00 00       	call   80223c <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  80005b:	c7 04 24 60 50 80 00 	movl   $0x805060,(%esp)
+  800062:	e8 39 06 00 00       	call   8006a0 <cprintf>
+	cprintf("expected:\n===\n");
+  800067:	c7 04 24 fb 50 80 00 	movl   $0x8050fb,(%esp)
+  80006e:	e8 2d 06 00 00       	call   8006a0 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800079:	eb 0d                	jmp    800088 <wrong+0x53>
+		sys_cputs(buf, n);
+  80007b:	83 ec 08             	sub    $0x8,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	e8 8a 10 00 00       	call   80110f <sys_cputs>
+  800085:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800088:	83 ec 04             	sub    $0x4,%esp
+  80008b:	6a 63                	push   $0x63
+  80008d:	53                   	push   %ebx
+  80008e:	57                   	push   %edi
+  80008f:	e8 11 20 00 00       	call   8020a5 <read>
+  800094:	83 c4 10             	add    $0x10,%esp
+  800097:	85 c0                	test   %eax,%eax
+  800099:	7f e0                	jg     80007b <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  80009b:	83 ec 0c             	sub    $0xc,%esp
+  80009e:	68 0a 51 80 00       	push   $0x80510a
+  8000a3:	e8 f8 05 00 00       	call   8006a0 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ae:	eb 0d                	jmp    8000bd <wrong+0x88>
+		sys_cputs(buf, n);
+  8000b0:	83 ec 08             	sub    $0x8,%esp
+  8000b3:	50                   	push   %eax
+  8000b4:	53                   	push   %ebx
+  8000b5:	e8 55 10 00 00       	call   80110f <sys_cputs>
+  8000ba:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bd:	83 ec 04             	sub    $0x4,%esp
+  8000c0:	6a 63                	push   $0x63
+  8000c2:	53                   	push   %ebx
+  8000c3:	56                   	push   %esi
+  8000c4:	e8 dc 1f 00 00       	call   8020a5 <read>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	85 c0                	test   %eax,%eax
+  8000ce:	7f e0                	jg     8000b0 <wrong+0x7b>
+	cprintf("===\n");
+  8000d0:	83 ec 0c             	sub    $0xc,%esp
+  8000d3:	68 05 51 80 00       	push   $0x805105
+  8000d8:	e8 c3 05 00 00       	call   8006a0 <cprintf>
+	exit();
+  8000dd:	e8 c9 04 00 00       	call   8005ab <exit>
+}
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e8:	5b                   	pop    %ebx
+  8000e9:	5e                   	pop    %esi
+  8000ea:	5f                   	pop    %edi
+  8000eb:	5d                   	pop    %ebp
+  8000ec:	c3                   	ret
+
+008000ed <umain>:
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	57                   	push   %edi
+  8000f1:	56                   	push   %esi
+  8000f2:	53                   	push   %ebx
+  8000f3:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f6:	6a 00                	push   $0x0
+  8000f8:	e8 69 1e 00 00       	call   801f66 <close>
+	close(1);
+  8000fd:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800104:	e8 5d 1e 00 00       	call   801f66 <close>
+	opencons();
+  800109:	e8 be 03 00 00       	call   8004cc <opencons>
+	opencons();
+  80010e:	e8 b9 03 00 00       	call   8004cc <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800113:	83 c4 08             	add    $0x8,%esp
+  800116:	6a 00                	push   $0x0
+  800118:	68 18 51 80 00       	push   $0x805118
+  80011d:	e8 7c 24 00 00       	call   80259e <open>
+  800122:	89 c7                	mov    %eax,%edi
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 88 09 01 00 00    	js     800238 <umain+0x14b>
+	if ((wfd = open("testshell.out", O_WRONLY|O_CREAT|O_TRUNC)) < 0)
+  80012f:	83 ec 08             	sub    $0x8,%esp
+  800132:	68 01 03 00 00       	push   $0x301
+  800137:	68 4c 51 80 00       	push   $0x80514c
+  80013c:	e8 5d 24 00 00       	call   80259e <open>
+  800141:	89 c6                	mov    %eax,%esi
+  800143:	83 c4 10             	add    $0x10,%esp
+  800146:	85 c0                	test   %eax,%eax
+  800148:	0f 88 fc 00 00 00    	js     80024a <umain+0x15d>
+	cprintf("running sh -x < testshell.sh > testshell.out\n");
+  80014e:	83 ec 0c             	sub    $0xc,%esp
+  800151:	68 84 50 80 00       	push   $0x805084
+  800156:	e8 45 05 00 00       	call   8006a0 <cprintf>
+	if ((r = fork()) < 0)
+  80015b:	e8 73 16 00 00       	call   8017d3 <fork>
+  800160:	89 c3                	mov    %eax,%ebx
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	85 c0                	test   %eax,%eax
+  800167:	0f 88 ef 00 00 00    	js     80025c <umain+0x16f>
+	if (r == 0) {
+  80016d:	75 6f                	jne    8001de <umain+0xf1>
+		dup(rfd, 0);
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	6a 00                	push   $0x0
+  800174:	57                   	push   %edi
+  800175:	e8 41 1e 00 00       	call   801fbb <dup>
+		dup(wfd, 1);
+  80017a:	83 c4 08             	add    $0x8,%esp
+  80017d:	6a 01                	push   $0x1
+  80017f:	56                   	push   %esi
+  800180:	e8 36 1e 00 00       	call   801fbb <dup>
+		close(rfd);
+  800185:	89 3c 24             	mov    %edi,(%esp)
+  800188:	e8 d9 1d 00 00       	call   801f66 <close>
+		close(wfd);
+  80018d:	89 34 24             	mov    %esi,(%esp)
+  800190:	e8 d1 1d 00 00       	call   801f66 <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800195:	6a 00                	push   $0x0
+  800197:	68 71 51 80 00       	push   $0x805171
+  80019c:	68 22 51 80 00       	push   $0x805122
+  8001a1:	68 74 51 80 00       	push   $0x805174
+  8001a6:	e8 f9 2d 00 00       	call   802fa4 <spawnl>
+  8001ab:	89 c3                	mov    %eax,%ebx
+  8001ad:	83 c4 20             	add    $0x20,%esp
+  8001b0:	85 c0                	test   %eax,%eax
+  8001b2:	0f 88 b6 00 00 00    	js     80026e <umain+0x181>
+		close(0);
+  8001b8:	83 ec 0c             	sub    $0xc,%esp
+  8001bb:	6a 00                	push   $0x0
+  8001bd:	e8 a4 1d 00 00       	call   801f66 <close>
+		close(1);
+  8001c2:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c9:	e8 98 1d 00 00       	call   801f66 <close>
+		wait(r);
+  8001ce:	89 1c 24             	mov    %ebx,(%esp)
+  8001d1:	e8 2f 45 00 00       	call   804705 <wait>
+		exit();
+  8001d6:	e8 d0 03 00 00       	call   8005ab <exit>
+  8001db:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+  8001e1:	57                   	push   %edi
+  8001e2:	e8 7f 1d 00 00       	call   801f66 <close>
+	close(wfd);
+  8001e7:	89 34 24             	mov    %esi,(%esp)
+  8001ea:	e8 77 1d 00 00       	call   801f66 <close>
+	wait(r);
+  8001ef:	89 1c 24             	mov    %ebx,(%esp)
+  8001f2:	e8 0e 45 00 00       	call   804705 <wait>
+	if ((rfd = open("testshell.out", O_RDONLY)) < 0)
+  8001f7:	83 c4 08             	add    $0x8,%esp
+  8001fa:	6a 00                	push   $0x0
+  8001fc:	68 4c 51 80 00       	push   $0x80514c
+  800201:	e8 98 23 00 00       	call   80259e <open>
+  800206:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800209:	83 c4 10             	add    $0x10,%esp
+  80020c:	85 c0                	test   %eax,%eax
+  80020e:	78 70                	js     800280 <umain+0x193>
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  800210:	83 ec 08             	sub    $0x8,%esp
+  800213:	6a 00                	push   $0x0
+  800215:	68 82 51 80 00       	push   $0x805182
+  80021a:	e8 7f 23 00 00       	call   80259e <open>
+  80021f:	83 c4 10             	add    $0x10,%esp
+  800222:	85 c0                	test   %eax,%eax
+  800224:	78 6c                	js     800292 <umain+0x1a5>
+  800226:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  80022b:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  800230:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800233:	e9 ac 00 00 00       	jmp    8002e4 <umain+0x1f7>
+		panic("open testshell.sh: %e", rfd);
+  800238:	50                   	push   %eax
+  800239:	68 25 51 80 00       	push   $0x805125
+  80023e:	6a 12                	push   $0x12
+  800240:	68 3b 51 80 00       	push   $0x80513b
+  800245:	e8 7b 03 00 00       	call   8005c5 <_panic>
+		panic("open testshell.out: %e", wfd);
+  80024a:	50                   	push   %eax
+  80024b:	68 5a 51 80 00       	push   $0x80515a
+  800250:	6a 14                	push   $0x14
+  800252:	68 3b 51 80 00       	push   $0x80513b
+  800257:	e8 69 03 00 00       	call   8005c5 <_panic>
+		panic("fork: %e", r);
+  80025c:	50                   	push   %eax
+  80025d:	68 dd 55 80 00       	push   $0x8055dd
+  800262:	6a 18                	push   $0x18
+  800264:	68 3b 51 80 00       	push   $0x80513b
+  800269:	e8 57 03 00 00       	call   8005c5 <_panic>
+			panic("spawn: %e", r);
+  80026e:	50                   	push   %eax
+  80026f:	68 78 51 80 00       	push   $0x805178
+  800274:	6a 1f                	push   $0x1f
+  800276:	68 3b 51 80 00       	push   $0x80513b
+  80027b:	e8 45 03 00 00       	call   8005c5 <_panic>
+		panic("open testshell.out for reading: %e", rfd);
+  800280:	50                   	push   %eax
+  800281:	68 b4 50 80 00       	push   $0x8050b4
+  800286:	6a 2a                	push   $0x2a
+  800288:	68 3b 51 80 00       	push   $0x80513b
+  80028d:	e8 33 03 00 00       	call   8005c5 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  800292:	50                   	push   %eax
+  800293:	68 d8 50 80 00       	push   $0x8050d8
+  800298:	6a 2c                	push   $0x2c
+  80029a:	68 3b 51 80 00       	push   $0x80513b
+  80029f:	e8 21 03 00 00       	call   8005c5 <_panic>
+			panic("reading testshell.out: %e", n1);
+  8002a4:	53                   	push   %ebx
+  8002a5:	68 90 51 80 00       	push   $0x805190
+  8002aa:	6a 33                	push   $0x33
+  8002ac:	68 3b 51 80 00       	push   $0x80513b
+  8002b1:	e8 0f 03 00 00       	call   8005c5 <_panic>
+			panic("reading testshell.key: %e", n2);
+  8002b6:	50                   	push   %eax
+  8002b7:	68 aa 51 80 00       	push   $0x8051aa
+  8002bc:	6a 35                	push   $0x35
+  8002be:	68 3b 51 80 00       	push   $0x80513b
+  8002c3:	e8 fd 02 00 00       	call   8005c5 <_panic>
+			wrong(rfd, kfd, nloff);
+  8002c8:	83 ec 04             	sub    $0x4,%esp
+  8002cb:	57                   	push   %edi
+  8002cc:	ff 75 d0             	push   -0x30(%ebp)
+  8002cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8002d2:	e8 5e fd ff ff       	call   800035 <wrong>
+  8002d7:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002da:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002de:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002e1:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	6a 01                	push   $0x1
+  8002e9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002ec:	50                   	push   %eax
+  8002ed:	ff 75 d4             	push   -0x2c(%ebp)
+  8002f0:	e8 b0 1d 00 00       	call   8020a5 <read>
+  8002f5:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002f7:	83 c4 0c             	add    $0xc,%esp
+  8002fa:	6a 01                	push   $0x1
+  8002fc:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002ff:	50                   	push   %eax
+  800300:	ff 75 d0             	push   -0x30(%ebp)
+  800303:	e8 9d 1d 00 00       	call   8020a5 <read>
+		if (n1 < 0)
+  800308:	83 c4 10             	add    $0x10,%esp
+  80030b:	85 db                	test   %ebx,%ebx
+  80030d:	78 95                	js     8002a4 <umain+0x1b7>
+		if (n2 < 0)
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 a3                	js     8002b6 <umain+0x1c9>
+		if (n1 == 0 && n2 == 0)
+  800313:	89 d9                	mov    %ebx,%ecx
+  800315:	09 c1                	or     %eax,%ecx
+  800317:	74 15                	je     80032e <umain+0x241>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  800319:	83 fb 01             	cmp    $0x1,%ebx
+  80031c:	75 aa                	jne    8002c8 <umain+0x1db>
+  80031e:	83 f8 01             	cmp    $0x1,%eax
+  800321:	75 a5                	jne    8002c8 <umain+0x1db>
+  800323:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  800327:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  80032a:	75 9c                	jne    8002c8 <umain+0x1db>
+  80032c:	eb ac                	jmp    8002da <umain+0x1ed>
+	cprintf("shell ran correctly\n");
+  80032e:	83 ec 0c             	sub    $0xc,%esp
+  800331:	68 c4 51 80 00       	push   $0x8051c4
+  800336:	e8 65 03 00 00       	call   8006a0 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80033b:	cc                   	int3
+}
+  80033c:	83 c4 10             	add    $0x10,%esp
+  80033f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800342:	5b                   	pop    %ebx
+  800343:	5e                   	pop    %esi
+  800344:	5f                   	pop    %edi
+  800345:	5d                   	pop    %ebp
+  800346:	c3                   	ret
+
+00800347 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	c3                   	ret
+
+0080034d <devcons_poll>:
+{
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	53                   	push   %ebx
+  800351:	83 ec 04             	sub    $0x4,%esp
+  800354:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800357:	89 da                	mov    %ebx,%edx
+  800359:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80035c:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800363:	74 0c                	je     800371 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  800365:	89 d8                	mov    %ebx,%eax
+  800367:	83 e0 01             	and    $0x1,%eax
+  80036a:	09 d0                	or     %edx,%eax
+}
+  80036c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80036f:	c9                   	leave
+  800370:	c3                   	ret
+		cons_peek = sys_cgetc();
+  800371:	e8 b7 0d 00 00       	call   80112d <sys_cgetc>
+  800376:	a3 00 70 80 00       	mov    %eax,0x807000
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80037b:	89 da                	mov    %ebx,%edx
+  80037d:	83 e2 04             	and    $0x4,%edx
+  800380:	85 c0                	test   %eax,%eax
+  800382:	74 e6                	je     80036a <devcons_poll+0x1d>
+  800384:	eb df                	jmp    800365 <devcons_poll+0x18>
+
+00800386 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80038c:	68 d9 51 80 00       	push   $0x8051d9
+  800391:	ff 75 0c             	push   0xc(%ebp)
+  800394:	e8 fe 09 00 00       	call   800d97 <strcpy>
+	return 0;
+}
+  800399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039e:	c9                   	leave
+  80039f:	c3                   	ret
+
+008003a0 <devcons_write>:
+{
+  8003a0:	55                   	push   %ebp
+  8003a1:	89 e5                	mov    %esp,%ebp
+  8003a3:	57                   	push   %edi
+  8003a4:	56                   	push   %esi
+  8003a5:	53                   	push   %ebx
+  8003a6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8003ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8003af:	85 ff                	test   %edi,%edi
+  8003b1:	74 51                	je     800404 <devcons_write+0x64>
+  8003b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8003bd:	89 fb                	mov    %edi,%ebx
+  8003bf:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8003c1:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8003c6:	39 d3                	cmp    %edx,%ebx
+  8003c8:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	53                   	push   %ebx
+  8003cf:	03 45 0c             	add    0xc(%ebp),%eax
+  8003d2:	50                   	push   %eax
+  8003d3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8003d9:	50                   	push   %eax
+  8003da:	e8 68 0b 00 00       	call   800f47 <memmove>
+		sys_cputs(buf, m);
+  8003df:	83 c4 08             	add    $0x8,%esp
+  8003e2:	53                   	push   %ebx
+  8003e3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	e8 20 0d 00 00       	call   80110f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8003ef:	01 de                	add    %ebx,%esi
+  8003f1:	89 f0                	mov    %esi,%eax
+  8003f3:	83 c4 10             	add    $0x10,%esp
+  8003f6:	39 fe                	cmp    %edi,%esi
+  8003f8:	72 c3                	jb     8003bd <devcons_write+0x1d>
+}
+  8003fa:	89 f0                	mov    %esi,%eax
+  8003fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ff:	5b                   	pop    %ebx
+  800400:	5e                   	pop    %esi
+  800401:	5f                   	pop    %edi
+  800402:	5d                   	pop    %ebp
+  800403:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  800404:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  800409:	eb ef                	jmp    8003fa <devcons_write+0x5a>
+
+0080040b <devcons_read>:
+{
+  80040b:	55                   	push   %ebp
+  80040c:	89 e5                	mov    %esp,%ebp
+  80040e:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800416:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80041a:	74 36                	je     800452 <devcons_read+0x47>
+	c = cons_peek;
+  80041c:	a1 00 70 80 00       	mov    0x807000,%eax
+	cons_peek = 0;
+  800421:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  800428:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80042b:	85 c0                	test   %eax,%eax
+  80042d:	75 10                	jne    80043f <devcons_read+0x34>
+  80042f:	e8 f9 0c 00 00       	call   80112d <sys_cgetc>
+  800434:	85 c0                	test   %eax,%eax
+  800436:	75 07                	jne    80043f <devcons_read+0x34>
+		sys_yield();
+  800438:	e8 6f 0d 00 00       	call   8011ac <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  80043d:	eb f0                	jmp    80042f <devcons_read+0x24>
+	if (c < 0)
+  80043f:	85 c0                	test   %eax,%eax
+  800441:	78 0f                	js     800452 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  800443:	83 f8 04             	cmp    $0x4,%eax
+  800446:	74 0c                	je     800454 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  800448:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80044b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80044d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800452:	c9                   	leave
+  800453:	c3                   	ret
+		return 0;
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	eb f7                	jmp    800452 <devcons_read+0x47>
+
+0080045b <cputchar>:
+{
+  80045b:	55                   	push   %ebp
+  80045c:	89 e5                	mov    %esp,%ebp
+  80045e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  800461:	8b 45 08             	mov    0x8(%ebp),%eax
+  800464:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  800467:	6a 01                	push   $0x1
+  800469:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 9d 0c 00 00       	call   80110f <sys_cputs>
+}
+  800472:	83 c4 10             	add    $0x10,%esp
+  800475:	c9                   	leave
+  800476:	c3                   	ret
+
+00800477 <getchar>:
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80047d:	6a 01                	push   $0x1
+  80047f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800482:	50                   	push   %eax
+  800483:	6a 00                	push   $0x0
+  800485:	e8 1b 1c 00 00       	call   8020a5 <read>
+	if (r < 0)
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	85 c0                	test   %eax,%eax
+  80048f:	78 06                	js     800497 <getchar+0x20>
+	if (r < 1)
+  800491:	74 06                	je     800499 <getchar+0x22>
+	return c;
+  800493:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800497:	c9                   	leave
+  800498:	c3                   	ret
+		return -E_EOF;
+  800499:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80049e:	eb f7                	jmp    800497 <getchar+0x20>
+
+008004a0 <iscons>:
+{
+  8004a0:	55                   	push   %ebp
+  8004a1:	89 e5                	mov    %esp,%ebp
+  8004a3:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8004a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004a9:	50                   	push   %eax
+  8004aa:	ff 75 08             	push   0x8(%ebp)
+  8004ad:	e8 6f 19 00 00       	call   801e21 <fd_lookup>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+  8004b5:	85 c0                	test   %eax,%eax
+  8004b7:	78 11                	js     8004ca <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8004b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004bc:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8004c2:	39 10                	cmp    %edx,(%eax)
+  8004c4:	0f 94 c0             	sete   %al
+  8004c7:	0f b6 c0             	movzbl %al,%eax
+}
+  8004ca:	c9                   	leave
+  8004cb:	c3                   	ret
+
+008004cc <opencons>:
+{
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8004d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8004d5:	50                   	push   %eax
+  8004d6:	e8 f6 18 00 00       	call   801dd1 <fd_alloc>
+  8004db:	83 c4 10             	add    $0x10,%esp
+  8004de:	85 c0                	test   %eax,%eax
+  8004e0:	78 3a                	js     80051c <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8004e2:	83 ec 04             	sub    $0x4,%esp
+  8004e5:	68 07 04 00 00       	push   $0x407
+  8004ea:	ff 75 f4             	push   -0xc(%ebp)
+  8004ed:	6a 00                	push   $0x0
+  8004ef:	e8 d7 0c 00 00       	call   8011cb <sys_page_alloc>
+  8004f4:	83 c4 10             	add    $0x10,%esp
+  8004f7:	85 c0                	test   %eax,%eax
+  8004f9:	78 21                	js     80051c <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8004fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8004fe:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800504:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800506:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800509:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800510:	83 ec 0c             	sub    $0xc,%esp
+  800513:	50                   	push   %eax
+  800514:	e8 91 18 00 00       	call   801daa <fd2num>
+  800519:	83 c4 10             	add    $0x10,%esp
+}
+  80051c:	c9                   	leave
+  80051d:	c3                   	ret
+
+0080051e <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80051e:	55                   	push   %ebp
+  80051f:	89 e5                	mov    %esp,%ebp
+  800521:	56                   	push   %esi
+  800522:	53                   	push   %ebx
+  800523:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800526:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800529:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80052b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800530:	29 d0                	sub    %edx,%eax
+  800532:	89 c2                	mov    %eax,%edx
+  800534:	c1 ea 0f             	shr    $0xf,%edx
+  800537:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80053c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800541:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800544:	c7 04 85 60 80 80 00 	movl   $0x0,0x808060(,%eax,4)
+  80054b:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80054f:	e8 39 0c 00 00       	call   80118d <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800554:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800559:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80055f:	89 e1                	mov    %esp,%ecx
+  800561:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800566:	29 ca                	sub    %ecx,%edx
+  800568:	89 d1                	mov    %edx,%ecx
+  80056a:	c1 e9 0f             	shr    $0xf,%ecx
+  80056d:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800573:	ba 00 00 00 00       	mov    $0x0,%edx
+  800578:	0f 42 d1             	cmovb  %ecx,%edx
+  80057b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800580:	89 04 95 60 80 80 00 	mov    %eax,0x808060(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800587:	85 db                	test   %ebx,%ebx
+  800589:	7e 07                	jle    800592 <libmain+0x74>
+		binaryname = argv[0];
+  80058b:	8b 06                	mov    (%esi),%eax
+  80058d:	a3 20 60 80 00       	mov    %eax,0x806020
+
+	// call user main routine
+	umain(argc, argv);
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	56                   	push   %esi
+  800596:	53                   	push   %ebx
+  800597:	e8 51 fb ff ff       	call   8000ed <umain>
+
+	// exit gracefully
+	exit();
+  80059c:	e8 0a 00 00 00       	call   8005ab <exit>
+}
+  8005a1:	83 c4 10             	add    $0x10,%esp
+  8005a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005a7:	5b                   	pop    %ebx
+  8005a8:	5e                   	pop    %esi
+  8005a9:	5d                   	pop    %ebp
+  8005aa:	c3                   	ret
+
+008005ab <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005ab:	55                   	push   %ebp
+  8005ac:	89 e5                	mov    %esp,%ebp
+  8005ae:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8005b1:	e8 dd 19 00 00       	call   801f93 <close_all>
+	sys_env_destroy(0);
+  8005b6:	83 ec 0c             	sub    $0xc,%esp
+  8005b9:	6a 00                	push   $0x0
+  8005bb:	e8 8c 0b 00 00       	call   80114c <sys_env_destroy>
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	c9                   	leave
+  8005c4:	c3                   	ret
+
+008005c5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005c5:	55                   	push   %ebp
+  8005c6:	89 e5                	mov    %esp,%ebp
+  8005c8:	56                   	push   %esi
+  8005c9:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005ca:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005cd:	8b 35 20 60 80 00    	mov    0x806020,%esi
+  8005d3:	e8 b5 0b 00 00       	call   80118d <sys_getenvid>
+  8005d8:	83 ec 0c             	sub    $0xc,%esp
+  8005db:	ff 75 0c             	push   0xc(%ebp)
+  8005de:	ff 75 08             	push   0x8(%ebp)
+  8005e1:	56                   	push   %esi
+  8005e2:	50                   	push   %eax
+  8005e3:	68 f0 51 80 00       	push   $0x8051f0
+  8005e8:	e8 b3 00 00 00       	call   8006a0 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005ed:	83 c4 18             	add    $0x18,%esp
+  8005f0:	53                   	push   %ebx
+  8005f1:	ff 75 10             	push   0x10(%ebp)
+  8005f4:	e8 56 00 00 00       	call   80064f <vcprintf>
+	cprintf("\n");
+  8005f9:	c7 04 24 08 51 80 00 	movl   $0x805108,(%esp)
+  800600:	e8 9b 00 00 00       	call   8006a0 <cprintf>
+  800605:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800608:	cc                   	int3
+	while (1)
+  800609:	eb fd                	jmp    800608 <_panic+0x43>
+
+0080060b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80060b:	55                   	push   %ebp
+  80060c:	89 e5                	mov    %esp,%ebp
+  80060e:	53                   	push   %ebx
+  80060f:	83 ec 04             	sub    $0x4,%esp
+  800612:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800615:	8b 13                	mov    (%ebx),%edx
+  800617:	8d 42 01             	lea    0x1(%edx),%eax
+  80061a:	89 03                	mov    %eax,(%ebx)
+  80061c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80061f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800623:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800628:	74 09                	je     800633 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80062a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80062e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800631:	c9                   	leave
+  800632:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800633:	83 ec 08             	sub    $0x8,%esp
+  800636:	68 ff 00 00 00       	push   $0xff
+  80063b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80063e:	50                   	push   %eax
+  80063f:	e8 cb 0a 00 00       	call   80110f <sys_cputs>
+		b->idx = 0;
+  800644:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80064a:	83 c4 10             	add    $0x10,%esp
+  80064d:	eb db                	jmp    80062a <putch+0x1f>
+
+0080064f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80064f:	55                   	push   %ebp
+  800650:	89 e5                	mov    %esp,%ebp
+  800652:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800658:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80065f:	00 00 00 
+	b.cnt = 0;
+  800662:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800669:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80066c:	ff 75 0c             	push   0xc(%ebp)
+  80066f:	ff 75 08             	push   0x8(%ebp)
+  800672:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800678:	50                   	push   %eax
+  800679:	68 0b 06 80 00       	push   $0x80060b
+  80067e:	e8 1c 01 00 00       	call   80079f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800683:	83 c4 08             	add    $0x8,%esp
+  800686:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80068c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800692:	50                   	push   %eax
+  800693:	e8 77 0a 00 00       	call   80110f <sys_cputs>
+
+	return b.cnt;
+}
+  800698:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80069e:	c9                   	leave
+  80069f:	c3                   	ret
+
+008006a0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006a0:	55                   	push   %ebp
+  8006a1:	89 e5                	mov    %esp,%ebp
+  8006a3:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8006a6:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8006a9:	50                   	push   %eax
+  8006aa:	ff 75 08             	push   0x8(%ebp)
+  8006ad:	e8 9d ff ff ff       	call   80064f <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8006b2:	c9                   	leave
+  8006b3:	c3                   	ret
+
+008006b4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006b4:	55                   	push   %ebp
+  8006b5:	89 e5                	mov    %esp,%ebp
+  8006b7:	57                   	push   %edi
+  8006b8:	56                   	push   %esi
+  8006b9:	53                   	push   %ebx
+  8006ba:	83 ec 1c             	sub    $0x1c,%esp
+  8006bd:	89 c3                	mov    %eax,%ebx
+  8006bf:	89 d6                	mov    %edx,%esi
+  8006c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006c7:	89 d1                	mov    %edx,%ecx
+  8006c9:	89 c2                	mov    %eax,%edx
+  8006cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006d1:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006d4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006de:	39 c2                	cmp    %eax,%edx
+  8006e0:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8006e3:	73 4b                	jae    800730 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8006eb:	85 ff                	test   %edi,%edi
+  8006ed:	7e 11                	jle    800700 <printnum+0x4c>
+			putch(padc, putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	56                   	push   %esi
+  8006f3:	ff 75 18             	push   0x18(%ebp)
+  8006f6:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8006f8:	83 c4 10             	add    $0x10,%esp
+  8006fb:	83 ef 01             	sub    $0x1,%edi
+  8006fe:	75 ef                	jne    8006ef <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800700:	83 ec 08             	sub    $0x8,%esp
+  800703:	56                   	push   %esi
+  800704:	83 ec 04             	sub    $0x4,%esp
+  800707:	ff 75 e4             	push   -0x1c(%ebp)
+  80070a:	ff 75 e0             	push   -0x20(%ebp)
+  80070d:	ff 75 dc             	push   -0x24(%ebp)
+  800710:	ff 75 d8             	push   -0x28(%ebp)
+  800713:	e8 18 48 00 00       	call   804f30 <__umoddi3>
+  800718:	83 c4 14             	add    $0x14,%esp
+  80071b:	0f be 80 13 52 80 00 	movsbl 0x805213(%eax),%eax
+  800722:	50                   	push   %eax
+  800723:	ff d3                	call   *%ebx
+}
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80072b:	5b                   	pop    %ebx
+  80072c:	5e                   	pop    %esi
+  80072d:	5f                   	pop    %edi
+  80072e:	5d                   	pop    %ebp
+  80072f:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800730:	83 ec 0c             	sub    $0xc,%esp
+  800733:	ff 75 18             	push   0x18(%ebp)
+  800736:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800739:	8d 57 ff             	lea    -0x1(%edi),%edx
+  80073c:	52                   	push   %edx
+  80073d:	50                   	push   %eax
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	ff 75 e4             	push   -0x1c(%ebp)
+  800744:	ff 75 e0             	push   -0x20(%ebp)
+  800747:	ff 75 dc             	push   -0x24(%ebp)
+  80074a:	ff 75 d8             	push   -0x28(%ebp)
+  80074d:	e8 18 47 00 00       	call   804e6a <__udivdi3>
+  800752:	83 c4 18             	add    $0x18,%esp
+  800755:	52                   	push   %edx
+  800756:	50                   	push   %eax
+  800757:	89 f2                	mov    %esi,%edx
+  800759:	89 d8                	mov    %ebx,%eax
+  80075b:	e8 54 ff ff ff       	call   8006b4 <printnum>
+  800760:	83 c4 20             	add    $0x20,%esp
+  800763:	eb 9b                	jmp    800700 <printnum+0x4c>
+
+00800765 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800765:	55                   	push   %ebp
+  800766:	89 e5                	mov    %esp,%ebp
+  800768:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80076b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80076f:	8b 10                	mov    (%eax),%edx
+  800771:	3b 50 04             	cmp    0x4(%eax),%edx
+  800774:	73 0a                	jae    800780 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800776:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800779:	89 08                	mov    %ecx,(%eax)
+  80077b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077e:	88 02                	mov    %al,(%edx)
+}
+  800780:	5d                   	pop    %ebp
+  800781:	c3                   	ret
+
+00800782 <printfmt>:
+{
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800788:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80078b:	50                   	push   %eax
+  80078c:	ff 75 10             	push   0x10(%ebp)
+  80078f:	ff 75 0c             	push   0xc(%ebp)
+  800792:	ff 75 08             	push   0x8(%ebp)
+  800795:	e8 05 00 00 00       	call   80079f <vprintfmt>
+}
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	c9                   	leave
+  80079e:	c3                   	ret
+
+0080079f <vprintfmt>:
+{
+  80079f:	55                   	push   %ebp
+  8007a0:	89 e5                	mov    %esp,%ebp
+  8007a2:	57                   	push   %edi
+  8007a3:	56                   	push   %esi
+  8007a4:	53                   	push   %ebx
+  8007a5:	83 ec 2c             	sub    $0x2c,%esp
+  8007a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8007ab:	89 df                	mov    %ebx,%edi
+  8007ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8007b3:	8d 70 01             	lea    0x1(%eax),%esi
+  8007b6:	0f b6 00             	movzbl (%eax),%eax
+  8007b9:	83 f8 25             	cmp    $0x25,%eax
+  8007bc:	74 1e                	je     8007dc <vprintfmt+0x3d>
+			if (ch == '\0')
+  8007be:	85 c0                	test   %eax,%eax
+  8007c0:	0f 84 15 05 00 00    	je     800cdb <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8007c6:	83 ec 08             	sub    $0x8,%esp
+  8007c9:	53                   	push   %ebx
+  8007ca:	50                   	push   %eax
+  8007cb:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007cd:	83 c6 01             	add    $0x1,%esi
+  8007d0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007d4:	83 c4 10             	add    $0x10,%esp
+  8007d7:	83 f8 25             	cmp    $0x25,%eax
+  8007da:	75 e2                	jne    8007be <vprintfmt+0x1f>
+		padc = ' ';
+  8007dc:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8007e0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8007e7:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8007ee:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8007f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fa:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007fd:	8d 56 01             	lea    0x1(%esi),%edx
+  800800:	0f b6 0e             	movzbl (%esi),%ecx
+  800803:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800806:	3c 55                	cmp    $0x55,%al
+  800808:	0f 87 3b 04 00 00    	ja     800c49 <vprintfmt+0x4aa>
+  80080e:	0f b6 c0             	movzbl %al,%eax
+  800811:	ff 24 85 80 53 80 00 	jmp    *0x805380(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800818:	89 75 10             	mov    %esi,0x10(%ebp)
+  80081b:	eb 93                	jmp    8007b0 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80081d:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80081f:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800823:	eb d8                	jmp    8007fd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800825:	89 d6                	mov    %edx,%esi
+  800827:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  80082b:	eb d0                	jmp    8007fd <vprintfmt+0x5e>
+  80082d:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800830:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800833:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800836:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  80083a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80083d:	83 f9 09             	cmp    $0x9,%ecx
+  800840:	77 6f                	ja     8008b1 <vprintfmt+0x112>
+  800842:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800845:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800848:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  80084b:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80084f:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800852:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800855:	83 fe 09             	cmp    $0x9,%esi
+  800858:	76 eb                	jbe    800845 <vprintfmt+0xa6>
+  80085a:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80085d:	89 d6                	mov    %edx,%esi
+  80085f:	eb 13                	jmp    800874 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800861:	8b 45 14             	mov    0x14(%ebp),%eax
+  800864:	8b 00                	mov    (%eax),%eax
+  800866:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800869:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086c:	8d 40 04             	lea    0x4(%eax),%eax
+  80086f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800872:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800874:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800878:	79 83                	jns    8007fd <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  80087a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80087d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800880:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800887:	e9 71 ff ff ff       	jmp    8007fd <vprintfmt+0x5e>
+			if (width < 0)
+  80088c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80088f:	85 c9                	test   %ecx,%ecx
+  800891:	b8 00 00 00 00       	mov    $0x0,%eax
+  800896:	0f 49 c1             	cmovns %ecx,%eax
+  800899:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80089c:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80089e:	e9 5a ff ff ff       	jmp    8007fd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008a3:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  8008a5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8008ac:	e9 4c ff ff ff       	jmp    8007fd <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b1:	89 d6                	mov    %edx,%esi
+  8008b3:	eb bf                	jmp    800874 <vprintfmt+0xd5>
+			lflag++;
+  8008b5:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b9:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8008bb:	e9 3d ff ff ff       	jmp    8007fd <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8008c0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8d 70 04             	lea    0x4(%eax),%esi
+  8008c9:	83 ec 08             	sub    $0x8,%esp
+  8008cc:	53                   	push   %ebx
+  8008cd:	ff 30                	push   (%eax)
+  8008cf:	ff d7                	call   *%edi
+			break;
+  8008d1:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8008d4:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8008d7:	e9 d4 fe ff ff       	jmp    8007b0 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8008dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e2:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8008e5:	8b 10                	mov    (%eax),%edx
+  8008e7:	89 d0                	mov    %edx,%eax
+  8008e9:	f7 d8                	neg    %eax
+  8008eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008ee:	83 f8 12             	cmp    $0x12,%eax
+  8008f1:	7f 23                	jg     800916 <vprintfmt+0x177>
+  8008f3:	8b 14 85 e0 54 80 00 	mov    0x8054e0(,%eax,4),%edx
+  8008fa:	85 d2                	test   %edx,%edx
+  8008fc:	74 18                	je     800916 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8008fe:	52                   	push   %edx
+  8008ff:	68 2c 57 80 00       	push   $0x80572c
+  800904:	53                   	push   %ebx
+  800905:	57                   	push   %edi
+  800906:	e8 77 fe ff ff       	call   800782 <printfmt>
+  80090b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80090e:	89 75 14             	mov    %esi,0x14(%ebp)
+  800911:	e9 9a fe ff ff       	jmp    8007b0 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800916:	50                   	push   %eax
+  800917:	68 2b 52 80 00       	push   $0x80522b
+  80091c:	53                   	push   %ebx
+  80091d:	57                   	push   %edi
+  80091e:	e8 5f fe ff ff       	call   800782 <printfmt>
+  800923:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800926:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800929:	e9 82 fe ff ff       	jmp    8007b0 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80092e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800931:	8b 45 14             	mov    0x14(%ebp),%eax
+  800934:	83 c0 04             	add    $0x4,%eax
+  800937:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8b 00                	mov    (%eax),%eax
+  80093f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800942:	85 c0                	test   %eax,%eax
+  800944:	0f 84 61 03 00 00    	je     800cab <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  80094a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80094e:	7e 06                	jle    800956 <vprintfmt+0x1b7>
+  800950:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800954:	75 29                	jne    80097f <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800956:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800959:	8d 70 01             	lea    0x1(%eax),%esi
+  80095c:	0f b6 00             	movzbl (%eax),%eax
+  80095f:	0f be d0             	movsbl %al,%edx
+  800962:	85 d2                	test   %edx,%edx
+  800964:	0f 84 bb 00 00 00    	je     800a25 <vprintfmt+0x286>
+  80096a:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80096d:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800970:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800973:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800976:	eb 7a                	jmp    8009f2 <vprintfmt+0x253>
+				p = "(null)";
+  800978:	c7 45 d0 24 52 80 00 	movl   $0x805224,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	ff 75 d4             	push   -0x2c(%ebp)
+  800985:	ff 75 d0             	push   -0x30(%ebp)
+  800988:	e8 e0 03 00 00       	call   800d6d <strnlen>
+  80098d:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800990:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800993:	83 c4 10             	add    $0x10,%esp
+  800996:	85 d2                	test   %edx,%edx
+  800998:	0f 8e d6 02 00 00    	jle    800c74 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80099e:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  8009a2:	83 ec 08             	sub    $0x8,%esp
+  8009a5:	53                   	push   %ebx
+  8009a6:	56                   	push   %esi
+  8009a7:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009a9:	83 c4 10             	add    $0x10,%esp
+  8009ac:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  8009b0:	75 f0                	jne    8009a2 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009b2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8009b5:	8d 70 01             	lea    0x1(%eax),%esi
+  8009b8:	0f b6 00             	movzbl (%eax),%eax
+  8009bb:	0f be d0             	movsbl %al,%edx
+  8009be:	85 d2                	test   %edx,%edx
+  8009c0:	0f 84 da 02 00 00    	je     800ca0 <vprintfmt+0x501>
+  8009c6:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8009c9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8009cc:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8009cf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8009d2:	eb 1e                	jmp    8009f2 <vprintfmt+0x253>
+					putch(ch, putdat);
+  8009d4:	83 ec 08             	sub    $0x8,%esp
+  8009d7:	ff 75 0c             	push   0xc(%ebp)
+  8009da:	52                   	push   %edx
+  8009db:	ff 55 08             	call   *0x8(%ebp)
+  8009de:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009e1:	83 eb 01             	sub    $0x1,%ebx
+  8009e4:	83 c6 01             	add    $0x1,%esi
+  8009e7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009eb:	0f be d0             	movsbl %al,%edx
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	74 2a                	je     800a1c <vprintfmt+0x27d>
+  8009f2:	85 ff                	test   %edi,%edi
+  8009f4:	78 05                	js     8009fb <vprintfmt+0x25c>
+  8009f6:	83 ef 01             	sub    $0x1,%edi
+  8009f9:	78 59                	js     800a54 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009fb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009ff:	74 d3                	je     8009d4 <vprintfmt+0x235>
+  800a01:	0f be c0             	movsbl %al,%eax
+  800a04:	83 e8 20             	sub    $0x20,%eax
+  800a07:	83 f8 5e             	cmp    $0x5e,%eax
+  800a0a:	76 c8                	jbe    8009d4 <vprintfmt+0x235>
+					putch('?', putdat);
+  800a0c:	83 ec 08             	sub    $0x8,%esp
+  800a0f:	ff 75 0c             	push   0xc(%ebp)
+  800a12:	6a 3f                	push   $0x3f
+  800a14:	ff 55 08             	call   *0x8(%ebp)
+  800a17:	83 c4 10             	add    $0x10,%esp
+  800a1a:	eb c5                	jmp    8009e1 <vprintfmt+0x242>
+  800a1c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800a1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800a25:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800a28:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a2c:	7e 1b                	jle    800a49 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800a2e:	83 ec 08             	sub    $0x8,%esp
+  800a31:	53                   	push   %ebx
+  800a32:	6a 20                	push   $0x20
+  800a34:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800a36:	83 c4 10             	add    $0x10,%esp
+  800a39:	83 ee 01             	sub    $0x1,%esi
+  800a3c:	75 f0                	jne    800a2e <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a3e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a41:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a44:	e9 67 fd ff ff       	jmp    8007b0 <vprintfmt+0x11>
+  800a49:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a4c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a4f:	e9 5c fd ff ff       	jmp    8007b0 <vprintfmt+0x11>
+  800a54:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800a57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a5a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a5d:	eb c6                	jmp    800a25 <vprintfmt+0x286>
+	if (lflag >= 2)
+  800a5f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a62:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a65:	83 f9 01             	cmp    $0x1,%ecx
+  800a68:	7f 1f                	jg     800a89 <vprintfmt+0x2ea>
+	else if (lflag)
+  800a6a:	85 c9                	test   %ecx,%ecx
+  800a6c:	74 67                	je     800ad5 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800a6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a71:	8b 30                	mov    (%eax),%esi
+  800a73:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a76:	89 f0                	mov    %esi,%eax
+  800a78:	c1 f8 1f             	sar    $0x1f,%eax
+  800a7b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a7e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a81:	8d 40 04             	lea    0x4(%eax),%eax
+  800a84:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a87:	eb 17                	jmp    800aa0 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800a89:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8c:	8b 50 04             	mov    0x4(%eax),%edx
+  800a8f:	8b 00                	mov    (%eax),%eax
+  800a91:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a94:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a97:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9a:	8d 40 08             	lea    0x8(%eax),%eax
+  800a9d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800aa0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800aa3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800aa6:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800aab:	85 c9                	test   %ecx,%ecx
+  800aad:	0f 89 12 01 00 00    	jns    800bc5 <vprintfmt+0x426>
+				putch('-', putdat);
+  800ab3:	83 ec 08             	sub    $0x8,%esp
+  800ab6:	53                   	push   %ebx
+  800ab7:	6a 2d                	push   $0x2d
+  800ab9:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800abb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800abe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ac1:	f7 da                	neg    %edx
+  800ac3:	83 d1 00             	adc    $0x0,%ecx
+  800ac6:	f7 d9                	neg    %ecx
+  800ac8:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800acb:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ad0:	e9 f0 00 00 00       	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800ad5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad8:	8b 30                	mov    (%eax),%esi
+  800ada:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800add:	89 f0                	mov    %esi,%eax
+  800adf:	c1 f8 1f             	sar    $0x1f,%eax
+  800ae2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800ae5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae8:	8d 40 04             	lea    0x4(%eax),%eax
+  800aeb:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aee:	eb b0                	jmp    800aa0 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800af0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800af3:	89 55 10             	mov    %edx,0x10(%ebp)
+  800af6:	83 f9 01             	cmp    $0x1,%ecx
+  800af9:	7f 1e                	jg     800b19 <vprintfmt+0x37a>
+	else if (lflag)
+  800afb:	85 c9                	test   %ecx,%ecx
+  800afd:	74 32                	je     800b31 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800aff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b02:	8b 10                	mov    (%eax),%edx
+  800b04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b09:	8d 40 04             	lea    0x4(%eax),%eax
+  800b0c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b0f:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800b14:	e9 ac 00 00 00       	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1c:	8b 10                	mov    (%eax),%edx
+  800b1e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b21:	8d 40 08             	lea    0x8(%eax),%eax
+  800b24:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b27:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800b2c:	e9 94 00 00 00       	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b31:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b34:	8b 10                	mov    (%eax),%edx
+  800b36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b3e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b41:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800b46:	eb 7d                	jmp    800bc5 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800b48:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b4b:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b4e:	83 f9 01             	cmp    $0x1,%ecx
+  800b51:	7f 1b                	jg     800b6e <vprintfmt+0x3cf>
+	else if (lflag)
+  800b53:	85 c9                	test   %ecx,%ecx
+  800b55:	74 2c                	je     800b83 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800b57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b5a:	8b 10                	mov    (%eax),%edx
+  800b5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b61:	8d 40 04             	lea    0x4(%eax),%eax
+  800b64:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b67:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800b6c:	eb 57                	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b71:	8b 10                	mov    (%eax),%edx
+  800b73:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b76:	8d 40 08             	lea    0x8(%eax),%eax
+  800b79:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b7c:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800b81:	eb 42                	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b86:	8b 10                	mov    (%eax),%edx
+  800b88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b90:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b93:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b98:	eb 2b                	jmp    800bc5 <vprintfmt+0x426>
+			putch('0', putdat);
+  800b9a:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b9d:	83 ec 08             	sub    $0x8,%esp
+  800ba0:	53                   	push   %ebx
+  800ba1:	6a 30                	push   $0x30
+  800ba3:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800ba5:	83 c4 08             	add    $0x8,%esp
+  800ba8:	53                   	push   %ebx
+  800ba9:	6a 78                	push   $0x78
+  800bab:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800bad:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb0:	8b 10                	mov    (%eax),%edx
+  800bb2:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800bb7:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800bba:	8d 40 04             	lea    0x4(%eax),%eax
+  800bbd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc0:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800bc5:	83 ec 0c             	sub    $0xc,%esp
+  800bc8:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800bcc:	50                   	push   %eax
+  800bcd:	ff 75 e4             	push   -0x1c(%ebp)
+  800bd0:	56                   	push   %esi
+  800bd1:	51                   	push   %ecx
+  800bd2:	52                   	push   %edx
+  800bd3:	89 da                	mov    %ebx,%edx
+  800bd5:	89 f8                	mov    %edi,%eax
+  800bd7:	e8 d8 fa ff ff       	call   8006b4 <printnum>
+			break;
+  800bdc:	83 c4 20             	add    $0x20,%esp
+  800bdf:	e9 cc fb ff ff       	jmp    8007b0 <vprintfmt+0x11>
+	if (lflag >= 2)
+  800be4:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800be7:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bea:	83 f9 01             	cmp    $0x1,%ecx
+  800bed:	7f 1b                	jg     800c0a <vprintfmt+0x46b>
+	else if (lflag)
+  800bef:	85 c9                	test   %ecx,%ecx
+  800bf1:	74 2c                	je     800c1f <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800bf3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf6:	8b 10                	mov    (%eax),%edx
+  800bf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfd:	8d 40 04             	lea    0x4(%eax),%eax
+  800c00:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c03:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800c08:	eb bb                	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800c0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c0d:	8b 10                	mov    (%eax),%edx
+  800c0f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c12:	8d 40 08             	lea    0x8(%eax),%eax
+  800c15:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c18:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800c1d:	eb a6                	jmp    800bc5 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800c1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c22:	8b 10                	mov    (%eax),%edx
+  800c24:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c29:	8d 40 04             	lea    0x4(%eax),%eax
+  800c2c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c2f:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800c34:	eb 8f                	jmp    800bc5 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800c36:	89 55 10             	mov    %edx,0x10(%ebp)
+  800c39:	83 ec 08             	sub    $0x8,%esp
+  800c3c:	53                   	push   %ebx
+  800c3d:	6a 25                	push   $0x25
+  800c3f:	ff d7                	call   *%edi
+			break;
+  800c41:	83 c4 10             	add    $0x10,%esp
+  800c44:	e9 67 fb ff ff       	jmp    8007b0 <vprintfmt+0x11>
+			putch('%', putdat);
+  800c49:	83 ec 08             	sub    $0x8,%esp
+  800c4c:	53                   	push   %ebx
+  800c4d:	6a 25                	push   $0x25
+  800c4f:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c51:	83 c4 10             	add    $0x10,%esp
+  800c54:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800c58:	0f 84 ba fb ff ff    	je     800818 <vprintfmt+0x79>
+  800c5e:	89 75 10             	mov    %esi,0x10(%ebp)
+  800c61:	89 f0                	mov    %esi,%eax
+  800c63:	83 e8 01             	sub    $0x1,%eax
+  800c66:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c6a:	75 f7                	jne    800c63 <vprintfmt+0x4c4>
+  800c6c:	89 45 10             	mov    %eax,0x10(%ebp)
+  800c6f:	e9 3c fb ff ff       	jmp    8007b0 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c74:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c77:	8d 70 01             	lea    0x1(%eax),%esi
+  800c7a:	0f b6 00             	movzbl (%eax),%eax
+  800c7d:	0f be d0             	movsbl %al,%edx
+  800c80:	85 d2                	test   %edx,%edx
+  800c82:	74 11                	je     800c95 <vprintfmt+0x4f6>
+  800c84:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c87:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c8a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c8d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c90:	e9 5d fd ff ff       	jmp    8009f2 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c95:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c98:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c9b:	e9 10 fb ff ff       	jmp    8007b0 <vprintfmt+0x11>
+  800ca0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800ca3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ca6:	e9 05 fb ff ff       	jmp    8007b0 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800cab:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800caf:	7e 0a                	jle    800cbb <vprintfmt+0x51c>
+  800cb1:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800cb5:	0f 85 bd fc ff ff    	jne    800978 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cbb:	ba 28 00 00 00       	mov    $0x28,%edx
+  800cc0:	b8 28 00 00 00       	mov    $0x28,%eax
+  800cc5:	be 25 52 80 00       	mov    $0x805225,%esi
+  800cca:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800ccd:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800cd0:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800cd3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800cd6:	e9 17 fd ff ff       	jmp    8009f2 <vprintfmt+0x253>
+}
+  800cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	83 ec 18             	sub    $0x18,%esp
+  800ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cec:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800cef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800cf2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800cf6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800cf9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	74 26                	je     800d2a <vsnprintf+0x47>
+  800d04:	85 d2                	test   %edx,%edx
+  800d06:	7e 22                	jle    800d2a <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d08:	ff 75 14             	push   0x14(%ebp)
+  800d0b:	ff 75 10             	push   0x10(%ebp)
+  800d0e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d11:	50                   	push   %eax
+  800d12:	68 65 07 80 00       	push   $0x800765
+  800d17:	e8 83 fa ff ff       	call   80079f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800d1c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d1f:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d25:	83 c4 10             	add    $0x10,%esp
+}
+  800d28:	c9                   	leave
+  800d29:	c3                   	ret
+		return -E_INVAL;
+  800d2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d2f:	eb f7                	jmp    800d28 <vsnprintf+0x45>
+
+00800d31 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d31:	55                   	push   %ebp
+  800d32:	89 e5                	mov    %esp,%ebp
+  800d34:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800d37:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d3a:	50                   	push   %eax
+  800d3b:	ff 75 10             	push   0x10(%ebp)
+  800d3e:	ff 75 0c             	push   0xc(%ebp)
+  800d41:	ff 75 08             	push   0x8(%ebp)
+  800d44:	e8 9a ff ff ff       	call   800ce3 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d49:	c9                   	leave
+  800d4a:	c3                   	ret
+
+00800d4b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d4b:	55                   	push   %ebp
+  800d4c:	89 e5                	mov    %esp,%ebp
+  800d4e:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d51:	80 3a 00             	cmpb   $0x0,(%edx)
+  800d54:	74 10                	je     800d66 <strlen+0x1b>
+  800d56:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800d5b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d5e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d62:	75 f7                	jne    800d5b <strlen+0x10>
+	return n;
+}
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800d66:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800d6b:	eb f7                	jmp    800d64 <strlen+0x19>
+
+00800d6d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d73:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d76:	85 d2                	test   %edx,%edx
+  800d78:	74 16                	je     800d90 <strnlen+0x23>
+  800d7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d83:	74 09                	je     800d8e <strnlen+0x21>
+		n++;
+  800d85:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d88:	39 d0                	cmp    %edx,%eax
+  800d8a:	75 f3                	jne    800d7f <strnlen+0x12>
+		n++;
+  800d8c:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d95:	eb f7                	jmp    800d8e <strnlen+0x21>
+
+00800d97 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	53                   	push   %ebx
+  800d9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d9e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800da1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da6:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800daa:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800dad:	83 c0 01             	add    $0x1,%eax
+  800db0:	84 d2                	test   %dl,%dl
+  800db2:	75 f2                	jne    800da6 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800db4:	89 c8                	mov    %ecx,%eax
+  800db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800db9:	c9                   	leave
+  800dba:	c3                   	ret
+
+00800dbb <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	53                   	push   %ebx
+  800dbf:	83 ec 10             	sub    $0x10,%esp
+  800dc2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800dc5:	53                   	push   %ebx
+  800dc6:	e8 80 ff ff ff       	call   800d4b <strlen>
+  800dcb:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800dce:	ff 75 0c             	push   0xc(%ebp)
+  800dd1:	01 d8                	add    %ebx,%eax
+  800dd3:	50                   	push   %eax
+  800dd4:	e8 be ff ff ff       	call   800d97 <strcpy>
+	return dst;
+}
+  800dd9:	89 d8                	mov    %ebx,%eax
+  800ddb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dde:	c9                   	leave
+  800ddf:	c3                   	ret
+
+00800de0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  800de5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800de8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800deb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800dee:	85 db                	test   %ebx,%ebx
+  800df0:	74 17                	je     800e09 <strncpy+0x29>
+  800df2:	01 f3                	add    %esi,%ebx
+  800df4:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800df6:	83 c0 01             	add    $0x1,%eax
+  800df9:	0f b6 0a             	movzbl (%edx),%ecx
+  800dfc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800dff:	80 f9 01             	cmp    $0x1,%cl
+  800e02:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800e05:	39 c3                	cmp    %eax,%ebx
+  800e07:	75 ed                	jne    800df6 <strncpy+0x16>
+	}
+	return ret;
+}
+  800e09:	89 f0                	mov    %esi,%eax
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5d                   	pop    %ebp
+  800e0e:	c3                   	ret
+
+00800e0f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	56                   	push   %esi
+  800e13:	53                   	push   %ebx
+  800e14:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800e1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800e1d:	89 f0                	mov    %esi,%eax
+  800e1f:	85 db                	test   %ebx,%ebx
+  800e21:	74 1e                	je     800e41 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800e23:	83 eb 01             	sub    $0x1,%ebx
+  800e26:	74 16                	je     800e3e <strlcpy+0x2f>
+  800e28:	01 f3                	add    %esi,%ebx
+  800e2a:	0f b6 0a             	movzbl (%edx),%ecx
+  800e2d:	84 c9                	test   %cl,%cl
+  800e2f:	74 0d                	je     800e3e <strlcpy+0x2f>
+			*dst++ = *src++;
+  800e31:	83 c2 01             	add    $0x1,%edx
+  800e34:	83 c0 01             	add    $0x1,%eax
+  800e37:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800e3a:	39 d8                	cmp    %ebx,%eax
+  800e3c:	75 ec                	jne    800e2a <strlcpy+0x1b>
+		*dst = '\0';
+  800e3e:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800e41:	29 f0                	sub    %esi,%eax
+}
+  800e43:	5b                   	pop    %ebx
+  800e44:	5e                   	pop    %esi
+  800e45:	5d                   	pop    %ebp
+  800e46:	c3                   	ret
+
+00800e47 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e47:	55                   	push   %ebp
+  800e48:	89 e5                	mov    %esp,%ebp
+  800e4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e50:	0f b6 01             	movzbl (%ecx),%eax
+  800e53:	84 c0                	test   %al,%al
+  800e55:	74 11                	je     800e68 <strcmp+0x21>
+  800e57:	38 02                	cmp    %al,(%edx)
+  800e59:	75 0d                	jne    800e68 <strcmp+0x21>
+		p++, q++;
+  800e5b:	83 c1 01             	add    $0x1,%ecx
+  800e5e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e61:	0f b6 01             	movzbl (%ecx),%eax
+  800e64:	84 c0                	test   %al,%al
+  800e66:	75 ef                	jne    800e57 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e68:	0f b6 c0             	movzbl %al,%eax
+  800e6b:	0f b6 12             	movzbl (%edx),%edx
+  800e6e:	29 d0                	sub    %edx,%eax
+}
+  800e70:	5d                   	pop    %ebp
+  800e71:	c3                   	ret
+
+00800e72 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	53                   	push   %ebx
+  800e76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800e7c:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800e84:	85 d2                	test   %edx,%edx
+  800e86:	74 2e                	je     800eb6 <strncmp+0x44>
+  800e88:	0f b6 01             	movzbl (%ecx),%eax
+  800e8b:	84 c0                	test   %al,%al
+  800e8d:	74 16                	je     800ea5 <strncmp+0x33>
+  800e8f:	3a 03                	cmp    (%ebx),%al
+  800e91:	75 12                	jne    800ea5 <strncmp+0x33>
+		n--, p++, q++;
+  800e93:	83 c1 01             	add    $0x1,%ecx
+  800e96:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e99:	83 ea 01             	sub    $0x1,%edx
+  800e9c:	75 ea                	jne    800e88 <strncmp+0x16>
+		return 0;
+  800e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea3:	eb 11                	jmp    800eb6 <strncmp+0x44>
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800eaa:	85 d2                	test   %edx,%edx
+  800eac:	74 08                	je     800eb6 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800eae:	0f b6 01             	movzbl (%ecx),%eax
+  800eb1:	0f b6 13             	movzbl (%ebx),%edx
+  800eb4:	29 d0                	sub    %edx,%eax
+}
+  800eb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800eb9:	c9                   	leave
+  800eba:	c3                   	ret
+
+00800ebb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ec5:	0f b6 10             	movzbl (%eax),%edx
+  800ec8:	84 d2                	test   %dl,%dl
+  800eca:	74 15                	je     800ee1 <strchr+0x26>
+		if (*s == c)
+  800ecc:	38 d1                	cmp    %dl,%cl
+  800ece:	74 0f                	je     800edf <strchr+0x24>
+	for (; *s; s++)
+  800ed0:	83 c0 01             	add    $0x1,%eax
+  800ed3:	0f b6 10             	movzbl (%eax),%edx
+  800ed6:	84 d2                	test   %dl,%dl
+  800ed8:	75 f2                	jne    800ecc <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800eda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+	return 0;
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	eb f7                	jmp    800edf <strchr+0x24>
+
+00800ee8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	53                   	push   %ebx
+  800eec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eef:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800ef2:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ef5:	38 d3                	cmp    %dl,%bl
+  800ef7:	74 14                	je     800f0d <strfind+0x25>
+  800ef9:	89 d1                	mov    %edx,%ecx
+  800efb:	84 db                	test   %bl,%bl
+  800efd:	74 0e                	je     800f0d <strfind+0x25>
+	for (; *s; s++)
+  800eff:	83 c0 01             	add    $0x1,%eax
+  800f02:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800f05:	38 ca                	cmp    %cl,%dl
+  800f07:	74 04                	je     800f0d <strfind+0x25>
+  800f09:	84 d2                	test   %dl,%dl
+  800f0b:	75 f2                	jne    800eff <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800f0d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f10:	c9                   	leave
+  800f11:	c3                   	ret
+
+00800f12 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800f1c:	85 c9                	test   %ecx,%ecx
+  800f1e:	74 20                	je     800f40 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800f20:	89 f8                	mov    %edi,%eax
+  800f22:	09 c8                	or     %ecx,%eax
+  800f24:	a8 03                	test   $0x3,%al
+  800f26:	75 12                	jne    800f3a <memset+0x28>
+		c &= 0xFF;
+  800f28:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f2c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800f32:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800f35:	fc                   	cld
+  800f36:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f38:	eb 06                	jmp    800f40 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800f3a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f3d:	fc                   	cld
+  800f3e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800f40:	89 f8                	mov    %edi,%eax
+  800f42:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+00800f47 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f47:	55                   	push   %ebp
+  800f48:	89 e5                	mov    %esp,%ebp
+  800f4a:	57                   	push   %edi
+  800f4b:	56                   	push   %esi
+  800f4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f52:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800f55:	39 c6                	cmp    %eax,%esi
+  800f57:	73 32                	jae    800f8b <memmove+0x44>
+  800f59:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f5c:	39 d0                	cmp    %edx,%eax
+  800f5e:	73 2b                	jae    800f8b <memmove+0x44>
+		s += n;
+		d += n;
+  800f60:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f63:	89 d6                	mov    %edx,%esi
+  800f65:	09 fe                	or     %edi,%esi
+  800f67:	09 ce                	or     %ecx,%esi
+  800f69:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f6f:	75 0e                	jne    800f7f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f71:	83 ef 04             	sub    $0x4,%edi
+  800f74:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f77:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f7a:	fd                   	std
+  800f7b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f7d:	eb 09                	jmp    800f88 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f7f:	83 ef 01             	sub    $0x1,%edi
+  800f82:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f85:	fd                   	std
+  800f86:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f88:	fc                   	cld
+  800f89:	eb 1a                	jmp    800fa5 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f8b:	89 f2                	mov    %esi,%edx
+  800f8d:	09 c2                	or     %eax,%edx
+  800f8f:	09 ca                	or     %ecx,%edx
+  800f91:	f6 c2 03             	test   $0x3,%dl
+  800f94:	75 0a                	jne    800fa0 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f96:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f99:	89 c7                	mov    %eax,%edi
+  800f9b:	fc                   	cld
+  800f9c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f9e:	eb 05                	jmp    800fa5 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800fa0:	89 c7                	mov    %eax,%edi
+  800fa2:	fc                   	cld
+  800fa3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800fa5:	5e                   	pop    %esi
+  800fa6:	5f                   	pop    %edi
+  800fa7:	5d                   	pop    %ebp
+  800fa8:	c3                   	ret
+
+00800fa9 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800fa9:	55                   	push   %ebp
+  800faa:	89 e5                	mov    %esp,%ebp
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800faf:	ff 75 10             	push   0x10(%ebp)
+  800fb2:	ff 75 0c             	push   0xc(%ebp)
+  800fb5:	ff 75 08             	push   0x8(%ebp)
+  800fb8:	e8 8a ff ff ff       	call   800f47 <memmove>
+}
+  800fbd:	c9                   	leave
+  800fbe:	c3                   	ret
+
+00800fbf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	56                   	push   %esi
+  800fc3:	53                   	push   %ebx
+  800fc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fca:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800fcd:	85 f6                	test   %esi,%esi
+  800fcf:	74 29                	je     800ffa <memcmp+0x3b>
+  800fd1:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800fd3:	0f b6 08             	movzbl (%eax),%ecx
+  800fd6:	0f b6 1a             	movzbl (%edx),%ebx
+  800fd9:	38 d9                	cmp    %bl,%cl
+  800fdb:	75 11                	jne    800fee <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800fdd:	83 c0 01             	add    $0x1,%eax
+  800fe0:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800fe3:	39 c6                	cmp    %eax,%esi
+  800fe5:	75 ec                	jne    800fd3 <memcmp+0x14>
+	}
+
+	return 0;
+  800fe7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fec:	eb 08                	jmp    800ff6 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800fee:	0f b6 c1             	movzbl %cl,%eax
+  800ff1:	0f b6 db             	movzbl %bl,%ebx
+  800ff4:	29 d8                	sub    %ebx,%eax
+}
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+	return 0;
+  800ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fff:	eb f5                	jmp    800ff6 <memcmp+0x37>
+
+00801001 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801001:	55                   	push   %ebp
+  801002:	89 e5                	mov    %esp,%ebp
+  801004:	8b 45 08             	mov    0x8(%ebp),%eax
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  80100a:	89 c2                	mov    %eax,%edx
+  80100c:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  80100f:	39 d0                	cmp    %edx,%eax
+  801011:	73 0d                	jae    801020 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801013:	38 08                	cmp    %cl,(%eax)
+  801015:	74 0d                	je     801024 <memfind+0x23>
+	for (; s < ends; s++)
+  801017:	83 c0 01             	add    $0x1,%eax
+  80101a:	39 c2                	cmp    %eax,%edx
+  80101c:	75 f5                	jne    801013 <memfind+0x12>
+  80101e:	eb 06                	jmp    801026 <memfind+0x25>
+  801020:	89 c2                	mov    %eax,%edx
+  801022:	eb 02                	jmp    801026 <memfind+0x25>
+  801024:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  801026:	89 d0                	mov    %edx,%eax
+  801028:	5d                   	pop    %ebp
+  801029:	c3                   	ret
+
+0080102a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801036:	0f b6 02             	movzbl (%edx),%eax
+  801039:	3c 20                	cmp    $0x20,%al
+  80103b:	74 04                	je     801041 <strtol+0x17>
+  80103d:	3c 09                	cmp    $0x9,%al
+  80103f:	75 0e                	jne    80104f <strtol+0x25>
+		s++;
+  801041:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801044:	0f b6 02             	movzbl (%edx),%eax
+  801047:	3c 20                	cmp    $0x20,%al
+  801049:	74 f6                	je     801041 <strtol+0x17>
+  80104b:	3c 09                	cmp    $0x9,%al
+  80104d:	74 f2                	je     801041 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  80104f:	3c 2b                	cmp    $0x2b,%al
+  801051:	74 2a                	je     80107d <strtol+0x53>
+	int neg = 0;
+  801053:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  801058:	3c 2d                	cmp    $0x2d,%al
+  80105a:	74 2b                	je     801087 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80105c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801062:	75 0f                	jne    801073 <strtol+0x49>
+  801064:	80 3a 30             	cmpb   $0x30,(%edx)
+  801067:	74 28                	je     801091 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  801069:	85 db                	test   %ebx,%ebx
+  80106b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801070:	0f 44 d8             	cmove  %eax,%ebx
+  801073:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801078:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80107b:	eb 46                	jmp    8010c3 <strtol+0x99>
+		s++;
+  80107d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801080:	bf 00 00 00 00       	mov    $0x0,%edi
+  801085:	eb d5                	jmp    80105c <strtol+0x32>
+		s++, neg = 1;
+  801087:	83 c2 01             	add    $0x1,%edx
+  80108a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80108f:	eb cb                	jmp    80105c <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801091:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801095:	74 0e                	je     8010a5 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801097:	85 db                	test   %ebx,%ebx
+  801099:	75 d8                	jne    801073 <strtol+0x49>
+		s++, base = 8;
+  80109b:	83 c2 01             	add    $0x1,%edx
+  80109e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8010a3:	eb ce                	jmp    801073 <strtol+0x49>
+		s += 2, base = 16;
+  8010a5:	83 c2 02             	add    $0x2,%edx
+  8010a8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8010ad:	eb c4                	jmp    801073 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010af:	0f be c0             	movsbl %al,%eax
+  8010b2:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8010b5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8010b8:	7d 3a                	jge    8010f4 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  8010ba:	83 c2 01             	add    $0x1,%edx
+  8010bd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8010c1:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8010c3:	0f b6 02             	movzbl (%edx),%eax
+  8010c6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8010c9:	89 f3                	mov    %esi,%ebx
+  8010cb:	80 fb 09             	cmp    $0x9,%bl
+  8010ce:	76 df                	jbe    8010af <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  8010d0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010d3:	89 f3                	mov    %esi,%ebx
+  8010d5:	80 fb 19             	cmp    $0x19,%bl
+  8010d8:	77 08                	ja     8010e2 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  8010da:	0f be c0             	movsbl %al,%eax
+  8010dd:	83 e8 57             	sub    $0x57,%eax
+  8010e0:	eb d3                	jmp    8010b5 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  8010e2:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010e5:	89 f3                	mov    %esi,%ebx
+  8010e7:	80 fb 19             	cmp    $0x19,%bl
+  8010ea:	77 08                	ja     8010f4 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  8010ec:	0f be c0             	movsbl %al,%eax
+  8010ef:	83 e8 37             	sub    $0x37,%eax
+  8010f2:	eb c1                	jmp    8010b5 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  8010f4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010f8:	74 05                	je     8010ff <strtol+0xd5>
+		*endptr = (char *) s;
+  8010fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010fd:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  8010ff:	89 c8                	mov    %ecx,%eax
+  801101:	f7 d8                	neg    %eax
+  801103:	85 ff                	test   %edi,%edi
+  801105:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801108:	89 c8                	mov    %ecx,%eax
+  80110a:	5b                   	pop    %ebx
+  80110b:	5e                   	pop    %esi
+  80110c:	5f                   	pop    %edi
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+
+0080110f <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	57                   	push   %edi
+  801113:	56                   	push   %esi
+  801114:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801120:	89 c3                	mov    %eax,%ebx
+  801122:	89 c7                	mov    %eax,%edi
+  801124:	89 c6                	mov    %eax,%esi
+  801126:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+
+0080112d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801133:	ba 00 00 00 00       	mov    $0x0,%edx
+  801138:	b8 01 00 00 00       	mov    $0x1,%eax
+  80113d:	89 d1                	mov    %edx,%ecx
+  80113f:	89 d3                	mov    %edx,%ebx
+  801141:	89 d7                	mov    %edx,%edi
+  801143:	89 d6                	mov    %edx,%esi
+  801145:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801155:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80115a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801162:	89 cb                	mov    %ecx,%ebx
+  801164:	89 cf                	mov    %ecx,%edi
+  801166:	89 ce                	mov    %ecx,%esi
+  801168:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	7f 08                	jg     801176 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80116e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801176:	83 ec 0c             	sub    $0xc,%esp
+  801179:	50                   	push   %eax
+  80117a:	6a 03                	push   $0x3
+  80117c:	68 4b 55 80 00       	push   $0x80554b
+  801181:	6a 23                	push   $0x23
+  801183:	68 68 55 80 00       	push   $0x805568
+  801188:	e8 38 f4 ff ff       	call   8005c5 <_panic>
+
+0080118d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801193:	ba 00 00 00 00       	mov    $0x0,%edx
+  801198:	b8 02 00 00 00       	mov    $0x2,%eax
+  80119d:	89 d1                	mov    %edx,%ecx
+  80119f:	89 d3                	mov    %edx,%ebx
+  8011a1:	89 d7                	mov    %edx,%edi
+  8011a3:	89 d6                	mov    %edx,%esi
+  8011a5:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8011a7:	5b                   	pop    %ebx
+  8011a8:	5e                   	pop    %esi
+  8011a9:	5f                   	pop    %edi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+
+008011ac <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	57                   	push   %edi
+  8011b0:	56                   	push   %esi
+  8011b1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8011bc:	89 d1                	mov    %edx,%ecx
+  8011be:	89 d3                	mov    %edx,%ebx
+  8011c0:	89 d7                	mov    %edx,%edi
+  8011c2:	89 d6                	mov    %edx,%esi
+  8011c4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8011c6:	5b                   	pop    %ebx
+  8011c7:	5e                   	pop    %esi
+  8011c8:	5f                   	pop    %edi
+  8011c9:	5d                   	pop    %ebp
+  8011ca:	c3                   	ret
+
+008011cb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	57                   	push   %edi
+  8011cf:	56                   	push   %esi
+  8011d0:	53                   	push   %ebx
+  8011d1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011df:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011e4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e7:	89 f7                	mov    %esi,%edi
+  8011e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011eb:	85 c0                	test   %eax,%eax
+  8011ed:	7f 08                	jg     8011f7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8011ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f2:	5b                   	pop    %ebx
+  8011f3:	5e                   	pop    %esi
+  8011f4:	5f                   	pop    %edi
+  8011f5:	5d                   	pop    %ebp
+  8011f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f7:	83 ec 0c             	sub    $0xc,%esp
+  8011fa:	50                   	push   %eax
+  8011fb:	6a 04                	push   $0x4
+  8011fd:	68 4b 55 80 00       	push   $0x80554b
+  801202:	6a 23                	push   $0x23
+  801204:	68 68 55 80 00       	push   $0x805568
+  801209:	e8 b7 f3 ff ff       	call   8005c5 <_panic>
+
+0080120e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	57                   	push   %edi
+  801212:	56                   	push   %esi
+  801213:	53                   	push   %ebx
+  801214:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801228:	8b 75 18             	mov    0x18(%ebp),%esi
+  80122b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	7f 08                	jg     801239 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801234:	5b                   	pop    %ebx
+  801235:	5e                   	pop    %esi
+  801236:	5f                   	pop    %edi
+  801237:	5d                   	pop    %ebp
+  801238:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	50                   	push   %eax
+  80123d:	6a 05                	push   $0x5
+  80123f:	68 4b 55 80 00       	push   $0x80554b
+  801244:	6a 23                	push   $0x23
+  801246:	68 68 55 80 00       	push   $0x805568
+  80124b:	e8 75 f3 ff ff       	call   8005c5 <_panic>
+
+00801250 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	57                   	push   %edi
+  801254:	56                   	push   %esi
+  801255:	53                   	push   %ebx
+  801256:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801264:	b8 06 00 00 00       	mov    $0x6,%eax
+  801269:	89 df                	mov    %ebx,%edi
+  80126b:	89 de                	mov    %ebx,%esi
+  80126d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	7f 08                	jg     80127b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801276:	5b                   	pop    %ebx
+  801277:	5e                   	pop    %esi
+  801278:	5f                   	pop    %edi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	50                   	push   %eax
+  80127f:	6a 06                	push   $0x6
+  801281:	68 4b 55 80 00       	push   $0x80554b
+  801286:	6a 23                	push   $0x23
+  801288:	68 68 55 80 00       	push   $0x805568
+  80128d:	e8 33 f3 ff ff       	call   8005c5 <_panic>
+
+00801292 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	57                   	push   %edi
+  801296:	56                   	push   %esi
+  801297:	53                   	push   %ebx
+  801298:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80129b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012ab:	89 df                	mov    %ebx,%edi
+  8012ad:	89 de                	mov    %ebx,%esi
+  8012af:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	7f 08                	jg     8012bd <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b8:	5b                   	pop    %ebx
+  8012b9:	5e                   	pop    %esi
+  8012ba:	5f                   	pop    %edi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	50                   	push   %eax
+  8012c1:	6a 08                	push   $0x8
+  8012c3:	68 4b 55 80 00       	push   $0x80554b
+  8012c8:	6a 23                	push   $0x23
+  8012ca:	68 68 55 80 00       	push   $0x805568
+  8012cf:	e8 f1 f2 ff ff       	call   8005c5 <_panic>
+
+008012d4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+  8012da:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8012ed:	89 df                	mov    %ebx,%edi
+  8012ef:	89 de                	mov    %ebx,%esi
+  8012f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	7f 08                	jg     8012ff <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8012f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fa:	5b                   	pop    %ebx
+  8012fb:	5e                   	pop    %esi
+  8012fc:	5f                   	pop    %edi
+  8012fd:	5d                   	pop    %ebp
+  8012fe:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  801302:	50                   	push   %eax
+  801303:	6a 09                	push   $0x9
+  801305:	68 4b 55 80 00       	push   $0x80554b
+  80130a:	6a 23                	push   $0x23
+  80130c:	68 68 55 80 00       	push   $0x805568
+  801311:	e8 af f2 ff ff       	call   8005c5 <_panic>
+
+00801316 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801316:	55                   	push   %ebp
+  801317:	89 e5                	mov    %esp,%ebp
+  801319:	57                   	push   %edi
+  80131a:	56                   	push   %esi
+  80131b:	53                   	push   %ebx
+  80131c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80131f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801324:	8b 55 08             	mov    0x8(%ebp),%edx
+  801327:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80132f:	89 df                	mov    %ebx,%edi
+  801331:	89 de                	mov    %ebx,%esi
+  801333:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801335:	85 c0                	test   %eax,%eax
+  801337:	7f 08                	jg     801341 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  801344:	50                   	push   %eax
+  801345:	6a 0a                	push   $0xa
+  801347:	68 4b 55 80 00       	push   $0x80554b
+  80134c:	6a 23                	push   $0x23
+  80134e:	68 68 55 80 00       	push   $0x805568
+  801353:	e8 6d f2 ff ff       	call   8005c5 <_panic>
+
+00801358 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801358:	55                   	push   %ebp
+  801359:	89 e5                	mov    %esp,%ebp
+  80135b:	57                   	push   %edi
+  80135c:	56                   	push   %esi
+  80135d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80135e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801361:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801364:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801369:	be 00 00 00 00       	mov    $0x0,%esi
+  80136e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801371:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801374:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801376:	5b                   	pop    %ebx
+  801377:	5e                   	pop    %esi
+  801378:	5f                   	pop    %edi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+
+0080137b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+  801381:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801384:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801389:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801391:	89 cb                	mov    %ecx,%ebx
+  801393:	89 cf                	mov    %ecx,%edi
+  801395:	89 ce                	mov    %ecx,%esi
+  801397:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	7f 08                	jg     8013a5 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80139d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a0:	5b                   	pop    %ebx
+  8013a1:	5e                   	pop    %esi
+  8013a2:	5f                   	pop    %edi
+  8013a3:	5d                   	pop    %ebp
+  8013a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	50                   	push   %eax
+  8013a9:	6a 0d                	push   $0xd
+  8013ab:	68 4b 55 80 00       	push   $0x80554b
+  8013b0:	6a 23                	push   $0x23
+  8013b2:	68 68 55 80 00       	push   $0x805568
+  8013b7:	e8 09 f2 ff ff       	call   8005c5 <_panic>
+
+008013bc <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  8013bf:	57                   	push   %edi
+  8013c0:	56                   	push   %esi
+  8013c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013d6:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8013d8:	5b                   	pop    %ebx
+  8013d9:	5e                   	pop    %esi
+  8013da:	5f                   	pop    %edi
+  8013db:	5d                   	pop    %ebp
+  8013dc:	c3                   	ret
+
+008013dd <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8013dd:	55                   	push   %ebp
+  8013de:	89 e5                	mov    %esp,%ebp
+  8013e0:	57                   	push   %edi
+  8013e1:	56                   	push   %esi
+  8013e2:	53                   	push   %ebx
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013f6:	89 df                	mov    %ebx,%edi
+  8013f8:	89 de                	mov    %ebx,%esi
+  8013fa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013fc:	85 c0                	test   %eax,%eax
+  8013fe:	7f 08                	jg     801408 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  801400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801403:	5b                   	pop    %ebx
+  801404:	5e                   	pop    %esi
+  801405:	5f                   	pop    %edi
+  801406:	5d                   	pop    %ebp
+  801407:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801408:	83 ec 0c             	sub    $0xc,%esp
+  80140b:	50                   	push   %eax
+  80140c:	6a 0d                	push   $0xd
+  80140e:	68 4b 55 80 00       	push   $0x80554b
+  801413:	6a 23                	push   $0x23
+  801415:	68 68 55 80 00       	push   $0x805568
+  80141a:	e8 a6 f1 ff ff       	call   8005c5 <_panic>
+
+0080141f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	57                   	push   %edi
+  801423:	56                   	push   %esi
+  801424:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801425:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80142f:	89 d1                	mov    %edx,%ecx
+  801431:	89 d3                	mov    %edx,%ebx
+  801433:	89 d7                	mov    %edx,%edi
+  801435:	89 d6                	mov    %edx,%esi
+  801437:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801439:	5b                   	pop    %ebx
+  80143a:	5e                   	pop    %esi
+  80143b:	5f                   	pop    %edi
+  80143c:	5d                   	pop    %ebp
+  80143d:	c3                   	ret
+
+0080143e <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80143e:	55                   	push   %ebp
+  80143f:	89 e5                	mov    %esp,%ebp
+  801441:	57                   	push   %edi
+  801442:	56                   	push   %esi
+  801443:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801444:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801449:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801454:	89 df                	mov    %ebx,%edi
+  801456:	89 de                	mov    %ebx,%esi
+  801458:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  80145a:	5b                   	pop    %ebx
+  80145b:	5e                   	pop    %esi
+  80145c:	5f                   	pop    %edi
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+
+0080145f <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	57                   	push   %edi
+  801463:	56                   	push   %esi
+  801464:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801465:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80146a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801472:	89 cb                	mov    %ecx,%ebx
+  801474:	89 cf                	mov    %ecx,%edi
+  801476:	89 ce                	mov    %ecx,%esi
+  801478:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5f                   	pop    %edi
+  80147d:	5d                   	pop    %ebp
+  80147e:	c3                   	ret
+
+0080147f <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80147f:	55                   	push   %ebp
+  801480:	89 e5                	mov    %esp,%ebp
+  801482:	57                   	push   %edi
+  801483:	56                   	push   %esi
+  801484:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801485:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801490:	b8 11 00 00 00       	mov    $0x11,%eax
+  801495:	89 df                	mov    %ebx,%edi
+  801497:	89 de                	mov    %ebx,%esi
+  801499:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  80149b:	5b                   	pop    %ebx
+  80149c:	5e                   	pop    %esi
+  80149d:	5f                   	pop    %edi
+  80149e:	5d                   	pop    %ebp
+  80149f:	c3                   	ret
+
+008014a0 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	57                   	push   %edi
+  8014a4:	56                   	push   %esi
+  8014a5:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b1:	b8 12 00 00 00       	mov    $0x12,%eax
+  8014b6:	89 df                	mov    %ebx,%edi
+  8014b8:	89 de                	mov    %ebx,%esi
+  8014ba:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8014bc:	5b                   	pop    %ebx
+  8014bd:	5e                   	pop    %esi
+  8014be:	5f                   	pop    %edi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+
+008014c1 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8014c1:	55                   	push   %ebp
+  8014c2:	89 e5                	mov    %esp,%ebp
+  8014c4:	57                   	push   %edi
+  8014c5:	56                   	push   %esi
+  8014c6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014d4:	89 cb                	mov    %ecx,%ebx
+  8014d6:	89 cf                	mov    %ecx,%edi
+  8014d8:	89 ce                	mov    %ecx,%esi
+  8014da:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+
+008014e1 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014f2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8014f7:	89 df                	mov    %ebx,%edi
+  8014f9:	89 de                	mov    %ebx,%esi
+  8014fb:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8014fd:	5b                   	pop    %ebx
+  8014fe:	5e                   	pop    %esi
+  8014ff:	5f                   	pop    %edi
+  801500:	5d                   	pop    %ebp
+  801501:	c3                   	ret
+
+00801502 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	57                   	push   %edi
+  801506:	56                   	push   %esi
+  801507:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801508:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80150d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801510:	b8 15 00 00 00       	mov    $0x15,%eax
+  801515:	89 cb                	mov    %ecx,%ebx
+  801517:	89 cf                	mov    %ecx,%edi
+  801519:	89 ce                	mov    %ecx,%esi
+  80151b:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5f                   	pop    %edi
+  801520:	5d                   	pop    %ebp
+  801521:	c3                   	ret
+
+00801522 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  801522:	55                   	push   %ebp
+  801523:	89 e5                	mov    %esp,%ebp
+  801525:	57                   	push   %edi
+  801526:	56                   	push   %esi
+  801527:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+  80152d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801530:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801533:	b8 16 00 00 00       	mov    $0x16,%eax
+  801538:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153b:	89 f7                	mov    %esi,%edi
+  80153d:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80153f:	5b                   	pop    %ebx
+  801540:	5e                   	pop    %esi
+  801541:	5f                   	pop    %edi
+  801542:	5d                   	pop    %ebp
+  801543:	c3                   	ret
+
+00801544 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801544:	55                   	push   %ebp
+  801545:	89 e5                	mov    %esp,%ebp
+  801547:	57                   	push   %edi
+  801548:	56                   	push   %esi
+  801549:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80154a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801552:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801555:	b8 17 00 00 00       	mov    $0x17,%eax
+  80155a:	89 df                	mov    %ebx,%edi
+  80155c:	89 de                	mov    %ebx,%esi
+  80155e:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+
+00801565 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	57                   	push   %edi
+  801569:	56                   	push   %esi
+  80156a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80156b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	b8 18 00 00 00       	mov    $0x18,%eax
+  801578:	89 cb                	mov    %ecx,%ebx
+  80157a:	89 cf                	mov    %ecx,%edi
+  80157c:	89 ce                	mov    %ecx,%esi
+  80157e:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5f                   	pop    %edi
+  801583:	5d                   	pop    %ebp
+  801584:	c3                   	ret
+
+00801585 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801585:	55                   	push   %ebp
+  801586:	89 e5                	mov    %esp,%ebp
+  801588:	57                   	push   %edi
+  801589:	56                   	push   %esi
+  80158a:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  80158b:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80158f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801594:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801597:	b8 19 00 00 00       	mov    $0x19,%eax
+  80159c:	89 df                	mov    %ebx,%edi
+  80159e:	89 de                	mov    %ebx,%esi
+  8015a0:	cd 30                	int    $0x30
+}
+  8015a2:	5b                   	pop    %ebx
+  8015a3:	5e                   	pop    %esi
+  8015a4:	5f                   	pop    %edi
+  8015a5:	5d                   	pop    %ebp
+  8015a6:	c3                   	ret
+
+008015a7 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  8015a7:	55                   	push   %ebp
+  8015a8:	89 e5                	mov    %esp,%ebp
+  8015aa:	57                   	push   %edi
+  8015ab:	56                   	push   %esi
+  8015ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8015bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015c0:	89 f7                	mov    %esi,%edi
+  8015c2:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8015c4:	5b                   	pop    %ebx
+  8015c5:	5e                   	pop    %esi
+  8015c6:	5f                   	pop    %edi
+  8015c7:	5d                   	pop    %ebp
+  8015c8:	c3                   	ret
+
+008015c9 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	57                   	push   %edi
+  8015cd:	56                   	push   %esi
+  8015ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8015d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8015df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015e2:	89 f7                	mov    %esi,%edi
+  8015e4:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8015e6:	5b                   	pop    %ebx
+  8015e7:	5e                   	pop    %esi
+  8015e8:	5f                   	pop    %edi
+  8015e9:	5d                   	pop    %ebp
+  8015ea:	c3                   	ret
+
+008015eb <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	57                   	push   %edi
+  8015ef:	56                   	push   %esi
+  8015f0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801601:	89 df                	mov    %ebx,%edi
+  801603:	89 de                	mov    %ebx,%esi
+  801605:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801607:	5b                   	pop    %ebx
+  801608:	5e                   	pop    %esi
+  801609:	5f                   	pop    %edi
+  80160a:	5d                   	pop    %ebp
+  80160b:	c3                   	ret
+
+0080160c <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  80160c:	55                   	push   %ebp
+  80160d:	89 e5                	mov    %esp,%ebp
+  80160f:	57                   	push   %edi
+  801610:	56                   	push   %esi
+  801611:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801612:	be 00 00 00 00       	mov    $0x0,%esi
+  801617:	8b 55 08             	mov    0x8(%ebp),%edx
+  80161a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80161d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  801622:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801625:	89 f7                	mov    %esi,%edi
+  801627:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801629:	5b                   	pop    %ebx
+  80162a:	5e                   	pop    %esi
+  80162b:	5f                   	pop    %edi
+  80162c:	5d                   	pop    %ebp
+  80162d:	c3                   	ret
+
+0080162e <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80162e:	85 c0                	test   %eax,%eax
+  801630:	74 20                	je     801652 <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  801632:	89 c1                	mov    %eax,%ecx
+  801634:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80163a:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  801640:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801646:	8b 52 48             	mov    0x48(%edx),%edx
+  801649:	39 c2                	cmp    %eax,%edx
+  80164b:	74 06                	je     801653 <thread_alive+0x25>
+  80164d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801652:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801653:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801659:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  80165f:	85 c0                	test   %eax,%eax
+  801661:	0f 95 c0             	setne  %al
+  801664:	0f b6 c0             	movzbl %al,%eax
+  801667:	c3                   	ret
+
+00801668 <pgfault>:
+{
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	57                   	push   %edi
+  80166c:	56                   	push   %esi
+  80166d:	53                   	push   %ebx
+  80166e:	83 ec 0c             	sub    $0xc,%esp
+  801671:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801674:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801676:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801679:	89 f3                	mov    %esi,%ebx
+  80167b:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  80167e:	83 3d e0 80 80 00 00 	cmpl   $0x0,0x8080e0
+  801685:	74 52                	je     8016d9 <pgfault+0x71>
+  801687:	a8 02                	test   $0x2,%al
+  801689:	75 14                	jne    80169f <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  80168b:	83 ec 04             	sub    $0x4,%esp
+  80168e:	68 76 55 80 00       	push   $0x805576
+  801693:	6a 2e                	push   $0x2e
+  801695:	68 94 55 80 00       	push   $0x805594
+  80169a:	e8 26 ef ff ff       	call   8005c5 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  80169f:	89 d8                	mov    %ebx,%eax
+  8016a1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016a6:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  8016ad:	83 ec 0c             	sub    $0xc,%esp
+  8016b0:	57                   	push   %edi
+  8016b1:	e8 65 32 00 00       	call   80491b <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8016b6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8016bd:	83 e0 03             	and    $0x3,%eax
+  8016c0:	83 c4 10             	add    $0x10,%esp
+  8016c3:	83 f8 03             	cmp    $0x3,%eax
+  8016c6:	75 1a                	jne    8016e2 <pgfault+0x7a>
+			mutex_unlock(m);
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	57                   	push   %edi
+  8016cc:	e8 b8 32 00 00       	call   804989 <mutex_unlock>
+			return;
+  8016d1:	83 c4 10             	add    $0x10,%esp
+  8016d4:	e9 9f 00 00 00       	jmp    801778 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8016d9:	a8 02                	test   $0x2,%al
+  8016db:	74 ae                	je     80168b <pgfault+0x23>
+	struct mutex *m = NULL;
+  8016dd:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8016e2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8016e9:	f6 c4 08             	test   $0x8,%ah
+  8016ec:	74 9d                	je     80168b <pgfault+0x23>
+  8016ee:	89 e0                	mov    %esp,%eax
+  8016f0:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8016f5:	29 c2                	sub    %eax,%edx
+  8016f7:	89 d0                	mov    %edx,%eax
+  8016f9:	c1 e8 0f             	shr    $0xf,%eax
+  8016fc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801702:	ba 00 00 00 00       	mov    $0x0,%edx
+  801707:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  80170a:	c1 e0 0c             	shl    $0xc,%eax
+  80170d:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  801712:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801714:	83 ec 04             	sub    $0x4,%esp
+  801717:	6a 07                	push   $0x7
+  801719:	53                   	push   %ebx
+  80171a:	6a 00                	push   $0x0
+  80171c:	e8 aa fa ff ff       	call   8011cb <sys_page_alloc>
+  801721:	83 c4 10             	add    $0x10,%esp
+  801724:	85 c0                	test   %eax,%eax
+  801726:	78 58                	js     801780 <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801728:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80172e:	83 ec 04             	sub    $0x4,%esp
+  801731:	68 00 10 00 00       	push   $0x1000
+  801736:	56                   	push   %esi
+  801737:	53                   	push   %ebx
+  801738:	e8 0a f8 ff ff       	call   800f47 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  80173d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801744:	56                   	push   %esi
+  801745:	6a 00                	push   $0x0
+  801747:	53                   	push   %ebx
+  801748:	6a 00                	push   $0x0
+  80174a:	e8 bf fa ff ff       	call   80120e <sys_page_map>
+  80174f:	83 c4 20             	add    $0x20,%esp
+  801752:	85 c0                	test   %eax,%eax
+  801754:	78 3c                	js     801792 <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801756:	83 ec 08             	sub    $0x8,%esp
+  801759:	53                   	push   %ebx
+  80175a:	6a 00                	push   $0x0
+  80175c:	e8 ef fa ff ff       	call   801250 <sys_page_unmap>
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	85 c0                	test   %eax,%eax
+  801766:	78 3c                	js     8017a4 <pgfault+0x13c>
+	if(m)
+  801768:	85 ff                	test   %edi,%edi
+  80176a:	74 0c                	je     801778 <pgfault+0x110>
+		mutex_unlock(m);
+  80176c:	83 ec 0c             	sub    $0xc,%esp
+  80176f:	57                   	push   %edi
+  801770:	e8 14 32 00 00       	call   804989 <mutex_unlock>
+  801775:	83 c4 10             	add    $0x10,%esp
+}
+  801778:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177b:	5b                   	pop    %ebx
+  80177c:	5e                   	pop    %esi
+  80177d:	5f                   	pop    %edi
+  80177e:	5d                   	pop    %ebp
+  80177f:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  801780:	50                   	push   %eax
+  801781:	68 9f 55 80 00       	push   $0x80559f
+  801786:	6a 3d                	push   $0x3d
+  801788:	68 94 55 80 00       	push   $0x805594
+  80178d:	e8 33 ee ff ff       	call   8005c5 <_panic>
+		panic("sys_page_map: %e", ret);
+  801792:	50                   	push   %eax
+  801793:	68 b2 55 80 00       	push   $0x8055b2
+  801798:	6a 40                	push   $0x40
+  80179a:	68 94 55 80 00       	push   $0x805594
+  80179f:	e8 21 ee ff ff       	call   8005c5 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  8017a4:	50                   	push   %eax
+  8017a5:	68 c3 55 80 00       	push   $0x8055c3
+  8017aa:	6a 42                	push   $0x42
+  8017ac:	68 94 55 80 00       	push   $0x805594
+  8017b1:	e8 0f ee ff ff       	call   8005c5 <_panic>
+
+008017b6 <thread_main>:
+{
+  8017b6:	55                   	push   %ebp
+  8017b7:	89 e5                	mov    %esp,%ebp
+  8017b9:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8017bc:	ff 75 0c             	push   0xc(%ebp)
+  8017bf:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8017c2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8017c9:	e8 7e f9 ff ff       	call   80114c <sys_env_destroy>
+}
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+
+008017d3 <fork>:
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8017dc:	68 68 16 80 00       	push   $0x801668
+  8017e1:	e8 aa 32 00 00       	call   804a90 <set_pgfault_handler>
+	if(sforked)
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	83 3d e0 80 80 00 00 	cmpl   $0x0,0x8080e0
+  8017f0:	75 33                	jne    801825 <fork+0x52>
+	__asm __volatile("int %2"
+  8017f2:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017f7:	cd 30                	int    $0x30
+  8017f9:	89 c7                	mov    %eax,%edi
+  8017fb:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8017fd:	85 c0                	test   %eax,%eax
+  8017ff:	0f 88 b4 00 00 00    	js     8018b9 <fork+0xe6>
+	if(envid == 0) {
+  801805:	0f 84 c3 00 00 00    	je     8018ce <fork+0xfb>
+	pgbatch_init(&pb);
+  80180b:	83 ec 0c             	sub    $0xc,%esp
+  80180e:	68 40 73 80 00       	push   $0x807340
+  801813:	e8 4f 2f 00 00       	call   804767 <pgbatch_init>
+  801818:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80181b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801820:	e9 9c 01 00 00       	jmp    8019c1 <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801825:	83 ec 0c             	sub    $0xc,%esp
+  801828:	68 e0 76 80 00       	push   $0x8076e0
+  80182d:	e8 e9 30 00 00       	call   80491b <mutex_lock>
+  801832:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801835:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80183a:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80183f:	eb 08                	jmp    801849 <fork+0x76>
+  801841:	83 c3 01             	add    $0x1,%ebx
+  801844:	83 fb 20             	cmp    $0x20,%ebx
+  801847:	74 5b                	je     8018a4 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801849:	8b 34 9d 60 76 80 00 	mov    0x807660(,%ebx,4),%esi
+  801850:	89 f0                	mov    %esi,%eax
+  801852:	e8 d7 fd ff ff       	call   80162e <thread_alive>
+  801857:	85 c0                	test   %eax,%eax
+  801859:	74 e6                	je     801841 <fork+0x6e>
+  80185b:	89 e0                	mov    %esp,%eax
+  80185d:	89 fa                	mov    %edi,%edx
+  80185f:	29 c2                	sub    %eax,%edx
+  801861:	89 d0                	mov    %edx,%eax
+  801863:	c1 e8 0f             	shr    $0xf,%eax
+  801866:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80186c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801871:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801874:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  80187b:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  80187e:	83 ec 08             	sub    $0x8,%esp
+  801881:	50                   	push   %eax
+  801882:	56                   	push   %esi
+  801883:	e8 8e fa ff ff       	call   801316 <sys_env_set_pgfault_upcall>
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	79 b2                	jns    801841 <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  80188f:	50                   	push   %eax
+  801890:	68 50 56 80 00       	push   $0x805650
+  801895:	68 00 01 00 00       	push   $0x100
+  80189a:	68 94 55 80 00       	push   $0x805594
+  80189f:	e8 21 ed ff ff       	call   8005c5 <_panic>
+	mutex_unlock(&sfork_lock);
+  8018a4:	83 ec 0c             	sub    $0xc,%esp
+  8018a7:	68 e0 76 80 00       	push   $0x8076e0
+  8018ac:	e8 d8 30 00 00       	call   804989 <mutex_unlock>
+}
+  8018b1:	83 c4 10             	add    $0x10,%esp
+  8018b4:	e9 39 ff ff ff       	jmp    8017f2 <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8018b9:	50                   	push   %eax
+  8018ba:	68 d6 55 80 00       	push   $0x8055d6
+  8018bf:	68 91 00 00 00       	push   $0x91
+  8018c4:	68 94 55 80 00       	push   $0x805594
+  8018c9:	e8 f7 ec ff ff       	call   8005c5 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018ce:	e8 ba f8 ff ff       	call   80118d <sys_getenvid>
+  8018d3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018d8:	89 e1                	mov    %esp,%ecx
+  8018da:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8018df:	29 ca                	sub    %ecx,%edx
+  8018e1:	89 d1                	mov    %edx,%ecx
+  8018e3:	c1 e9 0f             	shr    $0xf,%ecx
+  8018e6:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8018ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f1:	0f 42 d1             	cmovb  %ecx,%edx
+  8018f4:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8018fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018ff:	89 04 95 60 80 80 00 	mov    %eax,0x808060(,%edx,4)
+		if(sforked)
+  801906:	a1 e0 80 80 00       	mov    0x8080e0,%eax
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	75 07                	jne    801916 <fork+0x143>
+		return 0;
+  80190f:	89 c6                	mov    %eax,%esi
+  801911:	e9 6f 02 00 00       	jmp    801b85 <fork+0x3b2>
+  801916:	89 e2                	mov    %esp,%edx
+  801918:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80191d:	29 d0                	sub    %edx,%eax
+  80191f:	89 c3                	mov    %eax,%ebx
+  801921:	c1 eb 0f             	shr    $0xf,%ebx
+  801924:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  801931:	83 ec 04             	sub    $0x4,%esp
+  801934:	68 80 00 00 00       	push   $0x80
+  801939:	6a 00                	push   $0x0
+  80193b:	68 60 76 80 00       	push   $0x807660
+  801940:	e8 cd f5 ff ff       	call   800f12 <memset>
+	thread_ids[slot] = sys_getenvid();
+  801945:	e8 43 f8 ff ff       	call   80118d <sys_getenvid>
+  80194a:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  801951:	8b 04 9d 60 80 80 00 	mov    0x808060(,%ebx,4),%eax
+  801958:	a3 60 80 80 00       	mov    %eax,0x808060
+	mutex_init(&sfork_lock);
+  80195d:	c7 04 24 e0 76 80 00 	movl   $0x8076e0,(%esp)
+  801964:	e8 a4 2f 00 00       	call   80490d <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801969:	83 c4 0c             	add    $0xc,%esp
+  80196c:	68 07 04 00 00       	push   $0x407
+  801971:	68 00 00 00 e1       	push   $0xe1000000
+  801976:	6a 00                	push   $0x0
+  801978:	e8 4e f8 ff ff       	call   8011cb <sys_page_alloc>
+  80197d:	83 c4 10             	add    $0x10,%esp
+  801980:	85 c0                	test   %eax,%eax
+  801982:	0f 89 fd 01 00 00    	jns    801b85 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801988:	50                   	push   %eax
+  801989:	68 9f 55 80 00       	push   $0x80559f
+  80198e:	68 12 01 00 00       	push   $0x112
+  801993:	68 94 55 80 00       	push   $0x805594
+  801998:	e8 28 ec ff ff       	call   8005c5 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80199d:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  8019a3:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  8019a9:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  8019af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8019b5:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8019bb:	0f 87 4f 01 00 00    	ja     801b10 <fork+0x33d>
+		pd = PDX(addr);
+  8019c1:	89 d8                	mov    %ebx,%eax
+  8019c3:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8019c6:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8019cd:	f6 c2 01             	test   $0x1,%dl
+  8019d0:	74 cb                	je     80199d <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8019d2:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8019d7:	0f 85 92 00 00 00    	jne    801a6f <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8019dd:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8019e3:	76 10                	jbe    8019f5 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8019e5:	89 d8                	mov    %ebx,%eax
+  8019e7:	f7 d8                	neg    %eax
+  8019e9:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019ee:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019f3:	74 ba                	je     8019af <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8019f5:	89 d8                	mov    %ebx,%eax
+  8019f7:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8019fa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a01:	f6 c2 01             	test   $0x1,%dl
+  801a04:	74 a9                	je     8019af <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801a06:	89 c1                	mov    %eax,%ecx
+  801a08:	c1 e1 0c             	shl    $0xc,%ecx
+  801a0b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801a0e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a15:	f6 c6 04             	test   $0x4,%dh
+  801a18:	0f 85 8e 00 00 00    	jne    801aac <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801a1e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a25:	f6 c6 08             	test   $0x8,%dh
+  801a28:	75 0f                	jne    801a39 <fork+0x266>
+  801a2a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a31:	a8 02                	test   $0x2,%al
+  801a33:	0f 84 bb 00 00 00    	je     801af4 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801a39:	83 ec 08             	sub    $0x8,%esp
+  801a3c:	68 05 08 00 00       	push   $0x805
+  801a41:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a44:	50                   	push   %eax
+  801a45:	56                   	push   %esi
+  801a46:	50                   	push   %eax
+  801a47:	6a 00                	push   $0x0
+  801a49:	68 40 73 80 00       	push   $0x807340
+  801a4e:	e8 d2 2d 00 00       	call   804825 <pgbatch_map>
+  801a53:	83 c4 20             	add    $0x20,%esp
+  801a56:	85 c0                	test   %eax,%eax
+  801a58:	79 76                	jns    801ad0 <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801a5a:	50                   	push   %eax
+  801a5b:	68 fa 55 80 00       	push   $0x8055fa
+  801a60:	68 bc 00 00 00       	push   $0xbc
+  801a65:	68 94 55 80 00       	push   $0x805594
+  801a6a:	e8 56 eb ff ff       	call   8005c5 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  801a6f:	83 ec 0c             	sub    $0xc,%esp
+  801a72:	68 00 08 00 00       	push   $0x800
+  801a77:	56                   	push   %esi
+  801a78:	53                   	push   %ebx
+  801a79:	6a 00                	push   $0x0
+  801a7b:	68 40 73 80 00       	push   $0x807340
+  801a80:	e8 4b 2e 00 00       	call   8048d0 <pgbatch_sharept>
+  801a85:	83 c4 20             	add    $0x20,%esp
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 0b                	js     801a97 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801a8c:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801a92:	e9 18 ff ff ff       	jmp    8019af <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801a97:	50                   	push   %eax
+  801a98:	68 e6 55 80 00       	push   $0x8055e6
+  801a9d:	68 b2 00 00 00       	push   $0xb2
+  801aa2:	68 94 55 80 00       	push   $0x805594
+  801aa7:	e8 19 eb ff ff       	call   8005c5 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801aac:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+  801ab6:	25 07 0e 00 00       	and    $0xe07,%eax
+  801abb:	50                   	push   %eax
+  801abc:	51                   	push   %ecx
+  801abd:	56                   	push   %esi
+  801abe:	51                   	push   %ecx
+  801abf:	6a 00                	push   $0x0
+  801ac1:	68 40 73 80 00       	push   $0x807340
+  801ac6:	e8 5a 2d 00 00       	call   804825 <pgbatch_map>
+  801acb:	83 c4 20             	add    $0x20,%esp
+  801ace:	eb 17                	jmp    801ae7 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801ad0:	68 05 08 00 00       	push   $0x805
+  801ad5:	ff 75 e4             	push   -0x1c(%ebp)
+  801ad8:	6a 00                	push   $0x0
+  801ada:	68 40 73 80 00       	push   $0x807340
+  801adf:	e8 b5 2d 00 00       	call   804899 <pgbatch_protect>
+  801ae4:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801ae7:	85 c0                	test   %eax,%eax
+  801ae9:	0f 89 c0 fe ff ff    	jns    8019af <fork+0x1dc>
+  801aef:	e9 66 ff ff ff       	jmp    801a5a <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801af4:	83 ec 08             	sub    $0x8,%esp
+  801af7:	6a 05                	push   $0x5
+  801af9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801afc:	50                   	push   %eax
+  801afd:	56                   	push   %esi
+  801afe:	50                   	push   %eax
+  801aff:	6a 00                	push   $0x0
+  801b01:	68 40 73 80 00       	push   $0x807340
+  801b06:	e8 1a 2d 00 00       	call   804825 <pgbatch_map>
+  801b0b:	83 c4 20             	add    $0x20,%esp
+  801b0e:	eb d7                	jmp    801ae7 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801b10:	6a 07                	push   $0x7
+  801b12:	68 00 f0 bf ee       	push   $0xeebff000
+  801b17:	57                   	push   %edi
+  801b18:	68 40 73 80 00       	push   $0x807340
+  801b1d:	e8 cc 2c 00 00       	call   8047ee <pgbatch_alloc>
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	78 66                	js     801b8f <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801b29:	83 ec 0c             	sub    $0xc,%esp
+  801b2c:	68 40 73 80 00       	push   $0x807340
+  801b31:	e8 3f 2c 00 00       	call   804775 <pgbatch_flush>
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 52                	js     801b8f <fork+0x3bc>
+  801b3d:	89 e2                	mov    %esp,%edx
+  801b3f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b44:	29 d0                	sub    %edx,%eax
+  801b46:	89 c2                	mov    %eax,%edx
+  801b48:	c1 ea 0f             	shr    $0xf,%edx
+  801b4b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b55:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801b58:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  801b5f:	8b 40 78             	mov    0x78(%eax),%eax
+  801b62:	83 ec 08             	sub    $0x8,%esp
+  801b65:	50                   	push   %eax
+  801b66:	57                   	push   %edi
+  801b67:	e8 aa f7 ff ff       	call   801316 <sys_env_set_pgfault_upcall>
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 31                	js     801ba4 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801b73:	83 ec 08             	sub    $0x8,%esp
+  801b76:	6a 02                	push   $0x2
+  801b78:	57                   	push   %edi
+  801b79:	e8 14 f7 ff ff       	call   801292 <sys_env_set_status>
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	85 c0                	test   %eax,%eax
+  801b83:	78 34                	js     801bb9 <fork+0x3e6>
+}
+  801b85:	89 f0                	mov    %esi,%eax
+  801b87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8a:	5b                   	pop    %ebx
+  801b8b:	5e                   	pop    %esi
+  801b8c:	5f                   	pop    %edi
+  801b8d:	5d                   	pop    %ebp
+  801b8e:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801b8f:	50                   	push   %eax
+  801b90:	68 06 56 80 00       	push   $0x805606
+  801b95:	68 c0 00 00 00       	push   $0xc0
+  801b9a:	68 94 55 80 00       	push   $0x805594
+  801b9f:	e8 21 ea ff ff       	call   8005c5 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801ba4:	50                   	push   %eax
+  801ba5:	68 1b 56 80 00       	push   $0x80561b
+  801baa:	68 c2 00 00 00       	push   $0xc2
+  801baf:	68 94 55 80 00       	push   $0x805594
+  801bb4:	e8 0c ea ff ff       	call   8005c5 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801bb9:	50                   	push   %eax
+  801bba:	68 36 56 80 00       	push   $0x805636
+  801bbf:	68 c4 00 00 00       	push   $0xc4
+  801bc4:	68 94 55 80 00       	push   $0x805594
+  801bc9:	e8 f7 e9 ff ff       	call   8005c5 <_panic>
+
+00801bce <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801bce:	55                   	push   %ebp
+  801bcf:	89 e5                	mov    %esp,%ebp
+  801bd1:	57                   	push   %edi
+  801bd2:	56                   	push   %esi
+  801bd3:	53                   	push   %ebx
+  801bd4:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801bd7:	68 e0 76 80 00       	push   $0x8076e0
+  801bdc:	e8 3a 2d 00 00       	call   80491b <mutex_lock>
+  801be1:	89 e2                	mov    %esp,%edx
+  801be3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801be8:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801bea:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801bed:	89 c3                	mov    %eax,%ebx
+  801bef:	c1 eb 0f             	shr    $0xf,%ebx
+  801bf2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bfc:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801bff:	e8 89 f5 ff ff       	call   80118d <sys_getenvid>
+  801c04:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801c0b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801c10:	8b 04 9d 60 76 80 00 	mov    0x807660(,%ebx,4),%eax
+  801c17:	e8 12 fa ff ff       	call   80162e <thread_alive>
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	74 24                	je     801c44 <sfork+0x76>
+  801c20:	83 c3 01             	add    $0x1,%ebx
+  801c23:	83 fb 20             	cmp    $0x20,%ebx
+  801c26:	75 e8                	jne    801c10 <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801c28:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801c2d:	83 ec 0c             	sub    $0xc,%esp
+  801c30:	68 e0 76 80 00       	push   $0x8076e0
+  801c35:	e8 4f 2d 00 00       	call   804989 <mutex_unlock>
+	return r;
+}
+  801c3a:	89 f0                	mov    %esi,%eax
+  801c3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5f                   	pop    %edi
+  801c42:	5d                   	pop    %ebp
+  801c43:	c3                   	ret
+	if (i == NTHREADS) {
+  801c44:	83 fb 20             	cmp    $0x20,%ebx
+  801c47:	0f 84 53 01 00 00    	je     801da0 <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801c4d:	89 d8                	mov    %ebx,%eax
+  801c4f:	c1 e0 0f             	shl    $0xf,%eax
+  801c52:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801c55:	83 ec 0c             	sub    $0xc,%esp
+  801c58:	68 20 70 80 00       	push   $0x807020
+  801c5d:	e8 05 2b 00 00       	call   804767 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801c62:	83 c4 10             	add    $0x10,%esp
+  801c65:	83 3d e0 80 80 00 00 	cmpl   $0x0,0x8080e0
+  801c6c:	75 1f                	jne    801c8d <sfork+0xbf>
+  801c6e:	68 07 04 00 00       	push   $0x407
+  801c73:	68 00 00 00 e1       	push   $0xe1000000
+  801c78:	6a 00                	push   $0x0
+  801c7a:	68 20 70 80 00       	push   $0x807020
+  801c7f:	e8 6a 2b 00 00       	call   8047ee <pgbatch_alloc>
+  801c84:	89 c6                	mov    %eax,%esi
+  801c86:	83 c4 10             	add    $0x10,%esp
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 a0                	js     801c2d <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801c8d:	6a 07                	push   $0x7
+  801c8f:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801c94:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c97:	29 c8                	sub    %ecx,%eax
+  801c99:	50                   	push   %eax
+  801c9a:	6a 00                	push   $0x0
+  801c9c:	68 20 70 80 00       	push   $0x807020
+  801ca1:	e8 48 2b 00 00       	call   8047ee <pgbatch_alloc>
+  801ca6:	89 c6                	mov    %eax,%esi
+  801ca8:	83 c4 10             	add    $0x10,%esp
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	0f 88 7a ff ff ff    	js     801c2d <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801cb3:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801cb8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801cbb:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801cbd:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801cc2:	29 c8                	sub    %ecx,%eax
+  801cc4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801cc7:	39 c7                	cmp    %eax,%edi
+  801cc9:	73 29                	jae    801cf4 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801ccb:	6a 07                	push   $0x7
+  801ccd:	57                   	push   %edi
+  801cce:	6a 00                	push   $0x0
+  801cd0:	68 20 70 80 00       	push   $0x807020
+  801cd5:	e8 14 2b 00 00       	call   8047ee <pgbatch_alloc>
+  801cda:	89 c6                	mov    %eax,%esi
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	85 c0                	test   %eax,%eax
+  801ce1:	0f 88 46 ff ff ff    	js     801c2d <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801ce7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801ced:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cf0:	39 c7                	cmp    %eax,%edi
+  801cf2:	72 d7                	jb     801ccb <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801cf4:	83 ec 0c             	sub    $0xc,%esp
+  801cf7:	68 20 70 80 00       	push   $0x807020
+  801cfc:	e8 74 2a 00 00       	call   804775 <pgbatch_flush>
+  801d01:	89 c6                	mov    %eax,%esi
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	0f 88 1f ff ff ff    	js     801c2d <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801d0e:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801d13:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801d16:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801d18:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801d1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801d21:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801d24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d27:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801d2a:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801d2d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801d32:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801d34:	52                   	push   %edx
+  801d35:	50                   	push   %eax
+  801d36:	68 b6 17 80 00       	push   $0x8017b6
+  801d3b:	e8 cc f8 ff ff       	call   80160c <sys_exofork_shared>
+  801d40:	89 c6                	mov    %eax,%esi
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	0f 88 e0 fe ff ff    	js     801c2d <sfork+0x5f>
+	thread_ids[i] = id;
+  801d4d:	89 04 9d 60 76 80 00 	mov    %eax,0x807660(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801d54:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d59:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801d5f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d64:	89 04 9d 60 80 80 00 	mov    %eax,0x808060(,%ebx,4)
+	sforked = 1;
+  801d6b:	c7 05 e0 80 80 00 01 	movl   $0x1,0x8080e0
+  801d72:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	6a 02                	push   $0x2
+  801d7a:	56                   	push   %esi
+  801d7b:	e8 12 f5 ff ff       	call   801292 <sys_env_set_status>
+  801d80:	89 c3                	mov    %eax,%ebx
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	0f 89 a0 fe ff ff    	jns    801c2d <sfork+0x5f>
+		sys_env_destroy(id);
+  801d8d:	83 ec 0c             	sub    $0xc,%esp
+  801d90:	56                   	push   %esi
+  801d91:	e8 b6 f3 ff ff       	call   80114c <sys_env_destroy>
+		goto out;
+  801d96:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d99:	89 de                	mov    %ebx,%esi
+		goto out;
+  801d9b:	e9 8d fe ff ff       	jmp    801c2d <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801da0:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801da5:	e9 83 fe ff ff       	jmp    801c2d <sfork+0x5f>
+
+00801daa <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801daa:	55                   	push   %ebp
+  801dab:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db0:	05 00 00 00 30       	add    $0x30000000,%eax
+  801db5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801db8:	5d                   	pop    %ebp
+  801db9:	c3                   	ret
+
+00801dba <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801dbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc0:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801dc5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dca:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801dcf:	5d                   	pop    %ebp
+  801dd0:	c3                   	ret
+
+00801dd1 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801dd1:	55                   	push   %ebp
+  801dd2:	89 e5                	mov    %esp,%ebp
+  801dd4:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801dd9:	89 c2                	mov    %eax,%edx
+  801ddb:	c1 ea 16             	shr    $0x16,%edx
+  801dde:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801de5:	f6 c2 01             	test   $0x1,%dl
+  801de8:	74 29                	je     801e13 <fd_alloc+0x42>
+  801dea:	89 c2                	mov    %eax,%edx
+  801dec:	c1 ea 0c             	shr    $0xc,%edx
+  801def:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801df6:	f6 c2 01             	test   $0x1,%dl
+  801df9:	74 18                	je     801e13 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801dfb:	05 00 10 00 00       	add    $0x1000,%eax
+  801e00:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801e05:	75 d2                	jne    801dd9 <fd_alloc+0x8>
+  801e07:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801e0c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801e11:	eb 05                	jmp    801e18 <fd_alloc+0x47>
+			return 0;
+  801e13:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801e18:	8b 55 08             	mov    0x8(%ebp),%edx
+  801e1b:	89 02                	mov    %eax,(%edx)
+}
+  801e1d:	89 c8                	mov    %ecx,%eax
+  801e1f:	5d                   	pop    %ebp
+  801e20:	c3                   	ret
+
+00801e21 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e27:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801e2c:	77 30                	ja     801e5e <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e2e:	c1 e0 0c             	shl    $0xc,%eax
+  801e31:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801e36:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e3c:	f6 c2 01             	test   $0x1,%dl
+  801e3f:	74 24                	je     801e65 <fd_lookup+0x44>
+  801e41:	89 c2                	mov    %eax,%edx
+  801e43:	c1 ea 0c             	shr    $0xc,%edx
+  801e46:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e4d:	f6 c2 01             	test   $0x1,%dl
+  801e50:	74 1a                	je     801e6c <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e55:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e5c:	5d                   	pop    %ebp
+  801e5d:	c3                   	ret
+		return -E_INVAL;
+  801e5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e63:	eb f7                	jmp    801e5c <fd_lookup+0x3b>
+		return -E_INVAL;
+  801e65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e6a:	eb f0                	jmp    801e5c <fd_lookup+0x3b>
+  801e6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e71:	eb e9                	jmp    801e5c <fd_lookup+0x3b>
+
+00801e73 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	53                   	push   %ebx
+  801e77:	83 ec 04             	sub    $0x4,%esp
+  801e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e82:	bb 40 60 80 00       	mov    $0x806040,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801e87:	39 13                	cmp    %edx,(%ebx)
+  801e89:	74 54                	je     801edf <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801e8b:	83 c0 01             	add    $0x1,%eax
+  801e8e:	8b 1c 85 ec 56 80 00 	mov    0x8056ec(,%eax,4),%ebx
+  801e95:	85 db                	test   %ebx,%ebx
+  801e97:	75 ee                	jne    801e87 <dev_lookup+0x14>
+  801e99:	89 e1                	mov    %esp,%ecx
+  801e9b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ea0:	29 c8                	sub    %ecx,%eax
+  801ea2:	89 c1                	mov    %eax,%ecx
+  801ea4:	c1 e9 0f             	shr    $0xf,%ecx
+  801ea7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb1:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801eb4:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  801ebb:	8b 40 48             	mov    0x48(%eax),%eax
+  801ebe:	83 ec 04             	sub    $0x4,%esp
+  801ec1:	52                   	push   %edx
+  801ec2:	50                   	push   %eax
+  801ec3:	68 70 56 80 00       	push   $0x805670
+  801ec8:	e8 d3 e7 ff ff       	call   8006a0 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ed5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ed8:	89 1a                	mov    %ebx,(%edx)
+}
+  801eda:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801edd:	c9                   	leave
+  801ede:	c3                   	ret
+			return 0;
+  801edf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee4:	eb ef                	jmp    801ed5 <dev_lookup+0x62>
+
+00801ee6 <fd_close>:
+{
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	57                   	push   %edi
+  801eea:	56                   	push   %esi
+  801eeb:	53                   	push   %ebx
+  801eec:	83 ec 24             	sub    $0x24,%esp
+  801eef:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ef2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ef5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ef8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ef9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801eff:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801f02:	50                   	push   %eax
+  801f03:	e8 19 ff ff ff       	call   801e21 <fd_lookup>
+  801f08:	89 c3                	mov    %eax,%ebx
+  801f0a:	83 c4 10             	add    $0x10,%esp
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	78 05                	js     801f16 <fd_close+0x30>
+	    || fd != fd2)
+  801f11:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801f14:	74 0f                	je     801f25 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801f16:	85 ff                	test   %edi,%edi
+  801f18:	0f 44 df             	cmove  %edi,%ebx
+}
+  801f1b:	89 d8                	mov    %ebx,%eax
+  801f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5f                   	pop    %edi
+  801f23:	5d                   	pop    %ebp
+  801f24:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f25:	83 ec 08             	sub    $0x8,%esp
+  801f28:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f2b:	50                   	push   %eax
+  801f2c:	ff 36                	push   (%esi)
+  801f2e:	e8 40 ff ff ff       	call   801e73 <dev_lookup>
+  801f33:	89 c3                	mov    %eax,%ebx
+  801f35:	83 c4 10             	add    $0x10,%esp
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 1a                	js     801f56 <fd_close+0x70>
+		if (dev->dev_close)
+  801f3c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f3f:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f42:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	74 0b                	je     801f56 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801f4b:	83 ec 0c             	sub    $0xc,%esp
+  801f4e:	56                   	push   %esi
+  801f4f:	ff d0                	call   *%eax
+  801f51:	89 c3                	mov    %eax,%ebx
+  801f53:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f56:	83 ec 08             	sub    $0x8,%esp
+  801f59:	56                   	push   %esi
+  801f5a:	6a 00                	push   $0x0
+  801f5c:	e8 ef f2 ff ff       	call   801250 <sys_page_unmap>
+	return r;
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	eb b5                	jmp    801f1b <fd_close+0x35>
+
+00801f66 <close>:
+
+int
+close(int fdnum)
+{
+  801f66:	55                   	push   %ebp
+  801f67:	89 e5                	mov    %esp,%ebp
+  801f69:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f6c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f6f:	50                   	push   %eax
+  801f70:	ff 75 08             	push   0x8(%ebp)
+  801f73:	e8 a9 fe ff ff       	call   801e21 <fd_lookup>
+  801f78:	83 c4 10             	add    $0x10,%esp
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	79 02                	jns    801f81 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f7f:	c9                   	leave
+  801f80:	c3                   	ret
+		return fd_close(fd, 1);
+  801f81:	83 ec 08             	sub    $0x8,%esp
+  801f84:	6a 01                	push   $0x1
+  801f86:	ff 75 f4             	push   -0xc(%ebp)
+  801f89:	e8 58 ff ff ff       	call   801ee6 <fd_close>
+  801f8e:	83 c4 10             	add    $0x10,%esp
+  801f91:	eb ec                	jmp    801f7f <close+0x19>
+
+00801f93 <close_all>:
+
+void
+close_all(void)
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	53                   	push   %ebx
+  801f97:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f9f:	83 ec 0c             	sub    $0xc,%esp
+  801fa2:	53                   	push   %ebx
+  801fa3:	e8 be ff ff ff       	call   801f66 <close>
+	for (i = 0; i < MAXFD; i++)
+  801fa8:	83 c3 01             	add    $0x1,%ebx
+  801fab:	83 c4 10             	add    $0x10,%esp
+  801fae:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801fb4:	75 e9                	jne    801f9f <close_all+0xc>
+}
+  801fb6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+
+00801fbb <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801fbb:	55                   	push   %ebp
+  801fbc:	89 e5                	mov    %esp,%ebp
+  801fbe:	57                   	push   %edi
+  801fbf:	56                   	push   %esi
+  801fc0:	53                   	push   %ebx
+  801fc1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801fc4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fc7:	50                   	push   %eax
+  801fc8:	ff 75 08             	push   0x8(%ebp)
+  801fcb:	e8 51 fe ff ff       	call   801e21 <fd_lookup>
+  801fd0:	89 c3                	mov    %eax,%ebx
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 7f                	js     802058 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801fd9:	83 ec 0c             	sub    $0xc,%esp
+  801fdc:	ff 75 0c             	push   0xc(%ebp)
+  801fdf:	e8 82 ff ff ff       	call   801f66 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801fe4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801fe7:	c1 e6 0c             	shl    $0xc,%esi
+  801fea:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ff0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801ff3:	89 3c 24             	mov    %edi,(%esp)
+  801ff6:	e8 bf fd ff ff       	call   801dba <fd2data>
+  801ffb:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801ffd:	89 34 24             	mov    %esi,(%esp)
+  802000:	e8 b5 fd ff ff       	call   801dba <fd2data>
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  80200b:	89 d8                	mov    %ebx,%eax
+  80200d:	c1 e8 16             	shr    $0x16,%eax
+  802010:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802017:	a8 01                	test   $0x1,%al
+  802019:	74 11                	je     80202c <dup+0x71>
+  80201b:	89 d8                	mov    %ebx,%eax
+  80201d:	c1 e8 0c             	shr    $0xc,%eax
+  802020:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802027:	f6 c2 01             	test   $0x1,%dl
+  80202a:	75 36                	jne    802062 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80202c:	89 f8                	mov    %edi,%eax
+  80202e:	c1 e8 0c             	shr    $0xc,%eax
+  802031:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802038:	83 ec 0c             	sub    $0xc,%esp
+  80203b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802040:	50                   	push   %eax
+  802041:	56                   	push   %esi
+  802042:	6a 00                	push   $0x0
+  802044:	57                   	push   %edi
+  802045:	6a 00                	push   $0x0
+  802047:	e8 c2 f1 ff ff       	call   80120e <sys_page_map>
+  80204c:	89 c3                	mov    %eax,%ebx
+  80204e:	83 c4 20             	add    $0x20,%esp
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 33                	js     802088 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802055:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  802058:	89 d8                	mov    %ebx,%eax
+  80205a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80205d:	5b                   	pop    %ebx
+  80205e:	5e                   	pop    %esi
+  80205f:	5f                   	pop    %edi
+  802060:	5d                   	pop    %ebp
+  802061:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802062:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802069:	83 ec 0c             	sub    $0xc,%esp
+  80206c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802071:	50                   	push   %eax
+  802072:	ff 75 d4             	push   -0x2c(%ebp)
+  802075:	6a 00                	push   $0x0
+  802077:	53                   	push   %ebx
+  802078:	6a 00                	push   $0x0
+  80207a:	e8 8f f1 ff ff       	call   80120e <sys_page_map>
+  80207f:	89 c3                	mov    %eax,%ebx
+  802081:	83 c4 20             	add    $0x20,%esp
+  802084:	85 c0                	test   %eax,%eax
+  802086:	79 a4                	jns    80202c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  802088:	83 ec 08             	sub    $0x8,%esp
+  80208b:	56                   	push   %esi
+  80208c:	6a 00                	push   $0x0
+  80208e:	e8 bd f1 ff ff       	call   801250 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802093:	83 c4 08             	add    $0x8,%esp
+  802096:	ff 75 d4             	push   -0x2c(%ebp)
+  802099:	6a 00                	push   $0x0
+  80209b:	e8 b0 f1 ff ff       	call   801250 <sys_page_unmap>
+	return r;
+  8020a0:	83 c4 10             	add    $0x10,%esp
+  8020a3:	eb b3                	jmp    802058 <dup+0x9d>
+
+008020a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	56                   	push   %esi
+  8020a9:	53                   	push   %ebx
+  8020aa:	83 ec 18             	sub    $0x18,%esp
+  8020ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b3:	50                   	push   %eax
+  8020b4:	53                   	push   %ebx
+  8020b5:	e8 67 fd ff ff       	call   801e21 <fd_lookup>
+  8020ba:	83 c4 10             	add    $0x10,%esp
+  8020bd:	85 c0                	test   %eax,%eax
+  8020bf:	78 3c                	js     8020fd <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020c1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020c4:	83 ec 08             	sub    $0x8,%esp
+  8020c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ca:	50                   	push   %eax
+  8020cb:	ff 36                	push   (%esi)
+  8020cd:	e8 a1 fd ff ff       	call   801e73 <dev_lookup>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	85 c0                	test   %eax,%eax
+  8020d7:	78 24                	js     8020fd <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8020d9:	8b 46 08             	mov    0x8(%esi),%eax
+  8020dc:	83 e0 03             	and    $0x3,%eax
+  8020df:	83 f8 01             	cmp    $0x1,%eax
+  8020e2:	74 20                	je     802104 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8020e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e7:	8b 40 08             	mov    0x8(%eax),%eax
+  8020ea:	85 c0                	test   %eax,%eax
+  8020ec:	74 54                	je     802142 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8020ee:	83 ec 04             	sub    $0x4,%esp
+  8020f1:	ff 75 10             	push   0x10(%ebp)
+  8020f4:	ff 75 0c             	push   0xc(%ebp)
+  8020f7:	56                   	push   %esi
+  8020f8:	ff d0                	call   *%eax
+  8020fa:	83 c4 10             	add    $0x10,%esp
+}
+  8020fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802100:	5b                   	pop    %ebx
+  802101:	5e                   	pop    %esi
+  802102:	5d                   	pop    %ebp
+  802103:	c3                   	ret
+  802104:	89 e2                	mov    %esp,%edx
+  802106:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80210b:	29 d0                	sub    %edx,%eax
+  80210d:	89 c2                	mov    %eax,%edx
+  80210f:	c1 ea 0f             	shr    $0xf,%edx
+  802112:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80211c:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80211f:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  802126:	8b 40 48             	mov    0x48(%eax),%eax
+  802129:	83 ec 04             	sub    $0x4,%esp
+  80212c:	53                   	push   %ebx
+  80212d:	50                   	push   %eax
+  80212e:	68 b1 56 80 00       	push   $0x8056b1
+  802133:	e8 68 e5 ff ff       	call   8006a0 <cprintf>
+		return -E_INVAL;
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802140:	eb bb                	jmp    8020fd <read+0x58>
+		return -E_NOT_SUPP;
+  802142:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802147:	eb b4                	jmp    8020fd <read+0x58>
+
+00802149 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  802149:	55                   	push   %ebp
+  80214a:	89 e5                	mov    %esp,%ebp
+  80214c:	57                   	push   %edi
+  80214d:	56                   	push   %esi
+  80214e:	53                   	push   %ebx
+  80214f:	83 ec 0c             	sub    $0xc,%esp
+  802152:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802155:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  802158:	85 f6                	test   %esi,%esi
+  80215a:	74 30                	je     80218c <readn+0x43>
+  80215c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802161:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802166:	83 ec 04             	sub    $0x4,%esp
+  802169:	89 f2                	mov    %esi,%edx
+  80216b:	29 c2                	sub    %eax,%edx
+  80216d:	52                   	push   %edx
+  80216e:	01 f8                	add    %edi,%eax
+  802170:	50                   	push   %eax
+  802171:	ff 75 08             	push   0x8(%ebp)
+  802174:	e8 2c ff ff ff       	call   8020a5 <read>
+		if (m < 0)
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	78 15                	js     802195 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802180:	74 11                	je     802193 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802182:	01 c3                	add    %eax,%ebx
+  802184:	89 d8                	mov    %ebx,%eax
+  802186:	39 f3                	cmp    %esi,%ebx
+  802188:	72 dc                	jb     802166 <readn+0x1d>
+  80218a:	eb 09                	jmp    802195 <readn+0x4c>
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	eb 02                	jmp    802195 <readn+0x4c>
+  802193:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802195:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802198:	5b                   	pop    %ebx
+  802199:	5e                   	pop    %esi
+  80219a:	5f                   	pop    %edi
+  80219b:	5d                   	pop    %ebp
+  80219c:	c3                   	ret
+
+0080219d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	56                   	push   %esi
+  8021a1:	53                   	push   %ebx
+  8021a2:	83 ec 18             	sub    $0x18,%esp
+  8021a5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ab:	50                   	push   %eax
+  8021ac:	53                   	push   %ebx
+  8021ad:	e8 6f fc ff ff       	call   801e21 <fd_lookup>
+  8021b2:	83 c4 10             	add    $0x10,%esp
+  8021b5:	85 c0                	test   %eax,%eax
+  8021b7:	78 37                	js     8021f0 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021b9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021bc:	83 ec 08             	sub    $0x8,%esp
+  8021bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c2:	50                   	push   %eax
+  8021c3:	ff 36                	push   (%esi)
+  8021c5:	e8 a9 fc ff ff       	call   801e73 <dev_lookup>
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 1f                	js     8021f0 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021d1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8021d5:	74 20                	je     8021f7 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8021d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	74 54                	je     802235 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8021e1:	83 ec 04             	sub    $0x4,%esp
+  8021e4:	ff 75 10             	push   0x10(%ebp)
+  8021e7:	ff 75 0c             	push   0xc(%ebp)
+  8021ea:	56                   	push   %esi
+  8021eb:	ff d0                	call   *%eax
+  8021ed:	83 c4 10             	add    $0x10,%esp
+}
+  8021f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f3:	5b                   	pop    %ebx
+  8021f4:	5e                   	pop    %esi
+  8021f5:	5d                   	pop    %ebp
+  8021f6:	c3                   	ret
+  8021f7:	89 e2                	mov    %esp,%edx
+  8021f9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8021fe:	29 d0                	sub    %edx,%eax
+  802200:	89 c2                	mov    %eax,%edx
+  802202:	c1 ea 0f             	shr    $0xf,%edx
+  802205:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80220a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220f:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802212:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  802219:	8b 40 48             	mov    0x48(%eax),%eax
+  80221c:	83 ec 04             	sub    $0x4,%esp
+  80221f:	53                   	push   %ebx
+  802220:	50                   	push   %eax
+  802221:	68 cd 56 80 00       	push   $0x8056cd
+  802226:	e8 75 e4 ff ff       	call   8006a0 <cprintf>
+		return -E_INVAL;
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802233:	eb bb                	jmp    8021f0 <write+0x53>
+		return -E_NOT_SUPP;
+  802235:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80223a:	eb b4                	jmp    8021f0 <write+0x53>
+
+0080223c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802242:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802245:	50                   	push   %eax
+  802246:	ff 75 08             	push   0x8(%ebp)
+  802249:	e8 d3 fb ff ff       	call   801e21 <fd_lookup>
+  80224e:	83 c4 10             	add    $0x10,%esp
+  802251:	85 c0                	test   %eax,%eax
+  802253:	78 0e                	js     802263 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802255:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80225b:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80225e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802263:	c9                   	leave
+  802264:	c3                   	ret
+
+00802265 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802265:	55                   	push   %ebp
+  802266:	89 e5                	mov    %esp,%ebp
+  802268:	53                   	push   %ebx
+  802269:	83 ec 1c             	sub    $0x1c,%esp
+  80226c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80226f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802272:	50                   	push   %eax
+  802273:	ff 75 08             	push   0x8(%ebp)
+  802276:	e8 a6 fb ff ff       	call   801e21 <fd_lookup>
+  80227b:	83 c4 10             	add    $0x10,%esp
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	78 33                	js     8022b5 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802282:	83 fb 03             	cmp    $0x3,%ebx
+  802285:	74 28                	je     8022af <fcntl+0x4a>
+  802287:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80228c:	83 fb 04             	cmp    $0x4,%ebx
+  80228f:	75 24                	jne    8022b5 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802291:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802294:	8b 41 08             	mov    0x8(%ecx),%eax
+  802297:	80 e4 ef             	and    $0xef,%ah
+  80229a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80229d:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8022a3:	09 d0                	or     %edx,%eax
+  8022a5:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8022a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ad:	eb 06                	jmp    8022b5 <fcntl+0x50>
+		return fd->fd_omode;
+  8022af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b2:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8022b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022b8:	c9                   	leave
+  8022b9:	c3                   	ret
+
+008022ba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8022ba:	55                   	push   %ebp
+  8022bb:	89 e5                	mov    %esp,%ebp
+  8022bd:	56                   	push   %esi
+  8022be:	53                   	push   %ebx
+  8022bf:	83 ec 18             	sub    $0x18,%esp
+  8022c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8022c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8022c8:	50                   	push   %eax
+  8022c9:	53                   	push   %ebx
+  8022ca:	e8 52 fb ff ff       	call   801e21 <fd_lookup>
+  8022cf:	83 c4 10             	add    $0x10,%esp
+  8022d2:	85 c0                	test   %eax,%eax
+  8022d4:	78 34                	js     80230a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8022d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8022d9:	83 ec 08             	sub    $0x8,%esp
+  8022dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022df:	50                   	push   %eax
+  8022e0:	ff 36                	push   (%esi)
+  8022e2:	e8 8c fb ff ff       	call   801e73 <dev_lookup>
+  8022e7:	83 c4 10             	add    $0x10,%esp
+  8022ea:	85 c0                	test   %eax,%eax
+  8022ec:	78 1c                	js     80230a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022ee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8022f2:	74 1d                	je     802311 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8022f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f7:	8b 40 18             	mov    0x18(%eax),%eax
+  8022fa:	85 c0                	test   %eax,%eax
+  8022fc:	74 51                	je     80234f <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8022fe:	83 ec 08             	sub    $0x8,%esp
+  802301:	ff 75 0c             	push   0xc(%ebp)
+  802304:	56                   	push   %esi
+  802305:	ff d0                	call   *%eax
+  802307:	83 c4 10             	add    $0x10,%esp
+}
+  80230a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80230d:	5b                   	pop    %ebx
+  80230e:	5e                   	pop    %esi
+  80230f:	5d                   	pop    %ebp
+  802310:	c3                   	ret
+  802311:	89 e2                	mov    %esp,%edx
+  802313:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802318:	29 d0                	sub    %edx,%eax
+  80231a:	89 c2                	mov    %eax,%edx
+  80231c:	c1 ea 0f             	shr    $0xf,%edx
+  80231f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+  802329:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  80232c:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  802333:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802336:	83 ec 04             	sub    $0x4,%esp
+  802339:	53                   	push   %ebx
+  80233a:	50                   	push   %eax
+  80233b:	68 90 56 80 00       	push   $0x805690
+  802340:	e8 5b e3 ff ff       	call   8006a0 <cprintf>
+		return -E_INVAL;
+  802345:	83 c4 10             	add    $0x10,%esp
+  802348:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80234d:	eb bb                	jmp    80230a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80234f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802354:	eb b4                	jmp    80230a <ftruncate+0x50>
+
+00802356 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802356:	55                   	push   %ebp
+  802357:	89 e5                	mov    %esp,%ebp
+  802359:	56                   	push   %esi
+  80235a:	53                   	push   %ebx
+  80235b:	83 ec 18             	sub    $0x18,%esp
+  80235e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802361:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802364:	50                   	push   %eax
+  802365:	ff 75 08             	push   0x8(%ebp)
+  802368:	e8 b4 fa ff ff       	call   801e21 <fd_lookup>
+  80236d:	83 c4 10             	add    $0x10,%esp
+  802370:	85 c0                	test   %eax,%eax
+  802372:	78 53                	js     8023c7 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802374:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802377:	83 ec 08             	sub    $0x8,%esp
+  80237a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237d:	50                   	push   %eax
+  80237e:	ff 36                	push   (%esi)
+  802380:	e8 ee fa ff ff       	call   801e73 <dev_lookup>
+  802385:	83 c4 10             	add    $0x10,%esp
+  802388:	85 c0                	test   %eax,%eax
+  80238a:	78 3b                	js     8023c7 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80238c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80238f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802393:	74 39                	je     8023ce <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802395:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802398:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80239f:	00 00 00 
+	stat->st_isdir = 0;
+  8023a2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023a9:	00 00 00 
+	stat->st_version = 0;
+  8023ac:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8023b3:	00 00 00 
+	stat->st_dev = dev;
+  8023b6:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8023bc:	83 ec 08             	sub    $0x8,%esp
+  8023bf:	53                   	push   %ebx
+  8023c0:	56                   	push   %esi
+  8023c1:	ff 50 14             	call   *0x14(%eax)
+  8023c4:	83 c4 10             	add    $0x10,%esp
+}
+  8023c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023ca:	5b                   	pop    %ebx
+  8023cb:	5e                   	pop    %esi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+		return -E_NOT_SUPP;
+  8023ce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023d3:	eb f2                	jmp    8023c7 <fstat+0x71>
+
+008023d5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8023da:	83 ec 08             	sub    $0x8,%esp
+  8023dd:	6a 00                	push   $0x0
+  8023df:	ff 75 08             	push   0x8(%ebp)
+  8023e2:	e8 b7 01 00 00       	call   80259e <open>
+  8023e7:	89 c3                	mov    %eax,%ebx
+  8023e9:	83 c4 10             	add    $0x10,%esp
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	78 1b                	js     80240b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8023f0:	83 ec 08             	sub    $0x8,%esp
+  8023f3:	ff 75 0c             	push   0xc(%ebp)
+  8023f6:	50                   	push   %eax
+  8023f7:	e8 5a ff ff ff       	call   802356 <fstat>
+  8023fc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8023fe:	89 1c 24             	mov    %ebx,(%esp)
+  802401:	e8 60 fb ff ff       	call   801f66 <close>
+	return r;
+  802406:	83 c4 10             	add    $0x10,%esp
+  802409:	89 f3                	mov    %esi,%ebx
+}
+  80240b:	89 d8                	mov    %ebx,%eax
+  80240d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802410:	5b                   	pop    %ebx
+  802411:	5e                   	pop    %esi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+
+00802414 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	56                   	push   %esi
+  802418:	53                   	push   %ebx
+  802419:	89 c6                	mov    %eax,%esi
+  80241b:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80241d:	83 3d e4 76 80 00 00 	cmpl   $0x0,0x8076e4
+  802424:	74 27                	je     80244d <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802426:	6a 07                	push   $0x7
+  802428:	68 00 90 80 00       	push   $0x809000
+  80242d:	56                   	push   %esi
+  80242e:	ff 35 e4 76 80 00    	push   0x8076e4
+  802434:	e8 4b 29 00 00       	call   804d84 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802439:	83 c4 0c             	add    $0xc,%esp
+  80243c:	6a 00                	push   $0x0
+  80243e:	53                   	push   %ebx
+  80243f:	6a 00                	push   $0x0
+  802441:	e8 ae 26 00 00       	call   804af4 <ipc_recv>
+}
+  802446:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802449:	5b                   	pop    %ebx
+  80244a:	5e                   	pop    %esi
+  80244b:	5d                   	pop    %ebp
+  80244c:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	6a 02                	push   $0x2
+  802452:	e8 96 29 00 00       	call   804ded <ipc_find_env>
+  802457:	a3 e4 76 80 00       	mov    %eax,0x8076e4
+  80245c:	83 c4 10             	add    $0x10,%esp
+  80245f:	eb c5                	jmp    802426 <fsipc+0x12>
+
+00802461 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802467:	8b 45 08             	mov    0x8(%ebp),%eax
+  80246a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80246d:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.set_size.req_size = newsize;
+  802472:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802475:	a3 04 90 80 00       	mov    %eax,0x809004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80247a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802484:	e8 8b ff ff ff       	call   802414 <fsipc>
+}
+  802489:	c9                   	leave
+  80248a:	c3                   	ret
+
+0080248b <devfile_flush>:
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802491:	8b 45 08             	mov    0x8(%ebp),%eax
+  802494:	8b 40 0c             	mov    0xc(%eax),%eax
+  802497:	a3 00 90 80 00       	mov    %eax,0x809000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80249c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8024a6:	e8 69 ff ff ff       	call   802414 <fsipc>
+}
+  8024ab:	c9                   	leave
+  8024ac:	c3                   	ret
+
+008024ad <devfile_stat>:
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	53                   	push   %ebx
+  8024b1:	83 ec 04             	sub    $0x4,%esp
+  8024b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8024b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024bd:	a3 00 90 80 00       	mov    %eax,0x809000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8024c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8024cc:	e8 43 ff ff ff       	call   802414 <fsipc>
+  8024d1:	85 c0                	test   %eax,%eax
+  8024d3:	78 37                	js     80250c <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8024d5:	83 ec 08             	sub    $0x8,%esp
+  8024d8:	68 00 90 80 00       	push   $0x809000
+  8024dd:	53                   	push   %ebx
+  8024de:	e8 b4 e8 ff ff       	call   800d97 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8024e3:	a1 80 90 80 00       	mov    0x809080,%eax
+  8024e8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8024ee:	a1 84 90 80 00       	mov    0x809084,%eax
+  8024f3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8024f9:	a1 88 90 80 00       	mov    0x809088,%eax
+  8024fe:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80250c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80250f:	c9                   	leave
+  802510:	c3                   	ret
+
+00802511 <devfile_write>:
+{
+  802511:	55                   	push   %ebp
+  802512:	89 e5                	mov    %esp,%ebp
+  802514:	83 ec 0c             	sub    $0xc,%esp
+  802517:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  80251a:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80251f:	39 d0                	cmp    %edx,%eax
+  802521:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802524:	8b 55 08             	mov    0x8(%ebp),%edx
+  802527:	8b 52 0c             	mov    0xc(%edx),%edx
+  80252a:	89 15 00 90 80 00    	mov    %edx,0x809000
+	fsipcbuf.write.req_n = count;
+  802530:	a3 04 90 80 00       	mov    %eax,0x809004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802535:	50                   	push   %eax
+  802536:	ff 75 0c             	push   0xc(%ebp)
+  802539:	68 08 90 80 00       	push   $0x809008
+  80253e:	e8 04 ea ff ff       	call   800f47 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802543:	ba 00 00 00 00       	mov    $0x0,%edx
+  802548:	b8 04 00 00 00       	mov    $0x4,%eax
+  80254d:	e8 c2 fe ff ff       	call   802414 <fsipc>
+}
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+00802554 <devfile_read>:
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	53                   	push   %ebx
+  802558:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80255b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802561:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.read.req_n = n;
+  802566:	8b 45 10             	mov    0x10(%ebp),%eax
+  802569:	a3 04 90 80 00       	mov    %eax,0x809004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80256e:	ba 00 90 80 00       	mov    $0x809000,%edx
+  802573:	b8 03 00 00 00       	mov    $0x3,%eax
+  802578:	e8 97 fe ff ff       	call   802414 <fsipc>
+  80257d:	89 c3                	mov    %eax,%ebx
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	78 14                	js     802597 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802583:	83 ec 04             	sub    $0x4,%esp
+  802586:	50                   	push   %eax
+  802587:	68 00 90 80 00       	push   $0x809000
+  80258c:	ff 75 0c             	push   0xc(%ebp)
+  80258f:	e8 b3 e9 ff ff       	call   800f47 <memmove>
+	return r;
+  802594:	83 c4 10             	add    $0x10,%esp
+}
+  802597:	89 d8                	mov    %ebx,%eax
+  802599:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <open>:
+{
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	53                   	push   %ebx
+  8025a2:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8025a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025a8:	50                   	push   %eax
+  8025a9:	e8 23 f8 ff ff       	call   801dd1 <fd_alloc>
+  8025ae:	89 c3                	mov    %eax,%ebx
+  8025b0:	83 c4 10             	add    $0x10,%esp
+  8025b3:	85 c0                	test   %eax,%eax
+  8025b5:	78 2a                	js     8025e1 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8025b7:	83 ec 0c             	sub    $0xc,%esp
+  8025ba:	ff 75 08             	push   0x8(%ebp)
+  8025bd:	e8 89 e7 ff ff       	call   800d4b <strlen>
+  8025c2:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8025c5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8025ca:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8025cf:	7e 17                	jle    8025e8 <open+0x4a>
+	fd_close(fd, 1);
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	6a 01                	push   $0x1
+  8025d6:	ff 75 f4             	push   -0xc(%ebp)
+  8025d9:	e8 08 f9 ff ff       	call   801ee6 <fd_close>
+	return r;
+  8025de:	83 c4 10             	add    $0x10,%esp
+}
+  8025e1:	89 d8                	mov    %ebx,%eax
+  8025e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8025e8:	83 ec 08             	sub    $0x8,%esp
+  8025eb:	ff 75 08             	push   0x8(%ebp)
+  8025ee:	68 00 90 80 00       	push   $0x809000
+  8025f3:	e8 9f e7 ff ff       	call   800d97 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025fb:	a3 00 94 80 00       	mov    %eax,0x809400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  802600:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802603:	b8 01 00 00 00       	mov    $0x1,%eax
+  802608:	e8 07 fe ff ff       	call   802414 <fsipc>
+  80260d:	89 c3                	mov    %eax,%ebx
+  80260f:	83 c4 10             	add    $0x10,%esp
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 bb                	js     8025d1 <open+0x33>
+	return fd2num(fd); 	
+  802616:	83 ec 0c             	sub    $0xc,%esp
+  802619:	ff 75 f4             	push   -0xc(%ebp)
+  80261c:	e8 89 f7 ff ff       	call   801daa <fd2num>
+  802621:	89 c3                	mov    %eax,%ebx
+  802623:	83 c4 10             	add    $0x10,%esp
+  802626:	eb b9                	jmp    8025e1 <open+0x43>
+
+00802628 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802628:	55                   	push   %ebp
+  802629:	89 e5                	mov    %esp,%ebp
+  80262b:	53                   	push   %ebx
+  80262c:	83 ec 1c             	sub    $0x1c,%esp
+  80262f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802632:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802635:	50                   	push   %eax
+  802636:	ff 75 08             	push   0x8(%ebp)
+  802639:	e8 e3 f7 ff ff       	call   801e21 <fd_lookup>
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	85 c0                	test   %eax,%eax
+  802643:	78 5a                	js     80269f <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802645:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802648:	8b 15 40 60 80 00    	mov    0x806040,%edx
+  80264e:	39 10                	cmp    %edx,(%eax)
+  802650:	75 66                	jne    8026b8 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802652:	83 3d e4 76 80 00 00 	cmpl   $0x0,0x8076e4
+  802659:	74 49                	je     8026a4 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80265b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80265e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802661:	a3 00 90 80 00       	mov    %eax,0x809000
+	fsipcbuf.map.req_offset = offset;
+  802666:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802669:	a3 04 90 80 00       	mov    %eax,0x809004
+	fsipcbuf.map.req_npages = maxpages;
+  80266e:	89 1d 08 90 80 00    	mov    %ebx,0x809008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802674:	6a 07                	push   $0x7
+  802676:	68 00 90 80 00       	push   $0x809000
+  80267b:	6a 09                	push   $0x9
+  80267d:	ff 35 e4 76 80 00    	push   0x8076e4
+  802683:	e8 fc 26 00 00       	call   804d84 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802688:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80268f:	6a 00                	push   $0x0
+  802691:	53                   	push   %ebx
+  802692:	ff 75 10             	push   0x10(%ebp)
+  802695:	6a 00                	push   $0x0
+  802697:	e8 25 25 00 00       	call   804bc1 <ipc_recv_pages>
+  80269c:	83 c4 20             	add    $0x20,%esp
+}
+  80269f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026a2:	c9                   	leave
+  8026a3:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026a4:	83 ec 0c             	sub    $0xc,%esp
+  8026a7:	6a 02                	push   $0x2
+  8026a9:	e8 3f 27 00 00       	call   804ded <ipc_find_env>
+  8026ae:	a3 e4 76 80 00       	mov    %eax,0x8076e4
+  8026b3:	83 c4 10             	add    $0x10,%esp
+  8026b6:	eb a3                	jmp    80265b <fmap+0x33>
+		return -E_INVAL;
+  8026b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026bd:	eb e0                	jmp    80269f <fmap+0x77>
+
+008026bf <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8026bf:	55                   	push   %ebp
+  8026c0:	89 e5                	mov    %esp,%ebp
+  8026c2:	53                   	push   %ebx
+  8026c3:	83 ec 10             	sub    $0x10,%esp
+  8026c6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8026c9:	53                   	push   %ebx
+  8026ca:	e8 7c e6 ff ff       	call   800d4b <strlen>
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026d7:	7f 25                	jg     8026fe <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8026d9:	83 ec 08             	sub    $0x8,%esp
+  8026dc:	53                   	push   %ebx
+  8026dd:	68 00 90 80 00       	push   $0x809000
+  8026e2:	e8 b0 e6 ff ff       	call   800d97 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8026e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ec:	b8 07 00 00 00       	mov    $0x7,%eax
+  8026f1:	e8 1e fd ff ff       	call   802414 <fsipc>
+  8026f6:	83 c4 10             	add    $0x10,%esp
+}
+  8026f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026fc:	c9                   	leave
+  8026fd:	c3                   	ret
+		return -E_BAD_PATH;
+  8026fe:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802703:	eb f4                	jmp    8026f9 <remove+0x3a>
+
+00802705 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80270b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802710:	b8 08 00 00 00       	mov    $0x8,%eax
+  802715:	e8 fa fc ff ff       	call   802414 <fsipc>
+}
+  80271a:	c9                   	leave
+  80271b:	c3                   	ret
+
+0080271c <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	57                   	push   %edi
+  802720:	56                   	push   %esi
+  802721:	53                   	push   %ebx
+  802722:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802728:	6a 00                	push   $0x0
+  80272a:	ff 75 08             	push   0x8(%ebp)
+  80272d:	e8 6c fe ff ff       	call   80259e <open>
+  802732:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	0f 88 ab 04 00 00    	js     802bee <spawn+0x4d2>
+  802743:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802745:	83 ec 04             	sub    $0x4,%esp
+  802748:	68 00 02 00 00       	push   $0x200
+  80274d:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802753:	50                   	push   %eax
+  802754:	51                   	push   %ecx
+  802755:	e8 ef f9 ff ff       	call   802149 <readn>
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802762:	0f 85 e6 01 00 00    	jne    80294e <spawn+0x232>
+	    || elf->e_magic != ELF_MAGIC) {
+  802768:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80276f:	45 4c 46 
+  802772:	0f 85 d6 01 00 00    	jne    80294e <spawn+0x232>
+	__asm __volatile("int %2"
+  802778:	b8 07 00 00 00       	mov    $0x7,%eax
+  80277d:	cd 30                	int    $0x30
+  80277f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802785:	85 c0                	test   %eax,%eax
+  802787:	0f 88 55 04 00 00    	js     802be2 <spawn+0x4c6>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  80278d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802792:	69 f0 bc 00 00 00    	imul   $0xbc,%eax,%esi
+  802798:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80279e:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8027a4:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8027a9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8027ab:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8027b1:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027ba:	8b 00                	mov    (%eax),%eax
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	0f 84 a5 07 00 00    	je     802f69 <spawn+0x84d>
+  8027c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  8027c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+		string_size += strlen(argv[argc]) + 1;
+  8027d1:	83 ec 0c             	sub    $0xc,%esp
+  8027d4:	50                   	push   %eax
+  8027d5:	e8 71 e5 ff ff       	call   800d4b <strlen>
+  8027da:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  8027de:	89 9d 94 fd ff ff    	mov    %ebx,-0x26c(%ebp)
+  8027e4:	83 c3 01             	add    $0x1,%ebx
+  8027e7:	8d 14 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edx
+  8027ee:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8027f1:	83 c4 10             	add    $0x10,%esp
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	75 d9                	jne    8027d1 <spawn+0xb5>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  8027f8:	89 95 84 fd ff ff    	mov    %edx,-0x27c(%ebp)
+  8027fe:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+  802804:	be 00 10 40 00       	mov    $0x401000,%esi
+  802809:	29 fe                	sub    %edi,%esi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80280b:	89 f2                	mov    %esi,%edx
+  80280d:	83 e2 fc             	and    $0xfffffffc,%edx
+  802810:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802816:	8d 04 85 08 00 00 00 	lea    0x8(,%eax,4),%eax
+  80281d:	29 c2                	sub    %eax,%edx
+  80281f:	89 d7                	mov    %edx,%edi
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802821:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802824:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802829:	0f 86 ee 06 00 00    	jbe    802f1d <spawn+0x801>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80282f:	83 ec 04             	sub    $0x4,%esp
+  802832:	6a 07                	push   $0x7
+  802834:	68 00 00 40 00       	push   $0x400000
+  802839:	6a 00                	push   $0x0
+  80283b:	e8 8b e9 ff ff       	call   8011cb <sys_page_alloc>
+  802840:	83 c4 10             	add    $0x10,%esp
+  802843:	85 c0                	test   %eax,%eax
+  802845:	0f 88 d7 06 00 00    	js     802f22 <spawn+0x806>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  80284b:	85 db                	test   %ebx,%ebx
+  80284d:	7e 58                	jle    8028a7 <spawn+0x18b>
+  80284f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802854:	89 bd 88 fd ff ff    	mov    %edi,-0x278(%ebp)
+  80285a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		argv_store[i] = UTEMP2USTACK(string_store);
+  80285d:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802863:	8d 86 00 d0 7f ee    	lea    -0x11803000(%esi),%eax
+  802869:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  80286f:	89 04 99             	mov    %eax,(%ecx,%ebx,4)
+		strcpy(string_store, argv[i]);
+  802872:	83 ec 08             	sub    $0x8,%esp
+  802875:	ff 34 9f             	push   (%edi,%ebx,4)
+  802878:	56                   	push   %esi
+  802879:	e8 19 e5 ff ff       	call   800d97 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  80287e:	83 c4 04             	add    $0x4,%esp
+  802881:	ff 34 9f             	push   (%edi,%ebx,4)
+  802884:	e8 c2 e4 ff ff       	call   800d4b <strlen>
+  802889:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (i = 0; i < argc; i++) {
+  80288d:	83 c3 01             	add    $0x1,%ebx
+  802890:	83 c4 10             	add    $0x10,%esp
+  802893:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802899:	39 8d 94 fd ff ff    	cmp    %ecx,-0x26c(%ebp)
+  80289f:	75 bc                	jne    80285d <spawn+0x141>
+  8028a1:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+	}
+	argv_store[argc] = 0;
+  8028a7:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8028ad:	c7 04 07 00 00 00 00 	movl   $0x0,(%edi,%eax,1)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  8028b4:	81 fe 00 10 40 00    	cmp    $0x401000,%esi
+  8028ba:	0f 85 c6 00 00 00    	jne    802986 <spawn+0x26a>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  8028c0:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8028c6:	89 47 fc             	mov    %eax,-0x4(%edi)
+	argv_store[-2] = argc;
+  8028c9:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8028cf:	89 47 f8             	mov    %eax,-0x8(%edi)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8028d2:	8d 87 f8 cf 7f ee    	lea    -0x11803008(%edi),%eax
+  8028d8:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8028de:	83 ec 0c             	sub    $0xc,%esp
+  8028e1:	6a 07                	push   $0x7
+  8028e3:	68 00 d0 bf ee       	push   $0xeebfd000
+  8028e8:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8028ee:	68 00 00 40 00       	push   $0x400000
+  8028f3:	6a 00                	push   $0x0
+  8028f5:	e8 14 e9 ff ff       	call   80120e <sys_page_map>
+  8028fa:	89 c3                	mov    %eax,%ebx
+  8028fc:	83 c4 20             	add    $0x20,%esp
+  8028ff:	85 c0                	test   %eax,%eax
+  802901:	0f 88 45 06 00 00    	js     802f4c <spawn+0x830>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802907:	83 ec 08             	sub    $0x8,%esp
+  80290a:	68 00 00 40 00       	push   $0x400000
+  80290f:	6a 00                	push   $0x0
+  802911:	e8 3a e9 ff ff       	call   801250 <sys_page_unmap>
+  802916:	89 c3                	mov    %eax,%ebx
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	85 c0                	test   %eax,%eax
+  80291d:	0f 88 29 06 00 00    	js     802f4c <spawn+0x830>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802923:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802929:	8d 84 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%eax
+  802930:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802936:	66 83 bd 14 fe ff ff 	cmpw   $0x0,-0x1ec(%ebp)
+  80293d:	00 
+  80293e:	0f 84 a4 00 00 00    	je     8029e8 <spawn+0x2cc>
+  802944:	bf 00 00 00 00       	mov    $0x0,%edi
+  802949:	e9 19 03 00 00       	jmp    802c67 <spawn+0x54b>
+		close(fd);
+  80294e:	83 ec 0c             	sub    $0xc,%esp
+  802951:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802957:	e8 0a f6 ff ff       	call   801f66 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80295c:	83 c4 0c             	add    $0xc,%esp
+  80295f:	68 7f 45 4c 46       	push   $0x464c457f
+  802964:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80296a:	68 00 57 80 00       	push   $0x805700
+  80296f:	e8 2c dd ff ff       	call   8006a0 <cprintf>
+		return -E_NOT_EXEC;
+  802974:	83 c4 10             	add    $0x10,%esp
+  802977:	c7 85 78 fd ff ff f2 	movl   $0xfffffff2,-0x288(%ebp)
+  80297e:	ff ff ff 
+  802981:	e9 68 02 00 00       	jmp    802bee <spawn+0x4d2>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802986:	68 68 57 80 00       	push   $0x805768
+  80298b:	68 1a 57 80 00       	push   $0x80571a
+  802990:	68 f1 00 00 00       	push   $0xf1
+  802995:	68 2f 57 80 00       	push   $0x80572f
+  80299a:	e8 26 dc ff ff       	call   8005c5 <_panic>
+		for (j = 0; j < n; j++) {
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+		}
+		if ((r = pgbatch_flush(&pb)) < 0)
+			panic("spawn: sys_page_batch data: %e", r);
+  80299f:	50                   	push   %eax
+  8029a0:	68 90 57 80 00       	push   $0x805790
+  8029a5:	68 2d 01 00 00       	push   $0x12d
+  8029aa:	68 2f 57 80 00       	push   $0x80572f
+  8029af:	e8 11 dc ff ff       	call   8005c5 <_panic>
+  8029b4:	89 c6                	mov    %eax,%esi
+  8029b6:	eb 02                	jmp    8029ba <spawn+0x29e>
+  8029b8:	89 c6                	mov    %eax,%esi
+	sys_env_destroy(child);
+  8029ba:	83 ec 0c             	sub    $0xc,%esp
+  8029bd:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029c3:	e8 84 e7 ff ff       	call   80114c <sys_env_destroy>
+	close(fd);
+  8029c8:	83 c4 04             	add    $0x4,%esp
+  8029cb:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8029d1:	e8 90 f5 ff ff       	call   801f66 <close>
+	return r;
+  8029d6:	83 c4 10             	add    $0x10,%esp
+  8029d9:	89 b5 78 fd ff ff    	mov    %esi,-0x288(%ebp)
+  8029df:	e9 0a 02 00 00       	jmp    802bee <spawn+0x4d2>
+  8029e4:	89 c6                	mov    %eax,%esi
+  8029e6:	eb d2                	jmp    8029ba <spawn+0x29e>
+	close(fd);
+  8029e8:	83 ec 0c             	sub    $0xc,%esp
+  8029eb:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  8029f1:	e8 70 f5 ff ff       	call   801f66 <close>
+	// LAB 7: Your code here.
+	static struct PageBatch pb;
+	uintptr_t addr;
+	uint32_t pn, pd;
+	int r;
+	pgbatch_init(&pb);
+  8029f6:	c7 04 24 00 77 80 00 	movl   $0x807700,(%esp)
+  8029fd:	e8 65 1d 00 00       	call   804767 <pgbatch_init>
+  802a02:	83 c4 10             	add    $0x10,%esp
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802a05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a0a:	8b b5 90 fd ff ff    	mov    -0x270(%ebp),%esi
+  802a10:	eb 24                	jmp    802a36 <spawn+0x31a>
+		pd = PDX(addr);
+		if (!(vpd[pd] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  802a12:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802a18:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  802a1e:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  802a24:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a2a:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  802a30:	0f 87 18 01 00 00    	ja     802b4e <spawn+0x432>
+		pd = PDX(addr);
+  802a36:	89 d8                	mov    %ebx,%eax
+  802a38:	c1 e8 16             	shr    $0x16,%eax
+		if (!(vpd[pd] & PTE_P)) {
+  802a3b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a42:	a8 01                	test   $0x1,%al
+  802a44:	74 cc                	je     802a12 <spawn+0x2f6>
+			continue;
+		}
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802a46:	89 d9                	mov    %ebx,%ecx
+  802a48:	81 e1 ff ff 3f 00    	and    $0x3fffff,%ecx
+  802a4e:	74 4c                	je     802a9c <spawn+0x380>
+				continue;
+			}
+			if (r != -E_INVAL)
+				panic("sys_page_batch: %e", r);
+		}
+		pn = addr >> PGSHIFT;
+  802a50:	89 d8                	mov    %ebx,%eax
+  802a52:	c1 e8 0c             	shr    $0xc,%eax
+		if(vpt[pn] & PTE_SHARE) {
+  802a55:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802a5c:	f6 c6 04             	test   $0x4,%dh
+  802a5f:	74 c3                	je     802a24 <spawn+0x308>
+			if ((r = pgbatch_map(&pb, 0, (void*)addr, child, (void*)addr, vpt[pn] & PTE_SYSCALL)) < 0)
+  802a61:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802a68:	83 ec 08             	sub    $0x8,%esp
+  802a6b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802a70:	50                   	push   %eax
+  802a71:	53                   	push   %ebx
+  802a72:	56                   	push   %esi
+  802a73:	53                   	push   %ebx
+  802a74:	6a 00                	push   $0x0
+  802a76:	68 00 77 80 00       	push   $0x807700
+  802a7b:	e8 a5 1d 00 00       	call   804825 <pgbatch_map>
+  802a80:	83 c4 20             	add    $0x20,%esp
+  802a83:	85 c0                	test   %eax,%eax
+  802a85:	79 9d                	jns    802a24 <spawn+0x308>
+				panic("sys_page_batch: %e", r);
+  802a87:	50                   	push   %eax
+  802a88:	68 3b 57 80 00       	push   $0x80573b
+  802a8d:	68 6b 01 00 00       	push   $0x16b
+  802a92:	68 2f 57 80 00       	push   $0x80572f
+  802a97:	e8 29 db ff ff       	call   8005c5 <_panic>
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802a9c:	89 d8                	mov    %ebx,%eax
+  802a9e:	c1 e8 0c             	shr    $0xc,%eax
+  802aa1:	8d b8 00 04 00 00    	lea    0x400(%eax),%edi
+  802aa7:	eb 0a                	jmp    802ab3 <spawn+0x397>
+			n++;
+  802aa9:	83 c1 01             	add    $0x1,%ecx
+	for (pn = PGNUM(addr); pn < PGNUM(addr) + NPTENTRIES; pn++)
+  802aac:	83 c0 01             	add    $0x1,%eax
+  802aaf:	39 f8                	cmp    %edi,%eax
+  802ab1:	73 1a                	jae    802acd <spawn+0x3b1>
+		if (vpt[pn] & PTE_P) {
+  802ab3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802aba:	f6 c2 01             	test   $0x1,%dl
+  802abd:	74 ed                	je     802aac <spawn+0x390>
+			if (!(vpt[pn] & PTE_SHARE))
+  802abf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802ac6:	f6 c6 04             	test   $0x4,%dh
+  802ac9:	75 de                	jne    802aa9 <spawn+0x38d>
+  802acb:	eb 83                	jmp    802a50 <spawn+0x334>
+		if (addr % PTSIZE == 0 && pt_all_shared(addr)) {
+  802acd:	85 c9                	test   %ecx,%ecx
+  802acf:	0f 84 7b ff ff ff    	je     802a50 <spawn+0x334>
+			if ((r = pgbatch_flush(&pb)) < 0)
+  802ad5:	83 ec 0c             	sub    $0xc,%esp
+  802ad8:	68 00 77 80 00       	push   $0x807700
+  802add:	e8 93 1c 00 00       	call   804775 <pgbatch_flush>
+  802ae2:	83 c4 10             	add    $0x10,%esp
+  802ae5:	85 c0                	test   %eax,%eax
+  802ae7:	78 45                	js     802b2e <spawn+0x412>
+			pgbatch_sharept(&pb, 0, (void*)addr, child, 0);
+  802ae9:	83 ec 0c             	sub    $0xc,%esp
+  802aec:	6a 00                	push   $0x0
+  802aee:	56                   	push   %esi
+  802aef:	53                   	push   %ebx
+  802af0:	6a 00                	push   $0x0
+  802af2:	68 00 77 80 00       	push   $0x807700
+  802af7:	e8 d4 1d 00 00       	call   8048d0 <pgbatch_sharept>
+			if ((r = pgbatch_flush(&pb)) == 0) {
+  802afc:	83 c4 14             	add    $0x14,%esp
+  802aff:	68 00 77 80 00       	push   $0x807700
+  802b04:	e8 6c 1c 00 00       	call   804775 <pgbatch_flush>
+  802b09:	83 c4 10             	add    $0x10,%esp
+  802b0c:	85 c0                	test   %eax,%eax
+  802b0e:	74 33                	je     802b43 <spawn+0x427>
+			if (r != -E_INVAL)
+  802b10:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  802b13:	0f 84 37 ff ff ff    	je     802a50 <spawn+0x334>
+				panic("sys_page_batch: %e", r);
+  802b19:	50                   	push   %eax
+  802b1a:	68 3b 57 80 00       	push   $0x80573b
+  802b1f:	68 66 01 00 00       	push   $0x166
+  802b24:	68 2f 57 80 00       	push   $0x80572f
+  802b29:	e8 97 da ff ff       	call   8005c5 <_panic>
+				panic("sys_page_batch: %e", r);
+  802b2e:	50                   	push   %eax
+  802b2f:	68 3b 57 80 00       	push   $0x80573b
+  802b34:	68 5f 01 00 00       	push   $0x15f
+  802b39:	68 2f 57 80 00       	push   $0x80572f
+  802b3e:	e8 82 da ff ff       	call   8005c5 <_panic>
+				addr += PTSIZE - PGSIZE;
+  802b43:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+				continue;
+  802b49:	e9 d6 fe ff ff       	jmp    802a24 <spawn+0x308>
+		}
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  802b4e:	83 ec 0c             	sub    $0xc,%esp
+  802b51:	68 00 77 80 00       	push   $0x807700
+  802b56:	e8 1a 1c 00 00       	call   804775 <pgbatch_flush>
+  802b5b:	83 c4 10             	add    $0x10,%esp
+  802b5e:	85 c0                	test   %eax,%eax
+  802b60:	78 41                	js     802ba3 <spawn+0x487>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802b62:	83 ec 08             	sub    $0x8,%esp
+  802b65:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802b6b:	50                   	push   %eax
+  802b6c:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b72:	e8 5d e7 ff ff       	call   8012d4 <sys_env_set_trapframe>
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	85 c0                	test   %eax,%eax
+  802b7c:	78 3a                	js     802bb8 <spawn+0x49c>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802b7e:	83 ec 08             	sub    $0x8,%esp
+  802b81:	6a 02                	push   $0x2
+  802b83:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802b89:	e8 04 e7 ff ff       	call   801292 <sys_env_set_status>
+  802b8e:	83 c4 10             	add    $0x10,%esp
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	78 38                	js     802bcd <spawn+0x4b1>
+	return child;
+  802b95:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802b9b:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802ba1:	eb 4b                	jmp    802bee <spawn+0x4d2>
+		panic("sys_page_batch: %e", r);
+  802ba3:	50                   	push   %eax
+  802ba4:	68 3b 57 80 00       	push   $0x80573b
+  802ba9:	68 6f 01 00 00       	push   $0x16f
+  802bae:	68 2f 57 80 00       	push   $0x80572f
+  802bb3:	e8 0d da ff ff       	call   8005c5 <_panic>
+		panic("sys_env_set_trapframe: %e", r);
+  802bb8:	50                   	push   %eax
+  802bb9:	68 4e 57 80 00       	push   $0x80574e
+  802bbe:	68 85 00 00 00       	push   $0x85
+  802bc3:	68 2f 57 80 00       	push   $0x80572f
+  802bc8:	e8 f8 d9 ff ff       	call   8005c5 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802bcd:	50                   	push   %eax
+  802bce:	68 36 56 80 00       	push   $0x805636
+  802bd3:	68 88 00 00 00       	push   $0x88
+  802bd8:	68 2f 57 80 00       	push   $0x80572f
+  802bdd:	e8 e3 d9 ff ff       	call   8005c5 <_panic>
+		return r;
+  802be2:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802be8:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+}
+  802bee:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802bf4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf7:	5b                   	pop    %ebx
+  802bf8:	5e                   	pop    %esi
+  802bf9:	5f                   	pop    %edi
+  802bfa:	5d                   	pop    %ebp
+  802bfb:	c3                   	ret
+	for (j = 0; j < n; j++)
+  802bfc:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  802c02:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802c08:	85 db                	test   %ebx,%ebx
+  802c0a:	0f 8e 06 03 00 00    	jle    802f16 <spawn+0x7fa>
+  802c10:	81 c6 00 04 00 00    	add    $0x400,%esi
+  802c16:	c1 e6 0c             	shl    $0xc,%esi
+  802c19:	bb 00 00 40 00       	mov    $0x400000,%ebx
+  802c1e:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802c24:	89 c7                	mov    %eax,%edi
+		sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802c26:	83 ec 08             	sub    $0x8,%esp
+  802c29:	53                   	push   %ebx
+  802c2a:	6a 00                	push   $0x0
+  802c2c:	e8 1f e6 ff ff       	call   801250 <sys_page_unmap>
+	for (j = 0; j < n; j++)
+  802c31:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c37:	83 c4 10             	add    $0x10,%esp
+  802c3a:	39 f3                	cmp    %esi,%ebx
+  802c3c:	75 e8                	jne    802c26 <spawn+0x50a>
+  802c3e:	89 f8                	mov    %edi,%eax
+  802c40:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c46:	85 c0                	test   %eax,%eax
+  802c48:	0f 88 66 fd ff ff    	js     8029b4 <spawn+0x298>
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802c4e:	83 c7 01             	add    $0x1,%edi
+  802c51:	83 85 7c fd ff ff 20 	addl   $0x20,-0x284(%ebp)
+  802c58:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802c5f:	39 f8                	cmp    %edi,%eax
+  802c61:	0f 8e 81 fd ff ff    	jle    8029e8 <spawn+0x2cc>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802c67:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802c6d:	83 39 01             	cmpl   $0x1,(%ecx)
+  802c70:	75 dc                	jne    802c4e <spawn+0x532>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802c72:	8b 41 18             	mov    0x18(%ecx),%eax
+  802c75:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+  802c7b:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802c7e:	83 f8 01             	cmp    $0x1,%eax
+  802c81:	19 c0                	sbb    %eax,%eax
+  802c83:	83 e0 fe             	and    $0xfffffffe,%eax
+  802c86:	83 c0 07             	add    $0x7,%eax
+  802c89:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802c8f:	8b 51 04             	mov    0x4(%ecx),%edx
+  802c92:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802c98:	8b 59 10             	mov    0x10(%ecx),%ebx
+  802c9b:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802ca1:	8b 41 14             	mov    0x14(%ecx),%eax
+  802ca4:	89 85 68 fd ff ff    	mov    %eax,-0x298(%ebp)
+  802caa:	8b 71 08             	mov    0x8(%ecx),%esi
+  802cad:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+	if ((i = PGOFF(va))) {
+  802cb3:	89 f0                	mov    %esi,%eax
+  802cb5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802cba:	74 1e                	je     802cda <spawn+0x5be>
+		va -= i;
+  802cbc:	29 c6                	sub    %eax,%esi
+  802cbe:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		memsz += i;
+  802cc4:	01 85 68 fd ff ff    	add    %eax,-0x298(%ebp)
+		filesz += i;
+  802cca:	01 c3                	add    %eax,%ebx
+  802ccc:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+		fileoffset -= i;
+  802cd2:	29 c2                	sub    %eax,%edx
+  802cd4:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+	pgbatch_init(&pb);
+  802cda:	83 ec 0c             	sub    $0xc,%esp
+  802cdd:	68 20 7a 80 00       	push   $0x807a20
+  802ce2:	e8 80 1a 00 00       	call   804767 <pgbatch_init>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	83 bd 88 fd ff ff 00 	cmpl   $0x0,-0x278(%ebp)
+  802cf1:	0f 84 a6 01 00 00    	je     802e9d <spawn+0x781>
+  802cf7:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802cfe:	00 00 00 
+  802d01:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802d08:	00 00 00 
+  802d0b:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+		n = MIN(SEG_CHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802d11:	8b bd 88 fd ff ff    	mov    -0x278(%ebp),%edi
+  802d17:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802d1d:	29 c7                	sub    %eax,%edi
+  802d1f:	8d b7 ff 0f 00 00    	lea    0xfff(%edi),%esi
+  802d25:	c1 ee 0c             	shr    $0xc,%esi
+  802d28:	b8 10 00 00 00       	mov    $0x10,%eax
+  802d2d:	39 c6                	cmp    %eax,%esi
+  802d2f:	0f 47 f0             	cmova  %eax,%esi
+  802d32:	89 b5 94 fd ff ff    	mov    %esi,-0x26c(%ebp)
+		for (j = 0; j < n; j++)
+  802d38:	85 f6                	test   %esi,%esi
+  802d3a:	0f 8e ed 01 00 00    	jle    802f2d <spawn+0x811>
+  802d40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d45:	89 bd 70 fd ff ff    	mov    %edi,-0x290(%ebp)
+  802d4b:	89 f7                	mov    %esi,%edi
+			if ((r = pgbatch_alloc(&pb, 0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802d4d:	6a 07                	push   $0x7
+  802d4f:	89 d8                	mov    %ebx,%eax
+  802d51:	c1 e0 0c             	shl    $0xc,%eax
+  802d54:	05 00 00 40 00       	add    $0x400000,%eax
+  802d59:	50                   	push   %eax
+  802d5a:	6a 00                	push   $0x0
+  802d5c:	68 20 7a 80 00       	push   $0x807a20
+  802d61:	e8 88 1a 00 00       	call   8047ee <pgbatch_alloc>
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	0f 88 47 fc ff ff    	js     8029b8 <spawn+0x29c>
+		for (j = 0; j < n; j++)
+  802d71:	83 c3 01             	add    $0x1,%ebx
+  802d74:	39 df                	cmp    %ebx,%edi
+  802d76:	75 d5                	jne    802d4d <spawn+0x631>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802d78:	8b bd 70 fd ff ff    	mov    -0x290(%ebp),%edi
+  802d7e:	83 ec 0c             	sub    $0xc,%esp
+  802d81:	68 20 7a 80 00       	push   $0x807a20
+  802d86:	e8 ea 19 00 00       	call   804775 <pgbatch_flush>
+  802d8b:	83 c4 10             	add    $0x10,%esp
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	0f 88 66 fe ff ff    	js     802bfc <spawn+0x4e0>
+		if ((r = seek(fd, fileoffset + i)) < 0)
+  802d96:	83 ec 08             	sub    $0x8,%esp
+  802d99:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802d9f:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802da5:	01 c8                	add    %ecx,%eax
+  802da7:	50                   	push   %eax
+  802da8:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802dae:	e8 89 f4 ff ff       	call   80223c <seek>
+  802db3:	83 c4 10             	add    $0x10,%esp
+  802db6:	85 c0                	test   %eax,%eax
+  802db8:	0f 88 3e fe ff ff    	js     802bfc <spawn+0x4e0>
+		if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz - i))) < 0)
+  802dbe:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802dc4:	c1 e3 0c             	shl    $0xc,%ebx
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	39 fb                	cmp    %edi,%ebx
+  802dcc:	0f 46 fb             	cmovbe %ebx,%edi
+  802dcf:	57                   	push   %edi
+  802dd0:	68 00 00 40 00       	push   $0x400000
+  802dd5:	ff b5 78 fd ff ff    	push   -0x288(%ebp)
+  802ddb:	e8 69 f3 ff ff       	call   802149 <readn>
+  802de0:	83 c4 10             	add    $0x10,%esp
+  802de3:	85 c0                	test   %eax,%eax
+  802de5:	0f 88 11 fe ff ff    	js     802bfc <spawn+0x4e0>
+		for (j = 0; j < n; j++) {
+  802deb:	83 bd 94 fd ff ff 00 	cmpl   $0x0,-0x26c(%ebp)
+  802df2:	7e 6b                	jle    802e5f <spawn+0x743>
+  802df4:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802dfa:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802e00:	01 c7                	add    %eax,%edi
+  802e02:	be 00 00 00 00       	mov    $0x0,%esi
+  802e07:	89 9d 80 fd ff ff    	mov    %ebx,-0x280(%ebp)
+			pgbatch_map(&pb, 0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm);
+  802e0d:	89 f3                	mov    %esi,%ebx
+  802e0f:	c1 e3 0c             	shl    $0xc,%ebx
+  802e12:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  802e18:	83 ec 08             	sub    $0x8,%esp
+  802e1b:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802e21:	57                   	push   %edi
+  802e22:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802e28:	53                   	push   %ebx
+  802e29:	6a 00                	push   $0x0
+  802e2b:	68 20 7a 80 00       	push   $0x807a20
+  802e30:	e8 f0 19 00 00       	call   804825 <pgbatch_map>
+			pgbatch_unmap(&pb, 0, UTEMP + j * PGSIZE);
+  802e35:	83 c4 1c             	add    $0x1c,%esp
+  802e38:	53                   	push   %ebx
+  802e39:	6a 00                	push   $0x0
+  802e3b:	68 20 7a 80 00       	push   $0x807a20
+  802e40:	e8 23 1a 00 00       	call   804868 <pgbatch_unmap>
+		for (j = 0; j < n; j++) {
+  802e45:	83 c6 01             	add    $0x1,%esi
+  802e48:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802e4e:	83 c4 10             	add    $0x10,%esp
+  802e51:	39 b5 94 fd ff ff    	cmp    %esi,-0x26c(%ebp)
+  802e57:	75 b4                	jne    802e0d <spawn+0x6f1>
+  802e59:	8b 9d 80 fd ff ff    	mov    -0x280(%ebp),%ebx
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e5f:	83 ec 0c             	sub    $0xc,%esp
+  802e62:	68 20 7a 80 00       	push   $0x807a20
+  802e67:	e8 09 19 00 00       	call   804775 <pgbatch_flush>
+  802e6c:	83 c4 10             	add    $0x10,%esp
+  802e6f:	85 c0                	test   %eax,%eax
+  802e71:	0f 88 28 fb ff ff    	js     80299f <spawn+0x283>
+	for (i = 0; i < filesz; i += n * PGSIZE) {
+  802e77:	01 9d 84 fd ff ff    	add    %ebx,-0x27c(%ebp)
+  802e7d:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802e83:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802e89:	8b b5 88 fd ff ff    	mov    -0x278(%ebp),%esi
+  802e8f:	39 f0                	cmp    %esi,%eax
+  802e91:	0f 82 7a fe ff ff    	jb     802d11 <spawn+0x5f5>
+  802e97:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802e9d:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802ea3:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802ea8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ead:	89 c3                	mov    %eax,%ebx
+  802eaf:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802eb5:	39 f0                	cmp    %esi,%eax
+  802eb7:	73 48                	jae    802f01 <spawn+0x7e5>
+  802eb9:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802ebf:	89 bd 94 fd ff ff    	mov    %edi,-0x26c(%ebp)
+  802ec5:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+		if ((r = pgbatch_alloc(&pb, child, (void*) (va + i), perm)) < 0)
+  802ecb:	56                   	push   %esi
+  802ecc:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802ed2:	01 d8                	add    %ebx,%eax
+  802ed4:	50                   	push   %eax
+  802ed5:	57                   	push   %edi
+  802ed6:	68 20 7a 80 00       	push   $0x807a20
+  802edb:	e8 0e 19 00 00       	call   8047ee <pgbatch_alloc>
+  802ee0:	83 c4 10             	add    $0x10,%esp
+  802ee3:	85 c0                	test   %eax,%eax
+  802ee5:	0f 88 f9 fa ff ff    	js     8029e4 <spawn+0x2c8>
+	for (i = ROUNDUP(filesz, PGSIZE); i < memsz; i += PGSIZE)
+  802eeb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802ef1:	8b 85 68 fd ff ff    	mov    -0x298(%ebp),%eax
+  802ef7:	39 c3                	cmp    %eax,%ebx
+  802ef9:	72 d0                	jb     802ecb <spawn+0x7af>
+  802efb:	8b bd 94 fd ff ff    	mov    -0x26c(%ebp),%edi
+	return pgbatch_flush(&pb);
+  802f01:	83 ec 0c             	sub    $0xc,%esp
+  802f04:	68 20 7a 80 00       	push   $0x807a20
+  802f09:	e8 67 18 00 00       	call   804775 <pgbatch_flush>
+  802f0e:	83 c4 10             	add    $0x10,%esp
+  802f11:	e9 30 fd ff ff       	jmp    802c46 <spawn+0x52a>
+  802f16:	89 c6                	mov    %eax,%esi
+  802f18:	e9 9d fa ff ff       	jmp    8029ba <spawn+0x29e>
+		return -E_NO_MEM;
+  802f1d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802f22:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802f28:	e9 c1 fc ff ff       	jmp    802bee <spawn+0x4d2>
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802f2d:	83 ec 0c             	sub    $0xc,%esp
+  802f30:	68 20 7a 80 00       	push   $0x807a20
+  802f35:	e8 3b 18 00 00       	call   804775 <pgbatch_flush>
+  802f3a:	83 c4 10             	add    $0x10,%esp
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	0f 89 51 fe ff ff    	jns    802d96 <spawn+0x67a>
+  802f45:	89 c6                	mov    %eax,%esi
+  802f47:	e9 6e fa ff ff       	jmp    8029ba <spawn+0x29e>
+	sys_page_unmap(0, UTEMP);
+  802f4c:	83 ec 08             	sub    $0x8,%esp
+  802f4f:	68 00 00 40 00       	push   $0x400000
+  802f54:	6a 00                	push   $0x0
+  802f56:	e8 f5 e2 ff ff       	call   801250 <sys_page_unmap>
+  802f5b:	83 c4 10             	add    $0x10,%esp
+  802f5e:	89 9d 78 fd ff ff    	mov    %ebx,-0x288(%ebp)
+  802f64:	e9 85 fc ff ff       	jmp    802bee <spawn+0x4d2>
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802f69:	83 ec 04             	sub    $0x4,%esp
+  802f6c:	6a 07                	push   $0x7
+  802f6e:	68 00 00 40 00       	push   $0x400000
+  802f73:	6a 00                	push   $0x0
+  802f75:	e8 51 e2 ff ff       	call   8011cb <sys_page_alloc>
+  802f7a:	83 c4 10             	add    $0x10,%esp
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	78 a1                	js     802f22 <spawn+0x806>
+	for (argc = 0; argv[argc] != 0; argc++)
+  802f81:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802f88:	00 00 00 
+  802f8b:	c7 85 80 fd ff ff 00 	movl   $0x0,-0x280(%ebp)
+  802f92:	00 00 00 
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802f95:	bf fc 0f 40 00       	mov    $0x400ffc,%edi
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802f9a:	be 00 10 40 00       	mov    $0x401000,%esi
+  802f9f:	e9 03 f9 ff ff       	jmp    8028a7 <spawn+0x18b>
+
+00802fa4 <spawnl>:
+{
+  802fa4:	55                   	push   %ebp
+  802fa5:	89 e5                	mov    %esp,%ebp
+  802fa7:	56                   	push   %esi
+  802fa8:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802fa9:	8d 45 10             	lea    0x10(%ebp),%eax
+	int argc=0;
+  802fac:	b9 00 00 00 00       	mov    $0x0,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802fb1:	eb 05                	jmp    802fb8 <spawnl+0x14>
+		argc++;
+  802fb3:	83 c1 01             	add    $0x1,%ecx
+	while(va_arg(vl, void *) != NULL)
+  802fb6:	89 d0                	mov    %edx,%eax
+  802fb8:	8d 50 04             	lea    0x4(%eax),%edx
+  802fbb:	83 38 00             	cmpl   $0x0,(%eax)
+  802fbe:	75 f3                	jne    802fb3 <spawnl+0xf>
+	const char *argv[argc+2];
+  802fc0:	8d 04 8d 17 00 00 00 	lea    0x17(,%ecx,4),%eax
+  802fc7:	83 e0 f0             	and    $0xfffffff0,%eax
+  802fca:	29 c4                	sub    %eax,%esp
+  802fcc:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802fd0:	89 d8                	mov    %ebx,%eax
+  802fd2:	c1 e8 02             	shr    $0x2,%eax
+  802fd5:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802fd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802fdb:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+	argv[argc+1] = NULL;
+  802fe2:	c7 44 8b 04 00 00 00 	movl   $0x0,0x4(%ebx,%ecx,4)
+  802fe9:	00 
+	va_start(vl, arg0);
+  802fea:	8d 55 10             	lea    0x10(%ebp),%edx
+	for(i=0;i<argc;i++)
+  802fed:	89 ce                	mov    %ecx,%esi
+  802fef:	85 c9                	test   %ecx,%ecx
+  802ff1:	74 16                	je     803009 <spawnl+0x65>
+  802ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+		argv[i+1] = va_arg(vl, const char *);
+  802ff8:	83 c0 01             	add    $0x1,%eax
+  802ffb:	89 d1                	mov    %edx,%ecx
+  802ffd:	83 c2 04             	add    $0x4,%edx
+  803000:	8b 09                	mov    (%ecx),%ecx
+  803002:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+	for(i=0;i<argc;i++)
+  803005:	39 f0                	cmp    %esi,%eax
+  803007:	75 ef                	jne    802ff8 <spawnl+0x54>
+	return spawn(prog, argv);
+  803009:	83 ec 08             	sub    $0x8,%esp
+  80300c:	53                   	push   %ebx
+  80300d:	ff 75 08             	push   0x8(%ebp)
+  803010:	e8 07 f7 ff ff       	call   80271c <spawn>
+}
+  803015:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803018:	5b                   	pop    %ebx
+  803019:	5e                   	pop    %esi
+  80301a:	5d                   	pop    %ebp
+  80301b:	c3                   	ret
+
+0080301c <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80301c:	55                   	push   %ebp
+  80301d:	89 e5                	mov    %esp,%ebp
+  80301f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803022:	68 af 57 80 00       	push   $0x8057af
+  803027:	ff 75 0c             	push   0xc(%ebp)
+  80302a:	e8 68 dd ff ff       	call   800d97 <strcpy>
+	return 0;
+}
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803034:	c9                   	leave
+  803035:	c3                   	ret
+
+00803036 <devsock_close>:
+{
+  803036:	55                   	push   %ebp
+  803037:	89 e5                	mov    %esp,%ebp
+  803039:	53                   	push   %ebx
+  80303a:	83 ec 10             	sub    $0x10,%esp
+  80303d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  803040:	53                   	push   %ebx
+  803041:	e8 e6 1d 00 00       	call   804e2c <pageref>
+  803046:	89 c2                	mov    %eax,%edx
+  803048:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80304b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  803050:	83 fa 01             	cmp    $0x1,%edx
+  803053:	74 05                	je     80305a <devsock_close+0x24>
+}
+  803055:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803058:	c9                   	leave
+  803059:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  80305a:	83 ec 0c             	sub    $0xc,%esp
+  80305d:	ff 73 0c             	push   0xc(%ebx)
+  803060:	e8 b0 05 00 00       	call   803615 <nsipc_close>
+  803065:	83 c4 10             	add    $0x10,%esp
+  803068:	eb eb                	jmp    803055 <devsock_close+0x1f>
+
+0080306a <devsock_write>:
+{
+  80306a:	55                   	push   %ebp
+  80306b:	89 e5                	mov    %esp,%ebp
+  80306d:	53                   	push   %ebx
+  80306e:	83 ec 14             	sub    $0x14,%esp
+  803071:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803074:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803077:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  80307a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80307d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  803080:	8b 41 08             	mov    0x8(%ecx),%eax
+  803083:	c1 f8 09             	sar    $0x9,%eax
+  803086:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  803089:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80308f:	77 13                	ja     8030a4 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  803091:	50                   	push   %eax
+  803092:	52                   	push   %edx
+  803093:	53                   	push   %ebx
+  803094:	ff 71 0c             	push   0xc(%ecx)
+  803097:	e8 5c 06 00 00       	call   8036f8 <nsipc_send>
+  80309c:	83 c4 10             	add    $0x10,%esp
+}
+  80309f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030a2:	c9                   	leave
+  8030a3:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8030a4:	50                   	push   %eax
+  8030a5:	6a 01                	push   $0x1
+  8030a7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030aa:	50                   	push   %eax
+  8030ab:	ff 71 0c             	push   0xc(%ecx)
+  8030ae:	e8 a6 06 00 00       	call   803759 <nsipc_sendmsg>
+  8030b3:	83 c4 10             	add    $0x10,%esp
+  8030b6:	eb e7                	jmp    80309f <devsock_write+0x35>
+
+008030b8 <devsock_read>:
+{
+  8030b8:	55                   	push   %ebp
+  8030b9:	89 e5                	mov    %esp,%ebp
+  8030bb:	53                   	push   %ebx
+  8030bc:	83 ec 14             	sub    $0x14,%esp
+  8030bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8030c5:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8030c8:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8030cb:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8030ce:	8b 41 08             	mov    0x8(%ecx),%eax
+  8030d1:	c1 f8 09             	sar    $0x9,%eax
+  8030d4:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8030d7:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8030dd:	77 13                	ja     8030f2 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8030df:	50                   	push   %eax
+  8030e0:	52                   	push   %edx
+  8030e1:	53                   	push   %ebx
+  8030e2:	ff 71 0c             	push   0xc(%ecx)
+  8030e5:	e8 9c 05 00 00       	call   803686 <nsipc_recv>
+  8030ea:	83 c4 10             	add    $0x10,%esp
+}
+  8030ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f0:	c9                   	leave
+  8030f1:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8030f2:	50                   	push   %eax
+  8030f3:	6a 01                	push   $0x1
+  8030f5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030f8:	50                   	push   %eax
+  8030f9:	ff 71 0c             	push   0xc(%ecx)
+  8030fc:	e8 02 0a 00 00       	call   803b03 <nsipc_recvmsg>
+  803101:	83 c4 10             	add    $0x10,%esp
+  803104:	eb e7                	jmp    8030ed <devsock_read+0x35>
+
+00803106 <fd2sockid>:
+{
+  803106:	55                   	push   %ebp
+  803107:	89 e5                	mov    %esp,%ebp
+  803109:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80310c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80310f:	52                   	push   %edx
+  803110:	50                   	push   %eax
+  803111:	e8 0b ed ff ff       	call   801e21 <fd_lookup>
+  803116:	83 c4 10             	add    $0x10,%esp
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	78 10                	js     80312d <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80311d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803120:	8b 0d 60 60 80 00    	mov    0x806060,%ecx
+  803126:	39 08                	cmp    %ecx,(%eax)
+  803128:	75 05                	jne    80312f <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80312a:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80312d:	c9                   	leave
+  80312e:	c3                   	ret
+		return -E_NOT_SUPP;
+  80312f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803134:	eb f7                	jmp    80312d <fd2sockid+0x27>
+
+00803136 <sock_flags>:
+{
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  80313c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80313f:	52                   	push   %edx
+  803140:	50                   	push   %eax
+  803141:	e8 db ec ff ff       	call   801e21 <fd_lookup>
+  803146:	83 c4 10             	add    $0x10,%esp
+  803149:	85 c0                	test   %eax,%eax
+  80314b:	78 0e                	js     80315b <sock_flags+0x25>
+  80314d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803150:	8b 40 08             	mov    0x8(%eax),%eax
+  803153:	c1 e8 09             	shr    $0x9,%eax
+  803156:	83 e0 08             	and    $0x8,%eax
+}
+  803159:	c9                   	leave
+  80315a:	c3                   	ret
+		return 0;
+  80315b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803160:	eb f7                	jmp    803159 <sock_flags+0x23>
+
+00803162 <alloc_sockfd>:
+{
+  803162:	55                   	push   %ebp
+  803163:	89 e5                	mov    %esp,%ebp
+  803165:	56                   	push   %esi
+  803166:	53                   	push   %ebx
+  803167:	83 ec 1c             	sub    $0x1c,%esp
+  80316a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80316c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80316f:	50                   	push   %eax
+  803170:	e8 5c ec ff ff       	call   801dd1 <fd_alloc>
+  803175:	89 c3                	mov    %eax,%ebx
+  803177:	83 c4 10             	add    $0x10,%esp
+  80317a:	85 c0                	test   %eax,%eax
+  80317c:	78 43                	js     8031c1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80317e:	83 ec 04             	sub    $0x4,%esp
+  803181:	68 07 04 00 00       	push   $0x407
+  803186:	ff 75 f4             	push   -0xc(%ebp)
+  803189:	6a 00                	push   $0x0
+  80318b:	e8 3b e0 ff ff       	call   8011cb <sys_page_alloc>
+  803190:	89 c3                	mov    %eax,%ebx
+  803192:	83 c4 10             	add    $0x10,%esp
+  803195:	85 c0                	test   %eax,%eax
+  803197:	78 28                	js     8031c1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80319c:	8b 15 60 60 80 00    	mov    0x806060,%edx
+  8031a2:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8031a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8031ae:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8031b1:	83 ec 0c             	sub    $0xc,%esp
+  8031b4:	50                   	push   %eax
+  8031b5:	e8 f0 eb ff ff       	call   801daa <fd2num>
+  8031ba:	89 c3                	mov    %eax,%ebx
+  8031bc:	83 c4 10             	add    $0x10,%esp
+  8031bf:	eb 0c                	jmp    8031cd <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8031c1:	83 ec 0c             	sub    $0xc,%esp
+  8031c4:	56                   	push   %esi
+  8031c5:	e8 4b 04 00 00       	call   803615 <nsipc_close>
+		return r;
+  8031ca:	83 c4 10             	add    $0x10,%esp
+}
+  8031cd:	89 d8                	mov    %ebx,%eax
+  8031cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031d2:	5b                   	pop    %ebx
+  8031d3:	5e                   	pop    %esi
+  8031d4:	5d                   	pop    %ebp
+  8031d5:	c3                   	ret
+
+008031d6 <accept>:
+{
+  8031d6:	55                   	push   %ebp
+  8031d7:	89 e5                	mov    %esp,%ebp
+  8031d9:	56                   	push   %esi
+  8031da:	53                   	push   %ebx
+  8031db:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8031de:	89 f0                	mov    %esi,%eax
+  8031e0:	e8 21 ff ff ff       	call   803106 <fd2sockid>
+  8031e5:	89 c3                	mov    %eax,%ebx
+  8031e7:	85 c0                	test   %eax,%eax
+  8031e9:	78 24                	js     80320f <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8031eb:	89 f0                	mov    %esi,%eax
+  8031ed:	e8 44 ff ff ff       	call   803136 <sock_flags>
+  8031f2:	50                   	push   %eax
+  8031f3:	ff 75 10             	push   0x10(%ebp)
+  8031f6:	ff 75 0c             	push   0xc(%ebp)
+  8031f9:	53                   	push   %ebx
+  8031fa:	e8 6b 03 00 00       	call   80356a <nsipc_accept>
+  8031ff:	89 c3                	mov    %eax,%ebx
+  803201:	83 c4 10             	add    $0x10,%esp
+  803204:	85 c0                	test   %eax,%eax
+  803206:	78 07                	js     80320f <accept+0x39>
+	return alloc_sockfd(r);
+  803208:	e8 55 ff ff ff       	call   803162 <alloc_sockfd>
+  80320d:	89 c3                	mov    %eax,%ebx
+}
+  80320f:	89 d8                	mov    %ebx,%eax
+  803211:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803214:	5b                   	pop    %ebx
+  803215:	5e                   	pop    %esi
+  803216:	5d                   	pop    %ebp
+  803217:	c3                   	ret
+
+00803218 <bind>:
+{
+  803218:	55                   	push   %ebp
+  803219:	89 e5                	mov    %esp,%ebp
+  80321b:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80321e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803221:	e8 e0 fe ff ff       	call   803106 <fd2sockid>
+  803226:	85 c0                	test   %eax,%eax
+  803228:	78 12                	js     80323c <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80322a:	83 ec 04             	sub    $0x4,%esp
+  80322d:	ff 75 10             	push   0x10(%ebp)
+  803230:	ff 75 0c             	push   0xc(%ebp)
+  803233:	50                   	push   %eax
+  803234:	e8 85 03 00 00       	call   8035be <nsipc_bind>
+  803239:	83 c4 10             	add    $0x10,%esp
+}
+  80323c:	c9                   	leave
+  80323d:	c3                   	ret
+
+0080323e <shutdown>:
+{
+  80323e:	55                   	push   %ebp
+  80323f:	89 e5                	mov    %esp,%ebp
+  803241:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803244:	8b 45 08             	mov    0x8(%ebp),%eax
+  803247:	e8 ba fe ff ff       	call   803106 <fd2sockid>
+  80324c:	85 c0                	test   %eax,%eax
+  80324e:	78 0f                	js     80325f <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803250:	83 ec 08             	sub    $0x8,%esp
+  803253:	ff 75 0c             	push   0xc(%ebp)
+  803256:	50                   	push   %eax
+  803257:	e8 97 03 00 00       	call   8035f3 <nsipc_shutdown>
+  80325c:	83 c4 10             	add    $0x10,%esp
+}
+  80325f:	c9                   	leave
+  803260:	c3                   	ret
+
+00803261 <connect>:
+{
+  803261:	55                   	push   %ebp
+  803262:	89 e5                	mov    %esp,%ebp
+  803264:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803267:	8b 45 08             	mov    0x8(%ebp),%eax
+  80326a:	e8 97 fe ff ff       	call   803106 <fd2sockid>
+  80326f:	85 c0                	test   %eax,%eax
+  803271:	78 12                	js     803285 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803273:	83 ec 04             	sub    $0x4,%esp
+  803276:	ff 75 10             	push   0x10(%ebp)
+  803279:	ff 75 0c             	push   0xc(%ebp)
+  80327c:	50                   	push   %eax
+  80327d:	e8 ad 03 00 00       	call   80362f <nsipc_connect>
+  803282:	83 c4 10             	add    $0x10,%esp
+}
+  803285:	c9                   	leave
+  803286:	c3                   	ret
+
+00803287 <listen>:
+{
+  803287:	55                   	push   %ebp
+  803288:	89 e5                	mov    %esp,%ebp
+  80328a:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80328d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803290:	e8 71 fe ff ff       	call   803106 <fd2sockid>
+  803295:	85 c0                	test   %eax,%eax
+  803297:	78 0f                	js     8032a8 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803299:	83 ec 08             	sub    $0x8,%esp
+  80329c:	ff 75 0c             	push   0xc(%ebp)
+  80329f:	50                   	push   %eax
+  8032a0:	e8 bf 03 00 00       	call   803664 <nsipc_listen>
+  8032a5:	83 c4 10             	add    $0x10,%esp
+}
+  8032a8:	c9                   	leave
+  8032a9:	c3                   	ret
+
+008032aa <sendmsg>:
+{
+  8032aa:	55                   	push   %ebp
+  8032ab:	89 e5                	mov    %esp,%ebp
+  8032ad:	57                   	push   %edi
+  8032ae:	56                   	push   %esi
+  8032af:	53                   	push   %ebx
+  8032b0:	83 ec 0c             	sub    $0xc,%esp
+  8032b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032b6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8032b9:	89 f0                	mov    %esi,%eax
+  8032bb:	e8 46 fe ff ff       	call   803106 <fd2sockid>
+  8032c0:	89 c3                	mov    %eax,%ebx
+  8032c2:	85 c0                	test   %eax,%eax
+  8032c4:	78 1c                	js     8032e2 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8032c6:	89 f0                	mov    %esi,%eax
+  8032c8:	e8 69 fe ff ff       	call   803136 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8032cd:	0b 45 10             	or     0x10(%ebp),%eax
+  8032d0:	50                   	push   %eax
+  8032d1:	ff 77 0c             	push   0xc(%edi)
+  8032d4:	ff 77 08             	push   0x8(%edi)
+  8032d7:	53                   	push   %ebx
+  8032d8:	e8 7c 04 00 00       	call   803759 <nsipc_sendmsg>
+  8032dd:	89 c3                	mov    %eax,%ebx
+  8032df:	83 c4 10             	add    $0x10,%esp
+}
+  8032e2:	89 d8                	mov    %ebx,%eax
+  8032e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032e7:	5b                   	pop    %ebx
+  8032e8:	5e                   	pop    %esi
+  8032e9:	5f                   	pop    %edi
+  8032ea:	5d                   	pop    %ebp
+  8032eb:	c3                   	ret
+
+008032ec <recvmsg>:
+{
+  8032ec:	55                   	push   %ebp
+  8032ed:	89 e5                	mov    %esp,%ebp
+  8032ef:	57                   	push   %edi
+  8032f0:	56                   	push   %esi
+  8032f1:	53                   	push   %ebx
+  8032f2:	83 ec 0c             	sub    $0xc,%esp
+  8032f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8032fb:	89 f8                	mov    %edi,%eax
+  8032fd:	e8 04 fe ff ff       	call   803106 <fd2sockid>
+  803302:	89 c3                	mov    %eax,%ebx
+  803304:	85 c0                	test   %eax,%eax
+  803306:	78 2a                	js     803332 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  803308:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  80330f:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  803316:	89 f8                	mov    %edi,%eax
+  803318:	e8 19 fe ff ff       	call   803136 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80331d:	0b 45 10             	or     0x10(%ebp),%eax
+  803320:	50                   	push   %eax
+  803321:	ff 76 0c             	push   0xc(%esi)
+  803324:	ff 76 08             	push   0x8(%esi)
+  803327:	53                   	push   %ebx
+  803328:	e8 d6 07 00 00       	call   803b03 <nsipc_recvmsg>
+  80332d:	89 c3                	mov    %eax,%ebx
+  80332f:	83 c4 10             	add    $0x10,%esp
+}
+  803332:	89 d8                	mov    %ebx,%eax
+  803334:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803337:	5b                   	pop    %ebx
+  803338:	5e                   	pop    %esi
+  803339:	5f                   	pop    %edi
+  80333a:	5d                   	pop    %ebp
+  80333b:	c3                   	ret
+
+0080333c <sendfile>:
+{
+  80333c:	55                   	push   %ebp
+  80333d:	89 e5                	mov    %esp,%ebp
+  80333f:	56                   	push   %esi
+  803340:	53                   	push   %ebx
+  803341:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  803344:	89 f0                	mov    %esi,%eax
+  803346:	e8 bb fd ff ff       	call   803106 <fd2sockid>
+  80334b:	89 c3                	mov    %eax,%ebx
+  80334d:	85 c0                	test   %eax,%eax
+  80334f:	78 1f                	js     803370 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  803351:	89 f0                	mov    %esi,%eax
+  803353:	e8 de fd ff ff       	call   803136 <sock_flags>
+  803358:	83 ec 0c             	sub    $0xc,%esp
+  80335b:	50                   	push   %eax
+  80335c:	ff 75 14             	push   0x14(%ebp)
+  80335f:	ff 75 10             	push   0x10(%ebp)
+  803362:	ff 75 0c             	push   0xc(%ebp)
+  803365:	53                   	push   %ebx
+  803366:	e8 64 06 00 00       	call   8039cf <nsipc_sendfile>
+  80336b:	89 c3                	mov    %eax,%ebx
+  80336d:	83 c4 20             	add    $0x20,%esp
+}
+  803370:	89 d8                	mov    %ebx,%eax
+  803372:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803375:	5b                   	pop    %ebx
+  803376:	5e                   	pop    %esi
+  803377:	5d                   	pop    %ebp
+  803378:	c3                   	ret
+
+00803379 <evctl>:
+{
+  803379:	55                   	push   %ebp
+  80337a:	89 e5                	mov    %esp,%ebp
+  80337c:	53                   	push   %ebx
+  80337d:	83 ec 04             	sub    $0x4,%esp
+  803380:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  803383:	89 d8                	mov    %ebx,%eax
+  803385:	e8 7c fd ff ff       	call   803106 <fd2sockid>
+  80338a:	85 c0                	test   %eax,%eax
+  80338c:	78 10                	js     80339e <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80338e:	83 ec 04             	sub    $0x4,%esp
+  803391:	53                   	push   %ebx
+  803392:	ff 75 0c             	push   0xc(%ebp)
+  803395:	50                   	push   %eax
+  803396:	e8 d2 0b 00 00       	call   803f6d <nsipc_evctl>
+  80339b:	83 c4 10             	add    $0x10,%esp
+}
+  80339e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033a1:	c9                   	leave
+  8033a2:	c3                   	ret
+
+008033a3 <evwait>:
+{
+  8033a3:	55                   	push   %ebp
+  8033a4:	89 e5                	mov    %esp,%ebp
+  8033a6:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  8033a9:	ff 75 10             	push   0x10(%ebp)
+  8033ac:	ff 75 0c             	push   0xc(%ebp)
+  8033af:	ff 75 08             	push   0x8(%ebp)
+  8033b2:	e8 e0 0b 00 00       	call   803f97 <nsipc_evwait>
+}
+  8033b7:	c9                   	leave
+  8033b8:	c3                   	ret
+
+008033b9 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8033b9:	55                   	push   %ebp
+  8033ba:	89 e5                	mov    %esp,%ebp
+  8033bc:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8033bf:	ff 75 10             	push   0x10(%ebp)
+  8033c2:	ff 75 0c             	push   0xc(%ebp)
+  8033c5:	ff 75 08             	push   0x8(%ebp)
+  8033c8:	e8 31 0c 00 00       	call   803ffe <nsipc_socket>
+  8033cd:	83 c4 10             	add    $0x10,%esp
+  8033d0:	85 c0                	test   %eax,%eax
+  8033d2:	78 05                	js     8033d9 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8033d4:	e8 89 fd ff ff       	call   803162 <alloc_sockfd>
+}
+  8033d9:	c9                   	leave
+  8033da:	c3                   	ret
+
+008033db <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8033db:	55                   	push   %ebp
+  8033dc:	89 e5                	mov    %esp,%ebp
+  8033de:	53                   	push   %ebx
+  8033df:	83 ec 04             	sub    $0x4,%esp
+  8033e2:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8033e4:	83 3d 44 80 80 00 00 	cmpl   $0x0,0x808044
+  8033eb:	74 26                	je     803413 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8033ed:	6a 07                	push   $0x7
+  8033ef:	68 00 a0 80 00       	push   $0x80a000
+  8033f4:	53                   	push   %ebx
+  8033f5:	ff 35 44 80 80 00    	push   0x808044
+  8033fb:	e8 84 19 00 00       	call   804d84 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  803400:	83 c4 0c             	add    $0xc,%esp
+  803403:	6a 00                	push   $0x0
+  803405:	6a 00                	push   $0x0
+  803407:	6a 00                	push   $0x0
+  803409:	e8 e6 16 00 00       	call   804af4 <ipc_recv>
+}
+  80340e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803411:	c9                   	leave
+  803412:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803413:	83 ec 0c             	sub    $0xc,%esp
+  803416:	6a 03                	push   $0x3
+  803418:	e8 d0 19 00 00       	call   804ded <ipc_find_env>
+  80341d:	a3 44 80 80 00       	mov    %eax,0x808044
+  803422:	83 c4 10             	add    $0x10,%esp
+  803425:	eb c6                	jmp    8033ed <nsipc+0x12>
+
+00803427 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  803427:	55                   	push   %ebp
+  803428:	89 e5                	mov    %esp,%ebp
+  80342a:	56                   	push   %esi
+  80342b:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  80342c:	8b 35 50 80 80 00    	mov    0x808050,%esi
+		return 0;
+  803432:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  803437:	85 f6                	test   %esi,%esi
+  803439:	75 33                	jne    80346e <nsbulk_map+0x47>
+  80343b:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  803440:	83 ec 04             	sub    $0x4,%esp
+  803443:	6a 07                	push   $0x7
+  803445:	53                   	push   %ebx
+  803446:	6a 00                	push   $0x0
+  803448:	e8 7e dd ff ff       	call   8011cb <sys_page_alloc>
+  80344d:	83 c4 10             	add    $0x10,%esp
+  803450:	85 c0                	test   %eax,%eax
+  803452:	78 1a                	js     80346e <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  803454:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80345a:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  803460:	75 de                	jne    803440 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  803462:	c7 05 50 80 80 00 01 	movl   $0x1,0x808050
+  803469:	00 00 00 
+	return 0;
+  80346c:	89 f0                	mov    %esi,%eax
+}
+  80346e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803471:	5b                   	pop    %ebx
+  803472:	5e                   	pop    %esi
+  803473:	5d                   	pop    %ebp
+  803474:	c3                   	ret
+
+00803475 <nsbulk_own>:
+{
+  803475:	55                   	push   %ebp
+  803476:	89 e5                	mov    %esp,%ebp
+  803478:	57                   	push   %edi
+  803479:	56                   	push   %esi
+  80347a:	53                   	push   %ebx
+  80347b:	83 ec 0c             	sub    $0xc,%esp
+  80347e:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  803480:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  803483:	85 d2                	test   %edx,%edx
+  803485:	7f 0e                	jg     803495 <nsbulk_own+0x20>
+	return 0;
+  803487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80348c:	eb 47                	jmp    8034d5 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80348e:	83 c3 01             	add    $0x1,%ebx
+  803491:	39 fb                	cmp    %edi,%ebx
+  803493:	7d 3b                	jge    8034d0 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  803495:	be 01 00 00 00       	mov    $0x1,%esi
+  80349a:	89 d9                	mov    %ebx,%ecx
+  80349c:	d3 e6                	shl    %cl,%esi
+  80349e:	89 f0                	mov    %esi,%eax
+  8034a0:	23 05 4c 80 80 00    	and    0x80804c,%eax
+  8034a6:	74 e6                	je     80348e <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8034a8:	83 ec 04             	sub    $0x4,%esp
+  8034ab:	6a 07                	push   $0x7
+  8034ad:	89 d8                	mov    %ebx,%eax
+  8034af:	c1 e0 0c             	shl    $0xc,%eax
+  8034b2:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8034b7:	50                   	push   %eax
+  8034b8:	6a 00                	push   $0x0
+  8034ba:	e8 0c dd ff ff       	call   8011cb <sys_page_alloc>
+  8034bf:	83 c4 10             	add    $0x10,%esp
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	78 0f                	js     8034d5 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8034c6:	f7 d6                	not    %esi
+  8034c8:	21 35 4c 80 80 00    	and    %esi,0x80804c
+  8034ce:	eb be                	jmp    80348e <nsbulk_own+0x19>
+	return 0;
+  8034d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d8:	5b                   	pop    %ebx
+  8034d9:	5e                   	pop    %esi
+  8034da:	5f                   	pop    %edi
+  8034db:	5d                   	pop    %ebp
+  8034dc:	c3                   	ret
+
+008034dd <nsipc_bulk>:
+{
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	57                   	push   %edi
+  8034e1:	56                   	push   %esi
+  8034e2:	53                   	push   %ebx
+  8034e3:	83 ec 1c             	sub    $0x1c,%esp
+  8034e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034e9:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8034eb:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8034f1:	c1 fb 0c             	sar    $0xc,%ebx
+  8034f4:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8034f7:	83 3d 44 80 80 00 00 	cmpl   $0x0,0x808044
+  8034fe:	74 56                	je     803556 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  803500:	85 ff                	test   %edi,%edi
+  803502:	7e 24                	jle    803528 <nsipc_bulk+0x4b>
+  803504:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80350a:	74 1c                	je     803528 <nsipc_bulk+0x4b>
+  80350c:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  803512:	c1 e3 0c             	shl    $0xc,%ebx
+  803515:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  80351a:	0f b6 10             	movzbl (%eax),%edx
+  80351d:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80351f:	05 00 10 00 00       	add    $0x1000,%eax
+  803524:	39 d8                	cmp    %ebx,%eax
+  803526:	75 f2                	jne    80351a <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  803528:	83 ec 0c             	sub    $0xc,%esp
+  80352b:	56                   	push   %esi
+  80352c:	57                   	push   %edi
+  80352d:	68 00 00 00 e0       	push   $0xe0000000
+  803532:	ff 75 e4             	push   -0x1c(%ebp)
+  803535:	ff 35 44 80 80 00    	push   0x808044
+  80353b:	e8 78 18 00 00       	call   804db8 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  803540:	83 c4 1c             	add    $0x1c,%esp
+  803543:	6a 00                	push   $0x0
+  803545:	6a 00                	push   $0x0
+  803547:	6a 00                	push   $0x0
+  803549:	e8 a6 15 00 00       	call   804af4 <ipc_recv>
+}
+  80354e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803551:	5b                   	pop    %ebx
+  803552:	5e                   	pop    %esi
+  803553:	5f                   	pop    %edi
+  803554:	5d                   	pop    %ebp
+  803555:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803556:	83 ec 0c             	sub    $0xc,%esp
+  803559:	6a 03                	push   $0x3
+  80355b:	e8 8d 18 00 00       	call   804ded <ipc_find_env>
+  803560:	a3 44 80 80 00       	mov    %eax,0x808044
+  803565:	83 c4 10             	add    $0x10,%esp
+  803568:	eb 96                	jmp    803500 <nsipc_bulk+0x23>
+
+0080356a <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  80356a:	55                   	push   %ebp
+  80356b:	89 e5                	mov    %esp,%ebp
+  80356d:	53                   	push   %ebx
+  80356e:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  803571:	8b 45 08             	mov    0x8(%ebp),%eax
+  803574:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.accept.req_flags = flags;
+  803579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80357c:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803581:	b8 01 00 00 00       	mov    $0x1,%eax
+  803586:	e8 50 fe ff ff       	call   8033db <nsipc>
+  80358b:	89 c3                	mov    %eax,%ebx
+  80358d:	85 c0                	test   %eax,%eax
+  80358f:	79 07                	jns    803598 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803591:	89 d8                	mov    %ebx,%eax
+  803593:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803596:	c9                   	leave
+  803597:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803598:	83 ec 04             	sub    $0x4,%esp
+  80359b:	ff 35 10 a0 80 00    	push   0x80a010
+  8035a1:	68 00 a0 80 00       	push   $0x80a000
+  8035a6:	ff 75 0c             	push   0xc(%ebp)
+  8035a9:	e8 99 d9 ff ff       	call   800f47 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8035ae:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  8035b4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035b7:	89 10                	mov    %edx,(%eax)
+  8035b9:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8035bc:	eb d3                	jmp    803591 <nsipc_accept+0x27>
+
+008035be <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8035be:	55                   	push   %ebp
+  8035bf:	89 e5                	mov    %esp,%ebp
+  8035c1:	53                   	push   %ebx
+  8035c2:	83 ec 08             	sub    $0x8,%esp
+  8035c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8035c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035cb:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8035d0:	53                   	push   %ebx
+  8035d1:	ff 75 0c             	push   0xc(%ebp)
+  8035d4:	68 04 a0 80 00       	push   $0x80a004
+  8035d9:	e8 69 d9 ff ff       	call   800f47 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8035de:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_BIND);
+  8035e4:	b8 02 00 00 00       	mov    $0x2,%eax
+  8035e9:	e8 ed fd ff ff       	call   8033db <nsipc>
+}
+  8035ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+
+008035f3 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8035f3:	55                   	push   %ebp
+  8035f4:	89 e5                	mov    %esp,%ebp
+  8035f6:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8035f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035fc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.shutdown.req_how = how;
+  803601:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803604:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_SHUTDOWN);
+  803609:	b8 03 00 00 00       	mov    $0x3,%eax
+  80360e:	e8 c8 fd ff ff       	call   8033db <nsipc>
+}
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+
+00803615 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803615:	55                   	push   %ebp
+  803616:	89 e5                	mov    %esp,%ebp
+  803618:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80361b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80361e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_CLOSE);
+  803623:	b8 04 00 00 00       	mov    $0x4,%eax
+  803628:	e8 ae fd ff ff       	call   8033db <nsipc>
+}
+  80362d:	c9                   	leave
+  80362e:	c3                   	ret
+
+0080362f <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80362f:	55                   	push   %ebp
+  803630:	89 e5                	mov    %esp,%ebp
+  803632:	53                   	push   %ebx
+  803633:	83 ec 08             	sub    $0x8,%esp
+  803636:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  803639:	8b 45 08             	mov    0x8(%ebp),%eax
+  80363c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  803641:	53                   	push   %ebx
+  803642:	ff 75 0c             	push   0xc(%ebp)
+  803645:	68 04 a0 80 00       	push   $0x80a004
+  80364a:	e8 f8 d8 ff ff       	call   800f47 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80364f:	89 1d 14 a0 80 00    	mov    %ebx,0x80a014
+	return nsipc(NSREQ_CONNECT);
+  803655:	b8 05 00 00 00       	mov    $0x5,%eax
+  80365a:	e8 7c fd ff ff       	call   8033db <nsipc>
+}
+  80365f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803662:	c9                   	leave
+  803663:	c3                   	ret
+
+00803664 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803664:	55                   	push   %ebp
+  803665:	89 e5                	mov    %esp,%ebp
+  803667:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80366a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80366d:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.listen.req_backlog = backlog;
+  803672:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803675:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	return nsipc(NSREQ_LISTEN);
+  80367a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80367f:	e8 57 fd ff ff       	call   8033db <nsipc>
+}
+  803684:	c9                   	leave
+  803685:	c3                   	ret
+
+00803686 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803686:	55                   	push   %ebp
+  803687:	89 e5                	mov    %esp,%ebp
+  803689:	56                   	push   %esi
+  80368a:	53                   	push   %ebx
+  80368b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80368e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803691:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.recv.req_len = len;
+  803696:	89 35 04 a0 80 00    	mov    %esi,0x80a004
+	nsipcbuf.recv.req_flags = flags;
+  80369c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80369f:	a3 08 a0 80 00       	mov    %eax,0x80a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8036a4:	b8 07 00 00 00       	mov    $0x7,%eax
+  8036a9:	e8 2d fd ff ff       	call   8033db <nsipc>
+  8036ae:	89 c3                	mov    %eax,%ebx
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	78 22                	js     8036d6 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8036b4:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8036b9:	39 c6                	cmp    %eax,%esi
+  8036bb:	0f 4e c6             	cmovle %esi,%eax
+  8036be:	39 c3                	cmp    %eax,%ebx
+  8036c0:	7f 1d                	jg     8036df <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8036c2:	83 ec 04             	sub    $0x4,%esp
+  8036c5:	53                   	push   %ebx
+  8036c6:	68 00 a0 80 00       	push   $0x80a000
+  8036cb:	ff 75 0c             	push   0xc(%ebp)
+  8036ce:	e8 74 d8 ff ff       	call   800f47 <memmove>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8036d6:	89 d8                	mov    %ebx,%eax
+  8036d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036db:	5b                   	pop    %ebx
+  8036dc:	5e                   	pop    %esi
+  8036dd:	5d                   	pop    %ebp
+  8036de:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8036df:	68 bb 57 80 00       	push   $0x8057bb
+  8036e4:	68 1a 57 80 00       	push   $0x80571a
+  8036e9:	68 b2 00 00 00       	push   $0xb2
+  8036ee:	68 d0 57 80 00       	push   $0x8057d0
+  8036f3:	e8 cd ce ff ff       	call   8005c5 <_panic>
+
+008036f8 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8036f8:	55                   	push   %ebp
+  8036f9:	89 e5                	mov    %esp,%ebp
+  8036fb:	53                   	push   %ebx
+  8036fc:	83 ec 04             	sub    $0x4,%esp
+  8036ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803702:	8b 45 08             	mov    0x8(%ebp),%eax
+  803705:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	assert(size < 1600);
+  80370a:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803710:	7f 2e                	jg     803740 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803712:	83 ec 04             	sub    $0x4,%esp
+  803715:	53                   	push   %ebx
+  803716:	ff 75 0c             	push   0xc(%ebp)
+  803719:	68 0c a0 80 00       	push   $0x80a00c
+  80371e:	e8 24 d8 ff ff       	call   800f47 <memmove>
+	nsipcbuf.send.req_size = size;
+  803723:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+	nsipcbuf.send.req_flags = flags;
+  803729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80372c:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SEND);
+  803731:	b8 08 00 00 00       	mov    $0x8,%eax
+  803736:	e8 a0 fc ff ff       	call   8033db <nsipc>
+}
+  80373b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80373e:	c9                   	leave
+  80373f:	c3                   	ret
+	assert(size < 1600);
+  803740:	68 dc 57 80 00       	push   $0x8057dc
+  803745:	68 1a 57 80 00       	push   $0x80571a
+  80374a:	68 bd 00 00 00       	push   $0xbd
+  80374f:	68 d0 57 80 00       	push   $0x8057d0
+  803754:	e8 6c ce ff ff       	call   8005c5 <_panic>
+
+00803759 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803759:	55                   	push   %ebp
+  80375a:	89 e5                	mov    %esp,%ebp
+  80375c:	57                   	push   %edi
+  80375d:	56                   	push   %esi
+  80375e:	53                   	push   %ebx
+  80375f:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  803762:	e8 c0 fc ff ff       	call   803427 <nsbulk_map>
+  803767:	85 c0                	test   %eax,%eax
+  803769:	78 55                	js     8037c0 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80376b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  803772:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  803779:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803780:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803783:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803786:	0f 8d 24 02 00 00    	jge    8039b0 <nsipc_sendmsg+0x257>
+  80378c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80378f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803792:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  803795:	89 d8                	mov    %ebx,%eax
+  803797:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80379c:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  80379e:	83 ec 0c             	sub    $0xc,%esp
+  8037a1:	68 40 7d 80 00       	push   $0x807d40
+  8037a6:	e8 bc 0f 00 00       	call   804767 <pgbatch_init>
+  8037ab:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8037ae:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8037b0:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8037b3:	e9 82 00 00 00       	jmp    80383a <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8037b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8037bb:	85 db                	test   %ebx,%ebx
+  8037bd:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8037c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037c3:	5b                   	pop    %ebx
+  8037c4:	5e                   	pop    %esi
+  8037c5:	5f                   	pop    %edi
+  8037c6:	5d                   	pop    %ebp
+  8037c7:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8037c8:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8037cd:	29 c8                	sub    %ecx,%eax
+  8037cf:	39 d0                	cmp    %edx,%eax
+  8037d1:	0f 46 d0             	cmovbe %eax,%edx
+  8037d4:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8037d6:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8037dc:	85 ff                	test   %edi,%edi
+  8037de:	0f 49 c7             	cmovns %edi,%eax
+  8037e1:	c1 f8 0c             	sar    $0xc,%eax
+  8037e4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037e9:	e8 87 fc ff ff       	call   803475 <nsbulk_own>
+  8037ee:	85 c0                	test   %eax,%eax
+  8037f0:	0f 88 17 01 00 00    	js     80390d <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8037f6:	83 ec 04             	sub    $0x4,%esp
+  8037f9:	56                   	push   %esi
+  8037fa:	ff 75 e0             	push   -0x20(%ebp)
+  8037fd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803800:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803805:	50                   	push   %eax
+  803806:	e8 3c d7 ff ff       	call   800f47 <memmove>
+  80380b:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80380e:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  803811:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803814:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803817:	0f 84 fd 00 00 00    	je     80391a <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  80381d:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803820:	01 f7                	add    %esi,%edi
+  803822:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803825:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803828:	0f 8d 01 01 00 00    	jge    80392f <nsipc_sendmsg+0x1d6>
+  80382e:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  803834:	0f 8f f0 00 00 00    	jg     80392a <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  80383a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80383d:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  803840:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  803843:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803846:	89 c2                	mov    %eax,%edx
+  803848:	03 13                	add    (%ebx),%edx
+  80384a:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80384d:	8b 73 04             	mov    0x4(%ebx),%esi
+  803850:	29 c6                	sub    %eax,%esi
+  803852:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  803857:	29 f9                	sub    %edi,%ecx
+  803859:	39 ce                	cmp    %ecx,%esi
+  80385b:	89 ca                	mov    %ecx,%edx
+  80385d:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  803860:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803863:	89 f9                	mov    %edi,%ecx
+  803865:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80386b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80386e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803873:	09 c8                	or     %ecx,%eax
+  803875:	0f 85 4d ff ff ff    	jne    8037c8 <nsipc_sendmsg+0x6f>
+  80387b:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  803881:	0f 86 41 ff ff ff    	jbe    8037c8 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803887:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80388d:	85 ff                	test   %edi,%edi
+  80388f:	0f 49 c7             	cmovns %edi,%eax
+  803892:	c1 f8 0c             	sar    $0xc,%eax
+  803895:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803897:	89 d1                	mov    %edx,%ecx
+  803899:	c1 e9 0c             	shr    $0xc,%ecx
+  80389c:	01 c8                	add    %ecx,%eax
+  80389e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8038a1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8038a4:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8038a6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8038a9:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8038ae:	29 c8                	sub    %ecx,%eax
+  8038b0:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8038b3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8038b6:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8038b8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8038bd:	89 f9                	mov    %edi,%ecx
+  8038bf:	d3 e0                	shl    %cl,%eax
+  8038c1:	09 05 4c 80 80 00    	or     %eax,0x80804c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8038c7:	83 ec 08             	sub    $0x8,%esp
+  8038ca:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8038cc:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8038cf:	50                   	push   %eax
+  8038d0:	6a 00                	push   $0x0
+  8038d2:	56                   	push   %esi
+  8038d3:	6a 00                	push   $0x0
+  8038d5:	68 40 7d 80 00       	push   $0x807d40
+  8038da:	e8 46 0f 00 00       	call   804825 <pgbatch_map>
+  8038df:	83 c4 20             	add    $0x20,%esp
+  8038e2:	85 c0                	test   %eax,%eax
+  8038e4:	0f 88 ce fe ff ff    	js     8037b8 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  8038ea:	83 c7 01             	add    $0x1,%edi
+  8038ed:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8038f3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8038f6:	39 c7                	cmp    %eax,%edi
+  8038f8:	75 be                	jne    8038b8 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8038fa:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8038fd:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  803900:	89 d6                	mov    %edx,%esi
+  803902:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803908:	e9 01 ff ff ff       	jmp    80380e <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  80390d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803910:	85 db                	test   %ebx,%ebx
+  803912:	0f 45 c3             	cmovne %ebx,%eax
+  803915:	e9 a6 fe ff ff       	jmp    8037c0 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  80391a:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80391e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803925:	e9 f3 fe ff ff       	jmp    80381d <nsipc_sendmsg+0xc4>
+  80392a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  80392d:	eb 03                	jmp    803932 <nsipc_sendmsg+0x1d9>
+  80392f:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  803932:	83 ec 0c             	sub    $0xc,%esp
+  803935:	68 40 7d 80 00       	push   $0x807d40
+  80393a:	e8 36 0e 00 00       	call   804775 <pgbatch_flush>
+  80393f:	83 c4 10             	add    $0x10,%esp
+  803942:	85 c0                	test   %eax,%eax
+  803944:	78 50                	js     803996 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  803946:	8b 45 08             	mov    0x8(%ebp),%eax
+  803949:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  80394e:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803954:	89 fb                	mov    %edi,%ebx
+  803956:	29 f3                	sub    %esi,%ebx
+  803958:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  80395e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803961:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803966:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80396b:	89 fa                	mov    %edi,%edx
+  80396d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803972:	e8 66 fb ff ff       	call   8034dd <nsipc_bulk>
+  803977:	85 c0                	test   %eax,%eax
+  803979:	78 28                	js     8039a3 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80397b:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  80397e:	39 c3                	cmp    %eax,%ebx
+  803980:	75 0c                	jne    80398e <nsipc_sendmsg+0x235>
+  803982:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803985:	39 45 10             	cmp    %eax,0x10(%ebp)
+  803988:	0f 8f f2 fd ff ff    	jg     803780 <nsipc_sendmsg+0x27>
+		sent += r;
+  80398e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803991:	e9 2a fe ff ff       	jmp    8037c0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803996:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803999:	85 db                	test   %ebx,%ebx
+  80399b:	0f 45 c3             	cmovne %ebx,%eax
+  80399e:	e9 1d fe ff ff       	jmp    8037c0 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8039a3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8039a6:	85 db                	test   %ebx,%ebx
+  8039a8:	0f 45 c3             	cmovne %ebx,%eax
+  8039ab:	e9 10 fe ff ff       	jmp    8037c0 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8039b0:	83 ec 0c             	sub    $0xc,%esp
+  8039b3:	68 40 7d 80 00       	push   $0x807d40
+  8039b8:	e8 aa 0d 00 00       	call   804767 <pgbatch_init>
+  8039bd:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8039c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8039c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039ca:	e9 63 ff ff ff       	jmp    803932 <nsipc_sendmsg+0x1d9>
+
+008039cf <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8039cf:	55                   	push   %ebp
+  8039d0:	89 e5                	mov    %esp,%ebp
+  8039d2:	57                   	push   %edi
+  8039d3:	56                   	push   %esi
+  8039d4:	53                   	push   %ebx
+  8039d5:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8039d8:	83 3d 48 80 80 00 00 	cmpl   $0x0,0x808048
+  8039df:	0f 84 c8 00 00 00    	je     803aad <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  8039e5:	83 3d 44 80 80 00 00 	cmpl   $0x0,0x808044
+  8039ec:	0f 84 e4 00 00 00    	je     803ad6 <nsipc_sendfile+0x107>
+{
+  8039f2:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8039f7:	89 fb                	mov    %edi,%ebx
+  8039f9:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8039fc:	0f 83 f0 00 00 00    	jae    803af2 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  803a02:	89 fa                	mov    %edi,%edx
+  803a04:	03 55 10             	add    0x10(%ebp),%edx
+  803a07:	89 d0                	mov    %edx,%eax
+  803a09:	c1 f8 1f             	sar    $0x1f,%eax
+  803a0c:	c1 e8 14             	shr    $0x14,%eax
+  803a0f:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  803a12:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  803a18:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803a1a:	6a 10                	push   $0x10
+  803a1c:	68 00 20 01 e0       	push   $0xe0012000
+  803a21:	52                   	push   %edx
+  803a22:	ff 75 0c             	push   0xc(%ebp)
+  803a25:	e8 fe eb ff ff       	call   802628 <fmap>
+  803a2a:	83 c4 10             	add    $0x10,%esp
+  803a2d:	85 c0                	test   %eax,%eax
+  803a2f:	0f 8e b8 00 00 00    	jle    803aed <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  803a35:	39 c6                	cmp    %eax,%esi
+  803a37:	0f 8d b5 00 00 00    	jge    803af2 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  803a3d:	29 f0                	sub    %esi,%eax
+  803a3f:	8b 55 14             	mov    0x14(%ebp),%edx
+  803a42:	29 da                	sub    %ebx,%edx
+  803a44:	39 d0                	cmp    %edx,%eax
+  803a46:	89 d3                	mov    %edx,%ebx
+  803a48:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  803a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a4e:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803a53:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  803a59:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  803a5f:	8b 45 18             	mov    0x18(%ebp),%eax
+  803a62:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803a67:	83 ec 0c             	sub    $0xc,%esp
+  803a6a:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  803a6c:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803a73:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803a76:	83 c0 01             	add    $0x1,%eax
+  803a79:	50                   	push   %eax
+  803a7a:	68 00 10 01 e0       	push   $0xe0011000
+  803a7f:	6a 11                	push   $0x11
+  803a81:	ff 35 44 80 80 00    	push   0x808044
+  803a87:	e8 2c 13 00 00       	call   804db8 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803a8c:	83 c4 1c             	add    $0x1c,%esp
+  803a8f:	6a 00                	push   $0x0
+  803a91:	6a 00                	push   $0x0
+  803a93:	6a 00                	push   $0x0
+  803a95:	e8 5a 10 00 00       	call   804af4 <ipc_recv>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+  803a9d:	85 c0                	test   %eax,%eax
+  803a9f:	78 5b                	js     803afc <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803aa1:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803aa3:	39 c3                	cmp    %eax,%ebx
+  803aa5:	0f 8e 4c ff ff ff    	jle    8039f7 <nsipc_sendfile+0x28>
+  803aab:	eb 45                	jmp    803af2 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  803aad:	83 ec 04             	sub    $0x4,%esp
+  803ab0:	6a 07                	push   $0x7
+  803ab2:	68 00 10 01 e0       	push   $0xe0011000
+  803ab7:	6a 00                	push   $0x0
+  803ab9:	e8 0d d7 ff ff       	call   8011cb <sys_page_alloc>
+  803abe:	89 c7                	mov    %eax,%edi
+  803ac0:	83 c4 10             	add    $0x10,%esp
+  803ac3:	85 c0                	test   %eax,%eax
+  803ac5:	78 2b                	js     803af2 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803ac7:	c7 05 48 80 80 00 01 	movl   $0x1,0x808048
+  803ace:	00 00 00 
+  803ad1:	e9 0f ff ff ff       	jmp    8039e5 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803ad6:	83 ec 0c             	sub    $0xc,%esp
+  803ad9:	6a 03                	push   $0x3
+  803adb:	e8 0d 13 00 00       	call   804ded <ipc_find_env>
+  803ae0:	a3 44 80 80 00       	mov    %eax,0x808044
+  803ae5:	83 c4 10             	add    $0x10,%esp
+  803ae8:	e9 05 ff ff ff       	jmp    8039f2 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  803aed:	85 ff                	test   %edi,%edi
+  803aef:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  803af2:	89 f8                	mov    %edi,%eax
+  803af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803af7:	5b                   	pop    %ebx
+  803af8:	5e                   	pop    %esi
+  803af9:	5f                   	pop    %edi
+  803afa:	5d                   	pop    %ebp
+  803afb:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  803afc:	85 ff                	test   %edi,%edi
+  803afe:	0f 44 f8             	cmove  %eax,%edi
+  803b01:	eb ef                	jmp    803af2 <nsipc_sendfile+0x123>
+
+00803b03 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  803b03:	55                   	push   %ebp
+  803b04:	89 e5                	mov    %esp,%ebp
+  803b06:	57                   	push   %edi
+  803b07:	56                   	push   %esi
+  803b08:	53                   	push   %ebx
+  803b09:	83 ec 1c             	sub    $0x1c,%esp
+  803b0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  803b0f:	e8 13 f9 ff ff       	call   803427 <nsbulk_map>
+  803b14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b17:	85 c0                	test   %eax,%eax
+  803b19:	0f 88 ba 00 00 00    	js     803bd9 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803b1f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803b23:	0f 8e bb 00 00 00    	jle    803be4 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803b29:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803b2e:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803b33:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803b38:	89 f8                	mov    %edi,%eax
+  803b3a:	29 f0                	sub    %esi,%eax
+  803b3c:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  803b40:	39 c8                	cmp    %ecx,%eax
+  803b42:	0f 47 c1             	cmova  %ecx,%eax
+  803b45:	01 f0                	add    %esi,%eax
+  803b47:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803b49:	83 c2 01             	add    $0x1,%edx
+  803b4c:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803b4f:	7e 07                	jle    803b58 <nsipc_recvmsg+0x55>
+  803b51:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803b56:	7e e0                	jle    803b38 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803b58:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803b5e:	c1 fa 0c             	sar    $0xc,%edx
+  803b61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b66:	e8 0a f9 ff ff       	call   803475 <nsbulk_own>
+  803b6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b6e:	85 c0                	test   %eax,%eax
+  803b70:	78 67                	js     803bd9 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803b72:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b75:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803b7a:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803b80:	8b 45 14             	mov    0x14(%ebp),%eax
+  803b83:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803b88:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803b8d:	89 f2                	mov    %esi,%edx
+  803b8f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803b94:	e8 44 f9 ff ff       	call   8034dd <nsipc_bulk>
+  803b99:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803b9c:	85 c0                	test   %eax,%eax
+  803b9e:	78 39                	js     803bd9 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803ba0:	39 f0                	cmp    %esi,%eax
+  803ba2:	7f 4a                	jg     803bee <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ba9:	85 c0                	test   %eax,%eax
+  803bab:	7e 2c                	jle    803bd9 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  803bad:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803bb0:	29 fe                	sub    %edi,%esi
+  803bb2:	8b 43 04             	mov    0x4(%ebx),%eax
+  803bb5:	39 c6                	cmp    %eax,%esi
+  803bb7:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  803bba:	83 ec 04             	sub    $0x4,%esp
+  803bbd:	56                   	push   %esi
+  803bbe:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803bc4:	50                   	push   %eax
+  803bc5:	ff 33                	push   (%ebx)
+  803bc7:	e8 7b d3 ff ff       	call   800f47 <memmove>
+		n += m;
+  803bcc:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803bce:	83 c3 08             	add    $0x8,%ebx
+  803bd1:	83 c4 10             	add    $0x10,%esp
+  803bd4:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803bd7:	7f d4                	jg     803bad <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  803bd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803bdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bdf:	5b                   	pop    %ebx
+  803be0:	5e                   	pop    %esi
+  803be1:	5f                   	pop    %edi
+  803be2:	5d                   	pop    %ebp
+  803be3:	c3                   	ret
+	int r, i, n, len = 0;
+  803be4:	be 00 00 00 00       	mov    $0x0,%esi
+  803be9:	e9 6a ff ff ff       	jmp    803b58 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  803bee:	68 c7 57 80 00       	push   $0x8057c7
+  803bf3:	68 1a 57 80 00       	push   $0x80571a
+  803bf8:	68 3b 01 00 00       	push   $0x13b
+  803bfd:	68 d0 57 80 00       	push   $0x8057d0
+  803c02:	e8 be c9 ff ff       	call   8005c5 <_panic>
+
+00803c07 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  803c07:	55                   	push   %ebp
+  803c08:	89 e5                	mov    %esp,%ebp
+  803c0a:	57                   	push   %edi
+  803c0b:	56                   	push   %esi
+  803c0c:	53                   	push   %ebx
+  803c0d:	83 ec 0c             	sub    $0xc,%esp
+  803c10:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803c13:	8b 75 10             	mov    0x10(%ebp),%esi
+  803c16:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c1c:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.select.req_readset = *readset;
+  803c21:	8b 07                	mov    (%edi),%eax
+  803c23:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  803c28:	8b 47 04             	mov    0x4(%edi),%eax
+  803c2b:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  803c30:	8b 47 08             	mov    0x8(%edi),%eax
+  803c33:	a3 0c a0 80 00       	mov    %eax,0x80a00c
+  803c38:	8b 47 0c             	mov    0xc(%edi),%eax
+  803c3b:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  803c40:	8b 47 10             	mov    0x10(%edi),%eax
+  803c43:	a3 14 a0 80 00       	mov    %eax,0x80a014
+  803c48:	8b 47 14             	mov    0x14(%edi),%eax
+  803c4b:	a3 18 a0 80 00       	mov    %eax,0x80a018
+  803c50:	8b 47 18             	mov    0x18(%edi),%eax
+  803c53:	a3 1c a0 80 00       	mov    %eax,0x80a01c
+  803c58:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803c5b:	a3 20 a0 80 00       	mov    %eax,0x80a020
+  803c60:	8b 47 20             	mov    0x20(%edi),%eax
+  803c63:	a3 24 a0 80 00       	mov    %eax,0x80a024
+  803c68:	8b 47 24             	mov    0x24(%edi),%eax
+  803c6b:	a3 28 a0 80 00       	mov    %eax,0x80a028
+  803c70:	8b 47 28             	mov    0x28(%edi),%eax
+  803c73:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  803c78:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803c7b:	a3 30 a0 80 00       	mov    %eax,0x80a030
+  803c80:	8b 47 30             	mov    0x30(%edi),%eax
+  803c83:	a3 34 a0 80 00       	mov    %eax,0x80a034
+  803c88:	8b 47 34             	mov    0x34(%edi),%eax
+  803c8b:	a3 38 a0 80 00       	mov    %eax,0x80a038
+  803c90:	8b 47 38             	mov    0x38(%edi),%eax
+  803c93:	a3 3c a0 80 00       	mov    %eax,0x80a03c
+  803c98:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803c9b:	a3 40 a0 80 00       	mov    %eax,0x80a040
+	nsipcbuf.select.req_writeset = *writeset;
+  803ca0:	8b 06                	mov    (%esi),%eax
+  803ca2:	a3 44 a0 80 00       	mov    %eax,0x80a044
+  803ca7:	8b 46 04             	mov    0x4(%esi),%eax
+  803caa:	a3 48 a0 80 00       	mov    %eax,0x80a048
+  803caf:	8b 46 08             	mov    0x8(%esi),%eax
+  803cb2:	a3 4c a0 80 00       	mov    %eax,0x80a04c
+  803cb7:	8b 46 0c             	mov    0xc(%esi),%eax
+  803cba:	a3 50 a0 80 00       	mov    %eax,0x80a050
+  803cbf:	8b 46 10             	mov    0x10(%esi),%eax
+  803cc2:	a3 54 a0 80 00       	mov    %eax,0x80a054
+  803cc7:	8b 46 14             	mov    0x14(%esi),%eax
+  803cca:	a3 58 a0 80 00       	mov    %eax,0x80a058
+  803ccf:	8b 46 18             	mov    0x18(%esi),%eax
+  803cd2:	a3 5c a0 80 00       	mov    %eax,0x80a05c
+  803cd7:	8b 46 1c             	mov    0x1c(%esi),%eax
+  803cda:	a3 60 a0 80 00       	mov    %eax,0x80a060
+  803cdf:	8b 46 20             	mov    0x20(%esi),%eax
+  803ce2:	a3 64 a0 80 00       	mov    %eax,0x80a064
+  803ce7:	8b 46 24             	mov    0x24(%esi),%eax
+  803cea:	a3 68 a0 80 00       	mov    %eax,0x80a068
+  803cef:	8b 46 28             	mov    0x28(%esi),%eax
+  803cf2:	a3 6c a0 80 00       	mov    %eax,0x80a06c
+  803cf7:	8b 46 2c             	mov    0x2c(%esi),%eax
+  803cfa:	a3 70 a0 80 00       	mov    %eax,0x80a070
+  803cff:	8b 46 30             	mov    0x30(%esi),%eax
+  803d02:	a3 74 a0 80 00       	mov    %eax,0x80a074
+  803d07:	8b 46 34             	mov    0x34(%esi),%eax
+  803d0a:	a3 78 a0 80 00       	mov    %eax,0x80a078
+  803d0f:	8b 46 38             	mov    0x38(%esi),%eax
+  803d12:	a3 7c a0 80 00       	mov    %eax,0x80a07c
+  803d17:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803d1a:	a3 80 a0 80 00       	mov    %eax,0x80a080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  803d1f:	8b 03                	mov    (%ebx),%eax
+  803d21:	a3 84 a0 80 00       	mov    %eax,0x80a084
+  803d26:	8b 43 04             	mov    0x4(%ebx),%eax
+  803d29:	a3 88 a0 80 00       	mov    %eax,0x80a088
+  803d2e:	8b 43 08             	mov    0x8(%ebx),%eax
+  803d31:	a3 8c a0 80 00       	mov    %eax,0x80a08c
+  803d36:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803d39:	a3 90 a0 80 00       	mov    %eax,0x80a090
+  803d3e:	8b 43 10             	mov    0x10(%ebx),%eax
+  803d41:	a3 94 a0 80 00       	mov    %eax,0x80a094
+  803d46:	8b 43 14             	mov    0x14(%ebx),%eax
+  803d49:	a3 98 a0 80 00       	mov    %eax,0x80a098
+  803d4e:	8b 43 18             	mov    0x18(%ebx),%eax
+  803d51:	a3 9c a0 80 00       	mov    %eax,0x80a09c
+  803d56:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803d59:	a3 a0 a0 80 00       	mov    %eax,0x80a0a0
+  803d5e:	8b 43 20             	mov    0x20(%ebx),%eax
+  803d61:	a3 a4 a0 80 00       	mov    %eax,0x80a0a4
+  803d66:	8b 43 24             	mov    0x24(%ebx),%eax
+  803d69:	a3 a8 a0 80 00       	mov    %eax,0x80a0a8
+  803d6e:	8b 43 28             	mov    0x28(%ebx),%eax
+  803d71:	a3 ac a0 80 00       	mov    %eax,0x80a0ac
+  803d76:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803d79:	a3 b0 a0 80 00       	mov    %eax,0x80a0b0
+  803d7e:	8b 43 30             	mov    0x30(%ebx),%eax
+  803d81:	a3 b4 a0 80 00       	mov    %eax,0x80a0b4
+  803d86:	8b 43 34             	mov    0x34(%ebx),%eax
+  803d89:	a3 b8 a0 80 00       	mov    %eax,0x80a0b8
+  803d8e:	8b 43 38             	mov    0x38(%ebx),%eax
+  803d91:	a3 bc a0 80 00       	mov    %eax,0x80a0bc
+  803d96:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803d99:	a3 c0 a0 80 00       	mov    %eax,0x80a0c0
+	nsipcbuf.select.req_timeout = msec;
+  803d9e:	8b 45 18             	mov    0x18(%ebp),%eax
+  803da1:	a3 c4 a0 80 00       	mov    %eax,0x80a0c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803da6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803dab:	e8 2b f6 ff ff       	call   8033db <nsipc>
+  803db0:	85 c0                	test   %eax,%eax
+  803db2:	0f 88 ad 01 00 00    	js     803f65 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  803db8:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803dbe:	89 17                	mov    %edx,(%edi)
+  803dc0:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  803dc6:	89 57 04             	mov    %edx,0x4(%edi)
+  803dc9:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  803dcf:	89 57 08             	mov    %edx,0x8(%edi)
+  803dd2:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  803dd8:	89 57 0c             	mov    %edx,0xc(%edi)
+  803ddb:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  803de1:	89 57 10             	mov    %edx,0x10(%edi)
+  803de4:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  803dea:	89 57 14             	mov    %edx,0x14(%edi)
+  803ded:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  803df3:	89 57 18             	mov    %edx,0x18(%edi)
+  803df6:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  803dfc:	89 57 1c             	mov    %edx,0x1c(%edi)
+  803dff:	8b 15 24 a0 80 00    	mov    0x80a024,%edx
+  803e05:	89 57 20             	mov    %edx,0x20(%edi)
+  803e08:	8b 15 28 a0 80 00    	mov    0x80a028,%edx
+  803e0e:	89 57 24             	mov    %edx,0x24(%edi)
+  803e11:	8b 15 2c a0 80 00    	mov    0x80a02c,%edx
+  803e17:	89 57 28             	mov    %edx,0x28(%edi)
+  803e1a:	8b 15 30 a0 80 00    	mov    0x80a030,%edx
+  803e20:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803e23:	8b 15 34 a0 80 00    	mov    0x80a034,%edx
+  803e29:	89 57 30             	mov    %edx,0x30(%edi)
+  803e2c:	8b 15 38 a0 80 00    	mov    0x80a038,%edx
+  803e32:	89 57 34             	mov    %edx,0x34(%edi)
+  803e35:	8b 15 3c a0 80 00    	mov    0x80a03c,%edx
+  803e3b:	89 57 38             	mov    %edx,0x38(%edi)
+  803e3e:	8b 15 40 a0 80 00    	mov    0x80a040,%edx
+  803e44:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803e47:	8b 15 44 a0 80 00    	mov    0x80a044,%edx
+  803e4d:	89 16                	mov    %edx,(%esi)
+  803e4f:	8b 15 48 a0 80 00    	mov    0x80a048,%edx
+  803e55:	89 56 04             	mov    %edx,0x4(%esi)
+  803e58:	8b 15 4c a0 80 00    	mov    0x80a04c,%edx
+  803e5e:	89 56 08             	mov    %edx,0x8(%esi)
+  803e61:	8b 15 50 a0 80 00    	mov    0x80a050,%edx
+  803e67:	89 56 0c             	mov    %edx,0xc(%esi)
+  803e6a:	8b 15 54 a0 80 00    	mov    0x80a054,%edx
+  803e70:	89 56 10             	mov    %edx,0x10(%esi)
+  803e73:	8b 15 58 a0 80 00    	mov    0x80a058,%edx
+  803e79:	89 56 14             	mov    %edx,0x14(%esi)
+  803e7c:	8b 15 5c a0 80 00    	mov    0x80a05c,%edx
+  803e82:	89 56 18             	mov    %edx,0x18(%esi)
+  803e85:	8b 15 60 a0 80 00    	mov    0x80a060,%edx
+  803e8b:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803e8e:	8b 15 64 a0 80 00    	mov    0x80a064,%edx
+  803e94:	89 56 20             	mov    %edx,0x20(%esi)
+  803e97:	8b 15 68 a0 80 00    	mov    0x80a068,%edx
+  803e9d:	89 56 24             	mov    %edx,0x24(%esi)
+  803ea0:	8b 15 6c a0 80 00    	mov    0x80a06c,%edx
+  803ea6:	89 56 28             	mov    %edx,0x28(%esi)
+  803ea9:	8b 15 70 a0 80 00    	mov    0x80a070,%edx
+  803eaf:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803eb2:	8b 15 74 a0 80 00    	mov    0x80a074,%edx
+  803eb8:	89 56 30             	mov    %edx,0x30(%esi)
+  803ebb:	8b 15 78 a0 80 00    	mov    0x80a078,%edx
+  803ec1:	89 56 34             	mov    %edx,0x34(%esi)
+  803ec4:	8b 15 7c a0 80 00    	mov    0x80a07c,%edx
+  803eca:	89 56 38             	mov    %edx,0x38(%esi)
+  803ecd:	8b 15 80 a0 80 00    	mov    0x80a080,%edx
+  803ed3:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803ed6:	8b 15 84 a0 80 00    	mov    0x80a084,%edx
+  803edc:	89 13                	mov    %edx,(%ebx)
+  803ede:	8b 15 88 a0 80 00    	mov    0x80a088,%edx
+  803ee4:	89 53 04             	mov    %edx,0x4(%ebx)
+  803ee7:	8b 15 8c a0 80 00    	mov    0x80a08c,%edx
+  803eed:	89 53 08             	mov    %edx,0x8(%ebx)
+  803ef0:	8b 15 90 a0 80 00    	mov    0x80a090,%edx
+  803ef6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803ef9:	8b 15 94 a0 80 00    	mov    0x80a094,%edx
+  803eff:	89 53 10             	mov    %edx,0x10(%ebx)
+  803f02:	8b 15 98 a0 80 00    	mov    0x80a098,%edx
+  803f08:	89 53 14             	mov    %edx,0x14(%ebx)
+  803f0b:	8b 15 9c a0 80 00    	mov    0x80a09c,%edx
+  803f11:	89 53 18             	mov    %edx,0x18(%ebx)
+  803f14:	8b 15 a0 a0 80 00    	mov    0x80a0a0,%edx
+  803f1a:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803f1d:	8b 15 a4 a0 80 00    	mov    0x80a0a4,%edx
+  803f23:	89 53 20             	mov    %edx,0x20(%ebx)
+  803f26:	8b 15 a8 a0 80 00    	mov    0x80a0a8,%edx
+  803f2c:	89 53 24             	mov    %edx,0x24(%ebx)
+  803f2f:	8b 15 ac a0 80 00    	mov    0x80a0ac,%edx
+  803f35:	89 53 28             	mov    %edx,0x28(%ebx)
+  803f38:	8b 15 b0 a0 80 00    	mov    0x80a0b0,%edx
+  803f3e:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  803f41:	8b 15 b4 a0 80 00    	mov    0x80a0b4,%edx
+  803f47:	89 53 30             	mov    %edx,0x30(%ebx)
+  803f4a:	8b 15 b8 a0 80 00    	mov    0x80a0b8,%edx
+  803f50:	89 53 34             	mov    %edx,0x34(%ebx)
+  803f53:	8b 15 bc a0 80 00    	mov    0x80a0bc,%edx
+  803f59:	89 53 38             	mov    %edx,0x38(%ebx)
+  803f5c:	8b 15 c0 a0 80 00    	mov    0x80a0c0,%edx
+  803f62:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803f65:	83 c4 0c             	add    $0xc,%esp
+  803f68:	5b                   	pop    %ebx
+  803f69:	5e                   	pop    %esi
+  803f6a:	5f                   	pop    %edi
+  803f6b:	5d                   	pop    %ebp
+  803f6c:	c3                   	ret
+
+00803f6d <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  803f6d:	55                   	push   %ebp
+  803f6e:	89 e5                	mov    %esp,%ebp
+  803f70:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803f73:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f76:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.evctl.req_events = events;
+  803f7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803f7e:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.evctl.req_data = data;
+  803f83:	8b 45 10             	mov    0x10(%ebp),%eax
+  803f86:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_EVCTL);
+  803f8b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803f90:	e8 46 f4 ff ff       	call   8033db <nsipc>
+}
+  803f95:	c9                   	leave
+  803f96:	c3                   	ret
+
+00803f97 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803f97:	55                   	push   %ebp
+  803f98:	89 e5                	mov    %esp,%ebp
+  803f9a:	56                   	push   %esi
+  803f9b:	53                   	push   %ebx
+  803f9c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803f9f:	89 35 00 a0 80 00    	mov    %esi,0x80a000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803fa5:	8b 45 10             	mov    0x10(%ebp),%eax
+  803fa8:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  803fad:	b8 10 00 00 00       	mov    $0x10,%eax
+  803fb2:	e8 24 f4 ff ff       	call   8033db <nsipc>
+  803fb7:	89 c3                	mov    %eax,%ebx
+  803fb9:	85 c0                	test   %eax,%eax
+  803fbb:	7e 1f                	jle    803fdc <nsipc_evwait+0x45>
+		assert(r <= max);
+  803fbd:	39 c6                	cmp    %eax,%esi
+  803fbf:	7c 24                	jl     803fe5 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803fc1:	83 ec 04             	sub    $0x4,%esp
+  803fc4:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  803fcb:	50                   	push   %eax
+  803fcc:	68 00 a0 80 00       	push   $0x80a000
+  803fd1:	ff 75 08             	push   0x8(%ebp)
+  803fd4:	e8 6e cf ff ff       	call   800f47 <memmove>
+  803fd9:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  803fdc:	89 d8                	mov    %ebx,%eax
+  803fde:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803fe1:	5b                   	pop    %ebx
+  803fe2:	5e                   	pop    %esi
+  803fe3:	5d                   	pop    %ebp
+  803fe4:	c3                   	ret
+		assert(r <= max);
+  803fe5:	68 e8 57 80 00       	push   $0x8057e8
+  803fea:	68 1a 57 80 00       	push   $0x80571a
+  803fef:	68 6a 01 00 00       	push   $0x16a
+  803ff4:	68 d0 57 80 00       	push   $0x8057d0
+  803ff9:	e8 c7 c5 ff ff       	call   8005c5 <_panic>
+
+00803ffe <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  803ffe:	55                   	push   %ebp
+  803fff:	89 e5                	mov    %esp,%ebp
+  804001:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  804004:	8b 45 08             	mov    0x8(%ebp),%eax
+  804007:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	nsipcbuf.socket.req_type = type;
+  80400c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80400f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+	nsipcbuf.socket.req_protocol = protocol;
+  804014:	8b 45 10             	mov    0x10(%ebp),%eax
+  804017:	a3 08 a0 80 00       	mov    %eax,0x80a008
+	return nsipc(NSREQ_SOCKET);
+  80401c:	b8 09 00 00 00       	mov    $0x9,%eax
+  804021:	e8 b5 f3 ff ff       	call   8033db <nsipc>
+}
+  804026:	c9                   	leave
+  804027:	c3                   	ret
+
+00804028 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  804028:	55                   	push   %ebp
+  804029:	89 e5                	mov    %esp,%ebp
+  80402b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80402e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804031:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	return nsipc(NSREQ_OFFLOAD);
+  804036:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80403b:	e8 9b f3 ff ff       	call   8033db <nsipc>
+}
+  804040:	c9                   	leave
+  804041:	c3                   	ret
+
+00804042 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  804042:	55                   	push   %ebp
+  804043:	89 e5                	mov    %esp,%ebp
+  804045:	53                   	push   %ebx
+  804046:	83 ec 04             	sub    $0x4,%esp
+  804049:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  80404c:	b8 12 00 00 00       	mov    $0x12,%eax
+  804051:	e8 85 f3 ff ff       	call   8033db <nsipc>
+  804056:	85 c0                	test   %eax,%eax
+  804058:	78 50                	js     8040aa <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  80405a:	8b 15 00 a0 80 00    	mov    0x80a000,%edx
+  804060:	89 13                	mov    %edx,(%ebx)
+  804062:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  804068:	89 53 04             	mov    %edx,0x4(%ebx)
+  80406b:	8b 15 08 a0 80 00    	mov    0x80a008,%edx
+  804071:	89 53 08             	mov    %edx,0x8(%ebx)
+  804074:	8b 15 0c a0 80 00    	mov    0x80a00c,%edx
+  80407a:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80407d:	8b 15 10 a0 80 00    	mov    0x80a010,%edx
+  804083:	89 53 10             	mov    %edx,0x10(%ebx)
+  804086:	8b 15 14 a0 80 00    	mov    0x80a014,%edx
+  80408c:	89 53 14             	mov    %edx,0x14(%ebx)
+  80408f:	8b 15 18 a0 80 00    	mov    0x80a018,%edx
+  804095:	89 53 18             	mov    %edx,0x18(%ebx)
+  804098:	8b 15 1c a0 80 00    	mov    0x80a01c,%edx
+  80409e:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8040a1:	8b 15 20 a0 80 00    	mov    0x80a020,%edx
+  8040a7:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  8040aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8040ad:	c9                   	leave
+  8040ae:	c3                   	ret
+
+008040af <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  8040af:	55                   	push   %ebp
+  8040b0:	89 e5                	mov    %esp,%ebp
+  8040b2:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8040b5:	6a 03                	push   $0x3
+  8040b7:	e8 31 0d 00 00       	call   804ded <ipc_find_env>
+  8040bc:	a3 44 80 80 00       	mov    %eax,0x808044
+	nsipcbuf.shard.req_shard = shard;
+  8040c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8040c4:	a3 00 a0 80 00       	mov    %eax,0x80a000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8040c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8040ce:	e8 08 f3 ff ff       	call   8033db <nsipc>
+  8040d3:	83 c4 10             	add    $0x10,%esp
+  8040d6:	85 c0                	test   %eax,%eax
+  8040d8:	78 0a                	js     8040e4 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8040da:	a3 44 80 80 00       	mov    %eax,0x808044
+	return 0;
+  8040df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040e4:	c9                   	leave
+  8040e5:	c3                   	ret
+
+008040e6 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8040e6:	55                   	push   %ebp
+  8040e7:	89 e5                	mov    %esp,%ebp
+  8040e9:	57                   	push   %edi
+  8040ea:	56                   	push   %esi
+  8040eb:	53                   	push   %ebx
+  8040ec:	83 ec 1c             	sub    $0x1c,%esp
+  8040ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8040f2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8040f5:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8040fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040ff:	89 e0                	mov    %esp,%eax
+  804101:	89 f2                	mov    %esi,%edx
+  804103:	29 c2                	sub    %eax,%edx
+  804105:	89 d0                	mov    %edx,%eax
+  804107:	c1 e8 0f             	shr    $0xf,%eax
+  80410a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  804110:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  804113:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  80411a:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80411d:	83 ec 0c             	sub    $0xc,%esp
+  804120:	ff 75 e0             	push   -0x20(%ebp)
+  804123:	e8 04 0d 00 00       	call   804e2c <pageref>
+  804128:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80412b:	83 c4 04             	add    $0x4,%esp
+  80412e:	ff 75 dc             	push   -0x24(%ebp)
+  804131:	e8 f6 0c 00 00       	call   804e2c <pageref>
+  804136:	89 e2                	mov    %esp,%edx
+  804138:	89 f1                	mov    %esi,%ecx
+  80413a:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  80413c:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80413f:	89 ca                	mov    %ecx,%edx
+  804141:	c1 ea 0f             	shr    $0xf,%edx
+  804144:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  80414a:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  80414d:	8b 14 95 60 80 80 00 	mov    0x808060(,%edx,4),%edx
+  804154:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  804157:	39 d7                	cmp    %edx,%edi
+  804159:	74 40                	je     80419b <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  80415b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80415e:	75 9f                	jne    8040ff <_pipeisclosed+0x19>
+  804160:	89 e2                	mov    %esp,%edx
+  804162:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804167:	29 d0                	sub    %edx,%eax
+  804169:	89 c2                	mov    %eax,%edx
+  80416b:	c1 ea 0f             	shr    $0xf,%edx
+  80416e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804173:	b8 00 00 00 00       	mov    $0x0,%eax
+  804178:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80417b:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804182:	8b 40 58             	mov    0x58(%eax),%eax
+  804185:	6a 01                	push   $0x1
+  804187:	50                   	push   %eax
+  804188:	57                   	push   %edi
+  804189:	68 f1 57 80 00       	push   $0x8057f1
+  80418e:	e8 0d c5 ff ff       	call   8006a0 <cprintf>
+  804193:	83 c4 10             	add    $0x10,%esp
+  804196:	e9 5f ff ff ff       	jmp    8040fa <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  80419b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80419e:	0f 94 c0             	sete   %al
+  8041a1:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  8041a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041a7:	5b                   	pop    %ebx
+  8041a8:	5e                   	pop    %esi
+  8041a9:	5f                   	pop    %edi
+  8041aa:	5d                   	pop    %ebp
+  8041ab:	c3                   	ret
+
+008041ac <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8041ac:	55                   	push   %ebp
+  8041ad:	89 e5                	mov    %esp,%ebp
+  8041af:	53                   	push   %ebx
+  8041b0:	83 ec 0c             	sub    $0xc,%esp
+  8041b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8041b6:	53                   	push   %ebx
+  8041b7:	6a 00                	push   $0x0
+  8041b9:	e8 92 d0 ff ff       	call   801250 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8041be:	89 1c 24             	mov    %ebx,(%esp)
+  8041c1:	e8 f4 db ff ff       	call   801dba <fd2data>
+  8041c6:	83 c4 08             	add    $0x8,%esp
+  8041c9:	50                   	push   %eax
+  8041ca:	6a 00                	push   $0x0
+  8041cc:	e8 7f d0 ff ff       	call   801250 <sys_page_unmap>
+}
+  8041d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041d4:	c9                   	leave
+  8041d5:	c3                   	ret
+
+008041d6 <devpipe_read>:
+{
+  8041d6:	55                   	push   %ebp
+  8041d7:	89 e5                	mov    %esp,%ebp
+  8041d9:	57                   	push   %edi
+  8041da:	56                   	push   %esi
+  8041db:	53                   	push   %ebx
+  8041dc:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8041df:	ff 75 08             	push   0x8(%ebp)
+  8041e2:	e8 d3 db ff ff       	call   801dba <fd2data>
+  8041e7:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8041e9:	8b 70 04             	mov    0x4(%eax),%esi
+  8041ec:	8b 00                	mov    (%eax),%eax
+  8041ee:	83 c4 10             	add    $0x10,%esp
+  8041f1:	39 f0                	cmp    %esi,%eax
+  8041f3:	75 36                	jne    80422b <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8041f5:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8041f8:	89 da                	mov    %ebx,%edx
+  8041fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041fd:	e8 e4 fe ff ff       	call   8040e6 <_pipeisclosed>
+  804202:	85 c0                	test   %eax,%eax
+  804204:	0f 85 d4 00 00 00    	jne    8042de <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  80420a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80420f:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  804213:	83 ec 04             	sub    $0x4,%esp
+  804216:	6a ff                	push   $0xffffffff
+  804218:	56                   	push   %esi
+  804219:	57                   	push   %edi
+  80421a:	e8 aa d3 ff ff       	call   8015c9 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80421f:	8b 73 04             	mov    0x4(%ebx),%esi
+  804222:	8b 03                	mov    (%ebx),%eax
+  804224:	83 c4 10             	add    $0x10,%esp
+  804227:	39 c6                	cmp    %eax,%esi
+  804229:	74 cd                	je     8041f8 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80422b:	8b 73 04             	mov    0x4(%ebx),%esi
+  80422e:	8b 03                	mov    (%ebx),%eax
+  804230:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804236:	29 c6                	sub    %eax,%esi
+  804238:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80423d:	f7 e6                	mul    %esi
+  80423f:	c1 ea 0c             	shr    $0xc,%edx
+  804242:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804248:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  80424a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80424d:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  804251:	8b 0b                	mov    (%ebx),%ecx
+  804253:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804258:	f7 e1                	mul    %ecx
+  80425a:	c1 ea 0b             	shr    $0xb,%edx
+  80425d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  804263:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  804265:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80426a:	29 cf                	sub    %ecx,%edi
+  80426c:	39 f7                	cmp    %esi,%edi
+  80426e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  804271:	83 ec 04             	sub    $0x4,%esp
+  804274:	57                   	push   %edi
+  804275:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  804279:	50                   	push   %eax
+  80427a:	ff 75 0c             	push   0xc(%ebp)
+  80427d:	e8 c5 cc ff ff       	call   800f47 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  804282:	83 c4 0c             	add    $0xc,%esp
+  804285:	89 f0                	mov    %esi,%eax
+  804287:	29 f8                	sub    %edi,%eax
+  804289:	50                   	push   %eax
+  80428a:	8d 43 10             	lea    0x10(%ebx),%eax
+  80428d:	50                   	push   %eax
+  80428e:	89 f8                	mov    %edi,%eax
+  804290:	03 45 0c             	add    0xc(%ebp),%eax
+  804293:	50                   	push   %eax
+  804294:	e8 ae cc ff ff       	call   800f47 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  804299:	8b 0b                	mov    (%ebx),%ecx
+  80429b:	01 f1                	add    %esi,%ecx
+  80429d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8042a2:	f7 e1                	mul    %ecx
+  8042a4:	c1 ea 0c             	shr    $0xc,%edx
+  8042a7:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8042ad:	29 c1                	sub    %eax,%ecx
+  8042af:	89 0b                	mov    %ecx,(%ebx)
+  8042b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b6:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8042ba:	83 c4 10             	add    $0x10,%esp
+  8042bd:	85 c0                	test   %eax,%eax
+  8042bf:	75 0a                	jne    8042cb <devpipe_read+0xf5>
+	return n;
+  8042c1:	89 f0                	mov    %esi,%eax
+}
+  8042c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042c6:	5b                   	pop    %ebx
+  8042c7:	5e                   	pop    %esi
+  8042c8:	5f                   	pop    %edi
+  8042c9:	5d                   	pop    %ebp
+  8042ca:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8042cb:	83 ec 08             	sub    $0x8,%esp
+  8042ce:	68 00 04 00 00       	push   $0x400
+  8042d3:	53                   	push   %ebx
+  8042d4:	e8 12 d3 ff ff       	call   8015eb <sys_futex_wake>
+  8042d9:	83 c4 10             	add    $0x10,%esp
+  8042dc:	eb e3                	jmp    8042c1 <devpipe_read+0xeb>
+			return 0;
+  8042de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e3:	eb de                	jmp    8042c3 <devpipe_read+0xed>
+
+008042e5 <devpipe_write>:
+{
+  8042e5:	55                   	push   %ebp
+  8042e6:	89 e5                	mov    %esp,%ebp
+  8042e8:	57                   	push   %edi
+  8042e9:	56                   	push   %esi
+  8042ea:	53                   	push   %ebx
+  8042eb:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8042ee:	ff 75 08             	push   0x8(%ebp)
+  8042f1:	e8 c4 da ff ff       	call   801dba <fd2data>
+  8042f6:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8042f8:	83 c4 10             	add    $0x10,%esp
+  8042fb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804302:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  804307:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80430b:	0f 84 43 01 00 00    	je     804454 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804311:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804314:	8b 06                	mov    (%esi),%eax
+  804316:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80431c:	29 c1                	sub    %eax,%ecx
+  80431e:	89 c8                	mov    %ecx,%eax
+  804320:	f7 e7                	mul    %edi
+  804322:	c1 ea 0c             	shr    $0xc,%edx
+  804325:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80432b:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80432d:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  804333:	75 52                	jne    804387 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  804335:	89 f2                	mov    %esi,%edx
+  804337:	8b 45 08             	mov    0x8(%ebp),%eax
+  80433a:	e8 a7 fd ff ff       	call   8040e6 <_pipeisclosed>
+  80433f:	85 c0                	test   %eax,%eax
+  804341:	0f 85 28 01 00 00    	jne    80446f <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  804347:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804349:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80434c:	8b 06                	mov    (%esi),%eax
+  80434e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804354:	29 c1                	sub    %eax,%ecx
+  804356:	89 c8                	mov    %ecx,%eax
+  804358:	f7 e7                	mul    %edi
+  80435a:	c1 ea 0c             	shr    $0xc,%edx
+  80435d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804363:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  804365:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80436b:	75 a4                	jne    804311 <devpipe_write+0x2c>
+  80436d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804372:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  804376:	83 ec 04             	sub    $0x4,%esp
+  804379:	6a ff                	push   $0xffffffff
+  80437b:	53                   	push   %ebx
+  80437c:	56                   	push   %esi
+  80437d:	e8 47 d2 ff ff       	call   8015c9 <sys_futex_wait>
+}
+  804382:	83 c4 10             	add    $0x10,%esp
+  804385:	eb 8a                	jmp    804311 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804387:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80438a:	8b 06                	mov    (%esi),%eax
+  80438c:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  804392:	29 c1                	sub    %eax,%ecx
+  804394:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  804399:	f7 e1                	mul    %ecx
+  80439b:	c1 ea 0c             	shr    $0xc,%edx
+  80439e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8043a4:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8043a6:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8043ab:	89 d8                	mov    %ebx,%eax
+  8043ad:	29 c8                	sub    %ecx,%eax
+  8043af:	8b 55 10             	mov    0x10(%ebp),%edx
+  8043b2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8043b5:	29 ca                	sub    %ecx,%edx
+  8043b7:	39 d0                	cmp    %edx,%eax
+  8043b9:	0f 46 d0             	cmovbe %eax,%edx
+  8043bc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8043bf:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8043c2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8043c7:	f7 e1                	mul    %ecx
+  8043c9:	c1 ea 0b             	shr    $0xb,%edx
+  8043cc:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8043d2:	89 ca                	mov    %ecx,%edx
+  8043d4:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8043d6:	29 d3                	sub    %edx,%ebx
+  8043d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8043db:	39 c3                	cmp    %eax,%ebx
+  8043dd:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8043e0:	83 ec 04             	sub    $0x4,%esp
+  8043e3:	53                   	push   %ebx
+  8043e4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8043e7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8043ea:	51                   	push   %ecx
+  8043eb:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8043ef:	50                   	push   %eax
+  8043f0:	e8 52 cb ff ff       	call   800f47 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8043f5:	83 c4 0c             	add    $0xc,%esp
+  8043f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8043fb:	29 d8                	sub    %ebx,%eax
+  8043fd:	50                   	push   %eax
+  8043fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804401:	01 cb                	add    %ecx,%ebx
+  804403:	03 5d 0c             	add    0xc(%ebp),%ebx
+  804406:	53                   	push   %ebx
+  804407:	8d 46 10             	lea    0x10(%esi),%eax
+  80440a:	50                   	push   %eax
+  80440b:	e8 37 cb ff ff       	call   800f47 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  804410:	8b 4e 04             	mov    0x4(%esi),%ecx
+  804413:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804416:	01 c1                	add    %eax,%ecx
+  804418:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80441d:	f7 e1                	mul    %ecx
+  80441f:	c1 ea 0c             	shr    $0xc,%edx
+  804422:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  804428:	89 ca                	mov    %ecx,%edx
+  80442a:	29 c2                	sub    %eax,%edx
+  80442c:	89 56 04             	mov    %edx,0x4(%esi)
+  80442f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804434:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  804438:	83 c4 10             	add    $0x10,%esp
+  80443b:	85 c0                	test   %eax,%eax
+  80443d:	75 1a                	jne    804459 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80443f:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  804442:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  804445:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804448:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80444b:	0f 82 c0 fe ff ff    	jb     804311 <devpipe_write+0x2c>
+  804451:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  804454:	8b 45 10             	mov    0x10(%ebp),%eax
+  804457:	eb 1b                	jmp    804474 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  804459:	83 ec 08             	sub    $0x8,%esp
+  80445c:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  804461:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  804464:	50                   	push   %eax
+  804465:	e8 81 d1 ff ff       	call   8015eb <sys_futex_wake>
+  80446a:	83 c4 10             	add    $0x10,%esp
+  80446d:	eb d0                	jmp    80443f <devpipe_write+0x15a>
+				return 0;
+  80446f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804474:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804477:	5b                   	pop    %ebx
+  804478:	5e                   	pop    %esi
+  804479:	5f                   	pop    %edi
+  80447a:	5d                   	pop    %ebp
+  80447b:	c3                   	ret
+
+0080447c <devpipe_stat>:
+{
+  80447c:	55                   	push   %ebp
+  80447d:	89 e5                	mov    %esp,%ebp
+  80447f:	56                   	push   %esi
+  804480:	53                   	push   %ebx
+  804481:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  804484:	83 ec 0c             	sub    $0xc,%esp
+  804487:	ff 75 08             	push   0x8(%ebp)
+  80448a:	e8 2b d9 ff ff       	call   801dba <fd2data>
+  80448f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  804491:	83 c4 08             	add    $0x8,%esp
+  804494:	68 04 58 80 00       	push   $0x805804
+  804499:	53                   	push   %ebx
+  80449a:	e8 f8 c8 ff ff       	call   800d97 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80449f:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8044a2:	8b 06                	mov    (%esi),%eax
+  8044a4:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8044aa:	29 c1                	sub    %eax,%ecx
+  8044ac:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8044b1:	89 c8                	mov    %ecx,%eax
+  8044b3:	f7 e2                	mul    %edx
+  8044b5:	c1 ea 0c             	shr    $0xc,%edx
+  8044b8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8044be:	29 d1                	sub    %edx,%ecx
+  8044c0:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8044c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8044cd:	00 00 00 
+	stat->st_dev = &devpipe;
+  8044d0:	c7 83 8c 00 00 00 80 	movl   $0x806080,0x8c(%ebx)
+  8044d7:	60 80 00 
+}
+  8044da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044e2:	5b                   	pop    %ebx
+  8044e3:	5e                   	pop    %esi
+  8044e4:	5d                   	pop    %ebp
+  8044e5:	c3                   	ret
+
+008044e6 <devpipe_poll>:
+{
+  8044e6:	55                   	push   %ebp
+  8044e7:	89 e5                	mov    %esp,%ebp
+  8044e9:	57                   	push   %edi
+  8044ea:	56                   	push   %esi
+  8044eb:	53                   	push   %ebx
+  8044ec:	83 ec 18             	sub    $0x18,%esp
+  8044ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8044f2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8044f5:	57                   	push   %edi
+  8044f6:	e8 bf d8 ff ff       	call   801dba <fd2data>
+  8044fb:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8044fd:	83 c4 10             	add    $0x10,%esp
+  804500:	89 f3                	mov    %esi,%ebx
+  804502:	83 e3 01             	and    $0x1,%ebx
+  804505:	75 27                	jne    80452e <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  804507:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  80450d:	75 48                	jne    804557 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80450f:	89 ca                	mov    %ecx,%edx
+  804511:	89 f8                	mov    %edi,%eax
+  804513:	e8 ce fb ff ff       	call   8040e6 <_pipeisclosed>
+  804518:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  80451a:	89 d8                	mov    %ebx,%eax
+  80451c:	83 c8 10             	or     $0x10,%eax
+  80451f:	85 d2                	test   %edx,%edx
+  804521:	0f 45 d8             	cmovne %eax,%ebx
+}
+  804524:	89 d8                	mov    %ebx,%eax
+  804526:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804529:	5b                   	pop    %ebx
+  80452a:	5e                   	pop    %esi
+  80452b:	5f                   	pop    %edi
+  80452c:	5d                   	pop    %ebp
+  80452d:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80452e:	8b 58 04             	mov    0x4(%eax),%ebx
+  804531:	8b 00                	mov    (%eax),%eax
+  804533:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  804539:	29 c3                	sub    %eax,%ebx
+  80453b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804540:	89 d8                	mov    %ebx,%eax
+  804542:	f7 e2                	mul    %edx
+  804544:	c1 ea 0c             	shr    $0xc,%edx
+  804547:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  80454d:	39 d3                	cmp    %edx,%ebx
+  80454f:	0f 95 c3             	setne  %bl
+  804552:	0f b6 db             	movzbl %bl,%ebx
+  804555:	eb b0                	jmp    804507 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  804557:	8b 71 04             	mov    0x4(%ecx),%esi
+  80455a:	8b 01                	mov    (%ecx),%eax
+  80455c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  804562:	29 c6                	sub    %eax,%esi
+  804564:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  804569:	89 f0                	mov    %esi,%eax
+  80456b:	f7 e2                	mul    %edx
+  80456d:	c1 ea 0c             	shr    $0xc,%edx
+  804570:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  804576:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  804578:	89 d8                	mov    %ebx,%eax
+  80457a:	83 c8 04             	or     $0x4,%eax
+  80457d:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  804583:	0f 42 d8             	cmovb  %eax,%ebx
+  804586:	eb 87                	jmp    80450f <devpipe_poll+0x29>
+
+00804588 <pipe>:
+{
+  804588:	55                   	push   %ebp
+  804589:	89 e5                	mov    %esp,%ebp
+  80458b:	56                   	push   %esi
+  80458c:	53                   	push   %ebx
+  80458d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  804590:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804593:	50                   	push   %eax
+  804594:	e8 38 d8 ff ff       	call   801dd1 <fd_alloc>
+  804599:	89 c3                	mov    %eax,%ebx
+  80459b:	83 c4 10             	add    $0x10,%esp
+  80459e:	85 c0                	test   %eax,%eax
+  8045a0:	0f 88 23 01 00 00    	js     8046c9 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8045a6:	83 ec 04             	sub    $0x4,%esp
+  8045a9:	68 07 04 00 00       	push   $0x407
+  8045ae:	ff 75 f4             	push   -0xc(%ebp)
+  8045b1:	6a 00                	push   $0x0
+  8045b3:	e8 13 cc ff ff       	call   8011cb <sys_page_alloc>
+  8045b8:	89 c3                	mov    %eax,%ebx
+  8045ba:	83 c4 10             	add    $0x10,%esp
+  8045bd:	85 c0                	test   %eax,%eax
+  8045bf:	0f 88 04 01 00 00    	js     8046c9 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8045c5:	83 ec 0c             	sub    $0xc,%esp
+  8045c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8045cb:	50                   	push   %eax
+  8045cc:	e8 00 d8 ff ff       	call   801dd1 <fd_alloc>
+  8045d1:	89 c3                	mov    %eax,%ebx
+  8045d3:	83 c4 10             	add    $0x10,%esp
+  8045d6:	85 c0                	test   %eax,%eax
+  8045d8:	0f 88 db 00 00 00    	js     8046b9 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8045de:	83 ec 04             	sub    $0x4,%esp
+  8045e1:	68 07 04 00 00       	push   $0x407
+  8045e6:	ff 75 f0             	push   -0x10(%ebp)
+  8045e9:	6a 00                	push   $0x0
+  8045eb:	e8 db cb ff ff       	call   8011cb <sys_page_alloc>
+  8045f0:	89 c3                	mov    %eax,%ebx
+  8045f2:	83 c4 10             	add    $0x10,%esp
+  8045f5:	85 c0                	test   %eax,%eax
+  8045f7:	0f 88 bc 00 00 00    	js     8046b9 <pipe+0x131>
+	va = fd2data(fd0);
+  8045fd:	83 ec 0c             	sub    $0xc,%esp
+  804600:	ff 75 f4             	push   -0xc(%ebp)
+  804603:	e8 b2 d7 ff ff       	call   801dba <fd2data>
+  804608:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80460a:	83 c4 0c             	add    $0xc,%esp
+  80460d:	68 07 04 00 00       	push   $0x407
+  804612:	50                   	push   %eax
+  804613:	6a 00                	push   $0x0
+  804615:	e8 b1 cb ff ff       	call   8011cb <sys_page_alloc>
+  80461a:	89 c3                	mov    %eax,%ebx
+  80461c:	83 c4 10             	add    $0x10,%esp
+  80461f:	85 c0                	test   %eax,%eax
+  804621:	0f 88 82 00 00 00    	js     8046a9 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  804627:	83 ec 0c             	sub    $0xc,%esp
+  80462a:	ff 75 f0             	push   -0x10(%ebp)
+  80462d:	e8 88 d7 ff ff       	call   801dba <fd2data>
+  804632:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  804639:	50                   	push   %eax
+  80463a:	6a 00                	push   $0x0
+  80463c:	56                   	push   %esi
+  80463d:	6a 00                	push   $0x0
+  80463f:	e8 ca cb ff ff       	call   80120e <sys_page_map>
+  804644:	89 c3                	mov    %eax,%ebx
+  804646:	83 c4 20             	add    $0x20,%esp
+  804649:	85 c0                	test   %eax,%eax
+  80464b:	78 4e                	js     80469b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  80464d:	a1 80 60 80 00       	mov    0x806080,%eax
+  804652:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804655:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804657:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80465a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804661:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804664:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804666:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804669:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804670:	83 ec 0c             	sub    $0xc,%esp
+  804673:	ff 75 f4             	push   -0xc(%ebp)
+  804676:	e8 2f d7 ff ff       	call   801daa <fd2num>
+  80467b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80467e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804680:	83 c4 04             	add    $0x4,%esp
+  804683:	ff 75 f0             	push   -0x10(%ebp)
+  804686:	e8 1f d7 ff ff       	call   801daa <fd2num>
+  80468b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80468e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804691:	83 c4 10             	add    $0x10,%esp
+  804694:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804699:	eb 2e                	jmp    8046c9 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80469b:	83 ec 08             	sub    $0x8,%esp
+  80469e:	56                   	push   %esi
+  80469f:	6a 00                	push   $0x0
+  8046a1:	e8 aa cb ff ff       	call   801250 <sys_page_unmap>
+  8046a6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8046a9:	83 ec 08             	sub    $0x8,%esp
+  8046ac:	ff 75 f0             	push   -0x10(%ebp)
+  8046af:	6a 00                	push   $0x0
+  8046b1:	e8 9a cb ff ff       	call   801250 <sys_page_unmap>
+  8046b6:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8046b9:	83 ec 08             	sub    $0x8,%esp
+  8046bc:	ff 75 f4             	push   -0xc(%ebp)
+  8046bf:	6a 00                	push   $0x0
+  8046c1:	e8 8a cb ff ff       	call   801250 <sys_page_unmap>
+  8046c6:	83 c4 10             	add    $0x10,%esp
+}
+  8046c9:	89 d8                	mov    %ebx,%eax
+  8046cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8046ce:	5b                   	pop    %ebx
+  8046cf:	5e                   	pop    %esi
+  8046d0:	5d                   	pop    %ebp
+  8046d1:	c3                   	ret
+
+008046d2 <pipeisclosed>:
+{
+  8046d2:	55                   	push   %ebp
+  8046d3:	89 e5                	mov    %esp,%ebp
+  8046d5:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8046d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8046db:	50                   	push   %eax
+  8046dc:	ff 75 08             	push   0x8(%ebp)
+  8046df:	e8 3d d7 ff ff       	call   801e21 <fd_lookup>
+  8046e4:	83 c4 10             	add    $0x10,%esp
+  8046e7:	85 c0                	test   %eax,%eax
+  8046e9:	78 18                	js     804703 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8046eb:	83 ec 0c             	sub    $0xc,%esp
+  8046ee:	ff 75 f4             	push   -0xc(%ebp)
+  8046f1:	e8 c4 d6 ff ff       	call   801dba <fd2data>
+  8046f6:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8046f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8046fb:	e8 e6 f9 ff ff       	call   8040e6 <_pipeisclosed>
+  804700:	83 c4 10             	add    $0x10,%esp
+}
+  804703:	c9                   	leave
+  804704:	c3                   	ret
+
+00804705 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  804705:	55                   	push   %ebp
+  804706:	89 e5                	mov    %esp,%ebp
+  804708:	56                   	push   %esi
+  804709:	53                   	push   %ebx
+  80470a:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  80470d:	85 f6                	test   %esi,%esi
+  80470f:	74 40                	je     804751 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  804711:	89 f3                	mov    %esi,%ebx
+  804713:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804719:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  80471f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804724:	8b 40 48             	mov    0x48(%eax),%eax
+  804727:	39 c6                	cmp    %eax,%esi
+  804729:	75 1f                	jne    80474a <wait+0x45>
+  80472b:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  804731:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  804737:	8b 43 54             	mov    0x54(%ebx),%eax
+  80473a:	85 c0                	test   %eax,%eax
+  80473c:	74 0c                	je     80474a <wait+0x45>
+		sys_yield();
+  80473e:	e8 69 ca ff ff       	call   8011ac <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  804743:	8b 43 48             	mov    0x48(%ebx),%eax
+  804746:	39 f0                	cmp    %esi,%eax
+  804748:	74 ed                	je     804737 <wait+0x32>
+}
+  80474a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80474d:	5b                   	pop    %ebx
+  80474e:	5e                   	pop    %esi
+  80474f:	5d                   	pop    %ebp
+  804750:	c3                   	ret
+	assert(envid != 0);
+  804751:	68 10 58 80 00       	push   $0x805810
+  804756:	68 1a 57 80 00       	push   $0x80571a
+  80475b:	6a 09                	push   $0x9
+  80475d:	68 1b 58 80 00       	push   $0x80581b
+  804762:	e8 5e be ff ff       	call   8005c5 <_panic>
+
+00804767 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  804767:	55                   	push   %ebp
+  804768:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80476a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80476d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804773:	5d                   	pop    %ebp
+  804774:	c3                   	ret
+
+00804775 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  804775:	55                   	push   %ebp
+  804776:	89 e5                	mov    %esp,%ebp
+  804778:	53                   	push   %ebx
+  804779:	83 ec 04             	sub    $0x4,%esp
+  80477c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  80477f:	8b 03                	mov    (%ebx),%eax
+  804781:	85 c0                	test   %eax,%eax
+  804783:	75 05                	jne    80478a <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  804785:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804788:	c9                   	leave
+  804789:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80478a:	83 ec 08             	sub    $0x8,%esp
+  80478d:	50                   	push   %eax
+  80478e:	8d 43 04             	lea    0x4(%ebx),%eax
+  804791:	50                   	push   %eax
+  804792:	e8 09 cd ff ff       	call   8014a0 <sys_page_batch>
+	pb->pb_n = 0;
+  804797:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80479d:	83 c4 10             	add    $0x10,%esp
+  8047a0:	eb e3                	jmp    804785 <pgbatch_flush+0x10>
+
+008047a2 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  8047a2:	55                   	push   %ebp
+  8047a3:	89 e5                	mov    %esp,%ebp
+  8047a5:	56                   	push   %esi
+  8047a6:	53                   	push   %ebx
+  8047a7:	89 c3                	mov    %eax,%ebx
+  8047a9:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8047ab:	83 38 20             	cmpl   $0x20,(%eax)
+  8047ae:	74 2c                	je     8047dc <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8047b0:	8b 03                	mov    (%ebx),%eax
+  8047b2:	8d 50 01             	lea    0x1(%eax),%edx
+  8047b5:	89 13                	mov    %edx,(%ebx)
+  8047b7:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8047ba:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8047be:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8047c0:	83 ec 04             	sub    $0x4,%esp
+  8047c3:	6a 18                	push   $0x18
+  8047c5:	6a 00                	push   $0x0
+  8047c7:	50                   	push   %eax
+  8047c8:	e8 45 c7 ff ff       	call   800f12 <memset>
+	return 0;
+  8047cd:	83 c4 10             	add    $0x10,%esp
+  8047d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8047d8:	5b                   	pop    %ebx
+  8047d9:	5e                   	pop    %esi
+  8047da:	5d                   	pop    %ebp
+  8047db:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8047dc:	83 ec 0c             	sub    $0xc,%esp
+  8047df:	50                   	push   %eax
+  8047e0:	e8 90 ff ff ff       	call   804775 <pgbatch_flush>
+  8047e5:	83 c4 10             	add    $0x10,%esp
+  8047e8:	85 c0                	test   %eax,%eax
+  8047ea:	79 c4                	jns    8047b0 <pgbatch_slot+0xe>
+  8047ec:	eb e7                	jmp    8047d5 <pgbatch_slot+0x33>
+
+008047ee <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8047ee:	55                   	push   %ebp
+  8047ef:	89 e5                	mov    %esp,%ebp
+  8047f1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8047f4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8047f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8047fa:	e8 a3 ff ff ff       	call   8047a2 <pgbatch_slot>
+  8047ff:	85 c0                	test   %eax,%eax
+  804801:	78 20                	js     804823 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  804803:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804806:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  80480c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80480f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  804812:	8b 55 10             	mov    0x10(%ebp),%edx
+  804815:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804818:	8b 55 14             	mov    0x14(%ebp),%edx
+  80481b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80481e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804823:	c9                   	leave
+  804824:	c3                   	ret
+
+00804825 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  804825:	55                   	push   %ebp
+  804826:	89 e5                	mov    %esp,%ebp
+  804828:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80482b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80482e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804831:	e8 6c ff ff ff       	call   8047a2 <pgbatch_slot>
+  804836:	85 c0                	test   %eax,%eax
+  804838:	78 2c                	js     804866 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  80483a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80483d:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  804843:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804846:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  804849:	8b 55 10             	mov    0x10(%ebp),%edx
+  80484c:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  80484f:	8b 55 14             	mov    0x14(%ebp),%edx
+  804852:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  804855:	8b 55 18             	mov    0x18(%ebp),%edx
+  804858:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80485b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80485e:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804861:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804866:	c9                   	leave
+  804867:	c3                   	ret
+
+00804868 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  804868:	55                   	push   %ebp
+  804869:	89 e5                	mov    %esp,%ebp
+  80486b:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80486e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804871:	8b 45 08             	mov    0x8(%ebp),%eax
+  804874:	e8 29 ff ff ff       	call   8047a2 <pgbatch_slot>
+  804879:	85 c0                	test   %eax,%eax
+  80487b:	78 1a                	js     804897 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80487d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804880:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  804886:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804889:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80488c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80488f:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  804892:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804897:	c9                   	leave
+  804898:	c3                   	ret
+
+00804899 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  804899:	55                   	push   %ebp
+  80489a:	89 e5                	mov    %esp,%ebp
+  80489c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80489f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8048a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048a5:	e8 f8 fe ff ff       	call   8047a2 <pgbatch_slot>
+  8048aa:	85 c0                	test   %eax,%eax
+  8048ac:	78 20                	js     8048ce <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8048ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048b1:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8048b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048ba:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8048bd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8048c0:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8048c3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8048c6:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8048c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048ce:	c9                   	leave
+  8048cf:	c3                   	ret
+
+008048d0 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8048d0:	55                   	push   %ebp
+  8048d1:	89 e5                	mov    %esp,%ebp
+  8048d3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8048d6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8048d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048dc:	e8 c1 fe ff ff       	call   8047a2 <pgbatch_slot>
+  8048e1:	85 c0                	test   %eax,%eax
+  8048e3:	78 26                	js     80490b <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8048e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8048e8:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8048ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8048f1:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8048f4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8048f7:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8048fa:	8b 55 14             	mov    0x14(%ebp),%edx
+  8048fd:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  804900:	8b 55 18             	mov    0x18(%ebp),%edx
+  804903:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804906:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80490b:	c9                   	leave
+  80490c:	c3                   	ret
+
+0080490d <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  80490d:	55                   	push   %ebp
+  80490e:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  804910:	8b 45 08             	mov    0x8(%ebp),%eax
+  804913:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804919:	5d                   	pop    %ebp
+  80491a:	c3                   	ret
+
+0080491b <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  80491b:	55                   	push   %ebp
+  80491c:	89 e5                	mov    %esp,%ebp
+  80491e:	56                   	push   %esi
+  80491f:	53                   	push   %ebx
+  804920:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804923:	b8 00 00 00 00       	mov    $0x0,%eax
+  804928:	ba 01 00 00 00       	mov    $0x1,%edx
+  80492d:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  804931:	85 c0                	test   %eax,%eax
+  804933:	74 2f                	je     804964 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  804935:	83 f8 02             	cmp    $0x2,%eax
+  804938:	74 0c                	je     804946 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  80493a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80493f:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  804942:	85 c0                	test   %eax,%eax
+  804944:	74 1e                	je     804964 <mutex_lock+0x49>
+  804946:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  80494b:	83 ec 04             	sub    $0x4,%esp
+  80494e:	6a ff                	push   $0xffffffff
+  804950:	6a 02                	push   $0x2
+  804952:	53                   	push   %ebx
+  804953:	e8 71 cc ff ff       	call   8015c9 <sys_futex_wait>
+  804958:	89 f0                	mov    %esi,%eax
+  80495a:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80495d:	83 c4 10             	add    $0x10,%esp
+  804960:	85 c0                	test   %eax,%eax
+  804962:	75 e7                	jne    80494b <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804964:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804967:	5b                   	pop    %ebx
+  804968:	5e                   	pop    %esi
+  804969:	5d                   	pop    %ebp
+  80496a:	c3                   	ret
+
+0080496b <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  80496b:	55                   	push   %ebp
+  80496c:	89 e5                	mov    %esp,%ebp
+  80496e:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804971:	b8 00 00 00 00       	mov    $0x0,%eax
+  804976:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80497b:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  80497f:	85 c0                	test   %eax,%eax
+  804981:	0f 94 c0             	sete   %al
+  804984:	0f b6 c0             	movzbl %al,%eax
+}
+  804987:	5d                   	pop    %ebp
+  804988:	c3                   	ret
+
+00804989 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  804989:	55                   	push   %ebp
+  80498a:	89 e5                	mov    %esp,%ebp
+  80498c:	83 ec 08             	sub    $0x8,%esp
+  80498f:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  804992:	b8 00 00 00 00       	mov    $0x0,%eax
+  804997:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80499a:	83 f8 02             	cmp    $0x2,%eax
+  80499d:	74 02                	je     8049a1 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  80499f:	c9                   	leave
+  8049a0:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  8049a1:	83 ec 08             	sub    $0x8,%esp
+  8049a4:	6a 01                	push   $0x1
+  8049a6:	52                   	push   %edx
+  8049a7:	e8 3f cc ff ff       	call   8015eb <sys_futex_wake>
+  8049ac:	83 c4 10             	add    $0x10,%esp
+}
+  8049af:	eb ee                	jmp    80499f <mutex_unlock+0x16>
+
+008049b1 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  8049b1:	55                   	push   %ebp
+  8049b2:	89 e5                	mov    %esp,%ebp
+  8049b4:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  8049b7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  8049bd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  8049c4:	5d                   	pop    %ebp
+  8049c5:	c3                   	ret
+
+008049c6 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  8049c6:	55                   	push   %ebp
+  8049c7:	89 e5                	mov    %esp,%ebp
+  8049c9:	57                   	push   %edi
+  8049ca:	56                   	push   %esi
+  8049cb:	53                   	push   %ebx
+  8049cc:	83 ec 18             	sub    $0x18,%esp
+  8049cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8049d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  8049d5:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  8049d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049dc:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  8049e1:	57                   	push   %edi
+  8049e2:	e8 a2 ff ff ff       	call   804989 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  8049e7:	83 c4 0c             	add    $0xc,%esp
+  8049ea:	ff 75 10             	push   0x10(%ebp)
+  8049ed:	56                   	push   %esi
+  8049ee:	53                   	push   %ebx
+  8049ef:	e8 d5 cb ff ff       	call   8015c9 <sys_futex_wait>
+  8049f4:	89 c6                	mov    %eax,%esi
+  8049f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8049fb:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  804a00:	89 3c 24             	mov    %edi,(%esp)
+  804a03:	e8 13 ff ff ff       	call   80491b <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  804a08:	83 c4 10             	add    $0x10,%esp
+  804a0b:	83 fe ef             	cmp    $0xffffffef,%esi
+  804a0e:	74 05                	je     804a15 <cond_timedwait+0x4f>
+  804a10:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804a15:	89 f0                	mov    %esi,%eax
+  804a17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a1a:	5b                   	pop    %ebx
+  804a1b:	5e                   	pop    %esi
+  804a1c:	5f                   	pop    %edi
+  804a1d:	5d                   	pop    %ebp
+  804a1e:	c3                   	ret
+
+00804a1f <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  804a1f:	55                   	push   %ebp
+  804a20:	89 e5                	mov    %esp,%ebp
+  804a22:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  804a25:	6a ff                	push   $0xffffffff
+  804a27:	ff 75 0c             	push   0xc(%ebp)
+  804a2a:	ff 75 08             	push   0x8(%ebp)
+  804a2d:	e8 94 ff ff ff       	call   8049c6 <cond_timedwait>
+}
+  804a32:	83 c4 10             	add    $0x10,%esp
+  804a35:	c9                   	leave
+  804a36:	c3                   	ret
+
+00804a37 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  804a37:	55                   	push   %ebp
+  804a38:	89 e5                	mov    %esp,%ebp
+  804a3a:	83 ec 08             	sub    $0x8,%esp
+  804a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a40:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a45:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804a49:	8b 50 04             	mov    0x4(%eax),%edx
+  804a4c:	85 d2                	test   %edx,%edx
+  804a4e:	75 02                	jne    804a52 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804a50:	c9                   	leave
+  804a51:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804a52:	83 ec 08             	sub    $0x8,%esp
+  804a55:	6a 01                	push   $0x1
+  804a57:	50                   	push   %eax
+  804a58:	e8 8e cb ff ff       	call   8015eb <sys_futex_wake>
+  804a5d:	83 c4 10             	add    $0x10,%esp
+}
+  804a60:	eb ee                	jmp    804a50 <cond_signal+0x19>
+
+00804a62 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804a62:	55                   	push   %ebp
+  804a63:	89 e5                	mov    %esp,%ebp
+  804a65:	83 ec 08             	sub    $0x8,%esp
+  804a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  804a6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a70:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804a74:	8b 50 04             	mov    0x4(%eax),%edx
+  804a77:	85 d2                	test   %edx,%edx
+  804a79:	75 02                	jne    804a7d <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  804a7b:	c9                   	leave
+  804a7c:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  804a7d:	83 ec 08             	sub    $0x8,%esp
+  804a80:	68 00 04 00 00       	push   $0x400
+  804a85:	50                   	push   %eax
+  804a86:	e8 60 cb ff ff       	call   8015eb <sys_futex_wake>
+  804a8b:	83 c4 10             	add    $0x10,%esp
+}
+  804a8e:	eb eb                	jmp    804a7b <cond_broadcast+0x19>
+
+00804a90 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804a90:	55                   	push   %ebp
+  804a91:	89 e5                	mov    %esp,%ebp
+  804a93:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  804a96:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  804a9d:	74 0a                	je     804aa9 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804aa2:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  804aa7:	c9                   	leave
+  804aa8:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804aa9:	83 ec 04             	sub    $0x4,%esp
+  804aac:	6a 07                	push   $0x7
+  804aae:	68 00 f0 bf ee       	push   $0xeebff000
+  804ab3:	6a 00                	push   $0x0
+  804ab5:	e8 11 c7 ff ff       	call   8011cb <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804aba:	83 c4 08             	add    $0x8,%esp
+  804abd:	68 ce 4a 80 00       	push   $0x804ace
+  804ac2:	6a 00                	push   $0x0
+  804ac4:	e8 4d c8 ff ff       	call   801316 <sys_env_set_pgfault_upcall>
+  804ac9:	83 c4 10             	add    $0x10,%esp
+  804acc:	eb d1                	jmp    804a9f <set_pgfault_handler+0xf>
+
+00804ace <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804ace:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804acf:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  804ad4:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804ad6:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804ad9:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804add:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804ae0:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  804ae4:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  804ae6:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804aea:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804aed:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804aee:	83 c4 04             	add    $0x4,%esp
+	popf
+  804af1:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  804af2:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  804af3:	c3                   	ret
+
+00804af4 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804af4:	55                   	push   %ebp
+  804af5:	89 e5                	mov    %esp,%ebp
+  804af7:	56                   	push   %esi
+  804af8:	53                   	push   %ebx
+  804af9:	8b 75 08             	mov    0x8(%ebp),%esi
+  804afc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804aff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  804b02:	85 c0                	test   %eax,%eax
+  804b04:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804b09:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  804b0c:	83 ec 0c             	sub    $0xc,%esp
+  804b0f:	50                   	push   %eax
+  804b10:	e8 66 c8 ff ff       	call   80137b <sys_ipc_recv>
+  804b15:	83 c4 10             	add    $0x10,%esp
+  804b18:	85 c0                	test   %eax,%eax
+  804b1a:	0f 88 8b 00 00 00    	js     804bab <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  804b20:	85 f6                	test   %esi,%esi
+  804b22:	74 2a                	je     804b4e <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804b24:	89 e2                	mov    %esp,%edx
+  804b26:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b2b:	29 d0                	sub    %edx,%eax
+  804b2d:	89 c2                	mov    %eax,%edx
+  804b2f:	c1 ea 0f             	shr    $0xf,%edx
+  804b32:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804b3f:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804b46:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804b4c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804b4e:	85 db                	test   %ebx,%ebx
+  804b50:	74 2a                	je     804b7c <ipc_recv+0x88>
+  804b52:	89 e2                	mov    %esp,%edx
+  804b54:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b59:	29 d0                	sub    %edx,%eax
+  804b5b:	89 c2                	mov    %eax,%edx
+  804b5d:	c1 ea 0f             	shr    $0xf,%edx
+  804b60:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b6a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804b6d:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804b74:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b7a:	89 03                	mov    %eax,(%ebx)
+  804b7c:	89 e2                	mov    %esp,%edx
+  804b7e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804b83:	29 d0                	sub    %edx,%eax
+  804b85:	89 c2                	mov    %eax,%edx
+  804b87:	c1 ea 0f             	shr    $0xf,%edx
+  804b8a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b94:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804b97:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804b9e:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804ba4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804ba7:	5b                   	pop    %ebx
+  804ba8:	5e                   	pop    %esi
+  804ba9:	5d                   	pop    %ebp
+  804baa:	c3                   	ret
+		if(from_env_store != NULL)
+  804bab:	85 f6                	test   %esi,%esi
+  804bad:	74 06                	je     804bb5 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804baf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804bb5:	85 db                	test   %ebx,%ebx
+  804bb7:	74 eb                	je     804ba4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  804bb9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804bbf:	eb e3                	jmp    804ba4 <ipc_recv+0xb0>
+
+00804bc1 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804bc1:	55                   	push   %ebp
+  804bc2:	89 e5                	mov    %esp,%ebp
+  804bc4:	57                   	push   %edi
+  804bc5:	56                   	push   %esi
+  804bc6:	53                   	push   %ebx
+  804bc7:	83 ec 14             	sub    $0x14,%esp
+  804bca:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804bcd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804bd0:	8b 75 14             	mov    0x14(%ebp),%esi
+  804bd3:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  804bd6:	85 c0                	test   %eax,%eax
+  804bd8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  804bdd:	0f 44 c2             	cmove  %edx,%eax
+  804be0:	ff 75 10             	push   0x10(%ebp)
+  804be3:	50                   	push   %eax
+  804be4:	e8 f4 c7 ff ff       	call   8013dd <sys_ipc_recv_pages>
+  804be9:	83 c4 10             	add    $0x10,%esp
+  804bec:	85 c0                	test   %eax,%eax
+  804bee:	0f 88 ba 00 00 00    	js     804cae <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  804bf4:	85 ff                	test   %edi,%edi
+  804bf6:	74 2a                	je     804c22 <ipc_recv_pages+0x61>
+  804bf8:	89 e2                	mov    %esp,%edx
+  804bfa:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804bff:	29 d0                	sub    %edx,%eax
+  804c01:	89 c2                	mov    %eax,%edx
+  804c03:	c1 ea 0f             	shr    $0xf,%edx
+  804c06:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c10:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804c13:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804c1a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804c20:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  804c22:	85 f6                	test   %esi,%esi
+  804c24:	74 2a                	je     804c50 <ipc_recv_pages+0x8f>
+  804c26:	89 e2                	mov    %esp,%edx
+  804c28:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c2d:	29 d0                	sub    %edx,%eax
+  804c2f:	89 c2                	mov    %eax,%edx
+  804c31:	c1 ea 0f             	shr    $0xf,%edx
+  804c34:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c39:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804c41:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804c48:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804c4e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804c50:	85 db                	test   %ebx,%ebx
+  804c52:	74 2a                	je     804c7e <ipc_recv_pages+0xbd>
+  804c54:	89 e2                	mov    %esp,%edx
+  804c56:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c5b:	29 d0                	sub    %edx,%eax
+  804c5d:	89 c2                	mov    %eax,%edx
+  804c5f:	c1 ea 0f             	shr    $0xf,%edx
+  804c62:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c6c:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804c6f:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804c76:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804c7c:	89 03                	mov    %eax,(%ebx)
+  804c7e:	89 e2                	mov    %esp,%edx
+  804c80:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804c85:	29 d0                	sub    %edx,%eax
+  804c87:	89 c2                	mov    %eax,%edx
+  804c89:	c1 ea 0f             	shr    $0xf,%edx
+  804c8c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804c91:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c96:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  804c99:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804ca0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  804ca6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ca9:	5b                   	pop    %ebx
+  804caa:	5e                   	pop    %esi
+  804cab:	5f                   	pop    %edi
+  804cac:	5d                   	pop    %ebp
+  804cad:	c3                   	ret
+		if (from_env_store)
+  804cae:	85 ff                	test   %edi,%edi
+  804cb0:	74 06                	je     804cb8 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804cb2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  804cb8:	85 f6                	test   %esi,%esi
+  804cba:	74 06                	je     804cc2 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804cbc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804cc2:	85 db                	test   %ebx,%ebx
+  804cc4:	74 e0                	je     804ca6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  804cc6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804ccc:	eb d8                	jmp    804ca6 <ipc_recv_pages+0xe5>
+
+00804cce <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804cce:	55                   	push   %ebp
+  804ccf:	89 e5                	mov    %esp,%ebp
+  804cd1:	57                   	push   %edi
+  804cd2:	56                   	push   %esi
+  804cd3:	53                   	push   %ebx
+  804cd4:	83 ec 1c             	sub    $0x1c,%esp
+  804cd7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  804cda:	8b 75 08             	mov    0x8(%ebp),%esi
+  804cdd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804ce3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804ce7:	75 2b                	jne    804d14 <ipc_try_send_pages+0x46>
+  804ce9:	89 e2                	mov    %esp,%edx
+  804ceb:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804cf0:	29 d0                	sub    %edx,%eax
+  804cf2:	89 c2                	mov    %eax,%edx
+  804cf4:	c1 ea 0f             	shr    $0xf,%edx
+  804cf7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d01:	0f 42 c2             	cmovb  %edx,%eax
+  804d04:	8b 04 85 60 80 80 00 	mov    0x808060(,%eax,4),%eax
+  804d0b:	8b 70 48             	mov    0x48(%eax),%esi
+  804d0e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  804d14:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  804d1a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  804d1f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804d22:	85 ff                	test   %edi,%edi
+  804d24:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  804d29:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  804d2c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  804d32:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  804d38:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804d3e:	83 ec 0c             	sub    $0xc,%esp
+  804d41:	ff 75 14             	push   0x14(%ebp)
+  804d44:	ff 75 18             	push   0x18(%ebp)
+  804d47:	57                   	push   %edi
+  804d48:	ff 75 0c             	push   0xc(%ebp)
+  804d4b:	ff 75 08             	push   0x8(%ebp)
+  804d4e:	e8 69 c6 ff ff       	call   8013bc <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804d53:	83 c4 20             	add    $0x20,%esp
+  804d56:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804d59:	75 21                	jne    804d7c <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  804d5b:	83 ec 04             	sub    $0x4,%esp
+  804d5e:	6a ff                	push   $0xffffffff
+  804d60:	53                   	push   %ebx
+  804d61:	ff 75 e4             	push   -0x1c(%ebp)
+  804d64:	e8 60 c8 ff ff       	call   8015c9 <sys_futex_wait>
+  804d69:	83 c4 10             	add    $0x10,%esp
+  804d6c:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804d6f:	74 c7                	je     804d38 <ipc_try_send_pages+0x6a>
+  804d71:	85 c0                	test   %eax,%eax
+  804d73:	79 c3                	jns    804d38 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804d75:	e8 32 c4 ff ff       	call   8011ac <sys_yield>
+  804d7a:	eb bc                	jmp    804d38 <ipc_try_send_pages+0x6a>
+	}
+}
+  804d7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d7f:	5b                   	pop    %ebx
+  804d80:	5e                   	pop    %esi
+  804d81:	5f                   	pop    %edi
+  804d82:	5d                   	pop    %ebp
+  804d83:	c3                   	ret
+
+00804d84 <ipc_send>:
+{
+  804d84:	55                   	push   %ebp
+  804d85:	89 e5                	mov    %esp,%ebp
+  804d87:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  804d8a:	ff 75 14             	push   0x14(%ebp)
+  804d8d:	6a 01                	push   $0x1
+  804d8f:	ff 75 10             	push   0x10(%ebp)
+  804d92:	ff 75 0c             	push   0xc(%ebp)
+  804d95:	ff 75 08             	push   0x8(%ebp)
+  804d98:	e8 31 ff ff ff       	call   804cce <ipc_try_send_pages>
+  804d9d:	83 c4 20             	add    $0x20,%esp
+  804da0:	85 c0                	test   %eax,%eax
+  804da2:	78 02                	js     804da6 <ipc_send+0x22>
+}
+  804da4:	c9                   	leave
+  804da5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  804da6:	50                   	push   %eax
+  804da7:	68 26 58 80 00       	push   $0x805826
+  804dac:	6a 3f                	push   $0x3f
+  804dae:	68 3b 58 80 00       	push   $0x80583b
+  804db3:	e8 0d b8 ff ff       	call   8005c5 <_panic>
+
+00804db8 <ipc_send_pages>:
+{
+  804db8:	55                   	push   %ebp
+  804db9:	89 e5                	mov    %esp,%ebp
+  804dbb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804dbe:	ff 75 18             	push   0x18(%ebp)
+  804dc1:	ff 75 14             	push   0x14(%ebp)
+  804dc4:	ff 75 10             	push   0x10(%ebp)
+  804dc7:	ff 75 0c             	push   0xc(%ebp)
+  804dca:	ff 75 08             	push   0x8(%ebp)
+  804dcd:	e8 fc fe ff ff       	call   804cce <ipc_try_send_pages>
+  804dd2:	83 c4 20             	add    $0x20,%esp
+  804dd5:	85 c0                	test   %eax,%eax
+  804dd7:	78 02                	js     804ddb <ipc_send_pages+0x23>
+}
+  804dd9:	c9                   	leave
+  804dda:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  804ddb:	50                   	push   %eax
+  804ddc:	68 45 58 80 00       	push   $0x805845
+  804de1:	6a 64                	push   $0x64
+  804de3:	68 3b 58 80 00       	push   $0x80583b
+  804de8:	e8 d8 b7 ff ff       	call   8005c5 <_panic>
+
+00804ded <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804ded:	55                   	push   %ebp
+  804dee:	89 e5                	mov    %esp,%ebp
+  804df0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804df3:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  804df8:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  804dfe:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  804e04:	8b 52 50             	mov    0x50(%edx),%edx
+  804e07:	39 ca                	cmp    %ecx,%edx
+  804e09:	74 11                	je     804e1c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804e0b:	83 c0 01             	add    $0x1,%eax
+  804e0e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804e13:	75 e3                	jne    804df8 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804e15:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e1a:	eb 0e                	jmp    804e2a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804e1c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  804e22:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804e27:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804e2a:	5d                   	pop    %ebp
+  804e2b:	c3                   	ret
+
+00804e2c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804e2c:	55                   	push   %ebp
+  804e2d:	89 e5                	mov    %esp,%ebp
+  804e2f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804e32:	89 c2                	mov    %eax,%edx
+  804e34:	c1 ea 16             	shr    $0x16,%edx
+  804e37:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804e43:	f6 c1 01             	test   $0x1,%cl
+  804e46:	74 1e                	je     804e66 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804e48:	c1 e8 0c             	shr    $0xc,%eax
+  804e4b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804e52:	a8 01                	test   $0x1,%al
+  804e54:	74 10                	je     804e66 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804e56:	c1 e8 0c             	shr    $0xc,%eax
+  804e59:	c1 e0 04             	shl    $0x4,%eax
+  804e5c:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804e63:	0f b7 d2             	movzwl %dx,%edx
+}
+  804e66:	89 d0                	mov    %edx,%eax
+  804e68:	5d                   	pop    %ebp
+  804e69:	c3                   	ret
+
+00804e6a <__udivdi3>:
+  804e6a:	57                   	push   %edi
+  804e6b:	56                   	push   %esi
+  804e6c:	53                   	push   %ebx
+  804e6d:	83 ec 20             	sub    $0x20,%esp
+  804e70:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804e74:	8b 54 24 34          	mov    0x34(%esp),%edx
+  804e78:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804e7c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804e80:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804e84:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804e88:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804e8c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804e90:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804e95:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e9f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804ea6:	00 
+  804ea7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804eae:	00 
+  804eaf:	eb 08                	jmp    804eb9 <__udivdi3+0x4f>
+  804eb1:	83 e9 01             	sub    $0x1,%ecx
+  804eb4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804eb7:	74 68                	je     804f21 <__udivdi3+0xb7>
+  804eb9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804ebd:	01 c0                	add    %eax,%eax
+  804ebf:	89 c6                	mov    %eax,%esi
+  804ec1:	89 d7                	mov    %edx,%edi
+  804ec3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804ec7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804ecb:	0f ad d0             	shrd   %cl,%edx,%eax
+  804ece:	d3 ea                	shr    %cl,%edx
+  804ed0:	f6 c1 20             	test   $0x20,%cl
+  804ed3:	74 04                	je     804ed9 <__udivdi3+0x6f>
+  804ed5:	89 d0                	mov    %edx,%eax
+  804ed7:	31 d2                	xor    %edx,%edx
+  804ed9:	83 e0 01             	and    $0x1,%eax
+  804edc:	89 04 24             	mov    %eax,(%esp)
+  804edf:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804ee6:	00 
+  804ee7:	8b 04 24             	mov    (%esp),%eax
+  804eea:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804eee:	09 f0                	or     %esi,%eax
+  804ef0:	09 fa                	or     %edi,%edx
+  804ef2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804ef6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804efa:	39 f0                	cmp    %esi,%eax
+  804efc:	89 d3                	mov    %edx,%ebx
+  804efe:	19 fb                	sbb    %edi,%ebx
+  804f00:	72 af                	jb     804eb1 <__udivdi3+0x47>
+  804f02:	29 f0                	sub    %esi,%eax
+  804f04:	19 fa                	sbb    %edi,%edx
+  804f06:	89 cf                	mov    %ecx,%edi
+  804f08:	c1 ef 05             	shr    $0x5,%edi
+  804f0b:	83 e7 01             	and    $0x1,%edi
+  804f0e:	89 fe                	mov    %edi,%esi
+  804f10:	83 f6 01             	xor    $0x1,%esi
+  804f13:	d3 e6                	shl    %cl,%esi
+  804f15:	d3 e7                	shl    %cl,%edi
+  804f17:	09 74 24 18          	or     %esi,0x18(%esp)
+  804f1b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804f1f:	eb 90                	jmp    804eb1 <__udivdi3+0x47>
+  804f21:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804f25:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804f29:	83 c4 20             	add    $0x20,%esp
+  804f2c:	5b                   	pop    %ebx
+  804f2d:	5e                   	pop    %esi
+  804f2e:	5f                   	pop    %edi
+  804f2f:	c3                   	ret
+
+00804f30 <__umoddi3>:
+  804f30:	57                   	push   %edi
+  804f31:	56                   	push   %esi
+  804f32:	53                   	push   %ebx
+  804f33:	83 ec 08             	sub    $0x8,%esp
+  804f36:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804f3a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804f3e:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804f42:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804f46:	57                   	push   %edi
+  804f47:	56                   	push   %esi
+  804f48:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804f4c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804f50:	52                   	push   %edx
+  804f51:	50                   	push   %eax
+  804f52:	e8 13 ff ff ff       	call   804e6a <__udivdi3>
+  804f57:	89 c3                	mov    %eax,%ebx
+  804f59:	0f af d6             	imul   %esi,%edx
+  804f5c:	89 f9                	mov    %edi,%ecx
+  804f5e:	0f af cb             	imul   %ebx,%ecx
+  804f61:	01 d1                	add    %edx,%ecx
+  804f63:	89 d8                	mov    %ebx,%eax
+  804f65:	f7 e6                	mul    %esi
+  804f67:	89 c6                	mov    %eax,%esi
+  804f69:	89 d7                	mov    %edx,%edi
+  804f6b:	01 cf                	add    %ecx,%edi
+  804f6d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804f71:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804f75:	29 f0                	sub    %esi,%eax
+  804f77:	19 fa                	sbb    %edi,%edx
+  804f79:	83 c4 18             	add    $0x18,%esp
+  804f7c:	5b                   	pop    %ebx
+  804f7d:	5e                   	pop    %esi
+  804f7e:	5f                   	pop    %edi
+  804f7f:	c3                   	ret
+
+00804f80 <__divdi3>:
+  804f80:	53                   	push   %ebx
+  804f81:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804f85:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804f89:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804f8d:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804f91:	85 d2                	test   %edx,%edx
+  804f93:	78 12                	js     804fa7 <__divdi3+0x27>
+  804f95:	85 db                	test   %ebx,%ebx
+  804f97:	78 2e                	js     804fc7 <__divdi3+0x47>
+  804f99:	53                   	push   %ebx
+  804f9a:	51                   	push   %ecx
+  804f9b:	52                   	push   %edx
+  804f9c:	50                   	push   %eax
+  804f9d:	e8 c8 fe ff ff       	call   804e6a <__udivdi3>
+  804fa2:	83 c4 10             	add    $0x10,%esp
+  804fa5:	eb 1e                	jmp    804fc5 <__divdi3+0x45>
+  804fa7:	f7 d8                	neg    %eax
+  804fa9:	83 d2 00             	adc    $0x0,%edx
+  804fac:	f7 da                	neg    %edx
+  804fae:	85 db                	test   %ebx,%ebx
+  804fb0:	78 2a                	js     804fdc <__divdi3+0x5c>
+  804fb2:	53                   	push   %ebx
+  804fb3:	51                   	push   %ecx
+  804fb4:	52                   	push   %edx
+  804fb5:	50                   	push   %eax
+  804fb6:	e8 af fe ff ff       	call   804e6a <__udivdi3>
+  804fbb:	83 c4 10             	add    $0x10,%esp
+  804fbe:	f7 d8                	neg    %eax
+  804fc0:	83 d2 00             	adc    $0x0,%edx
+  804fc3:	f7 da                	neg    %edx
+  804fc5:	5b                   	pop    %ebx
+  804fc6:	c3                   	ret
+  804fc7:	f7 d9                	neg    %ecx
+  804fc9:	83 d3 00             	adc    $0x0,%ebx
+  804fcc:	f7 db                	neg    %ebx
+  804fce:	53                   	push   %ebx
+  804fcf:	51                   	push   %ecx
+  804fd0:	52                   	push   %edx
+  804fd1:	50                   	push   %eax
+  804fd2:	e8 93 fe ff ff       	call   804e6a <__udivdi3>
+  804fd7:	83 c4 10             	add    $0x10,%esp
+  804fda:	eb e2                	jmp    804fbe <__divdi3+0x3e>
+  804fdc:	f7 d9                	neg    %ecx
+  804fde:	83 d3 00             	adc    $0x0,%ebx
+  804fe1:	f7 db                	neg    %ebx
+  804fe3:	53                   	push   %ebx
+  804fe4:	51                   	push   %ecx
+  804fe5:	52                   	push   %edx
+  804fe6:	50                   	push   %eax
+  804fe7:	e8 7e fe ff ff       	call   804e6a <__udivdi3>
+  804fec:	83 c4 10             	add    $0x10,%esp
+  804fef:	eb d4                	jmp    804fc5 <__divdi3+0x45>
+
+00804ff1 <__moddi3>:
+  804ff1:	57                   	push   %edi
+  804ff2:	56                   	push   %esi
+  804ff3:	53                   	push   %ebx
+  804ff4:	83 ec 08             	sub    $0x8,%esp
+  804ff7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804ffb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804fff:	8b 74 24 20          	mov    0x20(%esp),%esi
+  805003:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  805007:	57                   	push   %edi
+  805008:	56                   	push   %esi
+  805009:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80500d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805011:	52                   	push   %edx
+  805012:	50                   	push   %eax
+  805013:	e8 68 ff ff ff       	call   804f80 <__divdi3>
+  805018:	89 c3                	mov    %eax,%ebx
+  80501a:	0f af d6             	imul   %esi,%edx
+  80501d:	89 f9                	mov    %edi,%ecx
+  80501f:	0f af cb             	imul   %ebx,%ecx
+  805022:	01 d1                	add    %edx,%ecx
+  805024:	89 d8                	mov    %ebx,%eax
+  805026:	f7 e6                	mul    %esi
+  805028:	89 c6                	mov    %eax,%esi
+  80502a:	89 d7                	mov    %edx,%edi
+  80502c:	01 cf                	add    %ecx,%edi
+  80502e:	8b 44 24 10          	mov    0x10(%esp),%eax
+  805032:	8b 54 24 14          	mov    0x14(%esp),%edx
+  805036:	29 f0                	sub    %esi,%eax
+  805038:	19 fa                	sbb    %edi,%edx
+  80503a:	83 c4 18             	add    $0x18,%esp
+  80503d:	5b                   	pop    %ebx
+  80503e:	5e                   	pop    %esi
+  80503f:	5f                   	pop    %edi
+  805040:	c3                   	ret
@@ -0,0 +1,9404 @@
+
+obj/user/testsync.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 67 04 00 00       	call   800498 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+	cprintf("testsync: ipc OK\n");
+}
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 30             	sub    $0x30,%esp
+	int r;
+
+	binaryname = "testsync";
+  80003e:	c7 05 00 50 80 00 a0 	movl   $0x8048a0,0x805000
+  800045:	48 80 00 
+	if ((r = sys_page_alloc(0, SHARED, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800048:	68 07 04 00 00       	push   $0x407
+  80004d:	68 00 00 00 50       	push   $0x50000000
+  800052:	6a 00                	push   $0x0
+  800054:	e8 ec 10 00 00       	call   801145 <sys_page_alloc>
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	85 c0                	test   %eax,%eax
+  80005e:	78 0b                	js     80006b <umain+0x36>
+  800060:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  800063:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  800066:	e9 80 00 00 00       	jmp    8000eb <umain+0xb6>
+		panic("sys_page_alloc: %e", r);
+  80006b:	50                   	push   %eax
+  80006c:	68 a9 48 80 00       	push   $0x8048a9
+  800071:	68 94 00 00 00       	push   $0x94
+  800076:	68 bc 48 80 00       	push   $0x8048bc
+  80007b:	e8 bf 04 00 00       	call   80053f <_panic>
+			panic("fork: %e", kids[i]);
+  800080:	53                   	push   %ebx
+  800081:	68 ca 4d 80 00       	push   $0x804dca
+  800086:	6a 22                	push   $0x22
+  800088:	68 bc 48 80 00       	push   $0x8048bc
+  80008d:	e8 ad 04 00 00       	call   80053f <_panic>
+					sys_yield();
+  800092:	e8 8f 10 00 00       	call   801126 <sys_yield>
+				SHARED->counter = x + 1;
+  800097:	83 c6 01             	add    $0x1,%esi
+  80009a:	89 35 04 00 00 50    	mov    %esi,0x50000004
+				mutex_unlock(&SHARED->lock);
+  8000a0:	83 ec 0c             	sub    $0xc,%esp
+  8000a3:	68 00 00 00 50       	push   $0x50000000
+  8000a8:	e8 8e 42 00 00       	call   80433b <mutex_unlock>
+			for (j = 0; j < NLOCK; j++) {
+  8000ad:	83 c3 01             	add    $0x1,%ebx
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  8000b9:	74 1d                	je     8000d8 <umain+0xa3>
+				mutex_lock(&SHARED->lock);
+  8000bb:	83 ec 0c             	sub    $0xc,%esp
+  8000be:	68 00 00 00 50       	push   $0x50000000
+  8000c3:	e8 05 42 00 00       	call   8042cd <mutex_lock>
+				x = SHARED->counter;
+  8000c8:	8b 35 04 00 00 50    	mov    0x50000004,%esi
+				if (j % 64 == 0)
+  8000ce:	83 c4 10             	add    $0x10,%esp
+  8000d1:	f6 c3 3f             	test   $0x3f,%bl
+  8000d4:	75 c1                	jne    800097 <umain+0x62>
+  8000d6:	eb ba                	jmp    800092 <umain+0x5d>
+			exit();
+  8000d8:	e8 48 04 00 00       	call   800525 <exit>
+	for (i = 0; i < NCHILD; i++) {
+  8000dd:	83 45 d4 04          	addl   $0x4,-0x2c(%ebp)
+  8000e1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8000e4:	8d 4d e8             	lea    -0x18(%ebp),%ecx
+  8000e7:	39 c1                	cmp    %eax,%ecx
+  8000e9:	74 14                	je     8000ff <umain+0xca>
+		if ((kids[i] = fork()) < 0)
+  8000eb:	e8 5d 16 00 00       	call   80174d <fork>
+  8000f0:	89 c3                	mov    %eax,%ebx
+  8000f2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8000f5:	89 18                	mov    %ebx,(%eax)
+  8000f7:	85 db                	test   %ebx,%ebx
+  8000f9:	78 85                	js     800080 <umain+0x4b>
+		if (kids[i] == 0) {
+  8000fb:	75 e0                	jne    8000dd <umain+0xa8>
+  8000fd:	eb bc                	jmp    8000bb <umain+0x86>
+		wait(kids[i]);
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	ff 37                	push   (%edi)
+  800104:	e8 ae 3f 00 00       	call   8040b7 <wait>
+	for (i = 0; i < NCHILD; i++)
+  800109:	83 c7 04             	add    $0x4,%edi
+  80010c:	83 c4 10             	add    $0x10,%esp
+  80010f:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  800112:	39 c7                	cmp    %eax,%edi
+  800114:	75 e9                	jne    8000ff <umain+0xca>
+	if (SHARED->counter != NCHILD * NLOCK)
+  800116:	a1 04 00 00 50       	mov    0x50000004,%eax
+  80011b:	3d 40 1f 00 00       	cmp    $0x1f40,%eax
+  800120:	75 35                	jne    800157 <umain+0x122>
+	cprintf("testsync: mutex OK\n");
+  800122:	83 ec 0c             	sub    $0xc,%esp
+  800125:	68 e2 48 80 00       	push   $0x8048e2
+  80012a:	e8 eb 04 00 00       	call   80061a <cprintf>
+	if ((kid = fork()) < 0)
+  80012f:	e8 19 16 00 00       	call   80174d <fork>
+  800134:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800137:	83 c4 10             	add    $0x10,%esp
+  80013a:	85 c0                	test   %eax,%eax
+  80013c:	78 38                	js     800176 <umain+0x141>
+	if (kid == 0) {
+  80013e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  800142:	0f 85 ba 00 00 00    	jne    800202 <umain+0x1cd>
+		for (i = 1; i <= NITEM; i++) {
+  800148:	be 01 00 00 00       	mov    $0x1,%esi
+			while (s->qtail - s->qhead == NSLOT)
+  80014d:	bb 00 00 00 50       	mov    $0x50000000,%ebx
+  800152:	e9 87 00 00 00       	jmp    8001de <umain+0x1a9>
+		panic("counter is %d, not %d", SHARED->counter, NCHILD * NLOCK);
+  800157:	a1 04 00 00 50       	mov    0x50000004,%eax
+  80015c:	83 ec 0c             	sub    $0xc,%esp
+  80015f:	68 40 1f 00 00       	push   $0x1f40
+  800164:	50                   	push   %eax
+  800165:	68 cc 48 80 00       	push   $0x8048cc
+  80016a:	6a 33                	push   $0x33
+  80016c:	68 bc 48 80 00       	push   $0x8048bc
+  800171:	e8 c9 03 00 00       	call   80053f <_panic>
+		panic("fork: %e", kid);
+  800176:	50                   	push   %eax
+  800177:	68 ca 4d 80 00       	push   $0x804dca
+  80017c:	6a 40                	push   $0x40
+  80017e:	68 bc 48 80 00       	push   $0x8048bc
+  800183:	e8 b7 03 00 00       	call   80053f <_panic>
+				cond_wait(&s->notfull, &s->qlock);
+  800188:	83 ec 08             	sub    $0x8,%esp
+  80018b:	68 08 00 00 50       	push   $0x50000008
+  800190:	68 0c 00 00 50       	push   $0x5000000c
+  800195:	e8 37 42 00 00       	call   8043d1 <cond_wait>
+			while (s->qtail - s->qhead == NSLOT)
+  80019a:	8b 43 30             	mov    0x30(%ebx),%eax
+  80019d:	89 c2                	mov    %eax,%edx
+  80019f:	2b 53 2c             	sub    0x2c(%ebx),%edx
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	83 fa 04             	cmp    $0x4,%edx
+  8001a8:	74 de                	je     800188 <umain+0x153>
+			s->q[s->qtail++ % NSLOT] = i;
+  8001aa:	8d 50 01             	lea    0x1(%eax),%edx
+  8001ad:	89 53 30             	mov    %edx,0x30(%ebx)
+  8001b0:	83 e0 03             	and    $0x3,%eax
+  8001b3:	89 74 83 1c          	mov    %esi,0x1c(%ebx,%eax,4)
+			cond_signal(&s->notempty);
+  8001b7:	83 ec 0c             	sub    $0xc,%esp
+  8001ba:	68 14 00 00 50       	push   $0x50000014
+  8001bf:	e8 25 42 00 00       	call   8043e9 <cond_signal>
+			mutex_unlock(&s->qlock);
+  8001c4:	c7 04 24 08 00 00 50 	movl   $0x50000008,(%esp)
+  8001cb:	e8 6b 41 00 00       	call   80433b <mutex_unlock>
+		for (i = 1; i <= NITEM; i++) {
+  8001d0:	83 c6 01             	add    $0x1,%esi
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	81 fe e9 03 00 00    	cmp    $0x3e9,%esi
+  8001dc:	74 1f                	je     8001fd <umain+0x1c8>
+			mutex_lock(&s->qlock);
+  8001de:	83 ec 0c             	sub    $0xc,%esp
+  8001e1:	68 08 00 00 50       	push   $0x50000008
+  8001e6:	e8 e2 40 00 00       	call   8042cd <mutex_lock>
+			while (s->qtail - s->qhead == NSLOT)
+  8001eb:	8b 43 30             	mov    0x30(%ebx),%eax
+  8001ee:	89 c2                	mov    %eax,%edx
+  8001f0:	2b 53 2c             	sub    0x2c(%ebx),%edx
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	83 fa 04             	cmp    $0x4,%edx
+  8001f9:	74 8d                	je     800188 <umain+0x153>
+  8001fb:	eb ad                	jmp    8001aa <umain+0x175>
+		exit();
+  8001fd:	e8 23 03 00 00       	call   800525 <exit>
+		for (i = 1; i <= NITEM; i++) {
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+		while (s->qtail == s->qhead)
+  800207:	bb 00 00 00 50       	mov    $0x50000000,%ebx
+  80020c:	eb 55                	jmp    800263 <umain+0x22e>
+			cond_wait(&s->notempty, &s->qlock);
+  80020e:	83 ec 08             	sub    $0x8,%esp
+  800211:	68 08 00 00 50       	push   $0x50000008
+  800216:	68 14 00 00 50       	push   $0x50000014
+  80021b:	e8 b1 41 00 00       	call   8043d1 <cond_wait>
+		while (s->qtail == s->qhead)
+  800220:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	39 43 30             	cmp    %eax,0x30(%ebx)
+  800229:	74 e3                	je     80020e <umain+0x1d9>
+		v = s->q[s->qhead++ % NSLOT];
+  80022b:	8d 50 01             	lea    0x1(%eax),%edx
+  80022e:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  800231:	83 e0 03             	and    $0x3,%eax
+  800234:	8b 7c 83 1c          	mov    0x1c(%ebx,%eax,4),%edi
+		cond_signal(&s->notfull);
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	68 0c 00 00 50       	push   $0x5000000c
+  800240:	e8 a4 41 00 00       	call   8043e9 <cond_signal>
+		mutex_unlock(&s->qlock);
+  800245:	c7 04 24 08 00 00 50 	movl   $0x50000008,(%esp)
+  80024c:	e8 ea 40 00 00       	call   80433b <mutex_unlock>
+		if (v != i)
+  800251:	83 c4 10             	add    $0x10,%esp
+  800254:	39 f7                	cmp    %esi,%edi
+  800256:	75 25                	jne    80027d <umain+0x248>
+	for (i = 1; i <= NITEM; i++) {
+  800258:	83 c6 01             	add    $0x1,%esi
+  80025b:	81 fe e9 03 00 00    	cmp    $0x3e9,%esi
+  800261:	74 30                	je     800293 <umain+0x25e>
+		mutex_lock(&s->qlock);
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  800266:	68 08 00 00 50       	push   $0x50000008
+  80026b:	e8 5d 40 00 00       	call   8042cd <mutex_lock>
+		while (s->qtail == s->qhead)
+  800270:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 43 30             	cmp    %eax,0x30(%ebx)
+  800279:	74 93                	je     80020e <umain+0x1d9>
+  80027b:	eb ae                	jmp    80022b <umain+0x1f6>
+			panic("got item %d, expected %d", v, i);
+  80027d:	83 ec 0c             	sub    $0xc,%esp
+  800280:	56                   	push   %esi
+  800281:	57                   	push   %edi
+  800282:	68 f6 48 80 00       	push   $0x8048f6
+  800287:	6a 54                	push   $0x54
+  800289:	68 bc 48 80 00       	push   $0x8048bc
+  80028e:	e8 ac 02 00 00       	call   80053f <_panic>
+	wait(kid);
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	ff 75 d4             	push   -0x2c(%ebp)
+  800299:	e8 19 3e 00 00       	call   8040b7 <wait>
+	cprintf("testsync: cond OK\n");
+  80029e:	c7 04 24 0f 49 80 00 	movl   $0x80490f,(%esp)
+  8002a5:	e8 70 03 00 00       	call   80061a <cprintf>
+	if ((r = sys_futex_wait(&SHARED->counter, SHARED->counter + 1, ~0))
+  8002aa:	a1 04 00 00 50       	mov    0x50000004,%eax
+  8002af:	83 c4 0c             	add    $0xc,%esp
+  8002b2:	6a ff                	push   $0xffffffff
+  8002b4:	83 c0 01             	add    $0x1,%eax
+  8002b7:	50                   	push   %eax
+  8002b8:	68 04 00 00 50       	push   $0x50000004
+  8002bd:	e8 81 12 00 00       	call   801543 <sys_futex_wait>
+  8002c2:	83 c4 10             	add    $0x10,%esp
+  8002c5:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8002c8:	0f 85 19 01 00 00    	jne    8003e7 <umain+0x3b2>
+	mutex_lock(&SHARED->qlock);
+  8002ce:	83 ec 0c             	sub    $0xc,%esp
+  8002d1:	68 08 00 00 50       	push   $0x50000008
+  8002d6:	e8 f2 3f 00 00       	call   8042cd <mutex_lock>
+	t0 = sys_time_msec();
+  8002db:	e8 b9 10 00 00       	call   801399 <sys_time_msec>
+  8002e0:	89 c6                	mov    %eax,%esi
+	r = cond_timedwait(&SHARED->notempty, &SHARED->qlock, t0 + 50);
+  8002e2:	8d 78 32             	lea    0x32(%eax),%edi
+  8002e5:	83 c4 0c             	add    $0xc,%esp
+  8002e8:	57                   	push   %edi
+  8002e9:	68 08 00 00 50       	push   $0x50000008
+  8002ee:	68 14 00 00 50       	push   $0x50000014
+  8002f3:	e8 80 40 00 00       	call   804378 <cond_timedwait>
+  8002f8:	89 c3                	mov    %eax,%ebx
+	if (r != -E_TIMEOUT || sys_time_msec() < t0 + 50)
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	83 f8 ef             	cmp    $0xffffffef,%eax
+  800300:	0f 85 f3 00 00 00    	jne    8003f9 <umain+0x3c4>
+  800306:	e8 8e 10 00 00       	call   801399 <sys_time_msec>
+  80030b:	39 f8                	cmp    %edi,%eax
+  80030d:	0f 82 e6 00 00 00    	jb     8003f9 <umain+0x3c4>
+	mutex_unlock(&SHARED->qlock);
+  800313:	83 ec 0c             	sub    $0xc,%esp
+  800316:	68 08 00 00 50       	push   $0x50000008
+  80031b:	e8 1b 40 00 00       	call   80433b <mutex_unlock>
+	cprintf("testsync: timeout OK\n");
+  800320:	c7 04 24 22 49 80 00 	movl   $0x804922,(%esp)
+  800327:	e8 ee 02 00 00       	call   80061a <cprintf>
+	if ((kid = fork()) < 0)
+  80032c:	e8 1c 14 00 00       	call   80174d <fork>
+  800331:	89 c6                	mov    %eax,%esi
+  800333:	83 c4 10             	add    $0x10,%esp
+  800336:	85 c0                	test   %eax,%eax
+  800338:	0f 88 d8 00 00 00    	js     800416 <umain+0x3e1>
+	if (kid == 0) {
+  80033e:	0f 84 e4 00 00 00    	je     800428 <umain+0x3f3>
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800344:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800346:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80034b:	29 d0                	sub    %edx,%eax
+  80034d:	89 c2                	mov    %eax,%edx
+  80034f:	c1 ea 0f             	shr    $0xf,%edx
+  800352:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800357:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035c:	0f 42 c2             	cmovb  %edx,%eax
+	s0 = thisenv->env_syscalls;
+  80035f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  800366:	8b 78 5c             	mov    0x5c(%eax),%edi
+	for (i = 0; i < NMSG; i++)
+  800369:	bb 00 00 00 00       	mov    $0x0,%ebx
+		ipc_send(kid, i, NULL, 0);
+  80036e:	6a 00                	push   $0x0
+  800370:	6a 00                	push   $0x0
+  800372:	53                   	push   %ebx
+  800373:	56                   	push   %esi
+  800374:	e8 3b 1c 00 00       	call   801fb4 <ipc_send>
+	for (i = 0; i < NMSG; i++)
+  800379:	83 c3 01             	add    $0x1,%ebx
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	83 fb 64             	cmp    $0x64,%ebx
+  800382:	75 ea                	jne    80036e <umain+0x339>
+  800384:	89 e2                	mov    %esp,%edx
+  800386:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80038b:	29 d0                	sub    %edx,%eax
+  80038d:	89 c2                	mov    %eax,%edx
+  80038f:	c1 ea 0f             	shr    $0xf,%edx
+  800392:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039c:	0f 42 c2             	cmovb  %edx,%eax
+	calls = thisenv->env_syscalls - s0;
+  80039f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8003a6:	8b 58 5c             	mov    0x5c(%eax),%ebx
+  8003a9:	29 fb                	sub    %edi,%ebx
+	wait(kid);
+  8003ab:	83 ec 0c             	sub    $0xc,%esp
+  8003ae:	56                   	push   %esi
+  8003af:	e8 03 3d 00 00       	call   8040b7 <wait>
+	if (calls > 3 * NMSG)
+  8003b4:	83 c4 10             	add    $0x10,%esp
+  8003b7:	81 fb 2c 01 00 00    	cmp    $0x12c,%ebx
+  8003bd:	0f 87 bb 00 00 00    	ja     80047e <umain+0x449>
+	cprintf("testsync: ipc OK\n");
+  8003c3:	83 ec 0c             	sub    $0xc,%esp
+  8003c6:	68 51 49 80 00       	push   $0x804951
+  8003cb:	e8 4a 02 00 00       	call   80061a <cprintf>
+	test_mutex();
+	test_cond();
+	test_timeout();
+	test_ipc();
+	cprintf("testsync: OK\n");
+  8003d0:	c7 04 24 63 49 80 00 	movl   $0x804963,(%esp)
+  8003d7:	e8 3e 02 00 00       	call   80061a <cprintf>
+}
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e2:	5b                   	pop    %ebx
+  8003e3:	5e                   	pop    %esi
+  8003e4:	5f                   	pop    %edi
+  8003e5:	5d                   	pop    %ebp
+  8003e6:	c3                   	ret
+		panic("futex wait on a changed word: %e", r);
+  8003e7:	50                   	push   %eax
+  8003e8:	68 74 49 80 00       	push   $0x804974
+  8003ed:	6a 62                	push   $0x62
+  8003ef:	68 bc 48 80 00       	push   $0x8048bc
+  8003f4:	e8 46 01 00 00       	call   80053f <_panic>
+		panic("cond_timedwait returned %e after %d ms", r,
+  8003f9:	e8 9b 0f 00 00       	call   801399 <sys_time_msec>
+  8003fe:	83 ec 0c             	sub    $0xc,%esp
+  800401:	29 f0                	sub    %esi,%eax
+  800403:	50                   	push   %eax
+  800404:	53                   	push   %ebx
+  800405:	68 98 49 80 00       	push   $0x804998
+  80040a:	6a 68                	push   $0x68
+  80040c:	68 bc 48 80 00       	push   $0x8048bc
+  800411:	e8 29 01 00 00       	call   80053f <_panic>
+		panic("fork: %e", kid);
+  800416:	50                   	push   %eax
+  800417:	68 ca 4d 80 00       	push   $0x804dca
+  80041c:	6a 79                	push   $0x79
+  80041e:	68 bc 48 80 00       	push   $0x8048bc
+  800423:	e8 17 01 00 00       	call   80053f <_panic>
+		for (t0 = sys_time_msec(); sys_time_msec() < t0 + 200; )
+  800428:	e8 6c 0f 00 00       	call   801399 <sys_time_msec>
+  80042d:	8d 98 c8 00 00 00    	lea    0xc8(%eax),%ebx
+  800433:	e8 61 0f 00 00       	call   801399 <sys_time_msec>
+  800438:	39 d8                	cmp    %ebx,%eax
+  80043a:	72 f7                	jb     800433 <umain+0x3fe>
+		for (i = 0; i < NMSG; i++)
+  80043c:	bb 00 00 00 00       	mov    $0x0,%ebx
+			if ((v = ipc_recv(NULL, NULL, NULL)) != i)
+  800441:	83 ec 04             	sub    $0x4,%esp
+  800444:	6a 00                	push   $0x0
+  800446:	6a 00                	push   $0x0
+  800448:	6a 00                	push   $0x0
+  80044a:	e8 d5 18 00 00       	call   801d24 <ipc_recv>
+  80044f:	83 c4 10             	add    $0x10,%esp
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	75 12                	jne    800468 <umain+0x433>
+		for (i = 0; i < NMSG; i++)
+  800456:	83 c3 01             	add    $0x1,%ebx
+  800459:	83 fb 64             	cmp    $0x64,%ebx
+  80045c:	75 e3                	jne    800441 <umain+0x40c>
+		exit();
+  80045e:	e8 c2 00 00 00       	call   800525 <exit>
+  800463:	e9 dc fe ff ff       	jmp    800344 <umain+0x30f>
+				panic("received %d, expected %d", v, i);
+  800468:	83 ec 0c             	sub    $0xc,%esp
+  80046b:	53                   	push   %ebx
+  80046c:	50                   	push   %eax
+  80046d:	68 38 49 80 00       	push   $0x804938
+  800472:	6a 7f                	push   $0x7f
+  800474:	68 bc 48 80 00       	push   $0x8048bc
+  800479:	e8 c1 00 00 00       	call   80053f <_panic>
+		panic("%d system calls to send %d messages", calls, NMSG);
+  80047e:	83 ec 0c             	sub    $0xc,%esp
+  800481:	6a 64                	push   $0x64
+  800483:	53                   	push   %ebx
+  800484:	68 c0 49 80 00       	push   $0x8049c0
+  800489:	68 89 00 00 00       	push   $0x89
+  80048e:	68 bc 48 80 00       	push   $0x8048bc
+  800493:	e8 a7 00 00 00       	call   80053f <_panic>
+
+00800498 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800498:	55                   	push   %ebp
+  800499:	89 e5                	mov    %esp,%ebp
+  80049b:	56                   	push   %esi
+  80049c:	53                   	push   %ebx
+  80049d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8004a3:	89 e2                	mov    %esp,%edx
+  8004a5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8004aa:	29 d0                	sub    %edx,%eax
+  8004ac:	89 c2                	mov    %eax,%edx
+  8004ae:	c1 ea 0f             	shr    $0xf,%edx
+  8004b1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8004b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004bb:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  8004be:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  8004c5:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  8004c9:	e8 39 0c 00 00       	call   801107 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  8004ce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004d3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8004d9:	89 e1                	mov    %esp,%ecx
+  8004db:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8004e0:	29 ca                	sub    %ecx,%edx
+  8004e2:	89 d1                	mov    %edx,%ecx
+  8004e4:	c1 e9 0f             	shr    $0xf,%ecx
+  8004e7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8004ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f2:	0f 42 d1             	cmovb  %ecx,%edx
+  8004f5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004fa:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800501:	85 db                	test   %ebx,%ebx
+  800503:	7e 07                	jle    80050c <libmain+0x74>
+		binaryname = argv[0];
+  800505:	8b 06                	mov    (%esi),%eax
+  800507:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	56                   	push   %esi
+  800510:	53                   	push   %ebx
+  800511:	e8 1f fb ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800516:	e8 0a 00 00 00       	call   800525 <exit>
+}
+  80051b:	83 c4 10             	add    $0x10,%esp
+  80051e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800521:	5b                   	pop    %ebx
+  800522:	5e                   	pop    %esi
+  800523:	5d                   	pop    %ebp
+  800524:	c3                   	ret
+
+00800525 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800525:	55                   	push   %ebp
+  800526:	89 e5                	mov    %esp,%ebp
+  800528:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80052b:	e8 15 1d 00 00       	call   802245 <close_all>
+	sys_env_destroy(0);
+  800530:	83 ec 0c             	sub    $0xc,%esp
+  800533:	6a 00                	push   $0x0
+  800535:	e8 8c 0b 00 00       	call   8010c6 <sys_env_destroy>
+}
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	c9                   	leave
+  80053e:	c3                   	ret
+
+0080053f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80053f:	55                   	push   %ebp
+  800540:	89 e5                	mov    %esp,%ebp
+  800542:	56                   	push   %esi
+  800543:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800544:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800547:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80054d:	e8 b5 0b 00 00       	call   801107 <sys_getenvid>
+  800552:	83 ec 0c             	sub    $0xc,%esp
+  800555:	ff 75 0c             	push   0xc(%ebp)
+  800558:	ff 75 08             	push   0x8(%ebp)
+  80055b:	56                   	push   %esi
+  80055c:	50                   	push   %eax
+  80055d:	68 f0 49 80 00       	push   $0x8049f0
+  800562:	e8 b3 00 00 00       	call   80061a <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800567:	83 c4 18             	add    $0x18,%esp
+  80056a:	53                   	push   %ebx
+  80056b:	ff 75 10             	push   0x10(%ebp)
+  80056e:	e8 56 00 00 00       	call   8005c9 <vcprintf>
+	cprintf("\n");
+  800573:	c7 04 24 6f 49 80 00 	movl   $0x80496f,(%esp)
+  80057a:	e8 9b 00 00 00       	call   80061a <cprintf>
+  80057f:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800582:	cc                   	int3
+	while (1)
+  800583:	eb fd                	jmp    800582 <_panic+0x43>
+
+00800585 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800585:	55                   	push   %ebp
+  800586:	89 e5                	mov    %esp,%ebp
+  800588:	53                   	push   %ebx
+  800589:	83 ec 04             	sub    $0x4,%esp
+  80058c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80058f:	8b 13                	mov    (%ebx),%edx
+  800591:	8d 42 01             	lea    0x1(%edx),%eax
+  800594:	89 03                	mov    %eax,(%ebx)
+  800596:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800599:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80059d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005a2:	74 09                	je     8005ad <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8005a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005ab:	c9                   	leave
+  8005ac:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	68 ff 00 00 00       	push   $0xff
+  8005b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005b8:	50                   	push   %eax
+  8005b9:	e8 cb 0a 00 00       	call   801089 <sys_cputs>
+		b->idx = 0;
+  8005be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	eb db                	jmp    8005a4 <putch+0x1f>
+
+008005c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005c9:	55                   	push   %ebp
+  8005ca:	89 e5                	mov    %esp,%ebp
+  8005cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8005d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005d9:	00 00 00 
+	b.cnt = 0;
+  8005dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005e3:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8005e6:	ff 75 0c             	push   0xc(%ebp)
+  8005e9:	ff 75 08             	push   0x8(%ebp)
+  8005ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005f2:	50                   	push   %eax
+  8005f3:	68 85 05 80 00       	push   $0x800585
+  8005f8:	e8 1c 01 00 00       	call   800719 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005fd:	83 c4 08             	add    $0x8,%esp
+  800600:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800606:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80060c:	50                   	push   %eax
+  80060d:	e8 77 0a 00 00       	call   801089 <sys_cputs>
+
+	return b.cnt;
+}
+  800612:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800618:	c9                   	leave
+  800619:	c3                   	ret
+
+0080061a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80061a:	55                   	push   %ebp
+  80061b:	89 e5                	mov    %esp,%ebp
+  80061d:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800620:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800623:	50                   	push   %eax
+  800624:	ff 75 08             	push   0x8(%ebp)
+  800627:	e8 9d ff ff ff       	call   8005c9 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80062c:	c9                   	leave
+  80062d:	c3                   	ret
+
+0080062e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80062e:	55                   	push   %ebp
+  80062f:	89 e5                	mov    %esp,%ebp
+  800631:	57                   	push   %edi
+  800632:	56                   	push   %esi
+  800633:	53                   	push   %ebx
+  800634:	83 ec 1c             	sub    $0x1c,%esp
+  800637:	89 c3                	mov    %eax,%ebx
+  800639:	89 d6                	mov    %edx,%esi
+  80063b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80063e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800641:	89 d1                	mov    %edx,%ecx
+  800643:	89 c2                	mov    %eax,%edx
+  800645:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800648:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064b:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80064e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800651:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800658:	39 c2                	cmp    %eax,%edx
+  80065a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80065d:	73 4b                	jae    8006aa <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80065f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800662:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800665:	85 ff                	test   %edi,%edi
+  800667:	7e 11                	jle    80067a <printnum+0x4c>
+			putch(padc, putdat);
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	56                   	push   %esi
+  80066d:	ff 75 18             	push   0x18(%ebp)
+  800670:	ff d3                	call   *%ebx
+		while (--width > 0)
+  800672:	83 c4 10             	add    $0x10,%esp
+  800675:	83 ef 01             	sub    $0x1,%edi
+  800678:	75 ef                	jne    800669 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80067a:	83 ec 08             	sub    $0x8,%esp
+  80067d:	56                   	push   %esi
+  80067e:	83 ec 04             	sub    $0x4,%esp
+  800681:	ff 75 e4             	push   -0x1c(%ebp)
+  800684:	ff 75 e0             	push   -0x20(%ebp)
+  800687:	ff 75 dc             	push   -0x24(%ebp)
+  80068a:	ff 75 d8             	push   -0x28(%ebp)
+  80068d:	e8 ef 40 00 00       	call   804781 <__umoddi3>
+  800692:	83 c4 14             	add    $0x14,%esp
+  800695:	0f be 80 13 4a 80 00 	movsbl 0x804a13(%eax),%eax
+  80069c:	50                   	push   %eax
+  80069d:	ff d3                	call   *%ebx
+}
+  80069f:	83 c4 10             	add    $0x10,%esp
+  8006a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a5:	5b                   	pop    %ebx
+  8006a6:	5e                   	pop    %esi
+  8006a7:	5f                   	pop    %edi
+  8006a8:	5d                   	pop    %ebp
+  8006a9:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006aa:	83 ec 0c             	sub    $0xc,%esp
+  8006ad:	ff 75 18             	push   0x18(%ebp)
+  8006b0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006b3:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8006b6:	52                   	push   %edx
+  8006b7:	50                   	push   %eax
+  8006b8:	83 ec 08             	sub    $0x8,%esp
+  8006bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8006be:	ff 75 e0             	push   -0x20(%ebp)
+  8006c1:	ff 75 dc             	push   -0x24(%ebp)
+  8006c4:	ff 75 d8             	push   -0x28(%ebp)
+  8006c7:	e8 ef 3f 00 00       	call   8046bb <__udivdi3>
+  8006cc:	83 c4 18             	add    $0x18,%esp
+  8006cf:	52                   	push   %edx
+  8006d0:	50                   	push   %eax
+  8006d1:	89 f2                	mov    %esi,%edx
+  8006d3:	89 d8                	mov    %ebx,%eax
+  8006d5:	e8 54 ff ff ff       	call   80062e <printnum>
+  8006da:	83 c4 20             	add    $0x20,%esp
+  8006dd:	eb 9b                	jmp    80067a <printnum+0x4c>
+
+008006df <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8006e5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8006e9:	8b 10                	mov    (%eax),%edx
+  8006eb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006ee:	73 0a                	jae    8006fa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8006f0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006f3:	89 08                	mov    %ecx,(%eax)
+  8006f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f8:	88 02                	mov    %al,(%edx)
+}
+  8006fa:	5d                   	pop    %ebp
+  8006fb:	c3                   	ret
+
+008006fc <printfmt>:
+{
+  8006fc:	55                   	push   %ebp
+  8006fd:	89 e5                	mov    %esp,%ebp
+  8006ff:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800702:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800705:	50                   	push   %eax
+  800706:	ff 75 10             	push   0x10(%ebp)
+  800709:	ff 75 0c             	push   0xc(%ebp)
+  80070c:	ff 75 08             	push   0x8(%ebp)
+  80070f:	e8 05 00 00 00       	call   800719 <vprintfmt>
+}
+  800714:	83 c4 10             	add    $0x10,%esp
+  800717:	c9                   	leave
+  800718:	c3                   	ret
+
+00800719 <vprintfmt>:
+{
+  800719:	55                   	push   %ebp
+  80071a:	89 e5                	mov    %esp,%ebp
+  80071c:	57                   	push   %edi
+  80071d:	56                   	push   %esi
+  80071e:	53                   	push   %ebx
+  80071f:	83 ec 2c             	sub    $0x2c,%esp
+  800722:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800725:	89 df                	mov    %ebx,%edi
+  800727:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80072a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80072d:	8d 70 01             	lea    0x1(%eax),%esi
+  800730:	0f b6 00             	movzbl (%eax),%eax
+  800733:	83 f8 25             	cmp    $0x25,%eax
+  800736:	74 1e                	je     800756 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800738:	85 c0                	test   %eax,%eax
+  80073a:	0f 84 15 05 00 00    	je     800c55 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	50                   	push   %eax
+  800745:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800747:	83 c6 01             	add    $0x1,%esi
+  80074a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80074e:	83 c4 10             	add    $0x10,%esp
+  800751:	83 f8 25             	cmp    $0x25,%eax
+  800754:	75 e2                	jne    800738 <vprintfmt+0x1f>
+		padc = ' ';
+  800756:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  80075a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800761:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800768:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80076f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800774:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800777:	8d 56 01             	lea    0x1(%esi),%edx
+  80077a:	0f b6 0e             	movzbl (%esi),%ecx
+  80077d:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  800780:	3c 55                	cmp    $0x55,%al
+  800782:	0f 87 3b 04 00 00    	ja     800bc3 <vprintfmt+0x4aa>
+  800788:	0f b6 c0             	movzbl %al,%eax
+  80078b:	ff 24 85 80 4b 80 00 	jmp    *0x804b80(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800792:	89 75 10             	mov    %esi,0x10(%ebp)
+  800795:	eb 93                	jmp    80072a <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  800797:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  800799:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  80079d:	eb d8                	jmp    800777 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80079f:	89 d6                	mov    %edx,%esi
+  8007a1:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8007a5:	eb d0                	jmp    800777 <vprintfmt+0x5e>
+  8007a7:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8007aa:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8007ad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8007b0:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8007b4:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8007b7:	83 f9 09             	cmp    $0x9,%ecx
+  8007ba:	77 6f                	ja     80082b <vprintfmt+0x112>
+  8007bc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8007bf:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8007c2:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8007c5:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8007c9:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8007cc:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8007cf:	83 fe 09             	cmp    $0x9,%esi
+  8007d2:	76 eb                	jbe    8007bf <vprintfmt+0xa6>
+  8007d4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8007d7:	89 d6                	mov    %edx,%esi
+  8007d9:	eb 13                	jmp    8007ee <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 00                	mov    (%eax),%eax
+  8007e0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8007ec:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  8007ee:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8007f2:	79 83                	jns    800777 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  8007f4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8007f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007fa:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800801:	e9 71 ff ff ff       	jmp    800777 <vprintfmt+0x5e>
+			if (width < 0)
+  800806:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800809:	85 c9                	test   %ecx,%ecx
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	0f 49 c1             	cmovns %ecx,%eax
+  800813:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800816:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800818:	e9 5a ff ff ff       	jmp    800777 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80081d:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80081f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800826:	e9 4c ff ff ff       	jmp    800777 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80082b:	89 d6                	mov    %edx,%esi
+  80082d:	eb bf                	jmp    8007ee <vprintfmt+0xd5>
+			lflag++;
+  80082f:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800833:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800835:	e9 3d ff ff ff       	jmp    800777 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  80083a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80083d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800840:	8d 70 04             	lea    0x4(%eax),%esi
+  800843:	83 ec 08             	sub    $0x8,%esp
+  800846:	53                   	push   %ebx
+  800847:	ff 30                	push   (%eax)
+  800849:	ff d7                	call   *%edi
+			break;
+  80084b:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80084e:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  800851:	e9 d4 fe ff ff       	jmp    80072a <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800856:	89 55 10             	mov    %edx,0x10(%ebp)
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80085f:	8b 10                	mov    (%eax),%edx
+  800861:	89 d0                	mov    %edx,%eax
+  800863:	f7 d8                	neg    %eax
+  800865:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800868:	83 f8 12             	cmp    $0x12,%eax
+  80086b:	7f 23                	jg     800890 <vprintfmt+0x177>
+  80086d:	8b 14 85 e0 4c 80 00 	mov    0x804ce0(,%eax,4),%edx
+  800874:	85 d2                	test   %edx,%edx
+  800876:	74 18                	je     800890 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800878:	52                   	push   %edx
+  800879:	68 5b 4f 80 00       	push   $0x804f5b
+  80087e:	53                   	push   %ebx
+  80087f:	57                   	push   %edi
+  800880:	e8 77 fe ff ff       	call   8006fc <printfmt>
+  800885:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800888:	89 75 14             	mov    %esi,0x14(%ebp)
+  80088b:	e9 9a fe ff ff       	jmp    80072a <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800890:	50                   	push   %eax
+  800891:	68 2b 4a 80 00       	push   $0x804a2b
+  800896:	53                   	push   %ebx
+  800897:	57                   	push   %edi
+  800898:	e8 5f fe ff ff       	call   8006fc <printfmt>
+  80089d:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008a0:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8008a3:	e9 82 fe ff ff       	jmp    80072a <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8008a8:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	83 c0 04             	add    $0x4,%eax
+  8008b1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b7:	8b 00                	mov    (%eax),%eax
+  8008b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008bc:	85 c0                	test   %eax,%eax
+  8008be:	0f 84 61 03 00 00    	je     800c25 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8008c4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8008c8:	7e 06                	jle    8008d0 <vprintfmt+0x1b7>
+  8008ca:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8008ce:	75 29                	jne    8008f9 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008d3:	8d 70 01             	lea    0x1(%eax),%esi
+  8008d6:	0f b6 00             	movzbl (%eax),%eax
+  8008d9:	0f be d0             	movsbl %al,%edx
+  8008dc:	85 d2                	test   %edx,%edx
+  8008de:	0f 84 bb 00 00 00    	je     80099f <vprintfmt+0x286>
+  8008e4:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008e7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008ea:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008ed:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008f0:	eb 7a                	jmp    80096c <vprintfmt+0x253>
+				p = "(null)";
+  8008f2:	c7 45 d0 24 4a 80 00 	movl   $0x804a24,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8008f9:	83 ec 08             	sub    $0x8,%esp
+  8008fc:	ff 75 d4             	push   -0x2c(%ebp)
+  8008ff:	ff 75 d0             	push   -0x30(%ebp)
+  800902:	e8 e0 03 00 00       	call   800ce7 <strnlen>
+  800907:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80090a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80090d:	83 c4 10             	add    $0x10,%esp
+  800910:	85 d2                	test   %edx,%edx
+  800912:	0f 8e d6 02 00 00    	jle    800bee <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800918:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80091c:	83 ec 08             	sub    $0x8,%esp
+  80091f:	53                   	push   %ebx
+  800920:	56                   	push   %esi
+  800921:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800923:	83 c4 10             	add    $0x10,%esp
+  800926:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80092a:	75 f0                	jne    80091c <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80092c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80092f:	8d 70 01             	lea    0x1(%eax),%esi
+  800932:	0f b6 00             	movzbl (%eax),%eax
+  800935:	0f be d0             	movsbl %al,%edx
+  800938:	85 d2                	test   %edx,%edx
+  80093a:	0f 84 da 02 00 00    	je     800c1a <vprintfmt+0x501>
+  800940:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800943:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800946:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800949:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80094c:	eb 1e                	jmp    80096c <vprintfmt+0x253>
+					putch(ch, putdat);
+  80094e:	83 ec 08             	sub    $0x8,%esp
+  800951:	ff 75 0c             	push   0xc(%ebp)
+  800954:	52                   	push   %edx
+  800955:	ff 55 08             	call   *0x8(%ebp)
+  800958:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80095b:	83 eb 01             	sub    $0x1,%ebx
+  80095e:	83 c6 01             	add    $0x1,%esi
+  800961:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800965:	0f be d0             	movsbl %al,%edx
+  800968:	85 d2                	test   %edx,%edx
+  80096a:	74 2a                	je     800996 <vprintfmt+0x27d>
+  80096c:	85 ff                	test   %edi,%edi
+  80096e:	78 05                	js     800975 <vprintfmt+0x25c>
+  800970:	83 ef 01             	sub    $0x1,%edi
+  800973:	78 59                	js     8009ce <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800975:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800979:	74 d3                	je     80094e <vprintfmt+0x235>
+  80097b:	0f be c0             	movsbl %al,%eax
+  80097e:	83 e8 20             	sub    $0x20,%eax
+  800981:	83 f8 5e             	cmp    $0x5e,%eax
+  800984:	76 c8                	jbe    80094e <vprintfmt+0x235>
+					putch('?', putdat);
+  800986:	83 ec 08             	sub    $0x8,%esp
+  800989:	ff 75 0c             	push   0xc(%ebp)
+  80098c:	6a 3f                	push   $0x3f
+  80098e:	ff 55 08             	call   *0x8(%ebp)
+  800991:	83 c4 10             	add    $0x10,%esp
+  800994:	eb c5                	jmp    80095b <vprintfmt+0x242>
+  800996:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800999:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80099c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  80099f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8009a2:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8009a6:	7e 1b                	jle    8009c3 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8009a8:	83 ec 08             	sub    $0x8,%esp
+  8009ab:	53                   	push   %ebx
+  8009ac:	6a 20                	push   $0x20
+  8009ae:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8009b0:	83 c4 10             	add    $0x10,%esp
+  8009b3:	83 ee 01             	sub    $0x1,%esi
+  8009b6:	75 f0                	jne    8009a8 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009b8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009bb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009be:	e9 67 fd ff ff       	jmp    80072a <vprintfmt+0x11>
+  8009c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009c9:	e9 5c fd ff ff       	jmp    80072a <vprintfmt+0x11>
+  8009ce:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8009d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8009d7:	eb c6                	jmp    80099f <vprintfmt+0x286>
+	if (lflag >= 2)
+  8009d9:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009dc:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009df:	83 f9 01             	cmp    $0x1,%ecx
+  8009e2:	7f 1f                	jg     800a03 <vprintfmt+0x2ea>
+	else if (lflag)
+  8009e4:	85 c9                	test   %ecx,%ecx
+  8009e6:	74 67                	je     800a4f <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  8009e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009eb:	8b 30                	mov    (%eax),%esi
+  8009ed:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8009f0:	89 f0                	mov    %esi,%eax
+  8009f2:	c1 f8 1f             	sar    $0x1f,%eax
+  8009f5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8009f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a01:	eb 17                	jmp    800a1a <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800a03:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a06:	8b 50 04             	mov    0x4(%eax),%edx
+  800a09:	8b 00                	mov    (%eax),%eax
+  800a0b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a0e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a11:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a14:	8d 40 08             	lea    0x8(%eax),%eax
+  800a17:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a1a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a1d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a20:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800a25:	85 c9                	test   %ecx,%ecx
+  800a27:	0f 89 12 01 00 00    	jns    800b3f <vprintfmt+0x426>
+				putch('-', putdat);
+  800a2d:	83 ec 08             	sub    $0x8,%esp
+  800a30:	53                   	push   %ebx
+  800a31:	6a 2d                	push   $0x2d
+  800a33:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800a35:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a38:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a3b:	f7 da                	neg    %edx
+  800a3d:	83 d1 00             	adc    $0x0,%ecx
+  800a40:	f7 d9                	neg    %ecx
+  800a42:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a45:	be 0a 00 00 00       	mov    $0xa,%esi
+  800a4a:	e9 f0 00 00 00       	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  800a4f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a52:	8b 30                	mov    (%eax),%esi
+  800a54:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800a57:	89 f0                	mov    %esi,%eax
+  800a59:	c1 f8 1f             	sar    $0x1f,%eax
+  800a5c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800a5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a62:	8d 40 04             	lea    0x4(%eax),%eax
+  800a65:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a68:	eb b0                	jmp    800a1a <vprintfmt+0x301>
+	if (lflag >= 2)
+  800a6a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800a6d:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a70:	83 f9 01             	cmp    $0x1,%ecx
+  800a73:	7f 1e                	jg     800a93 <vprintfmt+0x37a>
+	else if (lflag)
+  800a75:	85 c9                	test   %ecx,%ecx
+  800a77:	74 32                	je     800aab <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800a79:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7c:	8b 10                	mov    (%eax),%edx
+  800a7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a83:	8d 40 04             	lea    0x4(%eax),%eax
+  800a86:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800a89:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800a8e:	e9 ac 00 00 00       	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800a93:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a96:	8b 10                	mov    (%eax),%edx
+  800a98:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a9b:	8d 40 08             	lea    0x8(%eax),%eax
+  800a9e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aa1:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800aa6:	e9 94 00 00 00       	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800aab:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aae:	8b 10                	mov    (%eax),%edx
+  800ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800abb:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800ac0:	eb 7d                	jmp    800b3f <vprintfmt+0x426>
+	if (lflag >= 2)
+  800ac2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800ac5:	89 55 10             	mov    %edx,0x10(%ebp)
+  800ac8:	83 f9 01             	cmp    $0x1,%ecx
+  800acb:	7f 1b                	jg     800ae8 <vprintfmt+0x3cf>
+	else if (lflag)
+  800acd:	85 c9                	test   %ecx,%ecx
+  800acf:	74 2c                	je     800afd <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800ad1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad4:	8b 10                	mov    (%eax),%edx
+  800ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800adb:	8d 40 04             	lea    0x4(%eax),%eax
+  800ade:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800ae1:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800ae6:	eb 57                	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800ae8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aeb:	8b 10                	mov    (%eax),%edx
+  800aed:	8b 48 04             	mov    0x4(%eax),%ecx
+  800af0:	8d 40 08             	lea    0x8(%eax),%eax
+  800af3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800af6:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800afb:	eb 42                	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800afd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b00:	8b 10                	mov    (%eax),%edx
+  800b02:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b07:	8d 40 04             	lea    0x4(%eax),%eax
+  800b0a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b0d:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800b12:	eb 2b                	jmp    800b3f <vprintfmt+0x426>
+			putch('0', putdat);
+  800b14:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b17:	83 ec 08             	sub    $0x8,%esp
+  800b1a:	53                   	push   %ebx
+  800b1b:	6a 30                	push   $0x30
+  800b1d:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800b1f:	83 c4 08             	add    $0x8,%esp
+  800b22:	53                   	push   %ebx
+  800b23:	6a 78                	push   $0x78
+  800b25:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2a:	8b 10                	mov    (%eax),%edx
+  800b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b31:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b34:	8d 40 04             	lea    0x4(%eax),%eax
+  800b37:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b3a:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  800b3f:	83 ec 0c             	sub    $0xc,%esp
+  800b42:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800b46:	50                   	push   %eax
+  800b47:	ff 75 e4             	push   -0x1c(%ebp)
+  800b4a:	56                   	push   %esi
+  800b4b:	51                   	push   %ecx
+  800b4c:	52                   	push   %edx
+  800b4d:	89 da                	mov    %ebx,%edx
+  800b4f:	89 f8                	mov    %edi,%eax
+  800b51:	e8 d8 fa ff ff       	call   80062e <printnum>
+			break;
+  800b56:	83 c4 20             	add    $0x20,%esp
+  800b59:	e9 cc fb ff ff       	jmp    80072a <vprintfmt+0x11>
+	if (lflag >= 2)
+  800b5e:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800b61:	89 55 10             	mov    %edx,0x10(%ebp)
+  800b64:	83 f9 01             	cmp    $0x1,%ecx
+  800b67:	7f 1b                	jg     800b84 <vprintfmt+0x46b>
+	else if (lflag)
+  800b69:	85 c9                	test   %ecx,%ecx
+  800b6b:	74 2c                	je     800b99 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  800b6d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b70:	8b 10                	mov    (%eax),%edx
+  800b72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b77:	8d 40 04             	lea    0x4(%eax),%eax
+  800b7a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b7d:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  800b82:	eb bb                	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800b84:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b87:	8b 10                	mov    (%eax),%edx
+  800b89:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b8c:	8d 40 08             	lea    0x8(%eax),%eax
+  800b8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b92:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800b97:	eb a6                	jmp    800b3f <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800b99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9c:	8b 10                	mov    (%eax),%edx
+  800b9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ba9:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800bae:	eb 8f                	jmp    800b3f <vprintfmt+0x426>
+			putch(ch, putdat);
+  800bb0:	89 55 10             	mov    %edx,0x10(%ebp)
+  800bb3:	83 ec 08             	sub    $0x8,%esp
+  800bb6:	53                   	push   %ebx
+  800bb7:	6a 25                	push   $0x25
+  800bb9:	ff d7                	call   *%edi
+			break;
+  800bbb:	83 c4 10             	add    $0x10,%esp
+  800bbe:	e9 67 fb ff ff       	jmp    80072a <vprintfmt+0x11>
+			putch('%', putdat);
+  800bc3:	83 ec 08             	sub    $0x8,%esp
+  800bc6:	53                   	push   %ebx
+  800bc7:	6a 25                	push   $0x25
+  800bc9:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bcb:	83 c4 10             	add    $0x10,%esp
+  800bce:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800bd2:	0f 84 ba fb ff ff    	je     800792 <vprintfmt+0x79>
+  800bd8:	89 75 10             	mov    %esi,0x10(%ebp)
+  800bdb:	89 f0                	mov    %esi,%eax
+  800bdd:	83 e8 01             	sub    $0x1,%eax
+  800be0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800be4:	75 f7                	jne    800bdd <vprintfmt+0x4c4>
+  800be6:	89 45 10             	mov    %eax,0x10(%ebp)
+  800be9:	e9 3c fb ff ff       	jmp    80072a <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800bf1:	8d 70 01             	lea    0x1(%eax),%esi
+  800bf4:	0f b6 00             	movzbl (%eax),%eax
+  800bf7:	0f be d0             	movsbl %al,%edx
+  800bfa:	85 d2                	test   %edx,%edx
+  800bfc:	74 11                	je     800c0f <vprintfmt+0x4f6>
+  800bfe:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c01:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c04:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c07:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c0a:	e9 5d fd ff ff       	jmp    80096c <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800c0f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c12:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c15:	e9 10 fb ff ff       	jmp    80072a <vprintfmt+0x11>
+  800c1a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800c1d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800c20:	e9 05 fb ff ff       	jmp    80072a <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800c25:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800c29:	7e 0a                	jle    800c35 <vprintfmt+0x51c>
+  800c2b:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800c2f:	0f 85 bd fc ff ff    	jne    8008f2 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c35:	ba 28 00 00 00       	mov    $0x28,%edx
+  800c3a:	b8 28 00 00 00       	mov    $0x28,%eax
+  800c3f:	be 25 4a 80 00       	mov    $0x804a25,%esi
+  800c44:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800c47:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800c4a:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800c4d:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800c50:	e9 17 fd ff ff       	jmp    80096c <vprintfmt+0x253>
+}
+  800c55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c58:	5b                   	pop    %ebx
+  800c59:	5e                   	pop    %esi
+  800c5a:	5f                   	pop    %edi
+  800c5b:	5d                   	pop    %ebp
+  800c5c:	c3                   	ret
+
+00800c5d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	83 ec 18             	sub    $0x18,%esp
+  800c63:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c66:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800c69:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c6c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c70:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c73:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c7a:	85 c0                	test   %eax,%eax
+  800c7c:	74 26                	je     800ca4 <vsnprintf+0x47>
+  800c7e:	85 d2                	test   %edx,%edx
+  800c80:	7e 22                	jle    800ca4 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c82:	ff 75 14             	push   0x14(%ebp)
+  800c85:	ff 75 10             	push   0x10(%ebp)
+  800c88:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c8b:	50                   	push   %eax
+  800c8c:	68 df 06 80 00       	push   $0x8006df
+  800c91:	e8 83 fa ff ff       	call   800719 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c96:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c99:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c9f:	83 c4 10             	add    $0x10,%esp
+}
+  800ca2:	c9                   	leave
+  800ca3:	c3                   	ret
+		return -E_INVAL;
+  800ca4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ca9:	eb f7                	jmp    800ca2 <vsnprintf+0x45>
+
+00800cab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cab:	55                   	push   %ebp
+  800cac:	89 e5                	mov    %esp,%ebp
+  800cae:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cb1:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800cb4:	50                   	push   %eax
+  800cb5:	ff 75 10             	push   0x10(%ebp)
+  800cb8:	ff 75 0c             	push   0xc(%ebp)
+  800cbb:	ff 75 08             	push   0x8(%ebp)
+  800cbe:	e8 9a ff ff ff       	call   800c5d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+00800cc5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800ccb:	80 3a 00             	cmpb   $0x0,(%edx)
+  800cce:	74 10                	je     800ce0 <strlen+0x1b>
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800cd5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800cd8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cdc:	75 f7                	jne    800cd5 <strlen+0x10>
+	return n;
+}
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800ce5:	eb f7                	jmp    800cde <strlen+0x19>
+
+00800ce7 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ced:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf0:	85 d2                	test   %edx,%edx
+  800cf2:	74 16                	je     800d0a <strnlen+0x23>
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cfd:	74 09                	je     800d08 <strnlen+0x21>
+		n++;
+  800cff:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d02:	39 d0                	cmp    %edx,%eax
+  800d04:	75 f3                	jne    800cf9 <strnlen+0x12>
+		n++;
+  800d06:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0f:	eb f7                	jmp    800d08 <strnlen+0x21>
+
+00800d11 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	53                   	push   %ebx
+  800d15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d27:	83 c0 01             	add    $0x1,%eax
+  800d2a:	84 d2                	test   %dl,%dl
+  800d2c:	75 f2                	jne    800d20 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d2e:	89 c8                	mov    %ecx,%eax
+  800d30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d33:	c9                   	leave
+  800d34:	c3                   	ret
+
+00800d35 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 10             	sub    $0x10,%esp
+  800d3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d3f:	53                   	push   %ebx
+  800d40:	e8 80 ff ff ff       	call   800cc5 <strlen>
+  800d45:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d48:	ff 75 0c             	push   0xc(%ebp)
+  800d4b:	01 d8                	add    %ebx,%eax
+  800d4d:	50                   	push   %eax
+  800d4e:	e8 be ff ff ff       	call   800d11 <strcpy>
+	return dst;
+}
+  800d53:	89 d8                	mov    %ebx,%eax
+  800d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d58:	c9                   	leave
+  800d59:	c3                   	ret
+
+00800d5a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800d68:	85 db                	test   %ebx,%ebx
+  800d6a:	74 17                	je     800d83 <strncpy+0x29>
+  800d6c:	01 f3                	add    %esi,%ebx
+  800d6e:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800d70:	83 c0 01             	add    $0x1,%eax
+  800d73:	0f b6 0a             	movzbl (%edx),%ecx
+  800d76:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800d79:	80 f9 01             	cmp    $0x1,%cl
+  800d7c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d7f:	39 c3                	cmp    %eax,%ebx
+  800d81:	75 ed                	jne    800d70 <strncpy+0x16>
+	}
+	return ret;
+}
+  800d83:	89 f0                	mov    %esi,%eax
+  800d85:	5b                   	pop    %ebx
+  800d86:	5e                   	pop    %esi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+
+00800d89 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d89:	55                   	push   %ebp
+  800d8a:	89 e5                	mov    %esp,%ebp
+  800d8c:	56                   	push   %esi
+  800d8d:	53                   	push   %ebx
+  800d8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d91:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d97:	89 f0                	mov    %esi,%eax
+  800d99:	85 db                	test   %ebx,%ebx
+  800d9b:	74 1e                	je     800dbb <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800d9d:	83 eb 01             	sub    $0x1,%ebx
+  800da0:	74 16                	je     800db8 <strlcpy+0x2f>
+  800da2:	01 f3                	add    %esi,%ebx
+  800da4:	0f b6 0a             	movzbl (%edx),%ecx
+  800da7:	84 c9                	test   %cl,%cl
+  800da9:	74 0d                	je     800db8 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800dab:	83 c2 01             	add    $0x1,%edx
+  800dae:	83 c0 01             	add    $0x1,%eax
+  800db1:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800db4:	39 d8                	cmp    %ebx,%eax
+  800db6:	75 ec                	jne    800da4 <strlcpy+0x1b>
+		*dst = '\0';
+  800db8:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800dbb:	29 f0                	sub    %esi,%eax
+}
+  800dbd:	5b                   	pop    %ebx
+  800dbe:	5e                   	pop    %esi
+  800dbf:	5d                   	pop    %ebp
+  800dc0:	c3                   	ret
+
+00800dc1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800dc1:	55                   	push   %ebp
+  800dc2:	89 e5                	mov    %esp,%ebp
+  800dc4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dc7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800dca:	0f b6 01             	movzbl (%ecx),%eax
+  800dcd:	84 c0                	test   %al,%al
+  800dcf:	74 11                	je     800de2 <strcmp+0x21>
+  800dd1:	38 02                	cmp    %al,(%edx)
+  800dd3:	75 0d                	jne    800de2 <strcmp+0x21>
+		p++, q++;
+  800dd5:	83 c1 01             	add    $0x1,%ecx
+  800dd8:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ddb:	0f b6 01             	movzbl (%ecx),%eax
+  800dde:	84 c0                	test   %al,%al
+  800de0:	75 ef                	jne    800dd1 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800de2:	0f b6 c0             	movzbl %al,%eax
+  800de5:	0f b6 12             	movzbl (%edx),%edx
+  800de8:	29 d0                	sub    %edx,%eax
+}
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	53                   	push   %ebx
+  800df0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800df3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800df6:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800df9:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800dfe:	85 d2                	test   %edx,%edx
+  800e00:	74 2e                	je     800e30 <strncmp+0x44>
+  800e02:	0f b6 01             	movzbl (%ecx),%eax
+  800e05:	84 c0                	test   %al,%al
+  800e07:	74 16                	je     800e1f <strncmp+0x33>
+  800e09:	3a 03                	cmp    (%ebx),%al
+  800e0b:	75 12                	jne    800e1f <strncmp+0x33>
+		n--, p++, q++;
+  800e0d:	83 c1 01             	add    $0x1,%ecx
+  800e10:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800e13:	83 ea 01             	sub    $0x1,%edx
+  800e16:	75 ea                	jne    800e02 <strncmp+0x16>
+		return 0;
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1d:	eb 11                	jmp    800e30 <strncmp+0x44>
+  800e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800e24:	85 d2                	test   %edx,%edx
+  800e26:	74 08                	je     800e30 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e28:	0f b6 01             	movzbl (%ecx),%eax
+  800e2b:	0f b6 13             	movzbl (%ebx),%edx
+  800e2e:	29 d0                	sub    %edx,%eax
+}
+  800e30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e33:	c9                   	leave
+  800e34:	c3                   	ret
+
+00800e35 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e3f:	0f b6 10             	movzbl (%eax),%edx
+  800e42:	84 d2                	test   %dl,%dl
+  800e44:	74 15                	je     800e5b <strchr+0x26>
+		if (*s == c)
+  800e46:	38 d1                	cmp    %dl,%cl
+  800e48:	74 0f                	je     800e59 <strchr+0x24>
+	for (; *s; s++)
+  800e4a:	83 c0 01             	add    $0x1,%eax
+  800e4d:	0f b6 10             	movzbl (%eax),%edx
+  800e50:	84 d2                	test   %dl,%dl
+  800e52:	75 f2                	jne    800e46 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800e54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+	return 0;
+  800e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e60:	eb f7                	jmp    800e59 <strchr+0x24>
+
+00800e62 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	53                   	push   %ebx
+  800e66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e69:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800e6c:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800e6f:	38 d3                	cmp    %dl,%bl
+  800e71:	74 14                	je     800e87 <strfind+0x25>
+  800e73:	89 d1                	mov    %edx,%ecx
+  800e75:	84 db                	test   %bl,%bl
+  800e77:	74 0e                	je     800e87 <strfind+0x25>
+	for (; *s; s++)
+  800e79:	83 c0 01             	add    $0x1,%eax
+  800e7c:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e7f:	38 ca                	cmp    %cl,%dl
+  800e81:	74 04                	je     800e87 <strfind+0x25>
+  800e83:	84 d2                	test   %dl,%dl
+  800e85:	75 f2                	jne    800e79 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800e87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e8a:	c9                   	leave
+  800e8b:	c3                   	ret
+
+00800e8c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e93:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800e96:	85 c9                	test   %ecx,%ecx
+  800e98:	74 20                	je     800eba <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800e9a:	89 f8                	mov    %edi,%eax
+  800e9c:	09 c8                	or     %ecx,%eax
+  800e9e:	a8 03                	test   $0x3,%al
+  800ea0:	75 12                	jne    800eb4 <memset+0x28>
+		c &= 0xFF;
+  800ea2:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ea6:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800eac:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800eaf:	fc                   	cld
+  800eb0:	f3 ab                	rep stos %eax,%es:(%edi)
+  800eb2:	eb 06                	jmp    800eba <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800eb4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eb7:	fc                   	cld
+  800eb8:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800eba:	89 f8                	mov    %edi,%eax
+  800ebc:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ebf:	c9                   	leave
+  800ec0:	c3                   	ret
+
+00800ec1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	57                   	push   %edi
+  800ec5:	56                   	push   %esi
+  800ec6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ec9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ecc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ecf:	39 c6                	cmp    %eax,%esi
+  800ed1:	73 32                	jae    800f05 <memmove+0x44>
+  800ed3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ed6:	39 d0                	cmp    %edx,%eax
+  800ed8:	73 2b                	jae    800f05 <memmove+0x44>
+		s += n;
+		d += n;
+  800eda:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800edd:	89 d6                	mov    %edx,%esi
+  800edf:	09 fe                	or     %edi,%esi
+  800ee1:	09 ce                	or     %ecx,%esi
+  800ee3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ee9:	75 0e                	jne    800ef9 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800eeb:	83 ef 04             	sub    $0x4,%edi
+  800eee:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ef1:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ef4:	fd                   	std
+  800ef5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ef7:	eb 09                	jmp    800f02 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ef9:	83 ef 01             	sub    $0x1,%edi
+  800efc:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800eff:	fd                   	std
+  800f00:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f02:	fc                   	cld
+  800f03:	eb 1a                	jmp    800f1f <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f05:	89 f2                	mov    %esi,%edx
+  800f07:	09 c2                	or     %eax,%edx
+  800f09:	09 ca                	or     %ecx,%edx
+  800f0b:	f6 c2 03             	test   $0x3,%dl
+  800f0e:	75 0a                	jne    800f1a <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f10:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f13:	89 c7                	mov    %eax,%edi
+  800f15:	fc                   	cld
+  800f16:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f18:	eb 05                	jmp    800f1f <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f1a:	89 c7                	mov    %eax,%edi
+  800f1c:	fc                   	cld
+  800f1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f1f:	5e                   	pop    %esi
+  800f20:	5f                   	pop    %edi
+  800f21:	5d                   	pop    %ebp
+  800f22:	c3                   	ret
+
+00800f23 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800f23:	55                   	push   %ebp
+  800f24:	89 e5                	mov    %esp,%ebp
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f29:	ff 75 10             	push   0x10(%ebp)
+  800f2c:	ff 75 0c             	push   0xc(%ebp)
+  800f2f:	ff 75 08             	push   0x8(%ebp)
+  800f32:	e8 8a ff ff ff       	call   800ec1 <memmove>
+}
+  800f37:	c9                   	leave
+  800f38:	c3                   	ret
+
+00800f39 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800f44:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f47:	85 f6                	test   %esi,%esi
+  800f49:	74 29                	je     800f74 <memcmp+0x3b>
+  800f4b:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800f4d:	0f b6 08             	movzbl (%eax),%ecx
+  800f50:	0f b6 1a             	movzbl (%edx),%ebx
+  800f53:	38 d9                	cmp    %bl,%cl
+  800f55:	75 11                	jne    800f68 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f57:	83 c0 01             	add    $0x1,%eax
+  800f5a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f5d:	39 c6                	cmp    %eax,%esi
+  800f5f:	75 ec                	jne    800f4d <memcmp+0x14>
+	}
+
+	return 0;
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f66:	eb 08                	jmp    800f70 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800f68:	0f b6 c1             	movzbl %cl,%eax
+  800f6b:	0f b6 db             	movzbl %bl,%ebx
+  800f6e:	29 d8                	sub    %ebx,%eax
+}
+  800f70:	5b                   	pop    %ebx
+  800f71:	5e                   	pop    %esi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+	return 0;
+  800f74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f79:	eb f5                	jmp    800f70 <memcmp+0x37>
+
+00800f7b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f84:	89 c2                	mov    %eax,%edx
+  800f86:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f89:	39 d0                	cmp    %edx,%eax
+  800f8b:	73 0d                	jae    800f9a <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f8d:	38 08                	cmp    %cl,(%eax)
+  800f8f:	74 0d                	je     800f9e <memfind+0x23>
+	for (; s < ends; s++)
+  800f91:	83 c0 01             	add    $0x1,%eax
+  800f94:	39 c2                	cmp    %eax,%edx
+  800f96:	75 f5                	jne    800f8d <memfind+0x12>
+  800f98:	eb 06                	jmp    800fa0 <memfind+0x25>
+  800f9a:	89 c2                	mov    %eax,%edx
+  800f9c:	eb 02                	jmp    800fa0 <memfind+0x25>
+  800f9e:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800fa0:	89 d0                	mov    %edx,%eax
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+
+00800fa4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fb0:	0f b6 02             	movzbl (%edx),%eax
+  800fb3:	3c 20                	cmp    $0x20,%al
+  800fb5:	74 04                	je     800fbb <strtol+0x17>
+  800fb7:	3c 09                	cmp    $0x9,%al
+  800fb9:	75 0e                	jne    800fc9 <strtol+0x25>
+		s++;
+  800fbb:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fbe:	0f b6 02             	movzbl (%edx),%eax
+  800fc1:	3c 20                	cmp    $0x20,%al
+  800fc3:	74 f6                	je     800fbb <strtol+0x17>
+  800fc5:	3c 09                	cmp    $0x9,%al
+  800fc7:	74 f2                	je     800fbb <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fc9:	3c 2b                	cmp    $0x2b,%al
+  800fcb:	74 2a                	je     800ff7 <strtol+0x53>
+	int neg = 0;
+  800fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fd2:	3c 2d                	cmp    $0x2d,%al
+  800fd4:	74 2b                	je     801001 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fd6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fdc:	75 0f                	jne    800fed <strtol+0x49>
+  800fde:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fe1:	74 28                	je     80100b <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fe3:	85 db                	test   %ebx,%ebx
+  800fe5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fea:	0f 44 d8             	cmove  %eax,%ebx
+  800fed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff2:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ff5:	eb 46                	jmp    80103d <strtol+0x99>
+		s++;
+  800ff7:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fff:	eb d5                	jmp    800fd6 <strtol+0x32>
+		s++, neg = 1;
+  801001:	83 c2 01             	add    $0x1,%edx
+  801004:	bf 01 00 00 00       	mov    $0x1,%edi
+  801009:	eb cb                	jmp    800fd6 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80100b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80100f:	74 0e                	je     80101f <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  801011:	85 db                	test   %ebx,%ebx
+  801013:	75 d8                	jne    800fed <strtol+0x49>
+		s++, base = 8;
+  801015:	83 c2 01             	add    $0x1,%edx
+  801018:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80101d:	eb ce                	jmp    800fed <strtol+0x49>
+		s += 2, base = 16;
+  80101f:	83 c2 02             	add    $0x2,%edx
+  801022:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801027:	eb c4                	jmp    800fed <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801029:	0f be c0             	movsbl %al,%eax
+  80102c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  80102f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801032:	7d 3a                	jge    80106e <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  801034:	83 c2 01             	add    $0x1,%edx
+  801037:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80103b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  80103d:	0f b6 02             	movzbl (%edx),%eax
+  801040:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801043:	89 f3                	mov    %esi,%ebx
+  801045:	80 fb 09             	cmp    $0x9,%bl
+  801048:	76 df                	jbe    801029 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  80104a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80104d:	89 f3                	mov    %esi,%ebx
+  80104f:	80 fb 19             	cmp    $0x19,%bl
+  801052:	77 08                	ja     80105c <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  801054:	0f be c0             	movsbl %al,%eax
+  801057:	83 e8 57             	sub    $0x57,%eax
+  80105a:	eb d3                	jmp    80102f <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  80105c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80105f:	89 f3                	mov    %esi,%ebx
+  801061:	80 fb 19             	cmp    $0x19,%bl
+  801064:	77 08                	ja     80106e <strtol+0xca>
+			dig = *s - 'A' + 10;
+  801066:	0f be c0             	movsbl %al,%eax
+  801069:	83 e8 37             	sub    $0x37,%eax
+  80106c:	eb c1                	jmp    80102f <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  80106e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801072:	74 05                	je     801079 <strtol+0xd5>
+		*endptr = (char *) s;
+  801074:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801077:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801079:	89 c8                	mov    %ecx,%eax
+  80107b:	f7 d8                	neg    %eax
+  80107d:	85 ff                	test   %edi,%edi
+  80107f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801082:	89 c8                	mov    %ecx,%eax
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+
+00801089 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801089:	55                   	push   %ebp
+  80108a:	89 e5                	mov    %esp,%ebp
+  80108c:	57                   	push   %edi
+  80108d:	56                   	push   %esi
+  80108e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	89 c3                	mov    %eax,%ebx
+  80109c:	89 c7                	mov    %eax,%edi
+  80109e:	89 c6                	mov    %eax,%esi
+  8010a0:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010a2:	5b                   	pop    %ebx
+  8010a3:	5e                   	pop    %esi
+  8010a4:	5f                   	pop    %edi
+  8010a5:	5d                   	pop    %ebp
+  8010a6:	c3                   	ret
+
+008010a7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	57                   	push   %edi
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010b7:	89 d1                	mov    %edx,%ecx
+  8010b9:	89 d3                	mov    %edx,%ebx
+  8010bb:	89 d7                	mov    %edx,%edi
+  8010bd:	89 d6                	mov    %edx,%esi
+  8010bf:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8010c1:	5b                   	pop    %ebx
+  8010c2:	5e                   	pop    %esi
+  8010c3:	5f                   	pop    %edi
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	b8 03 00 00 00       	mov    $0x3,%eax
+  8010dc:	89 cb                	mov    %ecx,%ebx
+  8010de:	89 cf                	mov    %ecx,%edi
+  8010e0:	89 ce                	mov    %ecx,%esi
+  8010e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e4:	85 c0                	test   %eax,%eax
+  8010e6:	7f 08                	jg     8010f0 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010eb:	5b                   	pop    %ebx
+  8010ec:	5e                   	pop    %esi
+  8010ed:	5f                   	pop    %edi
+  8010ee:	5d                   	pop    %ebp
+  8010ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f0:	83 ec 0c             	sub    $0xc,%esp
+  8010f3:	50                   	push   %eax
+  8010f4:	6a 03                	push   $0x3
+  8010f6:	68 4b 4d 80 00       	push   $0x804d4b
+  8010fb:	6a 23                	push   $0x23
+  8010fd:	68 68 4d 80 00       	push   $0x804d68
+  801102:	e8 38 f4 ff ff       	call   80053f <_panic>
+
+00801107 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801107:	55                   	push   %ebp
+  801108:	89 e5                	mov    %esp,%ebp
+  80110a:	57                   	push   %edi
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801112:	b8 02 00 00 00       	mov    $0x2,%eax
+  801117:	89 d1                	mov    %edx,%ecx
+  801119:	89 d3                	mov    %edx,%ebx
+  80111b:	89 d7                	mov    %edx,%edi
+  80111d:	89 d6                	mov    %edx,%esi
+  80111f:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801121:	5b                   	pop    %ebx
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801136:	89 d1                	mov    %edx,%ecx
+  801138:	89 d3                	mov    %edx,%ebx
+  80113a:	89 d7                	mov    %edx,%edi
+  80113c:	89 d6                	mov    %edx,%esi
+  80113e:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80114e:	be 00 00 00 00       	mov    $0x0,%esi
+  801153:	8b 55 08             	mov    0x8(%ebp),%edx
+  801156:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801159:	b8 04 00 00 00       	mov    $0x4,%eax
+  80115e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801161:	89 f7                	mov    %esi,%edi
+  801163:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801165:	85 c0                	test   %eax,%eax
+  801167:	7f 08                	jg     801171 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801169:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116c:	5b                   	pop    %ebx
+  80116d:	5e                   	pop    %esi
+  80116e:	5f                   	pop    %edi
+  80116f:	5d                   	pop    %ebp
+  801170:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801171:	83 ec 0c             	sub    $0xc,%esp
+  801174:	50                   	push   %eax
+  801175:	6a 04                	push   $0x4
+  801177:	68 4b 4d 80 00       	push   $0x804d4b
+  80117c:	6a 23                	push   $0x23
+  80117e:	68 68 4d 80 00       	push   $0x804d68
+  801183:	e8 b7 f3 ff ff       	call   80053f <_panic>
+
+00801188 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801191:	8b 55 08             	mov    0x8(%ebp),%edx
+  801194:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801197:	b8 05 00 00 00       	mov    $0x5,%eax
+  80119c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011a2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	7f 08                	jg     8011b3 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	50                   	push   %eax
+  8011b7:	6a 05                	push   $0x5
+  8011b9:	68 4b 4d 80 00       	push   $0x804d4b
+  8011be:	6a 23                	push   $0x23
+  8011c0:	68 68 4d 80 00       	push   $0x804d68
+  8011c5:	e8 75 f3 ff ff       	call   80053f <_panic>
+
+008011ca <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	89 de                	mov    %ebx,%esi
+  8011e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 06                	push   $0x6
+  8011fb:	68 4b 4d 80 00       	push   $0x804d4b
+  801200:	6a 23                	push   $0x23
+  801202:	68 68 4d 80 00       	push   $0x804d68
+  801207:	e8 33 f3 ff ff       	call   80053f <_panic>
+
+0080120c <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  801212:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801215:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801220:	b8 08 00 00 00       	mov    $0x8,%eax
+  801225:	89 df                	mov    %ebx,%edi
+  801227:	89 de                	mov    %ebx,%esi
+  801229:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	7f 08                	jg     801237 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80122f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801232:	5b                   	pop    %ebx
+  801233:	5e                   	pop    %esi
+  801234:	5f                   	pop    %edi
+  801235:	5d                   	pop    %ebp
+  801236:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801237:	83 ec 0c             	sub    $0xc,%esp
+  80123a:	50                   	push   %eax
+  80123b:	6a 08                	push   $0x8
+  80123d:	68 4b 4d 80 00       	push   $0x804d4b
+  801242:	6a 23                	push   $0x23
+  801244:	68 68 4d 80 00       	push   $0x804d68
+  801249:	e8 f1 f2 ff ff       	call   80053f <_panic>
+
+0080124e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80124e:	55                   	push   %ebp
+  80124f:	89 e5                	mov    %esp,%ebp
+  801251:	57                   	push   %edi
+  801252:	56                   	push   %esi
+  801253:	53                   	push   %ebx
+  801254:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801257:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801262:	b8 09 00 00 00       	mov    $0x9,%eax
+  801267:	89 df                	mov    %ebx,%edi
+  801269:	89 de                	mov    %ebx,%esi
+  80126b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	7f 08                	jg     801279 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801274:	5b                   	pop    %ebx
+  801275:	5e                   	pop    %esi
+  801276:	5f                   	pop    %edi
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801279:	83 ec 0c             	sub    $0xc,%esp
+  80127c:	50                   	push   %eax
+  80127d:	6a 09                	push   $0x9
+  80127f:	68 4b 4d 80 00       	push   $0x804d4b
+  801284:	6a 23                	push   $0x23
+  801286:	68 68 4d 80 00       	push   $0x804d68
+  80128b:	e8 af f2 ff ff       	call   80053f <_panic>
+
+00801290 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+  801296:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801299:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80129e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012a9:	89 df                	mov    %ebx,%edi
+  8012ab:	89 de                	mov    %ebx,%esi
+  8012ad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012af:	85 c0                	test   %eax,%eax
+  8012b1:	7f 08                	jg     8012bb <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b6:	5b                   	pop    %ebx
+  8012b7:	5e                   	pop    %esi
+  8012b8:	5f                   	pop    %edi
+  8012b9:	5d                   	pop    %ebp
+  8012ba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bb:	83 ec 0c             	sub    $0xc,%esp
+  8012be:	50                   	push   %eax
+  8012bf:	6a 0a                	push   $0xa
+  8012c1:	68 4b 4d 80 00       	push   $0x804d4b
+  8012c6:	6a 23                	push   $0x23
+  8012c8:	68 68 4d 80 00       	push   $0x804d68
+  8012cd:	e8 6d f2 ff ff       	call   80053f <_panic>
+
+008012d2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	57                   	push   %edi
+  8012d6:	56                   	push   %esi
+  8012d7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012ee:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+  8012f8:	57                   	push   %edi
+  8012f9:	56                   	push   %esi
+  8012fa:	53                   	push   %ebx
+  8012fb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801303:	8b 55 08             	mov    0x8(%ebp),%edx
+  801306:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80130b:	89 cb                	mov    %ecx,%ebx
+  80130d:	89 cf                	mov    %ecx,%edi
+  80130f:	89 ce                	mov    %ecx,%esi
+  801311:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801313:	85 c0                	test   %eax,%eax
+  801315:	7f 08                	jg     80131f <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801317:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131a:	5b                   	pop    %ebx
+  80131b:	5e                   	pop    %esi
+  80131c:	5f                   	pop    %edi
+  80131d:	5d                   	pop    %ebp
+  80131e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80131f:	83 ec 0c             	sub    $0xc,%esp
+  801322:	50                   	push   %eax
+  801323:	6a 0d                	push   $0xd
+  801325:	68 4b 4d 80 00       	push   $0x804d4b
+  80132a:	6a 23                	push   $0x23
+  80132c:	68 68 4d 80 00       	push   $0x804d68
+  801331:	e8 09 f2 ff ff       	call   80053f <_panic>
+
+00801336 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801336:	55                   	push   %ebp
+  801337:	89 e5                	mov    %esp,%ebp
+  801339:	57                   	push   %edi
+  80133a:	56                   	push   %esi
+  80133b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801347:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80134a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80134d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801350:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  801352:	5b                   	pop    %ebx
+  801353:	5e                   	pop    %esi
+  801354:	5f                   	pop    %edi
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+
+00801357 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	57                   	push   %edi
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  80135d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801360:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801365:	8b 55 08             	mov    0x8(%ebp),%edx
+  801368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80136b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801370:	89 df                	mov    %ebx,%edi
+  801372:	89 de                	mov    %ebx,%esi
+  801374:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801376:	85 c0                	test   %eax,%eax
+  801378:	7f 08                	jg     801382 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  80137a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137d:	5b                   	pop    %ebx
+  80137e:	5e                   	pop    %esi
+  80137f:	5f                   	pop    %edi
+  801380:	5d                   	pop    %ebp
+  801381:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801382:	83 ec 0c             	sub    $0xc,%esp
+  801385:	50                   	push   %eax
+  801386:	6a 0d                	push   $0xd
+  801388:	68 4b 4d 80 00       	push   $0x804d4b
+  80138d:	6a 23                	push   $0x23
+  80138f:	68 68 4d 80 00       	push   $0x804d68
+  801394:	e8 a6 f1 ff ff       	call   80053f <_panic>
+
+00801399 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	57                   	push   %edi
+  80139d:	56                   	push   %esi
+  80139e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80139f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013a9:	89 d1                	mov    %edx,%ecx
+  8013ab:	89 d3                	mov    %edx,%ebx
+  8013ad:	89 d7                	mov    %edx,%edi
+  8013af:	89 d6                	mov    %edx,%esi
+  8013b1:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8013b3:	5b                   	pop    %ebx
+  8013b4:	5e                   	pop    %esi
+  8013b5:	5f                   	pop    %edi
+  8013b6:	5d                   	pop    %ebp
+  8013b7:	c3                   	ret
+
+008013b8 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  8013b8:	55                   	push   %ebp
+  8013b9:	89 e5                	mov    %esp,%ebp
+  8013bb:	57                   	push   %edi
+  8013bc:	56                   	push   %esi
+  8013bd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8013ce:	89 df                	mov    %ebx,%edi
+  8013d0:	89 de                	mov    %ebx,%esi
+  8013d2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  8013d4:	5b                   	pop    %ebx
+  8013d5:	5e                   	pop    %esi
+  8013d6:	5f                   	pop    %edi
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	c3                   	ret
+
+008013d9 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	57                   	push   %edi
+  8013dd:	56                   	push   %esi
+  8013de:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e7:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013ec:	89 cb                	mov    %ecx,%ebx
+  8013ee:	89 cf                	mov    %ecx,%edi
+  8013f0:	89 ce                	mov    %ecx,%esi
+  8013f2:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  8013f4:	5b                   	pop    %ebx
+  8013f5:	5e                   	pop    %esi
+  8013f6:	5f                   	pop    %edi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801404:	8b 55 08             	mov    0x8(%ebp),%edx
+  801407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80140f:	89 df                	mov    %ebx,%edi
+  801411:	89 de                	mov    %ebx,%esi
+  801413:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+
+0080141a <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80141a:	55                   	push   %ebp
+  80141b:	89 e5                	mov    %esp,%ebp
+  80141d:	57                   	push   %edi
+  80141e:	56                   	push   %esi
+  80141f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801425:	8b 55 08             	mov    0x8(%ebp),%edx
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	b8 12 00 00 00       	mov    $0x12,%eax
+  801430:	89 df                	mov    %ebx,%edi
+  801432:	89 de                	mov    %ebx,%esi
+  801434:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5f                   	pop    %edi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+
+0080143b <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801441:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801446:	8b 55 08             	mov    0x8(%ebp),%edx
+  801449:	b8 13 00 00 00       	mov    $0x13,%eax
+  80144e:	89 cb                	mov    %ecx,%ebx
+  801450:	89 cf                	mov    %ecx,%edi
+  801452:	89 ce                	mov    %ecx,%esi
+  801454:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5f                   	pop    %edi
+  801459:	5d                   	pop    %ebp
+  80145a:	c3                   	ret
+
+0080145b <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	57                   	push   %edi
+  80145f:	56                   	push   %esi
+  801460:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801461:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801466:	8b 55 08             	mov    0x8(%ebp),%edx
+  801469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146c:	b8 14 00 00 00       	mov    $0x14,%eax
+  801471:	89 df                	mov    %ebx,%edi
+  801473:	89 de                	mov    %ebx,%esi
+  801475:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801477:	5b                   	pop    %ebx
+  801478:	5e                   	pop    %esi
+  801479:	5f                   	pop    %edi
+  80147a:	5d                   	pop    %ebp
+  80147b:	c3                   	ret
+
+0080147c <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  80147c:	55                   	push   %ebp
+  80147d:	89 e5                	mov    %esp,%ebp
+  80147f:	57                   	push   %edi
+  801480:	56                   	push   %esi
+  801481:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80148f:	89 cb                	mov    %ecx,%ebx
+  801491:	89 cf                	mov    %ecx,%edi
+  801493:	89 ce                	mov    %ecx,%esi
+  801495:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ad:	b8 16 00 00 00       	mov    $0x16,%eax
+  8014b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b5:	89 f7                	mov    %esi,%edi
+  8014b7:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+
+008014be <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	57                   	push   %edi
+  8014c2:	56                   	push   %esi
+  8014c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014cf:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014d4:	89 df                	mov    %ebx,%edi
+  8014d6:	89 de                	mov    %ebx,%esi
+  8014d8:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8014da:	5b                   	pop    %ebx
+  8014db:	5e                   	pop    %esi
+  8014dc:	5f                   	pop    %edi
+  8014dd:	5d                   	pop    %ebp
+  8014de:	c3                   	ret
+
+008014df <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	57                   	push   %edi
+  8014e3:	56                   	push   %esi
+  8014e4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ed:	b8 18 00 00 00       	mov    $0x18,%eax
+  8014f2:	89 cb                	mov    %ecx,%ebx
+  8014f4:	89 cf                	mov    %ecx,%edi
+  8014f6:	89 ce                	mov    %ecx,%esi
+  8014f8:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  8014fa:	5b                   	pop    %ebx
+  8014fb:	5e                   	pop    %esi
+  8014fc:	5f                   	pop    %edi
+  8014fd:	5d                   	pop    %ebp
+  8014fe:	c3                   	ret
+
+008014ff <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  8014ff:	55                   	push   %ebp
+  801500:	89 e5                	mov    %esp,%ebp
+  801502:	57                   	push   %edi
+  801503:	56                   	push   %esi
+  801504:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801505:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801509:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801511:	b8 19 00 00 00       	mov    $0x19,%eax
+  801516:	89 df                	mov    %ebx,%edi
+  801518:	89 de                	mov    %ebx,%esi
+  80151a:	cd 30                	int    $0x30
+}
+  80151c:	5b                   	pop    %ebx
+  80151d:	5e                   	pop    %esi
+  80151e:	5f                   	pop    %edi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+
+00801521 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801521:	55                   	push   %ebp
+  801522:	89 e5                	mov    %esp,%ebp
+  801524:	57                   	push   %edi
+  801525:	56                   	push   %esi
+  801526:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+  80152c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801532:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801537:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80153a:	89 f7                	mov    %esi,%edi
+  80153c:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+
+00801543 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801549:	be 00 00 00 00       	mov    $0x0,%esi
+  80154e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801551:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801554:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801559:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80155c:	89 f7                	mov    %esi,%edi
+  80155e:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  801560:	5b                   	pop    %ebx
+  801561:	5e                   	pop    %esi
+  801562:	5f                   	pop    %edi
+  801563:	5d                   	pop    %ebp
+  801564:	c3                   	ret
+
+00801565 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	57                   	push   %edi
+  801569:	56                   	push   %esi
+  80156a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801576:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  80157b:	89 df                	mov    %ebx,%edi
+  80157d:	89 de                	mov    %ebx,%esi
+  80157f:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801581:	5b                   	pop    %ebx
+  801582:	5e                   	pop    %esi
+  801583:	5f                   	pop    %edi
+  801584:	5d                   	pop    %ebp
+  801585:	c3                   	ret
+
+00801586 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  801586:	55                   	push   %ebp
+  801587:	89 e5                	mov    %esp,%ebp
+  801589:	57                   	push   %edi
+  80158a:	56                   	push   %esi
+  80158b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80158c:	be 00 00 00 00       	mov    $0x0,%esi
+  801591:	8b 55 08             	mov    0x8(%ebp),%edx
+  801594:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801597:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80159c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159f:	89 f7                	mov    %esi,%edi
+  8015a1:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8015a3:	5b                   	pop    %ebx
+  8015a4:	5e                   	pop    %esi
+  8015a5:	5f                   	pop    %edi
+  8015a6:	5d                   	pop    %ebp
+  8015a7:	c3                   	ret
+
+008015a8 <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015a8:	85 c0                	test   %eax,%eax
+  8015aa:	74 20                	je     8015cc <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  8015ac:	89 c1                	mov    %eax,%ecx
+  8015ae:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015b4:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  8015ba:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8015c0:	8b 52 48             	mov    0x48(%edx),%edx
+  8015c3:	39 c2                	cmp    %eax,%edx
+  8015c5:	74 06                	je     8015cd <thread_alive+0x25>
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015cc:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  8015cd:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  8015d3:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  8015d9:	85 c0                	test   %eax,%eax
+  8015db:	0f 95 c0             	setne  %al
+  8015de:	0f b6 c0             	movzbl %al,%eax
+  8015e1:	c3                   	ret
+
+008015e2 <pgfault>:
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	57                   	push   %edi
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 0c             	sub    $0xc,%esp
+  8015eb:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8015ee:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  8015f0:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  8015f3:	89 f3                	mov    %esi,%ebx
+  8015f5:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  8015f8:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8015ff:	74 52                	je     801653 <pgfault+0x71>
+  801601:	a8 02                	test   $0x2,%al
+  801603:	75 14                	jne    801619 <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801605:	83 ec 04             	sub    $0x4,%esp
+  801608:	68 76 4d 80 00       	push   $0x804d76
+  80160d:	6a 2e                	push   $0x2e
+  80160f:	68 94 4d 80 00       	push   $0x804d94
+  801614:	e8 26 ef ff ff       	call   80053f <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  801619:	89 d8                	mov    %ebx,%eax
+  80161b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801620:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  801627:	83 ec 0c             	sub    $0xc,%esp
+  80162a:	57                   	push   %edi
+  80162b:	e8 9d 2c 00 00       	call   8042cd <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  801630:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801637:	83 e0 03             	and    $0x3,%eax
+  80163a:	83 c4 10             	add    $0x10,%esp
+  80163d:	83 f8 03             	cmp    $0x3,%eax
+  801640:	75 1a                	jne    80165c <pgfault+0x7a>
+			mutex_unlock(m);
+  801642:	83 ec 0c             	sub    $0xc,%esp
+  801645:	57                   	push   %edi
+  801646:	e8 f0 2c 00 00       	call   80433b <mutex_unlock>
+			return;
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	e9 9f 00 00 00       	jmp    8016f2 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  801653:	a8 02                	test   $0x2,%al
+  801655:	74 ae                	je     801605 <pgfault+0x23>
+	struct mutex *m = NULL;
+  801657:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  80165c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  801663:	f6 c4 08             	test   $0x8,%ah
+  801666:	74 9d                	je     801605 <pgfault+0x23>
+  801668:	89 e0                	mov    %esp,%eax
+  80166a:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80166f:	29 c2                	sub    %eax,%edx
+  801671:	89 d0                	mov    %edx,%eax
+  801673:	c1 e8 0f             	shr    $0xf,%eax
+  801676:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80167c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801681:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  801684:	c1 e0 0c             	shl    $0xc,%eax
+  801687:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  80168c:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  80168e:	83 ec 04             	sub    $0x4,%esp
+  801691:	6a 07                	push   $0x7
+  801693:	53                   	push   %ebx
+  801694:	6a 00                	push   $0x0
+  801696:	e8 aa fa ff ff       	call   801145 <sys_page_alloc>
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	78 58                	js     8016fa <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  8016a2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8016a8:	83 ec 04             	sub    $0x4,%esp
+  8016ab:	68 00 10 00 00       	push   $0x1000
+  8016b0:	56                   	push   %esi
+  8016b1:	53                   	push   %ebx
+  8016b2:	e8 0a f8 ff ff       	call   800ec1 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  8016b7:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016be:	56                   	push   %esi
+  8016bf:	6a 00                	push   $0x0
+  8016c1:	53                   	push   %ebx
+  8016c2:	6a 00                	push   $0x0
+  8016c4:	e8 bf fa ff ff       	call   801188 <sys_page_map>
+  8016c9:	83 c4 20             	add    $0x20,%esp
+  8016cc:	85 c0                	test   %eax,%eax
+  8016ce:	78 3c                	js     80170c <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	53                   	push   %ebx
+  8016d4:	6a 00                	push   $0x0
+  8016d6:	e8 ef fa ff ff       	call   8011ca <sys_page_unmap>
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 3c                	js     80171e <pgfault+0x13c>
+	if(m)
+  8016e2:	85 ff                	test   %edi,%edi
+  8016e4:	74 0c                	je     8016f2 <pgfault+0x110>
+		mutex_unlock(m);
+  8016e6:	83 ec 0c             	sub    $0xc,%esp
+  8016e9:	57                   	push   %edi
+  8016ea:	e8 4c 2c 00 00       	call   80433b <mutex_unlock>
+  8016ef:	83 c4 10             	add    $0x10,%esp
+}
+  8016f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5f                   	pop    %edi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  8016fa:	50                   	push   %eax
+  8016fb:	68 a9 48 80 00       	push   $0x8048a9
+  801700:	6a 3d                	push   $0x3d
+  801702:	68 94 4d 80 00       	push   $0x804d94
+  801707:	e8 33 ee ff ff       	call   80053f <_panic>
+		panic("sys_page_map: %e", ret);
+  80170c:	50                   	push   %eax
+  80170d:	68 9f 4d 80 00       	push   $0x804d9f
+  801712:	6a 40                	push   $0x40
+  801714:	68 94 4d 80 00       	push   $0x804d94
+  801719:	e8 21 ee ff ff       	call   80053f <_panic>
+		panic("sys_page_unmap: %e", ret);
+  80171e:	50                   	push   %eax
+  80171f:	68 b0 4d 80 00       	push   $0x804db0
+  801724:	6a 42                	push   $0x42
+  801726:	68 94 4d 80 00       	push   $0x804d94
+  80172b:	e8 0f ee ff ff       	call   80053f <_panic>
+
+00801730 <thread_main>:
+{
+  801730:	55                   	push   %ebp
+  801731:	89 e5                	mov    %esp,%ebp
+  801733:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  801736:	ff 75 0c             	push   0xc(%ebp)
+  801739:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  80173c:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801743:	e8 7e f9 ff ff       	call   8010c6 <sys_env_destroy>
+}
+  801748:	83 c4 10             	add    $0x10,%esp
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+0080174d <fork>:
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	57                   	push   %edi
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+  801753:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  801756:	68 e2 15 80 00       	push   $0x8015e2
+  80175b:	e8 b9 2e 00 00       	call   804619 <set_pgfault_handler>
+	if(sforked)
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  80176a:	75 33                	jne    80179f <fork+0x52>
+	__asm __volatile("int %2"
+  80176c:	b8 07 00 00 00       	mov    $0x7,%eax
+  801771:	cd 30                	int    $0x30
+  801773:	89 c7                	mov    %eax,%edi
+  801775:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  801777:	85 c0                	test   %eax,%eax
+  801779:	0f 88 b4 00 00 00    	js     801833 <fork+0xe6>
+	if(envid == 0) {
+  80177f:	0f 84 c3 00 00 00    	je     801848 <fork+0xfb>
+	pgbatch_init(&pb);
+  801785:	83 ec 0c             	sub    $0xc,%esp
+  801788:	68 20 63 80 00       	push   $0x806320
+  80178d:	e8 87 29 00 00       	call   804119 <pgbatch_init>
+  801792:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801795:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179a:	e9 9c 01 00 00       	jmp    80193b <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  80179f:	83 ec 0c             	sub    $0xc,%esp
+  8017a2:	68 c0 66 80 00       	push   $0x8066c0
+  8017a7:	e8 21 2b 00 00       	call   8042cd <mutex_lock>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  8017af:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8017b4:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  8017b9:	eb 08                	jmp    8017c3 <fork+0x76>
+  8017bb:	83 c3 01             	add    $0x1,%ebx
+  8017be:	83 fb 20             	cmp    $0x20,%ebx
+  8017c1:	74 5b                	je     80181e <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  8017c3:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  8017ca:	89 f0                	mov    %esi,%eax
+  8017cc:	e8 d7 fd ff ff       	call   8015a8 <thread_alive>
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	74 e6                	je     8017bb <fork+0x6e>
+  8017d5:	89 e0                	mov    %esp,%eax
+  8017d7:	89 fa                	mov    %edi,%edx
+  8017d9:	29 c2                	sub    %eax,%edx
+  8017db:	89 d0                	mov    %edx,%eax
+  8017dd:	c1 e8 0f             	shr    $0xf,%eax
+  8017e0:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8017e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017eb:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  8017ee:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8017f5:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  8017f8:	83 ec 08             	sub    $0x8,%esp
+  8017fb:	50                   	push   %eax
+  8017fc:	56                   	push   %esi
+  8017fd:	e8 8e fa ff ff       	call   801290 <sys_env_set_pgfault_upcall>
+  801802:	83 c4 10             	add    $0x10,%esp
+  801805:	85 c0                	test   %eax,%eax
+  801807:	79 b2                	jns    8017bb <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  801809:	50                   	push   %eax
+  80180a:	68 3c 4e 80 00       	push   $0x804e3c
+  80180f:	68 00 01 00 00       	push   $0x100
+  801814:	68 94 4d 80 00       	push   $0x804d94
+  801819:	e8 21 ed ff ff       	call   80053f <_panic>
+	mutex_unlock(&sfork_lock);
+  80181e:	83 ec 0c             	sub    $0xc,%esp
+  801821:	68 c0 66 80 00       	push   $0x8066c0
+  801826:	e8 10 2b 00 00       	call   80433b <mutex_unlock>
+}
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	e9 39 ff ff ff       	jmp    80176c <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  801833:	50                   	push   %eax
+  801834:	68 c3 4d 80 00       	push   $0x804dc3
+  801839:	68 91 00 00 00       	push   $0x91
+  80183e:	68 94 4d 80 00       	push   $0x804d94
+  801843:	e8 f7 ec ff ff       	call   80053f <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801848:	e8 ba f8 ff ff       	call   801107 <sys_getenvid>
+  80184d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801852:	89 e1                	mov    %esp,%ecx
+  801854:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  801859:	29 ca                	sub    %ecx,%edx
+  80185b:	89 d1                	mov    %edx,%ecx
+  80185d:	c1 e9 0f             	shr    $0xf,%ecx
+  801860:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186b:	0f 42 d1             	cmovb  %ecx,%edx
+  80186e:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801874:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801879:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  801880:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  801885:	85 c0                	test   %eax,%eax
+  801887:	75 07                	jne    801890 <fork+0x143>
+		return 0;
+  801889:	89 c6                	mov    %eax,%esi
+  80188b:	e9 6f 02 00 00       	jmp    801aff <fork+0x3b2>
+  801890:	89 e2                	mov    %esp,%edx
+  801892:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801897:	29 d0                	sub    %edx,%eax
+  801899:	89 c3                	mov    %eax,%ebx
+  80189b:	c1 eb 0f             	shr    $0xf,%ebx
+  80189e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+  8018ae:	68 80 00 00 00       	push   $0x80
+  8018b3:	6a 00                	push   $0x0
+  8018b5:	68 40 66 80 00       	push   $0x806640
+  8018ba:	e8 cd f5 ff ff       	call   800e8c <memset>
+	thread_ids[slot] = sys_getenvid();
+  8018bf:	e8 43 f8 ff ff       	call   801107 <sys_getenvid>
+  8018c4:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  8018cb:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  8018d2:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  8018d7:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  8018de:	e8 dc 29 00 00       	call   8042bf <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8018e3:	83 c4 0c             	add    $0xc,%esp
+  8018e6:	68 07 04 00 00       	push   $0x407
+  8018eb:	68 00 00 00 e1       	push   $0xe1000000
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	e8 4e f8 ff ff       	call   801145 <sys_page_alloc>
+  8018f7:	83 c4 10             	add    $0x10,%esp
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	0f 89 fd 01 00 00    	jns    801aff <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801902:	50                   	push   %eax
+  801903:	68 a9 48 80 00       	push   $0x8048a9
+  801908:	68 12 01 00 00       	push   $0x112
+  80190d:	68 94 4d 80 00       	push   $0x804d94
+  801912:	e8 28 ec ff ff       	call   80053f <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  801917:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  80191d:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801923:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801929:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80192f:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  801935:	0f 87 4f 01 00 00    	ja     801a8a <fork+0x33d>
+		pd = PDX(addr);
+  80193b:	89 d8                	mov    %ebx,%eax
+  80193d:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  801940:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801947:	f6 c2 01             	test   $0x1,%dl
+  80194a:	74 cb                	je     801917 <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  80194c:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  801951:	0f 85 92 00 00 00    	jne    8019e9 <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  801957:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  80195d:	76 10                	jbe    80196f <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  80195f:	89 d8                	mov    %ebx,%eax
+  801961:	f7 d8                	neg    %eax
+  801963:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801968:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80196d:	74 ba                	je     801929 <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  80196f:	89 d8                	mov    %ebx,%eax
+  801971:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801974:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80197b:	f6 c2 01             	test   $0x1,%dl
+  80197e:	74 a9                	je     801929 <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  801980:	89 c1                	mov    %eax,%ecx
+  801982:	c1 e1 0c             	shl    $0xc,%ecx
+  801985:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  801988:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80198f:	f6 c6 04             	test   $0x4,%dh
+  801992:	0f 85 8e 00 00 00    	jne    801a26 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  801998:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80199f:	f6 c6 08             	test   $0x8,%dh
+  8019a2:	75 0f                	jne    8019b3 <fork+0x266>
+  8019a4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019ab:	a8 02                	test   $0x2,%al
+  8019ad:	0f 84 bb 00 00 00    	je     801a6e <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  8019b3:	83 ec 08             	sub    $0x8,%esp
+  8019b6:	68 05 08 00 00       	push   $0x805
+  8019bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019be:	50                   	push   %eax
+  8019bf:	56                   	push   %esi
+  8019c0:	50                   	push   %eax
+  8019c1:	6a 00                	push   $0x0
+  8019c3:	68 20 63 80 00       	push   $0x806320
+  8019c8:	e8 0a 28 00 00       	call   8041d7 <pgbatch_map>
+  8019cd:	83 c4 20             	add    $0x20,%esp
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	79 76                	jns    801a4a <fork+0x2fd>
+			panic("duppage: %e", ret);
+  8019d4:	50                   	push   %eax
+  8019d5:	68 e7 4d 80 00       	push   $0x804de7
+  8019da:	68 bc 00 00 00       	push   $0xbc
+  8019df:	68 94 4d 80 00       	push   $0x804d94
+  8019e4:	e8 56 eb ff ff       	call   80053f <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  8019e9:	83 ec 0c             	sub    $0xc,%esp
+  8019ec:	68 00 08 00 00       	push   $0x800
+  8019f1:	56                   	push   %esi
+  8019f2:	53                   	push   %ebx
+  8019f3:	6a 00                	push   $0x0
+  8019f5:	68 20 63 80 00       	push   $0x806320
+  8019fa:	e8 83 28 00 00       	call   804282 <pgbatch_sharept>
+  8019ff:	83 c4 20             	add    $0x20,%esp
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 0b                	js     801a11 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801a06:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  801a0c:	e9 18 ff ff ff       	jmp    801929 <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801a11:	50                   	push   %eax
+  801a12:	68 d3 4d 80 00       	push   $0x804dd3
+  801a17:	68 b2 00 00 00       	push   $0xb2
+  801a1c:	68 94 4d 80 00       	push   $0x804d94
+  801a21:	e8 19 eb ff ff       	call   80053f <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801a26:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a2d:	83 ec 08             	sub    $0x8,%esp
+  801a30:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a35:	50                   	push   %eax
+  801a36:	51                   	push   %ecx
+  801a37:	56                   	push   %esi
+  801a38:	51                   	push   %ecx
+  801a39:	6a 00                	push   $0x0
+  801a3b:	68 20 63 80 00       	push   $0x806320
+  801a40:	e8 92 27 00 00       	call   8041d7 <pgbatch_map>
+  801a45:	83 c4 20             	add    $0x20,%esp
+  801a48:	eb 17                	jmp    801a61 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  801a4a:	68 05 08 00 00       	push   $0x805
+  801a4f:	ff 75 e4             	push   -0x1c(%ebp)
+  801a52:	6a 00                	push   $0x0
+  801a54:	68 20 63 80 00       	push   $0x806320
+  801a59:	e8 ed 27 00 00       	call   80424b <pgbatch_protect>
+  801a5e:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	0f 89 c0 fe ff ff    	jns    801929 <fork+0x1dc>
+  801a69:	e9 66 ff ff ff       	jmp    8019d4 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	6a 05                	push   $0x5
+  801a73:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a76:	50                   	push   %eax
+  801a77:	56                   	push   %esi
+  801a78:	50                   	push   %eax
+  801a79:	6a 00                	push   $0x0
+  801a7b:	68 20 63 80 00       	push   $0x806320
+  801a80:	e8 52 27 00 00       	call   8041d7 <pgbatch_map>
+  801a85:	83 c4 20             	add    $0x20,%esp
+  801a88:	eb d7                	jmp    801a61 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  801a8a:	6a 07                	push   $0x7
+  801a8c:	68 00 f0 bf ee       	push   $0xeebff000
+  801a91:	57                   	push   %edi
+  801a92:	68 20 63 80 00       	push   $0x806320
+  801a97:	e8 04 27 00 00       	call   8041a0 <pgbatch_alloc>
+  801a9c:	83 c4 10             	add    $0x10,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	78 66                	js     801b09 <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801aa3:	83 ec 0c             	sub    $0xc,%esp
+  801aa6:	68 20 63 80 00       	push   $0x806320
+  801aab:	e8 77 26 00 00       	call   804127 <pgbatch_flush>
+  801ab0:	83 c4 10             	add    $0x10,%esp
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 52                	js     801b09 <fork+0x3bc>
+  801ab7:	89 e2                	mov    %esp,%edx
+  801ab9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801abe:	29 d0                	sub    %edx,%eax
+  801ac0:	89 c2                	mov    %eax,%edx
+  801ac2:	c1 ea 0f             	shr    $0xf,%edx
+  801ac5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acf:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801ad2:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ad9:	8b 40 78             	mov    0x78(%eax),%eax
+  801adc:	83 ec 08             	sub    $0x8,%esp
+  801adf:	50                   	push   %eax
+  801ae0:	57                   	push   %edi
+  801ae1:	e8 aa f7 ff ff       	call   801290 <sys_env_set_pgfault_upcall>
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 31                	js     801b1e <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801aed:	83 ec 08             	sub    $0x8,%esp
+  801af0:	6a 02                	push   $0x2
+  801af2:	57                   	push   %edi
+  801af3:	e8 14 f7 ff ff       	call   80120c <sys_env_set_status>
+  801af8:	83 c4 10             	add    $0x10,%esp
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 34                	js     801b33 <fork+0x3e6>
+}
+  801aff:	89 f0                	mov    %esi,%eax
+  801b01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b04:	5b                   	pop    %ebx
+  801b05:	5e                   	pop    %esi
+  801b06:	5f                   	pop    %edi
+  801b07:	5d                   	pop    %ebp
+  801b08:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  801b09:	50                   	push   %eax
+  801b0a:	68 f3 4d 80 00       	push   $0x804df3
+  801b0f:	68 c0 00 00 00       	push   $0xc0
+  801b14:	68 94 4d 80 00       	push   $0x804d94
+  801b19:	e8 21 ea ff ff       	call   80053f <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801b1e:	50                   	push   %eax
+  801b1f:	68 08 4e 80 00       	push   $0x804e08
+  801b24:	68 c2 00 00 00       	push   $0xc2
+  801b29:	68 94 4d 80 00       	push   $0x804d94
+  801b2e:	e8 0c ea ff ff       	call   80053f <_panic>
+		panic("sys_env_set_status: %e", ret);
+  801b33:	50                   	push   %eax
+  801b34:	68 23 4e 80 00       	push   $0x804e23
+  801b39:	68 c4 00 00 00       	push   $0xc4
+  801b3e:	68 94 4d 80 00       	push   $0x804d94
+  801b43:	e8 f7 e9 ff ff       	call   80053f <_panic>
+
+00801b48 <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  801b48:	55                   	push   %ebp
+  801b49:	89 e5                	mov    %esp,%ebp
+  801b4b:	57                   	push   %edi
+  801b4c:	56                   	push   %esi
+  801b4d:	53                   	push   %ebx
+  801b4e:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801b51:	68 c0 66 80 00       	push   $0x8066c0
+  801b56:	e8 72 27 00 00       	call   8042cd <mutex_lock>
+  801b5b:	89 e2                	mov    %esp,%edx
+  801b5d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801b62:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  801b64:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801b67:	89 c3                	mov    %eax,%ebx
+  801b69:	c1 eb 0f             	shr    $0xf,%ebx
+  801b6c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b76:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  801b79:	e8 89 f5 ff ff       	call   801107 <sys_getenvid>
+  801b7e:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  801b85:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801b8a:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801b91:	e8 12 fa ff ff       	call   8015a8 <thread_alive>
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	74 24                	je     801bbe <sfork+0x76>
+  801b9a:	83 c3 01             	add    $0x1,%ebx
+  801b9d:	83 fb 20             	cmp    $0x20,%ebx
+  801ba0:	75 e8                	jne    801b8a <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801ba2:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801ba7:	83 ec 0c             	sub    $0xc,%esp
+  801baa:	68 c0 66 80 00       	push   $0x8066c0
+  801baf:	e8 87 27 00 00       	call   80433b <mutex_unlock>
+	return r;
+}
+  801bb4:	89 f0                	mov    %esi,%eax
+  801bb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bb9:	5b                   	pop    %ebx
+  801bba:	5e                   	pop    %esi
+  801bbb:	5f                   	pop    %edi
+  801bbc:	5d                   	pop    %ebp
+  801bbd:	c3                   	ret
+	if (i == NTHREADS) {
+  801bbe:	83 fb 20             	cmp    $0x20,%ebx
+  801bc1:	0f 84 53 01 00 00    	je     801d1a <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801bc7:	89 d8                	mov    %ebx,%eax
+  801bc9:	c1 e0 0f             	shl    $0xf,%eax
+  801bcc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801bcf:	83 ec 0c             	sub    $0xc,%esp
+  801bd2:	68 00 60 80 00       	push   $0x806000
+  801bd7:	e8 3d 25 00 00       	call   804119 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801bdc:	83 c4 10             	add    $0x10,%esp
+  801bdf:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801be6:	75 1f                	jne    801c07 <sfork+0xbf>
+  801be8:	68 07 04 00 00       	push   $0x407
+  801bed:	68 00 00 00 e1       	push   $0xe1000000
+  801bf2:	6a 00                	push   $0x0
+  801bf4:	68 00 60 80 00       	push   $0x806000
+  801bf9:	e8 a2 25 00 00       	call   8041a0 <pgbatch_alloc>
+  801bfe:	89 c6                	mov    %eax,%esi
+  801c00:	83 c4 10             	add    $0x10,%esp
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 a0                	js     801ba7 <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801c07:	6a 07                	push   $0x7
+  801c09:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801c0e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c11:	29 c8                	sub    %ecx,%eax
+  801c13:	50                   	push   %eax
+  801c14:	6a 00                	push   $0x0
+  801c16:	68 00 60 80 00       	push   $0x806000
+  801c1b:	e8 80 25 00 00       	call   8041a0 <pgbatch_alloc>
+  801c20:	89 c6                	mov    %eax,%esi
+  801c22:	83 c4 10             	add    $0x10,%esp
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	0f 88 7a ff ff ff    	js     801ba7 <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801c2d:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801c32:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c35:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c37:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801c3c:	29 c8                	sub    %ecx,%eax
+  801c3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c41:	39 c7                	cmp    %eax,%edi
+  801c43:	73 29                	jae    801c6e <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801c45:	6a 07                	push   $0x7
+  801c47:	57                   	push   %edi
+  801c48:	6a 00                	push   $0x0
+  801c4a:	68 00 60 80 00       	push   $0x806000
+  801c4f:	e8 4c 25 00 00       	call   8041a0 <pgbatch_alloc>
+  801c54:	89 c6                	mov    %eax,%esi
+  801c56:	83 c4 10             	add    $0x10,%esp
+  801c59:	85 c0                	test   %eax,%eax
+  801c5b:	0f 88 46 ff ff ff    	js     801ba7 <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801c61:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801c67:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c6a:	39 c7                	cmp    %eax,%edi
+  801c6c:	72 d7                	jb     801c45 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801c6e:	83 ec 0c             	sub    $0xc,%esp
+  801c71:	68 00 60 80 00       	push   $0x806000
+  801c76:	e8 ac 24 00 00       	call   804127 <pgbatch_flush>
+  801c7b:	89 c6                	mov    %eax,%esi
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	0f 88 1f ff ff ff    	js     801ba7 <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801c88:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801c8d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c90:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801c92:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801c98:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c9b:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801c9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ca1:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801ca4:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801ca7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801cac:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801cae:	52                   	push   %edx
+  801caf:	50                   	push   %eax
+  801cb0:	68 30 17 80 00       	push   $0x801730
+  801cb5:	e8 cc f8 ff ff       	call   801586 <sys_exofork_shared>
+  801cba:	89 c6                	mov    %eax,%esi
+  801cbc:	83 c4 10             	add    $0x10,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	0f 88 e0 fe ff ff    	js     801ba7 <sfork+0x5f>
+	thread_ids[i] = id;
+  801cc7:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801cce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801cd3:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801cd9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801cde:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801ce5:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801cec:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801cef:	83 ec 08             	sub    $0x8,%esp
+  801cf2:	6a 02                	push   $0x2
+  801cf4:	56                   	push   %esi
+  801cf5:	e8 12 f5 ff ff       	call   80120c <sys_env_set_status>
+  801cfa:	89 c3                	mov    %eax,%ebx
+  801cfc:	83 c4 10             	add    $0x10,%esp
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	0f 89 a0 fe ff ff    	jns    801ba7 <sfork+0x5f>
+		sys_env_destroy(id);
+  801d07:	83 ec 0c             	sub    $0xc,%esp
+  801d0a:	56                   	push   %esi
+  801d0b:	e8 b6 f3 ff ff       	call   8010c6 <sys_env_destroy>
+		goto out;
+  801d10:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801d13:	89 de                	mov    %ebx,%esi
+		goto out;
+  801d15:	e9 8d fe ff ff       	jmp    801ba7 <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801d1a:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801d1f:	e9 83 fe ff ff       	jmp    801ba7 <sfork+0x5f>
+
+00801d24 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	56                   	push   %esi
+  801d28:	53                   	push   %ebx
+  801d29:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d2c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801d39:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  801d3c:	83 ec 0c             	sub    $0xc,%esp
+  801d3f:	50                   	push   %eax
+  801d40:	e8 b0 f5 ff ff       	call   8012f5 <sys_ipc_recv>
+  801d45:	83 c4 10             	add    $0x10,%esp
+  801d48:	85 c0                	test   %eax,%eax
+  801d4a:	0f 88 8b 00 00 00    	js     801ddb <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  801d50:	85 f6                	test   %esi,%esi
+  801d52:	74 2a                	je     801d7e <ipc_recv+0x5a>
+  801d54:	89 e2                	mov    %esp,%edx
+  801d56:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d5b:	29 d0                	sub    %edx,%eax
+  801d5d:	89 c2                	mov    %eax,%edx
+  801d5f:	c1 ea 0f             	shr    $0xf,%edx
+  801d62:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d67:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6c:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801d6f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801d76:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801d7c:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  801d7e:	85 db                	test   %ebx,%ebx
+  801d80:	74 2a                	je     801dac <ipc_recv+0x88>
+  801d82:	89 e2                	mov    %esp,%edx
+  801d84:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801d89:	29 d0                	sub    %edx,%eax
+  801d8b:	89 c2                	mov    %eax,%edx
+  801d8d:	c1 ea 0f             	shr    $0xf,%edx
+  801d90:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9a:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801d9d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801da4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801daa:	89 03                	mov    %eax,(%ebx)
+  801dac:	89 e2                	mov    %esp,%edx
+  801dae:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801db3:	29 d0                	sub    %edx,%eax
+  801db5:	89 c2                	mov    %eax,%edx
+  801db7:	c1 ea 0f             	shr    $0xf,%edx
+  801dba:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dc4:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801dc7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801dce:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  801dd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dd7:	5b                   	pop    %ebx
+  801dd8:	5e                   	pop    %esi
+  801dd9:	5d                   	pop    %ebp
+  801dda:	c3                   	ret
+		if(from_env_store != NULL)
+  801ddb:	85 f6                	test   %esi,%esi
+  801ddd:	74 06                	je     801de5 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  801ddf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  801de5:	85 db                	test   %ebx,%ebx
+  801de7:	74 eb                	je     801dd4 <ipc_recv+0xb0>
+			*perm_store = 0;
+  801de9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801def:	eb e3                	jmp    801dd4 <ipc_recv+0xb0>
+
+00801df1 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	57                   	push   %edi
+  801df5:	56                   	push   %esi
+  801df6:	53                   	push   %ebx
+  801df7:	83 ec 14             	sub    $0x14,%esp
+  801dfa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e00:	8b 75 14             	mov    0x14(%ebp),%esi
+  801e03:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  801e0d:	0f 44 c2             	cmove  %edx,%eax
+  801e10:	ff 75 10             	push   0x10(%ebp)
+  801e13:	50                   	push   %eax
+  801e14:	e8 3e f5 ff ff       	call   801357 <sys_ipc_recv_pages>
+  801e19:	83 c4 10             	add    $0x10,%esp
+  801e1c:	85 c0                	test   %eax,%eax
+  801e1e:	0f 88 ba 00 00 00    	js     801ede <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  801e24:	85 ff                	test   %edi,%edi
+  801e26:	74 2a                	je     801e52 <ipc_recv_pages+0x61>
+  801e28:	89 e2                	mov    %esp,%edx
+  801e2a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e2f:	29 d0                	sub    %edx,%eax
+  801e31:	89 c2                	mov    %eax,%edx
+  801e33:	c1 ea 0f             	shr    $0xf,%edx
+  801e36:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e40:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  801e43:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e4a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801e50:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  801e52:	85 f6                	test   %esi,%esi
+  801e54:	74 2a                	je     801e80 <ipc_recv_pages+0x8f>
+  801e56:	89 e2                	mov    %esp,%edx
+  801e58:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e5d:	29 d0                	sub    %edx,%eax
+  801e5f:	89 c2                	mov    %eax,%edx
+  801e61:	c1 ea 0f             	shr    $0xf,%edx
+  801e64:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  801e71:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801e78:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801e7e:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  801e80:	85 db                	test   %ebx,%ebx
+  801e82:	74 2a                	je     801eae <ipc_recv_pages+0xbd>
+  801e84:	89 e2                	mov    %esp,%edx
+  801e86:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801e8b:	29 d0                	sub    %edx,%eax
+  801e8d:	89 c2                	mov    %eax,%edx
+  801e8f:	c1 ea 0f             	shr    $0xf,%edx
+  801e92:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e9c:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  801e9f:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ea6:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  801eac:	89 03                	mov    %eax,(%ebx)
+  801eae:	89 e2                	mov    %esp,%edx
+  801eb0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801eb5:	29 d0                	sub    %edx,%eax
+  801eb7:	89 c2                	mov    %eax,%edx
+  801eb9:	c1 ea 0f             	shr    $0xf,%edx
+  801ebc:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ec6:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  801ec9:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ed0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  801ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed9:	5b                   	pop    %ebx
+  801eda:	5e                   	pop    %esi
+  801edb:	5f                   	pop    %edi
+  801edc:	5d                   	pop    %ebp
+  801edd:	c3                   	ret
+		if (from_env_store)
+  801ede:	85 ff                	test   %edi,%edi
+  801ee0:	74 06                	je     801ee8 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  801ee2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  801ee8:	85 f6                	test   %esi,%esi
+  801eea:	74 06                	je     801ef2 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  801eec:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  801ef2:	85 db                	test   %ebx,%ebx
+  801ef4:	74 e0                	je     801ed6 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  801ef6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801efc:	eb d8                	jmp    801ed6 <ipc_recv_pages+0xe5>
+
+00801efe <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  801efe:	55                   	push   %ebp
+  801eff:	89 e5                	mov    %esp,%ebp
+  801f01:	57                   	push   %edi
+  801f02:	56                   	push   %esi
+  801f03:	53                   	push   %ebx
+  801f04:	83 ec 1c             	sub    $0x1c,%esp
+  801f07:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  801f0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f0d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801f13:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  801f17:	75 2b                	jne    801f44 <ipc_try_send_pages+0x46>
+  801f19:	89 e2                	mov    %esp,%edx
+  801f1b:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801f20:	29 d0                	sub    %edx,%eax
+  801f22:	89 c2                	mov    %eax,%edx
+  801f24:	c1 ea 0f             	shr    $0xf,%edx
+  801f27:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f31:	0f 42 c2             	cmovb  %edx,%eax
+  801f34:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801f3b:	8b 70 48             	mov    0x48(%eax),%esi
+  801f3e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  801f44:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  801f4a:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  801f4f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801f52:	85 ff                	test   %edi,%edi
+  801f54:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801f59:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  801f5c:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  801f62:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  801f68:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  801f6e:	83 ec 0c             	sub    $0xc,%esp
+  801f71:	ff 75 14             	push   0x14(%ebp)
+  801f74:	ff 75 18             	push   0x18(%ebp)
+  801f77:	57                   	push   %edi
+  801f78:	ff 75 0c             	push   0xc(%ebp)
+  801f7b:	ff 75 08             	push   0x8(%ebp)
+  801f7e:	e8 b3 f3 ff ff       	call   801336 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  801f83:	83 c4 20             	add    $0x20,%esp
+  801f86:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f89:	75 21                	jne    801fac <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  801f8b:	83 ec 04             	sub    $0x4,%esp
+  801f8e:	6a ff                	push   $0xffffffff
+  801f90:	53                   	push   %ebx
+  801f91:	ff 75 e4             	push   -0x1c(%ebp)
+  801f94:	e8 aa f5 ff ff       	call   801543 <sys_futex_wait>
+  801f99:	83 c4 10             	add    $0x10,%esp
+  801f9c:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  801f9f:	74 c7                	je     801f68 <ipc_try_send_pages+0x6a>
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	79 c3                	jns    801f68 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  801fa5:	e8 7c f1 ff ff       	call   801126 <sys_yield>
+  801faa:	eb bc                	jmp    801f68 <ipc_try_send_pages+0x6a>
+	}
+}
+  801fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801faf:	5b                   	pop    %ebx
+  801fb0:	5e                   	pop    %esi
+  801fb1:	5f                   	pop    %edi
+  801fb2:	5d                   	pop    %ebp
+  801fb3:	c3                   	ret
+
+00801fb4 <ipc_send>:
+{
+  801fb4:	55                   	push   %ebp
+  801fb5:	89 e5                	mov    %esp,%ebp
+  801fb7:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  801fba:	ff 75 14             	push   0x14(%ebp)
+  801fbd:	6a 01                	push   $0x1
+  801fbf:	ff 75 10             	push   0x10(%ebp)
+  801fc2:	ff 75 0c             	push   0xc(%ebp)
+  801fc5:	ff 75 08             	push   0x8(%ebp)
+  801fc8:	e8 31 ff ff ff       	call   801efe <ipc_try_send_pages>
+  801fcd:	83 c4 20             	add    $0x20,%esp
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 02                	js     801fd6 <ipc_send+0x22>
+}
+  801fd4:	c9                   	leave
+  801fd5:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  801fd6:	50                   	push   %eax
+  801fd7:	68 5b 4e 80 00       	push   $0x804e5b
+  801fdc:	6a 3f                	push   $0x3f
+  801fde:	68 70 4e 80 00       	push   $0x804e70
+  801fe3:	e8 57 e5 ff ff       	call   80053f <_panic>
+
+00801fe8 <ipc_send_pages>:
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  801fee:	ff 75 18             	push   0x18(%ebp)
+  801ff1:	ff 75 14             	push   0x14(%ebp)
+  801ff4:	ff 75 10             	push   0x10(%ebp)
+  801ff7:	ff 75 0c             	push   0xc(%ebp)
+  801ffa:	ff 75 08             	push   0x8(%ebp)
+  801ffd:	e8 fc fe ff ff       	call   801efe <ipc_try_send_pages>
+  802002:	83 c4 20             	add    $0x20,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 02                	js     80200b <ipc_send_pages+0x23>
+}
+  802009:	c9                   	leave
+  80200a:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80200b:	50                   	push   %eax
+  80200c:	68 7a 4e 80 00       	push   $0x804e7a
+  802011:	6a 64                	push   $0x64
+  802013:	68 70 4e 80 00       	push   $0x804e70
+  802018:	e8 22 e5 ff ff       	call   80053f <_panic>
+
+0080201d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80201d:	55                   	push   %ebp
+  80201e:	89 e5                	mov    %esp,%ebp
+  802020:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  802028:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  80202e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802034:	8b 52 50             	mov    0x50(%edx),%edx
+  802037:	39 ca                	cmp    %ecx,%edx
+  802039:	74 11                	je     80204c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80203b:	83 c0 01             	add    $0x1,%eax
+  80203e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802043:	75 e3                	jne    802028 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802045:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204a:	eb 0e                	jmp    80205a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80204c:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  802052:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802057:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80205a:	5d                   	pop    %ebp
+  80205b:	c3                   	ret
+
+0080205c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80205f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802062:	05 00 00 00 30       	add    $0x30000000,%eax
+  802067:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80206a:	5d                   	pop    %ebp
+  80206b:	c3                   	ret
+
+0080206c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80206c:	55                   	push   %ebp
+  80206d:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80206f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802072:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  802077:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80207c:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  802081:	5d                   	pop    %ebp
+  802082:	c3                   	ret
+
+00802083 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802083:	55                   	push   %ebp
+  802084:	89 e5                	mov    %esp,%ebp
+  802086:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  80208b:	89 c2                	mov    %eax,%edx
+  80208d:	c1 ea 16             	shr    $0x16,%edx
+  802090:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802097:	f6 c2 01             	test   $0x1,%dl
+  80209a:	74 29                	je     8020c5 <fd_alloc+0x42>
+  80209c:	89 c2                	mov    %eax,%edx
+  80209e:	c1 ea 0c             	shr    $0xc,%edx
+  8020a1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020a8:	f6 c2 01             	test   $0x1,%dl
+  8020ab:	74 18                	je     8020c5 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  8020ad:	05 00 10 00 00       	add    $0x1000,%eax
+  8020b2:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  8020b7:	75 d2                	jne    80208b <fd_alloc+0x8>
+  8020b9:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8020be:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8020c3:	eb 05                	jmp    8020ca <fd_alloc+0x47>
+			return 0;
+  8020c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8020ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020cd:	89 02                	mov    %eax,(%edx)
+}
+  8020cf:	89 c8                	mov    %ecx,%eax
+  8020d1:	5d                   	pop    %ebp
+  8020d2:	c3                   	ret
+
+008020d3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8020d9:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  8020de:	77 30                	ja     802110 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8020e0:	c1 e0 0c             	shl    $0xc,%eax
+  8020e3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  8020e8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8020ee:	f6 c2 01             	test   $0x1,%dl
+  8020f1:	74 24                	je     802117 <fd_lookup+0x44>
+  8020f3:	89 c2                	mov    %eax,%edx
+  8020f5:	c1 ea 0c             	shr    $0xc,%edx
+  8020f8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8020ff:	f6 c2 01             	test   $0x1,%dl
+  802102:	74 1a                	je     80211e <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  802104:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802107:	89 02                	mov    %eax,(%edx)
+	return 0;
+  802109:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80210e:	5d                   	pop    %ebp
+  80210f:	c3                   	ret
+		return -E_INVAL;
+  802110:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802115:	eb f7                	jmp    80210e <fd_lookup+0x3b>
+		return -E_INVAL;
+  802117:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80211c:	eb f0                	jmp    80210e <fd_lookup+0x3b>
+  80211e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802123:	eb e9                	jmp    80210e <fd_lookup+0x3b>
+
+00802125 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  802125:	55                   	push   %ebp
+  802126:	89 e5                	mov    %esp,%ebp
+  802128:	53                   	push   %ebx
+  802129:	83 ec 04             	sub    $0x4,%esp
+  80212c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  80212f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802134:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  802139:	39 13                	cmp    %edx,(%ebx)
+  80213b:	74 54                	je     802191 <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  80213d:	83 c0 01             	add    $0x1,%eax
+  802140:	8b 1c 85 14 4f 80 00 	mov    0x804f14(,%eax,4),%ebx
+  802147:	85 db                	test   %ebx,%ebx
+  802149:	75 ee                	jne    802139 <dev_lookup+0x14>
+  80214b:	89 e1                	mov    %esp,%ecx
+  80214d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802152:	29 c8                	sub    %ecx,%eax
+  802154:	89 c1                	mov    %eax,%ecx
+  802156:	c1 e9 0f             	shr    $0xf,%ecx
+  802159:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802163:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802166:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80216d:	8b 40 48             	mov    0x48(%eax),%eax
+  802170:	83 ec 04             	sub    $0x4,%esp
+  802173:	52                   	push   %edx
+  802174:	50                   	push   %eax
+  802175:	68 98 4e 80 00       	push   $0x804e98
+  80217a:	e8 9b e4 ff ff       	call   80061a <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80217f:	83 c4 10             	add    $0x10,%esp
+  802182:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  802187:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80218a:	89 1a                	mov    %ebx,(%edx)
+}
+  80218c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80218f:	c9                   	leave
+  802190:	c3                   	ret
+			return 0;
+  802191:	b8 00 00 00 00       	mov    $0x0,%eax
+  802196:	eb ef                	jmp    802187 <dev_lookup+0x62>
+
+00802198 <fd_close>:
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	57                   	push   %edi
+  80219c:	56                   	push   %esi
+  80219d:	53                   	push   %ebx
+  80219e:	83 ec 24             	sub    $0x24,%esp
+  8021a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021a4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021aa:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8021ab:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8021b1:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8021b4:	50                   	push   %eax
+  8021b5:	e8 19 ff ff ff       	call   8020d3 <fd_lookup>
+  8021ba:	89 c3                	mov    %eax,%ebx
+  8021bc:	83 c4 10             	add    $0x10,%esp
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	78 05                	js     8021c8 <fd_close+0x30>
+	    || fd != fd2)
+  8021c3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8021c6:	74 0f                	je     8021d7 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  8021c8:	85 ff                	test   %edi,%edi
+  8021ca:	0f 44 df             	cmove  %edi,%ebx
+}
+  8021cd:	89 d8                	mov    %ebx,%eax
+  8021cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021d2:	5b                   	pop    %ebx
+  8021d3:	5e                   	pop    %esi
+  8021d4:	5f                   	pop    %edi
+  8021d5:	5d                   	pop    %ebp
+  8021d6:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8021d7:	83 ec 08             	sub    $0x8,%esp
+  8021da:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8021dd:	50                   	push   %eax
+  8021de:	ff 36                	push   (%esi)
+  8021e0:	e8 40 ff ff ff       	call   802125 <dev_lookup>
+  8021e5:	89 c3                	mov    %eax,%ebx
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 1a                	js     802208 <fd_close+0x70>
+		if (dev->dev_close)
+  8021ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021f1:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8021f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	74 0b                	je     802208 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8021fd:	83 ec 0c             	sub    $0xc,%esp
+  802200:	56                   	push   %esi
+  802201:	ff d0                	call   *%eax
+  802203:	89 c3                	mov    %eax,%ebx
+  802205:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  802208:	83 ec 08             	sub    $0x8,%esp
+  80220b:	56                   	push   %esi
+  80220c:	6a 00                	push   $0x0
+  80220e:	e8 b7 ef ff ff       	call   8011ca <sys_page_unmap>
+	return r;
+  802213:	83 c4 10             	add    $0x10,%esp
+  802216:	eb b5                	jmp    8021cd <fd_close+0x35>
+
+00802218 <close>:
+
+int
+close(int fdnum)
+{
+  802218:	55                   	push   %ebp
+  802219:	89 e5                	mov    %esp,%ebp
+  80221b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80221e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802221:	50                   	push   %eax
+  802222:	ff 75 08             	push   0x8(%ebp)
+  802225:	e8 a9 fe ff ff       	call   8020d3 <fd_lookup>
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	79 02                	jns    802233 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  802231:	c9                   	leave
+  802232:	c3                   	ret
+		return fd_close(fd, 1);
+  802233:	83 ec 08             	sub    $0x8,%esp
+  802236:	6a 01                	push   $0x1
+  802238:	ff 75 f4             	push   -0xc(%ebp)
+  80223b:	e8 58 ff ff ff       	call   802198 <fd_close>
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	eb ec                	jmp    802231 <close+0x19>
+
+00802245 <close_all>:
+
+void
+close_all(void)
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	53                   	push   %ebx
+  802249:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80224c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  802251:	83 ec 0c             	sub    $0xc,%esp
+  802254:	53                   	push   %ebx
+  802255:	e8 be ff ff ff       	call   802218 <close>
+	for (i = 0; i < MAXFD; i++)
+  80225a:	83 c3 01             	add    $0x1,%ebx
+  80225d:	83 c4 10             	add    $0x10,%esp
+  802260:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  802266:	75 e9                	jne    802251 <close_all+0xc>
+}
+  802268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+
+0080226d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80226d:	55                   	push   %ebp
+  80226e:	89 e5                	mov    %esp,%ebp
+  802270:	57                   	push   %edi
+  802271:	56                   	push   %esi
+  802272:	53                   	push   %ebx
+  802273:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802276:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802279:	50                   	push   %eax
+  80227a:	ff 75 08             	push   0x8(%ebp)
+  80227d:	e8 51 fe ff ff       	call   8020d3 <fd_lookup>
+  802282:	89 c3                	mov    %eax,%ebx
+  802284:	83 c4 10             	add    $0x10,%esp
+  802287:	85 c0                	test   %eax,%eax
+  802289:	78 7f                	js     80230a <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80228b:	83 ec 0c             	sub    $0xc,%esp
+  80228e:	ff 75 0c             	push   0xc(%ebp)
+  802291:	e8 82 ff ff ff       	call   802218 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  802296:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802299:	c1 e6 0c             	shl    $0xc,%esi
+  80229c:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8022a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022a5:	89 3c 24             	mov    %edi,(%esp)
+  8022a8:	e8 bf fd ff ff       	call   80206c <fd2data>
+  8022ad:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8022af:	89 34 24             	mov    %esi,(%esp)
+  8022b2:	e8 b5 fd ff ff       	call   80206c <fd2data>
+  8022b7:	83 c4 10             	add    $0x10,%esp
+  8022ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  8022bd:	89 d8                	mov    %ebx,%eax
+  8022bf:	c1 e8 16             	shr    $0x16,%eax
+  8022c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022c9:	a8 01                	test   $0x1,%al
+  8022cb:	74 11                	je     8022de <dup+0x71>
+  8022cd:	89 d8                	mov    %ebx,%eax
+  8022cf:	c1 e8 0c             	shr    $0xc,%eax
+  8022d2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8022d9:	f6 c2 01             	test   $0x1,%dl
+  8022dc:	75 36                	jne    802314 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8022de:	89 f8                	mov    %edi,%eax
+  8022e0:	c1 e8 0c             	shr    $0xc,%eax
+  8022e3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8022ea:	83 ec 0c             	sub    $0xc,%esp
+  8022ed:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	56                   	push   %esi
+  8022f4:	6a 00                	push   $0x0
+  8022f6:	57                   	push   %edi
+  8022f7:	6a 00                	push   $0x0
+  8022f9:	e8 8a ee ff ff       	call   801188 <sys_page_map>
+  8022fe:	89 c3                	mov    %eax,%ebx
+  802300:	83 c4 20             	add    $0x20,%esp
+  802303:	85 c0                	test   %eax,%eax
+  802305:	78 33                	js     80233a <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802307:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80230a:	89 d8                	mov    %ebx,%eax
+  80230c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80230f:	5b                   	pop    %ebx
+  802310:	5e                   	pop    %esi
+  802311:	5f                   	pop    %edi
+  802312:	5d                   	pop    %ebp
+  802313:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802314:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80231b:	83 ec 0c             	sub    $0xc,%esp
+  80231e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802323:	50                   	push   %eax
+  802324:	ff 75 d4             	push   -0x2c(%ebp)
+  802327:	6a 00                	push   $0x0
+  802329:	53                   	push   %ebx
+  80232a:	6a 00                	push   $0x0
+  80232c:	e8 57 ee ff ff       	call   801188 <sys_page_map>
+  802331:	89 c3                	mov    %eax,%ebx
+  802333:	83 c4 20             	add    $0x20,%esp
+  802336:	85 c0                	test   %eax,%eax
+  802338:	79 a4                	jns    8022de <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80233a:	83 ec 08             	sub    $0x8,%esp
+  80233d:	56                   	push   %esi
+  80233e:	6a 00                	push   $0x0
+  802340:	e8 85 ee ff ff       	call   8011ca <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802345:	83 c4 08             	add    $0x8,%esp
+  802348:	ff 75 d4             	push   -0x2c(%ebp)
+  80234b:	6a 00                	push   $0x0
+  80234d:	e8 78 ee ff ff       	call   8011ca <sys_page_unmap>
+	return r;
+  802352:	83 c4 10             	add    $0x10,%esp
+  802355:	eb b3                	jmp    80230a <dup+0x9d>
+
+00802357 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802357:	55                   	push   %ebp
+  802358:	89 e5                	mov    %esp,%ebp
+  80235a:	56                   	push   %esi
+  80235b:	53                   	push   %ebx
+  80235c:	83 ec 18             	sub    $0x18,%esp
+  80235f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802362:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802365:	50                   	push   %eax
+  802366:	53                   	push   %ebx
+  802367:	e8 67 fd ff ff       	call   8020d3 <fd_lookup>
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	85 c0                	test   %eax,%eax
+  802371:	78 3c                	js     8023af <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802373:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802376:	83 ec 08             	sub    $0x8,%esp
+  802379:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237c:	50                   	push   %eax
+  80237d:	ff 36                	push   (%esi)
+  80237f:	e8 a1 fd ff ff       	call   802125 <dev_lookup>
+  802384:	83 c4 10             	add    $0x10,%esp
+  802387:	85 c0                	test   %eax,%eax
+  802389:	78 24                	js     8023af <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80238b:	8b 46 08             	mov    0x8(%esi),%eax
+  80238e:	83 e0 03             	and    $0x3,%eax
+  802391:	83 f8 01             	cmp    $0x1,%eax
+  802394:	74 20                	je     8023b6 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802396:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802399:	8b 40 08             	mov    0x8(%eax),%eax
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	74 54                	je     8023f4 <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8023a0:	83 ec 04             	sub    $0x4,%esp
+  8023a3:	ff 75 10             	push   0x10(%ebp)
+  8023a6:	ff 75 0c             	push   0xc(%ebp)
+  8023a9:	56                   	push   %esi
+  8023aa:	ff d0                	call   *%eax
+  8023ac:	83 c4 10             	add    $0x10,%esp
+}
+  8023af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b2:	5b                   	pop    %ebx
+  8023b3:	5e                   	pop    %esi
+  8023b4:	5d                   	pop    %ebp
+  8023b5:	c3                   	ret
+  8023b6:	89 e2                	mov    %esp,%edx
+  8023b8:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8023bd:	29 d0                	sub    %edx,%eax
+  8023bf:	89 c2                	mov    %eax,%edx
+  8023c1:	c1 ea 0f             	shr    $0xf,%edx
+  8023c4:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8023c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ce:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023d1:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8023d8:	8b 40 48             	mov    0x48(%eax),%eax
+  8023db:	83 ec 04             	sub    $0x4,%esp
+  8023de:	53                   	push   %ebx
+  8023df:	50                   	push   %eax
+  8023e0:	68 d9 4e 80 00       	push   $0x804ed9
+  8023e5:	e8 30 e2 ff ff       	call   80061a <cprintf>
+		return -E_INVAL;
+  8023ea:	83 c4 10             	add    $0x10,%esp
+  8023ed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f2:	eb bb                	jmp    8023af <read+0x58>
+		return -E_NOT_SUPP;
+  8023f4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8023f9:	eb b4                	jmp    8023af <read+0x58>
+
+008023fb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+  8023fe:	57                   	push   %edi
+  8023ff:	56                   	push   %esi
+  802400:	53                   	push   %ebx
+  802401:	83 ec 0c             	sub    $0xc,%esp
+  802404:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802407:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80240a:	85 f6                	test   %esi,%esi
+  80240c:	74 30                	je     80243e <readn+0x43>
+  80240e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802413:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  802418:	83 ec 04             	sub    $0x4,%esp
+  80241b:	89 f2                	mov    %esi,%edx
+  80241d:	29 c2                	sub    %eax,%edx
+  80241f:	52                   	push   %edx
+  802420:	01 f8                	add    %edi,%eax
+  802422:	50                   	push   %eax
+  802423:	ff 75 08             	push   0x8(%ebp)
+  802426:	e8 2c ff ff ff       	call   802357 <read>
+		if (m < 0)
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 15                	js     802447 <readn+0x4c>
+			return m;
+		if (m == 0)
+  802432:	74 11                	je     802445 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  802434:	01 c3                	add    %eax,%ebx
+  802436:	89 d8                	mov    %ebx,%eax
+  802438:	39 f3                	cmp    %esi,%ebx
+  80243a:	72 dc                	jb     802418 <readn+0x1d>
+  80243c:	eb 09                	jmp    802447 <readn+0x4c>
+  80243e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802443:	eb 02                	jmp    802447 <readn+0x4c>
+  802445:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  802447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244a:	5b                   	pop    %ebx
+  80244b:	5e                   	pop    %esi
+  80244c:	5f                   	pop    %edi
+  80244d:	5d                   	pop    %ebp
+  80244e:	c3                   	ret
+
+0080244f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	56                   	push   %esi
+  802453:	53                   	push   %ebx
+  802454:	83 ec 18             	sub    $0x18,%esp
+  802457:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80245a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80245d:	50                   	push   %eax
+  80245e:	53                   	push   %ebx
+  80245f:	e8 6f fc ff ff       	call   8020d3 <fd_lookup>
+  802464:	83 c4 10             	add    $0x10,%esp
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 37                	js     8024a2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80246b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80246e:	83 ec 08             	sub    $0x8,%esp
+  802471:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802474:	50                   	push   %eax
+  802475:	ff 36                	push   (%esi)
+  802477:	e8 a9 fc ff ff       	call   802125 <dev_lookup>
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 1f                	js     8024a2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802483:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802487:	74 20                	je     8024a9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802489:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80248c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80248f:	85 c0                	test   %eax,%eax
+  802491:	74 54                	je     8024e7 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  802493:	83 ec 04             	sub    $0x4,%esp
+  802496:	ff 75 10             	push   0x10(%ebp)
+  802499:	ff 75 0c             	push   0xc(%ebp)
+  80249c:	56                   	push   %esi
+  80249d:	ff d0                	call   *%eax
+  80249f:	83 c4 10             	add    $0x10,%esp
+}
+  8024a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024a5:	5b                   	pop    %ebx
+  8024a6:	5e                   	pop    %esi
+  8024a7:	5d                   	pop    %ebp
+  8024a8:	c3                   	ret
+  8024a9:	89 e2                	mov    %esp,%edx
+  8024ab:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8024b0:	29 d0                	sub    %edx,%eax
+  8024b2:	89 c2                	mov    %eax,%edx
+  8024b4:	c1 ea 0f             	shr    $0xf,%edx
+  8024b7:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8024bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c1:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024c4:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8024cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8024ce:	83 ec 04             	sub    $0x4,%esp
+  8024d1:	53                   	push   %ebx
+  8024d2:	50                   	push   %eax
+  8024d3:	68 f5 4e 80 00       	push   $0x804ef5
+  8024d8:	e8 3d e1 ff ff       	call   80061a <cprintf>
+		return -E_INVAL;
+  8024dd:	83 c4 10             	add    $0x10,%esp
+  8024e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e5:	eb bb                	jmp    8024a2 <write+0x53>
+		return -E_NOT_SUPP;
+  8024e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024ec:	eb b4                	jmp    8024a2 <write+0x53>
+
+008024ee <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024f7:	50                   	push   %eax
+  8024f8:	ff 75 08             	push   0x8(%ebp)
+  8024fb:	e8 d3 fb ff ff       	call   8020d3 <fd_lookup>
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	85 c0                	test   %eax,%eax
+  802505:	78 0e                	js     802515 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802507:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80250a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80250d:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802515:	c9                   	leave
+  802516:	c3                   	ret
+
+00802517 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802517:	55                   	push   %ebp
+  802518:	89 e5                	mov    %esp,%ebp
+  80251a:	53                   	push   %ebx
+  80251b:	83 ec 1c             	sub    $0x1c,%esp
+  80251e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802521:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	ff 75 08             	push   0x8(%ebp)
+  802528:	e8 a6 fb ff ff       	call   8020d3 <fd_lookup>
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	85 c0                	test   %eax,%eax
+  802532:	78 33                	js     802567 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  802534:	83 fb 03             	cmp    $0x3,%ebx
+  802537:	74 28                	je     802561 <fcntl+0x4a>
+  802539:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80253e:	83 fb 04             	cmp    $0x4,%ebx
+  802541:	75 24                	jne    802567 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  802543:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802546:	8b 41 08             	mov    0x8(%ecx),%eax
+  802549:	80 e4 ef             	and    $0xef,%ah
+  80254c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80254f:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802555:	09 d0                	or     %edx,%eax
+  802557:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  80255a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255f:	eb 06                	jmp    802567 <fcntl+0x50>
+		return fd->fd_omode;
+  802561:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802564:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  802567:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+
+0080256c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	56                   	push   %esi
+  802570:	53                   	push   %ebx
+  802571:	83 ec 18             	sub    $0x18,%esp
+  802574:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802577:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80257a:	50                   	push   %eax
+  80257b:	53                   	push   %ebx
+  80257c:	e8 52 fb ff ff       	call   8020d3 <fd_lookup>
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	85 c0                	test   %eax,%eax
+  802586:	78 34                	js     8025bc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802588:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80258b:	83 ec 08             	sub    $0x8,%esp
+  80258e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802591:	50                   	push   %eax
+  802592:	ff 36                	push   (%esi)
+  802594:	e8 8c fb ff ff       	call   802125 <dev_lookup>
+  802599:	83 c4 10             	add    $0x10,%esp
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	78 1c                	js     8025bc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8025a0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8025a4:	74 1d                	je     8025c3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8025a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025a9:	8b 40 18             	mov    0x18(%eax),%eax
+  8025ac:	85 c0                	test   %eax,%eax
+  8025ae:	74 51                	je     802601 <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8025b0:	83 ec 08             	sub    $0x8,%esp
+  8025b3:	ff 75 0c             	push   0xc(%ebp)
+  8025b6:	56                   	push   %esi
+  8025b7:	ff d0                	call   *%eax
+  8025b9:	83 c4 10             	add    $0x10,%esp
+}
+  8025bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025bf:	5b                   	pop    %ebx
+  8025c0:	5e                   	pop    %esi
+  8025c1:	5d                   	pop    %ebp
+  8025c2:	c3                   	ret
+  8025c3:	89 e2                	mov    %esp,%edx
+  8025c5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8025ca:	29 d0                	sub    %edx,%eax
+  8025cc:	89 c2                	mov    %eax,%edx
+  8025ce:	c1 ea 0f             	shr    $0xf,%edx
+  8025d1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8025d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025db:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  8025de:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8025e5:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8025e8:	83 ec 04             	sub    $0x4,%esp
+  8025eb:	53                   	push   %ebx
+  8025ec:	50                   	push   %eax
+  8025ed:	68 b8 4e 80 00       	push   $0x804eb8
+  8025f2:	e8 23 e0 ff ff       	call   80061a <cprintf>
+		return -E_INVAL;
+  8025f7:	83 c4 10             	add    $0x10,%esp
+  8025fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025ff:	eb bb                	jmp    8025bc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802601:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802606:	eb b4                	jmp    8025bc <ftruncate+0x50>
+
+00802608 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	56                   	push   %esi
+  80260c:	53                   	push   %ebx
+  80260d:	83 ec 18             	sub    $0x18,%esp
+  802610:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802613:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802616:	50                   	push   %eax
+  802617:	ff 75 08             	push   0x8(%ebp)
+  80261a:	e8 b4 fa ff ff       	call   8020d3 <fd_lookup>
+  80261f:	83 c4 10             	add    $0x10,%esp
+  802622:	85 c0                	test   %eax,%eax
+  802624:	78 53                	js     802679 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802626:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802629:	83 ec 08             	sub    $0x8,%esp
+  80262c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80262f:	50                   	push   %eax
+  802630:	ff 36                	push   (%esi)
+  802632:	e8 ee fa ff ff       	call   802125 <dev_lookup>
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	78 3b                	js     802679 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  80263e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802641:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802645:	74 39                	je     802680 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802647:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80264a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802651:	00 00 00 
+	stat->st_isdir = 0;
+  802654:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80265b:	00 00 00 
+	stat->st_version = 0;
+  80265e:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  802665:	00 00 00 
+	stat->st_dev = dev;
+  802668:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80266e:	83 ec 08             	sub    $0x8,%esp
+  802671:	53                   	push   %ebx
+  802672:	56                   	push   %esi
+  802673:	ff 50 14             	call   *0x14(%eax)
+  802676:	83 c4 10             	add    $0x10,%esp
+}
+  802679:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80267c:	5b                   	pop    %ebx
+  80267d:	5e                   	pop    %esi
+  80267e:	5d                   	pop    %ebp
+  80267f:	c3                   	ret
+		return -E_NOT_SUPP;
+  802680:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802685:	eb f2                	jmp    802679 <fstat+0x71>
+
+00802687 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	56                   	push   %esi
+  80268b:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80268c:	83 ec 08             	sub    $0x8,%esp
+  80268f:	6a 00                	push   $0x0
+  802691:	ff 75 08             	push   0x8(%ebp)
+  802694:	e8 b7 01 00 00       	call   802850 <open>
+  802699:	89 c3                	mov    %eax,%ebx
+  80269b:	83 c4 10             	add    $0x10,%esp
+  80269e:	85 c0                	test   %eax,%eax
+  8026a0:	78 1b                	js     8026bd <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8026a2:	83 ec 08             	sub    $0x8,%esp
+  8026a5:	ff 75 0c             	push   0xc(%ebp)
+  8026a8:	50                   	push   %eax
+  8026a9:	e8 5a ff ff ff       	call   802608 <fstat>
+  8026ae:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8026b0:	89 1c 24             	mov    %ebx,(%esp)
+  8026b3:	e8 60 fb ff ff       	call   802218 <close>
+	return r;
+  8026b8:	83 c4 10             	add    $0x10,%esp
+  8026bb:	89 f3                	mov    %esi,%ebx
+}
+  8026bd:	89 d8                	mov    %ebx,%eax
+  8026bf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026c2:	5b                   	pop    %ebx
+  8026c3:	5e                   	pop    %esi
+  8026c4:	5d                   	pop    %ebp
+  8026c5:	c3                   	ret
+
+008026c6 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	56                   	push   %esi
+  8026ca:	53                   	push   %ebx
+  8026cb:	89 c6                	mov    %eax,%esi
+  8026cd:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  8026cf:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  8026d6:	74 27                	je     8026ff <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8026d8:	6a 07                	push   $0x7
+  8026da:	68 00 70 80 00       	push   $0x807000
+  8026df:	56                   	push   %esi
+  8026e0:	ff 35 c4 66 80 00    	push   0x8066c4
+  8026e6:	e8 c9 f8 ff ff       	call   801fb4 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  8026eb:	83 c4 0c             	add    $0xc,%esp
+  8026ee:	6a 00                	push   $0x0
+  8026f0:	53                   	push   %ebx
+  8026f1:	6a 00                	push   $0x0
+  8026f3:	e8 2c f6 ff ff       	call   801d24 <ipc_recv>
+}
+  8026f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026fb:	5b                   	pop    %ebx
+  8026fc:	5e                   	pop    %esi
+  8026fd:	5d                   	pop    %ebp
+  8026fe:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8026ff:	83 ec 0c             	sub    $0xc,%esp
+  802702:	6a 02                	push   $0x2
+  802704:	e8 14 f9 ff ff       	call   80201d <ipc_find_env>
+  802709:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  80270e:	83 c4 10             	add    $0x10,%esp
+  802711:	eb c5                	jmp    8026d8 <fsipc+0x12>
+
+00802713 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802713:	55                   	push   %ebp
+  802714:	89 e5                	mov    %esp,%ebp
+  802716:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802719:	8b 45 08             	mov    0x8(%ebp),%eax
+  80271c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80271f:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802724:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802727:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80272c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802731:	b8 02 00 00 00       	mov    $0x2,%eax
+  802736:	e8 8b ff ff ff       	call   8026c6 <fsipc>
+}
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+
+0080273d <devfile_flush>:
+{
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802743:	8b 45 08             	mov    0x8(%ebp),%eax
+  802746:	8b 40 0c             	mov    0xc(%eax),%eax
+  802749:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80274e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802753:	b8 06 00 00 00       	mov    $0x6,%eax
+  802758:	e8 69 ff ff ff       	call   8026c6 <fsipc>
+}
+  80275d:	c9                   	leave
+  80275e:	c3                   	ret
+
+0080275f <devfile_stat>:
+{
+  80275f:	55                   	push   %ebp
+  802760:	89 e5                	mov    %esp,%ebp
+  802762:	53                   	push   %ebx
+  802763:	83 ec 04             	sub    $0x4,%esp
+  802766:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802769:	8b 45 08             	mov    0x8(%ebp),%eax
+  80276c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80276f:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	b8 05 00 00 00       	mov    $0x5,%eax
+  80277e:	e8 43 ff ff ff       	call   8026c6 <fsipc>
+  802783:	85 c0                	test   %eax,%eax
+  802785:	78 37                	js     8027be <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802787:	83 ec 08             	sub    $0x8,%esp
+  80278a:	68 00 70 80 00       	push   $0x807000
+  80278f:	53                   	push   %ebx
+  802790:	e8 7c e5 ff ff       	call   800d11 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802795:	a1 80 70 80 00       	mov    0x807080,%eax
+  80279a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027a0:	a1 84 70 80 00       	mov    0x807084,%eax
+  8027a5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8027ab:	a1 88 70 80 00       	mov    0x807088,%eax
+  8027b0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8027b6:	83 c4 10             	add    $0x10,%esp
+  8027b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027c1:	c9                   	leave
+  8027c2:	c3                   	ret
+
+008027c3 <devfile_write>:
+{
+  8027c3:	55                   	push   %ebp
+  8027c4:	89 e5                	mov    %esp,%ebp
+  8027c6:	83 ec 0c             	sub    $0xc,%esp
+  8027c9:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  8027cc:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8027d1:	39 d0                	cmp    %edx,%eax
+  8027d3:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027d9:	8b 52 0c             	mov    0xc(%edx),%edx
+  8027dc:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  8027e2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  8027e7:	50                   	push   %eax
+  8027e8:	ff 75 0c             	push   0xc(%ebp)
+  8027eb:	68 08 70 80 00       	push   $0x807008
+  8027f0:	e8 cc e6 ff ff       	call   800ec1 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  8027f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fa:	b8 04 00 00 00       	mov    $0x4,%eax
+  8027ff:	e8 c2 fe ff ff       	call   8026c6 <fsipc>
+}
+  802804:	c9                   	leave
+  802805:	c3                   	ret
+
+00802806 <devfile_read>:
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	53                   	push   %ebx
+  80280a:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80280d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802810:	8b 40 0c             	mov    0xc(%eax),%eax
+  802813:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802818:	8b 45 10             	mov    0x10(%ebp),%eax
+  80281b:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  802820:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802825:	b8 03 00 00 00       	mov    $0x3,%eax
+  80282a:	e8 97 fe ff ff       	call   8026c6 <fsipc>
+  80282f:	89 c3                	mov    %eax,%ebx
+  802831:	85 c0                	test   %eax,%eax
+  802833:	78 14                	js     802849 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802835:	83 ec 04             	sub    $0x4,%esp
+  802838:	50                   	push   %eax
+  802839:	68 00 70 80 00       	push   $0x807000
+  80283e:	ff 75 0c             	push   0xc(%ebp)
+  802841:	e8 7b e6 ff ff       	call   800ec1 <memmove>
+	return r;
+  802846:	83 c4 10             	add    $0x10,%esp
+}
+  802849:	89 d8                	mov    %ebx,%eax
+  80284b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284e:	c9                   	leave
+  80284f:	c3                   	ret
+
+00802850 <open>:
+{
+  802850:	55                   	push   %ebp
+  802851:	89 e5                	mov    %esp,%ebp
+  802853:	53                   	push   %ebx
+  802854:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802857:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80285a:	50                   	push   %eax
+  80285b:	e8 23 f8 ff ff       	call   802083 <fd_alloc>
+  802860:	89 c3                	mov    %eax,%ebx
+  802862:	83 c4 10             	add    $0x10,%esp
+  802865:	85 c0                	test   %eax,%eax
+  802867:	78 2a                	js     802893 <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  802869:	83 ec 0c             	sub    $0xc,%esp
+  80286c:	ff 75 08             	push   0x8(%ebp)
+  80286f:	e8 51 e4 ff ff       	call   800cc5 <strlen>
+  802874:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  802877:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  80287c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802881:	7e 17                	jle    80289a <open+0x4a>
+	fd_close(fd, 1);
+  802883:	83 ec 08             	sub    $0x8,%esp
+  802886:	6a 01                	push   $0x1
+  802888:	ff 75 f4             	push   -0xc(%ebp)
+  80288b:	e8 08 f9 ff ff       	call   802198 <fd_close>
+	return r;
+  802890:	83 c4 10             	add    $0x10,%esp
+}
+  802893:	89 d8                	mov    %ebx,%eax
+  802895:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802898:	c9                   	leave
+  802899:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  80289a:	83 ec 08             	sub    $0x8,%esp
+  80289d:	ff 75 08             	push   0x8(%ebp)
+  8028a0:	68 00 70 80 00       	push   $0x807000
+  8028a5:	e8 67 e4 ff ff       	call   800d11 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8028aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028ad:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8028b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8028b5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ba:	e8 07 fe ff ff       	call   8026c6 <fsipc>
+  8028bf:	89 c3                	mov    %eax,%ebx
+  8028c1:	83 c4 10             	add    $0x10,%esp
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 bb                	js     802883 <open+0x33>
+	return fd2num(fd); 	
+  8028c8:	83 ec 0c             	sub    $0xc,%esp
+  8028cb:	ff 75 f4             	push   -0xc(%ebp)
+  8028ce:	e8 89 f7 ff ff       	call   80205c <fd2num>
+  8028d3:	89 c3                	mov    %eax,%ebx
+  8028d5:	83 c4 10             	add    $0x10,%esp
+  8028d8:	eb b9                	jmp    802893 <open+0x43>
+
+008028da <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	53                   	push   %ebx
+  8028de:	83 ec 1c             	sub    $0x1c,%esp
+  8028e1:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028e7:	50                   	push   %eax
+  8028e8:	ff 75 08             	push   0x8(%ebp)
+  8028eb:	e8 e3 f7 ff ff       	call   8020d3 <fd_lookup>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	78 5a                	js     802951 <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  8028f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fa:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802900:	39 10                	cmp    %edx,(%eax)
+  802902:	75 66                	jne    80296a <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  802904:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  80290b:	74 49                	je     802956 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80290d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802910:	8b 40 0c             	mov    0xc(%eax),%eax
+  802913:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802918:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80291b:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  802920:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802926:	6a 07                	push   $0x7
+  802928:	68 00 70 80 00       	push   $0x807000
+  80292d:	6a 09                	push   $0x9
+  80292f:	ff 35 c4 66 80 00    	push   0x8066c4
+  802935:	e8 7a f6 ff ff       	call   801fb4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  80293a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802941:	6a 00                	push   $0x0
+  802943:	53                   	push   %ebx
+  802944:	ff 75 10             	push   0x10(%ebp)
+  802947:	6a 00                	push   $0x0
+  802949:	e8 a3 f4 ff ff       	call   801df1 <ipc_recv_pages>
+  80294e:	83 c4 20             	add    $0x20,%esp
+}
+  802951:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802954:	c9                   	leave
+  802955:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802956:	83 ec 0c             	sub    $0xc,%esp
+  802959:	6a 02                	push   $0x2
+  80295b:	e8 bd f6 ff ff       	call   80201d <ipc_find_env>
+  802960:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802965:	83 c4 10             	add    $0x10,%esp
+  802968:	eb a3                	jmp    80290d <fmap+0x33>
+		return -E_INVAL;
+  80296a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80296f:	eb e0                	jmp    802951 <fmap+0x77>
+
+00802971 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	53                   	push   %ebx
+  802975:	83 ec 10             	sub    $0x10,%esp
+  802978:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80297b:	53                   	push   %ebx
+  80297c:	e8 44 e3 ff ff       	call   800cc5 <strlen>
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802989:	7f 25                	jg     8029b0 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80298b:	83 ec 08             	sub    $0x8,%esp
+  80298e:	53                   	push   %ebx
+  80298f:	68 00 70 80 00       	push   $0x807000
+  802994:	e8 78 e3 ff ff       	call   800d11 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80299e:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029a3:	e8 1e fd ff ff       	call   8026c6 <fsipc>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+}
+  8029ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ae:	c9                   	leave
+  8029af:	c3                   	ret
+		return -E_BAD_PATH;
+  8029b0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8029b5:	eb f4                	jmp    8029ab <remove+0x3a>
+
+008029b7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8029b7:	55                   	push   %ebp
+  8029b8:	89 e5                	mov    %esp,%ebp
+  8029ba:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8029bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029c7:	e8 fa fc ff ff       	call   8026c6 <fsipc>
+}
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+
+008029ce <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8029d4:	68 28 4f 80 00       	push   $0x804f28
+  8029d9:	ff 75 0c             	push   0xc(%ebp)
+  8029dc:	e8 30 e3 ff ff       	call   800d11 <strcpy>
+	return 0;
+}
+  8029e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e6:	c9                   	leave
+  8029e7:	c3                   	ret
+
+008029e8 <devsock_close>:
+{
+  8029e8:	55                   	push   %ebp
+  8029e9:	89 e5                	mov    %esp,%ebp
+  8029eb:	53                   	push   %ebx
+  8029ec:	83 ec 10             	sub    $0x10,%esp
+  8029ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8029f2:	53                   	push   %ebx
+  8029f3:	e8 85 1c 00 00       	call   80467d <pageref>
+  8029f8:	89 c2                	mov    %eax,%edx
+  8029fa:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802a02:	83 fa 01             	cmp    $0x1,%edx
+  802a05:	74 05                	je     802a0c <devsock_close+0x24>
+}
+  802a07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a0a:	c9                   	leave
+  802a0b:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802a0c:	83 ec 0c             	sub    $0xc,%esp
+  802a0f:	ff 73 0c             	push   0xc(%ebx)
+  802a12:	e8 b0 05 00 00       	call   802fc7 <nsipc_close>
+  802a17:	83 c4 10             	add    $0x10,%esp
+  802a1a:	eb eb                	jmp    802a07 <devsock_close+0x1f>
+
+00802a1c <devsock_write>:
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	53                   	push   %ebx
+  802a20:	83 ec 14             	sub    $0x14,%esp
+  802a23:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a29:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802a2c:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802a2f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802a32:	8b 41 08             	mov    0x8(%ecx),%eax
+  802a35:	c1 f8 09             	sar    $0x9,%eax
+  802a38:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802a3b:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802a41:	77 13                	ja     802a56 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  802a43:	50                   	push   %eax
+  802a44:	52                   	push   %edx
+  802a45:	53                   	push   %ebx
+  802a46:	ff 71 0c             	push   0xc(%ecx)
+  802a49:	e8 5c 06 00 00       	call   8030aa <nsipc_send>
+  802a4e:	83 c4 10             	add    $0x10,%esp
+}
+  802a51:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a54:	c9                   	leave
+  802a55:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802a56:	50                   	push   %eax
+  802a57:	6a 01                	push   $0x1
+  802a59:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802a5c:	50                   	push   %eax
+  802a5d:	ff 71 0c             	push   0xc(%ecx)
+  802a60:	e8 a6 06 00 00       	call   80310b <nsipc_sendmsg>
+  802a65:	83 c4 10             	add    $0x10,%esp
+  802a68:	eb e7                	jmp    802a51 <devsock_write+0x35>
+
+00802a6a <devsock_read>:
+{
+  802a6a:	55                   	push   %ebp
+  802a6b:	89 e5                	mov    %esp,%ebp
+  802a6d:	53                   	push   %ebx
+  802a6e:	83 ec 14             	sub    $0x14,%esp
+  802a71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a74:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802a77:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  802a7a:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  802a7d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  802a80:	8b 41 08             	mov    0x8(%ecx),%eax
+  802a83:	c1 f8 09             	sar    $0x9,%eax
+  802a86:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802a89:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  802a8f:	77 13                	ja     802aa4 <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  802a91:	50                   	push   %eax
+  802a92:	52                   	push   %edx
+  802a93:	53                   	push   %ebx
+  802a94:	ff 71 0c             	push   0xc(%ecx)
+  802a97:	e8 9c 05 00 00       	call   803038 <nsipc_recv>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+}
+  802a9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aa2:	c9                   	leave
+  802aa3:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802aa4:	50                   	push   %eax
+  802aa5:	6a 01                	push   $0x1
+  802aa7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802aaa:	50                   	push   %eax
+  802aab:	ff 71 0c             	push   0xc(%ecx)
+  802aae:	e8 02 0a 00 00       	call   8034b5 <nsipc_recvmsg>
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	eb e7                	jmp    802a9f <devsock_read+0x35>
+
+00802ab8 <fd2sockid>:
+{
+  802ab8:	55                   	push   %ebp
+  802ab9:	89 e5                	mov    %esp,%ebp
+  802abb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802abe:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ac1:	52                   	push   %edx
+  802ac2:	50                   	push   %eax
+  802ac3:	e8 0b f6 ff ff       	call   8020d3 <fd_lookup>
+  802ac8:	83 c4 10             	add    $0x10,%esp
+  802acb:	85 c0                	test   %eax,%eax
+  802acd:	78 10                	js     802adf <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802acf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ad2:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802ad8:	39 08                	cmp    %ecx,(%eax)
+  802ada:	75 05                	jne    802ae1 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802adc:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802adf:	c9                   	leave
+  802ae0:	c3                   	ret
+		return -E_NOT_SUPP;
+  802ae1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802ae6:	eb f7                	jmp    802adf <fd2sockid+0x27>
+
+00802ae8 <sock_flags>:
+{
+  802ae8:	55                   	push   %ebp
+  802ae9:	89 e5                	mov    %esp,%ebp
+  802aeb:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802aee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802af1:	52                   	push   %edx
+  802af2:	50                   	push   %eax
+  802af3:	e8 db f5 ff ff       	call   8020d3 <fd_lookup>
+  802af8:	83 c4 10             	add    $0x10,%esp
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	78 0e                	js     802b0d <sock_flags+0x25>
+  802aff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b02:	8b 40 08             	mov    0x8(%eax),%eax
+  802b05:	c1 e8 09             	shr    $0x9,%eax
+  802b08:	83 e0 08             	and    $0x8,%eax
+}
+  802b0b:	c9                   	leave
+  802b0c:	c3                   	ret
+		return 0;
+  802b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b12:	eb f7                	jmp    802b0b <sock_flags+0x23>
+
+00802b14 <alloc_sockfd>:
+{
+  802b14:	55                   	push   %ebp
+  802b15:	89 e5                	mov    %esp,%ebp
+  802b17:	56                   	push   %esi
+  802b18:	53                   	push   %ebx
+  802b19:	83 ec 1c             	sub    $0x1c,%esp
+  802b1c:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802b1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b21:	50                   	push   %eax
+  802b22:	e8 5c f5 ff ff       	call   802083 <fd_alloc>
+  802b27:	89 c3                	mov    %eax,%ebx
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	78 43                	js     802b73 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802b30:	83 ec 04             	sub    $0x4,%esp
+  802b33:	68 07 04 00 00       	push   $0x407
+  802b38:	ff 75 f4             	push   -0xc(%ebp)
+  802b3b:	6a 00                	push   $0x0
+  802b3d:	e8 03 e6 ff ff       	call   801145 <sys_page_alloc>
+  802b42:	89 c3                	mov    %eax,%ebx
+  802b44:	83 c4 10             	add    $0x10,%esp
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	78 28                	js     802b73 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802b4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b4e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802b54:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802b56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b59:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802b60:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802b63:	83 ec 0c             	sub    $0xc,%esp
+  802b66:	50                   	push   %eax
+  802b67:	e8 f0 f4 ff ff       	call   80205c <fd2num>
+  802b6c:	89 c3                	mov    %eax,%ebx
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	eb 0c                	jmp    802b7f <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802b73:	83 ec 0c             	sub    $0xc,%esp
+  802b76:	56                   	push   %esi
+  802b77:	e8 4b 04 00 00       	call   802fc7 <nsipc_close>
+		return r;
+  802b7c:	83 c4 10             	add    $0x10,%esp
+}
+  802b7f:	89 d8                	mov    %ebx,%eax
+  802b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b84:	5b                   	pop    %ebx
+  802b85:	5e                   	pop    %esi
+  802b86:	5d                   	pop    %ebp
+  802b87:	c3                   	ret
+
+00802b88 <accept>:
+{
+  802b88:	55                   	push   %ebp
+  802b89:	89 e5                	mov    %esp,%ebp
+  802b8b:	56                   	push   %esi
+  802b8c:	53                   	push   %ebx
+  802b8d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802b90:	89 f0                	mov    %esi,%eax
+  802b92:	e8 21 ff ff ff       	call   802ab8 <fd2sockid>
+  802b97:	89 c3                	mov    %eax,%ebx
+  802b99:	85 c0                	test   %eax,%eax
+  802b9b:	78 24                	js     802bc1 <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  802b9d:	89 f0                	mov    %esi,%eax
+  802b9f:	e8 44 ff ff ff       	call   802ae8 <sock_flags>
+  802ba4:	50                   	push   %eax
+  802ba5:	ff 75 10             	push   0x10(%ebp)
+  802ba8:	ff 75 0c             	push   0xc(%ebp)
+  802bab:	53                   	push   %ebx
+  802bac:	e8 6b 03 00 00       	call   802f1c <nsipc_accept>
+  802bb1:	89 c3                	mov    %eax,%ebx
+  802bb3:	83 c4 10             	add    $0x10,%esp
+  802bb6:	85 c0                	test   %eax,%eax
+  802bb8:	78 07                	js     802bc1 <accept+0x39>
+	return alloc_sockfd(r);
+  802bba:	e8 55 ff ff ff       	call   802b14 <alloc_sockfd>
+  802bbf:	89 c3                	mov    %eax,%ebx
+}
+  802bc1:	89 d8                	mov    %ebx,%eax
+  802bc3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc6:	5b                   	pop    %ebx
+  802bc7:	5e                   	pop    %esi
+  802bc8:	5d                   	pop    %ebp
+  802bc9:	c3                   	ret
+
+00802bca <bind>:
+{
+  802bca:	55                   	push   %ebp
+  802bcb:	89 e5                	mov    %esp,%ebp
+  802bcd:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bd3:	e8 e0 fe ff ff       	call   802ab8 <fd2sockid>
+  802bd8:	85 c0                	test   %eax,%eax
+  802bda:	78 12                	js     802bee <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802bdc:	83 ec 04             	sub    $0x4,%esp
+  802bdf:	ff 75 10             	push   0x10(%ebp)
+  802be2:	ff 75 0c             	push   0xc(%ebp)
+  802be5:	50                   	push   %eax
+  802be6:	e8 85 03 00 00       	call   802f70 <nsipc_bind>
+  802beb:	83 c4 10             	add    $0x10,%esp
+}
+  802bee:	c9                   	leave
+  802bef:	c3                   	ret
+
+00802bf0 <shutdown>:
+{
+  802bf0:	55                   	push   %ebp
+  802bf1:	89 e5                	mov    %esp,%ebp
+  802bf3:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf9:	e8 ba fe ff ff       	call   802ab8 <fd2sockid>
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	78 0f                	js     802c11 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802c02:	83 ec 08             	sub    $0x8,%esp
+  802c05:	ff 75 0c             	push   0xc(%ebp)
+  802c08:	50                   	push   %eax
+  802c09:	e8 97 03 00 00       	call   802fa5 <nsipc_shutdown>
+  802c0e:	83 c4 10             	add    $0x10,%esp
+}
+  802c11:	c9                   	leave
+  802c12:	c3                   	ret
+
+00802c13 <connect>:
+{
+  802c13:	55                   	push   %ebp
+  802c14:	89 e5                	mov    %esp,%ebp
+  802c16:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c1c:	e8 97 fe ff ff       	call   802ab8 <fd2sockid>
+  802c21:	85 c0                	test   %eax,%eax
+  802c23:	78 12                	js     802c37 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802c25:	83 ec 04             	sub    $0x4,%esp
+  802c28:	ff 75 10             	push   0x10(%ebp)
+  802c2b:	ff 75 0c             	push   0xc(%ebp)
+  802c2e:	50                   	push   %eax
+  802c2f:	e8 ad 03 00 00       	call   802fe1 <nsipc_connect>
+  802c34:	83 c4 10             	add    $0x10,%esp
+}
+  802c37:	c9                   	leave
+  802c38:	c3                   	ret
+
+00802c39 <listen>:
+{
+  802c39:	55                   	push   %ebp
+  802c3a:	89 e5                	mov    %esp,%ebp
+  802c3c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c42:	e8 71 fe ff ff       	call   802ab8 <fd2sockid>
+  802c47:	85 c0                	test   %eax,%eax
+  802c49:	78 0f                	js     802c5a <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802c4b:	83 ec 08             	sub    $0x8,%esp
+  802c4e:	ff 75 0c             	push   0xc(%ebp)
+  802c51:	50                   	push   %eax
+  802c52:	e8 bf 03 00 00       	call   803016 <nsipc_listen>
+  802c57:	83 c4 10             	add    $0x10,%esp
+}
+  802c5a:	c9                   	leave
+  802c5b:	c3                   	ret
+
+00802c5c <sendmsg>:
+{
+  802c5c:	55                   	push   %ebp
+  802c5d:	89 e5                	mov    %esp,%ebp
+  802c5f:	57                   	push   %edi
+  802c60:	56                   	push   %esi
+  802c61:	53                   	push   %ebx
+  802c62:	83 ec 0c             	sub    $0xc,%esp
+  802c65:	8b 75 08             	mov    0x8(%ebp),%esi
+  802c68:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  802c6b:	89 f0                	mov    %esi,%eax
+  802c6d:	e8 46 fe ff ff       	call   802ab8 <fd2sockid>
+  802c72:	89 c3                	mov    %eax,%ebx
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	78 1c                	js     802c94 <sendmsg+0x38>
+			     flags | sock_flags(s));
+  802c78:	89 f0                	mov    %esi,%eax
+  802c7a:	e8 69 fe ff ff       	call   802ae8 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802c7f:	0b 45 10             	or     0x10(%ebp),%eax
+  802c82:	50                   	push   %eax
+  802c83:	ff 77 0c             	push   0xc(%edi)
+  802c86:	ff 77 08             	push   0x8(%edi)
+  802c89:	53                   	push   %ebx
+  802c8a:	e8 7c 04 00 00       	call   80310b <nsipc_sendmsg>
+  802c8f:	89 c3                	mov    %eax,%ebx
+  802c91:	83 c4 10             	add    $0x10,%esp
+}
+  802c94:	89 d8                	mov    %ebx,%eax
+  802c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c99:	5b                   	pop    %ebx
+  802c9a:	5e                   	pop    %esi
+  802c9b:	5f                   	pop    %edi
+  802c9c:	5d                   	pop    %ebp
+  802c9d:	c3                   	ret
+
+00802c9e <recvmsg>:
+{
+  802c9e:	55                   	push   %ebp
+  802c9f:	89 e5                	mov    %esp,%ebp
+  802ca1:	57                   	push   %edi
+  802ca2:	56                   	push   %esi
+  802ca3:	53                   	push   %ebx
+  802ca4:	83 ec 0c             	sub    $0xc,%esp
+  802ca7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802caa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802cad:	89 f8                	mov    %edi,%eax
+  802caf:	e8 04 fe ff ff       	call   802ab8 <fd2sockid>
+  802cb4:	89 c3                	mov    %eax,%ebx
+  802cb6:	85 c0                	test   %eax,%eax
+  802cb8:	78 2a                	js     802ce4 <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  802cba:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  802cc1:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802cc8:	89 f8                	mov    %edi,%eax
+  802cca:	e8 19 fe ff ff       	call   802ae8 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  802ccf:	0b 45 10             	or     0x10(%ebp),%eax
+  802cd2:	50                   	push   %eax
+  802cd3:	ff 76 0c             	push   0xc(%esi)
+  802cd6:	ff 76 08             	push   0x8(%esi)
+  802cd9:	53                   	push   %ebx
+  802cda:	e8 d6 07 00 00       	call   8034b5 <nsipc_recvmsg>
+  802cdf:	89 c3                	mov    %eax,%ebx
+  802ce1:	83 c4 10             	add    $0x10,%esp
+}
+  802ce4:	89 d8                	mov    %ebx,%eax
+  802ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ce9:	5b                   	pop    %ebx
+  802cea:	5e                   	pop    %esi
+  802ceb:	5f                   	pop    %edi
+  802cec:	5d                   	pop    %ebp
+  802ced:	c3                   	ret
+
+00802cee <sendfile>:
+{
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	56                   	push   %esi
+  802cf2:	53                   	push   %ebx
+  802cf3:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802cf6:	89 f0                	mov    %esi,%eax
+  802cf8:	e8 bb fd ff ff       	call   802ab8 <fd2sockid>
+  802cfd:	89 c3                	mov    %eax,%ebx
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	78 1f                	js     802d22 <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  802d03:	89 f0                	mov    %esi,%eax
+  802d05:	e8 de fd ff ff       	call   802ae8 <sock_flags>
+  802d0a:	83 ec 0c             	sub    $0xc,%esp
+  802d0d:	50                   	push   %eax
+  802d0e:	ff 75 14             	push   0x14(%ebp)
+  802d11:	ff 75 10             	push   0x10(%ebp)
+  802d14:	ff 75 0c             	push   0xc(%ebp)
+  802d17:	53                   	push   %ebx
+  802d18:	e8 64 06 00 00       	call   803381 <nsipc_sendfile>
+  802d1d:	89 c3                	mov    %eax,%ebx
+  802d1f:	83 c4 20             	add    $0x20,%esp
+}
+  802d22:	89 d8                	mov    %ebx,%eax
+  802d24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d27:	5b                   	pop    %ebx
+  802d28:	5e                   	pop    %esi
+  802d29:	5d                   	pop    %ebp
+  802d2a:	c3                   	ret
+
+00802d2b <evctl>:
+{
+  802d2b:	55                   	push   %ebp
+  802d2c:	89 e5                	mov    %esp,%ebp
+  802d2e:	53                   	push   %ebx
+  802d2f:	83 ec 04             	sub    $0x4,%esp
+  802d32:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802d35:	89 d8                	mov    %ebx,%eax
+  802d37:	e8 7c fd ff ff       	call   802ab8 <fd2sockid>
+  802d3c:	85 c0                	test   %eax,%eax
+  802d3e:	78 10                	js     802d50 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  802d40:	83 ec 04             	sub    $0x4,%esp
+  802d43:	53                   	push   %ebx
+  802d44:	ff 75 0c             	push   0xc(%ebp)
+  802d47:	50                   	push   %eax
+  802d48:	e8 d2 0b 00 00       	call   80391f <nsipc_evctl>
+  802d4d:	83 c4 10             	add    $0x10,%esp
+}
+  802d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d53:	c9                   	leave
+  802d54:	c3                   	ret
+
+00802d55 <evwait>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+  802d58:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802d5b:	ff 75 10             	push   0x10(%ebp)
+  802d5e:	ff 75 0c             	push   0xc(%ebp)
+  802d61:	ff 75 08             	push   0x8(%ebp)
+  802d64:	e8 e0 0b 00 00       	call   803949 <nsipc_evwait>
+}
+  802d69:	c9                   	leave
+  802d6a:	c3                   	ret
+
+00802d6b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d6b:	55                   	push   %ebp
+  802d6c:	89 e5                	mov    %esp,%ebp
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d71:	ff 75 10             	push   0x10(%ebp)
+  802d74:	ff 75 0c             	push   0xc(%ebp)
+  802d77:	ff 75 08             	push   0x8(%ebp)
+  802d7a:	e8 31 0c 00 00       	call   8039b0 <nsipc_socket>
+  802d7f:	83 c4 10             	add    $0x10,%esp
+  802d82:	85 c0                	test   %eax,%eax
+  802d84:	78 05                	js     802d8b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d86:	e8 89 fd ff ff       	call   802b14 <alloc_sockfd>
+}
+  802d8b:	c9                   	leave
+  802d8c:	c3                   	ret
+
+00802d8d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d8d:	55                   	push   %ebp
+  802d8e:	89 e5                	mov    %esp,%ebp
+  802d90:	53                   	push   %ebx
+  802d91:	83 ec 04             	sub    $0x4,%esp
+  802d94:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  802d96:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802d9d:	74 26                	je     802dc5 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d9f:	6a 07                	push   $0x7
+  802da1:	68 00 80 80 00       	push   $0x808000
+  802da6:	53                   	push   %ebx
+  802da7:	ff 35 e4 69 80 00    	push   0x8069e4
+  802dad:	e8 02 f2 ff ff       	call   801fb4 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802db2:	83 c4 0c             	add    $0xc,%esp
+  802db5:	6a 00                	push   $0x0
+  802db7:	6a 00                	push   $0x0
+  802db9:	6a 00                	push   $0x0
+  802dbb:	e8 64 ef ff ff       	call   801d24 <ipc_recv>
+}
+  802dc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc3:	c9                   	leave
+  802dc4:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802dc5:	83 ec 0c             	sub    $0xc,%esp
+  802dc8:	6a 03                	push   $0x3
+  802dca:	e8 4e f2 ff ff       	call   80201d <ipc_find_env>
+  802dcf:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802dd4:	83 c4 10             	add    $0x10,%esp
+  802dd7:	eb c6                	jmp    802d9f <nsipc+0x12>
+
+00802dd9 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802dd9:	55                   	push   %ebp
+  802dda:	89 e5                	mov    %esp,%ebp
+  802ddc:	56                   	push   %esi
+  802ddd:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802dde:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  802de4:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802de9:	85 f6                	test   %esi,%esi
+  802deb:	75 33                	jne    802e20 <nsbulk_map+0x47>
+  802ded:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  802df2:	83 ec 04             	sub    $0x4,%esp
+  802df5:	6a 07                	push   $0x7
+  802df7:	53                   	push   %ebx
+  802df8:	6a 00                	push   $0x0
+  802dfa:	e8 46 e3 ff ff       	call   801145 <sys_page_alloc>
+  802dff:	83 c4 10             	add    $0x10,%esp
+  802e02:	85 c0                	test   %eax,%eax
+  802e04:	78 1a                	js     802e20 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802e06:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e0c:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  802e12:	75 de                	jne    802df2 <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  802e14:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802e1b:	00 00 00 
+	return 0;
+  802e1e:	89 f0                	mov    %esi,%eax
+}
+  802e20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e23:	5b                   	pop    %ebx
+  802e24:	5e                   	pop    %esi
+  802e25:	5d                   	pop    %ebp
+  802e26:	c3                   	ret
+
+00802e27 <nsbulk_own>:
+{
+  802e27:	55                   	push   %ebp
+  802e28:	89 e5                	mov    %esp,%ebp
+  802e2a:	57                   	push   %edi
+  802e2b:	56                   	push   %esi
+  802e2c:	53                   	push   %ebx
+  802e2d:	83 ec 0c             	sub    $0xc,%esp
+  802e30:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  802e32:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802e35:	85 d2                	test   %edx,%edx
+  802e37:	7f 0e                	jg     802e47 <nsbulk_own+0x20>
+	return 0;
+  802e39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3e:	eb 47                	jmp    802e87 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  802e40:	83 c3 01             	add    $0x1,%ebx
+  802e43:	39 fb                	cmp    %edi,%ebx
+  802e45:	7d 3b                	jge    802e82 <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802e47:	be 01 00 00 00       	mov    $0x1,%esi
+  802e4c:	89 d9                	mov    %ebx,%ecx
+  802e4e:	d3 e6                	shl    %cl,%esi
+  802e50:	89 f0                	mov    %esi,%eax
+  802e52:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802e58:	74 e6                	je     802e40 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802e5a:	83 ec 04             	sub    $0x4,%esp
+  802e5d:	6a 07                	push   $0x7
+  802e5f:	89 d8                	mov    %ebx,%eax
+  802e61:	c1 e0 0c             	shl    $0xc,%eax
+  802e64:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802e69:	50                   	push   %eax
+  802e6a:	6a 00                	push   $0x0
+  802e6c:	e8 d4 e2 ff ff       	call   801145 <sys_page_alloc>
+  802e71:	83 c4 10             	add    $0x10,%esp
+  802e74:	85 c0                	test   %eax,%eax
+  802e76:	78 0f                	js     802e87 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802e78:	f7 d6                	not    %esi
+  802e7a:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  802e80:	eb be                	jmp    802e40 <nsbulk_own+0x19>
+	return 0;
+  802e82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e8a:	5b                   	pop    %ebx
+  802e8b:	5e                   	pop    %esi
+  802e8c:	5f                   	pop    %edi
+  802e8d:	5d                   	pop    %ebp
+  802e8e:	c3                   	ret
+
+00802e8f <nsipc_bulk>:
+{
+  802e8f:	55                   	push   %ebp
+  802e90:	89 e5                	mov    %esp,%ebp
+  802e92:	57                   	push   %edi
+  802e93:	56                   	push   %esi
+  802e94:	53                   	push   %ebx
+  802e95:	83 ec 1c             	sub    $0x1c,%esp
+  802e98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e9b:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802e9d:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  802ea3:	c1 fb 0c             	sar    $0xc,%ebx
+  802ea6:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802ea9:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802eb0:	74 56                	je     802f08 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802eb2:	85 ff                	test   %edi,%edi
+  802eb4:	7e 24                	jle    802eda <nsipc_bulk+0x4b>
+  802eb6:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802ebc:	74 1c                	je     802eda <nsipc_bulk+0x4b>
+  802ebe:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  802ec4:	c1 e3 0c             	shl    $0xc,%ebx
+  802ec7:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802ecc:	0f b6 10             	movzbl (%eax),%edx
+  802ecf:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802ed1:	05 00 10 00 00       	add    $0x1000,%eax
+  802ed6:	39 d8                	cmp    %ebx,%eax
+  802ed8:	75 f2                	jne    802ecc <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802eda:	83 ec 0c             	sub    $0xc,%esp
+  802edd:	56                   	push   %esi
+  802ede:	57                   	push   %edi
+  802edf:	68 00 00 00 e0       	push   $0xe0000000
+  802ee4:	ff 75 e4             	push   -0x1c(%ebp)
+  802ee7:	ff 35 e4 69 80 00    	push   0x8069e4
+  802eed:	e8 f6 f0 ff ff       	call   801fe8 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802ef2:	83 c4 1c             	add    $0x1c,%esp
+  802ef5:	6a 00                	push   $0x0
+  802ef7:	6a 00                	push   $0x0
+  802ef9:	6a 00                	push   $0x0
+  802efb:	e8 24 ee ff ff       	call   801d24 <ipc_recv>
+}
+  802f00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f03:	5b                   	pop    %ebx
+  802f04:	5e                   	pop    %esi
+  802f05:	5f                   	pop    %edi
+  802f06:	5d                   	pop    %ebp
+  802f07:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802f08:	83 ec 0c             	sub    $0xc,%esp
+  802f0b:	6a 03                	push   $0x3
+  802f0d:	e8 0b f1 ff ff       	call   80201d <ipc_find_env>
+  802f12:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802f17:	83 c4 10             	add    $0x10,%esp
+  802f1a:	eb 96                	jmp    802eb2 <nsipc_bulk+0x23>
+
+00802f1c <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802f1c:	55                   	push   %ebp
+  802f1d:	89 e5                	mov    %esp,%ebp
+  802f1f:	53                   	push   %ebx
+  802f20:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802f23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f26:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802f2b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f2e:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802f33:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f38:	e8 50 fe ff ff       	call   802d8d <nsipc>
+  802f3d:	89 c3                	mov    %eax,%ebx
+  802f3f:	85 c0                	test   %eax,%eax
+  802f41:	79 07                	jns    802f4a <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802f43:	89 d8                	mov    %ebx,%eax
+  802f45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f48:	c9                   	leave
+  802f49:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802f4a:	83 ec 04             	sub    $0x4,%esp
+  802f4d:	ff 35 10 80 80 00    	push   0x808010
+  802f53:	68 00 80 80 00       	push   $0x808000
+  802f58:	ff 75 0c             	push   0xc(%ebp)
+  802f5b:	e8 61 df ff ff       	call   800ec1 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802f60:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802f66:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f69:	89 10                	mov    %edx,(%eax)
+  802f6b:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802f6e:	eb d3                	jmp    802f43 <nsipc_accept+0x27>
+
+00802f70 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	53                   	push   %ebx
+  802f74:	83 ec 08             	sub    $0x8,%esp
+  802f77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7d:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802f82:	53                   	push   %ebx
+  802f83:	ff 75 0c             	push   0xc(%ebp)
+  802f86:	68 04 80 80 00       	push   $0x808004
+  802f8b:	e8 31 df ff ff       	call   800ec1 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802f90:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802f96:	b8 02 00 00 00       	mov    $0x2,%eax
+  802f9b:	e8 ed fd ff ff       	call   802d8d <nsipc>
+}
+  802fa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fa3:	c9                   	leave
+  802fa4:	c3                   	ret
+
+00802fa5 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802fa5:	55                   	push   %ebp
+  802fa6:	89 e5                	mov    %esp,%ebp
+  802fa8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802fab:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fae:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802fb3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fb6:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802fbb:	b8 03 00 00 00       	mov    $0x3,%eax
+  802fc0:	e8 c8 fd ff ff       	call   802d8d <nsipc>
+}
+  802fc5:	c9                   	leave
+  802fc6:	c3                   	ret
+
+00802fc7 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802fc7:	55                   	push   %ebp
+  802fc8:	89 e5                	mov    %esp,%ebp
+  802fca:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802fcd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fd0:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802fd5:	b8 04 00 00 00       	mov    $0x4,%eax
+  802fda:	e8 ae fd ff ff       	call   802d8d <nsipc>
+}
+  802fdf:	c9                   	leave
+  802fe0:	c3                   	ret
+
+00802fe1 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802fe1:	55                   	push   %ebp
+  802fe2:	89 e5                	mov    %esp,%ebp
+  802fe4:	53                   	push   %ebx
+  802fe5:	83 ec 08             	sub    $0x8,%esp
+  802fe8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802feb:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fee:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802ff3:	53                   	push   %ebx
+  802ff4:	ff 75 0c             	push   0xc(%ebp)
+  802ff7:	68 04 80 80 00       	push   $0x808004
+  802ffc:	e8 c0 de ff ff       	call   800ec1 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  803001:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  803007:	b8 05 00 00 00       	mov    $0x5,%eax
+  80300c:	e8 7c fd ff ff       	call   802d8d <nsipc>
+}
+  803011:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803014:	c9                   	leave
+  803015:	c3                   	ret
+
+00803016 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  803016:	55                   	push   %ebp
+  803017:	89 e5                	mov    %esp,%ebp
+  803019:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  80301c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80301f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  803024:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803027:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  80302c:	b8 06 00 00 00       	mov    $0x6,%eax
+  803031:	e8 57 fd ff ff       	call   802d8d <nsipc>
+}
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+
+00803038 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803038:	55                   	push   %ebp
+  803039:	89 e5                	mov    %esp,%ebp
+  80303b:	56                   	push   %esi
+  80303c:	53                   	push   %ebx
+  80303d:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803040:	8b 45 08             	mov    0x8(%ebp),%eax
+  803043:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  803048:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  80304e:	8b 45 14             	mov    0x14(%ebp),%eax
+  803051:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803056:	b8 07 00 00 00       	mov    $0x7,%eax
+  80305b:	e8 2d fd ff ff       	call   802d8d <nsipc>
+  803060:	89 c3                	mov    %eax,%ebx
+  803062:	85 c0                	test   %eax,%eax
+  803064:	78 22                	js     803088 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803066:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80306b:	39 c6                	cmp    %eax,%esi
+  80306d:	0f 4e c6             	cmovle %esi,%eax
+  803070:	39 c3                	cmp    %eax,%ebx
+  803072:	7f 1d                	jg     803091 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803074:	83 ec 04             	sub    $0x4,%esp
+  803077:	53                   	push   %ebx
+  803078:	68 00 80 80 00       	push   $0x808000
+  80307d:	ff 75 0c             	push   0xc(%ebp)
+  803080:	e8 3c de ff ff       	call   800ec1 <memmove>
+  803085:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803088:	89 d8                	mov    %ebx,%eax
+  80308a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80308d:	5b                   	pop    %ebx
+  80308e:	5e                   	pop    %esi
+  80308f:	5d                   	pop    %ebp
+  803090:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803091:	68 34 4f 80 00       	push   $0x804f34
+  803096:	68 49 4f 80 00       	push   $0x804f49
+  80309b:	68 b2 00 00 00       	push   $0xb2
+  8030a0:	68 5e 4f 80 00       	push   $0x804f5e
+  8030a5:	e8 95 d4 ff ff       	call   80053f <_panic>
+
+008030aa <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  8030aa:	55                   	push   %ebp
+  8030ab:	89 e5                	mov    %esp,%ebp
+  8030ad:	53                   	push   %ebx
+  8030ae:	83 ec 04             	sub    $0x4,%esp
+  8030b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  8030b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030b7:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  8030bc:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  8030c2:	7f 2e                	jg     8030f2 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  8030c4:	83 ec 04             	sub    $0x4,%esp
+  8030c7:	53                   	push   %ebx
+  8030c8:	ff 75 0c             	push   0xc(%ebp)
+  8030cb:	68 0c 80 80 00       	push   $0x80800c
+  8030d0:	e8 ec dd ff ff       	call   800ec1 <memmove>
+	nsipcbuf.send.req_size = size;
+  8030d5:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  8030db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8030de:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  8030e3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8030e8:	e8 a0 fc ff ff       	call   802d8d <nsipc>
+}
+  8030ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f0:	c9                   	leave
+  8030f1:	c3                   	ret
+	assert(size < 1600);
+  8030f2:	68 6a 4f 80 00       	push   $0x804f6a
+  8030f7:	68 49 4f 80 00       	push   $0x804f49
+  8030fc:	68 bd 00 00 00       	push   $0xbd
+  803101:	68 5e 4f 80 00       	push   $0x804f5e
+  803106:	e8 34 d4 ff ff       	call   80053f <_panic>
+
+0080310b <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80310b:	55                   	push   %ebp
+  80310c:	89 e5                	mov    %esp,%ebp
+  80310e:	57                   	push   %edi
+  80310f:	56                   	push   %esi
+  803110:	53                   	push   %ebx
+  803111:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  803114:	e8 c0 fc ff ff       	call   802dd9 <nsbulk_map>
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	78 55                	js     803172 <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  80311d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  803124:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  80312b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803132:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803135:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803138:	0f 8d 24 02 00 00    	jge    803362 <nsipc_sendmsg+0x257>
+  80313e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803141:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803144:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  803147:	89 d8                	mov    %ebx,%eax
+  803149:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80314e:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  803150:	83 ec 0c             	sub    $0xc,%esp
+  803153:	68 e0 66 80 00       	push   $0x8066e0
+  803158:	e8 bc 0f 00 00       	call   804119 <pgbatch_init>
+  80315d:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803160:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  803162:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  803165:	e9 82 00 00 00       	jmp    8031ec <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  80316a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80316d:	85 db                	test   %ebx,%ebx
+  80316f:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  803172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803175:	5b                   	pop    %ebx
+  803176:	5e                   	pop    %esi
+  803177:	5f                   	pop    %edi
+  803178:	5d                   	pop    %ebp
+  803179:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  80317a:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80317f:	29 c8                	sub    %ecx,%eax
+  803181:	39 d0                	cmp    %edx,%eax
+  803183:	0f 46 d0             	cmovbe %eax,%edx
+  803186:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  803188:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80318e:	85 ff                	test   %edi,%edi
+  803190:	0f 49 c7             	cmovns %edi,%eax
+  803193:	c1 f8 0c             	sar    $0xc,%eax
+  803196:	ba 01 00 00 00       	mov    $0x1,%edx
+  80319b:	e8 87 fc ff ff       	call   802e27 <nsbulk_own>
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 88 17 01 00 00    	js     8032bf <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  8031a8:	83 ec 04             	sub    $0x4,%esp
+  8031ab:	56                   	push   %esi
+  8031ac:	ff 75 e0             	push   -0x20(%ebp)
+  8031af:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8031b2:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8031b7:	50                   	push   %eax
+  8031b8:	e8 04 dd ff ff       	call   800ec1 <memmove>
+  8031bd:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  8031c0:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8031c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031c6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8031c9:	0f 84 fd 00 00 00    	je     8032cc <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  8031cf:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8031d2:	01 f7                	add    %esi,%edi
+  8031d4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8031d7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8031da:	0f 8d 01 01 00 00    	jge    8032e1 <nsipc_sendmsg+0x1d6>
+  8031e0:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  8031e6:	0f 8f f0 00 00 00    	jg     8032dc <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  8031ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031ef:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8031f2:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  8031f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031f8:	89 c2                	mov    %eax,%edx
+  8031fa:	03 13                	add    (%ebx),%edx
+  8031fc:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8031ff:	8b 73 04             	mov    0x4(%ebx),%esi
+  803202:	29 c6                	sub    %eax,%esi
+  803204:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  803209:	29 f9                	sub    %edi,%ecx
+  80320b:	39 ce                	cmp    %ecx,%esi
+  80320d:	89 ca                	mov    %ecx,%edx
+  80320f:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  803212:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  803215:	89 f9                	mov    %edi,%ecx
+  803217:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  80321d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803220:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803225:	09 c8                	or     %ecx,%eax
+  803227:	0f 85 4d ff ff ff    	jne    80317a <nsipc_sendmsg+0x6f>
+  80322d:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  803233:	0f 86 41 ff ff ff    	jbe    80317a <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803239:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  80323f:	85 ff                	test   %edi,%edi
+  803241:	0f 49 c7             	cmovns %edi,%eax
+  803244:	c1 f8 0c             	sar    $0xc,%eax
+  803247:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  803249:	89 d1                	mov    %edx,%ecx
+  80324b:	c1 e9 0c             	shr    $0xc,%ecx
+  80324e:	01 c8                	add    %ecx,%eax
+  803250:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  803253:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803256:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  803258:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80325b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  803260:	29 c8                	sub    %ecx,%eax
+  803262:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803265:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  803268:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  80326a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80326f:	89 f9                	mov    %edi,%ecx
+  803271:	d3 e0                	shl    %cl,%eax
+  803273:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803279:	83 ec 08             	sub    $0x8,%esp
+  80327c:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  80327e:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  803281:	50                   	push   %eax
+  803282:	6a 00                	push   $0x0
+  803284:	56                   	push   %esi
+  803285:	6a 00                	push   $0x0
+  803287:	68 e0 66 80 00       	push   $0x8066e0
+  80328c:	e8 46 0f 00 00       	call   8041d7 <pgbatch_map>
+  803291:	83 c4 20             	add    $0x20,%esp
+  803294:	85 c0                	test   %eax,%eax
+  803296:	0f 88 ce fe ff ff    	js     80316a <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  80329c:	83 c7 01             	add    $0x1,%edi
+  80329f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8032a5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8032a8:	39 c7                	cmp    %eax,%edi
+  8032aa:	75 be                	jne    80326a <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  8032ac:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8032af:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  8032b2:	89 d6                	mov    %edx,%esi
+  8032b4:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8032ba:	e9 01 ff ff ff       	jmp    8031c0 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  8032bf:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8032c2:	85 db                	test   %ebx,%ebx
+  8032c4:	0f 45 c3             	cmovne %ebx,%eax
+  8032c7:	e9 a6 fe ff ff       	jmp    803172 <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  8032cc:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  8032d0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8032d7:	e9 f3 fe ff ff       	jmp    8031cf <nsipc_sendmsg+0xc4>
+  8032dc:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8032df:	eb 03                	jmp    8032e4 <nsipc_sendmsg+0x1d9>
+  8032e1:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  8032e4:	83 ec 0c             	sub    $0xc,%esp
+  8032e7:	68 e0 66 80 00       	push   $0x8066e0
+  8032ec:	e8 36 0e 00 00       	call   804127 <pgbatch_flush>
+  8032f1:	83 c4 10             	add    $0x10,%esp
+  8032f4:	85 c0                	test   %eax,%eax
+  8032f6:	78 50                	js     803348 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8032f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032fb:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  803300:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  803306:	89 fb                	mov    %edi,%ebx
+  803308:	29 f3                	sub    %esi,%ebx
+  80330a:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  803310:	8b 45 14             	mov    0x14(%ebp),%eax
+  803313:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  803318:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80331d:	89 fa                	mov    %edi,%edx
+  80331f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  803324:	e8 66 fb ff ff       	call   802e8f <nsipc_bulk>
+  803329:	85 c0                	test   %eax,%eax
+  80332b:	78 28                	js     803355 <nsipc_sendmsg+0x24a>
+		sent += r;
+  80332d:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  803330:	39 c3                	cmp    %eax,%ebx
+  803332:	75 0c                	jne    803340 <nsipc_sendmsg+0x235>
+  803334:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803337:	39 45 10             	cmp    %eax,0x10(%ebp)
+  80333a:	0f 8f f2 fd ff ff    	jg     803132 <nsipc_sendmsg+0x27>
+		sent += r;
+  803340:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803343:	e9 2a fe ff ff       	jmp    803172 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803348:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80334b:	85 db                	test   %ebx,%ebx
+  80334d:	0f 45 c3             	cmovne %ebx,%eax
+  803350:	e9 1d fe ff ff       	jmp    803172 <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  803355:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  803358:	85 db                	test   %ebx,%ebx
+  80335a:	0f 45 c3             	cmovne %ebx,%eax
+  80335d:	e9 10 fe ff ff       	jmp    803172 <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  803362:	83 ec 0c             	sub    $0xc,%esp
+  803365:	68 e0 66 80 00       	push   $0x8066e0
+  80336a:	e8 aa 0d 00 00       	call   804119 <pgbatch_init>
+  80336f:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  803372:	be 00 00 00 00       	mov    $0x0,%esi
+  803377:	bf 00 00 00 00       	mov    $0x0,%edi
+  80337c:	e9 63 ff ff ff       	jmp    8032e4 <nsipc_sendmsg+0x1d9>
+
+00803381 <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  803381:	55                   	push   %ebp
+  803382:	89 e5                	mov    %esp,%ebp
+  803384:	57                   	push   %edi
+  803385:	56                   	push   %esi
+  803386:	53                   	push   %ebx
+  803387:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  80338a:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  803391:	0f 84 c8 00 00 00    	je     80345f <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  803397:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  80339e:	0f 84 e4 00 00 00    	je     803488 <nsipc_sendfile+0x107>
+{
+  8033a4:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  8033a9:	89 fb                	mov    %edi,%ebx
+  8033ab:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  8033ae:	0f 83 f0 00 00 00    	jae    8034a4 <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  8033b4:	89 fa                	mov    %edi,%edx
+  8033b6:	03 55 10             	add    0x10(%ebp),%edx
+  8033b9:	89 d0                	mov    %edx,%eax
+  8033bb:	c1 f8 1f             	sar    $0x1f,%eax
+  8033be:	c1 e8 14             	shr    $0x14,%eax
+  8033c1:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  8033c4:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8033ca:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  8033cc:	6a 10                	push   $0x10
+  8033ce:	68 00 20 01 e0       	push   $0xe0012000
+  8033d3:	52                   	push   %edx
+  8033d4:	ff 75 0c             	push   0xc(%ebp)
+  8033d7:	e8 fe f4 ff ff       	call   8028da <fmap>
+  8033dc:	83 c4 10             	add    $0x10,%esp
+  8033df:	85 c0                	test   %eax,%eax
+  8033e1:	0f 8e b8 00 00 00    	jle    80349f <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  8033e7:	39 c6                	cmp    %eax,%esi
+  8033e9:	0f 8d b5 00 00 00    	jge    8034a4 <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  8033ef:	29 f0                	sub    %esi,%eax
+  8033f1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033f4:	29 da                	sub    %ebx,%edx
+  8033f6:	39 d0                	cmp    %edx,%eax
+  8033f8:	89 d3                	mov    %edx,%ebx
+  8033fa:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8033fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803400:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  803405:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  80340b:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  803411:	8b 45 18             	mov    0x18(%ebp),%eax
+  803414:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803419:	83 ec 0c             	sub    $0xc,%esp
+  80341c:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  80341e:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  803425:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  803428:	83 c0 01             	add    $0x1,%eax
+  80342b:	50                   	push   %eax
+  80342c:	68 00 10 01 e0       	push   $0xe0011000
+  803431:	6a 11                	push   $0x11
+  803433:	ff 35 e4 69 80 00    	push   0x8069e4
+  803439:	e8 aa eb ff ff       	call   801fe8 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80343e:	83 c4 1c             	add    $0x1c,%esp
+  803441:	6a 00                	push   $0x0
+  803443:	6a 00                	push   $0x0
+  803445:	6a 00                	push   $0x0
+  803447:	e8 d8 e8 ff ff       	call   801d24 <ipc_recv>
+  80344c:	83 c4 10             	add    $0x10,%esp
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	78 5b                	js     8034ae <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  803453:	01 c7                	add    %eax,%edi
+		if (r < n)
+  803455:	39 c3                	cmp    %eax,%ebx
+  803457:	0f 8e 4c ff ff ff    	jle    8033a9 <nsipc_sendfile+0x28>
+  80345d:	eb 45                	jmp    8034a4 <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  80345f:	83 ec 04             	sub    $0x4,%esp
+  803462:	6a 07                	push   $0x7
+  803464:	68 00 10 01 e0       	push   $0xe0011000
+  803469:	6a 00                	push   $0x0
+  80346b:	e8 d5 dc ff ff       	call   801145 <sys_page_alloc>
+  803470:	89 c7                	mov    %eax,%edi
+  803472:	83 c4 10             	add    $0x10,%esp
+  803475:	85 c0                	test   %eax,%eax
+  803477:	78 2b                	js     8034a4 <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  803479:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  803480:	00 00 00 
+  803483:	e9 0f ff ff ff       	jmp    803397 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  803488:	83 ec 0c             	sub    $0xc,%esp
+  80348b:	6a 03                	push   $0x3
+  80348d:	e8 8b eb ff ff       	call   80201d <ipc_find_env>
+  803492:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  803497:	83 c4 10             	add    $0x10,%esp
+  80349a:	e9 05 ff ff ff       	jmp    8033a4 <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  80349f:	85 ff                	test   %edi,%edi
+  8034a1:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  8034a4:	89 f8                	mov    %edi,%eax
+  8034a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a9:	5b                   	pop    %ebx
+  8034aa:	5e                   	pop    %esi
+  8034ab:	5f                   	pop    %edi
+  8034ac:	5d                   	pop    %ebp
+  8034ad:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8034ae:	85 ff                	test   %edi,%edi
+  8034b0:	0f 44 f8             	cmove  %eax,%edi
+  8034b3:	eb ef                	jmp    8034a4 <nsipc_sendfile+0x123>
+
+008034b5 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8034b5:	55                   	push   %ebp
+  8034b6:	89 e5                	mov    %esp,%ebp
+  8034b8:	57                   	push   %edi
+  8034b9:	56                   	push   %esi
+  8034ba:	53                   	push   %ebx
+  8034bb:	83 ec 1c             	sub    $0x1c,%esp
+  8034be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  8034c1:	e8 13 f9 ff ff       	call   802dd9 <nsbulk_map>
+  8034c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	0f 88 ba 00 00 00    	js     80358b <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8034d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034d5:	0f 8e bb 00 00 00    	jle    803596 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  8034db:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8034e0:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  8034e5:	bf 00 00 01 00       	mov    $0x10000,%edi
+  8034ea:	89 f8                	mov    %edi,%eax
+  8034ec:	29 f0                	sub    %esi,%eax
+  8034ee:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  8034f2:	39 c8                	cmp    %ecx,%eax
+  8034f4:	0f 47 c1             	cmova  %ecx,%eax
+  8034f7:	01 f0                	add    %esi,%eax
+  8034f9:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8034fb:	83 c2 01             	add    $0x1,%edx
+  8034fe:	39 55 10             	cmp    %edx,0x10(%ebp)
+  803501:	7e 07                	jle    80350a <nsipc_recvmsg+0x55>
+  803503:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803508:	7e e0                	jle    8034ea <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  80350a:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  803510:	c1 fa 0c             	sar    $0xc,%edx
+  803513:	b8 00 00 00 00       	mov    $0x0,%eax
+  803518:	e8 0a f9 ff ff       	call   802e27 <nsbulk_own>
+  80351d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803520:	85 c0                	test   %eax,%eax
+  803522:	78 67                	js     80358b <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  803524:	8b 45 08             	mov    0x8(%ebp),%eax
+  803527:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  80352c:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  803532:	8b 45 14             	mov    0x14(%ebp),%eax
+  803535:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  80353a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80353f:	89 f2                	mov    %esi,%edx
+  803541:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803546:	e8 44 f9 ff ff       	call   802e8f <nsipc_bulk>
+  80354b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80354e:	85 c0                	test   %eax,%eax
+  803550:	78 39                	js     80358b <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  803552:	39 f0                	cmp    %esi,%eax
+  803554:	7f 4a                	jg     8035a0 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803556:	bf 00 00 00 00       	mov    $0x0,%edi
+  80355b:	85 c0                	test   %eax,%eax
+  80355d:	7e 2c                	jle    80358b <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80355f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  803562:	29 fe                	sub    %edi,%esi
+  803564:	8b 43 04             	mov    0x4(%ebx),%eax
+  803567:	39 c6                	cmp    %eax,%esi
+  803569:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  80356c:	83 ec 04             	sub    $0x4,%esp
+  80356f:	56                   	push   %esi
+  803570:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  803576:	50                   	push   %eax
+  803577:	ff 33                	push   (%ebx)
+  803579:	e8 43 d9 ff ff       	call   800ec1 <memmove>
+		n += m;
+  80357e:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  803580:	83 c3 08             	add    $0x8,%ebx
+  803583:	83 c4 10             	add    $0x10,%esp
+  803586:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  803589:	7f d4                	jg     80355f <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  80358b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80358e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803591:	5b                   	pop    %ebx
+  803592:	5e                   	pop    %esi
+  803593:	5f                   	pop    %edi
+  803594:	5d                   	pop    %ebp
+  803595:	c3                   	ret
+	int r, i, n, len = 0;
+  803596:	be 00 00 00 00       	mov    $0x0,%esi
+  80359b:	e9 6a ff ff ff       	jmp    80350a <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8035a0:	68 40 4f 80 00       	push   $0x804f40
+  8035a5:	68 49 4f 80 00       	push   $0x804f49
+  8035aa:	68 3b 01 00 00       	push   $0x13b
+  8035af:	68 5e 4f 80 00       	push   $0x804f5e
+  8035b4:	e8 86 cf ff ff       	call   80053f <_panic>
+
+008035b9 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8035b9:	55                   	push   %ebp
+  8035ba:	89 e5                	mov    %esp,%ebp
+  8035bc:	57                   	push   %edi
+  8035bd:	56                   	push   %esi
+  8035be:	53                   	push   %ebx
+  8035bf:	83 ec 0c             	sub    $0xc,%esp
+  8035c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8035c5:	8b 75 10             	mov    0x10(%ebp),%esi
+  8035c8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  8035cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ce:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  8035d3:	8b 07                	mov    (%edi),%eax
+  8035d5:	a3 04 80 80 00       	mov    %eax,0x808004
+  8035da:	8b 47 04             	mov    0x4(%edi),%eax
+  8035dd:	a3 08 80 80 00       	mov    %eax,0x808008
+  8035e2:	8b 47 08             	mov    0x8(%edi),%eax
+  8035e5:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  8035ea:	8b 47 0c             	mov    0xc(%edi),%eax
+  8035ed:	a3 10 80 80 00       	mov    %eax,0x808010
+  8035f2:	8b 47 10             	mov    0x10(%edi),%eax
+  8035f5:	a3 14 80 80 00       	mov    %eax,0x808014
+  8035fa:	8b 47 14             	mov    0x14(%edi),%eax
+  8035fd:	a3 18 80 80 00       	mov    %eax,0x808018
+  803602:	8b 47 18             	mov    0x18(%edi),%eax
+  803605:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  80360a:	8b 47 1c             	mov    0x1c(%edi),%eax
+  80360d:	a3 20 80 80 00       	mov    %eax,0x808020
+  803612:	8b 47 20             	mov    0x20(%edi),%eax
+  803615:	a3 24 80 80 00       	mov    %eax,0x808024
+  80361a:	8b 47 24             	mov    0x24(%edi),%eax
+  80361d:	a3 28 80 80 00       	mov    %eax,0x808028
+  803622:	8b 47 28             	mov    0x28(%edi),%eax
+  803625:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  80362a:	8b 47 2c             	mov    0x2c(%edi),%eax
+  80362d:	a3 30 80 80 00       	mov    %eax,0x808030
+  803632:	8b 47 30             	mov    0x30(%edi),%eax
+  803635:	a3 34 80 80 00       	mov    %eax,0x808034
+  80363a:	8b 47 34             	mov    0x34(%edi),%eax
+  80363d:	a3 38 80 80 00       	mov    %eax,0x808038
+  803642:	8b 47 38             	mov    0x38(%edi),%eax
+  803645:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  80364a:	8b 47 3c             	mov    0x3c(%edi),%eax
+  80364d:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  803652:	8b 06                	mov    (%esi),%eax
+  803654:	a3 44 80 80 00       	mov    %eax,0x808044
+  803659:	8b 46 04             	mov    0x4(%esi),%eax
+  80365c:	a3 48 80 80 00       	mov    %eax,0x808048
+  803661:	8b 46 08             	mov    0x8(%esi),%eax
+  803664:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  803669:	8b 46 0c             	mov    0xc(%esi),%eax
+  80366c:	a3 50 80 80 00       	mov    %eax,0x808050
+  803671:	8b 46 10             	mov    0x10(%esi),%eax
+  803674:	a3 54 80 80 00       	mov    %eax,0x808054
+  803679:	8b 46 14             	mov    0x14(%esi),%eax
+  80367c:	a3 58 80 80 00       	mov    %eax,0x808058
+  803681:	8b 46 18             	mov    0x18(%esi),%eax
+  803684:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  803689:	8b 46 1c             	mov    0x1c(%esi),%eax
+  80368c:	a3 60 80 80 00       	mov    %eax,0x808060
+  803691:	8b 46 20             	mov    0x20(%esi),%eax
+  803694:	a3 64 80 80 00       	mov    %eax,0x808064
+  803699:	8b 46 24             	mov    0x24(%esi),%eax
+  80369c:	a3 68 80 80 00       	mov    %eax,0x808068
+  8036a1:	8b 46 28             	mov    0x28(%esi),%eax
+  8036a4:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8036a9:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8036ac:	a3 70 80 80 00       	mov    %eax,0x808070
+  8036b1:	8b 46 30             	mov    0x30(%esi),%eax
+  8036b4:	a3 74 80 80 00       	mov    %eax,0x808074
+  8036b9:	8b 46 34             	mov    0x34(%esi),%eax
+  8036bc:	a3 78 80 80 00       	mov    %eax,0x808078
+  8036c1:	8b 46 38             	mov    0x38(%esi),%eax
+  8036c4:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  8036c9:	8b 46 3c             	mov    0x3c(%esi),%eax
+  8036cc:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  8036d1:	8b 03                	mov    (%ebx),%eax
+  8036d3:	a3 84 80 80 00       	mov    %eax,0x808084
+  8036d8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8036db:	a3 88 80 80 00       	mov    %eax,0x808088
+  8036e0:	8b 43 08             	mov    0x8(%ebx),%eax
+  8036e3:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  8036e8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8036eb:	a3 90 80 80 00       	mov    %eax,0x808090
+  8036f0:	8b 43 10             	mov    0x10(%ebx),%eax
+  8036f3:	a3 94 80 80 00       	mov    %eax,0x808094
+  8036f8:	8b 43 14             	mov    0x14(%ebx),%eax
+  8036fb:	a3 98 80 80 00       	mov    %eax,0x808098
+  803700:	8b 43 18             	mov    0x18(%ebx),%eax
+  803703:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803708:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80370b:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  803710:	8b 43 20             	mov    0x20(%ebx),%eax
+  803713:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803718:	8b 43 24             	mov    0x24(%ebx),%eax
+  80371b:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  803720:	8b 43 28             	mov    0x28(%ebx),%eax
+  803723:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803728:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  80372b:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  803730:	8b 43 30             	mov    0x30(%ebx),%eax
+  803733:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803738:	8b 43 34             	mov    0x34(%ebx),%eax
+  80373b:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  803740:	8b 43 38             	mov    0x38(%ebx),%eax
+  803743:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803748:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  80374b:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  803750:	8b 45 18             	mov    0x18(%ebp),%eax
+  803753:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803758:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80375d:	e8 2b f6 ff ff       	call   802d8d <nsipc>
+  803762:	85 c0                	test   %eax,%eax
+  803764:	0f 88 ad 01 00 00    	js     803917 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  80376a:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803770:	89 17                	mov    %edx,(%edi)
+  803772:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803778:	89 57 04             	mov    %edx,0x4(%edi)
+  80377b:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803781:	89 57 08             	mov    %edx,0x8(%edi)
+  803784:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  80378a:	89 57 0c             	mov    %edx,0xc(%edi)
+  80378d:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803793:	89 57 10             	mov    %edx,0x10(%edi)
+  803796:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  80379c:	89 57 14             	mov    %edx,0x14(%edi)
+  80379f:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8037a5:	89 57 18             	mov    %edx,0x18(%edi)
+  8037a8:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8037ae:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8037b1:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8037b7:	89 57 20             	mov    %edx,0x20(%edi)
+  8037ba:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8037c0:	89 57 24             	mov    %edx,0x24(%edi)
+  8037c3:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  8037c9:	89 57 28             	mov    %edx,0x28(%edi)
+  8037cc:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  8037d2:	89 57 2c             	mov    %edx,0x2c(%edi)
+  8037d5:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  8037db:	89 57 30             	mov    %edx,0x30(%edi)
+  8037de:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  8037e4:	89 57 34             	mov    %edx,0x34(%edi)
+  8037e7:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  8037ed:	89 57 38             	mov    %edx,0x38(%edi)
+  8037f0:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8037f6:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8037f9:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8037ff:	89 16                	mov    %edx,(%esi)
+  803801:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803807:	89 56 04             	mov    %edx,0x4(%esi)
+  80380a:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  803810:	89 56 08             	mov    %edx,0x8(%esi)
+  803813:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803819:	89 56 0c             	mov    %edx,0xc(%esi)
+  80381c:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  803822:	89 56 10             	mov    %edx,0x10(%esi)
+  803825:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  80382b:	89 56 14             	mov    %edx,0x14(%esi)
+  80382e:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  803834:	89 56 18             	mov    %edx,0x18(%esi)
+  803837:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  80383d:	89 56 1c             	mov    %edx,0x1c(%esi)
+  803840:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803846:	89 56 20             	mov    %edx,0x20(%esi)
+  803849:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80384f:	89 56 24             	mov    %edx,0x24(%esi)
+  803852:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803858:	89 56 28             	mov    %edx,0x28(%esi)
+  80385b:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  803861:	89 56 2c             	mov    %edx,0x2c(%esi)
+  803864:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  80386a:	89 56 30             	mov    %edx,0x30(%esi)
+  80386d:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  803873:	89 56 34             	mov    %edx,0x34(%esi)
+  803876:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  80387c:	89 56 38             	mov    %edx,0x38(%esi)
+  80387f:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  803885:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  803888:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  80388e:	89 13                	mov    %edx,(%ebx)
+  803890:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  803896:	89 53 04             	mov    %edx,0x4(%ebx)
+  803899:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  80389f:	89 53 08             	mov    %edx,0x8(%ebx)
+  8038a2:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8038a8:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8038ab:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8038b1:	89 53 10             	mov    %edx,0x10(%ebx)
+  8038b4:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8038ba:	89 53 14             	mov    %edx,0x14(%ebx)
+  8038bd:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8038c3:	89 53 18             	mov    %edx,0x18(%ebx)
+  8038c6:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  8038cc:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  8038cf:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  8038d5:	89 53 20             	mov    %edx,0x20(%ebx)
+  8038d8:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  8038de:	89 53 24             	mov    %edx,0x24(%ebx)
+  8038e1:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  8038e7:	89 53 28             	mov    %edx,0x28(%ebx)
+  8038ea:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  8038f0:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  8038f3:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  8038f9:	89 53 30             	mov    %edx,0x30(%ebx)
+  8038fc:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  803902:	89 53 34             	mov    %edx,0x34(%ebx)
+  803905:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  80390b:	89 53 38             	mov    %edx,0x38(%ebx)
+  80390e:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  803914:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803917:	83 c4 0c             	add    $0xc,%esp
+  80391a:	5b                   	pop    %ebx
+  80391b:	5e                   	pop    %esi
+  80391c:	5f                   	pop    %edi
+  80391d:	5d                   	pop    %ebp
+  80391e:	c3                   	ret
+
+0080391f <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80391f:	55                   	push   %ebp
+  803920:	89 e5                	mov    %esp,%ebp
+  803922:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803925:	8b 45 08             	mov    0x8(%ebp),%eax
+  803928:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  80392d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803930:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803935:	8b 45 10             	mov    0x10(%ebp),%eax
+  803938:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  80393d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  803942:	e8 46 f4 ff ff       	call   802d8d <nsipc>
+}
+  803947:	c9                   	leave
+  803948:	c3                   	ret
+
+00803949 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803949:	55                   	push   %ebp
+  80394a:	89 e5                	mov    %esp,%ebp
+  80394c:	56                   	push   %esi
+  80394d:	53                   	push   %ebx
+  80394e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  803951:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803957:	8b 45 10             	mov    0x10(%ebp),%eax
+  80395a:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80395f:	b8 10 00 00 00       	mov    $0x10,%eax
+  803964:	e8 24 f4 ff ff       	call   802d8d <nsipc>
+  803969:	89 c3                	mov    %eax,%ebx
+  80396b:	85 c0                	test   %eax,%eax
+  80396d:	7e 1f                	jle    80398e <nsipc_evwait+0x45>
+		assert(r <= max);
+  80396f:	39 c6                	cmp    %eax,%esi
+  803971:	7c 24                	jl     803997 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  803973:	83 ec 04             	sub    $0x4,%esp
+  803976:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  80397d:	50                   	push   %eax
+  80397e:	68 00 80 80 00       	push   $0x808000
+  803983:	ff 75 08             	push   0x8(%ebp)
+  803986:	e8 36 d5 ff ff       	call   800ec1 <memmove>
+  80398b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80398e:	89 d8                	mov    %ebx,%eax
+  803990:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803993:	5b                   	pop    %ebx
+  803994:	5e                   	pop    %esi
+  803995:	5d                   	pop    %ebp
+  803996:	c3                   	ret
+		assert(r <= max);
+  803997:	68 76 4f 80 00       	push   $0x804f76
+  80399c:	68 49 4f 80 00       	push   $0x804f49
+  8039a1:	68 6a 01 00 00       	push   $0x16a
+  8039a6:	68 5e 4f 80 00       	push   $0x804f5e
+  8039ab:	e8 8f cb ff ff       	call   80053f <_panic>
+
+008039b0 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8039b0:	55                   	push   %ebp
+  8039b1:	89 e5                	mov    %esp,%ebp
+  8039b3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8039b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039b9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8039be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8039c1:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  8039c6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8039c9:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  8039ce:	b8 09 00 00 00       	mov    $0x9,%eax
+  8039d3:	e8 b5 f3 ff ff       	call   802d8d <nsipc>
+}
+  8039d8:	c9                   	leave
+  8039d9:	c3                   	ret
+
+008039da <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  8039da:	55                   	push   %ebp
+  8039db:	89 e5                	mov    %esp,%ebp
+  8039dd:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  8039e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039e3:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  8039e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8039ed:	e8 9b f3 ff ff       	call   802d8d <nsipc>
+}
+  8039f2:	c9                   	leave
+  8039f3:	c3                   	ret
+
+008039f4 <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  8039f4:	55                   	push   %ebp
+  8039f5:	89 e5                	mov    %esp,%ebp
+  8039f7:	53                   	push   %ebx
+  8039f8:	83 ec 04             	sub    $0x4,%esp
+  8039fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  8039fe:	b8 12 00 00 00       	mov    $0x12,%eax
+  803a03:	e8 85 f3 ff ff       	call   802d8d <nsipc>
+  803a08:	85 c0                	test   %eax,%eax
+  803a0a:	78 50                	js     803a5c <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803a0c:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  803a12:	89 13                	mov    %edx,(%ebx)
+  803a14:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803a1a:	89 53 04             	mov    %edx,0x4(%ebx)
+  803a1d:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  803a23:	89 53 08             	mov    %edx,0x8(%ebx)
+  803a26:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803a2c:	89 53 0c             	mov    %edx,0xc(%ebx)
+  803a2f:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803a35:	89 53 10             	mov    %edx,0x10(%ebx)
+  803a38:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803a3e:	89 53 14             	mov    %edx,0x14(%ebx)
+  803a41:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803a47:	89 53 18             	mov    %edx,0x18(%ebx)
+  803a4a:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  803a50:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  803a53:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803a59:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803a5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a5f:	c9                   	leave
+  803a60:	c3                   	ret
+
+00803a61 <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  803a61:	55                   	push   %ebp
+  803a62:	89 e5                	mov    %esp,%ebp
+  803a64:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  803a67:	6a 03                	push   $0x3
+  803a69:	e8 af e5 ff ff       	call   80201d <ipc_find_env>
+  803a6e:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  803a73:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a76:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  803a7b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  803a80:	e8 08 f3 ff ff       	call   802d8d <nsipc>
+  803a85:	83 c4 10             	add    $0x10,%esp
+  803a88:	85 c0                	test   %eax,%eax
+  803a8a:	78 0a                	js     803a96 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  803a8c:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  803a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a96:	c9                   	leave
+  803a97:	c3                   	ret
+
+00803a98 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  803a98:	55                   	push   %ebp
+  803a99:	89 e5                	mov    %esp,%ebp
+  803a9b:	57                   	push   %edi
+  803a9c:	56                   	push   %esi
+  803a9d:	53                   	push   %ebx
+  803a9e:	83 ec 1c             	sub    $0x1c,%esp
+  803aa1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803aa4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803aa7:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  803aac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ab1:	89 e0                	mov    %esp,%eax
+  803ab3:	89 f2                	mov    %esi,%edx
+  803ab5:	29 c2                	sub    %eax,%edx
+  803ab7:	89 d0                	mov    %edx,%eax
+  803ab9:	c1 e8 0f             	shr    $0xf,%eax
+  803abc:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  803ac2:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803ac5:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803acc:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  803acf:	83 ec 0c             	sub    $0xc,%esp
+  803ad2:	ff 75 e0             	push   -0x20(%ebp)
+  803ad5:	e8 a3 0b 00 00       	call   80467d <pageref>
+  803ada:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803add:	83 c4 04             	add    $0x4,%esp
+  803ae0:	ff 75 dc             	push   -0x24(%ebp)
+  803ae3:	e8 95 0b 00 00       	call   80467d <pageref>
+  803ae8:	89 e2                	mov    %esp,%edx
+  803aea:	89 f1                	mov    %esi,%ecx
+  803aec:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803aee:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  803af1:	89 ca                	mov    %ecx,%edx
+  803af3:	c1 ea 0f             	shr    $0xf,%edx
+  803af6:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803afc:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  803aff:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803b06:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803b09:	39 d7                	cmp    %edx,%edi
+  803b0b:	74 40                	je     803b4d <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803b0d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803b10:	75 9f                	jne    803ab1 <_pipeisclosed+0x19>
+  803b12:	89 e2                	mov    %esp,%edx
+  803b14:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803b19:	29 d0                	sub    %edx,%eax
+  803b1b:	89 c2                	mov    %eax,%edx
+  803b1d:	c1 ea 0f             	shr    $0xf,%edx
+  803b20:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2a:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803b2d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803b34:	8b 40 58             	mov    0x58(%eax),%eax
+  803b37:	6a 01                	push   $0x1
+  803b39:	50                   	push   %eax
+  803b3a:	57                   	push   %edi
+  803b3b:	68 7f 4f 80 00       	push   $0x804f7f
+  803b40:	e8 d5 ca ff ff       	call   80061a <cprintf>
+  803b45:	83 c4 10             	add    $0x10,%esp
+  803b48:	e9 5f ff ff ff       	jmp    803aac <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803b4d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803b50:	0f 94 c0             	sete   %al
+  803b53:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803b56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b59:	5b                   	pop    %ebx
+  803b5a:	5e                   	pop    %esi
+  803b5b:	5f                   	pop    %edi
+  803b5c:	5d                   	pop    %ebp
+  803b5d:	c3                   	ret
+
+00803b5e <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803b5e:	55                   	push   %ebp
+  803b5f:	89 e5                	mov    %esp,%ebp
+  803b61:	53                   	push   %ebx
+  803b62:	83 ec 0c             	sub    $0xc,%esp
+  803b65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803b68:	53                   	push   %ebx
+  803b69:	6a 00                	push   $0x0
+  803b6b:	e8 5a d6 ff ff       	call   8011ca <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803b70:	89 1c 24             	mov    %ebx,(%esp)
+  803b73:	e8 f4 e4 ff ff       	call   80206c <fd2data>
+  803b78:	83 c4 08             	add    $0x8,%esp
+  803b7b:	50                   	push   %eax
+  803b7c:	6a 00                	push   $0x0
+  803b7e:	e8 47 d6 ff ff       	call   8011ca <sys_page_unmap>
+}
+  803b83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b86:	c9                   	leave
+  803b87:	c3                   	ret
+
+00803b88 <devpipe_read>:
+{
+  803b88:	55                   	push   %ebp
+  803b89:	89 e5                	mov    %esp,%ebp
+  803b8b:	57                   	push   %edi
+  803b8c:	56                   	push   %esi
+  803b8d:	53                   	push   %ebx
+  803b8e:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  803b91:	ff 75 08             	push   0x8(%ebp)
+  803b94:	e8 d3 e4 ff ff       	call   80206c <fd2data>
+  803b99:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803b9b:	8b 70 04             	mov    0x4(%eax),%esi
+  803b9e:	8b 00                	mov    (%eax),%eax
+  803ba0:	83 c4 10             	add    $0x10,%esp
+  803ba3:	39 f0                	cmp    %esi,%eax
+  803ba5:	75 36                	jne    803bdd <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  803ba7:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  803baa:	89 da                	mov    %ebx,%edx
+  803bac:	8b 45 08             	mov    0x8(%ebp),%eax
+  803baf:	e8 e4 fe ff ff       	call   803a98 <_pipeisclosed>
+  803bb4:	85 c0                	test   %eax,%eax
+  803bb6:	0f 85 d4 00 00 00    	jne    803c90 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  803bbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803bc1:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803bc5:	83 ec 04             	sub    $0x4,%esp
+  803bc8:	6a ff                	push   $0xffffffff
+  803bca:	56                   	push   %esi
+  803bcb:	57                   	push   %edi
+  803bcc:	e8 72 d9 ff ff       	call   801543 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  803bd1:	8b 73 04             	mov    0x4(%ebx),%esi
+  803bd4:	8b 03                	mov    (%ebx),%eax
+  803bd6:	83 c4 10             	add    $0x10,%esp
+  803bd9:	39 c6                	cmp    %eax,%esi
+  803bdb:	74 cd                	je     803baa <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803bdd:	8b 73 04             	mov    0x4(%ebx),%esi
+  803be0:	8b 03                	mov    (%ebx),%eax
+  803be2:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803be8:	29 c6                	sub    %eax,%esi
+  803bea:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803bef:	f7 e6                	mul    %esi
+  803bf1:	c1 ea 0c             	shr    $0xc,%edx
+  803bf4:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803bfa:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803bfc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803bff:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  803c03:	8b 0b                	mov    (%ebx),%ecx
+  803c05:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803c0a:	f7 e1                	mul    %ecx
+  803c0c:	c1 ea 0b             	shr    $0xb,%edx
+  803c0f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803c15:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803c17:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803c1c:	29 cf                	sub    %ecx,%edi
+  803c1e:	39 f7                	cmp    %esi,%edi
+  803c20:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  803c23:	83 ec 04             	sub    $0x4,%esp
+  803c26:	57                   	push   %edi
+  803c27:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803c2b:	50                   	push   %eax
+  803c2c:	ff 75 0c             	push   0xc(%ebp)
+  803c2f:	e8 8d d2 ff ff       	call   800ec1 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  803c34:	83 c4 0c             	add    $0xc,%esp
+  803c37:	89 f0                	mov    %esi,%eax
+  803c39:	29 f8                	sub    %edi,%eax
+  803c3b:	50                   	push   %eax
+  803c3c:	8d 43 10             	lea    0x10(%ebx),%eax
+  803c3f:	50                   	push   %eax
+  803c40:	89 f8                	mov    %edi,%eax
+  803c42:	03 45 0c             	add    0xc(%ebp),%eax
+  803c45:	50                   	push   %eax
+  803c46:	e8 76 d2 ff ff       	call   800ec1 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803c4b:	8b 0b                	mov    (%ebx),%ecx
+  803c4d:	01 f1                	add    %esi,%ecx
+  803c4f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803c54:	f7 e1                	mul    %ecx
+  803c56:	c1 ea 0c             	shr    $0xc,%edx
+  803c59:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803c5f:	29 c1                	sub    %eax,%ecx
+  803c61:	89 0b                	mov    %ecx,(%ebx)
+  803c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c68:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  803c6c:	83 c4 10             	add    $0x10,%esp
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	75 0a                	jne    803c7d <devpipe_read+0xf5>
+	return n;
+  803c73:	89 f0                	mov    %esi,%eax
+}
+  803c75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c78:	5b                   	pop    %ebx
+  803c79:	5e                   	pop    %esi
+  803c7a:	5f                   	pop    %edi
+  803c7b:	5d                   	pop    %ebp
+  803c7c:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  803c7d:	83 ec 08             	sub    $0x8,%esp
+  803c80:	68 00 04 00 00       	push   $0x400
+  803c85:	53                   	push   %ebx
+  803c86:	e8 da d8 ff ff       	call   801565 <sys_futex_wake>
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	eb e3                	jmp    803c73 <devpipe_read+0xeb>
+			return 0;
+  803c90:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c95:	eb de                	jmp    803c75 <devpipe_read+0xed>
+
+00803c97 <devpipe_write>:
+{
+  803c97:	55                   	push   %ebp
+  803c98:	89 e5                	mov    %esp,%ebp
+  803c9a:	57                   	push   %edi
+  803c9b:	56                   	push   %esi
+  803c9c:	53                   	push   %ebx
+  803c9d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  803ca0:	ff 75 08             	push   0x8(%ebp)
+  803ca3:	e8 c4 e3 ff ff       	call   80206c <fd2data>
+  803ca8:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  803caa:	83 c4 10             	add    $0x10,%esp
+  803cad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803cb4:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  803cb9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803cbd:	0f 84 43 01 00 00    	je     803e06 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803cc3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803cc6:	8b 06                	mov    (%esi),%eax
+  803cc8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803cce:	29 c1                	sub    %eax,%ecx
+  803cd0:	89 c8                	mov    %ecx,%eax
+  803cd2:	f7 e7                	mul    %edi
+  803cd4:	c1 ea 0c             	shr    $0xc,%edx
+  803cd7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803cdd:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  803cdf:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803ce5:	75 52                	jne    803d39 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803ce7:	89 f2                	mov    %esi,%edx
+  803ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  803cec:	e8 a7 fd ff ff       	call   803a98 <_pipeisclosed>
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	0f 85 28 01 00 00    	jne    803e21 <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803cf9:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803cfb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803cfe:	8b 06                	mov    (%esi),%eax
+  803d00:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803d06:	29 c1                	sub    %eax,%ecx
+  803d08:	89 c8                	mov    %ecx,%eax
+  803d0a:	f7 e7                	mul    %edi
+  803d0c:	c1 ea 0c             	shr    $0xc,%edx
+  803d0f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803d15:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803d17:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803d1d:	75 a4                	jne    803cc3 <devpipe_write+0x2c>
+  803d1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d24:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803d28:	83 ec 04             	sub    $0x4,%esp
+  803d2b:	6a ff                	push   $0xffffffff
+  803d2d:	53                   	push   %ebx
+  803d2e:	56                   	push   %esi
+  803d2f:	e8 0f d8 ff ff       	call   801543 <sys_futex_wait>
+}
+  803d34:	83 c4 10             	add    $0x10,%esp
+  803d37:	eb 8a                	jmp    803cc3 <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803d39:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803d3c:	8b 06                	mov    (%esi),%eax
+  803d3e:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803d44:	29 c1                	sub    %eax,%ecx
+  803d46:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803d4b:	f7 e1                	mul    %ecx
+  803d4d:	c1 ea 0c             	shr    $0xc,%edx
+  803d50:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803d56:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803d58:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803d5d:	89 d8                	mov    %ebx,%eax
+  803d5f:	29 c8                	sub    %ecx,%eax
+  803d61:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d64:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803d67:	29 ca                	sub    %ecx,%edx
+  803d69:	39 d0                	cmp    %edx,%eax
+  803d6b:	0f 46 d0             	cmovbe %eax,%edx
+  803d6e:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  803d71:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803d74:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803d79:	f7 e1                	mul    %ecx
+  803d7b:	c1 ea 0b             	shr    $0xb,%edx
+  803d7e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803d84:	89 ca                	mov    %ecx,%edx
+  803d86:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803d88:	29 d3                	sub    %edx,%ebx
+  803d8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803d8d:	39 c3                	cmp    %eax,%ebx
+  803d8f:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  803d92:	83 ec 04             	sub    $0x4,%esp
+  803d95:	53                   	push   %ebx
+  803d96:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803d99:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803d9c:	51                   	push   %ecx
+  803d9d:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  803da1:	50                   	push   %eax
+  803da2:	e8 1a d1 ff ff       	call   800ec1 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803da7:	83 c4 0c             	add    $0xc,%esp
+  803daa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803dad:	29 d8                	sub    %ebx,%eax
+  803daf:	50                   	push   %eax
+  803db0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803db3:	01 cb                	add    %ecx,%ebx
+  803db5:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803db8:	53                   	push   %ebx
+  803db9:	8d 46 10             	lea    0x10(%esi),%eax
+  803dbc:	50                   	push   %eax
+  803dbd:	e8 ff d0 ff ff       	call   800ec1 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  803dc2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803dc5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803dc8:	01 c1                	add    %eax,%ecx
+  803dca:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803dcf:	f7 e1                	mul    %ecx
+  803dd1:	c1 ea 0c             	shr    $0xc,%edx
+  803dd4:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803dda:	89 ca                	mov    %ecx,%edx
+  803ddc:	29 c2                	sub    %eax,%edx
+  803dde:	89 56 04             	mov    %edx,0x4(%esi)
+  803de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803de6:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803dea:	83 c4 10             	add    $0x10,%esp
+  803ded:	85 c0                	test   %eax,%eax
+  803def:	75 1a                	jne    803e0b <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  803df1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  803df4:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803df7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803dfa:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803dfd:	0f 82 c0 fe ff ff    	jb     803cc3 <devpipe_write+0x2c>
+  803e03:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803e06:	8b 45 10             	mov    0x10(%ebp),%eax
+  803e09:	eb 1b                	jmp    803e26 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803e0b:	83 ec 08             	sub    $0x8,%esp
+  803e0e:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  803e13:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803e16:	50                   	push   %eax
+  803e17:	e8 49 d7 ff ff       	call   801565 <sys_futex_wake>
+  803e1c:	83 c4 10             	add    $0x10,%esp
+  803e1f:	eb d0                	jmp    803df1 <devpipe_write+0x15a>
+				return 0;
+  803e21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e29:	5b                   	pop    %ebx
+  803e2a:	5e                   	pop    %esi
+  803e2b:	5f                   	pop    %edi
+  803e2c:	5d                   	pop    %ebp
+  803e2d:	c3                   	ret
+
+00803e2e <devpipe_stat>:
+{
+  803e2e:	55                   	push   %ebp
+  803e2f:	89 e5                	mov    %esp,%ebp
+  803e31:	56                   	push   %esi
+  803e32:	53                   	push   %ebx
+  803e33:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803e36:	83 ec 0c             	sub    $0xc,%esp
+  803e39:	ff 75 08             	push   0x8(%ebp)
+  803e3c:	e8 2b e2 ff ff       	call   80206c <fd2data>
+  803e41:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803e43:	83 c4 08             	add    $0x8,%esp
+  803e46:	68 92 4f 80 00       	push   $0x804f92
+  803e4b:	53                   	push   %ebx
+  803e4c:	e8 c0 ce ff ff       	call   800d11 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803e51:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803e54:	8b 06                	mov    (%esi),%eax
+  803e56:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803e5c:	29 c1                	sub    %eax,%ecx
+  803e5e:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803e63:	89 c8                	mov    %ecx,%eax
+  803e65:	f7 e2                	mul    %edx
+  803e67:	c1 ea 0c             	shr    $0xc,%edx
+  803e6a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803e70:	29 d1                	sub    %edx,%ecx
+  803e72:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803e78:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803e7f:	00 00 00 
+	stat->st_dev = &devpipe;
+  803e82:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803e89:	50 80 00 
+}
+  803e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e94:	5b                   	pop    %ebx
+  803e95:	5e                   	pop    %esi
+  803e96:	5d                   	pop    %ebp
+  803e97:	c3                   	ret
+
+00803e98 <devpipe_poll>:
+{
+  803e98:	55                   	push   %ebp
+  803e99:	89 e5                	mov    %esp,%ebp
+  803e9b:	57                   	push   %edi
+  803e9c:	56                   	push   %esi
+  803e9d:	53                   	push   %ebx
+  803e9e:	83 ec 18             	sub    $0x18,%esp
+  803ea1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803ea4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803ea7:	57                   	push   %edi
+  803ea8:	e8 bf e1 ff ff       	call   80206c <fd2data>
+  803ead:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803eaf:	83 c4 10             	add    $0x10,%esp
+  803eb2:	89 f3                	mov    %esi,%ebx
+  803eb4:	83 e3 01             	and    $0x1,%ebx
+  803eb7:	75 27                	jne    803ee0 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803eb9:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803ebf:	75 48                	jne    803f09 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  803ec1:	89 ca                	mov    %ecx,%edx
+  803ec3:	89 f8                	mov    %edi,%eax
+  803ec5:	e8 ce fb ff ff       	call   803a98 <_pipeisclosed>
+  803eca:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803ecc:	89 d8                	mov    %ebx,%eax
+  803ece:	83 c8 10             	or     $0x10,%eax
+  803ed1:	85 d2                	test   %edx,%edx
+  803ed3:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803ed6:	89 d8                	mov    %ebx,%eax
+  803ed8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803edb:	5b                   	pop    %ebx
+  803edc:	5e                   	pop    %esi
+  803edd:	5f                   	pop    %edi
+  803ede:	5d                   	pop    %ebp
+  803edf:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803ee0:	8b 58 04             	mov    0x4(%eax),%ebx
+  803ee3:	8b 00                	mov    (%eax),%eax
+  803ee5:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803eeb:	29 c3                	sub    %eax,%ebx
+  803eed:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803ef2:	89 d8                	mov    %ebx,%eax
+  803ef4:	f7 e2                	mul    %edx
+  803ef6:	c1 ea 0c             	shr    $0xc,%edx
+  803ef9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803eff:	39 d3                	cmp    %edx,%ebx
+  803f01:	0f 95 c3             	setne  %bl
+  803f04:	0f b6 db             	movzbl %bl,%ebx
+  803f07:	eb b0                	jmp    803eb9 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803f09:	8b 71 04             	mov    0x4(%ecx),%esi
+  803f0c:	8b 01                	mov    (%ecx),%eax
+  803f0e:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803f14:	29 c6                	sub    %eax,%esi
+  803f16:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803f1b:	89 f0                	mov    %esi,%eax
+  803f1d:	f7 e2                	mul    %edx
+  803f1f:	c1 ea 0c             	shr    $0xc,%edx
+  803f22:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803f28:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803f2a:	89 d8                	mov    %ebx,%eax
+  803f2c:	83 c8 04             	or     $0x4,%eax
+  803f2f:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803f35:	0f 42 d8             	cmovb  %eax,%ebx
+  803f38:	eb 87                	jmp    803ec1 <devpipe_poll+0x29>
+
+00803f3a <pipe>:
+{
+  803f3a:	55                   	push   %ebp
+  803f3b:	89 e5                	mov    %esp,%ebp
+  803f3d:	56                   	push   %esi
+  803f3e:	53                   	push   %ebx
+  803f3f:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803f42:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803f45:	50                   	push   %eax
+  803f46:	e8 38 e1 ff ff       	call   802083 <fd_alloc>
+  803f4b:	89 c3                	mov    %eax,%ebx
+  803f4d:	83 c4 10             	add    $0x10,%esp
+  803f50:	85 c0                	test   %eax,%eax
+  803f52:	0f 88 23 01 00 00    	js     80407b <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803f58:	83 ec 04             	sub    $0x4,%esp
+  803f5b:	68 07 04 00 00       	push   $0x407
+  803f60:	ff 75 f4             	push   -0xc(%ebp)
+  803f63:	6a 00                	push   $0x0
+  803f65:	e8 db d1 ff ff       	call   801145 <sys_page_alloc>
+  803f6a:	89 c3                	mov    %eax,%ebx
+  803f6c:	83 c4 10             	add    $0x10,%esp
+  803f6f:	85 c0                	test   %eax,%eax
+  803f71:	0f 88 04 01 00 00    	js     80407b <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803f77:	83 ec 0c             	sub    $0xc,%esp
+  803f7a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803f7d:	50                   	push   %eax
+  803f7e:	e8 00 e1 ff ff       	call   802083 <fd_alloc>
+  803f83:	89 c3                	mov    %eax,%ebx
+  803f85:	83 c4 10             	add    $0x10,%esp
+  803f88:	85 c0                	test   %eax,%eax
+  803f8a:	0f 88 db 00 00 00    	js     80406b <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803f90:	83 ec 04             	sub    $0x4,%esp
+  803f93:	68 07 04 00 00       	push   $0x407
+  803f98:	ff 75 f0             	push   -0x10(%ebp)
+  803f9b:	6a 00                	push   $0x0
+  803f9d:	e8 a3 d1 ff ff       	call   801145 <sys_page_alloc>
+  803fa2:	89 c3                	mov    %eax,%ebx
+  803fa4:	83 c4 10             	add    $0x10,%esp
+  803fa7:	85 c0                	test   %eax,%eax
+  803fa9:	0f 88 bc 00 00 00    	js     80406b <pipe+0x131>
+	va = fd2data(fd0);
+  803faf:	83 ec 0c             	sub    $0xc,%esp
+  803fb2:	ff 75 f4             	push   -0xc(%ebp)
+  803fb5:	e8 b2 e0 ff ff       	call   80206c <fd2data>
+  803fba:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803fbc:	83 c4 0c             	add    $0xc,%esp
+  803fbf:	68 07 04 00 00       	push   $0x407
+  803fc4:	50                   	push   %eax
+  803fc5:	6a 00                	push   $0x0
+  803fc7:	e8 79 d1 ff ff       	call   801145 <sys_page_alloc>
+  803fcc:	89 c3                	mov    %eax,%ebx
+  803fce:	83 c4 10             	add    $0x10,%esp
+  803fd1:	85 c0                	test   %eax,%eax
+  803fd3:	0f 88 82 00 00 00    	js     80405b <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803fd9:	83 ec 0c             	sub    $0xc,%esp
+  803fdc:	ff 75 f0             	push   -0x10(%ebp)
+  803fdf:	e8 88 e0 ff ff       	call   80206c <fd2data>
+  803fe4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803feb:	50                   	push   %eax
+  803fec:	6a 00                	push   $0x0
+  803fee:	56                   	push   %esi
+  803fef:	6a 00                	push   $0x0
+  803ff1:	e8 92 d1 ff ff       	call   801188 <sys_page_map>
+  803ff6:	89 c3                	mov    %eax,%ebx
+  803ff8:	83 c4 20             	add    $0x20,%esp
+  803ffb:	85 c0                	test   %eax,%eax
+  803ffd:	78 4e                	js     80404d <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803fff:	a1 60 50 80 00       	mov    0x805060,%eax
+  804004:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  804007:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  804009:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80400c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  804013:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  804016:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  804018:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80401b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  804022:	83 ec 0c             	sub    $0xc,%esp
+  804025:	ff 75 f4             	push   -0xc(%ebp)
+  804028:	e8 2f e0 ff ff       	call   80205c <fd2num>
+  80402d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804030:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  804032:	83 c4 04             	add    $0x4,%esp
+  804035:	ff 75 f0             	push   -0x10(%ebp)
+  804038:	e8 1f e0 ff ff       	call   80205c <fd2num>
+  80403d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  804040:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  804043:	83 c4 10             	add    $0x10,%esp
+  804046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80404b:	eb 2e                	jmp    80407b <pipe+0x141>
+	sys_page_unmap(0, va);
+  80404d:	83 ec 08             	sub    $0x8,%esp
+  804050:	56                   	push   %esi
+  804051:	6a 00                	push   $0x0
+  804053:	e8 72 d1 ff ff       	call   8011ca <sys_page_unmap>
+  804058:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	ff 75 f0             	push   -0x10(%ebp)
+  804061:	6a 00                	push   $0x0
+  804063:	e8 62 d1 ff ff       	call   8011ca <sys_page_unmap>
+  804068:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80406b:	83 ec 08             	sub    $0x8,%esp
+  80406e:	ff 75 f4             	push   -0xc(%ebp)
+  804071:	6a 00                	push   $0x0
+  804073:	e8 52 d1 ff ff       	call   8011ca <sys_page_unmap>
+  804078:	83 c4 10             	add    $0x10,%esp
+}
+  80407b:	89 d8                	mov    %ebx,%eax
+  80407d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804080:	5b                   	pop    %ebx
+  804081:	5e                   	pop    %esi
+  804082:	5d                   	pop    %ebp
+  804083:	c3                   	ret
+
+00804084 <pipeisclosed>:
+{
+  804084:	55                   	push   %ebp
+  804085:	89 e5                	mov    %esp,%ebp
+  804087:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80408a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80408d:	50                   	push   %eax
+  80408e:	ff 75 08             	push   0x8(%ebp)
+  804091:	e8 3d e0 ff ff       	call   8020d3 <fd_lookup>
+  804096:	83 c4 10             	add    $0x10,%esp
+  804099:	85 c0                	test   %eax,%eax
+  80409b:	78 18                	js     8040b5 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80409d:	83 ec 0c             	sub    $0xc,%esp
+  8040a0:	ff 75 f4             	push   -0xc(%ebp)
+  8040a3:	e8 c4 df ff ff       	call   80206c <fd2data>
+  8040a8:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8040aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8040ad:	e8 e6 f9 ff ff       	call   803a98 <_pipeisclosed>
+  8040b2:	83 c4 10             	add    $0x10,%esp
+}
+  8040b5:	c9                   	leave
+  8040b6:	c3                   	ret
+
+008040b7 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8040b7:	55                   	push   %ebp
+  8040b8:	89 e5                	mov    %esp,%ebp
+  8040ba:	56                   	push   %esi
+  8040bb:	53                   	push   %ebx
+  8040bc:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  8040bf:	85 f6                	test   %esi,%esi
+  8040c1:	74 40                	je     804103 <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  8040c3:	89 f3                	mov    %esi,%ebx
+  8040c5:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8040cb:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  8040d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8040d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8040d9:	39 c6                	cmp    %eax,%esi
+  8040db:	75 1f                	jne    8040fc <wait+0x45>
+  8040dd:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  8040e3:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8040e9:	8b 43 54             	mov    0x54(%ebx),%eax
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	74 0c                	je     8040fc <wait+0x45>
+		sys_yield();
+  8040f0:	e8 31 d0 ff ff       	call   801126 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  8040f5:	8b 43 48             	mov    0x48(%ebx),%eax
+  8040f8:	39 f0                	cmp    %esi,%eax
+  8040fa:	74 ed                	je     8040e9 <wait+0x32>
+}
+  8040fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040ff:	5b                   	pop    %ebx
+  804100:	5e                   	pop    %esi
+  804101:	5d                   	pop    %ebp
+  804102:	c3                   	ret
+	assert(envid != 0);
+  804103:	68 9e 4f 80 00       	push   $0x804f9e
+  804108:	68 49 4f 80 00       	push   $0x804f49
+  80410d:	6a 09                	push   $0x9
+  80410f:	68 a9 4f 80 00       	push   $0x804fa9
+  804114:	e8 26 c4 ff ff       	call   80053f <_panic>
+
+00804119 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  804119:	55                   	push   %ebp
+  80411a:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  80411c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80411f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  804125:	5d                   	pop    %ebp
+  804126:	c3                   	ret
+
+00804127 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  804127:	55                   	push   %ebp
+  804128:	89 e5                	mov    %esp,%ebp
+  80412a:	53                   	push   %ebx
+  80412b:	83 ec 04             	sub    $0x4,%esp
+  80412e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  804131:	8b 03                	mov    (%ebx),%eax
+  804133:	85 c0                	test   %eax,%eax
+  804135:	75 05                	jne    80413c <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  804137:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80413a:	c9                   	leave
+  80413b:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  80413c:	83 ec 08             	sub    $0x8,%esp
+  80413f:	50                   	push   %eax
+  804140:	8d 43 04             	lea    0x4(%ebx),%eax
+  804143:	50                   	push   %eax
+  804144:	e8 d1 d2 ff ff       	call   80141a <sys_page_batch>
+	pb->pb_n = 0;
+  804149:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  80414f:	83 c4 10             	add    $0x10,%esp
+  804152:	eb e3                	jmp    804137 <pgbatch_flush+0x10>
+
+00804154 <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  804154:	55                   	push   %ebp
+  804155:	89 e5                	mov    %esp,%ebp
+  804157:	56                   	push   %esi
+  804158:	53                   	push   %ebx
+  804159:	89 c3                	mov    %eax,%ebx
+  80415b:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80415d:	83 38 20             	cmpl   $0x20,(%eax)
+  804160:	74 2c                	je     80418e <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  804162:	8b 03                	mov    (%ebx),%eax
+  804164:	8d 50 01             	lea    0x1(%eax),%edx
+  804167:	89 13                	mov    %edx,(%ebx)
+  804169:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  80416c:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  804170:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  804172:	83 ec 04             	sub    $0x4,%esp
+  804175:	6a 18                	push   $0x18
+  804177:	6a 00                	push   $0x0
+  804179:	50                   	push   %eax
+  80417a:	e8 0d cd ff ff       	call   800e8c <memset>
+	return 0;
+  80417f:	83 c4 10             	add    $0x10,%esp
+  804182:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804187:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80418a:	5b                   	pop    %ebx
+  80418b:	5e                   	pop    %esi
+  80418c:	5d                   	pop    %ebp
+  80418d:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  80418e:	83 ec 0c             	sub    $0xc,%esp
+  804191:	50                   	push   %eax
+  804192:	e8 90 ff ff ff       	call   804127 <pgbatch_flush>
+  804197:	83 c4 10             	add    $0x10,%esp
+  80419a:	85 c0                	test   %eax,%eax
+  80419c:	79 c4                	jns    804162 <pgbatch_slot+0xe>
+  80419e:	eb e7                	jmp    804187 <pgbatch_slot+0x33>
+
+008041a0 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8041a0:	55                   	push   %ebp
+  8041a1:	89 e5                	mov    %esp,%ebp
+  8041a3:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8041a6:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8041a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041ac:	e8 a3 ff ff ff       	call   804154 <pgbatch_slot>
+  8041b1:	85 c0                	test   %eax,%eax
+  8041b3:	78 20                	js     8041d5 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8041b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041b8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8041be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041c1:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8041c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8041c7:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8041ca:	8b 55 14             	mov    0x14(%ebp),%edx
+  8041cd:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8041d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041d5:	c9                   	leave
+  8041d6:	c3                   	ret
+
+008041d7 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8041d7:	55                   	push   %ebp
+  8041d8:	89 e5                	mov    %esp,%ebp
+  8041da:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8041dd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8041e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8041e3:	e8 6c ff ff ff       	call   804154 <pgbatch_slot>
+  8041e8:	85 c0                	test   %eax,%eax
+  8041ea:	78 2c                	js     804218 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8041ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8041ef:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8041f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8041f8:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  8041fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8041fe:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  804201:	8b 55 14             	mov    0x14(%ebp),%edx
+  804204:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  804207:	8b 55 18             	mov    0x18(%ebp),%edx
+  80420a:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80420d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  804210:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  804213:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804218:	c9                   	leave
+  804219:	c3                   	ret
+
+0080421a <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  80421a:	55                   	push   %ebp
+  80421b:	89 e5                	mov    %esp,%ebp
+  80421d:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804220:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804223:	8b 45 08             	mov    0x8(%ebp),%eax
+  804226:	e8 29 ff ff ff       	call   804154 <pgbatch_slot>
+  80422b:	85 c0                	test   %eax,%eax
+  80422d:	78 1a                	js     804249 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  80422f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804232:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  804238:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80423b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80423e:	8b 55 10             	mov    0x10(%ebp),%edx
+  804241:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  804244:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804249:	c9                   	leave
+  80424a:	c3                   	ret
+
+0080424b <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  80424b:	55                   	push   %ebp
+  80424c:	89 e5                	mov    %esp,%ebp
+  80424e:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804251:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  804254:	8b 45 08             	mov    0x8(%ebp),%eax
+  804257:	e8 f8 fe ff ff       	call   804154 <pgbatch_slot>
+  80425c:	85 c0                	test   %eax,%eax
+  80425e:	78 20                	js     804280 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  804260:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804263:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  804269:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80426c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80426f:	8b 55 10             	mov    0x10(%ebp),%edx
+  804272:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  804275:	8b 55 14             	mov    0x14(%ebp),%edx
+  804278:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80427b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804280:	c9                   	leave
+  804281:	c3                   	ret
+
+00804282 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  804282:	55                   	push   %ebp
+  804283:	89 e5                	mov    %esp,%ebp
+  804285:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  804288:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80428b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80428e:	e8 c1 fe ff ff       	call   804154 <pgbatch_slot>
+  804293:	85 c0                	test   %eax,%eax
+  804295:	78 26                	js     8042bd <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  804297:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80429a:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8042a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8042a3:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8042a6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8042a9:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8042ac:	8b 55 14             	mov    0x14(%ebp),%edx
+  8042af:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8042b2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8042b5:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8042b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042bd:	c9                   	leave
+  8042be:	c3                   	ret
+
+008042bf <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  8042bf:	55                   	push   %ebp
+  8042c0:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  8042c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8042c5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8042cb:	5d                   	pop    %ebp
+  8042cc:	c3                   	ret
+
+008042cd <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  8042cd:	55                   	push   %ebp
+  8042ce:	89 e5                	mov    %esp,%ebp
+  8042d0:	56                   	push   %esi
+  8042d1:	53                   	push   %ebx
+  8042d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  8042d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8042e3:	85 c0                	test   %eax,%eax
+  8042e5:	74 2f                	je     804316 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  8042e7:	83 f8 02             	cmp    $0x2,%eax
+  8042ea:	74 0c                	je     8042f8 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  8042ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8042f1:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	74 1e                	je     804316 <mutex_lock+0x49>
+  8042f8:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  8042fd:	83 ec 04             	sub    $0x4,%esp
+  804300:	6a ff                	push   $0xffffffff
+  804302:	6a 02                	push   $0x2
+  804304:	53                   	push   %ebx
+  804305:	e8 39 d2 ff ff       	call   801543 <sys_futex_wait>
+  80430a:	89 f0                	mov    %esi,%eax
+  80430c:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  80430f:	83 c4 10             	add    $0x10,%esp
+  804312:	85 c0                	test   %eax,%eax
+  804314:	75 e7                	jne    8042fd <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  804316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804319:	5b                   	pop    %ebx
+  80431a:	5e                   	pop    %esi
+  80431b:	5d                   	pop    %ebp
+  80431c:	c3                   	ret
+
+0080431d <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  80431d:	55                   	push   %ebp
+  80431e:	89 e5                	mov    %esp,%ebp
+  804320:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  804323:	b8 00 00 00 00       	mov    $0x0,%eax
+  804328:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80432d:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  804331:	85 c0                	test   %eax,%eax
+  804333:	0f 94 c0             	sete   %al
+  804336:	0f b6 c0             	movzbl %al,%eax
+}
+  804339:	5d                   	pop    %ebp
+  80433a:	c3                   	ret
+
+0080433b <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  80433b:	55                   	push   %ebp
+  80433c:	89 e5                	mov    %esp,%ebp
+  80433e:	83 ec 08             	sub    $0x8,%esp
+  804341:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  804344:	b8 00 00 00 00       	mov    $0x0,%eax
+  804349:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  80434c:	83 f8 02             	cmp    $0x2,%eax
+  80434f:	74 02                	je     804353 <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  804351:	c9                   	leave
+  804352:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  804353:	83 ec 08             	sub    $0x8,%esp
+  804356:	6a 01                	push   $0x1
+  804358:	52                   	push   %edx
+  804359:	e8 07 d2 ff ff       	call   801565 <sys_futex_wake>
+  80435e:	83 c4 10             	add    $0x10,%esp
+}
+  804361:	eb ee                	jmp    804351 <mutex_unlock+0x16>
+
+00804363 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  804363:	55                   	push   %ebp
+  804364:	89 e5                	mov    %esp,%ebp
+  804366:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  804369:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  80436f:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  804376:	5d                   	pop    %ebp
+  804377:	c3                   	ret
+
+00804378 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  804378:	55                   	push   %ebp
+  804379:	89 e5                	mov    %esp,%ebp
+  80437b:	57                   	push   %edi
+  80437c:	56                   	push   %esi
+  80437d:	53                   	push   %ebx
+  80437e:	83 ec 18             	sub    $0x18,%esp
+  804381:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804384:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  804387:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  804389:	b8 01 00 00 00       	mov    $0x1,%eax
+  80438e:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  804393:	57                   	push   %edi
+  804394:	e8 a2 ff ff ff       	call   80433b <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  804399:	83 c4 0c             	add    $0xc,%esp
+  80439c:	ff 75 10             	push   0x10(%ebp)
+  80439f:	56                   	push   %esi
+  8043a0:	53                   	push   %ebx
+  8043a1:	e8 9d d1 ff ff       	call   801543 <sys_futex_wait>
+  8043a6:	89 c6                	mov    %eax,%esi
+  8043a8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8043ad:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  8043b2:	89 3c 24             	mov    %edi,(%esp)
+  8043b5:	e8 13 ff ff ff       	call   8042cd <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  8043ba:	83 c4 10             	add    $0x10,%esp
+  8043bd:	83 fe ef             	cmp    $0xffffffef,%esi
+  8043c0:	74 05                	je     8043c7 <cond_timedwait+0x4f>
+  8043c2:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8043c7:	89 f0                	mov    %esi,%eax
+  8043c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043cc:	5b                   	pop    %ebx
+  8043cd:	5e                   	pop    %esi
+  8043ce:	5f                   	pop    %edi
+  8043cf:	5d                   	pop    %ebp
+  8043d0:	c3                   	ret
+
+008043d1 <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  8043d1:	55                   	push   %ebp
+  8043d2:	89 e5                	mov    %esp,%ebp
+  8043d4:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  8043d7:	6a ff                	push   $0xffffffff
+  8043d9:	ff 75 0c             	push   0xc(%ebp)
+  8043dc:	ff 75 08             	push   0x8(%ebp)
+  8043df:	e8 94 ff ff ff       	call   804378 <cond_timedwait>
+}
+  8043e4:	83 c4 10             	add    $0x10,%esp
+  8043e7:	c9                   	leave
+  8043e8:	c3                   	ret
+
+008043e9 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  8043e9:	55                   	push   %ebp
+  8043ea:	89 e5                	mov    %esp,%ebp
+  8043ec:	83 ec 08             	sub    $0x8,%esp
+  8043ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8043f2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043f7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  8043fb:	8b 50 04             	mov    0x4(%eax),%edx
+  8043fe:	85 d2                	test   %edx,%edx
+  804400:	75 02                	jne    804404 <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  804402:	c9                   	leave
+  804403:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  804404:	83 ec 08             	sub    $0x8,%esp
+  804407:	6a 01                	push   $0x1
+  804409:	50                   	push   %eax
+  80440a:	e8 56 d1 ff ff       	call   801565 <sys_futex_wake>
+  80440f:	83 c4 10             	add    $0x10,%esp
+}
+  804412:	eb ee                	jmp    804402 <cond_signal+0x19>
+
+00804414 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  804414:	55                   	push   %ebp
+  804415:	89 e5                	mov    %esp,%ebp
+  804417:	83 ec 08             	sub    $0x8,%esp
+  80441a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80441d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804422:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  804426:	8b 50 04             	mov    0x4(%eax),%edx
+  804429:	85 d2                	test   %edx,%edx
+  80442b:	75 02                	jne    80442f <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  80442d:	c9                   	leave
+  80442e:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  80442f:	83 ec 08             	sub    $0x8,%esp
+  804432:	68 00 04 00 00       	push   $0x400
+  804437:	50                   	push   %eax
+  804438:	e8 28 d1 ff ff       	call   801565 <sys_futex_wake>
+  80443d:	83 c4 10             	add    $0x10,%esp
+}
+  804440:	eb eb                	jmp    80442d <cond_broadcast+0x19>
+
+00804442 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804442:	b8 00 00 00 00       	mov    $0x0,%eax
+  804447:	c3                   	ret
+
+00804448 <devcons_poll>:
+{
+  804448:	55                   	push   %ebp
+  804449:	89 e5                	mov    %esp,%ebp
+  80444b:	53                   	push   %ebx
+  80444c:	83 ec 04             	sub    $0x4,%esp
+  80444f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804452:	89 da                	mov    %ebx,%edx
+  804454:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  804457:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  80445e:	74 0c                	je     80446c <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804460:	89 d8                	mov    %ebx,%eax
+  804462:	83 e0 01             	and    $0x1,%eax
+  804465:	09 d0                	or     %edx,%eax
+}
+  804467:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80446a:	c9                   	leave
+  80446b:	c3                   	ret
+		cons_peek = sys_cgetc();
+  80446c:	e8 36 cc ff ff       	call   8010a7 <sys_cgetc>
+  804471:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  804476:	89 da                	mov    %ebx,%edx
+  804478:	83 e2 04             	and    $0x4,%edx
+  80447b:	85 c0                	test   %eax,%eax
+  80447d:	74 e6                	je     804465 <devcons_poll+0x1d>
+  80447f:	eb df                	jmp    804460 <devcons_poll+0x18>
+
+00804481 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804481:	55                   	push   %ebp
+  804482:	89 e5                	mov    %esp,%ebp
+  804484:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804487:	68 b4 4f 80 00       	push   $0x804fb4
+  80448c:	ff 75 0c             	push   0xc(%ebp)
+  80448f:	e8 7d c8 ff ff       	call   800d11 <strcpy>
+	return 0;
+}
+  804494:	b8 00 00 00 00       	mov    $0x0,%eax
+  804499:	c9                   	leave
+  80449a:	c3                   	ret
+
+0080449b <devcons_write>:
+{
+  80449b:	55                   	push   %ebp
+  80449c:	89 e5                	mov    %esp,%ebp
+  80449e:	57                   	push   %edi
+  80449f:	56                   	push   %esi
+  8044a0:	53                   	push   %ebx
+  8044a1:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8044a7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8044aa:	85 ff                	test   %edi,%edi
+  8044ac:	74 51                	je     8044ff <devcons_write+0x64>
+  8044ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8044b3:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  8044b8:	89 fb                	mov    %edi,%ebx
+  8044ba:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  8044bc:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  8044c1:	39 d3                	cmp    %edx,%ebx
+  8044c3:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8044c6:	83 ec 04             	sub    $0x4,%esp
+  8044c9:	53                   	push   %ebx
+  8044ca:	03 45 0c             	add    0xc(%ebp),%eax
+  8044cd:	50                   	push   %eax
+  8044ce:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8044d4:	50                   	push   %eax
+  8044d5:	e8 e7 c9 ff ff       	call   800ec1 <memmove>
+		sys_cputs(buf, m);
+  8044da:	83 c4 08             	add    $0x8,%esp
+  8044dd:	53                   	push   %ebx
+  8044de:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8044e4:	50                   	push   %eax
+  8044e5:	e8 9f cb ff ff       	call   801089 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8044ea:	01 de                	add    %ebx,%esi
+  8044ec:	89 f0                	mov    %esi,%eax
+  8044ee:	83 c4 10             	add    $0x10,%esp
+  8044f1:	39 fe                	cmp    %edi,%esi
+  8044f3:	72 c3                	jb     8044b8 <devcons_write+0x1d>
+}
+  8044f5:	89 f0                	mov    %esi,%eax
+  8044f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044fa:	5b                   	pop    %ebx
+  8044fb:	5e                   	pop    %esi
+  8044fc:	5f                   	pop    %edi
+  8044fd:	5d                   	pop    %ebp
+  8044fe:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8044ff:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  804504:	eb ef                	jmp    8044f5 <devcons_write+0x5a>
+
+00804506 <devcons_read>:
+{
+  804506:	55                   	push   %ebp
+  804507:	89 e5                	mov    %esp,%ebp
+  804509:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  80450c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  804511:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804515:	74 36                	je     80454d <devcons_read+0x47>
+	c = cons_peek;
+  804517:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  80451c:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  804523:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804526:	85 c0                	test   %eax,%eax
+  804528:	75 10                	jne    80453a <devcons_read+0x34>
+  80452a:	e8 78 cb ff ff       	call   8010a7 <sys_cgetc>
+  80452f:	85 c0                	test   %eax,%eax
+  804531:	75 07                	jne    80453a <devcons_read+0x34>
+		sys_yield();
+  804533:	e8 ee cb ff ff       	call   801126 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804538:	eb f0                	jmp    80452a <devcons_read+0x24>
+	if (c < 0)
+  80453a:	85 c0                	test   %eax,%eax
+  80453c:	78 0f                	js     80454d <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  80453e:	83 f8 04             	cmp    $0x4,%eax
+  804541:	74 0c                	je     80454f <devcons_read+0x49>
+	*(char*)vbuf = c;
+  804543:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804546:	88 02                	mov    %al,(%edx)
+	return 1;
+  804548:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80454d:	c9                   	leave
+  80454e:	c3                   	ret
+		return 0;
+  80454f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804554:	eb f7                	jmp    80454d <devcons_read+0x47>
+
+00804556 <cputchar>:
+{
+  804556:	55                   	push   %ebp
+  804557:	89 e5                	mov    %esp,%ebp
+  804559:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80455c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80455f:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804562:	6a 01                	push   $0x1
+  804564:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804567:	50                   	push   %eax
+  804568:	e8 1c cb ff ff       	call   801089 <sys_cputs>
+}
+  80456d:	83 c4 10             	add    $0x10,%esp
+  804570:	c9                   	leave
+  804571:	c3                   	ret
+
+00804572 <getchar>:
+{
+  804572:	55                   	push   %ebp
+  804573:	89 e5                	mov    %esp,%ebp
+  804575:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804578:	6a 01                	push   $0x1
+  80457a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80457d:	50                   	push   %eax
+  80457e:	6a 00                	push   $0x0
+  804580:	e8 d2 dd ff ff       	call   802357 <read>
+	if (r < 0)
+  804585:	83 c4 10             	add    $0x10,%esp
+  804588:	85 c0                	test   %eax,%eax
+  80458a:	78 06                	js     804592 <getchar+0x20>
+	if (r < 1)
+  80458c:	74 06                	je     804594 <getchar+0x22>
+	return c;
+  80458e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804592:	c9                   	leave
+  804593:	c3                   	ret
+		return -E_EOF;
+  804594:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804599:	eb f7                	jmp    804592 <getchar+0x20>
+
+0080459b <iscons>:
+{
+  80459b:	55                   	push   %ebp
+  80459c:	89 e5                	mov    %esp,%ebp
+  80459e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8045a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8045a4:	50                   	push   %eax
+  8045a5:	ff 75 08             	push   0x8(%ebp)
+  8045a8:	e8 26 db ff ff       	call   8020d3 <fd_lookup>
+  8045ad:	83 c4 10             	add    $0x10,%esp
+  8045b0:	85 c0                	test   %eax,%eax
+  8045b2:	78 11                	js     8045c5 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8045b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8045b7:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8045bd:	39 10                	cmp    %edx,(%eax)
+  8045bf:	0f 94 c0             	sete   %al
+  8045c2:	0f b6 c0             	movzbl %al,%eax
+}
+  8045c5:	c9                   	leave
+  8045c6:	c3                   	ret
+
+008045c7 <opencons>:
+{
+  8045c7:	55                   	push   %ebp
+  8045c8:	89 e5                	mov    %esp,%ebp
+  8045ca:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  8045cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8045d0:	50                   	push   %eax
+  8045d1:	e8 ad da ff ff       	call   802083 <fd_alloc>
+  8045d6:	83 c4 10             	add    $0x10,%esp
+  8045d9:	85 c0                	test   %eax,%eax
+  8045db:	78 3a                	js     804617 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8045dd:	83 ec 04             	sub    $0x4,%esp
+  8045e0:	68 07 04 00 00       	push   $0x407
+  8045e5:	ff 75 f4             	push   -0xc(%ebp)
+  8045e8:	6a 00                	push   $0x0
+  8045ea:	e8 56 cb ff ff       	call   801145 <sys_page_alloc>
+  8045ef:	83 c4 10             	add    $0x10,%esp
+  8045f2:	85 c0                	test   %eax,%eax
+  8045f4:	78 21                	js     804617 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8045f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8045f9:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8045ff:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804601:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804604:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80460b:	83 ec 0c             	sub    $0xc,%esp
+  80460e:	50                   	push   %eax
+  80460f:	e8 48 da ff ff       	call   80205c <fd2num>
+  804614:	83 c4 10             	add    $0x10,%esp
+}
+  804617:	c9                   	leave
+  804618:	c3                   	ret
+
+00804619 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804619:	55                   	push   %ebp
+  80461a:	89 e5                	mov    %esp,%ebp
+  80461c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80461f:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804626:	74 0a                	je     804632 <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80462b:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  804630:	c9                   	leave
+  804631:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  804632:	83 ec 04             	sub    $0x4,%esp
+  804635:	6a 07                	push   $0x7
+  804637:	68 00 f0 bf ee       	push   $0xeebff000
+  80463c:	6a 00                	push   $0x0
+  80463e:	e8 02 cb ff ff       	call   801145 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804643:	83 c4 08             	add    $0x8,%esp
+  804646:	68 57 46 80 00       	push   $0x804657
+  80464b:	6a 00                	push   $0x0
+  80464d:	e8 3e cc ff ff       	call   801290 <sys_env_set_pgfault_upcall>
+  804652:	83 c4 10             	add    $0x10,%esp
+  804655:	eb d1                	jmp    804628 <set_pgfault_handler+0xf>
+
+00804657 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804657:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804658:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  80465d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80465f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  804662:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  804666:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  804669:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  80466d:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  80466f:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  804673:	83 c4 08             	add    $0x8,%esp
+	popal;
+  804676:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  804677:	83 c4 04             	add    $0x4,%esp
+	popf
+  80467a:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  80467b:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  80467c:	c3                   	ret
+
+0080467d <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80467d:	55                   	push   %ebp
+  80467e:	89 e5                	mov    %esp,%ebp
+  804680:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  804683:	89 c2                	mov    %eax,%edx
+  804685:	c1 ea 16             	shr    $0x16,%edx
+  804688:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80468f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804694:	f6 c1 01             	test   $0x1,%cl
+  804697:	74 1e                	je     8046b7 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  804699:	c1 e8 0c             	shr    $0xc,%eax
+  80469c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8046a3:	a8 01                	test   $0x1,%al
+  8046a5:	74 10                	je     8046b7 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8046a7:	c1 e8 0c             	shr    $0xc,%eax
+  8046aa:	c1 e0 04             	shl    $0x4,%eax
+  8046ad:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  8046b4:	0f b7 d2             	movzwl %dx,%edx
+}
+  8046b7:	89 d0                	mov    %edx,%eax
+  8046b9:	5d                   	pop    %ebp
+  8046ba:	c3                   	ret
+
+008046bb <__udivdi3>:
+  8046bb:	57                   	push   %edi
+  8046bc:	56                   	push   %esi
+  8046bd:	53                   	push   %ebx
+  8046be:	83 ec 20             	sub    $0x20,%esp
+  8046c1:	8b 44 24 30          	mov    0x30(%esp),%eax
+  8046c5:	8b 54 24 34          	mov    0x34(%esp),%edx
+  8046c9:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046cd:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046d1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8046d5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8046d9:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8046dd:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8046e1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8046e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f0:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8046f7:	00 
+  8046f8:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8046ff:	00 
+  804700:	eb 08                	jmp    80470a <__udivdi3+0x4f>
+  804702:	83 e9 01             	sub    $0x1,%ecx
+  804705:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804708:	74 68                	je     804772 <__udivdi3+0xb7>
+  80470a:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80470e:	01 c0                	add    %eax,%eax
+  804710:	89 c6                	mov    %eax,%esi
+  804712:	89 d7                	mov    %edx,%edi
+  804714:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804718:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80471c:	0f ad d0             	shrd   %cl,%edx,%eax
+  80471f:	d3 ea                	shr    %cl,%edx
+  804721:	f6 c1 20             	test   $0x20,%cl
+  804724:	74 04                	je     80472a <__udivdi3+0x6f>
+  804726:	89 d0                	mov    %edx,%eax
+  804728:	31 d2                	xor    %edx,%edx
+  80472a:	83 e0 01             	and    $0x1,%eax
+  80472d:	89 04 24             	mov    %eax,(%esp)
+  804730:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804737:	00 
+  804738:	8b 04 24             	mov    (%esp),%eax
+  80473b:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80473f:	09 f0                	or     %esi,%eax
+  804741:	09 fa                	or     %edi,%edx
+  804743:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804747:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80474b:	39 f0                	cmp    %esi,%eax
+  80474d:	89 d3                	mov    %edx,%ebx
+  80474f:	19 fb                	sbb    %edi,%ebx
+  804751:	72 af                	jb     804702 <__udivdi3+0x47>
+  804753:	29 f0                	sub    %esi,%eax
+  804755:	19 fa                	sbb    %edi,%edx
+  804757:	89 cf                	mov    %ecx,%edi
+  804759:	c1 ef 05             	shr    $0x5,%edi
+  80475c:	83 e7 01             	and    $0x1,%edi
+  80475f:	89 fe                	mov    %edi,%esi
+  804761:	83 f6 01             	xor    $0x1,%esi
+  804764:	d3 e6                	shl    %cl,%esi
+  804766:	d3 e7                	shl    %cl,%edi
+  804768:	09 74 24 18          	or     %esi,0x18(%esp)
+  80476c:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804770:	eb 90                	jmp    804702 <__udivdi3+0x47>
+  804772:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804776:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80477a:	83 c4 20             	add    $0x20,%esp
+  80477d:	5b                   	pop    %ebx
+  80477e:	5e                   	pop    %esi
+  80477f:	5f                   	pop    %edi
+  804780:	c3                   	ret
+
+00804781 <__umoddi3>:
+  804781:	57                   	push   %edi
+  804782:	56                   	push   %esi
+  804783:	53                   	push   %ebx
+  804784:	83 ec 08             	sub    $0x8,%esp
+  804787:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80478b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80478f:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804793:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804797:	57                   	push   %edi
+  804798:	56                   	push   %esi
+  804799:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80479d:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8047a1:	52                   	push   %edx
+  8047a2:	50                   	push   %eax
+  8047a3:	e8 13 ff ff ff       	call   8046bb <__udivdi3>
+  8047a8:	89 c3                	mov    %eax,%ebx
+  8047aa:	0f af d6             	imul   %esi,%edx
+  8047ad:	89 f9                	mov    %edi,%ecx
+  8047af:	0f af cb             	imul   %ebx,%ecx
+  8047b2:	01 d1                	add    %edx,%ecx
+  8047b4:	89 d8                	mov    %ebx,%eax
+  8047b6:	f7 e6                	mul    %esi
+  8047b8:	89 c6                	mov    %eax,%esi
+  8047ba:	89 d7                	mov    %edx,%edi
+  8047bc:	01 cf                	add    %ecx,%edi
+  8047be:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8047c2:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8047c6:	29 f0                	sub    %esi,%eax
+  8047c8:	19 fa                	sbb    %edi,%edx
+  8047ca:	83 c4 18             	add    $0x18,%esp
+  8047cd:	5b                   	pop    %ebx
+  8047ce:	5e                   	pop    %esi
+  8047cf:	5f                   	pop    %edi
+  8047d0:	c3                   	ret
+
+008047d1 <__divdi3>:
+  8047d1:	53                   	push   %ebx
+  8047d2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8047d6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8047da:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8047de:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8047e2:	85 d2                	test   %edx,%edx
+  8047e4:	78 12                	js     8047f8 <__divdi3+0x27>
+  8047e6:	85 db                	test   %ebx,%ebx
+  8047e8:	78 2e                	js     804818 <__divdi3+0x47>
+  8047ea:	53                   	push   %ebx
+  8047eb:	51                   	push   %ecx
+  8047ec:	52                   	push   %edx
+  8047ed:	50                   	push   %eax
+  8047ee:	e8 c8 fe ff ff       	call   8046bb <__udivdi3>
+  8047f3:	83 c4 10             	add    $0x10,%esp
+  8047f6:	eb 1e                	jmp    804816 <__divdi3+0x45>
+  8047f8:	f7 d8                	neg    %eax
+  8047fa:	83 d2 00             	adc    $0x0,%edx
+  8047fd:	f7 da                	neg    %edx
+  8047ff:	85 db                	test   %ebx,%ebx
+  804801:	78 2a                	js     80482d <__divdi3+0x5c>
+  804803:	53                   	push   %ebx
+  804804:	51                   	push   %ecx
+  804805:	52                   	push   %edx
+  804806:	50                   	push   %eax
+  804807:	e8 af fe ff ff       	call   8046bb <__udivdi3>
+  80480c:	83 c4 10             	add    $0x10,%esp
+  80480f:	f7 d8                	neg    %eax
+  804811:	83 d2 00             	adc    $0x0,%edx
+  804814:	f7 da                	neg    %edx
+  804816:	5b                   	pop    %ebx
+  804817:	c3                   	ret
+  804818:	f7 d9                	neg    %ecx
+  80481a:	83 d3 00             	adc    $0x0,%ebx
+  80481d:	f7 db                	neg    %ebx
+  80481f:	53                   	push   %ebx
+  804820:	51                   	push   %ecx
+  804821:	52                   	push   %edx
+  804822:	50                   	push   %eax
+  804823:	e8 93 fe ff ff       	call   8046bb <__udivdi3>
+  804828:	83 c4 10             	add    $0x10,%esp
+  80482b:	eb e2                	jmp    80480f <__divdi3+0x3e>
+  80482d:	f7 d9                	neg    %ecx
+  80482f:	83 d3 00             	adc    $0x0,%ebx
+  804832:	f7 db                	neg    %ebx
+  804834:	53                   	push   %ebx
+  804835:	51                   	push   %ecx
+  804836:	52                   	push   %edx
+  804837:	50                   	push   %eax
+  804838:	e8 7e fe ff ff       	call   8046bb <__udivdi3>
+  80483d:	83 c4 10             	add    $0x10,%esp
+  804840:	eb d4                	jmp    804816 <__divdi3+0x45>
+
+00804842 <__moddi3>:
+  804842:	57                   	push   %edi
+  804843:	56                   	push   %esi
+  804844:	53                   	push   %ebx
+  804845:	83 ec 08             	sub    $0x8,%esp
+  804848:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80484c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804850:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804854:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  804858:	57                   	push   %edi
+  804859:	56                   	push   %esi
+  80485a:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80485e:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804862:	52                   	push   %edx
+  804863:	50                   	push   %eax
+  804864:	e8 68 ff ff ff       	call   8047d1 <__divdi3>
+  804869:	89 c3                	mov    %eax,%ebx
+  80486b:	0f af d6             	imul   %esi,%edx
+  80486e:	89 f9                	mov    %edi,%ecx
+  804870:	0f af cb             	imul   %ebx,%ecx
+  804873:	01 d1                	add    %edx,%ecx
+  804875:	89 d8                	mov    %ebx,%eax
+  804877:	f7 e6                	mul    %esi
+  804879:	89 c6                	mov    %eax,%esi
+  80487b:	89 d7                	mov    %edx,%edi
+  80487d:	01 cf                	add    %ecx,%edi
+  80487f:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804883:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804887:	29 f0                	sub    %esi,%eax
+  804889:	19 fa                	sbb    %edi,%edx
+  80488b:	83 c4 18             	add    $0x18,%esp
+  80488e:	5b                   	pop    %ebx
+  80488f:	5e                   	pop    %esi
+  804890:	5f                   	pop    %edi
+  804891:	c3                   	ret
@@ -0,0 +1,7952 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	53                   	push   %ebx
+  800039:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003c:	e8 b6 0f 00 00       	call   800ff7 <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  800041:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800048:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  80004a:	85 c0                	test   %eax,%eax
+  80004c:	79 05                	jns    800053 <sleep+0x1e>
+  80004e:	83 f8 ee             	cmp    $0xffffffee,%eax
+  800051:	7d 18                	jge    80006b <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800053:	39 c3                	cmp    %eax,%ebx
+  800055:	73 2b                	jae    800082 <sleep+0x4d>
+		panic("sleep: wrap");
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	68 62 3b 80 00       	push   $0x803b62
+  80005f:	6a 0d                	push   $0xd
+  800061:	68 52 3b 80 00       	push   $0x803b52
+  800066:	e8 32 01 00 00       	call   80019d <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  80006b:	50                   	push   %eax
+  80006c:	68 40 3b 80 00       	push   $0x803b40
+  800071:	6a 0b                	push   $0xb
+  800073:	68 52 3b 80 00       	push   $0x803b52
+  800078:	e8 20 01 00 00       	call   80019d <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007d:	e8 02 0d 00 00       	call   800d84 <sys_yield>
+	while (sys_time_msec() < end)
+  800082:	e8 70 0f 00 00       	call   800ff7 <sys_time_msec>
+  800087:	39 d8                	cmp    %ebx,%eax
+  800089:	72 f2                	jb     80007d <sleep+0x48>
+}
+  80008b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008e:	c9                   	leave
+  80008f:	c3                   	ret
+
+00800090 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800090:	55                   	push   %ebp
+  800091:	89 e5                	mov    %esp,%ebp
+  800093:	53                   	push   %ebx
+  800094:	83 ec 04             	sub    $0x4,%esp
+  800097:	bb 32 00 00 00       	mov    $0x32,%ebx
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+		sys_yield();
+  80009c:	e8 e3 0c 00 00       	call   800d84 <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xc>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 6e 3b 80 00       	push   $0x803b6e
+  8000ae:	e8 c5 01 00 00       	call   800278 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 84 3b 80 00       	push   $0x803b84
+  8000c4:	e8 af 01 00 00       	call   800278 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 60 ff ff ff       	call   800035 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2b>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 10 40 80 00       	push   $0x804010
+  8000e8:	e8 8b 01 00 00       	call   800278 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800101:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800103:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800108:	29 d0                	sub    %edx,%eax
+  80010a:	89 c2                	mov    %eax,%edx
+  80010c:	c1 ea 0f             	shr    $0xf,%edx
+  80010f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800114:	b8 00 00 00 00       	mov    $0x0,%eax
+  800119:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80011c:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  800123:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800127:	e8 39 0c 00 00       	call   800d65 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80012c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800131:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800137:	89 e1                	mov    %esp,%ecx
+  800139:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80013e:	29 ca                	sub    %ecx,%edx
+  800140:	89 d1                	mov    %edx,%ecx
+  800142:	c1 e9 0f             	shr    $0xf,%ecx
+  800145:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80014b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800150:	0f 42 d1             	cmovb  %ecx,%edx
+  800153:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800158:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80015f:	85 db                	test   %ebx,%ebx
+  800161:	7e 07                	jle    80016a <libmain+0x74>
+		binaryname = argv[0];
+  800163:	8b 06                	mov    (%esi),%eax
+  800165:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	56                   	push   %esi
+  80016e:	53                   	push   %ebx
+  80016f:	e8 1c ff ff ff       	call   800090 <umain>
+
+	// exit gracefully
+	exit();
+  800174:	e8 0a 00 00 00       	call   800183 <exit>
+}
+  800179:	83 c4 10             	add    $0x10,%esp
+  80017c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80017f:	5b                   	pop    %ebx
+  800180:	5e                   	pop    %esi
+  800181:	5d                   	pop    %ebp
+  800182:	c3                   	ret
+
+00800183 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800183:	55                   	push   %ebp
+  800184:	89 e5                	mov    %esp,%ebp
+  800186:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800189:	e8 61 12 00 00       	call   8013ef <close_all>
+	sys_env_destroy(0);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	6a 00                	push   $0x0
+  800193:	e8 8c 0b 00 00       	call   800d24 <sys_env_destroy>
+}
+  800198:	83 c4 10             	add    $0x10,%esp
+  80019b:	c9                   	leave
+  80019c:	c3                   	ret
+
+0080019d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80019d:	55                   	push   %ebp
+  80019e:	89 e5                	mov    %esp,%ebp
+  8001a0:	56                   	push   %esi
+  8001a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001a5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8001ab:	e8 b5 0b 00 00       	call   800d65 <sys_getenvid>
+  8001b0:	83 ec 0c             	sub    $0xc,%esp
+  8001b3:	ff 75 0c             	push   0xc(%ebp)
+  8001b6:	ff 75 08             	push   0x8(%ebp)
+  8001b9:	56                   	push   %esi
+  8001ba:	50                   	push   %eax
+  8001bb:	68 94 3b 80 00       	push   $0x803b94
+  8001c0:	e8 b3 00 00 00       	call   800278 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8001c5:	83 c4 18             	add    $0x18,%esp
+  8001c8:	53                   	push   %ebx
+  8001c9:	ff 75 10             	push   0x10(%ebp)
+  8001cc:	e8 56 00 00 00       	call   800227 <vcprintf>
+	cprintf("\n");
+  8001d1:	c7 04 24 10 40 80 00 	movl   $0x804010,(%esp)
+  8001d8:	e8 9b 00 00 00       	call   800278 <cprintf>
+  8001dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8001e0:	cc                   	int3
+	while (1)
+  8001e1:	eb fd                	jmp    8001e0 <_panic+0x43>
+
+008001e3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	53                   	push   %ebx
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001ed:	8b 13                	mov    (%ebx),%edx
+  8001ef:	8d 42 01             	lea    0x1(%edx),%eax
+  8001f2:	89 03                	mov    %eax,(%ebx)
+  8001f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001fb:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800200:	74 09                	je     80020b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800202:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800206:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800209:	c9                   	leave
+  80020a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80020b:	83 ec 08             	sub    $0x8,%esp
+  80020e:	68 ff 00 00 00       	push   $0xff
+  800213:	8d 43 08             	lea    0x8(%ebx),%eax
+  800216:	50                   	push   %eax
+  800217:	e8 cb 0a 00 00       	call   800ce7 <sys_cputs>
+		b->idx = 0;
+  80021c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800222:	83 c4 10             	add    $0x10,%esp
+  800225:	eb db                	jmp    800202 <putch+0x1f>
+
+00800227 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800227:	55                   	push   %ebp
+  800228:	89 e5                	mov    %esp,%ebp
+  80022a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800230:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800237:	00 00 00 
+	b.cnt = 0;
+  80023a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800241:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800244:	ff 75 0c             	push   0xc(%ebp)
+  800247:	ff 75 08             	push   0x8(%ebp)
+  80024a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800250:	50                   	push   %eax
+  800251:	68 e3 01 80 00       	push   $0x8001e3
+  800256:	e8 1c 01 00 00       	call   800377 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80025b:	83 c4 08             	add    $0x8,%esp
+  80025e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800264:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80026a:	50                   	push   %eax
+  80026b:	e8 77 0a 00 00       	call   800ce7 <sys_cputs>
+
+	return b.cnt;
+}
+  800270:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800276:	c9                   	leave
+  800277:	c3                   	ret
+
+00800278 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800278:	55                   	push   %ebp
+  800279:	89 e5                	mov    %esp,%ebp
+  80027b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80027e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800281:	50                   	push   %eax
+  800282:	ff 75 08             	push   0x8(%ebp)
+  800285:	e8 9d ff ff ff       	call   800227 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80028a:	c9                   	leave
+  80028b:	c3                   	ret
+
+0080028c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  80028f:	57                   	push   %edi
+  800290:	56                   	push   %esi
+  800291:	53                   	push   %ebx
+  800292:	83 ec 1c             	sub    $0x1c,%esp
+  800295:	89 c3                	mov    %eax,%ebx
+  800297:	89 d6                	mov    %edx,%esi
+  800299:	8b 45 08             	mov    0x8(%ebp),%eax
+  80029c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80029f:	89 d1                	mov    %edx,%ecx
+  8002a1:	89 c2                	mov    %eax,%edx
+  8002a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a9:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8002ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b6:	39 c2                	cmp    %eax,%edx
+  8002b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002bb:	73 4b                	jae    800308 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8002bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002c0:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8002c3:	85 ff                	test   %edi,%edi
+  8002c5:	7e 11                	jle    8002d8 <printnum+0x4c>
+			putch(padc, putdat);
+  8002c7:	83 ec 08             	sub    $0x8,%esp
+  8002ca:	56                   	push   %esi
+  8002cb:	ff 75 18             	push   0x18(%ebp)
+  8002ce:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8002d0:	83 c4 10             	add    $0x10,%esp
+  8002d3:	83 ef 01             	sub    $0x1,%edi
+  8002d6:	75 ef                	jne    8002c7 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002d8:	83 ec 08             	sub    $0x8,%esp
+  8002db:	56                   	push   %esi
+  8002dc:	83 ec 04             	sub    $0x4,%esp
+  8002df:	ff 75 e4             	push   -0x1c(%ebp)
+  8002e2:	ff 75 e0             	push   -0x20(%ebp)
+  8002e5:	ff 75 dc             	push   -0x24(%ebp)
+  8002e8:	ff 75 d8             	push   -0x28(%ebp)
+  8002eb:	e8 2a 37 00 00       	call   803a1a <__umoddi3>
+  8002f0:	83 c4 14             	add    $0x14,%esp
+  8002f3:	0f be 80 b7 3b 80 00 	movsbl 0x803bb7(%eax),%eax
+  8002fa:	50                   	push   %eax
+  8002fb:	ff d3                	call   *%ebx
+}
+  8002fd:	83 c4 10             	add    $0x10,%esp
+  800300:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800303:	5b                   	pop    %ebx
+  800304:	5e                   	pop    %esi
+  800305:	5f                   	pop    %edi
+  800306:	5d                   	pop    %ebp
+  800307:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800308:	83 ec 0c             	sub    $0xc,%esp
+  80030b:	ff 75 18             	push   0x18(%ebp)
+  80030e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800311:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800314:	52                   	push   %edx
+  800315:	50                   	push   %eax
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	ff 75 e4             	push   -0x1c(%ebp)
+  80031c:	ff 75 e0             	push   -0x20(%ebp)
+  80031f:	ff 75 dc             	push   -0x24(%ebp)
+  800322:	ff 75 d8             	push   -0x28(%ebp)
+  800325:	e8 2a 36 00 00       	call   803954 <__udivdi3>
+  80032a:	83 c4 18             	add    $0x18,%esp
+  80032d:	52                   	push   %edx
+  80032e:	50                   	push   %eax
+  80032f:	89 f2                	mov    %esi,%edx
+  800331:	89 d8                	mov    %ebx,%eax
+  800333:	e8 54 ff ff ff       	call   80028c <printnum>
+  800338:	83 c4 20             	add    $0x20,%esp
+  80033b:	eb 9b                	jmp    8002d8 <printnum+0x4c>
+
+0080033d <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80033d:	55                   	push   %ebp
+  80033e:	89 e5                	mov    %esp,%ebp
+  800340:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800343:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800347:	8b 10                	mov    (%eax),%edx
+  800349:	3b 50 04             	cmp    0x4(%eax),%edx
+  80034c:	73 0a                	jae    800358 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80034e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800351:	89 08                	mov    %ecx,(%eax)
+  800353:	8b 45 08             	mov    0x8(%ebp),%eax
+  800356:	88 02                	mov    %al,(%edx)
+}
+  800358:	5d                   	pop    %ebp
+  800359:	c3                   	ret
+
+0080035a <printfmt>:
+{
+  80035a:	55                   	push   %ebp
+  80035b:	89 e5                	mov    %esp,%ebp
+  80035d:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800360:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800363:	50                   	push   %eax
+  800364:	ff 75 10             	push   0x10(%ebp)
+  800367:	ff 75 0c             	push   0xc(%ebp)
+  80036a:	ff 75 08             	push   0x8(%ebp)
+  80036d:	e8 05 00 00 00       	call   800377 <vprintfmt>
+}
+  800372:	83 c4 10             	add    $0x10,%esp
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+
+00800377 <vprintfmt>:
+{
+  800377:	55                   	push   %ebp
+  800378:	89 e5                	mov    %esp,%ebp
+  80037a:	57                   	push   %edi
+  80037b:	56                   	push   %esi
+  80037c:	53                   	push   %ebx
+  80037d:	83 ec 2c             	sub    $0x2c,%esp
+  800380:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800383:	89 df                	mov    %ebx,%edi
+  800385:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800388:	8b 45 10             	mov    0x10(%ebp),%eax
+  80038b:	8d 70 01             	lea    0x1(%eax),%esi
+  80038e:	0f b6 00             	movzbl (%eax),%eax
+  800391:	83 f8 25             	cmp    $0x25,%eax
+  800394:	74 1e                	je     8003b4 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800396:	85 c0                	test   %eax,%eax
+  800398:	0f 84 15 05 00 00    	je     8008b3 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80039e:	83 ec 08             	sub    $0x8,%esp
+  8003a1:	53                   	push   %ebx
+  8003a2:	50                   	push   %eax
+  8003a3:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003a5:	83 c6 01             	add    $0x1,%esi
+  8003a8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8003ac:	83 c4 10             	add    $0x10,%esp
+  8003af:	83 f8 25             	cmp    $0x25,%eax
+  8003b2:	75 e2                	jne    800396 <vprintfmt+0x1f>
+		padc = ' ';
+  8003b4:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8003b8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8003bf:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8003c6:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8003cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003d2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003d5:	8d 56 01             	lea    0x1(%esi),%edx
+  8003d8:	0f b6 0e             	movzbl (%esi),%ecx
+  8003db:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8003de:	3c 55                	cmp    $0x55,%al
+  8003e0:	0f 87 3b 04 00 00    	ja     800821 <vprintfmt+0x4aa>
+  8003e6:	0f b6 c0             	movzbl %al,%eax
+  8003e9:	ff 24 85 20 3d 80 00 	jmp    *0x803d20(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003f0:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003f3:	eb 93                	jmp    800388 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003f5:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003f7:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003fb:	eb d8                	jmp    8003d5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003fd:	89 d6                	mov    %edx,%esi
+  8003ff:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800403:	eb d0                	jmp    8003d5 <vprintfmt+0x5e>
+  800405:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  800408:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  80040b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  80040e:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800412:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800415:	83 f9 09             	cmp    $0x9,%ecx
+  800418:	77 6f                	ja     800489 <vprintfmt+0x112>
+  80041a:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80041d:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800420:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800423:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800427:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80042a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80042d:	83 fe 09             	cmp    $0x9,%esi
+  800430:	76 eb                	jbe    80041d <vprintfmt+0xa6>
+  800432:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800435:	89 d6                	mov    %edx,%esi
+  800437:	eb 13                	jmp    80044c <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800439:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043c:	8b 00                	mov    (%eax),%eax
+  80043e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800441:	8b 45 14             	mov    0x14(%ebp),%eax
+  800444:	8d 40 04             	lea    0x4(%eax),%eax
+  800447:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80044a:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80044c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800450:	79 83                	jns    8003d5 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800452:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800455:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800458:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80045f:	e9 71 ff ff ff       	jmp    8003d5 <vprintfmt+0x5e>
+			if (width < 0)
+  800464:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800467:	85 c9                	test   %ecx,%ecx
+  800469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046e:	0f 49 c1             	cmovns %ecx,%eax
+  800471:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800474:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800476:	e9 5a ff ff ff       	jmp    8003d5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80047b:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80047d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800484:	e9 4c ff ff ff       	jmp    8003d5 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800489:	89 d6                	mov    %edx,%esi
+  80048b:	eb bf                	jmp    80044c <vprintfmt+0xd5>
+			lflag++;
+  80048d:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800491:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800493:	e9 3d ff ff ff       	jmp    8003d5 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800498:	89 55 10             	mov    %edx,0x10(%ebp)
+  80049b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049e:	8d 70 04             	lea    0x4(%eax),%esi
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	53                   	push   %ebx
+  8004a5:	ff 30                	push   (%eax)
+  8004a7:	ff d7                	call   *%edi
+			break;
+  8004a9:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ac:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8004af:	e9 d4 fe ff ff       	jmp    800388 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8004b4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ba:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8004bd:	8b 10                	mov    (%eax),%edx
+  8004bf:	89 d0                	mov    %edx,%eax
+  8004c1:	f7 d8                	neg    %eax
+  8004c3:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c6:	83 f8 12             	cmp    $0x12,%eax
+  8004c9:	7f 23                	jg     8004ee <vprintfmt+0x177>
+  8004cb:	8b 14 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%edx
+  8004d2:	85 d2                	test   %edx,%edx
+  8004d4:	74 18                	je     8004ee <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8004d6:	52                   	push   %edx
+  8004d7:	68 db 3f 80 00       	push   $0x803fdb
+  8004dc:	53                   	push   %ebx
+  8004dd:	57                   	push   %edi
+  8004de:	e8 77 fe ff ff       	call   80035a <printfmt>
+  8004e3:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004e6:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004e9:	e9 9a fe ff ff       	jmp    800388 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004ee:	50                   	push   %eax
+  8004ef:	68 cf 3b 80 00       	push   $0x803bcf
+  8004f4:	53                   	push   %ebx
+  8004f5:	57                   	push   %edi
+  8004f6:	e8 5f fe ff ff       	call   80035a <printfmt>
+  8004fb:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004fe:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800501:	e9 82 fe ff ff       	jmp    800388 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800506:	89 55 10             	mov    %edx,0x10(%ebp)
+  800509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050c:	83 c0 04             	add    $0x4,%eax
+  80050f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800512:	8b 45 14             	mov    0x14(%ebp),%eax
+  800515:	8b 00                	mov    (%eax),%eax
+  800517:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051a:	85 c0                	test   %eax,%eax
+  80051c:	0f 84 61 03 00 00    	je     800883 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800522:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800526:	7e 06                	jle    80052e <vprintfmt+0x1b7>
+  800528:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80052c:	75 29                	jne    800557 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80052e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800531:	8d 70 01             	lea    0x1(%eax),%esi
+  800534:	0f b6 00             	movzbl (%eax),%eax
+  800537:	0f be d0             	movsbl %al,%edx
+  80053a:	85 d2                	test   %edx,%edx
+  80053c:	0f 84 bb 00 00 00    	je     8005fd <vprintfmt+0x286>
+  800542:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800545:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800548:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80054b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80054e:	eb 7a                	jmp    8005ca <vprintfmt+0x253>
+				p = "(null)";
+  800550:	c7 45 d0 c8 3b 80 00 	movl   $0x803bc8,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	ff 75 d4             	push   -0x2c(%ebp)
+  80055d:	ff 75 d0             	push   -0x30(%ebp)
+  800560:	e8 e0 03 00 00       	call   800945 <strnlen>
+  800565:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800568:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80056b:	83 c4 10             	add    $0x10,%esp
+  80056e:	85 d2                	test   %edx,%edx
+  800570:	0f 8e d6 02 00 00    	jle    80084c <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800576:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80057a:	83 ec 08             	sub    $0x8,%esp
+  80057d:	53                   	push   %ebx
+  80057e:	56                   	push   %esi
+  80057f:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800581:	83 c4 10             	add    $0x10,%esp
+  800584:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800588:	75 f0                	jne    80057a <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80058a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80058d:	8d 70 01             	lea    0x1(%eax),%esi
+  800590:	0f b6 00             	movzbl (%eax),%eax
+  800593:	0f be d0             	movsbl %al,%edx
+  800596:	85 d2                	test   %edx,%edx
+  800598:	0f 84 da 02 00 00    	je     800878 <vprintfmt+0x501>
+  80059e:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8005a1:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8005a4:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8005a7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8005aa:	eb 1e                	jmp    8005ca <vprintfmt+0x253>
+					putch(ch, putdat);
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	ff 75 0c             	push   0xc(%ebp)
+  8005b2:	52                   	push   %edx
+  8005b3:	ff 55 08             	call   *0x8(%ebp)
+  8005b6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005b9:	83 eb 01             	sub    $0x1,%ebx
+  8005bc:	83 c6 01             	add    $0x1,%esi
+  8005bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005c3:	0f be d0             	movsbl %al,%edx
+  8005c6:	85 d2                	test   %edx,%edx
+  8005c8:	74 2a                	je     8005f4 <vprintfmt+0x27d>
+  8005ca:	85 ff                	test   %edi,%edi
+  8005cc:	78 05                	js     8005d3 <vprintfmt+0x25c>
+  8005ce:	83 ef 01             	sub    $0x1,%edi
+  8005d1:	78 59                	js     80062c <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005d7:	74 d3                	je     8005ac <vprintfmt+0x235>
+  8005d9:	0f be c0             	movsbl %al,%eax
+  8005dc:	83 e8 20             	sub    $0x20,%eax
+  8005df:	83 f8 5e             	cmp    $0x5e,%eax
+  8005e2:	76 c8                	jbe    8005ac <vprintfmt+0x235>
+					putch('?', putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	ff 75 0c             	push   0xc(%ebp)
+  8005ea:	6a 3f                	push   $0x3f
+  8005ec:	ff 55 08             	call   *0x8(%ebp)
+  8005ef:	83 c4 10             	add    $0x10,%esp
+  8005f2:	eb c5                	jmp    8005b9 <vprintfmt+0x242>
+  8005f4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005fd:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800600:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800604:	7e 1b                	jle    800621 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  800606:	83 ec 08             	sub    $0x8,%esp
+  800609:	53                   	push   %ebx
+  80060a:	6a 20                	push   $0x20
+  80060c:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  80060e:	83 c4 10             	add    $0x10,%esp
+  800611:	83 ee 01             	sub    $0x1,%esi
+  800614:	75 f0                	jne    800606 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800616:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800619:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061c:	e9 67 fd ff ff       	jmp    800388 <vprintfmt+0x11>
+  800621:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+  800627:	e9 5c fd ff ff       	jmp    800388 <vprintfmt+0x11>
+  80062c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80062f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800632:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800635:	eb c6                	jmp    8005fd <vprintfmt+0x286>
+	if (lflag >= 2)
+  800637:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80063a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80063d:	83 f9 01             	cmp    $0x1,%ecx
+  800640:	7f 1f                	jg     800661 <vprintfmt+0x2ea>
+	else if (lflag)
+  800642:	85 c9                	test   %ecx,%ecx
+  800644:	74 67                	je     8006ad <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800646:	8b 45 14             	mov    0x14(%ebp),%eax
+  800649:	8b 30                	mov    (%eax),%esi
+  80064b:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80064e:	89 f0                	mov    %esi,%eax
+  800650:	c1 f8 1f             	sar    $0x1f,%eax
+  800653:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80065f:	eb 17                	jmp    800678 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8b 50 04             	mov    0x4(%eax),%edx
+  800667:	8b 00                	mov    (%eax),%eax
+  800669:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80066f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800672:	8d 40 08             	lea    0x8(%eax),%eax
+  800675:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800678:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80067b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80067e:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800683:	85 c9                	test   %ecx,%ecx
+  800685:	0f 89 12 01 00 00    	jns    80079d <vprintfmt+0x426>
+				putch('-', putdat);
+  80068b:	83 ec 08             	sub    $0x8,%esp
+  80068e:	53                   	push   %ebx
+  80068f:	6a 2d                	push   $0x2d
+  800691:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800693:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800696:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800699:	f7 da                	neg    %edx
+  80069b:	83 d1 00             	adc    $0x0,%ecx
+  80069e:	f7 d9                	neg    %ecx
+  8006a0:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006a3:	be 0a 00 00 00       	mov    $0xa,%esi
+  8006a8:	e9 f0 00 00 00       	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 30                	mov    (%eax),%esi
+  8006b2:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8006b5:	89 f0                	mov    %esi,%eax
+  8006b7:	c1 f8 1f             	sar    $0x1f,%eax
+  8006ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006c6:	eb b0                	jmp    800678 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8006c8:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006cb:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006ce:	83 f9 01             	cmp    $0x1,%ecx
+  8006d1:	7f 1e                	jg     8006f1 <vprintfmt+0x37a>
+	else if (lflag)
+  8006d3:	85 c9                	test   %ecx,%ecx
+  8006d5:	74 32                	je     800709 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 10                	mov    (%eax),%edx
+  8006dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e7:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006ec:	e9 ac 00 00 00       	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 10                	mov    (%eax),%edx
+  8006f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ff:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800704:	e9 94 00 00 00       	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800709:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070c:	8b 10                	mov    (%eax),%edx
+  80070e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800713:	8d 40 04             	lea    0x4(%eax),%eax
+  800716:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800719:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80071e:	eb 7d                	jmp    80079d <vprintfmt+0x426>
+	if (lflag >= 2)
+  800720:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800723:	89 55 10             	mov    %edx,0x10(%ebp)
+  800726:	83 f9 01             	cmp    $0x1,%ecx
+  800729:	7f 1b                	jg     800746 <vprintfmt+0x3cf>
+	else if (lflag)
+  80072b:	85 c9                	test   %ecx,%ecx
+  80072d:	74 2c                	je     80075b <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80072f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800732:	8b 10                	mov    (%eax),%edx
+  800734:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800739:	8d 40 04             	lea    0x4(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073f:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800744:	eb 57                	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80074e:	8d 40 08             	lea    0x8(%eax),%eax
+  800751:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800754:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800759:	eb 42                	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 10                	mov    (%eax),%edx
+  800760:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800765:	8d 40 04             	lea    0x4(%eax),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80076b:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800770:	eb 2b                	jmp    80079d <vprintfmt+0x426>
+			putch('0', putdat);
+  800772:	89 55 10             	mov    %edx,0x10(%ebp)
+  800775:	83 ec 08             	sub    $0x8,%esp
+  800778:	53                   	push   %ebx
+  800779:	6a 30                	push   $0x30
+  80077b:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80077d:	83 c4 08             	add    $0x8,%esp
+  800780:	53                   	push   %ebx
+  800781:	6a 78                	push   $0x78
+  800783:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80078f:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800798:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80079d:	83 ec 0c             	sub    $0xc,%esp
+  8007a0:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8007a4:	50                   	push   %eax
+  8007a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8007a8:	56                   	push   %esi
+  8007a9:	51                   	push   %ecx
+  8007aa:	52                   	push   %edx
+  8007ab:	89 da                	mov    %ebx,%edx
+  8007ad:	89 f8                	mov    %edi,%eax
+  8007af:	e8 d8 fa ff ff       	call   80028c <printnum>
+			break;
+  8007b4:	83 c4 20             	add    $0x20,%esp
+  8007b7:	e9 cc fb ff ff       	jmp    800388 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8007bc:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007bf:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007c2:	83 f9 01             	cmp    $0x1,%ecx
+  8007c5:	7f 1b                	jg     8007e2 <vprintfmt+0x46b>
+	else if (lflag)
+  8007c7:	85 c9                	test   %ecx,%ecx
+  8007c9:	74 2c                	je     8007f7 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8b 10                	mov    (%eax),%edx
+  8007d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007db:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8007e0:	eb bb                	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ea:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007f0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007f5:	eb a6                	jmp    80079d <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8b 10                	mov    (%eax),%edx
+  8007fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800801:	8d 40 04             	lea    0x4(%eax),%eax
+  800804:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800807:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  80080c:	eb 8f                	jmp    80079d <vprintfmt+0x426>
+			putch(ch, putdat);
+  80080e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	53                   	push   %ebx
+  800815:	6a 25                	push   $0x25
+  800817:	ff d7                	call   *%edi
+			break;
+  800819:	83 c4 10             	add    $0x10,%esp
+  80081c:	e9 67 fb ff ff       	jmp    800388 <vprintfmt+0x11>
+			putch('%', putdat);
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	53                   	push   %ebx
+  800825:	6a 25                	push   $0x25
+  800827:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800829:	83 c4 10             	add    $0x10,%esp
+  80082c:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800830:	0f 84 ba fb ff ff    	je     8003f0 <vprintfmt+0x79>
+  800836:	89 75 10             	mov    %esi,0x10(%ebp)
+  800839:	89 f0                	mov    %esi,%eax
+  80083b:	83 e8 01             	sub    $0x1,%eax
+  80083e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800842:	75 f7                	jne    80083b <vprintfmt+0x4c4>
+  800844:	89 45 10             	mov    %eax,0x10(%ebp)
+  800847:	e9 3c fb ff ff       	jmp    800388 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80084c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80084f:	8d 70 01             	lea    0x1(%eax),%esi
+  800852:	0f b6 00             	movzbl (%eax),%eax
+  800855:	0f be d0             	movsbl %al,%edx
+  800858:	85 d2                	test   %edx,%edx
+  80085a:	74 11                	je     80086d <vprintfmt+0x4f6>
+  80085c:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80085f:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800862:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800865:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800868:	e9 5d fd ff ff       	jmp    8005ca <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80086d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800870:	89 45 14             	mov    %eax,0x14(%ebp)
+  800873:	e9 10 fb ff ff       	jmp    800388 <vprintfmt+0x11>
+  800878:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80087e:	e9 05 fb ff ff       	jmp    800388 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800883:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800887:	7e 0a                	jle    800893 <vprintfmt+0x51c>
+  800889:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80088d:	0f 85 bd fc ff ff    	jne    800550 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800893:	ba 28 00 00 00       	mov    $0x28,%edx
+  800898:	b8 28 00 00 00       	mov    $0x28,%eax
+  80089d:	be c9 3b 80 00       	mov    $0x803bc9,%esi
+  8008a2:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8008a5:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8008a8:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8008ab:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8008ae:	e9 17 fd ff ff       	jmp    8005ca <vprintfmt+0x253>
+}
+  8008b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b6:	5b                   	pop    %ebx
+  8008b7:	5e                   	pop    %esi
+  8008b8:	5f                   	pop    %edi
+  8008b9:	5d                   	pop    %ebp
+  8008ba:	c3                   	ret
+
+008008bb <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008bb:	55                   	push   %ebp
+  8008bc:	89 e5                	mov    %esp,%ebp
+  8008be:	83 ec 18             	sub    $0x18,%esp
+  8008c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008ca:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008ce:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008d8:	85 c0                	test   %eax,%eax
+  8008da:	74 26                	je     800902 <vsnprintf+0x47>
+  8008dc:	85 d2                	test   %edx,%edx
+  8008de:	7e 22                	jle    800902 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008e0:	ff 75 14             	push   0x14(%ebp)
+  8008e3:	ff 75 10             	push   0x10(%ebp)
+  8008e6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008e9:	50                   	push   %eax
+  8008ea:	68 3d 03 80 00       	push   $0x80033d
+  8008ef:	e8 83 fa ff ff       	call   800377 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008f7:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008fd:	83 c4 10             	add    $0x10,%esp
+}
+  800900:	c9                   	leave
+  800901:	c3                   	ret
+		return -E_INVAL;
+  800902:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800907:	eb f7                	jmp    800900 <vsnprintf+0x45>
+
+00800909 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80090f:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800912:	50                   	push   %eax
+  800913:	ff 75 10             	push   0x10(%ebp)
+  800916:	ff 75 0c             	push   0xc(%ebp)
+  800919:	ff 75 08             	push   0x8(%ebp)
+  80091c:	e8 9a ff ff ff       	call   8008bb <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800921:	c9                   	leave
+  800922:	c3                   	ret
+
+00800923 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800923:	55                   	push   %ebp
+  800924:	89 e5                	mov    %esp,%ebp
+  800926:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800929:	80 3a 00             	cmpb   $0x0,(%edx)
+  80092c:	74 10                	je     80093e <strlen+0x1b>
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800933:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800936:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80093a:	75 f7                	jne    800933 <strlen+0x10>
+	return n;
+}
+  80093c:	5d                   	pop    %ebp
+  80093d:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800943:	eb f7                	jmp    80093c <strlen+0x19>
+
+00800945 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80094b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80094e:	85 d2                	test   %edx,%edx
+  800950:	74 16                	je     800968 <strnlen+0x23>
+  800952:	b8 00 00 00 00       	mov    $0x0,%eax
+  800957:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80095b:	74 09                	je     800966 <strnlen+0x21>
+		n++;
+  80095d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800960:	39 d0                	cmp    %edx,%eax
+  800962:	75 f3                	jne    800957 <strnlen+0x12>
+		n++;
+  800964:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80096d:	eb f7                	jmp    800966 <strnlen+0x21>
+
+0080096f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80096f:	55                   	push   %ebp
+  800970:	89 e5                	mov    %esp,%ebp
+  800972:	53                   	push   %ebx
+  800973:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800976:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800982:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	84 d2                	test   %dl,%dl
+  80098a:	75 f2                	jne    80097e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80098c:	89 c8                	mov    %ecx,%eax
+  80098e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800991:	c9                   	leave
+  800992:	c3                   	ret
+
+00800993 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	53                   	push   %ebx
+  800997:	83 ec 10             	sub    $0x10,%esp
+  80099a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80099d:	53                   	push   %ebx
+  80099e:	e8 80 ff ff ff       	call   800923 <strlen>
+  8009a3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8009a6:	ff 75 0c             	push   0xc(%ebp)
+  8009a9:	01 d8                	add    %ebx,%eax
+  8009ab:	50                   	push   %eax
+  8009ac:	e8 be ff ff ff       	call   80096f <strcpy>
+	return dst;
+}
+  8009b1:	89 d8                	mov    %ebx,%eax
+  8009b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b6:	c9                   	leave
+  8009b7:	c3                   	ret
+
+008009b8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8009b8:	55                   	push   %ebp
+  8009b9:	89 e5                	mov    %esp,%ebp
+  8009bb:	56                   	push   %esi
+  8009bc:	53                   	push   %ebx
+  8009bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8009c6:	85 db                	test   %ebx,%ebx
+  8009c8:	74 17                	je     8009e1 <strncpy+0x29>
+  8009ca:	01 f3                	add    %esi,%ebx
+  8009cc:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  8009ce:	83 c0 01             	add    $0x1,%eax
+  8009d1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009d4:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8009d7:	80 f9 01             	cmp    $0x1,%cl
+  8009da:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8009dd:	39 c3                	cmp    %eax,%ebx
+  8009df:	75 ed                	jne    8009ce <strncpy+0x16>
+	}
+	return ret;
+}
+  8009e1:	89 f0                	mov    %esi,%eax
+  8009e3:	5b                   	pop    %ebx
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	56                   	push   %esi
+  8009eb:	53                   	push   %ebx
+  8009ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009f5:	89 f0                	mov    %esi,%eax
+  8009f7:	85 db                	test   %ebx,%ebx
+  8009f9:	74 1e                	je     800a19 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009fb:	83 eb 01             	sub    $0x1,%ebx
+  8009fe:	74 16                	je     800a16 <strlcpy+0x2f>
+  800a00:	01 f3                	add    %esi,%ebx
+  800a02:	0f b6 0a             	movzbl (%edx),%ecx
+  800a05:	84 c9                	test   %cl,%cl
+  800a07:	74 0d                	je     800a16 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800a09:	83 c2 01             	add    $0x1,%edx
+  800a0c:	83 c0 01             	add    $0x1,%eax
+  800a0f:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800a12:	39 d8                	cmp    %ebx,%eax
+  800a14:	75 ec                	jne    800a02 <strlcpy+0x1b>
+		*dst = '\0';
+  800a16:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800a19:	29 f0                	sub    %esi,%eax
+}
+  800a1b:	5b                   	pop    %ebx
+  800a1c:	5e                   	pop    %esi
+  800a1d:	5d                   	pop    %ebp
+  800a1e:	c3                   	ret
+
+00800a1f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a25:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800a28:	0f b6 01             	movzbl (%ecx),%eax
+  800a2b:	84 c0                	test   %al,%al
+  800a2d:	74 11                	je     800a40 <strcmp+0x21>
+  800a2f:	38 02                	cmp    %al,(%edx)
+  800a31:	75 0d                	jne    800a40 <strcmp+0x21>
+		p++, q++;
+  800a33:	83 c1 01             	add    $0x1,%ecx
+  800a36:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800a39:	0f b6 01             	movzbl (%ecx),%eax
+  800a3c:	84 c0                	test   %al,%al
+  800a3e:	75 ef                	jne    800a2f <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a40:	0f b6 c0             	movzbl %al,%eax
+  800a43:	0f b6 12             	movzbl (%edx),%edx
+  800a46:	29 d0                	sub    %edx,%eax
+}
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+
+00800a4a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	53                   	push   %ebx
+  800a4e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a51:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a54:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a57:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a5c:	85 d2                	test   %edx,%edx
+  800a5e:	74 2e                	je     800a8e <strncmp+0x44>
+  800a60:	0f b6 01             	movzbl (%ecx),%eax
+  800a63:	84 c0                	test   %al,%al
+  800a65:	74 16                	je     800a7d <strncmp+0x33>
+  800a67:	3a 03                	cmp    (%ebx),%al
+  800a69:	75 12                	jne    800a7d <strncmp+0x33>
+		n--, p++, q++;
+  800a6b:	83 c1 01             	add    $0x1,%ecx
+  800a6e:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a71:	83 ea 01             	sub    $0x1,%edx
+  800a74:	75 ea                	jne    800a60 <strncmp+0x16>
+		return 0;
+  800a76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7b:	eb 11                	jmp    800a8e <strncmp+0x44>
+  800a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a82:	85 d2                	test   %edx,%edx
+  800a84:	74 08                	je     800a8e <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a86:	0f b6 01             	movzbl (%ecx),%eax
+  800a89:	0f b6 13             	movzbl (%ebx),%edx
+  800a8c:	29 d0                	sub    %edx,%eax
+}
+  800a8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a91:	c9                   	leave
+  800a92:	c3                   	ret
+
+00800a93 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a93:	55                   	push   %ebp
+  800a94:	89 e5                	mov    %esp,%ebp
+  800a96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a99:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a9d:	0f b6 10             	movzbl (%eax),%edx
+  800aa0:	84 d2                	test   %dl,%dl
+  800aa2:	74 15                	je     800ab9 <strchr+0x26>
+		if (*s == c)
+  800aa4:	38 d1                	cmp    %dl,%cl
+  800aa6:	74 0f                	je     800ab7 <strchr+0x24>
+	for (; *s; s++)
+  800aa8:	83 c0 01             	add    $0x1,%eax
+  800aab:	0f b6 10             	movzbl (%eax),%edx
+  800aae:	84 d2                	test   %dl,%dl
+  800ab0:	75 f2                	jne    800aa4 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab7:	5d                   	pop    %ebp
+  800ab8:	c3                   	ret
+	return 0;
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abe:	eb f7                	jmp    800ab7 <strchr+0x24>
+
+00800ac0 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ac0:	55                   	push   %ebp
+  800ac1:	89 e5                	mov    %esp,%ebp
+  800ac3:	53                   	push   %ebx
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800aca:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800acd:	38 d3                	cmp    %dl,%bl
+  800acf:	74 14                	je     800ae5 <strfind+0x25>
+  800ad1:	89 d1                	mov    %edx,%ecx
+  800ad3:	84 db                	test   %bl,%bl
+  800ad5:	74 0e                	je     800ae5 <strfind+0x25>
+	for (; *s; s++)
+  800ad7:	83 c0 01             	add    $0x1,%eax
+  800ada:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800add:	38 ca                	cmp    %cl,%dl
+  800adf:	74 04                	je     800ae5 <strfind+0x25>
+  800ae1:	84 d2                	test   %dl,%dl
+  800ae3:	75 f2                	jne    800ad7 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	57                   	push   %edi
+  800aee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800af1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800af4:	85 c9                	test   %ecx,%ecx
+  800af6:	74 20                	je     800b18 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800af8:	89 f8                	mov    %edi,%eax
+  800afa:	09 c8                	or     %ecx,%eax
+  800afc:	a8 03                	test   $0x3,%al
+  800afe:	75 12                	jne    800b12 <memset+0x28>
+		c &= 0xFF;
+  800b00:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b04:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b0a:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b0d:	fc                   	cld
+  800b0e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b10:	eb 06                	jmp    800b18 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b15:	fc                   	cld
+  800b16:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b18:	89 f8                	mov    %edi,%eax
+  800b1a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b1d:	c9                   	leave
+  800b1e:	c3                   	ret
+
+00800b1f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b1f:	55                   	push   %ebp
+  800b20:	89 e5                	mov    %esp,%ebp
+  800b22:	57                   	push   %edi
+  800b23:	56                   	push   %esi
+  800b24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b27:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b2a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b2d:	39 c6                	cmp    %eax,%esi
+  800b2f:	73 32                	jae    800b63 <memmove+0x44>
+  800b31:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b34:	39 d0                	cmp    %edx,%eax
+  800b36:	73 2b                	jae    800b63 <memmove+0x44>
+		s += n;
+		d += n;
+  800b38:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b3b:	89 d6                	mov    %edx,%esi
+  800b3d:	09 fe                	or     %edi,%esi
+  800b3f:	09 ce                	or     %ecx,%esi
+  800b41:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b47:	75 0e                	jne    800b57 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b49:	83 ef 04             	sub    $0x4,%edi
+  800b4c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b4f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b52:	fd                   	std
+  800b53:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b55:	eb 09                	jmp    800b60 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b57:	83 ef 01             	sub    $0x1,%edi
+  800b5a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b5d:	fd                   	std
+  800b5e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b60:	fc                   	cld
+  800b61:	eb 1a                	jmp    800b7d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b63:	89 f2                	mov    %esi,%edx
+  800b65:	09 c2                	or     %eax,%edx
+  800b67:	09 ca                	or     %ecx,%edx
+  800b69:	f6 c2 03             	test   $0x3,%dl
+  800b6c:	75 0a                	jne    800b78 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b6e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b71:	89 c7                	mov    %eax,%edi
+  800b73:	fc                   	cld
+  800b74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b76:	eb 05                	jmp    800b7d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b78:	89 c7                	mov    %eax,%edi
+  800b7a:	fc                   	cld
+  800b7b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b7d:	5e                   	pop    %esi
+  800b7e:	5f                   	pop    %edi
+  800b7f:	5d                   	pop    %ebp
+  800b80:	c3                   	ret
+
+00800b81 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b87:	ff 75 10             	push   0x10(%ebp)
+  800b8a:	ff 75 0c             	push   0xc(%ebp)
+  800b8d:	ff 75 08             	push   0x8(%ebp)
+  800b90:	e8 8a ff ff ff       	call   800b1f <memmove>
+}
+  800b95:	c9                   	leave
+  800b96:	c3                   	ret
+
+00800b97 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	56                   	push   %esi
+  800b9b:	53                   	push   %ebx
+  800b9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ba2:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ba5:	85 f6                	test   %esi,%esi
+  800ba7:	74 29                	je     800bd2 <memcmp+0x3b>
+  800ba9:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800bab:	0f b6 08             	movzbl (%eax),%ecx
+  800bae:	0f b6 1a             	movzbl (%edx),%ebx
+  800bb1:	38 d9                	cmp    %bl,%cl
+  800bb3:	75 11                	jne    800bc6 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800bb5:	83 c0 01             	add    $0x1,%eax
+  800bb8:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800bbb:	39 c6                	cmp    %eax,%esi
+  800bbd:	75 ec                	jne    800bab <memcmp+0x14>
+	}
+
+	return 0;
+  800bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc4:	eb 08                	jmp    800bce <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800bc6:	0f b6 c1             	movzbl %cl,%eax
+  800bc9:	0f b6 db             	movzbl %bl,%ebx
+  800bcc:	29 d8                	sub    %ebx,%eax
+}
+  800bce:	5b                   	pop    %ebx
+  800bcf:	5e                   	pop    %esi
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+	return 0;
+  800bd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd7:	eb f5                	jmp    800bce <memcmp+0x37>
+
+00800bd9 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800be2:	89 c2                	mov    %eax,%edx
+  800be4:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800be7:	39 d0                	cmp    %edx,%eax
+  800be9:	73 0d                	jae    800bf8 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800beb:	38 08                	cmp    %cl,(%eax)
+  800bed:	74 0d                	je     800bfc <memfind+0x23>
+	for (; s < ends; s++)
+  800bef:	83 c0 01             	add    $0x1,%eax
+  800bf2:	39 c2                	cmp    %eax,%edx
+  800bf4:	75 f5                	jne    800beb <memfind+0x12>
+  800bf6:	eb 06                	jmp    800bfe <memfind+0x25>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	eb 02                	jmp    800bfe <memfind+0x25>
+  800bfc:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800bfe:	89 d0                	mov    %edx,%eax
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+
+00800c02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c0e:	0f b6 02             	movzbl (%edx),%eax
+  800c11:	3c 20                	cmp    $0x20,%al
+  800c13:	74 04                	je     800c19 <strtol+0x17>
+  800c15:	3c 09                	cmp    $0x9,%al
+  800c17:	75 0e                	jne    800c27 <strtol+0x25>
+		s++;
+  800c19:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c1c:	0f b6 02             	movzbl (%edx),%eax
+  800c1f:	3c 20                	cmp    $0x20,%al
+  800c21:	74 f6                	je     800c19 <strtol+0x17>
+  800c23:	3c 09                	cmp    $0x9,%al
+  800c25:	74 f2                	je     800c19 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c27:	3c 2b                	cmp    $0x2b,%al
+  800c29:	74 2a                	je     800c55 <strtol+0x53>
+	int neg = 0;
+  800c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c30:	3c 2d                	cmp    $0x2d,%al
+  800c32:	74 2b                	je     800c5f <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c34:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c3a:	75 0f                	jne    800c4b <strtol+0x49>
+  800c3c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c3f:	74 28                	je     800c69 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c41:	85 db                	test   %ebx,%ebx
+  800c43:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c48:	0f 44 d8             	cmove  %eax,%ebx
+  800c4b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c50:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c53:	eb 46                	jmp    800c9b <strtol+0x99>
+		s++;
+  800c55:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c5d:	eb d5                	jmp    800c34 <strtol+0x32>
+		s++, neg = 1;
+  800c5f:	83 c2 01             	add    $0x1,%edx
+  800c62:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c67:	eb cb                	jmp    800c34 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c69:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c6d:	74 0e                	je     800c7d <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c6f:	85 db                	test   %ebx,%ebx
+  800c71:	75 d8                	jne    800c4b <strtol+0x49>
+		s++, base = 8;
+  800c73:	83 c2 01             	add    $0x1,%edx
+  800c76:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c7b:	eb ce                	jmp    800c4b <strtol+0x49>
+		s += 2, base = 16;
+  800c7d:	83 c2 02             	add    $0x2,%edx
+  800c80:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c85:	eb c4                	jmp    800c4b <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c87:	0f be c0             	movsbl %al,%eax
+  800c8a:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c8d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c90:	7d 3a                	jge    800ccc <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c92:	83 c2 01             	add    $0x1,%edx
+  800c95:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c99:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c9b:	0f b6 02             	movzbl (%edx),%eax
+  800c9e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ca1:	89 f3                	mov    %esi,%ebx
+  800ca3:	80 fb 09             	cmp    $0x9,%bl
+  800ca6:	76 df                	jbe    800c87 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800ca8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cab:	89 f3                	mov    %esi,%ebx
+  800cad:	80 fb 19             	cmp    $0x19,%bl
+  800cb0:	77 08                	ja     800cba <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800cb2:	0f be c0             	movsbl %al,%eax
+  800cb5:	83 e8 57             	sub    $0x57,%eax
+  800cb8:	eb d3                	jmp    800c8d <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cba:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cbd:	89 f3                	mov    %esi,%ebx
+  800cbf:	80 fb 19             	cmp    $0x19,%bl
+  800cc2:	77 08                	ja     800ccc <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800cc4:	0f be c0             	movsbl %al,%eax
+  800cc7:	83 e8 37             	sub    $0x37,%eax
+  800cca:	eb c1                	jmp    800c8d <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ccc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cd0:	74 05                	je     800cd7 <strtol+0xd5>
+		*endptr = (char *) s;
+  800cd2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cd5:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800cd7:	89 c8                	mov    %ecx,%eax
+  800cd9:	f7 d8                	neg    %eax
+  800cdb:	85 ff                	test   %edi,%edi
+  800cdd:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ce0:	89 c8                	mov    %ecx,%eax
+  800ce2:	5b                   	pop    %ebx
+  800ce3:	5e                   	pop    %esi
+  800ce4:	5f                   	pop    %edi
+  800ce5:	5d                   	pop    %ebp
+  800ce6:	c3                   	ret
+
+00800ce7 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ce7:	55                   	push   %ebp
+  800ce8:	89 e5                	mov    %esp,%ebp
+  800cea:	57                   	push   %edi
+  800ceb:	56                   	push   %esi
+  800cec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ced:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf8:	89 c3                	mov    %eax,%ebx
+  800cfa:	89 c7                	mov    %eax,%edi
+  800cfc:	89 c6                	mov    %eax,%esi
+  800cfe:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d00:	5b                   	pop    %ebx
+  800d01:	5e                   	pop    %esi
+  800d02:	5f                   	pop    %edi
+  800d03:	5d                   	pop    %ebp
+  800d04:	c3                   	ret
+
+00800d05 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d10:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d15:	89 d1                	mov    %edx,%ecx
+  800d17:	89 d3                	mov    %edx,%ebx
+  800d19:	89 d7                	mov    %edx,%edi
+  800d1b:	89 d6                	mov    %edx,%esi
+  800d1d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d1f:	5b                   	pop    %ebx
+  800d20:	5e                   	pop    %esi
+  800d21:	5f                   	pop    %edi
+  800d22:	5d                   	pop    %ebp
+  800d23:	c3                   	ret
+
+00800d24 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d2d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d35:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d3a:	89 cb                	mov    %ecx,%ebx
+  800d3c:	89 cf                	mov    %ecx,%edi
+  800d3e:	89 ce                	mov    %ecx,%esi
+  800d40:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d42:	85 c0                	test   %eax,%eax
+  800d44:	7f 08                	jg     800d4e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d49:	5b                   	pop    %ebx
+  800d4a:	5e                   	pop    %esi
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  800d51:	50                   	push   %eax
+  800d52:	6a 03                	push   $0x3
+  800d54:	68 eb 3e 80 00       	push   $0x803eeb
+  800d59:	6a 23                	push   $0x23
+  800d5b:	68 08 3f 80 00       	push   $0x803f08
+  800d60:	e8 38 f4 ff ff       	call   80019d <_panic>
+
+00800d65 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	56                   	push   %esi
+  800d6a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d70:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d75:	89 d1                	mov    %edx,%ecx
+  800d77:	89 d3                	mov    %edx,%ebx
+  800d79:	89 d7                	mov    %edx,%edi
+  800d7b:	89 d6                	mov    %edx,%esi
+  800d7d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d7f:	5b                   	pop    %ebx
+  800d80:	5e                   	pop    %esi
+  800d81:	5f                   	pop    %edi
+  800d82:	5d                   	pop    %ebp
+  800d83:	c3                   	ret
+
+00800d84 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d94:	89 d1                	mov    %edx,%ecx
+  800d96:	89 d3                	mov    %edx,%ebx
+  800d98:	89 d7                	mov    %edx,%edi
+  800d9a:	89 d6                	mov    %edx,%esi
+  800d9c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d9e:	5b                   	pop    %ebx
+  800d9f:	5e                   	pop    %esi
+  800da0:	5f                   	pop    %edi
+  800da1:	5d                   	pop    %ebp
+  800da2:	c3                   	ret
+
+00800da3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dac:	be 00 00 00 00       	mov    $0x0,%esi
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dbc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbf:	89 f7                	mov    %esi,%edi
+  800dc1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc3:	85 c0                	test   %eax,%eax
+  800dc5:	7f 08                	jg     800dcf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	50                   	push   %eax
+  800dd3:	6a 04                	push   $0x4
+  800dd5:	68 eb 3e 80 00       	push   $0x803eeb
+  800dda:	6a 23                	push   $0x23
+  800ddc:	68 08 3f 80 00       	push   $0x803f08
+  800de1:	e8 b7 f3 ff ff       	call   80019d <_panic>
+
+00800de6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800def:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e00:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e03:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e05:	85 c0                	test   %eax,%eax
+  800e07:	7f 08                	jg     800e11 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0c:	5b                   	pop    %ebx
+  800e0d:	5e                   	pop    %esi
+  800e0e:	5f                   	pop    %edi
+  800e0f:	5d                   	pop    %ebp
+  800e10:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  800e14:	50                   	push   %eax
+  800e15:	6a 05                	push   $0x5
+  800e17:	68 eb 3e 80 00       	push   $0x803eeb
+  800e1c:	6a 23                	push   $0x23
+  800e1e:	68 08 3f 80 00       	push   $0x803f08
+  800e23:	e8 75 f3 ff ff       	call   80019d <_panic>
+
+00800e28 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e28:	55                   	push   %ebp
+  800e29:	89 e5                	mov    %esp,%ebp
+  800e2b:	57                   	push   %edi
+  800e2c:	56                   	push   %esi
+  800e2d:	53                   	push   %ebx
+  800e2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e41:	89 df                	mov    %ebx,%edi
+  800e43:	89 de                	mov    %ebx,%esi
+  800e45:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 06                	push   $0x6
+  800e59:	68 eb 3e 80 00       	push   $0x803eeb
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 08 3f 80 00       	push   $0x803f08
+  800e65:	e8 33 f3 ff ff       	call   80019d <_panic>
+
+00800e6a <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e83:	89 df                	mov    %ebx,%edi
+  800e85:	89 de                	mov    %ebx,%esi
+  800e87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 08                	jg     800e95 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 08                	push   $0x8
+  800e9b:	68 eb 3e 80 00       	push   $0x803eeb
+  800ea0:	6a 23                	push   $0x23
+  800ea2:	68 08 3f 80 00       	push   $0x803f08
+  800ea7:	e8 f1 f2 ff ff       	call   80019d <_panic>
+
+00800eac <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 08                	jg     800ed7 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 09                	push   $0x9
+  800edd:	68 eb 3e 80 00       	push   $0x803eeb
+  800ee2:	6a 23                	push   $0x23
+  800ee4:	68 08 3f 80 00       	push   $0x803f08
+  800ee9:	e8 af f2 ff ff       	call   80019d <_panic>
+
+00800eee <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  800ef4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f07:	89 df                	mov    %ebx,%edi
+  800f09:	89 de                	mov    %ebx,%esi
+  800f0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0d:	85 c0                	test   %eax,%eax
+  800f0f:	7f 08                	jg     800f19 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800f11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  800f1c:	50                   	push   %eax
+  800f1d:	6a 0a                	push   $0xa
+  800f1f:	68 eb 3e 80 00       	push   $0x803eeb
+  800f24:	6a 23                	push   $0x23
+  800f26:	68 08 3f 80 00       	push   $0x803f08
+  800f2b:	e8 6d f2 ff ff       	call   80019d <_panic>
+
+00800f30 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f41:	be 00 00 00 00       	mov    $0x0,%esi
+  800f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f49:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4c:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+
+00800f53 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f69:	89 cb                	mov    %ecx,%ebx
+  800f6b:	89 cf                	mov    %ecx,%edi
+  800f6d:	89 ce                	mov    %ecx,%esi
+  800f6f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f71:	85 c0                	test   %eax,%eax
+  800f73:	7f 08                	jg     800f7d <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f78:	5b                   	pop    %ebx
+  800f79:	5e                   	pop    %esi
+  800f7a:	5f                   	pop    %edi
+  800f7b:	5d                   	pop    %ebp
+  800f7c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f7d:	83 ec 0c             	sub    $0xc,%esp
+  800f80:	50                   	push   %eax
+  800f81:	6a 0d                	push   $0xd
+  800f83:	68 eb 3e 80 00       	push   $0x803eeb
+  800f88:	6a 23                	push   $0x23
+  800f8a:	68 08 3f 80 00       	push   $0x803f08
+  800f8f:	e8 09 f2 ff ff       	call   80019d <_panic>
+
+00800f94 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  800f97:	57                   	push   %edi
+  800f98:	56                   	push   %esi
+  800f99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fab:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fae:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+
+00800fb5 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	56                   	push   %esi
+  800fba:	53                   	push   %ebx
+  800fbb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fce:	89 df                	mov    %ebx,%edi
+  800fd0:	89 de                	mov    %ebx,%esi
+  800fd2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd4:	85 c0                	test   %eax,%eax
+  800fd6:	7f 08                	jg     800fe0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800fd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdb:	5b                   	pop    %ebx
+  800fdc:	5e                   	pop    %esi
+  800fdd:	5f                   	pop    %edi
+  800fde:	5d                   	pop    %ebp
+  800fdf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe0:	83 ec 0c             	sub    $0xc,%esp
+  800fe3:	50                   	push   %eax
+  800fe4:	6a 0d                	push   $0xd
+  800fe6:	68 eb 3e 80 00       	push   $0x803eeb
+  800feb:	6a 23                	push   $0x23
+  800fed:	68 08 3f 80 00       	push   $0x803f08
+  800ff2:	e8 a6 f1 ff ff       	call   80019d <_panic>
+
+00800ff7 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  800ffa:	57                   	push   %edi
+  800ffb:	56                   	push   %esi
+  800ffc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801002:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801007:	89 d1                	mov    %edx,%ecx
+  801009:	89 d3                	mov    %edx,%ebx
+  80100b:	89 d7                	mov    %edx,%edi
+  80100d:	89 d6                	mov    %edx,%esi
+  80100f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801027:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80102c:	89 df                	mov    %ebx,%edi
+  80102e:	89 de                	mov    %ebx,%esi
+  801030:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+
+00801037 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	b8 10 00 00 00       	mov    $0x10,%eax
+  80104a:	89 cb                	mov    %ecx,%ebx
+  80104c:	89 cf                	mov    %ecx,%edi
+  80104e:	89 ce                	mov    %ecx,%esi
+  801050:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801052:	5b                   	pop    %ebx
+  801053:	5e                   	pop    %esi
+  801054:	5f                   	pop    %edi
+  801055:	5d                   	pop    %ebp
+  801056:	c3                   	ret
+
+00801057 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801057:	55                   	push   %ebp
+  801058:	89 e5                	mov    %esp,%ebp
+  80105a:	57                   	push   %edi
+  80105b:	56                   	push   %esi
+  80105c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801062:	8b 55 08             	mov    0x8(%ebp),%edx
+  801065:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801068:	b8 11 00 00 00       	mov    $0x11,%eax
+  80106d:	89 df                	mov    %ebx,%edi
+  80106f:	89 de                	mov    %ebx,%esi
+  801071:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 12 00 00 00       	mov    $0x12,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	89 de                	mov    %ebx,%esi
+  801092:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+
+00801099 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ac:	89 cb                	mov    %ecx,%ebx
+  8010ae:	89 cf                	mov    %ecx,%edi
+  8010b0:	89 ce                	mov    %ecx,%esi
+  8010b2:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010cf:	89 df                	mov    %ebx,%edi
+  8010d1:	89 de                	mov    %ebx,%esi
+  8010d3:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8010d5:	5b                   	pop    %ebx
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ed:	89 cb                	mov    %ecx,%ebx
+  8010ef:	89 cf                	mov    %ecx,%edi
+  8010f1:	89 ce                	mov    %ecx,%esi
+  8010f3:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+
+008010fa <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010fa:	55                   	push   %ebp
+  8010fb:	89 e5                	mov    %esp,%ebp
+  8010fd:	57                   	push   %edi
+  8010fe:	56                   	push   %esi
+  8010ff:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801100:	be 00 00 00 00       	mov    $0x0,%esi
+  801105:	8b 55 08             	mov    0x8(%ebp),%edx
+  801108:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110b:	b8 16 00 00 00       	mov    $0x16,%eax
+  801110:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801113:	89 f7                	mov    %esi,%edi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+
+0080111c <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	b8 17 00 00 00       	mov    $0x17,%eax
+  801132:	89 df                	mov    %ebx,%edi
+  801134:	89 de                	mov    %ebx,%esi
+  801136:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801138:	5b                   	pop    %ebx
+  801139:	5e                   	pop    %esi
+  80113a:	5f                   	pop    %edi
+  80113b:	5d                   	pop    %ebp
+  80113c:	c3                   	ret
+
+0080113d <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	57                   	push   %edi
+  801141:	56                   	push   %esi
+  801142:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801143:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801148:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114b:	b8 18 00 00 00       	mov    $0x18,%eax
+  801150:	89 cb                	mov    %ecx,%ebx
+  801152:	89 cf                	mov    %ecx,%edi
+  801154:	89 ce                	mov    %ecx,%esi
+  801156:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801158:	5b                   	pop    %ebx
+  801159:	5e                   	pop    %esi
+  80115a:	5f                   	pop    %edi
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+
+0080115d <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80115d:	55                   	push   %ebp
+  80115e:	89 e5                	mov    %esp,%ebp
+  801160:	57                   	push   %edi
+  801161:	56                   	push   %esi
+  801162:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801163:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116f:	b8 19 00 00 00       	mov    $0x19,%eax
+  801174:	89 df                	mov    %ebx,%edi
+  801176:	89 de                	mov    %ebx,%esi
+  801178:	cd 30                	int    $0x30
+}
+  80117a:	5b                   	pop    %ebx
+  80117b:	5e                   	pop    %esi
+  80117c:	5f                   	pop    %edi
+  80117d:	5d                   	pop    %ebp
+  80117e:	c3                   	ret
+
+0080117f <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80117f:	55                   	push   %ebp
+  801180:	89 e5                	mov    %esp,%ebp
+  801182:	57                   	push   %edi
+  801183:	56                   	push   %esi
+  801184:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801185:	be 00 00 00 00       	mov    $0x0,%esi
+  80118a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801190:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801195:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801198:	89 f7                	mov    %esi,%edi
+  80119a:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+
+008011a1 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	57                   	push   %edi
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8011b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ba:	89 f7                	mov    %esi,%edi
+  8011bc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8011be:	5b                   	pop    %ebx
+  8011bf:	5e                   	pop    %esi
+  8011c0:	5f                   	pop    %edi
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	c3                   	ret
+
+008011c3 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8011d9:	89 df                	mov    %ebx,%edi
+  8011db:	89 de                	mov    %ebx,%esi
+  8011dd:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011df:	5b                   	pop    %ebx
+  8011e0:	5e                   	pop    %esi
+  8011e1:	5f                   	pop    %edi
+  8011e2:	5d                   	pop    %ebp
+  8011e3:	c3                   	ret
+
+008011e4 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	57                   	push   %edi
+  8011e8:	56                   	push   %esi
+  8011e9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011fa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011fd:	89 f7                	mov    %esi,%edi
+  8011ff:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+
+00801206 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801209:	8b 45 08             	mov    0x8(%ebp),%eax
+  80120c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801211:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+
+00801216 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801216:	55                   	push   %ebp
+  801217:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801219:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121c:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801221:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801226:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+
+0080122d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80122d:	55                   	push   %ebp
+  80122e:	89 e5                	mov    %esp,%ebp
+  801230:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801235:	89 c2                	mov    %eax,%edx
+  801237:	c1 ea 16             	shr    $0x16,%edx
+  80123a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801241:	f6 c2 01             	test   $0x1,%dl
+  801244:	74 29                	je     80126f <fd_alloc+0x42>
+  801246:	89 c2                	mov    %eax,%edx
+  801248:	c1 ea 0c             	shr    $0xc,%edx
+  80124b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801252:	f6 c2 01             	test   $0x1,%dl
+  801255:	74 18                	je     80126f <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801257:	05 00 10 00 00       	add    $0x1000,%eax
+  80125c:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801261:	75 d2                	jne    801235 <fd_alloc+0x8>
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801268:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80126d:	eb 05                	jmp    801274 <fd_alloc+0x47>
+			return 0;
+  80126f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801274:	8b 55 08             	mov    0x8(%ebp),%edx
+  801277:	89 02                	mov    %eax,(%edx)
+}
+  801279:	89 c8                	mov    %ecx,%eax
+  80127b:	5d                   	pop    %ebp
+  80127c:	c3                   	ret
+
+0080127d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801283:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801288:	77 30                	ja     8012ba <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80128a:	c1 e0 0c             	shl    $0xc,%eax
+  80128d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801292:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801298:	f6 c2 01             	test   $0x1,%dl
+  80129b:	74 24                	je     8012c1 <fd_lookup+0x44>
+  80129d:	89 c2                	mov    %eax,%edx
+  80129f:	c1 ea 0c             	shr    $0xc,%edx
+  8012a2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012a9:	f6 c2 01             	test   $0x1,%dl
+  8012ac:	74 1a                	je     8012c8 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b1:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012b8:	5d                   	pop    %ebp
+  8012b9:	c3                   	ret
+		return -E_INVAL;
+  8012ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012bf:	eb f7                	jmp    8012b8 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8012c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012c6:	eb f0                	jmp    8012b8 <fd_lookup+0x3b>
+  8012c8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012cd:	eb e9                	jmp    8012b8 <fd_lookup+0x3b>
+
+008012cf <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	53                   	push   %ebx
+  8012d3:	83 ec 04             	sub    $0x4,%esp
+  8012d6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8012e3:	39 13                	cmp    %edx,(%ebx)
+  8012e5:	74 54                	je     80133b <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8012e7:	83 c0 01             	add    $0x1,%eax
+  8012ea:	8b 1c 85 94 3f 80 00 	mov    0x803f94(,%eax,4),%ebx
+  8012f1:	85 db                	test   %ebx,%ebx
+  8012f3:	75 ee                	jne    8012e3 <dev_lookup+0x14>
+  8012f5:	89 e1                	mov    %esp,%ecx
+  8012f7:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012fc:	29 c8                	sub    %ecx,%eax
+  8012fe:	89 c1                	mov    %eax,%ecx
+  801300:	c1 e9 0f             	shr    $0xf,%ecx
+  801303:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130d:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801310:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801317:	8b 40 48             	mov    0x48(%eax),%eax
+  80131a:	83 ec 04             	sub    $0x4,%esp
+  80131d:	52                   	push   %edx
+  80131e:	50                   	push   %eax
+  80131f:	68 18 3f 80 00       	push   $0x803f18
+  801324:	e8 4f ef ff ff       	call   800278 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801329:	83 c4 10             	add    $0x10,%esp
+  80132c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801331:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801334:	89 1a                	mov    %ebx,(%edx)
+}
+  801336:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801339:	c9                   	leave
+  80133a:	c3                   	ret
+			return 0;
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	eb ef                	jmp    801331 <dev_lookup+0x62>
+
+00801342 <fd_close>:
+{
+  801342:	55                   	push   %ebp
+  801343:	89 e5                	mov    %esp,%ebp
+  801345:	57                   	push   %edi
+  801346:	56                   	push   %esi
+  801347:	53                   	push   %ebx
+  801348:	83 ec 24             	sub    $0x24,%esp
+  80134b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80134e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801351:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801354:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801355:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80135b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80135e:	50                   	push   %eax
+  80135f:	e8 19 ff ff ff       	call   80127d <fd_lookup>
+  801364:	89 c3                	mov    %eax,%ebx
+  801366:	83 c4 10             	add    $0x10,%esp
+  801369:	85 c0                	test   %eax,%eax
+  80136b:	78 05                	js     801372 <fd_close+0x30>
+	    || fd != fd2)
+  80136d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801370:	74 0f                	je     801381 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801372:	85 ff                	test   %edi,%edi
+  801374:	0f 44 df             	cmove  %edi,%ebx
+}
+  801377:	89 d8                	mov    %ebx,%eax
+  801379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80137c:	5b                   	pop    %ebx
+  80137d:	5e                   	pop    %esi
+  80137e:	5f                   	pop    %edi
+  80137f:	5d                   	pop    %ebp
+  801380:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801381:	83 ec 08             	sub    $0x8,%esp
+  801384:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801387:	50                   	push   %eax
+  801388:	ff 36                	push   (%esi)
+  80138a:	e8 40 ff ff ff       	call   8012cf <dev_lookup>
+  80138f:	89 c3                	mov    %eax,%ebx
+  801391:	83 c4 10             	add    $0x10,%esp
+  801394:	85 c0                	test   %eax,%eax
+  801396:	78 1a                	js     8013b2 <fd_close+0x70>
+		if (dev->dev_close)
+  801398:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80139b:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80139e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8013a3:	85 c0                	test   %eax,%eax
+  8013a5:	74 0b                	je     8013b2 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  8013a7:	83 ec 0c             	sub    $0xc,%esp
+  8013aa:	56                   	push   %esi
+  8013ab:	ff d0                	call   *%eax
+  8013ad:	89 c3                	mov    %eax,%ebx
+  8013af:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8013b2:	83 ec 08             	sub    $0x8,%esp
+  8013b5:	56                   	push   %esi
+  8013b6:	6a 00                	push   $0x0
+  8013b8:	e8 6b fa ff ff       	call   800e28 <sys_page_unmap>
+	return r;
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	eb b5                	jmp    801377 <fd_close+0x35>
+
+008013c2 <close>:
+
+int
+close(int fdnum)
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013cb:	50                   	push   %eax
+  8013cc:	ff 75 08             	push   0x8(%ebp)
+  8013cf:	e8 a9 fe ff ff       	call   80127d <fd_lookup>
+  8013d4:	83 c4 10             	add    $0x10,%esp
+  8013d7:	85 c0                	test   %eax,%eax
+  8013d9:	79 02                	jns    8013dd <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013db:	c9                   	leave
+  8013dc:	c3                   	ret
+		return fd_close(fd, 1);
+  8013dd:	83 ec 08             	sub    $0x8,%esp
+  8013e0:	6a 01                	push   $0x1
+  8013e2:	ff 75 f4             	push   -0xc(%ebp)
+  8013e5:	e8 58 ff ff ff       	call   801342 <fd_close>
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	eb ec                	jmp    8013db <close+0x19>
+
+008013ef <close_all>:
+
+void
+close_all(void)
+{
+  8013ef:	55                   	push   %ebp
+  8013f0:	89 e5                	mov    %esp,%ebp
+  8013f2:	53                   	push   %ebx
+  8013f3:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013fb:	83 ec 0c             	sub    $0xc,%esp
+  8013fe:	53                   	push   %ebx
+  8013ff:	e8 be ff ff ff       	call   8013c2 <close>
+	for (i = 0; i < MAXFD; i++)
+  801404:	83 c3 01             	add    $0x1,%ebx
+  801407:	83 c4 10             	add    $0x10,%esp
+  80140a:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801410:	75 e9                	jne    8013fb <close_all+0xc>
+}
+  801412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801415:	c9                   	leave
+  801416:	c3                   	ret
+
+00801417 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801420:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	ff 75 08             	push   0x8(%ebp)
+  801427:	e8 51 fe ff ff       	call   80127d <fd_lookup>
+  80142c:	89 c3                	mov    %eax,%ebx
+  80142e:	83 c4 10             	add    $0x10,%esp
+  801431:	85 c0                	test   %eax,%eax
+  801433:	78 7f                	js     8014b4 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801435:	83 ec 0c             	sub    $0xc,%esp
+  801438:	ff 75 0c             	push   0xc(%ebp)
+  80143b:	e8 82 ff ff ff       	call   8013c2 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801440:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801443:	c1 e6 0c             	shl    $0xc,%esi
+  801446:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80144c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80144f:	89 3c 24             	mov    %edi,(%esp)
+  801452:	e8 bf fd ff ff       	call   801216 <fd2data>
+  801457:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801459:	89 34 24             	mov    %esi,(%esp)
+  80145c:	e8 b5 fd ff ff       	call   801216 <fd2data>
+  801461:	83 c4 10             	add    $0x10,%esp
+  801464:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801467:	89 d8                	mov    %ebx,%eax
+  801469:	c1 e8 16             	shr    $0x16,%eax
+  80146c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801473:	a8 01                	test   $0x1,%al
+  801475:	74 11                	je     801488 <dup+0x71>
+  801477:	89 d8                	mov    %ebx,%eax
+  801479:	c1 e8 0c             	shr    $0xc,%eax
+  80147c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801483:	f6 c2 01             	test   $0x1,%dl
+  801486:	75 36                	jne    8014be <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801488:	89 f8                	mov    %edi,%eax
+  80148a:	c1 e8 0c             	shr    $0xc,%eax
+  80148d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801494:	83 ec 0c             	sub    $0xc,%esp
+  801497:	25 07 0e 00 00       	and    $0xe07,%eax
+  80149c:	50                   	push   %eax
+  80149d:	56                   	push   %esi
+  80149e:	6a 00                	push   $0x0
+  8014a0:	57                   	push   %edi
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	e8 3e f9 ff ff       	call   800de6 <sys_page_map>
+  8014a8:	89 c3                	mov    %eax,%ebx
+  8014aa:	83 c4 20             	add    $0x20,%esp
+  8014ad:	85 c0                	test   %eax,%eax
+  8014af:	78 33                	js     8014e4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8014b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8014b4:	89 d8                	mov    %ebx,%eax
+  8014b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8014be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+  8014c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014cd:	50                   	push   %eax
+  8014ce:	ff 75 d4             	push   -0x2c(%ebp)
+  8014d1:	6a 00                	push   $0x0
+  8014d3:	53                   	push   %ebx
+  8014d4:	6a 00                	push   $0x0
+  8014d6:	e8 0b f9 ff ff       	call   800de6 <sys_page_map>
+  8014db:	89 c3                	mov    %eax,%ebx
+  8014dd:	83 c4 20             	add    $0x20,%esp
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	79 a4                	jns    801488 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014e4:	83 ec 08             	sub    $0x8,%esp
+  8014e7:	56                   	push   %esi
+  8014e8:	6a 00                	push   $0x0
+  8014ea:	e8 39 f9 ff ff       	call   800e28 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014ef:	83 c4 08             	add    $0x8,%esp
+  8014f2:	ff 75 d4             	push   -0x2c(%ebp)
+  8014f5:	6a 00                	push   $0x0
+  8014f7:	e8 2c f9 ff ff       	call   800e28 <sys_page_unmap>
+	return r;
+  8014fc:	83 c4 10             	add    $0x10,%esp
+  8014ff:	eb b3                	jmp    8014b4 <dup+0x9d>
+
+00801501 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801501:	55                   	push   %ebp
+  801502:	89 e5                	mov    %esp,%ebp
+  801504:	56                   	push   %esi
+  801505:	53                   	push   %ebx
+  801506:	83 ec 18             	sub    $0x18,%esp
+  801509:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80150c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80150f:	50                   	push   %eax
+  801510:	53                   	push   %ebx
+  801511:	e8 67 fd ff ff       	call   80127d <fd_lookup>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 3c                	js     801559 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80151d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801526:	50                   	push   %eax
+  801527:	ff 36                	push   (%esi)
+  801529:	e8 a1 fd ff ff       	call   8012cf <dev_lookup>
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	85 c0                	test   %eax,%eax
+  801533:	78 24                	js     801559 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801535:	8b 46 08             	mov    0x8(%esi),%eax
+  801538:	83 e0 03             	and    $0x3,%eax
+  80153b:	83 f8 01             	cmp    $0x1,%eax
+  80153e:	74 20                	je     801560 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801543:	8b 40 08             	mov    0x8(%eax),%eax
+  801546:	85 c0                	test   %eax,%eax
+  801548:	74 54                	je     80159e <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80154a:	83 ec 04             	sub    $0x4,%esp
+  80154d:	ff 75 10             	push   0x10(%ebp)
+  801550:	ff 75 0c             	push   0xc(%ebp)
+  801553:	56                   	push   %esi
+  801554:	ff d0                	call   *%eax
+  801556:	83 c4 10             	add    $0x10,%esp
+}
+  801559:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155c:	5b                   	pop    %ebx
+  80155d:	5e                   	pop    %esi
+  80155e:	5d                   	pop    %ebp
+  80155f:	c3                   	ret
+  801560:	89 e2                	mov    %esp,%edx
+  801562:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801567:	29 d0                	sub    %edx,%eax
+  801569:	89 c2                	mov    %eax,%edx
+  80156b:	c1 ea 0f             	shr    $0xf,%edx
+  80156e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801573:	b8 00 00 00 00       	mov    $0x0,%eax
+  801578:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80157b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801582:	8b 40 48             	mov    0x48(%eax),%eax
+  801585:	83 ec 04             	sub    $0x4,%esp
+  801588:	53                   	push   %ebx
+  801589:	50                   	push   %eax
+  80158a:	68 59 3f 80 00       	push   $0x803f59
+  80158f:	e8 e4 ec ff ff       	call   800278 <cprintf>
+		return -E_INVAL;
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159c:	eb bb                	jmp    801559 <read+0x58>
+		return -E_NOT_SUPP;
+  80159e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a3:	eb b4                	jmp    801559 <read+0x58>
+
+008015a5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+  8015ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8015b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8015b4:	85 f6                	test   %esi,%esi
+  8015b6:	74 30                	je     8015e8 <readn+0x43>
+  8015b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015c2:	83 ec 04             	sub    $0x4,%esp
+  8015c5:	89 f2                	mov    %esi,%edx
+  8015c7:	29 c2                	sub    %eax,%edx
+  8015c9:	52                   	push   %edx
+  8015ca:	01 f8                	add    %edi,%eax
+  8015cc:	50                   	push   %eax
+  8015cd:	ff 75 08             	push   0x8(%ebp)
+  8015d0:	e8 2c ff ff ff       	call   801501 <read>
+		if (m < 0)
+  8015d5:	83 c4 10             	add    $0x10,%esp
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	78 15                	js     8015f1 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8015dc:	74 11                	je     8015ef <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8015de:	01 c3                	add    %eax,%ebx
+  8015e0:	89 d8                	mov    %ebx,%eax
+  8015e2:	39 f3                	cmp    %esi,%ebx
+  8015e4:	72 dc                	jb     8015c2 <readn+0x1d>
+  8015e6:	eb 09                	jmp    8015f1 <readn+0x4c>
+  8015e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ed:	eb 02                	jmp    8015f1 <readn+0x4c>
+  8015ef:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8015f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015f4:	5b                   	pop    %ebx
+  8015f5:	5e                   	pop    %esi
+  8015f6:	5f                   	pop    %edi
+  8015f7:	5d                   	pop    %ebp
+  8015f8:	c3                   	ret
+
+008015f9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015f9:	55                   	push   %ebp
+  8015fa:	89 e5                	mov    %esp,%ebp
+  8015fc:	56                   	push   %esi
+  8015fd:	53                   	push   %ebx
+  8015fe:	83 ec 18             	sub    $0x18,%esp
+  801601:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801604:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801607:	50                   	push   %eax
+  801608:	53                   	push   %ebx
+  801609:	e8 6f fc ff ff       	call   80127d <fd_lookup>
+  80160e:	83 c4 10             	add    $0x10,%esp
+  801611:	85 c0                	test   %eax,%eax
+  801613:	78 37                	js     80164c <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801615:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801618:	83 ec 08             	sub    $0x8,%esp
+  80161b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161e:	50                   	push   %eax
+  80161f:	ff 36                	push   (%esi)
+  801621:	e8 a9 fc ff ff       	call   8012cf <dev_lookup>
+  801626:	83 c4 10             	add    $0x10,%esp
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	78 1f                	js     80164c <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80162d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801631:	74 20                	je     801653 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801633:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801636:	8b 40 0c             	mov    0xc(%eax),%eax
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	74 54                	je     801691 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80163d:	83 ec 04             	sub    $0x4,%esp
+  801640:	ff 75 10             	push   0x10(%ebp)
+  801643:	ff 75 0c             	push   0xc(%ebp)
+  801646:	56                   	push   %esi
+  801647:	ff d0                	call   *%eax
+  801649:	83 c4 10             	add    $0x10,%esp
+}
+  80164c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+  801653:	89 e2                	mov    %esp,%edx
+  801655:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80165a:	29 d0                	sub    %edx,%eax
+  80165c:	89 c2                	mov    %eax,%edx
+  80165e:	c1 ea 0f             	shr    $0xf,%edx
+  801661:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166b:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80166e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801675:	8b 40 48             	mov    0x48(%eax),%eax
+  801678:	83 ec 04             	sub    $0x4,%esp
+  80167b:	53                   	push   %ebx
+  80167c:	50                   	push   %eax
+  80167d:	68 75 3f 80 00       	push   $0x803f75
+  801682:	e8 f1 eb ff ff       	call   800278 <cprintf>
+		return -E_INVAL;
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168f:	eb bb                	jmp    80164c <write+0x53>
+		return -E_NOT_SUPP;
+  801691:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801696:	eb b4                	jmp    80164c <write+0x53>
+
+00801698 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801698:	55                   	push   %ebp
+  801699:	89 e5                	mov    %esp,%ebp
+  80169b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80169e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a1:	50                   	push   %eax
+  8016a2:	ff 75 08             	push   0x8(%ebp)
+  8016a5:	e8 d3 fb ff ff       	call   80127d <fd_lookup>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	85 c0                	test   %eax,%eax
+  8016af:	78 0e                	js     8016bf <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8016b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8016ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016bf:	c9                   	leave
+  8016c0:	c3                   	ret
+
+008016c1 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8016c1:	55                   	push   %ebp
+  8016c2:	89 e5                	mov    %esp,%ebp
+  8016c4:	53                   	push   %ebx
+  8016c5:	83 ec 1c             	sub    $0x1c,%esp
+  8016c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ce:	50                   	push   %eax
+  8016cf:	ff 75 08             	push   0x8(%ebp)
+  8016d2:	e8 a6 fb ff ff       	call   80127d <fd_lookup>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 33                	js     801711 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8016de:	83 fb 03             	cmp    $0x3,%ebx
+  8016e1:	74 28                	je     80170b <fcntl+0x4a>
+  8016e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e8:	83 fb 04             	cmp    $0x4,%ebx
+  8016eb:	75 24                	jne    801711 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8016ed:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8016f0:	8b 41 08             	mov    0x8(%ecx),%eax
+  8016f3:	80 e4 ef             	and    $0xef,%ah
+  8016f6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8016f9:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8016ff:	09 d0                	or     %edx,%eax
+  801701:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  801704:	b8 00 00 00 00       	mov    $0x0,%eax
+  801709:	eb 06                	jmp    801711 <fcntl+0x50>
+		return fd->fd_omode;
+  80170b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170e:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801711:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801714:	c9                   	leave
+  801715:	c3                   	ret
+
+00801716 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+  80171b:	83 ec 18             	sub    $0x18,%esp
+  80171e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801721:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801724:	50                   	push   %eax
+  801725:	53                   	push   %ebx
+  801726:	e8 52 fb ff ff       	call   80127d <fd_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 34                	js     801766 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801732:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173b:	50                   	push   %eax
+  80173c:	ff 36                	push   (%esi)
+  80173e:	e8 8c fb ff ff       	call   8012cf <dev_lookup>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	85 c0                	test   %eax,%eax
+  801748:	78 1c                	js     801766 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80174a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80174e:	74 1d                	je     80176d <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801753:	8b 40 18             	mov    0x18(%eax),%eax
+  801756:	85 c0                	test   %eax,%eax
+  801758:	74 51                	je     8017ab <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80175a:	83 ec 08             	sub    $0x8,%esp
+  80175d:	ff 75 0c             	push   0xc(%ebp)
+  801760:	56                   	push   %esi
+  801761:	ff d0                	call   *%eax
+  801763:	83 c4 10             	add    $0x10,%esp
+}
+  801766:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801769:	5b                   	pop    %ebx
+  80176a:	5e                   	pop    %esi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+  80176d:	89 e2                	mov    %esp,%edx
+  80176f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801774:	29 d0                	sub    %edx,%eax
+  801776:	89 c2                	mov    %eax,%edx
+  801778:	c1 ea 0f             	shr    $0xf,%edx
+  80177b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801780:	b8 00 00 00 00       	mov    $0x0,%eax
+  801785:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801788:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80178f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801792:	83 ec 04             	sub    $0x4,%esp
+  801795:	53                   	push   %ebx
+  801796:	50                   	push   %eax
+  801797:	68 38 3f 80 00       	push   $0x803f38
+  80179c:	e8 d7 ea ff ff       	call   800278 <cprintf>
+		return -E_INVAL;
+  8017a1:	83 c4 10             	add    $0x10,%esp
+  8017a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a9:	eb bb                	jmp    801766 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8017ab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b0:	eb b4                	jmp    801766 <ftruncate+0x50>
+
+008017b2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	56                   	push   %esi
+  8017b6:	53                   	push   %ebx
+  8017b7:	83 ec 18             	sub    $0x18,%esp
+  8017ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017bd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c0:	50                   	push   %eax
+  8017c1:	ff 75 08             	push   0x8(%ebp)
+  8017c4:	e8 b4 fa ff ff       	call   80127d <fd_lookup>
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	78 53                	js     801823 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017d0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d3:	83 ec 08             	sub    $0x8,%esp
+  8017d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d9:	50                   	push   %eax
+  8017da:	ff 36                	push   (%esi)
+  8017dc:	e8 ee fa ff ff       	call   8012cf <dev_lookup>
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	78 3b                	js     801823 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8017e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017eb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ef:	74 39                	je     80182a <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017f1:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017f4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017fb:	00 00 00 
+	stat->st_isdir = 0;
+  8017fe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801805:	00 00 00 
+	stat->st_version = 0;
+  801808:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  80180f:	00 00 00 
+	stat->st_dev = dev;
+  801812:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801818:	83 ec 08             	sub    $0x8,%esp
+  80181b:	53                   	push   %ebx
+  80181c:	56                   	push   %esi
+  80181d:	ff 50 14             	call   *0x14(%eax)
+  801820:	83 c4 10             	add    $0x10,%esp
+}
+  801823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801826:	5b                   	pop    %ebx
+  801827:	5e                   	pop    %esi
+  801828:	5d                   	pop    %ebp
+  801829:	c3                   	ret
+		return -E_NOT_SUPP;
+  80182a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80182f:	eb f2                	jmp    801823 <fstat+0x71>
+
+00801831 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	56                   	push   %esi
+  801835:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801836:	83 ec 08             	sub    $0x8,%esp
+  801839:	6a 00                	push   $0x0
+  80183b:	ff 75 08             	push   0x8(%ebp)
+  80183e:	e8 b7 01 00 00       	call   8019fa <open>
+  801843:	89 c3                	mov    %eax,%ebx
+  801845:	83 c4 10             	add    $0x10,%esp
+  801848:	85 c0                	test   %eax,%eax
+  80184a:	78 1b                	js     801867 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80184c:	83 ec 08             	sub    $0x8,%esp
+  80184f:	ff 75 0c             	push   0xc(%ebp)
+  801852:	50                   	push   %eax
+  801853:	e8 5a ff ff ff       	call   8017b2 <fstat>
+  801858:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80185a:	89 1c 24             	mov    %ebx,(%esp)
+  80185d:	e8 60 fb ff ff       	call   8013c2 <close>
+	return r;
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	89 f3                	mov    %esi,%ebx
+}
+  801867:	89 d8                	mov    %ebx,%eax
+  801869:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80186c:	5b                   	pop    %ebx
+  80186d:	5e                   	pop    %esi
+  80186e:	5d                   	pop    %ebp
+  80186f:	c3                   	ret
+
+00801870 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	56                   	push   %esi
+  801874:	53                   	push   %ebx
+  801875:	89 c6                	mov    %eax,%esi
+  801877:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801879:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801880:	74 27                	je     8018a9 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801882:	6a 07                	push   $0x7
+  801884:	68 00 70 80 00       	push   $0x807000
+  801889:	56                   	push   %esi
+  80188a:	ff 35 00 60 80 00    	push   0x806000
+  801890:	e8 d9 1f 00 00       	call   80386e <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801895:	83 c4 0c             	add    $0xc,%esp
+  801898:	6a 00                	push   $0x0
+  80189a:	53                   	push   %ebx
+  80189b:	6a 00                	push   $0x0
+  80189d:	e8 3c 1d 00 00       	call   8035de <ipc_recv>
+}
+  8018a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a5:	5b                   	pop    %ebx
+  8018a6:	5e                   	pop    %esi
+  8018a7:	5d                   	pop    %ebp
+  8018a8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8018a9:	83 ec 0c             	sub    $0xc,%esp
+  8018ac:	6a 02                	push   $0x2
+  8018ae:	e8 24 20 00 00       	call   8038d7 <ipc_find_env>
+  8018b3:	a3 00 60 80 00       	mov    %eax,0x806000
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	eb c5                	jmp    801882 <fsipc+0x12>
+
+008018bd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018bd:	55                   	push   %ebp
+  8018be:	89 e5                	mov    %esp,%ebp
+  8018c0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018c9:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8018ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018d1:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8018d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018db:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018e0:	e8 8b ff ff ff       	call   801870 <fsipc>
+}
+  8018e5:	c9                   	leave
+  8018e6:	c3                   	ret
+
+008018e7 <devfile_flush>:
+{
+  8018e7:	55                   	push   %ebp
+  8018e8:	89 e5                	mov    %esp,%ebp
+  8018ea:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f3:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fd:	b8 06 00 00 00       	mov    $0x6,%eax
+  801902:	e8 69 ff ff ff       	call   801870 <fsipc>
+}
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+
+00801909 <devfile_stat>:
+{
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 04             	sub    $0x4,%esp
+  801910:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801913:	8b 45 08             	mov    0x8(%ebp),%eax
+  801916:	8b 40 0c             	mov    0xc(%eax),%eax
+  801919:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80191e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801923:	b8 05 00 00 00       	mov    $0x5,%eax
+  801928:	e8 43 ff ff ff       	call   801870 <fsipc>
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	78 37                	js     801968 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801931:	83 ec 08             	sub    $0x8,%esp
+  801934:	68 00 70 80 00       	push   $0x807000
+  801939:	53                   	push   %ebx
+  80193a:	e8 30 f0 ff ff       	call   80096f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80193f:	a1 80 70 80 00       	mov    0x807080,%eax
+  801944:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80194a:	a1 84 70 80 00       	mov    0x807084,%eax
+  80194f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801955:	a1 88 70 80 00       	mov    0x807088,%eax
+  80195a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801968:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80196b:	c9                   	leave
+  80196c:	c3                   	ret
+
+0080196d <devfile_write>:
+{
+  80196d:	55                   	push   %ebp
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	83 ec 0c             	sub    $0xc,%esp
+  801973:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801976:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80197b:	39 d0                	cmp    %edx,%eax
+  80197d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801980:	8b 55 08             	mov    0x8(%ebp),%edx
+  801983:	8b 52 0c             	mov    0xc(%edx),%edx
+  801986:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80198c:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801991:	50                   	push   %eax
+  801992:	ff 75 0c             	push   0xc(%ebp)
+  801995:	68 08 70 80 00       	push   $0x807008
+  80199a:	e8 80 f1 ff ff       	call   800b1f <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80199f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8019a9:	e8 c2 fe ff ff       	call   801870 <fsipc>
+}
+  8019ae:	c9                   	leave
+  8019af:	c3                   	ret
+
+008019b0 <devfile_read>:
+{
+  8019b0:	55                   	push   %ebp
+  8019b1:	89 e5                	mov    %esp,%ebp
+  8019b3:	53                   	push   %ebx
+  8019b4:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019ba:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019bd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8019c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019c5:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  8019ca:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8019cf:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019d4:	e8 97 fe ff ff       	call   801870 <fsipc>
+  8019d9:	89 c3                	mov    %eax,%ebx
+  8019db:	85 c0                	test   %eax,%eax
+  8019dd:	78 14                	js     8019f3 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  8019df:	83 ec 04             	sub    $0x4,%esp
+  8019e2:	50                   	push   %eax
+  8019e3:	68 00 70 80 00       	push   $0x807000
+  8019e8:	ff 75 0c             	push   0xc(%ebp)
+  8019eb:	e8 2f f1 ff ff       	call   800b1f <memmove>
+	return r;
+  8019f0:	83 c4 10             	add    $0x10,%esp
+}
+  8019f3:	89 d8                	mov    %ebx,%eax
+  8019f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+008019fa <open>:
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801a01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a04:	50                   	push   %eax
+  801a05:	e8 23 f8 ff ff       	call   80122d <fd_alloc>
+  801a0a:	89 c3                	mov    %eax,%ebx
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 2a                	js     801a3d <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801a13:	83 ec 0c             	sub    $0xc,%esp
+  801a16:	ff 75 08             	push   0x8(%ebp)
+  801a19:	e8 05 ef ff ff       	call   800923 <strlen>
+  801a1e:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801a21:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801a26:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a2b:	7e 17                	jle    801a44 <open+0x4a>
+	fd_close(fd, 1);
+  801a2d:	83 ec 08             	sub    $0x8,%esp
+  801a30:	6a 01                	push   $0x1
+  801a32:	ff 75 f4             	push   -0xc(%ebp)
+  801a35:	e8 08 f9 ff ff       	call   801342 <fd_close>
+	return r;
+  801a3a:	83 c4 10             	add    $0x10,%esp
+}
+  801a3d:	89 d8                	mov    %ebx,%eax
+  801a3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a42:	c9                   	leave
+  801a43:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a44:	83 ec 08             	sub    $0x8,%esp
+  801a47:	ff 75 08             	push   0x8(%ebp)
+  801a4a:	68 00 70 80 00       	push   $0x807000
+  801a4f:	e8 1b ef ff ff       	call   80096f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a57:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a5c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a5f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a64:	e8 07 fe ff ff       	call   801870 <fsipc>
+  801a69:	89 c3                	mov    %eax,%ebx
+  801a6b:	83 c4 10             	add    $0x10,%esp
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 bb                	js     801a2d <open+0x33>
+	return fd2num(fd); 	
+  801a72:	83 ec 0c             	sub    $0xc,%esp
+  801a75:	ff 75 f4             	push   -0xc(%ebp)
+  801a78:	e8 89 f7 ff ff       	call   801206 <fd2num>
+  801a7d:	89 c3                	mov    %eax,%ebx
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	eb b9                	jmp    801a3d <open+0x43>
+
+00801a84 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	53                   	push   %ebx
+  801a88:	83 ec 1c             	sub    $0x1c,%esp
+  801a8b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a91:	50                   	push   %eax
+  801a92:	ff 75 08             	push   0x8(%ebp)
+  801a95:	e8 e3 f7 ff ff       	call   80127d <fd_lookup>
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 5a                	js     801afb <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801aa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801aaa:	39 10                	cmp    %edx,(%eax)
+  801aac:	75 66                	jne    801b14 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801aae:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ab5:	74 49                	je     801b00 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aba:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abd:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801ac2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac5:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801aca:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ad0:	6a 07                	push   $0x7
+  801ad2:	68 00 70 80 00       	push   $0x807000
+  801ad7:	6a 09                	push   $0x9
+  801ad9:	ff 35 00 60 80 00    	push   0x806000
+  801adf:	e8 8a 1d 00 00       	call   80386e <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801ae4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801aeb:	6a 00                	push   $0x0
+  801aed:	53                   	push   %ebx
+  801aee:	ff 75 10             	push   0x10(%ebp)
+  801af1:	6a 00                	push   $0x0
+  801af3:	e8 b3 1b 00 00       	call   8036ab <ipc_recv_pages>
+  801af8:	83 c4 20             	add    $0x20,%esp
+}
+  801afb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afe:	c9                   	leave
+  801aff:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	6a 02                	push   $0x2
+  801b05:	e8 cd 1d 00 00       	call   8038d7 <ipc_find_env>
+  801b0a:	a3 00 60 80 00       	mov    %eax,0x806000
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	eb a3                	jmp    801ab7 <fmap+0x33>
+		return -E_INVAL;
+  801b14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b19:	eb e0                	jmp    801afb <fmap+0x77>
+
+00801b1b <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801b1b:	55                   	push   %ebp
+  801b1c:	89 e5                	mov    %esp,%ebp
+  801b1e:	53                   	push   %ebx
+  801b1f:	83 ec 10             	sub    $0x10,%esp
+  801b22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801b25:	53                   	push   %ebx
+  801b26:	e8 f8 ed ff ff       	call   800923 <strlen>
+  801b2b:	83 c4 10             	add    $0x10,%esp
+  801b2e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b33:	7f 25                	jg     801b5a <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801b35:	83 ec 08             	sub    $0x8,%esp
+  801b38:	53                   	push   %ebx
+  801b39:	68 00 70 80 00       	push   $0x807000
+  801b3e:	e8 2c ee ff ff       	call   80096f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b48:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b4d:	e8 1e fd ff ff       	call   801870 <fsipc>
+  801b52:	83 c4 10             	add    $0x10,%esp
+}
+  801b55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b58:	c9                   	leave
+  801b59:	c3                   	ret
+		return -E_BAD_PATH;
+  801b5a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b5f:	eb f4                	jmp    801b55 <remove+0x3a>
+
+00801b61 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b61:	55                   	push   %ebp
+  801b62:	89 e5                	mov    %esp,%ebp
+  801b64:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b71:	e8 fa fc ff ff       	call   801870 <fsipc>
+}
+  801b76:	c9                   	leave
+  801b77:	c3                   	ret
+
+00801b78 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b78:	55                   	push   %ebp
+  801b79:	89 e5                	mov    %esp,%ebp
+  801b7b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b7e:	68 a8 3f 80 00       	push   $0x803fa8
+  801b83:	ff 75 0c             	push   0xc(%ebp)
+  801b86:	e8 e4 ed ff ff       	call   80096f <strcpy>
+	return 0;
+}
+  801b8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b90:	c9                   	leave
+  801b91:	c3                   	ret
+
+00801b92 <devsock_close>:
+{
+  801b92:	55                   	push   %ebp
+  801b93:	89 e5                	mov    %esp,%ebp
+  801b95:	53                   	push   %ebx
+  801b96:	83 ec 10             	sub    $0x10,%esp
+  801b99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b9c:	53                   	push   %ebx
+  801b9d:	e8 74 1d 00 00       	call   803916 <pageref>
+  801ba2:	89 c2                	mov    %eax,%edx
+  801ba4:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801bac:	83 fa 01             	cmp    $0x1,%edx
+  801baf:	74 05                	je     801bb6 <devsock_close+0x24>
+}
+  801bb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bb4:	c9                   	leave
+  801bb5:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801bb6:	83 ec 0c             	sub    $0xc,%esp
+  801bb9:	ff 73 0c             	push   0xc(%ebx)
+  801bbc:	e8 b0 05 00 00       	call   802171 <nsipc_close>
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	eb eb                	jmp    801bb1 <devsock_close+0x1f>
+
+00801bc6 <devsock_write>:
+{
+  801bc6:	55                   	push   %ebp
+  801bc7:	89 e5                	mov    %esp,%ebp
+  801bc9:	53                   	push   %ebx
+  801bca:	83 ec 14             	sub    $0x14,%esp
+  801bcd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801bd3:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801bd6:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801bd9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801bdc:	8b 41 08             	mov    0x8(%ecx),%eax
+  801bdf:	c1 f8 09             	sar    $0x9,%eax
+  801be2:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801be5:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801beb:	77 13                	ja     801c00 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801bed:	50                   	push   %eax
+  801bee:	52                   	push   %edx
+  801bef:	53                   	push   %ebx
+  801bf0:	ff 71 0c             	push   0xc(%ecx)
+  801bf3:	e8 5c 06 00 00       	call   802254 <nsipc_send>
+  801bf8:	83 c4 10             	add    $0x10,%esp
+}
+  801bfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bfe:	c9                   	leave
+  801bff:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c00:	50                   	push   %eax
+  801c01:	6a 01                	push   $0x1
+  801c03:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c06:	50                   	push   %eax
+  801c07:	ff 71 0c             	push   0xc(%ecx)
+  801c0a:	e8 a6 06 00 00       	call   8022b5 <nsipc_sendmsg>
+  801c0f:	83 c4 10             	add    $0x10,%esp
+  801c12:	eb e7                	jmp    801bfb <devsock_write+0x35>
+
+00801c14 <devsock_read>:
+{
+  801c14:	55                   	push   %ebp
+  801c15:	89 e5                	mov    %esp,%ebp
+  801c17:	53                   	push   %ebx
+  801c18:	83 ec 14             	sub    $0x14,%esp
+  801c1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c1e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801c21:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801c24:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801c27:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801c2a:	8b 41 08             	mov    0x8(%ecx),%eax
+  801c2d:	c1 f8 09             	sar    $0x9,%eax
+  801c30:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801c33:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801c39:	77 13                	ja     801c4e <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801c3b:	50                   	push   %eax
+  801c3c:	52                   	push   %edx
+  801c3d:	53                   	push   %ebx
+  801c3e:	ff 71 0c             	push   0xc(%ecx)
+  801c41:	e8 9c 05 00 00       	call   8021e2 <nsipc_recv>
+  801c46:	83 c4 10             	add    $0x10,%esp
+}
+  801c49:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c4e:	50                   	push   %eax
+  801c4f:	6a 01                	push   $0x1
+  801c51:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	ff 71 0c             	push   0xc(%ecx)
+  801c58:	e8 02 0a 00 00       	call   80265f <nsipc_recvmsg>
+  801c5d:	83 c4 10             	add    $0x10,%esp
+  801c60:	eb e7                	jmp    801c49 <devsock_read+0x35>
+
+00801c62 <fd2sockid>:
+{
+  801c62:	55                   	push   %ebp
+  801c63:	89 e5                	mov    %esp,%ebp
+  801c65:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c68:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c6b:	52                   	push   %edx
+  801c6c:	50                   	push   %eax
+  801c6d:	e8 0b f6 ff ff       	call   80127d <fd_lookup>
+  801c72:	83 c4 10             	add    $0x10,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 10                	js     801c89 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c7c:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801c82:	39 08                	cmp    %ecx,(%eax)
+  801c84:	75 05                	jne    801c8b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c86:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c89:	c9                   	leave
+  801c8a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c8b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c90:	eb f7                	jmp    801c89 <fd2sockid+0x27>
+
+00801c92 <sock_flags>:
+{
+  801c92:	55                   	push   %ebp
+  801c93:	89 e5                	mov    %esp,%ebp
+  801c95:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801c98:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c9b:	52                   	push   %edx
+  801c9c:	50                   	push   %eax
+  801c9d:	e8 db f5 ff ff       	call   80127d <fd_lookup>
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 0e                	js     801cb7 <sock_flags+0x25>
+  801ca9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cac:	8b 40 08             	mov    0x8(%eax),%eax
+  801caf:	c1 e8 09             	shr    $0x9,%eax
+  801cb2:	83 e0 08             	and    $0x8,%eax
+}
+  801cb5:	c9                   	leave
+  801cb6:	c3                   	ret
+		return 0;
+  801cb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cbc:	eb f7                	jmp    801cb5 <sock_flags+0x23>
+
+00801cbe <alloc_sockfd>:
+{
+  801cbe:	55                   	push   %ebp
+  801cbf:	89 e5                	mov    %esp,%ebp
+  801cc1:	56                   	push   %esi
+  801cc2:	53                   	push   %ebx
+  801cc3:	83 ec 1c             	sub    $0x1c,%esp
+  801cc6:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801cc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccb:	50                   	push   %eax
+  801ccc:	e8 5c f5 ff ff       	call   80122d <fd_alloc>
+  801cd1:	89 c3                	mov    %eax,%ebx
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 43                	js     801d1d <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801cda:	83 ec 04             	sub    $0x4,%esp
+  801cdd:	68 07 04 00 00       	push   $0x407
+  801ce2:	ff 75 f4             	push   -0xc(%ebp)
+  801ce5:	6a 00                	push   $0x0
+  801ce7:	e8 b7 f0 ff ff       	call   800da3 <sys_page_alloc>
+  801cec:	89 c3                	mov    %eax,%ebx
+  801cee:	83 c4 10             	add    $0x10,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 28                	js     801d1d <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cf5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cf8:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801cfe:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801d00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d03:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801d0a:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801d0d:	83 ec 0c             	sub    $0xc,%esp
+  801d10:	50                   	push   %eax
+  801d11:	e8 f0 f4 ff ff       	call   801206 <fd2num>
+  801d16:	89 c3                	mov    %eax,%ebx
+  801d18:	83 c4 10             	add    $0x10,%esp
+  801d1b:	eb 0c                	jmp    801d29 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801d1d:	83 ec 0c             	sub    $0xc,%esp
+  801d20:	56                   	push   %esi
+  801d21:	e8 4b 04 00 00       	call   802171 <nsipc_close>
+		return r;
+  801d26:	83 c4 10             	add    $0x10,%esp
+}
+  801d29:	89 d8                	mov    %ebx,%eax
+  801d2b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5d                   	pop    %ebp
+  801d31:	c3                   	ret
+
+00801d32 <accept>:
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	56                   	push   %esi
+  801d36:	53                   	push   %ebx
+  801d37:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801d3a:	89 f0                	mov    %esi,%eax
+  801d3c:	e8 21 ff ff ff       	call   801c62 <fd2sockid>
+  801d41:	89 c3                	mov    %eax,%ebx
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 24                	js     801d6b <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d47:	89 f0                	mov    %esi,%eax
+  801d49:	e8 44 ff ff ff       	call   801c92 <sock_flags>
+  801d4e:	50                   	push   %eax
+  801d4f:	ff 75 10             	push   0x10(%ebp)
+  801d52:	ff 75 0c             	push   0xc(%ebp)
+  801d55:	53                   	push   %ebx
+  801d56:	e8 6b 03 00 00       	call   8020c6 <nsipc_accept>
+  801d5b:	89 c3                	mov    %eax,%ebx
+  801d5d:	83 c4 10             	add    $0x10,%esp
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	78 07                	js     801d6b <accept+0x39>
+	return alloc_sockfd(r);
+  801d64:	e8 55 ff ff ff       	call   801cbe <alloc_sockfd>
+  801d69:	89 c3                	mov    %eax,%ebx
+}
+  801d6b:	89 d8                	mov    %ebx,%eax
+  801d6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d70:	5b                   	pop    %ebx
+  801d71:	5e                   	pop    %esi
+  801d72:	5d                   	pop    %ebp
+  801d73:	c3                   	ret
+
+00801d74 <bind>:
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7d:	e8 e0 fe ff ff       	call   801c62 <fd2sockid>
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 12                	js     801d98 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d86:	83 ec 04             	sub    $0x4,%esp
+  801d89:	ff 75 10             	push   0x10(%ebp)
+  801d8c:	ff 75 0c             	push   0xc(%ebp)
+  801d8f:	50                   	push   %eax
+  801d90:	e8 85 03 00 00       	call   80211a <nsipc_bind>
+  801d95:	83 c4 10             	add    $0x10,%esp
+}
+  801d98:	c9                   	leave
+  801d99:	c3                   	ret
+
+00801d9a <shutdown>:
+{
+  801d9a:	55                   	push   %ebp
+  801d9b:	89 e5                	mov    %esp,%ebp
+  801d9d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da3:	e8 ba fe ff ff       	call   801c62 <fd2sockid>
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 0f                	js     801dbb <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801dac:	83 ec 08             	sub    $0x8,%esp
+  801daf:	ff 75 0c             	push   0xc(%ebp)
+  801db2:	50                   	push   %eax
+  801db3:	e8 97 03 00 00       	call   80214f <nsipc_shutdown>
+  801db8:	83 c4 10             	add    $0x10,%esp
+}
+  801dbb:	c9                   	leave
+  801dbc:	c3                   	ret
+
+00801dbd <connect>:
+{
+  801dbd:	55                   	push   %ebp
+  801dbe:	89 e5                	mov    %esp,%ebp
+  801dc0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801dc3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc6:	e8 97 fe ff ff       	call   801c62 <fd2sockid>
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 12                	js     801de1 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801dcf:	83 ec 04             	sub    $0x4,%esp
+  801dd2:	ff 75 10             	push   0x10(%ebp)
+  801dd5:	ff 75 0c             	push   0xc(%ebp)
+  801dd8:	50                   	push   %eax
+  801dd9:	e8 ad 03 00 00       	call   80218b <nsipc_connect>
+  801dde:	83 c4 10             	add    $0x10,%esp
+}
+  801de1:	c9                   	leave
+  801de2:	c3                   	ret
+
+00801de3 <listen>:
+{
+  801de3:	55                   	push   %ebp
+  801de4:	89 e5                	mov    %esp,%ebp
+  801de6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dec:	e8 71 fe ff ff       	call   801c62 <fd2sockid>
+  801df1:	85 c0                	test   %eax,%eax
+  801df3:	78 0f                	js     801e04 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801df5:	83 ec 08             	sub    $0x8,%esp
+  801df8:	ff 75 0c             	push   0xc(%ebp)
+  801dfb:	50                   	push   %eax
+  801dfc:	e8 bf 03 00 00       	call   8021c0 <nsipc_listen>
+  801e01:	83 c4 10             	add    $0x10,%esp
+}
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+00801e06 <sendmsg>:
+{
+  801e06:	55                   	push   %ebp
+  801e07:	89 e5                	mov    %esp,%ebp
+  801e09:	57                   	push   %edi
+  801e0a:	56                   	push   %esi
+  801e0b:	53                   	push   %ebx
+  801e0c:	83 ec 0c             	sub    $0xc,%esp
+  801e0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801e15:	89 f0                	mov    %esi,%eax
+  801e17:	e8 46 fe ff ff       	call   801c62 <fd2sockid>
+  801e1c:	89 c3                	mov    %eax,%ebx
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 1c                	js     801e3e <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801e22:	89 f0                	mov    %esi,%eax
+  801e24:	e8 69 fe ff ff       	call   801c92 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e29:	0b 45 10             	or     0x10(%ebp),%eax
+  801e2c:	50                   	push   %eax
+  801e2d:	ff 77 0c             	push   0xc(%edi)
+  801e30:	ff 77 08             	push   0x8(%edi)
+  801e33:	53                   	push   %ebx
+  801e34:	e8 7c 04 00 00       	call   8022b5 <nsipc_sendmsg>
+  801e39:	89 c3                	mov    %eax,%ebx
+  801e3b:	83 c4 10             	add    $0x10,%esp
+}
+  801e3e:	89 d8                	mov    %ebx,%eax
+  801e40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e43:	5b                   	pop    %ebx
+  801e44:	5e                   	pop    %esi
+  801e45:	5f                   	pop    %edi
+  801e46:	5d                   	pop    %ebp
+  801e47:	c3                   	ret
+
+00801e48 <recvmsg>:
+{
+  801e48:	55                   	push   %ebp
+  801e49:	89 e5                	mov    %esp,%ebp
+  801e4b:	57                   	push   %edi
+  801e4c:	56                   	push   %esi
+  801e4d:	53                   	push   %ebx
+  801e4e:	83 ec 0c             	sub    $0xc,%esp
+  801e51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e54:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e57:	89 f8                	mov    %edi,%eax
+  801e59:	e8 04 fe ff ff       	call   801c62 <fd2sockid>
+  801e5e:	89 c3                	mov    %eax,%ebx
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 2a                	js     801e8e <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e64:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e6b:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e72:	89 f8                	mov    %edi,%eax
+  801e74:	e8 19 fe ff ff       	call   801c92 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e79:	0b 45 10             	or     0x10(%ebp),%eax
+  801e7c:	50                   	push   %eax
+  801e7d:	ff 76 0c             	push   0xc(%esi)
+  801e80:	ff 76 08             	push   0x8(%esi)
+  801e83:	53                   	push   %ebx
+  801e84:	e8 d6 07 00 00       	call   80265f <nsipc_recvmsg>
+  801e89:	89 c3                	mov    %eax,%ebx
+  801e8b:	83 c4 10             	add    $0x10,%esp
+}
+  801e8e:	89 d8                	mov    %ebx,%eax
+  801e90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e93:	5b                   	pop    %ebx
+  801e94:	5e                   	pop    %esi
+  801e95:	5f                   	pop    %edi
+  801e96:	5d                   	pop    %ebp
+  801e97:	c3                   	ret
+
+00801e98 <sendfile>:
+{
+  801e98:	55                   	push   %ebp
+  801e99:	89 e5                	mov    %esp,%ebp
+  801e9b:	56                   	push   %esi
+  801e9c:	53                   	push   %ebx
+  801e9d:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801ea0:	89 f0                	mov    %esi,%eax
+  801ea2:	e8 bb fd ff ff       	call   801c62 <fd2sockid>
+  801ea7:	89 c3                	mov    %eax,%ebx
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	78 1f                	js     801ecc <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801ead:	89 f0                	mov    %esi,%eax
+  801eaf:	e8 de fd ff ff       	call   801c92 <sock_flags>
+  801eb4:	83 ec 0c             	sub    $0xc,%esp
+  801eb7:	50                   	push   %eax
+  801eb8:	ff 75 14             	push   0x14(%ebp)
+  801ebb:	ff 75 10             	push   0x10(%ebp)
+  801ebe:	ff 75 0c             	push   0xc(%ebp)
+  801ec1:	53                   	push   %ebx
+  801ec2:	e8 64 06 00 00       	call   80252b <nsipc_sendfile>
+  801ec7:	89 c3                	mov    %eax,%ebx
+  801ec9:	83 c4 20             	add    $0x20,%esp
+}
+  801ecc:	89 d8                	mov    %ebx,%eax
+  801ece:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed1:	5b                   	pop    %ebx
+  801ed2:	5e                   	pop    %esi
+  801ed3:	5d                   	pop    %ebp
+  801ed4:	c3                   	ret
+
+00801ed5 <evctl>:
+{
+  801ed5:	55                   	push   %ebp
+  801ed6:	89 e5                	mov    %esp,%ebp
+  801ed8:	53                   	push   %ebx
+  801ed9:	83 ec 04             	sub    $0x4,%esp
+  801edc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801edf:	89 d8                	mov    %ebx,%eax
+  801ee1:	e8 7c fd ff ff       	call   801c62 <fd2sockid>
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 10                	js     801efa <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801eea:	83 ec 04             	sub    $0x4,%esp
+  801eed:	53                   	push   %ebx
+  801eee:	ff 75 0c             	push   0xc(%ebp)
+  801ef1:	50                   	push   %eax
+  801ef2:	e8 d2 0b 00 00       	call   802ac9 <nsipc_evctl>
+  801ef7:	83 c4 10             	add    $0x10,%esp
+}
+  801efa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efd:	c9                   	leave
+  801efe:	c3                   	ret
+
+00801eff <evwait>:
+{
+  801eff:	55                   	push   %ebp
+  801f00:	89 e5                	mov    %esp,%ebp
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801f05:	ff 75 10             	push   0x10(%ebp)
+  801f08:	ff 75 0c             	push   0xc(%ebp)
+  801f0b:	ff 75 08             	push   0x8(%ebp)
+  801f0e:	e8 e0 0b 00 00       	call   802af3 <nsipc_evwait>
+}
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801f1b:	ff 75 10             	push   0x10(%ebp)
+  801f1e:	ff 75 0c             	push   0xc(%ebp)
+  801f21:	ff 75 08             	push   0x8(%ebp)
+  801f24:	e8 31 0c 00 00       	call   802b5a <nsipc_socket>
+  801f29:	83 c4 10             	add    $0x10,%esp
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 05                	js     801f35 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801f30:	e8 89 fd ff ff       	call   801cbe <alloc_sockfd>
+}
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+00801f37 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	53                   	push   %ebx
+  801f3b:	83 ec 04             	sub    $0x4,%esp
+  801f3e:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801f40:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f47:	74 26                	je     801f6f <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f49:	6a 07                	push   $0x7
+  801f4b:	68 00 80 80 00       	push   $0x808000
+  801f50:	53                   	push   %ebx
+  801f51:	ff 35 24 63 80 00    	push   0x806324
+  801f57:	e8 12 19 00 00       	call   80386e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f5c:	83 c4 0c             	add    $0xc,%esp
+  801f5f:	6a 00                	push   $0x0
+  801f61:	6a 00                	push   $0x0
+  801f63:	6a 00                	push   $0x0
+  801f65:	e8 74 16 00 00       	call   8035de <ipc_recv>
+}
+  801f6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6d:	c9                   	leave
+  801f6e:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f6f:	83 ec 0c             	sub    $0xc,%esp
+  801f72:	6a 03                	push   $0x3
+  801f74:	e8 5e 19 00 00       	call   8038d7 <ipc_find_env>
+  801f79:	a3 24 63 80 00       	mov    %eax,0x806324
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	eb c6                	jmp    801f49 <nsipc+0x12>
+
+00801f83 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	56                   	push   %esi
+  801f87:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801f88:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801f93:	85 f6                	test   %esi,%esi
+  801f95:	75 33                	jne    801fca <nsbulk_map+0x47>
+  801f97:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801f9c:	83 ec 04             	sub    $0x4,%esp
+  801f9f:	6a 07                	push   $0x7
+  801fa1:	53                   	push   %ebx
+  801fa2:	6a 00                	push   $0x0
+  801fa4:	e8 fa ed ff ff       	call   800da3 <sys_page_alloc>
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 1a                	js     801fca <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801fb0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fb6:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801fbc:	75 de                	jne    801f9c <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801fbe:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801fc5:	00 00 00 
+	return 0;
+  801fc8:	89 f0                	mov    %esi,%eax
+}
+  801fca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fcd:	5b                   	pop    %ebx
+  801fce:	5e                   	pop    %esi
+  801fcf:	5d                   	pop    %ebp
+  801fd0:	c3                   	ret
+
+00801fd1 <nsbulk_own>:
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	57                   	push   %edi
+  801fd5:	56                   	push   %esi
+  801fd6:	53                   	push   %ebx
+  801fd7:	83 ec 0c             	sub    $0xc,%esp
+  801fda:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801fdc:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801fdf:	85 d2                	test   %edx,%edx
+  801fe1:	7f 0e                	jg     801ff1 <nsbulk_own+0x20>
+	return 0;
+  801fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe8:	eb 47                	jmp    802031 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801fea:	83 c3 01             	add    $0x1,%ebx
+  801fed:	39 fb                	cmp    %edi,%ebx
+  801fef:	7d 3b                	jge    80202c <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801ff1:	be 01 00 00 00       	mov    $0x1,%esi
+  801ff6:	89 d9                	mov    %ebx,%ecx
+  801ff8:	d3 e6                	shl    %cl,%esi
+  801ffa:	89 f0                	mov    %esi,%eax
+  801ffc:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  802002:	74 e6                	je     801fea <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802004:	83 ec 04             	sub    $0x4,%esp
+  802007:	6a 07                	push   $0x7
+  802009:	89 d8                	mov    %ebx,%eax
+  80200b:	c1 e0 0c             	shl    $0xc,%eax
+  80200e:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802013:	50                   	push   %eax
+  802014:	6a 00                	push   $0x0
+  802016:	e8 88 ed ff ff       	call   800da3 <sys_page_alloc>
+  80201b:	83 c4 10             	add    $0x10,%esp
+  80201e:	85 c0                	test   %eax,%eax
+  802020:	78 0f                	js     802031 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802022:	f7 d6                	not    %esi
+  802024:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  80202a:	eb be                	jmp    801fea <nsbulk_own+0x19>
+	return 0;
+  80202c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802031:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802034:	5b                   	pop    %ebx
+  802035:	5e                   	pop    %esi
+  802036:	5f                   	pop    %edi
+  802037:	5d                   	pop    %ebp
+  802038:	c3                   	ret
+
+00802039 <nsipc_bulk>:
+{
+  802039:	55                   	push   %ebp
+  80203a:	89 e5                	mov    %esp,%ebp
+  80203c:	57                   	push   %edi
+  80203d:	56                   	push   %esi
+  80203e:	53                   	push   %ebx
+  80203f:	83 ec 1c             	sub    $0x1c,%esp
+  802042:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802045:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802047:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80204d:	c1 fb 0c             	sar    $0xc,%ebx
+  802050:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802053:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  80205a:	74 56                	je     8020b2 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80205c:	85 ff                	test   %edi,%edi
+  80205e:	7e 24                	jle    802084 <nsipc_bulk+0x4b>
+  802060:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802066:	74 1c                	je     802084 <nsipc_bulk+0x4b>
+  802068:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80206e:	c1 e3 0c             	shl    $0xc,%ebx
+  802071:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802076:	0f b6 10             	movzbl (%eax),%edx
+  802079:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80207b:	05 00 10 00 00       	add    $0x1000,%eax
+  802080:	39 d8                	cmp    %ebx,%eax
+  802082:	75 f2                	jne    802076 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802084:	83 ec 0c             	sub    $0xc,%esp
+  802087:	56                   	push   %esi
+  802088:	57                   	push   %edi
+  802089:	68 00 00 00 e0       	push   $0xe0000000
+  80208e:	ff 75 e4             	push   -0x1c(%ebp)
+  802091:	ff 35 24 63 80 00    	push   0x806324
+  802097:	e8 06 18 00 00       	call   8038a2 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80209c:	83 c4 1c             	add    $0x1c,%esp
+  80209f:	6a 00                	push   $0x0
+  8020a1:	6a 00                	push   $0x0
+  8020a3:	6a 00                	push   $0x0
+  8020a5:	e8 34 15 00 00       	call   8035de <ipc_recv>
+}
+  8020aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ad:	5b                   	pop    %ebx
+  8020ae:	5e                   	pop    %esi
+  8020af:	5f                   	pop    %edi
+  8020b0:	5d                   	pop    %ebp
+  8020b1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8020b2:	83 ec 0c             	sub    $0xc,%esp
+  8020b5:	6a 03                	push   $0x3
+  8020b7:	e8 1b 18 00 00       	call   8038d7 <ipc_find_env>
+  8020bc:	a3 24 63 80 00       	mov    %eax,0x806324
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	eb 96                	jmp    80205c <nsipc_bulk+0x23>
+
+008020c6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8020c6:	55                   	push   %ebp
+  8020c7:	89 e5                	mov    %esp,%ebp
+  8020c9:	53                   	push   %ebx
+  8020ca:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8020cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d0:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8020d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8020d8:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8020dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e2:	e8 50 fe ff ff       	call   801f37 <nsipc>
+  8020e7:	89 c3                	mov    %eax,%ebx
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	79 07                	jns    8020f4 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8020ed:	89 d8                	mov    %ebx,%eax
+  8020ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8020f4:	83 ec 04             	sub    $0x4,%esp
+  8020f7:	ff 35 10 80 80 00    	push   0x808010
+  8020fd:	68 00 80 80 00       	push   $0x808000
+  802102:	ff 75 0c             	push   0xc(%ebp)
+  802105:	e8 15 ea ff ff       	call   800b1f <memmove>
+		*addrlen = ret->ret_addrlen;
+  80210a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802110:	8b 45 10             	mov    0x10(%ebp),%eax
+  802113:	89 10                	mov    %edx,(%eax)
+  802115:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802118:	eb d3                	jmp    8020ed <nsipc_accept+0x27>
+
+0080211a <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80211a:	55                   	push   %ebp
+  80211b:	89 e5                	mov    %esp,%ebp
+  80211d:	53                   	push   %ebx
+  80211e:	83 ec 08             	sub    $0x8,%esp
+  802121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802124:	8b 45 08             	mov    0x8(%ebp),%eax
+  802127:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80212c:	53                   	push   %ebx
+  80212d:	ff 75 0c             	push   0xc(%ebp)
+  802130:	68 04 80 80 00       	push   $0x808004
+  802135:	e8 e5 e9 ff ff       	call   800b1f <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80213a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802140:	b8 02 00 00 00       	mov    $0x2,%eax
+  802145:	e8 ed fd ff ff       	call   801f37 <nsipc>
+}
+  80214a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80214d:	c9                   	leave
+  80214e:	c3                   	ret
+
+0080214f <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80214f:	55                   	push   %ebp
+  802150:	89 e5                	mov    %esp,%ebp
+  802152:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802155:	8b 45 08             	mov    0x8(%ebp),%eax
+  802158:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80215d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802160:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802165:	b8 03 00 00 00       	mov    $0x3,%eax
+  80216a:	e8 c8 fd ff ff       	call   801f37 <nsipc>
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+00802171 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802171:	55                   	push   %ebp
+  802172:	89 e5                	mov    %esp,%ebp
+  802174:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217a:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80217f:	b8 04 00 00 00       	mov    $0x4,%eax
+  802184:	e8 ae fd ff ff       	call   801f37 <nsipc>
+}
+  802189:	c9                   	leave
+  80218a:	c3                   	ret
+
+0080218b <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80218b:	55                   	push   %ebp
+  80218c:	89 e5                	mov    %esp,%ebp
+  80218e:	53                   	push   %ebx
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  802192:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802195:	8b 45 08             	mov    0x8(%ebp),%eax
+  802198:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80219d:	53                   	push   %ebx
+  80219e:	ff 75 0c             	push   0xc(%ebp)
+  8021a1:	68 04 80 80 00       	push   $0x808004
+  8021a6:	e8 74 e9 ff ff       	call   800b1f <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8021ab:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8021b1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021b6:	e8 7c fd ff ff       	call   801f37 <nsipc>
+}
+  8021bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+
+008021c0 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8021c0:	55                   	push   %ebp
+  8021c1:	89 e5                	mov    %esp,%ebp
+  8021c3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8021c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8021ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021d1:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8021d6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021db:	e8 57 fd ff ff       	call   801f37 <nsipc>
+}
+  8021e0:	c9                   	leave
+  8021e1:	c3                   	ret
+
+008021e2 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8021e2:	55                   	push   %ebp
+  8021e3:	89 e5                	mov    %esp,%ebp
+  8021e5:	56                   	push   %esi
+  8021e6:	53                   	push   %ebx
+  8021e7:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8021ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ed:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8021f2:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8021f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021fb:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802200:	b8 07 00 00 00       	mov    $0x7,%eax
+  802205:	e8 2d fd ff ff       	call   801f37 <nsipc>
+  80220a:	89 c3                	mov    %eax,%ebx
+  80220c:	85 c0                	test   %eax,%eax
+  80220e:	78 22                	js     802232 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802210:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802215:	39 c6                	cmp    %eax,%esi
+  802217:	0f 4e c6             	cmovle %esi,%eax
+  80221a:	39 c3                	cmp    %eax,%ebx
+  80221c:	7f 1d                	jg     80223b <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80221e:	83 ec 04             	sub    $0x4,%esp
+  802221:	53                   	push   %ebx
+  802222:	68 00 80 80 00       	push   $0x808000
+  802227:	ff 75 0c             	push   0xc(%ebp)
+  80222a:	e8 f0 e8 ff ff       	call   800b1f <memmove>
+  80222f:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802232:	89 d8                	mov    %ebx,%eax
+  802234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802237:	5b                   	pop    %ebx
+  802238:	5e                   	pop    %esi
+  802239:	5d                   	pop    %ebp
+  80223a:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80223b:	68 b4 3f 80 00       	push   $0x803fb4
+  802240:	68 c9 3f 80 00       	push   $0x803fc9
+  802245:	68 b2 00 00 00       	push   $0xb2
+  80224a:	68 de 3f 80 00       	push   $0x803fde
+  80224f:	e8 49 df ff ff       	call   80019d <_panic>
+
+00802254 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802254:	55                   	push   %ebp
+  802255:	89 e5                	mov    %esp,%ebp
+  802257:	53                   	push   %ebx
+  802258:	83 ec 04             	sub    $0x4,%esp
+  80225b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802266:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80226c:	7f 2e                	jg     80229c <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80226e:	83 ec 04             	sub    $0x4,%esp
+  802271:	53                   	push   %ebx
+  802272:	ff 75 0c             	push   0xc(%ebp)
+  802275:	68 0c 80 80 00       	push   $0x80800c
+  80227a:	e8 a0 e8 ff ff       	call   800b1f <memmove>
+	nsipcbuf.send.req_size = size;
+  80227f:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802285:	8b 45 14             	mov    0x14(%ebp),%eax
+  802288:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80228d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802292:	e8 a0 fc ff ff       	call   801f37 <nsipc>
+}
+  802297:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+	assert(size < 1600);
+  80229c:	68 ea 3f 80 00       	push   $0x803fea
+  8022a1:	68 c9 3f 80 00       	push   $0x803fc9
+  8022a6:	68 bd 00 00 00       	push   $0xbd
+  8022ab:	68 de 3f 80 00       	push   $0x803fde
+  8022b0:	e8 e8 de ff ff       	call   80019d <_panic>
+
+008022b5 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8022b5:	55                   	push   %ebp
+  8022b6:	89 e5                	mov    %esp,%ebp
+  8022b8:	57                   	push   %edi
+  8022b9:	56                   	push   %esi
+  8022ba:	53                   	push   %ebx
+  8022bb:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8022be:	e8 c0 fc ff ff       	call   801f83 <nsbulk_map>
+  8022c3:	85 c0                	test   %eax,%eax
+  8022c5:	78 55                	js     80231c <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8022c7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8022ce:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8022d5:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8022df:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022e2:	0f 8d 24 02 00 00    	jge    80250c <nsipc_sendmsg+0x257>
+  8022e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022eb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8022ee:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8022f1:	89 d8                	mov    %ebx,%eax
+  8022f3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022f8:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8022fa:	83 ec 0c             	sub    $0xc,%esp
+  8022fd:	68 20 60 80 00       	push   $0x806020
+  802302:	e8 5a 0f 00 00       	call   803261 <pgbatch_init>
+  802307:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80230a:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  80230c:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  80230f:	e9 82 00 00 00       	jmp    802396 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802314:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802317:	85 db                	test   %ebx,%ebx
+  802319:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80231c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80231f:	5b                   	pop    %ebx
+  802320:	5e                   	pop    %esi
+  802321:	5f                   	pop    %edi
+  802322:	5d                   	pop    %ebp
+  802323:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802324:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802329:	29 c8                	sub    %ecx,%eax
+  80232b:	39 d0                	cmp    %edx,%eax
+  80232d:	0f 46 d0             	cmovbe %eax,%edx
+  802330:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802332:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802338:	85 ff                	test   %edi,%edi
+  80233a:	0f 49 c7             	cmovns %edi,%eax
+  80233d:	c1 f8 0c             	sar    $0xc,%eax
+  802340:	ba 01 00 00 00       	mov    $0x1,%edx
+  802345:	e8 87 fc ff ff       	call   801fd1 <nsbulk_own>
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	0f 88 17 01 00 00    	js     802469 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802352:	83 ec 04             	sub    $0x4,%esp
+  802355:	56                   	push   %esi
+  802356:	ff 75 e0             	push   -0x20(%ebp)
+  802359:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80235c:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802361:	50                   	push   %eax
+  802362:	e8 b8 e7 ff ff       	call   800b1f <memmove>
+  802367:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  80236a:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80236d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802370:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802373:	0f 84 fd 00 00 00    	je     802476 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802379:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80237c:	01 f7                	add    %esi,%edi
+  80237e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802381:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802384:	0f 8d 01 01 00 00    	jge    80248b <nsipc_sendmsg+0x1d6>
+  80238a:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802390:	0f 8f f0 00 00 00    	jg     802486 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802396:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802399:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80239c:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80239f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023a2:	89 c2                	mov    %eax,%edx
+  8023a4:	03 13                	add    (%ebx),%edx
+  8023a6:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023a9:	8b 73 04             	mov    0x4(%ebx),%esi
+  8023ac:	29 c6                	sub    %eax,%esi
+  8023ae:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8023b3:	29 f9                	sub    %edi,%ecx
+  8023b5:	39 ce                	cmp    %ecx,%esi
+  8023b7:	89 ca                	mov    %ecx,%edx
+  8023b9:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8023bc:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8023bf:	89 f9                	mov    %edi,%ecx
+  8023c1:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8023c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023ca:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023cf:	09 c8                	or     %ecx,%eax
+  8023d1:	0f 85 4d ff ff ff    	jne    802324 <nsipc_sendmsg+0x6f>
+  8023d7:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8023dd:	0f 86 41 ff ff ff    	jbe    802324 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023e3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8023e9:	85 ff                	test   %edi,%edi
+  8023eb:	0f 49 c7             	cmovns %edi,%eax
+  8023ee:	c1 f8 0c             	sar    $0xc,%eax
+  8023f1:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8023f3:	89 d1                	mov    %edx,%ecx
+  8023f5:	c1 e9 0c             	shr    $0xc,%ecx
+  8023f8:	01 c8                	add    %ecx,%eax
+  8023fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023fd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802400:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802402:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802405:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  80240a:	29 c8                	sub    %ecx,%eax
+  80240c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80240f:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802412:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802414:	b8 01 00 00 00       	mov    $0x1,%eax
+  802419:	89 f9                	mov    %edi,%ecx
+  80241b:	d3 e0                	shl    %cl,%eax
+  80241d:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802428:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80242b:	50                   	push   %eax
+  80242c:	6a 00                	push   $0x0
+  80242e:	56                   	push   %esi
+  80242f:	6a 00                	push   $0x0
+  802431:	68 20 60 80 00       	push   $0x806020
+  802436:	e8 e4 0e 00 00       	call   80331f <pgbatch_map>
+  80243b:	83 c4 20             	add    $0x20,%esp
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	0f 88 ce fe ff ff    	js     802314 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802446:	83 c7 01             	add    $0x1,%edi
+  802449:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80244f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802452:	39 c7                	cmp    %eax,%edi
+  802454:	75 be                	jne    802414 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802456:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802459:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80245c:	89 d6                	mov    %edx,%esi
+  80245e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802464:	e9 01 ff ff ff       	jmp    80236a <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802469:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80246c:	85 db                	test   %ebx,%ebx
+  80246e:	0f 45 c3             	cmovne %ebx,%eax
+  802471:	e9 a6 fe ff ff       	jmp    80231c <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802476:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80247a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802481:	e9 f3 fe ff ff       	jmp    802379 <nsipc_sendmsg+0xc4>
+  802486:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802489:	eb 03                	jmp    80248e <nsipc_sendmsg+0x1d9>
+  80248b:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	68 20 60 80 00       	push   $0x806020
+  802496:	e8 d4 0d 00 00       	call   80326f <pgbatch_flush>
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 50                	js     8024f2 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  8024a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024a5:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  8024aa:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  8024b0:	89 fb                	mov    %edi,%ebx
+  8024b2:	29 f3                	sub    %esi,%ebx
+  8024b4:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8024ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024bd:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8024c2:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8024c7:	89 fa                	mov    %edi,%edx
+  8024c9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8024ce:	e8 66 fb ff ff       	call   802039 <nsipc_bulk>
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	78 28                	js     8024ff <nsipc_sendmsg+0x24a>
+		sent += r;
+  8024d7:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8024da:	39 c3                	cmp    %eax,%ebx
+  8024dc:	75 0c                	jne    8024ea <nsipc_sendmsg+0x235>
+  8024de:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024e1:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8024e4:	0f 8f f2 fd ff ff    	jg     8022dc <nsipc_sendmsg+0x27>
+		sent += r;
+  8024ea:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024ed:	e9 2a fe ff ff       	jmp    80231c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024f2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024f5:	85 db                	test   %ebx,%ebx
+  8024f7:	0f 45 c3             	cmovne %ebx,%eax
+  8024fa:	e9 1d fe ff ff       	jmp    80231c <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024ff:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802502:	85 db                	test   %ebx,%ebx
+  802504:	0f 45 c3             	cmovne %ebx,%eax
+  802507:	e9 10 fe ff ff       	jmp    80231c <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  80250c:	83 ec 0c             	sub    $0xc,%esp
+  80250f:	68 20 60 80 00       	push   $0x806020
+  802514:	e8 48 0d 00 00       	call   803261 <pgbatch_init>
+  802519:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80251c:	be 00 00 00 00       	mov    $0x0,%esi
+  802521:	bf 00 00 00 00       	mov    $0x0,%edi
+  802526:	e9 63 ff ff ff       	jmp    80248e <nsipc_sendmsg+0x1d9>
+
+0080252b <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80252b:	55                   	push   %ebp
+  80252c:	89 e5                	mov    %esp,%ebp
+  80252e:	57                   	push   %edi
+  80252f:	56                   	push   %esi
+  802530:	53                   	push   %ebx
+  802531:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802534:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  80253b:	0f 84 c8 00 00 00    	je     802609 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802541:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802548:	0f 84 e4 00 00 00    	je     802632 <nsipc_sendfile+0x107>
+{
+  80254e:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802553:	89 fb                	mov    %edi,%ebx
+  802555:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802558:	0f 83 f0 00 00 00    	jae    80264e <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80255e:	89 fa                	mov    %edi,%edx
+  802560:	03 55 10             	add    0x10(%ebp),%edx
+  802563:	89 d0                	mov    %edx,%eax
+  802565:	c1 f8 1f             	sar    $0x1f,%eax
+  802568:	c1 e8 14             	shr    $0x14,%eax
+  80256b:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80256e:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802574:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802576:	6a 10                	push   $0x10
+  802578:	68 00 20 01 e0       	push   $0xe0012000
+  80257d:	52                   	push   %edx
+  80257e:	ff 75 0c             	push   0xc(%ebp)
+  802581:	e8 fe f4 ff ff       	call   801a84 <fmap>
+  802586:	83 c4 10             	add    $0x10,%esp
+  802589:	85 c0                	test   %eax,%eax
+  80258b:	0f 8e b8 00 00 00    	jle    802649 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802591:	39 c6                	cmp    %eax,%esi
+  802593:	0f 8d b5 00 00 00    	jge    80264e <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802599:	29 f0                	sub    %esi,%eax
+  80259b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80259e:	29 da                	sub    %ebx,%edx
+  8025a0:	39 d0                	cmp    %edx,%eax
+  8025a2:	89 d3                	mov    %edx,%ebx
+  8025a4:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  8025a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025aa:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  8025af:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8025b5:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8025bb:	8b 45 18             	mov    0x18(%ebp),%eax
+  8025be:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025c3:	83 ec 0c             	sub    $0xc,%esp
+  8025c6:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8025c8:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8025cf:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8025d2:	83 c0 01             	add    $0x1,%eax
+  8025d5:	50                   	push   %eax
+  8025d6:	68 00 10 01 e0       	push   $0xe0011000
+  8025db:	6a 11                	push   $0x11
+  8025dd:	ff 35 24 63 80 00    	push   0x806324
+  8025e3:	e8 ba 12 00 00       	call   8038a2 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8025e8:	83 c4 1c             	add    $0x1c,%esp
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	6a 00                	push   $0x0
+  8025f1:	e8 e8 0f 00 00       	call   8035de <ipc_recv>
+  8025f6:	83 c4 10             	add    $0x10,%esp
+  8025f9:	85 c0                	test   %eax,%eax
+  8025fb:	78 5b                	js     802658 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8025fd:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8025ff:	39 c3                	cmp    %eax,%ebx
+  802601:	0f 8e 4c ff ff ff    	jle    802553 <nsipc_sendfile+0x28>
+  802607:	eb 45                	jmp    80264e <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802609:	83 ec 04             	sub    $0x4,%esp
+  80260c:	6a 07                	push   $0x7
+  80260e:	68 00 10 01 e0       	push   $0xe0011000
+  802613:	6a 00                	push   $0x0
+  802615:	e8 89 e7 ff ff       	call   800da3 <sys_page_alloc>
+  80261a:	89 c7                	mov    %eax,%edi
+  80261c:	83 c4 10             	add    $0x10,%esp
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	78 2b                	js     80264e <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802623:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  80262a:	00 00 00 
+  80262d:	e9 0f ff ff ff       	jmp    802541 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802632:	83 ec 0c             	sub    $0xc,%esp
+  802635:	6a 03                	push   $0x3
+  802637:	e8 9b 12 00 00       	call   8038d7 <ipc_find_env>
+  80263c:	a3 24 63 80 00       	mov    %eax,0x806324
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	e9 05 ff ff ff       	jmp    80254e <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802649:	85 ff                	test   %edi,%edi
+  80264b:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80264e:	89 f8                	mov    %edi,%eax
+  802650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802653:	5b                   	pop    %ebx
+  802654:	5e                   	pop    %esi
+  802655:	5f                   	pop    %edi
+  802656:	5d                   	pop    %ebp
+  802657:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802658:	85 ff                	test   %edi,%edi
+  80265a:	0f 44 f8             	cmove  %eax,%edi
+  80265d:	eb ef                	jmp    80264e <nsipc_sendfile+0x123>
+
+0080265f <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80265f:	55                   	push   %ebp
+  802660:	89 e5                	mov    %esp,%ebp
+  802662:	57                   	push   %edi
+  802663:	56                   	push   %esi
+  802664:	53                   	push   %ebx
+  802665:	83 ec 1c             	sub    $0x1c,%esp
+  802668:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80266b:	e8 13 f9 ff ff       	call   801f83 <nsbulk_map>
+  802670:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802673:	85 c0                	test   %eax,%eax
+  802675:	0f 88 ba 00 00 00    	js     802735 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80267b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80267f:	0f 8e bb 00 00 00    	jle    802740 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802685:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80268a:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80268f:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802694:	89 f8                	mov    %edi,%eax
+  802696:	29 f0                	sub    %esi,%eax
+  802698:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80269c:	39 c8                	cmp    %ecx,%eax
+  80269e:	0f 47 c1             	cmova  %ecx,%eax
+  8026a1:	01 f0                	add    %esi,%eax
+  8026a3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  8026a5:	83 c2 01             	add    $0x1,%edx
+  8026a8:	39 55 10             	cmp    %edx,0x10(%ebp)
+  8026ab:	7e 07                	jle    8026b4 <nsipc_recvmsg+0x55>
+  8026ad:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8026b2:	7e e0                	jle    802694 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8026b4:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8026ba:	c1 fa 0c             	sar    $0xc,%edx
+  8026bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c2:	e8 0a f9 ff ff       	call   801fd1 <nsbulk_own>
+  8026c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026ca:	85 c0                	test   %eax,%eax
+  8026cc:	78 67                	js     802735 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8026ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d1:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8026d6:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8026dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026df:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8026e4:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8026e9:	89 f2                	mov    %esi,%edx
+  8026eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8026f0:	e8 44 f9 ff ff       	call   802039 <nsipc_bulk>
+  8026f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026f8:	85 c0                	test   %eax,%eax
+  8026fa:	78 39                	js     802735 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8026fc:	39 f0                	cmp    %esi,%eax
+  8026fe:	7f 4a                	jg     80274a <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  802700:	bf 00 00 00 00       	mov    $0x0,%edi
+  802705:	85 c0                	test   %eax,%eax
+  802707:	7e 2c                	jle    802735 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  802709:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80270c:	29 fe                	sub    %edi,%esi
+  80270e:	8b 43 04             	mov    0x4(%ebx),%eax
+  802711:	39 c6                	cmp    %eax,%esi
+  802713:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802716:	83 ec 04             	sub    $0x4,%esp
+  802719:	56                   	push   %esi
+  80271a:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  802720:	50                   	push   %eax
+  802721:	ff 33                	push   (%ebx)
+  802723:	e8 f7 e3 ff ff       	call   800b1f <memmove>
+		n += m;
+  802728:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  80272a:	83 c3 08             	add    $0x8,%ebx
+  80272d:	83 c4 10             	add    $0x10,%esp
+  802730:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802733:	7f d4                	jg     802709 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802735:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273b:	5b                   	pop    %ebx
+  80273c:	5e                   	pop    %esi
+  80273d:	5f                   	pop    %edi
+  80273e:	5d                   	pop    %ebp
+  80273f:	c3                   	ret
+	int r, i, n, len = 0;
+  802740:	be 00 00 00 00       	mov    $0x0,%esi
+  802745:	e9 6a ff ff ff       	jmp    8026b4 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  80274a:	68 c0 3f 80 00       	push   $0x803fc0
+  80274f:	68 c9 3f 80 00       	push   $0x803fc9
+  802754:	68 3b 01 00 00       	push   $0x13b
+  802759:	68 de 3f 80 00       	push   $0x803fde
+  80275e:	e8 3a da ff ff       	call   80019d <_panic>
+
+00802763 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	57                   	push   %edi
+  802767:	56                   	push   %esi
+  802768:	53                   	push   %ebx
+  802769:	83 ec 0c             	sub    $0xc,%esp
+  80276c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80276f:	8b 75 10             	mov    0x10(%ebp),%esi
+  802772:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802775:	8b 45 08             	mov    0x8(%ebp),%eax
+  802778:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80277d:	8b 07                	mov    (%edi),%eax
+  80277f:	a3 04 80 80 00       	mov    %eax,0x808004
+  802784:	8b 47 04             	mov    0x4(%edi),%eax
+  802787:	a3 08 80 80 00       	mov    %eax,0x808008
+  80278c:	8b 47 08             	mov    0x8(%edi),%eax
+  80278f:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802794:	8b 47 0c             	mov    0xc(%edi),%eax
+  802797:	a3 10 80 80 00       	mov    %eax,0x808010
+  80279c:	8b 47 10             	mov    0x10(%edi),%eax
+  80279f:	a3 14 80 80 00       	mov    %eax,0x808014
+  8027a4:	8b 47 14             	mov    0x14(%edi),%eax
+  8027a7:	a3 18 80 80 00       	mov    %eax,0x808018
+  8027ac:	8b 47 18             	mov    0x18(%edi),%eax
+  8027af:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8027b4:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8027b7:	a3 20 80 80 00       	mov    %eax,0x808020
+  8027bc:	8b 47 20             	mov    0x20(%edi),%eax
+  8027bf:	a3 24 80 80 00       	mov    %eax,0x808024
+  8027c4:	8b 47 24             	mov    0x24(%edi),%eax
+  8027c7:	a3 28 80 80 00       	mov    %eax,0x808028
+  8027cc:	8b 47 28             	mov    0x28(%edi),%eax
+  8027cf:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8027d4:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8027d7:	a3 30 80 80 00       	mov    %eax,0x808030
+  8027dc:	8b 47 30             	mov    0x30(%edi),%eax
+  8027df:	a3 34 80 80 00       	mov    %eax,0x808034
+  8027e4:	8b 47 34             	mov    0x34(%edi),%eax
+  8027e7:	a3 38 80 80 00       	mov    %eax,0x808038
+  8027ec:	8b 47 38             	mov    0x38(%edi),%eax
+  8027ef:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8027f4:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8027f7:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8027fc:	8b 06                	mov    (%esi),%eax
+  8027fe:	a3 44 80 80 00       	mov    %eax,0x808044
+  802803:	8b 46 04             	mov    0x4(%esi),%eax
+  802806:	a3 48 80 80 00       	mov    %eax,0x808048
+  80280b:	8b 46 08             	mov    0x8(%esi),%eax
+  80280e:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802813:	8b 46 0c             	mov    0xc(%esi),%eax
+  802816:	a3 50 80 80 00       	mov    %eax,0x808050
+  80281b:	8b 46 10             	mov    0x10(%esi),%eax
+  80281e:	a3 54 80 80 00       	mov    %eax,0x808054
+  802823:	8b 46 14             	mov    0x14(%esi),%eax
+  802826:	a3 58 80 80 00       	mov    %eax,0x808058
+  80282b:	8b 46 18             	mov    0x18(%esi),%eax
+  80282e:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802833:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802836:	a3 60 80 80 00       	mov    %eax,0x808060
+  80283b:	8b 46 20             	mov    0x20(%esi),%eax
+  80283e:	a3 64 80 80 00       	mov    %eax,0x808064
+  802843:	8b 46 24             	mov    0x24(%esi),%eax
+  802846:	a3 68 80 80 00       	mov    %eax,0x808068
+  80284b:	8b 46 28             	mov    0x28(%esi),%eax
+  80284e:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802853:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802856:	a3 70 80 80 00       	mov    %eax,0x808070
+  80285b:	8b 46 30             	mov    0x30(%esi),%eax
+  80285e:	a3 74 80 80 00       	mov    %eax,0x808074
+  802863:	8b 46 34             	mov    0x34(%esi),%eax
+  802866:	a3 78 80 80 00       	mov    %eax,0x808078
+  80286b:	8b 46 38             	mov    0x38(%esi),%eax
+  80286e:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802873:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802876:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80287b:	8b 03                	mov    (%ebx),%eax
+  80287d:	a3 84 80 80 00       	mov    %eax,0x808084
+  802882:	8b 43 04             	mov    0x4(%ebx),%eax
+  802885:	a3 88 80 80 00       	mov    %eax,0x808088
+  80288a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80288d:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802892:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802895:	a3 90 80 80 00       	mov    %eax,0x808090
+  80289a:	8b 43 10             	mov    0x10(%ebx),%eax
+  80289d:	a3 94 80 80 00       	mov    %eax,0x808094
+  8028a2:	8b 43 14             	mov    0x14(%ebx),%eax
+  8028a5:	a3 98 80 80 00       	mov    %eax,0x808098
+  8028aa:	8b 43 18             	mov    0x18(%ebx),%eax
+  8028ad:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8028b2:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8028b5:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8028ba:	8b 43 20             	mov    0x20(%ebx),%eax
+  8028bd:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8028c2:	8b 43 24             	mov    0x24(%ebx),%eax
+  8028c5:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8028ca:	8b 43 28             	mov    0x28(%ebx),%eax
+  8028cd:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8028d2:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8028d5:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8028da:	8b 43 30             	mov    0x30(%ebx),%eax
+  8028dd:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8028e2:	8b 43 34             	mov    0x34(%ebx),%eax
+  8028e5:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8028ea:	8b 43 38             	mov    0x38(%ebx),%eax
+  8028ed:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8028f2:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8028f5:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8028fa:	8b 45 18             	mov    0x18(%ebp),%eax
+  8028fd:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  802902:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802907:	e8 2b f6 ff ff       	call   801f37 <nsipc>
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	0f 88 ad 01 00 00    	js     802ac1 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802914:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  80291a:	89 17                	mov    %edx,(%edi)
+  80291c:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802922:	89 57 04             	mov    %edx,0x4(%edi)
+  802925:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  80292b:	89 57 08             	mov    %edx,0x8(%edi)
+  80292e:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802934:	89 57 0c             	mov    %edx,0xc(%edi)
+  802937:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  80293d:	89 57 10             	mov    %edx,0x10(%edi)
+  802940:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802946:	89 57 14             	mov    %edx,0x14(%edi)
+  802949:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80294f:	89 57 18             	mov    %edx,0x18(%edi)
+  802952:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802958:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80295b:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802961:	89 57 20             	mov    %edx,0x20(%edi)
+  802964:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  80296a:	89 57 24             	mov    %edx,0x24(%edi)
+  80296d:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802973:	89 57 28             	mov    %edx,0x28(%edi)
+  802976:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80297c:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80297f:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802985:	89 57 30             	mov    %edx,0x30(%edi)
+  802988:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80298e:	89 57 34             	mov    %edx,0x34(%edi)
+  802991:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802997:	89 57 38             	mov    %edx,0x38(%edi)
+  80299a:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  8029a0:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  8029a3:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  8029a9:	89 16                	mov    %edx,(%esi)
+  8029ab:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  8029b1:	89 56 04             	mov    %edx,0x4(%esi)
+  8029b4:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  8029ba:	89 56 08             	mov    %edx,0x8(%esi)
+  8029bd:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  8029c3:	89 56 0c             	mov    %edx,0xc(%esi)
+  8029c6:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  8029cc:	89 56 10             	mov    %edx,0x10(%esi)
+  8029cf:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  8029d5:	89 56 14             	mov    %edx,0x14(%esi)
+  8029d8:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  8029de:	89 56 18             	mov    %edx,0x18(%esi)
+  8029e1:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8029e7:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8029ea:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8029f0:	89 56 20             	mov    %edx,0x20(%esi)
+  8029f3:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8029f9:	89 56 24             	mov    %edx,0x24(%esi)
+  8029fc:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802a02:	89 56 28             	mov    %edx,0x28(%esi)
+  802a05:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802a0b:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802a0e:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802a14:	89 56 30             	mov    %edx,0x30(%esi)
+  802a17:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802a1d:	89 56 34             	mov    %edx,0x34(%esi)
+  802a20:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802a26:	89 56 38             	mov    %edx,0x38(%esi)
+  802a29:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802a2f:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802a32:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802a38:	89 13                	mov    %edx,(%ebx)
+  802a3a:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802a40:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a43:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802a49:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a4c:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802a52:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a55:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a5b:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a5e:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a64:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a67:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802a6d:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a70:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802a76:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a79:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802a7f:	89 53 20             	mov    %edx,0x20(%ebx)
+  802a82:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802a88:	89 53 24             	mov    %edx,0x24(%ebx)
+  802a8b:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802a91:	89 53 28             	mov    %edx,0x28(%ebx)
+  802a94:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802a9a:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802a9d:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802aa3:	89 53 30             	mov    %edx,0x30(%ebx)
+  802aa6:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802aac:	89 53 34             	mov    %edx,0x34(%ebx)
+  802aaf:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802ab5:	89 53 38             	mov    %edx,0x38(%ebx)
+  802ab8:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802abe:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802ac1:	83 c4 0c             	add    $0xc,%esp
+  802ac4:	5b                   	pop    %ebx
+  802ac5:	5e                   	pop    %esi
+  802ac6:	5f                   	pop    %edi
+  802ac7:	5d                   	pop    %ebp
+  802ac8:	c3                   	ret
+
+00802ac9 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802acf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad2:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802ad7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ada:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802adf:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ae2:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802ae7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802aec:	e8 46 f4 ff ff       	call   801f37 <nsipc>
+}
+  802af1:	c9                   	leave
+  802af2:	c3                   	ret
+
+00802af3 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802af3:	55                   	push   %ebp
+  802af4:	89 e5                	mov    %esp,%ebp
+  802af6:	56                   	push   %esi
+  802af7:	53                   	push   %ebx
+  802af8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802afb:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802b01:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b04:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802b09:	b8 10 00 00 00       	mov    $0x10,%eax
+  802b0e:	e8 24 f4 ff ff       	call   801f37 <nsipc>
+  802b13:	89 c3                	mov    %eax,%ebx
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	7e 1f                	jle    802b38 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802b19:	39 c6                	cmp    %eax,%esi
+  802b1b:	7c 24                	jl     802b41 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802b1d:	83 ec 04             	sub    $0x4,%esp
+  802b20:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802b27:	50                   	push   %eax
+  802b28:	68 00 80 80 00       	push   $0x808000
+  802b2d:	ff 75 08             	push   0x8(%ebp)
+  802b30:	e8 ea df ff ff       	call   800b1f <memmove>
+  802b35:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802b38:	89 d8                	mov    %ebx,%eax
+  802b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b3d:	5b                   	pop    %ebx
+  802b3e:	5e                   	pop    %esi
+  802b3f:	5d                   	pop    %ebp
+  802b40:	c3                   	ret
+		assert(r <= max);
+  802b41:	68 f6 3f 80 00       	push   $0x803ff6
+  802b46:	68 c9 3f 80 00       	push   $0x803fc9
+  802b4b:	68 6a 01 00 00       	push   $0x16a
+  802b50:	68 de 3f 80 00       	push   $0x803fde
+  802b55:	e8 43 d6 ff ff       	call   80019d <_panic>
+
+00802b5a <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b5a:	55                   	push   %ebp
+  802b5b:	89 e5                	mov    %esp,%ebp
+  802b5d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b60:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b63:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b70:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b73:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b78:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b7d:	e8 b5 f3 ff ff       	call   801f37 <nsipc>
+}
+  802b82:	c9                   	leave
+  802b83:	c3                   	ret
+
+00802b84 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b8d:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802b92:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b97:	e8 9b f3 ff ff       	call   801f37 <nsipc>
+}
+  802b9c:	c9                   	leave
+  802b9d:	c3                   	ret
+
+00802b9e <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802b9e:	55                   	push   %ebp
+  802b9f:	89 e5                	mov    %esp,%ebp
+  802ba1:	53                   	push   %ebx
+  802ba2:	83 ec 04             	sub    $0x4,%esp
+  802ba5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802ba8:	b8 12 00 00 00       	mov    $0x12,%eax
+  802bad:	e8 85 f3 ff ff       	call   801f37 <nsipc>
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	78 50                	js     802c06 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802bb6:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802bbc:	89 13                	mov    %edx,(%ebx)
+  802bbe:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802bc4:	89 53 04             	mov    %edx,0x4(%ebx)
+  802bc7:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802bcd:	89 53 08             	mov    %edx,0x8(%ebx)
+  802bd0:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802bd6:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802bd9:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802bdf:	89 53 10             	mov    %edx,0x10(%ebx)
+  802be2:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802be8:	89 53 14             	mov    %edx,0x14(%ebx)
+  802beb:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802bf1:	89 53 18             	mov    %edx,0x18(%ebx)
+  802bf4:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802bfa:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802bfd:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802c03:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802c06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+00802c0b <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802c11:	6a 03                	push   $0x3
+  802c13:	e8 bf 0c 00 00       	call   8038d7 <ipc_find_env>
+  802c18:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802c1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c20:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802c25:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802c2a:	e8 08 f3 ff ff       	call   801f37 <nsipc>
+  802c2f:	83 c4 10             	add    $0x10,%esp
+  802c32:	85 c0                	test   %eax,%eax
+  802c34:	78 0a                	js     802c40 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802c36:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c40:	c9                   	leave
+  802c41:	c3                   	ret
+
+00802c42 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c42:	55                   	push   %ebp
+  802c43:	89 e5                	mov    %esp,%ebp
+  802c45:	57                   	push   %edi
+  802c46:	56                   	push   %esi
+  802c47:	53                   	push   %ebx
+  802c48:	83 ec 1c             	sub    $0x1c,%esp
+  802c4b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c4e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c51:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c5b:	89 e0                	mov    %esp,%eax
+  802c5d:	89 f2                	mov    %esi,%edx
+  802c5f:	29 c2                	sub    %eax,%edx
+  802c61:	89 d0                	mov    %edx,%eax
+  802c63:	c1 e8 0f             	shr    $0xf,%eax
+  802c66:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c6c:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c6f:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c76:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c79:	83 ec 0c             	sub    $0xc,%esp
+  802c7c:	ff 75 e0             	push   -0x20(%ebp)
+  802c7f:	e8 92 0c 00 00       	call   803916 <pageref>
+  802c84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c87:	83 c4 04             	add    $0x4,%esp
+  802c8a:	ff 75 dc             	push   -0x24(%ebp)
+  802c8d:	e8 84 0c 00 00       	call   803916 <pageref>
+  802c92:	89 e2                	mov    %esp,%edx
+  802c94:	89 f1                	mov    %esi,%ecx
+  802c96:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802c98:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802c9b:	89 ca                	mov    %ecx,%edx
+  802c9d:	c1 ea 0f             	shr    $0xf,%edx
+  802ca0:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802ca6:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802ca9:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802cb0:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802cb3:	39 d7                	cmp    %edx,%edi
+  802cb5:	74 40                	je     802cf7 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802cb7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cba:	75 9f                	jne    802c5b <_pipeisclosed+0x19>
+  802cbc:	89 e2                	mov    %esp,%edx
+  802cbe:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802cc3:	29 d0                	sub    %edx,%eax
+  802cc5:	89 c2                	mov    %eax,%edx
+  802cc7:	c1 ea 0f             	shr    $0xf,%edx
+  802cca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd4:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cd7:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802cde:	8b 40 58             	mov    0x58(%eax),%eax
+  802ce1:	6a 01                	push   $0x1
+  802ce3:	50                   	push   %eax
+  802ce4:	57                   	push   %edi
+  802ce5:	68 ff 3f 80 00       	push   $0x803fff
+  802cea:	e8 89 d5 ff ff       	call   800278 <cprintf>
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	e9 5f ff ff ff       	jmp    802c56 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802cf7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cfa:	0f 94 c0             	sete   %al
+  802cfd:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d03:	5b                   	pop    %ebx
+  802d04:	5e                   	pop    %esi
+  802d05:	5f                   	pop    %edi
+  802d06:	5d                   	pop    %ebp
+  802d07:	c3                   	ret
+
+00802d08 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802d08:	55                   	push   %ebp
+  802d09:	89 e5                	mov    %esp,%ebp
+  802d0b:	53                   	push   %ebx
+  802d0c:	83 ec 0c             	sub    $0xc,%esp
+  802d0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802d12:	53                   	push   %ebx
+  802d13:	6a 00                	push   $0x0
+  802d15:	e8 0e e1 ff ff       	call   800e28 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802d1a:	89 1c 24             	mov    %ebx,(%esp)
+  802d1d:	e8 f4 e4 ff ff       	call   801216 <fd2data>
+  802d22:	83 c4 08             	add    $0x8,%esp
+  802d25:	50                   	push   %eax
+  802d26:	6a 00                	push   $0x0
+  802d28:	e8 fb e0 ff ff       	call   800e28 <sys_page_unmap>
+}
+  802d2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d30:	c9                   	leave
+  802d31:	c3                   	ret
+
+00802d32 <devpipe_read>:
+{
+  802d32:	55                   	push   %ebp
+  802d33:	89 e5                	mov    %esp,%ebp
+  802d35:	57                   	push   %edi
+  802d36:	56                   	push   %esi
+  802d37:	53                   	push   %ebx
+  802d38:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d3b:	ff 75 08             	push   0x8(%ebp)
+  802d3e:	e8 d3 e4 ff ff       	call   801216 <fd2data>
+  802d43:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d45:	8b 70 04             	mov    0x4(%eax),%esi
+  802d48:	8b 00                	mov    (%eax),%eax
+  802d4a:	83 c4 10             	add    $0x10,%esp
+  802d4d:	39 f0                	cmp    %esi,%eax
+  802d4f:	75 36                	jne    802d87 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d51:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d54:	89 da                	mov    %ebx,%edx
+  802d56:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d59:	e8 e4 fe ff ff       	call   802c42 <_pipeisclosed>
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	0f 85 d4 00 00 00    	jne    802e3a <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d66:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d6b:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d6f:	83 ec 04             	sub    $0x4,%esp
+  802d72:	6a ff                	push   $0xffffffff
+  802d74:	56                   	push   %esi
+  802d75:	57                   	push   %edi
+  802d76:	e8 26 e4 ff ff       	call   8011a1 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d7b:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d7e:	8b 03                	mov    (%ebx),%eax
+  802d80:	83 c4 10             	add    $0x10,%esp
+  802d83:	39 c6                	cmp    %eax,%esi
+  802d85:	74 cd                	je     802d54 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d87:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d8a:	8b 03                	mov    (%ebx),%eax
+  802d8c:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802d92:	29 c6                	sub    %eax,%esi
+  802d94:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d99:	f7 e6                	mul    %esi
+  802d9b:	c1 ea 0c             	shr    $0xc,%edx
+  802d9e:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802da4:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802da6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802da9:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802dad:	8b 0b                	mov    (%ebx),%ecx
+  802daf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802db4:	f7 e1                	mul    %ecx
+  802db6:	c1 ea 0b             	shr    $0xb,%edx
+  802db9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802dbf:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802dc1:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802dc6:	29 cf                	sub    %ecx,%edi
+  802dc8:	39 f7                	cmp    %esi,%edi
+  802dca:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802dcd:	83 ec 04             	sub    $0x4,%esp
+  802dd0:	57                   	push   %edi
+  802dd1:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802dd5:	50                   	push   %eax
+  802dd6:	ff 75 0c             	push   0xc(%ebp)
+  802dd9:	e8 41 dd ff ff       	call   800b1f <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802dde:	83 c4 0c             	add    $0xc,%esp
+  802de1:	89 f0                	mov    %esi,%eax
+  802de3:	29 f8                	sub    %edi,%eax
+  802de5:	50                   	push   %eax
+  802de6:	8d 43 10             	lea    0x10(%ebx),%eax
+  802de9:	50                   	push   %eax
+  802dea:	89 f8                	mov    %edi,%eax
+  802dec:	03 45 0c             	add    0xc(%ebp),%eax
+  802def:	50                   	push   %eax
+  802df0:	e8 2a dd ff ff       	call   800b1f <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802df5:	8b 0b                	mov    (%ebx),%ecx
+  802df7:	01 f1                	add    %esi,%ecx
+  802df9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dfe:	f7 e1                	mul    %ecx
+  802e00:	c1 ea 0c             	shr    $0xc,%edx
+  802e03:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802e09:	29 c1                	sub    %eax,%ecx
+  802e0b:	89 0b                	mov    %ecx,(%ebx)
+  802e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e12:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802e16:	83 c4 10             	add    $0x10,%esp
+  802e19:	85 c0                	test   %eax,%eax
+  802e1b:	75 0a                	jne    802e27 <devpipe_read+0xf5>
+	return n;
+  802e1d:	89 f0                	mov    %esi,%eax
+}
+  802e1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e22:	5b                   	pop    %ebx
+  802e23:	5e                   	pop    %esi
+  802e24:	5f                   	pop    %edi
+  802e25:	5d                   	pop    %ebp
+  802e26:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802e27:	83 ec 08             	sub    $0x8,%esp
+  802e2a:	68 00 04 00 00       	push   $0x400
+  802e2f:	53                   	push   %ebx
+  802e30:	e8 8e e3 ff ff       	call   8011c3 <sys_futex_wake>
+  802e35:	83 c4 10             	add    $0x10,%esp
+  802e38:	eb e3                	jmp    802e1d <devpipe_read+0xeb>
+			return 0;
+  802e3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e3f:	eb de                	jmp    802e1f <devpipe_read+0xed>
+
+00802e41 <devpipe_write>:
+{
+  802e41:	55                   	push   %ebp
+  802e42:	89 e5                	mov    %esp,%ebp
+  802e44:	57                   	push   %edi
+  802e45:	56                   	push   %esi
+  802e46:	53                   	push   %ebx
+  802e47:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e4a:	ff 75 08             	push   0x8(%ebp)
+  802e4d:	e8 c4 e3 ff ff       	call   801216 <fd2data>
+  802e52:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e54:	83 c4 10             	add    $0x10,%esp
+  802e57:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e5e:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e63:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e67:	0f 84 43 01 00 00    	je     802fb0 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e6d:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e70:	8b 06                	mov    (%esi),%eax
+  802e72:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e78:	29 c1                	sub    %eax,%ecx
+  802e7a:	89 c8                	mov    %ecx,%eax
+  802e7c:	f7 e7                	mul    %edi
+  802e7e:	c1 ea 0c             	shr    $0xc,%edx
+  802e81:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e87:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802e89:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e8f:	75 52                	jne    802ee3 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802e91:	89 f2                	mov    %esi,%edx
+  802e93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e96:	e8 a7 fd ff ff       	call   802c42 <_pipeisclosed>
+  802e9b:	85 c0                	test   %eax,%eax
+  802e9d:	0f 85 28 01 00 00    	jne    802fcb <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802ea3:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ea5:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ea8:	8b 06                	mov    (%esi),%eax
+  802eaa:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802eb0:	29 c1                	sub    %eax,%ecx
+  802eb2:	89 c8                	mov    %ecx,%eax
+  802eb4:	f7 e7                	mul    %edi
+  802eb6:	c1 ea 0c             	shr    $0xc,%edx
+  802eb9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ebf:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802ec1:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ec7:	75 a4                	jne    802e6d <devpipe_write+0x2c>
+  802ec9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ece:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802ed2:	83 ec 04             	sub    $0x4,%esp
+  802ed5:	6a ff                	push   $0xffffffff
+  802ed7:	53                   	push   %ebx
+  802ed8:	56                   	push   %esi
+  802ed9:	e8 c3 e2 ff ff       	call   8011a1 <sys_futex_wait>
+}
+  802ede:	83 c4 10             	add    $0x10,%esp
+  802ee1:	eb 8a                	jmp    802e6d <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ee3:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ee6:	8b 06                	mov    (%esi),%eax
+  802ee8:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802eee:	29 c1                	sub    %eax,%ecx
+  802ef0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ef5:	f7 e1                	mul    %ecx
+  802ef7:	c1 ea 0c             	shr    $0xc,%edx
+  802efa:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f00:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802f02:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802f07:	89 d8                	mov    %ebx,%eax
+  802f09:	29 c8                	sub    %ecx,%eax
+  802f0b:	8b 55 10             	mov    0x10(%ebp),%edx
+  802f0e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f11:	29 ca                	sub    %ecx,%edx
+  802f13:	39 d0                	cmp    %edx,%eax
+  802f15:	0f 46 d0             	cmovbe %eax,%edx
+  802f18:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f1b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f1e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f23:	f7 e1                	mul    %ecx
+  802f25:	c1 ea 0b             	shr    $0xb,%edx
+  802f28:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f2e:	89 ca                	mov    %ecx,%edx
+  802f30:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f32:	29 d3                	sub    %edx,%ebx
+  802f34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f37:	39 c3                	cmp    %eax,%ebx
+  802f39:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802f3c:	83 ec 04             	sub    $0x4,%esp
+  802f3f:	53                   	push   %ebx
+  802f40:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f43:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f46:	51                   	push   %ecx
+  802f47:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f4b:	50                   	push   %eax
+  802f4c:	e8 ce db ff ff       	call   800b1f <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f51:	83 c4 0c             	add    $0xc,%esp
+  802f54:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f57:	29 d8                	sub    %ebx,%eax
+  802f59:	50                   	push   %eax
+  802f5a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f5d:	01 cb                	add    %ecx,%ebx
+  802f5f:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f62:	53                   	push   %ebx
+  802f63:	8d 46 10             	lea    0x10(%esi),%eax
+  802f66:	50                   	push   %eax
+  802f67:	e8 b3 db ff ff       	call   800b1f <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f6c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f6f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f72:	01 c1                	add    %eax,%ecx
+  802f74:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f79:	f7 e1                	mul    %ecx
+  802f7b:	c1 ea 0c             	shr    $0xc,%edx
+  802f7e:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f84:	89 ca                	mov    %ecx,%edx
+  802f86:	29 c2                	sub    %eax,%edx
+  802f88:	89 56 04             	mov    %edx,0x4(%esi)
+  802f8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f90:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802f94:	83 c4 10             	add    $0x10,%esp
+  802f97:	85 c0                	test   %eax,%eax
+  802f99:	75 1a                	jne    802fb5 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802f9b:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f9e:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802fa1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fa4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802fa7:	0f 82 c0 fe ff ff    	jb     802e6d <devpipe_write+0x2c>
+  802fad:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802fb0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fb3:	eb 1b                	jmp    802fd0 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802fb5:	83 ec 08             	sub    $0x8,%esp
+  802fb8:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802fbd:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802fc0:	50                   	push   %eax
+  802fc1:	e8 fd e1 ff ff       	call   8011c3 <sys_futex_wake>
+  802fc6:	83 c4 10             	add    $0x10,%esp
+  802fc9:	eb d0                	jmp    802f9b <devpipe_write+0x15a>
+				return 0;
+  802fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5f                   	pop    %edi
+  802fd6:	5d                   	pop    %ebp
+  802fd7:	c3                   	ret
+
+00802fd8 <devpipe_stat>:
+{
+  802fd8:	55                   	push   %ebp
+  802fd9:	89 e5                	mov    %esp,%ebp
+  802fdb:	56                   	push   %esi
+  802fdc:	53                   	push   %ebx
+  802fdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fe0:	83 ec 0c             	sub    $0xc,%esp
+  802fe3:	ff 75 08             	push   0x8(%ebp)
+  802fe6:	e8 2b e2 ff ff       	call   801216 <fd2data>
+  802feb:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fed:	83 c4 08             	add    $0x8,%esp
+  802ff0:	68 12 40 80 00       	push   $0x804012
+  802ff5:	53                   	push   %ebx
+  802ff6:	e8 74 d9 ff ff       	call   80096f <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ffb:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ffe:	8b 06                	mov    (%esi),%eax
+  803000:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803006:	29 c1                	sub    %eax,%ecx
+  803008:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80300d:	89 c8                	mov    %ecx,%eax
+  80300f:	f7 e2                	mul    %edx
+  803011:	c1 ea 0c             	shr    $0xc,%edx
+  803014:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80301a:	29 d1                	sub    %edx,%ecx
+  80301c:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803022:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803029:	00 00 00 
+	stat->st_dev = &devpipe;
+  80302c:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803033:	50 80 00 
+}
+  803036:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80303e:	5b                   	pop    %ebx
+  80303f:	5e                   	pop    %esi
+  803040:	5d                   	pop    %ebp
+  803041:	c3                   	ret
+
+00803042 <devpipe_poll>:
+{
+  803042:	55                   	push   %ebp
+  803043:	89 e5                	mov    %esp,%ebp
+  803045:	57                   	push   %edi
+  803046:	56                   	push   %esi
+  803047:	53                   	push   %ebx
+  803048:	83 ec 18             	sub    $0x18,%esp
+  80304b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80304e:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803051:	57                   	push   %edi
+  803052:	e8 bf e1 ff ff       	call   801216 <fd2data>
+  803057:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803059:	83 c4 10             	add    $0x10,%esp
+  80305c:	89 f3                	mov    %esi,%ebx
+  80305e:	83 e3 01             	and    $0x1,%ebx
+  803061:	75 27                	jne    80308a <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803063:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803069:	75 48                	jne    8030b3 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80306b:	89 ca                	mov    %ecx,%edx
+  80306d:	89 f8                	mov    %edi,%eax
+  80306f:	e8 ce fb ff ff       	call   802c42 <_pipeisclosed>
+  803074:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803076:	89 d8                	mov    %ebx,%eax
+  803078:	83 c8 10             	or     $0x10,%eax
+  80307b:	85 d2                	test   %edx,%edx
+  80307d:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803080:	89 d8                	mov    %ebx,%eax
+  803082:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803085:	5b                   	pop    %ebx
+  803086:	5e                   	pop    %esi
+  803087:	5f                   	pop    %edi
+  803088:	5d                   	pop    %ebp
+  803089:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80308a:	8b 58 04             	mov    0x4(%eax),%ebx
+  80308d:	8b 00                	mov    (%eax),%eax
+  80308f:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803095:	29 c3                	sub    %eax,%ebx
+  803097:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80309c:	89 d8                	mov    %ebx,%eax
+  80309e:	f7 e2                	mul    %edx
+  8030a0:	c1 ea 0c             	shr    $0xc,%edx
+  8030a3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8030a9:	39 d3                	cmp    %edx,%ebx
+  8030ab:	0f 95 c3             	setne  %bl
+  8030ae:	0f b6 db             	movzbl %bl,%ebx
+  8030b1:	eb b0                	jmp    803063 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030b3:	8b 71 04             	mov    0x4(%ecx),%esi
+  8030b6:	8b 01                	mov    (%ecx),%eax
+  8030b8:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8030be:	29 c6                	sub    %eax,%esi
+  8030c0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030c5:	89 f0                	mov    %esi,%eax
+  8030c7:	f7 e2                	mul    %edx
+  8030c9:	c1 ea 0c             	shr    $0xc,%edx
+  8030cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8030d2:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8030d4:	89 d8                	mov    %ebx,%eax
+  8030d6:	83 c8 04             	or     $0x4,%eax
+  8030d9:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8030df:	0f 42 d8             	cmovb  %eax,%ebx
+  8030e2:	eb 87                	jmp    80306b <devpipe_poll+0x29>
+
+008030e4 <pipe>:
+{
+  8030e4:	55                   	push   %ebp
+  8030e5:	89 e5                	mov    %esp,%ebp
+  8030e7:	56                   	push   %esi
+  8030e8:	53                   	push   %ebx
+  8030e9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ef:	50                   	push   %eax
+  8030f0:	e8 38 e1 ff ff       	call   80122d <fd_alloc>
+  8030f5:	89 c3                	mov    %eax,%ebx
+  8030f7:	83 c4 10             	add    $0x10,%esp
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	0f 88 23 01 00 00    	js     803225 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803102:	83 ec 04             	sub    $0x4,%esp
+  803105:	68 07 04 00 00       	push   $0x407
+  80310a:	ff 75 f4             	push   -0xc(%ebp)
+  80310d:	6a 00                	push   $0x0
+  80310f:	e8 8f dc ff ff       	call   800da3 <sys_page_alloc>
+  803114:	89 c3                	mov    %eax,%ebx
+  803116:	83 c4 10             	add    $0x10,%esp
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	0f 88 04 01 00 00    	js     803225 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803121:	83 ec 0c             	sub    $0xc,%esp
+  803124:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803127:	50                   	push   %eax
+  803128:	e8 00 e1 ff ff       	call   80122d <fd_alloc>
+  80312d:	89 c3                	mov    %eax,%ebx
+  80312f:	83 c4 10             	add    $0x10,%esp
+  803132:	85 c0                	test   %eax,%eax
+  803134:	0f 88 db 00 00 00    	js     803215 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80313a:	83 ec 04             	sub    $0x4,%esp
+  80313d:	68 07 04 00 00       	push   $0x407
+  803142:	ff 75 f0             	push   -0x10(%ebp)
+  803145:	6a 00                	push   $0x0
+  803147:	e8 57 dc ff ff       	call   800da3 <sys_page_alloc>
+  80314c:	89 c3                	mov    %eax,%ebx
+  80314e:	83 c4 10             	add    $0x10,%esp
+  803151:	85 c0                	test   %eax,%eax
+  803153:	0f 88 bc 00 00 00    	js     803215 <pipe+0x131>
+	va = fd2data(fd0);
+  803159:	83 ec 0c             	sub    $0xc,%esp
+  80315c:	ff 75 f4             	push   -0xc(%ebp)
+  80315f:	e8 b2 e0 ff ff       	call   801216 <fd2data>
+  803164:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803166:	83 c4 0c             	add    $0xc,%esp
+  803169:	68 07 04 00 00       	push   $0x407
+  80316e:	50                   	push   %eax
+  80316f:	6a 00                	push   $0x0
+  803171:	e8 2d dc ff ff       	call   800da3 <sys_page_alloc>
+  803176:	89 c3                	mov    %eax,%ebx
+  803178:	83 c4 10             	add    $0x10,%esp
+  80317b:	85 c0                	test   %eax,%eax
+  80317d:	0f 88 82 00 00 00    	js     803205 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803183:	83 ec 0c             	sub    $0xc,%esp
+  803186:	ff 75 f0             	push   -0x10(%ebp)
+  803189:	e8 88 e0 ff ff       	call   801216 <fd2data>
+  80318e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803195:	50                   	push   %eax
+  803196:	6a 00                	push   $0x0
+  803198:	56                   	push   %esi
+  803199:	6a 00                	push   $0x0
+  80319b:	e8 46 dc ff ff       	call   800de6 <sys_page_map>
+  8031a0:	89 c3                	mov    %eax,%ebx
+  8031a2:	83 c4 20             	add    $0x20,%esp
+  8031a5:	85 c0                	test   %eax,%eax
+  8031a7:	78 4e                	js     8031f7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8031a9:	a1 60 50 80 00       	mov    0x805060,%eax
+  8031ae:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8031b3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8031b6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8031bd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8031c0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8031c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8031c5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8031cc:	83 ec 0c             	sub    $0xc,%esp
+  8031cf:	ff 75 f4             	push   -0xc(%ebp)
+  8031d2:	e8 2f e0 ff ff       	call   801206 <fd2num>
+  8031d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031da:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8031dc:	83 c4 04             	add    $0x4,%esp
+  8031df:	ff 75 f0             	push   -0x10(%ebp)
+  8031e2:	e8 1f e0 ff ff       	call   801206 <fd2num>
+  8031e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031ea:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031ed:	83 c4 10             	add    $0x10,%esp
+  8031f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f5:	eb 2e                	jmp    803225 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031f7:	83 ec 08             	sub    $0x8,%esp
+  8031fa:	56                   	push   %esi
+  8031fb:	6a 00                	push   $0x0
+  8031fd:	e8 26 dc ff ff       	call   800e28 <sys_page_unmap>
+  803202:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803205:	83 ec 08             	sub    $0x8,%esp
+  803208:	ff 75 f0             	push   -0x10(%ebp)
+  80320b:	6a 00                	push   $0x0
+  80320d:	e8 16 dc ff ff       	call   800e28 <sys_page_unmap>
+  803212:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803215:	83 ec 08             	sub    $0x8,%esp
+  803218:	ff 75 f4             	push   -0xc(%ebp)
+  80321b:	6a 00                	push   $0x0
+  80321d:	e8 06 dc ff ff       	call   800e28 <sys_page_unmap>
+  803222:	83 c4 10             	add    $0x10,%esp
+}
+  803225:	89 d8                	mov    %ebx,%eax
+  803227:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80322a:	5b                   	pop    %ebx
+  80322b:	5e                   	pop    %esi
+  80322c:	5d                   	pop    %ebp
+  80322d:	c3                   	ret
+
+0080322e <pipeisclosed>:
+{
+  80322e:	55                   	push   %ebp
+  80322f:	89 e5                	mov    %esp,%ebp
+  803231:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803234:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803237:	50                   	push   %eax
+  803238:	ff 75 08             	push   0x8(%ebp)
+  80323b:	e8 3d e0 ff ff       	call   80127d <fd_lookup>
+  803240:	83 c4 10             	add    $0x10,%esp
+  803243:	85 c0                	test   %eax,%eax
+  803245:	78 18                	js     80325f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803247:	83 ec 0c             	sub    $0xc,%esp
+  80324a:	ff 75 f4             	push   -0xc(%ebp)
+  80324d:	e8 c4 df ff ff       	call   801216 <fd2data>
+  803252:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803254:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803257:	e8 e6 f9 ff ff       	call   802c42 <_pipeisclosed>
+  80325c:	83 c4 10             	add    $0x10,%esp
+}
+  80325f:	c9                   	leave
+  803260:	c3                   	ret
+
+00803261 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803261:	55                   	push   %ebp
+  803262:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803264:	8b 45 08             	mov    0x8(%ebp),%eax
+  803267:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80326d:	5d                   	pop    %ebp
+  80326e:	c3                   	ret
+
+0080326f <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80326f:	55                   	push   %ebp
+  803270:	89 e5                	mov    %esp,%ebp
+  803272:	53                   	push   %ebx
+  803273:	83 ec 04             	sub    $0x4,%esp
+  803276:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803279:	8b 03                	mov    (%ebx),%eax
+  80327b:	85 c0                	test   %eax,%eax
+  80327d:	75 05                	jne    803284 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80327f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803282:	c9                   	leave
+  803283:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803284:	83 ec 08             	sub    $0x8,%esp
+  803287:	50                   	push   %eax
+  803288:	8d 43 04             	lea    0x4(%ebx),%eax
+  80328b:	50                   	push   %eax
+  80328c:	e8 e7 dd ff ff       	call   801078 <sys_page_batch>
+	pb->pb_n = 0;
+  803291:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803297:	83 c4 10             	add    $0x10,%esp
+  80329a:	eb e3                	jmp    80327f <pgbatch_flush+0x10>
+
+0080329c <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80329c:	55                   	push   %ebp
+  80329d:	89 e5                	mov    %esp,%ebp
+  80329f:	56                   	push   %esi
+  8032a0:	53                   	push   %ebx
+  8032a1:	89 c3                	mov    %eax,%ebx
+  8032a3:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032a5:	83 38 20             	cmpl   $0x20,(%eax)
+  8032a8:	74 2c                	je     8032d6 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  8032aa:	8b 03                	mov    (%ebx),%eax
+  8032ac:	8d 50 01             	lea    0x1(%eax),%edx
+  8032af:	89 13                	mov    %edx,(%ebx)
+  8032b1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8032b4:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8032b8:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8032ba:	83 ec 04             	sub    $0x4,%esp
+  8032bd:	6a 18                	push   $0x18
+  8032bf:	6a 00                	push   $0x0
+  8032c1:	50                   	push   %eax
+  8032c2:	e8 23 d8 ff ff       	call   800aea <memset>
+	return 0;
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032d2:	5b                   	pop    %ebx
+  8032d3:	5e                   	pop    %esi
+  8032d4:	5d                   	pop    %ebp
+  8032d5:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8032d6:	83 ec 0c             	sub    $0xc,%esp
+  8032d9:	50                   	push   %eax
+  8032da:	e8 90 ff ff ff       	call   80326f <pgbatch_flush>
+  8032df:	83 c4 10             	add    $0x10,%esp
+  8032e2:	85 c0                	test   %eax,%eax
+  8032e4:	79 c4                	jns    8032aa <pgbatch_slot+0xe>
+  8032e6:	eb e7                	jmp    8032cf <pgbatch_slot+0x33>
+
+008032e8 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032e8:	55                   	push   %ebp
+  8032e9:	89 e5                	mov    %esp,%ebp
+  8032eb:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032ee:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f4:	e8 a3 ff ff ff       	call   80329c <pgbatch_slot>
+  8032f9:	85 c0                	test   %eax,%eax
+  8032fb:	78 20                	js     80331d <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8032fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803300:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803306:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803309:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  80330c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80330f:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803312:	8b 55 14             	mov    0x14(%ebp),%edx
+  803315:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803318:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331d:	c9                   	leave
+  80331e:	c3                   	ret
+
+0080331f <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+  803322:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803325:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803328:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332b:	e8 6c ff ff ff       	call   80329c <pgbatch_slot>
+  803330:	85 c0                	test   %eax,%eax
+  803332:	78 2c                	js     803360 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803334:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803337:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80333d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803340:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803343:	8b 55 10             	mov    0x10(%ebp),%edx
+  803346:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803349:	8b 55 14             	mov    0x14(%ebp),%edx
+  80334c:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80334f:	8b 55 18             	mov    0x18(%ebp),%edx
+  803352:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803355:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803358:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80335b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+00803362 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803362:	55                   	push   %ebp
+  803363:	89 e5                	mov    %esp,%ebp
+  803365:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803368:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80336b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80336e:	e8 29 ff ff ff       	call   80329c <pgbatch_slot>
+  803373:	85 c0                	test   %eax,%eax
+  803375:	78 1a                	js     803391 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803377:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80337a:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803380:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803383:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803386:	8b 55 10             	mov    0x10(%ebp),%edx
+  803389:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80338c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803391:	c9                   	leave
+  803392:	c3                   	ret
+
+00803393 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803393:	55                   	push   %ebp
+  803394:	89 e5                	mov    %esp,%ebp
+  803396:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803399:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80339c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80339f:	e8 f8 fe ff ff       	call   80329c <pgbatch_slot>
+  8033a4:	85 c0                	test   %eax,%eax
+  8033a6:	78 20                	js     8033c8 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  8033a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ab:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8033b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033b4:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033b7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033ba:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8033bd:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033c0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c8:	c9                   	leave
+  8033c9:	c3                   	ret
+
+008033ca <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8033ca:	55                   	push   %ebp
+  8033cb:	89 e5                	mov    %esp,%ebp
+  8033cd:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033d0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033d6:	e8 c1 fe ff ff       	call   80329c <pgbatch_slot>
+  8033db:	85 c0                	test   %eax,%eax
+  8033dd:	78 26                	js     803405 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8033df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033e2:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8033e8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033eb:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8033ee:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033f1:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8033f4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033f7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8033fa:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033fd:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803400:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803405:	c9                   	leave
+  803406:	c3                   	ret
+
+00803407 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340c:	c3                   	ret
+
+0080340d <devcons_poll>:
+{
+  80340d:	55                   	push   %ebp
+  80340e:	89 e5                	mov    %esp,%ebp
+  803410:	53                   	push   %ebx
+  803411:	83 ec 04             	sub    $0x4,%esp
+  803414:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803417:	89 da                	mov    %ebx,%edx
+  803419:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80341c:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803423:	74 0c                	je     803431 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803425:	89 d8                	mov    %ebx,%eax
+  803427:	83 e0 01             	and    $0x1,%eax
+  80342a:	09 d0                	or     %edx,%eax
+}
+  80342c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80342f:	c9                   	leave
+  803430:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803431:	e8 cf d8 ff ff       	call   800d05 <sys_cgetc>
+  803436:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80343b:	89 da                	mov    %ebx,%edx
+  80343d:	83 e2 04             	and    $0x4,%edx
+  803440:	85 c0                	test   %eax,%eax
+  803442:	74 e6                	je     80342a <devcons_poll+0x1d>
+  803444:	eb df                	jmp    803425 <devcons_poll+0x18>
+
+00803446 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803446:	55                   	push   %ebp
+  803447:	89 e5                	mov    %esp,%ebp
+  803449:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80344c:	68 1e 40 80 00       	push   $0x80401e
+  803451:	ff 75 0c             	push   0xc(%ebp)
+  803454:	e8 16 d5 ff ff       	call   80096f <strcpy>
+	return 0;
+}
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	c9                   	leave
+  80345f:	c3                   	ret
+
+00803460 <devcons_write>:
+{
+  803460:	55                   	push   %ebp
+  803461:	89 e5                	mov    %esp,%ebp
+  803463:	57                   	push   %edi
+  803464:	56                   	push   %esi
+  803465:	53                   	push   %ebx
+  803466:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80346c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80346f:	85 ff                	test   %edi,%edi
+  803471:	74 51                	je     8034c4 <devcons_write+0x64>
+  803473:	be 00 00 00 00       	mov    $0x0,%esi
+  803478:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80347d:	89 fb                	mov    %edi,%ebx
+  80347f:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803481:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803486:	39 d3                	cmp    %edx,%ebx
+  803488:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80348b:	83 ec 04             	sub    $0x4,%esp
+  80348e:	53                   	push   %ebx
+  80348f:	03 45 0c             	add    0xc(%ebp),%eax
+  803492:	50                   	push   %eax
+  803493:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803499:	50                   	push   %eax
+  80349a:	e8 80 d6 ff ff       	call   800b1f <memmove>
+		sys_cputs(buf, m);
+  80349f:	83 c4 08             	add    $0x8,%esp
+  8034a2:	53                   	push   %ebx
+  8034a3:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8034a9:	50                   	push   %eax
+  8034aa:	e8 38 d8 ff ff       	call   800ce7 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8034af:	01 de                	add    %ebx,%esi
+  8034b1:	89 f0                	mov    %esi,%eax
+  8034b3:	83 c4 10             	add    $0x10,%esp
+  8034b6:	39 fe                	cmp    %edi,%esi
+  8034b8:	72 c3                	jb     80347d <devcons_write+0x1d>
+}
+  8034ba:	89 f0                	mov    %esi,%eax
+  8034bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034bf:	5b                   	pop    %ebx
+  8034c0:	5e                   	pop    %esi
+  8034c1:	5f                   	pop    %edi
+  8034c2:	5d                   	pop    %ebp
+  8034c3:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8034c4:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8034c9:	eb ef                	jmp    8034ba <devcons_write+0x5a>
+
+008034cb <devcons_read>:
+{
+  8034cb:	55                   	push   %ebp
+  8034cc:	89 e5                	mov    %esp,%ebp
+  8034ce:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8034d1:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8034d6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034da:	74 36                	je     803512 <devcons_read+0x47>
+	c = cons_peek;
+  8034dc:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8034e1:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8034e8:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034eb:	85 c0                	test   %eax,%eax
+  8034ed:	75 10                	jne    8034ff <devcons_read+0x34>
+  8034ef:	e8 11 d8 ff ff       	call   800d05 <sys_cgetc>
+  8034f4:	85 c0                	test   %eax,%eax
+  8034f6:	75 07                	jne    8034ff <devcons_read+0x34>
+		sys_yield();
+  8034f8:	e8 87 d8 ff ff       	call   800d84 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034fd:	eb f0                	jmp    8034ef <devcons_read+0x24>
+	if (c < 0)
+  8034ff:	85 c0                	test   %eax,%eax
+  803501:	78 0f                	js     803512 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  803503:	83 f8 04             	cmp    $0x4,%eax
+  803506:	74 0c                	je     803514 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  803508:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80350b:	88 02                	mov    %al,(%edx)
+	return 1;
+  80350d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803512:	c9                   	leave
+  803513:	c3                   	ret
+		return 0;
+  803514:	b8 00 00 00 00       	mov    $0x0,%eax
+  803519:	eb f7                	jmp    803512 <devcons_read+0x47>
+
+0080351b <cputchar>:
+{
+  80351b:	55                   	push   %ebp
+  80351c:	89 e5                	mov    %esp,%ebp
+  80351e:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803521:	8b 45 08             	mov    0x8(%ebp),%eax
+  803524:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803527:	6a 01                	push   $0x1
+  803529:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80352c:	50                   	push   %eax
+  80352d:	e8 b5 d7 ff ff       	call   800ce7 <sys_cputs>
+}
+  803532:	83 c4 10             	add    $0x10,%esp
+  803535:	c9                   	leave
+  803536:	c3                   	ret
+
+00803537 <getchar>:
+{
+  803537:	55                   	push   %ebp
+  803538:	89 e5                	mov    %esp,%ebp
+  80353a:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80353d:	6a 01                	push   $0x1
+  80353f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803542:	50                   	push   %eax
+  803543:	6a 00                	push   $0x0
+  803545:	e8 b7 df ff ff       	call   801501 <read>
+	if (r < 0)
+  80354a:	83 c4 10             	add    $0x10,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	78 06                	js     803557 <getchar+0x20>
+	if (r < 1)
+  803551:	74 06                	je     803559 <getchar+0x22>
+	return c;
+  803553:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803557:	c9                   	leave
+  803558:	c3                   	ret
+		return -E_EOF;
+  803559:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80355e:	eb f7                	jmp    803557 <getchar+0x20>
+
+00803560 <iscons>:
+{
+  803560:	55                   	push   %ebp
+  803561:	89 e5                	mov    %esp,%ebp
+  803563:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803566:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803569:	50                   	push   %eax
+  80356a:	ff 75 08             	push   0x8(%ebp)
+  80356d:	e8 0b dd ff ff       	call   80127d <fd_lookup>
+  803572:	83 c4 10             	add    $0x10,%esp
+  803575:	85 c0                	test   %eax,%eax
+  803577:	78 11                	js     80358a <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803579:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803582:	39 10                	cmp    %edx,(%eax)
+  803584:	0f 94 c0             	sete   %al
+  803587:	0f b6 c0             	movzbl %al,%eax
+}
+  80358a:	c9                   	leave
+  80358b:	c3                   	ret
+
+0080358c <opencons>:
+{
+  80358c:	55                   	push   %ebp
+  80358d:	89 e5                	mov    %esp,%ebp
+  80358f:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803592:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803595:	50                   	push   %eax
+  803596:	e8 92 dc ff ff       	call   80122d <fd_alloc>
+  80359b:	83 c4 10             	add    $0x10,%esp
+  80359e:	85 c0                	test   %eax,%eax
+  8035a0:	78 3a                	js     8035dc <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035a2:	83 ec 04             	sub    $0x4,%esp
+  8035a5:	68 07 04 00 00       	push   $0x407
+  8035aa:	ff 75 f4             	push   -0xc(%ebp)
+  8035ad:	6a 00                	push   $0x0
+  8035af:	e8 ef d7 ff ff       	call   800da3 <sys_page_alloc>
+  8035b4:	83 c4 10             	add    $0x10,%esp
+  8035b7:	85 c0                	test   %eax,%eax
+  8035b9:	78 21                	js     8035dc <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8035bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035be:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8035c4:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8035c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8035d0:	83 ec 0c             	sub    $0xc,%esp
+  8035d3:	50                   	push   %eax
+  8035d4:	e8 2d dc ff ff       	call   801206 <fd2num>
+  8035d9:	83 c4 10             	add    $0x10,%esp
+}
+  8035dc:	c9                   	leave
+  8035dd:	c3                   	ret
+
+008035de <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035de:	55                   	push   %ebp
+  8035df:	89 e5                	mov    %esp,%ebp
+  8035e1:	56                   	push   %esi
+  8035e2:	53                   	push   %ebx
+  8035e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035ec:	85 c0                	test   %eax,%eax
+  8035ee:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035f3:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035f6:	83 ec 0c             	sub    $0xc,%esp
+  8035f9:	50                   	push   %eax
+  8035fa:	e8 54 d9 ff ff       	call   800f53 <sys_ipc_recv>
+  8035ff:	83 c4 10             	add    $0x10,%esp
+  803602:	85 c0                	test   %eax,%eax
+  803604:	0f 88 8b 00 00 00    	js     803695 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80360a:	85 f6                	test   %esi,%esi
+  80360c:	74 2a                	je     803638 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80360e:	89 e2                	mov    %esp,%edx
+  803610:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803615:	29 d0                	sub    %edx,%eax
+  803617:	89 c2                	mov    %eax,%edx
+  803619:	c1 ea 0f             	shr    $0xf,%edx
+  80361c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803621:	b8 00 00 00 00       	mov    $0x0,%eax
+  803626:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803629:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803630:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803636:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803638:	85 db                	test   %ebx,%ebx
+  80363a:	74 2a                	je     803666 <ipc_recv+0x88>
+  80363c:	89 e2                	mov    %esp,%edx
+  80363e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803643:	29 d0                	sub    %edx,%eax
+  803645:	89 c2                	mov    %eax,%edx
+  803647:	c1 ea 0f             	shr    $0xf,%edx
+  80364a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803657:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80365e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803664:	89 03                	mov    %eax,(%ebx)
+  803666:	89 e2                	mov    %esp,%edx
+  803668:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80366d:	29 d0                	sub    %edx,%eax
+  80366f:	89 c2                	mov    %eax,%edx
+  803671:	c1 ea 0f             	shr    $0xf,%edx
+  803674:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803681:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803688:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80368e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803691:	5b                   	pop    %ebx
+  803692:	5e                   	pop    %esi
+  803693:	5d                   	pop    %ebp
+  803694:	c3                   	ret
+		if(from_env_store != NULL)
+  803695:	85 f6                	test   %esi,%esi
+  803697:	74 06                	je     80369f <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803699:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80369f:	85 db                	test   %ebx,%ebx
+  8036a1:	74 eb                	je     80368e <ipc_recv+0xb0>
+			*perm_store = 0;
+  8036a3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036a9:	eb e3                	jmp    80368e <ipc_recv+0xb0>
+
+008036ab <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8036ab:	55                   	push   %ebp
+  8036ac:	89 e5                	mov    %esp,%ebp
+  8036ae:	57                   	push   %edi
+  8036af:	56                   	push   %esi
+  8036b0:	53                   	push   %ebx
+  8036b1:	83 ec 14             	sub    $0x14,%esp
+  8036b4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036ba:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036bd:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036c0:	85 c0                	test   %eax,%eax
+  8036c2:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036c7:	0f 44 c2             	cmove  %edx,%eax
+  8036ca:	ff 75 10             	push   0x10(%ebp)
+  8036cd:	50                   	push   %eax
+  8036ce:	e8 e2 d8 ff ff       	call   800fb5 <sys_ipc_recv_pages>
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	0f 88 ba 00 00 00    	js     803798 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036de:	85 ff                	test   %edi,%edi
+  8036e0:	74 2a                	je     80370c <ipc_recv_pages+0x61>
+  8036e2:	89 e2                	mov    %esp,%edx
+  8036e4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036e9:	29 d0                	sub    %edx,%eax
+  8036eb:	89 c2                	mov    %eax,%edx
+  8036ed:	c1 ea 0f             	shr    $0xf,%edx
+  8036f0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fa:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8036fd:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803704:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80370a:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  80370c:	85 f6                	test   %esi,%esi
+  80370e:	74 2a                	je     80373a <ipc_recv_pages+0x8f>
+  803710:	89 e2                	mov    %esp,%edx
+  803712:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803717:	29 d0                	sub    %edx,%eax
+  803719:	89 c2                	mov    %eax,%edx
+  80371b:	c1 ea 0f             	shr    $0xf,%edx
+  80371e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803723:	b8 00 00 00 00       	mov    $0x0,%eax
+  803728:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80372b:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803732:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803738:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80373a:	85 db                	test   %ebx,%ebx
+  80373c:	74 2a                	je     803768 <ipc_recv_pages+0xbd>
+  80373e:	89 e2                	mov    %esp,%edx
+  803740:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803745:	29 d0                	sub    %edx,%eax
+  803747:	89 c2                	mov    %eax,%edx
+  803749:	c1 ea 0f             	shr    $0xf,%edx
+  80374c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803751:	b8 00 00 00 00       	mov    $0x0,%eax
+  803756:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803759:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803760:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803766:	89 03                	mov    %eax,(%ebx)
+  803768:	89 e2                	mov    %esp,%edx
+  80376a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80376f:	29 d0                	sub    %edx,%eax
+  803771:	89 c2                	mov    %eax,%edx
+  803773:	c1 ea 0f             	shr    $0xf,%edx
+  803776:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80377b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803780:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803783:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80378a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803793:	5b                   	pop    %ebx
+  803794:	5e                   	pop    %esi
+  803795:	5f                   	pop    %edi
+  803796:	5d                   	pop    %ebp
+  803797:	c3                   	ret
+		if (from_env_store)
+  803798:	85 ff                	test   %edi,%edi
+  80379a:	74 06                	je     8037a2 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80379c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8037a2:	85 f6                	test   %esi,%esi
+  8037a4:	74 06                	je     8037ac <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8037a6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8037ac:	85 db                	test   %ebx,%ebx
+  8037ae:	74 e0                	je     803790 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037b0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037b6:	eb d8                	jmp    803790 <ipc_recv_pages+0xe5>
+
+008037b8 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037b8:	55                   	push   %ebp
+  8037b9:	89 e5                	mov    %esp,%ebp
+  8037bb:	57                   	push   %edi
+  8037bc:	56                   	push   %esi
+  8037bd:	53                   	push   %ebx
+  8037be:	83 ec 1c             	sub    $0x1c,%esp
+  8037c1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037c4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037c7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037cd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037d1:	75 2b                	jne    8037fe <ipc_try_send_pages+0x46>
+  8037d3:	89 e2                	mov    %esp,%edx
+  8037d5:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037da:	29 d0                	sub    %edx,%eax
+  8037dc:	89 c2                	mov    %eax,%edx
+  8037de:	c1 ea 0f             	shr    $0xf,%edx
+  8037e1:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037eb:	0f 42 c2             	cmovb  %edx,%eax
+  8037ee:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037f5:	8b 70 48             	mov    0x48(%eax),%esi
+  8037f8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037fe:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803804:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  803809:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80380c:	85 ff                	test   %edi,%edi
+  80380e:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803813:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803816:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80381c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803822:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803828:	83 ec 0c             	sub    $0xc,%esp
+  80382b:	ff 75 14             	push   0x14(%ebp)
+  80382e:	ff 75 18             	push   0x18(%ebp)
+  803831:	57                   	push   %edi
+  803832:	ff 75 0c             	push   0xc(%ebp)
+  803835:	ff 75 08             	push   0x8(%ebp)
+  803838:	e8 57 d7 ff ff       	call   800f94 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80383d:	83 c4 20             	add    $0x20,%esp
+  803840:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803843:	75 21                	jne    803866 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803845:	83 ec 04             	sub    $0x4,%esp
+  803848:	6a ff                	push   $0xffffffff
+  80384a:	53                   	push   %ebx
+  80384b:	ff 75 e4             	push   -0x1c(%ebp)
+  80384e:	e8 4e d9 ff ff       	call   8011a1 <sys_futex_wait>
+  803853:	83 c4 10             	add    $0x10,%esp
+  803856:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803859:	74 c7                	je     803822 <ipc_try_send_pages+0x6a>
+  80385b:	85 c0                	test   %eax,%eax
+  80385d:	79 c3                	jns    803822 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80385f:	e8 20 d5 ff ff       	call   800d84 <sys_yield>
+  803864:	eb bc                	jmp    803822 <ipc_try_send_pages+0x6a>
+	}
+}
+  803866:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803869:	5b                   	pop    %ebx
+  80386a:	5e                   	pop    %esi
+  80386b:	5f                   	pop    %edi
+  80386c:	5d                   	pop    %ebp
+  80386d:	c3                   	ret
+
+0080386e <ipc_send>:
+{
+  80386e:	55                   	push   %ebp
+  80386f:	89 e5                	mov    %esp,%ebp
+  803871:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803874:	ff 75 14             	push   0x14(%ebp)
+  803877:	6a 01                	push   $0x1
+  803879:	ff 75 10             	push   0x10(%ebp)
+  80387c:	ff 75 0c             	push   0xc(%ebp)
+  80387f:	ff 75 08             	push   0x8(%ebp)
+  803882:	e8 31 ff ff ff       	call   8037b8 <ipc_try_send_pages>
+  803887:	83 c4 20             	add    $0x20,%esp
+  80388a:	85 c0                	test   %eax,%eax
+  80388c:	78 02                	js     803890 <ipc_send+0x22>
+}
+  80388e:	c9                   	leave
+  80388f:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803890:	50                   	push   %eax
+  803891:	68 2a 40 80 00       	push   $0x80402a
+  803896:	6a 3f                	push   $0x3f
+  803898:	68 3f 40 80 00       	push   $0x80403f
+  80389d:	e8 fb c8 ff ff       	call   80019d <_panic>
+
+008038a2 <ipc_send_pages>:
+{
+  8038a2:	55                   	push   %ebp
+  8038a3:	89 e5                	mov    %esp,%ebp
+  8038a5:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8038a8:	ff 75 18             	push   0x18(%ebp)
+  8038ab:	ff 75 14             	push   0x14(%ebp)
+  8038ae:	ff 75 10             	push   0x10(%ebp)
+  8038b1:	ff 75 0c             	push   0xc(%ebp)
+  8038b4:	ff 75 08             	push   0x8(%ebp)
+  8038b7:	e8 fc fe ff ff       	call   8037b8 <ipc_try_send_pages>
+  8038bc:	83 c4 20             	add    $0x20,%esp
+  8038bf:	85 c0                	test   %eax,%eax
+  8038c1:	78 02                	js     8038c5 <ipc_send_pages+0x23>
+}
+  8038c3:	c9                   	leave
+  8038c4:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038c5:	50                   	push   %eax
+  8038c6:	68 49 40 80 00       	push   $0x804049
+  8038cb:	6a 64                	push   $0x64
+  8038cd:	68 3f 40 80 00       	push   $0x80403f
+  8038d2:	e8 c6 c8 ff ff       	call   80019d <_panic>
+
+008038d7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038d7:	55                   	push   %ebp
+  8038d8:	89 e5                	mov    %esp,%ebp
+  8038da:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038dd:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038e2:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038e8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038ee:	8b 52 50             	mov    0x50(%edx),%edx
+  8038f1:	39 ca                	cmp    %ecx,%edx
+  8038f3:	74 11                	je     803906 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038f5:	83 c0 01             	add    $0x1,%eax
+  8038f8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8038fd:	75 e3                	jne    8038e2 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8038ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803904:	eb 0e                	jmp    803914 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803906:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80390c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803911:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803914:	5d                   	pop    %ebp
+  803915:	c3                   	ret
+
+00803916 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803916:	55                   	push   %ebp
+  803917:	89 e5                	mov    %esp,%ebp
+  803919:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  80391c:	89 c2                	mov    %eax,%edx
+  80391e:	c1 ea 16             	shr    $0x16,%edx
+  803921:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803928:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  80392d:	f6 c1 01             	test   $0x1,%cl
+  803930:	74 1e                	je     803950 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803932:	c1 e8 0c             	shr    $0xc,%eax
+  803935:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80393c:	a8 01                	test   $0x1,%al
+  80393e:	74 10                	je     803950 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803940:	c1 e8 0c             	shr    $0xc,%eax
+  803943:	c1 e0 04             	shl    $0x4,%eax
+  803946:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  80394d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803950:	89 d0                	mov    %edx,%eax
+  803952:	5d                   	pop    %ebp
+  803953:	c3                   	ret
+
+00803954 <__udivdi3>:
+  803954:	57                   	push   %edi
+  803955:	56                   	push   %esi
+  803956:	53                   	push   %ebx
+  803957:	83 ec 20             	sub    $0x20,%esp
+  80395a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  80395e:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803962:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803966:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80396a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80396e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803972:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803976:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80397a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80397f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803984:	ba 00 00 00 00       	mov    $0x0,%edx
+  803989:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803990:	00 
+  803991:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803998:	00 
+  803999:	eb 08                	jmp    8039a3 <__udivdi3+0x4f>
+  80399b:	83 e9 01             	sub    $0x1,%ecx
+  80399e:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039a1:	74 68                	je     803a0b <__udivdi3+0xb7>
+  8039a3:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039a7:	01 c0                	add    %eax,%eax
+  8039a9:	89 c6                	mov    %eax,%esi
+  8039ab:	89 d7                	mov    %edx,%edi
+  8039ad:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039b5:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039b8:	d3 ea                	shr    %cl,%edx
+  8039ba:	f6 c1 20             	test   $0x20,%cl
+  8039bd:	74 04                	je     8039c3 <__udivdi3+0x6f>
+  8039bf:	89 d0                	mov    %edx,%eax
+  8039c1:	31 d2                	xor    %edx,%edx
+  8039c3:	83 e0 01             	and    $0x1,%eax
+  8039c6:	89 04 24             	mov    %eax,(%esp)
+  8039c9:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039d0:	00 
+  8039d1:	8b 04 24             	mov    (%esp),%eax
+  8039d4:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039d8:	09 f0                	or     %esi,%eax
+  8039da:	09 fa                	or     %edi,%edx
+  8039dc:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039e0:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039e4:	39 f0                	cmp    %esi,%eax
+  8039e6:	89 d3                	mov    %edx,%ebx
+  8039e8:	19 fb                	sbb    %edi,%ebx
+  8039ea:	72 af                	jb     80399b <__udivdi3+0x47>
+  8039ec:	29 f0                	sub    %esi,%eax
+  8039ee:	19 fa                	sbb    %edi,%edx
+  8039f0:	89 cf                	mov    %ecx,%edi
+  8039f2:	c1 ef 05             	shr    $0x5,%edi
+  8039f5:	83 e7 01             	and    $0x1,%edi
+  8039f8:	89 fe                	mov    %edi,%esi
+  8039fa:	83 f6 01             	xor    $0x1,%esi
+  8039fd:	d3 e6                	shl    %cl,%esi
+  8039ff:	d3 e7                	shl    %cl,%edi
+  803a01:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a05:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a09:	eb 90                	jmp    80399b <__udivdi3+0x47>
+  803a0b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a0f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a13:	83 c4 20             	add    $0x20,%esp
+  803a16:	5b                   	pop    %ebx
+  803a17:	5e                   	pop    %esi
+  803a18:	5f                   	pop    %edi
+  803a19:	c3                   	ret
+
+00803a1a <__umoddi3>:
+  803a1a:	57                   	push   %edi
+  803a1b:	56                   	push   %esi
+  803a1c:	53                   	push   %ebx
+  803a1d:	83 ec 08             	sub    $0x8,%esp
+  803a20:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a24:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a28:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a2c:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a30:	57                   	push   %edi
+  803a31:	56                   	push   %esi
+  803a32:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a36:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a3a:	52                   	push   %edx
+  803a3b:	50                   	push   %eax
+  803a3c:	e8 13 ff ff ff       	call   803954 <__udivdi3>
+  803a41:	89 c3                	mov    %eax,%ebx
+  803a43:	0f af d6             	imul   %esi,%edx
+  803a46:	89 f9                	mov    %edi,%ecx
+  803a48:	0f af cb             	imul   %ebx,%ecx
+  803a4b:	01 d1                	add    %edx,%ecx
+  803a4d:	89 d8                	mov    %ebx,%eax
+  803a4f:	f7 e6                	mul    %esi
+  803a51:	89 c6                	mov    %eax,%esi
+  803a53:	89 d7                	mov    %edx,%edi
+  803a55:	01 cf                	add    %ecx,%edi
+  803a57:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a5b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a5f:	29 f0                	sub    %esi,%eax
+  803a61:	19 fa                	sbb    %edi,%edx
+  803a63:	83 c4 18             	add    $0x18,%esp
+  803a66:	5b                   	pop    %ebx
+  803a67:	5e                   	pop    %esi
+  803a68:	5f                   	pop    %edi
+  803a69:	c3                   	ret
+
+00803a6a <__divdi3>:
+  803a6a:	53                   	push   %ebx
+  803a6b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a6f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a73:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a77:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a7b:	85 d2                	test   %edx,%edx
+  803a7d:	78 12                	js     803a91 <__divdi3+0x27>
+  803a7f:	85 db                	test   %ebx,%ebx
+  803a81:	78 2e                	js     803ab1 <__divdi3+0x47>
+  803a83:	53                   	push   %ebx
+  803a84:	51                   	push   %ecx
+  803a85:	52                   	push   %edx
+  803a86:	50                   	push   %eax
+  803a87:	e8 c8 fe ff ff       	call   803954 <__udivdi3>
+  803a8c:	83 c4 10             	add    $0x10,%esp
+  803a8f:	eb 1e                	jmp    803aaf <__divdi3+0x45>
+  803a91:	f7 d8                	neg    %eax
+  803a93:	83 d2 00             	adc    $0x0,%edx
+  803a96:	f7 da                	neg    %edx
+  803a98:	85 db                	test   %ebx,%ebx
+  803a9a:	78 2a                	js     803ac6 <__divdi3+0x5c>
+  803a9c:	53                   	push   %ebx
+  803a9d:	51                   	push   %ecx
+  803a9e:	52                   	push   %edx
+  803a9f:	50                   	push   %eax
+  803aa0:	e8 af fe ff ff       	call   803954 <__udivdi3>
+  803aa5:	83 c4 10             	add    $0x10,%esp
+  803aa8:	f7 d8                	neg    %eax
+  803aaa:	83 d2 00             	adc    $0x0,%edx
+  803aad:	f7 da                	neg    %edx
+  803aaf:	5b                   	pop    %ebx
+  803ab0:	c3                   	ret
+  803ab1:	f7 d9                	neg    %ecx
+  803ab3:	83 d3 00             	adc    $0x0,%ebx
+  803ab6:	f7 db                	neg    %ebx
+  803ab8:	53                   	push   %ebx
+  803ab9:	51                   	push   %ecx
+  803aba:	52                   	push   %edx
+  803abb:	50                   	push   %eax
+  803abc:	e8 93 fe ff ff       	call   803954 <__udivdi3>
+  803ac1:	83 c4 10             	add    $0x10,%esp
+  803ac4:	eb e2                	jmp    803aa8 <__divdi3+0x3e>
+  803ac6:	f7 d9                	neg    %ecx
+  803ac8:	83 d3 00             	adc    $0x0,%ebx
+  803acb:	f7 db                	neg    %ebx
+  803acd:	53                   	push   %ebx
+  803ace:	51                   	push   %ecx
+  803acf:	52                   	push   %edx
+  803ad0:	50                   	push   %eax
+  803ad1:	e8 7e fe ff ff       	call   803954 <__udivdi3>
+  803ad6:	83 c4 10             	add    $0x10,%esp
+  803ad9:	eb d4                	jmp    803aaf <__divdi3+0x45>
+
+00803adb <__moddi3>:
+  803adb:	57                   	push   %edi
+  803adc:	56                   	push   %esi
+  803add:	53                   	push   %ebx
+  803ade:	83 ec 08             	sub    $0x8,%esp
+  803ae1:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ae5:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ae9:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803aed:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803af1:	57                   	push   %edi
+  803af2:	56                   	push   %esi
+  803af3:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803af7:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803afb:	52                   	push   %edx
+  803afc:	50                   	push   %eax
+  803afd:	e8 68 ff ff ff       	call   803a6a <__divdi3>
+  803b02:	89 c3                	mov    %eax,%ebx
+  803b04:	0f af d6             	imul   %esi,%edx
+  803b07:	89 f9                	mov    %edi,%ecx
+  803b09:	0f af cb             	imul   %ebx,%ecx
+  803b0c:	01 d1                	add    %edx,%ecx
+  803b0e:	89 d8                	mov    %ebx,%eax
+  803b10:	f7 e6                	mul    %esi
+  803b12:	89 c6                	mov    %eax,%esi
+  803b14:	89 d7                	mov    %edx,%edi
+  803b16:	01 cf                	add    %ecx,%edi
+  803b18:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b1c:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b20:	29 f0                	sub    %esi,%eax
+  803b22:	19 fa                	sbb    %edi,%edx
+  803b24:	83 c4 18             	add    $0x18,%esp
+  803b27:	5b                   	pop    %ebx
+  803b28:	5e                   	pop    %esi
+  803b29:	5f                   	pop    %edi
+  803b2a:	c3                   	ret
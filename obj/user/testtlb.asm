@@ -0,0 +1,9314 @@
+
+obj/user/testtlb.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 da 02 00 00       	call   80030b <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <remap>:
+
+// Fill the parent's copy 'set' of the npages pages with 'gen' and map
+// it at TARGET in 'env', then tell the child what to expect.
+static void
+remap(envid_t env, int set, int npages, uint32_t gen)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	81 ec 38 03 00 00    	sub    $0x338,%esp
+  800041:	89 85 d0 fc ff ff    	mov    %eax,-0x330(%ebp)
+  800047:	89 d3                	mov    %edx,%ebx
+  800049:	89 cf                	mov    %ecx,%edi
+  80004b:	89 8d d4 fc ff ff    	mov    %ecx,-0x32c(%ebp)
+	struct PageBatch pb;
+	char *pg;
+	int i, r;
+
+	pgbatch_init(&pb);
+  800051:	8d 85 e4 fc ff ff    	lea    -0x31c(%ebp),%eax
+  800057:	50                   	push   %eax
+  800058:	e8 f7 3b 00 00       	call   803c54 <pgbatch_init>
+	for (i = 0; i < npages; i++) {
+  80005d:	83 c4 10             	add    $0x10,%esp
+  800060:	85 ff                	test   %edi,%edi
+  800062:	7e 50                	jle    8000b4 <remap+0x7f>
+  800064:	c1 e3 12             	shl    $0x12,%ebx
+  800067:	81 c3 00 00 00 40    	add    $0x40000000,%ebx
+  80006d:	be 00 00 00 00       	mov    $0x0,%esi
+		pg = PAGES + (set * NBULK + i) * PGSIZE;
+		*(uint32_t *) pg = gen;
+		if ((r = pgbatch_map(&pb, 0, pg, env, TARGET + i * PGSIZE,
+  800072:	8d bd e4 fc ff ff    	lea    -0x31c(%ebp),%edi
+		*(uint32_t *) pg = gen;
+  800078:	8b 45 08             	mov    0x8(%ebp),%eax
+  80007b:	89 03                	mov    %eax,(%ebx)
+		if ((r = pgbatch_map(&pb, 0, pg, env, TARGET + i * PGSIZE,
+  80007d:	83 ec 08             	sub    $0x8,%esp
+  800080:	6a 05                	push   $0x5
+  800082:	89 f0                	mov    %esi,%eax
+  800084:	c1 e0 0c             	shl    $0xc,%eax
+  800087:	05 00 00 00 30       	add    $0x30000000,%eax
+  80008c:	50                   	push   %eax
+  80008d:	ff b5 d0 fc ff ff    	push   -0x330(%ebp)
+  800093:	53                   	push   %ebx
+  800094:	6a 00                	push   $0x0
+  800096:	57                   	push   %edi
+  800097:	e8 76 3c 00 00       	call   803d12 <pgbatch_map>
+  80009c:	83 c4 20             	add    $0x20,%esp
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 42                	js     8000e5 <remap+0xb0>
+	for (i = 0; i < npages; i++) {
+  8000a3:	83 c6 01             	add    $0x1,%esi
+  8000a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8000ac:	39 b5 d4 fc ff ff    	cmp    %esi,-0x32c(%ebp)
+  8000b2:	75 c4                	jne    800078 <remap+0x43>
+				     PTE_P | PTE_U)) < 0)
+			panic("pgbatch_map: %e", r);
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+  8000b4:	83 ec 0c             	sub    $0xc,%esp
+  8000b7:	8d 85 e4 fc ff ff    	lea    -0x31c(%ebp),%eax
+  8000bd:	50                   	push   %eax
+  8000be:	e8 9f 3b 00 00       	call   803c62 <pgbatch_flush>
+  8000c3:	83 c4 10             	add    $0x10,%esp
+  8000c6:	85 c0                	test   %eax,%eax
+  8000c8:	78 2d                	js     8000f7 <remap+0xc2>
+		panic("remap: %e", r);
+	// The mapping change reached the child's CPU before we returned.
+	CTL->npages = npages;
+  8000ca:	8b 85 d4 fc ff ff    	mov    -0x32c(%ebp),%eax
+  8000d0:	a3 04 f0 ff 0f       	mov    %eax,0xffff004
+	CTL->gen = gen;
+  8000d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8000d8:	a3 00 f0 ff 0f       	mov    %eax,0xffff000
+}
+  8000dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e0:	5b                   	pop    %ebx
+  8000e1:	5e                   	pop    %esi
+  8000e2:	5f                   	pop    %edi
+  8000e3:	5d                   	pop    %ebp
+  8000e4:	c3                   	ret
+			panic("pgbatch_map: %e", r);
+  8000e5:	50                   	push   %eax
+  8000e6:	68 20 47 80 00       	push   $0x804720
+  8000eb:	6a 3b                	push   $0x3b
+  8000ed:	68 30 47 80 00       	push   $0x804730
+  8000f2:	e8 bb 02 00 00       	call   8003b2 <_panic>
+		panic("remap: %e", r);
+  8000f7:	50                   	push   %eax
+  8000f8:	68 3f 47 80 00       	push   $0x80473f
+  8000fd:	6a 3e                	push   $0x3e
+  8000ff:	68 30 47 80 00       	push   $0x804730
+  800104:	e8 a9 02 00 00       	call   8003b2 <_panic>
+
+00800109 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800109:	55                   	push   %ebp
+  80010a:	89 e5                	mov    %esp,%ebp
+  80010c:	57                   	push   %edi
+  80010d:	56                   	push   %esi
+  80010e:	53                   	push   %ebx
+  80010f:	83 ec 40             	sub    $0x40,%esp
+	struct TlbStats ts0, ts1;
+	envid_t env;
+	uint32_t gen = 0;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, CTL, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  800112:	68 07 04 00 00       	push   $0x407
+  800117:	68 00 f0 ff 0f       	push   $0xffff000
+  80011c:	6a 00                	push   $0x0
+  80011e:	e8 95 0e 00 00       	call   800fb8 <sys_page_alloc>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	85 c0                	test   %eax,%eax
+  800128:	0f 88 22 01 00 00    	js     800250 <umain+0x147>
+		panic("sys_page_alloc: %e", r);
+	if ((env = fork()) < 0)
+  80012e:	e8 8d 14 00 00       	call   8015c0 <fork>
+  800133:	89 c6                	mov    %eax,%esi
+  800135:	85 c0                	test   %eax,%eax
+  800137:	0f 88 25 01 00 00    	js     800262 <umain+0x159>
+		panic("fork: %e", env);
+	if (env == 0)
+  80013d:	0f 84 31 01 00 00    	je     800274 <umain+0x16b>
+		for (i = 0; i < CTL->npages; i++) {
+  800143:	bb 00 00 00 40       	mov    $0x40000000,%ebx
+		child();
+	for (i = 0; i < 2 * NBULK; i++)
+		if ((r = sys_page_alloc(0, PAGES + i * PGSIZE,
+  800148:	83 ec 04             	sub    $0x4,%esp
+  80014b:	6a 07                	push   $0x7
+  80014d:	53                   	push   %ebx
+  80014e:	6a 00                	push   $0x0
+  800150:	e8 63 0e 00 00       	call   800fb8 <sys_page_alloc>
+  800155:	83 c4 10             	add    $0x10,%esp
+  800158:	85 c0                	test   %eax,%eax
+  80015a:	0f 88 85 01 00 00    	js     8002e5 <umain+0x1dc>
+	for (i = 0; i < 2 * NBULK; i++)
+  800160:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800166:	81 fb 00 00 08 40    	cmp    $0x40080000,%ebx
+  80016c:	75 da                	jne    800148 <umain+0x3f>
+					PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+
+	sys_tlb_stats(&ts0);
+  80016e:	83 ec 0c             	sub    $0xc,%esp
+  800171:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	e8 34 11 00 00       	call   8012ae <sys_tlb_stats>
+  80017a:	83 c4 10             	add    $0x10,%esp
+	uint32_t gen = 0;
+  80017d:	bb 00 00 00 00       	mov    $0x0,%ebx
+	for (i = 0; i < NSTEP; i++) {
+		gen++;
+  800182:	83 c3 01             	add    $0x1,%ebx
+		remap(env, gen & 1, 1, gen);
+  800185:	89 da                	mov    %ebx,%edx
+  800187:	83 e2 01             	and    $0x1,%edx
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	53                   	push   %ebx
+  80018e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800193:	89 f0                	mov    %esi,%eax
+  800195:	e8 9b fe ff ff       	call   800035 <remap>
+	for (i = 0; i < NSTEP; i++) {
+  80019a:	83 c4 10             	add    $0x10,%esp
+  80019d:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  8001a3:	75 dd                	jne    800182 <umain+0x79>
+	}
+	for (i = 0; i < NBSTEP; i++) {
+		gen++;
+  8001a5:	83 c3 01             	add    $0x1,%ebx
+		remap(env, gen & 1, NBULK, gen);
+  8001a8:	89 da                	mov    %ebx,%edx
+  8001aa:	83 e2 01             	and    $0x1,%edx
+  8001ad:	83 ec 0c             	sub    $0xc,%esp
+  8001b0:	53                   	push   %ebx
+  8001b1:	b9 40 00 00 00       	mov    $0x40,%ecx
+  8001b6:	89 f0                	mov    %esi,%eax
+  8001b8:	e8 78 fe ff ff       	call   800035 <remap>
+	for (i = 0; i < NBSTEP; i++) {
+  8001bd:	83 c4 10             	add    $0x10,%esp
+  8001c0:	81 fb 98 08 00 00    	cmp    $0x898,%ebx
+  8001c6:	75 dd                	jne    8001a5 <umain+0x9c>
+	}
+	CTL->done = 1;
+  8001c8:	c7 05 08 f0 ff 0f 01 	movl   $0x1,0xffff008
+  8001cf:	00 00 00 
+	wait(env);
+  8001d2:	83 ec 0c             	sub    $0xc,%esp
+  8001d5:	56                   	push   %esi
+  8001d6:	e8 17 3a 00 00       	call   803bf2 <wait>
+	sys_tlb_stats(&ts1);
+  8001db:	8d 45 c0             	lea    -0x40(%ebp),%eax
+  8001de:	89 04 24             	mov    %eax,(%esp)
+  8001e1:	e8 c8 10 00 00       	call   8012ae <sys_tlb_stats>
+
+	cprintf("testtlb: %u reads, %u stale\n", CTL->reads, CTL->stale);
+  8001e6:	8b 15 10 f0 ff 0f    	mov    0xffff010,%edx
+  8001ec:	a1 0c f0 ff 0f       	mov    0xffff00c,%eax
+  8001f1:	83 c4 0c             	add    $0xc,%esp
+  8001f4:	52                   	push   %edx
+  8001f5:	50                   	push   %eax
+  8001f6:	68 5c 47 80 00       	push   $0x80475c
+  8001fb:	e8 8d 02 00 00       	call   80048d <cprintf>
+	cprintf("testtlb: %u invalidations queued, %u full flushes, "
+  800200:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800203:	2b 45 e0             	sub    -0x20(%ebp),%eax
+  800206:	89 04 24             	mov    %eax,(%esp)
+  800209:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80020c:	2b 45 dc             	sub    -0x24(%ebp),%eax
+  80020f:	50                   	push   %eax
+  800210:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  800213:	2b 45 d8             	sub    -0x28(%ebp),%eax
+  800216:	50                   	push   %eax
+  800217:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80021a:	2b 45 d4             	sub    -0x2c(%ebp),%eax
+  80021d:	50                   	push   %eax
+  80021e:	68 a4 47 80 00       	push   $0x8047a4
+  800223:	e8 65 02 00 00       	call   80048d <cprintf>
+		"%u rounds, %u IPIs\n",
+		ts1.ts_queued - ts0.ts_queued, ts1.ts_full - ts0.ts_full,
+		ts1.ts_rounds - ts0.ts_rounds, ts1.ts_ipis - ts0.ts_ipis);
+	if (CTL->stale)
+  800228:	a1 10 f0 ff 0f       	mov    0xffff010,%eax
+  80022d:	83 c4 20             	add    $0x20,%esp
+  800230:	85 c0                	test   %eax,%eax
+  800232:	0f 85 bf 00 00 00    	jne    8002f7 <umain+0x1ee>
+		panic("stale TLB entries were used");
+	cprintf("testtlb: OK\n");
+  800238:	83 ec 0c             	sub    $0xc,%esp
+  80023b:	68 95 47 80 00       	push   $0x804795
+  800240:	e8 48 02 00 00       	call   80048d <cprintf>
+}
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024b:	5b                   	pop    %ebx
+  80024c:	5e                   	pop    %esi
+  80024d:	5f                   	pop    %edi
+  80024e:	5d                   	pop    %ebp
+  80024f:	c3                   	ret
+		panic("sys_page_alloc: %e", r);
+  800250:	50                   	push   %eax
+  800251:	68 49 47 80 00       	push   $0x804749
+  800256:	6a 4d                	push   $0x4d
+  800258:	68 30 47 80 00       	push   $0x804730
+  80025d:	e8 50 01 00 00       	call   8003b2 <_panic>
+		panic("fork: %e", env);
+  800262:	50                   	push   %eax
+  800263:	68 ca 4b 80 00       	push   $0x804bca
+  800268:	6a 4f                	push   $0x4f
+  80026a:	68 30 47 80 00       	push   $0x804730
+  80026f:	e8 3e 01 00 00       	call   8003b2 <_panic>
+	while (CTL->gen == 0)
+  800274:	a1 00 f0 ff 0f       	mov    0xffff000,%eax
+  800279:	85 c0                	test   %eax,%eax
+  80027b:	74 f7                	je     800274 <umain+0x16b>
+	while (!CTL->done) {
+  80027d:	8b 1d 08 f0 ff 0f    	mov    0xffff008,%ebx
+  800283:	85 db                	test   %ebx,%ebx
+  800285:	74 4c                	je     8002d3 <umain+0x1ca>
+	exit();
+  800287:	e8 0c 01 00 00       	call   800398 <exit>
+}
+  80028c:	e9 b2 fe ff ff       	jmp    800143 <umain+0x3a>
+			CTL->reads++;
+  800291:	a1 0c f0 ff 0f       	mov    0xffff00c,%eax
+  800296:	83 c0 01             	add    $0x1,%eax
+  800299:	a3 0c f0 ff 0f       	mov    %eax,0xffff00c
+		for (i = 0; i < CTL->npages; i++) {
+  80029e:	83 c1 01             	add    $0x1,%ecx
+  8002a1:	a1 04 f0 ff 0f       	mov    0xffff004,%eax
+  8002a6:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8002ac:	39 c1                	cmp    %eax,%ecx
+  8002ae:	73 1a                	jae    8002ca <umain+0x1c1>
+			g = CTL->gen;
+  8002b0:	a1 00 f0 ff 0f       	mov    0xffff000,%eax
+			v = *(volatile uint32_t *) (TARGET + i * PGSIZE);
+  8002b5:	8b 3a                	mov    (%edx),%edi
+			if (v < g)
+  8002b7:	39 c7                	cmp    %eax,%edi
+  8002b9:	73 d6                	jae    800291 <umain+0x188>
+				CTL->stale++;
+  8002bb:	a1 10 f0 ff 0f       	mov    0xffff010,%eax
+  8002c0:	83 c0 01             	add    $0x1,%eax
+  8002c3:	a3 10 f0 ff 0f       	mov    %eax,0xffff010
+  8002c8:	eb c7                	jmp    800291 <umain+0x188>
+	while (!CTL->done) {
+  8002ca:	a1 08 f0 ff 0f       	mov    0xffff008,%eax
+  8002cf:	85 c0                	test   %eax,%eax
+  8002d1:	75 b4                	jne    800287 <umain+0x17e>
+		for (i = 0; i < CTL->npages; i++) {
+  8002d3:	a1 04 f0 ff 0f       	mov    0xffff004,%eax
+  8002d8:	89 d9                	mov    %ebx,%ecx
+  8002da:	ba 00 00 00 30       	mov    $0x30000000,%edx
+  8002df:	85 c0                	test   %eax,%eax
+  8002e1:	75 cd                	jne    8002b0 <umain+0x1a7>
+  8002e3:	eb e5                	jmp    8002ca <umain+0x1c1>
+			panic("sys_page_alloc: %e", r);
+  8002e5:	50                   	push   %eax
+  8002e6:	68 49 47 80 00       	push   $0x804749
+  8002eb:	6a 55                	push   $0x55
+  8002ed:	68 30 47 80 00       	push   $0x804730
+  8002f2:	e8 bb 00 00 00       	call   8003b2 <_panic>
+		panic("stale TLB entries were used");
+  8002f7:	83 ec 04             	sub    $0x4,%esp
+  8002fa:	68 79 47 80 00       	push   $0x804779
+  8002ff:	6a 6a                	push   $0x6a
+  800301:	68 30 47 80 00       	push   $0x804730
+  800306:	e8 a7 00 00 00       	call   8003b2 <_panic>
+
+0080030b <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80030b:	55                   	push   %ebp
+  80030c:	89 e5                	mov    %esp,%ebp
+  80030e:	56                   	push   %esi
+  80030f:	53                   	push   %ebx
+  800310:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800313:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  800316:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800318:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80031d:	29 d0                	sub    %edx,%eax
+  80031f:	89 c2                	mov    %eax,%edx
+  800321:	c1 ea 0f             	shr    $0xf,%edx
+  800324:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032e:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800331:	c7 04 85 00 6a 80 00 	movl   $0x0,0x806a00(,%eax,4)
+  800338:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80033c:	e8 39 0c 00 00       	call   800f7a <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800341:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800346:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80034c:	89 e1                	mov    %esp,%ecx
+  80034e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800353:	29 ca                	sub    %ecx,%edx
+  800355:	89 d1                	mov    %edx,%ecx
+  800357:	c1 e9 0f             	shr    $0xf,%ecx
+  80035a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800360:	ba 00 00 00 00       	mov    $0x0,%edx
+  800365:	0f 42 d1             	cmovb  %ecx,%edx
+  800368:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80036d:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800374:	85 db                	test   %ebx,%ebx
+  800376:	7e 07                	jle    80037f <libmain+0x74>
+		binaryname = argv[0];
+  800378:	8b 06                	mov    (%esi),%eax
+  80037a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	56                   	push   %esi
+  800383:	53                   	push   %ebx
+  800384:	e8 80 fd ff ff       	call   800109 <umain>
+
+	// exit gracefully
+	exit();
+  800389:	e8 0a 00 00 00       	call   800398 <exit>
+}
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800394:	5b                   	pop    %ebx
+  800395:	5e                   	pop    %esi
+  800396:	5d                   	pop    %ebp
+  800397:	c3                   	ret
+
+00800398 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800398:	55                   	push   %ebp
+  800399:	89 e5                	mov    %esp,%ebp
+  80039b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80039e:	e8 dd 19 00 00       	call   801d80 <close_all>
+	sys_env_destroy(0);
+  8003a3:	83 ec 0c             	sub    $0xc,%esp
+  8003a6:	6a 00                	push   $0x0
+  8003a8:	e8 8c 0b 00 00       	call   800f39 <sys_env_destroy>
+}
+  8003ad:	83 c4 10             	add    $0x10,%esp
+  8003b0:	c9                   	leave
+  8003b1:	c3                   	ret
+
+008003b2 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003b2:	55                   	push   %ebp
+  8003b3:	89 e5                	mov    %esp,%ebp
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8003b7:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003ba:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8003c0:	e8 b5 0b 00 00       	call   800f7a <sys_getenvid>
+  8003c5:	83 ec 0c             	sub    $0xc,%esp
+  8003c8:	ff 75 0c             	push   0xc(%ebp)
+  8003cb:	ff 75 08             	push   0x8(%ebp)
+  8003ce:	56                   	push   %esi
+  8003cf:	50                   	push   %eax
+  8003d0:	68 f8 47 80 00       	push   $0x8047f8
+  8003d5:	e8 b3 00 00 00       	call   80048d <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8003da:	83 c4 18             	add    $0x18,%esp
+  8003dd:	53                   	push   %ebx
+  8003de:	ff 75 10             	push   0x10(%ebp)
+  8003e1:	e8 56 00 00 00       	call   80043c <vcprintf>
+	cprintf("\n");
+  8003e6:	c7 04 24 a0 47 80 00 	movl   $0x8047a0,(%esp)
+  8003ed:	e8 9b 00 00 00       	call   80048d <cprintf>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8003f5:	cc                   	int3
+	while (1)
+  8003f6:	eb fd                	jmp    8003f5 <_panic+0x43>
+
+008003f8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003f8:	55                   	push   %ebp
+  8003f9:	89 e5                	mov    %esp,%ebp
+  8003fb:	53                   	push   %ebx
+  8003fc:	83 ec 04             	sub    $0x4,%esp
+  8003ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800402:	8b 13                	mov    (%ebx),%edx
+  800404:	8d 42 01             	lea    0x1(%edx),%eax
+  800407:	89 03                	mov    %eax,(%ebx)
+  800409:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80040c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800410:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800415:	74 09                	je     800420 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800417:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80041b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80041e:	c9                   	leave
+  80041f:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800420:	83 ec 08             	sub    $0x8,%esp
+  800423:	68 ff 00 00 00       	push   $0xff
+  800428:	8d 43 08             	lea    0x8(%ebx),%eax
+  80042b:	50                   	push   %eax
+  80042c:	e8 cb 0a 00 00       	call   800efc <sys_cputs>
+		b->idx = 0;
+  800431:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800437:	83 c4 10             	add    $0x10,%esp
+  80043a:	eb db                	jmp    800417 <putch+0x1f>
+
+0080043c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+  80043f:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800445:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80044c:	00 00 00 
+	b.cnt = 0;
+  80044f:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800456:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800459:	ff 75 0c             	push   0xc(%ebp)
+  80045c:	ff 75 08             	push   0x8(%ebp)
+  80045f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800465:	50                   	push   %eax
+  800466:	68 f8 03 80 00       	push   $0x8003f8
+  80046b:	e8 1c 01 00 00       	call   80058c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800470:	83 c4 08             	add    $0x8,%esp
+  800473:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800479:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80047f:	50                   	push   %eax
+  800480:	e8 77 0a 00 00       	call   800efc <sys_cputs>
+
+	return b.cnt;
+}
+  800485:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80048b:	c9                   	leave
+  80048c:	c3                   	ret
+
+0080048d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80048d:	55                   	push   %ebp
+  80048e:	89 e5                	mov    %esp,%ebp
+  800490:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800493:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800496:	50                   	push   %eax
+  800497:	ff 75 08             	push   0x8(%ebp)
+  80049a:	e8 9d ff ff ff       	call   80043c <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80049f:	c9                   	leave
+  8004a0:	c3                   	ret
+
+008004a1 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8004a1:	55                   	push   %ebp
+  8004a2:	89 e5                	mov    %esp,%ebp
+  8004a4:	57                   	push   %edi
+  8004a5:	56                   	push   %esi
+  8004a6:	53                   	push   %ebx
+  8004a7:	83 ec 1c             	sub    $0x1c,%esp
+  8004aa:	89 c3                	mov    %eax,%ebx
+  8004ac:	89 d6                	mov    %edx,%esi
+  8004ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004b4:	89 d1                	mov    %edx,%ecx
+  8004b6:	89 c2                	mov    %eax,%edx
+  8004b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004bb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004be:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8004c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004cb:	39 c2                	cmp    %eax,%edx
+  8004cd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004d0:	73 4b                	jae    80051d <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8004d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d5:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8004d8:	85 ff                	test   %edi,%edi
+  8004da:	7e 11                	jle    8004ed <printnum+0x4c>
+			putch(padc, putdat);
+  8004dc:	83 ec 08             	sub    $0x8,%esp
+  8004df:	56                   	push   %esi
+  8004e0:	ff 75 18             	push   0x18(%ebp)
+  8004e3:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8004e5:	83 c4 10             	add    $0x10,%esp
+  8004e8:	83 ef 01             	sub    $0x1,%edi
+  8004eb:	75 ef                	jne    8004dc <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+  8004f0:	56                   	push   %esi
+  8004f1:	83 ec 04             	sub    $0x4,%esp
+  8004f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004f7:	ff 75 e0             	push   -0x20(%ebp)
+  8004fa:	ff 75 dc             	push   -0x24(%ebp)
+  8004fd:	ff 75 d8             	push   -0x28(%ebp)
+  800500:	e8 ef 40 00 00       	call   8045f4 <__umoddi3>
+  800505:	83 c4 14             	add    $0x14,%esp
+  800508:	0f be 80 1b 48 80 00 	movsbl 0x80481b(%eax),%eax
+  80050f:	50                   	push   %eax
+  800510:	ff d3                	call   *%ebx
+}
+  800512:	83 c4 10             	add    $0x10,%esp
+  800515:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800518:	5b                   	pop    %ebx
+  800519:	5e                   	pop    %esi
+  80051a:	5f                   	pop    %edi
+  80051b:	5d                   	pop    %ebp
+  80051c:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80051d:	83 ec 0c             	sub    $0xc,%esp
+  800520:	ff 75 18             	push   0x18(%ebp)
+  800523:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800526:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800529:	52                   	push   %edx
+  80052a:	50                   	push   %eax
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	ff 75 e4             	push   -0x1c(%ebp)
+  800531:	ff 75 e0             	push   -0x20(%ebp)
+  800534:	ff 75 dc             	push   -0x24(%ebp)
+  800537:	ff 75 d8             	push   -0x28(%ebp)
+  80053a:	e8 ef 3f 00 00       	call   80452e <__udivdi3>
+  80053f:	83 c4 18             	add    $0x18,%esp
+  800542:	52                   	push   %edx
+  800543:	50                   	push   %eax
+  800544:	89 f2                	mov    %esi,%edx
+  800546:	89 d8                	mov    %ebx,%eax
+  800548:	e8 54 ff ff ff       	call   8004a1 <printnum>
+  80054d:	83 c4 20             	add    $0x20,%esp
+  800550:	eb 9b                	jmp    8004ed <printnum+0x4c>
+
+00800552 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800552:	55                   	push   %ebp
+  800553:	89 e5                	mov    %esp,%ebp
+  800555:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800558:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80055c:	8b 10                	mov    (%eax),%edx
+  80055e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800561:	73 0a                	jae    80056d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800563:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800566:	89 08                	mov    %ecx,(%eax)
+  800568:	8b 45 08             	mov    0x8(%ebp),%eax
+  80056b:	88 02                	mov    %al,(%edx)
+}
+  80056d:	5d                   	pop    %ebp
+  80056e:	c3                   	ret
+
+0080056f <printfmt>:
+{
+  80056f:	55                   	push   %ebp
+  800570:	89 e5                	mov    %esp,%ebp
+  800572:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800575:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800578:	50                   	push   %eax
+  800579:	ff 75 10             	push   0x10(%ebp)
+  80057c:	ff 75 0c             	push   0xc(%ebp)
+  80057f:	ff 75 08             	push   0x8(%ebp)
+  800582:	e8 05 00 00 00       	call   80058c <vprintfmt>
+}
+  800587:	83 c4 10             	add    $0x10,%esp
+  80058a:	c9                   	leave
+  80058b:	c3                   	ret
+
+0080058c <vprintfmt>:
+{
+  80058c:	55                   	push   %ebp
+  80058d:	89 e5                	mov    %esp,%ebp
+  80058f:	57                   	push   %edi
+  800590:	56                   	push   %esi
+  800591:	53                   	push   %ebx
+  800592:	83 ec 2c             	sub    $0x2c,%esp
+  800595:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800598:	89 df                	mov    %ebx,%edi
+  80059a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80059d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005a0:	8d 70 01             	lea    0x1(%eax),%esi
+  8005a3:	0f b6 00             	movzbl (%eax),%eax
+  8005a6:	83 f8 25             	cmp    $0x25,%eax
+  8005a9:	74 1e                	je     8005c9 <vprintfmt+0x3d>
+			if (ch == '\0')
+  8005ab:	85 c0                	test   %eax,%eax
+  8005ad:	0f 84 15 05 00 00    	je     800ac8 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  8005b3:	83 ec 08             	sub    $0x8,%esp
+  8005b6:	53                   	push   %ebx
+  8005b7:	50                   	push   %eax
+  8005b8:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8005ba:	83 c6 01             	add    $0x1,%esi
+  8005bd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005c1:	83 c4 10             	add    $0x10,%esp
+  8005c4:	83 f8 25             	cmp    $0x25,%eax
+  8005c7:	75 e2                	jne    8005ab <vprintfmt+0x1f>
+		padc = ' ';
+  8005c9:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8005cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8005d4:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8005db:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8005e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e7:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005ea:	8d 56 01             	lea    0x1(%esi),%edx
+  8005ed:	0f b6 0e             	movzbl (%esi),%ecx
+  8005f0:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8005f3:	3c 55                	cmp    $0x55,%al
+  8005f5:	0f 87 3b 04 00 00    	ja     800a36 <vprintfmt+0x4aa>
+  8005fb:	0f b6 c0             	movzbl %al,%eax
+  8005fe:	ff 24 85 80 49 80 00 	jmp    *0x804980(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800605:	89 75 10             	mov    %esi,0x10(%ebp)
+  800608:	eb 93                	jmp    80059d <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  80060a:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  80060c:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  800610:	eb d8                	jmp    8005ea <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800612:	89 d6                	mov    %edx,%esi
+  800614:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  800618:	eb d0                	jmp    8005ea <vprintfmt+0x5e>
+  80061a:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  80061d:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  800620:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  800623:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800627:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  80062a:	83 f9 09             	cmp    $0x9,%ecx
+  80062d:	77 6f                	ja     80069e <vprintfmt+0x112>
+  80062f:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  800632:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  800635:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800638:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  80063c:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  80063f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800642:	83 fe 09             	cmp    $0x9,%esi
+  800645:	76 eb                	jbe    800632 <vprintfmt+0xa6>
+  800647:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  80064a:	89 d6                	mov    %edx,%esi
+  80064c:	eb 13                	jmp    800661 <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 00                	mov    (%eax),%eax
+  800653:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800656:	8b 45 14             	mov    0x14(%ebp),%eax
+  800659:	8d 40 04             	lea    0x4(%eax),%eax
+  80065c:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80065f:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  800661:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800665:	79 83                	jns    8005ea <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800667:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80066a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80066d:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  800674:	e9 71 ff ff ff       	jmp    8005ea <vprintfmt+0x5e>
+			if (width < 0)
+  800679:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80067c:	85 c9                	test   %ecx,%ecx
+  80067e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800683:	0f 49 c1             	cmovns %ecx,%eax
+  800686:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800689:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  80068b:	e9 5a ff ff ff       	jmp    8005ea <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800690:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  800692:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800699:	e9 4c ff ff ff       	jmp    8005ea <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80069e:	89 d6                	mov    %edx,%esi
+  8006a0:	eb bf                	jmp    800661 <vprintfmt+0xd5>
+			lflag++;
+  8006a2:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8006a6:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  8006a8:	e9 3d ff ff ff       	jmp    8005ea <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  8006ad:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8d 70 04             	lea    0x4(%eax),%esi
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	ff 30                	push   (%eax)
+  8006bc:	ff d7                	call   *%edi
+			break;
+  8006be:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8006c1:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  8006c4:	e9 d4 fe ff ff       	jmp    80059d <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8006c9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8006d2:	8b 10                	mov    (%eax),%edx
+  8006d4:	89 d0                	mov    %edx,%eax
+  8006d6:	f7 d8                	neg    %eax
+  8006d8:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006db:	83 f8 12             	cmp    $0x12,%eax
+  8006de:	7f 23                	jg     800703 <vprintfmt+0x177>
+  8006e0:	8b 14 85 e0 4a 80 00 	mov    0x804ae0(,%eax,4),%edx
+  8006e7:	85 d2                	test   %edx,%edx
+  8006e9:	74 18                	je     800703 <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8006eb:	52                   	push   %edx
+  8006ec:	68 1f 4d 80 00       	push   $0x804d1f
+  8006f1:	53                   	push   %ebx
+  8006f2:	57                   	push   %edi
+  8006f3:	e8 77 fe ff ff       	call   80056f <printfmt>
+  8006f8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8006fb:	89 75 14             	mov    %esi,0x14(%ebp)
+  8006fe:	e9 9a fe ff ff       	jmp    80059d <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  800703:	50                   	push   %eax
+  800704:	68 33 48 80 00       	push   $0x804833
+  800709:	53                   	push   %ebx
+  80070a:	57                   	push   %edi
+  80070b:	e8 5f fe ff ff       	call   80056f <printfmt>
+  800710:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800713:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800716:	e9 82 fe ff ff       	jmp    80059d <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80071b:	89 55 10             	mov    %edx,0x10(%ebp)
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	83 c0 04             	add    $0x4,%eax
+  800724:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800727:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072a:	8b 00                	mov    (%eax),%eax
+  80072c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80072f:	85 c0                	test   %eax,%eax
+  800731:	0f 84 61 03 00 00    	je     800a98 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800737:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80073b:	7e 06                	jle    800743 <vprintfmt+0x1b7>
+  80073d:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800741:	75 29                	jne    80076c <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800743:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800746:	8d 70 01             	lea    0x1(%eax),%esi
+  800749:	0f b6 00             	movzbl (%eax),%eax
+  80074c:	0f be d0             	movsbl %al,%edx
+  80074f:	85 d2                	test   %edx,%edx
+  800751:	0f 84 bb 00 00 00    	je     800812 <vprintfmt+0x286>
+  800757:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80075a:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  80075d:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800760:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800763:	eb 7a                	jmp    8007df <vprintfmt+0x253>
+				p = "(null)";
+  800765:	c7 45 d0 2c 48 80 00 	movl   $0x80482c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80076c:	83 ec 08             	sub    $0x8,%esp
+  80076f:	ff 75 d4             	push   -0x2c(%ebp)
+  800772:	ff 75 d0             	push   -0x30(%ebp)
+  800775:	e8 e0 03 00 00       	call   800b5a <strnlen>
+  80077a:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  80077d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800780:	83 c4 10             	add    $0x10,%esp
+  800783:	85 d2                	test   %edx,%edx
+  800785:	0f 8e d6 02 00 00    	jle    800a61 <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  80078b:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  80078f:	83 ec 08             	sub    $0x8,%esp
+  800792:	53                   	push   %ebx
+  800793:	56                   	push   %esi
+  800794:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800796:	83 c4 10             	add    $0x10,%esp
+  800799:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  80079d:	75 f0                	jne    80078f <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80079f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007a2:	8d 70 01             	lea    0x1(%eax),%esi
+  8007a5:	0f b6 00             	movzbl (%eax),%eax
+  8007a8:	0f be d0             	movsbl %al,%edx
+  8007ab:	85 d2                	test   %edx,%edx
+  8007ad:	0f 84 da 02 00 00    	je     800a8d <vprintfmt+0x501>
+  8007b3:	89 7d 08             	mov    %edi,0x8(%ebp)
+  8007b6:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8007b9:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  8007bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8007bf:	eb 1e                	jmp    8007df <vprintfmt+0x253>
+					putch(ch, putdat);
+  8007c1:	83 ec 08             	sub    $0x8,%esp
+  8007c4:	ff 75 0c             	push   0xc(%ebp)
+  8007c7:	52                   	push   %edx
+  8007c8:	ff 55 08             	call   *0x8(%ebp)
+  8007cb:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007ce:	83 eb 01             	sub    $0x1,%ebx
+  8007d1:	83 c6 01             	add    $0x1,%esi
+  8007d4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007d8:	0f be d0             	movsbl %al,%edx
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	74 2a                	je     800809 <vprintfmt+0x27d>
+  8007df:	85 ff                	test   %edi,%edi
+  8007e1:	78 05                	js     8007e8 <vprintfmt+0x25c>
+  8007e3:	83 ef 01             	sub    $0x1,%edi
+  8007e6:	78 59                	js     800841 <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8007e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007ec:	74 d3                	je     8007c1 <vprintfmt+0x235>
+  8007ee:	0f be c0             	movsbl %al,%eax
+  8007f1:	83 e8 20             	sub    $0x20,%eax
+  8007f4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007f7:	76 c8                	jbe    8007c1 <vprintfmt+0x235>
+					putch('?', putdat);
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	ff 75 0c             	push   0xc(%ebp)
+  8007ff:	6a 3f                	push   $0x3f
+  800801:	ff 55 08             	call   *0x8(%ebp)
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	eb c5                	jmp    8007ce <vprintfmt+0x242>
+  800809:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80080c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80080f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  800812:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800815:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800819:	7e 1b                	jle    800836 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  80081b:	83 ec 08             	sub    $0x8,%esp
+  80081e:	53                   	push   %ebx
+  80081f:	6a 20                	push   $0x20
+  800821:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  800823:	83 c4 10             	add    $0x10,%esp
+  800826:	83 ee 01             	sub    $0x1,%esi
+  800829:	75 f0                	jne    80081b <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80082e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800831:	e9 67 fd ff ff       	jmp    80059d <vprintfmt+0x11>
+  800836:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800839:	89 45 14             	mov    %eax,0x14(%ebp)
+  80083c:	e9 5c fd ff ff       	jmp    80059d <vprintfmt+0x11>
+  800841:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  800844:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800847:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80084a:	eb c6                	jmp    800812 <vprintfmt+0x286>
+	if (lflag >= 2)
+  80084c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80084f:	89 55 10             	mov    %edx,0x10(%ebp)
+  800852:	83 f9 01             	cmp    $0x1,%ecx
+  800855:	7f 1f                	jg     800876 <vprintfmt+0x2ea>
+	else if (lflag)
+  800857:	85 c9                	test   %ecx,%ecx
+  800859:	74 67                	je     8008c2 <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 30                	mov    (%eax),%esi
+  800860:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	c1 f8 1f             	sar    $0x1f,%eax
+  800868:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80086b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+  800874:	eb 17                	jmp    80088d <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800876:	8b 45 14             	mov    0x14(%ebp),%eax
+  800879:	8b 50 04             	mov    0x4(%eax),%edx
+  80087c:	8b 00                	mov    (%eax),%eax
+  80087e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800881:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8d 40 08             	lea    0x8(%eax),%eax
+  80088a:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80088d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800890:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800893:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800898:	85 c9                	test   %ecx,%ecx
+  80089a:	0f 89 12 01 00 00    	jns    8009b2 <vprintfmt+0x426>
+				putch('-', putdat);
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 2d                	push   $0x2d
+  8008a6:	ff d7                	call   *%edi
+				num = -(long long) num;
+  8008a8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008ab:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008ae:	f7 da                	neg    %edx
+  8008b0:	83 d1 00             	adc    $0x0,%ecx
+  8008b3:	f7 d9                	neg    %ecx
+  8008b5:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8008b8:	be 0a 00 00 00       	mov    $0xa,%esi
+  8008bd:	e9 f0 00 00 00       	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 30                	mov    (%eax),%esi
+  8008c7:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8008ca:	89 f0                	mov    %esi,%eax
+  8008cc:	c1 f8 1f             	sar    $0x1f,%eax
+  8008cf:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8008d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008db:	eb b0                	jmp    80088d <vprintfmt+0x301>
+	if (lflag >= 2)
+  8008dd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008e0:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008e3:	83 f9 01             	cmp    $0x1,%ecx
+  8008e6:	7f 1e                	jg     800906 <vprintfmt+0x37a>
+	else if (lflag)
+  8008e8:	85 c9                	test   %ecx,%ecx
+  8008ea:	74 32                	je     80091e <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 10                	mov    (%eax),%edx
+  8008f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8008fc:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  800901:	e9 ac 00 00 00       	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800906:	8b 45 14             	mov    0x14(%ebp),%eax
+  800909:	8b 10                	mov    (%eax),%edx
+  80090b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090e:	8d 40 08             	lea    0x8(%eax),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800914:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  800919:	e9 94 00 00 00       	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80091e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800921:	8b 10                	mov    (%eax),%edx
+  800923:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800928:	8d 40 04             	lea    0x4(%eax),%eax
+  80092b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80092e:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  800933:	eb 7d                	jmp    8009b2 <vprintfmt+0x426>
+	if (lflag >= 2)
+  800935:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800938:	89 55 10             	mov    %edx,0x10(%ebp)
+  80093b:	83 f9 01             	cmp    $0x1,%ecx
+  80093e:	7f 1b                	jg     80095b <vprintfmt+0x3cf>
+	else if (lflag)
+  800940:	85 c9                	test   %ecx,%ecx
+  800942:	74 2c                	je     800970 <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  800944:	8b 45 14             	mov    0x14(%ebp),%eax
+  800947:	8b 10                	mov    (%eax),%edx
+  800949:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094e:	8d 40 04             	lea    0x4(%eax),%eax
+  800951:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800954:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800959:	eb 57                	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  80095b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095e:	8b 10                	mov    (%eax),%edx
+  800960:	8b 48 04             	mov    0x4(%eax),%ecx
+  800963:	8d 40 08             	lea    0x8(%eax),%eax
+  800966:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800969:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  80096e:	eb 42                	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800970:	8b 45 14             	mov    0x14(%ebp),%eax
+  800973:	8b 10                	mov    (%eax),%edx
+  800975:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80097a:	8d 40 04             	lea    0x4(%eax),%eax
+  80097d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800980:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  800985:	eb 2b                	jmp    8009b2 <vprintfmt+0x426>
+			putch('0', putdat);
+  800987:	89 55 10             	mov    %edx,0x10(%ebp)
+  80098a:	83 ec 08             	sub    $0x8,%esp
+  80098d:	53                   	push   %ebx
+  80098e:	6a 30                	push   $0x30
+  800990:	ff d7                	call   *%edi
+			putch('x', putdat);
+  800992:	83 c4 08             	add    $0x8,%esp
+  800995:	53                   	push   %ebx
+  800996:	6a 78                	push   $0x78
+  800998:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  80099a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099d:	8b 10                	mov    (%eax),%edx
+  80099f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8009a4:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8009a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009aa:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009ad:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  8009b2:	83 ec 0c             	sub    $0xc,%esp
+  8009b5:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  8009b9:	50                   	push   %eax
+  8009ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8009bd:	56                   	push   %esi
+  8009be:	51                   	push   %ecx
+  8009bf:	52                   	push   %edx
+  8009c0:	89 da                	mov    %ebx,%edx
+  8009c2:	89 f8                	mov    %edi,%eax
+  8009c4:	e8 d8 fa ff ff       	call   8004a1 <printnum>
+			break;
+  8009c9:	83 c4 20             	add    $0x20,%esp
+  8009cc:	e9 cc fb ff ff       	jmp    80059d <vprintfmt+0x11>
+	if (lflag >= 2)
+  8009d1:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8009d4:	89 55 10             	mov    %edx,0x10(%ebp)
+  8009d7:	83 f9 01             	cmp    $0x1,%ecx
+  8009da:	7f 1b                	jg     8009f7 <vprintfmt+0x46b>
+	else if (lflag)
+  8009dc:	85 c9                	test   %ecx,%ecx
+  8009de:	74 2c                	je     800a0c <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8009e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e3:	8b 10                	mov    (%eax),%edx
+  8009e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8009f0:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8009f5:	eb bb                	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8009f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009fa:	8b 10                	mov    (%eax),%edx
+  8009fc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009ff:	8d 40 08             	lea    0x8(%eax),%eax
+  800a02:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a05:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  800a0a:	eb a6                	jmp    8009b2 <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  800a0c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0f:	8b 10                	mov    (%eax),%edx
+  800a11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a16:	8d 40 04             	lea    0x4(%eax),%eax
+  800a19:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a1c:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  800a21:	eb 8f                	jmp    8009b2 <vprintfmt+0x426>
+			putch(ch, putdat);
+  800a23:	89 55 10             	mov    %edx,0x10(%ebp)
+  800a26:	83 ec 08             	sub    $0x8,%esp
+  800a29:	53                   	push   %ebx
+  800a2a:	6a 25                	push   $0x25
+  800a2c:	ff d7                	call   *%edi
+			break;
+  800a2e:	83 c4 10             	add    $0x10,%esp
+  800a31:	e9 67 fb ff ff       	jmp    80059d <vprintfmt+0x11>
+			putch('%', putdat);
+  800a36:	83 ec 08             	sub    $0x8,%esp
+  800a39:	53                   	push   %ebx
+  800a3a:	6a 25                	push   $0x25
+  800a3c:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800a3e:	83 c4 10             	add    $0x10,%esp
+  800a41:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  800a45:	0f 84 ba fb ff ff    	je     800605 <vprintfmt+0x79>
+  800a4b:	89 75 10             	mov    %esi,0x10(%ebp)
+  800a4e:	89 f0                	mov    %esi,%eax
+  800a50:	83 e8 01             	sub    $0x1,%eax
+  800a53:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a57:	75 f7                	jne    800a50 <vprintfmt+0x4c4>
+  800a59:	89 45 10             	mov    %eax,0x10(%ebp)
+  800a5c:	e9 3c fb ff ff       	jmp    80059d <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a61:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800a64:	8d 70 01             	lea    0x1(%eax),%esi
+  800a67:	0f b6 00             	movzbl (%eax),%eax
+  800a6a:	0f be d0             	movsbl %al,%edx
+  800a6d:	85 d2                	test   %edx,%edx
+  800a6f:	74 11                	je     800a82 <vprintfmt+0x4f6>
+  800a71:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800a74:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800a77:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800a7a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800a7d:	e9 5d fd ff ff       	jmp    8007df <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800a82:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a85:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a88:	e9 10 fb ff ff       	jmp    80059d <vprintfmt+0x11>
+  800a8d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a90:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a93:	e9 05 fb ff ff       	jmp    80059d <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800a98:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800a9c:	7e 0a                	jle    800aa8 <vprintfmt+0x51c>
+  800a9e:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  800aa2:	0f 85 bd fc ff ff    	jne    800765 <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800aa8:	ba 28 00 00 00       	mov    $0x28,%edx
+  800aad:	b8 28 00 00 00       	mov    $0x28,%eax
+  800ab2:	be 2d 48 80 00       	mov    $0x80482d,%esi
+  800ab7:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800aba:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800abd:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800ac0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800ac3:	e9 17 fd ff ff       	jmp    8007df <vprintfmt+0x253>
+}
+  800ac8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800acb:	5b                   	pop    %ebx
+  800acc:	5e                   	pop    %esi
+  800acd:	5f                   	pop    %edi
+  800ace:	5d                   	pop    %ebp
+  800acf:	c3                   	ret
+
+00800ad0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ad0:	55                   	push   %ebp
+  800ad1:	89 e5                	mov    %esp,%ebp
+  800ad3:	83 ec 18             	sub    $0x18,%esp
+  800ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800adc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800adf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ae3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ae6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800aed:	85 c0                	test   %eax,%eax
+  800aef:	74 26                	je     800b17 <vsnprintf+0x47>
+  800af1:	85 d2                	test   %edx,%edx
+  800af3:	7e 22                	jle    800b17 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800af5:	ff 75 14             	push   0x14(%ebp)
+  800af8:	ff 75 10             	push   0x10(%ebp)
+  800afb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800afe:	50                   	push   %eax
+  800aff:	68 52 05 80 00       	push   $0x800552
+  800b04:	e8 83 fa ff ff       	call   80058c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b09:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b0c:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b12:	83 c4 10             	add    $0x10,%esp
+}
+  800b15:	c9                   	leave
+  800b16:	c3                   	ret
+		return -E_INVAL;
+  800b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b1c:	eb f7                	jmp    800b15 <vsnprintf+0x45>
+
+00800b1e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b24:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b27:	50                   	push   %eax
+  800b28:	ff 75 10             	push   0x10(%ebp)
+  800b2b:	ff 75 0c             	push   0xc(%ebp)
+  800b2e:	ff 75 08             	push   0x8(%ebp)
+  800b31:	e8 9a ff ff ff       	call   800ad0 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+
+00800b38 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b3e:	80 3a 00             	cmpb   $0x0,(%edx)
+  800b41:	74 10                	je     800b53 <strlen+0x1b>
+  800b43:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800b48:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b4b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b4f:	75 f7                	jne    800b48 <strlen+0x10>
+	return n;
+}
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800b53:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800b58:	eb f7                	jmp    800b51 <strlen+0x19>
+
+00800b5a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b60:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b63:	85 d2                	test   %edx,%edx
+  800b65:	74 16                	je     800b7d <strnlen+0x23>
+  800b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b70:	74 09                	je     800b7b <strnlen+0x21>
+		n++;
+  800b72:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b75:	39 d0                	cmp    %edx,%eax
+  800b77:	75 f3                	jne    800b6c <strnlen+0x12>
+		n++;
+  800b79:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b82:	eb f7                	jmp    800b7b <strnlen+0x21>
+
+00800b84 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b84:	55                   	push   %ebp
+  800b85:	89 e5                	mov    %esp,%ebp
+  800b87:	53                   	push   %ebx
+  800b88:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800b8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b93:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b97:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b9a:	83 c0 01             	add    $0x1,%eax
+  800b9d:	84 d2                	test   %dl,%dl
+  800b9f:	75 f2                	jne    800b93 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800ba1:	89 c8                	mov    %ecx,%eax
+  800ba3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ba6:	c9                   	leave
+  800ba7:	c3                   	ret
+
+00800ba8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	53                   	push   %ebx
+  800bac:	83 ec 10             	sub    $0x10,%esp
+  800baf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bb2:	53                   	push   %ebx
+  800bb3:	e8 80 ff ff ff       	call   800b38 <strlen>
+  800bb8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800bbb:	ff 75 0c             	push   0xc(%ebp)
+  800bbe:	01 d8                	add    %ebx,%eax
+  800bc0:	50                   	push   %eax
+  800bc1:	e8 be ff ff ff       	call   800b84 <strcpy>
+	return dst;
+}
+  800bc6:	89 d8                	mov    %ebx,%eax
+  800bc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcb:	c9                   	leave
+  800bcc:	c3                   	ret
+
+00800bcd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	56                   	push   %esi
+  800bd1:	53                   	push   %ebx
+  800bd2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800bd8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bdb:	85 db                	test   %ebx,%ebx
+  800bdd:	74 17                	je     800bf6 <strncpy+0x29>
+  800bdf:	01 f3                	add    %esi,%ebx
+  800be1:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800be3:	83 c0 01             	add    $0x1,%eax
+  800be6:	0f b6 0a             	movzbl (%edx),%ecx
+  800be9:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800bec:	80 f9 01             	cmp    $0x1,%cl
+  800bef:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800bf2:	39 c3                	cmp    %eax,%ebx
+  800bf4:	75 ed                	jne    800be3 <strncpy+0x16>
+	}
+	return ret;
+}
+  800bf6:	89 f0                	mov    %esi,%eax
+  800bf8:	5b                   	pop    %ebx
+  800bf9:	5e                   	pop    %esi
+  800bfa:	5d                   	pop    %ebp
+  800bfb:	c3                   	ret
+
+00800bfc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	56                   	push   %esi
+  800c00:	53                   	push   %ebx
+  800c01:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c0a:	89 f0                	mov    %esi,%eax
+  800c0c:	85 db                	test   %ebx,%ebx
+  800c0e:	74 1e                	je     800c2e <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800c10:	83 eb 01             	sub    $0x1,%ebx
+  800c13:	74 16                	je     800c2b <strlcpy+0x2f>
+  800c15:	01 f3                	add    %esi,%ebx
+  800c17:	0f b6 0a             	movzbl (%edx),%ecx
+  800c1a:	84 c9                	test   %cl,%cl
+  800c1c:	74 0d                	je     800c2b <strlcpy+0x2f>
+			*dst++ = *src++;
+  800c1e:	83 c2 01             	add    $0x1,%edx
+  800c21:	83 c0 01             	add    $0x1,%eax
+  800c24:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800c27:	39 d8                	cmp    %ebx,%eax
+  800c29:	75 ec                	jne    800c17 <strlcpy+0x1b>
+		*dst = '\0';
+  800c2b:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c2e:	29 f0                	sub    %esi,%eax
+}
+  800c30:	5b                   	pop    %ebx
+  800c31:	5e                   	pop    %esi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c3d:	0f b6 01             	movzbl (%ecx),%eax
+  800c40:	84 c0                	test   %al,%al
+  800c42:	74 11                	je     800c55 <strcmp+0x21>
+  800c44:	38 02                	cmp    %al,(%edx)
+  800c46:	75 0d                	jne    800c55 <strcmp+0x21>
+		p++, q++;
+  800c48:	83 c1 01             	add    $0x1,%ecx
+  800c4b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c4e:	0f b6 01             	movzbl (%ecx),%eax
+  800c51:	84 c0                	test   %al,%al
+  800c53:	75 ef                	jne    800c44 <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c55:	0f b6 c0             	movzbl %al,%eax
+  800c58:	0f b6 12             	movzbl (%edx),%edx
+  800c5b:	29 d0                	sub    %edx,%eax
+}
+  800c5d:	5d                   	pop    %ebp
+  800c5e:	c3                   	ret
+
+00800c5f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	53                   	push   %ebx
+  800c63:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c66:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c69:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800c71:	85 d2                	test   %edx,%edx
+  800c73:	74 2e                	je     800ca3 <strncmp+0x44>
+  800c75:	0f b6 01             	movzbl (%ecx),%eax
+  800c78:	84 c0                	test   %al,%al
+  800c7a:	74 16                	je     800c92 <strncmp+0x33>
+  800c7c:	3a 03                	cmp    (%ebx),%al
+  800c7e:	75 12                	jne    800c92 <strncmp+0x33>
+		n--, p++, q++;
+  800c80:	83 c1 01             	add    $0x1,%ecx
+  800c83:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800c86:	83 ea 01             	sub    $0x1,%edx
+  800c89:	75 ea                	jne    800c75 <strncmp+0x16>
+		return 0;
+  800c8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c90:	eb 11                	jmp    800ca3 <strncmp+0x44>
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800c97:	85 d2                	test   %edx,%edx
+  800c99:	74 08                	je     800ca3 <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c9b:	0f b6 01             	movzbl (%ecx),%eax
+  800c9e:	0f b6 13             	movzbl (%ebx),%edx
+  800ca1:	29 d0                	sub    %edx,%eax
+}
+  800ca3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ca6:	c9                   	leave
+  800ca7:	c3                   	ret
+
+00800ca8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cae:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cb2:	0f b6 10             	movzbl (%eax),%edx
+  800cb5:	84 d2                	test   %dl,%dl
+  800cb7:	74 15                	je     800cce <strchr+0x26>
+		if (*s == c)
+  800cb9:	38 d1                	cmp    %dl,%cl
+  800cbb:	74 0f                	je     800ccc <strchr+0x24>
+	for (; *s; s++)
+  800cbd:	83 c0 01             	add    $0x1,%eax
+  800cc0:	0f b6 10             	movzbl (%eax),%edx
+  800cc3:	84 d2                	test   %dl,%dl
+  800cc5:	75 f2                	jne    800cb9 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ccc:	5d                   	pop    %ebp
+  800ccd:	c3                   	ret
+	return 0;
+  800cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd3:	eb f7                	jmp    800ccc <strchr+0x24>
+
+00800cd5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	53                   	push   %ebx
+  800cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdc:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800cdf:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800ce2:	38 d3                	cmp    %dl,%bl
+  800ce4:	74 14                	je     800cfa <strfind+0x25>
+  800ce6:	89 d1                	mov    %edx,%ecx
+  800ce8:	84 db                	test   %bl,%bl
+  800cea:	74 0e                	je     800cfa <strfind+0x25>
+	for (; *s; s++)
+  800cec:	83 c0 01             	add    $0x1,%eax
+  800cef:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cf2:	38 ca                	cmp    %cl,%dl
+  800cf4:	74 04                	je     800cfa <strfind+0x25>
+  800cf6:	84 d2                	test   %dl,%dl
+  800cf8:	75 f2                	jne    800cec <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800cfa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfd:	c9                   	leave
+  800cfe:	c3                   	ret
+
+00800cff <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cff:	55                   	push   %ebp
+  800d00:	89 e5                	mov    %esp,%ebp
+  800d02:	57                   	push   %edi
+  800d03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d06:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d09:	85 c9                	test   %ecx,%ecx
+  800d0b:	74 20                	je     800d2d <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d0d:	89 f8                	mov    %edi,%eax
+  800d0f:	09 c8                	or     %ecx,%eax
+  800d11:	a8 03                	test   $0x3,%al
+  800d13:	75 12                	jne    800d27 <memset+0x28>
+		c &= 0xFF;
+  800d15:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d19:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d1f:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d22:	fc                   	cld
+  800d23:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d25:	eb 06                	jmp    800d2d <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2a:	fc                   	cld
+  800d2b:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d2d:	89 f8                	mov    %edi,%eax
+  800d2f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d32:	c9                   	leave
+  800d33:	c3                   	ret
+
+00800d34 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d3f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d42:	39 c6                	cmp    %eax,%esi
+  800d44:	73 32                	jae    800d78 <memmove+0x44>
+  800d46:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d49:	39 d0                	cmp    %edx,%eax
+  800d4b:	73 2b                	jae    800d78 <memmove+0x44>
+		s += n;
+		d += n;
+  800d4d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d50:	89 d6                	mov    %edx,%esi
+  800d52:	09 fe                	or     %edi,%esi
+  800d54:	09 ce                	or     %ecx,%esi
+  800d56:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d5c:	75 0e                	jne    800d6c <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d5e:	83 ef 04             	sub    $0x4,%edi
+  800d61:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d64:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d67:	fd                   	std
+  800d68:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d6a:	eb 09                	jmp    800d75 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d6c:	83 ef 01             	sub    $0x1,%edi
+  800d6f:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d72:	fd                   	std
+  800d73:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d75:	fc                   	cld
+  800d76:	eb 1a                	jmp    800d92 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d78:	89 f2                	mov    %esi,%edx
+  800d7a:	09 c2                	or     %eax,%edx
+  800d7c:	09 ca                	or     %ecx,%edx
+  800d7e:	f6 c2 03             	test   $0x3,%dl
+  800d81:	75 0a                	jne    800d8d <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d83:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d86:	89 c7                	mov    %eax,%edi
+  800d88:	fc                   	cld
+  800d89:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8b:	eb 05                	jmp    800d92 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d8d:	89 c7                	mov    %eax,%edi
+  800d8f:	fc                   	cld
+  800d90:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+
+00800d96 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800d96:	55                   	push   %ebp
+  800d97:	89 e5                	mov    %esp,%ebp
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d9c:	ff 75 10             	push   0x10(%ebp)
+  800d9f:	ff 75 0c             	push   0xc(%ebp)
+  800da2:	ff 75 08             	push   0x8(%ebp)
+  800da5:	e8 8a ff ff ff       	call   800d34 <memmove>
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+
+00800dac <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800db7:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dba:	85 f6                	test   %esi,%esi
+  800dbc:	74 29                	je     800de7 <memcmp+0x3b>
+  800dbe:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800dc0:	0f b6 08             	movzbl (%eax),%ecx
+  800dc3:	0f b6 1a             	movzbl (%edx),%ebx
+  800dc6:	38 d9                	cmp    %bl,%cl
+  800dc8:	75 11                	jne    800ddb <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dca:	83 c0 01             	add    $0x1,%eax
+  800dcd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dd0:	39 c6                	cmp    %eax,%esi
+  800dd2:	75 ec                	jne    800dc0 <memcmp+0x14>
+	}
+
+	return 0;
+  800dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dd9:	eb 08                	jmp    800de3 <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800ddb:	0f b6 c1             	movzbl %cl,%eax
+  800dde:	0f b6 db             	movzbl %bl,%ebx
+  800de1:	29 d8                	sub    %ebx,%eax
+}
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+	return 0;
+  800de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dec:	eb f5                	jmp    800de3 <memcmp+0x37>
+
+00800dee <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800df7:	89 c2                	mov    %eax,%edx
+  800df9:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800dfc:	39 d0                	cmp    %edx,%eax
+  800dfe:	73 0d                	jae    800e0d <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800e00:	38 08                	cmp    %cl,(%eax)
+  800e02:	74 0d                	je     800e11 <memfind+0x23>
+	for (; s < ends; s++)
+  800e04:	83 c0 01             	add    $0x1,%eax
+  800e07:	39 c2                	cmp    %eax,%edx
+  800e09:	75 f5                	jne    800e00 <memfind+0x12>
+  800e0b:	eb 06                	jmp    800e13 <memfind+0x25>
+  800e0d:	89 c2                	mov    %eax,%edx
+  800e0f:	eb 02                	jmp    800e13 <memfind+0x25>
+  800e11:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800e13:	89 d0                	mov    %edx,%eax
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+
+00800e17 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	57                   	push   %edi
+  800e1b:	56                   	push   %esi
+  800e1c:	53                   	push   %ebx
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e23:	0f b6 02             	movzbl (%edx),%eax
+  800e26:	3c 20                	cmp    $0x20,%al
+  800e28:	74 04                	je     800e2e <strtol+0x17>
+  800e2a:	3c 09                	cmp    $0x9,%al
+  800e2c:	75 0e                	jne    800e3c <strtol+0x25>
+		s++;
+  800e2e:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e31:	0f b6 02             	movzbl (%edx),%eax
+  800e34:	3c 20                	cmp    $0x20,%al
+  800e36:	74 f6                	je     800e2e <strtol+0x17>
+  800e38:	3c 09                	cmp    $0x9,%al
+  800e3a:	74 f2                	je     800e2e <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e3c:	3c 2b                	cmp    $0x2b,%al
+  800e3e:	74 2a                	je     800e6a <strtol+0x53>
+	int neg = 0;
+  800e40:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e45:	3c 2d                	cmp    $0x2d,%al
+  800e47:	74 2b                	je     800e74 <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e49:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e4f:	75 0f                	jne    800e60 <strtol+0x49>
+  800e51:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e54:	74 28                	je     800e7e <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e56:	85 db                	test   %ebx,%ebx
+  800e58:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e5d:	0f 44 d8             	cmove  %eax,%ebx
+  800e60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e65:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e68:	eb 46                	jmp    800eb0 <strtol+0x99>
+		s++;
+  800e6a:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e72:	eb d5                	jmp    800e49 <strtol+0x32>
+		s++, neg = 1;
+  800e74:	83 c2 01             	add    $0x1,%edx
+  800e77:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e7c:	eb cb                	jmp    800e49 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e7e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e82:	74 0e                	je     800e92 <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800e84:	85 db                	test   %ebx,%ebx
+  800e86:	75 d8                	jne    800e60 <strtol+0x49>
+		s++, base = 8;
+  800e88:	83 c2 01             	add    $0x1,%edx
+  800e8b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e90:	eb ce                	jmp    800e60 <strtol+0x49>
+		s += 2, base = 16;
+  800e92:	83 c2 02             	add    $0x2,%edx
+  800e95:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e9a:	eb c4                	jmp    800e60 <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e9c:	0f be c0             	movsbl %al,%eax
+  800e9f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ea2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ea5:	7d 3a                	jge    800ee1 <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800ea7:	83 c2 01             	add    $0x1,%edx
+  800eaa:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800eae:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800eb0:	0f b6 02             	movzbl (%edx),%eax
+  800eb3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800eb6:	89 f3                	mov    %esi,%ebx
+  800eb8:	80 fb 09             	cmp    $0x9,%bl
+  800ebb:	76 df                	jbe    800e9c <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800ebd:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ec0:	89 f3                	mov    %esi,%ebx
+  800ec2:	80 fb 19             	cmp    $0x19,%bl
+  800ec5:	77 08                	ja     800ecf <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800ec7:	0f be c0             	movsbl %al,%eax
+  800eca:	83 e8 57             	sub    $0x57,%eax
+  800ecd:	eb d3                	jmp    800ea2 <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ecf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ed2:	89 f3                	mov    %esi,%ebx
+  800ed4:	80 fb 19             	cmp    $0x19,%bl
+  800ed7:	77 08                	ja     800ee1 <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800ed9:	0f be c0             	movsbl %al,%eax
+  800edc:	83 e8 37             	sub    $0x37,%eax
+  800edf:	eb c1                	jmp    800ea2 <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ee1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ee5:	74 05                	je     800eec <strtol+0xd5>
+		*endptr = (char *) s;
+  800ee7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800eea:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800eec:	89 c8                	mov    %ecx,%eax
+  800eee:	f7 d8                	neg    %eax
+  800ef0:	85 ff                	test   %edi,%edi
+  800ef2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ef5:	89 c8                	mov    %ecx,%eax
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+
+00800efc <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800efc:	55                   	push   %ebp
+  800efd:	89 e5                	mov    %esp,%ebp
+  800eff:	57                   	push   %edi
+  800f00:	56                   	push   %esi
+  800f01:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0d:	89 c3                	mov    %eax,%ebx
+  800f0f:	89 c7                	mov    %eax,%edi
+  800f11:	89 c6                	mov    %eax,%esi
+  800f13:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f15:	5b                   	pop    %ebx
+  800f16:	5e                   	pop    %esi
+  800f17:	5f                   	pop    %edi
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f25:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f2a:	89 d1                	mov    %edx,%ecx
+  800f2c:	89 d3                	mov    %edx,%ebx
+  800f2e:	89 d7                	mov    %edx,%edi
+  800f30:	89 d6                	mov    %edx,%esi
+  800f32:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f34:	5b                   	pop    %ebx
+  800f35:	5e                   	pop    %esi
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f42:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f4f:	89 cb                	mov    %ecx,%ebx
+  800f51:	89 cf                	mov    %ecx,%edi
+  800f53:	89 ce                	mov    %ecx,%esi
+  800f55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 08                	jg     800f63 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f63:	83 ec 0c             	sub    $0xc,%esp
+  800f66:	50                   	push   %eax
+  800f67:	6a 03                	push   $0x3
+  800f69:	68 4b 4b 80 00       	push   $0x804b4b
+  800f6e:	6a 23                	push   $0x23
+  800f70:	68 68 4b 80 00       	push   $0x804b68
+  800f75:	e8 38 f4 ff ff       	call   8003b2 <_panic>
+
+00800f7a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f85:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f8a:	89 d1                	mov    %edx,%ecx
+  800f8c:	89 d3                	mov    %edx,%ebx
+  800f8e:	89 d7                	mov    %edx,%edi
+  800f90:	89 d6                	mov    %edx,%esi
+  800f92:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f94:	5b                   	pop    %ebx
+  800f95:	5e                   	pop    %esi
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+
+00800f99 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f99:	55                   	push   %ebp
+  800f9a:	89 e5                	mov    %esp,%ebp
+  800f9c:	57                   	push   %edi
+  800f9d:	56                   	push   %esi
+  800f9e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fa9:	89 d1                	mov    %edx,%ecx
+  800fab:	89 d3                	mov    %edx,%ebx
+  800fad:	89 d7                	mov    %edx,%edi
+  800faf:	89 d6                	mov    %edx,%esi
+  800fb1:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+
+00800fb8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fc1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd4:	89 f7                	mov    %esi,%edi
+  800fd6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd8:	85 c0                	test   %eax,%eax
+  800fda:	7f 08                	jg     800fe4 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fdf:	5b                   	pop    %ebx
+  800fe0:	5e                   	pop    %esi
+  800fe1:	5f                   	pop    %edi
+  800fe2:	5d                   	pop    %ebp
+  800fe3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fe4:	83 ec 0c             	sub    $0xc,%esp
+  800fe7:	50                   	push   %eax
+  800fe8:	6a 04                	push   $0x4
+  800fea:	68 4b 4b 80 00       	push   $0x804b4b
+  800fef:	6a 23                	push   $0x23
+  800ff1:	68 68 4b 80 00       	push   $0x804b68
+  800ff6:	e8 b7 f3 ff ff       	call   8003b2 <_panic>
+
+00800ffb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	57                   	push   %edi
+  800fff:	56                   	push   %esi
+  801000:	53                   	push   %ebx
+  801001:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80100f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801012:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801015:	8b 75 18             	mov    0x18(%ebp),%esi
+  801018:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80101a:	85 c0                	test   %eax,%eax
+  80101c:	7f 08                	jg     801026 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80101e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801021:	5b                   	pop    %ebx
+  801022:	5e                   	pop    %esi
+  801023:	5f                   	pop    %edi
+  801024:	5d                   	pop    %ebp
+  801025:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801026:	83 ec 0c             	sub    $0xc,%esp
+  801029:	50                   	push   %eax
+  80102a:	6a 05                	push   $0x5
+  80102c:	68 4b 4b 80 00       	push   $0x804b4b
+  801031:	6a 23                	push   $0x23
+  801033:	68 68 4b 80 00       	push   $0x804b68
+  801038:	e8 75 f3 ff ff       	call   8003b2 <_panic>
+
+0080103d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80103d:	55                   	push   %ebp
+  80103e:	89 e5                	mov    %esp,%ebp
+  801040:	57                   	push   %edi
+  801041:	56                   	push   %esi
+  801042:	53                   	push   %ebx
+  801043:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801051:	b8 06 00 00 00       	mov    $0x6,%eax
+  801056:	89 df                	mov    %ebx,%edi
+  801058:	89 de                	mov    %ebx,%esi
+  80105a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	7f 08                	jg     801068 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801060:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801068:	83 ec 0c             	sub    $0xc,%esp
+  80106b:	50                   	push   %eax
+  80106c:	6a 06                	push   $0x6
+  80106e:	68 4b 4b 80 00       	push   $0x804b4b
+  801073:	6a 23                	push   $0x23
+  801075:	68 68 4b 80 00       	push   $0x804b68
+  80107a:	e8 33 f3 ff ff       	call   8003b2 <_panic>
+
+0080107f <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80107f:	55                   	push   %ebp
+  801080:	89 e5                	mov    %esp,%ebp
+  801082:	57                   	push   %edi
+  801083:	56                   	push   %esi
+  801084:	53                   	push   %ebx
+  801085:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801088:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801093:	b8 08 00 00 00       	mov    $0x8,%eax
+  801098:	89 df                	mov    %ebx,%edi
+  80109a:	89 de                	mov    %ebx,%esi
+  80109c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	7f 08                	jg     8010aa <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010aa:	83 ec 0c             	sub    $0xc,%esp
+  8010ad:	50                   	push   %eax
+  8010ae:	6a 08                	push   $0x8
+  8010b0:	68 4b 4b 80 00       	push   $0x804b4b
+  8010b5:	6a 23                	push   $0x23
+  8010b7:	68 68 4b 80 00       	push   $0x804b68
+  8010bc:	e8 f1 f2 ff ff       	call   8003b2 <_panic>
+
+008010c1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  8010c7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010da:	89 df                	mov    %ebx,%edi
+  8010dc:	89 de                	mov    %ebx,%esi
+  8010de:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e0:	85 c0                	test   %eax,%eax
+  8010e2:	7f 08                	jg     8010ec <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e7:	5b                   	pop    %ebx
+  8010e8:	5e                   	pop    %esi
+  8010e9:	5f                   	pop    %edi
+  8010ea:	5d                   	pop    %ebp
+  8010eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  8010ef:	50                   	push   %eax
+  8010f0:	6a 09                	push   $0x9
+  8010f2:	68 4b 4b 80 00       	push   $0x804b4b
+  8010f7:	6a 23                	push   $0x23
+  8010f9:	68 68 4b 80 00       	push   $0x804b68
+  8010fe:	e8 af f2 ff ff       	call   8003b2 <_panic>
+
+00801103 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  801109:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80110c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801117:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80111c:	89 df                	mov    %ebx,%edi
+  80111e:	89 de                	mov    %ebx,%esi
+  801120:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801122:	85 c0                	test   %eax,%eax
+  801124:	7f 08                	jg     80112e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+  801131:	50                   	push   %eax
+  801132:	6a 0a                	push   $0xa
+  801134:	68 4b 4b 80 00       	push   $0x804b4b
+  801139:	6a 23                	push   $0x23
+  80113b:	68 68 4b 80 00       	push   $0x804b68
+  801140:	e8 6d f2 ff ff       	call   8003b2 <_panic>
+
+00801145 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801151:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801156:	be 00 00 00 00       	mov    $0x0,%esi
+  80115b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801161:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+
+00801168 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+  80116e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801171:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80117e:	89 cb                	mov    %ecx,%ebx
+  801180:	89 cf                	mov    %ecx,%edi
+  801182:	89 ce                	mov    %ecx,%esi
+  801184:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801186:	85 c0                	test   %eax,%eax
+  801188:	7f 08                	jg     801192 <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  80118a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118d:	5b                   	pop    %ebx
+  80118e:	5e                   	pop    %esi
+  80118f:	5f                   	pop    %edi
+  801190:	5d                   	pop    %ebp
+  801191:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801192:	83 ec 0c             	sub    $0xc,%esp
+  801195:	50                   	push   %eax
+  801196:	6a 0d                	push   $0xd
+  801198:	68 4b 4b 80 00       	push   $0x804b4b
+  80119d:	6a 23                	push   $0x23
+  80119f:	68 68 4b 80 00       	push   $0x804b68
+  8011a4:	e8 09 f2 ff ff       	call   8003b2 <_panic>
+
+008011a9 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	57                   	push   %edi
+  8011ad:	56                   	push   %esi
+  8011ae:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011bd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011c3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  8011c5:	5b                   	pop    %ebx
+  8011c6:	5e                   	pop    %esi
+  8011c7:	5f                   	pop    %edi
+  8011c8:	5d                   	pop    %ebp
+  8011c9:	c3                   	ret
+
+008011ca <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011de:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e3:	89 df                	mov    %ebx,%edi
+  8011e5:	89 de                	mov    %ebx,%esi
+  8011e7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e9:	85 c0                	test   %eax,%eax
+  8011eb:	7f 08                	jg     8011f5 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8011ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f0:	5b                   	pop    %ebx
+  8011f1:	5e                   	pop    %esi
+  8011f2:	5f                   	pop    %edi
+  8011f3:	5d                   	pop    %ebp
+  8011f4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f5:	83 ec 0c             	sub    $0xc,%esp
+  8011f8:	50                   	push   %eax
+  8011f9:	6a 0d                	push   $0xd
+  8011fb:	68 4b 4b 80 00       	push   $0x804b4b
+  801200:	6a 23                	push   $0x23
+  801202:	68 68 4b 80 00       	push   $0x804b68
+  801207:	e8 a6 f1 ff ff       	call   8003b2 <_panic>
+
+0080120c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801212:	ba 00 00 00 00       	mov    $0x0,%edx
+  801217:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80121c:	89 d1                	mov    %edx,%ecx
+  80121e:	89 d3                	mov    %edx,%ebx
+  801220:	89 d7                	mov    %edx,%edi
+  801222:	89 d6                	mov    %edx,%esi
+  801224:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5f                   	pop    %edi
+  801229:	5d                   	pop    %ebp
+  80122a:	c3                   	ret
+
+0080122b <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	57                   	push   %edi
+  80122f:	56                   	push   %esi
+  801230:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801231:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801236:	8b 55 08             	mov    0x8(%ebp),%edx
+  801239:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801241:	89 df                	mov    %ebx,%edi
+  801243:	89 de                	mov    %ebx,%esi
+  801245:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801252:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801257:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80125f:	89 cb                	mov    %ecx,%ebx
+  801261:	89 cf                	mov    %ecx,%edi
+  801263:	89 ce                	mov    %ecx,%esi
+  801265:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801267:	5b                   	pop    %ebx
+  801268:	5e                   	pop    %esi
+  801269:	5f                   	pop    %edi
+  80126a:	5d                   	pop    %ebp
+  80126b:	c3                   	ret
+
+0080126c <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	57                   	push   %edi
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127d:	b8 11 00 00 00       	mov    $0x11,%eax
+  801282:	89 df                	mov    %ebx,%edi
+  801284:	89 de                	mov    %ebx,%esi
+  801286:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801288:	5b                   	pop    %ebx
+  801289:	5e                   	pop    %esi
+  80128a:	5f                   	pop    %edi
+  80128b:	5d                   	pop    %ebp
+  80128c:	c3                   	ret
+
+0080128d <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801293:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012a3:	89 df                	mov    %ebx,%edi
+  8012a5:	89 de                	mov    %ebx,%esi
+  8012a7:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  8012a9:	5b                   	pop    %ebx
+  8012aa:	5e                   	pop    %esi
+  8012ab:	5f                   	pop    %edi
+  8012ac:	5d                   	pop    %ebp
+  8012ad:	c3                   	ret
+
+008012ae <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  8012ae:	55                   	push   %ebp
+  8012af:	89 e5                	mov    %esp,%ebp
+  8012b1:	57                   	push   %edi
+  8012b2:	56                   	push   %esi
+  8012b3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012bc:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012c1:	89 cb                	mov    %ecx,%ebx
+  8012c3:	89 cf                	mov    %ecx,%edi
+  8012c5:	89 ce                	mov    %ecx,%esi
+  8012c7:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8012c9:	5b                   	pop    %ebx
+  8012ca:	5e                   	pop    %esi
+  8012cb:	5f                   	pop    %edi
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+
+008012ce <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  8012d1:	57                   	push   %edi
+  8012d2:	56                   	push   %esi
+  8012d3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012df:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012e4:	89 df                	mov    %ebx,%edi
+  8012e6:	89 de                	mov    %ebx,%esi
+  8012e8:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fd:	b8 15 00 00 00       	mov    $0x15,%eax
+  801302:	89 cb                	mov    %ecx,%ebx
+  801304:	89 cf                	mov    %ecx,%edi
+  801306:	89 ce                	mov    %ecx,%esi
+  801308:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  80130a:	5b                   	pop    %ebx
+  80130b:	5e                   	pop    %esi
+  80130c:	5f                   	pop    %edi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+
+0080130f <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  80130f:	55                   	push   %ebp
+  801310:	89 e5                	mov    %esp,%ebp
+  801312:	57                   	push   %edi
+  801313:	56                   	push   %esi
+  801314:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801315:	be 00 00 00 00       	mov    $0x0,%esi
+  80131a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801320:	b8 16 00 00 00       	mov    $0x16,%eax
+  801325:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801328:	89 f7                	mov    %esi,%edi
+  80132a:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801337:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801342:	b8 17 00 00 00       	mov    $0x17,%eax
+  801347:	89 df                	mov    %ebx,%edi
+  801349:	89 de                	mov    %ebx,%esi
+  80134b:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  80134d:	5b                   	pop    %ebx
+  80134e:	5e                   	pop    %esi
+  80134f:	5f                   	pop    %edi
+  801350:	5d                   	pop    %ebp
+  801351:	c3                   	ret
+
+00801352 <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  801352:	55                   	push   %ebp
+  801353:	89 e5                	mov    %esp,%ebp
+  801355:	57                   	push   %edi
+  801356:	56                   	push   %esi
+  801357:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801358:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	b8 18 00 00 00       	mov    $0x18,%eax
+  801365:	89 cb                	mov    %ecx,%ebx
+  801367:	89 cf                	mov    %ecx,%edi
+  801369:	89 ce                	mov    %ecx,%esi
+  80136b:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5f                   	pop    %edi
+  801370:	5d                   	pop    %ebp
+  801371:	c3                   	ret
+
+00801372 <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  801372:	55                   	push   %ebp
+  801373:	89 e5                	mov    %esp,%ebp
+  801375:	57                   	push   %edi
+  801376:	56                   	push   %esi
+  801377:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801378:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  80137c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801381:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801384:	b8 19 00 00 00       	mov    $0x19,%eax
+  801389:	89 df                	mov    %ebx,%edi
+  80138b:	89 de                	mov    %ebx,%esi
+  80138d:	cd 30                	int    $0x30
+}
+  80138f:	5b                   	pop    %ebx
+  801390:	5e                   	pop    %esi
+  801391:	5f                   	pop    %edi
+  801392:	5d                   	pop    %ebp
+  801393:	c3                   	ret
+
+00801394 <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	57                   	push   %edi
+  801398:	56                   	push   %esi
+  801399:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8013aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ad:	89 f7                	mov    %esi,%edi
+  8013af:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  8013b1:	5b                   	pop    %ebx
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5f                   	pop    %edi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+
+008013b6 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	57                   	push   %edi
+  8013ba:	56                   	push   %esi
+  8013bb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8013c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8013cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013cf:	89 f7                	mov    %esi,%edi
+  8013d1:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8013d3:	5b                   	pop    %ebx
+  8013d4:	5e                   	pop    %esi
+  8013d5:	5f                   	pop    %edi
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	c3                   	ret
+
+008013d8 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8013ee:	89 df                	mov    %ebx,%edi
+  8013f0:	89 de                	mov    %ebx,%esi
+  8013f2:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8013f4:	5b                   	pop    %ebx
+  8013f5:	5e                   	pop    %esi
+  8013f6:	5f                   	pop    %edi
+  8013f7:	5d                   	pop    %ebp
+  8013f8:	c3                   	ret
+
+008013f9 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8013f9:	55                   	push   %ebp
+  8013fa:	89 e5                	mov    %esp,%ebp
+  8013fc:	57                   	push   %edi
+  8013fd:	56                   	push   %esi
+  8013fe:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013ff:	be 00 00 00 00       	mov    $0x0,%esi
+  801404:	8b 55 08             	mov    0x8(%ebp),%edx
+  801407:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80140a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  80140f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801412:	89 f7                	mov    %esi,%edi
+  801414:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  801416:	5b                   	pop    %ebx
+  801417:	5e                   	pop    %esi
+  801418:	5f                   	pop    %edi
+  801419:	5d                   	pop    %ebp
+  80141a:	c3                   	ret
+
+0080141b <thread_alive>:
+static bool
+thread_alive(envid_t id)
+{
+	const volatile struct Env *e = &envs[ENVX(id)];
+
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	74 20                	je     80143f <thread_alive+0x24>
+	const volatile struct Env *e = &envs[ENVX(id)];
+  80141f:	89 c1                	mov    %eax,%ecx
+  801421:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801427:	69 d1 bc 00 00 00    	imul   $0xbc,%ecx,%edx
+  80142d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801433:	8b 52 48             	mov    0x48(%edx),%edx
+  801436:	39 c2                	cmp    %eax,%edx
+  801438:	74 06                	je     801440 <thread_alive+0x25>
+  80143a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143f:	c3                   	ret
+	return id && e->env_id == id && e->env_status != ENV_FREE;
+  801440:	69 c9 bc 00 00 00    	imul   $0xbc,%ecx,%ecx
+  801446:	8b 81 54 00 c0 ee    	mov    -0x113fffac(%ecx),%eax
+  80144c:	85 c0                	test   %eax,%eax
+  80144e:	0f 95 c0             	setne  %al
+  801451:	0f b6 c0             	movzbl %al,%eax
+  801454:	c3                   	ret
+
+00801455 <pgfault>:
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	57                   	push   %edi
+  801459:	56                   	push   %esi
+  80145a:	53                   	push   %ebx
+  80145b:	83 ec 0c             	sub    $0xc,%esp
+  80145e:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801461:	8b 30                	mov    (%eax),%esi
+	uint32_t err = utf->utf_err;
+  801463:	8b 40 04             	mov    0x4(%eax),%eax
+	uint32_t pn = (uintptr_t) addr >> PGSHIFT;
+  801466:	89 f3                	mov    %esi,%ebx
+  801468:	c1 eb 0c             	shr    $0xc,%ebx
+	if(sforked && (err & FEC_WR)) {
+  80146b:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801472:	74 52                	je     8014c6 <pgfault+0x71>
+  801474:	a8 02                	test   $0x2,%al
+  801476:	75 14                	jne    80148c <pgfault+0x37>
+		panic("pgfault: not write or not cow");
+  801478:	83 ec 04             	sub    $0x4,%esp
+  80147b:	68 76 4b 80 00       	push   $0x804b76
+  801480:	6a 2e                	push   $0x2e
+  801482:	68 94 4b 80 00       	push   $0x804b94
+  801487:	e8 26 ef ff ff       	call   8003b2 <_panic>
+		m = &cow_locks[pn % NCOWLOCKS];
+  80148c:	89 d8                	mov    %ebx,%eax
+  80148e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801493:	8d 3c 85 00 00 00 e1 	lea    -0x1f000000(,%eax,4),%edi
+		mutex_lock(m);
+  80149a:	83 ec 0c             	sub    $0xc,%esp
+  80149d:	57                   	push   %edi
+  80149e:	e8 65 29 00 00       	call   803e08 <mutex_lock>
+		if((vpt[pn] & (PTE_P|PTE_W)) == (PTE_P|PTE_W)) {
+  8014a3:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014aa:	83 e0 03             	and    $0x3,%eax
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	83 f8 03             	cmp    $0x3,%eax
+  8014b3:	75 1a                	jne    8014cf <pgfault+0x7a>
+			mutex_unlock(m);
+  8014b5:	83 ec 0c             	sub    $0xc,%esp
+  8014b8:	57                   	push   %edi
+  8014b9:	e8 b8 29 00 00       	call   803e76 <mutex_unlock>
+			return;
+  8014be:	83 c4 10             	add    $0x10,%esp
+  8014c1:	e9 9f 00 00 00       	jmp    801565 <pgfault+0x110>
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8014c6:	a8 02                	test   $0x2,%al
+  8014c8:	74 ae                	je     801478 <pgfault+0x23>
+	struct mutex *m = NULL;
+  8014ca:	bf 00 00 00 00       	mov    $0x0,%edi
+	if(!(err & FEC_WR) || !(vpt[pn] & PTE_COW))
+  8014cf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8014d6:	f6 c4 08             	test   $0x8,%ah
+  8014d9:	74 9d                	je     801478 <pgfault+0x23>
+  8014db:	89 e0                	mov    %esp,%eax
+  8014dd:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8014e2:	29 c2                	sub    %eax,%edx
+  8014e4:	89 d0                	mov    %edx,%eax
+  8014e6:	c1 e8 0f             	shr    $0xf,%eax
+  8014e9:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8014ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f4:	0f 43 c2             	cmovae %edx,%eax
+	void *tmp = (void*)PFTEMP - thread_slot() * PGSIZE;
+  8014f7:	c1 e0 0c             	shl    $0xc,%eax
+  8014fa:	bb 00 f0 7f 00       	mov    $0x7ff000,%ebx
+  8014ff:	29 c3                	sub    %eax,%ebx
+	if((ret = sys_page_alloc(0, tmp, PTE_U|PTE_W|PTE_P)) < 0)
+  801501:	83 ec 04             	sub    $0x4,%esp
+  801504:	6a 07                	push   $0x7
+  801506:	53                   	push   %ebx
+  801507:	6a 00                	push   $0x0
+  801509:	e8 aa fa ff ff       	call   800fb8 <sys_page_alloc>
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	78 58                	js     80156d <pgfault+0x118>
+	memmove(tmp, (void*)ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  801515:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80151b:	83 ec 04             	sub    $0x4,%esp
+  80151e:	68 00 10 00 00       	push   $0x1000
+  801523:	56                   	push   %esi
+  801524:	53                   	push   %ebx
+  801525:	e8 0a f8 ff ff       	call   800d34 <memmove>
+	if((ret = sys_page_map(0, tmp, 0, (void*)ROUNDDOWN(addr, PGSIZE), PTE_U|PTE_W|PTE_P)) < 0)
+  80152a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801531:	56                   	push   %esi
+  801532:	6a 00                	push   $0x0
+  801534:	53                   	push   %ebx
+  801535:	6a 00                	push   $0x0
+  801537:	e8 bf fa ff ff       	call   800ffb <sys_page_map>
+  80153c:	83 c4 20             	add    $0x20,%esp
+  80153f:	85 c0                	test   %eax,%eax
+  801541:	78 3c                	js     80157f <pgfault+0x12a>
+	if((ret = sys_page_unmap(0, tmp)) < 0)
+  801543:	83 ec 08             	sub    $0x8,%esp
+  801546:	53                   	push   %ebx
+  801547:	6a 00                	push   $0x0
+  801549:	e8 ef fa ff ff       	call   80103d <sys_page_unmap>
+  80154e:	83 c4 10             	add    $0x10,%esp
+  801551:	85 c0                	test   %eax,%eax
+  801553:	78 3c                	js     801591 <pgfault+0x13c>
+	if(m)
+  801555:	85 ff                	test   %edi,%edi
+  801557:	74 0c                	je     801565 <pgfault+0x110>
+		mutex_unlock(m);
+  801559:	83 ec 0c             	sub    $0xc,%esp
+  80155c:	57                   	push   %edi
+  80155d:	e8 14 29 00 00       	call   803e76 <mutex_unlock>
+  801562:	83 c4 10             	add    $0x10,%esp
+}
+  801565:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801568:	5b                   	pop    %ebx
+  801569:	5e                   	pop    %esi
+  80156a:	5f                   	pop    %edi
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+		panic("sys_page_alloc: %e", ret);
+  80156d:	50                   	push   %eax
+  80156e:	68 49 47 80 00       	push   $0x804749
+  801573:	6a 3d                	push   $0x3d
+  801575:	68 94 4b 80 00       	push   $0x804b94
+  80157a:	e8 33 ee ff ff       	call   8003b2 <_panic>
+		panic("sys_page_map: %e", ret);
+  80157f:	50                   	push   %eax
+  801580:	68 9f 4b 80 00       	push   $0x804b9f
+  801585:	6a 40                	push   $0x40
+  801587:	68 94 4b 80 00       	push   $0x804b94
+  80158c:	e8 21 ee ff ff       	call   8003b2 <_panic>
+		panic("sys_page_unmap: %e", ret);
+  801591:	50                   	push   %eax
+  801592:	68 b0 4b 80 00       	push   $0x804bb0
+  801597:	6a 42                	push   $0x42
+  801599:	68 94 4b 80 00       	push   $0x804b94
+  80159e:	e8 0f ee ff ff       	call   8003b2 <_panic>
+
+008015a3 <thread_main>:
+{
+  8015a3:	55                   	push   %ebp
+  8015a4:	89 e5                	mov    %esp,%ebp
+  8015a6:	83 ec 14             	sub    $0x14,%esp
+	fn(arg);
+  8015a9:	ff 75 0c             	push   0xc(%ebp)
+  8015ac:	ff 55 08             	call   *0x8(%ebp)
+	sys_env_destroy(0);
+  8015af:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8015b6:	e8 7e f9 ff ff       	call   800f39 <sys_env_destroy>
+}
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	c9                   	leave
+  8015bf:	c3                   	ret
+
+008015c0 <fork>:
+{
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	57                   	push   %edi
+  8015c4:	56                   	push   %esi
+  8015c5:	53                   	push   %ebx
+  8015c6:	83 ec 28             	sub    $0x28,%esp
+	set_pgfault_handler(pgfault);
+  8015c9:	68 55 14 80 00       	push   $0x801455
+  8015ce:	e8 81 2b 00 00       	call   804154 <set_pgfault_handler>
+	if(sforked)
+  8015d3:	83 c4 10             	add    $0x10,%esp
+  8015d6:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  8015dd:	75 33                	jne    801612 <fork+0x52>
+	__asm __volatile("int %2"
+  8015df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015e4:	cd 30                	int    $0x30
+  8015e6:	89 c7                	mov    %eax,%edi
+  8015e8:	89 c6                	mov    %eax,%esi
+	if(envid < 0) 
+  8015ea:	85 c0                	test   %eax,%eax
+  8015ec:	0f 88 b4 00 00 00    	js     8016a6 <fork+0xe6>
+	if(envid == 0) {
+  8015f2:	0f 84 c3 00 00 00    	je     8016bb <fork+0xfb>
+	pgbatch_init(&pb);
+  8015f8:	83 ec 0c             	sub    $0xc,%esp
+  8015fb:	68 20 63 80 00       	push   $0x806320
+  801600:	e8 4f 26 00 00       	call   803c54 <pgbatch_init>
+  801605:	83 c4 10             	add    $0x10,%esp
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80160d:	e9 9c 01 00 00       	jmp    8017ae <fork+0x1ee>
+static void
+thread_fork_prepare(void)
+{
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  801612:	83 ec 0c             	sub    $0xc,%esp
+  801615:	68 c0 66 80 00       	push   $0x8066c0
+  80161a:	e8 e9 27 00 00       	call   803e08 <mutex_lock>
+  80161f:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTHREADS; i++)
+  801622:	bb 00 00 00 00       	mov    $0x0,%ebx
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  801627:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80162c:	eb 08                	jmp    801636 <fork+0x76>
+  80162e:	83 c3 01             	add    $0x1,%ebx
+  801631:	83 fb 20             	cmp    $0x20,%ebx
+  801634:	74 5b                	je     801691 <fork+0xd1>
+		if (thread_alive(thread_ids[i])
+  801636:	8b 34 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%esi
+  80163d:	89 f0                	mov    %esi,%eax
+  80163f:	e8 d7 fd ff ff       	call   80141b <thread_alive>
+  801644:	85 c0                	test   %eax,%eax
+  801646:	74 e6                	je     80162e <fork+0x6e>
+  801648:	89 e0                	mov    %esp,%eax
+  80164a:	89 fa                	mov    %edi,%edx
+  80164c:	29 c2                	sub    %eax,%edx
+  80164e:	89 d0                	mov    %edx,%eax
+  801650:	c1 e8 0f             	shr    $0xf,%eax
+  801653:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  801659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80165e:	0f 43 c1             	cmovae %ecx,%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+				thisenv->env_pgfault_upcall)) < 0)
+  801661:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801668:	8b 40 78             	mov    0x78(%eax),%eax
+		    && (r = sys_env_set_pgfault_upcall(thread_ids[i],
+  80166b:	83 ec 08             	sub    $0x8,%esp
+  80166e:	50                   	push   %eax
+  80166f:	56                   	push   %esi
+  801670:	e8 8e fa ff ff       	call   801103 <sys_env_set_pgfault_upcall>
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	79 b2                	jns    80162e <fork+0x6e>
+			panic("sys_env_set_pgfault_upcall: %e", r);
+  80167c:	50                   	push   %eax
+  80167d:	68 3c 4c 80 00       	push   $0x804c3c
+  801682:	68 00 01 00 00       	push   $0x100
+  801687:	68 94 4b 80 00       	push   $0x804b94
+  80168c:	e8 21 ed ff ff       	call   8003b2 <_panic>
+	mutex_unlock(&sfork_lock);
+  801691:	83 ec 0c             	sub    $0xc,%esp
+  801694:	68 c0 66 80 00       	push   $0x8066c0
+  801699:	e8 d8 27 00 00       	call   803e76 <mutex_unlock>
+}
+  80169e:	83 c4 10             	add    $0x10,%esp
+  8016a1:	e9 39 ff ff ff       	jmp    8015df <fork+0x1f>
+		panic("sys_exofork: %e", envid);
+  8016a6:	50                   	push   %eax
+  8016a7:	68 c3 4b 80 00       	push   $0x804bc3
+  8016ac:	68 91 00 00 00       	push   $0x91
+  8016b1:	68 94 4b 80 00       	push   $0x804b94
+  8016b6:	e8 f7 ec ff ff       	call   8003b2 <_panic>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8016bb:	e8 ba f8 ff ff       	call   800f7a <sys_getenvid>
+  8016c0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8016c5:	89 e1                	mov    %esp,%ecx
+  8016c7:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  8016cc:	29 ca                	sub    %ecx,%edx
+  8016ce:	89 d1                	mov    %edx,%ecx
+  8016d0:	c1 e9 0f             	shr    $0xf,%ecx
+  8016d3:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8016d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016de:	0f 42 d1             	cmovb  %ecx,%edx
+  8016e1:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8016e7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016ec:	89 04 95 00 6a 80 00 	mov    %eax,0x806a00(,%edx,4)
+		if(sforked)
+  8016f3:	a1 80 6a 80 00       	mov    0x806a80,%eax
+  8016f8:	85 c0                	test   %eax,%eax
+  8016fa:	75 07                	jne    801703 <fork+0x143>
+		return 0;
+  8016fc:	89 c6                	mov    %eax,%esi
+  8016fe:	e9 6f 02 00 00       	jmp    801972 <fork+0x3b2>
+  801703:	89 e2                	mov    %esp,%edx
+  801705:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80170a:	29 d0                	sub    %edx,%eax
+  80170c:	89 c3                	mov    %eax,%ebx
+  80170e:	c1 eb 0f             	shr    $0xf,%ebx
+  801711:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171b:	0f 43 d8             	cmovae %eax,%ebx
+static void
+thread_fork_child(void)
+{
+	int slot = thread_slot(), r;
+
+	memset(thread_ids, 0, sizeof(thread_ids));
+  80171e:	83 ec 04             	sub    $0x4,%esp
+  801721:	68 80 00 00 00       	push   $0x80
+  801726:	6a 00                	push   $0x0
+  801728:	68 40 66 80 00       	push   $0x806640
+  80172d:	e8 cd f5 ff ff       	call   800cff <memset>
+	thread_ids[slot] = sys_getenvid();
+  801732:	e8 43 f8 ff ff       	call   800f7a <sys_getenvid>
+  801737:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[0] = thread_envs[slot];
+  80173e:	8b 04 9d 00 6a 80 00 	mov    0x806a00(,%ebx,4),%eax
+  801745:	a3 00 6a 80 00       	mov    %eax,0x806a00
+	mutex_init(&sfork_lock);
+  80174a:	c7 04 24 c0 66 80 00 	movl   $0x8066c0,(%esp)
+  801751:	e8 a4 26 00 00       	call   803dfa <mutex_init>
+	// The copy-on-write locks are still our parent's.
+	if ((r = sys_page_alloc(0, cow_locks, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  801756:	83 c4 0c             	add    $0xc,%esp
+  801759:	68 07 04 00 00       	push   $0x407
+  80175e:	68 00 00 00 e1       	push   $0xe1000000
+  801763:	6a 00                	push   $0x0
+  801765:	e8 4e f8 ff ff       	call   800fb8 <sys_page_alloc>
+  80176a:	83 c4 10             	add    $0x10,%esp
+  80176d:	85 c0                	test   %eax,%eax
+  80176f:	0f 89 fd 01 00 00    	jns    801972 <fork+0x3b2>
+		panic("sys_page_alloc: %e", r);
+  801775:	50                   	push   %eax
+  801776:	68 49 47 80 00       	push   $0x804749
+  80177b:	68 12 01 00 00       	push   $0x112
+  801780:	68 94 4b 80 00       	push   $0x804b94
+  801785:	e8 28 ec ff ff       	call   8003b2 <_panic>
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+  80178a:	81 c3 00 00 40 00    	add    $0x400000,%ebx
+  801790:	81 e3 00 00 c0 ff    	and    $0xffc00000,%ebx
+  801796:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+	for(addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+  80179c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8017a2:	81 fb ff ef bf ee    	cmp    $0xeebfefff,%ebx
+  8017a8:	0f 87 4f 01 00 00    	ja     8018fd <fork+0x33d>
+		pd = PDX(addr);
+  8017ae:	89 d8                	mov    %ebx,%eax
+  8017b0:	c1 e8 16             	shr    $0x16,%eax
+		if(!(vpd[pd] & PTE_P)) {
+  8017b3:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8017ba:	f6 c2 01             	test   $0x1,%dl
+  8017bd:	74 cb                	je     80178a <fork+0x1ca>
+		if(pd != PDX(UXSTACKTOP - PGSIZE)) {
+  8017bf:	3d ba 03 00 00       	cmp    $0x3ba,%eax
+  8017c4:	0f 85 92 00 00 00    	jne    80185c <fork+0x29c>
+		if(addr >= UTOP - NTHREADS * TSTACKSIZE
+  8017ca:	81 fb ff ff af ee    	cmp    $0xeeafffff,%ebx
+  8017d0:	76 10                	jbe    8017e2 <fork+0x222>
+		   && (UTOP - addr) % TSTACKSIZE == PGSIZE)
+  8017d2:	89 d8                	mov    %ebx,%eax
+  8017d4:	f7 d8                	neg    %eax
+  8017d6:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8017db:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8017e0:	74 ba                	je     80179c <fork+0x1dc>
+		pn = addr >> PGSHIFT;
+  8017e2:	89 d8                	mov    %ebx,%eax
+  8017e4:	c1 e8 0c             	shr    $0xc,%eax
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8017e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017ee:	f6 c2 01             	test   $0x1,%dl
+  8017f1:	74 a9                	je     80179c <fork+0x1dc>
+	uintptr_t addr = pn * PGSIZE;
+  8017f3:	89 c1                	mov    %eax,%ecx
+  8017f5:	c1 e1 0c             	shl    $0xc,%ecx
+  8017f8:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	if (vpt[pn] & PTE_SHARE)
+  8017fb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801802:	f6 c6 04             	test   $0x4,%dh
+  801805:	0f 85 8e 00 00 00    	jne    801899 <fork+0x2d9>
+	if ((vpt[pn] & PTE_COW) || (vpt[pn] & PTE_W)) {
+  80180b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801812:	f6 c6 08             	test   $0x8,%dh
+  801815:	75 0f                	jne    801826 <fork+0x266>
+  801817:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80181e:	a8 02                	test   $0x2,%al
+  801820:	0f 84 bb 00 00 00    	je     8018e1 <fork+0x321>
+		if((ret = pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm)) < 0)
+  801826:	83 ec 08             	sub    $0x8,%esp
+  801829:	68 05 08 00 00       	push   $0x805
+  80182e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801831:	50                   	push   %eax
+  801832:	56                   	push   %esi
+  801833:	50                   	push   %eax
+  801834:	6a 00                	push   $0x0
+  801836:	68 20 63 80 00       	push   $0x806320
+  80183b:	e8 d2 24 00 00       	call   803d12 <pgbatch_map>
+  801840:	83 c4 20             	add    $0x20,%esp
+  801843:	85 c0                	test   %eax,%eax
+  801845:	79 76                	jns    8018bd <fork+0x2fd>
+			panic("duppage: %e", ret);
+  801847:	50                   	push   %eax
+  801848:	68 e7 4b 80 00       	push   $0x804be7
+  80184d:	68 bc 00 00 00       	push   $0xbc
+  801852:	68 94 4b 80 00       	push   $0x804b94
+  801857:	e8 56 eb ff ff       	call   8003b2 <_panic>
+			if((ret = pgbatch_sharept(&pb, 0, (void*)addr, envid, PTE_COW)) < 0)
+  80185c:	83 ec 0c             	sub    $0xc,%esp
+  80185f:	68 00 08 00 00       	push   $0x800
+  801864:	56                   	push   %esi
+  801865:	53                   	push   %ebx
+  801866:	6a 00                	push   $0x0
+  801868:	68 20 63 80 00       	push   $0x806320
+  80186d:	e8 4b 25 00 00       	call   803dbd <pgbatch_sharept>
+  801872:	83 c4 20             	add    $0x20,%esp
+  801875:	85 c0                	test   %eax,%eax
+  801877:	78 0b                	js     801884 <fork+0x2c4>
+			addr += PTSIZE - PGSIZE;
+  801879:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+			continue;
+  80187f:	e9 18 ff ff ff       	jmp    80179c <fork+0x1dc>
+				panic("pgbatch_sharept: %e", ret);
+  801884:	50                   	push   %eax
+  801885:	68 d3 4b 80 00       	push   $0x804bd3
+  80188a:	68 b2 00 00 00       	push   $0xb2
+  80188f:	68 94 4b 80 00       	push   $0x804b94
+  801894:	e8 19 eb ff ff       	call   8003b2 <_panic>
+		return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, vpt[pn] & PTE_SYSCALL);
+  801899:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018a0:	83 ec 08             	sub    $0x8,%esp
+  8018a3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018a8:	50                   	push   %eax
+  8018a9:	51                   	push   %ecx
+  8018aa:	56                   	push   %esi
+  8018ab:	51                   	push   %ecx
+  8018ac:	6a 00                	push   $0x0
+  8018ae:	68 20 63 80 00       	push   $0x806320
+  8018b3:	e8 5a 24 00 00       	call   803d12 <pgbatch_map>
+  8018b8:	83 c4 20             	add    $0x20,%esp
+  8018bb:	eb 17                	jmp    8018d4 <fork+0x314>
+		return pgbatch_protect(pb, 0, (void*)addr, perm);
+  8018bd:	68 05 08 00 00       	push   $0x805
+  8018c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8018c5:	6a 00                	push   $0x0
+  8018c7:	68 20 63 80 00       	push   $0x806320
+  8018cc:	e8 b5 24 00 00       	call   803d86 <pgbatch_protect>
+  8018d1:	83 c4 10             	add    $0x10,%esp
+		if((vpt[pn] & PTE_P) && (ret = duppage(&pb, envid, pn)) < 0)
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	0f 89 c0 fe ff ff    	jns    80179c <fork+0x1dc>
+  8018dc:	e9 66 ff ff ff       	jmp    801847 <fork+0x287>
+	return pgbatch_map(pb, 0, (void*)addr, envid, (void*)addr, perm);
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+  8018e4:	6a 05                	push   $0x5
+  8018e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018e9:	50                   	push   %eax
+  8018ea:	56                   	push   %esi
+  8018eb:	50                   	push   %eax
+  8018ec:	6a 00                	push   $0x0
+  8018ee:	68 20 63 80 00       	push   $0x806320
+  8018f3:	e8 1a 24 00 00       	call   803d12 <pgbatch_map>
+  8018f8:	83 c4 20             	add    $0x20,%esp
+  8018fb:	eb d7                	jmp    8018d4 <fork+0x314>
+	if((ret = pgbatch_alloc(&pb, envid, (void*)(UXSTACKTOP-PGSIZE), PTE_U|PTE_W|PTE_P)) < 0
+  8018fd:	6a 07                	push   $0x7
+  8018ff:	68 00 f0 bf ee       	push   $0xeebff000
+  801904:	57                   	push   %edi
+  801905:	68 20 63 80 00       	push   $0x806320
+  80190a:	e8 cc 23 00 00       	call   803cdb <pgbatch_alloc>
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	85 c0                	test   %eax,%eax
+  801914:	78 66                	js     80197c <fork+0x3bc>
+	   || (ret = pgbatch_flush(&pb)) < 0)
+  801916:	83 ec 0c             	sub    $0xc,%esp
+  801919:	68 20 63 80 00       	push   $0x806320
+  80191e:	e8 3f 23 00 00       	call   803c62 <pgbatch_flush>
+  801923:	83 c4 10             	add    $0x10,%esp
+  801926:	85 c0                	test   %eax,%eax
+  801928:	78 52                	js     80197c <fork+0x3bc>
+  80192a:	89 e2                	mov    %esp,%edx
+  80192c:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801931:	29 d0                	sub    %edx,%eax
+  801933:	89 c2                	mov    %eax,%edx
+  801935:	c1 ea 0f             	shr    $0xf,%edx
+  801938:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80193d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801942:	0f 42 c2             	cmovb  %edx,%eax
+	if((ret = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  801945:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80194c:	8b 40 78             	mov    0x78(%eax),%eax
+  80194f:	83 ec 08             	sub    $0x8,%esp
+  801952:	50                   	push   %eax
+  801953:	57                   	push   %edi
+  801954:	e8 aa f7 ff ff       	call   801103 <sys_env_set_pgfault_upcall>
+  801959:	83 c4 10             	add    $0x10,%esp
+  80195c:	85 c0                	test   %eax,%eax
+  80195e:	78 31                	js     801991 <fork+0x3d1>
+	if((ret = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) 
+  801960:	83 ec 08             	sub    $0x8,%esp
+  801963:	6a 02                	push   $0x2
+  801965:	57                   	push   %edi
+  801966:	e8 14 f7 ff ff       	call   80107f <sys_env_set_status>
+  80196b:	83 c4 10             	add    $0x10,%esp
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 34                	js     8019a6 <fork+0x3e6>
+}
+  801972:	89 f0                	mov    %esi,%eax
+  801974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5f                   	pop    %edi
+  80197a:	5d                   	pop    %ebp
+  80197b:	c3                   	ret
+		panic("fork: page batch: %e", ret);
+  80197c:	50                   	push   %eax
+  80197d:	68 f3 4b 80 00       	push   $0x804bf3
+  801982:	68 c0 00 00 00       	push   $0xc0
+  801987:	68 94 4b 80 00       	push   $0x804b94
+  80198c:	e8 21 ea ff ff       	call   8003b2 <_panic>
+		panic("sys_env_pgfault_upcall: %e", ret);
+  801991:	50                   	push   %eax
+  801992:	68 08 4c 80 00       	push   $0x804c08
+  801997:	68 c2 00 00 00       	push   $0xc2
+  80199c:	68 94 4b 80 00       	push   $0x804b94
+  8019a1:	e8 0c ea ff ff       	call   8003b2 <_panic>
+		panic("sys_env_set_status: %e", ret);
+  8019a6:	50                   	push   %eax
+  8019a7:	68 23 4c 80 00       	push   $0x804c23
+  8019ac:	68 c4 00 00 00       	push   $0xc4
+  8019b1:	68 94 4b 80 00       	push   $0x804b94
+  8019b6:	e8 f7 e9 ff ff       	call   8003b2 <_panic>
+
+008019bb <sfork>:
+// Returns the thread's envid, or < 0 on error: -E_NO_FREE_ENV if all
+// stack slots are in use, or the error of a system call.
+//
+envid_t
+sfork(void (*fn)(void *), void *arg)
+{
+  8019bb:	55                   	push   %ebp
+  8019bc:	89 e5                	mov    %esp,%ebp
+  8019be:	57                   	push   %edi
+  8019bf:	56                   	push   %esi
+  8019c0:	53                   	push   %ebx
+  8019c1:	83 ec 28             	sub    $0x28,%esp
+	uintptr_t top, addr;
+	uint32_t *sp;
+	envid_t id;
+	int i, r;
+
+	mutex_lock(&sfork_lock);
+  8019c4:	68 c0 66 80 00       	push   $0x8066c0
+  8019c9:	e8 3a 24 00 00       	call   803e08 <mutex_lock>
+  8019ce:	89 e2                	mov    %esp,%edx
+  8019d0:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8019d5:	29 d0                	sub    %edx,%eax
+
+	return slot < NTHREADS ? slot : 0;
+  8019d7:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8019da:	89 c3                	mov    %eax,%ebx
+  8019dc:	c1 eb 0f             	shr    $0xf,%ebx
+  8019df:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8019e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e9:	0f 43 d8             	cmovae %eax,%ebx
+	// Slot 0 is the first thread's.  Ours may be another in the child
+	// of a fork made by another thread.
+	thread_ids[thread_slot()] = sys_getenvid();
+  8019ec:	e8 89 f5 ff ff       	call   800f7a <sys_getenvid>
+  8019f1:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	for (i = 1; i < NTHREADS && thread_alive(thread_ids[i]); i++)
+  8019f8:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8019fd:	8b 04 9d 40 66 80 00 	mov    0x806640(,%ebx,4),%eax
+  801a04:	e8 12 fa ff ff       	call   80141b <thread_alive>
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	74 24                	je     801a31 <sfork+0x76>
+  801a0d:	83 c3 01             	add    $0x1,%ebx
+  801a10:	83 fb 20             	cmp    $0x20,%ebx
+  801a13:	75 e8                	jne    8019fd <sfork+0x42>
+		;
+	if (i == NTHREADS) {
+		r = -E_NO_FREE_ENV;
+  801a15:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+		sys_env_destroy(id);
+		goto out;
+	}
+	r = id;
+out:
+	mutex_unlock(&sfork_lock);
+  801a1a:	83 ec 0c             	sub    $0xc,%esp
+  801a1d:	68 c0 66 80 00       	push   $0x8066c0
+  801a22:	e8 4f 24 00 00       	call   803e76 <mutex_unlock>
+	return r;
+}
+  801a27:	89 f0                	mov    %esi,%eax
+  801a29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a2c:	5b                   	pop    %ebx
+  801a2d:	5e                   	pop    %esi
+  801a2e:	5f                   	pop    %edi
+  801a2f:	5d                   	pop    %ebp
+  801a30:	c3                   	ret
+	if (i == NTHREADS) {
+  801a31:	83 fb 20             	cmp    $0x20,%ebx
+  801a34:	0f 84 53 01 00 00    	je     801b8d <sfork+0x1d2>
+	top = UTOP - i * TSTACKSIZE;
+  801a3a:	89 d8                	mov    %ebx,%eax
+  801a3c:	c1 e0 0f             	shl    $0xf,%eax
+  801a3f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	pgbatch_init(&pb);
+  801a42:	83 ec 0c             	sub    $0xc,%esp
+  801a45:	68 00 60 80 00       	push   $0x806000
+  801a4a:	e8 05 22 00 00       	call   803c54 <pgbatch_init>
+	if (!sforked && (r = pgbatch_alloc(&pb, 0, cow_locks,
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	83 3d 80 6a 80 00 00 	cmpl   $0x0,0x806a80
+  801a59:	75 1f                	jne    801a7a <sfork+0xbf>
+  801a5b:	68 07 04 00 00       	push   $0x407
+  801a60:	68 00 00 00 e1       	push   $0xe1000000
+  801a65:	6a 00                	push   $0x0
+  801a67:	68 00 60 80 00       	push   $0x806000
+  801a6c:	e8 6a 22 00 00       	call   803cdb <pgbatch_alloc>
+  801a71:	89 c6                	mov    %eax,%esi
+  801a73:	83 c4 10             	add    $0x10,%esp
+  801a76:	85 c0                	test   %eax,%eax
+  801a78:	78 a0                	js     801a1a <sfork+0x5f>
+	if ((r = pgbatch_alloc(&pb, 0, (void *) (top - PGSIZE),
+  801a7a:	6a 07                	push   $0x7
+  801a7c:	b8 00 f0 bf ee       	mov    $0xeebff000,%eax
+  801a81:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a84:	29 c8                	sub    %ecx,%eax
+  801a86:	50                   	push   %eax
+  801a87:	6a 00                	push   $0x0
+  801a89:	68 00 60 80 00       	push   $0x806000
+  801a8e:	e8 48 22 00 00       	call   803cdb <pgbatch_alloc>
+  801a93:	89 c6                	mov    %eax,%esi
+  801a95:	83 c4 10             	add    $0x10,%esp
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	0f 88 7a ff ff ff    	js     801a1a <sfork+0x5f>
+	for (addr = top - 2 * PGSIZE - TSTACKPAGES * PGSIZE;
+  801aa0:	bf 00 a0 bf ee       	mov    $0xeebfa000,%edi
+  801aa5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801aa8:	29 cf                	sub    %ecx,%edi
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801aaa:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  801aaf:	29 c8                	sub    %ecx,%eax
+  801ab1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801ab4:	39 c7                	cmp    %eax,%edi
+  801ab6:	73 29                	jae    801ae1 <sfork+0x126>
+		if ((r = pgbatch_alloc(&pb, 0, (void *) addr,
+  801ab8:	6a 07                	push   $0x7
+  801aba:	57                   	push   %edi
+  801abb:	6a 00                	push   $0x0
+  801abd:	68 00 60 80 00       	push   $0x806000
+  801ac2:	e8 14 22 00 00       	call   803cdb <pgbatch_alloc>
+  801ac7:	89 c6                	mov    %eax,%esi
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	0f 88 46 ff ff ff    	js     801a1a <sfork+0x5f>
+	     addr < top - 2 * PGSIZE; addr += PGSIZE)
+  801ad4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801ada:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801add:	39 c7                	cmp    %eax,%edi
+  801adf:	72 d7                	jb     801ab8 <sfork+0xfd>
+	if ((r = pgbatch_flush(&pb)) < 0)
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	68 00 60 80 00       	push   $0x806000
+  801ae9:	e8 74 21 00 00       	call   803c62 <pgbatch_flush>
+  801aee:	89 c6                	mov    %eax,%esi
+  801af0:	83 c4 10             	add    $0x10,%esp
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	0f 88 1f ff ff ff    	js     801a1a <sfork+0x5f>
+	sp = (uint32_t *) (top - 2 * PGSIZE) - 3;
+  801afb:	b8 f4 df bf ee       	mov    $0xeebfdff4,%eax
+  801b00:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b03:	29 c8                	sub    %ecx,%eax
+	sp[0] = 0;
+  801b05:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	sp[1] = (uint32_t) fn;
+  801b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801b0e:	89 50 04             	mov    %edx,0x4(%eax)
+	sp[2] = (uint32_t) arg;
+  801b11:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b14:	89 50 08             	mov    %edx,0x8(%eax)
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b17:	83 ec 04             	sub    $0x4,%esp
+	top = UTOP - i * TSTACKSIZE;
+  801b1a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b1f:	29 ca                	sub    %ecx,%edx
+	if ((id = sys_exofork_shared(thread_main, sp, (void *) top)) < 0) {
+  801b21:	52                   	push   %edx
+  801b22:	50                   	push   %eax
+  801b23:	68 a3 15 80 00       	push   $0x8015a3
+  801b28:	e8 cc f8 ff ff       	call   8013f9 <sys_exofork_shared>
+  801b2d:	89 c6                	mov    %eax,%esi
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	0f 88 e0 fe ff ff    	js     801a1a <sfork+0x5f>
+	thread_ids[i] = id;
+  801b3a:	89 04 9d 40 66 80 00 	mov    %eax,0x806640(,%ebx,4)
+	thread_envs[i] = &envs[ENVX(id)];
+  801b41:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b46:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  801b4c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b51:	89 04 9d 00 6a 80 00 	mov    %eax,0x806a00(,%ebx,4)
+	sforked = 1;
+  801b58:	c7 05 80 6a 80 00 01 	movl   $0x1,0x806a80
+  801b5f:	00 00 00 
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b62:	83 ec 08             	sub    $0x8,%esp
+  801b65:	6a 02                	push   $0x2
+  801b67:	56                   	push   %esi
+  801b68:	e8 12 f5 ff ff       	call   80107f <sys_env_set_status>
+  801b6d:	89 c3                	mov    %eax,%ebx
+  801b6f:	83 c4 10             	add    $0x10,%esp
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	0f 89 a0 fe ff ff    	jns    801a1a <sfork+0x5f>
+		sys_env_destroy(id);
+  801b7a:	83 ec 0c             	sub    $0xc,%esp
+  801b7d:	56                   	push   %esi
+  801b7e:	e8 b6 f3 ff ff       	call   800f39 <sys_env_destroy>
+		goto out;
+  801b83:	83 c4 10             	add    $0x10,%esp
+	if ((r = sys_env_set_status(id, ENV_RUNNABLE)) < 0) {
+  801b86:	89 de                	mov    %ebx,%esi
+		goto out;
+  801b88:	e9 8d fe ff ff       	jmp    801a1a <sfork+0x5f>
+		r = -E_NO_FREE_ENV;
+  801b8d:	be fb ff ff ff       	mov    $0xfffffffb,%esi
+  801b92:	e9 83 fe ff ff       	jmp    801a1a <sfork+0x5f>
+
+00801b97 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801ba2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801ba5:	5d                   	pop    %ebp
+  801ba6:	c3                   	ret
+
+00801ba7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801baa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bad:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801bb2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bb7:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  801bbc:	5d                   	pop    %ebp
+  801bbd:	c3                   	ret
+
+00801bbe <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801bbe:	55                   	push   %ebp
+  801bbf:	89 e5                	mov    %esp,%ebp
+  801bc1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801bc6:	89 c2                	mov    %eax,%edx
+  801bc8:	c1 ea 16             	shr    $0x16,%edx
+  801bcb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801bd2:	f6 c2 01             	test   $0x1,%dl
+  801bd5:	74 29                	je     801c00 <fd_alloc+0x42>
+  801bd7:	89 c2                	mov    %eax,%edx
+  801bd9:	c1 ea 0c             	shr    $0xc,%edx
+  801bdc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801be3:	f6 c2 01             	test   $0x1,%dl
+  801be6:	74 18                	je     801c00 <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801be8:	05 00 10 00 00       	add    $0x1000,%eax
+  801bed:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801bf2:	75 d2                	jne    801bc6 <fd_alloc+0x8>
+  801bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801bf9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801bfe:	eb 05                	jmp    801c05 <fd_alloc+0x47>
+			return 0;
+  801c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801c05:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c08:	89 02                	mov    %eax,(%edx)
+}
+  801c0a:	89 c8                	mov    %ecx,%eax
+  801c0c:	5d                   	pop    %ebp
+  801c0d:	c3                   	ret
+
+00801c0e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c0e:	55                   	push   %ebp
+  801c0f:	89 e5                	mov    %esp,%ebp
+  801c11:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c14:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801c19:	77 30                	ja     801c4b <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c1b:	c1 e0 0c             	shl    $0xc,%eax
+  801c1e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801c23:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c29:	f6 c2 01             	test   $0x1,%dl
+  801c2c:	74 24                	je     801c52 <fd_lookup+0x44>
+  801c2e:	89 c2                	mov    %eax,%edx
+  801c30:	c1 ea 0c             	shr    $0xc,%edx
+  801c33:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c3a:	f6 c2 01             	test   $0x1,%dl
+  801c3d:	74 1a                	je     801c59 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c42:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c49:	5d                   	pop    %ebp
+  801c4a:	c3                   	ret
+		return -E_INVAL;
+  801c4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c50:	eb f7                	jmp    801c49 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801c52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c57:	eb f0                	jmp    801c49 <fd_lookup+0x3b>
+  801c59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c5e:	eb e9                	jmp    801c49 <fd_lookup+0x3b>
+
+00801c60 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801c60:	55                   	push   %ebp
+  801c61:	89 e5                	mov    %esp,%ebp
+  801c63:	53                   	push   %ebx
+  801c64:	83 ec 04             	sub    $0x4,%esp
+  801c67:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c6f:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  801c74:	39 13                	cmp    %edx,(%ebx)
+  801c76:	74 54                	je     801ccc <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  801c78:	83 c0 01             	add    $0x1,%eax
+  801c7b:	8b 1c 85 d8 4c 80 00 	mov    0x804cd8(,%eax,4),%ebx
+  801c82:	85 db                	test   %ebx,%ebx
+  801c84:	75 ee                	jne    801c74 <dev_lookup+0x14>
+  801c86:	89 e1                	mov    %esp,%ecx
+  801c88:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801c8d:	29 c8                	sub    %ecx,%eax
+  801c8f:	89 c1                	mov    %eax,%ecx
+  801c91:	c1 e9 0f             	shr    $0xf,%ecx
+  801c94:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801c99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c9e:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ca1:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801ca8:	8b 40 48             	mov    0x48(%eax),%eax
+  801cab:	83 ec 04             	sub    $0x4,%esp
+  801cae:	52                   	push   %edx
+  801caf:	50                   	push   %eax
+  801cb0:	68 5c 4c 80 00       	push   $0x804c5c
+  801cb5:	e8 d3 e7 ff ff       	call   80048d <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cc5:	89 1a                	mov    %ebx,(%edx)
+}
+  801cc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cca:	c9                   	leave
+  801ccb:	c3                   	ret
+			return 0;
+  801ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd1:	eb ef                	jmp    801cc2 <dev_lookup+0x62>
+
+00801cd3 <fd_close>:
+{
+  801cd3:	55                   	push   %ebp
+  801cd4:	89 e5                	mov    %esp,%ebp
+  801cd6:	57                   	push   %edi
+  801cd7:	56                   	push   %esi
+  801cd8:	53                   	push   %ebx
+  801cd9:	83 ec 24             	sub    $0x24,%esp
+  801cdc:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cdf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ce2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ce5:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ce6:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801cec:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cef:	50                   	push   %eax
+  801cf0:	e8 19 ff ff ff       	call   801c0e <fd_lookup>
+  801cf5:	89 c3                	mov    %eax,%ebx
+  801cf7:	83 c4 10             	add    $0x10,%esp
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 05                	js     801d03 <fd_close+0x30>
+	    || fd != fd2)
+  801cfe:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d01:	74 0f                	je     801d12 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801d03:	85 ff                	test   %edi,%edi
+  801d05:	0f 44 df             	cmove  %edi,%ebx
+}
+  801d08:	89 d8                	mov    %ebx,%eax
+  801d0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d0d:	5b                   	pop    %ebx
+  801d0e:	5e                   	pop    %esi
+  801d0f:	5f                   	pop    %edi
+  801d10:	5d                   	pop    %ebp
+  801d11:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d12:	83 ec 08             	sub    $0x8,%esp
+  801d15:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d18:	50                   	push   %eax
+  801d19:	ff 36                	push   (%esi)
+  801d1b:	e8 40 ff ff ff       	call   801c60 <dev_lookup>
+  801d20:	89 c3                	mov    %eax,%ebx
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 1a                	js     801d43 <fd_close+0x70>
+		if (dev->dev_close)
+  801d29:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d2c:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d34:	85 c0                	test   %eax,%eax
+  801d36:	74 0b                	je     801d43 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801d38:	83 ec 0c             	sub    $0xc,%esp
+  801d3b:	56                   	push   %esi
+  801d3c:	ff d0                	call   *%eax
+  801d3e:	89 c3                	mov    %eax,%ebx
+  801d40:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d43:	83 ec 08             	sub    $0x8,%esp
+  801d46:	56                   	push   %esi
+  801d47:	6a 00                	push   $0x0
+  801d49:	e8 ef f2 ff ff       	call   80103d <sys_page_unmap>
+	return r;
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	eb b5                	jmp    801d08 <fd_close+0x35>
+
+00801d53 <close>:
+
+int
+close(int fdnum)
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+  801d56:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d5c:	50                   	push   %eax
+  801d5d:	ff 75 08             	push   0x8(%ebp)
+  801d60:	e8 a9 fe ff ff       	call   801c0e <fd_lookup>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	79 02                	jns    801d6e <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d6c:	c9                   	leave
+  801d6d:	c3                   	ret
+		return fd_close(fd, 1);
+  801d6e:	83 ec 08             	sub    $0x8,%esp
+  801d71:	6a 01                	push   $0x1
+  801d73:	ff 75 f4             	push   -0xc(%ebp)
+  801d76:	e8 58 ff ff ff       	call   801cd3 <fd_close>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	eb ec                	jmp    801d6c <close+0x19>
+
+00801d80 <close_all>:
+
+void
+close_all(void)
+{
+  801d80:	55                   	push   %ebp
+  801d81:	89 e5                	mov    %esp,%ebp
+  801d83:	53                   	push   %ebx
+  801d84:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801d87:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801d8c:	83 ec 0c             	sub    $0xc,%esp
+  801d8f:	53                   	push   %ebx
+  801d90:	e8 be ff ff ff       	call   801d53 <close>
+	for (i = 0; i < MAXFD; i++)
+  801d95:	83 c3 01             	add    $0x1,%ebx
+  801d98:	83 c4 10             	add    $0x10,%esp
+  801d9b:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  801da1:	75 e9                	jne    801d8c <close_all+0xc>
+}
+  801da3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801da6:	c9                   	leave
+  801da7:	c3                   	ret
+
+00801da8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801da8:	55                   	push   %ebp
+  801da9:	89 e5                	mov    %esp,%ebp
+  801dab:	57                   	push   %edi
+  801dac:	56                   	push   %esi
+  801dad:	53                   	push   %ebx
+  801dae:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801db1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801db4:	50                   	push   %eax
+  801db5:	ff 75 08             	push   0x8(%ebp)
+  801db8:	e8 51 fe ff ff       	call   801c0e <fd_lookup>
+  801dbd:	89 c3                	mov    %eax,%ebx
+  801dbf:	83 c4 10             	add    $0x10,%esp
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	78 7f                	js     801e45 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801dc6:	83 ec 0c             	sub    $0xc,%esp
+  801dc9:	ff 75 0c             	push   0xc(%ebp)
+  801dcc:	e8 82 ff ff ff       	call   801d53 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801dd1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801dd4:	c1 e6 0c             	shl    $0xc,%esi
+  801dd7:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801ddd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de0:	89 3c 24             	mov    %edi,(%esp)
+  801de3:	e8 bf fd ff ff       	call   801ba7 <fd2data>
+  801de8:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801dea:	89 34 24             	mov    %esi,(%esp)
+  801ded:	e8 b5 fd ff ff       	call   801ba7 <fd2data>
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801df8:	89 d8                	mov    %ebx,%eax
+  801dfa:	c1 e8 16             	shr    $0x16,%eax
+  801dfd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e04:	a8 01                	test   $0x1,%al
+  801e06:	74 11                	je     801e19 <dup+0x71>
+  801e08:	89 d8                	mov    %ebx,%eax
+  801e0a:	c1 e8 0c             	shr    $0xc,%eax
+  801e0d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e14:	f6 c2 01             	test   $0x1,%dl
+  801e17:	75 36                	jne    801e4f <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e19:	89 f8                	mov    %edi,%eax
+  801e1b:	c1 e8 0c             	shr    $0xc,%eax
+  801e1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e25:	83 ec 0c             	sub    $0xc,%esp
+  801e28:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e2d:	50                   	push   %eax
+  801e2e:	56                   	push   %esi
+  801e2f:	6a 00                	push   $0x0
+  801e31:	57                   	push   %edi
+  801e32:	6a 00                	push   $0x0
+  801e34:	e8 c2 f1 ff ff       	call   800ffb <sys_page_map>
+  801e39:	89 c3                	mov    %eax,%ebx
+  801e3b:	83 c4 20             	add    $0x20,%esp
+  801e3e:	85 c0                	test   %eax,%eax
+  801e40:	78 33                	js     801e75 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e45:	89 d8                	mov    %ebx,%eax
+  801e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4a:	5b                   	pop    %ebx
+  801e4b:	5e                   	pop    %esi
+  801e4c:	5f                   	pop    %edi
+  801e4d:	5d                   	pop    %ebp
+  801e4e:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e4f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e5e:	50                   	push   %eax
+  801e5f:	ff 75 d4             	push   -0x2c(%ebp)
+  801e62:	6a 00                	push   $0x0
+  801e64:	53                   	push   %ebx
+  801e65:	6a 00                	push   $0x0
+  801e67:	e8 8f f1 ff ff       	call   800ffb <sys_page_map>
+  801e6c:	89 c3                	mov    %eax,%ebx
+  801e6e:	83 c4 20             	add    $0x20,%esp
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	79 a4                	jns    801e19 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e75:	83 ec 08             	sub    $0x8,%esp
+  801e78:	56                   	push   %esi
+  801e79:	6a 00                	push   $0x0
+  801e7b:	e8 bd f1 ff ff       	call   80103d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e80:	83 c4 08             	add    $0x8,%esp
+  801e83:	ff 75 d4             	push   -0x2c(%ebp)
+  801e86:	6a 00                	push   $0x0
+  801e88:	e8 b0 f1 ff ff       	call   80103d <sys_page_unmap>
+	return r;
+  801e8d:	83 c4 10             	add    $0x10,%esp
+  801e90:	eb b3                	jmp    801e45 <dup+0x9d>
+
+00801e92 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801e92:	55                   	push   %ebp
+  801e93:	89 e5                	mov    %esp,%ebp
+  801e95:	56                   	push   %esi
+  801e96:	53                   	push   %ebx
+  801e97:	83 ec 18             	sub    $0x18,%esp
+  801e9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ea0:	50                   	push   %eax
+  801ea1:	53                   	push   %ebx
+  801ea2:	e8 67 fd ff ff       	call   801c0e <fd_lookup>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	78 3c                	js     801eea <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801eae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eb1:	83 ec 08             	sub    $0x8,%esp
+  801eb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb7:	50                   	push   %eax
+  801eb8:	ff 36                	push   (%esi)
+  801eba:	e8 a1 fd ff ff       	call   801c60 <dev_lookup>
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 24                	js     801eea <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ec6:	8b 46 08             	mov    0x8(%esi),%eax
+  801ec9:	83 e0 03             	and    $0x3,%eax
+  801ecc:	83 f8 01             	cmp    $0x1,%eax
+  801ecf:	74 20                	je     801ef1 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ed1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed4:	8b 40 08             	mov    0x8(%eax),%eax
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	74 54                	je     801f2f <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801edb:	83 ec 04             	sub    $0x4,%esp
+  801ede:	ff 75 10             	push   0x10(%ebp)
+  801ee1:	ff 75 0c             	push   0xc(%ebp)
+  801ee4:	56                   	push   %esi
+  801ee5:	ff d0                	call   *%eax
+  801ee7:	83 c4 10             	add    $0x10,%esp
+}
+  801eea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eed:	5b                   	pop    %ebx
+  801eee:	5e                   	pop    %esi
+  801eef:	5d                   	pop    %ebp
+  801ef0:	c3                   	ret
+  801ef1:	89 e2                	mov    %esp,%edx
+  801ef3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801ef8:	29 d0                	sub    %edx,%eax
+  801efa:	89 c2                	mov    %eax,%edx
+  801efc:	c1 ea 0f             	shr    $0xf,%edx
+  801eff:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f09:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f0c:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  801f13:	8b 40 48             	mov    0x48(%eax),%eax
+  801f16:	83 ec 04             	sub    $0x4,%esp
+  801f19:	53                   	push   %ebx
+  801f1a:	50                   	push   %eax
+  801f1b:	68 9d 4c 80 00       	push   $0x804c9d
+  801f20:	e8 68 e5 ff ff       	call   80048d <cprintf>
+		return -E_INVAL;
+  801f25:	83 c4 10             	add    $0x10,%esp
+  801f28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2d:	eb bb                	jmp    801eea <read+0x58>
+		return -E_NOT_SUPP;
+  801f2f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f34:	eb b4                	jmp    801eea <read+0x58>
+
+00801f36 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	57                   	push   %edi
+  801f3a:	56                   	push   %esi
+  801f3b:	53                   	push   %ebx
+  801f3c:	83 ec 0c             	sub    $0xc,%esp
+  801f3f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f42:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f45:	85 f6                	test   %esi,%esi
+  801f47:	74 30                	je     801f79 <readn+0x43>
+  801f49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f53:	83 ec 04             	sub    $0x4,%esp
+  801f56:	89 f2                	mov    %esi,%edx
+  801f58:	29 c2                	sub    %eax,%edx
+  801f5a:	52                   	push   %edx
+  801f5b:	01 f8                	add    %edi,%eax
+  801f5d:	50                   	push   %eax
+  801f5e:	ff 75 08             	push   0x8(%ebp)
+  801f61:	e8 2c ff ff ff       	call   801e92 <read>
+		if (m < 0)
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	78 15                	js     801f82 <readn+0x4c>
+			return m;
+		if (m == 0)
+  801f6d:	74 11                	je     801f80 <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  801f6f:	01 c3                	add    %eax,%ebx
+  801f71:	89 d8                	mov    %ebx,%eax
+  801f73:	39 f3                	cmp    %esi,%ebx
+  801f75:	72 dc                	jb     801f53 <readn+0x1d>
+  801f77:	eb 09                	jmp    801f82 <readn+0x4c>
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7e:	eb 02                	jmp    801f82 <readn+0x4c>
+  801f80:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  801f82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f85:	5b                   	pop    %ebx
+  801f86:	5e                   	pop    %esi
+  801f87:	5f                   	pop    %edi
+  801f88:	5d                   	pop    %ebp
+  801f89:	c3                   	ret
+
+00801f8a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f8a:	55                   	push   %ebp
+  801f8b:	89 e5                	mov    %esp,%ebp
+  801f8d:	56                   	push   %esi
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 18             	sub    $0x18,%esp
+  801f92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f95:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f98:	50                   	push   %eax
+  801f99:	53                   	push   %ebx
+  801f9a:	e8 6f fc ff ff       	call   801c0e <fd_lookup>
+  801f9f:	83 c4 10             	add    $0x10,%esp
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 37                	js     801fdd <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fa6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fa9:	83 ec 08             	sub    $0x8,%esp
+  801fac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801faf:	50                   	push   %eax
+  801fb0:	ff 36                	push   (%esi)
+  801fb2:	e8 a9 fc ff ff       	call   801c60 <dev_lookup>
+  801fb7:	83 c4 10             	add    $0x10,%esp
+  801fba:	85 c0                	test   %eax,%eax
+  801fbc:	78 1f                	js     801fdd <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fbe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fc2:	74 20                	je     801fe4 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fc7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	74 54                	je     802022 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fce:	83 ec 04             	sub    $0x4,%esp
+  801fd1:	ff 75 10             	push   0x10(%ebp)
+  801fd4:	ff 75 0c             	push   0xc(%ebp)
+  801fd7:	56                   	push   %esi
+  801fd8:	ff d0                	call   *%eax
+  801fda:	83 c4 10             	add    $0x10,%esp
+}
+  801fdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fe0:	5b                   	pop    %ebx
+  801fe1:	5e                   	pop    %esi
+  801fe2:	5d                   	pop    %ebp
+  801fe3:	c3                   	ret
+  801fe4:	89 e2                	mov    %esp,%edx
+  801fe6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801feb:	29 d0                	sub    %edx,%eax
+  801fed:	89 c2                	mov    %eax,%edx
+  801fef:	c1 ea 0f             	shr    $0xf,%edx
+  801ff2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ffc:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fff:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802006:	8b 40 48             	mov    0x48(%eax),%eax
+  802009:	83 ec 04             	sub    $0x4,%esp
+  80200c:	53                   	push   %ebx
+  80200d:	50                   	push   %eax
+  80200e:	68 b9 4c 80 00       	push   $0x804cb9
+  802013:	e8 75 e4 ff ff       	call   80048d <cprintf>
+		return -E_INVAL;
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802020:	eb bb                	jmp    801fdd <write+0x53>
+		return -E_NOT_SUPP;
+  802022:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802027:	eb b4                	jmp    801fdd <write+0x53>
+
+00802029 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80202f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802032:	50                   	push   %eax
+  802033:	ff 75 08             	push   0x8(%ebp)
+  802036:	e8 d3 fb ff ff       	call   801c0e <fd_lookup>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 0e                	js     802050 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  802042:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802045:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802048:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+
+00802052 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  802052:	55                   	push   %ebp
+  802053:	89 e5                	mov    %esp,%ebp
+  802055:	53                   	push   %ebx
+  802056:	83 ec 1c             	sub    $0x1c,%esp
+  802059:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80205c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205f:	50                   	push   %eax
+  802060:	ff 75 08             	push   0x8(%ebp)
+  802063:	e8 a6 fb ff ff       	call   801c0e <fd_lookup>
+  802068:	83 c4 10             	add    $0x10,%esp
+  80206b:	85 c0                	test   %eax,%eax
+  80206d:	78 33                	js     8020a2 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80206f:	83 fb 03             	cmp    $0x3,%ebx
+  802072:	74 28                	je     80209c <fcntl+0x4a>
+  802074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802079:	83 fb 04             	cmp    $0x4,%ebx
+  80207c:	75 24                	jne    8020a2 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  80207e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  802081:	8b 41 08             	mov    0x8(%ecx),%eax
+  802084:	80 e4 ef             	and    $0xef,%ah
+  802087:	8b 55 10             	mov    0x10(%ebp),%edx
+  80208a:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  802090:	09 d0                	or     %edx,%eax
+  802092:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  802095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209a:	eb 06                	jmp    8020a2 <fcntl+0x50>
+		return fd->fd_omode;
+  80209c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80209f:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8020a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a5:	c9                   	leave
+  8020a6:	c3                   	ret
+
+008020a7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	56                   	push   %esi
+  8020ab:	53                   	push   %ebx
+  8020ac:	83 ec 18             	sub    $0x18,%esp
+  8020af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020b2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b5:	50                   	push   %eax
+  8020b6:	53                   	push   %ebx
+  8020b7:	e8 52 fb ff ff       	call   801c0e <fd_lookup>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	78 34                	js     8020f7 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020c3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020c6:	83 ec 08             	sub    $0x8,%esp
+  8020c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020cc:	50                   	push   %eax
+  8020cd:	ff 36                	push   (%esi)
+  8020cf:	e8 8c fb ff ff       	call   801c60 <dev_lookup>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 1c                	js     8020f7 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020db:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8020df:	74 1d                	je     8020fe <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8020e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e4:	8b 40 18             	mov    0x18(%eax),%eax
+  8020e7:	85 c0                	test   %eax,%eax
+  8020e9:	74 51                	je     80213c <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8020eb:	83 ec 08             	sub    $0x8,%esp
+  8020ee:	ff 75 0c             	push   0xc(%ebp)
+  8020f1:	56                   	push   %esi
+  8020f2:	ff d0                	call   *%eax
+  8020f4:	83 c4 10             	add    $0x10,%esp
+}
+  8020f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020fa:	5b                   	pop    %ebx
+  8020fb:	5e                   	pop    %esi
+  8020fc:	5d                   	pop    %ebp
+  8020fd:	c3                   	ret
+  8020fe:	89 e2                	mov    %esp,%edx
+  802100:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802105:	29 d0                	sub    %edx,%eax
+  802107:	89 c2                	mov    %eax,%edx
+  802109:	c1 ea 0f             	shr    $0xf,%edx
+  80210c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802111:	b8 00 00 00 00       	mov    $0x0,%eax
+  802116:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  802119:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  802120:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802123:	83 ec 04             	sub    $0x4,%esp
+  802126:	53                   	push   %ebx
+  802127:	50                   	push   %eax
+  802128:	68 7c 4c 80 00       	push   $0x804c7c
+  80212d:	e8 5b e3 ff ff       	call   80048d <cprintf>
+		return -E_INVAL;
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80213a:	eb bb                	jmp    8020f7 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80213c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802141:	eb b4                	jmp    8020f7 <ftruncate+0x50>
+
+00802143 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802143:	55                   	push   %ebp
+  802144:	89 e5                	mov    %esp,%ebp
+  802146:	56                   	push   %esi
+  802147:	53                   	push   %ebx
+  802148:	83 ec 18             	sub    $0x18,%esp
+  80214b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80214e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802151:	50                   	push   %eax
+  802152:	ff 75 08             	push   0x8(%ebp)
+  802155:	e8 b4 fa ff ff       	call   801c0e <fd_lookup>
+  80215a:	83 c4 10             	add    $0x10,%esp
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 53                	js     8021b4 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802161:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802164:	83 ec 08             	sub    $0x8,%esp
+  802167:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80216a:	50                   	push   %eax
+  80216b:	ff 36                	push   (%esi)
+  80216d:	e8 ee fa ff ff       	call   801c60 <dev_lookup>
+  802172:	83 c4 10             	add    $0x10,%esp
+  802175:	85 c0                	test   %eax,%eax
+  802177:	78 3b                	js     8021b4 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  802179:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80217c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  802180:	74 39                	je     8021bb <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802182:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802185:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80218c:	00 00 00 
+	stat->st_isdir = 0;
+  80218f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802196:	00 00 00 
+	stat->st_version = 0;
+  802199:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8021a0:	00 00 00 
+	stat->st_dev = dev;
+  8021a3:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8021a9:	83 ec 08             	sub    $0x8,%esp
+  8021ac:	53                   	push   %ebx
+  8021ad:	56                   	push   %esi
+  8021ae:	ff 50 14             	call   *0x14(%eax)
+  8021b1:	83 c4 10             	add    $0x10,%esp
+}
+  8021b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021b7:	5b                   	pop    %ebx
+  8021b8:	5e                   	pop    %esi
+  8021b9:	5d                   	pop    %ebp
+  8021ba:	c3                   	ret
+		return -E_NOT_SUPP;
+  8021bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021c0:	eb f2                	jmp    8021b4 <fstat+0x71>
+
+008021c2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8021c2:	55                   	push   %ebp
+  8021c3:	89 e5                	mov    %esp,%ebp
+  8021c5:	56                   	push   %esi
+  8021c6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+  8021ca:	6a 00                	push   $0x0
+  8021cc:	ff 75 08             	push   0x8(%ebp)
+  8021cf:	e8 b7 01 00 00       	call   80238b <open>
+  8021d4:	89 c3                	mov    %eax,%ebx
+  8021d6:	83 c4 10             	add    $0x10,%esp
+  8021d9:	85 c0                	test   %eax,%eax
+  8021db:	78 1b                	js     8021f8 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8021dd:	83 ec 08             	sub    $0x8,%esp
+  8021e0:	ff 75 0c             	push   0xc(%ebp)
+  8021e3:	50                   	push   %eax
+  8021e4:	e8 5a ff ff ff       	call   802143 <fstat>
+  8021e9:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8021eb:	89 1c 24             	mov    %ebx,(%esp)
+  8021ee:	e8 60 fb ff ff       	call   801d53 <close>
+	return r;
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	89 f3                	mov    %esi,%ebx
+}
+  8021f8:	89 d8                	mov    %ebx,%eax
+  8021fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5d                   	pop    %ebp
+  802200:	c3                   	ret
+
+00802201 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802201:	55                   	push   %ebp
+  802202:	89 e5                	mov    %esp,%ebp
+  802204:	56                   	push   %esi
+  802205:	53                   	push   %ebx
+  802206:	89 c6                	mov    %eax,%esi
+  802208:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  80220a:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802211:	74 27                	je     80223a <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802213:	6a 07                	push   $0x7
+  802215:	68 00 70 80 00       	push   $0x807000
+  80221a:	56                   	push   %esi
+  80221b:	ff 35 c4 66 80 00    	push   0x8066c4
+  802221:	e8 22 22 00 00       	call   804448 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  802226:	83 c4 0c             	add    $0xc,%esp
+  802229:	6a 00                	push   $0x0
+  80222b:	53                   	push   %ebx
+  80222c:	6a 00                	push   $0x0
+  80222e:	e8 85 1f 00 00       	call   8041b8 <ipc_recv>
+}
+  802233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802236:	5b                   	pop    %ebx
+  802237:	5e                   	pop    %esi
+  802238:	5d                   	pop    %ebp
+  802239:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80223a:	83 ec 0c             	sub    $0xc,%esp
+  80223d:	6a 02                	push   $0x2
+  80223f:	e8 6d 22 00 00       	call   8044b1 <ipc_find_env>
+  802244:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	eb c5                	jmp    802213 <fsipc+0x12>
+
+0080224e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	8b 40 0c             	mov    0xc(%eax),%eax
+  80225a:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80225f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802262:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802267:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226c:	b8 02 00 00 00       	mov    $0x2,%eax
+  802271:	e8 8b ff ff ff       	call   802201 <fsipc>
+}
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+
+00802278 <devfile_flush>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80227e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802281:	8b 40 0c             	mov    0xc(%eax),%eax
+  802284:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802289:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228e:	b8 06 00 00 00       	mov    $0x6,%eax
+  802293:	e8 69 ff ff ff       	call   802201 <fsipc>
+}
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+
+0080229a <devfile_stat>:
+{
+  80229a:	55                   	push   %ebp
+  80229b:	89 e5                	mov    %esp,%ebp
+  80229d:	53                   	push   %ebx
+  80229e:	83 ec 04             	sub    $0x4,%esp
+  8022a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022aa:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8022af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022b9:	e8 43 ff ff ff       	call   802201 <fsipc>
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	78 37                	js     8022f9 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8022c2:	83 ec 08             	sub    $0x8,%esp
+  8022c5:	68 00 70 80 00       	push   $0x807000
+  8022ca:	53                   	push   %ebx
+  8022cb:	e8 b4 e8 ff ff       	call   800b84 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8022d0:	a1 80 70 80 00       	mov    0x807080,%eax
+  8022d5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8022db:	a1 84 70 80 00       	mov    0x807084,%eax
+  8022e0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  8022e6:	a1 88 70 80 00       	mov    0x807088,%eax
+  8022eb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022fc:	c9                   	leave
+  8022fd:	c3                   	ret
+
+008022fe <devfile_write>:
+{
+  8022fe:	55                   	push   %ebp
+  8022ff:	89 e5                	mov    %esp,%ebp
+  802301:	83 ec 0c             	sub    $0xc,%esp
+  802304:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  802307:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80230c:	39 d0                	cmp    %edx,%eax
+  80230e:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802311:	8b 55 08             	mov    0x8(%ebp),%edx
+  802314:	8b 52 0c             	mov    0xc(%edx),%edx
+  802317:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80231d:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  802322:	50                   	push   %eax
+  802323:	ff 75 0c             	push   0xc(%ebp)
+  802326:	68 08 70 80 00       	push   $0x807008
+  80232b:	e8 04 ea ff ff       	call   800d34 <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  802330:	ba 00 00 00 00       	mov    $0x0,%edx
+  802335:	b8 04 00 00 00       	mov    $0x4,%eax
+  80233a:	e8 c2 fe ff ff       	call   802201 <fsipc>
+}
+  80233f:	c9                   	leave
+  802340:	c3                   	ret
+
+00802341 <devfile_read>:
+{
+  802341:	55                   	push   %ebp
+  802342:	89 e5                	mov    %esp,%ebp
+  802344:	53                   	push   %ebx
+  802345:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80234b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80234e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  802353:	8b 45 10             	mov    0x10(%ebp),%eax
+  802356:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  80235b:	ba 00 70 80 00       	mov    $0x807000,%edx
+  802360:	b8 03 00 00 00       	mov    $0x3,%eax
+  802365:	e8 97 fe ff ff       	call   802201 <fsipc>
+  80236a:	89 c3                	mov    %eax,%ebx
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	78 14                	js     802384 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  802370:	83 ec 04             	sub    $0x4,%esp
+  802373:	50                   	push   %eax
+  802374:	68 00 70 80 00       	push   $0x807000
+  802379:	ff 75 0c             	push   0xc(%ebp)
+  80237c:	e8 b3 e9 ff ff       	call   800d34 <memmove>
+	return r;
+  802381:	83 c4 10             	add    $0x10,%esp
+}
+  802384:	89 d8                	mov    %ebx,%eax
+  802386:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802389:	c9                   	leave
+  80238a:	c3                   	ret
+
+0080238b <open>:
+{
+  80238b:	55                   	push   %ebp
+  80238c:	89 e5                	mov    %esp,%ebp
+  80238e:	53                   	push   %ebx
+  80238f:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  802392:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802395:	50                   	push   %eax
+  802396:	e8 23 f8 ff ff       	call   801bbe <fd_alloc>
+  80239b:	89 c3                	mov    %eax,%ebx
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	78 2a                	js     8023ce <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8023a4:	83 ec 0c             	sub    $0xc,%esp
+  8023a7:	ff 75 08             	push   0x8(%ebp)
+  8023aa:	e8 89 e7 ff ff       	call   800b38 <strlen>
+  8023af:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8023b2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8023b7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8023bc:	7e 17                	jle    8023d5 <open+0x4a>
+	fd_close(fd, 1);
+  8023be:	83 ec 08             	sub    $0x8,%esp
+  8023c1:	6a 01                	push   $0x1
+  8023c3:	ff 75 f4             	push   -0xc(%ebp)
+  8023c6:	e8 08 f9 ff ff       	call   801cd3 <fd_close>
+	return r;
+  8023cb:	83 c4 10             	add    $0x10,%esp
+}
+  8023ce:	89 d8                	mov    %ebx,%eax
+  8023d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023d3:	c9                   	leave
+  8023d4:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  8023d5:	83 ec 08             	sub    $0x8,%esp
+  8023d8:	ff 75 08             	push   0x8(%ebp)
+  8023db:	68 00 70 80 00       	push   $0x807000
+  8023e0:	e8 9f e7 ff ff       	call   800b84 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8023e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023e8:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  8023ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023f5:	e8 07 fe ff ff       	call   802201 <fsipc>
+  8023fa:	89 c3                	mov    %eax,%ebx
+  8023fc:	83 c4 10             	add    $0x10,%esp
+  8023ff:	85 c0                	test   %eax,%eax
+  802401:	78 bb                	js     8023be <open+0x33>
+	return fd2num(fd); 	
+  802403:	83 ec 0c             	sub    $0xc,%esp
+  802406:	ff 75 f4             	push   -0xc(%ebp)
+  802409:	e8 89 f7 ff ff       	call   801b97 <fd2num>
+  80240e:	89 c3                	mov    %eax,%ebx
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	eb b9                	jmp    8023ce <open+0x43>
+
+00802415 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	53                   	push   %ebx
+  802419:	83 ec 1c             	sub    $0x1c,%esp
+  80241c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80241f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802422:	50                   	push   %eax
+  802423:	ff 75 08             	push   0x8(%ebp)
+  802426:	e8 e3 f7 ff ff       	call   801c0e <fd_lookup>
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	78 5a                	js     80248c <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  802432:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802435:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80243b:	39 10                	cmp    %edx,(%eax)
+  80243d:	75 66                	jne    8024a5 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  80243f:	83 3d c4 66 80 00 00 	cmpl   $0x0,0x8066c4
+  802446:	74 49                	je     802491 <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802448:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80244b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80244e:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  802453:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802456:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  80245b:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802461:	6a 07                	push   $0x7
+  802463:	68 00 70 80 00       	push   $0x807000
+  802468:	6a 09                	push   $0x9
+  80246a:	ff 35 c4 66 80 00    	push   0x8066c4
+  802470:	e8 d3 1f 00 00       	call   804448 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  802475:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80247c:	6a 00                	push   $0x0
+  80247e:	53                   	push   %ebx
+  80247f:	ff 75 10             	push   0x10(%ebp)
+  802482:	6a 00                	push   $0x0
+  802484:	e8 fc 1d 00 00       	call   804285 <ipc_recv_pages>
+  802489:	83 c4 20             	add    $0x20,%esp
+}
+  80248c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80248f:	c9                   	leave
+  802490:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802491:	83 ec 0c             	sub    $0xc,%esp
+  802494:	6a 02                	push   $0x2
+  802496:	e8 16 20 00 00       	call   8044b1 <ipc_find_env>
+  80249b:	a3 c4 66 80 00       	mov    %eax,0x8066c4
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	eb a3                	jmp    802448 <fmap+0x33>
+		return -E_INVAL;
+  8024a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024aa:	eb e0                	jmp    80248c <fmap+0x77>
+
+008024ac <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	53                   	push   %ebx
+  8024b0:	83 ec 10             	sub    $0x10,%esp
+  8024b3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8024b6:	53                   	push   %ebx
+  8024b7:	e8 7c e6 ff ff       	call   800b38 <strlen>
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024c4:	7f 25                	jg     8024eb <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024c6:	83 ec 08             	sub    $0x8,%esp
+  8024c9:	53                   	push   %ebx
+  8024ca:	68 00 70 80 00       	push   $0x807000
+  8024cf:	e8 b0 e6 ff ff       	call   800b84 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024de:	e8 1e fd ff ff       	call   802201 <fsipc>
+  8024e3:	83 c4 10             	add    $0x10,%esp
+}
+  8024e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e9:	c9                   	leave
+  8024ea:	c3                   	ret
+		return -E_BAD_PATH;
+  8024eb:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024f0:	eb f4                	jmp    8024e6 <remove+0x3a>
+
+008024f2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024f2:	55                   	push   %ebp
+  8024f3:	89 e5                	mov    %esp,%ebp
+  8024f5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8024f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fd:	b8 08 00 00 00       	mov    $0x8,%eax
+  802502:	e8 fa fc ff ff       	call   802201 <fsipc>
+}
+  802507:	c9                   	leave
+  802508:	c3                   	ret
+
+00802509 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  80250f:	68 ec 4c 80 00       	push   $0x804cec
+  802514:	ff 75 0c             	push   0xc(%ebp)
+  802517:	e8 68 e6 ff ff       	call   800b84 <strcpy>
+	return 0;
+}
+  80251c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802521:	c9                   	leave
+  802522:	c3                   	ret
+
+00802523 <devsock_close>:
+{
+  802523:	55                   	push   %ebp
+  802524:	89 e5                	mov    %esp,%ebp
+  802526:	53                   	push   %ebx
+  802527:	83 ec 10             	sub    $0x10,%esp
+  80252a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  80252d:	53                   	push   %ebx
+  80252e:	e8 bd 1f 00 00       	call   8044f0 <pageref>
+  802533:	89 c2                	mov    %eax,%edx
+  802535:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802538:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  80253d:	83 fa 01             	cmp    $0x1,%edx
+  802540:	74 05                	je     802547 <devsock_close+0x24>
+}
+  802542:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802545:	c9                   	leave
+  802546:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802547:	83 ec 0c             	sub    $0xc,%esp
+  80254a:	ff 73 0c             	push   0xc(%ebx)
+  80254d:	e8 b0 05 00 00       	call   802b02 <nsipc_close>
+  802552:	83 c4 10             	add    $0x10,%esp
+  802555:	eb eb                	jmp    802542 <devsock_close+0x1f>
+
+00802557 <devsock_write>:
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	53                   	push   %ebx
+  80255b:	83 ec 14             	sub    $0x14,%esp
+  80255e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802561:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802564:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  802567:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  80256a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  80256d:	8b 41 08             	mov    0x8(%ecx),%eax
+  802570:	c1 f8 09             	sar    $0x9,%eax
+  802573:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  802576:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  80257c:	77 13                	ja     802591 <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  80257e:	50                   	push   %eax
+  80257f:	52                   	push   %edx
+  802580:	53                   	push   %ebx
+  802581:	ff 71 0c             	push   0xc(%ecx)
+  802584:	e8 5c 06 00 00       	call   802be5 <nsipc_send>
+  802589:	83 c4 10             	add    $0x10,%esp
+}
+  80258c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80258f:	c9                   	leave
+  802590:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  802591:	50                   	push   %eax
+  802592:	6a 01                	push   $0x1
+  802594:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802597:	50                   	push   %eax
+  802598:	ff 71 0c             	push   0xc(%ecx)
+  80259b:	e8 a6 06 00 00       	call   802c46 <nsipc_sendmsg>
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	eb e7                	jmp    80258c <devsock_write+0x35>
+
+008025a5 <devsock_read>:
+{
+  8025a5:	55                   	push   %ebp
+  8025a6:	89 e5                	mov    %esp,%ebp
+  8025a8:	53                   	push   %ebx
+  8025a9:	83 ec 14             	sub    $0x14,%esp
+  8025ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8025af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8025b2:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  8025b5:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  8025b8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  8025bb:	8b 41 08             	mov    0x8(%ecx),%eax
+  8025be:	c1 f8 09             	sar    $0x9,%eax
+  8025c1:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  8025c4:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  8025ca:	77 13                	ja     8025df <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  8025cc:	50                   	push   %eax
+  8025cd:	52                   	push   %edx
+  8025ce:	53                   	push   %ebx
+  8025cf:	ff 71 0c             	push   0xc(%ecx)
+  8025d2:	e8 9c 05 00 00       	call   802b73 <nsipc_recv>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+}
+  8025da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025dd:	c9                   	leave
+  8025de:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  8025df:	50                   	push   %eax
+  8025e0:	6a 01                	push   $0x1
+  8025e2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8025e5:	50                   	push   %eax
+  8025e6:	ff 71 0c             	push   0xc(%ecx)
+  8025e9:	e8 02 0a 00 00       	call   802ff0 <nsipc_recvmsg>
+  8025ee:	83 c4 10             	add    $0x10,%esp
+  8025f1:	eb e7                	jmp    8025da <devsock_read+0x35>
+
+008025f3 <fd2sockid>:
+{
+  8025f3:	55                   	push   %ebp
+  8025f4:	89 e5                	mov    %esp,%ebp
+  8025f6:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8025f9:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025fc:	52                   	push   %edx
+  8025fd:	50                   	push   %eax
+  8025fe:	e8 0b f6 ff ff       	call   801c0e <fd_lookup>
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	85 c0                	test   %eax,%eax
+  802608:	78 10                	js     80261a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80260a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80260d:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802613:	39 08                	cmp    %ecx,(%eax)
+  802615:	75 05                	jne    80261c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802617:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80261a:	c9                   	leave
+  80261b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80261c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802621:	eb f7                	jmp    80261a <fd2sockid+0x27>
+
+00802623 <sock_flags>:
+{
+  802623:	55                   	push   %ebp
+  802624:	89 e5                	mov    %esp,%ebp
+  802626:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  802629:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80262c:	52                   	push   %edx
+  80262d:	50                   	push   %eax
+  80262e:	e8 db f5 ff ff       	call   801c0e <fd_lookup>
+  802633:	83 c4 10             	add    $0x10,%esp
+  802636:	85 c0                	test   %eax,%eax
+  802638:	78 0e                	js     802648 <sock_flags+0x25>
+  80263a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80263d:	8b 40 08             	mov    0x8(%eax),%eax
+  802640:	c1 e8 09             	shr    $0x9,%eax
+  802643:	83 e0 08             	and    $0x8,%eax
+}
+  802646:	c9                   	leave
+  802647:	c3                   	ret
+		return 0;
+  802648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264d:	eb f7                	jmp    802646 <sock_flags+0x23>
+
+0080264f <alloc_sockfd>:
+{
+  80264f:	55                   	push   %ebp
+  802650:	89 e5                	mov    %esp,%ebp
+  802652:	56                   	push   %esi
+  802653:	53                   	push   %ebx
+  802654:	83 ec 1c             	sub    $0x1c,%esp
+  802657:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802659:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80265c:	50                   	push   %eax
+  80265d:	e8 5c f5 ff ff       	call   801bbe <fd_alloc>
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	78 43                	js     8026ae <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80266b:	83 ec 04             	sub    $0x4,%esp
+  80266e:	68 07 04 00 00       	push   $0x407
+  802673:	ff 75 f4             	push   -0xc(%ebp)
+  802676:	6a 00                	push   $0x0
+  802678:	e8 3b e9 ff ff       	call   800fb8 <sys_page_alloc>
+  80267d:	89 c3                	mov    %eax,%ebx
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	85 c0                	test   %eax,%eax
+  802684:	78 28                	js     8026ae <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802686:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802689:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80268f:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802691:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802694:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80269b:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  80269e:	83 ec 0c             	sub    $0xc,%esp
+  8026a1:	50                   	push   %eax
+  8026a2:	e8 f0 f4 ff ff       	call   801b97 <fd2num>
+  8026a7:	89 c3                	mov    %eax,%ebx
+  8026a9:	83 c4 10             	add    $0x10,%esp
+  8026ac:	eb 0c                	jmp    8026ba <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8026ae:	83 ec 0c             	sub    $0xc,%esp
+  8026b1:	56                   	push   %esi
+  8026b2:	e8 4b 04 00 00       	call   802b02 <nsipc_close>
+		return r;
+  8026b7:	83 c4 10             	add    $0x10,%esp
+}
+  8026ba:	89 d8                	mov    %ebx,%eax
+  8026bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026bf:	5b                   	pop    %ebx
+  8026c0:	5e                   	pop    %esi
+  8026c1:	5d                   	pop    %ebp
+  8026c2:	c3                   	ret
+
+008026c3 <accept>:
+{
+  8026c3:	55                   	push   %ebp
+  8026c4:	89 e5                	mov    %esp,%ebp
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8026cb:	89 f0                	mov    %esi,%eax
+  8026cd:	e8 21 ff ff ff       	call   8025f3 <fd2sockid>
+  8026d2:	89 c3                	mov    %eax,%ebx
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	78 24                	js     8026fc <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  8026d8:	89 f0                	mov    %esi,%eax
+  8026da:	e8 44 ff ff ff       	call   802623 <sock_flags>
+  8026df:	50                   	push   %eax
+  8026e0:	ff 75 10             	push   0x10(%ebp)
+  8026e3:	ff 75 0c             	push   0xc(%ebp)
+  8026e6:	53                   	push   %ebx
+  8026e7:	e8 6b 03 00 00       	call   802a57 <nsipc_accept>
+  8026ec:	89 c3                	mov    %eax,%ebx
+  8026ee:	83 c4 10             	add    $0x10,%esp
+  8026f1:	85 c0                	test   %eax,%eax
+  8026f3:	78 07                	js     8026fc <accept+0x39>
+	return alloc_sockfd(r);
+  8026f5:	e8 55 ff ff ff       	call   80264f <alloc_sockfd>
+  8026fa:	89 c3                	mov    %eax,%ebx
+}
+  8026fc:	89 d8                	mov    %ebx,%eax
+  8026fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802701:	5b                   	pop    %ebx
+  802702:	5e                   	pop    %esi
+  802703:	5d                   	pop    %ebp
+  802704:	c3                   	ret
+
+00802705 <bind>:
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80270b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80270e:	e8 e0 fe ff ff       	call   8025f3 <fd2sockid>
+  802713:	85 c0                	test   %eax,%eax
+  802715:	78 12                	js     802729 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802717:	83 ec 04             	sub    $0x4,%esp
+  80271a:	ff 75 10             	push   0x10(%ebp)
+  80271d:	ff 75 0c             	push   0xc(%ebp)
+  802720:	50                   	push   %eax
+  802721:	e8 85 03 00 00       	call   802aab <nsipc_bind>
+  802726:	83 c4 10             	add    $0x10,%esp
+}
+  802729:	c9                   	leave
+  80272a:	c3                   	ret
+
+0080272b <shutdown>:
+{
+  80272b:	55                   	push   %ebp
+  80272c:	89 e5                	mov    %esp,%ebp
+  80272e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802731:	8b 45 08             	mov    0x8(%ebp),%eax
+  802734:	e8 ba fe ff ff       	call   8025f3 <fd2sockid>
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	78 0f                	js     80274c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80273d:	83 ec 08             	sub    $0x8,%esp
+  802740:	ff 75 0c             	push   0xc(%ebp)
+  802743:	50                   	push   %eax
+  802744:	e8 97 03 00 00       	call   802ae0 <nsipc_shutdown>
+  802749:	83 c4 10             	add    $0x10,%esp
+}
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+0080274e <connect>:
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802754:	8b 45 08             	mov    0x8(%ebp),%eax
+  802757:	e8 97 fe ff ff       	call   8025f3 <fd2sockid>
+  80275c:	85 c0                	test   %eax,%eax
+  80275e:	78 12                	js     802772 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802760:	83 ec 04             	sub    $0x4,%esp
+  802763:	ff 75 10             	push   0x10(%ebp)
+  802766:	ff 75 0c             	push   0xc(%ebp)
+  802769:	50                   	push   %eax
+  80276a:	e8 ad 03 00 00       	call   802b1c <nsipc_connect>
+  80276f:	83 c4 10             	add    $0x10,%esp
+}
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+
+00802774 <listen>:
+{
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80277a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277d:	e8 71 fe ff ff       	call   8025f3 <fd2sockid>
+  802782:	85 c0                	test   %eax,%eax
+  802784:	78 0f                	js     802795 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802786:	83 ec 08             	sub    $0x8,%esp
+  802789:	ff 75 0c             	push   0xc(%ebp)
+  80278c:	50                   	push   %eax
+  80278d:	e8 bf 03 00 00       	call   802b51 <nsipc_listen>
+  802792:	83 c4 10             	add    $0x10,%esp
+}
+  802795:	c9                   	leave
+  802796:	c3                   	ret
+
+00802797 <sendmsg>:
+{
+  802797:	55                   	push   %ebp
+  802798:	89 e5                	mov    %esp,%ebp
+  80279a:	57                   	push   %edi
+  80279b:	56                   	push   %esi
+  80279c:	53                   	push   %ebx
+  80279d:	83 ec 0c             	sub    $0xc,%esp
+  8027a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027a3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  8027a6:	89 f0                	mov    %esi,%eax
+  8027a8:	e8 46 fe ff ff       	call   8025f3 <fd2sockid>
+  8027ad:	89 c3                	mov    %eax,%ebx
+  8027af:	85 c0                	test   %eax,%eax
+  8027b1:	78 1c                	js     8027cf <sendmsg+0x38>
+			     flags | sock_flags(s));
+  8027b3:	89 f0                	mov    %esi,%eax
+  8027b5:	e8 69 fe ff ff       	call   802623 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  8027ba:	0b 45 10             	or     0x10(%ebp),%eax
+  8027bd:	50                   	push   %eax
+  8027be:	ff 77 0c             	push   0xc(%edi)
+  8027c1:	ff 77 08             	push   0x8(%edi)
+  8027c4:	53                   	push   %ebx
+  8027c5:	e8 7c 04 00 00       	call   802c46 <nsipc_sendmsg>
+  8027ca:	89 c3                	mov    %eax,%ebx
+  8027cc:	83 c4 10             	add    $0x10,%esp
+}
+  8027cf:	89 d8                	mov    %ebx,%eax
+  8027d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d4:	5b                   	pop    %ebx
+  8027d5:	5e                   	pop    %esi
+  8027d6:	5f                   	pop    %edi
+  8027d7:	5d                   	pop    %ebp
+  8027d8:	c3                   	ret
+
+008027d9 <recvmsg>:
+{
+  8027d9:	55                   	push   %ebp
+  8027da:	89 e5                	mov    %esp,%ebp
+  8027dc:	57                   	push   %edi
+  8027dd:	56                   	push   %esi
+  8027de:	53                   	push   %ebx
+  8027df:	83 ec 0c             	sub    $0xc,%esp
+  8027e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8027e5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  8027e8:	89 f8                	mov    %edi,%eax
+  8027ea:	e8 04 fe ff ff       	call   8025f3 <fd2sockid>
+  8027ef:	89 c3                	mov    %eax,%ebx
+  8027f1:	85 c0                	test   %eax,%eax
+  8027f3:	78 2a                	js     80281f <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  8027f5:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  8027fc:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  802803:	89 f8                	mov    %edi,%eax
+  802805:	e8 19 fe ff ff       	call   802623 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  80280a:	0b 45 10             	or     0x10(%ebp),%eax
+  80280d:	50                   	push   %eax
+  80280e:	ff 76 0c             	push   0xc(%esi)
+  802811:	ff 76 08             	push   0x8(%esi)
+  802814:	53                   	push   %ebx
+  802815:	e8 d6 07 00 00       	call   802ff0 <nsipc_recvmsg>
+  80281a:	89 c3                	mov    %eax,%ebx
+  80281c:	83 c4 10             	add    $0x10,%esp
+}
+  80281f:	89 d8                	mov    %ebx,%eax
+  802821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802824:	5b                   	pop    %ebx
+  802825:	5e                   	pop    %esi
+  802826:	5f                   	pop    %edi
+  802827:	5d                   	pop    %ebp
+  802828:	c3                   	ret
+
+00802829 <sendfile>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	56                   	push   %esi
+  80282d:	53                   	push   %ebx
+  80282e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  802831:	89 f0                	mov    %esi,%eax
+  802833:	e8 bb fd ff ff       	call   8025f3 <fd2sockid>
+  802838:	89 c3                	mov    %eax,%ebx
+  80283a:	85 c0                	test   %eax,%eax
+  80283c:	78 1f                	js     80285d <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  80283e:	89 f0                	mov    %esi,%eax
+  802840:	e8 de fd ff ff       	call   802623 <sock_flags>
+  802845:	83 ec 0c             	sub    $0xc,%esp
+  802848:	50                   	push   %eax
+  802849:	ff 75 14             	push   0x14(%ebp)
+  80284c:	ff 75 10             	push   0x10(%ebp)
+  80284f:	ff 75 0c             	push   0xc(%ebp)
+  802852:	53                   	push   %ebx
+  802853:	e8 64 06 00 00       	call   802ebc <nsipc_sendfile>
+  802858:	89 c3                	mov    %eax,%ebx
+  80285a:	83 c4 20             	add    $0x20,%esp
+}
+  80285d:	89 d8                	mov    %ebx,%eax
+  80285f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802862:	5b                   	pop    %ebx
+  802863:	5e                   	pop    %esi
+  802864:	5d                   	pop    %ebp
+  802865:	c3                   	ret
+
+00802866 <evctl>:
+{
+  802866:	55                   	push   %ebp
+  802867:	89 e5                	mov    %esp,%ebp
+  802869:	53                   	push   %ebx
+  80286a:	83 ec 04             	sub    $0x4,%esp
+  80286d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  802870:	89 d8                	mov    %ebx,%eax
+  802872:	e8 7c fd ff ff       	call   8025f3 <fd2sockid>
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 10                	js     80288b <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	53                   	push   %ebx
+  80287f:	ff 75 0c             	push   0xc(%ebp)
+  802882:	50                   	push   %eax
+  802883:	e8 d2 0b 00 00       	call   80345a <nsipc_evctl>
+  802888:	83 c4 10             	add    $0x10,%esp
+}
+  80288b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80288e:	c9                   	leave
+  80288f:	c3                   	ret
+
+00802890 <evwait>:
+{
+  802890:	55                   	push   %ebp
+  802891:	89 e5                	mov    %esp,%ebp
+  802893:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  802896:	ff 75 10             	push   0x10(%ebp)
+  802899:	ff 75 0c             	push   0xc(%ebp)
+  80289c:	ff 75 08             	push   0x8(%ebp)
+  80289f:	e8 e0 0b 00 00       	call   803484 <nsipc_evwait>
+}
+  8028a4:	c9                   	leave
+  8028a5:	c3                   	ret
+
+008028a6 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028a6:	55                   	push   %ebp
+  8028a7:	89 e5                	mov    %esp,%ebp
+  8028a9:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028ac:	ff 75 10             	push   0x10(%ebp)
+  8028af:	ff 75 0c             	push   0xc(%ebp)
+  8028b2:	ff 75 08             	push   0x8(%ebp)
+  8028b5:	e8 31 0c 00 00       	call   8034eb <nsipc_socket>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  8028bd:	85 c0                	test   %eax,%eax
+  8028bf:	78 05                	js     8028c6 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028c1:	e8 89 fd ff ff       	call   80264f <alloc_sockfd>
+}
+  8028c6:	c9                   	leave
+  8028c7:	c3                   	ret
+
+008028c8 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028c8:	55                   	push   %ebp
+  8028c9:	89 e5                	mov    %esp,%ebp
+  8028cb:	53                   	push   %ebx
+  8028cc:	83 ec 04             	sub    $0x4,%esp
+  8028cf:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  8028d1:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  8028d8:	74 26                	je     802900 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028da:	6a 07                	push   $0x7
+  8028dc:	68 00 80 80 00       	push   $0x808000
+  8028e1:	53                   	push   %ebx
+  8028e2:	ff 35 e4 69 80 00    	push   0x8069e4
+  8028e8:	e8 5b 1b 00 00       	call   804448 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028ed:	83 c4 0c             	add    $0xc,%esp
+  8028f0:	6a 00                	push   $0x0
+  8028f2:	6a 00                	push   $0x0
+  8028f4:	6a 00                	push   $0x0
+  8028f6:	e8 bd 18 00 00       	call   8041b8 <ipc_recv>
+}
+  8028fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802900:	83 ec 0c             	sub    $0xc,%esp
+  802903:	6a 03                	push   $0x3
+  802905:	e8 a7 1b 00 00       	call   8044b1 <ipc_find_env>
+  80290a:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  80290f:	83 c4 10             	add    $0x10,%esp
+  802912:	eb c6                	jmp    8028da <nsipc+0x12>
+
+00802914 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802914:	55                   	push   %ebp
+  802915:	89 e5                	mov    %esp,%ebp
+  802917:	56                   	push   %esi
+  802918:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802919:	8b 35 f0 69 80 00    	mov    0x8069f0,%esi
+		return 0;
+  80291f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802924:	85 f6                	test   %esi,%esi
+  802926:	75 33                	jne    80295b <nsbulk_map+0x47>
+  802928:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80292d:	83 ec 04             	sub    $0x4,%esp
+  802930:	6a 07                	push   $0x7
+  802932:	53                   	push   %ebx
+  802933:	6a 00                	push   $0x0
+  802935:	e8 7e e6 ff ff       	call   800fb8 <sys_page_alloc>
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	78 1a                	js     80295b <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  802941:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802947:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  80294d:	75 de                	jne    80292d <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  80294f:	c7 05 f0 69 80 00 01 	movl   $0x1,0x8069f0
+  802956:	00 00 00 
+	return 0;
+  802959:	89 f0                	mov    %esi,%eax
+}
+  80295b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80295e:	5b                   	pop    %ebx
+  80295f:	5e                   	pop    %esi
+  802960:	5d                   	pop    %ebp
+  802961:	c3                   	ret
+
+00802962 <nsbulk_own>:
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	57                   	push   %edi
+  802966:	56                   	push   %esi
+  802967:	53                   	push   %ebx
+  802968:	83 ec 0c             	sub    $0xc,%esp
+  80296b:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  80296d:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  802970:	85 d2                	test   %edx,%edx
+  802972:	7f 0e                	jg     802982 <nsbulk_own+0x20>
+	return 0;
+  802974:	b8 00 00 00 00       	mov    $0x0,%eax
+  802979:	eb 47                	jmp    8029c2 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  80297b:	83 c3 01             	add    $0x1,%ebx
+  80297e:	39 fb                	cmp    %edi,%ebx
+  802980:	7d 3b                	jge    8029bd <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  802982:	be 01 00 00 00       	mov    $0x1,%esi
+  802987:	89 d9                	mov    %ebx,%ecx
+  802989:	d3 e6                	shl    %cl,%esi
+  80298b:	89 f0                	mov    %esi,%eax
+  80298d:	23 05 ec 69 80 00    	and    0x8069ec,%eax
+  802993:	74 e6                	je     80297b <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  802995:	83 ec 04             	sub    $0x4,%esp
+  802998:	6a 07                	push   $0x7
+  80299a:	89 d8                	mov    %ebx,%eax
+  80299c:	c1 e0 0c             	shl    $0xc,%eax
+  80299f:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8029a4:	50                   	push   %eax
+  8029a5:	6a 00                	push   $0x0
+  8029a7:	e8 0c e6 ff ff       	call   800fb8 <sys_page_alloc>
+  8029ac:	83 c4 10             	add    $0x10,%esp
+  8029af:	85 c0                	test   %eax,%eax
+  8029b1:	78 0f                	js     8029c2 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  8029b3:	f7 d6                	not    %esi
+  8029b5:	21 35 ec 69 80 00    	and    %esi,0x8069ec
+  8029bb:	eb be                	jmp    80297b <nsbulk_own+0x19>
+	return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c5:	5b                   	pop    %ebx
+  8029c6:	5e                   	pop    %esi
+  8029c7:	5f                   	pop    %edi
+  8029c8:	5d                   	pop    %ebp
+  8029c9:	c3                   	ret
+
+008029ca <nsipc_bulk>:
+{
+  8029ca:	55                   	push   %ebp
+  8029cb:	89 e5                	mov    %esp,%ebp
+  8029cd:	57                   	push   %edi
+  8029ce:	56                   	push   %esi
+  8029cf:	53                   	push   %ebx
+  8029d0:	83 ec 1c             	sub    $0x1c,%esp
+  8029d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029d6:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  8029d8:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  8029de:	c1 fb 0c             	sar    $0xc,%ebx
+  8029e1:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  8029e4:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  8029eb:	74 56                	je     802a43 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  8029ed:	85 ff                	test   %edi,%edi
+  8029ef:	7e 24                	jle    802a15 <nsipc_bulk+0x4b>
+  8029f1:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8029f7:	74 1c                	je     802a15 <nsipc_bulk+0x4b>
+  8029f9:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  8029ff:	c1 e3 0c             	shl    $0xc,%ebx
+  802a02:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802a07:	0f b6 10             	movzbl (%eax),%edx
+  802a0a:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  802a0c:	05 00 10 00 00       	add    $0x1000,%eax
+  802a11:	39 d8                	cmp    %ebx,%eax
+  802a13:	75 f2                	jne    802a07 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802a15:	83 ec 0c             	sub    $0xc,%esp
+  802a18:	56                   	push   %esi
+  802a19:	57                   	push   %edi
+  802a1a:	68 00 00 00 e0       	push   $0xe0000000
+  802a1f:	ff 75 e4             	push   -0x1c(%ebp)
+  802a22:	ff 35 e4 69 80 00    	push   0x8069e4
+  802a28:	e8 4f 1a 00 00       	call   80447c <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  802a2d:	83 c4 1c             	add    $0x1c,%esp
+  802a30:	6a 00                	push   $0x0
+  802a32:	6a 00                	push   $0x0
+  802a34:	6a 00                	push   $0x0
+  802a36:	e8 7d 17 00 00       	call   8041b8 <ipc_recv>
+}
+  802a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3e:	5b                   	pop    %ebx
+  802a3f:	5e                   	pop    %esi
+  802a40:	5f                   	pop    %edi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802a43:	83 ec 0c             	sub    $0xc,%esp
+  802a46:	6a 03                	push   $0x3
+  802a48:	e8 64 1a 00 00       	call   8044b1 <ipc_find_env>
+  802a4d:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802a52:	83 c4 10             	add    $0x10,%esp
+  802a55:	eb 96                	jmp    8029ed <nsipc_bulk+0x23>
+
+00802a57 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802a57:	55                   	push   %ebp
+  802a58:	89 e5                	mov    %esp,%ebp
+  802a5a:	53                   	push   %ebx
+  802a5b:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a61:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a69:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802a6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a73:	e8 50 fe ff ff       	call   8028c8 <nsipc>
+  802a78:	89 c3                	mov    %eax,%ebx
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	79 07                	jns    802a85 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802a7e:	89 d8                	mov    %ebx,%eax
+  802a80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802a85:	83 ec 04             	sub    $0x4,%esp
+  802a88:	ff 35 10 80 80 00    	push   0x808010
+  802a8e:	68 00 80 80 00       	push   $0x808000
+  802a93:	ff 75 0c             	push   0xc(%ebp)
+  802a96:	e8 99 e2 ff ff       	call   800d34 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802a9b:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802aa1:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aa4:	89 10                	mov    %edx,(%eax)
+  802aa6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802aa9:	eb d3                	jmp    802a7e <nsipc_accept+0x27>
+
+00802aab <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802aab:	55                   	push   %ebp
+  802aac:	89 e5                	mov    %esp,%ebp
+  802aae:	53                   	push   %ebx
+  802aaf:	83 ec 08             	sub    $0x8,%esp
+  802ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802ab5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802abd:	53                   	push   %ebx
+  802abe:	ff 75 0c             	push   0xc(%ebp)
+  802ac1:	68 04 80 80 00       	push   $0x808004
+  802ac6:	e8 69 e2 ff ff       	call   800d34 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802acb:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802ad1:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ad6:	e8 ed fd ff ff       	call   8028c8 <nsipc>
+}
+  802adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ade:	c9                   	leave
+  802adf:	c3                   	ret
+
+00802ae0 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ae9:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  802aee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af1:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802af6:	b8 03 00 00 00       	mov    $0x3,%eax
+  802afb:	e8 c8 fd ff ff       	call   8028c8 <nsipc>
+}
+  802b00:	c9                   	leave
+  802b01:	c3                   	ret
+
+00802b02 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802b02:	55                   	push   %ebp
+  802b03:	89 e5                	mov    %esp,%ebp
+  802b05:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802b10:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b15:	e8 ae fd ff ff       	call   8028c8 <nsipc>
+}
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+00802b1c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802b1c:	55                   	push   %ebp
+  802b1d:	89 e5                	mov    %esp,%ebp
+  802b1f:	53                   	push   %ebx
+  802b20:	83 ec 08             	sub    $0x8,%esp
+  802b23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b29:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802b2e:	53                   	push   %ebx
+  802b2f:	ff 75 0c             	push   0xc(%ebp)
+  802b32:	68 04 80 80 00       	push   $0x808004
+  802b37:	e8 f8 e1 ff ff       	call   800d34 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802b3c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802b42:	b8 05 00 00 00       	mov    $0x5,%eax
+  802b47:	e8 7c fd ff ff       	call   8028c8 <nsipc>
+}
+  802b4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b4f:	c9                   	leave
+  802b50:	c3                   	ret
+
+00802b51 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802b51:	55                   	push   %ebp
+  802b52:	89 e5                	mov    %esp,%ebp
+  802b54:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802b57:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b5a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802b5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b62:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802b67:	b8 06 00 00 00       	mov    $0x6,%eax
+  802b6c:	e8 57 fd ff ff       	call   8028c8 <nsipc>
+}
+  802b71:	c9                   	leave
+  802b72:	c3                   	ret
+
+00802b73 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802b73:	55                   	push   %ebp
+  802b74:	89 e5                	mov    %esp,%ebp
+  802b76:	56                   	push   %esi
+  802b77:	53                   	push   %ebx
+  802b78:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802b7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b7e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802b83:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802b89:	8b 45 14             	mov    0x14(%ebp),%eax
+  802b8c:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802b91:	b8 07 00 00 00       	mov    $0x7,%eax
+  802b96:	e8 2d fd ff ff       	call   8028c8 <nsipc>
+  802b9b:	89 c3                	mov    %eax,%ebx
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 22                	js     802bc3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ba1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802ba6:	39 c6                	cmp    %eax,%esi
+  802ba8:	0f 4e c6             	cmovle %esi,%eax
+  802bab:	39 c3                	cmp    %eax,%ebx
+  802bad:	7f 1d                	jg     802bcc <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802baf:	83 ec 04             	sub    $0x4,%esp
+  802bb2:	53                   	push   %ebx
+  802bb3:	68 00 80 80 00       	push   $0x808000
+  802bb8:	ff 75 0c             	push   0xc(%ebp)
+  802bbb:	e8 74 e1 ff ff       	call   800d34 <memmove>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802bc3:	89 d8                	mov    %ebx,%eax
+  802bc5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bc8:	5b                   	pop    %ebx
+  802bc9:	5e                   	pop    %esi
+  802bca:	5d                   	pop    %ebp
+  802bcb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802bcc:	68 f8 4c 80 00       	push   $0x804cf8
+  802bd1:	68 0d 4d 80 00       	push   $0x804d0d
+  802bd6:	68 b2 00 00 00       	push   $0xb2
+  802bdb:	68 22 4d 80 00       	push   $0x804d22
+  802be0:	e8 cd d7 ff ff       	call   8003b2 <_panic>
+
+00802be5 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802be5:	55                   	push   %ebp
+  802be6:	89 e5                	mov    %esp,%ebp
+  802be8:	53                   	push   %ebx
+  802be9:	83 ec 04             	sub    $0x4,%esp
+  802bec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bf2:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802bf7:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802bfd:	7f 2e                	jg     802c2d <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802bff:	83 ec 04             	sub    $0x4,%esp
+  802c02:	53                   	push   %ebx
+  802c03:	ff 75 0c             	push   0xc(%ebp)
+  802c06:	68 0c 80 80 00       	push   $0x80800c
+  802c0b:	e8 24 e1 ff ff       	call   800d34 <memmove>
+	nsipcbuf.send.req_size = size;
+  802c10:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802c16:	8b 45 14             	mov    0x14(%ebp),%eax
+  802c19:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802c1e:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c23:	e8 a0 fc ff ff       	call   8028c8 <nsipc>
+}
+  802c28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+	assert(size < 1600);
+  802c2d:	68 2e 4d 80 00       	push   $0x804d2e
+  802c32:	68 0d 4d 80 00       	push   $0x804d0d
+  802c37:	68 bd 00 00 00       	push   $0xbd
+  802c3c:	68 22 4d 80 00       	push   $0x804d22
+  802c41:	e8 6c d7 ff ff       	call   8003b2 <_panic>
+
+00802c46 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802c46:	55                   	push   %ebp
+  802c47:	89 e5                	mov    %esp,%ebp
+  802c49:	57                   	push   %edi
+  802c4a:	56                   	push   %esi
+  802c4b:	53                   	push   %ebx
+  802c4c:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  802c4f:	e8 c0 fc ff ff       	call   802914 <nsbulk_map>
+  802c54:	85 c0                	test   %eax,%eax
+  802c56:	78 55                	js     802cad <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802c58:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  802c5f:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802c66:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c6d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c70:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802c73:	0f 8d 24 02 00 00    	jge    802e9d <nsipc_sendmsg+0x257>
+  802c79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c7c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  802c7f:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  802c82:	89 d8                	mov    %ebx,%eax
+  802c84:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802c89:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  802c8b:	83 ec 0c             	sub    $0xc,%esp
+  802c8e:	68 e0 66 80 00       	push   $0x8066e0
+  802c93:	e8 bc 0f 00 00       	call   803c54 <pgbatch_init>
+  802c98:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802c9b:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802c9d:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  802ca0:	e9 82 00 00 00       	jmp    802d27 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802ca5:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802ca8:	85 db                	test   %ebx,%ebx
+  802caa:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  802cad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb0:	5b                   	pop    %ebx
+  802cb1:	5e                   	pop    %esi
+  802cb2:	5f                   	pop    %edi
+  802cb3:	5d                   	pop    %ebp
+  802cb4:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802cb5:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802cba:	29 c8                	sub    %ecx,%eax
+  802cbc:	39 d0                	cmp    %edx,%eax
+  802cbe:	0f 46 d0             	cmovbe %eax,%edx
+  802cc1:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802cc3:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802cc9:	85 ff                	test   %edi,%edi
+  802ccb:	0f 49 c7             	cmovns %edi,%eax
+  802cce:	c1 f8 0c             	sar    $0xc,%eax
+  802cd1:	ba 01 00 00 00       	mov    $0x1,%edx
+  802cd6:	e8 87 fc ff ff       	call   802962 <nsbulk_own>
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	0f 88 17 01 00 00    	js     802dfa <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802ce3:	83 ec 04             	sub    $0x4,%esp
+  802ce6:	56                   	push   %esi
+  802ce7:	ff 75 e0             	push   -0x20(%ebp)
+  802cea:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ced:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802cf2:	50                   	push   %eax
+  802cf3:	e8 3c e0 ff ff       	call   800d34 <memmove>
+  802cf8:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802cfb:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802cfe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d01:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d04:	0f 84 fd 00 00 00    	je     802e07 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802d0a:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802d0d:	01 f7                	add    %esi,%edi
+  802d0f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d12:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802d15:	0f 8d 01 01 00 00    	jge    802e1c <nsipc_sendmsg+0x1d6>
+  802d1b:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  802d21:	0f 8f f0 00 00 00    	jg     802e17 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d2a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  802d2d:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  802d30:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d33:	89 c2                	mov    %eax,%edx
+  802d35:	03 13                	add    (%ebx),%edx
+  802d37:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802d3a:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d3d:	29 c6                	sub    %eax,%esi
+  802d3f:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802d44:	29 f9                	sub    %edi,%ecx
+  802d46:	39 ce                	cmp    %ecx,%esi
+  802d48:	89 ca                	mov    %ecx,%edx
+  802d4a:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  802d4d:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  802d50:	89 f9                	mov    %edi,%ecx
+  802d52:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802d58:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d5b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802d60:	09 c8                	or     %ecx,%eax
+  802d62:	0f 85 4d ff ff ff    	jne    802cb5 <nsipc_sendmsg+0x6f>
+  802d68:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  802d6e:	0f 86 41 ff ff ff    	jbe    802cb5 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d74:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802d7a:	85 ff                	test   %edi,%edi
+  802d7c:	0f 49 c7             	cmovns %edi,%eax
+  802d7f:	c1 f8 0c             	sar    $0xc,%eax
+  802d82:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  802d84:	89 d1                	mov    %edx,%ecx
+  802d86:	c1 e9 0c             	shr    $0xc,%ecx
+  802d89:	01 c8                	add    %ecx,%eax
+  802d8b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802d8e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802d91:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  802d93:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d96:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802d9b:	29 c8                	sub    %ecx,%eax
+  802d9d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802da0:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802da3:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802da5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802daa:	89 f9                	mov    %edi,%ecx
+  802dac:	d3 e0                	shl    %cl,%eax
+  802dae:	09 05 ec 69 80 00    	or     %eax,0x8069ec
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802db4:	83 ec 08             	sub    $0x8,%esp
+  802db7:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802db9:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802dbc:	50                   	push   %eax
+  802dbd:	6a 00                	push   $0x0
+  802dbf:	56                   	push   %esi
+  802dc0:	6a 00                	push   $0x0
+  802dc2:	68 e0 66 80 00       	push   $0x8066e0
+  802dc7:	e8 46 0f 00 00       	call   803d12 <pgbatch_map>
+  802dcc:	83 c4 20             	add    $0x20,%esp
+  802dcf:	85 c0                	test   %eax,%eax
+  802dd1:	0f 88 ce fe ff ff    	js     802ca5 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802dd7:	83 c7 01             	add    $0x1,%edi
+  802dda:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802de0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802de3:	39 c7                	cmp    %eax,%edi
+  802de5:	75 be                	jne    802da5 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802de7:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802dea:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  802ded:	89 d6                	mov    %edx,%esi
+  802def:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802df5:	e9 01 ff ff ff       	jmp    802cfb <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802dfa:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802dfd:	85 db                	test   %ebx,%ebx
+  802dff:	0f 45 c3             	cmovne %ebx,%eax
+  802e02:	e9 a6 fe ff ff       	jmp    802cad <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802e07:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802e0b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e12:	e9 f3 fe ff ff       	jmp    802d0a <nsipc_sendmsg+0xc4>
+  802e17:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802e1a:	eb 03                	jmp    802e1f <nsipc_sendmsg+0x1d9>
+  802e1c:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  802e1f:	83 ec 0c             	sub    $0xc,%esp
+  802e22:	68 e0 66 80 00       	push   $0x8066e0
+  802e27:	e8 36 0e 00 00       	call   803c62 <pgbatch_flush>
+  802e2c:	83 c4 10             	add    $0x10,%esp
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 50                	js     802e83 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e36:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802e3b:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  802e41:	89 fb                	mov    %edi,%ebx
+  802e43:	29 f3                	sub    %esi,%ebx
+  802e45:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802e4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802e4e:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802e53:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802e58:	89 fa                	mov    %edi,%edx
+  802e5a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802e5f:	e8 66 fb ff ff       	call   8029ca <nsipc_bulk>
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	78 28                	js     802e90 <nsipc_sendmsg+0x24a>
+		sent += r;
+  802e68:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802e6b:	39 c3                	cmp    %eax,%ebx
+  802e6d:	75 0c                	jne    802e7b <nsipc_sendmsg+0x235>
+  802e6f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e72:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802e75:	0f 8f f2 fd ff ff    	jg     802c6d <nsipc_sendmsg+0x27>
+		sent += r;
+  802e7b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802e7e:	e9 2a fe ff ff       	jmp    802cad <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e83:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e86:	85 db                	test   %ebx,%ebx
+  802e88:	0f 45 c3             	cmovne %ebx,%eax
+  802e8b:	e9 1d fe ff ff       	jmp    802cad <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  802e90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802e93:	85 db                	test   %ebx,%ebx
+  802e95:	0f 45 c3             	cmovne %ebx,%eax
+  802e98:	e9 10 fe ff ff       	jmp    802cad <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  802e9d:	83 ec 0c             	sub    $0xc,%esp
+  802ea0:	68 e0 66 80 00       	push   $0x8066e0
+  802ea5:	e8 aa 0d 00 00       	call   803c54 <pgbatch_init>
+  802eaa:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  802ead:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb7:	e9 63 ff ff ff       	jmp    802e1f <nsipc_sendmsg+0x1d9>
+
+00802ebc <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  802ebc:	55                   	push   %ebp
+  802ebd:	89 e5                	mov    %esp,%ebp
+  802ebf:	57                   	push   %edi
+  802ec0:	56                   	push   %esi
+  802ec1:	53                   	push   %ebx
+  802ec2:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802ec5:	83 3d e8 69 80 00 00 	cmpl   $0x0,0x8069e8
+  802ecc:	0f 84 c8 00 00 00    	je     802f9a <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802ed2:	83 3d e4 69 80 00 00 	cmpl   $0x0,0x8069e4
+  802ed9:	0f 84 e4 00 00 00    	je     802fc3 <nsipc_sendfile+0x107>
+{
+  802edf:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802ee4:	89 fb                	mov    %edi,%ebx
+  802ee6:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802ee9:	0f 83 f0 00 00 00    	jae    802fdf <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  802eef:	89 fa                	mov    %edi,%edx
+  802ef1:	03 55 10             	add    0x10(%ebp),%edx
+  802ef4:	89 d0                	mov    %edx,%eax
+  802ef6:	c1 f8 1f             	sar    $0x1f,%eax
+  802ef9:	c1 e8 14             	shr    $0x14,%eax
+  802efc:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  802eff:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802f05:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802f07:	6a 10                	push   $0x10
+  802f09:	68 00 20 01 e0       	push   $0xe0012000
+  802f0e:	52                   	push   %edx
+  802f0f:	ff 75 0c             	push   0xc(%ebp)
+  802f12:	e8 fe f4 ff ff       	call   802415 <fmap>
+  802f17:	83 c4 10             	add    $0x10,%esp
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	0f 8e b8 00 00 00    	jle    802fda <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802f22:	39 c6                	cmp    %eax,%esi
+  802f24:	0f 8d b5 00 00 00    	jge    802fdf <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802f2a:	29 f0                	sub    %esi,%eax
+  802f2c:	8b 55 14             	mov    0x14(%ebp),%edx
+  802f2f:	29 da                	sub    %ebx,%edx
+  802f31:	39 d0                	cmp    %edx,%eax
+  802f33:	89 d3                	mov    %edx,%ebx
+  802f35:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802f38:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f3b:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  802f40:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802f46:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  802f4c:	8b 45 18             	mov    0x18(%ebp),%eax
+  802f4f:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f54:	83 ec 0c             	sub    $0xc,%esp
+  802f57:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802f59:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  802f60:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802f63:	83 c0 01             	add    $0x1,%eax
+  802f66:	50                   	push   %eax
+  802f67:	68 00 10 01 e0       	push   $0xe0011000
+  802f6c:	6a 11                	push   $0x11
+  802f6e:	ff 35 e4 69 80 00    	push   0x8069e4
+  802f74:	e8 03 15 00 00       	call   80447c <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802f79:	83 c4 1c             	add    $0x1c,%esp
+  802f7c:	6a 00                	push   $0x0
+  802f7e:	6a 00                	push   $0x0
+  802f80:	6a 00                	push   $0x0
+  802f82:	e8 31 12 00 00       	call   8041b8 <ipc_recv>
+  802f87:	83 c4 10             	add    $0x10,%esp
+  802f8a:	85 c0                	test   %eax,%eax
+  802f8c:	78 5b                	js     802fe9 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  802f8e:	01 c7                	add    %eax,%edi
+		if (r < n)
+  802f90:	39 c3                	cmp    %eax,%ebx
+  802f92:	0f 8e 4c ff ff ff    	jle    802ee4 <nsipc_sendfile+0x28>
+  802f98:	eb 45                	jmp    802fdf <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  802f9a:	83 ec 04             	sub    $0x4,%esp
+  802f9d:	6a 07                	push   $0x7
+  802f9f:	68 00 10 01 e0       	push   $0xe0011000
+  802fa4:	6a 00                	push   $0x0
+  802fa6:	e8 0d e0 ff ff       	call   800fb8 <sys_page_alloc>
+  802fab:	89 c7                	mov    %eax,%edi
+  802fad:	83 c4 10             	add    $0x10,%esp
+  802fb0:	85 c0                	test   %eax,%eax
+  802fb2:	78 2b                	js     802fdf <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802fb4:	c7 05 e8 69 80 00 01 	movl   $0x1,0x8069e8
+  802fbb:	00 00 00 
+  802fbe:	e9 0f ff ff ff       	jmp    802ed2 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802fc3:	83 ec 0c             	sub    $0xc,%esp
+  802fc6:	6a 03                	push   $0x3
+  802fc8:	e8 e4 14 00 00       	call   8044b1 <ipc_find_env>
+  802fcd:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+  802fd2:	83 c4 10             	add    $0x10,%esp
+  802fd5:	e9 05 ff ff ff       	jmp    802edf <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802fda:	85 ff                	test   %edi,%edi
+  802fdc:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  802fdf:	89 f8                	mov    %edi,%eax
+  802fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5f                   	pop    %edi
+  802fe7:	5d                   	pop    %ebp
+  802fe8:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802fe9:	85 ff                	test   %edi,%edi
+  802feb:	0f 44 f8             	cmove  %eax,%edi
+  802fee:	eb ef                	jmp    802fdf <nsipc_sendfile+0x123>
+
+00802ff0 <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802ff0:	55                   	push   %ebp
+  802ff1:	89 e5                	mov    %esp,%ebp
+  802ff3:	57                   	push   %edi
+  802ff4:	56                   	push   %esi
+  802ff5:	53                   	push   %ebx
+  802ff6:	83 ec 1c             	sub    $0x1c,%esp
+  802ff9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  802ffc:	e8 13 f9 ff ff       	call   802914 <nsbulk_map>
+  803001:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803004:	85 c0                	test   %eax,%eax
+  803006:	0f 88 ba 00 00 00    	js     8030c6 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80300c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803010:	0f 8e bb 00 00 00    	jle    8030d1 <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  803016:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80301b:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  803020:	bf 00 00 01 00       	mov    $0x10000,%edi
+  803025:	89 f8                	mov    %edi,%eax
+  803027:	29 f0                	sub    %esi,%eax
+  803029:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80302d:	39 c8                	cmp    %ecx,%eax
+  80302f:	0f 47 c1             	cmova  %ecx,%eax
+  803032:	01 f0                	add    %esi,%eax
+  803034:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  803036:	83 c2 01             	add    $0x1,%edx
+  803039:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80303c:	7e 07                	jle    803045 <nsipc_recvmsg+0x55>
+  80303e:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  803043:	7e e0                	jle    803025 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  803045:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  80304b:	c1 fa 0c             	sar    $0xc,%edx
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	e8 0a f9 ff ff       	call   802962 <nsbulk_own>
+  803058:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80305b:	85 c0                	test   %eax,%eax
+  80305d:	78 67                	js     8030c6 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80305f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803062:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  803067:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80306d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803070:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  803075:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80307a:	89 f2                	mov    %esi,%edx
+  80307c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  803081:	e8 44 f9 ff ff       	call   8029ca <nsipc_bulk>
+  803086:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	78 39                	js     8030c6 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  80308d:	39 f0                	cmp    %esi,%eax
+  80308f:	7f 4a                	jg     8030db <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  803091:	bf 00 00 00 00       	mov    $0x0,%edi
+  803096:	85 c0                	test   %eax,%eax
+  803098:	7e 2c                	jle    8030c6 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  80309a:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80309d:	29 fe                	sub    %edi,%esi
+  80309f:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030a2:	39 c6                	cmp    %eax,%esi
+  8030a4:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8030a7:	83 ec 04             	sub    $0x4,%esp
+  8030aa:	56                   	push   %esi
+  8030ab:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8030b1:	50                   	push   %eax
+  8030b2:	ff 33                	push   (%ebx)
+  8030b4:	e8 7b dc ff ff       	call   800d34 <memmove>
+		n += m;
+  8030b9:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8030bb:	83 c3 08             	add    $0x8,%ebx
+  8030be:	83 c4 10             	add    $0x10,%esp
+  8030c1:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8030c4:	7f d4                	jg     80309a <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8030c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030cc:	5b                   	pop    %ebx
+  8030cd:	5e                   	pop    %esi
+  8030ce:	5f                   	pop    %edi
+  8030cf:	5d                   	pop    %ebp
+  8030d0:	c3                   	ret
+	int r, i, n, len = 0;
+  8030d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d6:	e9 6a ff ff ff       	jmp    803045 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  8030db:	68 04 4d 80 00       	push   $0x804d04
+  8030e0:	68 0d 4d 80 00       	push   $0x804d0d
+  8030e5:	68 3b 01 00 00       	push   $0x13b
+  8030ea:	68 22 4d 80 00       	push   $0x804d22
+  8030ef:	e8 be d2 ff ff       	call   8003b2 <_panic>
+
+008030f4 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  8030f4:	55                   	push   %ebp
+  8030f5:	89 e5                	mov    %esp,%ebp
+  8030f7:	57                   	push   %edi
+  8030f8:	56                   	push   %esi
+  8030f9:	53                   	push   %ebx
+  8030fa:	83 ec 0c             	sub    $0xc,%esp
+  8030fd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803100:	8b 75 10             	mov    0x10(%ebp),%esi
+  803103:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  803106:	8b 45 08             	mov    0x8(%ebp),%eax
+  803109:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80310e:	8b 07                	mov    (%edi),%eax
+  803110:	a3 04 80 80 00       	mov    %eax,0x808004
+  803115:	8b 47 04             	mov    0x4(%edi),%eax
+  803118:	a3 08 80 80 00       	mov    %eax,0x808008
+  80311d:	8b 47 08             	mov    0x8(%edi),%eax
+  803120:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  803125:	8b 47 0c             	mov    0xc(%edi),%eax
+  803128:	a3 10 80 80 00       	mov    %eax,0x808010
+  80312d:	8b 47 10             	mov    0x10(%edi),%eax
+  803130:	a3 14 80 80 00       	mov    %eax,0x808014
+  803135:	8b 47 14             	mov    0x14(%edi),%eax
+  803138:	a3 18 80 80 00       	mov    %eax,0x808018
+  80313d:	8b 47 18             	mov    0x18(%edi),%eax
+  803140:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  803145:	8b 47 1c             	mov    0x1c(%edi),%eax
+  803148:	a3 20 80 80 00       	mov    %eax,0x808020
+  80314d:	8b 47 20             	mov    0x20(%edi),%eax
+  803150:	a3 24 80 80 00       	mov    %eax,0x808024
+  803155:	8b 47 24             	mov    0x24(%edi),%eax
+  803158:	a3 28 80 80 00       	mov    %eax,0x808028
+  80315d:	8b 47 28             	mov    0x28(%edi),%eax
+  803160:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  803165:	8b 47 2c             	mov    0x2c(%edi),%eax
+  803168:	a3 30 80 80 00       	mov    %eax,0x808030
+  80316d:	8b 47 30             	mov    0x30(%edi),%eax
+  803170:	a3 34 80 80 00       	mov    %eax,0x808034
+  803175:	8b 47 34             	mov    0x34(%edi),%eax
+  803178:	a3 38 80 80 00       	mov    %eax,0x808038
+  80317d:	8b 47 38             	mov    0x38(%edi),%eax
+  803180:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  803185:	8b 47 3c             	mov    0x3c(%edi),%eax
+  803188:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  80318d:	8b 06                	mov    (%esi),%eax
+  80318f:	a3 44 80 80 00       	mov    %eax,0x808044
+  803194:	8b 46 04             	mov    0x4(%esi),%eax
+  803197:	a3 48 80 80 00       	mov    %eax,0x808048
+  80319c:	8b 46 08             	mov    0x8(%esi),%eax
+  80319f:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8031a4:	8b 46 0c             	mov    0xc(%esi),%eax
+  8031a7:	a3 50 80 80 00       	mov    %eax,0x808050
+  8031ac:	8b 46 10             	mov    0x10(%esi),%eax
+  8031af:	a3 54 80 80 00       	mov    %eax,0x808054
+  8031b4:	8b 46 14             	mov    0x14(%esi),%eax
+  8031b7:	a3 58 80 80 00       	mov    %eax,0x808058
+  8031bc:	8b 46 18             	mov    0x18(%esi),%eax
+  8031bf:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8031c4:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8031c7:	a3 60 80 80 00       	mov    %eax,0x808060
+  8031cc:	8b 46 20             	mov    0x20(%esi),%eax
+  8031cf:	a3 64 80 80 00       	mov    %eax,0x808064
+  8031d4:	8b 46 24             	mov    0x24(%esi),%eax
+  8031d7:	a3 68 80 80 00       	mov    %eax,0x808068
+  8031dc:	8b 46 28             	mov    0x28(%esi),%eax
+  8031df:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  8031e4:	8b 46 2c             	mov    0x2c(%esi),%eax
+  8031e7:	a3 70 80 80 00       	mov    %eax,0x808070
+  8031ec:	8b 46 30             	mov    0x30(%esi),%eax
+  8031ef:	a3 74 80 80 00       	mov    %eax,0x808074
+  8031f4:	8b 46 34             	mov    0x34(%esi),%eax
+  8031f7:	a3 78 80 80 00       	mov    %eax,0x808078
+  8031fc:	8b 46 38             	mov    0x38(%esi),%eax
+  8031ff:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  803204:	8b 46 3c             	mov    0x3c(%esi),%eax
+  803207:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80320c:	8b 03                	mov    (%ebx),%eax
+  80320e:	a3 84 80 80 00       	mov    %eax,0x808084
+  803213:	8b 43 04             	mov    0x4(%ebx),%eax
+  803216:	a3 88 80 80 00       	mov    %eax,0x808088
+  80321b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80321e:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  803223:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803226:	a3 90 80 80 00       	mov    %eax,0x808090
+  80322b:	8b 43 10             	mov    0x10(%ebx),%eax
+  80322e:	a3 94 80 80 00       	mov    %eax,0x808094
+  803233:	8b 43 14             	mov    0x14(%ebx),%eax
+  803236:	a3 98 80 80 00       	mov    %eax,0x808098
+  80323b:	8b 43 18             	mov    0x18(%ebx),%eax
+  80323e:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  803243:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  803246:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  80324b:	8b 43 20             	mov    0x20(%ebx),%eax
+  80324e:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  803253:	8b 43 24             	mov    0x24(%ebx),%eax
+  803256:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  80325b:	8b 43 28             	mov    0x28(%ebx),%eax
+  80325e:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  803263:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  803266:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  80326b:	8b 43 30             	mov    0x30(%ebx),%eax
+  80326e:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  803273:	8b 43 34             	mov    0x34(%ebx),%eax
+  803276:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  80327b:	8b 43 38             	mov    0x38(%ebx),%eax
+  80327e:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  803283:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  803286:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  80328b:	8b 45 18             	mov    0x18(%ebp),%eax
+  80328e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  803293:	b8 0e 00 00 00       	mov    $0xe,%eax
+  803298:	e8 2b f6 ff ff       	call   8028c8 <nsipc>
+  80329d:	85 c0                	test   %eax,%eax
+  80329f:	0f 88 ad 01 00 00    	js     803452 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8032a5:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8032ab:	89 17                	mov    %edx,(%edi)
+  8032ad:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8032b3:	89 57 04             	mov    %edx,0x4(%edi)
+  8032b6:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8032bc:	89 57 08             	mov    %edx,0x8(%edi)
+  8032bf:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8032c5:	89 57 0c             	mov    %edx,0xc(%edi)
+  8032c8:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8032ce:	89 57 10             	mov    %edx,0x10(%edi)
+  8032d1:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  8032d7:	89 57 14             	mov    %edx,0x14(%edi)
+  8032da:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  8032e0:	89 57 18             	mov    %edx,0x18(%edi)
+  8032e3:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  8032e9:	89 57 1c             	mov    %edx,0x1c(%edi)
+  8032ec:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  8032f2:	89 57 20             	mov    %edx,0x20(%edi)
+  8032f5:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  8032fb:	89 57 24             	mov    %edx,0x24(%edi)
+  8032fe:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  803304:	89 57 28             	mov    %edx,0x28(%edi)
+  803307:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80330d:	89 57 2c             	mov    %edx,0x2c(%edi)
+  803310:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  803316:	89 57 30             	mov    %edx,0x30(%edi)
+  803319:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80331f:	89 57 34             	mov    %edx,0x34(%edi)
+  803322:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  803328:	89 57 38             	mov    %edx,0x38(%edi)
+  80332b:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  803331:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  803334:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  80333a:	89 16                	mov    %edx,(%esi)
+  80333c:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  803342:	89 56 04             	mov    %edx,0x4(%esi)
+  803345:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  80334b:	89 56 08             	mov    %edx,0x8(%esi)
+  80334e:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  803354:	89 56 0c             	mov    %edx,0xc(%esi)
+  803357:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80335d:	89 56 10             	mov    %edx,0x10(%esi)
+  803360:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  803366:	89 56 14             	mov    %edx,0x14(%esi)
+  803369:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  80336f:	89 56 18             	mov    %edx,0x18(%esi)
+  803372:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  803378:	89 56 1c             	mov    %edx,0x1c(%esi)
+  80337b:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  803381:	89 56 20             	mov    %edx,0x20(%esi)
+  803384:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  80338a:	89 56 24             	mov    %edx,0x24(%esi)
+  80338d:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  803393:	89 56 28             	mov    %edx,0x28(%esi)
+  803396:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  80339c:	89 56 2c             	mov    %edx,0x2c(%esi)
+  80339f:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8033a5:	89 56 30             	mov    %edx,0x30(%esi)
+  8033a8:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8033ae:	89 56 34             	mov    %edx,0x34(%esi)
+  8033b1:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8033b7:	89 56 38             	mov    %edx,0x38(%esi)
+  8033ba:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8033c0:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8033c3:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8033c9:	89 13                	mov    %edx,(%ebx)
+  8033cb:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8033d1:	89 53 04             	mov    %edx,0x4(%ebx)
+  8033d4:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  8033da:	89 53 08             	mov    %edx,0x8(%ebx)
+  8033dd:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  8033e3:	89 53 0c             	mov    %edx,0xc(%ebx)
+  8033e6:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  8033ec:	89 53 10             	mov    %edx,0x10(%ebx)
+  8033ef:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  8033f5:	89 53 14             	mov    %edx,0x14(%ebx)
+  8033f8:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  8033fe:	89 53 18             	mov    %edx,0x18(%ebx)
+  803401:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  803407:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80340a:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  803410:	89 53 20             	mov    %edx,0x20(%ebx)
+  803413:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  803419:	89 53 24             	mov    %edx,0x24(%ebx)
+  80341c:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  803422:	89 53 28             	mov    %edx,0x28(%ebx)
+  803425:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  80342b:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  80342e:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  803434:	89 53 30             	mov    %edx,0x30(%ebx)
+  803437:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  80343d:	89 53 34             	mov    %edx,0x34(%ebx)
+  803440:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  803446:	89 53 38             	mov    %edx,0x38(%ebx)
+  803449:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  80344f:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  803452:	83 c4 0c             	add    $0xc,%esp
+  803455:	5b                   	pop    %ebx
+  803456:	5e                   	pop    %esi
+  803457:	5f                   	pop    %edi
+  803458:	5d                   	pop    %ebp
+  803459:	c3                   	ret
+
+0080345a <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  80345a:	55                   	push   %ebp
+  80345b:	89 e5                	mov    %esp,%ebp
+  80345d:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  803460:	8b 45 08             	mov    0x8(%ebp),%eax
+  803463:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  803468:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80346b:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  803470:	8b 45 10             	mov    0x10(%ebp),%eax
+  803473:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  803478:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80347d:	e8 46 f4 ff ff       	call   8028c8 <nsipc>
+}
+  803482:	c9                   	leave
+  803483:	c3                   	ret
+
+00803484 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  803484:	55                   	push   %ebp
+  803485:	89 e5                	mov    %esp,%ebp
+  803487:	56                   	push   %esi
+  803488:	53                   	push   %ebx
+  803489:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  80348c:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  803492:	8b 45 10             	mov    0x10(%ebp),%eax
+  803495:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  80349a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80349f:	e8 24 f4 ff ff       	call   8028c8 <nsipc>
+  8034a4:	89 c3                	mov    %eax,%ebx
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	7e 1f                	jle    8034c9 <nsipc_evwait+0x45>
+		assert(r <= max);
+  8034aa:	39 c6                	cmp    %eax,%esi
+  8034ac:	7c 24                	jl     8034d2 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  8034ae:	83 ec 04             	sub    $0x4,%esp
+  8034b1:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  8034b8:	50                   	push   %eax
+  8034b9:	68 00 80 80 00       	push   $0x808000
+  8034be:	ff 75 08             	push   0x8(%ebp)
+  8034c1:	e8 6e d8 ff ff       	call   800d34 <memmove>
+  8034c6:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8034c9:	89 d8                	mov    %ebx,%eax
+  8034cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034ce:	5b                   	pop    %ebx
+  8034cf:	5e                   	pop    %esi
+  8034d0:	5d                   	pop    %ebp
+  8034d1:	c3                   	ret
+		assert(r <= max);
+  8034d2:	68 3a 4d 80 00       	push   $0x804d3a
+  8034d7:	68 0d 4d 80 00       	push   $0x804d0d
+  8034dc:	68 6a 01 00 00       	push   $0x16a
+  8034e1:	68 22 4d 80 00       	push   $0x804d22
+  8034e6:	e8 c7 ce ff ff       	call   8003b2 <_panic>
+
+008034eb <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8034eb:	55                   	push   %ebp
+  8034ec:	89 e5                	mov    %esp,%ebp
+  8034ee:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8034f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f4:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  8034f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034fc:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  803501:	8b 45 10             	mov    0x10(%ebp),%eax
+  803504:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  803509:	b8 09 00 00 00       	mov    $0x9,%eax
+  80350e:	e8 b5 f3 ff ff       	call   8028c8 <nsipc>
+}
+  803513:	c9                   	leave
+  803514:	c3                   	ret
+
+00803515 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  803515:	55                   	push   %ebp
+  803516:	89 e5                	mov    %esp,%ebp
+  803518:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  80351b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80351e:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  803523:	b8 0a 00 00 00       	mov    $0xa,%eax
+  803528:	e8 9b f3 ff ff       	call   8028c8 <nsipc>
+}
+  80352d:	c9                   	leave
+  80352e:	c3                   	ret
+
+0080352f <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  80352f:	55                   	push   %ebp
+  803530:	89 e5                	mov    %esp,%ebp
+  803532:	53                   	push   %ebx
+  803533:	83 ec 04             	sub    $0x4,%esp
+  803536:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  803539:	b8 12 00 00 00       	mov    $0x12,%eax
+  80353e:	e8 85 f3 ff ff       	call   8028c8 <nsipc>
+  803543:	85 c0                	test   %eax,%eax
+  803545:	78 50                	js     803597 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  803547:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  80354d:	89 13                	mov    %edx,(%ebx)
+  80354f:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803555:	89 53 04             	mov    %edx,0x4(%ebx)
+  803558:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  80355e:	89 53 08             	mov    %edx,0x8(%ebx)
+  803561:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  803567:	89 53 0c             	mov    %edx,0xc(%ebx)
+  80356a:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  803570:	89 53 10             	mov    %edx,0x10(%ebx)
+  803573:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  803579:	89 53 14             	mov    %edx,0x14(%ebx)
+  80357c:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  803582:	89 53 18             	mov    %edx,0x18(%ebx)
+  803585:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80358b:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  80358e:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  803594:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  803597:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80359a:	c9                   	leave
+  80359b:	c3                   	ret
+
+0080359c <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  80359c:	55                   	push   %ebp
+  80359d:	89 e5                	mov    %esp,%ebp
+  80359f:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  8035a2:	6a 03                	push   $0x3
+  8035a4:	e8 08 0f 00 00       	call   8044b1 <ipc_find_env>
+  8035a9:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	nsipcbuf.shard.req_shard = shard;
+  8035ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b1:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  8035b6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8035bb:	e8 08 f3 ff ff       	call   8028c8 <nsipc>
+  8035c0:	83 c4 10             	add    $0x10,%esp
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	78 0a                	js     8035d1 <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  8035c7:	a3 e4 69 80 00       	mov    %eax,0x8069e4
+	return 0;
+  8035cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035d1:	c9                   	leave
+  8035d2:	c3                   	ret
+
+008035d3 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  8035d3:	55                   	push   %ebp
+  8035d4:	89 e5                	mov    %esp,%ebp
+  8035d6:	57                   	push   %edi
+  8035d7:	56                   	push   %esi
+  8035d8:	53                   	push   %ebx
+  8035d9:	83 ec 1c             	sub    $0x1c,%esp
+  8035dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8035e2:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  8035e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035ec:	89 e0                	mov    %esp,%eax
+  8035ee:	89 f2                	mov    %esi,%edx
+  8035f0:	29 c2                	sub    %eax,%edx
+  8035f2:	89 d0                	mov    %edx,%eax
+  8035f4:	c1 e8 0f             	shr    $0xf,%eax
+  8035f7:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  8035fd:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  803600:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  803607:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  80360a:	83 ec 0c             	sub    $0xc,%esp
+  80360d:	ff 75 e0             	push   -0x20(%ebp)
+  803610:	e8 db 0e 00 00       	call   8044f0 <pageref>
+  803615:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803618:	83 c4 04             	add    $0x4,%esp
+  80361b:	ff 75 dc             	push   -0x24(%ebp)
+  80361e:	e8 cd 0e 00 00       	call   8044f0 <pageref>
+  803623:	89 e2                	mov    %esp,%edx
+  803625:	89 f1                	mov    %esi,%ecx
+  803627:	29 d1                	sub    %edx,%ecx
+	return slot < NTHREADS ? slot : 0;
+  803629:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  80362c:	89 ca                	mov    %ecx,%edx
+  80362e:	c1 ea 0f             	shr    $0xf,%edx
+  803631:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  803637:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  80363a:	8b 14 95 00 6a 80 00 	mov    0x806a00(,%edx,4),%edx
+  803641:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  803644:	39 d7                	cmp    %edx,%edi
+  803646:	74 40                	je     803688 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  803648:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80364b:	75 9f                	jne    8035ec <_pipeisclosed+0x19>
+  80364d:	89 e2                	mov    %esp,%edx
+  80364f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803654:	29 d0                	sub    %edx,%eax
+  803656:	89 c2                	mov    %eax,%edx
+  803658:	c1 ea 0f             	shr    $0xf,%edx
+  80365b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803660:	b8 00 00 00 00       	mov    $0x0,%eax
+  803665:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803668:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80366f:	8b 40 58             	mov    0x58(%eax),%eax
+  803672:	6a 01                	push   $0x1
+  803674:	50                   	push   %eax
+  803675:	57                   	push   %edi
+  803676:	68 43 4d 80 00       	push   $0x804d43
+  80367b:	e8 0d ce ff ff       	call   80048d <cprintf>
+  803680:	83 c4 10             	add    $0x10,%esp
+  803683:	e9 5f ff ff ff       	jmp    8035e7 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  803688:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80368b:	0f 94 c0             	sete   %al
+  80368e:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  803691:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803694:	5b                   	pop    %ebx
+  803695:	5e                   	pop    %esi
+  803696:	5f                   	pop    %edi
+  803697:	5d                   	pop    %ebp
+  803698:	c3                   	ret
+
+00803699 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803699:	55                   	push   %ebp
+  80369a:	89 e5                	mov    %esp,%ebp
+  80369c:	53                   	push   %ebx
+  80369d:	83 ec 0c             	sub    $0xc,%esp
+  8036a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8036a3:	53                   	push   %ebx
+  8036a4:	6a 00                	push   $0x0
+  8036a6:	e8 92 d9 ff ff       	call   80103d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8036ab:	89 1c 24             	mov    %ebx,(%esp)
+  8036ae:	e8 f4 e4 ff ff       	call   801ba7 <fd2data>
+  8036b3:	83 c4 08             	add    $0x8,%esp
+  8036b6:	50                   	push   %eax
+  8036b7:	6a 00                	push   $0x0
+  8036b9:	e8 7f d9 ff ff       	call   80103d <sys_page_unmap>
+}
+  8036be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c1:	c9                   	leave
+  8036c2:	c3                   	ret
+
+008036c3 <devpipe_read>:
+{
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	57                   	push   %edi
+  8036c7:	56                   	push   %esi
+  8036c8:	53                   	push   %ebx
+  8036c9:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8036cc:	ff 75 08             	push   0x8(%ebp)
+  8036cf:	e8 d3 e4 ff ff       	call   801ba7 <fd2data>
+  8036d4:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  8036d6:	8b 70 04             	mov    0x4(%eax),%esi
+  8036d9:	8b 00                	mov    (%eax),%eax
+  8036db:	83 c4 10             	add    $0x10,%esp
+  8036de:	39 f0                	cmp    %esi,%eax
+  8036e0:	75 36                	jne    803718 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  8036e2:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  8036e5:	89 da                	mov    %ebx,%edx
+  8036e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036ea:	e8 e4 fe ff ff       	call   8035d3 <_pipeisclosed>
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	0f 85 d4 00 00 00    	jne    8037cb <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  8036f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036fc:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  803700:	83 ec 04             	sub    $0x4,%esp
+  803703:	6a ff                	push   $0xffffffff
+  803705:	56                   	push   %esi
+  803706:	57                   	push   %edi
+  803707:	e8 aa dc ff ff       	call   8013b6 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  80370c:	8b 73 04             	mov    0x4(%ebx),%esi
+  80370f:	8b 03                	mov    (%ebx),%eax
+  803711:	83 c4 10             	add    $0x10,%esp
+  803714:	39 c6                	cmp    %eax,%esi
+  803716:	74 cd                	je     8036e5 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803718:	8b 73 04             	mov    0x4(%ebx),%esi
+  80371b:	8b 03                	mov    (%ebx),%eax
+  80371d:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803723:	29 c6                	sub    %eax,%esi
+  803725:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80372a:	f7 e6                	mul    %esi
+  80372c:	c1 ea 0c             	shr    $0xc,%edx
+  80372f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803735:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  803737:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80373a:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80373e:	8b 0b                	mov    (%ebx),%ecx
+  803740:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803745:	f7 e1                	mul    %ecx
+  803747:	c1 ea 0b             	shr    $0xb,%edx
+  80374a:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  803750:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  803752:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  803757:	29 cf                	sub    %ecx,%edi
+  803759:	39 f7                	cmp    %esi,%edi
+  80375b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  80375e:	83 ec 04             	sub    $0x4,%esp
+  803761:	57                   	push   %edi
+  803762:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  803766:	50                   	push   %eax
+  803767:	ff 75 0c             	push   0xc(%ebp)
+  80376a:	e8 c5 d5 ff ff       	call   800d34 <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  80376f:	83 c4 0c             	add    $0xc,%esp
+  803772:	89 f0                	mov    %esi,%eax
+  803774:	29 f8                	sub    %edi,%eax
+  803776:	50                   	push   %eax
+  803777:	8d 43 10             	lea    0x10(%ebx),%eax
+  80377a:	50                   	push   %eax
+  80377b:	89 f8                	mov    %edi,%eax
+  80377d:	03 45 0c             	add    0xc(%ebp),%eax
+  803780:	50                   	push   %eax
+  803781:	e8 ae d5 ff ff       	call   800d34 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  803786:	8b 0b                	mov    (%ebx),%ecx
+  803788:	01 f1                	add    %esi,%ecx
+  80378a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80378f:	f7 e1                	mul    %ecx
+  803791:	c1 ea 0c             	shr    $0xc,%edx
+  803794:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80379a:	29 c1                	sub    %eax,%ecx
+  80379c:	89 0b                	mov    %ecx,(%ebx)
+  80379e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a3:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  8037a7:	83 c4 10             	add    $0x10,%esp
+  8037aa:	85 c0                	test   %eax,%eax
+  8037ac:	75 0a                	jne    8037b8 <devpipe_read+0xf5>
+	return n;
+  8037ae:	89 f0                	mov    %esi,%eax
+}
+  8037b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b3:	5b                   	pop    %ebx
+  8037b4:	5e                   	pop    %esi
+  8037b5:	5f                   	pop    %edi
+  8037b6:	5d                   	pop    %ebp
+  8037b7:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  8037b8:	83 ec 08             	sub    $0x8,%esp
+  8037bb:	68 00 04 00 00       	push   $0x400
+  8037c0:	53                   	push   %ebx
+  8037c1:	e8 12 dc ff ff       	call   8013d8 <sys_futex_wake>
+  8037c6:	83 c4 10             	add    $0x10,%esp
+  8037c9:	eb e3                	jmp    8037ae <devpipe_read+0xeb>
+			return 0;
+  8037cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d0:	eb de                	jmp    8037b0 <devpipe_read+0xed>
+
+008037d2 <devpipe_write>:
+{
+  8037d2:	55                   	push   %ebp
+  8037d3:	89 e5                	mov    %esp,%ebp
+  8037d5:	57                   	push   %edi
+  8037d6:	56                   	push   %esi
+  8037d7:	53                   	push   %ebx
+  8037d8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8037db:	ff 75 08             	push   0x8(%ebp)
+  8037de:	e8 c4 e3 ff ff       	call   801ba7 <fd2data>
+  8037e3:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  8037e5:	83 c4 10             	add    $0x10,%esp
+  8037e8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037ef:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  8037f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8037f8:	0f 84 43 01 00 00    	je     803941 <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8037fe:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803801:	8b 06                	mov    (%esi),%eax
+  803803:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803809:	29 c1                	sub    %eax,%ecx
+  80380b:	89 c8                	mov    %ecx,%eax
+  80380d:	f7 e7                	mul    %edi
+  80380f:	c1 ea 0c             	shr    $0xc,%edx
+  803812:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803818:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80381a:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803820:	75 52                	jne    803874 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  803822:	89 f2                	mov    %esi,%edx
+  803824:	8b 45 08             	mov    0x8(%ebp),%eax
+  803827:	e8 a7 fd ff ff       	call   8035d3 <_pipeisclosed>
+  80382c:	85 c0                	test   %eax,%eax
+  80382e:	0f 85 28 01 00 00    	jne    80395c <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  803834:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803836:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803839:	8b 06                	mov    (%esi),%eax
+  80383b:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803841:	29 c1                	sub    %eax,%ecx
+  803843:	89 c8                	mov    %ecx,%eax
+  803845:	f7 e7                	mul    %edi
+  803847:	c1 ea 0c             	shr    $0xc,%edx
+  80384a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803850:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  803852:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  803858:	75 a4                	jne    8037fe <devpipe_write+0x2c>
+  80385a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80385f:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  803863:	83 ec 04             	sub    $0x4,%esp
+  803866:	6a ff                	push   $0xffffffff
+  803868:	53                   	push   %ebx
+  803869:	56                   	push   %esi
+  80386a:	e8 47 db ff ff       	call   8013b6 <sys_futex_wait>
+}
+  80386f:	83 c4 10             	add    $0x10,%esp
+  803872:	eb 8a                	jmp    8037fe <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803874:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803877:	8b 06                	mov    (%esi),%eax
+  803879:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  80387f:	29 c1                	sub    %eax,%ecx
+  803881:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803886:	f7 e1                	mul    %ecx
+  803888:	c1 ea 0c             	shr    $0xc,%edx
+  80388b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803891:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  803893:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  803898:	89 d8                	mov    %ebx,%eax
+  80389a:	29 c8                	sub    %ecx,%eax
+  80389c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80389f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038a2:	29 ca                	sub    %ecx,%edx
+  8038a4:	39 d0                	cmp    %edx,%eax
+  8038a6:	0f 46 d0             	cmovbe %eax,%edx
+  8038a9:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  8038ac:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8038af:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8038b4:	f7 e1                	mul    %ecx
+  8038b6:	c1 ea 0b             	shr    $0xb,%edx
+  8038b9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8038bf:	89 ca                	mov    %ecx,%edx
+  8038c1:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8038c3:	29 d3                	sub    %edx,%ebx
+  8038c5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8038c8:	39 c3                	cmp    %eax,%ebx
+  8038ca:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  8038cd:	83 ec 04             	sub    $0x4,%esp
+  8038d0:	53                   	push   %ebx
+  8038d1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038d4:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8038d7:	51                   	push   %ecx
+  8038d8:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  8038dc:	50                   	push   %eax
+  8038dd:	e8 52 d4 ff ff       	call   800d34 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8038e2:	83 c4 0c             	add    $0xc,%esp
+  8038e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8038e8:	29 d8                	sub    %ebx,%eax
+  8038ea:	50                   	push   %eax
+  8038eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8038ee:	01 cb                	add    %ecx,%ebx
+  8038f0:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8038f3:	53                   	push   %ebx
+  8038f4:	8d 46 10             	lea    0x10(%esi),%eax
+  8038f7:	50                   	push   %eax
+  8038f8:	e8 37 d4 ff ff       	call   800d34 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  8038fd:	8b 4e 04             	mov    0x4(%esi),%ecx
+  803900:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803903:	01 c1                	add    %eax,%ecx
+  803905:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80390a:	f7 e1                	mul    %ecx
+  80390c:	c1 ea 0c             	shr    $0xc,%edx
+  80390f:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803915:	89 ca                	mov    %ecx,%edx
+  803917:	29 c2                	sub    %eax,%edx
+  803919:	89 56 04             	mov    %edx,0x4(%esi)
+  80391c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803921:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803925:	83 c4 10             	add    $0x10,%esp
+  803928:	85 c0                	test   %eax,%eax
+  80392a:	75 1a                	jne    803946 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80392c:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80392f:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803932:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803935:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803938:	0f 82 c0 fe ff ff    	jb     8037fe <devpipe_write+0x2c>
+  80393e:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  803941:	8b 45 10             	mov    0x10(%ebp),%eax
+  803944:	eb 1b                	jmp    803961 <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  803946:	83 ec 08             	sub    $0x8,%esp
+  803949:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  80394e:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  803951:	50                   	push   %eax
+  803952:	e8 81 da ff ff       	call   8013d8 <sys_futex_wake>
+  803957:	83 c4 10             	add    $0x10,%esp
+  80395a:	eb d0                	jmp    80392c <devpipe_write+0x15a>
+				return 0;
+  80395c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803961:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803964:	5b                   	pop    %ebx
+  803965:	5e                   	pop    %esi
+  803966:	5f                   	pop    %edi
+  803967:	5d                   	pop    %ebp
+  803968:	c3                   	ret
+
+00803969 <devpipe_stat>:
+{
+  803969:	55                   	push   %ebp
+  80396a:	89 e5                	mov    %esp,%ebp
+  80396c:	56                   	push   %esi
+  80396d:	53                   	push   %ebx
+  80396e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803971:	83 ec 0c             	sub    $0xc,%esp
+  803974:	ff 75 08             	push   0x8(%ebp)
+  803977:	e8 2b e2 ff ff       	call   801ba7 <fd2data>
+  80397c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80397e:	83 c4 08             	add    $0x8,%esp
+  803981:	68 56 4d 80 00       	push   $0x804d56
+  803986:	53                   	push   %ebx
+  803987:	e8 f8 d1 ff ff       	call   800b84 <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  80398c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80398f:	8b 06                	mov    (%esi),%eax
+  803991:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  803997:	29 c1                	sub    %eax,%ecx
+  803999:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80399e:	89 c8                	mov    %ecx,%eax
+  8039a0:	f7 e2                	mul    %edx
+  8039a2:	c1 ea 0c             	shr    $0xc,%edx
+  8039a5:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8039ab:	29 d1                	sub    %edx,%ecx
+  8039ad:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  8039b3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8039ba:	00 00 00 
+	stat->st_dev = &devpipe;
+  8039bd:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  8039c4:	50 80 00 
+}
+  8039c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039cf:	5b                   	pop    %ebx
+  8039d0:	5e                   	pop    %esi
+  8039d1:	5d                   	pop    %ebp
+  8039d2:	c3                   	ret
+
+008039d3 <devpipe_poll>:
+{
+  8039d3:	55                   	push   %ebp
+  8039d4:	89 e5                	mov    %esp,%ebp
+  8039d6:	57                   	push   %edi
+  8039d7:	56                   	push   %esi
+  8039d8:	53                   	push   %ebx
+  8039d9:	83 ec 18             	sub    $0x18,%esp
+  8039dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8039df:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8039e2:	57                   	push   %edi
+  8039e3:	e8 bf e1 ff ff       	call   801ba7 <fd2data>
+  8039e8:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  8039ea:	83 c4 10             	add    $0x10,%esp
+  8039ed:	89 f3                	mov    %esi,%ebx
+  8039ef:	83 e3 01             	and    $0x1,%ebx
+  8039f2:	75 27                	jne    803a1b <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  8039f4:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  8039fa:	75 48                	jne    803a44 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  8039fc:	89 ca                	mov    %ecx,%edx
+  8039fe:	89 f8                	mov    %edi,%eax
+  803a00:	e8 ce fb ff ff       	call   8035d3 <_pipeisclosed>
+  803a05:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803a07:	89 d8                	mov    %ebx,%eax
+  803a09:	83 c8 10             	or     $0x10,%eax
+  803a0c:	85 d2                	test   %edx,%edx
+  803a0e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  803a11:	89 d8                	mov    %ebx,%eax
+  803a13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a16:	5b                   	pop    %ebx
+  803a17:	5e                   	pop    %esi
+  803a18:	5f                   	pop    %edi
+  803a19:	5d                   	pop    %ebp
+  803a1a:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a1b:	8b 58 04             	mov    0x4(%eax),%ebx
+  803a1e:	8b 00                	mov    (%eax),%eax
+  803a20:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803a26:	29 c3                	sub    %eax,%ebx
+  803a28:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a2d:	89 d8                	mov    %ebx,%eax
+  803a2f:	f7 e2                	mul    %edx
+  803a31:	c1 ea 0c             	shr    $0xc,%edx
+  803a34:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803a3a:	39 d3                	cmp    %edx,%ebx
+  803a3c:	0f 95 c3             	setne  %bl
+  803a3f:	0f b6 db             	movzbl %bl,%ebx
+  803a42:	eb b0                	jmp    8039f4 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803a44:	8b 71 04             	mov    0x4(%ecx),%esi
+  803a47:	8b 01                	mov    (%ecx),%eax
+  803a49:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  803a4f:	29 c6                	sub    %eax,%esi
+  803a51:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803a56:	89 f0                	mov    %esi,%eax
+  803a58:	f7 e2                	mul    %edx
+  803a5a:	c1 ea 0c             	shr    $0xc,%edx
+  803a5d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803a63:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803a65:	89 d8                	mov    %ebx,%eax
+  803a67:	83 c8 04             	or     $0x4,%eax
+  803a6a:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  803a70:	0f 42 d8             	cmovb  %eax,%ebx
+  803a73:	eb 87                	jmp    8039fc <devpipe_poll+0x29>
+
+00803a75 <pipe>:
+{
+  803a75:	55                   	push   %ebp
+  803a76:	89 e5                	mov    %esp,%ebp
+  803a78:	56                   	push   %esi
+  803a79:	53                   	push   %ebx
+  803a7a:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803a7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a80:	50                   	push   %eax
+  803a81:	e8 38 e1 ff ff       	call   801bbe <fd_alloc>
+  803a86:	89 c3                	mov    %eax,%ebx
+  803a88:	83 c4 10             	add    $0x10,%esp
+  803a8b:	85 c0                	test   %eax,%eax
+  803a8d:	0f 88 23 01 00 00    	js     803bb6 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803a93:	83 ec 04             	sub    $0x4,%esp
+  803a96:	68 07 04 00 00       	push   $0x407
+  803a9b:	ff 75 f4             	push   -0xc(%ebp)
+  803a9e:	6a 00                	push   $0x0
+  803aa0:	e8 13 d5 ff ff       	call   800fb8 <sys_page_alloc>
+  803aa5:	89 c3                	mov    %eax,%ebx
+  803aa7:	83 c4 10             	add    $0x10,%esp
+  803aaa:	85 c0                	test   %eax,%eax
+  803aac:	0f 88 04 01 00 00    	js     803bb6 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803ab2:	83 ec 0c             	sub    $0xc,%esp
+  803ab5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803ab8:	50                   	push   %eax
+  803ab9:	e8 00 e1 ff ff       	call   801bbe <fd_alloc>
+  803abe:	89 c3                	mov    %eax,%ebx
+  803ac0:	83 c4 10             	add    $0x10,%esp
+  803ac3:	85 c0                	test   %eax,%eax
+  803ac5:	0f 88 db 00 00 00    	js     803ba6 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803acb:	83 ec 04             	sub    $0x4,%esp
+  803ace:	68 07 04 00 00       	push   $0x407
+  803ad3:	ff 75 f0             	push   -0x10(%ebp)
+  803ad6:	6a 00                	push   $0x0
+  803ad8:	e8 db d4 ff ff       	call   800fb8 <sys_page_alloc>
+  803add:	89 c3                	mov    %eax,%ebx
+  803adf:	83 c4 10             	add    $0x10,%esp
+  803ae2:	85 c0                	test   %eax,%eax
+  803ae4:	0f 88 bc 00 00 00    	js     803ba6 <pipe+0x131>
+	va = fd2data(fd0);
+  803aea:	83 ec 0c             	sub    $0xc,%esp
+  803aed:	ff 75 f4             	push   -0xc(%ebp)
+  803af0:	e8 b2 e0 ff ff       	call   801ba7 <fd2data>
+  803af5:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803af7:	83 c4 0c             	add    $0xc,%esp
+  803afa:	68 07 04 00 00       	push   $0x407
+  803aff:	50                   	push   %eax
+  803b00:	6a 00                	push   $0x0
+  803b02:	e8 b1 d4 ff ff       	call   800fb8 <sys_page_alloc>
+  803b07:	89 c3                	mov    %eax,%ebx
+  803b09:	83 c4 10             	add    $0x10,%esp
+  803b0c:	85 c0                	test   %eax,%eax
+  803b0e:	0f 88 82 00 00 00    	js     803b96 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b14:	83 ec 0c             	sub    $0xc,%esp
+  803b17:	ff 75 f0             	push   -0x10(%ebp)
+  803b1a:	e8 88 e0 ff ff       	call   801ba7 <fd2data>
+  803b1f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b26:	50                   	push   %eax
+  803b27:	6a 00                	push   $0x0
+  803b29:	56                   	push   %esi
+  803b2a:	6a 00                	push   $0x0
+  803b2c:	e8 ca d4 ff ff       	call   800ffb <sys_page_map>
+  803b31:	89 c3                	mov    %eax,%ebx
+  803b33:	83 c4 20             	add    $0x20,%esp
+  803b36:	85 c0                	test   %eax,%eax
+  803b38:	78 4e                	js     803b88 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b3a:	a1 60 50 80 00       	mov    0x805060,%eax
+  803b3f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b42:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b44:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b47:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b4e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b51:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b56:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b5d:	83 ec 0c             	sub    $0xc,%esp
+  803b60:	ff 75 f4             	push   -0xc(%ebp)
+  803b63:	e8 2f e0 ff ff       	call   801b97 <fd2num>
+  803b68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b6b:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803b6d:	83 c4 04             	add    $0x4,%esp
+  803b70:	ff 75 f0             	push   -0x10(%ebp)
+  803b73:	e8 1f e0 ff ff       	call   801b97 <fd2num>
+  803b78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803b7b:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803b7e:	83 c4 10             	add    $0x10,%esp
+  803b81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b86:	eb 2e                	jmp    803bb6 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803b88:	83 ec 08             	sub    $0x8,%esp
+  803b8b:	56                   	push   %esi
+  803b8c:	6a 00                	push   $0x0
+  803b8e:	e8 aa d4 ff ff       	call   80103d <sys_page_unmap>
+  803b93:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803b96:	83 ec 08             	sub    $0x8,%esp
+  803b99:	ff 75 f0             	push   -0x10(%ebp)
+  803b9c:	6a 00                	push   $0x0
+  803b9e:	e8 9a d4 ff ff       	call   80103d <sys_page_unmap>
+  803ba3:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803ba6:	83 ec 08             	sub    $0x8,%esp
+  803ba9:	ff 75 f4             	push   -0xc(%ebp)
+  803bac:	6a 00                	push   $0x0
+  803bae:	e8 8a d4 ff ff       	call   80103d <sys_page_unmap>
+  803bb3:	83 c4 10             	add    $0x10,%esp
+}
+  803bb6:	89 d8                	mov    %ebx,%eax
+  803bb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bbb:	5b                   	pop    %ebx
+  803bbc:	5e                   	pop    %esi
+  803bbd:	5d                   	pop    %ebp
+  803bbe:	c3                   	ret
+
+00803bbf <pipeisclosed>:
+{
+  803bbf:	55                   	push   %ebp
+  803bc0:	89 e5                	mov    %esp,%ebp
+  803bc2:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bc5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803bc8:	50                   	push   %eax
+  803bc9:	ff 75 08             	push   0x8(%ebp)
+  803bcc:	e8 3d e0 ff ff       	call   801c0e <fd_lookup>
+  803bd1:	83 c4 10             	add    $0x10,%esp
+  803bd4:	85 c0                	test   %eax,%eax
+  803bd6:	78 18                	js     803bf0 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803bd8:	83 ec 0c             	sub    $0xc,%esp
+  803bdb:	ff 75 f4             	push   -0xc(%ebp)
+  803bde:	e8 c4 df ff ff       	call   801ba7 <fd2data>
+  803be3:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803be5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803be8:	e8 e6 f9 ff ff       	call   8035d3 <_pipeisclosed>
+  803bed:	83 c4 10             	add    $0x10,%esp
+}
+  803bf0:	c9                   	leave
+  803bf1:	c3                   	ret
+
+00803bf2 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803bf2:	55                   	push   %ebp
+  803bf3:	89 e5                	mov    %esp,%ebp
+  803bf5:	56                   	push   %esi
+  803bf6:	53                   	push   %ebx
+  803bf7:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803bfa:	85 f6                	test   %esi,%esi
+  803bfc:	74 40                	je     803c3e <wait+0x4c>
+	e = &envs[ENVX(envid)];
+  803bfe:	89 f3                	mov    %esi,%ebx
+  803c00:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c06:	69 c3 bc 00 00 00    	imul   $0xbc,%ebx,%eax
+  803c0c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803c11:	8b 40 48             	mov    0x48(%eax),%eax
+  803c14:	39 c6                	cmp    %eax,%esi
+  803c16:	75 1f                	jne    803c37 <wait+0x45>
+  803c18:	69 db bc 00 00 00    	imul   $0xbc,%ebx,%ebx
+  803c1e:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c24:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c27:	85 c0                	test   %eax,%eax
+  803c29:	74 0c                	je     803c37 <wait+0x45>
+		sys_yield();
+  803c2b:	e8 69 d3 ff ff       	call   800f99 <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c30:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c33:	39 f0                	cmp    %esi,%eax
+  803c35:	74 ed                	je     803c24 <wait+0x32>
+}
+  803c37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c3a:	5b                   	pop    %ebx
+  803c3b:	5e                   	pop    %esi
+  803c3c:	5d                   	pop    %ebp
+  803c3d:	c3                   	ret
+	assert(envid != 0);
+  803c3e:	68 62 4d 80 00       	push   $0x804d62
+  803c43:	68 0d 4d 80 00       	push   $0x804d0d
+  803c48:	6a 09                	push   $0x9
+  803c4a:	68 6d 4d 80 00       	push   $0x804d6d
+  803c4f:	e8 5e c7 ff ff       	call   8003b2 <_panic>
+
+00803c54 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803c54:	55                   	push   %ebp
+  803c55:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c5a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803c60:	5d                   	pop    %ebp
+  803c61:	c3                   	ret
+
+00803c62 <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  803c62:	55                   	push   %ebp
+  803c63:	89 e5                	mov    %esp,%ebp
+  803c65:	53                   	push   %ebx
+  803c66:	83 ec 04             	sub    $0x4,%esp
+  803c69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803c6c:	8b 03                	mov    (%ebx),%eax
+  803c6e:	85 c0                	test   %eax,%eax
+  803c70:	75 05                	jne    803c77 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  803c72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803c75:	c9                   	leave
+  803c76:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803c77:	83 ec 08             	sub    $0x8,%esp
+  803c7a:	50                   	push   %eax
+  803c7b:	8d 43 04             	lea    0x4(%ebx),%eax
+  803c7e:	50                   	push   %eax
+  803c7f:	e8 09 d6 ff ff       	call   80128d <sys_page_batch>
+	pb->pb_n = 0;
+  803c84:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803c8a:	83 c4 10             	add    $0x10,%esp
+  803c8d:	eb e3                	jmp    803c72 <pgbatch_flush+0x10>
+
+00803c8f <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  803c8f:	55                   	push   %ebp
+  803c90:	89 e5                	mov    %esp,%ebp
+  803c92:	56                   	push   %esi
+  803c93:	53                   	push   %ebx
+  803c94:	89 c3                	mov    %eax,%ebx
+  803c96:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803c98:	83 38 20             	cmpl   $0x20,(%eax)
+  803c9b:	74 2c                	je     803cc9 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803c9d:	8b 03                	mov    (%ebx),%eax
+  803c9f:	8d 50 01             	lea    0x1(%eax),%edx
+  803ca2:	89 13                	mov    %edx,(%ebx)
+  803ca4:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803ca7:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803cab:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803cad:	83 ec 04             	sub    $0x4,%esp
+  803cb0:	6a 18                	push   $0x18
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	50                   	push   %eax
+  803cb5:	e8 45 d0 ff ff       	call   800cff <memset>
+	return 0;
+  803cba:	83 c4 10             	add    $0x10,%esp
+  803cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cc5:	5b                   	pop    %ebx
+  803cc6:	5e                   	pop    %esi
+  803cc7:	5d                   	pop    %ebp
+  803cc8:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803cc9:	83 ec 0c             	sub    $0xc,%esp
+  803ccc:	50                   	push   %eax
+  803ccd:	e8 90 ff ff ff       	call   803c62 <pgbatch_flush>
+  803cd2:	83 c4 10             	add    $0x10,%esp
+  803cd5:	85 c0                	test   %eax,%eax
+  803cd7:	79 c4                	jns    803c9d <pgbatch_slot+0xe>
+  803cd9:	eb e7                	jmp    803cc2 <pgbatch_slot+0x33>
+
+00803cdb <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803cdb:	55                   	push   %ebp
+  803cdc:	89 e5                	mov    %esp,%ebp
+  803cde:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803ce1:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803ce4:	8b 45 08             	mov    0x8(%ebp),%eax
+  803ce7:	e8 a3 ff ff ff       	call   803c8f <pgbatch_slot>
+  803cec:	85 c0                	test   %eax,%eax
+  803cee:	78 20                	js     803d10 <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  803cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803cf3:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  803cf9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803cfc:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803cff:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d02:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d05:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d08:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d10:	c9                   	leave
+  803d11:	c3                   	ret
+
+00803d12 <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  803d12:	55                   	push   %ebp
+  803d13:	89 e5                	mov    %esp,%ebp
+  803d15:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d18:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d1e:	e8 6c ff ff ff       	call   803c8f <pgbatch_slot>
+  803d23:	85 c0                	test   %eax,%eax
+  803d25:	78 2c                	js     803d53 <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803d27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d2a:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  803d30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d33:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803d36:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d39:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803d3c:	8b 55 14             	mov    0x14(%ebp),%edx
+  803d3f:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  803d42:	8b 55 18             	mov    0x18(%ebp),%edx
+  803d45:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803d48:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803d4b:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d53:	c9                   	leave
+  803d54:	c3                   	ret
+
+00803d55 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803d55:	55                   	push   %ebp
+  803d56:	89 e5                	mov    %esp,%ebp
+  803d58:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d5b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d61:	e8 29 ff ff ff       	call   803c8f <pgbatch_slot>
+  803d66:	85 c0                	test   %eax,%eax
+  803d68:	78 1a                	js     803d84 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803d6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d6d:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  803d73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803d76:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803d79:	8b 55 10             	mov    0x10(%ebp),%edx
+  803d7c:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  803d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d84:	c9                   	leave
+  803d85:	c3                   	ret
+
+00803d86 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803d86:	55                   	push   %ebp
+  803d87:	89 e5                	mov    %esp,%ebp
+  803d89:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803d8c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803d8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d92:	e8 f8 fe ff ff       	call   803c8f <pgbatch_slot>
+  803d97:	85 c0                	test   %eax,%eax
+  803d99:	78 20                	js     803dbb <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803d9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803d9e:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803da4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803da7:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803daa:	8b 55 10             	mov    0x10(%ebp),%edx
+  803dad:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803db0:	8b 55 14             	mov    0x14(%ebp),%edx
+  803db3:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803db6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dbb:	c9                   	leave
+  803dbc:	c3                   	ret
+
+00803dbd <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803dbd:	55                   	push   %ebp
+  803dbe:	89 e5                	mov    %esp,%ebp
+  803dc0:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803dc3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  803dc9:	e8 c1 fe ff ff       	call   803c8f <pgbatch_slot>
+  803dce:	85 c0                	test   %eax,%eax
+  803dd0:	78 26                	js     803df8 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  803dd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803dd5:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  803ddb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803dde:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  803de1:	8b 55 10             	mov    0x10(%ebp),%edx
+  803de4:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803de7:	8b 55 14             	mov    0x14(%ebp),%edx
+  803dea:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  803ded:	8b 55 18             	mov    0x18(%ebp),%edx
+  803df0:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803df3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803df8:	c9                   	leave
+  803df9:	c3                   	ret
+
+00803dfa <mutex_init>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+mutex_init(struct mutex *m)
+{
+  803dfa:	55                   	push   %ebp
+  803dfb:	89 e5                	mov    %esp,%ebp
+	m->m_state = 0;
+  803dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e00:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  803e06:	5d                   	pop    %ebp
+  803e07:	c3                   	ret
+
+00803e08 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+  803e08:	55                   	push   %ebp
+  803e09:	89 e5                	mov    %esp,%ebp
+  803e0b:	56                   	push   %esi
+  803e0c:	53                   	push   %ebx
+  803e0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+static inline uint32_t
+cmpxchg(volatile uint32_t *addr, uint32_t oldval, uint32_t newval)
+{
+	uint32_t result;
+
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e15:	ba 01 00 00 00       	mov    $0x1,%edx
+  803e1a:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+	uint32_t c;
+
+	if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	74 2f                	je     803e51 <mutex_lock+0x49>
+		return;
+	// Mark it waited for, and sleep until it is free.  Whoever takes
+	// it this way leaves it marked, since others may be asleep too.
+	if (c != 2)
+  803e22:	83 f8 02             	cmp    $0x2,%eax
+  803e25:	74 0c                	je     803e33 <mutex_lock+0x2b>
+	asm volatile("lock; xchgl %0, %1" :
+  803e27:	b8 02 00 00 00       	mov    $0x2,%eax
+  803e2c:	f0 87 03             	lock xchg %eax,(%ebx)
+		c = xchg(&m->m_state, 2);
+	while (c != 0) {
+  803e2f:	85 c0                	test   %eax,%eax
+  803e31:	74 1e                	je     803e51 <mutex_lock+0x49>
+  803e33:	be 02 00 00 00       	mov    $0x2,%esi
+		sys_futex_wait(&m->m_state, 2, ~0);
+  803e38:	83 ec 04             	sub    $0x4,%esp
+  803e3b:	6a ff                	push   $0xffffffff
+  803e3d:	6a 02                	push   $0x2
+  803e3f:	53                   	push   %ebx
+  803e40:	e8 71 d5 ff ff       	call   8013b6 <sys_futex_wait>
+  803e45:	89 f0                	mov    %esi,%eax
+  803e47:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (c != 0) {
+  803e4a:	83 c4 10             	add    $0x10,%esp
+  803e4d:	85 c0                	test   %eax,%eax
+  803e4f:	75 e7                	jne    803e38 <mutex_lock+0x30>
+		c = xchg(&m->m_state, 2);
+	}
+}
+  803e51:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e54:	5b                   	pop    %ebx
+  803e55:	5e                   	pop    %esi
+  803e56:	5d                   	pop    %ebp
+  803e57:	c3                   	ret
+
+00803e58 <mutex_trylock>:
+
+// Take 'm' if it is free.  Returns 1 if it was, 0 if not.
+bool
+mutex_trylock(struct mutex *m)
+{
+  803e58:	55                   	push   %ebp
+  803e59:	89 e5                	mov    %esp,%ebp
+  803e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; cmpxchgl %2, %1" :
+  803e5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803e68:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+	return cmpxchg(&m->m_state, 0, 1) == 0;
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	0f 94 c0             	sete   %al
+  803e71:	0f b6 c0             	movzbl %al,%eax
+}
+  803e74:	5d                   	pop    %ebp
+  803e75:	c3                   	ret
+
+00803e76 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+  803e76:	55                   	push   %ebp
+  803e77:	89 e5                	mov    %esp,%ebp
+  803e79:	83 ec 08             	sub    $0x8,%esp
+  803e7c:	8b 55 08             	mov    0x8(%ebp),%edx
+	asm volatile("lock; xchgl %0, %1" :
+  803e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e84:	f0 87 02             	lock xchg %eax,(%edx)
+	if (xchg(&m->m_state, 0) == 2)
+  803e87:	83 f8 02             	cmp    $0x2,%eax
+  803e8a:	74 02                	je     803e8e <mutex_unlock+0x18>
+		sys_futex_wake(&m->m_state, 1);
+}
+  803e8c:	c9                   	leave
+  803e8d:	c3                   	ret
+		sys_futex_wake(&m->m_state, 1);
+  803e8e:	83 ec 08             	sub    $0x8,%esp
+  803e91:	6a 01                	push   $0x1
+  803e93:	52                   	push   %edx
+  803e94:	e8 3f d5 ff ff       	call   8013d8 <sys_futex_wake>
+  803e99:	83 c4 10             	add    $0x10,%esp
+}
+  803e9c:	eb ee                	jmp    803e8c <mutex_unlock+0x16>
+
+00803e9e <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+  803e9e:	55                   	push   %ebp
+  803e9f:	89 e5                	mov    %esp,%ebp
+  803ea1:	8b 45 08             	mov    0x8(%ebp),%eax
+	c->c_seq = 0;
+  803ea4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+	c->c_nwait = 0;
+  803eaa:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+}
+  803eb1:	5d                   	pop    %ebp
+  803eb2:	c3                   	ret
+
+00803eb3 <cond_timedwait>:
+// time 'msec' (never, if ~0), and take 'm' again.  Like any condition
+// variable, it can also return for no reason.
+// Returns 0, or -E_TIMEOUT if time 'msec' passed.
+int
+cond_timedwait(struct cond *c, struct mutex *m, uint32_t msec)
+{
+  803eb3:	55                   	push   %ebp
+  803eb4:	89 e5                	mov    %esp,%ebp
+  803eb6:	57                   	push   %edi
+  803eb7:	56                   	push   %esi
+  803eb8:	53                   	push   %ebx
+  803eb9:	83 ec 18             	sub    $0x18,%esp
+  803ebc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803ebf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	uint32_t seq = c->c_seq;
+  803ec2:	8b 33                	mov    (%ebx),%esi
+
+// Atomically add 'n' to *addr and return the value it had before.
+static inline uint32_t
+xadd(volatile uint32_t *addr, uint32_t n)
+{
+	asm volatile("lock; xaddl %0, %1" :
+  803ec4:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ec9:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	int r;
+
+	// A signal after this sees c_nwait, or changes c_seq from 'seq'
+	// before the kernel looks at it.
+	xadd(&c->c_nwait, 1);
+	mutex_unlock(m);
+  803ece:	57                   	push   %edi
+  803ecf:	e8 a2 ff ff ff       	call   803e76 <mutex_unlock>
+	r = sys_futex_wait(&c->c_seq, seq, msec);
+  803ed4:	83 c4 0c             	add    $0xc,%esp
+  803ed7:	ff 75 10             	push   0x10(%ebp)
+  803eda:	56                   	push   %esi
+  803edb:	53                   	push   %ebx
+  803edc:	e8 d5 d4 ff ff       	call   8013b6 <sys_futex_wait>
+  803ee1:	89 c6                	mov    %eax,%esi
+  803ee3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  803ee8:	f0 0f c1 43 04       	lock xadd %eax,0x4(%ebx)
+	xadd(&c->c_nwait, -1);
+	mutex_lock(m);
+  803eed:	89 3c 24             	mov    %edi,(%esp)
+  803ef0:	e8 13 ff ff ff       	call   803e08 <mutex_lock>
+	return r == -E_TIMEOUT ? r : 0;
+  803ef5:	83 c4 10             	add    $0x10,%esp
+  803ef8:	83 fe ef             	cmp    $0xffffffef,%esi
+  803efb:	74 05                	je     803f02 <cond_timedwait+0x4f>
+  803efd:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803f02:	89 f0                	mov    %esi,%eax
+  803f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f07:	5b                   	pop    %ebx
+  803f08:	5e                   	pop    %esi
+  803f09:	5f                   	pop    %edi
+  803f0a:	5d                   	pop    %ebp
+  803f0b:	c3                   	ret
+
+00803f0c <cond_wait>:
+
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  803f0c:	55                   	push   %ebp
+  803f0d:	89 e5                	mov    %esp,%ebp
+  803f0f:	83 ec 0c             	sub    $0xc,%esp
+	cond_timedwait(c, m, ~0);
+  803f12:	6a ff                	push   $0xffffffff
+  803f14:	ff 75 0c             	push   0xc(%ebp)
+  803f17:	ff 75 08             	push   0x8(%ebp)
+  803f1a:	e8 94 ff ff ff       	call   803eb3 <cond_timedwait>
+}
+  803f1f:	83 c4 10             	add    $0x10,%esp
+  803f22:	c9                   	leave
+  803f23:	c3                   	ret
+
+00803f24 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+  803f24:	55                   	push   %ebp
+  803f25:	89 e5                	mov    %esp,%ebp
+  803f27:	83 ec 08             	sub    $0x8,%esp
+  803f2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f2d:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f32:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f36:	8b 50 04             	mov    0x4(%eax),%edx
+  803f39:	85 d2                	test   %edx,%edx
+  803f3b:	75 02                	jne    803f3f <cond_signal+0x1b>
+		sys_futex_wake(&c->c_seq, 1);
+}
+  803f3d:	c9                   	leave
+  803f3e:	c3                   	ret
+		sys_futex_wake(&c->c_seq, 1);
+  803f3f:	83 ec 08             	sub    $0x8,%esp
+  803f42:	6a 01                	push   $0x1
+  803f44:	50                   	push   %eax
+  803f45:	e8 8e d4 ff ff       	call   8013d8 <sys_futex_wake>
+  803f4a:	83 c4 10             	add    $0x10,%esp
+}
+  803f4d:	eb ee                	jmp    803f3d <cond_signal+0x19>
+
+00803f4f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+  803f4f:	55                   	push   %ebp
+  803f50:	89 e5                	mov    %esp,%ebp
+  803f52:	83 ec 08             	sub    $0x8,%esp
+  803f55:	8b 45 08             	mov    0x8(%ebp),%eax
+  803f58:	ba 01 00 00 00       	mov    $0x1,%edx
+  803f5d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+	xadd(&c->c_seq, 1);
+	if (c->c_nwait)
+  803f61:	8b 50 04             	mov    0x4(%eax),%edx
+  803f64:	85 d2                	test   %edx,%edx
+  803f66:	75 02                	jne    803f6a <cond_broadcast+0x1b>
+		sys_futex_wake(&c->c_seq, NENV);
+}
+  803f68:	c9                   	leave
+  803f69:	c3                   	ret
+		sys_futex_wake(&c->c_seq, NENV);
+  803f6a:	83 ec 08             	sub    $0x8,%esp
+  803f6d:	68 00 04 00 00       	push   $0x400
+  803f72:	50                   	push   %eax
+  803f73:	e8 60 d4 ff ff       	call   8013d8 <sys_futex_wake>
+  803f78:	83 c4 10             	add    $0x10,%esp
+}
+  803f7b:	eb eb                	jmp    803f68 <cond_broadcast+0x19>
+
+00803f7d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f82:	c3                   	ret
+
+00803f83 <devcons_poll>:
+{
+  803f83:	55                   	push   %ebp
+  803f84:	89 e5                	mov    %esp,%ebp
+  803f86:	53                   	push   %ebx
+  803f87:	83 ec 04             	sub    $0x4,%esp
+  803f8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803f8d:	89 da                	mov    %ebx,%edx
+  803f8f:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  803f92:	83 3d f4 69 80 00 00 	cmpl   $0x0,0x8069f4
+  803f99:	74 0c                	je     803fa7 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803f9b:	89 d8                	mov    %ebx,%eax
+  803f9d:	83 e0 01             	and    $0x1,%eax
+  803fa0:	09 d0                	or     %edx,%eax
+}
+  803fa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fa5:	c9                   	leave
+  803fa6:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803fa7:	e8 6e cf ff ff       	call   800f1a <sys_cgetc>
+  803fac:	a3 f4 69 80 00       	mov    %eax,0x8069f4
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803fb1:	89 da                	mov    %ebx,%edx
+  803fb3:	83 e2 04             	and    $0x4,%edx
+  803fb6:	85 c0                	test   %eax,%eax
+  803fb8:	74 e6                	je     803fa0 <devcons_poll+0x1d>
+  803fba:	eb df                	jmp    803f9b <devcons_poll+0x18>
+
+00803fbc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803fbc:	55                   	push   %ebp
+  803fbd:	89 e5                	mov    %esp,%ebp
+  803fbf:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803fc2:	68 78 4d 80 00       	push   $0x804d78
+  803fc7:	ff 75 0c             	push   0xc(%ebp)
+  803fca:	e8 b5 cb ff ff       	call   800b84 <strcpy>
+	return 0;
+}
+  803fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fd4:	c9                   	leave
+  803fd5:	c3                   	ret
+
+00803fd6 <devcons_write>:
+{
+  803fd6:	55                   	push   %ebp
+  803fd7:	89 e5                	mov    %esp,%ebp
+  803fd9:	57                   	push   %edi
+  803fda:	56                   	push   %esi
+  803fdb:	53                   	push   %ebx
+  803fdc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803fe2:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  803fe5:	85 ff                	test   %edi,%edi
+  803fe7:	74 51                	je     80403a <devcons_write+0x64>
+  803fe9:	be 00 00 00 00       	mov    $0x0,%esi
+  803fee:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  803ff3:	89 fb                	mov    %edi,%ebx
+  803ff5:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803ff7:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803ffc:	39 d3                	cmp    %edx,%ebx
+  803ffe:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804001:	83 ec 04             	sub    $0x4,%esp
+  804004:	53                   	push   %ebx
+  804005:	03 45 0c             	add    0xc(%ebp),%eax
+  804008:	50                   	push   %eax
+  804009:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80400f:	50                   	push   %eax
+  804010:	e8 1f cd ff ff       	call   800d34 <memmove>
+		sys_cputs(buf, m);
+  804015:	83 c4 08             	add    $0x8,%esp
+  804018:	53                   	push   %ebx
+  804019:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80401f:	50                   	push   %eax
+  804020:	e8 d7 ce ff ff       	call   800efc <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804025:	01 de                	add    %ebx,%esi
+  804027:	89 f0                	mov    %esi,%eax
+  804029:	83 c4 10             	add    $0x10,%esp
+  80402c:	39 fe                	cmp    %edi,%esi
+  80402e:	72 c3                	jb     803ff3 <devcons_write+0x1d>
+}
+  804030:	89 f0                	mov    %esi,%eax
+  804032:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804035:	5b                   	pop    %ebx
+  804036:	5e                   	pop    %esi
+  804037:	5f                   	pop    %edi
+  804038:	5d                   	pop    %ebp
+  804039:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  80403a:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  80403f:	eb ef                	jmp    804030 <devcons_write+0x5a>
+
+00804041 <devcons_read>:
+{
+  804041:	55                   	push   %ebp
+  804042:	89 e5                	mov    %esp,%ebp
+  804044:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  804047:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  80404c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804050:	74 36                	je     804088 <devcons_read+0x47>
+	c = cons_peek;
+  804052:	a1 f4 69 80 00       	mov    0x8069f4,%eax
+	cons_peek = 0;
+  804057:	c7 05 f4 69 80 00 00 	movl   $0x0,0x8069f4
+  80405e:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804061:	85 c0                	test   %eax,%eax
+  804063:	75 10                	jne    804075 <devcons_read+0x34>
+  804065:	e8 b0 ce ff ff       	call   800f1a <sys_cgetc>
+  80406a:	85 c0                	test   %eax,%eax
+  80406c:	75 07                	jne    804075 <devcons_read+0x34>
+		sys_yield();
+  80406e:	e8 26 cf ff ff       	call   800f99 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  804073:	eb f0                	jmp    804065 <devcons_read+0x24>
+	if (c < 0)
+  804075:	85 c0                	test   %eax,%eax
+  804077:	78 0f                	js     804088 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  804079:	83 f8 04             	cmp    $0x4,%eax
+  80407c:	74 0c                	je     80408a <devcons_read+0x49>
+	*(char*)vbuf = c;
+  80407e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804081:	88 02                	mov    %al,(%edx)
+	return 1;
+  804083:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804088:	c9                   	leave
+  804089:	c3                   	ret
+		return 0;
+  80408a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408f:	eb f7                	jmp    804088 <devcons_read+0x47>
+
+00804091 <cputchar>:
+{
+  804091:	55                   	push   %ebp
+  804092:	89 e5                	mov    %esp,%ebp
+  804094:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804097:	8b 45 08             	mov    0x8(%ebp),%eax
+  80409a:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80409d:	6a 01                	push   $0x1
+  80409f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040a2:	50                   	push   %eax
+  8040a3:	e8 54 ce ff ff       	call   800efc <sys_cputs>
+}
+  8040a8:	83 c4 10             	add    $0x10,%esp
+  8040ab:	c9                   	leave
+  8040ac:	c3                   	ret
+
+008040ad <getchar>:
+{
+  8040ad:	55                   	push   %ebp
+  8040ae:	89 e5                	mov    %esp,%ebp
+  8040b0:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8040b3:	6a 01                	push   $0x1
+  8040b5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8040b8:	50                   	push   %eax
+  8040b9:	6a 00                	push   $0x0
+  8040bb:	e8 d2 dd ff ff       	call   801e92 <read>
+	if (r < 0)
+  8040c0:	83 c4 10             	add    $0x10,%esp
+  8040c3:	85 c0                	test   %eax,%eax
+  8040c5:	78 06                	js     8040cd <getchar+0x20>
+	if (r < 1)
+  8040c7:	74 06                	je     8040cf <getchar+0x22>
+	return c;
+  8040c9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8040cd:	c9                   	leave
+  8040ce:	c3                   	ret
+		return -E_EOF;
+  8040cf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8040d4:	eb f7                	jmp    8040cd <getchar+0x20>
+
+008040d6 <iscons>:
+{
+  8040d6:	55                   	push   %ebp
+  8040d7:	89 e5                	mov    %esp,%ebp
+  8040d9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8040dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8040df:	50                   	push   %eax
+  8040e0:	ff 75 08             	push   0x8(%ebp)
+  8040e3:	e8 26 db ff ff       	call   801c0e <fd_lookup>
+  8040e8:	83 c4 10             	add    $0x10,%esp
+  8040eb:	85 c0                	test   %eax,%eax
+  8040ed:	78 11                	js     804100 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8040ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8040f2:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8040f8:	39 10                	cmp    %edx,(%eax)
+  8040fa:	0f 94 c0             	sete   %al
+  8040fd:	0f b6 c0             	movzbl %al,%eax
+}
+  804100:	c9                   	leave
+  804101:	c3                   	ret
+
+00804102 <opencons>:
+{
+  804102:	55                   	push   %ebp
+  804103:	89 e5                	mov    %esp,%ebp
+  804105:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804108:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80410b:	50                   	push   %eax
+  80410c:	e8 ad da ff ff       	call   801bbe <fd_alloc>
+  804111:	83 c4 10             	add    $0x10,%esp
+  804114:	85 c0                	test   %eax,%eax
+  804116:	78 3a                	js     804152 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804118:	83 ec 04             	sub    $0x4,%esp
+  80411b:	68 07 04 00 00       	push   $0x407
+  804120:	ff 75 f4             	push   -0xc(%ebp)
+  804123:	6a 00                	push   $0x0
+  804125:	e8 8e ce ff ff       	call   800fb8 <sys_page_alloc>
+  80412a:	83 c4 10             	add    $0x10,%esp
+  80412d:	85 c0                	test   %eax,%eax
+  80412f:	78 21                	js     804152 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804131:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804134:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  80413a:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80413c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80413f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804146:	83 ec 0c             	sub    $0xc,%esp
+  804149:	50                   	push   %eax
+  80414a:	e8 48 da ff ff       	call   801b97 <fd2num>
+  80414f:	83 c4 10             	add    $0x10,%esp
+}
+  804152:	c9                   	leave
+  804153:	c3                   	ret
+
+00804154 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804154:	55                   	push   %ebp
+  804155:	89 e5                	mov    %esp,%ebp
+  804157:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if (_pgfault_handler == 0) {
+  80415a:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  804161:	74 0a                	je     80416d <set_pgfault_handler+0x19>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	//	panic("set_pgfault_handler not implemented");
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804163:	8b 45 08             	mov    0x8(%ebp),%eax
+  804166:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  80416b:	c9                   	leave
+  80416c:	c3                   	ret
+		sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_U|PTE_P|PTE_W);
+  80416d:	83 ec 04             	sub    $0x4,%esp
+  804170:	6a 07                	push   $0x7
+  804172:	68 00 f0 bf ee       	push   $0xeebff000
+  804177:	6a 00                	push   $0x0
+  804179:	e8 3a ce ff ff       	call   800fb8 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80417e:	83 c4 08             	add    $0x8,%esp
+  804181:	68 92 41 80 00       	push   $0x804192
+  804186:	6a 00                	push   $0x0
+  804188:	e8 76 cf ff ff       	call   801103 <sys_env_set_pgfault_upcall>
+  80418d:	83 c4 10             	add    $0x10,%esp
+  804190:	eb d1                	jmp    804163 <set_pgfault_handler+0xf>
+
+00804192 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804192:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804193:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  804198:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80419a:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 48(%esp), %eax 
+  80419d:	8b 44 24 30          	mov    0x30(%esp),%eax
+	subl $4, %eax
+  8041a1:	83 e8 04             	sub    $0x4,%eax
+	movl 40(%esp), %ebx;
+  8041a4:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+	movl %ebx, (%eax);
+  8041a8:	89 18                	mov    %ebx,(%eax)
+	movl %eax, 48(%esp)
+  8041aa:	89 44 24 30          	mov    %eax,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp
+  8041ae:	83 c4 08             	add    $0x8,%esp
+	popal;
+  8041b1:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp
+  8041b2:	83 c4 04             	add    $0x4,%esp
+	popf
+  8041b5:	9d                   	popf
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp;
+  8041b6:	5c                   	pop    %esp
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret;
+  8041b7:	c3                   	ret
+
+008041b8 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8041b8:	55                   	push   %ebp
+  8041b9:	89 e5                	mov    %esp,%ebp
+  8041bb:	56                   	push   %esi
+  8041bc:	53                   	push   %ebx
+  8041bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8041c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8041c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8041c6:	85 c0                	test   %eax,%eax
+  8041c8:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8041cd:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8041d0:	83 ec 0c             	sub    $0xc,%esp
+  8041d3:	50                   	push   %eax
+  8041d4:	e8 8f cf ff ff       	call   801168 <sys_ipc_recv>
+  8041d9:	83 c4 10             	add    $0x10,%esp
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	0f 88 8b 00 00 00    	js     80426f <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8041e4:	85 f6                	test   %esi,%esi
+  8041e6:	74 2a                	je     804212 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8041e8:	89 e2                	mov    %esp,%edx
+  8041ea:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8041ef:	29 d0                	sub    %edx,%eax
+  8041f1:	89 c2                	mov    %eax,%edx
+  8041f3:	c1 ea 0f             	shr    $0xf,%edx
+  8041f6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8041fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804200:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  804203:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80420a:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804210:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  804212:	85 db                	test   %ebx,%ebx
+  804214:	74 2a                	je     804240 <ipc_recv+0x88>
+  804216:	89 e2                	mov    %esp,%edx
+  804218:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80421d:	29 d0                	sub    %edx,%eax
+  80421f:	89 c2                	mov    %eax,%edx
+  804221:	c1 ea 0f             	shr    $0xf,%edx
+  804224:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422e:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804231:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804238:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80423e:	89 03                	mov    %eax,(%ebx)
+  804240:	89 e2                	mov    %esp,%edx
+  804242:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804247:	29 d0                	sub    %edx,%eax
+  804249:	89 c2                	mov    %eax,%edx
+  80424b:	c1 ea 0f             	shr    $0xf,%edx
+  80424e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804253:	b8 00 00 00 00       	mov    $0x0,%eax
+  804258:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80425b:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804262:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  804268:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80426b:	5b                   	pop    %ebx
+  80426c:	5e                   	pop    %esi
+  80426d:	5d                   	pop    %ebp
+  80426e:	c3                   	ret
+		if(from_env_store != NULL)
+  80426f:	85 f6                	test   %esi,%esi
+  804271:	74 06                	je     804279 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  804273:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  804279:	85 db                	test   %ebx,%ebx
+  80427b:	74 eb                	je     804268 <ipc_recv+0xb0>
+			*perm_store = 0;
+  80427d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804283:	eb e3                	jmp    804268 <ipc_recv+0xb0>
+
+00804285 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  804285:	55                   	push   %ebp
+  804286:	89 e5                	mov    %esp,%ebp
+  804288:	57                   	push   %edi
+  804289:	56                   	push   %esi
+  80428a:	53                   	push   %ebx
+  80428b:	83 ec 14             	sub    $0x14,%esp
+  80428e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804291:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804294:	8b 75 14             	mov    0x14(%ebp),%esi
+  804297:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  80429a:	85 c0                	test   %eax,%eax
+  80429c:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8042a1:	0f 44 c2             	cmove  %edx,%eax
+  8042a4:	ff 75 10             	push   0x10(%ebp)
+  8042a7:	50                   	push   %eax
+  8042a8:	e8 1d cf ff ff       	call   8011ca <sys_ipc_recv_pages>
+  8042ad:	83 c4 10             	add    $0x10,%esp
+  8042b0:	85 c0                	test   %eax,%eax
+  8042b2:	0f 88 ba 00 00 00    	js     804372 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8042b8:	85 ff                	test   %edi,%edi
+  8042ba:	74 2a                	je     8042e6 <ipc_recv_pages+0x61>
+  8042bc:	89 e2                	mov    %esp,%edx
+  8042be:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042c3:	29 d0                	sub    %edx,%eax
+  8042c5:	89 c2                	mov    %eax,%edx
+  8042c7:	c1 ea 0f             	shr    $0xf,%edx
+  8042ca:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d4:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8042d7:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8042de:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8042e4:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8042e6:	85 f6                	test   %esi,%esi
+  8042e8:	74 2a                	je     804314 <ipc_recv_pages+0x8f>
+  8042ea:	89 e2                	mov    %esp,%edx
+  8042ec:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8042f1:	29 d0                	sub    %edx,%eax
+  8042f3:	89 c2                	mov    %eax,%edx
+  8042f5:	c1 ea 0f             	shr    $0xf,%edx
+  8042f8:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8042fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804302:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  804305:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80430c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804312:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  804314:	85 db                	test   %ebx,%ebx
+  804316:	74 2a                	je     804342 <ipc_recv_pages+0xbd>
+  804318:	89 e2                	mov    %esp,%edx
+  80431a:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80431f:	29 d0                	sub    %edx,%eax
+  804321:	89 c2                	mov    %eax,%edx
+  804323:	c1 ea 0f             	shr    $0xf,%edx
+  804326:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80432b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804330:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  804333:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  80433a:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  804340:	89 03                	mov    %eax,(%ebx)
+  804342:	89 e2                	mov    %esp,%edx
+  804344:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  804349:	29 d0                	sub    %edx,%eax
+  80434b:	89 c2                	mov    %eax,%edx
+  80434d:	c1 ea 0f             	shr    $0xf,%edx
+  804350:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  804355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80435a:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  80435d:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  804364:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80436a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80436d:	5b                   	pop    %ebx
+  80436e:	5e                   	pop    %esi
+  80436f:	5f                   	pop    %edi
+  804370:	5d                   	pop    %ebp
+  804371:	c3                   	ret
+		if (from_env_store)
+  804372:	85 ff                	test   %edi,%edi
+  804374:	74 06                	je     80437c <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  804376:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  80437c:	85 f6                	test   %esi,%esi
+  80437e:	74 06                	je     804386 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  804380:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  804386:	85 db                	test   %ebx,%ebx
+  804388:	74 e0                	je     80436a <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80438a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804390:	eb d8                	jmp    80436a <ipc_recv_pages+0xe5>
+
+00804392 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  804392:	55                   	push   %ebp
+  804393:	89 e5                	mov    %esp,%ebp
+  804395:	57                   	push   %edi
+  804396:	56                   	push   %esi
+  804397:	53                   	push   %ebx
+  804398:	83 ec 1c             	sub    $0x1c,%esp
+  80439b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  80439e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8043a1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8043a7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8043ab:	75 2b                	jne    8043d8 <ipc_try_send_pages+0x46>
+  8043ad:	89 e2                	mov    %esp,%edx
+  8043af:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8043b4:	29 d0                	sub    %edx,%eax
+  8043b6:	89 c2                	mov    %eax,%edx
+  8043b8:	c1 ea 0f             	shr    $0xf,%edx
+  8043bb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8043c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c5:	0f 42 c2             	cmovb  %edx,%eax
+  8043c8:	8b 04 85 00 6a 80 00 	mov    0x806a00(,%eax,4),%eax
+  8043cf:	8b 70 48             	mov    0x48(%eax),%esi
+  8043d2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8043d8:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8043de:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8043e3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8043e6:	85 ff                	test   %edi,%edi
+  8043e8:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  8043ed:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  8043f0:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  8043f6:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8043fc:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  804402:	83 ec 0c             	sub    $0xc,%esp
+  804405:	ff 75 14             	push   0x14(%ebp)
+  804408:	ff 75 18             	push   0x18(%ebp)
+  80440b:	57                   	push   %edi
+  80440c:	ff 75 0c             	push   0xc(%ebp)
+  80440f:	ff 75 08             	push   0x8(%ebp)
+  804412:	e8 92 cd ff ff       	call   8011a9 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  804417:	83 c4 20             	add    $0x20,%esp
+  80441a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80441d:	75 21                	jne    804440 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80441f:	83 ec 04             	sub    $0x4,%esp
+  804422:	6a ff                	push   $0xffffffff
+  804424:	53                   	push   %ebx
+  804425:	ff 75 e4             	push   -0x1c(%ebp)
+  804428:	e8 89 cf ff ff       	call   8013b6 <sys_futex_wait>
+  80442d:	83 c4 10             	add    $0x10,%esp
+  804430:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  804433:	74 c7                	je     8043fc <ipc_try_send_pages+0x6a>
+  804435:	85 c0                	test   %eax,%eax
+  804437:	79 c3                	jns    8043fc <ipc_try_send_pages+0x6a>
+			sys_yield();
+  804439:	e8 5b cb ff ff       	call   800f99 <sys_yield>
+  80443e:	eb bc                	jmp    8043fc <ipc_try_send_pages+0x6a>
+	}
+}
+  804440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804443:	5b                   	pop    %ebx
+  804444:	5e                   	pop    %esi
+  804445:	5f                   	pop    %edi
+  804446:	5d                   	pop    %ebp
+  804447:	c3                   	ret
+
+00804448 <ipc_send>:
+{
+  804448:	55                   	push   %ebp
+  804449:	89 e5                	mov    %esp,%ebp
+  80444b:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  80444e:	ff 75 14             	push   0x14(%ebp)
+  804451:	6a 01                	push   $0x1
+  804453:	ff 75 10             	push   0x10(%ebp)
+  804456:	ff 75 0c             	push   0xc(%ebp)
+  804459:	ff 75 08             	push   0x8(%ebp)
+  80445c:	e8 31 ff ff ff       	call   804392 <ipc_try_send_pages>
+  804461:	83 c4 20             	add    $0x20,%esp
+  804464:	85 c0                	test   %eax,%eax
+  804466:	78 02                	js     80446a <ipc_send+0x22>
+}
+  804468:	c9                   	leave
+  804469:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80446a:	50                   	push   %eax
+  80446b:	68 84 4d 80 00       	push   $0x804d84
+  804470:	6a 3f                	push   $0x3f
+  804472:	68 99 4d 80 00       	push   $0x804d99
+  804477:	e8 36 bf ff ff       	call   8003b2 <_panic>
+
+0080447c <ipc_send_pages>:
+{
+  80447c:	55                   	push   %ebp
+  80447d:	89 e5                	mov    %esp,%ebp
+  80447f:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  804482:	ff 75 18             	push   0x18(%ebp)
+  804485:	ff 75 14             	push   0x14(%ebp)
+  804488:	ff 75 10             	push   0x10(%ebp)
+  80448b:	ff 75 0c             	push   0xc(%ebp)
+  80448e:	ff 75 08             	push   0x8(%ebp)
+  804491:	e8 fc fe ff ff       	call   804392 <ipc_try_send_pages>
+  804496:	83 c4 20             	add    $0x20,%esp
+  804499:	85 c0                	test   %eax,%eax
+  80449b:	78 02                	js     80449f <ipc_send_pages+0x23>
+}
+  80449d:	c9                   	leave
+  80449e:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  80449f:	50                   	push   %eax
+  8044a0:	68 a3 4d 80 00       	push   $0x804da3
+  8044a5:	6a 64                	push   $0x64
+  8044a7:	68 99 4d 80 00       	push   $0x804d99
+  8044ac:	e8 01 bf ff ff       	call   8003b2 <_panic>
+
+008044b1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8044b1:	55                   	push   %ebp
+  8044b2:	89 e5                	mov    %esp,%ebp
+  8044b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8044b7:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8044bc:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8044c2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8044c8:	8b 52 50             	mov    0x50(%edx),%edx
+  8044cb:	39 ca                	cmp    %ecx,%edx
+  8044cd:	74 11                	je     8044e0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8044cf:	83 c0 01             	add    $0x1,%eax
+  8044d2:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8044d7:	75 e3                	jne    8044bc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8044d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044de:	eb 0e                	jmp    8044ee <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8044e0:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8044e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8044eb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8044ee:	5d                   	pop    %ebp
+  8044ef:	c3                   	ret
+
+008044f0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8044f0:	55                   	push   %ebp
+  8044f1:	89 e5                	mov    %esp,%ebp
+  8044f3:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  8044f6:	89 c2                	mov    %eax,%edx
+  8044f8:	c1 ea 16             	shr    $0x16,%edx
+  8044fb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804502:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  804507:	f6 c1 01             	test   $0x1,%cl
+  80450a:	74 1e                	je     80452a <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  80450c:	c1 e8 0c             	shr    $0xc,%eax
+  80450f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804516:	a8 01                	test   $0x1,%al
+  804518:	74 10                	je     80452a <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80451a:	c1 e8 0c             	shr    $0xc,%eax
+  80451d:	c1 e0 04             	shl    $0x4,%eax
+  804520:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  804527:	0f b7 d2             	movzwl %dx,%edx
+}
+  80452a:	89 d0                	mov    %edx,%eax
+  80452c:	5d                   	pop    %ebp
+  80452d:	c3                   	ret
+
+0080452e <__udivdi3>:
+  80452e:	57                   	push   %edi
+  80452f:	56                   	push   %esi
+  804530:	53                   	push   %ebx
+  804531:	83 ec 20             	sub    $0x20,%esp
+  804534:	8b 44 24 30          	mov    0x30(%esp),%eax
+  804538:	8b 54 24 34          	mov    0x34(%esp),%edx
+  80453c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804540:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804544:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804548:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80454c:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804550:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804554:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804559:	b8 00 00 00 00       	mov    $0x0,%eax
+  80455e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804563:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80456a:	00 
+  80456b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804572:	00 
+  804573:	eb 08                	jmp    80457d <__udivdi3+0x4f>
+  804575:	83 e9 01             	sub    $0x1,%ecx
+  804578:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80457b:	74 68                	je     8045e5 <__udivdi3+0xb7>
+  80457d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804581:	01 c0                	add    %eax,%eax
+  804583:	89 c6                	mov    %eax,%esi
+  804585:	89 d7                	mov    %edx,%edi
+  804587:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80458b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80458f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804592:	d3 ea                	shr    %cl,%edx
+  804594:	f6 c1 20             	test   $0x20,%cl
+  804597:	74 04                	je     80459d <__udivdi3+0x6f>
+  804599:	89 d0                	mov    %edx,%eax
+  80459b:	31 d2                	xor    %edx,%edx
+  80459d:	83 e0 01             	and    $0x1,%eax
+  8045a0:	89 04 24             	mov    %eax,(%esp)
+  8045a3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8045aa:	00 
+  8045ab:	8b 04 24             	mov    (%esp),%eax
+  8045ae:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8045b2:	09 f0                	or     %esi,%eax
+  8045b4:	09 fa                	or     %edi,%edx
+  8045b6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8045ba:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8045be:	39 f0                	cmp    %esi,%eax
+  8045c0:	89 d3                	mov    %edx,%ebx
+  8045c2:	19 fb                	sbb    %edi,%ebx
+  8045c4:	72 af                	jb     804575 <__udivdi3+0x47>
+  8045c6:	29 f0                	sub    %esi,%eax
+  8045c8:	19 fa                	sbb    %edi,%edx
+  8045ca:	89 cf                	mov    %ecx,%edi
+  8045cc:	c1 ef 05             	shr    $0x5,%edi
+  8045cf:	83 e7 01             	and    $0x1,%edi
+  8045d2:	89 fe                	mov    %edi,%esi
+  8045d4:	83 f6 01             	xor    $0x1,%esi
+  8045d7:	d3 e6                	shl    %cl,%esi
+  8045d9:	d3 e7                	shl    %cl,%edi
+  8045db:	09 74 24 18          	or     %esi,0x18(%esp)
+  8045df:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8045e3:	eb 90                	jmp    804575 <__udivdi3+0x47>
+  8045e5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045e9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8045ed:	83 c4 20             	add    $0x20,%esp
+  8045f0:	5b                   	pop    %ebx
+  8045f1:	5e                   	pop    %esi
+  8045f2:	5f                   	pop    %edi
+  8045f3:	c3                   	ret
+
+008045f4 <__umoddi3>:
+  8045f4:	57                   	push   %edi
+  8045f5:	56                   	push   %esi
+  8045f6:	53                   	push   %ebx
+  8045f7:	83 ec 08             	sub    $0x8,%esp
+  8045fa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8045fe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804602:	8b 74 24 20          	mov    0x20(%esp),%esi
+  804606:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  80460a:	57                   	push   %edi
+  80460b:	56                   	push   %esi
+  80460c:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804610:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804614:	52                   	push   %edx
+  804615:	50                   	push   %eax
+  804616:	e8 13 ff ff ff       	call   80452e <__udivdi3>
+  80461b:	89 c3                	mov    %eax,%ebx
+  80461d:	0f af d6             	imul   %esi,%edx
+  804620:	89 f9                	mov    %edi,%ecx
+  804622:	0f af cb             	imul   %ebx,%ecx
+  804625:	01 d1                	add    %edx,%ecx
+  804627:	89 d8                	mov    %ebx,%eax
+  804629:	f7 e6                	mul    %esi
+  80462b:	89 c6                	mov    %eax,%esi
+  80462d:	89 d7                	mov    %edx,%edi
+  80462f:	01 cf                	add    %ecx,%edi
+  804631:	8b 44 24 10          	mov    0x10(%esp),%eax
+  804635:	8b 54 24 14          	mov    0x14(%esp),%edx
+  804639:	29 f0                	sub    %esi,%eax
+  80463b:	19 fa                	sbb    %edi,%edx
+  80463d:	83 c4 18             	add    $0x18,%esp
+  804640:	5b                   	pop    %ebx
+  804641:	5e                   	pop    %esi
+  804642:	5f                   	pop    %edi
+  804643:	c3                   	ret
+
+00804644 <__divdi3>:
+  804644:	53                   	push   %ebx
+  804645:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804649:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80464d:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804651:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804655:	85 d2                	test   %edx,%edx
+  804657:	78 12                	js     80466b <__divdi3+0x27>
+  804659:	85 db                	test   %ebx,%ebx
+  80465b:	78 2e                	js     80468b <__divdi3+0x47>
+  80465d:	53                   	push   %ebx
+  80465e:	51                   	push   %ecx
+  80465f:	52                   	push   %edx
+  804660:	50                   	push   %eax
+  804661:	e8 c8 fe ff ff       	call   80452e <__udivdi3>
+  804666:	83 c4 10             	add    $0x10,%esp
+  804669:	eb 1e                	jmp    804689 <__divdi3+0x45>
+  80466b:	f7 d8                	neg    %eax
+  80466d:	83 d2 00             	adc    $0x0,%edx
+  804670:	f7 da                	neg    %edx
+  804672:	85 db                	test   %ebx,%ebx
+  804674:	78 2a                	js     8046a0 <__divdi3+0x5c>
+  804676:	53                   	push   %ebx
+  804677:	51                   	push   %ecx
+  804678:	52                   	push   %edx
+  804679:	50                   	push   %eax
+  80467a:	e8 af fe ff ff       	call   80452e <__udivdi3>
+  80467f:	83 c4 10             	add    $0x10,%esp
+  804682:	f7 d8                	neg    %eax
+  804684:	83 d2 00             	adc    $0x0,%edx
+  804687:	f7 da                	neg    %edx
+  804689:	5b                   	pop    %ebx
+  80468a:	c3                   	ret
+  80468b:	f7 d9                	neg    %ecx
+  80468d:	83 d3 00             	adc    $0x0,%ebx
+  804690:	f7 db                	neg    %ebx
+  804692:	53                   	push   %ebx
+  804693:	51                   	push   %ecx
+  804694:	52                   	push   %edx
+  804695:	50                   	push   %eax
+  804696:	e8 93 fe ff ff       	call   80452e <__udivdi3>
+  80469b:	83 c4 10             	add    $0x10,%esp
+  80469e:	eb e2                	jmp    804682 <__divdi3+0x3e>
+  8046a0:	f7 d9                	neg    %ecx
+  8046a2:	83 d3 00             	adc    $0x0,%ebx
+  8046a5:	f7 db                	neg    %ebx
+  8046a7:	53                   	push   %ebx
+  8046a8:	51                   	push   %ecx
+  8046a9:	52                   	push   %edx
+  8046aa:	50                   	push   %eax
+  8046ab:	e8 7e fe ff ff       	call   80452e <__udivdi3>
+  8046b0:	83 c4 10             	add    $0x10,%esp
+  8046b3:	eb d4                	jmp    804689 <__divdi3+0x45>
+
+008046b5 <__moddi3>:
+  8046b5:	57                   	push   %edi
+  8046b6:	56                   	push   %esi
+  8046b7:	53                   	push   %ebx
+  8046b8:	83 ec 08             	sub    $0x8,%esp
+  8046bb:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8046bf:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8046c3:	8b 74 24 20          	mov    0x20(%esp),%esi
+  8046c7:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  8046cb:	57                   	push   %edi
+  8046cc:	56                   	push   %esi
+  8046cd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8046d1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8046d5:	52                   	push   %edx
+  8046d6:	50                   	push   %eax
+  8046d7:	e8 68 ff ff ff       	call   804644 <__divdi3>
+  8046dc:	89 c3                	mov    %eax,%ebx
+  8046de:	0f af d6             	imul   %esi,%edx
+  8046e1:	89 f9                	mov    %edi,%ecx
+  8046e3:	0f af cb             	imul   %ebx,%ecx
+  8046e6:	01 d1                	add    %edx,%ecx
+  8046e8:	89 d8                	mov    %ebx,%eax
+  8046ea:	f7 e6                	mul    %esi
+  8046ec:	89 c6                	mov    %eax,%esi
+  8046ee:	89 d7                	mov    %edx,%edi
+  8046f0:	01 cf                	add    %ecx,%edi
+  8046f2:	8b 44 24 10          	mov    0x10(%esp),%eax
+  8046f6:	8b 54 24 14          	mov    0x14(%esp),%edx
+  8046fa:	29 f0                	sub    %esi,%eax
+  8046fc:	19 fa                	sbb    %edi,%edx
+  8046fe:	83 c4 18             	add    $0x18,%esp
+  804701:	5b                   	pop    %ebx
+  804702:	5e                   	pop    %esi
+  804703:	5f                   	pop    %edi
+  804704:	c3                   	ret
@@ -0,0 +1,8026 @@
+
+obj/user/writemotd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b4 01 00 00       	call   8001e5 <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	81 ec 24 02 00 00    	sub    $0x224,%esp
+	int rfd, wfd;
+	char buf[512];
+	int n, r;
+
+	if ((rfd = open("/newmotd", O_RDONLY)) < 0)
+  800041:	6a 00                	push   $0x0
+  800043:	68 20 3c 80 00       	push   $0x803c20
+  800048:	e8 9c 1a 00 00       	call   801ae9 <open>
+  80004d:	89 85 e4 fd ff ff    	mov    %eax,-0x21c(%ebp)
+  800053:	83 c4 10             	add    $0x10,%esp
+  800056:	85 c0                	test   %eax,%eax
+  800058:	78 6f                	js     8000c9 <umain+0x94>
+		panic("open /newmotd: %e", rfd);
+	if ((wfd = open("/motd", O_RDWR)) < 0)
+  80005a:	83 ec 08             	sub    $0x8,%esp
+  80005d:	6a 02                	push   $0x2
+  80005f:	68 4c 3c 80 00       	push   $0x803c4c
+  800064:	e8 80 1a 00 00       	call   801ae9 <open>
+  800069:	89 c7                	mov    %eax,%edi
+  80006b:	83 c4 10             	add    $0x10,%esp
+  80006e:	85 c0                	test   %eax,%eax
+  800070:	78 69                	js     8000db <umain+0xa6>
+		panic("open /motd: %e", wfd);
+	cprintf("file descriptors %d %d\n", rfd, wfd);
+  800072:	83 ec 04             	sub    $0x4,%esp
+  800075:	50                   	push   %eax
+  800076:	8b b5 e4 fd ff ff    	mov    -0x21c(%ebp),%esi
+  80007c:	56                   	push   %esi
+  80007d:	68 61 3c 80 00       	push   $0x803c61
+  800082:	e8 e0 02 00 00       	call   800367 <cprintf>
+	if (rfd == wfd)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	39 fe                	cmp    %edi,%esi
+  80008c:	74 5f                	je     8000ed <umain+0xb8>
+		panic("open /newmotd and /motd give same file descriptor");
+
+	cprintf("OLD MOTD\n===\n");
+  80008e:	83 ec 0c             	sub    $0xc,%esp
+  800091:	68 79 3c 80 00       	push   $0x803c79
+  800096:	e8 cc 02 00 00       	call   800367 <cprintf>
+	while ((n = read(wfd, buf, sizeof buf-1)) > 0)
+  80009b:	83 c4 10             	add    $0x10,%esp
+  80009e:	8d 9d e8 fd ff ff    	lea    -0x218(%ebp),%ebx
+  8000a4:	83 ec 04             	sub    $0x4,%esp
+  8000a7:	68 ff 01 00 00       	push   $0x1ff
+  8000ac:	53                   	push   %ebx
+  8000ad:	57                   	push   %edi
+  8000ae:	e8 3d 15 00 00       	call   8015f0 <read>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	7e 47                	jle    800101 <umain+0xcc>
+		sys_cputs(buf, n);
+  8000ba:	83 ec 08             	sub    $0x8,%esp
+  8000bd:	50                   	push   %eax
+  8000be:	53                   	push   %ebx
+  8000bf:	e8 12 0d 00 00       	call   800dd6 <sys_cputs>
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  8000c7:	eb db                	jmp    8000a4 <umain+0x6f>
+		panic("open /newmotd: %e", rfd);
+  8000c9:	50                   	push   %eax
+  8000ca:	68 29 3c 80 00       	push   $0x803c29
+  8000cf:	6a 0b                	push   $0xb
+  8000d1:	68 3b 3c 80 00       	push   $0x803c3b
+  8000d6:	e8 b1 01 00 00       	call   80028c <_panic>
+		panic("open /motd: %e", wfd);
+  8000db:	50                   	push   %eax
+  8000dc:	68 52 3c 80 00       	push   $0x803c52
+  8000e1:	6a 0d                	push   $0xd
+  8000e3:	68 3b 3c 80 00       	push   $0x803c3b
+  8000e8:	e8 9f 01 00 00       	call   80028c <_panic>
+		panic("open /newmotd and /motd give same file descriptor");
+  8000ed:	83 ec 04             	sub    $0x4,%esp
+  8000f0:	68 cc 3c 80 00       	push   $0x803ccc
+  8000f5:	6a 10                	push   $0x10
+  8000f7:	68 3b 3c 80 00       	push   $0x803c3b
+  8000fc:	e8 8b 01 00 00       	call   80028c <_panic>
+	cprintf("===\n");
+  800101:	83 ec 0c             	sub    $0xc,%esp
+  800104:	68 82 3c 80 00       	push   $0x803c82
+  800109:	e8 59 02 00 00       	call   800367 <cprintf>
+	seek(wfd, 0);
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	6a 00                	push   $0x0
+  800113:	57                   	push   %edi
+  800114:	e8 6e 16 00 00       	call   801787 <seek>
+
+	if ((r = ftruncate(wfd, 0)) < 0)
+  800119:	83 c4 08             	add    $0x8,%esp
+  80011c:	6a 00                	push   $0x0
+  80011e:	57                   	push   %edi
+  80011f:	e8 e1 16 00 00       	call   801805 <ftruncate>
+  800124:	83 c4 10             	add    $0x10,%esp
+  800127:	85 c0                	test   %eax,%eax
+  800129:	78 61                	js     80018c <umain+0x157>
+		panic("truncate /motd: %e", r);
+
+	cprintf("NEW MOTD\n===\n");
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	68 9a 3c 80 00       	push   $0x803c9a
+  800133:	e8 2f 02 00 00       	call   800367 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0) {
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+  800141:	83 ec 04             	sub    $0x4,%esp
+  800144:	68 ff 01 00 00       	push   $0x1ff
+  800149:	56                   	push   %esi
+  80014a:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+  800150:	e8 9b 14 00 00       	call   8015f0 <read>
+  800155:	89 c3                	mov    %eax,%ebx
+  800157:	83 c4 10             	add    $0x10,%esp
+  80015a:	85 c0                	test   %eax,%eax
+  80015c:	7e 40                	jle    80019e <umain+0x169>
+		sys_cputs(buf, n);
+  80015e:	83 ec 08             	sub    $0x8,%esp
+  800161:	53                   	push   %ebx
+  800162:	56                   	push   %esi
+  800163:	e8 6e 0c 00 00       	call   800dd6 <sys_cputs>
+		if ((r = write(wfd, buf, n)) != n)
+  800168:	83 c4 0c             	add    $0xc,%esp
+  80016b:	53                   	push   %ebx
+  80016c:	56                   	push   %esi
+  80016d:	57                   	push   %edi
+  80016e:	e8 75 15 00 00       	call   8016e8 <write>
+  800173:	83 c4 10             	add    $0x10,%esp
+  800176:	39 c3                	cmp    %eax,%ebx
+  800178:	74 c7                	je     800141 <umain+0x10c>
+			panic("write /motd: %e", r);
+  80017a:	50                   	push   %eax
+  80017b:	68 a8 3c 80 00       	push   $0x803ca8
+  800180:	6a 1f                	push   $0x1f
+  800182:	68 3b 3c 80 00       	push   $0x803c3b
+  800187:	e8 00 01 00 00       	call   80028c <_panic>
+		panic("truncate /motd: %e", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 87 3c 80 00       	push   $0x803c87
+  800192:	6a 19                	push   $0x19
+  800194:	68 3b 3c 80 00       	push   $0x803c3b
+  800199:	e8 ee 00 00 00       	call   80028c <_panic>
+	}
+	cprintf("===\n");
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	68 82 3c 80 00       	push   $0x803c82
+  8001a6:	e8 bc 01 00 00       	call   800367 <cprintf>
+
+	if (n < 0)
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 db                	test   %ebx,%ebx
+  8001b0:	78 21                	js     8001d3 <umain+0x19e>
+		panic("read /newmotd: %e", n);
+
+	close(rfd);
+  8001b2:	83 ec 0c             	sub    $0xc,%esp
+  8001b5:	ff b5 e4 fd ff ff    	push   -0x21c(%ebp)
+  8001bb:	e8 f1 12 00 00       	call   8014b1 <close>
+	close(wfd);
+  8001c0:	89 3c 24             	mov    %edi,(%esp)
+  8001c3:	e8 e9 12 00 00       	call   8014b1 <close>
+}
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ce:	5b                   	pop    %ebx
+  8001cf:	5e                   	pop    %esi
+  8001d0:	5f                   	pop    %edi
+  8001d1:	5d                   	pop    %ebp
+  8001d2:	c3                   	ret
+		panic("read /newmotd: %e", n);
+  8001d3:	53                   	push   %ebx
+  8001d4:	68 b8 3c 80 00       	push   $0x803cb8
+  8001d9:	6a 24                	push   $0x24
+  8001db:	68 3b 3c 80 00       	push   $0x803c3b
+  8001e0:	e8 a7 00 00 00       	call   80028c <_panic>
+
+008001e5 <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001e5:	55                   	push   %ebp
+  8001e6:	89 e5                	mov    %esp,%ebp
+  8001e8:	56                   	push   %esi
+  8001e9:	53                   	push   %ebx
+  8001ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ed:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8001f0:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  8001f2:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8001f7:	29 d0                	sub    %edx,%eax
+  8001f9:	89 c2                	mov    %eax,%edx
+  8001fb:	c1 ea 0f             	shr    $0xf,%edx
+  8001fe:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  80020b:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  800212:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  800216:	e8 39 0c 00 00       	call   800e54 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  80021b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800220:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  800226:	89 e1                	mov    %esp,%ecx
+  800228:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  80022d:	29 ca                	sub    %ecx,%edx
+  80022f:	89 d1                	mov    %edx,%ecx
+  800231:	c1 e9 0f             	shr    $0xf,%ecx
+  800234:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  80023a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023f:	0f 42 d1             	cmovb  %ecx,%edx
+  800242:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800247:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80024e:	85 db                	test   %ebx,%ebx
+  800250:	7e 07                	jle    800259 <libmain+0x74>
+		binaryname = argv[0];
+  800252:	8b 06                	mov    (%esi),%eax
+  800254:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800259:	83 ec 08             	sub    $0x8,%esp
+  80025c:	56                   	push   %esi
+  80025d:	53                   	push   %ebx
+  80025e:	e8 d2 fd ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800263:	e8 0a 00 00 00       	call   800272 <exit>
+}
+  800268:	83 c4 10             	add    $0x10,%esp
+  80026b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80026e:	5b                   	pop    %ebx
+  80026f:	5e                   	pop    %esi
+  800270:	5d                   	pop    %ebp
+  800271:	c3                   	ret
+
+00800272 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800278:	e8 61 12 00 00       	call   8014de <close_all>
+	sys_env_destroy(0);
+  80027d:	83 ec 0c             	sub    $0xc,%esp
+  800280:	6a 00                	push   $0x0
+  800282:	e8 8c 0b 00 00       	call   800e13 <sys_env_destroy>
+}
+  800287:	83 c4 10             	add    $0x10,%esp
+  80028a:	c9                   	leave
+  80028b:	c3                   	ret
+
+0080028c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80028c:	55                   	push   %ebp
+  80028d:	89 e5                	mov    %esp,%ebp
+  80028f:	56                   	push   %esi
+  800290:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800291:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800294:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80029a:	e8 b5 0b 00 00       	call   800e54 <sys_getenvid>
+  80029f:	83 ec 0c             	sub    $0xc,%esp
+  8002a2:	ff 75 0c             	push   0xc(%ebp)
+  8002a5:	ff 75 08             	push   0x8(%ebp)
+  8002a8:	56                   	push   %esi
+  8002a9:	50                   	push   %eax
+  8002aa:	68 08 3d 80 00       	push   $0x803d08
+  8002af:	e8 b3 00 00 00       	call   800367 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002b4:	83 c4 18             	add    $0x18,%esp
+  8002b7:	53                   	push   %ebx
+  8002b8:	ff 75 10             	push   0x10(%ebp)
+  8002bb:	e8 56 00 00 00       	call   800316 <vcprintf>
+	cprintf("\n");
+  8002c0:	c7 04 24 85 3c 80 00 	movl   $0x803c85,(%esp)
+  8002c7:	e8 9b 00 00 00       	call   800367 <cprintf>
+  8002cc:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8002cf:	cc                   	int3
+	while (1)
+  8002d0:	eb fd                	jmp    8002cf <_panic+0x43>
+
+008002d2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	53                   	push   %ebx
+  8002d6:	83 ec 04             	sub    $0x4,%esp
+  8002d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002dc:	8b 13                	mov    (%ebx),%edx
+  8002de:	8d 42 01             	lea    0x1(%edx),%eax
+  8002e1:	89 03                	mov    %eax,(%ebx)
+  8002e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002e6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002ea:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002ef:	74 09                	je     8002fa <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002f1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002f8:	c9                   	leave
+  8002f9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002fa:	83 ec 08             	sub    $0x8,%esp
+  8002fd:	68 ff 00 00 00       	push   $0xff
+  800302:	8d 43 08             	lea    0x8(%ebx),%eax
+  800305:	50                   	push   %eax
+  800306:	e8 cb 0a 00 00       	call   800dd6 <sys_cputs>
+		b->idx = 0;
+  80030b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	eb db                	jmp    8002f1 <putch+0x1f>
+
+00800316 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80031f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800326:	00 00 00 
+	b.cnt = 0;
+  800329:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800330:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800333:	ff 75 0c             	push   0xc(%ebp)
+  800336:	ff 75 08             	push   0x8(%ebp)
+  800339:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80033f:	50                   	push   %eax
+  800340:	68 d2 02 80 00       	push   $0x8002d2
+  800345:	e8 1c 01 00 00       	call   800466 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80034a:	83 c4 08             	add    $0x8,%esp
+  80034d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800353:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800359:	50                   	push   %eax
+  80035a:	e8 77 0a 00 00       	call   800dd6 <sys_cputs>
+
+	return b.cnt;
+}
+  80035f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800365:	c9                   	leave
+  800366:	c3                   	ret
+
+00800367 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800367:	55                   	push   %ebp
+  800368:	89 e5                	mov    %esp,%ebp
+  80036a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80036d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800370:	50                   	push   %eax
+  800371:	ff 75 08             	push   0x8(%ebp)
+  800374:	e8 9d ff ff ff       	call   800316 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800379:	c9                   	leave
+  80037a:	c3                   	ret
+
+0080037b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	57                   	push   %edi
+  80037f:	56                   	push   %esi
+  800380:	53                   	push   %ebx
+  800381:	83 ec 1c             	sub    $0x1c,%esp
+  800384:	89 c3                	mov    %eax,%ebx
+  800386:	89 d6                	mov    %edx,%esi
+  800388:	8b 45 08             	mov    0x8(%ebp),%eax
+  80038b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80038e:	89 d1                	mov    %edx,%ecx
+  800390:	89 c2                	mov    %eax,%edx
+  800392:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800395:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800398:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80039b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80039e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003a5:	39 c2                	cmp    %eax,%edx
+  8003a7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003aa:	73 4b                	jae    8003f7 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  8003ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003af:	8d 78 ff             	lea    -0x1(%eax),%edi
+  8003b2:	85 ff                	test   %edi,%edi
+  8003b4:	7e 11                	jle    8003c7 <printnum+0x4c>
+			putch(padc, putdat);
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+  8003b9:	56                   	push   %esi
+  8003ba:	ff 75 18             	push   0x18(%ebp)
+  8003bd:	ff d3                	call   *%ebx
+		while (--width > 0)
+  8003bf:	83 c4 10             	add    $0x10,%esp
+  8003c2:	83 ef 01             	sub    $0x1,%edi
+  8003c5:	75 ef                	jne    8003b6 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003c7:	83 ec 08             	sub    $0x8,%esp
+  8003ca:	56                   	push   %esi
+  8003cb:	83 ec 04             	sub    $0x4,%esp
+  8003ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d1:	ff 75 e0             	push   -0x20(%ebp)
+  8003d4:	ff 75 dc             	push   -0x24(%ebp)
+  8003d7:	ff 75 d8             	push   -0x28(%ebp)
+  8003da:	e8 2a 37 00 00       	call   803b09 <__umoddi3>
+  8003df:	83 c4 14             	add    $0x14,%esp
+  8003e2:	0f be 80 2b 3d 80 00 	movsbl 0x803d2b(%eax),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	ff d3                	call   *%ebx
+}
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f2:	5b                   	pop    %ebx
+  8003f3:	5e                   	pop    %esi
+  8003f4:	5f                   	pop    %edi
+  8003f5:	5d                   	pop    %ebp
+  8003f6:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003f7:	83 ec 0c             	sub    $0xc,%esp
+  8003fa:	ff 75 18             	push   0x18(%ebp)
+  8003fd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800400:	8d 57 ff             	lea    -0x1(%edi),%edx
+  800403:	52                   	push   %edx
+  800404:	50                   	push   %eax
+  800405:	83 ec 08             	sub    $0x8,%esp
+  800408:	ff 75 e4             	push   -0x1c(%ebp)
+  80040b:	ff 75 e0             	push   -0x20(%ebp)
+  80040e:	ff 75 dc             	push   -0x24(%ebp)
+  800411:	ff 75 d8             	push   -0x28(%ebp)
+  800414:	e8 2a 36 00 00       	call   803a43 <__udivdi3>
+  800419:	83 c4 18             	add    $0x18,%esp
+  80041c:	52                   	push   %edx
+  80041d:	50                   	push   %eax
+  80041e:	89 f2                	mov    %esi,%edx
+  800420:	89 d8                	mov    %ebx,%eax
+  800422:	e8 54 ff ff ff       	call   80037b <printnum>
+  800427:	83 c4 20             	add    $0x20,%esp
+  80042a:	eb 9b                	jmp    8003c7 <printnum+0x4c>
+
+0080042c <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80042c:	55                   	push   %ebp
+  80042d:	89 e5                	mov    %esp,%ebp
+  80042f:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800432:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800436:	8b 10                	mov    (%eax),%edx
+  800438:	3b 50 04             	cmp    0x4(%eax),%edx
+  80043b:	73 0a                	jae    800447 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80043d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800440:	89 08                	mov    %ecx,(%eax)
+  800442:	8b 45 08             	mov    0x8(%ebp),%eax
+  800445:	88 02                	mov    %al,(%edx)
+}
+  800447:	5d                   	pop    %ebp
+  800448:	c3                   	ret
+
+00800449 <printfmt>:
+{
+  800449:	55                   	push   %ebp
+  80044a:	89 e5                	mov    %esp,%ebp
+  80044c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80044f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800452:	50                   	push   %eax
+  800453:	ff 75 10             	push   0x10(%ebp)
+  800456:	ff 75 0c             	push   0xc(%ebp)
+  800459:	ff 75 08             	push   0x8(%ebp)
+  80045c:	e8 05 00 00 00       	call   800466 <vprintfmt>
+}
+  800461:	83 c4 10             	add    $0x10,%esp
+  800464:	c9                   	leave
+  800465:	c3                   	ret
+
+00800466 <vprintfmt>:
+{
+  800466:	55                   	push   %ebp
+  800467:	89 e5                	mov    %esp,%ebp
+  800469:	57                   	push   %edi
+  80046a:	56                   	push   %esi
+  80046b:	53                   	push   %ebx
+  80046c:	83 ec 2c             	sub    $0x2c,%esp
+  80046f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800472:	89 df                	mov    %ebx,%edi
+  800474:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800477:	8b 45 10             	mov    0x10(%ebp),%eax
+  80047a:	8d 70 01             	lea    0x1(%eax),%esi
+  80047d:	0f b6 00             	movzbl (%eax),%eax
+  800480:	83 f8 25             	cmp    $0x25,%eax
+  800483:	74 1e                	je     8004a3 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800485:	85 c0                	test   %eax,%eax
+  800487:	0f 84 15 05 00 00    	je     8009a2 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80048d:	83 ec 08             	sub    $0x8,%esp
+  800490:	53                   	push   %ebx
+  800491:	50                   	push   %eax
+  800492:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800494:	83 c6 01             	add    $0x1,%esi
+  800497:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80049b:	83 c4 10             	add    $0x10,%esp
+  80049e:	83 f8 25             	cmp    $0x25,%eax
+  8004a1:	75 e2                	jne    800485 <vprintfmt+0x1f>
+		padc = ' ';
+  8004a3:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  8004a7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004ae:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  8004b5:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  8004bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004c1:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c4:	8d 56 01             	lea    0x1(%esi),%edx
+  8004c7:	0f b6 0e             	movzbl (%esi),%ecx
+  8004ca:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  8004cd:	3c 55                	cmp    $0x55,%al
+  8004cf:	0f 87 3b 04 00 00    	ja     800910 <vprintfmt+0x4aa>
+  8004d5:	0f b6 c0             	movzbl %al,%eax
+  8004d8:	ff 24 85 a0 3e 80 00 	jmp    *0x803ea0(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8004df:	89 75 10             	mov    %esi,0x10(%ebp)
+  8004e2:	eb 93                	jmp    800477 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8004e6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8004ea:	eb d8                	jmp    8004c4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ec:	89 d6                	mov    %edx,%esi
+  8004ee:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8004f2:	eb d0                	jmp    8004c4 <vprintfmt+0x5e>
+  8004f4:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8004f7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8004fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8004fd:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  800501:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  800504:	83 f9 09             	cmp    $0x9,%ecx
+  800507:	77 6f                	ja     800578 <vprintfmt+0x112>
+  800509:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  80050c:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  80050f:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  800512:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  800516:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  800519:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80051c:	83 fe 09             	cmp    $0x9,%esi
+  80051f:	76 eb                	jbe    80050c <vprintfmt+0xa6>
+  800521:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  800524:	89 d6                	mov    %edx,%esi
+  800526:	eb 13                	jmp    80053b <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 00                	mov    (%eax),%eax
+  80052d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800530:	8b 45 14             	mov    0x14(%ebp),%eax
+  800533:	8d 40 04             	lea    0x4(%eax),%eax
+  800536:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800539:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80053b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80053f:	79 83                	jns    8004c4 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800541:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800544:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800547:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80054e:	e9 71 ff ff ff       	jmp    8004c4 <vprintfmt+0x5e>
+			if (width < 0)
+  800553:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800556:	85 c9                	test   %ecx,%ecx
+  800558:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055d:	0f 49 c1             	cmovns %ecx,%eax
+  800560:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800563:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800565:	e9 5a ff ff ff       	jmp    8004c4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80056a:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80056c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800573:	e9 4c ff ff ff       	jmp    8004c4 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800578:	89 d6                	mov    %edx,%esi
+  80057a:	eb bf                	jmp    80053b <vprintfmt+0xd5>
+			lflag++;
+  80057c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800580:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800582:	e9 3d ff ff ff       	jmp    8004c4 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800587:	89 55 10             	mov    %edx,0x10(%ebp)
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8d 70 04             	lea    0x4(%eax),%esi
+  800590:	83 ec 08             	sub    $0x8,%esp
+  800593:	53                   	push   %ebx
+  800594:	ff 30                	push   (%eax)
+  800596:	ff d7                	call   *%edi
+			break;
+  800598:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80059b:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80059e:	e9 d4 fe ff ff       	jmp    800477 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  8005a3:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  8005ac:	8b 10                	mov    (%eax),%edx
+  8005ae:	89 d0                	mov    %edx,%eax
+  8005b0:	f7 d8                	neg    %eax
+  8005b2:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005b5:	83 f8 12             	cmp    $0x12,%eax
+  8005b8:	7f 23                	jg     8005dd <vprintfmt+0x177>
+  8005ba:	8b 14 85 00 40 80 00 	mov    0x804000(,%eax,4),%edx
+  8005c1:	85 d2                	test   %edx,%edx
+  8005c3:	74 18                	je     8005dd <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  8005c5:	52                   	push   %edx
+  8005c6:	68 5b 41 80 00       	push   $0x80415b
+  8005cb:	53                   	push   %ebx
+  8005cc:	57                   	push   %edi
+  8005cd:	e8 77 fe ff ff       	call   800449 <printfmt>
+  8005d2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005d5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8005d8:	e9 9a fe ff ff       	jmp    800477 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8005dd:	50                   	push   %eax
+  8005de:	68 43 3d 80 00       	push   $0x803d43
+  8005e3:	53                   	push   %ebx
+  8005e4:	57                   	push   %edi
+  8005e5:	e8 5f fe ff ff       	call   800449 <printfmt>
+  8005ea:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005ed:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005f0:	e9 82 fe ff ff       	jmp    800477 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005f5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fb:	83 c0 04             	add    $0x4,%eax
+  8005fe:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800601:	8b 45 14             	mov    0x14(%ebp),%eax
+  800604:	8b 00                	mov    (%eax),%eax
+  800606:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800609:	85 c0                	test   %eax,%eax
+  80060b:	0f 84 61 03 00 00    	je     800972 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  800611:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800615:	7e 06                	jle    80061d <vprintfmt+0x1b7>
+  800617:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80061b:	75 29                	jne    800646 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80061d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800620:	8d 70 01             	lea    0x1(%eax),%esi
+  800623:	0f b6 00             	movzbl (%eax),%eax
+  800626:	0f be d0             	movsbl %al,%edx
+  800629:	85 d2                	test   %edx,%edx
+  80062b:	0f 84 bb 00 00 00    	je     8006ec <vprintfmt+0x286>
+  800631:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800634:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800637:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80063a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80063d:	eb 7a                	jmp    8006b9 <vprintfmt+0x253>
+				p = "(null)";
+  80063f:	c7 45 d0 3c 3d 80 00 	movl   $0x803d3c,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800646:	83 ec 08             	sub    $0x8,%esp
+  800649:	ff 75 d4             	push   -0x2c(%ebp)
+  80064c:	ff 75 d0             	push   -0x30(%ebp)
+  80064f:	e8 e0 03 00 00       	call   800a34 <strnlen>
+  800654:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800657:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80065a:	83 c4 10             	add    $0x10,%esp
+  80065d:	85 d2                	test   %edx,%edx
+  80065f:	0f 8e d6 02 00 00    	jle    80093b <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800665:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800669:	83 ec 08             	sub    $0x8,%esp
+  80066c:	53                   	push   %ebx
+  80066d:	56                   	push   %esi
+  80066e:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800670:	83 c4 10             	add    $0x10,%esp
+  800673:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800677:	75 f0                	jne    800669 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800679:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80067c:	8d 70 01             	lea    0x1(%eax),%esi
+  80067f:	0f b6 00             	movzbl (%eax),%eax
+  800682:	0f be d0             	movsbl %al,%edx
+  800685:	85 d2                	test   %edx,%edx
+  800687:	0f 84 da 02 00 00    	je     800967 <vprintfmt+0x501>
+  80068d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800690:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800693:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800696:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800699:	eb 1e                	jmp    8006b9 <vprintfmt+0x253>
+					putch(ch, putdat);
+  80069b:	83 ec 08             	sub    $0x8,%esp
+  80069e:	ff 75 0c             	push   0xc(%ebp)
+  8006a1:	52                   	push   %edx
+  8006a2:	ff 55 08             	call   *0x8(%ebp)
+  8006a5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006a8:	83 eb 01             	sub    $0x1,%ebx
+  8006ab:	83 c6 01             	add    $0x1,%esi
+  8006ae:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006b2:	0f be d0             	movsbl %al,%edx
+  8006b5:	85 d2                	test   %edx,%edx
+  8006b7:	74 2a                	je     8006e3 <vprintfmt+0x27d>
+  8006b9:	85 ff                	test   %edi,%edi
+  8006bb:	78 05                	js     8006c2 <vprintfmt+0x25c>
+  8006bd:	83 ef 01             	sub    $0x1,%edi
+  8006c0:	78 59                	js     80071b <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006c2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006c6:	74 d3                	je     80069b <vprintfmt+0x235>
+  8006c8:	0f be c0             	movsbl %al,%eax
+  8006cb:	83 e8 20             	sub    $0x20,%eax
+  8006ce:	83 f8 5e             	cmp    $0x5e,%eax
+  8006d1:	76 c8                	jbe    80069b <vprintfmt+0x235>
+					putch('?', putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	ff 75 0c             	push   0xc(%ebp)
+  8006d9:	6a 3f                	push   $0x3f
+  8006db:	ff 55 08             	call   *0x8(%ebp)
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	eb c5                	jmp    8006a8 <vprintfmt+0x242>
+  8006e3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8006e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8006e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8006ec:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8006ef:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8006f3:	7e 1b                	jle    800710 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8006f5:	83 ec 08             	sub    $0x8,%esp
+  8006f8:	53                   	push   %ebx
+  8006f9:	6a 20                	push   $0x20
+  8006fb:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	83 ee 01             	sub    $0x1,%esi
+  800703:	75 f0                	jne    8006f5 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800705:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800708:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070b:	e9 67 fd ff ff       	jmp    800477 <vprintfmt+0x11>
+  800710:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+  800716:	e9 5c fd ff ff       	jmp    800477 <vprintfmt+0x11>
+  80071b:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80071e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800721:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800724:	eb c6                	jmp    8006ec <vprintfmt+0x286>
+	if (lflag >= 2)
+  800726:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800729:	89 55 10             	mov    %edx,0x10(%ebp)
+  80072c:	83 f9 01             	cmp    $0x1,%ecx
+  80072f:	7f 1f                	jg     800750 <vprintfmt+0x2ea>
+	else if (lflag)
+  800731:	85 c9                	test   %ecx,%ecx
+  800733:	74 67                	je     80079c <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800735:	8b 45 14             	mov    0x14(%ebp),%eax
+  800738:	8b 30                	mov    (%eax),%esi
+  80073a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80073d:	89 f0                	mov    %esi,%eax
+  80073f:	c1 f8 1f             	sar    $0x1f,%eax
+  800742:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800745:	8b 45 14             	mov    0x14(%ebp),%eax
+  800748:	8d 40 04             	lea    0x4(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074e:	eb 17                	jmp    800767 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800750:	8b 45 14             	mov    0x14(%ebp),%eax
+  800753:	8b 50 04             	mov    0x4(%eax),%edx
+  800756:	8b 00                	mov    (%eax),%eax
+  800758:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8d 40 08             	lea    0x8(%eax),%eax
+  800764:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800767:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80076a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80076d:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800772:	85 c9                	test   %ecx,%ecx
+  800774:	0f 89 12 01 00 00    	jns    80088c <vprintfmt+0x426>
+				putch('-', putdat);
+  80077a:	83 ec 08             	sub    $0x8,%esp
+  80077d:	53                   	push   %ebx
+  80077e:	6a 2d                	push   $0x2d
+  800780:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800782:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800785:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800788:	f7 da                	neg    %edx
+  80078a:	83 d1 00             	adc    $0x0,%ecx
+  80078d:	f7 d9                	neg    %ecx
+  80078f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800792:	be 0a 00 00 00       	mov    $0xa,%esi
+  800797:	e9 f0 00 00 00       	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 30                	mov    (%eax),%esi
+  8007a1:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  8007a4:	89 f0                	mov    %esi,%eax
+  8007a6:	c1 f8 1f             	sar    $0x1f,%eax
+  8007a9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8007ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007af:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b5:	eb b0                	jmp    800767 <vprintfmt+0x301>
+	if (lflag >= 2)
+  8007b7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8007ba:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007bd:	83 f9 01             	cmp    $0x1,%ecx
+  8007c0:	7f 1e                	jg     8007e0 <vprintfmt+0x37a>
+	else if (lflag)
+  8007c2:	85 c9                	test   %ecx,%ecx
+  8007c4:	74 32                	je     8007f8 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8b 10                	mov    (%eax),%edx
+  8007cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007d6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8007db:	e9 ac 00 00 00       	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e3:	8b 10                	mov    (%eax),%edx
+  8007e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ee:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8007f3:	e9 94 00 00 00       	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8b 10                	mov    (%eax),%edx
+  8007fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800802:	8d 40 04             	lea    0x4(%eax),%eax
+  800805:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800808:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  80080d:	eb 7d                	jmp    80088c <vprintfmt+0x426>
+	if (lflag >= 2)
+  80080f:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  800812:	89 55 10             	mov    %edx,0x10(%ebp)
+  800815:	83 f9 01             	cmp    $0x1,%ecx
+  800818:	7f 1b                	jg     800835 <vprintfmt+0x3cf>
+	else if (lflag)
+  80081a:	85 c9                	test   %ecx,%ecx
+  80081c:	74 2c                	je     80084a <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8b 10                	mov    (%eax),%edx
+  800823:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800828:	8d 40 04             	lea    0x4(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80082e:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800833:	eb 57                	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800835:	8b 45 14             	mov    0x14(%ebp),%eax
+  800838:	8b 10                	mov    (%eax),%edx
+  80083a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80083d:	8d 40 08             	lea    0x8(%eax),%eax
+  800840:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800843:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800848:	eb 42                	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80084a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084d:	8b 10                	mov    (%eax),%edx
+  80084f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800854:	8d 40 04             	lea    0x4(%eax),%eax
+  800857:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80085a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80085f:	eb 2b                	jmp    80088c <vprintfmt+0x426>
+			putch('0', putdat);
+  800861:	89 55 10             	mov    %edx,0x10(%ebp)
+  800864:	83 ec 08             	sub    $0x8,%esp
+  800867:	53                   	push   %ebx
+  800868:	6a 30                	push   $0x30
+  80086a:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80086c:	83 c4 08             	add    $0x8,%esp
+  80086f:	53                   	push   %ebx
+  800870:	6a 78                	push   $0x78
+  800872:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800874:	8b 45 14             	mov    0x14(%ebp),%eax
+  800877:	8b 10                	mov    (%eax),%edx
+  800879:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80087e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800881:	8d 40 04             	lea    0x4(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800887:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80088c:	83 ec 0c             	sub    $0xc,%esp
+  80088f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800893:	50                   	push   %eax
+  800894:	ff 75 e4             	push   -0x1c(%ebp)
+  800897:	56                   	push   %esi
+  800898:	51                   	push   %ecx
+  800899:	52                   	push   %edx
+  80089a:	89 da                	mov    %ebx,%edx
+  80089c:	89 f8                	mov    %edi,%eax
+  80089e:	e8 d8 fa ff ff       	call   80037b <printnum>
+			break;
+  8008a3:	83 c4 20             	add    $0x20,%esp
+  8008a6:	e9 cc fb ff ff       	jmp    800477 <vprintfmt+0x11>
+	if (lflag >= 2)
+  8008ab:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8008ae:	89 55 10             	mov    %edx,0x10(%ebp)
+  8008b1:	83 f9 01             	cmp    $0x1,%ecx
+  8008b4:	7f 1b                	jg     8008d1 <vprintfmt+0x46b>
+	else if (lflag)
+  8008b6:	85 c9                	test   %ecx,%ecx
+  8008b8:	74 2c                	je     8008e6 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  8008ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bd:	8b 10                	mov    (%eax),%edx
+  8008bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008ca:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  8008cf:	eb bb                	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8008d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d4:	8b 10                	mov    (%eax),%edx
+  8008d6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008d9:	8d 40 08             	lea    0x8(%eax),%eax
+  8008dc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008df:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8008e4:	eb a6                	jmp    80088c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8008e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e9:	8b 10                	mov    (%eax),%edx
+  8008eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008f6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8008fb:	eb 8f                	jmp    80088c <vprintfmt+0x426>
+			putch(ch, putdat);
+  8008fd:	89 55 10             	mov    %edx,0x10(%ebp)
+  800900:	83 ec 08             	sub    $0x8,%esp
+  800903:	53                   	push   %ebx
+  800904:	6a 25                	push   $0x25
+  800906:	ff d7                	call   *%edi
+			break;
+  800908:	83 c4 10             	add    $0x10,%esp
+  80090b:	e9 67 fb ff ff       	jmp    800477 <vprintfmt+0x11>
+			putch('%', putdat);
+  800910:	83 ec 08             	sub    $0x8,%esp
+  800913:	53                   	push   %ebx
+  800914:	6a 25                	push   $0x25
+  800916:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800918:	83 c4 10             	add    $0x10,%esp
+  80091b:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  80091f:	0f 84 ba fb ff ff    	je     8004df <vprintfmt+0x79>
+  800925:	89 75 10             	mov    %esi,0x10(%ebp)
+  800928:	89 f0                	mov    %esi,%eax
+  80092a:	83 e8 01             	sub    $0x1,%eax
+  80092d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800931:	75 f7                	jne    80092a <vprintfmt+0x4c4>
+  800933:	89 45 10             	mov    %eax,0x10(%ebp)
+  800936:	e9 3c fb ff ff       	jmp    800477 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80093b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80093e:	8d 70 01             	lea    0x1(%eax),%esi
+  800941:	0f b6 00             	movzbl (%eax),%eax
+  800944:	0f be d0             	movsbl %al,%edx
+  800947:	85 d2                	test   %edx,%edx
+  800949:	74 11                	je     80095c <vprintfmt+0x4f6>
+  80094b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80094e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800951:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800954:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800957:	e9 5d fd ff ff       	jmp    8006b9 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80095c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80095f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800962:	e9 10 fb ff ff       	jmp    800477 <vprintfmt+0x11>
+  800967:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80096a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80096d:	e9 05 fb ff ff       	jmp    800477 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800972:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800976:	7e 0a                	jle    800982 <vprintfmt+0x51c>
+  800978:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80097c:	0f 85 bd fc ff ff    	jne    80063f <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800982:	ba 28 00 00 00       	mov    $0x28,%edx
+  800987:	b8 28 00 00 00       	mov    $0x28,%eax
+  80098c:	be 3d 3d 80 00       	mov    $0x803d3d,%esi
+  800991:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800994:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800997:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80099a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80099d:	e9 17 fd ff ff       	jmp    8006b9 <vprintfmt+0x253>
+}
+  8009a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a5:	5b                   	pop    %ebx
+  8009a6:	5e                   	pop    %esi
+  8009a7:	5f                   	pop    %edi
+  8009a8:	5d                   	pop    %ebp
+  8009a9:	c3                   	ret
+
+008009aa <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	83 ec 18             	sub    $0x18,%esp
+  8009b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b3:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8009b6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009b9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009bd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009c0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8009c7:	85 c0                	test   %eax,%eax
+  8009c9:	74 26                	je     8009f1 <vsnprintf+0x47>
+  8009cb:	85 d2                	test   %edx,%edx
+  8009cd:	7e 22                	jle    8009f1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009cf:	ff 75 14             	push   0x14(%ebp)
+  8009d2:	ff 75 10             	push   0x10(%ebp)
+  8009d5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009d8:	50                   	push   %eax
+  8009d9:	68 2c 04 80 00       	push   $0x80042c
+  8009de:	e8 83 fa ff ff       	call   800466 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8009e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009e6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8009e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009ec:	83 c4 10             	add    $0x10,%esp
+}
+  8009ef:	c9                   	leave
+  8009f0:	c3                   	ret
+		return -E_INVAL;
+  8009f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f6:	eb f7                	jmp    8009ef <vsnprintf+0x45>
+
+008009f8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009f8:	55                   	push   %ebp
+  8009f9:	89 e5                	mov    %esp,%ebp
+  8009fb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009fe:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800a01:	50                   	push   %eax
+  800a02:	ff 75 10             	push   0x10(%ebp)
+  800a05:	ff 75 0c             	push   0xc(%ebp)
+  800a08:	ff 75 08             	push   0x8(%ebp)
+  800a0b:	e8 9a ff ff ff       	call   8009aa <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800a10:	c9                   	leave
+  800a11:	c3                   	ret
+
+00800a12 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a18:	80 3a 00             	cmpb   $0x0,(%edx)
+  800a1b:	74 10                	je     800a2d <strlen+0x1b>
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  800a22:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a25:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a29:	75 f7                	jne    800a22 <strlen+0x10>
+	return n;
+}
+  800a2b:	5d                   	pop    %ebp
+  800a2c:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  800a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800a32:	eb f7                	jmp    800a2b <strlen+0x19>
+
+00800a34 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a34:	55                   	push   %ebp
+  800a35:	89 e5                	mov    %esp,%ebp
+  800a37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a3a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a3d:	85 d2                	test   %edx,%edx
+  800a3f:	74 16                	je     800a57 <strnlen+0x23>
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a46:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a4a:	74 09                	je     800a55 <strnlen+0x21>
+		n++;
+  800a4c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a4f:	39 d0                	cmp    %edx,%eax
+  800a51:	75 f3                	jne    800a46 <strnlen+0x12>
+		n++;
+  800a53:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800a55:	5d                   	pop    %ebp
+  800a56:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5c:	eb f7                	jmp    800a55 <strnlen+0x21>
+
+00800a5e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	53                   	push   %ebx
+  800a62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a65:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a71:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a74:	83 c0 01             	add    $0x1,%eax
+  800a77:	84 d2                	test   %dl,%dl
+  800a79:	75 f2                	jne    800a6d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a7b:	89 c8                	mov    %ecx,%eax
+  800a7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a80:	c9                   	leave
+  800a81:	c3                   	ret
+
+00800a82 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a82:	55                   	push   %ebp
+  800a83:	89 e5                	mov    %esp,%ebp
+  800a85:	53                   	push   %ebx
+  800a86:	83 ec 10             	sub    $0x10,%esp
+  800a89:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a8c:	53                   	push   %ebx
+  800a8d:	e8 80 ff ff ff       	call   800a12 <strlen>
+  800a92:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a95:	ff 75 0c             	push   0xc(%ebp)
+  800a98:	01 d8                	add    %ebx,%eax
+  800a9a:	50                   	push   %eax
+  800a9b:	e8 be ff ff ff       	call   800a5e <strcpy>
+	return dst;
+}
+  800aa0:	89 d8                	mov    %ebx,%eax
+  800aa2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+00800aa7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	56                   	push   %esi
+  800aab:	53                   	push   %ebx
+  800aac:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aaf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ab2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ab5:	85 db                	test   %ebx,%ebx
+  800ab7:	74 17                	je     800ad0 <strncpy+0x29>
+  800ab9:	01 f3                	add    %esi,%ebx
+  800abb:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  800abd:	83 c0 01             	add    $0x1,%eax
+  800ac0:	0f b6 0a             	movzbl (%edx),%ecx
+  800ac3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ac6:	80 f9 01             	cmp    $0x1,%cl
+  800ac9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800acc:	39 c3                	cmp    %eax,%ebx
+  800ace:	75 ed                	jne    800abd <strncpy+0x16>
+	}
+	return ret;
+}
+  800ad0:	89 f0                	mov    %esi,%eax
+  800ad2:	5b                   	pop    %ebx
+  800ad3:	5e                   	pop    %esi
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  800adb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ade:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800ae4:	89 f0                	mov    %esi,%eax
+  800ae6:	85 db                	test   %ebx,%ebx
+  800ae8:	74 1e                	je     800b08 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  800aea:	83 eb 01             	sub    $0x1,%ebx
+  800aed:	74 16                	je     800b05 <strlcpy+0x2f>
+  800aef:	01 f3                	add    %esi,%ebx
+  800af1:	0f b6 0a             	movzbl (%edx),%ecx
+  800af4:	84 c9                	test   %cl,%cl
+  800af6:	74 0d                	je     800b05 <strlcpy+0x2f>
+			*dst++ = *src++;
+  800af8:	83 c2 01             	add    $0x1,%edx
+  800afb:	83 c0 01             	add    $0x1,%eax
+  800afe:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  800b01:	39 d8                	cmp    %ebx,%eax
+  800b03:	75 ec                	jne    800af1 <strlcpy+0x1b>
+		*dst = '\0';
+  800b05:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b08:	29 f0                	sub    %esi,%eax
+}
+  800b0a:	5b                   	pop    %ebx
+  800b0b:	5e                   	pop    %esi
+  800b0c:	5d                   	pop    %ebp
+  800b0d:	c3                   	ret
+
+00800b0e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b14:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b17:	0f b6 01             	movzbl (%ecx),%eax
+  800b1a:	84 c0                	test   %al,%al
+  800b1c:	74 11                	je     800b2f <strcmp+0x21>
+  800b1e:	38 02                	cmp    %al,(%edx)
+  800b20:	75 0d                	jne    800b2f <strcmp+0x21>
+		p++, q++;
+  800b22:	83 c1 01             	add    $0x1,%ecx
+  800b25:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b28:	0f b6 01             	movzbl (%ecx),%eax
+  800b2b:	84 c0                	test   %al,%al
+  800b2d:	75 ef                	jne    800b1e <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b2f:	0f b6 c0             	movzbl %al,%eax
+  800b32:	0f b6 12             	movzbl (%edx),%edx
+  800b35:	29 d0                	sub    %edx,%eax
+}
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	53                   	push   %ebx
+  800b3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b40:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b43:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800b46:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800b4b:	85 d2                	test   %edx,%edx
+  800b4d:	74 2e                	je     800b7d <strncmp+0x44>
+  800b4f:	0f b6 01             	movzbl (%ecx),%eax
+  800b52:	84 c0                	test   %al,%al
+  800b54:	74 16                	je     800b6c <strncmp+0x33>
+  800b56:	3a 03                	cmp    (%ebx),%al
+  800b58:	75 12                	jne    800b6c <strncmp+0x33>
+		n--, p++, q++;
+  800b5a:	83 c1 01             	add    $0x1,%ecx
+  800b5d:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800b60:	83 ea 01             	sub    $0x1,%edx
+  800b63:	75 ea                	jne    800b4f <strncmp+0x16>
+		return 0;
+  800b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b6a:	eb 11                	jmp    800b7d <strncmp+0x44>
+  800b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800b71:	85 d2                	test   %edx,%edx
+  800b73:	74 08                	je     800b7d <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b75:	0f b6 01             	movzbl (%ecx),%eax
+  800b78:	0f b6 13             	movzbl (%ebx),%edx
+  800b7b:	29 d0                	sub    %edx,%eax
+}
+  800b7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+00800b82 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b88:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b8c:	0f b6 10             	movzbl (%eax),%edx
+  800b8f:	84 d2                	test   %dl,%dl
+  800b91:	74 15                	je     800ba8 <strchr+0x26>
+		if (*s == c)
+  800b93:	38 d1                	cmp    %dl,%cl
+  800b95:	74 0f                	je     800ba6 <strchr+0x24>
+	for (; *s; s++)
+  800b97:	83 c0 01             	add    $0x1,%eax
+  800b9a:	0f b6 10             	movzbl (%eax),%edx
+  800b9d:	84 d2                	test   %dl,%dl
+  800b9f:	75 f2                	jne    800b93 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba6:	5d                   	pop    %ebp
+  800ba7:	c3                   	ret
+	return 0;
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bad:	eb f7                	jmp    800ba6 <strchr+0x24>
+
+00800baf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	53                   	push   %ebx
+  800bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800bb9:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800bbc:	38 d3                	cmp    %dl,%bl
+  800bbe:	74 14                	je     800bd4 <strfind+0x25>
+  800bc0:	89 d1                	mov    %edx,%ecx
+  800bc2:	84 db                	test   %bl,%bl
+  800bc4:	74 0e                	je     800bd4 <strfind+0x25>
+	for (; *s; s++)
+  800bc6:	83 c0 01             	add    $0x1,%eax
+  800bc9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bcc:	38 ca                	cmp    %cl,%dl
+  800bce:	74 04                	je     800bd4 <strfind+0x25>
+  800bd0:	84 d2                	test   %dl,%dl
+  800bd2:	75 f2                	jne    800bc6 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bd7:	c9                   	leave
+  800bd8:	c3                   	ret
+
+00800bd9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	57                   	push   %edi
+  800bdd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800be0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800be3:	85 c9                	test   %ecx,%ecx
+  800be5:	74 20                	je     800c07 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800be7:	89 f8                	mov    %edi,%eax
+  800be9:	09 c8                	or     %ecx,%eax
+  800beb:	a8 03                	test   $0x3,%al
+  800bed:	75 12                	jne    800c01 <memset+0x28>
+		c &= 0xFF;
+  800bef:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bf3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800bf9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800bfc:	fc                   	cld
+  800bfd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bff:	eb 06                	jmp    800c07 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800c01:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c04:	fc                   	cld
+  800c05:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800c07:	89 f8                	mov    %edi,%eax
+  800c09:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c0c:	c9                   	leave
+  800c0d:	c3                   	ret
+
+00800c0e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	57                   	push   %edi
+  800c12:	56                   	push   %esi
+  800c13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c19:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c1c:	39 c6                	cmp    %eax,%esi
+  800c1e:	73 32                	jae    800c52 <memmove+0x44>
+  800c20:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c23:	39 d0                	cmp    %edx,%eax
+  800c25:	73 2b                	jae    800c52 <memmove+0x44>
+		s += n;
+		d += n;
+  800c27:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c2a:	89 d6                	mov    %edx,%esi
+  800c2c:	09 fe                	or     %edi,%esi
+  800c2e:	09 ce                	or     %ecx,%esi
+  800c30:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c36:	75 0e                	jne    800c46 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c38:	83 ef 04             	sub    $0x4,%edi
+  800c3b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c3e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c41:	fd                   	std
+  800c42:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c44:	eb 09                	jmp    800c4f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c46:	83 ef 01             	sub    $0x1,%edi
+  800c49:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c4c:	fd                   	std
+  800c4d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c4f:	fc                   	cld
+  800c50:	eb 1a                	jmp    800c6c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c52:	89 f2                	mov    %esi,%edx
+  800c54:	09 c2                	or     %eax,%edx
+  800c56:	09 ca                	or     %ecx,%edx
+  800c58:	f6 c2 03             	test   $0x3,%dl
+  800c5b:	75 0a                	jne    800c67 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c5d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c60:	89 c7                	mov    %eax,%edi
+  800c62:	fc                   	cld
+  800c63:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c65:	eb 05                	jmp    800c6c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c67:	89 c7                	mov    %eax,%edi
+  800c69:	fc                   	cld
+  800c6a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c6c:	5e                   	pop    %esi
+  800c6d:	5f                   	pop    %edi
+  800c6e:	5d                   	pop    %ebp
+  800c6f:	c3                   	ret
+
+00800c70 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800c70:	55                   	push   %ebp
+  800c71:	89 e5                	mov    %esp,%ebp
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c76:	ff 75 10             	push   0x10(%ebp)
+  800c79:	ff 75 0c             	push   0xc(%ebp)
+  800c7c:	ff 75 08             	push   0x8(%ebp)
+  800c7f:	e8 8a ff ff ff       	call   800c0e <memmove>
+}
+  800c84:	c9                   	leave
+  800c85:	c3                   	ret
+
+00800c86 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	56                   	push   %esi
+  800c8a:	53                   	push   %ebx
+  800c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c91:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c94:	85 f6                	test   %esi,%esi
+  800c96:	74 29                	je     800cc1 <memcmp+0x3b>
+  800c98:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800c9a:	0f b6 08             	movzbl (%eax),%ecx
+  800c9d:	0f b6 1a             	movzbl (%edx),%ebx
+  800ca0:	38 d9                	cmp    %bl,%cl
+  800ca2:	75 11                	jne    800cb5 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ca4:	83 c0 01             	add    $0x1,%eax
+  800ca7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800caa:	39 c6                	cmp    %eax,%esi
+  800cac:	75 ec                	jne    800c9a <memcmp+0x14>
+	}
+
+	return 0;
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb3:	eb 08                	jmp    800cbd <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800cb5:	0f b6 c1             	movzbl %cl,%eax
+  800cb8:	0f b6 db             	movzbl %bl,%ebx
+  800cbb:	29 d8                	sub    %ebx,%eax
+}
+  800cbd:	5b                   	pop    %ebx
+  800cbe:	5e                   	pop    %esi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+	return 0;
+  800cc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc6:	eb f5                	jmp    800cbd <memcmp+0x37>
+
+00800cc8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cd1:	89 c2                	mov    %eax,%edx
+  800cd3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cd6:	39 d0                	cmp    %edx,%eax
+  800cd8:	73 0d                	jae    800ce7 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cda:	38 08                	cmp    %cl,(%eax)
+  800cdc:	74 0d                	je     800ceb <memfind+0x23>
+	for (; s < ends; s++)
+  800cde:	83 c0 01             	add    $0x1,%eax
+  800ce1:	39 c2                	cmp    %eax,%edx
+  800ce3:	75 f5                	jne    800cda <memfind+0x12>
+  800ce5:	eb 06                	jmp    800ced <memfind+0x25>
+  800ce7:	89 c2                	mov    %eax,%edx
+  800ce9:	eb 02                	jmp    800ced <memfind+0x25>
+  800ceb:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800ced:	89 d0                	mov    %edx,%eax
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cfd:	0f b6 02             	movzbl (%edx),%eax
+  800d00:	3c 20                	cmp    $0x20,%al
+  800d02:	74 04                	je     800d08 <strtol+0x17>
+  800d04:	3c 09                	cmp    $0x9,%al
+  800d06:	75 0e                	jne    800d16 <strtol+0x25>
+		s++;
+  800d08:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800d0b:	0f b6 02             	movzbl (%edx),%eax
+  800d0e:	3c 20                	cmp    $0x20,%al
+  800d10:	74 f6                	je     800d08 <strtol+0x17>
+  800d12:	3c 09                	cmp    $0x9,%al
+  800d14:	74 f2                	je     800d08 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d16:	3c 2b                	cmp    $0x2b,%al
+  800d18:	74 2a                	je     800d44 <strtol+0x53>
+	int neg = 0;
+  800d1a:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800d1f:	3c 2d                	cmp    $0x2d,%al
+  800d21:	74 2b                	je     800d4e <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d23:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d29:	75 0f                	jne    800d3a <strtol+0x49>
+  800d2b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d2e:	74 28                	je     800d58 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d30:	85 db                	test   %ebx,%ebx
+  800d32:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d37:	0f 44 d8             	cmove  %eax,%ebx
+  800d3a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d42:	eb 46                	jmp    800d8a <strtol+0x99>
+		s++;
+  800d44:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d47:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d4c:	eb d5                	jmp    800d23 <strtol+0x32>
+		s++, neg = 1;
+  800d4e:	83 c2 01             	add    $0x1,%edx
+  800d51:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d56:	eb cb                	jmp    800d23 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d58:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d5c:	74 0e                	je     800d6c <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800d5e:	85 db                	test   %ebx,%ebx
+  800d60:	75 d8                	jne    800d3a <strtol+0x49>
+		s++, base = 8;
+  800d62:	83 c2 01             	add    $0x1,%edx
+  800d65:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d6a:	eb ce                	jmp    800d3a <strtol+0x49>
+		s += 2, base = 16;
+  800d6c:	83 c2 02             	add    $0x2,%edx
+  800d6f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d74:	eb c4                	jmp    800d3a <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d76:	0f be c0             	movsbl %al,%eax
+  800d79:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d7c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d7f:	7d 3a                	jge    800dbb <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800d81:	83 c2 01             	add    $0x1,%edx
+  800d84:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d88:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d8a:	0f b6 02             	movzbl (%edx),%eax
+  800d8d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d90:	89 f3                	mov    %esi,%ebx
+  800d92:	80 fb 09             	cmp    $0x9,%bl
+  800d95:	76 df                	jbe    800d76 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800d97:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d9a:	89 f3                	mov    %esi,%ebx
+  800d9c:	80 fb 19             	cmp    $0x19,%bl
+  800d9f:	77 08                	ja     800da9 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800da1:	0f be c0             	movsbl %al,%eax
+  800da4:	83 e8 57             	sub    $0x57,%eax
+  800da7:	eb d3                	jmp    800d7c <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800da9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dac:	89 f3                	mov    %esi,%ebx
+  800dae:	80 fb 19             	cmp    $0x19,%bl
+  800db1:	77 08                	ja     800dbb <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800db3:	0f be c0             	movsbl %al,%eax
+  800db6:	83 e8 37             	sub    $0x37,%eax
+  800db9:	eb c1                	jmp    800d7c <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800dbb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dbf:	74 05                	je     800dc6 <strtol+0xd5>
+		*endptr = (char *) s;
+  800dc1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dc4:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800dc6:	89 c8                	mov    %ecx,%eax
+  800dc8:	f7 d8                	neg    %eax
+  800dca:	85 ff                	test   %edi,%edi
+  800dcc:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800dcf:	89 c8                	mov    %ecx,%eax
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+
+00800dd6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	57                   	push   %edi
+  800dda:	56                   	push   %esi
+  800ddb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de7:	89 c3                	mov    %eax,%ebx
+  800de9:	89 c7                	mov    %eax,%edi
+  800deb:	89 c6                	mov    %eax,%esi
+  800ded:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e29:	89 cb                	mov    %ecx,%ebx
+  800e2b:	89 cf                	mov    %ecx,%edi
+  800e2d:	89 ce                	mov    %ecx,%esi
+  800e2f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	7f 08                	jg     800e3d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e38:	5b                   	pop    %ebx
+  800e39:	5e                   	pop    %esi
+  800e3a:	5f                   	pop    %edi
+  800e3b:	5d                   	pop    %ebp
+  800e3c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+  800e40:	50                   	push   %eax
+  800e41:	6a 03                	push   $0x3
+  800e43:	68 6b 40 80 00       	push   $0x80406b
+  800e48:	6a 23                	push   $0x23
+  800e4a:	68 88 40 80 00       	push   $0x804088
+  800e4f:	e8 38 f4 ff ff       	call   80028c <_panic>
+
+00800e54 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e5f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e64:	89 d1                	mov    %edx,%ecx
+  800e66:	89 d3                	mov    %edx,%ebx
+  800e68:	89 d7                	mov    %edx,%edi
+  800e6a:	89 d6                	mov    %edx,%esi
+  800e6c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e6e:	5b                   	pop    %ebx
+  800e6f:	5e                   	pop    %esi
+  800e70:	5f                   	pop    %edi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e83:	89 d1                	mov    %edx,%ecx
+  800e85:	89 d3                	mov    %edx,%ebx
+  800e87:	89 d7                	mov    %edx,%edi
+  800e89:	89 d6                	mov    %edx,%esi
+  800e8b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5f                   	pop    %edi
+  800e90:	5d                   	pop    %ebp
+  800e91:	c3                   	ret
+
+00800e92 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	57                   	push   %edi
+  800e96:	56                   	push   %esi
+  800e97:	53                   	push   %ebx
+  800e98:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e9b:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eae:	89 f7                	mov    %esi,%edi
+  800eb0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eb2:	85 c0                	test   %eax,%eax
+  800eb4:	7f 08                	jg     800ebe <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800eb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb9:	5b                   	pop    %ebx
+  800eba:	5e                   	pop    %esi
+  800ebb:	5f                   	pop    %edi
+  800ebc:	5d                   	pop    %ebp
+  800ebd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  800ec1:	50                   	push   %eax
+  800ec2:	6a 04                	push   $0x4
+  800ec4:	68 6b 40 80 00       	push   $0x80406b
+  800ec9:	6a 23                	push   $0x23
+  800ecb:	68 88 40 80 00       	push   $0x804088
+  800ed0:	e8 b7 f3 ff ff       	call   80028c <_panic>
+
+00800ed5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ed5:	55                   	push   %ebp
+  800ed6:	89 e5                	mov    %esp,%ebp
+  800ed8:	57                   	push   %edi
+  800ed9:	56                   	push   %esi
+  800eda:	53                   	push   %ebx
+  800edb:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ee9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	7f 08                	jg     800f00 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800ef8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800efb:	5b                   	pop    %ebx
+  800efc:	5e                   	pop    %esi
+  800efd:	5f                   	pop    %edi
+  800efe:	5d                   	pop    %ebp
+  800eff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  800f03:	50                   	push   %eax
+  800f04:	6a 05                	push   $0x5
+  800f06:	68 6b 40 80 00       	push   $0x80406b
+  800f0b:	6a 23                	push   $0x23
+  800f0d:	68 88 40 80 00       	push   $0x804088
+  800f12:	e8 75 f3 ff ff       	call   80028c <_panic>
+
+00800f17 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f17:	55                   	push   %ebp
+  800f18:	89 e5                	mov    %esp,%ebp
+  800f1a:	57                   	push   %edi
+  800f1b:	56                   	push   %esi
+  800f1c:	53                   	push   %ebx
+  800f1d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f30:	89 df                	mov    %ebx,%edi
+  800f32:	89 de                	mov    %ebx,%esi
+  800f34:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f36:	85 c0                	test   %eax,%eax
+  800f38:	7f 08                	jg     800f42 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3d:	5b                   	pop    %ebx
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5f                   	pop    %edi
+  800f40:	5d                   	pop    %ebp
+  800f41:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f42:	83 ec 0c             	sub    $0xc,%esp
+  800f45:	50                   	push   %eax
+  800f46:	6a 06                	push   $0x6
+  800f48:	68 6b 40 80 00       	push   $0x80406b
+  800f4d:	6a 23                	push   $0x23
+  800f4f:	68 88 40 80 00       	push   $0x804088
+  800f54:	e8 33 f3 ff ff       	call   80028c <_panic>
+
+00800f59 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f59:	55                   	push   %ebp
+  800f5a:	89 e5                	mov    %esp,%ebp
+  800f5c:	57                   	push   %edi
+  800f5d:	56                   	push   %esi
+  800f5e:	53                   	push   %ebx
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f72:	89 df                	mov    %ebx,%edi
+  800f74:	89 de                	mov    %ebx,%esi
+  800f76:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f78:	85 c0                	test   %eax,%eax
+  800f7a:	7f 08                	jg     800f84 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5f                   	pop    %edi
+  800f82:	5d                   	pop    %ebp
+  800f83:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+  800f87:	50                   	push   %eax
+  800f88:	6a 08                	push   $0x8
+  800f8a:	68 6b 40 80 00       	push   $0x80406b
+  800f8f:	6a 23                	push   $0x23
+  800f91:	68 88 40 80 00       	push   $0x804088
+  800f96:	e8 f1 f2 ff ff       	call   80028c <_panic>
+
+00800f9b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fb4:	89 df                	mov    %ebx,%edi
+  800fb6:	89 de                	mov    %ebx,%esi
+  800fb8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	7f 08                	jg     800fc6 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 09                	push   $0x9
+  800fcc:	68 6b 40 80 00       	push   $0x80406b
+  800fd1:	6a 23                	push   $0x23
+  800fd3:	68 88 40 80 00       	push   $0x804088
+  800fd8:	e8 af f2 ff ff       	call   80028c <_panic>
+
+00800fdd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fe6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800feb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ff6:	89 df                	mov    %ebx,%edi
+  800ff8:	89 de                	mov    %ebx,%esi
+  800ffa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ffc:	85 c0                	test   %eax,%eax
+  800ffe:	7f 08                	jg     801008 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801000:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801003:	5b                   	pop    %ebx
+  801004:	5e                   	pop    %esi
+  801005:	5f                   	pop    %edi
+  801006:	5d                   	pop    %ebp
+  801007:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801008:	83 ec 0c             	sub    $0xc,%esp
+  80100b:	50                   	push   %eax
+  80100c:	6a 0a                	push   $0xa
+  80100e:	68 6b 40 80 00       	push   $0x80406b
+  801013:	6a 23                	push   $0x23
+  801015:	68 88 40 80 00       	push   $0x804088
+  80101a:	e8 6d f2 ff ff       	call   80028c <_panic>
+
+0080101f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801030:	be 00 00 00 00       	mov    $0x0,%esi
+  801035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801038:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80103b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+
+00801042 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  801048:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801058:	89 cb                	mov    %ecx,%ebx
+  80105a:	89 cf                	mov    %ecx,%edi
+  80105c:	89 ce                	mov    %ecx,%esi
+  80105e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801060:	85 c0                	test   %eax,%eax
+  801062:	7f 08                	jg     80106c <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  801064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801067:	5b                   	pop    %ebx
+  801068:	5e                   	pop    %esi
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106c:	83 ec 0c             	sub    $0xc,%esp
+  80106f:	50                   	push   %eax
+  801070:	6a 0d                	push   $0xd
+  801072:	68 6b 40 80 00       	push   $0x80406b
+  801077:	6a 23                	push   $0x23
+  801079:	68 88 40 80 00       	push   $0x804088
+  80107e:	e8 09 f2 ff ff       	call   80028c <_panic>
+
+00801083 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801089:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801094:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801097:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80109d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  80109f:	5b                   	pop    %ebx
+  8010a0:	5e                   	pop    %esi
+  8010a1:	5f                   	pop    %edi
+  8010a2:	5d                   	pop    %ebp
+  8010a3:	c3                   	ret
+
+008010a4 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  8010a4:	55                   	push   %ebp
+  8010a5:	89 e5                	mov    %esp,%ebp
+  8010a7:	57                   	push   %edi
+  8010a8:	56                   	push   %esi
+  8010a9:	53                   	push   %ebx
+  8010aa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010bd:	89 df                	mov    %ebx,%edi
+  8010bf:	89 de                	mov    %ebx,%esi
+  8010c1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	7f 08                	jg     8010cf <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  8010c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ca:	5b                   	pop    %ebx
+  8010cb:	5e                   	pop    %esi
+  8010cc:	5f                   	pop    %edi
+  8010cd:	5d                   	pop    %ebp
+  8010ce:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010cf:	83 ec 0c             	sub    $0xc,%esp
+  8010d2:	50                   	push   %eax
+  8010d3:	6a 0d                	push   $0xd
+  8010d5:	68 6b 40 80 00       	push   $0x80406b
+  8010da:	6a 23                	push   $0x23
+  8010dc:	68 88 40 80 00       	push   $0x804088
+  8010e1:	e8 a6 f1 ff ff       	call   80028c <_panic>
+
+008010e6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010f6:	89 d1                	mov    %edx,%ecx
+  8010f8:	89 d3                	mov    %edx,%ebx
+  8010fa:	89 d7                	mov    %edx,%edi
+  8010fc:	89 d6                	mov    %edx,%esi
+  8010fe:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+
+00801105 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80111b:	89 df                	mov    %ebx,%edi
+  80111d:	89 de                	mov    %ebx,%esi
+  80111f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  801121:	5b                   	pop    %ebx
+  801122:	5e                   	pop    %esi
+  801123:	5f                   	pop    %edi
+  801124:	5d                   	pop    %ebp
+  801125:	c3                   	ret
+
+00801126 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  801126:	55                   	push   %ebp
+  801127:	89 e5                	mov    %esp,%ebp
+  801129:	57                   	push   %edi
+  80112a:	56                   	push   %esi
+  80112b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	b8 10 00 00 00       	mov    $0x10,%eax
+  801139:	89 cb                	mov    %ecx,%ebx
+  80113b:	89 cf                	mov    %ecx,%edi
+  80113d:	89 ce                	mov    %ecx,%esi
+  80113f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801141:	5b                   	pop    %ebx
+  801142:	5e                   	pop    %esi
+  801143:	5f                   	pop    %edi
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80114c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 11 00 00 00       	mov    $0x11,%eax
+  80115c:	89 df                	mov    %ebx,%edi
+  80115e:	89 de                	mov    %ebx,%esi
+  801160:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 12 00 00 00       	mov    $0x12,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+
+00801188 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80118e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801193:	8b 55 08             	mov    0x8(%ebp),%edx
+  801196:	b8 13 00 00 00       	mov    $0x13,%eax
+  80119b:	89 cb                	mov    %ecx,%ebx
+  80119d:	89 cf                	mov    %ecx,%edi
+  80119f:	89 ce                	mov    %ecx,%esi
+  8011a1:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+
+008011a8 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  8011a8:	55                   	push   %ebp
+  8011a9:	89 e5                	mov    %esp,%ebp
+  8011ab:	57                   	push   %edi
+  8011ac:	56                   	push   %esi
+  8011ad:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b9:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011be:	89 df                	mov    %ebx,%edi
+  8011c0:	89 de                	mov    %ebx,%esi
+  8011c2:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5f                   	pop    %edi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+
+008011c9 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8011dc:	89 cb                	mov    %ecx,%ebx
+  8011de:	89 cf                	mov    %ecx,%edi
+  8011e0:	89 ce                	mov    %ecx,%esi
+  8011e2:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fa:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	89 f7                	mov    %esi,%edi
+  801204:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  801206:	5b                   	pop    %ebx
+  801207:	5e                   	pop    %esi
+  801208:	5f                   	pop    %edi
+  801209:	5d                   	pop    %ebp
+  80120a:	c3                   	ret
+
+0080120b <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801211:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801216:	8b 55 08             	mov    0x8(%ebp),%edx
+  801219:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801221:	89 df                	mov    %ebx,%edi
+  801223:	89 de                	mov    %ebx,%esi
+  801225:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  801227:	5b                   	pop    %ebx
+  801228:	5e                   	pop    %esi
+  801229:	5f                   	pop    %edi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+
+0080122c <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	57                   	push   %edi
+  801230:	56                   	push   %esi
+  801231:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801232:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80123f:	89 cb                	mov    %ecx,%ebx
+  801241:	89 cf                	mov    %ecx,%edi
+  801243:	89 ce                	mov    %ecx,%esi
+  801245:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801252:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801256:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801263:	89 df                	mov    %ebx,%edi
+  801265:	89 de                	mov    %ebx,%esi
+  801267:	cd 30                	int    $0x30
+}
+  801269:	5b                   	pop    %ebx
+  80126a:	5e                   	pop    %esi
+  80126b:	5f                   	pop    %edi
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801274:	be 00 00 00 00       	mov    $0x0,%esi
+  801279:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801284:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801287:	89 f7                	mov    %esi,%edi
+  801289:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80128b:	5b                   	pop    %ebx
+  80128c:	5e                   	pop    %esi
+  80128d:	5f                   	pop    %edi
+  80128e:	5d                   	pop    %ebp
+  80128f:	c3                   	ret
+
+00801290 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801290:	55                   	push   %ebp
+  801291:	89 e5                	mov    %esp,%ebp
+  801293:	57                   	push   %edi
+  801294:	56                   	push   %esi
+  801295:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801296:	be 00 00 00 00       	mov    $0x0,%esi
+  80129b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8012a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012a9:	89 f7                	mov    %esi,%edi
+  8012ab:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+
+008012b2 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  8012b2:	55                   	push   %ebp
+  8012b3:	89 e5                	mov    %esp,%ebp
+  8012b5:	57                   	push   %edi
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  8012c8:	89 df                	mov    %ebx,%edi
+  8012ca:	89 de                	mov    %ebx,%esi
+  8012cc:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012ce:	5b                   	pop    %ebx
+  8012cf:	5e                   	pop    %esi
+  8012d0:	5f                   	pop    %edi
+  8012d1:	5d                   	pop    %ebp
+  8012d2:	c3                   	ret
+
+008012d3 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	57                   	push   %edi
+  8012d7:	56                   	push   %esi
+  8012d8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8012de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8012e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012ec:	89 f7                	mov    %esi,%edi
+  8012ee:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8012f0:	5b                   	pop    %ebx
+  8012f1:	5e                   	pop    %esi
+  8012f2:	5f                   	pop    %edi
+  8012f3:	5d                   	pop    %ebp
+  8012f4:	c3                   	ret
+
+008012f5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012f5:	55                   	push   %ebp
+  8012f6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8012f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012fb:	05 00 00 00 30       	add    $0x30000000,%eax
+  801300:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+
+00801305 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801308:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130b:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801310:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801315:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  80131a:	5d                   	pop    %ebp
+  80131b:	c3                   	ret
+
+0080131c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80131c:	55                   	push   %ebp
+  80131d:	89 e5                	mov    %esp,%ebp
+  80131f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  801324:	89 c2                	mov    %eax,%edx
+  801326:	c1 ea 16             	shr    $0x16,%edx
+  801329:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801330:	f6 c2 01             	test   $0x1,%dl
+  801333:	74 29                	je     80135e <fd_alloc+0x42>
+  801335:	89 c2                	mov    %eax,%edx
+  801337:	c1 ea 0c             	shr    $0xc,%edx
+  80133a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801341:	f6 c2 01             	test   $0x1,%dl
+  801344:	74 18                	je     80135e <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801346:	05 00 10 00 00       	add    $0x1000,%eax
+  80134b:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801350:	75 d2                	jne    801324 <fd_alloc+0x8>
+  801352:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801357:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80135c:	eb 05                	jmp    801363 <fd_alloc+0x47>
+			return 0;
+  80135e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801363:	8b 55 08             	mov    0x8(%ebp),%edx
+  801366:	89 02                	mov    %eax,(%edx)
+}
+  801368:	89 c8                	mov    %ecx,%eax
+  80136a:	5d                   	pop    %ebp
+  80136b:	c3                   	ret
+
+0080136c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801372:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801377:	77 30                	ja     8013a9 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801379:	c1 e0 0c             	shl    $0xc,%eax
+  80137c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801381:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801387:	f6 c2 01             	test   $0x1,%dl
+  80138a:	74 24                	je     8013b0 <fd_lookup+0x44>
+  80138c:	89 c2                	mov    %eax,%edx
+  80138e:	c1 ea 0c             	shr    $0xc,%edx
+  801391:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801398:	f6 c2 01             	test   $0x1,%dl
+  80139b:	74 1a                	je     8013b7 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80139d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013a0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013a7:	5d                   	pop    %ebp
+  8013a8:	c3                   	ret
+		return -E_INVAL;
+  8013a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ae:	eb f7                	jmp    8013a7 <fd_lookup+0x3b>
+		return -E_INVAL;
+  8013b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b5:	eb f0                	jmp    8013a7 <fd_lookup+0x3b>
+  8013b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013bc:	eb e9                	jmp    8013a7 <fd_lookup+0x3b>
+
+008013be <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	53                   	push   %ebx
+  8013c2:	83 ec 04             	sub    $0x4,%esp
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013cd:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8013d2:	39 13                	cmp    %edx,(%ebx)
+  8013d4:	74 54                	je     80142a <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8013d6:	83 c0 01             	add    $0x1,%eax
+  8013d9:	8b 1c 85 14 41 80 00 	mov    0x804114(,%eax,4),%ebx
+  8013e0:	85 db                	test   %ebx,%ebx
+  8013e2:	75 ee                	jne    8013d2 <dev_lookup+0x14>
+  8013e4:	89 e1                	mov    %esp,%ecx
+  8013e6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8013eb:	29 c8                	sub    %ecx,%eax
+  8013ed:	89 c1                	mov    %eax,%ecx
+  8013ef:	c1 e9 0f             	shr    $0xf,%ecx
+  8013f2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8013f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fc:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013ff:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801406:	8b 40 48             	mov    0x48(%eax),%eax
+  801409:	83 ec 04             	sub    $0x4,%esp
+  80140c:	52                   	push   %edx
+  80140d:	50                   	push   %eax
+  80140e:	68 98 40 80 00       	push   $0x804098
+  801413:	e8 4f ef ff ff       	call   800367 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801420:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801423:	89 1a                	mov    %ebx,(%edx)
+}
+  801425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801428:	c9                   	leave
+  801429:	c3                   	ret
+			return 0;
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142f:	eb ef                	jmp    801420 <dev_lookup+0x62>
+
+00801431 <fd_close>:
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	56                   	push   %esi
+  801436:	53                   	push   %ebx
+  801437:	83 ec 24             	sub    $0x24,%esp
+  80143a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80143d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801440:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801443:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801444:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80144a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80144d:	50                   	push   %eax
+  80144e:	e8 19 ff ff ff       	call   80136c <fd_lookup>
+  801453:	89 c3                	mov    %eax,%ebx
+  801455:	83 c4 10             	add    $0x10,%esp
+  801458:	85 c0                	test   %eax,%eax
+  80145a:	78 05                	js     801461 <fd_close+0x30>
+	    || fd != fd2)
+  80145c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80145f:	74 0f                	je     801470 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801461:	85 ff                	test   %edi,%edi
+  801463:	0f 44 df             	cmove  %edi,%ebx
+}
+  801466:	89 d8                	mov    %ebx,%eax
+  801468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5f                   	pop    %edi
+  80146e:	5d                   	pop    %ebp
+  80146f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801470:	83 ec 08             	sub    $0x8,%esp
+  801473:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801476:	50                   	push   %eax
+  801477:	ff 36                	push   (%esi)
+  801479:	e8 40 ff ff ff       	call   8013be <dev_lookup>
+  80147e:	89 c3                	mov    %eax,%ebx
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	85 c0                	test   %eax,%eax
+  801485:	78 1a                	js     8014a1 <fd_close+0x70>
+		if (dev->dev_close)
+  801487:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80148a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80148d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801492:	85 c0                	test   %eax,%eax
+  801494:	74 0b                	je     8014a1 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801496:	83 ec 0c             	sub    $0xc,%esp
+  801499:	56                   	push   %esi
+  80149a:	ff d0                	call   *%eax
+  80149c:	89 c3                	mov    %eax,%ebx
+  80149e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014a1:	83 ec 08             	sub    $0x8,%esp
+  8014a4:	56                   	push   %esi
+  8014a5:	6a 00                	push   $0x0
+  8014a7:	e8 6b fa ff ff       	call   800f17 <sys_page_unmap>
+	return r;
+  8014ac:	83 c4 10             	add    $0x10,%esp
+  8014af:	eb b5                	jmp    801466 <fd_close+0x35>
+
+008014b1 <close>:
+
+int
+close(int fdnum)
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ba:	50                   	push   %eax
+  8014bb:	ff 75 08             	push   0x8(%ebp)
+  8014be:	e8 a9 fe ff ff       	call   80136c <fd_lookup>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	79 02                	jns    8014cc <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+		return fd_close(fd, 1);
+  8014cc:	83 ec 08             	sub    $0x8,%esp
+  8014cf:	6a 01                	push   $0x1
+  8014d1:	ff 75 f4             	push   -0xc(%ebp)
+  8014d4:	e8 58 ff ff ff       	call   801431 <fd_close>
+  8014d9:	83 c4 10             	add    $0x10,%esp
+  8014dc:	eb ec                	jmp    8014ca <close+0x19>
+
+008014de <close_all>:
+
+void
+close_all(void)
+{
+  8014de:	55                   	push   %ebp
+  8014df:	89 e5                	mov    %esp,%ebp
+  8014e1:	53                   	push   %ebx
+  8014e2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8014e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8014ea:	83 ec 0c             	sub    $0xc,%esp
+  8014ed:	53                   	push   %ebx
+  8014ee:	e8 be ff ff ff       	call   8014b1 <close>
+	for (i = 0; i < MAXFD; i++)
+  8014f3:	83 c3 01             	add    $0x1,%ebx
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8014ff:	75 e9                	jne    8014ea <close_all+0xc>
+}
+  801501:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801504:	c9                   	leave
+  801505:	c3                   	ret
+
+00801506 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801506:	55                   	push   %ebp
+  801507:	89 e5                	mov    %esp,%ebp
+  801509:	57                   	push   %edi
+  80150a:	56                   	push   %esi
+  80150b:	53                   	push   %ebx
+  80150c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80150f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801512:	50                   	push   %eax
+  801513:	ff 75 08             	push   0x8(%ebp)
+  801516:	e8 51 fe ff ff       	call   80136c <fd_lookup>
+  80151b:	89 c3                	mov    %eax,%ebx
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	78 7f                	js     8015a3 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801524:	83 ec 0c             	sub    $0xc,%esp
+  801527:	ff 75 0c             	push   0xc(%ebp)
+  80152a:	e8 82 ff ff ff       	call   8014b1 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  80152f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801532:	c1 e6 0c             	shl    $0xc,%esi
+  801535:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80153b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80153e:	89 3c 24             	mov    %edi,(%esp)
+  801541:	e8 bf fd ff ff       	call   801305 <fd2data>
+  801546:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801548:	89 34 24             	mov    %esi,(%esp)
+  80154b:	e8 b5 fd ff ff       	call   801305 <fd2data>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801556:	89 d8                	mov    %ebx,%eax
+  801558:	c1 e8 16             	shr    $0x16,%eax
+  80155b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801562:	a8 01                	test   $0x1,%al
+  801564:	74 11                	je     801577 <dup+0x71>
+  801566:	89 d8                	mov    %ebx,%eax
+  801568:	c1 e8 0c             	shr    $0xc,%eax
+  80156b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801572:	f6 c2 01             	test   $0x1,%dl
+  801575:	75 36                	jne    8015ad <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801577:	89 f8                	mov    %edi,%eax
+  801579:	c1 e8 0c             	shr    $0xc,%eax
+  80157c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801583:	83 ec 0c             	sub    $0xc,%esp
+  801586:	25 07 0e 00 00       	and    $0xe07,%eax
+  80158b:	50                   	push   %eax
+  80158c:	56                   	push   %esi
+  80158d:	6a 00                	push   $0x0
+  80158f:	57                   	push   %edi
+  801590:	6a 00                	push   $0x0
+  801592:	e8 3e f9 ff ff       	call   800ed5 <sys_page_map>
+  801597:	89 c3                	mov    %eax,%ebx
+  801599:	83 c4 20             	add    $0x20,%esp
+  80159c:	85 c0                	test   %eax,%eax
+  80159e:	78 33                	js     8015d3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015a3:	89 d8                	mov    %ebx,%eax
+  8015a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015a8:	5b                   	pop    %ebx
+  8015a9:	5e                   	pop    %esi
+  8015aa:	5f                   	pop    %edi
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015b4:	83 ec 0c             	sub    $0xc,%esp
+  8015b7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015bc:	50                   	push   %eax
+  8015bd:	ff 75 d4             	push   -0x2c(%ebp)
+  8015c0:	6a 00                	push   $0x0
+  8015c2:	53                   	push   %ebx
+  8015c3:	6a 00                	push   $0x0
+  8015c5:	e8 0b f9 ff ff       	call   800ed5 <sys_page_map>
+  8015ca:	89 c3                	mov    %eax,%ebx
+  8015cc:	83 c4 20             	add    $0x20,%esp
+  8015cf:	85 c0                	test   %eax,%eax
+  8015d1:	79 a4                	jns    801577 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8015d3:	83 ec 08             	sub    $0x8,%esp
+  8015d6:	56                   	push   %esi
+  8015d7:	6a 00                	push   $0x0
+  8015d9:	e8 39 f9 ff ff       	call   800f17 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8015de:	83 c4 08             	add    $0x8,%esp
+  8015e1:	ff 75 d4             	push   -0x2c(%ebp)
+  8015e4:	6a 00                	push   $0x0
+  8015e6:	e8 2c f9 ff ff       	call   800f17 <sys_page_unmap>
+	return r;
+  8015eb:	83 c4 10             	add    $0x10,%esp
+  8015ee:	eb b3                	jmp    8015a3 <dup+0x9d>
+
+008015f0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015f0:	55                   	push   %ebp
+  8015f1:	89 e5                	mov    %esp,%ebp
+  8015f3:	56                   	push   %esi
+  8015f4:	53                   	push   %ebx
+  8015f5:	83 ec 18             	sub    $0x18,%esp
+  8015f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015fb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015fe:	50                   	push   %eax
+  8015ff:	53                   	push   %ebx
+  801600:	e8 67 fd ff ff       	call   80136c <fd_lookup>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	78 3c                	js     801648 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80160c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80160f:	83 ec 08             	sub    $0x8,%esp
+  801612:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	ff 36                	push   (%esi)
+  801618:	e8 a1 fd ff ff       	call   8013be <dev_lookup>
+  80161d:	83 c4 10             	add    $0x10,%esp
+  801620:	85 c0                	test   %eax,%eax
+  801622:	78 24                	js     801648 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801624:	8b 46 08             	mov    0x8(%esi),%eax
+  801627:	83 e0 03             	and    $0x3,%eax
+  80162a:	83 f8 01             	cmp    $0x1,%eax
+  80162d:	74 20                	je     80164f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  80162f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801632:	8b 40 08             	mov    0x8(%eax),%eax
+  801635:	85 c0                	test   %eax,%eax
+  801637:	74 54                	je     80168d <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801639:	83 ec 04             	sub    $0x4,%esp
+  80163c:	ff 75 10             	push   0x10(%ebp)
+  80163f:	ff 75 0c             	push   0xc(%ebp)
+  801642:	56                   	push   %esi
+  801643:	ff d0                	call   *%eax
+  801645:	83 c4 10             	add    $0x10,%esp
+}
+  801648:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164b:	5b                   	pop    %ebx
+  80164c:	5e                   	pop    %esi
+  80164d:	5d                   	pop    %ebp
+  80164e:	c3                   	ret
+  80164f:	89 e2                	mov    %esp,%edx
+  801651:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801656:	29 d0                	sub    %edx,%eax
+  801658:	89 c2                	mov    %eax,%edx
+  80165a:	c1 ea 0f             	shr    $0xf,%edx
+  80165d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801662:	b8 00 00 00 00       	mov    $0x0,%eax
+  801667:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80166a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801671:	8b 40 48             	mov    0x48(%eax),%eax
+  801674:	83 ec 04             	sub    $0x4,%esp
+  801677:	53                   	push   %ebx
+  801678:	50                   	push   %eax
+  801679:	68 d9 40 80 00       	push   $0x8040d9
+  80167e:	e8 e4 ec ff ff       	call   800367 <cprintf>
+		return -E_INVAL;
+  801683:	83 c4 10             	add    $0x10,%esp
+  801686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80168b:	eb bb                	jmp    801648 <read+0x58>
+		return -E_NOT_SUPP;
+  80168d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801692:	eb b4                	jmp    801648 <read+0x58>
+
+00801694 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	57                   	push   %edi
+  801698:	56                   	push   %esi
+  801699:	53                   	push   %ebx
+  80169a:	83 ec 0c             	sub    $0xc,%esp
+  80169d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8016a0:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016a3:	85 f6                	test   %esi,%esi
+  8016a5:	74 30                	je     8016d7 <readn+0x43>
+  8016a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ac:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016b1:	83 ec 04             	sub    $0x4,%esp
+  8016b4:	89 f2                	mov    %esi,%edx
+  8016b6:	29 c2                	sub    %eax,%edx
+  8016b8:	52                   	push   %edx
+  8016b9:	01 f8                	add    %edi,%eax
+  8016bb:	50                   	push   %eax
+  8016bc:	ff 75 08             	push   0x8(%ebp)
+  8016bf:	e8 2c ff ff ff       	call   8015f0 <read>
+		if (m < 0)
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	85 c0                	test   %eax,%eax
+  8016c9:	78 15                	js     8016e0 <readn+0x4c>
+			return m;
+		if (m == 0)
+  8016cb:	74 11                	je     8016de <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  8016cd:	01 c3                	add    %eax,%ebx
+  8016cf:	89 d8                	mov    %ebx,%eax
+  8016d1:	39 f3                	cmp    %esi,%ebx
+  8016d3:	72 dc                	jb     8016b1 <readn+0x1d>
+  8016d5:	eb 09                	jmp    8016e0 <readn+0x4c>
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	eb 02                	jmp    8016e0 <readn+0x4c>
+  8016de:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8016e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5f                   	pop    %edi
+  8016e6:	5d                   	pop    %ebp
+  8016e7:	c3                   	ret
+
+008016e8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016e8:	55                   	push   %ebp
+  8016e9:	89 e5                	mov    %esp,%ebp
+  8016eb:	56                   	push   %esi
+  8016ec:	53                   	push   %ebx
+  8016ed:	83 ec 18             	sub    $0x18,%esp
+  8016f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f6:	50                   	push   %eax
+  8016f7:	53                   	push   %ebx
+  8016f8:	e8 6f fc ff ff       	call   80136c <fd_lookup>
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 37                	js     80173b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801704:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801707:	83 ec 08             	sub    $0x8,%esp
+  80170a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170d:	50                   	push   %eax
+  80170e:	ff 36                	push   (%esi)
+  801710:	e8 a9 fc ff ff       	call   8013be <dev_lookup>
+  801715:	83 c4 10             	add    $0x10,%esp
+  801718:	85 c0                	test   %eax,%eax
+  80171a:	78 1f                	js     80173b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80171c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801720:	74 20                	je     801742 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801725:	8b 40 0c             	mov    0xc(%eax),%eax
+  801728:	85 c0                	test   %eax,%eax
+  80172a:	74 54                	je     801780 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80172c:	83 ec 04             	sub    $0x4,%esp
+  80172f:	ff 75 10             	push   0x10(%ebp)
+  801732:	ff 75 0c             	push   0xc(%ebp)
+  801735:	56                   	push   %esi
+  801736:	ff d0                	call   *%eax
+  801738:	83 c4 10             	add    $0x10,%esp
+}
+  80173b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80173e:	5b                   	pop    %ebx
+  80173f:	5e                   	pop    %esi
+  801740:	5d                   	pop    %ebp
+  801741:	c3                   	ret
+  801742:	89 e2                	mov    %esp,%edx
+  801744:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801749:	29 d0                	sub    %edx,%eax
+  80174b:	89 c2                	mov    %eax,%edx
+  80174d:	c1 ea 0f             	shr    $0xf,%edx
+  801750:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80175d:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801764:	8b 40 48             	mov    0x48(%eax),%eax
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	53                   	push   %ebx
+  80176b:	50                   	push   %eax
+  80176c:	68 f5 40 80 00       	push   $0x8040f5
+  801771:	e8 f1 eb ff ff       	call   800367 <cprintf>
+		return -E_INVAL;
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177e:	eb bb                	jmp    80173b <write+0x53>
+		return -E_NOT_SUPP;
+  801780:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801785:	eb b4                	jmp    80173b <write+0x53>
+
+00801787 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80178d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801790:	50                   	push   %eax
+  801791:	ff 75 08             	push   0x8(%ebp)
+  801794:	e8 d3 fb ff ff       	call   80136c <fd_lookup>
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	78 0e                	js     8017ae <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8017a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a6:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8017a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ae:	c9                   	leave
+  8017af:	c3                   	ret
+
+008017b0 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  8017b0:	55                   	push   %ebp
+  8017b1:	89 e5                	mov    %esp,%ebp
+  8017b3:	53                   	push   %ebx
+  8017b4:	83 ec 1c             	sub    $0x1c,%esp
+  8017b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017ba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017bd:	50                   	push   %eax
+  8017be:	ff 75 08             	push   0x8(%ebp)
+  8017c1:	e8 a6 fb ff ff       	call   80136c <fd_lookup>
+  8017c6:	83 c4 10             	add    $0x10,%esp
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 33                	js     801800 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  8017cd:	83 fb 03             	cmp    $0x3,%ebx
+  8017d0:	74 28                	je     8017fa <fcntl+0x4a>
+  8017d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d7:	83 fb 04             	cmp    $0x4,%ebx
+  8017da:	75 24                	jne    801800 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8017dc:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8017df:	8b 41 08             	mov    0x8(%ecx),%eax
+  8017e2:	80 e4 ef             	and    $0xef,%ah
+  8017e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8017e8:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8017ee:	09 d0                	or     %edx,%eax
+  8017f0:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8017f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f8:	eb 06                	jmp    801800 <fcntl+0x50>
+		return fd->fd_omode;
+  8017fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fd:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  801800:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801803:	c9                   	leave
+  801804:	c3                   	ret
+
+00801805 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	56                   	push   %esi
+  801809:	53                   	push   %ebx
+  80180a:	83 ec 18             	sub    $0x18,%esp
+  80180d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801810:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801813:	50                   	push   %eax
+  801814:	53                   	push   %ebx
+  801815:	e8 52 fb ff ff       	call   80136c <fd_lookup>
+  80181a:	83 c4 10             	add    $0x10,%esp
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	78 34                	js     801855 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801821:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801824:	83 ec 08             	sub    $0x8,%esp
+  801827:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182a:	50                   	push   %eax
+  80182b:	ff 36                	push   (%esi)
+  80182d:	e8 8c fb ff ff       	call   8013be <dev_lookup>
+  801832:	83 c4 10             	add    $0x10,%esp
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 1c                	js     801855 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801839:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80183d:	74 1d                	je     80185c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80183f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801842:	8b 40 18             	mov    0x18(%eax),%eax
+  801845:	85 c0                	test   %eax,%eax
+  801847:	74 51                	je     80189a <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801849:	83 ec 08             	sub    $0x8,%esp
+  80184c:	ff 75 0c             	push   0xc(%ebp)
+  80184f:	56                   	push   %esi
+  801850:	ff d0                	call   *%eax
+  801852:	83 c4 10             	add    $0x10,%esp
+}
+  801855:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5d                   	pop    %ebp
+  80185b:	c3                   	ret
+  80185c:	89 e2                	mov    %esp,%edx
+  80185e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801863:	29 d0                	sub    %edx,%eax
+  801865:	89 c2                	mov    %eax,%edx
+  801867:	c1 ea 0f             	shr    $0xf,%edx
+  80186a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80186f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801874:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801877:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80187e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801881:	83 ec 04             	sub    $0x4,%esp
+  801884:	53                   	push   %ebx
+  801885:	50                   	push   %eax
+  801886:	68 b8 40 80 00       	push   $0x8040b8
+  80188b:	e8 d7 ea ff ff       	call   800367 <cprintf>
+		return -E_INVAL;
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801898:	eb bb                	jmp    801855 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80189a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80189f:	eb b4                	jmp    801855 <ftruncate+0x50>
+
+008018a1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018a1:	55                   	push   %ebp
+  8018a2:	89 e5                	mov    %esp,%ebp
+  8018a4:	56                   	push   %esi
+  8018a5:	53                   	push   %ebx
+  8018a6:	83 ec 18             	sub    $0x18,%esp
+  8018a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018af:	50                   	push   %eax
+  8018b0:	ff 75 08             	push   0x8(%ebp)
+  8018b3:	e8 b4 fa ff ff       	call   80136c <fd_lookup>
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	78 53                	js     801912 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018bf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c2:	83 ec 08             	sub    $0x8,%esp
+  8018c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c8:	50                   	push   %eax
+  8018c9:	ff 36                	push   (%esi)
+  8018cb:	e8 ee fa ff ff       	call   8013be <dev_lookup>
+  8018d0:	83 c4 10             	add    $0x10,%esp
+  8018d3:	85 c0                	test   %eax,%eax
+  8018d5:	78 3b                	js     801912 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8018d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018da:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018de:	74 39                	je     801919 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8018e0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8018e3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018ea:	00 00 00 
+	stat->st_isdir = 0;
+  8018ed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018f4:	00 00 00 
+	stat->st_version = 0;
+  8018f7:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8018fe:	00 00 00 
+	stat->st_dev = dev;
+  801901:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801907:	83 ec 08             	sub    $0x8,%esp
+  80190a:	53                   	push   %ebx
+  80190b:	56                   	push   %esi
+  80190c:	ff 50 14             	call   *0x14(%eax)
+  80190f:	83 c4 10             	add    $0x10,%esp
+}
+  801912:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801915:	5b                   	pop    %ebx
+  801916:	5e                   	pop    %esi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+		return -E_NOT_SUPP;
+  801919:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80191e:	eb f2                	jmp    801912 <fstat+0x71>
+
+00801920 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801920:	55                   	push   %ebp
+  801921:	89 e5                	mov    %esp,%ebp
+  801923:	56                   	push   %esi
+  801924:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801925:	83 ec 08             	sub    $0x8,%esp
+  801928:	6a 00                	push   $0x0
+  80192a:	ff 75 08             	push   0x8(%ebp)
+  80192d:	e8 b7 01 00 00       	call   801ae9 <open>
+  801932:	89 c3                	mov    %eax,%ebx
+  801934:	83 c4 10             	add    $0x10,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 1b                	js     801956 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80193b:	83 ec 08             	sub    $0x8,%esp
+  80193e:	ff 75 0c             	push   0xc(%ebp)
+  801941:	50                   	push   %eax
+  801942:	e8 5a ff ff ff       	call   8018a1 <fstat>
+  801947:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801949:	89 1c 24             	mov    %ebx,(%esp)
+  80194c:	e8 60 fb ff ff       	call   8014b1 <close>
+	return r;
+  801951:	83 c4 10             	add    $0x10,%esp
+  801954:	89 f3                	mov    %esi,%ebx
+}
+  801956:	89 d8                	mov    %ebx,%eax
+  801958:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80195b:	5b                   	pop    %ebx
+  80195c:	5e                   	pop    %esi
+  80195d:	5d                   	pop    %ebp
+  80195e:	c3                   	ret
+
+0080195f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80195f:	55                   	push   %ebp
+  801960:	89 e5                	mov    %esp,%ebp
+  801962:	56                   	push   %esi
+  801963:	53                   	push   %ebx
+  801964:	89 c6                	mov    %eax,%esi
+  801966:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801968:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80196f:	74 27                	je     801998 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801971:	6a 07                	push   $0x7
+  801973:	68 00 70 80 00       	push   $0x807000
+  801978:	56                   	push   %esi
+  801979:	ff 35 00 60 80 00    	push   0x806000
+  80197f:	e8 d9 1f 00 00       	call   80395d <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801984:	83 c4 0c             	add    $0xc,%esp
+  801987:	6a 00                	push   $0x0
+  801989:	53                   	push   %ebx
+  80198a:	6a 00                	push   $0x0
+  80198c:	e8 3c 1d 00 00       	call   8036cd <ipc_recv>
+}
+  801991:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801994:	5b                   	pop    %ebx
+  801995:	5e                   	pop    %esi
+  801996:	5d                   	pop    %ebp
+  801997:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801998:	83 ec 0c             	sub    $0xc,%esp
+  80199b:	6a 02                	push   $0x2
+  80199d:	e8 24 20 00 00       	call   8039c6 <ipc_find_env>
+  8019a2:	a3 00 60 80 00       	mov    %eax,0x806000
+  8019a7:	83 c4 10             	add    $0x10,%esp
+  8019aa:	eb c5                	jmp    801971 <fsipc+0x12>
+
+008019ac <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019ac:	55                   	push   %ebp
+  8019ad:	89 e5                	mov    %esp,%ebp
+  8019af:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  8019bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c0:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019cf:	e8 8b ff ff ff       	call   80195f <fsipc>
+}
+  8019d4:	c9                   	leave
+  8019d5:	c3                   	ret
+
+008019d6 <devfile_flush>:
+{
+  8019d6:	55                   	push   %ebp
+  8019d7:	89 e5                	mov    %esp,%ebp
+  8019d9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019df:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e2:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8019e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ec:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019f1:	e8 69 ff ff ff       	call   80195f <fsipc>
+}
+  8019f6:	c9                   	leave
+  8019f7:	c3                   	ret
+
+008019f8 <devfile_stat>:
+{
+  8019f8:	55                   	push   %ebp
+  8019f9:	89 e5                	mov    %esp,%ebp
+  8019fb:	53                   	push   %ebx
+  8019fc:	83 ec 04             	sub    $0x4,%esp
+  8019ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a05:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a08:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a12:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a17:	e8 43 ff ff ff       	call   80195f <fsipc>
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 37                	js     801a57 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a20:	83 ec 08             	sub    $0x8,%esp
+  801a23:	68 00 70 80 00       	push   $0x807000
+  801a28:	53                   	push   %ebx
+  801a29:	e8 30 f0 ff ff       	call   800a5e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a2e:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a33:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a39:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a3e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801a44:	a1 88 70 80 00       	mov    0x807088,%eax
+  801a49:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a5a:	c9                   	leave
+  801a5b:	c3                   	ret
+
+00801a5c <devfile_write>:
+{
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	83 ec 0c             	sub    $0xc,%esp
+  801a62:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801a65:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801a6a:	39 d0                	cmp    %edx,%eax
+  801a6c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801a6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a72:	8b 52 0c             	mov    0xc(%edx),%edx
+  801a75:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  801a7b:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801a80:	50                   	push   %eax
+  801a81:	ff 75 0c             	push   0xc(%ebp)
+  801a84:	68 08 70 80 00       	push   $0x807008
+  801a89:	e8 80 f1 ff ff       	call   800c0e <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  801a8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a93:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a98:	e8 c2 fe ff ff       	call   80195f <fsipc>
+}
+  801a9d:	c9                   	leave
+  801a9e:	c3                   	ret
+
+00801a9f <devfile_read>:
+{
+  801a9f:	55                   	push   %ebp
+  801aa0:	89 e5                	mov    %esp,%ebp
+  801aa2:	53                   	push   %ebx
+  801aa3:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aac:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801ab1:	8b 45 10             	mov    0x10(%ebp),%eax
+  801ab4:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801ab9:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801abe:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ac3:	e8 97 fe ff ff       	call   80195f <fsipc>
+  801ac8:	89 c3                	mov    %eax,%ebx
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	78 14                	js     801ae2 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  801ace:	83 ec 04             	sub    $0x4,%esp
+  801ad1:	50                   	push   %eax
+  801ad2:	68 00 70 80 00       	push   $0x807000
+  801ad7:	ff 75 0c             	push   0xc(%ebp)
+  801ada:	e8 2f f1 ff ff       	call   800c0e <memmove>
+	return r;
+  801adf:	83 c4 10             	add    $0x10,%esp
+}
+  801ae2:	89 d8                	mov    %ebx,%eax
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+00801ae9 <open>:
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	53                   	push   %ebx
+  801aed:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  801af0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801af3:	50                   	push   %eax
+  801af4:	e8 23 f8 ff ff       	call   80131c <fd_alloc>
+  801af9:	89 c3                	mov    %eax,%ebx
+  801afb:	83 c4 10             	add    $0x10,%esp
+  801afe:	85 c0                	test   %eax,%eax
+  801b00:	78 2a                	js     801b2c <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  801b02:	83 ec 0c             	sub    $0xc,%esp
+  801b05:	ff 75 08             	push   0x8(%ebp)
+  801b08:	e8 05 ef ff ff       	call   800a12 <strlen>
+  801b0d:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  801b10:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  801b15:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b1a:	7e 17                	jle    801b33 <open+0x4a>
+	fd_close(fd, 1);
+  801b1c:	83 ec 08             	sub    $0x8,%esp
+  801b1f:	6a 01                	push   $0x1
+  801b21:	ff 75 f4             	push   -0xc(%ebp)
+  801b24:	e8 08 f9 ff ff       	call   801431 <fd_close>
+	return r;
+  801b29:	83 c4 10             	add    $0x10,%esp
+}
+  801b2c:	89 d8                	mov    %ebx,%eax
+  801b2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b31:	c9                   	leave
+  801b32:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801b33:	83 ec 08             	sub    $0x8,%esp
+  801b36:	ff 75 08             	push   0x8(%ebp)
+  801b39:	68 00 70 80 00       	push   $0x807000
+  801b3e:	e8 1b ef ff ff       	call   800a5e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801b43:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b46:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801b4b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801b4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b53:	e8 07 fe ff ff       	call   80195f <fsipc>
+  801b58:	89 c3                	mov    %eax,%ebx
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 bb                	js     801b1c <open+0x33>
+	return fd2num(fd); 	
+  801b61:	83 ec 0c             	sub    $0xc,%esp
+  801b64:	ff 75 f4             	push   -0xc(%ebp)
+  801b67:	e8 89 f7 ff ff       	call   8012f5 <fd2num>
+  801b6c:	89 c3                	mov    %eax,%ebx
+  801b6e:	83 c4 10             	add    $0x10,%esp
+  801b71:	eb b9                	jmp    801b2c <open+0x43>
+
+00801b73 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801b73:	55                   	push   %ebp
+  801b74:	89 e5                	mov    %esp,%ebp
+  801b76:	53                   	push   %ebx
+  801b77:	83 ec 1c             	sub    $0x1c,%esp
+  801b7a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b80:	50                   	push   %eax
+  801b81:	ff 75 08             	push   0x8(%ebp)
+  801b84:	e8 e3 f7 ff ff       	call   80136c <fd_lookup>
+  801b89:	83 c4 10             	add    $0x10,%esp
+  801b8c:	85 c0                	test   %eax,%eax
+  801b8e:	78 5a                	js     801bea <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801b90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b93:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801b99:	39 10                	cmp    %edx,(%eax)
+  801b9b:	75 66                	jne    801c03 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801b9d:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801ba4:	74 49                	je     801bef <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801ba6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bac:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801bb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bb4:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801bb9:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801bbf:	6a 07                	push   $0x7
+  801bc1:	68 00 70 80 00       	push   $0x807000
+  801bc6:	6a 09                	push   $0x9
+  801bc8:	ff 35 00 60 80 00    	push   0x806000
+  801bce:	e8 8a 1d 00 00       	call   80395d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801bd3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801bda:	6a 00                	push   $0x0
+  801bdc:	53                   	push   %ebx
+  801bdd:	ff 75 10             	push   0x10(%ebp)
+  801be0:	6a 00                	push   $0x0
+  801be2:	e8 b3 1b 00 00       	call   80379a <ipc_recv_pages>
+  801be7:	83 c4 20             	add    $0x20,%esp
+}
+  801bea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bef:	83 ec 0c             	sub    $0xc,%esp
+  801bf2:	6a 02                	push   $0x2
+  801bf4:	e8 cd 1d 00 00       	call   8039c6 <ipc_find_env>
+  801bf9:	a3 00 60 80 00       	mov    %eax,0x806000
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	eb a3                	jmp    801ba6 <fmap+0x33>
+		return -E_INVAL;
+  801c03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c08:	eb e0                	jmp    801bea <fmap+0x77>
+
+00801c0a <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	53                   	push   %ebx
+  801c0e:	83 ec 10             	sub    $0x10,%esp
+  801c11:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801c14:	53                   	push   %ebx
+  801c15:	e8 f8 ed ff ff       	call   800a12 <strlen>
+  801c1a:	83 c4 10             	add    $0x10,%esp
+  801c1d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c22:	7f 25                	jg     801c49 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c24:	83 ec 08             	sub    $0x8,%esp
+  801c27:	53                   	push   %ebx
+  801c28:	68 00 70 80 00       	push   $0x807000
+  801c2d:	e8 2c ee ff ff       	call   800a5e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c37:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c3c:	e8 1e fd ff ff       	call   80195f <fsipc>
+  801c41:	83 c4 10             	add    $0x10,%esp
+}
+  801c44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c47:	c9                   	leave
+  801c48:	c3                   	ret
+		return -E_BAD_PATH;
+  801c49:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c4e:	eb f4                	jmp    801c44 <remove+0x3a>
+
+00801c50 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c50:	55                   	push   %ebp
+  801c51:	89 e5                	mov    %esp,%ebp
+  801c53:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c60:	e8 fa fc ff ff       	call   80195f <fsipc>
+}
+  801c65:	c9                   	leave
+  801c66:	c3                   	ret
+
+00801c67 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801c6d:	68 28 41 80 00       	push   $0x804128
+  801c72:	ff 75 0c             	push   0xc(%ebp)
+  801c75:	e8 e4 ed ff ff       	call   800a5e <strcpy>
+	return 0;
+}
+  801c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7f:	c9                   	leave
+  801c80:	c3                   	ret
+
+00801c81 <devsock_close>:
+{
+  801c81:	55                   	push   %ebp
+  801c82:	89 e5                	mov    %esp,%ebp
+  801c84:	53                   	push   %ebx
+  801c85:	83 ec 10             	sub    $0x10,%esp
+  801c88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801c8b:	53                   	push   %ebx
+  801c8c:	e8 74 1d 00 00       	call   803a05 <pageref>
+  801c91:	89 c2                	mov    %eax,%edx
+  801c93:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c96:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801c9b:	83 fa 01             	cmp    $0x1,%edx
+  801c9e:	74 05                	je     801ca5 <devsock_close+0x24>
+}
+  801ca0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca3:	c9                   	leave
+  801ca4:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801ca5:	83 ec 0c             	sub    $0xc,%esp
+  801ca8:	ff 73 0c             	push   0xc(%ebx)
+  801cab:	e8 b0 05 00 00       	call   802260 <nsipc_close>
+  801cb0:	83 c4 10             	add    $0x10,%esp
+  801cb3:	eb eb                	jmp    801ca0 <devsock_close+0x1f>
+
+00801cb5 <devsock_write>:
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	53                   	push   %ebx
+  801cb9:	83 ec 14             	sub    $0x14,%esp
+  801cbc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801cbf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801cc2:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801cc5:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801cc8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801ccb:	8b 41 08             	mov    0x8(%ecx),%eax
+  801cce:	c1 f8 09             	sar    $0x9,%eax
+  801cd1:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801cd4:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801cda:	77 13                	ja     801cef <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801cdc:	50                   	push   %eax
+  801cdd:	52                   	push   %edx
+  801cde:	53                   	push   %ebx
+  801cdf:	ff 71 0c             	push   0xc(%ecx)
+  801ce2:	e8 5c 06 00 00       	call   802343 <nsipc_send>
+  801ce7:	83 c4 10             	add    $0x10,%esp
+}
+  801cea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ced:	c9                   	leave
+  801cee:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801cef:	50                   	push   %eax
+  801cf0:	6a 01                	push   $0x1
+  801cf2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cf5:	50                   	push   %eax
+  801cf6:	ff 71 0c             	push   0xc(%ecx)
+  801cf9:	e8 a6 06 00 00       	call   8023a4 <nsipc_sendmsg>
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	eb e7                	jmp    801cea <devsock_write+0x35>
+
+00801d03 <devsock_read>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	53                   	push   %ebx
+  801d07:	83 ec 14             	sub    $0x14,%esp
+  801d0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801d0d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801d10:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801d13:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801d16:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801d19:	8b 41 08             	mov    0x8(%ecx),%eax
+  801d1c:	c1 f8 09             	sar    $0x9,%eax
+  801d1f:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801d22:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801d28:	77 13                	ja     801d3d <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801d2a:	50                   	push   %eax
+  801d2b:	52                   	push   %edx
+  801d2c:	53                   	push   %ebx
+  801d2d:	ff 71 0c             	push   0xc(%ecx)
+  801d30:	e8 9c 05 00 00       	call   8022d1 <nsipc_recv>
+  801d35:	83 c4 10             	add    $0x10,%esp
+}
+  801d38:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d3b:	c9                   	leave
+  801d3c:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801d3d:	50                   	push   %eax
+  801d3e:	6a 01                	push   $0x1
+  801d40:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d43:	50                   	push   %eax
+  801d44:	ff 71 0c             	push   0xc(%ecx)
+  801d47:	e8 02 0a 00 00       	call   80274e <nsipc_recvmsg>
+  801d4c:	83 c4 10             	add    $0x10,%esp
+  801d4f:	eb e7                	jmp    801d38 <devsock_read+0x35>
+
+00801d51 <fd2sockid>:
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801d57:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d5a:	52                   	push   %edx
+  801d5b:	50                   	push   %eax
+  801d5c:	e8 0b f6 ff ff       	call   80136c <fd_lookup>
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	85 c0                	test   %eax,%eax
+  801d66:	78 10                	js     801d78 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801d68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d6b:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801d71:	39 08                	cmp    %ecx,(%eax)
+  801d73:	75 05                	jne    801d7a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801d75:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801d78:	c9                   	leave
+  801d79:	c3                   	ret
+		return -E_NOT_SUPP;
+  801d7a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d7f:	eb f7                	jmp    801d78 <fd2sockid+0x27>
+
+00801d81 <sock_flags>:
+{
+  801d81:	55                   	push   %ebp
+  801d82:	89 e5                	mov    %esp,%ebp
+  801d84:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801d87:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801d8a:	52                   	push   %edx
+  801d8b:	50                   	push   %eax
+  801d8c:	e8 db f5 ff ff       	call   80136c <fd_lookup>
+  801d91:	83 c4 10             	add    $0x10,%esp
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	78 0e                	js     801da6 <sock_flags+0x25>
+  801d98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d9b:	8b 40 08             	mov    0x8(%eax),%eax
+  801d9e:	c1 e8 09             	shr    $0x9,%eax
+  801da1:	83 e0 08             	and    $0x8,%eax
+}
+  801da4:	c9                   	leave
+  801da5:	c3                   	ret
+		return 0;
+  801da6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dab:	eb f7                	jmp    801da4 <sock_flags+0x23>
+
+00801dad <alloc_sockfd>:
+{
+  801dad:	55                   	push   %ebp
+  801dae:	89 e5                	mov    %esp,%ebp
+  801db0:	56                   	push   %esi
+  801db1:	53                   	push   %ebx
+  801db2:	83 ec 1c             	sub    $0x1c,%esp
+  801db5:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801db7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dba:	50                   	push   %eax
+  801dbb:	e8 5c f5 ff ff       	call   80131c <fd_alloc>
+  801dc0:	89 c3                	mov    %eax,%ebx
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 43                	js     801e0c <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801dc9:	83 ec 04             	sub    $0x4,%esp
+  801dcc:	68 07 04 00 00       	push   $0x407
+  801dd1:	ff 75 f4             	push   -0xc(%ebp)
+  801dd4:	6a 00                	push   $0x0
+  801dd6:	e8 b7 f0 ff ff       	call   800e92 <sys_page_alloc>
+  801ddb:	89 c3                	mov    %eax,%ebx
+  801ddd:	83 c4 10             	add    $0x10,%esp
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	78 28                	js     801e0c <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801de4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de7:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801ded:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801def:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801df2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801df9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801dfc:	83 ec 0c             	sub    $0xc,%esp
+  801dff:	50                   	push   %eax
+  801e00:	e8 f0 f4 ff ff       	call   8012f5 <fd2num>
+  801e05:	89 c3                	mov    %eax,%ebx
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	eb 0c                	jmp    801e18 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801e0c:	83 ec 0c             	sub    $0xc,%esp
+  801e0f:	56                   	push   %esi
+  801e10:	e8 4b 04 00 00       	call   802260 <nsipc_close>
+		return r;
+  801e15:	83 c4 10             	add    $0x10,%esp
+}
+  801e18:	89 d8                	mov    %ebx,%eax
+  801e1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1d:	5b                   	pop    %ebx
+  801e1e:	5e                   	pop    %esi
+  801e1f:	5d                   	pop    %ebp
+  801e20:	c3                   	ret
+
+00801e21 <accept>:
+{
+  801e21:	55                   	push   %ebp
+  801e22:	89 e5                	mov    %esp,%ebp
+  801e24:	56                   	push   %esi
+  801e25:	53                   	push   %ebx
+  801e26:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e29:	89 f0                	mov    %esi,%eax
+  801e2b:	e8 21 ff ff ff       	call   801d51 <fd2sockid>
+  801e30:	89 c3                	mov    %eax,%ebx
+  801e32:	85 c0                	test   %eax,%eax
+  801e34:	78 24                	js     801e5a <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801e36:	89 f0                	mov    %esi,%eax
+  801e38:	e8 44 ff ff ff       	call   801d81 <sock_flags>
+  801e3d:	50                   	push   %eax
+  801e3e:	ff 75 10             	push   0x10(%ebp)
+  801e41:	ff 75 0c             	push   0xc(%ebp)
+  801e44:	53                   	push   %ebx
+  801e45:	e8 6b 03 00 00       	call   8021b5 <nsipc_accept>
+  801e4a:	89 c3                	mov    %eax,%ebx
+  801e4c:	83 c4 10             	add    $0x10,%esp
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 07                	js     801e5a <accept+0x39>
+	return alloc_sockfd(r);
+  801e53:	e8 55 ff ff ff       	call   801dad <alloc_sockfd>
+  801e58:	89 c3                	mov    %eax,%ebx
+}
+  801e5a:	89 d8                	mov    %ebx,%eax
+  801e5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5d                   	pop    %ebp
+  801e62:	c3                   	ret
+
+00801e63 <bind>:
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e6c:	e8 e0 fe ff ff       	call   801d51 <fd2sockid>
+  801e71:	85 c0                	test   %eax,%eax
+  801e73:	78 12                	js     801e87 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801e75:	83 ec 04             	sub    $0x4,%esp
+  801e78:	ff 75 10             	push   0x10(%ebp)
+  801e7b:	ff 75 0c             	push   0xc(%ebp)
+  801e7e:	50                   	push   %eax
+  801e7f:	e8 85 03 00 00       	call   802209 <nsipc_bind>
+  801e84:	83 c4 10             	add    $0x10,%esp
+}
+  801e87:	c9                   	leave
+  801e88:	c3                   	ret
+
+00801e89 <shutdown>:
+{
+  801e89:	55                   	push   %ebp
+  801e8a:	89 e5                	mov    %esp,%ebp
+  801e8c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801e8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e92:	e8 ba fe ff ff       	call   801d51 <fd2sockid>
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 0f                	js     801eaa <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+  801e9e:	ff 75 0c             	push   0xc(%ebp)
+  801ea1:	50                   	push   %eax
+  801ea2:	e8 97 03 00 00       	call   80223e <nsipc_shutdown>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+}
+  801eaa:	c9                   	leave
+  801eab:	c3                   	ret
+
+00801eac <connect>:
+{
+  801eac:	55                   	push   %ebp
+  801ead:	89 e5                	mov    %esp,%ebp
+  801eaf:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb5:	e8 97 fe ff ff       	call   801d51 <fd2sockid>
+  801eba:	85 c0                	test   %eax,%eax
+  801ebc:	78 12                	js     801ed0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801ebe:	83 ec 04             	sub    $0x4,%esp
+  801ec1:	ff 75 10             	push   0x10(%ebp)
+  801ec4:	ff 75 0c             	push   0xc(%ebp)
+  801ec7:	50                   	push   %eax
+  801ec8:	e8 ad 03 00 00       	call   80227a <nsipc_connect>
+  801ecd:	83 c4 10             	add    $0x10,%esp
+}
+  801ed0:	c9                   	leave
+  801ed1:	c3                   	ret
+
+00801ed2 <listen>:
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801ed8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801edb:	e8 71 fe ff ff       	call   801d51 <fd2sockid>
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	78 0f                	js     801ef3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801ee4:	83 ec 08             	sub    $0x8,%esp
+  801ee7:	ff 75 0c             	push   0xc(%ebp)
+  801eea:	50                   	push   %eax
+  801eeb:	e8 bf 03 00 00       	call   8022af <nsipc_listen>
+  801ef0:	83 c4 10             	add    $0x10,%esp
+}
+  801ef3:	c9                   	leave
+  801ef4:	c3                   	ret
+
+00801ef5 <sendmsg>:
+{
+  801ef5:	55                   	push   %ebp
+  801ef6:	89 e5                	mov    %esp,%ebp
+  801ef8:	57                   	push   %edi
+  801ef9:	56                   	push   %esi
+  801efa:	53                   	push   %ebx
+  801efb:	83 ec 0c             	sub    $0xc,%esp
+  801efe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f01:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801f04:	89 f0                	mov    %esi,%eax
+  801f06:	e8 46 fe ff ff       	call   801d51 <fd2sockid>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	78 1c                	js     801f2d <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801f11:	89 f0                	mov    %esi,%eax
+  801f13:	e8 69 fe ff ff       	call   801d81 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f18:	0b 45 10             	or     0x10(%ebp),%eax
+  801f1b:	50                   	push   %eax
+  801f1c:	ff 77 0c             	push   0xc(%edi)
+  801f1f:	ff 77 08             	push   0x8(%edi)
+  801f22:	53                   	push   %ebx
+  801f23:	e8 7c 04 00 00       	call   8023a4 <nsipc_sendmsg>
+  801f28:	89 c3                	mov    %eax,%ebx
+  801f2a:	83 c4 10             	add    $0x10,%esp
+}
+  801f2d:	89 d8                	mov    %ebx,%eax
+  801f2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f32:	5b                   	pop    %ebx
+  801f33:	5e                   	pop    %esi
+  801f34:	5f                   	pop    %edi
+  801f35:	5d                   	pop    %ebp
+  801f36:	c3                   	ret
+
+00801f37 <recvmsg>:
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	57                   	push   %edi
+  801f3b:	56                   	push   %esi
+  801f3c:	53                   	push   %ebx
+  801f3d:	83 ec 0c             	sub    $0xc,%esp
+  801f40:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f43:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f46:	89 f8                	mov    %edi,%eax
+  801f48:	e8 04 fe ff ff       	call   801d51 <fd2sockid>
+  801f4d:	89 c3                	mov    %eax,%ebx
+  801f4f:	85 c0                	test   %eax,%eax
+  801f51:	78 2a                	js     801f7d <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801f53:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801f5a:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801f61:	89 f8                	mov    %edi,%eax
+  801f63:	e8 19 fe ff ff       	call   801d81 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801f68:	0b 45 10             	or     0x10(%ebp),%eax
+  801f6b:	50                   	push   %eax
+  801f6c:	ff 76 0c             	push   0xc(%esi)
+  801f6f:	ff 76 08             	push   0x8(%esi)
+  801f72:	53                   	push   %ebx
+  801f73:	e8 d6 07 00 00       	call   80274e <nsipc_recvmsg>
+  801f78:	89 c3                	mov    %eax,%ebx
+  801f7a:	83 c4 10             	add    $0x10,%esp
+}
+  801f7d:	89 d8                	mov    %ebx,%eax
+  801f7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f82:	5b                   	pop    %ebx
+  801f83:	5e                   	pop    %esi
+  801f84:	5f                   	pop    %edi
+  801f85:	5d                   	pop    %ebp
+  801f86:	c3                   	ret
+
+00801f87 <sendfile>:
+{
+  801f87:	55                   	push   %ebp
+  801f88:	89 e5                	mov    %esp,%ebp
+  801f8a:	56                   	push   %esi
+  801f8b:	53                   	push   %ebx
+  801f8c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801f8f:	89 f0                	mov    %esi,%eax
+  801f91:	e8 bb fd ff ff       	call   801d51 <fd2sockid>
+  801f96:	89 c3                	mov    %eax,%ebx
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 1f                	js     801fbb <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801f9c:	89 f0                	mov    %esi,%eax
+  801f9e:	e8 de fd ff ff       	call   801d81 <sock_flags>
+  801fa3:	83 ec 0c             	sub    $0xc,%esp
+  801fa6:	50                   	push   %eax
+  801fa7:	ff 75 14             	push   0x14(%ebp)
+  801faa:	ff 75 10             	push   0x10(%ebp)
+  801fad:	ff 75 0c             	push   0xc(%ebp)
+  801fb0:	53                   	push   %ebx
+  801fb1:	e8 64 06 00 00       	call   80261a <nsipc_sendfile>
+  801fb6:	89 c3                	mov    %eax,%ebx
+  801fb8:	83 c4 20             	add    $0x20,%esp
+}
+  801fbb:	89 d8                	mov    %ebx,%eax
+  801fbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fc0:	5b                   	pop    %ebx
+  801fc1:	5e                   	pop    %esi
+  801fc2:	5d                   	pop    %ebp
+  801fc3:	c3                   	ret
+
+00801fc4 <evctl>:
+{
+  801fc4:	55                   	push   %ebp
+  801fc5:	89 e5                	mov    %esp,%ebp
+  801fc7:	53                   	push   %ebx
+  801fc8:	83 ec 04             	sub    $0x4,%esp
+  801fcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801fce:	89 d8                	mov    %ebx,%eax
+  801fd0:	e8 7c fd ff ff       	call   801d51 <fd2sockid>
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 10                	js     801fe9 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801fd9:	83 ec 04             	sub    $0x4,%esp
+  801fdc:	53                   	push   %ebx
+  801fdd:	ff 75 0c             	push   0xc(%ebp)
+  801fe0:	50                   	push   %eax
+  801fe1:	e8 d2 0b 00 00       	call   802bb8 <nsipc_evctl>
+  801fe6:	83 c4 10             	add    $0x10,%esp
+}
+  801fe9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+
+00801fee <evwait>:
+{
+  801fee:	55                   	push   %ebp
+  801fef:	89 e5                	mov    %esp,%ebp
+  801ff1:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801ff4:	ff 75 10             	push   0x10(%ebp)
+  801ff7:	ff 75 0c             	push   0xc(%ebp)
+  801ffa:	ff 75 08             	push   0x8(%ebp)
+  801ffd:	e8 e0 0b 00 00       	call   802be2 <nsipc_evwait>
+}
+  802002:	c9                   	leave
+  802003:	c3                   	ret
+
+00802004 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80200a:	ff 75 10             	push   0x10(%ebp)
+  80200d:	ff 75 0c             	push   0xc(%ebp)
+  802010:	ff 75 08             	push   0x8(%ebp)
+  802013:	e8 31 0c 00 00       	call   802c49 <nsipc_socket>
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 05                	js     802024 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80201f:	e8 89 fd ff ff       	call   801dad <alloc_sockfd>
+}
+  802024:	c9                   	leave
+  802025:	c3                   	ret
+
+00802026 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802026:	55                   	push   %ebp
+  802027:	89 e5                	mov    %esp,%ebp
+  802029:	53                   	push   %ebx
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  80202f:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802036:	74 26                	je     80205e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802038:	6a 07                	push   $0x7
+  80203a:	68 00 80 80 00       	push   $0x808000
+  80203f:	53                   	push   %ebx
+  802040:	ff 35 24 63 80 00    	push   0x806324
+  802046:	e8 12 19 00 00       	call   80395d <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  80204b:	83 c4 0c             	add    $0xc,%esp
+  80204e:	6a 00                	push   $0x0
+  802050:	6a 00                	push   $0x0
+  802052:	6a 00                	push   $0x0
+  802054:	e8 74 16 00 00       	call   8036cd <ipc_recv>
+}
+  802059:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  80205e:	83 ec 0c             	sub    $0xc,%esp
+  802061:	6a 03                	push   $0x3
+  802063:	e8 5e 19 00 00       	call   8039c6 <ipc_find_env>
+  802068:	a3 24 63 80 00       	mov    %eax,0x806324
+  80206d:	83 c4 10             	add    $0x10,%esp
+  802070:	eb c6                	jmp    802038 <nsipc+0x12>
+
+00802072 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  802072:	55                   	push   %ebp
+  802073:	89 e5                	mov    %esp,%ebp
+  802075:	56                   	push   %esi
+  802076:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  802077:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  80207d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  802082:	85 f6                	test   %esi,%esi
+  802084:	75 33                	jne    8020b9 <nsbulk_map+0x47>
+  802086:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  80208b:	83 ec 04             	sub    $0x4,%esp
+  80208e:	6a 07                	push   $0x7
+  802090:	53                   	push   %ebx
+  802091:	6a 00                	push   $0x0
+  802093:	e8 fa ed ff ff       	call   800e92 <sys_page_alloc>
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	85 c0                	test   %eax,%eax
+  80209d:	78 1a                	js     8020b9 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  80209f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8020a5:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  8020ab:	75 de                	jne    80208b <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  8020ad:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  8020b4:	00 00 00 
+	return 0;
+  8020b7:	89 f0                	mov    %esi,%eax
+}
+  8020b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020bc:	5b                   	pop    %ebx
+  8020bd:	5e                   	pop    %esi
+  8020be:	5d                   	pop    %ebp
+  8020bf:	c3                   	ret
+
+008020c0 <nsbulk_own>:
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	57                   	push   %edi
+  8020c4:	56                   	push   %esi
+  8020c5:	53                   	push   %ebx
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+  8020c9:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  8020cb:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  8020ce:	85 d2                	test   %edx,%edx
+  8020d0:	7f 0e                	jg     8020e0 <nsbulk_own+0x20>
+	return 0;
+  8020d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d7:	eb 47                	jmp    802120 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  8020d9:	83 c3 01             	add    $0x1,%ebx
+  8020dc:	39 fb                	cmp    %edi,%ebx
+  8020de:	7d 3b                	jge    80211b <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  8020e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8020e5:	89 d9                	mov    %ebx,%ecx
+  8020e7:	d3 e6                	shl    %cl,%esi
+  8020e9:	89 f0                	mov    %esi,%eax
+  8020eb:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  8020f1:	74 e6                	je     8020d9 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  8020f3:	83 ec 04             	sub    $0x4,%esp
+  8020f6:	6a 07                	push   $0x7
+  8020f8:	89 d8                	mov    %ebx,%eax
+  8020fa:	c1 e0 0c             	shl    $0xc,%eax
+  8020fd:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802102:	50                   	push   %eax
+  802103:	6a 00                	push   $0x0
+  802105:	e8 88 ed ff ff       	call   800e92 <sys_page_alloc>
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	78 0f                	js     802120 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  802111:	f7 d6                	not    %esi
+  802113:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  802119:	eb be                	jmp    8020d9 <nsbulk_own+0x19>
+	return 0;
+  80211b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802123:	5b                   	pop    %ebx
+  802124:	5e                   	pop    %esi
+  802125:	5f                   	pop    %edi
+  802126:	5d                   	pop    %ebp
+  802127:	c3                   	ret
+
+00802128 <nsipc_bulk>:
+{
+  802128:	55                   	push   %ebp
+  802129:	89 e5                	mov    %esp,%ebp
+  80212b:	57                   	push   %edi
+  80212c:	56                   	push   %esi
+  80212d:	53                   	push   %ebx
+  80212e:	83 ec 1c             	sub    $0x1c,%esp
+  802131:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802134:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802136:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80213c:	c1 fb 0c             	sar    $0xc,%ebx
+  80213f:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802142:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802149:	74 56                	je     8021a1 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80214b:	85 ff                	test   %edi,%edi
+  80214d:	7e 24                	jle    802173 <nsipc_bulk+0x4b>
+  80214f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802155:	74 1c                	je     802173 <nsipc_bulk+0x4b>
+  802157:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80215d:	c1 e3 0c             	shl    $0xc,%ebx
+  802160:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802165:	0f b6 10             	movzbl (%eax),%edx
+  802168:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80216a:	05 00 10 00 00       	add    $0x1000,%eax
+  80216f:	39 d8                	cmp    %ebx,%eax
+  802171:	75 f2                	jne    802165 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802173:	83 ec 0c             	sub    $0xc,%esp
+  802176:	56                   	push   %esi
+  802177:	57                   	push   %edi
+  802178:	68 00 00 00 e0       	push   $0xe0000000
+  80217d:	ff 75 e4             	push   -0x1c(%ebp)
+  802180:	ff 35 24 63 80 00    	push   0x806324
+  802186:	e8 06 18 00 00       	call   803991 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80218b:	83 c4 1c             	add    $0x1c,%esp
+  80218e:	6a 00                	push   $0x0
+  802190:	6a 00                	push   $0x0
+  802192:	6a 00                	push   $0x0
+  802194:	e8 34 15 00 00       	call   8036cd <ipc_recv>
+}
+  802199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219c:	5b                   	pop    %ebx
+  80219d:	5e                   	pop    %esi
+  80219e:	5f                   	pop    %edi
+  80219f:	5d                   	pop    %ebp
+  8021a0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8021a1:	83 ec 0c             	sub    $0xc,%esp
+  8021a4:	6a 03                	push   $0x3
+  8021a6:	e8 1b 18 00 00       	call   8039c6 <ipc_find_env>
+  8021ab:	a3 24 63 80 00       	mov    %eax,0x806324
+  8021b0:	83 c4 10             	add    $0x10,%esp
+  8021b3:	eb 96                	jmp    80214b <nsipc_bulk+0x23>
+
+008021b5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  8021b5:	55                   	push   %ebp
+  8021b6:	89 e5                	mov    %esp,%ebp
+  8021b8:	53                   	push   %ebx
+  8021b9:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  8021c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021c7:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8021cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021d1:	e8 50 fe ff ff       	call   802026 <nsipc>
+  8021d6:	89 c3                	mov    %eax,%ebx
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	79 07                	jns    8021e3 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8021dc:	89 d8                	mov    %ebx,%eax
+  8021de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021e1:	c9                   	leave
+  8021e2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8021e3:	83 ec 04             	sub    $0x4,%esp
+  8021e6:	ff 35 10 80 80 00    	push   0x808010
+  8021ec:	68 00 80 80 00       	push   $0x808000
+  8021f1:	ff 75 0c             	push   0xc(%ebp)
+  8021f4:	e8 15 ea ff ff       	call   800c0e <memmove>
+		*addrlen = ret->ret_addrlen;
+  8021f9:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8021ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  802202:	89 10                	mov    %edx,(%eax)
+  802204:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802207:	eb d3                	jmp    8021dc <nsipc_accept+0x27>
+
+00802209 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802209:	55                   	push   %ebp
+  80220a:	89 e5                	mov    %esp,%ebp
+  80220c:	53                   	push   %ebx
+  80220d:	83 ec 08             	sub    $0x8,%esp
+  802210:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802213:	8b 45 08             	mov    0x8(%ebp),%eax
+  802216:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80221b:	53                   	push   %ebx
+  80221c:	ff 75 0c             	push   0xc(%ebp)
+  80221f:	68 04 80 80 00       	push   $0x808004
+  802224:	e8 e5 e9 ff ff       	call   800c0e <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802229:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  80222f:	b8 02 00 00 00       	mov    $0x2,%eax
+  802234:	e8 ed fd ff ff       	call   802026 <nsipc>
+}
+  802239:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223c:	c9                   	leave
+  80223d:	c3                   	ret
+
+0080223e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802244:	8b 45 08             	mov    0x8(%ebp),%eax
+  802247:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80224c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80224f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802254:	b8 03 00 00 00       	mov    $0x3,%eax
+  802259:	e8 c8 fd ff ff       	call   802026 <nsipc>
+}
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+
+00802260 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802260:	55                   	push   %ebp
+  802261:	89 e5                	mov    %esp,%ebp
+  802263:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802266:	8b 45 08             	mov    0x8(%ebp),%eax
+  802269:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80226e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802273:	e8 ae fd ff ff       	call   802026 <nsipc>
+}
+  802278:	c9                   	leave
+  802279:	c3                   	ret
+
+0080227a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	53                   	push   %ebx
+  80227e:	83 ec 08             	sub    $0x8,%esp
+  802281:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802284:	8b 45 08             	mov    0x8(%ebp),%eax
+  802287:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80228c:	53                   	push   %ebx
+  80228d:	ff 75 0c             	push   0xc(%ebp)
+  802290:	68 04 80 80 00       	push   $0x808004
+  802295:	e8 74 e9 ff ff       	call   800c0e <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80229a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  8022a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022a5:	e8 7c fd ff ff       	call   802026 <nsipc>
+}
+  8022aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ad:	c9                   	leave
+  8022ae:	c3                   	ret
+
+008022af <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8022af:	55                   	push   %ebp
+  8022b0:	89 e5                	mov    %esp,%ebp
+  8022b2:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8022b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b8:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  8022bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022c0:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  8022c5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8022ca:	e8 57 fd ff ff       	call   802026 <nsipc>
+}
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+
+008022d1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8022d1:	55                   	push   %ebp
+  8022d2:	89 e5                	mov    %esp,%ebp
+  8022d4:	56                   	push   %esi
+  8022d5:	53                   	push   %ebx
+  8022d6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8022d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022dc:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8022e1:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8022e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022ea:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8022ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022f4:	e8 2d fd ff ff       	call   802026 <nsipc>
+  8022f9:	89 c3                	mov    %eax,%ebx
+  8022fb:	85 c0                	test   %eax,%eax
+  8022fd:	78 22                	js     802321 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8022ff:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802304:	39 c6                	cmp    %eax,%esi
+  802306:	0f 4e c6             	cmovle %esi,%eax
+  802309:	39 c3                	cmp    %eax,%ebx
+  80230b:	7f 1d                	jg     80232a <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80230d:	83 ec 04             	sub    $0x4,%esp
+  802310:	53                   	push   %ebx
+  802311:	68 00 80 80 00       	push   $0x808000
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	e8 f0 e8 ff ff       	call   800c0e <memmove>
+  80231e:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802321:	89 d8                	mov    %ebx,%eax
+  802323:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802326:	5b                   	pop    %ebx
+  802327:	5e                   	pop    %esi
+  802328:	5d                   	pop    %ebp
+  802329:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  80232a:	68 34 41 80 00       	push   $0x804134
+  80232f:	68 49 41 80 00       	push   $0x804149
+  802334:	68 b2 00 00 00       	push   $0xb2
+  802339:	68 5e 41 80 00       	push   $0x80415e
+  80233e:	e8 49 df ff ff       	call   80028c <_panic>
+
+00802343 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	53                   	push   %ebx
+  802347:	83 ec 04             	sub    $0x4,%esp
+  80234a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80234d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802350:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802355:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80235b:	7f 2e                	jg     80238b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80235d:	83 ec 04             	sub    $0x4,%esp
+  802360:	53                   	push   %ebx
+  802361:	ff 75 0c             	push   0xc(%ebp)
+  802364:	68 0c 80 80 00       	push   $0x80800c
+  802369:	e8 a0 e8 ff ff       	call   800c0e <memmove>
+	nsipcbuf.send.req_size = size;
+  80236e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802374:	8b 45 14             	mov    0x14(%ebp),%eax
+  802377:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80237c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802381:	e8 a0 fc ff ff       	call   802026 <nsipc>
+}
+  802386:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802389:	c9                   	leave
+  80238a:	c3                   	ret
+	assert(size < 1600);
+  80238b:	68 6a 41 80 00       	push   $0x80416a
+  802390:	68 49 41 80 00       	push   $0x804149
+  802395:	68 bd 00 00 00       	push   $0xbd
+  80239a:	68 5e 41 80 00       	push   $0x80415e
+  80239f:	e8 e8 de ff ff       	call   80028c <_panic>
+
+008023a4 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  8023a4:	55                   	push   %ebp
+  8023a5:	89 e5                	mov    %esp,%ebp
+  8023a7:	57                   	push   %edi
+  8023a8:	56                   	push   %esi
+  8023a9:	53                   	push   %ebx
+  8023aa:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  8023ad:	e8 c0 fc ff ff       	call   802072 <nsbulk_map>
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 55                	js     80240b <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  8023b6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  8023bd:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  8023c4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023cb:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023ce:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8023d1:	0f 8d 24 02 00 00    	jge    8025fb <nsipc_sendmsg+0x257>
+  8023d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023da:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8023dd:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8023e0:	89 d8                	mov    %ebx,%eax
+  8023e2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023e7:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8023e9:	83 ec 0c             	sub    $0xc,%esp
+  8023ec:	68 20 60 80 00       	push   $0x806020
+  8023f1:	e8 5a 0f 00 00       	call   803350 <pgbatch_init>
+  8023f6:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8023f9:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8023fb:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8023fe:	e9 82 00 00 00       	jmp    802485 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  802403:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802406:	85 db                	test   %ebx,%ebx
+  802408:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  80240b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240e:	5b                   	pop    %ebx
+  80240f:	5e                   	pop    %esi
+  802410:	5f                   	pop    %edi
+  802411:	5d                   	pop    %ebp
+  802412:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  802413:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802418:	29 c8                	sub    %ecx,%eax
+  80241a:	39 d0                	cmp    %edx,%eax
+  80241c:	0f 46 d0             	cmovbe %eax,%edx
+  80241f:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  802421:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  802427:	85 ff                	test   %edi,%edi
+  802429:	0f 49 c7             	cmovns %edi,%eax
+  80242c:	c1 f8 0c             	sar    $0xc,%eax
+  80242f:	ba 01 00 00 00       	mov    $0x1,%edx
+  802434:	e8 87 fc ff ff       	call   8020c0 <nsbulk_own>
+  802439:	85 c0                	test   %eax,%eax
+  80243b:	0f 88 17 01 00 00    	js     802558 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802441:	83 ec 04             	sub    $0x4,%esp
+  802444:	56                   	push   %esi
+  802445:	ff 75 e0             	push   -0x20(%ebp)
+  802448:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80244b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802450:	50                   	push   %eax
+  802451:	e8 b8 e7 ff ff       	call   800c0e <memmove>
+  802456:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802459:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80245c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80245f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802462:	0f 84 fd 00 00 00    	je     802565 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802468:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80246b:	01 f7                	add    %esi,%edi
+  80246d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802470:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802473:	0f 8d 01 01 00 00    	jge    80257a <nsipc_sendmsg+0x1d6>
+  802479:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80247f:	0f 8f f0 00 00 00    	jg     802575 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802485:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802488:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80248b:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80248e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802491:	89 c2                	mov    %eax,%edx
+  802493:	03 13                	add    (%ebx),%edx
+  802495:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802498:	8b 73 04             	mov    0x4(%ebx),%esi
+  80249b:	29 c6                	sub    %eax,%esi
+  80249d:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  8024a2:	29 f9                	sub    %edi,%ecx
+  8024a4:	39 ce                	cmp    %ecx,%esi
+  8024a6:	89 ca                	mov    %ecx,%edx
+  8024a8:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  8024ab:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  8024ae:	89 f9                	mov    %edi,%ecx
+  8024b0:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  8024b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024b9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8024be:	09 c8                	or     %ecx,%eax
+  8024c0:	0f 85 4d ff ff ff    	jne    802413 <nsipc_sendmsg+0x6f>
+  8024c6:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  8024cc:	0f 86 41 ff ff ff    	jbe    802413 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024d2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8024d8:	85 ff                	test   %edi,%edi
+  8024da:	0f 49 c7             	cmovns %edi,%eax
+  8024dd:	c1 f8 0c             	sar    $0xc,%eax
+  8024e0:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8024e2:	89 d1                	mov    %edx,%ecx
+  8024e4:	c1 e9 0c             	shr    $0xc,%ecx
+  8024e7:	01 c8                	add    %ecx,%eax
+  8024e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8024ec:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024ef:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8024f1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024f4:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8024f9:	29 c8                	sub    %ecx,%eax
+  8024fb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8024fe:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  802501:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  802503:	b8 01 00 00 00       	mov    $0x1,%eax
+  802508:	89 f9                	mov    %edi,%ecx
+  80250a:	d3 e0                	shl    %cl,%eax
+  80250c:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  802512:	83 ec 08             	sub    $0x8,%esp
+  802515:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  802517:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  80251a:	50                   	push   %eax
+  80251b:	6a 00                	push   $0x0
+  80251d:	56                   	push   %esi
+  80251e:	6a 00                	push   $0x0
+  802520:	68 20 60 80 00       	push   $0x806020
+  802525:	e8 e4 0e 00 00       	call   80340e <pgbatch_map>
+  80252a:	83 c4 20             	add    $0x20,%esp
+  80252d:	85 c0                	test   %eax,%eax
+  80252f:	0f 88 ce fe ff ff    	js     802403 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802535:	83 c7 01             	add    $0x1,%edi
+  802538:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80253e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802541:	39 c7                	cmp    %eax,%edi
+  802543:	75 be                	jne    802503 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802545:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802548:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80254b:	89 d6                	mov    %edx,%esi
+  80254d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802553:	e9 01 ff ff ff       	jmp    802459 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802558:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80255b:	85 db                	test   %ebx,%ebx
+  80255d:	0f 45 c3             	cmovne %ebx,%eax
+  802560:	e9 a6 fe ff ff       	jmp    80240b <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802565:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802569:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802570:	e9 f3 fe ff ff       	jmp    802468 <nsipc_sendmsg+0xc4>
+  802575:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802578:	eb 03                	jmp    80257d <nsipc_sendmsg+0x1d9>
+  80257a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80257d:	83 ec 0c             	sub    $0xc,%esp
+  802580:	68 20 60 80 00       	push   $0x806020
+  802585:	e8 d4 0d 00 00       	call   80335e <pgbatch_flush>
+  80258a:	83 c4 10             	add    $0x10,%esp
+  80258d:	85 c0                	test   %eax,%eax
+  80258f:	78 50                	js     8025e1 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802591:	8b 45 08             	mov    0x8(%ebp),%eax
+  802594:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802599:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80259f:	89 fb                	mov    %edi,%ebx
+  8025a1:	29 f3                	sub    %esi,%ebx
+  8025a3:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  8025a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ac:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  8025b1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8025b6:	89 fa                	mov    %edi,%edx
+  8025b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8025bd:	e8 66 fb ff ff       	call   802128 <nsipc_bulk>
+  8025c2:	85 c0                	test   %eax,%eax
+  8025c4:	78 28                	js     8025ee <nsipc_sendmsg+0x24a>
+		sent += r;
+  8025c6:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  8025c9:	39 c3                	cmp    %eax,%ebx
+  8025cb:	75 0c                	jne    8025d9 <nsipc_sendmsg+0x235>
+  8025cd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025d0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8025d3:	0f 8f f2 fd ff ff    	jg     8023cb <nsipc_sendmsg+0x27>
+		sent += r;
+  8025d9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8025dc:	e9 2a fe ff ff       	jmp    80240b <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025e1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025e4:	85 db                	test   %ebx,%ebx
+  8025e6:	0f 45 c3             	cmovne %ebx,%eax
+  8025e9:	e9 1d fe ff ff       	jmp    80240b <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8025ee:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8025f1:	85 db                	test   %ebx,%ebx
+  8025f3:	0f 45 c3             	cmovne %ebx,%eax
+  8025f6:	e9 10 fe ff ff       	jmp    80240b <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8025fb:	83 ec 0c             	sub    $0xc,%esp
+  8025fe:	68 20 60 80 00       	push   $0x806020
+  802603:	e8 48 0d 00 00       	call   803350 <pgbatch_init>
+  802608:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80260b:	be 00 00 00 00       	mov    $0x0,%esi
+  802610:	bf 00 00 00 00       	mov    $0x0,%edi
+  802615:	e9 63 ff ff ff       	jmp    80257d <nsipc_sendmsg+0x1d9>
+
+0080261a <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  80261a:	55                   	push   %ebp
+  80261b:	89 e5                	mov    %esp,%ebp
+  80261d:	57                   	push   %edi
+  80261e:	56                   	push   %esi
+  80261f:	53                   	push   %ebx
+  802620:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  802623:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  80262a:	0f 84 c8 00 00 00    	je     8026f8 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802630:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802637:	0f 84 e4 00 00 00    	je     802721 <nsipc_sendfile+0x107>
+{
+  80263d:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802642:	89 fb                	mov    %edi,%ebx
+  802644:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802647:	0f 83 f0 00 00 00    	jae    80273d <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80264d:	89 fa                	mov    %edi,%edx
+  80264f:	03 55 10             	add    0x10(%ebp),%edx
+  802652:	89 d0                	mov    %edx,%eax
+  802654:	c1 f8 1f             	sar    $0x1f,%eax
+  802657:	c1 e8 14             	shr    $0x14,%eax
+  80265a:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80265d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802663:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802665:	6a 10                	push   $0x10
+  802667:	68 00 20 01 e0       	push   $0xe0012000
+  80266c:	52                   	push   %edx
+  80266d:	ff 75 0c             	push   0xc(%ebp)
+  802670:	e8 fe f4 ff ff       	call   801b73 <fmap>
+  802675:	83 c4 10             	add    $0x10,%esp
+  802678:	85 c0                	test   %eax,%eax
+  80267a:	0f 8e b8 00 00 00    	jle    802738 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802680:	39 c6                	cmp    %eax,%esi
+  802682:	0f 8d b5 00 00 00    	jge    80273d <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802688:	29 f0                	sub    %esi,%eax
+  80268a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80268d:	29 da                	sub    %ebx,%edx
+  80268f:	39 d0                	cmp    %edx,%eax
+  802691:	89 d3                	mov    %edx,%ebx
+  802693:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802696:	8b 45 08             	mov    0x8(%ebp),%eax
+  802699:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80269e:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  8026a4:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  8026aa:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026ad:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026b2:	83 ec 0c             	sub    $0xc,%esp
+  8026b5:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  8026b7:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  8026be:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  8026c1:	83 c0 01             	add    $0x1,%eax
+  8026c4:	50                   	push   %eax
+  8026c5:	68 00 10 01 e0       	push   $0xe0011000
+  8026ca:	6a 11                	push   $0x11
+  8026cc:	ff 35 24 63 80 00    	push   0x806324
+  8026d2:	e8 ba 12 00 00       	call   803991 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8026d7:	83 c4 1c             	add    $0x1c,%esp
+  8026da:	6a 00                	push   $0x0
+  8026dc:	6a 00                	push   $0x0
+  8026de:	6a 00                	push   $0x0
+  8026e0:	e8 e8 0f 00 00       	call   8036cd <ipc_recv>
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	78 5b                	js     802747 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8026ec:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8026ee:	39 c3                	cmp    %eax,%ebx
+  8026f0:	0f 8e 4c ff ff ff    	jle    802642 <nsipc_sendfile+0x28>
+  8026f6:	eb 45                	jmp    80273d <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8026f8:	83 ec 04             	sub    $0x4,%esp
+  8026fb:	6a 07                	push   $0x7
+  8026fd:	68 00 10 01 e0       	push   $0xe0011000
+  802702:	6a 00                	push   $0x0
+  802704:	e8 89 e7 ff ff       	call   800e92 <sys_page_alloc>
+  802709:	89 c7                	mov    %eax,%edi
+  80270b:	83 c4 10             	add    $0x10,%esp
+  80270e:	85 c0                	test   %eax,%eax
+  802710:	78 2b                	js     80273d <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  802712:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  802719:	00 00 00 
+  80271c:	e9 0f ff ff ff       	jmp    802630 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802721:	83 ec 0c             	sub    $0xc,%esp
+  802724:	6a 03                	push   $0x3
+  802726:	e8 9b 12 00 00       	call   8039c6 <ipc_find_env>
+  80272b:	a3 24 63 80 00       	mov    %eax,0x806324
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	e9 05 ff ff ff       	jmp    80263d <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802738:	85 ff                	test   %edi,%edi
+  80273a:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80273d:	89 f8                	mov    %edi,%eax
+  80273f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802742:	5b                   	pop    %ebx
+  802743:	5e                   	pop    %esi
+  802744:	5f                   	pop    %edi
+  802745:	5d                   	pop    %ebp
+  802746:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802747:	85 ff                	test   %edi,%edi
+  802749:	0f 44 f8             	cmove  %eax,%edi
+  80274c:	eb ef                	jmp    80273d <nsipc_sendfile+0x123>
+
+0080274e <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	57                   	push   %edi
+  802752:	56                   	push   %esi
+  802753:	53                   	push   %ebx
+  802754:	83 ec 1c             	sub    $0x1c,%esp
+  802757:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80275a:	e8 13 f9 ff ff       	call   802072 <nsbulk_map>
+  80275f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802762:	85 c0                	test   %eax,%eax
+  802764:	0f 88 ba 00 00 00    	js     802824 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80276a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80276e:	0f 8e bb 00 00 00    	jle    80282f <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802774:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802779:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80277e:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802783:	89 f8                	mov    %edi,%eax
+  802785:	29 f0                	sub    %esi,%eax
+  802787:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80278b:	39 c8                	cmp    %ecx,%eax
+  80278d:	0f 47 c1             	cmova  %ecx,%eax
+  802790:	01 f0                	add    %esi,%eax
+  802792:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802794:	83 c2 01             	add    $0x1,%edx
+  802797:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80279a:	7e 07                	jle    8027a3 <nsipc_recvmsg+0x55>
+  80279c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  8027a1:	7e e0                	jle    802783 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  8027a3:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  8027a9:	c1 fa 0c             	sar    $0xc,%edx
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	e8 0a f9 ff ff       	call   8020c0 <nsbulk_own>
+  8027b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027b9:	85 c0                	test   %eax,%eax
+  8027bb:	78 67                	js     802824 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  8027bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027c0:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  8027c5:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  8027cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027ce:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8027d3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8027d8:	89 f2                	mov    %esi,%edx
+  8027da:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8027df:	e8 44 f9 ff ff       	call   802128 <nsipc_bulk>
+  8027e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	78 39                	js     802824 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8027eb:	39 f0                	cmp    %esi,%eax
+  8027ed:	7f 4a                	jg     802839 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8027ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f4:	85 c0                	test   %eax,%eax
+  8027f6:	7e 2c                	jle    802824 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8027f8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8027fb:	29 fe                	sub    %edi,%esi
+  8027fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  802800:	39 c6                	cmp    %eax,%esi
+  802802:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  802805:	83 ec 04             	sub    $0x4,%esp
+  802808:	56                   	push   %esi
+  802809:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  80280f:	50                   	push   %eax
+  802810:	ff 33                	push   (%ebx)
+  802812:	e8 f7 e3 ff ff       	call   800c0e <memmove>
+		n += m;
+  802817:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  802819:	83 c3 08             	add    $0x8,%ebx
+  80281c:	83 c4 10             	add    $0x10,%esp
+  80281f:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  802822:	7f d4                	jg     8027f8 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  802824:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802827:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282a:	5b                   	pop    %ebx
+  80282b:	5e                   	pop    %esi
+  80282c:	5f                   	pop    %edi
+  80282d:	5d                   	pop    %ebp
+  80282e:	c3                   	ret
+	int r, i, n, len = 0;
+  80282f:	be 00 00 00 00       	mov    $0x0,%esi
+  802834:	e9 6a ff ff ff       	jmp    8027a3 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802839:	68 40 41 80 00       	push   $0x804140
+  80283e:	68 49 41 80 00       	push   $0x804149
+  802843:	68 3b 01 00 00       	push   $0x13b
+  802848:	68 5e 41 80 00       	push   $0x80415e
+  80284d:	e8 3a da ff ff       	call   80028c <_panic>
+
+00802852 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802852:	55                   	push   %ebp
+  802853:	89 e5                	mov    %esp,%ebp
+  802855:	57                   	push   %edi
+  802856:	56                   	push   %esi
+  802857:	53                   	push   %ebx
+  802858:	83 ec 0c             	sub    $0xc,%esp
+  80285b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80285e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802861:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802864:	8b 45 08             	mov    0x8(%ebp),%eax
+  802867:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80286c:	8b 07                	mov    (%edi),%eax
+  80286e:	a3 04 80 80 00       	mov    %eax,0x808004
+  802873:	8b 47 04             	mov    0x4(%edi),%eax
+  802876:	a3 08 80 80 00       	mov    %eax,0x808008
+  80287b:	8b 47 08             	mov    0x8(%edi),%eax
+  80287e:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802883:	8b 47 0c             	mov    0xc(%edi),%eax
+  802886:	a3 10 80 80 00       	mov    %eax,0x808010
+  80288b:	8b 47 10             	mov    0x10(%edi),%eax
+  80288e:	a3 14 80 80 00       	mov    %eax,0x808014
+  802893:	8b 47 14             	mov    0x14(%edi),%eax
+  802896:	a3 18 80 80 00       	mov    %eax,0x808018
+  80289b:	8b 47 18             	mov    0x18(%edi),%eax
+  80289e:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  8028a3:	8b 47 1c             	mov    0x1c(%edi),%eax
+  8028a6:	a3 20 80 80 00       	mov    %eax,0x808020
+  8028ab:	8b 47 20             	mov    0x20(%edi),%eax
+  8028ae:	a3 24 80 80 00       	mov    %eax,0x808024
+  8028b3:	8b 47 24             	mov    0x24(%edi),%eax
+  8028b6:	a3 28 80 80 00       	mov    %eax,0x808028
+  8028bb:	8b 47 28             	mov    0x28(%edi),%eax
+  8028be:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  8028c3:	8b 47 2c             	mov    0x2c(%edi),%eax
+  8028c6:	a3 30 80 80 00       	mov    %eax,0x808030
+  8028cb:	8b 47 30             	mov    0x30(%edi),%eax
+  8028ce:	a3 34 80 80 00       	mov    %eax,0x808034
+  8028d3:	8b 47 34             	mov    0x34(%edi),%eax
+  8028d6:	a3 38 80 80 00       	mov    %eax,0x808038
+  8028db:	8b 47 38             	mov    0x38(%edi),%eax
+  8028de:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8028e3:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8028e6:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8028eb:	8b 06                	mov    (%esi),%eax
+  8028ed:	a3 44 80 80 00       	mov    %eax,0x808044
+  8028f2:	8b 46 04             	mov    0x4(%esi),%eax
+  8028f5:	a3 48 80 80 00       	mov    %eax,0x808048
+  8028fa:	8b 46 08             	mov    0x8(%esi),%eax
+  8028fd:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  802902:	8b 46 0c             	mov    0xc(%esi),%eax
+  802905:	a3 50 80 80 00       	mov    %eax,0x808050
+  80290a:	8b 46 10             	mov    0x10(%esi),%eax
+  80290d:	a3 54 80 80 00       	mov    %eax,0x808054
+  802912:	8b 46 14             	mov    0x14(%esi),%eax
+  802915:	a3 58 80 80 00       	mov    %eax,0x808058
+  80291a:	8b 46 18             	mov    0x18(%esi),%eax
+  80291d:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  802922:	8b 46 1c             	mov    0x1c(%esi),%eax
+  802925:	a3 60 80 80 00       	mov    %eax,0x808060
+  80292a:	8b 46 20             	mov    0x20(%esi),%eax
+  80292d:	a3 64 80 80 00       	mov    %eax,0x808064
+  802932:	8b 46 24             	mov    0x24(%esi),%eax
+  802935:	a3 68 80 80 00       	mov    %eax,0x808068
+  80293a:	8b 46 28             	mov    0x28(%esi),%eax
+  80293d:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802942:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802945:	a3 70 80 80 00       	mov    %eax,0x808070
+  80294a:	8b 46 30             	mov    0x30(%esi),%eax
+  80294d:	a3 74 80 80 00       	mov    %eax,0x808074
+  802952:	8b 46 34             	mov    0x34(%esi),%eax
+  802955:	a3 78 80 80 00       	mov    %eax,0x808078
+  80295a:	8b 46 38             	mov    0x38(%esi),%eax
+  80295d:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802962:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802965:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80296a:	8b 03                	mov    (%ebx),%eax
+  80296c:	a3 84 80 80 00       	mov    %eax,0x808084
+  802971:	8b 43 04             	mov    0x4(%ebx),%eax
+  802974:	a3 88 80 80 00       	mov    %eax,0x808088
+  802979:	8b 43 08             	mov    0x8(%ebx),%eax
+  80297c:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802981:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802984:	a3 90 80 80 00       	mov    %eax,0x808090
+  802989:	8b 43 10             	mov    0x10(%ebx),%eax
+  80298c:	a3 94 80 80 00       	mov    %eax,0x808094
+  802991:	8b 43 14             	mov    0x14(%ebx),%eax
+  802994:	a3 98 80 80 00       	mov    %eax,0x808098
+  802999:	8b 43 18             	mov    0x18(%ebx),%eax
+  80299c:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  8029a1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8029a4:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  8029a9:	8b 43 20             	mov    0x20(%ebx),%eax
+  8029ac:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  8029b1:	8b 43 24             	mov    0x24(%ebx),%eax
+  8029b4:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  8029b9:	8b 43 28             	mov    0x28(%ebx),%eax
+  8029bc:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  8029c1:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  8029c4:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  8029c9:	8b 43 30             	mov    0x30(%ebx),%eax
+  8029cc:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8029d1:	8b 43 34             	mov    0x34(%ebx),%eax
+  8029d4:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8029d9:	8b 43 38             	mov    0x38(%ebx),%eax
+  8029dc:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8029e1:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8029e4:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8029e9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8029ec:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8029f1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8029f6:	e8 2b f6 ff ff       	call   802026 <nsipc>
+  8029fb:	85 c0                	test   %eax,%eax
+  8029fd:	0f 88 ad 01 00 00    	js     802bb0 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  802a03:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802a09:	89 17                	mov    %edx,(%edi)
+  802a0b:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802a11:	89 57 04             	mov    %edx,0x4(%edi)
+  802a14:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802a1a:	89 57 08             	mov    %edx,0x8(%edi)
+  802a1d:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802a23:	89 57 0c             	mov    %edx,0xc(%edi)
+  802a26:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802a2c:	89 57 10             	mov    %edx,0x10(%edi)
+  802a2f:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802a35:	89 57 14             	mov    %edx,0x14(%edi)
+  802a38:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802a3e:	89 57 18             	mov    %edx,0x18(%edi)
+  802a41:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802a47:	89 57 1c             	mov    %edx,0x1c(%edi)
+  802a4a:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802a50:	89 57 20             	mov    %edx,0x20(%edi)
+  802a53:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802a59:	89 57 24             	mov    %edx,0x24(%edi)
+  802a5c:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802a62:	89 57 28             	mov    %edx,0x28(%edi)
+  802a65:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  802a6b:	89 57 2c             	mov    %edx,0x2c(%edi)
+  802a6e:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802a74:	89 57 30             	mov    %edx,0x30(%edi)
+  802a77:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  802a7d:	89 57 34             	mov    %edx,0x34(%edi)
+  802a80:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802a86:	89 57 38             	mov    %edx,0x38(%edi)
+  802a89:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  802a8f:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802a92:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802a98:	89 16                	mov    %edx,(%esi)
+  802a9a:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802aa0:	89 56 04             	mov    %edx,0x4(%esi)
+  802aa3:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802aa9:	89 56 08             	mov    %edx,0x8(%esi)
+  802aac:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802ab2:	89 56 0c             	mov    %edx,0xc(%esi)
+  802ab5:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  802abb:	89 56 10             	mov    %edx,0x10(%esi)
+  802abe:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802ac4:	89 56 14             	mov    %edx,0x14(%esi)
+  802ac7:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  802acd:	89 56 18             	mov    %edx,0x18(%esi)
+  802ad0:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  802ad6:	89 56 1c             	mov    %edx,0x1c(%esi)
+  802ad9:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  802adf:	89 56 20             	mov    %edx,0x20(%esi)
+  802ae2:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  802ae8:	89 56 24             	mov    %edx,0x24(%esi)
+  802aeb:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  802af1:	89 56 28             	mov    %edx,0x28(%esi)
+  802af4:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  802afa:	89 56 2c             	mov    %edx,0x2c(%esi)
+  802afd:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  802b03:	89 56 30             	mov    %edx,0x30(%esi)
+  802b06:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  802b0c:	89 56 34             	mov    %edx,0x34(%esi)
+  802b0f:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  802b15:	89 56 38             	mov    %edx,0x38(%esi)
+  802b18:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  802b1e:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  802b21:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  802b27:	89 13                	mov    %edx,(%ebx)
+  802b29:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  802b2f:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b32:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802b38:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b3b:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802b41:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b44:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802b4a:	89 53 10             	mov    %edx,0x10(%ebx)
+  802b4d:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802b53:	89 53 14             	mov    %edx,0x14(%ebx)
+  802b56:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802b5c:	89 53 18             	mov    %edx,0x18(%ebx)
+  802b5f:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802b65:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802b68:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802b6e:	89 53 20             	mov    %edx,0x20(%ebx)
+  802b71:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802b77:	89 53 24             	mov    %edx,0x24(%ebx)
+  802b7a:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802b80:	89 53 28             	mov    %edx,0x28(%ebx)
+  802b83:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802b89:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802b8c:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802b92:	89 53 30             	mov    %edx,0x30(%ebx)
+  802b95:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802b9b:	89 53 34             	mov    %edx,0x34(%ebx)
+  802b9e:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802ba4:	89 53 38             	mov    %edx,0x38(%ebx)
+  802ba7:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802bad:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802bb0:	83 c4 0c             	add    $0xc,%esp
+  802bb3:	5b                   	pop    %ebx
+  802bb4:	5e                   	pop    %esi
+  802bb5:	5f                   	pop    %edi
+  802bb6:	5d                   	pop    %ebp
+  802bb7:	c3                   	ret
+
+00802bb8 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802bbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc1:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802bc6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bc9:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802bce:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bd1:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802bd6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802bdb:	e8 46 f4 ff ff       	call   802026 <nsipc>
+}
+  802be0:	c9                   	leave
+  802be1:	c3                   	ret
+
+00802be2 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802be2:	55                   	push   %ebp
+  802be3:	89 e5                	mov    %esp,%ebp
+  802be5:	56                   	push   %esi
+  802be6:	53                   	push   %ebx
+  802be7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802bea:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802bf0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802bf3:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802bf8:	b8 10 00 00 00       	mov    $0x10,%eax
+  802bfd:	e8 24 f4 ff ff       	call   802026 <nsipc>
+  802c02:	89 c3                	mov    %eax,%ebx
+  802c04:	85 c0                	test   %eax,%eax
+  802c06:	7e 1f                	jle    802c27 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802c08:	39 c6                	cmp    %eax,%esi
+  802c0a:	7c 24                	jl     802c30 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802c0c:	83 ec 04             	sub    $0x4,%esp
+  802c0f:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802c16:	50                   	push   %eax
+  802c17:	68 00 80 80 00       	push   $0x808000
+  802c1c:	ff 75 08             	push   0x8(%ebp)
+  802c1f:	e8 ea df ff ff       	call   800c0e <memmove>
+  802c24:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c27:	89 d8                	mov    %ebx,%eax
+  802c29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c2c:	5b                   	pop    %ebx
+  802c2d:	5e                   	pop    %esi
+  802c2e:	5d                   	pop    %ebp
+  802c2f:	c3                   	ret
+		assert(r <= max);
+  802c30:	68 76 41 80 00       	push   $0x804176
+  802c35:	68 49 41 80 00       	push   $0x804149
+  802c3a:	68 6a 01 00 00       	push   $0x16a
+  802c3f:	68 5e 41 80 00       	push   $0x80415e
+  802c44:	e8 43 d6 ff ff       	call   80028c <_panic>
+
+00802c49 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802c4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c52:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802c57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c5a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802c5f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c62:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802c67:	b8 09 00 00 00       	mov    $0x9,%eax
+  802c6c:	e8 b5 f3 ff ff       	call   802026 <nsipc>
+}
+  802c71:	c9                   	leave
+  802c72:	c3                   	ret
+
+00802c73 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802c73:	55                   	push   %ebp
+  802c74:	89 e5                	mov    %esp,%ebp
+  802c76:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802c81:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802c86:	e8 9b f3 ff ff       	call   802026 <nsipc>
+}
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+
+00802c8d <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802c8d:	55                   	push   %ebp
+  802c8e:	89 e5                	mov    %esp,%ebp
+  802c90:	53                   	push   %ebx
+  802c91:	83 ec 04             	sub    $0x4,%esp
+  802c94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802c97:	b8 12 00 00 00       	mov    $0x12,%eax
+  802c9c:	e8 85 f3 ff ff       	call   802026 <nsipc>
+  802ca1:	85 c0                	test   %eax,%eax
+  802ca3:	78 50                	js     802cf5 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802ca5:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802cab:	89 13                	mov    %edx,(%ebx)
+  802cad:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802cb3:	89 53 04             	mov    %edx,0x4(%ebx)
+  802cb6:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802cbc:	89 53 08             	mov    %edx,0x8(%ebx)
+  802cbf:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802cc5:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802cc8:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802cce:	89 53 10             	mov    %edx,0x10(%ebx)
+  802cd1:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802cd7:	89 53 14             	mov    %edx,0x14(%ebx)
+  802cda:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802ce0:	89 53 18             	mov    %edx,0x18(%ebx)
+  802ce3:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802ce9:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802cec:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802cf2:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802cf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf8:	c9                   	leave
+  802cf9:	c3                   	ret
+
+00802cfa <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802cfa:	55                   	push   %ebp
+  802cfb:	89 e5                	mov    %esp,%ebp
+  802cfd:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d00:	6a 03                	push   $0x3
+  802d02:	e8 bf 0c 00 00       	call   8039c6 <ipc_find_env>
+  802d07:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802d0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d0f:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802d14:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802d19:	e8 08 f3 ff ff       	call   802026 <nsipc>
+  802d1e:	83 c4 10             	add    $0x10,%esp
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	78 0a                	js     802d2f <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802d25:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802d2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d2f:	c9                   	leave
+  802d30:	c3                   	ret
+
+00802d31 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802d31:	55                   	push   %ebp
+  802d32:	89 e5                	mov    %esp,%ebp
+  802d34:	57                   	push   %edi
+  802d35:	56                   	push   %esi
+  802d36:	53                   	push   %ebx
+  802d37:	83 ec 1c             	sub    $0x1c,%esp
+  802d3a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802d3d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802d40:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802d45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d4a:	89 e0                	mov    %esp,%eax
+  802d4c:	89 f2                	mov    %esi,%edx
+  802d4e:	29 c2                	sub    %eax,%edx
+  802d50:	89 d0                	mov    %edx,%eax
+  802d52:	c1 e8 0f             	shr    $0xf,%eax
+  802d55:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802d5b:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802d5e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802d65:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802d68:	83 ec 0c             	sub    $0xc,%esp
+  802d6b:	ff 75 e0             	push   -0x20(%ebp)
+  802d6e:	e8 92 0c 00 00       	call   803a05 <pageref>
+  802d73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d76:	83 c4 04             	add    $0x4,%esp
+  802d79:	ff 75 dc             	push   -0x24(%ebp)
+  802d7c:	e8 84 0c 00 00       	call   803a05 <pageref>
+  802d81:	89 e2                	mov    %esp,%edx
+  802d83:	89 f1                	mov    %esi,%ecx
+  802d85:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802d87:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802d8a:	89 ca                	mov    %ecx,%edx
+  802d8c:	c1 ea 0f             	shr    $0xf,%edx
+  802d8f:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802d95:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802d98:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802d9f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802da2:	39 d7                	cmp    %edx,%edi
+  802da4:	74 40                	je     802de6 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802da6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802da9:	75 9f                	jne    802d4a <_pipeisclosed+0x19>
+  802dab:	89 e2                	mov    %esp,%edx
+  802dad:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802db2:	29 d0                	sub    %edx,%eax
+  802db4:	89 c2                	mov    %eax,%edx
+  802db6:	c1 ea 0f             	shr    $0xf,%edx
+  802db9:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc3:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802dc6:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802dcd:	8b 40 58             	mov    0x58(%eax),%eax
+  802dd0:	6a 01                	push   $0x1
+  802dd2:	50                   	push   %eax
+  802dd3:	57                   	push   %edi
+  802dd4:	68 7f 41 80 00       	push   $0x80417f
+  802dd9:	e8 89 d5 ff ff       	call   800367 <cprintf>
+  802dde:	83 c4 10             	add    $0x10,%esp
+  802de1:	e9 5f ff ff ff       	jmp    802d45 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802de6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802de9:	0f 94 c0             	sete   %al
+  802dec:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df2:	5b                   	pop    %ebx
+  802df3:	5e                   	pop    %esi
+  802df4:	5f                   	pop    %edi
+  802df5:	5d                   	pop    %ebp
+  802df6:	c3                   	ret
+
+00802df7 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	53                   	push   %ebx
+  802dfb:	83 ec 0c             	sub    $0xc,%esp
+  802dfe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802e01:	53                   	push   %ebx
+  802e02:	6a 00                	push   $0x0
+  802e04:	e8 0e e1 ff ff       	call   800f17 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802e09:	89 1c 24             	mov    %ebx,(%esp)
+  802e0c:	e8 f4 e4 ff ff       	call   801305 <fd2data>
+  802e11:	83 c4 08             	add    $0x8,%esp
+  802e14:	50                   	push   %eax
+  802e15:	6a 00                	push   $0x0
+  802e17:	e8 fb e0 ff ff       	call   800f17 <sys_page_unmap>
+}
+  802e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e1f:	c9                   	leave
+  802e20:	c3                   	ret
+
+00802e21 <devpipe_read>:
+{
+  802e21:	55                   	push   %ebp
+  802e22:	89 e5                	mov    %esp,%ebp
+  802e24:	57                   	push   %edi
+  802e25:	56                   	push   %esi
+  802e26:	53                   	push   %ebx
+  802e27:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802e2a:	ff 75 08             	push   0x8(%ebp)
+  802e2d:	e8 d3 e4 ff ff       	call   801305 <fd2data>
+  802e32:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e34:	8b 70 04             	mov    0x4(%eax),%esi
+  802e37:	8b 00                	mov    (%eax),%eax
+  802e39:	83 c4 10             	add    $0x10,%esp
+  802e3c:	39 f0                	cmp    %esi,%eax
+  802e3e:	75 36                	jne    802e76 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802e40:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802e43:	89 da                	mov    %ebx,%edx
+  802e45:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e48:	e8 e4 fe ff ff       	call   802d31 <_pipeisclosed>
+  802e4d:	85 c0                	test   %eax,%eax
+  802e4f:	0f 85 d4 00 00 00    	jne    802f29 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802e55:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e5a:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802e5e:	83 ec 04             	sub    $0x4,%esp
+  802e61:	6a ff                	push   $0xffffffff
+  802e63:	56                   	push   %esi
+  802e64:	57                   	push   %edi
+  802e65:	e8 26 e4 ff ff       	call   801290 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802e6a:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e6d:	8b 03                	mov    (%ebx),%eax
+  802e6f:	83 c4 10             	add    $0x10,%esp
+  802e72:	39 c6                	cmp    %eax,%esi
+  802e74:	74 cd                	je     802e43 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e76:	8b 73 04             	mov    0x4(%ebx),%esi
+  802e79:	8b 03                	mov    (%ebx),%eax
+  802e7b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802e81:	29 c6                	sub    %eax,%esi
+  802e83:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e88:	f7 e6                	mul    %esi
+  802e8a:	c1 ea 0c             	shr    $0xc,%edx
+  802e8d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e93:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802e95:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e98:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802e9c:	8b 0b                	mov    (%ebx),%ecx
+  802e9e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ea3:	f7 e1                	mul    %ecx
+  802ea5:	c1 ea 0b             	shr    $0xb,%edx
+  802ea8:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802eae:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802eb0:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802eb5:	29 cf                	sub    %ecx,%edi
+  802eb7:	39 f7                	cmp    %esi,%edi
+  802eb9:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802ebc:	83 ec 04             	sub    $0x4,%esp
+  802ebf:	57                   	push   %edi
+  802ec0:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802ec4:	50                   	push   %eax
+  802ec5:	ff 75 0c             	push   0xc(%ebp)
+  802ec8:	e8 41 dd ff ff       	call   800c0e <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802ecd:	83 c4 0c             	add    $0xc,%esp
+  802ed0:	89 f0                	mov    %esi,%eax
+  802ed2:	29 f8                	sub    %edi,%eax
+  802ed4:	50                   	push   %eax
+  802ed5:	8d 43 10             	lea    0x10(%ebx),%eax
+  802ed8:	50                   	push   %eax
+  802ed9:	89 f8                	mov    %edi,%eax
+  802edb:	03 45 0c             	add    0xc(%ebp),%eax
+  802ede:	50                   	push   %eax
+  802edf:	e8 2a dd ff ff       	call   800c0e <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802ee4:	8b 0b                	mov    (%ebx),%ecx
+  802ee6:	01 f1                	add    %esi,%ecx
+  802ee8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eed:	f7 e1                	mul    %ecx
+  802eef:	c1 ea 0c             	shr    $0xc,%edx
+  802ef2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802ef8:	29 c1                	sub    %eax,%ecx
+  802efa:	89 0b                	mov    %ecx,(%ebx)
+  802efc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f01:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802f05:	83 c4 10             	add    $0x10,%esp
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	75 0a                	jne    802f16 <devpipe_read+0xf5>
+	return n;
+  802f0c:	89 f0                	mov    %esi,%eax
+}
+  802f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f11:	5b                   	pop    %ebx
+  802f12:	5e                   	pop    %esi
+  802f13:	5f                   	pop    %edi
+  802f14:	5d                   	pop    %ebp
+  802f15:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802f16:	83 ec 08             	sub    $0x8,%esp
+  802f19:	68 00 04 00 00       	push   $0x400
+  802f1e:	53                   	push   %ebx
+  802f1f:	e8 8e e3 ff ff       	call   8012b2 <sys_futex_wake>
+  802f24:	83 c4 10             	add    $0x10,%esp
+  802f27:	eb e3                	jmp    802f0c <devpipe_read+0xeb>
+			return 0;
+  802f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2e:	eb de                	jmp    802f0e <devpipe_read+0xed>
+
+00802f30 <devpipe_write>:
+{
+  802f30:	55                   	push   %ebp
+  802f31:	89 e5                	mov    %esp,%ebp
+  802f33:	57                   	push   %edi
+  802f34:	56                   	push   %esi
+  802f35:	53                   	push   %ebx
+  802f36:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802f39:	ff 75 08             	push   0x8(%ebp)
+  802f3c:	e8 c4 e3 ff ff       	call   801305 <fd2data>
+  802f41:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802f43:	83 c4 10             	add    $0x10,%esp
+  802f46:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f4d:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802f52:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f56:	0f 84 43 01 00 00    	je     80309f <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f5c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f5f:	8b 06                	mov    (%esi),%eax
+  802f61:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f67:	29 c1                	sub    %eax,%ecx
+  802f69:	89 c8                	mov    %ecx,%eax
+  802f6b:	f7 e7                	mul    %edi
+  802f6d:	c1 ea 0c             	shr    $0xc,%edx
+  802f70:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f76:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802f78:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802f7e:	75 52                	jne    802fd2 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802f80:	89 f2                	mov    %esi,%edx
+  802f82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f85:	e8 a7 fd ff ff       	call   802d31 <_pipeisclosed>
+  802f8a:	85 c0                	test   %eax,%eax
+  802f8c:	0f 85 28 01 00 00    	jne    8030ba <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802f92:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802f94:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f97:	8b 06                	mov    (%esi),%eax
+  802f99:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802f9f:	29 c1                	sub    %eax,%ecx
+  802fa1:	89 c8                	mov    %ecx,%eax
+  802fa3:	f7 e7                	mul    %edi
+  802fa5:	c1 ea 0c             	shr    $0xc,%edx
+  802fa8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fae:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802fb0:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802fb6:	75 a4                	jne    802f5c <devpipe_write+0x2c>
+  802fb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fbd:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802fc1:	83 ec 04             	sub    $0x4,%esp
+  802fc4:	6a ff                	push   $0xffffffff
+  802fc6:	53                   	push   %ebx
+  802fc7:	56                   	push   %esi
+  802fc8:	e8 c3 e2 ff ff       	call   801290 <sys_futex_wait>
+}
+  802fcd:	83 c4 10             	add    $0x10,%esp
+  802fd0:	eb 8a                	jmp    802f5c <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fd2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fd5:	8b 06                	mov    (%esi),%eax
+  802fd7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fdd:	29 c1                	sub    %eax,%ecx
+  802fdf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802fe4:	f7 e1                	mul    %ecx
+  802fe6:	c1 ea 0c             	shr    $0xc,%edx
+  802fe9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fef:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802ff1:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802ff6:	89 d8                	mov    %ebx,%eax
+  802ff8:	29 c8                	sub    %ecx,%eax
+  802ffa:	8b 55 10             	mov    0x10(%ebp),%edx
+  802ffd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803000:	29 ca                	sub    %ecx,%edx
+  803002:	39 d0                	cmp    %edx,%eax
+  803004:	0f 46 d0             	cmovbe %eax,%edx
+  803007:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  80300a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80300d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803012:	f7 e1                	mul    %ecx
+  803014:	c1 ea 0b             	shr    $0xb,%edx
+  803017:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80301d:	89 ca                	mov    %ecx,%edx
+  80301f:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  803021:	29 d3                	sub    %edx,%ebx
+  803023:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803026:	39 c3                	cmp    %eax,%ebx
+  803028:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  80302b:	83 ec 04             	sub    $0x4,%esp
+  80302e:	53                   	push   %ebx
+  80302f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803032:	03 4d 0c             	add    0xc(%ebp),%ecx
+  803035:	51                   	push   %ecx
+  803036:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  80303a:	50                   	push   %eax
+  80303b:	e8 ce db ff ff       	call   800c0e <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  803040:	83 c4 0c             	add    $0xc,%esp
+  803043:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803046:	29 d8                	sub    %ebx,%eax
+  803048:	50                   	push   %eax
+  803049:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80304c:	01 cb                	add    %ecx,%ebx
+  80304e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  803051:	53                   	push   %ebx
+  803052:	8d 46 10             	lea    0x10(%esi),%eax
+  803055:	50                   	push   %eax
+  803056:	e8 b3 db ff ff       	call   800c0e <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  80305b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80305e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803061:	01 c1                	add    %eax,%ecx
+  803063:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  803068:	f7 e1                	mul    %ecx
+  80306a:	c1 ea 0c             	shr    $0xc,%edx
+  80306d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  803073:	89 ca                	mov    %ecx,%edx
+  803075:	29 c2                	sub    %eax,%edx
+  803077:	89 56 04             	mov    %edx,0x4(%esi)
+  80307a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80307f:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  803083:	83 c4 10             	add    $0x10,%esp
+  803086:	85 c0                	test   %eax,%eax
+  803088:	75 1a                	jne    8030a4 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  80308a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80308d:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  803090:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803093:	3b 45 10             	cmp    0x10(%ebp),%eax
+  803096:	0f 82 c0 fe ff ff    	jb     802f5c <devpipe_write+0x2c>
+  80309c:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  80309f:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030a2:	eb 1b                	jmp    8030bf <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  8030a4:	83 ec 08             	sub    $0x8,%esp
+  8030a7:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  8030ac:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  8030af:	50                   	push   %eax
+  8030b0:	e8 fd e1 ff ff       	call   8012b2 <sys_futex_wake>
+  8030b5:	83 c4 10             	add    $0x10,%esp
+  8030b8:	eb d0                	jmp    80308a <devpipe_write+0x15a>
+				return 0;
+  8030ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c2:	5b                   	pop    %ebx
+  8030c3:	5e                   	pop    %esi
+  8030c4:	5f                   	pop    %edi
+  8030c5:	5d                   	pop    %ebp
+  8030c6:	c3                   	ret
+
+008030c7 <devpipe_stat>:
+{
+  8030c7:	55                   	push   %ebp
+  8030c8:	89 e5                	mov    %esp,%ebp
+  8030ca:	56                   	push   %esi
+  8030cb:	53                   	push   %ebx
+  8030cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8030cf:	83 ec 0c             	sub    $0xc,%esp
+  8030d2:	ff 75 08             	push   0x8(%ebp)
+  8030d5:	e8 2b e2 ff ff       	call   801305 <fd2data>
+  8030da:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8030dc:	83 c4 08             	add    $0x8,%esp
+  8030df:	68 92 41 80 00       	push   $0x804192
+  8030e4:	53                   	push   %ebx
+  8030e5:	e8 74 d9 ff ff       	call   800a5e <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8030ea:	8b 4e 04             	mov    0x4(%esi),%ecx
+  8030ed:	8b 06                	mov    (%esi),%eax
+  8030ef:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  8030f5:	29 c1                	sub    %eax,%ecx
+  8030f7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8030fc:	89 c8                	mov    %ecx,%eax
+  8030fe:	f7 e2                	mul    %edx
+  803100:	c1 ea 0c             	shr    $0xc,%edx
+  803103:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803109:	29 d1                	sub    %edx,%ecx
+  80310b:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  803111:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803118:	00 00 00 
+	stat->st_dev = &devpipe;
+  80311b:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  803122:	50 80 00 
+}
+  803125:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80312d:	5b                   	pop    %ebx
+  80312e:	5e                   	pop    %esi
+  80312f:	5d                   	pop    %ebp
+  803130:	c3                   	ret
+
+00803131 <devpipe_poll>:
+{
+  803131:	55                   	push   %ebp
+  803132:	89 e5                	mov    %esp,%ebp
+  803134:	57                   	push   %edi
+  803135:	56                   	push   %esi
+  803136:	53                   	push   %ebx
+  803137:	83 ec 18             	sub    $0x18,%esp
+  80313a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80313d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803140:	57                   	push   %edi
+  803141:	e8 bf e1 ff ff       	call   801305 <fd2data>
+  803146:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803148:	83 c4 10             	add    $0x10,%esp
+  80314b:	89 f3                	mov    %esi,%ebx
+  80314d:	83 e3 01             	and    $0x1,%ebx
+  803150:	75 27                	jne    803179 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803152:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803158:	75 48                	jne    8031a2 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80315a:	89 ca                	mov    %ecx,%edx
+  80315c:	89 f8                	mov    %edi,%eax
+  80315e:	e8 ce fb ff ff       	call   802d31 <_pipeisclosed>
+  803163:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803165:	89 d8                	mov    %ebx,%eax
+  803167:	83 c8 10             	or     $0x10,%eax
+  80316a:	85 d2                	test   %edx,%edx
+  80316c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80316f:	89 d8                	mov    %ebx,%eax
+  803171:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803174:	5b                   	pop    %ebx
+  803175:	5e                   	pop    %esi
+  803176:	5f                   	pop    %edi
+  803177:	5d                   	pop    %ebp
+  803178:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803179:	8b 58 04             	mov    0x4(%eax),%ebx
+  80317c:	8b 00                	mov    (%eax),%eax
+  80317e:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803184:	29 c3                	sub    %eax,%ebx
+  803186:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80318b:	89 d8                	mov    %ebx,%eax
+  80318d:	f7 e2                	mul    %edx
+  80318f:	c1 ea 0c             	shr    $0xc,%edx
+  803192:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803198:	39 d3                	cmp    %edx,%ebx
+  80319a:	0f 95 c3             	setne  %bl
+  80319d:	0f b6 db             	movzbl %bl,%ebx
+  8031a0:	eb b0                	jmp    803152 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  8031a2:	8b 71 04             	mov    0x4(%ecx),%esi
+  8031a5:	8b 01                	mov    (%ecx),%eax
+  8031a7:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  8031ad:	29 c6                	sub    %eax,%esi
+  8031af:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8031b4:	89 f0                	mov    %esi,%eax
+  8031b6:	f7 e2                	mul    %edx
+  8031b8:	c1 ea 0c             	shr    $0xc,%edx
+  8031bb:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8031c1:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  8031c3:	89 d8                	mov    %ebx,%eax
+  8031c5:	83 c8 04             	or     $0x4,%eax
+  8031c8:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  8031ce:	0f 42 d8             	cmovb  %eax,%ebx
+  8031d1:	eb 87                	jmp    80315a <devpipe_poll+0x29>
+
+008031d3 <pipe>:
+{
+  8031d3:	55                   	push   %ebp
+  8031d4:	89 e5                	mov    %esp,%ebp
+  8031d6:	56                   	push   %esi
+  8031d7:	53                   	push   %ebx
+  8031d8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8031db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031de:	50                   	push   %eax
+  8031df:	e8 38 e1 ff ff       	call   80131c <fd_alloc>
+  8031e4:	89 c3                	mov    %eax,%ebx
+  8031e6:	83 c4 10             	add    $0x10,%esp
+  8031e9:	85 c0                	test   %eax,%eax
+  8031eb:	0f 88 23 01 00 00    	js     803314 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031f1:	83 ec 04             	sub    $0x4,%esp
+  8031f4:	68 07 04 00 00       	push   $0x407
+  8031f9:	ff 75 f4             	push   -0xc(%ebp)
+  8031fc:	6a 00                	push   $0x0
+  8031fe:	e8 8f dc ff ff       	call   800e92 <sys_page_alloc>
+  803203:	89 c3                	mov    %eax,%ebx
+  803205:	83 c4 10             	add    $0x10,%esp
+  803208:	85 c0                	test   %eax,%eax
+  80320a:	0f 88 04 01 00 00    	js     803314 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803210:	83 ec 0c             	sub    $0xc,%esp
+  803213:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803216:	50                   	push   %eax
+  803217:	e8 00 e1 ff ff       	call   80131c <fd_alloc>
+  80321c:	89 c3                	mov    %eax,%ebx
+  80321e:	83 c4 10             	add    $0x10,%esp
+  803221:	85 c0                	test   %eax,%eax
+  803223:	0f 88 db 00 00 00    	js     803304 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803229:	83 ec 04             	sub    $0x4,%esp
+  80322c:	68 07 04 00 00       	push   $0x407
+  803231:	ff 75 f0             	push   -0x10(%ebp)
+  803234:	6a 00                	push   $0x0
+  803236:	e8 57 dc ff ff       	call   800e92 <sys_page_alloc>
+  80323b:	89 c3                	mov    %eax,%ebx
+  80323d:	83 c4 10             	add    $0x10,%esp
+  803240:	85 c0                	test   %eax,%eax
+  803242:	0f 88 bc 00 00 00    	js     803304 <pipe+0x131>
+	va = fd2data(fd0);
+  803248:	83 ec 0c             	sub    $0xc,%esp
+  80324b:	ff 75 f4             	push   -0xc(%ebp)
+  80324e:	e8 b2 e0 ff ff       	call   801305 <fd2data>
+  803253:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803255:	83 c4 0c             	add    $0xc,%esp
+  803258:	68 07 04 00 00       	push   $0x407
+  80325d:	50                   	push   %eax
+  80325e:	6a 00                	push   $0x0
+  803260:	e8 2d dc ff ff       	call   800e92 <sys_page_alloc>
+  803265:	89 c3                	mov    %eax,%ebx
+  803267:	83 c4 10             	add    $0x10,%esp
+  80326a:	85 c0                	test   %eax,%eax
+  80326c:	0f 88 82 00 00 00    	js     8032f4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803272:	83 ec 0c             	sub    $0xc,%esp
+  803275:	ff 75 f0             	push   -0x10(%ebp)
+  803278:	e8 88 e0 ff ff       	call   801305 <fd2data>
+  80327d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803284:	50                   	push   %eax
+  803285:	6a 00                	push   $0x0
+  803287:	56                   	push   %esi
+  803288:	6a 00                	push   $0x0
+  80328a:	e8 46 dc ff ff       	call   800ed5 <sys_page_map>
+  80328f:	89 c3                	mov    %eax,%ebx
+  803291:	83 c4 20             	add    $0x20,%esp
+  803294:	85 c0                	test   %eax,%eax
+  803296:	78 4e                	js     8032e6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803298:	a1 60 50 80 00       	mov    0x805060,%eax
+  80329d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032a0:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8032a2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8032a5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8032ac:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8032af:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8032b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8032b4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8032bb:	83 ec 0c             	sub    $0xc,%esp
+  8032be:	ff 75 f4             	push   -0xc(%ebp)
+  8032c1:	e8 2f e0 ff ff       	call   8012f5 <fd2num>
+  8032c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032c9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8032cb:	83 c4 04             	add    $0x4,%esp
+  8032ce:	ff 75 f0             	push   -0x10(%ebp)
+  8032d1:	e8 1f e0 ff ff       	call   8012f5 <fd2num>
+  8032d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8032d9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8032dc:	83 c4 10             	add    $0x10,%esp
+  8032df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032e4:	eb 2e                	jmp    803314 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8032e6:	83 ec 08             	sub    $0x8,%esp
+  8032e9:	56                   	push   %esi
+  8032ea:	6a 00                	push   $0x0
+  8032ec:	e8 26 dc ff ff       	call   800f17 <sys_page_unmap>
+  8032f1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8032f4:	83 ec 08             	sub    $0x8,%esp
+  8032f7:	ff 75 f0             	push   -0x10(%ebp)
+  8032fa:	6a 00                	push   $0x0
+  8032fc:	e8 16 dc ff ff       	call   800f17 <sys_page_unmap>
+  803301:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803304:	83 ec 08             	sub    $0x8,%esp
+  803307:	ff 75 f4             	push   -0xc(%ebp)
+  80330a:	6a 00                	push   $0x0
+  80330c:	e8 06 dc ff ff       	call   800f17 <sys_page_unmap>
+  803311:	83 c4 10             	add    $0x10,%esp
+}
+  803314:	89 d8                	mov    %ebx,%eax
+  803316:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803319:	5b                   	pop    %ebx
+  80331a:	5e                   	pop    %esi
+  80331b:	5d                   	pop    %ebp
+  80331c:	c3                   	ret
+
+0080331d <pipeisclosed>:
+{
+  80331d:	55                   	push   %ebp
+  80331e:	89 e5                	mov    %esp,%ebp
+  803320:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803323:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803326:	50                   	push   %eax
+  803327:	ff 75 08             	push   0x8(%ebp)
+  80332a:	e8 3d e0 ff ff       	call   80136c <fd_lookup>
+  80332f:	83 c4 10             	add    $0x10,%esp
+  803332:	85 c0                	test   %eax,%eax
+  803334:	78 18                	js     80334e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803336:	83 ec 0c             	sub    $0xc,%esp
+  803339:	ff 75 f4             	push   -0xc(%ebp)
+  80333c:	e8 c4 df ff ff       	call   801305 <fd2data>
+  803341:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803343:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803346:	e8 e6 f9 ff ff       	call   802d31 <_pipeisclosed>
+  80334b:	83 c4 10             	add    $0x10,%esp
+}
+  80334e:	c9                   	leave
+  80334f:	c3                   	ret
+
+00803350 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803350:	55                   	push   %ebp
+  803351:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803353:	8b 45 08             	mov    0x8(%ebp),%eax
+  803356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80335c:	5d                   	pop    %ebp
+  80335d:	c3                   	ret
+
+0080335e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80335e:	55                   	push   %ebp
+  80335f:	89 e5                	mov    %esp,%ebp
+  803361:	53                   	push   %ebx
+  803362:	83 ec 04             	sub    $0x4,%esp
+  803365:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803368:	8b 03                	mov    (%ebx),%eax
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	75 05                	jne    803373 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80336e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803371:	c9                   	leave
+  803372:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803373:	83 ec 08             	sub    $0x8,%esp
+  803376:	50                   	push   %eax
+  803377:	8d 43 04             	lea    0x4(%ebx),%eax
+  80337a:	50                   	push   %eax
+  80337b:	e8 e7 dd ff ff       	call   801167 <sys_page_batch>
+	pb->pb_n = 0;
+  803380:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	eb e3                	jmp    80336e <pgbatch_flush+0x10>
+
+0080338b <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80338b:	55                   	push   %ebp
+  80338c:	89 e5                	mov    %esp,%ebp
+  80338e:	56                   	push   %esi
+  80338f:	53                   	push   %ebx
+  803390:	89 c3                	mov    %eax,%ebx
+  803392:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803394:	83 38 20             	cmpl   $0x20,(%eax)
+  803397:	74 2c                	je     8033c5 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803399:	8b 03                	mov    (%ebx),%eax
+  80339b:	8d 50 01             	lea    0x1(%eax),%edx
+  80339e:	89 13                	mov    %edx,(%ebx)
+  8033a0:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8033a3:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  8033a7:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  8033a9:	83 ec 04             	sub    $0x4,%esp
+  8033ac:	6a 18                	push   $0x18
+  8033ae:	6a 00                	push   $0x0
+  8033b0:	50                   	push   %eax
+  8033b1:	e8 23 d8 ff ff       	call   800bd9 <memset>
+	return 0;
+  8033b6:	83 c4 10             	add    $0x10,%esp
+  8033b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033c1:	5b                   	pop    %ebx
+  8033c2:	5e                   	pop    %esi
+  8033c3:	5d                   	pop    %ebp
+  8033c4:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  8033c5:	83 ec 0c             	sub    $0xc,%esp
+  8033c8:	50                   	push   %eax
+  8033c9:	e8 90 ff ff ff       	call   80335e <pgbatch_flush>
+  8033ce:	83 c4 10             	add    $0x10,%esp
+  8033d1:	85 c0                	test   %eax,%eax
+  8033d3:	79 c4                	jns    803399 <pgbatch_slot+0xe>
+  8033d5:	eb e7                	jmp    8033be <pgbatch_slot+0x33>
+
+008033d7 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8033d7:	55                   	push   %ebp
+  8033d8:	89 e5                	mov    %esp,%ebp
+  8033da:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8033dd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8033e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033e3:	e8 a3 ff ff ff       	call   80338b <pgbatch_slot>
+  8033e8:	85 c0                	test   %eax,%eax
+  8033ea:	78 20                	js     80340c <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8033ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033ef:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8033f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033f8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8033fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033fe:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803401:	8b 55 14             	mov    0x14(%ebp),%edx
+  803404:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803407:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80340c:	c9                   	leave
+  80340d:	c3                   	ret
+
+0080340e <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  80340e:	55                   	push   %ebp
+  80340f:	89 e5                	mov    %esp,%ebp
+  803411:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803414:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803417:	8b 45 08             	mov    0x8(%ebp),%eax
+  80341a:	e8 6c ff ff ff       	call   80338b <pgbatch_slot>
+  80341f:	85 c0                	test   %eax,%eax
+  803421:	78 2c                	js     80344f <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  803423:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803426:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  80342c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80342f:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803432:	8b 55 10             	mov    0x10(%ebp),%edx
+  803435:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803438:	8b 55 14             	mov    0x14(%ebp),%edx
+  80343b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80343e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803441:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803444:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803447:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80344a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80344f:	c9                   	leave
+  803450:	c3                   	ret
+
+00803451 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803451:	55                   	push   %ebp
+  803452:	89 e5                	mov    %esp,%ebp
+  803454:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803457:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80345a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80345d:	e8 29 ff ff ff       	call   80338b <pgbatch_slot>
+  803462:	85 c0                	test   %eax,%eax
+  803464:	78 1a                	js     803480 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803469:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80346f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803472:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803475:	8b 55 10             	mov    0x10(%ebp),%edx
+  803478:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803480:	c9                   	leave
+  803481:	c3                   	ret
+
+00803482 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803482:	55                   	push   %ebp
+  803483:	89 e5                	mov    %esp,%ebp
+  803485:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803488:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80348b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80348e:	e8 f8 fe ff ff       	call   80338b <pgbatch_slot>
+  803493:	85 c0                	test   %eax,%eax
+  803495:	78 20                	js     8034b7 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803497:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80349a:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  8034a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034a3:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8034a6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034a9:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8034ac:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034af:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034b7:	c9                   	leave
+  8034b8:	c3                   	ret
+
+008034b9 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  8034b9:	55                   	push   %ebp
+  8034ba:	89 e5                	mov    %esp,%ebp
+  8034bc:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8034bf:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8034c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034c5:	e8 c1 fe ff ff       	call   80338b <pgbatch_slot>
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	78 26                	js     8034f4 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  8034ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d1:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8034d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034da:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8034dd:	8b 55 10             	mov    0x10(%ebp),%edx
+  8034e0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8034e3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8034e6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8034e9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8034ec:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8034ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+
+008034f6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8034f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fb:	c3                   	ret
+
+008034fc <devcons_poll>:
+{
+  8034fc:	55                   	push   %ebp
+  8034fd:	89 e5                	mov    %esp,%ebp
+  8034ff:	53                   	push   %ebx
+  803500:	83 ec 04             	sub    $0x4,%esp
+  803503:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803506:	89 da                	mov    %ebx,%edx
+  803508:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  80350b:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  803512:	74 0c                	je     803520 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  803514:	89 d8                	mov    %ebx,%eax
+  803516:	83 e0 01             	and    $0x1,%eax
+  803519:	09 d0                	or     %edx,%eax
+}
+  80351b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+		cons_peek = sys_cgetc();
+  803520:	e8 cf d8 ff ff       	call   800df4 <sys_cgetc>
+  803525:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  80352a:	89 da                	mov    %ebx,%edx
+  80352c:	83 e2 04             	and    $0x4,%edx
+  80352f:	85 c0                	test   %eax,%eax
+  803531:	74 e6                	je     803519 <devcons_poll+0x1d>
+  803533:	eb df                	jmp    803514 <devcons_poll+0x18>
+
+00803535 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803535:	55                   	push   %ebp
+  803536:	89 e5                	mov    %esp,%ebp
+  803538:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80353b:	68 9e 41 80 00       	push   $0x80419e
+  803540:	ff 75 0c             	push   0xc(%ebp)
+  803543:	e8 16 d5 ff ff       	call   800a5e <strcpy>
+	return 0;
+}
+  803548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354d:	c9                   	leave
+  80354e:	c3                   	ret
+
+0080354f <devcons_write>:
+{
+  80354f:	55                   	push   %ebp
+  803550:	89 e5                	mov    %esp,%ebp
+  803552:	57                   	push   %edi
+  803553:	56                   	push   %esi
+  803554:	53                   	push   %ebx
+  803555:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80355b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80355e:	85 ff                	test   %edi,%edi
+  803560:	74 51                	je     8035b3 <devcons_write+0x64>
+  803562:	be 00 00 00 00       	mov    $0x0,%esi
+  803567:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80356c:	89 fb                	mov    %edi,%ebx
+  80356e:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803570:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803575:	39 d3                	cmp    %edx,%ebx
+  803577:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80357a:	83 ec 04             	sub    $0x4,%esp
+  80357d:	53                   	push   %ebx
+  80357e:	03 45 0c             	add    0xc(%ebp),%eax
+  803581:	50                   	push   %eax
+  803582:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803588:	50                   	push   %eax
+  803589:	e8 80 d6 ff ff       	call   800c0e <memmove>
+		sys_cputs(buf, m);
+  80358e:	83 c4 08             	add    $0x8,%esp
+  803591:	53                   	push   %ebx
+  803592:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803598:	50                   	push   %eax
+  803599:	e8 38 d8 ff ff       	call   800dd6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80359e:	01 de                	add    %ebx,%esi
+  8035a0:	89 f0                	mov    %esi,%eax
+  8035a2:	83 c4 10             	add    $0x10,%esp
+  8035a5:	39 fe                	cmp    %edi,%esi
+  8035a7:	72 c3                	jb     80356c <devcons_write+0x1d>
+}
+  8035a9:	89 f0                	mov    %esi,%eax
+  8035ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035ae:	5b                   	pop    %ebx
+  8035af:	5e                   	pop    %esi
+  8035b0:	5f                   	pop    %edi
+  8035b1:	5d                   	pop    %ebp
+  8035b2:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  8035b3:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  8035b8:	eb ef                	jmp    8035a9 <devcons_write+0x5a>
+
+008035ba <devcons_read>:
+{
+  8035ba:	55                   	push   %ebp
+  8035bb:	89 e5                	mov    %esp,%ebp
+  8035bd:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  8035c0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  8035c5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035c9:	74 36                	je     803601 <devcons_read+0x47>
+	c = cons_peek;
+  8035cb:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8035d0:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8035d7:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035da:	85 c0                	test   %eax,%eax
+  8035dc:	75 10                	jne    8035ee <devcons_read+0x34>
+  8035de:	e8 11 d8 ff ff       	call   800df4 <sys_cgetc>
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	75 07                	jne    8035ee <devcons_read+0x34>
+		sys_yield();
+  8035e7:	e8 87 d8 ff ff       	call   800e73 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8035ec:	eb f0                	jmp    8035de <devcons_read+0x24>
+	if (c < 0)
+  8035ee:	85 c0                	test   %eax,%eax
+  8035f0:	78 0f                	js     803601 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8035f2:	83 f8 04             	cmp    $0x4,%eax
+  8035f5:	74 0c                	je     803603 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8035f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035fa:	88 02                	mov    %al,(%edx)
+	return 1;
+  8035fc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803601:	c9                   	leave
+  803602:	c3                   	ret
+		return 0;
+  803603:	b8 00 00 00 00       	mov    $0x0,%eax
+  803608:	eb f7                	jmp    803601 <devcons_read+0x47>
+
+0080360a <cputchar>:
+{
+  80360a:	55                   	push   %ebp
+  80360b:	89 e5                	mov    %esp,%ebp
+  80360d:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803610:	8b 45 08             	mov    0x8(%ebp),%eax
+  803613:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803616:	6a 01                	push   $0x1
+  803618:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80361b:	50                   	push   %eax
+  80361c:	e8 b5 d7 ff ff       	call   800dd6 <sys_cputs>
+}
+  803621:	83 c4 10             	add    $0x10,%esp
+  803624:	c9                   	leave
+  803625:	c3                   	ret
+
+00803626 <getchar>:
+{
+  803626:	55                   	push   %ebp
+  803627:	89 e5                	mov    %esp,%ebp
+  803629:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80362c:	6a 01                	push   $0x1
+  80362e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803631:	50                   	push   %eax
+  803632:	6a 00                	push   $0x0
+  803634:	e8 b7 df ff ff       	call   8015f0 <read>
+	if (r < 0)
+  803639:	83 c4 10             	add    $0x10,%esp
+  80363c:	85 c0                	test   %eax,%eax
+  80363e:	78 06                	js     803646 <getchar+0x20>
+	if (r < 1)
+  803640:	74 06                	je     803648 <getchar+0x22>
+	return c;
+  803642:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803646:	c9                   	leave
+  803647:	c3                   	ret
+		return -E_EOF;
+  803648:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80364d:	eb f7                	jmp    803646 <getchar+0x20>
+
+0080364f <iscons>:
+{
+  80364f:	55                   	push   %ebp
+  803650:	89 e5                	mov    %esp,%ebp
+  803652:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803655:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803658:	50                   	push   %eax
+  803659:	ff 75 08             	push   0x8(%ebp)
+  80365c:	e8 0b dd ff ff       	call   80136c <fd_lookup>
+  803661:	83 c4 10             	add    $0x10,%esp
+  803664:	85 c0                	test   %eax,%eax
+  803666:	78 11                	js     803679 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803668:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80366b:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803671:	39 10                	cmp    %edx,(%eax)
+  803673:	0f 94 c0             	sete   %al
+  803676:	0f b6 c0             	movzbl %al,%eax
+}
+  803679:	c9                   	leave
+  80367a:	c3                   	ret
+
+0080367b <opencons>:
+{
+  80367b:	55                   	push   %ebp
+  80367c:	89 e5                	mov    %esp,%ebp
+  80367e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803681:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803684:	50                   	push   %eax
+  803685:	e8 92 dc ff ff       	call   80131c <fd_alloc>
+  80368a:	83 c4 10             	add    $0x10,%esp
+  80368d:	85 c0                	test   %eax,%eax
+  80368f:	78 3a                	js     8036cb <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803691:	83 ec 04             	sub    $0x4,%esp
+  803694:	68 07 04 00 00       	push   $0x407
+  803699:	ff 75 f4             	push   -0xc(%ebp)
+  80369c:	6a 00                	push   $0x0
+  80369e:	e8 ef d7 ff ff       	call   800e92 <sys_page_alloc>
+  8036a3:	83 c4 10             	add    $0x10,%esp
+  8036a6:	85 c0                	test   %eax,%eax
+  8036a8:	78 21                	js     8036cb <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8036aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036ad:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8036b3:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8036b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036b8:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8036bf:	83 ec 0c             	sub    $0xc,%esp
+  8036c2:	50                   	push   %eax
+  8036c3:	e8 2d dc ff ff       	call   8012f5 <fd2num>
+  8036c8:	83 c4 10             	add    $0x10,%esp
+}
+  8036cb:	c9                   	leave
+  8036cc:	c3                   	ret
+
+008036cd <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8036cd:	55                   	push   %ebp
+  8036ce:	89 e5                	mov    %esp,%ebp
+  8036d0:	56                   	push   %esi
+  8036d1:	53                   	push   %ebx
+  8036d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8036d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8036db:	85 c0                	test   %eax,%eax
+  8036dd:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036e2:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8036e5:	83 ec 0c             	sub    $0xc,%esp
+  8036e8:	50                   	push   %eax
+  8036e9:	e8 54 d9 ff ff       	call   801042 <sys_ipc_recv>
+  8036ee:	83 c4 10             	add    $0x10,%esp
+  8036f1:	85 c0                	test   %eax,%eax
+  8036f3:	0f 88 8b 00 00 00    	js     803784 <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  8036f9:	85 f6                	test   %esi,%esi
+  8036fb:	74 2a                	je     803727 <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  8036fd:	89 e2                	mov    %esp,%edx
+  8036ff:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803704:	29 d0                	sub    %edx,%eax
+  803706:	89 c2                	mov    %eax,%edx
+  803708:	c1 ea 0f             	shr    $0xf,%edx
+  80370b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803710:	b8 00 00 00 00       	mov    $0x0,%eax
+  803715:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803718:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80371f:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  803725:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  803727:	85 db                	test   %ebx,%ebx
+  803729:	74 2a                	je     803755 <ipc_recv+0x88>
+  80372b:	89 e2                	mov    %esp,%edx
+  80372d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803732:	29 d0                	sub    %edx,%eax
+  803734:	89 c2                	mov    %eax,%edx
+  803736:	c1 ea 0f             	shr    $0xf,%edx
+  803739:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80373e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803743:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803746:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80374d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803753:	89 03                	mov    %eax,(%ebx)
+  803755:	89 e2                	mov    %esp,%edx
+  803757:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80375c:	29 d0                	sub    %edx,%eax
+  80375e:	89 c2                	mov    %eax,%edx
+  803760:	c1 ea 0f             	shr    $0xf,%edx
+  803763:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803768:	b8 00 00 00 00       	mov    $0x0,%eax
+  80376d:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803770:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803777:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  80377d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803780:	5b                   	pop    %ebx
+  803781:	5e                   	pop    %esi
+  803782:	5d                   	pop    %ebp
+  803783:	c3                   	ret
+		if(from_env_store != NULL)
+  803784:	85 f6                	test   %esi,%esi
+  803786:	74 06                	je     80378e <ipc_recv+0xc1>
+			*from_env_store = 0;
+  803788:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  80378e:	85 db                	test   %ebx,%ebx
+  803790:	74 eb                	je     80377d <ipc_recv+0xb0>
+			*perm_store = 0;
+  803792:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803798:	eb e3                	jmp    80377d <ipc_recv+0xb0>
+
+0080379a <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  80379a:	55                   	push   %ebp
+  80379b:	89 e5                	mov    %esp,%ebp
+  80379d:	57                   	push   %edi
+  80379e:	56                   	push   %esi
+  80379f:	53                   	push   %ebx
+  8037a0:	83 ec 14             	sub    $0x14,%esp
+  8037a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037a9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8037ac:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8037af:	85 c0                	test   %eax,%eax
+  8037b1:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8037b6:	0f 44 c2             	cmove  %edx,%eax
+  8037b9:	ff 75 10             	push   0x10(%ebp)
+  8037bc:	50                   	push   %eax
+  8037bd:	e8 e2 d8 ff ff       	call   8010a4 <sys_ipc_recv_pages>
+  8037c2:	83 c4 10             	add    $0x10,%esp
+  8037c5:	85 c0                	test   %eax,%eax
+  8037c7:	0f 88 ba 00 00 00    	js     803887 <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8037cd:	85 ff                	test   %edi,%edi
+  8037cf:	74 2a                	je     8037fb <ipc_recv_pages+0x61>
+  8037d1:	89 e2                	mov    %esp,%edx
+  8037d3:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037d8:	29 d0                	sub    %edx,%eax
+  8037da:	89 c2                	mov    %eax,%edx
+  8037dc:	c1 ea 0f             	shr    $0xf,%edx
+  8037df:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e9:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  8037ec:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037f3:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8037f9:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  8037fb:	85 f6                	test   %esi,%esi
+  8037fd:	74 2a                	je     803829 <ipc_recv_pages+0x8f>
+  8037ff:	89 e2                	mov    %esp,%edx
+  803801:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803806:	29 d0                	sub    %edx,%eax
+  803808:	89 c2                	mov    %eax,%edx
+  80380a:	c1 ea 0f             	shr    $0xf,%edx
+  80380d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803812:	b8 00 00 00 00       	mov    $0x0,%eax
+  803817:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80381a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803821:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803827:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  803829:	85 db                	test   %ebx,%ebx
+  80382b:	74 2a                	je     803857 <ipc_recv_pages+0xbd>
+  80382d:	89 e2                	mov    %esp,%edx
+  80382f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803834:	29 d0                	sub    %edx,%eax
+  803836:	89 c2                	mov    %eax,%edx
+  803838:	c1 ea 0f             	shr    $0xf,%edx
+  80383b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803840:	b8 00 00 00 00       	mov    $0x0,%eax
+  803845:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  803848:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80384f:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  803855:	89 03                	mov    %eax,(%ebx)
+  803857:	89 e2                	mov    %esp,%edx
+  803859:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80385e:	29 d0                	sub    %edx,%eax
+  803860:	89 c2                	mov    %eax,%edx
+  803862:	c1 ea 0f             	shr    $0xf,%edx
+  803865:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80386a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386f:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803872:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803879:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  80387f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803882:	5b                   	pop    %ebx
+  803883:	5e                   	pop    %esi
+  803884:	5f                   	pop    %edi
+  803885:	5d                   	pop    %ebp
+  803886:	c3                   	ret
+		if (from_env_store)
+  803887:	85 ff                	test   %edi,%edi
+  803889:	74 06                	je     803891 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  80388b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  803891:	85 f6                	test   %esi,%esi
+  803893:	74 06                	je     80389b <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  803895:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  80389b:	85 db                	test   %ebx,%ebx
+  80389d:	74 e0                	je     80387f <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  80389f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8038a5:	eb d8                	jmp    80387f <ipc_recv_pages+0xe5>
+
+008038a7 <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8038a7:	55                   	push   %ebp
+  8038a8:	89 e5                	mov    %esp,%ebp
+  8038aa:	57                   	push   %edi
+  8038ab:	56                   	push   %esi
+  8038ac:	53                   	push   %ebx
+  8038ad:	83 ec 1c             	sub    $0x1c,%esp
+  8038b0:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8038b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8038b6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038bc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038c0:	75 2b                	jne    8038ed <ipc_try_send_pages+0x46>
+  8038c2:	89 e2                	mov    %esp,%edx
+  8038c4:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8038c9:	29 d0                	sub    %edx,%eax
+  8038cb:	89 c2                	mov    %eax,%edx
+  8038cd:	c1 ea 0f             	shr    $0xf,%edx
+  8038d0:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8038d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038da:	0f 42 c2             	cmovb  %edx,%eax
+  8038dd:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8038e4:	8b 70 48             	mov    0x48(%eax),%esi
+  8038e7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8038ed:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  8038f3:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  8038f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038fb:	85 ff                	test   %edi,%edi
+  8038fd:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803902:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  803905:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  80390b:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803911:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  803917:	83 ec 0c             	sub    $0xc,%esp
+  80391a:	ff 75 14             	push   0x14(%ebp)
+  80391d:	ff 75 18             	push   0x18(%ebp)
+  803920:	57                   	push   %edi
+  803921:	ff 75 0c             	push   0xc(%ebp)
+  803924:	ff 75 08             	push   0x8(%ebp)
+  803927:	e8 57 d7 ff ff       	call   801083 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  80392c:	83 c4 20             	add    $0x20,%esp
+  80392f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803932:	75 21                	jne    803955 <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  803934:	83 ec 04             	sub    $0x4,%esp
+  803937:	6a ff                	push   $0xffffffff
+  803939:	53                   	push   %ebx
+  80393a:	ff 75 e4             	push   -0x1c(%ebp)
+  80393d:	e8 4e d9 ff ff       	call   801290 <sys_futex_wait>
+  803942:	83 c4 10             	add    $0x10,%esp
+  803945:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  803948:	74 c7                	je     803911 <ipc_try_send_pages+0x6a>
+  80394a:	85 c0                	test   %eax,%eax
+  80394c:	79 c3                	jns    803911 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  80394e:	e8 20 d5 ff ff       	call   800e73 <sys_yield>
+  803953:	eb bc                	jmp    803911 <ipc_try_send_pages+0x6a>
+	}
+}
+  803955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803958:	5b                   	pop    %ebx
+  803959:	5e                   	pop    %esi
+  80395a:	5f                   	pop    %edi
+  80395b:	5d                   	pop    %ebp
+  80395c:	c3                   	ret
+
+0080395d <ipc_send>:
+{
+  80395d:	55                   	push   %ebp
+  80395e:	89 e5                	mov    %esp,%ebp
+  803960:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803963:	ff 75 14             	push   0x14(%ebp)
+  803966:	6a 01                	push   $0x1
+  803968:	ff 75 10             	push   0x10(%ebp)
+  80396b:	ff 75 0c             	push   0xc(%ebp)
+  80396e:	ff 75 08             	push   0x8(%ebp)
+  803971:	e8 31 ff ff ff       	call   8038a7 <ipc_try_send_pages>
+  803976:	83 c4 20             	add    $0x20,%esp
+  803979:	85 c0                	test   %eax,%eax
+  80397b:	78 02                	js     80397f <ipc_send+0x22>
+}
+  80397d:	c9                   	leave
+  80397e:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  80397f:	50                   	push   %eax
+  803980:	68 aa 41 80 00       	push   $0x8041aa
+  803985:	6a 3f                	push   $0x3f
+  803987:	68 bf 41 80 00       	push   $0x8041bf
+  80398c:	e8 fb c8 ff ff       	call   80028c <_panic>
+
+00803991 <ipc_send_pages>:
+{
+  803991:	55                   	push   %ebp
+  803992:	89 e5                	mov    %esp,%ebp
+  803994:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  803997:	ff 75 18             	push   0x18(%ebp)
+  80399a:	ff 75 14             	push   0x14(%ebp)
+  80399d:	ff 75 10             	push   0x10(%ebp)
+  8039a0:	ff 75 0c             	push   0xc(%ebp)
+  8039a3:	ff 75 08             	push   0x8(%ebp)
+  8039a6:	e8 fc fe ff ff       	call   8038a7 <ipc_try_send_pages>
+  8039ab:	83 c4 20             	add    $0x20,%esp
+  8039ae:	85 c0                	test   %eax,%eax
+  8039b0:	78 02                	js     8039b4 <ipc_send_pages+0x23>
+}
+  8039b2:	c9                   	leave
+  8039b3:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8039b4:	50                   	push   %eax
+  8039b5:	68 c9 41 80 00       	push   $0x8041c9
+  8039ba:	6a 64                	push   $0x64
+  8039bc:	68 bf 41 80 00       	push   $0x8041bf
+  8039c1:	e8 c6 c8 ff ff       	call   80028c <_panic>
+
+008039c6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8039c6:	55                   	push   %ebp
+  8039c7:	89 e5                	mov    %esp,%ebp
+  8039c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8039cc:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8039d1:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8039d7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8039dd:	8b 52 50             	mov    0x50(%edx),%edx
+  8039e0:	39 ca                	cmp    %ecx,%edx
+  8039e2:	74 11                	je     8039f5 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8039e4:	83 c0 01             	add    $0x1,%eax
+  8039e7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8039ec:	75 e3                	jne    8039d1 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8039ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f3:	eb 0e                	jmp    803a03 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8039f5:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  8039fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a00:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803a03:	5d                   	pop    %ebp
+  803a04:	c3                   	ret
+
+00803a05 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803a05:	55                   	push   %ebp
+  803a06:	89 e5                	mov    %esp,%ebp
+  803a08:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a0b:	89 c2                	mov    %eax,%edx
+  803a0d:	c1 ea 16             	shr    $0x16,%edx
+  803a10:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803a17:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803a1c:	f6 c1 01             	test   $0x1,%cl
+  803a1f:	74 1e                	je     803a3f <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803a21:	c1 e8 0c             	shr    $0xc,%eax
+  803a24:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803a2b:	a8 01                	test   $0x1,%al
+  803a2d:	74 10                	je     803a3f <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803a2f:	c1 e8 0c             	shr    $0xc,%eax
+  803a32:	c1 e0 04             	shl    $0x4,%eax
+  803a35:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803a3c:	0f b7 d2             	movzwl %dx,%edx
+}
+  803a3f:	89 d0                	mov    %edx,%eax
+  803a41:	5d                   	pop    %ebp
+  803a42:	c3                   	ret
+
+00803a43 <__udivdi3>:
+  803a43:	57                   	push   %edi
+  803a44:	56                   	push   %esi
+  803a45:	53                   	push   %ebx
+  803a46:	83 ec 20             	sub    $0x20,%esp
+  803a49:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803a4d:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803a51:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a55:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a59:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a5d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a61:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a65:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a69:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a78:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a7f:	00 
+  803a80:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803a87:	00 
+  803a88:	eb 08                	jmp    803a92 <__udivdi3+0x4f>
+  803a8a:	83 e9 01             	sub    $0x1,%ecx
+  803a8d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803a90:	74 68                	je     803afa <__udivdi3+0xb7>
+  803a92:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a96:	01 c0                	add    %eax,%eax
+  803a98:	89 c6                	mov    %eax,%esi
+  803a9a:	89 d7                	mov    %edx,%edi
+  803a9c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803aa0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803aa4:	0f ad d0             	shrd   %cl,%edx,%eax
+  803aa7:	d3 ea                	shr    %cl,%edx
+  803aa9:	f6 c1 20             	test   $0x20,%cl
+  803aac:	74 04                	je     803ab2 <__udivdi3+0x6f>
+  803aae:	89 d0                	mov    %edx,%eax
+  803ab0:	31 d2                	xor    %edx,%edx
+  803ab2:	83 e0 01             	and    $0x1,%eax
+  803ab5:	89 04 24             	mov    %eax,(%esp)
+  803ab8:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803abf:	00 
+  803ac0:	8b 04 24             	mov    (%esp),%eax
+  803ac3:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ac7:	09 f0                	or     %esi,%eax
+  803ac9:	09 fa                	or     %edi,%edx
+  803acb:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803acf:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803ad3:	39 f0                	cmp    %esi,%eax
+  803ad5:	89 d3                	mov    %edx,%ebx
+  803ad7:	19 fb                	sbb    %edi,%ebx
+  803ad9:	72 af                	jb     803a8a <__udivdi3+0x47>
+  803adb:	29 f0                	sub    %esi,%eax
+  803add:	19 fa                	sbb    %edi,%edx
+  803adf:	89 cf                	mov    %ecx,%edi
+  803ae1:	c1 ef 05             	shr    $0x5,%edi
+  803ae4:	83 e7 01             	and    $0x1,%edi
+  803ae7:	89 fe                	mov    %edi,%esi
+  803ae9:	83 f6 01             	xor    $0x1,%esi
+  803aec:	d3 e6                	shl    %cl,%esi
+  803aee:	d3 e7                	shl    %cl,%edi
+  803af0:	09 74 24 18          	or     %esi,0x18(%esp)
+  803af4:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803af8:	eb 90                	jmp    803a8a <__udivdi3+0x47>
+  803afa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803afe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b02:	83 c4 20             	add    $0x20,%esp
+  803b05:	5b                   	pop    %ebx
+  803b06:	5e                   	pop    %esi
+  803b07:	5f                   	pop    %edi
+  803b08:	c3                   	ret
+
+00803b09 <__umoddi3>:
+  803b09:	57                   	push   %edi
+  803b0a:	56                   	push   %esi
+  803b0b:	53                   	push   %ebx
+  803b0c:	83 ec 08             	sub    $0x8,%esp
+  803b0f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b13:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b17:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803b1b:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803b1f:	57                   	push   %edi
+  803b20:	56                   	push   %esi
+  803b21:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803b25:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b29:	52                   	push   %edx
+  803b2a:	50                   	push   %eax
+  803b2b:	e8 13 ff ff ff       	call   803a43 <__udivdi3>
+  803b30:	89 c3                	mov    %eax,%ebx
+  803b32:	0f af d6             	imul   %esi,%edx
+  803b35:	89 f9                	mov    %edi,%ecx
+  803b37:	0f af cb             	imul   %ebx,%ecx
+  803b3a:	01 d1                	add    %edx,%ecx
+  803b3c:	89 d8                	mov    %ebx,%eax
+  803b3e:	f7 e6                	mul    %esi
+  803b40:	89 c6                	mov    %eax,%esi
+  803b42:	89 d7                	mov    %edx,%edi
+  803b44:	01 cf                	add    %ecx,%edi
+  803b46:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b4a:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b4e:	29 f0                	sub    %esi,%eax
+  803b50:	19 fa                	sbb    %edi,%edx
+  803b52:	83 c4 18             	add    $0x18,%esp
+  803b55:	5b                   	pop    %ebx
+  803b56:	5e                   	pop    %esi
+  803b57:	5f                   	pop    %edi
+  803b58:	c3                   	ret
+
+00803b59 <__divdi3>:
+  803b59:	53                   	push   %ebx
+  803b5a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b5e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b62:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b66:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b6a:	85 d2                	test   %edx,%edx
+  803b6c:	78 12                	js     803b80 <__divdi3+0x27>
+  803b6e:	85 db                	test   %ebx,%ebx
+  803b70:	78 2e                	js     803ba0 <__divdi3+0x47>
+  803b72:	53                   	push   %ebx
+  803b73:	51                   	push   %ecx
+  803b74:	52                   	push   %edx
+  803b75:	50                   	push   %eax
+  803b76:	e8 c8 fe ff ff       	call   803a43 <__udivdi3>
+  803b7b:	83 c4 10             	add    $0x10,%esp
+  803b7e:	eb 1e                	jmp    803b9e <__divdi3+0x45>
+  803b80:	f7 d8                	neg    %eax
+  803b82:	83 d2 00             	adc    $0x0,%edx
+  803b85:	f7 da                	neg    %edx
+  803b87:	85 db                	test   %ebx,%ebx
+  803b89:	78 2a                	js     803bb5 <__divdi3+0x5c>
+  803b8b:	53                   	push   %ebx
+  803b8c:	51                   	push   %ecx
+  803b8d:	52                   	push   %edx
+  803b8e:	50                   	push   %eax
+  803b8f:	e8 af fe ff ff       	call   803a43 <__udivdi3>
+  803b94:	83 c4 10             	add    $0x10,%esp
+  803b97:	f7 d8                	neg    %eax
+  803b99:	83 d2 00             	adc    $0x0,%edx
+  803b9c:	f7 da                	neg    %edx
+  803b9e:	5b                   	pop    %ebx
+  803b9f:	c3                   	ret
+  803ba0:	f7 d9                	neg    %ecx
+  803ba2:	83 d3 00             	adc    $0x0,%ebx
+  803ba5:	f7 db                	neg    %ebx
+  803ba7:	53                   	push   %ebx
+  803ba8:	51                   	push   %ecx
+  803ba9:	52                   	push   %edx
+  803baa:	50                   	push   %eax
+  803bab:	e8 93 fe ff ff       	call   803a43 <__udivdi3>
+  803bb0:	83 c4 10             	add    $0x10,%esp
+  803bb3:	eb e2                	jmp    803b97 <__divdi3+0x3e>
+  803bb5:	f7 d9                	neg    %ecx
+  803bb7:	83 d3 00             	adc    $0x0,%ebx
+  803bba:	f7 db                	neg    %ebx
+  803bbc:	53                   	push   %ebx
+  803bbd:	51                   	push   %ecx
+  803bbe:	52                   	push   %edx
+  803bbf:	50                   	push   %eax
+  803bc0:	e8 7e fe ff ff       	call   803a43 <__udivdi3>
+  803bc5:	83 c4 10             	add    $0x10,%esp
+  803bc8:	eb d4                	jmp    803b9e <__divdi3+0x45>
+
+00803bca <__moddi3>:
+  803bca:	57                   	push   %edi
+  803bcb:	56                   	push   %esi
+  803bcc:	53                   	push   %ebx
+  803bcd:	83 ec 08             	sub    $0x8,%esp
+  803bd0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803bd4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803bd8:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803bdc:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803be0:	57                   	push   %edi
+  803be1:	56                   	push   %esi
+  803be2:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803be6:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803bea:	52                   	push   %edx
+  803beb:	50                   	push   %eax
+  803bec:	e8 68 ff ff ff       	call   803b59 <__divdi3>
+  803bf1:	89 c3                	mov    %eax,%ebx
+  803bf3:	0f af d6             	imul   %esi,%edx
+  803bf6:	89 f9                	mov    %edi,%ecx
+  803bf8:	0f af cb             	imul   %ebx,%ecx
+  803bfb:	01 d1                	add    %edx,%ecx
+  803bfd:	89 d8                	mov    %ebx,%eax
+  803bff:	f7 e6                	mul    %esi
+  803c01:	89 c6                	mov    %eax,%esi
+  803c03:	89 d7                	mov    %edx,%edi
+  803c05:	01 cf                	add    %ecx,%edi
+  803c07:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803c0b:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803c0f:	29 f0                	sub    %esi,%eax
+  803c11:	19 fa                	sbb    %edi,%edx
+  803c13:	83 c4 18             	add    $0x18,%esp
+  803c16:	5b                   	pop    %ebx
+  803c17:	5e                   	pop    %esi
+  803c18:	5f                   	pop    %edi
+  803c19:	c3                   	ret
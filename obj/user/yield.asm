@@ -0,0 +1,7925 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ca 00 00 00       	call   8000fb <libmain>
+
+00800031 <spin>:
+spin:
+	jmp spin
+  800031:	eb fe                	jmp    800031 <spin>
+1:	jmp 1b
+  800033:	eb fe                	jmp    800033 <spin+0x2>
+
+00800035 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	57                   	push   %edi
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	83 ec 14             	sub    $0x14,%esp
+
+static __inline uint32_t
+read_esp(void)
+{
+        uint32_t esp;
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80003e:	89 e2                	mov    %esp,%edx
+// The stack slot (see TSTACKSIZE) of the running thread.  Stacks
+// outside the slots, like those of user-level threads, count as slot 0.
+static __inline int __attribute__((always_inline))
+thread_slot(void)
+{
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  800040:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  800045:	29 d0                	sub    %edx,%eax
+  800047:	89 c2                	mov    %eax,%edx
+  800049:	c1 ea 0f             	shr    $0xf,%edx
+  80004c:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800051:	b8 00 00 00 00       	mov    $0x0,%eax
+  800056:	0f 42 c2             	cmovb  %edx,%eax
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800059:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  800060:	8b 40 48             	mov    0x48(%eax),%eax
+  800063:	50                   	push   %eax
+  800064:	68 40 3b 80 00       	push   $0x803b40
+  800069:	e8 c9 01 00 00       	call   800237 <cprintf>
+  80006e:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800071:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800076:	bf ff ff bf ee       	mov    $0xeebfffff,%edi
+  80007b:	be 00 00 00 00       	mov    $0x0,%esi
+		sys_yield();
+  800080:	e8 be 0c 00 00       	call   800d43 <sys_yield>
+  800085:	89 e0                	mov    %esp,%eax
+  800087:	89 fa                	mov    %edi,%edx
+  800089:	29 c2                	sub    %eax,%edx
+  80008b:	89 d0                	mov    %edx,%eax
+  80008d:	c1 e8 0f             	shr    $0xf,%eax
+  800090:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800096:	0f 43 c6             	cmovae %esi,%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  800099:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8000a0:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  8000a3:	83 ec 04             	sub    $0x4,%esp
+  8000a6:	53                   	push   %ebx
+  8000a7:	50                   	push   %eax
+  8000a8:	68 60 3b 80 00       	push   $0x803b60
+  8000ad:	e8 85 01 00 00       	call   800237 <cprintf>
+	for (i = 0; i < 5; i++) {
+  8000b2:	83 c3 01             	add    $0x1,%ebx
+  8000b5:	83 c4 10             	add    $0x10,%esp
+  8000b8:	83 fb 05             	cmp    $0x5,%ebx
+  8000bb:	75 c3                	jne    800080 <umain+0x4b>
+  8000bd:	89 e2                	mov    %esp,%edx
+  8000bf:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8000c4:	29 d0                	sub    %edx,%eax
+  8000c6:	89 c2                	mov    %eax,%edx
+  8000c8:	c1 ea 0f             	shr    $0xf,%edx
+  8000cb:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8000d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d5:	0f 42 c2             	cmovb  %edx,%eax
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000d8:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8000df:	8b 40 48             	mov    0x48(%eax),%eax
+  8000e2:	83 ec 08             	sub    $0x8,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	68 8c 3b 80 00       	push   $0x803b8c
+  8000eb:	e8 47 01 00 00       	call   800237 <cprintf>
+}
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000f6:	5b                   	pop    %ebx
+  8000f7:	5e                   	pop    %esi
+  8000f8:	5f                   	pop    %edi
+  8000f9:	5d                   	pop    %ebp
+  8000fa:	c3                   	ret
+
+008000fb <libmain>:
+const volatile struct Env *thread_envs[NTHREADS];
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000fb:	55                   	push   %ebp
+  8000fc:	89 e5                	mov    %esp,%ebp
+  8000fe:	56                   	push   %esi
+  8000ff:	53                   	push   %ebx
+  800100:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800103:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800106:	89 e2                	mov    %esp,%edx
+  800108:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80010d:	29 d0                	sub    %edx,%eax
+  80010f:	89 c2                	mov    %eax,%edx
+  800111:	c1 ea 0f             	shr    $0xf,%edx
+  800114:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	0f 42 c2             	cmovb  %edx,%eax
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = 0;
+  800121:	c7 04 85 40 63 80 00 	movl   $0x0,0x806340(,%eax,4)
+  800128:	00 00 00 00 
+	envid_t eid;
+	eid = sys_getenvid();
+  80012c:	e8 f3 0b 00 00       	call   800d24 <sys_getenvid>
+	thisenv = (struct Env *)envs + ENVX(eid);
+  800131:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800136:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  80013c:	89 e1                	mov    %esp,%ecx
+  80013e:	ba ff ff bf ee       	mov    $0xeebfffff,%edx
+  800143:	29 ca                	sub    %ecx,%edx
+  800145:	89 d1                	mov    %edx,%ecx
+  800147:	c1 e9 0f             	shr    $0xf,%ecx
+  80014a:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  800150:	ba 00 00 00 00       	mov    $0x0,%edx
+  800155:	0f 42 d1             	cmovb  %ecx,%edx
+  800158:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80015d:	89 04 95 40 63 80 00 	mov    %eax,0x806340(,%edx,4)
+	
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800164:	85 db                	test   %ebx,%ebx
+  800166:	7e 07                	jle    80016f <libmain+0x74>
+		binaryname = argv[0];
+  800168:	8b 06                	mov    (%esi),%eax
+  80016a:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	56                   	push   %esi
+  800173:	53                   	push   %ebx
+  800174:	e8 bc fe ff ff       	call   800035 <umain>
+
+	// exit gracefully
+	exit();
+  800179:	e8 0a 00 00 00       	call   800188 <exit>
+}
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800184:	5b                   	pop    %ebx
+  800185:	5e                   	pop    %esi
+  800186:	5d                   	pop    %ebp
+  800187:	c3                   	ret
+
+00800188 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800188:	55                   	push   %ebp
+  800189:	89 e5                	mov    %esp,%ebp
+  80018b:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80018e:	e8 1b 12 00 00       	call   8013ae <close_all>
+	sys_env_destroy(0);
+  800193:	83 ec 0c             	sub    $0xc,%esp
+  800196:	6a 00                	push   $0x0
+  800198:	e8 46 0b 00 00       	call   800ce3 <sys_env_destroy>
+}
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	c9                   	leave
+  8001a1:	c3                   	ret
+
+008001a2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	53                   	push   %ebx
+  8001a6:	83 ec 04             	sub    $0x4,%esp
+  8001a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001ac:	8b 13                	mov    (%ebx),%edx
+  8001ae:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b1:	89 03                	mov    %eax,(%ebx)
+  8001b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001ba:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bf:	74 09                	je     8001ca <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001c1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c8:	c9                   	leave
+  8001c9:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001ca:	83 ec 08             	sub    $0x8,%esp
+  8001cd:	68 ff 00 00 00       	push   $0xff
+  8001d2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d5:	50                   	push   %eax
+  8001d6:	e8 cb 0a 00 00       	call   800ca6 <sys_cputs>
+		b->idx = 0;
+  8001db:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e1:	83 c4 10             	add    $0x10,%esp
+  8001e4:	eb db                	jmp    8001c1 <putch+0x1f>
+
+008001e6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e6:	55                   	push   %ebp
+  8001e7:	89 e5                	mov    %esp,%ebp
+  8001e9:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ef:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f6:	00 00 00 
+	b.cnt = 0;
+  8001f9:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800200:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800203:	ff 75 0c             	push   0xc(%ebp)
+  800206:	ff 75 08             	push   0x8(%ebp)
+  800209:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020f:	50                   	push   %eax
+  800210:	68 a2 01 80 00       	push   $0x8001a2
+  800215:	e8 1c 01 00 00       	call   800336 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80021a:	83 c4 08             	add    $0x8,%esp
+  80021d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800223:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800229:	50                   	push   %eax
+  80022a:	e8 77 0a 00 00       	call   800ca6 <sys_cputs>
+
+	return b.cnt;
+}
+  80022f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+00800237 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80023d:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800240:	50                   	push   %eax
+  800241:	ff 75 08             	push   0x8(%ebp)
+  800244:	e8 9d ff ff ff       	call   8001e6 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+0080024b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	57                   	push   %edi
+  80024f:	56                   	push   %esi
+  800250:	53                   	push   %ebx
+  800251:	83 ec 1c             	sub    $0x1c,%esp
+  800254:	89 c3                	mov    %eax,%ebx
+  800256:	89 d6                	mov    %edx,%esi
+  800258:	8b 45 08             	mov    0x8(%ebp),%eax
+  80025b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025e:	89 d1                	mov    %edx,%ecx
+  800260:	89 c2                	mov    %eax,%edx
+  800262:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800265:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800268:	8b 45 10             	mov    0x10(%ebp),%eax
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80026b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800275:	39 c2                	cmp    %eax,%edx
+  800277:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027a:	73 4b                	jae    8002c7 <printnum+0x7c>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+  80027c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80027f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800282:	85 ff                	test   %edi,%edi
+  800284:	7e 11                	jle    800297 <printnum+0x4c>
+			putch(padc, putdat);
+  800286:	83 ec 08             	sub    $0x8,%esp
+  800289:	56                   	push   %esi
+  80028a:	ff 75 18             	push   0x18(%ebp)
+  80028d:	ff d3                	call   *%ebx
+		while (--width > 0)
+  80028f:	83 c4 10             	add    $0x10,%esp
+  800292:	83 ef 01             	sub    $0x1,%edi
+  800295:	75 ef                	jne    800286 <printnum+0x3b>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800297:	83 ec 08             	sub    $0x8,%esp
+  80029a:	56                   	push   %esi
+  80029b:	83 ec 04             	sub    $0x4,%esp
+  80029e:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a1:	ff 75 e0             	push   -0x20(%ebp)
+  8002a4:	ff 75 dc             	push   -0x24(%ebp)
+  8002a7:	ff 75 d8             	push   -0x28(%ebp)
+  8002aa:	e8 70 37 00 00       	call   803a1f <__umoddi3>
+  8002af:	83 c4 14             	add    $0x14,%esp
+  8002b2:	0f be 80 b5 3b 80 00 	movsbl 0x803bb5(%eax),%eax
+  8002b9:	50                   	push   %eax
+  8002ba:	ff d3                	call   *%ebx
+}
+  8002bc:	83 c4 10             	add    $0x10,%esp
+  8002bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c2:	5b                   	pop    %ebx
+  8002c3:	5e                   	pop    %esi
+  8002c4:	5f                   	pop    %edi
+  8002c5:	5d                   	pop    %ebp
+  8002c6:	c3                   	ret
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002c7:	83 ec 0c             	sub    $0xc,%esp
+  8002ca:	ff 75 18             	push   0x18(%ebp)
+  8002cd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d0:	8d 57 ff             	lea    -0x1(%edi),%edx
+  8002d3:	52                   	push   %edx
+  8002d4:	50                   	push   %eax
+  8002d5:	83 ec 08             	sub    $0x8,%esp
+  8002d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002db:	ff 75 e0             	push   -0x20(%ebp)
+  8002de:	ff 75 dc             	push   -0x24(%ebp)
+  8002e1:	ff 75 d8             	push   -0x28(%ebp)
+  8002e4:	e8 70 36 00 00       	call   803959 <__udivdi3>
+  8002e9:	83 c4 18             	add    $0x18,%esp
+  8002ec:	52                   	push   %edx
+  8002ed:	50                   	push   %eax
+  8002ee:	89 f2                	mov    %esi,%edx
+  8002f0:	89 d8                	mov    %ebx,%eax
+  8002f2:	e8 54 ff ff ff       	call   80024b <printnum>
+  8002f7:	83 c4 20             	add    $0x20,%esp
+  8002fa:	eb 9b                	jmp    800297 <printnum+0x4c>
+
+008002fc <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002fc:	55                   	push   %ebp
+  8002fd:	89 e5                	mov    %esp,%ebp
+  8002ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800302:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800306:	8b 10                	mov    (%eax),%edx
+  800308:	3b 50 04             	cmp    0x4(%eax),%edx
+  80030b:	73 0a                	jae    800317 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80030d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800310:	89 08                	mov    %ecx,(%eax)
+  800312:	8b 45 08             	mov    0x8(%ebp),%eax
+  800315:	88 02                	mov    %al,(%edx)
+}
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+
+00800319 <printfmt>:
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80031f:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800322:	50                   	push   %eax
+  800323:	ff 75 10             	push   0x10(%ebp)
+  800326:	ff 75 0c             	push   0xc(%ebp)
+  800329:	ff 75 08             	push   0x8(%ebp)
+  80032c:	e8 05 00 00 00       	call   800336 <vprintfmt>
+}
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+
+00800336 <vprintfmt>:
+{
+  800336:	55                   	push   %ebp
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	57                   	push   %edi
+  80033a:	56                   	push   %esi
+  80033b:	53                   	push   %ebx
+  80033c:	83 ec 2c             	sub    $0x2c,%esp
+  80033f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800342:	89 df                	mov    %ebx,%edi
+  800344:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800347:	8b 45 10             	mov    0x10(%ebp),%eax
+  80034a:	8d 70 01             	lea    0x1(%eax),%esi
+  80034d:	0f b6 00             	movzbl (%eax),%eax
+  800350:	83 f8 25             	cmp    $0x25,%eax
+  800353:	74 1e                	je     800373 <vprintfmt+0x3d>
+			if (ch == '\0')
+  800355:	85 c0                	test   %eax,%eax
+  800357:	0f 84 15 05 00 00    	je     800872 <vprintfmt+0x53c>
+			putch(ch, putdat);
+  80035d:	83 ec 08             	sub    $0x8,%esp
+  800360:	53                   	push   %ebx
+  800361:	50                   	push   %eax
+  800362:	ff d7                	call   *%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800364:	83 c6 01             	add    $0x1,%esi
+  800367:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80036b:	83 c4 10             	add    $0x10,%esp
+  80036e:	83 f8 25             	cmp    $0x25,%eax
+  800371:	75 e2                	jne    800355 <vprintfmt+0x1f>
+		padc = ' ';
+  800373:	c6 45 e3 20          	movb   $0x20,-0x1d(%ebp)
+		altflag = 0;
+  800377:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80037e:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+		width = -1;
+  800385:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+		lflag = 0;
+  80038c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800391:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800394:	8d 56 01             	lea    0x1(%esi),%edx
+  800397:	0f b6 0e             	movzbl (%esi),%ecx
+  80039a:	8d 41 dd             	lea    -0x23(%ecx),%eax
+  80039d:	3c 55                	cmp    $0x55,%al
+  80039f:	0f 87 3b 04 00 00    	ja     8007e0 <vprintfmt+0x4aa>
+  8003a5:	0f b6 c0             	movzbl %al,%eax
+  8003a8:	ff 24 85 20 3d 80 00 	jmp    *0x803d20(,%eax,4)
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8003af:	89 75 10             	mov    %esi,0x10(%ebp)
+  8003b2:	eb 93                	jmp    800347 <vprintfmt+0x11>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003b4:	89 d6                	mov    %edx,%esi
+			padc = '-';
+  8003b6:	c6 45 e3 2d          	movb   $0x2d,-0x1d(%ebp)
+  8003ba:	eb d8                	jmp    800394 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003bc:	89 d6                	mov    %edx,%esi
+  8003be:	c6 45 e3 30          	movb   $0x30,-0x1d(%ebp)
+  8003c2:	eb d0                	jmp    800394 <vprintfmt+0x5e>
+  8003c4:	0f b6 c9             	movzbl %cl,%ecx
+				precision = precision * 10 + ch - '0';
+  8003c7:	8d 41 d0             	lea    -0x30(%ecx),%eax
+  8003ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+				ch = *fmt;
+  8003cd:	0f be 46 01          	movsbl 0x1(%esi),%eax
+				if (ch < '0' || ch > '9')
+  8003d1:	8d 48 d0             	lea    -0x30(%eax),%ecx
+  8003d4:	83 f9 09             	cmp    $0x9,%ecx
+  8003d7:	77 6f                	ja     800448 <vprintfmt+0x112>
+  8003d9:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+			for (precision = 0; ; ++fmt) {
+  8003dc:	83 c2 01             	add    $0x1,%edx
+				precision = precision * 10 + ch - '0';
+  8003df:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+  8003e2:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+				ch = *fmt;
+  8003e6:	0f be 02             	movsbl (%edx),%eax
+				if (ch < '0' || ch > '9')
+  8003e9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8003ec:	83 fe 09             	cmp    $0x9,%esi
+  8003ef:	76 eb                	jbe    8003dc <vprintfmt+0xa6>
+  8003f1:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+			for (precision = 0; ; ++fmt) {
+  8003f4:	89 d6                	mov    %edx,%esi
+  8003f6:	eb 13                	jmp    80040b <vprintfmt+0xd5>
+			precision = va_arg(ap, int);
+  8003f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003fb:	8b 00                	mov    (%eax),%eax
+  8003fd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800400:	8b 45 14             	mov    0x14(%ebp),%eax
+  800403:	8d 40 04             	lea    0x4(%eax),%eax
+  800406:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800409:	89 d6                	mov    %edx,%esi
+			if (width < 0)
+  80040b:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80040f:	79 83                	jns    800394 <vprintfmt+0x5e>
+				width = precision, precision = -1;
+  800411:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800414:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800417:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%ebp)
+  80041e:	e9 71 ff ff ff       	jmp    800394 <vprintfmt+0x5e>
+			if (width < 0)
+  800423:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800426:	85 c9                	test   %ecx,%ecx
+  800428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042d:	0f 49 c1             	cmovns %ecx,%eax
+  800430:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800433:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800435:	e9 5a ff ff ff       	jmp    800394 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  80043a:	89 d6                	mov    %edx,%esi
+			altflag = 1;
+  80043c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800443:	e9 4c ff ff ff       	jmp    800394 <vprintfmt+0x5e>
+		switch (ch = *(unsigned char *) fmt++) {
+  800448:	89 d6                	mov    %edx,%esi
+  80044a:	eb bf                	jmp    80040b <vprintfmt+0xd5>
+			lflag++;
+  80044c:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800450:	89 d6                	mov    %edx,%esi
+			goto reswitch;
+  800452:	e9 3d ff ff ff       	jmp    800394 <vprintfmt+0x5e>
+			putch(va_arg(ap, int), putdat);
+  800457:	89 55 10             	mov    %edx,0x10(%ebp)
+  80045a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045d:	8d 70 04             	lea    0x4(%eax),%esi
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	53                   	push   %ebx
+  800464:	ff 30                	push   (%eax)
+  800466:	ff d7                	call   *%edi
+			break;
+  800468:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  80046b:	89 75 14             	mov    %esi,0x14(%ebp)
+			break;
+  80046e:	e9 d4 fe ff ff       	jmp    800347 <vprintfmt+0x11>
+			err = va_arg(ap, int);
+  800473:	89 55 10             	mov    %edx,0x10(%ebp)
+  800476:	8b 45 14             	mov    0x14(%ebp),%eax
+  800479:	8d 70 04             	lea    0x4(%eax),%esi
+			if (err < 0)
+  80047c:	8b 10                	mov    (%eax),%edx
+  80047e:	89 d0                	mov    %edx,%eax
+  800480:	f7 d8                	neg    %eax
+  800482:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800485:	83 f8 12             	cmp    $0x12,%eax
+  800488:	7f 23                	jg     8004ad <vprintfmt+0x177>
+  80048a:	8b 14 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%edx
+  800491:	85 d2                	test   %edx,%edx
+  800493:	74 18                	je     8004ad <vprintfmt+0x177>
+				printfmt(putch, putdat, "%s", p);
+  800495:	52                   	push   %edx
+  800496:	68 db 3f 80 00       	push   $0x803fdb
+  80049b:	53                   	push   %ebx
+  80049c:	57                   	push   %edi
+  80049d:	e8 77 fe ff ff       	call   800319 <printfmt>
+  8004a2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004a5:	89 75 14             	mov    %esi,0x14(%ebp)
+  8004a8:	e9 9a fe ff ff       	jmp    800347 <vprintfmt+0x11>
+				printfmt(putch, putdat, "error %d", err);
+  8004ad:	50                   	push   %eax
+  8004ae:	68 cd 3b 80 00       	push   $0x803bcd
+  8004b3:	53                   	push   %ebx
+  8004b4:	57                   	push   %edi
+  8004b5:	e8 5f fe ff ff       	call   800319 <printfmt>
+  8004ba:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8004bd:	89 75 14             	mov    %esi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8004c0:	e9 82 fe ff ff       	jmp    800347 <vprintfmt+0x11>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004c5:	89 55 10             	mov    %edx,0x10(%ebp)
+  8004c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cb:	83 c0 04             	add    $0x4,%eax
+  8004ce:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8b 00                	mov    (%eax),%eax
+  8004d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d9:	85 c0                	test   %eax,%eax
+  8004db:	0f 84 61 03 00 00    	je     800842 <vprintfmt+0x50c>
+			if (width > 0 && padc != '-')
+  8004e1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8004e5:	7e 06                	jle    8004ed <vprintfmt+0x1b7>
+  8004e7:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  8004eb:	75 29                	jne    800516 <vprintfmt+0x1e0>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004f0:	8d 70 01             	lea    0x1(%eax),%esi
+  8004f3:	0f b6 00             	movzbl (%eax),%eax
+  8004f6:	0f be d0             	movsbl %al,%edx
+  8004f9:	85 d2                	test   %edx,%edx
+  8004fb:	0f 84 bb 00 00 00    	je     8005bc <vprintfmt+0x286>
+  800501:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800504:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800507:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80050a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80050d:	eb 7a                	jmp    800589 <vprintfmt+0x253>
+				p = "(null)";
+  80050f:	c7 45 d0 c6 3b 80 00 	movl   $0x803bc6,-0x30(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800516:	83 ec 08             	sub    $0x8,%esp
+  800519:	ff 75 d4             	push   -0x2c(%ebp)
+  80051c:	ff 75 d0             	push   -0x30(%ebp)
+  80051f:	e8 e0 03 00 00       	call   800904 <strnlen>
+  800524:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  800527:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80052a:	83 c4 10             	add    $0x10,%esp
+  80052d:	85 d2                	test   %edx,%edx
+  80052f:	0f 8e d6 02 00 00    	jle    80080b <vprintfmt+0x4d5>
+					putch(padc, putdat);
+  800535:	0f be 75 e3          	movsbl -0x1d(%ebp),%esi
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	53                   	push   %ebx
+  80053d:	56                   	push   %esi
+  80053e:	ff d7                	call   *%edi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800540:	83 c4 10             	add    $0x10,%esp
+  800543:	83 6d e4 01          	subl   $0x1,-0x1c(%ebp)
+  800547:	75 f0                	jne    800539 <vprintfmt+0x203>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800549:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80054c:	8d 70 01             	lea    0x1(%eax),%esi
+  80054f:	0f b6 00             	movzbl (%eax),%eax
+  800552:	0f be d0             	movsbl %al,%edx
+  800555:	85 d2                	test   %edx,%edx
+  800557:	0f 84 da 02 00 00    	je     800837 <vprintfmt+0x501>
+  80055d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800560:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800563:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800566:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800569:	eb 1e                	jmp    800589 <vprintfmt+0x253>
+					putch(ch, putdat);
+  80056b:	83 ec 08             	sub    $0x8,%esp
+  80056e:	ff 75 0c             	push   0xc(%ebp)
+  800571:	52                   	push   %edx
+  800572:	ff 55 08             	call   *0x8(%ebp)
+  800575:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800578:	83 eb 01             	sub    $0x1,%ebx
+  80057b:	83 c6 01             	add    $0x1,%esi
+  80057e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800582:	0f be d0             	movsbl %al,%edx
+  800585:	85 d2                	test   %edx,%edx
+  800587:	74 2a                	je     8005b3 <vprintfmt+0x27d>
+  800589:	85 ff                	test   %edi,%edi
+  80058b:	78 05                	js     800592 <vprintfmt+0x25c>
+  80058d:	83 ef 01             	sub    $0x1,%edi
+  800590:	78 59                	js     8005eb <vprintfmt+0x2b5>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800592:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800596:	74 d3                	je     80056b <vprintfmt+0x235>
+  800598:	0f be c0             	movsbl %al,%eax
+  80059b:	83 e8 20             	sub    $0x20,%eax
+  80059e:	83 f8 5e             	cmp    $0x5e,%eax
+  8005a1:	76 c8                	jbe    80056b <vprintfmt+0x235>
+					putch('?', putdat);
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	ff 75 0c             	push   0xc(%ebp)
+  8005a9:	6a 3f                	push   $0x3f
+  8005ab:	ff 55 08             	call   *0x8(%ebp)
+  8005ae:	83 c4 10             	add    $0x10,%esp
+  8005b1:	eb c5                	jmp    800578 <vprintfmt+0x242>
+  8005b3:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+			for (; width > 0; width--)
+  8005bc:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8005bf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8005c3:	7e 1b                	jle    8005e0 <vprintfmt+0x2aa>
+				putch(' ', putdat);
+  8005c5:	83 ec 08             	sub    $0x8,%esp
+  8005c8:	53                   	push   %ebx
+  8005c9:	6a 20                	push   $0x20
+  8005cb:	ff d7                	call   *%edi
+			for (; width > 0; width--)
+  8005cd:	83 c4 10             	add    $0x10,%esp
+  8005d0:	83 ee 01             	sub    $0x1,%esi
+  8005d3:	75 f0                	jne    8005c5 <vprintfmt+0x28f>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8005d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005db:	e9 67 fd ff ff       	jmp    800347 <vprintfmt+0x11>
+  8005e0:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005e3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e6:	e9 5c fd ff ff       	jmp    800347 <vprintfmt+0x11>
+  8005eb:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8005ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8005f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005f4:	eb c6                	jmp    8005bc <vprintfmt+0x286>
+	if (lflag >= 2)
+  8005f6:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8005f9:	89 55 10             	mov    %edx,0x10(%ebp)
+  8005fc:	83 f9 01             	cmp    $0x1,%ecx
+  8005ff:	7f 1f                	jg     800620 <vprintfmt+0x2ea>
+	else if (lflag)
+  800601:	85 c9                	test   %ecx,%ecx
+  800603:	74 67                	je     80066c <vprintfmt+0x336>
+		return va_arg(*ap, long);
+  800605:	8b 45 14             	mov    0x14(%ebp),%eax
+  800608:	8b 30                	mov    (%eax),%esi
+  80060a:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  80060d:	89 f0                	mov    %esi,%eax
+  80060f:	c1 f8 1f             	sar    $0x1f,%eax
+  800612:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8d 40 04             	lea    0x4(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061e:	eb 17                	jmp    800637 <vprintfmt+0x301>
+		return va_arg(*ap, long long);
+  800620:	8b 45 14             	mov    0x14(%ebp),%eax
+  800623:	8b 50 04             	mov    0x4(%eax),%edx
+  800626:	8b 00                	mov    (%eax),%eax
+  800628:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8d 40 08             	lea    0x8(%eax),%eax
+  800634:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800637:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  80063d:	be 0a 00 00 00       	mov    $0xa,%esi
+			if ((long long) num < 0) {
+  800642:	85 c9                	test   %ecx,%ecx
+  800644:	0f 89 12 01 00 00    	jns    80075c <vprintfmt+0x426>
+				putch('-', putdat);
+  80064a:	83 ec 08             	sub    $0x8,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	6a 2d                	push   $0x2d
+  800650:	ff d7                	call   *%edi
+				num = -(long long) num;
+  800652:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800655:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800658:	f7 da                	neg    %edx
+  80065a:	83 d1 00             	adc    $0x0,%ecx
+  80065d:	f7 d9                	neg    %ecx
+  80065f:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800662:	be 0a 00 00 00       	mov    $0xa,%esi
+  800667:	e9 f0 00 00 00       	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 30                	mov    (%eax),%esi
+  800671:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800674:	89 f0                	mov    %esi,%eax
+  800676:	c1 f8 1f             	sar    $0x1f,%eax
+  800679:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8d 40 04             	lea    0x4(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+  800685:	eb b0                	jmp    800637 <vprintfmt+0x301>
+	if (lflag >= 2)
+  800687:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80068a:	89 55 10             	mov    %edx,0x10(%ebp)
+  80068d:	83 f9 01             	cmp    $0x1,%ecx
+  800690:	7f 1e                	jg     8006b0 <vprintfmt+0x37a>
+	else if (lflag)
+  800692:	85 c9                	test   %ecx,%ecx
+  800694:	74 32                	je     8006c8 <vprintfmt+0x392>
+		return va_arg(*ap, unsigned long);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8b 10                	mov    (%eax),%edx
+  80069b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006a6:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long);
+  8006ab:	e9 ac 00 00 00       	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 10                	mov    (%eax),%edx
+  8006b5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006bb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006be:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned long long);
+  8006c3:	e9 94 00 00 00       	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d8:	be 0a 00 00 00       	mov    $0xa,%esi
+		return va_arg(*ap, unsigned int);
+  8006dd:	eb 7d                	jmp    80075c <vprintfmt+0x426>
+	if (lflag >= 2)
+  8006df:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8006e2:	89 55 10             	mov    %edx,0x10(%ebp)
+  8006e5:	83 f9 01             	cmp    $0x1,%ecx
+  8006e8:	7f 1b                	jg     800705 <vprintfmt+0x3cf>
+	else if (lflag)
+  8006ea:	85 c9                	test   %ecx,%ecx
+  8006ec:	74 2c                	je     80071a <vprintfmt+0x3e4>
+		return va_arg(*ap, unsigned long);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 10                	mov    (%eax),%edx
+  8006f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006fe:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long);
+  800703:	eb 57                	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070d:	8d 40 08             	lea    0x8(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800713:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned long long);
+  800718:	eb 42                	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072a:	be 08 00 00 00       	mov    $0x8,%esi
+		return va_arg(*ap, unsigned int);
+  80072f:	eb 2b                	jmp    80075c <vprintfmt+0x426>
+			putch('0', putdat);
+  800731:	89 55 10             	mov    %edx,0x10(%ebp)
+  800734:	83 ec 08             	sub    $0x8,%esp
+  800737:	53                   	push   %ebx
+  800738:	6a 30                	push   $0x30
+  80073a:	ff d7                	call   *%edi
+			putch('x', putdat);
+  80073c:	83 c4 08             	add    $0x8,%esp
+  80073f:	53                   	push   %ebx
+  800740:	6a 78                	push   $0x78
+  800742:	ff d7                	call   *%edi
+			num = (unsigned long long)
+  800744:	8b 45 14             	mov    0x14(%ebp),%eax
+  800747:	8b 10                	mov    (%eax),%edx
+  800749:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80074e:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800751:	8d 40 04             	lea    0x4(%eax),%eax
+  800754:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800757:	be 10 00 00 00       	mov    $0x10,%esi
+			printnum(putch, putdat, num, base, width, padc);
+  80075c:	83 ec 0c             	sub    $0xc,%esp
+  80075f:	0f be 45 e3          	movsbl -0x1d(%ebp),%eax
+  800763:	50                   	push   %eax
+  800764:	ff 75 e4             	push   -0x1c(%ebp)
+  800767:	56                   	push   %esi
+  800768:	51                   	push   %ecx
+  800769:	52                   	push   %edx
+  80076a:	89 da                	mov    %ebx,%edx
+  80076c:	89 f8                	mov    %edi,%eax
+  80076e:	e8 d8 fa ff ff       	call   80024b <printnum>
+			break;
+  800773:	83 c4 20             	add    $0x20,%esp
+  800776:	e9 cc fb ff ff       	jmp    800347 <vprintfmt+0x11>
+	if (lflag >= 2)
+  80077b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80077e:	89 55 10             	mov    %edx,0x10(%ebp)
+  800781:	83 f9 01             	cmp    $0x1,%ecx
+  800784:	7f 1b                	jg     8007a1 <vprintfmt+0x46b>
+	else if (lflag)
+  800786:	85 c9                	test   %ecx,%ecx
+  800788:	74 2c                	je     8007b6 <vprintfmt+0x480>
+		return va_arg(*ap, unsigned long);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8b 10                	mov    (%eax),%edx
+  80078f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80079a:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long);
+  80079f:	eb bb                	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned long long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ac:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007af:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned long long);
+  8007b4:	eb a6                	jmp    80075c <vprintfmt+0x426>
+		return va_arg(*ap, unsigned int);
+  8007b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b9:	8b 10                	mov    (%eax),%edx
+  8007bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c6:	be 10 00 00 00       	mov    $0x10,%esi
+		return va_arg(*ap, unsigned int);
+  8007cb:	eb 8f                	jmp    80075c <vprintfmt+0x426>
+			putch(ch, putdat);
+  8007cd:	89 55 10             	mov    %edx,0x10(%ebp)
+  8007d0:	83 ec 08             	sub    $0x8,%esp
+  8007d3:	53                   	push   %ebx
+  8007d4:	6a 25                	push   $0x25
+  8007d6:	ff d7                	call   *%edi
+			break;
+  8007d8:	83 c4 10             	add    $0x10,%esp
+  8007db:	e9 67 fb ff ff       	jmp    800347 <vprintfmt+0x11>
+			putch('%', putdat);
+  8007e0:	83 ec 08             	sub    $0x8,%esp
+  8007e3:	53                   	push   %ebx
+  8007e4:	6a 25                	push   $0x25
+  8007e6:	ff d7                	call   *%edi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	80 7e ff 25          	cmpb   $0x25,-0x1(%esi)
+  8007ef:	0f 84 ba fb ff ff    	je     8003af <vprintfmt+0x79>
+  8007f5:	89 75 10             	mov    %esi,0x10(%ebp)
+  8007f8:	89 f0                	mov    %esi,%eax
+  8007fa:	83 e8 01             	sub    $0x1,%eax
+  8007fd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800801:	75 f7                	jne    8007fa <vprintfmt+0x4c4>
+  800803:	89 45 10             	mov    %eax,0x10(%ebp)
+  800806:	e9 3c fb ff ff       	jmp    800347 <vprintfmt+0x11>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80080b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80080e:	8d 70 01             	lea    0x1(%eax),%esi
+  800811:	0f b6 00             	movzbl (%eax),%eax
+  800814:	0f be d0             	movsbl %al,%edx
+  800817:	85 d2                	test   %edx,%edx
+  800819:	74 11                	je     80082c <vprintfmt+0x4f6>
+  80081b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  80081e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800821:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  800824:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  800827:	e9 5d fd ff ff       	jmp    800589 <vprintfmt+0x253>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800832:	e9 10 fb ff ff       	jmp    800347 <vprintfmt+0x11>
+  800837:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80083a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80083d:	e9 05 fb ff ff       	jmp    800347 <vprintfmt+0x11>
+			if (width > 0 && padc != '-')
+  800842:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800846:	7e 0a                	jle    800852 <vprintfmt+0x51c>
+  800848:	80 7d e3 2d          	cmpb   $0x2d,-0x1d(%ebp)
+  80084c:	0f 85 bd fc ff ff    	jne    80050f <vprintfmt+0x1d9>
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800852:	ba 28 00 00 00       	mov    $0x28,%edx
+  800857:	b8 28 00 00 00       	mov    $0x28,%eax
+  80085c:	be c7 3b 80 00       	mov    $0x803bc7,%esi
+  800861:	89 7d 08             	mov    %edi,0x8(%ebp)
+  800864:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  800867:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+  80086a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80086d:	e9 17 fd ff ff       	jmp    800589 <vprintfmt+0x253>
+}
+  800872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800875:	5b                   	pop    %ebx
+  800876:	5e                   	pop    %esi
+  800877:	5f                   	pop    %edi
+  800878:	5d                   	pop    %ebp
+  800879:	c3                   	ret
+
+0080087a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80087a:	55                   	push   %ebp
+  80087b:	89 e5                	mov    %esp,%ebp
+  80087d:	83 ec 18             	sub    $0x18,%esp
+  800880:	8b 45 08             	mov    0x8(%ebp),%eax
+  800883:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800886:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800889:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80088d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800890:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800897:	85 c0                	test   %eax,%eax
+  800899:	74 26                	je     8008c1 <vsnprintf+0x47>
+  80089b:	85 d2                	test   %edx,%edx
+  80089d:	7e 22                	jle    8008c1 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80089f:	ff 75 14             	push   0x14(%ebp)
+  8008a2:	ff 75 10             	push   0x10(%ebp)
+  8008a5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008a8:	50                   	push   %eax
+  8008a9:	68 fc 02 80 00       	push   $0x8002fc
+  8008ae:	e8 83 fa ff ff       	call   800336 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008b3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008b6:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008bc:	83 c4 10             	add    $0x10,%esp
+}
+  8008bf:	c9                   	leave
+  8008c0:	c3                   	ret
+		return -E_INVAL;
+  8008c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008c6:	eb f7                	jmp    8008bf <vsnprintf+0x45>
+
+008008c8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008c8:	55                   	push   %ebp
+  8008c9:	89 e5                	mov    %esp,%ebp
+  8008cb:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008ce:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008d1:	50                   	push   %eax
+  8008d2:	ff 75 10             	push   0x10(%ebp)
+  8008d5:	ff 75 0c             	push   0xc(%ebp)
+  8008d8:	ff 75 08             	push   0x8(%ebp)
+  8008db:	e8 9a ff ff ff       	call   80087a <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008e0:	c9                   	leave
+  8008e1:	c3                   	ret
+
+008008e2 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008e2:	55                   	push   %ebp
+  8008e3:	89 e5                	mov    %esp,%ebp
+  8008e5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008e8:	80 3a 00             	cmpb   $0x0,(%edx)
+  8008eb:	74 10                	je     8008fd <strlen+0x1b>
+  8008ed:	b8 00 00 00 00       	mov    $0x0,%eax
+		n++;
+  8008f2:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008f5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008f9:	75 f7                	jne    8008f2 <strlen+0x10>
+	return n;
+}
+  8008fb:	5d                   	pop    %ebp
+  8008fc:	c3                   	ret
+	for (n = 0; *s != '\0'; s++)
+  8008fd:	b8 00 00 00 00       	mov    $0x0,%eax
+	return n;
+  800902:	eb f7                	jmp    8008fb <strlen+0x19>
+
+00800904 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800904:	55                   	push   %ebp
+  800905:	89 e5                	mov    %esp,%ebp
+  800907:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80090d:	85 d2                	test   %edx,%edx
+  80090f:	74 16                	je     800927 <strnlen+0x23>
+  800911:	b8 00 00 00 00       	mov    $0x0,%eax
+  800916:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80091a:	74 09                	je     800925 <strnlen+0x21>
+		n++;
+  80091c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80091f:	39 d0                	cmp    %edx,%eax
+  800921:	75 f3                	jne    800916 <strnlen+0x12>
+		n++;
+  800923:	89 d0                	mov    %edx,%eax
+	return n;
+}
+  800925:	5d                   	pop    %ebp
+  800926:	c3                   	ret
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	eb f7                	jmp    800925 <strnlen+0x21>
+
+0080092e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	53                   	push   %ebx
+  800932:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800935:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800941:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800944:	83 c0 01             	add    $0x1,%eax
+  800947:	84 d2                	test   %dl,%dl
+  800949:	75 f2                	jne    80093d <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80094b:	89 c8                	mov    %ecx,%eax
+  80094d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800950:	c9                   	leave
+  800951:	c3                   	ret
+
+00800952 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	53                   	push   %ebx
+  800956:	83 ec 10             	sub    $0x10,%esp
+  800959:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80095c:	53                   	push   %ebx
+  80095d:	e8 80 ff ff ff       	call   8008e2 <strlen>
+  800962:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800965:	ff 75 0c             	push   0xc(%ebp)
+  800968:	01 d8                	add    %ebx,%eax
+  80096a:	50                   	push   %eax
+  80096b:	e8 be ff ff ff       	call   80092e <strcpy>
+	return dst;
+}
+  800970:	89 d8                	mov    %ebx,%eax
+  800972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+  80097c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800982:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800985:	85 db                	test   %ebx,%ebx
+  800987:	74 17                	je     8009a0 <strncpy+0x29>
+  800989:	01 f3                	add    %esi,%ebx
+  80098b:	89 f0                	mov    %esi,%eax
+		*dst++ = *src;
+  80098d:	83 c0 01             	add    $0x1,%eax
+  800990:	0f b6 0a             	movzbl (%edx),%ecx
+  800993:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800996:	80 f9 01             	cmp    $0x1,%cl
+  800999:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80099c:	39 c3                	cmp    %eax,%ebx
+  80099e:	75 ed                	jne    80098d <strncpy+0x16>
+	}
+	return ret;
+}
+  8009a0:	89 f0                	mov    %esi,%eax
+  8009a2:	5b                   	pop    %ebx
+  8009a3:	5e                   	pop    %esi
+  8009a4:	5d                   	pop    %ebp
+  8009a5:	c3                   	ret
+
+008009a6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	56                   	push   %esi
+  8009aa:	53                   	push   %ebx
+  8009ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8009b4:	89 f0                	mov    %esi,%eax
+  8009b6:	85 db                	test   %ebx,%ebx
+  8009b8:	74 1e                	je     8009d8 <strlcpy+0x32>
+		while (--size > 0 && *src != '\0')
+  8009ba:	83 eb 01             	sub    $0x1,%ebx
+  8009bd:	74 16                	je     8009d5 <strlcpy+0x2f>
+  8009bf:	01 f3                	add    %esi,%ebx
+  8009c1:	0f b6 0a             	movzbl (%edx),%ecx
+  8009c4:	84 c9                	test   %cl,%cl
+  8009c6:	74 0d                	je     8009d5 <strlcpy+0x2f>
+			*dst++ = *src++;
+  8009c8:	83 c2 01             	add    $0x1,%edx
+  8009cb:	83 c0 01             	add    $0x1,%eax
+  8009ce:	88 48 ff             	mov    %cl,-0x1(%eax)
+		while (--size > 0 && *src != '\0')
+  8009d1:	39 d8                	cmp    %ebx,%eax
+  8009d3:	75 ec                	jne    8009c1 <strlcpy+0x1b>
+		*dst = '\0';
+  8009d5:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009d8:	29 f0                	sub    %esi,%eax
+}
+  8009da:	5b                   	pop    %ebx
+  8009db:	5e                   	pop    %esi
+  8009dc:	5d                   	pop    %ebp
+  8009dd:	c3                   	ret
+
+008009de <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009de:	55                   	push   %ebp
+  8009df:	89 e5                	mov    %esp,%ebp
+  8009e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009e7:	0f b6 01             	movzbl (%ecx),%eax
+  8009ea:	84 c0                	test   %al,%al
+  8009ec:	74 11                	je     8009ff <strcmp+0x21>
+  8009ee:	38 02                	cmp    %al,(%edx)
+  8009f0:	75 0d                	jne    8009ff <strcmp+0x21>
+		p++, q++;
+  8009f2:	83 c1 01             	add    $0x1,%ecx
+  8009f5:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009f8:	0f b6 01             	movzbl (%ecx),%eax
+  8009fb:	84 c0                	test   %al,%al
+  8009fd:	75 ef                	jne    8009ee <strcmp+0x10>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009ff:	0f b6 c0             	movzbl %al,%eax
+  800a02:	0f b6 12             	movzbl (%edx),%edx
+  800a05:	29 d0                	sub    %edx,%eax
+}
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	53                   	push   %ebx
+  800a0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a10:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800a13:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+		n--, p++, q++;
+	if (n == 0)
+		return 0;
+  800a16:	b8 00 00 00 00       	mov    $0x0,%eax
+	while (n > 0 && *p && *p == *q)
+  800a1b:	85 d2                	test   %edx,%edx
+  800a1d:	74 2e                	je     800a4d <strncmp+0x44>
+  800a1f:	0f b6 01             	movzbl (%ecx),%eax
+  800a22:	84 c0                	test   %al,%al
+  800a24:	74 16                	je     800a3c <strncmp+0x33>
+  800a26:	3a 03                	cmp    (%ebx),%al
+  800a28:	75 12                	jne    800a3c <strncmp+0x33>
+		n--, p++, q++;
+  800a2a:	83 c1 01             	add    $0x1,%ecx
+  800a2d:	83 c3 01             	add    $0x1,%ebx
+	while (n > 0 && *p && *p == *q)
+  800a30:	83 ea 01             	sub    $0x1,%edx
+  800a33:	75 ea                	jne    800a1f <strncmp+0x16>
+		return 0;
+  800a35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3a:	eb 11                	jmp    800a4d <strncmp+0x44>
+  800a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  800a41:	85 d2                	test   %edx,%edx
+  800a43:	74 08                	je     800a4d <strncmp+0x44>
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a45:	0f b6 01             	movzbl (%ecx),%eax
+  800a48:	0f b6 13             	movzbl (%ebx),%edx
+  800a4b:	29 d0                	sub    %edx,%eax
+}
+  800a4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a50:	c9                   	leave
+  800a51:	c3                   	ret
+
+00800a52 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a58:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a5c:	0f b6 10             	movzbl (%eax),%edx
+  800a5f:	84 d2                	test   %dl,%dl
+  800a61:	74 15                	je     800a78 <strchr+0x26>
+		if (*s == c)
+  800a63:	38 d1                	cmp    %dl,%cl
+  800a65:	74 0f                	je     800a76 <strchr+0x24>
+	for (; *s; s++)
+  800a67:	83 c0 01             	add    $0x1,%eax
+  800a6a:	0f b6 10             	movzbl (%eax),%edx
+  800a6d:	84 d2                	test   %dl,%dl
+  800a6f:	75 f2                	jne    800a63 <strchr+0x11>
+			return (char *) s;
+	return 0;
+  800a71:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+	return 0;
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	eb f7                	jmp    800a76 <strchr+0x24>
+
+00800a7f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	53                   	push   %ebx
+  800a83:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a86:	8b 55 0c             	mov    0xc(%ebp),%edx
+	for (; *s; s++)
+  800a89:	0f b6 18             	movzbl (%eax),%ebx
+		if (*s == c)
+  800a8c:	38 d3                	cmp    %dl,%bl
+  800a8e:	74 14                	je     800aa4 <strfind+0x25>
+  800a90:	89 d1                	mov    %edx,%ecx
+  800a92:	84 db                	test   %bl,%bl
+  800a94:	74 0e                	je     800aa4 <strfind+0x25>
+	for (; *s; s++)
+  800a96:	83 c0 01             	add    $0x1,%eax
+  800a99:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a9c:	38 ca                	cmp    %cl,%dl
+  800a9e:	74 04                	je     800aa4 <strfind+0x25>
+  800aa0:	84 d2                	test   %dl,%dl
+  800aa2:	75 f2                	jne    800a96 <strfind+0x17>
+			break;
+	return (char *) s;
+}
+  800aa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa7:	c9                   	leave
+  800aa8:	c3                   	ret
+
+00800aa9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	57                   	push   %edi
+  800aad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ab0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ab3:	85 c9                	test   %ecx,%ecx
+  800ab5:	74 20                	je     800ad7 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800ab7:	89 f8                	mov    %edi,%eax
+  800ab9:	09 c8                	or     %ecx,%eax
+  800abb:	a8 03                	test   $0x3,%al
+  800abd:	75 12                	jne    800ad1 <memset+0x28>
+		c &= 0xFF;
+  800abf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ac3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ac9:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800acc:	fc                   	cld
+  800acd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800acf:	eb 06                	jmp    800ad7 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ad1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ad4:	fc                   	cld
+  800ad5:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ad7:	89 f8                	mov    %edi,%eax
+  800ad9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800adc:	c9                   	leave
+  800add:	c3                   	ret
+
+00800ade <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ae9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+	
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aec:	39 c6                	cmp    %eax,%esi
+  800aee:	73 32                	jae    800b22 <memmove+0x44>
+  800af0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800af3:	39 d0                	cmp    %edx,%eax
+  800af5:	73 2b                	jae    800b22 <memmove+0x44>
+		s += n;
+		d += n;
+  800af7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800afa:	89 d6                	mov    %edx,%esi
+  800afc:	09 fe                	or     %edi,%esi
+  800afe:	09 ce                	or     %ecx,%esi
+  800b00:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b06:	75 0e                	jne    800b16 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b08:	83 ef 04             	sub    $0x4,%edi
+  800b0b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b0e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800b11:	fd                   	std
+  800b12:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b14:	eb 09                	jmp    800b1f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b16:	83 ef 01             	sub    $0x1,%edi
+  800b19:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800b1c:	fd                   	std
+  800b1d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800b1f:	fc                   	cld
+  800b20:	eb 1a                	jmp    800b3c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b22:	89 f2                	mov    %esi,%edx
+  800b24:	09 c2                	or     %eax,%edx
+  800b26:	09 ca                	or     %ecx,%edx
+  800b28:	f6 c2 03             	test   $0x3,%dl
+  800b2b:	75 0a                	jne    800b37 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b2d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800b30:	89 c7                	mov    %eax,%edi
+  800b32:	fc                   	cld
+  800b33:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b35:	eb 05                	jmp    800b3c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800b37:	89 c7                	mov    %eax,%edi
+  800b39:	fc                   	cld
+  800b3a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <memcpy>:
+
+/* sigh - gcc emits references to this for structure assignments! */
+/* it is *not* prototyped in inc/string.h - do not use directly. */
+void *
+memcpy(void *dst, void *src, size_t n)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b46:	ff 75 10             	push   0x10(%ebp)
+  800b49:	ff 75 0c             	push   0xc(%ebp)
+  800b4c:	ff 75 08             	push   0x8(%ebp)
+  800b4f:	e8 8a ff ff ff       	call   800ade <memmove>
+}
+  800b54:	c9                   	leave
+  800b55:	c3                   	ret
+
+00800b56 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b56:	55                   	push   %ebp
+  800b57:	89 e5                	mov    %esp,%ebp
+  800b59:	56                   	push   %esi
+  800b5a:	53                   	push   %ebx
+  800b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b61:	8b 75 10             	mov    0x10(%ebp),%esi
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b64:	85 f6                	test   %esi,%esi
+  800b66:	74 29                	je     800b91 <memcmp+0x3b>
+  800b68:	01 c6                	add    %eax,%esi
+		if (*s1 != *s2)
+  800b6a:	0f b6 08             	movzbl (%eax),%ecx
+  800b6d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b70:	38 d9                	cmp    %bl,%cl
+  800b72:	75 11                	jne    800b85 <memcmp+0x2f>
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b74:	83 c0 01             	add    $0x1,%eax
+  800b77:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b7a:	39 c6                	cmp    %eax,%esi
+  800b7c:	75 ec                	jne    800b6a <memcmp+0x14>
+	}
+
+	return 0;
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b83:	eb 08                	jmp    800b8d <memcmp+0x37>
+			return (int) *s1 - (int) *s2;
+  800b85:	0f b6 c1             	movzbl %cl,%eax
+  800b88:	0f b6 db             	movzbl %bl,%ebx
+  800b8b:	29 d8                	sub    %ebx,%eax
+}
+  800b8d:	5b                   	pop    %ebx
+  800b8e:	5e                   	pop    %esi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+	return 0;
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b96:	eb f5                	jmp    800b8d <memcmp+0x37>
+
+00800b98 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b98:	55                   	push   %ebp
+  800b99:	89 e5                	mov    %esp,%ebp
+  800b9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ba1:	89 c2                	mov    %eax,%edx
+  800ba3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ba6:	39 d0                	cmp    %edx,%eax
+  800ba8:	73 0d                	jae    800bb7 <memfind+0x1f>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800baa:	38 08                	cmp    %cl,(%eax)
+  800bac:	74 0d                	je     800bbb <memfind+0x23>
+	for (; s < ends; s++)
+  800bae:	83 c0 01             	add    $0x1,%eax
+  800bb1:	39 c2                	cmp    %eax,%edx
+  800bb3:	75 f5                	jne    800baa <memfind+0x12>
+  800bb5:	eb 06                	jmp    800bbd <memfind+0x25>
+  800bb7:	89 c2                	mov    %eax,%edx
+  800bb9:	eb 02                	jmp    800bbd <memfind+0x25>
+  800bbb:	89 c2                	mov    %eax,%edx
+			break;
+	return (void *) s;
+}
+  800bbd:	89 d0                	mov    %edx,%eax
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+
+00800bc1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	57                   	push   %edi
+  800bc5:	56                   	push   %esi
+  800bc6:	53                   	push   %ebx
+  800bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800bcd:	0f b6 02             	movzbl (%edx),%eax
+  800bd0:	3c 20                	cmp    $0x20,%al
+  800bd2:	74 04                	je     800bd8 <strtol+0x17>
+  800bd4:	3c 09                	cmp    $0x9,%al
+  800bd6:	75 0e                	jne    800be6 <strtol+0x25>
+		s++;
+  800bd8:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800bdb:	0f b6 02             	movzbl (%edx),%eax
+  800bde:	3c 20                	cmp    $0x20,%al
+  800be0:	74 f6                	je     800bd8 <strtol+0x17>
+  800be2:	3c 09                	cmp    $0x9,%al
+  800be4:	74 f2                	je     800bd8 <strtol+0x17>
+
+	// plus/minus sign
+	if (*s == '+')
+  800be6:	3c 2b                	cmp    $0x2b,%al
+  800be8:	74 2a                	je     800c14 <strtol+0x53>
+	int neg = 0;
+  800bea:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800bef:	3c 2d                	cmp    $0x2d,%al
+  800bf1:	74 2b                	je     800c1e <strtol+0x5d>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bf3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bf9:	75 0f                	jne    800c0a <strtol+0x49>
+  800bfb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bfe:	74 28                	je     800c28 <strtol+0x67>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c00:	85 db                	test   %ebx,%ebx
+  800c02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c07:	0f 44 d8             	cmove  %eax,%ebx
+  800c0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c12:	eb 46                	jmp    800c5a <strtol+0x99>
+		s++;
+  800c14:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c1c:	eb d5                	jmp    800bf3 <strtol+0x32>
+		s++, neg = 1;
+  800c1e:	83 c2 01             	add    $0x1,%edx
+  800c21:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c26:	eb cb                	jmp    800bf3 <strtol+0x32>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c28:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c2c:	74 0e                	je     800c3c <strtol+0x7b>
+	else if (base == 0 && s[0] == '0')
+  800c2e:	85 db                	test   %ebx,%ebx
+  800c30:	75 d8                	jne    800c0a <strtol+0x49>
+		s++, base = 8;
+  800c32:	83 c2 01             	add    $0x1,%edx
+  800c35:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c3a:	eb ce                	jmp    800c0a <strtol+0x49>
+		s += 2, base = 16;
+  800c3c:	83 c2 02             	add    $0x2,%edx
+  800c3f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c44:	eb c4                	jmp    800c0a <strtol+0x49>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c46:	0f be c0             	movsbl %al,%eax
+  800c49:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800c4c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c4f:	7d 3a                	jge    800c8b <strtol+0xca>
+			break;
+		s++, val = (val * base) + dig;
+  800c51:	83 c2 01             	add    $0x1,%edx
+  800c54:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c58:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800c5a:	0f b6 02             	movzbl (%edx),%eax
+  800c5d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c60:	89 f3                	mov    %esi,%ebx
+  800c62:	80 fb 09             	cmp    $0x9,%bl
+  800c65:	76 df                	jbe    800c46 <strtol+0x85>
+		else if (*s >= 'a' && *s <= 'z')
+  800c67:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c6a:	89 f3                	mov    %esi,%ebx
+  800c6c:	80 fb 19             	cmp    $0x19,%bl
+  800c6f:	77 08                	ja     800c79 <strtol+0xb8>
+			dig = *s - 'a' + 10;
+  800c71:	0f be c0             	movsbl %al,%eax
+  800c74:	83 e8 57             	sub    $0x57,%eax
+  800c77:	eb d3                	jmp    800c4c <strtol+0x8b>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c79:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c7c:	89 f3                	mov    %esi,%ebx
+  800c7e:	80 fb 19             	cmp    $0x19,%bl
+  800c81:	77 08                	ja     800c8b <strtol+0xca>
+			dig = *s - 'A' + 10;
+  800c83:	0f be c0             	movsbl %al,%eax
+  800c86:	83 e8 37             	sub    $0x37,%eax
+  800c89:	eb c1                	jmp    800c4c <strtol+0x8b>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c8b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c8f:	74 05                	je     800c96 <strtol+0xd5>
+		*endptr = (char *) s;
+  800c91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c94:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c96:	89 c8                	mov    %ecx,%eax
+  800c98:	f7 d8                	neg    %eax
+  800c9a:	85 ff                	test   %edi,%edi
+  800c9c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c9f:	89 c8                	mov    %ecx,%eax
+  800ca1:	5b                   	pop    %ebx
+  800ca2:	5e                   	pop    %esi
+  800ca3:	5f                   	pop    %edi
+  800ca4:	5d                   	pop    %ebp
+  800ca5:	c3                   	ret
+
+00800ca6 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	57                   	push   %edi
+  800caa:	56                   	push   %esi
+  800cab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb7:	89 c3                	mov    %eax,%ebx
+  800cb9:	89 c7                	mov    %eax,%edi
+  800cbb:	89 c6                	mov    %eax,%esi
+  800cbd:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cbf:	5b                   	pop    %ebx
+  800cc0:	5e                   	pop    %esi
+  800cc1:	5f                   	pop    %edi
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd4:	89 d1                	mov    %edx,%ecx
+  800cd6:	89 d3                	mov    %edx,%ebx
+  800cd8:	89 d7                	mov    %edx,%edi
+  800cda:	89 d6                	mov    %edx,%esi
+  800cdc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cde:	5b                   	pop    %ebx
+  800cdf:	5e                   	pop    %esi
+  800ce0:	5f                   	pop    %edi
+  800ce1:	5d                   	pop    %ebp
+  800ce2:	c3                   	ret
+
+00800ce3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce3:	55                   	push   %ebp
+  800ce4:	89 e5                	mov    %esp,%ebp
+  800ce6:	57                   	push   %edi
+  800ce7:	56                   	push   %esi
+  800ce8:	53                   	push   %ebx
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf9:	89 cb                	mov    %ecx,%ebx
+  800cfb:	89 cf                	mov    %ecx,%edi
+  800cfd:	89 ce                	mov    %ecx,%esi
+  800cff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d01:	85 c0                	test   %eax,%eax
+  800d03:	7f 08                	jg     800d0d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d0d:	83 ec 0c             	sub    $0xc,%esp
+  800d10:	50                   	push   %eax
+  800d11:	6a 03                	push   $0x3
+  800d13:	68 eb 3e 80 00       	push   $0x803eeb
+  800d18:	6a 23                	push   $0x23
+  800d1a:	68 08 3f 80 00       	push   $0x803f08
+  800d1f:	e8 79 28 00 00       	call   80359d <_panic>
+
+00800d24 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d24:	55                   	push   %ebp
+  800d25:	89 e5                	mov    %esp,%ebp
+  800d27:	57                   	push   %edi
+  800d28:	56                   	push   %esi
+  800d29:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d34:	89 d1                	mov    %edx,%ecx
+  800d36:	89 d3                	mov    %edx,%ebx
+  800d38:	89 d7                	mov    %edx,%edi
+  800d3a:	89 d6                	mov    %edx,%esi
+  800d3c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d3e:	5b                   	pop    %ebx
+  800d3f:	5e                   	pop    %esi
+  800d40:	5f                   	pop    %edi
+  800d41:	5d                   	pop    %ebp
+  800d42:	c3                   	ret
+
+00800d43 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d53:	89 d1                	mov    %edx,%ecx
+  800d55:	89 d3                	mov    %edx,%ebx
+  800d57:	89 d7                	mov    %edx,%edi
+  800d59:	89 d6                	mov    %edx,%esi
+  800d5b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d5d:	5b                   	pop    %ebx
+  800d5e:	5e                   	pop    %esi
+  800d5f:	5f                   	pop    %edi
+  800d60:	5d                   	pop    %ebp
+  800d61:	c3                   	ret
+
+00800d62 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d62:	55                   	push   %ebp
+  800d63:	89 e5                	mov    %esp,%ebp
+  800d65:	57                   	push   %edi
+  800d66:	56                   	push   %esi
+  800d67:	53                   	push   %ebx
+  800d68:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d76:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7e:	89 f7                	mov    %esi,%edi
+  800d80:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d82:	85 c0                	test   %eax,%eax
+  800d84:	7f 08                	jg     800d8e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800d86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d89:	5b                   	pop    %ebx
+  800d8a:	5e                   	pop    %esi
+  800d8b:	5f                   	pop    %edi
+  800d8c:	5d                   	pop    %ebp
+  800d8d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8e:	83 ec 0c             	sub    $0xc,%esp
+  800d91:	50                   	push   %eax
+  800d92:	6a 04                	push   $0x4
+  800d94:	68 eb 3e 80 00       	push   $0x803eeb
+  800d99:	6a 23                	push   $0x23
+  800d9b:	68 08 3f 80 00       	push   $0x803f08
+  800da0:	e8 f8 27 00 00       	call   80359d <_panic>
+
+00800da5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	57                   	push   %edi
+  800da9:	56                   	push   %esi
+  800daa:	53                   	push   %ebx
+  800dab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbf:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dc4:	85 c0                	test   %eax,%eax
+  800dc6:	7f 08                	jg     800dd0 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800dc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd0:	83 ec 0c             	sub    $0xc,%esp
+  800dd3:	50                   	push   %eax
+  800dd4:	6a 05                	push   $0x5
+  800dd6:	68 eb 3e 80 00       	push   $0x803eeb
+  800ddb:	6a 23                	push   $0x23
+  800ddd:	68 08 3f 80 00       	push   $0x803f08
+  800de2:	e8 b6 27 00 00       	call   80359d <_panic>
+
+00800de7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+  800ded:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e00:	89 df                	mov    %ebx,%edi
+  800e02:	89 de                	mov    %ebx,%esi
+  800e04:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e06:	85 c0                	test   %eax,%eax
+  800e08:	7f 08                	jg     800e12 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e12:	83 ec 0c             	sub    $0xc,%esp
+  800e15:	50                   	push   %eax
+  800e16:	6a 06                	push   $0x6
+  800e18:	68 eb 3e 80 00       	push   $0x803eeb
+  800e1d:	6a 23                	push   $0x23
+  800e1f:	68 08 3f 80 00       	push   $0x803f08
+  800e24:	e8 74 27 00 00       	call   80359d <_panic>
+
+00800e29 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3d:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e42:	89 df                	mov    %ebx,%edi
+  800e44:	89 de                	mov    %ebx,%esi
+  800e46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e48:	85 c0                	test   %eax,%eax
+  800e4a:	7f 08                	jg     800e54 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+  800e57:	50                   	push   %eax
+  800e58:	6a 08                	push   $0x8
+  800e5a:	68 eb 3e 80 00       	push   $0x803eeb
+  800e5f:	6a 23                	push   $0x23
+  800e61:	68 08 3f 80 00       	push   $0x803f08
+  800e66:	e8 32 27 00 00       	call   80359d <_panic>
+
+00800e6b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7f:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e84:	89 df                	mov    %ebx,%edi
+  800e86:	89 de                	mov    %ebx,%esi
+  800e88:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8a:	85 c0                	test   %eax,%eax
+  800e8c:	7f 08                	jg     800e96 <sys_env_set_trapframe+0x2b>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800e8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e91:	5b                   	pop    %ebx
+  800e92:	5e                   	pop    %esi
+  800e93:	5f                   	pop    %edi
+  800e94:	5d                   	pop    %ebp
+  800e95:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e96:	83 ec 0c             	sub    $0xc,%esp
+  800e99:	50                   	push   %eax
+  800e9a:	6a 09                	push   $0x9
+  800e9c:	68 eb 3e 80 00       	push   $0x803eeb
+  800ea1:	6a 23                	push   $0x23
+  800ea3:	68 08 3f 80 00       	push   $0x803f08
+  800ea8:	e8 f0 26 00 00       	call   80359d <_panic>
+
+00800ead <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	57                   	push   %edi
+  800eb1:	56                   	push   %esi
+  800eb2:	53                   	push   %ebx
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ec6:	89 df                	mov    %ebx,%edi
+  800ec8:	89 de                	mov    %ebx,%esi
+  800eca:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	7f 08                	jg     800ed8 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ed0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	50                   	push   %eax
+  800edc:	6a 0a                	push   $0xa
+  800ede:	68 eb 3e 80 00       	push   $0x803eeb
+  800ee3:	6a 23                	push   $0x23
+  800ee5:	68 08 3f 80 00       	push   $0x803f08
+  800eea:	e8 ae 26 00 00       	call   80359d <_panic>
+
+00800eef <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f00:	be 00 00 00 00       	mov    $0x0,%esi
+  800f05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f08:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, 0);
+}
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5e                   	pop    %esi
+  800f0f:	5f                   	pop    %edi
+  800f10:	5d                   	pop    %ebp
+  800f11:	c3                   	ret
+
+00800f12 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva)
+{
+  800f12:	55                   	push   %ebp
+  800f13:	89 e5                	mov    %esp,%ebp
+  800f15:	57                   	push   %edi
+  800f16:	56                   	push   %esi
+  800f17:	53                   	push   %ebx
+  800f18:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f23:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f28:	89 cb                	mov    %ecx,%ebx
+  800f2a:	89 cf                	mov    %ecx,%edi
+  800f2c:	89 ce                	mov    %ecx,%esi
+  800f2e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f30:	85 c0                	test   %eax,%eax
+  800f32:	7f 08                	jg     800f3c <sys_ipc_recv+0x2a>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+}
+  800f34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+  800f3f:	50                   	push   %eax
+  800f40:	6a 0d                	push   $0xd
+  800f42:	68 eb 3e 80 00       	push   $0x803eeb
+  800f47:	6a 23                	push   $0x23
+  800f49:	68 08 3f 80 00       	push   $0x803f08
+  800f4e:	e8 4a 26 00 00       	call   80359d <_panic>
+
+00800f53 <sys_ipc_try_send_pages>:
+
+int
+sys_ipc_try_send_pages(envid_t envid, uint32_t value, void *srcva, int perm,
+		       int npages)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f64:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f67:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f6d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm, npages);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_ipc_recv_pages>:
+
+int
+sys_ipc_recv_pages(void *dstva, int maxpages)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  800f7a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f88:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f8d:	89 df                	mov    %ebx,%edi
+  800f8f:	89 de                	mov    %ebx,%esi
+  800f91:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f93:	85 c0                	test   %eax,%eax
+  800f95:	7f 08                	jg     800f9f <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t) dstva, maxpages, 0, 0, 0);
+}
+  800f97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9a:	5b                   	pop    %ebx
+  800f9b:	5e                   	pop    %esi
+  800f9c:	5f                   	pop    %edi
+  800f9d:	5d                   	pop    %ebp
+  800f9e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9f:	83 ec 0c             	sub    $0xc,%esp
+  800fa2:	50                   	push   %eax
+  800fa3:	6a 0d                	push   $0xd
+  800fa5:	68 eb 3e 80 00       	push   $0x803eeb
+  800faa:	6a 23                	push   $0x23
+  800fac:	68 08 3f 80 00       	push   $0x803f08
+  800fb1:	e8 e7 25 00 00       	call   80359d <_panic>
+
+00800fb6 <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb6:	55                   	push   %ebp
+  800fb7:	89 e5                	mov    %esp,%ebp
+  800fb9:	57                   	push   %edi
+  800fba:	56                   	push   %esi
+  800fbb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fc6:	89 d1                	mov    %edx,%ecx
+  800fc8:	89 d3                	mov    %edx,%ebx
+  800fca:	89 d7                	mov    %edx,%edi
+  800fcc:	89 d6                	mov    %edx,%esi
+  800fce:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fd0:	5b                   	pop    %ebx
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+
+00800fd5 <sys_net_transmit>:
+int 
+sys_net_transmit(void *src, size_t len)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800feb:	89 df                	mov    %ebx,%edi
+  800fed:	89 de                	mov    %ebx,%esi
+  800fef:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_transmit, 0, (uint32_t) src, len, 0, 0, 0);
+}	
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <sys_net_receive>:
+int 
+sys_net_receive(void *dst)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	b8 10 00 00 00       	mov    $0x10,%eax
+  801009:	89 cb                	mov    %ecx,%ebx
+  80100b:	89 cf                	mov    %ecx,%edi
+  80100d:	89 ce                	mov    %ecx,%esi
+  80100f:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_net_receive, 0, (uint32_t) dst, 0, 0, 0, 0);
+}
+  801011:	5b                   	pop    %ebx
+  801012:	5e                   	pop    %esi
+  801013:	5f                   	pop    %edi
+  801014:	5d                   	pop    %ebp
+  801015:	c3                   	ret
+
+00801016 <sys_get_mac>:
+
+int sys_get_mac(uint32_t *low, uint32_t *high)
+{
+  801016:	55                   	push   %ebp
+  801017:	89 e5                	mov    %esp,%ebp
+  801019:	57                   	push   %edi
+  80101a:	56                   	push   %esi
+  80101b:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801021:	8b 55 08             	mov    0x8(%ebp),%edx
+  801024:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801027:	b8 11 00 00 00       	mov    $0x11,%eax
+  80102c:	89 df                	mov    %ebx,%edi
+  80102e:	89 de                	mov    %ebx,%esi
+  801030:	cd 30                	int    $0x30
+	return (unsigned int) syscall(SYS_get_mac, 0, (uint32_t)low, (uint32_t)high, 0, 0, 0);
+}
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+
+00801037 <sys_page_batch>:
+
+int
+sys_page_batch(struct PageOp *ops, int n)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80103d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801042:	8b 55 08             	mov    0x8(%ebp),%edx
+  801045:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801048:	b8 12 00 00 00       	mov    $0x12,%eax
+  80104d:	89 df                	mov    %ebx,%edi
+  80104f:	89 de                	mov    %ebx,%esi
+  801051:	cd 30                	int    $0x30
+	return syscall(SYS_page_batch, 0, (uint32_t) ops, n, 0, 0, 0);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_tlb_stats>:
+
+int
+sys_tlb_stats(struct TlbStats *ts)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80105e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	b8 13 00 00 00       	mov    $0x13,%eax
+  80106b:	89 cb                	mov    %ecx,%ebx
+  80106d:	89 cf                	mov    %ecx,%edi
+  80106f:	89 ce                	mov    %ecx,%esi
+  801071:	cd 30                	int    $0x30
+	return syscall(SYS_tlb_stats, 0, (uint32_t) ts, 0, 0, 0, 0);
+}
+  801073:	5b                   	pop    %ebx
+  801074:	5e                   	pop    %esi
+  801075:	5f                   	pop    %edi
+  801076:	5d                   	pop    %ebp
+  801077:	c3                   	ret
+
+00801078 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *va, int n)
+{
+  801078:	55                   	push   %ebp
+  801079:	89 e5                	mov    %esp,%ebp
+  80107b:	57                   	push   %edi
+  80107c:	56                   	push   %esi
+  80107d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	8b 55 08             	mov    0x8(%ebp),%edx
+  801086:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801089:	b8 14 00 00 00       	mov    $0x14,%eax
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	89 de                	mov    %ebx,%esi
+  801092:	cd 30                	int    $0x30
+	return syscall(SYS_net_recv_pages, 0, (uint32_t) va, n, 0, 0, 0);
+}
+  801094:	5b                   	pop    %ebx
+  801095:	5e                   	pop    %esi
+  801096:	5f                   	pop    %edi
+  801097:	5d                   	pop    %ebp
+  801098:	c3                   	ret
+
+00801099 <sys_net_stats>:
+
+int
+sys_net_stats(struct NetStats *ns)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80109f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010ac:	89 cb                	mov    %ecx,%ebx
+  8010ae:	89 cf                	mov    %ecx,%edi
+  8010b0:	89 ce                	mov    %ecx,%esi
+  8010b2:	cd 30                	int    $0x30
+	return syscall(SYS_net_stats, 0, (uint32_t) ns, 0, 0, 0, 0);
+}
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+
+008010b9 <sys_net_transmit_sg>:
+
+int
+sys_net_transmit_sg(struct NetFrag *frags, int nfrag, struct NetOffload *off)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ca:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d2:	89 f7                	mov    %esi,%edi
+  8010d4:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_sg, 0, (uint32_t) frags, nfrag,
+		       (uint32_t) off, 0, 0);
+}
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_net_transmit_batch>:
+
+int
+sys_net_transmit_batch(struct NetFrag *frames, int n)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	89 de                	mov    %ebx,%esi
+  8010f5:	cd 30                	int    $0x30
+	return syscall(SYS_net_transmit_batch, 0, (uint32_t) frames, n, 0, 0, 0);
+}
+  8010f7:	5b                   	pop    %ebx
+  8010f8:	5e                   	pop    %esi
+  8010f9:	5f                   	pop    %edi
+  8010fa:	5d                   	pop    %ebp
+  8010fb:	c3                   	ret
+
+008010fc <sys_net_set_queue>:
+
+int
+sys_net_set_queue(int q)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801102:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801107:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80110f:	89 cb                	mov    %ecx,%ebx
+  801111:	89 cf                	mov    %ecx,%edi
+  801113:	89 ce                	mov    %ecx,%esi
+  801115:	cd 30                	int    $0x30
+	return syscall(SYS_net_set_queue, 0, q, 0, 0, 0, 0);
+}
+  801117:	5b                   	pop    %ebx
+  801118:	5e                   	pop    %esi
+  801119:	5f                   	pop    %edi
+  80111a:	5d                   	pop    %ebp
+  80111b:	c3                   	ret
+
+0080111c <sys_net_listen>:
+
+int
+sys_net_listen(uint16_t port, bool on)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+	return syscall(SYS_net_listen, 0, port, on, 0, 0, 0);
+  801122:	0f b7 55 08          	movzwl 0x8(%ebp),%edx
+	asm volatile("int %1\n"
+  801126:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	b8 19 00 00 00       	mov    $0x19,%eax
+  801133:	89 df                	mov    %ebx,%edi
+  801135:	89 de                	mov    %ebx,%esi
+  801137:	cd 30                	int    $0x30
+}
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+
+0080113e <sys_alarm>:
+
+int
+sys_alarm(uint32_t msec, uint32_t period, uint32_t value)
+{
+  80113e:	55                   	push   %ebp
+  80113f:	89 e5                	mov    %esp,%ebp
+  801141:	57                   	push   %edi
+  801142:	56                   	push   %esi
+  801143:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801144:	be 00 00 00 00       	mov    $0x0,%esi
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801154:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801157:	89 f7                	mov    %esi,%edi
+  801159:	cd 30                	int    $0x30
+	return syscall(SYS_alarm, 0, msec, period, value, 0, 0);
+}
+  80115b:	5b                   	pop    %ebx
+  80115c:	5e                   	pop    %esi
+  80115d:	5f                   	pop    %edi
+  80115e:	5d                   	pop    %ebp
+  80115f:	c3                   	ret
+
+00801160 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t val, uint32_t msec)
+{
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801166:	be 00 00 00 00       	mov    $0x0,%esi
+  80116b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801171:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801176:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801179:	89 f7                	mov    %esi,%edi
+  80117b:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wait, 0, (uint32_t) addr, val, msec, 0, 0);
+}
+  80117d:	5b                   	pop    %ebx
+  80117e:	5e                   	pop    %esi
+  80117f:	5f                   	pop    %edi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+
+00801182 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801188:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801190:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801193:	b8 1c 00 00 00       	mov    $0x1c,%eax
+  801198:	89 df                	mov    %ebx,%edi
+  80119a:	89 de                	mov    %ebx,%esi
+  80119c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80119e:	5b                   	pop    %ebx
+  80119f:	5e                   	pop    %esi
+  8011a0:	5f                   	pop    %edi
+  8011a1:	5d                   	pop    %ebp
+  8011a2:	c3                   	ret
+
+008011a3 <sys_exofork_shared>:
+
+envid_t
+sys_exofork_shared(void *eip, void *esp, void *uxstacktop)
+{
+  8011a3:	55                   	push   %ebp
+  8011a4:	89 e5                	mov    %esp,%ebp
+  8011a6:	57                   	push   %edi
+  8011a7:	56                   	push   %esi
+  8011a8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b4:	b8 1d 00 00 00       	mov    $0x1d,%eax
+  8011b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011bc:	89 f7                	mov    %esi,%edi
+  8011be:	cd 30                	int    $0x30
+	return syscall(SYS_exofork_shared, 0, (uint32_t) eip, (uint32_t) esp,
+		       (uint32_t) uxstacktop, 0, 0);
+}
+  8011c0:	5b                   	pop    %ebx
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5f                   	pop    %edi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+
+008011c5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011cb:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011d0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011d3:	5d                   	pop    %ebp
+  8011d4:	c3                   	ret
+
+008011d5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011d5:	55                   	push   %ebp
+  8011d6:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8011d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011db:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8011e0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8011e5:	2d 00 00 e0 2f       	sub    $0x2fe00000,%eax
+}
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+
+008011ec <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((vpd[PDX(fd)] & PTE_P) == 0 || (vpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011f4:	89 c2                	mov    %eax,%edx
+  8011f6:	c1 ea 16             	shr    $0x16,%edx
+  8011f9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801200:	f6 c2 01             	test   $0x1,%dl
+  801203:	74 29                	je     80122e <fd_alloc+0x42>
+  801205:	89 c2                	mov    %eax,%edx
+  801207:	c1 ea 0c             	shr    $0xc,%edx
+  80120a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801211:	f6 c2 01             	test   $0x1,%dl
+  801214:	74 18                	je     80122e <fd_alloc+0x42>
+	for (i = 0; i < MAXFD; i++) {
+  801216:	05 00 10 00 00       	add    $0x1000,%eax
+  80121b:	3d 00 00 20 d0       	cmp    $0xd0200000,%eax
+  801220:	75 d2                	jne    8011f4 <fd_alloc+0x8>
+  801222:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801227:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80122c:	eb 05                	jmp    801233 <fd_alloc+0x47>
+			return 0;
+  80122e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801233:	8b 55 08             	mov    0x8(%ebp),%edx
+  801236:	89 02                	mov    %eax,(%edx)
+}
+  801238:	89 c8                	mov    %ecx,%eax
+  80123a:	5d                   	pop    %ebp
+  80123b:	c3                   	ret
+
+0080123c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80123c:	55                   	push   %ebp
+  80123d:	89 e5                	mov    %esp,%ebp
+  80123f:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801242:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+  801247:	77 30                	ja     801279 <fd_lookup+0x3d>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801249:	c1 e0 0c             	shl    $0xc,%eax
+  80124c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(vpd[PDX(fd)] & PTE_P) || !(vpt[PGNUM(fd)] & PTE_P)) {
+  801251:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801257:	f6 c2 01             	test   $0x1,%dl
+  80125a:	74 24                	je     801280 <fd_lookup+0x44>
+  80125c:	89 c2                	mov    %eax,%edx
+  80125e:	c1 ea 0c             	shr    $0xc,%edx
+  801261:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801268:	f6 c2 01             	test   $0x1,%dl
+  80126b:	74 1a                	je     801287 <fd_lookup+0x4b>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fd);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80126d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801270:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801272:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801277:	5d                   	pop    %ebp
+  801278:	c3                   	ret
+		return -E_INVAL;
+  801279:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80127e:	eb f7                	jmp    801277 <fd_lookup+0x3b>
+		return -E_INVAL;
+  801280:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801285:	eb f0                	jmp    801277 <fd_lookup+0x3b>
+  801287:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128c:	eb e9                	jmp    801277 <fd_lookup+0x3b>
+
+0080128e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80128e:	55                   	push   %ebp
+  80128f:	89 e5                	mov    %esp,%ebp
+  801291:	53                   	push   %ebx
+  801292:	83 ec 04             	sub    $0x4,%esp
+  801295:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129d:	bb 20 50 80 00       	mov    $0x805020,%ebx
+		if (devtab[i]->dev_id == dev_id) {
+  8012a2:	39 13                	cmp    %edx,(%ebx)
+  8012a4:	74 54                	je     8012fa <dev_lookup+0x6c>
+	for (i = 0; devtab[i]; i++)
+  8012a6:	83 c0 01             	add    $0x1,%eax
+  8012a9:	8b 1c 85 94 3f 80 00 	mov    0x803f94(,%eax,4),%ebx
+  8012b0:	85 db                	test   %ebx,%ebx
+  8012b2:	75 ee                	jne    8012a2 <dev_lookup+0x14>
+  8012b4:	89 e1                	mov    %esp,%ecx
+  8012b6:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8012bb:	29 c8                	sub    %ecx,%eax
+  8012bd:	89 c1                	mov    %eax,%ecx
+  8012bf:	c1 e9 0f             	shr    $0xf,%ecx
+  8012c2:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8012c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cc:	0f 42 c1             	cmovb  %ecx,%eax
+			*dev = devtab[i];
+			return 0;
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012cf:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8012d6:	8b 40 48             	mov    0x48(%eax),%eax
+  8012d9:	83 ec 04             	sub    $0x4,%esp
+  8012dc:	52                   	push   %edx
+  8012dd:	50                   	push   %eax
+  8012de:	68 18 3f 80 00       	push   $0x803f18
+  8012e3:	e8 4f ef ff ff       	call   800237 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8012f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f3:	89 1a                	mov    %ebx,(%edx)
+}
+  8012f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f8:	c9                   	leave
+  8012f9:	c3                   	ret
+			return 0;
+  8012fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ff:	eb ef                	jmp    8012f0 <dev_lookup+0x62>
+
+00801301 <fd_close>:
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  801304:	57                   	push   %edi
+  801305:	56                   	push   %esi
+  801306:	53                   	push   %ebx
+  801307:	83 ec 24             	sub    $0x24,%esp
+  80130a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80130d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801310:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801313:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801314:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80131a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80131d:	50                   	push   %eax
+  80131e:	e8 19 ff ff ff       	call   80123c <fd_lookup>
+  801323:	89 c3                	mov    %eax,%ebx
+  801325:	83 c4 10             	add    $0x10,%esp
+  801328:	85 c0                	test   %eax,%eax
+  80132a:	78 05                	js     801331 <fd_close+0x30>
+	    || fd != fd2)
+  80132c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80132f:	74 0f                	je     801340 <fd_close+0x3f>
+		return (must_exist ? r : 0);
+  801331:	85 ff                	test   %edi,%edi
+  801333:	0f 44 df             	cmove  %edi,%ebx
+}
+  801336:	89 d8                	mov    %ebx,%eax
+  801338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133b:	5b                   	pop    %ebx
+  80133c:	5e                   	pop    %esi
+  80133d:	5f                   	pop    %edi
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801340:	83 ec 08             	sub    $0x8,%esp
+  801343:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801346:	50                   	push   %eax
+  801347:	ff 36                	push   (%esi)
+  801349:	e8 40 ff ff ff       	call   80128e <dev_lookup>
+  80134e:	89 c3                	mov    %eax,%ebx
+  801350:	83 c4 10             	add    $0x10,%esp
+  801353:	85 c0                	test   %eax,%eax
+  801355:	78 1a                	js     801371 <fd_close+0x70>
+		if (dev->dev_close)
+  801357:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80135a:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  80135d:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801362:	85 c0                	test   %eax,%eax
+  801364:	74 0b                	je     801371 <fd_close+0x70>
+			r = (*dev->dev_close)(fd);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	56                   	push   %esi
+  80136a:	ff d0                	call   *%eax
+  80136c:	89 c3                	mov    %eax,%ebx
+  80136e:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801371:	83 ec 08             	sub    $0x8,%esp
+  801374:	56                   	push   %esi
+  801375:	6a 00                	push   $0x0
+  801377:	e8 6b fa ff ff       	call   800de7 <sys_page_unmap>
+	return r;
+  80137c:	83 c4 10             	add    $0x10,%esp
+  80137f:	eb b5                	jmp    801336 <fd_close+0x35>
+
+00801381 <close>:
+
+int
+close(int fdnum)
+{
+  801381:	55                   	push   %ebp
+  801382:	89 e5                	mov    %esp,%ebp
+  801384:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801387:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80138a:	50                   	push   %eax
+  80138b:	ff 75 08             	push   0x8(%ebp)
+  80138e:	e8 a9 fe ff ff       	call   80123c <fd_lookup>
+  801393:	83 c4 10             	add    $0x10,%esp
+  801396:	85 c0                	test   %eax,%eax
+  801398:	79 02                	jns    80139c <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80139a:	c9                   	leave
+  80139b:	c3                   	ret
+		return fd_close(fd, 1);
+  80139c:	83 ec 08             	sub    $0x8,%esp
+  80139f:	6a 01                	push   $0x1
+  8013a1:	ff 75 f4             	push   -0xc(%ebp)
+  8013a4:	e8 58 ff ff ff       	call   801301 <fd_close>
+  8013a9:	83 c4 10             	add    $0x10,%esp
+  8013ac:	eb ec                	jmp    80139a <close+0x19>
+
+008013ae <close_all>:
+
+void
+close_all(void)
+{
+  8013ae:	55                   	push   %ebp
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	53                   	push   %ebx
+  8013b2:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013ba:	83 ec 0c             	sub    $0xc,%esp
+  8013bd:	53                   	push   %ebx
+  8013be:	e8 be ff ff ff       	call   801381 <close>
+	for (i = 0; i < MAXFD; i++)
+  8013c3:	83 c3 01             	add    $0x1,%ebx
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	81 fb 00 02 00 00    	cmp    $0x200,%ebx
+  8013cf:	75 e9                	jne    8013ba <close_all+0xc>
+}
+  8013d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013d4:	c9                   	leave
+  8013d5:	c3                   	ret
+
+008013d6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	57                   	push   %edi
+  8013da:	56                   	push   %esi
+  8013db:	53                   	push   %ebx
+  8013dc:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013e2:	50                   	push   %eax
+  8013e3:	ff 75 08             	push   0x8(%ebp)
+  8013e6:	e8 51 fe ff ff       	call   80123c <fd_lookup>
+  8013eb:	89 c3                	mov    %eax,%ebx
+  8013ed:	83 c4 10             	add    $0x10,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	78 7f                	js     801473 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8013f4:	83 ec 0c             	sub    $0xc,%esp
+  8013f7:	ff 75 0c             	push   0xc(%ebp)
+  8013fa:	e8 82 ff ff ff       	call   801381 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8013ff:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801402:	c1 e6 0c             	shl    $0xc,%esi
+  801405:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80140b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80140e:	89 3c 24             	mov    %edi,(%esp)
+  801411:	e8 bf fd ff ff       	call   8011d5 <fd2data>
+  801416:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801418:	89 34 24             	mov    %esi,(%esp)
+  80141b:	e8 b5 fd ff ff       	call   8011d5 <fd2data>
+  801420:	83 c4 10             	add    $0x10,%esp
+  801423:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((vpd[PDX(ova)] & PTE_P) && (vpt[PGNUM(ova)] & PTE_P))
+  801426:	89 d8                	mov    %ebx,%eax
+  801428:	c1 e8 16             	shr    $0x16,%eax
+  80142b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801432:	a8 01                	test   $0x1,%al
+  801434:	74 11                	je     801447 <dup+0x71>
+  801436:	89 d8                	mov    %ebx,%eax
+  801438:	c1 e8 0c             	shr    $0xc,%eax
+  80143b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801442:	f6 c2 01             	test   $0x1,%dl
+  801445:	75 36                	jne    80147d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, vpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801447:	89 f8                	mov    %edi,%eax
+  801449:	c1 e8 0c             	shr    $0xc,%eax
+  80144c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  801456:	25 07 0e 00 00       	and    $0xe07,%eax
+  80145b:	50                   	push   %eax
+  80145c:	56                   	push   %esi
+  80145d:	6a 00                	push   $0x0
+  80145f:	57                   	push   %edi
+  801460:	6a 00                	push   $0x0
+  801462:	e8 3e f9 ff ff       	call   800da5 <sys_page_map>
+  801467:	89 c3                	mov    %eax,%ebx
+  801469:	83 c4 20             	add    $0x20,%esp
+  80146c:	85 c0                	test   %eax,%eax
+  80146e:	78 33                	js     8014a3 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801470:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801473:	89 d8                	mov    %ebx,%eax
+  801475:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, vpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80147d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	25 07 0e 00 00       	and    $0xe07,%eax
+  80148c:	50                   	push   %eax
+  80148d:	ff 75 d4             	push   -0x2c(%ebp)
+  801490:	6a 00                	push   $0x0
+  801492:	53                   	push   %ebx
+  801493:	6a 00                	push   $0x0
+  801495:	e8 0b f9 ff ff       	call   800da5 <sys_page_map>
+  80149a:	89 c3                	mov    %eax,%ebx
+  80149c:	83 c4 20             	add    $0x20,%esp
+  80149f:	85 c0                	test   %eax,%eax
+  8014a1:	79 a4                	jns    801447 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014a3:	83 ec 08             	sub    $0x8,%esp
+  8014a6:	56                   	push   %esi
+  8014a7:	6a 00                	push   $0x0
+  8014a9:	e8 39 f9 ff ff       	call   800de7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014ae:	83 c4 08             	add    $0x8,%esp
+  8014b1:	ff 75 d4             	push   -0x2c(%ebp)
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 2c f9 ff ff       	call   800de7 <sys_page_unmap>
+	return r;
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	eb b3                	jmp    801473 <dup+0x9d>
+
+008014c0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 18             	sub    $0x18,%esp
+  8014c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ce:	50                   	push   %eax
+  8014cf:	53                   	push   %ebx
+  8014d0:	e8 67 fd ff ff       	call   80123c <fd_lookup>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 3c                	js     801518 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014df:	83 ec 08             	sub    $0x8,%esp
+  8014e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e5:	50                   	push   %eax
+  8014e6:	ff 36                	push   (%esi)
+  8014e8:	e8 a1 fd ff ff       	call   80128e <dev_lookup>
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 24                	js     801518 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014f4:	8b 46 08             	mov    0x8(%esi),%eax
+  8014f7:	83 e0 03             	and    $0x3,%eax
+  8014fa:	83 f8 01             	cmp    $0x1,%eax
+  8014fd:	74 20                	je     80151f <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8014ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801502:	8b 40 08             	mov    0x8(%eax),%eax
+  801505:	85 c0                	test   %eax,%eax
+  801507:	74 54                	je     80155d <read+0x9d>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801509:	83 ec 04             	sub    $0x4,%esp
+  80150c:	ff 75 10             	push   0x10(%ebp)
+  80150f:	ff 75 0c             	push   0xc(%ebp)
+  801512:	56                   	push   %esi
+  801513:	ff d0                	call   *%eax
+  801515:	83 c4 10             	add    $0x10,%esp
+}
+  801518:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151b:	5b                   	pop    %ebx
+  80151c:	5e                   	pop    %esi
+  80151d:	5d                   	pop    %ebp
+  80151e:	c3                   	ret
+  80151f:	89 e2                	mov    %esp,%edx
+  801521:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801526:	29 d0                	sub    %edx,%eax
+  801528:	89 c2                	mov    %eax,%edx
+  80152a:	c1 ea 0f             	shr    $0xf,%edx
+  80152d:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801532:	b8 00 00 00 00       	mov    $0x0,%eax
+  801537:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80153a:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801541:	8b 40 48             	mov    0x48(%eax),%eax
+  801544:	83 ec 04             	sub    $0x4,%esp
+  801547:	53                   	push   %ebx
+  801548:	50                   	push   %eax
+  801549:	68 59 3f 80 00       	push   $0x803f59
+  80154e:	e8 e4 ec ff ff       	call   800237 <cprintf>
+		return -E_INVAL;
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155b:	eb bb                	jmp    801518 <read+0x58>
+		return -E_NOT_SUPP;
+  80155d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801562:	eb b4                	jmp    801518 <read+0x58>
+
+00801564 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	57                   	push   %edi
+  801568:	56                   	push   %esi
+  801569:	53                   	push   %ebx
+  80156a:	83 ec 0c             	sub    $0xc,%esp
+  80156d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801570:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801573:	85 f6                	test   %esi,%esi
+  801575:	74 30                	je     8015a7 <readn+0x43>
+  801577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157c:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801581:	83 ec 04             	sub    $0x4,%esp
+  801584:	89 f2                	mov    %esi,%edx
+  801586:	29 c2                	sub    %eax,%edx
+  801588:	52                   	push   %edx
+  801589:	01 f8                	add    %edi,%eax
+  80158b:	50                   	push   %eax
+  80158c:	ff 75 08             	push   0x8(%ebp)
+  80158f:	e8 2c ff ff ff       	call   8014c0 <read>
+		if (m < 0)
+  801594:	83 c4 10             	add    $0x10,%esp
+  801597:	85 c0                	test   %eax,%eax
+  801599:	78 15                	js     8015b0 <readn+0x4c>
+			return m;
+		if (m == 0)
+  80159b:	74 11                	je     8015ae <readn+0x4a>
+	for (tot = 0; tot < n; tot += m) {
+  80159d:	01 c3                	add    %eax,%ebx
+  80159f:	89 d8                	mov    %ebx,%eax
+  8015a1:	39 f3                	cmp    %esi,%ebx
+  8015a3:	72 dc                	jb     801581 <readn+0x1d>
+  8015a5:	eb 09                	jmp    8015b0 <readn+0x4c>
+  8015a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ac:	eb 02                	jmp    8015b0 <readn+0x4c>
+  8015ae:	89 d8                	mov    %ebx,%eax
+			break;
+	}
+	return tot;
+}
+  8015b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015b3:	5b                   	pop    %ebx
+  8015b4:	5e                   	pop    %esi
+  8015b5:	5f                   	pop    %edi
+  8015b6:	5d                   	pop    %ebp
+  8015b7:	c3                   	ret
+
+008015b8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015b8:	55                   	push   %ebp
+  8015b9:	89 e5                	mov    %esp,%ebp
+  8015bb:	56                   	push   %esi
+  8015bc:	53                   	push   %ebx
+  8015bd:	83 ec 18             	sub    $0x18,%esp
+  8015c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015c3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	53                   	push   %ebx
+  8015c8:	e8 6f fc ff ff       	call   80123c <fd_lookup>
+  8015cd:	83 c4 10             	add    $0x10,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 37                	js     80160b <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015d4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015d7:	83 ec 08             	sub    $0x8,%esp
+  8015da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015dd:	50                   	push   %eax
+  8015de:	ff 36                	push   (%esi)
+  8015e0:	e8 a9 fc ff ff       	call   80128e <dev_lookup>
+  8015e5:	83 c4 10             	add    $0x10,%esp
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	78 1f                	js     80160b <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015ec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015f0:	74 20                	je     801612 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	74 54                	je     801650 <write+0x98>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015fc:	83 ec 04             	sub    $0x4,%esp
+  8015ff:	ff 75 10             	push   0x10(%ebp)
+  801602:	ff 75 0c             	push   0xc(%ebp)
+  801605:	56                   	push   %esi
+  801606:	ff d0                	call   *%eax
+  801608:	83 c4 10             	add    $0x10,%esp
+}
+  80160b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+  801612:	89 e2                	mov    %esp,%edx
+  801614:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801619:	29 d0                	sub    %edx,%eax
+  80161b:	89 c2                	mov    %eax,%edx
+  80161d:	c1 ea 0f             	shr    $0xf,%edx
+  801620:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  801625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162a:	0f 42 c2             	cmovb  %edx,%eax
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80162d:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  801634:	8b 40 48             	mov    0x48(%eax),%eax
+  801637:	83 ec 04             	sub    $0x4,%esp
+  80163a:	53                   	push   %ebx
+  80163b:	50                   	push   %eax
+  80163c:	68 75 3f 80 00       	push   $0x803f75
+  801641:	e8 f1 eb ff ff       	call   800237 <cprintf>
+		return -E_INVAL;
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164e:	eb bb                	jmp    80160b <write+0x53>
+		return -E_NOT_SUPP;
+  801650:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801655:	eb b4                	jmp    80160b <write+0x53>
+
+00801657 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801660:	50                   	push   %eax
+  801661:	ff 75 08             	push   0x8(%ebp)
+  801664:	e8 d3 fb ff ff       	call   80123c <fd_lookup>
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 0e                	js     80167e <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801670:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801673:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801676:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80167e:	c9                   	leave
+  80167f:	c3                   	ret
+
+00801680 <fcntl>:
+
+// Get (F_GETFL) or set (F_SETFL) the open mode of 'fdnum'.  Only
+// O_NONBLOCK can be changed.
+int
+fcntl(int fdnum, int cmd, int arg)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	53                   	push   %ebx
+  801684:	83 ec 1c             	sub    $0x1c,%esp
+  801687:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80168a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168d:	50                   	push   %eax
+  80168e:	ff 75 08             	push   0x8(%ebp)
+  801691:	e8 a6 fb ff ff       	call   80123c <fd_lookup>
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	78 33                	js     8016d0 <fcntl+0x50>
+		return r;
+	switch (cmd) {
+  80169d:	83 fb 03             	cmp    $0x3,%ebx
+  8016a0:	74 28                	je     8016ca <fcntl+0x4a>
+  8016a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a7:	83 fb 04             	cmp    $0x4,%ebx
+  8016aa:	75 24                	jne    8016d0 <fcntl+0x50>
+	case F_GETFL:
+		return fd->fd_omode;
+	case F_SETFL:
+		fd->fd_omode = (fd->fd_omode & ~O_NONBLOCK) | (arg & O_NONBLOCK);
+  8016ac:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  8016af:	8b 41 08             	mov    0x8(%ecx),%eax
+  8016b2:	80 e4 ef             	and    $0xef,%ah
+  8016b5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8016b8:	81 e2 00 10 00 00    	and    $0x1000,%edx
+  8016be:	09 d0                	or     %edx,%eax
+  8016c0:	89 41 08             	mov    %eax,0x8(%ecx)
+		return 0;
+  8016c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c8:	eb 06                	jmp    8016d0 <fcntl+0x50>
+		return fd->fd_omode;
+  8016ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016cd:	8b 40 08             	mov    0x8(%eax),%eax
+	default:
+		return -E_INVAL;
+	}
+}
+  8016d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d3:	c9                   	leave
+  8016d4:	c3                   	ret
+
+008016d5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016d5:	55                   	push   %ebp
+  8016d6:	89 e5                	mov    %esp,%ebp
+  8016d8:	56                   	push   %esi
+  8016d9:	53                   	push   %ebx
+  8016da:	83 ec 18             	sub    $0x18,%esp
+  8016dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016e3:	50                   	push   %eax
+  8016e4:	53                   	push   %ebx
+  8016e5:	e8 52 fb ff ff       	call   80123c <fd_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 34                	js     801725 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016f4:	83 ec 08             	sub    $0x8,%esp
+  8016f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fa:	50                   	push   %eax
+  8016fb:	ff 36                	push   (%esi)
+  8016fd:	e8 8c fb ff ff       	call   80128e <dev_lookup>
+  801702:	83 c4 10             	add    $0x10,%esp
+  801705:	85 c0                	test   %eax,%eax
+  801707:	78 1c                	js     801725 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801709:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80170d:	74 1d                	je     80172c <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80170f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801712:	8b 40 18             	mov    0x18(%eax),%eax
+  801715:	85 c0                	test   %eax,%eax
+  801717:	74 51                	je     80176a <ftruncate+0x95>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801719:	83 ec 08             	sub    $0x8,%esp
+  80171c:	ff 75 0c             	push   0xc(%ebp)
+  80171f:	56                   	push   %esi
+  801720:	ff d0                	call   *%eax
+  801722:	83 c4 10             	add    $0x10,%esp
+}
+  801725:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801728:	5b                   	pop    %ebx
+  801729:	5e                   	pop    %esi
+  80172a:	5d                   	pop    %ebp
+  80172b:	c3                   	ret
+  80172c:	89 e2                	mov    %esp,%edx
+  80172e:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  801733:	29 d0                	sub    %edx,%eax
+  801735:	89 c2                	mov    %eax,%edx
+  801737:	c1 ea 0f             	shr    $0xf,%edx
+  80173a:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80173f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801744:	0f 42 c2             	cmovb  %edx,%eax
+			thisenv->env_id, fdnum);
+  801747:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80174e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801751:	83 ec 04             	sub    $0x4,%esp
+  801754:	53                   	push   %ebx
+  801755:	50                   	push   %eax
+  801756:	68 38 3f 80 00       	push   $0x803f38
+  80175b:	e8 d7 ea ff ff       	call   800237 <cprintf>
+		return -E_INVAL;
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801768:	eb bb                	jmp    801725 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80176a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176f:	eb b4                	jmp    801725 <ftruncate+0x50>
+
+00801771 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801771:	55                   	push   %ebp
+  801772:	89 e5                	mov    %esp,%ebp
+  801774:	56                   	push   %esi
+  801775:	53                   	push   %ebx
+  801776:	83 ec 18             	sub    $0x18,%esp
+  801779:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80177c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80177f:	50                   	push   %eax
+  801780:	ff 75 08             	push   0x8(%ebp)
+  801783:	e8 b4 fa ff ff       	call   80123c <fd_lookup>
+  801788:	83 c4 10             	add    $0x10,%esp
+  80178b:	85 c0                	test   %eax,%eax
+  80178d:	78 53                	js     8017e2 <fstat+0x71>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801792:	83 ec 08             	sub    $0x8,%esp
+  801795:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801798:	50                   	push   %eax
+  801799:	ff 36                	push   (%esi)
+  80179b:	e8 ee fa ff ff       	call   80128e <dev_lookup>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 3b                	js     8017e2 <fstat+0x71>
+		return r;
+	if (!dev->dev_stat)
+  8017a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017aa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ae:	74 39                	je     8017e9 <fstat+0x78>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8017b0:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8017b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017ba:	00 00 00 
+	stat->st_isdir = 0;
+  8017bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017c4:	00 00 00 
+	stat->st_version = 0;
+  8017c7:	c7 83 88 00 00 00 00 	movl   $0x0,0x88(%ebx)
+  8017ce:	00 00 00 
+	stat->st_dev = dev;
+  8017d1:	89 83 8c 00 00 00    	mov    %eax,0x8c(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8017d7:	83 ec 08             	sub    $0x8,%esp
+  8017da:	53                   	push   %ebx
+  8017db:	56                   	push   %esi
+  8017dc:	ff 50 14             	call   *0x14(%eax)
+  8017df:	83 c4 10             	add    $0x10,%esp
+}
+  8017e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e5:	5b                   	pop    %ebx
+  8017e6:	5e                   	pop    %esi
+  8017e7:	5d                   	pop    %ebp
+  8017e8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8017e9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ee:	eb f2                	jmp    8017e2 <fstat+0x71>
+
+008017f0 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	56                   	push   %esi
+  8017f4:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8017f5:	83 ec 08             	sub    $0x8,%esp
+  8017f8:	6a 00                	push   $0x0
+  8017fa:	ff 75 08             	push   0x8(%ebp)
+  8017fd:	e8 b7 01 00 00       	call   8019b9 <open>
+  801802:	89 c3                	mov    %eax,%ebx
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	85 c0                	test   %eax,%eax
+  801809:	78 1b                	js     801826 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80180b:	83 ec 08             	sub    $0x8,%esp
+  80180e:	ff 75 0c             	push   0xc(%ebp)
+  801811:	50                   	push   %eax
+  801812:	e8 5a ff ff ff       	call   801771 <fstat>
+  801817:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801819:	89 1c 24             	mov    %ebx,(%esp)
+  80181c:	e8 60 fb ff ff       	call   801381 <close>
+	return r;
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	89 f3                	mov    %esi,%ebx
+}
+  801826:	89 d8                	mov    %ebx,%eax
+  801828:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182b:	5b                   	pop    %ebx
+  80182c:	5e                   	pop    %esi
+  80182d:	5d                   	pop    %ebp
+  80182e:	c3                   	ret
+
+0080182f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	56                   	push   %esi
+  801833:	53                   	push   %ebx
+  801834:	89 c6                	mov    %eax,%esi
+  801836:	89 d3                	mov    %edx,%ebx
+	if (fsenv == 0)
+  801838:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  80183f:	74 27                	je     801868 <fsipc+0x39>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801841:	6a 07                	push   $0x7
+  801843:	68 00 70 80 00       	push   $0x807000
+  801848:	56                   	push   %esi
+  801849:	ff 35 00 60 80 00    	push   0x806000
+  80184f:	e8 1f 20 00 00       	call   803873 <ipc_send>
+	return ipc_recv(NULL, dstva, NULL);
+  801854:	83 c4 0c             	add    $0xc,%esp
+  801857:	6a 00                	push   $0x0
+  801859:	53                   	push   %ebx
+  80185a:	6a 00                	push   $0x0
+  80185c:	e8 82 1d 00 00       	call   8035e3 <ipc_recv>
+}
+  801861:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801864:	5b                   	pop    %ebx
+  801865:	5e                   	pop    %esi
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801868:	83 ec 0c             	sub    $0xc,%esp
+  80186b:	6a 02                	push   $0x2
+  80186d:	e8 6a 20 00 00       	call   8038dc <ipc_find_env>
+  801872:	a3 00 60 80 00       	mov    %eax,0x806000
+  801877:	83 c4 10             	add    $0x10,%esp
+  80187a:	eb c5                	jmp    801841 <fsipc+0x12>
+
+0080187c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801882:	8b 45 08             	mov    0x8(%ebp),%eax
+  801885:	8b 40 0c             	mov    0xc(%eax),%eax
+  801888:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  80188d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801890:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801895:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80189f:	e8 8b ff ff ff       	call   80182f <fsipc>
+}
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+008018a6 <devfile_flush>:
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018af:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b2:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8018b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bc:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018c1:	e8 69 ff ff ff       	call   80182f <fsipc>
+}
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+
+008018c8 <devfile_stat>:
+{
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	53                   	push   %ebx
+  8018cc:	83 ec 04             	sub    $0x4,%esp
+  8018cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018d8:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018e7:	e8 43 ff ff ff       	call   80182f <fsipc>
+  8018ec:	85 c0                	test   %eax,%eax
+  8018ee:	78 37                	js     801927 <devfile_stat+0x5f>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018f0:	83 ec 08             	sub    $0x8,%esp
+  8018f3:	68 00 70 80 00       	push   $0x807000
+  8018f8:	53                   	push   %ebx
+  8018f9:	e8 30 f0 ff ff       	call   80092e <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8018fe:	a1 80 70 80 00       	mov    0x807080,%eax
+  801903:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801909:	a1 84 70 80 00       	mov    0x807084,%eax
+  80190e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	st->st_version = fsipcbuf.statRet.ret_version;
+  801914:	a1 88 70 80 00       	mov    0x807088,%eax
+  801919:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return 0;
+  80191f:	83 c4 10             	add    $0x10,%esp
+  801922:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80192a:	c9                   	leave
+  80192b:	c3                   	ret
+
+0080192c <devfile_write>:
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	83 ec 0c             	sub    $0xc,%esp
+  801932:	8b 45 10             	mov    0x10(%ebp),%eax
+	count = (bufsize > n) ? n : bufsize; 
+  801935:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80193a:	39 d0                	cmp    %edx,%eax
+  80193c:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80193f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801942:	8b 52 0c             	mov    0xc(%edx),%edx
+  801945:	89 15 00 70 80 00    	mov    %edx,0x807000
+	fsipcbuf.write.req_n = count;
+  80194b:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, count);
+  801950:	50                   	push   %eax
+  801951:	ff 75 0c             	push   0xc(%ebp)
+  801954:	68 08 70 80 00       	push   $0x807008
+  801959:	e8 80 f1 ff ff       	call   800ade <memmove>
+	if((r = fsipc(FSREQ_WRITE, NULL)) < 0)
+  80195e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801963:	b8 04 00 00 00       	mov    $0x4,%eax
+  801968:	e8 c2 fe ff ff       	call   80182f <fsipc>
+}
+  80196d:	c9                   	leave
+  80196e:	c3                   	ret
+
+0080196f <devfile_read>:
+{
+  80196f:	55                   	push   %ebp
+  801970:	89 e5                	mov    %esp,%ebp
+  801972:	53                   	push   %ebx
+  801973:	83 ec 04             	sub    $0x4,%esp
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801976:	8b 45 08             	mov    0x8(%ebp),%eax
+  801979:	8b 40 0c             	mov    0xc(%eax),%eax
+  80197c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801981:	8b 45 10             	mov    0x10(%ebp),%eax
+  801984:	a3 04 70 80 00       	mov    %eax,0x807004
+	if((r = fsipc(FSREQ_READ, &fsipcbuf)) < 0)
+  801989:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80198e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801993:	e8 97 fe ff ff       	call   80182f <fsipc>
+  801998:	89 c3                	mov    %eax,%ebx
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	78 14                	js     8019b2 <devfile_read+0x43>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);				
+  80199e:	83 ec 04             	sub    $0x4,%esp
+  8019a1:	50                   	push   %eax
+  8019a2:	68 00 70 80 00       	push   $0x807000
+  8019a7:	ff 75 0c             	push   0xc(%ebp)
+  8019aa:	e8 2f f1 ff ff       	call   800ade <memmove>
+	return r;
+  8019af:	83 c4 10             	add    $0x10,%esp
+}
+  8019b2:	89 d8                	mov    %ebx,%eax
+  8019b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019b7:	c9                   	leave
+  8019b8:	c3                   	ret
+
+008019b9 <open>:
+{
+  8019b9:	55                   	push   %ebp
+  8019ba:	89 e5                	mov    %esp,%ebp
+  8019bc:	53                   	push   %ebx
+  8019bd:	83 ec 20             	sub    $0x20,%esp
+	if((r = fd_alloc(&fd)) < 0)
+  8019c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c3:	50                   	push   %eax
+  8019c4:	e8 23 f8 ff ff       	call   8011ec <fd_alloc>
+  8019c9:	89 c3                	mov    %eax,%ebx
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 2a                	js     8019fc <open+0x43>
+	if (strlen(path) > MAXPATHLEN) {
+  8019d2:	83 ec 0c             	sub    $0xc,%esp
+  8019d5:	ff 75 08             	push   0x8(%ebp)
+  8019d8:	e8 05 ef ff ff       	call   8008e2 <strlen>
+  8019dd:	83 c4 10             	add    $0x10,%esp
+		r = -E_BAD_PATH;
+  8019e0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+	if (strlen(path) > MAXPATHLEN) {
+  8019e5:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8019ea:	7e 17                	jle    801a03 <open+0x4a>
+	fd_close(fd, 1);
+  8019ec:	83 ec 08             	sub    $0x8,%esp
+  8019ef:	6a 01                	push   $0x1
+  8019f1:	ff 75 f4             	push   -0xc(%ebp)
+  8019f4:	e8 08 f9 ff ff       	call   801301 <fd_close>
+	return r;
+  8019f9:	83 c4 10             	add    $0x10,%esp
+}
+  8019fc:	89 d8                	mov    %ebx,%eax
+  8019fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a01:	c9                   	leave
+  801a02:	c3                   	ret
+	strcpy(fsipcbuf.open.req_path, path);
+  801a03:	83 ec 08             	sub    $0x8,%esp
+  801a06:	ff 75 08             	push   0x8(%ebp)
+  801a09:	68 00 70 80 00       	push   $0x807000
+  801a0e:	e8 1b ef ff ff       	call   80092e <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a16:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, (void*)fd)) < 0)
+  801a1b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a1e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a23:	e8 07 fe ff ff       	call   80182f <fsipc>
+  801a28:	89 c3                	mov    %eax,%ebx
+  801a2a:	83 c4 10             	add    $0x10,%esp
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 bb                	js     8019ec <open+0x33>
+	return fd2num(fd); 	
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	ff 75 f4             	push   -0xc(%ebp)
+  801a37:	e8 89 f7 ff ff       	call   8011c5 <fd2num>
+  801a3c:	89 c3                	mov    %eax,%ebx
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	eb b9                	jmp    8019fc <open+0x43>
+
+00801a43 <fmap>:
+//	The number of file bytes the pages hold, counted from the start
+//	of the first one; 0 at end of file.
+//	< 0 on error.
+int
+fmap(int fdnum, off_t offset, void *dstva, int maxpages)
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	53                   	push   %ebx
+  801a47:	83 ec 1c             	sub    $0x1c,%esp
+  801a4a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a4d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a50:	50                   	push   %eax
+  801a51:	ff 75 08             	push   0x8(%ebp)
+  801a54:	e8 e3 f7 ff ff       	call   80123c <fd_lookup>
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 5a                	js     801aba <fmap+0x77>
+		return r;
+	if (fd->fd_dev_id != devfile.dev_id)
+  801a60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a63:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801a69:	39 10                	cmp    %edx,(%eax)
+  801a6b:	75 66                	jne    801ad3 <fmap+0x90>
+		return -E_INVAL;
+	if (fsenv == 0)
+  801a6d:	83 3d 00 60 80 00 00 	cmpl   $0x0,0x806000
+  801a74:	74 49                	je     801abf <fmap+0x7c>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+	fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a79:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a7c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.map.req_offset = offset;
+  801a81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a84:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.map.req_npages = maxpages;
+  801a89:	89 1d 08 70 80 00    	mov    %ebx,0x807008
+	ipc_send(fsenv, FSREQ_MAP, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a8f:	6a 07                	push   $0x7
+  801a91:	68 00 70 80 00       	push   $0x807000
+  801a96:	6a 09                	push   $0x9
+  801a98:	ff 35 00 60 80 00    	push   0x806000
+  801a9e:	e8 d0 1d 00 00       	call   803873 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, maxpages, NULL, NULL);
+  801aa3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801aaa:	6a 00                	push   $0x0
+  801aac:	53                   	push   %ebx
+  801aad:	ff 75 10             	push   0x10(%ebp)
+  801ab0:	6a 00                	push   $0x0
+  801ab2:	e8 f9 1b 00 00       	call   8036b0 <ipc_recv_pages>
+  801ab7:	83 c4 20             	add    $0x20,%esp
+}
+  801aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801abd:	c9                   	leave
+  801abe:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+  801ac2:	6a 02                	push   $0x2
+  801ac4:	e8 13 1e 00 00       	call   8038dc <ipc_find_env>
+  801ac9:	a3 00 60 80 00       	mov    %eax,0x806000
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	eb a3                	jmp    801a76 <fmap+0x33>
+		return -E_INVAL;
+  801ad3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad8:	eb e0                	jmp    801aba <fmap+0x77>
+
+00801ada <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 10             	sub    $0x10,%esp
+  801ae1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801ae4:	53                   	push   %ebx
+  801ae5:	e8 f8 ed ff ff       	call   8008e2 <strlen>
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801af2:	7f 25                	jg     801b19 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801af4:	83 ec 08             	sub    $0x8,%esp
+  801af7:	53                   	push   %ebx
+  801af8:	68 00 70 80 00       	push   $0x807000
+  801afd:	e8 2c ee ff ff       	call   80092e <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b07:	b8 07 00 00 00       	mov    $0x7,%eax
+  801b0c:	e8 1e fd ff ff       	call   80182f <fsipc>
+  801b11:	83 c4 10             	add    $0x10,%esp
+}
+  801b14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b17:	c9                   	leave
+  801b18:	c3                   	ret
+		return -E_BAD_PATH;
+  801b19:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801b1e:	eb f4                	jmp    801b14 <remove+0x3a>
+
+00801b20 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801b20:	55                   	push   %ebp
+  801b21:	89 e5                	mov    %esp,%ebp
+  801b23:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801b26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b30:	e8 fa fc ff ff       	call   80182f <fsipc>
+}
+  801b35:	c9                   	leave
+  801b36:	c3                   	ret
+
+00801b37 <devsock_stat>:
+	return nsipc_evwait(evs, maxevents, timeout);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b37:	55                   	push   %ebp
+  801b38:	89 e5                	mov    %esp,%ebp
+  801b3a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  801b3d:	68 a8 3f 80 00       	push   $0x803fa8
+  801b42:	ff 75 0c             	push   0xc(%ebp)
+  801b45:	e8 e4 ed ff ff       	call   80092e <strcpy>
+	return 0;
+}
+  801b4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b4f:	c9                   	leave
+  801b50:	c3                   	ret
+
+00801b51 <devsock_close>:
+{
+  801b51:	55                   	push   %ebp
+  801b52:	89 e5                	mov    %esp,%ebp
+  801b54:	53                   	push   %ebx
+  801b55:	83 ec 10             	sub    $0x10,%esp
+  801b58:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  801b5b:	53                   	push   %ebx
+  801b5c:	e8 ba 1d 00 00       	call   80391b <pageref>
+  801b61:	89 c2                	mov    %eax,%edx
+  801b63:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801b66:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  801b6b:	83 fa 01             	cmp    $0x1,%edx
+  801b6e:	74 05                	je     801b75 <devsock_close+0x24>
+}
+  801b70:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  801b75:	83 ec 0c             	sub    $0xc,%esp
+  801b78:	ff 73 0c             	push   0xc(%ebx)
+  801b7b:	e8 b0 05 00 00       	call   802130 <nsipc_close>
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	eb eb                	jmp    801b70 <devsock_close+0x1f>
+
+00801b85 <devsock_write>:
+{
+  801b85:	55                   	push   %ebp
+  801b86:	89 e5                	mov    %esp,%ebp
+  801b88:	53                   	push   %ebx
+  801b89:	83 ec 14             	sub    $0x14,%esp
+  801b8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801b8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801b92:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { (void *) buf, n };
+  801b95:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801b98:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801b9b:	8b 41 08             	mov    0x8(%ecx),%eax
+  801b9e:	c1 f8 09             	sar    $0x9,%eax
+  801ba1:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801ba4:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801baa:	77 13                	ja     801bbf <devsock_write+0x3a>
+	return nsipc_send(fd->fd_sock.sockid, buf, n, flags);
+  801bac:	50                   	push   %eax
+  801bad:	52                   	push   %edx
+  801bae:	53                   	push   %ebx
+  801baf:	ff 71 0c             	push   0xc(%ecx)
+  801bb2:	e8 5c 06 00 00       	call   802213 <nsipc_send>
+  801bb7:	83 c4 10             	add    $0x10,%esp
+}
+  801bba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bbd:	c9                   	leave
+  801bbe:	c3                   	ret
+		return nsipc_sendmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801bbf:	50                   	push   %eax
+  801bc0:	6a 01                	push   $0x1
+  801bc2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bc5:	50                   	push   %eax
+  801bc6:	ff 71 0c             	push   0xc(%ecx)
+  801bc9:	e8 a6 06 00 00       	call   802274 <nsipc_sendmsg>
+  801bce:	83 c4 10             	add    $0x10,%esp
+  801bd1:	eb e7                	jmp    801bba <devsock_write+0x35>
+
+00801bd3 <devsock_read>:
+{
+  801bd3:	55                   	push   %ebp
+  801bd4:	89 e5                	mov    %esp,%ebp
+  801bd6:	53                   	push   %ebx
+  801bd7:	83 ec 14             	sub    $0x14,%esp
+  801bda:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801bdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  801be0:	8b 55 10             	mov    0x10(%ebp),%edx
+	struct iovec iov = { buf, n };
+  801be3:	89 5d f0             	mov    %ebx,-0x10(%ebp)
+  801be6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+	unsigned int flags = (fd->fd_omode & O_NONBLOCK) ? MSG_DONTWAIT : 0;
+  801be9:	8b 41 08             	mov    0x8(%ecx),%eax
+  801bec:	c1 f8 09             	sar    $0x9,%eax
+  801bef:	83 e0 08             	and    $0x8,%eax
+	if (n > SOCK_INLINE_MAX)
+  801bf2:	81 fa dc 05 00 00    	cmp    $0x5dc,%edx
+  801bf8:	77 13                	ja     801c0d <devsock_read+0x3a>
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, flags);
+  801bfa:	50                   	push   %eax
+  801bfb:	52                   	push   %edx
+  801bfc:	53                   	push   %ebx
+  801bfd:	ff 71 0c             	push   0xc(%ecx)
+  801c00:	e8 9c 05 00 00       	call   8021a1 <nsipc_recv>
+  801c05:	83 c4 10             	add    $0x10,%esp
+}
+  801c08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+		return nsipc_recvmsg(fd->fd_sock.sockid, &iov, 1, flags);
+  801c0d:	50                   	push   %eax
+  801c0e:	6a 01                	push   $0x1
+  801c10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c13:	50                   	push   %eax
+  801c14:	ff 71 0c             	push   0xc(%ecx)
+  801c17:	e8 02 0a 00 00       	call   80261e <nsipc_recvmsg>
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	eb e7                	jmp    801c08 <devsock_read+0x35>
+
+00801c21 <fd2sockid>:
+{
+  801c21:	55                   	push   %ebp
+  801c22:	89 e5                	mov    %esp,%ebp
+  801c24:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  801c27:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c2a:	52                   	push   %edx
+  801c2b:	50                   	push   %eax
+  801c2c:	e8 0b f6 ff ff       	call   80123c <fd_lookup>
+  801c31:	83 c4 10             	add    $0x10,%esp
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 10                	js     801c48 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  801c38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c3b:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  801c41:	39 08                	cmp    %ecx,(%eax)
+  801c43:	75 05                	jne    801c4a <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  801c45:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  801c48:	c9                   	leave
+  801c49:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c4a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c4f:	eb f7                	jmp    801c48 <fd2sockid+0x27>
+
+00801c51 <sock_flags>:
+{
+  801c51:	55                   	push   %ebp
+  801c52:	89 e5                	mov    %esp,%ebp
+  801c54:	83 ec 20             	sub    $0x20,%esp
+	if (fd_lookup(s, &sfd) < 0 || !(sfd->fd_omode & O_NONBLOCK))
+  801c57:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  801c5a:	52                   	push   %edx
+  801c5b:	50                   	push   %eax
+  801c5c:	e8 db f5 ff ff       	call   80123c <fd_lookup>
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	78 0e                	js     801c76 <sock_flags+0x25>
+  801c68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c6b:	8b 40 08             	mov    0x8(%eax),%eax
+  801c6e:	c1 e8 09             	shr    $0x9,%eax
+  801c71:	83 e0 08             	and    $0x8,%eax
+}
+  801c74:	c9                   	leave
+  801c75:	c3                   	ret
+		return 0;
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7b:	eb f7                	jmp    801c74 <sock_flags+0x23>
+
+00801c7d <alloc_sockfd>:
+{
+  801c7d:	55                   	push   %ebp
+  801c7e:	89 e5                	mov    %esp,%ebp
+  801c80:	56                   	push   %esi
+  801c81:	53                   	push   %ebx
+  801c82:	83 ec 1c             	sub    $0x1c,%esp
+  801c85:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  801c87:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c8a:	50                   	push   %eax
+  801c8b:	e8 5c f5 ff ff       	call   8011ec <fd_alloc>
+  801c90:	89 c3                	mov    %eax,%ebx
+  801c92:	83 c4 10             	add    $0x10,%esp
+  801c95:	85 c0                	test   %eax,%eax
+  801c97:	78 43                	js     801cdc <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	68 07 04 00 00       	push   $0x407
+  801ca1:	ff 75 f4             	push   -0xc(%ebp)
+  801ca4:	6a 00                	push   $0x0
+  801ca6:	e8 b7 f0 ff ff       	call   800d62 <sys_page_alloc>
+  801cab:	89 c3                	mov    %eax,%ebx
+  801cad:	83 c4 10             	add    $0x10,%esp
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	78 28                	js     801cdc <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  801cb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cb7:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  801cbd:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  801cbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cc2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  801cc9:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  801ccc:	83 ec 0c             	sub    $0xc,%esp
+  801ccf:	50                   	push   %eax
+  801cd0:	e8 f0 f4 ff ff       	call   8011c5 <fd2num>
+  801cd5:	89 c3                	mov    %eax,%ebx
+  801cd7:	83 c4 10             	add    $0x10,%esp
+  801cda:	eb 0c                	jmp    801ce8 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  801cdc:	83 ec 0c             	sub    $0xc,%esp
+  801cdf:	56                   	push   %esi
+  801ce0:	e8 4b 04 00 00       	call   802130 <nsipc_close>
+		return r;
+  801ce5:	83 c4 10             	add    $0x10,%esp
+}
+  801ce8:	89 d8                	mov    %ebx,%eax
+  801cea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ced:	5b                   	pop    %ebx
+  801cee:	5e                   	pop    %esi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+
+00801cf1 <accept>:
+{
+  801cf1:	55                   	push   %ebp
+  801cf2:	89 e5                	mov    %esp,%ebp
+  801cf4:	56                   	push   %esi
+  801cf5:	53                   	push   %ebx
+  801cf6:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801cf9:	89 f0                	mov    %esi,%eax
+  801cfb:	e8 21 ff ff ff       	call   801c21 <fd2sockid>
+  801d00:	89 c3                	mov    %eax,%ebx
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 24                	js     801d2a <accept+0x39>
+	if ((r = nsipc_accept(r, addr, addrlen, sock_flags(s))) < 0)
+  801d06:	89 f0                	mov    %esi,%eax
+  801d08:	e8 44 ff ff ff       	call   801c51 <sock_flags>
+  801d0d:	50                   	push   %eax
+  801d0e:	ff 75 10             	push   0x10(%ebp)
+  801d11:	ff 75 0c             	push   0xc(%ebp)
+  801d14:	53                   	push   %ebx
+  801d15:	e8 6b 03 00 00       	call   802085 <nsipc_accept>
+  801d1a:	89 c3                	mov    %eax,%ebx
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	78 07                	js     801d2a <accept+0x39>
+	return alloc_sockfd(r);
+  801d23:	e8 55 ff ff ff       	call   801c7d <alloc_sockfd>
+  801d28:	89 c3                	mov    %eax,%ebx
+}
+  801d2a:	89 d8                	mov    %ebx,%eax
+  801d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+
+00801d33 <bind>:
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d3c:	e8 e0 fe ff ff       	call   801c21 <fd2sockid>
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 12                	js     801d57 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  801d45:	83 ec 04             	sub    $0x4,%esp
+  801d48:	ff 75 10             	push   0x10(%ebp)
+  801d4b:	ff 75 0c             	push   0xc(%ebp)
+  801d4e:	50                   	push   %eax
+  801d4f:	e8 85 03 00 00       	call   8020d9 <nsipc_bind>
+  801d54:	83 c4 10             	add    $0x10,%esp
+}
+  801d57:	c9                   	leave
+  801d58:	c3                   	ret
+
+00801d59 <shutdown>:
+{
+  801d59:	55                   	push   %ebp
+  801d5a:	89 e5                	mov    %esp,%ebp
+  801d5c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d62:	e8 ba fe ff ff       	call   801c21 <fd2sockid>
+  801d67:	85 c0                	test   %eax,%eax
+  801d69:	78 0f                	js     801d7a <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  801d6b:	83 ec 08             	sub    $0x8,%esp
+  801d6e:	ff 75 0c             	push   0xc(%ebp)
+  801d71:	50                   	push   %eax
+  801d72:	e8 97 03 00 00       	call   80210e <nsipc_shutdown>
+  801d77:	83 c4 10             	add    $0x10,%esp
+}
+  801d7a:	c9                   	leave
+  801d7b:	c3                   	ret
+
+00801d7c <connect>:
+{
+  801d7c:	55                   	push   %ebp
+  801d7d:	89 e5                	mov    %esp,%ebp
+  801d7f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d85:	e8 97 fe ff ff       	call   801c21 <fd2sockid>
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 12                	js     801da0 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  801d8e:	83 ec 04             	sub    $0x4,%esp
+  801d91:	ff 75 10             	push   0x10(%ebp)
+  801d94:	ff 75 0c             	push   0xc(%ebp)
+  801d97:	50                   	push   %eax
+  801d98:	e8 ad 03 00 00       	call   80214a <nsipc_connect>
+  801d9d:	83 c4 10             	add    $0x10,%esp
+}
+  801da0:	c9                   	leave
+  801da1:	c3                   	ret
+
+00801da2 <listen>:
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  801da8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dab:	e8 71 fe ff ff       	call   801c21 <fd2sockid>
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 0f                	js     801dc3 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  801db4:	83 ec 08             	sub    $0x8,%esp
+  801db7:	ff 75 0c             	push   0xc(%ebp)
+  801dba:	50                   	push   %eax
+  801dbb:	e8 bf 03 00 00       	call   80217f <nsipc_listen>
+  801dc0:	83 c4 10             	add    $0x10,%esp
+}
+  801dc3:	c9                   	leave
+  801dc4:	c3                   	ret
+
+00801dc5 <sendmsg>:
+{
+  801dc5:	55                   	push   %ebp
+  801dc6:	89 e5                	mov    %esp,%ebp
+  801dc8:	57                   	push   %edi
+  801dc9:	56                   	push   %esi
+  801dca:	53                   	push   %ebx
+  801dcb:	83 ec 0c             	sub    $0xc,%esp
+  801dce:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dd1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd2sockid(s)) < 0)
+  801dd4:	89 f0                	mov    %esi,%eax
+  801dd6:	e8 46 fe ff ff       	call   801c21 <fd2sockid>
+  801ddb:	89 c3                	mov    %eax,%ebx
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	78 1c                	js     801dfd <sendmsg+0x38>
+			     flags | sock_flags(s));
+  801de1:	89 f0                	mov    %esi,%eax
+  801de3:	e8 69 fe ff ff       	call   801c51 <sock_flags>
+	return nsipc_sendmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801de8:	0b 45 10             	or     0x10(%ebp),%eax
+  801deb:	50                   	push   %eax
+  801dec:	ff 77 0c             	push   0xc(%edi)
+  801def:	ff 77 08             	push   0x8(%edi)
+  801df2:	53                   	push   %ebx
+  801df3:	e8 7c 04 00 00       	call   802274 <nsipc_sendmsg>
+  801df8:	89 c3                	mov    %eax,%ebx
+  801dfa:	83 c4 10             	add    $0x10,%esp
+}
+  801dfd:	89 d8                	mov    %ebx,%eax
+  801dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e02:	5b                   	pop    %ebx
+  801e03:	5e                   	pop    %esi
+  801e04:	5f                   	pop    %edi
+  801e05:	5d                   	pop    %ebp
+  801e06:	c3                   	ret
+
+00801e07 <recvmsg>:
+{
+  801e07:	55                   	push   %ebp
+  801e08:	89 e5                	mov    %esp,%ebp
+  801e0a:	57                   	push   %edi
+  801e0b:	56                   	push   %esi
+  801e0c:	53                   	push   %ebx
+  801e0d:	83 ec 0c             	sub    $0xc,%esp
+  801e10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e13:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e16:	89 f8                	mov    %edi,%eax
+  801e18:	e8 04 fe ff ff       	call   801c21 <fd2sockid>
+  801e1d:	89 c3                	mov    %eax,%ebx
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 2a                	js     801e4d <recvmsg+0x46>
+	msg->msg_namelen = 0;
+  801e23:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	msg->msg_flags = 0;
+  801e2a:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+			     flags | sock_flags(s));
+  801e31:	89 f8                	mov    %edi,%eax
+  801e33:	e8 19 fe ff ff       	call   801c51 <sock_flags>
+	return nsipc_recvmsg(r, msg->msg_iov, msg->msg_iovlen,
+  801e38:	0b 45 10             	or     0x10(%ebp),%eax
+  801e3b:	50                   	push   %eax
+  801e3c:	ff 76 0c             	push   0xc(%esi)
+  801e3f:	ff 76 08             	push   0x8(%esi)
+  801e42:	53                   	push   %ebx
+  801e43:	e8 d6 07 00 00       	call   80261e <nsipc_recvmsg>
+  801e48:	89 c3                	mov    %eax,%ebx
+  801e4a:	83 c4 10             	add    $0x10,%esp
+}
+  801e4d:	89 d8                	mov    %ebx,%eax
+  801e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e52:	5b                   	pop    %ebx
+  801e53:	5e                   	pop    %esi
+  801e54:	5f                   	pop    %edi
+  801e55:	5d                   	pop    %ebp
+  801e56:	c3                   	ret
+
+00801e57 <sendfile>:
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	56                   	push   %esi
+  801e5b:	53                   	push   %ebx
+  801e5c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if ((r = fd2sockid(s)) < 0)
+  801e5f:	89 f0                	mov    %esi,%eax
+  801e61:	e8 bb fd ff ff       	call   801c21 <fd2sockid>
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	85 c0                	test   %eax,%eax
+  801e6a:	78 1f                	js     801e8b <sendfile+0x34>
+	return nsipc_sendfile(r, fd, offset, len, sock_flags(s));
+  801e6c:	89 f0                	mov    %esi,%eax
+  801e6e:	e8 de fd ff ff       	call   801c51 <sock_flags>
+  801e73:	83 ec 0c             	sub    $0xc,%esp
+  801e76:	50                   	push   %eax
+  801e77:	ff 75 14             	push   0x14(%ebp)
+  801e7a:	ff 75 10             	push   0x10(%ebp)
+  801e7d:	ff 75 0c             	push   0xc(%ebp)
+  801e80:	53                   	push   %ebx
+  801e81:	e8 64 06 00 00       	call   8024ea <nsipc_sendfile>
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	83 c4 20             	add    $0x20,%esp
+}
+  801e8b:	89 d8                	mov    %ebx,%eax
+  801e8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e90:	5b                   	pop    %ebx
+  801e91:	5e                   	pop    %esi
+  801e92:	5d                   	pop    %ebp
+  801e93:	c3                   	ret
+
+00801e94 <evctl>:
+{
+  801e94:	55                   	push   %ebp
+  801e95:	89 e5                	mov    %esp,%ebp
+  801e97:	53                   	push   %ebx
+  801e98:	83 ec 04             	sub    $0x4,%esp
+  801e9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = fd2sockid(s)) < 0)
+  801e9e:	89 d8                	mov    %ebx,%eax
+  801ea0:	e8 7c fd ff ff       	call   801c21 <fd2sockid>
+  801ea5:	85 c0                	test   %eax,%eax
+  801ea7:	78 10                	js     801eb9 <evctl+0x25>
+	return nsipc_evctl(r, events, s);
+  801ea9:	83 ec 04             	sub    $0x4,%esp
+  801eac:	53                   	push   %ebx
+  801ead:	ff 75 0c             	push   0xc(%ebp)
+  801eb0:	50                   	push   %eax
+  801eb1:	e8 d2 0b 00 00       	call   802a88 <nsipc_evctl>
+  801eb6:	83 c4 10             	add    $0x10,%esp
+}
+  801eb9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+
+00801ebe <evwait>:
+{
+  801ebe:	55                   	push   %ebp
+  801ebf:	89 e5                	mov    %esp,%ebp
+  801ec1:	83 ec 0c             	sub    $0xc,%esp
+	return nsipc_evwait(evs, maxevents, timeout);
+  801ec4:	ff 75 10             	push   0x10(%ebp)
+  801ec7:	ff 75 0c             	push   0xc(%ebp)
+  801eca:	ff 75 08             	push   0x8(%ebp)
+  801ecd:	e8 e0 0b 00 00       	call   802ab2 <nsipc_evwait>
+}
+  801ed2:	c9                   	leave
+  801ed3:	c3                   	ret
+
+00801ed4 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  801ed4:	55                   	push   %ebp
+  801ed5:	89 e5                	mov    %esp,%ebp
+  801ed7:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  801eda:	ff 75 10             	push   0x10(%ebp)
+  801edd:	ff 75 0c             	push   0xc(%ebp)
+  801ee0:	ff 75 08             	push   0x8(%ebp)
+  801ee3:	e8 31 0c 00 00       	call   802b19 <nsipc_socket>
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	85 c0                	test   %eax,%eax
+  801eed:	78 05                	js     801ef4 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  801eef:	e8 89 fd ff ff       	call   801c7d <alloc_sockfd>
+}
+  801ef4:	c9                   	leave
+  801ef5:	c3                   	ret
+
+00801ef6 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  801ef6:	55                   	push   %ebp
+  801ef7:	89 e5                	mov    %esp,%ebp
+  801ef9:	53                   	push   %ebx
+  801efa:	83 ec 04             	sub    $0x4,%esp
+  801efd:	89 c3                	mov    %eax,%ebx
+	if (nsenv == 0)
+  801eff:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  801f06:	74 26                	je     801f2e <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  801f08:	6a 07                	push   $0x7
+  801f0a:	68 00 80 80 00       	push   $0x808000
+  801f0f:	53                   	push   %ebx
+  801f10:	ff 35 24 63 80 00    	push   0x806324
+  801f16:	e8 58 19 00 00       	call   803873 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  801f1b:	83 c4 0c             	add    $0xc,%esp
+  801f1e:	6a 00                	push   $0x0
+  801f20:	6a 00                	push   $0x0
+  801f22:	6a 00                	push   $0x0
+  801f24:	e8 ba 16 00 00       	call   8035e3 <ipc_recv>
+}
+  801f29:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f2c:	c9                   	leave
+  801f2d:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  801f2e:	83 ec 0c             	sub    $0xc,%esp
+  801f31:	6a 03                	push   $0x3
+  801f33:	e8 a4 19 00 00       	call   8038dc <ipc_find_env>
+  801f38:	a3 24 63 80 00       	mov    %eax,0x806324
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	eb c6                	jmp    801f08 <nsipc+0x12>
+
+00801f42 <nsbulk_map>:
+	return 0;
+}
+
+static int
+nsbulk_map(void)
+{
+  801f42:	55                   	push   %ebp
+  801f43:	89 e5                	mov    %esp,%ebp
+  801f45:	56                   	push   %esi
+  801f46:	53                   	push   %ebx
+	int i, r;
+
+	if (nsbulk_mapped)
+  801f47:	8b 35 30 63 80 00    	mov    0x806330,%esi
+		return 0;
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (nsbulk_mapped)
+  801f52:	85 f6                	test   %esi,%esi
+  801f54:	75 33                	jne    801f89 <nsbulk_map+0x47>
+  801f56:	bb 00 00 00 e0       	mov    $0xe0000000,%ebx
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+		if ((r = sys_page_alloc(0, (void *) (NSBULKVA + i * PGSIZE),
+  801f5b:	83 ec 04             	sub    $0x4,%esp
+  801f5e:	6a 07                	push   $0x7
+  801f60:	53                   	push   %ebx
+  801f61:	6a 00                	push   $0x0
+  801f63:	e8 fa ed ff ff       	call   800d62 <sys_page_alloc>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 1a                	js     801f89 <nsbulk_map+0x47>
+	for (i = 0; i < 1 + NSBULK_PAGES; i++)
+  801f6f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f75:	81 fb 00 10 01 e0    	cmp    $0xe0011000,%ebx
+  801f7b:	75 de                	jne    801f5b <nsbulk_map+0x19>
+					PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+	nsbulk_mapped = 1;
+  801f7d:	c7 05 30 63 80 00 01 	movl   $0x1,0x806330
+  801f84:	00 00 00 
+	return 0;
+  801f87:	89 f0                	mov    %esi,%eax
+}
+  801f89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f8c:	5b                   	pop    %ebx
+  801f8d:	5e                   	pop    %esi
+  801f8e:	5d                   	pop    %ebp
+  801f8f:	c3                   	ret
+
+00801f90 <nsbulk_own>:
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	57                   	push   %edi
+  801f94:	56                   	push   %esi
+  801f95:	53                   	push   %ebx
+  801f96:	83 ec 0c             	sub    $0xc,%esp
+  801f99:	89 c3                	mov    %eax,%ebx
+	for (i = first; i < first + npages; i++)
+  801f9b:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801f9e:	85 d2                	test   %edx,%edx
+  801fa0:	7f 0e                	jg     801fb0 <nsbulk_own+0x20>
+	return 0;
+  801fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa7:	eb 47                	jmp    801ff0 <nsbulk_own+0x60>
+	for (i = first; i < first + npages; i++)
+  801fa9:	83 c3 01             	add    $0x1,%ebx
+  801fac:	39 fb                	cmp    %edi,%ebx
+  801fae:	7d 3b                	jge    801feb <nsbulk_own+0x5b>
+		if (nsbulk_lent & (1 << i)) {
+  801fb0:	be 01 00 00 00       	mov    $0x1,%esi
+  801fb5:	89 d9                	mov    %ebx,%ecx
+  801fb7:	d3 e6                	shl    %cl,%esi
+  801fb9:	89 f0                	mov    %esi,%eax
+  801fbb:	23 05 2c 63 80 00    	and    0x80632c,%eax
+  801fc1:	74 e6                	je     801fa9 <nsbulk_own+0x19>
+			if ((r = sys_page_alloc(0, nsbulkdata + i * PGSIZE,
+  801fc3:	83 ec 04             	sub    $0x4,%esp
+  801fc6:	6a 07                	push   $0x7
+  801fc8:	89 d8                	mov    %ebx,%eax
+  801fca:	c1 e0 0c             	shl    $0xc,%eax
+  801fcd:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  801fd2:	50                   	push   %eax
+  801fd3:	6a 00                	push   $0x0
+  801fd5:	e8 88 ed ff ff       	call   800d62 <sys_page_alloc>
+  801fda:	83 c4 10             	add    $0x10,%esp
+  801fdd:	85 c0                	test   %eax,%eax
+  801fdf:	78 0f                	js     801ff0 <nsbulk_own+0x60>
+			nsbulk_lent &= ~(1 << i);
+  801fe1:	f7 d6                	not    %esi
+  801fe3:	21 35 2c 63 80 00    	and    %esi,0x80632c
+  801fe9:	eb be                	jmp    801fa9 <nsbulk_own+0x19>
+	return 0;
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5f                   	pop    %edi
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+
+00801ff8 <nsipc_bulk>:
+{
+  801ff8:	55                   	push   %ebp
+  801ff9:	89 e5                	mov    %esp,%ebp
+  801ffb:	57                   	push   %edi
+  801ffc:	56                   	push   %esi
+  801ffd:	53                   	push   %ebx
+  801ffe:	83 ec 1c             	sub    $0x1c,%esp
+  802001:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802004:	89 ce                	mov    %ecx,%esi
+	int i, npages = 1 + ROUNDUP(len, PGSIZE) / PGSIZE;
+  802006:	8d 9a ff 0f 00 00    	lea    0xfff(%edx),%ebx
+  80200c:	c1 fb 0c             	sar    $0xc,%ebx
+  80200f:	8d 7b 01             	lea    0x1(%ebx),%edi
+	if (nsenv == 0)
+  802012:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802019:	74 56                	je     802071 <nsipc_bulk+0x79>
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80201b:	85 ff                	test   %edi,%edi
+  80201d:	7e 24                	jle    802043 <nsipc_bulk+0x4b>
+  80201f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  802025:	74 1c                	je     802043 <nsipc_bulk+0x4b>
+  802027:	81 c3 01 00 0e 00    	add    $0xe0001,%ebx
+  80202d:	c1 e3 0c             	shl    $0xc,%ebx
+  802030:	b8 00 00 00 e0       	mov    $0xe0000000,%eax
+		*(volatile char *) (NSBULKVA + i * PGSIZE) |= 0;
+  802035:	0f b6 10             	movzbl (%eax),%edx
+  802038:	88 10                	mov    %dl,(%eax)
+	for (i = 0; i < npages && (perm & PTE_W); i++)
+  80203a:	05 00 10 00 00       	add    $0x1000,%eax
+  80203f:	39 d8                	cmp    %ebx,%eax
+  802041:	75 f2                	jne    802035 <nsipc_bulk+0x3d>
+	ipc_send_pages(nsenv, type, nsbulkreq, npages, perm);
+  802043:	83 ec 0c             	sub    $0xc,%esp
+  802046:	56                   	push   %esi
+  802047:	57                   	push   %edi
+  802048:	68 00 00 00 e0       	push   $0xe0000000
+  80204d:	ff 75 e4             	push   -0x1c(%ebp)
+  802050:	ff 35 24 63 80 00    	push   0x806324
+  802056:	e8 4c 18 00 00       	call   8038a7 <ipc_send_pages>
+	return ipc_recv(NULL, NULL, NULL);
+  80205b:	83 c4 1c             	add    $0x1c,%esp
+  80205e:	6a 00                	push   $0x0
+  802060:	6a 00                	push   $0x0
+  802062:	6a 00                	push   $0x0
+  802064:	e8 7a 15 00 00       	call   8035e3 <ipc_recv>
+}
+  802069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206c:	5b                   	pop    %ebx
+  80206d:	5e                   	pop    %esi
+  80206e:	5f                   	pop    %edi
+  80206f:	5d                   	pop    %ebp
+  802070:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802071:	83 ec 0c             	sub    $0xc,%esp
+  802074:	6a 03                	push   $0x3
+  802076:	e8 61 18 00 00       	call   8038dc <ipc_find_env>
+  80207b:	a3 24 63 80 00       	mov    %eax,0x806324
+  802080:	83 c4 10             	add    $0x10,%esp
+  802083:	eb 96                	jmp    80201b <nsipc_bulk+0x23>
+
+00802085 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen,
+	     unsigned int flags)
+{
+  802085:	55                   	push   %ebp
+  802086:	89 e5                	mov    %esp,%ebp
+  802088:	53                   	push   %ebx
+  802089:	83 ec 04             	sub    $0x4,%esp
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  80208c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208f:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_flags = flags;
+  802094:	8b 45 14             	mov    0x14(%ebp),%eax
+  802097:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  80209c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020a1:	e8 50 fe ff ff       	call   801ef6 <nsipc>
+  8020a6:	89 c3                	mov    %eax,%ebx
+  8020a8:	85 c0                	test   %eax,%eax
+  8020aa:	79 07                	jns    8020b3 <nsipc_accept+0x2e>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8020ac:	89 d8                	mov    %ebx,%eax
+  8020ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b1:	c9                   	leave
+  8020b2:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8020b3:	83 ec 04             	sub    $0x4,%esp
+  8020b6:	ff 35 10 80 80 00    	push   0x808010
+  8020bc:	68 00 80 80 00       	push   $0x808000
+  8020c1:	ff 75 0c             	push   0xc(%ebp)
+  8020c4:	e8 15 ea ff ff       	call   800ade <memmove>
+		*addrlen = ret->ret_addrlen;
+  8020c9:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8020cf:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020d2:	89 10                	mov    %edx,(%eax)
+  8020d4:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8020d7:	eb d3                	jmp    8020ac <nsipc_accept+0x27>
+
+008020d9 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8020d9:	55                   	push   %ebp
+  8020da:	89 e5                	mov    %esp,%ebp
+  8020dc:	53                   	push   %ebx
+  8020dd:	83 ec 08             	sub    $0x8,%esp
+  8020e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8020e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020e6:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8020eb:	53                   	push   %ebx
+  8020ec:	ff 75 0c             	push   0xc(%ebp)
+  8020ef:	68 04 80 80 00       	push   $0x808004
+  8020f4:	e8 e5 e9 ff ff       	call   800ade <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8020f9:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8020ff:	b8 02 00 00 00       	mov    $0x2,%eax
+  802104:	e8 ed fd ff ff       	call   801ef6 <nsipc>
+}
+  802109:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+
+0080210e <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80210e:	55                   	push   %ebp
+  80210f:	89 e5                	mov    %esp,%ebp
+  802111:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802114:	8b 45 08             	mov    0x8(%ebp),%eax
+  802117:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80211c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80211f:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802124:	b8 03 00 00 00       	mov    $0x3,%eax
+  802129:	e8 c8 fd ff ff       	call   801ef6 <nsipc>
+}
+  80212e:	c9                   	leave
+  80212f:	c3                   	ret
+
+00802130 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802136:	8b 45 08             	mov    0x8(%ebp),%eax
+  802139:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  80213e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802143:	e8 ae fd ff ff       	call   801ef6 <nsipc>
+}
+  802148:	c9                   	leave
+  802149:	c3                   	ret
+
+0080214a <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80214a:	55                   	push   %ebp
+  80214b:	89 e5                	mov    %esp,%ebp
+  80214d:	53                   	push   %ebx
+  80214e:	83 ec 08             	sub    $0x8,%esp
+  802151:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802154:	8b 45 08             	mov    0x8(%ebp),%eax
+  802157:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80215c:	53                   	push   %ebx
+  80215d:	ff 75 0c             	push   0xc(%ebp)
+  802160:	68 04 80 80 00       	push   $0x808004
+  802165:	e8 74 e9 ff ff       	call   800ade <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80216a:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802170:	b8 05 00 00 00       	mov    $0x5,%eax
+  802175:	e8 7c fd ff ff       	call   801ef6 <nsipc>
+}
+  80217a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80217d:	c9                   	leave
+  80217e:	c3                   	ret
+
+0080217f <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802185:	8b 45 08             	mov    0x8(%ebp),%eax
+  802188:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80218d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802190:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802195:	b8 06 00 00 00       	mov    $0x6,%eax
+  80219a:	e8 57 fd ff ff       	call   801ef6 <nsipc>
+}
+  80219f:	c9                   	leave
+  8021a0:	c3                   	ret
+
+008021a1 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8021a1:	55                   	push   %ebp
+  8021a2:	89 e5                	mov    %esp,%ebp
+  8021a4:	56                   	push   %esi
+  8021a5:	53                   	push   %ebx
+  8021a6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8021a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ac:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8021b1:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8021b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8021ba:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8021bf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021c4:	e8 2d fd ff ff       	call   801ef6 <nsipc>
+  8021c9:	89 c3                	mov    %eax,%ebx
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	78 22                	js     8021f1 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8021cf:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8021d4:	39 c6                	cmp    %eax,%esi
+  8021d6:	0f 4e c6             	cmovle %esi,%eax
+  8021d9:	39 c3                	cmp    %eax,%ebx
+  8021db:	7f 1d                	jg     8021fa <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8021dd:	83 ec 04             	sub    $0x4,%esp
+  8021e0:	53                   	push   %ebx
+  8021e1:	68 00 80 80 00       	push   $0x808000
+  8021e6:	ff 75 0c             	push   0xc(%ebp)
+  8021e9:	e8 f0 e8 ff ff       	call   800ade <memmove>
+  8021ee:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8021f1:	89 d8                	mov    %ebx,%eax
+  8021f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f6:	5b                   	pop    %ebx
+  8021f7:	5e                   	pop    %esi
+  8021f8:	5d                   	pop    %ebp
+  8021f9:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8021fa:	68 b4 3f 80 00       	push   $0x803fb4
+  8021ff:	68 c9 3f 80 00       	push   $0x803fc9
+  802204:	68 b2 00 00 00       	push   $0xb2
+  802209:	68 de 3f 80 00       	push   $0x803fde
+  80220e:	e8 8a 13 00 00       	call   80359d <_panic>
+
+00802213 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	53                   	push   %ebx
+  802217:	83 ec 04             	sub    $0x4,%esp
+  80221a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  80221d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802220:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802225:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80222b:	7f 2e                	jg     80225b <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  80222d:	83 ec 04             	sub    $0x4,%esp
+  802230:	53                   	push   %ebx
+  802231:	ff 75 0c             	push   0xc(%ebp)
+  802234:	68 0c 80 80 00       	push   $0x80800c
+  802239:	e8 a0 e8 ff ff       	call   800ade <memmove>
+	nsipcbuf.send.req_size = size;
+  80223e:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802244:	8b 45 14             	mov    0x14(%ebp),%eax
+  802247:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  80224c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802251:	e8 a0 fc ff ff       	call   801ef6 <nsipc>
+}
+  802256:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802259:	c9                   	leave
+  80225a:	c3                   	ret
+	assert(size < 1600);
+  80225b:	68 ea 3f 80 00       	push   $0x803fea
+  802260:	68 c9 3f 80 00       	push   $0x803fc9
+  802265:	68 bd 00 00 00       	push   $0xbd
+  80226a:	68 de 3f 80 00       	push   $0x803fde
+  80226f:	e8 29 13 00 00       	call   80359d <_panic>
+
+00802274 <nsipc_sendmsg>:
+// the staging area's: whole ones are mapped there read-only, in one
+// sys_page_batch, and only the bytes around them are copied.
+// Returns the number of bytes sent, or < 0 if the first request failed.
+int
+nsipc_sendmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	57                   	push   %edi
+  802278:	56                   	push   %esi
+  802279:	53                   	push   %ebx
+  80227a:	83 ec 2c             	sub    $0x2c,%esp
+	static struct PageBatch pb;
+	int r, i, k, n, skip, sent = 0;
+	size_t off = 0, m;
+	char *src;
+
+	if ((r = nsbulk_map()) < 0)
+  80227d:	e8 c0 fc ff ff       	call   801f42 <nsbulk_map>
+  802282:	85 c0                	test   %eax,%eax
+  802284:	78 55                	js     8022db <nsipc_sendmsg+0x67>
+	size_t off = 0, m;
+  802286:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	int r, i, k, n, skip, sent = 0;
+  80228d:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+		return r;
+	i = 0;
+  802294:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+	do {
+		// Gather as much as fits in the staging area.
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  80229b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80229e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8022a1:	0f 8d 24 02 00 00    	jge    8024cb <nsipc_sendmsg+0x257>
+  8022a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022aa:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8022ad:	03 1c c1             	add    (%ecx,%eax,8),%ebx
+  8022b0:	89 d8                	mov    %ebx,%eax
+  8022b2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022b7:	89 c6                	mov    %eax,%esi
+		pgbatch_init(&pb);
+  8022b9:	83 ec 0c             	sub    $0xc,%esp
+  8022bc:	68 20 60 80 00       	push   $0x806020
+  8022c1:	e8 5a 0f 00 00       	call   803220 <pgbatch_init>
+  8022c6:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8022c9:	89 f7                	mov    %esi,%edi
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+			src = (char *) iov[i].iov_base + off;
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  8022cb:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  8022ce:	e9 82 00 00 00       	jmp    802355 <nsipc_sendmsg+0xe1>
+				for (k = 0; k < m / PGSIZE; k++) {
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+							     nsbulkdata + n + k * PGSIZE,
+							     PTE_P|PTE_U)) < 0)
+						return sent ? sent : r;
+  8022d3:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8022d6:	85 db                	test   %ebx,%ebx
+  8022d8:	0f 45 c3             	cmovne %ebx,%eax
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+			return sent ? sent : r;
+		sent += r;
+	} while (i < iovcnt && r == n - skip);
+	return sent;
+}
+  8022db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022de:	5b                   	pop    %ebx
+  8022df:	5e                   	pop    %esi
+  8022e0:	5f                   	pop    %edi
+  8022e1:	5d                   	pop    %ebp
+  8022e2:	c3                   	ret
+				m = MIN(m, (size_t) (PGSIZE - PGOFF(n)));
+  8022e3:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8022e8:	29 c8                	sub    %ecx,%eax
+  8022ea:	39 d0                	cmp    %edx,%eax
+  8022ec:	0f 46 d0             	cmovbe %eax,%edx
+  8022ef:	89 d6                	mov    %edx,%esi
+				if ((r = nsbulk_own(n / PGSIZE, 1)) < 0)
+  8022f1:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8022f7:	85 ff                	test   %edi,%edi
+  8022f9:	0f 49 c7             	cmovns %edi,%eax
+  8022fc:	c1 f8 0c             	sar    $0xc,%eax
+  8022ff:	ba 01 00 00 00       	mov    $0x1,%edx
+  802304:	e8 87 fc ff ff       	call   801f90 <nsbulk_own>
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	0f 88 17 01 00 00    	js     802428 <nsipc_sendmsg+0x1b4>
+				memmove(nsbulkdata + n, src, m);
+  802311:	83 ec 04             	sub    $0x4,%esp
+  802314:	56                   	push   %esi
+  802315:	ff 75 e0             	push   -0x20(%ebp)
+  802318:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80231b:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  802320:	50                   	push   %eax
+  802321:	e8 b8 e7 ff ff       	call   800ade <memmove>
+  802326:	83 c4 10             	add    $0x10,%esp
+			if ((off += m) == iov[i].iov_len)
+  802329:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80232c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80232f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802332:	0f 84 fd 00 00 00    	je     802435 <nsipc_sendmsg+0x1c1>
+		for (n = skip; i < iovcnt && n < NSBULK_SIZE; n += m) {
+  802338:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80233b:	01 f7                	add    %esi,%edi
+  80233d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802340:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802343:	0f 8d 01 01 00 00    	jge    80244a <nsipc_sendmsg+0x1d6>
+  802349:	81 ff ff ff 00 00    	cmp    $0xffff,%edi
+  80234f:	0f 8f f0 00 00 00    	jg     802445 <nsipc_sendmsg+0x1d1>
+			src = (char *) iov[i].iov_base + off;
+  802355:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802358:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  80235b:	8d 1c d8             	lea    (%eax,%ebx,8),%ebx
+  80235e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802361:	89 c2                	mov    %eax,%edx
+  802363:	03 13                	add    (%ebx),%edx
+  802365:	89 55 e0             	mov    %edx,-0x20(%ebp)
+			m = MIN(iov[i].iov_len - off, (size_t) (NSBULK_SIZE - n));
+  802368:	8b 73 04             	mov    0x4(%ebx),%esi
+  80236b:	29 c6                	sub    %eax,%esi
+  80236d:	b9 00 00 01 00       	mov    $0x10000,%ecx
+  802372:	29 f9                	sub    %edi,%ecx
+  802374:	39 ce                	cmp    %ecx,%esi
+  802376:	89 ca                	mov    %ecx,%edx
+  802378:	0f 46 d6             	cmovbe %esi,%edx
+			if (PGOFF(n) == 0 && PGOFF(src) == 0 && m >= PGSIZE) {
+  80237b:	89 7d dc             	mov    %edi,-0x24(%ebp)
+  80237e:	89 f9                	mov    %edi,%ecx
+  802380:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  802386:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802389:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80238e:	09 c8                	or     %ecx,%eax
+  802390:	0f 85 4d ff ff ff    	jne    8022e3 <nsipc_sendmsg+0x6f>
+  802396:	81 fa ff 0f 00 00    	cmp    $0xfff,%edx
+  80239c:	0f 86 41 ff ff ff    	jbe    8022e3 <nsipc_sendmsg+0x6f>
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023a2:	8d 87 ff 0f 00 00    	lea    0xfff(%edi),%eax
+  8023a8:	85 ff                	test   %edi,%edi
+  8023aa:	0f 49 c7             	cmovns %edi,%eax
+  8023ad:	c1 f8 0c             	sar    $0xc,%eax
+  8023b0:	89 c7                	mov    %eax,%edi
+				for (k = 0; k < m / PGSIZE; k++) {
+  8023b2:	89 d1                	mov    %edx,%ecx
+  8023b4:	c1 e9 0c             	shr    $0xc,%ecx
+  8023b7:	01 c8                	add    %ecx,%eax
+  8023b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023bc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8023bf:	89 ce                	mov    %ecx,%esi
+							     nsbulkdata + n + k * PGSIZE,
+  8023c1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023c4:	2d 00 f0 ff 1f       	sub    $0x1ffff000,%eax
+  8023c9:	29 c8                	sub    %ecx,%eax
+  8023cb:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8023ce:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  8023d1:	89 c3                	mov    %eax,%ebx
+					nsbulk_lent |= 1 << (n / PGSIZE + k);
+  8023d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d8:	89 f9                	mov    %edi,%ecx
+  8023da:	d3 e0                	shl    %cl,%eax
+  8023dc:	09 05 2c 63 80 00    	or     %eax,0x80632c
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8023e2:	83 ec 08             	sub    $0x8,%esp
+  8023e5:	6a 05                	push   $0x5
+							     nsbulkdata + n + k * PGSIZE,
+  8023e7:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+					if ((r = pgbatch_map(&pb, 0, src + k * PGSIZE, 0,
+  8023ea:	50                   	push   %eax
+  8023eb:	6a 00                	push   $0x0
+  8023ed:	56                   	push   %esi
+  8023ee:	6a 00                	push   $0x0
+  8023f0:	68 20 60 80 00       	push   $0x806020
+  8023f5:	e8 e4 0e 00 00       	call   8032de <pgbatch_map>
+  8023fa:	83 c4 20             	add    $0x20,%esp
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	0f 88 ce fe ff ff    	js     8022d3 <nsipc_sendmsg+0x5f>
+				for (k = 0; k < m / PGSIZE; k++) {
+  802405:	83 c7 01             	add    $0x1,%edi
+  802408:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80240e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802411:	39 c7                	cmp    %eax,%edi
+  802413:	75 be                	jne    8023d3 <nsipc_sendmsg+0x15f>
+				m = ROUNDDOWN(m, PGSIZE);
+  802415:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802418:	8b 55 c8             	mov    -0x38(%ebp),%edx
+  80241b:	89 d6                	mov    %edx,%esi
+  80241d:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  802423:	e9 01 ff ff ff       	jmp    802329 <nsipc_sendmsg+0xb5>
+					return sent ? sent : r;
+  802428:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80242b:	85 db                	test   %ebx,%ebx
+  80242d:	0f 45 c3             	cmovne %ebx,%eax
+  802430:	e9 a6 fe ff ff       	jmp    8022db <nsipc_sendmsg+0x67>
+				i++, off = 0;
+  802435:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  802439:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802440:	e9 f3 fe ff ff       	jmp    802338 <nsipc_sendmsg+0xc4>
+  802445:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  802448:	eb 03                	jmp    80244d <nsipc_sendmsg+0x1d9>
+  80244a:	8b 75 cc             	mov    -0x34(%ebp),%esi
+		if ((r = pgbatch_flush(&pb)) < 0)
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	68 20 60 80 00       	push   $0x806020
+  802455:	e8 d4 0d 00 00       	call   80322e <pgbatch_flush>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 50                	js     8024b1 <nsipc_sendmsg+0x23d>
+		nsbulkreq->sendmsg.req_s = s;
+  802461:	8b 45 08             	mov    0x8(%ebp),%eax
+  802464:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+		nsbulkreq->sendmsg.req_off = skip;
+  802469:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+		nsbulkreq->sendmsg.req_size = n - skip;
+  80246f:	89 fb                	mov    %edi,%ebx
+  802471:	29 f3                	sub    %esi,%ebx
+  802473:	89 1d 08 00 00 e0    	mov    %ebx,0xe0000008
+		nsbulkreq->sendmsg.req_flags = flags;
+  802479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80247c:	a3 0c 00 00 e0       	mov    %eax,0xe000000c
+		if ((r = nsipc_bulk(NSREQ_SENDMSG, n, PTE_P|PTE_U)) < 0)
+  802481:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802486:	89 fa                	mov    %edi,%edx
+  802488:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80248d:	e8 66 fb ff ff       	call   801ff8 <nsipc_bulk>
+  802492:	85 c0                	test   %eax,%eax
+  802494:	78 28                	js     8024be <nsipc_sendmsg+0x24a>
+		sent += r;
+  802496:	01 45 d0             	add    %eax,-0x30(%ebp)
+	} while (i < iovcnt && r == n - skip);
+  802499:	39 c3                	cmp    %eax,%ebx
+  80249b:	75 0c                	jne    8024a9 <nsipc_sendmsg+0x235>
+  80249d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024a0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8024a3:	0f 8f f2 fd ff ff    	jg     80229b <nsipc_sendmsg+0x27>
+		sent += r;
+  8024a9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8024ac:	e9 2a fe ff ff       	jmp    8022db <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024b1:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024b4:	85 db                	test   %ebx,%ebx
+  8024b6:	0f 45 c3             	cmovne %ebx,%eax
+  8024b9:	e9 1d fe ff ff       	jmp    8022db <nsipc_sendmsg+0x67>
+			return sent ? sent : r;
+  8024be:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024c1:	85 db                	test   %ebx,%ebx
+  8024c3:	0f 45 c3             	cmovne %ebx,%eax
+  8024c6:	e9 10 fe ff ff       	jmp    8022db <nsipc_sendmsg+0x67>
+		pgbatch_init(&pb);
+  8024cb:	83 ec 0c             	sub    $0xc,%esp
+  8024ce:	68 20 60 80 00       	push   $0x806020
+  8024d3:	e8 48 0d 00 00       	call   803220 <pgbatch_init>
+  8024d8:	83 c4 10             	add    $0x10,%esp
+		skip = i < iovcnt ? PGOFF((char *) iov[i].iov_base + off) : 0;
+  8024db:	be 00 00 00 00       	mov    $0x0,%esi
+  8024e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024e5:	e9 63 ff ff ff       	jmp    80244d <nsipc_sendmsg+0x1d9>
+
+008024ea <nsipc_sendfile>:
+// at a time, and they go on to the network server as they are.
+// Returns the number of bytes sent, which is short at end of file, or
+// < 0 if the first request failed.
+int
+nsipc_sendfile(int s, int fd, off_t offset, size_t len, unsigned int flags)
+{
+  8024ea:	55                   	push   %ebp
+  8024eb:	89 e5                	mov    %esp,%ebp
+  8024ed:	57                   	push   %edi
+  8024ee:	56                   	push   %esi
+  8024ef:	53                   	push   %ebx
+  8024f0:	83 ec 0c             	sub    $0xc,%esp
+	int r, n, skip, sent = 0;
+
+	if (!sendfile_mapped) {
+  8024f3:	83 3d 28 63 80 00 00 	cmpl   $0x0,0x806328
+  8024fa:	0f 84 c8 00 00 00    	je     8025c8 <nsipc_sendfile+0xde>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+			return r;
+		sendfile_mapped = 1;
+	}
+	if (nsenv == 0)
+  802500:	83 3d 24 63 80 00 00 	cmpl   $0x0,0x806324
+  802507:	0f 84 e4 00 00 00    	je     8025f1 <nsipc_sendfile+0x107>
+{
+  80250d:	bf 00 00 00 00       	mov    $0x0,%edi
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+
+	while (sent < len) {
+  802512:	89 fb                	mov    %edi,%ebx
+  802514:	3b 7d 14             	cmp    0x14(%ebp),%edi
+  802517:	0f 83 f0 00 00 00    	jae    80260d <nsipc_sendfile+0x123>
+		skip = (offset + sent) % PGSIZE;
+  80251d:	89 fa                	mov    %edi,%edx
+  80251f:	03 55 10             	add    0x10(%ebp),%edx
+  802522:	89 d0                	mov    %edx,%eax
+  802524:	c1 f8 1f             	sar    $0x1f,%eax
+  802527:	c1 e8 14             	shr    $0x14,%eax
+  80252a:	8d 34 02             	lea    (%edx,%eax,1),%esi
+  80252d:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802533:	29 c6                	sub    %eax,%esi
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802535:	6a 10                	push   $0x10
+  802537:	68 00 20 01 e0       	push   $0xe0012000
+  80253c:	52                   	push   %edx
+  80253d:	ff 75 0c             	push   0xc(%ebp)
+  802540:	e8 fe f4 ff ff       	call   801a43 <fmap>
+  802545:	83 c4 10             	add    $0x10,%esp
+  802548:	85 c0                	test   %eax,%eax
+  80254a:	0f 8e b8 00 00 00    	jle    802608 <nsipc_sendfile+0x11e>
+			return sent ? sent : r;
+		// Past end of file, but within its last page
+		if (r <= skip)
+  802550:	39 c6                	cmp    %eax,%esi
+  802552:	0f 8d b5 00 00 00    	jge    80260d <nsipc_sendfile+0x123>
+			break;
+		n = MIN(r - skip, (int) (len - sent));
+  802558:	29 f0                	sub    %esi,%eax
+  80255a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80255d:	29 da                	sub    %ebx,%edx
+  80255f:	39 d0                	cmp    %edx,%eax
+  802561:	89 d3                	mov    %edx,%ebx
+  802563:	0f 4e d8             	cmovle %eax,%ebx
+		sendfilereq->sendfile.req_s = s;
+  802566:	8b 45 08             	mov    0x8(%ebp),%eax
+  802569:	a3 00 10 01 e0       	mov    %eax,0xe0011000
+		sendfilereq->sendfile.req_off = skip;
+  80256e:	89 35 04 10 01 e0    	mov    %esi,0xe0011004
+		sendfilereq->sendfile.req_size = n;
+  802574:	89 1d 08 10 01 e0    	mov    %ebx,0xe0011008
+		sendfilereq->sendfile.req_flags = flags;
+  80257a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80257d:	a3 0c 10 01 e0       	mov    %eax,0xe001100c
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802582:	83 ec 0c             	sub    $0xc,%esp
+  802585:	6a 05                	push   $0x5
+			       1 + ROUNDUP(skip + n, PGSIZE) / PGSIZE,
+  802587:	8d 84 33 ff 0f 00 00 	lea    0xfff(%ebx,%esi,1),%eax
+  80258e:	c1 f8 0c             	sar    $0xc,%eax
+		ipc_send_pages(nsenv, NSREQ_SENDFILE, sendfilereq,
+  802591:	83 c0 01             	add    $0x1,%eax
+  802594:	50                   	push   %eax
+  802595:	68 00 10 01 e0       	push   $0xe0011000
+  80259a:	6a 11                	push   $0x11
+  80259c:	ff 35 24 63 80 00    	push   0x806324
+  8025a2:	e8 00 13 00 00       	call   8038a7 <ipc_send_pages>
+			       PTE_P|PTE_U);
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  8025a7:	83 c4 1c             	add    $0x1c,%esp
+  8025aa:	6a 00                	push   $0x0
+  8025ac:	6a 00                	push   $0x0
+  8025ae:	6a 00                	push   $0x0
+  8025b0:	e8 2e 10 00 00       	call   8035e3 <ipc_recv>
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	85 c0                	test   %eax,%eax
+  8025ba:	78 5b                	js     802617 <nsipc_sendfile+0x12d>
+			return sent ? sent : r;
+		sent += r;
+  8025bc:	01 c7                	add    %eax,%edi
+		if (r < n)
+  8025be:	39 c3                	cmp    %eax,%ebx
+  8025c0:	0f 8e 4c ff ff ff    	jle    802512 <nsipc_sendfile+0x28>
+  8025c6:	eb 45                	jmp    80260d <nsipc_sendfile+0x123>
+		if ((r = sys_page_alloc(0, sendfilereq, PTE_P|PTE_W|PTE_U)) < 0)
+  8025c8:	83 ec 04             	sub    $0x4,%esp
+  8025cb:	6a 07                	push   $0x7
+  8025cd:	68 00 10 01 e0       	push   $0xe0011000
+  8025d2:	6a 00                	push   $0x0
+  8025d4:	e8 89 e7 ff ff       	call   800d62 <sys_page_alloc>
+  8025d9:	89 c7                	mov    %eax,%edi
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 2b                	js     80260d <nsipc_sendfile+0x123>
+		sendfile_mapped = 1;
+  8025e2:	c7 05 28 63 80 00 01 	movl   $0x1,0x806328
+  8025e9:	00 00 00 
+  8025ec:	e9 0f ff ff ff       	jmp    802500 <nsipc_sendfile+0x16>
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8025f1:	83 ec 0c             	sub    $0xc,%esp
+  8025f4:	6a 03                	push   $0x3
+  8025f6:	e8 e1 12 00 00       	call   8038dc <ipc_find_env>
+  8025fb:	a3 24 63 80 00       	mov    %eax,0x806324
+  802600:	83 c4 10             	add    $0x10,%esp
+  802603:	e9 05 ff ff ff       	jmp    80250d <nsipc_sendfile+0x23>
+		if ((r = fmap(fd, offset + sent, sendfiledata, NSBULK_PAGES)) <= 0)
+  802608:	85 ff                	test   %edi,%edi
+  80260a:	0f 44 f8             	cmove  %eax,%edi
+			break;
+	}
+	return sent;
+}
+  80260d:	89 f8                	mov    %edi,%eax
+  80260f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802612:	5b                   	pop    %ebx
+  802613:	5e                   	pop    %esi
+  802614:	5f                   	pop    %edi
+  802615:	5d                   	pop    %ebp
+  802616:	c3                   	ret
+		if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802617:	85 ff                	test   %edi,%edi
+  802619:	0f 44 f8             	cmove  %eax,%edi
+  80261c:	eb ef                	jmp    80260d <nsipc_sendfile+0x123>
+
+0080261e <nsipc_recvmsg>:
+// at most NSBULK_SIZE bytes.  With MSG_BATCH, the server fills them with
+// everything already queued on the socket, not just the first buffer.
+// Returns the number of bytes received.
+int
+nsipc_recvmsg(int s, const struct iovec *iov, int iovcnt, unsigned int flags)
+{
+  80261e:	55                   	push   %ebp
+  80261f:	89 e5                	mov    %esp,%ebp
+  802621:	57                   	push   %edi
+  802622:	56                   	push   %esi
+  802623:	53                   	push   %ebx
+  802624:	83 ec 1c             	sub    $0x1c,%esp
+  802627:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r, i, n, len = 0;
+
+	if ((r = nsbulk_map()) < 0)
+  80262a:	e8 13 f9 ff ff       	call   801f42 <nsbulk_map>
+  80262f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802632:	85 c0                	test   %eax,%eax
+  802634:	0f 88 ba 00 00 00    	js     8026f4 <nsipc_recvmsg+0xd6>
+		return r;
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  80263a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80263e:	0f 8e bb 00 00 00    	jle    8026ff <nsipc_recvmsg+0xe1>
+	int r, i, n, len = 0;
+  802644:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802649:	ba 00 00 00 00       	mov    $0x0,%edx
+		len += MIN(iov[i].iov_len, NSBULK_SIZE - len);
+  80264e:	bf 00 00 01 00       	mov    $0x10000,%edi
+  802653:	89 f8                	mov    %edi,%eax
+  802655:	29 f0                	sub    %esi,%eax
+  802657:	8b 4c d3 04          	mov    0x4(%ebx,%edx,8),%ecx
+  80265b:	39 c8                	cmp    %ecx,%eax
+  80265d:	0f 47 c1             	cmova  %ecx,%eax
+  802660:	01 f0                	add    %esi,%eax
+  802662:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < iovcnt && len < NSBULK_SIZE; i++)
+  802664:	83 c2 01             	add    $0x1,%edx
+  802667:	39 55 10             	cmp    %edx,0x10(%ebp)
+  80266a:	7e 07                	jle    802673 <nsipc_recvmsg+0x55>
+  80266c:	3d ff ff 00 00       	cmp    $0xffff,%eax
+  802671:	7e e0                	jle    802653 <nsipc_recvmsg+0x35>
+
+	if ((r = nsbulk_own(0, ROUNDUP(len, PGSIZE) / PGSIZE)) < 0)
+  802673:	8d 96 ff 0f 00 00    	lea    0xfff(%esi),%edx
+  802679:	c1 fa 0c             	sar    $0xc,%edx
+  80267c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802681:	e8 0a f9 ff ff       	call   801f90 <nsbulk_own>
+  802686:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802689:	85 c0                	test   %eax,%eax
+  80268b:	78 67                	js     8026f4 <nsipc_recvmsg+0xd6>
+		return r;
+
+	nsbulkreq->recvmsg.req_s = s;
+  80268d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802690:	a3 00 00 00 e0       	mov    %eax,0xe0000000
+	nsbulkreq->recvmsg.req_len = len;
+  802695:	89 35 04 00 00 e0    	mov    %esi,0xe0000004
+	nsbulkreq->recvmsg.req_flags = flags;
+  80269b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80269e:	a3 08 00 00 e0       	mov    %eax,0xe0000008
+	if ((r = nsipc_bulk(NSREQ_RECVMSG, len, PTE_P|PTE_W|PTE_U)) < 0)
+  8026a3:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8026a8:	89 f2                	mov    %esi,%edx
+  8026aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8026af:	e8 44 f9 ff ff       	call   801ff8 <nsipc_bulk>
+  8026b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026b7:	85 c0                	test   %eax,%eax
+  8026b9:	78 39                	js     8026f4 <nsipc_recvmsg+0xd6>
+		return r;
+	assert(r <= len);
+  8026bb:	39 f0                	cmp    %esi,%eax
+  8026bd:	7f 4a                	jg     802709 <nsipc_recvmsg+0xeb>
+
+	// Scatter what arrived.
+	for (i = 0, n = 0; n < r; i++) {
+  8026bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c4:	85 c0                	test   %eax,%eax
+  8026c6:	7e 2c                	jle    8026f4 <nsipc_recvmsg+0xd6>
+		size_t m = MIN(iov[i].iov_len, (size_t) (r - n));
+  8026c8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8026cb:	29 fe                	sub    %edi,%esi
+  8026cd:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026d0:	39 c6                	cmp    %eax,%esi
+  8026d2:	0f 47 f0             	cmova  %eax,%esi
+		memmove(iov[i].iov_base, nsbulkdata + n, m);
+  8026d5:	83 ec 04             	sub    $0x4,%esp
+  8026d8:	56                   	push   %esi
+  8026d9:	8d 87 00 10 00 e0    	lea    -0x1ffff000(%edi),%eax
+  8026df:	50                   	push   %eax
+  8026e0:	ff 33                	push   (%ebx)
+  8026e2:	e8 f7 e3 ff ff       	call   800ade <memmove>
+		n += m;
+  8026e7:	01 f7                	add    %esi,%edi
+	for (i = 0, n = 0; n < r; i++) {
+  8026e9:	83 c3 08             	add    $0x8,%ebx
+  8026ec:	83 c4 10             	add    $0x10,%esp
+  8026ef:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  8026f2:	7f d4                	jg     8026c8 <nsipc_recvmsg+0xaa>
+	}
+	return r;
+}
+  8026f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026fa:	5b                   	pop    %ebx
+  8026fb:	5e                   	pop    %esi
+  8026fc:	5f                   	pop    %edi
+  8026fd:	5d                   	pop    %ebp
+  8026fe:	c3                   	ret
+	int r, i, n, len = 0;
+  8026ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802704:	e9 6a ff ff ff       	jmp    802673 <nsipc_recvmsg+0x55>
+	assert(r <= len);
+  802709:	68 c0 3f 80 00       	push   $0x803fc0
+  80270e:	68 c9 3f 80 00       	push   $0x803fc9
+  802713:	68 3b 01 00 00       	push   $0x13b
+  802718:	68 de 3f 80 00       	push   $0x803fde
+  80271d:	e8 7b 0e 00 00       	call   80359d <_panic>
+
+00802722 <nsipc_select>:
+
+int
+nsipc_select(int nfds, fd_set *readset, fd_set *writeset, fd_set *exceptset,
+	     int msec)
+{
+  802722:	55                   	push   %ebp
+  802723:	89 e5                	mov    %esp,%ebp
+  802725:	57                   	push   %edi
+  802726:	56                   	push   %esi
+  802727:	53                   	push   %ebx
+  802728:	83 ec 0c             	sub    $0xc,%esp
+  80272b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80272e:	8b 75 10             	mov    0x10(%ebp),%esi
+  802731:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	int r;
+
+	nsipcbuf.select.req_nfds = nfds;
+  802734:	8b 45 08             	mov    0x8(%ebp),%eax
+  802737:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.select.req_readset = *readset;
+  80273c:	8b 07                	mov    (%edi),%eax
+  80273e:	a3 04 80 80 00       	mov    %eax,0x808004
+  802743:	8b 47 04             	mov    0x4(%edi),%eax
+  802746:	a3 08 80 80 00       	mov    %eax,0x808008
+  80274b:	8b 47 08             	mov    0x8(%edi),%eax
+  80274e:	a3 0c 80 80 00       	mov    %eax,0x80800c
+  802753:	8b 47 0c             	mov    0xc(%edi),%eax
+  802756:	a3 10 80 80 00       	mov    %eax,0x808010
+  80275b:	8b 47 10             	mov    0x10(%edi),%eax
+  80275e:	a3 14 80 80 00       	mov    %eax,0x808014
+  802763:	8b 47 14             	mov    0x14(%edi),%eax
+  802766:	a3 18 80 80 00       	mov    %eax,0x808018
+  80276b:	8b 47 18             	mov    0x18(%edi),%eax
+  80276e:	a3 1c 80 80 00       	mov    %eax,0x80801c
+  802773:	8b 47 1c             	mov    0x1c(%edi),%eax
+  802776:	a3 20 80 80 00       	mov    %eax,0x808020
+  80277b:	8b 47 20             	mov    0x20(%edi),%eax
+  80277e:	a3 24 80 80 00       	mov    %eax,0x808024
+  802783:	8b 47 24             	mov    0x24(%edi),%eax
+  802786:	a3 28 80 80 00       	mov    %eax,0x808028
+  80278b:	8b 47 28             	mov    0x28(%edi),%eax
+  80278e:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  802793:	8b 47 2c             	mov    0x2c(%edi),%eax
+  802796:	a3 30 80 80 00       	mov    %eax,0x808030
+  80279b:	8b 47 30             	mov    0x30(%edi),%eax
+  80279e:	a3 34 80 80 00       	mov    %eax,0x808034
+  8027a3:	8b 47 34             	mov    0x34(%edi),%eax
+  8027a6:	a3 38 80 80 00       	mov    %eax,0x808038
+  8027ab:	8b 47 38             	mov    0x38(%edi),%eax
+  8027ae:	a3 3c 80 80 00       	mov    %eax,0x80803c
+  8027b3:	8b 47 3c             	mov    0x3c(%edi),%eax
+  8027b6:	a3 40 80 80 00       	mov    %eax,0x808040
+	nsipcbuf.select.req_writeset = *writeset;
+  8027bb:	8b 06                	mov    (%esi),%eax
+  8027bd:	a3 44 80 80 00       	mov    %eax,0x808044
+  8027c2:	8b 46 04             	mov    0x4(%esi),%eax
+  8027c5:	a3 48 80 80 00       	mov    %eax,0x808048
+  8027ca:	8b 46 08             	mov    0x8(%esi),%eax
+  8027cd:	a3 4c 80 80 00       	mov    %eax,0x80804c
+  8027d2:	8b 46 0c             	mov    0xc(%esi),%eax
+  8027d5:	a3 50 80 80 00       	mov    %eax,0x808050
+  8027da:	8b 46 10             	mov    0x10(%esi),%eax
+  8027dd:	a3 54 80 80 00       	mov    %eax,0x808054
+  8027e2:	8b 46 14             	mov    0x14(%esi),%eax
+  8027e5:	a3 58 80 80 00       	mov    %eax,0x808058
+  8027ea:	8b 46 18             	mov    0x18(%esi),%eax
+  8027ed:	a3 5c 80 80 00       	mov    %eax,0x80805c
+  8027f2:	8b 46 1c             	mov    0x1c(%esi),%eax
+  8027f5:	a3 60 80 80 00       	mov    %eax,0x808060
+  8027fa:	8b 46 20             	mov    0x20(%esi),%eax
+  8027fd:	a3 64 80 80 00       	mov    %eax,0x808064
+  802802:	8b 46 24             	mov    0x24(%esi),%eax
+  802805:	a3 68 80 80 00       	mov    %eax,0x808068
+  80280a:	8b 46 28             	mov    0x28(%esi),%eax
+  80280d:	a3 6c 80 80 00       	mov    %eax,0x80806c
+  802812:	8b 46 2c             	mov    0x2c(%esi),%eax
+  802815:	a3 70 80 80 00       	mov    %eax,0x808070
+  80281a:	8b 46 30             	mov    0x30(%esi),%eax
+  80281d:	a3 74 80 80 00       	mov    %eax,0x808074
+  802822:	8b 46 34             	mov    0x34(%esi),%eax
+  802825:	a3 78 80 80 00       	mov    %eax,0x808078
+  80282a:	8b 46 38             	mov    0x38(%esi),%eax
+  80282d:	a3 7c 80 80 00       	mov    %eax,0x80807c
+  802832:	8b 46 3c             	mov    0x3c(%esi),%eax
+  802835:	a3 80 80 80 00       	mov    %eax,0x808080
+	nsipcbuf.select.req_exceptset = *exceptset;
+  80283a:	8b 03                	mov    (%ebx),%eax
+  80283c:	a3 84 80 80 00       	mov    %eax,0x808084
+  802841:	8b 43 04             	mov    0x4(%ebx),%eax
+  802844:	a3 88 80 80 00       	mov    %eax,0x808088
+  802849:	8b 43 08             	mov    0x8(%ebx),%eax
+  80284c:	a3 8c 80 80 00       	mov    %eax,0x80808c
+  802851:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802854:	a3 90 80 80 00       	mov    %eax,0x808090
+  802859:	8b 43 10             	mov    0x10(%ebx),%eax
+  80285c:	a3 94 80 80 00       	mov    %eax,0x808094
+  802861:	8b 43 14             	mov    0x14(%ebx),%eax
+  802864:	a3 98 80 80 00       	mov    %eax,0x808098
+  802869:	8b 43 18             	mov    0x18(%ebx),%eax
+  80286c:	a3 9c 80 80 00       	mov    %eax,0x80809c
+  802871:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802874:	a3 a0 80 80 00       	mov    %eax,0x8080a0
+  802879:	8b 43 20             	mov    0x20(%ebx),%eax
+  80287c:	a3 a4 80 80 00       	mov    %eax,0x8080a4
+  802881:	8b 43 24             	mov    0x24(%ebx),%eax
+  802884:	a3 a8 80 80 00       	mov    %eax,0x8080a8
+  802889:	8b 43 28             	mov    0x28(%ebx),%eax
+  80288c:	a3 ac 80 80 00       	mov    %eax,0x8080ac
+  802891:	8b 43 2c             	mov    0x2c(%ebx),%eax
+  802894:	a3 b0 80 80 00       	mov    %eax,0x8080b0
+  802899:	8b 43 30             	mov    0x30(%ebx),%eax
+  80289c:	a3 b4 80 80 00       	mov    %eax,0x8080b4
+  8028a1:	8b 43 34             	mov    0x34(%ebx),%eax
+  8028a4:	a3 b8 80 80 00       	mov    %eax,0x8080b8
+  8028a9:	8b 43 38             	mov    0x38(%ebx),%eax
+  8028ac:	a3 bc 80 80 00       	mov    %eax,0x8080bc
+  8028b1:	8b 43 3c             	mov    0x3c(%ebx),%eax
+  8028b4:	a3 c0 80 80 00       	mov    %eax,0x8080c0
+	nsipcbuf.select.req_timeout = msec;
+  8028b9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8028bc:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	if ((r = nsipc(NSREQ_SELECT)) >= 0) {
+  8028c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8028c6:	e8 2b f6 ff ff       	call   801ef6 <nsipc>
+  8028cb:	85 c0                	test   %eax,%eax
+  8028cd:	0f 88 ad 01 00 00    	js     802a80 <nsipc_select+0x35e>
+		*readset = nsipcbuf.select.req_readset;
+  8028d3:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  8028d9:	89 17                	mov    %edx,(%edi)
+  8028db:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  8028e1:	89 57 04             	mov    %edx,0x4(%edi)
+  8028e4:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  8028ea:	89 57 08             	mov    %edx,0x8(%edi)
+  8028ed:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  8028f3:	89 57 0c             	mov    %edx,0xc(%edi)
+  8028f6:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  8028fc:	89 57 10             	mov    %edx,0x10(%edi)
+  8028ff:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802905:	89 57 14             	mov    %edx,0x14(%edi)
+  802908:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  80290e:	89 57 18             	mov    %edx,0x18(%edi)
+  802911:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802917:	89 57 1c             	mov    %edx,0x1c(%edi)
+  80291a:	8b 15 24 80 80 00    	mov    0x808024,%edx
+  802920:	89 57 20             	mov    %edx,0x20(%edi)
+  802923:	8b 15 28 80 80 00    	mov    0x808028,%edx
+  802929:	89 57 24             	mov    %edx,0x24(%edi)
+  80292c:	8b 15 2c 80 80 00    	mov    0x80802c,%edx
+  802932:	89 57 28             	mov    %edx,0x28(%edi)
+  802935:	8b 15 30 80 80 00    	mov    0x808030,%edx
+  80293b:	89 57 2c             	mov    %edx,0x2c(%edi)
+  80293e:	8b 15 34 80 80 00    	mov    0x808034,%edx
+  802944:	89 57 30             	mov    %edx,0x30(%edi)
+  802947:	8b 15 38 80 80 00    	mov    0x808038,%edx
+  80294d:	89 57 34             	mov    %edx,0x34(%edi)
+  802950:	8b 15 3c 80 80 00    	mov    0x80803c,%edx
+  802956:	89 57 38             	mov    %edx,0x38(%edi)
+  802959:	8b 15 40 80 80 00    	mov    0x808040,%edx
+  80295f:	89 57 3c             	mov    %edx,0x3c(%edi)
+		*writeset = nsipcbuf.select.req_writeset;
+  802962:	8b 15 44 80 80 00    	mov    0x808044,%edx
+  802968:	89 16                	mov    %edx,(%esi)
+  80296a:	8b 15 48 80 80 00    	mov    0x808048,%edx
+  802970:	89 56 04             	mov    %edx,0x4(%esi)
+  802973:	8b 15 4c 80 80 00    	mov    0x80804c,%edx
+  802979:	89 56 08             	mov    %edx,0x8(%esi)
+  80297c:	8b 15 50 80 80 00    	mov    0x808050,%edx
+  802982:	89 56 0c             	mov    %edx,0xc(%esi)
+  802985:	8b 15 54 80 80 00    	mov    0x808054,%edx
+  80298b:	89 56 10             	mov    %edx,0x10(%esi)
+  80298e:	8b 15 58 80 80 00    	mov    0x808058,%edx
+  802994:	89 56 14             	mov    %edx,0x14(%esi)
+  802997:	8b 15 5c 80 80 00    	mov    0x80805c,%edx
+  80299d:	89 56 18             	mov    %edx,0x18(%esi)
+  8029a0:	8b 15 60 80 80 00    	mov    0x808060,%edx
+  8029a6:	89 56 1c             	mov    %edx,0x1c(%esi)
+  8029a9:	8b 15 64 80 80 00    	mov    0x808064,%edx
+  8029af:	89 56 20             	mov    %edx,0x20(%esi)
+  8029b2:	8b 15 68 80 80 00    	mov    0x808068,%edx
+  8029b8:	89 56 24             	mov    %edx,0x24(%esi)
+  8029bb:	8b 15 6c 80 80 00    	mov    0x80806c,%edx
+  8029c1:	89 56 28             	mov    %edx,0x28(%esi)
+  8029c4:	8b 15 70 80 80 00    	mov    0x808070,%edx
+  8029ca:	89 56 2c             	mov    %edx,0x2c(%esi)
+  8029cd:	8b 15 74 80 80 00    	mov    0x808074,%edx
+  8029d3:	89 56 30             	mov    %edx,0x30(%esi)
+  8029d6:	8b 15 78 80 80 00    	mov    0x808078,%edx
+  8029dc:	89 56 34             	mov    %edx,0x34(%esi)
+  8029df:	8b 15 7c 80 80 00    	mov    0x80807c,%edx
+  8029e5:	89 56 38             	mov    %edx,0x38(%esi)
+  8029e8:	8b 15 80 80 80 00    	mov    0x808080,%edx
+  8029ee:	89 56 3c             	mov    %edx,0x3c(%esi)
+		*exceptset = nsipcbuf.select.req_exceptset;
+  8029f1:	8b 15 84 80 80 00    	mov    0x808084,%edx
+  8029f7:	89 13                	mov    %edx,(%ebx)
+  8029f9:	8b 15 88 80 80 00    	mov    0x808088,%edx
+  8029ff:	89 53 04             	mov    %edx,0x4(%ebx)
+  802a02:	8b 15 8c 80 80 00    	mov    0x80808c,%edx
+  802a08:	89 53 08             	mov    %edx,0x8(%ebx)
+  802a0b:	8b 15 90 80 80 00    	mov    0x808090,%edx
+  802a11:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802a14:	8b 15 94 80 80 00    	mov    0x808094,%edx
+  802a1a:	89 53 10             	mov    %edx,0x10(%ebx)
+  802a1d:	8b 15 98 80 80 00    	mov    0x808098,%edx
+  802a23:	89 53 14             	mov    %edx,0x14(%ebx)
+  802a26:	8b 15 9c 80 80 00    	mov    0x80809c,%edx
+  802a2c:	89 53 18             	mov    %edx,0x18(%ebx)
+  802a2f:	8b 15 a0 80 80 00    	mov    0x8080a0,%edx
+  802a35:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802a38:	8b 15 a4 80 80 00    	mov    0x8080a4,%edx
+  802a3e:	89 53 20             	mov    %edx,0x20(%ebx)
+  802a41:	8b 15 a8 80 80 00    	mov    0x8080a8,%edx
+  802a47:	89 53 24             	mov    %edx,0x24(%ebx)
+  802a4a:	8b 15 ac 80 80 00    	mov    0x8080ac,%edx
+  802a50:	89 53 28             	mov    %edx,0x28(%ebx)
+  802a53:	8b 15 b0 80 80 00    	mov    0x8080b0,%edx
+  802a59:	89 53 2c             	mov    %edx,0x2c(%ebx)
+  802a5c:	8b 15 b4 80 80 00    	mov    0x8080b4,%edx
+  802a62:	89 53 30             	mov    %edx,0x30(%ebx)
+  802a65:	8b 15 b8 80 80 00    	mov    0x8080b8,%edx
+  802a6b:	89 53 34             	mov    %edx,0x34(%ebx)
+  802a6e:	8b 15 bc 80 80 00    	mov    0x8080bc,%edx
+  802a74:	89 53 38             	mov    %edx,0x38(%ebx)
+  802a77:	8b 15 c0 80 80 00    	mov    0x8080c0,%edx
+  802a7d:	89 53 3c             	mov    %edx,0x3c(%ebx)
+	}
+	return r;
+}
+  802a80:	83 c4 0c             	add    $0xc,%esp
+  802a83:	5b                   	pop    %ebx
+  802a84:	5e                   	pop    %esi
+  802a85:	5f                   	pop    %edi
+  802a86:	5d                   	pop    %ebp
+  802a87:	c3                   	ret
+
+00802a88 <nsipc_evctl>:
+
+int
+nsipc_evctl(int s, int events, int data)
+{
+  802a88:	55                   	push   %ebp
+  802a89:	89 e5                	mov    %esp,%ebp
+  802a8b:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.evctl.req_s = s;
+  802a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a91:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.evctl.req_events = events;
+  802a96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a99:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.evctl.req_data = data;
+  802a9e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802aa1:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_EVCTL);
+  802aa6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802aab:	e8 46 f4 ff ff       	call   801ef6 <nsipc>
+}
+  802ab0:	c9                   	leave
+  802ab1:	c3                   	ret
+
+00802ab2 <nsipc_evwait>:
+
+int
+nsipc_evwait(struct pollfd *evs, int max, int timeout)
+{
+  802ab2:	55                   	push   %ebp
+  802ab3:	89 e5                	mov    %esp,%ebp
+  802ab5:	56                   	push   %esi
+  802ab6:	53                   	push   %ebx
+  802ab7:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	nsipcbuf.evwait.req_max = max;
+  802aba:	89 35 00 80 80 00    	mov    %esi,0x808000
+	nsipcbuf.evwait.req_timeout = timeout;
+  802ac0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ac3:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_EVWAIT)) > 0) {
+  802ac8:	b8 10 00 00 00       	mov    $0x10,%eax
+  802acd:	e8 24 f4 ff ff       	call   801ef6 <nsipc>
+  802ad2:	89 c3                	mov    %eax,%ebx
+  802ad4:	85 c0                	test   %eax,%eax
+  802ad6:	7e 1f                	jle    802af7 <nsipc_evwait+0x45>
+		assert(r <= max);
+  802ad8:	39 c6                	cmp    %eax,%esi
+  802ada:	7c 24                	jl     802b00 <nsipc_evwait+0x4e>
+		memmove(evs, nsipcbuf.evwaitRet.ret_ev, r * sizeof(struct pollfd));
+  802adc:	83 ec 04             	sub    $0x4,%esp
+  802adf:	8d 04 c5 00 00 00 00 	lea    0x0(,%eax,8),%eax
+  802ae6:	50                   	push   %eax
+  802ae7:	68 00 80 80 00       	push   $0x808000
+  802aec:	ff 75 08             	push   0x8(%ebp)
+  802aef:	e8 ea df ff ff       	call   800ade <memmove>
+  802af4:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802af7:	89 d8                	mov    %ebx,%eax
+  802af9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802afc:	5b                   	pop    %ebx
+  802afd:	5e                   	pop    %esi
+  802afe:	5d                   	pop    %ebp
+  802aff:	c3                   	ret
+		assert(r <= max);
+  802b00:	68 f6 3f 80 00       	push   $0x803ff6
+  802b05:	68 c9 3f 80 00       	push   $0x803fc9
+  802b0a:	68 6a 01 00 00       	push   $0x16a
+  802b0f:	68 de 3f 80 00       	push   $0x803fde
+  802b14:	e8 84 0a 00 00       	call   80359d <_panic>
+
+00802b19 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b19:	55                   	push   %ebp
+  802b1a:	89 e5                	mov    %esp,%ebp
+  802b1c:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b22:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b2a:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b2f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b32:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b37:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b3c:	e8 b5 f3 ff ff       	call   801ef6 <nsipc>
+}
+  802b41:	c9                   	leave
+  802b42:	c3                   	ret
+
+00802b43 <nsipc_offload>:
+
+int
+nsipc_offload(int flags)
+{
+  802b43:	55                   	push   %ebp
+  802b44:	89 e5                	mov    %esp,%ebp
+  802b46:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.offload.req_flags = flags;
+  802b49:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b4c:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_OFFLOAD);
+  802b51:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802b56:	e8 9b f3 ff ff       	call   801ef6 <nsipc>
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <nsipc_memstats>:
+
+// Fill in 'st' with the network server's memory use.
+int
+nsipc_memstats(struct Nsret_memstats *st)
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	53                   	push   %ebx
+  802b61:	83 ec 04             	sub    $0x4,%esp
+  802b64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = nsipc(NSREQ_MEMSTATS)) >= 0)
+  802b67:	b8 12 00 00 00       	mov    $0x12,%eax
+  802b6c:	e8 85 f3 ff ff       	call   801ef6 <nsipc>
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 50                	js     802bc5 <nsipc_memstats+0x68>
+		*st = nsipcbuf.memstatsRet;
+  802b75:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  802b7b:	89 13                	mov    %edx,(%ebx)
+  802b7d:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  802b83:	89 53 04             	mov    %edx,0x4(%ebx)
+  802b86:	8b 15 08 80 80 00    	mov    0x808008,%edx
+  802b8c:	89 53 08             	mov    %edx,0x8(%ebx)
+  802b8f:	8b 15 0c 80 80 00    	mov    0x80800c,%edx
+  802b95:	89 53 0c             	mov    %edx,0xc(%ebx)
+  802b98:	8b 15 10 80 80 00    	mov    0x808010,%edx
+  802b9e:	89 53 10             	mov    %edx,0x10(%ebx)
+  802ba1:	8b 15 14 80 80 00    	mov    0x808014,%edx
+  802ba7:	89 53 14             	mov    %edx,0x14(%ebx)
+  802baa:	8b 15 18 80 80 00    	mov    0x808018,%edx
+  802bb0:	89 53 18             	mov    %edx,0x18(%ebx)
+  802bb3:	8b 15 1c 80 80 00    	mov    0x80801c,%edx
+  802bb9:	89 53 1c             	mov    %edx,0x1c(%ebx)
+  802bbc:	8b 15 20 80 80 00    	mov    0x808020,%edx
+  802bc2:	89 53 20             	mov    %edx,0x20(%ebx)
+	return r;
+}
+  802bc5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc8:	c9                   	leave
+  802bc9:	c3                   	ret
+
+00802bca <nsipc_shard>:
+// kernel steers to that shard can only be used through it, so call
+// this before creating any socket.  Children inherit the choice.
+// Returns 0 on success, < 0 on failure (no such shard).
+int
+nsipc_shard(int shard)
+{
+  802bca:	55                   	push   %ebp
+  802bcb:	89 e5                	mov    %esp,%ebp
+  802bcd:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	nsenv = ipc_find_env(ENV_TYPE_NS);
+  802bd0:	6a 03                	push   $0x3
+  802bd2:	e8 05 0d 00 00       	call   8038dc <ipc_find_env>
+  802bd7:	a3 24 63 80 00       	mov    %eax,0x806324
+	nsipcbuf.shard.req_shard = shard;
+  802bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bdf:	a3 00 80 80 00       	mov    %eax,0x808000
+	if ((r = nsipc(NSREQ_SHARD)) < 0)
+  802be4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802be9:	e8 08 f3 ff ff       	call   801ef6 <nsipc>
+  802bee:	83 c4 10             	add    $0x10,%esp
+  802bf1:	85 c0                	test   %eax,%eax
+  802bf3:	78 0a                	js     802bff <nsipc_shard+0x35>
+		return r;
+	nsenv = r;
+  802bf5:	a3 24 63 80 00       	mov    %eax,0x806324
+	return 0;
+  802bfa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bff:	c9                   	leave
+  802c00:	c3                   	ret
+
+00802c01 <_pipeisclosed>:
+	return r;
+}
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p)
+{
+  802c01:	55                   	push   %ebp
+  802c02:	89 e5                	mov    %esp,%ebp
+  802c04:	57                   	push   %edi
+  802c05:	56                   	push   %esi
+  802c06:	53                   	push   %ebx
+  802c07:	83 ec 1c             	sub    $0x1c,%esp
+  802c0a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c0d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802c10:	be ff ff bf ee       	mov    $0xeebfffff,%esi
+  802c15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c1a:	89 e0                	mov    %esp,%eax
+  802c1c:	89 f2                	mov    %esi,%edx
+  802c1e:	29 c2                	sub    %eax,%edx
+  802c20:	89 d0                	mov    %edx,%eax
+  802c22:	c1 e8 0f             	shr    $0xf,%eax
+  802c25:	81 fa 00 00 10 00    	cmp    $0x100000,%edx
+  802c2b:	0f 43 c3             	cmovae %ebx,%eax
+	int n, nn, ret;
+
+	while (1) {
+		n = thisenv->env_runs;
+  802c2e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c35:	8b 78 58             	mov    0x58(%eax),%edi
+		ret = pageref(fd) == pageref(p);
+  802c38:	83 ec 0c             	sub    $0xc,%esp
+  802c3b:	ff 75 e0             	push   -0x20(%ebp)
+  802c3e:	e8 d8 0c 00 00       	call   80391b <pageref>
+  802c43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c46:	83 c4 04             	add    $0x4,%esp
+  802c49:	ff 75 dc             	push   -0x24(%ebp)
+  802c4c:	e8 ca 0c 00 00       	call   80391b <pageref>
+  802c51:	89 e2                	mov    %esp,%edx
+  802c53:	89 f1                	mov    %esi,%ecx
+  802c55:	29 d1                	sub    %edx,%ecx
+
+	return slot < NTHREADS ? slot : 0;
+  802c57:	83 c4 10             	add    $0x10,%esp
+	uint32_t slot = (UTOP - 1 - read_esp()) / TSTACKSIZE;
+  802c5a:	89 ca                	mov    %ecx,%edx
+  802c5c:	c1 ea 0f             	shr    $0xf,%edx
+  802c5f:	81 f9 00 00 10 00    	cmp    $0x100000,%ecx
+  802c65:	0f 43 d3             	cmovae %ebx,%edx
+		nn = thisenv->env_runs;
+  802c68:	8b 14 95 40 63 80 00 	mov    0x806340(,%edx,4),%edx
+  802c6f:	8b 52 58             	mov    0x58(%edx),%edx
+		if (n == nn)
+  802c72:	39 d7                	cmp    %edx,%edi
+  802c74:	74 40                	je     802cb6 <_pipeisclosed+0xb5>
+			return ret;
+		if (n != nn && ret == 1)
+  802c76:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c79:	75 9f                	jne    802c1a <_pipeisclosed+0x19>
+  802c7b:	89 e2                	mov    %esp,%edx
+  802c7d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  802c82:	29 d0                	sub    %edx,%eax
+  802c84:	89 c2                	mov    %eax,%edx
+  802c86:	c1 ea 0f             	shr    $0xf,%edx
+  802c89:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  802c8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c93:	0f 42 c2             	cmovb  %edx,%eax
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c96:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  802c9d:	8b 40 58             	mov    0x58(%eax),%eax
+  802ca0:	6a 01                	push   $0x1
+  802ca2:	50                   	push   %eax
+  802ca3:	57                   	push   %edi
+  802ca4:	68 ff 3f 80 00       	push   $0x803fff
+  802ca9:	e8 89 d5 ff ff       	call   800237 <cprintf>
+  802cae:	83 c4 10             	add    $0x10,%esp
+  802cb1:	e9 5f ff ff ff       	jmp    802c15 <_pipeisclosed+0x14>
+		ret = pageref(fd) == pageref(p);
+  802cb6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cb9:	0f 94 c0             	sete   %al
+  802cbc:	0f b6 c0             	movzbl %al,%eax
+	}
+}
+  802cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc2:	5b                   	pop    %ebx
+  802cc3:	5e                   	pop    %esi
+  802cc4:	5f                   	pop    %edi
+  802cc5:	5d                   	pop    %ebp
+  802cc6:	c3                   	ret
+
+00802cc7 <devpipe_close>:
+	return 0;
+}
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802cc7:	55                   	push   %ebp
+  802cc8:	89 e5                	mov    %esp,%ebp
+  802cca:	53                   	push   %ebx
+  802ccb:	83 ec 0c             	sub    $0xc,%esp
+  802cce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cd1:	53                   	push   %ebx
+  802cd2:	6a 00                	push   $0x0
+  802cd4:	e8 0e e1 ff ff       	call   800de7 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cd9:	89 1c 24             	mov    %ebx,(%esp)
+  802cdc:	e8 f4 e4 ff ff       	call   8011d5 <fd2data>
+  802ce1:	83 c4 08             	add    $0x8,%esp
+  802ce4:	50                   	push   %eax
+  802ce5:	6a 00                	push   $0x0
+  802ce7:	e8 fb e0 ff ff       	call   800de7 <sys_page_unmap>
+}
+  802cec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cef:	c9                   	leave
+  802cf0:	c3                   	ret
+
+00802cf1 <devpipe_read>:
+{
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	57                   	push   %edi
+  802cf5:	56                   	push   %esi
+  802cf6:	53                   	push   %ebx
+  802cf7:	83 ec 18             	sub    $0x18,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802cfa:	ff 75 08             	push   0x8(%ebp)
+  802cfd:	e8 d3 e4 ff ff       	call   8011d5 <fd2data>
+  802d02:	89 c3                	mov    %eax,%ebx
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d04:	8b 70 04             	mov    0x4(%eax),%esi
+  802d07:	8b 00                	mov    (%eax),%eax
+  802d09:	83 c4 10             	add    $0x10,%esp
+  802d0c:	39 f0                	cmp    %esi,%eax
+  802d0e:	75 36                	jne    802d46 <devpipe_read+0x55>
+		pipe_wait(&p->p_wpos, wpos, &p->p_rwait);
+  802d10:	8d 7b 04             	lea    0x4(%ebx),%edi
+		if (_pipeisclosed(fd, p))
+  802d13:	89 da                	mov    %ebx,%edx
+  802d15:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d18:	e8 e4 fe ff ff       	call   802c01 <_pipeisclosed>
+  802d1d:	85 c0                	test   %eax,%eax
+  802d1f:	0f 85 d4 00 00 00    	jne    802df9 <devpipe_read+0x108>
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1" :
+  802d25:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d2a:	f0 87 43 08          	lock xchg %eax,0x8(%ebx)
+	sys_futex_wait(pos, val, ~0);
+  802d2e:	83 ec 04             	sub    $0x4,%esp
+  802d31:	6a ff                	push   $0xffffffff
+  802d33:	56                   	push   %esi
+  802d34:	57                   	push   %edi
+  802d35:	e8 26 e4 ff ff       	call   801160 <sys_futex_wait>
+	while ((wpos = p->p_wpos) == p->p_rpos) {
+  802d3a:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d3d:	8b 03                	mov    (%ebx),%eax
+  802d3f:	83 c4 10             	add    $0x10,%esp
+  802d42:	39 c6                	cmp    %eax,%esi
+  802d44:	74 cd                	je     802d13 <devpipe_read+0x22>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802d46:	8b 73 04             	mov    0x4(%ebx),%esi
+  802d49:	8b 03                	mov    (%ebx),%eax
+  802d4b:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  802d51:	29 c6                	sub    %eax,%esi
+  802d53:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d58:	f7 e6                	mul    %esi
+  802d5a:	c1 ea 0c             	shr    $0xc,%edx
+  802d5d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802d63:	29 d6                	sub    %edx,%esi
+	n = MIN(n, pipe_count(p));
+  802d65:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d68:	0f 47 75 10          	cmova  0x10(%ebp),%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802d6c:	8b 0b                	mov    (%ebx),%ecx
+  802d6e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d73:	f7 e1                	mul    %ecx
+  802d75:	c1 ea 0b             	shr    $0xb,%edx
+  802d78:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802d7e:	29 c1                	sub    %eax,%ecx
+	k = MIN(n, PIPEBUFSIZ - i);
+  802d80:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802d85:	29 cf                	sub    %ecx,%edi
+  802d87:	39 f7                	cmp    %esi,%edi
+  802d89:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, &p->p_buf[i], k);
+  802d8c:	83 ec 04             	sub    $0x4,%esp
+  802d8f:	57                   	push   %edi
+  802d90:	8d 44 0b 10          	lea    0x10(%ebx,%ecx,1),%eax
+  802d94:	50                   	push   %eax
+  802d95:	ff 75 0c             	push   0xc(%ebp)
+  802d98:	e8 41 dd ff ff       	call   800ade <memmove>
+	memmove(buf + k, p->p_buf, n - k);
+  802d9d:	83 c4 0c             	add    $0xc,%esp
+  802da0:	89 f0                	mov    %esi,%eax
+  802da2:	29 f8                	sub    %edi,%eax
+  802da4:	50                   	push   %eax
+  802da5:	8d 43 10             	lea    0x10(%ebx),%eax
+  802da8:	50                   	push   %eax
+  802da9:	89 f8                	mov    %edi,%eax
+  802dab:	03 45 0c             	add    0xc(%ebp),%eax
+  802dae:	50                   	push   %eax
+  802daf:	e8 2a dd ff ff       	call   800ade <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2 * PIPEBUFSIZ);
+  802db4:	8b 0b                	mov    (%ebx),%ecx
+  802db6:	01 f1                	add    %esi,%ecx
+  802db8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dbd:	f7 e1                	mul    %ecx
+  802dbf:	c1 ea 0c             	shr    $0xc,%edx
+  802dc2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802dc8:	29 c1                	sub    %eax,%ecx
+  802dca:	89 0b                	mov    %ecx,(%ebx)
+  802dcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd1:	f0 87 43 0c          	lock xchg %eax,0xc(%ebx)
+	if (xchg(waiting, 0))
+  802dd5:	83 c4 10             	add    $0x10,%esp
+  802dd8:	85 c0                	test   %eax,%eax
+  802dda:	75 0a                	jne    802de6 <devpipe_read+0xf5>
+	return n;
+  802ddc:	89 f0                	mov    %esi,%eax
+}
+  802dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de1:	5b                   	pop    %ebx
+  802de2:	5e                   	pop    %esi
+  802de3:	5f                   	pop    %edi
+  802de4:	5d                   	pop    %ebp
+  802de5:	c3                   	ret
+		sys_futex_wake(pos, NENV);
+  802de6:	83 ec 08             	sub    $0x8,%esp
+  802de9:	68 00 04 00 00       	push   $0x400
+  802dee:	53                   	push   %ebx
+  802def:	e8 8e e3 ff ff       	call   801182 <sys_futex_wake>
+  802df4:	83 c4 10             	add    $0x10,%esp
+  802df7:	eb e3                	jmp    802ddc <devpipe_read+0xeb>
+			return 0;
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfe:	eb de                	jmp    802dde <devpipe_read+0xed>
+
+00802e00 <devpipe_write>:
+{
+  802e00:	55                   	push   %ebp
+  802e01:	89 e5                	mov    %esp,%ebp
+  802e03:	57                   	push   %edi
+  802e04:	56                   	push   %esi
+  802e05:	53                   	push   %ebx
+  802e06:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e09:	ff 75 08             	push   0x8(%ebp)
+  802e0c:	e8 c4 e3 ff ff       	call   8011d5 <fd2data>
+  802e11:	89 c6                	mov    %eax,%esi
+	for (i = 0; i < n; i += m) {
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e1d:	bf 81 80 80 80       	mov    $0x80808081,%edi
+	for (i = 0; i < n; i += m) {
+  802e22:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e26:	0f 84 43 01 00 00    	je     802f6f <devpipe_write+0x16f>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e2c:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e2f:	8b 06                	mov    (%esi),%eax
+  802e31:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e37:	29 c1                	sub    %eax,%ecx
+  802e39:	89 c8                	mov    %ecx,%eax
+  802e3b:	f7 e7                	mul    %edi
+  802e3d:	c1 ea 0c             	shr    $0xc,%edx
+  802e40:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e46:	29 d1                	sub    %edx,%ecx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802e48:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e4e:	75 52                	jne    802ea2 <devpipe_write+0xa2>
+			if (_pipeisclosed(fd, p))
+  802e50:	89 f2                	mov    %esi,%edx
+  802e52:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e55:	e8 a7 fd ff ff       	call   802c01 <_pipeisclosed>
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	0f 85 28 01 00 00    	jne    802f8a <devpipe_write+0x18a>
+			rpos = p->p_rpos;
+  802e62:	8b 1e                	mov    (%esi),%ebx
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802e64:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802e67:	8b 06                	mov    (%esi),%eax
+  802e69:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802e6f:	29 c1                	sub    %eax,%ecx
+  802e71:	89 c8                	mov    %ecx,%eax
+  802e73:	f7 e7                	mul    %edi
+  802e75:	c1 ea 0c             	shr    $0xc,%edx
+  802e78:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e7e:	29 d1                	sub    %edx,%ecx
+			if (pipe_count(p) == PIPEBUFSIZ)
+  802e80:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802e86:	75 a4                	jne    802e2c <devpipe_write+0x2c>
+  802e88:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e8d:	f0 87 46 0c          	lock xchg %eax,0xc(%esi)
+	sys_futex_wait(pos, val, ~0);
+  802e91:	83 ec 04             	sub    $0x4,%esp
+  802e94:	6a ff                	push   $0xffffffff
+  802e96:	53                   	push   %ebx
+  802e97:	56                   	push   %esi
+  802e98:	e8 c3 e2 ff ff       	call   801160 <sys_futex_wait>
+}
+  802e9d:	83 c4 10             	add    $0x10,%esp
+  802ea0:	eb 8a                	jmp    802e2c <devpipe_write+0x2c>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802ea2:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802ea5:	8b 06                	mov    (%esi),%eax
+  802ea7:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802ead:	29 c1                	sub    %eax,%ecx
+  802eaf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802eb4:	f7 e1                	mul    %ecx
+  802eb6:	c1 ea 0c             	shr    $0xc,%edx
+  802eb9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802ebf:	29 d1                	sub    %edx,%ecx
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802ec1:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802ec6:	89 d8                	mov    %ebx,%eax
+  802ec8:	29 c8                	sub    %ecx,%eax
+  802eca:	8b 55 10             	mov    0x10(%ebp),%edx
+  802ecd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ed0:	29 ca                	sub    %ecx,%edx
+  802ed2:	39 d0                	cmp    %edx,%eax
+  802ed4:	0f 46 d0             	cmovbe %eax,%edx
+  802ed7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+		j = p->p_wpos % PIPEBUFSIZ;
+  802eda:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802edd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ee2:	f7 e1                	mul    %ecx
+  802ee4:	c1 ea 0b             	shr    $0xb,%edx
+  802ee7:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802eed:	89 ca                	mov    %ecx,%edx
+  802eef:	29 c2                	sub    %eax,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802ef1:	29 d3                	sub    %edx,%ebx
+  802ef3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ef6:	39 c3                	cmp    %eax,%ebx
+  802ef8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(&p->p_buf[j], buf + i, k);
+  802efb:	83 ec 04             	sub    $0x4,%esp
+  802efe:	53                   	push   %ebx
+  802eff:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f02:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802f05:	51                   	push   %ecx
+  802f06:	8d 44 16 10          	lea    0x10(%esi,%edx,1),%eax
+  802f0a:	50                   	push   %eax
+  802f0b:	e8 ce db ff ff       	call   800ade <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f10:	83 c4 0c             	add    $0xc,%esp
+  802f13:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f16:	29 d8                	sub    %ebx,%eax
+  802f18:	50                   	push   %eax
+  802f19:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f1c:	01 cb                	add    %ecx,%ebx
+  802f1e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f21:	53                   	push   %ebx
+  802f22:	8d 46 10             	lea    0x10(%esi),%eax
+  802f25:	50                   	push   %eax
+  802f26:	e8 b3 db ff ff       	call   800ade <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2 * PIPEBUFSIZ);
+  802f2b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f2e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f31:	01 c1                	add    %eax,%ecx
+  802f33:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f38:	f7 e1                	mul    %ecx
+  802f3a:	c1 ea 0c             	shr    $0xc,%edx
+  802f3d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802f43:	89 ca                	mov    %ecx,%edx
+  802f45:	29 c2                	sub    %eax,%edx
+  802f47:	89 56 04             	mov    %edx,0x4(%esi)
+  802f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f4f:	f0 87 46 08          	lock xchg %eax,0x8(%esi)
+	if (xchg(waiting, 0))
+  802f53:	83 c4 10             	add    $0x10,%esp
+  802f56:	85 c0                	test   %eax,%eax
+  802f58:	75 1a                	jne    802f74 <devpipe_write+0x174>
+	for (i = 0; i < n; i += m) {
+  802f5a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  802f5d:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+  802f60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f63:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802f66:	0f 82 c0 fe ff ff    	jb     802e2c <devpipe_write+0x2c>
+  802f6c:	89 45 10             	mov    %eax,0x10(%ebp)
+	return i;
+  802f6f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f72:	eb 1b                	jmp    802f8f <devpipe_write+0x18f>
+		sys_futex_wake(pos, NENV);
+  802f74:	83 ec 08             	sub    $0x8,%esp
+  802f77:	68 00 04 00 00       	push   $0x400
+		pipe_notify(&p->p_wpos, &p->p_rwait);
+  802f7c:	8d 46 04             	lea    0x4(%esi),%eax
+		sys_futex_wake(pos, NENV);
+  802f7f:	50                   	push   %eax
+  802f80:	e8 fd e1 ff ff       	call   801182 <sys_futex_wake>
+  802f85:	83 c4 10             	add    $0x10,%esp
+  802f88:	eb d0                	jmp    802f5a <devpipe_write+0x15a>
+				return 0;
+  802f8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f92:	5b                   	pop    %ebx
+  802f93:	5e                   	pop    %esi
+  802f94:	5f                   	pop    %edi
+  802f95:	5d                   	pop    %ebp
+  802f96:	c3                   	ret
+
+00802f97 <devpipe_stat>:
+{
+  802f97:	55                   	push   %ebp
+  802f98:	89 e5                	mov    %esp,%ebp
+  802f9a:	56                   	push   %esi
+  802f9b:	53                   	push   %ebx
+  802f9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802f9f:	83 ec 0c             	sub    $0xc,%esp
+  802fa2:	ff 75 08             	push   0x8(%ebp)
+  802fa5:	e8 2b e2 ff ff       	call   8011d5 <fd2data>
+  802faa:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fac:	83 c4 08             	add    $0x8,%esp
+  802faf:	68 12 40 80 00       	push   $0x804012
+  802fb4:	53                   	push   %ebx
+  802fb5:	e8 74 d9 ff ff       	call   80092e <strcpy>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  802fba:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802fbd:	8b 06                	mov    (%esi),%eax
+  802fbf:	81 c1 e0 1f 00 00    	add    $0x1fe0,%ecx
+  802fc5:	29 c1                	sub    %eax,%ecx
+  802fc7:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802fcc:	89 c8                	mov    %ecx,%eax
+  802fce:	f7 e2                	mul    %edx
+  802fd0:	c1 ea 0c             	shr    $0xc,%edx
+  802fd3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802fd9:	29 d1                	sub    %edx,%ecx
+  802fdb:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fe1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fe8:	00 00 00 
+	stat->st_dev = &devpipe;
+  802feb:	c7 83 8c 00 00 00 60 	movl   $0x805060,0x8c(%ebx)
+  802ff2:	50 80 00 
+}
+  802ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ffd:	5b                   	pop    %ebx
+  802ffe:	5e                   	pop    %esi
+  802fff:	5d                   	pop    %ebp
+  803000:	c3                   	ret
+
+00803001 <devpipe_poll>:
+{
+  803001:	55                   	push   %ebp
+  803002:	89 e5                	mov    %esp,%ebp
+  803004:	57                   	push   %edi
+  803005:	56                   	push   %esi
+  803006:	53                   	push   %ebx
+  803007:	83 ec 18             	sub    $0x18,%esp
+  80300a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80300d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803010:	57                   	push   %edi
+  803011:	e8 bf e1 ff ff       	call   8011d5 <fd2data>
+  803016:	89 c1                	mov    %eax,%ecx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	89 f3                	mov    %esi,%ebx
+  80301d:	83 e3 01             	and    $0x1,%ebx
+  803020:	75 27                	jne    803049 <devpipe_poll+0x48>
+	if ((events & POLLOUT) && pipe_count(p) < PIPEBUFSIZ)
+  803022:	f7 c6 04 00 00 00    	test   $0x4,%esi
+  803028:	75 48                	jne    803072 <devpipe_poll+0x71>
+	if (_pipeisclosed(fd, p))
+  80302a:	89 ca                	mov    %ecx,%edx
+  80302c:	89 f8                	mov    %edi,%eax
+  80302e:	e8 ce fb ff ff       	call   802c01 <_pipeisclosed>
+  803033:	89 c2                	mov    %eax,%edx
+		revents |= POLLHUP;
+  803035:	89 d8                	mov    %ebx,%eax
+  803037:	83 c8 10             	or     $0x10,%eax
+  80303a:	85 d2                	test   %edx,%edx
+  80303c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  80303f:	89 d8                	mov    %ebx,%eax
+  803041:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803044:	5b                   	pop    %ebx
+  803045:	5e                   	pop    %esi
+  803046:	5f                   	pop    %edi
+  803047:	5d                   	pop    %ebp
+  803048:	c3                   	ret
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803049:	8b 58 04             	mov    0x4(%eax),%ebx
+  80304c:	8b 00                	mov    (%eax),%eax
+  80304e:	81 c3 e0 1f 00 00    	add    $0x1fe0,%ebx
+  803054:	29 c3                	sub    %eax,%ebx
+  803056:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80305b:	89 d8                	mov    %ebx,%eax
+  80305d:	f7 e2                	mul    %edx
+  80305f:	c1 ea 0c             	shr    $0xc,%edx
+  803062:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+	if ((events & POLLIN) && pipe_count(p) > 0)
+  803068:	39 d3                	cmp    %edx,%ebx
+  80306a:	0f 95 c3             	setne  %bl
+  80306d:	0f b6 db             	movzbl %bl,%ebx
+  803070:	eb b0                	jmp    803022 <devpipe_poll+0x21>
+	return (p->p_wpos - p->p_rpos + 2 * PIPEBUFSIZ) % (2 * PIPEBUFSIZ);
+  803072:	8b 71 04             	mov    0x4(%ecx),%esi
+  803075:	8b 01                	mov    (%ecx),%eax
+  803077:	81 c6 e0 1f 00 00    	add    $0x1fe0,%esi
+  80307d:	29 c6                	sub    %eax,%esi
+  80307f:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  803084:	89 f0                	mov    %esi,%eax
+  803086:	f7 e2                	mul    %edx
+  803088:	c1 ea 0c             	shr    $0xc,%edx
+  80308b:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  803091:	29 d6                	sub    %edx,%esi
+		revents |= POLLOUT;
+  803093:	89 d8                	mov    %ebx,%eax
+  803095:	83 c8 04             	or     $0x4,%eax
+  803098:	81 fe f0 0f 00 00    	cmp    $0xff0,%esi
+  80309e:	0f 42 d8             	cmovb  %eax,%ebx
+  8030a1:	eb 87                	jmp    80302a <devpipe_poll+0x29>
+
+008030a3 <pipe>:
+{
+  8030a3:	55                   	push   %ebp
+  8030a4:	89 e5                	mov    %esp,%ebp
+  8030a6:	56                   	push   %esi
+  8030a7:	53                   	push   %ebx
+  8030a8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8030ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8030ae:	50                   	push   %eax
+  8030af:	e8 38 e1 ff ff       	call   8011ec <fd_alloc>
+  8030b4:	89 c3                	mov    %eax,%ebx
+  8030b6:	83 c4 10             	add    $0x10,%esp
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	0f 88 23 01 00 00    	js     8031e4 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030c1:	83 ec 04             	sub    $0x4,%esp
+  8030c4:	68 07 04 00 00       	push   $0x407
+  8030c9:	ff 75 f4             	push   -0xc(%ebp)
+  8030cc:	6a 00                	push   $0x0
+  8030ce:	e8 8f dc ff ff       	call   800d62 <sys_page_alloc>
+  8030d3:	89 c3                	mov    %eax,%ebx
+  8030d5:	83 c4 10             	add    $0x10,%esp
+  8030d8:	85 c0                	test   %eax,%eax
+  8030da:	0f 88 04 01 00 00    	js     8031e4 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8030e0:	83 ec 0c             	sub    $0xc,%esp
+  8030e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8030e6:	50                   	push   %eax
+  8030e7:	e8 00 e1 ff ff       	call   8011ec <fd_alloc>
+  8030ec:	89 c3                	mov    %eax,%ebx
+  8030ee:	83 c4 10             	add    $0x10,%esp
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	0f 88 db 00 00 00    	js     8031d4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8030f9:	83 ec 04             	sub    $0x4,%esp
+  8030fc:	68 07 04 00 00       	push   $0x407
+  803101:	ff 75 f0             	push   -0x10(%ebp)
+  803104:	6a 00                	push   $0x0
+  803106:	e8 57 dc ff ff       	call   800d62 <sys_page_alloc>
+  80310b:	89 c3                	mov    %eax,%ebx
+  80310d:	83 c4 10             	add    $0x10,%esp
+  803110:	85 c0                	test   %eax,%eax
+  803112:	0f 88 bc 00 00 00    	js     8031d4 <pipe+0x131>
+	va = fd2data(fd0);
+  803118:	83 ec 0c             	sub    $0xc,%esp
+  80311b:	ff 75 f4             	push   -0xc(%ebp)
+  80311e:	e8 b2 e0 ff ff       	call   8011d5 <fd2data>
+  803123:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803125:	83 c4 0c             	add    $0xc,%esp
+  803128:	68 07 04 00 00       	push   $0x407
+  80312d:	50                   	push   %eax
+  80312e:	6a 00                	push   $0x0
+  803130:	e8 2d dc ff ff       	call   800d62 <sys_page_alloc>
+  803135:	89 c3                	mov    %eax,%ebx
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	85 c0                	test   %eax,%eax
+  80313c:	0f 88 82 00 00 00    	js     8031c4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803142:	83 ec 0c             	sub    $0xc,%esp
+  803145:	ff 75 f0             	push   -0x10(%ebp)
+  803148:	e8 88 e0 ff ff       	call   8011d5 <fd2data>
+  80314d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803154:	50                   	push   %eax
+  803155:	6a 00                	push   $0x0
+  803157:	56                   	push   %esi
+  803158:	6a 00                	push   $0x0
+  80315a:	e8 46 dc ff ff       	call   800da5 <sys_page_map>
+  80315f:	89 c3                	mov    %eax,%ebx
+  803161:	83 c4 20             	add    $0x20,%esp
+  803164:	85 c0                	test   %eax,%eax
+  803166:	78 4e                	js     8031b6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803168:	a1 60 50 80 00       	mov    0x805060,%eax
+  80316d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803170:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803172:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803175:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80317c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80317f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803181:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803184:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  80318b:	83 ec 0c             	sub    $0xc,%esp
+  80318e:	ff 75 f4             	push   -0xc(%ebp)
+  803191:	e8 2f e0 ff ff       	call   8011c5 <fd2num>
+  803196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803199:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  80319b:	83 c4 04             	add    $0x4,%esp
+  80319e:	ff 75 f0             	push   -0x10(%ebp)
+  8031a1:	e8 1f e0 ff ff       	call   8011c5 <fd2num>
+  8031a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8031a9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8031ac:	83 c4 10             	add    $0x10,%esp
+  8031af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031b4:	eb 2e                	jmp    8031e4 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8031b6:	83 ec 08             	sub    $0x8,%esp
+  8031b9:	56                   	push   %esi
+  8031ba:	6a 00                	push   $0x0
+  8031bc:	e8 26 dc ff ff       	call   800de7 <sys_page_unmap>
+  8031c1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8031c4:	83 ec 08             	sub    $0x8,%esp
+  8031c7:	ff 75 f0             	push   -0x10(%ebp)
+  8031ca:	6a 00                	push   $0x0
+  8031cc:	e8 16 dc ff ff       	call   800de7 <sys_page_unmap>
+  8031d1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8031d4:	83 ec 08             	sub    $0x8,%esp
+  8031d7:	ff 75 f4             	push   -0xc(%ebp)
+  8031da:	6a 00                	push   $0x0
+  8031dc:	e8 06 dc ff ff       	call   800de7 <sys_page_unmap>
+  8031e1:	83 c4 10             	add    $0x10,%esp
+}
+  8031e4:	89 d8                	mov    %ebx,%eax
+  8031e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031e9:	5b                   	pop    %ebx
+  8031ea:	5e                   	pop    %esi
+  8031eb:	5d                   	pop    %ebp
+  8031ec:	c3                   	ret
+
+008031ed <pipeisclosed>:
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031f6:	50                   	push   %eax
+  8031f7:	ff 75 08             	push   0x8(%ebp)
+  8031fa:	e8 3d e0 ff ff       	call   80123c <fd_lookup>
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 18                	js     80321e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803206:	83 ec 0c             	sub    $0xc,%esp
+  803209:	ff 75 f4             	push   -0xc(%ebp)
+  80320c:	e8 c4 df ff ff       	call   8011d5 <fd2data>
+  803211:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803213:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803216:	e8 e6 f9 ff ff       	call   802c01 <_pipeisclosed>
+  80321b:	83 c4 10             	add    $0x10,%esp
+}
+  80321e:	c9                   	leave
+  80321f:	c3                   	ret
+
+00803220 <pgbatch_init>:
+
+#include <inc/lib.h>
+
+void
+pgbatch_init(struct PageBatch *pb)
+{
+  803220:	55                   	push   %ebp
+  803221:	89 e5                	mov    %esp,%ebp
+	pb->pb_n = 0;
+  803223:	8b 45 08             	mov    0x8(%ebp),%eax
+  803226:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80322c:	5d                   	pop    %ebp
+  80322d:	c3                   	ret
+
+0080322e <pgbatch_flush>:
+// Hand all queued operations to the kernel and empty the batch.
+// Returns 0 on success, or the error of the first operation that failed;
+// in that case the operations after it have not been executed.
+int
+pgbatch_flush(struct PageBatch *pb)
+{
+  80322e:	55                   	push   %ebp
+  80322f:	89 e5                	mov    %esp,%ebp
+  803231:	53                   	push   %ebx
+  803232:	83 ec 04             	sub    $0x4,%esp
+  803235:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if (pb->pb_n == 0)
+  803238:	8b 03                	mov    (%ebx),%eax
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	75 05                	jne    803243 <pgbatch_flush+0x15>
+		return 0;
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+	pb->pb_n = 0;
+	return r;
+}
+  80323e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803241:	c9                   	leave
+  803242:	c3                   	ret
+	r = sys_page_batch(pb->pb_ops, pb->pb_n);
+  803243:	83 ec 08             	sub    $0x8,%esp
+  803246:	50                   	push   %eax
+  803247:	8d 43 04             	lea    0x4(%ebx),%eax
+  80324a:	50                   	push   %eax
+  80324b:	e8 e7 dd ff ff       	call   801037 <sys_page_batch>
+	pb->pb_n = 0;
+  803250:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r;
+  803256:	83 c4 10             	add    $0x10,%esp
+  803259:	eb e3                	jmp    80323e <pgbatch_flush+0x10>
+
+0080325b <pgbatch_slot>:
+
+// Reserve the next slot, flushing first if the batch is full.
+static int
+pgbatch_slot(struct PageBatch *pb, struct PageOp **po)
+{
+  80325b:	55                   	push   %ebp
+  80325c:	89 e5                	mov    %esp,%ebp
+  80325e:	56                   	push   %esi
+  80325f:	53                   	push   %ebx
+  803260:	89 c3                	mov    %eax,%ebx
+  803262:	89 d6                	mov    %edx,%esi
+	int r;
+
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803264:	83 38 20             	cmpl   $0x20,(%eax)
+  803267:	74 2c                	je     803295 <pgbatch_slot+0x3a>
+		return r;
+	*po = &pb->pb_ops[pb->pb_n++];
+  803269:	8b 03                	mov    (%ebx),%eax
+  80326b:	8d 50 01             	lea    0x1(%eax),%edx
+  80326e:	89 13                	mov    %edx,(%ebx)
+  803270:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803273:	8d 44 c3 04          	lea    0x4(%ebx,%eax,8),%eax
+  803277:	89 06                	mov    %eax,(%esi)
+	memset(*po, 0, sizeof(**po));
+  803279:	83 ec 04             	sub    $0x4,%esp
+  80327c:	6a 18                	push   $0x18
+  80327e:	6a 00                	push   $0x0
+  803280:	50                   	push   %eax
+  803281:	e8 23 d8 ff ff       	call   800aa9 <memset>
+	return 0;
+  803286:	83 c4 10             	add    $0x10,%esp
+  803289:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803291:	5b                   	pop    %ebx
+  803292:	5e                   	pop    %esi
+  803293:	5d                   	pop    %ebp
+  803294:	c3                   	ret
+	if (pb->pb_n == PGBATCH_MAX && (r = pgbatch_flush(pb)) < 0)
+  803295:	83 ec 0c             	sub    $0xc,%esp
+  803298:	50                   	push   %eax
+  803299:	e8 90 ff ff ff       	call   80322e <pgbatch_flush>
+  80329e:	83 c4 10             	add    $0x10,%esp
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	79 c4                	jns    803269 <pgbatch_slot+0xe>
+  8032a5:	eb e7                	jmp    80328e <pgbatch_slot+0x33>
+
+008032a7 <pgbatch_alloc>:
+
+int
+pgbatch_alloc(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  8032a7:	55                   	push   %ebp
+  8032a8:	89 e5                	mov    %esp,%ebp
+  8032aa:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032ad:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b3:	e8 a3 ff ff ff       	call   80325b <pgbatch_slot>
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	78 20                	js     8032dc <pgbatch_alloc+0x35>
+		return r;
+	po->po_op = PAGEOP_ALLOC;
+  8032bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032bf:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+	po->po_dstenv = env;
+  8032c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032c8:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  8032cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  8032ce:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  8032d1:	8b 55 14             	mov    0x14(%ebp),%edx
+  8032d4:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8032d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032dc:	c9                   	leave
+  8032dd:	c3                   	ret
+
+008032de <pgbatch_map>:
+
+int
+pgbatch_map(struct PageBatch *pb, envid_t src_env, void *src_pg,
+	    envid_t dst_env, void *dst_pg, int perm)
+{
+  8032de:	55                   	push   %ebp
+  8032df:	89 e5                	mov    %esp,%ebp
+  8032e1:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  8032e4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8032e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ea:	e8 6c ff ff ff       	call   80325b <pgbatch_slot>
+  8032ef:	85 c0                	test   %eax,%eax
+  8032f1:	78 2c                	js     80331f <pgbatch_map+0x41>
+		return r;
+	po->po_op = PAGEOP_MAP;
+  8032f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032f6:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+	po->po_srcenv = src_env;
+  8032fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8032ff:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = src_pg;
+  803302:	8b 55 10             	mov    0x10(%ebp),%edx
+  803305:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  803308:	8b 55 14             	mov    0x14(%ebp),%edx
+  80330b:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = dst_pg;
+  80330e:	8b 55 18             	mov    0x18(%ebp),%edx
+  803311:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  803314:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  803317:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  80331a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80331f:	c9                   	leave
+  803320:	c3                   	ret
+
+00803321 <pgbatch_unmap>:
+
+int
+pgbatch_unmap(struct PageBatch *pb, envid_t env, void *pg)
+{
+  803321:	55                   	push   %ebp
+  803322:	89 e5                	mov    %esp,%ebp
+  803324:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803327:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80332a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80332d:	e8 29 ff ff ff       	call   80325b <pgbatch_slot>
+  803332:	85 c0                	test   %eax,%eax
+  803334:	78 1a                	js     803350 <pgbatch_unmap+0x2f>
+		return r;
+	po->po_op = PAGEOP_UNMAP;
+  803336:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803339:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+	po->po_dstenv = env;
+  80333f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803342:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803345:	8b 55 10             	mov    0x10(%ebp),%edx
+  803348:	89 50 10             	mov    %edx,0x10(%eax)
+	return 0;
+  80334b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803350:	c9                   	leave
+  803351:	c3                   	ret
+
+00803352 <pgbatch_protect>:
+
+int
+pgbatch_protect(struct PageBatch *pb, envid_t env, void *pg, int perm)
+{
+  803352:	55                   	push   %ebp
+  803353:	89 e5                	mov    %esp,%ebp
+  803355:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  803358:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80335b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335e:	e8 f8 fe ff ff       	call   80325b <pgbatch_slot>
+  803363:	85 c0                	test   %eax,%eax
+  803365:	78 20                	js     803387 <pgbatch_protect+0x35>
+		return r;
+	po->po_op = PAGEOP_PROTECT;
+  803367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80336a:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+	po->po_dstenv = env;
+  803370:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803373:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_dstva = pg;
+  803376:	8b 55 10             	mov    0x10(%ebp),%edx
+  803379:	89 50 10             	mov    %edx,0x10(%eax)
+	po->po_perm = perm;
+  80337c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80337f:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  803382:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803387:	c9                   	leave
+  803388:	c3                   	ret
+
+00803389 <pgbatch_sharept>:
+
+int
+pgbatch_sharept(struct PageBatch *pb, envid_t src_env, void *va,
+		envid_t dst_env, int cowbits)
+{
+  803389:	55                   	push   %ebp
+  80338a:	89 e5                	mov    %esp,%ebp
+  80338c:	83 ec 18             	sub    $0x18,%esp
+	struct PageOp *po;
+	int r;
+
+	if ((r = pgbatch_slot(pb, &po)) < 0)
+  80338f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803392:	8b 45 08             	mov    0x8(%ebp),%eax
+  803395:	e8 c1 fe ff ff       	call   80325b <pgbatch_slot>
+  80339a:	85 c0                	test   %eax,%eax
+  80339c:	78 26                	js     8033c4 <pgbatch_sharept+0x3b>
+		return r;
+	po->po_op = PAGEOP_SHAREPT;
+  80339e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033a1:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	po->po_srcenv = src_env;
+  8033a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8033aa:	89 50 04             	mov    %edx,0x4(%eax)
+	po->po_srcva = va;
+  8033ad:	8b 55 10             	mov    0x10(%ebp),%edx
+  8033b0:	89 50 08             	mov    %edx,0x8(%eax)
+	po->po_dstenv = dst_env;
+  8033b3:	8b 55 14             	mov    0x14(%ebp),%edx
+  8033b6:	89 50 0c             	mov    %edx,0xc(%eax)
+	po->po_perm = cowbits;
+  8033b9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8033bc:	89 50 14             	mov    %edx,0x14(%eax)
+	return 0;
+  8033bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033c4:	c9                   	leave
+  8033c5:	c3                   	ret
+
+008033c6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cb:	c3                   	ret
+
+008033cc <devcons_poll>:
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	53                   	push   %ebx
+  8033d0:	83 ec 04             	sub    $0x4,%esp
+  8033d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033d6:	89 da                	mov    %ebx,%edx
+  8033d8:	83 e2 04             	and    $0x4,%edx
+	if (cons_peek == 0)
+  8033db:	83 3d 34 63 80 00 00 	cmpl   $0x0,0x806334
+  8033e2:	74 0c                	je     8033f0 <devcons_poll+0x24>
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033e4:	89 d8                	mov    %ebx,%eax
+  8033e6:	83 e0 01             	and    $0x1,%eax
+  8033e9:	09 d0                	or     %edx,%eax
+}
+  8033eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ee:	c9                   	leave
+  8033ef:	c3                   	ret
+		cons_peek = sys_cgetc();
+  8033f0:	e8 cf d8 ff ff       	call   800cc4 <sys_cgetc>
+  8033f5:	a3 34 63 80 00       	mov    %eax,0x806334
+	return (events & POLLOUT) | (cons_peek != 0 ? events & POLLIN : 0);
+  8033fa:	89 da                	mov    %ebx,%edx
+  8033fc:	83 e2 04             	and    $0x4,%edx
+  8033ff:	85 c0                	test   %eax,%eax
+  803401:	74 e6                	je     8033e9 <devcons_poll+0x1d>
+  803403:	eb df                	jmp    8033e4 <devcons_poll+0x18>
+
+00803405 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803405:	55                   	push   %ebp
+  803406:	89 e5                	mov    %esp,%ebp
+  803408:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80340b:	68 1e 40 80 00       	push   $0x80401e
+  803410:	ff 75 0c             	push   0xc(%ebp)
+  803413:	e8 16 d5 ff ff       	call   80092e <strcpy>
+	return 0;
+}
+  803418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80341d:	c9                   	leave
+  80341e:	c3                   	ret
+
+0080341f <devcons_write>:
+{
+  80341f:	55                   	push   %ebp
+  803420:	89 e5                	mov    %esp,%ebp
+  803422:	57                   	push   %edi
+  803423:	56                   	push   %esi
+  803424:	53                   	push   %ebx
+  803425:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  80342b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80342e:	85 ff                	test   %edi,%edi
+  803430:	74 51                	je     803483 <devcons_write+0x64>
+  803432:	be 00 00 00 00       	mov    $0x0,%esi
+  803437:	b8 00 00 00 00       	mov    $0x0,%eax
+		m = n - tot;
+  80343c:	89 fb                	mov    %edi,%ebx
+  80343e:	29 c3                	sub    %eax,%ebx
+		if (m > sizeof(buf) - 1)
+  803440:	ba 7f 00 00 00       	mov    $0x7f,%edx
+  803445:	39 d3                	cmp    %edx,%ebx
+  803447:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80344a:	83 ec 04             	sub    $0x4,%esp
+  80344d:	53                   	push   %ebx
+  80344e:	03 45 0c             	add    0xc(%ebp),%eax
+  803451:	50                   	push   %eax
+  803452:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803458:	50                   	push   %eax
+  803459:	e8 80 d6 ff ff       	call   800ade <memmove>
+		sys_cputs(buf, m);
+  80345e:	83 c4 08             	add    $0x8,%esp
+  803461:	53                   	push   %ebx
+  803462:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  803468:	50                   	push   %eax
+  803469:	e8 38 d8 ff ff       	call   800ca6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80346e:	01 de                	add    %ebx,%esi
+  803470:	89 f0                	mov    %esi,%eax
+  803472:	83 c4 10             	add    $0x10,%esp
+  803475:	39 fe                	cmp    %edi,%esi
+  803477:	72 c3                	jb     80343c <devcons_write+0x1d>
+}
+  803479:	89 f0                	mov    %esi,%eax
+  80347b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80347e:	5b                   	pop    %ebx
+  80347f:	5e                   	pop    %esi
+  803480:	5f                   	pop    %edi
+  803481:	5d                   	pop    %ebp
+  803482:	c3                   	ret
+	for (tot = 0; tot < n; tot += m) {
+  803483:	be 00 00 00 00       	mov    $0x0,%esi
+	return tot;
+  803488:	eb ef                	jmp    803479 <devcons_write+0x5a>
+
+0080348a <devcons_read>:
+{
+  80348a:	55                   	push   %ebp
+  80348b:	89 e5                	mov    %esp,%ebp
+  80348d:	83 ec 08             	sub    $0x8,%esp
+		return 0;
+  803490:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (n == 0)
+  803495:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803499:	74 36                	je     8034d1 <devcons_read+0x47>
+	c = cons_peek;
+  80349b:	a1 34 63 80 00       	mov    0x806334,%eax
+	cons_peek = 0;
+  8034a0:	c7 05 34 63 80 00 00 	movl   $0x0,0x806334
+  8034a7:	00 00 00 
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034aa:	85 c0                	test   %eax,%eax
+  8034ac:	75 10                	jne    8034be <devcons_read+0x34>
+  8034ae:	e8 11 d8 ff ff       	call   800cc4 <sys_cgetc>
+  8034b3:	85 c0                	test   %eax,%eax
+  8034b5:	75 07                	jne    8034be <devcons_read+0x34>
+		sys_yield();
+  8034b7:	e8 87 d8 ff ff       	call   800d43 <sys_yield>
+	while (c == 0 && (c = sys_cgetc()) == 0)
+  8034bc:	eb f0                	jmp    8034ae <devcons_read+0x24>
+	if (c < 0)
+  8034be:	85 c0                	test   %eax,%eax
+  8034c0:	78 0f                	js     8034d1 <devcons_read+0x47>
+	if (c == 0x04)	// ctl-d is eof
+  8034c2:	83 f8 04             	cmp    $0x4,%eax
+  8034c5:	74 0c                	je     8034d3 <devcons_read+0x49>
+	*(char*)vbuf = c;
+  8034c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034ca:	88 02                	mov    %al,(%edx)
+	return 1;
+  8034cc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034d1:	c9                   	leave
+  8034d2:	c3                   	ret
+		return 0;
+  8034d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d8:	eb f7                	jmp    8034d1 <devcons_read+0x47>
+
+008034da <cputchar>:
+{
+  8034da:	55                   	push   %ebp
+  8034db:	89 e5                	mov    %esp,%ebp
+  8034dd:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8034e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e3:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8034e6:	6a 01                	push   $0x1
+  8034e8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034eb:	50                   	push   %eax
+  8034ec:	e8 b5 d7 ff ff       	call   800ca6 <sys_cputs>
+}
+  8034f1:	83 c4 10             	add    $0x10,%esp
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+
+008034f6 <getchar>:
+{
+  8034f6:	55                   	push   %ebp
+  8034f7:	89 e5                	mov    %esp,%ebp
+  8034f9:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8034fc:	6a 01                	push   $0x1
+  8034fe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803501:	50                   	push   %eax
+  803502:	6a 00                	push   $0x0
+  803504:	e8 b7 df ff ff       	call   8014c0 <read>
+	if (r < 0)
+  803509:	83 c4 10             	add    $0x10,%esp
+  80350c:	85 c0                	test   %eax,%eax
+  80350e:	78 06                	js     803516 <getchar+0x20>
+	if (r < 1)
+  803510:	74 06                	je     803518 <getchar+0x22>
+	return c;
+  803512:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803516:	c9                   	leave
+  803517:	c3                   	ret
+		return -E_EOF;
+  803518:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80351d:	eb f7                	jmp    803516 <getchar+0x20>
+
+0080351f <iscons>:
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803525:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803528:	50                   	push   %eax
+  803529:	ff 75 08             	push   0x8(%ebp)
+  80352c:	e8 0b dd ff ff       	call   80123c <fd_lookup>
+  803531:	83 c4 10             	add    $0x10,%esp
+  803534:	85 c0                	test   %eax,%eax
+  803536:	78 11                	js     803549 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803538:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80353b:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803541:	39 10                	cmp    %edx,(%eax)
+  803543:	0f 94 c0             	sete   %al
+  803546:	0f b6 c0             	movzbl %al,%eax
+}
+  803549:	c9                   	leave
+  80354a:	c3                   	ret
+
+0080354b <opencons>:
+{
+  80354b:	55                   	push   %ebp
+  80354c:	89 e5                	mov    %esp,%ebp
+  80354e:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803551:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803554:	50                   	push   %eax
+  803555:	e8 92 dc ff ff       	call   8011ec <fd_alloc>
+  80355a:	83 c4 10             	add    $0x10,%esp
+  80355d:	85 c0                	test   %eax,%eax
+  80355f:	78 3a                	js     80359b <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803561:	83 ec 04             	sub    $0x4,%esp
+  803564:	68 07 04 00 00       	push   $0x407
+  803569:	ff 75 f4             	push   -0xc(%ebp)
+  80356c:	6a 00                	push   $0x0
+  80356e:	e8 ef d7 ff ff       	call   800d62 <sys_page_alloc>
+  803573:	83 c4 10             	add    $0x10,%esp
+  803576:	85 c0                	test   %eax,%eax
+  803578:	78 21                	js     80359b <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  80357a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357d:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803583:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803588:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80358f:	83 ec 0c             	sub    $0xc,%esp
+  803592:	50                   	push   %eax
+  803593:	e8 2d dc ff ff       	call   8011c5 <fd2num>
+  803598:	83 c4 10             	add    $0x10,%esp
+}
+  80359b:	c9                   	leave
+  80359c:	c3                   	ret
+
+0080359d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80359d:	55                   	push   %ebp
+  80359e:	89 e5                	mov    %esp,%ebp
+  8035a0:	56                   	push   %esi
+  8035a1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8035a2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8035a5:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8035ab:	e8 74 d7 ff ff       	call   800d24 <sys_getenvid>
+  8035b0:	83 ec 0c             	sub    $0xc,%esp
+  8035b3:	ff 75 0c             	push   0xc(%ebp)
+  8035b6:	ff 75 08             	push   0x8(%ebp)
+  8035b9:	56                   	push   %esi
+  8035ba:	50                   	push   %eax
+  8035bb:	68 2c 40 80 00       	push   $0x80402c
+  8035c0:	e8 72 cc ff ff       	call   800237 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8035c5:	83 c4 18             	add    $0x18,%esp
+  8035c8:	53                   	push   %ebx
+  8035c9:	ff 75 10             	push   0x10(%ebp)
+  8035cc:	e8 15 cc ff ff       	call   8001e6 <vcprintf>
+	cprintf("\n");
+  8035d1:	c7 04 24 10 40 80 00 	movl   $0x804010,(%esp)
+  8035d8:	e8 5a cc ff ff       	call   800237 <cprintf>
+  8035dd:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8035e0:	cc                   	int3
+	while (1)
+  8035e1:	eb fd                	jmp    8035e0 <_panic+0x43>
+
+008035e3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8035e3:	55                   	push   %ebp
+  8035e4:	89 e5                	mov    %esp,%ebp
+  8035e6:	56                   	push   %esi
+  8035e7:	53                   	push   %ebx
+  8035e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8035eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int ret;
+	void* addr;
+	if(pg == NULL)
+		addr = (void*)USTACKTOP;
+  8035f1:	85 c0                	test   %eax,%eax
+  8035f3:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8035f8:	0f 44 c2             	cmove  %edx,%eax
+	else
+		addr = pg;
+	if((ret = sys_ipc_recv(addr)) < 0) {
+  8035fb:	83 ec 0c             	sub    $0xc,%esp
+  8035fe:	50                   	push   %eax
+  8035ff:	e8 0e d9 ff ff       	call   800f12 <sys_ipc_recv>
+  803604:	83 c4 10             	add    $0x10,%esp
+  803607:	85 c0                	test   %eax,%eax
+  803609:	0f 88 8b 00 00 00    	js     80369a <ipc_recv+0xb7>
+			*from_env_store = 0;
+		if(perm_store != NULL)
+			*perm_store = 0;
+		return ret;
+	}
+	if(from_env_store != NULL)
+  80360f:	85 f6                	test   %esi,%esi
+  803611:	74 2a                	je     80363d <ipc_recv+0x5a>
+        __asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803613:	89 e2                	mov    %esp,%edx
+  803615:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80361a:	29 d0                	sub    %edx,%eax
+  80361c:	89 c2                	mov    %eax,%edx
+  80361e:	c1 ea 0f             	shr    $0xf,%edx
+  803621:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362b:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  80362e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803635:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80363b:	89 06                	mov    %eax,(%esi)
+	if(perm_store != NULL)
+  80363d:	85 db                	test   %ebx,%ebx
+  80363f:	74 2a                	je     80366b <ipc_recv+0x88>
+  803641:	89 e2                	mov    %esp,%edx
+  803643:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803648:	29 d0                	sub    %edx,%eax
+  80364a:	89 c2                	mov    %eax,%edx
+  80364c:	c1 ea 0f             	shr    $0xf,%edx
+  80364f:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803654:	b8 00 00 00 00       	mov    $0x0,%eax
+  803659:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  80365c:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803663:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  803669:	89 03                	mov    %eax,(%ebx)
+  80366b:	89 e2                	mov    %esp,%edx
+  80366d:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803672:	29 d0                	sub    %edx,%eax
+  803674:	89 c2                	mov    %eax,%edx
+  803676:	c1 ea 0f             	shr    $0xf,%edx
+  803679:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80367e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803683:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803686:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80368d:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+//	panic("ipc_recv not implemented");
+//	return 0;
+}
+  803693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803696:	5b                   	pop    %ebx
+  803697:	5e                   	pop    %esi
+  803698:	5d                   	pop    %ebp
+  803699:	c3                   	ret
+		if(from_env_store != NULL)
+  80369a:	85 f6                	test   %esi,%esi
+  80369c:	74 06                	je     8036a4 <ipc_recv+0xc1>
+			*from_env_store = 0;
+  80369e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if(perm_store != NULL)
+  8036a4:	85 db                	test   %ebx,%ebx
+  8036a6:	74 eb                	je     803693 <ipc_recv+0xb0>
+			*perm_store = 0;
+  8036a8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8036ae:	eb e3                	jmp    803693 <ipc_recv+0xb0>
+
+008036b0 <ipc_recv_pages>:
+// Like ipc_recv, but accept up to 'maxpages' consecutive pages at 'pg'
+// and store how many arrived in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, int maxpages,
+	       int *perm_store, int *npages_store)
+{
+  8036b0:	55                   	push   %ebp
+  8036b1:	89 e5                	mov    %esp,%ebp
+  8036b3:	57                   	push   %edi
+  8036b4:	56                   	push   %esi
+  8036b5:	53                   	push   %ebx
+  8036b6:	83 ec 14             	sub    $0x14,%esp
+  8036b9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8036bf:	8b 75 14             	mov    0x14(%ebp),%esi
+  8036c2:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int ret;
+
+	if ((ret = sys_ipc_recv_pages(pg ? pg : (void *) USTACKTOP, maxpages)) < 0) {
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	ba 00 e0 bf ee       	mov    $0xeebfe000,%edx
+  8036cc:	0f 44 c2             	cmove  %edx,%eax
+  8036cf:	ff 75 10             	push   0x10(%ebp)
+  8036d2:	50                   	push   %eax
+  8036d3:	e8 9c d8 ff ff       	call   800f74 <sys_ipc_recv_pages>
+  8036d8:	83 c4 10             	add    $0x10,%esp
+  8036db:	85 c0                	test   %eax,%eax
+  8036dd:	0f 88 ba 00 00 00    	js     80379d <ipc_recv_pages+0xed>
+			*perm_store = 0;
+		if (npages_store)
+			*npages_store = 0;
+		return ret;
+	}
+	if (from_env_store)
+  8036e3:	85 ff                	test   %edi,%edi
+  8036e5:	74 2a                	je     803711 <ipc_recv_pages+0x61>
+  8036e7:	89 e2                	mov    %esp,%edx
+  8036e9:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8036ee:	29 d0                	sub    %edx,%eax
+  8036f0:	89 c2                	mov    %eax,%edx
+  8036f2:	c1 ea 0f             	shr    $0xf,%edx
+  8036f5:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8036fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036ff:	0f 42 c2             	cmovb  %edx,%eax
+		*from_env_store = thisenv->env_ipc_from;
+  803702:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803709:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80370f:	89 07                	mov    %eax,(%edi)
+	if (perm_store)
+  803711:	85 f6                	test   %esi,%esi
+  803713:	74 2a                	je     80373f <ipc_recv_pages+0x8f>
+  803715:	89 e2                	mov    %esp,%edx
+  803717:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80371c:	29 d0                	sub    %edx,%eax
+  80371e:	89 c2                	mov    %eax,%edx
+  803720:	c1 ea 0f             	shr    $0xf,%edx
+  803723:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803728:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372d:	0f 42 c2             	cmovb  %edx,%eax
+		*perm_store = thisenv->env_ipc_perm;
+  803730:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803737:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80373d:	89 06                	mov    %eax,(%esi)
+	if (npages_store)
+  80373f:	85 db                	test   %ebx,%ebx
+  803741:	74 2a                	je     80376d <ipc_recv_pages+0xbd>
+  803743:	89 e2                	mov    %esp,%edx
+  803745:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  80374a:	29 d0                	sub    %edx,%eax
+  80374c:	89 c2                	mov    %eax,%edx
+  80374e:	c1 ea 0f             	shr    $0xf,%edx
+  803751:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80375b:	0f 42 c2             	cmovb  %edx,%eax
+		*npages_store = thisenv->env_ipc_npages;
+  80375e:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  803765:	8b 80 98 00 00 00    	mov    0x98(%eax),%eax
+  80376b:	89 03                	mov    %eax,(%ebx)
+  80376d:	89 e2                	mov    %esp,%edx
+  80376f:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  803774:	29 d0                	sub    %edx,%eax
+  803776:	89 c2                	mov    %eax,%edx
+  803778:	c1 ea 0f             	shr    $0xf,%edx
+  80377b:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  803780:	b8 00 00 00 00       	mov    $0x0,%eax
+  803785:	0f 42 c2             	cmovb  %edx,%eax
+	return thisenv->env_ipc_value;
+  803788:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  80378f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+}
+  803795:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803798:	5b                   	pop    %ebx
+  803799:	5e                   	pop    %esi
+  80379a:	5f                   	pop    %edi
+  80379b:	5d                   	pop    %ebp
+  80379c:	c3                   	ret
+		if (from_env_store)
+  80379d:	85 ff                	test   %edi,%edi
+  80379f:	74 06                	je     8037a7 <ipc_recv_pages+0xf7>
+			*from_env_store = 0;
+  8037a1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store)
+  8037a7:	85 f6                	test   %esi,%esi
+  8037a9:	74 06                	je     8037b1 <ipc_recv_pages+0x101>
+			*perm_store = 0;
+  8037ab:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store)
+  8037b1:	85 db                	test   %ebx,%ebx
+  8037b3:	74 e0                	je     803795 <ipc_recv_pages+0xe5>
+			*npages_store = 0;
+  8037b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8037bb:	eb d8                	jmp    803795 <ipc_recv_pages+0xe5>
+
+008037bd <ipc_try_send_pages>:
+// While 'to_env' is not receiving, sleep until it next calls
+// sys_ipc_recv, which wakes the envs waiting on its env_ipc_nrecv.
+int
+ipc_try_send_pages(envid_t to_env, uint32_t val, void *pg, int npages,
+		   int perm)
+{
+  8037bd:	55                   	push   %ebp
+  8037be:	89 e5                	mov    %esp,%ebp
+  8037c0:	57                   	push   %edi
+  8037c1:	56                   	push   %esi
+  8037c2:	53                   	push   %ebx
+  8037c3:	83 ec 1c             	sub    $0x1c,%esp
+  8037c6:	8b 7d 10             	mov    0x10(%ebp),%edi
+	volatile uint32_t *nrecv;
+	uint32_t n;
+	int ret;
+
+	nrecv = (volatile uint32_t *) &envs[ENVX(to_env ? to_env : thisenv->env_id)].env_ipc_nrecv;
+  8037c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8037cc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8037d2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8037d6:	75 2b                	jne    803803 <ipc_try_send_pages+0x46>
+  8037d8:	89 e2                	mov    %esp,%edx
+  8037da:	b8 ff ff bf ee       	mov    $0xeebfffff,%eax
+  8037df:	29 d0                	sub    %edx,%eax
+  8037e1:	89 c2                	mov    %eax,%edx
+  8037e3:	c1 ea 0f             	shr    $0xf,%edx
+  8037e6:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  8037eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f0:	0f 42 c2             	cmovb  %edx,%eax
+  8037f3:	8b 04 85 40 63 80 00 	mov    0x806340(,%eax,4),%eax
+  8037fa:	8b 70 48             	mov    0x48(%eax),%esi
+  8037fd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  803803:	69 c6 bc 00 00 00    	imul   $0xbc,%esi,%eax
+  803809:	05 9c 00 c0 ee       	add    $0xeec0009c,%eax
+  80380e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803811:	85 ff                	test   %edi,%edi
+  803813:	b8 00 e0 bf ee       	mov    $0xeebfe000,%eax
+  803818:	0f 44 f8             	cmove  %eax,%edi
+	while (1) {
+		n = *nrecv;
+  80381b:	69 f6 bc 00 00 00    	imul   $0xbc,%esi,%esi
+  803821:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  803827:	8b 9e 9c 00 00 00    	mov    0x9c(%esi),%ebx
+		ret = sys_ipc_try_send_pages(to_env, val,
+  80382d:	83 ec 0c             	sub    $0xc,%esp
+  803830:	ff 75 14             	push   0x14(%ebp)
+  803833:	ff 75 18             	push   0x18(%ebp)
+  803836:	57                   	push   %edi
+  803837:	ff 75 0c             	push   0xc(%ebp)
+  80383a:	ff 75 08             	push   0x8(%ebp)
+  80383d:	e8 11 d7 ff ff       	call   800f53 <sys_ipc_try_send_pages>
+					     pg ? pg : (void *) USTACKTOP,
+					     perm, npages);
+		if (ret != -E_IPC_NOT_RECV)
+  803842:	83 c4 20             	add    $0x20,%esp
+  803845:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803848:	75 21                	jne    80386b <ipc_try_send_pages+0xae>
+			return ret;
+		// -E_AGAIN: it has received since, so try again now.
+		if ((ret = sys_futex_wait(nrecv, n, ~0)) < 0 && ret != -E_AGAIN)
+  80384a:	83 ec 04             	sub    $0x4,%esp
+  80384d:	6a ff                	push   $0xffffffff
+  80384f:	53                   	push   %ebx
+  803850:	ff 75 e4             	push   -0x1c(%ebp)
+  803853:	e8 08 d9 ff ff       	call   801160 <sys_futex_wait>
+  803858:	83 c4 10             	add    $0x10,%esp
+  80385b:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  80385e:	74 c7                	je     803827 <ipc_try_send_pages+0x6a>
+  803860:	85 c0                	test   %eax,%eax
+  803862:	79 c3                	jns    803827 <ipc_try_send_pages+0x6a>
+			sys_yield();
+  803864:	e8 da d4 ff ff       	call   800d43 <sys_yield>
+  803869:	eb bc                	jmp    803827 <ipc_try_send_pages+0x6a>
+	}
+}
+  80386b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80386e:	5b                   	pop    %ebx
+  80386f:	5e                   	pop    %esi
+  803870:	5f                   	pop    %edi
+  803871:	5d                   	pop    %ebp
+  803872:	c3                   	ret
+
+00803873 <ipc_send>:
+{
+  803873:	55                   	push   %ebp
+  803874:	89 e5                	mov    %esp,%ebp
+  803876:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, 1, perm)) < 0)
+  803879:	ff 75 14             	push   0x14(%ebp)
+  80387c:	6a 01                	push   $0x1
+  80387e:	ff 75 10             	push   0x10(%ebp)
+  803881:	ff 75 0c             	push   0xc(%ebp)
+  803884:	ff 75 08             	push   0x8(%ebp)
+  803887:	e8 31 ff ff ff       	call   8037bd <ipc_try_send_pages>
+  80388c:	83 c4 20             	add    $0x20,%esp
+  80388f:	85 c0                	test   %eax,%eax
+  803891:	78 02                	js     803895 <ipc_send+0x22>
+}
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+		panic("sys_ipc_try_send: %e", ret);
+  803895:	50                   	push   %eax
+  803896:	68 4f 40 80 00       	push   $0x80404f
+  80389b:	6a 3f                	push   $0x3f
+  80389d:	68 64 40 80 00       	push   $0x804064
+  8038a2:	e8 f6 fc ff ff       	call   80359d <_panic>
+
+008038a7 <ipc_send_pages>:
+{
+  8038a7:	55                   	push   %ebp
+  8038a8:	89 e5                	mov    %esp,%ebp
+  8038aa:	83 ec 14             	sub    $0x14,%esp
+	if ((ret = ipc_try_send_pages(to_env, val, pg, npages, perm)) < 0)
+  8038ad:	ff 75 18             	push   0x18(%ebp)
+  8038b0:	ff 75 14             	push   0x14(%ebp)
+  8038b3:	ff 75 10             	push   0x10(%ebp)
+  8038b6:	ff 75 0c             	push   0xc(%ebp)
+  8038b9:	ff 75 08             	push   0x8(%ebp)
+  8038bc:	e8 fc fe ff ff       	call   8037bd <ipc_try_send_pages>
+  8038c1:	83 c4 20             	add    $0x20,%esp
+  8038c4:	85 c0                	test   %eax,%eax
+  8038c6:	78 02                	js     8038ca <ipc_send_pages+0x23>
+}
+  8038c8:	c9                   	leave
+  8038c9:	c3                   	ret
+		panic("sys_ipc_try_send_pages: %e", ret);
+  8038ca:	50                   	push   %eax
+  8038cb:	68 6e 40 80 00       	push   $0x80406e
+  8038d0:	6a 64                	push   $0x64
+  8038d2:	68 64 40 80 00       	push   $0x804064
+  8038d7:	e8 c1 fc ff ff       	call   80359d <_panic>
+
+008038dc <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8038dc:	55                   	push   %ebp
+  8038dd:	89 e5                	mov    %esp,%ebp
+  8038df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8038e2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8038e7:	69 d0 bc 00 00 00    	imul   $0xbc,%eax,%edx
+  8038ed:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8038f3:	8b 52 50             	mov    0x50(%edx),%edx
+  8038f6:	39 ca                	cmp    %ecx,%edx
+  8038f8:	74 11                	je     80390b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8038fa:	83 c0 01             	add    $0x1,%eax
+  8038fd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803902:	75 e3                	jne    8038e7 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803904:	b8 00 00 00 00       	mov    $0x0,%eax
+  803909:	eb 0e                	jmp    803919 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80390b:	69 c0 bc 00 00 00    	imul   $0xbc,%eax,%eax
+  803911:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803916:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803919:	5d                   	pop    %ebp
+  80391a:	c3                   	ret
+
+0080391b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80391b:	55                   	push   %ebp
+  80391c:	89 e5                	mov    %esp,%ebp
+  80391e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(vpd[PDX(v)] & PTE_P))
+  803921:	89 c2                	mov    %eax,%edx
+  803923:	c1 ea 16             	shr    $0x16,%edx
+  803926:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80392d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(vpd[PDX(v)] & PTE_P))
+  803932:	f6 c1 01             	test   $0x1,%cl
+  803935:	74 1e                	je     803955 <pageref+0x3a>
+	pte = vpt[PGNUM(v)];
+  803937:	c1 e8 0c             	shr    $0xc,%eax
+  80393a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803941:	a8 01                	test   $0x1,%al
+  803943:	74 10                	je     803955 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803945:	c1 e8 0c             	shr    $0xc,%eax
+  803948:	c1 e0 04             	shl    $0x4,%eax
+  80394b:	0f b7 90 04 00 00 ef 	movzwl -0x10fffffc(%eax),%edx
+  803952:	0f b7 d2             	movzwl %dx,%edx
+}
+  803955:	89 d0                	mov    %edx,%eax
+  803957:	5d                   	pop    %ebp
+  803958:	c3                   	ret
+
+00803959 <__udivdi3>:
+  803959:	57                   	push   %edi
+  80395a:	56                   	push   %esi
+  80395b:	53                   	push   %ebx
+  80395c:	83 ec 20             	sub    $0x20,%esp
+  80395f:	8b 44 24 30          	mov    0x30(%esp),%eax
+  803963:	8b 54 24 34          	mov    0x34(%esp),%edx
+  803967:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80396b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80396f:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803973:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803977:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80397b:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80397f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803984:	b8 00 00 00 00       	mov    $0x0,%eax
+  803989:	ba 00 00 00 00       	mov    $0x0,%edx
+  80398e:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803995:	00 
+  803996:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80399d:	00 
+  80399e:	eb 08                	jmp    8039a8 <__udivdi3+0x4f>
+  8039a0:	83 e9 01             	sub    $0x1,%ecx
+  8039a3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8039a6:	74 68                	je     803a10 <__udivdi3+0xb7>
+  8039a8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8039ac:	01 c0                	add    %eax,%eax
+  8039ae:	89 c6                	mov    %eax,%esi
+  8039b0:	89 d7                	mov    %edx,%edi
+  8039b2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8039b6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8039ba:	0f ad d0             	shrd   %cl,%edx,%eax
+  8039bd:	d3 ea                	shr    %cl,%edx
+  8039bf:	f6 c1 20             	test   $0x20,%cl
+  8039c2:	74 04                	je     8039c8 <__udivdi3+0x6f>
+  8039c4:	89 d0                	mov    %edx,%eax
+  8039c6:	31 d2                	xor    %edx,%edx
+  8039c8:	83 e0 01             	and    $0x1,%eax
+  8039cb:	89 04 24             	mov    %eax,(%esp)
+  8039ce:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8039d5:	00 
+  8039d6:	8b 04 24             	mov    (%esp),%eax
+  8039d9:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8039dd:	09 f0                	or     %esi,%eax
+  8039df:	09 fa                	or     %edi,%edx
+  8039e1:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8039e5:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8039e9:	39 f0                	cmp    %esi,%eax
+  8039eb:	89 d3                	mov    %edx,%ebx
+  8039ed:	19 fb                	sbb    %edi,%ebx
+  8039ef:	72 af                	jb     8039a0 <__udivdi3+0x47>
+  8039f1:	29 f0                	sub    %esi,%eax
+  8039f3:	19 fa                	sbb    %edi,%edx
+  8039f5:	89 cf                	mov    %ecx,%edi
+  8039f7:	c1 ef 05             	shr    $0x5,%edi
+  8039fa:	83 e7 01             	and    $0x1,%edi
+  8039fd:	89 fe                	mov    %edi,%esi
+  8039ff:	83 f6 01             	xor    $0x1,%esi
+  803a02:	d3 e6                	shl    %cl,%esi
+  803a04:	d3 e7                	shl    %cl,%edi
+  803a06:	09 74 24 18          	or     %esi,0x18(%esp)
+  803a0a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803a0e:	eb 90                	jmp    8039a0 <__udivdi3+0x47>
+  803a10:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a14:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a18:	83 c4 20             	add    $0x20,%esp
+  803a1b:	5b                   	pop    %ebx
+  803a1c:	5e                   	pop    %esi
+  803a1d:	5f                   	pop    %edi
+  803a1e:	c3                   	ret
+
+00803a1f <__umoddi3>:
+  803a1f:	57                   	push   %edi
+  803a20:	56                   	push   %esi
+  803a21:	53                   	push   %ebx
+  803a22:	83 ec 08             	sub    $0x8,%esp
+  803a25:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a29:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a2d:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803a31:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803a35:	57                   	push   %edi
+  803a36:	56                   	push   %esi
+  803a37:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a3b:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a3f:	52                   	push   %edx
+  803a40:	50                   	push   %eax
+  803a41:	e8 13 ff ff ff       	call   803959 <__udivdi3>
+  803a46:	89 c3                	mov    %eax,%ebx
+  803a48:	0f af d6             	imul   %esi,%edx
+  803a4b:	89 f9                	mov    %edi,%ecx
+  803a4d:	0f af cb             	imul   %ebx,%ecx
+  803a50:	01 d1                	add    %edx,%ecx
+  803a52:	89 d8                	mov    %ebx,%eax
+  803a54:	f7 e6                	mul    %esi
+  803a56:	89 c6                	mov    %eax,%esi
+  803a58:	89 d7                	mov    %edx,%edi
+  803a5a:	01 cf                	add    %ecx,%edi
+  803a5c:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803a60:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803a64:	29 f0                	sub    %esi,%eax
+  803a66:	19 fa                	sbb    %edi,%edx
+  803a68:	83 c4 18             	add    $0x18,%esp
+  803a6b:	5b                   	pop    %ebx
+  803a6c:	5e                   	pop    %esi
+  803a6d:	5f                   	pop    %edi
+  803a6e:	c3                   	ret
+
+00803a6f <__divdi3>:
+  803a6f:	53                   	push   %ebx
+  803a70:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a74:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a78:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803a7c:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803a80:	85 d2                	test   %edx,%edx
+  803a82:	78 12                	js     803a96 <__divdi3+0x27>
+  803a84:	85 db                	test   %ebx,%ebx
+  803a86:	78 2e                	js     803ab6 <__divdi3+0x47>
+  803a88:	53                   	push   %ebx
+  803a89:	51                   	push   %ecx
+  803a8a:	52                   	push   %edx
+  803a8b:	50                   	push   %eax
+  803a8c:	e8 c8 fe ff ff       	call   803959 <__udivdi3>
+  803a91:	83 c4 10             	add    $0x10,%esp
+  803a94:	eb 1e                	jmp    803ab4 <__divdi3+0x45>
+  803a96:	f7 d8                	neg    %eax
+  803a98:	83 d2 00             	adc    $0x0,%edx
+  803a9b:	f7 da                	neg    %edx
+  803a9d:	85 db                	test   %ebx,%ebx
+  803a9f:	78 2a                	js     803acb <__divdi3+0x5c>
+  803aa1:	53                   	push   %ebx
+  803aa2:	51                   	push   %ecx
+  803aa3:	52                   	push   %edx
+  803aa4:	50                   	push   %eax
+  803aa5:	e8 af fe ff ff       	call   803959 <__udivdi3>
+  803aaa:	83 c4 10             	add    $0x10,%esp
+  803aad:	f7 d8                	neg    %eax
+  803aaf:	83 d2 00             	adc    $0x0,%edx
+  803ab2:	f7 da                	neg    %edx
+  803ab4:	5b                   	pop    %ebx
+  803ab5:	c3                   	ret
+  803ab6:	f7 d9                	neg    %ecx
+  803ab8:	83 d3 00             	adc    $0x0,%ebx
+  803abb:	f7 db                	neg    %ebx
+  803abd:	53                   	push   %ebx
+  803abe:	51                   	push   %ecx
+  803abf:	52                   	push   %edx
+  803ac0:	50                   	push   %eax
+  803ac1:	e8 93 fe ff ff       	call   803959 <__udivdi3>
+  803ac6:	83 c4 10             	add    $0x10,%esp
+  803ac9:	eb e2                	jmp    803aad <__divdi3+0x3e>
+  803acb:	f7 d9                	neg    %ecx
+  803acd:	83 d3 00             	adc    $0x0,%ebx
+  803ad0:	f7 db                	neg    %ebx
+  803ad2:	53                   	push   %ebx
+  803ad3:	51                   	push   %ecx
+  803ad4:	52                   	push   %edx
+  803ad5:	50                   	push   %eax
+  803ad6:	e8 7e fe ff ff       	call   803959 <__udivdi3>
+  803adb:	83 c4 10             	add    $0x10,%esp
+  803ade:	eb d4                	jmp    803ab4 <__divdi3+0x45>
+
+00803ae0 <__moddi3>:
+  803ae0:	57                   	push   %edi
+  803ae1:	56                   	push   %esi
+  803ae2:	53                   	push   %ebx
+  803ae3:	83 ec 08             	sub    $0x8,%esp
+  803ae6:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803aea:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803aee:	8b 74 24 20          	mov    0x20(%esp),%esi
+  803af2:	8b 7c 24 24          	mov    0x24(%esp),%edi
+  803af6:	57                   	push   %edi
+  803af7:	56                   	push   %esi
+  803af8:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803afc:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803b00:	52                   	push   %edx
+  803b01:	50                   	push   %eax
+  803b02:	e8 68 ff ff ff       	call   803a6f <__divdi3>
+  803b07:	89 c3                	mov    %eax,%ebx
+  803b09:	0f af d6             	imul   %esi,%edx
+  803b0c:	89 f9                	mov    %edi,%ecx
+  803b0e:	0f af cb             	imul   %ebx,%ecx
+  803b11:	01 d1                	add    %edx,%ecx
+  803b13:	89 d8                	mov    %ebx,%eax
+  803b15:	f7 e6                	mul    %esi
+  803b17:	89 c6                	mov    %eax,%esi
+  803b19:	89 d7                	mov    %edx,%edi
+  803b1b:	01 cf                	add    %ecx,%edi
+  803b1d:	8b 44 24 10          	mov    0x10(%esp),%eax
+  803b21:	8b 54 24 14          	mov    0x14(%esp),%edx
+  803b25:	29 f0                	sub    %esi,%eax
+  803b27:	19 fa                	sbb    %edi,%edx
+  803b29:	83 c4 18             	add    $0x18,%esp
+  803b2c:	5b                   	pop    %ebx
+  803b2d:	5e                   	pop    %esi
+  803b2e:	5f                   	pop    %edi
+  803b2f:	c3                   	ret
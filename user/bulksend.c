@@ -0,0 +1,92 @@
+// Measure TCP send throughput: accept a connection on port 7, send it
+// NBYTES of a known pattern and close it.  This is done twice, with
+// and without checksum and segmentation offload.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+#define NBYTES	(1024 * 1024)
+#define CHUNK	1024
+
+static char buf[CHUNK];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+// Send NBYTES to one client and report the throughput and how many
+// cycles the whole system spent per byte sent.
+static void
+run(int serversock, const char *how)
+{
+	int clientsock, n;
+	struct sockaddr_in client;
+	unsigned int clientlen = sizeof(client);
+	struct NetStats ns0, ns1;
+	unsigned start, ms;
+	uint64_t t0, cycles;
+
+	if ((clientsock = accept(serversock, (struct sockaddr *) &client,
+				 &clientlen)) < 0)
+		die("Failed to accept client connection");
+
+	sys_net_stats(&ns0);
+	start = sys_time_msec();
+	t0 = read_tsc();
+	for (n = 0; n < NBYTES; n += CHUNK)
+		if (write(clientsock, buf, CHUNK) != CHUNK)
+			die("Failed to send");
+	close(clientsock);
+	cycles = read_tsc() - t0;
+	ms = sys_time_msec() - start;
+	sys_net_stats(&ns1);
+
+	cycles = cycles * 100 / NBYTES;
+	cprintf("bulksend: offload %s: %d bytes in %u ms, %u KB/s, "
+		"%u.%02u cycles/byte\n", how, NBYTES, ms,
+		NBYTES / (ms ? ms : 1) * 1000 / 1024,
+		(uint32_t) cycles / 100, (uint32_t) cycles % 100);
+	cprintf("bulksend: offload %s: %u packets sent, %u copied by the "
+		"kernel, %u checksummed by the card, %u TSO\n", how,
+		ns1.ns_tx_packets - ns0.ns_tx_packets,
+		ns1.ns_tx_copies - ns0.ns_tx_copies,
+		ns1.ns_tx_csum - ns0.ns_tx_csum,
+		ns1.ns_tx_tso - ns0.ns_tx_tso);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int serversock, i;
+	struct sockaddr_in addr;
+
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(serversock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(serversock, 1) < 0)
+		die("Failed to listen on server socket");
+	cprintf("bulksend: listening\n");
+
+	for (i = 0; i < CHUNK; i++)
+		buf[i] = 'a' + i % 26;
+
+	// Once with checksums and segmentation done in software, then
+	// once with the card doing them.
+	nsipc_offload(0);
+	run(serversock, "off");
+	nsipc_offload(NETOFF_ALL);
+	run(serversock, "on");
+	cprintf("bulksend: done\n");
+	close(serversock);
+}
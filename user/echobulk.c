@@ -0,0 +1,113 @@
+// Echo large messages over TCP port 7, twice: first through read and
+// write with small buffers, each call one request page to the network
+// server, then through recvmsg and sendmsg, which move up to
+// NSBULK_PAGES pages per request.  Prints the throughput of each.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT		7
+#define SMALL		1024
+#define HDRSIZE		PGSIZE
+
+static char buf[NSBULK_PAGES * PGSIZE];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+// Echo 'sock' until the client closes it.  Returns the number of
+// requests made to the network server; *bytes counts what was echoed.
+static uint32_t
+echo_small(int sock, uint32_t *bytes)
+{
+	uint32_t reqs = 0;
+	int n;
+
+	while ((n = read(sock, buf, SMALL)) > 0) {
+		if (write(sock, buf, n) != n)
+			die("Failed to send bytes to client");
+		*bytes += n;
+		reqs += 2;
+	}
+	return reqs + 1;
+}
+
+static uint32_t
+echo_bulk(int sock, uint32_t *bytes)
+{
+	struct iovec iov[2];
+	struct msghdr msg;
+	uint32_t reqs = 0;
+	int n;
+
+	// Split the buffer, as a server reading a header and a body would.
+	iov[0].iov_base = buf;
+	iov[0].iov_len = HDRSIZE;
+	iov[1].iov_base = buf + HDRSIZE;
+	iov[1].iov_len = sizeof(buf) - HDRSIZE;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = 2;
+
+	while ((n = recvmsg(sock, &msg, MSG_BATCH)) > 0) {
+		iov[1].iov_len = n > HDRSIZE ? n - HDRSIZE : 0;
+		iov[0].iov_len = MIN(n, HDRSIZE);
+		if (sendmsg(sock, &msg, 0) != n)
+			die("Failed to send bytes to client");
+		iov[0].iov_len = HDRSIZE;
+		iov[1].iov_len = sizeof(buf) - HDRSIZE;
+		*bytes += n;
+		reqs += 2;
+	}
+	return reqs + 1;
+}
+
+static void
+run(int serversock, const char *what,
+    uint32_t (*echo)(int sock, uint32_t *bytes))
+{
+	struct sockaddr_in client;
+	unsigned int len = sizeof(client);
+	uint32_t bytes = 0, reqs;
+	unsigned start, ms;
+	int sock;
+
+	cprintf("echobulk: %s: listening\n", what);
+	if ((sock = accept(serversock, (struct sockaddr *) &client, &len)) < 0)
+		die("Failed to accept client connection");
+	start = sys_time_msec();
+	reqs = echo(sock, &bytes);
+	ms = sys_time_msec() - start;
+	close(sock);
+	cprintf("echobulk: %s: %u bytes in %u ms, %u KB/s, "
+		"%u bytes per request\n", what, bytes, ms,
+		bytes / (ms ? ms : 1) * 1000 / 1024, bytes / reqs);
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sockaddr_in addr;
+	int s;
+
+	binaryname = "echobulk";
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, 1) < 0)
+		die("Failed to listen on server socket");
+
+	run(s, "small", echo_small);
+	run(s, "bulk", echo_bulk);
+	close(s);
+}
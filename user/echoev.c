@@ -0,0 +1,106 @@
+// Echo server for many concurrent connections on port 7, driven by a
+// network server readiness queue: every socket is nonblocking, and one
+// evwait returns the events of all the sockets that have work.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+#define NCONN	500
+#define MAXEV	(PGSIZE / sizeof(struct pollfd))
+
+static struct pollfd evs[MAXEV];
+static char buf[2048];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+// Write all of buf, waiting for room if need be.
+static void
+echo(int fd, const char *p, int n)
+{
+	int r;
+
+	while (n > 0) {
+		if ((r = write(fd, p, n)) == -E_AGAIN) {
+			sys_yield();
+			continue;
+		}
+		if (r <= 0)
+			die("Failed to send bytes to client");
+		p += r;
+		n -= r;
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sockaddr_in addr;
+	unsigned int len;
+	uint32_t conns = 0, closed = 0, bytes = 0, waits = 0, events = 0;
+	unsigned start = 0, ms;
+	int s, c, i, n, r;
+
+	binaryname = "echoev";
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+		die("Failed to listen on server socket");
+	if ((r = fcntl(s, F_SETFL, O_NONBLOCK)) < 0
+	    || (r = evctl(s, POLLIN)) < 0)
+		panic("echoev: %e", r);
+	cprintf("echoev: listening\n");
+
+	while (closed < NCONN) {
+		if ((n = evwait(evs, MAXEV, -1)) < 0)
+			panic("evwait: %e", n);
+		waits++;
+		events += n;
+		for (i = 0; i < n; i++) {
+			if (evs[i].fd == s) {
+				while (1) {
+					len = sizeof(addr);
+					c = accept(s, (struct sockaddr *) &addr, &len);
+					if (c == -E_AGAIN)
+						break;
+					if (c < 0)
+						panic("accept: %e", c);
+					if (conns++ == 0)
+						start = sys_time_msec();
+					if ((r = fcntl(c, F_SETFL, O_NONBLOCK)) < 0
+					    || (r = evctl(c, POLLIN)) < 0)
+						panic("echoev: %e", r);
+				}
+				continue;
+			}
+			// Edge-triggered: drain the socket.
+			while ((r = read(evs[i].fd, buf, sizeof(buf))) > 0) {
+				echo(evs[i].fd, buf, r);
+				bytes += r;
+			}
+			if (r != -E_AGAIN) {
+				close(evs[i].fd);
+				closed++;
+			}
+		}
+	}
+	ms = sys_time_msec() - start;
+	close(s);
+
+	cprintf("echoev: %u connections, %u bytes in %u ms\n",
+		conns, bytes, ms);
+	cprintf("echoev: %u events in %u waits, %u per wait\n",
+		events, waits, events / (waits ? waits : 1));
+}
@@ -14,11 +14,32 @@ die(char *m)
 	exit();
 }
 
+// How many times the network server and its helper envs have been
+// scheduled so far.  While no traffic arrives this should stay flat.
+static uint32_t
+ns_runs(void)
+{
+	envid_t ns = ipc_find_env(ENV_TYPE_NS);
+	uint32_t runs = 0;
+	int i;
+
+	for (i = 0; i < NENV; i++)
+		if (envs[i].env_status != ENV_FREE
+		    && (envs[i].env_id == ns || envs[i].env_parent_id == ns))
+			runs += envs[i].env_runs;
+	return runs;
+}
+
 void
 handle_client(int sock)
 {
 	char buffer[BUFFSIZE];
-	int received = -1;
+	int received = -1, echoes = 0;
+	unsigned start = sys_time_msec(), ms;
+	struct NetStats ns0, ns1;
+
+	sys_net_stats(&ns0);
+
 	// Receive message
 	if ((received = read(sock, buffer, BUFFSIZE)) < 0)
 		die("Failed to receive initial bytes from client");
@@ -29,11 +50,23 @@ handle_client(int sock)
 		if (write(sock, buffer, received) != received)
 			die("Failed to send bytes to client");
 
+		echoes++;
+
 		// Check for more data
 		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
 			die("Failed to receive additional bytes from client");
 	}
 	close(sock);
+	ms = sys_time_msec() - start;
+	sys_net_stats(&ns1);
+	if (echoes)
+		cprintf("%d echoes in %u ms, %u us per round trip\n", echoes,
+			ms, ms * 1000 / echoes);
+	if (ns1.ns_rx_packets != ns0.ns_rx_packets)
+		cprintf("received %u packets, %u bytes/s, %u copied by the kernel\n",
+			ns1.ns_rx_packets - ns0.ns_rx_packets,
+			(ns1.ns_rx_bytes - ns0.ns_rx_bytes) * 1000 / (ms ? ms : 1),
+			ns1.ns_rx_copies - ns0.ns_rx_copies);
 }
 
 void
@@ -74,6 +107,9 @@ umain(int argc, char **argv)
 	// Run until canceled
 	while (1) {
 		unsigned int clientlen = sizeof(echoclient);
+		uint32_t runs = ns_runs();
+		unsigned idle = sys_time_msec();
+
 		// Wait for client connection
 		if ((clientsock =
 		     accept(serversock, (struct sockaddr *) &echoclient,
@@ -81,6 +117,8 @@ umain(int argc, char **argv)
 			die("Failed to accept client connection");
 		}
 		cprintf("Client connected: %s\n", inet_ntoa(echoclient.sin_addr));
+		cprintf("network envs ran %u times in %u ms while waiting\n",
+			ns_runs() - runs, sys_time_msec() - idle);
 		handle_client(clientsock);
 	}
 
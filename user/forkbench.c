@@ -0,0 +1,170 @@
+// Measure the cost of fork() and spawn() on a large binary,
+// counting cycles and the system calls made by the parent.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS	8
+
+// Initialized data, so that the binary (and every fork of it)
+// carries a good number of writable pages.
+static uint32_t ballast[64 * PGSIZE / sizeof(uint32_t)] = { 1 };
+
+// Count the pages fork duplicates, and how many of them are copy-on-write.
+static void
+count_pages(int *mapped, int *cow)
+{
+	uintptr_t addr;
+
+	*mapped = *cow = 0;
+	for (addr = 0; addr < UTOP - PGSIZE; addr += PGSIZE) {
+		if (!(vpd[PDX(addr)] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+			continue;
+		}
+		if (!(vpt[PGNUM(addr)] & PTE_P))
+			continue;
+		(*mapped)++;
+		if (!(vpt[PGNUM(addr)] & PTE_SHARE)
+		    && (vpt[PGNUM(addr)] & (PTE_W | PTE_COW)))
+			(*cow)++;
+	}
+}
+
+// fork() as it was before page batches and shared page tables: one
+// sys_page_map per page for the child, and one more per copy-on-write
+// page to write-protect our own mapping.  The child gets the page fault
+// upcall that fork() installed.
+static envid_t
+unbatched_fork(void)
+{
+	uintptr_t addr;
+	envid_t envid;
+	pte_t pte;
+	int r, perm;
+
+	if ((envid = sys_exofork()) < 0)
+		return envid;
+	if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	for (addr = 0; addr < UXSTACKTOP - PGSIZE; addr += PGSIZE) {
+		if (!(vpd[PDX(addr)] & PTE_P)) {
+			addr = ROUNDUP(addr + 1, PTSIZE) - PGSIZE;
+			continue;
+		}
+		if (!((pte = vpt[PGNUM(addr)]) & PTE_P))
+			continue;
+		if (pte & PTE_SHARE)
+			r = sys_page_map(0, (void *) addr, envid, (void *) addr,
+					 pte & PTE_SYSCALL);
+		else if (pte & (PTE_W | PTE_COW)) {
+			perm = PTE_P | PTE_U | PTE_COW;
+			if ((r = sys_page_map(0, (void *) addr, envid,
+					      (void *) addr, perm)) >= 0)
+				r = sys_page_map(0, (void *) addr, 0,
+						 (void *) addr, perm);
+		} else
+			r = sys_page_map(0, (void *) addr, envid, (void *) addr,
+					 PTE_P | PTE_U);
+		if (r < 0)
+			panic("sys_page_map: %e", r);
+	}
+	if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+				PTE_P | PTE_U | PTE_W)) < 0
+	    || (r = sys_env_set_pgfault_upcall(envid,
+					       thisenv->env_pgfault_upcall)) < 0
+	    || (r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+		panic("unbatched fork: %e", r);
+	return envid;
+}
+
+// Report how many page tables this env has, and how many of those it
+// shares with other envs: that is most of the kernel memory an env costs
+// beyond the pages it actually uses.
+static void
+report_page_tables(const char *who)
+{
+	int pd, npt = 0, nshared = 0;
+
+	for (pd = 0; pd < PDX(UTOP); pd++)
+		if (vpd[pd] & PTE_P) {
+			npt++;
+			if (pages[PGNUM(vpd[pd])].pp_ref > 1)
+				nshared++;
+		}
+	cprintf("forkbench: %s has %d page tables, %d of them shared\n",
+		who, npt, nshared);
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t t0, fork_cycles, ufork_cycles, spawn_cycles;
+	uint32_t s0, fork_calls, ufork_calls, spawn_calls;
+	int i, r, mapped, cow;
+
+	if (argc > 1) {		// spawned child
+		if (strcmp(argv[1], "report") == 0)
+			report_page_tables("spawned child");
+		exit();
+	}
+
+	binaryname = "forkbench";
+	ballast[0]++;
+	count_pages(&mapped, &cow);
+
+	fork_cycles = 0;
+	fork_calls = 0;
+	for (i = 0; i < NROUNDS; i++) {
+		s0 = thisenv->env_syscalls;
+		t0 = read_tsc();
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0) {
+			if (i == 0)
+				report_page_tables("forked child");
+			exit();
+		}
+		fork_cycles += read_tsc() - t0;
+		fork_calls += thisenv->env_syscalls - s0;
+		wait(r);
+	}
+
+	// After fork(), which sets up the page fault handler.
+	ufork_cycles = 0;
+	ufork_calls = 0;
+	for (i = 0; i < NROUNDS; i++) {
+		s0 = thisenv->env_syscalls;
+		t0 = read_tsc();
+		if ((r = unbatched_fork()) < 0)
+			panic("unbatched fork: %e", r);
+		if (r == 0)
+			exit();
+		ufork_cycles += read_tsc() - t0;
+		ufork_calls += thisenv->env_syscalls - s0;
+		wait(r);
+	}
+
+	spawn_cycles = 0;
+	spawn_calls = 0;
+	for (i = 0; i < NROUNDS; i++) {
+		s0 = thisenv->env_syscalls;
+		t0 = read_tsc();
+		if ((r = spawnl("forkbench", "forkbench",
+				i == 0 ? "report" : "child", 0)) < 0)
+			panic("spawn: %e", r);
+		spawn_cycles += read_tsc() - t0;
+		spawn_calls += thisenv->env_syscalls - s0;
+		wait(r);
+	}
+
+	cprintf("forkbench: %d pages mapped, %d copy-on-write\n", mapped, cow);
+	cprintf("forkbench: fork  %u cycles, %u syscalls\n",
+		(uint32_t) (fork_cycles / NROUNDS), fork_calls / NROUNDS);
+	cprintf("forkbench: fork, unbatched  %u cycles, %u syscalls\n",
+		(uint32_t) (ufork_cycles / NROUNDS), ufork_calls / NROUNDS);
+	cprintf("forkbench: spawn %u cycles, %u syscalls\n",
+		(uint32_t) (spawn_cycles / NROUNDS), spawn_calls / NROUNDS);
+}
@@ -1,20 +1,68 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 #include <lwip/sockets.h>
 #include <lwip/inet.h>
 
+// By default the server runs an event loop over nonblocking sockets,
+// driven by the network server's readiness queue, so it serves many
+// connections at once.  Connections are kept alive (HTTP/1.1, or
+// HTTP/1.0 with "Connection: keep-alive"), and pipelined requests are
+// answered in order.  A response that does not fit in the socket's
+// send buffer stays with its connection, which then waits for POLLOUT
+// while the others are served.  "httpd -s" serves one connection at a
+// time.
+//
+// File data goes out with sendfile, straight from the file server's
+// block cache to the network server; "httpd -c" copies it through this
+// environment with read and write instead, for comparison.
+//
+// Whole responses for small files are kept in a cache of PTE_SHARE
+// pages, so "httpd -w N", which forks N serial workers, shares one
+// cache among them.  A cached response is used as long as its file's
+// version (st_version) has not changed.
+
 #define PORT 80
-#define VERSION "0.1"
-#define HTTP_VERSION "1.0"
+#define VERSION "0.2"
+#define HTTP_VERSION "1.1"
 
 #define E_BAD_REQ	1000
 
-#define BUFFSIZE 512
-#define MAXPENDING 5	// Max connection requests
+#define BUFFSIZE 2048		// Request bytes a connection may buffer
+#define OBUFSIZE 4096		// Response headers, or file data (-c)
+#define MAXPENDING 64		// Max connection requests
+#define MAXEV	(PGSIZE / sizeof(struct pollfd))
+#define FCACHE_SIZE 16		// Open files kept for later requests
+
+#define RCACHEVA	0xC0000000
+#define RCACHE_NENT	64		// Responses kept at most
+#define RCACHE_PAGES	256		// Pages they share
+#define RCACHE_MAX	(16 * PGSIZE)	// Largest response kept
+#define RCACHE_URLLEN	64		// Longer URLs are not cached
+#define RCACHE_REPORT	1000		// Print the hit rate this often
 
 struct http_request {
-	int sock;
+	struct conn *conn;
 	char *url;
 	char *version;
+	bool keepalive;		// Leave the connection open after this
+};
+
+// A client connection, the request bytes it has sent so far, and what
+// is left to send of the response to the first of them
+struct conn {
+	int sock;
+	int len;
+	char buf[BUFFSIZE];
+
+	struct iovec out[3];	// Bytes to send first
+	int nout;
+	int obuflen;		// Bytes of obuf in use
+	struct rcache_entry *out_cached; // Cached response 'out' points into
+	struct fcache_entry *out_file;	// Then this file's data,
+	off_t out_off, out_end;		// ... from out_off up to out_end
+	bool out_close;		// Close the connection once all is sent
+	bool blocked;		// Waiting for POLLOUT to send the rest
+	char obuf[OBUFSIZE];
 };
 
 struct responce_header {
@@ -38,6 +86,51 @@ struct error_messages errors[] = {
 	{404, "Not Found"},
 };
 
+// Files opened for earlier requests, least recently used first out.
+// An entry whose data is still being sent is not evicted; if all are,
+// the file gets a malloc'ed entry of its own, closed once it is sent.
+struct fcache_entry {
+	char url[MAXPATHLEN];
+	int fd;			// -1 if the entry is unused
+	off_t size;
+	uint32_t used;		// Clock value of the last hit
+	int refs;		// Connections sending from it
+	bool spill;		// Malloc'ed, not in fcache[]
+};
+
+static struct fcache_entry fcache[FCACHE_SIZE];
+static uint32_t fcache_clock;
+
+// A response in the cache: the header up to its Connection line, then
+// the body, in pool pages [page, page + npages).
+struct rcache_entry {
+	char url[RCACHE_URLLEN];	// "" while being built or once stale
+	uint32_t version;	// st_version of the file it was built from
+	off_t size;		// ... and st_size
+	int page;		// First pool page, or -1 if the entry is free
+	int npages;
+	int hdrlen;
+	int len;		// Header and body
+	int refs;		// Workers sending it right now
+	uint32_t used;		// Clock value of the last hit
+};
+
+struct rcache_table {
+	volatile uint32_t lock;
+	uint32_t clock;
+	uint32_t hits;
+	uint32_t misses;
+	struct rcache_entry ents[RCACHE_NENT];
+};
+
+#define RCACHE_HDRSIZE	ROUNDUP(sizeof(struct rcache_table), PGSIZE)
+#define rcache		((struct rcache_table *) RCACHEVA)
+#define rcache_pool	((char *) RCACHEVA + RCACHE_HDRSIZE)
+
+static bool rcache_on;
+static struct conn *conns[FD_SETSIZE];
+static struct pollfd evs[MAXEV];
+
 static void
 die(char *m)
 {
@@ -45,6 +138,13 @@ die(char *m)
 	exit();
 }
 
+static void
+usage(void)
+{
+	cprintf("usage: httpd [-cs] [-w workers]\n");
+	exit();
+}
+
 static void
 req_free(struct http_request *req)
 {
@@ -52,54 +152,120 @@ req_free(struct http_request *req)
 	free(req->version);
 }
 
+// Add 'n' bytes at 'buf' to the headers of c's response.
+// Returns 0, or -1 if they do not fit.
 static int
-send_header(struct http_request *req, int code)
+out_add(struct conn *c, const void *buf, int n)
 {
-	struct responce_header *h = headers;
-	while (h->code != 0 && h->header!= 0) {
-		if (h->code == code)
-			break;
-		h++;
-	}
-
-	if (h->code == 0)
+	if (c->obuflen + n > OBUFSIZE)
 		return -1;
+	memmove(c->obuf + c->obuflen, buf, n);
+	c->obuflen += n;
+	c->out[0].iov_base = c->obuf;
+	c->out[0].iov_len = c->obuflen;
+	c->nout = 1;
+	return 0;
+}
 
-	int len = strlen(h->header);
-	if (write(req->sock, h->header, len) != len) {
-		die("Failed to send bytes to client");
+// Send what is left in c->out.  Returns 0 once it is all sent, 1 if
+// the socket is full, or -1 if the client has gone.
+static int
+out_send(struct conn *c)
+{
+	struct msghdr msg;
+	struct iovec *iov = c->out;
+	int r, i;
+
+	memset(&msg, 0, sizeof(msg));
+	while (c->nout > 0) {
+		msg.msg_iov = iov;
+		msg.msg_iovlen = c->nout;
+		if ((r = sendmsg(c->sock, &msg, 0)) == -E_AGAIN)
+			return 1;
+		if (r <= 0)
+			return -1;
+		for (; c->nout > 0 && r >= iov->iov_len; c->nout--, iov++)
+			r -= iov->iov_len;
+		if (c->nout > 0) {
+			iov->iov_base = (char *) iov->iov_base + r;
+			iov->iov_len -= r;
+		}
+		for (i = 0; i < c->nout; i++)
+			c->out[i] = iov[i];
+		iov = c->out;
 	}
-
 	return 0;
 }
 
+static void fcache_put(struct fcache_entry *e);
+static void rcache_put(struct rcache_entry *e);
+
+// Let go of what c's response was being sent from.
+static void
+out_release(struct conn *c)
+{
+	if (c->out_cached)
+		rcache_put(c->out_cached);
+	if (c->out_file)
+		fcache_put(c->out_file);
+	c->out_cached = NULL;
+	c->out_file = NULL;
+	c->nout = c->obuflen = 0;
+}
+
+static bool copy_data;		// -c: read and write instead of sendfile
+
+// Send as much of c's response as the socket takes.  Returns 0 once it
+// is all sent, 1 if the socket is full, or < 0 if the connection has
+// failed.
 static int
-send_data(struct http_request *req, int fd)
+out_flush(struct conn *c)
 {
-	// LAB 6: Your code here.
-	int r, len,file_size;
-	struct Stat stat;
-	uint8_t *buf;
-	
-	if ((r = fstat(fd, &stat)) < 0) {
-		die("Failed to stat");
+	int fd, r, n;
+
+	if ((r = out_send(c)) != 0)
+		return r;
+	while (c->out_file && c->out_off < c->out_end) {
+		fd = c->out_file->fd;
+		if (copy_data) {
+			// The fd may be shared with other connections.
+			n = MIN(c->out_end - c->out_off, OBUFSIZE);
+			if ((r = seek(fd, c->out_off)) < 0
+			    || (r = readn(fd, c->obuf, n)) != n)
+				return r < 0 ? r : -E_EOF;
+			c->out[0].iov_base = c->obuf;
+			c->out[0].iov_len = n;
+			c->nout = 1;
+			c->out_off += n;
+			if ((r = out_send(c)) != 0)
+				return r;
+			continue;
+		}
+		if ((r = sendfile(c->sock, fd, c->out_off,
+				  c->out_end - c->out_off)) == -E_AGAIN)
+			return 1;
+		if (r <= 0)
+			return r < 0 ? r : -E_EOF;
+		c->out_off += r;
 	}
-	file_size = stat.st_size;
+	out_release(c);
+	return 0;
+}
 
-	buf = (uint8_t*) malloc(file_size * sizeof(uint8_t)); 
-	if(!buf) {
-		die("Failed to malloc");
-	}
-	
-	if ((len = read(fd, buf, file_size)) != file_size) {
-		die("Failed to read entire file");
-	}
-	
-	if (write(req->sock, buf, len) != len) {
-		die("Failed to send file content");
+static int
+send_header(struct http_request *req, int code)
+{
+	struct responce_header *h = headers;
+	while (h->code != 0 && h->header!= 0) {
+		if (h->code == code)
+			break;
+		h++;
 	}
-	return 0;	
-//	panic("send_data not implemented");
+
+	if (h->code == 0)
+		return -1;
+
+	return out_add(req->conn, h->header, strlen(h->header));
 }
 
 static int
@@ -112,10 +278,7 @@ send_size(struct http_request *req, off_t size)
 	if (r > 63)
 		panic("buffer too small!");
 
-	if (write(req->sock, buf, r) != r)
-		return -1;
-
-	return 0;
+	return out_add(req->conn, buf, r);
 }
 
 static const char*
@@ -140,21 +303,37 @@ send_content_type(struct http_request *req)
 	if (r > 127)
 		panic("buffer too small!");
 
-	if (write(req->sock, buf, r) != r)
-		return -1;
-
-	return 0;
+	return out_add(req->conn, buf, r);
 }
 
 static int
 send_header_fin(struct http_request *req)
 {
-	const char *fin = "\r\n";
-	int fin_len = strlen(fin);
+	const char *fin = req->keepalive ? "Connection: keep-alive\r\n\r\n"
+					 : "Connection: close\r\n\r\n";
 
-	if (write(req->sock, fin, fin_len) != fin_len)
-		return -1;
+	return out_add(req->conn, fin, strlen(fin));
+}
+
+// Does header line 'line' name header 'name' (lower case, with colon)?
+static bool
+header_is(const char *line, const char *name)
+{
+	for (; *name; line++, name++)
+		if ((*line >= 'A' && *line <= 'Z' ? *line + 'a' - 'A' : *line)
+		    != *name)
+			return 0;
+	return 1;
+}
 
+// Does 'value', up to the end of the line, contain the lower case
+// token 'token'?
+static bool
+header_has(const char *value, const char *token)
+{
+	for (; *value && *value != '\r' && *value != '\n'; value++)
+		if (header_is(value, token))
+			return 1;
 	return 0;
 }
 
@@ -189,7 +368,7 @@ http_request_parse(struct http_request *req, char *request)
 	request++;
 
 	version = request;
-	while (*request && *request != '\n')
+	while (*request && *request != '\r' && *request != '\n')
 		request++;
 	version_len = request - version;
 
@@ -197,6 +376,18 @@ http_request_parse(struct http_request *req, char *request)
 	memmove(req->version, version, version_len);
 	req->version[version_len] = '\0';
 
+	// HTTP/1.1 connections stay open unless the client says otherwise,
+	// HTTP/1.0 ones only if it asks.
+	req->keepalive = strcmp(req->version, "HTTP/1.1") == 0;
+	while ((request = strchr(request, '\n')) && *++request) {
+		if (header_is(request, "connection:")) {
+			if (header_has(request + 11, "close"))
+				req->keepalive = 0;
+			else if (header_has(request + 11, "keep-alive"))
+				req->keepalive = 1;
+		}
+	}
+
 	// no entity parsing
 
 	return 0;
@@ -205,7 +396,7 @@ http_request_parse(struct http_request *req, char *request)
 static int
 send_error(struct http_request *req, int code)
 {
-	char buf[512];
+	char buf[512], body[128];
 	int r;
 
 	struct error_messages *e = errors;
@@ -218,113 +409,517 @@ send_error(struct http_request *req, int code)
 	if (e->code == 0)
 		return -1;
 
+	r = snprintf(body, 128, "<html><body><p>%d - %s</p></body></html>\r\n",
+		     e->code, e->msg);
 	r = snprintf(buf, 512, "HTTP/" HTTP_VERSION" %d %s\r\n"
 			       "Server: jhttpd/" VERSION "\r\n"
-			       "Connection: close"
-			       "Content-type: text/html\r\n"
+			       "Content-Type: text/html\r\n"
+			       "Content-Length: %d\r\n"
+			       "Connection: %s\r\n"
 			       "\r\n"
-			       "<html><body><p>%d - %s</p></body></html>\r\n",
-			       e->code, e->msg, e->code, e->msg);
+			       "%s",
+			       e->code, e->msg, r,
+			       req->keepalive ? "keep-alive" : "close", body);
 
-	if (write(req->sock, buf, r) != r)
+	if (out_add(req->conn, buf, r) < 0)
 		return -1;
-
-	return 0;
+	return out_flush(req->conn);
 }
 
-static int
-send_file(struct http_request *req)
+// Find 'url' among the files we keep open, or open it and keep it.
+// Returns the cache entry, with a reference for fcache_put, or NULL if
+// there is no such regular file.
+static struct fcache_entry *
+fcache_get(const char *url)
 {
-	int r;
-	off_t file_size = -1;
+	struct fcache_entry *e, *victim = NULL;
+	struct Stat stat;
 	int fd;
 
-	// open the requested url for reading
-	// if the file does not exist, send a 404 error using send_error
-	// if the file is a directory, send a 404 error using send_error
-	// set file_size to the size of the file
-	struct Stat stat;
-	fd = open(req->url, O_RDONLY);
-	if(fd == -E_NOT_FOUND) {
-		send_error(req, 404);
-		r = fd;
-		goto end;
+	for (e = fcache; e < fcache + FCACHE_SIZE; e++) {
+		if (e->fd >= 0 && strcmp(e->url, url) == 0) {
+			e->used = ++fcache_clock;
+			e->refs++;
+			return e;
+		}
+		if (e->refs == 0 && (!victim || e->fd < 0
+				     || (victim->fd >= 0 && e->used < victim->used)))
+			victim = e;
 	}
-	if ((r = fstat(fd, &stat)) < 0)
-		goto end;
 
-	if(stat.st_isdir) {
-		send_error(req, 404);
-		r = -1;
-		goto end;
+	if (strlen(url) >= MAXPATHLEN || (fd = open(url, O_RDONLY)) < 0)
+		return NULL;
+	if (fstat(fd, &stat) < 0 || stat.st_isdir) {
+		close(fd);
+		return NULL;
 	}
-	file_size = stat.st_size;
+	if (!victim) {
+		if (!(victim = malloc(sizeof(*victim)))) {
+			close(fd);
+			return NULL;
+		}
+		victim->spill = 1;
+	} else if (victim->fd >= 0)
+		close(victim->fd);
+	strcpy(victim->url, url);
+	victim->fd = fd;
+	victim->size = stat.st_size;
+	victim->used = ++fcache_clock;
+	victim->refs = 1;
+	return victim;
+}
+
+static void
+fcache_put(struct fcache_entry *e)
+{
+	if (--e->refs == 0 && e->spill) {
+		close(e->fd);
+		free(e);
+	}
+}
+
+// Allocate the response cache before any workers are forked.
+static void
+rcache_init(void)
+{
+	int i, r;
+
+	for (i = 0; i < RCACHE_HDRSIZE / PGSIZE + RCACHE_PAGES; i++)
+		if ((r = sys_page_alloc(0, (char *) RCACHEVA + i * PGSIZE,
+					PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+			cprintf("httpd: no response cache: %e\n", r);
+			return;
+		}
+	for (i = 0; i < RCACHE_NENT; i++)
+		rcache->ents[i].page = -1;
+	rcache_on = 1;
+}
 
-	// LAB 6: Your code here.
-//	panic("send_file not implemented");
+static void
+rcache_lock(void)
+{
+	while (xchg(&rcache->lock, 1) != 0)
+		sys_yield();
+}
 
-	if ((r = send_header(req, 200)) < 0)
-		goto end;
+static void
+rcache_unlock(void)
+{
+	xchg(&rcache->lock, 0);
+}
 
-	if ((r = send_size(req, file_size)) < 0)
-		goto end;
+// Is page run [page, page + npages) clear of every entry?
+static bool
+rcache_free_run(int page, int npages)
+{
+	struct rcache_entry *e;
+
+	if (page + npages > RCACHE_PAGES)
+		return 0;
+	for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++)
+		if (e->page >= 0 && e->page < page + npages
+		    && page < e->page + e->npages)
+			return 0;
+	return 1;
+}
 
-	if ((r = send_content_type(req)) < 0)
-		goto end;
+// Find 'npages' free pool pages and a free entry for them, evicting
+// stale and then least recently used responses that no one is sending.
+// Call with the lock held.  Returns the entry, with page and npages
+// set, or NULL.
+static struct rcache_entry *
+rcache_alloc(int npages)
+{
+	struct rcache_entry *e, *slot, *victim;
+	int page;
 
-	if ((r = send_header_fin(req)) < 0)
-		goto end;
+	while (1) {
+		slot = victim = NULL;
+		page = rcache_free_run(0, npages) ? 0 : -1;
+		for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++) {
+			if (e->page < 0) {
+				slot = e;
+				continue;
+			}
+			if (page < 0 && rcache_free_run(e->page + e->npages, npages))
+				page = e->page + e->npages;
+			if (e->refs > 0)
+				continue;
+			// Stale responses go first, then the least recently
+			// used ones.
+			if (!victim || (!e->url[0] && victim->url[0])
+			    || (!e->url[0] == !victim->url[0]
+				&& e->used < victim->used))
+				victim = e;
+		}
+		if (slot && page >= 0) {
+			slot->page = page;
+			slot->npages = npages;
+			return slot;
+		}
+		if (!victim)
+			return NULL;
+		victim->page = -1;
+	}
+}
 
-	r = send_data(req, fd);
+// Look 'url' up in the response cache, checking it against the file's
+// current 'st'.  Returns the entry, with a reference, or NULL.
+static struct rcache_entry *
+rcache_lookup(const char *url, struct Stat *st)
+{
+	struct rcache_entry *e;
+
+	rcache_lock();
+	for (e = rcache->ents; e < rcache->ents + RCACHE_NENT; e++) {
+		if (e->page < 0 || strcmp(e->url, url) != 0)
+			continue;
+		if (e->version != st->st_version || e->size != st->st_size) {
+			// The file has changed: drop the response once the
+			// workers sending it are done.
+			e->url[0] = '\0';
+			break;
+		}
+		e->refs++;
+		e->used = ++rcache->clock;
+		rcache->hits++;
+		rcache_unlock();
+		return e;
+	}
+	rcache->misses++;
+	rcache_unlock();
+	return NULL;
+}
+
+// Build the response to 'url', whose file 'fd' is described by 'st',
+// in a new cache entry.  Returns the entry, with a reference, or NULL
+// if there is no room or the file changed under us.
+static struct rcache_entry *
+rcache_fill(const char *url, int fd, struct Stat *st)
+{
+	struct rcache_entry *e;
+	char *p;
+	int hdrlen, r;
+
+	rcache_lock();
+	e = rcache_alloc(RCACHE_MAX / PGSIZE);
+	if (e) {
+		e->url[0] = '\0';
+		e->refs = 1;
+	}
+	rcache_unlock();
+	if (!e)
+		return NULL;
+
+	p = rcache_pool + e->page * PGSIZE;
+	hdrlen = snprintf(p, RCACHE_MAX, "%sContent-Length: %ld\r\n"
+			  "Content-Type: %s\r\n",
+			  headers[0].header, (long) st->st_size,
+			  mime_type(url));
+	if (hdrlen + st->st_size > RCACHE_MAX
+	    || (r = seek(fd, 0)) < 0
+	    || (r = readn(fd, p + hdrlen, st->st_size)) != st->st_size) {
+		rcache_lock();
+		e->refs = 0;
+		e->page = -1;
+		rcache_unlock();
+		return NULL;
+	}
 
-end:
-	close(fd);
-	return r;
+	rcache_lock();
+	strcpy(e->url, url);
+	e->version = st->st_version;
+	e->size = st->st_size;
+	e->npages = ROUNDUP(hdrlen + st->st_size, PGSIZE) / PGSIZE;
+	e->hdrlen = hdrlen;
+	e->len = hdrlen + st->st_size;
+	e->used = ++rcache->clock;
+	rcache_unlock();
+	return e;
 }
 
 static void
-handle_client(int sock)
+rcache_put(struct rcache_entry *e)
 {
-	struct http_request con_d;
+	uint32_t n;
+
+	rcache_lock();
+	e->refs--;
+	n = rcache->hits + rcache->misses;
+	rcache_unlock();
+	if (n % RCACHE_REPORT == 0)
+		cprintf("httpd: cache %u hits, %u misses, %u%% hit rate\n",
+			rcache->hits, rcache->misses,
+			rcache->hits * 100 / n);
+}
+
+// Answer 'req' for the file 'fd' described by 'st' from the response
+// cache.  Returns as out_flush does, or -E_NO_MEM if the response could
+// not be cached.
+static int
+send_cached(struct http_request *req, int fd, struct Stat *st)
+{
+	struct rcache_entry *e;
+	struct conn *c = req->conn;
+	char *p;
+
+	if (strlen(req->url) >= RCACHE_URLLEN)
+		return -E_NO_MEM;
+	if (!(e = rcache_lookup(req->url, st))
+	    && !(e = rcache_fill(req->url, fd, st)))
+		return -E_NO_MEM;
+
+	p = rcache_pool + e->page * PGSIZE;
+	c->out[0].iov_base = p;
+	c->out[0].iov_len = e->hdrlen;
+	c->out[1].iov_base = req->keepalive ? "Connection: keep-alive\r\n\r\n"
+					    : "Connection: close\r\n\r\n";
+	c->out[1].iov_len = strlen(c->out[1].iov_base);
+	c->out[2].iov_base = p + e->hdrlen;
+	c->out[2].iov_len = e->len - e->hdrlen;
+	c->nout = 3;
+	c->out_cached = e;
+	return out_flush(c);
+}
+
+// Start sending the response to 'req' on its connection.  Returns as
+// out_flush does.
+static int
+send_file(struct http_request *req)
+{
+	struct fcache_entry *e;
+	struct Stat st;
 	int r;
-	char buffer[BUFFSIZE];
-	int received = -1;
-	struct http_request *req = &con_d;
 
-	while (1)
-	{
-		// Receive message
-		if ((received = read(sock, buffer, BUFFSIZE)) < 0)
-			panic("failed to read");
+	// if the file does not exist, or is a directory, send a 404
+	if (!(e = fcache_get(req->url)))
+		return send_error(req, 404);
 
-		memset(req, 0, sizeof(req));
+	// Small files come from the response cache, as long as they have
+	// not changed since it was filled.
+	if ((r = fstat(e->fd, &st)) < 0) {
+		fcache_put(e);
+		return send_error(req, 404);
+	}
+	if (rcache_on && st.st_size <= RCACHE_MAX - PGSIZE
+	    && (r = send_cached(req, e->fd, &st)) != -E_NO_MEM) {
+		fcache_put(e);
+		return r;
+	}
 
-		req->sock = sock;
+	if ((r = send_header(req, 200)) < 0
+	    || (r = send_size(req, st.st_size)) < 0
+	    || (r = send_content_type(req)) < 0
+	    || (r = send_header_fin(req)) < 0) {
+		fcache_put(e);
+		return r;
+	}
 
-		r = http_request_parse(req, buffer);
+	req->conn->out_file = e;
+	req->conn->out_off = 0;
+	req->conn->out_end = st.st_size;
+	return out_flush(req->conn);
+}
+
+// Answer the complete requests buffered on 'c', in order, until one
+// response does not fit in the socket.  Returns 0 if the connection
+// should stay open, < 0 if it should be closed.
+static int
+conn_serve(struct conn *c)
+{
+	struct http_request con_d;
+	struct http_request *req = &con_d;
+	char *end;
+	int r, n;
+
+	while (!c->blocked) {
+		c->buf[c->len] = '\0';
+		for (end = c->buf; (end = strchr(end, '\r')); end++)
+			if (strncmp(end, "\r\n\r\n", 4) == 0)
+				break;
+		if (!end)
+			// Wait for the rest, if there is room for it.
+			return c->len < BUFFSIZE - 1 ? 0 : -1;
+		n = end + 4 - c->buf;
+		*end = '\0';
+
+		memset(req, 0, sizeof(*req));
+		req->conn = c;
+
+		r = http_request_parse(req, c->buf);
 		if (r == -E_BAD_REQ)
-			send_error(req, 400);
+			r = send_error(req, 400);
 		else if (r < 0)
 			panic("parse failed");
 		else
-			send_file(req);
+			r = send_file(req);
 
 		req_free(req);
+		if (r < 0)
+			return -1;
+		c->len -= n;
+		memmove(c->buf, c->buf + n, c->len);
+		c->out_close = !req->keepalive;
+		if (r > 0) {
+			// Send the rest when the socket has room.
+			c->blocked = 1;
+			if (evctl(c->sock, POLLIN | POLLOUT) < 0)
+				return -1;
+		} else if (c->out_close)
+			return -1;
+	}
+	return 0;
+}
+
+static void
+conn_close(struct conn *c)
+{
+	out_release(c);
+	close(c->sock);
+	conns[c->sock] = 0;
+	free(c);
+}
+
+// Read what 'c' has sent and answer it, until the socket has nothing
+// more (nonblocking) or the connection ends.  While a response waits
+// for room, requests are only buffered.  Returns 0 if the connection
+// is still open, < 0 once it has been closed.
+static int
+conn_input(struct conn *c)
+{
+	int n;
+
+	while (1) {
+		if (conn_serve(c) < 0)
+			break;
+		// A full buffer is read again once the response is sent.
+		if (c->len >= BUFFSIZE - 1)
+			return 0;
+		n = read(c->sock, c->buf + c->len, BUFFSIZE - 1 - c->len);
+		if (n == -E_AGAIN)
+			return 0;
+		if (n <= 0)
+			break;
+		c->len += n;
+	}
+	conn_close(c);
+	return -1;
+}
+
+// The socket of 'c', which was waiting to send, has room again.
+static void
+conn_output(struct conn *c)
+{
+	int r;
+
+	if ((r = out_flush(c)) > 0)
+		return;
+	if (r < 0 || c->out_close || evctl(c->sock, POLLIN) < 0) {
+		conn_close(c);
+		return;
+	}
+	c->blocked = 0;
+	conn_input(c);
+}
+
+static struct conn *
+conn_open(int sock)
+{
+	struct conn *c;
 
-		// no keep alive
-		break;
+	if (sock >= FD_SETSIZE || !(c = malloc(sizeof(struct conn)))) {
+		close(sock);
+		return NULL;
 	}
+	memset(c, 0, sizeof(*c));
+	c->sock = sock;
+	conns[sock] = c;
+	return c;
+}
+
+static void
+handle_client(int sock)
+{
+	struct conn *c;
 
-	close(sock);
+	if ((c = conn_open(sock)))
+		conn_input(c);
+}
+
+// Serve every connection at once from one loop over readiness events.
+static void
+serve_events(int serversock)
+{
+	struct sockaddr_in client;
+	unsigned int clientlen;
+	struct conn *c;
+	int i, n, r, sock;
+
+	if ((r = fcntl(serversock, F_SETFL, O_NONBLOCK)) < 0
+	    || (r = evctl(serversock, POLLIN)) < 0)
+		panic("httpd: %e", r);
+
+	while (1) {
+		if ((n = evwait(evs, MAXEV, -1)) < 0)
+			panic("evwait: %e", n);
+		for (i = 0; i < n; i++) {
+			if (evs[i].fd != serversock) {
+				if (!(c = conns[evs[i].fd]))
+					continue;
+				if (c->blocked && (evs[i].revents & POLLOUT))
+					conn_output(c);
+				else
+					conn_input(c);
+				continue;
+			}
+			while (1) {
+				clientlen = sizeof(client);
+				sock = accept(serversock,
+					      (struct sockaddr *) &client,
+					      &clientlen);
+				if (sock == -E_AGAIN)
+					break;
+				if (sock < 0)
+					die("Failed to accept client connection");
+				if ((r = fcntl(sock, F_SETFL, O_NONBLOCK)) < 0
+				    || (r = evctl(sock, POLLIN)) < 0)
+					panic("httpd: %e", r);
+				conn_open(sock);
+			}
+		}
+	}
 }
 
 void
 umain(int argc, char **argv)
 {
-	int serversock, clientsock;
+	int serversock, clientsock, i;
 	struct sockaddr_in server, client;
+	struct Argstate args;
+	bool serial = 0;
+	int workers = 1;
 
 	binaryname = "jhttpd";
+	argstart(&argc, argv, &args);
+	while ((i = argnext(&args)) >= 0)
+		switch (i) {
+		case 's':
+			serial = 1;
+			break;
+		case 'c':
+			copy_data = 1;
+			break;
+		case 'w':
+			if (!argvalue(&args))
+				usage();
+			serial = 1;
+			workers = MAX(strtol(argvalue(&args), 0, 0), 1);
+			break;
+		default:
+			usage();
+		}
+	for (i = 0; i < FCACHE_SIZE; i++)
+		fcache[i].fd = -1;
 
 	// Create the TCP socket
 	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
@@ -347,8 +942,16 @@ umain(int argc, char **argv)
 	if (listen(serversock, MAXPENDING) < 0)
 		die("Failed to listen on server socket");
 
+	rcache_init();
+	// Every worker accepts connections on the same socket.
+	while (--workers > 0 && fork() > 0)
+		;
+
 	cprintf("Waiting for http connections...\n");
 
+	if (!serial)
+		serve_events(serversock);
+
 	while (1) {
 		unsigned int clientlen = sizeof(client);
 		// Wait for client connection
@@ -0,0 +1,48 @@
+// Measure IPC ping-pong latency between two processes, the pattern
+// of every file system and network server RPC.  Also reports how
+// many times per round trip the kernel had to reload CR3 (and so
+// flush the user part of the TLB).
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS	10000
+
+void
+umain(int argc, char **argv)
+{
+	struct TlbStats ts0, ts1;
+	envid_t who;
+	uint64_t t0, cycles;
+	uint32_t i, s0, calls;
+
+	binaryname = "ipcbench";
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		while ((i = ipc_recv(&who, 0, 0)) < NROUNDS)
+			ipc_send(who, i + 1, 0, 0);
+		return;
+	}
+
+	// Warm up both sides before timing.
+	ipc_send(who, 0, 0, 0);
+	ipc_recv(0, 0, 0);
+
+	sys_tlb_stats(&ts0);
+	s0 = thisenv->env_syscalls;
+	t0 = read_tsc();
+	for (i = 0; i < NROUNDS; i++) {
+		ipc_send(who, 0, 0, 0);
+		ipc_recv(0, 0, 0);
+	}
+	cycles = read_tsc() - t0;
+	calls = thisenv->env_syscalls - s0;
+	sys_tlb_stats(&ts1);
+	ipc_send(who, NROUNDS, 0, 0);
+
+	cprintf("ipcbench: %u cycles per round trip, %u syscalls\n",
+		(uint32_t) (cycles / NROUNDS), calls / NROUNDS);
+	cprintf("ipcbench: %u CR3 loads per 100 round trips\n",
+		(ts1.ts_cr3loads - ts0.ts_cr3loads) / (NROUNDS / 100));
+}
@@ -0,0 +1,125 @@
+// Measure mutex (lib/sync.c) throughput against a spinlock that calls
+// sys_yield while it waits, with 1 to 4 envs taking turns at a shared
+// counter, and the cost of handing a turn between two envs with a
+// condition variable.  Run with CPUS=4.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NOPS	20000		// Lock/unlock pairs per env
+#define NPING	5000		// Condition variable round trips
+
+#define SHARED	((struct Shared *) 0x50000000)
+
+struct Shared {
+	struct mutex mutex;
+	volatile uint32_t spin;
+	volatile uint32_t go;
+	volatile uint32_t counter;
+	volatile uint32_t syscalls;	// Made by all children together
+
+	struct mutex plock;
+	struct cond pcond;
+	volatile uint32_t turn;
+};
+
+static void
+lock(bool usemutex)
+{
+	if (usemutex)
+		mutex_lock(&SHARED->mutex);
+	else
+		while (xchg(&SHARED->spin, 1) != 0)
+			sys_yield();
+}
+
+static void
+unlock(bool usemutex)
+{
+	if (usemutex)
+		mutex_unlock(&SHARED->mutex);
+	else
+		xchg(&SHARED->spin, 0);
+}
+
+static void
+bench_lock(bool usemutex, int nenv)
+{
+	envid_t kids[4];
+	uint64_t t0;
+	uint32_t s0;
+	int i, j;
+
+	SHARED->counter = SHARED->syscalls = SHARED->go = 0;
+	for (i = 0; i < nenv; i++) {
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+			while (!SHARED->go)
+				sys_futex_wait(&SHARED->go, 0, ~0);
+			s0 = thisenv->env_syscalls;
+			for (j = 0; j < NOPS; j++) {
+				lock(usemutex);
+				SHARED->counter++;
+				unlock(usemutex);
+			}
+			xadd(&SHARED->syscalls, thisenv->env_syscalls - s0);
+			exit();
+		}
+	}
+	t0 = read_tsc();
+	SHARED->go = 1;
+	sys_futex_wake(&SHARED->go, nenv);
+	for (i = 0; i < nenv; i++)
+		wait(kids[i]);
+	if (SHARED->counter != nenv * NOPS)
+		panic("counter is %d, not %d", SHARED->counter, nenv * NOPS);
+	cprintf("lockbench: %s, %d envs: %u cycles per lock, "
+		"%u syscalls per 1000 locks\n",
+		usemutex ? "mutex   " : "spinlock", nenv,
+		(uint32_t) ((read_tsc() - t0) / (nenv * NOPS)),
+		(uint32_t) ((uint64_t) SHARED->syscalls * 1000 / (nenv * NOPS)));
+}
+
+// Two envs take turns, each waiting on the condition for the other.
+static void
+bench_pingpong(void)
+{
+	struct Shared *s = SHARED;
+	envid_t kid;
+	uint64_t t0;
+	uint32_t i, me;
+
+	t0 = read_tsc();
+	if ((kid = fork()) < 0)
+		panic("fork: %e", kid);
+	me = kid == 0;
+	for (i = 0; i < NPING; i++) {
+		mutex_lock(&s->plock);
+		while (s->turn != me)
+			cond_wait(&s->pcond, &s->plock);
+		s->turn = !me;
+		cond_signal(&s->pcond);
+		mutex_unlock(&s->plock);
+	}
+	if (kid == 0)
+		exit();
+	wait(kid);
+	cprintf("lockbench: condition variable: %u cycles per round trip\n",
+		(uint32_t) ((read_tsc() - t0) / NPING));
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r, n;
+
+	binaryname = "lockbench";
+	if ((r = sys_page_alloc(0, SHARED, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	for (n = 1; n <= 4; n *= 2) {
+		bench_lock(0, n);
+		bench_lock(1, n);
+	}
+	bench_pingpong();
+}
@@ -0,0 +1,142 @@
+// Measure malloc and free on three workloads, counting cycles and the
+// system calls they make, and report how much of the heap's memory
+// holds live data at the end of each.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSMALL	4096		// Objects the small-object rounds keep live
+#define NMIXED	1024		// Slots the mixed-size workload cycles over
+#define NOPS	20000
+#define NPKT	256		// Packets in flight in the network workload
+
+static void *slot[NSMALL];
+static struct mcache mc;
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 8;
+}
+
+static void
+report(const char *name, int ops, uint64_t cycles, uint32_t syscalls)
+{
+	struct mstats st;
+
+	malloc_stats(&st);
+	cprintf("mallocbench: %-6s %u cycles/op, %u syscalls\n",
+		name, (uint32_t) (cycles / ops), syscalls);
+	cprintf("mallocbench: %-6s heap %u KB, %u KB live (%u%%), "
+		"%u KB free in %u slabs, %u KB in free spans\n",
+		name, st.ms_arena / 1024, st.ms_inuse / 1024,
+		st.ms_arena ? (uint32_t) ((uint64_t) st.ms_inuse * 100
+					  / st.ms_arena) : 0,
+		st.ms_slabfree / 1024, st.ms_slabs, st.ms_spanfree / 1024);
+}
+
+// Fill the heap with small objects of one size and empty it again.
+static void
+bench_small(void)
+{
+	uint64_t t0;
+	uint32_t s0;
+	int round, i;
+
+	s0 = thisenv->env_syscalls;
+	t0 = read_tsc();
+	for (round = 0; round < 4; round++) {
+		for (i = 0; i < NSMALL; i++)
+			if (!(slot[i] = malloc(32)))
+				panic("malloc failed");
+		// Free every other object first, to leave holes to refill.
+		for (i = 0; i < NSMALL; i += 2)
+			free(slot[i]);
+		for (i = 0; i < NSMALL; i += 2)
+			if (!(slot[i] = malloc(48)))
+				panic("malloc failed");
+		if (round < 3)
+			for (i = 0; i < NSMALL; i++)
+				free(slot[i]);
+	}
+	report("small", 4 * 2 * NSMALL, read_tsc() - t0,
+	       thisenv->env_syscalls - s0);
+	for (i = 0; i < NSMALL; i++)
+		free(slot[i]);
+}
+
+// Random sizes, mostly small and sometimes up to 16KB, allocated,
+// resized and freed in random order.
+static void
+bench_mixed(void)
+{
+	uint64_t t0;
+	uint32_t s0;
+	size_t n;
+	int op, i;
+
+	memset(slot, 0, sizeof(slot));
+	s0 = thisenv->env_syscalls;
+	t0 = read_tsc();
+	for (op = 0; op < NOPS; op++) {
+		i = rnd() % NMIXED;
+		n = rnd() % 8 == 0 ? rnd() % 16384 : 16 + rnd() % 512;
+		if (!slot[i])
+			slot[i] = malloc(n);
+		else if (rnd() % 4 == 0)
+			slot[i] = realloc(slot[i], n);
+		else {
+			free(slot[i]);
+			slot[i] = 0;
+		}
+	}
+	report("mixed", NOPS, read_tsc() - t0, thisenv->env_syscalls - s0);
+	for (i = 0; i < NMIXED; i++)
+		free(slot[i]);
+}
+
+// What the network stack does: each packet is a small descriptor and a
+// buffer of up to a full frame, freed roughly in the order they came.
+static void
+bench_net(const char *name)
+{
+	uint64_t t0;
+	uint32_t s0;
+	int op, i, head = 0;
+
+	memset(slot, 0, sizeof(slot));
+	s0 = thisenv->env_syscalls;
+	t0 = read_tsc();
+	for (op = 0; op < NOPS; op++) {
+		i = (head + rnd() % 8) % NPKT;	// Mostly in order
+		if (slot[2 * i]) {
+			free(slot[2 * i]);
+			free(slot[2 * i + 1]);
+		}
+		slot[2 * i] = malloc(64);
+		slot[2 * i + 1] = malloc(rnd() % 4 ? 1514 : 64 + rnd() % 1450);
+		if (!slot[2 * i] || !slot[2 * i + 1])
+			panic("malloc failed");
+		head = (head + 1) % NPKT;
+	}
+	report(name, 2 * NOPS, read_tsc() - t0, thisenv->env_syscalls - s0);
+	for (i = 0; i < 2 * NPKT; i++)
+		free(slot[i]);
+}
+
+void
+umain(int argc, char **argv)
+{
+	binaryname = "mallocbench";
+	bench_small();
+	bench_mixed();
+	bench_net("net");
+	// Again as one of the network server's threads, with a cache.
+	mcache_cur = &mc;
+	bench_net("net+tc");
+	mcache_cur = NULL;
+	mcache_flush(&mc);
+	report("end", 1, 0, 0);
+}
@@ -0,0 +1,48 @@
+// Report how the receive path copes with a burst of packets from a
+// local generator: how many the card had to drop for want of a free
+// descriptor, and how full the rings got.  The generator is started
+// when we print "netburst: ready" and we report once the network has
+// been quiet for IDLE_MS.
+
+#include <inc/lib.h>
+
+#define IDLE_MS	1000
+
+void
+umain(int argc, char **argv)
+{
+	struct NetStats ns0, ns;
+	uint32_t last, got, missed;
+	unsigned quiet;
+
+	binaryname = "netburst";
+
+	sys_net_stats(&ns0);
+	cprintf("netburst: %u tx and %u rx descriptors\n",
+		ns0.ns_tx_ring, ns0.ns_rx_ring);
+	cprintf("netburst: ready\n");
+
+	// Wait for the burst to start, then for it to end.
+	last = ns0.ns_rx_packets;
+	quiet = sys_time_msec();
+	for (;;) {
+		sys_yield();
+		sys_net_stats(&ns);
+		if (ns.ns_rx_packets != last) {
+			last = ns.ns_rx_packets;
+			quiet = sys_time_msec();
+		} else if (last != ns0.ns_rx_packets
+			   && sys_time_msec() - quiet >= IDLE_MS)
+			break;
+	}
+
+	got = ns.ns_rx_packets - ns0.ns_rx_packets;
+	missed = ns.ns_rx_missed - ns0.ns_rx_missed;
+	cprintf("netburst: %u packets received, %u dropped (%u.%u%%)\n",
+		got, missed, 100 * missed / (got + missed),
+		1000 * missed / (got + missed) % 10);
+	cprintf("netburst: rx ring held at most %u of %u, "
+		"tx ring at most %u of %u\n",
+		ns.ns_rx_ready_max, ns.ns_rx_ring,
+		ns.ns_tx_inuse_max, ns.ns_tx_ring);
+}
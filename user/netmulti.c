@@ -0,0 +1,131 @@
+// Measure TCP receive throughput over many connections at once, with
+// the network server split into one shard per receive queue.  One
+// worker per shard listens on port 7 and forks a reader per connection
+// it accepts; the kernel spreads the connections over the shards.
+// Run with CPUS=1 to 4 to see how throughput scales.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+#define NCONN	8		// Connections the test opens
+#define BUFSIZE	2048
+
+#define CTL	((struct Ctl *) 0x0FFFF000)
+
+struct Ctl {
+	volatile uint32_t listening[NETQ_MAX];		// Worker is ready
+	volatile uint32_t bytes[NETQ_MAX][NCONN];	// Read on each connection
+	volatile uint32_t done[NETQ_MAX][NCONN];	// ... and whether it ended
+};
+
+static char buf[BUFSIZE];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+// Read 'sock' to the end, keeping count in CTL.
+static void
+reader(int shard, int i, int sock)
+{
+	int n;
+
+	while ((n = read(sock, buf, sizeof(buf))) > 0)
+		CTL->bytes[shard][i] += n;
+	close(sock);
+	CTL->done[shard][i] = 1;
+	exit();
+}
+
+static void
+worker(int shard)
+{
+	struct sockaddr_in addr;
+	unsigned int len;
+	int s, c, i, r;
+
+	if ((r = nsipc_shard(shard)) < 0)
+		panic("nsipc_shard %d: %e", shard, r);
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+		die("Failed to listen on server socket");
+	CTL->listening[shard] = 1;
+
+	for (i = 0; i < NCONN; i++) {
+		len = sizeof(addr);
+		if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+			die("Failed to accept client connection");
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0)
+			reader(shard, i, c);
+		close(c);
+	}
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct NetStats ns0, ns1;
+	uint32_t bytes, total, conns, nconn;
+	unsigned start, ms;
+	int q, i, r, nshard;
+
+	binaryname = "netmulti";
+	if ((r = sys_page_alloc(0, CTL, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	sys_net_stats(&ns0);
+	nshard = ns0.ns_rx_queues;
+	for (q = 0; q < nshard; q++) {
+		if ((r = fork()) < 0)
+			panic("fork: %e", r);
+		if (r == 0)
+			worker(q);
+	}
+	for (q = 0; q < nshard; q++)
+		while (!CTL->listening[q])
+			sys_yield();
+
+	cprintf("netmulti: ready, %d shards\n", nshard);
+	start = sys_time_msec();
+	do {
+		sys_yield();
+		nconn = 0;
+		for (q = 0; q < nshard; q++)
+			for (i = 0; i < NCONN; i++)
+				nconn += CTL->done[q][i];
+	} while (nconn < NCONN);
+	ms = sys_time_msec() - start;
+	sys_net_stats(&ns1);
+
+	total = 0;
+	for (q = 0; q < nshard; q++) {
+		bytes = conns = 0;
+		for (i = 0; i < NCONN; i++) {
+			bytes += CTL->bytes[q][i];
+			conns += CTL->done[q][i];
+		}
+		total += bytes;
+		cprintf("netmulti: shard %d: %u connections, %u bytes, "
+			"%u packets\n", q, conns, bytes,
+			ns1.ns_rxq_packets[q] - ns0.ns_rxq_packets[q]);
+	}
+	cprintf("netmulti: %u connections, %u bytes in %u ms, %u KB/s\n",
+		nconn, total, ms, total / (ms ? ms : 1) * 1000 / 1024);
+	cprintf("netmulti: %u packets dropped\n",
+		(ns1.ns_rxq_drops - ns0.ns_rxq_drops)
+		+ (ns1.ns_rx_missed - ns0.ns_rx_missed));
+}
@@ -0,0 +1,61 @@
+// Measure how many minimum-size (64-byte) Ethernet frames per second
+// the driver can transmit, one frame per system call and then in
+// batches with a single doorbell write each.
+
+#include <inc/lib.h>
+#include <kern/e1000.h>
+
+#define NFRAMES	50000
+#define FRAMELEN 60		// 64 bytes on the wire with the CRC
+#define BATCH	NETBATCH_MAX
+
+static uint8_t frame[FRAMELEN];
+
+static void
+report(const char *how, unsigned ms)
+{
+	cprintf("netpps: %s: %d frames in %u ms, %u frames/s\n", how,
+		NFRAMES, ms, NFRAMES / (ms ? ms : 1) * 1000);
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct NetFrag frames[BATCH];
+	uint32_t low, high;
+	unsigned start;
+	int i, n, r;
+
+	binaryname = "netpps";
+
+	// Broadcast, from our MAC, with the local experimental EtherType.
+	sys_get_mac(&low, &high);
+	memset(frame, 0xff, 6);
+	memmove(frame + 6, &low, 4);
+	memmove(frame + 10, &high, 2);
+	frame[12] = 0x88;
+	frame[13] = 0xb5;
+
+	start = sys_time_msec();
+	for (i = 0; i < NFRAMES; i++) {
+		while ((r = sys_net_transmit(frame, FRAMELEN)) == -E_DESC_FULL)
+			;
+		if (r < 0)
+			panic("sys_net_transmit: %e", r);
+	}
+	report("single", sys_time_msec() - start);
+
+	for (i = 0; i < BATCH; i++) {
+		frames[i].nf_va = frame;
+		frames[i].nf_len = FRAMELEN;
+	}
+	start = sys_time_msec();
+	for (i = 0; i < NFRAMES; i += r) {
+		n = MIN(BATCH, NFRAMES - i);
+		if ((r = sys_net_transmit_batch(frames, n)) == -E_DESC_FULL)
+			r = 0;
+		else if (r < 0)
+			panic("sys_net_transmit_batch: %e", r);
+	}
+	report("batched", sys_time_msec() - start);
+}
@@ -0,0 +1,105 @@
+// Measure the network server's memory: idle, with NCONN TCP connections
+// open and a child env blocked reading each of them, and once they
+// have all closed.  The client (grade-lab6) echoes a few rounds on
+// every connection, then closes them.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+#define NCONN	32
+
+static struct Nsret_memstats st0;
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+static void
+report(const char *when)
+{
+	struct Nsret_memstats st;
+	uint32_t n;
+	int r;
+
+	if ((r = nsipc_memstats(&st)) < 0)
+		panic("nsipc_memstats: %e", r);
+	cprintf("nsmem: %s: %d pages (%d KB), heap %u KB, %u KB live, "
+		"%u KB in thread caches\n",
+		when, st.ret_pages, st.ret_pages * PGSIZE / 1024,
+		st.ret_malloc.ms_arena / 1024, st.ret_malloc.ms_inuse / 1024,
+		st.ret_malloc.ms_cached / 1024);
+	if (st0.ret_pages) {
+		n = st.ret_malloc.ms_nmalloc - st0.ret_malloc.ms_nmalloc;
+		cprintf("nsmem: %s: %u mallocs since idle, %u%% from "
+			"thread caches\n", when, n,
+			n ? (st.ret_malloc.ms_cachehits
+			     - st0.ret_malloc.ms_cachehits) * 100 / n : 0);
+	} else
+		st0 = st;
+}
+
+// Echo until the client closes the connection.
+static void
+echo(int c)
+{
+	char buf[512];
+	int r;
+
+	while ((r = read(c, buf, sizeof(buf))) > 0)
+		if (write(c, buf, r) != r)
+			die("Failed to send bytes to client");
+	close(c);
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sockaddr_in addr;
+	unsigned int len;
+	envid_t kids[NCONN];
+	char when[32];
+	int s, c, i;
+
+	binaryname = "nsmem";
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+		die("Failed to listen on server socket");
+	report("idle");
+	cprintf("nsmem: listening\n");
+
+	for (i = 0; i < NCONN; i++) {
+		len = sizeof(addr);
+		if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+			die("Failed to accept client connection");
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+			close(s);
+			echo(c);
+			exit();
+		}
+		close(c);
+	}
+	// Give every child time to block in the network server.
+	for (i = 0; i < 4 * NCONN; i++)
+		sys_yield();
+	snprintf(when, sizeof(when), "%d connections", NCONN);
+	report(when);
+
+	for (i = 0; i < NCONN; i++)
+		wait(kids[i]);
+	close(s);
+	report("closed");
+}
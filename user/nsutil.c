@@ -0,0 +1,125 @@
+// Measure how much CPU time the network server and its helper envs
+// use, and how often they are woken up, first while no traffic
+// arrives, then while receiving a TCP stream on port 7.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT		7
+#define IDLE_MSEC	1000
+
+static char buf[2048];
+static uint64_t cycles0[NENV];
+static uint32_t runs0[NENV];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+// Is 'e' the network server, or one of the envs it created?
+static bool
+is_ns(const volatile struct Env *e, envid_t ns)
+{
+	int depth;
+
+	for (depth = 0; depth < 4 && e->env_status != ENV_FREE; depth++) {
+		if (e->env_id == ns)
+			return 1;
+		if (!e->env_parent_id)
+			break;
+		e = &envs[ENVX(e->env_parent_id)];
+	}
+	return 0;
+}
+
+static void
+sample(void)
+{
+	int i;
+
+	for (i = 0; i < NENV; i++) {
+		cycles0[i] = envs[i].env_cycles;
+		runs0[i] = envs[i].env_runs;
+	}
+}
+
+// Print the share of one CPU each network server env has used since
+// sample(), 't' cycles and 'ms' milliseconds ago, and how many times
+// per second it was run.
+static void
+report(const char *what, uint64_t t, unsigned ms)
+{
+	envid_t ns = ipc_find_env(ENV_TYPE_NS);
+	uint64_t c, total = 0;
+	uint32_t runs, total_runs = 0;
+	int i, nenv = 0;
+
+	ms = ms ? ms : 1;
+	for (i = 0; i < NENV; i++) {
+		if (!is_ns(&envs[i], ns) || envs[i].env_cycles < cycles0[i])
+			continue;
+		c = envs[i].env_cycles - cycles0[i];
+		runs = envs[i].env_runs - runs0[i];
+		total += c;
+		total_runs += runs;
+		nenv++;
+		cprintf("nsutil: %s: env %08x %u.%u%%, %u wakeups/s\n", what,
+			envs[i].env_id, (uint32_t) (c * 100 / t),
+			(uint32_t) (c * 1000 / t % 10), runs * 1000 / ms);
+	}
+	cprintf("nsutil: %s: %d network server envs used %u.%u%% of a CPU, "
+		"%u wakeups/s\n", what, nenv, (uint32_t) (total * 100 / t),
+		(uint32_t) (total * 1000 / t % 10), total_runs * 1000 / ms);
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sockaddr_in addr;
+	unsigned int len;
+	unsigned start, ms;
+	uint64_t t0;
+	uint32_t bytes = 0;
+	int s, c, n;
+
+	binaryname = "nsutil";
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, 1) < 0)
+		die("Failed to listen on server socket");
+
+	// Idle: nothing is sent to us while we sleep.
+	sample();
+	t0 = read_tsc();
+	start = sys_time_msec();
+	while (sys_time_msec() - start < IDLE_MSEC)
+		sys_yield();
+	report("idle", read_tsc() - t0, sys_time_msec() - start);
+
+	cprintf("nsutil: listening\n");
+	len = sizeof(addr);
+	if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+		die("Failed to accept client connection");
+	sample();
+	t0 = read_tsc();
+	start = sys_time_msec();
+	while ((n = read(c, buf, sizeof(buf))) > 0)
+		bytes += n;
+	ms = sys_time_msec() - start;
+	report("load", read_tsc() - t0, ms);
+	cprintf("nsutil: load: %u bytes in %u ms, %u KB/s\n", bytes, ms,
+		bytes / (ms ? ms : 1) * 1000 / 1024);
+	close(c);
+	close(s);
+}
@@ -0,0 +1,74 @@
+// Measure pipe throughput between two processes for several write
+// sizes, and how long primespipe takes to find its first NPRIMES
+// primes, a chain of processes that talk only through pipes.
+
+#include <inc/lib.h>
+
+#define NPRIMES	200
+
+static char buf[16384];
+
+// Send 'total' bytes through a pipe, 'chunk' bytes per write, and
+// report the rate the reader got them at.
+static void
+bench(size_t chunk, size_t total)
+{
+	int p[2], r;
+	size_t n;
+	envid_t who;
+	uint32_t t0, s0, ms, reads = 0;
+
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((who = fork()) < 0)
+		panic("fork: %e", who);
+	if (who == 0) {
+		close(p[0]);
+		for (n = 0; n < total; n += chunk)
+			if ((r = write(p[1], buf, chunk)) != chunk)
+				panic("write: %d %e", r, r >= 0 ? 0 : r);
+		exit();
+	}
+	close(p[1]);
+
+	s0 = thisenv->env_syscalls;
+	t0 = sys_time_msec();
+	for (n = 0; (r = read(p[0], buf, sizeof(buf))) > 0; n += r)
+		reads++;
+	if (r < 0)
+		panic("read: %e", r);
+	ms = MAX(sys_time_msec() - t0, 1);
+	close(p[0]);
+	wait(who);
+	if (n != total)
+		panic("read %d bytes, not %d", n, total);
+
+	cprintf("pipebench: %5d-byte writes: %u KB/s, %u bytes per read, "
+		"%u reader syscalls per MB\n",
+		chunk, (uint32_t) ((uint64_t) total * 1000 / 1024 / ms),
+		n / MAX(reads, 1),
+		(uint32_t) ((uint64_t) (thisenv->env_syscalls - s0)
+			    * 1048576 / total));
+}
+
+void
+umain(int argc, char **argv)
+{
+	char nprimes[16];
+	uint32_t t0;
+	int r;
+
+	binaryname = "pipebench";
+	bench(4, 1 << 20);
+	bench(64, 4 << 20);
+	bench(1024, 16 << 20);
+	bench(16384, 16 << 20);
+
+	snprintf(nprimes, sizeof(nprimes), "%d", NPRIMES);
+	t0 = sys_time_msec();
+	if ((r = spawnl("primespipe", "primespipe", nprimes, 0)) < 0)
+		panic("spawn primespipe: %e", r);
+	wait(r);
+	cprintf("pipebench: primespipe %d: %u ms\n",
+		NPRIMES, sys_time_msec() - t0);
+}
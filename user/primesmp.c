@@ -0,0 +1,131 @@
+// Count the primes below N with a sieve of Eratosthenes split across
+// 1, 2 and 4 threads (sfork), and report the speedup.  Run with CPUS=4.
+//
+// The sieve keeps one bit per odd number, in blocks of one page that
+// the threads take in turn; each block is crossed off with the primes
+// up to sqrt(N), which the first thread finds beforehand.
+
+#include <inc/lib.h>
+
+#define N	(1 << 22)
+#define SQRTN	(1 << 11)
+#define NBITS	(N / 2)			// Bit i stands for 2*i + 1
+#define BLOCK	(PGSIZE * 8)		// Bits in a block
+#define NBLOCK	(NBITS / BLOCK)
+#define NBASE	(SQRTN / 2)
+
+static uint32_t sieve[NBITS / 32] __attribute__((aligned(PGSIZE)));
+static uint32_t base[NBASE];		// Odd primes below sqrt(N)
+static int nbase;
+
+static volatile uint32_t next_block;	// Next block to take
+static volatile uint32_t nprimes;
+static volatile uint32_t bad_thisenv;	// Threads with the wrong thisenv
+
+static void
+find_base(void)
+{
+	static uint8_t composite[SQRTN];
+	uint32_t p, m;
+
+	for (p = 3; p < SQRTN; p += 2) {
+		if (composite[p])
+			continue;
+		base[nbase++] = p;
+		for (m = p * p; m < SQRTN; m += 2 * p)
+			composite[m] = 1;
+	}
+}
+
+static uint32_t
+popcount(uint32_t x)
+{
+	x = x - ((x >> 1) & 0x55555555);
+	x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+	x = (x + (x >> 4)) & 0x0F0F0F0F;
+	return (x * 0x01010101) >> 24;
+}
+
+// Cross off the multiples of the base primes in block b, and count
+// what is left.
+static uint32_t
+sieve_block(uint32_t b)
+{
+	uint32_t *w = &sieve[b * BLOCK / 32];
+	uint32_t lo = b * BLOCK, hi = lo + BLOCK;	// Bit indexes
+	uint32_t i, j, p, n = 0;
+
+	memset(w, 0, BLOCK / 8);
+	for (j = 0; j < nbase; j++) {
+		p = base[j];
+		// First odd multiple of p, from p*p, with a bit in the block.
+		i = (p * p) / 2;
+		if (i < lo)
+			i += ROUNDUP(lo - i, p);
+		for (; i < hi; i += p)
+			w[(i - lo) / 32] |= 1 << (i % 32);
+	}
+	for (i = 0; i < BLOCK / 32; i++)
+		n += 32 - popcount(w[i]);
+	return n;
+}
+
+static void
+worker(void *arg)
+{
+	uint32_t b, n = 0;
+
+	if (thisenv->env_id != sys_getenvid())
+		xadd(&bad_thisenv, 1);
+	while ((b = xadd(&next_block, 1)) < NBLOCK)
+		n += sieve_block(b);
+	xadd(&nprimes, n);
+}
+
+// Sieve with 'nthread' threads, counting this one.
+static uint64_t
+run(int nthread)
+{
+	envid_t kids[4];
+	uint64_t t0;
+	int i;
+
+	next_block = nprimes = 0;
+	t0 = read_tsc();
+	for (i = 1; i < nthread; i++)
+		if ((kids[i] = sfork(worker, 0)) < 0)
+			panic("sfork: %e", kids[i]);
+	worker(0);
+	for (i = 1; i < nthread; i++)
+		wait(kids[i]);
+	t0 = read_tsc() - t0;
+	// 1 counts as a prime in bit 0, and 2 is missing: they cancel.
+	cprintf("primesmp: %d threads: %d primes below %d in %u Mcycles\n",
+		nthread, nprimes, N, (uint32_t) (t0 / 1000000));
+	return t0;
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint64_t t1, t;
+	uint32_t count;
+	int n;
+
+	binaryname = "primesmp";
+	find_base();
+	t1 = run(1);
+	count = nprimes;
+	for (n = 2; n <= 4; n *= 2) {
+		t = run(n);
+		if (nprimes != count)
+			panic("%d threads counted %d primes, not %d",
+			      n, nprimes, count);
+		cprintf("primesmp: %d threads: speedup %u.%02u\n", n,
+			(uint32_t) (t1 / t),
+			(uint32_t) (t1 * 100 / t % 100));
+	}
+	if (bad_thisenv)
+		panic("%d threads had the wrong thisenv", bad_thisenv);
+	cprintf("primesmp: OK\n");
+}
@@ -7,9 +7,16 @@
 // Since NENVS is 1024, we can print 1022 primes before running out.
 // The remaining two environments are the integer generator at the bottom
 // of main and user/idle.
+//
+// Given a count N, it prints nothing but how long the first N primes
+// took, and then exits: the process that found the last one exits, and
+// the others follow as they find their right neighbor gone.
 
 #include <inc/lib.h>
 
+static int nprimes;		// Primes still to find, or 0 for no limit
+static unsigned start;
+
 unsigned
 primeproc(int fd)
 {
@@ -20,7 +27,13 @@ top:
 	if ((r = readn(fd, &p, 4)) != 4)
 		panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
 
-	cprintf("%d\n", p);
+	if (nprimes == 0)
+		cprintf("%d\n", p);
+	else if (--nprimes == 0) {
+		cprintf("primespipe: last prime %d after %u ms\n",
+			p, sys_time_msec() - start);
+		exit();
+	}
 
 	// fork a right neighbor to continue the chain
 	if ((i=pipe(pfd)) < 0)
@@ -41,9 +54,12 @@ top:
 	for (;;) {
 		if ((r=readn(fd, &i, 4)) != 4)
 			panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
-		if (i%p)
-			if ((r=write(wfd, &i, 4)) != 4)
+		if (i%p) {
+			if ((r=write(wfd, &i, 4)) == 0)
+				exit();	// right neighbor is gone
+			else if (r != 4)
 				panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+		}
 	}
 }
 
@@ -53,6 +69,9 @@ umain(int argc, char **argv)
 	int i, id, p[2], r;
 
 	binaryname = "primespipe";
+	if (argc > 1)
+		nprimes = strtol(argv[1], 0, 0);
+	start = sys_time_msec();
 
 	if ((i=pipe(p)) < 0)
 		panic("pipe: %e", i);
@@ -70,7 +89,9 @@ umain(int argc, char **argv)
 
 	// feed all the integers through
 	for (i=2;; i++)
-		if ((r=write(p[1], &i, 4)) != 4)
+		if ((r=write(p[1], &i, 4)) == 0)
+			exit();
+		else if (r != 4)
 			panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
 }
 
@@ -0,0 +1,116 @@
+// Multiplex NCONN TCP connections on port 7, their listening socket and
+// a pipe fed by a child in one process with poll(), echoing whatever
+// arrives on each connection.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+#define NCONN	100
+#define NTICK	20		// Messages the child writes to the pipe
+#define TICK	"tick\n"
+
+static struct pollfd fds[2 + NCONN];
+static char buf[512];
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+static void
+ticker(int wfd)
+{
+	unsigned start;
+	int i;
+
+	for (i = 0; i < NTICK; i++) {
+		start = sys_time_msec();
+		while (sys_time_msec() - start < 20)
+			sys_yield();
+		if (write(wfd, TICK, strlen(TICK)) != strlen(TICK))
+			panic("write to pipe");
+	}
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct sockaddr_in addr;
+	unsigned int len;
+	uint32_t polls = 0, ticks = 0, conns = 0, closed = 0;
+	int p[2], s, c, i, n, r;
+
+	binaryname = "testpoll";
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+		panic("fork: %e", r);
+	if (r == 0) {
+		close(p[0]);
+		ticker(p[1]);
+	}
+	close(p[1]);
+
+	if ((s = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(s, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(s, NCONN) < 0)
+		die("Failed to listen on server socket");
+	cprintf("testpoll: listening\n");
+
+	fds[0].fd = s;
+	fds[0].events = POLLIN;
+	fds[1].fd = p[0];
+	fds[1].events = POLLIN;
+	while (closed < NCONN || fds[1].fd >= 0) {
+		if ((r = poll(fds, 2 + conns, -1)) < 0)
+			panic("poll: %e", r);
+		polls++;
+
+		if (fds[0].revents & POLLIN) {
+			len = sizeof(addr);
+			if ((c = accept(s, (struct sockaddr *) &addr, &len)) < 0)
+				die("Failed to accept client connection");
+			if (conns == NCONN)
+				die("Too many connections");
+			fds[2 + conns].fd = c;
+			fds[2 + conns].events = POLLIN;
+			if (++conns == NCONN)
+				fds[0].fd = -1;
+		}
+		if (fds[1].revents) {
+			if ((n = read(fds[1].fd, buf, sizeof(buf))) <= 0) {
+				close(fds[1].fd);
+				fds[1].fd = -1;
+			} else
+				ticks += n;
+		}
+		for (i = 2; i < 2 + conns; i++) {
+			if (!fds[i].revents)
+				continue;
+			if ((n = read(fds[i].fd, buf, sizeof(buf))) <= 0) {
+				close(fds[i].fd);
+				fds[i].fd = -1;
+				closed++;
+			} else if (write(fds[i].fd, buf, n) != n)
+				die("Failed to send bytes to client");
+		}
+	}
+	close(s);
+
+	cprintf("testpoll: %u connections, %u pipe messages, %u polls\n",
+		conns, ticks / strlen(TICK), polls);
+	if (ticks != NTICK * strlen(TICK))
+		panic("lost pipe messages");
+	cprintf("testpoll: OK\n");
+}
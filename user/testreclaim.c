@@ -0,0 +1,84 @@
+// Test that the kernel reclaims clean file system cache pages when
+// physical memory runs out, and that the file server transparently
+// reads them back in afterwards.
+
+#include <inc/lib.h>
+
+#define NBLK	512			// Blocks in the test file
+#define ARENA	((char *) 0x20000000)	// Where we allocate anonymous memory
+#define ARENAEND ((char *) 0xC0000000)
+
+char buf[BLKSIZE];
+
+// Allocate anonymous pages until memory runs out, then free them again.
+// Returns the number of pages we got.
+static int
+fill_memory(void)
+{
+	char *va;
+	int r;
+
+	for (va = ARENA; va < ARENAEND; va += PGSIZE)
+		if ((r = sys_page_alloc(0, va, PTE_P|PTE_U|PTE_W)) < 0)
+			break;
+	if (va == ARENAEND)
+		panic("never ran out of memory");
+	if (r != -E_NO_MEM)
+		panic("sys_page_alloc: %e", r);
+	r = (va - ARENA) / PGSIZE;
+	while (va > ARENA) {
+		va -= PGSIZE;
+		sys_page_unmap(0, va);
+	}
+	return r;
+}
+
+static void
+check_file(const char *what)
+{
+	int fd, i, j, r;
+
+	if ((fd = open("/reclaim", O_RDONLY)) < 0)
+		panic("open /reclaim: %e", fd);
+	for (i = 0; i < NBLK; i++) {
+		if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("read block %d: %e", i, r);
+		for (j = 0; j < BLKSIZE / 4; j++)
+			if (((uint32_t *) buf)[j] != i * 1024 + j)
+				panic("%s: bad data in block %d", what, i);
+	}
+	close(fd);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int fd, i, j, r, before, after;
+
+	before = fill_memory();
+	cprintf("testreclaim: %d pages before caching the file\n", before);
+
+	// Write the file and flush it so its blocks are cached but clean.
+	if ((fd = open("/reclaim", O_RDWR|O_CREAT|O_TRUNC)) < 0)
+		panic("create /reclaim: %e", fd);
+	for (i = 0; i < NBLK; i++) {
+		for (j = 0; j < BLKSIZE / 4; j++)
+			((uint32_t *) buf)[j] = i * 1024 + j;
+		if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+			panic("write block %d: %e", i, r);
+	}
+	close(fd);
+	if ((r = sync()) < 0)
+		panic("sync: %e", r);
+	check_file("cached");
+
+	// The cached file plus our pages exceed physical memory,
+	// so the file's pages must have been reclaimed to get these.
+	after = fill_memory();
+	cprintf("testreclaim: %d pages with %d file blocks cached\n", after, NBLK);
+	if (after < before - NBLK / 2)
+		panic("cached file blocks were not reclaimed");
+
+	check_file("reclaimed");
+	cprintf("testreclaim: OK\n");
+}
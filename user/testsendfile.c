@@ -0,0 +1,69 @@
+// Check sendfile's short counts: accept a connection on port 7 and send
+// it the ranges below of data1k and data64k, then close it.  The client
+// checks that it got exactly the bytes in the file.
+
+#include <inc/lib.h>
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+
+#define PORT	7
+
+static struct {
+	const char *path;
+	off_t offset;
+	size_t len;
+	int expect;		// What sendfile should return
+} ranges[] = {
+	{ "/data1k", 0, 1024, 1024 },		// All of it
+	{ "/data1k", 1000, 100, 24 },		// Short at end of file
+	{ "/data1k", 1024, 100, 0 },		// At end of file
+	{ "/data1k", 2000, 100, 0 },		// Past it, in its last page
+	{ "/data1k", 5000, 100, 0 },		// Past its last page
+	{ "/data64k", 60000, 8192, 5536 },	// Across pages, to the end
+};
+
+static void
+die(char *m)
+{
+	cprintf("%s\n", m);
+	exit();
+}
+
+void
+umain(int argc, char **argv)
+{
+	int serversock, clientsock, fd, i, r;
+	struct sockaddr_in addr;
+	unsigned int addrlen;
+
+	if ((serversock = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP)) < 0)
+		die("Failed to create socket");
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(PORT);
+	if (bind(serversock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+		die("Failed to bind the server socket");
+	if (listen(serversock, 1) < 0)
+		die("Failed to listen on server socket");
+	cprintf("testsendfile: listening\n");
+
+	addrlen = sizeof(addr);
+	if ((clientsock = accept(serversock, (struct sockaddr *) &addr,
+				 &addrlen)) < 0)
+		die("Failed to accept client connection");
+
+	for (i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+		if ((fd = open(ranges[i].path, O_RDONLY)) < 0)
+			panic("open %s: %e", ranges[i].path, fd);
+		r = sendfile(clientsock, fd, ranges[i].offset, ranges[i].len);
+		if (r != ranges[i].expect)
+			panic("sendfile %s at %d: got %d, expected %d",
+			      ranges[i].path, ranges[i].offset, r,
+			      ranges[i].expect);
+		close(fd);
+	}
+	close(clientsock);
+	close(serversock);
+	cprintf("testsendfile: done\n");
+}
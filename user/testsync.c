@@ -0,0 +1,154 @@
+// Test mutexes and condition variables (lib/sync.c) shared by envs on
+// several CPUs.  Run with CPUS >= 2.
+
+#include <inc/lib.h>
+
+#define NCHILD	4
+#define NLOCK	2000		// Critical sections per child
+#define NITEM	1000		// Items through the bounded buffer
+#define NSLOT	4
+#define NMSG	100		// IPCs to a receiver that is busy at first
+
+#define SHARED	((struct Shared *) 0x50000000)
+
+struct Shared {
+	struct mutex lock;
+	volatile uint32_t counter;
+
+	struct mutex qlock;
+	struct cond notfull;
+	struct cond notempty;
+	uint32_t q[NSLOT];
+	uint32_t qhead, qtail;
+};
+
+static void
+test_mutex(void)
+{
+	envid_t kids[NCHILD];
+	uint32_t x;
+	int i, j;
+
+	for (i = 0; i < NCHILD; i++) {
+		if ((kids[i] = fork()) < 0)
+			panic("fork: %e", kids[i]);
+		if (kids[i] == 0) {
+			for (j = 0; j < NLOCK; j++) {
+				mutex_lock(&SHARED->lock);
+				x = SHARED->counter;
+				// Give the others a chance to barge in.
+				if (j % 64 == 0)
+					sys_yield();
+				SHARED->counter = x + 1;
+				mutex_unlock(&SHARED->lock);
+			}
+			exit();
+		}
+	}
+	for (i = 0; i < NCHILD; i++)
+		wait(kids[i]);
+	if (SHARED->counter != NCHILD * NLOCK)
+		panic("counter is %d, not %d", SHARED->counter, NCHILD * NLOCK);
+	cprintf("testsync: mutex OK\n");
+}
+
+// A producer child sends 1..NITEM through a buffer of NSLOT items.
+static void
+test_cond(void)
+{
+	struct Shared *s = SHARED;
+	envid_t kid;
+	uint32_t i, v;
+
+	if ((kid = fork()) < 0)
+		panic("fork: %e", kid);
+	if (kid == 0) {
+		for (i = 1; i <= NITEM; i++) {
+			mutex_lock(&s->qlock);
+			while (s->qtail - s->qhead == NSLOT)
+				cond_wait(&s->notfull, &s->qlock);
+			s->q[s->qtail++ % NSLOT] = i;
+			cond_signal(&s->notempty);
+			mutex_unlock(&s->qlock);
+		}
+		exit();
+	}
+	for (i = 1; i <= NITEM; i++) {
+		mutex_lock(&s->qlock);
+		while (s->qtail == s->qhead)
+			cond_wait(&s->notempty, &s->qlock);
+		v = s->q[s->qhead++ % NSLOT];
+		cond_signal(&s->notfull);
+		mutex_unlock(&s->qlock);
+		if (v != i)
+			panic("got item %d, expected %d", v, i);
+	}
+	wait(kid);
+	cprintf("testsync: cond OK\n");
+}
+
+static void
+test_timeout(void)
+{
+	uint32_t t0;
+	int r;
+
+	if ((r = sys_futex_wait(&SHARED->counter, SHARED->counter + 1, ~0))
+	    != -E_AGAIN)
+		panic("futex wait on a changed word: %e", r);
+
+	mutex_lock(&SHARED->qlock);
+	t0 = sys_time_msec();
+	r = cond_timedwait(&SHARED->notempty, &SHARED->qlock, t0 + 50);
+	if (r != -E_TIMEOUT || sys_time_msec() < t0 + 50)
+		panic("cond_timedwait returned %e after %d ms", r,
+		      sys_time_msec() - t0);
+	mutex_unlock(&SHARED->qlock);
+	cprintf("testsync: timeout OK\n");
+}
+
+// The child computes for a while before it receives, so ipc_send has
+// to wait for it.  The sender should sleep meanwhile, not spin making
+// system calls.
+static void
+test_ipc(void)
+{
+	envid_t kid;
+	uint32_t i, t0, s0, calls;
+	int32_t v;
+
+	if ((kid = fork()) < 0)
+		panic("fork: %e", kid);
+	if (kid == 0) {
+		for (t0 = sys_time_msec(); sys_time_msec() < t0 + 200; )
+			;
+		for (i = 0; i < NMSG; i++)
+			if ((v = ipc_recv(NULL, NULL, NULL)) != i)
+				panic("received %d, expected %d", v, i);
+		exit();
+	}
+	s0 = thisenv->env_syscalls;
+	for (i = 0; i < NMSG; i++)
+		ipc_send(kid, i, NULL, 0);
+	calls = thisenv->env_syscalls - s0;
+	wait(kid);
+	// A try, a sleep and a try again per message, at most
+	if (calls > 3 * NMSG)
+		panic("%d system calls to send %d messages", calls, NMSG);
+	cprintf("testsync: ipc OK\n");
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+
+	binaryname = "testsync";
+	if ((r = sys_page_alloc(0, SHARED, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	test_mutex();
+	test_cond();
+	test_timeout();
+	test_ipc();
+	cprintf("testsync: OK\n");
+}
@@ -0,0 +1,108 @@
+// Stress TLB shootdown: the parent keeps remapping pages in a child
+// running on another CPU and the child checks that it never reads
+// through a stale translation.  Run with CPUS >= 2.
+
+#include <inc/lib.h>
+
+#define NSTEP	2000		// Remaps of a single page
+#define NBULK	64		// Pages remapped at once in the second phase
+#define NBSTEP	200		// Steps of the second phase
+
+#define CTL	((struct Ctl *) 0x0FFFF000)
+#define TARGET	((char *) 0x30000000)	// Where the child sees the pages
+#define PAGES	((char *) 0x40000000)	// Where the parent keeps them
+
+struct Ctl {
+	volatile uint32_t gen;		// Value the child should read
+	volatile uint32_t npages;	// Pages mapped at TARGET
+	volatile uint32_t done;
+	volatile uint32_t reads;
+	volatile uint32_t stale;
+};
+
+static void
+child(void)
+{
+	uint32_t g, v, i;
+
+	while (CTL->gen == 0)
+		;
+	while (!CTL->done) {
+		for (i = 0; i < CTL->npages; i++) {
+			g = CTL->gen;
+			v = *(volatile uint32_t *) (TARGET + i * PGSIZE);
+			// The page for 'g' was mapped before 'g' was published,
+			// so only a stale translation can show an older value.
+			if (v < g)
+				CTL->stale++;
+			CTL->reads++;
+		}
+	}
+	exit();
+}
+
+// Fill the parent's copy 'set' of the npages pages with 'gen' and map
+// it at TARGET in 'env', then tell the child what to expect.
+static void
+remap(envid_t env, int set, int npages, uint32_t gen)
+{
+	struct PageBatch pb;
+	char *pg;
+	int i, r;
+
+	pgbatch_init(&pb);
+	for (i = 0; i < npages; i++) {
+		pg = PAGES + (set * NBULK + i) * PGSIZE;
+		*(uint32_t *) pg = gen;
+		if ((r = pgbatch_map(&pb, 0, pg, env, TARGET + i * PGSIZE,
+				     PTE_P | PTE_U)) < 0)
+			panic("pgbatch_map: %e", r);
+	}
+	if ((r = pgbatch_flush(&pb)) < 0)
+		panic("remap: %e", r);
+	// The mapping change reached the child's CPU before we returned.
+	CTL->npages = npages;
+	CTL->gen = gen;
+}
+
+void
+umain(int argc, char **argv)
+{
+	struct TlbStats ts0, ts1;
+	envid_t env;
+	uint32_t gen = 0;
+	int i, r;
+
+	if ((r = sys_page_alloc(0, CTL, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+	if ((env = fork()) < 0)
+		panic("fork: %e", env);
+	if (env == 0)
+		child();
+	for (i = 0; i < 2 * NBULK; i++)
+		if ((r = sys_page_alloc(0, PAGES + i * PGSIZE,
+					PTE_P | PTE_U | PTE_W)) < 0)
+			panic("sys_page_alloc: %e", r);
+
+	sys_tlb_stats(&ts0);
+	for (i = 0; i < NSTEP; i++) {
+		gen++;
+		remap(env, gen & 1, 1, gen);
+	}
+	for (i = 0; i < NBSTEP; i++) {
+		gen++;
+		remap(env, gen & 1, NBULK, gen);
+	}
+	CTL->done = 1;
+	wait(env);
+	sys_tlb_stats(&ts1);
+
+	cprintf("testtlb: %u reads, %u stale\n", CTL->reads, CTL->stale);
+	cprintf("testtlb: %u invalidations queued, %u full flushes, "
+		"%u rounds, %u IPIs\n",
+		ts1.ts_queued - ts0.ts_queued, ts1.ts_full - ts0.ts_full,
+		ts1.ts_rounds - ts0.ts_rounds, ts1.ts_ipis - ts0.ts_ipis);
+	if (CTL->stale)
+		panic("stale TLB entries were used");
+	cprintf("testtlb: OK\n");
+}